@@ -0,0 +1,18 @@
+/* contrib/column_fdw/column_fdw--1.0.sql */
+
+-- complain if script is sourced in psql, rather than via CREATE EXTENSION
+\echo Use "CREATE EXTENSION column_fdw" to load this file. \quit
+
+CREATE FUNCTION column_fdw_handler()
+RETURNS fdw_handler
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE FUNCTION column_fdw_validator(text[], oid)
+RETURNS void
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE FOREIGN DATA WRAPPER column_fdw
+  HANDLER column_fdw_handler
+  VALIDATOR column_fdw_validator;
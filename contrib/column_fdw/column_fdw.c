@@ -0,0 +1,1019 @@
+/*-------------------------------------------------------------------------
+ *
+ * column_fdw.c
+ *		  foreign-data wrapper for column-oriented table files.
+ *
+ * Analytic queries usually read a few columns of wide tables.  A column_fdw
+ * table keeps every column of a stripe of rows in its own compressed chunk,
+ * so a scan reads only the columns the query references, and with the
+ * per-stripe minimum and maximum of each column it skips the stripes which
+ * can't satisfy simple restriction clauses.  Rows are loaded with INSERT.
+ *
+ * Portions Copyright (c) 2010-2013, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *		  contrib/column_fdw/column_fdw.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "access/htup_details.h"
+#include "access/reloptions.h"
+#include "access/sysattr.h"
+#include "catalog/pg_foreign_table.h"
+#include "column_fdw.h"
+#include "commands/defrem.h"
+#include "commands/explain.h"
+#include "commands/vacuum.h"
+#include "foreign/fdwapi.h"
+#include "foreign/foreign.h"
+#include "miscadmin.h"
+#include "nodes/makefuncs.h"
+#include "optimizer/clauses.h"
+#include "optimizer/cost.h"
+#include "optimizer/pathnode.h"
+#include "optimizer/planmain.h"
+#include "optimizer/restrictinfo.h"
+#include "optimizer/var.h"
+#include "storage/lmgr.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+#include "utils/typcache.h"
+
+PG_MODULE_MAGIC;
+
+/*
+ * Describes the valid options for objects that use this wrapper.
+ */
+struct ColumnFdwOption
+{
+	const char *optname;
+	Oid			optcontext;		/* Oid of catalog in which option may appear */
+};
+
+static const struct ColumnFdwOption valid_options[] = {
+	{"filename", ForeignTableRelationId},
+	{"stripe_rows", ForeignTableRelationId},
+	{"compression", ForeignTableRelationId},
+
+	/* Sentinel */
+	{NULL, InvalidOid}
+};
+
+/*
+ * Options of a column_fdw foreign table, with defaults filled in.
+ */
+typedef struct ColumnFdwOptions
+{
+	char	   *filename;		/* file holding the table */
+	int			stripeRows;		/* rows per stripe written by INSERT */
+	bool		compress;		/* pglz-compress the chunks? */
+} ColumnFdwOptions;
+
+/*
+ * FDW-specific information for RelOptInfo.fdw_private.
+ */
+typedef struct ColumnFdwPlanState
+{
+	ColumnFdwOptions options;
+	List	   *columns;		/* attribute numbers the query needs */
+	double		columnFraction; /* share of the columns they make up */
+	BlockNumber pages;			/* estimate of file's physical size */
+	double		ntuples;		/* estimate of number of rows in file */
+} ColumnFdwPlanState;
+
+/*
+ * FDW-specific information for ForeignScanState.fdw_state.
+ */
+typedef struct ColumnFdwExecutionState
+{
+	char	   *filename;
+	ColumnReadState *reader;
+} ColumnFdwExecutionState;
+
+/*
+ * FDW-specific information for ResultRelInfo.ri_FdwState.
+ */
+typedef struct ColumnFdwModifyState
+{
+	ColumnWriteState *writer;
+} ColumnFdwModifyState;
+
+/*
+ * SQL functions
+ */
+extern Datum column_fdw_handler(PG_FUNCTION_ARGS);
+extern Datum column_fdw_validator(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(column_fdw_handler);
+PG_FUNCTION_INFO_V1(column_fdw_validator);
+
+/*
+ * FDW callback routines
+ */
+static void columnGetForeignRelSize(PlannerInfo *root,
+						RelOptInfo *baserel,
+						Oid foreigntableid);
+static void columnGetForeignPaths(PlannerInfo *root,
+					  RelOptInfo *baserel,
+					  Oid foreigntableid);
+static ForeignScan *columnGetForeignPlan(PlannerInfo *root,
+					 RelOptInfo *baserel,
+					 Oid foreigntableid,
+					 ForeignPath *best_path,
+					 List *tlist,
+					 List *scan_clauses);
+static void columnExplainForeignScan(ForeignScanState *node, ExplainState *es);
+static void columnBeginForeignScan(ForeignScanState *node, int eflags);
+static TupleTableSlot *columnIterateForeignScan(ForeignScanState *node);
+static void columnReScanForeignScan(ForeignScanState *node);
+static void columnEndForeignScan(ForeignScanState *node);
+static int	columnIsForeignRelUpdatable(Relation rel);
+static void columnBeginForeignModify(ModifyTableState *mtstate,
+						 ResultRelInfo *rinfo,
+						 List *fdw_private,
+						 int subplan_index,
+						 int eflags);
+static TupleTableSlot *columnExecForeignInsert(EState *estate,
+						ResultRelInfo *rinfo,
+						TupleTableSlot *slot,
+						TupleTableSlot *planSlot);
+static void columnEndForeignModify(EState *estate, ResultRelInfo *rinfo);
+static bool columnAnalyzeForeignTable(Relation relation,
+						  AcquireSampleRowsFunc *func,
+						  BlockNumber *totalpages);
+
+/*
+ * Helper functions
+ */
+static bool is_valid_option(const char *option, Oid context);
+static int	parse_stripe_rows(DefElem *def);
+static bool parse_compression(DefElem *def);
+static void columnGetOptions(Oid foreigntableid, ColumnFdwOptions *options);
+static List *all_columns(TupleDesc tupdesc);
+static List *needed_columns(RelOptInfo *baserel, TupleDesc tupdesc);
+static List *build_skip_keys(Index relid, List *clauses);
+static void estimate_size(PlannerInfo *root, RelOptInfo *baserel,
+			  ColumnFdwPlanState *fdw_private);
+static void estimate_costs(PlannerInfo *root, RelOptInfo *baserel,
+			   ColumnFdwPlanState *fdw_private,
+			   Cost *startup_cost, Cost *total_cost);
+static int column_acquire_sample_rows(Relation onerel, int elevel,
+						   HeapTuple *rows, int targrows,
+						   double *totalrows, double *totaldeadrows);
+
+
+/*
+ * Foreign-data wrapper handler function: return a struct with pointers
+ * to my callback routines.
+ */
+Datum
+column_fdw_handler(PG_FUNCTION_ARGS)
+{
+	FdwRoutine *fdwroutine = makeNode(FdwRoutine);
+
+	fdwroutine->GetForeignRelSize = columnGetForeignRelSize;
+	fdwroutine->GetForeignPaths = columnGetForeignPaths;
+	fdwroutine->GetForeignPlan = columnGetForeignPlan;
+	fdwroutine->ExplainForeignScan = columnExplainForeignScan;
+	fdwroutine->BeginForeignScan = columnBeginForeignScan;
+	fdwroutine->IterateForeignScan = columnIterateForeignScan;
+	fdwroutine->ReScanForeignScan = columnReScanForeignScan;
+	fdwroutine->EndForeignScan = columnEndForeignScan;
+	fdwroutine->IsForeignRelUpdatable = columnIsForeignRelUpdatable;
+	fdwroutine->BeginForeignModify = columnBeginForeignModify;
+	fdwroutine->ExecForeignInsert = columnExecForeignInsert;
+	fdwroutine->EndForeignModify = columnEndForeignModify;
+	fdwroutine->AnalyzeForeignTable = columnAnalyzeForeignTable;
+
+	PG_RETURN_POINTER(fdwroutine);
+}
+
+/*
+ * Validate the generic options given to a FOREIGN DATA WRAPPER, SERVER,
+ * USER MAPPING or FOREIGN TABLE that uses column_fdw.
+ *
+ * Raise an ERROR if the option or its value is considered invalid.
+ */
+Datum
+column_fdw_validator(PG_FUNCTION_ARGS)
+{
+	List	   *options_list = untransformRelOptions(PG_GETARG_DATUM(0));
+	Oid			catalog = PG_GETARG_OID(1);
+	char	   *filename = NULL;
+	ListCell   *cell;
+
+	/*
+	 * As for file_fdw, only superusers may choose which file a table reads
+	 * and writes.
+	 */
+	if (catalog == ForeignTableRelationId && !superuser())
+		ereport(ERROR,
+				(errcode(ERRCODE_INSUFFICIENT_PRIVILEGE),
+				 errmsg("only superuser can change options of a column_fdw foreign table")));
+
+	foreach(cell, options_list)
+	{
+		DefElem    *def = (DefElem *) lfirst(cell);
+
+		if (!is_valid_option(def->defname, catalog))
+		{
+			const struct ColumnFdwOption *opt;
+			StringInfoData buf;
+
+			/*
+			 * Unknown option specified, complain about it. Provide a hint
+			 * with list of valid options for the object.
+			 */
+			initStringInfo(&buf);
+			for (opt = valid_options; opt->optname; opt++)
+			{
+				if (catalog == opt->optcontext)
+					appendStringInfo(&buf, "%s%s", (buf.len > 0) ? ", " : "",
+									 opt->optname);
+			}
+
+			ereport(ERROR,
+					(errcode(ERRCODE_FDW_INVALID_OPTION_NAME),
+					 errmsg("invalid option \"%s\"", def->defname),
+					 buf.len > 0
+					 ? errhint("Valid options in this context are: %s",
+							   buf.data)
+				  : errhint("There are no valid options in this context.")));
+		}
+
+		if (strcmp(def->defname, "filename") == 0)
+		{
+			if (filename)
+				ereport(ERROR,
+						(errcode(ERRCODE_SYNTAX_ERROR),
+						 errmsg("conflicting or redundant options")));
+			filename = defGetString(def);
+		}
+		else if (strcmp(def->defname, "stripe_rows") == 0)
+			(void) parse_stripe_rows(def);
+		else if (strcmp(def->defname, "compression") == 0)
+			(void) parse_compression(def);
+	}
+
+	if (catalog == ForeignTableRelationId && filename == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_FDW_DYNAMIC_PARAMETER_VALUE_NEEDED),
+				 errmsg("filename is required for column_fdw foreign tables")));
+
+	PG_RETURN_VOID();
+}
+
+/*
+ * Check if the provided option is one of the valid options.
+ * context is the Oid of the catalog holding the object the option is for.
+ */
+static bool
+is_valid_option(const char *option, Oid context)
+{
+	const struct ColumnFdwOption *opt;
+
+	for (opt = valid_options; opt->optname; opt++)
+	{
+		if (context == opt->optcontext && strcmp(opt->optname, option) == 0)
+			return true;
+	}
+	return false;
+}
+
+static int
+parse_stripe_rows(DefElem *def)
+{
+	char	   *value = defGetString(def);
+	char	   *endptr;
+	long		rows;
+
+	errno = 0;
+	rows = strtol(value, &endptr, 10);
+	if (errno != 0 || *endptr != '\0' ||
+		rows < 1 || rows > COLUMN_MAX_STRIPE_ROWS)
+		ereport(ERROR,
+				(errcode(ERRCODE_FDW_INVALID_ATTRIBUTE_VALUE),
+				 errmsg("invalid value for option \"stripe_rows\": \"%s\"",
+						value),
+				 errdetail("Valid values are between \"%d\" and \"%d\".",
+						   1, COLUMN_MAX_STRIPE_ROWS)));
+
+	return (int) rows;
+}
+
+static bool
+parse_compression(DefElem *def)
+{
+	char	   *value = defGetString(def);
+
+	if (pg_strcasecmp(value, "pglz") == 0)
+		return true;
+	if (pg_strcasecmp(value, "none") == 0)
+		return false;
+
+	ereport(ERROR,
+			(errcode(ERRCODE_FDW_INVALID_ATTRIBUTE_VALUE),
+			 errmsg("invalid value for option \"compression\": \"%s\"",
+					value),
+			 errhint("Valid values are \"pglz\" and \"none\".")));
+	return false;				/* keep compiler quiet */
+}
+
+/*
+ * Fetch the options for a column_fdw foreign table.
+ */
+static void
+columnGetOptions(Oid foreigntableid, ColumnFdwOptions *options)
+{
+	ForeignTable *table;
+	ListCell   *lc;
+
+	options->filename = NULL;
+	options->stripeRows = COLUMN_DEFAULT_STRIPE_ROWS;
+	options->compress = true;
+
+	/* All our options live on the foreign table itself */
+	table = GetForeignTable(foreigntableid);
+	foreach(lc, table->options)
+	{
+		DefElem    *def = (DefElem *) lfirst(lc);
+
+		if (strcmp(def->defname, "filename") == 0)
+			options->filename = defGetString(def);
+		else if (strcmp(def->defname, "stripe_rows") == 0)
+			options->stripeRows = parse_stripe_rows(def);
+		else if (strcmp(def->defname, "compression") == 0)
+			options->compress = parse_compression(def);
+	}
+
+	/*
+	 * The validator should have checked that a filename was included in the
+	 * options, but check again, just in case.
+	 */
+	if (options->filename == NULL)
+		elog(ERROR, "filename is required for column_fdw foreign tables");
+}
+
+/*
+ * columnGetForeignRelSize
+ *		Obtain relation size estimates for a foreign table
+ */
+static void
+columnGetForeignRelSize(PlannerInfo *root,
+						RelOptInfo *baserel,
+						Oid foreigntableid)
+{
+	ColumnFdwPlanState *fdw_private;
+	Relation	rel;
+	TupleDesc	tupdesc;
+	int			natts = 0;
+	int			i;
+
+	fdw_private = (ColumnFdwPlanState *) palloc(sizeof(ColumnFdwPlanState));
+	columnGetOptions(foreigntableid, &fdw_private->options);
+
+	/* Work out which columns the scan has to read. */
+	rel = heap_open(foreigntableid, AccessShareLock);
+	tupdesc = RelationGetDescr(rel);
+	fdw_private->columns = needed_columns(baserel, tupdesc);
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		if (!tupdesc->attrs[i]->attisdropped)
+			natts++;
+	}
+	fdw_private->columnFraction = (natts > 0) ?
+		(double) Max(list_length(fdw_private->columns), 1) / natts : 1.0;
+	heap_close(rel, AccessShareLock);
+
+	baserel->fdw_private = (void *) fdw_private;
+
+	/* Estimate relation size */
+	estimate_size(root, baserel, fdw_private);
+}
+
+/*
+ * columnGetForeignPaths
+ *		Create possible access paths for a scan on the foreign table
+ *
+ *		There is only one access path, which returns the rows in the order
+ *		they were loaded.
+ */
+static void
+columnGetForeignPaths(PlannerInfo *root,
+					  RelOptInfo *baserel,
+					  Oid foreigntableid)
+{
+	ColumnFdwPlanState *fdw_private = (ColumnFdwPlanState *) baserel->fdw_private;
+	Cost		startup_cost;
+	Cost		total_cost;
+
+	/* Estimate costs */
+	estimate_costs(root, baserel, fdw_private,
+				   &startup_cost, &total_cost);
+
+	add_path(baserel, (Path *)
+			 create_foreignscan_path(root, baserel,
+									 baserel->rows,
+									 startup_cost,
+									 total_cost,
+									 NIL,		/* no pathkeys */
+									 NULL,		/* no outer rel either */
+									 NIL));		/* no fdw_private data */
+}
+
+/*
+ * columnGetForeignPlan
+ *		Create a ForeignScan plan node for scanning the foreign table
+ */
+static ForeignScan *
+columnGetForeignPlan(PlannerInfo *root,
+					 RelOptInfo *baserel,
+					 Oid foreigntableid,
+					 ForeignPath *best_path,
+					 List *tlist,
+					 List *scan_clauses)
+{
+	ColumnFdwPlanState *fdw_private = (ColumnFdwPlanState *) baserel->fdw_private;
+	Index		scan_relid = baserel->relid;
+	List	   *skip_keys;
+
+	/*
+	 * All the quals are still checked by the executor; the ones usable to
+	 * skip stripes are only a first filter.
+	 */
+	scan_clauses = extract_actual_clauses(scan_clauses, false);
+	skip_keys = build_skip_keys(scan_relid, scan_clauses);
+
+	/* Create the ForeignScan node */
+	return make_foreignscan(tlist,
+							scan_clauses,
+							scan_relid,
+							NIL,	/* no expressions to evaluate */
+							list_make2(fdw_private->columns, skip_keys));
+}
+
+/*
+ * columnExplainForeignScan
+ *		Produce extra output for EXPLAIN
+ */
+static void
+columnExplainForeignScan(ForeignScanState *node, ExplainState *es)
+{
+	ColumnFdwExecutionState *festate = (ColumnFdwExecutionState *) node->fdw_state;
+	ColumnFdwOptions options;
+
+	columnGetOptions(RelationGetRelid(node->ss.ss_currentRelation), &options);
+
+	ExplainPropertyText("Column File", options.filename, es);
+
+	/* Suppress file size if we're not showing cost details */
+	if (es->costs)
+	{
+		struct stat stat_buf;
+
+		if (stat(options.filename, &stat_buf) == 0)
+			ExplainPropertyLong("Column File Size", (long) stat_buf.st_size,
+								es);
+	}
+
+	/* With ANALYZE, show how many stripes the skip keys saved */
+	if (es->analyze && festate != NULL)
+	{
+		uint64		stripesRead;
+		uint64		stripesSkipped;
+
+		ColumnReadStats(festate->reader, &stripesRead, &stripesSkipped);
+		ExplainPropertyLong("Stripes Read", (long) stripesRead, es);
+		ExplainPropertyLong("Stripes Skipped", (long) stripesSkipped, es);
+	}
+}
+
+/*
+ * columnBeginForeignScan
+ *		Open the column file
+ */
+static void
+columnBeginForeignScan(ForeignScanState *node, int eflags)
+{
+	ForeignScan *plan = (ForeignScan *) node->ss.ps.plan;
+	ColumnFdwOptions options;
+	ColumnFdwExecutionState *festate;
+
+	/*
+	 * Do nothing in EXPLAIN (no ANALYZE) case.  node->fdw_state stays NULL.
+	 */
+	if (eflags & EXEC_FLAG_EXPLAIN_ONLY)
+		return;
+
+	columnGetOptions(RelationGetRelid(node->ss.ss_currentRelation), &options);
+
+	festate = (ColumnFdwExecutionState *) palloc(sizeof(ColumnFdwExecutionState));
+	festate->filename = options.filename;
+	festate->reader = ColumnBeginRead(node->ss.ss_currentRelation,
+									  options.filename,
+								   list_nth(plan->fdw_private,
+											ColumnScanPrivateColumns),
+								   list_nth(plan->fdw_private,
+											ColumnScanPrivateSkipKeys));
+
+	node->fdw_state = (void *) festate;
+}
+
+/*
+ * columnIterateForeignScan
+ *		Read next row from the column file and store it into the
+ *		ScanTupleSlot as a virtual tuple
+ */
+static TupleTableSlot *
+columnIterateForeignScan(ForeignScanState *node)
+{
+	ColumnFdwExecutionState *festate = (ColumnFdwExecutionState *) node->fdw_state;
+	TupleTableSlot *slot = node->ss.ss_ScanTupleSlot;
+
+	/*
+	 * The values point into the current stripe, which stays loaded until the
+	 * next call; the columns the scan doesn't need come back as nulls.
+	 */
+	ExecClearTuple(slot);
+	if (ColumnReadNextRow(festate->reader,
+						  slot->tts_values, slot->tts_isnull))
+		ExecStoreVirtualTuple(slot);
+
+	return slot;
+}
+
+/*
+ * columnReScanForeignScan
+ *		Rescan table, possibly with new parameters
+ */
+static void
+columnReScanForeignScan(ForeignScanState *node)
+{
+	ColumnFdwExecutionState *festate = (ColumnFdwExecutionState *) node->fdw_state;
+
+	ColumnRescan(festate->reader);
+}
+
+/*
+ * columnEndForeignScan
+ *		Finish scanning foreign table and dispose objects used for this scan
+ */
+static void
+columnEndForeignScan(ForeignScanState *node)
+{
+	ColumnFdwExecutionState *festate = (ColumnFdwExecutionState *) node->fdw_state;
+
+	/* if festate is NULL, we are in EXPLAIN; nothing to do */
+	if (festate)
+		ColumnEndRead(festate->reader);
+}
+
+/*
+ * columnIsForeignRelUpdatable
+ *		Rows can be appended, but never updated nor deleted
+ */
+static int
+columnIsForeignRelUpdatable(Relation rel)
+{
+	return (1 << CMD_INSERT);
+}
+
+/*
+ * columnBeginForeignModify
+ *		Open the column file for appending
+ */
+static void
+columnBeginForeignModify(ModifyTableState *mtstate,
+						 ResultRelInfo *rinfo,
+						 List *fdw_private,
+						 int subplan_index,
+						 int eflags)
+{
+	Relation	rel = rinfo->ri_RelationDesc;
+	ColumnFdwOptions options;
+	ColumnFdwModifyState *fmstate;
+
+	/*
+	 * Do nothing in EXPLAIN (no ANALYZE) case.  rinfo->ri_FdwState stays
+	 * NULL.
+	 */
+	if (eflags & EXEC_FLAG_EXPLAIN_ONLY)
+		return;
+
+	columnGetOptions(RelationGetRelid(rel), &options);
+
+	/*
+	 * Only one load may append to the file at a time.  This lock doesn't
+	 * conflict with the AccessShareLock of plain scans, which ignore any
+	 * stripe that isn't completely written yet.
+	 */
+	LockRelation(rel, ExclusiveLock);
+
+	fmstate = (ColumnFdwModifyState *) palloc(sizeof(ColumnFdwModifyState));
+	fmstate->writer = ColumnBeginWrite(rel, options.filename,
+									   options.stripeRows, options.compress);
+
+	rinfo->ri_FdwState = (void *) fmstate;
+}
+
+/*
+ * columnExecForeignInsert
+ *		Add one row to the stripe being built
+ */
+static TupleTableSlot *
+columnExecForeignInsert(EState *estate,
+						ResultRelInfo *rinfo,
+						TupleTableSlot *slot,
+						TupleTableSlot *planSlot)
+{
+	ColumnFdwModifyState *fmstate = (ColumnFdwModifyState *) rinfo->ri_FdwState;
+
+	slot_getallattrs(slot);
+	ColumnWriteRow(fmstate->writer, slot->tts_values, slot->tts_isnull);
+
+	return slot;
+}
+
+/*
+ * columnEndForeignModify
+ *		Write out the last stripe and close the file
+ */
+static void
+columnEndForeignModify(EState *estate, ResultRelInfo *rinfo)
+{
+	ColumnFdwModifyState *fmstate = (ColumnFdwModifyState *) rinfo->ri_FdwState;
+
+	/* if fmstate is NULL, we are in EXPLAIN; nothing to do */
+	if (fmstate)
+		ColumnEndWrite(fmstate->writer);
+}
+
+/*
+ * columnAnalyzeForeignTable
+ *		Test whether analyzing this foreign table is supported
+ */
+static bool
+columnAnalyzeForeignTable(Relation relation,
+						  AcquireSampleRowsFunc *func,
+						  BlockNumber *totalpages)
+{
+	ColumnFdwOptions options;
+	struct stat stat_buf;
+
+	columnGetOptions(RelationGetRelid(relation), &options);
+
+	/* Nothing loaded yet is an empty table, not an error */
+	if (stat(options.filename, &stat_buf) < 0)
+	{
+		if (errno != ENOENT)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not stat file \"%s\": %m",
+							options.filename)));
+		stat_buf.st_size = 0;
+	}
+
+	/*
+	 * Convert size to pages.  Must return at least 1 so that we can tell
+	 * later on that pg_class.relpages is not default.
+	 */
+	*totalpages = (stat_buf.st_size + (BLCKSZ - 1)) / BLCKSZ;
+	if (*totalpages < 1)
+		*totalpages = 1;
+
+	*func = column_acquire_sample_rows;
+
+	return true;
+}
+
+/*
+ * Integer list of the attribute numbers of all non-dropped columns.
+ */
+static List *
+all_columns(TupleDesc tupdesc)
+{
+	List	   *columns = NIL;
+	int			i;
+
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		if (!tupdesc->attrs[i]->attisdropped)
+			columns = lappend(columns, makeInteger(i + 1));
+	}
+
+	return columns;
+}
+
+/*
+ * Integer list of the attribute numbers needed for joins, final output and
+ * restriction clauses.  (Note that a COUNT(*) query needs none at all.)
+ */
+static List *
+needed_columns(RelOptInfo *baserel, TupleDesc tupdesc)
+{
+	Bitmapset  *attrs_used = NULL;
+	List	   *columns = NIL;
+	ListCell   *lc;
+	int			attnum;
+
+	pull_varattnos((Node *) baserel->reltargetlist, baserel->relid,
+				   &attrs_used);
+	foreach(lc, baserel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		pull_varattnos((Node *) rinfo->clause, baserel->relid,
+					   &attrs_used);
+	}
+
+	while ((attnum = bms_first_member(attrs_used)) >= 0)
+	{
+		/* Adjust for system attributes. */
+		attnum += FirstLowInvalidHeapAttributeNumber;
+
+		/* A whole-row reference needs all the columns. */
+		if (attnum == 0)
+			return all_columns(tupdesc);
+
+		/* Ignore system attributes and dropped columns. */
+		if (attnum < 0 || tupdesc->attrs[attnum - 1]->attisdropped)
+			continue;
+
+		columns = lappend(columns, makeInteger(attnum));
+	}
+
+	return columns;
+}
+
+/*
+ * Pick the restriction clauses which can be checked against the minimum and
+ * maximum of a stripe: "column op constant" or "constant op column", with op
+ * a member of the default btree opfamily of the column type.
+ *
+ * Returns a list of (Integer attnum, Integer strategy, Const) lists.
+ */
+static List *
+build_skip_keys(Index relid, List *clauses)
+{
+	List	   *keys = NIL;
+	ListCell   *lc;
+
+	foreach(lc, clauses)
+	{
+		OpExpr	   *op = (OpExpr *) lfirst(lc);
+		Node	   *left;
+		Node	   *right;
+		Var		   *var;
+		Const	   *argument;
+		Oid			opno;
+		TypeCacheEntry *typentry;
+		int			strategy;
+		Oid			lefttype;
+		Oid			righttype;
+
+		if (!IsA(op, OpExpr) || list_length(op->args) != 2)
+			continue;
+
+		left = (Node *) linitial(op->args);
+		right = (Node *) lsecond(op->args);
+		if (IsA(left, RelabelType))
+			left = (Node *) ((RelabelType *) left)->arg;
+		if (IsA(right, RelabelType))
+			right = (Node *) ((RelabelType *) right)->arg;
+
+		opno = op->opno;
+		if (IsA(left, Var) && IsA(right, Const))
+		{
+			var = (Var *) left;
+			argument = (Const *) right;
+		}
+		else if (IsA(left, Const) && IsA(right, Var))
+		{
+			var = (Var *) right;
+			argument = (Const *) left;
+			opno = get_commutator(opno);
+			if (!OidIsValid(opno))
+				continue;
+		}
+		else
+			continue;
+
+		if (var->varno != relid || var->varlevelsup != 0 ||
+			var->varattno <= 0 || argument->constisnull)
+			continue;
+
+		/* the stripe's minimum and maximum follow the column's collation */
+		if (op->inputcollid != var->varcollid)
+			continue;
+
+		typentry = lookup_type_cache(var->vartype, TYPECACHE_BTREE_OPFAMILY);
+		if (!OidIsValid(typentry->btree_opf) ||
+			!op_in_opfamily(opno, typentry->btree_opf))
+			continue;
+		get_op_opfamily_properties(opno, typentry->btree_opf, false,
+								   &strategy, &lefttype, &righttype);
+		if (lefttype != typentry->btree_opintype ||
+			righttype != argument->consttype)
+			continue;
+
+		keys = lappend(keys, list_make3(makeInteger(var->varattno),
+										makeInteger(strategy),
+										copyObject(argument)));
+	}
+
+	return keys;
+}
+
+/*
+ * Estimate size of a foreign table.
+ *
+ * The main result is returned in baserel->rows.  We also set
+ * fdw_private->pages and fdw_private->ntuples for later use in the cost
+ * calculation.
+ */
+static void
+estimate_size(PlannerInfo *root, RelOptInfo *baserel,
+			  ColumnFdwPlanState *fdw_private)
+{
+	struct stat stat_buf;
+	BlockNumber pages;
+	double		ntuples;
+	double		nrows;
+
+	/* A table nothing was loaded into yet has no file */
+	if (stat(fdw_private->options.filename, &stat_buf) < 0)
+		stat_buf.st_size = 0;
+
+	pages = (stat_buf.st_size + (BLCKSZ - 1)) / BLCKSZ;
+	if (pages < 1)
+		pages = 1;
+	fdw_private->pages = pages;
+
+	/*
+	 * With statistics from a previous ANALYZE, scale their tuple density by
+	 * the current file size.  Otherwise the stripe headers tell how many
+	 * rows there are, which is cheap as they are few.
+	 */
+	if (baserel->pages > 0)
+	{
+		double		density;
+
+		density = baserel->tuples / (double) baserel->pages;
+		ntuples = clamp_row_est(density * (double) pages);
+	}
+	else
+		ntuples = clamp_row_est(ColumnCountRows(fdw_private->options.filename));
+	fdw_private->ntuples = ntuples;
+
+	/*
+	 * Now estimate the number of rows returned by the scan after applying the
+	 * baserestrictinfo quals.
+	 */
+	nrows = ntuples *
+		clauselist_selectivity(root,
+							   baserel->baserestrictinfo,
+							   0,
+							   JOIN_INNER,
+							   NULL);
+
+	nrows = clamp_row_est(nrows);
+
+	/* Save the output-rows estimate for the planner */
+	baserel->rows = nrows;
+}
+
+/*
+ * Estimate costs of scanning a foreign table.
+ *
+ * Results are returned in *startup_cost and *total_cost.
+ */
+static void
+estimate_costs(PlannerInfo *root, RelOptInfo *baserel,
+			   ColumnFdwPlanState *fdw_private,
+			   Cost *startup_cost, Cost *total_cost)
+{
+	double		ntuples = fdw_private->ntuples;
+	Cost		run_cost = 0;
+	Cost		cpu_per_tuple;
+
+	/*
+	 * Only the chunks of the needed columns are read, so charge for the
+	 * matching share of the file.  Stripes skipped thanks to the quals are
+	 * not accounted for.
+	 */
+	run_cost += seq_page_cost * fdw_private->pages * fdw_private->columnFraction;
+
+	*startup_cost = baserel->baserestrictcost.startup;
+	cpu_per_tuple = cpu_tuple_cost + baserel->baserestrictcost.per_tuple;
+	run_cost += cpu_per_tuple * ntuples;
+	*total_cost = *startup_cost + run_cost;
+}
+
+/*
+ * column_acquire_sample_rows -- acquire a random sample of rows from the table
+ *
+ * Selected rows are returned in the caller-allocated array rows[],
+ * which must have at least targrows entries.
+ * The actual number of rows selected is returned as the function result.
+ * We also count the total number of rows in the file and return it into
+ * *totalrows.  Note that *totaldeadrows is always set to 0.
+ */
+static int
+column_acquire_sample_rows(Relation onerel, int elevel,
+						   HeapTuple *rows, int targrows,
+						   double *totalrows, double *totaldeadrows)
+{
+	int			numrows = 0;
+	double		rowstoskip = -1;	/* -1 means not set yet */
+	double		rstate;
+	TupleDesc	tupDesc;
+	Datum	   *values;
+	bool	   *nulls;
+	ColumnFdwOptions options;
+	ColumnReadState *reader;
+
+	Assert(onerel);
+	Assert(targrows > 0);
+
+	tupDesc = RelationGetDescr(onerel);
+	values = (Datum *) palloc(tupDesc->natts * sizeof(Datum));
+	nulls = (bool *) palloc(tupDesc->natts * sizeof(bool));
+
+	columnGetOptions(RelationGetRelid(onerel), &options);
+	reader = ColumnBeginRead(onerel, options.filename, all_columns(tupDesc),
+							 NIL);
+
+	/* Prepare for sampling rows */
+	rstate = anl_init_selection_state(targrows);
+
+	*totalrows = 0;
+	*totaldeadrows = 0;
+	for (;;)
+	{
+		/* Check for user-requested abort or sleep */
+		vacuum_delay_point();
+
+		if (!ColumnReadNextRow(reader, values, nulls))
+			break;
+
+		/*
+		 * The first targrows sample rows are simply copied into the
+		 * reservoir.  Then we start replacing tuples in the sample until we
+		 * reach the end of the relation. This algorithm is from Jeff Vitter's
+		 * paper (see more info in commands/analyze.c).
+		 */
+		if (numrows < targrows)
+		{
+			rows[numrows++] = heap_form_tuple(tupDesc, values, nulls);
+		}
+		else
+		{
+			/*
+			 * t in Vitter's paper is the number of records already processed.
+			 * If we need to compute a new S value, we must use the
+			 * not-yet-incremented value of totalrows as t.
+			 */
+			if (rowstoskip < 0)
+				rowstoskip = anl_get_next_S(*totalrows, targrows, &rstate);
+
+			if (rowstoskip <= 0)
+			{
+				/*
+				 * Found a suitable tuple, so save it, replacing one old tuple
+				 * at random
+				 */
+				int			k = (int) (targrows * anl_random_fract());
+
+				Assert(k >= 0 && k < targrows);
+				heap_freetuple(rows[k]);
+				rows[k] = heap_form_tuple(tupDesc, values, nulls);
+			}
+
+			rowstoskip -= 1;
+		}
+
+		*totalrows += 1;
+	}
+
+	ColumnEndRead(reader);
+
+	pfree(values);
+	pfree(nulls);
+
+	/*
+	 * Emit some interesting relation info
+	 */
+	ereport(elevel,
+			(errmsg("\"%s\": file contains %.0f rows; "
+					"%d rows in sample",
+					RelationGetRelationName(onerel),
+					*totalrows, numrows)));
+
+	return numrows;
+}
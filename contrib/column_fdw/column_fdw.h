@@ -0,0 +1,110 @@
+/*-------------------------------------------------------------------------
+ *
+ * column_fdw.h
+ *		  Foreign-data wrapper for column-oriented table files
+ *
+ * A column file starts with a ColumnFileHeader and is followed by any
+ * number of stripes, each appended as a whole by one writer.  A stripe holds
+ * up to stripe_rows rows.  It starts with a StripeHeader, followed by one
+ * ColumnChunkHeader per attribute and the serialized minimum and maximum
+ * value of each attribute, and then the data chunks of all attributes, one
+ * after the other.  Each data chunk contains the attribute's non-null values
+ * of the stripe, aligned as in a heap tuple, optionally followed by one
+ * null flag per row, and is optionally pglz-compressed.
+ *
+ * Readers use the per-stripe minimum and maximum to skip stripes which
+ * cannot satisfy simple restriction clauses, and read only the chunks of
+ * the attributes the query references.
+ *
+ * Portions Copyright (c) 2010-2013, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *		  contrib/column_fdw/column_fdw.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef COLUMN_FDW_H
+#define COLUMN_FDW_H
+
+#include "access/skey.h"
+#include "fmgr.h"
+#include "nodes/pg_list.h"
+#include "utils/rel.h"
+
+#define COLUMN_FILE_MAGIC		0x434F4C46		/* "COLF" */
+#define COLUMN_FILE_VERSION		1
+#define COLUMN_STRIPE_MAGIC		0x53545250		/* "STRP" */
+
+#define COLUMN_DEFAULT_STRIPE_ROWS	150000
+#define COLUMN_MAX_STRIPE_ROWS		10000000
+
+/*
+ * A stripe is flushed early once one of its chunks grows this large, so
+ * that reading it back never hits the palloc limit.
+ */
+#define COLUMN_MAX_CHUNK_SIZE		(MaxAllocSize / 4)
+
+typedef struct ColumnFileHeader
+{
+	uint32		magic;
+	uint32		version;
+} ColumnFileHeader;
+
+typedef struct StripeHeader
+{
+	uint32		magic;
+	uint32		natts;			/* number of ColumnChunkHeaders */
+	uint32		rowCount;		/* rows in this stripe */
+	uint32		headerLen;		/* StripeHeader, chunk headers, min/max */
+	uint64		dataLen;		/* total length of the data chunks */
+} StripeHeader;
+
+typedef struct ColumnChunkHeader
+{
+	Oid			typid;			/* InvalidOid for a dropped column */
+	uint32		nullCount;		/* if > 0, null flags follow the values */
+	uint64		offset;			/* start of chunk, relative to stripe data */
+	uint32		storedLen;		/* length of chunk as stored */
+	uint32		rawLen;			/* length of chunk once decompressed */
+	bool		compressed;
+	bool		hasMinMax;
+	uint32		minOffset;		/* relative to start of stripe header */
+	uint32		minLen;
+	uint32		maxOffset;
+	uint32		maxLen;
+} ColumnChunkHeader;
+
+/* fdw_private list of a column_fdw ForeignScan */
+enum ColumnFdwScanPrivateIndex
+{
+	/* Integer list of the attribute numbers to read */
+	ColumnScanPrivateColumns,
+	/* List of (Integer attnum, Integer strategy, Const) skip keys */
+	ColumnScanPrivateSkipKeys
+};
+
+/* Opaque state of a scan and of a load */
+typedef struct ColumnReadState ColumnReadState;
+typedef struct ColumnWriteState ColumnWriteState;
+
+/* in column_reader.c */
+extern ColumnReadState *ColumnBeginRead(Relation rel, const char *filename,
+				List *columns, List *skipKeys);
+extern bool ColumnReadNextRow(ColumnReadState *state,
+				  Datum *values, bool *nulls);
+extern void ColumnRescan(ColumnReadState *state);
+extern void ColumnEndRead(ColumnReadState *state);
+extern void ColumnReadStats(ColumnReadState *state,
+				uint64 *stripesRead, uint64 *stripesSkipped);
+extern off_t ColumnFileValidLength(int fd, const char *filename,
+					  off_t fileSize, double *rowCount);
+extern double ColumnCountRows(const char *filename);
+
+/* in column_writer.c */
+extern ColumnWriteState *ColumnBeginWrite(Relation rel, const char *filename,
+				 int stripeRows, bool compress);
+extern void ColumnWriteRow(ColumnWriteState *state,
+			   Datum *values, bool *nulls);
+extern void ColumnEndWrite(ColumnWriteState *state);
+
+#endif   /* COLUMN_FDW_H */
@@ -0,0 +1,589 @@
+/*-------------------------------------------------------------------------
+ *
+ * column_reader.c
+ *		  Read stripes of a column file, skipping what the scan can't use
+ *
+ * Portions Copyright (c) 2010-2013, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *		  contrib/column_fdw/column_reader.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "access/nbtree.h"
+#include "access/tupmacs.h"
+#include "column_fdw.h"
+#include "nodes/primnodes.h"
+#include "nodes/value.h"
+#include "storage/fd.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/pg_lzcompress.h"
+#include "utils/typcache.h"
+
+/*
+ * A restriction clause "column op constant", with op a member of the
+ * column type's default btree opfamily.
+ */
+typedef struct ColumnSkipKey
+{
+	AttrNumber	attnum;
+	StrategyNumber strategy;
+	Datum		argument;
+	Oid			collation;
+	FmgrInfo	cmp;			/* btree comparison of the column type with
+								 * the argument type */
+} ColumnSkipKey;
+
+struct ColumnReadState
+{
+	TupleDesc	tupdesc;
+	char	   *filename;
+	int			fd;				/* -1 if the file doesn't exist yet */
+	off_t		fileSize;		/* file length when the scan started */
+	off_t		nextStripe;		/* offset of the next stripe to look at */
+	bool	   *needed;			/* per attribute: read by the scan? */
+	int			nkeys;
+	ColumnSkipKey *keys;
+
+	/* current stripe, all allocated in stripeContext */
+	MemoryContext stripeContext;
+	uint32		stripeRows;
+	uint32		currentRow;
+	Datum	  **values;			/* per attribute, NULL if not loaded */
+	bool	  **nulls;
+
+	uint64		stripesRead;
+	uint64		stripesSkipped;
+};
+
+static void column_read_at(int fd, const char *filename, off_t offset,
+			   char *buf, Size len);
+static bool column_load_next_stripe(ColumnReadState *state);
+static bool column_stripe_matches(ColumnReadState *state,
+					  StripeHeader *stripe, char *header,
+					  ColumnChunkHeader *chunks);
+static void column_load_chunk(ColumnReadState *state, Form_pg_attribute att,
+				  off_t dataStart, ColumnChunkHeader *chunk,
+				  uint32 rowCount, Datum **values, bool **nulls);
+
+
+/*
+ * Read exactly len bytes at offset, or fail.
+ */
+static void
+column_read_at(int fd, const char *filename, off_t offset, char *buf, Size len)
+{
+	ssize_t		nread;
+
+	if (lseek(fd, offset, SEEK_SET) != offset)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek in column file \"%s\": %m",
+						filename)));
+
+	nread = read(fd, buf, len);
+	if (nread < 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read column file \"%s\": %m",
+						filename)));
+	if ((Size) nread != len)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg("unexpected end of column file \"%s\"", filename)));
+}
+
+/*
+ * Check the file header, then walk the stripe headers of an open column
+ * file.  Returns the end of the last complete stripe; anything beyond it is
+ * a stripe still being appended, or the remains of a load that failed.
+ * The number of rows in the complete stripes is returned in *rowCount.
+ */
+off_t
+ColumnFileValidLength(int fd, const char *filename, off_t fileSize,
+					  double *rowCount)
+{
+	ColumnFileHeader fileHeader;
+	off_t		offset;
+
+	*rowCount = 0;
+	if (fileSize < (off_t) sizeof(ColumnFileHeader))
+		return 0;
+
+	column_read_at(fd, filename, 0, (char *) &fileHeader, sizeof(fileHeader));
+	if (fileHeader.magic != COLUMN_FILE_MAGIC)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg("\"%s\" is not a column file", filename)));
+	if (fileHeader.version != COLUMN_FILE_VERSION)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg("column file \"%s\" has version %u, expected %u",
+						filename, fileHeader.version, COLUMN_FILE_VERSION)));
+
+	offset = sizeof(ColumnFileHeader);
+	while (offset + (off_t) sizeof(StripeHeader) <= fileSize)
+	{
+		StripeHeader stripe;
+
+		column_read_at(fd, filename, offset, (char *) &stripe, sizeof(stripe));
+		if (stripe.magic != COLUMN_STRIPE_MAGIC)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("invalid stripe header in column file \"%s\" at offset " INT64_FORMAT,
+							filename, (int64) offset)));
+		if (offset + stripe.headerLen + stripe.dataLen > fileSize)
+			break;
+		*rowCount += stripe.rowCount;
+		offset += stripe.headerLen + stripe.dataLen;
+	}
+
+	return offset;
+}
+
+/*
+ * Count the rows of a column file from its stripe headers.  A missing file
+ * is an empty table.
+ */
+double
+ColumnCountRows(const char *filename)
+{
+	int			fd;
+	off_t		fileSize;
+	double		rowCount;
+
+	fd = OpenTransientFile((char *) filename, O_RDONLY | PG_BINARY, 0);
+	if (fd < 0)
+	{
+		if (errno == ENOENT)
+			return 0;
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not open column file \"%s\": %m", filename)));
+	}
+
+	fileSize = lseek(fd, 0, SEEK_END);
+	if (fileSize < 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek in column file \"%s\": %m",
+						filename)));
+	(void) ColumnFileValidLength(fd, filename, fileSize, &rowCount);
+	CloseTransientFile(fd);
+
+	return rowCount;
+}
+
+/*
+ * Start reading a column file.
+ *
+ * columns is the integer list of attribute numbers the scan needs; only
+ * their chunks are read, the other attributes are returned as nulls.
+ * skipKeys holds (attnum, strategy, Const) triples as built by the planner;
+ * stripes whose minimum and maximum show that one of them fails for all
+ * rows are not read at all.
+ */
+ColumnReadState *
+ColumnBeginRead(Relation rel, const char *filename, List *columns,
+				List *skipKeys)
+{
+	ColumnReadState *state;
+	TupleDesc	tupdesc = RelationGetDescr(rel);
+	ListCell   *lc;
+
+	state = (ColumnReadState *) palloc0(sizeof(ColumnReadState));
+	state->tupdesc = tupdesc;
+	state->filename = pstrdup(filename);
+	state->nextStripe = sizeof(ColumnFileHeader);
+
+	state->fd = OpenTransientFile(state->filename, O_RDONLY | PG_BINARY, 0);
+	if (state->fd < 0)
+	{
+		if (errno != ENOENT)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not open column file \"%s\": %m",
+							filename)));
+		/* nothing has been loaded yet */
+		state->fileSize = 0;
+	}
+	else
+	{
+		state->fileSize = lseek(state->fd, 0, SEEK_END);
+		if (state->fileSize < 0)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not seek in column file \"%s\": %m",
+							filename)));
+		if (state->fileSize >= (off_t) sizeof(ColumnFileHeader))
+		{
+			ColumnFileHeader fileHeader;
+
+			column_read_at(state->fd, filename, 0, (char *) &fileHeader,
+						   sizeof(fileHeader));
+			if (fileHeader.magic != COLUMN_FILE_MAGIC ||
+				fileHeader.version != COLUMN_FILE_VERSION)
+				ereport(ERROR,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg("\"%s\" is not a column file of version %u",
+								filename, COLUMN_FILE_VERSION)));
+		}
+	}
+
+	state->needed = (bool *) palloc0(tupdesc->natts * sizeof(bool));
+	foreach(lc, columns)
+	{
+		AttrNumber	attnum = (AttrNumber) intVal(lfirst(lc));
+
+		Assert(attnum > 0 && attnum <= tupdesc->natts);
+		state->needed[attnum - 1] = true;
+	}
+
+	state->keys = (ColumnSkipKey *)
+		palloc(Max(list_length(skipKeys), 1) * sizeof(ColumnSkipKey));
+	foreach(lc, skipKeys)
+	{
+		List	   *triple = (List *) lfirst(lc);
+		AttrNumber	attnum = (AttrNumber) intVal(linitial(triple));
+		Const	   *argument = (Const *) lthird(triple);
+		Form_pg_attribute att = tupdesc->attrs[attnum - 1];
+		TypeCacheEntry *typentry;
+		ColumnSkipKey *key;
+		Oid			cmpproc;
+
+		/* compare the stored minimum and maximum to the argument */
+		typentry = lookup_type_cache(att->atttypid, TYPECACHE_BTREE_OPFAMILY);
+		if (!OidIsValid(typentry->btree_opf))
+			continue;
+		cmpproc = get_opfamily_proc(typentry->btree_opf,
+									typentry->btree_opintype,
+									argument->consttype,
+									BTORDER_PROC);
+		if (!OidIsValid(cmpproc))
+			continue;
+
+		key = &state->keys[state->nkeys++];
+		key->attnum = attnum;
+		key->strategy = (StrategyNumber) intVal(lsecond(triple));
+		key->argument = argument->constvalue;
+		key->collation = att->attcollation;
+		fmgr_info(cmpproc, &key->cmp);
+	}
+
+	state->stripeContext = AllocSetContextCreate(CurrentMemoryContext,
+												 "column_fdw stripe",
+												 ALLOCSET_DEFAULT_MINSIZE,
+												 ALLOCSET_DEFAULT_INITSIZE,
+												 ALLOCSET_DEFAULT_MAXSIZE);
+	state->values = (Datum **) palloc0(tupdesc->natts * sizeof(Datum *));
+	state->nulls = (bool **) palloc0(tupdesc->natts * sizeof(bool *));
+
+	return state;
+}
+
+/*
+ * Return the next row of the scan in values/nulls, or false at the end.
+ */
+bool
+ColumnReadNextRow(ColumnReadState *state, Datum *values, bool *nulls)
+{
+	uint32		row;
+	int			i;
+
+	while (state->currentRow >= state->stripeRows)
+	{
+		if (!column_load_next_stripe(state))
+			return false;
+	}
+
+	row = state->currentRow++;
+	for (i = 0; i < state->tupdesc->natts; i++)
+	{
+		if (state->values[i] != NULL)
+		{
+			values[i] = state->values[i][row];
+			nulls[i] = state->nulls[i][row];
+		}
+		else
+		{
+			values[i] = (Datum) 0;
+			nulls[i] = true;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Restart the scan from the first stripe.  Stripes appended since the scan
+ * started stay invisible to it.
+ */
+void
+ColumnRescan(ColumnReadState *state)
+{
+	MemoryContextReset(state->stripeContext);
+	MemSet(state->values, 0, state->tupdesc->natts * sizeof(Datum *));
+	MemSet(state->nulls, 0, state->tupdesc->natts * sizeof(bool *));
+	state->stripeRows = 0;
+	state->currentRow = 0;
+	state->nextStripe = sizeof(ColumnFileHeader);
+}
+
+void
+ColumnEndRead(ColumnReadState *state)
+{
+	if (state->fd >= 0)
+		CloseTransientFile(state->fd);
+	MemoryContextDelete(state->stripeContext);
+}
+
+void
+ColumnReadStats(ColumnReadState *state, uint64 *stripesRead,
+				uint64 *stripesSkipped)
+{
+	*stripesRead = state->stripesRead;
+	*stripesSkipped = state->stripesSkipped;
+}
+
+/*
+ * Advance to the next stripe which the skip keys can't rule out and load
+ * the chunks of the needed attributes.  Returns false at the end of the
+ * file.
+ */
+static bool
+column_load_next_stripe(ColumnReadState *state)
+{
+	TupleDesc	tupdesc = state->tupdesc;
+
+	for (;;)
+	{
+		off_t		offset = state->nextStripe;
+		StripeHeader stripe;
+		char	   *header;
+		ColumnChunkHeader *chunks;
+		MemoryContext oldcxt;
+		int			i;
+
+		MemoryContextReset(state->stripeContext);
+		MemSet(state->values, 0, tupdesc->natts * sizeof(Datum *));
+		MemSet(state->nulls, 0, tupdesc->natts * sizeof(bool *));
+		state->stripeRows = 0;
+		state->currentRow = 0;
+
+		if (state->fd < 0 ||
+			offset + (off_t) sizeof(StripeHeader) > state->fileSize)
+			return false;
+
+		column_read_at(state->fd, state->filename, offset,
+					   (char *) &stripe, sizeof(stripe));
+		if (stripe.magic != COLUMN_STRIPE_MAGIC ||
+			stripe.headerLen < sizeof(StripeHeader) +
+			stripe.natts * sizeof(ColumnChunkHeader))
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("invalid stripe header in column file \"%s\" at offset " INT64_FORMAT,
+							state->filename, (int64) offset)));
+
+		/* a stripe still being appended, or left over by a failed load */
+		if (offset + stripe.headerLen + stripe.dataLen > state->fileSize)
+			return false;
+		state->nextStripe = offset + stripe.headerLen + stripe.dataLen;
+
+		oldcxt = MemoryContextSwitchTo(state->stripeContext);
+
+		header = palloc(stripe.headerLen);
+		column_read_at(state->fd, state->filename, offset, header,
+					   stripe.headerLen);
+		chunks = (ColumnChunkHeader *) (header + sizeof(StripeHeader));
+
+		for (i = 0; i < tupdesc->natts && i < stripe.natts; i++)
+		{
+			Form_pg_attribute att = tupdesc->attrs[i];
+
+			if (att->attisdropped || !OidIsValid(chunks[i].typid))
+				continue;
+			if (chunks[i].typid != att->atttypid)
+				ereport(ERROR,
+						(errcode(ERRCODE_DATATYPE_MISMATCH),
+						 errmsg("column \"%s\" of column file \"%s\" was stored with type %u, not %u",
+								NameStr(att->attname), state->filename,
+								chunks[i].typid, att->atttypid)));
+		}
+
+		if (!column_stripe_matches(state, &stripe, header, chunks))
+		{
+			state->stripesSkipped++;
+			MemoryContextSwitchTo(oldcxt);
+			continue;
+		}
+		state->stripesRead++;
+
+		for (i = 0; i < tupdesc->natts && i < stripe.natts; i++)
+		{
+			Form_pg_attribute att = tupdesc->attrs[i];
+
+			/* attributes added after the stripe was written stay null */
+			if (!state->needed[i] || att->attisdropped ||
+				!OidIsValid(chunks[i].typid))
+				continue;
+			column_load_chunk(state, att, offset + stripe.headerLen,
+							  &chunks[i], stripe.rowCount,
+							  &state->values[i], &state->nulls[i]);
+		}
+		state->stripeRows = stripe.rowCount;
+
+		MemoryContextSwitchTo(oldcxt);
+		return true;
+	}
+}
+
+/*
+ * Can any row of the stripe satisfy all the skip keys?
+ */
+static bool
+column_stripe_matches(ColumnReadState *state, StripeHeader *stripe,
+					  char *header, ColumnChunkHeader *chunks)
+{
+	int			i;
+
+	for (i = 0; i < state->nkeys; i++)
+	{
+		ColumnSkipKey *key = &state->keys[i];
+		Form_pg_attribute att = state->tupdesc->attrs[key->attnum - 1];
+		ColumnChunkHeader *chunk;
+		Datum		min;
+		Datum		max;
+		int32		cmpmin;
+		int32		cmpmax;
+
+		/*
+		 * btree operators are strict, so a stripe in which the column is all
+		 * nulls has no matching row.
+		 */
+		if (key->attnum > stripe->natts)
+			return false;
+		chunk = &chunks[key->attnum - 1];
+		if (chunk->nullCount == stripe->rowCount)
+			return false;
+		if (!chunk->hasMinMax)
+			continue;
+
+		min = fetchatt(att, header + chunk->minOffset);
+		max = fetchatt(att, header + chunk->maxOffset);
+		cmpmin = DatumGetInt32(FunctionCall2Coll(&key->cmp, key->collation,
+												 min, key->argument));
+		cmpmax = DatumGetInt32(FunctionCall2Coll(&key->cmp, key->collation,
+												 max, key->argument));
+
+		switch (key->strategy)
+		{
+			case BTLessStrategyNumber:
+				if (cmpmin >= 0)
+					return false;
+				break;
+			case BTLessEqualStrategyNumber:
+				if (cmpmin > 0)
+					return false;
+				break;
+			case BTEqualStrategyNumber:
+				if (cmpmin > 0 || cmpmax < 0)
+					return false;
+				break;
+			case BTGreaterEqualStrategyNumber:
+				if (cmpmax < 0)
+					return false;
+				break;
+			case BTGreaterStrategyNumber:
+				if (cmpmax <= 0)
+					return false;
+				break;
+			default:
+				elog(ERROR, "invalid skip key strategy %d", key->strategy);
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Read and decode the chunk of one attribute into per-row arrays, allocated
+ * in the current (stripe) memory context.  The datums point into the
+ * decompressed chunk.
+ */
+static void
+column_load_chunk(ColumnReadState *state, Form_pg_attribute att,
+				  off_t dataStart, ColumnChunkHeader *chunk,
+				  uint32 rowCount, Datum **values, bool **nulls)
+{
+	Datum	   *vals;
+	bool	   *isnull;
+	char	   *raw;
+	char	   *flags;
+	Size		dataLen;
+	Size		off;
+	uint32		row;
+
+	vals = (Datum *) palloc(rowCount * sizeof(Datum));
+	isnull = (bool *) palloc(rowCount * sizeof(bool));
+	*values = vals;
+	*nulls = isnull;
+
+	if (chunk->nullCount == rowCount)
+	{
+		MemSet(vals, 0, rowCount * sizeof(Datum));
+		MemSet(isnull, true, rowCount * sizeof(bool));
+		return;
+	}
+
+	raw = palloc(chunk->storedLen);
+	column_read_at(state->fd, state->filename, dataStart + chunk->offset,
+				   raw, chunk->storedLen);
+	if (chunk->compressed)
+	{
+		PGLZ_Header *compressed = (PGLZ_Header *) raw;
+
+		if (PGLZ_RAW_SIZE(compressed) != chunk->rawLen)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("compressed chunk of column \"%s\" in column file \"%s\" is corrupted",
+							NameStr(att->attname), state->filename)));
+		raw = palloc(chunk->rawLen);
+		pglz_decompress(compressed, raw);
+		pfree(compressed);
+	}
+
+	dataLen = chunk->rawLen;
+	flags = NULL;
+	if (chunk->nullCount > 0)
+	{
+		dataLen -= rowCount;
+		flags = raw + dataLen;
+	}
+
+	off = 0;
+	for (row = 0; row < rowCount; row++)
+	{
+		if (flags != NULL && flags[row])
+		{
+			vals[row] = (Datum) 0;
+			isnull[row] = true;
+			continue;
+		}
+
+		off = att_align_nominal(off, att->attalign);
+		if (off >= dataLen)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("chunk of column \"%s\" in column file \"%s\" is too short",
+							NameStr(att->attname), state->filename)));
+		vals[row] = fetchatt(att, raw + off);
+		isnull[row] = false;
+		off = att_addlength_pointer(off, att->attlen, raw + off);
+	}
+}
@@ -0,0 +1,426 @@
+/*-------------------------------------------------------------------------
+ *
+ * column_writer.c
+ *		  Buffer loaded rows column by column and append them as stripes
+ *
+ * Portions Copyright (c) 2010-2013, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *		  contrib/column_fdw/column_writer.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "access/tupmacs.h"
+#include "column_fdw.h"
+#include "lib/stringinfo.h"
+#include "storage/fd.h"
+#include "utils/datum.h"
+#include "utils/memutils.h"
+#include "utils/pg_lzcompress.h"
+#include "utils/typcache.h"
+
+/* Per-attribute state of the stripe being built */
+typedef struct ColumnBuildState
+{
+	StringInfoData data;		/* aligned non-null values */
+	StringInfoData nullFlags;	/* one byte per row */
+	uint32		nullCount;
+	bool		haveCmp;		/* can we keep a minimum and maximum? */
+	FmgrInfo	cmp;
+	bool		hasMinMax;
+	Datum		min;
+	Datum		max;
+} ColumnBuildState;
+
+struct ColumnWriteState
+{
+	TupleDesc	tupdesc;
+	char	   *filename;
+	int			fd;
+	off_t		fileEnd;		/* where the next stripe goes */
+	int			stripeRows;
+	bool		compress;
+	MemoryContext stripeContext;	/* everything about the current stripe */
+	MemoryContext rowContext;	/* detoasting and comparisons of one row */
+	uint32		rowCount;
+	ColumnBuildState *columns;
+};
+
+static void column_reset_stripe(ColumnWriteState *state);
+static void column_flush_stripe(ColumnWriteState *state);
+static void column_write_at(ColumnWriteState *state, off_t offset,
+				char *buf, Size len);
+static int column_append_datum(StringInfo buf, Form_pg_attribute att,
+					Datum value);
+
+
+/*
+ * Open a column file for appending, creating it if needed.  Whatever
+ * follows the last complete stripe was left by a load that failed, and is
+ * cut off.
+ *
+ * The caller must make sure no one else appends to the file meanwhile.
+ */
+ColumnWriteState *
+ColumnBeginWrite(Relation rel, const char *filename, int stripeRows,
+				 bool compress)
+{
+	ColumnWriteState *state;
+	TupleDesc	tupdesc = RelationGetDescr(rel);
+	off_t		fileSize;
+	int			i;
+
+	state = (ColumnWriteState *) palloc0(sizeof(ColumnWriteState));
+	state->tupdesc = tupdesc;
+	state->filename = pstrdup(filename);
+	state->stripeRows = stripeRows;
+	state->compress = compress;
+
+	state->fd = OpenTransientFile(state->filename,
+								  O_RDWR | O_CREAT | PG_BINARY,
+								  S_IRUSR | S_IWUSR);
+	if (state->fd < 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not open column file \"%s\": %m", filename)));
+
+	fileSize = lseek(state->fd, 0, SEEK_END);
+	if (fileSize < 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek in column file \"%s\": %m",
+						filename)));
+
+	if (fileSize < (off_t) sizeof(ColumnFileHeader))
+	{
+		ColumnFileHeader fileHeader;
+
+		fileHeader.magic = COLUMN_FILE_MAGIC;
+		fileHeader.version = COLUMN_FILE_VERSION;
+		column_write_at(state, 0, (char *) &fileHeader, sizeof(fileHeader));
+		state->fileEnd = sizeof(fileHeader);
+	}
+	else
+	{
+		double		rowCount;
+
+		state->fileEnd = ColumnFileValidLength(state->fd, state->filename,
+											   fileSize, &rowCount);
+		if (state->fileEnd < fileSize &&
+			ftruncate(state->fd, state->fileEnd) < 0)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not truncate column file \"%s\": %m",
+							filename)));
+	}
+
+	state->stripeContext = AllocSetContextCreate(CurrentMemoryContext,
+												 "column_fdw stripe",
+												 ALLOCSET_DEFAULT_MINSIZE,
+												 ALLOCSET_DEFAULT_INITSIZE,
+												 ALLOCSET_DEFAULT_MAXSIZE);
+	state->rowContext = AllocSetContextCreate(CurrentMemoryContext,
+											  "column_fdw row",
+											  ALLOCSET_SMALL_MINSIZE,
+											  ALLOCSET_SMALL_INITSIZE,
+											  ALLOCSET_SMALL_MAXSIZE);
+
+	state->columns = (ColumnBuildState *)
+		palloc0(tupdesc->natts * sizeof(ColumnBuildState));
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute att = tupdesc->attrs[i];
+		ColumnBuildState *col = &state->columns[i];
+		TypeCacheEntry *typentry;
+
+		if (att->attisdropped)
+			continue;
+
+		typentry = lookup_type_cache(att->atttypid, TYPECACHE_CMP_PROC_FINFO);
+		if (OidIsValid(typentry->cmp_proc_finfo.fn_oid))
+		{
+			col->haveCmp = true;
+			fmgr_info_copy(&col->cmp, &typentry->cmp_proc_finfo,
+						   CurrentMemoryContext);
+		}
+	}
+
+	column_reset_stripe(state);
+
+	return state;
+}
+
+/*
+ * Add one row to the stripe being built, flushing it once it is full.
+ */
+void
+ColumnWriteRow(ColumnWriteState *state, Datum *values, bool *nulls)
+{
+	TupleDesc	tupdesc = state->tupdesc;
+	MemoryContext oldcxt;
+	bool		full = false;
+	int			i;
+
+	oldcxt = MemoryContextSwitchTo(state->rowContext);
+
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute att = tupdesc->attrs[i];
+		ColumnBuildState *col = &state->columns[i];
+		Datum		value;
+
+		if (att->attisdropped || nulls[i])
+		{
+			appendStringInfoChar(&col->nullFlags, 1);
+			col->nullCount++;
+			continue;
+		}
+
+		/* store varlenas untoasted, with a 4-byte header */
+		value = values[i];
+		if (att->attlen == -1)
+			value = PointerGetDatum(PG_DETOAST_DATUM(value));
+
+		(void) column_append_datum(&col->data, att, value);
+		appendStringInfoChar(&col->nullFlags, 0);
+		if (col->data.len >= COLUMN_MAX_CHUNK_SIZE)
+			full = true;
+
+		if (!col->haveCmp)
+			continue;
+
+		if (!col->hasMinMax)
+		{
+			MemoryContextSwitchTo(state->stripeContext);
+			col->min = datumCopy(value, att->attbyval, att->attlen);
+			col->max = datumCopy(value, att->attbyval, att->attlen);
+			MemoryContextSwitchTo(state->rowContext);
+			col->hasMinMax = true;
+		}
+		else if (DatumGetInt32(FunctionCall2Coll(&col->cmp, att->attcollation,
+												 value, col->min)) < 0)
+		{
+			if (!att->attbyval)
+				pfree(DatumGetPointer(col->min));
+			MemoryContextSwitchTo(state->stripeContext);
+			col->min = datumCopy(value, att->attbyval, att->attlen);
+			MemoryContextSwitchTo(state->rowContext);
+		}
+		else if (DatumGetInt32(FunctionCall2Coll(&col->cmp, att->attcollation,
+												 value, col->max)) > 0)
+		{
+			if (!att->attbyval)
+				pfree(DatumGetPointer(col->max));
+			MemoryContextSwitchTo(state->stripeContext);
+			col->max = datumCopy(value, att->attbyval, att->attlen);
+			MemoryContextSwitchTo(state->rowContext);
+		}
+	}
+
+	MemoryContextSwitchTo(oldcxt);
+	MemoryContextReset(state->rowContext);
+
+	state->rowCount++;
+	if (full || state->rowCount >= (uint32) state->stripeRows)
+		column_flush_stripe(state);
+}
+
+/*
+ * Flush the last stripe and make the file durable.
+ */
+void
+ColumnEndWrite(ColumnWriteState *state)
+{
+	column_flush_stripe(state);
+
+	if (pg_fsync(state->fd) != 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not fsync column file \"%s\": %m",
+						state->filename)));
+	CloseTransientFile(state->fd);
+
+	MemoryContextDelete(state->stripeContext);
+	MemoryContextDelete(state->rowContext);
+}
+
+static void
+column_reset_stripe(ColumnWriteState *state)
+{
+	MemoryContext oldcxt;
+	int			i;
+
+	MemoryContextReset(state->stripeContext);
+	oldcxt = MemoryContextSwitchTo(state->stripeContext);
+
+	for (i = 0; i < state->tupdesc->natts; i++)
+	{
+		ColumnBuildState *col = &state->columns[i];
+
+		initStringInfo(&col->data);
+		initStringInfo(&col->nullFlags);
+		col->nullCount = 0;
+		col->hasMinMax = false;
+	}
+	state->rowCount = 0;
+
+	MemoryContextSwitchTo(oldcxt);
+}
+
+/*
+ * Write out the stripe being built, then start an empty one.
+ */
+static void
+column_flush_stripe(ColumnWriteState *state)
+{
+	TupleDesc	tupdesc = state->tupdesc;
+	int			natts = tupdesc->natts;
+	StripeHeader stripe;
+	ColumnChunkHeader *chunks;
+	char	  **chunkData;
+	StringInfoData header;
+	MemoryContext oldcxt;
+	uint64		dataLen = 0;
+	off_t		offset;
+	int			i;
+
+	if (state->rowCount == 0)
+		return;
+
+	oldcxt = MemoryContextSwitchTo(state->stripeContext);
+
+	chunks = (ColumnChunkHeader *) palloc0(natts * sizeof(ColumnChunkHeader));
+	chunkData = (char **) palloc0(natts * sizeof(char *));
+
+	/* the fixed part of the header is filled in at the end */
+	initStringInfo(&header);
+	enlargeStringInfo(&header, sizeof(StripeHeader) +
+					  natts * sizeof(ColumnChunkHeader));
+	header.len = sizeof(StripeHeader) + natts * sizeof(ColumnChunkHeader);
+
+	for (i = 0; i < natts; i++)
+	{
+		Form_pg_attribute att = tupdesc->attrs[i];
+		ColumnBuildState *col = &state->columns[i];
+		ColumnChunkHeader *chunk = &chunks[i];
+
+		chunk->typid = att->attisdropped ? InvalidOid : att->atttypid;
+		chunk->nullCount = col->nullCount;
+		chunk->offset = dataLen;
+
+		/* an all-null chunk takes no space at all */
+		if (col->nullCount == state->rowCount)
+			continue;
+
+		if (col->nullCount > 0)
+			appendBinaryStringInfo(&col->data, col->nullFlags.data,
+								   col->nullFlags.len);
+		chunk->rawLen = col->data.len;
+		chunk->storedLen = col->data.len;
+		chunkData[i] = col->data.data;
+
+		if (state->compress)
+		{
+			PGLZ_Header *compressed;
+
+			compressed = (PGLZ_Header *) palloc(PGLZ_MAX_OUTPUT(chunk->rawLen));
+			if (pglz_compress(col->data.data, chunk->rawLen, compressed,
+							  PGLZ_strategy_default))
+			{
+				chunk->compressed = true;
+				chunk->storedLen = VARSIZE(compressed);
+				chunkData[i] = (char *) compressed;
+			}
+			else
+				pfree(compressed);
+		}
+		dataLen += chunk->storedLen;
+
+		if (col->hasMinMax)
+		{
+			chunk->hasMinMax = true;
+			chunk->minOffset = column_append_datum(&header, att, col->min);
+			chunk->minLen = header.len - chunk->minOffset;
+			chunk->maxOffset = column_append_datum(&header, att, col->max);
+			chunk->maxLen = header.len - chunk->maxOffset;
+		}
+	}
+
+	stripe.magic = COLUMN_STRIPE_MAGIC;
+	stripe.natts = natts;
+	stripe.rowCount = state->rowCount;
+	stripe.headerLen = header.len;
+	stripe.dataLen = dataLen;
+	memcpy(header.data, &stripe, sizeof(StripeHeader));
+	memcpy(header.data + sizeof(StripeHeader), chunks,
+		   natts * sizeof(ColumnChunkHeader));
+
+	/*
+	 * Readers ignore a stripe until all of it is in the file, so if we fail
+	 * halfway the partial stripe is simply overwritten by the next load.
+	 */
+	offset = state->fileEnd;
+	column_write_at(state, offset, header.data, header.len);
+	offset += header.len;
+	for (i = 0; i < natts; i++)
+	{
+		if (chunkData[i] == NULL)
+			continue;
+		column_write_at(state, offset, chunkData[i], chunks[i].storedLen);
+		offset += chunks[i].storedLen;
+	}
+	state->fileEnd = offset;
+
+	MemoryContextSwitchTo(oldcxt);
+	column_reset_stripe(state);
+}
+
+static void
+column_write_at(ColumnWriteState *state, off_t offset, char *buf, Size len)
+{
+	if (lseek(state->fd, offset, SEEK_SET) != offset)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek in column file \"%s\": %m",
+						state->filename)));
+
+	errno = 0;
+	if ((Size) write(state->fd, buf, len) != len)
+	{
+		/* if write didn't set errno, assume problem is no disk space */
+		if (errno == 0)
+			errno = ENOSPC;
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not write column file \"%s\": %m",
+						state->filename)));
+	}
+}
+
+/*
+ * Append a datum to buf, aligned relative to the start of the buffer as it
+ * would be in a heap tuple, and return its offset.
+ */
+static int
+column_append_datum(StringInfo buf, Form_pg_attribute att, Datum value)
+{
+	int			start = att_align_nominal(buf->len, att->attalign);
+	Size		len = att_addlength_datum(0, att->attlen, value);
+
+	enlargeStringInfo(buf, (start - buf->len) + len);
+	MemSet(buf->data + buf->len, 0, start - buf->len);
+	if (att->attbyval)
+		store_att_byval(buf->data + start, value, att->attlen);
+	else
+		memcpy(buf->data + start, DatumGetPointer(value), len);
+	buf->len = start + len;
+	buf->data[buf->len] = '\0';
+
+	return start;
+}
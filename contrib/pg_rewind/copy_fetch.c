@@ -522,15 +522,28 @@ execute_pagemap(datapagemap_t *pagemap, const char *path)
 {
 	datapagemap_iterator_t *iter;
 	BlockNumber blkno;
+	off_t		range_begin = 0;
+	off_t		range_end = 0;
 
+	/* copy runs of adjacent blocks as one range */
 	iter = datapagemap_iterate(pagemap);
 	while (datapagemap_next(iter, &blkno))
 	{
 		off_t offset = blkno * BLCKSZ;
 
-		copy_file_range(path, offset, offset + BLCKSZ, false);
-		/* Ok, this block has now been copied from new data dir to old */
+		if (range_end > range_begin && offset == range_end)
+		{
+			range_end += BLCKSZ;
+			continue;
+		}
+
+		if (range_end > range_begin)
+			copy_file_range(path, range_begin, range_end, false);
+		range_begin = offset;
+		range_end = offset + BLCKSZ;
 	}
+	if (range_end > range_begin)
+		copy_file_range(path, range_begin, range_end, false);
 	free(iter);
 }
 
@@ -19,6 +19,10 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#ifdef HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
+
 #include <libpq-fe.h>
 
 #include "pg_rewind.h"
@@ -30,8 +34,15 @@ static PGconn *conn = NULL;
 
 #define CHUNKSIZE 1000000
 
-static void receiveFileChunks(const char *sql);
-static void execute_pagemap(datapagemap_t *pagemap, const char *path);
+static PGconn *connectFetchConn(void);
+static void sendChunkListStart(PGconn *fetchconn);
+static void sendChunkListEnd(PGconn *fetchconn);
+static void receiveFileChunks(PGconn **conns, int nconns, const char *sql);
+static void processFileChunk(PGresult *res);
+static uint64 copy_file_range(PGconn *fetchconn, const char *path,
+				unsigned int begin, unsigned int end);
+static uint64 execute_pagemap(PGconn *fetchconn, datapagemap_t *pagemap,
+				const char *path);
 static void execute_query_or_die(const char *fmt,...)
 __attribute__((format(PG_PRINTF_ATTRIBUTE, 1, 2)));
 static char *run_simple_query(const char *sql);
@@ -196,6 +207,41 @@ libpqConnect(const char *connstr)
 	PQclear(res);
 }
 
+/*
+ * Open one more connection to the source server, to fetch file chunks in
+ * parallel with the main one.  The checks of libpqConnect have been done
+ * on the main connection already.
+ */
+static PGconn *
+connectFetchConn(void)
+{
+	PGconn	   *fetchconn;
+	PGresult   *res;
+
+	fetchconn = PQconnectdb(connstr_source);
+	if (PQstatus(fetchconn) == CONNECTION_BAD)
+	{
+		fprintf(stderr, "could not connect to remote server: %s\n",
+				PQerrorMessage(fetchconn));
+		exit(1);
+	}
+
+	res = PQexec(fetchconn,
+#ifdef ADB
+				 "SET xc_maintenance_mode = on; "
+#endif
+				 "SET synchronous_commit = off");
+	if (PQresultStatus(res) != PGRES_COMMAND_OK)
+	{
+		fprintf(stderr, "could not set up connection context: %s",
+				PQresultErrorMessage(res));
+		exit(1);
+	}
+	PQclear(res);
+
+	return fetchconn;
+}
+
 /*
  * Runs a query that returns a single value.
  * The result should be pg_free'd after use.
@@ -346,9 +392,11 @@ libpqProcessFileList(void)
 }
 
 /*
- * Runs a query, which returns pieces of files from the remote source data
- * directory, and overwrites the corresponding parts of target files with
- * the received parts. The result set is expected to be of format:
+ * Runs a query on each of the connections, which returns pieces of files
+ * from the remote source data directory, and overwrites the corresponding
+ * parts of target files with the received parts.  The chunks are written
+ * in the order they arrive from whichever connection.  The result set is
+ * expected to be of format:
  *
  * path		text	-- path in the data directory, e.g "base/1/123"
  * begin	int4	-- offset within the file
@@ -356,114 +404,189 @@ libpqProcessFileList(void)
  *
  */
 static void
-receiveFileChunks(const char *sql)
+receiveFileChunks(PGconn **conns, int nconns, const char *sql)
 {
-	PGresult   *res;
-
-	if (PQsendQueryParams(conn, sql, 0, NULL, NULL, NULL, NULL, 1) != 1)
-	{
-		fprintf(stderr, "could not send query: %s\n", PQerrorMessage(conn));
-		exit(1);
-	}
+	bool	   *active;
+	int			nactive = nconns;
+	int			i;
 
 	if (verbose)
 		fprintf(stderr, "getting chunks: %s\n", sql);
 
-	if (PQsetSingleRowMode(conn) != 1)
+	for (i = 0; i < nconns; i++)
 	{
-		fprintf(stderr, "could not set libpq connection to single row mode\n");
-		exit(1);
+		if (PQsendQueryParams(conns[i], sql, 0, NULL, NULL, NULL, NULL, 1) != 1)
+		{
+			fprintf(stderr, "could not send query: %s\n", PQerrorMessage(conns[i]));
+			exit(1);
+		}
+
+		if (PQsetSingleRowMode(conns[i]) != 1)
+		{
+			fprintf(stderr, "could not set libpq connection to single row mode\n");
+			exit(1);
+		}
 	}
 
 	if (verbose)
 		fprintf(stderr, "sent query\n");
 
-	while ((res = PQgetResult(conn)) != NULL)
+	active = pg_malloc(nconns * sizeof(bool));
+	for (i = 0; i < nconns; i++)
+		active[i] = true;
+
+	while (nactive > 0)
 	{
-		char   *filename;
-		int		filenamelen;
-		int		chunkoff;
-		int		chunksize;
-		char   *chunk;
+		fd_set		input_mask;
+		int			maxsock = -1;
 
-		switch(PQresultStatus(res))
+		/* Process whatever chunks have arrived, without blocking */
+		for (i = 0; i < nconns; i++)
 		{
-			case PGRES_SINGLE_TUPLE:
-				break;
-
-			case PGRES_TUPLES_OK:
-				PQclear(res);
-				continue; /* final zero-row result */
-			default:
-				fprintf(stderr, "unexpected result while fetching remote files: %s\n",
-						PQresultErrorMessage(res));
-				exit(1);
+			while (active[i] && !PQisBusy(conns[i]))
+			{
+				PGresult   *res = PQgetResult(conns[i]);
+
+				if (res == NULL)
+				{
+					active[i] = false;
+					nactive--;
+				}
+				else
+					processFileChunk(res);
+			}
 		}
 
-		/* sanity check the result set */
-		if (!(PQnfields(res) == 3 && PQntuples(res) == 1))
-		{
-			fprintf(stderr, "unexpected result set size while fetching remote files\n");
-			exit(1);
-		}
+		if (nactive == 0)
+			break;
 
-		if (!(PQftype(res, 0) == TEXTOID && PQftype(res, 1) == INT4OID && PQftype(res, 2) == BYTEAOID))
-		{
-			fprintf(stderr, "unexpected data types in result set while fetching remote files: %u %u %u\n", PQftype(res, 0), PQftype(res, 1), PQftype(res, 2));
-			exit(1);
-		}
-		if (!(PQfformat(res, 0) == 1 && PQfformat(res, 1) == 1 && PQfformat(res, 2) == 1))
+		/* Wait for more data on any of the connections still at work */
+		FD_ZERO(&input_mask);
+		for (i = 0; i < nconns; i++)
 		{
-			fprintf(stderr, "unexpected result format while fetching remote files\n");
-			exit(1);
+			int			sock;
+
+			if (!active[i])
+				continue;
+			sock = PQsocket(conns[i]);
+			FD_SET(sock, &input_mask);
+			if (sock > maxsock)
+				maxsock = sock;
 		}
 
-		if (!(!PQgetisnull(res, 0, 0) &&
-			  !PQgetisnull(res, 0, 1) &&
-			  PQgetlength(res, 0, 1) == sizeof(int32)))
+		if (select(maxsock + 1, &input_mask, NULL, NULL, NULL) < 0)
 		{
-			fprintf(stderr, "unexpected result set while fetching remote files\n");
+			if (errno == EINTR)
+				continue;
+			fprintf(stderr, "select() failed: %s\n", strerror(errno));
 			exit(1);
 		}
 
-		filenamelen = PQgetlength(res, 0, 0);
-		filename = pg_malloc(filenamelen + 1);
-		memcpy(filename, PQgetvalue(res, 0, 0), filenamelen);
-		filename[filenamelen] = '\0';
-
-		/*
-		 * It's possible that the file was deleted on remote side after we
-		 * created the file map. In this case simply ignore it, as if it was
-		 * not there in the first place, and move on.
-		 */
-		if (PQgetisnull(res, 0, 2))
+		for (i = 0; i < nconns; i++)
 		{
-			fprintf(stderr,
-				"received NULL chunk for file \"%s\", file has been deleted\n",
-				filename);
-			pg_free(filename);
-			PQclear(res);
-			continue;
+			if (active[i] && FD_ISSET(PQsocket(conns[i]), &input_mask) &&
+				PQconsumeInput(conns[i]) != 1)
+			{
+				fprintf(stderr, "could not receive data from remote server: %s\n",
+						PQerrorMessage(conns[i]));
+				exit(1);
+			}
 		}
+	}
+
+	pg_free(active);
+}
+
+/*
+ * Write one piece of file returned by the query of receiveFileChunks to the
+ * target, and free the result.
+ */
+static void
+processFileChunk(PGresult *res)
+{
+	char   *filename;
+	int		filenamelen;
+	int		chunkoff;
+	int		chunksize;
+	char   *chunk;
 
-		/* Read result set to local variables */
-		memcpy(&chunkoff, PQgetvalue(res, 0, 1), sizeof(int32));
-		chunkoff = ntohl(chunkoff);
-		chunksize = PQgetlength(res, 0, 2);
+	switch(PQresultStatus(res))
+	{
+		case PGRES_SINGLE_TUPLE:
+			break;
+
+		case PGRES_TUPLES_OK:
+			PQclear(res);
+			return; /* final zero-row result */
+		default:
+			fprintf(stderr, "unexpected result while fetching remote files: %s\n",
+					PQresultErrorMessage(res));
+			exit(1);
+	}
 
-		chunk = PQgetvalue(res, 0, 2);
+	/* sanity check the result set */
+	if (!(PQnfields(res) == 3 && PQntuples(res) == 1))
+	{
+		fprintf(stderr, "unexpected result set size while fetching remote files\n");
+		exit(1);
+	}
 
-		if (verbose)
-			fprintf(stderr, "received chunk for file \"%s\", off %d, len %d\n",
-					filename, chunkoff, chunksize);
+	if (!(PQftype(res, 0) == TEXTOID && PQftype(res, 1) == INT4OID && PQftype(res, 2) == BYTEAOID))
+	{
+		fprintf(stderr, "unexpected data types in result set while fetching remote files: %u %u %u\n", PQftype(res, 0), PQftype(res, 1), PQftype(res, 2));
+		exit(1);
+	}
+	if (!(PQfformat(res, 0) == 1 && PQfformat(res, 1) == 1 && PQfformat(res, 2) == 1))
+	{
+		fprintf(stderr, "unexpected result format while fetching remote files\n");
+		exit(1);
+	}
 
-		open_target_file(filename, false);
+	if (!(!PQgetisnull(res, 0, 0) &&
+		  !PQgetisnull(res, 0, 1) &&
+		  PQgetlength(res, 0, 1) == sizeof(int32)))
+	{
+		fprintf(stderr, "unexpected result set while fetching remote files\n");
+		exit(1);
+	}
 
-		write_file_range(chunk, chunkoff, chunksize);
+	filenamelen = PQgetlength(res, 0, 0);
+	filename = pg_malloc(filenamelen + 1);
+	memcpy(filename, PQgetvalue(res, 0, 0), filenamelen);
+	filename[filenamelen] = '\0';
 
+	/*
+	 * It's possible that the file was deleted on remote side after we
+	 * created the file map. In this case simply ignore it, as if it was
+	 * not there in the first place, and move on.
+	 */
+	if (PQgetisnull(res, 0, 2))
+	{
+		fprintf(stderr,
+			"received NULL chunk for file \"%s\", file has been deleted\n",
+			filename);
 		pg_free(filename);
 		PQclear(res);
+		return;
 	}
+
+	/* Read result set to local variables */
+	memcpy(&chunkoff, PQgetvalue(res, 0, 1), sizeof(int32));
+	chunkoff = ntohl(chunkoff);
+	chunksize = PQgetlength(res, 0, 2);
+
+	chunk = PQgetvalue(res, 0, 2);
+
+	if (verbose)
+		fprintf(stderr, "received chunk for file \"%s\", off %d, len %d\n",
+				filename, chunkoff, chunksize);
+
+	open_target_file(filename, false);
+
+	write_file_range(chunk, chunkoff, chunksize);
+
+	pg_free(filename);
+	PQclear(res);
 }
 
 /*
@@ -512,10 +635,16 @@ libpqGetFile(const char *filename, size_t *filesize)
 	return result;
 }
 
-static void
-copy_file_range(const char *path, unsigned int begin, unsigned int end)
+/*
+ * Queue the range of the file to fetch on "fetchconn", in COPY mode.
+ * Returns the number of bytes queued.
+ */
+static uint64
+copy_file_range(PGconn *fetchconn, const char *path, unsigned int begin,
+				unsigned int end)
 {
 	char linebuf[MAXPGPATH + 23];
+	uint64		queued = end - begin;
 
 	/* Split the range into CHUNKSIZE chunks */
 	while (end - begin > 0)
@@ -529,34 +658,29 @@ copy_file_range(const char *path, unsigned int begin, unsigned int end)
 
 		snprintf(linebuf, sizeof(linebuf), "%s\t%u\t%u\n", path, begin, len);
 
-		if (PQputCopyData(conn, linebuf, strlen(linebuf)) != 1)
+		if (PQputCopyData(fetchconn, linebuf, strlen(linebuf)) != 1)
 		{
 			fprintf(stderr, "error sending COPY data: %s\n",
-					PQerrorMessage(conn));
+					PQerrorMessage(fetchconn));
 			exit(1);
 		}
 		begin += len;
 	}
+
+	return queued;
 }
 
 /*
- * Fetch all changed blocks from remote source data directory.
+ * Create the temporary table listing the chunks to fetch on "fetchconn",
+ * and leave it in COPY mode to fill it.
  */
-void
-libpq_executeFileMap(filemap_t *map)
+static void
+sendChunkListStart(PGconn *fetchconn)
 {
-	file_entry_t *entry;
-	char		sql[1024];
 	PGresult   *res;
-	int			i;
 
-	/*
-	 * First create a temporary table, and load it with the blocks that
-	 * we need to fetch.
-	 */
-	snprintf(sql, sizeof(sql),
+	res = PQexec(fetchconn,
 		"create temporary table fetchchunks(path text, begin int4, len int4);");
-	res = PQexec(conn, sql);
 
 	if (PQresultStatus(res) != PGRES_COMMAND_OK)
 	{
@@ -566,9 +690,7 @@ libpq_executeFileMap(filemap_t *map)
 	}
 	PQclear(res);
 
-	snprintf(sql, sizeof(sql),
-			 "copy fetchchunks from stdin");
-	res = PQexec(conn, sql);
+	res = PQexec(fetchconn, "copy fetchchunks from stdin");
 
 	if (PQresultStatus(res) != PGRES_COPY_IN)
 	{
@@ -576,11 +698,78 @@ libpq_executeFileMap(filemap_t *map)
 				PQresultErrorMessage(res));
 		exit(1);
 	}
+	PQclear(res);
+}
+
+static void
+sendChunkListEnd(PGconn *fetchconn)
+{
+	PGresult   *res;
+
+	if (PQputCopyEnd(fetchconn, NULL) != 1)
+	{
+		fprintf(stderr, "error sending end-of-COPY: %s\n",
+				PQerrorMessage(fetchconn));
+		exit(1);
+	}
+
+	while ((res = PQgetResult(fetchconn)) != NULL)
+	{
+		if (PQresultStatus(res) != PGRES_COMMAND_OK)
+		{
+			fprintf(stderr, "unexpected result while sending file list: %s\n",
+					PQresultErrorMessage(res));
+			exit(1);
+		}
+		PQclear(res);
+	}
+}
+
+/*
+ * Fetch all changed blocks from remote source data directory.
+ *
+ * With --jobs, the files are spread over that many connections, each file
+ * going as a whole to the connection with the fewest bytes to fetch so far,
+ * and all the connections fetch at the same time.
+ */
+void
+libpq_executeFileMap(filemap_t *map)
+{
+	file_entry_t *entry;
+	char		sql[1024];
+	PGconn	  **conns;
+	uint64	   *queued;
+	int			nconns = num_jobs;
+	int			i;
+
+	conns = pg_malloc(nconns * sizeof(PGconn *));
+	queued = pg_malloc0(nconns * sizeof(uint64));
+	conns[0] = conn;
+	for (i = 1; i < nconns; i++)
+		conns[i] = connectFetchConn();
+
+	/*
+	 * First create a temporary table on each connection, and load it with
+	 * the blocks that we need to fetch.
+	 */
+	for (i = 0; i < nconns; i++)
+		sendChunkListStart(conns[i]);
 
 	for (i = 0; i < map->narray; i++)
 	{
+		PGconn	   *fetchconn;
+		int			target = 0;
+		int			j;
+
+		for (j = 1; j < nconns; j++)
+		{
+			if (queued[j] < queued[target])
+				target = j;
+		}
+		fetchconn = conns[target];
+
 		entry = map->array[i];
-		execute_pagemap(&entry->pagemap, entry->path);
+		queued[target] += execute_pagemap(fetchconn, &entry->pagemap, entry->path);
 
 		switch (entry->action)
 		{
@@ -591,7 +780,8 @@ libpq_executeFileMap(filemap_t *map)
 			case FILE_ACTION_COPY:
 				/* Truncate the old file out of the way, if any */
 				open_target_file(entry->path, true);
-				copy_file_range(entry->path, 0, entry->newsize);
+				queued[target] += copy_file_range(fetchconn, entry->path,
+												  0, entry->newsize);
 				break;
 
 			case FILE_ACTION_TRUNCATE:
@@ -599,7 +789,9 @@ libpq_executeFileMap(filemap_t *map)
 				break;
 
 			case FILE_ACTION_COPY_TAIL:
-				copy_file_range(entry->path, entry->oldsize, entry->newsize);
+				queued[target] += copy_file_range(fetchconn, entry->path,
+												  entry->oldsize,
+												  entry->newsize);
 				break;
 
 			case FILE_ACTION_REMOVE:
@@ -612,24 +804,8 @@ libpq_executeFileMap(filemap_t *map)
 		}
 	}
 
-	if (PQputCopyEnd(conn, NULL) != 1)
-	{
-		fprintf(stderr, "error sending end-of-COPY: %s\n",
-				PQerrorMessage(conn));
-		exit(1);
-	}
-
-	while ((res = PQgetResult(conn)) != NULL)
-	{
-		if (PQresultStatus(res) != PGRES_COMMAND_OK)
-		{
-			fprintf(stderr, "unexpected result while sending file list: %s\n",
-					PQresultErrorMessage(res));
-			exit(1);
-		}
-	}
-
-	PQclear(res);
+	for (i = 0; i < nconns; i++)
+		sendChunkListEnd(conns[i]);
 
 	/* Ok, we've sent the file list. Now receive the files */
 	snprintf(sql, sizeof(sql),
@@ -638,22 +814,46 @@ libpq_executeFileMap(filemap_t *map)
 		"%s.rewind_support_read_binary_file(path, begin, len, true) as chunk\n"
 		"from fetchchunks\n", PG_REWIND_SUPPORT_SCHEMA);
 
-	receiveFileChunks(sql);
-}
+	receiveFileChunks(conns, nconns, sql);
 
+	for (i = 1; i < nconns; i++)
+		PQfinish(conns[i]);
+	pg_free(conns);
+	pg_free(queued);
+}
 
-static void
-execute_pagemap(datapagemap_t *pagemap, const char *path)
+/*
+ * Queue the blocks of the page map on "fetchconn", a run of adjacent blocks
+ * being fetched as one range.  Returns the number of bytes queued.
+ */
+static uint64
+execute_pagemap(PGconn *fetchconn, datapagemap_t *pagemap, const char *path)
 {
 	datapagemap_iterator_t *iter;
 	BlockNumber blkno;
+	off_t		range_begin = 0;
+	off_t		range_end = 0;
+	uint64		queued = 0;
 
 	iter = datapagemap_iterate(pagemap);
 	while (datapagemap_next(iter, &blkno))
 	{
 		off_t offset = blkno * BLCKSZ;
 
-		copy_file_range(path, offset, offset + BLCKSZ);
+		if (range_end > range_begin && offset == range_end)
+		{
+			range_end += BLCKSZ;
+			continue;
+		}
+
+		if (range_end > range_begin)
+			queued += copy_file_range(fetchconn, path, range_begin, range_end);
+		range_begin = offset;
+		range_end = offset + BLCKSZ;
 	}
+	if (range_end > range_begin)
+		queued += copy_file_range(fetchconn, path, range_begin, range_end);
 	free(iter);
+
+	return queued;
 }
@@ -568,6 +568,15 @@ extractPageInfo(XLogRecord *record)
 						break;
 					}
 
+				case XLOG_BTREE_DEDUP:
+					{
+						xl_btree_dedup *xlrec =
+							(xl_btree_dedup *) XLogRecGetData(record);
+
+						pageinfo_add(MAIN_FORKNUM, xlrec->node, xlrec->block);
+						break;
+					}
+
 				case XLOG_BTREE_REUSE_PAGE:
 					/*
 					 * This record type is only emitted for hot standby's
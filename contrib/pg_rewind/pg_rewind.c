@@ -58,6 +58,7 @@ char *connstr_source = NULL;
 
 int verbose;
 int dry_run;
+int num_jobs = 1;
 
 /* Target history */
 TimeLineHistoryEntry *targetHistory;
@@ -75,6 +76,8 @@ usage(const char *progname)
 	printf("                 source data directory to sync with\n");
 	printf("  --source-server=CONNSTR\n");
 	printf("                 source server to sync with\n");
+	printf("  -j, --jobs=NUM use this many connections to fetch files from\n");
+	printf("                 the source server\n");
 	printf("  -v, --verbose  write a lot of progress messages\n");
 #ifdef ADB
 	printf("  -N, --nodename=NODE\n");
@@ -102,6 +105,7 @@ main(int argc, char **argv)
 		{"version", no_argument, NULL, 'V'},
 		{"dry-run", no_argument, NULL, 'n'},
 		{"verbose", no_argument, NULL, 'v'},
+		{"jobs", required_argument, NULL, 'j'},
 		{NULL, 0, NULL, 0}
 	};
 	int			option_index;
@@ -141,9 +145,9 @@ main(int argc, char **argv)
 	}
 
 #ifdef ADB
-	while ((c = getopt_long(argc, argv, "D:N:vn", long_options, &option_index)) != -1)
+	while ((c = getopt_long(argc, argv, "D:N:vnj:", long_options, &option_index)) != -1)
 #else
-	while ((c = getopt_long(argc, argv, "D:vn", long_options, &option_index)) != -1)
+	while ((c = getopt_long(argc, argv, "D:vnj:", long_options, &option_index)) != -1)
 #endif
 	{
 		switch (c)
@@ -159,6 +163,15 @@ main(int argc, char **argv)
 			case 'n':
 				dry_run = 1;
 				break;
+			case 'j':
+				num_jobs = atoi(optarg);
+				if (num_jobs <= 0)
+				{
+					fprintf(stderr, _("%s: invalid number of jobs \"%s\"\n"),
+							progname, optarg);
+					exit(1);
+				}
+				break;
 
 			case 'D':	/* -D or --target-pgdata */
 				datadir_target = pg_strdup(optarg);
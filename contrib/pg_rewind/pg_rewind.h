@@ -29,6 +29,7 @@ extern char *datadir_source;
 extern char *connstr_source;
 extern int verbose;
 extern int dry_run;
+extern int num_jobs;
 
 
 /* in parsexlog.c */
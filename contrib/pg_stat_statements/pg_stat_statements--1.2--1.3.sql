@@ -0,0 +1,161 @@
+/* contrib/pg_stat_statements/pg_stat_statements--1.2--1.3.sql */
+
+-- complain if script is sourced in psql, rather than via ALTER EXTENSION
+\echo Use "ALTER EXTENSION pg_stat_statements UPDATE TO '1.3'" to load this file. \quit
+
+/* First we have to remove them from the extension */
+ALTER EXTENSION pg_stat_statements DROP VIEW pg_stat_statements;
+ALTER EXTENSION pg_stat_statements DROP FUNCTION pg_stat_statements();
+ALTER EXTENSION pg_stat_statements DROP FUNCTION pg_stat_statements_since(timestamptz);
+
+/* Then we can drop them */
+DROP VIEW pg_stat_statements;
+DROP FUNCTION pg_stat_statements();
+DROP FUNCTION pg_stat_statements_since(timestamptz);
+
+/* Now redefine */
+CREATE FUNCTION pg_stat_statements(
+    OUT userid oid,
+    OUT dbid oid,
+    OUT query text,
+    OUT calls int8,
+    OUT total_time float8,
+    OUT rows int8,
+    OUT shared_blks_hit int8,
+    OUT shared_blks_read int8,
+    OUT shared_blks_dirtied int8,
+    OUT shared_blks_written int8,
+    OUT local_blks_hit int8,
+    OUT local_blks_read int8,
+    OUT local_blks_dirtied int8,
+    OUT local_blks_written int8,
+    OUT temp_blks_read int8,
+    OUT temp_blks_written int8,
+    OUT blk_read_time float8,
+    OUT blk_write_time float8,
+    OUT queryid int8,
+    OUT coord_queryid int8,
+    OUT remote_bytes_sent int8,
+    OUT remote_bytes_received int8,
+    OUT remote_messages_sent int8,
+    OUT remote_messages_received int8,
+    OUT remote_round_trips int8,
+    OUT time_p50 float8,
+    OUT time_p95 float8,
+    OUT time_p99 float8,
+    OUT time_p999 float8,
+    OUT time_histogram int8[]
+)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME'
+LANGUAGE C;
+
+CREATE FUNCTION pg_stat_statements_since(
+    IN since timestamptz,
+    OUT userid oid,
+    OUT dbid oid,
+    OUT query text,
+    OUT calls int8,
+    OUT total_time float8,
+    OUT rows int8,
+    OUT shared_blks_hit int8,
+    OUT shared_blks_read int8,
+    OUT shared_blks_dirtied int8,
+    OUT shared_blks_written int8,
+    OUT local_blks_hit int8,
+    OUT local_blks_read int8,
+    OUT local_blks_dirtied int8,
+    OUT local_blks_written int8,
+    OUT temp_blks_read int8,
+    OUT temp_blks_written int8,
+    OUT blk_read_time float8,
+    OUT blk_write_time float8,
+    OUT last_exec timestamptz,
+    OUT queryid int8,
+    OUT coord_queryid int8,
+    OUT remote_bytes_sent int8,
+    OUT remote_bytes_received int8,
+    OUT remote_messages_sent int8,
+    OUT remote_messages_received int8,
+    OUT remote_round_trips int8,
+    OUT time_p50 float8,
+    OUT time_p95 float8,
+    OUT time_p99 float8,
+    OUT time_p999 float8,
+    OUT time_histogram int8[]
+)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT;
+
+CREATE VIEW pg_stat_statements AS
+  SELECT * FROM pg_stat_statements();
+
+GRANT SELECT ON pg_stat_statements TO PUBLIC;
+
+-- The statements of every Coordinator and Datanode, with the node they ran on
+CREATE FUNCTION pg_stat_statements_nodes(
+    OUT node_name name,
+    OUT node_type "char",
+    OUT queryid int8,
+    OUT coord_queryid int8,
+    OUT query text,
+    OUT calls int8,
+    OUT total_time float8,
+    OUT rows int8,
+    OUT shared_blks_hit int8,
+    OUT shared_blks_read int8,
+    OUT time_histogram int8[]
+)
+RETURNS SETOF record
+AS $$
+DECLARE
+    node record;
+    stmt text;
+BEGIN
+    FOR node IN SELECT n.node_name, n.node_type FROM pg_catalog.pgxc_node n
+                 WHERE n.node_type IN ('C', 'D')
+    LOOP
+        stmt := 'SELECT ' || quote_literal(node.node_name) || '::name, ' ||
+                quote_literal(node.node_type) || '::"char", queryid, ' ||
+                'coord_queryid, query, calls, total_time, rows, ' ||
+                'shared_blks_hit, shared_blks_read, time_histogram ' ||
+                'FROM pg_stat_statements';
+        IF node.node_name = pg_catalog.pgxc_node_str() THEN
+            RETURN QUERY EXECUTE stmt;
+        ELSE
+            RETURN QUERY EXECUTE 'EXECUTE DIRECT ON (' ||
+                quote_ident(node.node_name) || ') ' || quote_literal(stmt);
+        END IF;
+    END LOOP;
+END;
+$$ LANGUAGE plpgsql;
+
+-- The statements of the Coordinators, with the cost of the queries the
+-- Datanodes ran for them and the percentiles of their execution times over
+-- all the Coordinators
+CREATE VIEW pg_stat_statements_cluster AS
+  WITH s AS (SELECT * FROM pg_stat_statements_nodes())
+  SELECT c.queryid, c.query, c.calls, c.total_time, c.rows,
+         coalesce(d.calls, 0) AS datanode_calls,
+         coalesce(d.total_time, 0) AS datanode_total_time,
+         coalesce(d.rows, 0) AS datanode_rows,
+         coalesce(d.shared_blks_hit, 0) AS datanode_blks_hit,
+         coalesce(d.shared_blks_read, 0) AS datanode_blks_read,
+         latency_percentile(c.time_histogram, 0.5) AS time_p50,
+         latency_percentile(c.time_histogram, 0.95) AS time_p95,
+         latency_percentile(c.time_histogram, 0.99) AS time_p99,
+         latency_percentile(c.time_histogram, 0.999) AS time_p999
+    FROM (SELECT queryid, min(query) AS query, sum(calls)::int8 AS calls,
+                 sum(total_time) AS total_time, sum(rows)::int8 AS rows,
+                 latency_histogram_merge(time_histogram) AS time_histogram
+            FROM s WHERE node_type = 'C' AND coord_queryid = 0
+           GROUP BY queryid) c
+    LEFT JOIN
+         (SELECT coord_queryid, sum(calls)::int8 AS calls,
+                 sum(total_time) AS total_time, sum(rows)::int8 AS rows,
+                 sum(shared_blks_hit)::int8 AS shared_blks_hit,
+                 sum(shared_blks_read)::int8 AS shared_blks_read
+            FROM s WHERE node_type = 'D' AND coord_queryid <> 0
+           GROUP BY coord_queryid) d
+      ON d.coord_queryid = c.queryid;
@@ -58,7 +58,12 @@
 #include "storage/ipc.h"
 #include "storage/spin.h"
 #include "tcop/utility.h"
+#ifdef ADB
+#include "tcop/tcopprot.h"
+#endif
 #include "utils/builtins.h"
+#include "utils/latencyhist.h"
+#include "utils/timestamp.h"
 
 
 PG_MODULE_MAGIC;
@@ -67,7 +72,7 @@ PG_MODULE_MAGIC;
 #define PGSS_DUMP_FILE	"global/pg_stat_statements.stat"
 
 /* This constant defines the magic number in the stats file header */
-static const uint32 PGSS_FILE_HEADER = 0x20120328;
+static const uint32 PGSS_FILE_HEADER = 0x20161016;
 
 /* XXX: Should USAGE_EXEC reflect execution time and/or buffer usage? */
 #define USAGE_EXEC(duration)	(1.0)
@@ -86,6 +91,9 @@ static const uint32 PGSS_FILE_HEADER = 0x20120328;
  * Presently, the query encoding is fully determined by the source database
  * and so we don't really need it to be in the key.  But that might not always
  * be true. Anyway it's notationally convenient to pass it as part of the key.
+ *
+ * On a Datanode, the queries run for different Coordinator statements are
+ * kept apart too, so that their costs can be added to these statements.
  */
 typedef struct pgssHashKey
 {
@@ -93,6 +101,7 @@ typedef struct pgssHashKey
 	Oid			dbid;			/* database OID */
 	int			encoding;		/* query encoding */
 	uint32		queryid;		/* query identifier */
+	uint32		coord_queryid;	/* Coordinator statement, 0 if none */
 } pgssHashKey;
 
 /*
@@ -115,7 +124,14 @@ typedef struct Counters
 	int64		temp_blks_written;		/* # of temp blocks written */
 	double		blk_read_time;	/* time spent reading, in msec */
 	double		blk_write_time; /* time spent writing, in msec */
+	int64		remote_bytes_sent;	/* bytes sent to other nodes */
+	int64		remote_bytes_received;	/* bytes received from other nodes */
+	int64		remote_msgs_sent;	/* # of messages sent to other nodes */
+	int64		remote_msgs_received;	/* # of messages received from them */
+	int64		remote_round_trips;		/* # of waits for an answer */
+	int64		time_hist[LATENCY_HIST_BUCKETS];	/* execution times */
 	double		usage;			/* usage factor */
+	TimestampTz last_exec;		/* end of the last execution */
 } Counters;
 
 /*
@@ -226,9 +242,11 @@ void		_PG_fini(void);
 
 Datum		pg_stat_statements_reset(PG_FUNCTION_ARGS);
 Datum		pg_stat_statements(PG_FUNCTION_ARGS);
+Datum		pg_stat_statements_since(PG_FUNCTION_ARGS);
 
 PG_FUNCTION_INFO_V1(pg_stat_statements_reset);
 PG_FUNCTION_INFO_V1(pg_stat_statements);
+PG_FUNCTION_INFO_V1(pg_stat_statements_since);
 
 static void pgss_shmem_startup(void);
 static void pgss_shmem_shutdown(int code, Datum arg);
@@ -253,6 +271,8 @@ static void pgss_store(const char *query, uint32 queryId,
 		   double total_time, uint64 rows,
 		   const BufferUsage *bufusage,
 		   pgssJumbleState *jstate);
+static void pg_stat_statements_internal(FunctionCallInfo fcinfo,
+							bool since_given, TimestampTz since);
 static Size pgss_memsize(void);
 static pgssEntry *entry_alloc(pgssHashKey *key, const char *query,
 			int query_len, bool sticky);
@@ -894,6 +914,18 @@ pgss_ProcessUtility(Node *parsetree, const char *queryString,
 		INSTR_TIME_SUBTRACT(bufusage.blk_read_time, bufusage_start.blk_read_time);
 		bufusage.blk_write_time = pgBufferUsage.blk_write_time;
 		INSTR_TIME_SUBTRACT(bufusage.blk_write_time, bufusage_start.blk_write_time);
+#ifdef ADB
+		bufusage.remote_bytes_sent =
+			pgBufferUsage.remote_bytes_sent - bufusage_start.remote_bytes_sent;
+		bufusage.remote_bytes_received =
+			pgBufferUsage.remote_bytes_received - bufusage_start.remote_bytes_received;
+		bufusage.remote_msgs_sent =
+			pgBufferUsage.remote_msgs_sent - bufusage_start.remote_msgs_sent;
+		bufusage.remote_msgs_received =
+			pgBufferUsage.remote_msgs_received - bufusage_start.remote_msgs_received;
+		bufusage.remote_round_trips =
+			pgBufferUsage.remote_round_trips - bufusage_start.remote_round_trips;
+#endif
 
 		/* For utility statements, we just hash the query string directly */
 		queryId = pgss_hash_string(queryString);
@@ -937,7 +969,8 @@ pgss_hash_fn(const void *key, Size keysize)
 	/* we don't bother to include encoding in the hash */
 	return hash_uint32((uint32) k->userid) ^
 		hash_uint32((uint32) k->dbid) ^
-		hash_uint32((uint32) k->queryid);
+		hash_uint32((uint32) k->queryid) ^
+		hash_uint32(k->coord_queryid);
 }
 
 /*
@@ -952,7 +985,8 @@ pgss_match_fn(const void *key1, const void *key2, Size keysize)
 	if (k1->userid == k2->userid &&
 		k1->dbid == k2->dbid &&
 		k1->encoding == k2->encoding &&
-		k1->queryid == k2->queryid)
+		k1->queryid == k2->queryid &&
+		k1->coord_queryid == k2->coord_queryid)
 		return 0;
 	else
 		return 1;
@@ -997,6 +1031,11 @@ pgss_store(const char *query, uint32 queryId,
 	key.dbid = MyDatabaseId;
 	key.encoding = GetDatabaseEncoding();
 	key.queryid = queryId;
+#ifdef ADB
+	key.coord_queryid = CoordinatorQueryId;
+#else
+	key.coord_queryid = 0;
+#endif
 
 	/* Lookup the hash table entry with shared lock. */
 	LWLockAcquire(pgss->lock, LW_SHARED);
@@ -1077,7 +1116,16 @@ pgss_store(const char *query, uint32 queryId,
 		e->counters.temp_blks_written += bufusage->temp_blks_written;
 		e->counters.blk_read_time += INSTR_TIME_GET_MILLISEC(bufusage->blk_read_time);
 		e->counters.blk_write_time += INSTR_TIME_GET_MILLISEC(bufusage->blk_write_time);
+#ifdef ADB
+		e->counters.remote_bytes_sent += bufusage->remote_bytes_sent;
+		e->counters.remote_bytes_received += bufusage->remote_bytes_received;
+		e->counters.remote_msgs_sent += bufusage->remote_msgs_sent;
+		e->counters.remote_msgs_received += bufusage->remote_msgs_received;
+		e->counters.remote_round_trips += bufusage->remote_round_trips;
+#endif
+		e->counters.time_hist[LatencyHistBucket((uint64) (total_time * 1000.0))]++;
 		e->counters.usage += USAGE_EXEC(total_time);
+		e->counters.last_exec = GetCurrentTimestamp();
 
 		SpinLockRelease(&e->mutex);
 	}
@@ -1104,13 +1152,41 @@ pg_stat_statements_reset(PG_FUNCTION_ARGS)
 }
 
 #define PG_STAT_STATEMENTS_COLS_V1_0	14
-#define PG_STAT_STATEMENTS_COLS			18
+#define PG_STAT_STATEMENTS_COLS_V1_1	18
+#define PG_STAT_STATEMENTS_COLS_V1_3	30
+#define PG_STAT_STATEMENTS_COLS			31	/* with last_exec */
+
+/* Percentiles of the execution times shown in version 1.3 */
+static const double pgss_percentiles[] = {0.5, 0.95, 0.99, 0.999};
 
 /*
  * Retrieve statement statistics.
  */
 Datum
 pg_stat_statements(PG_FUNCTION_ARGS)
+{
+	pg_stat_statements_internal(fcinfo, false, 0);
+
+	return (Datum) 0;
+}
+
+/*
+ * Retrieve the statistics of the statements executed at or after the given
+ * time, with the end of their last execution.  Collectors keep the latest
+ * last_exec they got and pass it back next time, so that they only read the
+ * statements which changed since.
+ */
+Datum
+pg_stat_statements_since(PG_FUNCTION_ARGS)
+{
+	pg_stat_statements_internal(fcinfo, true, PG_GETARG_TIMESTAMPTZ(0));
+
+	return (Datum) 0;
+}
+
+static void
+pg_stat_statements_internal(FunctionCallInfo fcinfo,
+							bool since_given, TimestampTz since)
 {
 	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
 	TupleDesc	tupdesc;
@@ -1122,6 +1198,8 @@ pg_stat_statements(PG_FUNCTION_ARGS)
 	HASH_SEQ_STATUS hash_seq;
 	pgssEntry  *entry;
 	bool		sql_supports_v1_1_counters = true;
+	bool		sql_supports_last_exec = since_given;
+	bool		sql_supports_queryid = false;
 
 	if (!pgss || !pgss_hash)
 		ereport(ERROR,
@@ -1144,6 +1222,8 @@ pg_stat_statements(PG_FUNCTION_ARGS)
 		elog(ERROR, "return type must be a row type");
 	if (tupdesc->natts == PG_STAT_STATEMENTS_COLS_V1_0)
 		sql_supports_v1_1_counters = false;
+	else if (tupdesc->natts >= PG_STAT_STATEMENTS_COLS_V1_3)
+		sql_supports_queryid = true;
 
 	per_query_ctx = rsinfo->econtext->ecxt_per_query_memory;
 	oldcontext = MemoryContextSwitchTo(per_query_ctx);
@@ -1163,6 +1243,7 @@ pg_stat_statements(PG_FUNCTION_ARGS)
 		Datum		values[PG_STAT_STATEMENTS_COLS];
 		bool		nulls[PG_STAT_STATEMENTS_COLS];
 		int			i = 0;
+		int			j;
 		Counters	tmp;
 
 		memset(values, 0, sizeof(values));
@@ -1200,6 +1281,9 @@ pg_stat_statements(PG_FUNCTION_ARGS)
 		if (tmp.calls == 0)
 			continue;
 
+		if (since_given && tmp.last_exec < since)
+			continue;
+
 		values[i++] = Int64GetDatumFast(tmp.calls);
 		values[i++] = Float8GetDatumFast(tmp.total_time);
 		values[i++] = Int64GetDatumFast(tmp.rows);
@@ -1220,9 +1304,29 @@ pg_stat_statements(PG_FUNCTION_ARGS)
 			values[i++] = Float8GetDatumFast(tmp.blk_read_time);
 			values[i++] = Float8GetDatumFast(tmp.blk_write_time);
 		}
+		if (sql_supports_last_exec)
+			values[i++] = TimestampTzGetDatum(tmp.last_exec);
+		if (sql_supports_queryid)
+		{
+			values[i++] = Int64GetDatum((int64) entry->key.queryid);
+			values[i++] = Int64GetDatum((int64) entry->key.coord_queryid);
+			values[i++] = Int64GetDatumFast(tmp.remote_bytes_sent);
+			values[i++] = Int64GetDatumFast(tmp.remote_bytes_received);
+			values[i++] = Int64GetDatumFast(tmp.remote_msgs_sent);
+			values[i++] = Int64GetDatumFast(tmp.remote_msgs_received);
+			values[i++] = Int64GetDatumFast(tmp.remote_round_trips);
+			/* percentiles in msec, like total_time */
+			for (j = 0; j < lengthof(pgss_percentiles); j++)
+				values[i++] = Float8GetDatum(LatencyHistPercentile(tmp.time_hist,
+																   LATENCY_HIST_BUCKETS,
+																   pgss_percentiles[j]) / 1000.0);
+			values[i++] = PointerGetDatum(LatencyHistGetArray(tmp.time_hist));
+		}
 
-		Assert(i == (sql_supports_v1_1_counters ?
-					 PG_STAT_STATEMENTS_COLS : PG_STAT_STATEMENTS_COLS_V1_0));
+		Assert(i == (!sql_supports_v1_1_counters ? PG_STAT_STATEMENTS_COLS_V1_0 :
+					 (sql_supports_queryid ? PG_STAT_STATEMENTS_COLS_V1_3 :
+					  PG_STAT_STATEMENTS_COLS_V1_1) +
+					 (sql_supports_last_exec ? 1 : 0)));
 
 		tuplestore_putvalues(tupstore, tupdesc, values, nulls);
 	}
@@ -1231,8 +1335,6 @@ pg_stat_statements(PG_FUNCTION_ARGS)
 
 	/* clean up and return the tuplestore */
 	tuplestore_donestoring(tupstore);
-
-	return (Datum) 0;
 }
 
 /*
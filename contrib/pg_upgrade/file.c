@@ -13,6 +13,11 @@
 
 #include <fcntl.h>
 
+#include "access/visibilitymap.h"
+#include "storage/bufpage.h"
+#include "storage/checksum.h"
+#include "storage/checksum_impl.h"
+
 
 
 #ifndef WIN32
@@ -104,6 +109,91 @@ copyAndUpdateFile(pageCnvCtx *pageConverter,
 }
 
 
+/*
+ * rewriteVisibilityMap()
+ *
+ * In-place upgrade of the visibility map: the old map has one all-visible
+ * bit per heap page, the new one a pair of all-visible and all-frozen bits.
+ * Each old page then makes two new pages, the all-visible bits being kept
+ * and the all-frozen ones left clear, as VACUUM has to prove them again.
+ * The new map is written to a new file, even in link mode.
+ */
+const char *
+rewriteVisibilityMap(const char *fromfile, const char *tofile)
+{
+	/* bytes of the old map going to one page of the new one */
+	const int	oldBytesPerPage = (BLCKSZ - MAXALIGN(SizeOfPageHeaderData)) / 2;
+	int			src_fd;
+	int			dst_fd;
+	char		buf[BLCKSZ];
+	char		new_vmbuf[BLCKSZ];
+	BlockNumber new_blkno = 0;
+	ssize_t		bytesRead;
+	const char *msg = NULL;
+
+	if ((src_fd = open(fromfile, O_RDONLY | PG_BINARY, 0)) < 0)
+		return "could not open source file";
+
+	if ((dst_fd = open(tofile, O_RDWR | O_CREAT | O_EXCL | PG_BINARY,
+					   S_IRUSR | S_IWUSR)) < 0)
+	{
+		close(src_fd);
+		return "could not create destination file";
+	}
+
+	while ((bytesRead = read(src_fd, buf, BLCKSZ)) == BLCKSZ)
+	{
+		char	   *old_cur = buf + MAXALIGN(SizeOfPageHeaderData);
+		int			part;
+
+		for (part = 0; part < 2 && msg == NULL; part++)
+		{
+			char	   *new_cur = new_vmbuf + MAXALIGN(SizeOfPageHeaderData);
+			char	   *old_break = old_cur + oldBytesPerPage;
+
+			/* the new page starts with the header of the old one */
+			memset(new_vmbuf, 0, BLCKSZ);
+			memcpy(new_vmbuf, buf, SizeOfPageHeaderData);
+
+			for (; old_cur < old_break; old_cur++)
+			{
+				uint8		byte = *(uint8 *) old_cur;
+				uint16		new_vmbits = 0;
+				int			i;
+
+				for (i = 0; i < BITS_PER_BYTE; i++)
+				{
+					if (byte & (1 << i))
+						new_vmbits |= VISIBILITYMAP_ALL_VISIBLE << (BITS_PER_HEAPBLOCK * i);
+				}
+				*new_cur++ = (char) (new_vmbits & 0xFF);
+				*new_cur++ = (char) (new_vmbits >> 8);
+			}
+
+			if (new_cluster.controldata.data_checksum_version != 0)
+				((PageHeader) new_vmbuf)->pd_checksum =
+					pg_checksum_page(new_vmbuf, new_blkno);
+
+			if (write(dst_fd, new_vmbuf, BLCKSZ) != BLCKSZ)
+				msg = "could not write new page to destination";
+			new_blkno++;
+		}
+		if (msg)
+			break;
+	}
+
+	close(src_fd);
+	close(dst_fd);
+
+	if (msg)
+		return msg;
+	else if (bytesRead != 0)
+		return "found partial page in source file";
+	else
+		return NULL;
+}
+
+
 /*
  * linkAndUpdateFile()
  *
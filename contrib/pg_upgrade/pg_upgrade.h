@@ -114,6 +114,13 @@ extern char *output_files[];
  */
 #define MULTIXACT_FORMATCHANGE_CAT_VER 201301231
 
+/*
+ * The visibility map got an all-frozen bit next to the all-visible one of
+ * each heap page with the change which updated the catalog version to this
+ * value.  Older maps have to be rewritten.
+ */
+#define VISIBILITY_MAP_FROZEN_BIT_CAT_VER 202610144
+
 /*
  * Each relation is represented by a relinfo structure.
  */
@@ -382,6 +389,7 @@ const char *copyAndUpdateFile(pageCnvCtx *pageConverter, const char *src,
 				  const char *dst, bool force);
 const char *linkAndUpdateFile(pageCnvCtx *pageConverter, const char *src,
 				  const char *dst);
+const char *rewriteVisibilityMap(const char *fromfile, const char *tofile);
 
 void		check_hard_link(void);
 FILE	   *fopen_priv(const char *path, const char *mode);
@@ -14,9 +14,15 @@
 
 #include <dirent.h>
 #include <unistd.h>
+#ifndef WIN32
+#include <sys/wait.h>
+#endif
 
+#include "access/heapam_xlog.h"
+#include "access/nbtree.h"
 #include "access/rxact_mgr.h"
 #include "access/xlog.h"
+#include "access/xlog_internal.h"
 #include "access/xlogreader.h"
 #include "access/transam.h"
 #include "common/fe_memutils.h"
@@ -49,8 +55,44 @@ typedef struct XLogDumpConfig
 	int			filter_by_rmgr;
 	TransactionId filter_by_xid;
 	bool		filter_by_xid_enabled;
+
+	/* statistics options */
+	bool		stats;
+	bool		stats_per_record;
+	int			jobs;
 } XLogDumpConfig;
 
+/* Number of record types an rmgr can have, from the high bits of xl_info */
+#define XLOG_DUMP_RECORD_TYPES	16
+
+typedef struct XLogDumpStatsRow
+{
+	uint64		count;
+	uint64		rec_len;
+	uint64		fpi_len;
+} XLogDumpStatsRow;
+
+typedef struct XLogDumpRelStats
+{
+	RelFileNode node;
+	XLogDumpStatsRow stats;
+} XLogDumpRelStats;
+
+/*
+ * WAL volume accumulated by --stats.  The relations are kept in an open
+ * addressing hash table of maxrels entries, a power of two, nrels of them
+ * being used; an unused entry has a relNode of InvalidOid.
+ */
+typedef struct XLogDumpStats
+{
+	uint64		count;
+	XLogDumpStatsRow rmgr_stats[RM_MAX_ID + 1];
+	XLogDumpStatsRow record_stats[RM_MAX_ID + 1][XLOG_DUMP_RECORD_TYPES];
+	XLogDumpRelStats *rel_stats;
+	int			nrels;
+	int			maxrels;
+} XLogDumpStats;
+
 static void
 fatal_error(const char *fmt,...)
 __attribute__((format(PG_PRINTF_ATTRIBUTE, 1, 2)));
@@ -329,14 +371,6 @@ XLogDumpDisplayRecord(XLogDumpConfig *config, XLogRecPtr ReadRecPtr, XLogRecord
 {
 	const RmgrDescData *desc = &RmgrDescTable[record->xl_rmid];
 
-	if (config->filter_by_rmgr != -1 &&
-		config->filter_by_rmgr != record->xl_rmid)
-		return;
-
-	if (config->filter_by_xid_enabled &&
-		config->filter_by_xid != record->xl_xid)
-		return;
-
 	config->already_displayed_records++;
 
 	printf("rmgr: %-11s len (rec/tot): %6u/%6u, tx: %10u, lsn: %X/%08X, prev %X/%08X, bkp: %u%u%u%u, desc: ",
@@ -371,6 +405,22 @@ XLogDumpDisplayRecord(XLogDumpConfig *config, XLogRecPtr ReadRecPtr, XLogRecord
 			blk += sizeof(BkpBlock);
 			blk += BLCKSZ - bkpb.hole_length;
 
+#ifdef ADB
+			if (bkpb.hole_offset & BKPBLOCK_COMPRESSED)
+			{
+				uint16		hole_length;
+
+				/* the actual hole length ends the compressed image */
+				memcpy(&hole_length, blk - sizeof(uint16), sizeof(uint16));
+				printf("\tbackup bkp #%u; rel %u/%u/%u; fork: %s; block: %u; hole: offset: %u, length: %u; compressed: %u\n",
+					   bkpnum,
+					   bkpb.node.spcNode, bkpb.node.dbNode, bkpb.node.relNode,
+					   forkNames[bkpb.fork],
+					   bkpb.block, bkpb.hole_offset & ~BKPBLOCK_COMPRESSED,
+					   hole_length, BLCKSZ - bkpb.hole_length);
+				continue;
+			}
+#endif
 			printf("\tbackup bkp #%u; rel %u/%u/%u; fork: %s; block: %u; hole: offset: %u, length: %u\n",
 				   bkpnum,
 				   bkpb.node.spcNode, bkpb.node.dbNode, bkpb.node.relNode,
@@ -380,6 +430,536 @@ XLogDumpDisplayRecord(XLogDumpConfig *config, XLogRecPtr ReadRecPtr, XLogRecord
 	}
 }
 
+/*
+ * Entry of relation "node" in the statistics, added if not there yet
+ */
+static XLogDumpRelStats *
+XLogDumpRelEntry(XLogDumpStats *stats, const RelFileNode *node)
+{
+	uint32		hash;
+	int			i;
+
+	if (stats->nrels * 2 >= stats->maxrels)
+	{
+		XLogDumpRelStats *old = stats->rel_stats;
+		int			oldmax = stats->maxrels;
+
+		stats->maxrels = oldmax > 0 ? oldmax * 2 : 1024;
+		stats->rel_stats = pg_malloc0(stats->maxrels * sizeof(XLogDumpRelStats));
+		stats->nrels = 0;
+		for (i = 0; i < oldmax; i++)
+		{
+			if (old[i].node.relNode == InvalidOid)
+				continue;
+			XLogDumpRelEntry(stats, &old[i].node)->stats = old[i].stats;
+		}
+		if (old)
+			pg_free(old);
+	}
+
+	hash = (node->relNode * 0x9E3779B1) ^ node->dbNode ^ (node->spcNode << 16);
+	for (i = hash & (stats->maxrels - 1);; i = (i + 1) & (stats->maxrels - 1))
+	{
+		XLogDumpRelStats *entry = &stats->rel_stats[i];
+
+		if (entry->node.relNode == InvalidOid)
+		{
+			entry->node = *node;
+			stats->nrels++;
+			return entry;
+		}
+		if (RelFileNodeEquals(entry->node, *node))
+			return entry;
+	}
+}
+
+/*
+ * Account a record in the statistics
+ *
+ * The record size is the header and data of the record, the FPI size what
+ * its backup blocks take.  The backup blocks are charged to the relation
+ * they belong to, and so is the record size of the rmgrs which records all
+ * begin with the RelFileNode they change, that is heap and btree ones.
+ */
+static void
+XLogDumpCountRecord(XLogDumpConfig *config, XLogDumpStats *stats,
+					XLogRecord *record)
+{
+	RmgrId		rmid = record->xl_rmid;
+	int			type = (record->xl_info & ~XLR_INFO_MASK) >> 4;
+	uint32		rec_len = SizeOfXLogRecord + record->xl_len;
+	uint32		fpi_len = record->xl_tot_len - rec_len;
+	RelFileNode counted[XLR_MAX_BKP_BLOCKS + 1];
+	int			ncounted = 0;
+	char	   *blk;
+	int			bkpnum;
+
+	stats->count++;
+
+	stats->rmgr_stats[rmid].count++;
+	stats->rmgr_stats[rmid].rec_len += rec_len;
+	stats->rmgr_stats[rmid].fpi_len += fpi_len;
+
+	stats->record_stats[rmid][type].count++;
+	stats->record_stats[rmid][type].rec_len += rec_len;
+	stats->record_stats[rmid][type].fpi_len += fpi_len;
+
+	if ((rmid == RM_HEAP_ID || rmid == RM_HEAP2_ID || rmid == RM_BTREE_ID) &&
+		record->xl_len >= sizeof(RelFileNode))
+	{
+		XLogDumpRelStats *entry;
+
+		memcpy(&counted[ncounted], XLogRecGetData(record), sizeof(RelFileNode));
+		entry = XLogDumpRelEntry(stats, &counted[ncounted++]);
+		entry->stats.count++;
+		entry->stats.rec_len += rec_len;
+	}
+
+	blk = (char *) XLogRecGetData(record) + record->xl_len;
+	for (bkpnum = 0; bkpnum < XLR_MAX_BKP_BLOCKS; bkpnum++)
+	{
+		XLogDumpRelStats *entry;
+		BkpBlock	bkpb;
+		int			i;
+
+		if (!(XLR_BKP_BLOCK(bkpnum) & record->xl_info))
+			continue;
+
+		memcpy(&bkpb, blk, sizeof(BkpBlock));
+		blk += sizeof(BkpBlock) + BLCKSZ - bkpb.hole_length;
+
+		entry = XLogDumpRelEntry(stats, &bkpb.node);
+		entry->stats.fpi_len += sizeof(BkpBlock) + BLCKSZ - bkpb.hole_length;
+
+		/* a record touching a relation twice counts once */
+		for (i = 0; i < ncounted; i++)
+		{
+			if (RelFileNodeEquals(counted[i], bkpb.node))
+				break;
+		}
+		if (i == ncounted)
+		{
+			counted[ncounted++] = bkpb.node;
+			entry->stats.count++;
+		}
+	}
+
+	config->already_displayed_records++;
+}
+
+/*
+ * Add the statistics "other" to "stats"
+ */
+static void
+XLogDumpMergeStats(XLogDumpStats *stats, XLogDumpStats *other)
+{
+	int			ri;
+	int			tj;
+	int			i;
+
+	stats->count += other->count;
+	for (ri = 0; ri <= RM_MAX_ID; ri++)
+	{
+		stats->rmgr_stats[ri].count += other->rmgr_stats[ri].count;
+		stats->rmgr_stats[ri].rec_len += other->rmgr_stats[ri].rec_len;
+		stats->rmgr_stats[ri].fpi_len += other->rmgr_stats[ri].fpi_len;
+
+		for (tj = 0; tj < XLOG_DUMP_RECORD_TYPES; tj++)
+		{
+			XLogDumpStatsRow *row = &stats->record_stats[ri][tj];
+
+			row->count += other->record_stats[ri][tj].count;
+			row->rec_len += other->record_stats[ri][tj].rec_len;
+			row->fpi_len += other->record_stats[ri][tj].fpi_len;
+		}
+	}
+
+	for (i = 0; i < other->maxrels; i++)
+	{
+		XLogDumpRelStats *entry;
+
+		if (other->rel_stats[i].node.relNode == InvalidOid)
+			continue;
+
+		entry = XLogDumpRelEntry(stats, &other->rel_stats[i].node);
+		entry->stats.count += other->rel_stats[i].stats.count;
+		entry->stats.rec_len += other->rel_stats[i].stats.rec_len;
+		entry->stats.fpi_len += other->rel_stats[i].stats.fpi_len;
+	}
+}
+
+/*
+ * Print a line of the statistics, with its share of the totals
+ */
+static void
+XLogDumpStatsLine(const char *name, const XLogDumpStatsRow *row,
+				  const XLogDumpStatsRow *total)
+{
+	double		tot_len = (double) row->rec_len + row->fpi_len;
+	double		total_len = (double) total->rec_len + total->fpi_len;
+	double		n_pct = 0;
+	double		rec_len_pct = 0;
+	double		fpi_len_pct = 0;
+	double		tot_len_pct = 0;
+	double		fpi_share = 0;
+
+	if (total->count != 0)
+		n_pct = 100 * (double) row->count / total->count;
+	if (total->rec_len != 0)
+		rec_len_pct = 100 * (double) row->rec_len / total->rec_len;
+	if (total->fpi_len != 0)
+		fpi_len_pct = 100 * (double) row->fpi_len / total->fpi_len;
+	if (total_len != 0)
+		tot_len_pct = 100 * tot_len / total_len;
+	if (tot_len != 0)
+		fpi_share = 100 * (double) row->fpi_len / tot_len;
+
+	printf("%-32s %12.0f (%6.2f) %16.0f (%6.2f) %16.0f (%6.2f) %16.0f (%6.2f) %6.2f\n",
+		   name,
+		   (double) row->count, n_pct,
+		   (double) row->rec_len, rec_len_pct,
+		   (double) row->fpi_len, fpi_len_pct,
+		   tot_len, tot_len_pct,
+		   fpi_share);
+}
+
+static void
+XLogDumpStatsHeader(const char *what)
+{
+	printf("\n%-32s %21s %25s %25s %25s %6s\n",
+		   what, "N      (%)", "Record size      (%)",
+		   "FPI size      (%)", "Combined size      (%)", "FPI %");
+	printf("%-32s %21s %25s %25s %25s %6s\n",
+		   "----", "-      ---", "-----------      ---",
+		   "--------      ---", "-------------      ---", "-----");
+}
+
+static int
+rel_stats_cmp(const void *a, const void *b)
+{
+	const XLogDumpRelStats *ra = (const XLogDumpRelStats *) a;
+	const XLogDumpRelStats *rb = (const XLogDumpRelStats *) b;
+	uint64		la = ra->stats.rec_len + ra->stats.fpi_len;
+	uint64		lb = rb->stats.rec_len + rb->stats.fpi_len;
+
+	if (la != lb)
+		return la > lb ? -1 : 1;
+	return 0;
+}
+
+/*
+ * Print the statistics: a line per rmgr, or per record type if
+ * --stats=record, then a line per relation by decreasing combined size
+ */
+static void
+XLogDumpDisplayStats(XLogDumpConfig *config, XLogDumpStats *stats)
+{
+	XLogDumpStatsRow total;
+	XLogDumpRelStats *rels;
+	char		name[64];
+	int			ri;
+	int			tj;
+	int			i;
+	int			n;
+
+	MemSet(&total, 0, sizeof(total));
+	for (ri = 0; ri <= RM_MAX_ID; ri++)
+	{
+		total.count += stats->rmgr_stats[ri].count;
+		total.rec_len += stats->rmgr_stats[ri].rec_len;
+		total.fpi_len += stats->rmgr_stats[ri].fpi_len;
+	}
+
+	XLogDumpStatsHeader(config->stats_per_record ? "Type" : "Resource manager");
+	for (ri = 0; ri <= RM_MAX_ID; ri++)
+	{
+		const RmgrDescData *desc = &RmgrDescTable[ri];
+
+		if (stats->rmgr_stats[ri].count == 0)
+			continue;
+
+		if (!config->stats_per_record)
+		{
+			XLogDumpStatsLine(desc->rm_name, &stats->rmgr_stats[ri], &total);
+			continue;
+		}
+
+		for (tj = 0; tj < XLOG_DUMP_RECORD_TYPES; tj++)
+		{
+			if (stats->record_stats[ri][tj].count == 0)
+				continue;
+
+			snprintf(name, sizeof(name), "%s/0x%02X", desc->rm_name, tj << 4);
+			XLogDumpStatsLine(name, &stats->record_stats[ri][tj], &total);
+		}
+	}
+	printf("%-32s %21s %25s %25s %25s %6s\n",
+		   "", "--------", "--------", "--------", "--------", "-----");
+	XLogDumpStatsLine("Total", &total, &total);
+
+	if (stats->nrels == 0)
+		return;
+
+	/* relations by decreasing combined size */
+	rels = pg_malloc(stats->nrels * sizeof(XLogDumpRelStats));
+	for (i = 0, n = 0; i < stats->maxrels; i++)
+	{
+		if (stats->rel_stats[i].node.relNode != InvalidOid)
+			rels[n++] = stats->rel_stats[i];
+	}
+	qsort(rels, n, sizeof(XLogDumpRelStats), rel_stats_cmp);
+
+	XLogDumpStatsHeader("Relation");
+	for (i = 0; i < n; i++)
+	{
+		snprintf(name, sizeof(name), "%u/%u/%u",
+				 rels[i].node.spcNode, rels[i].node.dbNode,
+				 rels[i].node.relNode);
+		XLogDumpStatsLine(name, &rels[i].stats, &total);
+	}
+	pg_free(rels);
+}
+
+/*
+ * Read the records starting from "startptr", up to those starting at or
+ * after "stopptr" or the end of the WAL if that is invalid, and display
+ * them or count them in "stats".  A "startptr" not at the beginning of a
+ * record is moved forward to the first record after it; if there is none
+ * and "stopptr" is valid, nothing is read.
+ */
+static void
+XLogDumpReadRange(XLogDumpPrivate *private, XLogDumpConfig *config,
+				  XLogDumpStats *stats, XLogRecPtr startptr,
+				  XLogRecPtr stopptr)
+{
+	XLogReaderState *xlogreader_state;
+	XLogRecord *record;
+	XLogRecPtr	first_record;
+	char	   *errormsg;
+
+	xlogreader_state = XLogReaderAllocate(XLogDumpReadPage, private);
+	if (!xlogreader_state)
+		fatal_error("out of memory");
+
+#ifdef ADB
+	/* fix: Access to field 'ReadRecPtr' results in a dereference of
+	 * a null pointer (loaded from variable 'xlogreader_state')
+	 */
+	AssertArg(xlogreader_state);
+#endif
+
+	/* first find a valid recptr to start from */
+	first_record = XLogFindNextRecord(xlogreader_state, startptr);
+
+	if (first_record == InvalidXLogRecPtr)
+	{
+		if (stopptr != InvalidXLogRecPtr)
+		{
+			XLogReaderFree(xlogreader_state);
+			return;
+		}
+		fatal_error("could not find a valid record after %X/%X",
+					(uint32) (startptr >> 32),
+					(uint32) startptr);
+	}
+
+	/*
+	 * Display a message that we're skipping data if `from` wasn't a pointer
+	 * to the start of a record and also wasn't a pointer to the beginning of
+	 * a segment (e.g. we were used in file mode).
+	 */
+	if (stopptr == InvalidXLogRecPtr &&
+		first_record != startptr && (startptr % XLogSegSize) != 0)
+		printf("first record is after %X/%X, at %X/%X, skipping over %u bytes\n",
+			   (uint32) (startptr >> 32), (uint32) startptr,
+			   (uint32) (first_record >> 32), (uint32) first_record,
+			   (uint32) (first_record - startptr));
+
+	while ((record = XLogReadRecord(xlogreader_state, first_record, &errormsg)))
+	{
+		/* continue after the last record */
+		first_record = InvalidXLogRecPtr;
+
+		/* the records from here on are someone else's */
+		if (stopptr != InvalidXLogRecPtr &&
+			xlogreader_state->ReadRecPtr >= stopptr)
+			break;
+
+		if (config->filter_by_rmgr != -1 &&
+			config->filter_by_rmgr != record->xl_rmid)
+			continue;
+
+		if (config->filter_by_xid_enabled &&
+			config->filter_by_xid != record->xl_xid)
+			continue;
+
+		if (config->stats)
+			XLogDumpCountRecord(config, stats, record);
+		else
+			XLogDumpDisplayRecord(config, xlogreader_state->ReadRecPtr, record);
+
+		/* check whether we printed enough */
+		if (config->stop_after_records > 0 &&
+			config->already_displayed_records >= config->stop_after_records)
+			break;
+	}
+
+	if (!record && errormsg)
+		fatal_error("error in WAL record at %X/%X: %s\n",
+					(uint32) (xlogreader_state->ReadRecPtr >> 32),
+					(uint32) xlogreader_state->ReadRecPtr,
+					errormsg);
+
+	XLogReaderFree(xlogreader_state);
+}
+
+#ifndef WIN32
+static void
+write_all(int fd, const void *buf, Size len)
+{
+	const char *p = buf;
+
+	while (len > 0)
+	{
+		ssize_t		rc = write(fd, p, len);
+
+		if (rc < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			fatal_error("could not write statistics to parent: %s",
+						strerror(errno));
+		}
+		p += rc;
+		len -= rc;
+	}
+}
+
+static void
+read_all(int fd, void *buf, Size len)
+{
+	char	   *p = buf;
+
+	while (len > 0)
+	{
+		ssize_t		rc = read(fd, p, len);
+
+		if (rc < 0 && errno == EINTR)
+			continue;
+		if (rc <= 0)
+			fatal_error("could not read statistics from worker: %s",
+						rc < 0 ? strerror(errno) : "unexpected end of data");
+		p += rc;
+		len -= rc;
+	}
+}
+
+/*
+ * Count the records of the WAL between private->startptr and
+ * private->endptr with config->jobs worker processes, each reading the
+ * records starting in its share of the segment files.  A worker sends its
+ * statistics through a pipe, as the XLogDumpStats followed by its used
+ * relation entries.
+ */
+static void
+XLogDumpParallelStats(XLogDumpPrivate *private, XLogDumpConfig *config,
+					  XLogDumpStats *stats)
+{
+	XLogSegNo	firstseg;
+	XLogSegNo	lastseg;
+	uint64		nsegs;
+	pid_t	   *pids;
+	int		   *fds;
+	int			i;
+
+	XLByteToSeg(private->startptr, firstseg);
+	XLByteToPrevSeg(private->endptr, lastseg);
+	nsegs = lastseg - firstseg + 1;
+	if (config->jobs > nsegs)
+		config->jobs = (int) nsegs;
+
+	pids = pg_malloc(config->jobs * sizeof(pid_t));
+	fds = pg_malloc(config->jobs * sizeof(int));
+
+	/* flush, not to have the workers print what is buffered again */
+	fflush(stdout);
+	fflush(stderr);
+
+	for (i = 0; i < config->jobs; i++)
+	{
+		XLogRecPtr	startptr;
+		XLogRecPtr	stopptr;
+		int			pipefd[2];
+
+		if (i == 0)
+			startptr = private->startptr;
+		else
+			XLogSegNoOffsetToRecPtr(firstseg + nsegs * i / config->jobs, 0,
+									startptr);
+		if (i == config->jobs - 1)
+			stopptr = private->endptr;
+		else
+			XLogSegNoOffsetToRecPtr(firstseg + nsegs * (i + 1) / config->jobs, 0,
+									stopptr);
+
+		if (pipe(pipefd) < 0)
+			fatal_error("could not create pipe: %s", strerror(errno));
+
+		pids[i] = fork();
+		if (pids[i] < 0)
+			fatal_error("could not fork worker process: %s", strerror(errno));
+
+		if (pids[i] == 0)
+		{
+			XLogDumpStats mine;
+			int			j;
+
+			close(pipefd[0]);
+			MemSet(&mine, 0, sizeof(mine));
+			XLogDumpReadRange(private, config, &mine, startptr, stopptr);
+
+			write_all(pipefd[1], &mine, sizeof(mine));
+			for (j = 0; j < mine.maxrels; j++)
+			{
+				if (mine.rel_stats[j].node.relNode != InvalidOid)
+					write_all(pipefd[1], &mine.rel_stats[j],
+							  sizeof(XLogDumpRelStats));
+			}
+			close(pipefd[1]);
+			exit(EXIT_SUCCESS);
+		}
+
+		close(pipefd[1]);
+		fds[i] = pipefd[0];
+	}
+
+	for (i = 0; i < config->jobs; i++)
+	{
+		XLogDumpStats theirs;
+		int			status;
+
+		read_all(fds[i], &theirs, sizeof(theirs));
+		theirs.maxrels = theirs.nrels;
+		theirs.rel_stats = pg_malloc(theirs.nrels * sizeof(XLogDumpRelStats));
+		read_all(fds[i], theirs.rel_stats,
+				 theirs.nrels * sizeof(XLogDumpRelStats));
+		close(fds[i]);
+
+		XLogDumpMergeStats(stats, &theirs);
+		pg_free(theirs.rel_stats);
+
+		if (waitpid(pids[i], &status, 0) != pids[i])
+			fatal_error("could not wait for worker process: %s",
+						strerror(errno));
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			fatal_error("worker process failed");
+	}
+
+	pg_free(pids);
+	pg_free(fds);
+}
+#endif   /* !WIN32 */
+
 static void
 usage(void)
 {
@@ -390,6 +970,7 @@ usage(void)
 	printf("\nOptions:\n");
 	printf("  -b, --bkp-details      output detailed information about backup blocks\n");
 	printf("  -e, --end=RECPTR       stop reading at log position RECPTR\n");
+	printf("  -j, --jobs=NUM         use this many processes to compute statistics\n");
 #ifdef ADB
 	printf("  -N, --nodename=NAME    set current node's name for ADB\n");
 #endif
@@ -403,6 +984,8 @@ usage(void)
 	printf("                         (default: 1 or the value used in STARTSEG)\n");
 	printf("  -V, --version          output version information, then exit\n");
 	printf("  -x, --xid=XID          only show records with TransactionId XID\n");
+	printf("  -z, --stats[=record]   show statistics instead of records\n");
+	printf("                         (optionally, show per-record statistics)\n");
 	printf("  -?, --help             show this help, then exit\n");
 }
 
@@ -411,17 +994,15 @@ main(int argc, char **argv)
 {
 	uint32		xlogid;
 	uint32		xrecoff;
-	XLogReaderState *xlogreader_state;
 	XLogDumpPrivate private;
 	XLogDumpConfig config;
-	XLogRecord *record;
-	XLogRecPtr	first_record;
-	char	   *errormsg;
+	XLogDumpStats stats;
 
 	static struct option long_options[] = {
 		{"bkp-details", no_argument, NULL, 'b'},
 		{"end", required_argument, NULL, 'e'},
 		{"help", no_argument, NULL, '?'},
+		{"jobs", required_argument, NULL, 'j'},
 		{"limit", required_argument, NULL, 'n'},
 		{"path", required_argument, NULL, 'p'},
 		{"rmgr", required_argument, NULL, 'r'},
@@ -429,6 +1010,7 @@ main(int argc, char **argv)
 		{"timeline", required_argument, NULL, 't'},
 		{"xid", required_argument, NULL, 'x'},
 		{"version", no_argument, NULL, 'V'},
+		{"stats", optional_argument, NULL, 'z'},
 		{NULL, 0, NULL, 0}
 	};
 
@@ -439,6 +1021,7 @@ main(int argc, char **argv)
 
 	memset(&private, 0, sizeof(XLogDumpPrivate));
 	memset(&config, 0, sizeof(XLogDumpConfig));
+	memset(&stats, 0, sizeof(XLogDumpStats));
 
 	private.timeline = 1;
 	private.startptr = InvalidXLogRecPtr;
@@ -450,6 +1033,9 @@ main(int argc, char **argv)
 	config.filter_by_rmgr = -1;
 	config.filter_by_xid = InvalidTransactionId;
 	config.filter_by_xid_enabled = false;
+	config.stats = false;
+	config.stats_per_record = false;
+	config.jobs = 1;
 
 	if (argc <= 1)
 	{
@@ -458,10 +1044,10 @@ main(int argc, char **argv)
 	}
 
 #ifdef ADB
-	while ((option = getopt_long(argc, argv, "be:?N:n:p:r:s:t:Vx:",
+	while ((option = getopt_long(argc, argv, "be:?j:N:n:p:r:s:t:Vx:z",
 								 long_options, &optindex)) != -1)
 #else
-	while ((option = getopt_long(argc, argv, "be:?n:p:r:s:t:Vx:",
+	while ((option = getopt_long(argc, argv, "be:?j:n:p:r:s:t:Vx:z",
 								 long_options, &optindex)) != -1)
 #endif
 	{
@@ -483,6 +1069,14 @@ main(int argc, char **argv)
 				usage();
 				exit(EXIT_SUCCESS);
 				break;
+			case 'j':
+				if (sscanf(optarg, "%d", &config.jobs) != 1 || config.jobs <= 0)
+				{
+					fprintf(stderr, "%s: could not parse number of jobs \"%s\"\n",
+							progname, optarg);
+					goto bad_argument;
+				}
+				break;
 #ifdef ADB
 			case 'N':
 				nodename = pg_strdup(optarg);
@@ -562,6 +1156,21 @@ main(int argc, char **argv)
 				}
 				config.filter_by_xid_enabled = true;
 				break;
+			case 'z':
+				config.stats = true;
+				config.stats_per_record = false;
+				if (optarg)
+				{
+					if (strcmp(optarg, "record") == 0)
+						config.stats_per_record = true;
+					else if (strcmp(optarg, "rmgr") != 0)
+					{
+						fprintf(stderr, "%s: unrecognised argument to --stats: %s\n",
+								progname, optarg);
+						goto bad_argument;
+					}
+				}
+				break;
 			default:
 				goto bad_argument;
 		}
@@ -687,58 +1296,42 @@ main(int argc, char **argv)
 		goto bad_argument;
 	}
 
+	if (config.jobs > 1)
+	{
+		if (!config.stats)
+		{
+			fprintf(stderr, "%s: --jobs can only be used with --stats\n", progname);
+			goto bad_argument;
+		}
+		if (XLogRecPtrIsInvalid(private.endptr))
+		{
+			fprintf(stderr, "%s: --jobs needs an end log position or ENDSEG\n", progname);
+			goto bad_argument;
+		}
+		if (config.stop_after_records > 0)
+		{
+			fprintf(stderr, "%s: --jobs cannot be used with --limit\n", progname);
+			goto bad_argument;
+		}
+#ifdef WIN32
+		fprintf(stderr, "%s: --jobs is not supported on this platform\n", progname);
+		goto bad_argument;
+#endif
+	}
+
 	/* done with argument parsing, do the actual work */
 
 	/* we have everything we need, start reading */
-	xlogreader_state = XLogReaderAllocate(XLogDumpReadPage, &private);
-	if (!xlogreader_state)
-		fatal_error("out of memory");
-
-#ifdef ADB
-	/* fix: Access to field 'ReadRecPtr' results in a dereference of
-	 * a null pointer (loaded from variable 'xlogreader_state')
-	 */
-	AssertArg(xlogreader_state);
+#ifndef WIN32
+	if (config.jobs > 1)
+		XLogDumpParallelStats(&private, &config, &stats);
+	else
 #endif
+		XLogDumpReadRange(&private, &config, &stats, private.startptr,
+						  InvalidXLogRecPtr);
 
-	/* first find a valid recptr to start from */
-	first_record = XLogFindNextRecord(xlogreader_state, private.startptr);
-
-	if (first_record == InvalidXLogRecPtr)
-		fatal_error("could not find a valid record after %X/%X",
-					(uint32) (private.startptr >> 32),
-					(uint32) private.startptr);
-
-	/*
-	 * Display a message that we're skipping data if `from` wasn't a pointer
-	 * to the start of a record and also wasn't a pointer to the beginning of
-	 * a segment (e.g. we were used in file mode).
-	 */
-	if (first_record != private.startptr && (private.startptr % XLogSegSize) != 0)
-		printf("first record is after %X/%X, at %X/%X, skipping over %u bytes\n",
-			   (uint32) (private.startptr >> 32), (uint32) private.startptr,
-			   (uint32) (first_record >> 32), (uint32) first_record,
-			   (uint32) (first_record - private.startptr));
-
-	while ((record = XLogReadRecord(xlogreader_state, first_record, &errormsg)))
-	{
-		/* continue after the last record */
-		first_record = InvalidXLogRecPtr;
-		XLogDumpDisplayRecord(&config, xlogreader_state->ReadRecPtr, record);
-
-		/* check whether we printed enough */
-		if (config.stop_after_records > 0 &&
-			config.already_displayed_records >= config.stop_after_records)
-			break;
-	}
-
-	if (errormsg)
-		fatal_error("error in WAL record at %X/%X: %s\n",
-					(uint32) (xlogreader_state->ReadRecPtr >> 32),
-					(uint32) xlogreader_state->ReadRecPtr,
-					errormsg);
-
-	XLogReaderFree(xlogreader_state);
+	if (config.stats)
+		XLogDumpDisplayStats(&config, &stats);
 
 	return EXIT_SUCCESS;
 
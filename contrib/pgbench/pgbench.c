@@ -158,6 +158,10 @@ char	   *index_tablespace = NULL;
 #ifdef PGXC
 bool		use_branch = false;	/* use branch id in DDL and DML */
 #endif
+#ifdef ADB
+int			cluster_mode = 0;	/* --cluster: shard the tables, use all
+								 * Coordinators */
+#endif
 /*
  * The scale factor at/beyond which 32bit integers are incapable of storing
  * 64bit values.
@@ -214,6 +218,10 @@ typedef struct
 	instr_time	stmt_begin;		/* used for measuring statement latencies */
 	int			use_file;		/* index in sql_files for this client */
 	bool		prepared[MAX_FILES];
+#ifdef ADB
+	instr_time	txn_elapsed;	/* total latency of the transactions done */
+	instr_time	commit_elapsed; /* time of their commit commands */
+#endif
 } CState;
 
 /*
@@ -237,6 +245,10 @@ typedef struct
 {
 	instr_time	conn_time;
 	int			xacts;
+#ifdef ADB
+	instr_time	txn_time;		/* sums of CState.txn_elapsed and */
+	instr_time	commit_time;	/* CState.commit_elapsed of the clients */
+#endif
 } TResult;
 
 /*
@@ -264,6 +276,9 @@ typedef struct
 	int			type;			/* command type (SQL_COMMAND or META_COMMAND) */
 	int			argc;			/* number of command words */
 	char	   *argv[MAX_ARGS]; /* command word list */
+#ifdef ADB
+	bool		is_commit;		/* SQL COMMIT or END? */
+#endif
 } Command;
 
 typedef struct
@@ -289,6 +304,16 @@ static int	debug = 0;			/* debug flag */
 bool is_abort = true;
 int sleep_time = 1;
 #include "libpq-int.h"
+
+/* Coordinators of the cluster, the clients are spread over in --cluster */
+typedef struct
+{
+	char	   *host;
+	char	   *port;
+} CoordInfo;
+
+static CoordInfo *coords = NULL;
+static int	num_coords = 0;
 #endif
 
 
@@ -363,6 +388,42 @@ static char *simple_update_bid = {
 };
 #endif
 
+#ifdef ADB
+/* --single-shard case: everything on the Datanode of one account */
+static char *single_shard = {
+	"\\set nbranches " CppAsString2(nbranches) " * :scale\n"
+	"\\set ntellers " CppAsString2(ntellers) " * :scale\n"
+	"\\set naccounts " CppAsString2(naccounts) " * :scale\n"
+	"\\setrandom aid 1 :naccounts\n"
+	"\\setrandom bid 1 :nbranches\n"
+	"\\setrandom tid 1 :ntellers\n"
+	"\\setrandom delta -5000 5000\n"
+	"BEGIN;\n"
+	"UPDATE pgbench_accounts SET abalance = abalance + :delta WHERE aid = :aid;\n"
+	"SELECT abalance FROM pgbench_accounts WHERE aid = :aid;\n"
+	"INSERT INTO pgbench_history (tid, bid, aid, delta, mtime) VALUES (:tid, :bid, :aid, :delta, CURRENT_TIMESTAMP);\n"
+	"END;\n"
+};
+
+/* --cross-shard case: transfer between two accounts, usually two Datanodes */
+static char *cross_shard = {
+	"\\set nbranches " CppAsString2(nbranches) " * :scale\n"
+	"\\set ntellers " CppAsString2(ntellers) " * :scale\n"
+	"\\set naccounts " CppAsString2(naccounts) " * :scale\n"
+	"\\setrandom aid1 1 :naccounts\n"
+	"\\setrandom aid2 1 :naccounts\n"
+	"\\setrandom bid 1 :nbranches\n"
+	"\\setrandom tid 1 :ntellers\n"
+	"\\setrandom delta 1 5000\n"
+	"BEGIN;\n"
+	"UPDATE pgbench_accounts SET abalance = abalance - :delta WHERE aid = :aid1;\n"
+	"UPDATE pgbench_accounts SET abalance = abalance + :delta WHERE aid = :aid2;\n"
+	"INSERT INTO pgbench_history (tid, bid, aid, delta, mtime) VALUES (:tid, :bid, :aid1, 0 - :delta, CURRENT_TIMESTAMP);\n"
+	"INSERT INTO pgbench_history (tid, bid, aid, delta, mtime) VALUES (:tid, :bid, :aid2, :delta, CURRENT_TIMESTAMP);\n"
+	"END;\n"
+};
+#endif
+
 /* -S case */
 static char *select_only = {
 	"\\set naccounts " CppAsString2(naccounts) " * :scale\n"
@@ -373,6 +434,12 @@ static char *select_only = {
 /* Function prototypes */
 static void setalarm(int seconds);
 static void *threadRun(void *arg);
+static PGconn *doConnectHost(const char *host, const char *port);
+#ifdef ADB
+static void printClusterResults(int normal_xacts, instr_time txn_time,
+					instr_time commit_time, double agtm_calls,
+					double agtm_time);
+#endif
 
 static void
 usage(void)
@@ -389,6 +456,10 @@ usage(void)
 		   "  -n           do not run VACUUM after initialization\n"
 		   "  -q           quiet logging (one message each 5 seconds)\n"
 		   "  -s NUM       scaling factor\n"
+#ifdef ADB
+		   "  --cluster    distribute accounts and history by account, replicate\n"
+		   "               branches and tellers\n"
+#endif
 		   "  --foreign-keys\n"
 		   "               create foreign key constraints between tables\n"
 		   "  --index-tablespace=TABLESPACE\n"
@@ -420,8 +491,18 @@ usage(void)
 		   "  -v           vacuum all four standard tables before tests\n"
 		   "  --aggregate-interval=NUM\n"
 		   "               aggregate data over NUM seconds\n"
+#ifdef ADB
+		   "  --cluster    spread the clients over all Coordinators and report\n"
+		   "               where the latency goes\n"
+		   "  --cross-shard\n"
+		   "               perform transfers between two accounts\n"
+#endif
 		   "  --sampling-rate=NUM\n"
 		   "               fraction of transactions to log (e.g. 0.01 for 1%% sample)\n"
+#ifdef ADB
+		   "  --single-shard\n"
+		   "               perform transactions on a single account\n"
+#endif
 		   "\nCommon options:\n"
 		   "  -d             print debugging output\n"
 		   "  -h HOSTNAME    database server host or socket directory\n"
@@ -536,6 +617,13 @@ executeStatement(PGconn *con, const char *sql)
 /* set up a connection to the backend */
 static PGconn *
 doConnect(void)
+{
+	return doConnectHost(pghost, pgport);
+}
+
+/* set up a connection to the backend of the given host and port */
+static PGconn *
+doConnectHost(const char *host, const char *port)
 {
 	PGconn	   *conn;
 	static char *password = NULL;
@@ -553,9 +641,9 @@ doConnect(void)
 		const char *values[PARAMS_ARRAY_SIZE];
 
 		keywords[0] = "host";
-		values[0] = pghost;
+		values[0] = host;
 		keywords[1] = "port";
-		values[1] = pgport;
+		values[1] = port;
 		keywords[2] = "user";
 		values[2] = login;
 		keywords[3] = "password";
@@ -600,6 +688,112 @@ doConnect(void)
 	return conn;
 }
 
+/* connect a client, to its Coordinator in --cluster */
+static PGconn *
+clientConnect(CState *st)
+{
+#ifdef ADB
+	if (num_coords > 0)
+	{
+		CoordInfo  *coord = &coords[st->id % num_coords];
+
+		return doConnectHost(coord->host, coord->port);
+	}
+#endif
+	return doConnect();
+}
+
+#ifdef ADB
+/*
+ * Fetch the Coordinators of the cluster, for --cluster.  A Coordinator
+ * registered with a local host name is reached as the one given on the
+ * command line.
+ */
+static void
+getCoordinators(PGconn *con)
+{
+	PGresult   *res;
+	int			i;
+
+	res = PQexec(con, "select node_host, node_port from pgxc_node "
+				 "where node_type = 'C' order by node_name");
+	if (PQresultStatus(res) != PGRES_TUPLES_OK)
+	{
+		fprintf(stderr, "could not get the Coordinators of the cluster: %s",
+				PQerrorMessage(con));
+		exit(1);
+	}
+
+	num_coords = PQntuples(res);
+	coords = (CoordInfo *) pg_malloc(sizeof(CoordInfo) * (num_coords > 0 ? num_coords : 1));
+	for (i = 0; i < num_coords; i++)
+	{
+		const char *host = PQgetvalue(res, i, 0);
+
+		if (strcmp(host, "localhost") == 0 || strcmp(host, "127.0.0.1") == 0)
+			coords[i].host = pg_strdup(pghost);
+		else
+			coords[i].host = pg_strdup(host);
+		coords[i].port = pg_strdup(PQgetvalue(res, i, 1));
+	}
+	PQclear(res);
+
+	if (num_coords == 0)
+	{
+		fprintf(stderr, "no Coordinator found in pgxc_node\n");
+		exit(1);
+	}
+}
+
+/*
+ * Sum the AGTM round trips the Coordinators counted in
+ * pg_agtm_stat_messages, total_time in milliseconds
+ */
+static void
+getAgtmWaits(double *calls, double *total_time)
+{
+	int			i;
+
+	*calls = 0;
+	*total_time = 0;
+	for (i = 0; i < num_coords; i++)
+	{
+		PGconn	   *con;
+		PGresult   *res;
+
+		if ((con = doConnectHost(coords[i].host, coords[i].port)) == NULL)
+			exit(1);
+		res = PQexec(con, "select coalesce(sum(calls), 0), coalesce(sum(total_time), 0) "
+					 "from pg_agtm_stat_messages");
+		if (PQresultStatus(res) != PGRES_TUPLES_OK)
+		{
+			fprintf(stderr, "%s", PQerrorMessage(con));
+			exit(1);
+		}
+		*calls += atof(PQgetvalue(res, 0, 0));
+		*total_time += atof(PQgetvalue(res, 0, 1));
+		PQclear(res);
+		PQfinish(con);
+	}
+}
+
+/* true when "sql" is a COMMIT or END command */
+static bool
+isCommitCommand(const char *sql)
+{
+	int			len;
+
+	if (pg_strncasecmp(sql, "commit", 6) == 0)
+		len = 6;
+	else if (pg_strncasecmp(sql, "end", 3) == 0)
+		len = 3;
+	else
+		return false;
+
+	return sql[len] == '\0' || sql[len] == ';' || isspace((unsigned char) sql[len]);
+}
+#endif
+
 /* throw away response from backend */
 static void
 discard_response(CState *state)
@@ -989,7 +1183,7 @@ top:
 					while (trytimes < 3)
 					{
 						trytimes++;
-						if ((st->con = doConnect()) == NULL)
+						if ((st->con = clientConnect(st)) == NULL)
 						{							
 							//sleep 1 s
 							sleep(sleep_time);
@@ -1031,6 +1225,20 @@ top:
 			thread->exec_count[cnum]++;
 		}
 
+#ifdef ADB
+		/* in --cluster, split the latency of transactions at commit */
+		if (cluster_mode)
+		{
+			instr_time	now;
+
+			INSTR_TIME_SET_CURRENT(now);
+			if (commands[st->state]->is_commit)
+				INSTR_TIME_ACCUM_DIFF(st->commit_elapsed, now, st->stmt_begin);
+			if (commands[st->state + 1] == NULL)
+				INSTR_TIME_ACCUM_DIFF(st->txn_elapsed, now, st->txn_begin);
+		}
+#endif
+
 		/*
 		 * if transaction finished, record the time it took in the log
 		 */
@@ -1182,7 +1390,7 @@ top:
 						while (trytimes < 3)
 						{
 							trytimes++;
-							if ((st->con = doConnect()) == NULL)
+							if ((st->con = clientConnect(st)) == NULL)
 							{
 								//sleep 1 s
 								sleep(sleep_time);
@@ -1245,7 +1453,7 @@ top:
 					end;
 
 		INSTR_TIME_SET_CURRENT(start);
-		if ((st->con = doConnect()) == NULL)
+		if ((st->con = clientConnect(st)) == NULL)
 		{
 			fprintf(stderr, "Client %d aborted in establishing connection.\n", st->id);
 			#ifdef ADB
@@ -1256,7 +1464,7 @@ top:
 				while (trytimes < 3)
 				{
 					trytimes++;
-					if ((st->con = doConnect()) == NULL)
+					if ((st->con = clientConnect(st)) == NULL)
 					{
 						//sleep 1 s
 						sleep(sleep_time);
@@ -1287,6 +1495,17 @@ top:
 		memset(st->prepared, 0, sizeof(st->prepared));
 	}
 
+#ifdef ADB
+	/* --cluster needs both times below */
+	if (cluster_mode)
+	{
+		if (st->state == 0)
+			INSTR_TIME_SET_CURRENT(st->txn_begin);
+		INSTR_TIME_SET_CURRENT(st->stmt_begin);
+	}
+	else
+	{
+#endif
 	/* Record transaction start time if logging is enabled */
 	if (logfile && st->state == 0)
 		INSTR_TIME_SET_CURRENT(st->txn_begin);
@@ -1294,6 +1513,9 @@ top:
 	/* Record statement start time if per-command latencies are requested */
 	if (is_latencies)
 		INSTR_TIME_SET_CURRENT(st->stmt_begin);
+#ifdef ADB
+	}
+#endif
 
 	if (commands[st->state]->type == SQL_COMMAND)
 	{
@@ -1668,6 +1890,9 @@ init(bool is_no_vacuum)
 		int			declare_fillfactor;
 #ifdef PGXC
 		char	   *distribute_by;
+#endif
+#ifdef ADB
+		char	   *cluster_distribute_by;	/* for --cluster */
 #endif
 	};
 	static const struct ddlinfo DDLs[] = {
@@ -1678,6 +1903,9 @@ init(bool is_no_vacuum)
 			0
 #ifdef PGXC
 			, "distribute by hash (bid)"
+#endif
+#ifdef ADB
+			, "distribute by hash (aid)"
 #endif
 		},
 		{
@@ -1687,6 +1915,9 @@ init(bool is_no_vacuum)
 			1
 #ifdef PGXC
 			, "distribute by hash (bid)"
+#endif
+#ifdef ADB
+			, "distribute by replication"
 #endif
 		},
 		{
@@ -1696,6 +1927,9 @@ init(bool is_no_vacuum)
 			1
 #ifdef PGXC
 			, "distribute by hash (bid)"
+#endif
+#ifdef ADB
+			, "distribute by hash (aid)"
 #endif
 		},
 		{
@@ -1705,6 +1939,9 @@ init(bool is_no_vacuum)
 			1
 #ifdef PGXC
 			, "distribute by hash (bid)"
+#endif
+#ifdef ADB
+			, "distribute by replication"
 #endif
 		}
 	};
@@ -1774,6 +2011,13 @@ init(bool is_no_vacuum)
 
 		cols = (scale >= SCALE_32BIT_THRESHOLD) ? ddl->bigcols : ddl->smcols;
 
+#ifdef ADB
+		if (cluster_mode)
+			snprintf(buffer, 256, "create%s table %s(%s)%s %s",
+					 unlogged_tables ? " unlogged" : "",
+					 ddl->table, cols, opts, ddl->cluster_distribute_by);
+		else
+#endif
 #ifdef PGXC
 		/* Add distribution columns if necessary */
 		if (use_branch)
@@ -2047,6 +2291,9 @@ process_commands(char *buf)
 	my_commands->command_num = num_commands++;
 	my_commands->type = 0;		/* until set */
 	my_commands->argc = 0;
+#ifdef ADB
+	my_commands->is_commit = false;
+#endif
 
 	if (*p == '\\')
 	{
@@ -2155,6 +2402,9 @@ process_commands(char *buf)
 	else
 	{
 		my_commands->type = SQL_COMMAND;
+#ifdef ADB
+		my_commands->is_commit = isCommitCommand(p);
+#endif
 
 		switch (querymode)
 		{
@@ -2305,6 +2555,12 @@ printResults(int ttype, int normal_xacts, int nclients,
 		s = "Update only pgbench_accounts";
 	else if (ttype == 1)
 		s = "SELECT only";
+#ifdef ADB
+	else if (ttype == 4)
+		s = "Single-shard update of pgbench_accounts";
+	else if (ttype == 5)
+		s = "Cross-shard transfer between pgbench_accounts";
+#endif
 	else
 		s = "Custom query";
 
@@ -2374,6 +2630,35 @@ printResults(int ttype, int normal_xacts, int nclients,
 	}
 }
 
+#ifdef ADB
+/*
+ * print out where the latency of transactions goes, for --cluster: the
+ * commit, two-phase when the transaction wrote on several Datanodes, the
+ * other commands, and the waits for AGTM the Coordinators counted during
+ * the run, which are part of both.
+ */
+static void
+printClusterResults(int normal_xacts, instr_time txn_time,
+					instr_time commit_time, double agtm_calls,
+					double agtm_time)
+{
+	double		txn_ms,
+				commit_ms;
+
+	printf("number of coordinators: %d\n", num_coords);
+	if (normal_xacts <= 0)
+		return;
+
+	txn_ms = INSTR_TIME_GET_MILLISEC(txn_time) / normal_xacts;
+	commit_ms = INSTR_TIME_GET_MILLISEC(commit_time) / normal_xacts;
+
+	printf("latency average: %.3f ms\n", txn_ms);
+	printf("  execution: %.3f ms\n", txn_ms - commit_ms);
+	printf("  commit (2PC when several datanodes written): %.3f ms\n", commit_ms);
+	printf("  AGTM wait: %.3f ms (%.1f requests per transaction)\n",
+		   agtm_time / normal_xacts, agtm_calls / normal_xacts);
+}
+#endif
 
 int
 main(int argc, char **argv)
@@ -2385,6 +2670,11 @@ main(int argc, char **argv)
 		{"unlogged-tables", no_argument, &unlogged_tables, 1},
 		{"sampling-rate", required_argument, NULL, 4},
 		{"aggregate-interval", required_argument, NULL, 5},
+#ifdef ADB
+		{"cluster", no_argument, &cluster_mode, 1},
+		{"single-shard", no_argument, NULL, 6},
+		{"cross-shard", no_argument, NULL, 7},
+#endif
 		{NULL, 0, NULL, 0}
 	};
 
@@ -2395,7 +2685,8 @@ main(int argc, char **argv)
 	int			is_no_vacuum = 0;		/* no vacuum at all before testing? */
 	int			do_vacuum_accounts = 0; /* do vacuum accounts before testing? */
 	int			ttype = 0;		/* transaction type. 0: TPC-B, 1: SELECT only,
-								 * 2: skip update of branches and tellers */
+								 * 2: skip update of branches and tellers,
+								 * 3: custom, 4: single shard, 5: cross shard */
 	int			optindex;
 	char	   *filename = NULL;
 	bool		scale_given = false;
@@ -2407,6 +2698,12 @@ main(int argc, char **argv)
 	instr_time	total_time;
 	instr_time	conn_total_time;
 	int			total_xacts;
+#ifdef ADB
+	instr_time	total_txn_time;
+	instr_time	total_commit_time;
+	double		agtm_calls = 0;
+	double		agtm_time = 0;
+#endif
 
 	int			i;
 
@@ -2654,6 +2951,14 @@ main(int argc, char **argv)
 					exit(1);
 				}
 				break;
+#ifdef ADB
+			case 6:				/* single-shard */
+				ttype = 4;
+				break;
+			case 7:				/* cross-shard */
+				ttype = 5;
+				break;
+#endif
 			case 5:
 #ifdef WIN32
 				fprintf(stderr, "--aggregate-interval is not currently supported on Windows");
@@ -2860,6 +3165,15 @@ main(int argc, char **argv)
 			fprintf(stderr, "end.\n");
 		}
 	}
+#ifdef ADB
+	if (cluster_mode)
+	{
+		getCoordinators(con);
+		if (debug)
+			printf("spreading %d clients over %d Coordinators\n",
+				   nclients, num_coords);
+	}
+#endif
 	PQfinish(con);
 
 	/* set random seed */
@@ -2894,6 +3208,18 @@ main(int argc, char **argv)
 			num_files = 1;
 			break;
 
+#ifdef ADB
+		case 4:
+			sql_files[0] = process_builtin(single_shard);
+			num_files = 1;
+			break;
+
+		case 5:
+			sql_files[0] = process_builtin(cross_shard);
+			num_files = 1;
+			break;
+#endif
+
 		default:
 			break;
 	}
@@ -2934,6 +3260,12 @@ main(int argc, char **argv)
 		}
 	}
 
+#ifdef ADB
+	/* AGTM waits of the Coordinators before the run */
+	if (cluster_mode)
+		getAgtmWaits(&agtm_calls, &agtm_time);
+#endif
+
 	/* get start up time */
 	INSTR_TIME_SET_CURRENT(start_time);
 
@@ -2968,6 +3300,10 @@ main(int argc, char **argv)
 	/* wait for threads and accumulate results */
 	total_xacts = 0;
 	INSTR_TIME_SET_ZERO(conn_total_time);
+#ifdef ADB
+	INSTR_TIME_SET_ZERO(total_txn_time);
+	INSTR_TIME_SET_ZERO(total_commit_time);
+#endif
 	for (i = 0; i < nthreads; i++)
 	{
 		void	   *ret = NULL;
@@ -2983,6 +3319,10 @@ main(int argc, char **argv)
 
 			total_xacts += r->xacts;
 			INSTR_TIME_ADD(conn_total_time, r->conn_time);
+#ifdef ADB
+			INSTR_TIME_ADD(total_txn_time, r->txn_time);
+			INSTR_TIME_ADD(total_commit_time, r->commit_time);
+#endif
 			free(ret);
 		}
 	}
@@ -2993,6 +3333,17 @@ main(int argc, char **argv)
 	INSTR_TIME_SUBTRACT(total_time, start_time);
 	printResults(ttype, total_xacts, nclients, threads, nthreads,
 				 total_time, conn_total_time);
+#ifdef ADB
+	if (cluster_mode)
+	{
+		double		calls,
+					msec;
+
+		getAgtmWaits(&calls, &msec);
+		printClusterResults(total_xacts, total_txn_time, total_commit_time,
+							calls - agtm_calls, msec - agtm_time);
+	}
+#endif
 
 	return 0;
 }
@@ -3015,6 +3366,10 @@ threadRun(void *arg)
 	result = pg_malloc(sizeof(TResult));
 
 	INSTR_TIME_SET_ZERO(result->conn_time);
+#ifdef ADB
+	INSTR_TIME_SET_ZERO(result->txn_time);
+	INSTR_TIME_SET_ZERO(result->commit_time);
+#endif
 
 	/* open log file if requested */
 	if (use_log)
@@ -3042,7 +3397,7 @@ threadRun(void *arg)
 		/* make connections to the database */
 		for (i = 0; i < nstate; i++)
 		{
-			if ((state[i].con = doConnect()) == NULL)
+			if ((state[i].con = clientConnect(&state[i])) == NULL)
 				{
 					#ifdef ADB
 					//retry three times
@@ -3052,7 +3407,7 @@ threadRun(void *arg)
 						while (trytimes < 3)
 						{
 							trytimes++;
-							if ((state[i].con = doConnect()) == NULL)
+							if ((state[i].con = clientConnect(&state[i])) == NULL)
 							{								
 								//sleep 1 s
 								sleep(sleep_time);
@@ -3163,7 +3518,7 @@ threadRun(void *arg)
 					while (trytimes < 3 )
 					{	
 						trytimes++;
-						if ((st->con = doConnect()) == NULL || (sock = PQsocket(st->con)) < 0)
+						if ((st->con = clientConnect(st)) == NULL || (sock = PQsocket(st->con)) < 0)
 						{							
 							//sleep 1 s
 							sleep(sleep_time);
@@ -3277,7 +3632,13 @@ done:
 	disconnect_all(state, nstate);
 	result->xacts = 0;
 	for (i = 0; i < nstate; i++)
+	{
 		result->xacts += state[i].cnt;
+#ifdef ADB
+		INSTR_TIME_ADD(result->txn_time, state[i].txn_elapsed);
+		INSTR_TIME_ADD(result->commit_time, state[i].commit_elapsed);
+#endif
+	}
 	INSTR_TIME_SET_CURRENT(end);
 	INSTR_TIME_ACCUM_DIFF(result->conn_time, end, start);
 	if (logfile)
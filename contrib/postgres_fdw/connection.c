@@ -49,6 +49,8 @@ typedef struct ConnCacheEntry
 								 * one level of subxact open, etc */
 	bool		have_prep_stmt; /* have we prepared any stmts in this xact? */
 	bool		have_error;		/* have any subxacts aborted in this xact? */
+	struct PgFdwScanState *pending_scan;	/* scan whose FETCH result is
+											 * pending, or NULL */
 } ConnCacheEntry;
 
 /*
@@ -68,6 +70,7 @@ static PGconn *connect_pg_server(ForeignServer *server, UserMapping *user);
 static void check_conn_params(const char **keywords, const char **values);
 static void configure_remote_session(PGconn *conn);
 static void do_sql_command(PGconn *conn, const char *sql);
+static ConnCacheEntry *find_conn_entry(PGconn *conn);
 static void begin_remote_xact(ConnCacheEntry *entry);
 static void pgfdw_xact_callback(XactEvent event, void *arg);
 static void pgfdw_subxact_callback(SubXactEvent event,
@@ -142,6 +145,7 @@ GetConnection(ForeignServer *server, UserMapping *user,
 		entry->xact_depth = 0;
 		entry->have_prep_stmt = false;
 		entry->have_error = false;
+		entry->pending_scan = NULL;
 	}
 
 	/*
@@ -160,6 +164,7 @@ GetConnection(ForeignServer *server, UserMapping *user,
 		entry->xact_depth = 0;	/* just to be sure */
 		entry->have_prep_stmt = false;
 		entry->have_error = false;
+		entry->pending_scan = NULL;
 		entry->conn = connect_pg_server(server, user);
 		elog(DEBUG3, "new postgres_fdw connection %p for server \"%s\"",
 			 entry->conn, server->servername);
@@ -353,6 +358,7 @@ do_sql_command(PGconn *conn, const char *sql)
 {
 	PGresult   *res;
 
+	AbsorbPendingScan(conn);
 	res = PQexec(conn, sql);
 	if (PQresultStatus(res) != PGRES_COMMAND_OK)
 		pgfdw_report_error(ERROR, res, conn, true, sql);
@@ -449,6 +455,50 @@ GetPrepStmtNumber(PGconn *conn)
 	return ++prep_stmt_number;
 }
 
+/*
+ * Find the cache entry of an open connection.
+ */
+static ConnCacheEntry *
+find_conn_entry(PGconn *conn)
+{
+	HASH_SEQ_STATUS scan;
+	ConnCacheEntry *entry;
+
+	hash_seq_init(&scan, ConnectionHash);
+	while ((entry = (ConnCacheEntry *) hash_seq_search(&scan)))
+	{
+		if (entry->conn == conn)
+		{
+			hash_seq_term(&scan);
+			return entry;
+		}
+	}
+
+	elog(ERROR, "could not find postgres_fdw connection %p", conn);
+	return NULL;				/* keep compiler quiet */
+}
+
+/*
+ * Remember the scan whose FETCH is in progress on the connection, NULL once
+ * its result has been read.
+ *
+ * Only one command can be in progress on a connection, so a scan about to
+ * send anything on it must first read the pending result, see
+ * AbsorbPendingScan.  The remembered scan is forgotten when a transaction
+ * or subtransaction aborts, its result being then discarded.
+ */
+void
+SetPendingScan(PGconn *conn, struct PgFdwScanState *fsstate)
+{
+	find_conn_entry(conn)->pending_scan = fsstate;
+}
+
+struct PgFdwScanState *
+GetPendingScan(PGconn *conn)
+{
+	return find_conn_entry(conn)->pending_scan;
+}
+
 /*
  * Report an error we got from the remote server.
  *
@@ -539,6 +589,9 @@ pgfdw_xact_callback(XactEvent event, void *arg)
 		if (entry->conn == NULL)
 			continue;
 
+		/* Every scan is over, PQexec discards a result left pending */
+		entry->pending_scan = NULL;
+
 		/* If it has an open remote transaction, try to close it */
 		if (entry->xact_depth > 0)
 		{
@@ -698,7 +751,12 @@ pgfdw_subxact_callback(SubXactEvent event, SubTransactionId mySubid,
 		{
 			/* Assume we might have lost track of prepared statements */
 			entry->have_error = true;
-			/* Rollback all remote subtransactions during abort */
+			/*
+			 * Rollback all remote subtransactions during abort.  The scan
+			 * of a FETCH still pending may be gone, so PQexec just discards
+			 * its result.
+			 */
+			entry->pending_scan = NULL;
 			snprintf(sql, sizeof(sql),
 					 "ROLLBACK TO SAVEPOINT s%d; RELEASE SAVEPOINT s%d",
 					 curlevel, curlevel);
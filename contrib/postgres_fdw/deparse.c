@@ -37,6 +37,7 @@
 
 #include "access/heapam.h"
 #include "access/htup_details.h"
+#include "access/skey.h"
 #include "access/sysattr.h"
 #include "access/transam.h"
 #include "catalog/pg_collation.h"
@@ -861,18 +862,73 @@ appendWhereClause(StringInfo buf,
 	reset_transmission_modes(nestlevel);
 }
 
+/*
+ * Deparse an ORDER BY clause sorting the rows of baserel by the given
+ * pathkeys, and append it to buf.
+ *
+ * Each pathkey must have a member expression computable from baserel alone
+ * and safe to send, as checked by the caller.
+ */
+void
+appendOrderByClause(StringInfo buf,
+					PlannerInfo *root,
+					RelOptInfo *baserel,
+					List *pathkeys)
+{
+	deparse_expr_cxt context;
+	int			nestlevel;
+	ListCell   *lc;
+	const char *delim = " ";
+
+	/* Set up context struct for recursion */
+	context.root = root;
+	context.foreignrel = baserel;
+	context.buf = buf;
+	context.params_list = NULL;
+
+	/* Make sure any constants in the exprs are printed portably */
+	nestlevel = set_transmission_modes();
+
+	appendStringInfoString(buf, " ORDER BY");
+	foreach(lc, pathkeys)
+	{
+		PathKey    *pathkey = (PathKey *) lfirst(lc);
+		Expr	   *em_expr;
+
+		em_expr = find_em_expr_for_rel(pathkey->pk_eclass, baserel);
+		Assert(em_expr != NULL);
+
+		appendStringInfoString(buf, delim);
+		deparseExpr(em_expr, &context);
+		if (pathkey->pk_strategy == BTLessStrategyNumber)
+			appendStringInfoString(buf, " ASC");
+		else
+			appendStringInfoString(buf, " DESC");
+
+		if (pathkey->pk_nulls_first)
+			appendStringInfoString(buf, " NULLS FIRST");
+		else
+			appendStringInfoString(buf, " NULLS LAST");
+
+		delim = ", ";
+	}
+
+	reset_transmission_modes(nestlevel);
+}
+
 /*
  * deparse remote INSERT statement
  *
  * The statement text is appended to buf, and we also create an integer List
  * of the columns being retrieved by RETURNING (if any), which is returned
- * to *retrieved_attrs.
+ * to *retrieved_attrs.  *values_end_len is set to the length of the text up
+ * to the end of the VALUES row, for rebuildInsertSql.
  */
 void
 deparseInsertSql(StringInfo buf, PlannerInfo *root,
 				 Index rtindex, Relation rel,
 				 List *targetAttrs, List *returningList,
-				 List **retrieved_attrs)
+				 List **retrieved_attrs, int *values_end_len)
 {
 	AttrNumber	pindex;
 	bool		first;
@@ -915,6 +971,7 @@ deparseInsertSql(StringInfo buf, PlannerInfo *root,
 	}
 	else
 		appendStringInfoString(buf, " DEFAULT VALUES");
+	*values_end_len = buf->len;
 
 	if (returningList)
 		deparseReturningList(buf, root, rtindex, rel, returningList,
@@ -923,6 +980,44 @@ deparseInsertSql(StringInfo buf, PlannerInfo *root,
 		*retrieved_attrs = NIL;
 }
 
+/*
+ * rebuild remote INSERT statement for a batch of rows
+ *
+ * Append to buf the INSERT statement orig_query built by deparseInsertSql,
+ * with num_rows rows of num_cols parameters in its VALUES list instead of
+ * one.  The parameters of the row i (counting from 0) are $(i * num_cols + 1)
+ * and up.
+ */
+void
+rebuildInsertSql(StringInfo buf, const char *orig_query,
+				 int values_end_len, int num_cols, int num_rows)
+{
+	int			pindex = num_cols + 1;
+	int			i;
+	int			j;
+
+	Assert(num_cols > 0 && num_rows > 0);
+
+	/* the statement up to the end of the first row */
+	appendBinaryStringInfo(buf, orig_query, values_end_len);
+
+	for (i = 1; i < num_rows; i++)
+	{
+		appendStringInfoString(buf, ", (");
+		for (j = 0; j < num_cols; j++)
+		{
+			if (j > 0)
+				appendStringInfoString(buf, ", ");
+			appendStringInfo(buf, "$%d", pindex);
+			pindex++;
+		}
+		appendStringInfoChar(buf, ')');
+	}
+
+	/* and whatever followed the VALUES list */
+	appendStringInfoString(buf, orig_query + values_end_len);
+}
+
 /*
  * deparse remote UPDATE statement
  *
@@ -16,6 +16,7 @@
 
 #include "access/htup_details.h"
 #include "access/sysattr.h"
+#include "catalog/pg_am.h"
 #include "commands/defrem.h"
 #include "commands/explain.h"
 #include "commands/vacuum.h"
@@ -46,6 +47,15 @@ PG_MODULE_MAGIC;
 /* Default CPU cost to process 1 row (above and beyond cpu_tuple_cost). */
 #define DEFAULT_FDW_TUPLE_COST		0.01
 
+/* If no remote estimates, assume a sort costs 20% extra */
+#define DEFAULT_FDW_SORT_MULTIPLIER 1.2
+
+/* Most parameters the protocol allows in a statement, see fe-exec.c */
+#define MAX_QUERY_PARAMS			65535
+
+/* Rows asked for by each FETCH of a scan; arbitrary, but not enormous */
+#define PGFDW_FETCH_SIZE			100
+
 /*
  * FDW-specific planner information kept in RelOptInfo.fdw_private for a
  * foreign table.  This information is collected by postgresGetForeignRelSize.
@@ -110,6 +120,8 @@ enum FdwScanPrivateIndex
  *	  (NIL for a DELETE)
  * 3) Boolean flag showing if there's a RETURNING clause
  * 4) Integer list of attribute numbers retrieved by RETURNING, if any
+ * 5) Length of the INSERT text up to the end of its VALUES row (-1 for an
+ *	  UPDATE or DELETE)
  */
 enum FdwModifyPrivateIndex
 {
@@ -120,7 +132,9 @@ enum FdwModifyPrivateIndex
 	/* has-returning flag (as an integer Value node) */
 	FdwModifyPrivateHasReturning,
 	/* Integer list of attribute numbers retrieved by RETURNING */
-	FdwModifyPrivateRetrievedAttrs
+	FdwModifyPrivateRetrievedAttrs,
+	/* Length of the INSERT up to the end of VALUES (as an integer Value) */
+	FdwModifyPrivateValuesEnd
 };
 
 /*
@@ -153,6 +167,10 @@ typedef struct PgFdwScanState
 	int			fetch_ct_2;		/* Min(# of fetches done, 2) */
 	bool		eof_reached;	/* true if last fetch reached EOF */
 
+	/* for asynchronous execution, see postgresForeignAsyncRequest */
+	bool		async_capable;	/* may run asynchronously under an Append? */
+	bool		fetch_pending;	/* FETCH sent, its result not read yet? */
+
 	/* working memory contexts */
 	MemoryContext batch_cxt;	/* context holding current batch of tuples */
 	MemoryContext temp_cxt;		/* context for per-tuple temporary data */
@@ -181,7 +199,15 @@ typedef struct PgFdwModifyState
 	int			p_nums;			/* number of parameters to transmit */
 	FmgrInfo   *p_flinfo;		/* output conversion functions for them */
 
-	/* working memory context */
+	/* for INSERTs sending several rows at once */
+	char	   *orig_query;		/* query for one row, when batching */
+	int			values_end;		/* end of its VALUES row */
+	int			batch_size;		/* rows per INSERT, 1 if not batching */
+	int			num_rows;		/* # of rows buffered so far */
+	const char **batch_values;	/* their parameters, p_nums per row */
+
+	/* working memory contexts */
+	MemoryContext batch_cxt;	/* context holding the buffered parameters */
 	MemoryContext temp_cxt;		/* context for per-tuple temporary data */
 } PgFdwModifyState;
 
@@ -278,6 +304,9 @@ static TupleTableSlot *postgresExecForeignDelete(EState *estate,
 static void postgresEndForeignModify(EState *estate,
 						 ResultRelInfo *resultRelInfo);
 static int	postgresIsForeignRelUpdatable(Relation rel);
+static bool postgresIsForeignScanAsyncCapable(ForeignScanState *node);
+static bool postgresForeignAsyncRequest(ForeignScanState *node,
+							pgsocket *sock);
 static void postgresExplainForeignScan(ForeignScanState *node,
 						   ExplainState *es);
 static void postgresExplainForeignModify(ModifyTableState *mtstate,
@@ -295,6 +324,7 @@ static bool postgresAnalyzeForeignTable(Relation relation,
 static void estimate_path_cost_size(PlannerInfo *root,
 						RelOptInfo *baserel,
 						List *join_conds,
+						List *pathkeys,
 						double *p_rows, int *p_width,
 						Cost *p_startup_cost, Cost *p_total_cost);
 static void get_remote_estimate(const char *sql,
@@ -303,13 +333,23 @@ static void get_remote_estimate(const char *sql,
 					int *width,
 					Cost *startup_cost,
 					Cost *total_cost);
+static bool pathkeys_are_foreign(PlannerInfo *root, RelOptInfo *baserel,
+					 List *pathkeys);
+static bool limit_is_foreign(PlannerInfo *root, RelOptInfo *baserel,
+				 ForeignPath *best_path, List *local_exprs);
 static bool ec_member_matches_foreign(PlannerInfo *root, RelOptInfo *rel,
 						  EquivalenceClass *ec, EquivalenceMember *em,
 						  void *arg);
 static void create_cursor(ForeignScanState *node);
 static void fetch_more_data(ForeignScanState *node);
+static void send_fetch_request(PgFdwScanState *fsstate);
+static void read_fetch_result(PgFdwScanState *fsstate);
 static void close_cursor(PGconn *conn, unsigned int cursor_number);
+static int	get_batch_size_option(ForeignTable *table, ForeignServer *server);
 static void prepare_foreign_modify(PgFdwModifyState *fmstate);
+static void buffer_insert_values(PgFdwModifyState *fmstate,
+					 TupleTableSlot *slot);
+static void execute_batch_insert(PgFdwModifyState *fmstate);
 static const char **convert_prep_stmt_params(PgFdwModifyState *fmstate,
 						 ItemPointer tupleid,
 						 TupleTableSlot *slot);
@@ -365,6 +405,10 @@ postgres_fdw_handler(PG_FUNCTION_ARGS)
 	/* Support functions for ANALYZE */
 	routine->AnalyzeForeignTable = postgresAnalyzeForeignTable;
 
+	/* Support functions for asynchronous execution */
+	routine->IsForeignScanAsyncCapable = postgresIsForeignScanAsyncCapable;
+	routine->ForeignAsyncRequest = postgresForeignAsyncRequest;
+
 	PG_RETURN_POINTER(routine);
 }
 
@@ -493,7 +537,7 @@ postgresGetForeignRelSize(PlannerInfo *root,
 		 * values in fpinfo so we don't need to do it again to generate the
 		 * basic foreign path.
 		 */
-		estimate_path_cost_size(root, baserel, NIL,
+		estimate_path_cost_size(root, baserel, NIL, NIL,
 								&fpinfo->rows, &fpinfo->width,
 								&fpinfo->startup_cost, &fpinfo->total_cost);
 
@@ -523,7 +567,7 @@ postgresGetForeignRelSize(PlannerInfo *root,
 		set_baserel_size_estimates(root, baserel);
 
 		/* Fill in basically-bogus cost estimates for use later. */
-		estimate_path_cost_size(root, baserel, NIL,
+		estimate_path_cost_size(root, baserel, NIL, NIL,
 								&fpinfo->rows, &fpinfo->width,
 								&fpinfo->startup_cost, &fpinfo->total_cost);
 	}
@@ -559,6 +603,32 @@ postgresGetForeignPaths(PlannerInfo *root,
 								   NIL);		/* no fdw_private list */
 	add_path(baserel, (Path *) path);
 
+	/*
+	 * If the query wants its rows in an order the remote server can produce,
+	 * add a path asking for that order, so that the planner can save a local
+	 * Sort (and, under a LIMIT, fetch only the first rows).
+	 */
+	if (pathkeys_are_foreign(root, baserel, root->query_pathkeys))
+	{
+		double		rows;
+		int			width;
+		Cost		startup_cost;
+		Cost		total_cost;
+
+		estimate_path_cost_size(root, baserel, NIL, root->query_pathkeys,
+								&rows, &width,
+								&startup_cost, &total_cost);
+
+		path = create_foreignscan_path(root, baserel,
+									   rows,
+									   startup_cost,
+									   total_cost,
+									   root->query_pathkeys,
+									   NULL,
+									   NIL);
+		add_path(baserel, (Path *) path);
+	}
+
 	/*
 	 * If we're not using remote estimates, stop here.  We have no way to
 	 * estimate whether any join clauses would be worth sending across, so
@@ -706,7 +776,7 @@ postgresGetForeignPaths(PlannerInfo *root,
 
 		/* Get a cost estimate from the remote */
 		estimate_path_cost_size(root, baserel,
-								param_info->ppi_clauses,
+								param_info->ppi_clauses, NIL,
 								&rows, &width,
 								&startup_cost, &total_cost);
 
@@ -800,6 +870,19 @@ postgresGetForeignPlan(PlannerInfo *root,
 		appendWhereClause(&sql, root, baserel, remote_conds,
 						  true, &params_list);
 
+	/* Add ORDER BY if the path is the sorted one */
+	if (best_path->path.pathkeys != NIL)
+		appendOrderByClause(&sql, root, baserel, best_path->path.pathkeys);
+
+	/*
+	 * Add LIMIT if the scan is all the query reads and nothing local can
+	 * throw rows away: the remote server then stops after the rows the
+	 * Limit node will ask for, offset included.
+	 */
+	if (limit_is_foreign(root, baserel, best_path, local_exprs))
+		appendStringInfo(&sql, " LIMIT " INT64_FORMAT,
+						 (int64) root->limit_tuples);
+
 	/*
 	 * Add FOR UPDATE/SHARE if appropriate.  We apply locking during the
 	 * initial row fetch, rather than later on as is done for local tables.
@@ -922,6 +1005,25 @@ postgresBeginForeignScan(ForeignScanState *node, int eflags)
 	fsstate->cursor_number = GetCursorNumber(fsstate->conn);
 	fsstate->cursor_exists = false;
 
+	/*
+	 * Per-table setting of async_capable overrides per-server setting.
+	 */
+	fsstate->async_capable = false;
+	foreach(lc, server->options)
+	{
+		DefElem    *def = (DefElem *) lfirst(lc);
+
+		if (strcmp(def->defname, "async_capable") == 0)
+			fsstate->async_capable = defGetBoolean(def);
+	}
+	foreach(lc, table->options)
+	{
+		DefElem    *def = (DefElem *) lfirst(lc);
+
+		if (strcmp(def->defname, "async_capable") == 0)
+			fsstate->async_capable = defGetBoolean(def);
+	}
+
 	/* Get private info created by planner functions. */
 	fsstate->query = strVal(list_nth(fsplan->fdw_private,
 									 FdwScanPrivateSelectSql));
@@ -1038,6 +1140,10 @@ postgresReScanForeignScan(ForeignScanState *node)
 	if (!fsstate->cursor_exists)
 		return;
 
+	/* Let a FETCH sent by postgresForeignAsyncRequest complete */
+	if (fsstate->fetch_pending)
+		read_fetch_result(fsstate);
+
 	/*
 	 * If any internal parameters affecting this node have changed, we'd
 	 * better destroy and recreate the cursor.  Otherwise, rewinding it should
@@ -1066,6 +1172,7 @@ postgresReScanForeignScan(ForeignScanState *node)
 	 * We don't use a PG_TRY block here, so be careful not to throw error
 	 * without releasing the PGresult.
 	 */
+	AbsorbPendingScan(fsstate->conn);
 	res = PQexec(fsstate->conn, sql);
 	if (PQresultStatus(res) != PGRES_COMMAND_OK)
 		pgfdw_report_error(ERROR, res, fsstate->conn, true, sql);
@@ -1103,6 +1210,58 @@ postgresEndForeignScan(ForeignScanState *node)
 	/* MemoryContexts will be deleted automatically. */
 }
 
+/*
+ * postgresIsForeignScanAsyncCapable
+ *		Tell whether the scan may run asynchronously under an Append
+ */
+static bool
+postgresIsForeignScanAsyncCapable(ForeignScanState *node)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+
+	return fsstate != NULL && fsstate->async_capable;
+}
+
+/*
+ * postgresForeignAsyncRequest
+ *		Make progress on the scan without blocking
+ *
+ * Returns true if postgresIterateForeignScan can now return a tuple, or the
+ * end of the scan, without waiting for the remote server.  Otherwise the
+ * FETCH of the next batch has been sent, and the socket to wait on for its
+ * result is returned in *sock.
+ */
+static bool
+postgresForeignAsyncRequest(ForeignScanState *node, pgsocket *sock)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+	PGconn	   *conn = fsstate->conn;
+
+	if (!fsstate->cursor_exists)
+		create_cursor(node);
+
+	/* Tuples left from the previous batch, or nothing more to fetch */
+	if (fsstate->next_tuple < fsstate->num_tuples || fsstate->eof_reached)
+		return true;
+
+	if (!fsstate->fetch_pending)
+	{
+		AbsorbPendingScan(conn);
+		send_fetch_request(fsstate);
+	}
+
+	if (!PQconsumeInput(conn))
+		pgfdw_report_error(ERROR, NULL, conn, false, fsstate->query);
+	if (PQisBusy(conn))
+	{
+		*sock = PQsocket(conn);
+		return false;
+	}
+
+	read_fetch_result(fsstate);
+	return true;
+}
+
 /*
  * postgresAddForeignUpdateTargets
  *		Add resjunk column(s) needed for update/delete on a foreign table
@@ -1164,6 +1323,7 @@ postgresPlanForeignModify(PlannerInfo *root,
 	List	   *targetAttrs = NIL;
 	List	   *returningList = NIL;
 	List	   *retrieved_attrs = NIL;
+	int			values_end_len = -1;
 
 	initStringInfo(&sql);
 
@@ -1223,7 +1383,7 @@ postgresPlanForeignModify(PlannerInfo *root,
 		case CMD_INSERT:
 			deparseInsertSql(&sql, root, resultRelation, rel,
 							 targetAttrs, returningList,
-							 &retrieved_attrs);
+							 &retrieved_attrs, &values_end_len);
 			break;
 		case CMD_UPDATE:
 			deparseUpdateSql(&sql, root, resultRelation, rel,
@@ -1246,10 +1406,11 @@ postgresPlanForeignModify(PlannerInfo *root,
 	 * Build the fdw_private list that will be available to the executor.
 	 * Items in the list must match enum FdwModifyPrivateIndex, above.
 	 */
-	return list_make4(makeString(sql.data),
-					  targetAttrs,
-					  makeInteger((returningList != NIL)),
-					  retrieved_attrs);
+	return lappend(list_make4(makeString(sql.data),
+							  targetAttrs,
+							  makeInteger((returningList != NIL)),
+							  retrieved_attrs),
+				   makeInteger(values_end_len));
 }
 
 /*
@@ -1364,6 +1525,38 @@ postgresBeginForeignModify(ModifyTableState *mtstate,
 
 	Assert(fmstate->p_nums <= n_params);
 
+	/*
+	 * An INSERT without RETURNING can buffer its rows and send batch_size of
+	 * them per statement, saving a round trip per row.  Keep the number of
+	 * parameters of a statement within what the protocol allows.
+	 */
+	fmstate->batch_size = 1;
+	if (operation == CMD_INSERT && !fmstate->has_returning &&
+		fmstate->p_nums > 0)
+		fmstate->batch_size = Min(get_batch_size_option(table, server),
+								  MAX_QUERY_PARAMS / fmstate->p_nums);
+
+	if (fmstate->batch_size > 1)
+	{
+		StringInfoData sql;
+
+		fmstate->orig_query = fmstate->query;
+		fmstate->values_end = intVal(list_nth(fdw_private,
+											  FdwModifyPrivateValuesEnd));
+		initStringInfo(&sql);
+		rebuildInsertSql(&sql, fmstate->orig_query, fmstate->values_end,
+						 fmstate->p_nums, fmstate->batch_size);
+		fmstate->query = sql.data;
+
+		fmstate->batch_values = (const char **)
+			palloc0(sizeof(char *) * fmstate->p_nums * fmstate->batch_size);
+		fmstate->batch_cxt = AllocSetContextCreate(estate->es_query_cxt,
+												   "postgres_fdw batch data",
+												   ALLOCSET_DEFAULT_MINSIZE,
+												   ALLOCSET_DEFAULT_INITSIZE,
+												   ALLOCSET_DEFAULT_MAXSIZE);
+	}
+
 	resultRelInfo->ri_FdwState = fmstate;
 }
 
@@ -1382,6 +1575,17 @@ postgresExecForeignInsert(EState *estate,
 	PGresult   *res;
 	int			n_rows;
 
+	/*
+	 * When batching, the row goes to the remote server along with the
+	 * following ones.  We can't know yet whether it will be inserted, so
+	 * assume it is.
+	 */
+	if (fmstate->batch_size > 1)
+	{
+		buffer_insert_values(fmstate, slot);
+		return slot;
+	}
+
 	/* Set up the prepared statement on the remote server, if we didn't yet */
 	if (!fmstate->p_name)
 		prepare_foreign_modify(fmstate);
@@ -1395,6 +1599,7 @@ postgresExecForeignInsert(EState *estate,
 	 * We don't use a PG_TRY block here, so be careful not to throw error
 	 * without releasing the PGresult.
 	 */
+	AbsorbPendingScan(fmstate->conn);
 	res = PQexecPrepared(fmstate->conn,
 						 fmstate->p_name,
 						 fmstate->p_nums,
@@ -1465,6 +1670,7 @@ postgresExecForeignUpdate(EState *estate,
 	 * We don't use a PG_TRY block here, so be careful not to throw error
 	 * without releasing the PGresult.
 	 */
+	AbsorbPendingScan(fmstate->conn);
 	res = PQexecPrepared(fmstate->conn,
 						 fmstate->p_name,
 						 fmstate->p_nums,
@@ -1535,6 +1741,7 @@ postgresExecForeignDelete(EState *estate,
 	 * We don't use a PG_TRY block here, so be careful not to throw error
 	 * without releasing the PGresult.
 	 */
+	AbsorbPendingScan(fmstate->conn);
 	res = PQexecPrepared(fmstate->conn,
 						 fmstate->p_name,
 						 fmstate->p_nums,
@@ -1579,6 +1786,10 @@ postgresEndForeignModify(EState *estate,
 	if (fmstate == NULL)
 		return;
 
+	/* Send the rows of an incomplete last batch */
+	if (fmstate->num_rows > 0)
+		execute_batch_insert(fmstate);
+
 	/* If we created a prepared statement, destroy it */
 	if (fmstate->p_name)
 	{
@@ -1591,6 +1802,7 @@ postgresEndForeignModify(EState *estate,
 		 * We don't use a PG_TRY block here, so be careful not to throw error
 		 * without releasing the PGresult.
 		 */
+		AbsorbPendingScan(fmstate->conn);
 		res = PQexec(fmstate->conn, sql);
 		if (PQresultStatus(res) != PGRES_COMMAND_OK)
 			pgfdw_report_error(ERROR, res, fmstate->conn, true, sql);
@@ -1698,6 +1910,7 @@ static void
 estimate_path_cost_size(PlannerInfo *root,
 						RelOptInfo *baserel,
 						List *join_conds,
+						List *pathkeys,
 						double *p_rows, int *p_width,
 						Cost *p_startup_cost, Cost *p_total_cost)
 {
@@ -1749,6 +1962,8 @@ estimate_path_cost_size(PlannerInfo *root,
 		if (remote_join_conds)
 			appendWhereClause(&sql, root, baserel, remote_join_conds,
 							  (fpinfo->remote_conds == NIL), NULL);
+		if (pathkeys)
+			appendOrderByClause(&sql, root, baserel, pathkeys);
 
 		/* Get the remote estimate */
 		conn = GetConnection(fpinfo->server, fpinfo->user, false);
@@ -1807,6 +2022,20 @@ estimate_path_cost_size(PlannerInfo *root,
 		cpu_per_tuple = cpu_tuple_cost + baserel->baserestrictcost.per_tuple;
 		run_cost += cpu_per_tuple * baserel->tuples;
 
+		/*
+		 * Without remote estimates, we have no real way to estimate the cost
+		 * of generating sorted output.  It could be free if the remote side
+		 * has a suitable index, but in most cases it will cost something.
+		 * Charge enough that we won't pick the sorted path when the order
+		 * isn't useful locally, but little enough that we'll rather push
+		 * down the ORDER BY when it is.
+		 */
+		if (pathkeys != NIL)
+		{
+			startup_cost *= DEFAULT_FDW_SORT_MULTIPLIER;
+			run_cost *= DEFAULT_FDW_SORT_MULTIPLIER;
+		}
+
 		total_cost = startup_cost + run_cost;
 	}
 
@@ -1828,6 +2057,100 @@ estimate_path_cost_size(PlannerInfo *root,
 	*p_total_cost = total_cost;
 }
 
+/*
+ * Detect whether the remote server can return the rows of baserel sorted by
+ * all of the given pathkeys.  The remote sort must use the same operators
+ * as the local one would, so we only accept pathkeys using the default
+ * btree operator family of their expression's type, whose ASC and DESC
+ * orders mean the same thing on both sides.
+ */
+static bool
+pathkeys_are_foreign(PlannerInfo *root, RelOptInfo *baserel, List *pathkeys)
+{
+	ListCell   *lc;
+
+	if (pathkeys == NIL)
+		return false;
+
+	/*
+	 * A prefix of the wanted order is of no use, since the planner would sort
+	 * the whole data set again: we need all of the pathkeys.
+	 */
+	foreach(lc, pathkeys)
+	{
+		PathKey    *pathkey = (PathKey *) lfirst(lc);
+		EquivalenceClass *ec = pathkey->pk_eclass;
+		Expr	   *em_expr;
+		Oid			opclass;
+
+		if (ec->ec_has_volatile)
+			return false;
+
+		em_expr = find_em_expr_for_rel(ec, baserel);
+		if (em_expr == NULL || !is_foreign_expr(root, baserel, em_expr))
+			return false;
+
+		opclass = GetDefaultOpClass(exprType((Node *) em_expr), BTREE_AM_OID);
+		if (!OidIsValid(opclass) ||
+			get_opclass_family(opclass) != pathkey->pk_opfamily)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Detect whether the LIMIT of the query can be sent along with the remote
+ * SELECT of best_path.  That takes a query reading nothing but this foreign
+ * table, with no grouping, aggregation or DISTINCT in between (the planner
+ * leaves root->limit_tuples at -1 then), no condition checked locally and
+ * no set-returning function multiplying the rows.  If the query sorts, the
+ * path must provide the order, else the remote server would pick other
+ * rows than the local Sort would.
+ */
+static bool
+limit_is_foreign(PlannerInfo *root, RelOptInfo *baserel,
+				 ForeignPath *best_path, List *local_exprs)
+{
+	Query	   *parse = root->parse;
+
+	if (root->limit_tuples <= 0 || parse->commandType != CMD_SELECT)
+		return false;
+	if (baserel->reloptkind != RELOPT_BASEREL ||
+		!bms_equal(baserel->relids, root->all_baserels))
+		return false;
+	if (local_exprs != NIL || best_path->path.param_info != NULL)
+		return false;
+	if (expression_returns_set((Node *) parse->targetList))
+		return false;
+	if (root->sort_pathkeys != NIL &&
+		!pathkeys_contained_in(root->sort_pathkeys, best_path->path.pathkeys))
+		return false;
+
+	return true;
+}
+
+/*
+ * Find an equivalence class member expression, all of whose Vars come from
+ * the indicated relation.  If there is more than one, any of them will do.
+ */
+Expr *
+find_em_expr_for_rel(EquivalenceClass *ec, RelOptInfo *rel)
+{
+	ListCell   *lc_em;
+
+	foreach(lc_em, ec->ec_members)
+	{
+		EquivalenceMember *em = (EquivalenceMember *) lfirst(lc_em);
+
+		if (bms_equal(em->em_relids, rel->relids))
+			return em->em_expr;
+	}
+
+	/* We didn't find any suitable equivalence class expression */
+	return NULL;
+}
+
 /*
  * Estimate costs of executing a SQL statement remotely.
  * The given "sql" must be an EXPLAIN command.
@@ -1849,6 +2172,7 @@ get_remote_estimate(const char *sql, PGconn *conn,
 		/*
 		 * Execute EXPLAIN remotely.
 		 */
+		AbsorbPendingScan(conn);
 		res = PQexec(conn, sql);
 		if (PQresultStatus(res) != PGRES_TUPLES_OK)
 			pgfdw_report_error(ERROR, res, conn, false, sql);
@@ -1982,6 +2306,7 @@ create_cursor(ForeignScanState *node)
 	 * We don't use a PG_TRY block here, so be careful not to throw error
 	 * without releasing the PGresult.
 	 */
+	AbsorbPendingScan(conn);
 	res = PQexecParams(conn, buf.data, numParams, NULL, values,
 					   NULL, NULL, 0);
 	if (PQresultStatus(res) != PGRES_COMMAND_OK)
@@ -2007,9 +2332,68 @@ static void
 fetch_more_data(ForeignScanState *node)
 {
 	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+
+	/*
+	 * Unless postgresForeignAsyncRequest already sent it, send the FETCH now,
+	 * after reading what another scan may still be waiting for on the same
+	 * connection.
+	 */
+	if (!fsstate->fetch_pending)
+	{
+		AbsorbPendingScan(fsstate->conn);
+		send_fetch_request(fsstate);
+	}
+
+	read_fetch_result(fsstate);
+}
+
+/*
+ * Send the FETCH of the next batch of rows of the node's cursor, without
+ * waiting for its result.  The connection remembers us as the scan whose
+ * result is pending, see AbsorbPendingScan.
+ */
+static void
+send_fetch_request(PgFdwScanState *fsstate)
+{
+	char		sql[64];
+
+	Assert(!fsstate->fetch_pending);
+
+	snprintf(sql, sizeof(sql), "FETCH %d FROM c%u",
+			 PGFDW_FETCH_SIZE, fsstate->cursor_number);
+
+	if (!PQsendQuery(fsstate->conn, sql))
+		pgfdw_report_error(ERROR, NULL, fsstate->conn, false, fsstate->query);
+
+	fsstate->fetch_pending = true;
+	SetPendingScan(fsstate->conn, fsstate);
+}
+
+/*
+ * Read the result of the FETCH sent by send_fetch_request, waiting for it
+ * if it has not arrived yet.
+ */
+static void
+read_fetch_result(PgFdwScanState *fsstate)
+{
+	PGconn	   *conn = fsstate->conn;
 	PGresult   *volatile res = NULL;
 	MemoryContext oldcontext;
 
+	Assert(fsstate->fetch_pending);
+
+	/*
+	 * The result is dropped by the abort of a subtransaction, a later FETCH
+	 * would silently skip its rows.
+	 */
+	if (GetPendingScan(conn) != fsstate)
+		ereport(ERROR,
+				(errcode(ERRCODE_FDW_ERROR),
+				 errmsg("result of a FETCH from the remote server was lost")));
+
+	fsstate->fetch_pending = false;
+	SetPendingScan(conn, NULL);
+
 	/*
 	 * We'll store the tuples in the batch_cxt.  First, flush the previous
 	 * batch.
@@ -2021,19 +2405,11 @@ fetch_more_data(ForeignScanState *node)
 	/* PGresult must be released before leaving this function. */
 	PG_TRY();
 	{
-		PGconn	   *conn = fsstate->conn;
-		char		sql[64];
-		int			fetch_size;
+		PGresult   *next;
 		int			numrows;
 		int			i;
 
-		/* The fetch size is arbitrary, but shouldn't be enormous. */
-		fetch_size = 100;
-
-		snprintf(sql, sizeof(sql), "FETCH %d FROM c%u",
-				 fetch_size, fsstate->cursor_number);
-
-		res = PQexec(conn, sql);
+		res = PQgetResult(conn);
 		/* On error, report the original query, not the FETCH. */
 		if (PQresultStatus(res) != PGRES_TUPLES_OK)
 			pgfdw_report_error(ERROR, res, conn, false, fsstate->query);
@@ -2059,10 +2435,14 @@ fetch_more_data(ForeignScanState *node)
 			fsstate->fetch_ct_2++;
 
 		/* Must be EOF if we didn't get as many tuples as we asked for. */
-		fsstate->eof_reached = (numrows < fetch_size);
+		fsstate->eof_reached = (numrows < PGFDW_FETCH_SIZE);
 
 		PQclear(res);
 		res = NULL;
+
+		/* Leave the connection ready for the next command */
+		while ((next = PQgetResult(conn)) != NULL)
+			PQclear(next);
 	}
 	PG_CATCH();
 	{
@@ -2075,6 +2455,20 @@ fetch_more_data(ForeignScanState *node)
 	MemoryContextSwitchTo(oldcontext);
 }
 
+/*
+ * Read the pending FETCH of the scan using "conn", if any, so that another
+ * command can be sent on it.  Every synchronous command of this module
+ * goes through here first.
+ */
+void
+AbsorbPendingScan(PGconn *conn)
+{
+	PgFdwScanState *fsstate = GetPendingScan(conn);
+
+	if (fsstate != NULL)
+		read_fetch_result(fsstate);
+}
+
 /*
  * Force assorted GUC parameters to settings that ensure that we'll output
  * data values in a form that is unambiguous to the remote server.
@@ -2140,6 +2534,7 @@ close_cursor(PGconn *conn, unsigned int cursor_number)
 	 * We don't use a PG_TRY block here, so be careful not to throw error
 	 * without releasing the PGresult.
 	 */
+	AbsorbPendingScan(conn);
 	res = PQexec(conn, sql);
 	if (PQresultStatus(res) != PGRES_COMMAND_OK)
 		pgfdw_report_error(ERROR, res, conn, true, sql);
@@ -2172,6 +2567,7 @@ prepare_foreign_modify(PgFdwModifyState *fmstate)
 	 * We don't use a PG_TRY block here, so be careful not to throw error
 	 * without releasing the PGresult.
 	 */
+	AbsorbPendingScan(fmstate->conn);
 	res = PQprepare(fmstate->conn,
 					p_name,
 					fmstate->query,
@@ -2186,6 +2582,129 @@ prepare_foreign_modify(PgFdwModifyState *fmstate)
 	fmstate->p_name = p_name;
 }
 
+/*
+ * get_batch_size_option
+ *		Number of rows an INSERT into the foreign table sends at once
+ *
+ * The per-table setting of batch_size overrides the per-server one.
+ */
+static int
+get_batch_size_option(ForeignTable *table, ForeignServer *server)
+{
+	int			batch_size = 1;
+	ListCell   *lc;
+
+	foreach(lc, server->options)
+	{
+		DefElem    *def = (DefElem *) lfirst(lc);
+
+		if (strcmp(def->defname, "batch_size") == 0)
+			batch_size = strtol(defGetString(def), NULL, 10);
+	}
+	foreach(lc, table->options)
+	{
+		DefElem    *def = (DefElem *) lfirst(lc);
+
+		if (strcmp(def->defname, "batch_size") == 0)
+			batch_size = strtol(defGetString(def), NULL, 10);
+	}
+
+	return batch_size;
+}
+
+/*
+ * buffer_insert_values
+ *		Keep the parameters of a row to insert for the next batch
+ *
+ * The batch is sent once it has batch_size rows.
+ */
+static void
+buffer_insert_values(PgFdwModifyState *fmstate, TupleTableSlot *slot)
+{
+	const char **p_values;
+	const char **batch_values;
+	MemoryContext oldcontext;
+	int			i;
+
+	p_values = convert_prep_stmt_params(fmstate, NULL, slot);
+
+	batch_values = fmstate->batch_values + fmstate->num_rows * fmstate->p_nums;
+	oldcontext = MemoryContextSwitchTo(fmstate->batch_cxt);
+	for (i = 0; i < fmstate->p_nums; i++)
+		batch_values[i] = p_values[i] ? pstrdup(p_values[i]) : NULL;
+	MemoryContextSwitchTo(oldcontext);
+
+	MemoryContextReset(fmstate->temp_cxt);
+
+	if (++fmstate->num_rows == fmstate->batch_size)
+		execute_batch_insert(fmstate);
+}
+
+/*
+ * execute_batch_insert
+ *		Insert the buffered rows into the foreign table
+ *
+ * A full batch uses the prepared statement, a shorter one (the last) a
+ * statement of its own.
+ */
+static void
+execute_batch_insert(PgFdwModifyState *fmstate)
+{
+	int			nparams = fmstate->num_rows * fmstate->p_nums;
+	char	   *sql;
+	PGresult   *res;
+
+	Assert(fmstate->num_rows > 0);
+
+	AbsorbPendingScan(fmstate->conn);
+
+	/*
+	 * We don't use a PG_TRY block here, so be careful not to throw error
+	 * without releasing the PGresult.
+	 */
+	if (fmstate->num_rows == fmstate->batch_size)
+	{
+		if (!fmstate->p_name)
+			prepare_foreign_modify(fmstate);
+
+		sql = fmstate->query;
+		res = PQexecPrepared(fmstate->conn,
+							 fmstate->p_name,
+							 nparams,
+							 fmstate->batch_values,
+							 NULL,
+							 NULL,
+							 0);
+	}
+	else
+	{
+		StringInfoData buf;
+		MemoryContext oldcontext;
+
+		oldcontext = MemoryContextSwitchTo(fmstate->batch_cxt);
+		initStringInfo(&buf);
+		rebuildInsertSql(&buf, fmstate->orig_query, fmstate->values_end,
+						 fmstate->p_nums, fmstate->num_rows);
+		MemoryContextSwitchTo(oldcontext);
+
+		sql = buf.data;
+		res = PQexecParams(fmstate->conn,
+						   sql,
+						   nparams,
+						   NULL,
+						   fmstate->batch_values,
+						   NULL,
+						   NULL,
+						   0);
+	}
+	if (PQresultStatus(res) != PGRES_COMMAND_OK)
+		pgfdw_report_error(ERROR, res, fmstate->conn, true, sql);
+	PQclear(res);
+
+	MemoryContextReset(fmstate->batch_cxt);
+	fmstate->num_rows = 0;
+}
+
 /*
  * convert_prep_stmt_params
  *		Create array of text strings representing parameter values
@@ -2327,6 +2846,7 @@ postgresAnalyzeForeignTable(Relation relation,
 	/* In what follows, do not risk leaking any PGresults. */
 	PG_TRY();
 	{
+		AbsorbPendingScan(conn);
 		res = PQexec(conn, sql.data);
 		if (PQresultStatus(res) != PGRES_TUPLES_OK)
 			pgfdw_report_error(ERROR, res, conn, false, sql.data);
@@ -2421,6 +2941,7 @@ postgresAcquireSampleRowsFunc(Relation relation, int elevel,
 	/* In what follows, do not risk leaking any PGresults. */
 	PG_TRY();
 	{
+		AbsorbPendingScan(conn);
 		res = PQexec(conn, sql.data);
 		if (PQresultStatus(res) != PGRES_COMMAND_OK)
 			pgfdw_report_error(ERROR, res, conn, false, sql.data);
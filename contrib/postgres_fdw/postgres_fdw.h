@@ -20,9 +20,13 @@
 
 #include "libpq-fe.h"
 
+struct PgFdwScanState;
+
 /* in postgres_fdw.c */
 extern int	set_transmission_modes(void);
 extern void reset_transmission_modes(int nestlevel);
+extern Expr *find_em_expr_for_rel(EquivalenceClass *ec, RelOptInfo *rel);
+extern void AbsorbPendingScan(PGconn *conn);
 
 /* in connection.c */
 extern PGconn *GetConnection(ForeignServer *server, UserMapping *user,
@@ -30,6 +34,8 @@ extern PGconn *GetConnection(ForeignServer *server, UserMapping *user,
 extern void ReleaseConnection(PGconn *conn);
 extern unsigned int GetCursorNumber(PGconn *conn);
 extern unsigned int GetPrepStmtNumber(PGconn *conn);
+extern void SetPendingScan(PGconn *conn, struct PgFdwScanState *fsstate);
+extern struct PgFdwScanState *GetPendingScan(PGconn *conn);
 extern void pgfdw_report_error(int elevel, PGresult *res, PGconn *conn,
 				   bool clear, const char *sql);
 
@@ -58,10 +64,16 @@ extern void appendWhereClause(StringInfo buf,
 				  List *exprs,
 				  bool is_first,
 				  List **params);
+extern void appendOrderByClause(StringInfo buf,
+					PlannerInfo *root,
+					RelOptInfo *baserel,
+					List *pathkeys);
 extern void deparseInsertSql(StringInfo buf, PlannerInfo *root,
 				 Index rtindex, Relation rel,
 				 List *targetAttrs, List *returningList,
-				 List **retrieved_attrs);
+				 List **retrieved_attrs, int *values_end_len);
+extern void rebuildInsertSql(StringInfo buf, const char *orig_query,
+				 int values_end_len, int num_cols, int num_rows);
 extern void deparseUpdateSql(StringInfo buf, PlannerInfo *root,
 				 Index rtindex, Relation rel,
 				 List *targetAttrs, List *returningList,
@@ -91,6 +91,8 @@ ALTER SERVER testserver1 OPTIONS (
 	updatable 'true',
 	fdw_startup_cost '123.456',
 	fdw_tuple_cost '0.123',
+	batch_size '100',
+	async_capable 'false',
 	service 'value',
 	connect_timeout 'value',
 	dbname 'value',
@@ -140,6 +142,9 @@ SELECT * FROM ft1 t1 ORDER BY t1.c3, t1.c1 OFFSET 100 LIMIT 10;
 -- whole-row reference
 EXPLAIN (VERBOSE, COSTS false) SELECT t1 FROM ft1 t1 ORDER BY t1.c3, t1.c1 OFFSET 100 LIMIT 10;
 SELECT t1 FROM ft1 t1 ORDER BY t1.c3, t1.c1 OFFSET 100 LIMIT 10;
+-- descending order
+EXPLAIN (VERBOSE, COSTS false) SELECT * FROM ft1 t1 ORDER BY t1.c1 DESC NULLS FIRST LIMIT 3;
+SELECT * FROM ft1 t1 ORDER BY t1.c1 DESC NULLS FIRST LIMIT 3;
 -- empty result
 SELECT * FROM ft1 WHERE false;
 -- with WHERE clause
@@ -329,6 +334,21 @@ explain (verbose, costs off) select * from ft3 where f2 = 'foo' COLLATE "C";
 explain (verbose, costs off) select * from ft3 f, loct3 l
   where f.f3 = l.f3 COLLATE "POSIX" and l.f1 = 'foo';
 
+-- ===================================================================
+-- test asynchronous scans under an Append
+-- ===================================================================
+ALTER FOREIGN TABLE ft1 OPTIONS (ADD async_capable 'true');
+ALTER FOREIGN TABLE ft2 OPTIONS (ADD async_capable 'true');
+SELECT count(*), sum(c1), sum(c2) FROM (
+  SELECT c1, c2 FROM ft1 WHERE c2 < 5
+  UNION ALL
+  SELECT c1, c2 FROM ft2 WHERE c2 >= 5) t;
+-- stop while a FETCH is pending
+SELECT count(*) FROM (
+  SELECT c1 FROM ft1 UNION ALL SELECT c1 FROM ft2 LIMIT 150) t;
+ALTER FOREIGN TABLE ft1 OPTIONS (DROP async_capable);
+ALTER FOREIGN TABLE ft2 OPTIONS (DROP async_capable);
+
 -- ===================================================================
 -- test writable foreign table stuff
 -- ===================================================================
@@ -338,6 +358,13 @@ INSERT INTO ft2 (c1,c2,c3) SELECT c1+1000,c2+100, c3 || c3 FROM ft2 LIMIT 20;
 INSERT INTO ft2 (c1,c2,c3)
   VALUES (1101,201,'aaa'), (1102,202,'bbb'), (1103,203,'ccc') RETURNING *;
 INSERT INTO ft2 (c1,c2,c3) VALUES (1104,204,'ddd'), (1105,205,'eee');
+-- batched INSERT, the last batch being incomplete
+ALTER FOREIGN TABLE ft2 OPTIONS (ADD batch_size '3');
+INSERT INTO ft2 (c1,c2,c3)
+  SELECT id, id % 10, to_char(id, 'FM00000') FROM generate_series(2001, 2010) id;
+SELECT count(*), min(c1), max(c1) FROM ft2 WHERE c1 > 2000;
+DELETE FROM ft2 WHERE c1 > 2000;
+ALTER FOREIGN TABLE ft2 OPTIONS (DROP batch_size);
 UPDATE ft2 SET c2 = c2 + 300, c3 = c3 || '_update3' WHERE c1 % 10 = 3;
 UPDATE ft2 SET c2 = c2 + 400, c3 = c3 || '_update7' WHERE c1 % 10 = 7 RETURNING *;
 EXPLAIN (verbose, costs off)
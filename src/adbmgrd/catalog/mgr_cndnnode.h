@@ -0,0 +1,77 @@
+# 0 "mgr_cndnnode.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "mgr_cndnnode.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "mgr_cndnnode.h.c" 2
+
+
+
+
+
+
+CATALOG(mgr_node,4948)
+{
+ NameData nodename;
+ Oid nodehost;
+ char nodetype;
+ NameData nodesync;
+ int32 nodeport;
+ bool nodeinited;
+ Oid nodemasternameoid;
+ bool nodeincluster;
+
+ text nodepath;
+
+} FormData_mgr_node;
+
+
+
+
+
+
+typedef FormData_mgr_node *Form_mgr_node;
+# 72 "mgr_cndnnode.h.c"
+typedef enum AGENT_STATUS
+{
+ AGENT_DOWN = 4,
+ AGENT_RUNNING
+}agent_status;
+
+struct enum_sync_state
+{
+ int type;
+ char *name;
+};
+
+typedef enum SYNC_STATE
+{
+ SYNC_STATE_SYNC,
+ SYNC_STATE_ASYNC,
+ SYNC_STATE_POTENTIAL,
+}sync_state;
+
+typedef enum{
+ PGXC_CONFIG,
+ PGXC_APPEND,
+ PGXC_FAILOVER,
+ PGXC_REMOVE
+}pgxc_node_operator;
+
+
+typedef enum ConnectType
+{
+ CONNECT_LOCAL=1,
+ CONNECT_HOST,
+ CONNECT_HOSTSSL,
+ CONNECT_HOSTNOSSL
+}ConnectType;
+
+extern bool with_data_checksums;
@@ -0,0 +1,32 @@
+# 0 "mgr_hba.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "mgr_hba.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "mgr_hba.h.c" 2
+
+
+
+
+
+
+
+CATALOG(mgr_hba,3191)
+{
+ NameData nodename;
+ text hbavalue;
+} FormData_mgr_hba;
+
+
+
+
+
+
+typedef FormData_mgr_hba *Form_mgr_hba;
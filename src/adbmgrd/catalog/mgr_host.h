@@ -0,0 +1,38 @@
+# 0 "mgr_host.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "mgr_host.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "mgr_host.h.c" 2
+
+
+
+
+
+
+CATALOG(mgr_host,4908)
+{
+ NameData hostname;
+ NameData hostuser;
+ int32 hostport;
+ char hostproto;
+ int32 hostagentport;
+
+ text hostaddr;
+ text hostadbhome;
+
+} FormData_mgr_host;
+
+
+
+
+
+
+typedef FormData_mgr_host *Form_mgr_host;
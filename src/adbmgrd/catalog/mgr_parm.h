@@ -0,0 +1,41 @@
+# 0 "mgr_parm.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "mgr_parm.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "mgr_parm.h.c" 2
+
+
+
+
+
+
+
+CATALOG(mgr_parm,4928) BKI_WITHOUT_OIDS
+{
+ char parmtype;
+ NameData parmname;
+ NameData parmvalue;
+ NameData parmcontext;
+ NameData parmvartype;
+
+ text parmunit;
+ text parmminval;
+ text parmmaxval;
+ text parmenumval;
+
+} FormData_mgr_parm;
+
+
+
+
+
+
+typedef FormData_mgr_parm *Form_mgr_parm;
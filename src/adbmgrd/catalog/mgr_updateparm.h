@@ -0,0 +1,37 @@
+# 0 "mgr_updateparm.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "mgr_updateparm.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "mgr_updateparm.h.c" 2
+
+
+
+
+
+
+
+CATALOG(mgr_updateparm,3846) BKI_WITHOUT_OIDS
+{
+ NameData updateparmnodename;
+ char updateparmnodetype;
+ NameData updateparmkey;
+
+ text updateparmvalue;
+
+
+} FormData_mgr_updateparm;
+
+
+
+
+
+
+typedef FormData_mgr_updateparm *Form_mgr_updateparm;
@@ -0,0 +1,27 @@
+# 0 "monitor_alarm.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_alarm.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_alarm.h.c" 2
+# 19 "monitor_alarm.h.c"
+CATALOG(monitor_alarm,5209)
+{
+ int16 ma_alarm_level;
+ int16 ma_alarm_type;
+ timestamptz ma_alarm_timetz;
+ int16 ma_alarm_status;
+
+ text ma_alarm_source;
+ text ma_alarm_text;
+
+} FormData_monitor_alarm;
+# 40 "monitor_alarm.h.c"
+typedef FormData_monitor_alarm *Form_monitor_alarm;
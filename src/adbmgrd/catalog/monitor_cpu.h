@@ -0,0 +1,26 @@
+# 0 "monitor_cpu.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_cpu.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_cpu.h.c" 2
+# 19 "monitor_cpu.h.c"
+CATALOG(monitor_cpu,4922)
+{
+    NameData hostname;
+    timestamptz mc_timestamptz;
+    float4 mc_cpu_usage;
+
+
+    text mc_cpu_freq;
+
+} FormData_monitor_cpu;
+# 39 "monitor_cpu.h.c"
+typedef FormData_monitor_cpu *Form_monitor_cpu;
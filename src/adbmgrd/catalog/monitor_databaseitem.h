@@ -0,0 +1,40 @@
+# 0 "monitor_databaseitem.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_databaseitem.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_databaseitem.h.c" 2
+# 16 "monitor_databaseitem.h.c"
+CATALOG(monitor_databaseitem,4952) BKI_WITHOUT_OIDS
+{
+ timestamptz monitor_databaseitem_time;
+ NameData monitor_databaseitem_dbname;
+ int32 monitor_databaseitem_dbsize;
+ bool monitor_databaseitem_archivemode;
+ bool monitor_databaseitem_autovacuum;
+ float4 monitor_databaseitem_heaphitrate;
+ float4 monitor_databaseitem_commitrate;
+ int32 monitor_databaseitem_dbage;
+ int32 monitor_databaseitem_connectnum;
+ int32 monitor_databaseitem_standbydelay;
+ int32 monitor_databaseitem_locksnum;
+ int32 monitor_databaseitem_longtransnum;
+ int32 monitor_databaseitem_idletransnum;
+ int32 monitor_databaseitem_preparenum;
+ int32 monitor_databaseitem_unusedindexnum;
+ int32 monitor_databaseitem_indexsize;
+} FormData_monitor_databaseitem;
+
+
+
+
+
+
+typedef FormData_monitor_databaseitem *Form_monitor_databaseitem;
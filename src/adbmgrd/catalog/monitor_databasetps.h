@@ -0,0 +1,30 @@
+# 0 "monitor_databasetps.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_databasetps.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_databasetps.h.c" 2
+# 16 "monitor_databasetps.h.c"
+CATALOG(monitor_databasetps,4950) BKI_WITHOUT_OIDS
+{
+ timestamptz monitor_databasetps_time;
+ NameData monitor_databasetps_dbname;
+ int32 monitor_databasetps_tps;
+ int32 monitor_databasetps_qps;
+ int32 monitor_databasetps_runtime;
+
+} FormData_monitor_databasetps;
+
+
+
+
+
+
+typedef FormData_monitor_databasetps *Form_monitor_databasetps;
@@ -0,0 +1,27 @@
+# 0 "monitor_disk.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_disk.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_disk.h.c" 2
+# 18 "monitor_disk.h.c"
+CATALOG(monitor_disk,4925)
+{
+    NameData hostname;
+    timestamptz md_timestamptz;
+    int64 md_total;
+    int64 md_used;
+    int64 md_io_read_bytes;
+    int64 md_io_read_time;
+    int64 md_io_write_bytes;
+    int64 md_io_write_time;
+} FormData_monitor_disk;
+# 39 "monitor_disk.h.c"
+typedef FormData_monitor_disk *Form_monitor_disk;
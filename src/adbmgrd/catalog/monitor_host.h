@@ -0,0 +1,30 @@
+# 0 "monitor_host.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_host.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_host.h.c" 2
+# 19 "monitor_host.h.c"
+CATALOG(monitor_host,4921)
+{
+    NameData hostname;
+    int16 mh_run_state;
+    timestamptz mh_current_time;
+    int64 mh_seconds_since_boot;
+    int16 mh_cpu_core_total;
+    int16 mh_cpu_core_available;
+
+
+    text mh_system;
+    text mh_platform_type;
+
+} FormData_monitor_host;
+# 43 "monitor_host.h.c"
+typedef FormData_monitor_host *Form_monitor_host;
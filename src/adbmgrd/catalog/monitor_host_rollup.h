@@ -0,0 +1,29 @@
+# 0 "monitor_host_rollup.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_host_rollup.h.c"
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 6 "monitor_host_rollup.h.c" 2
+# 19 "monitor_host_rollup.h.c"
+CATALOG(monitor_host_rollup,5235) BKI_WITHOUT_OIDS
+{
+    NameData hostname;
+    char mhr_level;
+    timestamptz mhr_timestamptz;
+    int32 mhr_samples;
+    float4 mhr_cpu_avg;
+    float4 mhr_cpu_max;
+    float4 mhr_mem_avg;
+    float4 mhr_mem_max;
+    int64 mhr_disk_used;
+    int64 mhr_net_sent;
+    int64 mhr_net_recv;
+} FormData_monitor_host_rollup;
+# 43 "monitor_host_rollup.h.c"
+typedef FormData_monitor_host_rollup *Form_monitor_host_rollup;
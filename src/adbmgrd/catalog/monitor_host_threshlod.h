@@ -0,0 +1,24 @@
+# 0 "monitor_host_threshlod.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_host_threshlod.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_host_threshlod.h.c" 2
+# 19 "monitor_host_threshlod.h.c"
+CATALOG(monitor_host_threshold,4927) BKI_WITHOUT_OIDS
+{
+    int16 mt_type;
+    int16 mt_direction;
+    int16 mt_warning_threshold;
+    int16 mt_critical_threshold;
+    int16 mt_emergency_threshold;
+} FormData_monitor_host_threshold;
+# 37 "monitor_host_threshlod.h.c"
+typedef FormData_monitor_host_threshold *Form_monitor_host_threshold;
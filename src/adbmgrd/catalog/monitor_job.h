@@ -0,0 +1,32 @@
+# 0 "monitor_job.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_job.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_job.h.c" 2
+# 15 "monitor_job.h.c"
+CATALOG(monitor_job,4918)
+{
+ NameData name;
+ timestamptz next_time;
+ int32 interval;
+ bool status;
+
+ text command;
+ text description;
+
+} FormData_monitor_job;
+
+
+
+
+
+
+typedef FormData_monitor_job *Form_monitor_job;
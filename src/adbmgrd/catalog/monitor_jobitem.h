@@ -0,0 +1,34 @@
+# 0 "monitor_jobitem.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_jobitem.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_jobitem.h.c" 2
+
+
+
+
+
+
+CATALOG(monitor_jobitem,4920) BKI_WITHOUT_OIDS
+{
+ NameData jobitem_itemname;
+
+ text jobitem_path;
+ text jobitem_desc;
+
+} FormData_monitor_jobitemitem;
+
+
+
+
+
+
+typedef FormData_monitor_jobitemitem *Form_monitor_jobitemitem;
@@ -0,0 +1,24 @@
+# 0 "monitor_mem.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_mem.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_mem.h.c" 2
+# 20 "monitor_mem.h.c"
+CATALOG(monitor_mem,4923)
+{
+    NameData hostname;
+    timestamptz mm_timestamptz;
+    int64 mm_total;
+    int64 mm_used;
+    float4 mm_usage;
+} FormData_monitor_mem;
+# 38 "monitor_mem.h.c"
+typedef FormData_monitor_mem *Form_monitor_mem;
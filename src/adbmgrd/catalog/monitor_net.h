@@ -0,0 +1,23 @@
+# 0 "monitor_net.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_net.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_net.h.c" 2
+# 21 "monitor_net.h.c"
+CATALOG(monitor_net,4924)
+{
+    NameData hostname;
+    timestamptz mn_timestamptz;
+    int64 mn_sent;
+    int64 mn_recv;
+} FormData_monitor_net;
+# 38 "monitor_net.h.c"
+typedef FormData_monitor_net *Form_monitor_net;
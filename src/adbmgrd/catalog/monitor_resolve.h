@@ -0,0 +1,24 @@
+# 0 "monitor_resolve.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_resolve.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_resolve.h.c" 2
+# 19 "monitor_resolve.h.c"
+CATALOG(monitor_resolve,5021)
+{
+ Oid mr_alarm_oid;
+ timestamptz mr_resolve_timetz;
+
+ text mr_solution;
+
+} FormData_monitor_resolve;
+# 37 "monitor_resolve.h.c"
+typedef FormData_monitor_resolve *Form_monitor_resolve;
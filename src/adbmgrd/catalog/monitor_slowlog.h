@@ -0,0 +1,33 @@
+# 0 "monitor_slowlog.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_slowlog.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_slowlog.h.c" 2
+# 15 "monitor_slowlog.h.c"
+CATALOG(monitor_slowlog,4954) BKI_WITHOUT_OIDS
+{
+ NameData slowlogdbname;
+ NameData slowloguser;
+ float4 slowlogsingletime;
+ int32 slowlogtotalnum;
+ timestamptz slowlogtime;
+
+ text slowlogquery;
+ text slowlogqueryplan;
+
+} FormData_monitor_slowlog;
+
+
+
+
+
+
+typedef FormData_monitor_slowlog *Form_monitor_slowlog;
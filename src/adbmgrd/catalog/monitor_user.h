@@ -0,0 +1,37 @@
+# 0 "monitor_user.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_user.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_user.h.c" 2
+# 15 "monitor_user.h.c"
+CATALOG(monitor_user,4953)
+{
+ NameData username;
+ int32 usertype;
+ timestamptz userstarttime;
+ timestamptz userendtime;
+ NameData usertel;
+ NameData useremail;
+ NameData usercompany;
+ NameData userdepart;
+ NameData usertitle;
+
+ text userpassword;
+ text userdesc;
+
+} FormData_monitor_user;
+
+
+
+
+
+
+typedef FormData_monitor_user *Form_monitor_user;
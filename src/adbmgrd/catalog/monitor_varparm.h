@@ -0,0 +1,22 @@
+# 0 "monitor_varparm.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "monitor_varparm.h.c"
+
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 7 "monitor_varparm.h.c" 2
+# 18 "monitor_varparm.h.c"
+CATALOG(monitor_varparm,4926)
+{
+    int16 mv_cpu_threshold;
+    int16 mv_mem_threshold;
+    int16 mv_disk_threshold;
+} FormData_monitor_varparm;
+# 34 "monitor_varparm.h.c"
+typedef FormData_monitor_varparm *Form_monitor_varparm;
@@ -0,0 +1 @@
+/root/repo/src/adbmgrd/catalog/schemapg.h
\ No newline at end of file
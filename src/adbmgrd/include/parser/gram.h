@@ -0,0 +1 @@
+/root/repo/src/adbmgrd/parser/gram.h
\ No newline at end of file
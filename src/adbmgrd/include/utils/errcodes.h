@@ -0,0 +1 @@
+/root/repo/src/adbmgrd/utils/errcodes.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/adbmgrd/utils/fmgroids.h
\ No newline at end of file
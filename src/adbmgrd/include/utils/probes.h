@@ -0,0 +1 @@
+/root/repo/src/adbmgrd/utils/probes.h
\ No newline at end of file
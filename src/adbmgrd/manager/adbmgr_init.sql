@@ -197,13 +197,13 @@ CREATE VIEW adbmgr.startall AS
     UNION all
     SELECT 'start gtm extra' AS "operation type", * FROM mgr_start_gtm_extra(NULL)
     UNION all
-    SELECT 'start coordinator' AS "operation type", * FROM mgr_start_cn_master(NULL)
-    UNION all
     SELECT 'start datanode master' AS "operation type", * FROM mgr_start_dn_master(NULL)
     UNION all
     SELECT 'start datanode slave' AS "operation type", * FROM mgr_start_dn_slave(NULL)
     UNION all
-    SELECT 'start datanode extra' AS "operation type", * FROM mgr_start_dn_extra(NULL);
+    SELECT 'start datanode extra' AS "operation type", * FROM mgr_start_dn_extra(NULL)
+    UNION all
+    SELECT 'start coordinator' AS "operation type", * FROM mgr_start_cn_master(NULL);
 --stop datanode all
 CREATE VIEW adbmgr.stop_datanode_all AS
     SELECT 'stop datanode extra' AS "operation type", * FROM mgr_stop_dn_extra('smart', NULL)
@@ -1099,6 +1099,7 @@ grant usage on schema adbmgr to public;
 revoke execute on function mgr_clean_all() from public;
 revoke execute on function mgr_clean_node("any") from public;
 revoke execute on function monitor_delete_data_interval_days(int) from public;
+revoke execute on function monitor_rollup_host_data() from public;
 -- failover
 revoke execute on function mgr_failover_gtm(cstring, cstring, bool), mgr_failover_one_dn(cstring, cstring, bool) from public;
 
@@ -92,7 +92,7 @@ static void mgr_set_inited_incluster(char *nodename, char nodetype, bool checkva
 static void mgr_add_hbaconf_all(char *dnusername, char *dnaddr, bool check_incluster);
 static void mgr_after_gtm_failover_handle(char *hostaddress, int cndnport, Relation noderel, GetAgentCmdRst *getAgentCmdRst, HeapTuple aimtuple, char *cndnPath, PGconn **pg_conn, Oid cnoid);
 static bool mgr_start_one_gtm_master(void);
-static void mgr_after_datanode_failover_handle(Oid nodemasternameoid, Name cndnname, int cndnport, char *hostaddress, Relation noderel, GetAgentCmdRst *getAgentCmdRst, HeapTuple aimtuple, char *cndnPath, char aimtuplenodetype, PGconn **pg_conn, Oid cnoid);
+static void mgr_after_datanode_failover_handle(Oid nodemasternameoid, Name cndnname, int cndnport, char *hostaddress, Relation noderel, GetAgentCmdRst *getAgentCmdRst, HeapTuple aimtuple, char *cndnPath, char aimtuplenodetype, PGconn **pg_conn, Oid cnoid, List *refresh_plan);
 static void mgr_get_parent_appendnodeinfo(Oid nodemasternameoid, AppendNodeInfo *parentnodeinfo);
 static char *get_temp_file_name(void);
 static void mgr_clean_node_folder(char cmdtype, Oid hostoid, char *nodepath, GetAgentCmdRst *getAgentCmdRst);
@@ -153,8 +153,17 @@ static bool mgr_has_table_priv(char *rolename, char *tablename, char *priv_type)
 static bool mgr_has_func_priv(char *rolename, char *funcname, char *priv_type);
 static List *get_username_list(void);
 static Oid mgr_get_role_oid_or_public(const char *rolname);
+static void mgr_refresh_conf_after_init(Relation noderel, HeapTuple aimtuple, char *cndnPath, GetAgentCmdRst *getAgentCmdRst);
+static void mgr_refresh_conf_after_slave_init(Relation noderel, HeapTuple aimtuple, char *cndnPath, GetAgentCmdRst *getAgentCmdRst);
+static List *mgr_init_cndn_master_parallel(char nodetype, List *nodenamelist);
+static List *mgr_init_dn_slave_parallel(char nodetype);
+static Datum mgr_return_result_list(FunctionCallInfo fcinfo, char nodetype, List *nodenamelist);
+static char *mgr_get_tuple_nodepath(Relation noderel, HeapTuple aimtuple);
 static void mgr_priv_all(char command_type, char *username_list_str);
 static int mgr_pqexec_boolsql_try_maxnum(PGconn **pg_conn, char *sqlstr, const int maxnum);
+static List *mgr_get_refresh_pgxc_node_plan(pgxc_node_operator cmd, char nodetype, char *dnname, Oid cnoid);
+static bool mgr_pqexec_refresh_pgxc_node_plan(List *plan, GetAgentCmdRst *getAgentCmdRst, PGconn **pg_conn, Oid cnoid);
+static void mgr_free_refresh_pgxc_node_plan(List *plan);
 static bool mgr_extension_pg_stat_statements(char cmdtype, char *extension_name);
 static bool mgr_check_syncstate_node_exist(Relation rel, Name mastername, char mastertype, int sync_state_type, Oid excludeoid);
 static bool mgr_check_syncstate_node_exist_incluster(Relation rel, Name mastername, char mastertype, int sync_state_type, Oid excludeoid);
@@ -917,7 +926,10 @@ mgr_init_cn_master(PG_FUNCTION_ARGS)
 		ereport(ERROR, (errmsg("cannot assign TransactionIds during recovery")));
 
 	if (PG_ARGISNULL(0))
+	{
 		nodenamelist = mgr_get_nodetype_namelist(CNDN_TYPE_COORDINATOR_MASTER);
+		return mgr_return_result_list(fcinfo, CNDN_TYPE_COORDINATOR_MASTER, nodenamelist);
+	}
 	else
 		nodenamelist = get_fcinfo_namelist("", 0, fcinfo);
 
@@ -937,7 +949,10 @@ mgr_init_dn_master(PG_FUNCTION_ARGS)
 		ereport(ERROR, (errmsg("cannot assign TransactionIds during recovery")));
 
 	if (PG_ARGISNULL(0))
+	{
 		nodenamelist = mgr_get_nodetype_namelist(CNDN_TYPE_DATANODE_MASTER);
+		return mgr_return_result_list(fcinfo, CNDN_TYPE_DATANODE_MASTER, nodenamelist);
+	}
 	else
 		nodenamelist = get_fcinfo_namelist("", 0, fcinfo);
 
@@ -950,78 +965,10 @@ mgr_init_dn_master(PG_FUNCTION_ARGS)
 Datum
 mgr_init_dn_slave_all(PG_FUNCTION_ARGS)
 {
-	InitNodeInfo *info;
-	GetAgentCmdRst getAgentCmdRst;
-	Form_mgr_node mgr_node;
-	FuncCallContext *funcctx;
-	HeapTuple tuple
-			,tup_result,
-			mastertuple;
-	ScanKeyData key[1];
-	uint32 masterport;
-	Oid masterhostOid;
-	char *masterhostaddress;
-	char *mastername;
-
 	if (RecoveryInProgress())
 		ereport(ERROR, (errmsg("cannot assign TransactionIds during recovery")));
 
-	/*output the exec result: col1 hostname,col2 SUCCESS(t/f),col3 description*/
-	if (SRF_IS_FIRSTCALL())
-	{
-		MemoryContext oldcontext;
-		funcctx = SRF_FIRSTCALL_INIT();
-		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
-		ScanKeyInit(&key[0],
-		Anum_mgr_node_nodetype
-		,BTEqualStrategyNumber
-		,F_CHAREQ
-		,CharGetDatum(CNDN_TYPE_DATANODE_SLAVE));
-		info = palloc(sizeof(*info));
-		info->rel_node = heap_open(NodeRelationId, RowExclusiveLock);
-		info->rel_scan = heap_beginscan(info->rel_node, SnapshotNow, 1, key);
-		/* save info */
-		funcctx->user_fctx = info;
-		MemoryContextSwitchTo(oldcontext);
-	}
-	funcctx = SRF_PERCALL_SETUP();
-	info = funcctx->user_fctx;
-	Assert(info);
-	tuple = heap_getnext(info->rel_scan, ForwardScanDirection);
-	if(tuple == NULL)
-	{
-		/* end of row */
-		heap_endscan(info->rel_scan);
-		heap_close(info->rel_node, RowExclusiveLock);
-		pfree(info);
-		SRF_RETURN_DONE(funcctx);
-	}
-	/*get nodename*/
-	mgr_node = (Form_mgr_node)GETSTRUCT(tuple);
-	Assert(mgr_node);
-	/*get the master port, master host address*/
-	mastertuple = SearchSysCache1(NODENODEOID, ObjectIdGetDatum(mgr_node->nodemasternameoid));
-	if(!HeapTupleIsValid(mastertuple))
-	{
-		ereport(ERROR, (errcode(ERRCODE_UNDEFINED_OBJECT)
-			, errmsg("datanode master \"%s\" does not exist", NameStr(mgr_node->nodename))));
-	}
-	mgr_node = (Form_mgr_node)GETSTRUCT(mastertuple);
-	Assert(mastertuple);
-	masterport = mgr_node->nodeport;
-	masterhostOid = mgr_node->nodehost;
-	mastername = NameStr(mgr_node->nodename);
-	masterhostaddress = get_hostaddress_from_hostoid(masterhostOid);
-	ReleaseSysCache(mastertuple);
-	initStringInfo(&(getAgentCmdRst.description));
-	mgr_init_dn_slave_get_result(AGT_CMD_CNDN_SLAVE_INIT, &getAgentCmdRst, info->rel_node, tuple, masterhostaddress, masterport, mastername);
-	pfree(masterhostaddress);
-	tup_result = build_common_command_tuple(
-		&(getAgentCmdRst.nodename)
-		, getAgentCmdRst.ret
-		, getAgentCmdRst.description.data);
-	pfree(getAgentCmdRst.description.data);
-	SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
+	return mgr_return_result_list(fcinfo, CNDN_TYPE_DATANODE_SLAVE, NIL);
 }
 
 /*
@@ -1030,78 +977,10 @@ mgr_init_dn_slave_all(PG_FUNCTION_ARGS)
 Datum
 mgr_init_dn_extra_all(PG_FUNCTION_ARGS)
 {
-	InitNodeInfo *info;
-	GetAgentCmdRst getAgentCmdRst;
-	Form_mgr_node mgr_node;
-	FuncCallContext *funcctx;
-	HeapTuple tuple
-			,tup_result,
-			mastertuple;
-	ScanKeyData key[1];
-	uint32 masterport;
-	Oid masterhostOid;
-	char *masterhostaddress;
-	char *mastername;
-
 	if (RecoveryInProgress())
 		ereport(ERROR, (errmsg("cannot assign TransactionIds during recovery")));
 
-	/*output the exec result: col1 hostname,col2 SUCCESS(t/f),col3 description*/
-	if (SRF_IS_FIRSTCALL())
-	{
-		MemoryContext oldcontext;
-		funcctx = SRF_FIRSTCALL_INIT();
-		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
-		ScanKeyInit(&key[0],
-		Anum_mgr_node_nodetype
-		,BTEqualStrategyNumber
-		,F_CHAREQ
-		,CharGetDatum(CNDN_TYPE_DATANODE_EXTRA));
-		info = palloc(sizeof(*info));
-		info->rel_node = heap_open(NodeRelationId, RowExclusiveLock);
-		info->rel_scan = heap_beginscan(info->rel_node, SnapshotNow, 1, key);
-		/* save info */
-		funcctx->user_fctx = info;
-		MemoryContextSwitchTo(oldcontext);
-	}
-	funcctx = SRF_PERCALL_SETUP();
-	info = funcctx->user_fctx;
-	Assert(info);
-	tuple = heap_getnext(info->rel_scan, ForwardScanDirection);
-	if(tuple == NULL)
-	{
-		/* end of row */
-		heap_endscan(info->rel_scan);
-		heap_close(info->rel_node, RowExclusiveLock);
-		pfree(info);
-		SRF_RETURN_DONE(funcctx);
-	}
-	/*get nodename*/
-	mgr_node = (Form_mgr_node)GETSTRUCT(tuple);
-	Assert(mgr_node);
-	/*get the master port, master host address*/
-	mastertuple = SearchSysCache1(NODENODEOID, ObjectIdGetDatum(mgr_node->nodemasternameoid));
-	if(!HeapTupleIsValid(mastertuple))
-	{
-		ereport(ERROR, (errcode(ERRCODE_UNDEFINED_OBJECT)
-			, errmsg("datanode master \"%s\" does not exist", NameStr(mgr_node->nodename))));
-	}
-	mgr_node = (Form_mgr_node)GETSTRUCT(mastertuple);
-	Assert(mastertuple);
-	masterport = mgr_node->nodeport;
-	masterhostOid = mgr_node->nodehost;
-	mastername = NameStr(mgr_node->nodename);
-	masterhostaddress = get_hostaddress_from_hostoid(masterhostOid);
-	ReleaseSysCache(mastertuple);
-	initStringInfo(&(getAgentCmdRst.description));
-	mgr_init_dn_slave_get_result(AGT_CMD_CNDN_SLAVE_INIT, &getAgentCmdRst, info->rel_node, tuple, masterhostaddress, masterport, mastername);
-	pfree(masterhostaddress);
-	tup_result = build_common_command_tuple(
-		&(getAgentCmdRst.nodename)
-		, getAgentCmdRst.ret
-		, getAgentCmdRst.description.data);
-	pfree(getAgentCmdRst.description.data);
-	SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
+	return mgr_return_result_list(fcinfo, CNDN_TYPE_DATANODE_EXTRA, NIL);
 }
 
 void mgr_init_dn_slave_get_result(const char cmdtype, GetAgentCmdRst *getAgentCmdRst, Relation noderel, HeapTuple aimtuple, char *masterhostaddress, uint32 masterport, char *mastername)
@@ -1114,8 +993,6 @@ void mgr_init_dn_slave_get_result(const char cmdtype, GetAgentCmdRst *getAgentCm
 	char *user;
 	char nodetype;
 	Oid hostOid;
-	Oid	masteroid;
-	Oid	tupleOid;
 	StringInfoData buf;
 	StringInfoData infosendmsg;
 	StringInfoData strinfocoordport;
@@ -1124,7 +1001,6 @@ void mgr_init_dn_slave_get_result(const char cmdtype, GetAgentCmdRst *getAgentCm
 	bool isNull = false;
 	bool ismasterrunning = false;
 	Form_mgr_node mgr_node;
-	int cndnport;
 	Datum DatumStartDnMaster,
 	DatumStopDnMaster;
 
@@ -1135,14 +1011,8 @@ void mgr_init_dn_slave_get_result(const char cmdtype, GetAgentCmdRst *getAgentCm
 	Assert(mgr_node);
 	cndnnametmp = NameStr(mgr_node->nodename);
 	hostOid = mgr_node->nodehost;
-	/*get the port*/
-	cndnport = mgr_node->nodeport;
-	/*get master oid*/
-	masteroid = mgr_node->nodemasternameoid;
 	/*get nodetype*/
 	nodetype = mgr_node->nodetype;
-	/*get tuple oid*/
-	tupleOid = HeapTupleGetOid(aimtuple);
 	/*get the host address for return result*/
 	namestrcpy(&(getAgentCmdRst->nodename), cndnnametmp);
 	/*check node init or not*/
@@ -1182,6 +1052,7 @@ void mgr_init_dn_slave_get_result(const char cmdtype, GetAgentCmdRst *getAgentCm
 	appendStringInfo(&infosendmsg, " -h %s", masterhostaddress);
 	appendStringInfo(&infosendmsg, " -D %s", cndnPath);
 	appendStringInfo(&infosendmsg, " -x");
+	appendStringInfoString(&infosendmsg, MGR_BASEBACKUP_STREAM_COMPRESS);
 	/* connection agent */
 	ma = ma_connect_hostoid(hostOid);
 	if(!ma_isconnected(ma))
@@ -1219,22 +1090,343 @@ void mgr_init_dn_slave_get_result(const char cmdtype, GetAgentCmdRst *getAgentCm
 	}
 	/*update node system table's column to set initial is true*/
 	if (initdone)
+		mgr_refresh_conf_after_slave_init(noderel, aimtuple, cndnPath, getAgentCmdRst);
+	pfree(infosendmsg.data);
+}
+
+/*
+* after the base backup of a datanode slave or extra: mark it initialized, then refresh its
+* postgresql.conf and recovery.conf
+*/
+static void mgr_refresh_conf_after_slave_init(Relation noderel, HeapTuple aimtuple, char *cndnPath, GetAgentCmdRst *getAgentCmdRst)
+{
+	Form_mgr_node mgr_node = (Form_mgr_node)GETSTRUCT(aimtuple);
+	StringInfoData infosendmsg;
+
+	initStringInfo(&infosendmsg);
+	mgr_node->nodeinited = true;
+	heap_inplace_update(noderel, aimtuple);
+	/*refresh postgresql.conf of this node*/
+	resetStringInfo(&(getAgentCmdRst->description));
+	mgr_add_parameters_pgsqlconf(HeapTupleGetOid(aimtuple), mgr_node->nodetype, mgr_node->nodeport, &infosendmsg);
+	mgr_add_parm(NameStr(mgr_node->nodename), mgr_node->nodetype, &infosendmsg);
+	mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_PGSQLCONF, cndnPath, &infosendmsg, mgr_node->nodehost, getAgentCmdRst);
+	/*refresh recovry.conf*/
+	resetStringInfo(&(getAgentCmdRst->description));
+	resetStringInfo(&infosendmsg);
+	mgr_add_parameters_recoveryconf(mgr_node->nodetype, "slave", mgr_node->nodemasternameoid, &infosendmsg);
+	mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_RECOVERCONF, cndnPath, &infosendmsg, mgr_node->nodehost, getAgentCmdRst);
+	pfree(infosendmsg.data);
+}
+
+/*
+* after initdb of a coordinator or datanode master: mark it initialized, then refresh its
+* postgresql.conf and pg_hba.conf
+*/
+static void mgr_refresh_conf_after_init(Relation noderel, HeapTuple aimtuple, char *cndnPath, GetAgentCmdRst *getAgentCmdRst)
+{
+	Form_mgr_node mgr_node = (Form_mgr_node)GETSTRUCT(aimtuple);
+	StringInfoData infosendmsg;
+
+	initStringInfo(&infosendmsg);
+	mgr_node->nodeinited = true;
+	heap_inplace_update(noderel, aimtuple);
+	/*refresh postgresql.conf of this node*/
+	resetStringInfo(&(getAgentCmdRst->description));
+	mgr_add_parameters_pgsqlconf(HeapTupleGetOid(aimtuple), mgr_node->nodetype, mgr_node->nodeport, &infosendmsg);
+	mgr_add_parm(NameStr(mgr_node->nodename), mgr_node->nodetype, &infosendmsg);
+	mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_PGSQLCONF, cndnPath, &infosendmsg, mgr_node->nodehost, getAgentCmdRst);
+	/*refresh pg_hba.conf*/
+	resetStringInfo(&(getAgentCmdRst->description));
+	resetStringInfo(&infosendmsg);
+	mgr_add_parameters_hbaconf((mgr_node->nodemasternameoid == 0)? HeapTupleGetOid(aimtuple):mgr_node->nodemasternameoid
+		, mgr_node->nodetype, &infosendmsg);
+	mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_PGHBACONF, cndnPath, &infosendmsg, mgr_node->nodehost, getAgentCmdRst);
+	pfree(infosendmsg.data);
+}
+
+/*
+* get the path of the node in aimtuple
+*/
+static char *mgr_get_tuple_nodepath(Relation noderel, HeapTuple aimtuple)
+{
+	Datum datumPath;
+	bool isNull = false;
+
+	datumPath = heap_getattr(aimtuple, Anum_mgr_node_nodepath, RelationGetDescr(noderel), &isNull);
+	if(isNull)
 	{
-		mgr_node->nodeinited = true;
-		heap_inplace_update(noderel, aimtuple);
-		/*refresh postgresql.conf of this node*/
-		resetStringInfo(&(getAgentCmdRst->description));
-		resetStringInfo(&infosendmsg);
-		mgr_add_parameters_pgsqlconf(tupleOid, nodetype, cndnport, &infosendmsg);
-		mgr_add_parm(cndnnametmp, nodetype, &infosendmsg);
-		mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_PGSQLCONF, cndnPath, &infosendmsg, hostOid, getAgentCmdRst);
-		/*refresh recovry.conf*/
-		resetStringInfo(&(getAgentCmdRst->description));
-		resetStringInfo(&infosendmsg);
-		mgr_add_parameters_recoveryconf(nodetype, "slave", masteroid, &infosendmsg);
-		mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_RECOVERCONF, cndnPath, &infosendmsg, hostOid, getAgentCmdRst);
+		ereport(ERROR, (errcode(ERRCODE_INTERNAL_ERROR)
+			, err_generic_string(PG_DIAG_TABLE_NAME, "mgr_node")
+			, errmsg("column cndnpath is null")));
 	}
-	pfree(infosendmsg.data);
+	return TextDatumGetCString(datumPath);
+}
+
+/*
+* init all the given coordinators or datanode masters at once: initdb runs on all the hosts
+* at the same time, then the configuration files of the nodes initialized are refreshed.
+* return the result tuples
+*/
+static List *mgr_init_cndn_master_parallel(char nodetype, List *nodenamelist)
+{
+	Relation rel_node;
+	ListCell *lc;
+	HeapTuple aimtuple;
+	HeapTuple *aimtuples;
+	Form_mgr_node mgr_node;
+	AgentCmdParallel *cmds;
+	AgentCmdParallel *cmd;
+	NameData nodenamedata;
+	StringInfoData strinfo;
+	List *results = NIL;
+	char **paths;
+	char *nodestrname;
+	char *nodetypestr;
+	int num = 0;
+	int i;
+
+	cmds = (AgentCmdParallel *) palloc0(sizeof(AgentCmdParallel) * (list_length(nodenamelist) + 1));
+	aimtuples = (HeapTuple *) palloc0(sizeof(HeapTuple) * (list_length(nodenamelist) + 1));
+	paths = (char **) palloc0(sizeof(char *) * (list_length(nodenamelist) + 1));
+	rel_node = heap_open(NodeRelationId, RowExclusiveLock);
+	foreach(lc, nodenamelist)
+	{
+		nodestrname = (char *) lfirst(lc);
+		aimtuple = mgr_get_tuple_node_from_name_type(rel_node, nodestrname, nodetype);
+		if (!HeapTupleIsValid(aimtuple))
+		{
+			heap_close(rel_node, RowExclusiveLock);
+			ereport(ERROR, (errcode(ERRCODE_UNDEFINED_OBJECT),
+				errmsg("%s \"%s\" does not exist", mgr_nodetype_str(nodetype), nodestrname)));
+		}
+		mgr_node = (Form_mgr_node)GETSTRUCT(aimtuple);
+		Assert(mgr_node);
+		if (mgr_node->nodeinited)
+		{
+			initStringInfo(&strinfo);
+			nodetypestr = mgr_nodetype_str(nodetype);
+			appendStringInfo(&strinfo, "%s \"%s\" has been initialized", nodetypestr, nodestrname);
+			namestrcpy(&nodenamedata, nodestrname);
+			results = lappend(results, build_common_command_tuple(&nodenamedata, false, strinfo.data));
+			pfree(nodetypestr);
+			pfree(strinfo.data);
+			heap_freetuple(aimtuple);
+			continue;
+		}
+
+		paths[num] = mgr_get_tuple_nodepath(rel_node, aimtuple);
+		aimtuples[num] = aimtuple;
+		cmd = &cmds[num++];
+		cmd->cmdtype = AGT_CMD_CNDN_CNDN_INIT;
+		cmd->hostoid = mgr_node->nodehost;
+		namestrcpy(&(cmd->result.nodename), nodestrname);
+		initStringInfo(&(cmd->result.description));
+		initStringInfo(&(cmd->cmdstr));
+		appendStringInfo(&(cmd->cmdstr), " -D %s", paths[num-1]);
+		if (with_data_checksums)
+			appendStringInfo(&(cmd->cmdstr), " --nodename %s -E UTF8 --locale=C -k", nodestrname);
+		else
+			appendStringInfo(&(cmd->cmdstr), " --nodename %s -E UTF8 --locale=C", nodestrname);
+	}
+
+	mgr_ma_send_cmd_parallel(cmds, num);
+
+	for (i = 0; i < num; i++)
+	{
+		cmd = &cmds[i];
+		if (cmd->result.ret)
+			mgr_refresh_conf_after_init(rel_node, aimtuples[i], paths[i], &(cmd->result));
+		results = lappend(results, build_common_command_tuple(&(cmd->result.nodename)
+			, cmd->result.ret, cmd->result.description.data));
+		pfree(cmd->cmdstr.data);
+		pfree(cmd->result.description.data);
+		pfree(paths[i]);
+		heap_freetuple(aimtuples[i]);
+	}
+	heap_close(rel_node, RowExclusiveLock);
+	pfree(cmds);
+	pfree(aimtuples);
+	pfree(paths);
+
+	return results;
+}
+
+/*
+* init all the datanode slaves or extras at once: the base backups of all of them run at the
+* same time. the masters not running are started before and stopped after. return the result
+* tuples
+*/
+static List *mgr_init_dn_slave_parallel(char nodetype)
+{
+	Relation rel_node;
+	HeapScanDesc rel_scan;
+	ScanKeyData key[1];
+	HeapTuple tuple;
+	HeapTuple mastertuple;
+	HeapTuple *aimtuples;
+	Form_mgr_node mgr_node;
+	Form_mgr_node mgr_node_master;
+	AgentCmdParallel *cmds;
+	AgentCmdParallel *cmd;
+	StringInfoData strinfo;
+	StringInfoData strinfoport;
+	List *results = NIL;
+	List *tuples = NIL;
+	List *started_masters = NIL;
+	ListCell *lc;
+	char **paths;
+	char *masterhostaddress;
+	char *mastername;
+	char *nodetypestr;
+	char *user;
+	Datum datum;
+	int num = 0;
+	int i;
+
+	ScanKeyInit(&key[0],
+		Anum_mgr_node_nodetype
+		,BTEqualStrategyNumber
+		,F_CHAREQ
+		,CharGetDatum(nodetype));
+	rel_node = heap_open(NodeRelationId, RowExclusiveLock);
+	rel_scan = heap_beginscan(rel_node, SnapshotNow, 1, key);
+	while((tuple = heap_getnext(rel_scan, ForwardScanDirection)) != NULL)
+		tuples = lappend(tuples, heap_copytuple(tuple));
+	heap_endscan(rel_scan);
+
+	cmds = (AgentCmdParallel *) palloc0(sizeof(AgentCmdParallel) * (list_length(tuples) + 1));
+	aimtuples = (HeapTuple *) palloc0(sizeof(HeapTuple) * (list_length(tuples) + 1));
+	paths = (char **) palloc0(sizeof(char *) * (list_length(tuples) + 1));
+	foreach(lc, tuples)
+	{
+		tuple = (HeapTuple) lfirst(lc);
+		mgr_node = (Form_mgr_node)GETSTRUCT(tuple);
+		Assert(mgr_node);
+		if (mgr_node->nodeinited)
+		{
+			initStringInfo(&strinfo);
+			nodetypestr = mgr_nodetype_str(nodetype);
+			appendStringInfo(&strinfo, "%s \"%s\" has been initialized", nodetypestr, NameStr(mgr_node->nodename));
+			results = lappend(results, build_common_command_tuple(&(mgr_node->nodename), false, strinfo.data));
+			pfree(nodetypestr);
+			pfree(strinfo.data);
+			heap_freetuple(tuple);
+			continue;
+		}
+
+		/*get the master port, master host address*/
+		mastertuple = SearchSysCache1(NODENODEOID, ObjectIdGetDatum(mgr_node->nodemasternameoid));
+		if(!HeapTupleIsValid(mastertuple))
+		{
+			ereport(ERROR, (errcode(ERRCODE_UNDEFINED_OBJECT)
+				, errmsg("datanode master \"%s\" does not exist", NameStr(mgr_node->nodename))));
+		}
+		mgr_node_master = (Form_mgr_node)GETSTRUCT(mastertuple);
+		masterhostaddress = get_hostaddress_from_hostoid(mgr_node_master->nodehost);
+		mastername = pstrdup(NameStr(mgr_node_master->nodename));
+
+		/*if datanode master doesnot running, first make it running*/
+		initStringInfo(&strinfoport);
+		appendStringInfo(&strinfoport, "%d", mgr_node_master->nodeport);
+		user = get_hostuser_from_hostoid(mgr_node->nodehost);
+		if (!list_member(started_masters, makeString(mastername))
+			&& pingNode_user(masterhostaddress, strinfoport.data, user) != 0)
+		{
+			datum = DirectFunctionCall1(mgr_start_one_dn_master, CStringGetDatum(mastername));
+			if(DatumGetObjectId(datum) == InvalidOid)
+				ereport(ERROR,
+					(errmsg("start datanode master \"%s\" fail", mastername)));
+			started_masters = lappend(started_masters, makeString(pstrdup(mastername)));
+		}
+		pfree(user);
+		pfree(strinfoport.data);
+
+		paths[num] = mgr_get_tuple_nodepath(rel_node, tuple);
+		aimtuples[num] = tuple;
+		cmd = &cmds[num++];
+		cmd->cmdtype = AGT_CMD_CNDN_SLAVE_INIT;
+		cmd->hostoid = mgr_node->nodehost;
+		namestrcpy(&(cmd->result.nodename), NameStr(mgr_node->nodename));
+		initStringInfo(&(cmd->result.description));
+		initStringInfo(&(cmd->cmdstr));
+		appendStringInfo(&(cmd->cmdstr), " -p %u", mgr_node_master->nodeport);
+		appendStringInfo(&(cmd->cmdstr), " -h %s", masterhostaddress);
+		appendStringInfo(&(cmd->cmdstr), " -D %s", paths[num-1]);
+		appendStringInfo(&(cmd->cmdstr), " -x");
+		appendStringInfoString(&(cmd->cmdstr), MGR_BASEBACKUP_STREAM_COMPRESS);
+		ReleaseSysCache(mastertuple);
+		pfree(masterhostaddress);
+		pfree(mastername);
+	}
+	list_free(tuples);
+
+	mgr_ma_send_cmd_parallel(cmds, num);
+
+	/*stop the datanode masters we started*/
+	foreach(lc, started_masters)
+	{
+		mastername = strVal(lfirst(lc));
+		datum = DirectFunctionCall1(mgr_stop_one_dn_master, CStringGetDatum(mastername));
+		if(DatumGetObjectId(datum) == InvalidOid)
+			ereport(ERROR,
+				(errmsg("stop datanode master \"%s\" fail", mastername)));
+	}
+
+	for (i = 0; i < num; i++)
+	{
+		cmd = &cmds[i];
+		if (cmd->result.ret)
+			mgr_refresh_conf_after_slave_init(rel_node, aimtuples[i], paths[i], &(cmd->result));
+		results = lappend(results, build_common_command_tuple(&(cmd->result.nodename)
+			, cmd->result.ret, cmd->result.description.data));
+		pfree(cmd->cmdstr.data);
+		pfree(cmd->result.description.data);
+		pfree(paths[i]);
+		heap_freetuple(aimtuples[i]);
+	}
+	heap_close(rel_node, RowExclusiveLock);
+	pfree(cmds);
+	pfree(aimtuples);
+	pfree(paths);
+
+	return results;
+}
+
+/*
+* init all the nodes of nodetype at once on the first call, the nodes in nodenamelist for the
+* masters, then return one result tuple on each call
+*/
+static Datum mgr_return_result_list(FunctionCallInfo fcinfo, char nodetype, List *nodenamelist)
+{
+	FuncCallContext *funcctx;
+	ListCell **lcp;
+	HeapTuple tup_result;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		List *results;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+		if (CNDN_TYPE_DATANODE_SLAVE == nodetype || CNDN_TYPE_DATANODE_EXTRA == nodetype)
+			results = mgr_init_dn_slave_parallel(nodetype);
+		else
+			results = mgr_init_cndn_master_parallel(nodetype, nodenamelist);
+		lcp = (ListCell **) palloc(sizeof(ListCell *));
+		*lcp = list_head(results);
+		funcctx->user_fctx = lcp;
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	lcp = (ListCell **) funcctx->user_fctx;
+	if (*lcp == NULL)
+		SRF_RETURN_DONE(funcctx);
+	tup_result = (HeapTuple) lfirst(*lcp);
+	*lcp = lnext(*lcp);
+	SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
 }
 /*
 * get the datanode/coordinator name list
@@ -1505,6 +1697,7 @@ void mgr_runmode_cndn_get_result(const char cmdtype, GetAgentCmdRst *getAgentCmd
 	NameData cndnnamedata;
 	HeapTuple mastertuple;
 	PGconn *pg_conn;
+	List *refresh_plan = NIL;
 
 	getAgentCmdRst->ret = false;
 	initStringInfo(&infosendmsg);
@@ -1663,6 +1856,7 @@ void mgr_runmode_cndn_get_result(const char cmdtype, GetAgentCmdRst *getAgentCmd
 		appendStringInfo(&infosendmsg, " -D %s", cndnPath);
 		appendStringInfo(&infosendmsg, " -U %s", AGTM_USER);
 		appendStringInfo(&infosendmsg, " -x");
+		appendStringInfoString(&infosendmsg, MGR_BASEBACKUP_STREAM_COMPRESS);
 		ReleaseSysCache(gtmmastertuple);
 		/*check it need start gtm master*/
 		initStringInfo(&strinfoport);
@@ -1721,6 +1915,8 @@ void mgr_runmode_cndn_get_result(const char cmdtype, GetAgentCmdRst *getAgentCmd
 	{
 		/*pause cluster*/
 		mgr_lock_cluster(&pg_conn, &cnoid);
+		/*statements refreshing pgxc_node, ready before the cluster waits on the promotion*/
+		refresh_plan = mgr_get_refresh_pgxc_node_plan(PGXC_FAILOVER, nodetype, cndnname, cnoid);
 		/*stop datanode master*/
 		 mastertuple = SearchSysCache1(NODENODEOID, ObjectIdGetDatum(nodemasternameoid));
 		 if(!HeapTupleIsValid(mastertuple))
@@ -1749,27 +1945,12 @@ void mgr_runmode_cndn_get_result(const char cmdtype, GetAgentCmdRst *getAgentCmd
 	{
 		appendStringInfo(&infosendmsg, "rm -rf %s; mkdir -p %s; chmod 0700 %s", cndnPath, cndnPath, cndnPath);
 	}
-	else if (AGT_CMD_GTM_START_MASTER_BACKEND == cmdtype || AGT_CMD_GTM_START_SLAVE_BACKEND == cmdtype)
-	{
-		cmdtype_s = mgr_change_cmdtype_unbackend(cmdtype);
-		appendStringInfo(&infosendmsg, " %s -D %s -o -i -w -c -W -l %s/logfile", cmdmode, cndnPath, cndnPath);
-	}
-	else if (AGT_CMD_GTM_STOP_MASTER_BACKEND == cmdtype || AGT_CMD_GTM_STOP_SLAVE_BACKEND == cmdtype)
-	{
-		cmdtype_s = mgr_change_cmdtype_unbackend(cmdtype);
-		appendStringInfo(&infosendmsg, " %s -D %s -m %s -o -i -w -c -W", cmdmode, cndnPath, shutdown_mode);
-	}
-	else if(AGT_CMD_CN_STOP_BACKEND == cmdtype || AGT_CMD_DN_STOP_BACKEND == cmdtype)
-	{
-		cmdtype_s = mgr_change_cmdtype_unbackend(cmdtype);
-		appendStringInfo(&infosendmsg, " %s -D %s", cmdmode, cndnPath);
-			appendStringInfo(&infosendmsg, " -Z %s -m %s -o -i -w -c -W", zmode, shutdown_mode);
-	}
-	else if (AGT_CMD_CN_START_BACKEND == cmdtype || AGT_CMD_DN_START_BACKEND == cmdtype)
+	else if (AGT_CMD_GTM_START_MASTER_BACKEND == cmdtype || AGT_CMD_GTM_START_SLAVE_BACKEND == cmdtype
+		|| AGT_CMD_GTM_STOP_MASTER_BACKEND == cmdtype || AGT_CMD_GTM_STOP_SLAVE_BACKEND == cmdtype
+		|| AGT_CMD_CN_START_BACKEND == cmdtype || AGT_CMD_DN_START_BACKEND == cmdtype
+		|| AGT_CMD_CN_STOP_BACKEND == cmdtype || AGT_CMD_DN_STOP_BACKEND == cmdtype)
 	{
-		cmdtype_s = mgr_change_cmdtype_unbackend(cmdtype);
-		appendStringInfo(&infosendmsg, " %s -D %s", cmdmode, cndnPath);
-		appendStringInfo(&infosendmsg, " -Z %s -o -i -w -c -W -l %s/logfile", zmode, cndnPath);
+		cmdtype_s = mgr_append_backend_cmd_str(cmdtype, cndnPath, shutdown_mode, &infosendmsg);
 	}
 	else /*dn,cn start*/
 	{
@@ -1846,28 +2027,13 @@ void mgr_runmode_cndn_get_result(const char cmdtype, GetAgentCmdRst *getAgentCmd
 
 	/*update node system table's column to set initial is true when cmd is init*/
 	if (AGT_CMD_CNDN_CNDN_INIT == cmdtype && execok)
-	{
-		mgr_node->nodeinited = true;
-		heap_inplace_update(noderel, aimtuple);
-		/*refresh postgresql.conf of this node*/
-		resetStringInfo(&(getAgentCmdRst->description));
-		resetStringInfo(&infosendmsg);
-		mgr_add_parameters_pgsqlconf(tupleOid, nodetype, cndnport, &infosendmsg);
-		mgr_add_parm(cndnname, nodetype, &infosendmsg);
-		mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_PGSQLCONF, cndnPath, &infosendmsg, hostOid, getAgentCmdRst);
-		/*refresh pg_hba.conf*/
-		resetStringInfo(&(getAgentCmdRst->description));
-		resetStringInfo(&infosendmsg);
-		mgr_add_parameters_hbaconf((mgr_node->nodemasternameoid == 0)? HeapTupleGetOid(aimtuple):mgr_node->nodemasternameoid
-			, nodetype, &infosendmsg);
-		mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_PGHBACONF, cndnPath, &infosendmsg, hostOid, getAgentCmdRst);
-	}
+		mgr_refresh_conf_after_init(noderel, aimtuple, cndnPath, getAgentCmdRst);
 
 	/*failover execute success*/
 	if(AGT_CMD_DN_FAILOVER == cmdtype && execok)
 	{
 		namestrcpy(&cndnnamedata, cndnname);
-		mgr_after_datanode_failover_handle(nodemasternameoid, &cndnnamedata, cndnport, hostaddress, noderel, getAgentCmdRst, aimtuple, cndnPath, nodetype, &pg_conn, cnoid);
+		mgr_after_datanode_failover_handle(nodemasternameoid, &cndnnamedata, cndnport, hostaddress, noderel, getAgentCmdRst, aimtuple, cndnPath, nodetype, &pg_conn, cnoid, refresh_plan);
 	}
 
 	/*gtm failover*/
@@ -1876,6 +2042,7 @@ void mgr_runmode_cndn_get_result(const char cmdtype, GetAgentCmdRst *getAgentCmd
 		mgr_after_gtm_failover_handle(hostaddress, cndnport, noderel, getAgentCmdRst, aimtuple, cndnPath, &pg_conn, cnoid);
 	}
 
+	mgr_free_refresh_pgxc_node_plan(refresh_plan);
 	pfree(infosendmsg.data);
 	pfree(hostaddress);
 }
@@ -2185,24 +2352,108 @@ Datum mgr_runmode_cndn(char nodetype, char cmdtype, List* nodenamelist , char *s
 	SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
 }
 
+/* the nodes of "monitor all", "monitor datanode all" and "monitor gtm all", pinged together at the first call */
+typedef struct MonitorAllInfo
+{
+	int num;
+	int index;
+	NameData *nodename;
+	char *nodetype;
+	int32 *nodeport;
+	NodePingParallel *ping;
+}MonitorAllInfo;
+
+#define MONITOR_ALL_NODE		'a'
+#define MONITOR_ALL_DATANODE	'd'
+#define MONITOR_ALL_GTM			'g'
+
+static bool mgr_monitor_all_match(char filter, char nodetype)
+{
+	switch (filter)
+	{
+		case MONITOR_ALL_DATANODE:
+			return nodetype == CNDN_TYPE_DATANODE_MASTER || nodetype == CNDN_TYPE_DATANODE_SLAVE || nodetype == CNDN_TYPE_DATANODE_EXTRA;
+		case MONITOR_ALL_GTM:
+			return nodetype == GTM_TYPE_GTM_MASTER || nodetype == GTM_TYPE_GTM_SLAVE || nodetype == GTM_TYPE_GTM_EXTRA;
+		default:
+			return true;
+	}
+}
+
 /*
- * MONITOR ALL
- */
-Datum mgr_monitor_all(PG_FUNCTION_ARGS)
+* read the nodes of the filter and ping them all at once, so the command takes the time of the
+* slowest node instead of the sum of all the nodes
+*/
+static MonitorAllInfo *mgr_monitor_all_collect(char filter)
 {
-	FuncCallContext *funcctx;
-	InitNodeInfo *info;
+	MonitorAllInfo *info;
+	Relation rel_node;
+	HeapScanDesc rel_scan;
 	HeapTuple tup;
-	HeapTuple tup_result;
 	Form_mgr_node mgr_node;
-	StringInfoData port;
+	Datum datumpath;
+	bool isNull;
+	int max = 16;
+	char port_buf[16];
+	char path_buf[MAXPGPATH];
+
+	info = palloc0(sizeof(MonitorAllInfo));
+	info->nodename = palloc(sizeof(NameData) * max);
+	info->nodetype = palloc(sizeof(char) * max);
+	info->nodeport = palloc(sizeof(int32) * max);
+	info->ping = palloc0(sizeof(NodePingParallel) * max);
+
+	rel_node = heap_open(NodeRelationId, AccessShareLock);
+	rel_scan = heap_beginscan(rel_node, SnapshotNow, 0, NULL);
+	while ((tup = heap_getnext(rel_scan, ForwardScanDirection)) != NULL)
+	{
+		mgr_node = (Form_mgr_node)GETSTRUCT(tup);
+		Assert(mgr_node);
+		if (!mgr_monitor_all_match(filter, mgr_node->nodetype))
+			continue;
+		if (info->num == max)
+		{
+			max *= 2;
+			info->nodename = repalloc(info->nodename, sizeof(NameData) * max);
+			info->nodetype = repalloc(info->nodetype, sizeof(char) * max);
+			info->nodeport = repalloc(info->nodeport, sizeof(int32) * max);
+			info->ping = repalloc(info->ping, sizeof(NodePingParallel) * max);
+		}
+		namecpy(&(info->nodename[info->num]), &(mgr_node->nodename));
+		info->nodetype[info->num] = mgr_node->nodetype;
+		info->nodeport[info->num] = mgr_node->nodeport;
+
+		datumpath = heap_getattr(tup, Anum_mgr_node_nodepath, RelationGetDescr(rel_node), &isNull);
+		snprintf(path_buf, sizeof(path_buf), "%s/postmaster.pid", isNull ? "" : TextDatumGetCString(datumpath));
+		snprintf(port_buf, sizeof(port_buf), "%d", mgr_node->nodeport);
+		info->ping[info->num].host_addr = get_hostaddress_from_hostoid(mgr_node->nodehost);
+		info->ping[info->num].agent_port = get_agentPort_from_hostoid(mgr_node->nodehost);
+		info->ping[info->num].node_port = pstrdup(port_buf);
+		if (mgr_node->nodetype == GTM_TYPE_GTM_MASTER || mgr_node->nodetype == GTM_TYPE_GTM_SLAVE || mgr_node->nodetype == GTM_TYPE_GTM_EXTRA)
+			info->ping[info->num].node_user = pstrdup(AGTM_USER);
+		else
+			info->ping[info->num].node_user = get_hostuser_from_hostoid(mgr_node->nodehost);
+		info->ping[info->num].pid_file_path = pstrdup(path_buf);
+		info->num++;
+	}
+	heap_endscan(rel_scan);
+	heap_close(rel_node, AccessShareLock);
+
+	pingNode_user_parallel(info->ping, info->num);
+
+	return info;
+}
+
+/* the rows of mgr_monitor_all_collect, one per call */
+static Datum mgr_monitor_all_common(FunctionCallInfo fcinfo, char filter)
+{
+	FuncCallContext *funcctx;
+	MonitorAllInfo *info;
+	NodePingParallel *ping;
+	HeapTuple tup_result;
 	StringInfoData strdata;
 	NameData host;
-	char *host_addr = NULL;
-	char *user = NULL;
 	const char *error_str = NULL;
-	bool is_valid = false;
-	int ret = 0;
 
 	if (SRF_IS_FIRSTCALL())
 	{
@@ -2210,14 +2461,8 @@ Datum mgr_monitor_all(PG_FUNCTION_ARGS)
 
 		funcctx = SRF_FIRSTCALL_INIT();
 		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
-
-		info = palloc(sizeof(*info));
-		info->rel_node = heap_open(NodeRelationId, AccessShareLock);
-		info->rel_scan = heap_beginscan(info->rel_node, SnapshotNow, 0, NULL);
-		info->lcp =NULL;
 		/* save info */
-		funcctx->user_fctx = info;
-
+		funcctx->user_fctx = mgr_monitor_all_collect(filter);
 		MemoryContextSwitchTo(oldcontext);
 	}
 
@@ -2226,31 +2471,16 @@ Datum mgr_monitor_all(PG_FUNCTION_ARGS)
 	info = funcctx->user_fctx;
 	Assert(info);
 
-	tup = heap_getnext(info->rel_scan, ForwardScanDirection);
-	if(tup == NULL)
-	{
-		/* end of row */
-		heap_endscan(info->rel_scan);
-		heap_close(info->rel_node, AccessShareLock);
-		pfree(info);
+	if (info->index >= info->num)
 		SRF_RETURN_DONE(funcctx);
-	}
-
-	mgr_node = (Form_mgr_node)GETSTRUCT(tup);
-	Assert(mgr_node);
 
-	host_addr = get_hostaddress_from_hostoid(mgr_node->nodehost);
-	user = get_hostuser_from_hostoid(mgr_node->nodehost);
-	initStringInfo(&port);
-	appendStringInfo(&port, "%d", mgr_node->nodeport);
-	is_valid = is_valid_ip(host_addr);
-	if (is_valid)
+	ping = &(info->ping[info->index]);
+	initStringInfo(&strdata);
+	if (!ping->host_valid)
+		error_str = "could not establish host connection";
+	else
 	{
-		if (mgr_node->nodetype == GTM_TYPE_GTM_MASTER || mgr_node->nodetype == GTM_TYPE_GTM_SLAVE || mgr_node->nodetype == GTM_TYPE_GTM_EXTRA)
-			ret = pingNode_user(host_addr, port.data, AGTM_USER);
-		else
-			ret = pingNode_user(host_addr, port.data, user);
-		switch (ret)
+		switch (ping->ret)
 		{
 			case PQPING_OK:
 				error_str = "running";
@@ -2265,147 +2495,42 @@ Datum mgr_monitor_all(PG_FUNCTION_ARGS)
 				error_str = "connection not attempted (bad params)";
 				break;
 			case AGENT_DOWN:
-			{
-				initStringInfo(&strdata);
-				appendStringInfo(&strdata, "could not connect socket for agent \"%s\"", host_addr);
+				appendStringInfo(&strdata, "could not connect socket for agent \"%s\"", ping->host_addr);
 				error_str = strdata.data;
 				break;
-			}
 			default:
+				error_str = "unknown the type of ping node return";
 				break;
 		}
 	}
-	else
-		error_str = "could not establish host connection";
 
-	namestrcpy(&host, host_addr);
+	namestrcpy(&host, ping->host_addr);
 	tup_result = build_common_command_tuple_for_monitor(
-				&(mgr_node->nodename)
-				,mgr_node->nodetype
-				,ret == PQPING_OK ? true:false
+				&(info->nodename[info->index])
+				,info->nodetype[info->index]
+				,ping->host_valid && ping->ret == PQPING_OK
 				,error_str
 				,&host
-				,mgr_node->nodeport);
-	if(AGENT_DOWN == ret)
-		pfree(strdata.data);
-	pfree(port.data);
-	pfree(host_addr);
-	pfree(user);
+				,info->nodeport[info->index]);
+	pfree(strdata.data);
+	info->index++;
 	SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
 }
 
+/*
+ * MONITOR ALL
+ */
+Datum mgr_monitor_all(PG_FUNCTION_ARGS)
+{
+	return mgr_monitor_all_common(fcinfo, MONITOR_ALL_NODE);
+}
+
 /*
  * MONITOR DATANODE ALL;
  */
 Datum mgr_monitor_datanode_all(PG_FUNCTION_ARGS)
 {
-	FuncCallContext *funcctx;
-	InitNodeInfo *info;
-	HeapTuple tup;
-	HeapTuple tup_result;
-	Form_mgr_node mgr_node;
-	StringInfoData port;
-	StringInfoData strdata;
-	NameData host;
-	char *host_addr = NULL;
-	bool is_valid = false;
-	const char *error_str = NULL;
-	char *user;
-	int ret = 0;
-
-	if (SRF_IS_FIRSTCALL())
-	{
-		MemoryContext oldcontext;
-
-		funcctx = SRF_FIRSTCALL_INIT();
-		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
-
-		info = palloc(sizeof(*info));
-		info->rel_node = heap_open(NodeRelationId, AccessShareLock);
-		info->rel_scan = heap_beginscan(info->rel_node, SnapshotNow, 0, NULL);
-		info->lcp =NULL;
-
-		/* save info */
-		funcctx->user_fctx = info;
-
-		MemoryContextSwitchTo(oldcontext);
-	}
-
-	funcctx = SRF_PERCALL_SETUP();
-	Assert(funcctx);
-	info = funcctx->user_fctx;
-	Assert(info);
-
-	while ((tup = heap_getnext(info->rel_scan, ForwardScanDirection)) != NULL)
-	{
-		mgr_node = (Form_mgr_node)GETSTRUCT(tup);
-		Assert(mgr_node);
-
-		/* if node type is datanode master ,datanode slave ,datanode extra. */
-		if (mgr_node->nodetype == CNDN_TYPE_DATANODE_MASTER || mgr_node->nodetype == CNDN_TYPE_DATANODE_SLAVE || mgr_node->nodetype == CNDN_TYPE_DATANODE_EXTRA)
-		{
-			host_addr = get_hostaddress_from_hostoid(mgr_node->nodehost);
-			user = get_hostuser_from_hostoid(mgr_node->nodehost);
-			initStringInfo(&port);
-			appendStringInfo(&port, "%d", mgr_node->nodeport);
-
-			is_valid = is_valid_ip(host_addr);
-			if (is_valid)
-			{
-				ret = pingNode_user(host_addr, port.data, user);
-				switch (ret)
-				{
-					case PQPING_OK:
-						error_str = "running";
-						break;
-					case PQPING_REJECT:
-						error_str = "server is alive but rejecting connections";
-						break;
-					case PQPING_NO_RESPONSE:
-						error_str = "not running";
-						break;
-					case PQPING_NO_ATTEMPT:
-						error_str = "connection not attempted (bad params)";
-						break;
-					case AGENT_DOWN:
-					{
-						initStringInfo(&strdata);
-						appendStringInfo(&strdata, "could not connect socket for agent \"%s\"", host_addr);
-						error_str = strdata.data;
-						break;
-					}
-					default:
-						error_str = "unknown the type of ping node return";
-						break;
-				}
-			}
-			else
-				error_str = "could not establish host connection";
-
-			namestrcpy(&host, host_addr);
-			tup_result = build_common_command_tuple_for_monitor(
-						&(mgr_node->nodename)
-						,mgr_node->nodetype
-						,ret == 0 ? true:false
-						,error_str
-						,&host
-						,mgr_node->nodeport);
-
-			pfree(user);
-			pfree(port.data);
-			pfree(host_addr);
-			if(AGENT_DOWN == ret)
-				pfree(strdata.data);
-			SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
-		}
-		else
-			continue;
-	}
-
-	heap_endscan(info->rel_scan);
-	heap_close(info->rel_node, AccessShareLock);
-	pfree(info);
-	SRF_RETURN_DONE(funcctx);
+	return mgr_monitor_all_common(fcinfo, MONITOR_ALL_DATANODE);
 }
 
 /*
@@ -2413,109 +2538,7 @@ Datum mgr_monitor_datanode_all(PG_FUNCTION_ARGS)
  */
 Datum mgr_monitor_gtm_all(PG_FUNCTION_ARGS)
 {
-	FuncCallContext *funcctx;
-	InitNodeInfo *info;
-	HeapTuple tup;
-	HeapTuple tup_result;
-	Form_mgr_node mgr_node;
-	StringInfoData port;
-	StringInfoData strdata;
-	NameData host;
-	char *host_addr;
-	bool is_valid = false;
-	const char *error_str = NULL;
-	int ret = 0;
-
-	if (SRF_IS_FIRSTCALL())
-	{
-		MemoryContext oldcontext;
-
-		funcctx = SRF_FIRSTCALL_INIT();
-		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
-
-		info = palloc(sizeof(*info));
-		info->rel_node = heap_open(NodeRelationId, AccessShareLock);
-		info->rel_scan = heap_beginscan(info->rel_node, SnapshotNow, 0, NULL);
-		info->lcp =NULL;
-
-		/* save info */
-		funcctx->user_fctx = info;
-
-		MemoryContextSwitchTo(oldcontext);
-	}
-
-	funcctx = SRF_PERCALL_SETUP();
-	Assert(funcctx);
-	info = funcctx->user_fctx;
-	Assert(info);
-
-	while ((tup = heap_getnext(info->rel_scan, ForwardScanDirection)) != NULL)
-	{
-		mgr_node = (Form_mgr_node)GETSTRUCT(tup);
-		Assert(mgr_node);
-
-		/* if node type is gtm master ,gtm slave ,gtm extra. */
-		if (mgr_node->nodetype == GTM_TYPE_GTM_MASTER || mgr_node->nodetype == GTM_TYPE_GTM_SLAVE || mgr_node->nodetype == GTM_TYPE_GTM_EXTRA)
-		{
-			host_addr = get_hostaddress_from_hostoid(mgr_node->nodehost);
-			initStringInfo(&port);
-			appendStringInfo(&port, "%d", mgr_node->nodeport);
-
-			is_valid = is_valid_ip(host_addr);
-			if (is_valid)
-			{
-				ret = pingNode_user(host_addr, port.data, AGTM_USER);
-				switch (ret)
-				{
-					case PQPING_OK:
-						error_str = "running";
-						break;
-					case PQPING_REJECT:
-						error_str = "server is alive but rejecting connections";
-						break;
-					case PQPING_NO_RESPONSE:
-						error_str = "not running";
-						break;
-					case PQPING_NO_ATTEMPT:
-						error_str = "connection not attempted (bad params)";
-						break;
-					case AGENT_DOWN:
-					{
-						initStringInfo(&strdata);
-						appendStringInfo(&strdata, "could not connect socket for agent \"%s\"", host_addr);
-						error_str = strdata.data;
-						break;
-					}
-					default:
-						error_str = "unknown the type of ping node return";
-						break;
-				}
-			}
-			else
-				error_str = "could not establish host connection";
-
-			namestrcpy(&host, host_addr);
-			tup_result = build_common_command_tuple_for_monitor(
-						&(mgr_node->nodename)
-						,mgr_node->nodetype
-						,ret == 0 ? true:false
-						,error_str
-						,&host
-						,mgr_node->nodeport);
-			pfree(port.data);
-			pfree(host_addr);
-			if(AGENT_DOWN == ret)
-				pfree(strdata.data);
-			SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
-		}
-		else
-			continue;
-	}
-
-	heap_endscan(info->rel_scan);
-	heap_close(info->rel_node, AccessShareLock);
-	pfree(info);
-	SRF_RETURN_DONE(funcctx);
+	return mgr_monitor_all_common(fcinfo, MONITOR_ALL_GTM);
 }
 
 /*
@@ -4576,7 +4599,7 @@ void mgr_pgbasebackup(char nodetype, AppendNodeInfo *appendnodeinfo, AppendNodeI
 
 	if (nodetype == GTM_TYPE_GTM_SLAVE || nodetype == GTM_TYPE_GTM_EXTRA)
 	{
-		appendStringInfo(&sendstrmsg, " -h %s -p %d -U %s -D %s -Xs -Fp -R",
+		appendStringInfo(&sendstrmsg, " -h %s -p %d -U %s -D %s -Xs -Fp -R" MGR_BASEBACKUP_STREAM_COMPRESS,
 									get_hostaddress_from_hostoid(parentnodeinfo->nodehost)
 									,parentnodeinfo->nodeport
 									,AGTM_USER
@@ -4585,7 +4608,7 @@ void mgr_pgbasebackup(char nodetype, AppendNodeInfo *appendnodeinfo, AppendNodeI
 	}
 	else if (nodetype == CNDN_TYPE_DATANODE_SLAVE || nodetype == CNDN_TYPE_DATANODE_EXTRA)
 	{
-		appendStringInfo(&sendstrmsg, " -h %s -p %d -U %s -D %s -Xs -Fp -R",
+		appendStringInfo(&sendstrmsg, " -h %s -p %d -U %s -D %s -Xs -Fp -R" MGR_BASEBACKUP_STREAM_COMPRESS,
 									get_hostaddress_from_hostoid(parentnodeinfo->nodehost)
 									,parentnodeinfo->nodeport
 									,get_hostuser_from_hostoid(parentnodeinfo->nodehost)
@@ -6309,6 +6332,158 @@ void mgr_send_conf_parameters(char filetype, char *datapath, StringInfo infosend
 	ma_close(ma);
 }
 
+/*
+* read the result of one command and the idle message which follows it, so that the next
+* command sent on the same connection gets its own result. return false if the connection
+* is broken
+*/
+static bool mgr_recv_msg_until_idle(ManagerAgent *ma, GetAgentCmdRst *getAgentCmdRst)
+{
+	char msg_type;
+	StringInfoData recvbuf;
+
+	initStringInfo(&recvbuf);
+	for(;;)
+	{
+		resetStringInfo(&recvbuf);
+		msg_type = ma_get_message(ma, &recvbuf);
+		if(msg_type == AGT_MSG_IDLE)
+		{
+			/* command end */
+			break;
+		}else if(msg_type == '\0')
+		{
+			/* has an error */
+			getAgentCmdRst->ret = false;
+			if (getAgentCmdRst->description.len == 0)
+				appendStringInfoString(&(getAgentCmdRst->description), ma_last_error_msg(ma));
+			pfree(recvbuf.data);
+			return false;
+		}else if(msg_type == AGT_MSG_ERROR)
+		{
+			/* error message, the agent sends the idle message after it */
+			getAgentCmdRst->ret = false;
+			appendStringInfoString(&(getAgentCmdRst->description), ma_get_err_info(&recvbuf, AGT_MSG_RESULT));
+			ereport(LOG, (errmsg("receive msg: %s", ma_get_err_info(&recvbuf, AGT_MSG_RESULT))));
+		}else if(msg_type == AGT_MSG_NOTICE)
+		{
+			/* ignore notice message */
+			ereport(LOG, (errmsg("receive msg: %s", ma_get_err_info(&recvbuf, AGT_MSG_RESULT))));
+		}
+		else if(msg_type == AGT_MSG_RESULT)
+		{
+			getAgentCmdRst->ret = true;
+			appendStringInfoString(&(getAgentCmdRst->description), run_success);
+			ereport(DEBUG1, (errmsg("receive msg: %s", recvbuf.data)));
+		}
+	}
+	pfree(recvbuf.data);
+	return true;
+}
+
+/*
+* the same as mgr_send_conf_parameters for many nodes at once: cmds[i].cmdtype is the filetype,
+* cmds[i].cmdstr the datapath and the parameters of infosendmsg go to every node. the nodes of
+* one host share one connection, all their commands are sent in one round, and every host works
+* at the same time. the caller initializes result.description of each command
+*/
+void mgr_send_conf_parameters_parallel(AgentCmdParallel *cmds, int num, StringInfo infosendmsg)
+{
+	AgentCmdParallel *cmd;
+	StringInfoData sendstrmsg;
+	StringInfoData buf;
+	int i;
+	int j;
+
+	initStringInfo(&sendstrmsg);
+	for (i = 0; i < num; i++)
+	{
+		cmd = &cmds[i];
+		cmd->result.ret = false;
+		cmd->ma = NULL;
+		/* the connection is opened for the first node of the host */
+		for (j = 0; j < i; j++)
+		{
+			if (cmds[j].hostoid == cmd->hostoid)
+				break;
+		}
+		if (j < i)
+		{
+			cmd->ma = cmds[j].ma;
+			if (cmd->ma == NULL)
+			{
+				appendStringInfoString(&(cmd->result.description), cmds[j].result.description.data);
+				continue;
+			}
+		}
+		else
+		{
+			cmd->ma = ma_connect_hostoid(cmd->hostoid);
+			if (!ma_isconnected(cmd->ma))
+			{
+				appendStringInfoString(&(cmd->result.description), ma_last_error_msg(cmd->ma));
+				ma_close(cmd->ma);
+				cmd->ma = NULL;
+				continue;
+			}
+		}
+
+		resetStringInfo(&sendstrmsg);
+		appendStringInfoString(&sendstrmsg, cmd->cmdstr.data);
+		appendStringInfoCharMacro(&sendstrmsg, '\0');
+		mgr_append_infostr_infostr(&sendstrmsg, infosendmsg);
+		ma_beginmessage(&buf, AGT_MSG_COMMAND);
+		ma_sendbyte(&buf, cmd->cmdtype);
+		mgr_append_infostr_infostr(&buf, &sendstrmsg);
+		ma_endmessage(&buf, cmd->ma);
+	}
+	pfree(sendstrmsg.data);
+
+	/* one flush per host, after all the commands of its nodes */
+	for (i = 0; i < num; i++)
+	{
+		cmd = &cmds[i];
+		if (cmd->ma == NULL)
+			continue;
+		for (j = 0; j < i; j++)
+		{
+			if (cmds[j].ma == cmd->ma)
+				break;
+		}
+		if (j < i || ma_flush(cmd->ma, false))
+			continue;
+		appendStringInfoString(&(cmd->result.description), ma_last_error_msg(cmd->ma));
+		for (j = i + 1; j < num; j++)
+		{
+			if (cmds[j].ma == cmd->ma)
+			{
+				appendStringInfoString(&(cmds[j].result.description), cmd->result.description.data);
+				cmds[j].ma = NULL;
+			}
+		}
+		ma_close(cmd->ma);
+		cmd->ma = NULL;
+	}
+
+	/* the agent of a host answers the commands in the order they were sent */
+	for (i = 0; i < num; i++)
+	{
+		cmd = &cmds[i];
+		if (cmd->ma == NULL)
+			continue;
+		mgr_recv_msg_until_idle(cmd->ma, &(cmd->result));
+		for (j = i + 1; j < num; j++)
+		{
+			if (cmds[j].ma == cmd->ma)
+				break;
+		}
+		/* the last node of the host closes the connection */
+		if (j == num)
+			ma_close(cmd->ma);
+		cmd->ma = NULL;
+	}
+}
+
 /*
 * add key value to infosendmsg, use '\0' to interval, both the key value the type are char*
 */
@@ -7162,7 +7337,7 @@ static void mgr_after_gtm_failover_handle(char *hostaddress, int cndnport, Relat
 * 8.change the datanode  extra dn1's recovery.conf and restart it
 *
 */
-static void mgr_after_datanode_failover_handle(Oid nodemasternameoid, Name cndnname, int cndnport,char *hostaddress, Relation noderel, GetAgentCmdRst *getAgentCmdRst, HeapTuple aimtuple, char *cndnPath, char aimtuplenodetype, PGconn **pg_conn, Oid cnoid)
+static void mgr_after_datanode_failover_handle(Oid nodemasternameoid, Name cndnname, int cndnport,char *hostaddress, Relation noderel, GetAgentCmdRst *getAgentCmdRst, HeapTuple aimtuple, char *cndnPath, char aimtuplenodetype, PGconn **pg_conn, Oid cnoid, List *refresh_plan)
 {
 	StringInfoData infosendmsg;
 	StringInfoData recorderr;
@@ -7198,8 +7373,8 @@ static void mgr_after_datanode_failover_handle(Oid nodemasternameoid, Name cndnn
 	/*check recovery finish*/
 	mgr_check_node_connect(mgr_node->nodetype, mgr_node->nodehost, mgr_node->nodeport);
 
-	/*refresh pgxc_node on all coordiantors*/
-	getrefresh = mgr_pqexec_refresh_pgxc_node(PGXC_FAILOVER, mgr_node->nodetype, NameStr(mgr_node->nodename), getAgentCmdRst, pg_conn, cnoid);
+	/*refresh pgxc_node on all coordiantors, the plan was made before the promotion*/
+	getrefresh = mgr_pqexec_refresh_pgxc_node_plan(refresh_plan, getAgentCmdRst, pg_conn, cnoid);
 	if(!getrefresh)
 	{
 		getAgentCmdRst->ret = getrefresh;
@@ -10750,31 +10925,117 @@ void mgr_unlock_cluster(PGconn **pg_conn)
 	PQfinish(*pg_conn);
 }
 
-bool mgr_pqexec_refresh_pgxc_node(pgxc_node_operator cmd, char nodetype, char *dnname, GetAgentCmdRst *getAgentCmdRst, PGconn **pg_conn, Oid cnoid)
+/*
+* the statements refreshing pgxc_node on one coordinator: altersql changes the address of all
+* the datanodes at once, reloadsql reloads its pooler
+*/
+typedef struct RefreshPgxcNodeStmt
+{
+	NameData cnname;
+	char *altersql;
+	char *reloadsql;
+}RefreshPgxcNodeStmt;
+
+/*
+* get the statements refreshing pgxc_node on all the coordinators through the coordinator
+* cnoid, one RefreshPgxcNodeStmt per coordinator. for a failover, the plan only reads the
+* catalog, so it is made before the promotion and run as soon as the new master accepts
+* connections. return NIL if there is no coordinator
+*/
+static List *mgr_get_refresh_pgxc_node_plan(pgxc_node_operator cmd, char nodetype, char *dnname, Oid cnoid)
 {
 	struct tuple_cndn *prefer_cndn;
 	ListCell *lc_out, *dn_lc;
 	int coordinator_num = 0, datanode_num = 0;
 	HeapTuple tuple_in, tuple_out;
 	StringInfoData cmdstring;
-	StringInfoData recorderr;
 	Form_mgr_node mgr_node_out, mgr_node_in;
-	Form_mgr_node mgr_node;
+	RefreshPgxcNodeStmt *stmt;
+	List *plan = NIL;
 	char *host_address;
+	bool is_local;
 	bool is_preferred = false;
+
+	prefer_cndn = get_new_pgxc_node(cmd, dnname, nodetype);
+	if(!PointerIsValid(prefer_cndn->coordiantor_list))
+		return NIL;
+
+	initStringInfo(&cmdstring);
+	coordinator_num = 0;
+	foreach(lc_out, prefer_cndn->coordiantor_list)
+	{
+		coordinator_num = coordinator_num + 1;
+		tuple_out = (HeapTuple)lfirst(lc_out);
+		mgr_node_out = (Form_mgr_node)GETSTRUCT(tuple_out);
+		Assert(mgr_node_out);
+		is_local = (cnoid == HeapTupleGetOid(tuple_out));
+		stmt = (RefreshPgxcNodeStmt *) palloc0(sizeof(RefreshPgxcNodeStmt));
+		namestrcpy(&(stmt->cnname), NameStr(mgr_node_out->nodename));
+
+		/* one statement for all the datanodes, pg_alter_node can run again if it fails */
+		resetStringInfo(&cmdstring);
+		if (is_local)
+			appendStringInfoString(&cmdstring, "select ");
+		else
+			appendStringInfo(&cmdstring, "EXECUTE DIRECT ON (\"%s\") 'select ", NameStr(mgr_node_out->nodename));
+		datanode_num = 0;
+		foreach(dn_lc, prefer_cndn->datanode_list)
+		{
+			datanode_num = datanode_num +1;
+			tuple_in = (HeapTuple)lfirst(dn_lc);
+			mgr_node_in = (Form_mgr_node)GETSTRUCT(tuple_in);
+			Assert(mgr_node_in);
+			host_address = get_hostaddress_from_hostoid(mgr_node_in->nodehost);
+			is_preferred = (coordinator_num == datanode_num);
+			appendStringInfo(&cmdstring, is_local ? "%spg_alter_node('%s', '%s', %d, %s)" : "%spg_alter_node(''%s'', ''%s'', %d, %s)"
+							,datanode_num == 1 ? "" : " and "
+							,NameStr(mgr_node_in->nodename)
+							,host_address
+							,mgr_node_in->nodeport
+							,true == is_preferred ? "true":"false");
+			pfree(host_address);
+		}
+		if (datanode_num == 0)
+			appendStringInfoString(&cmdstring, "true");
+		appendStringInfoString(&cmdstring, is_local ? ";" : ";'");
+		stmt->altersql = pstrdup(cmdstring.data);
+
+		resetStringInfo(&cmdstring);
+		if (is_local)
+			appendStringInfo(&cmdstring, "%s", "select pgxc_pool_reload();");
+		else
+			appendStringInfo(&cmdstring, "EXECUTE DIRECT ON (\"%s\") 'select pgxc_pool_reload();'", NameStr(mgr_node_out->nodename));
+		stmt->reloadsql = pstrdup(cmdstring.data);
+
+		plan = lappend(plan, stmt);
+	}
+	pfree(cmdstring.data);
+
+	return plan;
+}
+
+/*
+* run the statements of mgr_get_refresh_pgxc_node_plan on pg_conn, connected to the coordinator
+* cnoid: two statements per coordinator
+*/
+static bool mgr_pqexec_refresh_pgxc_node_plan(List *plan, GetAgentCmdRst *getAgentCmdRst, PGconn **pg_conn, Oid cnoid)
+{
+	ListCell *lc;
+	RefreshPgxcNodeStmt *stmt;
+	StringInfoData recorderr;
+	HeapTuple cn_tuple;
+	Form_mgr_node mgr_node;
+	NameData cnnamedata;
 	bool result = true;
 	const int maxnum = 15;
+	char *sqls[2];
 	int try = 0;
-	HeapTuple cn_tuple;
-	NameData cnnamedata;
+	int i;
 
-	initStringInfo(&recorderr);
 	resetStringInfo(&(getAgentCmdRst->description));
-	prefer_cndn = get_new_pgxc_node(cmd, dnname, nodetype);
-	if(!PointerIsValid(prefer_cndn->coordiantor_list))
+	if (plan == NIL)
 	{
 		appendStringInfoString(&(getAgentCmdRst->description),"not exist coordinator in the cluster");
-		appendStringInfoString(&recorderr, "not exist coordinator in the cluster\n");
 		return false;
 	}
 
@@ -10790,72 +11051,25 @@ bool mgr_pqexec_refresh_pgxc_node(pgxc_node_operator cmd, char nodetype, char *d
 	namestrcpy(&cnnamedata, NameStr(mgr_node->nodename));
 	ReleaseSysCache(cn_tuple);
 
-	initStringInfo(&cmdstring);
-	coordinator_num = 0;
-	foreach(lc_out, prefer_cndn->coordiantor_list)
+	initStringInfo(&recorderr);
+	foreach(lc, plan)
 	{
-		coordinator_num = coordinator_num + 1;
-		tuple_out = (HeapTuple)lfirst(lc_out);
-		mgr_node_out = (Form_mgr_node)GETSTRUCT(tuple_out);
-		Assert(mgr_node_out);
-		datanode_num = 0;
-		foreach(dn_lc, prefer_cndn->datanode_list)
+		stmt = (RefreshPgxcNodeStmt *) lfirst(lc);
+		sqls[0] = stmt->altersql;
+		sqls[1] = stmt->reloadsql;
+		for (i = 0; i < 2; i++)
 		{
-			datanode_num = datanode_num +1;
-			tuple_in = (HeapTuple)lfirst(dn_lc);
-			mgr_node_in = (Form_mgr_node)GETSTRUCT(tuple_in);
-			Assert(mgr_node_in);
-			host_address = get_hostaddress_from_hostoid(mgr_node_in->nodehost);
-			if(coordinator_num == datanode_num)
-			{
-				is_preferred = true;
-			}
-			else
-			{
-				is_preferred = false;
-			}
-			resetStringInfo(&cmdstring);
-			if (cnoid == HeapTupleGetOid(tuple_out))
-				appendStringInfo(&cmdstring, "select pg_alter_node('%s', '%s', %d, %s);"
-								,NameStr(mgr_node_in->nodename)
-								,host_address
-								,mgr_node_in->nodeport
-								,true == is_preferred ? "true":"false");
-			else
-				appendStringInfo(&cmdstring, "EXECUTE DIRECT ON (\"%s\") 'select pg_alter_node(''%s'', ''%s'', %d, %s);'"
-								,NameStr(mgr_node_out->nodename)
-								,NameStr(mgr_node_in->nodename)
-								,host_address
-								,mgr_node_in->nodeport
-								,true == is_preferred ? "true":"false");
-			pfree(host_address);
-			ereport(LOG, (errmsg("on coordinator \"%s\" execute \"%s\"", cnnamedata.data, cmdstring.data)));
-			try = mgr_pqexec_boolsql_try_maxnum(pg_conn, cmdstring.data, maxnum);
-			if (try<0)
+			ereport(LOG, (errmsg("on coordinator \"%s\" execute \"%s\"", cnnamedata.data, sqls[i])));
+			try = mgr_pqexec_boolsql_try_maxnum(pg_conn, sqls[i], maxnum);
+			if (try < 0)
 			{
 				result = false;
 				ereport(WARNING, (errcode(ERRCODE_DATA_EXCEPTION)
-					,errmsg("on coordinator \"%s\" execute \"%s\" fail %s", cnnamedata.data, cmdstring.data, PQerrorMessage((PGconn*)*pg_conn))));
-				appendStringInfo(&recorderr, "on coordinator \"%s\" execute \"%s\" fail %s\n", cnnamedata.data, cmdstring.data, PQerrorMessage((PGconn*)*pg_conn));
+					,errmsg("on coordinator \"%s\" execute \"%s\" fail %s", cnnamedata.data, sqls[i], PQerrorMessage((PGconn*)*pg_conn))));
+				appendStringInfo(&recorderr, "on coordinator \"%s\" execute \"%s\" fail %s\n", cnnamedata.data, sqls[i], PQerrorMessage((PGconn*)*pg_conn));
 			}
 		}
-		resetStringInfo(&cmdstring);
-		if (cnoid == HeapTupleGetOid(tuple_out))
-			appendStringInfo(&cmdstring, "%s", "select pgxc_pool_reload();");
-		else
-			appendStringInfo(&cmdstring, "EXECUTE DIRECT ON (\"%s\") 'select pgxc_pool_reload();'", NameStr(mgr_node_out->nodename));
-		pg_usleep(100000L);
-		ereport(LOG, (errmsg("on coordinator \"%s\" execute \"%s\"", cnnamedata.data, cmdstring.data)));
-		try = mgr_pqexec_boolsql_try_maxnum(pg_conn, cmdstring.data, maxnum);
-		if (try < 0)
-		{
-			result = false;
-			ereport(WARNING, (errcode(ERRCODE_DATA_EXCEPTION)
-				,errmsg("on coordinator \"%s\" execute \"%s\" fail %s", cnnamedata.data, cmdstring.data, PQerrorMessage((PGconn*)*pg_conn))));
-			appendStringInfo(&recorderr, "on coordinator \"%s\" execute \"%s\" fail %s\n", cnnamedata.data, cmdstring.data, PQerrorMessage((PGconn*)*pg_conn));
-		}
 	}
-	pfree(cmdstring.data);
 	if (recorderr.len > 0)
 	{
 		appendStringInfo(&(getAgentCmdRst->description), "%s", recorderr.data);
@@ -10865,6 +11079,32 @@ bool mgr_pqexec_refresh_pgxc_node(pgxc_node_operator cmd, char nodetype, char *d
 	return result;
 }
 
+static void mgr_free_refresh_pgxc_node_plan(List *plan)
+{
+	ListCell *lc;
+	RefreshPgxcNodeStmt *stmt;
+
+	foreach(lc, plan)
+	{
+		stmt = (RefreshPgxcNodeStmt *) lfirst(lc);
+		pfree(stmt->altersql);
+		pfree(stmt->reloadsql);
+	}
+	list_free_deep(plan);
+}
+
+bool mgr_pqexec_refresh_pgxc_node(pgxc_node_operator cmd, char nodetype, char *dnname, GetAgentCmdRst *getAgentCmdRst, PGconn **pg_conn, Oid cnoid)
+{
+	List *plan;
+	bool result;
+
+	plan = mgr_get_refresh_pgxc_node_plan(cmd, nodetype, dnname, cnoid);
+	result = mgr_pqexec_refresh_pgxc_node_plan(plan, getAgentCmdRst, pg_conn, cnoid);
+	mgr_free_refresh_pgxc_node_plan(plan);
+
+	return result;
+}
+
 /*
 * try maxnum to execute the sql, the result of sql if bool type
 */
@@ -11584,11 +11824,15 @@ static void exec_remove_coordinator(char *nodename)
 	release_append_node_info(&remove_node_info, false);
 }
 /*
-* check the node pingNode ok max_try times
+* check the node pingNode ok within max_times seconds, the node is pinged every
+* MGR_PINGNODE_INTERVAL_MS so a node which comes up is seen soon
 */
+#define MGR_PINGNODE_INTERVAL_MS	200
+
 bool mgr_try_max_pingnode(char *host, char *port, char *user, const int max_times)
 {
 	int ret = 0;
+	int max_tries = max_times * (1000 / MGR_PINGNODE_INTERVAL_MS);
 
 	/*wait the node can accept connections*/
 	fputs(_("waiting for the new node can accept connections..."), stdout);
@@ -11598,16 +11842,19 @@ bool mgr_try_max_pingnode(char *host, char *port, char *user, const int max_time
 		ret++;
 		if (pingNode_user(host, port, user) != 0)
 		{
-			fputs(_("."), stdout);
-			fflush(stdout);
-			pg_usleep(1 * 1000000L);
+			if (ret % (1000 / MGR_PINGNODE_INTERVAL_MS) == 0)
+			{
+				fputs(_("."), stdout);
+				fflush(stdout);
+			}
+			pg_usleep(MGR_PINGNODE_INTERVAL_MS * 1000L);
 		}
 		else
 			break;
-		if (ret > max_times)
+		if (ret > max_tries)
 			break;
 	}
-	if (ret > max_times)
+	if (ret > max_tries)
 	{
 		fputs(_(" failed\n"), stdout);
 	}
@@ -11615,7 +11862,7 @@ bool mgr_try_max_pingnode(char *host, char *port, char *user, const int max_time
 		fputs(_(" done\n"), stdout);
 	fflush(stdout);
 
-	return ret < max_times;
+	return ret <= max_tries;
 }
 
 /*
@@ -96,6 +96,7 @@ static void mgr_check_parm_in_pgconf(Relation noderel, char parmtype, Name key,
 static int mgr_check_parm_in_updatetbl(Relation noderel, char nodetype, Name nodename, Name key, char *value);
 static void mgr_reload_parm(Relation noderel, char *nodename, char nodetype, StringInfo paramstrdata, int effectparmstatus, bool bforce);
 static void mgr_updateparm_send_parm(GetAgentCmdRst *getAgentCmdRst, Oid hostoid, char *nodepath, StringInfo paramstrdata, int effectparmstatus, bool bforce);
+static char mgr_updateparm_conf_cmdtype(int effectparmstatus, bool bforce);
 static int mgr_delete_tuple_not_all(Relation noderel, char nodetype, Name key);
 static int mgr_check_parm_value(char *name, char *value, int vartype, char *parmunit, char *parmmin, char *parmmax, StringInfo enumvalue);
 static int mgr_get_parm_unit_type(char *nodename, char *parmunit);
@@ -885,11 +886,18 @@ static void mgr_reload_parm(Relation noderel, char *nodename, char nodetype, Str
 	char *nodepath;
 	char *nodetypestr;
 	bool isNull;
+	AgentCmdParallel *cmds;
+	AgentCmdParallel *cmd;
+	StringInfoData failnodes;
+	int num = 0;
+	int maxnum = 16;
+	int i;
 
 	initStringInfo(&(getAgentCmdRst.description));
-	/*nodename is MACRO_STAND_FOR_ALL_NODENAME*/
+	/*nodename is MACRO_STAND_FOR_ALL_NODENAME, the parameters go to all the nodes at once*/
 	if (strcmp(nodename, MACRO_STAND_FOR_ALL_NODENAME) == 0)
 	{
+		cmds = (AgentCmdParallel *) palloc0(sizeof(AgentCmdParallel) * maxnum);
 		rel_scan = heap_beginscan(noderel, SnapshotNow, 0, NULL);
 		while((tuple = heap_getnext(rel_scan, ForwardScanDirection)) != NULL)
 		{
@@ -925,9 +933,42 @@ static void mgr_reload_parm(Relation noderel, char *nodename, char nodetype, Str
 			nodepath = TextDatumGetCString(datumpath);
 			ereport(LOG,
 				(errmsg("send parameter %s ... to %s", paramstrdata->data, nodepath)));
-			mgr_updateparm_send_parm(&getAgentCmdRst, mgr_node->nodehost, nodepath, paramstrdata, effectparmstatus, bforce);
+			if (num == maxnum)
+			{
+				maxnum *= 2;
+				cmds = (AgentCmdParallel *) repalloc(cmds, sizeof(AgentCmdParallel) * maxnum);
+			}
+			cmd = &cmds[num++];
+			memset(cmd, 0, sizeof(AgentCmdParallel));
+			cmd->cmdtype = mgr_updateparm_conf_cmdtype(effectparmstatus, bforce);
+			cmd->hostoid = mgr_node->nodehost;
+			namestrcpy(&(cmd->result.nodename), NameStr(mgr_node->nodename));
+			initStringInfo(&(cmd->result.description));
+			initStringInfo(&(cmd->cmdstr));
+			appendStringInfoString(&(cmd->cmdstr), nodepath);
+			pfree(nodepath);
 		}
 		heap_endscan(rel_scan);
+
+		mgr_send_conf_parameters_parallel(cmds, num, paramstrdata);
+		/*report all the nodes which failed together*/
+		initStringInfo(&failnodes);
+		for (i = 0; i < num; i++)
+		{
+			cmd = &cmds[i];
+			if (!cmd->result.ret)
+				appendStringInfo(&failnodes, "%s%s: %s", failnodes.len == 0 ? "" : "; "
+					, NameStr(cmd->result.nodename), cmd->result.description.data);
+			pfree(cmd->result.description.data);
+			pfree(cmd->cmdstr.data);
+		}
+		pfree(cmds);
+		if (failnodes.len != 0)
+		{
+			ereport(ERROR, (errcode(ERRCODE_CONNECTION_FAILURE)
+				 ,errmsg("reload parameter fail: %s", failnodes.data)));
+		}
+		pfree(failnodes.data);
 	}
 	else	/*for given nodename*/
 	{
@@ -971,20 +1012,7 @@ static void mgr_updateparm_send_parm(GetAgentCmdRst *getAgentCmdRst, Oid hostoid
 {
 	/*send the parameter to node path, then reload it*/
 	resetStringInfo(&(getAgentCmdRst->description));
-	if(effectparmstatus == PGC_SIGHUP)
-	{
-		if (!bforce)
-			mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_PGSQLCONF_RELOAD, nodepath, paramstrdata, hostoid, getAgentCmdRst);
-		else
-			mgr_send_conf_parameters(AGT_CMD_CNDN_DELPARAM_PGSQLCONF_FORCE, nodepath, paramstrdata, hostoid, getAgentCmdRst);
-	}
-	else
-	{
-		if (!bforce)
-			mgr_send_conf_parameters(AGT_CMD_CNDN_REFRESH_PGSQLCONF, nodepath, paramstrdata, hostoid, getAgentCmdRst);
-		else
-			mgr_send_conf_parameters(AGT_CMD_CNDN_DELPARAM_PGSQLCONF_FORCE, nodepath, paramstrdata, hostoid, getAgentCmdRst);
-	}
+	mgr_send_conf_parameters(mgr_updateparm_conf_cmdtype(effectparmstatus, bforce), nodepath, paramstrdata, hostoid, getAgentCmdRst);
 
 	if (getAgentCmdRst->ret != true)
 	{
@@ -993,6 +1021,19 @@ static void mgr_updateparm_send_parm(GetAgentCmdRst *getAgentCmdRst, Oid hostoid
 	}
 }
 
+/*
+* the agent command which refreshes postgresql.conf, with a reload when the guccontent of the
+* parameter is sighup
+*/
+static char mgr_updateparm_conf_cmdtype(int effectparmstatus, bool bforce)
+{
+	if (bforce)
+		return AGT_CMD_CNDN_DELPARAM_PGSQLCONF_FORCE;
+	if (effectparmstatus == PGC_SIGHUP)
+		return AGT_CMD_CNDN_REFRESH_PGSQLCONF_RELOAD;
+	return AGT_CMD_CNDN_REFRESH_PGSQLCONF;
+}
+
 static int mgr_delete_tuple_not_all(Relation noderel, char nodetype, Name key)
 {
 	HeapTuple looptuple;
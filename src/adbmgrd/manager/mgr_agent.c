@@ -21,15 +21,30 @@ struct ManagerAgent
 	StringInfoData in_buf;
 	StringInfoData err_buf;
 	struct addrinfo *addrs;
+	char *host;			/* the agent, to find the connection in list_idle_ma */
+	unsigned short port;
+	bool idle;			/* the agent waits for a command */
 };
 
 /* saved ManagerAgent for release when got error */
 static List * list_ma = NIL;
+/*
+ * connections closed while their agent was waiting for a command, ma_connect
+ * takes them back instead of connecting again. an agent serves the commands of
+ * one connection one after another, so several connections to the same agent
+ * are kept for the commands sent at the same time
+ */
+static List * list_idle_ma = NIL;
 static const char ma_idle_msg_str[5] = {AGT_MSG_IDLE, '\0', '\0', '\0', '\4'};
 
+#define MA_MAX_IDLE_PER_AGENT	4
+
 static bool ma_recv_data(ManagerAgent *ma);
 static void left_stringbuf(StringInfo buf);
 static ManagerAgent *make_manager_agent_handle(const char *host, unsigned short port);
+static ManagerAgent *ma_get_idle_agent(const char *host, unsigned short port);
+static bool ma_wait_for_command(ManagerAgent *ma);
+static void ma_free(ManagerAgent *ma);
 static void ma_set_error(ManagerAgent *ma, const char *fmt, ...) __attribute__((format(PG_PRINTF_ATTRIBUTE, 2, 3)));
 
 ManagerAgent* ma_connect(const char *host, unsigned short port)
@@ -40,6 +55,10 @@ ManagerAgent* ma_connect(const char *host, unsigned short port)
 
 	AssertArg(host != NULL && port != 0);
 
+	agent = ma_get_idle_agent(host, port);
+	if(agent)
+		return agent;
+
 	agent = make_manager_agent_handle(host, port);
 	Assert(agent);
 	/* has error ? */
@@ -109,6 +128,7 @@ re_connect_:
 			return agent;
 		}
 		agent->in_buf.cursor += sizeof(ma_idle_msg_str);
+		agent->idle = true;
 		break;
 	}
 
@@ -169,7 +189,9 @@ static ManagerAgent *make_manager_agent_handle(const char *host, unsigned short
 	initStringInfo((StringInfo)&(ma->in_buf));
 	initStringInfo((StringInfo)&(ma->out_buf));
 	initStringInfo((StringInfo)&(ma->err_buf));
+	ma->host = pstrdup(host);
 	MemoryContextSwitchTo(old_context);
+	ma->port = port;
 	ma->addrs = NULL;
 
 	/* Initialize hint structure */
@@ -218,10 +240,120 @@ static void ma_set_error(ManagerAgent *ma, const char *fmt, ...)
 	}
 }
 
+/*
+* take an idle connection to the agent, the ones whose agent went away meanwhile are dropped
+*/
+static ManagerAgent *ma_get_idle_agent(const char *host, unsigned short port)
+{
+	ManagerAgent *ma;
+	ListCell *lc;
+	fd_set rfd;
+	struct timeval timeout;
+	int rval;
+
+	for(;;)
+	{
+		ma = NULL;
+		foreach(lc, list_idle_ma)
+		{
+			ManagerAgent *idle_ma = lfirst(lc);
+			if(idle_ma->port == port && strcmp(idle_ma->host, host) == 0)
+			{
+				ma = idle_ma;
+				break;
+			}
+		}
+		if(ma == NULL)
+			return NULL;
+		list_idle_ma = list_delete_ptr(list_idle_ma, ma);
+
+		/* an idle agent sends nothing, data here is the end of the connection */
+		FD_ZERO(&rfd);
+		FD_SET(ma->sock, &rfd);
+		timeout.tv_sec = 0;
+		timeout.tv_usec = 0;
+		rval = select(ma->sock + 1, &rfd, NULL, NULL, &timeout);
+		if(rval != 0)
+		{
+			ma_free(ma);
+			continue;
+		}
+
+		resetStringInfo(&(ma->err_buf));
+		list_ma = lappend(list_ma, ma);
+		return ma;
+	}
+}
+
+/*
+* is the agent waiting for a command, the idle message which follows the result of the last
+* command is read when it is already there, without waiting for it
+*/
+static bool ma_wait_for_command(ManagerAgent *ma)
+{
+	StringInfo in_buf = &(ma->in_buf);
+	fd_set rfd;
+	struct timeval timeout;
+	int rval;
+
+	if(ma->sock == PGINVALID_SOCKET || ma->err_buf.len > 0
+		|| ma->out_buf.cursor < ma->out_buf.len)
+		return false;
+	if(ma->idle)
+		return in_buf->len == in_buf->cursor;
+
+	if(in_buf->len == in_buf->cursor)
+	{
+		FD_ZERO(&rfd);
+		FD_SET(ma->sock, &rfd);
+		timeout.tv_sec = 0;
+		timeout.tv_usec = 0;
+		rval = select(ma->sock + 1, &rfd, NULL, NULL, &timeout);
+		if(rval <= 0 || ma_recv_data(ma) == false)
+			return false;
+	}
+	if(in_buf->len - in_buf->cursor != sizeof(ma_idle_msg_str)
+		|| memcmp(in_buf->data + in_buf->cursor, ma_idle_msg_str, sizeof(ma_idle_msg_str)) != 0)
+		return false;
+	resetStringInfo(in_buf);
+	ma->idle = true;
+	return true;
+}
+
+/*
+* keep the connection for the next ma_connect to the agent when the agent waits for a command,
+* otherwise close it
+*/
 void ma_close(ManagerAgent *ma)
 {
+	MemoryContext old_context;
+	ListCell *lc;
+	int nidle = 0;
+
 	if(ma == NULL)
 		return;
+	if(ma_wait_for_command(ma))
+	{
+		foreach(lc, list_idle_ma)
+		{
+			ManagerAgent *idle_ma = lfirst(lc);
+			if(idle_ma->port == ma->port && strcmp(idle_ma->host, ma->host) == 0)
+				nidle++;
+		}
+		if(nidle < MA_MAX_IDLE_PER_AGENT)
+		{
+			old_context = MemoryContextSwitchTo(TopMemoryContext);
+			list_idle_ma = lappend(list_idle_ma, ma);
+			MemoryContextSwitchTo(old_context);
+			list_ma = list_delete_ptr(list_ma, ma);
+			return;
+		}
+	}
+	ma_free(ma);
+}
+
+static void ma_free(ManagerAgent *ma)
+{
 	if(ma->sock != PGINVALID_SOCKET)
 		closesocket(ma->sock);
 	if(ma->out_buf.data)
@@ -232,7 +364,9 @@ void ma_close(ManagerAgent *ma)
 		pfree(ma->err_buf.data);
 	if(ma->addrs)
 		pg_freeaddrinfo_all(AF_UNSPEC, ma->addrs);
-	list_ma = list_delete(list_ma, ma);
+	if(ma->host)
+		pfree(ma->host);
+	list_ma = list_delete_ptr(list_ma, ma);
 	pfree(ma);
 }
 
@@ -322,6 +456,8 @@ char ma_get_message(ManagerAgent *ma, StringInfo buf)
 		buf->cursor = msg_type;
 	}
 	in_buf->cursor += (n32 + 5);
+	if(msg_type == AGT_MSG_IDLE)
+		ma->idle = true;
 	return msg_type;
 }
 
@@ -358,6 +494,7 @@ void ma_put_msg(ManagerAgent *ma, char msg_type, const char *msg, Size msg_len)
 	uint32 len;
 	AssertArg(ma && msg_type > 0);
 
+	ma->idle = false;
 	left_stringbuf(&(ma->out_buf));
 
 	enlargeStringInfo(&(ma->out_buf), msg_len + 5);
@@ -407,6 +544,8 @@ void ma_endmessage(StringInfo buf, ManagerAgent *ma)
 	n32 = htonl((uint32)(buf->len - 1));
 	memcpy(buf->data + 1, &n32, 4);
 
+	ma->idle = false;
+
 	/* left buffer */
 	left_stringbuf(&(ma->out_buf));
 
@@ -419,11 +558,14 @@ void ma_endmessage(StringInfo buf, ManagerAgent *ma)
 	memset(buf, 0, sizeof(*buf));
 }
 
+/*
+* the connections in use when an error happened are in an unknown state, they are not kept
+*/
 void ma_clean(void)
 {
 	ListCell *lc;
 	while((lc = list_head(list_ma)) != NULL)
-		ma_close(lfirst(lc));
+		ma_free(lfirst(lc));
 }
 
 const char *ma_getmsgstring(StringInfo msg)
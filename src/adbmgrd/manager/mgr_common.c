@@ -547,6 +547,147 @@ int pingNode_user(char *host_addr, char *node_port, char *node_user)
 	pfree(buf.data);
 }
 
+/*
+* pingNode_user for many nodes at once: the hosts are checked by one ping process each, all
+* running together, then the ping commands are sent to all the agents before any result is read.
+* a host which does not answer is given up after MGR_PING_HOST_TIMEOUT seconds. the caller fills
+* host_addr, agent_port, node_port, node_user and pid_file_path
+*/
+#define MGR_PING_HOST_TIMEOUT 2
+
+void pingNode_user_parallel(NodePingParallel *nodes, int num)
+{
+	NodePingParallel *node;
+	FILE **pipes;
+	StringInfoData sendstrmsg;
+	StringInfoData buf;
+	StringInfoData result;
+	char ping_str[1024];
+	char psBuffer[1024];
+	bool execok;
+	int i;
+	int j;
+
+	/* one ping per host, the nodes of the host take its answer */
+	pipes = (FILE **) palloc0(sizeof(FILE *) * (num + 1));
+	for (i = 0; i < num; i++)
+	{
+		node = &nodes[i];
+		node->host_valid = false;
+		node->ret = PQPING_NO_RESPONSE;
+		node->ma = NULL;
+		for (j = 0; j < i; j++)
+		{
+			if (strcmp(nodes[j].host_addr, node->host_addr) == 0)
+				break;
+		}
+		if (j < i || gethostbyname(node->host_addr) == NULL)
+			continue;
+		snprintf(ping_str, sizeof(ping_str), "ping -c 1 -W %d %s", MGR_PING_HOST_TIMEOUT, node->host_addr);
+		pipes[i] = popen(ping_str, "r");
+	}
+	for (i = 0; i < num; i++)
+	{
+		node = &nodes[i];
+		if (pipes[i] == NULL)
+		{
+			for (j = 0; j < i; j++)
+			{
+				if (strcmp(nodes[j].host_addr, node->host_addr) == 0)
+				{
+					node->host_valid = nodes[j].host_valid;
+					break;
+				}
+			}
+			continue;
+		}
+		node->host_valid = true;
+		while (fgets(psBuffer, sizeof(psBuffer), pipes[i]))
+		{
+			if (strstr(psBuffer, "0 received") != NULL ||
+				strstr(psBuffer, "Unreachable") != NULL)
+				node->host_valid = false;
+		}
+		pclose(pipes[i]);
+	}
+	pfree(pipes);
+
+	/* send the ping commands to all the agents */
+	initStringInfo(&sendstrmsg);
+	for (i = 0; i < num; i++)
+	{
+		node = &nodes[i];
+		if (!node->host_valid)
+			continue;
+		node->ma = ma_connect(node->host_addr, node->agent_port);
+		if (!ma_isconnected(node->ma))
+		{
+			ereport(LOG, (errmsg("could not connect socket for agent \"%s\".",
+							node->host_addr)));
+			ma_close(node->ma);
+			node->ma = NULL;
+			node->ret = AGENT_DOWN;
+			continue;
+		}
+		resetStringInfo(&sendstrmsg);
+		appendStringInfo(&sendstrmsg, "%s", node->host_addr);
+		appendStringInfoChar(&sendstrmsg, '\0');
+		appendStringInfo(&sendstrmsg, "%s", node->node_port);
+		appendStringInfoChar(&sendstrmsg, '\0');
+		appendStringInfo(&sendstrmsg, "%s", node->node_user);
+		appendStringInfoChar(&sendstrmsg, '\0');
+		appendStringInfo(&sendstrmsg, "%s", node->pid_file_path);
+		ma_beginmessage(&buf, AGT_MSG_COMMAND);
+		ma_sendbyte(&buf, AGT_CMD_PING_NODE);
+		mgr_append_infostr_infostr(&buf, &sendstrmsg);
+		ma_endmessage(&buf, node->ma);
+		if (!ma_flush(node->ma, false))
+		{
+			ma_close(node->ma);
+			node->ma = NULL;
+			node->ret = -1;
+		}
+	}
+	pfree(sendstrmsg.data);
+
+	/* all the agents are pinging their node now */
+	initStringInfo(&result);
+	for (i = 0; i < num; i++)
+	{
+		node = &nodes[i];
+		if (node->ma == NULL)
+			continue;
+		execok = false;
+		resetStringInfo(&result);
+		mgr_recv_msg_for_monitor(node->ma, &execok, &result);
+		ma_close(node->ma);
+		node->ma = NULL;
+		if (!execok)
+		{
+			ereport(WARNING, (errmsg("monitor (host=%s port=%s) fail \"%s\"",
+				node->host_addr, node->node_port, result.data)));
+		}
+		if (result.len != 1)
+		{
+			node->ret = PQPING_NO_RESPONSE;
+			continue;
+		}
+		switch (result.data[0])
+		{
+			case PQPING_OK:
+			case PQPING_REJECT:
+			case PQPING_NO_ATTEMPT:
+			case PQPING_NO_RESPONSE:
+				node->ret = result.data[0];
+				break;
+			default:
+				node->ret = PQPING_NO_RESPONSE;
+				break;
+		}
+	}
+	pfree(result.data);
+}
+
 /*check the host in use or not*/
 bool mgr_check_host_in_use(Oid hostoid, bool check_inited)
 {
@@ -918,6 +1059,8 @@ void monitor_delete_data(MonitorDeleteData *node, ParamListInfo params, DestRece
 {
 	if (mgr_has_priv_alter())
 	{
+		/*keep the aggregates of the rows about to be deleted*/
+		DirectFunctionCall1(monitor_rollup_host_data, (Datum)0);
 		DirectFunctionCall1(monitor_delete_data_interval_days, Int32GetDatum(node->days));
 		return;
 	}
@@ -981,6 +1124,61 @@ Datum monitor_delete_data_interval_days(PG_FUNCTION_ARGS)
 	PG_RETURN_BOOL(true);
 }
 
+/*
+* aggregate monitor_cpu, monitor_mem, monitor_disk and monitor_net into
+* monitor_host_rollup: one row per host for every complete hour which is not
+* there yet, then one row per host for every complete day from the hours.
+* the ranges only go through the time indexes of the tables, so calling it after
+* every collection costs nothing until an hour or a day ends.
+*/
+Datum monitor_rollup_host_data(PG_FUNCTION_ARGS)
+{
+	int ret;
+	int iloop = 0;
+	char *sqlstr[] = {
+		"insert into monitor_host_rollup "
+		"select c.hostname, 'h', c.t, c.samples, c.cpu_avg, c.cpu_max, m.mem_avg, m.mem_max, d.disk_used, n.net_sent, n.net_recv "
+		"from (select hostname, date_trunc('hour', mc_timestamptz) as t, count(*)::int4 as samples, "
+		"avg(mc_cpu_usage)::float4 as cpu_avg, max(mc_cpu_usage) as cpu_max "
+		"from monitor_cpu where mc_timestamptz >= (select coalesce(max(mhr_timestamptz) + interval '1 hour', '-infinity') "
+		"from monitor_host_rollup where mhr_level = 'h') and mc_timestamptz < date_trunc('hour', now()) group by 1, 2) c "
+		"left join (select hostname, date_trunc('hour', mm_timestamptz) as t, avg(mm_usage)::float4 as mem_avg, max(mm_usage) as mem_max "
+		"from monitor_mem where mm_timestamptz >= (select coalesce(max(mhr_timestamptz) + interval '1 hour', '-infinity') "
+		"from monitor_host_rollup where mhr_level = 'h') and mm_timestamptz < date_trunc('hour', now()) group by 1, 2) m "
+		"using (hostname, t) "
+		"left join (select hostname, date_trunc('hour', md_timestamptz) as t, max(md_used) as disk_used "
+		"from monitor_disk where md_timestamptz >= (select coalesce(max(mhr_timestamptz) + interval '1 hour', '-infinity') "
+		"from monitor_host_rollup where mhr_level = 'h') and md_timestamptz < date_trunc('hour', now()) group by 1, 2) d "
+		"using (hostname, t) "
+		"left join (select hostname, date_trunc('hour', mn_timestamptz) as t, avg(mn_sent)::int8 as net_sent, avg(mn_recv)::int8 as net_recv "
+		"from monitor_net where mn_timestamptz >= (select coalesce(max(mhr_timestamptz) + interval '1 hour', '-infinity') "
+		"from monitor_host_rollup where mhr_level = 'h') and mn_timestamptz < date_trunc('hour', now()) group by 1, 2) n "
+		"using (hostname, t);",
+		"insert into monitor_host_rollup "
+		"select hostname, 'd', date_trunc('day', mhr_timestamptz), sum(mhr_samples)::int4, "
+		"(sum(mhr_cpu_avg::float8 * mhr_samples) / sum(mhr_samples))::float4, max(mhr_cpu_max), "
+		"(sum(mhr_mem_avg::float8 * mhr_samples) / sum(mhr_samples))::float4, max(mhr_mem_max), max(mhr_disk_used), "
+		"(sum(mhr_net_sent * mhr_samples) / sum(mhr_samples))::int8, (sum(mhr_net_recv * mhr_samples) / sum(mhr_samples))::int8 "
+		"from monitor_host_rollup where mhr_level = 'h' and mhr_timestamptz >= (select coalesce(max(mhr_timestamptz) + interval '1 day', '-infinity') "
+		"from monitor_host_rollup where mhr_level = 'd') and mhr_timestamptz < date_trunc('day', now()) group by 1, 3;",
+		NULL
+		};
+
+	if ((ret = SPI_connect()) < 0)
+		ereport(ERROR, (errmsg("ADB Monitor SPI_connect failed: error code %d", ret)));
+
+	for(iloop=0; sqlstr[iloop] != NULL; iloop++)
+	{
+		ret = SPI_execute(sqlstr[iloop], false, 0);
+		if (ret != SPI_OK_INSERT)
+			ereport(ERROR, (errmsg("ADB Monitor SPI_execute \"%s\"failed: error code %d", sqlstr[iloop], ret)));
+		SPI_freetuptable(SPI_tuptable);
+	}
+	SPI_finish();
+
+	PG_RETURN_BOOL(true);
+}
+
 /*
 * set cluster init in mgr_node table,initialized=true, incluster=true
 */
@@ -1053,6 +1251,9 @@ bool mgr_promote_node(char cmdtype, Oid hostOid, char *path, StringInfo strinfo)
 	return res;
 }
 
+/* checks per second while waiting the new master, the cluster may be paused meanwhile */
+#define MGR_CHECK_CONNECT_POLLS_PER_SECOND 10
+
 /*
 * wait the new master accept connect
 *
@@ -1062,6 +1263,7 @@ bool mgr_check_node_connect(char nodetype, Oid hostOid, int nodeport)
 	char *hostaddr;
 	char nodeport_buf[10];
 	char *username = NULL;
+	int polls = 0;
 
 	hostaddr = get_hostaddress_from_hostoid(hostOid);
 	/*check recovery finish*/
@@ -1071,9 +1273,12 @@ bool mgr_check_node_connect(char nodetype, Oid hostOid, int nodeport)
 	{
 		if (mgr_check_node_recovery_finish(nodetype, hostOid, nodeport, hostaddr))
 			break;
-		fputs(_("."), stdout);
-		fflush(stdout);
-		pg_usleep(1 * 1000000L);
+		if (++polls % MGR_CHECK_CONNECT_POLLS_PER_SECOND == 0)
+		{
+			fputs(_("."), stdout);
+			fflush(stdout);
+		}
+		pg_usleep(1000000L / MGR_CHECK_CONNECT_POLLS_PER_SECOND);
 	}
 	memset(nodeport_buf, 0, 10);
 	sprintf(nodeport_buf, "%d", nodeport);
@@ -1085,9 +1290,12 @@ bool mgr_check_node_connect(char nodetype, Oid hostOid, int nodeport)
 	{
 		if (pingNode_user(hostaddr, nodeport_buf, username == NULL ? AGTM_USER : username) != 0)
 		{
-			fputs(_("."), stdout);
-			fflush(stdout);
-			pg_usleep(1 * 1000000L);
+			if (++polls % MGR_CHECK_CONNECT_POLLS_PER_SECOND == 0)
+			{
+				fputs(_("."), stdout);
+				fflush(stdout);
+			}
+			pg_usleep(1000000L / MGR_CHECK_CONNECT_POLLS_PER_SECOND);
 		}
 		else
 			break;
@@ -1102,6 +1310,9 @@ bool mgr_check_node_connect(char nodetype, Oid hostOid, int nodeport)
 	return true;
 }
 
+/* connections pg_rewind fetches the changed files of the master with */
+#define MGR_REWIND_JOBS 4
+
 /*
 * rewind the node
 *
@@ -1433,7 +1644,7 @@ bool mgr_rewind_node(char nodetype, char *nodename, StringInfo strinfo)
 	pg_usleep(3000000L);
 	/*node rewind*/
 	resetStringInfo(&infosendmsg);
-	appendStringInfo(&infosendmsg, " --target-pgdata %s --source-server='host=%s port=%d user=%s dbname=postgres' -N %s", slave_nodeinfo.nodepath, master_nodeinfo.nodeaddr, master_nodeinfo.nodeport, slave_nodeinfo.nodeusername, nodename);
+	appendStringInfo(&infosendmsg, " --target-pgdata %s --source-server='host=%s port=%d user=%s dbname=postgres' -N %s --jobs=%d", slave_nodeinfo.nodepath, master_nodeinfo.nodeaddr, master_nodeinfo.nodeport, slave_nodeinfo.nodeusername, nodename, MGR_REWIND_JOBS);
 
 	res = mgr_ma_send_cmd_get_original_result(cmdtype, infosendmsg.data, slave_nodeinfo.nodehost, strinfo, true);
 	pfree(restmsg.data);
@@ -1499,9 +1710,66 @@ bool mgr_ma_send_cmd(char cmdtype, char *cmdstr, Oid hostOid, StringInfo strinfo
 	return mgr_ma_send_cmd_get_original_result(cmdtype, cmdstr, hostOid, strinfo, false);
 }
 
+/*
+* send the commands to their agents all at once, then wait for the result of each one, so the
+* agents of the different hosts run them at the same time instead of one after another. the
+* caller fills cmdtype, hostoid, cmdstr and result.nodename, and initializes result.description
+*/
+void mgr_ma_send_cmd_parallel(AgentCmdParallel *cmds, int num)
+{
+	AgentCmdParallel *cmd;
+	StringInfoData buf;
+	char cmdheadstr[64];
+	char *hostaddr;
+	int i;
+
+	for (i = 0; i < num; i++)
+	{
+		cmd = &cmds[i];
+		cmd->result.ret = false;
+		cmd->ma = ma_connect_hostoid(cmd->hostoid);
+		if (!ma_isconnected(cmd->ma))
+		{
+			appendStringInfoString(&(cmd->result.description), ma_last_error_msg(cmd->ma));
+			ma_close(cmd->ma);
+			cmd->ma = NULL;
+			continue;
+		}
+
+		hostaddr = get_hostaddress_from_hostoid(cmd->hostoid);
+		mgr_get_cmd_head_word(cmd->cmdtype, cmdheadstr);
+		ereport(NOTICE, (errmsg("%s, %s %s", hostaddr, cmdheadstr, cmd->cmdstr.data)));
+		ereport(LOG, (errmsg("%s, %s %s", hostaddr, cmdheadstr, cmd->cmdstr.data)));
+		pfree(hostaddr);
+
+		ma_beginmessage(&buf, AGT_MSG_COMMAND);
+		ma_sendbyte(&buf, cmd->cmdtype);
+		ma_sendstring(&buf, cmd->cmdstr.data);
+		ma_endmessage(&buf, cmd->ma);
+		if (!ma_flush(cmd->ma, false))
+		{
+			appendStringInfoString(&(cmd->result.description), ma_last_error_msg(cmd->ma));
+			ma_close(cmd->ma);
+			cmd->ma = NULL;
+		}
+	}
+
+	/* all the commands are running now, the order of the results does not matter */
+	for (i = 0; i < num; i++)
+	{
+		cmd = &cmds[i];
+		if (cmd->ma == NULL)
+			continue;
+		if (!mgr_recv_msg(cmd->ma, &(cmd->result)) && cmd->result.description.len == 0)
+			appendStringInfoString(&(cmd->result.description), ma_last_error_msg(cmd->ma));
+		ma_close(cmd->ma);
+		cmd->ma = NULL;
+	}
+}
+
 /*
 * for the comand "start all" or "stop all" or "start nodename nodetype all", send the command to agent and 
-* run as backend.
+* run as backend. the commands of all the nodes are sent at once.
 */
 
 static void mgr_cmd_run_backend(const char nodetype, const char cmdtype, const List* nodenamelist, const char *shutdown_mode, PG_FUNCTION_ARGS)
@@ -1509,12 +1777,21 @@ static void mgr_cmd_run_backend(const char nodetype, const char cmdtype, const L
 	Relation rel_node;
 	ListCell *lc;
 	char *nodestrname;
+	char *nodepath;
 	HeapTuple aimtuple =NULL;
-	GetAgentCmdRst getAgentCmdRst;
-	
-	
+	Form_mgr_node mgr_node;
+	Datum datumPath;
+	AgentCmdParallel *cmds;
+	AgentCmdParallel *cmd;
+	bool isNull = false;
+	bool bstartcmd;
+	int num = 0;
+	int i;
+
+	bstartcmd = (AGT_CMD_GTM_START_MASTER_BACKEND == cmdtype || AGT_CMD_GTM_START_SLAVE_BACKEND == cmdtype
+								|| AGT_CMD_CN_START_BACKEND == cmdtype || AGT_CMD_DN_START_BACKEND == cmdtype);
+	cmds = (AgentCmdParallel *) palloc0(sizeof(AgentCmdParallel) * (list_length(nodenamelist) + 1));
 	rel_node = heap_open(NodeRelationId, AccessShareLock);
-	initStringInfo(&(getAgentCmdRst.description));
 	foreach(lc, nodenamelist)
 	{
 		nodestrname = (char *) lfirst(lc);
@@ -1524,16 +1801,45 @@ static void mgr_cmd_run_backend(const char nodetype, const char cmdtype, const L
 			heap_close(rel_node, AccessShareLock);
 			ereport(ERROR, (errcode(ERRCODE_UNDEFINED_OBJECT),
 				errmsg("%s \"%s\" does not exist", mgr_nodetype_str(nodetype), nodestrname)));
-		}	
-		/*get execute cmd result from agent*/
-		resetStringInfo(&(getAgentCmdRst.description));
-		mgr_runmode_cndn_get_result(cmdtype, &getAgentCmdRst, rel_node, aimtuple, shutdown_mode);
+		}
+		mgr_node = (Form_mgr_node)GETSTRUCT(aimtuple);
+		Assert(mgr_node);
+		/* a node not initialized cannot start, its result says so later */
+		if (bstartcmd && !mgr_node->nodeinited)
+		{
+			heap_freetuple(aimtuple);
+			continue;
+		}
+		datumPath = heap_getattr(aimtuple, Anum_mgr_node_nodepath, RelationGetDescr(rel_node), &isNull);
+		if(isNull)
+		{
+			heap_close(rel_node, AccessShareLock);
+			ereport(ERROR, (errcode(ERRCODE_INTERNAL_ERROR)
+				, err_generic_string(PG_DIAG_TABLE_NAME, "mgr_node")
+				, errmsg("column cndnpath is null")));
+		}
+		nodepath = TextDatumGetCString(datumPath);
+
+		cmd = &cmds[num++];
+		cmd->hostoid = mgr_node->nodehost;
+		namestrcpy(&(cmd->result.nodename), NameStr(mgr_node->nodename));
+		initStringInfo(&(cmd->result.description));
+		initStringInfo(&(cmd->cmdstr));
+		cmd->cmdtype = mgr_append_backend_cmd_str(cmdtype, nodepath, shutdown_mode, &(cmd->cmdstr));
+		pfree(nodepath);
 		heap_freetuple(aimtuple);
 	}
-	
-	pfree(getAgentCmdRst.description.data);
 	heap_close(rel_node, AccessShareLock);
-	
+
+	/* the results are checked by ping after */
+	mgr_ma_send_cmd_parallel(cmds, num);
+
+	for (i = 0; i < num; i++)
+	{
+		pfree(cmds[i].cmdstr.data);
+		pfree(cmds[i].result.description.data);
+	}
+	pfree(cmds);
 }
 
 /*
@@ -1819,6 +2125,41 @@ char mgr_change_cmdtype_unbackend(char cmdtype)
 	}
 }
 
+/*
+* append the arguments of a command run as backend: start or stop the node at nodepath without
+* waiting for it; return the command type the agent runs
+*/
+char mgr_append_backend_cmd_str(char cmdtype, const char *nodepath, const char *shutdown_mode, StringInfo infosendmsg)
+{
+	switch(cmdtype)
+	{
+		case AGT_CMD_GTM_START_MASTER_BACKEND:
+		case AGT_CMD_GTM_START_SLAVE_BACKEND:
+			appendStringInfo(infosendmsg, " start -D %s -o -i -w -c -W -l %s/logfile", nodepath, nodepath);
+			break;
+		case AGT_CMD_GTM_STOP_MASTER_BACKEND:
+		case AGT_CMD_GTM_STOP_SLAVE_BACKEND:
+			appendStringInfo(infosendmsg, " stop -D %s -m %s -o -i -w -c -W", nodepath, shutdown_mode);
+			break;
+		case AGT_CMD_CN_START_BACKEND:
+		case AGT_CMD_DN_START_BACKEND:
+			appendStringInfo(infosendmsg, " start -D %s", nodepath);
+			appendStringInfo(infosendmsg, " -Z %s -o -i -w -c -W -l %s/logfile"
+				, AGT_CMD_CN_START_BACKEND == cmdtype ? "coordinator" : "datanode", nodepath);
+			break;
+		case AGT_CMD_CN_STOP_BACKEND:
+		case AGT_CMD_DN_STOP_BACKEND:
+			appendStringInfo(infosendmsg, " stop -D %s", nodepath);
+			appendStringInfo(infosendmsg, " -Z %s -m %s -o -i -w -c -W"
+				, AGT_CMD_CN_STOP_BACKEND == cmdtype ? "coordinator" : "datanode", shutdown_mode);
+			break;
+		default:
+			break;
+	}
+
+	return mgr_change_cmdtype_unbackend(cmdtype);
+}
+
 HeapTuple build_common_command_tuple_four_col(const Name name, char type, bool status, const char *description)
 {
     Datum datums[4];
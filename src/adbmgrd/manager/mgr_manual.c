@@ -687,7 +687,7 @@ Datum mgr_append_coord_to_coord(PG_FUNCTION_ARGS)
 	/*base backup*/
 	initStringInfo(&restmsg);
 	resetStringInfo(&infosendmsg);
-	appendStringInfo(&infosendmsg, " -h %s -p %d -U %s -D %s -Xs -Fp -c fast -R", src_nodeinfo.nodeaddr
+	appendStringInfo(&infosendmsg, " -h %s -p %d -U %s -D %s -Xs -Fp -c fast -R" MGR_BASEBACKUP_STREAM_COMPRESS, src_nodeinfo.nodeaddr
 										, src_nodeinfo.nodeport, src_nodeinfo.nodeusername, dest_nodeinfo.nodepath);
 	if (!mgr_ma_send_cmd(AGT_CMD_CNDN_SLAVE_INIT, infosendmsg.data, dest_nodeinfo.nodehost, &restmsg))
 	{
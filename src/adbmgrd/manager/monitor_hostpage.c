@@ -5,6 +5,7 @@
 #include "access/genam.h"
 #include "access/heapam.h"
 #include "access/htup_details.h"
+#include "access/xact.h"
 #include "catalog/dependency.h"
 #include "catalog/indexing.h"
 #include "catalog/mgr_host.h"
@@ -41,13 +42,6 @@
 
 #define strtoull(x)  ((unsigned long long int) strtoull((x), NULL, 10))
 
-typedef struct InitHostInfo
-{
-    Relation rel_host;
-    HeapScanDesc rel_scan;
-    ListCell  **lcp;
-}InitHostInfo;
-
 /* for table: monitor_host */
 typedef struct Monitor_Host
 {
@@ -97,6 +91,34 @@ typedef struct Monitor_Disk
     int64           disk_io_write_time;
 }Monitor_Disk;
 
+/*
+ * the collection of one host. the request is sent to all the hosts before
+ * any answer is read, so the agents sample their hosts at the same time.
+ */
+typedef struct HostInfoCollect
+{
+    NameData        hostname;
+    char           *host_addr;
+    ManagerAgent   *ma;
+    bool            ret;
+    StringInfoData  agentRstStr;
+    Monitor_Host    monitor_host;
+    Monitor_Cpu     monitor_cpu;
+    Monitor_Mem     monitor_mem;
+    Monitor_Disk    monitor_disk;
+    Monitor_Net     monitor_net;
+    Monitor_Alarm   monitor_alarm;
+    float           disk_iops;
+}HostInfoCollect;
+
+/* the hosts collected by monitor_get_hostinfo, returned one per call */
+typedef struct HostInfoCollectState
+{
+    HostInfoCollect *hosts;
+    int nhosts;
+    int index;
+}HostInfoCollectState;
+
 static void init_all_table(Monitor_Host *monitor_host,
                            Monitor_Cpu *Monitor_cpu,
                            Monitor_Mem *Monitor_mem,
@@ -111,11 +133,15 @@ static void pfree_all_table(Monitor_Host *monitor_host,
                             Monitor_Disk *Monitor_disk,
                             Monitor_Alarm *Monitor_alarm);
 
-static void insert_into_monotor_cpu(const char *hostname, Monitor_Cpu *monitor_cpu);
-static void insert_into_monotor_mem(const char *hostname, Monitor_Mem *monitor_mem);
-static void insert_into_monotor_disk(const char *hostname, Monitor_Disk *monitor_disk);
-static void insert_into_monotor_net(const char *hostname, Monitor_Net *monitor_net);
-static void insert_into_monotor_host(const char *hostname, Monitor_Host *monitor_host);
+static void collect_all_hostinfo(HostInfoCollectState *state);
+static void parse_hostinfo(HostInfoCollect *host);
+static void insert_into_monitor_tables(HostInfoCollect *hosts, int nhosts);
+static void insert_monitor_tuples(Oid relid, HeapTuple *tuples, int ntuples);
+static HeapTuple build_monitor_cpu_tuple(Relation rel, const char *hostname, Monitor_Cpu *monitor_cpu);
+static HeapTuple build_monitor_mem_tuple(Relation rel, const char *hostname, Monitor_Mem *monitor_mem);
+static HeapTuple build_monitor_disk_tuple(Relation rel, const char *hostname, Monitor_Disk *monitor_disk);
+static HeapTuple build_monitor_net_tuple(Relation rel, const char *hostname, Monitor_Net *monitor_net);
+static HeapTuple build_monitor_host_tuple(Relation rel, const char *hostname, Monitor_Host *monitor_host);
 static void get_cpu_usage_alarm(float cpu_usage, Monitor_Alarm *monitor_alarm);
 static void get_mem_usage_alarm(float mem_usage, Monitor_Alarm *monitor_alarm);
 static void get_disk_usage_alarm(float disk_usage, Monitor_Alarm *monitor_alarm);
@@ -127,42 +153,17 @@ static void get_disk_iops_alarm(float disk_iops, Monitor_Alarm *monitor_alarm);
  *  get the host info(host base info, cpu, disk, mem, net)
  *  insert into the table:monitor_host, monitor_cpu, monitor_mem
  *                        monitor_disk, monitor_net.
+ *
+ *  all the hosts are collected at the first call, one row is returned
+ *  per host.
  */
 Datum
 monitor_get_hostinfo(PG_FUNCTION_ARGS)
 {
     FuncCallContext *funcctx;
-    InitHostInfo *info;
-    HeapTuple tup;
+    HostInfoCollectState *state;
+    HostInfoCollect *host;
     HeapTuple tup_result;
-    Form_mgr_host mgr_host;
-    StringInfoData buf;
-    bool ret;
-    StringInfoData agentRstStr;
-    ManagerAgent *ma;
-    NameData hostname;
-    Datum datum;
-    bool isNull;
-    char *host_addr;
-    float disk_usage;
-    float sent_speed;
-    float recv_speed;
-    float disk_iops;
-    
-    Monitor_Host monitor_host;
-    Monitor_Cpu monitor_cpu;
-    Monitor_Mem monitor_mem;
-    Monitor_Disk monitor_disk;
-    Monitor_Net monitor_net;
-    Monitor_Alarm monitor_alarm;
-
-    initStringInfo(&agentRstStr);
-    init_all_table(&monitor_host,
-                   &monitor_cpu,
-                   &monitor_mem,
-                   &monitor_net,
-                   &monitor_disk,
-                   &monitor_alarm);
 
     if (SRF_IS_FIRSTCALL())
     {
@@ -171,222 +172,349 @@ monitor_get_hostinfo(PG_FUNCTION_ARGS)
         funcctx = SRF_FIRSTCALL_INIT();
         oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
 
-        info = palloc(sizeof(*info));
-        info->rel_host = heap_open(HostRelationId, AccessShareLock);
-        info->rel_scan = heap_beginscan(info->rel_host, SnapshotNow, 0, NULL);
-        info->lcp =NULL;
+        state = palloc0(sizeof(*state));
+        collect_all_hostinfo(state);
+        insert_into_monitor_tables(state->hosts, state->nhosts);
+        DirectFunctionCall1(monitor_rollup_host_data, (Datum)0);
 
         /* save info */
-        funcctx->user_fctx = info;
+        funcctx->user_fctx = state;
 
         MemoryContextSwitchTo(oldcontext);
     }
 
     funcctx = SRF_PERCALL_SETUP();
     Assert(funcctx);
-    info = funcctx->user_fctx;
-    Assert(info);
+    state = funcctx->user_fctx;
+    Assert(state);
 
-    tup = heap_getnext(info->rel_scan, ForwardScanDirection);
-    if (tup == NULL)
+    if (state->index >= state->nhosts)
     {
         /* end of row */
-        heap_endscan(info->rel_scan);
-        heap_close(info->rel_host, AccessShareLock);
-        pfree(info);
         SRF_RETURN_DONE(funcctx);
     }
 
-    mgr_host = (Form_mgr_host)GETSTRUCT(tup);
-    Assert(mgr_host);
+    host = &state->hosts[state->index++];
+    host->agentRstStr.cursor = 0;
+    tup_result = build_common_command_tuple(
+        &(host->hostname)
+        , host->ret
+        , host->agentRstStr.data);
 
-    datum = heap_getattr(tup, Anum_mgr_host_hostaddr, RelationGetDescr(info->rel_host), &isNull);
-    if(isNull)
-        host_addr = NameStr(mgr_host->hostname);
-    else
-        host_addr = TextDatumGetCString(datum);
-    
-    resetStringInfo(&monitor_alarm.alarm_source);
-    appendStringInfoString(&monitor_alarm.alarm_source, host_addr);
+    SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
+}
 
-		namestrcpy(&hostname, NameStr(mgr_host->hostname));
-    ma = ma_connect_hostoid(HeapTupleGetOid(tup));
-    
-    if (!ma_isconnected(ma))
+/*
+ * send the request to the agents of all the hosts, then read their answers.
+ * each agent samples its host for a few seconds, this way collecting all the
+ * hosts takes as long as the slowest one instead of the sum of them.
+ */
+static void collect_all_hostinfo(HostInfoCollectState *state)
+{
+    Relation rel_host;
+    HeapScanDesc rel_scan;
+    HeapTuple tup;
+    Form_mgr_host mgr_host;
+    HostInfoCollect *host;
+    StringInfoData buf;
+    Datum datum;
+    bool isNull;
+    int maxhosts = 16;
+    int i;
+
+    state->hosts = palloc0(sizeof(HostInfoCollect) * maxhosts);
+
+    rel_host = heap_open(HostRelationId, AccessShareLock);
+    rel_scan = heap_beginscan(rel_host, SnapshotNow, 0, NULL);
+    while ((tup = heap_getnext(rel_scan, ForwardScanDirection)) != NULL)
     {
-        /* report error message */
-        ret = false;
-        appendStringInfoString(&agentRstStr, ma_last_error_msg(ma));
+        if (state->nhosts == maxhosts)
+        {
+            maxhosts *= 2;
+            state->hosts = repalloc(state->hosts, sizeof(HostInfoCollect) * maxhosts);
+            MemSet(&state->hosts[state->nhosts], 0, sizeof(HostInfoCollect) * (maxhosts - state->nhosts));
+        }
+        host = &state->hosts[state->nhosts++];
+
+        mgr_host = (Form_mgr_host)GETSTRUCT(tup);
+        Assert(mgr_host);
+
+        datum = heap_getattr(tup, Anum_mgr_host_hostaddr, RelationGetDescr(rel_host), &isNull);
+        if(isNull)
+            host->host_addr = pstrdup(NameStr(mgr_host->hostname));
+        else
+            host->host_addr = TextDatumGetCString(datum);
+
+        initStringInfo(&host->agentRstStr);
+        init_all_table(&host->monitor_host,
+                       &host->monitor_cpu,
+                       &host->monitor_mem,
+                       &host->monitor_net,
+                       &host->monitor_disk,
+                       &host->monitor_alarm);
+        appendStringInfoString(&host->monitor_alarm.alarm_source, host->host_addr);
+        namestrcpy(&host->hostname, NameStr(mgr_host->hostname));
+
+        host->ma = ma_connect_hostoid(HeapTupleGetOid(tup));
+        if (!ma_isconnected(host->ma))
+        {
+            /* report error message */
+            host->ret = false;
+            appendStringInfoString(&host->agentRstStr, ma_last_error_msg(host->ma));
+            ma_close(host->ma);
+            host->ma = NULL;
+            continue;
+        }
+
+        ma_beginmessage(&buf, AGT_MSG_COMMAND);
+        ma_sendbyte(&buf, AGT_CMD_MONITOR_GETS_HOST_INFO);
+        ma_sendstring(&buf, "get_hostinfo");
+        ma_endmessage(&buf, host->ma);
+        if (!ma_flush(host->ma, true))
+        {
+            host->ret = false;
+            appendStringInfoString(&host->agentRstStr, ma_last_error_msg(host->ma));
+            ma_close(host->ma);
+            host->ma = NULL;
+        }
     }
+    heap_endscan(rel_scan);
+    heap_close(rel_host, AccessShareLock);
 
-    ma_beginmessage(&buf, AGT_MSG_COMMAND);
-    ma_sendbyte(&buf, AGT_CMD_MONITOR_GETS_HOST_INFO);
-    ma_sendstring(&buf, "get_hostinfo");
-    ma_endmessage(&buf, ma);
-    if (!ma_flush(ma, true))
+    for (i = 0; i < state->nhosts; i++)
     {
-        ret = false;
-        appendStringInfoString(&agentRstStr, ma_last_error_msg(ma));
-        ma_close(ma);
-        heap_endscan(info->rel_scan);
-        heap_close(info->rel_host, RowExclusiveLock);
+        host = &state->hosts[i];
+        if (host->ma == NULL)
+            continue;
+
+        /*check the receive msg*/
+        mgr_recv_msg_for_monitor(host->ma, &host->ret, &host->agentRstStr);
+        ma_close(host->ma);
+        host->ma = NULL;
+
+        if (host->ret)
+            parse_hostinfo(host);
     }
+}
 
-    /*check the receive msg*/
-    mgr_recv_msg_for_monitor(ma, &ret, &agentRstStr);
+/* read the fields of the answer of an agent */
+static void parse_hostinfo(HostInfoCollect *host)
+{
+    host->agentRstStr.cursor = 0;
 
-    agentRstStr.cursor = 0;
-    tup_result = build_common_command_tuple(
-        &(mgr_host->hostname)
-        , ret
-        , agentRstStr.data);
-
-    //while ((ptmp = &agentRstStr.data[agentRstStr.cursor]) != '\0' && (agentRstStr.cursor < agentRstStr.len))
-    //{
-        /* cpu timestamp with timezone */
-        appendStringInfoString(&monitor_cpu.cpu_timestamp, &agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + monitor_cpu.cpu_timestamp.len + 1;
-
-        /* cpu usage */
-        monitor_cpu.cpu_usage = atof(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* cpu frequency */
-        appendStringInfoString(&monitor_cpu.cpu_freq, &agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + monitor_cpu.cpu_freq.len + 1;
-
-        /* memory timestamp with timezone */
-        appendStringInfoString(&monitor_mem.mem_timestamp, &agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + monitor_mem.mem_timestamp.len + 1;
-
-        /* memory total size (in Bytes)*/
-        monitor_mem.mem_total = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* memory used size (in Bytes) */
-        monitor_mem.mem_used = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* memory usage */
-        monitor_mem.mem_usage = atof(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* disk timestamp with timezone */
-        appendStringInfoString(&monitor_disk.disk_timestamptz, &agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + monitor_disk.disk_timestamptz.len + 1;
-
-        /* disk i/o read (in Bytes) */
-        monitor_disk.disk_io_read_bytes = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* disk i/o read time (in milliseconds) */
-        monitor_disk.disk_io_read_time = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* disk i/o write (in Bytes) */
-        monitor_disk.disk_io_write_bytes = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* disk i/o write time (in milliseconds) */
-        monitor_disk.disk_io_write_time = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-        
-        /* disk total size */
-        monitor_disk.disk_total = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* disk used size */
-        monitor_disk.disk_used = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* net timestamp with timezone */
-        appendStringInfoString(&monitor_net.net_timestamp, &agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + monitor_net.net_timestamp.len + 1;
-
-        /* net sent speed (in bytes/s) */
-        monitor_net.net_sent = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* net recv speed (in bytes/s) */
-        monitor_net.net_recv = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* host system */
-        appendStringInfoString(&monitor_host.system, &agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + monitor_host.system.len + 1;
-
-        /* host platform type */
-        appendStringInfoString(&monitor_host.platform_type, &agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + monitor_host.platform_type.len + 1;
-
-        /* host cpu total cores */
-        monitor_host.cpu_core_total = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        /* host cpu available cores */
-        monitor_host.cpu_core_available = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-        
-        /* host seconds since boot */
-        monitor_host.seconds_since_boot = strtoull(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-
-        disk_iops = atof(&agentRstStr.data[agentRstStr.cursor]);
-        agentRstStr.cursor = agentRstStr.cursor + strlen(&agentRstStr.data[agentRstStr.cursor]) + 1;
-    //}
-
-    monitor_host.run_state = 1;
-
-    resetStringInfo(&monitor_mem.mem_timestamp);
-    resetStringInfo(&monitor_disk.disk_timestamptz);
-    resetStringInfo(&monitor_net.net_timestamp);
-
-    appendStringInfoString(&monitor_mem.mem_timestamp, monitor_cpu.cpu_timestamp.data);
-    appendStringInfoString(&monitor_disk.disk_timestamptz, monitor_cpu.cpu_timestamp.data);
-    appendStringInfoString(&monitor_net.net_timestamp, monitor_cpu.cpu_timestamp.data);
-    appendStringInfoString(&monitor_host.current_time, monitor_cpu.cpu_timestamp.data);
-
-    insert_into_monotor_cpu(hostname.data, &monitor_cpu);
-    insert_into_monotor_mem(hostname.data, &monitor_mem);
-    insert_into_monotor_disk(hostname.data, &monitor_disk);
-    insert_into_monotor_net(hostname.data, &monitor_net);
-    insert_into_monotor_host(hostname.data, &monitor_host);
-
-    appendStringInfoString(&monitor_alarm.alarm_timetz, monitor_cpu.cpu_timestamp.data);
-    monitor_alarm.alarm_type = 1;
-    monitor_alarm.alarm_status = 1;
-
-    get_cpu_usage_alarm(monitor_cpu.cpu_usage, &monitor_alarm);
-    get_mem_usage_alarm(monitor_mem.mem_usage, &monitor_alarm);
+    /* cpu timestamp with timezone */
+    appendStringInfoString(&host->monitor_cpu.cpu_timestamp, &host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + host->monitor_cpu.cpu_timestamp.len + 1;
+
+    /* cpu usage */
+    host->monitor_cpu.cpu_usage = atof(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    /* cpu frequency */
+    appendStringInfoString(&host->monitor_cpu.cpu_freq, &host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + host->monitor_cpu.cpu_freq.len + 1;
+
+    /* memory timestamp with timezone */
+    appendStringInfoString(&host->monitor_mem.mem_timestamp, &host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + host->monitor_mem.mem_timestamp.len + 1;
+
+    /* memory total size (in Bytes)*/
+    host->monitor_mem.mem_total = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    /* memory used size (in Bytes) */
+    host->monitor_mem.mem_used = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    /* memory usage */
+    host->monitor_mem.mem_usage = atof(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    /* disk timestamp with timezone */
+    appendStringInfoString(&host->monitor_disk.disk_timestamptz, &host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + host->monitor_disk.disk_timestamptz.len + 1;
+
+    /* disk i/o read (in Bytes) */
+    host->monitor_disk.disk_io_read_bytes = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    /* disk i/o read time (in milliseconds) */
+    host->monitor_disk.disk_io_read_time = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    /* disk i/o write (in Bytes) */
+    host->monitor_disk.disk_io_write_bytes = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    /* disk i/o write time (in milliseconds) */
+    host->monitor_disk.disk_io_write_time = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
     
-    disk_usage = ((monitor_disk.disk_used/monitor_disk.disk_total)*100);
-    get_disk_usage_alarm(disk_usage, &monitor_alarm);
+    /* disk total size */
+    host->monitor_disk.disk_total = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
 
-    sent_speed = monitor_net.net_sent/1024/1024;
-    get_sent_speed_alarm(sent_speed, &monitor_alarm);
+    /* disk used size */
+    host->monitor_disk.disk_used = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
 
-    recv_speed = monitor_net.net_recv/1024/1024;
-    get_recv_speed_alarm(recv_speed, &monitor_alarm);
+    /* net timestamp with timezone */
+    appendStringInfoString(&host->monitor_net.net_timestamp, &host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + host->monitor_net.net_timestamp.len + 1;
 
-    get_disk_iops_alarm(disk_iops, &monitor_alarm);
+    /* net sent speed (in bytes/s) */
+    host->monitor_net.net_sent = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
 
-    pfree(agentRstStr.data);
-    pfree_all_table(&monitor_host,
-                   &monitor_cpu,
-                   &monitor_mem,
-                   &monitor_net,
-                   &monitor_disk,
-                   &monitor_alarm);
+    /* net recv speed (in bytes/s) */
+    host->monitor_net.net_recv = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
 
-    ma_close(ma);
-    SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tup_result));
+    /* host system */
+    appendStringInfoString(&host->monitor_host.system, &host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + host->monitor_host.system.len + 1;
+
+    /* host platform type */
+    appendStringInfoString(&host->monitor_host.platform_type, &host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + host->monitor_host.platform_type.len + 1;
+
+    /* host cpu total cores */
+    host->monitor_host.cpu_core_total = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    /* host cpu available cores */
+    host->monitor_host.cpu_core_available = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+    
+    /* host seconds since boot */
+    host->monitor_host.seconds_since_boot = strtoull(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    host->disk_iops = atof(&host->agentRstStr.data[host->agentRstStr.cursor]);
+    host->agentRstStr.cursor = host->agentRstStr.cursor + strlen(&host->agentRstStr.data[host->agentRstStr.cursor]) + 1;
+
+    host->monitor_host.run_state = 1;
+
+    resetStringInfo(&host->monitor_mem.mem_timestamp);
+    resetStringInfo(&host->monitor_disk.disk_timestamptz);
+    resetStringInfo(&host->monitor_net.net_timestamp);
+
+    appendStringInfoString(&host->monitor_mem.mem_timestamp, host->monitor_cpu.cpu_timestamp.data);
+    appendStringInfoString(&host->monitor_disk.disk_timestamptz, host->monitor_cpu.cpu_timestamp.data);
+    appendStringInfoString(&host->monitor_net.net_timestamp, host->monitor_cpu.cpu_timestamp.data);
+    appendStringInfoString(&host->monitor_host.current_time, host->monitor_cpu.cpu_timestamp.data);
+}
+
+/*
+ * insert the samples of all the hosts which answered, each table gets all
+ * its rows at once, then check them against the thresholds
+ */
+static void insert_into_monitor_tables(HostInfoCollect *hosts, int nhosts)
+{
+    HeapTuple *tuples;
+    HostInfoCollect *host;
+    Relation rel;
+    float disk_usage;
+    float sent_speed;
+    float recv_speed;
+    int ntuples;
+    int table;
+    int i;
+    static const Oid relids[] = {MonitorCpuRelationId, MonitorMemRelationId,
+        MonitorDiskRelationId, MonitorNetRelationId, MonitorHostRelationId};
+
+    tuples = palloc(sizeof(HeapTuple) * Max(nhosts, 1));
+    for (table = 0; table < lengthof(relids); table++)
+    {
+        rel = heap_open(relids[table], RowExclusiveLock);
+        ntuples = 0;
+        for (i = 0; i < nhosts; i++)
+        {
+            host = &hosts[i];
+            if (!host->ret)
+                continue;
+            switch (relids[table])
+            {
+                case MonitorCpuRelationId:
+                    tuples[ntuples++] = build_monitor_cpu_tuple(rel, host->hostname.data, &host->monitor_cpu);
+                    break;
+                case MonitorMemRelationId:
+                    tuples[ntuples++] = build_monitor_mem_tuple(rel, host->hostname.data, &host->monitor_mem);
+                    break;
+                case MonitorDiskRelationId:
+                    tuples[ntuples++] = build_monitor_disk_tuple(rel, host->hostname.data, &host->monitor_disk);
+                    break;
+                case MonitorNetRelationId:
+                    tuples[ntuples++] = build_monitor_net_tuple(rel, host->hostname.data, &host->monitor_net);
+                    break;
+                default:
+                    tuples[ntuples++] = build_monitor_host_tuple(rel, host->hostname.data, &host->monitor_host);
+                    break;
+            }
+        }
+        heap_close(rel, NoLock);
+        insert_monitor_tuples(relids[table], tuples, ntuples);
+        for (i = 0; i < ntuples; i++)
+            heap_freetuple(tuples[i]);
+    }
+    pfree(tuples);
+
+    for (i = 0; i < nhosts; i++)
+    {
+        host = &hosts[i];
+        if (host->ret)
+        {
+            appendStringInfoString(&host->monitor_alarm.alarm_timetz, host->monitor_cpu.cpu_timestamp.data);
+            host->monitor_alarm.alarm_type = 1;
+            host->monitor_alarm.alarm_status = 1;
+
+            get_cpu_usage_alarm(host->monitor_cpu.cpu_usage, &host->monitor_alarm);
+            get_mem_usage_alarm(host->monitor_mem.mem_usage, &host->monitor_alarm);
+
+            disk_usage = ((host->monitor_disk.disk_used/host->monitor_disk.disk_total)*100);
+            get_disk_usage_alarm(disk_usage, &host->monitor_alarm);
+
+            sent_speed = host->monitor_net.net_sent/1024/1024;
+            get_sent_speed_alarm(sent_speed, &host->monitor_alarm);
+
+            recv_speed = host->monitor_net.net_recv/1024/1024;
+            get_recv_speed_alarm(recv_speed, &host->monitor_alarm);
+
+            get_disk_iops_alarm(host->disk_iops, &host->monitor_alarm);
+        }
+
+        pfree_all_table(&host->monitor_host,
+                       &host->monitor_cpu,
+                       &host->monitor_mem,
+                       &host->monitor_net,
+                       &host->monitor_disk,
+                       &host->monitor_alarm);
+    }
 }
 
+/* insert the tuples into the monitor table relid and its indexes in one batch */
+static void insert_monitor_tuples(Oid relid, HeapTuple *tuples, int ntuples)
+{
+    Relation rel;
+    CatalogIndexState indstate;
+    int i;
 
-static void insert_into_monotor_cpu(const char *hostname, Monitor_Cpu *monitor_cpu)
+    if (ntuples == 0)
+        return;
+
+    rel = heap_open(relid, RowExclusiveLock);
+    heap_multi_insert(rel, tuples, ntuples, GetCurrentCommandId(true), 0, NULL);
+
+    indstate = CatalogOpenIndexes(rel);
+    for (i = 0; i < ntuples; i++)
+        CatalogIndexInsert(indstate, tuples[i]);
+    CatalogCloseIndexes(indstate);
+
+    heap_close(rel, RowExclusiveLock);
+}
+
+static HeapTuple build_monitor_cpu_tuple(Relation rel, const char *hostname, Monitor_Cpu *monitor_cpu)
 {
-    Relation monitorcpu;
-    HeapTuple newtuple;
     Datum datum[Natts_monitor_cpu];
     bool isnull[Natts_monitor_cpu];
 
@@ -398,18 +526,11 @@ static void insert_into_monotor_cpu(const char *hostname, Monitor_Cpu *monitor_c
 
     memset(isnull, 0, sizeof(isnull));
 
-    monitorcpu = heap_open(MonitorCpuRelationId, RowExclusiveLock);
-    newtuple = heap_form_tuple(RelationGetDescr(monitorcpu), datum, isnull);
-    simple_heap_insert(monitorcpu, newtuple);
-
-    heap_freetuple(newtuple);
-    heap_close(monitorcpu, RowExclusiveLock);
+    return heap_form_tuple(RelationGetDescr(rel), datum, isnull);
 }
 
-static void insert_into_monotor_mem(const char *hostname, Monitor_Mem *monitor_mem)
+static HeapTuple build_monitor_mem_tuple(Relation rel, const char *hostname, Monitor_Mem *monitor_mem)
 {
-    Relation monitormem;
-    HeapTuple newtuple;
     Datum datum[Natts_monitor_mem];
     bool isnull[Natts_monitor_mem];
 
@@ -422,18 +543,11 @@ static void insert_into_monotor_mem(const char *hostname, Monitor_Mem *monitor_m
 
     memset(isnull, 0, sizeof(isnull));
 
-    monitormem = heap_open(MonitorMemRelationId, RowExclusiveLock);
-    newtuple = heap_form_tuple(RelationGetDescr(monitormem), datum, isnull);
-    simple_heap_insert(monitormem, newtuple);
-
-    heap_freetuple(newtuple);
-    heap_close(monitormem, RowExclusiveLock);
+    return heap_form_tuple(RelationGetDescr(rel), datum, isnull);
 }
 
-static void insert_into_monotor_disk(const char *hostname, Monitor_Disk *monitor_disk)
+static HeapTuple build_monitor_disk_tuple(Relation rel, const char *hostname, Monitor_Disk *monitor_disk)
 {
-    Relation monitordisk;
-    HeapTuple newtuple;
     Datum datum[Natts_monitor_disk];
     bool isnull[Natts_monitor_disk];
 
@@ -449,18 +563,11 @@ static void insert_into_monotor_disk(const char *hostname, Monitor_Disk *monitor
 
     memset(isnull, 0, sizeof(isnull));
 
-    monitordisk = heap_open(MonitorDiskRelationId, RowExclusiveLock);
-    newtuple = heap_form_tuple(RelationGetDescr(monitordisk), datum, isnull);
-    simple_heap_insert(monitordisk, newtuple);
-
-    heap_freetuple(newtuple);
-    heap_close(monitordisk, RowExclusiveLock);
+    return heap_form_tuple(RelationGetDescr(rel), datum, isnull);
 }
 
-static void insert_into_monotor_net(const char *hostname, Monitor_Net *monitor_net)
+static HeapTuple build_monitor_net_tuple(Relation rel, const char *hostname, Monitor_Net *monitor_net)
 {
-    Relation monitornet;
-    HeapTuple newtuple;
     Datum datum[Natts_monitor_net];
     bool isnull[Natts_monitor_net];
 
@@ -472,18 +579,11 @@ static void insert_into_monotor_net(const char *hostname, Monitor_Net *monitor_n
 
     memset(isnull, 0, sizeof(isnull));
 
-    monitornet = heap_open(MonitorNetRelationId, RowExclusiveLock);
-    newtuple = heap_form_tuple(RelationGetDescr(monitornet), datum, isnull);
-    simple_heap_insert(monitornet, newtuple);
-
-    heap_freetuple(newtuple);
-    heap_close(monitornet, RowExclusiveLock);
+    return heap_form_tuple(RelationGetDescr(rel), datum, isnull);
 }
 
-static void insert_into_monotor_host(const char *hostname, Monitor_Host *monitor_host)
+static HeapTuple build_monitor_host_tuple(Relation rel, const char *hostname, Monitor_Host *monitor_host)
 {
-    Relation monitorhost;
-    HeapTuple newtuple;
     Datum datum[Natts_monitor_host];
     bool isnull[Natts_monitor_host];
 
@@ -499,12 +599,7 @@ static void insert_into_monotor_host(const char *hostname, Monitor_Host *monitor
 
     memset(isnull, 0, sizeof(isnull));
 
-    monitorhost = heap_open(MonitorHostRelationId, RowExclusiveLock);
-    newtuple = heap_form_tuple(RelationGetDescr(monitorhost), datum, isnull);
-    simple_heap_insert(monitorhost, newtuple);
-
-    heap_freetuple(newtuple);
-    heap_close(monitorhost, RowExclusiveLock);
+    return heap_form_tuple(RelationGetDescr(rel), datum, isnull);
 }
 void insert_into_monitor_alarm(Monitor_Alarm *monitor_alarm)
 {
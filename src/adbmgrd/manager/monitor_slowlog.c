@@ -48,6 +48,25 @@ typedef enum ThresholdItem
 	SLOWLOG_GETNUMONCE = 34
 }ThresholdItem;
 
+/*
+* the end of the last execution of the newest slow query read from one
+* coordinator, the next collection only asks the coordinator for the queries
+* executed since then through pg_stat_statements_since(). The watermarks live
+* as long as the backend, the first collection of a backend reads everything
+* once and the checks against today's and yesterday's records absorb it.
+*/
+typedef struct SlowlogWatermark
+{
+	Oid			nodeoid;
+	bool		checked;		/* is has_since known */
+	bool		has_since;		/* coordinator has pg_stat_statements_since */
+	bool		has_percentiles;	/* and it returns time_p99 */
+	char		last_exec[64];	/* empty before the first slow query */
+} SlowlogWatermark;
+
+static List *slowlog_watermarks = NIL;
+
+static SlowlogWatermark *monitor_get_slowlog_watermark(Oid nodeoid);
 
 /*given one explain sqlstr , return the result*/
 char *monitor_get_onestrvalue_one_node(int agentport, char *sqlstr, char *user, char *address, int port, char * dbname)
@@ -62,6 +81,28 @@ char *monitor_get_onestrvalue_one_node(int agentport, char *sqlstr, char *user,
 
 
 
+static SlowlogWatermark *monitor_get_slowlog_watermark(Oid nodeoid)
+{
+	SlowlogWatermark *watermark;
+	MemoryContext oldcontext;
+	ListCell *lc;
+
+	foreach(lc, slowlog_watermarks)
+	{
+		watermark = (SlowlogWatermark *)lfirst(lc);
+		if (watermark->nodeoid == nodeoid)
+			return watermark;
+	}
+
+	oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+	watermark = (SlowlogWatermark *)palloc0(sizeof(SlowlogWatermark));
+	watermark->nodeoid = nodeoid;
+	slowlog_watermarks = lappend(slowlog_watermarks, watermark);
+	MemoryContextSwitchTo(oldcontext);
+
+	return watermark;
+}
+
 /*
 * get GETMAXROWNUM rows from pg_stat_statements on everyone coordinator using given sql. using follow method to judge which need 
 * insert into monitor_slowlog table: 1. judge the query exist in yesterday records or not. if not in yesterday records 
@@ -71,14 +112,20 @@ char *monitor_get_onestrvalue_one_node(int agentport, char *sqlstr, char *user,
 * today's calls on the same query, ignore; if the query does exist in today's records and the calls does not equal, let
 * the calls plus 1.
 *
+* the rows of all the databases come in one query. when the coordinator has
+* pg_stat_statements_since(), only the queries executed since the watermark of
+* the coordinator are read, oldest first, so the cost follows the number of new
+* slow queries rather than the whole workload.
 */
 
-void monitor_get_onedb_slowdata_insert(Relation rel, int agentport, char *user, char *address, int port, char *dbname)
+void monitor_get_slowdata_insert(Relation rel, Oid nodeoid, int agentport, char *user, char *address, int port)
 {
 	StringInfoData sqlslowlogStrData;
 	StringInfoData resultstrdata;
 	StringInfoData querystr;
 	char strtmp[64];
+	char dbname[64];
+	char lastexec[64];
 	char *connectdbname = "postgres";
 	char dbuser[64];
 	char *pstr = NULL;
@@ -99,6 +146,7 @@ void monitor_get_onedb_slowdata_insert(Relation rel, int agentport, char *user,
 	Form_monitor_slowlog monitor_slowlog;	
 	pg_time_t ptimenow;
 	Monitor_Threshold monitor_threshold;
+	SlowlogWatermark *watermark;
 	
 	initStringInfo(&sqlslowlogStrData);
 	/*get slowlog min time threshold in MonitorHostThresholdRelationId*/
@@ -108,7 +156,30 @@ void monitor_get_onedb_slowdata_insert(Relation rel, int agentport, char *user,
 	get_threshold(SLOWLOG_GETNUMONCE, &monitor_threshold);
 	if (monitor_threshold.threshold_warning != 0)
 		slowlognumoncetime = monitor_threshold.threshold_warning;
-	appendStringInfo(&sqlslowlogStrData, "select usename, calls, total_time/1000 as totaltime, query  from pg_stat_statements, pg_user, pg_database where ( total_time/calls/1000) > %d and userid=usesysid and pg_database.oid = dbid and datname=\'%s\' limit %d;", slowlogmintime, dbname, slowlognumoncetime);
+	watermark = monitor_get_slowlog_watermark(nodeoid);
+	if (!watermark->checked)
+	{
+		int hassince = monitor_get_onesqlvalue_one_node(agentport, "select count(*) from pg_proc where proname = \'pg_stat_statements_since\';", user, address, port, connectdbname);
+		/*ask again next time if the coordinator cannot answer*/
+		watermark->checked = (hassince >= 0);
+		watermark->has_since = (hassince > 0);
+		if (watermark->has_since)
+		{
+			int haspercentiles = monitor_get_onesqlvalue_one_node(agentport, "select count(*) from pg_proc where proname = \'pg_stat_statements_since\' and \'time_p99\' = any(proargnames);", user, address, port, connectdbname);
+			watermark->checked = (haspercentiles >= 0);
+			watermark->has_percentiles = (haspercentiles > 0);
+		}
+	}
+	/*
+	* a query is slow when its mean time is over the threshold, or, when the
+	* coordinator keeps latency histograms, when its 99th percentile is
+	*/
+	if (watermark->has_percentiles)
+		appendStringInfo(&sqlslowlogStrData, "select usename, calls, total_time/1000 as totaltime, datname, last_exec, query from pg_stat_statements_since(\'%s\'), pg_user, pg_database where (( total_time/calls/1000) > %d or time_p99/1000 > %d) and userid=usesysid and pg_database.oid = dbid and datname != \'template0\' and datname != \'template1\' order by last_exec limit %d;", watermark->last_exec[0] == '\0' ? "-infinity" : watermark->last_exec, slowlogmintime, slowlogmintime, slowlognumoncetime);
+	else if (watermark->has_since)
+		appendStringInfo(&sqlslowlogStrData, "select usename, calls, total_time/1000 as totaltime, datname, last_exec, query from pg_stat_statements_since(\'%s\'), pg_user, pg_database where ( total_time/calls/1000) > %d and userid=usesysid and pg_database.oid = dbid and datname != \'template0\' and datname != \'template1\' order by last_exec limit %d;", watermark->last_exec[0] == '\0' ? "-infinity" : watermark->last_exec, slowlogmintime, slowlognumoncetime);
+	else
+		appendStringInfo(&sqlslowlogStrData, "select usename, calls, total_time/1000 as totaltime, datname, \'\' as last_exec, query from pg_stat_statements, pg_user, pg_database where ( total_time/calls/1000) > %d and userid=usesysid and pg_database.oid = dbid and datname != \'template0\' and datname != \'template1\' limit %d;", slowlogmintime, slowlognumoncetime);
 	time = GetCurrentTimestamp();
 	ptimenow = timestamptz_to_time_t(time);
 
@@ -122,6 +193,8 @@ void monitor_get_onedb_slowdata_insert(Relation rel, int agentport, char *user,
 	initStringInfo(&querystr);
 	pstr = resultstrdata.data;
 	strtmp[63] = '\0';
+	dbname[63] = '\0';
+	lastexec[0] = lastexec[63] = '\0';
 	while(*pstr != '\0' && iloop < slowlognumoncetime)
 	{
 		callstoday = 0;
@@ -146,6 +219,16 @@ void monitor_get_onedb_slowdata_insert(Relation rel, int agentport, char *user,
 		totaltime = atof(strtmp);
 		singletime = totaltime/calls;
 		pstr = pstr + strlen(strtmp) + 1;
+		/*get database name*/
+		if (!pstr)
+			ereport(ERROR, (errmsg("get dbname from slow log fail")));
+		strncpy(dbname, pstr, 63);
+		pstr = pstr + strlen(dbname) + 1;
+		/*get the end of the last execution, the rows come oldest first*/
+		if (!pstr)
+			ereport(ERROR, (errmsg("get last_exec from slow log fail")));
+		strncpy(lastexec, pstr, 63);
+		pstr = pstr + strlen(lastexec) + 1;
 		/*get query string*/
 		if (!pstr)
 			ereport(ERROR, (errmsg("get querystr from slow log fail")));
@@ -234,6 +317,9 @@ void monitor_get_onedb_slowdata_insert(Relation rel, int agentport, char *user,
 
 	}
 
+	/*move the watermark once all the rows got in*/
+	if (lastexec[0] != '\0')
+		strcpy(watermark->last_exec, lastexec);
 	pfree(resultstrdata.data);
 	pfree(querystr.data);
 }
@@ -247,12 +333,8 @@ Datum monitor_slowlog_insert_data(PG_FUNCTION_ARGS)
 	int agentport = 0;
 	char *address = NULL;
 	char *user = NULL;
-	char *dbname = NULL;
 	Relation rel_node;
 	Relation rel_slowlog;
-	List *dbnamelist = NIL;
-	ListCell *cell;
-	bool haveget = false;
 	HeapScanDesc rel_scan;
 	ScanKeyData key[1];
 	Form_mgr_node mgr_node;
@@ -289,30 +371,14 @@ Datum monitor_slowlog_insert_data(PG_FUNCTION_ARGS)
 		Assert(mgr_host);
 		agentport = mgr_host->hostagentport;
 		ReleaseSysCache(tup);
-		if(!haveget)
-		{
+		if(!user)
 			user = get_hostuser_from_hostoid(mgr_node->nodehost);
-			/*get database name list*/
-			dbnamelist = monitor_get_dbname_list(user, address, coordport);
-			if(dbnamelist == NULL)
-			{
-				ereport(ERROR, (errcode(ERRCODE_DATA_EXCEPTION)
-					,errmsg("get database namelist error")));
-			}
-		}
 		Assert(address != NULL);
 		Assert(user != NULL);
-		haveget = true;
-		foreach(cell, dbnamelist)
-		{
-			dbname = (char *)(lfirst(cell));
-			monitor_get_onedb_slowdata_insert(rel_slowlog, agentport, user, address, coordport, dbname);
-		}
+		monitor_get_slowdata_insert(rel_slowlog, HeapTupleGetOid(tuple), agentport, user, address, coordport);
 		pfree(address);
 	}
 	heap_endscan(rel_scan);
-	if (dbnamelist)
-		list_free(dbnamelist);
 	if(user)
 		pfree(user);
 	heap_close(rel_slowlog, RowExclusiveLock);
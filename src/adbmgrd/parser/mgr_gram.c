@@ -0,0 +1,7108 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         mgr_yyparse
+#define yylex           mgr_yylex
+#define yyerror         mgr_yyerror
+#define yydebug         mgr_yydebug
+#define yynerrs         mgr_yynerrs
+
+/* First part of user prologue.  */
+#line 1 "mgr_gram.y"
+
+
+#include "postgres.h"
+
+#include "nodes/makefuncs.h"
+#include "nodes/parsenodes.h"
+#include "nodes/value.h"
+#include "nodes/pg_list.h"
+#include "parser/mgr_node.h"
+#include "parser/parser.h"
+#include "parser/scanner.h"
+#include "catalog/mgr_cndnnode.h"
+#include "catalog/mgr_parm.h"
+#include "catalog/mgr_updateparm.h"
+#include "utils/builtins.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+#include "utils/syscache.h"
+#include "utils/tqual.h"
+#include "utils/fmgroids.h"    /* For F_NAMEEQ	*/
+#include "access/htup_details.h"
+#include "catalog/indexing.h"
+#include "catalog/mgr_host.h"
+#include "catalog/monitor_job.h"
+#include "catalog/monitor_jobitem.h"
+#include "catalog/pg_type.h"
+#include "commands/defrem.h"
+#include "funcapi.h"
+#include "libpq/ip.h"
+#include "mgr/mgr_agent.h"
+#include "mgr/mgr_cmds.h"
+#include "mgr/mgr_msg_type.h"
+#include "miscadmin.h"
+#include "nodes/parsenodes.h"
+#include "parser/mgr_node.h"
+/*
+ * The YY_EXTRA data that a flex scanner allows us to pass around.  Private
+ * state needed for raw parsing/lexing goes here.
+ */
+typedef struct mgr_yy_extra_type
+{
+	/*
+	 * Fields used by the core scanner.
+	 */
+	core_yy_extra_type core_yy_extra;
+
+	/*
+	 * State variables that belong to the grammar.
+	 */
+	List	   *parsetree;		/* final parse result is delivered here */
+} mgr_yy_extra_type;
+
+/*
+ * In principle we should use yyget_extra() to fetch the yyextra field
+ * from a yyscanner struct.  However, flex always puts that field first,
+ * and this is sufficiently performance-critical to make it seem worth
+ * cheating a bit to use an inline macro.
+ */
+#define mgr_yyget_extra(yyscanner) (*((mgr_yy_extra_type **) (yyscanner)))
+
+/*
+ * Location tracking support --- simpler than bison's default, since we only
+ * want to track the start position not the end position of each nonterminal.
+ */
+#define YYLLOC_DEFAULT(Current, Rhs, N) \
+	do { \
+		if ((N) > 0) \
+			(Current) = (Rhs)[1]; \
+		else \
+			(Current) = (-1); \
+	} while (0)
+
+#define YYMALLOC palloc
+#define YYFREE   pfree
+
+#define parser_yyerror(msg)  scanner_yyerror(msg, yyscanner)
+#define parser_errposition(pos)  scanner_errposition(pos, yyscanner)
+
+#define GTM_TYPE          'G'
+#define COORDINATOR_TYPE  'C'
+#define DATANODE_TYPE     'D'
+
+union YYSTYPE;					/* need forward reference for tok_is_keyword */
+static void mgr_yyerror(YYLTYPE *yylloc, core_yyscan_t yyscanner,
+						 const char *msg);
+static int mgr_yylex(union YYSTYPE *lvalp, YYLTYPE *llocp,
+		   core_yyscan_t yyscanner);
+List *mgr_parse_query(const char *query_string);
+static Node* make_column_in(const char *col_name, List *values);
+static Node* makeNode_RangeFunction(const char *func_name, List *func_args);
+static Node* make_func_call(const char *func_name, List *func_args);
+/* static List* make_start_agent_args(List *options); */
+extern char *defGetString(DefElem *def);
+static Node* make_ColumnRef(const char *col_name);
+static Node* make_whereClause_for_datanode(char* node_type_str, List* node_name_list, char* like_expr);
+static Node* make_whereClause_for_coord(char * node_type_str, List* node_name_list, char* like_expr);
+static Node* make_whereClause_for_gtm(char * node_type_str, List* node_name_list, char* like_expr);
+static void check_node_name_isvaild(char node_type, List* node_name_list);
+static void check__name_isvaild(List *node_name_list);
+static void check_host_name_isvaild(List *node_name_list);
+static void check_job_name_isvaild(List *node_name_list);
+static void check_jobitem_name_isvaild(List *node_name_list);
+
+#line 180 "mgr_gram.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "mgr_gram.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IDENT = 3,                      /* IDENT  */
+  YYSYMBOL_FCONST = 4,                     /* FCONST  */
+  YYSYMBOL_SCONST = 5,                     /* SCONST  */
+  YYSYMBOL_BCONST = 6,                     /* BCONST  */
+  YYSYMBOL_XCONST = 7,                     /* XCONST  */
+  YYSYMBOL_Op = 8,                         /* Op  */
+  YYSYMBOL_ICONST = 9,                     /* ICONST  */
+  YYSYMBOL_TYPECAST = 10,                  /* TYPECAST  */
+  YYSYMBOL_DOT_DOT = 11,                   /* DOT_DOT  */
+  YYSYMBOL_COLON_EQUALS = 12,              /* COLON_EQUALS  */
+  YYSYMBOL_ADD_P = 13,                     /* ADD_P  */
+  YYSYMBOL_DEPLOY = 14,                    /* DEPLOY  */
+  YYSYMBOL_DROP = 15,                      /* DROP  */
+  YYSYMBOL_ALTER = 16,                     /* ALTER  */
+  YYSYMBOL_LIST = 17,                      /* LIST  */
+  YYSYMBOL_CREATE = 18,                    /* CREATE  */
+  YYSYMBOL_ACL = 19,                       /* ACL  */
+  YYSYMBOL_CLUSTER = 20,                   /* CLUSTER  */
+  YYSYMBOL_IF_P = 21,                      /* IF_P  */
+  YYSYMBOL_EXISTS = 22,                    /* EXISTS  */
+  YYSYMBOL_NOT = 23,                       /* NOT  */
+  YYSYMBOL_FALSE_P = 24,                   /* FALSE_P  */
+  YYSYMBOL_TRUE_P = 25,                    /* TRUE_P  */
+  YYSYMBOL_HOST = 26,                      /* HOST  */
+  YYSYMBOL_MONITOR = 27,                   /* MONITOR  */
+  YYSYMBOL_PARAM = 28,                     /* PARAM  */
+  YYSYMBOL_HBA = 29,                       /* HBA  */
+  YYSYMBOL_HA = 30,                        /* HA  */
+  YYSYMBOL_INIT = 31,                      /* INIT  */
+  YYSYMBOL_GTM = 32,                       /* GTM  */
+  YYSYMBOL_MASTER = 33,                    /* MASTER  */
+  YYSYMBOL_SLAVE = 34,                     /* SLAVE  */
+  YYSYMBOL_EXTRA = 35,                     /* EXTRA  */
+  YYSYMBOL_ALL = 36,                       /* ALL  */
+  YYSYMBOL_NODE = 37,                      /* NODE  */
+  YYSYMBOL_COORDINATOR = 38,               /* COORDINATOR  */
+  YYSYMBOL_DATANODE = 39,                  /* DATANODE  */
+  YYSYMBOL_PASSWORD = 40,                  /* PASSWORD  */
+  YYSYMBOL_CLEAN = 41,                     /* CLEAN  */
+  YYSYMBOL_RESET = 42,                     /* RESET  */
+  YYSYMBOL_WHERE = 43,                     /* WHERE  */
+  YYSYMBOL_ROW_ID = 44,                    /* ROW_ID  */
+  YYSYMBOL_START = 45,                     /* START  */
+  YYSYMBOL_AGENT = 46,                     /* AGENT  */
+  YYSYMBOL_STOP = 47,                      /* STOP  */
+  YYSYMBOL_FAILOVER = 48,                  /* FAILOVER  */
+  YYSYMBOL_SET = 49,                       /* SET  */
+  YYSYMBOL_TO = 50,                        /* TO  */
+  YYSYMBOL_ON = 51,                        /* ON  */
+  YYSYMBOL_OFF = 52,                       /* OFF  */
+  YYSYMBOL_APPEND = 53,                    /* APPEND  */
+  YYSYMBOL_CONFIG = 54,                    /* CONFIG  */
+  YYSYMBOL_MODE = 55,                      /* MODE  */
+  YYSYMBOL_FAST = 56,                      /* FAST  */
+  YYSYMBOL_SMART = 57,                     /* SMART  */
+  YYSYMBOL_IMMEDIATE = 58,                 /* IMMEDIATE  */
+  YYSYMBOL_S = 59,                         /* S  */
+  YYSYMBOL_I = 60,                         /* I  */
+  YYSYMBOL_F = 61,                         /* F  */
+  YYSYMBOL_FORCE = 62,                     /* FORCE  */
+  YYSYMBOL_SHOW = 63,                      /* SHOW  */
+  YYSYMBOL_FLUSH = 64,                     /* FLUSH  */
+  YYSYMBOL_GRANT = 65,                     /* GRANT  */
+  YYSYMBOL_REVOKE = 66,                    /* REVOKE  */
+  YYSYMBOL_FROM = 67,                      /* FROM  */
+  YYSYMBOL_ITEM = 68,                      /* ITEM  */
+  YYSYMBOL_JOB = 69,                       /* JOB  */
+  YYSYMBOL_EXTENSION = 70,                 /* EXTENSION  */
+  YYSYMBOL_REMOVE = 71,                    /* REMOVE  */
+  YYSYMBOL_DATA_CHECKSUMS = 72,            /* DATA_CHECKSUMS  */
+  YYSYMBOL_STATUS = 73,                    /* STATUS  */
+  YYSYMBOL_ACTIVATE = 74,                  /* ACTIVATE  */
+  YYSYMBOL_PROMOTE = 75,                   /* PROMOTE  */
+  YYSYMBOL_ADBMGR = 76,                    /* ADBMGR  */
+  YYSYMBOL_REWIND = 77,                    /* REWIND  */
+  YYSYMBOL_SWITCHOVER = 78,                /* SWITCHOVER  */
+  YYSYMBOL_GET_HOST_LIST_ALL = 79,         /* GET_HOST_LIST_ALL  */
+  YYSYMBOL_GET_HOST_LIST_SPEC = 80,        /* GET_HOST_LIST_SPEC  */
+  YYSYMBOL_GET_HOST_HISTORY_USAGE = 81,    /* GET_HOST_HISTORY_USAGE  */
+  YYSYMBOL_GET_HOST_HISTORY_USAGE_BY_TIME_PERIOD = 82, /* GET_HOST_HISTORY_USAGE_BY_TIME_PERIOD  */
+  YYSYMBOL_GET_ALL_NODENAME_IN_SPEC_HOST = 83, /* GET_ALL_NODENAME_IN_SPEC_HOST  */
+  YYSYMBOL_GET_AGTM_NODE_TOPOLOGY = 84,    /* GET_AGTM_NODE_TOPOLOGY  */
+  YYSYMBOL_GET_COORDINATOR_NODE_TOPOLOGY = 85, /* GET_COORDINATOR_NODE_TOPOLOGY  */
+  YYSYMBOL_GET_DATANODE_NODE_TOPOLOGY = 86, /* GET_DATANODE_NODE_TOPOLOGY  */
+  YYSYMBOL_GET_CLUSTER_SUMMARY = 87,       /* GET_CLUSTER_SUMMARY  */
+  YYSYMBOL_GET_DATABASE_TPS_QPS = 88,      /* GET_DATABASE_TPS_QPS  */
+  YYSYMBOL_GET_CLUSTER_HEADPAGE_LINE = 89, /* GET_CLUSTER_HEADPAGE_LINE  */
+  YYSYMBOL_GET_DATABASE_TPS_QPS_INTERVAL_TIME = 90, /* GET_DATABASE_TPS_QPS_INTERVAL_TIME  */
+  YYSYMBOL_MONITOR_DATABASETPS_FUNC_BY_TIME_PERIOD = 91, /* MONITOR_DATABASETPS_FUNC_BY_TIME_PERIOD  */
+  YYSYMBOL_GET_DATABASE_SUMMARY = 92,      /* GET_DATABASE_SUMMARY  */
+  YYSYMBOL_GET_SLOWLOG = 93,               /* GET_SLOWLOG  */
+  YYSYMBOL_GET_USER_INFO = 94,             /* GET_USER_INFO  */
+  YYSYMBOL_UPDATE_USER = 95,               /* UPDATE_USER  */
+  YYSYMBOL_GET_SLOWLOG_COUNT = 96,         /* GET_SLOWLOG_COUNT  */
+  YYSYMBOL_UPDATE_THRESHOLD_VALUE = 97,    /* UPDATE_THRESHOLD_VALUE  */
+  YYSYMBOL_UPDATE_PASSWORD = 98,           /* UPDATE_PASSWORD  */
+  YYSYMBOL_CHECK_USER = 99,                /* CHECK_USER  */
+  YYSYMBOL_USER = 100,                     /* USER  */
+  YYSYMBOL_GET_THRESHOLD_TYPE = 101,       /* GET_THRESHOLD_TYPE  */
+  YYSYMBOL_GET_THRESHOLD_ALL_TYPE = 102,   /* GET_THRESHOLD_ALL_TYPE  */
+  YYSYMBOL_CHECK_PASSWORD = 103,           /* CHECK_PASSWORD  */
+  YYSYMBOL_GET_DB_THRESHOLD_ALL_TYPE = 104, /* GET_DB_THRESHOLD_ALL_TYPE  */
+  YYSYMBOL_GET_ALARM_INFO_ASC = 105,       /* GET_ALARM_INFO_ASC  */
+  YYSYMBOL_GET_ALARM_INFO_DESC = 106,      /* GET_ALARM_INFO_DESC  */
+  YYSYMBOL_RESOLVE_ALARM = 107,            /* RESOLVE_ALARM  */
+  YYSYMBOL_GET_ALARM_INFO_COUNT = 108,     /* GET_ALARM_INFO_COUNT  */
+  YYSYMBOL_GET_CLUSTER_TPS_QPS = 109,      /* GET_CLUSTER_TPS_QPS  */
+  YYSYMBOL_GET_CLUSTER_CONNECT_DBSIZE_INDEXSIZE = 110, /* GET_CLUSTER_CONNECT_DBSIZE_INDEXSIZE  */
+  YYSYMBOL_111_ = 111,                     /* ';'  */
+  YYSYMBOL_112_ = 112,                     /* ','  */
+  YYSYMBOL_113_ = 113,                     /* '('  */
+  YYSYMBOL_114_ = 114,                     /* ')'  */
+  YYSYMBOL_115_ = 115,                     /* '='  */
+  YYSYMBOL_116_ = 116,                     /* '.'  */
+  YYSYMBOL_117_ = 117,                     /* '-'  */
+  YYSYMBOL_118_ = 118,                     /* '*'  */
+  YYSYMBOL_119_ = 119,                     /* '+'  */
+  YYSYMBOL_YYACCEPT = 120,                 /* $accept  */
+  YYSYMBOL_stmtblock = 121,                /* stmtblock  */
+  YYSYMBOL_stmtmulti = 122,                /* stmtmulti  */
+  YYSYMBOL_stmt = 123,                     /* stmt  */
+  YYSYMBOL_AlterUserStmt = 124,            /* AlterUserStmt  */
+  YYSYMBOL_GrantStmt = 125,                /* GrantStmt  */
+  YYSYMBOL_privilege_list = 126,           /* privilege_list  */
+  YYSYMBOL_privilege = 127,                /* privilege  */
+  YYSYMBOL_username_list = 128,            /* username_list  */
+  YYSYMBOL_username = 129,                 /* username  */
+  YYSYMBOL_DropUserStmt = 130,             /* DropUserStmt  */
+  YYSYMBOL_name_list = 131,                /* name_list  */
+  YYSYMBOL_name = 132,                     /* name  */
+  YYSYMBOL_ColId = 133,                    /* ColId  */
+  YYSYMBOL_CreateUserStmt = 134,           /* CreateUserStmt  */
+  YYSYMBOL_OptRoleList = 135,              /* OptRoleList  */
+  YYSYMBOL_AlterOptRoleList = 136,         /* AlterOptRoleList  */
+  YYSYMBOL_CreateOptRoleElem = 137,        /* CreateOptRoleElem  */
+  YYSYMBOL_AlterOptRoleElem = 138,         /* AlterOptRoleElem  */
+  YYSYMBOL_AppendNodeStmt = 139,           /* AppendNodeStmt  */
+  YYSYMBOL_Get_alarm_info = 140,           /* Get_alarm_info  */
+  YYSYMBOL_Gettopologyparm = 141,          /* Gettopologyparm  */
+  YYSYMBOL_Gethostparm = 142,              /* Gethostparm  */
+  YYSYMBOL_Update_host_config_value = 143, /* Update_host_config_value  */
+  YYSYMBOL_Get_host_threshold = 144,       /* Get_host_threshold  */
+  YYSYMBOL_MonitorStmt = 145,              /* MonitorStmt  */
+  YYSYMBOL_hostname_list = 146,            /* hostname_list  */
+  YYSYMBOL_hostname = 147,                 /* hostname  */
+  YYSYMBOL_node_type = 148,                /* node_type  */
+  YYSYMBOL_opt_general_all = 149,          /* opt_general_all  */
+  YYSYMBOL_VariableSetStmt = 150,          /* VariableSetStmt  */
+  YYSYMBOL_set_rest = 151,                 /* set_rest  */
+  YYSYMBOL_set_rest_more = 152,            /* set_rest_more  */
+  YYSYMBOL_var_name = 153,                 /* var_name  */
+  YYSYMBOL_var_dotparam = 154,             /* var_dotparam  */
+  YYSYMBOL_var_showparam = 155,            /* var_showparam  */
+  YYSYMBOL_var_list = 156,                 /* var_list  */
+  YYSYMBOL_var_value = 157,                /* var_value  */
+  YYSYMBOL_opt_boolean_or_string = 158,    /* opt_boolean_or_string  */
+  YYSYMBOL_NonReservedWord_or_Sconst = 159, /* NonReservedWord_or_Sconst  */
+  YYSYMBOL_RoleId = 160,                   /* RoleId  */
+  YYSYMBOL_NonReservedWord = 161,          /* NonReservedWord  */
+  YYSYMBOL_NumericOnly = 162,              /* NumericOnly  */
+  YYSYMBOL_AddHostStmt = 163,              /* AddHostStmt  */
+  YYSYMBOL_opt_general_options = 164,      /* opt_general_options  */
+  YYSYMBOL_set_parm_general_options = 165, /* set_parm_general_options  */
+  YYSYMBOL_general_options = 166,          /* general_options  */
+  YYSYMBOL_general_option_list = 167,      /* general_option_list  */
+  YYSYMBOL_general_option_item = 168,      /* general_option_item  */
+  YYSYMBOL_general_option_arg = 169,       /* general_option_arg  */
+  YYSYMBOL_DropHostStmt = 170,             /* DropHostStmt  */
+  YYSYMBOL_ObjList = 171,                  /* ObjList  */
+  YYSYMBOL_ListHostStmt = 172,             /* ListHostStmt  */
+  YYSYMBOL_AConstList = 173,               /* AConstList  */
+  YYSYMBOL_NodeConstList = 174,            /* NodeConstList  */
+  YYSYMBOL_targetList = 175,               /* targetList  */
+  YYSYMBOL_target_el = 176,                /* target_el  */
+  YYSYMBOL_Ident = 177,                    /* Ident  */
+  YYSYMBOL_set_ident = 178,                /* set_ident  */
+  YYSYMBOL_SConst = 179,                   /* SConst  */
+  YYSYMBOL_Iconst = 180,                   /* Iconst  */
+  YYSYMBOL_SignedIconst = 181,             /* SignedIconst  */
+  YYSYMBOL_ColLabel = 182,                 /* ColLabel  */
+  YYSYMBOL_AlterHostStmt = 183,            /* AlterHostStmt  */
+  YYSYMBOL_StartAgentStmt = 184,           /* StartAgentStmt  */
+  YYSYMBOL_StopAgentStmt = 185,            /* StopAgentStmt  */
+  YYSYMBOL_AddUpdataparmStmt = 186,        /* AddUpdataparmStmt  */
+  YYSYMBOL_ResetUpdataparmStmt = 187,      /* ResetUpdataparmStmt  */
+  YYSYMBOL_ListParmStmt = 188,             /* ListParmStmt  */
+  YYSYMBOL_CleanAllStmt = 189,             /* CleanAllStmt  */
+  YYSYMBOL_AddHbaStmt = 190,               /* AddHbaStmt  */
+  YYSYMBOL_DropHbaStmt = 191,              /* DropHbaStmt  */
+  YYSYMBOL_ListHbaStmt = 192,              /* ListHbaStmt  */
+  YYSYMBOL_HbaParaList = 193,              /* HbaParaList  */
+  YYSYMBOL_AddNodeStmt = 194,              /* AddNodeStmt  */
+  YYSYMBOL_AlterNodeStmt = 195,            /* AlterNodeStmt  */
+  YYSYMBOL_DropNodeStmt = 196,             /* DropNodeStmt  */
+  YYSYMBOL_ListAclStmt = 197,              /* ListAclStmt  */
+  YYSYMBOL_ListNodeStmt = 198,             /* ListNodeStmt  */
+  YYSYMBOL_InitNodeStmt = 199,             /* InitNodeStmt  */
+  YYSYMBOL_StartNodeMasterStmt = 200,      /* StartNodeMasterStmt  */
+  YYSYMBOL_StopNodeMasterStmt = 201,       /* StopNodeMasterStmt  */
+  YYSYMBOL_FailoverStmt = 202,             /* FailoverStmt  */
+  YYSYMBOL_opt_general_force = 203,        /* opt_general_force  */
+  YYSYMBOL_DeploryStmt = 204,              /* DeploryStmt  */
+  YYSYMBOL_opt_password = 205,             /* opt_password  */
+  YYSYMBOL_opt_stop_mode = 206,            /* opt_stop_mode  */
+  YYSYMBOL_opt_gtm_inner_type = 207,       /* opt_gtm_inner_type  */
+  YYSYMBOL_opt_dn_inner_type = 208,        /* opt_dn_inner_type  */
+  YYSYMBOL_opt_slave_inner_type = 209,     /* opt_slave_inner_type  */
+  YYSYMBOL_cluster_type = 210,             /* cluster_type  */
+  YYSYMBOL_sub_like_expr = 211,            /* sub_like_expr  */
+  YYSYMBOL_ListMonitor = 212,              /* ListMonitor  */
+  YYSYMBOL_ShowStmt = 213,                 /* ShowStmt  */
+  YYSYMBOL_FlushHost = 214,                /* FlushHost  */
+  YYSYMBOL_AddJobitemStmt = 215,           /* AddJobitemStmt  */
+  YYSYMBOL_AlterJobitemStmt = 216,         /* AlterJobitemStmt  */
+  YYSYMBOL_DropJobitemStmt = 217,          /* DropJobitemStmt  */
+  YYSYMBOL_ListJobStmt = 218,              /* ListJobStmt  */
+  YYSYMBOL_AddExtensionStmt = 219,         /* AddExtensionStmt  */
+  YYSYMBOL_DropExtensionStmt = 220,        /* DropExtensionStmt  */
+  YYSYMBOL_RemoveNodeStmt = 221,           /* RemoveNodeStmt  */
+  YYSYMBOL_FailoverManualStmt = 222,       /* FailoverManualStmt  */
+  YYSYMBOL_SwitchoverStmt = 223,           /* SwitchoverStmt  */
+  YYSYMBOL_unreserved_keyword = 224,       /* unreserved_keyword  */
+  YYSYMBOL_reserved_keyword = 225          /* reserved_keyword  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  314
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   5094
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  120
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  106
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  469
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  883
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   365
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+     113,   114,   118,   119,   112,   117,   116,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,   111,
+       2,   115,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   212,   212,   219,   226,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
+     251,   252,   253,   254,   255,   256,   257,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+     282,   283,   285,   289,   300,   311,   321,   331,   342,   352,
+     365,   367,   371,   372,   376,   378,   382,   385,   395,   396,
+     400,   402,   405,   416,   417,   421,   425,   429,   450,   459,
+     468,   476,   484,   493,   502,   510,   518,   527,   538,   553,
+     568,   581,   593,   600,   607,   616,   623,   631,   640,   650,
+     660,   673,   681,   688,   709,   716,   723,   730,   738,   746,
+     753,   762,   769,   776,   785,   797,   799,   803,   806,   807,
+     808,   809,   810,   811,   812,   816,   817,   821,   829,   832,
+     840,   850,   851,   858,   865,   866,   868,   869,   872,   873,
+     876,   877,   878,   884,   888,   889,   892,   894,   895,   899,
+     900,   905,   909,   917,   928,   929,   933,   936,   943,   947,
+     954,   955,   956,   957,   958,   964,   965,   966,   967,   968,
+     972,   979,   989,   993,  1000,  1007,  1014,  1024,  1037,  1038,
+    1041,  1042,  1045,  1046,  1050,  1060,  1067,  1068,  1071,  1072,
+    1074,  1075,  1077,  1078,  1079,  1082,  1083,  1084,  1088,  1099,
+    1107,  1120,  1127,  1140,  1150,  1160,  1170,  1180,  1190,  1200,
+    1210,  1220,  1230,  1240,  1247,  1257,  1267,  1277,  1287,  1297,
+    1307,  1317,  1327,  1337,  1350,  1357,  1402,  1513,  1520,  1529,
+    1538,  1547,  1557,  1567,  1577,  1584,  1593,  1594,  1602,  1611,
+    1620,  1629,  1638,  1647,  1660,  1669,  1678,  1690,  1698,  1706,
+    1714,  1722,  1730,  1741,  1751,  1758,  1765,  1775,  1785,  1794,
+    1805,  1814,  1823,  1922,  1930,  1940,  1948,  1956,  1964,  1971,
+    1978,  1986,  1993,  2001,  2008,  2015,  2023,  2031,  2038,  2049,
+    2058,  2067,  2076,  2088,  2097,  2106,  2115,  2124,  2133,  2142,
+    2151,  2161,  2173,  2189,  2199,  2209,  2219,  2229,  2239,  2251,
+    2252,  2256,  2264,  2277,  2278,  2279,  2282,  2283,  2284,  2285,
+    2286,  2287,  2288,  2292,  2293,  2294,  2297,  2298,  2299,  2302,
+    2303,  2304,  2305,  2309,  2310,  2311,  2312,  2313,  2314,  2318,
+    2319,  2323,  2330,  2337,  2344,  2351,  2358,  2368,  2378,  2386,
+    2398,  2408,  2417,  2425,  2439,  2448,  2460,  2472,  2479,  2487,
+    2495,  2503,  2514,  2521,  2531,  2538,  2545,  2552,  2562,  2569,
+    2579,  2586,  2599,  2608,  2617,  2624,  2631,  2641,  2650,  2659,
+    2668,  2677,  2689,  2699,  2709,  2719,  2732,  2733,  2734,  2735,
+    2736,  2737,  2738,  2739,  2740,  2741,  2742,  2743,  2744,  2745,
+    2746,  2747,  2748,  2749,  2750,  2751,  2752,  2753,  2754,  2755,
+    2756,  2757,  2758,  2759,  2760,  2761,  2762,  2763,  2764,  2765,
+    2766,  2767,  2768,  2769,  2770,  2771,  2772,  2773,  2774,  2775,
+    2776,  2777,  2778,  2779,  2780,  2781,  2782,  2783,  2784,  2785,
+    2786,  2787,  2788,  2789,  2790,  2791,  2792,  2793,  2794,  2795,
+    2796,  2797,  2798,  2799,  2800,  2801,  2802,  2803,  2804,  2805,
+    2806,  2807,  2808,  2809,  2810,  2811,  2812,  2813,  2814,  2818,
+    2819,  2820,  2821,  2822,  2823,  2824,  2825,  2826,  2827,  2828
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IDENT", "FCONST",
+  "SCONST", "BCONST", "XCONST", "Op", "ICONST", "TYPECAST", "DOT_DOT",
+  "COLON_EQUALS", "ADD_P", "DEPLOY", "DROP", "ALTER", "LIST", "CREATE",
+  "ACL", "CLUSTER", "IF_P", "EXISTS", "NOT", "FALSE_P", "TRUE_P", "HOST",
+  "MONITOR", "PARAM", "HBA", "HA", "INIT", "GTM", "MASTER", "SLAVE",
+  "EXTRA", "ALL", "NODE", "COORDINATOR", "DATANODE", "PASSWORD", "CLEAN",
+  "RESET", "WHERE", "ROW_ID", "START", "AGENT", "STOP", "FAILOVER", "SET",
+  "TO", "ON", "OFF", "APPEND", "CONFIG", "MODE", "FAST", "SMART",
+  "IMMEDIATE", "S", "I", "F", "FORCE", "SHOW", "FLUSH", "GRANT", "REVOKE",
+  "FROM", "ITEM", "JOB", "EXTENSION", "REMOVE", "DATA_CHECKSUMS", "STATUS",
+  "ACTIVATE", "PROMOTE", "ADBMGR", "REWIND", "SWITCHOVER",
+  "GET_HOST_LIST_ALL", "GET_HOST_LIST_SPEC", "GET_HOST_HISTORY_USAGE",
+  "GET_HOST_HISTORY_USAGE_BY_TIME_PERIOD", "GET_ALL_NODENAME_IN_SPEC_HOST",
+  "GET_AGTM_NODE_TOPOLOGY", "GET_COORDINATOR_NODE_TOPOLOGY",
+  "GET_DATANODE_NODE_TOPOLOGY", "GET_CLUSTER_SUMMARY",
+  "GET_DATABASE_TPS_QPS", "GET_CLUSTER_HEADPAGE_LINE",
+  "GET_DATABASE_TPS_QPS_INTERVAL_TIME",
+  "MONITOR_DATABASETPS_FUNC_BY_TIME_PERIOD", "GET_DATABASE_SUMMARY",
+  "GET_SLOWLOG", "GET_USER_INFO", "UPDATE_USER", "GET_SLOWLOG_COUNT",
+  "UPDATE_THRESHOLD_VALUE", "UPDATE_PASSWORD", "CHECK_USER", "USER",
+  "GET_THRESHOLD_TYPE", "GET_THRESHOLD_ALL_TYPE", "CHECK_PASSWORD",
+  "GET_DB_THRESHOLD_ALL_TYPE", "GET_ALARM_INFO_ASC", "GET_ALARM_INFO_DESC",
+  "RESOLVE_ALARM", "GET_ALARM_INFO_COUNT", "GET_CLUSTER_TPS_QPS",
+  "GET_CLUSTER_CONNECT_DBSIZE_INDEXSIZE", "';'", "','", "'('", "')'",
+  "'='", "'.'", "'-'", "'*'", "'+'", "$accept", "stmtblock", "stmtmulti",
+  "stmt", "AlterUserStmt", "GrantStmt", "privilege_list", "privilege",
+  "username_list", "username", "DropUserStmt", "name_list", "name",
+  "ColId", "CreateUserStmt", "OptRoleList", "AlterOptRoleList",
+  "CreateOptRoleElem", "AlterOptRoleElem", "AppendNodeStmt",
+  "Get_alarm_info", "Gettopologyparm", "Gethostparm",
+  "Update_host_config_value", "Get_host_threshold", "MonitorStmt",
+  "hostname_list", "hostname", "node_type", "opt_general_all",
+  "VariableSetStmt", "set_rest", "set_rest_more", "var_name",
+  "var_dotparam", "var_showparam", "var_list", "var_value",
+  "opt_boolean_or_string", "NonReservedWord_or_Sconst", "RoleId",
+  "NonReservedWord", "NumericOnly", "AddHostStmt", "opt_general_options",
+  "set_parm_general_options", "general_options", "general_option_list",
+  "general_option_item", "general_option_arg", "DropHostStmt", "ObjList",
+  "ListHostStmt", "AConstList", "NodeConstList", "targetList", "target_el",
+  "Ident", "set_ident", "SConst", "Iconst", "SignedIconst", "ColLabel",
+  "AlterHostStmt", "StartAgentStmt", "StopAgentStmt", "AddUpdataparmStmt",
+  "ResetUpdataparmStmt", "ListParmStmt", "CleanAllStmt", "AddHbaStmt",
+  "DropHbaStmt", "ListHbaStmt", "HbaParaList", "AddNodeStmt",
+  "AlterNodeStmt", "DropNodeStmt", "ListAclStmt", "ListNodeStmt",
+  "InitNodeStmt", "StartNodeMasterStmt", "StopNodeMasterStmt",
+  "FailoverStmt", "opt_general_force", "DeploryStmt", "opt_password",
+  "opt_stop_mode", "opt_gtm_inner_type", "opt_dn_inner_type",
+  "opt_slave_inner_type", "cluster_type", "sub_like_expr", "ListMonitor",
+  "ShowStmt", "FlushHost", "AddJobitemStmt", "AlterJobitemStmt",
+  "DropJobitemStmt", "ListJobStmt", "AddExtensionStmt",
+  "DropExtensionStmt", "RemoveNodeStmt", "FailoverManualStmt",
+  "SwitchoverStmt", "unreserved_keyword", "reserved_keyword", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-712)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-329)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    4984,   276,    27,   130,   185,   120,   -75,   201,    -3,   300,
+     105,   225,   285,    -1,    47,   138,    60,  3158,    50,  1862,
+    1970,   128,    69,    72,   101,   103,  -712,    21,    38,    52,
+      84,  -712,  -712,  -712,  -712,  -712,  -712,    88,   102,   114,
+     125,    10,    10,   142,   147,    10,   156,   159,  -712,   182,
+    -712,   190,   196,   199,   206,  -712,  -712,   155,     3,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  3266,  2078,   332,
+    3374,   362,  3482,  3590,  3158,  -712,   178,   -20,  -712,  3698,
+    2078,   332,  3806,   362,  3914,  4022,  3158,   179,  3158,   332,
+    3158,   362,  3158,  3158,  4130,   284,  1429,   203,  3158,  1321,
+    3158,  3158,  4130,  1537,   210,  -712,  -712,   215,    39,  2186,
+    -712,   256,   325,   332,  -712,  3158,   362,   232,  2078,   248,
+     265,  -712,  2294,   319,    42,   336,   282,  2402,   344,    51,
+    4238,  4346,  -712,   327,   374,  2078,   435,  -712,  -712,   -34,
+      83,  3158,   368,   312,   323,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  3158,
+    -712,  -712,  -712,   309,   -29,  -712,  -712,   306,   -38,   332,
+    3158,   362,   332,   362,   101,    96,   257,  3158,   332,   362,
+    3158,  3158,  3158,  3158,  3158,  3158,  3158,  3158,  -712,   373,
+     373,  -712,  -712,   272,  3158,    10,   274,  3158,    10,    10,
+    3158,  3158,    10,  3158,  -712,  4984,   366,   277,  -712,  -712,
+     298,  -712,  -712,  -712,  4454,   404,   277,  -712,  -712,  -712,
+    4562,   405,   277,   412,   277,  -712,  1646,  -712,   417,  -712,
+     421,   333,  -712,   334,  4670,   424,   333,  4778,   429,   333,
+     434,   333,  -712,  -712,   361,  -712,  -712,   277,  3158,   277,
+    3158,   277,   277,  -712,   437,  -712,  -712,  -712,  1213,   367,
+    -712,   382,   438,   390,  3158,   442,   370,  -712,  -712,   397,
+    1213,   367,   367,   367,  -712,  1213,   367,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,   375,  -712,  -712,   370,  -712,
+    -712,  3158,   370,  3158,   277,  3158,   277,   277,  2078,  3158,
+    3158,  3158,  -712,  -712,   370,  2510,  2618,  2726,  -712,   178,
+     -20,  3158,  3158,  3158,   282,   406,  -712,   282,   -32,  2834,
+    2942,  3050,   282,  -712,   375,  3158,  3158,   418,  3158,  3158,
+     418,  -712,   277,  3158,   277,   277,  2078,  1105,  1105,   487,
+    3158,  3158,     1,  3158,  3158,  3158,  3158,  3158,  -712,  -712,
+     377,   491,    62,  4886,   491,    74,  3158,   333,  3158,  3158,
+    3158,  3158,  -712,  -712,  -712,  -712,  -712,  3158,  3158,    49,
+     383,   385,   384,   387,   388,   389,   392,  -712,  -712,  3158,
+     393,   394,  3158,   395,   396,   399,   400,   401,   402,   403,
+    -712,   479,  1754,  -712,  -712,  3158,   485,   277,   480,  -712,
+     486,   277,   494,  -712,   495,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  3158,  3158,  3158,  -712,   498,   333,
+    3158,   499,   333,  3158,  3158,   179,  -712,   277,  -712,   277,
+    -712,  -712,   517,  -712,  -712,  -712,    59,  -712,  -712,  3158,
+     489,   492,   493,  3158,  3158,  3158,  -712,  -712,  -712,   122,
+     437,   192,  -712,   370,   461,  -712,   277,   465,   468,   277,
+    -712,  -712,  -712,  -712,   370,  -712,   370,  -712,   370,  -712,
+    -712,   282,   282,   282,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,   282,   -32,   282,   -32,   282,   -32,  -712,
+     418,   418,  -712,  -712,   418,   418,  -712,   469,   277,   470,
+     471,   277,  -712,  -712,  -712,  -712,   205,   422,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,   422,  -712,  -712,  -712,  3158,
+    -712,   463,  -712,  -712,  -712,  -712,  3158,  -712,   425,  -712,
+    -712,   425,  -712,   425,  -712,   425,   333,   333,  -712,  -712,
+    -712,   474,   476,  -712,    10,  3158,  -712,  3158,  3158,  -712,
+    3158,   427,  3158,    10,   426,  3158,  -712,  3158,  3158,  3158,
+    3158,  3158,  3158,   428,   430,   204,  -712,   377,   887,   433,
+     228,   519,  -712,  3158,   521,  -712,  3158,  3158,   333,  -712,
+     235,  3158,   333,  3158,   333,   333,  -712,  -712,  -712,  -712,
+    1213,  3158,  -712,  -712,  -712,  -712,  -712,  3158,  -712,  -712,
+    3158,  -712,   488,  -712,  -712,   490,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+     496,  -712,  -712,   497,  -712,  1105,  -712,  -712,  -712,   491,
+    -712,  -712,   439,   443,   444,   445,   448,  3158,   449,   450,
+    -712,   440,   451,   452,   454,   455,   456,   277,   996,  1754,
+    -712,  -712,   996,  -712,  -712,  -712,  -712,  -712,  -712,  3158,
+     277,  3158,   277,   277,  -712,   333,   333,  -712,   367,   367,
+     367,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  3158,    10,
+    3158,  3158,   457,  3158,    10,  -712,  -712,   517,   517,  3158,
+     517,  -712,  -712,  -712,  -712,   277,  -712,   277,  -712,  -712,
+     458,   460,   462,   459,  3158,   464,   472,   473,   475,   466,
+     477,  -712,  -712,  -712,  -712,  -712,    10,   478,  -712,    10,
+      10,    10,  -712,    10,   481,  3158,   467,   482,   483,   484,
+      10,   500,  -712,    10,    10,    10,   501,  3158,   502,   505,
+     507,  -712,   508,    10,    10,    10,  3158,   509,   511,   510,
+     512,    10,    10,  -712,  -712,   513,   515,    10,    10,   514,
+     516,  -712,  -712
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+      52,     0,     0,     0,     0,     0,     0,   126,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    95,     0,     0,     0,
+       0,    92,    93,    94,   334,   335,   331,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   102,     0,
+     103,     0,     0,     0,     0,   332,   333,     0,     2,     4,
+       6,    32,     8,     7,    34,    33,    29,    28,    30,    31,
+      21,    22,     5,     9,    10,    11,    12,    13,    35,    36,
+      16,    37,    40,    41,    42,    17,    18,    19,    14,    20,
+      23,    24,    25,    26,    27,    15,    38,    39,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,     0,     0,     0,
+       0,     0,     0,     0,     0,   117,   305,   305,   115,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   126,   174,   224,   234,   254,
+     360,   358,     0,   111,   126,   125,   121,   126,   126,   126,
+     104,   263,     0,     0,   227,     0,     0,     0,     0,     0,
+       0,   278,     0,     0,     0,     0,   308,     0,     0,     0,
+       0,     0,   131,     0,     0,     0,     0,   127,   128,     0,
+       0,     0,     0,     0,     0,   186,   379,   389,   390,   381,
+     432,   376,   387,   428,   391,   425,   435,   438,   424,   430,
+     423,   433,   449,   392,   436,   439,   385,   442,   451,   380,
+     452,   395,   447,   454,   437,   382,   386,   434,   396,   450,
+     429,   446,   427,   394,   448,   397,   443,   398,   431,   426,
+     393,   441,   388,   377,   440,   378,   445,   453,   416,   417,
+     414,   415,   403,   399,   408,   412,   407,   410,   406,   411,
+     409,   418,   422,   457,   419,   456,   455,   384,   458,   421,
+     420,   383,   413,   400,   402,   444,   401,   404,   405,     0,
+     187,   347,    62,     0,     0,    60,    63,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   191,     0,
+       0,   192,   342,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     1,    52,   428,   155,   189,   188,
+       0,   313,   314,   315,     0,   428,   155,   316,   317,   318,
+       0,   428,   155,   428,   155,   362,     0,   301,     0,   302,
+     428,   170,   173,   237,     0,   428,   249,     0,   428,   354,
+     428,   356,   363,    71,    67,    68,    70,   155,     0,   155,
+       0,   155,   155,   147,     0,   146,   148,   253,     0,   176,
+     179,   323,   121,   325,     0,     0,   235,   181,   258,   259,
+       0,   256,   361,   359,    74,     0,   113,   122,   123,   124,
+     105,   118,   119,   120,   106,   110,   109,   108,   107,   264,
+     231,     0,   229,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   268,   270,   269,     0,     0,     0,   277,   305,
+     305,     0,     0,     0,   308,     0,   292,   308,   308,     0,
+       0,     0,   308,   201,   202,   449,   392,   300,   449,   392,
+     300,   213,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    82,     0,     0,     0,     0,     0,   135,   346,
+     134,     0,     0,     0,     0,     0,     0,   366,     0,     0,
+       0,     0,   319,   320,   321,   322,   371,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   194,   193,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       3,     0,     0,   152,   154,     0,   428,   155,     0,   240,
+     428,   155,     0,   348,     0,   350,   195,   190,   465,   462,
+     460,   463,   459,   467,   468,   464,   461,   466,   469,   303,
+     304,   196,   197,   116,     0,     0,     0,   233,   428,   247,
+       0,   428,   251,     0,     0,     0,   198,   155,   245,   155,
+     352,   353,     0,    53,    75,   185,     0,   183,   184,     0,
+     118,   119,   120,   330,   330,     0,   260,   261,   262,     0,
+      72,     0,   228,   230,   216,   156,     0,   222,   220,     0,
+     265,   266,   267,   272,   271,   275,   273,   276,   274,   199,
+     200,   308,   308,   308,   282,   309,   306,   311,   307,   312,
+     310,   284,   283,   308,   308,   308,   308,   308,   308,   291,
+     300,   300,   299,   298,   300,   300,   295,   205,     0,   211,
+     209,     0,   149,   141,   140,   142,     0,   129,   136,   138,
+     143,   144,   139,   145,   151,   130,   132,    84,    85,     0,
+      83,    78,    80,    81,    87,   370,     0,    66,    55,    64,
+      56,    54,    61,    58,    59,    57,   364,   365,   368,   369,
+     367,   372,   374,    96,     0,     0,    99,     0,     0,   338,
+       0,     0,     0,     0,     0,     0,   101,     0,     0,     0,
+       0,     0,     0,   195,   163,     0,   158,     0,   162,   196,
+       0,     0,   238,     0,     0,   242,     0,     0,   171,   172,
+       0,     0,   250,     0,   355,   357,    69,   244,   246,    77,
+       0,   175,   178,   329,   225,   226,   180,   255,    73,    76,
+     112,   217,   214,   223,   221,   218,   279,   280,   281,   286,
+     285,   288,   287,   290,   289,   296,   297,   293,   294,   206,
+     203,   212,   210,   207,   150,     0,    86,    79,   133,     0,
+     373,   375,     0,     0,     0,     0,     0,     0,     0,     0,
+     345,     0,     0,     0,     0,     0,     0,   155,     0,     0,
+     157,   168,     0,   160,   165,   166,   167,   169,   232,     0,
+     155,     0,   155,   155,   236,   248,   252,   182,   177,   257,
+     114,   215,   219,   204,   208,   137,    65,    97,     0,     0,
+       0,     0,     0,     0,     0,   341,   344,     0,     0,     0,
+       0,   153,   164,   159,   161,   155,   241,   155,   349,   351,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   239,   243,    98,   336,   337,     0,     0,   340,     0,
+       0,     0,    91,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   100,     0,     0,     0,     0,     0,     0,     0,
+       0,   339,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    90,   343,     0,     0,     0,     0,     0,
+       0,    88,    89
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -712,  -712,  -712,   236,  -712,  -712,   543,   107,  -176,  -174,
+    -712,  -712,    32,  -712,  -712,  -712,  -712,  -712,    13,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,   -44,   250,   503,    37,
+    -712,  -712,  -712,  -712,   317,  -712,   143,  -153,  -712,  -712,
+     504,  -108,  -712,  -712,  -291,  -396,  -389,  -712,  -172,  -711,
+    -712,   -85,  -712,  -138,   -55,  -159,  -112,   -17,  -111,  -324,
+    -293,    17,   263,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -436,  -712,  -109,  -400,   -69,   -87,   316,
+    -712,    40,  -712,  -712,  -712,  -712,  -712,  -712,  -712,  -712,
+    -712,  -712,  -712,  -712,    -6,  -666
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    57,    58,    59,    60,    61,   274,   275,   648,   649,
+      62,   354,   355,   356,    63,   570,   553,   718,   554,    64,
+      65,    66,    67,    68,    69,    70,   117,   118,   149,   150,
+      71,   177,   178,   179,   684,   459,   627,   628,   629,   630,
+     364,   631,   632,    72,   503,   574,   504,   685,   686,   773,
+      73,   341,    74,   369,   376,   556,   557,   342,   320,   633,
+     301,   634,   688,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,   537,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,   613,    94,   337,   426,   324,   330,   287,
+     375,   714,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   270,   532
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     269,   381,   382,   383,   616,   386,   487,   488,   339,   343,
+     577,   578,   529,   276,   276,   575,   447,   575,   575,   298,
+     336,   462,   777,   425,   594,   142,   365,   601,   602,   465,
+     115,   170,   609,   151,   365,   509,   347,   346,   171,   349,
+     351,   513,   115,   515,   360,   115,   617,   406,   619,   620,
+     172,   639,   344,   575,   115,   575,   575,   812,   302,   303,
+     358,   814,   306,   116,   444,   647,   546,   173,   548,   403,
+     550,   551,   408,   640,   463,   145,   271,   647,   419,   174,
+     565,   448,   449,   463,   401,   175,   176,   433,   405,   446,
+     317,   319,   338,   326,   398,   332,   334,   335,   650,   184,
+     402,   282,   777,   319,   395,   443,   777,   414,   283,   352,
+     654,   357,   428,   359,   315,   361,   362,   450,   451,   370,
+     420,   377,   370,   370,   370,   434,   370,   299,   366,   300,
+     472,   473,   377,   285,   290,   288,   366,   157,   377,   135,
+     286,   319,   289,   158,   159,   377,   136,   284,   137,   138,
+     377,   291,   479,   437,   440,   314,   119,   139,   319,   120,
+     279,   559,   121,   663,   452,   292,   280,   281,   122,   123,
+     180,   710,   367,   711,   735,   736,   181,   182,   737,   738,
+     722,   390,   353,   725,   394,   396,   397,   575,   140,   141,
+     575,   726,   727,   728,   468,   467,   470,   293,   124,   125,
+     126,   294,   478,   729,   730,   731,   732,   733,   734,   744,
+     466,   128,   183,   469,   298,   295,   692,   129,   336,   477,
+     695,   569,   740,   130,   131,   743,   571,   296,   709,   575,
+     127,   143,   575,   144,   710,   371,   717,   145,   297,   146,
+     147,   372,   373,   387,   388,   389,   145,   148,   391,   392,
+     393,   145,   460,   132,   133,   304,   707,   160,   708,   539,
+     305,   161,   542,   162,   163,   321,   322,   323,   404,   307,
+     476,   164,   308,   370,   480,   481,   482,   483,   484,   485,
+     486,   327,   328,   329,   407,   134,   651,   490,   653,   655,
+     493,   474,   475,   496,   497,   309,   499,   579,   409,   410,
+     411,   412,   107,   310,   710,   108,   720,   507,   109,   311,
+     589,   590,   312,   511,   110,   111,   769,   165,   770,   313,
+     145,   166,   491,   167,   168,   494,   495,   152,   399,   498,
+     531,   169,   153,   487,   400,   621,   154,   425,   155,   156,
+     565,   547,   778,   549,   112,   113,   114,   565,   573,   784,
+     456,   558,   415,   416,   417,   418,   457,   563,   441,   461,
+     584,   586,   588,   558,   775,   321,   322,   323,   558,   421,
+     422,   423,   424,   464,   604,   606,   608,   429,   430,   431,
+     432,   656,   298,   657,   572,   489,   377,   492,   576,   501,
+     502,   319,   580,   581,   582,   327,   328,   329,   377,   377,
+     377,   453,   454,   455,   591,   592,   593,   321,   322,   323,
+     442,   505,   377,   377,   377,   387,   388,   389,   610,   611,
+     115,   614,   615,   560,   561,   562,   618,   508,   512,   319,
+     566,   567,   568,   637,   638,   514,   641,   642,   643,   644,
+     645,   366,   366,   534,   775,   535,   540,   536,   775,   698,
+     690,   543,   658,   659,   660,   702,   544,   276,   704,   705,
+     661,   662,   595,   596,   597,   598,   599,   600,   327,   328,
+     329,   445,   671,   545,  -324,   674,   811,   552,   564,   559,
+     612,   700,   565,   827,   828,   687,   830,   338,   377,   816,
+     636,   818,   819,   646,   647,   664,   689,   665,   666,   667,
+     668,   682,   693,   669,   670,   672,   673,   675,   691,   694,
+     676,   677,   678,   679,   680,   681,   696,   697,   699,   377,
+     701,   703,   517,   721,   831,  -326,   832,   723,  -327,  -328,
+     724,   739,   741,   742,   745,   747,   750,   749,   751,   757,
+     760,   779,   712,   781,  -186,   768,   713,   713,   716,  -187,
+     791,   500,   792,   797,   805,   798,   799,   800,   793,   794,
+     801,   803,   804,   278,   807,   806,   808,   809,   810,   824,
+     652,   836,   833,   788,   834,   796,   835,   706,   838,   789,
+     842,   852,   790,   719,   839,   840,   458,   841,   533,   843,
+     845,   635,   795,   850,   853,   854,   855,   813,   787,   530,
+     471,     0,     0,     0,   715,     0,     0,     0,     0,     0,
+       0,     0,   857,     0,   863,   861,   785,   864,   786,   865,
+     866,   871,   746,   872,   873,   877,   874,   878,   881,   748,
+     882,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     374,     0,     0,     0,     0,     0,   384,     0,   753,     0,
+     754,   755,     0,   756,     0,   758,     0,     0,   761,     0,
+     762,   763,   764,   765,   766,   767,     0,     0,     0,     0,
+       0,   774,     0,     0,     0,     0,   780,     0,     0,   782,
+     783,   752,     0,     0,     0,     0,     0,     0,     0,     0,
+     759,     0,     0,   558,   370,     0,     0,     0,     0,     0,
+     370,     0,     0,   370,     0,   776,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   366,
+     802,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   774,   687,     0,     0,   774,     0,     0,     0,     0,
+       0,     0,   815,   689,   817,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   820,     0,   822,   823,   776,   825,     0,     0,   776,
+       0,     0,   829,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   837,     0,     0,
+       0,     0,     0,     0,     0,     0,   821,     0,     0,     0,
+       0,   826,     0,     0,     0,     0,     0,     0,   851,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     862,     0,     0,     0,     0,     0,     0,     0,     0,   870,
+       0,     0,     0,   844,     0,     0,   846,   847,   848,     0,
+     849,     0,     0,     0,     0,     0,     0,   856,     0,     0,
+     858,   859,   860,     0,     0,     0,     0,     0,     0,     0,
+     867,   868,   869,     0,     0,     0,     0,     0,   875,   876,
+     185,   771,   517,     0,   879,   880,   298,     0,     0,     0,
+     186,   187,   188,   189,   190,   518,   191,   192,   193,   194,
+     519,   520,   521,   195,   196,   197,   198,     0,   199,   200,
+     201,   202,   203,   522,   204,   523,   524,   205,   206,   207,
+       0,     0,   208,   209,   210,   211,   212,   213,   525,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   526,
+     224,   225,   527,   226,   227,   228,   229,   230,   231,   232,
+     528,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,     0,   250,
+     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   268,     0,   185,
+     771,   517,   772,     0,   299,   298,   300,     0,     0,   186,
+     187,   188,   189,   190,   518,   191,   192,   193,   194,   519,
+     520,   521,   195,   196,   197,   198,     0,   199,   200,   201,
+     202,   203,   522,   204,   523,   524,   205,   206,   207,     0,
+       0,   208,   209,   210,   211,   212,   213,   525,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,   526,   224,
+     225,   527,   226,   227,   228,   229,   230,   231,   232,   528,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,     0,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,     0,   363,   622,
+     517,     0,     0,   299,   298,   300,     0,     0,   186,   187,
+     188,   189,   190,     0,   191,   192,   193,   194,     0,   623,
+     624,   195,   196,   197,   198,     0,   199,   200,   201,   202,
+     203,     0,   204,     0,     0,   205,   206,   207,     0,     0,
+     208,   209,   210,   211,   212,   213,   625,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,     0,   224,   225,
+       0,   226,   227,   228,   229,   230,   231,   232,     0,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,   248,   249,     0,   250,   251,   252,
+     253,   254,   255,   256,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,   267,   268,   185,     0,     0,     0,
+       0,     0,   626,     0,   300,     0,   186,   187,   188,   189,
+     190,     0,   191,   192,   193,   194,     0,     0,     0,   195,
+     196,   197,   198,     0,   199,   200,   201,   202,   203,     0,
+     204,     0,     0,   205,   206,   207,     0,     0,   208,   209,
+     210,   211,   212,   213,     0,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,   223,     0,   224,   225,     0,   226,
+     227,   228,   229,   230,   231,   232,     0,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
+     246,   247,   248,   249,     0,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   185,     0,     0,     0,     0,     0,
+       0,   555,     0,     0,   186,   187,   188,   189,   190,     0,
+     191,   192,   193,   194,     0,     0,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,   202,   203,     0,   204,   378,
+     379,   205,   206,   207,     0,     0,   208,   209,   210,   211,
+     212,   213,     0,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,   223,     0,   224,   225,     0,   226,   227,   228,
+     229,   230,   231,   232,     0,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,   249,     0,   250,   251,   252,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,   185,     0,   380,     0,     0,     0,     0,     0,
+       0,     0,   186,   187,   188,   189,   190,     0,   191,   192,
+     193,   194,     0,     0,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,   202,   203,     0,   204,     0,     0,   205,
+     206,   207,     0,     0,   208,   209,   210,   211,   212,   213,
+       0,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     223,     0,   224,   225,     0,   226,   227,   228,   229,   230,
+     231,   232,     0,   233,   234,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+       0,   250,   251,   252,   253,   254,   255,   256,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
+     185,     0,   368,     0,     0,     0,     0,     0,     0,     0,
+     186,   187,   188,   189,   190,     0,   191,   192,   193,   194,
+       0,     0,     0,   195,   196,   197,   198,     0,   199,   200,
+     201,   202,   203,     0,   204,     0,     0,   205,   206,   207,
+       0,     0,   208,   209,   210,   211,   212,   213,     0,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,     0,
+     224,   225,     0,   226,   227,   228,   229,   230,   231,   232,
+       0,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,     0,   250,
+     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   268,     0,   516,
+     385,   517,     0,     0,     0,     0,     0,     0,     0,   186,
+     187,   188,   189,   190,   518,   191,   192,   193,   194,   519,
+     520,   521,   195,   196,   197,   198,     0,   199,   200,   201,
+     202,   203,   522,   204,   523,   524,   205,   206,   207,     0,
+       0,   208,   209,   210,   211,   212,   213,   525,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,   526,   224,
+     225,   527,   226,   227,   228,   229,   230,   231,   232,   528,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,     0,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   683,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   186,   187,   188,
+     189,   190,   518,   191,   192,   193,   194,   519,   520,   521,
+     195,   196,   197,   198,     0,   199,   200,   201,   202,   203,
+     522,   204,   523,   524,   205,   206,   207,     0,     0,   208,
+     209,   210,   211,   212,   213,   525,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,   526,   224,   225,   527,
+     226,   227,   228,   229,   230,   231,   232,   528,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,     0,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   272,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   186,   187,   188,   189,   190,
+       0,   191,   192,   193,   194,     0,     0,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   202,   203,   273,   204,
+       0,     0,   205,   206,   207,     0,     0,   208,   209,   210,
+     211,   212,   213,     0,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,     0,   224,   225,     0,   226,   227,
+     228,   229,   230,   231,   232,     0,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,     0,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   272,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   186,   187,   188,   189,   190,     0,   191,
+     192,   193,   194,     0,     0,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   202,   203,   277,   204,     0,     0,
+     205,   206,   207,     0,     0,   208,   209,   210,   211,   212,
+     213,     0,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,     0,   224,   225,     0,   226,   227,   228,   229,
+     230,   231,   232,     0,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,     0,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   185,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   186,   187,   188,   189,   190,     0,   191,   192,   193,
+     194,     0,     0,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,   202,   203,   318,   204,     0,     0,   205,   206,
+     207,     0,     0,   208,   209,   210,   211,   212,   213,     0,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+       0,   224,   225,     0,   226,   227,   228,   229,   230,   231,
+     232,     0,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,     0,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   185,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   186,
+     187,   188,   189,   190,     0,   191,   192,   193,   194,     0,
+       0,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+     202,   203,   145,   204,     0,     0,   205,   206,   207,     0,
+       0,   208,   209,   210,   211,   212,   213,     0,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,     0,   224,
+     225,     0,   226,   227,   228,   229,   230,   231,   232,     0,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,     0,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   185,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   186,   187,   188,
+     189,   190,     0,   191,   192,   193,   194,     0,     0,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,   202,   203,
+     413,   204,     0,     0,   205,   206,   207,     0,     0,   208,
+     209,   210,   211,   212,   213,     0,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,     0,   224,   225,     0,
+     226,   227,   228,   229,   230,   231,   232,     0,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,     0,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   185,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   186,   187,   188,   189,   190,
+       0,   191,   192,   193,   194,     0,     0,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   202,   203,   427,   204,
+       0,     0,   205,   206,   207,     0,     0,   208,   209,   210,
+     211,   212,   213,     0,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,     0,   224,   225,     0,   226,   227,
+     228,   229,   230,   231,   232,     0,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,     0,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   185,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   186,   187,   188,   189,   190,     0,   191,
+     192,   193,   194,     0,     0,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   202,   203,   583,   204,     0,     0,
+     205,   206,   207,     0,     0,   208,   209,   210,   211,   212,
+     213,     0,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,     0,   224,   225,     0,   226,   227,   228,   229,
+     230,   231,   232,     0,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,     0,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   185,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   186,   187,   188,   189,   190,     0,   191,   192,   193,
+     194,     0,     0,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,   202,   203,   585,   204,     0,     0,   205,   206,
+     207,     0,     0,   208,   209,   210,   211,   212,   213,     0,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+       0,   224,   225,     0,   226,   227,   228,   229,   230,   231,
+     232,     0,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,     0,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   185,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   186,
+     187,   188,   189,   190,     0,   191,   192,   193,   194,     0,
+       0,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+     202,   203,   587,   204,     0,     0,   205,   206,   207,     0,
+       0,   208,   209,   210,   211,   212,   213,     0,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,     0,   224,
+     225,     0,   226,   227,   228,   229,   230,   231,   232,     0,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,     0,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   185,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   186,   187,   188,
+     189,   190,     0,   191,   192,   193,   194,     0,     0,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,   202,   203,
+     603,   204,     0,     0,   205,   206,   207,     0,     0,   208,
+     209,   210,   211,   212,   213,     0,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,     0,   224,   225,     0,
+     226,   227,   228,   229,   230,   231,   232,     0,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,     0,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   185,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   186,   187,   188,   189,   190,
+       0,   191,   192,   193,   194,     0,     0,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   202,   203,   605,   204,
+       0,     0,   205,   206,   207,     0,     0,   208,   209,   210,
+     211,   212,   213,     0,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,     0,   224,   225,     0,   226,   227,
+     228,   229,   230,   231,   232,     0,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,     0,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   185,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   186,   187,   188,   189,   190,     0,   191,
+     192,   193,   194,     0,     0,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   202,   203,   607,   204,     0,     0,
+     205,   206,   207,     0,     0,   208,   209,   210,   211,   212,
+     213,     0,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,     0,   224,   225,     0,   226,   227,   228,   229,
+     230,   231,   232,     0,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,     0,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   185,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   186,   187,   188,   189,   190,     0,   191,   192,   193,
+     194,     0,     0,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,   202,   203,     0,   204,     0,     0,   205,   206,
+     207,     0,     0,   208,   209,   210,   211,   212,   213,     0,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+       0,   224,   225,     0,   226,   227,   228,   229,   230,   231,
+     232,     0,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,     0,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   185,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   186,
+     187,   188,   189,   190,     0,   191,   192,   316,   194,     0,
+       0,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+     202,   203,     0,   204,     0,     0,   205,   206,   207,     0,
+       0,   208,   209,   210,   211,   212,   213,     0,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,     0,   224,
+     225,     0,   226,   227,   228,   229,   230,   231,   232,     0,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,     0,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   185,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   186,   187,   188,
+     189,   190,     0,   191,   192,   325,   194,     0,     0,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,   202,   203,
+       0,   204,     0,     0,   205,   206,   207,     0,     0,   208,
+     209,   210,   211,   212,   213,     0,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,     0,   224,   225,     0,
+     226,   227,   228,   229,   230,   231,   232,     0,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,     0,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   185,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   186,   187,   188,   189,   190,
+       0,   191,   192,   331,   194,     0,     0,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   202,   203,     0,   204,
+       0,     0,   205,   206,   207,     0,     0,   208,   209,   210,
+     211,   212,   213,     0,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,     0,   224,   225,     0,   226,   227,
+     228,   229,   230,   231,   232,     0,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,     0,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   185,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   186,   187,   188,   189,   190,     0,   191,
+     192,   333,   194,     0,     0,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   202,   203,     0,   204,     0,     0,
+     205,   206,   207,     0,     0,   208,   209,   210,   211,   212,
+     213,     0,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,     0,   224,   225,     0,   226,   227,   228,   229,
+     230,   231,   232,     0,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,     0,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   185,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   186,   187,   188,   189,   190,     0,   191,   192,   340,
+     194,     0,     0,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,   202,   203,     0,   204,     0,     0,   205,   206,
+     207,     0,     0,   208,   209,   210,   211,   212,   213,     0,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+       0,   224,   225,     0,   226,   227,   228,   229,   230,   231,
+     232,     0,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,     0,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   185,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   186,
+     187,   188,   189,   190,     0,   191,   192,   345,   194,     0,
+       0,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+     202,   203,     0,   204,     0,     0,   205,   206,   207,     0,
+       0,   208,   209,   210,   211,   212,   213,     0,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,     0,   224,
+     225,     0,   226,   227,   228,   229,   230,   231,   232,     0,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,     0,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   185,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   186,   187,   188,
+     189,   190,     0,   191,   192,   348,   194,     0,     0,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,   202,   203,
+       0,   204,     0,     0,   205,   206,   207,     0,     0,   208,
+     209,   210,   211,   212,   213,     0,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,     0,   224,   225,     0,
+     226,   227,   228,   229,   230,   231,   232,     0,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,     0,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   185,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   186,   187,   188,   189,   190,
+       0,   191,   192,   350,   194,     0,     0,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   202,   203,     0,   204,
+       0,     0,   205,   206,   207,     0,     0,   208,   209,   210,
+     211,   212,   213,     0,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,     0,   224,   225,     0,   226,   227,
+     228,   229,   230,   231,   232,     0,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,     0,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   363,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   186,   187,   188,   189,   190,     0,   191,
+     192,   193,   194,     0,     0,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   202,   203,     0,   204,     0,     0,
+     205,   206,   207,     0,     0,   208,   209,   210,   211,   212,
+     213,     0,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,     0,   224,   225,     0,   226,   227,   228,   229,
+     230,   231,   232,     0,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,     0,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   185,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   186,   187,   188,   189,   190,     0,   191,   192,   193,
+     194,     0,     0,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,   435,   436,     0,   204,     0,     0,   205,   206,
+     207,     0,     0,   208,   209,   210,   211,   212,   213,     0,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+       0,   224,   225,     0,   226,   227,   228,   229,   230,   231,
+     232,     0,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,     0,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   185,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   186,
+     187,   188,   189,   190,     0,   191,   192,   193,   194,     0,
+       0,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+     438,   439,     0,   204,     0,     0,   205,   206,   207,     0,
+       0,   208,   209,   210,   211,   212,   213,     0,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,     0,   224,
+     225,     0,   226,   227,   228,   229,   230,   231,   232,     0,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,     0,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   185,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   186,   187,   188,
+     189,   190,     0,   191,   192,   506,   194,     0,     0,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,   202,   203,
+       0,   204,     0,     0,   205,   206,   207,     0,     0,   208,
+     209,   210,   211,   212,   213,     0,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,     0,   224,   225,     0,
+     226,   227,   228,   229,   230,   231,   232,     0,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,     0,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   185,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   186,   187,   188,   189,   190,
+       0,   191,   192,   510,   194,     0,     0,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   202,   203,     0,   204,
+       0,     0,   205,   206,   207,     0,     0,   208,   209,   210,
+     211,   212,   213,     0,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,     0,   224,   225,     0,   226,   227,
+     228,   229,   230,   231,   232,     0,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,     0,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,   267,   268,   185,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   186,   187,   188,   189,   190,     0,   191,
+     192,   538,   194,     0,     0,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   202,   203,     0,   204,     0,     0,
+     205,   206,   207,     0,     0,   208,   209,   210,   211,   212,
+     213,     0,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,     0,   224,   225,     0,   226,   227,   228,   229,
+     230,   231,   232,     0,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,     0,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   185,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   186,   187,   188,   189,   190,     0,   191,   192,   541,
+     194,     0,     0,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,   202,   203,     0,   204,     0,     0,   205,   206,
+     207,     0,     0,   208,   209,   210,   211,   212,   213,     0,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+       0,   224,   225,     0,   226,   227,   228,   229,   230,   231,
+     232,     0,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,     0,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   272,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   186,
+     187,   188,   189,   190,     0,   191,   192,   193,   194,     0,
+       0,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+     202,   203,     0,   204,     0,     0,   205,   206,   207,     0,
+       0,   208,   209,   210,   211,   212,   213,     0,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,     0,   224,
+     225,     0,   226,   227,   228,   229,   230,   231,   232,     0,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,     0,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,     1,     2,     3,
+       4,     5,     6,     0,     0,     0,     0,     0,     0,     0,
+       0,     7,     0,     0,     0,     8,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     9,    10,     0,     0,    11,
+       0,    12,    13,    14,     0,     0,     0,    15,    16,     0,
+       0,     0,     0,     0,     0,     0,     0,    17,    18,    19,
+      20,     0,     0,     0,     0,    21,     0,     0,     0,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,     0,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56
+};
+
+static const yytype_int16 yycheck[] =
+{
+      17,   139,   140,   141,   440,   143,   299,   300,   117,   120,
+     406,   407,   336,    19,    20,   404,    50,   406,   407,     9,
+      40,    50,   688,    55,   424,   100,   134,   427,   428,    67,
+       3,    32,   432,    36,   142,   326,   123,   122,    39,   124,
+     125,   332,     3,   334,   131,     3,   442,   158,   444,   445,
+       3,    50,   121,   442,     3,   444,   445,   768,    41,    42,
+     129,   772,    45,    36,   175,     3,   357,    20,   359,   156,
+     361,   362,   159,    72,   112,    36,    26,     3,    36,    32,
+     112,   115,   116,   112,   153,    38,    39,    36,   157,   176,
+     107,   108,   112,   110,   149,   112,   113,   114,    36,    39,
+     155,    32,   768,   120,   148,   174,   772,   162,    39,   126,
+      36,   128,   167,   130,   111,   132,   133,    34,    35,   136,
+     164,   138,   139,   140,   141,   169,   143,   117,   134,   119,
+      34,    35,   149,    32,   113,    32,   142,    32,   155,    19,
+      39,   158,    39,    38,    39,   162,    26,    75,    28,    29,
+     167,   113,   290,   170,   171,     0,    26,    37,   175,    29,
+      32,   112,    32,   114,   181,   113,    38,    39,    38,    39,
+      32,   112,   135,   114,   610,   611,    38,    39,   614,   615,
+     576,   144,     3,   579,   147,   148,   149,   576,    68,    69,
+     579,   591,   592,   593,   281,   280,   283,   113,    68,    69,
+      70,   113,   289,   603,   604,   605,   606,   607,   608,     4,
+     279,    26,    74,   282,     9,   113,   507,    32,    40,   288,
+     511,   380,   618,    38,    39,   621,   385,   113,   552,   618,
+     100,    30,   621,    32,   112,    32,   114,    36,   113,    38,
+      39,    38,    39,    33,    34,    35,    36,    46,    33,    34,
+      35,    36,   269,    68,    69,   113,   547,    32,   549,   344,
+     113,    36,   347,    38,    39,    33,    34,    35,    36,   113,
+     287,    46,   113,   290,   291,   292,   293,   294,   295,   296,
+     297,    33,    34,    35,    36,   100,   462,   304,   464,   465,
+     307,    34,    35,   310,   311,   113,   313,   408,    33,    34,
+      35,    36,    26,   113,   112,    29,   114,   324,    32,   113,
+     419,   420,   113,   330,    38,    39,   112,    32,   114,   113,
+      36,    36,   305,    38,    39,   308,   309,    27,    72,   312,
+     336,    46,    32,   626,     9,   446,    36,    55,    38,    39,
+     112,   358,   114,   360,    68,    69,    70,   112,   403,   114,
+      38,   368,    33,    34,    35,    36,    33,   374,    31,    50,
+     415,   416,   417,   380,   688,    33,    34,    35,   385,    33,
+      34,    35,    36,    67,   429,   430,   431,    33,    34,    35,
+      36,   466,     9,   468,   401,   113,   403,   113,   405,    23,
+     113,   408,   409,   410,   411,    33,    34,    35,   415,   416,
+     417,    33,    34,    35,   421,   422,   423,    33,    34,    35,
+      36,   113,   429,   430,   431,    33,    34,    35,   435,   436,
+       3,   438,   439,    33,    34,    35,   443,    23,    23,   446,
+      33,    34,    35,   450,   451,    23,   453,   454,   455,   456,
+     457,   447,   448,    22,   768,   112,    22,   113,   772,   534,
+     505,    22,   469,   470,   471,   540,    22,   463,   543,   544,
+     477,   478,    56,    57,    58,    59,    60,    61,    33,    34,
+      35,    36,   489,   112,    36,   492,   767,    40,    36,   112,
+      62,   536,   112,   807,   808,   502,   810,   112,   505,   780,
+       3,   782,   783,   116,     3,   112,   502,   112,   114,   112,
+     112,    22,    22,   114,   112,   112,   112,   112,    23,    23,
+     114,   112,   112,   112,   112,   112,    22,    22,   535,   536,
+      22,    22,     5,    62,   815,    36,   817,    62,    36,    36,
+      62,    62,    62,    62,   112,    72,    62,   112,    62,   112,
+     114,    22,   559,    22,   116,   115,   563,   564,   565,   116,
+      62,   315,    62,   114,   114,   112,   112,   112,    62,    62,
+     112,   112,   112,    20,   112,   114,   112,   112,   112,   112,
+     463,   112,   114,   711,   114,   749,   114,   545,   114,   717,
+     114,   114,   720,   570,   112,   112,   269,   112,   338,   112,
+     112,   448,   745,   112,   112,   112,   112,   769,   710,   336,
+     284,    -1,    -1,    -1,   564,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   112,    -1,   112,   114,   701,   112,   703,   112,
+     112,   112,   639,   112,   114,   112,   114,   112,   114,   646,
+     114,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     137,    -1,    -1,    -1,    -1,    -1,   142,    -1,   665,    -1,
+     667,   668,    -1,   670,    -1,   672,    -1,    -1,   675,    -1,
+     677,   678,   679,   680,   681,   682,    -1,    -1,    -1,    -1,
+      -1,   688,    -1,    -1,    -1,    -1,   693,    -1,    -1,   696,
+     697,   664,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     673,    -1,    -1,   710,   711,    -1,    -1,    -1,    -1,    -1,
+     717,    -1,    -1,   720,    -1,   688,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   745,
+     757,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   768,   769,    -1,    -1,   772,    -1,    -1,    -1,    -1,
+      -1,    -1,   779,   769,   781,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   798,    -1,   800,   801,   768,   803,    -1,    -1,   772,
+      -1,    -1,   809,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   824,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   799,    -1,    -1,    -1,
+      -1,   804,    -1,    -1,    -1,    -1,    -1,    -1,   845,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     857,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   866,
+      -1,    -1,    -1,   836,    -1,    -1,   839,   840,   841,    -1,
+     843,    -1,    -1,    -1,    -1,    -1,    -1,   850,    -1,    -1,
+     853,   854,   855,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     863,   864,   865,    -1,    -1,    -1,    -1,    -1,   871,   872,
+       3,     4,     5,    -1,   877,   878,     9,    -1,    -1,    -1,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      -1,    -1,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    -1,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,    -1,     3,
+       4,     5,   115,    -1,   117,     9,   119,    -1,    -1,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,    -1,     3,     4,
+       5,    -1,    -1,   117,     9,   119,    -1,    -1,    13,    14,
+      15,    16,    17,    -1,    19,    20,    21,    22,    -1,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    -1,    37,    -1,    -1,    40,    41,    42,    -1,    -1,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    -1,    63,    64,
+      -1,    66,    67,    68,    69,    70,    71,    72,    -1,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    -1,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,     3,    -1,    -1,    -1,
+      -1,    -1,   117,    -1,   119,    -1,    13,    14,    15,    16,
+      17,    -1,    19,    20,    21,    22,    -1,    -1,    -1,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    -1,
+      37,    -1,    -1,    40,    41,    42,    -1,    -1,    45,    46,
+      47,    48,    49,    50,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    -1,    63,    64,    -1,    66,
+      67,    68,    69,    70,    71,    72,    -1,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    -1,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,   109,   110,     3,    -1,    -1,    -1,    -1,    -1,
+      -1,   118,    -1,    -1,    13,    14,    15,    16,    17,    -1,
+      19,    20,    21,    22,    -1,    -1,    -1,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    -1,    37,    38,
+      39,    40,    41,    42,    -1,    -1,    45,    46,    47,    48,
+      49,    50,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    -1,    63,    64,    -1,    66,    67,    68,
+      69,    70,    71,    72,    -1,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    -1,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,     3,    -1,   113,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    13,    14,    15,    16,    17,    -1,    19,    20,
+      21,    22,    -1,    -1,    -1,    26,    27,    28,    29,    -1,
+      31,    32,    33,    34,    35,    -1,    37,    -1,    -1,    40,
+      41,    42,    -1,    -1,    45,    46,    47,    48,    49,    50,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    -1,    63,    64,    -1,    66,    67,    68,    69,    70,
+      71,    72,    -1,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      -1,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+       3,    -1,   113,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      13,    14,    15,    16,    17,    -1,    19,    20,    21,    22,
+      -1,    -1,    -1,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    -1,    37,    -1,    -1,    40,    41,    42,
+      -1,    -1,    45,    46,    47,    48,    49,    50,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    -1,
+      63,    64,    -1,    66,    67,    68,    69,    70,    71,    72,
+      -1,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    -1,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,    -1,     3,
+     113,     5,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,     3,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    -1,    -1,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    -1,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    13,    14,    15,    16,    17,
+      -1,    19,    20,    21,    22,    -1,    -1,    -1,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      -1,    -1,    40,    41,    42,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    -1,    63,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    -1,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    -1,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    13,    14,    15,    16,    17,    -1,    19,
+      20,    21,    22,    -1,    -1,    -1,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    -1,    -1,
+      40,    41,    42,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    -1,    63,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    -1,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    -1,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    13,    14,    15,    16,    17,    -1,    19,    20,    21,
+      22,    -1,    -1,    -1,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    -1,    -1,    40,    41,
+      42,    -1,    -1,    45,    46,    47,    48,    49,    50,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      -1,    63,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    -1,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    -1,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,     3,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    -1,    19,    20,    21,    22,    -1,
+      -1,    -1,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    -1,    -1,    40,    41,    42,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    -1,    63,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    -1,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,     3,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,    14,    15,
+      16,    17,    -1,    19,    20,    21,    22,    -1,    -1,    -1,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    -1,    -1,    40,    41,    42,    -1,    -1,    45,
+      46,    47,    48,    49,    50,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    -1,    63,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    -1,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    -1,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    13,    14,    15,    16,    17,
+      -1,    19,    20,    21,    22,    -1,    -1,    -1,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      -1,    -1,    40,    41,    42,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    -1,    63,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    -1,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    -1,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    13,    14,    15,    16,    17,    -1,    19,
+      20,    21,    22,    -1,    -1,    -1,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    -1,    -1,
+      40,    41,    42,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    -1,    63,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    -1,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    -1,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    13,    14,    15,    16,    17,    -1,    19,    20,    21,
+      22,    -1,    -1,    -1,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    -1,    -1,    40,    41,
+      42,    -1,    -1,    45,    46,    47,    48,    49,    50,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      -1,    63,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    -1,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    -1,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,     3,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    -1,    19,    20,    21,    22,    -1,
+      -1,    -1,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    -1,    -1,    40,    41,    42,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    -1,    63,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    -1,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,     3,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,    14,    15,
+      16,    17,    -1,    19,    20,    21,    22,    -1,    -1,    -1,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    -1,    -1,    40,    41,    42,    -1,    -1,    45,
+      46,    47,    48,    49,    50,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    -1,    63,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    -1,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    -1,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    13,    14,    15,    16,    17,
+      -1,    19,    20,    21,    22,    -1,    -1,    -1,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      -1,    -1,    40,    41,    42,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    -1,    63,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    -1,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    -1,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    13,    14,    15,    16,    17,    -1,    19,
+      20,    21,    22,    -1,    -1,    -1,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    -1,    -1,
+      40,    41,    42,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    -1,    63,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    -1,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    -1,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    13,    14,    15,    16,    17,    -1,    19,    20,    21,
+      22,    -1,    -1,    -1,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    -1,    37,    -1,    -1,    40,    41,
+      42,    -1,    -1,    45,    46,    47,    48,    49,    50,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      -1,    63,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    -1,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    -1,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,     3,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    -1,    19,    20,    21,    22,    -1,
+      -1,    -1,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    -1,    37,    -1,    -1,    40,    41,    42,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    -1,    63,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    -1,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,     3,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,    14,    15,
+      16,    17,    -1,    19,    20,    21,    22,    -1,    -1,    -1,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      -1,    37,    -1,    -1,    40,    41,    42,    -1,    -1,    45,
+      46,    47,    48,    49,    50,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    -1,    63,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    -1,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    -1,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    13,    14,    15,    16,    17,
+      -1,    19,    20,    21,    22,    -1,    -1,    -1,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    -1,    37,
+      -1,    -1,    40,    41,    42,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    -1,    63,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    -1,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    -1,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    13,    14,    15,    16,    17,    -1,    19,
+      20,    21,    22,    -1,    -1,    -1,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    -1,    37,    -1,    -1,
+      40,    41,    42,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    -1,    63,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    -1,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    -1,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    13,    14,    15,    16,    17,    -1,    19,    20,    21,
+      22,    -1,    -1,    -1,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    -1,    37,    -1,    -1,    40,    41,
+      42,    -1,    -1,    45,    46,    47,    48,    49,    50,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      -1,    63,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    -1,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    -1,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,     3,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    -1,    19,    20,    21,    22,    -1,
+      -1,    -1,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    -1,    37,    -1,    -1,    40,    41,    42,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    -1,    63,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    -1,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,     3,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,    14,    15,
+      16,    17,    -1,    19,    20,    21,    22,    -1,    -1,    -1,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      -1,    37,    -1,    -1,    40,    41,    42,    -1,    -1,    45,
+      46,    47,    48,    49,    50,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    -1,    63,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    -1,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    -1,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    13,    14,    15,    16,    17,
+      -1,    19,    20,    21,    22,    -1,    -1,    -1,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    -1,    37,
+      -1,    -1,    40,    41,    42,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    -1,    63,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    -1,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    -1,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    13,    14,    15,    16,    17,    -1,    19,
+      20,    21,    22,    -1,    -1,    -1,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    -1,    37,    -1,    -1,
+      40,    41,    42,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    -1,    63,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    -1,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    -1,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    13,    14,    15,    16,    17,    -1,    19,    20,    21,
+      22,    -1,    -1,    -1,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    -1,    37,    -1,    -1,    40,    41,
+      42,    -1,    -1,    45,    46,    47,    48,    49,    50,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      -1,    63,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    -1,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    -1,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,     3,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    -1,    19,    20,    21,    22,    -1,
+      -1,    -1,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    -1,    37,    -1,    -1,    40,    41,    42,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    -1,    63,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    -1,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,     3,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,    14,    15,
+      16,    17,    -1,    19,    20,    21,    22,    -1,    -1,    -1,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      -1,    37,    -1,    -1,    40,    41,    42,    -1,    -1,    45,
+      46,    47,    48,    49,    50,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    -1,    63,    64,    -1,
+      66,    67,    68,    69,    70,    71,    72,    -1,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    -1,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    13,    14,    15,    16,    17,
+      -1,    19,    20,    21,    22,    -1,    -1,    -1,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    -1,    37,
+      -1,    -1,    40,    41,    42,    -1,    -1,    45,    46,    47,
+      48,    49,    50,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    -1,    63,    64,    -1,    66,    67,
+      68,    69,    70,    71,    72,    -1,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    -1,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    13,    14,    15,    16,    17,    -1,    19,
+      20,    21,    22,    -1,    -1,    -1,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    -1,    37,    -1,    -1,
+      40,    41,    42,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    -1,    63,    64,    -1,    66,    67,    68,    69,
+      70,    71,    72,    -1,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+      90,    -1,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    13,    14,    15,    16,    17,    -1,    19,    20,    21,
+      22,    -1,    -1,    -1,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    -1,    37,    -1,    -1,    40,    41,
+      42,    -1,    -1,    45,    46,    47,    48,    49,    50,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      -1,    63,    64,    -1,    66,    67,    68,    69,    70,    71,
+      72,    -1,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    -1,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,     3,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    13,
+      14,    15,    16,    17,    -1,    19,    20,    21,    22,    -1,
+      -1,    -1,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    -1,    37,    -1,    -1,    40,    41,    42,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    -1,    63,
+      64,    -1,    66,    67,    68,    69,    70,    71,    72,    -1,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,    13,    14,    15,
+      16,    17,    18,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    27,    -1,    -1,    -1,    31,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    41,    42,    -1,    -1,    45,
+      -1,    47,    48,    49,    -1,    -1,    -1,    53,    54,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    63,    64,    65,
+      66,    -1,    -1,    -1,    -1,    71,    -1,    -1,    -1,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,    -1,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,    13,    14,    15,    16,    17,    18,    27,    31,    41,
+      42,    45,    47,    48,    49,    53,    54,    63,    64,    65,
+      66,    71,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   121,   122,   123,
+     124,   125,   130,   134,   139,   140,   141,   142,   143,   144,
+     145,   150,   163,   170,   172,   183,   184,   185,   186,   187,
+     188,   189,   190,   191,   192,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   204,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,    26,    29,    32,
+      38,    39,    68,    69,    70,     3,    36,   146,   147,    26,
+      29,    32,    38,    39,    68,    69,    70,   100,    26,    32,
+      38,    39,    68,    69,   100,    19,    26,    28,    29,    37,
+      68,    69,   100,    30,    32,    36,    38,    39,    46,   148,
+     149,    36,    27,    32,    36,    38,    39,    32,    38,    39,
+      32,    36,    38,    39,    46,    32,    36,    38,    39,    46,
+      32,    39,     3,    20,    32,    38,    39,   151,   152,   153,
+      32,    38,    39,    74,    39,     3,    13,    14,    15,    16,
+      17,    19,    20,    21,    22,    26,    27,    28,    29,    31,
+      32,    33,    34,    35,    37,    40,    41,    42,    45,    46,
+      47,    48,    49,    50,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    63,    64,    66,    67,    68,    69,
+      70,    71,    72,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   177,
+     224,    26,     3,    36,   126,   127,   224,    36,   126,    32,
+      38,    39,    32,    39,    75,    32,    39,   209,    32,    39,
+     113,   113,   113,   113,   113,   113,   113,   113,     9,   117,
+     119,   180,   181,   181,   113,   113,   181,   113,   113,   113,
+     113,   113,   113,   113,     0,   111,    21,   177,    36,   177,
+     178,    33,    34,    35,   207,    21,   177,    33,    34,    35,
+     208,    21,   177,    21,   177,   177,    40,   205,   112,   205,
+      21,   171,   177,   178,   207,    21,   171,   208,    21,   171,
+      21,   171,   177,     3,   131,   132,   133,   177,   207,   177,
+     208,   177,   177,     3,   160,   161,   224,   149,   113,   173,
+     177,    32,    38,    39,   148,   210,   174,   177,    38,    39,
+     113,   173,   173,   173,   160,   113,   173,    33,    34,    35,
+     149,    33,    34,    35,   149,   146,   149,   149,   174,    72,
+       9,   207,   174,   208,    36,   207,   178,    36,   208,    33,
+      34,    35,    36,    36,   174,    33,    34,    35,    36,    36,
+     146,    33,    34,    35,    36,    55,   206,    36,   174,    33,
+      34,    35,    36,    36,   146,    34,    35,   177,    34,    35,
+     177,    31,    36,   207,   178,    36,   208,    50,   115,   116,
+      34,    35,   177,    33,    34,    35,    38,    33,   154,   155,
+     177,    50,    50,   112,    67,    67,   207,   171,   208,   207,
+     208,   209,    34,    35,    34,    35,   177,   207,   208,   173,
+     177,   177,   177,   177,   177,   177,   177,   180,   180,   113,
+     177,   181,   113,   177,   181,   181,   177,   177,   181,   177,
+     123,    23,   113,   164,   166,   113,    21,   177,    23,   164,
+      21,   177,    23,   164,    23,   164,     3,     5,    18,    23,
+      24,    25,    36,    38,    39,    51,    62,    65,    73,   179,
+     182,   224,   225,   147,    22,   112,   113,   193,    21,   171,
+      22,    21,   171,    22,    22,   112,   164,   177,   164,   177,
+     164,   164,    40,   136,   138,   118,   175,   176,   177,   112,
+      33,    34,    35,   177,    36,   112,    33,    34,    35,   175,
+     135,   175,   177,   174,   165,   166,   177,   165,   165,   178,
+     177,   177,   177,    36,   174,    36,   174,    36,   174,   205,
+     205,   177,   177,   177,   206,    56,    57,    58,    59,    60,
+      61,   206,   206,    36,   174,    36,   174,    36,   174,   206,
+     177,   177,    62,   203,   177,   177,   203,   165,   177,   165,
+     165,   178,     4,    24,    25,    51,   117,   156,   157,   158,
+     159,   161,   162,   179,   181,   156,     3,   177,   177,    50,
+      72,   177,   177,   177,   177,   177,   116,     3,   128,   129,
+      36,   128,   127,   128,    36,   128,   171,   171,   177,   177,
+     177,   177,   177,   114,   112,   112,   114,   112,   112,   114,
+     112,   177,   112,   112,   177,   112,   114,   112,   112,   112,
+     112,   112,    22,     3,   154,   167,   168,   177,   182,   224,
+     174,    23,   164,    22,    23,   164,    22,    22,   171,   177,
+     174,    22,   171,    22,   171,   171,   132,   164,   164,   179,
+     112,   114,   177,   177,   211,   211,   177,   114,   137,   138,
+     114,    62,   165,    62,    62,   165,   206,   206,   206,   206,
+     206,   206,   206,   206,   206,   203,   203,   203,   203,    62,
+     165,    62,    62,   165,     4,   112,   177,    72,   177,   112,
+      62,    62,   181,   177,   177,   177,   177,   112,   177,   181,
+     114,   177,   177,   177,   177,   177,   177,   177,   115,   112,
+     114,     4,   115,   169,   177,   179,   181,   225,   114,    22,
+     177,    22,   177,   177,   114,   171,   171,   176,   173,   173,
+     173,    62,    62,    62,    62,   157,   129,   114,   112,   112,
+     112,   112,   177,   112,   112,   114,   114,   112,   112,   112,
+     112,   164,   169,   168,   169,   177,   164,   177,   164,   164,
+     177,   181,   177,   177,   112,   177,   181,   179,   179,   177,
+     179,   164,   164,   114,   114,   114,   112,   177,   114,   112,
+     112,   112,   114,   112,   181,   112,   181,   181,   181,   181,
+     112,   177,   114,   112,   112,   112,   181,   112,   181,   181,
+     181,   114,   177,   112,   112,   112,   112,   181,   181,   181,
+     177,   112,   112,   114,   114,   181,   181,   112,   112,   181,
+     181,   114,   114
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   120,   121,   122,   122,   123,   123,   123,   123,   123,
+     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
+     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
+     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
+     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
+     123,   123,   123,   124,   125,   125,   125,   125,   125,   125,
+     126,   126,   127,   127,   128,   128,   129,   130,   131,   131,
+     132,   133,   134,   135,   135,   136,   137,   138,   139,   139,
+     139,   139,   139,   139,   139,   139,   139,   139,   140,   140,
+     140,   140,   141,   141,   141,   142,   142,   142,   142,   142,
+     143,   144,   144,   144,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   146,   146,   147,   148,   148,
+     148,   148,   148,   148,   148,   149,   149,   150,   151,   152,
+     152,   153,   153,   154,   155,   155,   156,   156,   157,   157,
+     158,   158,   158,   158,   159,   159,   160,   161,   161,   162,
+     162,   162,   163,   163,   164,   164,   165,   166,   167,   167,
+     168,   168,   168,   168,   168,   169,   169,   169,   169,   169,
+     170,   170,   171,   171,   172,   172,   172,   172,   173,   173,
+     174,   174,   175,   175,   176,   176,   177,   177,   178,   178,
+     179,   180,   181,   181,   181,   182,   182,   182,   183,   184,
+     184,   185,   185,   186,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   186,   187,   187,   187,   187,   187,   187,
+     187,   187,   187,   187,   188,   188,   188,   189,   189,   189,
+     189,   189,   190,   191,   192,   192,   193,   193,   194,   194,
+     194,   194,   194,   194,   195,   195,   195,   196,   196,   196,
+     196,   196,   196,   197,   198,   198,   198,   198,   198,   198,
+     198,   198,   198,   199,   199,   200,   200,   200,   200,   200,
+     200,   200,   200,   200,   200,   200,   200,   200,   200,   201,
+     201,   201,   201,   201,   201,   201,   201,   201,   201,   201,
+     201,   201,   201,   202,   202,   202,   202,   202,   202,   203,
+     203,   204,   204,   205,   205,   205,   206,   206,   206,   206,
+     206,   206,   206,   207,   207,   207,   208,   208,   208,   209,
+     209,   209,   209,   210,   210,   210,   210,   210,   210,   211,
+     211,   212,   212,   212,   212,   212,   212,   212,   212,   212,
+     212,   212,   212,   212,   212,   212,   213,   214,   215,   215,
+     215,   215,   216,   216,   217,   217,   217,   217,   218,   218,
+     218,   218,   219,   220,   221,   221,   221,   222,   222,   222,
+     222,   222,   223,   223,   223,   223,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   224,
+     224,   224,   224,   224,   224,   224,   224,   224,   224,   225,
+     225,   225,   225,   225,   225,   225,   225,   225,   225,   225
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     4,     4,     4,     4,     4,     4,
+       1,     3,     1,     1,     1,     3,     1,     3,     1,     3,
+       1,     1,     4,     2,     0,     1,     1,     2,     4,     5,
+       4,     4,     3,     4,     4,     4,     5,     4,    18,    18,
+      14,     8,     1,     1,     1,     1,     4,     6,     8,     4,
+      10,     4,     1,     1,     2,     3,     3,     3,     3,     3,
+       3,     2,     5,     3,     6,     1,     3,     1,     2,     2,
+       2,     1,     2,     2,     2,     1,     0,     2,     1,     3,
+       3,     1,     3,     3,     1,     1,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     1,     4,     7,     1,     0,     1,     3,     1,     3,
+       2,     3,     1,     1,     3,     1,     1,     1,     1,     1,
+       3,     5,     3,     1,     2,     5,     3,     6,     3,     1,
+       3,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     2,     1,     1,     1,     4,     4,
+       4,     3,     3,     5,     6,     4,     5,     5,     6,     4,
+       5,     4,     5,     3,     5,     6,     4,     5,     5,     6,
+       4,     5,     4,     5,     2,     5,     5,     2,     4,     3,
+       4,     3,     6,     4,     2,     3,     3,     0,     5,     8,
+       4,     7,     5,     8,     5,     4,     5,     4,     6,     3,
+       5,     4,     6,     3,     2,     5,     3,     6,     3,     3,
+       4,     4,     4,     2,     3,     4,     4,     4,     3,     3,
+       3,     4,     4,     4,     4,     4,     4,     3,     2,     5,
+       5,     5,     4,     4,     4,     5,     5,     5,     5,     5,
+       5,     4,     3,     5,     5,     4,     5,     5,     4,     1,
+       0,     3,     3,     2,     2,     0,     2,     2,     0,     2,
+       2,     2,     2,     1,     1,     1,     1,     1,     1,     2,
+       2,     2,     2,     1,     1,     1,     2,     2,     2,     1,
+       0,     1,     1,     1,     1,     1,     8,     8,     4,    12,
+       8,     6,     2,    15,     6,     5,     3,     2,     4,     7,
+       4,     7,     4,     4,     3,     5,     3,     5,     2,     3,
+       2,     3,     3,     3,     4,     4,     3,     4,     4,     4,
+       4,     3,     4,     5,     4,     5,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, yyscanner, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, yyscanner); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, core_yyscan_t yyscanner)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (yyscanner);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, core_yyscan_t yyscanner)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, yyscanner);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, core_yyscan_t yyscanner)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), yyscanner);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, yyscanner); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, core_yyscan_t yyscanner)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (yyscanner);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (core_yyscan_t yyscanner)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, yyscanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* stmtblock: stmtmulti  */
+#line 213 "mgr_gram.y"
+                        {
+				mgr_yyget_extra(yyscanner)->parsetree = (yyvsp[0].list);
+			}
+#line 3007 "mgr_gram.c"
+    break;
+
+  case 3: /* stmtmulti: stmtmulti ';' stmt  */
+#line 220 "mgr_gram.y"
+                                {
+					if ((yyvsp[0].node) != NULL)
+						(yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node));
+					else
+						(yyval.list) = (yyvsp[-2].list);
+				}
+#line 3018 "mgr_gram.c"
+    break;
+
+  case 4: /* stmtmulti: stmt  */
+#line 227 "mgr_gram.y"
+                                {
+					if ((yyvsp[0].node) != NULL)
+						(yyval.list) = list_make1((yyvsp[0].node));
+					else
+						(yyval.list) = NIL;
+				}
+#line 3029 "mgr_gram.c"
+    break;
+
+  case 52: /* stmt: %empty  */
+#line 285 "mgr_gram.y"
+                { (yyval.node) = NULL; }
+#line 3035 "mgr_gram.c"
+    break;
+
+  case 53: /* AlterUserStmt: ALTER USER RoleId AlterOptRoleList  */
+#line 290 "mgr_gram.y"
+                                 {
+					AlterRoleStmt *n = makeNode(AlterRoleStmt);
+					n->role = (yyvsp[-1].str);
+					n->action = +1; /* add, if there are members */
+					n->options = (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				 }
+#line 3047 "mgr_gram.c"
+    break;
+
+  case 54: /* GrantStmt: GRANT privilege_list TO username_list  */
+#line 301 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *command_type = makeIntConst(PRIV_GRANT, -1);
+			Node *privs = makeAArrayExpr((yyvsp[-2].list), (yylsp[-2]));
+			Node *names = makeAArrayExpr((yyvsp[0].list), (yylsp[0]));
+			List *args = list_make3(command_type, privs, names);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_priv_manage", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3062 "mgr_gram.c"
+    break;
+
+  case 55: /* GrantStmt: GRANT ALL TO username_list  */
+#line 312 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *command_type = makeIntConst(PRIV_GRANT, -1);
+			Node *names = makeAArrayExpr((yyvsp[0].list), (yylsp[0]));
+			List *args = list_make2(command_type, names);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_priv_all_to_username", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3076 "mgr_gram.c"
+    break;
+
+  case 56: /* GrantStmt: GRANT privilege_list TO ALL  */
+#line 322 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *command_type = makeIntConst(PRIV_GRANT, -1);
+			Node *privs = makeAArrayExpr((yyvsp[-2].list), (yylsp[-2]));
+			List *args = list_make2(command_type, privs);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_priv_list_to_all", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3090 "mgr_gram.c"
+    break;
+
+  case 57: /* GrantStmt: REVOKE privilege_list FROM username_list  */
+#line 332 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *command_type = makeIntConst(PRIV_REVOKE, -1);
+			Node *privs = makeAArrayExpr((yyvsp[-2].list), (yylsp[-2]));
+			Node *names = makeAArrayExpr((yyvsp[0].list), (yylsp[0]));
+			List *args = list_make3(command_type, privs, names);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_priv_manage", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3105 "mgr_gram.c"
+    break;
+
+  case 58: /* GrantStmt: REVOKE ALL FROM username_list  */
+#line 343 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *command_type = makeIntConst(PRIV_REVOKE, -1);
+			Node *names = makeAArrayExpr((yyvsp[0].list), (yylsp[0]));
+			List *args = list_make2(command_type, names);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_priv_all_to_username", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3119 "mgr_gram.c"
+    break;
+
+  case 59: /* GrantStmt: REVOKE privilege_list FROM ALL  */
+#line 353 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *command_type = makeIntConst(PRIV_REVOKE, -1);
+			Node *privs = makeAArrayExpr((yyvsp[-2].list), (yylsp[-2]));
+			List *args = list_make2(command_type, privs);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_priv_list_to_all", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3133 "mgr_gram.c"
+    break;
+
+  case 60: /* privilege_list: privilege  */
+#line 366 "mgr_gram.y"
+                                { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 3139 "mgr_gram.c"
+    break;
+
+  case 61: /* privilege_list: privilege_list ',' privilege  */
+#line 368 "mgr_gram.y"
+                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 3145 "mgr_gram.c"
+    break;
+
+  case 62: /* privilege: IDENT  */
+#line 371 "mgr_gram.y"
+                  { (yyval.node) = makeStringConst(pstrdup((yyvsp[0].str)), (yylsp[0])); }
+#line 3151 "mgr_gram.c"
+    break;
+
+  case 63: /* privilege: unreserved_keyword  */
+#line 372 "mgr_gram.y"
+                                             { (yyval.node) = makeStringConst(pstrdup((yyvsp[0].keyword)), (yylsp[0])); }
+#line 3157 "mgr_gram.c"
+    break;
+
+  case 64: /* username_list: username  */
+#line 377 "mgr_gram.y"
+                                { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 3163 "mgr_gram.c"
+    break;
+
+  case 65: /* username_list: username_list ',' username  */
+#line 379 "mgr_gram.y"
+                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 3169 "mgr_gram.c"
+    break;
+
+  case 66: /* username: IDENT  */
+#line 382 "mgr_gram.y"
+                 { (yyval.node) = makeStringConst(pstrdup((yyvsp[0].str)), (yylsp[0])); }
+#line 3175 "mgr_gram.c"
+    break;
+
+  case 67: /* DropUserStmt: DROP USER name_list  */
+#line 386 "mgr_gram.y"
+                                {
+					DropRoleStmt *n = makeNode(DropRoleStmt);
+					n->missing_ok = FALSE;
+					n->roles = (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 3186 "mgr_gram.c"
+    break;
+
+  case 68: /* name_list: name  */
+#line 395 "mgr_gram.y"
+                     { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 3192 "mgr_gram.c"
+    break;
+
+  case 69: /* name_list: name_list ',' name  */
+#line 397 "mgr_gram.y"
+                        { (yyval.list) = lappend((yyvsp[-2].list), makeString((yyvsp[0].str))); }
+#line 3198 "mgr_gram.c"
+    break;
+
+  case 70: /* name: ColId  */
+#line 400 "mgr_gram.y"
+                { (yyval.str) = (yyvsp[0].str); }
+#line 3204 "mgr_gram.c"
+    break;
+
+  case 71: /* ColId: IDENT  */
+#line 402 "mgr_gram.y"
+                 { (yyval.str) = (yyvsp[0].str); }
+#line 3210 "mgr_gram.c"
+    break;
+
+  case 72: /* CreateUserStmt: CREATE USER RoleId OptRoleList  */
+#line 406 "mgr_gram.y"
+                                {
+					CreateRoleStmt *n = makeNode(CreateRoleStmt);
+					n->stmt_type = ROLESTMT_USER;
+					n->role = (yyvsp[-1].str);
+					n->options = (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 3222 "mgr_gram.c"
+    break;
+
+  case 73: /* OptRoleList: OptRoleList CreateOptRoleElem  */
+#line 416 "mgr_gram.y"
+                                                          { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].defelt)); }
+#line 3228 "mgr_gram.c"
+    break;
+
+  case 74: /* OptRoleList: %empty  */
+#line 417 "mgr_gram.y"
+                                                          { (yyval.list) = NIL; }
+#line 3234 "mgr_gram.c"
+    break;
+
+  case 75: /* AlterOptRoleList: AlterOptRoleElem  */
+#line 421 "mgr_gram.y"
+                                          { (yyval.list) = list_make1((yyvsp[0].defelt)); }
+#line 3240 "mgr_gram.c"
+    break;
+
+  case 76: /* CreateOptRoleElem: AlterOptRoleElem  */
+#line 425 "mgr_gram.y"
+                                          { (yyval.defelt) = (yyvsp[0].defelt); }
+#line 3246 "mgr_gram.c"
+    break;
+
+  case 77: /* AlterOptRoleElem: PASSWORD SConst  */
+#line 430 "mgr_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("password", (Node *)makeString((yyvsp[0].str)));
+				}
+#line 3254 "mgr_gram.c"
+    break;
+
+  case 78: /* AppendNodeStmt: APPEND DATANODE MASTER Ident  */
+#line 451 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_dnmaster", args));
+			with_data_checksums = false;
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3267 "mgr_gram.c"
+    break;
+
+  case 79: /* AppendNodeStmt: APPEND DATANODE MASTER Ident DATA_CHECKSUMS  */
+#line 460 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_dnmaster", args));
+			with_data_checksums = true;
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3280 "mgr_gram.c"
+    break;
+
+  case 80: /* AppendNodeStmt: APPEND DATANODE SLAVE Ident  */
+#line 469 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_dnslave", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3292 "mgr_gram.c"
+    break;
+
+  case 81: /* AppendNodeStmt: APPEND DATANODE EXTRA Ident  */
+#line 477 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_dnextra", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3304 "mgr_gram.c"
+    break;
+
+  case 82: /* AppendNodeStmt: APPEND COORDINATOR Ident  */
+#line 485 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_coordmaster", args));
+			with_data_checksums = false;
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3317 "mgr_gram.c"
+    break;
+
+  case 83: /* AppendNodeStmt: APPEND COORDINATOR Ident DATA_CHECKSUMS  */
+#line 494 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_coordmaster", args));
+			with_data_checksums = true;
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3330 "mgr_gram.c"
+    break;
+
+  case 84: /* AppendNodeStmt: APPEND GTM SLAVE Ident  */
+#line 503 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_agtmslave", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3342 "mgr_gram.c"
+    break;
+
+  case 85: /* AppendNodeStmt: APPEND GTM EXTRA Ident  */
+#line 511 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_agtmextra", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3354 "mgr_gram.c"
+    break;
+
+  case 86: /* AppendNodeStmt: APPEND COORDINATOR Ident TO Ident  */
+#line 519 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-2].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_coord_to_coord", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3367 "mgr_gram.c"
+    break;
+
+  case 87: /* AppendNodeStmt: APPEND ACTIVATE COORDINATOR Ident  */
+#line 528 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_append_activate_coord", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3379 "mgr_gram.c"
+    break;
+
+  case 88: /* Get_alarm_info: GET_ALARM_INFO_ASC '(' Ident ',' Ident ',' SConst ',' SignedIconst ',' SignedIconst ',' SignedIconst ',' SignedIconst ',' SignedIconst ')'  */
+#line 539 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-15].str), -1));
+			args = lappend(args,makeStringConst((yyvsp[-13].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-11].str), -1));
+			args = lappend(args, makeIntConst((yyvsp[-9].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-7].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-5].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-3].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-1].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("get_alarm_info_asc", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3398 "mgr_gram.c"
+    break;
+
+  case 89: /* Get_alarm_info: GET_ALARM_INFO_DESC '(' Ident ',' Ident ',' SConst ',' SignedIconst ',' SignedIconst ',' SignedIconst ',' SignedIconst ',' SignedIconst ')'  */
+#line 554 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-15].str), -1));
+			args = lappend(args,makeStringConst((yyvsp[-13].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-11].str), -1));
+			args = lappend(args, makeIntConst((yyvsp[-9].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-7].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-5].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-3].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-1].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("get_alarm_info_desc", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3417 "mgr_gram.c"
+    break;
+
+  case 90: /* Get_alarm_info: GET_ALARM_INFO_COUNT '(' Ident ',' Ident ',' SConst ',' SignedIconst ',' SignedIconst ',' SignedIconst ')'  */
+#line 569 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-11].str), -1));
+			args = lappend(args,makeStringConst((yyvsp[-9].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-7].str), -1));
+			args = lappend(args, makeIntConst((yyvsp[-5].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-3].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-1].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("get_alarm_info_count", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3434 "mgr_gram.c"
+    break;
+
+  case 91: /* Get_alarm_info: RESOLVE_ALARM '(' SignedIconst ',' Ident ',' Ident ')'  */
+#line 582 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-5].ival), -1));
+			args = lappend(args,makeStringConst((yyvsp[-3].str), -1));
+			args = lappend(args,makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("resolve_alarm", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3448 "mgr_gram.c"
+    break;
+
+  case 92: /* Gettopologyparm: GET_AGTM_NODE_TOPOLOGY  */
+#line 594 "mgr_gram.y"
+        {
+            SelectStmt *stmt = makeNode(SelectStmt);
+            stmt->targetList = list_make1(make_star_target(-1));
+            stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("get_agtm_node_topology"), -1));
+            (yyval.node) = (Node*)stmt;
+        }
+#line 3459 "mgr_gram.c"
+    break;
+
+  case 93: /* Gettopologyparm: GET_COORDINATOR_NODE_TOPOLOGY  */
+#line 601 "mgr_gram.y"
+        {
+            SelectStmt *stmt = makeNode(SelectStmt);
+            stmt->targetList = list_make1(make_star_target(-1));
+            stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("get_coordinator_node_topology"), -1));
+            (yyval.node) = (Node*)stmt;
+        }
+#line 3470 "mgr_gram.c"
+    break;
+
+  case 94: /* Gettopologyparm: GET_DATANODE_NODE_TOPOLOGY  */
+#line 608 "mgr_gram.y"
+        {
+            SelectStmt *stmt = makeNode(SelectStmt);
+            stmt->targetList = list_make1(make_star_target(-1));
+            stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("get_datanode_node_topology"), -1));
+            (yyval.node) = (Node*)stmt;
+        }
+#line 3481 "mgr_gram.c"
+    break;
+
+  case 95: /* Gethostparm: GET_HOST_LIST_ALL  */
+#line 617 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("get_all_host_parm"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3492 "mgr_gram.c"
+    break;
+
+  case 96: /* Gethostparm: GET_HOST_LIST_SPEC '(' AConstList ')'  */
+#line 624 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("get_spec_host_parm"), -1));
+			stmt->whereClause = make_column_in("hostname", (yyvsp[-1].list));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3504 "mgr_gram.c"
+    break;
+
+  case 97: /* Gethostparm: GET_HOST_HISTORY_USAGE '(' Ident ',' SignedIconst ')'  */
+#line 632 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-3].str), -1));
+			args = lappend(args, makeIntConst((yyvsp[-1].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("get_host_history_usage", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3517 "mgr_gram.c"
+    break;
+
+  case 98: /* Gethostparm: GET_HOST_HISTORY_USAGE_BY_TIME_PERIOD '(' Ident ',' Ident ',' Ident ')'  */
+#line 641 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-5].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-3].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("get_host_history_usage_by_time_period", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3531 "mgr_gram.c"
+    break;
+
+  case 99: /* Gethostparm: GET_ALL_NODENAME_IN_SPEC_HOST '(' Ident ')'  */
+#line 651 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("get_all_nodename_in_spec_host", args));
+			(yyval.node) = (Node*)stmt;
+        }
+#line 3543 "mgr_gram.c"
+    break;
+
+  case 100: /* Update_host_config_value: UPDATE_THRESHOLD_VALUE '(' SignedIconst ',' SignedIconst ',' SignedIconst ',' SignedIconst ')'  */
+#line 661 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-7].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-5].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-3].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-1].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("update_threshold_value", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3558 "mgr_gram.c"
+    break;
+
+  case 101: /* Get_host_threshold: GET_THRESHOLD_TYPE '(' SignedIconst ')'  */
+#line 674 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("get_threshold_type", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3570 "mgr_gram.c"
+    break;
+
+  case 102: /* Get_host_threshold: GET_THRESHOLD_ALL_TYPE  */
+#line 682 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("get_threshold_all_type"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3581 "mgr_gram.c"
+    break;
+
+  case 103: /* Get_host_threshold: GET_DB_THRESHOLD_ALL_TYPE  */
+#line 689 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("get_db_threshold_all_type"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3592 "mgr_gram.c"
+    break;
+
+  case 104: /* MonitorStmt: MONITOR opt_general_all  */
+#line 710 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("monitor_all"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3603 "mgr_gram.c"
+    break;
+
+  case 105: /* MonitorStmt: MONITOR GTM opt_general_all  */
+#line 717 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_monitor_gtm_all", NULL));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3614 "mgr_gram.c"
+    break;
+
+  case 106: /* MonitorStmt: MONITOR DATANODE opt_general_all  */
+#line 724 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_monitor_datanode_all", NULL));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3625 "mgr_gram.c"
+    break;
+
+  case 107: /* MonitorStmt: MONITOR node_type NodeConstList  */
+#line 731 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = lcons(makeIntConst((yyvsp[-1].chr), (yylsp[-1])), (yyvsp[0].list));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_monitor_nodetype_namelist", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3637 "mgr_gram.c"
+    break;
+
+  case 108: /* MonitorStmt: MONITOR node_type opt_general_all  */
+#line 739 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *arg = list_make1(makeIntConst((yyvsp[-1].chr),-1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_monitor_nodetype_all", arg));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3649 "mgr_gram.c"
+    break;
+
+  case 109: /* MonitorStmt: MONITOR AGENT opt_general_all  */
+#line 747 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_monitor_agent_all", NULL));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3660 "mgr_gram.c"
+    break;
+
+  case 110: /* MonitorStmt: MONITOR AGENT hostname_list  */
+#line 754 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *hostnames = makeAArrayExpr((yyvsp[0].list), (yylsp[0]));
+			List *arg = list_make1(hostnames);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_monitor_agent_hostlist", arg));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3673 "mgr_gram.c"
+    break;
+
+  case 111: /* MonitorStmt: MONITOR HA  */
+#line 763 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("ha"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3684 "mgr_gram.c"
+    break;
+
+  case 112: /* MonitorStmt: MONITOR HA '(' targetList ')'  */
+#line 770 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = (yyvsp[-1].list);
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("ha"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 3695 "mgr_gram.c"
+    break;
+
+  case 113: /* MonitorStmt: MONITOR HA AConstList  */
+#line 777 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("ha"), -1));
+			stmt->whereClause = make_column_in("nodename", (yyvsp[0].list));
+			(yyval.node) = (Node*)stmt;
+			check__name_isvaild((yyvsp[0].list));
+		}
+#line 3708 "mgr_gram.c"
+    break;
+
+  case 114: /* MonitorStmt: MONITOR HA '(' targetList ')' AConstList  */
+#line 786 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = (yyvsp[-2].list);
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("ha"), -1));
+			stmt->whereClause = make_column_in("nodename", (yyvsp[0].list));
+			(yyval.node) = (Node*)stmt;
+			check__name_isvaild((yyvsp[0].list));
+		}
+#line 3721 "mgr_gram.c"
+    break;
+
+  case 115: /* hostname_list: hostname  */
+#line 798 "mgr_gram.y"
+                                { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 3727 "mgr_gram.c"
+    break;
+
+  case 116: /* hostname_list: hostname_list ',' hostname  */
+#line 800 "mgr_gram.y"
+                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 3733 "mgr_gram.c"
+    break;
+
+  case 117: /* hostname: IDENT  */
+#line 803 "mgr_gram.y"
+                 { (yyval.node) = makeStringConst(pstrdup((yyvsp[0].str)), (yylsp[0])); }
+#line 3739 "mgr_gram.c"
+    break;
+
+  case 118: /* node_type: DATANODE MASTER  */
+#line 806 "mgr_gram.y"
+                                                {(yyval.chr) = CNDN_TYPE_DATANODE_MASTER;}
+#line 3745 "mgr_gram.c"
+    break;
+
+  case 119: /* node_type: DATANODE SLAVE  */
+#line 807 "mgr_gram.y"
+                                                {(yyval.chr) = CNDN_TYPE_DATANODE_SLAVE;}
+#line 3751 "mgr_gram.c"
+    break;
+
+  case 120: /* node_type: DATANODE EXTRA  */
+#line 808 "mgr_gram.y"
+                                                {(yyval.chr) = CNDN_TYPE_DATANODE_EXTRA;}
+#line 3757 "mgr_gram.c"
+    break;
+
+  case 121: /* node_type: COORDINATOR  */
+#line 809 "mgr_gram.y"
+                                                {(yyval.chr) = CNDN_TYPE_COORDINATOR_MASTER;}
+#line 3763 "mgr_gram.c"
+    break;
+
+  case 122: /* node_type: GTM MASTER  */
+#line 810 "mgr_gram.y"
+                                                {(yyval.chr) = GTM_TYPE_GTM_MASTER;}
+#line 3769 "mgr_gram.c"
+    break;
+
+  case 123: /* node_type: GTM SLAVE  */
+#line 811 "mgr_gram.y"
+                                                        {(yyval.chr) = GTM_TYPE_GTM_SLAVE;}
+#line 3775 "mgr_gram.c"
+    break;
+
+  case 124: /* node_type: GTM EXTRA  */
+#line 812 "mgr_gram.y"
+                                                        {(yyval.chr) = GTM_TYPE_GTM_EXTRA;}
+#line 3781 "mgr_gram.c"
+    break;
+
+  case 125: /* opt_general_all: ALL  */
+#line 816 "mgr_gram.y"
+                                { (yyval.str) = pstrdup("all"); }
+#line 3787 "mgr_gram.c"
+    break;
+
+  case 126: /* opt_general_all: %empty  */
+#line 817 "mgr_gram.y"
+                            { (yyval.str) = pstrdup("all"); }
+#line 3793 "mgr_gram.c"
+    break;
+
+  case 127: /* VariableSetStmt: SET set_rest  */
+#line 822 "mgr_gram.y"
+                                {
+					VariableSetStmt *n = (yyvsp[0].vsetstmt);
+					n->is_local = false;
+					(yyval.node) = (Node *) n;
+				}
+#line 3803 "mgr_gram.c"
+    break;
+
+  case 128: /* set_rest: set_rest_more  */
+#line 829 "mgr_gram.y"
+                        { (yyval.vsetstmt) = (yyvsp[0].vsetstmt); }
+#line 3809 "mgr_gram.c"
+    break;
+
+  case 129: /* set_rest_more: var_name TO var_list  */
+#line 833 "mgr_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = (yyvsp[-2].str);
+					n->args = (yyvsp[0].list);
+					(yyval.vsetstmt) = n;
+				}
+#line 3821 "mgr_gram.c"
+    break;
+
+  case 130: /* set_rest_more: var_name '=' var_list  */
+#line 841 "mgr_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = (yyvsp[-2].str);
+					n->args = (yyvsp[0].list);
+					(yyval.vsetstmt) = n;
+				}
+#line 3833 "mgr_gram.c"
+    break;
+
+  case 131: /* var_name: IDENT  */
+#line 850 "mgr_gram.y"
+                                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 3839 "mgr_gram.c"
+    break;
+
+  case 132: /* var_name: var_name '.' IDENT  */
+#line 852 "mgr_gram.y"
+                                {
+					(yyval.str) = palloc(strlen((yyvsp[-2].str)) + strlen((yyvsp[0].str)) + 2);
+					sprintf((yyval.str), "%s.%s", (yyvsp[-2].str), (yyvsp[0].str));
+				}
+#line 3848 "mgr_gram.c"
+    break;
+
+  case 133: /* var_dotparam: Ident '.' Ident  */
+#line 859 "mgr_gram.y"
+                                {
+					(yyval.str) = palloc(strlen((yyvsp[-2].str)) + strlen((yyvsp[0].str)) + 2);
+					sprintf((yyval.str), "%s.%s", (yyvsp[-2].str), (yyvsp[0].str));
+				}
+#line 3857 "mgr_gram.c"
+    break;
+
+  case 134: /* var_showparam: Ident  */
+#line 865 "mgr_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 3863 "mgr_gram.c"
+    break;
+
+  case 135: /* var_showparam: var_dotparam  */
+#line 866 "mgr_gram.y"
+                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 3869 "mgr_gram.c"
+    break;
+
+  case 136: /* var_list: var_value  */
+#line 868 "mgr_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 3875 "mgr_gram.c"
+    break;
+
+  case 137: /* var_list: var_list ',' var_value  */
+#line 869 "mgr_gram.y"
+                                                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 3881 "mgr_gram.c"
+    break;
+
+  case 138: /* var_value: opt_boolean_or_string  */
+#line 872 "mgr_gram.y"
+                                        { (yyval.node) = makeStringConst((yyvsp[0].str), (yylsp[0])); }
+#line 3887 "mgr_gram.c"
+    break;
+
+  case 139: /* var_value: NumericOnly  */
+#line 873 "mgr_gram.y"
+                                                        { (yyval.node) = makeAConst((yyvsp[0].value), (yylsp[0])); }
+#line 3893 "mgr_gram.c"
+    break;
+
+  case 140: /* opt_boolean_or_string: TRUE_P  */
+#line 876 "mgr_gram.y"
+                                                                                                { (yyval.str) = "true"; }
+#line 3899 "mgr_gram.c"
+    break;
+
+  case 141: /* opt_boolean_or_string: FALSE_P  */
+#line 877 "mgr_gram.y"
+                                                                                                { (yyval.str) = "false"; }
+#line 3905 "mgr_gram.c"
+    break;
+
+  case 142: /* opt_boolean_or_string: ON  */
+#line 878 "mgr_gram.y"
+                                                                                                { (yyval.str) = "on"; }
+#line 3911 "mgr_gram.c"
+    break;
+
+  case 143: /* opt_boolean_or_string: NonReservedWord_or_Sconst  */
+#line 884 "mgr_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 3917 "mgr_gram.c"
+    break;
+
+  case 144: /* NonReservedWord_or_Sconst: NonReservedWord  */
+#line 888 "mgr_gram.y"
+                                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 3923 "mgr_gram.c"
+    break;
+
+  case 145: /* NonReservedWord_or_Sconst: SConst  */
+#line 889 "mgr_gram.y"
+                                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 3929 "mgr_gram.c"
+    break;
+
+  case 146: /* RoleId: NonReservedWord  */
+#line 892 "mgr_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 3935 "mgr_gram.c"
+    break;
+
+  case 147: /* NonReservedWord: IDENT  */
+#line 894 "mgr_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 3941 "mgr_gram.c"
+    break;
+
+  case 148: /* NonReservedWord: unreserved_keyword  */
+#line 895 "mgr_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 3947 "mgr_gram.c"
+    break;
+
+  case 149: /* NumericOnly: FCONST  */
+#line 899 "mgr_gram.y"
+                                                                                        { (yyval.value) = makeFloat((yyvsp[0].str)); }
+#line 3953 "mgr_gram.c"
+    break;
+
+  case 150: /* NumericOnly: '-' FCONST  */
+#line 901 "mgr_gram.y"
+                                {
+					(yyval.value) = makeFloat((yyvsp[0].str));
+					doNegateFloat((yyval.value));
+				}
+#line 3962 "mgr_gram.c"
+    break;
+
+  case 151: /* NumericOnly: SignedIconst  */
+#line 905 "mgr_gram.y"
+                                                                                { (yyval.value) = makeInteger((yyvsp[0].ival)); }
+#line 3968 "mgr_gram.c"
+    break;
+
+  case 152: /* AddHostStmt: ADD_P HOST Ident opt_general_options  */
+#line 910 "mgr_gram.y"
+                {
+			MGRAddHost *node = makeNode(MGRAddHost);
+			node->if_not_exists = false;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 3980 "mgr_gram.c"
+    break;
+
+  case 153: /* AddHostStmt: ADD_P HOST IF_P NOT EXISTS Ident opt_general_options  */
+#line 918 "mgr_gram.y"
+                {
+			MGRAddHost *node = makeNode(MGRAddHost);
+			node->if_not_exists = true;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 3992 "mgr_gram.c"
+    break;
+
+  case 154: /* opt_general_options: general_options  */
+#line 928 "mgr_gram.y"
+                                { (yyval.list) = (yyvsp[0].list); }
+#line 3998 "mgr_gram.c"
+    break;
+
+  case 155: /* opt_general_options: %empty  */
+#line 929 "mgr_gram.y"
+                                { (yyval.list) = NIL; }
+#line 4004 "mgr_gram.c"
+    break;
+
+  case 156: /* set_parm_general_options: general_options  */
+#line 933 "mgr_gram.y"
+                                { (yyval.list) = (yyvsp[0].list); }
+#line 4010 "mgr_gram.c"
+    break;
+
+  case 157: /* general_options: '(' general_option_list ')'  */
+#line 937 "mgr_gram.y"
+                {
+			(yyval.list) = (yyvsp[-1].list);
+		}
+#line 4018 "mgr_gram.c"
+    break;
+
+  case 158: /* general_option_list: general_option_item  */
+#line 944 "mgr_gram.y"
+                {
+			(yyval.list) = list_make1((yyvsp[0].node));
+		}
+#line 4026 "mgr_gram.c"
+    break;
+
+  case 159: /* general_option_list: general_option_list ',' general_option_item  */
+#line 948 "mgr_gram.y"
+                {
+			(yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node));
+		}
+#line 4034 "mgr_gram.c"
+    break;
+
+  case 160: /* general_option_item: ColLabel general_option_arg  */
+#line 954 "mgr_gram.y"
+                                                { (yyval.node) = (Node*)makeDefElem((yyvsp[-1].str), (yyvsp[0].node)); }
+#line 4040 "mgr_gram.c"
+    break;
+
+  case 161: /* general_option_item: ColLabel '=' general_option_arg  */
+#line 955 "mgr_gram.y"
+                                                { (yyval.node) = (Node*)makeDefElem((yyvsp[-2].str), (yyvsp[0].node)); }
+#line 4046 "mgr_gram.c"
+    break;
+
+  case 162: /* general_option_item: ColLabel  */
+#line 956 "mgr_gram.y"
+                                                                        { (yyval.node) = (Node*)makeDefElem((yyvsp[0].str), NULL); }
+#line 4052 "mgr_gram.c"
+    break;
+
+  case 163: /* general_option_item: var_dotparam  */
+#line 957 "mgr_gram.y"
+                                                                { (yyval.node) = (Node*)makeDefElem((yyvsp[0].str), NULL); }
+#line 4058 "mgr_gram.c"
+    break;
+
+  case 164: /* general_option_item: var_dotparam '=' general_option_arg  */
+#line 958 "mgr_gram.y"
+                                              { (yyval.node) = (Node*)makeDefElem((yyvsp[-2].str), (yyvsp[0].node)); }
+#line 4064 "mgr_gram.c"
+    break;
+
+  case 165: /* general_option_arg: Ident  */
+#line 964 "mgr_gram.y"
+                                                                        { (yyval.node) = (Node*)makeString((yyvsp[0].str)); }
+#line 4070 "mgr_gram.c"
+    break;
+
+  case 166: /* general_option_arg: SConst  */
+#line 965 "mgr_gram.y"
+                                                                        { (yyval.node) = (Node*)makeString((yyvsp[0].str)); }
+#line 4076 "mgr_gram.c"
+    break;
+
+  case 167: /* general_option_arg: SignedIconst  */
+#line 966 "mgr_gram.y"
+                                                                { (yyval.node) = (Node*)makeInteger((yyvsp[0].ival)); }
+#line 4082 "mgr_gram.c"
+    break;
+
+  case 168: /* general_option_arg: FCONST  */
+#line 967 "mgr_gram.y"
+                                                                        { (yyval.node) = (Node*)makeFloat((yyvsp[0].str)); }
+#line 4088 "mgr_gram.c"
+    break;
+
+  case 169: /* general_option_arg: reserved_keyword  */
+#line 968 "mgr_gram.y"
+                                                                { (yyval.node) = (Node*)makeString(pstrdup((yyvsp[0].keyword))); }
+#line 4094 "mgr_gram.c"
+    break;
+
+  case 170: /* DropHostStmt: DROP HOST ObjList  */
+#line 973 "mgr_gram.y"
+                {
+			MGRDropHost *node = makeNode(MGRDropHost);
+			node->if_exists = false;
+			node->hosts = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 4105 "mgr_gram.c"
+    break;
+
+  case 171: /* DropHostStmt: DROP HOST IF_P EXISTS ObjList  */
+#line 980 "mgr_gram.y"
+                {
+			MGRDropHost *node = makeNode(MGRDropHost);
+			node->if_exists = true;
+			node->hosts = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 4116 "mgr_gram.c"
+    break;
+
+  case 172: /* ObjList: ObjList ',' Ident  */
+#line 990 "mgr_gram.y"
+                {
+			(yyval.list) = lappend((yyvsp[-2].list), makeString((yyvsp[0].str)));
+		}
+#line 4124 "mgr_gram.c"
+    break;
+
+  case 173: /* ObjList: Ident  */
+#line 994 "mgr_gram.y"
+                {
+			(yyval.list) = list_make1(makeString((yyvsp[0].str)));
+		}
+#line 4132 "mgr_gram.c"
+    break;
+
+  case 174: /* ListHostStmt: LIST HOST  */
+#line 1001 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("host"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4143 "mgr_gram.c"
+    break;
+
+  case 175: /* ListHostStmt: LIST HOST '(' targetList ')'  */
+#line 1008 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = (yyvsp[-1].list);
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("host"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4154 "mgr_gram.c"
+    break;
+
+  case 176: /* ListHostStmt: LIST HOST AConstList  */
+#line 1015 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("host"), -1));
+			stmt->whereClause = make_column_in("name", (yyvsp[0].list));
+			(yyval.node) = (Node*)stmt;
+
+			check_host_name_isvaild((yyvsp[0].list));
+		}
+#line 4168 "mgr_gram.c"
+    break;
+
+  case 177: /* ListHostStmt: LIST HOST '(' targetList ')' AConstList  */
+#line 1025 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = (yyvsp[-2].list);
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("host"), -1));
+			stmt->whereClause = make_column_in("name", (yyvsp[0].list));
+			(yyval.node) = (Node*)stmt;
+
+			check_host_name_isvaild((yyvsp[0].list));
+		}
+#line 4182 "mgr_gram.c"
+    break;
+
+  case 178: /* AConstList: AConstList ',' Ident  */
+#line 1037 "mgr_gram.y"
+                                { (yyval.list) = lappend((yyvsp[-2].list), makeAConst(makeString((yyvsp[0].str)), (yylsp[0]))); }
+#line 4188 "mgr_gram.c"
+    break;
+
+  case 179: /* AConstList: Ident  */
+#line 1038 "mgr_gram.y"
+                                                        { (yyval.list) = list_make1(makeAConst(makeString((yyvsp[0].str)), (yylsp[0]))); }
+#line 4194 "mgr_gram.c"
+    break;
+
+  case 180: /* NodeConstList: NodeConstList ',' Ident  */
+#line 1041 "mgr_gram.y"
+                                        { (yyval.list) = lappend((yyvsp[-2].list), makeStringConst((yyvsp[0].str), (yylsp[0]))); }
+#line 4200 "mgr_gram.c"
+    break;
+
+  case 181: /* NodeConstList: Ident  */
+#line 1042 "mgr_gram.y"
+                                                        { (yyval.list) = list_make1(makeStringConst((yyvsp[0].str), (yylsp[0]))); }
+#line 4206 "mgr_gram.c"
+    break;
+
+  case 182: /* targetList: targetList ',' target_el  */
+#line 1045 "mgr_gram.y"
+                                        { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 4212 "mgr_gram.c"
+    break;
+
+  case 183: /* targetList: target_el  */
+#line 1046 "mgr_gram.y"
+                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 4218 "mgr_gram.c"
+    break;
+
+  case 184: /* target_el: Ident  */
+#line 1051 "mgr_gram.y"
+                {
+			ResTarget *target = makeNode(ResTarget);
+			ColumnRef *col = makeNode(ColumnRef);
+			col->fields = list_make1(makeString((yyvsp[0].str)));
+			col->location = (yylsp[0]);
+			target->val = (Node*)col;
+			target->location = (yylsp[0]);
+			(yyval.node) = (Node*)target;
+		}
+#line 4232 "mgr_gram.c"
+    break;
+
+  case 185: /* target_el: '*'  */
+#line 1061 "mgr_gram.y"
+                {
+			(yyval.node) = (Node*)make_star_target((yylsp[0]));
+		}
+#line 4240 "mgr_gram.c"
+    break;
+
+  case 186: /* Ident: IDENT  */
+#line 1067 "mgr_gram.y"
+                                                { (yyval.str) = (yyvsp[0].str); }
+#line 4246 "mgr_gram.c"
+    break;
+
+  case 187: /* Ident: unreserved_keyword  */
+#line 1068 "mgr_gram.y"
+                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 4252 "mgr_gram.c"
+    break;
+
+  case 188: /* set_ident: Ident  */
+#line 1071 "mgr_gram.y"
+                                                { (yyval.str) = (yyvsp[0].str); }
+#line 4258 "mgr_gram.c"
+    break;
+
+  case 189: /* set_ident: ALL  */
+#line 1072 "mgr_gram.y"
+                                                        { (yyval.str) = pstrdup("*"); }
+#line 4264 "mgr_gram.c"
+    break;
+
+  case 190: /* SConst: SCONST  */
+#line 1074 "mgr_gram.y"
+                                        { (yyval.str) = (yyvsp[0].str); }
+#line 4270 "mgr_gram.c"
+    break;
+
+  case 191: /* Iconst: ICONST  */
+#line 1075 "mgr_gram.y"
+                                        { (yyval.ival) = (yyvsp[0].ival); }
+#line 4276 "mgr_gram.c"
+    break;
+
+  case 192: /* SignedIconst: Iconst  */
+#line 1077 "mgr_gram.y"
+                                                                                { (yyval.ival) = (yyvsp[0].ival); }
+#line 4282 "mgr_gram.c"
+    break;
+
+  case 193: /* SignedIconst: '+' Iconst  */
+#line 1078 "mgr_gram.y"
+                                                                                        { (yyval.ival) = + (yyvsp[0].ival); }
+#line 4288 "mgr_gram.c"
+    break;
+
+  case 194: /* SignedIconst: '-' Iconst  */
+#line 1079 "mgr_gram.y"
+                                                                                        { (yyval.ival) = - (yyvsp[0].ival); }
+#line 4294 "mgr_gram.c"
+    break;
+
+  case 195: /* ColLabel: IDENT  */
+#line 1082 "mgr_gram.y"
+                                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 4300 "mgr_gram.c"
+    break;
+
+  case 196: /* ColLabel: unreserved_keyword  */
+#line 1083 "mgr_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 4306 "mgr_gram.c"
+    break;
+
+  case 197: /* ColLabel: reserved_keyword  */
+#line 1084 "mgr_gram.y"
+                                                                                        { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 4312 "mgr_gram.c"
+    break;
+
+  case 198: /* AlterHostStmt: ALTER HOST Ident opt_general_options  */
+#line 1089 "mgr_gram.y"
+                {
+			MGRAlterHost *node = makeNode(MGRAlterHost);
+			node->if_not_exists = false;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 4324 "mgr_gram.c"
+    break;
+
+  case 199: /* StartAgentStmt: START AGENT ALL opt_password  */
+#line 1100 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_agent_all", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4336 "mgr_gram.c"
+    break;
+
+  case 200: /* StartAgentStmt: START AGENT hostname_list opt_password  */
+#line 1108 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *password = makeStringConst((yyvsp[0].str), -1);
+			Node *hostnames = makeAArrayExpr((yyvsp[-1].list), (yylsp[-1]));
+			List *args = list_make2(password, hostnames);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_agent_hostnamelist", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4350 "mgr_gram.c"
+    break;
+
+  case 201: /* StopAgentStmt: STOP AGENT ALL  */
+#line 1121 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_agent_all", NULL));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4361 "mgr_gram.c"
+    break;
+
+  case 202: /* StopAgentStmt: STOP AGENT hostname_list  */
+#line 1128 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *hostnames = makeAArrayExpr((yyvsp[0].list), (yylsp[0]));
+			List *arg = list_make1(hostnames);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_agent_hostnamelist", arg));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4374 "mgr_gram.c"
+    break;
+
+  case 203: /* AddUpdataparmStmt: SET GTM opt_gtm_inner_type Ident set_parm_general_options  */
+#line 1141 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_GTM;
+				node->nodetype = (yyvsp[-2].ival);
+				node->nodename = (yyvsp[-1].str);
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4388 "mgr_gram.c"
+    break;
+
+  case 204: /* AddUpdataparmStmt: SET GTM opt_gtm_inner_type Ident set_parm_general_options FORCE  */
+#line 1151 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_GTM;
+				node->nodetype = (yyvsp[-3].ival);
+				node->nodename = (yyvsp[-2].str);
+				node->options = (yyvsp[-1].list);
+				node->is_force= true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4402 "mgr_gram.c"
+    break;
+
+  case 205: /* AddUpdataparmStmt: SET GTM ALL set_parm_general_options  */
+#line 1161 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_GTM;
+				node->nodetype = CNDN_TYPE_GTM;
+				node->nodename = MACRO_STAND_FOR_ALL_NODENAME;
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4416 "mgr_gram.c"
+    break;
+
+  case 206: /* AddUpdataparmStmt: SET GTM ALL set_parm_general_options FORCE  */
+#line 1171 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_GTM;
+				node->nodetype = CNDN_TYPE_GTM;
+				node->nodename = MACRO_STAND_FOR_ALL_NODENAME;
+				node->options = (yyvsp[-1].list);
+				node->is_force= true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4430 "mgr_gram.c"
+    break;
+
+  case 207: /* AddUpdataparmStmt: SET DATANODE opt_dn_inner_type set_ident set_parm_general_options  */
+#line 1181 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_DATANODE;
+				node->nodetype = (yyvsp[-2].ival);
+				node->nodename = (yyvsp[-1].str);
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4444 "mgr_gram.c"
+    break;
+
+  case 208: /* AddUpdataparmStmt: SET DATANODE opt_dn_inner_type set_ident set_parm_general_options FORCE  */
+#line 1191 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_DATANODE;
+				node->nodetype = (yyvsp[-3].ival);
+				node->nodename = (yyvsp[-2].str);
+				node->options = (yyvsp[-1].list);
+				node->is_force = true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4458 "mgr_gram.c"
+    break;
+
+  case 209: /* AddUpdataparmStmt: SET DATANODE ALL set_parm_general_options  */
+#line 1201 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_DATANODE;
+				node->nodetype = CNDN_TYPE_DATANODE;
+				node->nodename = MACRO_STAND_FOR_ALL_NODENAME;
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4472 "mgr_gram.c"
+    break;
+
+  case 210: /* AddUpdataparmStmt: SET DATANODE ALL set_parm_general_options FORCE  */
+#line 1211 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_DATANODE;
+				node->nodetype = CNDN_TYPE_DATANODE;
+				node->nodename = MACRO_STAND_FOR_ALL_NODENAME;
+				node->options = (yyvsp[-1].list);
+				node->is_force = true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4486 "mgr_gram.c"
+    break;
+
+  case 211: /* AddUpdataparmStmt: SET COORDINATOR set_ident set_parm_general_options  */
+#line 1221 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_COORDINATOR;
+				node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+				node->nodename = (yyvsp[-1].str);
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4500 "mgr_gram.c"
+    break;
+
+  case 212: /* AddUpdataparmStmt: SET COORDINATOR set_ident set_parm_general_options FORCE  */
+#line 1231 "mgr_gram.y"
+                {
+				MGRUpdateparm *node = makeNode(MGRUpdateparm);
+				node->parmtype = PARM_TYPE_COORDINATOR;
+				node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+				node->nodename = (yyvsp[-2].str);
+				node->options = (yyvsp[-1].list);
+				node->is_force = true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4514 "mgr_gram.c"
+    break;
+
+  case 213: /* AddUpdataparmStmt: SET CLUSTER INIT  */
+#line 1241 "mgr_gram.y"
+                {
+			MGRSetClusterInit *node = makeNode(MGRSetClusterInit);
+			(yyval.node) = (Node*)node;
+		}
+#line 4523 "mgr_gram.c"
+    break;
+
+  case 214: /* ResetUpdataparmStmt: RESET GTM opt_gtm_inner_type Ident set_parm_general_options  */
+#line 1248 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_GTM;
+				node->nodetype = (yyvsp[-2].ival);
+				node->nodename = (yyvsp[-1].str);
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4537 "mgr_gram.c"
+    break;
+
+  case 215: /* ResetUpdataparmStmt: RESET GTM opt_gtm_inner_type Ident set_parm_general_options FORCE  */
+#line 1258 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_GTM;
+				node->nodetype = (yyvsp[-3].ival);
+				node->nodename = (yyvsp[-2].str);
+				node->options = (yyvsp[-1].list);
+				node->is_force = true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4551 "mgr_gram.c"
+    break;
+
+  case 216: /* ResetUpdataparmStmt: RESET GTM ALL set_parm_general_options  */
+#line 1268 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_GTM;
+				node->nodetype = CNDN_TYPE_GTM;
+				node->nodename = MACRO_STAND_FOR_ALL_NODENAME;
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4565 "mgr_gram.c"
+    break;
+
+  case 217: /* ResetUpdataparmStmt: RESET GTM ALL set_parm_general_options FORCE  */
+#line 1278 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_GTM;
+				node->nodetype = CNDN_TYPE_GTM;
+				node->nodename = MACRO_STAND_FOR_ALL_NODENAME;
+				node->options = (yyvsp[-1].list);
+				node->is_force = true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4579 "mgr_gram.c"
+    break;
+
+  case 218: /* ResetUpdataparmStmt: RESET DATANODE opt_dn_inner_type set_ident set_parm_general_options  */
+#line 1288 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_DATANODE;
+				node->nodetype = (yyvsp[-2].ival);
+				node->nodename = (yyvsp[-1].str);
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4593 "mgr_gram.c"
+    break;
+
+  case 219: /* ResetUpdataparmStmt: RESET DATANODE opt_dn_inner_type set_ident set_parm_general_options FORCE  */
+#line 1298 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_DATANODE;
+				node->nodetype = (yyvsp[-3].ival);
+				node->nodename = (yyvsp[-2].str);
+				node->options = (yyvsp[-1].list);
+				node->is_force = true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4607 "mgr_gram.c"
+    break;
+
+  case 220: /* ResetUpdataparmStmt: RESET DATANODE ALL set_parm_general_options  */
+#line 1308 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_DATANODE;
+				node->nodetype = CNDN_TYPE_DATANODE;
+				node->nodename = MACRO_STAND_FOR_ALL_NODENAME;
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4621 "mgr_gram.c"
+    break;
+
+  case 221: /* ResetUpdataparmStmt: RESET DATANODE ALL set_parm_general_options FORCE  */
+#line 1318 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_DATANODE;
+				node->nodetype = CNDN_TYPE_DATANODE;
+				node->nodename = MACRO_STAND_FOR_ALL_NODENAME;
+				node->options = (yyvsp[-1].list);
+				node->is_force = true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4635 "mgr_gram.c"
+    break;
+
+  case 222: /* ResetUpdataparmStmt: RESET COORDINATOR set_ident set_parm_general_options  */
+#line 1328 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_COORDINATOR;
+				node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+				node->nodename = (yyvsp[-1].str);
+				node->options = (yyvsp[0].list);
+				node->is_force = false;
+				(yyval.node) = (Node*)node;
+		}
+#line 4649 "mgr_gram.c"
+    break;
+
+  case 223: /* ResetUpdataparmStmt: RESET COORDINATOR set_ident set_parm_general_options FORCE  */
+#line 1338 "mgr_gram.y"
+                {
+				MGRUpdateparmReset *node = makeNode(MGRUpdateparmReset);
+				node->parmtype = PARM_TYPE_COORDINATOR;
+				node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+				node->nodename = (yyvsp[-2].str);
+				node->options = (yyvsp[-1].list);
+				node->is_force = true;
+				(yyval.node) = (Node*)node;
+		}
+#line 4663 "mgr_gram.c"
+    break;
+
+  case 224: /* ListParmStmt: LIST PARAM  */
+#line 1351 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("updateparm"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4674 "mgr_gram.c"
+    break;
+
+  case 225: /* ListParmStmt: LIST PARAM node_type Ident sub_like_expr  */
+#line 1358 "mgr_gram.y"
+                {
+			StringInfoData like_expr;
+			List* node_name;
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("updateparm"), -1));
+
+			node_name = (List*)list_make1(makeStringConst((yyvsp[-1].str), -1));
+			check_node_name_isvaild((yyvsp[-2].chr), node_name);
+
+			initStringInfo(&like_expr);
+			if (strcmp((yyvsp[0].str), "NULL") == 0)
+				appendStringInfo(&like_expr, "%%%%");
+			else
+				appendStringInfo(&like_expr, "%%%s%%", (yyvsp[0].str));
+			switch ((yyvsp[-2].chr))
+			{
+				case CNDN_TYPE_DATANODE_MASTER:
+						stmt->whereClause = make_whereClause_for_datanode("datanode master", node_name, like_expr.data);
+						break;
+				case CNDN_TYPE_DATANODE_SLAVE:
+						stmt->whereClause = make_whereClause_for_datanode("datanode slave", node_name, like_expr.data);
+						break;
+				case CNDN_TYPE_DATANODE_EXTRA:
+						stmt->whereClause = make_whereClause_for_datanode("datanode extra", node_name, like_expr.data);
+						break;
+				case CNDN_TYPE_COORDINATOR_MASTER:
+						stmt->whereClause = make_whereClause_for_coord("coordinator", node_name, like_expr.data);
+						break;
+				case GTM_TYPE_GTM_MASTER:
+						stmt->whereClause = make_whereClause_for_gtm("gtm master", node_name, like_expr.data);
+						break;
+				case GTM_TYPE_GTM_SLAVE:
+						stmt->whereClause = make_whereClause_for_gtm("gtm slave", node_name, like_expr.data);
+						break;
+				case GTM_TYPE_GTM_EXTRA:
+						stmt->whereClause = make_whereClause_for_gtm("gtm extra", node_name, like_expr.data);
+						break;
+				default:
+						break;
+			}
+
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4723 "mgr_gram.c"
+    break;
+
+  case 226: /* ListParmStmt: LIST PARAM cluster_type ALL sub_like_expr  */
+#line 1403 "mgr_gram.y"
+        {
+			StringInfoData like_expr;
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("updateparm"), -1));
+
+			initStringInfo(&like_expr);
+
+			if (strcmp((yyvsp[0].str), "NULL") == 0)
+				appendStringInfo(&like_expr, "%%%%");
+			else
+				appendStringInfo(&like_expr, "%%%s%%", (yyvsp[0].str));
+
+			switch ((yyvsp[-2].chr))
+			{
+				case GTM_TYPE:
+					stmt->whereClause =
+						(Node *)(Node *)makeA_Expr(AEXPR_AND, NIL,
+							(Node *) makeSimpleA_Expr(AEXPR_OP, "~",
+									make_ColumnRef("nodetype"), 
+									makeStringConst(pstrdup("gtm"), -1), -1),
+							(Node *) makeSimpleA_Expr(AEXPR_OP, "~~",
+									make_ColumnRef("key"),
+									makeStringConst(pstrdup(like_expr.data), -1), -1),
+									-1);
+					break;
+				case COORDINATOR_TYPE:
+					stmt->whereClause =
+						(Node *)(Node *)makeA_Expr(AEXPR_AND, NIL,
+							(Node *) makeSimpleA_Expr(AEXPR_OP, "~",
+									make_ColumnRef("nodetype"),
+									makeStringConst(pstrdup("coordinator"), -1), -1),
+							(Node *) makeSimpleA_Expr(AEXPR_OP, "~~",
+									make_ColumnRef("key"),
+									makeStringConst(pstrdup(like_expr.data), -1), -1),
+									-1);
+					break;
+				case DATANODE_TYPE:
+					stmt->whereClause =
+						(Node *)(Node *)makeA_Expr(AEXPR_AND, NIL,
+							(Node *) makeSimpleA_Expr(AEXPR_OP, "~",
+									make_ColumnRef("nodetype"),
+									makeStringConst(pstrdup("datanode"), -1), -1),
+							(Node *) makeSimpleA_Expr(AEXPR_OP, "~~",
+									make_ColumnRef("key"),
+									makeStringConst(pstrdup(like_expr.data), -1), -1),
+									-1);
+					break;
+				case CNDN_TYPE_DATANODE_MASTER:
+					stmt->whereClause =
+					(Node *)makeA_Expr(AEXPR_AND, NIL,
+						(Node *) makeSimpleA_Expr(AEXPR_OP, "~",
+								make_ColumnRef("nodetype"),
+								makeStringConst(pstrdup("datanode master"), -1),-1),
+						(Node *) makeSimpleA_Expr(AEXPR_OP, "~~",
+										make_ColumnRef("key"),
+										makeStringConst(pstrdup(like_expr.data), -1), -1),
+										-1);
+					break;
+				case CNDN_TYPE_DATANODE_SLAVE:
+					stmt->whereClause =
+					(Node *)makeA_Expr(AEXPR_AND, NIL,
+						(Node *)makeA_Expr(AEXPR_OR, NIL,
+							(Node *) makeSimpleA_Expr(AEXPR_OP, "~",
+										make_ColumnRef("nodetype"),
+										makeStringConst(pstrdup("datanode slave"), -1),-1),
+							(Node *) makeA_Expr(AEXPR_AND, NIL,
+								(Node *) makeSimpleA_Expr(AEXPR_OP, "=",
+											make_ColumnRef("nodename"),
+											makeStringConst(pstrdup("*"), -1), -1),
+								(Node *) makeSimpleA_Expr(AEXPR_OP, "~",
+											make_ColumnRef("nodetype"),
+											makeStringConst(pstrdup("datanode master"), -1), -1),
+											-1),-1),
+						(Node *)makeSimpleA_Expr(AEXPR_OP, "~~",
+								make_ColumnRef("key"),
+								makeStringConst(pstrdup(like_expr.data), -1), -1),
+								-1);
+					break;
+				case CNDN_TYPE_DATANODE_EXTRA:
+					stmt->whereClause =
+					(Node *)makeA_Expr(AEXPR_AND, NIL,
+					(Node *)makeA_Expr(AEXPR_OR, NIL,
+							(Node *) makeSimpleA_Expr(AEXPR_OP, "~",
+										make_ColumnRef("nodetype"),
+										makeStringConst(pstrdup("datanode extra"), -1),-1),
+							(Node *) makeA_Expr(AEXPR_AND, NIL,
+								(Node *) makeSimpleA_Expr(AEXPR_OP, "=",
+											make_ColumnRef("nodename"),
+											makeStringConst(pstrdup("*"), -1), -1),
+								(Node *) makeSimpleA_Expr(AEXPR_OP, "~",
+											make_ColumnRef("nodetype"),
+											makeStringConst(pstrdup("datanode master"), -1), -1),
+											-1),-1),
+					(Node *)makeSimpleA_Expr(AEXPR_OP, "~~",
+								make_ColumnRef("key"),
+								makeStringConst(pstrdup(like_expr.data), -1), -1),
+								-1);
+					break;
+				default:
+					break;
+			}
+
+			(yyval.node) = (Node*)stmt;
+	}
+#line 4833 "mgr_gram.c"
+    break;
+
+  case 227: /* CleanAllStmt: CLEAN ALL  */
+#line 1514 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_clean_all", NULL));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4844 "mgr_gram.c"
+    break;
+
+  case 228: /* CleanAllStmt: CLEAN GTM opt_gtm_inner_type Ident  */
+#line 1521 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), -1));
+			args = lappend(args,makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_clean_node", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4857 "mgr_gram.c"
+    break;
+
+  case 229: /* CleanAllStmt: CLEAN COORDINATOR NodeConstList  */
+#line 1530 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst(CNDN_TYPE_COORDINATOR_MASTER, -1));
+			args = list_concat(args, (yyvsp[0].list));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_clean_node", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4870 "mgr_gram.c"
+    break;
+
+  case 230: /* CleanAllStmt: CLEAN DATANODE opt_dn_inner_type NodeConstList  */
+#line 1539 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), -1));
+			args = list_concat(args, (yyvsp[0].list));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_clean_node", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 4883 "mgr_gram.c"
+    break;
+
+  case 231: /* CleanAllStmt: CLEAN MONITOR ICONST  */
+#line 1548 "mgr_gram.y"
+                {
+			MonitorDeleteData *node = makeNode(MonitorDeleteData);
+			node->days = (yyvsp[0].ival);
+			(yyval.node) = (Node*)node;
+		}
+#line 4893 "mgr_gram.c"
+    break;
+
+  case 232: /* AddHbaStmt: ADD_P HBA set_ident '(' NodeConstList ')'  */
+#line 1558 "mgr_gram.y"
+        {
+		SelectStmt *stmt = makeNode(SelectStmt);	
+		List *args = lappend((yyvsp[-1].list), makeStringConst((yyvsp[-3].str),(yylsp[-3])));
+		stmt->targetList = list_make1(make_star_target(-1));
+		stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_add_hba", args));
+		(yyval.node) = (Node*)stmt;
+	}
+#line 4905 "mgr_gram.c"
+    break;
+
+  case 233: /* DropHbaStmt: DROP HBA set_ident HbaParaList  */
+#line 1568 "mgr_gram.y"
+        {
+		SelectStmt *stmt = makeNode(SelectStmt);	
+		List *args = lappend((yyvsp[0].list), makeStringConst((yyvsp[-1].str),(yylsp[-1])));		
+		stmt->targetList = list_make1(make_star_target(-1));
+		stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_drop_hba", args));
+		(yyval.node) = (Node*)stmt;
+	}
+#line 4917 "mgr_gram.c"
+    break;
+
+  case 234: /* ListHbaStmt: LIST HBA  */
+#line 1578 "mgr_gram.y"
+        {
+		SelectStmt *stmt = makeNode(SelectStmt);
+		stmt->targetList = list_make1(make_star_target(-1));
+		stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("hba"), -1));
+		(yyval.node) = (Node*)stmt;
+	}
+#line 4928 "mgr_gram.c"
+    break;
+
+  case 235: /* ListHbaStmt: LIST HBA NodeConstList  */
+#line 1585 "mgr_gram.y"
+        {
+		SelectStmt *stmt = makeNode(SelectStmt);
+		stmt->targetList = list_make1(make_star_target(-1));
+		stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_list_hba_by_name", (yyvsp[0].list)));
+		(yyval.node) = (Node*)stmt;
+	}
+#line 4939 "mgr_gram.c"
+    break;
+
+  case 236: /* HbaParaList: '(' NodeConstList ')'  */
+#line 1593 "mgr_gram.y"
+                                {(yyval.list) = (yyvsp[-1].list);}
+#line 4945 "mgr_gram.c"
+    break;
+
+  case 237: /* HbaParaList: %empty  */
+#line 1594 "mgr_gram.y"
+                                {(yyval.list) = NIL;}
+#line 4951 "mgr_gram.c"
+    break;
+
+  case 238: /* AddNodeStmt: ADD_P GTM opt_gtm_inner_type Ident opt_general_options  */
+#line 1603 "mgr_gram.y"
+                {
+			MGRAddNode *node = makeNode(MGRAddNode);
+			node->if_not_exists = false;
+			node->nodetype = (yyvsp[-2].ival); 
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 4964 "mgr_gram.c"
+    break;
+
+  case 239: /* AddNodeStmt: ADD_P GTM opt_gtm_inner_type IF_P NOT EXISTS Ident opt_general_options  */
+#line 1612 "mgr_gram.y"
+                {
+			MGRAddNode *node = makeNode(MGRAddNode);
+			node->if_not_exists = true;
+			node->nodetype = (yyvsp[-5].ival);
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 4977 "mgr_gram.c"
+    break;
+
+  case 240: /* AddNodeStmt: ADD_P COORDINATOR Ident opt_general_options  */
+#line 1621 "mgr_gram.y"
+                {
+			MGRAddNode *node = makeNode(MGRAddNode);
+			node->if_not_exists = false;
+			node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 4990 "mgr_gram.c"
+    break;
+
+  case 241: /* AddNodeStmt: ADD_P COORDINATOR IF_P NOT EXISTS Ident opt_general_options  */
+#line 1630 "mgr_gram.y"
+                {
+			MGRAddNode *node = makeNode(MGRAddNode);
+			node->if_not_exists = true;
+			node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5003 "mgr_gram.c"
+    break;
+
+  case 242: /* AddNodeStmt: ADD_P DATANODE opt_dn_inner_type Ident opt_general_options  */
+#line 1639 "mgr_gram.y"
+                {
+			MGRAddNode *node = makeNode(MGRAddNode);
+			node->if_not_exists = false;
+			node->nodetype = (yyvsp[-2].ival);
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5016 "mgr_gram.c"
+    break;
+
+  case 243: /* AddNodeStmt: ADD_P DATANODE opt_dn_inner_type IF_P NOT EXISTS Ident opt_general_options  */
+#line 1648 "mgr_gram.y"
+                {
+			MGRAddNode *node = makeNode(MGRAddNode);
+			node->if_not_exists = true;
+			node->nodetype = (yyvsp[-5].ival);
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5029 "mgr_gram.c"
+    break;
+
+  case 244: /* AlterNodeStmt: ALTER GTM opt_gtm_inner_type Ident opt_general_options  */
+#line 1661 "mgr_gram.y"
+                {
+			MGRAlterNode *node = makeNode(MGRAlterNode);
+			node->if_not_exists = false;
+			node->nodetype = (yyvsp[-2].ival);
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5042 "mgr_gram.c"
+    break;
+
+  case 245: /* AlterNodeStmt: ALTER COORDINATOR Ident opt_general_options  */
+#line 1670 "mgr_gram.y"
+                {
+			MGRAlterNode *node = makeNode(MGRAlterNode);
+			node->if_not_exists = false;
+			node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5055 "mgr_gram.c"
+    break;
+
+  case 246: /* AlterNodeStmt: ALTER DATANODE opt_dn_inner_type Ident opt_general_options  */
+#line 1679 "mgr_gram.y"
+                {
+			MGRAlterNode *node = makeNode(MGRAlterNode);
+			node->if_not_exists = false;
+			node->nodetype = (yyvsp[-2].ival);
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5068 "mgr_gram.c"
+    break;
+
+  case 247: /* DropNodeStmt: DROP GTM opt_gtm_inner_type ObjList  */
+#line 1691 "mgr_gram.y"
+                {
+			MGRDropNode *node = makeNode(MGRDropNode);
+			node->if_exists = false;
+			node->nodetype = (yyvsp[-1].ival);
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5080 "mgr_gram.c"
+    break;
+
+  case 248: /* DropNodeStmt: DROP GTM opt_gtm_inner_type IF_P EXISTS ObjList  */
+#line 1699 "mgr_gram.y"
+                {
+			MGRDropNode *node = makeNode(MGRDropNode);
+			node->if_exists = true;
+			node->nodetype = (yyvsp[-3].ival);
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5092 "mgr_gram.c"
+    break;
+
+  case 249: /* DropNodeStmt: DROP COORDINATOR ObjList  */
+#line 1707 "mgr_gram.y"
+                {
+			MGRDropNode *node = makeNode(MGRDropNode);
+			node->if_exists = false;
+			node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5104 "mgr_gram.c"
+    break;
+
+  case 250: /* DropNodeStmt: DROP COORDINATOR IF_P EXISTS ObjList  */
+#line 1715 "mgr_gram.y"
+                {
+			MGRDropNode *node = makeNode(MGRDropNode);
+			node->if_exists = true;
+			node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5116 "mgr_gram.c"
+    break;
+
+  case 251: /* DropNodeStmt: DROP DATANODE opt_dn_inner_type ObjList  */
+#line 1723 "mgr_gram.y"
+                {
+			MGRDropNode *node = makeNode(MGRDropNode);
+			node->if_exists = false;
+			node->nodetype = (yyvsp[-1].ival);
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5128 "mgr_gram.c"
+    break;
+
+  case 252: /* DropNodeStmt: DROP DATANODE opt_dn_inner_type IF_P EXISTS ObjList  */
+#line 1731 "mgr_gram.y"
+                {
+			MGRDropNode *node = makeNode(MGRDropNode);
+			node->if_exists = true;
+			node->nodetype = (yyvsp[-3].ival);
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 5140 "mgr_gram.c"
+    break;
+
+  case 253: /* ListAclStmt: LIST ACL opt_general_all  */
+#line 1742 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_list_acl_all", NULL));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5151 "mgr_gram.c"
+    break;
+
+  case 254: /* ListNodeStmt: LIST NODE  */
+#line 1752 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5162 "mgr_gram.c"
+    break;
+
+  case 255: /* ListNodeStmt: LIST NODE '(' targetList ')'  */
+#line 1759 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = (yyvsp[-1].list);
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5173 "mgr_gram.c"
+    break;
+
+  case 256: /* ListNodeStmt: LIST NODE AConstList  */
+#line 1766 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			stmt->whereClause = make_column_in("name", (yyvsp[0].list));
+			(yyval.node) = (Node*)stmt;
+
+			check__name_isvaild((yyvsp[0].list));
+		}
+#line 5187 "mgr_gram.c"
+    break;
+
+  case 257: /* ListNodeStmt: LIST NODE '(' targetList ')' AConstList  */
+#line 1776 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = (yyvsp[-2].list);
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			stmt->whereClause = make_column_in("name", (yyvsp[0].list));
+			(yyval.node) = (Node*)stmt;
+
+			check__name_isvaild((yyvsp[0].list));
+		}
+#line 5201 "mgr_gram.c"
+    break;
+
+  case 258: /* ListNodeStmt: LIST NODE COORDINATOR  */
+#line 1786 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst("coordinator", -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			stmt->whereClause = make_column_in("type", args);
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5214 "mgr_gram.c"
+    break;
+
+  case 259: /* ListNodeStmt: LIST NODE DATANODE  */
+#line 1795 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst("datanode master", -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			args = lappend(args,makeStringConst("datanode slave", -1));
+			args = lappend(args,makeStringConst("datanode extra", -1));
+			stmt->whereClause = make_column_in("type", args);
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5229 "mgr_gram.c"
+    break;
+
+  case 260: /* ListNodeStmt: LIST NODE DATANODE MASTER  */
+#line 1806 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst("datanode master", -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			stmt->whereClause = make_column_in("type", args);
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5242 "mgr_gram.c"
+    break;
+
+  case 261: /* ListNodeStmt: LIST NODE DATANODE SLAVE  */
+#line 1815 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst("datanode slave", -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			stmt->whereClause = make_column_in("type", args);
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5255 "mgr_gram.c"
+    break;
+
+  case 262: /* ListNodeStmt: LIST NODE DATANODE EXTRA  */
+#line 1824 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst("datanode extra", -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("node"), -1));
+			stmt->whereClause = make_column_in("type", args);
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5268 "mgr_gram.c"
+    break;
+
+  case 263: /* InitNodeStmt: INIT ALL  */
+#line 1923 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("initall"), -1));
+			with_data_checksums = false;
+			(yyval.node) = (Node*)stmt;
+	}
+#line 5280 "mgr_gram.c"
+    break;
+
+  case 264: /* InitNodeStmt: INIT ALL DATA_CHECKSUMS  */
+#line 1931 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("initall"), -1));
+			with_data_checksums = true;
+			(yyval.node) = (Node*)stmt;
+	}
+#line 5292 "mgr_gram.c"
+    break;
+
+  case 265: /* StartNodeMasterStmt: START GTM MASTER Ident  */
+#line 1941 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_gtm_master", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5304 "mgr_gram.c"
+    break;
+
+  case 266: /* StartNodeMasterStmt: START GTM SLAVE Ident  */
+#line 1949 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_gtm_slave", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5316 "mgr_gram.c"
+    break;
+
+  case 267: /* StartNodeMasterStmt: START GTM EXTRA Ident  */
+#line 1957 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_gtm_extra", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5328 "mgr_gram.c"
+    break;
+
+  case 268: /* StartNodeMasterStmt: START GTM ALL  */
+#line 1965 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("start_gtm_all"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5339 "mgr_gram.c"
+    break;
+
+  case 269: /* StartNodeMasterStmt: START COORDINATOR NodeConstList  */
+#line 1972 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_cn_master", (yyvsp[0].list)));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5350 "mgr_gram.c"
+    break;
+
+  case 270: /* StartNodeMasterStmt: START COORDINATOR ALL  */
+#line 1979 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+		 	List *args = list_make1(makeNullAConst(-1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_cn_master", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5362 "mgr_gram.c"
+    break;
+
+  case 271: /* StartNodeMasterStmt: START DATANODE MASTER NodeConstList  */
+#line 1987 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_dn_master", (yyvsp[0].list)));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5373 "mgr_gram.c"
+    break;
+
+  case 272: /* StartNodeMasterStmt: START DATANODE MASTER ALL  */
+#line 1994 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+		 	List *args = list_make1(makeNullAConst(-1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_dn_master", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5385 "mgr_gram.c"
+    break;
+
+  case 273: /* StartNodeMasterStmt: START DATANODE SLAVE NodeConstList  */
+#line 2002 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_dn_slave", (yyvsp[0].list)));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5396 "mgr_gram.c"
+    break;
+
+  case 274: /* StartNodeMasterStmt: START DATANODE EXTRA NodeConstList  */
+#line 2009 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_dn_extra", (yyvsp[0].list)));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5407 "mgr_gram.c"
+    break;
+
+  case 275: /* StartNodeMasterStmt: START DATANODE SLAVE ALL  */
+#line 2016 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+		 	List *args = list_make1(makeNullAConst(-1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_dn_slave", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5419 "mgr_gram.c"
+    break;
+
+  case 276: /* StartNodeMasterStmt: START DATANODE EXTRA ALL  */
+#line 2024 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+		 	List *args = list_make1(makeNullAConst(-1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_start_dn_extra", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5431 "mgr_gram.c"
+    break;
+
+  case 277: /* StartNodeMasterStmt: START DATANODE ALL  */
+#line 2032 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("start_datanode_all"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5442 "mgr_gram.c"
+    break;
+
+  case 278: /* StartNodeMasterStmt: START ALL  */
+#line 2039 "mgr_gram.y"
+                {
+			mgr_check_job_in_updateparam("monitor_handle_coordinator");
+
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("startall"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5455 "mgr_gram.c"
+    break;
+
+  case 279: /* StopNodeMasterStmt: STOP GTM MASTER Ident opt_stop_mode  */
+#line 2050 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = lappend(args,makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_gtm_master", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5468 "mgr_gram.c"
+    break;
+
+  case 280: /* StopNodeMasterStmt: STOP GTM SLAVE Ident opt_stop_mode  */
+#line 2059 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = lappend(args,makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_gtm_slave", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5481 "mgr_gram.c"
+    break;
+
+  case 281: /* StopNodeMasterStmt: STOP GTM EXTRA Ident opt_stop_mode  */
+#line 2068 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = lappend(args,makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_gtm_extra", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5494 "mgr_gram.c"
+    break;
+
+  case 282: /* StopNodeMasterStmt: STOP GTM ALL opt_stop_mode  */
+#line 2077 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			if (strcmp((yyvsp[0].str), SHUTDOWN_S) == 0)
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stop_gtm_all"), -1));
+			else if (strcmp((yyvsp[0].str), SHUTDOWN_F) == 0)
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stop_gtm_all_f"), -1));
+			else
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stop_gtm_all_i"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5510 "mgr_gram.c"
+    break;
+
+  case 283: /* StopNodeMasterStmt: STOP COORDINATOR NodeConstList opt_stop_mode  */
+#line 2089 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = list_concat(args, (yyvsp[-1].list));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_cn_master", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5523 "mgr_gram.c"
+    break;
+
+  case 284: /* StopNodeMasterStmt: STOP COORDINATOR ALL opt_stop_mode  */
+#line 2098 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = list_concat(args, list_make1(makeNullAConst(-1)));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_cn_master", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5536 "mgr_gram.c"
+    break;
+
+  case 285: /* StopNodeMasterStmt: STOP DATANODE MASTER NodeConstList opt_stop_mode  */
+#line 2107 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = list_concat(args, (yyvsp[-1].list));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_dn_master", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5549 "mgr_gram.c"
+    break;
+
+  case 286: /* StopNodeMasterStmt: STOP DATANODE MASTER ALL opt_stop_mode  */
+#line 2116 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = list_concat(args, list_make1(makeNullAConst(-1)));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_dn_master", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5562 "mgr_gram.c"
+    break;
+
+  case 287: /* StopNodeMasterStmt: STOP DATANODE SLAVE NodeConstList opt_stop_mode  */
+#line 2125 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = list_concat(args, (yyvsp[-1].list));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_dn_slave", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5575 "mgr_gram.c"
+    break;
+
+  case 288: /* StopNodeMasterStmt: STOP DATANODE SLAVE ALL opt_stop_mode  */
+#line 2134 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = list_concat(args, list_make1(makeNullAConst(-1)));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_dn_slave", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5588 "mgr_gram.c"
+    break;
+
+  case 289: /* StopNodeMasterStmt: STOP DATANODE EXTRA NodeConstList opt_stop_mode  */
+#line 2143 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = list_concat(args, (yyvsp[-1].list));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_dn_extra", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5601 "mgr_gram.c"
+    break;
+
+  case 290: /* StopNodeMasterStmt: STOP DATANODE EXTRA ALL opt_stop_mode  */
+#line 2152 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			args = list_concat(args, list_make1(makeNullAConst(-1)));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_stop_dn_extra", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5614 "mgr_gram.c"
+    break;
+
+  case 291: /* StopNodeMasterStmt: STOP DATANODE ALL opt_stop_mode  */
+#line 2162 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			if (strcmp((yyvsp[0].str), SHUTDOWN_S) == 0)
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stop_datanode_all"), -1));
+			else if (strcmp((yyvsp[0].str), SHUTDOWN_F) == 0)
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stop_datanode_all_f"), -1));
+			else
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stop_datanode_all_i"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5630 "mgr_gram.c"
+    break;
+
+  case 292: /* StopNodeMasterStmt: STOP ALL opt_stop_mode  */
+#line 2174 "mgr_gram.y"
+                {
+			mgr_check_job_in_updateparam("monitor_handle_coordinator");
+
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			if (strcmp((yyvsp[0].str), SHUTDOWN_S) == 0)
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stopall"), -1));
+			else if (strcmp((yyvsp[0].str), SHUTDOWN_F) == 0)
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stopall_f"), -1));
+			else
+				stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("stopall_i"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5648 "mgr_gram.c"
+    break;
+
+  case 293: /* FailoverStmt: FAILOVER DATANODE SLAVE Ident opt_general_force  */
+#line 2190 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst("slave", -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			args = lappend(args, makeBoolAConst((yyvsp[0].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_one_dn", args));
+			(yyval.node) = (Node*)stmt;
+	}
+#line 5662 "mgr_gram.c"
+    break;
+
+  case 294: /* FailoverStmt: FAILOVER DATANODE EXTRA Ident opt_general_force  */
+#line 2200 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst("extra", -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			args = lappend(args, makeBoolAConst((yyvsp[0].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_one_dn", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5676 "mgr_gram.c"
+    break;
+
+  case 295: /* FailoverStmt: FAILOVER DATANODE Ident opt_general_force  */
+#line 2210 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst("either", -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			args = lappend(args, makeBoolAConst((yyvsp[0].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_one_dn", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5690 "mgr_gram.c"
+    break;
+
+  case 296: /* FailoverStmt: FAILOVER GTM SLAVE Ident opt_general_force  */
+#line 2220 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-1].str), -1));
+			args = lappend(args, makeStringConst("slave", -1));
+			args = lappend(args, makeBoolAConst((yyvsp[0].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_gtm", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5704 "mgr_gram.c"
+    break;
+
+  case 297: /* FailoverStmt: FAILOVER GTM EXTRA Ident opt_general_force  */
+#line 2230 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-1].str), -1));
+			args = lappend(args, makeStringConst("extra", -1));
+			args = lappend(args, makeBoolAConst((yyvsp[0].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_gtm", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5718 "mgr_gram.c"
+    break;
+
+  case 298: /* FailoverStmt: FAILOVER GTM Ident opt_general_force  */
+#line 2240 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-1].str), -1));
+			args = lappend(args, makeStringConst("either", -1));
+			args = lappend(args, makeBoolAConst((yyvsp[0].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_gtm", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5732 "mgr_gram.c"
+    break;
+
+  case 299: /* opt_general_force: FORCE  */
+#line 2251 "mgr_gram.y"
+                        {(yyval.ival) = TRUE;}
+#line 5738 "mgr_gram.c"
+    break;
+
+  case 300: /* opt_general_force: %empty  */
+#line 2252 "mgr_gram.y"
+                        {(yyval.ival) = FALSE;}
+#line 5744 "mgr_gram.c"
+    break;
+
+  case 301: /* DeploryStmt: DEPLOY ALL opt_password  */
+#line 2257 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[0].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_deploy_all", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5756 "mgr_gram.c"
+    break;
+
+  case 302: /* DeploryStmt: DEPLOY hostname_list opt_password  */
+#line 2265 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			Node *password = makeStringConst((yyvsp[0].str), -1);
+			Node *hostnames = makeAArrayExpr((yyvsp[-1].list), (yylsp[-1]));
+			List *args = list_make2(password, hostnames);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_deploy_hostnamelist", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 5770 "mgr_gram.c"
+    break;
+
+  case 303: /* opt_password: PASSWORD SConst  */
+#line 2277 "mgr_gram.y"
+                                        { (yyval.str) = (yyvsp[0].str); }
+#line 5776 "mgr_gram.c"
+    break;
+
+  case 304: /* opt_password: PASSWORD ColLabel  */
+#line 2278 "mgr_gram.y"
+                                        { (yyval.str) = (yyvsp[0].str); }
+#line 5782 "mgr_gram.c"
+    break;
+
+  case 305: /* opt_password: %empty  */
+#line 2279 "mgr_gram.y"
+                                        { (yyval.str) = NULL; }
+#line 5788 "mgr_gram.c"
+    break;
+
+  case 306: /* opt_stop_mode: MODE SMART  */
+#line 2282 "mgr_gram.y"
+                                        { (yyval.str) = pstrdup(SHUTDOWN_S); }
+#line 5794 "mgr_gram.c"
+    break;
+
+  case 307: /* opt_stop_mode: MODE S  */
+#line 2283 "mgr_gram.y"
+                                        { (yyval.str) = pstrdup(SHUTDOWN_S); }
+#line 5800 "mgr_gram.c"
+    break;
+
+  case 308: /* opt_stop_mode: %empty  */
+#line 2284 "mgr_gram.y"
+                                { (yyval.str) = pstrdup(SHUTDOWN_S); }
+#line 5806 "mgr_gram.c"
+    break;
+
+  case 309: /* opt_stop_mode: MODE FAST  */
+#line 2285 "mgr_gram.y"
+                        { (yyval.str) = pstrdup(SHUTDOWN_F); }
+#line 5812 "mgr_gram.c"
+    break;
+
+  case 310: /* opt_stop_mode: MODE F  */
+#line 2286 "mgr_gram.y"
+                        { (yyval.str) = pstrdup(SHUTDOWN_F); }
+#line 5818 "mgr_gram.c"
+    break;
+
+  case 311: /* opt_stop_mode: MODE IMMEDIATE  */
+#line 2287 "mgr_gram.y"
+                                        { (yyval.str) = pstrdup(SHUTDOWN_I); }
+#line 5824 "mgr_gram.c"
+    break;
+
+  case 312: /* opt_stop_mode: MODE I  */
+#line 2288 "mgr_gram.y"
+                                        { (yyval.str) = pstrdup(SHUTDOWN_I); }
+#line 5830 "mgr_gram.c"
+    break;
+
+  case 313: /* opt_gtm_inner_type: MASTER  */
+#line 2292 "mgr_gram.y"
+                 { (yyval.ival) = GTM_TYPE_GTM_MASTER; }
+#line 5836 "mgr_gram.c"
+    break;
+
+  case 314: /* opt_gtm_inner_type: SLAVE  */
+#line 2293 "mgr_gram.y"
+                { (yyval.ival) = GTM_TYPE_GTM_SLAVE; }
+#line 5842 "mgr_gram.c"
+    break;
+
+  case 315: /* opt_gtm_inner_type: EXTRA  */
+#line 2294 "mgr_gram.y"
+                { (yyval.ival) = GTM_TYPE_GTM_EXTRA; }
+#line 5848 "mgr_gram.c"
+    break;
+
+  case 316: /* opt_dn_inner_type: MASTER  */
+#line 2297 "mgr_gram.y"
+                { (yyval.ival) = CNDN_TYPE_DATANODE_MASTER; }
+#line 5854 "mgr_gram.c"
+    break;
+
+  case 317: /* opt_dn_inner_type: SLAVE  */
+#line 2298 "mgr_gram.y"
+               { (yyval.ival) = CNDN_TYPE_DATANODE_SLAVE; }
+#line 5860 "mgr_gram.c"
+    break;
+
+  case 318: /* opt_dn_inner_type: EXTRA  */
+#line 2299 "mgr_gram.y"
+                { (yyval.ival) = CNDN_TYPE_DATANODE_EXTRA; }
+#line 5866 "mgr_gram.c"
+    break;
+
+  case 319: /* opt_slave_inner_type: GTM SLAVE  */
+#line 2302 "mgr_gram.y"
+                          { (yyval.ival) = GTM_TYPE_GTM_SLAVE; }
+#line 5872 "mgr_gram.c"
+    break;
+
+  case 320: /* opt_slave_inner_type: GTM EXTRA  */
+#line 2303 "mgr_gram.y"
+                          { (yyval.ival) = GTM_TYPE_GTM_EXTRA; }
+#line 5878 "mgr_gram.c"
+    break;
+
+  case 321: /* opt_slave_inner_type: DATANODE SLAVE  */
+#line 2304 "mgr_gram.y"
+                               { (yyval.ival) = CNDN_TYPE_DATANODE_SLAVE; }
+#line 5884 "mgr_gram.c"
+    break;
+
+  case 322: /* opt_slave_inner_type: DATANODE EXTRA  */
+#line 2305 "mgr_gram.y"
+                               { (yyval.ival) = CNDN_TYPE_DATANODE_EXTRA; }
+#line 5890 "mgr_gram.c"
+    break;
+
+  case 323: /* cluster_type: GTM  */
+#line 2309 "mgr_gram.y"
+                          {(yyval.chr) = GTM_TYPE;}
+#line 5896 "mgr_gram.c"
+    break;
+
+  case 324: /* cluster_type: COORDINATOR  */
+#line 2310 "mgr_gram.y"
+                          {(yyval.chr) = COORDINATOR_TYPE;}
+#line 5902 "mgr_gram.c"
+    break;
+
+  case 325: /* cluster_type: DATANODE  */
+#line 2311 "mgr_gram.y"
+                          {(yyval.chr) = DATANODE_TYPE;}
+#line 5908 "mgr_gram.c"
+    break;
+
+  case 326: /* cluster_type: DATANODE MASTER  */
+#line 2312 "mgr_gram.y"
+                          {(yyval.chr) = CNDN_TYPE_DATANODE_MASTER;}
+#line 5914 "mgr_gram.c"
+    break;
+
+  case 327: /* cluster_type: DATANODE SLAVE  */
+#line 2313 "mgr_gram.y"
+                          {(yyval.chr) = CNDN_TYPE_DATANODE_SLAVE;}
+#line 5920 "mgr_gram.c"
+    break;
+
+  case 328: /* cluster_type: DATANODE EXTRA  */
+#line 2314 "mgr_gram.y"
+                          {(yyval.chr) = CNDN_TYPE_DATANODE_EXTRA;}
+#line 5926 "mgr_gram.c"
+    break;
+
+  case 329: /* sub_like_expr: Ident  */
+#line 2318 "mgr_gram.y"
+                          { (yyval.str) = (yyvsp[0].str);}
+#line 5932 "mgr_gram.c"
+    break;
+
+  case 330: /* sub_like_expr: %empty  */
+#line 2319 "mgr_gram.y"
+                          { (yyval.str) = pstrdup("NULL");}
+#line 5938 "mgr_gram.c"
+    break;
+
+  case 331: /* ListMonitor: GET_CLUSTER_HEADPAGE_LINE  */
+#line 2324 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("monitor_cluster_firstline_v"), -1));
+			(yyval.node) = (Node*)stmt;
+	}
+#line 5949 "mgr_gram.c"
+    break;
+
+  case 332: /* ListMonitor: GET_CLUSTER_TPS_QPS  */
+#line 2331 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("monitor_12hours_tpsqps_v"), -1));
+			(yyval.node) = (Node*)stmt;
+	}
+#line 5960 "mgr_gram.c"
+    break;
+
+  case 333: /* ListMonitor: GET_CLUSTER_CONNECT_DBSIZE_INDEXSIZE  */
+#line 2338 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("monitor_12hours_connect_dbsize_indexsize_v"), -1));
+			(yyval.node) = (Node*)stmt;
+	}
+#line 5971 "mgr_gram.c"
+    break;
+
+  case 334: /* ListMonitor: GET_CLUSTER_SUMMARY  */
+#line 2345 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("monitor_cluster_summary_v"), -1));
+			(yyval.node) = (Node*)stmt;
+	}
+#line 5982 "mgr_gram.c"
+    break;
+
+  case 335: /* ListMonitor: GET_DATABASE_TPS_QPS  */
+#line 2352 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("monitor_all_dbname_tps_qps_runtime_v"), -1));
+			(yyval.node) = (Node*)stmt;
+	}
+#line 5993 "mgr_gram.c"
+    break;
+
+  case 336: /* ListMonitor: GET_DATABASE_TPS_QPS_INTERVAL_TIME '(' Ident ',' Ident ',' SignedIconst ')'  */
+#line 2359 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-5].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-3].str), -1));
+			args = lappend(args, makeIntConst((yyvsp[-1].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_databasetps_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6007 "mgr_gram.c"
+    break;
+
+  case 337: /* ListMonitor: MONITOR_DATABASETPS_FUNC_BY_TIME_PERIOD '(' Ident ',' Ident ',' Ident ')'  */
+#line 2369 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-5].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-3].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_databasetps_func_by_time_period", args));
+			(yyval.node) = (Node*)stmt;
+	}
+#line 6021 "mgr_gram.c"
+    break;
+
+  case 338: /* ListMonitor: GET_DATABASE_SUMMARY '(' Ident ')'  */
+#line 2379 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_databasesummary_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6033 "mgr_gram.c"
+    break;
+
+  case 339: /* ListMonitor: GET_SLOWLOG '(' Ident ',' Ident ',' Ident ',' SignedIconst ',' SignedIconst ')'  */
+#line 2387 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-9].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-7].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-5].str), -1));
+			args = lappend(args, makeIntConst((yyvsp[-3].ival), -1));
+			args = lappend(args, makeIntConst((yyvsp[-1].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_slowlog_func_page", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6049 "mgr_gram.c"
+    break;
+
+  case 340: /* ListMonitor: GET_SLOWLOG_COUNT '(' Ident ',' Ident ',' Ident ')'  */
+#line 2399 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-5].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-3].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_slowlog_count_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6063 "mgr_gram.c"
+    break;
+
+  case 341: /* ListMonitor: CHECK_USER '(' Ident ',' Ident ')'  */
+#line 2409 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeStringConst((yyvsp[-3].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_checkuser_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6076 "mgr_gram.c"
+    break;
+
+  case 342: /* ListMonitor: GET_USER_INFO SignedIconst  */
+#line 2418 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[0].ival), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_getuserinfo_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6088 "mgr_gram.c"
+    break;
+
+  case 343: /* ListMonitor: UPDATE_USER SignedIconst '(' Ident ',' Ident ',' Ident ',' Ident ',' Ident ',' Ident ')'  */
+#line 2426 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-13].ival), -1));
+			args = lappend(args, makeStringConst((yyvsp[-11].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-9].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-7].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-5].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-3].str), -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_updateuserinfo_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6106 "mgr_gram.c"
+    break;
+
+  case 344: /* ListMonitor: CHECK_PASSWORD '(' SignedIconst ',' Ident ')'  */
+#line 2440 "mgr_gram.y"
+        {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-3].ival), -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_checkuserpassword_func", args));
+			(yyval.node) = (Node*)stmt;
+	}
+#line 6119 "mgr_gram.c"
+    break;
+
+  case 345: /* ListMonitor: UPDATE_PASSWORD SignedIconst '(' Ident ')'  */
+#line 2449 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-3].ival), -1));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("monitor_updateuserpassword_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6132 "mgr_gram.c"
+    break;
+
+  case 346: /* ShowStmt: SHOW Ident var_showparam  */
+#line 2461 "mgr_gram.y"
+        {
+		SelectStmt *stmt = makeNode(SelectStmt);
+		List *args = list_make1(makeStringConst((yyvsp[-1].str), (yylsp[-1])));
+		args = lappend(args, makeStringConst((yyvsp[0].str), (yylsp[0])));
+		stmt->targetList = list_make1(make_star_target(-1));
+		stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_show_var_param", args));
+		(yyval.node) = (Node*)stmt;
+	}
+#line 6145 "mgr_gram.c"
+    break;
+
+  case 347: /* FlushHost: FLUSH HOST  */
+#line 2473 "mgr_gram.y"
+        {
+		MGRFlushHost *node = makeNode(MGRFlushHost);
+		(yyval.node) = (Node*)node;
+	}
+#line 6154 "mgr_gram.c"
+    break;
+
+  case 348: /* AddJobitemStmt: ADD_P ITEM Ident opt_general_options  */
+#line 2480 "mgr_gram.y"
+        {
+			MonitorJobitemAdd *node = makeNode(MonitorJobitemAdd);
+			node->if_not_exists = false;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+	}
+#line 6166 "mgr_gram.c"
+    break;
+
+  case 349: /* AddJobitemStmt: ADD_P ITEM IF_P NOT EXISTS Ident opt_general_options  */
+#line 2488 "mgr_gram.y"
+        {
+			MonitorJobitemAdd *node = makeNode(MonitorJobitemAdd);
+			node->if_not_exists = true;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+	}
+#line 6178 "mgr_gram.c"
+    break;
+
+  case 350: /* AddJobitemStmt: ADD_P JOB Ident opt_general_options  */
+#line 2496 "mgr_gram.y"
+        {
+			MonitorJobAdd *node = makeNode(MonitorJobAdd);
+			node->if_not_exists = false;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+	}
+#line 6190 "mgr_gram.c"
+    break;
+
+  case 351: /* AddJobitemStmt: ADD_P JOB IF_P NOT EXISTS Ident opt_general_options  */
+#line 2504 "mgr_gram.y"
+        {
+			MonitorJobAdd *node = makeNode(MonitorJobAdd);
+			node->if_not_exists = true;
+			node->name = (yyvsp[-1].str);
+			node->options = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+	}
+#line 6202 "mgr_gram.c"
+    break;
+
+  case 352: /* AlterJobitemStmt: ALTER ITEM Ident opt_general_options  */
+#line 2515 "mgr_gram.y"
+        {
+		MonitorJobitemAlter *node = makeNode(MonitorJobitemAlter);
+		node->name = (yyvsp[-1].str);
+		node->options = (yyvsp[0].list);
+		(yyval.node) = (Node*)node;
+	}
+#line 6213 "mgr_gram.c"
+    break;
+
+  case 353: /* AlterJobitemStmt: ALTER JOB Ident opt_general_options  */
+#line 2522 "mgr_gram.y"
+        {
+		MonitorJobAlter *node = makeNode(MonitorJobAlter);
+		node->name = (yyvsp[-1].str);
+		node->options = (yyvsp[0].list);
+		(yyval.node) = (Node*)node;
+	}
+#line 6224 "mgr_gram.c"
+    break;
+
+  case 354: /* DropJobitemStmt: DROP ITEM ObjList  */
+#line 2532 "mgr_gram.y"
+        {
+		MonitorJobitemDrop *node = makeNode(MonitorJobitemDrop);
+		node->if_exists = false;
+		node->namelist = (yyvsp[0].list);
+		(yyval.node) = (Node*)node;
+	}
+#line 6235 "mgr_gram.c"
+    break;
+
+  case 355: /* DropJobitemStmt: DROP ITEM IF_P EXISTS ObjList  */
+#line 2539 "mgr_gram.y"
+        {
+		MonitorJobitemDrop *node = makeNode(MonitorJobitemDrop);
+		node->if_exists = true;
+		node->namelist = (yyvsp[0].list);
+		(yyval.node) = (Node*)node;
+	}
+#line 6246 "mgr_gram.c"
+    break;
+
+  case 356: /* DropJobitemStmt: DROP JOB ObjList  */
+#line 2546 "mgr_gram.y"
+        {
+		MonitorJobDrop *node = makeNode(MonitorJobDrop);
+		node->if_exists = false;
+		node->namelist = (yyvsp[0].list);
+		(yyval.node) = (Node*)node;
+	}
+#line 6257 "mgr_gram.c"
+    break;
+
+  case 357: /* DropJobitemStmt: DROP JOB IF_P EXISTS ObjList  */
+#line 2553 "mgr_gram.y"
+        {
+		MonitorJobDrop *node = makeNode(MonitorJobDrop);
+		node->if_exists = true;
+		node->namelist = (yyvsp[0].list);
+		(yyval.node) = (Node*)node;
+	}
+#line 6268 "mgr_gram.c"
+    break;
+
+  case 358: /* ListJobStmt: LIST JOB  */
+#line 2563 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("job"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6279 "mgr_gram.c"
+    break;
+
+  case 359: /* ListJobStmt: LIST JOB AConstList  */
+#line 2570 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("job"), -1));
+			stmt->whereClause = make_column_in("name", (yyvsp[0].list));
+			(yyval.node) = (Node*)stmt;
+
+			check_job_name_isvaild((yyvsp[0].list));
+		}
+#line 6293 "mgr_gram.c"
+    break;
+
+  case 360: /* ListJobStmt: LIST ITEM  */
+#line 2580 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("jobitem"), -1));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6304 "mgr_gram.c"
+    break;
+
+  case 361: /* ListJobStmt: LIST ITEM AConstList  */
+#line 2587 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeRangeVar(pstrdup("adbmgr"), pstrdup("jobitem"), -1));
+			stmt->whereClause = make_column_in("item", (yyvsp[0].list));
+			(yyval.node) = (Node*)stmt;
+
+			check_jobitem_name_isvaild((yyvsp[0].list));
+		}
+#line 6318 "mgr_gram.c"
+    break;
+
+  case 362: /* AddExtensionStmt: ADD_P EXTENSION Ident  */
+#line 2600 "mgr_gram.y"
+                {
+			MgrExtensionAdd *node = makeNode(MgrExtensionAdd);
+			node->cmdtype = EXTENSION_CREATE;
+			node->name = (yyvsp[0].str);
+			(yyval.node) = (Node*)node;
+		}
+#line 6329 "mgr_gram.c"
+    break;
+
+  case 363: /* DropExtensionStmt: DROP EXTENSION Ident  */
+#line 2609 "mgr_gram.y"
+                {
+			MgrExtensionDrop *node = makeNode(MgrExtensionDrop);
+			node->cmdtype = EXTENSION_DROP;
+			node->name = (yyvsp[0].str);
+			(yyval.node) = (Node*)node;
+		}
+#line 6340 "mgr_gram.c"
+    break;
+
+  case 364: /* RemoveNodeStmt: REMOVE GTM opt_gtm_inner_type ObjList  */
+#line 2618 "mgr_gram.y"
+                {
+			MgrRemoveNode *node = makeNode(MgrRemoveNode);
+			node->nodetype = (yyvsp[-1].ival);
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 6351 "mgr_gram.c"
+    break;
+
+  case 365: /* RemoveNodeStmt: REMOVE DATANODE opt_dn_inner_type ObjList  */
+#line 2625 "mgr_gram.y"
+                {
+			MgrRemoveNode *node = makeNode(MgrRemoveNode);
+			node->nodetype = (yyvsp[-1].ival);
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 6362 "mgr_gram.c"
+    break;
+
+  case 366: /* RemoveNodeStmt: REMOVE COORDINATOR ObjList  */
+#line 2632 "mgr_gram.y"
+                {
+			MgrRemoveNode *node = makeNode(MgrRemoveNode);
+			node->nodetype = CNDN_TYPE_COORDINATOR_MASTER;
+			node->names = (yyvsp[0].list);
+			(yyval.node) = (Node*)node;
+		}
+#line 6373 "mgr_gram.c"
+    break;
+
+  case 367: /* FailoverManualStmt: ADBMGR PROMOTE opt_slave_inner_type Ident  */
+#line 2642 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+			args = lappend(args, makeStringConst((yyvsp[0].str), (yylsp[0])));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_manual_adbmgr_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6386 "mgr_gram.c"
+    break;
+
+  case 368: /* FailoverManualStmt: PROMOTE GTM opt_gtm_inner_type Ident  */
+#line 2651 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+			args = lappend(args, makeStringConst((yyvsp[0].str), (yylsp[0])));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_manual_promote_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6399 "mgr_gram.c"
+    break;
+
+  case 369: /* FailoverManualStmt: PROMOTE DATANODE opt_dn_inner_type Ident  */
+#line 2660 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+			args = lappend(args, makeStringConst((yyvsp[0].str), (yylsp[0])));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_manual_promote_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6412 "mgr_gram.c"
+    break;
+
+  case 370: /* FailoverManualStmt: CONFIG DATANODE MASTER Ident  */
+#line 2669 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst(CNDN_TYPE_DATANODE_MASTER, (yylsp[-1])));
+			args = lappend(args, makeStringConst((yyvsp[0].str), (yylsp[0])));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_manual_pgxcnode_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6425 "mgr_gram.c"
+    break;
+
+  case 371: /* FailoverManualStmt: REWIND opt_slave_inner_type Ident  */
+#line 2678 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+			args = lappend(args, makeStringConst((yyvsp[0].str), (yylsp[0])));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_failover_manual_rewind_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6438 "mgr_gram.c"
+    break;
+
+  case 372: /* SwitchoverStmt: SWITCHOVER GTM opt_gtm_inner_type Ident  */
+#line 2690 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+			args = lappend(args, makeStringConst((yyvsp[0].str), (yylsp[0])));
+			args = lappend(args, makeIntConst(0, -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_switchover_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6452 "mgr_gram.c"
+    break;
+
+  case 373: /* SwitchoverStmt: SWITCHOVER GTM opt_gtm_inner_type Ident FORCE  */
+#line 2700 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-2].ival), (yylsp[-2])));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), (yylsp[-1])));
+			args = lappend(args, makeIntConst(1, -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_switchover_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6466 "mgr_gram.c"
+    break;
+
+  case 374: /* SwitchoverStmt: SWITCHOVER DATANODE opt_dn_inner_type Ident  */
+#line 2710 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+			args = lappend(args, makeStringConst((yyvsp[0].str), (yylsp[0])));
+			args = lappend(args, makeIntConst(0, -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_switchover_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6480 "mgr_gram.c"
+    break;
+
+  case 375: /* SwitchoverStmt: SWITCHOVER DATANODE opt_dn_inner_type Ident FORCE  */
+#line 2720 "mgr_gram.y"
+                {
+			SelectStmt *stmt = makeNode(SelectStmt);
+			List *args = list_make1(makeIntConst((yyvsp[-2].ival), (yylsp[-2])));
+			args = lappend(args, makeStringConst((yyvsp[-1].str), (yylsp[-1])));
+			args = lappend(args, makeIntConst(1, -1));
+			stmt->targetList = list_make1(make_star_target(-1));
+			stmt->fromClause = list_make1(makeNode_RangeFunction("mgr_switchover_func", args));
+			(yyval.node) = (Node*)stmt;
+		}
+#line 6494 "mgr_gram.c"
+    break;
+
+
+#line 6498 "mgr_gram.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (&yylloc, yyscanner, YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, yyscanner);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, yyscanner);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (&yylloc, yyscanner, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, yyscanner);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, yyscanner);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 2831 "mgr_gram.y"
+
+/*
+ * The signature of this function is required by bison.  However, we
+ * ignore the passed yylloc and instead use the last token position
+ * available from the scanner.
+ */
+static void
+mgr_yyerror(YYLTYPE *yylloc, core_yyscan_t yyscanner, const char *msg)
+{
+	parser_yyerror(msg);
+}
+
+static int mgr_yylex(union YYSTYPE *lvalp, YYLTYPE *llocp,
+		   core_yyscan_t yyscanner)
+{
+	return core_yylex(&(lvalp->core_yystype), llocp, yyscanner);
+}
+
+List *mgr_parse_query(const char *query_string)
+{
+	core_yyscan_t yyscanner;
+	mgr_yy_extra_type yyextra;
+	int			yyresult;
+
+	/* initialize the flex scanner */
+	yyscanner = scanner_init(query_string, &yyextra.core_yy_extra,
+							 ManagerKeywords, NumManagerKeywords);
+
+	yyextra.parsetree = NIL;
+
+	/* Parse! */
+	yyresult = mgr_yyparse(yyscanner);
+
+	/* Clean up (release memory) */
+	scanner_finish(yyscanner);
+
+	if (yyresult)				/* error */
+		return NIL;
+
+	return yyextra.parsetree;
+}
+
+static Node* make_column_in(const char *col_name, List *values)
+{
+	A_Expr *expr;
+	ColumnRef *col = makeNode(ColumnRef);
+	col->fields = list_make1(makeString(pstrdup(col_name)));
+	col->location = -1;
+	expr = makeA_Expr(AEXPR_IN
+			, list_make1(makeString(pstrdup("=")))
+			, (Node*)col
+			, (Node*)values
+			, -1);
+	return (Node*)expr;
+}
+
+static Node* makeNode_RangeFunction(const char *func_name, List *func_args)
+{
+	RangeFunction *n = makeNode(RangeFunction);
+	n->lateral = false;
+	n->funccallnode = make_func_call(func_name, func_args);
+	n->alias = NULL;
+	n->coldeflist = NIL;
+	return (Node *) n;
+}
+
+static Node* make_func_call(const char *func_name, List *func_args)
+{
+	FuncCall *n = makeNode(FuncCall);
+	n->funcname = list_make1(makeString(pstrdup(func_name)));
+	n->args = func_args;
+	n->agg_order = NIL;
+	n->agg_star = FALSE;
+	n->agg_distinct = FALSE;
+	n->func_variadic = FALSE;
+	n->over = NULL;
+	n->location = -1;
+	return (Node *)n;
+}
+#if 0
+static List* make_start_agent_args(List *options)
+{
+	List *result;
+	char *password = NULL;
+	ListCell *lc;
+	DefElem *def;
+	
+	/* for(lc=list_head(options);lc;lc=lnext(lc)) */
+	foreach(lc,options)
+	{
+		def = lfirst(lc);
+		Assert(def && IsA(def, DefElem));
+		if(strcmp(def->defname, "password") == 0)
+			password = defGetString(def);
+		else
+		{
+			ereport(ERROR, (errcode(ERRCODE_SYNTAX_ERROR)
+				,errmsg("option \"%s\" not recognized", def->defname)
+				,errhint("option is password.")));
+		}
+	}
+	
+	if(password == NULL)
+		result = list_make1(makeNullAConst(-1));
+	else
+		result = list_make1(makeStringConst(password, -1));
+
+	return result;
+}
+#endif
+
+static Node* make_ColumnRef(const char *col_name)
+{
+	ColumnRef *col = makeNode(ColumnRef);
+	col->fields = list_make1(makeString(pstrdup(col_name)));
+	col->location = -1;
+	return (Node*)col;
+}
+
+static Node* make_whereClause_for_datanode(char* node_type_str, List* node_name_list, char* like_expr)
+{
+	Node* whereClause = NULL;
+
+	whereClause =
+		(Node *) makeA_Expr(AEXPR_AND, NIL,
+			(Node *) makeA_Expr(AEXPR_OR, NIL,
+				(Node *) makeA_Expr(AEXPR_AND, NIL,
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "~", make_ColumnRef("nodetype"), makeStringConst(pstrdup("^datanode master"), -1), -1),
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "=", make_ColumnRef("nodename"), makeStringConst(pstrdup("*"), -1), -1),
+									-1),
+				(Node *) makeA_Expr(AEXPR_AND, NIL,
+					(Node *) makeSimpleA_Expr(AEXPR_IN, "=", make_ColumnRef("nodename"), (Node*)node_name_list, -1),
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "=", make_ColumnRef("nodetype"), makeStringConst(pstrdup(node_type_str), -1), -1),
+									-1),
+									-1),
+			(Node *)makeSimpleA_Expr(AEXPR_OP, "~~",
+								make_ColumnRef("key"),
+								makeStringConst(pstrdup(like_expr), -1), -1),
+								-1);
+	return  (Node *)whereClause;
+}
+
+static Node* make_whereClause_for_coord(char* node_type_str, List* node_name_list, char* like_expr)
+{
+	Node* whereClause = NULL;
+
+	whereClause =
+		(Node *) makeA_Expr(AEXPR_AND, NIL,
+			(Node *) makeA_Expr(AEXPR_OR, NIL,
+				(Node *) makeA_Expr(AEXPR_AND, NIL,
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "~", make_ColumnRef("nodetype"), makeStringConst(pstrdup("^coordinator"), -1), -1),
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "=", make_ColumnRef("nodename"), makeStringConst(pstrdup("*"), -1), -1),
+									-1),
+				(Node *) makeA_Expr(AEXPR_AND, NIL,
+					(Node *) makeSimpleA_Expr(AEXPR_IN, "=", make_ColumnRef("nodename"), (Node*)node_name_list, -1),
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "=", make_ColumnRef("nodetype"), makeStringConst(pstrdup(node_type_str), -1), -1),
+									-1),
+									-1),
+			(Node *)makeSimpleA_Expr(AEXPR_OP, "~~",
+								make_ColumnRef("key"),
+								makeStringConst(pstrdup(like_expr), -1), -1),
+								-1);
+	return  (Node *)whereClause;
+}
+
+static Node* make_whereClause_for_gtm(char* node_type_str, List* node_name_list, char* like_expr)
+{
+	Node * whereClause = NULL;
+
+	whereClause =
+		(Node *) makeA_Expr(AEXPR_AND, NIL,
+			(Node *) makeA_Expr(AEXPR_OR, NIL,
+				(Node *) makeA_Expr(AEXPR_AND, NIL,
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "~", make_ColumnRef("nodetype"), makeStringConst(pstrdup("^gtm"), -1), -1),
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "=", make_ColumnRef("nodename"), makeStringConst(pstrdup("*"), -1), -1),
+									-1),
+				(Node *) makeA_Expr(AEXPR_AND, NIL,
+					(Node *) makeSimpleA_Expr(AEXPR_IN, "=", make_ColumnRef("nodename"), (Node*)node_name_list, -1),
+					(Node *) makeSimpleA_Expr(AEXPR_OP, "=", make_ColumnRef("nodetype"), makeStringConst(pstrdup(node_type_str), -1), -1),
+									-1),
+									-1),
+			(Node *)makeSimpleA_Expr(AEXPR_OP, "~~",
+								make_ColumnRef("key"),
+								makeStringConst(pstrdup(like_expr), -1), -1),
+								-1);
+	return  (Node *)whereClause;
+}
+
+static void check_node_name_isvaild(char node_type, List* node_name_list)
+{
+	ListCell *lc = NULL;
+	A_Const *node_name  = NULL;
+	NameData name;
+	Relation rel_node;
+	HeapScanDesc scan;
+	ScanKeyData key[2];
+	HeapTuple tuple;
+
+	foreach(lc, node_name_list)
+	{
+		node_name = (A_Const *) lfirst(lc);
+		Assert(node_name && IsA(&(node_name->val), String));
+
+		namestrcpy(&name, strVal(&(node_name->val)));
+		ScanKeyInit(&key[0]
+			,Anum_mgr_node_nodename
+			,BTEqualStrategyNumber, F_NAMEEQ
+			,NameGetDatum(&name));
+
+		ScanKeyInit(&key[1]
+			,Anum_mgr_node_nodetype
+			,BTEqualStrategyNumber
+			,F_CHAREQ
+			,CharGetDatum(node_type));
+
+		rel_node = heap_open(NodeRelationId, AccessShareLock);
+		scan = heap_beginscan(rel_node, SnapshotNow, 2, key);
+
+		if ((tuple = heap_getnext(scan, ForwardScanDirection)) == NULL)
+		{
+			heap_endscan(scan);
+			heap_close(rel_node, AccessShareLock);
+
+			switch (node_type)
+			{
+				case CNDN_TYPE_COORDINATOR_MASTER:
+					ereport(ERROR, (errmsg("coordinator \"%s\" does not exist", NameStr(name))));
+					break;
+				case CNDN_TYPE_DATANODE_MASTER:
+					ereport(ERROR, (errmsg("datanode master \"%s\" does not exist", NameStr(name))));
+					break;
+				case CNDN_TYPE_DATANODE_SLAVE:
+					ereport(ERROR, (errmsg("datanode slave \"%s\" does not exist", NameStr(name))));
+					break;
+				case CNDN_TYPE_DATANODE_EXTRA:
+					ereport(ERROR, (errmsg("datanode extra \"%s\" does not exist", NameStr(name))));
+					break;
+				case GTM_TYPE_GTM_SLAVE:
+					ereport(ERROR, (errmsg("gtm slave \"%s\" does not exist", NameStr(name))));
+					break;
+				case GTM_TYPE_GTM_EXTRA:
+					ereport(ERROR, (errmsg("gtm extra \"%s\" does not exist", NameStr(name))));
+					break;
+				default:
+					ereport(ERROR, (errmsg("node type \"%c\" does not exist", node_type)));
+					break;
+			}
+		}
+
+		heap_endscan(scan);
+		heap_close(rel_node, AccessShareLock);
+	}
+
+	return;
+}
+
+static void check_host_name_isvaild(List *node_name_list)
+{
+	ListCell *lc = NULL;
+	A_Const *host_name  = NULL;
+	NameData name;
+	Relation rel_node;
+	HeapScanDesc scan;
+	ScanKeyData key[1];
+	HeapTuple tuple;
+
+	foreach(lc, node_name_list)
+	{
+		host_name = (A_Const *) lfirst(lc);
+		Assert(host_name && IsA(&(host_name->val), String));
+		namestrcpy(&name, strVal(&(host_name->val)));
+
+		ScanKeyInit(&key[0]
+			,Anum_mgr_node_nodename
+			,BTEqualStrategyNumber, F_NAMEEQ
+			,NameGetDatum(&name));
+
+		rel_node = heap_open(HostRelationId, AccessShareLock);
+		scan = heap_beginscan(rel_node, SnapshotNow, 1, key);
+
+		if ((tuple = heap_getnext(scan, ForwardScanDirection)) == NULL)
+		{
+			heap_endscan(scan);
+			heap_close(rel_node, AccessShareLock);
+
+			ereport(ERROR, (errmsg("host name \"%s\" does not exist", NameStr(name))));
+		}
+
+		heap_endscan(scan);
+		heap_close(rel_node, AccessShareLock);
+	}
+
+	return;
+}
+
+static void check__name_isvaild(List *node_name_list)
+{
+	ListCell *lc = NULL;
+	A_Const *host_name  = NULL;
+	NameData name;
+	Relation rel_node;
+	HeapScanDesc scan;
+	ScanKeyData key[1];
+	HeapTuple tuple;
+
+	foreach(lc, node_name_list)
+	{
+		host_name = (A_Const *) lfirst(lc);
+		Assert(host_name && IsA(&(host_name->val), String));
+		namestrcpy(&name, strVal(&(host_name->val)));
+
+		ScanKeyInit(&key[0]
+			,Anum_mgr_node_nodename
+			,BTEqualStrategyNumber, F_NAMEEQ
+			,NameGetDatum(&name));
+
+		rel_node = heap_open(NodeRelationId, AccessShareLock);
+		scan = heap_beginscan(rel_node, SnapshotNow, 1, key);
+
+		if ((tuple = heap_getnext(scan, ForwardScanDirection)) == NULL)
+		{
+			heap_endscan(scan);
+			heap_close(rel_node, AccessShareLock);
+
+			ereport(ERROR, (errmsg("node name \"%s\" does not exist", NameStr(name))));
+		}
+
+		heap_endscan(scan);
+		heap_close(rel_node, AccessShareLock);
+	}
+
+	return;
+}
+
+static void check_job_name_isvaild(List *node_name_list)
+{
+	ListCell *lc = NULL;
+	A_Const *job_name  = NULL;
+	NameData name;
+	Relation rel_job;
+	HeapScanDesc scan;
+	ScanKeyData key[1];
+	HeapTuple tuple;
+
+	foreach(lc, node_name_list)
+	{
+		job_name = (A_Const *) lfirst(lc);
+		Assert(job_name && IsA(&(job_name->val), String));
+		namestrcpy(&name, strVal(&(job_name->val)));
+
+		ScanKeyInit(&key[0]
+			,Anum_monitor_job_name
+			,BTEqualStrategyNumber, F_NAMEEQ
+			,NameGetDatum(&name));
+
+		rel_job = heap_open(MjobRelationId, AccessShareLock);
+		scan = heap_beginscan(rel_job, SnapshotNow, 1, key);
+
+		if ((tuple = heap_getnext(scan, ForwardScanDirection)) == NULL)
+		{
+			heap_endscan(scan);
+			heap_close(rel_job, AccessShareLock);
+
+			ereport(ERROR, (errmsg("job name \"%s\" does not exist", NameStr(name))));
+		}
+
+		heap_endscan(scan);
+		heap_close(rel_job, AccessShareLock);
+	}
+
+	return;
+}
+
+static void check_jobitem_name_isvaild(List *node_name_list)
+{
+	ListCell *lc = NULL;
+	A_Const *jobitem_name  = NULL;
+	NameData name;
+	Relation rel_jobitem;
+	HeapScanDesc scan;
+	ScanKeyData key[1];
+	HeapTuple tuple;
+
+	foreach(lc, node_name_list)
+	{
+		jobitem_name = (A_Const *) lfirst(lc);
+		Assert(jobitem_name && IsA(&(jobitem_name->val), String));
+		namestrcpy(&name, strVal(&(jobitem_name->val)));
+
+		ScanKeyInit(&key[0]
+			,Anum_monitor_jobitem_itemname
+			,BTEqualStrategyNumber, F_NAMEEQ
+			,NameGetDatum(&name));
+
+		rel_jobitem = heap_open(MjobitemRelationId, AccessShareLock);
+		scan = heap_beginscan(rel_jobitem, SnapshotNow, 1, key);
+
+		if ((tuple = heap_getnext(scan, ForwardScanDirection)) == NULL)
+		{
+			heap_endscan(scan);
+			heap_close(rel_jobitem, AccessShareLock);
+
+			ereport(ERROR, (errmsg("job item name \"%s\" does not exist", NameStr(name))));
+		}
+
+		heap_endscan(scan);
+		heap_close(rel_jobitem, AccessShareLock);
+	}
+
+	return;
+}
+
+
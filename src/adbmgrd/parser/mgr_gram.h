@@ -0,0 +1,217 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_MGR_YY_MGR_GRAM_H_INCLUDED
+# define YY_MGR_YY_MGR_GRAM_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int mgr_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    FCONST = 259,                  /* FCONST  */
+    SCONST = 260,                  /* SCONST  */
+    BCONST = 261,                  /* BCONST  */
+    XCONST = 262,                  /* XCONST  */
+    Op = 263,                      /* Op  */
+    ICONST = 264,                  /* ICONST  */
+    TYPECAST = 265,                /* TYPECAST  */
+    DOT_DOT = 266,                 /* DOT_DOT  */
+    COLON_EQUALS = 267,            /* COLON_EQUALS  */
+    ADD_P = 268,                   /* ADD_P  */
+    DEPLOY = 269,                  /* DEPLOY  */
+    DROP = 270,                    /* DROP  */
+    ALTER = 271,                   /* ALTER  */
+    LIST = 272,                    /* LIST  */
+    CREATE = 273,                  /* CREATE  */
+    ACL = 274,                     /* ACL  */
+    CLUSTER = 275,                 /* CLUSTER  */
+    IF_P = 276,                    /* IF_P  */
+    EXISTS = 277,                  /* EXISTS  */
+    NOT = 278,                     /* NOT  */
+    FALSE_P = 279,                 /* FALSE_P  */
+    TRUE_P = 280,                  /* TRUE_P  */
+    HOST = 281,                    /* HOST  */
+    MONITOR = 282,                 /* MONITOR  */
+    PARAM = 283,                   /* PARAM  */
+    HBA = 284,                     /* HBA  */
+    HA = 285,                      /* HA  */
+    INIT = 286,                    /* INIT  */
+    GTM = 287,                     /* GTM  */
+    MASTER = 288,                  /* MASTER  */
+    SLAVE = 289,                   /* SLAVE  */
+    EXTRA = 290,                   /* EXTRA  */
+    ALL = 291,                     /* ALL  */
+    NODE = 292,                    /* NODE  */
+    COORDINATOR = 293,             /* COORDINATOR  */
+    DATANODE = 294,                /* DATANODE  */
+    PASSWORD = 295,                /* PASSWORD  */
+    CLEAN = 296,                   /* CLEAN  */
+    RESET = 297,                   /* RESET  */
+    WHERE = 298,                   /* WHERE  */
+    ROW_ID = 299,                  /* ROW_ID  */
+    START = 300,                   /* START  */
+    AGENT = 301,                   /* AGENT  */
+    STOP = 302,                    /* STOP  */
+    FAILOVER = 303,                /* FAILOVER  */
+    SET = 304,                     /* SET  */
+    TO = 305,                      /* TO  */
+    ON = 306,                      /* ON  */
+    OFF = 307,                     /* OFF  */
+    APPEND = 308,                  /* APPEND  */
+    CONFIG = 309,                  /* CONFIG  */
+    MODE = 310,                    /* MODE  */
+    FAST = 311,                    /* FAST  */
+    SMART = 312,                   /* SMART  */
+    IMMEDIATE = 313,               /* IMMEDIATE  */
+    S = 314,                       /* S  */
+    I = 315,                       /* I  */
+    F = 316,                       /* F  */
+    FORCE = 317,                   /* FORCE  */
+    SHOW = 318,                    /* SHOW  */
+    FLUSH = 319,                   /* FLUSH  */
+    GRANT = 320,                   /* GRANT  */
+    REVOKE = 321,                  /* REVOKE  */
+    FROM = 322,                    /* FROM  */
+    ITEM = 323,                    /* ITEM  */
+    JOB = 324,                     /* JOB  */
+    EXTENSION = 325,               /* EXTENSION  */
+    REMOVE = 326,                  /* REMOVE  */
+    DATA_CHECKSUMS = 327,          /* DATA_CHECKSUMS  */
+    STATUS = 328,                  /* STATUS  */
+    ACTIVATE = 329,                /* ACTIVATE  */
+    PROMOTE = 330,                 /* PROMOTE  */
+    ADBMGR = 331,                  /* ADBMGR  */
+    REWIND = 332,                  /* REWIND  */
+    SWITCHOVER = 333,              /* SWITCHOVER  */
+    GET_HOST_LIST_ALL = 334,       /* GET_HOST_LIST_ALL  */
+    GET_HOST_LIST_SPEC = 335,      /* GET_HOST_LIST_SPEC  */
+    GET_HOST_HISTORY_USAGE = 336,  /* GET_HOST_HISTORY_USAGE  */
+    GET_HOST_HISTORY_USAGE_BY_TIME_PERIOD = 337, /* GET_HOST_HISTORY_USAGE_BY_TIME_PERIOD  */
+    GET_ALL_NODENAME_IN_SPEC_HOST = 338, /* GET_ALL_NODENAME_IN_SPEC_HOST  */
+    GET_AGTM_NODE_TOPOLOGY = 339,  /* GET_AGTM_NODE_TOPOLOGY  */
+    GET_COORDINATOR_NODE_TOPOLOGY = 340, /* GET_COORDINATOR_NODE_TOPOLOGY  */
+    GET_DATANODE_NODE_TOPOLOGY = 341, /* GET_DATANODE_NODE_TOPOLOGY  */
+    GET_CLUSTER_SUMMARY = 342,     /* GET_CLUSTER_SUMMARY  */
+    GET_DATABASE_TPS_QPS = 343,    /* GET_DATABASE_TPS_QPS  */
+    GET_CLUSTER_HEADPAGE_LINE = 344, /* GET_CLUSTER_HEADPAGE_LINE  */
+    GET_DATABASE_TPS_QPS_INTERVAL_TIME = 345, /* GET_DATABASE_TPS_QPS_INTERVAL_TIME  */
+    MONITOR_DATABASETPS_FUNC_BY_TIME_PERIOD = 346, /* MONITOR_DATABASETPS_FUNC_BY_TIME_PERIOD  */
+    GET_DATABASE_SUMMARY = 347,    /* GET_DATABASE_SUMMARY  */
+    GET_SLOWLOG = 348,             /* GET_SLOWLOG  */
+    GET_USER_INFO = 349,           /* GET_USER_INFO  */
+    UPDATE_USER = 350,             /* UPDATE_USER  */
+    GET_SLOWLOG_COUNT = 351,       /* GET_SLOWLOG_COUNT  */
+    UPDATE_THRESHOLD_VALUE = 352,  /* UPDATE_THRESHOLD_VALUE  */
+    UPDATE_PASSWORD = 353,         /* UPDATE_PASSWORD  */
+    CHECK_USER = 354,              /* CHECK_USER  */
+    USER = 355,                    /* USER  */
+    GET_THRESHOLD_TYPE = 356,      /* GET_THRESHOLD_TYPE  */
+    GET_THRESHOLD_ALL_TYPE = 357,  /* GET_THRESHOLD_ALL_TYPE  */
+    CHECK_PASSWORD = 358,          /* CHECK_PASSWORD  */
+    GET_DB_THRESHOLD_ALL_TYPE = 359, /* GET_DB_THRESHOLD_ALL_TYPE  */
+    GET_ALARM_INFO_ASC = 360,      /* GET_ALARM_INFO_ASC  */
+    GET_ALARM_INFO_DESC = 361,     /* GET_ALARM_INFO_DESC  */
+    RESOLVE_ALARM = 362,           /* RESOLVE_ALARM  */
+    GET_ALARM_INFO_COUNT = 363,    /* GET_ALARM_INFO_COUNT  */
+    GET_CLUSTER_TPS_QPS = 364,     /* GET_CLUSTER_TPS_QPS  */
+    GET_CLUSTER_CONNECT_DBSIZE_INDEXSIZE = 365 /* GET_CLUSTER_CONNECT_DBSIZE_INDEXSIZE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 114 "mgr_gram.y"
+
+	core_YYSTYPE		core_yystype;
+	/* these fields must match core_YYSTYPE: */
+	int					ival;
+	char				*str;
+	const char			*keyword;
+
+	char				chr;
+	DefElem				*defelt;
+	bool				boolean;
+	List				*list;
+	Node				*node;
+	VariableSetStmt		*vsetstmt;
+	Value				*value;
+
+#line 190 "mgr_gram.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int mgr_yyparse (core_yyscan_t yyscanner);
+
+
+#endif /* !YY_MGR_YY_MGR_GRAM_H_INCLUDED  */
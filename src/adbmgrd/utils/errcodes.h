@@ -0,0 +1 @@
+/root/repo/src/backend/utils/errcodes.h
\ No newline at end of file
@@ -0,0 +1,721 @@
+# 0 "agtm_sequence.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "agtm_sequence.h.c"
+
+
+
+
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 6 "agtm_sequence.h.c" 2
+
+
+
+
+# 1 "../../../src/include/agtm/agtm_msg.h" 1
+# 22 "../../../src/include/agtm/agtm_msg.h"
+typedef enum AGTM_MessageType
+{
+ AGTM_MSG_GET_GXID,
+ AGTM_MSG_GET_TIMESTAMP,
+ AGTM_MSG_GXID_LIST,
+ AGTM_MSG_SNAPSHOT_GET,
+ AGTM_MSG_GET_XACT_STATUS,
+ AGTM_MSG_SYNC_XID,
+ AGTM_MSG_SEQUENCE_INIT,
+ AGTM_MSG_SEQUENCE_ALTER,
+ AGTM_MSG_SEQUENCE_DROP,
+ AGTM_MSG_SEQUENCE_DROP_BYDB,
+ AGTM_MSG_SEQUENCE_RENAME,
+ AGTM_MSG_SEQUENCE_RENAME_BYDB,
+ AGTM_MSG_SEQUENCE_GET_NEXT,
+ AGTM_MSG_SEQUENCE_GET_CUR,
+ AGTM_MSG_SEQUENCE_GET_LAST,
+ AGTM_MSG_SEQUENCE_SET_VAL,
+ AGTM_MSG_GET_STATUS,
+ AGTM_MSG_SNAPSHOT_GET_COMPACT,
+ AGTM_MSG_SEQUENCE_GET_RANGE
+} AGTM_MessageType;
+
+
+
+
+
+
+typedef enum AGTM_ResultType
+{
+ AGTM_NONE_RESULT,
+ AGTM_GET_GXID_RESULT,
+ AGTM_GET_TIMESTAMP_RESULT,
+ AGTM_GXID_LIST_RESULT,
+ AGTM_SNAPSHOT_GET_RESULT,
+ AGTM_GET_XACT_STATUS_RESULT,
+ AGTM_SYNC_XID_RESULT,
+ AGTM_MSG_SEQUENCE_INIT_RESULT,
+ AGTM_MSG_SEQUENCE_ALTER_RESULT,
+ AGTM_MSG_SEQUENCE_DROP_RESULT,
+ AGTM_MSG_SEQUENCE_DROP_BYDB_RESULT,
+ AGTM_MSG_SEQUENCE_RENAME_RESULT,
+ AGTM_MSG_SEQUENCE_RENAME_BYDB_RESULT,
+ AGTM_SEQUENCE_GET_NEXT_RESULT,
+ AGTM_MSG_SEQUENCE_GET_CUR_RESULT,
+ AGTM_SEQUENCE_GET_LAST_RESULT,
+ AGTM_SEQUENCE_SET_VAL_RESULT,
+ AGTM_COMPLETE_RESULT,
+ AGTM_SNAPSHOT_GET_COMPACT_RESULT,
+ AGTM_SEQUENCE_GET_RANGE_RESULT
+} AGTM_ResultType;
+
+
+typedef enum AgtmNodeTag
+{
+ T_AgtmInvalid = 0,
+ T_AgtmInteger,
+ T_AgtmFloat,
+ T_AgtmString,
+ T_AgtmBitString,
+ T_AgtmSeqName,
+ T_AgtmSeqSchema,
+ T_AgtmseqDatabase,
+ T_AgtmNull
+} AgtmNodeTag;
+
+typedef enum SequenceRenameType
+{
+ T_RENAME_SEQUENCE,
+ T_RENAME_SCHEMA,
+ T_RENAME_DATABASE,
+ T_NULL
+}SequenceRenameType;
+# 11 "agtm_sequence.h.c" 2
+# 1 "../../../src/include/nodes/pg_list.h" 1
+# 40 "../../../src/include/nodes/pg_list.h"
+# 1 "../../../src/include/nodes/nodes.h" 1
+# 27 "../../../src/include/nodes/nodes.h"
+typedef enum NodeTag
+{
+ T_Invalid = 0,
+
+
+
+
+ T_IndexInfo = 10,
+ T_ExprContext,
+ T_ProjectionInfo,
+ T_JunkFilter,
+ T_ResultRelInfo,
+ T_EState,
+ T_TupleTableSlot,
+
+
+
+
+ T_Plan = 100,
+ T_Result,
+ T_ModifyTable,
+ T_Append,
+ T_MergeAppend,
+ T_RecursiveUnion,
+ T_BitmapAnd,
+ T_BitmapOr,
+ T_Scan,
+ T_SeqScan,
+
+
+
+ T_IndexScan,
+ T_IndexOnlyScan,
+ T_BitmapIndexScan,
+ T_BitmapHeapScan,
+ T_TidScan,
+ T_SubqueryScan,
+ T_FunctionScan,
+ T_ValuesScan,
+ T_CteScan,
+ T_WorkTableScan,
+ T_ForeignScan,
+ T_Join,
+ T_NestLoop,
+ T_MergeJoin,
+ T_HashJoin,
+ T_Material,
+ T_Sort,
+ T_Group,
+ T_Agg,
+ T_WindowAgg,
+ T_Unique,
+ T_Hash,
+ T_SetOp,
+ T_LockRows,
+ T_Limit,
+
+ T_NestLoopParam,
+ T_PlanRowMark,
+ T_PlanInvalItem,
+# 108 "../../../src/include/nodes/nodes.h"
+ T_PlanState = 200,
+ T_ResultState,
+ T_ModifyTableState,
+ T_AppendState,
+ T_MergeAppendState,
+ T_RecursiveUnionState,
+ T_BitmapAndState,
+ T_BitmapOrState,
+ T_ScanState,
+ T_SeqScanState,
+
+
+
+ T_IndexScanState,
+ T_IndexOnlyScanState,
+ T_BitmapIndexScanState,
+ T_BitmapHeapScanState,
+ T_TidScanState,
+ T_SubqueryScanState,
+ T_FunctionScanState,
+ T_ValuesScanState,
+ T_CteScanState,
+ T_WorkTableScanState,
+ T_ForeignScanState,
+ T_JoinState,
+ T_NestLoopState,
+ T_MergeJoinState,
+ T_HashJoinState,
+ T_MaterialState,
+ T_SortState,
+ T_GroupState,
+ T_AggState,
+ T_WindowAggState,
+ T_UniqueState,
+ T_HashState,
+ T_SetOpState,
+ T_LockRowsState,
+ T_LimitState,
+
+
+
+
+
+
+
+ T_Alias = 300,
+ T_RangeVar,
+ T_Expr,
+ T_Var,
+ T_Const,
+ T_Param,
+ T_Aggref,
+ T_WindowFunc,
+ T_ArrayRef,
+ T_FuncExpr,
+ T_NamedArgExpr,
+ T_OpExpr,
+ T_DistinctExpr,
+ T_NullIfExpr,
+ T_ScalarArrayOpExpr,
+ T_BoolExpr,
+ T_SubLink,
+ T_SubPlan,
+ T_AlternativeSubPlan,
+ T_FieldSelect,
+ T_FieldStore,
+ T_RelabelType,
+ T_CoerceViaIO,
+ T_ArrayCoerceExpr,
+ T_ConvertRowtypeExpr,
+ T_CollateExpr,
+ T_CaseExpr,
+ T_CaseWhen,
+ T_CaseTestExpr,
+ T_ArrayExpr,
+ T_RowExpr,
+ T_RowCompareExpr,
+ T_CoalesceExpr,
+ T_MinMaxExpr,
+ T_XmlExpr,
+ T_NullTest,
+ T_BooleanTest,
+ T_CoerceToDomain,
+ T_CoerceToDomainValue,
+ T_SetToDefault,
+ T_CurrentOfExpr,
+ T_RownumExpr,
+
+
+
+ T_TargetEntry,
+ T_RangeTblRef,
+ T_JoinExpr,
+ T_FromExpr,
+ T_IntoClause,
+# 214 "../../../src/include/nodes/nodes.h"
+ T_ExprState = 400,
+ T_GenericExprState,
+ T_WholeRowVarExprState,
+ T_AggrefExprState,
+ T_WindowFuncExprState,
+ T_ArrayRefExprState,
+ T_FuncExprState,
+ T_ScalarArrayOpExprState,
+ T_BoolExprState,
+ T_SubPlanState,
+ T_AlternativeSubPlanState,
+ T_FieldSelectState,
+ T_FieldStoreState,
+ T_CoerceViaIOState,
+ T_ArrayCoerceExprState,
+ T_ConvertRowtypeExprState,
+ T_CaseExprState,
+ T_CaseWhenState,
+ T_ArrayExprState,
+ T_RowExprState,
+ T_RowCompareExprState,
+ T_CoalesceExprState,
+ T_MinMaxExprState,
+ T_XmlExprState,
+ T_NullTestState,
+ T_CoerceToDomainState,
+ T_DomainConstraintState,
+ T_RownumExprState,
+
+
+
+
+ T_PlannerInfo = 500,
+ T_PlannerGlobal,
+ T_RelOptInfo,
+ T_IndexOptInfo,
+ T_ParamPathInfo,
+ T_Path,
+ T_IndexPath,
+ T_BitmapHeapPath,
+ T_BitmapAndPath,
+ T_BitmapOrPath,
+ T_NestPath,
+ T_MergePath,
+ T_HashPath,
+ T_TidPath,
+ T_ForeignPath,
+ T_AppendPath,
+ T_MergeAppendPath,
+ T_ResultPath,
+ T_MaterialPath,
+ T_UniquePath,
+ T_EquivalenceClass,
+ T_EquivalenceMember,
+ T_PathKey,
+ T_RestrictInfo,
+ T_PlaceHolderVar,
+ T_SpecialJoinInfo,
+ T_LateralJoinInfo,
+ T_AppendRelInfo,
+ T_PlaceHolderInfo,
+ T_MinMaxAggInfo,
+ T_PlannerParamItem,
+
+
+
+
+
+
+
+ T_MemoryContext = 600,
+ T_AllocSetContext,
+ T_BumpContext,
+
+
+
+
+ T_Value = 650,
+ T_Integer,
+ T_Float,
+ T_String,
+ T_BitString,
+ T_Null,
+
+
+
+
+ T_List,
+ T_IntList,
+ T_OidList,
+
+
+
+
+ T_Query = 700,
+ T_PlannedStmt,
+ T_InsertStmt,
+ T_DeleteStmt,
+ T_UpdateStmt,
+ T_SelectStmt,
+ T_AlterTableStmt,
+ T_AlterTableCmd,
+ T_AlterDomainStmt,
+ T_SetOperationStmt,
+ T_GrantStmt,
+ T_GrantRoleStmt,
+ T_AlterDefaultPrivilegesStmt,
+ T_ClosePortalStmt,
+ T_ClusterStmt,
+ T_CopyStmt,
+ T_CopyFuncStmt,
+ T_CreateStmt,
+ T_DefineStmt,
+ T_DropStmt,
+ T_TruncateStmt,
+ T_CommentStmt,
+ T_FetchStmt,
+ T_IndexStmt,
+ T_CreateFunctionStmt,
+ T_AlterFunctionStmt,
+ T_DoStmt,
+ T_RenameStmt,
+ T_RuleStmt,
+ T_NotifyStmt,
+ T_ListenStmt,
+ T_UnlistenStmt,
+ T_TransactionStmt,
+ T_ViewStmt,
+ T_LoadStmt,
+ T_CreateDomainStmt,
+ T_CreatedbStmt,
+ T_DropdbStmt,
+ T_VacuumStmt,
+ T_ExplainStmt,
+ T_CreateTableAsStmt,
+ T_CreateSeqStmt,
+ T_AlterSeqStmt,
+ T_VariableSetStmt,
+ T_VariableShowStmt,
+ T_DiscardStmt,
+ T_CreateTrigStmt,
+ T_CreatePLangStmt,
+ T_CreateRoleStmt,
+ T_AlterRoleStmt,
+ T_DropRoleStmt,
+ T_LockStmt,
+ T_ConstraintsSetStmt,
+ T_ReindexStmt,
+ T_CheckPointStmt,
+ T_CreateSchemaStmt,
+ T_AlterDatabaseStmt,
+ T_AlterDatabaseSetStmt,
+ T_AlterRoleSetStmt,
+ T_CreateConversionStmt,
+ T_CreateCastStmt,
+ T_CreateOpClassStmt,
+ T_CreateOpFamilyStmt,
+ T_AlterOpFamilyStmt,
+ T_PrepareStmt,
+ T_ExecuteStmt,
+ T_DeallocateStmt,
+ T_DeclareCursorStmt,
+ T_CreateTableSpaceStmt,
+ T_DropTableSpaceStmt,
+ T_AlterObjectSchemaStmt,
+ T_AlterOwnerStmt,
+ T_DropOwnedStmt,
+ T_ReassignOwnedStmt,
+ T_CompositeTypeStmt,
+ T_CreateEnumStmt,
+ T_CreateRangeStmt,
+ T_AlterEnumStmt,
+ T_AlterTSDictionaryStmt,
+ T_AlterTSConfigurationStmt,
+ T_CreateFdwStmt,
+ T_AlterFdwStmt,
+ T_CreateForeignServerStmt,
+ T_AlterForeignServerStmt,
+ T_CreateUserMappingStmt,
+ T_AlterUserMappingStmt,
+ T_DropUserMappingStmt,
+ T_ExecDirectStmt,
+ T_CleanConnStmt,
+ T_AlterTableSpaceOptionsStmt,
+ T_SecLabelStmt,
+ T_CreateForeignTableStmt,
+ T_CreateExtensionStmt,
+ T_AlterExtensionStmt,
+ T_AlterExtensionContentsStmt,
+ T_CreateEventTrigStmt,
+ T_AlterEventTrigStmt,
+ T_RefreshMatViewStmt,
+
+
+
+
+
+
+
+ T_A_Expr = 900,
+ T_ColumnRef,
+
+
+
+
+ T_ParamRef,
+ T_A_Const,
+ T_FuncCall,
+ T_A_Star,
+ T_A_Indices,
+ T_A_Indirection,
+ T_A_ArrayExpr,
+ T_ResTarget,
+ T_TypeCast,
+ T_CollateClause,
+ T_SortBy,
+ T_WindowDef,
+ T_RangeSubselect,
+ T_RangeFunction,
+
+
+
+ T_TypeName,
+ T_ColumnDef,
+ T_IndexElem,
+ T_Constraint,
+ T_DefElem,
+ T_RangeTblEntry,
+
+
+
+ T_SortGroupClause,
+ T_WindowClause,
+ T_PrivGrantee,
+ T_FuncWithArgs,
+ T_AccessPriv,
+ T_CreateOpClassItem,
+ T_TableLikeClause,
+ T_FunctionParameter,
+ T_LockingClause,
+ T_RowMarkClause,
+ T_XmlSerialize,
+ T_WithClause,
+ T_CommonTableExpr,
+
+
+
+
+ T_IdentifySystemCmd,
+ T_BaseBackupCmd,
+ T_StartReplicationCmd,
+ T_TimeLineHistoryCmd,
+# 475 "../../../src/include/nodes/nodes.h"
+ T_TriggerData = 950,
+ T_EventTriggerData,
+ T_ReturnSetInfo,
+ T_WindowObjectData,
+ T_TIDBitmap,
+ T_InlineCodeBlock,
+ T_FdwRoutine
+# 521 "../../../src/include/nodes/nodes.h"
+} NodeTag;
+
+
+
+
+
+
+
+typedef struct Node
+{
+ NodeTag type;
+} Node;
+# 593 "../../../src/include/nodes/nodes.h"
+extern char *nodeToString(const void *obj);
+
+
+
+
+
+extern char *printObject(const void *obj);
+# 611 "../../../src/include/nodes/nodes.h"
+extern void *stringToNode(char *str);
+
+
+
+
+extern void *copyObject(const void *obj);
+
+
+
+
+extern bool equal(const void *a, const void *b);
+# 632 "../../../src/include/nodes/nodes.h"
+typedef double Selectivity;
+typedef double Cost;
+# 642 "../../../src/include/nodes/nodes.h"
+typedef enum CmdType
+{
+ CMD_UNKNOWN,
+ CMD_SELECT,
+ CMD_UPDATE,
+ CMD_INSERT,
+ CMD_DELETE,
+ CMD_UTILITY,
+
+ CMD_NOTHING
+
+} CmdType;
+# 666 "../../../src/include/nodes/nodes.h"
+typedef enum JoinType
+{
+
+
+
+
+ JOIN_INNER,
+ JOIN_LEFT,
+ JOIN_FULL,
+ JOIN_RIGHT,
+# 686 "../../../src/include/nodes/nodes.h"
+ JOIN_SEMI,
+ JOIN_ANTI,
+
+
+
+
+
+ JOIN_UNIQUE_OUTER,
+ JOIN_UNIQUE_INNER
+
+
+
+
+} JoinType;
+# 41 "../../../src/include/nodes/pg_list.h" 2
+
+
+typedef struct ListCell ListCell;
+
+typedef struct List
+{
+ NodeTag type;
+ int length;
+ ListCell *head;
+ ListCell *tail;
+} List;
+
+struct ListCell
+{
+ union
+ {
+  void *ptr_value;
+  int int_value;
+  Oid oid_value;
+ } data;
+ ListCell *next;
+};
+# 79 "../../../src/include/nodes/pg_list.h"
+extern ListCell *list_head(const List *l);
+extern ListCell *list_tail(List *l);
+extern int list_length(const List *l);
+# 194 "../../../src/include/nodes/pg_list.h"
+extern List *lappend(List *list, void *datum);
+extern List *lappend_int(List *list, int datum);
+extern List *lappend_oid(List *list, Oid datum);
+
+extern ListCell *lappend_cell(List *list, ListCell *prev, void *datum);
+extern ListCell *lappend_cell_int(List *list, ListCell *prev, int datum);
+extern ListCell *lappend_cell_oid(List *list, ListCell *prev, Oid datum);
+
+extern List *lcons(void *datum, List *list);
+extern List *lcons_int(int datum, List *list);
+extern List *lcons_oid(Oid datum, List *list);
+
+extern List *list_concat(List *list1, List *list2);
+extern List *list_truncate(List *list, int new_size);
+
+extern void *list_nth(const List *list, int n);
+extern int list_nth_int(const List *list, int n);
+extern Oid list_nth_oid(const List *list, int n);
+
+extern bool list_member(const List *list, const void *datum);
+extern bool list_member_ptr(const List *list, const void *datum);
+extern bool list_member_int(const List *list, int datum);
+
+
+
+extern bool list_member_oid(const List *list, Oid datum);
+
+extern List *list_delete(List *list, void *datum);
+extern List *list_delete_ptr(List *list, void *datum);
+extern List *list_delete_int(List *list, int datum);
+extern List *list_delete_oid(List *list, Oid datum);
+extern List *list_delete_first(List *list);
+extern List *list_delete_cell(List *list, ListCell *cell, ListCell *prev);
+
+extern List *list_union(const List *list1, const List *list2);
+extern List *list_union_ptr(const List *list1, const List *list2);
+extern List *list_union_int(const List *list1, const List *list2);
+extern List *list_union_oid(const List *list1, const List *list2);
+
+
+
+
+
+extern List *list_intersection(const List *list1, const List *list2);
+
+
+
+extern List *list_difference(const List *list1, const List *list2);
+extern List *list_difference_ptr(const List *list1, const List *list2);
+extern List *list_difference_int(const List *list1, const List *list2);
+extern List *list_difference_oid(const List *list1, const List *list2);
+
+extern List *list_append_unique(List *list, void *datum);
+extern List *list_append_unique_ptr(List *list, void *datum);
+extern List *list_append_unique_int(List *list, int datum);
+extern List *list_append_unique_oid(List *list, Oid datum);
+
+extern List *list_concat_unique(List *list1, List *list2);
+extern List *list_concat_unique_ptr(List *list1, List *list2);
+extern List *list_concat_unique_int(List *list1, List *list2);
+extern List *list_concat_unique_oid(List *list1, List *list2);
+
+extern void list_free(List *list);
+extern void list_free_deep(List *list);
+
+extern List *list_copy(const List *list);
+extern List *list_copy_tail(const List *list, int nskip);
+# 12 "agtm_sequence.h.c" 2
+
+
+
+CATALOG(agtm_sequence,4053)
+{
+ NameData database;
+ NameData schema;
+ NameData sequence;
+} FormData_agtm_sequence;
+
+
+
+
+
+
+typedef FormData_agtm_sequence *Form_agtm_sequence;
+# 39 "agtm_sequence.h.c"
+extern Oid AddAgtmSequence(const char* database,
+    const char* schema, const char* sequence);
+
+extern Oid DelAgtmSequence(const char* database,
+    const char* schema, const char* sequence);
+
+extern void DelAgtmSequenceByOid(Oid oid);
+
+extern List * DelAgtmSequenceByDatabse(const char* database);
+
+extern bool SequenceIsExist(const char* database,
+    const char* schema, const char* sequence);
+
+extern Oid SequenceSystemClassOid(const char* database,
+    const char* schema, const char* sequence);
+
+extern void UpdateSequenceInfo(const char* database,
+    const char* schema, const char* sequence, const char * value, AgtmNodeTag type);
+
+extern void UpdateSequenceDbExist(const char* oldName, const char* newName);
@@ -387,6 +387,12 @@ CREATE VIEW pg_timezone_abbrevs AS
 CREATE VIEW pg_timezone_names AS
     SELECT * FROM pg_timezone_names();
 
+CREATE VIEW pg_agtm_stat_messages AS
+    SELECT * FROM pg_agtm_stat_messages();
+
+CREATE VIEW pg_agtm_stat_snapshots AS
+    SELECT * FROM pg_agtm_stat_snapshots();
+
 -- Statistics views
 
 CREATE VIEW pg_stat_all_tables AS
@@ -0,0 +1 @@
+/root/repo/src/agtm/catalog/schemapg.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/agtm/parser/gram.h
\ No newline at end of file
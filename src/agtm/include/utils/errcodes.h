@@ -0,0 +1 @@
+/root/repo/src/agtm/utils/errcodes.h
\ No newline at end of file
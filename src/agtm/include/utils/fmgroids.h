@@ -0,0 +1 @@
+/root/repo/src/agtm/utils/fmgroids.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/agtm/utils/probes.h
\ No newline at end of file
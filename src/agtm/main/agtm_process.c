@@ -5,6 +5,7 @@
 #include "agtm/agtm.h"
 #include "agtm/agtm_msg.h"
 #include "agtm/agtm_sequence.h"
+#include "agtm/agtm_stats.h"
 #include "agtm/agtm_transaction.h"
 #include "agtm/agtm_utils.h"
 #include "catalog/pg_type.h"
@@ -27,8 +28,11 @@ ProcessAGtmCommand(StringInfo input_message, CommandDest dest)
 	MemoryContext oldcontext;
 	StringInfo output;
 	AGTM_MessageType mtype;
+	instr_time	start;
 	static StringInfoData buf={NULL, 0, 0, 0};
 
+	INSTR_TIME_SET_CURRENT(start);
+
 	/* check transaction status */
 	if (TransactionBlockStatusCode() == 'E')
 		elog(ERROR, "error transaction block state,current state may be abort");
@@ -65,6 +69,10 @@ ProcessAGtmCommand(StringInfo input_message, CommandDest dest)
 			output = ProcessGetSnapshot(input_message, &buf);
 			break;
 
+		case AGTM_MSG_SNAPSHOT_GET_COMPACT:
+			output = ProcessGetSnapshotCompact(input_message, &buf);
+			break;
+
 		case AGTM_MSG_GET_XACT_STATUS:
 			output = ProcessGetXactStatus(input_message, &buf);
 			break;
@@ -119,6 +127,10 @@ ProcessAGtmCommand(StringInfo input_message, CommandDest dest)
 			} PG_END_TRY();
 			break;
 
+		case AGTM_MSG_SEQUENCE_GET_RANGE:
+			output = ProcessRangeSeqCommand(input_message, &buf);
+			break;
+
 		case AGTM_MSG_SEQUENCE_GET_CUR:
 			output = ProcessCurSeqCommand(input_message, &buf);
 			break;
@@ -174,6 +186,8 @@ ProcessAGtmCommand(StringInfo input_message, CommandDest dest)
 	}
 
 	EndCommand(msg_name, dest);
+	AgtmStatsCountMessage(mtype, (uint32) input_message->len,
+						  output ? (uint32) output->len : 0, &start);
 	resetStringInfo(&buf);
 }
 
@@ -6,18 +6,169 @@
 #include "commands/sequence.h"
 #include "libpq/libpq.h"
 #include "libpq/pqformat.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
 #include "utils/builtins.h"
+#include "utils/hsearch.h"
 #include "utils/resowner.h"
 
+/*
+ * Shared sequence cache
+ *
+ * Every coordinator asks AGTM for the values of a global sequence, so a hot
+ * sequence used to serialize all of them on the buffer lock of its relation,
+ * on its WAL record and on the catalog lookups that map the sequence name to
+ * its relation.  Instead AGTM reserves a block of agtm_sequence_prealloc
+ * values with one nextval_range_oid() call, which advances the sequence on
+ * disk to the end of the block and WAL-logs it, and keeps the rest of the
+ * block in shared memory.  Following requests for the sequence take their
+ * values from there under a spinlock of the entry, without touching the
+ * relation or the catalogs.  A crash of AGTM loses what is left of the
+ * blocks, like the CACHE of a sequence loses its values.
+ *
+ * Entries are keyed by the names the coordinators send.  DDL on a sequence
+ * removes its entry, so the next request reserves a new block from the
+ * changed relation.  A reservation only installs its block in the entry it
+ * found before reserving, recognized by the generation of the entry, and
+ * only if that entry ran out meanwhile; otherwise the rest of the block is
+ * dropped.  Values stay unique, but as with CACHE, values handed out to
+ * concurrent requests are not necessarily in order.
+ */
+typedef struct AgtmSeqCacheKey
+{
+	NameData	database;
+	NameData	schema;
+	NameData	sequence;
+} AgtmSeqCacheKey;
+
+typedef struct AgtmSeqCacheEntry
+{
+	AgtmSeqCacheKey key;		/* hash key, must be first */
+	uint64		generation;		/* identifies this entry, never reused */
+	slock_t		mutex;			/* protects the fields below */
+	bool		valid;			/* are there values left? */
+	int64		next;			/* next value to hand out */
+	int64		last;			/* last value of the reserved block */
+	int64		increment;		/* step between the values */
+} AgtmSeqCacheEntry;
+
+typedef struct AgtmSeqCacheShared
+{
+	uint64		generation;		/* last generation assigned to an entry */
+} AgtmSeqCacheShared;
+
+/* GUC variables */
+int			agtm_sequence_cache_size = 1024;
+int			agtm_sequence_prealloc = 1000;
+
+static AgtmSeqCacheShared *SeqCacheShared = NULL;
+static HTAB *SeqCacheHash = NULL;
+
 static void RespondSeqToClient(int64 seq_val, AGTM_ResultType type, StringInfo output);
 
 static Datum  GetSeqKeyToDatumOid(char *seq_key);
 
 static Datum prase_to_agtm_sequence_name(StringInfo message);
 
+static Datum get_agtm_sequence_oid(char *dbName, char *schemaName,
+							char *sequenceName);
+
 static	void parse_seqFullName_to_details(StringInfo message, char ** dbName, 
 							char ** schemaName, char ** sequenceName);
 
+static int64 agtm_seq_nextval(StringInfo message, int64 range, int64 *last);
+static void SeqCacheMakeKey(AgtmSeqCacheKey *key, const char *dbName,
+				const char *schemaName, const char *sequenceName);
+static bool SeqCacheFetch(AgtmSeqCacheKey *key, int64 range,
+			  int64 *first, int64 *last);
+static int64 SeqCacheReserve(AgtmSeqCacheKey *key, Oid relid, int64 range,
+				int64 *last);
+static bool SeqBlockTake(int64 *next, int64 last, int64 increment,
+			 int64 range, int64 *first, int64 *taken_last);
+
+/* Report shared memory space needed by AgtmSeqCacheShmemInit */
+Size
+AgtmSeqCacheShmemSize(void)
+{
+	return add_size(MAXALIGN(sizeof(AgtmSeqCacheShared)),
+					hash_estimate_size(agtm_sequence_cache_size,
+									   sizeof(AgtmSeqCacheEntry)));
+}
+
+/* Allocate and initialize the shared sequence cache */
+void
+AgtmSeqCacheShmemInit(void)
+{
+	HASHCTL		info;
+	bool		found;
+
+	SeqCacheShared = (AgtmSeqCacheShared *)
+		ShmemInitStruct("AGTM Sequence Cache Header",
+						sizeof(AgtmSeqCacheShared), &found);
+	if (!found)
+		SeqCacheShared->generation = 0;
+
+	MemSet(&info, 0, sizeof(info));
+	info.keysize = sizeof(AgtmSeqCacheKey);
+	info.entrysize = sizeof(AgtmSeqCacheEntry);
+	info.hash = tag_hash;
+
+	SeqCacheHash = ShmemInitHash("AGTM Sequence Cache",
+								 agtm_sequence_cache_size,
+								 agtm_sequence_cache_size,
+								 &info,
+								 HASH_ELEM | HASH_FUNCTION);
+}
+
+/*
+ * AgtmSeqCacheInvalidate
+ *
+ * Forget the cached values of a sequence after DDL changed it.  With
+ * "sequenceName" NULL all sequences of the schema are forgotten, with
+ * "schemaName" NULL too all sequences of the database.
+ */
+void
+AgtmSeqCacheInvalidate(const char *dbName, const char *schemaName,
+					   const char *sequenceName)
+{
+	AgtmSeqCacheKey key;
+	HASH_SEQ_STATUS status;
+	AgtmSeqCacheEntry *entry;
+
+	AssertArg(dbName != NULL);
+	AssertArg(schemaName != NULL || sequenceName == NULL);
+
+	if (SeqCacheHash == NULL)
+		return;
+
+	SeqCacheMakeKey(&key, dbName, schemaName ? schemaName : "",
+					sequenceName ? sequenceName : "");
+
+	LWLockAcquire(AgtmSequenceCacheLock, LW_EXCLUSIVE);
+
+	if (sequenceName != NULL)
+	{
+		(void) hash_search(SeqCacheHash, &key, HASH_REMOVE, NULL);
+	}
+	else
+	{
+		/* removing the current entry does not disturb hash_seq_search */
+		hash_seq_init(&status, SeqCacheHash);
+		while ((entry = (AgtmSeqCacheEntry *) hash_seq_search(&status)) != NULL)
+		{
+			if (strcmp(NameStr(entry->key.database), NameStr(key.database)) != 0)
+				continue;
+			if (schemaName != NULL &&
+				strcmp(NameStr(entry->key.schema), NameStr(key.schema)) != 0)
+				continue;
+			(void) hash_search(SeqCacheHash, &entry->key, HASH_REMOVE, NULL);
+		}
+	}
+
+	LWLockRelease(AgtmSequenceCacheLock);
+}
+
 static void
 RespondSeqToClient(int64 seq_val, AGTM_ResultType type, StringInfo output)
 {
@@ -40,15 +191,10 @@ GetSeqKeyToDatumOid(char *seq_key)
 StringInfo
 ProcessNextSeqCommand(StringInfo message, StringInfo output)
 {
-	Datum seq_val_datum;
 	int64 seq_val;
-	Datum seq_name_to_oid;
-
-	seq_name_to_oid= prase_to_agtm_sequence_name(message);
-	pq_getmsgend(message);
+	int64 seq_last;
 
-	seq_val_datum = DirectFunctionCall1(nextval_oid, seq_name_to_oid);
-	seq_val = DatumGetInt64(seq_val_datum);
+	seq_val = agtm_seq_nextval(message, 0, &seq_last);
 
 	/* Respond to the client */
 	RespondSeqToClient(seq_val, AGTM_SEQUENCE_GET_NEXT_RESULT, output);
@@ -56,6 +202,26 @@ ProcessNextSeqCommand(StringInfo message, StringInfo output)
 	return output;
 }
 
+/*
+ * Hand out a block of consecutive values, the coordinator keeps them in its
+ * local sequence cache so it does not come back for each nextval().
+ */
+StringInfo
+ProcessRangeSeqCommand(StringInfo message, StringInfo output)
+{
+	int64 seq_val;
+	int64 seq_last;
+
+	seq_val = agtm_seq_nextval(message, -1, &seq_last);
+
+	/* Respond to the client */
+	pq_sendint(output, AGTM_SEQUENCE_GET_RANGE_RESULT, 4);
+	pq_sendbytes(output, (char *)&seq_val, sizeof(seq_val));
+	pq_sendbytes(output, (char *)&seq_last, sizeof(seq_last));
+
+	return output;
+}
+
 StringInfo
 ProcessCurSeqCommand(StringInfo message, StringInfo output)
 {
@@ -113,8 +279,12 @@ ProcessSetSeqCommand(StringInfo message, StringInfo output)
 	int64 seq_val;
 	Datum seq_val_datum;
 	Datum seq_name_to_oid;
+	char* dbName = NULL;
+	char* schemaName = NULL;
+	char* sequenceName = NULL;
 
-	seq_name_to_oid= prase_to_agtm_sequence_name(message);
+	parse_seqFullName_to_details(message, &dbName, &schemaName, &sequenceName);
+	seq_name_to_oid = get_agtm_sequence_oid(dbName, schemaName, sequenceName);
 	memcpy(&seq_nextval,pq_getmsgbytes(message, sizeof(seq_nextval)),
 		sizeof (seq_nextval));	
 	iscalled = pq_getmsgbyte(message);
@@ -125,6 +295,13 @@ ProcessSetSeqCommand(StringInfo message, StringInfo output)
 
 	seq_val = DatumGetInt64(seq_val_datum);
 
+	/* the values reserved before do not follow the new value */
+	AgtmSeqCacheInvalidate(dbName, schemaName, sequenceName);
+
+	pfree(sequenceName);
+	pfree(dbName);
+	pfree(schemaName);
+
 	/* Respond to the client */
 	RespondSeqToClient(seq_val,AGTM_SEQUENCE_SET_VAL_RESULT, output);
 
@@ -160,17 +337,31 @@ static	void parse_seqFullName_to_details(StringInfo message, char ** dbName,
 static Datum
 prase_to_agtm_sequence_name(StringInfo message)
 {
-	bool  isExist = FALSE;
 	char* dbName = NULL;
 	char* schemaName = NULL;
 	char* sequenceName = NULL;	
+	Datum	oid;
+
+	parse_seqFullName_to_details(message, &dbName, &schemaName, &sequenceName);
+	oid = get_agtm_sequence_oid(dbName, schemaName, sequenceName);
+
+	pfree(sequenceName);
+	pfree(dbName);
+	pfree(schemaName);
+	return oid;
+}
+
+/* map the names a coordinator sent to the relation of the sequence on AGTM */
+static Datum
+get_agtm_sequence_oid(char *dbName, char *schemaName, char *sequenceName)
+{
+	bool  isExist = FALSE;
 	StringInfoData	buf;
 	Oid			lineOid;
 	char *	agtmSeqName = NULL;
-	int		oid;
+	Datum	oid;
 
 	initStringInfo(&buf);
-	parse_seqFullName_to_details(message, &dbName, &schemaName, &sequenceName);
 	isExist = SequenceIsExist(dbName, schemaName, sequenceName);
 	if(!isExist)
 		ereport(ERROR,
@@ -185,9 +376,224 @@ prase_to_agtm_sequence_name(StringInfo message)
 	oid = GetSeqKeyToDatumOid(agtmSeqName);
 
 	pfree(agtmSeqName);
+	return oid ;
+}
+
+/*
+ * Get the next value of the sequence named in "message", or with "range"
+ * less than zero the number of values the message asks for, the last of
+ * which goes to "*last".  The values come from the shared sequence cache
+ * when it has some left.
+ */
+static int64
+agtm_seq_nextval(StringInfo message, int64 range, int64 *last)
+{
+	char* dbName = NULL;
+	char* schemaName = NULL;
+	char* sequenceName = NULL;
+	AgtmSeqCacheKey key;
+	Datum	oid;
+	int64	result;
+
+	parse_seqFullName_to_details(message, &dbName, &schemaName, &sequenceName);
+	if (range < 0)
+	{
+		memcpy(&range, pq_getmsgbytes(message, sizeof(range)), sizeof(range));
+		if (range < 1)
+			ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg("invalid sequence range " INT64_FORMAT, range)));
+	}
+	pq_getmsgend(message);
+
+	if (agtm_sequence_prealloc > 0)
+	{
+		SeqCacheMakeKey(&key, dbName, schemaName, sequenceName);
+		if (!SeqCacheFetch(&key, Max(range, 1), &result, last))
+		{
+			oid = get_agtm_sequence_oid(dbName, schemaName, sequenceName);
+			result = SeqCacheReserve(&key, DatumGetObjectId(oid),
+									 Max(range, 1), last);
+		}
+	}
+	else
+	{
+		oid = get_agtm_sequence_oid(dbName, schemaName, sequenceName);
+		if (range > 0)
+			result = nextval_range_oid(DatumGetObjectId(oid), range, last, NULL);
+		else
+			*last = result = DatumGetInt64(DirectFunctionCall1(nextval_oid, oid));
+	}
+
 	pfree(sequenceName);
 	pfree(dbName);
 	pfree(schemaName);
-	return oid ;
+	return result;
+}
+
+static void
+SeqCacheMakeKey(AgtmSeqCacheKey *key, const char *dbName,
+				const char *schemaName, const char *sequenceName)
+{
+	/* zero the padding, the whole key is hashed */
+	MemSet(key, 0, sizeof(*key));
+	namestrcpy(&key->database, dbName);
+	namestrcpy(&key->schema, schemaName);
+	namestrcpy(&key->sequence, sequenceName);
+}
+
+/*
+ * Take up to "range" values from the cached block of a sequence.  Returns
+ * false if the sequence has no values cached.
+ */
+static bool
+SeqCacheFetch(AgtmSeqCacheKey *key, int64 range, int64 *first, int64 *last)
+{
+	AgtmSeqCacheEntry *entry;
+	bool		found = false;
+
+	LWLockAcquire(AgtmSequenceCacheLock, LW_SHARED);
+
+	entry = (AgtmSeqCacheEntry *) hash_search(SeqCacheHash, key,
+											  HASH_FIND, NULL);
+	if (entry != NULL)
+	{
+		volatile AgtmSeqCacheEntry *ventry = entry;
+
+		SpinLockAcquire(&ventry->mutex);
+		if (ventry->valid)
+		{
+			int64		next = ventry->next;
+
+			if (!SeqBlockTake(&next, ventry->last, ventry->increment,
+							  range, first, last))
+				ventry->valid = false;
+			ventry->next = next;
+			found = true;
+		}
+		SpinLockRelease(&ventry->mutex);
+	}
+
+	LWLockRelease(AgtmSequenceCacheLock);
+
+	return found;
+}
+
+/*
+ * Reserve a new block of values for a sequence whose cached values are
+ * used up, take "range" values from it and cache the rest.
+ */
+static int64
+SeqCacheReserve(AgtmSeqCacheKey *key, Oid relid, int64 range, int64 *last)
+{
+	AgtmSeqCacheEntry *entry;
+	bool		found;
+	uint64		generation = 0;
+	int64		next;
+	int64		block_last;
+	int64		increment;
+	int64		result;
+
+	/* find or make the entry and remember which one it is */
+	LWLockAcquire(AgtmSequenceCacheLock, LW_EXCLUSIVE);
+	entry = (AgtmSeqCacheEntry *) hash_search(SeqCacheHash, key,
+											  HASH_ENTER_NULL, &found);
+	if (entry != NULL)
+	{
+		volatile AgtmSeqCacheEntry *ventry = entry;
+
+		if (!found)
+		{
+			entry->generation = ++SeqCacheShared->generation;
+			SpinLockInit(&entry->mutex);
+			entry->valid = false;
+		}
+		generation = entry->generation;
+
+		/* another request may have reserved a block since we looked */
+		SpinLockAcquire(&ventry->mutex);
+		found = ventry->valid;
+		if (found)
+		{
+			next = ventry->next;
+			if (!SeqBlockTake(&next, ventry->last, ventry->increment,
+							  range, &result, last))
+				ventry->valid = false;
+			ventry->next = next;
+		}
+		SpinLockRelease(&ventry->mutex);
+	}
+	LWLockRelease(AgtmSequenceCacheLock);
+
+	if (entry != NULL && found)
+		return result;
+
+	/* with the cache full, just serve this request */
+	next = nextval_range_oid(relid, Max(range, agtm_sequence_prealloc),
+							 &block_last, &increment);
+	if (!SeqBlockTake(&next, block_last, increment, range, &result, last) ||
+		entry == NULL)
+		return result;
+
+	LWLockAcquire(AgtmSequenceCacheLock, LW_SHARED);
+	entry = (AgtmSeqCacheEntry *) hash_search(SeqCacheHash, key,
+											  HASH_FIND, NULL);
+	if (entry != NULL && entry->generation == generation)
+	{
+		volatile AgtmSeqCacheEntry *ventry = entry;
+
+		SpinLockAcquire(&ventry->mutex);
+		if (!ventry->valid)
+		{
+			ventry->next = next;
+			ventry->last = block_last;
+			ventry->increment = increment;
+			ventry->valid = true;
+		}
+		SpinLockRelease(&ventry->mutex);
+	}
+	LWLockRelease(AgtmSequenceCacheLock);
+
+	return result;
+}
+
+/*
+ * Take up to "range" values from the block "*next" .. "last".  Returns
+ * false if that used up the block, otherwise "*next" is advanced.
+ */
+static bool
+SeqBlockTake(int64 *next, int64 last, int64 increment, int64 range,
+			 int64 *first, int64 *taken_last)
+{
+	uint64		step;
+	uint64		avail;
+	uint64		take;
+
+	Assert(increment != 0 && range > 0);
+
+	/* unsigned arithmetic, the span may exceed INT64_MAX */
+	if (increment > 0)
+	{
+		step = (uint64) increment;
+		avail = ((uint64) last - (uint64) *next) / step + 1;
+	}
+	else
+	{
+		step = (uint64) 0 - (uint64) increment;
+		avail = ((uint64) *next - (uint64) last) / step + 1;
+	}
+	take = Min(avail, (uint64) range);
+
+	*first = *next;
+	if (increment > 0)
+		*taken_last = (int64) ((uint64) *first + (take - 1) * step);
+	else
+		*taken_last = (int64) ((uint64) *first - (take - 1) * step);
+
+	if (take == avail)
+		return false;
+
+	*next = *taken_last + increment;
+	return true;
 }
 
@@ -0,0 +1,400 @@
+/*-------------------------------------------------------------------------
+ *
+ * agtm_stats.c
+ *
+ *	  Statistics of the messages exchanged with AGTM.
+ *
+ * For every message type this counts the requests, their bytes both ways,
+ * their total and maximum time and a histogram of their times, plus the
+ * sizes of the snapshots.  AGTM counts the requests it serves, timed from
+ * reading the request to sending its answer; a coordinator or datanode,
+ * which links this file into libagtm, counts the requests it sends, timed
+ * as round trips seen by the backend.  Either way the counters are kept in
+ * shared memory and reset by pg_agtm_stat_reset().
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/agtm/main/agtm_stats.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "agtm/agtm_stats.h"
+#include "agtm/agtm_utils.h"
+#include "catalog/pg_type.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/tuplestore.h"
+#ifdef ADB
+#include "agtm/agtm.h"
+#include "agtm/agtm_client.h"
+#include "libpq/libpq-fe.h"
+#include "pgxc/pgxc.h"
+#endif
+
+typedef struct AgtmMessageStats
+{
+	uint64		calls;
+	uint64		request_bytes;
+	uint64		response_bytes;
+	uint64		total_time;		/* in microseconds */
+	uint64		max_time;		/* in microseconds */
+	uint64		hist[AGTM_STAT_HIST_BUCKETS];
+} AgtmMessageStats;
+
+typedef struct AgtmSnapshotStats
+{
+	uint64		snapshots;
+	uint64		total_xcnt;
+	uint64		total_subxcnt;
+	uint32		max_xcnt;
+	uint32		max_subxcnt;
+} AgtmSnapshotStats;
+
+typedef struct AgtmStatsData
+{
+	slock_t		mutex;			/* protects everything below */
+	AgtmMessageStats messages[AGTM_MSG_TYPE_COUNT];
+	AgtmSnapshotStats snapshots;
+} AgtmStatsData;
+
+#define AGTM_STAT_MESSAGES_COLS		7
+#define AGTM_STAT_SNAPSHOTS_COLS	5
+
+static AgtmStatsData *AgtmStats = NULL;
+
+static Tuplestorestate *agtm_stats_tuplestore(FunctionCallInfo fcinfo,
+					  TupleDesc *tupdesc);
+
+/* Report shared memory space needed by AgtmStatsShmemInit */
+Size
+AgtmStatsShmemSize(void)
+{
+	return sizeof(AgtmStatsData);
+}
+
+/* Allocate and initialize AGTM statistics shared memory */
+void
+AgtmStatsShmemInit(void)
+{
+	bool		found;
+
+	AgtmStats = (AgtmStatsData *)
+		ShmemInitStruct("AGTM Statistics", AgtmStatsShmemSize(), &found);
+
+	if (!found)
+	{
+		/* First time through, so initialize */
+		MemSet(AgtmStats, 0, AgtmStatsShmemSize());
+		SpinLockInit(&AgtmStats->mutex);
+	}
+}
+
+/*
+ * AgtmStatsCountMessage
+ *
+ * Add bytes to the counters of "mtype" and, unless "start" is NULL, count
+ * a request which began at *start and just finished.
+ */
+void
+AgtmStatsCountMessage(AGTM_MessageType mtype, uint32 request_bytes,
+					  uint32 response_bytes, instr_time *start)
+{
+	volatile AgtmStatsData *stats = AgtmStats;
+	volatile AgtmMessageStats *msg;
+	uint64		usec = 0;
+	int			bucket = 0;
+
+	if (stats == NULL || mtype >= AGTM_MSG_TYPE_COUNT)
+		return;
+
+	if (start != NULL)
+	{
+		instr_time	duration;
+		uint64		val;
+
+		INSTR_TIME_SET_CURRENT(duration);
+		INSTR_TIME_SUBTRACT(duration, *start);
+		usec = INSTR_TIME_GET_MICROSEC(duration);
+
+		for (val = usec; val >= 2 && bucket < AGTM_STAT_HIST_BUCKETS - 1; val >>= 1)
+			bucket++;
+	}
+
+	msg = &stats->messages[mtype];
+	SpinLockAcquire(&stats->mutex);
+	msg->request_bytes += request_bytes;
+	msg->response_bytes += response_bytes;
+	if (start != NULL)
+	{
+		msg->calls++;
+		msg->total_time += usec;
+		if (usec > msg->max_time)
+			msg->max_time = usec;
+		msg->hist[bucket]++;
+	}
+	SpinLockRelease(&stats->mutex);
+}
+
+/* Count a snapshot of "xcnt" running xids and "subxcnt" subxids */
+void
+AgtmStatsCountSnapshot(uint32 xcnt, uint32 subxcnt)
+{
+	volatile AgtmStatsData *stats = AgtmStats;
+
+	if (stats == NULL)
+		return;
+
+	SpinLockAcquire(&stats->mutex);
+	stats->snapshots.snapshots++;
+	stats->snapshots.total_xcnt += xcnt;
+	stats->snapshots.total_subxcnt += subxcnt;
+	if (xcnt > stats->snapshots.max_xcnt)
+		stats->snapshots.max_xcnt = xcnt;
+	if (subxcnt > stats->snapshots.max_subxcnt)
+		stats->snapshots.max_subxcnt = subxcnt;
+	SpinLockRelease(&stats->mutex);
+}
+
+/* Set up the tuplestore a materialize mode SRF returns its rows in */
+static Tuplestorestate *
+agtm_stats_tuplestore(FunctionCallInfo fcinfo, TupleDesc *tupdesc)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	Tuplestorestate *tupstore;
+	MemoryContext oldcontext;
+
+	/* check to see if caller supports us returning a tuplestore */
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not " \
+						"allowed in this context")));
+
+	if (get_call_result_type(fcinfo, NULL, tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+	*tupdesc = CreateTupleDescCopy(*tupdesc);
+	tupstore = tuplestore_begin_heap(true, false, work_mem);
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = *tupdesc;
+	MemoryContextSwitchTo(oldcontext);
+
+	return tupstore;
+}
+
+/*
+ * SQL function backing the pg_agtm_stat_messages view, one row per message
+ * type.  Times are in milliseconds.
+ */
+Datum
+pg_agtm_stat_messages(PG_FUNCTION_ARGS)
+{
+	volatile AgtmStatsData *stats = AgtmStats;
+	AgtmMessageStats messages[AGTM_MSG_TYPE_COUNT];
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	int			i;
+
+	tupstore = agtm_stats_tuplestore(fcinfo, &tupdesc);
+
+	if (stats == NULL)
+		MemSet(messages, 0, sizeof(messages));
+	else
+	{
+		SpinLockAcquire(&stats->mutex);
+		memcpy(messages, (char *) stats->messages, sizeof(messages));
+		SpinLockRelease(&stats->mutex);
+	}
+
+	for (i = 0; i < AGTM_MSG_TYPE_COUNT; i++)
+	{
+		AgtmMessageStats *msg = &messages[i];
+		Datum		values[AGTM_STAT_MESSAGES_COLS];
+		bool		nulls[AGTM_STAT_MESSAGES_COLS];
+		Datum		hist[AGTM_STAT_HIST_BUCKETS];
+		int			j;
+
+		for (j = 0; j < AGTM_STAT_HIST_BUCKETS; j++)
+			hist[j] = Int64GetDatum((int64) msg->hist[j]);
+
+		MemSet(nulls, 0, sizeof(nulls));
+		values[0] = CStringGetTextDatum(gtm_util_message_name((AGTM_MessageType) i));
+		values[1] = Int64GetDatum((int64) msg->calls);
+		values[2] = Int64GetDatum((int64) msg->request_bytes);
+		values[3] = Int64GetDatum((int64) msg->response_bytes);
+		values[4] = Float8GetDatum((double) msg->total_time / 1000.0);
+		values[5] = Float8GetDatum((double) msg->max_time / 1000.0);
+		values[6] = PointerGetDatum(construct_array(hist, AGTM_STAT_HIST_BUCKETS,
+													INT8OID, sizeof(int64),
+													FLOAT8PASSBYVAL, 'd'));
+
+		tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+	}
+
+	tuplestore_donestoring(tupstore);
+	return (Datum) 0;
+}
+
+/* SQL function backing the pg_agtm_stat_snapshots view */
+Datum
+pg_agtm_stat_snapshots(PG_FUNCTION_ARGS)
+{
+	volatile AgtmStatsData *stats = AgtmStats;
+	AgtmSnapshotStats snapshots;
+	TupleDesc	tupdesc;
+	Datum		values[AGTM_STAT_SNAPSHOTS_COLS];
+	bool		nulls[AGTM_STAT_SNAPSHOTS_COLS];
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	if (stats == NULL)
+		MemSet(&snapshots, 0, sizeof(snapshots));
+	else
+	{
+		SpinLockAcquire(&stats->mutex);
+		memcpy(&snapshots, (char *) &stats->snapshots, sizeof(snapshots));
+		SpinLockRelease(&stats->mutex);
+	}
+
+	MemSet(nulls, 0, sizeof(nulls));
+	values[0] = Int64GetDatum((int64) snapshots.snapshots);
+	if (snapshots.snapshots == 0)
+	{
+		nulls[1] = true;
+		nulls[3] = true;
+		values[1] = values[3] = (Datum) 0;
+	} else
+	{
+		values[1] = Float8GetDatum((double) snapshots.total_xcnt /
+								   (double) snapshots.snapshots);
+		values[3] = Float8GetDatum((double) snapshots.total_subxcnt /
+								   (double) snapshots.snapshots);
+	}
+	values[2] = Int64GetDatum((int64) snapshots.max_xcnt);
+	values[4] = Int64GetDatum((int64) snapshots.max_subxcnt);
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
+
+/* Zero all the counters */
+Datum
+pg_agtm_stat_reset(PG_FUNCTION_ARGS)
+{
+	volatile AgtmStatsData *stats = AgtmStats;
+
+	if (!superuser())
+		ereport(ERROR,
+				(errcode(ERRCODE_INSUFFICIENT_PRIVILEGE),
+				 errmsg("must be superuser to reset statistics counters")));
+
+	if (stats != NULL)
+	{
+		SpinLockAcquire(&stats->mutex);
+		MemSet((char *) stats->messages, 0, sizeof(stats->messages));
+		MemSet((char *) &stats->snapshots, 0, sizeof(stats->snapshots));
+		SpinLockRelease(&stats->mutex);
+	}
+
+	PG_RETURN_VOID();
+}
+
+#ifdef ADB
+/*
+ * Run "query" on AGTM and return its rows, which must match the result type
+ * of the calling function.
+ */
+static Datum
+agtm_fetch_server_stats(FunctionCallInfo fcinfo, const char *query)
+{
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	AttInMetadata *attinmeta;
+	PGconn	   *conn;
+	PGresult   *volatile res;
+
+	if (!IsUnderAGTM())
+		ereport(ERROR,
+				(errmsg("AGTM statistics can only be fetched under AGTM")));
+
+	tupstore = agtm_stats_tuplestore(fcinfo, &tupdesc);
+	attinmeta = TupleDescGetAttInMetadata(tupdesc);
+
+	conn = getAgtmConnection();
+
+	/* PQexec can not see results of pipelined requests, read them first */
+	agtm_ReadPending();
+
+	res = PQexec(conn, query);
+	PG_TRY();
+	{
+		char	  **values;
+		int			nrows;
+		int			i, j;
+
+		if (PQresultStatus(res) != PGRES_TUPLES_OK)
+			ereport(ERROR,
+					(errmsg("could not fetch statistics from AGTM: %s",
+							PQerrorMessage(conn))));
+		if (PQnfields(res) != tupdesc->natts)
+			ereport(ERROR,
+					(errmsg("AGTM returned %d columns of statistics, expected %d",
+							PQnfields(res), tupdesc->natts)));
+
+		values = (char **) palloc(tupdesc->natts * sizeof(char *));
+		nrows = PQntuples(res);
+		for (i = 0; i < nrows; i++)
+		{
+			HeapTuple	tuple;
+
+			for (j = 0; j < tupdesc->natts; j++)
+				values[j] = PQgetisnull(res, i, j) ? NULL : PQgetvalue(res, i, j);
+
+			tuple = BuildTupleFromCStrings(attinmeta, values);
+			tuplestore_puttuple(tupstore, tuple);
+			heap_freetuple(tuple);
+		}
+		pfree(values);
+	}
+	PG_CATCH();
+	{
+		PQclear(res);
+		PG_RE_THROW();
+	}
+	PG_END_TRY();
+	PQclear(res);
+
+	tuplestore_donestoring(tupstore);
+	return (Datum) 0;
+}
+
+/* pg_agtm_stat_messages of AGTM, seen from a coordinator or datanode */
+Datum
+pg_agtm_server_stat_messages(PG_FUNCTION_ARGS)
+{
+	return agtm_fetch_server_stats(fcinfo,
+								   "SELECT * FROM pg_agtm_stat_messages()");
+}
+
+/* pg_agtm_stat_snapshots of AGTM, seen from a coordinator or datanode */
+Datum
+pg_agtm_server_stat_snapshots(PG_FUNCTION_ARGS)
+{
+	return agtm_fetch_server_stats(fcinfo,
+								   "SELECT * FROM pg_agtm_stat_snapshots()");
+}
+#endif   /* ADB */
@@ -7,7 +7,10 @@
 #include "agtm/agtm.h"
 #include "agtm/agtm_msg.h"
 #include "agtm/agtm_protocol.h"
+#include "agtm/agtm_sequence.h"
+#include "agtm/agtm_stats.h"
 #include "agtm/agtm_transaction.h"
+#include "agtm/agtm_utils.h"
 #include "catalog/agtm_sequence.h"
 #include "commands/sequence.h"
 #include "commands/tablecmds.h"
@@ -24,6 +27,36 @@
 #include "utils/snapmgr.h"
 #include "utils/timestamp.h"
 
+static SnapshotData GlobalAgtmSnapshotData = {
+	NULL,
+	InvalidTransactionId,
+	InvalidTransactionId,
+	NULL,
+	0,
+	0,
+	NULL,
+	false,
+	false,
+	false,
+	0,
+	0,
+	0,
+#ifdef ADB
+	0,
+#endif /* ADB */
+	};
+
+/*
+ * Running xids of the last compact snapshot sent to this client, sorted by
+ * agtm_sort_xids().  The client sends back the id of the snapshot it holds,
+ * when that is still "last_compact_id" only the difference is sent.
+ */
+static TransactionId *last_compact_xip = NULL;
+static uint32 last_compact_xcnt = 0;
+static uint32 last_compact_max = 0;
+static uint32 last_compact_id = 0;
+static TransactionId last_compact_xmin = InvalidTransactionId;
+
 static List* parse_string_to_seqOption(StringInfo strOption);
 
 static	void parse_seqFullName_to_details(StringInfo message, char ** dbName, 
@@ -71,28 +104,11 @@ StringInfo ProcessGetSnapshot(StringInfo message, StringInfo output)
 {
 	Snapshot			snapshot;
 	TimestampTz			globalXactStartTimestamp;
-	static SnapshotData GlobalAgtmSnapshotData = {
-		NULL,
-		InvalidTransactionId,
-		InvalidTransactionId,
-		NULL,
-		0,
-		0,
-		NULL,
-		false,
-		false,
-		false,
-		0,
-		0,
-		0,
-#ifdef ADB
-		0,
-#endif /* ADB */
-		};
 
 	pq_getmsgend(message);
 	globalXactStartTimestamp = GetCurrentTimestamp();
-	snapshot = GetSnapshotData(&GlobalAgtmSnapshotData);
+	snapshot = GetAgtmSnapshotData(&GlobalAgtmSnapshotData);
+	AgtmStatsCountSnapshot(snapshot->xcnt, snapshot->subxcnt);
 
 	/* Respond to the client */
 	pq_sendint(output, AGTM_SNAPSHOT_GET_RESULT, 4);
@@ -120,6 +136,135 @@ StringInfo ProcessGetSnapshot(StringInfo message, StringInfo output)
 	return output;
 }
 
+/*
+ * Same snapshot as ProcessGetSnapshot, xids are sent by agtm_put_xid_list()
+ * and, when the client still holds the last snapshot we sent it, only the
+ * running xids which finished or started since then.
+ *
+ * Reply layout after the result type:
+ *   timestamp, RecentGlobalXmin, xmin, xmax	as ProcessGetSnapshot
+ *   int4 snapshot id
+ *   byte 'F' + xid list of xip, based on xmin
+ *   or byte 'D' + removed list based on the old xmin + added list based on xmin
+ *   xid list of subxip based on xmin, then the trailing ProcessGetSnapshot fields
+ */
+StringInfo
+ProcessGetSnapshotCompact(StringInfo message, StringInfo output)
+{
+	Snapshot			snapshot;
+	TimestampTz			globalXactStartTimestamp;
+	TransactionId	   *new_xip;
+	TransactionId	   *removed;
+	TransactionId	   *added;
+	uint32				base_id;
+	uint32				new_id;
+	uint32				nremoved;
+	uint32				nadded;
+	uint32				i, j;
+	MemoryContext		oldcontext;
+
+	base_id = (uint32) pq_getmsgint(message, 4);
+	pq_getmsgend(message);
+	globalXactStartTimestamp = GetCurrentTimestamp();
+	snapshot = GetAgtmSnapshotData(&GlobalAgtmSnapshotData);
+	AgtmStatsCountSnapshot(snapshot->xcnt, snapshot->subxcnt);
+
+	oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+	if (last_compact_xip == NULL)
+	{
+		last_compact_max = Max(snapshot->xcnt, 64);
+		last_compact_xip = palloc(last_compact_max * sizeof(TransactionId));
+	}
+	MemoryContextSwitchTo(oldcontext);
+
+	new_xip = palloc(Max(snapshot->xcnt, 1) * sizeof(TransactionId));
+	memcpy(new_xip, snapshot->xip, snapshot->xcnt * sizeof(TransactionId));
+	agtm_sort_xids(new_xip, snapshot->xcnt);
+	agtm_sort_xids(snapshot->subxip, snapshot->subxcnt);
+
+	/* Respond to the client */
+	pq_sendint(output, AGTM_SNAPSHOT_GET_COMPACT_RESULT, 4);
+
+	pq_sendbytes(output, (char *)&globalXactStartTimestamp, sizeof (globalXactStartTimestamp));
+	pq_sendbytes(output, (char *)&RecentGlobalXmin, sizeof (TransactionId));
+	pq_sendbytes(output, (char *)&snapshot->xmin, sizeof (TransactionId));
+	pq_sendbytes(output, (char *)&snapshot->xmax, sizeof (TransactionId));
+
+	new_id = last_compact_id + 1;
+	if (new_id == 0)
+		new_id = 1;
+	pq_sendint(output, new_id, 4);
+
+	nremoved = nadded = 0;
+	removed = added = NULL;
+	if (base_id != 0 && base_id == last_compact_id)
+	{
+		removed = palloc(Max(last_compact_xcnt, 1) * sizeof(TransactionId));
+		added = palloc(Max(snapshot->xcnt, 1) * sizeof(TransactionId));
+
+		/* both arrays are sorted, so one merge pass finds the difference */
+		i = j = 0;
+		while (i < last_compact_xcnt || j < snapshot->xcnt)
+		{
+			int		cmp;
+
+			if (i >= last_compact_xcnt)
+				cmp = 1;
+			else if (j >= snapshot->xcnt)
+				cmp = -1;
+			else
+				cmp = agtm_xid_cmp(last_compact_xip[i], new_xip[j]);
+
+			if (cmp < 0)
+				removed[nremoved++] = last_compact_xip[i++];
+			else if (cmp > 0)
+				added[nadded++] = new_xip[j++];
+			else
+				++i, ++j;
+		}
+	}
+
+	if (removed != NULL && nremoved + nadded < snapshot->xcnt)
+	{
+		pq_sendbyte(output, 'D');
+		agtm_put_xid_list(output, last_compact_xmin, removed, nremoved);
+		agtm_put_xid_list(output, snapshot->xmin, added, nadded);
+	} else
+	{
+		pq_sendbyte(output, 'F');
+		agtm_put_xid_list(output, snapshot->xmin, new_xip, snapshot->xcnt);
+	}
+
+	agtm_put_xid_list(output, snapshot->xmin, snapshot->subxip, snapshot->subxcnt);
+
+	pq_sendbytes(output, (char *)&snapshot->suboverflowed, sizeof(snapshot->suboverflowed));
+	pq_sendbytes(output, (char *)&snapshot->takenDuringRecovery, sizeof(snapshot->takenDuringRecovery));
+	pq_sendbytes(output, (char *)&snapshot->curcid, sizeof(snapshot->curcid));
+	pq_sendbytes(output, (char *)&snapshot->active_count, sizeof(snapshot->active_count));
+	pq_sendbytes(output, (char *)&snapshot->regd_count, sizeof(snapshot->regd_count));
+
+	/* remember what the client will hold once it has read this reply */
+	if (snapshot->xcnt > last_compact_max)
+	{
+		last_compact_max = snapshot->xcnt;
+		last_compact_xip = repalloc(last_compact_xip,
+									last_compact_max * sizeof(TransactionId));
+	}
+	memcpy(last_compact_xip, new_xip, snapshot->xcnt * sizeof(TransactionId));
+	last_compact_xcnt = snapshot->xcnt;
+	last_compact_xmin = snapshot->xmin;
+	last_compact_id = new_id;
+
+	pfree(new_xip);
+	if (removed != NULL)
+	{
+		pfree(removed);
+		pfree(added);
+	}
+
+	return output;
+}
+
 StringInfo
 ProcessGetXactStatus(StringInfo message, StringInfo output)
 {
@@ -272,6 +417,7 @@ ProcessSequenceAlter(StringInfo message, StringInfo output)
 	seqStmt->options = option;
 
 	AlterSequence(seqStmt);
+	AgtmSeqCacheInvalidate(dbName, schemaName, sequenceName);
 
 	(void)MemoryContextSwitchTo(oldctx);
 	MemoryContextDelete(sequece_Context);
@@ -336,6 +482,7 @@ ProcessSequenceDrop(StringInfo message, StringInfo output)
 	drop->objects = lappend(drop->objects, (void*)rangValList);
 
 	RemoveRelations((void *)drop);
+	AgtmSeqCacheInvalidate(dbName, schemaName, sequenceName);
 
 	(void)MemoryContextSwitchTo(oldctx);
 	MemoryContextDelete(sequece_Context);
@@ -400,6 +547,7 @@ ProcessSequenceDropByDatabase(StringInfo message, StringInfo output)
 			RemoveRelations((void *)drop);
 		}
 	}
+	AgtmSeqCacheInvalidate(database, NULL, NULL);
 
 	(void)MemoryContextSwitchTo(oldctx);
 	MemoryContextDelete(sequece_Context);
@@ -445,12 +593,15 @@ ProcessSequenceRename(StringInfo message, StringInfo output)
 	{
 		case T_RENAME_SEQUENCE:
 			UpdateSequenceInfo(dbName, schemaName, sequenceName, newName, T_AgtmSeqName);
+			AgtmSeqCacheInvalidate(dbName, schemaName, sequenceName);
 			break;
 		case T_RENAME_SCHEMA:
 			UpdateSequenceInfo(dbName, schemaName, sequenceName, newName, T_AgtmSeqSchema);
+			AgtmSeqCacheInvalidate(dbName, schemaName, NULL);
 			break;
 		case T_RENAME_DATABASE:
 			UpdateSequenceInfo(dbName, schemaName, sequenceName, newName, T_AgtmseqDatabase);
+			AgtmSeqCacheInvalidate(dbName, NULL, NULL);
 			break;
 		default:
 			ereport(ERROR,
@@ -496,6 +647,7 @@ ProcessSequenceRenameByDatabase(StringInfo message, StringInfo output)
 			(errmsg("sequence database name is null")));
 
 	UpdateSequenceDbExist(oldDataBase, newDataBase);
+	AgtmSeqCacheInvalidate(oldDataBase, NULL, NULL);
 	(void)MemoryContextSwitchTo(oldctx);
 	MemoryContextDelete(sequece_Context);
 
@@ -2,6 +2,7 @@
 
 #include "agtm/agtm_msg.h"
 #include "agtm/agtm_utils.h"
+#include "libpq/pqformat.h"
 
 #define CASE_TYPE_(t)	\
 	case t:				\
@@ -28,6 +29,8 @@ const char *gtm_util_message_name(AGTM_MessageType type)
 	CASE_TYPE_(AGTM_MSG_SEQUENCE_GET_LAST);
 	CASE_TYPE_(AGTM_MSG_SEQUENCE_SET_VAL);
 	CASE_TYPE_(AGTM_MSG_GET_STATUS);
+	CASE_TYPE_(AGTM_MSG_SNAPSHOT_GET_COMPACT);
+	CASE_TYPE_(AGTM_MSG_SEQUENCE_GET_RANGE);
 	/* here no default, we need a compiler warning */
 	}
 	return "Unknown AGTM_MessageType";
@@ -55,8 +58,115 @@ const char *gtm_util_result_name(AGTM_ResultType type)
 	CASE_TYPE_(AGTM_SEQUENCE_GET_LAST_RESULT);
 	CASE_TYPE_(AGTM_SEQUENCE_SET_VAL_RESULT);
 	CASE_TYPE_(AGTM_COMPLETE_RESULT);
+	CASE_TYPE_(AGTM_SNAPSHOT_GET_COMPACT_RESULT);
+	CASE_TYPE_(AGTM_SEQUENCE_GET_RANGE_RESULT);
 	/* here no default, we need a compiler warning */
 	}
 	return "Unknown AGTM_ResultType";
 }
 
+
+/*
+ * Compact xid list encoding used by AGTM_MSG_SNAPSHOT_GET_COMPACT.
+ *
+ * A list is sent as its length followed by the distance of each xid from
+ * the previous one (the first one from "base"), all as unsigned varints of
+ * seven bits per byte.  The arithmetic is modulo 2^32, so any xid array is
+ * encoded losslessly, but only a list sorted by agtm_sort_xids() is also a
+ * short one: a few thousand running xids normally take one or two bytes
+ * each instead of four.
+ */
+void
+agtm_put_varint(StringInfo buf, uint32 val)
+{
+	while (val >= 0x80)
+	{
+		pq_sendbyte(buf, (int) ((val & 0x7F) | 0x80));
+		val >>= 7;
+	}
+	pq_sendbyte(buf, (int) val);
+}
+
+uint32
+agtm_get_varint(StringInfo msg)
+{
+	uint32		result = 0;
+	int			shift = 0;
+	int			c;
+
+	do
+	{
+		if (shift > 28)
+			ereport(ERROR,
+					(errcode(ERRCODE_PROTOCOL_VIOLATION),
+					 errmsg("invalid varint in AGTM message")));
+		c = pq_getmsgbyte(msg);
+		result |= ((uint32) (c & 0x7F)) << shift;
+		shift += 7;
+	} while (c & 0x80);
+
+	return result;
+}
+
+void
+agtm_put_xid_list(StringInfo buf, TransactionId base,
+				  const TransactionId *xids, uint32 count)
+{
+	uint32		i;
+
+	agtm_put_varint(buf, count);
+	for (i = 0; i < count; i++)
+	{
+		agtm_put_varint(buf, xids[i] - base);
+		base = xids[i];
+	}
+}
+
+/*
+ * Read "count" xids encoded by agtm_put_xid_list(), the count itself must
+ * have been read already by agtm_get_varint().  Only the first "max" xids
+ * are stored, the others are consumed from the message.
+ */
+void
+agtm_get_xid_list(StringInfo msg, TransactionId base, uint32 count,
+				  TransactionId *xids, uint32 max)
+{
+	uint32		i;
+
+	for (i = 0; i < count; i++)
+	{
+		base += agtm_get_varint(msg);
+		if (i < max)
+			xids[i] = base;
+	}
+}
+
+/*
+ * Running xids always lie within 2^31 of each other, so compare them the
+ * way TransactionIdPrecedes() does, a wraparound must not break the order.
+ */
+static int
+xid_circular_cmp(const void *a, const void *b)
+{
+	int32		diff = (int32) (*(const TransactionId *) a -
+								*(const TransactionId *) b);
+
+	if (diff < 0)
+		return -1;
+	if (diff > 0)
+		return 1;
+	return 0;
+}
+
+void
+agtm_sort_xids(TransactionId *xids, uint32 count)
+{
+	if (count > 1)
+		qsort(xids, count, sizeof(TransactionId), xid_circular_cmp);
+}
+
+int
+agtm_xid_cmp(TransactionId a, TransactionId b)
+{
+	return xid_circular_cmp(&a, &b);
+}
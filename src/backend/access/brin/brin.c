@@ -0,0 +1,1120 @@
+/*-------------------------------------------------------------------------
+ *
+ * brin.c
+ *	  Implementation of BRIN indexes for Postgres
+ *
+ * A BRIN index keeps, for each range of pagesPerRange consecutive heap
+ * pages, the minimum and the maximum of each indexed column over the range.
+ * A bitmap scan returns all the pages of the ranges whose summary can match
+ * the scan keys, and relies on the heap scan to recheck every tuple.  This
+ * makes for a tiny index, well suited to large tables whose physical order
+ * follows the indexed values, such as append-only fact tables.
+ *
+ * Ranges are summarized when the index is built, and later by VACUUM or by
+ * brin_summarize_new_values().  Insertions only widen existing summaries;
+ * a range that hasn't been summarized yet is always scanned.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *			src/backend/access/brin/brin.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/brin_private.h"
+#include "access/genam.h"
+#include "access/heapam.h"
+#include "access/heapam_xlog.h"
+#include "access/reloptions.h"
+#include "access/relscan.h"
+#include "catalog/index.h"
+#include "catalog/pg_am.h"
+#include "miscadmin.h"
+#include "nodes/tidbitmap.h"
+#include "pgstat.h"
+#include "storage/bufmgr.h"
+#include "storage/freespace.h"
+#include "storage/smgr.h"
+#include "utils/acl.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+
+
+/*
+ * We use a BrinBuildState during initial construction of a BRIN index,
+ * and when summarizing ranges later on.  The running state is kept in a
+ * BrinMemTuple.
+ */
+typedef struct BrinBuildState
+{
+	Relation	bs_irel;
+	int			bs_numtuples;
+	Buffer		bs_currentInsertBuf;
+	BlockNumber bs_pagesPerRange;
+	BlockNumber bs_currRangeStart;
+	BrinRevmap *bs_rmAccess;
+	BrinDesc   *bs_bdesc;
+	BrinMemTuple *bs_dtuple;
+} BrinBuildState;
+
+/*
+ * Struct used as "opaque" during index scans
+ */
+typedef struct BrinOpaque
+{
+	BlockNumber bo_pagesPerRange;
+	BrinRevmap *bo_rmAccess;
+	BrinDesc   *bo_bdesc;
+	FmgrInfo   *bo_cmpprocs;	/* comparison function of each scan key */
+} BrinOpaque;
+
+static BrinBuildState *initialize_brin_buildstate(Relation idxRel,
+						   BrinRevmap *revmap, BlockNumber pagesPerRange);
+static void terminate_brin_buildstate(BrinBuildState *state);
+static void brinsummarize(Relation index, Relation heapRel,
+			  double *numSummarized, double *numExisting);
+static void summarize_range(IndexInfo *indexInfo, BrinBuildState *state,
+				Relation heapRel, BlockNumber heapBlk,
+				BlockNumber heapNumBlks, bool havePlaceholder);
+static void form_and_insert_tuple(BrinBuildState *state);
+static FmgrInfo *brin_scankey_procs(IndexScanDesc scan);
+static bool brin_range_consistent(BrinMemTuple *dtup, ScanKey keys,
+					  int nkeys, FmgrInfo *cmpprocs);
+
+
+/*
+ * A tuple in the heap is being inserted.  To keep a brin index up to date,
+ * we need to obtain the relevant index tuple and compare its stored values
+ * with those of the new tuple.  If the tuple values are not consistent with
+ * the summary tuple, we need to update the index tuple.
+ *
+ * If the range is not currently summarized (i.e. the revmap returns NULL for
+ * it), there's nothing to do.
+ */
+Datum
+brininsert(PG_FUNCTION_ARGS)
+{
+	Relation	idxRel = (Relation) PG_GETARG_POINTER(0);
+	Datum	   *values = (Datum *) PG_GETARG_POINTER(1);
+	bool	   *nulls = (bool *) PG_GETARG_POINTER(2);
+	ItemPointer heaptid = (ItemPointer) PG_GETARG_POINTER(3);
+
+	/* we ignore the rest of our arguments */
+	BlockNumber pagesPerRange;
+	BlockNumber heapBlk;
+	BrinDesc   *bdesc = NULL;
+	BrinRevmap *revmap;
+	Buffer		buf = InvalidBuffer;
+	MemoryContext tupcxt = NULL;
+	MemoryContext oldcxt = NULL;
+
+	revmap = brinRevmapInitialize(idxRel, &pagesPerRange);
+
+	/* normalize the block number to be the first block in the range */
+	heapBlk = ItemPointerGetBlockNumber(heaptid);
+	heapBlk = (heapBlk / pagesPerRange) * pagesPerRange;
+
+	for (;;)
+	{
+		bool		need_insert = false;
+		OffsetNumber off;
+		BrinTuple  *brtup;
+		BrinTuple  *origtup;
+		BrinTuple  *newtup;
+		BrinMemTuple *dtup;
+		Size		origsz;
+		Size		newsz;
+		int			keyno;
+
+		CHECK_FOR_INTERRUPTS();
+
+		brtup = brinGetTupleForHeapBlock(revmap, heapBlk, &buf, &off,
+										 &origsz, BUFFER_LOCK_SHARE);
+
+		/* if range is unsummarized, there's nothing to do */
+		if (!brtup)
+			break;
+
+		/* First time through? */
+		if (bdesc == NULL)
+		{
+			bdesc = brin_build_desc(idxRel);
+			tupcxt = AllocSetContextCreate(CurrentMemoryContext,
+										   "brininsert cxt",
+										   ALLOCSET_DEFAULT_MINSIZE,
+										   ALLOCSET_DEFAULT_INITSIZE,
+										   ALLOCSET_DEFAULT_MAXSIZE);
+			oldcxt = MemoryContextSwitchTo(tupcxt);
+		}
+
+		/*
+		 * Work on a copy of the tuple, so that the page can be released while
+		 * the new values are compared.
+		 */
+		origtup = brin_copy_tuple(brtup, origsz);
+		LockBuffer(buf, BUFFER_LOCK_UNLOCK);
+
+		dtup = brin_deform_tuple(bdesc, origtup);
+		for (keyno = 0; keyno < bdesc->bd_tupdesc->natts; keyno++)
+			need_insert |= brin_add_value(bdesc, dtup, keyno + 1,
+										  values[keyno], nulls[keyno]);
+
+		/* the summary already covers the new values: nothing to do */
+		if (!need_insert)
+			break;
+
+		/*
+		 * Put the widened summary in place of the old one.  If somebody else
+		 * changed the old tuple in the meantime, start over.
+		 */
+		newtup = brin_form_tuple(bdesc, heapBlk, dtup, &newsz);
+		if (brin_doupdate(idxRel, pagesPerRange, revmap, heapBlk,
+						  buf, off, origtup, origsz, newtup, newsz))
+			break;
+
+		MemoryContextResetAndDeleteChildren(tupcxt);
+	}
+
+	brinRevmapTerminate(revmap);
+	if (BufferIsValid(buf))
+		ReleaseBuffer(buf);
+	if (bdesc != NULL)
+	{
+		brin_free_desc(bdesc);
+		MemoryContextSwitchTo(oldcxt);
+		MemoryContextDelete(tupcxt);
+	}
+
+	PG_RETURN_BOOL(false);
+}
+
+/*
+ * Initialize state for a BRIN index scan.
+ *
+ * We read the metapage here to determine the pages-per-range number that this
+ * index was built with.  Note that since this cannot be changed while we're
+ * holding lock on index, it's not necessary to recompute it during brinrescan.
+ */
+Datum
+brinbeginscan(PG_FUNCTION_ARGS)
+{
+	Relation	r = (Relation) PG_GETARG_POINTER(0);
+	int			nkeys = PG_GETARG_INT32(1);
+	int			norderbys = PG_GETARG_INT32(2);
+	IndexScanDesc scan;
+	BrinOpaque *opaque;
+
+	scan = RelationGetIndexScan(r, nkeys, norderbys);
+
+	opaque = (BrinOpaque *) palloc(sizeof(BrinOpaque));
+	opaque->bo_rmAccess = brinRevmapInitialize(r, &opaque->bo_pagesPerRange);
+	opaque->bo_bdesc = brin_build_desc(r);
+	opaque->bo_cmpprocs = NULL;
+	scan->opaque = opaque;
+
+	PG_RETURN_POINTER(scan);
+}
+
+/*
+ * Execute the index scan.
+ *
+ * This works by reading index TIDs from the revmap, and obtaining the index
+ * tuples pointed to by them; the summary values in the index tuples are
+ * compared to the scan keys.  We return into the TID bitmap all the pages in
+ * ranges corresponding to index tuples that match the scan keys.
+ *
+ * If a TID from the revmap is read as InvalidTID, we know that range is
+ * unsummarized.  Pages in those ranges need to be returned regardless of scan
+ * keys.
+ */
+Datum
+bringetbitmap(PG_FUNCTION_ARGS)
+{
+	IndexScanDesc scan = (IndexScanDesc) PG_GETARG_POINTER(0);
+	TIDBitmap  *tbm = (TIDBitmap *) PG_GETARG_POINTER(1);
+	Relation	idxRel = scan->indexRelation;
+	BrinOpaque *opaque = (BrinOpaque *) scan->opaque;
+	BrinDesc   *bdesc = opaque->bo_bdesc;
+	BlockNumber pagesPerRange = opaque->bo_pagesPerRange;
+	Buffer		buf = InvalidBuffer;
+	Oid			heapOid;
+	Relation	heapRel;
+	BlockNumber nblocks;
+	BlockNumber heapBlk;
+	int64		totalpages = 0;
+	MemoryContext perRangeCxt;
+	MemoryContext oldcxt;
+
+	pgstat_count_index_scan(idxRel);
+
+	/*
+	 * We need to know the size of the table so that we know how long to
+	 * iterate on the revmap.
+	 */
+	heapOid = IndexGetRelation(RelationGetRelid(idxRel), false);
+	heapRel = heap_open(heapOid, AccessShareLock);
+	nblocks = RelationGetNumberOfBlocks(heapRel);
+	heap_close(heapRel, AccessShareLock);
+
+	/* brinrescan hasn't been called if there are no keys */
+	if (opaque->bo_cmpprocs == NULL)
+		opaque->bo_cmpprocs = brin_scankey_procs(scan);
+
+	/*
+	 * Setup and use a per-range memory context, which is reset every time we
+	 * loop below.  This avoids having to free the tuples within the loop.
+	 */
+	perRangeCxt = AllocSetContextCreate(CurrentMemoryContext,
+										"bringetbitmap cxt",
+										ALLOCSET_DEFAULT_MINSIZE,
+										ALLOCSET_DEFAULT_INITSIZE,
+										ALLOCSET_DEFAULT_MAXSIZE);
+	oldcxt = MemoryContextSwitchTo(perRangeCxt);
+
+	/*
+	 * Now scan the revmap.  We start by querying for heap page 0,
+	 * incrementing by the number of pages per range; this gives us a full
+	 * view of the table.
+	 */
+	for (heapBlk = 0; heapBlk < nblocks; heapBlk += pagesPerRange)
+	{
+		bool		addrange;
+		BrinTuple  *tup;
+		OffsetNumber off;
+		Size		size;
+
+		CHECK_FOR_INTERRUPTS();
+
+		MemoryContextResetAndDeleteChildren(perRangeCxt);
+
+		tup = brinGetTupleForHeapBlock(opaque->bo_rmAccess, heapBlk, &buf,
+									   &off, &size, BUFFER_LOCK_SHARE);
+		if (tup == NULL)
+		{
+			/* an unsummarized range can contain anything */
+			addrange = true;
+		}
+		else
+		{
+			/* so can a range whose summarization is in progress */
+			if (BrinTupleIsPlaceholder(tup))
+				addrange = true;
+			else
+			{
+				BrinMemTuple *dtup = brin_deform_tuple(bdesc, tup);
+
+				addrange = brin_range_consistent(dtup, scan->keyData,
+												 scan->numberOfKeys,
+												 opaque->bo_cmpprocs);
+			}
+			LockBuffer(buf, BUFFER_LOCK_UNLOCK);
+		}
+
+		/* add the pages in the range to the output bitmap, if needed */
+		if (addrange)
+		{
+			BlockNumber pageno;
+			BlockNumber rangeEnd = Min(nblocks, heapBlk + pagesPerRange);
+
+			for (pageno = heapBlk; pageno < rangeEnd; pageno++)
+			{
+				tbm_add_page(tbm, pageno);
+				totalpages++;
+			}
+		}
+
+		/* don't wrap around at the very end of the block number space */
+		if (heapBlk + pagesPerRange < heapBlk)
+			break;
+	}
+
+	MemoryContextSwitchTo(oldcxt);
+	MemoryContextDelete(perRangeCxt);
+
+	if (BufferIsValid(buf))
+		ReleaseBuffer(buf);
+
+	/*
+	 * XXX We have an approximation of the number of *pages* that our scan
+	 * returns, but we don't have a precise idea of the number of heap tuples
+	 * involved.
+	 */
+	PG_RETURN_INT64(totalpages * 10);
+}
+
+/*
+ * Re-initialize state for a BRIN index scan
+ */
+Datum
+brinrescan(PG_FUNCTION_ARGS)
+{
+	IndexScanDesc scan = (IndexScanDesc) PG_GETARG_POINTER(0);
+	ScanKey		scankey = (ScanKey) PG_GETARG_POINTER(1);
+
+	/* other arguments ignored */
+	BrinOpaque *opaque = (BrinOpaque *) scan->opaque;
+
+	if (scankey && scan->numberOfKeys > 0)
+		memmove(scan->keyData, scankey,
+				scan->numberOfKeys * sizeof(ScanKeyData));
+
+	if (opaque->bo_cmpprocs != NULL)
+		pfree(opaque->bo_cmpprocs);
+	opaque->bo_cmpprocs = brin_scankey_procs(scan);
+
+	PG_RETURN_VOID();
+}
+
+/*
+ * Close down a BRIN index scan
+ */
+Datum
+brinendscan(PG_FUNCTION_ARGS)
+{
+	IndexScanDesc scan = (IndexScanDesc) PG_GETARG_POINTER(0);
+	BrinOpaque *opaque = (BrinOpaque *) scan->opaque;
+
+	brinRevmapTerminate(opaque->bo_rmAccess);
+	brin_free_desc(opaque->bo_bdesc);
+	if (opaque->bo_cmpprocs != NULL)
+		pfree(opaque->bo_cmpprocs);
+	pfree(opaque);
+
+	PG_RETURN_VOID();
+}
+
+Datum
+brinmarkpos(PG_FUNCTION_ARGS)
+{
+	elog(ERROR, "BRIN does not support mark/restore");
+	PG_RETURN_VOID();
+}
+
+Datum
+brinrestrpos(PG_FUNCTION_ARGS)
+{
+	elog(ERROR, "BRIN does not support mark/restore");
+	PG_RETURN_VOID();
+}
+
+/*
+ * Per-heap-tuple callback for IndexBuildHeapScan.
+ *
+ * Note we don't worry about the page range at the end of the table here; it
+ * is present in the build state struct after we're called the last time, but
+ * not inserted into the index.  Caller must ensure to do so, if appropriate.
+ */
+static void
+brinbuildCallback(Relation index,
+				  HeapTuple htup,
+				  Datum *values,
+				  bool *isnull,
+				  bool tupleIsAlive,
+				  void *brstate)
+{
+	BrinBuildState *state = (BrinBuildState *) brstate;
+	BlockNumber thisblock;
+	int			i;
+
+	thisblock = ItemPointerGetBlockNumber(&htup->t_self);
+
+	/*
+	 * If we're in a block that belongs to a future range, summarize what
+	 * we've got and start afresh.  Note the scan might have skipped many
+	 * pages, if they were devoid of live tuples; make sure to insert index
+	 * tuples for those too.
+	 */
+	while (thisblock > state->bs_currRangeStart + state->bs_pagesPerRange - 1)
+	{
+		form_and_insert_tuple(state);
+
+		/* set state to correspond to the next range */
+		state->bs_currRangeStart += state->bs_pagesPerRange;
+
+		/* re-initialize state for it */
+		brin_memtuple_initialize(state->bs_dtuple, state->bs_bdesc);
+	}
+
+	/* Accumulate the current tuple into the running state */
+	for (i = 0; i < state->bs_bdesc->bd_tupdesc->natts; i++)
+		(void) brin_add_value(state->bs_bdesc, state->bs_dtuple, i + 1,
+							  values[i], isnull[i]);
+}
+
+/*
+ * brinbuild() -- build a new BRIN index.
+ */
+Datum
+brinbuild(PG_FUNCTION_ARGS)
+{
+	Relation	heap = (Relation) PG_GETARG_POINTER(0);
+	Relation	index = (Relation) PG_GETARG_POINTER(1);
+	IndexInfo  *indexInfo = (IndexInfo *) PG_GETARG_POINTER(2);
+	IndexBuildResult *result;
+	double		reltuples;
+	double		idxtuples;
+	BrinRevmap *revmap;
+	BrinBuildState *state;
+	Buffer		meta;
+	BlockNumber pagesPerRange;
+
+	/*
+	 * We expect to be called exactly once for any index relation.
+	 */
+	if (RelationGetNumberOfBlocks(index) != 0)
+		elog(ERROR, "index \"%s\" already contains data",
+			 RelationGetRelationName(index));
+
+	/*
+	 * Critical section not required, because on error the creation of the
+	 * whole relation will be rolled back.
+	 */
+	meta = ReadBuffer(index, P_NEW);
+	Assert(BufferGetBlockNumber(meta) == BRIN_METAPAGE_BLKNO);
+	LockBuffer(meta, BUFFER_LOCK_EXCLUSIVE);
+
+	brin_metapage_init(BufferGetPage(meta), BrinGetPagesPerRange(index),
+					   BRIN_CURRENT_VERSION);
+	MarkBufferDirty(meta);
+
+	if (RelationNeedsWAL(index))
+	{
+		xl_brin_createidx xlrec;
+		XLogRecPtr	recptr;
+		XLogRecData rdata;
+
+		xlrec.node = index->rd_node;
+		xlrec.version = BRIN_CURRENT_VERSION;
+		xlrec.pagesPerRange = BrinGetPagesPerRange(index);
+
+		rdata.buffer = InvalidBuffer;
+		rdata.data = (char *) &xlrec;
+		rdata.len = SizeOfBrinCreateIdx;
+		rdata.next = NULL;
+
+		recptr = XLogInsert(RM_BRIN_ID, XLOG_BRIN_CREATE_INDEX, &rdata);
+
+		PageSetLSN(BufferGetPage(meta), recptr);
+	}
+
+	UnlockReleaseBuffer(meta);
+
+	/*
+	 * Initialize our state, including the deformed tuple state.
+	 */
+	revmap = brinRevmapInitialize(index, &pagesPerRange);
+	state = initialize_brin_buildstate(index, revmap, pagesPerRange);
+
+	/*
+	 * Now scan the relation.  No syncscan allowed here because we want the
+	 * heap blocks in physical order.
+	 */
+	reltuples = IndexBuildHeapScan(heap, index, indexInfo, false,
+								   brinbuildCallback, (void *) state);
+
+	/* process the final batch */
+	form_and_insert_tuple(state);
+
+	/* release resources */
+	idxtuples = state->bs_numtuples;
+	brinRevmapTerminate(state->bs_rmAccess);
+	terminate_brin_buildstate(state);
+
+	/*
+	 * Return statistics
+	 */
+	result = (IndexBuildResult *) palloc(sizeof(IndexBuildResult));
+
+	result->heap_tuples = reltuples;
+	result->index_tuples = idxtuples;
+
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ * brinbuildempty() -- build an empty BRIN index in the initialization fork
+ */
+Datum
+brinbuildempty(PG_FUNCTION_ARGS)
+{
+	Relation	index = (Relation) PG_GETARG_POINTER(0);
+	Page		metapage;
+
+	/* An empty BRIN index has just the metapage. */
+	metapage = (Page) palloc(BLCKSZ);
+	brin_metapage_init(metapage, BrinGetPagesPerRange(index),
+					   BRIN_CURRENT_VERSION);
+
+	/* Write the page.  If archiving/streaming, XLOG it. */
+	PageSetChecksumInplace(metapage, BRIN_METAPAGE_BLKNO);
+	smgrwrite(index->rd_smgr, INIT_FORKNUM, BRIN_METAPAGE_BLKNO,
+			  (char *) metapage, true);
+	if (XLogIsNeeded())
+		log_newpage(&index->rd_smgr->smgr_rnode.node, INIT_FORKNUM,
+					BRIN_METAPAGE_BLKNO, metapage);
+
+	/*
+	 * An immediate sync is required even if we xlog'd the page, because the
+	 * write did not go through shared_buffers and therefore a concurrent
+	 * checkpoint may have moved the redo pointer past our xlog record.
+	 */
+	smgrimmedsync(index->rd_smgr, INIT_FORKNUM);
+
+	PG_RETURN_VOID();
+}
+
+/*
+ * brinbulkdelete
+ *		Since there are no per-heap-tuple index tuples in BRIN indexes,
+ *		there's not a lot we can do here.
+ *
+ * XXX we could mark item tuples as "dirty" (when a minimum or maximum heap
+ * tuple is deleted), meaning the need to re-run summarization on the affected
+ * range.  Would need to add an extra flag in brintuples for that.
+ */
+Datum
+brinbulkdelete(PG_FUNCTION_ARGS)
+{
+	/* other arguments are not currently used */
+	IndexBulkDeleteResult *stats =
+	(IndexBulkDeleteResult *) PG_GETARG_POINTER(1);
+
+	/* allocate stats if first time through, else re-use existing struct */
+	if (stats == NULL)
+		stats = (IndexBulkDeleteResult *) palloc0(sizeof(IndexBulkDeleteResult));
+
+	PG_RETURN_POINTER(stats);
+}
+
+/*
+ * This routine is in charge of "vacuuming" a BRIN index: we just summarize
+ * ranges that are currently unsummarized.
+ */
+Datum
+brinvacuumcleanup(PG_FUNCTION_ARGS)
+{
+	IndexVacuumInfo *info = (IndexVacuumInfo *) PG_GETARG_POINTER(0);
+	IndexBulkDeleteResult *stats = (IndexBulkDeleteResult *) PG_GETARG_POINTER(1);
+	Relation	heapRel;
+
+	/* No-op in ANALYZE ONLY mode */
+	if (info->analyze_only)
+		PG_RETURN_POINTER(stats);
+
+	if (!stats)
+		stats = (IndexBulkDeleteResult *) palloc0(sizeof(IndexBulkDeleteResult));
+	/* rest of stats is initialized by zeroing */
+
+	heapRel = heap_open(IndexGetRelation(RelationGetRelid(info->index), false),
+						AccessShareLock);
+
+	stats->num_index_tuples = 0;
+	brinsummarize(info->index, heapRel,
+				  &stats->num_index_tuples, &stats->num_index_tuples);
+
+	heap_close(heapRel, AccessShareLock);
+
+	FreeSpaceMapVacuum(info->index);
+
+	stats->num_pages = RelationGetNumberOfBlocks(info->index);
+
+	PG_RETURN_POINTER(stats);
+}
+
+/*
+ * reloptions processor for BRIN indexes
+ */
+Datum
+brinoptions(PG_FUNCTION_ARGS)
+{
+	Datum		reloptions = PG_GETARG_DATUM(0);
+	bool		validate = PG_GETARG_BOOL(1);
+	relopt_value *options;
+	BrinOptions *rdopts;
+	int			numoptions;
+	static const relopt_parse_elt tab[] = {
+		{"pages_per_range", RELOPT_TYPE_INT, offsetof(BrinOptions, pagesPerRange)}
+	};
+
+	options = parseRelOptions(reloptions, validate, RELOPT_KIND_BRIN,
+							  &numoptions);
+
+	/* if none set, we're done */
+	if (numoptions == 0)
+		PG_RETURN_NULL();
+
+	rdopts = allocateReloptStruct(sizeof(BrinOptions), options, numoptions);
+
+	fillRelOptions((void *) rdopts, sizeof(BrinOptions), options, numoptions,
+				   validate, tab, lengthof(tab));
+
+	pfree(options);
+
+	PG_RETURN_BYTEA_P(rdopts);
+}
+
+/*
+ * SQL-callable function to scan through an index and summarize all ranges
+ * that are not currently summarized.
+ */
+Datum
+brin_summarize_new_values(PG_FUNCTION_ARGS)
+{
+	Oid			indexoid = PG_GETARG_OID(0);
+	Oid			heapoid;
+	Relation	indexRel;
+	Relation	heapRel;
+	double		numSummarized = 0;
+
+	/*
+	 * We must lock table before index to avoid deadlocks.  However, if the
+	 * passed indexoid isn't an index then IndexGetRelation() will fail.
+	 * Rather than emitting a not-very-helpful error message, postpone
+	 * complaining, expecting that the is-it-an-index test below will fail.
+	 */
+	heapoid = IndexGetRelation(indexoid, true);
+	if (OidIsValid(heapoid))
+		heapRel = heap_open(heapoid, ShareUpdateExclusiveLock);
+	else
+		heapRel = NULL;
+
+	indexRel = index_open(indexoid, ShareUpdateExclusiveLock);
+
+	/* Must be a BRIN index */
+	if (indexRel->rd_rel->relam != BRIN_AM_OID)
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("\"%s\" is not a BRIN index",
+						RelationGetRelationName(indexRel))));
+
+	/* User must own the index (comparable to privileges needed for VACUUM) */
+	if (!pg_class_ownercheck(indexoid, GetUserId()))
+		aclcheck_error(ACLCHECK_NOT_OWNER, ACL_KIND_CLASS,
+					   RelationGetRelationName(indexRel));
+
+	/*
+	 * Since we did the IndexGetRelation call above without any lock, it's
+	 * barely possible that a race against an index drop/recreation could have
+	 * netted us the wrong table.  Recheck.
+	 */
+	if (heapRel == NULL || heapoid != IndexGetRelation(indexoid, false))
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_TABLE),
+				 errmsg("could not open parent table of index %s",
+						RelationGetRelationName(indexRel))));
+
+	/* OK, do it */
+	brinsummarize(indexRel, heapRel, &numSummarized, NULL);
+
+	relation_close(indexRel, ShareUpdateExclusiveLock);
+	relation_close(heapRel, ShareUpdateExclusiveLock);
+
+	PG_RETURN_INT32((int32) numSummarized);
+}
+
+/*
+ * Initialize a BrinBuildState for the given index.
+ */
+static BrinBuildState *
+initialize_brin_buildstate(Relation idxRel, BrinRevmap *revmap,
+						   BlockNumber pagesPerRange)
+{
+	BrinBuildState *state;
+
+	state = (BrinBuildState *) palloc(sizeof(BrinBuildState));
+
+	state->bs_irel = idxRel;
+	state->bs_numtuples = 0;
+	state->bs_currentInsertBuf = InvalidBuffer;
+	state->bs_pagesPerRange = pagesPerRange;
+	state->bs_currRangeStart = 0;
+	state->bs_rmAccess = revmap;
+	state->bs_bdesc = brin_build_desc(idxRel);
+	state->bs_dtuple = brin_new_memtuple(state->bs_bdesc);
+
+	return state;
+}
+
+/*
+ * Release resources associated with a BrinBuildState.
+ */
+static void
+terminate_brin_buildstate(BrinBuildState *state)
+{
+	/* release the last index buffer used, recording its free space */
+	if (BufferIsValid(state->bs_currentInsertBuf))
+	{
+		BlockNumber blk = BufferGetBlockNumber(state->bs_currentInsertBuf);
+		Size		freespace;
+
+		LockBuffer(state->bs_currentInsertBuf, BUFFER_LOCK_SHARE);
+		freespace = PageGetFreeSpace(BufferGetPage(state->bs_currentInsertBuf));
+		UnlockReleaseBuffer(state->bs_currentInsertBuf);
+
+		RecordPageWithFreeSpace(state->bs_irel, blk, freespace);
+	}
+
+	MemoryContextDelete(state->bs_dtuple->bt_context);
+	pfree(state->bs_dtuple);
+	brin_free_desc(state->bs_bdesc);
+	pfree(state);
+}
+
+/*
+ * Scan the complete index looking for ranges that don't have summary
+ * tuples yet, and summarize them.  The number of ranges summarized, and of
+ * those that already had a summary, are added to *numSummarized and
+ * *numExisting if not NULL.
+ *
+ * Placeholder tuples are left behind when a summarization is interrupted;
+ * as nobody else can be summarizing concurrently, their ranges are
+ * summarized again.
+ */
+static void
+brinsummarize(Relation index, Relation heapRel, double *numSummarized,
+			  double *numExisting)
+{
+	BrinRevmap *revmap;
+	BrinBuildState *state = NULL;
+	IndexInfo  *indexInfo = NULL;
+	BlockNumber heapNumBlocks;
+	BlockNumber heapBlk;
+	BlockNumber pagesPerRange;
+	Buffer		buf;
+
+	revmap = brinRevmapInitialize(index, &pagesPerRange);
+
+	/*
+	 * Scan the revmap to find unsummarized items.
+	 */
+	buf = InvalidBuffer;
+	heapNumBlocks = RelationGetNumberOfBlocks(heapRel);
+	for (heapBlk = 0; heapBlk < heapNumBlocks; heapBlk += pagesPerRange)
+	{
+		BrinTuple  *tup;
+		OffsetNumber off;
+		bool		placeholder = false;
+
+		CHECK_FOR_INTERRUPTS();
+
+		tup = brinGetTupleForHeapBlock(revmap, heapBlk, &buf, &off, NULL,
+									   BUFFER_LOCK_SHARE);
+		if (tup != NULL)
+		{
+			placeholder = BrinTupleIsPlaceholder(tup);
+			LockBuffer(buf, BUFFER_LOCK_UNLOCK);
+		}
+
+		if (tup == NULL || placeholder)
+		{
+			/* no revmap entry for this heap range. Summarize it. */
+			if (state == NULL)
+			{
+				/* first time through */
+				Assert(!indexInfo);
+				state = initialize_brin_buildstate(index, revmap,
+												   pagesPerRange);
+				indexInfo = BuildIndexInfo(index);
+			}
+			summarize_range(indexInfo, state, heapRel, heapBlk,
+							heapNumBlocks, placeholder);
+
+			/* and re-initialize state for the next range */
+			brin_memtuple_initialize(state->bs_dtuple, state->bs_bdesc);
+
+			if (numSummarized)
+				*numSummarized += 1.0;
+		}
+		else
+		{
+			if (numExisting)
+				*numExisting += 1.0;
+		}
+
+		/* don't wrap around at the very end of the block number space */
+		if (heapBlk + pagesPerRange < heapBlk)
+			break;
+	}
+
+	if (BufferIsValid(buf))
+		ReleaseBuffer(buf);
+
+	/* free resources */
+	brinRevmapTerminate(revmap);
+	if (state)
+	{
+		terminate_brin_buildstate(state);
+		pfree(indexInfo);
+	}
+}
+
+/*
+ * Summarize the given page range of the given index.
+ *
+ * This routine can run in parallel with insertions into the heap.  To avoid
+ * missing those values from the summary tuple, we first insert a placeholder
+ * index tuple into the index, then execute the heap scan; transactions
+ * concurrent with the scan update the placeholder tuple.  After the scan, we
+ * union the placeholder tuple with the one computed by this routine.  The
+ * update of the index value happens in a loop, so that if somebody updates
+ * the placeholder tuple after we read it, we detect the case and try again.
+ * This ensures that the concurrently inserted tuples are not lost.
+ */
+static void
+summarize_range(IndexInfo *indexInfo, BrinBuildState *state, Relation heapRel,
+				BlockNumber heapBlk, BlockNumber heapNumBlks,
+				bool havePlaceholder)
+{
+	BrinDesc   *bdesc = state->bs_bdesc;
+	Buffer		buf = InvalidBuffer;
+	BlockNumber scanNumBlks;
+
+	/*
+	 * Insert the placeholder tuple, unless there's one already.
+	 */
+	if (!havePlaceholder)
+	{
+		BrinTuple  *phtup;
+		Size		phsz;
+
+		phtup = brin_form_placeholder_tuple(bdesc, heapBlk, &phsz);
+		(void) brin_doinsert(state->bs_irel, state->bs_pagesPerRange,
+							 state->bs_rmAccess, &state->bs_currentInsertBuf,
+							 heapBlk, phtup, phsz);
+		pfree(phtup);
+	}
+
+	/*
+	 * Compute range end.  We hold ShareUpdateExclusive lock on table, so it
+	 * cannot shrink concurrently (but it can grow).
+	 *
+	 * If the range is not the last one, this is simple; but if it is the
+	 * last one, it might contain pages that were added after the caller read
+	 * the relation size; the placeholder is visible to inserters by now, so
+	 * any new page added after rereading the size gets its values into the
+	 * placeholder, and pages added before get scanned.
+	 */
+	if (heapBlk + state->bs_pagesPerRange > heapNumBlks)
+		scanNumBlks = Min(RelationGetNumberOfBlocks(heapRel) - heapBlk,
+						  state->bs_pagesPerRange);
+	else
+		scanNumBlks = state->bs_pagesPerRange;
+
+	/*
+	 * Execute the partial heap scan covering the heap blocks in the specified
+	 * page range, summarizing the heap tuples in it.  This scan stops just
+	 * short of brinbuildCallback creating the new index entry.
+	 *
+	 * Note that it is critical we use the "any visible" mode of
+	 * IndexBuildHeapRangeScan here: otherwise, we would miss tuples inserted
+	 * by transactions that are still in progress, among other corner cases.
+	 */
+	state->bs_currRangeStart = heapBlk;
+	IndexBuildHeapRangeScan(heapRel, state->bs_irel, indexInfo, false, true,
+							heapBlk, scanNumBlks,
+							brinbuildCallback, (void *) state);
+
+	/*
+	 * Now we update the values obtained by the scan with the placeholder
+	 * tuple.  We do this in a loop which only terminates if we're able to
+	 * update the placeholder tuple successfully; if we are not, this means
+	 * somebody else modified the placeholder tuple after we read it.
+	 */
+	for (;;)
+	{
+		BrinTuple  *tup;
+		BrinTuple  *origtup;
+		BrinTuple  *newtup;
+		BrinMemTuple *phdtup;
+		OffsetNumber off;
+		Size		origsz;
+		Size		newsize;
+		bool		didupdate;
+
+		CHECK_FOR_INTERRUPTS();
+
+		tup = brinGetTupleForHeapBlock(state->bs_rmAccess, heapBlk, &buf,
+									   &off, &origsz, BUFFER_LOCK_SHARE);
+		if (tup == NULL)
+			elog(ERROR, "missing placeholder tuple for range %u of index \"%s\"",
+				 heapBlk, RelationGetRelationName(state->bs_irel));
+
+		origtup = brin_copy_tuple(tup, origsz);
+		LockBuffer(buf, BUFFER_LOCK_UNLOCK);
+
+		/* merge in whatever concurrent insertions put in the placeholder */
+		phdtup = brin_deform_tuple(bdesc, origtup);
+		brin_union_tuples(bdesc, state->bs_dtuple, phdtup);
+
+		newtup = brin_form_tuple(bdesc, heapBlk, state->bs_dtuple, &newsize);
+		didupdate = brin_doupdate(state->bs_irel, state->bs_pagesPerRange,
+								  state->bs_rmAccess, heapBlk, buf, off,
+								  origtup, origsz, newtup, newsize);
+
+		MemoryContextDelete(phdtup->bt_context);
+		pfree(phdtup);
+		pfree(origtup);
+		pfree(newtup);
+
+		if (didupdate)
+			break;
+	}
+
+	if (BufferIsValid(buf))
+		ReleaseBuffer(buf);
+}
+
+/*
+ * Given a deformed tuple in the build state, convert it into the on-disk
+ * format and insert it into the index, making the revmap point to it.
+ */
+static void
+form_and_insert_tuple(BrinBuildState *state)
+{
+	BrinTuple  *tup;
+	Size		size;
+
+	tup = brin_form_tuple(state->bs_bdesc, state->bs_currRangeStart,
+						  state->bs_dtuple, &size);
+	(void) brin_doinsert(state->bs_irel, state->bs_pagesPerRange,
+						 state->bs_rmAccess, &state->bs_currentInsertBuf,
+						 state->bs_currRangeStart, tup, size);
+	state->bs_numtuples++;
+
+	pfree(tup);
+}
+
+/*
+ * Look up the comparison function to use for each scan key.  Keys whose
+ * argument is of the indexed type use the opclass' support function; the
+ * others need the cross-type one from the operator family.
+ */
+static FmgrInfo *
+brin_scankey_procs(IndexScanDesc scan)
+{
+	Relation	idxRel = scan->indexRelation;
+	FmgrInfo   *procs;
+	int			keyno;
+
+	procs = (FmgrInfo *) palloc0(sizeof(FmgrInfo) *
+								 Max(scan->numberOfKeys, 1));
+
+	for (keyno = 0; keyno < scan->numberOfKeys; keyno++)
+	{
+		ScanKey		key = &scan->keyData[keyno];
+		AttrNumber	attno = key->sk_attno;
+		Oid			opcintype = idxRel->rd_opcintype[attno - 1];
+		Oid			opfamily = idxRel->rd_opfamily[attno - 1];
+		RegProcedure procid;
+
+		/* IS [NOT] NULL keys don't compare anything */
+		if (key->sk_flags & SK_ISNULL)
+			continue;
+
+		if (key->sk_subtype == InvalidOid || key->sk_subtype == opcintype)
+		{
+			fmgr_info_copy(&procs[keyno],
+						   index_getprocinfo(idxRel, attno, BRIN_COMPARE_PROC),
+						   CurrentMemoryContext);
+			continue;
+		}
+
+		procid = get_opfamily_proc(opfamily, opcintype, key->sk_subtype,
+								   BRIN_COMPARE_PROC);
+		if (!RegProcedureIsValid(procid))
+			elog(ERROR, "missing support function %d(%u,%u) in opfamily %u",
+				 BRIN_COMPARE_PROC, opcintype, key->sk_subtype, opfamily);
+		fmgr_info(procid, &procs[keyno]);
+	}
+
+	return procs;
+}
+
+/*
+ * Can the range summarized by dtup contain a row that satisfies all the scan
+ * keys?
+ */
+static bool
+brin_range_consistent(BrinMemTuple *dtup, ScanKey keys, int nkeys,
+					  FmgrInfo *cmpprocs)
+{
+	int			keyno;
+
+	for (keyno = 0; keyno < nkeys; keyno++)
+	{
+		ScanKey		key = &keys[keyno];
+		BrinValues *col = &dtup->bt_columns[key->sk_attno - 1];
+		FmgrInfo   *cmp = &cmpprocs[keyno];
+		Oid			collation = key->sk_collation;
+		bool		matches;
+
+		if (key->sk_flags & SK_ISNULL)
+		{
+			if (key->sk_flags & SK_SEARCHNULL)
+			{
+				if (!col->bv_hasnulls)
+					return false;
+				continue;
+			}
+			if (key->sk_flags & SK_SEARCHNOTNULL)
+			{
+				if (col->bv_allnulls)
+					return false;
+				continue;
+			}
+
+			/* a strict operator never matches a null argument */
+			return false;
+		}
+
+		/* a range with nothing but nulls can't satisfy a strict operator */
+		if (col->bv_allnulls)
+			return false;
+
+		switch (key->sk_strategy)
+		{
+			case BTLessStrategyNumber:
+				matches = DatumGetInt32(FunctionCall2Coll(cmp, collation,
+														  col->bv_min,
+													  key->sk_argument)) < 0;
+				break;
+			case BTLessEqualStrategyNumber:
+				matches = DatumGetInt32(FunctionCall2Coll(cmp, collation,
+														  col->bv_min,
+													 key->sk_argument)) <= 0;
+				break;
+			case BTEqualStrategyNumber:
+				matches = DatumGetInt32(FunctionCall2Coll(cmp, collation,
+														  col->bv_min,
+													 key->sk_argument)) <= 0 &&
+					DatumGetInt32(FunctionCall2Coll(cmp, collation,
+													col->bv_max,
+													key->sk_argument)) >= 0;
+				break;
+			case BTGreaterEqualStrategyNumber:
+				matches = DatumGetInt32(FunctionCall2Coll(cmp, collation,
+														  col->bv_max,
+													 key->sk_argument)) >= 0;
+				break;
+			case BTGreaterStrategyNumber:
+				matches = DatumGetInt32(FunctionCall2Coll(cmp, collation,
+														  col->bv_max,
+													  key->sk_argument)) > 0;
+				break;
+			default:
+				/* shouldn't happen */
+				elog(ERROR, "invalid strategy number %d", key->sk_strategy);
+				matches = false;
+				break;
+		}
+
+		if (!matches)
+			return false;
+	}
+
+	return true;
+}
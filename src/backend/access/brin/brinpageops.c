@@ -0,0 +1,589 @@
+/*-------------------------------------------------------------------------
+ *
+ * brinpageops.c
+ *	  Page-handling routines for BRIN indexes
+ *
+ * Summary tuples live on regular pages.  A tuple that grows beyond its
+ * page's free space is moved to another page, and the revmap is updated to
+ * point to its new location in the same WAL-logged action.
+ *
+ * To avoid deadlocks, the revmap page is always locked before any regular
+ * page, and two regular pages are locked in block number order.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *			src/backend/access/brin/brinpageops.c
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "access/brin_private.h"
+#include "access/xlog.h"
+#include "miscadmin.h"
+#include "storage/bufmgr.h"
+#include "storage/freespace.h"
+#include "storage/lmgr.h"
+#include "utils/rel.h"
+
+
+static Buffer brin_getinsertbuffer(Relation irel, Buffer oldbuf, Size itemsz,
+					 bool *extended);
+static bool brin_tuple_is_current(Page page, OffsetNumber off,
+					  const BrinTuple *origtup, Size origsz);
+
+
+/*
+ * Initialize a new BRIN index page of the given type.
+ */
+void
+brin_page_init(Page page, uint16 type)
+{
+	PageInit(page, BLCKSZ, sizeof(BrinSpecialSpace));
+
+	BrinPageType(page) = type;
+}
+
+/*
+ * Initialize a new BRIN index's metapage.
+ */
+void
+brin_metapage_init(Page page, BlockNumber pagesPerRange, uint16 version)
+{
+	BrinMetaPageData *metadata;
+
+	brin_page_init(page, BRIN_PAGETYPE_META);
+
+	metadata = BrinPageGetMeta(page);
+
+	metadata->brinMagic = BRIN_META_MAGIC;
+	metadata->brinVersion = version;
+	metadata->pagesPerRange = pagesPerRange;
+	metadata->nRevmapPages = 0;
+
+	/*
+	 * Set pd_lower just past the end of the metadata.  This is not essential
+	 * but it makes the page look compressible to xlog.c.
+	 */
+	((PageHeader) page)->pd_lower =
+		((char *) &metadata->revmapPages[0]) - (char *) page;
+}
+
+/*
+ * Initialize a new revmap page; all of its entries are invalid.
+ */
+void
+brin_revmap_page_init(Page page)
+{
+	brin_page_init(page, BRIN_PAGETYPE_REVMAP);
+
+	/* the whole TID array counts as used space */
+	((PageHeader) page)->pd_lower = MAXALIGN(SizeOfPageHeaderData) +
+		REVMAP_PAGE_MAXITEMS * sizeof(ItemPointerData);
+}
+
+/*
+ * Append a revmap page to the list kept in the metapage.
+ */
+void
+brin_metapage_add_revmap_page(Page metapage, BlockNumber blkno)
+{
+	BrinMetaPageData *metadata = BrinPageGetMeta(metapage);
+
+	Assert(metadata->nRevmapPages < BRIN_MAX_REVMAP_PAGES);
+
+	metadata->revmapPages[metadata->nRevmapPages++] = blkno;
+	((PageHeader) metapage)->pd_lower =
+		((char *) &metadata->revmapPages[metadata->nRevmapPages]) -
+		(char *) metapage;
+}
+
+/*
+ * Remove a tuple from a regular page.  The line pointer is kept, unused, so
+ * that the other tuples of the page don't change TIDs.
+ */
+void
+brin_page_delete_item(Page page, OffsetNumber offnum)
+{
+	ItemIdSetUnused(PageGetItemId(page, offnum));
+	PageRepairFragmentation(page);
+}
+
+/*
+ * Replace the tuple at offnum by the given one, which the caller has made
+ * sure fits on the page.  This is used both in regular operation and during
+ * WAL replay.
+ */
+void
+brin_page_replace_item(Page page, OffsetNumber offnum, const BrinTuple *tup,
+					   Size sz)
+{
+	ItemId		lp = PageGetItemId(page, offnum);
+
+	if (ItemIdGetLength(lp) == sz)
+	{
+		memcpy(PageGetItem(page, lp), tup, sz);
+		return;
+	}
+
+	brin_page_delete_item(page, offnum);
+	if (PageAddItem(page, (Item) tup, sz, offnum, true, false) != offnum)
+		elog(ERROR, "failed to replace BRIN tuple");
+}
+
+/*
+ * Insert an index tuple into the index relation.  The revmap is updated to
+ * mark the range containing the given page as pointing to the inserted entry.
+ * A WAL record is written.
+ *
+ * The buffer, if valid, is first checked for free space to insert the new
+ * entry; if there isn't enough, a new buffer is obtained and pinned.  No
+ * buffer lock must be held on entry, no buffer lock is held on exit.
+ *
+ * Return value is the offset number where the tuple was inserted.
+ */
+OffsetNumber
+brin_doinsert(Relation idxrel, BlockNumber pagesPerRange,
+			  BrinRevmap *revmap, Buffer *buffer, BlockNumber heapBlk,
+			  BrinTuple *tup, Size itemsz)
+{
+	Page		page;
+	BlockNumber blk;
+	OffsetNumber off;
+	Buffer		revmapbuf;
+	ItemPointerData tid;
+	bool		extended = false;
+	Size		freespace = 0;
+
+	itemsz = MAXALIGN(itemsz);
+
+	/* If the item is oversized, don't even bother. */
+	if (itemsz > BrinMaxItemSize)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+			errmsg("index row size %lu exceeds maximum %lu for index \"%s\"",
+				   (unsigned long) itemsz,
+				   (unsigned long) BrinMaxItemSize,
+				   RelationGetRelationName(idxrel))));
+
+	/* Make sure the revmap is long enough to contain the entry we need */
+	revmapbuf = brinLockRevmapPageForUpdate(revmap, heapBlk);
+
+	/*
+	 * Obtain a locked buffer to insert the new tuple.  Note
+	 * brin_getinsertbuffer ensures there's enough space in the returned
+	 * buffer.
+	 */
+	if (BufferIsValid(*buffer))
+	{
+		/*
+		 * Try the page used last time first; others may have filled it up
+		 * since, though.
+		 */
+		LockBuffer(*buffer, BUFFER_LOCK_EXCLUSIVE);
+		page = BufferGetPage(*buffer);
+		if (PageIsNew(page) || !BRIN_IS_REGULAR_PAGE(page) ||
+			PageGetFreeSpace(page) < itemsz)
+		{
+			UnlockReleaseBuffer(*buffer);
+			*buffer = InvalidBuffer;
+		}
+	}
+
+	if (!BufferIsValid(*buffer))
+		*buffer = brin_getinsertbuffer(idxrel, InvalidBuffer, itemsz,
+									   &extended);
+
+	page = BufferGetPage(*buffer);
+	blk = BufferGetBlockNumber(*buffer);
+
+	START_CRIT_SECTION();
+	if (extended)
+		brin_page_init(page, BRIN_PAGETYPE_REGULAR);
+	off = PageAddItem(page, (Item) tup, itemsz, InvalidOffsetNumber,
+					  false, false);
+	if (off == InvalidOffsetNumber)
+		elog(PANIC, "could not insert new index tuple to page");
+	MarkBufferDirty(*buffer);
+
+	ItemPointerSet(&tid, blk, off);
+	brinSetHeapBlockItemptr(revmapbuf, pagesPerRange, heapBlk, tid);
+	MarkBufferDirty(revmapbuf);
+
+	/* XLOG stuff */
+	if (RelationNeedsWAL(idxrel))
+	{
+		xl_brin_insert xlrec;
+		XLogRecPtr	recptr;
+		XLogRecData rdata[3];
+		uint8		info;
+
+		info = XLOG_BRIN_INSERT | (extended ? XLOG_BRIN_INIT_PAGE : 0);
+		xlrec.node = idxrel->rd_node;
+		xlrec.heapBlk = heapBlk;
+		xlrec.pagesPerRange = pagesPerRange;
+		xlrec.revmapBlk = BufferGetBlockNumber(revmapbuf);
+		xlrec.tid = tid;
+
+		rdata[0].data = (char *) &xlrec;
+		rdata[0].len = SizeOfBrinInsert;
+		rdata[0].buffer = InvalidBuffer;
+		rdata[0].next = &rdata[1];
+
+		rdata[1].data = NULL;
+		rdata[1].len = 0;
+		rdata[1].buffer = revmapbuf;
+		rdata[1].buffer_std = false;
+		rdata[1].next = &rdata[2];
+
+		rdata[2].data = (char *) tup;
+		rdata[2].len = itemsz;
+		rdata[2].buffer = extended ? InvalidBuffer : *buffer;
+		rdata[2].buffer_std = true;
+		rdata[2].next = NULL;
+
+		recptr = XLogInsert(RM_BRIN_ID, info, rdata);
+
+		PageSetLSN(page, recptr);
+		PageSetLSN(BufferGetPage(revmapbuf), recptr);
+	}
+
+	END_CRIT_SECTION();
+
+	if (extended)
+		freespace = PageGetFreeSpace(page);
+
+	/* Tuple is firmly on buffer; we can release our locks */
+	LockBuffer(*buffer, BUFFER_LOCK_UNLOCK);
+	LockBuffer(revmapbuf, BUFFER_LOCK_UNLOCK);
+
+	if (extended)
+		RecordPageWithFreeSpace(idxrel, blk, freespace);
+
+	return off;
+}
+
+/*
+ * Update tuple origtup (size origsz), located in offset oldoff of buffer
+ * oldbuf, to newtup (size newsz) as summary tuple for the page range starting
+ * at heapBlk.  oldbuf must not be locked on entry, and is not locked at exit.
+ *
+ * If the update can be done on the same page, it is.  Otherwise the new
+ * tuple is inserted in another page and the revmap is made to point to it.
+ *
+ * If the original tuple was concurrently modified, nothing is done and
+ * false is returned, so that the caller can start over; true otherwise.
+ */
+bool
+brin_doupdate(Relation idxrel, BlockNumber pagesPerRange,
+			  BrinRevmap *revmap, BlockNumber heapBlk,
+			  Buffer oldbuf, OffsetNumber oldoff,
+			  const BrinTuple *origtup, Size origsz,
+			  const BrinTuple *newtup, Size newsz)
+{
+	Page		oldpage;
+	Page		newpage;
+	Buffer		revmapbuf;
+	Buffer		newbuf;
+	BlockNumber oldblk;
+	BlockNumber newblk;
+	OffsetNumber newoff;
+	ItemPointerData newtid;
+	bool		extended;
+	Size		oldfreespace;
+	Size		newfreespace;
+
+	newsz = MAXALIGN(newsz);
+	if (newsz > BrinMaxItemSize)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+			errmsg("index row size %lu exceeds maximum %lu for index \"%s\"",
+				   (unsigned long) newsz,
+				   (unsigned long) BrinMaxItemSize,
+				   RelationGetRelationName(idxrel))));
+
+	LockBuffer(oldbuf, BUFFER_LOCK_EXCLUSIVE);
+	oldpage = BufferGetPage(oldbuf);
+
+	/*
+	 * Check that the old tuple wasn't updated concurrently: it might have
+	 * moved someplace else entirely ...
+	 */
+	if (!brin_tuple_is_current(oldpage, oldoff, origtup, origsz))
+	{
+		LockBuffer(oldbuf, BUFFER_LOCK_UNLOCK);
+		return false;
+	}
+
+	/*
+	 * Great, the old tuple is intact.  We can proceed with the update.
+	 *
+	 * If there's enough room in the old page for the new tuple, replace it
+	 * there; the revmap doesn't need to change.
+	 */
+	if (PageGetExactFreeSpace(oldpage) + origsz >= newsz)
+	{
+		START_CRIT_SECTION();
+		brin_page_replace_item(oldpage, oldoff, newtup, newsz);
+		MarkBufferDirty(oldbuf);
+
+		/* XLOG stuff */
+		if (RelationNeedsWAL(idxrel))
+		{
+			xl_brin_samepage_update xlrec;
+			XLogRecPtr	recptr;
+			XLogRecData rdata[2];
+
+			xlrec.node = idxrel->rd_node;
+			ItemPointerSet(&xlrec.tid, BufferGetBlockNumber(oldbuf), oldoff);
+
+			rdata[0].data = (char *) &xlrec;
+			rdata[0].len = SizeOfBrinSamepageUpdate;
+			rdata[0].buffer = InvalidBuffer;
+			rdata[0].next = &rdata[1];
+
+			rdata[1].data = (char *) newtup;
+			rdata[1].len = newsz;
+			rdata[1].buffer = oldbuf;
+			rdata[1].buffer_std = true;
+			rdata[1].next = NULL;
+
+			recptr = XLogInsert(RM_BRIN_ID, XLOG_BRIN_SAMEPAGE_UPDATE, rdata);
+
+			PageSetLSN(oldpage, recptr);
+		}
+
+		END_CRIT_SECTION();
+
+		LockBuffer(oldbuf, BUFFER_LOCK_UNLOCK);
+		return true;
+	}
+
+	/*
+	 * The new tuple goes to another page.  The revmap page has to be locked
+	 * before the regular pages, so let go of the old page and check the
+	 * tuple again once everything is locked in the proper order.
+	 */
+	LockBuffer(oldbuf, BUFFER_LOCK_UNLOCK);
+
+	revmapbuf = brinLockRevmapPageForUpdate(revmap, heapBlk);
+	newbuf = brin_getinsertbuffer(idxrel, oldbuf, newsz, &extended);
+	oldblk = BufferGetBlockNumber(oldbuf);
+	newblk = BufferGetBlockNumber(newbuf);
+	newpage = BufferGetPage(newbuf);
+
+	if (!brin_tuple_is_current(oldpage, oldoff, origtup, origsz))
+	{
+		LockBuffer(oldbuf, BUFFER_LOCK_UNLOCK);
+		UnlockReleaseBuffer(newbuf);
+		LockBuffer(revmapbuf, BUFFER_LOCK_UNLOCK);
+
+		/*
+		 * A page we just added is still uninitialized; advertise it in the
+		 * FSM, or nobody would ever use it.
+		 */
+		if (extended)
+			RecordPageWithFreeSpace(idxrel, newblk, BrinMaxItemSize);
+		return false;
+	}
+
+	START_CRIT_SECTION();
+
+	if (extended)
+		brin_page_init(newpage, BRIN_PAGETYPE_REGULAR);
+	newoff = PageAddItem(newpage, (Item) newtup, newsz, InvalidOffsetNumber,
+						 false, false);
+	if (newoff == InvalidOffsetNumber)
+		elog(PANIC, "could not insert new index tuple to page");
+	MarkBufferDirty(newbuf);
+
+	brin_page_delete_item(oldpage, oldoff);
+	MarkBufferDirty(oldbuf);
+
+	ItemPointerSet(&newtid, newblk, newoff);
+	brinSetHeapBlockItemptr(revmapbuf, pagesPerRange, heapBlk, newtid);
+	MarkBufferDirty(revmapbuf);
+
+	/* XLOG stuff */
+	if (RelationNeedsWAL(idxrel))
+	{
+		xl_brin_update xlrec;
+		XLogRecPtr	recptr;
+		XLogRecData rdata[4];
+		uint8		info;
+
+		info = XLOG_BRIN_UPDATE | (extended ? XLOG_BRIN_INIT_PAGE : 0);
+
+		xlrec.new.node = idxrel->rd_node;
+		xlrec.new.heapBlk = heapBlk;
+		xlrec.new.pagesPerRange = pagesPerRange;
+		xlrec.new.revmapBlk = BufferGetBlockNumber(revmapbuf);
+		xlrec.new.tid = newtid;
+		ItemPointerSet(&xlrec.oldtid, oldblk, oldoff);
+
+		rdata[0].data = (char *) &xlrec;
+		rdata[0].len = SizeOfBrinUpdate;
+		rdata[0].buffer = InvalidBuffer;
+		rdata[0].next = &rdata[1];
+
+		rdata[1].data = NULL;
+		rdata[1].len = 0;
+		rdata[1].buffer = revmapbuf;
+		rdata[1].buffer_std = false;
+		rdata[1].next = &rdata[2];
+
+		rdata[2].data = NULL;
+		rdata[2].len = 0;
+		rdata[2].buffer = oldbuf;
+		rdata[2].buffer_std = true;
+		rdata[2].next = &rdata[3];
+
+		rdata[3].data = (char *) newtup;
+		rdata[3].len = newsz;
+		rdata[3].buffer = extended ? InvalidBuffer : newbuf;
+		rdata[3].buffer_std = true;
+		rdata[3].next = NULL;
+
+		recptr = XLogInsert(RM_BRIN_ID, info, rdata);
+
+		PageSetLSN(oldpage, recptr);
+		PageSetLSN(newpage, recptr);
+		PageSetLSN(BufferGetPage(revmapbuf), recptr);
+	}
+
+	END_CRIT_SECTION();
+
+	oldfreespace = PageGetFreeSpace(oldpage);
+	newfreespace = PageGetFreeSpace(newpage);
+
+	LockBuffer(revmapbuf, BUFFER_LOCK_UNLOCK);
+	LockBuffer(oldbuf, BUFFER_LOCK_UNLOCK);
+	UnlockReleaseBuffer(newbuf);
+
+	RecordPageWithFreeSpace(idxrel, oldblk, oldfreespace);
+	if (extended)
+		RecordPageWithFreeSpace(idxrel, newblk, newfreespace);
+
+	return true;
+}
+
+/*
+ * Return whether the tuple at the given offset of a (locked) regular page is
+ * still origtup.
+ */
+static bool
+brin_tuple_is_current(Page page, OffsetNumber off,
+					  const BrinTuple *origtup, Size origsz)
+{
+	ItemId		lp;
+
+	if (off > PageGetMaxOffsetNumber(page))
+		return false;
+
+	lp = PageGetItemId(page, off);
+	if (!ItemIdIsNormal(lp))
+		return false;
+
+	return brin_tuples_equal((BrinTuple *) PageGetItem(page, lp),
+							 ItemIdGetLength(lp), origtup, origsz);
+}
+
+/*
+ * Return a pinned and exclusively locked buffer which can be used to insert
+ * an index item of size itemsz.  If oldbuf is a valid buffer, it is also
+ * locked (in an order determined to avoid deadlocks), and it is never the
+ * returned buffer.
+ *
+ * If the returned page is new, *extended is set to true and the caller is
+ * responsible for initializing it, within its critical section.
+ */
+static Buffer
+brin_getinsertbuffer(Relation irel, Buffer oldbuf, Size itemsz,
+					 bool *extended)
+{
+	BlockNumber oldblk;
+	BlockNumber newblk;
+
+	oldblk = BufferIsValid(oldbuf) ? BufferGetBlockNumber(oldbuf) :
+		InvalidBlockNumber;
+
+	newblk = GetPageWithFreeSpace(irel, itemsz);
+	for (;;)
+	{
+		Buffer		buf;
+		Page		page;
+		Size		freespace;
+
+		CHECK_FOR_INTERRUPTS();
+
+		*extended = false;
+
+		if (newblk == InvalidBlockNumber)
+		{
+			bool		needLock = !RELATION_IS_LOCAL(irel);
+
+			/*
+			 * There's not enough free space in any existing index page,
+			 * according to the FSM: extend the relation to obtain a shiny new
+			 * page.
+			 */
+			if (needLock)
+				LockRelationForExtension(irel, ExclusiveLock);
+			buf = ReadBuffer(irel, P_NEW);
+			if (needLock)
+				UnlockRelationForExtension(irel, ExclusiveLock);
+			newblk = BufferGetBlockNumber(buf);
+			*extended = true;
+		}
+		else if (newblk == oldblk)
+		{
+			/*
+			 * There's an odd corner-case here where the FSM is out-of-date,
+			 * and gave us the old page: it's known not to have room.
+			 */
+			newblk = RecordAndGetPageWithFreeSpace(irel, newblk, 0, itemsz);
+			continue;
+		}
+		else
+			buf = ReadBuffer(irel, newblk);
+
+		/* We lock the old buffer first, if it's earlier than the new one */
+		if (BufferIsValid(oldbuf) && oldblk < newblk)
+		{
+			LockBuffer(oldbuf, BUFFER_LOCK_EXCLUSIVE);
+			LockBuffer(buf, BUFFER_LOCK_EXCLUSIVE);
+		}
+		else
+		{
+			LockBuffer(buf, BUFFER_LOCK_EXCLUSIVE);
+			if (BufferIsValid(oldbuf))
+				LockBuffer(oldbuf, BUFFER_LOCK_EXCLUSIVE);
+		}
+
+		page = BufferGetPage(buf);
+
+		/*
+		 * A page left uninitialized by a failed extension, or by an update
+		 * that was abandoned, is as good as a new one.
+		 */
+		if (*extended || PageIsNew(page))
+		{
+			*extended = true;
+			return buf;
+		}
+
+		freespace = BRIN_IS_REGULAR_PAGE(page) ? PageGetFreeSpace(page) : 0;
+		if (freespace >= itemsz)
+			return buf;
+
+		/* This page is no good; release it and try another one */
+		if (BufferIsValid(oldbuf))
+			LockBuffer(oldbuf, BUFFER_LOCK_UNLOCK);
+		UnlockReleaseBuffer(buf);
+
+		newblk = RecordAndGetPageWithFreeSpace(irel, newblk, freespace, itemsz);
+	}
+}
@@ -0,0 +1,394 @@
+/*-------------------------------------------------------------------------
+ *
+ * brinrevmap.c
+ *	  Range map for BRIN indexes
+ *
+ * The range map (revmap) is a translation structure for BRIN indexes: for
+ * each page range there is one summary tuple, and its location is tracked
+ * by the revmap.  Whenever a new tuple is inserted into a table that
+ * violates the previously recorded summary values, a new tuple is inserted
+ * into the index and the revmap is updated to point to it.
+ *
+ * The revmap pages are not necessarily contiguous: the metapage keeps the
+ * list of their block numbers, and new ones are added as the heap grows.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *			src/backend/access/brin/brinrevmap.c
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "access/brin_private.h"
+#include "access/xlog.h"
+#include "miscadmin.h"
+#include "storage/bufmgr.h"
+#include "storage/lmgr.h"
+#include "utils/rel.h"
+
+
+struct BrinRevmap
+{
+	Relation	rm_irel;
+	BlockNumber rm_pagesPerRange;
+	Buffer		rm_metaBuf;		/* pinned for the lifetime of the revmap */
+	Buffer		rm_currBuf;		/* last revmap page used, pinned */
+};
+
+/* revmap page and array slot covering a given heap block */
+#define HEAPBLK_TO_REVMAP_INDEX(pagesPerRange, heapBlk) \
+	(((heapBlk) / (pagesPerRange)) / REVMAP_PAGE_MAXITEMS)
+#define HEAPBLK_TO_REVMAP_SLOT(pagesPerRange, heapBlk) \
+	(((heapBlk) / (pagesPerRange)) % REVMAP_PAGE_MAXITEMS)
+
+static BlockNumber revmap_get_blkno(BrinRevmap *revmap, BlockNumber heapBlk);
+static Buffer revmap_pin_page(BrinRevmap *revmap, BlockNumber blkno);
+static void revmap_extend(BrinRevmap *revmap, uint32 mapIdx);
+
+
+/*
+ * Initialize an access object for a range map.  This must be freed by
+ * brinRevmapTerminate when caller is done with it.
+ */
+BrinRevmap *
+brinRevmapInitialize(Relation idxrel, BlockNumber *pagesPerRange)
+{
+	BrinRevmap *revmap;
+	Buffer		meta;
+	Page		page;
+	BrinMetaPageData *metadata;
+
+	meta = ReadBuffer(idxrel, BRIN_METAPAGE_BLKNO);
+	LockBuffer(meta, BUFFER_LOCK_SHARE);
+	page = BufferGetPage(meta);
+	metadata = BrinPageGetMeta(page);
+
+	if (PageIsNew(page) || !BRIN_IS_META_PAGE(page) ||
+		metadata->brinMagic != BRIN_META_MAGIC)
+		ereport(ERROR,
+				(errcode(ERRCODE_INDEX_CORRUPTED),
+				 errmsg("index \"%s\" is not a BRIN index",
+						RelationGetRelationName(idxrel))));
+
+	if (metadata->brinVersion != BRIN_CURRENT_VERSION)
+		ereport(ERROR,
+				(errcode(ERRCODE_INDEX_CORRUPTED),
+				 errmsg("index \"%s\" has wrong BRIN version",
+						RelationGetRelationName(idxrel)),
+				 errdetail("Expected version %d, found %d.",
+						   BRIN_CURRENT_VERSION, metadata->brinVersion)));
+
+	revmap = (BrinRevmap *) palloc(sizeof(BrinRevmap));
+	revmap->rm_irel = idxrel;
+	revmap->rm_pagesPerRange = metadata->pagesPerRange;
+	revmap->rm_metaBuf = meta;
+	revmap->rm_currBuf = InvalidBuffer;
+
+	*pagesPerRange = metadata->pagesPerRange;
+
+	LockBuffer(meta, BUFFER_LOCK_UNLOCK);
+
+	return revmap;
+}
+
+/*
+ * Release resources associated with a revmap access object.
+ */
+void
+brinRevmapTerminate(BrinRevmap *revmap)
+{
+	ReleaseBuffer(revmap->rm_metaBuf);
+	if (BufferIsValid(revmap->rm_currBuf))
+		ReleaseBuffer(revmap->rm_currBuf);
+	pfree(revmap);
+}
+
+/*
+ * Return the revmap page that covers the given heap block, exclusively
+ * locked, extending the revmap as necessary.  The caller must release the
+ * lock with LockBuffer(buf, BUFFER_LOCK_UNLOCK); the pin belongs to the
+ * revmap access object.
+ */
+Buffer
+brinLockRevmapPageForUpdate(BrinRevmap *revmap, BlockNumber heapBlk)
+{
+	uint32		mapIdx;
+	BlockNumber mapBlk;
+	Buffer		rmbuf;
+
+	mapIdx = HEAPBLK_TO_REVMAP_INDEX(revmap->rm_pagesPerRange, heapBlk);
+	while ((mapBlk = revmap_get_blkno(revmap, heapBlk)) == InvalidBlockNumber)
+		revmap_extend(revmap, mapIdx);
+
+	rmbuf = revmap_pin_page(revmap, mapBlk);
+	LockBuffer(rmbuf, BUFFER_LOCK_EXCLUSIVE);
+
+	return rmbuf;
+}
+
+/*
+ * In the given revmap buffer (locked appropriately by caller), which is used
+ * in a BRIN index of pagesPerRange pages per range, set the element
+ * corresponding to heap block number heapBlk to the given TID.
+ *
+ * This is used both in regular operation and during WAL replay.
+ */
+void
+brinSetHeapBlockItemptr(Buffer rmbuf, BlockNumber pagesPerRange,
+						BlockNumber heapBlk, ItemPointerData tid)
+{
+	RevmapContents *contents;
+	Page		page;
+
+	page = BufferGetPage(rmbuf);
+	contents = (RevmapContents *) PageGetContents(page);
+	contents->rm_tids[HEAPBLK_TO_REVMAP_SLOT(pagesPerRange, heapBlk)] = tid;
+}
+
+/*
+ * Fetch the BrinTuple for a given heap block.
+ *
+ * The buffer containing the tuple is locked in the given mode, and returned
+ * in *buf; *buf may be passed in holding a pinned buffer from a previous
+ * call, which is then reused if it happens to contain the tuple, or released
+ * otherwise.  As an optimization the caller can also ask for the tuple's
+ * size.  The returned tuple points to the shared buffer and must not be
+ * freed; if caller wants to use it after releasing the buffer lock, it must
+ * create its own palloc'ed copy.
+ *
+ * If no tuple is found for the given heap range, returns NULL.  In that
+ * case, *buf might still be updated (and pin must be released by caller),
+ * but it's not locked.
+ */
+BrinTuple *
+brinGetTupleForHeapBlock(BrinRevmap *revmap, BlockNumber heapBlk,
+						 Buffer *buf, OffsetNumber *off, Size *size, int mode)
+{
+	Relation	idxRel = revmap->rm_irel;
+	BlockNumber mapBlk;
+	ItemPointerData iptr;
+	ItemPointerData previptr;
+
+	/* normalize the heap block number to be the first page in the range */
+	heapBlk = (heapBlk / revmap->rm_pagesPerRange) * revmap->rm_pagesPerRange;
+
+	ItemPointerSetInvalid(&previptr);
+	for (;;)
+	{
+		RevmapContents *contents;
+		Buffer		rmbuf;
+		Page		page;
+		BlockNumber blk;
+
+		CHECK_FOR_INTERRUPTS();
+
+		mapBlk = revmap_get_blkno(revmap, heapBlk);
+		if (mapBlk == InvalidBlockNumber)
+		{
+			*off = InvalidOffsetNumber;
+			return NULL;
+		}
+
+		rmbuf = revmap_pin_page(revmap, mapBlk);
+		LockBuffer(rmbuf, BUFFER_LOCK_SHARE);
+		contents = (RevmapContents *) PageGetContents(BufferGetPage(rmbuf));
+		iptr = contents->rm_tids[HEAPBLK_TO_REVMAP_SLOT(revmap->rm_pagesPerRange,
+														heapBlk)];
+		LockBuffer(rmbuf, BUFFER_LOCK_UNLOCK);
+
+		if (!ItemPointerIsValid(&iptr))
+		{
+			*off = InvalidOffsetNumber;
+			return NULL;
+		}
+
+		/*
+		 * Check the TID we got in a previous iteration, if any, and save the
+		 * current TID we got from the revmap; if we loop, we can sanity-check
+		 * that the next one we get is different.  Otherwise we might be stuck
+		 * looping forever if the revmap is somehow badly broken.
+		 */
+		if (ItemPointerIsValid(&previptr) && ItemPointerEquals(&previptr, &iptr))
+			ereport(ERROR,
+					(errcode(ERRCODE_INDEX_CORRUPTED),
+					 errmsg_internal("corrupted BRIN index: inconsistent range map")));
+		previptr = iptr;
+
+		blk = ItemPointerGetBlockNumber(&iptr);
+		*off = ItemPointerGetOffsetNumber(&iptr);
+
+		/* Ok, got a pointer to where the BrinTuple should be. Fetch it. */
+		if (!BufferIsValid(*buf) || BufferGetBlockNumber(*buf) != blk)
+		{
+			if (BufferIsValid(*buf))
+				ReleaseBuffer(*buf);
+			*buf = ReadBuffer(idxRel, blk);
+		}
+		LockBuffer(*buf, mode);
+		page = BufferGetPage(*buf);
+
+		/* If we land on a revmap page, start over */
+		if (!PageIsNew(page) && BRIN_IS_REGULAR_PAGE(page) &&
+			*off <= PageGetMaxOffsetNumber(page))
+		{
+			ItemId		lp = PageGetItemId(page, *off);
+
+			if (ItemIdIsNormal(lp))
+			{
+				BrinTuple  *tup = (BrinTuple *) PageGetItem(page, lp);
+
+				/*
+				 * The tuple may have been moved by a concurrent update, and
+				 * its slot reused by another range's tuple.  Only return it
+				 * if it's really ours.
+				 */
+				if (tup->bt_blkno == heapBlk)
+				{
+					if (size)
+						*size = ItemIdGetLength(lp);
+					/* found it! */
+					return tup;
+				}
+			}
+		}
+
+		/*
+		 * No luck. Assume that the revmap was updated concurrently.
+		 */
+		LockBuffer(*buf, BUFFER_LOCK_UNLOCK);
+	}
+	/* not reached, but keep compiler quiet */
+	return NULL;
+}
+
+/*
+ * Return the block number of the revmap page covering the given heap block,
+ * or InvalidBlockNumber if the revmap doesn't reach that far yet.
+ */
+static BlockNumber
+revmap_get_blkno(BrinRevmap *revmap, BlockNumber heapBlk)
+{
+	BrinMetaPageData *metadata;
+	uint32		mapIdx;
+	BlockNumber mapBlk = InvalidBlockNumber;
+
+	mapIdx = HEAPBLK_TO_REVMAP_INDEX(revmap->rm_pagesPerRange, heapBlk);
+
+	LockBuffer(revmap->rm_metaBuf, BUFFER_LOCK_SHARE);
+	metadata = BrinPageGetMeta(BufferGetPage(revmap->rm_metaBuf));
+	if (mapIdx < metadata->nRevmapPages)
+		mapBlk = metadata->revmapPages[mapIdx];
+	LockBuffer(revmap->rm_metaBuf, BUFFER_LOCK_UNLOCK);
+
+	return mapBlk;
+}
+
+/*
+ * Obtain and return a buffer containing the revmap page with the given block
+ * number, pinned but not locked.  The last page used is kept pinned, as
+ * lookups for nearby heap blocks usually land on the same page.
+ */
+static Buffer
+revmap_pin_page(BrinRevmap *revmap, BlockNumber blkno)
+{
+	if (BufferIsValid(revmap->rm_currBuf))
+	{
+		if (BufferGetBlockNumber(revmap->rm_currBuf) == blkno)
+			return revmap->rm_currBuf;
+		ReleaseBuffer(revmap->rm_currBuf);
+	}
+
+	revmap->rm_currBuf = ReadBuffer(revmap->rm_irel, blkno);
+
+	return revmap->rm_currBuf;
+}
+
+/*
+ * Add a page to the revmap, unless somebody else has already made it cover
+ * the mapIdx'th revmap page.
+ */
+static void
+revmap_extend(BrinRevmap *revmap, uint32 mapIdx)
+{
+	Relation	irel = revmap->rm_irel;
+	Buffer		metabuf = revmap->rm_metaBuf;
+	Page		metapage;
+	BrinMetaPageData *metadata;
+	Buffer		buf;
+	Page		page;
+	bool		needLock;
+
+	LockBuffer(metabuf, BUFFER_LOCK_EXCLUSIVE);
+	metapage = BufferGetPage(metabuf);
+	metadata = BrinPageGetMeta(metapage);
+
+	if (mapIdx < metadata->nRevmapPages)
+	{
+		LockBuffer(metabuf, BUFFER_LOCK_UNLOCK);
+		return;
+	}
+
+	if (metadata->nRevmapPages >= BRIN_MAX_REVMAP_PAGES)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("BRIN index \"%s\" cannot cover any more heap pages",
+						RelationGetRelationName(irel)),
+				 errhint("Rebuild the index with a larger pages_per_range.")));
+
+	/*
+	 * The metapage lock keeps other extenders of the revmap away; the
+	 * relation extension lock is only needed because regular pages may be
+	 * added concurrently.
+	 */
+	needLock = !RELATION_IS_LOCAL(irel);
+	if (needLock)
+		LockRelationForExtension(irel, ExclusiveLock);
+	buf = ReadBuffer(irel, P_NEW);
+	if (needLock)
+		UnlockRelationForExtension(irel, ExclusiveLock);
+
+	LockBuffer(buf, BUFFER_LOCK_EXCLUSIVE);
+	page = BufferGetPage(buf);
+
+	START_CRIT_SECTION();
+
+	brin_revmap_page_init(page);
+	brin_metapage_add_revmap_page(metapage, BufferGetBlockNumber(buf));
+
+	MarkBufferDirty(buf);
+	MarkBufferDirty(metabuf);
+
+	if (RelationNeedsWAL(irel))
+	{
+		xl_brin_revmap_extend xlrec;
+		XLogRecPtr	recptr;
+		XLogRecData rdata[2];
+
+		xlrec.node = irel->rd_node;
+		xlrec.targetBlk = BufferGetBlockNumber(buf);
+
+		rdata[0].data = (char *) &xlrec;
+		rdata[0].len = SizeOfBrinRevmapExtend;
+		rdata[0].buffer = InvalidBuffer;
+		rdata[0].next = &rdata[1];
+
+		rdata[1].data = NULL;
+		rdata[1].len = 0;
+		rdata[1].buffer = metabuf;
+		rdata[1].buffer_std = true;
+		rdata[1].next = NULL;
+
+		recptr = XLogInsert(RM_BRIN_ID, XLOG_BRIN_REVMAP_EXTEND, rdata);
+		PageSetLSN(metapage, recptr);
+		PageSetLSN(page, recptr);
+	}
+
+	END_CRIT_SECTION();
+
+	UnlockReleaseBuffer(buf);
+	LockBuffer(metabuf, BUFFER_LOCK_UNLOCK);
+}
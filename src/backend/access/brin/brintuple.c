@@ -0,0 +1,389 @@
+/*-------------------------------------------------------------------------
+ *
+ * brintuple.c
+ *	  Conversions between in-memory and on-disk BRIN summary tuples.
+ *
+ * The on-disk format keeps the minimum and the maximum of each column as
+ * two consecutive attributes of a heap-style data area, so that the regular
+ * tuple routines can be used to store them; see brin_private.h.
+ *
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *			src/backend/access/brin/brintuple.c
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "access/brin_private.h"
+#include "access/genam.h"
+#include "access/htup_details.h"
+#include "access/tupmacs.h"
+#include "utils/datum.h"
+#include "utils/rel.h"
+
+
+/*
+ * Build a BrinDesc for the given index.  Everything is allocated in a
+ * memory context of its own, which brin_free_desc releases.
+ */
+BrinDesc *
+brin_build_desc(Relation rel)
+{
+	BrinDesc   *bdesc;
+	TupleDesc	tupdesc = RelationGetDescr(rel);
+	MemoryContext cxt;
+	MemoryContext oldcxt;
+	int			i;
+
+	cxt = AllocSetContextCreate(CurrentMemoryContext,
+								"brin desc cxt",
+								ALLOCSET_SMALL_MINSIZE,
+								ALLOCSET_SMALL_INITSIZE,
+								ALLOCSET_SMALL_MAXSIZE);
+	oldcxt = MemoryContextSwitchTo(cxt);
+
+	bdesc = (BrinDesc *) palloc(sizeof(BrinDesc));
+	bdesc->bd_context = cxt;
+	bdesc->bd_index = rel;
+	bdesc->bd_tupdesc = tupdesc;
+
+	/*
+	 * The stored tuple has two attributes per column, its minimum and its
+	 * maximum, both of the column's type.
+	 */
+	bdesc->bd_disktdesc = CreateTemplateTupleDesc(tupdesc->natts * 2, false);
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute minatt = bdesc->bd_disktdesc->attrs[2 * i];
+		Form_pg_attribute maxatt = bdesc->bd_disktdesc->attrs[2 * i + 1];
+
+		memcpy(minatt, tupdesc->attrs[i], ATTRIBUTE_FIXED_PART_SIZE);
+		minatt->attnum = 2 * i + 1;
+		memcpy(maxatt, tupdesc->attrs[i], ATTRIBUTE_FIXED_PART_SIZE);
+		maxatt->attnum = 2 * i + 2;
+	}
+
+	MemoryContextSwitchTo(oldcxt);
+
+	return bdesc;
+}
+
+void
+brin_free_desc(BrinDesc *bdesc)
+{
+	MemoryContextDelete(bdesc->bd_context);
+}
+
+/*
+ * Generate a new on-disk tuple to be inserted in a BRIN index.
+ *
+ * The returned tuple is palloc'd, and its length (always MAXALIGN'ed) is
+ * returned in *size.
+ */
+BrinTuple *
+brin_form_tuple(BrinDesc *bdesc, BlockNumber blkno, BrinMemTuple *dtup,
+				Size *size)
+{
+	TupleDesc	disktdesc = bdesc->bd_disktdesc;
+	int			natts = bdesc->bd_tupdesc->natts;
+	Datum	   *values;
+	bool	   *nulls;
+	bits8	   *phony_nullbitmap;
+	uint16		phony_infomask;
+	Size		len,
+				hoff,
+				data_len;
+	BrinTuple  *rettuple;
+	int			keyno;
+
+	values = (Datum *) palloc(sizeof(Datum) * disktdesc->natts);
+	nulls = (bool *) palloc(sizeof(bool) * disktdesc->natts);
+	phony_nullbitmap = (bits8 *) palloc(BITMAPLEN(disktdesc->natts));
+
+	/* columns without any non-null value store nothing at all */
+	for (keyno = 0; keyno < natts; keyno++)
+	{
+		BrinValues *col = &dtup->bt_columns[keyno];
+
+		if (col->bv_allnulls)
+		{
+			values[2 * keyno] = values[2 * keyno + 1] = (Datum) 0;
+			nulls[2 * keyno] = nulls[2 * keyno + 1] = true;
+		}
+		else
+		{
+			values[2 * keyno] = col->bv_min;
+			values[2 * keyno + 1] = col->bv_max;
+			nulls[2 * keyno] = nulls[2 * keyno + 1] = false;
+		}
+	}
+
+	hoff = MAXALIGN(SizeOfBrinTuple + BITMAPLEN(2 * natts));
+	data_len = heap_compute_data_size(disktdesc, values, nulls);
+	len = MAXALIGN(hoff + data_len);
+
+	rettuple = (BrinTuple *) palloc0(len);
+	rettuple->bt_blkno = blkno;
+	rettuple->bt_hoff = hoff;
+	if (dtup->bt_placeholder)
+		rettuple->bt_info |= BRIN_PLACEHOLDER_MASK;
+
+	heap_fill_tuple(disktdesc, values, nulls,
+					(char *) rettuple + hoff, data_len,
+					&phony_infomask, phony_nullbitmap);
+
+	for (keyno = 0; keyno < natts; keyno++)
+	{
+		BrinValues *col = &dtup->bt_columns[keyno];
+
+		if (col->bv_allnulls)
+			rettuple->bt_bits[(2 * keyno) >> 3] |= 1 << ((2 * keyno) & 7);
+		if (col->bv_hasnulls)
+			rettuple->bt_bits[(2 * keyno + 1) >> 3] |= 1 << ((2 * keyno + 1) & 7);
+	}
+
+	pfree(values);
+	pfree(nulls);
+	pfree(phony_nullbitmap);
+
+	*size = len;
+	return rettuple;
+}
+
+/*
+ * Generate a new on-disk placeholder tuple, for a range that is about to be
+ * summarized.  It claims all of its columns to be entirely null.
+ */
+BrinTuple *
+brin_form_placeholder_tuple(BrinDesc *bdesc, BlockNumber blkno, Size *size)
+{
+	int			natts = bdesc->bd_tupdesc->natts;
+	Size		len;
+	BrinTuple  *rettuple;
+	int			keyno;
+
+	len = MAXALIGN(SizeOfBrinTuple + BITMAPLEN(2 * natts));
+
+	rettuple = (BrinTuple *) palloc0(len);
+	rettuple->bt_blkno = blkno;
+	rettuple->bt_info = BRIN_PLACEHOLDER_MASK;
+	rettuple->bt_hoff = len;
+
+	for (keyno = 0; keyno < natts; keyno++)
+		rettuple->bt_bits[(2 * keyno) >> 3] |= 1 << ((2 * keyno) & 7);
+
+	*size = len;
+	return rettuple;
+}
+
+/*
+ * Return a palloc'd copy of an on-disk tuple.
+ */
+BrinTuple *
+brin_copy_tuple(BrinTuple *tuple, Size len)
+{
+	BrinTuple  *newtup;
+
+	newtup = (BrinTuple *) palloc(len);
+	memcpy(newtup, tuple, len);
+
+	return newtup;
+}
+
+/*
+ * Return whether two on-disk tuples are bytewise identical.
+ */
+bool
+brin_tuples_equal(const BrinTuple *a, Size alen, const BrinTuple *b, Size blen)
+{
+	if (alen != blen)
+		return false;
+	if (memcmp(a, b, alen) != 0)
+		return false;
+	return true;
+}
+
+/*
+ * Create a new in-memory tuple, with every column entirely null.  The values
+ * later added to it are kept in its own memory context, a child of the
+ * current one.
+ */
+BrinMemTuple *
+brin_new_memtuple(BrinDesc *bdesc)
+{
+	BrinMemTuple *dtup;
+
+	dtup = (BrinMemTuple *) palloc0(offsetof(BrinMemTuple, bt_columns) +
+							   sizeof(BrinValues) * bdesc->bd_tupdesc->natts);
+	dtup->bt_context = AllocSetContextCreate(CurrentMemoryContext,
+											 "brin dtuple",
+											 ALLOCSET_DEFAULT_MINSIZE,
+											 ALLOCSET_DEFAULT_INITSIZE,
+											 ALLOCSET_DEFAULT_MAXSIZE);
+	brin_memtuple_initialize(dtup, bdesc);
+
+	return dtup;
+}
+
+/*
+ * Reset an in-memory tuple to the state brin_new_memtuple returns it in.
+ */
+void
+brin_memtuple_initialize(BrinMemTuple *dtup, BrinDesc *bdesc)
+{
+	int			keyno;
+
+	MemoryContextReset(dtup->bt_context);
+	dtup->bt_placeholder = false;
+	for (keyno = 0; keyno < bdesc->bd_tupdesc->natts; keyno++)
+	{
+		dtup->bt_columns[keyno].bv_allnulls = true;
+		dtup->bt_columns[keyno].bv_hasnulls = false;
+		dtup->bt_columns[keyno].bv_min = (Datum) 0;
+		dtup->bt_columns[keyno].bv_max = (Datum) 0;
+	}
+}
+
+/*
+ * Convert an on-disk tuple into a new in-memory tuple.
+ *
+ * Pass-by-reference values point into the given tuple, which must therefore
+ * outlive the result.
+ */
+BrinMemTuple *
+brin_deform_tuple(BrinDesc *bdesc, BrinTuple *tuple)
+{
+	TupleDesc	disktdesc = bdesc->bd_disktdesc;
+	BrinMemTuple *dtup;
+	char	   *tp;
+	long		off = 0;
+	int			keyno;
+
+	dtup = brin_new_memtuple(bdesc);
+	dtup->bt_placeholder = BrinTupleIsPlaceholder(tuple);
+	dtup->bt_blkno = tuple->bt_blkno;
+
+	tp = (char *) tuple + tuple->bt_hoff;
+	for (keyno = 0; keyno < bdesc->bd_tupdesc->natts; keyno++)
+	{
+		BrinValues *col = &dtup->bt_columns[keyno];
+		int			i;
+
+		col->bv_allnulls = BrinTupleAllNulls(tuple, keyno);
+		col->bv_hasnulls = BrinTupleHasNulls(tuple, keyno);
+
+		/* nothing is stored for the column then */
+		if (col->bv_allnulls)
+			continue;
+
+		for (i = 0; i < 2; i++)
+		{
+			Form_pg_attribute thisatt = disktdesc->attrs[2 * keyno + i];
+			Datum		value;
+
+			if (thisatt->attlen == -1)
+				off = att_align_pointer(off, thisatt->attalign, -1, tp + off);
+			else
+				off = att_align_nominal(off, thisatt->attalign);
+
+			value = fetchatt(thisatt, tp + off);
+			off = att_addlength_pointer(off, thisatt->attlen, tp + off);
+
+			if (i == 0)
+				col->bv_min = value;
+			else
+				col->bv_max = value;
+		}
+	}
+
+	return dtup;
+}
+
+/*
+ * Widen the summary of column attno (1-based) so that it covers the given
+ * value.  Returns true if the summary changed.
+ *
+ * The values kept are detoasted copies, allocated in the tuple's memory
+ * context.
+ */
+bool
+brin_add_value(BrinDesc *bdesc, BrinMemTuple *dtup, int attno,
+			   Datum value, bool isnull)
+{
+	BrinValues *col = &dtup->bt_columns[attno - 1];
+	Form_pg_attribute attr = bdesc->bd_tupdesc->attrs[attno - 1];
+	Oid			collation = bdesc->bd_index->rd_indcollation[attno - 1];
+	FmgrInfo   *cmp;
+	MemoryContext oldcxt;
+	bool		updated = false;
+
+	if (isnull)
+	{
+		if (col->bv_hasnulls)
+			return false;
+		col->bv_hasnulls = true;
+		return true;
+	}
+
+	oldcxt = MemoryContextSwitchTo(dtup->bt_context);
+
+	/* never store toasted values, nor keep comparing against them */
+	if (attr->attlen == -1)
+		value = PointerGetDatum(PG_DETOAST_DATUM(value));
+
+	if (col->bv_allnulls)
+	{
+		col->bv_min = datumCopy(value, attr->attbyval, attr->attlen);
+		col->bv_max = col->bv_min;
+		col->bv_allnulls = false;
+		updated = true;
+	}
+	else
+	{
+		cmp = index_getprocinfo(bdesc->bd_index, attno, BRIN_COMPARE_PROC);
+
+		if (DatumGetInt32(FunctionCall2Coll(cmp, collation,
+											value, col->bv_min)) < 0)
+		{
+			col->bv_min = datumCopy(value, attr->attbyval, attr->attlen);
+			updated = true;
+		}
+		else if (DatumGetInt32(FunctionCall2Coll(cmp, collation,
+												 value, col->bv_max)) > 0)
+		{
+			col->bv_max = datumCopy(value, attr->attbyval, attr->attlen);
+			updated = true;
+		}
+	}
+
+	MemoryContextSwitchTo(oldcxt);
+
+	return updated;
+}
+
+/*
+ * Widen the summary in dst so that it also covers the one in src.
+ */
+void
+brin_union_tuples(BrinDesc *bdesc, BrinMemTuple *dst, BrinMemTuple *src)
+{
+	int			keyno;
+
+	for (keyno = 0; keyno < bdesc->bd_tupdesc->natts; keyno++)
+	{
+		BrinValues *col = &src->bt_columns[keyno];
+
+		if (col->bv_hasnulls)
+			(void) brin_add_value(bdesc, dst, keyno + 1, (Datum) 0, true);
+		if (!col->bv_allnulls)
+		{
+			(void) brin_add_value(bdesc, dst, keyno + 1, col->bv_min, false);
+			(void) brin_add_value(bdesc, dst, keyno + 1, col->bv_max, false);
+		}
+	}
+}
@@ -0,0 +1,281 @@
+/*-------------------------------------------------------------------------
+ *
+ * brinxlog.c
+ *	  WAL replay logic for BRIN indexes
+ *
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *			src/backend/access/brin/brinxlog.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/brin_private.h"
+#include "access/xlogutils.h"
+#include "storage/bufmgr.h"
+
+
+/*
+ * xlog replay routines
+ */
+static void
+brin_xlog_createidx(XLogRecPtr lsn, XLogRecord *record)
+{
+	xl_brin_createidx *xlrec = (xl_brin_createidx *) XLogRecGetData(record);
+	Buffer		buf;
+	Page		page;
+
+	/* Backup blocks are not used in create_index records */
+	Assert(!(record->xl_info & XLR_BKP_BLOCK_MASK));
+
+	/* create the index' metapage */
+	buf = XLogReadBuffer(xlrec->node, BRIN_METAPAGE_BLKNO, true);
+	Assert(BufferIsValid(buf));
+	page = (Page) BufferGetPage(buf);
+	brin_metapage_init(page, xlrec->pagesPerRange, xlrec->version);
+	PageSetLSN(page, lsn);
+	MarkBufferDirty(buf);
+	UnlockReleaseBuffer(buf);
+}
+
+/*
+ * Common part of an insert or update.  Inserts the new tuple and updates the
+ * revmap; the backup block numbers of both pages are given by the caller.
+ */
+static void
+brin_xlog_insert_update(XLogRecPtr lsn, XLogRecord *record,
+						xl_brin_insert *xlrec, BrinTuple *tuple, Size tuplen,
+						int revmapbkp, int newbkp)
+{
+	bool		isinit = (record->xl_info & XLOG_BRIN_INIT_PAGE) != 0;
+	BlockNumber blkno;
+	OffsetNumber offnum;
+	Buffer		buffer;
+	Page		page;
+
+	blkno = ItemPointerGetBlockNumber(&xlrec->tid);
+	offnum = ItemPointerGetOffsetNumber(&xlrec->tid);
+
+	/*
+	 * The new tuple goes first, so that the revmap never points to a tuple
+	 * that doesn't exist yet.  A freshly initialized page is never backed up.
+	 */
+	if (!isinit && (record->xl_info & XLR_BKP_BLOCK(newbkp)))
+		(void) RestoreBackupBlock(lsn, record, newbkp, false, false);
+	else
+	{
+		buffer = XLogReadBuffer(xlrec->node, blkno, isinit);
+		if (BufferIsValid(buffer))
+		{
+			page = (Page) BufferGetPage(buffer);
+
+			if (isinit)
+				brin_page_init(page, BRIN_PAGETYPE_REGULAR);
+
+			if (lsn > PageGetLSN(page))
+			{
+				if (PageAddItem(page, (Item) tuple, tuplen, offnum,
+								true, false) == InvalidOffsetNumber)
+					elog(PANIC, "brin_xlog_insert_update: failed to add tuple");
+
+				PageSetLSN(page, lsn);
+				MarkBufferDirty(buffer);
+			}
+			UnlockReleaseBuffer(buffer);
+		}
+	}
+
+	/* update the revmap */
+	if (record->xl_info & XLR_BKP_BLOCK(revmapbkp))
+		(void) RestoreBackupBlock(lsn, record, revmapbkp, false, false);
+	else
+	{
+		buffer = XLogReadBuffer(xlrec->node, xlrec->revmapBlk, false);
+		if (BufferIsValid(buffer))
+		{
+			page = (Page) BufferGetPage(buffer);
+
+			if (lsn > PageGetLSN(page))
+			{
+				brinSetHeapBlockItemptr(buffer, xlrec->pagesPerRange,
+										xlrec->heapBlk, xlrec->tid);
+				PageSetLSN(page, lsn);
+				MarkBufferDirty(buffer);
+			}
+			UnlockReleaseBuffer(buffer);
+		}
+	}
+}
+
+/*
+ * replay a BRIN index insertion
+ */
+static void
+brin_xlog_insert(XLogRecPtr lsn, XLogRecord *record)
+{
+	xl_brin_insert *xlrec = (xl_brin_insert *) XLogRecGetData(record);
+	BrinTuple  *newtup;
+	Size		tuplen;
+
+	/* the tuple is unused if the page was backed up */
+	newtup = (BrinTuple *) ((char *) xlrec + SizeOfBrinInsert);
+	tuplen = record->xl_len - SizeOfBrinInsert;
+
+	brin_xlog_insert_update(lsn, record, xlrec, newtup, tuplen, 0, 1);
+}
+
+/*
+ * replay a BRIN index update that moved the tuple to another page
+ */
+static void
+brin_xlog_update(XLogRecPtr lsn, XLogRecord *record)
+{
+	xl_brin_update *xlrec = (xl_brin_update *) XLogRecGetData(record);
+	BrinTuple  *newtup;
+	Size		tuplen;
+	Buffer		buffer;
+	Page		page;
+
+	newtup = (BrinTuple *) ((char *) xlrec + SizeOfBrinUpdate);
+	tuplen = record->xl_len - SizeOfBrinUpdate;
+
+	/* First insert the new tuple and update revmap, like in an insertion. */
+	brin_xlog_insert_update(lsn, record, &xlrec->new, newtup, tuplen, 0, 2);
+
+	/* Then remove the old tuple */
+	if (record->xl_info & XLR_BKP_BLOCK(1))
+		(void) RestoreBackupBlock(lsn, record, 1, false, false);
+	else
+	{
+		buffer = XLogReadBuffer(xlrec->new.node,
+								ItemPointerGetBlockNumber(&xlrec->oldtid),
+								false);
+		if (BufferIsValid(buffer))
+		{
+			page = (Page) BufferGetPage(buffer);
+
+			if (lsn > PageGetLSN(page))
+			{
+				brin_page_delete_item(page,
+								  ItemPointerGetOffsetNumber(&xlrec->oldtid));
+				PageSetLSN(page, lsn);
+				MarkBufferDirty(buffer);
+			}
+			UnlockReleaseBuffer(buffer);
+		}
+	}
+}
+
+/*
+ * Update a tuple on a single page.
+ */
+static void
+brin_xlog_samepage_update(XLogRecPtr lsn, XLogRecord *record)
+{
+	xl_brin_samepage_update *xlrec;
+	BrinTuple  *newtup;
+	Size		tuplen;
+	Buffer		buffer;
+	Page		page;
+
+	xlrec = (xl_brin_samepage_update *) XLogRecGetData(record);
+
+	if (record->xl_info & XLR_BKP_BLOCK(0))
+	{
+		(void) RestoreBackupBlock(lsn, record, 0, false, false);
+		return;
+	}
+
+	newtup = (BrinTuple *) ((char *) xlrec + SizeOfBrinSamepageUpdate);
+	tuplen = record->xl_len - SizeOfBrinSamepageUpdate;
+
+	buffer = XLogReadBuffer(xlrec->node,
+							ItemPointerGetBlockNumber(&xlrec->tid), false);
+	if (BufferIsValid(buffer))
+	{
+		page = (Page) BufferGetPage(buffer);
+
+		if (lsn > PageGetLSN(page))
+		{
+			brin_page_replace_item(page,
+								   ItemPointerGetOffsetNumber(&xlrec->tid),
+								   newtup, tuplen);
+			PageSetLSN(page, lsn);
+			MarkBufferDirty(buffer);
+		}
+		UnlockReleaseBuffer(buffer);
+	}
+}
+
+/*
+ * Replay a revmap page extension
+ */
+static void
+brin_xlog_revmap_extend(XLogRecPtr lsn, XLogRecord *record)
+{
+	xl_brin_revmap_extend *xlrec;
+	Buffer		buffer;
+	Page		page;
+
+	xlrec = (xl_brin_revmap_extend *) XLogRecGetData(record);
+
+	/* Initialize the new revmap page before anything points to it */
+	buffer = XLogReadBuffer(xlrec->node, xlrec->targetBlk, true);
+	Assert(BufferIsValid(buffer));
+	page = (Page) BufferGetPage(buffer);
+	brin_revmap_page_init(page);
+	PageSetLSN(page, lsn);
+	MarkBufferDirty(buffer);
+	UnlockReleaseBuffer(buffer);
+
+	/* Then add it to the metapage */
+	if (record->xl_info & XLR_BKP_BLOCK(0))
+		(void) RestoreBackupBlock(lsn, record, 0, false, false);
+	else
+	{
+		buffer = XLogReadBuffer(xlrec->node, BRIN_METAPAGE_BLKNO, false);
+		if (BufferIsValid(buffer))
+		{
+			page = (Page) BufferGetPage(buffer);
+
+			if (lsn > PageGetLSN(page))
+			{
+				brin_metapage_add_revmap_page(page, xlrec->targetBlk);
+				PageSetLSN(page, lsn);
+				MarkBufferDirty(buffer);
+			}
+			UnlockReleaseBuffer(buffer);
+		}
+	}
+}
+
+void
+brin_redo(XLogRecPtr lsn, XLogRecord *record)
+{
+	uint8		info = record->xl_info & ~XLR_INFO_MASK;
+
+	switch (info & XLOG_BRIN_OPMASK)
+	{
+		case XLOG_BRIN_CREATE_INDEX:
+			brin_xlog_createidx(lsn, record);
+			break;
+		case XLOG_BRIN_INSERT:
+			brin_xlog_insert(lsn, record);
+			break;
+		case XLOG_BRIN_UPDATE:
+			brin_xlog_update(lsn, record);
+			break;
+		case XLOG_BRIN_SAMEPAGE_UPDATE:
+			brin_xlog_samepage_update(lsn, record);
+			break;
+		case XLOG_BRIN_REVMAP_EXTEND:
+			brin_xlog_revmap_extend(lsn, record);
+			break;
+		default:
+			elog(PANIC, "brin_redo: unknown op code %u", info);
+	}
+}
@@ -63,6 +63,9 @@
 #include <arpa/inet.h>
 #include "funcapi.h"
 #endif
+#ifdef ADB
+#include "pgxc/datarowin.h"
+#endif
 #include "access/sysattr.h"
 #include "access/tuptoaster.h"
 #include "executor/tuptable.h"
@@ -1223,8 +1226,16 @@ slot_deform_datarow(TupleTableSlot *slot)
 	 */
 	oldcontext = MemoryContextSwitchTo(slot->tts_mcxt);
 
+#ifdef ADB
+	if (!DataRowInMetadataIsValid((DataRowInMetadata *) slot->tts_attinmeta,
+								  slot->tts_attinmeta_gen))
+		slot->tts_attinmeta = (AttInMetadata *)
+			GetDataRowInMetadata(slot->tts_tupleDescriptor,
+								 &slot->tts_attinmeta_gen);
+#else
 	if (slot->tts_attinmeta == NULL)
 		slot->tts_attinmeta = TupleDescGetAttInMetadata(slot->tts_tupleDescriptor);
+#endif
 
 	buffer = makeStringInfo();
 	for (i = 0; i < attnum; i++)
@@ -1242,6 +1253,31 @@ slot_deform_datarow(TupleTableSlot *slot)
 			slot->tts_values[i] = (Datum) 0;
 			slot->tts_isnull[i] = true;
 		}
+#ifdef ADB
+		else if (DataRowInputFast((DataRowInMetadata *) slot->tts_attinmeta,
+								  i, cur, len, &slot->tts_values[i]))
+		{
+			cur += len;
+			slot->tts_isnull[i] = false;
+		}
+#endif
+		else if (cur + len < slot->tts_dataRow + slot->tts_dataLen)
+		{
+			/*
+			 * The value is followed by more data in the message, so terminate
+			 * it in place rather than copying it out.
+			 */
+			char		save = cur[len];
+
+			cur[len] = '\0';
+			slot->tts_values[i] = InputFunctionCall(slot->tts_attinmeta->attinfuncs + i,
+													cur,
+													slot->tts_attinmeta->attioparams[i],
+													slot->tts_attinmeta->atttypmods[i]);
+			cur[len] = save;
+			cur += len;
+			slot->tts_isnull[i] = false;
+		}
 		else
 		{
 			appendBinaryStringInfo(buffer, cur, len);
@@ -19,6 +19,8 @@
 #include "libpq/libpq.h"
 #include "libpq/pqformat.h"
 #include "tcop/pquery.h"
+#include "utils/builtins.h"
+#include "utils/fmgroids.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #ifdef PGXC
@@ -46,15 +48,28 @@ static void printtup_destroy(DestReceiver *self);
  *		Private state for a printtup destination object
  *
  * NOTE: finfo is the lookup info for either typoutput or typsend, whichever
- * we are using for this column.
+ * we are using for this column.  The output of a few common types is
+ * encoded by printtup() itself, their fastpath says how.
  * ----------------
  */
+typedef enum PrinttupFastPath
+{
+	PRINTTUP_FN_CALL = 0,		/* call the output or send function */
+	PRINTTUP_INT2,
+	PRINTTUP_INT4,
+	PRINTTUP_INT8,
+	PRINTTUP_OID,
+	PRINTTUP_BOOL,
+	PRINTTUP_TEXT				/* text, varchar and bpchar */
+} PrinttupFastPath;
+
 typedef struct
 {								/* Per-attribute information */
 	Oid			typoutput;		/* Oid for the type's text output fn */
 	Oid			typsend;		/* Oid for the type's binary output fn */
 	bool		typisvarlena;	/* is it varlena (ie possibly toastable)? */
 	int16		format;			/* format code for this column */
+	PrinttupFastPath fastpath;	/* how printtup() outputs this column */
 	FmgrInfo	finfo;			/* Precomputed call info for output fn */
 } PrinttupAttrInfo;
 
@@ -66,9 +81,15 @@ typedef struct
 	TupleDesc	attrinfo;		/* The attr info we are set up for */
 	int			nattrs;
 	PrinttupAttrInfo *myinfo;	/* Cached info about each attr */
+#ifdef PGXC
+	bool		send_datarow;	/* can DataRows from the nodes be sent as is? */
+#endif
+	StringInfoData buf;			/* output buffer, reused for each row */
 	MemoryContext tmpcontext;	/* Memory context for per-row workspace */
 } DR_printtup;
 
+static PrinttupFastPath printtup_fast_path(Oid funcid);
+
 /* ----------------
  *		Initialize: create a DestReceiver for printtup
  * ----------------
@@ -143,6 +164,9 @@ printtup_startup(DestReceiver *self, int operation, TupleDesc typeinfo)
 												ALLOCSET_DEFAULT_INITSIZE,
 												ALLOCSET_DEFAULT_MAXSIZE);
 
+	/* The DataRow buffer lives as long as we do, see printtup() */
+	initStringInfo(&myState->buf);
+
 	if (PG_PROTOCOL_MAJOR(FrontendProtocol) < 3)
 	{
 		/*
@@ -280,6 +304,9 @@ printtup_prepare_info(DR_printtup *myState, TupleDesc typeinfo, int numAttrs)
 
 	myState->attrinfo = typeinfo;
 	myState->nattrs = numAttrs;
+#ifdef PGXC
+	myState->send_datarow = true;
+#endif
 	if (numAttrs <= 0)
 		return;
 
@@ -310,6 +337,137 @@ printtup_prepare_info(DR_printtup *myState, TupleDesc typeinfo, int numAttrs)
 			ereport(ERROR,
 					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
 					 errmsg("unsupported format code: %d", format)));
+		thisState->fastpath = printtup_fast_path(thisState->finfo.fn_oid);
+
+#ifdef PGXC
+		/*
+		 * The nodes send their rows in text format, and anyarray values need
+		 * their element type added, see anyarray_out.
+		 */
+		if (format != 0)
+			myState->send_datarow = false;
+#ifdef ADB
+		if (typeinfo->attrs[i]->atttypid == ANYARRAYOID)
+			myState->send_datarow = false;
+#endif
+#endif
+	}
+}
+
+/*
+ * Which output functions printtup() does itself.  Looking at the function
+ * rather than the type also covers domains over these types.
+ */
+static PrinttupFastPath
+printtup_fast_path(Oid funcid)
+{
+	switch (funcid)
+	{
+		case F_INT2OUT:
+		case F_INT2SEND:
+			return PRINTTUP_INT2;
+		case F_INT4OUT:
+		case F_INT4SEND:
+			return PRINTTUP_INT4;
+		case F_INT8OUT:
+		case F_INT8SEND:
+			return PRINTTUP_INT8;
+		case F_OIDOUT:
+		case F_OIDSEND:
+			return PRINTTUP_OID;
+		case F_BOOLOUT:
+		case F_BOOLSEND:
+			return PRINTTUP_BOOL;
+		case F_TEXTOUT:
+		case F_TEXTSEND:
+		case F_VARCHAROUT:
+		case F_VARCHARSEND:
+		case F_BPCHAROUT:
+		case F_BPCHARSEND:
+			return PRINTTUP_TEXT;
+		default:
+			return PRINTTUP_FN_CALL;
+	}
+}
+
+#define MAXINT8LEN		25
+
+/*
+ * Append a column handled by printtup_fast_path(), as its output or send
+ * function would have produced it.
+ */
+static void
+printtup_fast_attr(StringInfo buf, PrinttupAttrInfo *thisState, Datum attr)
+{
+	char		str[MAXINT8LEN + 1];
+	int			len;
+
+	if (thisState->fastpath == PRINTTUP_TEXT)
+	{
+		/* textout and textsend both only convert the encoding */
+		text	   *t = DatumGetTextPP(attr);
+
+		pq_sendcountedtext(buf, VARDATA_ANY(t), VARSIZE_ANY_EXHDR(t), false);
+		return;
+	}
+
+	if (thisState->format == 0)
+	{
+		switch (thisState->fastpath)
+		{
+			case PRINTTUP_INT2:
+				pg_itoa(DatumGetInt16(attr), str);
+				break;
+			case PRINTTUP_INT4:
+				pg_ltoa(DatumGetInt32(attr), str);
+				break;
+			case PRINTTUP_INT8:
+				pg_lltoa(DatumGetInt64(attr), str);
+				break;
+			case PRINTTUP_OID:
+				snprintf(str, sizeof(str), "%u", DatumGetObjectId(attr));
+				break;
+			case PRINTTUP_BOOL:
+				str[0] = DatumGetBool(attr) ? 't' : 'f';
+				str[1] = '\0';
+				break;
+			default:
+				elog(ERROR, "unrecognized printtup fast path: %d",
+					 (int) thisState->fastpath);
+		}
+
+		/* ASCII is the same in every encoding, skip the conversion */
+		len = strlen(str);
+		pq_sendint(buf, len, 4);
+		appendBinaryStringInfo(buf, str, len);
+		return;
+	}
+
+	switch (thisState->fastpath)
+	{
+		case PRINTTUP_INT2:
+			pq_sendint(buf, sizeof(int16), 4);
+			pq_sendint(buf, DatumGetInt16(attr), sizeof(int16));
+			break;
+		case PRINTTUP_INT4:
+			pq_sendint(buf, sizeof(int32), 4);
+			pq_sendint(buf, DatumGetInt32(attr), sizeof(int32));
+			break;
+		case PRINTTUP_INT8:
+			pq_sendint(buf, sizeof(int64), 4);
+			pq_sendint64(buf, DatumGetInt64(attr));
+			break;
+		case PRINTTUP_OID:
+			pq_sendint(buf, sizeof(Oid), 4);
+			pq_sendint(buf, DatumGetObjectId(attr), sizeof(Oid));
+			break;
+		case PRINTTUP_BOOL:
+			pq_sendint(buf, 1, 4);
+			pq_sendbyte(buf, DatumGetBool(attr) ? 1 : 0);
+			break;
+		default:
+			elog(ERROR, "unrecognized printtup fast path: %d",
+				 (int) thisState->fastpath);
 	}
 }
 
@@ -323,45 +481,27 @@ printtup(TupleTableSlot *slot, DestReceiver *self)
 	TupleDesc	typeinfo = slot->tts_tupleDescriptor;
 	DR_printtup *myState = (DR_printtup *) self;
 	MemoryContext oldcontext;
-	StringInfoData buf;
+	StringInfo	buf = &myState->buf;
 	int			natts = typeinfo->natts;
 	int			i;
 
-#ifdef ADB
-	bool		have_anyarray = false;
-	Form_pg_attribute *atts = typeinfo->attrs;
-
-	for (i = 0; i < natts; i++)
-	{
-		if (atts[i]->atttypid == ANYARRAYOID)
-		{
-			have_anyarray = true;
-			break;
-		}
-	}
-#endif
+	/* Set or update my derived attribute info, if needed */
+	if (myState->attrinfo != typeinfo || myState->nattrs != natts)
+		printtup_prepare_info(myState, typeinfo, natts);
 
 #ifdef PGXC
 	/*
 	 * If we are having DataRow-based tuple we do not have to encode attribute
 	 * values, just send over the DataRow message as we received it from the
-	 * Datanode
+	 * Datanode, as long as that is what the client asked for.
 	 */
-#ifdef ADB
-	if (slot->tts_dataRow && !have_anyarray)
-#else
-	if (slot->tts_dataRow)
-#endif
+	if (slot->tts_dataRow && myState->send_datarow)
 	{
 		pq_putmessage('D', slot->tts_dataRow, slot->tts_dataLen);
 		return;
 	}
 #endif
 
-	/* Set or update my derived attribute info, if needed */
-	if (myState->attrinfo != typeinfo || myState->nattrs != natts)
-		printtup_prepare_info(myState, typeinfo, natts);
-
 	/* Make sure the tuple is fully deconstructed */
 	slot_getallattrs(slot);
 
@@ -369,11 +509,11 @@ printtup(TupleTableSlot *slot, DestReceiver *self)
 	oldcontext = MemoryContextSwitchTo(myState->tmpcontext);
 
 	/*
-	 * Prepare a DataRow message (note buffer is in per-row context)
+	 * Prepare a DataRow message (note buffer is kept across rows)
 	 */
-	pq_beginmessage(&buf, 'D');
+	pq_beginmessage_reuse(buf, 'D');
 
-	pq_sendint(&buf, natts, 2);
+	pq_sendint(buf, natts, 2);
 
 	/*
 	 * send the attributes of this tuple
@@ -385,17 +525,19 @@ printtup(TupleTableSlot *slot, DestReceiver *self)
 
 		if (slot->tts_isnull[i])
 		{
-			pq_sendint(&buf, -1, 4);
+			pq_sendint(buf, -1, 4);
 			continue;
 		}
 
-		if (thisState->format == 0)
+		if (thisState->fastpath != PRINTTUP_FN_CALL)
+			printtup_fast_attr(buf, thisState, attr);
+		else if (thisState->format == 0)
 		{
 			/* Text output */
 			char	   *outputstr;
 
 			outputstr = OutputFunctionCall(&thisState->finfo, attr);
-			pq_sendcountedtext(&buf, outputstr, strlen(outputstr), false);
+			pq_sendcountedtext(buf, outputstr, strlen(outputstr), false);
 		}
 		else
 		{
@@ -403,13 +545,13 @@ printtup(TupleTableSlot *slot, DestReceiver *self)
 			bytea	   *outputbytes;
 
 			outputbytes = SendFunctionCall(&thisState->finfo, attr);
-			pq_sendint(&buf, VARSIZE(outputbytes) - VARHDRSZ, 4);
-			pq_sendbytes(&buf, VARDATA(outputbytes),
+			pq_sendint(buf, VARSIZE(outputbytes) - VARHDRSZ, 4);
+			pq_sendbytes(buf, VARDATA(outputbytes),
 						 VARSIZE(outputbytes) - VARHDRSZ);
 		}
 	}
 
-	pq_endmessage(&buf);
+	pq_endmessage_reuse(buf);
 
 	/* Return to caller's context, and flush row's temporary memory */
 	MemoryContextSwitchTo(oldcontext);
@@ -507,6 +649,10 @@ printtup_shutdown(DestReceiver *self)
 
 	myState->attrinfo = NULL;
 
+	if (myState->buf.data)
+		pfree(myState->buf.data);
+	myState->buf.data = NULL;
+
 	if (myState->tmpcontext)
 		MemoryContextDelete(myState->tmpcontext);
 	myState->tmpcontext = NULL;
@@ -15,12 +15,14 @@
 
 #include "postgres.h"
 
+#include "access/brin.h"
 #include "access/gist_private.h"
 #include "access/hash.h"
 #include "access/htup_details.h"
 #include "access/nbtree.h"
 #include "access/reloptions.h"
 #include "access/spgist.h"
+#include "access/tuptoaster.h"
 #include "catalog/pg_type.h"
 #include "commands/defrem.h"
 #include "commands/tablespace.h"
@@ -76,6 +78,22 @@ static relopt_bool boolRelOpts[] =
 		},
 		false
 	},
+	{
+		{
+			"autotune_fillfactor",
+			"Adapts the free space kept on table pages to the needs of HOT updates",
+			RELOPT_KIND_HEAP
+		},
+		false
+	},
+	{
+		{
+			"deduplicate_items",
+			"Enables merging of duplicate keys into posting lists for this btree index",
+			RELOPT_KIND_BTREE
+		},
+		true
+	},
 	/* list terminator */
 	{{NULL}}
 };
@@ -122,6 +140,14 @@ static relopt_int intRelOpts[] =
 		},
 		SPGIST_DEFAULT_FILLFACTOR, SPGIST_MIN_FILLFACTOR, 100
 	},
+	{
+		{
+			"pages_per_range",
+			"Number of pages that each page range covers in a BRIN index",
+			RELOPT_KIND_BRIN
+		},
+		BRIN_DEFAULT_PAGES_PER_RANGE, 1, BRIN_MAX_PAGES_PER_RANGE
+	},
 	{
 		{
 			"autovacuum_vacuum_threshold",
@@ -279,6 +305,17 @@ static relopt_string stringRelOpts[] =
 		gistValidateBufferingOption,
 		"auto"
 	},
+	{
+		{
+			"compression",
+			"Sets the compression method for new values of a column",
+			RELOPT_KIND_ATTRIBUTE
+		},
+		0,
+		true,
+		toast_validate_compression_option,
+		NULL
+	},
 	/* list terminator */
 	{{NULL}}
 };
@@ -1189,6 +1226,8 @@ default_reloptions(Datum reloptions, bool validate, relopt_kind kind)
 		offsetof(StdRdOptions, autovacuum) +offsetof(AutoVacOpts, analyze_scale_factor)},
 		{"security_barrier", RELOPT_TYPE_BOOL,
 		offsetof(StdRdOptions, security_barrier)},
+		{"autotune_fillfactor", RELOPT_TYPE_BOOL,
+		offsetof(StdRdOptions, autotune_fillfactor)},
 	};
 
 	options = parseRelOptions(reloptions, validate, kind, &numoptions);
@@ -1289,7 +1328,8 @@ attribute_reloptions(Datum reloptions, bool validate)
 	int			numoptions;
 	static const relopt_parse_elt tab[] = {
 		{"n_distinct", RELOPT_TYPE_REAL, offsetof(AttributeOpts, n_distinct)},
-		{"n_distinct_inherited", RELOPT_TYPE_REAL, offsetof(AttributeOpts, n_distinct_inherited)}
+		{"n_distinct_inherited", RELOPT_TYPE_REAL, offsetof(AttributeOpts, n_distinct_inherited)},
+		{"compression", RELOPT_TYPE_STRING, offsetof(AttributeOpts, compression_offset)}
 	};
 
 	options = parseRelOptions(reloptions, validate, RELOPT_KIND_ATTRIBUTE,
@@ -15,8 +15,31 @@
 #include "postgres.h"
 
 #include "access/gin_private.h"
+#include "access/heapam_xlog.h"
+#include "miscadmin.h"
 #include "utils/rel.h"
 
+/*
+ * State of a bottom-up posting tree build, see ginBeginPostingTree().
+ * levels[0] is the leaf page currently being filled, levels[1] its parent
+ * and so on; each is pinned and exclusively locked, and not yet linked into
+ * anything.
+ */
+#define GIN_PTREE_MAX_LEVELS	16
+
+struct GinPostingTreeBuild
+{
+	Relation	index;
+	GinStatsData *buildStats;
+	int			nlevels;
+	Buffer		levels[GIN_PTREE_MAX_LEVELS];
+	ItemPointerData lastItem;	/* last TID added, to check the order */
+	uint32		nitem;
+};
+
+static void ptbAddPostingItem(GinPostingTreeBuild *ptb, int level,
+				  PostingItem *pitem);
+
 int
 ginCompareItemPointers(ItemPointer a, ItemPointer b)
 {
@@ -670,6 +693,194 @@ ginInsertItemPointers(GinPostingTreeScan *gdi,
 	}
 }
 
+/*
+ * Get a fresh page for the given level of a posting tree being built.
+ */
+static Buffer
+ptbNewPage(GinPostingTreeBuild *ptb, int level)
+{
+	Buffer		buffer = GinNewBuffer(ptb->index);
+
+	GinInitBuffer(buffer, GIN_DATA | ((level == 0) ? GIN_LEAF : 0));
+
+	/* During index build, count the newly-added data page */
+	if (ptb->buildStats)
+		ptb->buildStats->nDataPages++;
+
+	return buffer;
+}
+
+/*
+ * Finish a page of a posting tree being built: set its right bound to its
+ * last key and its right link to rightlink, and write it out.  Returns the
+ * downlink for the parent level.
+ */
+static PostingItem
+ptbFinishPage(GinPostingTreeBuild *ptb, Buffer buffer, BlockNumber rightlink)
+{
+	Page		page = BufferGetPage(buffer);
+	OffsetNumber maxoff = GinPageGetOpaque(page)->maxoff;
+	PostingItem pitem;
+
+	Assert(maxoff >= FirstOffsetNumber);
+
+	if (GinPageIsLeaf(page))
+		pitem.key = *(ItemPointer) GinDataPageGetItem(page, maxoff);
+	else
+		pitem.key = ((PostingItem *) GinDataPageGetItem(page, maxoff))->key;
+	PostingItemSetBlockNumber(&pitem, BufferGetBlockNumber(buffer));
+
+	*GinDataPageGetRightBound(page) = pitem.key;
+	GinPageGetOpaque(page)->rightlink = rightlink;
+
+	START_CRIT_SECTION();
+
+	MarkBufferDirty(buffer);
+	if (RelationNeedsWAL(ptb->index))
+		log_newpage_buffer(buffer);
+
+	END_CRIT_SECTION();
+
+	UnlockReleaseBuffer(buffer);
+
+	return pitem;
+}
+
+/*
+ * Add a downlink to the given non-leaf level, starting a new page there if
+ * the current one is full.
+ */
+static void
+ptbAddPostingItem(GinPostingTreeBuild *ptb, int level, PostingItem *pitem)
+{
+	Page		page;
+
+	Assert(level > 0);
+
+	if (level >= ptb->nlevels)
+	{
+		if (level >= GIN_PTREE_MAX_LEVELS)
+			elog(ERROR, "posting tree of index \"%s\" is too deep",
+				 RelationGetRelationName(ptb->index));
+		ptb->levels[level] = ptbNewPage(ptb, level);
+		ptb->nlevels = level + 1;
+	}
+
+	page = BufferGetPage(ptb->levels[level]);
+	if (GinDataPageGetFreeSpace(page) < sizeof(PostingItem))
+	{
+		Buffer		newbuf = ptbNewPage(ptb, level);
+		PostingItem parentitem;
+
+		parentitem = ptbFinishPage(ptb, ptb->levels[level],
+								   BufferGetBlockNumber(newbuf));
+		ptb->levels[level] = newbuf;
+		ptbAddPostingItem(ptb, level + 1, &parentitem);
+		page = BufferGetPage(newbuf);
+	}
+
+	GinDataPageAddItem(page, pitem, InvalidOffsetNumber);
+}
+
+/*
+ * Start building a new posting tree bottom-up.
+ *
+ * This is for index builds, where all the TIDs of a key become known in
+ * increasing order: they are packed into full leaf pages one after another,
+ * and each level's pages are finished as soon as they fill up, instead of
+ * inserting the TIDs one page split at a time.  The pages are not visible to
+ * anyone until the root is linked from an entry tuple.
+ */
+GinPostingTreeBuild *
+ginBeginPostingTree(Relation index, GinStatsData *buildStats)
+{
+	GinPostingTreeBuild *ptb = palloc0(sizeof(GinPostingTreeBuild));
+
+	ptb->index = index;
+	ptb->buildStats = buildStats;
+	ptb->levels[0] = ptbNewPage(ptb, 0);
+	ptb->nlevels = 1;
+	ItemPointerSetMin(&ptb->lastItem);
+
+	return ptb;
+}
+
+/*
+ * Add TIDs to a posting tree being built.  items[] must be sorted, and
+ * follow all the TIDs added before.
+ */
+void
+ginPostingTreeAdd(GinPostingTreeBuild *ptb, ItemPointerData *items,
+				  uint32 nitem)
+{
+	while (nitem > 0)
+	{
+		Page		page = BufferGetPage(ptb->levels[0]);
+		uint32		nfit;
+
+		nfit = GinDataPageGetFreeSpace(page) / sizeof(ItemPointerData);
+		if (nfit == 0)
+		{
+			Buffer		newbuf = ptbNewPage(ptb, 0);
+			PostingItem pitem;
+
+			pitem = ptbFinishPage(ptb, ptb->levels[0],
+								  BufferGetBlockNumber(newbuf));
+			ptb->levels[0] = newbuf;
+			ptbAddPostingItem(ptb, 1, &pitem);
+			continue;
+		}
+		nfit = Min(nfit, nitem);
+
+		if (ptb->nitem > 0 &&
+			ginCompareItemPointers(&ptb->lastItem, items) >= 0)
+			elog(ERROR, "posting tree items of index \"%s\" are out of order",
+				 RelationGetRelationName(ptb->index));
+		Assert(nfit == 1 ||
+			   ginCompareItemPointers(&items[nfit - 2], &items[nfit - 1]) < 0);
+
+		memcpy(GinDataPageGetItem(page, GinPageGetOpaque(page)->maxoff + 1),
+			   items, nfit * sizeof(ItemPointerData));
+		GinPageGetOpaque(page)->maxoff += nfit;
+
+		ptb->lastItem = items[nfit - 1];
+		ptb->nitem += nfit;
+		items += nfit;
+		nitem -= nfit;
+	}
+}
+
+/*
+ * Finish building a posting tree, and return its root block.
+ */
+BlockNumber
+ginEndPostingTree(GinPostingTreeBuild *ptb)
+{
+	BlockNumber root = InvalidBlockNumber;
+	int			level;
+
+	if (ptb->nitem == 0)
+		elog(ERROR, "cannot build an empty posting tree");
+
+	/* The rightmost page of each level links to the parent level */
+	for (level = 0; level < ptb->nlevels; level++)
+	{
+		PostingItem pitem;
+
+		CHECK_FOR_INTERRUPTS();
+
+		pitem = ptbFinishPage(ptb, ptb->levels[level], InvalidBlockNumber);
+		if (level == ptb->nlevels - 1)
+			root = PostingItemGetBlockNumber(&pitem);
+		else
+			ptbAddPostingItem(ptb, level + 1, &pitem);
+	}
+
+	pfree(ptb);
+
+	return root;
+}
+
 Buffer
 ginScanBeginPostingTree(GinPostingTreeScan *gdi)
 {
@@ -21,6 +21,7 @@
 #include "access/gin_private.h"
 #include "commands/vacuum.h"
 #include "miscadmin.h"
+#include "storage/lmgr.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
 
@@ -706,21 +707,23 @@ processPendingPage(BuildAccumulator *accum, KeyArray *ka,
 /*
  * Move tuples from pending pages into regular GIN structure.
  *
- * This can be called concurrently by multiple backends, so it must cope.
- * On first glance it looks completely not concurrent-safe and not crash-safe
- * either.  The reason it's okay is that multiple insertion of the same entry
- * is detected and treated as a no-op by gininsert.c.  If we crash after
- * posting entries to the main index and before removing them from the
- * pending list, it's okay because when we redo the posting later on, nothing
- * bad will happen.  Likewise, if two backends simultaneously try to post
- * a pending entry into the main index, one will succeed and one will do
- * nothing.  We try to notice when someone else is a little bit ahead of
- * us in the process, but that's just to avoid wasting cycles.  Only the
- * action of removing a page from the pending list really needs exclusive
- * lock.
+ * Only one backend at a time cleans up the pending list of an index, which
+ * is ensured by a heavyweight lock on the metapage.  Inserters that find
+ * the list too long but someone else already cleaning it just carry on:
+ * queueing up behind the cleaner to redo its work would only stall them.
+ * Should two cleanups still overlap (which the code was written to survive
+ * before the lock was added), that's okay because multiple insertion of
+ * the same entry is detected and treated as a no-op by gininsert.c.  If we
+ * crash after posting entries to the main index and before removing them
+ * from the pending list, it's okay because when we redo the posting later
+ * on, nothing bad will happen.
  *
  * vac_delay indicates that ginInsertCleanup is called from vacuum process,
- * so call vacuum_delay_point() periodically.
+ * so call vacuum_delay_point() periodically.  Vacuum waits for the lock and
+ * empties the whole list, using up to maintenance_work_mem.  An inserter
+ * only processes the pages that were in the list when it started, so that
+ * it is not kept busy indefinitely by concurrent insertions, and it uses
+ * no more than work_mem.
  * If stats isn't null, we count deleted pending pages into the counts.
  */
 void
@@ -737,7 +740,23 @@ ginInsertCleanup(GinState *ginstate,
 				oldCtx;
 	BuildAccumulator accum;
 	KeyArray	datums;
-	BlockNumber blkno;
+	BlockNumber blkno,
+				blknoFinish;
+	bool		cleanupFinish = false;
+	long		workMemory;
+
+	if (vac_delay)
+	{
+		LockPage(index, GIN_METAPAGE_BLKNO, ExclusiveLock);
+		workMemory = maintenance_work_mem;
+	}
+	else
+	{
+		/* someone else is cleaning up already, leave it to them */
+		if (!ConditionalLockPage(index, GIN_METAPAGE_BLKNO, ExclusiveLock))
+			return;
+		workMemory = work_mem;
+	}
 
 	metabuffer = ReadBuffer(index, GIN_METAPAGE_BLKNO);
 	LockBuffer(metabuffer, GIN_SHARE);
@@ -748,9 +767,15 @@ ginInsertCleanup(GinState *ginstate,
 	{
 		/* Nothing to do */
 		UnlockReleaseBuffer(metabuffer);
+		UnlockPage(index, GIN_METAPAGE_BLKNO, ExclusiveLock);
 		return;
 	}
 
+	/*
+	 * Remember the tail of the list as of now; an inserter stops there.
+	 */
+	blknoFinish = vac_delay ? InvalidBlockNumber : metadata->tail;
+
 	/*
 	 * Read and lock head of pending list
 	 */
@@ -790,6 +815,10 @@ ginInsertCleanup(GinState *ginstate,
 			break;
 		}
 
+		/* is this the page that was the tail when we started? */
+		if (blkno == blknoFinish)
+			cleanupFinish = true;
+
 		/*
 		 * read page's datums into accum
 		 */
@@ -799,15 +828,16 @@ ginInsertCleanup(GinState *ginstate,
 
 		/*
 		 * Is it time to flush memory to disk?	Flush if we are at the end of
-		 * the pending list, or if we have a full row and memory is getting
-		 * full.
+		 * the pending list or of our share of it, or if we have a full row
+		 * and memory is getting full.
 		 *
 		 * XXX using up maintenance_work_mem here is probably unreasonably
 		 * much, since vacuum might already be using that much.
 		 */
 		if (GinPageGetOpaque(page)->rightlink == InvalidBlockNumber ||
 			(GinPageHasFullRow(page) &&
-			 (accum.allocatedMemory >= maintenance_work_mem * 1024L)))
+			 (cleanupFinish ||
+			  accum.allocatedMemory >= workMemory * 1024L)))
 		{
 			ItemPointerData *list;
 			uint32		nlist;
@@ -894,9 +924,10 @@ ginInsertCleanup(GinState *ginstate,
 			LockBuffer(metabuffer, GIN_UNLOCK);
 
 			/*
-			 * if we removed the whole pending list just exit
+			 * if we removed the whole pending list, or all of it that was
+			 * there when we started and we're not vacuum, just exit
 			 */
-			if (blkno == InvalidBlockNumber)
+			if (blkno == InvalidBlockNumber || cleanupFinish)
 				break;
 
 			/*
@@ -922,6 +953,7 @@ ginInsertCleanup(GinState *ginstate,
 	}
 
 	ReleaseBuffer(metabuffer);
+	UnlockPage(index, GIN_METAPAGE_BLKNO, ExclusiveLock);
 
 	/* Clean up temporary space */
 	MemoryContextSwitchTo(oldCtx);
@@ -17,10 +17,13 @@
 #include "access/gin_private.h"
 #include "access/heapam_xlog.h"
 #include "catalog/index.h"
+#include "lib/binaryheap.h"
 #include "miscadmin.h"
+#include "storage/buffile.h"
 #include "storage/bufmgr.h"
 #include "storage/smgr.h"
 #include "storage/indexfsm.h"
+#include "utils/datum.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
 
@@ -33,8 +36,47 @@ typedef struct
 	MemoryContext tmpCtx;
 	MemoryContext funcCtx;
 	BuildAccumulator accum;
+	MemoryContext buildCtx;		/* context the sorted runs live in */
+	BufFile   **runs;			/* sorted runs spilled to temp files */
+	int			nruns;
+	int			maxruns;
+	bool		spillPending;	/* spill once the current heap page is done */
+	BlockNumber curblkno;		/* heap page of the last tuple seen */
 } GinBuildState;
 
+/*
+ * Every entry of a sorted run starts with this header.  It is followed by
+ * keylen bytes of key data (the Datum itself for pass-by-value types, none
+ * for null keys) and then nlist TIDs in increasing order.
+ */
+typedef struct
+{
+	OffsetNumber attnum;
+	GinNullCategory category;
+	uint32		nlist;
+	Size		keylen;
+} GinRunEntryHeader;
+
+/*
+ * One input of the final merge of an index build: either a sorted run, or
+ * the entries still in the accumulator.  The entry at hand is described by
+ * attnum/key/category/nlist; for a run, its TIDs are still unread.
+ */
+typedef struct
+{
+	int			runno;			/* merge order; the accumulator comes last */
+	BufFile    *file;			/* NULL for the accumulator */
+	OffsetNumber attnum;
+	Datum		key;
+	GinNullCategory category;
+	uint32		nlist;
+	ItemPointerData *list;		/* TIDs, for the accumulator only */
+	bool		keyAllocated;	/* key was palloc'd by ginBuildSourceNext */
+} GinBuildSource;
+
+/* number of TIDs read from a run at a time when filling a posting tree */
+#define GIN_RUN_READ_CHUNK		8192
+
 /*
  * Creates new posting tree with one page, containing the given TIDs.
  * Returns the page number (which will be the root of this posting tree).
@@ -201,6 +243,19 @@ buildFreshLeafTuple(GinState *ginstate,
 		 */
 		res = GinFormTuple(ginstate, attnum, key, category, NULL, 0, true);
 
+		if (buildStats && nitem > GinMaxLeafDataItems)
+		{
+			/* During index build, write the whole tree bottom-up */
+			GinPostingTreeBuild *ptb;
+
+			ptb = ginBeginPostingTree(ginstate->index, buildStats);
+			ginPostingTreeAdd(ptb, items, nitem);
+			postingRoot = ginEndPostingTree(ptb);
+
+			GinSetPostingTree(res, postingRoot);
+			return res;
+		}
+
 		/*
 		 * Initialize posting tree with as many TIDs as will fit on the first
 		 * page.
@@ -306,6 +361,363 @@ ginEntryInsert(GinState *ginstate,
 	pfree(itup);
 }
 
+/*
+ * Insert a new entry tuple pointing to an already built posting tree.
+ * Used only during index build, when the key cannot be in the index yet.
+ */
+static void
+ginEntryInsertPostingTree(GinState *ginstate,
+						  OffsetNumber attnum, Datum key,
+						  GinNullCategory category, BlockNumber rootPostingTree,
+						  GinStatsData *buildStats)
+{
+	GinBtreeData btree;
+	GinBtreeStack *stack;
+	IndexTuple	itup;
+
+	buildStats->nEntries++;
+
+	itup = GinFormTuple(ginstate, attnum, key, category, NULL, 0, true);
+	GinSetPostingTree(itup, rootPostingTree);
+
+	ginPrepareEntryScan(&btree, attnum, key, category, ginstate);
+
+	stack = ginFindLeafPage(&btree, NULL);
+	if (btree.findItem(&btree, stack))
+		elog(ERROR, "duplicate key in GIN index build");
+
+	btree.entry = itup;
+	ginInsertValue(&btree, stack, buildStats);
+	pfree(itup);
+}
+
+static void
+ginBuildWrite(BufFile *file, void *ptr, size_t size)
+{
+	if (BufFileWrite(file, ptr, size) != size)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not write to GIN build temporary file: %m")));
+}
+
+static void
+ginBuildRead(BufFile *file, void *ptr, size_t size)
+{
+	if (BufFileRead(file, ptr, size) != size)
+		elog(ERROR, "unexpected end of GIN build temporary file");
+}
+
+/*
+ * Write out the contents of the accumulator as a new sorted run, and empty
+ * the accumulator.
+ *
+ * The accumulator returns its entries in key order, so each run is sorted.
+ * Runs are always cut at heap page boundaries, so the TIDs of a later run
+ * all follow those of the earlier ones: IndexBuildHeapScan reports the root
+ * TID of a HOT chain, and those are not in order within a page.
+ */
+static void
+ginBuildSpillRun(GinBuildState *buildstate)
+{
+	TupleDesc	tupdesc = buildstate->ginstate.origTupdesc;
+	BufFile    *file;
+	ItemPointerData *list;
+	Datum		key;
+	GinNullCategory category;
+	uint32		nlist;
+	OffsetNumber attnum;
+	MemoryContext oldCtx;
+
+	/* the runs must survive resetting the temporary context */
+	oldCtx = MemoryContextSwitchTo(buildstate->buildCtx);
+	if (buildstate->nruns >= buildstate->maxruns)
+	{
+		if (buildstate->maxruns == 0)
+		{
+			buildstate->maxruns = 8;
+			buildstate->runs = (BufFile **)
+				palloc(buildstate->maxruns * sizeof(BufFile *));
+		}
+		else
+		{
+			buildstate->maxruns *= 2;
+			buildstate->runs = (BufFile **)
+				repalloc(buildstate->runs,
+						 buildstate->maxruns * sizeof(BufFile *));
+		}
+	}
+	file = BufFileCreateTemp(false);
+	buildstate->runs[buildstate->nruns++] = file;
+	MemoryContextSwitchTo(oldCtx);
+
+	ginBeginBAScan(&buildstate->accum);
+	while ((list = ginGetBAEntry(&buildstate->accum,
+								 &attnum, &key, &category, &nlist)) != NULL)
+	{
+		GinRunEntryHeader hdr;
+		Form_pg_attribute attr = tupdesc->attrs[attnum - 1];
+
+		/* there could be many entries, so be willing to abort here */
+		CHECK_FOR_INTERRUPTS();
+
+		hdr.attnum = attnum;
+		hdr.category = category;
+		hdr.nlist = nlist;
+		if (category != GIN_CAT_NORM_KEY)
+			hdr.keylen = 0;
+		else if (attr->attbyval)
+			hdr.keylen = sizeof(Datum);
+		else
+			hdr.keylen = datumGetSize(key, false, attr->attlen);
+
+		ginBuildWrite(file, &hdr, sizeof(hdr));
+		if (hdr.keylen > 0)
+			ginBuildWrite(file,
+						  attr->attbyval ? (void *) &key : DatumGetPointer(key),
+						  hdr.keylen);
+		ginBuildWrite(file, list, nlist * sizeof(ItemPointerData));
+	}
+
+	MemoryContextReset(buildstate->tmpCtx);
+	ginInitBA(&buildstate->accum);
+}
+
+/*
+ * Advance a merge input to its next entry.  Returns false when it has none
+ * left.  For a run, the TIDs of the previous entry must have been consumed.
+ */
+static bool
+ginBuildSourceNext(GinBuildState *buildstate, GinBuildSource *src)
+{
+	GinRunEntryHeader hdr;
+	size_t		nread;
+
+	if (src->keyAllocated)
+		pfree(DatumGetPointer(src->key));
+	src->keyAllocated = false;
+
+	if (src->file == NULL)
+	{
+		src->list = ginGetBAEntry(&buildstate->accum, &src->attnum,
+								  &src->key, &src->category, &src->nlist);
+		return (src->list != NULL);
+	}
+
+	nread = BufFileRead(src->file, &hdr, sizeof(hdr));
+	if (nread == 0)
+		return false;
+	if (nread != sizeof(hdr))
+		elog(ERROR, "unexpected end of GIN build temporary file");
+
+	src->attnum = hdr.attnum;
+	src->category = hdr.category;
+	src->nlist = hdr.nlist;
+	src->key = (Datum) 0;
+	if (hdr.category != GIN_CAT_NORM_KEY)
+		Assert(hdr.keylen == 0);
+	else if (buildstate->ginstate.origTupdesc->attrs[hdr.attnum - 1]->attbyval)
+		ginBuildRead(src->file, &src->key, sizeof(Datum));
+	else
+	{
+		char	   *keydata = palloc(hdr.keylen);
+
+		ginBuildRead(src->file, keydata, hdr.keylen);
+		src->key = PointerGetDatum(keydata);
+		src->keyAllocated = true;
+	}
+
+	return true;
+}
+
+/*
+ * binaryheap comparator for merge inputs.  The heap keeps the largest
+ * element on top, so this sorts the smallest key first; equal keys come
+ * out in run order, which is TID order.
+ */
+static int
+ginBuildSourceCmp(Datum a, Datum b, void *arg)
+{
+	GinBuildState *buildstate = (GinBuildState *) arg;
+	GinBuildSource *sa = (GinBuildSource *) DatumGetPointer(a);
+	GinBuildSource *sb = (GinBuildSource *) DatumGetPointer(b);
+	int			res;
+
+	res = ginCompareAttEntries(&buildstate->ginstate,
+							   sa->attnum, sa->key, sa->category,
+							   sb->attnum, sb->key, sb->category);
+	if (res != 0)
+		return -res;
+	return sb->runno - sa->runno;
+}
+
+/*
+ * Insert one key, whose TIDs are spread over the given merge inputs, into
+ * the index.  Keys with many TIDs get their posting tree built bottom-up
+ * directly from the inputs, without collecting all the TIDs in memory.
+ */
+static void
+ginBuildInsertGroup(GinBuildState *buildstate, GinBuildSource **group,
+					int ngroup, uint64 total)
+{
+	GinBuildSource *first = group[0];
+	int			i;
+
+	if (total <= GinMaxLeafDataItems)
+	{
+		ItemPointerData *items;
+		uint32		nitems = 0;
+
+		items = (ItemPointerData *) palloc(total * sizeof(ItemPointerData));
+		for (i = 0; i < ngroup; i++)
+		{
+			GinBuildSource *src = group[i];
+
+			if (src->file == NULL)
+				memcpy(items + nitems, src->list,
+					   src->nlist * sizeof(ItemPointerData));
+			else
+				ginBuildRead(src->file, items + nitems,
+							 src->nlist * sizeof(ItemPointerData));
+			nitems += src->nlist;
+		}
+
+		ginEntryInsert(&buildstate->ginstate, first->attnum, first->key,
+					   first->category, items, nitems,
+					   &buildstate->buildStats);
+	}
+	else
+	{
+		GinPostingTreeBuild *ptb;
+		ItemPointerData *chunk = NULL;
+		BlockNumber root;
+
+		ptb = ginBeginPostingTree(buildstate->ginstate.index,
+								  &buildstate->buildStats);
+		for (i = 0; i < ngroup; i++)
+		{
+			GinBuildSource *src = group[i];
+			uint32		left = src->nlist;
+
+			if (src->file == NULL)
+			{
+				ginPostingTreeAdd(ptb, src->list, src->nlist);
+				continue;
+			}
+
+			if (chunk == NULL)
+				chunk = (ItemPointerData *)
+					palloc(GIN_RUN_READ_CHUNK * sizeof(ItemPointerData));
+			while (left > 0)
+			{
+				uint32		n = Min(left, GIN_RUN_READ_CHUNK);
+
+				CHECK_FOR_INTERRUPTS();
+				ginBuildRead(src->file, chunk, n * sizeof(ItemPointerData));
+				ginPostingTreeAdd(ptb, chunk, n);
+				left -= n;
+			}
+		}
+		root = ginEndPostingTree(ptb);
+
+		ginEntryInsertPostingTree(&buildstate->ginstate, first->attnum,
+								  first->key, first->category, root,
+								  &buildstate->buildStats);
+	}
+}
+
+/*
+ * Merge the sorted runs and what is left in the accumulator into the index,
+ * which thus receives every key exactly once, in key order and with all its
+ * TIDs in TID order.
+ */
+static void
+ginBuildMergeRuns(GinBuildState *buildstate)
+{
+	int			nsources = buildstate->nruns + 1;
+	GinBuildSource *sources;
+	GinBuildSource **group;
+	binaryheap *heap;
+	MemoryContext groupCtx;
+	int			i;
+
+	sources = (GinBuildSource *) palloc0(nsources * sizeof(GinBuildSource));
+	group = (GinBuildSource **) palloc(nsources * sizeof(GinBuildSource *));
+	heap = binaryheap_allocate(nsources, ginBuildSourceCmp, buildstate);
+
+	groupCtx = AllocSetContextCreate(CurrentMemoryContext,
+									 "Gin build merge context",
+									 ALLOCSET_DEFAULT_MINSIZE,
+									 ALLOCSET_DEFAULT_INITSIZE,
+									 ALLOCSET_DEFAULT_MAXSIZE);
+
+	ginBeginBAScan(&buildstate->accum);
+	for (i = 0; i < nsources; i++)
+	{
+		GinBuildSource *src = &sources[i];
+
+		src->runno = i;
+		if (i < buildstate->nruns)
+		{
+			src->file = buildstate->runs[i];
+			if (BufFileSeek(src->file, 0, 0L, SEEK_SET) != 0)
+				ereport(ERROR,
+						(errcode_for_file_access(),
+						 errmsg("could not rewind GIN build temporary file: %m")));
+		}
+		if (ginBuildSourceNext(buildstate, src))
+			binaryheap_add_unordered(heap, PointerGetDatum(src));
+	}
+	binaryheap_build(heap);
+
+	while (!binaryheap_empty(heap))
+	{
+		GinBuildSource *first;
+		int			ngroup = 0;
+		uint64		total;
+		MemoryContext oldCtx;
+
+		/* there could be many entries, so be willing to abort here */
+		CHECK_FOR_INTERRUPTS();
+
+		/* collect all the inputs having the smallest key, in run order */
+		first = (GinBuildSource *) DatumGetPointer(binaryheap_remove_first(heap));
+		group[ngroup++] = first;
+		total = first->nlist;
+		while (!binaryheap_empty(heap))
+		{
+			GinBuildSource *src;
+
+			src = (GinBuildSource *) DatumGetPointer(binaryheap_first(heap));
+			if (ginCompareAttEntries(&buildstate->ginstate,
+									 first->attnum, first->key, first->category,
+									 src->attnum, src->key, src->category) != 0)
+				break;
+			(void) binaryheap_remove_first(heap);
+			group[ngroup++] = src;
+			total += src->nlist;
+		}
+
+		oldCtx = MemoryContextSwitchTo(groupCtx);
+		ginBuildInsertGroup(buildstate, group, ngroup, total);
+		MemoryContextSwitchTo(oldCtx);
+		MemoryContextReset(groupCtx);
+
+		for (i = 0; i < ngroup; i++)
+		{
+			if (ginBuildSourceNext(buildstate, group[i]))
+				binaryheap_add(heap, PointerGetDatum(group[i]));
+		}
+	}
+
+	for (i = 0; i < buildstate->nruns; i++)
+		BufFileClose(buildstate->runs[i]);
+
+	MemoryContextDelete(groupCtx);
+	binaryheap_free(heap);
+	pfree(group);
+	pfree(sources);
+}
+
 /*
  * Extract index entries for a single indexable item, and add them to the
  * BuildAccumulator's state.
@@ -346,33 +758,25 @@ ginBuildCallback(Relation index, HeapTuple htup, Datum *values,
 
 	oldCtx = MemoryContextSwitchTo(buildstate->tmpCtx);
 
+	/*
+	 * If we maxed out our available memory on the previous heap page, write
+	 * everything out as a sorted run before starting on this one.
+	 */
+	if (buildstate->spillPending &&
+		ItemPointerGetBlockNumber(&htup->t_self) != buildstate->curblkno)
+	{
+		ginBuildSpillRun(buildstate);
+		buildstate->spillPending = false;
+	}
+	buildstate->curblkno = ItemPointerGetBlockNumber(&htup->t_self);
+
 	for (i = 0; i < buildstate->ginstate.origTupdesc->natts; i++)
 		ginHeapTupleBulkInsert(buildstate, (OffsetNumber) (i + 1),
 							   values[i], isnull[i],
 							   &htup->t_self);
 
-	/* If we've maxed out our available memory, dump everything to the index */
 	if (buildstate->accum.allocatedMemory >= maintenance_work_mem * 1024L)
-	{
-		ItemPointerData *list;
-		Datum		key;
-		GinNullCategory category;
-		uint32		nlist;
-		OffsetNumber attnum;
-
-		ginBeginBAScan(&buildstate->accum);
-		while ((list = ginGetBAEntry(&buildstate->accum,
-								  &attnum, &key, &category, &nlist)) != NULL)
-		{
-			/* there could be many entries, so be willing to abort here */
-			CHECK_FOR_INTERRUPTS();
-			ginEntryInsert(&buildstate->ginstate, attnum, key, category,
-						   list, nlist, &buildstate->buildStats);
-		}
-
-		MemoryContextReset(buildstate->tmpCtx);
-		ginInitBA(&buildstate->accum);
-	}
+		buildstate->spillPending = true;
 
 	MemoryContextSwitchTo(oldCtx);
 }
@@ -461,6 +865,13 @@ ginbuild(PG_FUNCTION_ARGS)
 	buildstate.accum.ginstate = &buildstate.ginstate;
 	ginInitBA(&buildstate.accum);
 
+	buildstate.buildCtx = CurrentMemoryContext;
+	buildstate.runs = NULL;
+	buildstate.nruns = 0;
+	buildstate.maxruns = 0;
+	buildstate.spillPending = false;
+	buildstate.curblkno = InvalidBlockNumber;
+
 	/*
 	 * Do the heap scan.  We disallow sync scan here because dataPlaceToPage
 	 * prefers to receive tuples in TID order.
@@ -468,18 +879,29 @@ ginbuild(PG_FUNCTION_ARGS)
 	reltuples = IndexBuildHeapScan(heap, index, indexInfo, false,
 								   ginBuildCallback, (void *) &buildstate);
 
-	/* dump remaining entries to the index */
-	oldCtx = MemoryContextSwitchTo(buildstate.tmpCtx);
-	ginBeginBAScan(&buildstate.accum);
-	while ((list = ginGetBAEntry(&buildstate.accum,
-								 &attnum, &key, &category, &nlist)) != NULL)
+	/*
+	 * Dump remaining entries to the index.  If memory filled up during the
+	 * scan, merge them with the sorted runs written out meanwhile, so that
+	 * the index is still built in key order and every posting tree in one go.
+	 */
+	if (buildstate.nruns > 0)
+		ginBuildMergeRuns(&buildstate);
+	else
 	{
-		/* there could be many entries, so be willing to abort here */
-		CHECK_FOR_INTERRUPTS();
-		ginEntryInsert(&buildstate.ginstate, attnum, key, category,
-					   list, nlist, &buildstate.buildStats);
+		oldCtx = MemoryContextSwitchTo(buildstate.tmpCtx);
+		ginBeginBAScan(&buildstate.accum);
+		while ((list = ginGetBAEntry(&buildstate.accum,
+									 &attnum, &key, &category, &nlist)) != NULL)
+		{
+			/* there could be many entries, so be willing to abort here */
+			CHECK_FOR_INTERRUPTS();
+			ginEntryInsert(&buildstate.ginstate, attnum, key, category,
+						   list, nlist, &buildstate.buildStats);
+		}
+		MemoryContextSwitchTo(oldCtx);
 	}
-	MemoryContextSwitchTo(oldCtx);
+	if (buildstate.runs)
+		pfree(buildstate.runs);
 
 	MemoryContextDelete(buildstate.tmpCtx);
 
@@ -219,6 +219,7 @@ initscan(HeapScanDesc scan, ScanKey key, bool is_rescan)
 	 * lock that ensures the interesting tuple(s) won't change.)
 	 */
 	scan->rs_nblocks = RelationGetNumberOfBlocks(scan->rs_rd);
+	scan->rs_numblocks = InvalidBlockNumber;
 
 	/*
 	 * If the table is large relative to NBuffers, use a bulk-read access
@@ -277,6 +278,8 @@ initscan(HeapScanDesc scan, ScanKey key, bool is_rescan)
 	ItemPointerSetInvalid(&scan->rs_ctup.t_self);
 	scan->rs_cbuf = InvalidBuffer;
 	scan->rs_cblock = InvalidBlockNumber;
+	scan->rs_prefetch_blk = InvalidBlockNumber;
+	scan->rs_prefetch_target = 0;
 
 	/* we don't have a marked position... */
 	ItemPointerSetInvalid(&(scan->rs_mctid));
@@ -305,6 +308,56 @@ initscan(HeapScanDesc scan, ScanKey key, bool is_rescan)
 		pgstat_count_heap_scan(scan->rs_rd);
 }
 
+/*
+ * heapprefetch - issue read-ahead for the pages a forward scan reads next
+ *
+ * The distance starts at one page and doubles up to target_prefetch_pages,
+ * as for bitmap heap scans, so a scan stopped early by a LIMIT does not
+ * pay for many useless reads.  Only a forward scan moving one page at a
+ * time is prefetched for, and not past the end of the relation or of the
+ * scan; after wrapping around to block 0 it starts over.
+ */
+static void
+heapprefetch(HeapScanDesc scan, BlockNumber page)
+{
+#ifdef USE_PREFETCH
+	BlockNumber limit;
+
+	if (target_prefetch_pages <= 0)
+		return;
+
+	if (scan->rs_prefetch_blk == InvalidBlockNumber ||
+		scan->rs_cblock == InvalidBlockNumber ||
+		page != scan->rs_cblock + 1)
+	{
+		/* (re)starting, or the scan jumped: begin a new read-ahead run */
+		scan->rs_prefetch_blk = page + 1;
+		scan->rs_prefetch_target = 0;
+	}
+	else if (scan->rs_prefetch_blk <= page)
+		scan->rs_prefetch_blk = page + 1;
+
+	if (scan->rs_prefetch_target == 0)
+		scan->rs_prefetch_target = 1;
+	else if (scan->rs_prefetch_target < target_prefetch_pages)
+		scan->rs_prefetch_target = Min(scan->rs_prefetch_target * 2,
+									   target_prefetch_pages);
+
+	/* read no further than the scan itself will */
+	limit = scan->rs_nblocks;
+	if (page < scan->rs_startblock)
+		limit = scan->rs_startblock;
+	if (scan->rs_numblocks != InvalidBlockNumber &&
+		scan->rs_numblocks < limit - page)
+		limit = page + scan->rs_numblocks;
+	if (limit > page + 1 + scan->rs_prefetch_target)
+		limit = page + 1 + scan->rs_prefetch_target;
+
+	while (scan->rs_prefetch_blk < limit)
+		PrefetchBuffer(scan->rs_rd, MAIN_FORKNUM, scan->rs_prefetch_blk++);
+#endif   /* USE_PREFETCH */
+}
+
 /*
  * heapgetpage - subroutine for heapgettup()
  *
@@ -340,6 +393,8 @@ heapgetpage(HeapScanDesc scan, BlockNumber page)
 	 */
 	CHECK_FOR_INTERRUPTS();
 
+	heapprefetch(scan, page);
+
 	/* read page using selected strategy */
 	scan->rs_cbuf = ReadBufferExtended(scan->rs_rd, MAIN_FORKNUM, page,
 									   RBM_NORMAL, scan->rs_strategy);
@@ -645,7 +700,8 @@ heapgettup(HeapScanDesc scan,
 		 */
 		if (backward)
 		{
-			finished = (page == scan->rs_startblock);
+			finished = (page == scan->rs_startblock) ||
+				(scan->rs_numblocks != InvalidBlockNumber ? --scan->rs_numblocks == 0 : false);
 			if (page == 0)
 				page = scan->rs_nblocks;
 			page--;
@@ -655,7 +711,8 @@ heapgettup(HeapScanDesc scan,
 			page++;
 			if (page >= scan->rs_nblocks)
 				page = 0;
-			finished = (page == scan->rs_startblock);
+			finished = (page == scan->rs_startblock) ||
+				(scan->rs_numblocks != InvalidBlockNumber ? --scan->rs_numblocks == 0 : false);
 
 			/*
 			 * Report our new scan position for synchronization purposes. We
@@ -906,7 +963,8 @@ heapgettup_pagemode(HeapScanDesc scan,
 		 */
 		if (backward)
 		{
-			finished = (page == scan->rs_startblock);
+			finished = (page == scan->rs_startblock) ||
+				(scan->rs_numblocks != InvalidBlockNumber ? --scan->rs_numblocks == 0 : false);
 			if (page == 0)
 				page = scan->rs_nblocks;
 			page--;
@@ -916,7 +974,8 @@ heapgettup_pagemode(HeapScanDesc scan,
 			page++;
 			if (page >= scan->rs_nblocks)
 				page = 0;
-			finished = (page == scan->rs_startblock);
+			finished = (page == scan->rs_startblock) ||
+				(scan->rs_numblocks != InvalidBlockNumber ? --scan->rs_numblocks == 0 : false);
 
 			/*
 			 * Report our new scan position for synchronization purposes. We
@@ -1388,6 +1447,28 @@ heap_beginscan_internal(Relation relation, Snapshot snapshot,
 	return scan;
 }
 
+/*
+ * heap_setscanlimits - restrict range of a heapscan
+ *
+ * startBlk is the page to start at
+ * numBlks is number of pages to scan (InvalidBlockNumber means "all")
+ *
+ * Several scans of one relation can so share its blocks between them.  The
+ * scan must not be synchronized, and the limits are forgotten by a rescan.
+ */
+void
+heap_setscanlimits(HeapScanDesc scan, BlockNumber startBlk, BlockNumber numBlks)
+{
+	Assert(!scan->rs_inited);	/* else too late to change */
+	Assert(!scan->rs_syncscan); /* else rs_startblock is significant */
+
+	/* Check startBlk is valid (but allow case of zero blocks...) */
+	Assert(startBlk == 0 || startBlk < scan->rs_nblocks);
+
+	scan->rs_startblock = startBlk;
+	scan->rs_numblocks = numBlks;
+}
+
 /* ----------------
  *		heap_rescan		- restart a relation scan
  * ----------------
@@ -1988,6 +2069,7 @@ GetBulkInsertState(void)
 	bistate = (BulkInsertState) palloc(sizeof(BulkInsertStateData));
 	bistate->strategy = GetAccessStrategy(BAS_BULKWRITE);
 	bistate->current_buf = InvalidBuffer;
+	bistate->unlogged_block = InvalidBlockNumber;
 	return bistate;
 }
 
@@ -2003,6 +2085,122 @@ FreeBulkInsertState(BulkInsertState bistate)
 	pfree(bistate);
 }
 
+/*
+ * The page last left unlogged by a HEAP_INSERT_LOG_PAGES bulk insert of this
+ * backend.  heap_log_bulk_insert normally logs it, but if the subtransaction
+ * of the insert aborts, the relfilenode can outlive it and later WAL records
+ * of the page would rely on contents no record has, so AtSubAbort_BulkInsert
+ * logs it then.
+ */
+static RelFileNode pendingBulkNode;
+static BlockNumber pendingBulkBlock = InvalidBlockNumber;
+
+/*
+ * log_pending_bulk_page - WAL-log the page remembered in pendingBulkBlock
+ */
+static void
+log_pending_bulk_page(void)
+{
+	BlockNumber blkno = pendingBulkBlock;
+	Buffer		buffer;
+
+	/* forget it first, an error must not make us try again */
+	pendingBulkBlock = InvalidBlockNumber;
+
+	buffer = ReadBufferWithoutRelcache(pendingBulkNode, MAIN_FORKNUM,
+									   blkno, RBM_NORMAL, NULL);
+	LockBuffer(buffer, BUFFER_LOCK_EXCLUSIVE);
+
+	START_CRIT_SECTION();
+	MarkBufferDirty(buffer);
+	log_newpage_buffer(buffer);
+	END_CRIT_SECTION();
+
+	UnlockReleaseBuffer(buffer);
+}
+
+/*
+ * remember_bulk_insert_page - note the page a bulk insert left unlogged
+ *
+ * Only one page is remembered, one of another bulk insert is logged now.
+ */
+static void
+remember_bulk_insert_page(Relation relation, BlockNumber blkno)
+{
+	if (BlockNumberIsValid(pendingBulkBlock) &&
+		(pendingBulkBlock != blkno ||
+		 !RelFileNodeEquals(pendingBulkNode, relation->rd_node)))
+		log_pending_bulk_page();
+
+	pendingBulkNode = relation->rd_node;
+	pendingBulkBlock = blkno;
+}
+
+/*
+ * log_bulk_insert_page - WAL-log the page left unlogged by HEAP_INSERT_LOG_PAGES
+ */
+static void
+log_bulk_insert_page(Relation relation, BulkInsertState bistate)
+{
+	Buffer		buffer;
+
+	buffer = ReadBufferExtended(relation, MAIN_FORKNUM,
+								bistate->unlogged_block, RBM_NORMAL,
+								bistate->strategy);
+	LockBuffer(buffer, BUFFER_LOCK_EXCLUSIVE);
+
+	START_CRIT_SECTION();
+	MarkBufferDirty(buffer);
+	log_newpage_buffer(buffer);
+	END_CRIT_SECTION();
+
+	UnlockReleaseBuffer(buffer);
+
+	if (pendingBulkBlock == bistate->unlogged_block &&
+		RelFileNodeEquals(pendingBulkNode, relation->rd_node))
+		pendingBulkBlock = InvalidBlockNumber;
+	bistate->unlogged_block = InvalidBlockNumber;
+}
+
+/*
+ * heap_log_bulk_insert - finish a bulk insert done with HEAP_INSERT_LOG_PAGES
+ *
+ * The last page filled is WAL-logged here, since later inserts of the same
+ * bulk insert could still have added to it.  This must be called before
+ * the transaction commits.
+ */
+void
+heap_log_bulk_insert(Relation relation, BulkInsertState bistate)
+{
+	if (BlockNumberIsValid(bistate->unlogged_block))
+		log_bulk_insert_page(relation, bistate);
+}
+
+/*
+ * AtSubAbort_BulkInsert - WAL-log the page an aborted bulk insert left unlogged
+ *
+ * Called at subtransaction abort.  The relfilenode the bulk insert went to
+ * may have been created by the parent transaction, so it stays.
+ */
+void
+AtSubAbort_BulkInsert(void)
+{
+	if (BlockNumberIsValid(pendingBulkBlock))
+		log_pending_bulk_page();
+}
+
+/*
+ * AtEOXact_BulkInsert - forget the page left unlogged at top-level end
+ *
+ * On abort the relfilenode, created in this transaction, is dropped anyway;
+ * on commit heap_log_bulk_insert has logged the page already.
+ */
+void
+AtEOXact_BulkInsert(void)
+{
+	pendingBulkBlock = InvalidBlockNumber;
+}
+
 
 /*
  *	heap_insert		- insert tuple into a heap
@@ -2028,6 +2226,8 @@ FreeBulkInsertState(BulkInsertState bistate)
  * Note that these options will be applied when inserting into the heap's
  * TOAST table, too, if the tuple requires any out-of-line data.
  *
+ * HEAP_INSERT_LOG_PAGES is only understood by heap_multi_insert, see there.
+ *
  * The BulkInsertState object (if any; bistate can be NULL for default
  * behavior) is also just passed through to RelationGetBufferForTuple.
  *
@@ -2092,7 +2292,7 @@ heap_insert(Relation relation, HeapTuple tup, CommandId cid,
 		PageClearAllVisible(BufferGetPage(buffer));
 		visibilitymap_clear(relation,
 							ItemPointerGetBlockNumber(&(heaptup->t_self)),
-							vmbuffer);
+							vmbuffer, VISIBILITYMAP_VALID_BITS);
 	}
 
 	/*
@@ -2271,6 +2471,16 @@ heap_prepare_insert(Relation relation, HeapTuple tup, TransactionId xid,
  * tuples can be inserted on a single page, we can write just a single WAL
  * record covering all of them, and only need to lock/unlock the page once.
  *
+ * If the HEAP_INSERT_LOG_PAGES option is specified, each page is WAL-logged
+ * as a whole once it is full, instead of a record per page for each call.
+ * That saves building and inserting a WAL record for every batch of tuples,
+ * while the load stays crash-safe and reaches the standbys.  Like
+ * HEAP_INSERT_SKIP_WAL, this is only safe if no one else inserts into the
+ * relation meanwhile, so that our pages hold no tuples logged otherwise,
+ * which is the case for a relfilenode created in the current transaction.
+ * A bistate is needed to remember the page not logged yet, and the caller
+ * must call heap_log_bulk_insert when done.
+ *
  * Note: this leaks memory into the current memory context. You can create a
  * temporary context before calling this, if that's a problem.
  */
@@ -2285,9 +2495,13 @@ heap_multi_insert(Relation relation, HeapTuple *tuples, int ntuples,
 	char	   *scratch = NULL;
 	Page		page;
 	bool		needwal;
+	bool		logpages;
 	Size		saveFreeSpace;
 
 	needwal = !(options & HEAP_INSERT_SKIP_WAL) && RelationNeedsWAL(relation);
+	logpages = needwal && (options & HEAP_INSERT_LOG_PAGES) && bistate != NULL;
+	if (logpages)
+		needwal = false;
 	saveFreeSpace = RelationGetTargetPageFreeSpace(relation,
 												   HEAP_DEFAULT_FILLFACTOR);
 
@@ -2336,6 +2550,8 @@ heap_multi_insert(Relation relation, HeapTuple *tuples, int ntuples,
 		Buffer		buffer;
 		Buffer		vmbuffer = InvalidBuffer;
 		bool		all_visible_cleared = false;
+		bool		page_logged = false;
+		BlockNumber blkno;
 		int			nthispage;
 
 		/*
@@ -2346,6 +2562,7 @@ heap_multi_insert(Relation relation, HeapTuple *tuples, int ntuples,
 										   InvalidBuffer, options, bistate,
 										   &vmbuffer, NULL);
 		page = BufferGetPage(buffer);
+		blkno = BufferGetBlockNumber(buffer);
 
 		/* NO EREPORT(ERROR) from here till changes are logged */
 		START_CRIT_SECTION();
@@ -2371,7 +2588,7 @@ heap_multi_insert(Relation relation, HeapTuple *tuples, int ntuples,
 			PageClearAllVisible(page);
 			visibilitymap_clear(relation,
 								BufferGetBlockNumber(buffer),
-								vmbuffer);
+								vmbuffer, VISIBILITYMAP_VALID_BITS);
 		}
 
 		/*
@@ -2380,6 +2597,22 @@ heap_multi_insert(Relation relation, HeapTuple *tuples, int ntuples,
 
 		MarkBufferDirty(buffer);
 
+		/*
+		 * A page of a new relfilenode cannot have been marked all-visible,
+		 * and clearing the bit would not be logged by the page image.
+		 */
+		Assert(!(logpages && all_visible_cleared));
+
+		/*
+		 * Log the page if no more tuples fit on it, the next ones moving on
+		 * to another page.  Otherwise the next call could add to it.
+		 */
+		if (logpages && ndone + nthispage < ntuples)
+		{
+			log_newpage_buffer(buffer);
+			page_logged = true;
+		}
+
 		/* XLOG stuff */
 		if (needwal)
 		{
@@ -2483,6 +2716,23 @@ heap_multi_insert(Relation relation, HeapTuple *tuples, int ntuples,
 		if (vmbuffer != InvalidBuffer)
 			ReleaseBuffer(vmbuffer);
 
+		/*
+		 * Only the last page we filled may be left unlogged, so log the
+		 * previous one when we moved on to another.
+		 */
+		if (logpages)
+		{
+			if (BlockNumberIsValid(bistate->unlogged_block) &&
+				bistate->unlogged_block != blkno)
+				log_bulk_insert_page(relation, bistate);
+			bistate->unlogged_block = page_logged ? InvalidBlockNumber : blkno;
+			if (!page_logged)
+				remember_bulk_insert_page(relation, blkno);
+			else if (pendingBulkBlock == blkno &&
+					 RelFileNodeEquals(pendingBulkNode, relation->rd_node))
+				pendingBulkBlock = InvalidBlockNumber;
+		}
+
 		ndone += nthispage;
 	}
 
@@ -2830,7 +3080,7 @@ l1:
 		all_visible_cleared = true;
 		PageClearAllVisible(page);
 		visibilitymap_clear(relation, BufferGetBlockNumber(buffer),
-							vmbuffer);
+							vmbuffer, VISIBILITYMAP_VALID_BITS);
 	}
 
 	/* store transaction information of xact deleting the tuple */
@@ -3648,14 +3898,14 @@ l2:
 		all_visible_cleared = true;
 		PageClearAllVisible(BufferGetPage(buffer));
 		visibilitymap_clear(relation, BufferGetBlockNumber(buffer),
-							vmbuffer);
+							vmbuffer, VISIBILITYMAP_VALID_BITS);
 	}
 	if (newbuf != buffer && PageIsAllVisible(BufferGetPage(newbuf)))
 	{
 		all_visible_cleared_new = true;
 		PageClearAllVisible(BufferGetPage(newbuf));
 		visibilitymap_clear(relation, BufferGetBlockNumber(newbuf),
-							vmbuffer_new);
+							vmbuffer_new, VISIBILITYMAP_VALID_BITS);
 	}
 
 	if (newbuf != buffer)
@@ -3708,7 +3958,9 @@ l2:
 	if (have_tuple_lock)
 		UnlockTupleTuplock(relation, &(oldtup.t_self), *lockmode);
 
-	pgstat_count_heap_update(relation, use_hot_update);
+	pgstat_count_heap_update(relation, use_hot_update, newbuf != buffer);
+	if (satisfies_hot)
+		RelationRecordHotUpdate(relation, use_hot_update);
 
 	/*
 	 * If heaptup is a private copy, release it.  Don't forget to copy t_self
@@ -4015,8 +4267,20 @@ heap_lock_tuple(Relation relation, HeapTuple tuple,
 				new_infomask,
 				new_infomask2;
 	bool		have_tuple_lock = false;
+	BlockNumber block = ItemPointerGetBlockNumber(tid);
+	Buffer		vmbuffer = InvalidBuffer;
+	bool		cleared_all_frozen = false;
+
+	*buffer = ReadBuffer(relation, block);
+
+	/*
+	 * Locking the tuple clears the page's all-frozen bit in the visibility
+	 * map, so pin that page now if it looks like we'll need it; we don't
+	 * want to do the I/O that might take while holding the buffer lock.
+	 */
+	if (PageIsAllVisible(BufferGetPage(*buffer)))
+		visibilitymap_pin(relation, block, &vmbuffer);
 
-	*buffer = ReadBuffer(relation, ItemPointerGetBlockNumber(tid));
 	LockBuffer(*buffer, BUFFER_LOCK_EXCLUSIVE);
 
 	page = BufferGetPage(*buffer);
@@ -4088,6 +4352,8 @@ l3:
 							UnlockTupleTuplock(relation, tid, mode);
 
 						pfree(members);
+						if (vmbuffer != InvalidBuffer)
+							ReleaseBuffer(vmbuffer);
 						return HeapTupleMayBeUpdated;
 					}
 				}
@@ -4406,9 +4672,24 @@ failed:
 		LockBuffer(*buffer, BUFFER_LOCK_UNLOCK);
 		if (have_tuple_lock)
 			UnlockTupleTuplock(relation, tid, mode);
+		if (vmbuffer != InvalidBuffer)
+			ReleaseBuffer(vmbuffer);
 		return result;
 	}
 
+	/*
+	 * If the page became all-visible while we didn't hold the lock, we have
+	 * to unlock it to pin the visibility map page.  Then start over, as the
+	 * tuple might have changed meanwhile.
+	 */
+	if (vmbuffer == InvalidBuffer && PageIsAllVisible(page))
+	{
+		LockBuffer(*buffer, BUFFER_LOCK_UNLOCK);
+		visibilitymap_pin(relation, block, &vmbuffer);
+		LockBuffer(*buffer, BUFFER_LOCK_EXCLUSIVE);
+		goto l3;
+	}
+
 	xmax = HeapTupleHeaderGetRawXmax(tuple->t_data);
 	old_infomask = tuple->t_data->t_infomask;
 
@@ -4440,6 +4721,8 @@ failed:
 		/* Probably can't hold tuple lock here, but may as well check */
 		if (have_tuple_lock)
 			UnlockTupleTuplock(relation, tid, mode);
+		if (vmbuffer != InvalidBuffer)
+			ReleaseBuffer(vmbuffer);
 		return HeapTupleMayBeUpdated;
 	}
 
@@ -4492,6 +4775,12 @@ failed:
 	if (HEAP_XMAX_IS_LOCKED_ONLY(new_infomask))
 		tuple->t_data->t_ctid = *tid;
 
+	/* the tuple has a live xmax now, so the page is not all-frozen */
+	if (PageIsAllVisible(page) &&
+		visibilitymap_clear(relation, block, vmbuffer,
+							VISIBILITYMAP_ALL_FROZEN))
+		cleared_all_frozen = true;
+
 	MarkBufferDirty(*buffer);
 
 	/*
@@ -4517,6 +4806,7 @@ failed:
 		xlrec.locking_xid = xid;
 		xlrec.infobits_set = compute_infobits(new_infomask,
 											  tuple->t_data->t_infomask2);
+		xlrec.flags = cleared_all_frozen ? XLH_LOCK_ALL_FROZEN_CLEARED : 0;
 		rdata[0].data = (char *) &xlrec;
 		rdata[0].len = SizeOfHeapLock;
 		rdata[0].buffer = InvalidBuffer;
@@ -4538,9 +4828,11 @@ failed:
 	LockBuffer(*buffer, BUFFER_LOCK_UNLOCK);
 
 	/*
-	 * Don't update the visibility map here. Locking a tuple doesn't change
-	 * visibility info.
+	 * Apart from the all-frozen bit, don't update the visibility map here.
+	 * Locking a tuple doesn't change visibility info.
 	 */
+	if (vmbuffer != InvalidBuffer)
+		ReleaseBuffer(vmbuffer);
 
 	/*
 	 * Now that we have successfully marked the tuple as locked, we can
@@ -4972,9 +5264,13 @@ heap_lock_updated_tuple_rec(Relation rel, ItemPointer tid, TransactionId xid,
 				new_infomask2,
 				old_infomask,
 				old_infomask2;
+	bool		cleared_all_frozen;
 	TransactionId xmax,
 				new_xmax;
 	TransactionId priorXmax = InvalidTransactionId;
+	Buffer		vmbuffer = InvalidBuffer;
+	BlockNumber block;
+	HTSU_Result result;
 
 	ItemPointerCopy(tid, &tupid);
 
@@ -4993,13 +5289,35 @@ heap_lock_updated_tuple_rec(Relation rel, ItemPointer tid, TransactionId xid,
 			 * chain, and there's no further tuple to lock: return success to
 			 * caller.
 			 */
-			return HeapTupleMayBeUpdated;
+			result = HeapTupleMayBeUpdated;
+			goto out_unlocked;
 		}
 
+		/*
+		 * Locking the tuple clears the page's all-frozen bit in the
+		 * visibility map, so pin that before taking the buffer lock; we
+		 * don't want to do the I/O that might take while holding the lock.
+		 */
+		block = ItemPointerGetBlockNumber(&tupid);
+		if (PageIsAllVisible(BufferGetPage(buf)))
+			visibilitymap_pin(rel, block, &vmbuffer);
+
 l4:
 		CHECK_FOR_INTERRUPTS();
 		LockBuffer(buf, BUFFER_LOCK_EXCLUSIVE);
 
+		/*
+		 * If the page became all-visible while we weren't looking, we have
+		 * to unlock it to pin the visibility map page, and start over.
+		 */
+		if (PageIsAllVisible(BufferGetPage(buf)) &&
+			!visibilitymap_pin_ok(block, vmbuffer))
+		{
+			LockBuffer(buf, BUFFER_LOCK_UNLOCK);
+			visibilitymap_pin(rel, block, &vmbuffer);
+			goto l4;
+		}
+
 		/*
 		 * Check the tuple XMIN against prior XMAX, if any.  If we reached
 		 * the end of the chain, we're done, so return success.
@@ -5008,8 +5326,8 @@ l4:
 			!TransactionIdEquals(HeapTupleHeaderGetXmin(mytup.t_data),
 								 priorXmax))
 		{
-			UnlockReleaseBuffer(buf);
-			return HeapTupleMayBeUpdated;
+			result = HeapTupleMayBeUpdated;
+			goto out_locked;
 		}
 
 		old_infomask = mytup.t_data->t_infomask;
@@ -5052,9 +5370,9 @@ l4:
 					}
 					if (res != HeapTupleMayBeUpdated)
 					{
-						UnlockReleaseBuffer(buf);
 						pfree(members);
-						return res;
+						result = res;
+						goto out_locked;
 					}
 				}
 				if (members)
@@ -5111,8 +5429,8 @@ l4:
 				}
 				if (res != HeapTupleMayBeUpdated)
 				{
-					UnlockReleaseBuffer(buf);
-					return res;
+					result = res;
+					goto out_locked;
 				}
 			}
 		}
@@ -5133,6 +5451,13 @@ l4:
 
 		MarkBufferDirty(buf);
 
+		/* the tuple has a live xmax now, so the page is not all-frozen */
+		cleared_all_frozen = false;
+		if (PageIsAllVisible(BufferGetPage(buf)) &&
+			visibilitymap_clear(rel, block, vmbuffer,
+								VISIBILITYMAP_ALL_FROZEN))
+			cleared_all_frozen = true;
+
 		/* XLOG stuff */
 		if (RelationNeedsWAL(rel))
 		{
@@ -5145,6 +5470,8 @@ l4:
 			xlrec.target.tid = mytup.t_self;
 			xlrec.xmax = new_xmax;
 			xlrec.infobits_set = compute_infobits(new_infomask, new_infomask2);
+			xlrec.flags =
+				cleared_all_frozen ? XLH_LOCK_ALL_FROZEN_CLEARED : 0;
 
 			rdata[0].data = (char *) &xlrec;
 			rdata[0].len = SizeOfHeapLockUpdated;
@@ -5169,8 +5496,8 @@ l4:
 			ItemPointerEquals(&mytup.t_self, &mytup.t_data->t_ctid) ||
 			HeapTupleHeaderIsOnlyLocked(mytup.t_data))
 		{
-			UnlockReleaseBuffer(buf);
-			return HeapTupleMayBeUpdated;
+			result = HeapTupleMayBeUpdated;
+			goto out_locked;
 		}
 
 		/* tail recursion */
@@ -5178,6 +5505,15 @@ l4:
 		ItemPointerCopy(&(mytup.t_data->t_ctid), &tupid);
 		UnlockReleaseBuffer(buf);
 	}
+
+out_locked:
+	UnlockReleaseBuffer(buf);
+
+out_unlocked:
+	if (vmbuffer != InvalidBuffer)
+		ReleaseBuffer(vmbuffer);
+
+	return result;
 }
 
 /*
@@ -5606,6 +5942,10 @@ FreezeMultiXactId(MultiXactId multi, uint16 t_infomask,
  *
  * Caller is responsible for setting the offset field, if appropriate.
  *
+ * *totally_frozen_p is set to true if the tuple will be totally frozen after
+ * these operations are performed, that is, if none of its XID fields will
+ * ever need freezing again.
+ *
  * It is assumed that the caller has checked the tuple with
  * HeapTupleSatisfiesVacuum() and determined that it is not HEAPTUPLE_DEAD
  * (else we should be removing the tuple, not freezing it).
@@ -5627,11 +5967,14 @@ FreezeMultiXactId(MultiXactId multi, uint16 t_infomask,
 bool
 heap_prepare_freeze_tuple(HeapTupleHeader tuple, TransactionId cutoff_xid,
 						  TransactionId cutoff_multi,
-						  xl_heap_freeze_tuple *frz)
+						  xl_heap_freeze_tuple *frz, bool *totally_frozen_p)
 
 {
 	bool		changed = false;
 	bool		freeze_xmax = false;
+	bool		xmin_frozen = false;
+	bool		xmax_already_frozen = false;
+	bool		xvac_frozen = true;
 	TransactionId xid;
 
 	frz->frzflags = 0;
@@ -5641,10 +5984,12 @@ heap_prepare_freeze_tuple(HeapTupleHeader tuple, TransactionId cutoff_xid,
 
 	/* Process xmin */
 	xid = HeapTupleHeaderGetXmin(tuple);
-	if (TransactionIdIsNormal(xid) &&
-		TransactionIdPrecedes(xid, cutoff_xid))
+	if (!TransactionIdIsNormal(xid))
+		xmin_frozen = true;
+	else if (TransactionIdPrecedes(xid, cutoff_xid))
 	{
 		frz->frzflags |= XLH_FREEZE_XMIN;
+		xmin_frozen = true;
 
 		/*
 		 * Might as well fix the hint bits too; usually XMIN_COMMITTED will
@@ -5721,6 +6066,8 @@ heap_prepare_freeze_tuple(HeapTupleHeader tuple, TransactionId cutoff_xid,
 	{
 		freeze_xmax = true;
 	}
+	else if (!TransactionIdIsValid(xid))
+		xmax_already_frozen = true;
 
 	if (freeze_xmax)
 	{
@@ -5766,8 +6113,13 @@ heap_prepare_freeze_tuple(HeapTupleHeader tuple, TransactionId cutoff_xid,
 			frz->t_infomask |= HEAP_XMIN_COMMITTED;
 			changed = true;
 		}
+		else if (TransactionIdIsNormal(xid))
+			xvac_frozen = false;
 	}
 
+	*totally_frozen_p = (xmin_frozen &&
+						 (freeze_xmax || xmax_already_frozen) &&
+						 xvac_frozen);
 	return changed;
 }
 
@@ -5821,9 +6173,10 @@ heap_freeze_tuple(HeapTupleHeader tuple, TransactionId cutoff_xid,
 {
 	xl_heap_freeze_tuple frz;
 	bool		do_freeze;
+	bool		tuple_totally_frozen;
 
 	do_freeze = heap_prepare_freeze_tuple(tuple, cutoff_xid, cutoff_multi,
-										  &frz);
+										  &frz, &tuple_totally_frozen);
 
 	/*
 	 * Note that because this is not a WAL-logged operation, we don't need to
@@ -6163,6 +6516,55 @@ ConditionalMultiXactIdWait(MultiXactId multi, MultiXactStatus status,
 	return Do_MultiXactIdWait(multi, status, remaining, infomask, true);
 }
 
+/*
+ * heap_tuple_needs_eventual_freeze
+ *
+ * Check to see whether any of the XID fields of a tuple (xmin, xmax, xvac)
+ * will eventually require freezing.  Similar to heap_tuple_needs_freeze,
+ * but there's no cutoff, since we're trying to figure out whether freezing
+ * will ever be needed, not whether it's needed now.
+ */
+bool
+heap_tuple_needs_eventual_freeze(HeapTupleHeader tuple)
+{
+	TransactionId xid;
+
+	/*
+	 * If xmin is a normal transaction ID, this tuple is definitely not
+	 * frozen.
+	 */
+	xid = HeapTupleHeaderGetXmin(tuple);
+	if (TransactionIdIsNormal(xid))
+		return true;
+
+	/*
+	 * If xmax is a valid xact or multixact, this tuple is also not frozen.
+	 */
+	if (tuple->t_infomask & HEAP_XMAX_IS_MULTI)
+	{
+		MultiXactId multi;
+
+		multi = HeapTupleHeaderGetRawXmax(tuple);
+		if (MultiXactIdIsValid(multi))
+			return true;
+	}
+	else
+	{
+		xid = HeapTupleHeaderGetRawXmax(tuple);
+		if (TransactionIdIsNormal(xid))
+			return true;
+	}
+
+	if (tuple->t_infomask & HEAP_MOVED)
+	{
+		xid = HeapTupleHeaderGetXvac(tuple);
+		if (TransactionIdIsNormal(xid))
+			return true;
+	}
+
+	return false;
+}
+
 /*
  * heap_tuple_needs_freeze
  *
@@ -6528,7 +6930,7 @@ log_heap_freeze(Relation reln, Buffer buffer, TransactionId cutoff_xid,
  */
 XLogRecPtr
 log_heap_visible(RelFileNode rnode, Buffer heap_buffer, Buffer vm_buffer,
-				 TransactionId cutoff_xid)
+				 TransactionId cutoff_xid, uint8 vmflags)
 {
 	xl_heap_visible xlrec;
 	XLogRecPtr	recptr;
@@ -6540,6 +6942,7 @@ log_heap_visible(RelFileNode rnode, Buffer heap_buffer, Buffer vm_buffer,
 	xlrec.node = rnode;
 	xlrec.block = BufferGetBlockNumber(heap_buffer);
 	xlrec.cutoff_xid = cutoff_xid;
+	xlrec.flags = vmflags;
 
 	rdata[0].data = (char *) &xlrec;
 	rdata[0].len = SizeOfHeapVisible;
@@ -7112,7 +7515,7 @@ heap_xlog_visible(XLogRecPtr lsn, XLogRecord *record)
 		 */
 		if (lsn > PageGetLSN(BufferGetPage(vmbuffer)))
 			visibilitymap_set(reln, xlrec->block, InvalidBuffer, lsn, vmbuffer,
-							  xlrec->cutoff_xid);
+							  xlrec->cutoff_xid, xlrec->flags);
 
 		ReleaseBuffer(vmbuffer);
 		FreeFakeRelcacheEntry(reln);
@@ -7271,7 +7674,7 @@ heap_xlog_delete(XLogRecPtr lsn, XLogRecord *record)
 		Buffer		vmbuffer = InvalidBuffer;
 
 		visibilitymap_pin(reln, blkno, &vmbuffer);
-		visibilitymap_clear(reln, blkno, vmbuffer);
+		visibilitymap_clear(reln, blkno, vmbuffer, VISIBILITYMAP_VALID_BITS);
 		ReleaseBuffer(vmbuffer);
 		FreeFakeRelcacheEntry(reln);
 	}
@@ -7354,7 +7757,7 @@ heap_xlog_insert(XLogRecPtr lsn, XLogRecord *record)
 		Buffer		vmbuffer = InvalidBuffer;
 
 		visibilitymap_pin(reln, blkno, &vmbuffer);
-		visibilitymap_clear(reln, blkno, vmbuffer);
+		visibilitymap_clear(reln, blkno, vmbuffer, VISIBILITYMAP_VALID_BITS);
 		ReleaseBuffer(vmbuffer);
 		FreeFakeRelcacheEntry(reln);
 	}
@@ -7488,7 +7891,7 @@ heap_xlog_multi_insert(XLogRecPtr lsn, XLogRecord *record)
 		Buffer		vmbuffer = InvalidBuffer;
 
 		visibilitymap_pin(reln, blkno, &vmbuffer);
-		visibilitymap_clear(reln, blkno, vmbuffer);
+		visibilitymap_clear(reln, blkno, vmbuffer, VISIBILITYMAP_VALID_BITS);
 		ReleaseBuffer(vmbuffer);
 		FreeFakeRelcacheEntry(reln);
 	}
@@ -7620,7 +8023,7 @@ heap_xlog_update(XLogRecPtr lsn, XLogRecord *record, bool hot_update)
 		Buffer		vmbuffer = InvalidBuffer;
 
 		visibilitymap_pin(reln, block, &vmbuffer);
-		visibilitymap_clear(reln, block, vmbuffer);
+		visibilitymap_clear(reln, block, vmbuffer, VISIBILITYMAP_VALID_BITS);
 		ReleaseBuffer(vmbuffer);
 		FreeFakeRelcacheEntry(reln);
 	}
@@ -7722,7 +8125,7 @@ newt:;
 		Buffer		vmbuffer = InvalidBuffer;
 
 		visibilitymap_pin(reln, block, &vmbuffer);
-		visibilitymap_clear(reln, block, vmbuffer);
+		visibilitymap_clear(reln, block, vmbuffer, VISIBILITYMAP_VALID_BITS);
 		ReleaseBuffer(vmbuffer);
 		FreeFakeRelcacheEntry(reln);
 	}
@@ -7844,6 +8247,22 @@ heap_xlog_lock(XLogRecPtr lsn, XLogRecord *record)
 	ItemId		lp = NULL;
 	HeapTupleHeader htup;
 
+	/*
+	 * The visibility map may need to be fixed even if the heap page is
+	 * already up-to-date.
+	 */
+	if (xlrec->flags & XLH_LOCK_ALL_FROZEN_CLEARED)
+	{
+		Relation	reln = CreateFakeRelcacheEntry(xlrec->target.node);
+		BlockNumber block = ItemPointerGetBlockNumber(&(xlrec->target.tid));
+		Buffer		vmbuffer = InvalidBuffer;
+
+		visibilitymap_pin(reln, block, &vmbuffer);
+		visibilitymap_clear(reln, block, vmbuffer, VISIBILITYMAP_ALL_FROZEN);
+		ReleaseBuffer(vmbuffer);
+		FreeFakeRelcacheEntry(reln);
+	}
+
 	/* If we have a full-page image, restore it and we're done */
 	if (record->xl_info & XLR_BKP_BLOCK(0))
 	{
@@ -7904,6 +8323,22 @@ heap_xlog_lock_updated(XLogRecPtr lsn, XLogRecord *record)
 	ItemId		lp = NULL;
 	HeapTupleHeader htup;
 
+	/*
+	 * The visibility map may need to be fixed even if the heap page is
+	 * already up-to-date.
+	 */
+	if (xlrec->flags & XLH_LOCK_ALL_FROZEN_CLEARED)
+	{
+		Relation	reln = CreateFakeRelcacheEntry(xlrec->target.node);
+		BlockNumber block = ItemPointerGetBlockNumber(&(xlrec->target.tid));
+		Buffer		vmbuffer = InvalidBuffer;
+
+		visibilitymap_pin(reln, block, &vmbuffer);
+		visibilitymap_clear(reln, block, vmbuffer, VISIBILITYMAP_ALL_FROZEN);
+		ReleaseBuffer(vmbuffer);
+		FreeFakeRelcacheEntry(reln);
+	}
+
 	/* If we have a full-page image, restore it and we're done */
 	if (record->xl_info & XLR_BKP_BLOCK(0))
 	{
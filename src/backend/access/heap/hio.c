@@ -25,6 +25,21 @@
 #include "storage/smgr.h"
 
 
+/*
+ * The autotune_fillfactor reservation is reconsidered every HOT_TUNE_WINDOW
+ * HOT-eligible updates.  If more than 1 in HOT_TUNE_GROW_RATIO of them had
+ * to move to another page, another HOT_TUNE_STEP bytes are kept free on each
+ * page; if fewer than 1 in HOT_TUNE_SHRINK_RATIO did, one step is given back.
+ * The reservation never exceeds HOT_TUNE_MAX_RESERVE, which corresponds to a
+ * fillfactor of 70.
+ */
+#define HOT_TUNE_WINDOW			100
+#define HOT_TUNE_GROW_RATIO		10
+#define HOT_TUNE_SHRINK_RATIO	50
+#define HOT_TUNE_STEP			(BLCKSZ / 50)
+#define HOT_TUNE_MAX_RESERVE	(BLCKSZ * 3 / 10)
+
+
 /*
  * RelationPutHeapTuple - place tuple at specified page
  *
@@ -155,6 +170,111 @@ GetVisibilityMapPins(Relation relation, Buffer buffer1, Buffer buffer2,
 	}
 }
 
+/*
+ * Extend a relation by multiple blocks to avoid future contention on the
+ * relation extension lock.  Our goal is to pre-extend the relation by an
+ * amount which ramps up as the degree of contention ramps up, but limiting
+ * the result to some sane overall value.
+ */
+static void
+RelationAddExtraBlocks(Relation relation, BulkInsertState bistate)
+{
+	Page		page;
+	BlockNumber blockNum = InvalidBlockNumber,
+				firstBlock = InvalidBlockNumber;
+	int			extraBlocks;
+	int			lockWaiters;
+	Size		freespace = 0;
+	Buffer		buffer;
+
+	/* Use the length of the lock wait queue to judge how much to extend. */
+	lockWaiters = RelationExtensionLockWaiterCount(relation);
+	if (lockWaiters <= 0)
+		return;
+
+	/*
+	 * It might seem like multiplying the number of lock waiters by as much as
+	 * 20 is too aggressive, but smaller numbers proved insufficient for
+	 * several COPY streams loading into one table.  512 is just an arbitrary
+	 * cap to prevent pathological results.
+	 */
+	extraBlocks = Min(512, lockWaiters * 20);
+
+	while (extraBlocks-- >= 0)
+	{
+		/* Ouch - an unnecessary lseek() each time through the loop! */
+		buffer = ReadBufferBI(relation, P_NEW, bistate);
+
+		/* Extend by one page. */
+		LockBuffer(buffer, BUFFER_LOCK_EXCLUSIVE);
+		page = BufferGetPage(buffer);
+		PageInit(page, BufferGetPageSize(buffer), 0);
+		MarkBufferDirty(buffer);
+		blockNum = BufferGetBlockNumber(buffer);
+		freespace = PageGetHeapFreeSpace(page);
+		UnlockReleaseBuffer(buffer);
+
+		/* Remember first block number thus added. */
+		if (firstBlock == InvalidBlockNumber)
+			firstBlock = blockNum;
+
+		/*
+		 * Immediately update the bottom level of the FSM.  This has a good
+		 * chance of making this page visible to other concurrently inserting
+		 * backends, and we want that to happen without delay.
+		 */
+		RecordPageWithFreeSpace(relation, blockNum, freespace);
+	}
+
+	/*
+	 * Updating the upper levels of the free space map is too expensive to do
+	 * for every block, but it's worth doing once at the end to make sure that
+	 * subsequent insertion activity sees all of the free pages we just added.
+	 * They are all equally empty, so the free space of the last one stands
+	 * for all of them.
+	 */
+	UpdateFreeSpaceMap(relation, firstBlock, blockNum, freespace);
+}
+
+/*
+ * RelationRecordHotUpdate - note the outcome of a HOT-eligible update
+ *
+ * heap_update calls this for each update that changed no indexed column,
+ * with samepage telling whether the new version fit on the old one's page.
+ * If the relation has autotune_fillfactor set, the ratio of misses over the
+ * last window of such updates adjusts the extra free space that
+ * RelationGetBufferForTuple leaves on pages, so that tables whose rows are
+ * updated a lot move toward a fillfactor that keeps those updates HOT.
+ *
+ * The state lives in the relcache entry, so every backend learns on its own
+ * and starts from nothing; that is good enough for long-lived sessions doing
+ * the bulk of the updates, and it keeps this free of any locking.
+ */
+void
+RelationRecordHotUpdate(Relation relation, bool samepage)
+{
+	RelationHotTuning *tune = &relation->rd_hottuning;
+
+	if (!RelationAutotuneFillfactor(relation))
+		return;
+
+	tune->attempts++;
+	if (!samepage)
+		tune->misses++;
+
+	if (tune->attempts < HOT_TUNE_WINDOW)
+		return;
+
+	if (tune->misses * HOT_TUNE_GROW_RATIO > tune->attempts)
+		tune->reserve = Min(tune->reserve + HOT_TUNE_STEP,
+							HOT_TUNE_MAX_RESERVE);
+	else if (tune->misses * HOT_TUNE_SHRINK_RATIO < tune->attempts)
+		tune->reserve = Max(tune->reserve - HOT_TUNE_STEP, 0);
+
+	tune->attempts = 0;
+	tune->misses = 0;
+}
+
 /*
  * RelationGetBufferForTuple
  *
@@ -206,7 +326,8 @@ GetVisibilityMapPins(Relation relation, Buffer buffer1, Buffer buffer2,
  *	We always try to avoid filling existing pages further than the fillfactor.
  *	This is OK since this routine is not consulted when updating a tuple and
  *	keeping it on the same page, which is the scenario fillfactor is meant
- *	to reserve space for.
+ *	to reserve space for.  With autotune_fillfactor, we keep at least as
+ *	much free space as RelationRecordHotUpdate has found to be needed.
  *
  *	ereport(ERROR) is allowed here, so this routine *must* be called
  *	before any (unlogged) changes are made in buffer pool.
@@ -244,6 +365,9 @@ RelationGetBufferForTuple(Relation relation, Size len,
 	/* Compute desired extra freespace due to fillfactor option */
 	saveFreeSpace = RelationGetTargetPageFreeSpace(relation,
 												   HEAP_DEFAULT_FILLFACTOR);
+	if (RelationAutotuneFillfactor(relation))
+		saveFreeSpace = Max(saveFreeSpace,
+							(Size) relation->rd_hottuning.reserve);
 
 	if (otherBuffer != InvalidBuffer)
 		otherBlock = BufferGetBlockNumber(otherBuffer);
@@ -296,6 +420,7 @@ RelationGetBufferForTuple(Relation relation, Size len,
 		}
 	}
 
+loop:
 	while (targetBlock != InvalidBlockNumber)
 	{
 		/*
@@ -428,8 +553,41 @@ RelationGetBufferForTuple(Relation relation, Size len,
 	 */
 	needLock = !RELATION_IS_LOCAL(relation);
 
+	/*
+	 * If we need the lock but are not able to acquire it immediately, we'll
+	 * consider extending the relation by multiple blocks at a time to manage
+	 * contention on the relation extension lock.  However, this only makes
+	 * sense if we're using the FSM; otherwise, there's no point.
+	 */
 	if (needLock)
-		LockRelationForExtension(relation, ExclusiveLock);
+	{
+		if (!use_fsm)
+			LockRelationForExtension(relation, ExclusiveLock);
+		else if (!ConditionalLockRelationForExtension(relation, ExclusiveLock))
+		{
+			/* Couldn't get the lock immediately; wait for it. */
+			LockRelationForExtension(relation, ExclusiveLock);
+
+			/*
+			 * Check if some other backend has extended a block for us while
+			 * we were waiting on the lock.
+			 */
+			targetBlock = GetPageWithFreeSpace(relation, len + saveFreeSpace);
+
+			/*
+			 * If some other waiter has already extended the relation, we
+			 * don't need to do so; just use the existing freespace.
+			 */
+			if (targetBlock != InvalidBlockNumber)
+			{
+				UnlockRelationForExtension(relation, ExclusiveLock);
+				goto loop;
+			}
+
+			/* Time to bulk-extend. */
+			RelationAddExtraBlocks(relation, bistate);
+		}
+	}
 
 	/*
 	 * XXX This does an lseek - rather expensive - but at the moment it is the
@@ -95,7 +95,8 @@ heap_page_prune_opt(Relation relation, Buffer buffer, TransactionId OldestXmin)
 	/*
 	 * We prune when a previous UPDATE failed to find enough space on the page
 	 * for a new tuple version, or when free space falls below the relation's
-	 * fill-factor target (but not less than 10%).
+	 * fill-factor target (but not less than 10%), or below the space that
+	 * autotune_fillfactor has decided to keep for HOT updates.
 	 *
 	 * Checking free space here is questionable since we aren't holding any
 	 * lock on the buffer; in the worst case we could get a bogus answer. It's
@@ -107,6 +108,7 @@ heap_page_prune_opt(Relation relation, Buffer buffer, TransactionId OldestXmin)
 	minfree = RelationGetTargetPageFreeSpace(relation,
 											 HEAP_DEFAULT_FILLFACTOR);
 	minfree = Max(minfree, BLCKSZ / 10);
+	minfree = Max(minfree, (Size) relation->rd_hottuning.reserve);
 
 	if (PageIsFull(page) || PageGetHeapFreeSpace(page) < minfree)
 	{
@@ -276,6 +278,11 @@ heap_page_prune(Relation relation, Buffer buffer, TransactionId OldestXmin,
 	if (report_stats && ndeleted > prstate.ndead)
 		pgstat_update_heap_dead_tuples(relation, ndeleted - prstate.ndead);
 
+	/* Likewise count the page, if this pass reclaimed anything on it */
+	if (report_stats &&
+		(prstate.nredirected > 0 || prstate.ndead > 0 || prstate.nunused > 0))
+		pgstat_count_heap_prune(relation);
+
 	*latestRemovedXid = prstate.latestRemovedXid;
 
 	/*
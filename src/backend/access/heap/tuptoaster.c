@@ -35,7 +35,9 @@
 #include "access/tuptoaster.h"
 #include "access/xact.h"
 #include "catalog/catalog.h"
+#include "utils/attoptcache.h"
 #include "utils/fmgroids.h"
+#include "utils/pg_lz4.h"
 #include "utils/pg_lzcompress.h"
 #include "utils/rel.h"
 #include "utils/typcache.h"
@@ -44,6 +46,9 @@
 
 #undef TOAST_DEBUG
 
+/* GUC variable */
+int			default_toast_compression = TOAST_PGLZ_COMPRESSION_ID;
+
 /* Size of an EXTERNAL datum that contains a standard TOAST pointer */
 #define TOAST_POINTER_SIZE (VARHDRSZ_EXTERNAL + sizeof(struct varatt_external))
 
@@ -81,6 +86,7 @@ static bool toastid_valueid_exists(Oid toastrelid, Oid valueid);
 static struct varlena *toast_fetch_datum(struct varlena * attr);
 static struct varlena *toast_fetch_datum_slice(struct varlena * attr,
 						int32 sliceoffset, int32 length);
+static struct varlena *toast_decompress_datum(struct varlena * attr);
 
 
 /* ----------
@@ -137,11 +143,9 @@ heap_tuple_untoast_attr(struct varlena * attr)
 		/* If it's compressed, decompress it */
 		if (VARATT_IS_COMPRESSED(attr))
 		{
-			PGLZ_Header *tmp = (PGLZ_Header *) attr;
+			struct varlena *tmp = attr;
 
-			attr = (struct varlena *) palloc(PGLZ_RAW_SIZE(tmp) + VARHDRSZ);
-			SET_VARSIZE(attr, PGLZ_RAW_SIZE(tmp) + VARHDRSZ);
-			pglz_decompress(tmp, VARDATA(attr));
+			attr = toast_decompress_datum(tmp);
 			pfree(tmp);
 		}
 	}
@@ -150,11 +154,7 @@ heap_tuple_untoast_attr(struct varlena * attr)
 		/*
 		 * This is a compressed value inside of the main tuple
 		 */
-		PGLZ_Header *tmp = (PGLZ_Header *) attr;
-
-		attr = (struct varlena *) palloc(PGLZ_RAW_SIZE(tmp) + VARHDRSZ);
-		SET_VARSIZE(attr, PGLZ_RAW_SIZE(tmp) + VARHDRSZ);
-		pglz_decompress(tmp, VARDATA(attr));
+		attr = toast_decompress_datum(attr);
 	}
 	else if (VARATT_IS_SHORT(attr))
 	{
@@ -209,14 +209,11 @@ heap_tuple_untoast_attr_slice(struct varlena * attr,
 
 	if (VARATT_IS_COMPRESSED(preslice))
 	{
-		PGLZ_Header *tmp = (PGLZ_Header *) preslice;
-		Size		size = PGLZ_RAW_SIZE(tmp) + VARHDRSZ;
+		struct varlena *tmp = preslice;
 
-		preslice = (struct varlena *) palloc(size);
-		SET_VARSIZE(preslice, size);
-		pglz_decompress(tmp, VARDATA(preslice));
+		preslice = toast_decompress_datum(tmp);
 
-		if (tmp != (PGLZ_Header *) attr)
+		if (tmp != attr)
 			pfree(tmp);
 	}
 
@@ -336,6 +333,40 @@ toast_datum_size(Datum value)
 }
 
 
+/* ----------
+ * toast_datum_compression
+ *
+ *	Return the compression method id of a varlena datum, or -1 if it is
+ *	not compressed
+ * ----------
+ */
+int
+toast_datum_compression(Datum value)
+{
+	struct varlena *attr = (struct varlena *) DatumGetPointer(value);
+	int			result = -1;
+
+	if (VARATT_IS_EXTERNAL(attr))
+	{
+		struct varatt_external toast_pointer;
+
+		VARATT_EXTERNAL_GET_POINTER(toast_pointer, attr);
+		if (VARATT_EXTERNAL_IS_COMPRESSED(toast_pointer))
+		{
+			/* the method is recorded in the header of the stored data */
+			struct varlena *tmp = toast_fetch_datum(attr);
+
+			result = VARCOMPRESS_4B_C(tmp);
+			pfree(tmp);
+		}
+	}
+	else if (VARATT_IS_COMPRESSED(attr))
+		result = VARCOMPRESS_4B_C(attr);
+
+	return result;
+}
+
+
 /* ----------
  * toast_delete -
  *
@@ -645,7 +676,8 @@ toast_insert_or_update(Relation rel, HeapTuple newtup, HeapTuple oldtup,
 		if (att[i]->attstorage == 'x')
 		{
 			old_value = toast_values[i];
-			new_value = toast_compress_datum(old_value);
+			new_value = toast_compress_datum(old_value,
+								toast_compression_method(rel, att[i]->attnum));
 
 			if (DatumGetPointer(new_value) != NULL)
 			{
@@ -784,7 +816,8 @@ toast_insert_or_update(Relation rel, HeapTuple newtup, HeapTuple oldtup,
 		 */
 		i = biggest_attno;
 		old_value = toast_values[i];
-		new_value = toast_compress_datum(old_value);
+		new_value = toast_compress_datum(old_value,
+								toast_compression_method(rel, att[i]->attnum));
 
 		if (DatumGetPointer(new_value) != NULL)
 		{
@@ -1169,7 +1202,8 @@ toast_flatten_tuple_to_datum(HeapTupleHeader tup,
 /* ----------
  * toast_compress_datum -
  *
- *	Create a compressed version of a varlena datum
+ *	Create a compressed version of a varlena datum, using the given
+ *	compression method
  *
  *	If we fail (ie, compressed result is actually bigger than original)
  *	then return NULL.  We must not use compressed data if it'd expand
@@ -1180,7 +1214,7 @@ toast_flatten_tuple_to_datum(HeapTupleHeader tup,
  * ----------
  */
 Datum
-toast_compress_datum(Datum value)
+toast_compress_datum(Datum value, int method)
 {
 	struct varlena *tmp;
 	int32		valsize = VARSIZE_ANY_EXHDR(DatumGetPointer(value));
@@ -1190,12 +1224,41 @@ toast_compress_datum(Datum value)
 
 	/*
 	 * No point in wasting a palloc cycle if value size is out of the allowed
-	 * range for compression
+	 * range for compression.  LZ4 goes by the same limits as pglz, so that
+	 * the choice of method does not change which values get compressed.
 	 */
 	if (valsize < PGLZ_strategy_default->min_input_size ||
 		valsize > PGLZ_strategy_default->max_input_size)
 		return PointerGetDatum(NULL);
 
+	if (method == TOAST_LZ4_COMPRESSION_ID)
+	{
+		/*
+		 * Insist on the same minimum compression rate pglz requires, and
+		 * let the compressor give up as soon as it cannot meet it.
+		 */
+		int32		maxlen;
+		int32		len;
+
+		maxlen = valsize -
+			(int32) (((int64) valsize * PGLZ_strategy_default->min_comp_rate) / 100);
+
+		tmp = (struct varlena *) palloc(VARHDRSZ_COMPRESSED + maxlen);
+		len = pg_lz4_compress(VARDATA_ANY(DatumGetPointer(value)), valsize,
+							  VARDATA_4B_C(tmp), maxlen);
+
+		/* see below for the reason of the extra check */
+		if (len >= 0 && VARHDRSZ_COMPRESSED + len < valsize - 2)
+		{
+			SET_VARSIZE_COMPRESSED(tmp, VARHDRSZ_COMPRESSED + len);
+			SET_VARRAWSIZE_4B_C(tmp, valsize, TOAST_LZ4_COMPRESSION_ID);
+			return PointerGetDatum(tmp);
+		}
+
+		pfree(tmp);
+		return PointerGetDatum(NULL);
+	}
+
 	tmp = (struct varlena *) palloc(PGLZ_MAX_OUTPUT(valsize));
 
 	/*
@@ -1224,6 +1287,127 @@ toast_compress_datum(Datum value)
 }
 
 
+/* ----------
+ * toast_decompress_datum -
+ *
+ *	Decompress an in-line compressed varlena datum into a palloc'd
+ *	uncompressed one, whichever method it was compressed with.
+ * ----------
+ */
+static struct varlena *
+toast_decompress_datum(struct varlena * attr)
+{
+	struct varlena *result;
+	int32		rawsize = VARRAWSIZE_4B_C(attr);
+
+	Assert(VARATT_IS_COMPRESSED(attr));
+
+	result = (struct varlena *) palloc(rawsize + VARHDRSZ);
+	SET_VARSIZE(result, rawsize + VARHDRSZ);
+
+	switch (VARCOMPRESS_4B_C(attr))
+	{
+		case TOAST_PGLZ_COMPRESSION_ID:
+			pglz_decompress((PGLZ_Header *) attr, VARDATA(result));
+			break;
+		case TOAST_LZ4_COMPRESSION_ID:
+			if (pg_lz4_decompress(VARDATA_4B_C(attr),
+								  VARSIZE(attr) - VARHDRSZ_COMPRESSED,
+								  VARDATA(result), rawsize) != rawsize)
+				ereport(ERROR,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg_internal("compressed data is corrupt")));
+			break;
+		default:
+			elog(ERROR, "invalid compression method id %d",
+				 VARCOMPRESS_4B_C(attr));
+			break;
+	}
+
+	return result;
+}
+
+
+/* ----------
+ * toast_compression_method -
+ *
+ *	Return the compression method for new values of column attnum of rel:
+ *	the column's "compression" option if it has one, else the value of
+ *	default_toast_compression.
+ * ----------
+ */
+int
+toast_compression_method(Relation rel, AttrNumber attnum)
+{
+	AttributeOpts *aopt;
+	int			method = default_toast_compression;
+
+	/* System catalogs cannot have column options; don't look them up */
+	if (attnum <= 0 || IsSystemRelation(rel))
+		return method;
+
+	aopt = get_attribute_options(RelationGetRelid(rel), attnum);
+	if (aopt != NULL)
+	{
+		if (aopt->compression_offset != 0)
+		{
+			const char *name = (const char *) aopt + aopt->compression_offset;
+
+			if (strcmp(name, "lz4") == 0)
+				method = TOAST_LZ4_COMPRESSION_ID;
+			else if (strcmp(name, "pglz") == 0)
+				method = TOAST_PGLZ_COMPRESSION_ID;
+		}
+		pfree(aopt);
+	}
+
+	return method;
+}
+
+
+/* ----------
+ * toast_compression_name -
+ *
+ *	Return the user-visible name of a compression method id.
+ * ----------
+ */
+const char *
+toast_compression_name(int method)
+{
+	switch (method)
+	{
+		case TOAST_PGLZ_COMPRESSION_ID:
+			return "pglz";
+		case TOAST_LZ4_COMPRESSION_ID:
+			return "lz4";
+	}
+
+	elog(ERROR, "invalid compression method id %d", method);
+	return NULL;				/* keep compiler quiet */
+}
+
+
+/* ----------
+ * toast_validate_compression_option -
+ *
+ *	Validator for the "compression" attribute option.
+ * ----------
+ */
+void
+toast_validate_compression_option(char *value)
+{
+	if (value == NULL ||
+		(strcmp(value, "pglz") != 0 &&
+		 strcmp(value, "lz4") != 0))
+	{
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("invalid value for \"compression\" option"),
+				 errdetail("Valid values are \"pglz\" and \"lz4\".")));
+	}
+}
+
+
 /* ----------
  * toast_save_datum -
  *
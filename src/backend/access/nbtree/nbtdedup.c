@@ -0,0 +1,369 @@
+/*-------------------------------------------------------------------------
+ *
+ * nbtdedup.c
+ *	  Deduplication of btree leaf tuples into posting list tuples.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/access/nbtree/nbtdedup.c
+ *
+ *	NOTES
+ *	   A run of leaf tuples with identical keys is stored as one posting list
+ *	   tuple holding the key once and all the heap TIDs after it; see
+ *	   nbtree.h for the tuple format.  Posting list tuples are formed when an
+ *	   index is built (see nbtsort.c), and by a deduplication pass over a leaf
+ *	   page that has run out of room for an insertion, which often saves
+ *	   splitting the page.
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/nbtree.h"
+#include "miscadmin.h"
+#include "utils/rel.h"
+
+
+/*
+ *	_bt_dedup_enabled() -- may the index keep posting list tuples?
+ *
+ * Unique indexes never do: _bt_check_unique() expects to find each heap TID
+ * of a key in a tuple of its own.  Otherwise it is controlled by the
+ * deduplicate_items storage parameter, which defaults to on.
+ */
+bool
+_bt_dedup_enabled(Relation rel)
+{
+	BTOptions  *options = (BTOptions *) rel->rd_options;
+
+	if (rel->rd_index->indisunique)
+		return false;
+
+	return options == NULL || options->deduplicate_items;
+}
+
+/*
+ *	_bt_dedup_mergeable() -- may itup's heap TIDs join base's posting list?
+ *
+ * Either tuple may be a posting list tuple already.  The keys must be
+ * byte-for-byte identical; index_form_tuple() zeroes the alignment padding,
+ * so equal values always compare equal here.
+ */
+bool
+_bt_dedup_mergeable(IndexTuple base, IndexTuple itup)
+{
+	Size		keysize = BTreeTupleGetKeySize(base);
+	unsigned short mask = INDEX_SIZE_MASK | BT_IS_POSTING;
+
+	if (BTreeTupleGetKeySize(itup) != keysize)
+		return false;
+	if ((base->t_info & ~mask) != (itup->t_info & ~mask))
+		return false;
+
+	return memcmp((char *) base + sizeof(IndexTupleData),
+				  (char *) itup + sizeof(IndexTupleData),
+				  keysize - sizeof(IndexTupleData)) == 0;
+}
+
+/*
+ *	_bt_form_posting() -- form a tuple with base's key and the given TIDs.
+ *
+ * The result is a palloc'd posting list tuple, or a plain tuple if there is
+ * just one heap TID.
+ */
+IndexTuple
+_bt_form_posting(IndexTuple base, ItemPointer htids, int nhtids)
+{
+	Size		keysize = BTreeTupleGetKeySize(base);
+	Size		newsize;
+	IndexTuple	itup;
+
+	Assert(nhtids > 0);
+	Assert(keysize == MAXALIGN(keysize));
+
+	if (nhtids > 1)
+		newsize = MAXALIGN(keysize + nhtids * sizeof(ItemPointerData));
+	else
+		newsize = keysize;
+
+	if (newsize > INDEX_SIZE_MASK)
+		elog(ERROR, "posting list tuple of %lu bytes is too large",
+			 (unsigned long) newsize);
+
+	itup = (IndexTuple) palloc0(newsize);
+	memcpy(itup, base, keysize);
+	itup->t_info &= ~(INDEX_SIZE_MASK | BT_IS_POSTING);
+	itup->t_info |= newsize;
+
+	if (nhtids > 1)
+	{
+		itup->t_info |= BT_IS_POSTING;
+		ItemPointerSet(&itup->t_tid, (BlockNumber) keysize,
+					   (OffsetNumber) nhtids);
+		memcpy(BTreeTupleGetPosting(itup), htids,
+			   nhtids * sizeof(ItemPointerData));
+	}
+	else
+		itup->t_tid = htids[0];
+
+	return itup;
+}
+
+/*
+ *	_bt_keytuple() -- copy a leaf tuple, without its posting list if any.
+ *
+ * This is what high keys and downlinks are made from.  The copy is palloc'd;
+ * its t_tid is the first heap TID of the tuple, and is normally overwritten
+ * by the caller.
+ */
+IndexTuple
+_bt_keytuple(IndexTuple itup)
+{
+	IndexTuple	result;
+	Size		keysize;
+
+	if (!BTreeTupleIsPosting(itup))
+		return CopyIndexTuple(itup);
+
+	keysize = BTreeTupleGetPostingOffset(itup);
+	result = (IndexTuple) palloc(keysize);
+	memcpy(result, itup, keysize);
+	result->t_info &= ~(INDEX_SIZE_MASK | BT_IS_POSTING);
+	result->t_info |= keysize;
+	result->t_tid = *BTreeTupleGetPosting(itup);
+
+	return result;
+}
+
+/*
+ *	_bt_dedup_one_page() -- merge runs of duplicates on a leaf page.
+ *
+ * Called by _bt_findinsertloc() when the incoming tuple does not fit on the
+ * page, before it resorts to splitting the page or moving right.  The caller
+ * must hold a write lock on buf.  Items marked LP_DEAD are left alone; they
+ * will be removed by the next _bt_vacuum_one_page() or VACUUM.
+ *
+ * Scans that have the page pinned do not mind the items moving around: a
+ * scan works from its own copy of the matching items, and _bt_killitems()
+ * only kills an item once it has found it again.
+ *
+ * Returns true if the page was changed, which invalidates any insert location
+ * computed beforehand.
+ */
+bool
+_bt_dedup_one_page(Relation rel, Buffer buf)
+{
+	Page		page = BufferGetPage(buf);
+	BTPageOpaque opaque = (BTPageOpaque) PageGetSpecialPointer(page);
+	OffsetNumber minoff = P_FIRSTDATAKEY(opaque);
+	OffsetNumber maxoff = PageGetMaxOffsetNumber(page);
+	OffsetNumber offnum;
+	Size		maxpostingsize = BTMaxPostingSize(page);
+	xl_btree_dedup_interval *intervals;
+	int			nintervals = 0;
+	Page		newpage;
+
+	Assert(P_ISLEAF(opaque));
+
+	/* each run has at least two items */
+	intervals = (xl_btree_dedup_interval *)
+		palloc((maxoff / 2 + 1) * sizeof(xl_btree_dedup_interval));
+
+	offnum = minoff;
+	while (offnum <= maxoff)
+	{
+		ItemId		itemid = PageGetItemId(page, offnum);
+		OffsetNumber next = OffsetNumberNext(offnum);
+		IndexTuple	base;
+		Size		keysize;
+		int			nhtids;
+
+		if (ItemIdIsDead(itemid))
+		{
+			offnum = next;
+			continue;
+		}
+
+		base = (IndexTuple) PageGetItem(page, itemid);
+		keysize = BTreeTupleGetKeySize(base);
+		nhtids = BTreeTupleGetNHeapTids(base);
+
+		while (next <= maxoff)
+		{
+			ItemId		nextid = PageGetItemId(page, next);
+			IndexTuple	itup;
+			int			n;
+
+			if (ItemIdIsDead(nextid))
+				break;
+			itup = (IndexTuple) PageGetItem(page, nextid);
+			if (!_bt_dedup_mergeable(base, itup))
+				break;
+			n = BTreeTupleGetNHeapTids(itup);
+			if (MAXALIGN(keysize + (nhtids + n) * sizeof(ItemPointerData)) >
+				maxpostingsize)
+				break;
+			nhtids += n;
+			next = OffsetNumberNext(next);
+		}
+
+		if (next - offnum > 1)
+		{
+			intervals[nintervals].baseoff = offnum;
+			intervals[nintervals].nitems = next - offnum;
+			nintervals++;
+		}
+		offnum = next;
+	}
+
+	if (nintervals == 0)
+	{
+		pfree(intervals);
+		return false;
+	}
+
+	/* Build the new page image before entering the critical section */
+	newpage = _bt_dedup_apply(page, intervals, nintervals);
+
+	START_CRIT_SECTION();
+
+	PageRestoreTempPage(newpage, page);
+	MarkBufferDirty(buf);
+
+	/* XLOG stuff */
+	if (RelationNeedsWAL(rel))
+	{
+		xl_btree_dedup xlrec;
+		XLogRecPtr	recptr;
+		XLogRecData rdata[2];
+
+		xlrec.node = rel->rd_node;
+		xlrec.block = BufferGetBlockNumber(buf);
+		xlrec.nintervals = nintervals;
+
+		rdata[0].data = (char *) &xlrec;
+		rdata[0].len = SizeOfBtreeDedup;
+		rdata[0].buffer = InvalidBuffer;
+		rdata[0].next = &(rdata[1]);
+
+		/* the intervals need not be stored if the whole page is */
+		rdata[1].data = (char *) intervals;
+		rdata[1].len = nintervals * sizeof(xl_btree_dedup_interval);
+		rdata[1].buffer = buf;
+		rdata[1].buffer_std = true;
+		rdata[1].next = NULL;
+
+		recptr = XLogInsert(RM_BTREE_ID, XLOG_BTREE_DEDUP, rdata);
+
+		PageSetLSN(page, recptr);
+	}
+
+	END_CRIT_SECTION();
+
+	pfree(intervals);
+
+	return true;
+}
+
+/*
+ *	_bt_dedup_apply() -- build a page image with the given runs merged.
+ *
+ * Returns a palloc'd copy of page in which the items of each interval are
+ * replaced by one posting list tuple; the caller installs it with
+ * PageRestoreTempPage().  Shared by _bt_dedup_one_page() and WAL replay, so
+ * that both produce the same page.
+ */
+Page
+_bt_dedup_apply(Page page, xl_btree_dedup_interval *intervals, int nintervals)
+{
+	BTPageOpaque opaque = (BTPageOpaque) PageGetSpecialPointer(page);
+	OffsetNumber minoff = P_FIRSTDATAKEY(opaque);
+	OffsetNumber maxoff = PageGetMaxOffsetNumber(page);
+	OffsetNumber offnum;
+	OffsetNumber newoff;
+	Page		newpage;
+	ItemPointer htids;
+	int			i = 0;
+
+	newpage = PageGetTempPageCopySpecial(page);
+	htids = (ItemPointer) palloc(MaxTIDsPerBTreePage * sizeof(ItemPointerData));
+
+	if (!P_RIGHTMOST(opaque))
+	{
+		ItemId		hitemid = PageGetItemId(page, P_HIKEY);
+
+		if (PageAddItem(newpage, PageGetItem(page, hitemid),
+						ItemIdGetLength(hitemid), P_HIKEY,
+						false, false) == InvalidOffsetNumber)
+			elog(ERROR, "failed to add high key during deduplication");
+	}
+
+	newoff = minoff;
+	offnum = minoff;
+	while (offnum <= maxoff)
+	{
+		ItemId		itemid = PageGetItemId(page, offnum);
+		IndexTuple	itup = (IndexTuple) PageGetItem(page, itemid);
+
+		if (i < nintervals && intervals[i].baseoff == offnum)
+		{
+			IndexTuple	posting;
+			int			nhtids = 0;
+			int			j;
+
+			if (intervals[i].nitems < 2 ||
+				offnum + intervals[i].nitems - 1 > maxoff)
+				elog(ERROR, "invalid deduplication interval %u/%u",
+					 intervals[i].baseoff, intervals[i].nitems);
+
+			for (j = 0; j < intervals[i].nitems; j++)
+			{
+				IndexTuple	cur;
+				int			n;
+
+				cur = (IndexTuple) PageGetItem(page,
+											   PageGetItemId(page, offnum + j));
+				n = BTreeTupleGetNHeapTids(cur);
+				if (nhtids + n > MaxTIDsPerBTreePage)
+					elog(ERROR, "too many heap TIDs in deduplication interval");
+				if (BTreeTupleIsPosting(cur))
+					memcpy(htids + nhtids, BTreeTupleGetPosting(cur),
+						   n * sizeof(ItemPointerData));
+				else
+					htids[nhtids] = cur->t_tid;
+				nhtids += n;
+			}
+
+			posting = _bt_form_posting(itup, htids, nhtids);
+			if (PageAddItem(newpage, (Item) posting, IndexTupleSize(posting),
+							newoff, false, false) == InvalidOffsetNumber)
+				elog(ERROR, "failed to add posting list tuple during deduplication");
+			pfree(posting);
+
+			offnum += intervals[i].nitems;
+			i++;
+		}
+		else
+		{
+			if (PageAddItem(newpage, (Item) itup, ItemIdGetLength(itemid),
+							newoff, false, false) == InvalidOffsetNumber)
+				elog(ERROR, "failed to add item during deduplication");
+			/* keep the hint, it is still true */
+			if (ItemIdIsDead(itemid))
+				ItemIdMarkDead(PageGetItemId(newpage, newoff));
+
+			offnum = OffsetNumberNext(offnum);
+		}
+		newoff = OffsetNumberNext(newoff);
+	}
+
+	if (i != nintervals)
+		elog(ERROR, "deduplication intervals do not match the page");
+
+	pfree(htids);
+
+	return newpage;
+}
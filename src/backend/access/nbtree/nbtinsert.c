@@ -519,7 +519,8 @@ _bt_findinsertloc(Relation rel,
 	Size		itemsz;
 	BTPageOpaque lpageop;
 	bool		movedright,
-				vacuumed;
+				vacuumed,
+				deduped;
 	OffsetNumber newitemoff;
 	OffsetNumber firstlegaloff = *offsetptr;
 
@@ -571,6 +572,7 @@ _bt_findinsertloc(Relation rel,
 	 */
 	movedright = false;
 	vacuumed = false;
+	deduped = false;
 	while (PageGetFreeSpace(page) < itemsz)
 	{
 		Buffer		rbuf;
@@ -593,6 +595,22 @@ _bt_findinsertloc(Relation rel,
 				break;			/* OK, now we have enough space */
 		}
 
+		/*
+		 * likewise, see if merging duplicates into posting list tuples frees
+		 * enough space.  This too invalidates the hint if it changes the page.
+		 */
+		if (P_ISLEAF(lpageop) && !deduped && _bt_dedup_enabled(rel))
+		{
+			deduped = true;
+			if (_bt_dedup_one_page(rel, buf))
+			{
+				vacuumed = true;
+
+				if (PageGetFreeSpace(page) >= itemsz)
+					break;		/* OK, now we have enough space */
+			}
+		}
+
 		/*
 		 * nope, so check conditions (b) and (c) enumerated above
 		 */
@@ -628,6 +646,7 @@ _bt_findinsertloc(Relation rel,
 		buf = rbuf;
 		movedright = true;
 		vacuumed = false;
+		deduped = false;
 	}
 
 	/*
@@ -916,6 +935,7 @@ _bt_split(Relation rel, Buffer buf, OffsetNumber firstright,
 	Size		itemsz;
 	ItemId		itemid;
 	IndexTuple	item;
+	IndexTuple	lefthikey = NULL;
 	OffsetNumber leftoff,
 				rightoff;
 	OffsetNumber maxoff;
@@ -1017,6 +1037,14 @@ _bt_split(Relation rel, Buffer buf, OffsetNumber firstright,
 		itemid = PageGetItemId(origpage, firstright);
 		itemsz = ItemIdGetLength(itemid);
 		item = (IndexTuple) PageGetItem(origpage, itemid);
+
+		/* a high key needs just the key of a posting list tuple */
+		if (BTreeTupleIsPosting(item))
+		{
+			lefthikey = _bt_keytuple(item);
+			itemsz = IndexTupleSize(lefthikey);
+			item = lefthikey;
+		}
 	}
 	if (PageAddItem(leftpage, (Item) item, itemsz, leftoff,
 					false, false) == InvalidOffsetNumber)
@@ -1027,6 +1055,8 @@ _bt_split(Relation rel, Buffer buf, OffsetNumber firstright,
 			 origpagenumber, RelationGetRelationName(rel));
 	}
 	leftoff = OffsetNumberNext(leftoff);
+	if (lefthikey)
+		pfree(lefthikey);
 
 	/*
 	 * Now transfer all the data items to the appropriate page.
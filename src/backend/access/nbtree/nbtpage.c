@@ -789,19 +789,39 @@ _bt_page_recyclable(Page page)
  * for the last block in the index, whether or not it contained any items
  * to be removed. This allows us to scan right up to end of index to
  * ensure correct locking.
+ *
+ * updateitemnos/updated give posting list tuples to be replaced by smaller
+ * versions of themselves, because VACUUM removed only some of their heap
+ * TIDs.  They must be in increasing offset order too.
  */
 void
 _bt_delitems_vacuum(Relation rel, Buffer buf,
 					OffsetNumber *itemnos, int nitems,
-					BlockNumber lastBlockVacuumed)
+					OffsetNumber *updateitemnos, IndexTuple *updated,
+					int nupdated, BlockNumber lastBlockVacuumed)
 {
 	Page		page = BufferGetPage(buf);
 	BTPageOpaque opaque;
+	XLogRecData *rdata = NULL;
+	int			i;
+
+	if (nupdated > 0 && RelationNeedsWAL(rel))
+		rdata = (XLogRecData *) palloc((nupdated + 3) * sizeof(XLogRecData));
 
 	/* No ereport(ERROR) until changes are logged */
 	START_CRIT_SECTION();
 
 	/* Fix the page */
+	for (i = 0; i < nupdated; i++)
+	{
+		OffsetNumber updoff = updateitemnos[i];
+
+		PageIndexTupleDelete(page, updoff);
+		if (PageAddItem(page, (Item) updated[i], IndexTupleSize(updated[i]),
+						updoff, false, false) == InvalidOffsetNumber)
+			elog(PANIC, "failed to replace posting list tuple in index \"%s\"",
+				 RelationGetRelationName(rel));
+	}
 	if (nitems > 0)
 		PageIndexMultiDelete(page, itemnos, nitems);
 
@@ -827,13 +847,18 @@ _bt_delitems_vacuum(Relation rel, Buffer buf,
 	if (RelationNeedsWAL(rel))
 	{
 		XLogRecPtr	recptr;
-		XLogRecData rdata[2];
+		XLogRecData rdata_local[2];
 		xl_btree_vacuum xlrec_vacuum;
 
+		if (rdata == NULL)
+			rdata = rdata_local;
+
 		xlrec_vacuum.node = rel->rd_node;
 		xlrec_vacuum.block = BufferGetBlockNumber(buf);
 
 		xlrec_vacuum.lastBlockVacuumed = lastBlockVacuumed;
+		xlrec_vacuum.ndeleted = nitems;
+		xlrec_vacuum.nupdated = nupdated;
 		rdata[0].data = (char *) &xlrec_vacuum;
 		rdata[0].len = SizeOfBtreeVacuum;
 		rdata[0].buffer = InvalidBuffer;
@@ -842,7 +867,7 @@ _bt_delitems_vacuum(Relation rel, Buffer buf,
 		/*
 		 * The target-offsets array is not in the buffer, but pretend that it
 		 * is.  When XLogInsert stores the whole buffer, the offsets array
-		 * need not be stored too.
+		 * need not be stored too.  Likewise for the replacement tuples.
 		 */
 		if (nitems > 0)
 		{
@@ -858,12 +883,34 @@ _bt_delitems_vacuum(Relation rel, Buffer buf,
 		rdata[1].buffer_std = true;
 		rdata[1].next = NULL;
 
+		if (nupdated > 0)
+		{
+			rdata[1].next = &(rdata[2]);
+			rdata[2].data = (char *) updateitemnos;
+			rdata[2].len = nupdated * sizeof(OffsetNumber);
+			rdata[2].buffer = buf;
+			rdata[2].buffer_std = true;
+			rdata[2].next = &(rdata[3]);
+
+			for (i = 0; i < nupdated; i++)
+			{
+				rdata[i + 3].data = (char *) updated[i];
+				rdata[i + 3].len = IndexTupleSize(updated[i]);
+				rdata[i + 3].buffer = buf;
+				rdata[i + 3].buffer_std = true;
+				rdata[i + 3].next = (i + 1 < nupdated) ? &(rdata[i + 4]) : NULL;
+			}
+		}
+
 		recptr = XLogInsert(RM_BTREE_ID, XLOG_BTREE_VACUUM, rdata);
 
 		PageSetLSN(page, recptr);
 	}
 
 	END_CRIT_SECTION();
+
+	if (rdata != NULL && nupdated > 0)
+		pfree(rdata);
 }
 
 /*
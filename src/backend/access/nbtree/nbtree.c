@@ -74,6 +74,9 @@ static void btvacuumscan(IndexVacuumInfo *info, IndexBulkDeleteResult *stats,
 			 BTCycleId cycleid);
 static void btvacuumpage(BTVacState *vstate, BlockNumber blkno,
 			 BlockNumber orig_blkno);
+static IndexTuple btvacuumposting(IndexTuple itup,
+				IndexBulkDeleteCallback callback, void *callback_state,
+				int *nremoved);
 
 
 /*
@@ -319,8 +322,8 @@ btgettuple(PG_FUNCTION_ARGS)
 				 */
 				if (so->killedItems == NULL)
 					so->killedItems = (int *)
-						palloc(MaxIndexTuplesPerPage * sizeof(int));
-				if (so->numKilled < MaxIndexTuplesPerPage)
+						palloc(MaxTIDsPerBTreePage * sizeof(int));
+				if (so->numKilled < MaxTIDsPerBTreePage)
 					so->killedItems[so->numKilled++] = so->currPos.itemIndex;
 			}
 
@@ -843,7 +846,8 @@ btvacuumscan(IndexVacuumInfo *info, IndexBulkDeleteResult *stats,
 								 RBM_NORMAL, info->strategy);
 		LockBufferForCleanup(buf);
 		_bt_checkpage(rel, buf);
-		_bt_delitems_vacuum(rel, buf, NULL, 0, vstate.lastBlockVacuumed);
+		_bt_delitems_vacuum(rel, buf, NULL, 0, NULL, NULL, 0,
+							vstate.lastBlockVacuumed);
 		_bt_relbuf(rel, buf);
 	}
 
@@ -939,6 +943,10 @@ restart:
 	{
 		OffsetNumber deletable[MaxOffsetNumber];
 		int			ndeletable;
+		OffsetNumber updatable[MaxIndexTuplesPerPage];
+		IndexTuple	updated[MaxIndexTuplesPerPage];
+		int			nupdatable;
+		int			nremoved;
 		OffsetNumber offnum,
 					minoff,
 					maxoff;
@@ -978,6 +986,8 @@ restart:
 		 * callback function.
 		 */
 		ndeletable = 0;
+		nupdatable = 0;
+		nremoved = 0;
 		minoff = P_FIRSTDATAKEY(opaque);
 		maxoff = PageGetMaxOffsetNumber(page);
 		if (callback)
@@ -1014,8 +1024,26 @@ restart:
 				 * applies to *any* type of index that marks index tuples as
 				 * killed.
 				 */
-				if (callback(htup, callback_state))
+				if (BTreeTupleIsPosting(itup))
+				{
+					IndexTuple	newitup;
+
+					/* check each heap TID, keeping the tuple if any survive */
+					newitup = btvacuumposting(itup, callback, callback_state,
+											  &nremoved);
+					if (newitup == NULL)
+						deletable[ndeletable++] = offnum;
+					else if (newitup != itup)
+					{
+						updatable[nupdatable] = offnum;
+						updated[nupdatable++] = newitup;
+					}
+				}
+				else if (callback(htup, callback_state))
+				{
 					deletable[ndeletable++] = offnum;
+					nremoved++;
+				}
 			}
 		}
 
@@ -1023,8 +1051,10 @@ restart:
 		 * Apply any needed deletes.  We issue just one _bt_delitems_vacuum()
 		 * call per page, so as to minimize WAL traffic.
 		 */
-		if (ndeletable > 0)
+		if (ndeletable > 0 || nupdatable > 0)
 		{
+			int			i;
+
 			/*
 			 * Notice that the issued XLOG_BTREE_VACUUM WAL record includes an
 			 * instruction to the replay code to get cleanup lock on all pages
@@ -1037,8 +1067,12 @@ restart:
 			 * that.
 			 */
 			_bt_delitems_vacuum(rel, buf, deletable, ndeletable,
+								updatable, updated, nupdatable,
 								vstate->lastBlockVacuumed);
 
+			for (i = 0; i < nupdatable; i++)
+				pfree(updated[i]);
+
 			/*
 			 * Remember highest leaf page number we've issued a
 			 * XLOG_BTREE_VACUUM WAL record for.
@@ -1046,7 +1080,7 @@ restart:
 			if (blkno > vstate->lastBlockVacuumed)
 				vstate->lastBlockVacuumed = blkno;
 
-			stats->tuples_removed += ndeletable;
+			stats->tuples_removed += nremoved;
 			/* must recompute maxoff */
 			maxoff = PageGetMaxOffsetNumber(page);
 		}
@@ -1078,7 +1112,18 @@ restart:
 		if (minoff > maxoff)
 			delete_now = (blkno == orig_blkno);
 		else
-			stats->num_index_tuples += maxoff - minoff + 1;
+		{
+			for (offnum = minoff;
+				 offnum <= maxoff;
+				 offnum = OffsetNumberNext(offnum))
+			{
+				IndexTuple	itup;
+
+				itup = (IndexTuple) PageGetItem(page,
+												PageGetItemId(page, offnum));
+				stats->num_index_tuples += BTreeTupleGetNHeapTids(itup);
+			}
+		}
 	}
 
 	if (delete_now)
@@ -1116,6 +1161,45 @@ restart:
 	}
 }
 
+/*
+ * btvacuumposting --- check the heap TIDs of a posting list tuple
+ *
+ * Returns itup itself if none of its heap TIDs are to be removed, NULL if all
+ * of them are, and otherwise a palloc'd replacement holding the survivors.
+ * The number of heap TIDs removed is added to *nremoved.
+ */
+static IndexTuple
+btvacuumposting(IndexTuple itup, IndexBulkDeleteCallback callback,
+				void *callback_state, int *nremoved)
+{
+	ItemPointer htids = BTreeTupleGetPosting(itup);
+	int			nhtids = BTreeTupleGetNPosting(itup);
+	ItemPointer live;
+	int			nlive = 0;
+	int			i;
+	IndexTuple	result;
+
+	live = (ItemPointer) palloc(nhtids * sizeof(ItemPointerData));
+	for (i = 0; i < nhtids; i++)
+	{
+		if (!callback(&htids[i], callback_state))
+			live[nlive++] = htids[i];
+	}
+
+	*nremoved += nhtids - nlive;
+
+	if (nlive == nhtids)
+		result = itup;
+	else if (nlive == 0)
+		result = NULL;
+	else
+		result = _bt_form_posting(itup, live, nlive);
+
+	pfree(live);
+
+	return result;
+}
+
 /*
  *	btcanreturn() -- Check whether btree indexes support index-only scans.
  *
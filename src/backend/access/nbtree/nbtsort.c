@@ -133,6 +133,8 @@ static void _bt_sortaddtup(Page page, Size itemsize,
 			   IndexTuple itup, OffsetNumber itup_off);
 static void _bt_buildadd(BTWriteState *wstate, BTPageState *state,
 			 IndexTuple itup);
+static void _bt_buildadd_posting(BTWriteState *wstate, BTPageState *state,
+					 IndexTuple base, ItemPointer htids, int nhtids);
 static void _bt_uppershutdown(BTWriteState *wstate, BTPageState *state);
 static void _bt_load(BTWriteState *wstate,
 		 BTSpool *btspool, BTSpool *btspool2);
@@ -508,6 +510,7 @@ _bt_buildadd(BTWriteState *wstate, BTPageState *state, IndexTuple itup)
 		ItemId		ii;
 		ItemId		hii;
 		IndexTuple	oitup;
+		IndexTuple	newminkey;
 
 		/* Create new page of same level */
 		npage = _bt_blnewpage(state->btps_level);
@@ -528,12 +531,34 @@ _bt_buildadd(BTWriteState *wstate, BTPageState *state, IndexTuple itup)
 		_bt_sortaddtup(npage, ItemIdGetLength(ii), oitup, P_FIRSTKEY);
 
 		/*
-		 * Move 'last' into the high key position on opage
+		 * Save a copy of the minimum key for the new page.  We have to copy
+		 * it off the old page, not the new one, in case we are not at leaf
+		 * level.  A posting list tuple contributes just its key.
 		 */
-		hii = PageGetItemId(opage, P_HIKEY);
-		*hii = *ii;
-		ItemIdSetUnused(ii);	/* redundant */
-		((PageHeader) opage)->pd_lower -= sizeof(ItemIdData);
+		newminkey = _bt_keytuple(oitup);
+
+		if (BTreeTupleIsPosting(oitup))
+		{
+			/*
+			 * The high key must not carry the posting list, so replace
+			 * 'last' on opage by its key in the high key position.
+			 */
+			PageIndexTupleDelete(opage, last_off);
+			if (PageAddItem(opage, (Item) newminkey,
+							IndexTupleSize(newminkey), P_HIKEY,
+							true, false) == InvalidOffsetNumber)
+				elog(ERROR, "failed to add high key to the index page");
+		}
+		else
+		{
+			/*
+			 * Move 'last' into the high key position on opage
+			 */
+			hii = PageGetItemId(opage, P_HIKEY);
+			*hii = *ii;
+			ItemIdSetUnused(ii);	/* redundant */
+			((PageHeader) opage)->pd_lower -= sizeof(ItemIdData);
+		}
 
 		/*
 		 * Link the old page into its parent, using its minimum key. If we
@@ -548,12 +573,7 @@ _bt_buildadd(BTWriteState *wstate, BTPageState *state, IndexTuple itup)
 		_bt_buildadd(wstate, state->btps_next, state->btps_minkey);
 		pfree(state->btps_minkey);
 
-		/*
-		 * Save a copy of the minimum key for the new page.  We have to copy
-		 * it off the old page, not the new one, in case we are not at leaf
-		 * level.
-		 */
-		state->btps_minkey = CopyIndexTuple(oitup);
+		state->btps_minkey = newminkey;
 
 		/*
 		 * Set the sibling links for both pages.
@@ -588,7 +608,7 @@ _bt_buildadd(BTWriteState *wstate, BTPageState *state, IndexTuple itup)
 	if (last_off == P_HIKEY)
 	{
 		Assert(state->btps_minkey == NULL);
-		state->btps_minkey = CopyIndexTuple(itup);
+		state->btps_minkey = _bt_keytuple(itup);
 	}
 
 	/*
@@ -667,6 +687,27 @@ _bt_uppershutdown(BTWriteState *wstate, BTPageState *state)
 	_bt_blwritepage(wstate, metapage, BTREE_METAPAGE);
 }
 
+/*
+ * Add the leaf tuple for a run of equal keys with the given heap TIDs:
+ * a posting list tuple, or base itself if there is only one.
+ */
+static void
+_bt_buildadd_posting(BTWriteState *wstate, BTPageState *state,
+					 IndexTuple base, ItemPointer htids, int nhtids)
+{
+	IndexTuple	posting;
+
+	if (nhtids == 1)
+	{
+		_bt_buildadd(wstate, state, base);
+		return;
+	}
+
+	posting = _bt_form_posting(base, htids, nhtids);
+	_bt_buildadd(wstate, state, posting);
+	pfree(posting);
+}
+
 /*
  * Read tuples in correct sort order from tuplesort, and load them into
  * btree leaves.
@@ -784,6 +825,61 @@ _bt_load(BTWriteState *wstate, BTSpool *btspool, BTSpool *btspool2)
 		}
 		_bt_freeskey(indexScanKey);
 	}
+	else if (_bt_dedup_enabled(wstate->index))
+	{
+		/*
+		 * Merge each run of equal keys into posting list tuples as we go.
+		 * base is the first tuple of the pending run, and htids collects
+		 * the heap TIDs of the run.
+		 */
+		IndexTuple	base = NULL;
+		ItemPointer htids;
+		int			nhtids = 0;
+		Size		maxpostingsize = 0;
+
+		htids = (ItemPointer) palloc(MaxTIDsPerBTreePage *
+									 sizeof(ItemPointerData));
+
+		while ((itup = tuplesort_getindextuple(btspool->sortstate,
+											   true, &should_free)) != NULL)
+		{
+			/* When we see first tuple, create first index page */
+			if (state == NULL)
+			{
+				state = _bt_pagestate(wstate, 0);
+				maxpostingsize = BTMaxPostingSize(state->btps_page);
+			}
+
+			if (base != NULL &&
+				_bt_dedup_mergeable(base, itup) &&
+				MAXALIGN(IndexTupleSize(base) +
+						 (nhtids + 1) * sizeof(ItemPointerData)) <= maxpostingsize)
+			{
+				htids[nhtids++] = itup->t_tid;
+			}
+			else
+			{
+				if (base != NULL)
+				{
+					_bt_buildadd_posting(wstate, state, base, htids, nhtids);
+					pfree(base);
+				}
+				base = CopyIndexTuple(itup);
+				htids[0] = itup->t_tid;
+				nhtids = 1;
+			}
+
+			if (should_free)
+				pfree(itup);
+		}
+
+		if (base != NULL)
+		{
+			_bt_buildadd_posting(wstate, state, base, htids, nhtids);
+			pfree(base);
+		}
+		pfree(htids);
+	}
 	else
 	{
 		/* merge is unnecessary */
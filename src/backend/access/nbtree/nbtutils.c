@@ -49,6 +49,8 @@ static void _bt_mark_scankey_required(ScanKey skey);
 static bool _bt_check_rowcompare(ScanKey skey,
 					 IndexTuple tuple, TupleDesc tupdesc,
 					 ScanDirection dir, bool *continuescan);
+static bool _bt_posting_killed(BTScanOpaque so, bool *killed, int itemIndex,
+				   IndexTuple ituple);
 
 
 /*
@@ -1695,6 +1697,42 @@ _bt_check_rowcompare(ScanKey skey, IndexTuple tuple, TupleDesc tupdesc,
 	return result;
 }
 
+/*
+ * _bt_posting_killed - were all heap TIDs of posting list tuple ituple killed?
+ *
+ * itemIndex is a killed item the scan read from the same index offset as
+ * ituple; the run of items around it with that offset is what the scan saw
+ * of the tuple.
+ */
+static bool
+_bt_posting_killed(BTScanOpaque so, bool *killed, int itemIndex,
+				   IndexTuple ituple)
+{
+	OffsetNumber indexOffset = so->currPos.items[itemIndex].indexOffset;
+	ItemPointer htids = BTreeTupleGetPosting(ituple);
+	int			nhtids = BTreeTupleGetNPosting(ituple);
+	int			first = itemIndex;
+	int			j;
+
+	while (first > so->currPos.firstItem &&
+		   so->currPos.items[first - 1].indexOffset == indexOffset)
+		first--;
+
+	if (first + nhtids - 1 > so->currPos.lastItem)
+		return false;
+
+	for (j = 0; j < nhtids; j++)
+	{
+		BTScanPosItem *item = &so->currPos.items[first + j];
+
+		if (item->indexOffset != indexOffset || !killed[first + j] ||
+			!ItemPointerEquals(&item->heapTid, &htids[j]))
+			return false;
+	}
+
+	return true;
+}
+
 /*
  * _bt_killitems - set LP_DEAD state for items an indexscan caller has
  * told us were killed
@@ -1717,6 +1755,10 @@ _bt_check_rowcompare(ScanKey skey, IndexTuple tuple, TupleDesc tupdesc,
  * (This observation also guarantees that the item is still the right one
  * to delete, which might otherwise be questionable since heap TIDs can get
  * recycled.)
+ *
+ * A posting list tuple is only marked dead if all of its heap TIDs were
+ * killed.  Its TIDs were saved as adjacent items sharing one indexOffset, in
+ * posting list order, so we can check that against the killed items.
  */
 void
 _bt_killitems(IndexScanDesc scan, bool haveLock)
@@ -1728,6 +1770,7 @@ _bt_killitems(IndexScanDesc scan, bool haveLock)
 	OffsetNumber maxoff;
 	int			i;
 	bool		killedsomething = false;
+	bool	   *killed;
 
 	Assert(BufferIsValid(so->currPos.buf));
 
@@ -1739,6 +1782,10 @@ _bt_killitems(IndexScanDesc scan, bool haveLock)
 	minoff = P_FIRSTDATAKEY(opaque);
 	maxoff = PageGetMaxOffsetNumber(page);
 
+	killed = (bool *) palloc0(MaxTIDsPerBTreePage * sizeof(bool));
+	for (i = 0; i < so->numKilled; i++)
+		killed[so->killedItems[i]] = true;
+
 	for (i = 0; i < so->numKilled; i++)
 	{
 		int			itemIndex = so->killedItems[i];
@@ -1754,7 +1801,16 @@ _bt_killitems(IndexScanDesc scan, bool haveLock)
 			ItemId		iid = PageGetItemId(page, offnum);
 			IndexTuple	ituple = (IndexTuple) PageGetItem(page, iid);
 
-			if (ItemPointerEquals(&ituple->t_tid, &kitem->heapTid))
+			if (BTreeTupleIsPosting(ituple))
+			{
+				if (_bt_posting_killed(so, killed, itemIndex, ituple))
+				{
+					ItemIdMarkDead(iid);
+					killedsomething = true;
+					break;		/* out of inner search loop */
+				}
+			}
+			else if (ItemPointerEquals(&ituple->t_tid, &kitem->heapTid))
 			{
 				/* found the item */
 				ItemIdMarkDead(iid);
@@ -1777,6 +1833,8 @@ _bt_killitems(IndexScanDesc scan, bool haveLock)
 		MarkBufferDirtyHint(so->currPos.buf, true);
 	}
 
+	pfree(killed);
+
 	if (!haveLock)
 		LockBuffer(so->currPos.buf, BUFFER_LOCK_UNLOCK);
 
@@ -2003,10 +2061,27 @@ btoptions(PG_FUNCTION_ARGS)
 {
 	Datum		reloptions = PG_GETARG_DATUM(0);
 	bool		validate = PG_GETARG_BOOL(1);
-	bytea	   *result;
+	relopt_value *options;
+	BTOptions  *rdopts;
+	int			numoptions;
+	static const relopt_parse_elt tab[] = {
+		{"fillfactor", RELOPT_TYPE_INT, offsetof(BTOptions, fillfactor)},
+		{"deduplicate_items", RELOPT_TYPE_BOOL, offsetof(BTOptions, deduplicate_items)}
+	};
+
+	options = parseRelOptions(reloptions, validate, RELOPT_KIND_BTREE,
+							  &numoptions);
+
+	/* if none set, we're done */
+	if (numoptions == 0)
+		PG_RETURN_NULL();
+
+	rdopts = allocateReloptStruct(sizeof(BTOptions), options, numoptions);
+
+	fillRelOptions((void *) rdopts, sizeof(BTOptions), options, numoptions,
+				   validate, tab, lengthof(tab));
+
+	pfree(options);
 
-	result = default_reloptions(reloptions, validate, RELOPT_KIND_BTREE);
-	if (result)
-		PG_RETURN_BYTEA_P(result);
-	PG_RETURN_NULL();
+	PG_RETURN_BYTEA_P(rdopts);
 }
@@ -278,6 +278,7 @@ btree_xlog_split(bool onleft, bool isroot,
 	Size		newitemsz = 0;
 	Item		left_hikey = NULL;
 	Size		left_hikeysz = 0;
+	IndexTuple	left_hikey_copy = NULL;
 
 	datapos = (char *) xlrec + SizeOfBtreeSplit;
 	datalen = record->xl_len - SizeOfBtreeSplit;
@@ -350,9 +351,20 @@ btree_xlog_split(bool onleft, bool isroot,
 	if (xlrec->level == 0)
 	{
 		ItemId		hiItemId = PageGetItemId(rpage, P_FIRSTDATAKEY(ropaque));
+		IndexTuple	firstright = (IndexTuple) PageGetItem(rpage, hiItemId);
 
-		left_hikey = PageGetItem(rpage, hiItemId);
-		left_hikeysz = ItemIdGetLength(hiItemId);
+		/* but not its posting list, if it has one */
+		if (BTreeTupleIsPosting(firstright))
+		{
+			left_hikey_copy = _bt_keytuple(firstright);
+			left_hikey = (Item) left_hikey_copy;
+			left_hikeysz = MAXALIGN(IndexTupleSize(left_hikey_copy));
+		}
+		else
+		{
+			left_hikey = (Item) firstright;
+			left_hikeysz = ItemIdGetLength(hiItemId);
+		}
 	}
 
 	PageSetLSN(rpage, lsn);
@@ -436,6 +448,8 @@ btree_xlog_split(bool onleft, bool isroot,
 
 	/* We no longer need the right buffer */
 	UnlockReleaseBuffer(rbuf);
+	if (left_hikey_copy)
+		pfree(left_hikey_copy);
 
 	/*
 	 * Fix left-link of the page to the right of the new right sibling.
@@ -560,13 +574,33 @@ btree_xlog_vacuum(XLogRecPtr lsn, XLogRecord *record)
 	if (record->xl_len > SizeOfBtreeVacuum)
 	{
 		OffsetNumber *unused;
-		OffsetNumber *unend;
+		OffsetNumber *updated;
+		char	   *tuples;
+		int			i;
 
 		unused = (OffsetNumber *) ((char *) xlrec + SizeOfBtreeVacuum);
-		unend = (OffsetNumber *) ((char *) xlrec + record->xl_len);
+		updated = unused + xlrec->ndeleted;
+		tuples = (char *) (updated + xlrec->nupdated);
 
-		if ((unend - unused) > 0)
-			PageIndexMultiDelete(page, unused, unend - unused);
+		/* replace the updated posting list tuples first, as on the primary */
+		for (i = 0; i < xlrec->nupdated; i++)
+		{
+			IndexTupleData hdr;
+			Size		itemsz;
+
+			/* the tuples are not necessarily aligned in the record */
+			memcpy(&hdr, tuples, sizeof(IndexTupleData));
+			itemsz = IndexTupleSize(&hdr);
+
+			PageIndexTupleDelete(page, updated[i]);
+			if (PageAddItem(page, (Item) tuples, itemsz, updated[i],
+							false, false) == InvalidOffsetNumber)
+				elog(PANIC, "btree_xlog_vacuum: failed to add item");
+			tuples += itemsz;
+		}
+
+		if (xlrec->ndeleted > 0)
+			PageIndexMultiDelete(page, unused, xlrec->ndeleted);
 	}
 
 	/*
@@ -607,7 +641,10 @@ btree_xlog_delete_get_latestRemovedXid(xl_btree_delete *xlrec)
 	BlockNumber hblkno;
 	OffsetNumber hoffnum;
 	TransactionId latestRemovedXid = InvalidTransactionId;
-	int			i;
+	ItemPointer htids;
+	int			nhtids;
+	int			i,
+				j;
 
 	/*
 	 * If there's nothing running on the standby we don't need to derive a
@@ -659,61 +696,81 @@ btree_xlog_delete_get_latestRemovedXid(xl_btree_delete *xlrec)
 		itup = (IndexTuple) PageGetItem(ipage, iitemid);
 
 		/*
-		 * Locate the heap page that the index tuple points at
+		 * A posting list tuple points at several heap tuples; look at each.
 		 */
-		hblkno = ItemPointerGetBlockNumber(&(itup->t_tid));
-		hbuffer = XLogReadBuffer(xlrec->hnode, hblkno, false);
-		if (!BufferIsValid(hbuffer))
+		if (BTreeTupleIsPosting(itup))
 		{
-			UnlockReleaseBuffer(ibuffer);
-			return InvalidTransactionId;
+			htids = BTreeTupleGetPosting(itup);
+			nhtids = BTreeTupleGetNPosting(itup);
 		}
-		hpage = (Page) BufferGetPage(hbuffer);
-
-		/*
-		 * Look up the heap tuple header that the index tuple points at by
-		 * using the heap node supplied with the xlrec. We can't use
-		 * heap_fetch, since it uses ReadBuffer rather than XLogReadBuffer.
-		 * Note that we are not looking at tuple data here, just headers.
-		 */
-		hoffnum = ItemPointerGetOffsetNumber(&(itup->t_tid));
-		hitemid = PageGetItemId(hpage, hoffnum);
-
-		/*
-		 * Follow any redirections until we find something useful.
-		 */
-		while (ItemIdIsRedirected(hitemid))
+		else
 		{
-			hoffnum = ItemIdGetRedirect(hitemid);
-			hitemid = PageGetItemId(hpage, hoffnum);
-			CHECK_FOR_INTERRUPTS();
+			htids = &(itup->t_tid);
+			nhtids = 1;
 		}
 
-		/*
-		 * If the heap item has storage, then read the header and use that to
-		 * set latestRemovedXid.
-		 *
-		 * Some LP_DEAD items may not be accessible, so we ignore them.
-		 */
-		if (ItemIdHasStorage(hitemid))
+		for (j = 0; j < nhtids; j++)
 		{
-			htuphdr = (HeapTupleHeader) PageGetItem(hpage, hitemid);
+			ItemPointer htid = &htids[j];
 
-			HeapTupleHeaderAdvanceLatestRemovedXid(htuphdr, &latestRemovedXid);
-		}
-		else if (ItemIdIsDead(hitemid))
-		{
 			/*
-			 * Conjecture: if hitemid is dead then it had xids before the xids
-			 * marked on LP_NORMAL items. So we just ignore this item and move
-			 * onto the next, for the purposes of calculating
-			 * latestRemovedxids.
+			 * Locate the heap page that the index tuple points at
 			 */
-		}
-		else
-			Assert(!ItemIdIsUsed(hitemid));
+			hblkno = ItemPointerGetBlockNumber(htid);
+			hbuffer = XLogReadBuffer(xlrec->hnode, hblkno, false);
+			if (!BufferIsValid(hbuffer))
+			{
+				UnlockReleaseBuffer(ibuffer);
+				return InvalidTransactionId;
+			}
+			hpage = (Page) BufferGetPage(hbuffer);
+
+			/*
+			 * Look up the heap tuple header that the index tuple points at
+			 * by using the heap node supplied with the xlrec. We can't use
+			 * heap_fetch, since it uses ReadBuffer rather than
+			 * XLogReadBuffer. Note that we are not looking at tuple data
+			 * here, just headers.
+			 */
+			hoffnum = ItemPointerGetOffsetNumber(htid);
+			hitemid = PageGetItemId(hpage, hoffnum);
+
+			/*
+			 * Follow any redirections until we find something useful.
+			 */
+			while (ItemIdIsRedirected(hitemid))
+			{
+				hoffnum = ItemIdGetRedirect(hitemid);
+				hitemid = PageGetItemId(hpage, hoffnum);
+				CHECK_FOR_INTERRUPTS();
+			}
+
+			/*
+			 * If the heap item has storage, then read the header and use that
+			 * to set latestRemovedXid.
+			 *
+			 * Some LP_DEAD items may not be accessible, so we ignore them.
+			 */
+			if (ItemIdHasStorage(hitemid))
+			{
+				htuphdr = (HeapTupleHeader) PageGetItem(hpage, hitemid);
 
-		UnlockReleaseBuffer(hbuffer);
+				HeapTupleHeaderAdvanceLatestRemovedXid(htuphdr, &latestRemovedXid);
+			}
+			else if (ItemIdIsDead(hitemid))
+			{
+				/*
+				 * Conjecture: if hitemid is dead then it had xids before the
+				 * xids marked on LP_NORMAL items. So we just ignore this item
+				 * and move onto the next, for the purposes of calculating
+				 * latestRemovedxids.
+				 */
+			}
+			else
+				Assert(!ItemIdIsUsed(hitemid));
+
+			UnlockReleaseBuffer(hbuffer);
+		}
 	}
 
 	UnlockReleaseBuffer(ibuffer);
@@ -1037,6 +1094,42 @@ btree_xlog_reuse_page(XLogRecPtr lsn, XLogRecord *record)
 	Assert(!(record->xl_info & XLR_BKP_BLOCK_MASK));
 }
 
+static void
+btree_xlog_dedup(XLogRecPtr lsn, XLogRecord *record)
+{
+	xl_btree_dedup *xlrec = (xl_btree_dedup *) XLogRecGetData(record);
+	xl_btree_dedup_interval *intervals;
+	Buffer		buffer;
+	Page		page;
+	Page		newpage;
+
+	/* If we have a full-page image, restore it and we're done */
+	if (record->xl_info & XLR_BKP_BLOCK(0))
+	{
+		(void) RestoreBackupBlock(lsn, record, 0, false, false);
+		return;
+	}
+
+	buffer = XLogReadBuffer(xlrec->node, xlrec->block, false);
+	if (!BufferIsValid(buffer))
+		return;
+	page = (Page) BufferGetPage(buffer);
+
+	if (lsn <= PageGetLSN(page))
+	{
+		UnlockReleaseBuffer(buffer);
+		return;
+	}
+
+	intervals = (xl_btree_dedup_interval *) ((char *) xlrec + SizeOfBtreeDedup);
+	newpage = _bt_dedup_apply(page, intervals, xlrec->nintervals);
+	PageRestoreTempPage(newpage, page);
+
+	PageSetLSN(page, lsn);
+	MarkBufferDirty(buffer);
+	UnlockReleaseBuffer(buffer);
+}
+
 
 void
 btree_redo(XLogRecPtr lsn, XLogRecord *record)
@@ -1083,6 +1176,9 @@ btree_redo(XLogRecPtr lsn, XLogRecord *record)
 		case XLOG_BTREE_REUSE_PAGE:
 			btree_xlog_reuse_page(lsn, record);
 			break;
+		case XLOG_BTREE_DEDUP:
+			btree_xlog_dedup(lsn, record);
+			break;
 		default:
 			elog(PANIC, "btree_redo: unknown op code %u", info);
 	}
@@ -0,0 +1,101 @@
+/*-------------------------------------------------------------------------
+ *
+ * brindesc.c
+ *	  rmgr descriptor routines for access/brin/brinxlog.c
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/access/rmgrdesc/brindesc.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/brin_private.h"
+
+static void
+out_target(StringInfo buf, RelFileNode node)
+{
+	appendStringInfo(buf, "rel %u/%u/%u",
+					 node.spcNode, node.dbNode, node.relNode);
+}
+
+void
+brin_desc(StringInfo buf, uint8 xl_info, char *rec)
+{
+	uint8		info = xl_info & ~XLR_INFO_MASK;
+
+	switch (info & XLOG_BRIN_OPMASK)
+	{
+		case XLOG_BRIN_CREATE_INDEX:
+			{
+				xl_brin_createidx *xlrec = (xl_brin_createidx *) rec;
+
+				appendStringInfoString(buf, "create index: ");
+				out_target(buf, xlrec->node);
+				appendStringInfo(buf, " v%d pagesPerRange %u",
+								 xlrec->version, xlrec->pagesPerRange);
+			}
+			break;
+		case XLOG_BRIN_INSERT:
+			{
+				xl_brin_insert *xlrec = (xl_brin_insert *) rec;
+
+				appendStringInfoString(buf, "insert");
+				if (info & XLOG_BRIN_INIT_PAGE)
+					appendStringInfoString(buf, "(init)");
+				appendStringInfoString(buf, ": ");
+				out_target(buf, xlrec->node);
+				appendStringInfo(buf, " heapBlk %u revmapBlk %u pagesPerRange %u TID (%u,%u)",
+								 xlrec->heapBlk, xlrec->revmapBlk,
+								 xlrec->pagesPerRange,
+								 ItemPointerGetBlockNumber(&xlrec->tid),
+								 ItemPointerGetOffsetNumber(&xlrec->tid));
+			}
+			break;
+		case XLOG_BRIN_UPDATE:
+			{
+				xl_brin_update *xlrec = (xl_brin_update *) rec;
+
+				appendStringInfoString(buf, "update");
+				if (info & XLOG_BRIN_INIT_PAGE)
+					appendStringInfoString(buf, "(init)");
+				appendStringInfoString(buf, ": ");
+				out_target(buf, xlrec->new.node);
+				appendStringInfo(buf, " heapBlk %u revmapBlk %u pagesPerRange %u old TID (%u,%u) TID (%u,%u)",
+								 xlrec->new.heapBlk, xlrec->new.revmapBlk,
+								 xlrec->new.pagesPerRange,
+								 ItemPointerGetBlockNumber(&xlrec->oldtid),
+								 ItemPointerGetOffsetNumber(&xlrec->oldtid),
+								 ItemPointerGetBlockNumber(&xlrec->new.tid),
+								 ItemPointerGetOffsetNumber(&xlrec->new.tid));
+			}
+			break;
+		case XLOG_BRIN_SAMEPAGE_UPDATE:
+			{
+				xl_brin_samepage_update *xlrec = (xl_brin_samepage_update *) rec;
+
+				appendStringInfoString(buf, "samepage_update: ");
+				out_target(buf, xlrec->node);
+				appendStringInfo(buf, " TID (%u,%u)",
+								 ItemPointerGetBlockNumber(&xlrec->tid),
+								 ItemPointerGetOffsetNumber(&xlrec->tid));
+			}
+			break;
+		case XLOG_BRIN_REVMAP_EXTEND:
+			{
+				xl_brin_revmap_extend *xlrec = (xl_brin_revmap_extend *) rec;
+
+				appendStringInfoString(buf, "revmap extend: ");
+				out_target(buf, xlrec->node);
+				appendStringInfo(buf, " targetBlk %u", xlrec->targetBlk);
+			}
+			break;
+		default:
+			appendStringInfo(buf, "UNKNOWN");
+			break;
+	}
+}
@@ -14,15 +14,18 @@
 #include "libpq/pqformat.h"
 #include "libpq/pqsignal.h"
 #include "miscadmin.h"
+#include "pg_trace.h"
 #include "pgxc/pgxc.h"
 #include "storage/fd.h"
 #include "storage/ipc.h"
+#include "storage/latch.h"
 #include "storage/pmsignal.h"
 #include "tcop/tcopprot.h"
 #include "utils/hsearch.h"
 #include "utils/memutils.h"
 #include "utils/syscache.h"
 #include "utils/tqual.h"
+#include "utils/waitevent.h"
 
 #include <unistd.h>
 #include <sys/stat.h>
@@ -43,6 +46,7 @@
 #define RETRY_TIME			1	/* 1 second */
 #define INVALID_INDEX		((Index)-1)
 #define MAX_RXACT_BUF_SIZE	4096
+#define MAX_RXACT_WAIT_EVENTS	64	/* events handled by one RxactLoop round */
 #if defined(EAGAIN) && EAGAIN != EINTR
 #define IS_ERR_INTR() (errno == EINTR || errno == EAGAIN)
 #else
@@ -63,6 +67,9 @@ typedef struct RxactAgent
 	Oid		dboid;
 	bool	in_error;
 	bool	waiting_gid;
+	bool	waiting_flush;	/* out_buf is held until rxact log is flushed */
+	int		wait_pos;		/* position of sock in rxact_wait_set */
+	uint32	wait_events;	/* what rxact_wait_set waits on sock for */
 	char	last_gid[NAMEDATALEN];
 	StringInfoData out_buf;
 	StringInfoData in_buf;
@@ -96,6 +103,9 @@ typedef struct NodeConn
 						 * when conn == NULL: next connect time */
 	PostgresPollingStatusType
 			status;
+	pgsocket wait_sock;	/* socket in rxact_wait_set, PGINVALID_SOCKET for none */
+	int wait_pos;
+	uint32 wait_events;
 	char doing_gid[NAMEDATALEN];
 }NodeConn;
 
@@ -117,10 +127,18 @@ static const char rxlf_db_node_filename[] = {"db_node"};
 static const char rxlf_xact_filename[] = {"rxact"};
 static const char rxlf_directory[] = {"pg_rxlog"};
 static StringInfoData rxlf_xlog_buf = {NULL, 0, 0, 0};
+/* end of the rxact log records to flush before answering the agents */
+static XLogRecPtr rxlf_flush_lsn = InvalidXLogRecPtr;
 #define MAX_RLOG_FILE_NAME 24
 
 static pgsocket rxact_server_fd = PGINVALID_SOCKET;
+/* listen socket, agents and remote connections RxactLoop waits on */
+static WaitEventSet *rxact_wait_set = NULL;
 static RxactAgent *allRxactAgent = NULL;
+/* is user_data of an event of rxact_wait_set an agent, or a NodeConn? */
+#define IS_RXACT_AGENT(p) \
+	((void*)(p) >= (void*)allRxactAgent \
+	 && (void*)(p) < (void*)(allRxactAgent + MaxRxactAgent))
 static Index *indexRxactAgent = NULL;
 static int MaxRxactAgent;
 static volatile unsigned int agentCount = 0;
@@ -154,6 +172,8 @@ static void rxact_agent_output(RxactAgent *agent);
 static void rxact_agent_destroy(RxactAgent *agent);
 static void rxact_agent_end_msg(RxactAgent *agent, StringInfo msg);
 static void rxact_agent_simple_msg(RxactAgent *agent, char msg_type);
+static bool rxact_agent_hold_output(RxactAgent *agent);
+static void rxact_flush_agents(void);
 
 /* parse message from backend */
 static void rxact_agent_connect(RxactAgent *agent, StringInfo msg);
@@ -185,6 +205,8 @@ static void rxact_2pc_result(NodeConn *conn);
 static NodeConn* rxact_get_node_conn(Oid db_oid, Oid node_oid, time_t cur_time);
 static bool rxact_check_node_conn(NodeConn *conn);
 static void rxact_finish_node_conn(NodeConn *conn);
+static void rxact_node_conn_wait(NodeConn *conn, uint32 events);
+static void rxact_node_conn_unwait(NodeConn *conn);
 static void rxact_build_2pc_cmd(StringInfo cmd, const char *gid, RemoteXactType type);
 static void rxact_close_timeout_remote_conn(time_t cur_time);
 static File rxact_log_open_file(const char *log_name, int fileFlags, int fileMode);
@@ -210,6 +232,7 @@ CreateRxactAgent(pgsocket agent_fd)
 	{
 		closesocket(agent_fd);
 		ereport(WARNING, (errmsg("too many connect for RXACT")));
+		return;
 	}
 
 	agent = NULL;
@@ -230,7 +253,10 @@ CreateRxactAgent(pgsocket agent_fd)
 
 	agent->sock = agent_fd;
 	pg_set_noblock(agent_fd);
-	agent->in_error = agent->waiting_gid = false;
+	agent->in_error = agent->waiting_gid = agent->waiting_flush = false;
+	agent->wait_events = WL_SOCKET_READABLE;
+	agent->wait_pos = AddWaitEventToSet(rxact_wait_set, agent->wait_events,
+										agent_fd, NULL, agent);
 	indexRxactAgent[agentCount++] = agent->index;
 	resetStringInfo(&(agent->in_buf));
 	resetStringInfo(&(agent->out_buf));
@@ -247,16 +273,14 @@ static void RxactLoop(void)
 {
 	sigjmp_buf			local_sigjmp_buf;
 	RxactAgent 			*agent;
-	struct pollfd		*pollfds, *tmpfd;
+	WaitSetEvent			*occurred;
 	StringInfoData		message;
 	time_t				last_time,cur_time;
 	NodeConn			*pconn;
 	HASH_SEQ_STATUS		seq_status;
-	unsigned int		i, count;
+	unsigned int		i;
 	Index 				index;
 	pgsocket			agent_fd;
-	int					poll_count;
-	int					max_pool;
 
 	Assert(rxact_server_fd != PGINVALID_SOCKET);
 	if(pg_set_noblock(rxact_server_fd) == false)
@@ -264,10 +288,14 @@ static void RxactLoop(void)
 
 	MemoryContextSwitchTo(TopMemoryContext);
 
-	max_pool = MaxRxactAgent+1;
-	pollfds = palloc(sizeof(pollfds[0]) * max_pool);
-	pollfds[0].fd = rxact_server_fd;
-	pollfds[0].events = POLLIN;
+	/*
+	 * The sockets are registered once, agents are added and removed along
+	 * with their connections and the remote connections as they come and go.
+	 */
+	rxact_wait_set = CreateWaitEventSet(TopMemoryContext, MaxRxactAgent+1);
+	AddWaitEventToSet(rxact_wait_set, WL_SOCKET_READABLE, rxact_server_fd,
+					  NULL, NULL);
+	occurred = palloc(sizeof(occurred[0]) * MAX_RXACT_WAIT_EVENTS);
 	initStringInfo(&message);
 
 	if(sigsetjmp(local_sigjmp_buf, 1) != 0)
@@ -283,7 +311,9 @@ static void RxactLoop(void)
 	last_time = cur_time = time(NULL);
 	for (;;)
 	{
-		int		pollres;
+		int		nevents;
+		bool	accept_new;
+		uint32	events;
 
 		MemoryContextResetAndDeleteChildren(MessageContext);
 
@@ -310,18 +340,23 @@ static void RxactLoop(void)
 				}
 			}
 
-			pollfds[i+1].fd = agent->sock;
+			/*
+			 * An agent waiting for a gid keeps being waited on for reading,
+			 * to see it hang up; anything else it sends is an error.
+			 */
 			if(agent->out_buf.len > agent->out_buf.cursor)
-				pollfds[i+1].events = POLLOUT;
-			else if(agent->waiting_gid == false)
-				pollfds[i+1].events = POLLIN;
+				events = WL_SOCKET_WRITEABLE;
 			else
-				pollfds[i+1].events = 0;
+				events = WL_SOCKET_READABLE;
+			if(agent->wait_events != events)
+			{
+				ModifyWaitEvent(rxact_wait_set, agent->wait_pos, events);
+				agent->wait_events = events;
+			}
 		}
 
-		/* append node sockets */
+		/* update node sockets */
 		hash_seq_init(&seq_status, htab_node_conn);
-		poll_count = agentCount+1;
 		while((pconn = hash_seq_search(&seq_status)) != NULL)
 		{
 			bool wait_write;
@@ -341,7 +376,10 @@ static void RxactLoop(void)
 				continue;
 			case PGRES_POLLING_OK:
 				if(pconn->doing_gid[0] == '\0')
+				{
+					rxact_node_conn_wait(pconn, 0);
 					continue;
+				}
 				wait_write = false;
 				break;
 			case PGRES_POLLING_WRITING:
@@ -354,21 +392,10 @@ static void RxactLoop(void)
 				Assert(0);
 			}
 
-			if(poll_count >= max_pool)
-			{
-				START_CRIT_SECTION();
-				max_pool += 16;
-				pollfds = repalloc(pollfds, max_pool*sizeof(pollfds[0]));
-				END_CRIT_SECTION();
-			}
-			pollfds[poll_count].fd = PQsocket(pconn->conn);
-			Assert(pollfds[poll_count].fd != PGINVALID_SOCKET);
-			pollfds[poll_count].events = wait_write ? POLLOUT:POLLIN;
-			pollfds[poll_count].revents = 0;
-			++poll_count;
+			rxact_node_conn_wait(pconn,
+				wait_write ? WL_SOCKET_WRITEABLE : WL_SOCKET_READABLE);
 		}
 
-re_poll_:
 		if(got_SIGHUP)
 		{
 			DbAndNodeOid key;
@@ -388,41 +415,52 @@ re_poll_:
 			}
 		}
 		/* for we wait 1 second */
-		pollres = poll(pollfds, poll_count, 1000);
+		nevents = WaitEventSetWait(rxact_wait_set, 1000L, occurred,
+								   MAX_RXACT_WAIT_EVENTS);
 		CHECK_FOR_INTERRUPTS();
 
-		if (pollres < 0)
-		{
-			if(IS_ERR_INTR())
-				goto re_poll_;
-			ereport(PANIC, (errcode_for_socket_access(),
-				errmsg("pool failed(%d) in pooler process, error %m", pollres)));
-		} /*else if (pollres == 0)*/
+		accept_new = false;
+		for(i=0;i<(unsigned int)nevents;++i)
 		{
-			/* timeout do nothing */
-		}
+			WaitSetEvent *event = &occurred[i];
 
-		count = 0;
-		for(i=agentCount+1;i < poll_count && count < (unsigned int)pollres;++i)
-		{
-			tmpfd = &pollfds[i];
-			if(tmpfd->revents == 0)
+			if(event->user_data == NULL)
+			{
+				/* listen socket, accept once all the others are done */
+				accept_new = true;
 				continue;
+			}
 
-			hash_seq_init(&seq_status, htab_node_conn);
-			while((pconn = hash_seq_search(&seq_status)) != NULL)
+			if(IS_RXACT_AGENT(event->user_data))
 			{
-				if(tmpfd->fd != PQsocket(pconn->conn))
+				agent = event->user_data;
+				/* destroyed by an earlier event of this round? */
+				if(agent->index == INVALID_INDEX || agent->sock != event->fd)
 					continue;
 
-				++count;
-				hash_seq_term(&seq_status);
-				break;
+				if(event->events & WL_SOCKET_WRITEABLE)
+				{
+					Assert(agent->out_buf.len > agent->out_buf.cursor);
+					rxact_agent_output(agent);
+				}else if(agent->waiting_gid)
+				{
+					rxact_agent_destroy(agent);
+				}else
+				{
+					rxact_agent_input(agent);
+				}
+				continue;
 			}
-			Assert(pconn != NULL);
+
+			pconn = event->user_data;
+			/* finished by an earlier event of this round? */
+			if(pconn->wait_sock != event->fd || pconn->conn == NULL)
+				continue;
 
 			if(pconn->status != PGRES_POLLING_OK)
 			{
+				/* PQconnectPoll may close the socket to try another address */
+				rxact_node_conn_unwait(pconn);
 				pconn->status = PQconnectPoll(pconn->conn);
 				if(pconn->status == PGRES_POLLING_FAILED)
 					rxact_finish_node_conn(pconn);
@@ -433,38 +471,8 @@ re_poll_:
 			}
 		}
 
-		for(i=agentCount;i && count < (unsigned int)pollres;)
-		{
-			tmpfd = &pollfds[i];
-			--i;
-			if(tmpfd->revents == 0)
-				continue;
-
-			index = indexRxactAgent[i];
-			Assert(index >= 0 && index < (Index)MaxRxactAgent);
-			agent = &allRxactAgent[index];
-			Assert(agent->index == index);
-			Assert(agent->sock != PGINVALID_SOCKET && agent->sock == tmpfd->fd);
-			++count;
-			if(tmpfd->revents & POLLOUT)
-			{
-				Assert(agent->out_buf.len > agent->out_buf.cursor);
-				rxact_agent_output(agent);
-			}else if(tmpfd->revents & (POLLIN | POLLERR | POLLHUP))
-			{
-				if(agent->waiting_gid)
-				{
-					Assert((tmpfd->events & POLLIN) == 0);
-					rxact_agent_destroy(agent);
-				}else
-				{
-					rxact_agent_input(agent);
-				}
-			}
-		}
-
 		/* Get a new connection */
-		if (pollfds[0].revents & POLLIN)
+		if (accept_new)
 		{
 			for(;;)
 			{
@@ -482,6 +490,9 @@ re_poll_:
 
 		rxact_2pc_do();
 
+		/* Flush once for all the records inserted by this loop */
+		rxact_flush_agents();
+
 		cur_time = time(NULL);
 		if(last_time != cur_time)
 		{
@@ -608,6 +619,7 @@ static void RemoteXactHtabInit(void)
 	Assert(pconn != NULL);
 	pconn->conn = NULL;
 	pconn->status = PGRES_POLLING_FAILED;
+	pconn->wait_sock = PGINVALID_SOCKET;
 	pconn->doing_gid[0] = '\0';
 
 	/* create HTAB for RxactTransactionInfo */
@@ -865,6 +877,7 @@ rxact_agent_destroy(RxactAgent *agent)
 	--agentCount;
 	for(;i<agentCount;++i)
 		indexRxactAgent[i] = indexRxactAgent[i+1];
+	RemoveWaitEventFromSet(rxact_wait_set, agent->wait_pos);
 	closesocket(agent->sock);
 	agent->sock = PGINVALID_SOCKET;
 	agent->dboid = InvalidOid;
@@ -906,7 +919,7 @@ static void rxact_agent_end_msg(RxactAgent *agent, StringInfo msg)
 		}
 		rxact_put_finsh(msg);
 		appendBinaryStringInfo(&(agent->out_buf), msg->data, msg->len);
-		if(need_try)
+		if(need_try && !rxact_agent_hold_output(agent))
 			rxact_agent_output(agent);
 	}
 	pfree(msg->data);
@@ -936,10 +949,51 @@ static void rxact_agent_simple_msg(RxactAgent *agent, char msg_type)
 	msg.len = 5;
 	msg.str[4] = msg_type;
 	appendBinaryStringInfo(&(agent->out_buf), msg.str, 5);
-	if(need_try)
+	if(need_try && !rxact_agent_hold_output(agent))
 		rxact_agent_output(agent);
 }
 
+/*
+ * Answers are not sent while rxact log records wait for their flush, the
+ * agent may act on them. Return true if the output of agent is held.
+ */
+static bool rxact_agent_hold_output(RxactAgent *agent)
+{
+	if(XLogRecPtrIsInvalid(rxlf_flush_lsn))
+		return false;
+	agent->waiting_flush = true;
+	return true;
+}
+
+/*
+ * Flush the rxact log records inserted since the last call, then send the
+ * answers held for them. Called once per loop, so that the records of all
+ * the agents go to disk in a single flush.
+ */
+static void rxact_flush_agents(void)
+{
+	RxactAgent *agent;
+	unsigned int i;
+
+	if(!XLogRecPtrIsInvalid(rxlf_flush_lsn))
+	{
+		TRACE_POSTGRESQL_RXACT_LOG_FLUSH_START();
+		XLogFlush(rxlf_flush_lsn);
+		TRACE_POSTGRESQL_RXACT_LOG_FLUSH_DONE();
+		rxlf_flush_lsn = InvalidXLogRecPtr;
+	}
+
+	for(i = agentCount; i--;)
+	{
+		agent = &allRxactAgent[indexRxactAgent[i]];
+		if(agent->waiting_flush == false)
+			continue;
+		agent->waiting_flush = false;
+		if(agent->out_buf.len > agent->out_buf.cursor)
+			rxact_agent_output(agent);
+	}
+}
+
 /* true for recv some data, false for closed by remote */
 static bool
 rxact_agent_recv_data(RxactAgent *agent)
@@ -1825,6 +1879,7 @@ static NodeConn* rxact_get_node_conn(Oid db_oid, Oid node_oid, time_t cur_time)
 		conn->conn = NULL;
 		conn->last_use = 0;
 		conn->status = PGRES_POLLING_FAILED;
+		conn->wait_sock = PGINVALID_SOCKET;
 		conn->doing_gid[0] = '\0';
 	}
 	Assert(conn && conn->oids.node_oid == node_oid);
@@ -1913,6 +1968,7 @@ re_poll_conn_:
 static void rxact_finish_node_conn(NodeConn *conn)
 {
 	AssertArg(conn);
+	rxact_node_conn_unwait(conn);
 	if(conn->conn != NULL)
 	{
 		PQfinish(conn->conn);
@@ -1923,6 +1979,41 @@ static void rxact_finish_node_conn(NodeConn *conn)
 	conn->doing_gid[0] = '\0';
 }
 
+/*
+ * Wait on the socket of conn for events in rxact_wait_set, 0 for nothing
+ * but keeping it registered
+ */
+static void rxact_node_conn_wait(NodeConn *conn, uint32 events)
+{
+	pgsocket sock;
+	AssertArg(conn && conn->conn);
+
+	sock = PQsocket(conn->conn);
+	Assert(sock != PGINVALID_SOCKET);
+	if(conn->wait_sock != sock)
+	{
+		rxact_node_conn_unwait(conn);
+		conn->wait_pos = AddWaitEventToSet(rxact_wait_set, events, sock,
+										   NULL, conn);
+		conn->wait_sock = sock;
+		conn->wait_events = events;
+	}else if(conn->wait_events != events)
+	{
+		ModifyWaitEvent(rxact_wait_set, conn->wait_pos, events);
+		conn->wait_events = events;
+	}
+}
+
+static void rxact_node_conn_unwait(NodeConn *conn)
+{
+	AssertArg(conn);
+	if(conn->wait_sock != PGINVALID_SOCKET)
+	{
+		RemoveWaitEventFromSet(rxact_wait_set, conn->wait_pos);
+		conn->wait_sock = PGINVALID_SOCKET;
+	}
+}
+
 static void rxact_build_2pc_cmd(StringInfo cmd, const char *gid, RemoteXactType type)
 {
 	AssertArg(cmd);
@@ -2014,8 +2105,10 @@ static void rxact_xlog_insert(char *data, uint32 len, uint8 info, bool flush)
 	xlog.data = data;
 	xlog.len = len;
 	xptr = XLogInsert(RM_RXACT_MGR_ID, info, &xlog);
-	if(flush)
-		XLogFlush(xptr);
+	TRACE_POSTGRESQL_RXACT_LOG_INSERT(info, (int) len);
+	/* flushed by rxact_flush_agents before any answer is sent */
+	if(flush && rxlf_flush_lsn < xptr)
+		rxlf_flush_lsn = xptr;
 }
 
 static const char* RemoteXactType2String(RemoteXactType type)
@@ -2245,6 +2338,7 @@ re_recv_msg_:
 	Assert(rxact_client_fd != PGINVALID_SOCKET);
 	resetStringInfo(buf);
 
+	pgstat_report_wait_start(WAIT_EVENT_RXACT);
 	PG_TRY();
 	{
 		while(buf->len < 5)
@@ -2265,6 +2359,7 @@ re_recv_msg_:
 		rxact_client_fd = PGINVALID_SOCKET;
 		PG_RE_THROW();
 	}PG_END_TRY();
+	pgstat_report_wait_end();
 
 	/* parse message */
 	buf->cursor += 5;	/* 5 is sizeof(length) and message type */
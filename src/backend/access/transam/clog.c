@@ -38,6 +38,7 @@
 #include "access/transam.h"
 #include "miscadmin.h"
 #include "pg_trace.h"
+#include "storage/barrier.h"
 
 /*
  * Defines for CLOG page sizes.  A page is the same BLCKSZ as is used
@@ -75,6 +76,9 @@
 #endif
 
 
+/* GUC variable: number of CLOG buffers, 0 to size them by shared_buffers */
+int			clog_buffers = 0;
+
 /*
  * Link to shared-memory data structures for CLOG control
  */
@@ -358,12 +362,6 @@ TransactionIdSetStatusBit(TransactionId xid, XidStatus status, XLogRecPtr lsn, i
 			status != TRANSACTION_STATUS_IN_PROGRESS) ||
 		   curval == status);
 
-	/* note this assumes exclusive access to the clog page */
-	byteval = *byteptr;
-	byteval &= ~(((1 << CLOG_BITS_PER_XACT) - 1) << bshift);
-	byteval |= (status << bshift);
-	*byteptr = byteval;
-
 	/*
 	 * Update the group LSN if the transaction completion LSN is higher.
 	 *
@@ -371,6 +369,10 @@ TransactionIdSetStatusBit(TransactionId xid, XidStatus status, XLogRecPtr lsn, i
 	 * so we don't need to do anything special to avoid LSN updates during
 	 * recovery. After recovery completes the next clog change will set the
 	 * LSN correctly.
+	 *
+	 * This is done before setting the status, as TransactionIdGetStatus may
+	 * read them without holding CLogControlLock: whoever sees the new status
+	 * must see an LSN at least as high as the one of the transaction.
 	 */
 	if (!XLogRecPtrIsInvalid(lsn))
 	{
@@ -378,7 +380,14 @@ TransactionIdSetStatusBit(TransactionId xid, XidStatus status, XLogRecPtr lsn, i
 
 		if (ClogCtl->shared->group_lsn[lsnindex] < lsn)
 			ClogCtl->shared->group_lsn[lsnindex] = lsn;
+		pg_write_barrier();
 	}
+
+	/* note this assumes no one else updates the clog page */
+	byteval = *byteptr;
+	byteval &= ~(((1 << CLOG_BITS_PER_XACT) - 1) << bshift);
+	byteval |= (status << bshift);
+	*byteptr = byteval;
 }
 
 /*
@@ -406,18 +415,44 @@ TransactionIdGetStatus(TransactionId xid, XLogRecPtr *lsn)
 	int			lsnindex;
 	char	   *byteptr;
 	XidStatus	status;
+	uint32		generation;
+	LWLockId	lockheld;
 
-	/* lock is acquired by SimpleLruReadPage_ReadOnly */
+	/*
+	 * The status of a committed or aborted transaction never changes, so if
+	 * the page is in a buffer we can read it without any lock, provided the
+	 * slot did not change while we were reading.  The LSN of an aborted or
+	 * committed transaction is final too, its group having been updated
+	 * before its status.
+	 */
+	slotno = SimpleLruPeekPage(ClogCtl, pageno, &generation);
+	if (slotno >= 0)
+	{
+		byteptr = ClogCtl->shared->page_buffer[slotno] + byteno;
+		status = (*byteptr >> bshift) & CLOG_XACT_BITMASK;
+		pg_read_barrier();
+		lsnindex = GetLSNIndex(slotno, xid);
+		*lsn = ClogCtl->shared->group_lsn[lsnindex];
+
+		if ((status == TRANSACTION_STATUS_COMMITTED ||
+			 status == TRANSACTION_STATUS_ABORTED) &&
+			SimpleLruPeekValid(ClogCtl, slotno, generation))
+			return status;
+	}
 
-	slotno = SimpleLruReadPage_ReadOnly(ClogCtl, pageno, xid);
+	/* lock is acquired by SimpleLruReadPage_Bank */
+
+	slotno = SimpleLruReadPage_Bank(ClogCtl, pageno, xid, &lockheld);
 	byteptr = ClogCtl->shared->page_buffer[slotno] + byteno;
 
 	status = (*byteptr >> bshift) & CLOG_XACT_BITMASK;
 
+	/* the page may be updated under us, see TransactionIdSetStatusBit */
+	pg_read_barrier();
 	lsnindex = GetLSNIndex(slotno, xid);
 	*lsn = ClogCtl->shared->group_lsn[lsnindex];
 
-	LWLockRelease(CLogControlLock);
+	LWLockRelease(lockheld);
 
 	return status;
 }
@@ -439,16 +474,18 @@ TransactionIdGetStatus(TransactionId xid, XLogRecPtr *lsn)
  * compromise: people with very low values for shared_buffers will get fewer
  * CLOG buffers as well, and everyone else will get 32.
  *
- * It is likely that some further work will be needed here in future releases;
- * for example, on a 64-core server, the maximum number of CLOG requests that
- * can be simultaneously in flight will be even larger.  But that will
- * apparently require more than just changing the formula, so for now we take
- * the easy way out.
+ * Since then, slru.c only searches the bank of buffers a page maps to, and
+ * on a cluster the XIDs assigned by AGTM advance much faster than the local
+ * workload of each node would make them, so the status of far more pages is
+ * looked up.  The formula now allows up to 128 buffers, and clog_buffers can
+ * set any number of them.
  */
 Size
 CLOGShmemBuffers(void)
 {
-	return Min(32, Max(4, NBuffers / 512));
+	if (clog_buffers > 0)
+		return Max(4, clog_buffers);
+	return Min(128, Max(4, NBuffers / 512));
 }
 
 /*
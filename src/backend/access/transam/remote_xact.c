@@ -15,6 +15,12 @@
 #include "pgxc/pgxc.h"
 #include "storage/ipc.h"
 
+/*
+ * Leave COMMIT PREPARED on the remote nodes to the remote xact manager once
+ * it logged the commit decision.
+ */
+bool EnableAsyncCommitPrepared = false;
+
 static void CommitPreparedRxact(const char *gid,
 								int nnodes,
 								Oid *nodeIds,
@@ -133,6 +139,19 @@ CommitPreparedRxact(const char *gid,
 {
 	volatile bool fail_to_commit = false;
 
+	/*
+	 * The remote xact manager has flushed the commit of gid, see
+	 * StartFinishPreparedRxact and EndRemoteXactPrepare, so it can finish
+	 * the commit itself as it does after a failure. It commits AGTM after
+	 * all the other nodes, until then the global snapshots still see the
+	 * transaction running and none of its changes is visible anywhere.
+	 */
+	if (EnableAsyncCommitPrepared && nnodes > 0)
+	{
+		RecordRemoteXactFailed(gid, RX_COMMIT);
+		return ;
+	}
+
 	PG_TRY_HOLD();
 	{
 		/* Commit prepared on remote nodes */
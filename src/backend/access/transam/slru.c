@@ -19,6 +19,23 @@
  * reading in or writing out a page buffer does not hold the control lock,
  * only the per-buffer lock for the buffer it is working on.
  *
+ * The slots are also divided into banks (see SLRU_BANK_SIZE), a page being
+ * only ever cached in the bank its page number maps to.  Each bank has a
+ * lock of its own, which is taken exclusively, while holding the control
+ * lock, by anyone changing which page a slot of the bank holds.  That lets
+ * SimpleLruReadPage_Bank() look a page up while holding only the bank lock,
+ * so read-only lookups of pages in different banks do not contend at all.
+ * The page contents may still be updated under the control lock alone;
+ * callers reading through the bank lock must be content with a value that
+ * is either the old or the new one, as is the case for transaction status
+ * bits.
+ *
+ * The same changes make the page_generation of the slot odd for their
+ * duration, which allows SimpleLruPeekPage() to read a page without any
+ * lock at all: the reader checks afterwards that the generation did not
+ * move, as in a seqlock.  This is only worth it for data that never changes
+ * once set, such as the status of a committed transaction.
+ *
  * "Holding the control lock" means exclusive lock in all cases except for
  * SimpleLruReadPage_ReadOnly(); see comments for SlruRecentlyUsed() for
  * the implications of that.
@@ -54,6 +71,7 @@
 #include "access/slru.h"
 #include "access/transam.h"
 #include "access/xlog.h"
+#include "storage/barrier.h"
 #include "storage/fd.h"
 #include "storage/shmem.h"
 #include "miscadmin.h"
@@ -108,6 +126,32 @@ typedef struct SlruFlushData *SlruFlush;
 		} \
 	} while (0)
 
+/* Bank a page is cached in, and the range of slots of a bank */
+#define SlruBankOfPage(shared, pageno)	((pageno) % (shared)->num_banks)
+#define SlruBankStart(shared, bank) \
+	((bank) * (shared)->num_slots / (shared)->num_banks)
+#define SlruBankEnd(shared, bank) \
+	SlruBankStart(shared, (bank) + 1)
+
+/*
+ * Bracket a change of the page held by a slot.  Control lock must be held
+ * exclusively; the bank lock is held between the two macros, unless the
+ * caller releases it for the duration of an I/O.
+ */
+#define SlruBeginPageChange(shared, slotno, pageno) \
+	do { \
+		LWLockAcquire((shared)->bank_locks[SlruBankOfPage(shared, pageno)], \
+					  LW_EXCLUSIVE); \
+		(shared)->page_generation[slotno]++; \
+		pg_write_barrier(); \
+	} while (0)
+#define SlruEndPageChange(shared, slotno, pageno) \
+	do { \
+		pg_write_barrier(); \
+		(shared)->page_generation[slotno]++; \
+		LWLockRelease((shared)->bank_locks[SlruBankOfPage(shared, pageno)]); \
+	} while (0)
+
 /* Saved info for SlruReportIOError */
 typedef enum
 {
@@ -152,6 +196,8 @@ SimpleLruShmemSize(int nslots, int nlsns)
 	sz += MAXALIGN(nslots * sizeof(int));		/* page_number[] */
 	sz += MAXALIGN(nslots * sizeof(int));		/* page_lru_count[] */
 	sz += MAXALIGN(nslots * sizeof(LWLockId));	/* buffer_locks[] */
+	sz += MAXALIGN(nslots * sizeof(uint32));	/* page_generation[] */
+	sz += MAXALIGN(SLRU_NUM_BANKS(nslots) * sizeof(LWLockId));	/* bank_locks[] */
 
 	if (nlsns > 0)
 		sz += MAXALIGN(nslots * nlsns * sizeof(XLogRecPtr));	/* group_lsn[] */
@@ -176,6 +222,7 @@ SimpleLruInit(SlruCtl ctl, const char *name, int nslots, int nlsns,
 		char	   *ptr;
 		Size		offset;
 		int			slotno;
+		int			bank;
 
 		Assert(!found);
 
@@ -184,6 +231,7 @@ SimpleLruInit(SlruCtl ctl, const char *name, int nslots, int nlsns,
 		shared->ControlLock = ctllock;
 
 		shared->num_slots = nslots;
+		shared->num_banks = SLRU_NUM_BANKS(nslots);
 		shared->lsn_groups_per_page = nlsns;
 
 		shared->cur_lru_count = 0;
@@ -204,6 +252,10 @@ SimpleLruInit(SlruCtl ctl, const char *name, int nslots, int nlsns,
 		offset += MAXALIGN(nslots * sizeof(int));
 		shared->buffer_locks = (LWLockId *) (ptr + offset);
 		offset += MAXALIGN(nslots * sizeof(LWLockId));
+		shared->page_generation = (uint32 *) (ptr + offset);
+		offset += MAXALIGN(nslots * sizeof(uint32));
+		shared->bank_locks = (LWLockId *) (ptr + offset);
+		offset += MAXALIGN(shared->num_banks * sizeof(LWLockId));
 
 		if (nlsns > 0)
 		{
@@ -219,8 +271,11 @@ SimpleLruInit(SlruCtl ctl, const char *name, int nslots, int nlsns,
 			shared->page_dirty[slotno] = false;
 			shared->page_lru_count[slotno] = 0;
 			shared->buffer_locks[slotno] = LWLockAssign();
+			shared->page_generation[slotno] = 0;
 			ptr += BLCKSZ;
 		}
+		for (bank = 0; bank < shared->num_banks; bank++)
+			shared->bank_locks[bank] = LWLockAssign();
 	}
 	else
 		Assert(found);
@@ -256,6 +311,7 @@ SimpleLruZeroPage(SlruCtl ctl, int pageno)
 		   shared->page_number[slotno] == pageno);
 
 	/* Mark the slot as containing this page */
+	SlruBeginPageChange(shared, slotno, pageno);
 	shared->page_number[slotno] = pageno;
 	shared->page_status[slotno] = SLRU_PAGE_VALID;
 	shared->page_dirty[slotno] = true;
@@ -266,6 +322,7 @@ SimpleLruZeroPage(SlruCtl ctl, int pageno)
 
 	/* Set the LSNs for this new page to zero */
 	SimpleLruZeroLSNs(ctl, slotno);
+	SlruEndPageChange(shared, slotno, pageno);
 
 	/* Assume this page is now the latest active page */
 	shared->latest_page_number = pageno;
@@ -326,7 +383,15 @@ SimpleLruWaitIO(SlruCtl ctl, int slotno)
 		{
 			/* indeed, the I/O must have failed */
 			if (shared->page_status[slotno] == SLRU_PAGE_READ_IN_PROGRESS)
+			{
+				int			pageno = shared->page_number[slotno];
+
+				/* the change was begun by SimpleLruReadPage */
+				LWLockAcquire(shared->bank_locks[SlruBankOfPage(shared, pageno)],
+							  LW_EXCLUSIVE);
 				shared->page_status[slotno] = SLRU_PAGE_EMPTY;
+				SlruEndPageChange(shared, slotno, pageno);
+			}
 			else	/* write_in_progress */
 			{
 				shared->page_status[slotno] = SLRU_PAGE_VALID;
@@ -395,10 +460,16 @@ SimpleLruReadPage(SlruCtl ctl, int pageno, bool write_ok,
 			   (shared->page_status[slotno] == SLRU_PAGE_VALID &&
 				!shared->page_dirty[slotno]));
 
-		/* Mark the slot read-busy */
+		/*
+		 * Mark the slot read-busy.  The page change stays open, that is the
+		 * generation odd, until the read is done, but the bank lock is not
+		 * kept over the I/O: bank readers skip read-busy slots anyway.
+		 */
+		SlruBeginPageChange(shared, slotno, pageno);
 		shared->page_number[slotno] = pageno;
 		shared->page_status[slotno] = SLRU_PAGE_READ_IN_PROGRESS;
 		shared->page_dirty[slotno] = false;
+		LWLockRelease(shared->bank_locks[SlruBankOfPage(shared, pageno)]);
 
 		/* Acquire per-buffer lock (cannot deadlock, see notes at top) */
 		LWLockAcquire(shared->buffer_locks[slotno], LW_EXCLUSIVE);
@@ -419,7 +490,10 @@ SimpleLruReadPage(SlruCtl ctl, int pageno, bool write_ok,
 			   shared->page_status[slotno] == SLRU_PAGE_READ_IN_PROGRESS &&
 			   !shared->page_dirty[slotno]);
 
+		LWLockAcquire(shared->bank_locks[SlruBankOfPage(shared, pageno)],
+					  LW_EXCLUSIVE);
 		shared->page_status[slotno] = ok ? SLRU_PAGE_VALID : SLRU_PAGE_EMPTY;
+		SlruEndPageChange(shared, slotno, pageno);
 
 		LWLockRelease(shared->buffer_locks[slotno]);
 
@@ -450,13 +524,15 @@ int
 SimpleLruReadPage_ReadOnly(SlruCtl ctl, int pageno, TransactionId xid)
 {
 	SlruShared	shared = ctl->shared;
+	int			bank = SlruBankOfPage(shared, pageno);
 	int			slotno;
 
 	/* Try to find the page while holding only shared lock */
 	LWLockAcquire(shared->ControlLock, LW_SHARED);
 
 	/* See if page is already in a buffer */
-	for (slotno = 0; slotno < shared->num_slots; slotno++)
+	for (slotno = SlruBankStart(shared, bank);
+		 slotno < SlruBankEnd(shared, bank); slotno++)
 	{
 		if (shared->page_number[slotno] == pageno &&
 			shared->page_status[slotno] != SLRU_PAGE_EMPTY &&
@@ -475,6 +551,97 @@ SimpleLruReadPage_ReadOnly(SlruCtl ctl, int pageno, TransactionId xid)
 	return SimpleLruReadPage(ctl, pageno, true, xid);
 }
 
+/*
+ * Like SimpleLruReadPage_ReadOnly, but when the page is already in a buffer
+ * only the lock of its bank is taken, in shared mode, rather than the control
+ * lock.  Otherwise the page is read in while holding the control lock.
+ *
+ * The caller must only read the page, and must be prepared for the page
+ * contents to be updated under it (see notes at top of file).
+ *
+ * Neither the control lock nor the bank lock must be held at entry; the lock
+ * held at exit is returned in *lockheld, for the caller to release.
+ */
+int
+SimpleLruReadPage_Bank(SlruCtl ctl, int pageno, TransactionId xid,
+					   LWLockId *lockheld)
+{
+	SlruShared	shared = ctl->shared;
+	int			bank = SlruBankOfPage(shared, pageno);
+	int			slotno;
+
+	LWLockAcquire(shared->bank_locks[bank], LW_SHARED);
+
+	for (slotno = SlruBankStart(shared, bank);
+		 slotno < SlruBankEnd(shared, bank); slotno++)
+	{
+		if (shared->page_number[slotno] == pageno &&
+			(shared->page_status[slotno] == SLRU_PAGE_VALID ||
+			 shared->page_status[slotno] == SLRU_PAGE_WRITE_IN_PROGRESS))
+		{
+			/*
+			 * This may now run concurrently with SlruSelectLRUPage, which
+			 * copes with it the same way.
+			 */
+			SlruRecentlyUsed(shared, slotno);
+			*lockheld = shared->bank_locks[bank];
+			return slotno;
+		}
+	}
+
+	LWLockRelease(shared->bank_locks[bank]);
+	LWLockAcquire(shared->ControlLock, LW_EXCLUSIVE);
+	*lockheld = shared->ControlLock;
+
+	return SimpleLruReadPage(ctl, pageno, true, xid);
+}
+
+/*
+ * Look for a page in the buffers without taking any lock.
+ *
+ * Returns the slot holding the page, or -1 if it is not in a buffer or is
+ * being read in or replaced.  The caller may read the page, then must call
+ * SimpleLruPeekValid with the returned generation to know whether what it
+ * read is trustworthy; if not, it has to fall back to one of the locked
+ * functions.  Nothing was done to keep the page in memory.
+ */
+int
+SimpleLruPeekPage(SlruCtl ctl, int pageno, uint32 *generation)
+{
+	SlruShared	shared = ctl->shared;
+	int			bank = SlruBankOfPage(shared, pageno);
+	int			slotno;
+
+	for (slotno = SlruBankStart(shared, bank);
+		 slotno < SlruBankEnd(shared, bank); slotno++)
+	{
+		uint32		gen = shared->page_generation[slotno];
+
+		pg_read_barrier();
+		if ((gen & 1) == 0 &&
+			shared->page_number[slotno] == pageno &&
+			(shared->page_status[slotno] == SLRU_PAGE_VALID ||
+			 shared->page_status[slotno] == SLRU_PAGE_WRITE_IN_PROGRESS))
+		{
+			*generation = gen;
+			return slotno;
+		}
+	}
+
+	return -1;
+}
+
+/*
+ * Check that the slot returned by SimpleLruPeekPage still holds the same
+ * page, so that what was read from it in between is valid.
+ */
+bool
+SimpleLruPeekValid(SlruCtl ctl, int slotno, uint32 generation)
+{
+	pg_read_barrier();
+	return ctl->shared->page_generation[slotno] == generation;
+}
+
 /*
  * Write a page from a shared buffer, if necessary.
  * Does nothing if the specified slot is not dirty.
@@ -947,7 +1114,7 @@ SlruReportIOError(SlruCtl ctl, int pageno, TransactionId xid)
  * any slot already holds the target page, and return that slot if so.
  * Thus, the returned slot is *either* a slot already holding the pageno
  * (could be any state except EMPTY), *or* a freeable slot (state EMPTY
- * or CLEAN).
+ * or CLEAN).  Only the slots of the bank of the page are considered.
  *
  * Control lock must be held at entry, and will be held at exit.
  */
@@ -955,6 +1122,7 @@ static int
 SlruSelectLRUPage(SlruCtl ctl, int pageno)
 {
 	SlruShared	shared = ctl->shared;
+	int			bank = SlruBankOfPage(shared, pageno);
 
 	/* Outer loop handles restart after I/O */
 	for (;;)
@@ -969,7 +1137,8 @@ SlruSelectLRUPage(SlruCtl ctl, int pageno)
 		int			best_invalid_page_number = 0;		/* keep compiler quiet */
 
 		/* See if page already has a buffer assigned */
-		for (slotno = 0; slotno < shared->num_slots; slotno++)
+		for (slotno = SlruBankStart(shared, bank);
+			 slotno < SlruBankEnd(shared, bank); slotno++)
 		{
 			if (shared->page_number[slotno] == pageno &&
 				shared->page_status[slotno] != SLRU_PAGE_EMPTY)
@@ -1004,7 +1173,8 @@ SlruSelectLRUPage(SlruCtl ctl, int pageno)
 		 * multiple pages with the same lru_count.
 		 */
 		cur_count = (shared->cur_lru_count)++;
-		for (slotno = 0; slotno < shared->num_slots; slotno++)
+		for (slotno = SlruBankStart(shared, bank);
+			 slotno < SlruBankEnd(shared, bank); slotno++)
 		{
 			int			this_delta;
 			int			this_page_number;
@@ -1200,7 +1370,11 @@ restart:;
 		if (shared->page_status[slotno] == SLRU_PAGE_VALID &&
 			!shared->page_dirty[slotno])
 		{
+			int			pageno = shared->page_number[slotno];
+
+			SlruBeginPageChange(shared, slotno, pageno);
 			shared->page_status[slotno] = SLRU_PAGE_EMPTY;
+			SlruEndPageChange(shared, slotno, pageno);
 			continue;
 		}
 
@@ -59,6 +59,25 @@
 #define TransactionIdToPage(xid) ((xid) / (TransactionId) SUBTRANS_XACTS_PER_PAGE)
 #define TransactionIdToEntry(xid) ((xid) % (TransactionId) SUBTRANS_XACTS_PER_PAGE)
 
+/*
+ * Backend-local cache of SubTransGetTopmostTransaction results.  When a
+ * snapshot has overflowed, every xid a scan finds in a tuple is converted to
+ * its topmost parent, and the same few xids come up over and over again.
+ * The parent of an xid is set before the xid can be seen anywhere and never
+ * changes, but the result also depends on TransactionXmin, so the cache is
+ * emptied whenever that moves.  Direct-mapped, on the low bits of the xid.
+ */
+#define TOPMOST_CACHE_SIZE	1024	/* must be a power of 2 */
+
+typedef struct TopmostCacheEntry
+{
+	TransactionId xid;			/* InvalidTransactionId if unused */
+	TransactionId topxid;
+} TopmostCacheEntry;
+
+static TopmostCacheEntry TopmostCache[TOPMOST_CACHE_SIZE];
+static TransactionId TopmostCacheXmin = InvalidTransactionId;
+
 
 /*
  * Link to shared-memory data structures for SUBTRANS control
@@ -153,10 +172,20 @@ SubTransGetTopmostTransaction(TransactionId xid)
 {
 	TransactionId parentXid = xid,
 				previousXid = xid;
+	TopmostCacheEntry *entry;
 
 	/* Can't ask about stuff that might not be around anymore */
 	Assert(TransactionIdFollowsOrEquals(xid, TransactionXmin));
 
+	if (!TransactionIdEquals(TopmostCacheXmin, TransactionXmin))
+	{
+		MemSet(TopmostCache, 0, sizeof(TopmostCache));
+		TopmostCacheXmin = TransactionXmin;
+	}
+	entry = &TopmostCache[xid & (TOPMOST_CACHE_SIZE - 1)];
+	if (TransactionIdEquals(entry->xid, xid))
+		return entry->topxid;
+
 	while (TransactionIdIsValid(parentXid))
 	{
 		previousXid = parentXid;
@@ -167,6 +196,9 @@ SubTransGetTopmostTransaction(TransactionId xid)
 
 	Assert(TransactionIdIsValid(previousXid));
 
+	entry->xid = xid;
+	entry->topxid = previousXid;
+
 	return previousXid;
 }
 
@@ -27,6 +27,13 @@
 #ifdef PGXC
 #include "pgxc/pgxc.h"
 #endif
+#ifdef ADB
+#include "access/xact.h"
+#include "agtm/agtm.h"
+#include "agtm/agtm_xidcache.h"
+#include "postmaster/autovacuum.h"
+#include "storage/procarray.h"
+#endif
 
 #if defined(ADB) || defined(AGTM)
 #include "utils/builtins.h"
@@ -42,8 +49,11 @@ static TransactionId cachedFetchXid = InvalidTransactionId;
 static XidStatus cachedFetchXidStatus;
 static XLogRecPtr cachedCommitLSN;
 
-#ifndef ADB
 /* Local functions */
+#ifdef ADB
+static bool TransactionIdNeverRanHere(TransactionId transactionId);
+static XidStatus TransactionLogFetchGlobal(TransactionId transactionId);
+#else
 static XidStatus TransactionLogFetch(TransactionId transactionId);
 #endif
 
@@ -97,6 +107,24 @@ TransactionLogFetch(TransactionId transactionId)
 	 */
 	xidstatus = TransactionIdGetStatus(transactionId, &xidlsn);
 
+#ifdef ADB
+	/*
+	 * Callers may hold a buffer content lock, so never ask AGTM from here;
+	 * only take what the shared status cache already knows.  Neither is the
+	 * answer cached below: the LSN that came with it is no WAL position of
+	 * this node, and TransactionIdGetCommitLSN() must go to the local clog.
+	 */
+	if (xidstatus == TRANSACTION_STATUS_IN_PROGRESS &&
+		TransactionIdNeverRanHere(transactionId))
+	{
+		XidStatus	agtmstatus;
+
+		if (AgtmXidCacheLookup(transactionId, &agtmstatus, NULL))
+			return agtmstatus;
+		return xidstatus;
+	}
+#endif
+
 	/*
 	 * Cache it, but DO NOT cache status for unfinished or sub-committed
 	 * transactions!  We only cache status that is guaranteed not to change.
@@ -112,6 +140,48 @@ TransactionLogFetch(TransactionId transactionId)
 	return xidstatus;
 }
 
+#ifdef ADB
+/*
+ * TransactionIdNeverRanHere --- is the local clog no help for this xid?
+ *
+ * A transaction which never ran on this node stays in progress for the
+ * local clog forever, once it is not running here only AGTM knows how it
+ * ended.  XIDs older than startupNextXid may have been lost in a local
+ * crash, the local clog answers for them as for plain PostgreSQL.
+ */
+static bool
+TransactionIdNeverRanHere(TransactionId transactionId)
+{
+	return IsUnderAGTM() &&
+		TransactionIdFollowsOrEquals(transactionId,
+									 ShmemVariableCache->startupNextXid) &&
+		!TransactionIdIsInProgress(transactionId);
+}
+
+/*
+ * TransactionLogFetchGlobal --- TransactionLogFetch, asking AGTM on a miss
+ *
+ * Only for callers holding no buffer lock, the round-trip to AGTM happens
+ * while we wait.
+ */
+static XidStatus
+TransactionLogFetchGlobal(TransactionId transactionId)
+{
+	XidStatus	xidstatus;
+	XLogRecPtr	xidlsn;
+
+	xidstatus = TransactionLogFetch(transactionId);
+
+	if (xidstatus == TRANSACTION_STATUS_IN_PROGRESS &&
+		IsTransactionState() &&
+		!IsAnyAutoVacuumProcess() &&
+		TransactionIdNeverRanHere(transactionId))
+		xidstatus = agtm_TransactionIdGetStatus(transactionId, &xidlsn);
+
+	return xidstatus;
+}
+#endif
+
 #ifdef PGXC
 /*
  * For given Transaction ID, check if transaction is committed or aborted
@@ -122,7 +192,11 @@ pgxc_is_committed(PG_FUNCTION_ARGS)
 	TransactionId	tid = (TransactionId) PG_GETARG_UINT32(0);
 	XidStatus   xidstatus;
 
+#ifdef ADB
+	xidstatus = TransactionLogFetchGlobal(tid);
+#else
 	xidstatus = TransactionLogFetch(tid);
+#endif
 
 	if (xidstatus == TRANSACTION_STATUS_COMMITTED)
 		PG_RETURN_BOOL(true);
@@ -470,7 +544,11 @@ Datum pg_xact_status(PG_FUNCTION_ARGS)
 	TransactionId	tid = (TransactionId) PG_GETARG_INT64(0);
 	XidStatus		xidstatus;
 
+#ifdef ADB
+	xidstatus = TransactionLogFetchGlobal(tid);
+#else
 	xidstatus = TransactionLogFetch(tid);
+#endif
 
 	switch (xidstatus)
 	{
@@ -29,8 +29,13 @@
  *		In order to survive crashes and shutdowns, all prepared
  *		transactions must be stored in permanent storage. This includes
  *		locking information, pending notifications etc. All that state
- *		information is written to the per-transaction state file in
- *		the pg_twophase directory.
+ *		information is written to the PREPARE WAL record, and to the
+ *		per-transaction state file in the pg_twophase directory only when
+ *		a checkpoint moves the redo pointer past that record.  Transactions
+ *		finished before the next checkpoint, the usual case, read their
+ *		state back from WAL and never create a file; their flushes are the
+ *		WAL flushes of the PREPARE and COMMIT/ROLLBACK PREPARED records,
+ *		which XLogFlush already groups among concurrent backends.
  *
  *-------------------------------------------------------------------------
  */
@@ -48,6 +53,7 @@
 #include "access/twophase.h"
 #include "access/twophase_rmgr.h"
 #include "access/xact.h"
+#include "access/xlogreader.h"
 #include "access/xlogutils.h"
 #include "catalog/pg_type.h"
 #include "catalog/storage.h"
@@ -78,8 +84,11 @@
 #include "access/remote_xact.h"
 #include "access/rxact_mgr.h"
 #include "agtm/agtm.h"
+#include "agtm/agtm_xidcache.h"
 #include "commands/dbcommands.h"
 #include "utils/lsyscache.h"
+#include "utils/sharedcatcache.h"
+#include "utils/sharedplancache.h"
 #endif
 
 /*
@@ -131,7 +140,10 @@ typedef struct GlobalTransactionData
 	int			pgprocno;		/* ID of associated dummy PGPROC */
 	BackendId	dummyBackendId; /* similar to backend id for backends */
 	TimestampTz prepared_at;	/* time of preparation */
-	XLogRecPtr	prepare_lsn;	/* XLOG offset of prepare record */
+	XLogRecPtr	prepare_lsn;	/* XLOG offset of prepare record end */
+	XLogRecPtr	prepare_start_lsn;	/* XLOG offset of prepare record start */
+	TimeLineID	prepare_tli;	/* timeline of the prepare record */
+	bool		ondisk;			/* TRUE if the state file has been written */
 	Oid			owner;			/* ID of user that executed the xact */
 	BackendId	locking_backend; /* backend currently working on the xact */
 	bool		valid;			/* TRUE if PGPROC entry is in proc array */
@@ -186,7 +198,10 @@ static void RecordTransactionAbortPrepared(TransactionId xid,
 							   RelFileNode *rels);
 static void ProcessRecords(char *bufptr, TransactionId xid,
 			   const TwoPhaseCallback callbacks[]);
-static void RemoveGXact(GlobalTransaction gxact);
+static bool RemoveGXact(GlobalTransaction gxact);
+static char *XlogReadTwoPhaseData(XLogRecPtr lsn, TimeLineID tli,
+					 TransactionId xid, int *len);
+static char *ReadTwoPhaseData(GlobalTransaction gxact, TransactionId xid);
 
 #ifdef ADB
 #define NODES_SIZE	(sizeof(Oid) * (MaxDataNodes + MaxCoords))
@@ -382,6 +397,8 @@ MarkAsPreparing(TransactionId xid, const char *gid,
 	GlobalTransaction gxact;
 	PGPROC	   *proc;
 	PGXACT	   *pgxact;
+	uint64	   *fpLockBits;
+	Oid		   *fpRelId;
 	int			i;
 
 	if (strlen(gid) >= GIDSIZE)
@@ -432,8 +449,16 @@ MarkAsPreparing(TransactionId xid, const char *gid,
 	proc = &ProcGlobal->allProcs[gxact->pgprocno];
 	pgxact = &ProcGlobal->allPgXact[gxact->pgprocno];
 
-	/* Initialize the PGPROC entry */
+	/*
+	 * Initialize the PGPROC entry.  Keep the pointers to its fast-path lock
+	 * arrays, which InitProcGlobal set up; a prepared transaction never has
+	 * any fast-path locks, so their contents are all zero already.
+	 */
+	fpLockBits = proc->fpLockBits;
+	fpRelId = proc->fpRelId;
 	MemSet(proc, 0, sizeof(PGPROC));
+	proc->fpLockBits = fpLockBits;
+	proc->fpRelId = fpRelId;
 	proc->pgprocno = gxact->pgprocno;
 	SHMQueueElemInit(&(proc->links));
 	proc->waitStatus = STATUS_OK;
@@ -448,6 +473,9 @@ MarkAsPreparing(TransactionId xid, const char *gid,
 	proc->databaseId = databaseid;
 	proc->roleId = owner;
 	proc->lwWaiting = false;
+#ifdef ADB
+	proc->waitEvent = 0;
+#endif
 	proc->lwWaitMode = 0;
 	proc->lwWaitLink = NULL;
 	proc->waitLock = NULL;
@@ -461,6 +489,9 @@ MarkAsPreparing(TransactionId xid, const char *gid,
 	gxact->prepared_at = prepared_at;
 	/* initialize LSN to 0 (start of WAL) */
 	gxact->prepare_lsn = 0;
+	gxact->prepare_start_lsn = InvalidXLogRecPtr;
+	gxact->prepare_tli = 0;
+	gxact->ondisk = false;
 	gxact->owner = owner;
 	gxact->locking_backend = MyBackendId;
 	gxact->valid = false;
@@ -636,12 +667,16 @@ LockGXact(const char *gid, Oid user)
  * RemoveGXact
  *		Remove the prepared transaction from the shared memory array.
  *
+ * Returns whether a checkpoint wrote its state file.  Once the gxact is out
+ * of the array no checkpoint can write it any more, so this is final.
+ *
  * NB: caller should have already removed it from ProcArray
  */
-static void
+static bool
 RemoveGXact(GlobalTransaction gxact)
 {
 	int			i;
+	bool		ondisk;
 
 	LWLockAcquire(TwoPhaseStateLock, LW_EXCLUSIVE);
 
@@ -659,51 +694,18 @@ RemoveGXact(GlobalTransaction gxact)
 			/* and put it back in the freelist */
 			gxact->next = TwoPhaseState->freeGXacts;
 			TwoPhaseState->freeGXacts = gxact;
+			ondisk = gxact->ondisk;
 
 			LWLockRelease(TwoPhaseStateLock);
 
-			return;
+			return ondisk;
 		}
 	}
 
 	LWLockRelease(TwoPhaseStateLock);
 
 	elog(ERROR, "failed to find %p in GlobalTransaction array", gxact);
-}
-
-/*
- * TransactionIdIsPrepared
- *		True iff transaction associated with the identifier is prepared
- *		for two-phase commit
- *
- * Note: only gxacts marked "valid" are considered; but notice we do not
- * check the locking status.
- *
- * This is not currently exported, because it is only needed internally.
- */
-static bool
-TransactionIdIsPrepared(TransactionId xid)
-{
-	bool		result = false;
-	int			i;
-
-	LWLockAcquire(TwoPhaseStateLock, LW_SHARED);
-
-	for (i = 0; i < TwoPhaseState->numPrepXacts; i++)
-	{
-		GlobalTransaction gxact = TwoPhaseState->prepXacts[i];
-		PGXACT	   *pgxact = &ProcGlobal->allPgXact[gxact->pgprocno];
-
-		if (gxact->valid && pgxact->xid == xid)
-		{
-			result = true;
-			break;
-		}
-	}
-
-	LWLockRelease(TwoPhaseStateLock);
-
-	return result;
+	return false;				/* keep compiler quiet */
 }
 
 /*
@@ -1234,14 +1236,7 @@ StartPrepare(GlobalTransaction gxact)
 void
 EndPrepare(GlobalTransaction gxact)
 {
-	PGXACT	   *pgxact = &ProcGlobal->allPgXact[gxact->pgprocno];
-	TransactionId xid = pgxact->xid;
 	TwoPhaseFileHeader *hdr;
-	char		path[MAXPGPATH];
-	XLogRecData *record;
-	pg_crc32	statefile_crc;
-	pg_crc32	bogus_crc;
-	int			fd;
 
 	/* Add the end sentinel to the list of 2PC records */
 	RegisterTwoPhaseRecord(TWOPHASE_RM_END_ID, 0,
@@ -1262,80 +1257,21 @@ EndPrepare(GlobalTransaction gxact)
 				 errmsg("two-phase state file maximum length exceeded")));
 
 	/*
-	 * Create the 2PC state file.
-	 */
-
-	TwoPhaseFilePath(path, xid);
-
-	fd = OpenTransientFile(path,
-						   O_CREAT | O_EXCL | O_WRONLY | PG_BINARY,
-						   S_IRUSR | S_IWUSR);
-	if (fd < 0)
-		ereport(ERROR,
-				(errcode_for_file_access(),
-				 errmsg("could not create two-phase state file \"%s\": %m",
-						path)));
-
-	/* Write data to file, and calculate CRC as we pass over it */
-	INIT_CRC32(statefile_crc);
-
-	for (record = records.head; record != NULL; record = record->next)
-	{
-		COMP_CRC32(statefile_crc, record->data, record->len);
-		if ((write(fd, record->data, record->len)) != record->len)
-		{
-			CloseTransientFile(fd);
-			ereport(ERROR,
-					(errcode_for_file_access(),
-					 errmsg("could not write two-phase state file: %m")));
-		}
-	}
-
-	FIN_CRC32(statefile_crc);
-
-	/*
-	 * Write a deliberately bogus CRC to the state file; this is just paranoia
-	 * to catch the case where four more bytes will run us out of disk space.
-	 */
-	bogus_crc = ~statefile_crc;
-
-	if ((write(fd, &bogus_crc, sizeof(pg_crc32))) != sizeof(pg_crc32))
-	{
-		CloseTransientFile(fd);
-		ereport(ERROR,
-				(errcode_for_file_access(),
-				 errmsg("could not write two-phase state file: %m")));
-	}
-
-	/* Back up to prepare for rewriting the CRC */
-	if (lseek(fd, -((off_t) sizeof(pg_crc32)), SEEK_CUR) < 0)
-	{
-		CloseTransientFile(fd);
-		ereport(ERROR,
-				(errcode_for_file_access(),
-				 errmsg("could not seek in two-phase state file: %m")));
-	}
-
-	/*
-	 * The state file isn't valid yet, because we haven't written the correct
-	 * CRC yet.  Before we do that, insert entry in WAL and flush it to disk.
-	 *
-	 * Between the time we have written the WAL entry and the time we write
-	 * out the correct state file CRC, we have an inconsistency: the xact is
-	 * prepared according to WAL but not according to our on-disk state. We
-	 * use a critical section to force a PANIC if we are unable to complete
-	 * the write --- then, WAL replay should repair the inconsistency.  The
-	 * odds of a PANIC actually occurring should be very tiny given that we
-	 * were able to write the bogus CRC above.
+	 * The state data goes to WAL only, a checkpoint writes the state file if
+	 * the transaction is still prepared past its redo pointer; see
+	 * CheckPointTwoPhase.  Once the WAL entry is flushed the transaction is
+	 * prepared, so use a critical section to force a PANIC if we are unable
+	 * to complete the preparation.
 	 *
 	 * We have to set delayChkpt here, too; otherwise a checkpoint starting
 	 * immediately after the WAL record is inserted could complete without
-	 * fsync'ing our state file.  (This is essentially the same kind of race
+	 * writing our state file.  (This is essentially the same kind of race
 	 * condition as the COMMIT-to-clog-write case that RecordTransactionCommit
 	 * uses delayChkpt for; see notes there.)
 	 *
 	 * We save the PREPARE record's location in the gxact for later use by
-	 * CheckPointTwoPhase.
+	 * CheckPointTwoPhase and by the commit or rollback reading the state
+	 * data back.
 	 */
 
 	START_CRIT_SECTION();
@@ -1344,24 +1280,12 @@ EndPrepare(GlobalTransaction gxact)
 
 	gxact->prepare_lsn = XLogInsert(RM_XACT_ID, XLOG_XACT_PREPARE,
 									records.head);
+	gxact->prepare_start_lsn = ProcLastRecPtr;
+	gxact->prepare_tli = ThisTimeLineID;
 	XLogFlush(gxact->prepare_lsn);
 
 	/* If we crash now, we have prepared: WAL replay will fix things */
 
-	/* write correct CRC and close file */
-	if ((write(fd, &statefile_crc, sizeof(pg_crc32))) != sizeof(pg_crc32))
-	{
-		CloseTransientFile(fd);
-		ereport(ERROR,
-				(errcode_for_file_access(),
-				 errmsg("could not write two-phase state file: %m")));
-	}
-
-	if (CloseTransientFile(fd) != 0)
-		ereport(ERROR,
-				(errcode_for_file_access(),
-				 errmsg("could not close two-phase state file: %m")));
-
 	/*
 	 * Mark the prepared transaction as valid.  As soon as xact.c marks
 	 * MyPgXact as not running our XID (which it will do immediately after
@@ -1526,6 +1450,140 @@ ReadTwoPhaseFile(TransactionId xid, bool give_warnings)
 	return buf;
 }
 
+/* Segment file being read by twophase_read_page */
+typedef struct TwoPhaseReadState
+{
+	TimeLineID	tli;
+	XLogSegNo	segno;
+	int			fd;
+} TwoPhaseReadState;
+
+/*
+ * XLogReader callback reading the WAL written by this server.
+ *
+ * The record asked for has already been flushed, so a whole page of the
+ * segment file is always there, whatever follows the record on it.
+ */
+static int
+twophase_read_page(XLogReaderState *xlogreader, XLogRecPtr targetPagePtr,
+				   int reqLen, XLogRecPtr targetRecPtr, char *readBuf,
+				   TimeLineID *pageTLI)
+{
+	TwoPhaseReadState *state = (TwoPhaseReadState *) xlogreader->private_data;
+	XLogSegNo	segno;
+
+	XLByteToSeg(targetPagePtr, segno);
+	if (state->fd < 0 || state->segno != segno)
+	{
+		char		path[MAXPGPATH];
+
+		if (state->fd >= 0)
+			CloseTransientFile(state->fd);
+		XLogFilePath(path, state->tli, segno);
+		state->fd = OpenTransientFile(path, O_RDONLY | PG_BINARY, 0);
+		if (state->fd < 0)
+			return -1;
+		state->segno = segno;
+	}
+
+	if (lseek(state->fd, (off_t) (targetPagePtr % XLogSegSize), SEEK_SET) < 0 ||
+		read(state->fd, readBuf, XLOG_BLCKSZ) != XLOG_BLCKSZ)
+		return -1;
+
+	*pageTLI = state->tli;
+	return XLOG_BLCKSZ;
+}
+
+/*
+ * Read the state data of xid from its PREPARE record at "lsn".
+ *
+ * Returns the palloc'd data, laid out like the state file without its CRC,
+ * and its length in *len.  Returns NULL if the record cannot be read or is
+ * not the PREPARE record of xid, which happens once its WAL segment has been
+ * removed or recycled.
+ */
+static char *
+XlogReadTwoPhaseData(XLogRecPtr lsn, TimeLineID tli, TransactionId xid,
+					 int *len)
+{
+	TwoPhaseReadState state;
+	XLogReaderState *xlogreader;
+	XLogRecord *record;
+	TwoPhaseFileHeader *hdr;
+	char	   *errormsg;
+	char	   *buf = NULL;
+
+	state.tli = tli;
+	state.segno = 0;
+	state.fd = -1;
+
+	xlogreader = XLogReaderAllocate(twophase_read_page, &state);
+	if (!xlogreader)
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("out of memory"),
+		   errdetail("Failed while allocating an XLog reading processor.")));
+
+	record = XLogReadRecord(xlogreader, lsn, &errormsg);
+	if (record != NULL &&
+		record->xl_rmid == RM_XACT_ID &&
+		(record->xl_info & ~XLR_INFO_MASK) == XLOG_XACT_PREPARE &&
+		record->xl_len >= MAXALIGN(sizeof(TwoPhaseFileHeader)))
+	{
+		hdr = (TwoPhaseFileHeader *) XLogRecGetData(record);
+		if (hdr->magic == TWOPHASE_MAGIC &&
+			TransactionIdEquals(hdr->xid, xid) &&
+			hdr->total_len == record->xl_len + sizeof(pg_crc32))
+		{
+			buf = (char *) palloc(record->xl_len);
+			memcpy(buf, hdr, record->xl_len);
+			*len = record->xl_len;
+		}
+	}
+
+	if (state.fd >= 0)
+		CloseTransientFile(state.fd);
+	XLogReaderFree(xlogreader);
+
+	return buf;
+}
+
+/*
+ * Read the state data of a prepared transaction, from its state file if a
+ * checkpoint wrote it, otherwise from WAL.
+ *
+ * The caller has locked gxact.  A checkpoint may write the state file and
+ * then remove the WAL holding the PREPARE record in the meantime, so when
+ * that WAL cannot be read the file is tried again.
+ */
+static char *
+ReadTwoPhaseData(GlobalTransaction gxact, TransactionId xid)
+{
+	char	   *buf;
+	bool		ondisk;
+	int			len;
+
+	LWLockAcquire(TwoPhaseStateLock, LW_SHARED);
+	ondisk = gxact->ondisk;
+	LWLockRelease(TwoPhaseStateLock);
+
+	if (!ondisk)
+	{
+		buf = XlogReadTwoPhaseData(gxact->prepare_start_lsn,
+								   gxact->prepare_tli, xid, &len);
+		if (buf != NULL)
+			return buf;
+
+		LWLockAcquire(TwoPhaseStateLock, LW_SHARED);
+		ondisk = gxact->ondisk;
+		LWLockRelease(TwoPhaseStateLock);
+		if (!ondisk)
+			return NULL;
+	}
+
+	return ReadTwoPhaseFile(xid, true);
+}
+
 /*
  * Confirms an xid is prepared, during recovery
  */
@@ -1639,13 +1697,13 @@ FinishPreparedTransactionExt(const char *gid,
 	xid = pgxact->xid;
 
 	/*
-	 * Read and validate the state file
+	 * Read and validate the state data
 	 */
-	buf = ReadTwoPhaseFile(xid, true);
+	buf = ReadTwoPhaseData(gxact, xid);
 	if (buf == NULL)
 		ereport(ERROR,
 				(errcode(ERRCODE_DATA_CORRUPTED),
-				 errmsg("two-phase state file for transaction %u is corrupt",
+				 errmsg("two-phase state data for transaction %u is corrupt",
 						xid)));
 
 	/*
@@ -1698,6 +1756,13 @@ FinishPreparedTransactionExt(const char *gid,
 									   hdr->nsubxacts, children,
 									   hdr->nabortrels, abortrels);
 	ProcArrayRemove(proc, latestXid);
+#ifdef ADB
+	/* the outcome is final now, no need to ask AGTM for it later */
+	AgtmXidCacheStore(xid,
+					  isCommit ? TRANSACTION_STATUS_COMMITTED :
+								 TRANSACTION_STATUS_ABORTED,
+					  InvalidXLogRecPtr);
+#endif
 
 	/*
 	 * In case we fail while running the callbacks, mark the gxact invalid so
@@ -1742,7 +1807,18 @@ FinishPreparedTransactionExt(const char *gid,
 	 */
 	if (hdr->initfileinval)
 		RelationCacheInitFilePreInvalidate();
+#ifdef ADB
+	if (isCommit)
+		SharedPlanCacheInvalidateMessages(invalmsgs, hdr->ninvalmsgs);
+#endif
 	SendSharedInvalidMessages(invalmsgs, hdr->ninvalmsgs);
+#ifdef ADB
+	if (isCommit)
+	{
+		SharedCatCacheInvalidateMessages(invalmsgs, hdr->ninvalmsgs);
+		SharedPlanCacheInvalidateMessages(invalmsgs, hdr->ninvalmsgs);
+	}
+#endif
 	if (hdr->initfileinval)
 		RelationCacheInitFilePostInvalidate();
 
@@ -1758,11 +1834,11 @@ FinishPreparedTransactionExt(const char *gid,
 	AtEOXact_PgStat(isCommit);
 
 	/*
-	 * And now we can clean up our mess.
+	 * And now we can clean up our mess.  The gxact goes first, so that no
+	 * checkpoint writes its state file once we have looked for it.
 	 */
-	RemoveTwoPhaseFile(xid, true);
-
-	RemoveGXact(gxact);
+	if (RemoveGXact(gxact))
+		RemoveTwoPhaseFile(xid, true);
 	MyLockedGxact = NULL;
 
 #ifdef ADB
@@ -1915,85 +1991,53 @@ RecreateTwoPhaseFile(TransactionId xid, void *content, int len)
 void
 CheckPointTwoPhase(XLogRecPtr redo_horizon)
 {
-	TransactionId *xids;
-	int			nxids;
-	char		path[MAXPGPATH];
 	int			i;
 
 	/*
-	 * We don't want to hold the TwoPhaseStateLock while doing I/O, so we grab
-	 * it just long enough to make a list of the XIDs that require fsyncing,
-	 * and then do the I/O afterwards.
+	 * Write the state file of every transaction prepared before the redo
+	 * horizon which has none yet, reading its state data back from WAL:
+	 * replay will not go through its PREPARE record again.  The files
+	 * written at recovery were already fsync'd by RecreateTwoPhaseFile.
 	 *
-	 * This approach creates a race condition: someone else could delete a
-	 * GXACT between the time we release TwoPhaseStateLock and the time we try
-	 * to open its state file.  We handle this by special-casing ENOENT
-	 * failures: if we see that, we verify that the GXACT is no longer valid,
-	 * and if so ignore the failure.
+	 * TwoPhaseStateLock is held during the I/O, so that a transaction being
+	 * finished cannot leave its gxact before we are done with it; see
+	 * RemoveGXact.  Only the transactions lasting over a checkpoint get
+	 * there, so this is seldom much work.
 	 */
 	if (max_prepared_xacts <= 0)
 		return;					/* nothing to do */
 
 	TRACE_POSTGRESQL_TWOPHASE_CHECKPOINT_START();
 
-	xids = (TransactionId *) palloc(max_prepared_xacts * sizeof(TransactionId));
-	nxids = 0;
-
 	LWLockAcquire(TwoPhaseStateLock, LW_SHARED);
 
 	for (i = 0; i < TwoPhaseState->numPrepXacts; i++)
 	{
 		GlobalTransaction gxact = TwoPhaseState->prepXacts[i];
 		PGXACT	   *pgxact = &ProcGlobal->allPgXact[gxact->pgprocno];
+		char	   *buf;
+		int			len;
 
-		if (gxact->valid &&
-			gxact->prepare_lsn <= redo_horizon)
-			xids[nxids++] = pgxact->xid;
-	}
-
-	LWLockRelease(TwoPhaseStateLock);
-
-	for (i = 0; i < nxids; i++)
-	{
-		TransactionId xid = xids[i];
-		int			fd;
-
-		TwoPhaseFilePath(path, xid);
-
-		fd = OpenTransientFile(path, O_RDWR | PG_BINARY, 0);
-		if (fd < 0)
-		{
-			if (errno == ENOENT)
-			{
-				/* OK if gxact is no longer valid */
-				if (!TransactionIdIsPrepared(xid))
-					continue;
-				/* Restore errno in case it was changed */
-				errno = ENOENT;
-			}
-			ereport(ERROR,
-					(errcode_for_file_access(),
-					 errmsg("could not open two-phase state file \"%s\": %m",
-							path)));
-		}
-
-		if (pg_fsync(fd) != 0)
-		{
-			CloseTransientFile(fd);
-			ereport(ERROR,
-					(errcode_for_file_access(),
-					 errmsg("could not fsync two-phase state file \"%s\": %m",
-							path)));
-		}
+		if (!gxact->valid || gxact->ondisk ||
+			gxact->prepare_lsn > redo_horizon)
+			continue;
 
-		if (CloseTransientFile(fd) != 0)
+		buf = XlogReadTwoPhaseData(gxact->prepare_start_lsn,
+								   gxact->prepare_tli, pgxact->xid, &len);
+		if (buf == NULL)
 			ereport(ERROR,
-					(errcode_for_file_access(),
-					 errmsg("could not close two-phase state file \"%s\": %m",
-							path)));
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("could not read two-phase state data of transaction %u from WAL at %X/%X",
+							pgxact->xid,
+							(uint32) (gxact->prepare_start_lsn >> 32),
+							(uint32) gxact->prepare_start_lsn)));
+
+		RecreateTwoPhaseFile(pgxact->xid, buf, len);
+		gxact->ondisk = true;
+		pfree(buf);
 	}
 
-	pfree(xids);
+	LWLockRelease(TwoPhaseStateLock);
 
 	TRACE_POSTGRESQL_TWOPHASE_CHECKPOINT_DONE();
 }
@@ -2332,11 +2376,9 @@ RecoverPreparedTransactions(void)
 			 * Recreate its GXACT and dummy PGPROC
 			 *
 			 * Note: since we don't have the PREPARE record's WAL location at
-			 * hand, we leave prepare_lsn zeroes.  This means the GXACT will
-			 * be fsync'd on every future checkpoint.  We assume this
-			 * situation is infrequent enough that the performance cost is
-			 * negligible (especially since we know the state file has already
-			 * been fsynced).
+			 * hand, we leave prepare_lsn zeroes.  The GXACT is marked as
+			 * having its state file, which has already been fsynced, so no
+			 * checkpoint needs that location.
 			 */
 #ifdef ADB
 			gxact = MarkAsPreparing(xid, hdr->gid,
@@ -2348,6 +2390,7 @@ RecoverPreparedTransactions(void)
 									hdr->prepared_at,
 									hdr->owner, hdr->database);
 #endif
+			gxact->ondisk = true;
 			GXactLoadSubxactData(gxact, hdr->nsubxacts, subxids);
 			MarkAsPrepared(gxact);
 
@@ -31,6 +31,7 @@
 #include "libpq/pqformat.h"
 #include "libpq/libpq.h"
 #endif
+#include "access/heapam.h"
 #include "access/multixact.h"
 #include "access/subtrans.h"
 #include "access/transam.h"
@@ -75,7 +76,9 @@
 #endif
 
 #ifdef ADB
+#include "pgxc/datarowin.h"
 #include "pgxc/pause.h"
+#include "utils/waitevent.h"
 #endif
 
 /*
@@ -2229,6 +2232,9 @@ CommitTransaction(void)
 	Assert(s->parent == NULL);
 
 #ifdef ADB
+	/* the rows still pipelined to Datanodes are part of the transaction */
+	ExecFlushRemoteDMLBatch();
+
 	/*
 	 * If we are a Coordinator and currently serving the client,
 	 * we must run a 2PC if more than one nodes are involved in this
@@ -2266,9 +2272,12 @@ CommitTransaction(void)
 		/*
 		 * If the local node has done some write activity, prepare the local node
 		 * first. If that fails, the transaction is aborted on all the remote
-		 * nodes
+		 * nodes. Not every local write goes through a remote utility, so WAL
+		 * written by this transaction counts as one, and only a transaction
+		 * writing on a single remote node can then commit in one phase.
 		 */
-		if (IsTwoPhaseCommitRequired(XactWriteLocalNode))
+		if (IsTwoPhaseCommitRequired(XactWriteLocalNode ||
+									 XactLastRecEnd != 0))
 		{
 			prepareGID = MemoryContextAlloc(TopTransactionContext, 256);
 			sprintf(prepareGID, "T%u", GetTopTransactionId());
@@ -2471,6 +2480,7 @@ CommitTransaction(void)
 
 	/* Check we've released all buffer pins */
 	AtEOXact_Buffers(true);
+	AtEOXact_BulkInsert();
 
 	/* Clean up the relation cache */
 	AtEOXact_RelationCache(true);
@@ -2515,6 +2525,9 @@ CommitTransaction(void)
 
 	/* Check we've released all catcache entries */
 	AtEOXact_CatCache(true);
+#ifdef ADB
+	AtEOXact_DataRowIn();
+#endif
 
 	AtCommit_Notify();
 	AtEOXact_GUC(true, 1);
@@ -2622,6 +2635,11 @@ PrepareTransaction(void)
 			 TransStateAsString(s->state));
 	Assert(s->parent == NULL);
 
+#ifdef ADB
+	/* the remote rows must be done before anything is prepared */
+	ExecFlushRemoteDMLBatch();
+#endif
+
 	/*
 	 * Do pre-commit processing that involves calling user-defined code, such
 	 * as triggers.  Since closing cursors could queue trigger actions,
@@ -2809,6 +2827,7 @@ PrepareTransaction(void)
 
 	/* Check we've released all buffer pins */
 	AtEOXact_Buffers(true);
+	AtEOXact_BulkInsert();
 
 	/* Clean up the relation cache */
 	AtEOXact_RelationCache(true);
@@ -2843,6 +2862,9 @@ PrepareTransaction(void)
 
 	/* Check we've released all catcache entries */
 	AtEOXact_CatCache(true);
+#ifdef ADB
+	AtEOXact_DataRowIn();
+#endif
 
 	/* PREPARE acts the same as COMMIT as far as GUC is concerned */
 	AtEOXact_GUC(true, 1);
@@ -2972,6 +2994,9 @@ AbortTransaction(void)
 		agtm_AbortTransaction(NULL, false);
 		agtm_Close();
 	}
+
+	/* the statement which prefetched a snapshot is gone */
+	agtm_DropSnapShotPrefetch();
 #endif
 
 	/* Prevent cancel/die interrupt while cleaning up */
@@ -2988,6 +3013,9 @@ AbortTransaction(void)
 	 * while cleaning up!
 	 */
 	LWLockReleaseAll();
+#ifdef ADB
+	pgstat_clear_wait_event();
+#endif
 
 	/* Clean up buffer I/O and buffer context locks, too */
 	AbortBufferIO();
@@ -3079,6 +3107,7 @@ AbortTransaction(void)
 							 RESOURCE_RELEASE_BEFORE_LOCKS,
 							 false, true);
 		AtEOXact_Buffers(false);
+		AtEOXact_BulkInsert();
 		AtEOXact_RelationCache(false);
 		AtEOXact_Inval(false);
 		AtEOXact_MultiXact();
@@ -3090,6 +3119,9 @@ AbortTransaction(void)
 							 false, true);
 		smgrDoPendingDeletes(false);
 		AtEOXact_CatCache(false);
+#ifdef ADB
+		AtEOXact_DataRowIn();
+#endif
 
 		AtEOXact_GUC(false, 1);
 		AtEOXact_SPI(false);
@@ -4976,6 +5008,9 @@ AbortSubTransaction(void)
 	 * Buffer locks, for example?  I don't think so but I'm not sure.
 	 */
 	LWLockReleaseAll();
+#ifdef ADB
+	pgstat_clear_wait_event();
+#endif
 
 	AbortBufferIO();
 	UnlockBuffers();
@@ -5034,6 +5069,9 @@ AbortSubTransaction(void)
 								s->parent->subTransactionId);
 		AtSubAbort_Notify();
 
+		/* Log the page an aborted COPY left unlogged, see heapam.c */
+		AtSubAbort_BulkInsert();
+
 		/* Advertise the fact that we aborted in pg_clog. */
 		(void) RecordTransactionAbort(true);
 
@@ -635,3 +635,36 @@ pg_backup_start_time(PG_FUNCTION_ARGS)
 
 	PG_RETURN_DATUM(xtime);
 }
+
+#ifdef ADB
+/*
+ * Returns the numbers and sizes of the full-page images inserted since the
+ * server started: how many, how many compressed by wal_compression, their
+ * size with their holes removed, and the space they took in the WAL.
+ */
+Datum
+pg_xlog_compression_stats(PG_FUNCTION_ARGS)
+{
+	TupleDesc	tupdesc;
+	Datum		values[4];
+	bool		isnull[4];
+	uint64		images;
+	uint64		compressed;
+	uint64		imageBytes;
+	uint64		storedBytes;
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	GetFullPageImageStats(&images, &compressed, &imageBytes, &storedBytes);
+
+	values[0] = Int64GetDatum((int64) images);
+	values[1] = Int64GetDatum((int64) compressed);
+	values[2] = Int64GetDatum((int64) imageBytes);
+	values[3] = Int64GetDatum((int64) storedBytes);
+	MemSet(isnull, false, sizeof(isnull));
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(BlessTupleDesc(tupdesc),
+													  values, isnull)));
+}
+#endif   /* ADB */
@@ -0,0 +1,584 @@
+/*-------------------------------------------------------------------------
+ *
+ * xlogprefetch.c
+ *
+ *	  Prefetching of the data blocks WAL replay is about to read.
+ *
+ * Records are replayed one after another by the startup process, which
+ * waits for every data block it has to read.  On a standby receiving a
+ * heavy write load from its master this makes replay fall behind, the
+ * master writing its blocks with many backends at once.  We read the WAL
+ * a little ahead of replay with a second reader and ask the kernel to
+ * read the blocks the heap and btree records ahead will touch, so that
+ * replay finds them in the OS cache.
+ *
+ * The records of the heap and btree access methods make most of the WAL
+ * of a datanode, and the blocks they read are all known from what they
+ * log; other records are only looked at for the relation files they may
+ * change.
+ *
+ * The blocks are only hinted with smgrprefetch(), nothing is read into
+ * shared buffers or replayed out of order.  Blocks restored from a full
+ * page image, blocks already in shared buffers and blocks beyond the end
+ * of their relation are left alone.  The read-ahead only sees the WAL
+ * already in pg_xlog: it stops at the end of what the WAL receiver wrote,
+ * and does nothing for segments restored from the archive.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/access/transam/xlogprefetch.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "access/heapam_xlog.h"
+#include "access/nbtree.h"
+#include "access/rmgr.h"
+#include "access/xact.h"
+#include "access/xlog.h"
+#include "access/xlog_internal.h"
+#include "access/xlogprefetch.h"
+#include "access/xlogreader.h"
+#include "storage/buf_internals.h"
+#include "storage/fd.h"
+#include "storage/smgr.h"
+
+/* GUC parameter */
+int			recovery_prefetch_distance = 128;
+
+/* Blocks prefetched lately, not to hint them again */
+#define PREFETCH_RECENT_BLOCKS	16
+
+/* Relations whose existence and size are remembered */
+#define PREFETCH_RELATIONS		16
+
+typedef struct PrefetchBlock
+{
+	RelFileNode rnode;
+	BlockNumber blkno;
+} PrefetchBlock;
+
+typedef struct PrefetchRelation
+{
+	RelFileNode rnode;
+	bool		exists;
+	BlockNumber nblocks;		/* size when last looked at */
+} PrefetchRelation;
+
+struct XLogPrefetcher
+{
+	XLogReaderState *reader;
+	TimeLineID	tli;			/* timeline the reader is on */
+	bool		started;		/* reader positioned on the replayed WAL? */
+	XLogRecPtr	limitPtr;		/* don't read the WAL past this */
+	XLogRecPtr	stallPtr;		/* failed to read, retry once replay is here */
+	XLogRecPtr	forgetPtr;		/* relations may change until replay is here */
+
+	/* segment of pg_xlog open for the reader */
+	int			readFile;
+	XLogSegNo	readSegNo;
+	TimeLineID	readTLI;
+
+	PrefetchBlock recent[PREFETCH_RECENT_BLOCKS];
+	int			nextRecent;
+	PrefetchRelation rels[PREFETCH_RELATIONS];
+	int			nrels;
+	int			nextRel;
+};
+
+#ifdef USE_PREFETCH
+
+static int XLogPrefetcherReadPage(XLogReaderState *reader,
+					   XLogRecPtr targetPagePtr, int reqLen,
+					   XLogRecPtr targetRecPtr, char *readBuf,
+					   TimeLineID *pageTLI);
+static void PrefetchRecordBlocks(XLogPrefetcher *prefetcher,
+					 XLogRecord *record, XLogRecPtr endPtr);
+static void PrefetchBlockOf(XLogPrefetcher *prefetcher, XLogRecord *record,
+				int bkpno, RelFileNode rnode, BlockNumber blkno);
+static bool BlockIsBuffered(RelFileNode rnode, BlockNumber blkno);
+static void ForgetRelations(XLogPrefetcher *prefetcher);
+
+#endif   /* USE_PREFETCH */
+
+/*
+ * Allocate a prefetcher for the startup process.  Returns NULL if blocks
+ * cannot be prefetched on this platform.
+ */
+XLogPrefetcher *
+XLogPrefetcherAllocate(void)
+{
+#ifdef USE_PREFETCH
+	XLogPrefetcher *prefetcher;
+
+	prefetcher = (XLogPrefetcher *) palloc0(sizeof(XLogPrefetcher));
+	prefetcher->reader = XLogReaderAllocate(XLogPrefetcherReadPage, prefetcher);
+	if (prefetcher->reader == NULL)
+	{
+		/* prefetching is not worth failing the recovery for */
+		pfree(prefetcher);
+		return NULL;
+	}
+	prefetcher->reader->system_identifier = GetSystemIdentifier();
+	prefetcher->readFile = -1;
+
+	return prefetcher;
+#else
+	return NULL;
+#endif   /* USE_PREFETCH */
+}
+
+void
+XLogPrefetcherFree(XLogPrefetcher *prefetcher)
+{
+	if (prefetcher == NULL)
+		return;
+
+	if (prefetcher->readFile >= 0)
+		close(prefetcher->readFile);
+	XLogReaderFree(prefetcher->reader);
+	pfree(prefetcher);
+}
+
+/*
+ * XLogPrefetcherReadAhead
+ *
+ * Prefetch the blocks of the records up to recovery_prefetch_distance
+ * ahead of "replayPtr", the start of the next record to replay on
+ * timeline "tli".  The WAL is not read past "limitPtr" when it is valid.
+ */
+void
+XLogPrefetcherReadAhead(XLogPrefetcher *prefetcher, XLogRecPtr replayPtr,
+						TimeLineID tli, XLogRecPtr limitPtr)
+{
+#ifdef USE_PREFETCH
+	XLogReaderState *reader;
+	XLogRecPtr	targetPtr;
+
+	if (prefetcher == NULL || recovery_prefetch_distance <= 0)
+		return;
+	reader = prefetcher->reader;
+
+	/*
+	 * Start over from the replayed record when we begin, when replay
+	 * overtook us and when it went to another timeline.
+	 */
+	if (!prefetcher->started || prefetcher->tli != tli ||
+		reader->EndRecPtr < replayPtr)
+	{
+		reader->EndRecPtr = replayPtr;
+		reader->ReadRecPtr = InvalidXLogRecPtr;
+		prefetcher->tli = tli;
+		prefetcher->started = true;
+		prefetcher->stallPtr = InvalidXLogRecPtr;
+		ForgetRelations(prefetcher);
+	}
+	else if (!XLogRecPtrIsInvalid(prefetcher->stallPtr))
+	{
+		if (replayPtr < prefetcher->stallPtr)
+			return;
+		prefetcher->stallPtr = InvalidXLogRecPtr;
+	}
+
+	/* replay went past the records that changed the relations */
+	if (!XLogRecPtrIsInvalid(prefetcher->forgetPtr) &&
+		replayPtr >= prefetcher->forgetPtr)
+		ForgetRelations(prefetcher);
+
+	prefetcher->limitPtr = limitPtr;
+	targetPtr = replayPtr + (XLogRecPtr) recovery_prefetch_distance * 1024;
+
+	while (reader->EndRecPtr < targetPtr)
+	{
+		XLogRecord *record;
+		char	   *errormsg;
+
+		record = XLogReadRecord(reader, InvalidXLogRecPtr, &errormsg);
+		if (record == NULL)
+		{
+			/*
+			 * Most likely the WAL is not there yet.  The reader stays where
+			 * it was, try again when replay made some progress.
+			 */
+			prefetcher->stallPtr = replayPtr + XLOG_BLCKSZ;
+			break;
+		}
+
+		PrefetchRecordBlocks(prefetcher, record, reader->EndRecPtr);
+	}
+#endif   /* USE_PREFETCH */
+}
+
+#ifdef USE_PREFETCH
+
+/*
+ * read_page callback of the reader, reading the segments of pg_xlog.
+ */
+static int
+XLogPrefetcherReadPage(XLogReaderState *reader, XLogRecPtr targetPagePtr,
+					   int reqLen, XLogRecPtr targetRecPtr, char *readBuf,
+					   TimeLineID *pageTLI)
+{
+	XLogPrefetcher *prefetcher = (XLogPrefetcher *) reader->private_data;
+	XLogSegNo	targetSegNo;
+	uint32		targetPageOff;
+	int			readLen = XLOG_BLCKSZ;
+
+	if (!XLogRecPtrIsInvalid(prefetcher->limitPtr))
+	{
+		if (targetPagePtr + reqLen > prefetcher->limitPtr)
+			return -1;
+		if (targetPagePtr + XLOG_BLCKSZ > prefetcher->limitPtr)
+			readLen = (int) (prefetcher->limitPtr - targetPagePtr);
+	}
+
+	XLByteToSeg(targetPagePtr, targetSegNo);
+	targetPageOff = targetPagePtr % XLogSegSize;
+
+	if (prefetcher->readFile >= 0 &&
+		(prefetcher->readSegNo != targetSegNo ||
+		 prefetcher->readTLI != prefetcher->tli))
+	{
+		close(prefetcher->readFile);
+		prefetcher->readFile = -1;
+	}
+
+	if (prefetcher->readFile < 0)
+	{
+		char		path[MAXPGPATH];
+
+		XLogFilePath(path, prefetcher->tli, targetSegNo);
+		prefetcher->readFile = BasicOpenFile(path, O_RDONLY | PG_BINARY, 0);
+		if (prefetcher->readFile < 0)
+			return -1;
+		prefetcher->readSegNo = targetSegNo;
+		prefetcher->readTLI = prefetcher->tli;
+	}
+
+	if (lseek(prefetcher->readFile, (off_t) targetPageOff, SEEK_SET) < 0 ||
+		read(prefetcher->readFile, readBuf, readLen) != readLen)
+		return -1;
+
+	*pageTLI = prefetcher->tli;
+	return readLen;
+}
+
+/*
+ * Prefetch the blocks replaying "record" will read, "endPtr" being the
+ * end of the record.
+ */
+static void
+PrefetchRecordBlocks(XLogPrefetcher *prefetcher, XLogRecord *record,
+					 XLogRecPtr endPtr)
+{
+	uint8		info = record->xl_info & ~XLR_INFO_MASK;
+	char	   *data = XLogRecGetData(record);
+
+	switch (record->xl_rmid)
+	{
+		case RM_HEAP_ID:
+			switch (info & XLOG_HEAP_OPMASK)
+			{
+				case XLOG_HEAP_INSERT:
+				case XLOG_HEAP_DELETE:
+				case XLOG_HEAP_LOCK:
+				case XLOG_HEAP_INPLACE:
+					{
+						/* all of them begin with the tuple they change */
+						xl_heaptid *target = (xl_heaptid *) data;
+
+						if (record->xl_len < SizeOfHeapTid ||
+							(info & XLOG_HEAP_INIT_PAGE))
+							break;
+						PrefetchBlockOf(prefetcher, record, 0, target->node,
+									ItemPointerGetBlockNumber(&target->tid));
+					}
+					break;
+				case XLOG_HEAP_UPDATE:
+				case XLOG_HEAP_HOT_UPDATE:
+					{
+						xl_heap_update *xlrec = (xl_heap_update *) data;
+						BlockNumber oldblk;
+						BlockNumber newblk;
+
+						if (record->xl_len < SizeOfHeapUpdate)
+							break;
+						oldblk = ItemPointerGetBlockNumber(&xlrec->target.tid);
+						newblk = ItemPointerGetBlockNumber(&xlrec->newtid);
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->target.node, oldblk);
+						if (newblk != oldblk && !(info & XLOG_HEAP_INIT_PAGE))
+							PrefetchBlockOf(prefetcher, record, 1,
+											xlrec->target.node, newblk);
+					}
+					break;
+			}
+			break;
+
+		case RM_HEAP2_ID:
+			switch (info & XLOG_HEAP_OPMASK)
+			{
+				case XLOG_HEAP2_CLEAN:
+					{
+						xl_heap_clean *xlrec = (xl_heap_clean *) data;
+
+						if (record->xl_len < SizeOfHeapClean)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->node, xlrec->block);
+					}
+					break;
+				case XLOG_HEAP2_FREEZE:
+					{
+						xl_heap_freeze *xlrec = (xl_heap_freeze *) data;
+
+						if (record->xl_len < SizeOfHeapFreeze)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->node, xlrec->block);
+					}
+					break;
+				case XLOG_HEAP2_FREEZE_PAGE:
+					{
+						xl_heap_freeze_page *xlrec;
+
+						xlrec = (xl_heap_freeze_page *) data;
+						if (record->xl_len < SizeOfHeapFreezePage)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->node, xlrec->block);
+					}
+					break;
+				case XLOG_HEAP2_VISIBLE:
+					{
+						xl_heap_visible *xlrec = (xl_heap_visible *) data;
+
+						/* the heap page comes after the visibility map one */
+						if (record->xl_len < SizeOfHeapVisible)
+							break;
+						PrefetchBlockOf(prefetcher, record, 1,
+										xlrec->node, xlrec->block);
+					}
+					break;
+				case XLOG_HEAP2_MULTI_INSERT:
+					{
+						xl_heap_multi_insert *xlrec;
+
+						xlrec = (xl_heap_multi_insert *) data;
+						if (record->xl_len < SizeOfHeapMultiInsert ||
+							(info & XLOG_HEAP_INIT_PAGE))
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->node, xlrec->blkno);
+					}
+					break;
+				case XLOG_HEAP2_LOCK_UPDATED:
+					{
+						xl_heaptid *target = (xl_heaptid *) data;
+
+						if (record->xl_len < SizeOfHeapTid)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0, target->node,
+									ItemPointerGetBlockNumber(&target->tid));
+					}
+					break;
+			}
+			break;
+
+		case RM_BTREE_ID:
+			switch (info)
+			{
+				case XLOG_BTREE_INSERT_LEAF:
+				case XLOG_BTREE_INSERT_UPPER:
+				case XLOG_BTREE_INSERT_META:
+					{
+						xl_btree_insert *xlrec = (xl_btree_insert *) data;
+
+						if (record->xl_len < SizeOfBtreeInsert)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->target.node,
+							  ItemPointerGetBlockNumber(&xlrec->target.tid));
+					}
+					break;
+				case XLOG_BTREE_SPLIT_L:
+				case XLOG_BTREE_SPLIT_R:
+				case XLOG_BTREE_SPLIT_L_ROOT:
+				case XLOG_BTREE_SPLIT_R_ROOT:
+					{
+						xl_btree_split *xlrec = (xl_btree_split *) data;
+
+						/* the new right page is initialized, not read */
+						if (record->xl_len < SizeOfBtreeSplit)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->node, xlrec->leftsib);
+						if (xlrec->rnext != P_NONE)
+							PrefetchBlockOf(prefetcher, record, 1,
+											xlrec->node, xlrec->rnext);
+					}
+					break;
+				case XLOG_BTREE_VACUUM:
+					{
+						xl_btree_vacuum *xlrec = (xl_btree_vacuum *) data;
+
+						if (record->xl_len < SizeOfBtreeVacuum)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->node, xlrec->block);
+					}
+					break;
+				case XLOG_BTREE_DELETE:
+					{
+						xl_btree_delete *xlrec = (xl_btree_delete *) data;
+
+						if (record->xl_len < SizeOfBtreeDelete)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->node, xlrec->block);
+					}
+					break;
+				case XLOG_BTREE_DEDUP:
+					{
+						xl_btree_dedup *xlrec = (xl_btree_dedup *) data;
+
+						if (record->xl_len < SizeOfBtreeDedup)
+							break;
+						PrefetchBlockOf(prefetcher, record, 0,
+										xlrec->node, xlrec->block);
+					}
+					break;
+			}
+			break;
+
+		case RM_XACT_ID:
+			/* plain commits and aborts neither drop nor truncate anything */
+			if (info != XLOG_XACT_COMMIT &&
+				info != XLOG_XACT_ABORT &&
+				info != XLOG_XACT_COMMIT_PREPARED &&
+				info != XLOG_XACT_ABORT_PREPARED)
+				break;
+			/* FALL THRU */
+		case RM_SMGR_ID:
+		case RM_DBASE_ID:
+		case RM_TBLSPC_ID:
+
+			/*
+			 * Relation files may be created, truncated or dropped when this
+			 * record is replayed.  Don't trust what we know about them until
+			 * then.
+			 */
+			ForgetRelations(prefetcher);
+			prefetcher->forgetPtr = endPtr;
+			break;
+	}
+}
+
+/*
+ * Prefetch block "blkno" of the main fork of "rnode", the "bkpno"th block
+ * of "record", unless the record restores it from a full page image.
+ */
+static void
+PrefetchBlockOf(XLogPrefetcher *prefetcher, XLogRecord *record, int bkpno,
+				RelFileNode rnode, BlockNumber blkno)
+{
+	PrefetchRelation *rel = NULL;
+	int			i;
+
+	if (record->xl_info & XLR_BKP_BLOCK(bkpno))
+		return;
+
+	/* relation files may change before replay gets there */
+	if (!XLogRecPtrIsInvalid(prefetcher->forgetPtr))
+		return;
+
+	for (i = 0; i < PREFETCH_RECENT_BLOCKS; i++)
+	{
+		if (prefetcher->recent[i].blkno == blkno &&
+			RelFileNodeEquals(prefetcher->recent[i].rnode, rnode))
+			return;
+	}
+
+	if (BlockIsBuffered(rnode, blkno))
+		return;
+
+	/*
+	 * smgrprefetch() wants an existing block: in recovery, md.c would add
+	 * the segments missing before it.
+	 */
+	for (i = 0; i < prefetcher->nrels; i++)
+	{
+		if (RelFileNodeEquals(prefetcher->rels[i].rnode, rnode))
+		{
+			rel = &prefetcher->rels[i];
+			break;
+		}
+	}
+
+	if (rel == NULL)
+	{
+		rel = &prefetcher->rels[prefetcher->nextRel];
+		prefetcher->nextRel = (prefetcher->nextRel + 1) % PREFETCH_RELATIONS;
+		if (prefetcher->nrels < PREFETCH_RELATIONS)
+			prefetcher->nrels++;
+
+		rel->rnode = rnode;
+		rel->exists = smgrexists(smgropen(rnode, InvalidBackendId),
+								 MAIN_FORKNUM);
+		rel->nblocks = 0;
+	}
+
+	if (!rel->exists)
+		return;
+	if (blkno >= rel->nblocks)
+	{
+		/* replay may have extended it since */
+		rel->nblocks = smgrnblocks(smgropen(rnode, InvalidBackendId),
+								   MAIN_FORKNUM);
+		if (blkno >= rel->nblocks)
+			return;
+	}
+
+	smgrprefetch(smgropen(rnode, InvalidBackendId), MAIN_FORKNUM, blkno);
+
+	prefetcher->recent[prefetcher->nextRecent].rnode = rnode;
+	prefetcher->recent[prefetcher->nextRecent].blkno = blkno;
+	prefetcher->nextRecent = (prefetcher->nextRecent + 1) % PREFETCH_RECENT_BLOCKS;
+}
+
+/* Is the block of the main fork in shared buffers? */
+static bool
+BlockIsBuffered(RelFileNode rnode, BlockNumber blkno)
+{
+	BufferTag	tag;
+	uint32		hashcode;
+	LWLockId	partitionLock;
+	int			buf_id;
+
+	INIT_BUFFERTAG(tag, rnode, MAIN_FORKNUM, blkno);
+	hashcode = BufTableHashCode(&tag);
+	partitionLock = BufMappingPartitionLock(hashcode);
+
+	LWLockAcquire(partitionLock, LW_SHARED);
+	buf_id = BufTableLookup(&tag, hashcode);
+	LWLockRelease(partitionLock);
+
+	return buf_id >= 0;
+}
+
+static void
+ForgetRelations(XLogPrefetcher *prefetcher)
+{
+	prefetcher->nrels = 0;
+	prefetcher->nextRel = 0;
+	prefetcher->forgetPtr = InvalidXLogRecPtr;
+	MemSet(prefetcher->recent, 0, sizeof(prefetcher->recent));
+	prefetcher->nextRecent = 0;
+}
+
+#endif   /* USE_PREFETCH */
@@ -705,6 +705,20 @@ ValidXLogRecord(XLogReaderState *state, XLogRecord *record, XLogRecPtr recptr)
 		}
 		memcpy(&bkpb, blk, sizeof(BkpBlock));
 
+#ifdef ADB
+		if (bkpb.hole_offset & BKPBLOCK_COMPRESSED)
+		{
+			/* the hole is checked when the image is decompressed */
+			if (bkpb.hole_length >= BLCKSZ)
+			{
+				report_invalid_record(state,
+						"incorrect compressed image size in record at %X/%X",
+								  (uint32) (recptr >> 32), (uint32) recptr);
+				return false;
+			}
+		}
+		else
+#endif
 		if (bkpb.hole_offset + bkpb.hole_length > BLCKSZ)
 		{
 			report_invalid_record(state,
@@ -0,0 +1,38 @@
+# 0 "adb_ha_sync_log.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "adb_ha_sync_log.h.c"
+# 18 "adb_ha_sync_log.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 19 "adb_ha_sync_log.h.c" 2
+# 30 "adb_ha_sync_log.h.c"
+CATALOG(adb_ha_sync_log,5005) BKI_SHARED_RELATION
+{
+ int64 gxid;
+ int32 cmdid;
+ timestamptz create_time;
+ timestamptz finish_time;
+ char sql_gram;
+ char sql_kind;
+ NameData sql_schema;
+
+ text query_sql;
+ text params;
+
+} FormData_adb_ha_sync_log;
+
+
+
+
+
+typedef FormData_adb_ha_sync_log *Form_adb_ha_sync_log;
+# 76 "adb_ha_sync_log.h.c"
+extern void AddAdbHaSyncLog(TimestampTz create_time,
+       ParseGrammar sql_gram,
+       char sql_kind,
+       const char *query_sql,
+       ParamListInfo params);
+
+extern bool AdbHaSyncLogWalkerPortal(Portal portal);
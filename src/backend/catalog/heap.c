@@ -87,7 +87,9 @@
 #include "catalog/namespace.h"
 #include "commands/dbcommands.h"
 #include "nodes/makefuncs.h"
+#include "optimizer/clauses.h"
 #include "parser/parse_func.h"
+#include "utils/typcache.h"
 
 extern bool distribute_by_replication_default;
 #endif
@@ -140,6 +142,9 @@ static void GetUserDefinedDistribution(Oid relid,
 				Oid *funcid,
 				int *numatts,
 				int16 **attnums);
+static Const *transformDistributionValue(ParseState *pstate,
+				Node *value,
+				Form_pg_attribute attr);
 #endif
 
 /* ----------------------------------------------------------------
@@ -1361,6 +1366,7 @@ AddRelationDistribution(Oid relid,
 	Oid funcid = InvalidOid;
 	int numatts = 0;
 	int16 *attnums = NULL;
+	List *distvalues = NIL;
 #endif
 
 	/* Obtain details of nodes and classify them */
@@ -1381,6 +1387,15 @@ AddRelationDistribution(Oid relid,
 #endif
 							 );
 
+#ifdef ADB
+	/* Bounds or values of each node */
+	if (IsLocatorDistributedByRangeOrList(locatortype))
+		distvalues = GetRelationDistributionValues(distributeby,
+												   descriptor,
+												   attnum,
+												   numnodes);
+#endif
+
 	/* Now OK to insert data in catalog */
 	PgxcClassCreate(relid, locatortype, attnum, hashalgorithm,
 					hashbuckets, numnodes, nodeoids
@@ -1388,6 +1403,7 @@ AddRelationDistribution(Oid relid,
 					, funcid
 					, numatts
 					, attnums
+					, distvalues
 #endif
 					);
 
@@ -1584,6 +1600,55 @@ GetRelationDistributionItems(Oid relid,
 												   attnums);
 				}
 				break;
+
+			case DISTTYPE_BUCKET:
+				/*
+				 * Validate user-specified bucket column.
+				 * System columns cannot be used.
+				 */
+				local_attnum = get_attnum(relid, distributeby->colname);
+				if (local_attnum <= 0 && local_attnum >= -(int) lengthof(SysAtt))
+				{
+					ereport(ERROR,
+						(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+						 errmsg("Invalid distribution column specified")));
+				}
+
+				if (!IsTypeDistributable(descriptor->attrs[local_attnum - 1]->atttypid))
+				{
+					ereport(ERROR,
+						(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+						 errmsg("Column %s is not a bucket distributable data type",
+							distributeby->colname)));
+				}
+				local_locatortype = LOCATOR_TYPE_BUCKET;
+				break;
+
+			case DISTTYPE_RANGE:
+			case DISTTYPE_LIST:
+				/*
+				 * Validate user-specified range or list column.
+				 * System columns cannot be used.
+				 */
+				local_attnum = get_attnum(relid, distributeby->colname);
+				if (local_attnum <= 0 && local_attnum >= -(int) lengthof(SysAtt))
+				{
+					ereport(ERROR,
+						(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+						 errmsg("Invalid distribution column specified")));
+				}
+
+				if (!IsTypeDistributable(descriptor->attrs[local_attnum - 1]->atttypid))
+				{
+					ereport(ERROR,
+						(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+						 errmsg("Column %s is not a %s distributable data type",
+							distributeby->colname,
+							distributeby->disttype == DISTTYPE_RANGE ? "range" : "list")));
+				}
+				local_locatortype = distributeby->disttype == DISTTYPE_RANGE ?
+					LOCATOR_TYPE_RANGE : LOCATOR_TYPE_LIST;
+				break;
 #endif
 			default:
 				ereport(ERROR,
@@ -1598,6 +1663,13 @@ GetRelationDistributionItems(Oid relid,
 		local_hashalgorithm = 1;
 		local_hashbuckets = HASH_SIZE;
 	}
+#ifdef ADB
+	else if (local_locatortype == LOCATOR_TYPE_BUCKET)
+	{
+		local_hashalgorithm = 1;
+		local_hashbuckets = LOCATOR_BUCKET_COUNT;
+	}
+#endif
 
 	/* Save results */
 	if (attnum)
@@ -1610,6 +1682,158 @@ GetRelationDistributionItems(Oid relid,
 		*locatortype = local_locatortype;
 }
 
+#ifdef ADB
+/*
+ * transformDistributionValue
+ * Transform a value given to DISTRIBUTE BY RANGE or LIST into a constant of
+ * the type of the distribution column.
+ */
+static Const *
+transformDistributionValue(ParseState *pstate, Node *value,
+						   Form_pg_attribute attr)
+{
+	Node   *expr;
+	Oid		exprtype;
+
+	expr = transformExpr(pstate, value, EXPR_KIND_OTHER);
+	exprtype = exprType(expr);
+	expr = coerce_to_target_type(pstate, expr, exprtype,
+								 attr->atttypid, attr->atttypmod,
+								 COERCION_ASSIGNMENT,
+								 COERCE_IMPLICIT_CAST,
+								 -1);
+	if (expr == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATATYPE_MISMATCH),
+				 errmsg("distribution column \"%s\" is of type %s but value is of type %s",
+						NameStr(attr->attname),
+						format_type_be(attr->atttypid),
+						format_type_be(exprtype))));
+	assign_expr_collations(pstate, expr);
+
+	expr = eval_const_expressions(NULL, expr);
+	if (!IsA(expr, Const) || ((Const *) expr)->constisnull)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+				 errmsg("values of a range or list distribution must be non-null constants")));
+
+	return (Const *) expr;
+}
+
+/*
+ * GetRelationDistributionValues
+ * Check the bounds of DISTRIBUTE BY RANGE or the values of DISTRIBUTE BY
+ * LIST for a relation on "numnodes" nodes, ordered as in pgxc_class, or
+ * on any number of nodes if "numnodes" is negative. For a range, this
+ * returns the Const lower bounds of all the nodes but the first one, in
+ * ascending order. For a list, this returns for each node the List of its
+ * Const values, a value being given to a single node.
+ */
+List *
+GetRelationDistributionValues(DistributeBy *distributeby,
+							  TupleDesc descriptor,
+							  AttrNumber attnum,
+							  int numnodes)
+{
+	Form_pg_attribute attr;
+	TypeCacheEntry *typentry;
+	ParseState *pstate;
+	List	   *result = NIL;
+	List	   *seen = NIL;
+	Const	   *prev = NULL;
+	ListCell   *lc;
+	bool		is_range = (distributeby->disttype == DISTTYPE_RANGE);
+
+	Assert(distributeby->disttype == DISTTYPE_RANGE ||
+		   distributeby->disttype == DISTTYPE_LIST);
+	Assert(attnum > 0 && attnum <= descriptor->natts);
+	attr = descriptor->attrs[attnum - 1];
+
+	/* Values are routed by a binary search */
+	typentry = lookup_type_cache(attr->atttypid, TYPECACHE_CMP_PROC_FINFO);
+	if (!OidIsValid(typentry->cmp_proc_finfo.fn_oid))
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_FUNCTION),
+				 errmsg("could not identify a comparison function for type %s",
+						format_type_be(attr->atttypid))));
+
+	if (is_range && numnodes >= 0 &&
+		list_length(distributeby->funcargs) != numnodes - 1)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+				 errmsg("%d bounds given for a range distribution on %d nodes",
+						list_length(distributeby->funcargs), numnodes),
+				 errhint("Each node but the first one needs the lower bound of its values.")));
+	if (!is_range && numnodes >= 0 &&
+		list_length(distributeby->funcargs) != numnodes)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+				 errmsg("%d lists of values given for a list distribution on %d nodes",
+						list_length(distributeby->funcargs), numnodes),
+				 errhint("Each node needs a value or a row of values.")));
+
+	pstate = make_parsestate(NULL);
+	foreach(lc, distributeby->funcargs)
+	{
+		Node	   *arg = (Node *) lfirst(lc);
+		List	   *items;
+		List	   *values = NIL;
+		ListCell   *item;
+
+		if (is_range)
+		{
+			Const  *bound = transformDistributionValue(pstate, arg, attr);
+
+			if (prev &&
+				DatumGetInt32(FunctionCall2Coll(&typentry->cmp_proc_finfo,
+												attr->attcollation,
+												prev->constvalue,
+												bound->constvalue)) >= 0)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+						 errmsg("bounds of a range distribution must be in ascending order")));
+			result = lappend(result, bound);
+			prev = bound;
+			continue;
+		}
+
+		/* A node of a list takes one value or a row of them */
+		if (IsA(arg, RowExpr))
+			items = ((RowExpr *) arg)->args;
+		else
+			items = list_make1(arg);
+		if (items == NIL)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+					 errmsg("each node of a list distribution needs at least one value")));
+
+		foreach(item, items)
+		{
+			Const	   *value = transformDistributionValue(pstate, lfirst(item), attr);
+			ListCell   *other;
+
+			foreach(other, seen)
+			{
+				if (DatumGetInt32(FunctionCall2Coll(&typentry->cmp_proc_finfo,
+													attr->attcollation,
+													((Const *) lfirst(other))->constvalue,
+													value->constvalue)) == 0)
+					ereport(ERROR,
+							(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+							 errmsg("value of a list distribution given to more than one node")));
+			}
+			seen = lappend(seen, value);
+			values = lappend(values, value);
+		}
+		result = lappend(result, values);
+	}
+	free_parsestate(pstate);
+	list_free(seen);
+
+	return result;
+}
+#endif
+
 
 /*
  * BuildRelationDistributionNodes
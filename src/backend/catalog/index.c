@@ -2128,6 +2128,37 @@ IndexBuildHeapScan(Relation heapRelation,
 				   bool allow_sync,
 				   IndexBuildCallback callback,
 				   void *callback_state)
+{
+	return IndexBuildHeapRangeScan(heapRelation, indexRelation,
+								   indexInfo, allow_sync,
+								   false,
+								   0, InvalidBlockNumber,
+								   callback, callback_state);
+}
+
+/*
+ * As above, except that instead of scanning the complete heap, only the given
+ * number of blocks are scanned.  Scan to end-of-rel can be signalled by
+ * passing InvalidBlockNumber as numblocks.  Note that restricting the range
+ * to scan cannot be done when requesting syncscan.
+ *
+ * When "anyvisible" mode is requested, all tuples visible to any transaction
+ * are indexed, without waiting for in-progress transactions and without
+ * complaining about them; they are passed under their own TIDs, not those
+ * of their HOT chain roots.  This is meant for summarizing indexes, which
+ * only care about the heap block a tuple lives in, and which run while the
+ * table is being modified concurrently.
+ */
+double
+IndexBuildHeapRangeScan(Relation heapRelation,
+						Relation indexRelation,
+						IndexInfo *indexInfo,
+						bool allow_sync,
+						bool anyvisible,
+						BlockNumber start_blockno,
+						BlockNumber numblocks,
+						IndexBuildCallback callback,
+						void *callback_state)
 {
 	bool		is_system_catalog;
 	bool		checking_uniqueness;
@@ -2204,6 +2235,13 @@ IndexBuildHeapScan(Relation heapRelation,
 								true,	/* buffer access strategy OK */
 								allow_sync);	/* syncscan OK? */
 
+	/* set our scan endpoints */
+	if (start_blockno != 0 || numblocks != InvalidBlockNumber)
+	{
+		Assert(!allow_sync);
+		heap_setscanlimits(scan, start_blockno, numblocks);
+	}
+
 	reltuples = 0;
 
 	/*
@@ -2240,7 +2278,7 @@ IndexBuildHeapScan(Relation heapRelation,
 		 * tuple per HOT-chain --- else we could create more than one index
 		 * entry pointing to the same root tuple.
 		 */
-		if (scan->rs_cblock != root_blkno)
+		if (!anyvisible && scan->rs_cblock != root_blkno)
 		{
 			Page		page = BufferGetPage(scan->rs_cbuf);
 
@@ -2293,7 +2331,7 @@ IndexBuildHeapScan(Relation heapRelation,
 					 * breaks semantics for pre-existing snapshots, mark the
 					 * index as unusable for them.
 					 */
-					if (HeapTupleIsHotUpdated(heapTuple))
+					if (HeapTupleIsHotUpdated(heapTuple) && !anyvisible)
 					{
 						indexIt = false;
 						/* mark the index as unsafe for old snapshots */
@@ -2306,6 +2344,17 @@ IndexBuildHeapScan(Relation heapRelation,
 					break;
 				case HEAPTUPLE_INSERT_IN_PROGRESS:
 
+					/*
+					 * In "anyvisible" mode, this tuple is visible and we
+					 * don't need any further checks.
+					 */
+					if (anyvisible)
+					{
+						indexIt = true;
+						tupleIsAlive = true;
+						break;
+					}
+
 					/*
 					 * Since caller should hold ShareLock or better, normally
 					 * the only way to see this is if it was inserted earlier
@@ -2348,6 +2397,17 @@ IndexBuildHeapScan(Relation heapRelation,
 					break;
 				case HEAPTUPLE_DELETE_IN_PROGRESS:
 
+					/*
+					 * In "anyvisible" mode, the tuple is simply indexed, the
+					 * same as a RECENTLY_DEAD one.
+					 */
+					if (anyvisible)
+					{
+						indexIt = true;
+						tupleIsAlive = false;
+						break;
+					}
+
 					/*
 					 * As with INSERT_IN_PROGRESS case, this is unexpected
 					 * unless it's our own deletion or a system catalog.
@@ -2466,7 +2526,7 @@ IndexBuildHeapScan(Relation heapRelation,
 		 * pass the values[] and isnull[] arrays, instead.
 		 */
 
-		if (HeapTupleIsHeapOnly(heapTuple))
+		if (HeapTupleIsHeapOnly(heapTuple) && !anyvisible)
 		{
 			/*
 			 * For a heap-only tuple, pretend its TID is that of the root. See
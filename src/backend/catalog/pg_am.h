@@ -0,0 +1,72 @@
+# 0 "pg_am.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_am.h.c"
+# 26 "pg_am.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 27 "pg_am.h.c" 2
+# 38 "pg_am.h.c"
+CATALOG(pg_am,2601)
+{
+ NameData amname;
+ int16 amstrategies;
+
+
+
+ int16 amsupport;
+
+ bool amcanorder;
+ bool amcanorderbyop;
+ bool amcanbackward;
+ bool amcanunique;
+ bool amcanmulticol;
+ bool amoptionalkey;
+ bool amsearcharray;
+ bool amsearchnulls;
+ bool amstorage;
+ bool amclusterable;
+ bool ampredlocks;
+ Oid amkeytype;
+ regproc aminsert;
+ regproc ambeginscan;
+ regproc amgettuple;
+ regproc amgetbitmap;
+ regproc amrescan;
+ regproc amendscan;
+ regproc ammarkpos;
+ regproc amrestrpos;
+ regproc ambuild;
+ regproc ambuildempty;
+ regproc ambulkdelete;
+ regproc amvacuumcleanup;
+ regproc amcanreturn;
+ regproc amcostestimate;
+ regproc amoptions;
+} FormData_pg_am;
+
+
+
+
+
+
+typedef FormData_pg_am *Form_pg_am;
+# 124 "pg_am.h.c"
+DATA(insert OID = 403 ( btree 5 2 t f t t t t t t f t t 0 btinsert btbeginscan btgettuple btgetbitmap btrescan btendscan btmarkpos btrestrpos btbuild btbuildempty btbulkdelete btvacuumcleanup btcanreturn btcostestimate btoptions ));
+DESCR("b-tree index access method");
+
+DATA(insert OID = 405 ( hash 1 1 f f t f f f f f f f f 23 hashinsert hashbeginscan hashgettuple hashgetbitmap hashrescan hashendscan hashmarkpos hashrestrpos hashbuild hashbuildempty hashbulkdelete hashvacuumcleanup - hashcostestimate hashoptions ));
+DESCR("hash index access method");
+
+DATA(insert OID = 783 ( gist 0 8 f t f f t t f t t t f 0 gistinsert gistbeginscan gistgettuple gistgetbitmap gistrescan gistendscan gistmarkpos gistrestrpos gistbuild gistbuildempty gistbulkdelete gistvacuumcleanup - gistcostestimate gistoptions ));
+DESCR("GiST index access method");
+
+DATA(insert OID = 2742 ( gin 0 5 f f f f t t f f t f f 0 gininsert ginbeginscan - gingetbitmap ginrescan ginendscan ginmarkpos ginrestrpos ginbuild ginbuildempty ginbulkdelete ginvacuumcleanup - gincostestimate ginoptions ));
+DESCR("GIN index access method");
+
+DATA(insert OID = 4000 ( spgist 0 5 f f f f f t f t f f f 0 spginsert spgbeginscan spggettuple spggetbitmap spgrescan spgendscan spgmarkpos spgrestrpos spgbuild spgbuildempty spgbulkdelete spgvacuumcleanup spgcanreturn spgcostestimate spgoptions ));
+DESCR("SP-GiST index access method");
+
+DATA(insert OID = 3580 ( brin 5 1 f f f f t t f t f f f 0 brininsert brinbeginscan - bringetbitmap brinrescan brinendscan brinmarkpos brinrestrpos brinbuild brinbuildempty brinbulkdelete brinvacuumcleanup - brincostestimate brinoptions ));
+DESCR("block range index (BRIN) access method");
@@ -0,0 +1,27 @@
+# 0 "pg_attrdef.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_attrdef.h.c"
+# 23 "pg_attrdef.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_attrdef.h.c" 2
+# 35 "pg_attrdef.h.c"
+CATALOG(pg_attrdef,2604)
+{
+ Oid adrelid;
+ int16 adnum;
+
+
+ pg_node_tree adbin;
+ text adsrc;
+
+} FormData_pg_attrdef;
+
+
+
+
+
+
+typedef FormData_pg_attrdef *Form_pg_attrdef;
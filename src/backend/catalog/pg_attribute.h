@@ -0,0 +1,90 @@
+# 0 "pg_attribute.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_attribute.h.c"
+# 23 "pg_attribute.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_attribute.h.c" 2
+# 40 "pg_attribute.h.c"
+CATALOG(pg_attribute,1249) BKI_BOOTSTRAP BKI_WITHOUT_OIDS BKI_ROWTYPE_OID(75) BKI_SCHEMA_MACRO
+{
+ Oid attrelid;
+ NameData attname;
+# 52 "pg_attribute.h.c"
+ Oid atttypid;
+# 61 "pg_attribute.h.c"
+ int32 attstattarget;
+
+
+
+
+
+ int16 attlen;
+# 82 "pg_attribute.h.c"
+ int16 attnum;
+
+
+
+
+
+ int32 attndims;
+# 97 "pg_attribute.h.c"
+ int32 attcacheoff;
+
+
+
+
+
+
+
+ int32 atttypmod;
+
+
+
+
+
+ bool attbyval;
+# 126 "pg_attribute.h.c"
+ char attstorage;
+
+
+
+
+
+ char attalign;
+
+
+ bool attnotnull;
+
+
+ bool atthasdef;
+
+
+ bool attisdropped;
+
+
+ bool attislocal;
+
+
+ int32 attinhcount;
+
+
+ Oid attcollation;
+
+
+
+
+
+ aclitem attacl[1];
+
+
+ text attoptions[1];
+
+
+ text attfdwoptions[1];
+
+} FormData_pg_attribute;
+# 180 "pg_attribute.h.c"
+typedef FormData_pg_attribute *Form_pg_attribute;
@@ -0,0 +1,24 @@
+# 0 "pg_auth_members.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_auth_members.h.c"
+# 23 "pg_auth_members.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_auth_members.h.c" 2
+# 36 "pg_auth_members.h.c"
+CATALOG(pg_auth_members,1261) BKI_SHARED_RELATION BKI_WITHOUT_OIDS BKI_ROWTYPE_OID(2843) BKI_SCHEMA_MACRO
+{
+ Oid roleid;
+ Oid member;
+ Oid grantor;
+ bool admin_option;
+} FormData_pg_auth_members;
+
+
+
+
+
+
+typedef FormData_pg_auth_members *Form_pg_auth_members;
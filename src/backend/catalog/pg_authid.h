@@ -0,0 +1,30 @@
+# 0 "pg_authid.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_authid.h.c"
+# 25 "pg_authid.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_authid.h.c" 2
+# 50 "pg_authid.h.c"
+CATALOG(pg_authid,1260) BKI_SHARED_RELATION BKI_ROWTYPE_OID(2842) BKI_SCHEMA_MACRO
+{
+ NameData rolname;
+ bool rolsuper;
+ bool rolinherit;
+ bool rolcreaterole;
+ bool rolcreatedb;
+ bool rolcatupdate;
+ bool rolcanlogin;
+ bool rolreplication;
+ int32 rolconnlimit;
+
+
+ text rolpassword;
+ timestamptz rolvaliduntil;
+} FormData_pg_authid;
+# 77 "pg_authid.h.c"
+typedef FormData_pg_authid *Form_pg_authid;
+# 103 "pg_authid.h.c"
+DATA(insert OID = 10 ( "POSTGRES" t t t t t t t -1 _null_ _null_ ));
@@ -0,0 +1,287 @@
+# 0 "pg_cast.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_cast.h.c"
+# 25 "pg_cast.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_cast.h.c" 2
+# 37 "pg_cast.h.c"
+CATALOG(pg_cast,2605)
+{
+ Oid castsource;
+ Oid casttarget;
+ Oid castfunc;
+ char castcontext;
+ char castmethod;
+} FormData_pg_cast;
+
+typedef FormData_pg_cast *Form_pg_cast;
+# 57 "pg_cast.h.c"
+typedef enum CoercionCodes
+{
+ COERCION_CODE_IMPLICIT = 'i',
+ COERCION_CODE_ASSIGNMENT = 'a',
+ COERCION_CODE_EXPLICIT = 'e'
+} CoercionCodes;
+
+
+
+
+
+
+typedef enum CoercionMethod
+{
+ COERCION_METHOD_FUNCTION = 'f',
+ COERCION_METHOD_BINARY = 'b',
+ COERCION_METHOD_INOUT = 'i'
+} CoercionMethod;
+# 101 "pg_cast.h.c"
+DATA(insert ( 20 21 714 a f ));
+DATA(insert ( 20 23 480 a f ));
+DATA(insert ( 20 700 652 i f ));
+DATA(insert ( 20 701 482 i f ));
+DATA(insert ( 20 1700 1781 i f ));
+DATA(insert ( 21 20 754 i f ));
+DATA(insert ( 21 23 313 i f ));
+DATA(insert ( 21 700 236 i f ));
+DATA(insert ( 21 701 235 i f ));
+DATA(insert ( 21 1700 1782 i f ));
+DATA(insert ( 23 20 481 i f ));
+DATA(insert ( 23 21 314 a f ));
+DATA(insert ( 23 700 318 i f ));
+DATA(insert ( 23 701 316 i f ));
+DATA(insert ( 23 1700 1740 i f ));
+DATA(insert ( 700 20 653 a f ));
+DATA(insert ( 700 21 238 a f ));
+DATA(insert ( 700 23 319 a f ));
+DATA(insert ( 700 701 311 i f ));
+DATA(insert ( 700 1700 1742 a f ));
+DATA(insert ( 701 20 483 a f ));
+DATA(insert ( 701 21 237 a f ));
+DATA(insert ( 701 23 317 a f ));
+DATA(insert ( 701 700 312 a f ));
+DATA(insert ( 701 1700 1743 a f ));
+DATA(insert ( 1700 20 1779 a f ));
+DATA(insert ( 1700 21 1783 a f ));
+DATA(insert ( 1700 23 1744 a f ));
+DATA(insert ( 1700 700 1745 i f ));
+DATA(insert ( 1700 701 1746 i f ));
+DATA(insert ( 790 1700 3823 a f ));
+DATA(insert ( 1700 790 3824 a f ));
+DATA(insert ( 23 790 3811 a f ));
+DATA(insert ( 20 790 3812 a f ));
+
+
+DATA(insert ( 23 16 2557 e f ));
+DATA(insert ( 16 23 2558 e f ));
+# 150 "pg_cast.h.c"
+DATA(insert ( 20 26 1287 i f ));
+DATA(insert ( 21 26 313 i f ));
+DATA(insert ( 23 26 0 i b ));
+DATA(insert ( 26 20 1288 a f ));
+DATA(insert ( 26 23 0 a b ));
+DATA(insert ( 26 24 0 i b ));
+DATA(insert ( 24 26 0 i b ));
+DATA(insert ( 20 24 1287 i f ));
+DATA(insert ( 21 24 313 i f ));
+DATA(insert ( 23 24 0 i b ));
+DATA(insert ( 24 20 1288 a f ));
+DATA(insert ( 24 23 0 a b ));
+DATA(insert ( 24 2202 0 i b ));
+DATA(insert ( 2202 24 0 i b ));
+DATA(insert ( 26 2202 0 i b ));
+DATA(insert ( 2202 26 0 i b ));
+DATA(insert ( 20 2202 1287 i f ));
+DATA(insert ( 21 2202 313 i f ));
+DATA(insert ( 23 2202 0 i b ));
+DATA(insert ( 2202 20 1288 a f ));
+DATA(insert ( 2202 23 0 a b ));
+DATA(insert ( 26 2203 0 i b ));
+DATA(insert ( 2203 26 0 i b ));
+DATA(insert ( 20 2203 1287 i f ));
+DATA(insert ( 21 2203 313 i f ));
+DATA(insert ( 23 2203 0 i b ));
+DATA(insert ( 2203 20 1288 a f ));
+DATA(insert ( 2203 23 0 a b ));
+DATA(insert ( 2203 2204 0 i b ));
+DATA(insert ( 2204 2203 0 i b ));
+DATA(insert ( 26 2204 0 i b ));
+DATA(insert ( 2204 26 0 i b ));
+DATA(insert ( 20 2204 1287 i f ));
+DATA(insert ( 21 2204 313 i f ));
+DATA(insert ( 23 2204 0 i b ));
+DATA(insert ( 2204 20 1288 a f ));
+DATA(insert ( 2204 23 0 a b ));
+DATA(insert ( 26 2205 0 i b ));
+DATA(insert ( 2205 26 0 i b ));
+DATA(insert ( 20 2205 1287 i f ));
+DATA(insert ( 21 2205 313 i f ));
+DATA(insert ( 23 2205 0 i b ));
+DATA(insert ( 2205 20 1288 a f ));
+DATA(insert ( 2205 23 0 a b ));
+DATA(insert ( 26 2206 0 i b ));
+DATA(insert ( 2206 26 0 i b ));
+DATA(insert ( 20 2206 1287 i f ));
+DATA(insert ( 21 2206 313 i f ));
+DATA(insert ( 23 2206 0 i b ));
+DATA(insert ( 2206 20 1288 a f ));
+DATA(insert ( 2206 23 0 a b ));
+DATA(insert ( 26 3734 0 i b ));
+DATA(insert ( 3734 26 0 i b ));
+DATA(insert ( 20 3734 1287 i f ));
+DATA(insert ( 21 3734 313 i f ));
+DATA(insert ( 23 3734 0 i b ));
+DATA(insert ( 3734 20 1288 a f ));
+DATA(insert ( 3734 23 0 a b ));
+DATA(insert ( 26 3769 0 i b ));
+DATA(insert ( 3769 26 0 i b ));
+DATA(insert ( 20 3769 1287 i f ));
+DATA(insert ( 21 3769 313 i f ));
+DATA(insert ( 23 3769 0 i b ));
+DATA(insert ( 3769 20 1288 a f ));
+DATA(insert ( 3769 23 0 a b ));
+DATA(insert ( 25 2205 1079 i f ));
+DATA(insert ( 1043 2205 1079 i f ));
+
+
+
+
+DATA(insert ( 25 1042 0 i b ));
+DATA(insert ( 25 1043 0 i b ));
+DATA(insert ( 1042 25 401 i f ));
+DATA(insert ( 1042 1043 401 i f ));
+DATA(insert ( 1043 25 0 i b ));
+DATA(insert ( 1043 1042 0 i b ));
+DATA(insert ( 18 25 946 i f ));
+DATA(insert ( 18 1042 860 a f ));
+DATA(insert ( 18 1043 946 a f ));
+DATA(insert ( 19 25 406 i f ));
+DATA(insert ( 19 1042 408 a f ));
+DATA(insert ( 19 1043 1401 a f ));
+DATA(insert ( 25 18 944 a f ));
+DATA(insert ( 1042 18 944 a f ));
+DATA(insert ( 1043 18 944 a f ));
+DATA(insert ( 25 19 407 i f ));
+DATA(insert ( 1042 19 409 i f ));
+DATA(insert ( 1043 19 1400 i f ));
+
+
+DATA(insert ( 18 23 77 e f ));
+DATA(insert ( 23 18 78 e f ));
+
+
+DATA(insert ( 194 25 0 i b ));
+
+
+
+
+DATA(insert ( 702 1082 1179 a f ));
+DATA(insert ( 702 1083 1364 a f ));
+DATA(insert ( 702 1114 2023 i f ));
+DATA(insert ( 702 1184 1173 i f ));
+DATA(insert ( 703 1186 1177 i f ));
+DATA(insert ( 1082 1114 2024 i f ));
+DATA(insert ( 1082 1184 1174 i f ));
+DATA(insert ( 1083 1186 1370 i f ));
+DATA(insert ( 1083 1266 2047 i f ));
+DATA(insert ( 1114 702 2030 a f ));
+DATA(insert ( 1114 1082 2029 a f ));
+DATA(insert ( 1114 1083 1316 a f ));
+DATA(insert ( 1114 1184 2028 i f ));
+DATA(insert ( 1184 702 1180 a f ));
+DATA(insert ( 1184 1082 1178 a f ));
+DATA(insert ( 1184 1083 2019 a f ));
+DATA(insert ( 1184 1114 2027 a f ));
+DATA(insert ( 1184 1266 1388 a f ));
+DATA(insert ( 1186 703 1194 a f ));
+DATA(insert ( 1186 1083 1419 a f ));
+DATA(insert ( 1266 1083 2046 a f ));
+
+DATA(insert ( 23 702 0 e b ));
+DATA(insert ( 702 23 0 e b ));
+DATA(insert ( 23 703 0 e b ));
+DATA(insert ( 703 23 0 e b ));
+
+
+
+
+DATA(insert ( 601 600 1532 e f ));
+DATA(insert ( 602 600 1533 e f ));
+DATA(insert ( 602 604 1449 a f ));
+DATA(insert ( 603 600 1534 e f ));
+DATA(insert ( 603 601 1541 e f ));
+DATA(insert ( 603 604 1448 a f ));
+DATA(insert ( 603 718 1479 e f ));
+DATA(insert ( 604 600 1540 e f ));
+DATA(insert ( 604 602 1447 a f ));
+DATA(insert ( 604 603 1446 e f ));
+DATA(insert ( 604 718 1474 e f ));
+DATA(insert ( 718 600 1416 e f ));
+DATA(insert ( 718 603 1480 e f ));
+DATA(insert ( 718 604 1544 e f ));
+
+
+
+
+DATA(insert ( 650 869 0 i b ));
+DATA(insert ( 869 650 1715 a f ));
+
+
+
+
+DATA(insert ( 1560 1562 0 i b ));
+DATA(insert ( 1562 1560 0 i b ));
+
+DATA(insert ( 20 1560 2075 e f ));
+DATA(insert ( 23 1560 1683 e f ));
+DATA(insert ( 1560 20 2076 e f ));
+DATA(insert ( 1560 23 1684 e f ));
+# 324 "pg_cast.h.c"
+DATA(insert ( 650 25 730 a f ));
+DATA(insert ( 869 25 730 a f ));
+DATA(insert ( 16 25 2971 a f ));
+DATA(insert ( 142 25 0 a b ));
+DATA(insert ( 25 142 2896 e f ));
+
+
+
+
+
+
+DATA(insert ( 650 1043 730 a f ));
+DATA(insert ( 869 1043 730 a f ));
+DATA(insert ( 16 1043 2971 a f ));
+DATA(insert ( 142 1043 0 a b ));
+DATA(insert ( 1043 142 2896 e f ));
+
+
+
+
+
+
+DATA(insert ( 650 1042 730 a f ));
+DATA(insert ( 869 1042 730 a f ));
+DATA(insert ( 16 1042 2971 a f ));
+DATA(insert ( 142 1042 0 a b ));
+DATA(insert ( 1042 142 2896 e f ));
+
+
+
+
+DATA(insert ( 1042 1042 668 i f ));
+DATA(insert ( 1043 1043 669 i f ));
+DATA(insert ( 1083 1083 1968 i f ));
+DATA(insert ( 1114 1114 1961 i f ));
+DATA(insert ( 1184 1184 1967 i f ));
+DATA(insert ( 1186 1186 1200 i f ));
+DATA(insert ( 1266 1266 1969 i f ));
+DATA(insert ( 1560 1560 1685 i f ));
+DATA(insert ( 1562 1562 1687 i f ));
+DATA(insert ( 1700 1700 1703 i f ));
+
+
+
+DATA(insert ( 114 3802 0 a i ));
+DATA(insert ( 3802 114 0 a i ));
@@ -0,0 +1,69 @@
+# 0 "pg_class.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_class.h.c"
+# 23 "pg_class.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_class.h.c" 2
+# 36 "pg_class.h.c"
+CATALOG(pg_class,1259) BKI_BOOTSTRAP BKI_ROWTYPE_OID(83) BKI_SCHEMA_MACRO
+{
+ NameData relname;
+ Oid relnamespace;
+ Oid reltype;
+
+ Oid reloftype;
+
+ Oid relowner;
+ Oid relam;
+ Oid relfilenode;
+
+
+ Oid reltablespace;
+ int32 relpages;
+ float4 reltuples;
+ int32 relallvisible;
+
+ Oid reltoastrelid;
+ Oid reltoastidxid;
+ bool relhasindex;
+ bool relisshared;
+ char relpersistence;
+ char relkind;
+ int16 relnatts;
+
+
+
+
+
+
+ int16 relchecks;
+ bool relhasoids;
+ bool relhaspkey;
+ bool relhasrules;
+ bool relhastriggers;
+ bool relhassubclass;
+ bool relispopulated;
+ TransactionId relfrozenxid;
+ TransactionId relminmxid;
+
+
+
+
+ aclitem relacl[1];
+ text reloptions[1];
+
+} FormData_pg_class;
+# 94 "pg_class.h.c"
+typedef FormData_pg_class *Form_pg_class;
+# 145 "pg_class.h.c"
+DATA(insert OID = 1247 ( pg_type PGNSP 71 0 PGUID 0 0 0 0 0 0 0 0 f f p r 30 0 t f f f f t 3 1 _null_ _null_ ));
+DESCR("");
+DATA(insert OID = 1249 ( pg_attribute PGNSP 75 0 PGUID 0 0 0 0 0 0 0 0 f f p r 21 0 f f f f f t 3 1 _null_ _null_ ));
+DESCR("");
+DATA(insert OID = 1255 ( pg_proc PGNSP 81 0 PGUID 0 0 0 0 0 0 0 0 f f p r 27 0 t f f f f t 3 1 _null_ _null_ ));
+DESCR("");
+DATA(insert OID = 1259 ( pg_class PGNSP 83 0 PGUID 0 0 0 0 0 0 0 0 f f p r 29 0 t f f f f t 3 1 _null_ _null_ ));
+DESCR("");
@@ -0,0 +1,35 @@
+# 0 "pg_collation.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_collation.h.c"
+# 24 "pg_collation.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 25 "pg_collation.h.c" 2
+# 36 "pg_collation.h.c"
+CATALOG(pg_collation,3456)
+{
+ NameData collname;
+ Oid collnamespace;
+ Oid collowner;
+ int32 collencoding;
+ NameData collcollate;
+ NameData collctype;
+} FormData_pg_collation;
+
+
+
+
+
+
+typedef FormData_pg_collation *Form_pg_collation;
+# 70 "pg_collation.h.c"
+DATA(insert OID = 100 ( default PGNSP PGUID -1 "" "" ));
+DESCR("database's default collation");
+
+DATA(insert OID = 950 ( C PGNSP PGUID -1 "C" "C" ));
+DESCR("standard C collation");
+
+DATA(insert OID = 951 ( POSIX PGNSP PGUID -1 "POSIX" "POSIX" ));
+DESCR("standard POSIX collation");
@@ -0,0 +1,164 @@
+# 0 "pg_constraint.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_constraint.h.c"
+# 23 "pg_constraint.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_constraint.h.c" 2
+# 37 "pg_constraint.h.c"
+CATALOG(pg_constraint,2606)
+{
+# 48 "pg_constraint.h.c"
+ NameData conname;
+ Oid connamespace;
+ char contype;
+ bool condeferrable;
+ bool condeferred;
+ bool convalidated;
+
+
+
+
+
+
+ Oid conrelid;
+# 69 "pg_constraint.h.c"
+ Oid contypid;
+# 79 "pg_constraint.h.c"
+ Oid conindid;
+
+
+
+
+
+ Oid confrelid;
+ char confupdtype;
+ char confdeltype;
+ char confmatchtype;
+
+
+ bool conislocal;
+
+
+ int32 coninhcount;
+
+
+ bool connoinherit;
+
+
+
+
+
+
+
+ int16 conkey[1];
+
+
+
+
+ int16 confkey[1];
+
+
+
+
+
+ Oid conpfeqop[1];
+
+
+
+
+
+ Oid conppeqop[1];
+
+
+
+
+
+ Oid conffeqop[1];
+
+
+
+
+
+ Oid conexclop[1];
+
+
+
+
+ pg_node_tree conbin;
+
+
+
+
+ text consrc;
+
+} FormData_pg_constraint;
+
+
+
+
+
+
+typedef FormData_pg_constraint *Form_pg_constraint;
+# 203 "pg_constraint.h.c"
+typedef enum ConstraintCategory
+{
+ CONSTRAINT_RELATION,
+ CONSTRAINT_DOMAIN,
+ CONSTRAINT_ASSERTION
+} ConstraintCategory;
+
+
+
+
+extern Oid CreateConstraintEntry(const char *constraintName,
+       Oid constraintNamespace,
+       char constraintType,
+       bool isDeferrable,
+       bool isDeferred,
+       bool isValidated,
+       Oid relId,
+       const int16 *constraintKey,
+       int constraintNKeys,
+       Oid domainId,
+       Oid indexRelId,
+       Oid foreignRelId,
+       const int16 *foreignKey,
+       const Oid *pfEqOp,
+       const Oid *ppEqOp,
+       const Oid *ffEqOp,
+       int foreignNKeys,
+       char foreignUpdateType,
+       char foreignDeleteType,
+       char foreignMatchType,
+       const Oid *exclOp,
+       Node *conExpr,
+       const char *conBin,
+       const char *conSrc,
+       bool conIsLocal,
+       int conInhCount,
+       bool conNoInherit,
+       bool is_internal);
+
+extern void RemoveConstraintById(Oid conId);
+extern void RenameConstraintById(Oid conId, const char *newname);
+extern void SetValidatedConstraintById(Oid conId);
+
+extern bool ConstraintNameIsUsed(ConstraintCategory conCat, Oid objId,
+      Oid objNamespace, const char *conname);
+extern char *ChooseConstraintName(const char *name1, const char *name2,
+      const char *label, Oid namespaceid,
+      List *others);
+
+extern void AlterConstraintNamespaces(Oid ownerId, Oid oldNspId,
+       Oid newNspId, bool isType, ObjectAddresses *objsMoved);
+extern void get_constraint_relation_oids(Oid constraint_oid, Oid *conrelid, Oid *confrelid);
+extern Oid get_relation_constraint_oid(Oid relid, const char *conname, bool missing_ok);
+extern Oid get_domain_constraint_oid(Oid typid, const char *conname, bool missing_ok);
+
+extern bool check_functional_grouping(Oid relid,
+        Index varno, Index varlevelsup,
+        List *grouping_columns,
+        List **constraintDeps);
@@ -0,0 +1,27 @@
+# 0 "pg_conversion.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_conversion.h.c"
+# 23 "pg_conversion.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_conversion.h.c" 2
+# 44 "pg_conversion.h.c"
+CATALOG(pg_conversion,2607)
+{
+ NameData conname;
+ Oid connamespace;
+ Oid conowner;
+ int32 conforencoding;
+ int32 contoencoding;
+ regproc conproc;
+ bool condefault;
+} FormData_pg_conversion;
+
+
+
+
+
+
+typedef FormData_pg_conversion *Form_pg_conversion;
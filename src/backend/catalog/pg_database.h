@@ -0,0 +1,39 @@
+# 0 "pg_database.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_database.h.c"
+# 23 "pg_database.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_database.h.c" 2
+# 36 "pg_database.h.c"
+CATALOG(pg_database,1262) BKI_SHARED_RELATION BKI_ROWTYPE_OID(1248) BKI_SCHEMA_MACRO
+{
+ NameData datname;
+ Oid datdba;
+ int32 encoding;
+ NameData datcollate;
+ NameData datctype;
+ bool datistemplate;
+ bool datallowconn;
+ int32 datconnlimit;
+ Oid datlastsysoid;
+ TransactionId datfrozenxid;
+ TransactionId datminmxid;
+ Oid dattablespace;
+
+
+ aclitem datacl[1];
+
+} FormData_pg_database;
+
+
+
+
+
+
+typedef FormData_pg_database *Form_pg_database;
+# 82 "pg_database.h.c"
+DATA(insert OID = 1 ( template1 PGUID ENCODING "LC_COLLATE" "LC_CTYPE" t t -1 0 0 1 1663 _null_));
+SHDESCR("default template for new databases");
@@ -0,0 +1,26 @@
+# 0 "pg_db_role_setting.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_db_role_setting.h.c"
+# 25 "pg_db_role_setting.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_db_role_setting.h.c" 2
+# 39 "pg_db_role_setting.h.c"
+CATALOG(pg_db_role_setting,2964) BKI_SHARED_RELATION BKI_WITHOUT_OIDS
+{
+ Oid setdatabase;
+ Oid setrole;
+
+
+ text setconfig[1];
+
+} FormData_pg_db_role_setting;
+
+typedef FormData_pg_db_role_setting *Form_pg_db_role_setting;
+# 68 "pg_db_role_setting.h.c"
+extern void AlterSetting(Oid databaseid, Oid roleid, VariableSetStmt *setstmt);
+extern void DropSetting(Oid databaseid, Oid roleid);
+extern void ApplySetting(Oid databaseid, Oid roleid, Relation relsetting,
+    GucSource source);
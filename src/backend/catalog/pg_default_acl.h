@@ -0,0 +1,27 @@
+# 0 "pg_default_acl.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_default_acl.h.c"
+# 22 "pg_default_acl.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 23 "pg_default_acl.h.c" 2
+# 34 "pg_default_acl.h.c"
+CATALOG(pg_default_acl,826)
+{
+ Oid defaclrole;
+ Oid defaclnamespace;
+ char defaclobjtype;
+
+
+ aclitem defaclacl[1];
+
+} FormData_pg_default_acl;
+
+
+
+
+
+
+typedef FormData_pg_default_acl *Form_pg_default_acl;
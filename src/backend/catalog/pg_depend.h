@@ -0,0 +1,41 @@
+# 0 "pg_depend.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_depend.h.c"
+# 23 "pg_depend.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_depend.h.c" 2
+# 35 "pg_depend.h.c"
+CATALOG(pg_depend,2608) BKI_WITHOUT_OIDS
+{
+
+
+
+
+
+ Oid classid;
+ Oid objid;
+ int32 objsubid;
+
+
+
+
+ Oid refclassid;
+ Oid refobjid;
+ int32 refobjsubid;
+
+
+
+
+
+ char deptype;
+} FormData_pg_depend;
+
+
+
+
+
+
+typedef FormData_pg_depend *Form_pg_depend;
@@ -0,0 +1,27 @@
+# 0 "pg_description.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_description.h.c"
+# 40 "pg_description.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 41 "pg_description.h.c" 2
+# 52 "pg_description.h.c"
+CATALOG(pg_description,2609) BKI_WITHOUT_OIDS
+{
+ Oid objoid;
+ Oid classoid;
+ int32 objsubid;
+
+
+ text description;
+
+} FormData_pg_description;
+
+
+
+
+
+
+typedef FormData_pg_description *Form_pg_description;
@@ -0,0 +1,29 @@
+# 0 "pg_enum.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_enum.h.c"
+# 25 "pg_enum.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_enum.h.c" 2
+# 38 "pg_enum.h.c"
+CATALOG(pg_enum,3501)
+{
+ Oid enumtypid;
+ float4 enumsortorder;
+ NameData enumlabel;
+} FormData_pg_enum;
+
+
+
+
+
+
+typedef FormData_pg_enum *Form_pg_enum;
+# 69 "pg_enum.h.c"
+extern void EnumValuesCreate(Oid enumTypeOid, List *vals);
+extern void EnumValuesDelete(Oid enumTypeOid);
+extern void AddEnumLabel(Oid enumTypeOid, const char *newVal,
+    const char *neighbor, bool newValIsAfter,
+    bool skipIfExists);
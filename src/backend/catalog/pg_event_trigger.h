@@ -0,0 +1,30 @@
+# 0 "pg_event_trigger.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_event_trigger.h.c"
+# 23 "pg_event_trigger.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_event_trigger.h.c" 2
+# 35 "pg_event_trigger.h.c"
+CATALOG(pg_event_trigger,3466)
+{
+ NameData evtname;
+ NameData evtevent;
+ Oid evtowner;
+ Oid evtfoid;
+ char evtenabled;
+
+
+
+ text evttags[1];
+
+} FormData_pg_event_trigger;
+
+
+
+
+
+
+typedef FormData_pg_event_trigger *Form_pg_event_trigger;
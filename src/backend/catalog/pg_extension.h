@@ -0,0 +1,31 @@
+# 0 "pg_extension.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_extension.h.c"
+# 23 "pg_extension.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_extension.h.c" 2
+# 35 "pg_extension.h.c"
+CATALOG(pg_extension,3079)
+{
+ NameData extname;
+ Oid extowner;
+ Oid extnamespace;
+ bool extrelocatable;
+
+
+
+ text extversion;
+ Oid extconfig[1];
+ text extcondition[1];
+
+} FormData_pg_extension;
+
+
+
+
+
+
+typedef FormData_pg_extension *Form_pg_extension;
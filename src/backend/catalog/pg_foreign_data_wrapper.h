@@ -0,0 +1,29 @@
+# 0 "pg_foreign_data_wrapper.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_foreign_data_wrapper.h.c"
+# 23 "pg_foreign_data_wrapper.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_foreign_data_wrapper.h.c" 2
+# 35 "pg_foreign_data_wrapper.h.c"
+CATALOG(pg_foreign_data_wrapper,2328)
+{
+ NameData fdwname;
+ Oid fdwowner;
+ Oid fdwhandler;
+ Oid fdwvalidator;
+
+
+ aclitem fdwacl[1];
+ text fdwoptions[1];
+
+} FormData_pg_foreign_data_wrapper;
+
+
+
+
+
+
+typedef FormData_pg_foreign_data_wrapper *Form_pg_foreign_data_wrapper;
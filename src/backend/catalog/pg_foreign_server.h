@@ -0,0 +1,30 @@
+# 0 "pg_foreign_server.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_foreign_server.h.c"
+# 21 "pg_foreign_server.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 22 "pg_foreign_server.h.c" 2
+# 33 "pg_foreign_server.h.c"
+CATALOG(pg_foreign_server,1417)
+{
+ NameData srvname;
+ Oid srvowner;
+ Oid srvfdw;
+
+
+ text srvtype;
+ text srvversion;
+ aclitem srvacl[1];
+ text srvoptions[1];
+
+} FormData_pg_foreign_server;
+
+
+
+
+
+
+typedef FormData_pg_foreign_server *Form_pg_foreign_server;
@@ -0,0 +1,26 @@
+# 0 "pg_foreign_table.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_foreign_table.h.c"
+# 21 "pg_foreign_table.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 22 "pg_foreign_table.h.c" 2
+# 33 "pg_foreign_table.h.c"
+CATALOG(pg_foreign_table,3118) BKI_WITHOUT_OIDS
+{
+ Oid ftrelid;
+ Oid ftserver;
+
+
+ text ftoptions[1];
+
+} FormData_pg_foreign_table;
+
+
+
+
+
+
+typedef FormData_pg_foreign_table *Form_pg_foreign_table;
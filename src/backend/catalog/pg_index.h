@@ -0,0 +1,46 @@
+# 0 "pg_index.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_index.h.c"
+# 23 "pg_index.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_index.h.c" 2
+# 35 "pg_index.h.c"
+CATALOG(pg_index,2610) BKI_WITHOUT_OIDS BKI_SCHEMA_MACRO
+{
+ Oid indexrelid;
+ Oid indrelid;
+ int16 indnatts;
+ bool indisunique;
+ bool indisprimary;
+ bool indisexclusion;
+ bool indimmediate;
+ bool indisclustered;
+ bool indisvalid;
+ bool indcheckxmin;
+ bool indisready;
+ bool indislive;
+
+
+ int2vector indkey;
+
+
+ oidvector indcollation;
+ oidvector indclass;
+ int2vector indoption;
+ pg_node_tree indexprs;
+
+
+ pg_node_tree indpred;
+
+
+} FormData_pg_index;
+
+
+
+
+
+
+typedef FormData_pg_index *Form_pg_index;
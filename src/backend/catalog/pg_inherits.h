@@ -0,0 +1,23 @@
+# 0 "pg_inherits.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_inherits.h.c"
+# 23 "pg_inherits.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_inherits.h.c" 2
+# 35 "pg_inherits.h.c"
+CATALOG(pg_inherits,2611) BKI_WITHOUT_OIDS
+{
+ Oid inhrelid;
+ Oid inhparent;
+ int32 inhseqno;
+} FormData_pg_inherits;
+
+
+
+
+
+
+typedef FormData_pg_inherits *Form_pg_inherits;
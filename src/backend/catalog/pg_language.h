@@ -0,0 +1,40 @@
+# 0 "pg_language.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_language.h.c"
+# 23 "pg_language.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_language.h.c" 2
+# 35 "pg_language.h.c"
+CATALOG(pg_language,2612)
+{
+ NameData lanname;
+ Oid lanowner;
+ bool lanispl;
+ bool lanpltrusted;
+ Oid lanplcallfoid;
+ Oid laninline;
+ Oid lanvalidator;
+
+
+ aclitem lanacl[1];
+
+} FormData_pg_language;
+
+
+
+
+
+
+typedef FormData_pg_language *Form_pg_language;
+# 76 "pg_language.h.c"
+DATA(insert OID = 12 ( "internal" PGUID f f 0 0 2246 _null_ ));
+DESCR("built-in functions");
+
+DATA(insert OID = 13 ( "c" PGUID f f 0 0 2247 _null_ ));
+DESCR("dynamically-loaded C functions");
+
+DATA(insert OID = 14 ( "sql" PGUID f t 0 0 2248 _null_ ));
+DESCR("SQL-language functions");
@@ -0,0 +1,29 @@
+# 0 "pg_largeobject.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_largeobject.h.c"
+# 23 "pg_largeobject.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_largeobject.h.c" 2
+# 35 "pg_largeobject.h.c"
+CATALOG(pg_largeobject,2613) BKI_WITHOUT_OIDS
+{
+ Oid loid;
+ int32 pageno;
+
+
+ bytea data;
+} FormData_pg_largeobject;
+
+
+
+
+
+
+typedef FormData_pg_largeobject *Form_pg_largeobject;
+# 60 "pg_largeobject.h.c"
+extern Oid LargeObjectCreate(Oid loid);
+extern void LargeObjectDrop(Oid loid);
+extern bool LargeObjectExists(Oid loid);
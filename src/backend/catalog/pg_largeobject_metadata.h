@@ -0,0 +1,25 @@
+# 0 "pg_largeobject_metadata.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_largeobject_metadata.h.c"
+# 23 "pg_largeobject_metadata.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_largeobject_metadata.h.c" 2
+# 35 "pg_largeobject_metadata.h.c"
+CATALOG(pg_largeobject_metadata,2995)
+{
+ Oid lomowner;
+
+
+ aclitem lomacl[1];
+
+} FormData_pg_largeobject_metadata;
+
+
+
+
+
+
+typedef FormData_pg_largeobject_metadata *Form_pg_largeobject_metadata;
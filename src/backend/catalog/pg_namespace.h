@@ -0,0 +1,41 @@
+# 0 "pg_namespace.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_namespace.h.c"
+# 23 "pg_namespace.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_namespace.h.c" 2
+# 40 "pg_namespace.h.c"
+CATALOG(pg_namespace,2615)
+{
+ NameData nspname;
+ Oid nspowner;
+
+
+ aclitem nspacl[1];
+
+} FormData_pg_namespace;
+
+
+
+
+
+
+typedef FormData_pg_namespace *Form_pg_namespace;
+# 73 "pg_namespace.h.c"
+DATA(insert OID = 11 ( "pg_catalog" PGUID _null_ ));
+DESCR("system catalog schema");
+
+DATA(insert OID = 99 ( "pg_toast" PGUID _null_ ));
+DESCR("reserved schema for TOAST tables");
+
+DATA(insert OID = 2200 ( "public" PGUID _null_ ));
+DESCR("standard public schema");
+
+
+DATA(insert OID = 3199 ( "oracle" PGUID _null_ ));
+DESCR("compatible oracle schema");
+# 97 "pg_namespace.h.c"
+extern Oid NamespaceCreate(const char *nspName, Oid ownerId, bool isTemp);
@@ -0,0 +1,188 @@
+# 0 "pg_opclass.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_opclass.h.c"
+# 43 "pg_opclass.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 44 "pg_opclass.h.c" 2
+# 55 "pg_opclass.h.c"
+CATALOG(pg_opclass,2616)
+{
+ Oid opcmethod;
+ NameData opcname;
+ Oid opcnamespace;
+ Oid opcowner;
+ Oid opcfamily;
+ Oid opcintype;
+ bool opcdefault;
+ Oid opckeytype;
+} FormData_pg_opclass;
+
+
+
+
+
+
+typedef FormData_pg_opclass *Form_pg_opclass;
+# 97 "pg_opclass.h.c"
+DATA(insert ( 403 abstime_ops PGNSP PGUID 421 702 t 0 ));
+DATA(insert ( 403 array_ops PGNSP PGUID 397 2277 t 0 ));
+DATA(insert ( 405 array_ops PGNSP PGUID 627 2277 t 0 ));
+DATA(insert ( 403 bit_ops PGNSP PGUID 423 1560 t 0 ));
+DATA(insert ( 403 bool_ops PGNSP PGUID 424 16 t 0 ));
+DATA(insert ( 403 bpchar_ops PGNSP PGUID 426 1042 t 0 ));
+DATA(insert ( 405 bpchar_ops PGNSP PGUID 427 1042 t 0 ));
+DATA(insert ( 403 bytea_ops PGNSP PGUID 428 17 t 0 ));
+DATA(insert ( 403 char_ops PGNSP PGUID 429 18 t 0 ));
+DATA(insert ( 405 char_ops PGNSP PGUID 431 18 t 0 ));
+DATA(insert ( 403 cidr_ops PGNSP PGUID 1974 869 f 0 ));
+DATA(insert ( 405 cidr_ops PGNSP PGUID 1975 869 f 0 ));
+DATA(insert OID = 3122 ( 403 date_ops PGNSP PGUID 434 1082 t 0 ));
+
+DATA(insert ( 405 date_ops PGNSP PGUID 435 1082 t 0 ));
+DATA(insert ( 403 float4_ops PGNSP PGUID 1970 700 t 0 ));
+DATA(insert ( 405 float4_ops PGNSP PGUID 1971 700 t 0 ));
+DATA(insert OID = 3123 ( 403 float8_ops PGNSP PGUID 1970 701 t 0 ));
+
+DATA(insert ( 405 float8_ops PGNSP PGUID 1971 701 t 0 ));
+DATA(insert ( 403 inet_ops PGNSP PGUID 1974 869 t 0 ));
+DATA(insert ( 405 inet_ops PGNSP PGUID 1975 869 t 0 ));
+DATA(insert OID = 1979 ( 403 int2_ops PGNSP PGUID 1976 21 t 0 ));
+
+DATA(insert ( 405 int2_ops PGNSP PGUID 1977 21 t 0 ));
+DATA(insert OID = 1978 ( 403 int4_ops PGNSP PGUID 1976 23 t 0 ));
+
+DATA(insert ( 405 int4_ops PGNSP PGUID 1977 23 t 0 ));
+DATA(insert OID = 3124 ( 403 int8_ops PGNSP PGUID 1976 20 t 0 ));
+
+DATA(insert ( 405 int8_ops PGNSP PGUID 1977 20 t 0 ));
+DATA(insert ( 403 interval_ops PGNSP PGUID 1982 1186 t 0 ));
+DATA(insert ( 405 interval_ops PGNSP PGUID 1983 1186 t 0 ));
+DATA(insert ( 403 macaddr_ops PGNSP PGUID 1984 829 t 0 ));
+DATA(insert ( 405 macaddr_ops PGNSP PGUID 1985 829 t 0 ));
+
+
+
+
+
+
+
+DATA(insert ( 403 name_ops PGNSP PGUID 1986 19 t 2275 ));
+DATA(insert ( 405 name_ops PGNSP PGUID 1987 19 t 0 ));
+DATA(insert OID = 3125 ( 403 numeric_ops PGNSP PGUID 1988 1700 t 0 ));
+
+DATA(insert ( 405 numeric_ops PGNSP PGUID 1998 1700 t 0 ));
+DATA(insert OID = 1981 ( 403 oid_ops PGNSP PGUID 1989 26 t 0 ));
+
+DATA(insert ( 405 oid_ops PGNSP PGUID 1990 26 t 0 ));
+DATA(insert ( 403 oidvector_ops PGNSP PGUID 1991 30 t 0 ));
+DATA(insert ( 405 oidvector_ops PGNSP PGUID 1992 30 t 0 ));
+DATA(insert ( 403 record_ops PGNSP PGUID 2994 2249 t 0 ));
+DATA(insert OID = 3126 ( 403 text_ops PGNSP PGUID 1994 25 t 0 ));
+
+DATA(insert ( 405 text_ops PGNSP PGUID 1995 25 t 0 ));
+DATA(insert ( 403 time_ops PGNSP PGUID 1996 1083 t 0 ));
+DATA(insert ( 405 time_ops PGNSP PGUID 1997 1083 t 0 ));
+DATA(insert OID = 3127 ( 403 timestamptz_ops PGNSP PGUID 434 1184 t 0 ));
+
+DATA(insert ( 405 timestamptz_ops PGNSP PGUID 1999 1184 t 0 ));
+DATA(insert ( 403 timetz_ops PGNSP PGUID 2000 1266 t 0 ));
+DATA(insert ( 405 timetz_ops PGNSP PGUID 2001 1266 t 0 ));
+DATA(insert ( 403 varbit_ops PGNSP PGUID 2002 1562 t 0 ));
+DATA(insert ( 403 varchar_ops PGNSP PGUID 1994 25 f 0 ));
+DATA(insert ( 405 varchar_ops PGNSP PGUID 1995 25 f 0 ));
+DATA(insert OID = 3128 ( 403 timestamp_ops PGNSP PGUID 434 1114 t 0 ));
+
+DATA(insert ( 405 timestamp_ops PGNSP PGUID 2040 1114 t 0 ));
+DATA(insert ( 403 text_pattern_ops PGNSP PGUID 2095 25 f 0 ));
+DATA(insert ( 403 varchar_pattern_ops PGNSP PGUID 2095 25 f 0 ));
+DATA(insert ( 403 bpchar_pattern_ops PGNSP PGUID 2097 1042 f 0 ));
+DATA(insert ( 403 money_ops PGNSP PGUID 2099 790 t 0 ));
+DATA(insert ( 405 bool_ops PGNSP PGUID 2222 16 t 0 ));
+DATA(insert ( 405 bytea_ops PGNSP PGUID 2223 17 t 0 ));
+DATA(insert ( 405 int2vector_ops PGNSP PGUID 2224 22 t 0 ));
+DATA(insert ( 403 tid_ops PGNSP PGUID 2789 27 t 0 ));
+DATA(insert ( 405 xid_ops PGNSP PGUID 2225 28 t 0 ));
+DATA(insert ( 405 cid_ops PGNSP PGUID 2226 29 t 0 ));
+DATA(insert ( 405 abstime_ops PGNSP PGUID 2227 702 t 0 ));
+DATA(insert ( 405 reltime_ops PGNSP PGUID 2228 703 t 0 ));
+DATA(insert ( 405 text_pattern_ops PGNSP PGUID 2229 25 f 0 ));
+DATA(insert ( 405 varchar_pattern_ops PGNSP PGUID 2229 25 f 0 ));
+DATA(insert ( 405 bpchar_pattern_ops PGNSP PGUID 2231 1042 f 0 ));
+DATA(insert ( 403 reltime_ops PGNSP PGUID 2233 703 t 0 ));
+DATA(insert ( 403 tinterval_ops PGNSP PGUID 2234 704 t 0 ));
+DATA(insert ( 405 aclitem_ops PGNSP PGUID 2235 1033 t 0 ));
+DATA(insert ( 783 box_ops PGNSP PGUID 2593 603 t 0 ));
+DATA(insert ( 783 point_ops PGNSP PGUID 1029 600 t 603 ));
+DATA(insert ( 783 poly_ops PGNSP PGUID 2594 604 t 603 ));
+DATA(insert ( 783 circle_ops PGNSP PGUID 2595 718 t 603 ));
+DATA(insert ( 2742 _int4_ops PGNSP PGUID 2745 1007 t 23 ));
+DATA(insert ( 2742 _text_ops PGNSP PGUID 2745 1009 t 25 ));
+DATA(insert ( 2742 _abstime_ops PGNSP PGUID 2745 1023 t 702 ));
+DATA(insert ( 2742 _bit_ops PGNSP PGUID 2745 1561 t 1560 ));
+DATA(insert ( 2742 _bool_ops PGNSP PGUID 2745 1000 t 16 ));
+DATA(insert ( 2742 _bpchar_ops PGNSP PGUID 2745 1014 t 1042 ));
+DATA(insert ( 2742 _bytea_ops PGNSP PGUID 2745 1001 t 17 ));
+DATA(insert ( 2742 _char_ops PGNSP PGUID 2745 1002 t 18 ));
+DATA(insert ( 2742 _cidr_ops PGNSP PGUID 2745 651 t 650 ));
+DATA(insert ( 2742 _date_ops PGNSP PGUID 2745 1182 t 1082 ));
+DATA(insert ( 2742 _float4_ops PGNSP PGUID 2745 1021 t 700 ));
+DATA(insert ( 2742 _float8_ops PGNSP PGUID 2745 1022 t 701 ));
+DATA(insert ( 2742 _inet_ops PGNSP PGUID 2745 1041 t 869 ));
+DATA(insert ( 2742 _int2_ops PGNSP PGUID 2745 1005 t 21 ));
+DATA(insert ( 2742 _int8_ops PGNSP PGUID 2745 1016 t 20 ));
+DATA(insert ( 2742 _interval_ops PGNSP PGUID 2745 1187 t 1186 ));
+DATA(insert ( 2742 _macaddr_ops PGNSP PGUID 2745 1040 t 829 ));
+DATA(insert ( 2742 _name_ops PGNSP PGUID 2745 1003 t 19 ));
+DATA(insert ( 2742 _numeric_ops PGNSP PGUID 2745 1231 t 1700 ));
+DATA(insert ( 2742 _oid_ops PGNSP PGUID 2745 1028 t 26 ));
+DATA(insert ( 2742 _oidvector_ops PGNSP PGUID 2745 1013 t 30 ));
+DATA(insert ( 2742 _time_ops PGNSP PGUID 2745 1183 t 1083 ));
+DATA(insert ( 2742 _timestamptz_ops PGNSP PGUID 2745 1185 t 1184 ));
+DATA(insert ( 2742 _timetz_ops PGNSP PGUID 2745 1270 t 1266 ));
+DATA(insert ( 2742 _varbit_ops PGNSP PGUID 2745 1563 t 1562 ));
+DATA(insert ( 2742 _varchar_ops PGNSP PGUID 2745 1015 t 1043 ));
+DATA(insert ( 2742 _timestamp_ops PGNSP PGUID 2745 1115 t 1114 ));
+DATA(insert ( 2742 _money_ops PGNSP PGUID 2745 791 t 790 ));
+DATA(insert ( 2742 _reltime_ops PGNSP PGUID 2745 1024 t 703 ));
+DATA(insert ( 2742 _tinterval_ops PGNSP PGUID 2745 1025 t 704 ));
+DATA(insert ( 403 uuid_ops PGNSP PGUID 2968 2950 t 0 ));
+DATA(insert ( 405 uuid_ops PGNSP PGUID 2969 2950 t 0 ));
+DATA(insert ( 403 enum_ops PGNSP PGUID 3522 3500 t 0 ));
+DATA(insert ( 405 enum_ops PGNSP PGUID 3523 3500 t 0 ));
+DATA(insert ( 403 tsvector_ops PGNSP PGUID 3626 3614 t 0 ));
+DATA(insert ( 783 tsvector_ops PGNSP PGUID 3655 3614 t 3642 ));
+DATA(insert ( 2742 tsvector_ops PGNSP PGUID 3659 3614 t 25 ));
+DATA(insert ( 403 tsquery_ops PGNSP PGUID 3683 3615 t 0 ));
+DATA(insert ( 783 tsquery_ops PGNSP PGUID 3702 3615 t 20 ));
+DATA(insert ( 403 range_ops PGNSP PGUID 3901 3831 t 0 ));
+DATA(insert ( 405 range_ops PGNSP PGUID 3903 3831 t 0 ));
+DATA(insert ( 783 range_ops PGNSP PGUID 3919 3831 t 0 ));
+DATA(insert ( 4000 range_ops PGNSP PGUID 3474 3831 t 0 ));
+DATA(insert ( 4000 quad_point_ops PGNSP PGUID 4015 600 t 0 ));
+DATA(insert ( 4000 kd_point_ops PGNSP PGUID 4016 600 f 0 ));
+DATA(insert ( 4000 text_ops PGNSP PGUID 4017 25 t 0 ));
+
+
+DATA(insert ( 3580 int2_minmax_ops PGNSP PGUID 5321 21 t 0 ));
+DATA(insert ( 3580 int4_minmax_ops PGNSP PGUID 5321 23 t 0 ));
+DATA(insert ( 3580 int8_minmax_ops PGNSP PGUID 5321 20 t 0 ));
+DATA(insert ( 3580 float4_minmax_ops PGNSP PGUID 5322 700 t 0 ));
+DATA(insert ( 3580 float8_minmax_ops PGNSP PGUID 5322 701 t 0 ));
+DATA(insert ( 3580 numeric_minmax_ops PGNSP PGUID 5323 1700 t 0 ));
+DATA(insert ( 3580 date_minmax_ops PGNSP PGUID 5324 1082 t 0 ));
+DATA(insert ( 3580 timestamp_minmax_ops PGNSP PGUID 5324 1114 t 0 ));
+DATA(insert ( 3580 timestamptz_minmax_ops PGNSP PGUID 5324 1184 t 0 ));
+DATA(insert ( 3580 text_minmax_ops PGNSP PGUID 5325 25 t 0 ));
+DATA(insert ( 3580 oid_minmax_ops PGNSP PGUID 5326 26 t 0 ));
+DATA(insert ( 3580 bpchar_minmax_ops PGNSP PGUID 5327 1042 t 0 ));
+DATA(insert ( 3580 bytea_minmax_ops PGNSP PGUID 5328 17 t 0 ));
+DATA(insert ( 3580 time_minmax_ops PGNSP PGUID 5329 1083 t 0 ));
+DATA(insert ( 3580 interval_minmax_ops PGNSP PGUID 5330 1186 t 0 ));
+
+
+DATA(insert ( 403 jsonb_ops PGNSP PGUID 5413 3802 t 0 ));
+DATA(insert ( 405 jsonb_ops PGNSP PGUID 5414 3802 t 0 ));
+DATA(insert ( 2742 jsonb_ops PGNSP PGUID 5415 3802 t 25 ));
@@ -0,0 +1,132 @@
+# 0 "pg_opfamily.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_opfamily.h.c"
+# 23 "pg_opfamily.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_opfamily.h.c" 2
+# 35 "pg_opfamily.h.c"
+CATALOG(pg_opfamily,2753)
+{
+ Oid opfmethod;
+ NameData opfname;
+ Oid opfnamespace;
+ Oid opfowner;
+} FormData_pg_opfamily;
+
+
+
+
+
+
+typedef FormData_pg_opfamily *Form_pg_opfamily;
+# 65 "pg_opfamily.h.c"
+DATA(insert OID = 421 ( 403 abstime_ops PGNSP PGUID ));
+DATA(insert OID = 397 ( 403 array_ops PGNSP PGUID ));
+DATA(insert OID = 627 ( 405 array_ops PGNSP PGUID ));
+DATA(insert OID = 423 ( 403 bit_ops PGNSP PGUID ));
+DATA(insert OID = 424 ( 403 bool_ops PGNSP PGUID ));
+
+DATA(insert OID = 426 ( 403 bpchar_ops PGNSP PGUID ));
+
+DATA(insert OID = 427 ( 405 bpchar_ops PGNSP PGUID ));
+DATA(insert OID = 428 ( 403 bytea_ops PGNSP PGUID ));
+
+DATA(insert OID = 429 ( 403 char_ops PGNSP PGUID ));
+DATA(insert OID = 431 ( 405 char_ops PGNSP PGUID ));
+DATA(insert OID = 434 ( 403 datetime_ops PGNSP PGUID ));
+
+DATA(insert OID = 435 ( 405 date_ops PGNSP PGUID ));
+DATA(insert OID = 1970 ( 403 float_ops PGNSP PGUID ));
+DATA(insert OID = 1971 ( 405 float_ops PGNSP PGUID ));
+DATA(insert OID = 1974 ( 403 network_ops PGNSP PGUID ));
+
+DATA(insert OID = 1975 ( 405 network_ops PGNSP PGUID ));
+DATA(insert OID = 1976 ( 403 integer_ops PGNSP PGUID ));
+
+DATA(insert OID = 1977 ( 405 integer_ops PGNSP PGUID ));
+DATA(insert OID = 1982 ( 403 interval_ops PGNSP PGUID ));
+DATA(insert OID = 1983 ( 405 interval_ops PGNSP PGUID ));
+DATA(insert OID = 1984 ( 403 macaddr_ops PGNSP PGUID ));
+DATA(insert OID = 1985 ( 405 macaddr_ops PGNSP PGUID ));
+DATA(insert OID = 1986 ( 403 name_ops PGNSP PGUID ));
+
+DATA(insert OID = 1987 ( 405 name_ops PGNSP PGUID ));
+DATA(insert OID = 1988 ( 403 numeric_ops PGNSP PGUID ));
+DATA(insert OID = 1998 ( 405 numeric_ops PGNSP PGUID ));
+DATA(insert OID = 1989 ( 403 oid_ops PGNSP PGUID ));
+
+DATA(insert OID = 1990 ( 405 oid_ops PGNSP PGUID ));
+DATA(insert OID = 1991 ( 403 oidvector_ops PGNSP PGUID ));
+DATA(insert OID = 1992 ( 405 oidvector_ops PGNSP PGUID ));
+DATA(insert OID = 2994 ( 403 record_ops PGNSP PGUID ));
+DATA(insert OID = 1994 ( 403 text_ops PGNSP PGUID ));
+
+DATA(insert OID = 1995 ( 405 text_ops PGNSP PGUID ));
+DATA(insert OID = 1996 ( 403 time_ops PGNSP PGUID ));
+DATA(insert OID = 1997 ( 405 time_ops PGNSP PGUID ));
+DATA(insert OID = 1999 ( 405 timestamptz_ops PGNSP PGUID ));
+DATA(insert OID = 2000 ( 403 timetz_ops PGNSP PGUID ));
+DATA(insert OID = 2001 ( 405 timetz_ops PGNSP PGUID ));
+DATA(insert OID = 2002 ( 403 varbit_ops PGNSP PGUID ));
+DATA(insert OID = 2040 ( 405 timestamp_ops PGNSP PGUID ));
+DATA(insert OID = 2095 ( 403 text_pattern_ops PGNSP PGUID ));
+
+DATA(insert OID = 2097 ( 403 bpchar_pattern_ops PGNSP PGUID ));
+
+DATA(insert OID = 2099 ( 403 money_ops PGNSP PGUID ));
+DATA(insert OID = 2222 ( 405 bool_ops PGNSP PGUID ));
+
+DATA(insert OID = 2223 ( 405 bytea_ops PGNSP PGUID ));
+DATA(insert OID = 2224 ( 405 int2vector_ops PGNSP PGUID ));
+DATA(insert OID = 2789 ( 403 tid_ops PGNSP PGUID ));
+DATA(insert OID = 2225 ( 405 xid_ops PGNSP PGUID ));
+DATA(insert OID = 2226 ( 405 cid_ops PGNSP PGUID ));
+DATA(insert OID = 2227 ( 405 abstime_ops PGNSP PGUID ));
+DATA(insert OID = 2228 ( 405 reltime_ops PGNSP PGUID ));
+DATA(insert OID = 2229 ( 405 text_pattern_ops PGNSP PGUID ));
+DATA(insert OID = 2231 ( 405 bpchar_pattern_ops PGNSP PGUID ));
+DATA(insert OID = 2233 ( 403 reltime_ops PGNSP PGUID ));
+DATA(insert OID = 2234 ( 403 tinterval_ops PGNSP PGUID ));
+DATA(insert OID = 2235 ( 405 aclitem_ops PGNSP PGUID ));
+DATA(insert OID = 2593 ( 783 box_ops PGNSP PGUID ));
+DATA(insert OID = 2594 ( 783 poly_ops PGNSP PGUID ));
+DATA(insert OID = 2595 ( 783 circle_ops PGNSP PGUID ));
+DATA(insert OID = 1029 ( 783 point_ops PGNSP PGUID ));
+DATA(insert OID = 2745 ( 2742 array_ops PGNSP PGUID ));
+DATA(insert OID = 2968 ( 403 uuid_ops PGNSP PGUID ));
+DATA(insert OID = 2969 ( 405 uuid_ops PGNSP PGUID ));
+DATA(insert OID = 3522 ( 403 enum_ops PGNSP PGUID ));
+DATA(insert OID = 3523 ( 405 enum_ops PGNSP PGUID ));
+DATA(insert OID = 3626 ( 403 tsvector_ops PGNSP PGUID ));
+DATA(insert OID = 3655 ( 783 tsvector_ops PGNSP PGUID ));
+DATA(insert OID = 3659 ( 2742 tsvector_ops PGNSP PGUID ));
+DATA(insert OID = 3683 ( 403 tsquery_ops PGNSP PGUID ));
+DATA(insert OID = 3702 ( 783 tsquery_ops PGNSP PGUID ));
+DATA(insert OID = 3901 ( 403 range_ops PGNSP PGUID ));
+DATA(insert OID = 3903 ( 405 range_ops PGNSP PGUID ));
+DATA(insert OID = 3919 ( 783 range_ops PGNSP PGUID ));
+DATA(insert OID = 3474 ( 4000 range_ops PGNSP PGUID ));
+DATA(insert OID = 4015 ( 4000 quad_point_ops PGNSP PGUID ));
+DATA(insert OID = 4016 ( 4000 kd_point_ops PGNSP PGUID ));
+DATA(insert OID = 4017 ( 4000 text_ops PGNSP PGUID ));
+
+
+
+DATA(insert OID = 5321 ( 3580 integer_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5322 ( 3580 float_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5323 ( 3580 numeric_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5324 ( 3580 datetime_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5325 ( 3580 text_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5326 ( 3580 oid_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5327 ( 3580 bpchar_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5328 ( 3580 bytea_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5329 ( 3580 time_minmax_ops PGNSP PGUID ));
+DATA(insert OID = 5330 ( 3580 interval_minmax_ops PGNSP PGUID ));
+
+
+DATA(insert OID = 5413 ( 403 jsonb_ops PGNSP PGUID ));
+DATA(insert OID = 5414 ( 405 jsonb_ops PGNSP PGUID ));
+DATA(insert OID = 5415 ( 2742 jsonb_ops PGNSP PGUID ));
@@ -0,0 +1,40 @@
+# 0 "pg_pltemplate.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_pltemplate.h.c"
+# 23 "pg_pltemplate.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_pltemplate.h.c" 2
+# 35 "pg_pltemplate.h.c"
+CATALOG(pg_pltemplate,1136) BKI_SHARED_RELATION BKI_WITHOUT_OIDS
+{
+ NameData tmplname;
+ bool tmpltrusted;
+ bool tmpldbacreate;
+
+
+ text tmplhandler;
+ text tmplinline;
+ text tmplvalidator;
+ text tmpllibrary;
+ aclitem tmplacl[1];
+
+} FormData_pg_pltemplate;
+
+
+
+
+
+
+typedef FormData_pg_pltemplate *Form_pg_pltemplate;
+# 77 "pg_pltemplate.h.c"
+DATA(insert ( "plpgsql" t t "plpgsql_call_handler" "plpgsql_inline_handler" "plpgsql_validator" "$libdir/plpgsql" _null_ ));
+DATA(insert ( "pltcl" t t "pltcl_call_handler" _null_ _null_ "$libdir/pltcl" _null_ ));
+DATA(insert ( "pltclu" f f "pltclu_call_handler" _null_ _null_ "$libdir/pltcl" _null_ ));
+DATA(insert ( "plperl" t t "plperl_call_handler" "plperl_inline_handler" "plperl_validator" "$libdir/plperl" _null_ ));
+DATA(insert ( "plperlu" f f "plperlu_call_handler" "plperlu_inline_handler" "plperlu_validator" "$libdir/plperl" _null_ ));
+DATA(insert ( "plpythonu" f f "plpython_call_handler" "plpython_inline_handler" "plpython_validator" "$libdir/plpython2" _null_ ));
+DATA(insert ( "plpython2u" f f "plpython2_call_handler" "plpython2_inline_handler" "plpython2_validator" "$libdir/plpython2" _null_ ));
+DATA(insert ( "plpython3u" f f "plpython3_call_handler" "plpython3_inline_handler" "plpython3_validator" "$libdir/plpython3" _null_ ));
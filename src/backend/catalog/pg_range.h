@@ -0,0 +1,43 @@
+# 0 "pg_range.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_range.h.c"
+# 26 "pg_range.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 27 "pg_range.h.c" 2
+# 38 "pg_range.h.c"
+CATALOG(pg_range,3541) BKI_WITHOUT_OIDS
+{
+ Oid rngtypid;
+ Oid rngsubtype;
+ Oid rngcollation;
+ Oid rngsubopc;
+ regproc rngcanonical;
+ regproc rngsubdiff;
+} FormData_pg_range;
+
+
+
+
+
+
+typedef FormData_pg_range *Form_pg_range;
+# 72 "pg_range.h.c"
+DATA(insert ( 3904 23 0 1978 int4range_canonical int4range_subdiff));
+DATA(insert ( 3906 1700 0 3125 - numrange_subdiff));
+DATA(insert ( 3908 1114 0 3128 - tsrange_subdiff));
+DATA(insert ( 3910 1184 0 3127 - tstzrange_subdiff));
+DATA(insert ( 3912 1082 0 3122 daterange_canonical daterange_subdiff));
+DATA(insert ( 3926 20 0 3124 int8range_canonical int8range_subdiff));
+
+
+
+
+
+
+extern void RangeCreate(Oid rangeTypeOid, Oid rangeSubType, Oid rangeCollation,
+   Oid rangeSubOpclass, RegProcedure rangeCanonical,
+   RegProcedure rangeSubDiff);
+extern void RangeDelete(Oid rangeTypeOid);
@@ -0,0 +1,31 @@
+# 0 "pg_rewrite.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_rewrite.h.c"
+# 26 "pg_rewrite.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 27 "pg_rewrite.h.c" 2
+# 38 "pg_rewrite.h.c"
+CATALOG(pg_rewrite,2618)
+{
+ NameData rulename;
+ Oid ev_class;
+ int16 ev_attr;
+ char ev_type;
+ char ev_enabled;
+ bool is_instead;
+
+
+ pg_node_tree ev_qual;
+ pg_node_tree ev_action;
+
+} FormData_pg_rewrite;
+
+
+
+
+
+
+typedef FormData_pg_rewrite *Form_pg_rewrite;
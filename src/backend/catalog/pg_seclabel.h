@@ -0,0 +1,21 @@
+# 0 "pg_seclabel.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_seclabel.h.c"
+# 15 "pg_seclabel.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 16 "pg_seclabel.h.c" 2
+# 27 "pg_seclabel.h.c"
+CATALOG(pg_seclabel,3596) BKI_WITHOUT_OIDS
+{
+ Oid objoid;
+ Oid classoid;
+ int32 objsubid;
+
+
+ text provider;
+ text label;
+
+} FormData_pg_seclabel;
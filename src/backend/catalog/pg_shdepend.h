@@ -0,0 +1,44 @@
+# 0 "pg_shdepend.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_shdepend.h.c"
+# 23 "pg_shdepend.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_shdepend.h.c" 2
+# 35 "pg_shdepend.h.c"
+CATALOG(pg_shdepend,1214) BKI_SHARED_RELATION BKI_WITHOUT_OIDS
+{
+
+
+
+
+
+
+ Oid dbid;
+ Oid classid;
+ Oid objid;
+ int32 objsubid;
+
+
+
+
+
+
+ Oid refclassid;
+ Oid refobjid;
+
+
+
+
+
+ char deptype;
+} FormData_pg_shdepend;
+
+
+
+
+
+
+typedef FormData_pg_shdepend *Form_pg_shdepend;
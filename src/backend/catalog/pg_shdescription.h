@@ -0,0 +1,26 @@
+# 0 "pg_shdescription.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_shdescription.h.c"
+# 33 "pg_shdescription.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 34 "pg_shdescription.h.c" 2
+# 45 "pg_shdescription.h.c"
+CATALOG(pg_shdescription,2396) BKI_SHARED_RELATION BKI_WITHOUT_OIDS
+{
+ Oid objoid;
+ Oid classoid;
+
+
+ text description;
+
+} FormData_pg_shdescription;
+
+
+
+
+
+
+typedef FormData_pg_shdescription *Form_pg_shdescription;
@@ -0,0 +1,20 @@
+# 0 "pg_shseclabel.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_shseclabel.h.c"
+# 15 "pg_shseclabel.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 16 "pg_shseclabel.h.c" 2
+# 27 "pg_shseclabel.h.c"
+CATALOG(pg_shseclabel,3592) BKI_SHARED_RELATION BKI_WITHOUT_OIDS
+{
+ Oid objoid;
+ Oid classoid;
+
+
+ text provider;
+ text label;
+
+} FormData_pg_shseclabel;
@@ -0,0 +1,58 @@
+# 0 "pg_statistic.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_statistic.h.c"
+# 23 "pg_statistic.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_statistic.h.c" 2
+# 35 "pg_statistic.h.c"
+CATALOG(pg_statistic,2619) BKI_WITHOUT_OIDS
+{
+
+ Oid starelid;
+ int16 staattnum;
+ bool stainherit;
+
+
+ float4 stanullfrac;
+# 55 "pg_statistic.h.c"
+ int32 stawidth;
+# 73 "pg_statistic.h.c"
+ float4 stadistinct;
+# 91 "pg_statistic.h.c"
+ int16 stakind1;
+ int16 stakind2;
+ int16 stakind3;
+ int16 stakind4;
+ int16 stakind5;
+
+ Oid staop1;
+ Oid staop2;
+ Oid staop3;
+ Oid staop4;
+ Oid staop5;
+
+
+ float4 stanumbers1[1];
+ float4 stanumbers2[1];
+ float4 stanumbers3[1];
+ float4 stanumbers4[1];
+ float4 stanumbers5[1];
+
+
+
+
+
+
+
+ anyarray stavalues1;
+ anyarray stavalues2;
+ anyarray stavalues3;
+ anyarray stavalues4;
+ anyarray stavalues5;
+
+} FormData_pg_statistic;
+# 132 "pg_statistic.h.c"
+typedef FormData_pg_statistic *Form_pg_statistic;
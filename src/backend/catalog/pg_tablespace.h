@@ -0,0 +1,30 @@
+# 0 "pg_tablespace.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_tablespace.h.c"
+# 23 "pg_tablespace.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_tablespace.h.c" 2
+# 35 "pg_tablespace.h.c"
+CATALOG(pg_tablespace,1213) BKI_SHARED_RELATION
+{
+ NameData spcname;
+ Oid spcowner;
+
+
+ aclitem spcacl[1];
+ text spcoptions[1];
+
+} FormData_pg_tablespace;
+
+
+
+
+
+
+typedef FormData_pg_tablespace *Form_pg_tablespace;
+# 64 "pg_tablespace.h.c"
+DATA(insert OID = 1663 ( pg_default PGUID _null_ _null_ ));
+DATA(insert OID = 1664 ( pg_global PGUID _null_ _null_ ));
@@ -0,0 +1,45 @@
+# 0 "pg_trigger.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_trigger.h.c"
+# 23 "pg_trigger.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pg_trigger.h.c" 2
+# 40 "pg_trigger.h.c"
+CATALOG(pg_trigger,2620)
+{
+ Oid tgrelid;
+ NameData tgname;
+ Oid tgfoid;
+ int16 tgtype;
+
+ char tgenabled;
+
+ bool tgisinternal;
+ Oid tgconstrrelid;
+ Oid tgconstrindid;
+ Oid tgconstraint;
+ bool tgdeferrable;
+ bool tginitdeferred;
+ int16 tgnargs;
+
+
+
+
+
+ int2vector tgattr;
+
+
+ bytea tgargs;
+ pg_node_tree tgqual;
+
+} FormData_pg_trigger;
+
+
+
+
+
+
+typedef FormData_pg_trigger *Form_pg_trigger;
@@ -0,0 +1,22 @@
+# 0 "pg_ts_config.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_ts_config.h.c"
+# 25 "pg_ts_config.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_ts_config.h.c" 2
+# 37 "pg_ts_config.h.c"
+CATALOG(pg_ts_config,3602)
+{
+ NameData cfgname;
+ Oid cfgnamespace;
+ Oid cfgowner;
+ Oid cfgparser;
+} FormData_pg_ts_config;
+
+typedef FormData_pg_ts_config *Form_pg_ts_config;
+# 61 "pg_ts_config.h.c"
+DATA(insert OID = 3748 ( "simple" PGNSP PGUID 3722 ));
+DESCR("simple configuration");
@@ -0,0 +1,39 @@
+# 0 "pg_ts_config_map.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_ts_config_map.h.c"
+# 25 "pg_ts_config_map.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_ts_config_map.h.c" 2
+# 37 "pg_ts_config_map.h.c"
+CATALOG(pg_ts_config_map,3603) BKI_WITHOUT_OIDS
+{
+ Oid mapcfg;
+ int32 maptokentype;
+ int32 mapseqno;
+ Oid mapdict;
+} FormData_pg_ts_config_map;
+
+typedef FormData_pg_ts_config_map *Form_pg_ts_config_map;
+# 62 "pg_ts_config_map.h.c"
+DATA(insert ( 3748 1 1 3765 ));
+DATA(insert ( 3748 2 1 3765 ));
+DATA(insert ( 3748 3 1 3765 ));
+DATA(insert ( 3748 4 1 3765 ));
+DATA(insert ( 3748 5 1 3765 ));
+DATA(insert ( 3748 6 1 3765 ));
+DATA(insert ( 3748 7 1 3765 ));
+DATA(insert ( 3748 8 1 3765 ));
+DATA(insert ( 3748 9 1 3765 ));
+DATA(insert ( 3748 10 1 3765 ));
+DATA(insert ( 3748 11 1 3765 ));
+DATA(insert ( 3748 15 1 3765 ));
+DATA(insert ( 3748 16 1 3765 ));
+DATA(insert ( 3748 17 1 3765 ));
+DATA(insert ( 3748 18 1 3765 ));
+DATA(insert ( 3748 19 1 3765 ));
+DATA(insert ( 3748 20 1 3765 ));
+DATA(insert ( 3748 21 1 3765 ));
+DATA(insert ( 3748 22 1 3765 ));
@@ -0,0 +1,26 @@
+# 0 "pg_ts_dict.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_ts_dict.h.c"
+# 25 "pg_ts_dict.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_ts_dict.h.c" 2
+# 37 "pg_ts_dict.h.c"
+CATALOG(pg_ts_dict,3600)
+{
+ NameData dictname;
+ Oid dictnamespace;
+ Oid dictowner;
+ Oid dicttemplate;
+
+
+ text dictinitoption;
+
+} FormData_pg_ts_dict;
+
+typedef FormData_pg_ts_dict *Form_pg_ts_dict;
+# 67 "pg_ts_dict.h.c"
+DATA(insert OID = 3765 ( "simple" PGNSP PGUID 3727 _null_));
+DESCR("simple dictionary: just lower case and check for stopword");
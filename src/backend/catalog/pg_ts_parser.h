@@ -0,0 +1,25 @@
+# 0 "pg_ts_parser.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_ts_parser.h.c"
+# 25 "pg_ts_parser.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_ts_parser.h.c" 2
+# 37 "pg_ts_parser.h.c"
+CATALOG(pg_ts_parser,3601)
+{
+ NameData prsname;
+ Oid prsnamespace;
+ regproc prsstart;
+ regproc prstoken;
+ regproc prsend;
+ regproc prsheadline;
+ regproc prslextype;
+} FormData_pg_ts_parser;
+
+typedef FormData_pg_ts_parser *Form_pg_ts_parser;
+# 68 "pg_ts_parser.h.c"
+DATA(insert OID = 3722 ( "default" PGNSP prsd_start prsd_nexttoken prsd_end prsd_headline prsd_lextype ));
+DESCR("default word parser");
@@ -0,0 +1,28 @@
+# 0 "pg_ts_template.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_ts_template.h.c"
+# 25 "pg_ts_template.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 26 "pg_ts_template.h.c" 2
+# 37 "pg_ts_template.h.c"
+CATALOG(pg_ts_template,3764)
+{
+ NameData tmplname;
+ Oid tmplnamespace;
+ regproc tmplinit;
+ regproc tmpllexize;
+} FormData_pg_ts_template;
+
+typedef FormData_pg_ts_template *Form_pg_ts_template;
+# 62 "pg_ts_template.h.c"
+DATA(insert OID = 3727 ( "simple" PGNSP dsimple_init dsimple_lexize ));
+DESCR("simple dictionary: just lower case and check for stopword");
+DATA(insert OID = 3730 ( "synonym" PGNSP dsynonym_init dsynonym_lexize ));
+DESCR("synonym dictionary: replace word by its synonym");
+DATA(insert OID = 3733 ( "ispell" PGNSP dispell_init dispell_lexize ));
+DESCR("ispell dictionary");
+DATA(insert OID = 3742 ( "thesaurus" PGNSP thesaurus_init thesaurus_lexize ));
+DESCR("thesaurus dictionary: phrase by phrase substitution");
@@ -0,0 +1,27 @@
+# 0 "pg_user_mapping.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pg_user_mapping.h.c"
+# 21 "pg_user_mapping.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 22 "pg_user_mapping.h.c" 2
+# 33 "pg_user_mapping.h.c"
+CATALOG(pg_user_mapping,1418)
+{
+ Oid umuser;
+
+ Oid umserver;
+
+
+ text umoptions[1];
+
+} FormData_pg_user_mapping;
+
+
+
+
+
+
+typedef FormData_pg_user_mapping *Form_pg_user_mapping;
@@ -26,6 +26,13 @@
 
 #ifdef ADB
 #include "catalog/pg_proc.h"
+#include "utils/lsyscache.h"
+#include "utils/tqual.h"
+
+static bool PgxcClassSamePlacement(TupleDesc tupdesc, HeapTuple tup1,
+								   HeapTuple tup2);
+static int32 PgxcClassColocation(Relation pgxcclassrel, HeapTuple tup);
+static HeapTuple PgxcClassSetColocation(Relation pgxcclassrel, HeapTuple tup);
 #endif
 
 /*
@@ -44,6 +51,7 @@ PgxcClassCreate(Oid pcrelid,
 				, Oid pcfuncid
 				, int numatts
 				, int16 *pcfuncattnums
+				, List *pcdistvalues
 #endif
 				)
 {
@@ -77,7 +85,12 @@ PgxcClassCreate(Oid pcrelid,
 	values[Anum_pgxc_class_pcrelid - 1]   = ObjectIdGetDatum(pcrelid);
 	values[Anum_pgxc_class_pclocatortype - 1] = CharGetDatum(pclocatortype);
 
-	if (pclocatortype == LOCATOR_TYPE_HASH || pclocatortype == LOCATOR_TYPE_MODULO)
+	if (pclocatortype == LOCATOR_TYPE_HASH || pclocatortype == LOCATOR_TYPE_MODULO
+#ifdef ADB
+		|| pclocatortype == LOCATOR_TYPE_BUCKET
+		|| IsLocatorDistributedByRangeOrList(pclocatortype)
+#endif
+		)
 	{
 		values[Anum_pgxc_class_pcattnum - 1] = UInt16GetDatum(pcattnum);
 		values[Anum_pgxc_class_pchashalgorithm - 1] = UInt16GetDatum(pchashalgorithm);
@@ -102,6 +115,26 @@ PgxcClassCreate(Oid pcrelid,
 		nulls[Anum_pgxc_class_pcfuncid - 1] = true;
 		nulls[Anum_pgxc_class_pcfuncattnums - 1] = true;
 	}
+
+	if (pclocatortype == LOCATOR_TYPE_BUCKET)
+	{
+		int16 *map = BuildBucketMap(pchashbuckets, NULL, NULL, 0, nodes, numnodes, true);
+
+		values[Anum_pgxc_class_pcbucketmap - 1] =
+			PointerGetDatum(buildint2vector(map, pchashbuckets));
+	} else
+	{
+		nulls[Anum_pgxc_class_pcbucketmap - 1] = true;
+	}
+
+	/* Not known until the table is analyzed */
+	nulls[Anum_pgxc_class_pcnodeskew - 1] = true;
+
+	if (IsLocatorDistributedByRangeOrList(pclocatortype))
+		values[Anum_pgxc_class_pcdistvalues - 1] =
+			CStringGetTextDatum(nodeToString(pcdistvalues));
+	else
+		nulls[Anum_pgxc_class_pcdistvalues - 1] = true;
 #endif
 
 
@@ -109,6 +142,9 @@ PgxcClassCreate(Oid pcrelid,
 	pgxcclassrel = heap_open(PgxcClassRelationId, RowExclusiveLock);
 
 	htup = heap_form_tuple(pgxcclassrel->rd_att, values, nulls);
+#ifdef ADB
+	htup = PgxcClassSetColocation(pgxcclassrel, htup);
+#endif
 
 	(void) simple_heap_insert(pgxcclassrel, htup);
 
@@ -139,6 +175,7 @@ PgxcClassAlter(Oid pcrelid,
 			   , Oid pcfuncid
 			   , int numatts
 			   , int16 *pcfuncattnums
+			   , List *pcdistvalues
 #endif
 			   )
 {
@@ -147,6 +184,7 @@ PgxcClassAlter(Oid pcrelid,
 	oidvector  *nodes_array;
 #ifdef ADB
 	int2vector	*attrs_array = NULL;
+	Form_pgxc_class old_class;
 #endif
 
 	Datum		new_record[Natts_pgxc_class];
@@ -181,10 +219,17 @@ PgxcClassAlter(Oid pcrelid,
 #ifdef ADB
 			new_record_repl[Anum_pgxc_class_pcfuncid - 1] = true;
 			new_record_repl[Anum_pgxc_class_pcfuncattnums - 1] = true;
+			new_record_repl[Anum_pgxc_class_pcbucketmap - 1] = true;
+			new_record_repl[Anum_pgxc_class_pcnodeskew - 1] = true;
+			new_record_repl[Anum_pgxc_class_pcdistvalues - 1] = true;
 #endif
 			break;
 		case PGXC_CLASS_ALTER_NODES:
 			new_record_repl[Anum_pgxc_class_nodes - 1] = true;
+#ifdef ADB
+			new_record_repl[Anum_pgxc_class_pcbucketmap - 1] = true;
+			new_record_repl[Anum_pgxc_class_pcnodeskew - 1] = true;
+#endif
 			break;
 		case PGXC_CLASS_ALTER_ALL:
 		default:
@@ -197,6 +242,9 @@ PgxcClassAlter(Oid pcrelid,
 #ifdef ADB
 			new_record_repl[Anum_pgxc_class_pcfuncid - 1] = true;
 			new_record_repl[Anum_pgxc_class_pcfuncattnums - 1] = true;
+			new_record_repl[Anum_pgxc_class_pcbucketmap - 1] = true;
+			new_record_repl[Anum_pgxc_class_pcnodeskew - 1] = true;
+			new_record_repl[Anum_pgxc_class_pcdistvalues - 1] = true;
 #endif
 	}
 
@@ -245,6 +293,23 @@ PgxcClassAlter(Oid pcrelid,
 		}
 	}
 
+	/*
+	 * Bounds and values of a range or list distribution go with it, a change
+	 * of the nodes only keeps them, their number being checked by the caller.
+	 */
+	if (new_record_repl[Anum_pgxc_class_pcdistvalues - 1])
+	{
+		if (IsLocatorDistributedByRangeOrList(pclocatortype))
+			new_record[Anum_pgxc_class_pcdistvalues - 1] =
+				CStringGetTextDatum(nodeToString(pcdistvalues));
+		else
+			new_record_nulls[Anum_pgxc_class_pcdistvalues - 1] = true;
+	}
+
+	/* Rows are moved, the skew is known again at the next ANALYZE */
+	if (new_record_repl[Anum_pgxc_class_pcnodeskew - 1])
+		new_record_nulls[Anum_pgxc_class_pcnodeskew - 1] = true;
+
 	if (new_record_repl[Anum_pgxc_class_pcfuncattnums - 1])
 	{
 		if (IsLocatorDistributedByUserDefined(pclocatortype))
@@ -257,12 +322,76 @@ PgxcClassAlter(Oid pcrelid,
 			new_record_nulls[Anum_pgxc_class_pcfuncattnums - 1] = true;
 		}
 	}
+
+	/*
+	 * Keep the bucket map in line with the distribution. A bucket map which
+	 * already exists is only rebalanced so that as few buckets as possible
+	 * change of node when nodes are added or removed, and in online mode the
+	 * nodes kept keep all their buckets.
+	 */
+	old_class = (Form_pgxc_class) GETSTRUCT(oldtup);
+	if (new_record_repl[Anum_pgxc_class_pcbucketmap - 1])
+	{
+		char		locatortype;
+		int			numbuckets;
+		int			new_num;
+		const Oid  *new_nodes;
+		int16	   *old_map = NULL;
+		int16	   *map;
+		Datum		datum;
+		bool		isnull;
+
+		if (type == PGXC_CLASS_ALTER_NODES)
+		{
+			locatortype = old_class->pclocatortype;
+			numbuckets = old_class->pchashbuckets;
+		} else
+		{
+			locatortype = pclocatortype;
+			numbuckets = pchashbuckets;
+		}
+
+		if (type == PGXC_CLASS_ALTER_DISTRIBUTION)
+		{
+			new_num = old_class->nodeoids.dim1;
+			new_nodes = old_class->nodeoids.values;
+		} else
+		{
+			new_num = numnodes;
+			new_nodes = nodes;
+		}
+
+		if (locatortype != LOCATOR_TYPE_BUCKET)
+		{
+			new_record_nulls[Anum_pgxc_class_pcbucketmap - 1] = true;
+		} else
+		{
+			datum = SysCacheGetAttr(PGXCCLASSRELID, oldtup,
+									Anum_pgxc_class_pcbucketmap, &isnull);
+			if (!isnull &&
+				old_class->pclocatortype == LOCATOR_TYPE_BUCKET &&
+				((int2vector *) DatumGetPointer(datum))->dim1 == numbuckets)
+				old_map = ((int2vector *) DatumGetPointer(datum))->values;
+
+			map = BuildBucketMap(numbuckets, old_map,
+								 old_class->nodeoids.values,
+								 old_class->nodeoids.dim1,
+								 new_nodes, new_num,
+								 !(type == PGXC_CLASS_ALTER_NODES &&
+								   online_bucket_redistribution));
+			new_record[Anum_pgxc_class_pcbucketmap - 1] =
+				PointerGetDatum(buildint2vector(map, numbuckets));
+		}
+	}
 #endif
 
 	/* Update relation */
 	newtup = heap_modify_tuple(oldtup, RelationGetDescr(rel),
 							   new_record,
 							   new_record_nulls, new_record_repl);
+#ifdef ADB
+	newtup = PgxcClassSetColocation(rel, newtup);
+#endif
 	simple_heap_update(rel, &oldtup->t_self, newtup);
 	CatalogUpdateIndexes(rel, newtup);
 
@@ -319,4 +448,216 @@ CreatePgxcClassFuncDepend(char locatortype, Oid relid, Oid funcid)
 		recordDependencyOn(&myself, &referenced, DEPENDENCY_NORMAL);
 	}
 }
+
+/*
+ * PgxcClassAlterBucketMap
+ *		Replace the bucket map of a pgxc_class entry, the node list being
+ *		unchanged. Used when buckets are moved a few at a time.
+ */
+void
+PgxcClassAlterBucketMap(Oid pcrelid, int numbuckets, int16 *map)
+{
+	Relation	rel;
+	HeapTuple	oldtup, newtup;
+	Datum		new_record[Natts_pgxc_class];
+	bool		new_record_nulls[Natts_pgxc_class];
+	bool		new_record_repl[Natts_pgxc_class];
+
+	Assert(OidIsValid(pcrelid) && map);
+
+	rel = heap_open(PgxcClassRelationId, RowExclusiveLock);
+	oldtup = SearchSysCacheCopy1(PGXCCLASSRELID,
+								 ObjectIdGetDatum(pcrelid));
+
+	if (!HeapTupleIsValid(oldtup)) /* should not happen */
+		elog(ERROR, "cache lookup failed for pgxc_class %u", pcrelid);
+
+	MemSet(new_record, 0, sizeof(new_record));
+	MemSet(new_record_nulls, false, sizeof(new_record_nulls));
+	MemSet(new_record_repl, false, sizeof(new_record_repl));
+
+	new_record_repl[Anum_pgxc_class_pcbucketmap - 1] = true;
+	new_record[Anum_pgxc_class_pcbucketmap - 1] =
+		PointerGetDatum(buildint2vector(map, numbuckets));
+
+	newtup = heap_modify_tuple(oldtup, RelationGetDescr(rel),
+							   new_record,
+							   new_record_nulls, new_record_repl);
+	newtup = PgxcClassSetColocation(rel, newtup);
+	simple_heap_update(rel, &oldtup->t_self, newtup);
+	CatalogUpdateIndexes(rel, newtup);
+
+	heap_close(rel, RowExclusiveLock);
+}
+
+/*
+ * PgxcClassAlterNodeSkew
+ *		Record how unevenly the rows of a table are spread over its nodes, as
+ *		found by ANALYZE.
+ */
+void
+PgxcClassAlterNodeSkew(Oid pcrelid, float4 skew)
+{
+	Relation	rel;
+	HeapTuple	oldtup, newtup;
+	Datum		new_record[Natts_pgxc_class];
+	bool		new_record_nulls[Natts_pgxc_class];
+	bool		new_record_repl[Natts_pgxc_class];
+
+	Assert(OidIsValid(pcrelid));
+
+	rel = heap_open(PgxcClassRelationId, RowExclusiveLock);
+	oldtup = SearchSysCacheCopy1(PGXCCLASSRELID,
+								 ObjectIdGetDatum(pcrelid));
+
+	if (!HeapTupleIsValid(oldtup)) /* should not happen */
+		elog(ERROR, "cache lookup failed for pgxc_class %u", pcrelid);
+
+	MemSet(new_record, 0, sizeof(new_record));
+	MemSet(new_record_nulls, false, sizeof(new_record_nulls));
+	MemSet(new_record_repl, false, sizeof(new_record_repl));
+
+	new_record_repl[Anum_pgxc_class_pcnodeskew - 1] = true;
+	new_record[Anum_pgxc_class_pcnodeskew - 1] = Float4GetDatum(skew);
+
+	newtup = heap_modify_tuple(oldtup, RelationGetDescr(rel),
+							   new_record,
+							   new_record_nulls, new_record_repl);
+	simple_heap_update(rel, &oldtup->t_self, newtup);
+	CatalogUpdateIndexes(rel, newtup);
+
+	heap_close(rel, RowExclusiveLock);
+}
+
+/*
+ * PgxcClassSamePlacement
+ *		Do two pgxc_class entries put each value of their distribution
+ *		column on the same node?  That takes the same kind of distribution
+ *		over the same nodes in the same order, the same bucket map or the
+ *		same bounds or values, and distribution columns of the same type.
+ */
+static bool
+PgxcClassSamePlacement(TupleDesc tupdesc, HeapTuple tup1, HeapTuple tup2)
+{
+	Form_pgxc_class class1 = (Form_pgxc_class) GETSTRUCT(tup1);
+	Form_pgxc_class class2 = (Form_pgxc_class) GETSTRUCT(tup2);
+	Datum		datum1;
+	Datum		datum2;
+	bool		isnull1;
+	bool		isnull2;
+
+	if (class1->pclocatortype != class2->pclocatortype ||
+		class1->pchashalgorithm != class2->pchashalgorithm ||
+		class1->pchashbuckets != class2->pchashbuckets)
+		return false;
+
+	if (class1->nodeoids.dim1 != class2->nodeoids.dim1 ||
+		memcmp(class1->nodeoids.values, class2->nodeoids.values,
+			   sizeof(Oid) * class1->nodeoids.dim1) != 0)
+		return false;
+
+	if (get_atttype(class1->pcrelid, class1->pcattnum) !=
+		get_atttype(class2->pcrelid, class2->pcattnum))
+		return false;
+
+	datum1 = heap_getattr(tup1, Anum_pgxc_class_pcbucketmap, tupdesc, &isnull1);
+	datum2 = heap_getattr(tup2, Anum_pgxc_class_pcbucketmap, tupdesc, &isnull2);
+	if (isnull1 != isnull2)
+		return false;
+	if (!isnull1)
+	{
+		int2vector *map1 = (int2vector *) DatumGetPointer(datum1);
+		int2vector *map2 = (int2vector *) DatumGetPointer(datum2);
+
+		if (map1->dim1 != map2->dim1 ||
+			memcmp(map1->values, map2->values, sizeof(int16) * map1->dim1) != 0)
+			return false;
+	}
+
+	datum1 = heap_getattr(tup1, Anum_pgxc_class_pcdistvalues, tupdesc, &isnull1);
+	datum2 = heap_getattr(tup2, Anum_pgxc_class_pcdistvalues, tupdesc, &isnull2);
+	if (isnull1 != isnull2)
+		return false;
+	if (!isnull1 &&
+		strcmp(TextDatumGetCString(datum1), TextDatumGetCString(datum2)) != 0)
+		return false;
+
+	return true;
+}
+
+/*
+ * PgxcClassColocation
+ *		Colocation group of a pgxc_class entry: that of another table with
+ *		the same placement, or a new one. Equal values of the distribution
+ *		columns of tables of the same group are on the same node, so they
+ *		are joined on those columns node by node. Entries placing rows by
+ *		no value, or by a user-defined function, are in no group.
+ *
+ *		The group is computed again whenever the placement of a table
+ *		changes, all the tables of a group keep the same placement.
+ */
+static int32
+PgxcClassColocation(Relation pgxcclassrel, HeapTuple tup)
+{
+	Form_pgxc_class pcclass = (Form_pgxc_class) GETSTRUCT(tup);
+	TupleDesc	tupdesc = RelationGetDescr(pgxcclassrel);
+	HeapScanDesc scan;
+	HeapTuple	other;
+	int32		colocation = 0;
+	int32		maxcolocation = 0;
+
+	if (!IsLocatorDistributedByValue(pcclass->pclocatortype))
+		return 0;
+
+	scan = heap_beginscan(pgxcclassrel, SnapshotNow, 0, NULL);
+	while ((other = heap_getnext(scan, ForwardScanDirection)) != NULL)
+	{
+		Datum		datum;
+		bool		isnull;
+		int32		othercolocation;
+
+		if (((Form_pgxc_class) GETSTRUCT(other))->pcrelid == pcclass->pcrelid)
+			continue;
+
+		datum = heap_getattr(other, Anum_pgxc_class_pccolocation,
+							 tupdesc, &isnull);
+		othercolocation = isnull ? 0 : DatumGetInt32(datum);
+		if (othercolocation == 0)
+			continue;
+
+		maxcolocation = Max(maxcolocation, othercolocation);
+		if (colocation == 0 && PgxcClassSamePlacement(tupdesc, tup, other))
+			colocation = othercolocation;
+	}
+	heap_endscan(scan);
+
+	return colocation != 0 ? colocation : maxcolocation + 1;
+}
+
+/*
+ * PgxcClassSetColocation
+ *		Return the pgxc_class tuple with its colocation group set.
+ */
+static HeapTuple
+PgxcClassSetColocation(Relation pgxcclassrel, HeapTuple tup)
+{
+	Datum		new_record[Natts_pgxc_class];
+	bool		new_record_nulls[Natts_pgxc_class];
+	bool		new_record_repl[Natts_pgxc_class];
+	HeapTuple	newtup;
+
+	MemSet(new_record, 0, sizeof(new_record));
+	MemSet(new_record_nulls, false, sizeof(new_record_nulls));
+	MemSet(new_record_repl, false, sizeof(new_record_repl));
+
+	new_record_repl[Anum_pgxc_class_pccolocation - 1] = true;
+	new_record[Anum_pgxc_class_pccolocation - 1] =
+		Int32GetDatum(PgxcClassColocation(pgxcclassrel, tup));
+
+	newtup = heap_modify_tuple(tup, RelationGetDescr(pgxcclassrel),
+							   new_record, new_record_nulls, new_record_repl);
+	heap_freetuple(tup);
+
+	return newtup;
+}
 #endif
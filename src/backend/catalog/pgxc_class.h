@@ -0,0 +1,87 @@
+# 0 "pgxc_class.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pgxc_class.h.c"
+# 11 "pgxc_class.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 12 "pgxc_class.h.c" 2
+
+
+
+
+
+
+
+CATALOG(pgxc_class,9001) BKI_WITHOUT_OIDS
+{
+ Oid pcrelid;
+ char pclocatortype;
+ int16 pcattnum;
+ int16 pchashalgorithm;
+ int16 pchashbuckets;
+
+
+ oidvector nodeoids;
+
+
+ Oid pcfuncid;
+ int2vector pcfuncattnums;
+ int2vector pcbucketmap;
+ float4 pcnodeskew;
+
+ pg_node_tree pcdistvalues;
+
+ int32 pccolocation;
+
+
+
+
+} FormData_pgxc_class;
+
+typedef FormData_pgxc_class *Form_pgxc_class;
+# 68 "pgxc_class.h.c"
+typedef enum PgxcClassAlterType
+{
+ PGXC_CLASS_ALTER_DISTRIBUTION,
+ PGXC_CLASS_ALTER_NODES,
+ PGXC_CLASS_ALTER_ALL
+} PgxcClassAlterType;
+
+extern void PgxcClassCreate(Oid pcrelid,
+       char pclocatortype,
+       int pcattnum,
+       int pchashalgorithm,
+       int pchashbuckets,
+       int numnodes,
+       Oid *nodes
+
+       , Oid pcfuncid
+       , int numatts
+       , int16 *pcfuncattnums
+       , List *pcdistvalues
+
+       );
+extern void PgxcClassAlter(Oid pcrelid,
+         char pclocatortype,
+         int pcattnum,
+         int pchashalgorithm,
+         int pchashbuckets,
+         int numnodes,
+         Oid *nodes,
+         PgxcClassAlterType type
+
+         , Oid pcfuncid
+         , int numatts
+         , int16 *pcfuncattnums
+         , List *pcdistvalues
+
+
+         );
+extern void RemovePgxcClass(Oid pcrelid);
+
+
+extern void CreatePgxcClassFuncDepend(char locatortype, Oid relid, Oid funcid);
+extern void PgxcClassAlterBucketMap(Oid pcrelid, int numbuckets, int16 *map);
+extern void PgxcClassAlterNodeSkew(Oid pcrelid, float4 skew);
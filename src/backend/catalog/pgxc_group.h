@@ -0,0 +1,25 @@
+# 0 "pgxc_group.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pgxc_group.h.c"
+# 23 "pgxc_group.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pgxc_group.h.c" 2
+
+
+
+
+
+
+
+CATALOG(pgxc_group,9014) BKI_SHARED_RELATION
+{
+ NameData group_name;
+
+
+ oidvector group_members;
+} FormData_pgxc_group;
+
+typedef FormData_pgxc_group *Form_pgxc_group;
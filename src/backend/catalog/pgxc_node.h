@@ -0,0 +1,59 @@
+# 0 "pgxc_node.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "pgxc_node.h.c"
+# 23 "pgxc_node.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 24 "pgxc_node.h.c" 2
+
+
+
+
+
+
+CATALOG(pgxc_node,9015) BKI_SHARED_RELATION
+{
+ NameData node_name;
+
+
+
+
+
+ char node_type;
+
+
+
+
+ int32 node_port;
+
+
+
+
+ NameData node_host;
+
+
+
+
+ bool nodeis_primary;
+
+
+
+
+ bool nodeis_preferred;
+
+
+
+
+ int32 node_id;
+
+
+
+
+
+ NameData node_slave_host;
+ int32 node_slave_port;
+} FormData_pgxc_node;
+
+typedef FormData_pgxc_node *Form_pgxc_node;
@@ -387,6 +387,27 @@ CREATE VIEW pg_timezone_abbrevs AS
 CREATE VIEW pg_timezone_names AS
     SELECT * FROM pg_timezone_names();
 
+CREATE VIEW pg_agtm_xid_status_cache AS
+    SELECT * FROM pg_agtm_xid_status_cache_stats();
+
+CREATE VIEW pg_agtm_stat_messages AS
+    SELECT * FROM pg_agtm_stat_messages();
+
+CREATE VIEW pg_agtm_stat_snapshots AS
+    SELECT * FROM pg_agtm_stat_snapshots();
+
+CREATE VIEW pg_agtm_server_stat_messages AS
+    SELECT * FROM pg_agtm_server_stat_messages();
+
+CREATE VIEW pg_agtm_server_stat_snapshots AS
+    SELECT * FROM pg_agtm_server_stat_snapshots();
+
+CREATE VIEW pg_pool_stats AS
+    SELECT * FROM pg_pool_stats();
+
+CREATE VIEW pg_backend_cache_usage AS
+    SELECT * FROM pg_backend_cache_usage();
+
 -- Statistics views
 
 CREATE VIEW pg_stat_all_tables AS
@@ -403,6 +424,8 @@ CREATE VIEW pg_stat_all_tables AS
             pg_stat_get_tuples_updated(C.oid) AS n_tup_upd,
             pg_stat_get_tuples_deleted(C.oid) AS n_tup_del,
             pg_stat_get_tuples_hot_updated(C.oid) AS n_tup_hot_upd,
+            pg_stat_get_tuples_newpage_updated(C.oid) AS n_tup_newpage_upd,
+            pg_stat_get_pages_pruned(C.oid) AS n_page_prune,
             pg_stat_get_live_tuples(C.oid) AS n_live_tup,
             pg_stat_get_dead_tuples(C.oid) AS n_dead_tup,
             pg_stat_get_last_vacuum_time(C.oid) as last_vacuum,
@@ -432,7 +455,8 @@ CREATE VIEW pg_stat_xact_all_tables AS
             pg_stat_get_xact_tuples_inserted(C.oid) AS n_tup_ins,
             pg_stat_get_xact_tuples_updated(C.oid) AS n_tup_upd,
             pg_stat_get_xact_tuples_deleted(C.oid) AS n_tup_del,
-            pg_stat_get_xact_tuples_hot_updated(C.oid) AS n_tup_hot_upd
+            pg_stat_get_xact_tuples_hot_updated(C.oid) AS n_tup_hot_upd,
+            pg_stat_get_xact_tuples_newpage_updated(C.oid) AS n_tup_newpage_upd
     FROM pg_class C LEFT JOIN
          pg_index I ON C.oid = I.indrelid
          LEFT JOIN pg_namespace N ON (N.oid = C.relnamespace)
@@ -584,8 +608,15 @@ CREATE VIEW pg_stat_activity AS
             S.query_start,
             S.state_change,
             S.waiting,
+            pg_stat_get_wait_event_type(S.pid) AS wait_event_type,
+            pg_stat_get_wait_event(S.pid) AS wait_event,
             S.state,
-            S.query
+            S.query,
+            S.remote_bytes_sent,
+            S.remote_bytes_received,
+            S.remote_messages_sent,
+            S.remote_messages_received,
+            S.remote_round_trips
     FROM pg_database D, pg_stat_get_activity(NULL) AS S, pg_authid U
     WHERE S.datid = D.oid AND
             S.usesysid = U.oid;
@@ -647,6 +678,17 @@ CREATE VIEW pg_stat_database_conflicts AS
             pg_stat_get_db_conflict_startup_deadlock(D.oid) AS confl_deadlock
     FROM pg_database D;
 
+CREATE VIEW pg_stat_database_latency AS
+    SELECT
+            D.oid AS datid,
+            D.datname AS datname,
+            latency_percentile(pg_stat_get_db_latency_histogram(D.oid), 0.5) AS time_p50,
+            latency_percentile(pg_stat_get_db_latency_histogram(D.oid), 0.95) AS time_p95,
+            latency_percentile(pg_stat_get_db_latency_histogram(D.oid), 0.99) AS time_p99,
+            latency_percentile(pg_stat_get_db_latency_histogram(D.oid), 0.999) AS time_p999,
+            pg_stat_get_db_latency_histogram(D.oid) AS time_histogram
+    FROM pg_database D;
+
 CREATE VIEW pg_stat_user_functions AS
     SELECT
             P.oid AS funcid,
@@ -685,6 +727,12 @@ CREATE VIEW pg_stat_bgwriter AS
         pg_stat_get_buf_alloc() AS buffers_alloc,
         pg_stat_get_bgwriter_stat_reset_time() AS stats_reset;
 
+CREATE VIEW pg_stat_wait_events AS
+    SELECT * FROM pg_stat_get_wait_events();
+
+CREATE VIEW pg_stat_remote_connections AS
+    SELECT * FROM pg_stat_get_remote_connections();
+
 CREATE VIEW pg_user_mappings AS
     SELECT
         U.oid       AS umid,
@@ -0,0 +1,38 @@
+# 0 "toasting.h.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "toasting.h.c"
+# 18 "toasting.h.c"
+# 1 "../../../src/include/catalog/buildbki.h" 1
+# 19 "toasting.h.c" 2
+
+
+
+
+
+
+
+extern void AlterTableCreateToastTable(Oid relOid, Datum reloptions);
+extern void BootstrapToastTable(char *relName,
+     Oid toastOid, Oid toastIndexOid);
+# 42 "toasting.h.c"
+DECLARE_TOAST(pg_attrdef, 2830, 2831);
+DECLARE_TOAST(pg_constraint, 2832, 2833);
+DECLARE_TOAST(pg_description, 2834, 2835);
+DECLARE_TOAST(pg_proc, 2836, 2837);
+DECLARE_TOAST(pg_rewrite, 2838, 2839);
+DECLARE_TOAST(pg_seclabel, 3598, 3599);
+DECLARE_TOAST(pg_statistic, 2840, 2841);
+DECLARE_TOAST(pg_trigger, 2336, 2337);
+
+
+DECLARE_TOAST(pg_shdescription, 2846, 2847);
+
+
+DECLARE_TOAST(pg_db_role_setting, 2966, 2967);
+
+
+
+DECLARE_TOAST(adb_ha_sync_log, 5028, 5029);
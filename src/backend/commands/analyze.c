@@ -57,6 +57,7 @@
 
 #ifdef ADB
 #include "catalog/pg_operator.h"
+#include "catalog/pgxc_class.h"
 #include "nodes/makefuncs.h"
 #include "pgxc/execRemote.h"
 #include "pgxc/pgxc.h"
@@ -118,8 +119,26 @@ static Datum std_fetch_func(VacAttrStatsP stats, int rownum, bool *isNull);
 static Datum ind_fetch_func(VacAttrStatsP stats, int rownum, bool *isNull);
 
 #ifdef ADB
+/* Statistics of an attribute got from the data nodes, before they are merged */
+typedef struct RemoteStatsMerge
+{
+	int			numnodes;		/* nodes which sent statistics */
+	double		totalrows;		/* rows of these nodes */
+	double		maxrows;		/* rows of the largest node */
+	double		nullfrac;		/* null rows */
+	double		width;			/* width times rows */
+	double		ndistinct_sum;	/* distinct values of all nodes */
+	double		ndistinct_max;	/* distinct values of the largest node */
+	bool		absolute;		/* some node has an absolute ndistinct */
+	int			maxmcvs;		/* most common values of a node */
+} RemoteStatsMerge;
+
 static void analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 						VacAttrStats **vacattrstats);
+static void merge_remote_mcvs(VacAttrStats *stats, int k, Oid eqopr,
+				  float4 *numbers, Datum *values, int nvalues);
+static void finish_remote_mcvs(VacAttrStats *stats, int k, double totalrows,
+				   int maxmcvs);
 #endif
 
 
@@ -320,10 +339,20 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 	RemoteQueryState *node;
 	TupleTableSlot *result;
 	int 			i;
-	/* Number of data nodes from which attribute statistics are received. */
-	int			   *numnodes;
+	/* Statistics of the attributes being merged */
+	RemoteStatsMerge *merge;
+	RelationLocInfo *locinfo = onerel->rd_locator_info;
+	bool			replicated = IsRelationReplicated(locinfo);
+	AttrNumber		distcol = InvalidAttrNumber;
+	int				maxnodes = 0;
+	double			skew = 1.0;
+	double			ndistinct;
 	AttrNumber		attnum = 1;
 
+	/* Only a single column distribution puts each value on one node */
+	if (IsRelationDistributedByValue(locinfo) && locinfo->partAttrNum > 0)
+		distcol = locinfo->partAttrNum;
+
 	/* Get the relation identifier */
 	relname = RelationGetRelationName(onerel);
 	nspname = get_namespace_name(RelationGetNamespace(onerel));
@@ -334,9 +363,7 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 	initStringInfo(&query);
 	/* Generic statistic fields */
 	appendStringInfoString(&query, "SELECT s.staattnum, "
-// assume the number of tuples approximately the same on all nodes
-// to build more precise statistics get this number
-//										  "c.reltuples, "
+										  "c.reltuples, "
 										  "s.stanullfrac, "
 										  "s.stawidth, "
 										  "s.stadistinct");
@@ -393,10 +420,11 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 														   "pg_statistic",
 														   "staattnum",
 														   attnum++));
-//	step->scan.plan.targetlist = lappend(step->scan.plan.targetlist,
-//										 make_relation_tle(RelationRelationId,
-//														   "pg_class",
-//														   "reltuples"));
+	step->scan.plan.targetlist = lappend(step->scan.plan.targetlist,
+										 make_relation_tle(RelationRelationId,
+														   "pg_class",
+														   "reltuples",
+														   attnum++));
 	step->scan.plan.targetlist = lappend(step->scan.plan.targetlist,
 										 make_relation_tle(StatisticRelationId,
 														   "pg_statistic",
@@ -480,9 +508,7 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 	MemoryContextSwitchTo(oldcontext);
 
 	/* get ready to combine results */
-	numnodes = (int *) palloc(attr_cnt * sizeof(int));
-	for (i = 0; i < attr_cnt; i++)
-		numnodes[i] = 0;
+	merge = (RemoteStatsMerge *) palloc0(attr_cnt * sizeof(RemoteStatsMerge));
 
 	result = ExecRemoteQuery(node);
 	while (result != NULL && !TupIsNull(result))
@@ -491,12 +517,13 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 		bool			isnull;
 		int 			colnum = 1;
 		int16			attnum;
-//		float4			reltuples;
+		double			reltuples;
 		float4			nullfrac;
 		int32 			width;
 		float4			distinct;
+		double			ndistinct;
 		VacAttrStats   *stats = NULL;
-
+		RemoteStatsMerge *m = NULL;
 
 		/* Process statistics from the data node */
 		value = slot_getattr(result, colnum++, &isnull); /* staattnum */
@@ -506,34 +533,60 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 			{
 				stats = vacattrstats[i];
 				stats->stats_valid = true;
-				numnodes[i]++;
+				m = &merge[i];
 				break;
 			}
 
-//		value = slot_getattr(result, colnum++, &isnull); /* reltuples */
-//		reltuples = DatumGetFloat4(value);
+		/*
+		 * Statistics of a node weigh as much as its rows, a node which has
+		 * per chance no row estimate still counts.
+		 */
+		value = slot_getattr(result, colnum++, &isnull); /* reltuples */
+		reltuples = isnull ? 1.0 : Max((double) DatumGetFloat4(value), 1.0);
 
 		if (stats)
 		{
+			m->numnodes++;
+			m->totalrows += reltuples;
+			m->maxrows = Max(m->maxrows, reltuples);
+
 			value = slot_getattr(result, colnum++, &isnull); /* stanullfrac */
 			nullfrac = DatumGetFloat4(value);
-			stats->stanullfrac += nullfrac;
+			m->nullfrac += nullfrac * reltuples;
 
 			value = slot_getattr(result, colnum++, &isnull); /* stawidth */
 			width = DatumGetInt32(value);
-			stats->stawidth += width;
+			m->width += width * reltuples;
 
+			/*
+			 * A negative stadistinct is a fraction of the rows, get the
+			 * number of distinct values of the node.
+			 */
 			value = slot_getattr(result, colnum++, &isnull); /* stadistinct */
 			distinct = DatumGetFloat4(value);
-			stats->stadistinct += distinct;
+			if (distinct < 0)
+				ndistinct = -distinct * reltuples;
+			else
+			{
+				ndistinct = distinct;
+				m->absolute = true;
+			}
+			m->ndistinct_sum += ndistinct;
+			m->ndistinct_max = Max(m->ndistinct_max, ndistinct);
 
 			/* Detailed statistics */
 			for (i = 1; i <= STATISTIC_NUM_SLOTS; i++)
 			{
 				int16 		kind;
-				float4	   *numbers;
-				Datum	   *values;
-				int			nnumbers, nvalues;
+				float4	   *numbers = NULL;
+				Datum	   *values = NULL;
+				int			nnumbers = 0,
+							nvalues = 0;
+				Oid			valtype = InvalidOid;
+				int16		elmlen = -1;
+				bool		elmbyval = true;
+				char		elmalign = 'i';
+				Oid			oprid;
 				int 		k;
 
 				value = slot_getattr(result, colnum++, &isnull); /* kind */
@@ -549,99 +602,48 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 					colnum += 8;
 					continue;
 				}
-				else
-				{
-					Oid			oprid;
-
-					/* Get operator */
-					value = slot_getattr(result, colnum++, &isnull); /* oprname */
-					if (isnull)
-					{
-						/*
-						 * Operator is not specified for that kind, skip remaining
-						 * fields to lookup the operator
-						 */
-						oprid = InvalidOid;
-						colnum += 5; /* skip operation nsp and types */
-					}
-					else
-					{
-						char	   *oprname;
-						char	   *oprnspname;
-						Oid			ltypid, rtypid;
-						char	   *ltypname,
-								   *rtypname;
-						char	   *ltypnspname,
-								   *rtypnspname;
-						oprname = DatumGetCString(value);
-						value = slot_getattr(result, colnum++, &isnull); /* oprnspname */
-						oprnspname = DatumGetCString(value);
-						/* Get left operand data type */
-						value = slot_getattr(result, colnum++, &isnull); /* typname */
-						ltypname = DatumGetCString(value);
-						value = slot_getattr(result, colnum++, &isnull); /* typnspname */
-						ltypnspname = DatumGetCString(value);
-						ltypid = get_typname_typid(ltypname,
-											   get_namespaceid(ltypnspname));
-						/* Get right operand data type */
-						value = slot_getattr(result, colnum++, &isnull); /* typname */
-						rtypname = DatumGetCString(value);
-						value = slot_getattr(result, colnum++, &isnull); /* typnspname */
-						rtypnspname = DatumGetCString(value);
-						rtypid = get_typname_typid(rtypname,
-											   get_namespaceid(rtypnspname));
-						/* lookup operator */
-						oprid = get_operid(oprname, ltypid, rtypid,
-										   get_namespaceid(oprnspname));
-					}
-					/*
-					 * Look up a statistics slot. If there is an entry of the
-					 * same kind already, leave it, assuming the statistics
-					 * is approximately the same on all nodes, so values from
-					 * one node are representing entire relation well.
-					 * If empty slot is found store values here. If no more
-					 * slots skip remaining values.
-					 */
-					for (k = 0; k < STATISTIC_NUM_SLOTS; k++)
-					{
-						if (stats->stakind[k] == 0 ||
-								(stats->stakind[k] == kind && stats->staop[k] == oprid))
-							break;
-					}
-
-					if (k >= STATISTIC_NUM_SLOTS)
-					{
-						/* No empty slots */
-						break;
-					}
-
-					/*
-					 * If it is an existing slot which has numbers or values
-					 * continue to the next set. If slot exists but without
-					 * numbers and values, try to acquire them now
-					 */
-					if (stats->stakind[k] != 0 && (stats->numnumbers[k] > 0 ||
-							stats->numvalues[k] > 0))
-					{
-						colnum += 2; /* skip numbers and values */
-						continue;
-					}
 
+				/* Get operator */
+				value = slot_getattr(result, colnum++, &isnull); /* oprname */
+				if (isnull)
+				{
 					/*
-					 * Initialize slot
+					 * Operator is not specified for that kind, skip remaining
+					 * fields to lookup the operator
 					 */
-					stats->stakind[k] = kind;
-					stats->staop[k] = oprid;
-					stats->numnumbers[k] = 0;
-					stats->stanumbers[k] = NULL;
-					stats->numvalues[k] = 0;
-					stats->stavalues[k] = NULL;
-					stats->statypid[k] = InvalidOid;
-					stats->statyplen[k] = -1;
-					stats->statypalign[k] = 'i';
-					stats->statypbyval[k] = true;
+					oprid = InvalidOid;
+					colnum += 5; /* skip operation nsp and types */
+				}
+				else
+				{
+					char	   *oprname;
+					char	   *oprnspname;
+					Oid			ltypid, rtypid;
+					char	   *ltypname,
+							   *rtypname;
+					char	   *ltypnspname,
+							   *rtypnspname;
+					oprname = DatumGetCString(value);
+					value = slot_getattr(result, colnum++, &isnull); /* oprnspname */
+					oprnspname = DatumGetCString(value);
+					/* Get left operand data type */
+					value = slot_getattr(result, colnum++, &isnull); /* typname */
+					ltypname = DatumGetCString(value);
+					value = slot_getattr(result, colnum++, &isnull); /* typnspname */
+					ltypnspname = DatumGetCString(value);
+					ltypid = get_typname_typid(ltypname,
+										   get_namespaceid(ltypnspname));
+					/* Get right operand data type */
+					value = slot_getattr(result, colnum++, &isnull); /* typname */
+					rtypname = DatumGetCString(value);
+					value = slot_getattr(result, colnum++, &isnull); /* typnspname */
+					rtypnspname = DatumGetCString(value);
+					rtypid = get_typname_typid(rtypname,
+										   get_namespaceid(rtypnspname));
+					/* lookup operator */
+					oprid = get_operid(oprname, ltypid, rtypid,
+									   get_namespaceid(oprnspname));
 				}
-
 
 				/* get numbers */
 				value = slot_getattr(result, colnum++, &isnull); /* numbers */
@@ -668,9 +670,6 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 					 */
 					if ((Pointer) arry != DatumGetPointer(value))
 						pfree(arry);
-
-					stats->numnumbers[k] = nnumbers;
-					stats->stanumbers[k] = numbers;
 				}
 				/* get values */
 				value = slot_getattr(result, colnum++, &isnull); /* values */
@@ -678,16 +677,14 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 				{
 					int 		j;
 					ArrayType  *arry;
-					int16		elmlen;
-					bool		elmbyval;
-					char		elmalign;
 					arry = DatumGetArrayTypeP(value);
+					valtype = ARR_ELEMTYPE(arry);
 					/* We could cache this data, but not clear it's worth it */
-					get_typlenbyvalalign(ARR_ELEMTYPE(arry),
+					get_typlenbyvalalign(valtype,
 										 &elmlen, &elmbyval, &elmalign);
 					/* Deconstruct array into Datum elements; NULLs not expected */
 					deconstruct_array(arry,
-									  ARR_ELEMTYPE(arry),
+									  valtype,
 									  elmlen, elmbyval, elmalign,
 									  &values, NULL, &nvalues);
 
@@ -707,15 +704,72 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 					 */
 					if ((Pointer) arry != DatumGetPointer(value))
 						pfree(arry);
+				}
 
-					stats->numvalues[k] = nvalues;
-					stats->stavalues[k] = values;
-					/* store details about values data type */
-					stats->statypid[k] = ARR_ELEMTYPE(arry);
-					stats->statyplen[k] = elmlen;
-					stats->statypalign[k] = elmalign;
-					stats->statypbyval[k] = elmbyval;
+				/*
+				 * Look up a statistics slot. If there is an entry of the
+				 * same kind already, merge most common values, those of the
+				 * nodes differ as much as the rows they hold. For other kinds
+				 * leave it, assuming the statistics is approximately the same
+				 * on all nodes, so values from one node are representing
+				 * entire relation well.
+				 * If empty slot is found store values here. If no more
+				 * slots skip remaining values.
+				 */
+				for (k = 0; k < STATISTIC_NUM_SLOTS; k++)
+				{
+					if (stats->stakind[k] == 0 ||
+							(stats->stakind[k] == kind && stats->staop[k] == oprid))
+						break;
 				}
+
+				if (k >= STATISTIC_NUM_SLOTS)
+				{
+					/* No empty slots */
+					break;
+				}
+
+				if (kind == STATISTIC_KIND_MCV && OidIsValid(oprid) &&
+					nvalues > 0 && nnumbers == nvalues &&
+					(stats->stakind[k] == 0 || stats->numvalues[k] > 0))
+				{
+					int			j;
+
+					/* Frequencies are turned into rows until all are known */
+					for (j = 0; j < nnumbers; j++)
+						numbers[j] *= reltuples;
+					m->maxmcvs = Max(m->maxmcvs, nvalues);
+					if (stats->stakind[k] != 0)
+					{
+						merge_remote_mcvs(stats, k, oprid, numbers, values, nvalues);
+						continue;
+					}
+				}
+				else if (stats->stakind[k] != 0 && (stats->numnumbers[k] > 0 ||
+						stats->numvalues[k] > 0))
+				{
+					/*
+					 * If it is an existing slot which has numbers or values
+					 * continue to the next set. If slot exists but without
+					 * numbers and values, try to acquire them now
+					 */
+					continue;
+				}
+
+				/*
+				 * Initialize slot
+				 */
+				stats->stakind[k] = kind;
+				stats->staop[k] = oprid;
+				stats->numnumbers[k] = nnumbers;
+				stats->stanumbers[k] = numbers;
+				stats->numvalues[k] = nvalues;
+				stats->stavalues[k] = values;
+				/* store details about values data type */
+				stats->statypid[k] = valtype;
+				stats->statyplen[k] = elmlen;
+				stats->statypalign[k] = elmalign;
+				stats->statypbyval[k] = elmbyval;
 			}
 		}
 
@@ -727,15 +781,143 @@ analyze_rel_coordinator(Relation onerel, bool inh, int attr_cnt,
 	for (i = 0; i < attr_cnt; i++)
 	{
 		VacAttrStats *stats = vacattrstats[i];
+		RemoteStatsMerge *m = &merge[i];
+		int			k;
 
-		if (numnodes[i] > 0)
+		if (m->numnodes == 0)
+			continue;
+
+		stats->stanullfrac = m->nullfrac / m->totalrows;
+		stats->stawidth = (int32) (m->width / m->totalrows + 0.5);
+
+		/*
+		 * Values of a distribution column are found on a single node, the
+		 * numbers of distinct values of the nodes add up. Other values may be
+		 * found on every node, so the largest number is the best guess. When
+		 * no node got a fixed number, the number keeps scaling with the rows.
+		 */
+		if (replicated)
+			ndistinct = m->ndistinct_max;
+		else if (distcol == stats->attr->attnum || !m->absolute)
+			ndistinct = m->ndistinct_sum;
+		else
+			ndistinct = m->ndistinct_max;
+		if (!m->absolute)
 		{
-			stats->stanullfrac /= numnodes[i];
-			stats->stawidth /= numnodes[i];
-			stats->stadistinct /= numnodes[i];
+			double	totalrows = replicated ? m->maxrows : m->totalrows;
+
+			stats->stadistinct = -Min(ndistinct / totalrows, 1.0);
+		}
+		else
+			stats->stadistinct = ndistinct;
+
+		for (k = 0; k < STATISTIC_NUM_SLOTS; k++)
+		{
+			if (stats->stakind[k] == STATISTIC_KIND_MCV &&
+				OidIsValid(stats->staop[k]) && stats->numvalues[k] > 0 &&
+				stats->numnumbers[k] == stats->numvalues[k] && m->maxmcvs > 0)
+				finish_remote_mcvs(stats, k, m->totalrows, m->maxmcvs);
+		}
+
+		if (m->numnodes > maxnodes)
+		{
+			maxnodes = m->numnodes;
+			skew = m->maxrows * m->numnodes / m->totalrows;
 		}
 	}
 	update_attstats(RelationGetRelid(onerel), inh, attr_cnt, vacattrstats);
+
+	/*
+	 * Keep how far the largest node is above the average for the costing of
+	 * the work the nodes do in parallel.
+	 */
+	if (!inh && maxnodes > 0)
+		PgxcClassAlterNodeSkew(RelationGetRelid(onerel),
+							   replicated ? 1.0 : (float4) skew);
+}
+
+/*
+ * merge_remote_mcvs
+ * Merge the most common values of a node, with their number of rows in
+ * "numbers", into the MCV slot "k" of "stats". The values already in the
+ * slot are kept even if the node does not know them as common.
+ */
+static void
+merge_remote_mcvs(VacAttrStats *stats, int k, Oid eqopr,
+				  float4 *numbers, Datum *values, int nvalues)
+{
+	FmgrInfo	eqfunc;
+	int			nold = stats->numvalues[k];
+	float4	   *newnumbers;
+	Datum	   *newvalues;
+	int			nnew = nold;
+	int			i, j;
+
+	fmgr_info(get_opcode(eqopr), &eqfunc);
+
+	newnumbers = (float4 *) palloc((nold + nvalues) * sizeof(float4));
+	newvalues = (Datum *) palloc((nold + nvalues) * sizeof(Datum));
+	memcpy(newnumbers, stats->stanumbers[k], nold * sizeof(float4));
+	memcpy(newvalues, stats->stavalues[k], nold * sizeof(Datum));
+
+	for (i = 0; i < nvalues; i++)
+	{
+		for (j = 0; j < nold; j++)
+		{
+			if (DatumGetBool(FunctionCall2Coll(&eqfunc,
+											   stats->attr->attcollation,
+											   newvalues[j], values[i])))
+				break;
+		}
+		if (j < nold)
+			newnumbers[j] += numbers[i];
+		else
+		{
+			newnumbers[nnew] = numbers[i];
+			newvalues[nnew] = values[i];
+			nnew++;
+		}
+	}
+
+	stats->numnumbers[k] = nnew;
+	stats->stanumbers[k] = newnumbers;
+	stats->numvalues[k] = nnew;
+	stats->stavalues[k] = newvalues;
+}
+
+/*
+ * finish_remote_mcvs
+ * Turn the number of rows of the merged most common values back into
+ * frequencies, keeping the "maxmcvs" most common ones in decreasing
+ * frequency as ANALYZE does.
+ */
+static void
+finish_remote_mcvs(VacAttrStats *stats, int k, double totalrows, int maxmcvs)
+{
+	int			n = stats->numvalues[k];
+	int			i, j;
+
+	/* Few values, a simple insertion sort is fine */
+	for (i = 1; i < n; i++)
+	{
+		float4		number = stats->stanumbers[k][i];
+		Datum		value = stats->stavalues[k][i];
+
+		for (j = i; j > 0 && stats->stanumbers[k][j - 1] < number; j--)
+		{
+			stats->stanumbers[k][j] = stats->stanumbers[k][j - 1];
+			stats->stavalues[k][j] = stats->stavalues[k][j - 1];
+		}
+		stats->stanumbers[k][j] = number;
+		stats->stavalues[k][j] = value;
+	}
+
+	if (n > maxmcvs)
+		n = maxmcvs;
+	for (i = 0; i < n; i++)
+		stats->stanumbers[k][i] /= totalrows;
+	stats->numnumbers[k] = n;
+	stats->numvalues[k] = n;
 }
 #endif
 
@@ -68,6 +68,7 @@
 
 char	   *copy_cmd_comment_str = NULL;
 bool		copy_cmd_comment = false;
+bool		copy_check_all_columns = true;
 
 
 /*
@@ -149,6 +150,10 @@ typedef struct CopyStateData
 	bool		convert_selectively;	/* do selective binary conversion? */
 	List	   *convert_select; /* list of column names (can be NIL) */
 	bool	   *convert_select_flags;	/* per-column CSV/TEXT CS flags */
+	int			error_limit;	/* bad rows COPY FROM may skip, -1 for none */
+	int			rejected;		/* bad rows skipped so far */
+	bool		row_error_safe;	/* can an error of the current row be skipped? */
+	bool	   *unsafe_input_flags;		/* columns whose errors cannot be */
 
 	/* these are just for error messages, see CopyFromErrorCallback */
 	const char *cur_relname;	/* table name for error messages */
@@ -351,6 +356,8 @@ static void CopySendInt32(CopyState cstate, int32 val);
 static bool CopyGetInt32(CopyState cstate, int32 *val);
 static void CopySendInt16(CopyState cstate, int16 val);
 static bool CopyGetInt16(CopyState cstate, int16 *val);
+static bool NextCopyFromSkipErrors(CopyState cstate, ExprContext *econtext,
+					   Datum *values, bool *nulls, Oid *tupleOid);
 
 
 #ifdef PGXC
@@ -971,6 +978,7 @@ ProcessCopyOptions(CopyState cstate,
 		cstate = (CopyStateData *) palloc0(sizeof(CopyStateData));
 
 	cstate->file_encoding = -1;
+	cstate->error_limit = -1;
 
 	/* Extract options from the statement node tree */
 	foreach(option, options)
@@ -1116,6 +1124,19 @@ ProcessCopyOptions(CopyState cstate,
 						 errmsg("argument to option \"%s\" must be a valid encoding name",
 								defel->defname)));
 		}
+		else if (strcmp(defel->defname, "error_limit") == 0)
+		{
+			if (cstate->error_limit >= 0)
+				ereport(ERROR,
+						(errcode(ERRCODE_SYNTAX_ERROR),
+						 errmsg("conflicting or redundant options")));
+			cstate->error_limit = defGetInt32(defel);
+			if (cstate->error_limit < 0)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+						 errmsg("argument to option \"%s\" must be a non-negative integer",
+								defel->defname)));
+		}
 		else
 			ereport(ERROR,
 					(errcode(ERRCODE_SYNTAX_ERROR),
@@ -1137,6 +1158,11 @@ ProcessCopyOptions(CopyState cstate,
 				(errcode(ERRCODE_SYNTAX_ERROR),
 				 errmsg("cannot specify NULL in BINARY mode")));
 
+	if (cstate->error_limit >= 0 && (cstate->binary || !is_from))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("COPY ERROR_LIMIT only available using COPY FROM in text or CSV format")));
+
 	/* Set defaults for omitted options */
 	if (!cstate->delim)
 		cstate->delim = cstate->csv_mode ? "," : "\t";
@@ -1506,6 +1532,32 @@ BeginCopy(bool is_from,
 			cstate->convert_select_flags[attnum - 1] = true;
 		}
 	}
+#ifdef ADB
+	/*
+	 * A Coordinator forwards the text of the rows to the Datanodes, which
+	 * parse them again. Unless asked to check all the columns first, only
+	 * convert the ones the rows are distributed with.
+	 */
+	else if (is_from && !copy_check_all_columns && !cstate->binary &&
+			 IS_PGXC_COORDINATOR && cstate->remoteCopyState &&
+			 cstate->remoteCopyState->rel_loc)
+	{
+		RemoteCopyData *remoteCopyState = cstate->remoteCopyState;
+		RelationLocInfo *rel_loc_info = remoteCopyState->rel_loc;
+
+		cstate->convert_select_flags = (bool *) palloc0(num_phys_attrs * sizeof(bool));
+
+		if (remoteCopyState->idx_dist_by_col >= 0)
+			cstate->convert_select_flags[remoteCopyState->idx_dist_by_col] = true;
+		else if (IsRelationDistributedByUserDefined(rel_loc_info))
+		{
+			ListCell   *cur;
+
+			foreach(cur, rel_loc_info->funcAttrNums)
+				cstate->convert_select_flags[lfirst_int(cur) - 1] = true;
+		}
+	}
+#endif
 
 	/* Use client encoding when ENCODING option is not specified. */
 	if (cstate->file_encoding < 0)
@@ -2280,6 +2332,8 @@ CopyFrom(CopyState cstate)
 		hi_options |= HEAP_INSERT_SKIP_FSM;
 		if (!XLogIsNeeded())
 			hi_options |= HEAP_INSERT_SKIP_WAL;
+		else
+			hi_options |= HEAP_INSERT_LOG_PAGES;
 	}
 
 	/*
@@ -2353,6 +2407,15 @@ CopyFrom(CopyState cstate)
 		bufferedTuples = palloc(copy_batch_rows * sizeof(HeapTuple));
 	}
 
+	/*
+	 * In a new relfilenode that must be WAL-logged, heap_multi_insert can
+	 * log whole pages once they are full rather than each batch of tuples.
+	 * All inserts into the relation must go through it then; AFTER triggers
+	 * could insert into it on their own, so don't do that if there are any.
+	 */
+	if (!useHeapMultiInsert || resultRelInfo->ri_TrigDesc != NULL)
+		hi_options &= ~HEAP_INSERT_LOG_PAGES;
+
 	/* Prepare to catch AFTER triggers. */
 	AfterTriggerBeginQuery();
 
@@ -2437,7 +2500,12 @@ CopyFrom(CopyState cstate)
 		/* Switch into its memory context */
 		MemoryContextSwitchTo(GetPerTupleMemoryContext(estate));
 
-		if (!NextCopyFrom(cstate, econtext, values, nulls, &loaded_oid))
+		if (cstate->error_limit >= 0)
+		{
+			if (!NextCopyFromSkipErrors(cstate, econtext, values, nulls, &loaded_oid))
+				break;
+		}
+		else if (!NextCopyFrom(cstate, econtext, values, nulls, &loaded_oid))
 			break;
 
 #ifdef PGXC
@@ -2657,6 +2725,14 @@ CopyFrom(CopyState cstate)
 	/* Done, clean up */
 	error_context_stack = errcallback.previous;
 
+	if (cstate->rejected > 0)
+		ereport(NOTICE,
+				(errmsg("%d rows with errors were skipped", cstate->rejected)));
+
+	/* Log the last page left unlogged by heap_multi_insert */
+	if (hi_options & HEAP_INSERT_LOG_PAGES)
+		heap_log_bulk_insert(cstate->rel, bistate);
+
 	FreeBulkInsertState(bistate);
 
 	MemoryContextSwitchTo(oldcontext);
@@ -2851,6 +2927,8 @@ BeginCopyFrom(Relation rel,
 	typioparams = (Oid *) palloc(num_phys_attrs * sizeof(Oid));
 	defmap = (int *) palloc(num_phys_attrs * sizeof(int));
 	defexprs = (ExprState **) palloc(num_phys_attrs * sizeof(ExprState *));
+	if (cstate->error_limit >= 0)
+		cstate->unsafe_input_flags = (bool *) palloc0(num_phys_attrs * sizeof(bool));
 
 #ifdef PGXC
 	/* We don't currently allow COPY with non-shippable ROW triggers */
@@ -2886,6 +2964,14 @@ BeginCopyFrom(Relation rel,
 							 &in_func_oid, &typioparams[attnum - 1]);
 		fmgr_info(in_func_oid, &in_functions[attnum - 1]);
 
+		/*
+		 * The checks of a domain may run any function, whose errors cannot
+		 * be skipped without a subtransaction.
+		 */
+		if (cstate->unsafe_input_flags &&
+			get_typtype(attr[attnum - 1]->atttypid) == TYPTYPE_DOMAIN)
+			cstate->unsafe_input_flags[attnum - 1] = true;
+
 		/* Get default info if needed */
 		if (!list_member_int(cstate->attnumlist, attnum))
 		{
@@ -3207,6 +3293,9 @@ NextCopyFrom(CopyState cstate, ExprContext *econtext,
 			int			attnum = lfirst_int(cur);
 			int			m = attnum - 1;
 
+			if (cstate->unsafe_input_flags)
+				cstate->row_error_safe = !cstate->unsafe_input_flags[m];
+
 			if (fieldno >= fldct)
 				ereport(ERROR,
 						(errcode(ERRCODE_BAD_COPY_FILE_FORMAT),
@@ -3368,6 +3457,9 @@ NextCopyFrom(CopyState cstate, ExprContext *econtext,
 		}
 	}
 
+	/* default expressions may have side effects, their errors are not skipped */
+	cstate->row_error_safe = false;
+
 	/*
 	 * Now compute and insert any defaults available for the columns not
 	 * provided by the input data.  Anything not processed here or above will
@@ -3397,6 +3489,57 @@ NextCopyFrom(CopyState cstate, ExprContext *econtext,
 	return true;
 }
 
+/*
+ * NextCopyFrom for COPY FROM with ERROR_LIMIT: a row which cannot be parsed
+ * is reported by a WARNING and skipped, until more than error_limit rows have
+ * been. Only the data errors raised once the line is read and before the
+ * default expressions are evaluated are skipped, such errors leave nothing to
+ * clean up, so no subtransaction is needed for each row.
+ */
+static bool
+NextCopyFromSkipErrors(CopyState cstate, ExprContext *econtext,
+					   Datum *values, bool *nulls, Oid *tupleOid)
+{
+	MemoryContext rowcontext = CurrentMemoryContext;
+
+	for (;;)
+	{
+		bool		found = false;
+		ErrorData  *edata;
+
+		PG_TRY();
+		{
+			found = NextCopyFrom(cstate, econtext, values, nulls, tupleOid);
+		}
+		PG_CATCH();
+		{
+			MemoryContextSwitchTo(rowcontext);
+			edata = CopyErrorData();
+
+			if (!cstate->row_error_safe ||
+				ERRCODE_TO_CATEGORY(edata->sqlerrcode) != ERRCODE_DATA_EXCEPTION ||
+				cstate->rejected >= cstate->error_limit)
+				PG_RE_THROW();
+
+			FlushErrorState();
+			cstate->rejected++;
+
+			/* the error context callback of CopyFrom gives the line */
+			ereport(WARNING,
+					(errcode(edata->sqlerrcode),
+					 errmsg("skipping row: %s", edata->message)));
+			FreeErrorData(edata);
+
+			cstate->cur_attname = NULL;
+			cstate->cur_attval = NULL;
+			continue;
+		}
+		PG_END_TRY();
+
+		return found;
+	}
+}
+
 #ifdef PGXC
 /*
  * append_defvals:
@@ -3506,6 +3649,7 @@ CopyReadLine(CopyState cstate)
 
 	resetStringInfo(&cstate->line_buf);
 	cstate->line_buf_valid = true;
+	cstate->row_error_safe = false;
 
 	/* Mark that encoding conversion hasn't occurred yet */
 	cstate->line_buf_converted = false;
@@ -3562,6 +3706,9 @@ CopyReadLine(CopyState cstate)
 		}
 	}
 
+	/* The whole line is consumed, the next one can be read after an error */
+	cstate->row_error_safe = true;
+
 	/* Done reading the line.  Convert it to server encoding. */
 	if (cstate->need_transcoding)
 	{
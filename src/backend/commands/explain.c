@@ -34,6 +34,9 @@
 #ifdef PGXC
 #include "catalog/pgxc_node.h"
 #endif
+#ifdef ADB
+#include "pgxc/execRemote.h"
+#endif
 
 /* Crude hack to avoid changing sizeof(ExplainState) in released branches */
 #define grouping_stack extra->groupingstack
@@ -69,6 +72,11 @@ static void show_plan_tlist(PlanState *planstate, List *ancestors,
 static void show_expression(Node *node, const char *qlabel,
 				PlanState *planstate, List *ancestors,
 				bool useprefix, ExplainState *es);
+#ifdef ADB
+static void show_tablesample(TableSampleClause *tablesample,
+				 PlanState *planstate, List *ancestors,
+				 ExplainState *es);
+#endif
 static void show_qual(List *qual, const char *qlabel,
 		  PlanState *planstate, List *ancestors,
 		  bool useprefix, ExplainState *es);
@@ -117,6 +125,9 @@ static void ExplainExecNodes(ExecNodes *en, ExplainState *es);
 static void ExplainRemoteQuery(RemoteQuery *plan, PlanState *planstate,
 								List *ancestors, ExplainState *es);
 #endif
+#ifdef ADB
+static void show_remote_node_instr(RemoteQueryState *rqstate, ExplainState *es);
+#endif
 static void ExplainXMLTag(const char *tagname, int flags, ExplainState *es);
 static void ExplainJSONLineEnding(ExplainState *es);
 static void ExplainYAMLLineStarting(ExplainState *es);
@@ -697,6 +708,9 @@ ExplainPreScanNode(PlanState *planstate, Bitmapset **rels_used)
 	switch (nodeTag(plan))
 	{
 		case T_SeqScan:
+#ifdef ADB
+		case T_SampleScan:
+#endif
 		case T_IndexScan:
 		case T_IndexOnlyScan:
 		case T_BitmapHeapScan:
@@ -891,6 +905,11 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_SeqScan:
 			pname = sname = "Seq Scan";
 			break;
+#ifdef ADB
+		case T_SampleScan:
+			pname = sname = "Sample Scan";
+			break;
+#endif
 		case T_IndexScan:
 			pname = sname = "Index Scan";
 			break;
@@ -1035,6 +1054,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 	switch (nodeTag(plan))
 	{
 		case T_SeqScan:
+#ifdef ADB
+		case T_SampleScan:
+#endif
 		case T_BitmapHeapScan:
 		case T_TidScan:
 		case T_SubqueryScan:
@@ -1289,6 +1311,10 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			/* Remote query */
 			ExplainRemoteQuery((RemoteQuery *)plan, planstate, ancestors, es);
 			show_scan_qual(plan->qual, "Coordinator quals", planstate, ancestors, es);
+#ifdef ADB
+			if (es->analyze)
+				show_remote_node_instr((RemoteQueryState *) planstate, es);
+#endif
 			break;
 #endif
 		case T_BitmapHeapScan:
@@ -1308,6 +1334,16 @@ ExplainNode(PlanState *planstate, List *ancestors,
 				show_instrumentation_count("Rows Removed by Filter", 1,
 										   planstate, es);
 			break;
+#ifdef ADB
+		case T_SampleScan:
+			show_tablesample(((SampleScan *) plan)->tablesample,
+							 planstate, ancestors, es);
+			show_scan_qual(plan->qual, "Filter", planstate, ancestors, es);
+			if (plan->qual)
+				show_instrumentation_count("Rows Removed by Filter", 1,
+										   planstate, es);
+			break;
+#endif
 		case T_FunctionScan:
 			if (es->verbose)
 				show_expression(((FunctionScan *) plan)->funcexpr,
@@ -1510,6 +1546,27 @@ ExplainNode(PlanState *planstate, List *ancestors,
 							 INSTR_TIME_GET_MILLISEC(usage->blk_write_time));
 				appendStringInfoChar(es->str, '\n');
 			}
+
+#ifdef ADB
+			/* Traffic with other nodes, again only positive counter values. */
+			if (usage->remote_msgs_sent > 0 || usage->remote_msgs_received > 0)
+			{
+				appendStringInfoSpaces(es->str, es->indent * 2);
+				appendStringInfoString(es->str, "Remote:");
+				if (usage->remote_msgs_sent > 0)
+					appendStringInfo(es->str, " sent=%ld/%ldB",
+									 usage->remote_msgs_sent,
+									 usage->remote_bytes_sent);
+				if (usage->remote_msgs_received > 0)
+					appendStringInfo(es->str, " received=%ld/%ldB",
+									 usage->remote_msgs_received,
+									 usage->remote_bytes_received);
+				if (usage->remote_round_trips > 0)
+					appendStringInfo(es->str, " round_trips=%ld",
+									 usage->remote_round_trips);
+				appendStringInfoChar(es->str, '\n');
+			}
+#endif
 		}
 		else
 		{
@@ -1525,6 +1582,13 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			ExplainPropertyLong("Temp Written Blocks", usage->temp_blks_written, es);
 			ExplainPropertyFloat("I/O Read Time", INSTR_TIME_GET_MILLISEC(usage->blk_read_time), 3, es);
 			ExplainPropertyFloat("I/O Write Time", INSTR_TIME_GET_MILLISEC(usage->blk_write_time), 3, es);
+#ifdef ADB
+			ExplainPropertyLong("Remote Messages Sent", usage->remote_msgs_sent, es);
+			ExplainPropertyLong("Remote Bytes Sent", usage->remote_bytes_sent, es);
+			ExplainPropertyLong("Remote Messages Received", usage->remote_msgs_received, es);
+			ExplainPropertyLong("Remote Bytes Received", usage->remote_bytes_received, es);
+			ExplainPropertyLong("Remote Round Trips", usage->remote_round_trips, es);
+#endif
 		}
 	}
 
@@ -1683,6 +1747,41 @@ show_expression(Node *node, const char *qlabel,
 	ExplainPropertyText(qlabel, exprstr, es);
 }
 
+#ifdef ADB
+/*
+ * Show the sampling method and arguments of a SampleScan node
+ */
+static void
+show_tablesample(TableSampleClause *tablesample,
+				 PlanState *planstate, List *ancestors,
+				 ExplainState *es)
+{
+	List	   *context;
+	bool		useprefix;
+	StringInfoData buf;
+
+	/* Set up deparsing context */
+	context = set_deparse_context_planstate(es->deparse_cxt,
+											(Node *) planstate,
+											ancestors);
+	useprefix = list_length(es->rtable) > 1;
+
+	initStringInfo(&buf);
+	appendStringInfo(&buf, "%s (%s)",
+					 tablesample->method == TABLESAMPLE_SYSTEM ?
+					 "system" : "bernoulli",
+					 deparse_expression(tablesample->percent, context,
+										useprefix, false));
+	if (tablesample->repeatable)
+		appendStringInfo(&buf, " REPEATABLE (%s)",
+						 deparse_expression(tablesample->repeatable, context,
+											useprefix, false));
+
+	ExplainPropertyText("Sampling", buf.data, es);
+	pfree(buf.data);
+}
+#endif /* ADB */
+
 /*
  * Show a qualifier expression (which is a List with implicit AND semantics)
  */
@@ -2027,6 +2126,9 @@ ExplainTargetRel(Plan *plan, Index rti, ExplainState *es)
 	switch (nodeTag(plan))
 	{
 		case T_SeqScan:
+#ifdef ADB
+		case T_SampleScan:
+#endif
 		case T_IndexScan:
 		case T_IndexOnlyScan:
 		case T_BitmapHeapScan:
@@ -2672,6 +2774,115 @@ ExplainRemoteQuery(RemoteQuery *plan, PlanState *planstate, List *ancestors, Exp
 }
 #endif
 
+#ifdef ADB
+/*
+ * If it's EXPLAIN ANALYZE, show what a RemoteQuery received from each node,
+ * and how far the slowest node is from the average one.
+ */
+static void
+show_remote_node_instr(RemoteQueryState *rqstate, ExplainState *es)
+{
+	double		min_rows = 0;
+	double		max_rows = 0;
+	double		sum_rows = 0;
+	double		min_time = 0;
+	double		max_time = 0;
+	double		sum_time = 0;
+	int			i;
+
+	if (rqstate->node_instr == NULL || rqstate->node_instr_count == 0)
+		return;
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+		ExplainOpenGroup("Remote Nodes", "Remote Nodes", false, es);
+
+	for (i = 0; i < rqstate->node_instr_count; i++)
+	{
+		RemoteNodeInstr *instr = &rqstate->node_instr[i];
+		const char *nodename = get_pgxc_nodename(instr->nodeoid);
+		double		startup_ms = 1000.0 * INSTR_TIME_GET_DOUBLE(instr->startup);
+		double		total_ms = 1000.0 * INSTR_TIME_GET_DOUBLE(instr->total);
+		double		wait_ms = 1000.0 * INSTR_TIME_GET_DOUBLE(instr->wait);
+
+		if (i == 0 || instr->rows < min_rows)
+			min_rows = instr->rows;
+		if (i == 0 || instr->rows > max_rows)
+			max_rows = instr->rows;
+		sum_rows += instr->rows;
+		if (i == 0 || total_ms < min_time)
+			min_time = total_ms;
+		if (i == 0 || total_ms > max_time)
+			max_time = total_ms;
+		sum_time += total_ms;
+
+		if (es->format == EXPLAIN_FORMAT_TEXT)
+		{
+			appendStringInfoSpaces(es->str, es->indent * 2);
+			appendStringInfo(es->str, "Node %s: rows=%.0f bytes=" UINT64_FORMAT,
+							 nodename, instr->rows, instr->bytes);
+			if (es->timing)
+				appendStringInfo(es->str,
+								 " time=%.3f..%.3f wait=%.3f",
+								 startup_ms, total_ms, wait_ms);
+			appendStringInfoChar(es->str, '\n');
+		}
+		else
+		{
+			ExplainOpenGroup("Remote Node", NULL, true, es);
+			ExplainPropertyText("Node Name", nodename, es);
+			ExplainPropertyFloat("Rows", instr->rows, 0, es);
+			ExplainPropertyLong("Bytes", (long) instr->bytes, es);
+			if (es->timing)
+			{
+				ExplainPropertyFloat("Startup Time", startup_ms, 3, es);
+				ExplainPropertyFloat("Total Time", total_ms, 3, es);
+				ExplainPropertyFloat("Wait Time", wait_ms, 3, es);
+			}
+			ExplainCloseGroup("Remote Node", NULL, true, es);
+		}
+	}
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+		ExplainCloseGroup("Remote Nodes", "Remote Nodes", false, es);
+
+	/* the skew is the maximum over the average, 1 when evenly spread */
+	if (rqstate->node_instr_count > 1)
+	{
+		double		rows_skew = sum_rows > 0 ?
+			max_rows * rqstate->node_instr_count / sum_rows : 1.0;
+		double		time_skew = sum_time > 0 ?
+			max_time * rqstate->node_instr_count / sum_time : 1.0;
+
+		if (es->format == EXPLAIN_FORMAT_TEXT)
+		{
+			appendStringInfoSpaces(es->str, es->indent * 2);
+			appendStringInfo(es->str,
+							 "Node Rows: min=%.0f max=%.0f skew=%.2f\n",
+							 min_rows, max_rows, rows_skew);
+			if (es->timing)
+			{
+				appendStringInfoSpaces(es->str, es->indent * 2);
+				appendStringInfo(es->str,
+								 "Node Time: min=%.3f max=%.3f skew=%.2f\n",
+								 min_time, max_time, time_skew);
+			}
+		}
+		else
+		{
+			ExplainPropertyFloat("Node Rows Min", min_rows, 0, es);
+			ExplainPropertyFloat("Node Rows Max", max_rows, 0, es);
+			ExplainPropertyFloat("Node Rows Skew", rows_skew, 2, es);
+			if (es->timing)
+			{
+				ExplainPropertyFloat("Node Time Min", min_time, 3, es);
+				ExplainPropertyFloat("Node Time Max", max_time, 3, es);
+				ExplainPropertyFloat("Node Time Skew", time_skew, 2, es);
+			}
+		}
+	}
+}
+#endif
+
 /*
  * Emit opening or closing XML tag.
  *
@@ -16,10 +16,19 @@
 
 #include "access/htup_details.h"
 #include "access/multixact.h"
+#ifdef ADB
+#include "access/sysattr.h"
+#endif
 #include "access/xact.h"
 #include "catalog/catalog.h"
 #include "catalog/indexing.h"
 #include "catalog/namespace.h"
+#ifdef ADB
+#include "catalog/pg_aggregate.h"
+#include "catalog/pg_inherits_fn.h"
+#include "catalog/pg_namespace.h"
+#include "catalog/pg_type.h"
+#endif
 #ifdef PGXC
 #include "catalog/pgxc_node.h"
 #endif /* PGXC */
@@ -28,19 +37,45 @@
 #include "commands/copy.h"
 #include "commands/createas.h"
 #endif /* PGXC */
+#ifdef ADB
+#include "commands/defrem.h"
+#include "commands/trigger.h"
+#endif
 #include "commands/matview.h"
 #include "commands/tablecmds.h"
 #include "executor/executor.h"
+#ifdef ADB
+#include "executor/spi.h"
+#include "executor/tstoreReceiver.h"
+#endif
 #include "miscadmin.h"
+#ifdef ADB
+#include "nodes/makefuncs.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
+#include "parser/parse_func.h"
+#include "parser/parsetree.h"
+#endif
 #ifdef PGXC
 #include "pgxc/pgxc.h"
 #include "pgxc/execRemote.h"
 #include "pgxc/remotecopy.h"
 #include "pgxc/copyops.h"
 #endif /* PGXC */
+#ifdef ADB
+#include "pgxc/locator.h"
+#include "pgxc/pgxcnode.h"
+#endif
 #include "rewrite/rewriteHandler.h"
 #include "storage/smgr.h"
 #include "tcop/tcopprot.h"
+#ifdef ADB
+#include "utils/acl.h"
+#include "utils/builtins.h"
+#include "utils/fmgroids.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#endif
 #include "utils/rel.h"
 #include "utils/snapmgr.h"
 #include "utils/syscache.h"
@@ -60,12 +95,77 @@ typedef struct
 	BulkInsertState bistate;	/* bulk insert state */
 } DR_transientrel;
 
+#ifdef ADB
+/* Column of a delta table telling whether its row was inserted or removed */
+#define MVDELTA_INSERTED_COLUMN		"mvdelta_inserted"
+
+typedef enum MVDeltaKind
+{
+	MVDELTA_GROUP,				/* grouping expression */
+	MVDELTA_COUNT,				/* count(*) or count(expr) */
+	MVDELTA_SUM,				/* sum(expr) */
+	MVDELTA_MINMAX				/* min(expr) or max(expr) */
+} MVDeltaKind;
+
+/* How to merge a column of a materialized view with its delta */
+typedef struct MVDeltaColumn
+{
+	MVDeltaKind	kind;
+	AttrNumber	delattno;		/* aggregate of the removed rows in the delta
+								 * result, 0 for a grouping expression */
+	AttrNumber	countattno;		/* for a sum, count of its input */
+	Oid			collation;		/* input collation of the aggregate */
+	FmgrInfo	addfn;			/* "+" of a sum, sort operator of min/max */
+	FmgrInfo	subfn;			/* "-" of a sum */
+} MVDeltaColumn;
+
+/*
+ * The delta query gives for each group of the delta table the columns of
+ * the materialized view, with the aggregates of the inserted rows, followed
+ * by the aggregates of the removed rows.
+ */
+typedef struct MVDeltaPlan
+{
+	Query	   *query;			/* aggregates of the delta table */
+	int			natts;			/* columns of the materialized view */
+	MVDeltaColumn *columns;
+	AttrNumber	countstar;		/* column of count(*) */
+	int			numGroupCols;
+	AttrNumber *grpColIdx;
+	Oid		   *grpOperators;
+	bool		hasMinMax;
+} MVDeltaPlan;
+
+typedef struct MVDeltaEntryData
+{
+	TupleHashEntryData shared;	/* common header for hash table entries */
+	bool		merged;			/* matched a row of the materialized view */
+} MVDeltaEntryData;
+
+typedef MVDeltaEntryData *MVDeltaEntry;
+#endif
+
 static void transientrel_startup(DestReceiver *self, int operation, TupleDesc typeinfo);
 static void transientrel_receive(TupleTableSlot *slot, DestReceiver *self);
 static void transientrel_shutdown(DestReceiver *self);
 static void transientrel_destroy(DestReceiver *self);
 static void refresh_matview_datafill(DestReceiver *dest, Query *query,
 						 const char *queryString);
+#ifdef ADB
+static RangeTblEntry *matview_base_rte(Relation matviewRel, Query *query,
+				 Index *rtindex);
+static Oid matview_delta_lookup(Relation baseRel, Oid matviewOid,
+					 List **trigNames);
+static Oid matview_delta_relid(Relation matviewRel, Query *query);
+static MVDeltaPlan *matview_delta_plan(Relation matviewRel, Query *query,
+				   Oid deltaOid, const char **reason);
+static bool refresh_matview_incremental(DestReceiver *dest,
+							Relation matviewRel, MVDeltaPlan *plan,
+							const char *queryString);
+static uint32 matview_delta_execute(const char *sql, Snapshot snapshot,
+					  bool read_only, long tcount);
+static char *matview_delta_name(Oid relid);
+#endif
 
 /*
  * SetMatViewPopulatedState
@@ -144,6 +244,10 @@ ExecRefreshMatView(RefreshMatViewStmt *stmt, const char *queryString,
 	Oid			tableSpace;
 	Oid			OIDNewHeap;
 	DestReceiver *dest;
+#ifdef ADB
+	Oid			deltaOid = InvalidOid;
+	MVDeltaPlan *deltaPlan = NULL;
+#endif
 
 	/*
 	 * Get a lock until end of transaction.
@@ -216,6 +320,31 @@ ExecRefreshMatView(RefreshMatViewStmt *stmt, const char *queryString,
 						   save_sec_context | SECURITY_RESTRICTED_OPERATION);
 	save_nestlevel = NewGUCNestLevel();
 
+#ifdef ADB
+	/*
+	 * With a delta table, the changes it holds can be merged into the current
+	 * contents, unless these are not populated or a full refresh is asked
+	 * for; see pgxc_matview_enable_incremental().  The Coordinators to which
+	 * the command is sent are given the result by COPY.
+	 */
+	if (IS_PGXC_COORDINATOR && !IsConnFromCoord())
+	{
+		deltaOid = matview_delta_relid(matviewRel, dataQuery);
+		if (OidIsValid(deltaOid) && !stmt->skipData &&
+			RelationIsPopulated(matviewRel))
+		{
+			char	   *sql;
+
+			sql = psprintf("SELECT 1 FROM %s WHERE %s IS NULL",
+						   matview_delta_name(deltaOid),
+						   MVDELTA_INSERTED_COLUMN);
+			if (matview_delta_execute(sql, GetActiveSnapshot(), true, 1) == 0)
+				deltaPlan = matview_delta_plan(matviewRel, dataQuery, deltaOid,
+											   NULL);
+		}
+	}
+#endif
+
 	/*
 	 * Tentatively mark the matview as populated or not (this will roll back
 	 * if we fail later).
@@ -242,7 +371,25 @@ ExecRefreshMatView(RefreshMatViewStmt *stmt, const char *queryString,
 #endif /* PGXC */
 	/* Generate the data, if wanted. */
 	if (!stmt->skipData)
+#ifdef ADB
+	{
+		if (deltaPlan == NULL ||
+			!refresh_matview_incremental(dest, matviewRel, deltaPlan,
+										 queryString))
+			refresh_matview_datafill(dest, dataQuery, queryString);
+	}
+
+	/*
+	 * Whatever the way the contents were made, they now include the delta
+	 * rows visible to our snapshot.
+	 */
+	if (OidIsValid(deltaOid))
+		matview_delta_execute(psprintf("DELETE FROM %s",
+									   matview_delta_name(deltaOid)),
+							  GetActiveSnapshot(), false, 0);
+#else
 		refresh_matview_datafill(dest, dataQuery, queryString);
+#endif
 
 	heap_close(matviewRel, NoLock);
 
@@ -597,3 +744,1140 @@ pgxc_send_matview_data(RangeVar *matview_rv, const char *query_string)
 	return;
 }
 #endif /* PGXC */
+
+#ifdef ADB
+/*
+ * Incremental refresh
+ *
+ * pgxc_matview_enable_incremental() gives a materialized view aggregating
+ * the rows of one distributed table a delta table on the nodes of that
+ * table, with the columns of the table and MVDELTA_INSERTED_COLUMN, and
+ * triggers on the table adding to the delta table the rows each change
+ * inserts (true) and removes (false).  The capture function is immutable, so
+ * the triggers fire on the Datanodes, where the rows are.  A TRUNCATE cannot
+ * be captured and adds a row with a NULL MVDELTA_INSERTED_COLUMN instead,
+ * which asks the next refresh to be a full one.
+ *
+ * REFRESH aggregates the delta table the way the view aggregates the table,
+ * separately for the inserted and the removed rows, which the planner does
+ * on the Datanodes, and merges the result with the current contents of the
+ * view.  Every refresh, full or not, removes the delta rows its snapshot
+ * sees, so the view holds the result of its query for the snapshot of the
+ * last refresh, and the delta table the changes that snapshot does not see.
+ */
+
+/*
+ * matview_base_rte
+ *		The only relation the query of a materialized view reads from, or
+ *		NULL if there is not one.
+ *
+ * The rule of a materialized view has the OLD and NEW entries of a view in
+ * its range table, which are the materialized view itself.
+ */
+static RangeTblEntry *
+matview_base_rte(Relation matviewRel, Query *query, Index *rtindex)
+{
+	RangeTblRef *rtr;
+	RangeTblEntry *rte;
+	ListCell   *lc;
+
+	if (list_length(query->jointree->fromlist) != 1)
+		return NULL;
+	rtr = (RangeTblRef *) linitial(query->jointree->fromlist);
+	if (!IsA(rtr, RangeTblRef))
+		return NULL;
+	rte = rt_fetch(rtr->rtindex, query->rtable);
+	if (rte->rtekind != RTE_RELATION || rte->relkind != RELKIND_RELATION)
+		return NULL;
+
+	foreach(lc, query->rtable)
+	{
+		RangeTblEntry *other = (RangeTblEntry *) lfirst(lc);
+
+		if (other != rte &&
+			(other->rtekind != RTE_RELATION ||
+			 other->relid != RelationGetRelid(matviewRel)))
+			return NULL;
+	}
+
+	*rtindex = rtr->rtindex;
+	return rte;
+}
+
+/*
+ * matview_delta_lookup
+ *		Find the delta table of a materialized view among the capture
+ *		triggers of its base table, and the names of these triggers.
+ */
+static Oid
+matview_delta_lookup(Relation baseRel, Oid matviewOid, List **trigNames)
+{
+	TriggerDesc *trigdesc = baseRel->trigdesc;
+	Oid			deltaOid = InvalidOid;
+	int			i;
+
+	if (trigdesc == NULL)
+		return InvalidOid;
+
+	for (i = 0; i < trigdesc->numtriggers; i++)
+	{
+		Trigger    *trigger = &trigdesc->triggers[i];
+		RangeVar   *rv;
+
+		if (trigger->tgfoid != F_PGXC_MATVIEW_DELTA_CAPTURE ||
+			trigger->tgnargs != 2)
+			continue;
+
+		rv = makeRangeVarFromNameList(stringToQualifiedNameList(trigger->tgargs[1]));
+		if (RangeVarGetRelid(rv, NoLock, true) != matviewOid)
+			continue;
+
+		rv = makeRangeVarFromNameList(stringToQualifiedNameList(trigger->tgargs[0]));
+		deltaOid = RangeVarGetRelid(rv, NoLock, true);
+		if (trigNames)
+			*trigNames = lappend(*trigNames, pstrdup(trigger->tgname));
+	}
+
+	return deltaOid;
+}
+
+/*
+ * matview_delta_relid
+ *		The delta table of a materialized view, or InvalidOid.
+ */
+static Oid
+matview_delta_relid(Relation matviewRel, Query *query)
+{
+	RangeTblEntry *rte;
+	Relation	baseRel;
+	Index		rtindex;
+	Oid			deltaOid;
+
+	rte = matview_base_rte(matviewRel, query, &rtindex);
+	if (rte == NULL)
+		return InvalidOid;
+
+	baseRel = heap_open(rte->relid, AccessShareLock);
+	deltaOid = matview_delta_lookup(baseRel, RelationGetRelid(matviewRel),
+									NULL);
+	heap_close(baseRel, NoLock);
+
+	return deltaOid;
+}
+
+/*
+ * matview_delta_name
+ *		Qualified name of a delta table, quoted for SQL.
+ */
+static char *
+matview_delta_name(Oid relid)
+{
+	return quote_qualified_identifier(get_namespace_name(get_rel_namespace(relid)),
+									  get_rel_name(relid));
+}
+
+/*
+ * matview_delta_execute
+ *		Run a statement on a delta table, returning the rows it processed.
+ *
+ * The delta rows a refresh sees and the ones it removes are those visible
+ * to the snapshot given here.
+ */
+static uint32
+matview_delta_execute(const char *sql, Snapshot snapshot, bool read_only,
+					  long tcount)
+{
+	SPIPlanPtr	plan;
+	uint32		processed;
+	int			ret;
+
+	if (SPI_connect() != SPI_OK_CONNECT)
+		elog(ERROR, "SPI_connect failed");
+
+	plan = SPI_prepare(sql, 0, NULL);
+	if (plan == NULL)
+		elog(ERROR, "SPI_prepare returned %d for %s", SPI_result, sql);
+
+	ret = SPI_execute_snapshot(plan, NULL, NULL, snapshot, InvalidSnapshot,
+							   read_only, true, tcount);
+	if (ret < 0)
+		elog(ERROR, "SPI_execute_snapshot returned %d for %s", ret, sql);
+	processed = SPI_processed;
+
+	if (SPI_finish() != SPI_OK_FINISH)
+		elog(ERROR, "SPI_finish failed");
+
+	return processed;
+}
+
+/*
+ * matview_delta_aggref
+ *		An aggregate of the view made to aggregate the inserted or the
+ *		removed rows of the delta table only, as in
+ *
+ *			sum(CASE WHEN [NOT] mvdelta_inserted THEN expr END)
+ *
+ * count(*) becoming count(CASE ... THEN true END).
+ */
+static Aggref *
+matview_delta_aggref(Aggref *aggref, Var *inserted, bool removed)
+{
+	Aggref	   *result = (Aggref *) copyObject(aggref);
+	CaseExpr   *caseexpr = makeNode(CaseExpr);
+	CaseWhen   *casewhen = makeNode(CaseWhen);
+	Expr	   *arg;
+
+	if (aggref->aggstar)
+	{
+		Oid			argtype = ANYOID;
+
+		arg = (Expr *) makeBoolConst(true, false);
+		result->aggfnoid = LookupFuncName(list_make2(makeString("pg_catalog"),
+													 makeString("count")),
+										  1, &argtype, false);
+		result->aggstar = false;
+	}
+	else
+		arg = ((TargetEntry *) linitial(aggref->args))->expr;
+
+	casewhen->expr = (Expr *) copyObject(inserted);
+	if (removed)
+		casewhen->expr = makeBoolExpr(NOT_EXPR, list_make1(casewhen->expr), -1);
+	casewhen->result = (Expr *) copyObject(arg);
+	casewhen->location = -1;
+
+	caseexpr->casetype = exprType((Node *) arg);
+	caseexpr->casecollid = exprCollation((Node *) arg);
+	caseexpr->arg = NULL;
+	caseexpr->args = list_make1(casewhen);
+	caseexpr->defresult = (Expr *) makeNullConst(exprType((Node *) arg),
+												 exprTypmod((Node *) arg),
+												 exprCollation((Node *) arg));
+	caseexpr->location = -1;
+
+	result->args = list_make1(makeTargetEntry((Expr *) caseexpr, 1, NULL,
+											  false));
+	return result;
+}
+
+/*
+ * matview_delta_plan
+ *		Check that the query of a materialized view can be refreshed from
+ *		a delta table, and make the plan of doing so.
+ *
+ * The query must compute count(*) and count, sum, min or max aggregates of
+ * one distributed table, grouped by hashable expressions it also returns.
+ * The query is only checked if deltaOid is not valid.  If the query does not
+ * qualify, NULL is returned with the reason in *reason, if given.
+ */
+static MVDeltaPlan *
+matview_delta_plan(Relation matviewRel, Query *query, Oid deltaOid,
+				   const char **reason)
+{
+	MVDeltaPlan *plan;
+	RangeTblEntry *rte;
+	Relation	baseRel = NULL;
+	RelationLocInfo *locinfo;
+	Index		rtindex;
+	List	   *delTargets = NIL;
+	Var		   *inserted = NULL;
+	ListCell   *lc;
+	const char *why = NULL;
+	int			i;
+
+	rte = matview_base_rte(matviewRel, query, &rtindex);
+	if (!query->hasAggs || rte == NULL ||
+		query->hasWindowFuncs || query->hasSubLinks ||
+		query->hasDistinctOn || query->distinctClause ||
+		query->hasRecursive || query->cteList || query->setOperations ||
+		query->havingQual || query->limitOffset || query->limitCount ||
+		query->hasForUpdate || query->rowMarks)
+	{
+		why = gettext_noop("The query must aggregate the rows of one table, without subqueries, DISTINCT, HAVING, LIMIT, set operations or window functions.");
+		goto fail;
+	}
+
+	if (contain_volatile_functions((Node *) query))
+	{
+		why = gettext_noop("The query must not use volatile functions.");
+		goto fail;
+	}
+
+	baseRel = heap_open(rte->relid, AccessShareLock);
+	locinfo = RelationGetLocInfo(baseRel);
+	if (locinfo == NULL || (rte->inh && has_subclass(rte->relid)))
+	{
+		why = gettext_noop("The table must be distributed on Datanodes and have no inheritance children.");
+		goto fail;
+	}
+
+	plan = (MVDeltaPlan *) palloc0(sizeof(MVDeltaPlan));
+	plan->natts = RelationGetNumberOfAttributes(matviewRel);
+	plan->columns = (MVDeltaColumn *) palloc0(sizeof(MVDeltaColumn) * plan->natts);
+	plan->grpColIdx = (AttrNumber *) palloc(sizeof(AttrNumber) * plan->natts);
+	plan->grpOperators = (Oid *) palloc(sizeof(Oid) * plan->natts);
+
+	if (list_length(query->targetList) != plan->natts)
+	{
+		why = gettext_noop("The query must return all of its grouping expressions.");
+		goto fail;
+	}
+
+	/* Grouping expressions and aggregates, the sums are checked next */
+	foreach(lc, query->targetList)
+	{
+		TargetEntry *tle = (TargetEntry *) lfirst(lc);
+		MVDeltaColumn *col = &plan->columns[tle->resno - 1];
+		SortGroupClause *sgc = NULL;
+		ListCell   *lc2;
+
+		if (tle->resjunk)
+		{
+			why = gettext_noop("The query must return all of its grouping expressions.");
+			goto fail;
+		}
+
+		foreach(lc2, query->groupClause)
+		{
+			if (((SortGroupClause *) lfirst(lc2))->tleSortGroupRef ==
+				tle->ressortgroupref && tle->ressortgroupref != 0)
+				sgc = (SortGroupClause *) lfirst(lc2);
+		}
+
+		if (sgc != NULL)
+		{
+			if (!sgc->hashable)
+			{
+				why = gettext_noop("The grouping expressions must be hashable.");
+				goto fail;
+			}
+			col->kind = MVDELTA_GROUP;
+			plan->grpColIdx[plan->numGroupCols] = tle->resno;
+			plan->grpOperators[plan->numGroupCols] = sgc->eqop;
+			plan->numGroupCols++;
+		}
+		else if (IsA(tle->expr, Aggref))
+		{
+			Aggref	   *aggref = (Aggref *) tle->expr;
+			char	   *aggname = get_func_name(aggref->aggfnoid);
+
+			if (aggref->agglevelsup != 0 || aggref->aggdistinct ||
+				aggref->aggorder ||
+				get_func_namespace(aggref->aggfnoid) != PG_CATALOG_NAMESPACE)
+				aggname = "";
+
+			col->collation = aggref->inputcollid;
+			if (strcmp(aggname, "count") == 0)
+			{
+				col->kind = MVDELTA_COUNT;
+				if (aggref->aggstar && plan->countstar == 0)
+					plan->countstar = tle->resno;
+			}
+			else if (strcmp(aggname, "sum") == 0)
+				col->kind = MVDELTA_SUM;
+			else if (strcmp(aggname, "min") == 0 ||
+					 strcmp(aggname, "max") == 0)
+			{
+				HeapTuple	aggtup;
+				Oid			sortop;
+
+				aggtup = SearchSysCache1(AGGFNOID,
+										 ObjectIdGetDatum(aggref->aggfnoid));
+				if (!HeapTupleIsValid(aggtup))
+					elog(ERROR, "cache lookup failed for aggregate %u",
+						 aggref->aggfnoid);
+				sortop = ((Form_pg_aggregate) GETSTRUCT(aggtup))->aggsortop;
+				ReleaseSysCache(aggtup);
+				if (!OidIsValid(sortop))
+					elog(ERROR, "aggregate %u has no sort operator",
+						 aggref->aggfnoid);
+
+				col->kind = MVDELTA_MINMAX;
+				fmgr_info(get_opcode(sortop), &col->addfn);
+				plan->hasMinMax = true;
+			}
+			else
+			{
+				why = gettext_noop("The query must return grouping expressions and count, sum, min or max aggregates without DISTINCT or ORDER BY.");
+				goto fail;
+			}
+		}
+		else
+		{
+			why = gettext_noop("The query must return grouping expressions and count, sum, min or max aggregates without DISTINCT or ORDER BY.");
+			goto fail;
+		}
+	}
+
+	if (plan->countstar == 0)
+	{
+		why = gettext_noop("The query must compute count(*).");
+		goto fail;
+	}
+
+	/*
+	 * A sum is merged with "+" and "-" of its type, and is NULL once the
+	 * count of its input falls to zero.  That count is count(*) for a column
+	 * that cannot be NULL.
+	 */
+	foreach(lc, query->targetList)
+	{
+		TargetEntry *tle = (TargetEntry *) lfirst(lc);
+		MVDeltaColumn *col = &plan->columns[tle->resno - 1];
+		Aggref	   *aggref = (Aggref *) tle->expr;
+		Expr	   *arg;
+		ListCell   *lc2;
+		Oid			addop;
+		Oid			subop;
+
+		if (col->kind != MVDELTA_SUM)
+			continue;
+
+		arg = ((TargetEntry *) linitial(aggref->args))->expr;
+		foreach(lc2, query->targetList)
+		{
+			TargetEntry *other = (TargetEntry *) lfirst(lc2);
+			Aggref	   *count = (Aggref *) other->expr;
+
+			if (plan->columns[other->resno - 1].kind == MVDELTA_COUNT &&
+				!count->aggstar &&
+				equal(((TargetEntry *) linitial(count->args))->expr, arg))
+			{
+				col->countattno = other->resno;
+				break;
+			}
+		}
+		if (col->countattno == 0 && IsA(arg, Var) &&
+			((Var *) arg)->varno == rtindex &&
+			((Var *) arg)->varattno > 0 &&
+			RelationGetDescr(baseRel)->attrs[((Var *) arg)->varattno - 1]->attnotnull)
+			col->countattno = plan->countstar;
+		if (col->countattno == 0)
+		{
+			why = gettext_noop("A sum of an expression that can be NULL needs the count of the same expression.");
+			goto fail;
+		}
+
+		addop = OpernameGetOprid(list_make1(makeString("+")),
+								 aggref->aggtype, aggref->aggtype);
+		subop = OpernameGetOprid(list_make1(makeString("-")),
+								 aggref->aggtype, aggref->aggtype);
+		if (!OidIsValid(addop) || !OidIsValid(subop) ||
+			get_func_rettype(get_opcode(addop)) != aggref->aggtype ||
+			get_func_rettype(get_opcode(subop)) != aggref->aggtype)
+		{
+			why = gettext_noop("The type of a sum must have \"+\" and \"-\" operators.");
+			goto fail;
+		}
+		fmgr_info(get_opcode(addop), &col->addfn);
+		fmgr_info(get_opcode(subop), &col->subfn);
+	}
+
+	heap_close(baseRel, NoLock);
+	if (!OidIsValid(deltaOid))
+		return plan;
+
+	/*
+	 * The delta query is the query of the view reading the delta table, with
+	 * each aggregate made to the one of the inserted rows, and the one of the
+	 * removed rows appended.  The delta table has the columns of the table in
+	 * the same places, so the expressions of the query need no change.
+	 */
+	plan->query = (Query *) copyObject(query);
+	plan->query->sortClause = NIL;
+	rte = rt_fetch(rtindex, plan->query->rtable);
+	{
+		Relation	deltaRel = heap_open(deltaOid, AccessShareLock);
+		TupleDesc	deltaDesc = RelationGetDescr(deltaRel);
+		AttrNumber	attno;
+
+		rte->relid = deltaOid;
+		rte->relkind = RELKIND_RELATION;
+		rte->inh = false;
+		rte->eref = makeAlias(RelationGetRelationName(deltaRel), NIL);
+		for (attno = 0; attno < deltaDesc->natts; attno++)
+		{
+			Form_pg_attribute attr = deltaDesc->attrs[attno];
+
+			rte->eref->colnames = lappend(rte->eref->colnames,
+										  makeString(pstrdup(attr->attisdropped ? "" : NameStr(attr->attname))));
+		}
+
+		attno = get_attnum(deltaOid, MVDELTA_INSERTED_COLUMN);
+		if (attno != deltaDesc->natts ||
+			deltaDesc->attrs[attno - 1]->atttypid != BOOLOID)
+			elog(ERROR, "\"%s\" is not the delta table of materialized view \"%s\"",
+				 RelationGetRelationName(deltaRel),
+				 RelationGetRelationName(matviewRel));
+		rte->selectedCols = bms_add_member(rte->selectedCols,
+									 attno - FirstLowInvalidHeapAttributeNumber);
+		inserted = makeVar(rtindex, attno, BOOLOID, -1, InvalidOid, 0);
+		heap_close(deltaRel, NoLock);
+	}
+
+	i = plan->natts;
+	foreach(lc, plan->query->targetList)
+	{
+		TargetEntry *tle = (TargetEntry *) lfirst(lc);
+		MVDeltaColumn *col = &plan->columns[tle->resno - 1];
+		Aggref	   *aggref = (Aggref *) tle->expr;
+
+		if (col->kind == MVDELTA_GROUP)
+			continue;
+
+		tle->expr = (Expr *) matview_delta_aggref(aggref, inserted, false);
+		col->delattno = ++i;
+		delTargets = lappend(delTargets,
+							 makeTargetEntry((Expr *) matview_delta_aggref(aggref, inserted, true),
+											 col->delattno, NULL, false));
+	}
+	plan->query->targetList = list_concat(plan->query->targetList, delTargets);
+
+	return plan;
+
+fail:
+	if (baseRel)
+		heap_close(baseRel, NoLock);
+	if (reason)
+		*reason = why;
+	return NULL;
+}
+
+/*
+ * matview_delta_merge
+ *		Compute a row of the materialized view from its current row, if
+ *		any, and its row of the delta query.  Returns false if the group
+ *		has no rows left.
+ */
+static bool
+matview_delta_merge(MVDeltaPlan *plan, TupleTableSlot *oldslot,
+					TupleTableSlot *deltaslot, TupleTableSlot *outslot)
+{
+	Datum	   *values = outslot->tts_values;
+	bool	   *isnull = outslot->tts_isnull;
+	int			i;
+
+	ExecClearTuple(outslot);
+	if (oldslot)
+		slot_getallattrs(oldslot);
+	slot_getallattrs(deltaslot);
+
+	/* Counts first, a sum needs the count of its input */
+	for (i = 0; i < plan->natts; i++)
+	{
+		MVDeltaColumn *col = &plan->columns[i];
+		int64		count = 0;
+
+		switch (col->kind)
+		{
+			case MVDELTA_GROUP:
+				values[i] = oldslot ? oldslot->tts_values[i] :
+					deltaslot->tts_values[i];
+				isnull[i] = oldslot ? oldslot->tts_isnull[i] :
+					deltaslot->tts_isnull[i];
+				break;
+
+			case MVDELTA_COUNT:
+				if (oldslot && !oldslot->tts_isnull[i])
+					count = DatumGetInt64(oldslot->tts_values[i]);
+				count += DatumGetInt64(deltaslot->tts_values[i]);
+				count -= DatumGetInt64(deltaslot->tts_values[col->delattno - 1]);
+				values[i] = Int64GetDatum(count);
+				isnull[i] = false;
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	/* Without grouping, the query returns a row even for no rows */
+	if (plan->numGroupCols > 0 &&
+		DatumGetInt64(values[plan->countstar - 1]) <= 0)
+		return false;
+
+	for (i = 0; i < plan->natts; i++)
+	{
+		MVDeltaColumn *col = &plan->columns[i];
+		Datum		ins = deltaslot->tts_values[i];
+		bool		insnull = deltaslot->tts_isnull[i];
+
+		if (col->kind != MVDELTA_SUM && col->kind != MVDELTA_MINMAX)
+			continue;
+
+		if (oldslot)
+		{
+			values[i] = oldslot->tts_values[i];
+			isnull[i] = oldslot->tts_isnull[i];
+		}
+		else
+			isnull[i] = true;
+
+		if (col->kind == MVDELTA_SUM)
+		{
+			if (DatumGetInt64(values[col->countattno - 1]) <= 0)
+			{
+				isnull[i] = true;
+				continue;
+			}
+			if (!insnull)
+			{
+				values[i] = isnull[i] ? ins :
+					FunctionCall2Coll(&col->addfn, col->collation,
+									  values[i], ins);
+				isnull[i] = false;
+			}
+			if (!deltaslot->tts_isnull[col->delattno - 1])
+			{
+				if (isnull[i])
+					elog(ERROR, "delta of a materialized view removes rows it does not have");
+				values[i] = FunctionCall2Coll(&col->subfn, col->collation,
+											  values[i],
+											  deltaslot->tts_values[col->delattno - 1]);
+			}
+		}
+		else if (!insnull &&
+				 (isnull[i] ||
+				  DatumGetBool(FunctionCall2Coll(&col->addfn, col->collation,
+												 ins, values[i]))))
+		{
+			/* Removed rows were ruled out by the caller */
+			values[i] = ins;
+			isnull[i] = false;
+		}
+	}
+
+	ExecStoreVirtualTuple(outslot);
+	return true;
+}
+
+/*
+ * refresh_matview_incremental
+ *		Fill the new heap of a materialized view from its current contents
+ *		and the result of its delta query.
+ *
+ * A min or a max cannot forget a removed value without looking at the other
+ * rows of the group, so if the delta removes any, nothing is done and false
+ * is returned, the caller doing a full refresh.
+ */
+static bool
+refresh_matview_incremental(DestReceiver *dest, Relation matviewRel,
+							MVDeltaPlan *plan, const char *queryString)
+{
+	TupleDesc	mvdesc = RelationGetDescr(matviewRel);
+	Tuplestorestate *deltastore;
+	DestReceiver *tdest;
+	TupleTableSlot *deltaslot;
+	TupleTableSlot *mvslot;
+	TupleTableSlot *outslot;
+	TupleHashTable hashtable;
+	TupleHashIterator iter;
+	MVDeltaEntry entry;
+	FmgrInfo   *eqfunctions;
+	FmgrInfo   *hashfunctions;
+	MemoryContext tablecxt;
+	MemoryContext rowcxt;
+	MemoryContext oldcxt;
+	HeapScanDesc scan;
+	HeapTuple	tuple;
+	bool		removesMinMax = false;
+
+	/* Aggregate the delta table */
+	deltastore = tuplestore_begin_heap(false, false, work_mem);
+	tdest = CreateDestReceiver(DestTuplestore);
+	SetTuplestoreDestReceiverParams(tdest, deltastore, CurrentMemoryContext,
+									false);
+	refresh_matview_datafill(tdest, plan->query, queryString);
+	(*tdest->rDestroy) (tdest);
+
+	tablecxt = AllocSetContextCreate(CurrentMemoryContext,
+									 "Matview delta",
+									 ALLOCSET_DEFAULT_MINSIZE,
+									 ALLOCSET_DEFAULT_INITSIZE,
+									 ALLOCSET_DEFAULT_MAXSIZE);
+	rowcxt = AllocSetContextCreate(CurrentMemoryContext,
+								   "Matview delta row",
+								   ALLOCSET_DEFAULT_MINSIZE,
+								   ALLOCSET_DEFAULT_INITSIZE,
+								   ALLOCSET_DEFAULT_MAXSIZE);
+
+	/* Hash the groups of the delta, the view has them in the same columns */
+	execTuplesHashPrepare(plan->numGroupCols, plan->grpOperators,
+						  &eqfunctions, &hashfunctions);
+	hashtable = BuildTupleHashTable(plan->numGroupCols, plan->grpColIdx,
+									eqfunctions, hashfunctions, 1024,
+									sizeof(MVDeltaEntryData),
+									tablecxt, rowcxt);
+	deltaslot = MakeSingleTupleTableSlot(ExecTypeFromTL(plan->query->targetList,
+														  false));
+	while (tuplestore_gettupleslot(deltastore, true, false, deltaslot))
+	{
+		bool		isnew;
+		int			i;
+
+		for (i = 0; i < plan->natts && plan->hasMinMax; i++)
+		{
+			if (plan->columns[i].kind == MVDELTA_MINMAX &&
+				!slot_attisnull(deltaslot, plan->columns[i].delattno))
+				removesMinMax = true;
+		}
+		if (removesMinMax)
+			break;
+
+		entry = (MVDeltaEntry) LookupTupleHashEntry(hashtable, deltaslot,
+													&isnew);
+		if (!isnew)
+			elog(ERROR, "delta of a materialized view has a group twice");
+		entry->merged = false;
+		MemoryContextReset(rowcxt);
+	}
+	tuplestore_end(deltastore);
+
+	if (removesMinMax)
+	{
+		ExecDropSingleTupleTableSlot(deltaslot);
+		MemoryContextDelete(rowcxt);
+		MemoryContextDelete(tablecxt);
+		return false;
+	}
+
+	(*dest->rStartup) (dest, CMD_SELECT, mvdesc);
+	mvslot = MakeSingleTupleTableSlot(mvdesc);
+	outslot = MakeSingleTupleTableSlot(mvdesc);
+
+	/* Merge the groups the view has */
+	scan = heap_beginscan(matviewRel, GetActiveSnapshot(), 0, NULL);
+	while ((tuple = heap_getnext(scan, ForwardScanDirection)) != NULL)
+	{
+		CHECK_FOR_INTERRUPTS();
+
+		ExecStoreTuple(tuple, mvslot, InvalidBuffer, false);
+		entry = (MVDeltaEntry) FindTupleHashEntry(hashtable, mvslot,
+												  eqfunctions, hashfunctions);
+		oldcxt = MemoryContextSwitchTo(rowcxt);
+		if (entry == NULL)
+			(*dest->receiveSlot) (mvslot, dest);
+		else
+		{
+			entry->merged = true;
+			ExecStoreMinimalTuple(entry->shared.firstTuple, deltaslot, false);
+			if (matview_delta_merge(plan, mvslot, deltaslot, outslot))
+				(*dest->receiveSlot) (outslot, dest);
+		}
+		MemoryContextSwitchTo(oldcxt);
+		MemoryContextReset(rowcxt);
+	}
+	heap_endscan(scan);
+
+	/* And add the new ones */
+	InitTupleHashIterator(hashtable, &iter);
+	while ((entry = (MVDeltaEntry) ScanTupleHashTable(&iter)) != NULL)
+	{
+		if (entry->merged)
+			continue;
+
+		oldcxt = MemoryContextSwitchTo(rowcxt);
+		ExecStoreMinimalTuple(entry->shared.firstTuple, deltaslot, false);
+		if (matview_delta_merge(plan, NULL, deltaslot, outslot))
+			(*dest->receiveSlot) (outslot, dest);
+		MemoryContextSwitchTo(oldcxt);
+		MemoryContextReset(rowcxt);
+	}
+	TermTupleHashIterator(&iter);
+
+	(*dest->rShutdown) (dest);
+
+	ExecDropSingleTupleTableSlot(outslot);
+	ExecDropSingleTupleTableSlot(mvslot);
+	ExecDropSingleTupleTableSlot(deltaslot);
+	MemoryContextDelete(rowcxt);
+	MemoryContextDelete(tablecxt);
+
+	return true;
+}
+
+/*
+ * matview_open_for_delta
+ *		Open a materialized view whose delta table is set up or dropped by
+ *		the current user, and find its base table.
+ */
+static Relation
+matview_open_for_delta(Oid matviewOid, Query **query, RangeTblEntry **rte)
+{
+	Relation	matviewRel;
+	Index		rtindex;
+
+	if (!IS_PGXC_COORDINATOR || IsConnFromCoord())
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("incremental refresh can only be set up from a Coordinator")));
+
+	matviewRel = heap_open(matviewOid, AccessExclusiveLock);
+	if (matviewRel->rd_rel->relkind != RELKIND_MATVIEW)
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("\"%s\" is not a materialized view",
+						RelationGetRelationName(matviewRel))));
+	if (!pg_class_ownercheck(matviewOid, GetUserId()))
+		aclcheck_error(ACLCHECK_NOT_OWNER, ACL_KIND_CLASS,
+					   RelationGetRelationName(matviewRel));
+	if (matviewRel->rd_rules == NULL || matviewRel->rd_rules->numLocks != 1)
+		elog(ERROR,
+			 "materialized view \"%s\" is missing rewrite information",
+			 RelationGetRelationName(matviewRel));
+
+	*query = (Query *) linitial(matviewRel->rd_rules->rules[0]->actions);
+	*rte = matview_base_rte(matviewRel, *query, &rtindex);
+
+	return matviewRel;
+}
+
+/*
+ * pgxc_matview_enable_incremental
+ *		Give a materialized view a delta table so that REFRESH merges the
+ *		changes of its base table instead of running its query again.
+ *
+ * The delta table makes the next refresh a full one, as the contents of the
+ * view are not known to match the table yet.
+ */
+Datum
+pgxc_matview_enable_incremental(PG_FUNCTION_ARGS)
+{
+	Oid			matviewOid = PG_GETARG_OID(0);
+	Relation	matviewRel;
+	Relation	baseRel;
+	Query	   *query;
+	RangeTblEntry *rte;
+	RelationLocInfo *locinfo;
+	TupleDesc	tupdesc;
+	const char *reason = NULL;
+	char	   *nspname;
+	char	   *deltaname;
+	char	   *delta;
+	char	   *matview;
+	char	   *base;
+	StringInfoData buf;
+	ListCell   *lc;
+	int			i;
+
+	matviewRel = matview_open_for_delta(matviewOid, &query, &rte);
+	if (rte == NULL ||
+		matview_delta_plan(matviewRel, query, InvalidOid, &reason) == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialized view \"%s\" cannot be refreshed incrementally",
+						RelationGetRelationName(matviewRel)),
+				 reason ? errdetail("%s", _(reason)) : 0));
+
+	/* Keep the table from changing until the triggers are there */
+	baseRel = heap_open(rte->relid, ShareRowExclusiveLock);
+	if (OidIsValid(matview_delta_lookup(baseRel, matviewOid, NULL)))
+		ereport(ERROR,
+				(errcode(ERRCODE_DUPLICATE_OBJECT),
+				 errmsg("materialized view \"%s\" is already refreshed incrementally",
+						RelationGetRelationName(matviewRel))));
+
+	nspname = get_namespace_name(RelationGetNamespace(matviewRel));
+	deltaname = ChooseRelationName(RelationGetRelationName(matviewRel), NULL,
+								   "delta", RelationGetNamespace(matviewRel));
+	delta = quote_qualified_identifier(nspname, deltaname);
+	matview = quote_qualified_identifier(nspname,
+										 RelationGetRelationName(matviewRel));
+	base = quote_qualified_identifier(get_namespace_name(RelationGetNamespace(baseRel)),
+									  RelationGetRelationName(baseRel));
+
+	/*
+	 * The delta table has the columns of the table in the same places, and is
+	 * on the same nodes.  A row is captured on the node of the changed row
+	 * and cannot be moved, so the delta table is spread by round robin,
+	 * which leaves its placement to no column.
+	 */
+	initStringInfo(&buf);
+	appendStringInfo(&buf, "CREATE TABLE %s (", delta);
+	tupdesc = RelationGetDescr(baseRel);
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute attr = tupdesc->attrs[i];
+
+		if (attr->attisdropped)
+			appendStringInfo(&buf, "mvdelta_dropped_%d boolean, ", i + 1);
+		else
+			appendStringInfo(&buf, "%s %s, ",
+							 quote_identifier(NameStr(attr->attname)),
+							 format_type_with_typemod(attr->atttypid,
+													  attr->atttypmod));
+	}
+	locinfo = RelationGetLocInfo(baseRel);
+	appendStringInfo(&buf, "%s boolean) DISTRIBUTE BY %s TO NODE (",
+					 MVDELTA_INSERTED_COLUMN,
+					 IsRelationReplicated(locinfo) ? "REPLICATION" : "ROUNDROBIN");
+	foreach(lc, locinfo->nodeList)
+	{
+		Oid			nodeoid = PGXCNodeGetNodeOid(lfirst_int(lc),
+												 PGXC_NODE_DATANODE);
+
+		appendStringInfo(&buf, "%s%s", lc == list_head(locinfo->nodeList) ? "" : ", ",
+						 quote_identifier(get_pgxc_nodename(nodeoid)));
+	}
+	appendStringInfoChar(&buf, ')');
+	matview_delta_execute(buf.data, InvalidSnapshot, false, 0);
+
+	matview_delta_execute(psprintf("CREATE TRIGGER %s AFTER INSERT OR UPDATE OR DELETE ON %s "
+								   "FOR EACH ROW EXECUTE PROCEDURE pg_catalog.pgxc_matview_delta_capture(%s, %s)",
+								   quote_identifier(deltaname), base,
+								   quote_literal_cstr(delta),
+								   quote_literal_cstr(matview)),
+						  InvalidSnapshot, false, 0);
+	matview_delta_execute(psprintf("CREATE TRIGGER %s AFTER TRUNCATE ON %s "
+								   "FOR EACH STATEMENT EXECUTE PROCEDURE pg_catalog.pgxc_matview_delta_capture(%s, %s)",
+								   quote_identifier(makeObjectName(deltaname, NULL, "truncate")),
+								   base,
+								   quote_literal_cstr(delta),
+								   quote_literal_cstr(matview)),
+						  InvalidSnapshot, false, 0);
+	matview_delta_execute(psprintf("INSERT INTO %s (%s) VALUES (NULL)",
+								   delta, MVDELTA_INSERTED_COLUMN),
+						  InvalidSnapshot, false, 0);
+
+	heap_close(baseRel, NoLock);
+	heap_close(matviewRel, NoLock);
+
+	PG_RETURN_VOID();
+}
+
+/*
+ * pgxc_matview_disable_incremental
+ *		Drop the delta table of a materialized view and its triggers.
+ */
+Datum
+pgxc_matview_disable_incremental(PG_FUNCTION_ARGS)
+{
+	Oid			matviewOid = PG_GETARG_OID(0);
+	Relation	matviewRel;
+	Relation	baseRel = NULL;
+	Query	   *query;
+	RangeTblEntry *rte;
+	List	   *trigNames = NIL;
+	Oid			deltaOid = InvalidOid;
+	char	   *base;
+	ListCell   *lc;
+
+	matviewRel = matview_open_for_delta(matviewOid, &query, &rte);
+	if (rte != NULL)
+	{
+		baseRel = heap_open(rte->relid, ShareRowExclusiveLock);
+		deltaOid = matview_delta_lookup(baseRel, matviewOid, &trigNames);
+	}
+	if (trigNames == NIL)
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_OBJECT),
+				 errmsg("materialized view \"%s\" is not refreshed incrementally",
+						RelationGetRelationName(matviewRel))));
+
+	base = quote_qualified_identifier(get_namespace_name(RelationGetNamespace(baseRel)),
+									  RelationGetRelationName(baseRel));
+	foreach(lc, trigNames)
+		matview_delta_execute(psprintf("DROP TRIGGER %s ON %s",
+									   quote_identifier((char *) lfirst(lc)),
+									   base),
+							  InvalidSnapshot, false, 0);
+	if (OidIsValid(deltaOid))
+		matview_delta_execute(psprintf("DROP TABLE %s",
+									   matview_delta_name(deltaOid)),
+							  InvalidSnapshot, false, 0);
+
+	heap_close(baseRel, NoLock);
+	heap_close(matviewRel, NoLock);
+
+	PG_RETURN_VOID();
+}
+
+/*
+ * matview_delta_capture_row
+ *		Add a row inserted into or removed from a table to the delta table.
+ *
+ * On a Coordinator, which fires the triggers instead of the Datanodes when
+ * some trigger of the table cannot be shipped, the row is sent to the
+ * delta table by INSERT.
+ */
+typedef struct MVDeltaCapture
+{
+	Oid			deltaOid;
+	char	   *insert;			/* INSERT into the delta table, made on a
+								 * Coordinator by the first row */
+	Oid		   *argtypes;
+} MVDeltaCapture;
+
+static void
+matview_delta_capture_row(MVDeltaCapture *capture, Relation deltaRel,
+						  Relation rel, HeapTuple tuple, bool inserted)
+{
+	TupleDesc	deltaDesc = RelationGetDescr(deltaRel);
+	TupleDesc	tupdesc = RelationGetDescr(rel);
+	int			natts = deltaDesc->natts - 1;
+	Datum	   *tupvalues = (Datum *) palloc(tupdesc->natts * sizeof(Datum));
+	bool	   *tupnulls = (bool *) palloc(tupdesc->natts * sizeof(bool));
+	Datum	   *values = (Datum *) palloc(deltaDesc->natts * sizeof(Datum));
+	bool	   *nulls = (bool *) palloc(deltaDesc->natts * sizeof(bool));
+	int			i;
+
+	/* Columns added to the table after the delta table are of no use */
+	if (tupdesc->natts < natts)
+		elog(ERROR, "delta table \"%s\" has more columns than \"%s\"",
+			 RelationGetRelationName(deltaRel), RelationGetRelationName(rel));
+
+	heap_deform_tuple(tuple, tupdesc, tupvalues, tupnulls);
+	for (i = 0; i < natts; i++)
+	{
+		if (tupdesc->attrs[i]->attisdropped)
+		{
+			values[i] = (Datum) 0;
+			nulls[i] = true;
+			continue;
+		}
+		if (deltaDesc->attrs[i]->atttypid != tupdesc->attrs[i]->atttypid)
+			elog(ERROR, "column %d of delta table \"%s\" does not match \"%s\"",
+				 i + 1, RelationGetRelationName(deltaRel),
+				 RelationGetRelationName(rel));
+		values[i] = tupvalues[i];
+		nulls[i] = tupnulls[i];
+	}
+	values[natts] = BoolGetDatum(inserted);
+	nulls[natts] = false;
+
+	if (IS_PGXC_COORDINATOR)
+	{
+		char	   *spinulls = (char *) palloc(deltaDesc->natts);
+		int			ret;
+
+		for (i = 0; i < deltaDesc->natts; i++)
+			spinulls[i] = nulls[i] ? 'n' : ' ';
+
+		if (capture->insert == NULL)
+		{
+			MemoryContext oldcxt = MemoryContextSwitchTo(GetMemoryChunkContext(capture));
+			StringInfoData buf;
+
+			capture->argtypes = (Oid *) palloc(deltaDesc->natts * sizeof(Oid));
+			initStringInfo(&buf);
+			appendStringInfo(&buf, "INSERT INTO %s VALUES (",
+							 matview_delta_name(capture->deltaOid));
+			for (i = 0; i < deltaDesc->natts; i++)
+			{
+				capture->argtypes[i] = deltaDesc->attrs[i]->atttypid;
+				appendStringInfo(&buf, "%s$%d", i > 0 ? ", " : "", i + 1);
+			}
+			appendStringInfoChar(&buf, ')');
+			capture->insert = buf.data;
+			MemoryContextSwitchTo(oldcxt);
+		}
+
+		if (SPI_connect() != SPI_OK_CONNECT)
+			elog(ERROR, "SPI_connect failed");
+		ret = SPI_execute_with_args(capture->insert, deltaDesc->natts,
+									capture->argtypes, values, spinulls,
+									false, 0);
+		if (ret != SPI_OK_INSERT)
+			elog(ERROR, "SPI_execute_with_args returned %d for %s", ret,
+				 capture->insert);
+		if (SPI_finish() != SPI_OK_FINISH)
+			elog(ERROR, "SPI_finish failed");
+	}
+	else
+	{
+		HeapTuple	deltatup = heap_form_tuple(deltaDesc, values, nulls);
+
+		heap_insert(deltaRel, deltatup, GetCurrentCommandId(true), 0, NULL);
+		heap_freetuple(deltatup);
+	}
+
+	pfree(tupvalues);
+	pfree(tupnulls);
+	pfree(values);
+	pfree(nulls);
+}
+
+/*
+ * pgxc_matview_delta_capture
+ *		Trigger adding the changes of a table to the delta table of a
+ *		materialized view, given with the view as arguments.
+ */
+Datum
+pgxc_matview_delta_capture(PG_FUNCTION_ARGS)
+{
+	TriggerData *trigdata = (TriggerData *) fcinfo->context;
+	Trigger    *trigger;
+	MVDeltaCapture *capture;
+	Relation	deltaRel;
+
+	if (!CALLED_AS_TRIGGER(fcinfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+				 errmsg("function \"%s\" was not called by trigger manager",
+						"pgxc_matview_delta_capture")));
+	trigger = trigdata->tg_trigger;
+	if (trigger->tgnargs != 2)
+		ereport(ERROR,
+				(errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+				 errmsg("function \"%s\" needs the delta table and the materialized view as arguments",
+						"pgxc_matview_delta_capture")));
+
+	/*
+	 * Statement triggers fire on the Coordinator that received the statement
+	 * only, the others having it from that one.
+	 */
+	if (TRIGGER_FIRED_BY_TRUNCATE(trigdata->tg_event))
+	{
+		if (!IsConnFromCoord())
+			matview_delta_execute(psprintf("INSERT INTO %s (%s) VALUES (NULL)",
+										   trigger->tgargs[0],
+										   MVDELTA_INSERTED_COLUMN),
+								  InvalidSnapshot, false, 0);
+		return PointerGetDatum(NULL);
+	}
+
+	if (!TRIGGER_FIRED_FOR_ROW(trigdata->tg_event) ||
+		!TRIGGER_FIRED_AFTER(trigdata->tg_event))
+		ereport(ERROR,
+				(errcode(ERRCODE_E_R_I_E_TRIGGER_PROTOCOL_VIOLATED),
+				 errmsg("function \"%s\" must be fired AFTER ROW",
+						"pgxc_matview_delta_capture")));
+
+	capture = (MVDeltaCapture *) fcinfo->flinfo->fn_extra;
+	if (capture == NULL)
+	{
+		RangeVar   *rv;
+
+		capture = (MVDeltaCapture *) MemoryContextAllocZero(fcinfo->flinfo->fn_mcxt,
+															sizeof(MVDeltaCapture));
+		rv = makeRangeVarFromNameList(stringToQualifiedNameList(trigger->tgargs[0]));
+		capture->deltaOid = RangeVarGetRelid(rv, RowExclusiveLock, false);
+		fcinfo->flinfo->fn_extra = capture;
+	}
+
+	deltaRel = heap_open(capture->deltaOid, RowExclusiveLock);
+	if (deltaRel->rd_rel->relhasindex)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("delta table \"%s\" cannot have indexes",
+						RelationGetRelationName(deltaRel))));
+
+	if (TRIGGER_FIRED_BY_INSERT(trigdata->tg_event))
+		matview_delta_capture_row(capture, deltaRel, trigdata->tg_relation,
+								  trigdata->tg_trigtuple, true);
+	else if (TRIGGER_FIRED_BY_UPDATE(trigdata->tg_event))
+	{
+		matview_delta_capture_row(capture, deltaRel, trigdata->tg_relation,
+								  trigdata->tg_trigtuple, false);
+		matview_delta_capture_row(capture, deltaRel, trigdata->tg_relation,
+								  trigdata->tg_newtuple, true);
+	}
+	else
+		matview_delta_capture_row(capture, deltaRel, trigdata->tg_relation,
+								  trigdata->tg_trigtuple, false);
+
+	heap_close(deltaRel, NoLock);
+
+	return PointerGetDatum(NULL);
+}
+#endif /* ADB */
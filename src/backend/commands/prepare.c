@@ -1005,6 +1005,27 @@ HaveActiveDatanodeStatements(void)
 	return false;
 }
 
+#ifdef ADB
+/*
+ * Forget on which nodes the Datanode statements are active, when the
+ * connections they were prepared on are dropped.  They are prepared again
+ * on the next connections they run on.
+ */
+void
+DeactivateDatanodeStatements(void)
+{
+	HASH_SEQ_STATUS seq;
+	DatanodeStatement *entry;
+
+	if (!datanode_queries)
+		return;
+
+	hash_seq_init(&seq, datanode_queries);
+	while ((entry = hash_seq_search(&seq)) != NULL)
+		entry->number_of_nodes = 0;
+}
+#endif
+
 
 /*
  * Mark Datanode statement as active on specified node
@@ -98,7 +98,7 @@ static SeqTable seqtab = NULL;	/* Head of list of SeqTable items */
 static SeqTableData *last_used_seq = NULL;
 
 static void fill_seq_with_data(Relation rel, HeapTuple tuple);
-static int64 nextval_internal(Oid relid);
+static int64 nextval_internal(Oid relid, int64 range, int64 *range_last);
 static Relation open_share_lock(SeqTable seq);
 static void init_sequence(Oid relid, SeqTable *p_elm, Relation *p_rel);
 static Form_pg_sequence read_seq_tuple(SeqTable elm, Relation rel,
@@ -697,18 +697,46 @@ nextval(PG_FUNCTION_ARGS)
 	 */
 	relid = RangeVarGetRelid(sequence, NoLock, false);
 
-	PG_RETURN_INT64(nextval_internal(relid));
+	PG_RETURN_INT64(nextval_internal(relid, 0, NULL));
 }
 
 Datum
 nextval_oid(PG_FUNCTION_ARGS)
 {
 	Oid			relid = PG_GETARG_OID(0);
-	PG_RETURN_INT64(nextval_internal(relid));
+	PG_RETURN_INT64(nextval_internal(relid, 0, NULL));
 }
 
+#ifdef AGTM
+/*
+ * Fetch "range" consecutive values of a sequence at once, regardless of its
+ * CACHE setting.  Returns the first one, "*last" receives the last one,
+ * which is less than "range" values away when MAXVALUE/MINVALUE is reached.
+ * A cycled sequence never wraps in the middle of a range.  If "increment"
+ * is not NULL it receives the step between the values.
+ */
+int64
+nextval_range_oid(Oid relid, int64 range, int64 *last, int64 *increment)
+{
+	int64		result;
+
+	AssertArg(range > 0 && last != NULL);
+
+	result = nextval_internal(relid, range, last);
+	if (increment)
+		*increment = last_used_seq->increment;
+
+	return result;
+}
+#endif /* AGTM */
+
+/*
+ * "range" greater than zero fetches that many values instead of the CACHE
+ * number, bypasses the backend-local cache and returns the last fetched
+ * value in *range_last.
+ */
 static int64
-nextval_internal(Oid relid)
+nextval_internal(Oid relid, int64 range, int64 *range_last)
 {
 	SeqTable	elm;
 	Relation	seqrel;
@@ -746,7 +774,7 @@ nextval_internal(Oid relid)
 	if (!seqrel->rd_islocaltemp)
 		PreventCommandIfReadOnly("nextval()");
 
-	if (elm->last != elm->cached)		/* some numbers were cached */
+	if (range <= 0 && elm->last != elm->cached)	/* some numbers were cached */
 	{
 		Assert(elm->last_valid);
 		Assert(elm->increment != 0);
@@ -801,7 +829,15 @@ nextval_internal(Oid relid)
 		databaseName = get_database_name(seqrel->rd_node.dbNode);
 		schemaName = get_namespace_name(RelationGetNamespace(seqrel));
 
-		result = agtm_GetSeqNextVal(seqName, databaseName, schemaName);
+		/*
+		 * Get the whole CACHE block in one round-trip, AGTM tells us where
+		 * the block really ends.
+		 */
+		if (seq->cache_value > 1)
+			result = agtm_GetSeqNextRange(seqName, databaseName, schemaName,
+										  seq->cache_value, &last);
+		else
+			last = result = agtm_GetSeqNextVal(seqName, databaseName, schemaName);
 
 		pfree(databaseName);
 		pfree(schemaName);
@@ -812,16 +848,7 @@ nextval_internal(Oid relid)
 
 		/* save info in local cache */
 		elm->last = result;			/* last returned number */
-
-		elm->cached = result + seq->cache_value * incby - incby;
-		if (incby > 0 && elm->cached > maxv)
-		{
-			elm->cached = maxv - ((maxv - result) % incby);
-		}
-		else if (incby < 0 && elm->cached < minv)
-		{
-			elm->cached = minv - ((minv - result) % incby);
-		}
+		elm->cached = last;			/* last fetched number */
 		elm->last_valid = true;
 
 		last_used_seq = elm;
@@ -841,7 +868,7 @@ nextval_internal(Oid relid)
 	}
 #endif
 
-	fetch = cache = seq->cache_value;
+	fetch = cache = (range > 0 ? range : seq->cache_value);
 	log = seq->log_cnt;
 
 	if (!seq->is_called)
@@ -1053,6 +1080,9 @@ nextval_internal(Oid relid)
 
 	relation_close(seqrel, NoLock);
 
+	if (range_last)
+		*range_last = last;
+
 	return result;
 }
 
@@ -10478,6 +10478,7 @@ AtExecDistributeBy(Relation rel, DistributeBy *options)
 	Oid funcid = InvalidOid;
 	int numatts = 0;
 	int16 *attnums = NULL;
+	List *distvalues = NIL;
 #endif
 
 #ifdef ADB
@@ -10525,6 +10526,14 @@ AtExecDistributeBy(Relation rel, DistributeBy *options)
 	 * It is not checked if the distribution type list is the same as the old one,
 	 * user might define a different sub-cluster at the same time.
 	 */
+#ifdef ADB
+	/* Their number is checked against the final nodes by BuildRedistribCommands */
+	if (IsLocatorDistributedByRangeOrList(locatortype))
+		distvalues = GetRelationDistributionValues(options,
+												   RelationGetDescr(rel),
+												   attnum,
+												   -1);
+#endif
 
 	/* Update pgxc_class entry */
 	PgxcClassAlter(relid,
@@ -10539,6 +10548,7 @@ AtExecDistributeBy(Relation rel, DistributeBy *options)
 				   , funcid
 				   , numatts
 				   , attnums
+				   , distvalues
 #endif
 				   );
 
@@ -10581,6 +10591,7 @@ AtExecSubCluster(Relation rel, PGXCSubCluster *options)
 				   , 0
 				   , 0
 				   , NULL
+				   , NIL
 #endif
 				   );
 
@@ -10633,6 +10644,7 @@ AtExecAddNode(Relation rel, List *options)
 				   , 0
 				   , 0
 				   , NULL
+				   , NIL
 #endif
 				   );
 
@@ -10682,6 +10694,7 @@ AtExecDeleteNode(Relation rel, List *options)
 				   , 0
 				   , 0
 				   , NULL
+				   , NIL
 #endif
 				   );
 
@@ -10741,6 +10754,9 @@ BuildRedistribCommands(Oid relid, List *subCmds)
 	int			numatts = 0;
 	int			idx = 0;
 	int16	   *attnums = NULL;
+	Oid		   *prev_oid_array;
+	int			prev_num;
+	char		prev_locatortype;
 #endif
 
 	/* Get necessary information about relation */
@@ -10763,6 +10779,11 @@ BuildRedistribCommands(Oid relid, List *subCmds)
 	foreach(item, subCmds)
 	{
 		AlterTableCmd *cmd = (AlterTableCmd *) lfirst(item);
+#ifdef ADB
+		prev_oid_array = new_oid_array;
+		prev_num = new_num;
+		prev_locatortype = newLocInfo->locatorType;
+#endif
 		switch (cmd->subtype)
 		{
 			case AT_DistributeBy:
@@ -10793,6 +10814,37 @@ BuildRedistribCommands(Oid relid, List *subCmds)
 				for (idx = 0; idx < numatts; idx++)
 					newLocInfo->funcAttrNums = lappend_int(newLocInfo->funcAttrNums,
 															attnums[idx]);
+
+				/* Bucket map as PgxcClassAlter will set it */
+				if (newLocInfo->locatorType == LOCATOR_TYPE_BUCKET)
+				{
+					newLocInfo->bucketMap = BuildBucketMap(LOCATOR_BUCKET_COUNT,
+						(prev_locatortype == LOCATOR_TYPE_BUCKET &&
+						 newLocInfo->numBuckets == LOCATOR_BUCKET_COUNT) ?
+						 newLocInfo->bucketMap : NULL,
+						new_oid_array, new_num,
+						new_oid_array, new_num, true);
+					newLocInfo->numBuckets = LOCATOR_BUCKET_COUNT;
+				} else
+				{
+					newLocInfo->bucketMap = NULL;
+					newLocInfo->numBuckets = 0;
+				}
+
+				/* Bounds or values as AtExecDistributeBy will store them */
+				newLocInfo->numDistValues = 0;
+				newLocInfo->distValues = NULL;
+				newLocInfo->distValuePositions = NULL;
+				if (IsRelationDistributedByRangeOrList(newLocInfo))
+				{
+					Form_pg_attribute attr = RelationGetDescr(rel)->attrs[newLocInfo->partAttrNum - 1];
+
+					SetLocatorDistValues(newLocInfo, attr->atttypid, attr->attcollation,
+										 GetRelationDistributionValues((DistributeBy *) cmd->def,
+																	   RelationGetDescr(rel),
+																	   newLocInfo->partAttrNum,
+																	   -1));
+				}
 #endif
 				break;
 			case AT_SubCluster:
@@ -10820,8 +10872,31 @@ BuildRedistribCommands(Oid relid, List *subCmds)
 			default:
 				Assert(0); /* Should not happen */
 		}
+
+#ifdef ADB
+		/* Buckets are rebalanced on each change of the node list */
+		if (cmd->subtype != AT_DistributeBy &&
+			newLocInfo->locatorType == LOCATOR_TYPE_BUCKET)
+			newLocInfo->bucketMap = BuildBucketMap(newLocInfo->numBuckets,
+												   newLocInfo->bucketMap,
+												   prev_oid_array, prev_num,
+												   new_oid_array, new_num,
+												   !online_bucket_redistribution);
+#endif
 	}
 
+#ifdef ADB
+	/* Each node of a range or list distribution needs bounds or values */
+	if (IsRelationDistributedByRangeOrList(newLocInfo) &&
+		GetLocatorDistValuesNodes(newLocInfo) != new_num)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_TABLE_DEFINITION),
+				 errmsg("distribution of relation \"%s\" is given for %d nodes but the relation is on %d nodes",
+						RelationGetRelationName(rel),
+						GetLocatorDistValuesNodes(newLocInfo), new_num),
+				 errhint("Give the bounds or values of each node with DISTRIBUTE BY in the same ALTER TABLE.")));
+#endif
+
 	/* Build relation node list for new locator info */
 	for (i = 0; i < new_num; i++)
 		newLocInfo->nodeList = lappend_int(newLocInfo->nodeList,
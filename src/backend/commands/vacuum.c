@@ -55,7 +55,6 @@
 #include "pgxc/pgxc.h"
 #endif
 #ifdef ADB
-#include "access/visibilitymap.h"
 #include "executor/executor.h"
 #include "nodes/makefuncs.h"
 #include "pgxc/execRemote.h"
@@ -1559,7 +1558,8 @@ make_relation_tle(Oid reloid, const char *relname, const char *column, AttrNumbe
  */
 static int
 get_remote_relstat(char *nspname, char *relname, bool replicated,
-				   int32 *pages, float4 *tuples, TransactionId *frozenXid)
+				   int32 *pages, int32 *allvisible, float4 *tuples,
+				   TransactionId *frozenXid)
 {
 	StringInfoData query;
 	EState 	   *estate;
@@ -1576,7 +1576,8 @@ get_remote_relstat(char *nspname, char *relname, bool replicated,
 	initStringInfo(&query);
 	appendStringInfo(&query, "SELECT c.relpages, "
 									"c.reltuples, "
-									"c.relfrozenxid "
+									"c.relfrozenxid, "
+									"c.relallvisible "
 							 "FROM pg_class c JOIN pg_namespace n "
 							 "ON c.relnamespace = n.oid "
 							 "WHERE n.nspname = '%s' "
@@ -1608,6 +1609,11 @@ get_remote_relstat(char *nspname, char *relname, bool replicated,
 														   "pg_class",
 														   "relfrozenxid",
 														   attnum++));
+	step->scan.plan.targetlist = lappend(step->scan.plan.targetlist,
+										 make_relation_tle(RelationRelationId,
+														   "pg_class",
+														   "relallvisible",
+														   attnum++));
 
 	/* Execute query on the data nodes */
 	estate = CreateExecutorState();
@@ -1620,6 +1626,7 @@ get_remote_relstat(char *nspname, char *relname, bool replicated,
 	MemoryContextSwitchTo(oldcontext);
 	/* get ready to combine results */
 	*pages = 0;
+	*allvisible = 0;
 	*tuples = 0.0;
 	*frozenXid = InvalidTransactionId;
 	validpages = 0;
@@ -1661,6 +1668,9 @@ get_remote_relstat(char *nspname, char *relname, bool replicated,
 				}
 			}
 		}
+		value = slot_getattr(result, 4, &isnull); /* relallvisible */
+		if (!isnull)
+			*allvisible += DatumGetInt32(value);
 		/* fetch next */
 		result = ExecRemoteQuery(node);
 	}
@@ -1674,7 +1684,10 @@ get_remote_relstat(char *nspname, char *relname, bool replicated,
 		 * Average is good enough approximation in this case.
 		 */
 		if (validpages > 0)
+		{
 			*pages /= validpages;
+			*allvisible /= validpages;
+		}
 
 		if (validtuples > 0)
 			*tuples /= validtuples;
@@ -1711,6 +1724,7 @@ vacuum_rel_coordinator(Relation onerel, bool is_outer)
 	char	   *relname;
 	/* fields to combine relation statistics */
 	int32		num_pages;
+	int32		num_allvisible;
 	float4		num_tuples;
 	TransactionId min_frozenxid;
 	bool		hasindex;
@@ -1729,7 +1743,8 @@ vacuum_rel_coordinator(Relation onerel, bool is_outer)
 	 * returning correct stats.
 	 */
 	rel_nodes = get_remote_relstat(nspname, relname, replicated,
-								   &num_pages, &num_tuples, &min_frozenxid);
+								   &num_pages, &num_allvisible, &num_tuples,
+								   &min_frozenxid);
 	if (rel_nodes > 0)
 	{
 		int 		nindexes;
@@ -1747,6 +1762,7 @@ vacuum_rel_coordinator(Relation onerel, bool is_outer)
 			for (i = 0; i < nindexes; i++)
 			{
 				int32	idx_pages;
+				int32	idx_allvisible;
 				float4	idx_tuples;
 				TransactionId idx_frozenxid;
 				int idx_nodes;
@@ -1756,7 +1772,8 @@ vacuum_rel_coordinator(Relation onerel, bool is_outer)
 				nspname = get_namespace_name(RelationGetNamespace(Irel[i]));
 				/* Index is replicated if parent relation is replicated */
 				idx_nodes = get_remote_relstat(nspname, relname, replicated,
-										&idx_pages, &idx_tuples, &idx_frozenxid);
+										&idx_pages, &idx_allvisible,
+										&idx_tuples, &idx_frozenxid);
 				if (idx_nodes > 0)
 				{
 					/*
@@ -1797,7 +1814,7 @@ vacuum_rel_coordinator(Relation onerel, bool is_outer)
 		vac_update_relstats(onerel,
 							(BlockNumber) num_pages,
 							(double) num_tuples,
-							visibilitymap_count(onerel),
+							(BlockNumber) num_allvisible,
 							hasindex,
 							min_frozenxid,
 							InvalidMultiXactId,
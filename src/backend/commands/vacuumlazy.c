@@ -11,12 +11,18 @@
  * on the number of tuples and pages we will keep track of at once.
  *
  * We are willing to use at most maintenance_work_mem memory space to keep
- * track of dead tuples.  We initially allocate an array of TIDs of that size,
- * with an upper limit that depends on table size (this limit ensures we don't
- * allocate a huge area uselessly for vacuuming small tables).  If the array
- * threatens to overflow, we suspend the heap scan phase and perform a pass of
- * index cleanup and page compaction, then resume the heap scan with an empty
- * TID array.
+ * track of dead tuples, with an upper limit that depends on table size (this
+ * limit ensures we don't allocate a huge area uselessly for vacuuming small
+ * tables).  The TIDs are stored grouped by heap page, which takes about a
+ * third of the space of an array of TIDs, and in segments, so that more than
+ * MaxAllocSize of them can be kept at once.  If the space threatens to
+ * overflow, we suspend the heap scan phase and perform a pass of index
+ * cleanup and page compaction, then resume the heap scan with no dead tuples
+ * remembered.
+ *
+ * If at the end only a few pages have dead line pointers left over by
+ * pruning, we don't scan the indexes at all; the line pointers stay dead
+ * until a later VACUUM, which will find more of them worth scanning for.
  *
  * If we're processing a table with no indexes, we can just vacuum each page
  * as we go; there's no need to save up multiple tuples to minimize the number
@@ -95,6 +101,35 @@
  */
 #define SKIP_PAGES_THRESHOLD	((BlockNumber) 32)
 
+/*
+ * Index vacuuming is bypassed if fewer than this fraction of the table's
+ * pages have dead line pointers, as long as there are no more than
+ * BYPASS_MAX_DEAD_TUPLES of them.
+ */
+#define BYPASS_THRESHOLD_PAGES	0.02	/* i.e. 2% of rel_pages */
+#define BYPASS_MAX_DEAD_TUPLES	((32 * 1024 * 1024) / sizeof(ItemPointerData))
+
+/*
+ * The offset numbers of the dead tuples are stored in segments of this many,
+ * each of them a separate allocation.
+ */
+#define DEAD_SEGMENT_SHIFT		20
+#define DEAD_SEGMENT_SIZE		(1 << DEAD_SEGMENT_SHIFT)
+#define DEAD_SEGMENT_MASK		(DEAD_SEGMENT_SIZE - 1)
+
+#define LVDeadOffset(vacrelstats, i) \
+	((vacrelstats)->dead_offsets[(i) >> DEAD_SEGMENT_SHIFT][(i) & DEAD_SEGMENT_MASK])
+
+/*
+ * A heap page with dead tuples.  Its offset numbers are those from first up
+ * to the first of the next page (or num_dead_tuples for the last page).
+ */
+typedef struct LVDeadPage
+{
+	BlockNumber blkno;
+	int			first;			/* index of its first entry in dead_offsets */
+} LVDeadPage;
+
 typedef struct LVRelStats
 {
 	/* hasindex = true means two-pass strategy; false means one-pass */
@@ -103,17 +138,23 @@ typedef struct LVRelStats
 	BlockNumber old_rel_pages;	/* previous value of pg_class.relpages */
 	BlockNumber rel_pages;		/* total number of pages */
 	BlockNumber scanned_pages;	/* number of pages we examined */
+	BlockNumber frozenskipped_pages;	/* # of frozen pages we skipped */
 	double		scanned_tuples; /* counts only tuples on scanned pages */
 	double		old_rel_tuples; /* previous value of pg_class.reltuples */
 	double		new_rel_tuples; /* new estimated total # of tuples */
 	BlockNumber pages_removed;
 	double		tuples_deleted;
 	BlockNumber nonempty_pages; /* actually, last nonempty page + 1 */
-	/* List of TIDs of tuples we intend to delete */
+	/* List of TIDs of tuples we intend to delete, grouped by page */
 	/* NB: this list is ordered by TID address */
-	int			num_dead_tuples;	/* current # of entries */
-	int			max_dead_tuples;	/* # slots allocated in array */
-	ItemPointer dead_tuples;	/* array of ItemPointerData */
+	int			num_dead_tuples;	/* current # of offsets */
+	int			max_dead_tuples;	/* # of offsets we may store */
+	OffsetNumber **dead_offsets;	/* segments of offset numbers */
+	int			num_dead_segments;	/* # of segments allocated */
+	int			num_dead_pages; /* current # of pages */
+	int			max_dead_pages; /* # slots allocated in dead_pages */
+	LVDeadPage *dead_pages;		/* array of pages, in block order */
+	long		dead_space;		/* bytes we may use for all of the above */
 	int			num_index_scans;
 	TransactionId latestRemovedXid;
 	bool		lock_waiter_detected;
@@ -142,17 +183,19 @@ static void lazy_cleanup_index(Relation indrel,
 				   IndexBulkDeleteResult *stats,
 				   LVRelStats *vacrelstats);
 static int lazy_vacuum_page(Relation onerel, BlockNumber blkno, Buffer buffer,
-				 int tupindex, LVRelStats *vacrelstats, Buffer *vmbuffer);
+				 int pageindex, LVRelStats *vacrelstats, Buffer *vmbuffer);
 static void lazy_truncate_heap(Relation onerel, LVRelStats *vacrelstats);
 static BlockNumber count_nondeletable_pages(Relation onerel,
 						 LVRelStats *vacrelstats);
 static void lazy_space_alloc(LVRelStats *vacrelstats, BlockNumber relblocks);
+static bool lazy_space_nearly_full(LVRelStats *vacrelstats);
+static void lazy_forget_dead_tuples(LVRelStats *vacrelstats);
 static void lazy_record_dead_tuple(LVRelStats *vacrelstats,
 					   ItemPointer itemptr);
 static bool lazy_tid_reaped(ItemPointer itemptr, void *state);
-static int	vac_cmp_itemptr(const void *left, const void *right);
 static bool heap_page_is_all_visible(Buffer buf,
-						 TransactionId *visibility_cutoff_xid);
+						 TransactionId *visibility_cutoff_xid,
+						 bool *all_frozen);
 
 
 /*
@@ -239,13 +282,14 @@ lazy_vacuum_rel(Relation onerel, VacuumStmt *vacstmt,
 	vac_close_indexes(nindexes, Irel, NoLock);
 
 	/*
-	 * Compute whether we actually scanned the whole relation. If we did, we
-	 * can adjust relfrozenxid and relminmxid.
+	 * Compute whether we actually scanned all the unfrozen pages. If we did,
+	 * we can adjust relfrozenxid and relminmxid.
 	 *
 	 * NB: We need to check this before truncating the relation, because that
 	 * will change ->rel_pages.
 	 */
-	if (vacrelstats->scanned_pages < vacrelstats->rel_pages)
+	if ((vacrelstats->scanned_pages + vacrelstats->frozenskipped_pages)
+		< vacrelstats->rel_pages)
 	{
 		Assert(!scan_all);
 		scanned_all = false;
@@ -282,8 +326,9 @@ lazy_vacuum_rel(Relation onerel, VacuumStmt *vacstmt,
 	 * is all-visible we'd definitely like to know that.  But clamp the value
 	 * to be not more than what we're setting relpages to.
 	 *
-	 * Also, don't change relfrozenxid/relminmxid if we skipped any pages,
-	 * since then we don't know for certain that all tuples have a newer xmin.
+	 * Also, don't change relfrozenxid/relminmxid if we skipped any pages
+	 * that weren't all-frozen, since then we don't know for certain that all
+	 * tuples have a newer xmin.
 	 */
 	new_rel_pages = vacrelstats->rel_pages;
 	new_rel_tuples = vacrelstats->new_rel_tuples;
@@ -420,13 +465,18 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 	double		num_tuples,
 				tups_vacuumed,
 				nkeep,
-				nunused;
+				nunused,
+				ntupgone;
+	bool		bypass_indexes = false;
 	IndexBulkDeleteResult **indstats;
 	int			i;
 	PGRUsage	ru0;
 	Buffer		vmbuffer = InvalidBuffer;
-	BlockNumber next_not_all_visible_block;
-	bool		skipping_all_visible_blocks;
+	BlockNumber next_unskippable_block;
+	bool		skipping_blocks;
+#ifdef USE_PREFETCH
+	BlockNumber prefetch_blkno = 0;
+#endif
 	xl_heap_freeze_tuple *frozen;
 
 	pg_rusage_init(&ru0);
@@ -438,7 +488,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 					relname)));
 
 	empty_pages = vacuumed_pages = 0;
-	num_tuples = tups_vacuumed = nkeep = nunused = 0;
+	num_tuples = tups_vacuumed = nkeep = nunused = ntupgone = 0;
 
 	indstats = (IndexBulkDeleteResult **)
 		palloc0(nindexes * sizeof(IndexBulkDeleteResult *));
@@ -446,6 +496,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 	nblocks = RelationGetNumberOfBlocks(onerel);
 	vacrelstats->rel_pages = nblocks;
 	vacrelstats->scanned_pages = 0;
+	vacrelstats->frozenskipped_pages = 0;
 	vacrelstats->nonempty_pages = 0;
 	vacrelstats->latestRemovedXid = InvalidTransactionId;
 
@@ -458,43 +509,62 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 	 * consecutive pages.  Since we're reading sequentially, the OS should be
 	 * doing readahead for us, so there's no gain in skipping a page now and
 	 * then; that's likely to disable readahead and so be counterproductive.
-	 * Also, skipping even a single page means that we can't update
-	 * relfrozenxid, so we only want to do it if we can skip a goodly number
-	 * of pages.
+	 * Also, skipping even a single page that isn't all-frozen means that we
+	 * can't update relfrozenxid, so we only want to do it if we can skip a
+	 * goodly number of pages.
 	 *
-	 * Before entering the main loop, establish the invariant that
-	 * next_not_all_visible_block is the next block number >= blkno that's not
-	 * all-visible according to the visibility map, or nblocks if there's no
-	 * such block.  Also, we set up the skipping_all_visible_blocks flag,
-	 * which is needed because we need hysteresis in the decision: once we've
-	 * started skipping blocks, we may as well skip everything up to the next
-	 * not-all-visible block.
+	 * When scan_all is set, we can't skip pages just because they're
+	 * all-visible, but we can still skip pages that are all-frozen, since
+	 * such pages contain no tuples that could need freezing and so can't
+	 * hold back relfrozenxid or relminmxid.
 	 *
-	 * Note: if scan_all is true, we won't actually skip any pages; but we
-	 * maintain next_not_all_visible_block anyway, so as to set up the
-	 * all_visible_according_to_vm flag correctly for each page.
+	 * Before entering the main loop, establish the invariant that
+	 * next_unskippable_block is the next block number >= blkno that we can't
+	 * skip based on the visibility map, either all-visible for a regular scan
+	 * or all-frozen for a scan_all one, or nblocks if there's no such block.
+	 * Also, we set up the skipping_blocks flag, which is needed because we
+	 * need hysteresis in the decision: once we've started skipping blocks, we
+	 * may as well skip everything up to the next not-all-visible block.
 	 *
-	 * Note: The value returned by visibilitymap_test could be slightly
+	 * Note: The value returned by visibilitymap_get_status could be slightly
 	 * out-of-date, since we make this test before reading the corresponding
 	 * heap page or locking the buffer.  This is OK.  If we mistakenly think
-	 * that the page is all-visible when in fact the flag's just been cleared,
-	 * we might fail to vacuum the page.  But it's OK to skip pages when
-	 * scan_all is not set, so no great harm done; the next vacuum will find
-	 * them.  If we make the reverse mistake and vacuum a page unnecessarily,
-	 * it'll just be a no-op.
+	 * that the page is all-visible or all-frozen when in fact the flag's just
+	 * been cleared, we might fail to vacuum the page.  It's easy to see that
+	 * skipping a page when scan_all is not set is not a very big deal; we
+	 * might leave some dead tuples lying around, but the next vacuum will
+	 * find them.  But even when scan_all is set, it's still OK if we miss a
+	 * page whose all-frozen marking has just been cleared.  Any new XIDs
+	 * just added to that page are necessarily newer than the GlobalXmin we
+	 * computed, so they'll have no effect on the value to which we can
+	 * safely set relfrozenxid.  A similar argument applies for MXIDs and
+	 * relminmxid.  If we make the reverse mistake and vacuum a page
+	 * unnecessarily, it'll just be a no-op.
 	 */
-	for (next_not_all_visible_block = 0;
-		 next_not_all_visible_block < nblocks;
-		 next_not_all_visible_block++)
+	for (next_unskippable_block = 0;
+		 next_unskippable_block < nblocks;
+		 next_unskippable_block++)
 	{
-		if (!visibilitymap_test(onerel, next_not_all_visible_block, &vmbuffer))
-			break;
+		uint8		vmstatus;
+
+		vmstatus = visibilitymap_get_status(onerel, next_unskippable_block,
+											&vmbuffer);
+		if (scan_all)
+		{
+			if ((vmstatus & VISIBILITYMAP_ALL_FROZEN) == 0)
+				break;
+		}
+		else
+		{
+			if ((vmstatus & VISIBILITYMAP_ALL_VISIBLE) == 0)
+				break;
+		}
 		vacuum_delay_point();
 	}
-	if (next_not_all_visible_block >= SKIP_PAGES_THRESHOLD)
-		skipping_all_visible_blocks = true;
+	if (next_unskippable_block >= SKIP_PAGES_THRESHOLD)
+		skipping_blocks = true;
 	else
-		skipping_all_visible_blocks = false;
+		skipping_blocks = false;
 
 	for (blkno = 0; blkno < nblocks; blkno++)
 	{
@@ -509,38 +579,71 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		Size		freespace;
 		bool		all_visible_according_to_vm;
 		bool		all_visible;
+		bool		all_frozen = true;	/* provided all_visible is also true */
 		bool		has_dead_tuples;
 		TransactionId visibility_cutoff_xid = InvalidTransactionId;
 
-		if (blkno == next_not_all_visible_block)
+		if (blkno == next_unskippable_block)
 		{
-			/* Time to advance next_not_all_visible_block */
-			for (next_not_all_visible_block++;
-				 next_not_all_visible_block < nblocks;
-				 next_not_all_visible_block++)
+			/* Time to advance next_unskippable_block */
+			for (next_unskippable_block++;
+				 next_unskippable_block < nblocks;
+				 next_unskippable_block++)
 			{
-				if (!visibilitymap_test(onerel, next_not_all_visible_block,
-										&vmbuffer))
-					break;
+				uint8		vmstatus;
+
+				vmstatus = visibilitymap_get_status(onerel,
+													next_unskippable_block,
+													&vmbuffer);
+				if (scan_all)
+				{
+					if ((vmstatus & VISIBILITYMAP_ALL_FROZEN) == 0)
+						break;
+				}
+				else
+				{
+					if ((vmstatus & VISIBILITYMAP_ALL_VISIBLE) == 0)
+						break;
+				}
 				vacuum_delay_point();
 			}
 
 			/*
 			 * We know we can't skip the current block.  But set up
-			 * skipping_all_visible_blocks to do the right thing at the
-			 * following blocks.
+			 * skipping_blocks to do the right thing at the following blocks.
 			 */
-			if (next_not_all_visible_block - blkno > SKIP_PAGES_THRESHOLD)
-				skipping_all_visible_blocks = true;
+			if (next_unskippable_block - blkno > SKIP_PAGES_THRESHOLD)
+				skipping_blocks = true;
 			else
-				skipping_all_visible_blocks = false;
-			all_visible_according_to_vm = false;
+				skipping_blocks = false;
+
+			/*
+			 * Normally, the fact that we can't skip this block must mean that
+			 * it's not all-visible.  But in a scan_all vacuum we know only
+			 * that it's not all-frozen, so it might still be all-visible.
+			 */
+			if (scan_all && visibilitymap_test(onerel, blkno, &vmbuffer))
+				all_visible_according_to_vm = true;
+			else
+				all_visible_according_to_vm = false;
 		}
 		else
 		{
-			/* Current block is all-visible */
-			if (skipping_all_visible_blocks && !scan_all)
+			/*
+			 * The current block is potentially skippable; if we've seen a
+			 * long enough run of skippable blocks to justify skipping it, and
+			 * we're not forced to check it, then go ahead and skip.  A page
+			 * that is all-frozen doesn't prevent advancing relfrozenxid, so
+			 * remember how many of those we pass over.
+			 */
+			if (skipping_blocks)
+			{
+				if (scan_all ||
+					(visibilitymap_get_status(onerel, blkno, &vmbuffer) &
+					 VISIBILITYMAP_ALL_FROZEN) != 0)
+					vacrelstats->frozenskipped_pages++;
 				continue;
+			}
 			all_visible_according_to_vm = true;
 		}
 
@@ -550,7 +653,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		 * If we are close to overrunning the available space for dead-tuple
 		 * TIDs, pause and do a cycle of vacuuming before we tackle this page.
 		 */
-		if ((vacrelstats->max_dead_tuples - vacrelstats->num_dead_tuples) < MaxHeapTuplesPerPage &&
+		if (lazy_space_nearly_full(vacrelstats) &&
 			vacrelstats->num_dead_tuples > 0)
 		{
 			/*
@@ -581,7 +684,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			 * not to reset latestRemovedXid since we want that value to be
 			 * valid.
 			 */
-			vacrelstats->num_dead_tuples = 0;
+			lazy_forget_dead_tuples(vacrelstats);
 			vacrelstats->num_index_scans++;
 		}
 
@@ -589,12 +692,34 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		 * Pin the visibility map page in case we need to mark the page
 		 * all-visible.  In most cases this will be very cheap, because we'll
 		 * already have the correct page pinned anyway.  However, it's
-		 * possible that (a) next_not_all_visible_block is covered by a
+		 * possible that (a) next_unskippable_block is covered by a
 		 * different VM page than the current block or (b) we released our pin
 		 * and did a cycle of index vacuuming.
 		 */
 		visibilitymap_pin(onerel, blkno, &vmbuffer);
 
+#ifdef USE_PREFETCH
+
+		/*
+		 * Keep target_prefetch_pages reads in flight ahead of us.  The blocks
+		 * up to next_unskippable_block are passed over when we are
+		 * skipping, so don't ask for those; past it we can't tell yet.
+		 */
+		if (target_prefetch_pages > 0)
+		{
+			BlockNumber prefetch_start = blkno + 1;
+
+			if (skipping_blocks &&
+				next_unskippable_block > prefetch_start)
+				prefetch_start = next_unskippable_block;
+			if (prefetch_blkno < prefetch_start)
+				prefetch_blkno = prefetch_start;
+			while (prefetch_blkno < nblocks &&
+				   prefetch_blkno < prefetch_start + target_prefetch_pages)
+				PrefetchBuffer(onerel, MAIN_FORKNUM, prefetch_blkno++);
+		}
+#endif   /* USE_PREFETCH */
+
 		buf = ReadBufferExtended(onerel, MAIN_FORKNUM, blkno,
 								 RBM_NORMAL, vac_strategy);
 
@@ -686,7 +811,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			empty_pages++;
 			freespace = PageGetHeapFreeSpace(page);
 
-			/* empty pages are always all-visible */
+			/* empty pages are always all-visible and all-frozen */
 			if (!PageIsAllVisible(page))
 			{
 				START_CRIT_SECTION();
@@ -714,7 +839,8 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 
 				PageSetAllVisible(page);
 				visibilitymap_set(onerel, blkno, buf, InvalidXLogRecPtr,
-								  vmbuffer, InvalidTransactionId);
+								  vmbuffer, InvalidTransactionId,
+						   VISIBILITYMAP_ALL_VISIBLE | VISIBILITYMAP_ALL_FROZEN);
 				END_CRIT_SECTION();
 			}
 
@@ -886,10 +1012,13 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 				HeapTupleHeaderAdvanceLatestRemovedXid(tuple.t_data,
 											 &vacrelstats->latestRemovedXid);
 				tups_vacuumed += 1;
+				ntupgone += 1;
 				has_dead_tuples = true;
 			}
 			else
 			{
+				bool		tuple_totally_frozen;
+
 				num_tuples += 1;
 				hastup = true;
 
@@ -898,8 +1027,12 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 				 * freezing.  Note we already have exclusive buffer lock.
 				 */
 				if (heap_prepare_freeze_tuple(tuple.t_data, FreezeLimit,
-										  MultiXactCutoff, &frozen[nfrozen]))
+											  MultiXactCutoff, &frozen[nfrozen],
+											  &tuple_totally_frozen))
 					frozen[nfrozen++].offset = offnum;
+
+				if (!tuple_totally_frozen)
+					all_frozen = false;
 			}
 		}						/* scan along page */
 
@@ -955,7 +1088,7 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			 * not to reset latestRemovedXid since we want that value to be
 			 * valid.
 			 */
-			vacrelstats->num_dead_tuples = 0;
+			lazy_forget_dead_tuples(vacrelstats);
 			vacuumed_pages++;
 		}
 
@@ -977,10 +1110,15 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 			 * may be logged.  Given that this situation should only happen in
 			 * rare cases after a crash, it is not worth optimizing.
 			 */
+			uint8		flags = VISIBILITYMAP_ALL_VISIBLE;
+
+			if (all_frozen)
+				flags |= VISIBILITYMAP_ALL_FROZEN;
+
 			PageSetAllVisible(page);
 			MarkBufferDirty(buf);
 			visibilitymap_set(onerel, blkno, buf, InvalidXLogRecPtr,
-							  vmbuffer, visibility_cutoff_xid);
+							  vmbuffer, visibility_cutoff_xid, flags);
 		}
 
 		/*
@@ -995,7 +1133,8 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		{
 			elog(WARNING, "page is not marked all-visible but visibility map bit is set in relation \"%s\" page %u",
 				 relname, blkno);
-			visibilitymap_clear(onerel, blkno, vmbuffer);
+			visibilitymap_clear(onerel, blkno, vmbuffer,
+								VISIBILITYMAP_VALID_BITS);
 		}
 
 		/*
@@ -1017,7 +1156,22 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 				 relname, blkno);
 			PageClearAllVisible(page);
 			MarkBufferDirty(buf);
-			visibilitymap_clear(onerel, blkno, vmbuffer);
+			visibilitymap_clear(onerel, blkno, vmbuffer,
+								VISIBILITYMAP_VALID_BITS);
+		}
+
+		/*
+		 * If the all-visible page has been found to be all-frozen as well,
+		 * but the visibility map doesn't know that yet, set only the
+		 * all-frozen bit; the page doesn't need to be dirtied for that.
+		 */
+		else if (all_visible_according_to_vm && all_visible && all_frozen &&
+				 (visibilitymap_get_status(onerel, blkno, &vmbuffer) &
+				  VISIBILITYMAP_ALL_FROZEN) == 0)
+		{
+			visibilitymap_set(onerel, blkno, buf, InvalidXLogRecPtr,
+							  vmbuffer, InvalidTransactionId,
+							  VISIBILITYMAP_ALL_FROZEN);
 		}
 
 		UnlockReleaseBuffer(buf);
@@ -1058,8 +1212,30 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		vmbuffer = InvalidBuffer;
 	}
 
+	/*
+	 * Scanning every index to get rid of a handful of dead line pointers is
+	 * a waste: if this would be the only index pass, and only a few pages
+	 * have them, leave them for a later VACUUM.  That is only safe if they
+	 * all are dead line pointers already, whose tuples pruning has removed;
+	 * a tuple found dead only after pruning still has storage (and xids
+	 * that don't get frozen), so it must be removed now.
+	 */
+	if (vacrelstats->num_dead_tuples > 0 &&
+		vacrelstats->num_index_scans == 0 &&
+		ntupgone == 0 &&
+		vacrelstats->num_dead_pages < nblocks * BYPASS_THRESHOLD_PAGES &&
+		vacrelstats->num_dead_tuples < BYPASS_MAX_DEAD_TUPLES)
+	{
+		ereport(elevel,
+				(errmsg("\"%s\": index scans bypassed: %d pages have %d dead item pointers",
+						RelationGetRelationName(onerel),
+						vacrelstats->num_dead_pages,
+						vacrelstats->num_dead_tuples)));
+		bypass_indexes = true;
+		lazy_forget_dead_tuples(vacrelstats);
+	}
+
 	/* If any tuples need to be deleted, perform final vacuum cycle */
-	/* XXX put a threshold on min number of tuples here? */
 	if (vacrelstats->num_dead_tuples > 0)
 	{
 		/* Log cleanup info before we touch indexes */
@@ -1075,9 +1251,15 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 		vacrelstats->num_index_scans++;
 	}
 
-	/* Do post-vacuum cleanup and statistics update for each index */
-	for (i = 0; i < nindexes; i++)
-		lazy_cleanup_index(Irel[i], indstats[i], vacrelstats);
+	/*
+	 * Do post-vacuum cleanup and statistics update for each index, unless
+	 * we decided to leave the indexes alone entirely.
+	 */
+	if (!bypass_indexes)
+	{
+		for (i = 0; i < nindexes; i++)
+			lazy_cleanup_index(Irel[i], indstats[i], vacrelstats);
+	}
 
 	/* If no indexes, make log report that lazy_vacuum_heap would've made */
 	if (vacuumed_pages)
@@ -1116,16 +1298,16 @@ lazy_scan_heap(Relation onerel, LVRelStats *vacrelstats,
 static void
 lazy_vacuum_heap(Relation onerel, LVRelStats *vacrelstats)
 {
-	int			tupindex;
+	int			pageindex;
+	int			ntuples;
 	int			npages;
 	PGRUsage	ru0;
 	Buffer		vmbuffer = InvalidBuffer;
 
 	pg_rusage_init(&ru0);
-	npages = 0;
+	ntuples = npages = 0;
 
-	tupindex = 0;
-	while (tupindex < vacrelstats->num_dead_tuples)
+	for (pageindex = 0; pageindex < vacrelstats->num_dead_pages; pageindex++)
 	{
 		BlockNumber tblk;
 		Buffer		buf;
@@ -1134,16 +1316,15 @@ lazy_vacuum_heap(Relation onerel, LVRelStats *vacrelstats)
 
 		vacuum_delay_point();
 
-		tblk = ItemPointerGetBlockNumber(&vacrelstats->dead_tuples[tupindex]);
+		tblk = vacrelstats->dead_pages[pageindex].blkno;
 		buf = ReadBufferExtended(onerel, MAIN_FORKNUM, tblk, RBM_NORMAL,
 								 vac_strategy);
 		if (!ConditionalLockBufferForCleanup(buf))
 		{
 			ReleaseBuffer(buf);
-			++tupindex;
 			continue;
 		}
-		tupindex = lazy_vacuum_page(onerel, tblk, buf, tupindex, vacrelstats,
+		ntuples += lazy_vacuum_page(onerel, tblk, buf, pageindex, vacrelstats,
 									&vmbuffer);
 
 		/* Now that we've compacted the page, record its available space */
@@ -1164,7 +1345,7 @@ lazy_vacuum_heap(Relation onerel, LVRelStats *vacrelstats)
 	ereport(elevel,
 			(errmsg("\"%s\": removed %d row versions in %d pages",
 					RelationGetRelationName(onerel),
-					tupindex, npages),
+					ntuples, npages),
 			 errdetail("%s.",
 					   pg_rusage_show(&ru0))));
 }
@@ -1175,31 +1356,36 @@ lazy_vacuum_heap(Relation onerel, LVRelStats *vacrelstats)
  *
  * Caller must hold pin and buffer cleanup lock on the buffer.
  *
- * tupindex is the index in vacrelstats->dead_tuples of the first dead
- * tuple for this page.  We assume the rest follow sequentially.
- * The return value is the first tupindex after the tuples of this page.
+ * pageindex is the index in vacrelstats->dead_pages of this page.
+ * The return value is the number of dead tuples removed from it.
  */
 static int
 lazy_vacuum_page(Relation onerel, BlockNumber blkno, Buffer buffer,
-				 int tupindex, LVRelStats *vacrelstats, Buffer *vmbuffer)
+				 int pageindex, LVRelStats *vacrelstats, Buffer *vmbuffer)
 {
 	Page		page = BufferGetPage(buffer);
 	OffsetNumber unused[MaxOffsetNumber];
 	int			uncnt = 0;
 	TransactionId visibility_cutoff_xid;
+	bool		all_frozen;
+	int			tupindex,
+				endindex;
+
+	Assert(vacrelstats->dead_pages[pageindex].blkno == blkno);
+	tupindex = vacrelstats->dead_pages[pageindex].first;
+	if (pageindex + 1 < vacrelstats->num_dead_pages)
+		endindex = vacrelstats->dead_pages[pageindex + 1].first;
+	else
+		endindex = vacrelstats->num_dead_tuples;
 
 	START_CRIT_SECTION();
 
-	for (; tupindex < vacrelstats->num_dead_tuples; tupindex++)
+	for (; tupindex < endindex; tupindex++)
 	{
-		BlockNumber tblk;
 		OffsetNumber toff;
 		ItemId		itemid;
 
-		tblk = ItemPointerGetBlockNumber(&vacrelstats->dead_tuples[tupindex]);
-		if (tblk != blkno)
-			break;				/* past end of tuples for this block */
-		toff = ItemPointerGetOffsetNumber(&vacrelstats->dead_tuples[tupindex]);
+		toff = LVDeadOffset(vacrelstats, tupindex);
 		itemid = PageGetItemId(page, toff);
 		ItemIdSetUnused(itemid);
 		unused[uncnt++] = toff;
@@ -1238,22 +1424,34 @@ lazy_vacuum_page(Relation onerel, BlockNumber blkno, Buffer buffer,
 	 * dirty, exclusively locked, and, if needed, a full page image has been
 	 * emitted in the log_heap_clean() above.
 	 */
-	if (heap_page_is_all_visible(buffer, &visibility_cutoff_xid))
+	if (heap_page_is_all_visible(buffer, &visibility_cutoff_xid,
+								 &all_frozen))
 		PageSetAllVisible(page);
 
 	/*
 	 * All the changes to the heap page have been done. If the all-visible
-	 * flag is now set, also set the VM bit.
+	 * flag is now set, also set the VM all-visible bit (and, if possible, the
+	 * all-frozen bit) unless this has already been done previously.
 	 */
-	if (PageIsAllVisible(page) &&
-		!visibilitymap_test(onerel, blkno, vmbuffer))
+	if (PageIsAllVisible(page))
 	{
+		uint8		vm_status = visibilitymap_get_status(onerel, blkno,
+														 vmbuffer);
+		uint8		flags = 0;
+
+		/* Only ask for the bits that aren't set yet */
+		if ((vm_status & VISIBILITYMAP_ALL_VISIBLE) == 0)
+			flags |= VISIBILITYMAP_ALL_VISIBLE;
+		if ((vm_status & VISIBILITYMAP_ALL_FROZEN) == 0 && all_frozen)
+			flags |= VISIBILITYMAP_ALL_FROZEN;
+
 		Assert(BufferIsValid(*vmbuffer));
-		visibilitymap_set(onerel, blkno, buffer, InvalidXLogRecPtr, *vmbuffer,
-						  visibility_cutoff_xid);
+		if (flags != 0)
+			visibilitymap_set(onerel, blkno, buffer, InvalidXLogRecPtr,
+							  *vmbuffer, visibility_cutoff_xid, flags);
 	}
 
-	return tupindex;
+	return uncnt;
 }
 
 /*
@@ -1305,7 +1503,7 @@ lazy_check_needs_freeze(Buffer buf)
  *	lazy_vacuum_index() -- vacuum one index relation.
  *
  *		Delete all the index entries pointing to tuples listed in
- *		vacrelstats->dead_tuples, and update running statistics.
+ *		vacrelstats->dead_pages, and update running statistics.
  */
 static void
 lazy_vacuum_index(Relation indrel,
@@ -1638,12 +1836,15 @@ static void
 lazy_space_alloc(LVRelStats *vacrelstats, BlockNumber relblocks)
 {
 	long		maxtuples;
+	long		maxpages;
+	int			maxsegments;
 
 	if (vacrelstats->hasindex)
 	{
-		maxtuples = (maintenance_work_mem * 1024L) / sizeof(ItemPointerData);
-		maxtuples = Min(maxtuples, INT_MAX);
-		maxtuples = Min(maxtuples, MaxAllocSize / sizeof(ItemPointerData));
+		vacrelstats->dead_space = maintenance_work_mem * 1024L;
+
+		maxtuples = vacrelstats->dead_space / sizeof(OffsetNumber);
+		maxtuples = Min(maxtuples, INT_MAX - MaxHeapTuplesPerPage);
 
 		/* curious coding here to ensure the multiplication can't overflow */
 		if ((BlockNumber) (maxtuples / LAZY_ALLOC_TUPLES) > relblocks)
@@ -1651,35 +1852,133 @@ lazy_space_alloc(LVRelStats *vacrelstats, BlockNumber relblocks)
 
 		/* stay sane if small maintenance_work_mem */
 		maxtuples = Max(maxtuples, MaxHeapTuplesPerPage);
+
+		/* the page array starts out small and grows as needed */
+		maxpages = Min(relblocks, 1024);
+		maxpages = Max(maxpages, 1);
 	}
 	else
 	{
+		vacrelstats->dead_space = 0;
 		maxtuples = MaxHeapTuplesPerPage;
+		maxpages = 1;
 	}
 
+	/* always leave room for one full page */
+	vacrelstats->dead_space = Max(vacrelstats->dead_space,
+								  MaxHeapTuplesPerPage * sizeof(OffsetNumber) +
+								  sizeof(LVDeadPage));
+
 	vacrelstats->num_dead_tuples = 0;
 	vacrelstats->max_dead_tuples = (int) maxtuples;
-	vacrelstats->dead_tuples = (ItemPointer)
-		palloc(maxtuples * sizeof(ItemPointerData));
+	maxsegments = (int) ((maxtuples + DEAD_SEGMENT_SIZE - 1) >> DEAD_SEGMENT_SHIFT);
+	vacrelstats->dead_offsets = (OffsetNumber **)
+		palloc(maxsegments * sizeof(OffsetNumber *));
+	vacrelstats->num_dead_segments = 0;
+
+	vacrelstats->num_dead_pages = 0;
+	vacrelstats->max_dead_pages = (int) maxpages;
+	vacrelstats->dead_pages = (LVDeadPage *)
+		palloc(maxpages * sizeof(LVDeadPage));
+}
+
+/*
+ * lazy_space_nearly_full - is there no room left for another heap page?
+ */
+static bool
+lazy_space_nearly_full(LVRelStats *vacrelstats)
+{
+	long		used;
+
+	if (vacrelstats->max_dead_tuples - vacrelstats->num_dead_tuples <
+		MaxHeapTuplesPerPage)
+		return true;
+
+	if (vacrelstats->num_dead_pages >= MaxAllocSize / sizeof(LVDeadPage))
+		return true;
+
+	used = (long) vacrelstats->num_dead_tuples * sizeof(OffsetNumber) +
+		(long) (vacrelstats->num_dead_pages + 1) * sizeof(LVDeadPage);
+
+	return (used + MaxHeapTuplesPerPage * sizeof(OffsetNumber) >
+			vacrelstats->dead_space);
+}
+
+/*
+ * lazy_forget_dead_tuples - empty the list of dead tuples
+ *
+ * The space stays allocated for the next batch.
+ */
+static void
+lazy_forget_dead_tuples(LVRelStats *vacrelstats)
+{
+	vacrelstats->num_dead_tuples = 0;
+	vacrelstats->num_dead_pages = 0;
 }
 
 /*
  * lazy_record_dead_tuple - remember one deletable tuple
+ *
+ * The tuples must be passed in TID order.
  */
 static void
 lazy_record_dead_tuple(LVRelStats *vacrelstats,
 					   ItemPointer itemptr)
 {
+	BlockNumber blkno = ItemPointerGetBlockNumber(itemptr);
+	LVDeadPage *lastpage = NULL;
+	int			n = vacrelstats->num_dead_tuples;
+
 	/*
-	 * The array shouldn't overflow under normal behavior, but perhaps it
+	 * The space shouldn't overflow under normal behavior, but perhaps it
 	 * could if we are given a really small maintenance_work_mem. In that
 	 * case, just forget the last few tuples (we'll get 'em next time).
 	 */
-	if (vacrelstats->num_dead_tuples < vacrelstats->max_dead_tuples)
+	if (n >= vacrelstats->max_dead_tuples)
+		return;
+
+	if (vacrelstats->num_dead_pages > 0)
+		lastpage = &vacrelstats->dead_pages[vacrelstats->num_dead_pages - 1];
+
+	if (lastpage == NULL || lastpage->blkno != blkno)
 	{
-		vacrelstats->dead_tuples[vacrelstats->num_dead_tuples] = *itemptr;
-		vacrelstats->num_dead_tuples++;
+		Assert(lastpage == NULL || lastpage->blkno < blkno);
+
+		if (vacrelstats->num_dead_pages >= vacrelstats->max_dead_pages)
+		{
+			long		newmax = (long) vacrelstats->max_dead_pages * 2;
+
+			newmax = Min(newmax, MaxAllocSize / sizeof(LVDeadPage));
+			newmax = Min(newmax, vacrelstats->dead_space / sizeof(LVDeadPage));
+			if (newmax <= vacrelstats->max_dead_pages)
+				return;
+			vacrelstats->max_dead_pages = (int) newmax;
+			vacrelstats->dead_pages = (LVDeadPage *)
+				repalloc(vacrelstats->dead_pages,
+						 vacrelstats->max_dead_pages * sizeof(LVDeadPage));
+		}
+
+		lastpage = &vacrelstats->dead_pages[vacrelstats->num_dead_pages++];
+		lastpage->blkno = blkno;
+		lastpage->first = n;
+	}
+	else
+		Assert(LVDeadOffset(vacrelstats, n - 1) <
+			   ItemPointerGetOffsetNumber(itemptr));
+
+	/* Get the next segment when we start filling it for the first time */
+	if ((n >> DEAD_SEGMENT_SHIFT) >= vacrelstats->num_dead_segments)
+	{
+		int			size = Min(vacrelstats->max_dead_tuples - n,
+							   DEAD_SEGMENT_SIZE);
+
+		Assert((n & DEAD_SEGMENT_MASK) == 0);
+		vacrelstats->dead_offsets[vacrelstats->num_dead_segments++] =
+			(OffsetNumber *) palloc(size * sizeof(OffsetNumber));
 	}
+
+	LVDeadOffset(vacrelstats, n) = ItemPointerGetOffsetNumber(itemptr);
+	vacrelstats->num_dead_tuples++;
 }
 
 /*
@@ -1687,60 +1986,60 @@ lazy_record_dead_tuple(LVRelStats *vacrelstats,
  *
  *		This has the right signature to be an IndexBulkDeleteCallback.
  *
- *		Assumes dead_tuples array is in sorted order.
+ *		Binary searches the page of the tid, and then the tid within it.
  */
 static bool
 lazy_tid_reaped(ItemPointer itemptr, void *state)
 {
 	LVRelStats *vacrelstats = (LVRelStats *) state;
-	ItemPointer res;
-
-	res = (ItemPointer) bsearch((void *) itemptr,
-								(void *) vacrelstats->dead_tuples,
-								vacrelstats->num_dead_tuples,
-								sizeof(ItemPointerData),
-								vac_cmp_itemptr);
-
-	return (res != NULL);
-}
-
-/*
- * Comparator routines for use with qsort() and bsearch().
- */
-static int
-vac_cmp_itemptr(const void *left, const void *right)
-{
-	BlockNumber lblk,
-				rblk;
-	OffsetNumber loff,
-				roff;
-
-	lblk = ItemPointerGetBlockNumber((ItemPointer) left);
-	rblk = ItemPointerGetBlockNumber((ItemPointer) right);
+	BlockNumber blkno = ItemPointerGetBlockNumber(itemptr);
+	OffsetNumber offnum = ItemPointerGetOffsetNumber(itemptr);
+	int			low,
+				high;
+
+	low = 0;
+	high = vacrelstats->num_dead_pages;
+	while (low < high)
+	{
+		int			mid = low + (high - low) / 2;
 
-	if (lblk < rblk)
-		return -1;
-	if (lblk > rblk)
-		return 1;
+		if (vacrelstats->dead_pages[mid].blkno < blkno)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	if (low >= vacrelstats->num_dead_pages ||
+		vacrelstats->dead_pages[low].blkno != blkno)
+		return false;
 
-	loff = ItemPointerGetOffsetNumber((ItemPointer) left);
-	roff = ItemPointerGetOffsetNumber((ItemPointer) right);
+	high = (low + 1 < vacrelstats->num_dead_pages) ?
+		vacrelstats->dead_pages[low + 1].first : vacrelstats->num_dead_tuples;
+	low = vacrelstats->dead_pages[low].first;
+	while (low < high)
+	{
+		int			mid = low + (high - low) / 2;
+		OffsetNumber midoff = LVDeadOffset(vacrelstats, mid);
 
-	if (loff < roff)
-		return -1;
-	if (loff > roff)
-		return 1;
+		if (midoff == offnum)
+			return true;
+		if (midoff < offnum)
+			low = mid + 1;
+		else
+			high = mid;
+	}
 
-	return 0;
+	return false;
 }
 
 /*
  * Check if every tuple in the given page is visible to all current and future
  * transactions. Also return the visibility_cutoff_xid which is the highest
- * xmin amongst the visible tuples.
+ * xmin amongst the visible tuples.  Set *all_frozen to true if every tuple
+ * on this page is frozen.
  */
 static bool
-heap_page_is_all_visible(Buffer buf, TransactionId *visibility_cutoff_xid)
+heap_page_is_all_visible(Buffer buf, TransactionId *visibility_cutoff_xid,
+						 bool *all_frozen)
 {
 	Page		page = BufferGetPage(buf);
 	OffsetNumber offnum,
@@ -1748,6 +2047,7 @@ heap_page_is_all_visible(Buffer buf, TransactionId *visibility_cutoff_xid)
 	bool		all_visible = true;
 
 	*visibility_cutoff_xid = InvalidTransactionId;
+	*all_frozen = true;
 
 	/*
 	 * This is a stripped down version of the line pointer scan in
@@ -1810,6 +2110,11 @@ heap_page_is_all_visible(Buffer buf, TransactionId *visibility_cutoff_xid)
 					/* Track newest xmin on page. */
 					if (TransactionIdFollows(xmin, *visibility_cutoff_xid))
 						*visibility_cutoff_xid = xmin;
+
+					/* Check whether this tuple is already frozen or not */
+					if (all_visible && *all_frozen &&
+						heap_tuple_needs_eventual_freeze(tuple.t_data))
+						*all_frozen = false;
 				}
 				break;
 
@@ -1826,5 +2131,9 @@ heap_page_is_all_visible(Buffer buf, TransactionId *visibility_cutoff_xid)
 		}
 	}							/* scan along page */
 
+	/* A page can't be all-frozen without being all-visible */
+	if (!all_visible)
+		*all_frozen = false;
+
 	return all_visible;
 }
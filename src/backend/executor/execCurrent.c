@@ -279,6 +279,9 @@ search_plan_tree(PlanState *node, Oid table_oid)
 			 * scan nodes can all be treated alike
 			 */
 		case T_SeqScanState:
+#ifdef ADB
+		case T_SampleScanState:
+#endif
 		case T_IndexScanState:
 		case T_IndexOnlyScanState:
 		case T_BitmapHeapScanState:
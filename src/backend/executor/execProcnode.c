@@ -101,6 +101,9 @@
 #include "executor/nodeNestloop.h"
 #include "executor/nodeRecursiveunion.h"
 #include "executor/nodeResult.h"
+#ifdef ADB
+#include "executor/nodeSamplescan.h"
+#endif
 #include "executor/nodeSeqscan.h"
 #include "executor/nodeSetOp.h"
 #include "executor/nodeSort.h"
@@ -191,6 +194,13 @@ ExecInitNode(Plan *node, EState *estate, int eflags)
 												   estate, eflags);
 			break;
 
+#ifdef ADB
+		case T_SampleScan:
+			result = (PlanState *) ExecInitSampleScan((SampleScan *) node,
+													  estate, eflags);
+			break;
+#endif
+
 		case T_IndexScan:
 			result = (PlanState *) ExecInitIndexScan((IndexScan *) node,
 													 estate, eflags);
@@ -411,6 +421,12 @@ ExecProcNode(PlanState *node)
 			result = ExecSeqScan((SeqScanState *) node);
 			break;
 
+#ifdef ADB
+		case T_SampleScanState:
+			result = ExecSampleScan((SampleScanState *) node);
+			break;
+#endif
+
 		case T_IndexScanState:
 			result = ExecIndexScan((IndexScanState *) node);
 			break;
@@ -651,6 +667,12 @@ ExecEndNode(PlanState *node)
 			ExecEndSeqScan((SeqScanState *) node);
 			break;
 
+#ifdef ADB
+		case T_SampleScanState:
+			ExecEndSampleScan((SampleScanState *) node);
+			break;
+#endif
+
 		case T_IndexScanState:
 			ExecEndIndexScan((IndexScanState *) node);
 			break;
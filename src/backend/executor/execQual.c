@@ -54,6 +54,8 @@
 #include "pgstat.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
+#include "utils/date.h"
+#include "utils/fmgroids.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/typcache.h"
@@ -107,6 +109,11 @@ static Datum ExecMakeFunctionResult(FuncExprState *fcache,
 					   ExprContext *econtext,
 					   bool *isNull,
 					   ExprDoneCond *isDone);
+static void flatten_func_args(FuncExprState *fcache, MemoryContext fcacheCxt);
+static Datum ExecMakeFunctionResultFlat(FuncExprState *fcache,
+						   ExprContext *econtext,
+						   bool *isNull,
+						   ExprDoneCond *isDone);
 static Datum ExecMakeFunctionResultNoSets(FuncExprState *fcache,
 							 ExprContext *econtext,
 							 bool *isNull, ExprDoneCond *isDone);
@@ -114,6 +121,10 @@ static Datum ExecEvalFunc(FuncExprState *fcache, ExprContext *econtext,
 			 bool *isNull, ExprDoneCond *isDone);
 static Datum ExecEvalOper(FuncExprState *fcache, ExprContext *econtext,
 			 bool *isNull, ExprDoneCond *isDone);
+static bool compare_op_is_inlined(Oid opfuncid);
+static Datum ExecEvalOperCompareConst(FuncExprState *fcache,
+						 ExprContext *econtext,
+						 bool *isNull, ExprDoneCond *isDone);
 static Datum ExecEvalDistinct(FuncExprState *fcache, ExprContext *econtext,
 				 bool *isNull, ExprDoneCond *isDone);
 static Datum ExecEvalScalarArrayOp(ScalarArrayOpExprState *sstate,
@@ -2040,6 +2051,138 @@ ExecMakeFunctionResultNoSets(FuncExprState *fcache,
 	return result;
 }
 
+/*
+ * flatten_func_args
+ *
+ * Build the argument steps of ExecMakeFunctionResultFlat.  The steps live
+ * as long as the fcache itself.
+ */
+static void
+flatten_func_args(FuncExprState *fcache, MemoryContext fcacheCxt)
+{
+	ListCell   *arg;
+	int			i = 0;
+
+	fcache->nargsteps = list_length(fcache->args);
+	fcache->argsteps = (FuncArgStep *)
+		MemoryContextAllocZero(fcacheCxt,
+							   sizeof(FuncArgStep) * (fcache->nargsteps + 1));
+
+	foreach(arg, fcache->args)
+	{
+		ExprState  *argstate = (ExprState *) lfirst(arg);
+		FuncArgStep *step = &fcache->argsteps[i++];
+
+		step->argstate = argstate;
+		step->kind = FUNCARG_EXPR;
+		if (IsA(argstate->expr, Const))
+		{
+			Const	   *con = (Const *) argstate->expr;
+
+			step->kind = FUNCARG_CONST;
+			step->value = con->constvalue;
+			step->isnull = con->constisnull;
+		}
+		else if (IsA(argstate->expr, Var) &&
+				 ((Var *) argstate->expr)->varattno != InvalidAttrNumber)
+		{
+			/* whole-row Vars keep their own ExprState */
+			Var		   *variable = (Var *) argstate->expr;
+
+			step->attnum = variable->varattno;
+			switch (variable->varno)
+			{
+				case INNER_VAR:
+					step->kind = FUNCARG_INNER_VAR;
+					break;
+				case OUTER_VAR:
+					step->kind = FUNCARG_OUTER_VAR;
+					break;
+				default:
+					step->kind = FUNCARG_SCAN_VAR;
+					break;
+			}
+		}
+	}
+}
+
+/*
+ *		ExecMakeFunctionResultFlat
+ *
+ * ExecMakeFunctionResultNoSets with the arguments read from the flat steps:
+ * the constants and the Vars, which are most of the arguments of quals and
+ * projections, cost no call of their own.
+ */
+static Datum
+ExecMakeFunctionResultFlat(FuncExprState *fcache,
+						   ExprContext *econtext,
+						   bool *isNull,
+						   ExprDoneCond *isDone)
+{
+	FuncArgStep *step = fcache->argsteps;
+	FuncArgStep *stop = step + fcache->nargsteps;
+	FunctionCallInfo fcinfo = &fcache->fcinfo_data;
+	Datum	   *argvalue = fcinfo->arg;
+	bool	   *argnull = fcinfo->argnull;
+	bool		hasnull = false;
+	Datum		result;
+	PgStat_FunctionCallUsage fcusage;
+
+	/* Guard against stack overflow due to overly complex expressions */
+	check_stack_depth();
+
+	if (isDone)
+		*isDone = ExprSingleResult;
+
+	for (; step < stop; step++, argvalue++, argnull++)
+	{
+		switch (step->kind)
+		{
+			case FUNCARG_CONST:
+				*argvalue = step->value;
+				*argnull = step->isnull;
+				break;
+			case FUNCARG_SCAN_VAR:
+				*argvalue = slot_getattr(econtext->ecxt_scantuple,
+										 step->attnum, argnull);
+				break;
+			case FUNCARG_INNER_VAR:
+				*argvalue = slot_getattr(econtext->ecxt_innertuple,
+										 step->attnum, argnull);
+				break;
+			case FUNCARG_OUTER_VAR:
+				*argvalue = slot_getattr(econtext->ecxt_outertuple,
+										 step->attnum, argnull);
+				break;
+			case FUNCARG_EXPR:
+				*argvalue = ExecEvalExpr(step->argstate, econtext,
+										 argnull, NULL);
+				break;
+		}
+		hasnull |= *argnull;
+	}
+
+	/*
+	 * If function is strict, and there are any NULL arguments, skip calling
+	 * the function and return NULL.
+	 */
+	if (hasnull && fcache->func.fn_strict)
+	{
+		*isNull = true;
+		return (Datum) 0;
+	}
+
+	pgstat_init_function_usage(fcinfo, &fcusage);
+
+	fcinfo->isnull = false;
+	result = FunctionCallInvoke(fcinfo);
+	*isNull = fcinfo->isnull;
+
+	pgstat_end_function_usage(&fcusage, true);
+
+	return result;
+}
+
 
 /*
  *		ExecMakeTableFunctionResult
@@ -2422,7 +2565,12 @@ ExecEvalFunc(FuncExprState *fcache,
 	}
 	else
 	{
-		fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecMakeFunctionResultNoSets;
+		/*
+		 * This first call goes through the argument states, which checks the
+		 * Vars against the slots once; the next calls run the flat steps.
+		 */
+		flatten_func_args(fcache, econtext->ecxt_per_query_memory);
+		fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecMakeFunctionResultFlat;
 		return ExecMakeFunctionResultNoSets(fcache, econtext, isNull, isDone);
 	}
 }
@@ -2455,13 +2603,178 @@ ExecEvalOper(FuncExprState *fcache,
 		fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecMakeFunctionResult;
 		return ExecMakeFunctionResult(fcache, econtext, isNull, isDone);
 	}
+	else if (compare_op_is_inlined(op->opfuncid) &&
+			 list_length(op->args) == 2 &&
+			 IsA(lsecond(op->args), Const) &&
+			 !((Const *) lsecond(op->args))->constisnull)
+	{
+		/*
+		 * "expr op constant" with a comparison of int4, int8, float8 or date,
+		 * which scan quals mostly are: keep the constant and compare the
+		 * values in line instead of going through the function manager for
+		 * every row.
+		 */
+		fcache->fcinfo_data.arg[1] = ((Const *) lsecond(op->args))->constvalue;
+		fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecEvalOperCompareConst;
+		return ExecEvalOperCompareConst(fcache, econtext, isNull, isDone);
+	}
 	else
 	{
-		fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecMakeFunctionResultNoSets;
+		/*
+		 * This first call goes through the argument states, which checks the
+		 * Vars against the slots once; the next calls run the flat steps.
+		 */
+		flatten_func_args(fcache, econtext->ecxt_per_query_memory);
+		fcache->xprstate.evalfunc = (ExprStateEvalFunc) ExecMakeFunctionResultFlat;
 		return ExecMakeFunctionResultNoSets(fcache, econtext, isNull, isDone);
 	}
 }
 
+/*
+ * Is opfuncid one of the comparisons ExecEvalOperCompareConst evaluates in
+ * line?  All of them are strict and give the same result as the function.
+ */
+static bool
+compare_op_is_inlined(Oid opfuncid)
+{
+	switch (opfuncid)
+	{
+		case F_INT4EQ:
+		case F_INT4NE:
+		case F_INT4LT:
+		case F_INT4LE:
+		case F_INT4GT:
+		case F_INT4GE:
+		case F_INT8EQ:
+		case F_INT8NE:
+		case F_INT8LT:
+		case F_INT8LE:
+		case F_INT8GT:
+		case F_INT8GE:
+		case F_FLOAT8EQ:
+		case F_FLOAT8NE:
+		case F_FLOAT8LT:
+		case F_FLOAT8LE:
+		case F_FLOAT8GT:
+		case F_FLOAT8GE:
+		case F_DATE_EQ:
+		case F_DATE_NE:
+		case F_DATE_LT:
+		case F_DATE_LE:
+		case F_DATE_GT:
+		case F_DATE_GE:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * float8 ordering of float.c: NaN is equal to NaN and greater than any
+ * other value.
+ */
+static inline int
+float8_compare_inline(float8 a, float8 b)
+{
+	if (isnan(a))
+		return isnan(b) ? 0 : 1;
+	if (isnan(b))
+		return -1;
+	return a > b ? 1 : (a < b ? -1 : 0);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEvalOperCompareConst
+ *
+ *		Evaluate "expr op constant" for the operators accepted by
+ *		compare_op_is_inlined, the constant being in fcinfo_data.arg[1].
+ * ----------------------------------------------------------------
+ */
+static Datum
+ExecEvalOperCompareConst(FuncExprState *fcache,
+						 ExprContext *econtext,
+						 bool *isNull,
+						 ExprDoneCond *isDone)
+{
+	ExprState  *argstate = (ExprState *) linitial(fcache->args);
+	Datum		left;
+	Datum		right = fcache->fcinfo_data.arg[1];
+	int			cmp;
+
+	if (isDone)
+		*isDone = ExprSingleResult;
+
+	left = ExecEvalExpr(argstate, econtext, isNull, NULL);
+	if (*isNull)
+		return (Datum) 0;		/* the comparisons are strict */
+
+	switch (fcache->func.fn_oid)
+	{
+		case F_INT4EQ:
+		case F_INT4NE:
+		case F_INT4LT:
+		case F_INT4LE:
+		case F_INT4GT:
+		case F_INT4GE:
+			cmp = DatumGetInt32(left) > DatumGetInt32(right) ? 1 :
+				(DatumGetInt32(left) < DatumGetInt32(right) ? -1 : 0);
+			break;
+		case F_INT8EQ:
+		case F_INT8NE:
+		case F_INT8LT:
+		case F_INT8LE:
+		case F_INT8GT:
+		case F_INT8GE:
+			cmp = DatumGetInt64(left) > DatumGetInt64(right) ? 1 :
+				(DatumGetInt64(left) < DatumGetInt64(right) ? -1 : 0);
+			break;
+		case F_FLOAT8EQ:
+		case F_FLOAT8NE:
+		case F_FLOAT8LT:
+		case F_FLOAT8LE:
+		case F_FLOAT8GT:
+		case F_FLOAT8GE:
+			cmp = float8_compare_inline(DatumGetFloat8(left),
+										DatumGetFloat8(right));
+			break;
+		default:				/* the date comparisons */
+			cmp = DatumGetDateADT(left) > DatumGetDateADT(right) ? 1 :
+				(DatumGetDateADT(left) < DatumGetDateADT(right) ? -1 : 0);
+			break;
+	}
+
+	switch (fcache->func.fn_oid)
+	{
+		case F_INT4EQ:
+		case F_INT8EQ:
+		case F_FLOAT8EQ:
+		case F_DATE_EQ:
+			return BoolGetDatum(cmp == 0);
+		case F_INT4NE:
+		case F_INT8NE:
+		case F_FLOAT8NE:
+		case F_DATE_NE:
+			return BoolGetDatum(cmp != 0);
+		case F_INT4LT:
+		case F_INT8LT:
+		case F_FLOAT8LT:
+		case F_DATE_LT:
+			return BoolGetDatum(cmp < 0);
+		case F_INT4LE:
+		case F_INT8LE:
+		case F_FLOAT8LE:
+		case F_DATE_LE:
+			return BoolGetDatum(cmp <= 0);
+		case F_INT4GT:
+		case F_INT8GT:
+		case F_FLOAT8GT:
+		case F_DATE_GT:
+			return BoolGetDatum(cmp > 0);
+		default:
+			return BoolGetDatum(cmp >= 0);
+	}
+}
+
 /* ----------------------------------------------------------------
  *		ExecEvalDistinct
  *
@@ -129,6 +129,9 @@ MakeTupleTableSlot(void)
 	slot->tts_dataRow = NULL;
 	slot->tts_dataLen = -1;
 	slot->tts_attinmeta = NULL;
+#ifdef ADB
+	slot->tts_attinmeta_gen = 0;
+#endif
 #endif
 	slot->tts_mcxt = CurrentMemoryContext;
 	slot->tts_buffer = InvalidBuffer;
@@ -47,6 +47,7 @@
 #include "catalog/index.h"
 #include "executor/execdebug.h"
 #include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
 #include "parser/parsetree.h"
 #include "storage/lmgr.h"
 #include "utils/memutils.h"
@@ -219,6 +220,21 @@ FreeExecutorState(EState *estate)
  */
 ExprContext *
 CreateExprContext(EState *estate)
+{
+	return CreateExprContextExtended(estate, false);
+}
+
+/* ----------------
+ *		CreateExprContextExtended
+ *
+ *		As CreateExprContext, but if "bump" is true the per-tuple memory is
+ *		a bump context (see bump.c): pfree is a no-op there and repalloc
+ *		never gives memory back, so only ask for it when every allocation
+ *		made in the per-tuple memory lives until the next reset.
+ * ----------------
+ */
+ExprContext *
+CreateExprContextExtended(EState *estate, bool bump)
 {
 	ExprContext *econtext;
 	MemoryContext oldcontext;
@@ -238,12 +254,19 @@ CreateExprContext(EState *estate)
 	/*
 	 * Create working memory for expression evaluation in this context.
 	 */
-	econtext->ecxt_per_tuple_memory =
-		AllocSetContextCreate(estate->es_query_cxt,
+	if (bump)
+		econtext->ecxt_per_tuple_memory =
+			BumpContextCreate(estate->es_query_cxt,
 							  "ExprContext",
-							  ALLOCSET_DEFAULT_MINSIZE,
 							  ALLOCSET_DEFAULT_INITSIZE,
 							  ALLOCSET_DEFAULT_MAXSIZE);
+	else
+		econtext->ecxt_per_tuple_memory =
+			AllocSetContextCreate(estate->es_query_cxt,
+								  "ExprContext",
+								  ALLOCSET_DEFAULT_MINSIZE,
+								  ALLOCSET_DEFAULT_INITSIZE,
+								  ALLOCSET_DEFAULT_MAXSIZE);
 
 	econtext->ecxt_param_exec_vals = estate->es_param_exec_vals;
 	econtext->ecxt_param_list_info = estate->es_param_list_info;
@@ -427,6 +450,27 @@ ExecAssignExprContext(EState *estate, PlanState *planstate)
 	planstate->ps_ExprContext = CreateExprContext(estate);
 }
 
+/* ----------------
+ *		ExecAssignScanExprContext
+ *
+ *		As ExecAssignExprContext, for scan nodes that evaluate nothing per
+ *		row but their qual and targetlist.  The per-tuple memory is reset
+ *		for every row then, so it can be a bump context, unless a SubPlan
+ *		is involved: ExecScanSubPlan loops over its subquery's rows in the
+ *		caller's per-tuple memory and relies on pfree to keep that bounded.
+ * ----------------
+ */
+void
+ExecAssignScanExprContext(EState *estate, PlanState *planstate)
+{
+	Plan	   *plan = planstate->plan;
+	bool		bump;
+
+	bump = !contain_subplans((Node *) plan->qual) &&
+		!contain_subplans((Node *) plan->targetlist);
+	planstate->ps_ExprContext = CreateExprContextExtended(estate, bump);
+}
+
 /* ----------------
  *		ExecAssignResultType
  * ----------------
@@ -147,4 +147,13 @@ BufferUsageAccumDiff(BufferUsage *dst,
 						  add->blk_read_time, sub->blk_read_time);
 	INSTR_TIME_ACCUM_DIFF(dst->blk_write_time,
 						  add->blk_write_time, sub->blk_write_time);
+#ifdef ADB
+	dst->remote_bytes_sent += add->remote_bytes_sent - sub->remote_bytes_sent;
+	dst->remote_bytes_received +=
+		add->remote_bytes_received - sub->remote_bytes_received;
+	dst->remote_msgs_sent += add->remote_msgs_sent - sub->remote_msgs_sent;
+	dst->remote_msgs_received +=
+		add->remote_msgs_received - sub->remote_msgs_received;
+	dst->remote_round_trips += add->remote_round_trips - sub->remote_round_trips;
+#endif
 }
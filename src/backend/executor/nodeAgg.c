@@ -92,6 +92,7 @@
 #include "parser/parse_agg.h"
 #include "parser/parse_coerce.h"
 #include "pgxc/pgxc.h"
+#include "storage/buffile.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
 #include "utils/lsyscache.h"
@@ -275,6 +276,24 @@ typedef struct AggHashEntryData
 	AggStatePerGroupData pergroup[1];	/* VARIABLE LENGTH ARRAY */
 }	AggHashEntryData;	/* VARIABLE LENGTH STRUCT */
 
+/*
+ * When the groups outgrow work_mem, the hash table takes no new group: the
+ * input tuples of the groups it does not hold are written to one of
+ * HASHAGG_PARTITIONS temporary files, chosen by their hash value.  Once the
+ * input is done and the groups of the table are returned, each partition is
+ * aggregated in turn as the input of an empty table, and may spill again.
+ * A partition spilled HASHAGG_MAX_LEVEL times is aggregated whatever its
+ * size, so that groups sharing all their hash bits still end.
+ */
+#define HASHAGG_PARTITIONS		32
+#define HASHAGG_MAX_LEVEL		4
+
+typedef struct HashAggSpillPartition
+{
+	BufFile    *file;			/* tuples of the partition, rewound */
+	int			level;			/* times its tuples were spilled */
+} HashAggSpillPartition;
+
 
 static void initialize_aggregates(AggState *aggstate,
 					  AggStatePerAgg peragg,
@@ -303,6 +322,11 @@ static TupleTableSlot *agg_retrieve_direct(AggState *aggstate);
 static void agg_fill_hash_table(AggState *aggstate);
 static TupleTableSlot *agg_retrieve_hash_table(AggState *aggstate);
 static Datum GetAggInitVal(Datum textInitVal, Oid transtype);
+static TupleTableSlot *agg_hash_next_input(AggState *aggstate);
+static void agg_hash_spill_tuple(AggState *aggstate, TupleTableSlot *slot);
+static void agg_hash_spill_finish(AggState *aggstate);
+static bool agg_hash_next_partition(AggState *aggstate);
+static void agg_hash_spill_reset(AggState *aggstate);
 
 
 /*
@@ -1102,7 +1126,8 @@ hash_agg_entry_size(int numAggs)
 
 /*
  * Find or create a hashtable entry for the tuple group containing the
- * given tuple.
+ * given tuple.  Returns NULL when the group is not in the table and the
+ * table is full; the caller spills the tuple.
  *
  * When called, CurrentMemoryContext should be the per-query context.
  */
@@ -1132,7 +1157,18 @@ lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
 		hashslot->tts_isnull[varNumber] = inputslot->tts_isnull[varNumber];
 	}
 
-	/* find or create the hashtable entry using the filtered tuple */
+	/*
+	 * find or create the hashtable entry using the filtered tuple; once the
+	 * table holds all the groups work_mem can take, only look for the entry
+	 * and return NULL for a new group
+	 */
+	if (aggstate->hash_max_groups > 0 &&
+		aggstate->hash_ngroups >= aggstate->hash_max_groups &&
+		aggstate->hash_spill_level < HASHAGG_MAX_LEVEL)
+		return (AggHashEntry) LookupTupleHashEntry(aggstate->hashtable,
+												   hashslot,
+												   NULL);
+
 	entry = (AggHashEntry) LookupTupleHashEntry(aggstate->hashtable,
 												hashslot,
 												&isnew);
@@ -1141,6 +1177,7 @@ lookup_hash_entry(AggState *aggstate, TupleTableSlot *inputslot)
 	{
 		/* initialize aggregates for new tuple group */
 		initialize_aggregates(aggstate, aggstate->peragg, entry->pergroup);
+		aggstate->hash_ngroups++;
 	}
 
 	return entry;
@@ -1405,7 +1442,6 @@ agg_retrieve_direct(AggState *aggstate)
 static void
 agg_fill_hash_table(AggState *aggstate)
 {
-	PlanState  *outerPlan;
 	ExprContext *tmpcontext;
 	AggHashEntry entry;
 	TupleTableSlot *outerslot;
@@ -1413,17 +1449,16 @@ agg_fill_hash_table(AggState *aggstate)
 	/*
 	 * get state info from node
 	 */
-	outerPlan = outerPlanState(aggstate);
 	/* tmpcontext is the per-input-tuple expression context */
 	tmpcontext = aggstate->tmpcontext;
 
 	/*
-	 * Process each outer-plan tuple, and then fetch the next one, until we
-	 * exhaust the outer plan.
+	 * Process each input tuple, and then fetch the next one, until we
+	 * exhaust the outer plan or the partition being read back.
 	 */
 	for (;;)
 	{
-		outerslot = ExecProcNode(outerPlan);
+		outerslot = agg_hash_next_input(aggstate);
 		if (TupIsNull(outerslot))
 			break;
 		/* set up for advance_aggregates call */
@@ -1432,13 +1467,17 @@ agg_fill_hash_table(AggState *aggstate)
 		/* Find or build hashtable entry for this tuple's group */
 		entry = lookup_hash_entry(aggstate, outerslot);
 
-		/* Advance the aggregates */
-		advance_aggregates(aggstate, entry->pergroup);
+		/* Advance the aggregates, or keep the tuple for a later pass */
+		if (entry != NULL)
+			advance_aggregates(aggstate, entry->pergroup);
+		else
+			agg_hash_spill_tuple(aggstate, outerslot);
 
 		/* Reset per-input-tuple context after each tuple */
 		ResetExprContext(tmpcontext);
 	}
 
+	agg_hash_spill_finish(aggstate);
 	aggstate->table_filled = true;
 	/* Initialize to walk the hash table */
 	ResetTupleHashIterator(aggstate->hashtable, &aggstate->hashiter);
@@ -1481,6 +1520,10 @@ agg_retrieve_hash_table(AggState *aggstate)
 		entry = (AggHashEntry) ScanTupleHashTable(&aggstate->hashiter);
 		if (entry == NULL)
 		{
+			/* Aggregate the next spilled partition, if any */
+			if (agg_hash_next_partition(aggstate))
+				continue;
+
 			/* No more entries in hashtable, so done */
 			aggstate->agg_done = TRUE;
 			return NULL;
@@ -1551,6 +1594,205 @@ agg_retrieve_hash_table(AggState *aggstate)
 	return NULL;
 }
 
+/*
+ * Next input tuple of the hash table: from the outer plan, or from the
+ * partition being aggregated again.
+ */
+static TupleTableSlot *
+agg_hash_next_input(AggState *aggstate)
+{
+	TupleTableSlot *slot = aggstate->hash_spill_slot;
+	BufFile    *file = aggstate->hash_spill_input;
+	uint32		header[2];
+	size_t		nread;
+	MinimalTuple tuple;
+
+	if (file == NULL)
+		return ExecProcNode(outerPlanState(aggstate));
+
+	/* same layout as the hash join files: hash value, then the tuple */
+	nread = BufFileRead(file, (void *) header, sizeof(header));
+	if (nread == 0)				/* end of file */
+	{
+		BufFileClose(file);
+		aggstate->hash_spill_input = NULL;
+		return ExecClearTuple(slot);
+	}
+	if (nread != sizeof(header))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read from hash-aggregate temporary file: %m")));
+	tuple = (MinimalTuple) palloc(header[1]);
+	tuple->t_len = header[1];
+	nread = BufFileRead(file,
+						(void *) ((char *) tuple + sizeof(uint32)),
+						header[1] - sizeof(uint32));
+	if (nread != header[1] - sizeof(uint32))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read from hash-aggregate temporary file: %m")));
+	return ExecStoreMinimalTuple(tuple, slot, true);
+}
+
+/*
+ * Write an input tuple whose group is not in the full hash table to the
+ * partition of its hash value.  Each level takes other bits of the hash.
+ */
+static void
+agg_hash_spill_tuple(AggState *aggstate, TupleTableSlot *slot)
+{
+	Agg		   *node = (Agg *) aggstate->ss.ps.plan;
+	MinimalTuple tuple;
+	uint32		hashkey = 0;
+	int			partno;
+	int			i;
+
+	/* the hash of the grouping columns, as TupleHashTableHash computes it */
+	for (i = 0; i < node->numCols; i++)
+	{
+		AttrNumber	att = node->grpColIdx[i];
+		Datum		attr;
+		bool		isNull;
+
+		/* rotate hashkey left 1 bit at each step */
+		hashkey = (hashkey << 1) | ((hashkey & 0x80000000) ? 1 : 0);
+
+		attr = slot_getattr(slot, att, &isNull);
+		if (!isNull)
+			hashkey ^= DatumGetUInt32(FunctionCall1(&aggstate->hashfunctions[i],
+													attr));
+	}
+	partno = (hashkey >> (aggstate->hash_spill_level * 5)) % HASHAGG_PARTITIONS;
+
+	if (aggstate->hash_spill_files == NULL)
+		aggstate->hash_spill_files = (BufFile **)
+			MemoryContextAllocZero(aggstate->ss.ps.state->es_query_cxt,
+								   sizeof(BufFile *) * HASHAGG_PARTITIONS);
+	if (aggstate->hash_spill_files[partno] == NULL)
+	{
+		MemoryContext oldcxt;
+
+		oldcxt = MemoryContextSwitchTo(aggstate->ss.ps.state->es_query_cxt);
+		aggstate->hash_spill_files[partno] = BufFileCreateTemp(false);
+		MemoryContextSwitchTo(oldcxt);
+	}
+
+	tuple = ExecFetchSlotMinimalTuple(slot);
+	if (BufFileWrite(aggstate->hash_spill_files[partno], (void *) &hashkey,
+					 sizeof(uint32)) != sizeof(uint32) ||
+		BufFileWrite(aggstate->hash_spill_files[partno], (void *) tuple,
+					 tuple->t_len) != tuple->t_len)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not write to hash-aggregate temporary file: %m")));
+	aggstate->hash_spilled = true;
+}
+
+/*
+ * The input of the hash table is done: queue the partitions it wrote to be
+ * aggregated after its groups.
+ */
+static void
+agg_hash_spill_finish(AggState *aggstate)
+{
+	MemoryContext oldcxt;
+	int			i;
+
+	if (aggstate->hash_spill_files == NULL)
+		return;
+
+	oldcxt = MemoryContextSwitchTo(aggstate->ss.ps.state->es_query_cxt);
+	for (i = 0; i < HASHAGG_PARTITIONS; i++)
+	{
+		HashAggSpillPartition *partition;
+
+		if (aggstate->hash_spill_files[i] == NULL)
+			continue;
+		if (BufFileSeek(aggstate->hash_spill_files[i], 0, 0L, SEEK_SET))
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not rewind hash-aggregate temporary file: %m")));
+		partition = (HashAggSpillPartition *) palloc(sizeof(HashAggSpillPartition));
+		partition->file = aggstate->hash_spill_files[i];
+		partition->level = aggstate->hash_spill_level + 1;
+		aggstate->hash_spill_pending = lcons(partition,
+											 aggstate->hash_spill_pending);
+	}
+	MemoryContextSwitchTo(oldcxt);
+
+	pfree(aggstate->hash_spill_files);
+	aggstate->hash_spill_files = NULL;
+}
+
+/*
+ * All the groups of the hash table are returned: empty it and fill it again
+ * from the next spilled partition.  Returns false when none is left.
+ */
+static bool
+agg_hash_next_partition(AggState *aggstate)
+{
+	HashAggSpillPartition *partition;
+
+	if (aggstate->hash_spill_pending == NIL)
+		return false;
+
+	partition = (HashAggSpillPartition *) linitial(aggstate->hash_spill_pending);
+	aggstate->hash_spill_pending = list_delete_first(aggstate->hash_spill_pending);
+
+	/* the representative tuple of the last group goes with the table */
+	ExecClearTuple(aggstate->ss.ss_ScanTupleSlot);
+	MemoryContextResetAndDeleteChildren(aggstate->aggcontext);
+	build_hash_table(aggstate);
+	aggstate->hash_ngroups = 0;
+
+	if (aggstate->hash_spill_slot->tts_tupleDescriptor == NULL)
+		ExecSetSlotDescriptor(aggstate->hash_spill_slot,
+							  ExecGetResultType(outerPlanState(aggstate)));
+	aggstate->hash_spill_input = partition->file;
+	aggstate->hash_spill_level = partition->level;
+	pfree(partition);
+
+	agg_fill_hash_table(aggstate);
+	return true;
+}
+
+/*
+ * Close the temporary files of the partitions, to aggregate the whole input
+ * again.
+ */
+static void
+agg_hash_spill_reset(AggState *aggstate)
+{
+	ListCell   *lc;
+	int			i;
+
+	if (aggstate->hash_spill_files != NULL)
+	{
+		for (i = 0; i < HASHAGG_PARTITIONS; i++)
+		{
+			if (aggstate->hash_spill_files[i] != NULL)
+				BufFileClose(aggstate->hash_spill_files[i]);
+		}
+		pfree(aggstate->hash_spill_files);
+		aggstate->hash_spill_files = NULL;
+	}
+	if (aggstate->hash_spill_input != NULL)
+	{
+		BufFileClose(aggstate->hash_spill_input);
+		aggstate->hash_spill_input = NULL;
+	}
+	foreach(lc, aggstate->hash_spill_pending)
+		BufFileClose(((HashAggSpillPartition *) lfirst(lc))->file);
+	list_free_deep(aggstate->hash_spill_pending);
+	aggstate->hash_spill_pending = NIL;
+	if (aggstate->hash_spill_slot != NULL)
+		ExecClearTuple(aggstate->hash_spill_slot);
+
+	aggstate->hash_spill_level = 0;
+	aggstate->hash_ngroups = 0;
+	aggstate->hash_spilled = false;
+}
+
 /* -----------------
  * ExecInitAgg
  *
@@ -1568,6 +1810,7 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	int			numaggs,
 				aggno;
 	ListCell   *l;
+	Size		transitionSpace = 0;
 
 	/* check for unsupported flags */
 	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
@@ -1621,6 +1864,8 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	ExecInitScanTupleSlot(estate, &aggstate->ss);
 	ExecInitResultTupleSlot(estate, &aggstate->ss.ps);
 	aggstate->hashslot = ExecInitExtraTupleSlot(estate);
+	if (node->aggstrategy == AGG_HASHED)
+		aggstate->hash_spill_slot = ExecInitExtraTupleSlot(estate);
 
 	/*
 	 * initialize child expressions
@@ -1961,6 +2206,11 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 						&peraggstate->transtypeLen,
 						&peraggstate->transtypeByVal);
 
+		/* the planner counts the same for the transition values */
+		if (!peraggstate->transtypeByVal)
+			transitionSpace += MAXALIGN(get_typavgwidth(aggtranstype, -1)) +
+				2 * sizeof(void *);
+
 		/*
 		 * initval is potentially null, so don't try to access it as a struct
 		 * field. Must do it the hard way with SysCacheGetAttr.
@@ -2129,6 +2379,21 @@ ExecInitAgg(Agg *node, EState *estate, int eflags)
 	/* Update numaggs to match number of unique aggregates found */
 	aggstate->numaggs = aggno + 1;
 
+	/*
+	 * Groups the hash table can hold within work_mem, sized like the
+	 * estimate of the planner (see choose_hashed_grouping).
+	 */
+	if (node->aggstrategy == AGG_HASHED)
+	{
+		Size		hashentrysize;
+
+		hashentrysize = MAXALIGN(outerPlan->plan_width) +
+			MAXALIGN(sizeof(MinimalTupleData)) +
+			transitionSpace +
+			hash_agg_entry_size(aggstate->numaggs);
+		aggstate->hash_max_groups = Max(work_mem * 1024L / hashentrysize, 1);
+	}
+
 	return aggstate;
 }
 
@@ -2170,6 +2435,9 @@ ExecEndAgg(AggState *node)
 	node->ss.ps.ps_ExprContext = node->tmpcontext;
 	ExecFreeExprContext(&node->ss.ps);
 
+	/* Close the temporary files of a hashed aggregation */
+	agg_hash_spill_reset(node);
+
 	/* clean up tuple table */
 	ExecClearTuple(node->ss.ss_ScanTupleSlot);
 
@@ -2203,13 +2471,17 @@ ExecReScanAgg(AggState *node)
 		/*
 		 * If we do have the hash table and the subplan does not have any
 		 * parameter changes, then we can just rescan the existing hash table;
-		 * no need to build it again.
+		 * no need to build it again.  That is not possible when groups were
+		 * spilled, the table only holds the last of them.
 		 */
-		if (node->ss.ps.lefttree->chgParam == NULL)
+		if (node->ss.ps.lefttree->chgParam == NULL && !node->hash_spilled)
 		{
 			ResetTupleHashIterator(node->hashtable, &node->hashiter);
 			return;
 		}
+
+		agg_hash_spill_reset(node);
+		ExecClearTuple(node->ss.ss_ScanTupleSlot);
 	}
 
 	/* Make sure we have closed any open tuplesorts */
@@ -53,14 +53,50 @@
  *			  nil	nil		 Scan	 Scan	  Scan	   Scan
  *							  |		  |		   |		|
  *							person employee student student-emp
+ *
+ *		Foreign scans whose FDW can run them asynchronously are not
+ *		processed in turn: when the Append needs a row it asks each of them
+ *		to get rows coming, returns the rows of whichever has some, and
+ *		runs the other subplans in order while the remote servers work.
+ *		That is only done for forward scans, whose order of rows does not
+ *		matter.
+ *
+ *		The same goes for remote queries reading from the Datanodes: all
+ *		of them are sent before the answer of any is awaited, so that the
+ *		Datanodes work on them together.
  */
 
 #include "postgres.h"
 
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+#ifdef HAVE_SYS_POLL_H
+#include <sys/poll.h>
+#endif
+#ifdef HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
+
 #include "executor/execdebug.h"
 #include "executor/nodeAppend.h"
+#include "foreign/fdwapi.h"
+#include "miscadmin.h"
+#include "utils/waitevent.h"
+#ifdef ADB
+#include "pgxc/execRemote.h"
+#include "pgxc/nodemgr.h"
+#endif
+
+/* Longest wait for remote rows between two checks for interrupts, in ms */
+#define APPEND_ASYNC_WAIT_TIMEOUT	1000
 
 static bool exec_append_initialize_next(AppendState *appendstate);
+static bool exec_append_is_async(PlanState *planstate);
+static bool exec_append_async_request(PlanState *planstate, pgsocket *socks,
+						  int *nsocks);
+static TupleTableSlot *exec_append_async(AppendState *node);
+static void exec_append_wait(pgsocket *socks, int nsocks);
 
 
 /* ----------------------------------------------------------------
@@ -122,6 +158,7 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 	AppendState *appendstate = makeNode(AppendState);
 	PlanState **appendplanstates;
 	int			nplans;
+	int			nsocks;
 	int			i;
 	ListCell   *lc;
 
@@ -169,6 +206,39 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 		i++;
 	}
 
+	/*
+	 * Find the subplans that can run asynchronously.  Not for a scan that may
+	 * go backward, since the rows of those come in no predictable order.
+	 */
+	appendstate->as_nasync = 0;
+	nsocks = 0;
+	if (nplans > 1 && !(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_EXPLAIN_ONLY)))
+	{
+		appendstate->as_async = (bool *) palloc0(nplans * sizeof(bool));
+		for (i = 0; i < nplans; i++)
+		{
+			if (exec_append_is_async(appendplanstates[i]))
+			{
+				appendstate->as_async[i] = true;
+				appendstate->as_nasync++;
+#ifdef ADB
+				/* one socket for each Datanode it may read from */
+				if (IsA(appendplanstates[i], RemoteQueryState))
+					nsocks += NumDataNodes;
+				else
+#endif
+					nsocks++;
+			}
+		}
+	}
+	if (appendstate->as_nasync > 0)
+	{
+		appendstate->as_finished = (bool *) palloc0(nplans * sizeof(bool));
+		appendstate->as_socks = (pgsocket *)
+			palloc(nsocks * sizeof(pgsocket));
+		appendstate->as_whichasync = 0;
+	}
+
 	/*
 	 * initialize output tuple type
 	 */
@@ -193,6 +263,9 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 TupleTableSlot *
 ExecAppend(AppendState *node)
 {
+	if (node->as_nasync > 0)
+		return exec_append_async(node);
+
 	for (;;)
 	{
 		PlanState  *subnode;
@@ -287,4 +360,187 @@ ExecReScanAppend(AppendState *node)
 	}
 	node->as_whichplan = 0;
 	exec_append_initialize_next(node);
+
+	if (node->as_nasync > 0)
+	{
+		MemSet(node->as_finished, 0, node->as_nplans * sizeof(bool));
+		node->as_whichasync = 0;
+	}
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_is_async
+ *
+ *		Is the subplan a foreign scan or remote query able to run
+ *		asynchronously?
+ * ----------------------------------------------------------------
+ */
+static bool
+exec_append_is_async(PlanState *planstate)
+{
+	ForeignScanState *fsstate;
+
+#ifdef ADB
+	if (IsA(planstate, RemoteQueryState))
+		return ExecRemoteQueryIsAsyncCapable((RemoteQueryState *) planstate);
+#endif
+
+	if (!IsA(planstate, ForeignScanState))
+		return false;
+
+	fsstate = (ForeignScanState *) planstate;
+	return fsstate->fdwroutine->ForeignAsyncRequest != NULL &&
+		fsstate->fdwroutine->IsForeignScanAsyncCapable != NULL &&
+		fsstate->fdwroutine->IsForeignScanAsyncCapable(fsstate);
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_async_request
+ *
+ *		Get the asynchronous subplan going.  Returns true if it has
+ *		rows at hand, otherwise adds the sockets it waits on to socks.
+ * ----------------------------------------------------------------
+ */
+static bool
+exec_append_async_request(PlanState *planstate, pgsocket *socks, int *nsocks)
+{
+	ForeignScanState *fsstate;
+
+#ifdef ADB
+	if (IsA(planstate, RemoteQueryState))
+		return ExecRemoteQueryAsyncRequest((RemoteQueryState *) planstate,
+										   socks, nsocks);
+#endif
+
+	fsstate = (ForeignScanState *) planstate;
+	if (!fsstate->fdwroutine->ForeignAsyncRequest(fsstate, &socks[*nsocks]))
+	{
+		(*nsocks)++;
+		return false;
+	}
+	return true;
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_async
+ *
+ *		ExecAppend for an Append with asynchronous subplans.  The rows of
+ *		an asynchronous subplan ready to give some come first, then those
+ *		of the next synchronous subplan; with nothing to run but remote
+ *		work, we wait for any of the remote servers to answer.
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+exec_append_async(AppendState *node)
+{
+	int			nplans = node->as_nplans;
+
+	for (;;)
+	{
+		TupleTableSlot *result;
+		int			nsocks = 0;
+		int			i;
+
+		/*
+		 * Ask each asynchronous subplan left for rows, starting with the one
+		 * served last so that it goes on while it has rows at hand.
+		 */
+		for (i = 0; i < nplans; i++)
+		{
+			int			which = (node->as_whichasync + i) % nplans;
+			PlanState  *subnode = node->appendplans[which];
+
+			if (!node->as_async[which] || node->as_finished[which])
+				continue;
+
+			/* as ExecProcNode would, rescan first if parameters changed */
+			if (subnode->chgParam != NULL)
+				ExecReScan(subnode);
+
+			if (!exec_append_async_request(subnode, node->as_socks, &nsocks))
+				continue;
+
+			result = ExecProcNode(subnode);
+			if (!TupIsNull(result))
+			{
+				node->as_whichasync = which;
+				return result;
+			}
+			node->as_finished[which] = true;
+		}
+
+		/* Meanwhile, run the synchronous subplans in order */
+		while (node->as_whichplan < nplans)
+		{
+			if (!node->as_async[node->as_whichplan])
+			{
+				result = ExecProcNode(node->appendplans[node->as_whichplan]);
+				if (!TupIsNull(result))
+					return result;
+			}
+			node->as_whichplan++;
+		}
+
+		/* If no remote server is still at work, we are done */
+		if (nsocks == 0)
+			return ExecClearTuple(node->ps.ps_ResultTupleSlot);
+
+		exec_append_wait(node->as_socks, nsocks);
+	}
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_wait
+ *
+ *		Wait for one of the sockets to become readable, or for the
+ *		timeout, so that interrupts are serviced while we wait.
+ * ----------------------------------------------------------------
+ */
+static void
+exec_append_wait(pgsocket *socks, int nsocks)
+{
+	int			rc;
+	int			i;
+#ifdef HAVE_POLL
+	struct pollfd *pfds;
+
+	pfds = (struct pollfd *) palloc(nsocks * sizeof(struct pollfd));
+	for (i = 0; i < nsocks; i++)
+	{
+		pfds[i].fd = socks[i];
+		pfds[i].events = POLLIN;
+		pfds[i].revents = 0;
+	}
+
+	pgstat_report_wait_start(WAIT_EVENT_REMOTE_RECEIVE);
+	rc = poll(pfds, nsocks, APPEND_ASYNC_WAIT_TIMEOUT);
+	pgstat_report_wait_end();
+
+	pfree(pfds);
+#else
+	fd_set		input_mask;
+	struct timeval tv;
+	pgsocket	maxsock = 0;
+
+	FD_ZERO(&input_mask);
+	for (i = 0; i < nsocks; i++)
+	{
+		FD_SET(socks[i], &input_mask);
+		if (socks[i] > maxsock)
+			maxsock = socks[i];
+	}
+	tv.tv_sec = APPEND_ASYNC_WAIT_TIMEOUT / 1000;
+	tv.tv_usec = (APPEND_ASYNC_WAIT_TIMEOUT % 1000) * 1000L;
+
+	pgstat_report_wait_start(WAIT_EVENT_REMOTE_RECEIVE);
+	rc = select(maxsock + 1, &input_mask, NULL, NULL, &tv);
+	pgstat_report_wait_end();
+#endif
+
+	if (rc < 0 && errno != EINTR)
+		ereport(ERROR,
+				(errcode_for_socket_access(),
+				 errmsg("could not wait for foreign servers: %m")));
+
+	CHECK_FOR_INTERRUPTS();
 }
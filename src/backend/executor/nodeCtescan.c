@@ -206,6 +206,11 @@ ExecInitCteScan(CteScan *node, EState *estate, int eflags)
 	 * to the CteState of the first CteScan node that initializes for this
 	 * CTE.  This node will be the one that holds the shared state for all the
 	 * CTEs, particularly the shared tuplestore.
+	 *
+	 * The CTE plan runs on the coordinator, so when it is a RemoteQuery the
+	 * datanodes are asked for its rows only once; every other consumer of
+	 * the CTE, including the ones under a subplan, reads them back from this
+	 * tuplestore, which spills to disk beyond work_mem.
 	 */
 	prmdata = &(estate->es_param_exec_vals[node->cteParam]);
 	Assert(prmdata->execPlan == NULL);
@@ -46,6 +46,9 @@ static void ExecHashSkewTableInsert(HashJoinTable hashtable,
 						uint32 hashvalue,
 						int bucketNumber);
 static void ExecHashRemoveNextSkewBucket(HashJoinTable hashtable);
+static void ExecHashBloomCreate(HashJoinTable hashtable);
+static void ExecHashBloomAdd(HashJoinTable hashtable, uint32 hashvalue);
+static bool ExecHashBloomMayContain(HashJoinTable hashtable, uint32 hashvalue);
 
 
 /* ----------------------------------------------------------------
@@ -273,6 +276,8 @@ ExecHashTableCreate(Hash *node, List *hashOperators, bool keepNulls)
 	hashtable->nbuckets = nbuckets;
 	hashtable->log2_nbuckets = log2_nbuckets;
 	hashtable->buckets = NULL;
+	hashtable->bloom = NULL;
+	hashtable->bloomMask = 0;
 	hashtable->keepNulls = keepNulls;
 	hashtable->skewEnabled = false;
 	hashtable->skewBucket = NULL;
@@ -362,6 +367,7 @@ ExecHashTableCreate(Hash *node, List *hashOperators, bool keepNulls)
 
 	hashtable->buckets = (HashJoinTuple *)
 		palloc0(nbuckets * sizeof(HashJoinTuple));
+	ExecHashBloomCreate(hashtable);
 
 	/*
 	 * Set up for skew optimization, if possible and there's a need for more
@@ -744,6 +750,7 @@ ExecHashTableInsert(HashJoinTable hashtable,
 		/* Push it onto the front of the bucket's list */
 		hashTuple->next = hashtable->buckets[bucketno];
 		hashtable->buckets[bucketno] = hashTuple;
+		ExecHashBloomAdd(hashtable, hashvalue);
 
 		/* Account for space used, and back off if we've used too much */
 		hashtable->spaceUsed += hashTupleSize;
@@ -930,6 +937,8 @@ ExecScanHashBucket(HashJoinState *hjstate,
 		hashTuple = hashTuple->next;
 	else if (hjstate->hj_CurSkewBucketNo != INVALID_SKEW_BUCKET_NO)
 		hashTuple = hashtable->skewBucket[hjstate->hj_CurSkewBucketNo]->tuples;
+	else if (!ExecHashBloomMayContain(hashtable, hashvalue))
+		return false;			/* no inner tuple has this hash value */
 	else
 		hashTuple = hashtable->buckets[hjstate->hj_CurBucketNo];
 
@@ -1075,6 +1084,7 @@ ExecHashTableReset(HashJoinTable hashtable)
 	/* Reallocate and reinitialize the hash bucket headers. */
 	hashtable->buckets = (HashJoinTuple *)
 		palloc0(nbuckets * sizeof(HashJoinTuple));
+	ExecHashBloomCreate(hashtable);
 
 	hashtable->spaceUsed = 0;
 
@@ -1423,6 +1433,7 @@ ExecHashRemoveNextSkewBucket(HashJoinTable hashtable)
 			/* Move the tuple to the main hash table */
 			hashTuple->next = hashtable->buckets[bucketno];
 			hashtable->buckets[bucketno] = hashTuple;
+			ExecHashBloomAdd(hashtable, hashvalue);
 			/* We have reduced skew space, but overall space doesn't change */
 			hashtable->spaceUsedSkew -= tupleSize;
 		}
@@ -1473,3 +1484,73 @@ ExecHashRemoveNextSkewBucket(HashJoinTable hashtable)
 		hashtable->spaceUsedSkew = 0;
 	}
 }
+
+/*
+ * ExecHashBloomCreate
+ *
+ *		allocate an empty bloom filter for the buckets of the current batch,
+ *		if the bucket array is large enough for it to pay off
+ *
+ * The filter lets ExecScanHashBucket reject most outer tuples without a
+ * match while reading a few bits that stay in cache, instead of the bucket
+ * header and the chain behind it.
+ */
+static void
+ExecHashBloomCreate(HashJoinTable hashtable)
+{
+	Size		nbits;
+
+	if (hashtable->nbuckets < HJ_BLOOM_MIN_BUCKETS)
+	{
+		hashtable->bloom = NULL;
+		return;
+	}
+
+	/* nbuckets is a power of 2, and so is nbits */
+	nbits = (Size) hashtable->nbuckets * HJ_BLOOM_BITS_PER_BUCKET;
+	hashtable->bloom = (uint64 *)
+		MemoryContextAllocZero(hashtable->batchCxt, nbits / 8);
+	hashtable->bloomMask = (uint32) (nbits - 1);
+}
+
+/*
+ * The two bits of a hash value.  The multiplications mix the high bits of
+ * the hash value in, which the bucket number does not use.
+ */
+#define HJ_BLOOM_BIT1(hashvalue, mask) \
+	((uint32) (((uint64) (hashvalue) * UINT64CONST(0x9E3779B97F4A7C15)) >> 32) & (mask))
+#define HJ_BLOOM_BIT2(hashvalue, mask) \
+	((uint32) (((uint64) (hashvalue) * UINT64CONST(0xC2B2AE3D27D4EB4F)) >> 32) & (mask))
+
+static void
+ExecHashBloomAdd(HashJoinTable hashtable, uint32 hashvalue)
+{
+	uint32		bit;
+
+	if (hashtable->bloom == NULL)
+		return;
+
+	bit = HJ_BLOOM_BIT1(hashvalue, hashtable->bloomMask);
+	hashtable->bloom[bit / 64] |= UINT64CONST(1) << (bit % 64);
+	bit = HJ_BLOOM_BIT2(hashvalue, hashtable->bloomMask);
+	hashtable->bloom[bit / 64] |= UINT64CONST(1) << (bit % 64);
+}
+
+/*
+ * false only when no tuple of the buckets has the hash value; true may be a
+ * false positive
+ */
+static bool
+ExecHashBloomMayContain(HashJoinTable hashtable, uint32 hashvalue)
+{
+	uint32		bit;
+
+	if (hashtable->bloom == NULL)
+		return true;
+
+	bit = HJ_BLOOM_BIT1(hashvalue, hashtable->bloomMask);
+	if ((hashtable->bloom[bit / 64] & (UINT64CONST(1) << (bit % 64))) == 0)
+		return false;
+	bit = HJ_BLOOM_BIT2(hashvalue, hashtable->bloomMask);
+	return (hashtable->bloom[bit / 64] & (UINT64CONST(1) << (bit % 64))) != 0;
+}
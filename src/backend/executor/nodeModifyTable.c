@@ -1111,6 +1111,12 @@ ExecModifyTable(ModifyTableState *node)
 
 		if (TupIsNull(planSlot))
 		{
+#ifdef ADB
+			/* complete the rows still pipelined to remote nodes */
+			if (IS_PGXC_COORDINATOR && remoterelstate != NULL)
+				ExecFinishRemoteDMLBatch(estate, (RemoteQueryState *) remoterelstate,
+										 node->canSetTag);
+#endif
 			/* advance to next subplan if any */
 			node->mt_whichplan++;
 			if (node->mt_whichplan < node->mt_nplans)
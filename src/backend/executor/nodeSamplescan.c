@@ -0,0 +1,509 @@
+/*-------------------------------------------------------------------------
+ *
+ * nodeSamplescan.c
+ *	  Support routines for sample scans of relations (TABLESAMPLE).
+ *
+ * SYSTEM keeps every block of the relation with the requested probability
+ * and returns all the visible tuples of the blocks it keeps, so that the
+ * blocks it skips are never read.  BERNOULLI reads every block and keeps
+ * every visible tuple with that probability.  Whether a block or a tuple is
+ * kept depends only on a hash of the scan's seed and of its position, which
+ * makes a scan with REPEATABLE return the same sample as long as the
+ * relation does not change.
+ *
+ * On a Coordinator a distributed relation is never sampled here: the
+ * TABLESAMPLE clause is shipped with the rest of the query and every
+ * Datanode samples its own part of the relation.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/nodeSamplescan.c
+ *
+ *-------------------------------------------------------------------------
+ */
+/*
+ * INTERFACE ROUTINES
+ *		ExecSampleScan			scans a sample of a relation.
+ *		ExecInitSampleScan		creates and initializes a samplescan node.
+ *		ExecEndSampleScan		releases any storage allocated.
+ *		ExecReScanSampleScan	rescans the relation
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "access/hash.h"
+#include "access/heapam.h"
+#include "access/htup_details.h"
+#include "executor/execdebug.h"
+#include "executor/nodeSamplescan.h"
+#include "miscadmin.h"
+#include "pgstat.h"
+#include "storage/bufmgr.h"
+#include "storage/predicate.h"
+#include "utils/rel.h"
+#include "utils/snapmgr.h"
+#include "utils/tqual.h"
+
+static void InitScanRelation(SampleScanState *node, EState *estate, int eflags);
+static TupleTableSlot *SampleNext(SampleScanState *node);
+static void SampleBegin(SampleScanState *node);
+static bool SampleNextBlock(SampleScanState *node);
+static void SampleGetPage(SampleScanState *node, BlockNumber blockno);
+static double SampleRandom(uint32 seed, BlockNumber blockno,
+			 OffsetNumber offset);
+
+/* ----------------------------------------------------------------
+ *						Scan Support
+ * ----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------
+ *		SampleNext
+ *
+ *		This is a workhorse for ExecSampleScan
+ * ----------------------------------------------------------------
+ */
+static TupleTableSlot *
+SampleNext(SampleScanState *node)
+{
+	TupleTableSlot *slot = node->ss.ss_ScanTupleSlot;
+	OffsetNumber offset;
+	Page		dp;
+	ItemId		lpp;
+
+	if (!node->inited)
+		SampleBegin(node);
+
+	while (node->cindex >= node->ntuples)
+	{
+		if (!SampleNextBlock(node))
+			return ExecClearTuple(slot);
+	}
+
+	offset = node->offsets[node->cindex++];
+	dp = (Page) BufferGetPage(node->cbuf);
+	lpp = PageGetItemId(dp, offset);
+	node->tuple.t_data = (HeapTupleHeader) PageGetItem(dp, lpp);
+	node->tuple.t_len = ItemIdGetLength(lpp);
+	ItemPointerSet(&node->tuple.t_self, node->cblock, offset);
+
+	pgstat_count_heap_getnext(node->ss.ss_currentRelation);
+
+	/*
+	 * As in SeqNext, the tuple points into the pinned buffer, which
+	 * ExecStoreTuple pins once more for as long as the slot holds it.
+	 */
+	return ExecStoreTuple(&node->tuple,	/* tuple to store */
+						  slot,			/* slot to store in */
+						  node->cbuf,	/* buffer associated with this tuple */
+						  false);		/* don't pfree this pointer */
+}
+
+/*
+ * SampleRecheck -- access method routine to recheck a tuple in EvalPlanQual
+ */
+static bool
+SampleRecheck(SampleScanState *node, TupleTableSlot *slot)
+{
+	/* As for a SeqScan, there are no scan keys to check */
+	return true;
+}
+
+/*
+ * SampleBegin -- evaluate the TABLESAMPLE arguments and start the scan
+ *
+ * This is done at the first fetch of every scan rather than at executor
+ * startup, since the arguments may contain parameters.
+ */
+static void
+SampleBegin(SampleScanState *node)
+{
+	ExprContext *econtext = node->ss.ps.ps_ExprContext;
+	Datum		value;
+	bool		isnull;
+	float4		percent;
+
+	value = ExecEvalExprSwitchContext(node->percent, econtext, &isnull, NULL);
+	if (isnull)
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("TABLESAMPLE percentage cannot be null")));
+	percent = DatumGetFloat4(value);
+	if (isnan(percent) || percent < 0 || percent > 100)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("TABLESAMPLE percentage must be between 0 and 100")));
+	node->fraction = percent / 100.0;
+
+	if (node->repeatable)
+	{
+		float8		seed;
+
+		value = ExecEvalExprSwitchContext(node->repeatable, econtext,
+										  &isnull, NULL);
+		if (isnull)
+			ereport(ERROR,
+					(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+					 errmsg("TABLESAMPLE REPEATABLE parameter cannot be null")));
+		seed = DatumGetFloat8(value);
+		node->seed = DatumGetUInt32(hash_any((unsigned char *) &seed,
+											 sizeof(seed)));
+	}
+	else
+		node->seed = (uint32) random();
+
+	node->nblocks = RelationGetNumberOfBlocks(node->ss.ss_currentRelation);
+	node->cblock = InvalidBlockNumber;
+	node->ntuples = 0;
+	node->cindex = 0;
+	node->inited = true;
+
+	pgstat_count_heap_scan(node->ss.ss_currentRelation);
+}
+
+/*
+ * SampleNextBlock -- move to the next block that is sampled
+ *
+ * Returns false when the relation is exhausted.
+ */
+static bool
+SampleNextBlock(SampleScanState *node)
+{
+	BlockNumber blockno;
+
+	blockno = (node->cblock == InvalidBlockNumber) ? 0 : node->cblock + 1;
+
+	/* SYSTEM skips the blocks it does not keep without reading them */
+	if (node->method == TABLESAMPLE_SYSTEM)
+	{
+		while (blockno < node->nblocks &&
+			   SampleRandom(node->seed, blockno, InvalidOffsetNumber) >=
+			   node->fraction)
+			blockno++;
+	}
+
+	if (blockno >= node->nblocks)
+	{
+		if (BufferIsValid(node->cbuf))
+		{
+			ReleaseBuffer(node->cbuf);
+			node->cbuf = InvalidBuffer;
+		}
+		node->cblock = node->nblocks;
+		node->ntuples = 0;
+		node->cindex = 0;
+		return false;
+	}
+
+	SampleGetPage(node, blockno);
+	return true;
+}
+
+/*
+ * SampleGetPage -- read a block and collect the sampled visible tuples
+ *
+ * Much like heapgetpage(): visibility is checked once for the whole page
+ * under the share lock, and the tuples found visible stay good for as long
+ * as we hold the pin.
+ */
+static void
+SampleGetPage(SampleScanState *node, BlockNumber blockno)
+{
+	Relation	rel = node->ss.ss_currentRelation;
+	Snapshot	snapshot = node->ss.ps.state->es_snapshot;
+	Buffer		buffer;
+	Page		dp;
+	int			lines;
+	int			ntup;
+	OffsetNumber lineoff;
+	ItemId		lpp;
+	bool		all_visible;
+
+	/* release previous buffer, if any */
+	if (BufferIsValid(node->cbuf))
+	{
+		ReleaseBuffer(node->cbuf);
+		node->cbuf = InvalidBuffer;
+	}
+
+	/*
+	 * Be sure to check for interrupts at least once per page, a SYSTEM
+	 * sample of a big relation may return nothing for a long time.
+	 */
+	CHECK_FOR_INTERRUPTS();
+
+	buffer = ReadBufferExtended(rel, MAIN_FORKNUM, blockno,
+								RBM_NORMAL, node->strategy);
+	node->cbuf = buffer;
+	node->cblock = blockno;
+
+	/*
+	 * Prune and repair fragmentation for the whole page, if possible.
+	 */
+	Assert(TransactionIdIsValid(RecentGlobalXmin));
+	heap_page_prune_opt(rel, buffer, RecentGlobalXmin);
+
+	LockBuffer(buffer, BUFFER_LOCK_SHARE);
+
+	dp = (Page) BufferGetPage(buffer);
+	lines = PageGetMaxOffsetNumber(dp);
+	ntup = 0;
+
+	/* see heapgetpage() about hot standby */
+	all_visible = PageIsAllVisible(dp) && !snapshot->takenDuringRecovery;
+
+	for (lineoff = FirstOffsetNumber, lpp = PageGetItemId(dp, lineoff);
+		 lineoff <= lines;
+		 lineoff++, lpp++)
+	{
+		HeapTupleData loctup;
+		bool		valid;
+
+		if (!ItemIdIsNormal(lpp))
+			continue;
+
+		/* BERNOULLI does not even look at the tuples it does not keep */
+		if (node->method == TABLESAMPLE_BERNOULLI &&
+			SampleRandom(node->seed, blockno, lineoff) >= node->fraction)
+			continue;
+
+		loctup.t_data = (HeapTupleHeader) PageGetItem(dp, lpp);
+		loctup.t_len = ItemIdGetLength(lpp);
+		loctup.t_tableOid = RelationGetRelid(rel);
+		ItemPointerSet(&(loctup.t_self), blockno, lineoff);
+
+		if (all_visible)
+			valid = true;
+		else
+			valid = HeapTupleSatisfiesVisibility(&loctup, snapshot, buffer);
+
+		CheckForSerializableConflictOut(valid, rel, &loctup,
+										buffer, snapshot);
+
+		if (valid)
+			node->offsets[ntup++] = lineoff;
+	}
+
+	LockBuffer(buffer, BUFFER_LOCK_UNLOCK);
+
+	Assert(ntup <= MaxHeapTuplesPerPage);
+	node->ntuples = ntup;
+	node->cindex = 0;
+}
+
+/*
+ * SampleRandom -- the pseudo random number of a block or a tuple
+ *
+ * Returns a number in [0, 1) depending only on the seed and the position.
+ */
+static double
+SampleRandom(uint32 seed, BlockNumber blockno, OffsetNumber offset)
+{
+	uint32		key[3];
+
+	key[0] = seed;
+	key[1] = blockno;
+	key[2] = offset;
+
+	return (double) DatumGetUInt32(hash_any((unsigned char *) key,
+											sizeof(key))) /
+		((double) 0xFFFFFFFF + 1.0);
+}
+
+/* ----------------------------------------------------------------
+ *		ExecSampleScan(node)
+ *
+ *		Scans a sample of the relation and returns the next qualifying
+ *		tuple.
+ *		We call the ExecScan() routine and pass it the appropriate
+ *		access method functions.
+ * ----------------------------------------------------------------
+ */
+TupleTableSlot *
+ExecSampleScan(SampleScanState *node)
+{
+	return ExecScan((ScanState *) node,
+					(ExecScanAccessMtd) SampleNext,
+					(ExecScanRecheckMtd) SampleRecheck);
+}
+
+/* ----------------------------------------------------------------
+ *		InitScanRelation
+ *
+ *		Set up to access the scan relation.
+ * ----------------------------------------------------------------
+ */
+static void
+InitScanRelation(SampleScanState *node, EState *estate, int eflags)
+{
+	Relation	currentRelation;
+
+	/*
+	 * get the relation object id from the relid'th entry in the range table,
+	 * open that relation and acquire appropriate lock on it.
+	 */
+	currentRelation = ExecOpenScanRelation(estate,
+							((SampleScan *) node->ss.ps.plan)->scan.scanrelid,
+										   eflags);
+
+	node->ss.ss_currentRelation = currentRelation;
+	node->ss.ss_currentScanDesc = NULL;
+
+	/*
+	 * Any tuple of the relation may be in the sample, so that a serializable
+	 * transaction has to lock the whole relation, as a seqscan does.
+	 */
+	PredicateLockRelation(currentRelation, estate->es_snapshot);
+
+	/*
+	 * SYSTEM may skip most of the blocks, but BERNOULLI reads them all, so
+	 * don't let a big relation push everything else out of shared buffers.
+	 */
+	if (RelationGetNumberOfBlocks(currentRelation) > NBuffers / 4)
+		node->strategy = GetAccessStrategy(BAS_BULKREAD);
+	else
+		node->strategy = NULL;
+
+	/* and report the scan tuple slot's rowtype */
+	ExecAssignScanType(&node->ss, RelationGetDescr(currentRelation));
+}
+
+
+/* ----------------------------------------------------------------
+ *		ExecInitSampleScan
+ * ----------------------------------------------------------------
+ */
+SampleScanState *
+ExecInitSampleScan(SampleScan *node, EState *estate, int eflags)
+{
+	SampleScanState *scanstate;
+	TableSampleClause *tablesample = node->tablesample;
+
+	Assert(outerPlan(node) == NULL);
+	Assert(innerPlan(node) == NULL);
+
+	/*
+	 * create state structure
+	 */
+	scanstate = makeNode(SampleScanState);
+	scanstate->ss.ps.plan = (Plan *) node;
+	scanstate->ss.ps.state = estate;
+
+	/*
+	 * Miscellaneous initialization
+	 *
+	 * create expression context for node
+	 */
+	ExecAssignExprContext(estate, &scanstate->ss.ps);
+
+	/*
+	 * initialize child expressions
+	 */
+	scanstate->ss.ps.targetlist = (List *)
+		ExecInitExpr((Expr *) node->scan.plan.targetlist,
+					 (PlanState *) scanstate);
+	scanstate->ss.ps.qual = (List *)
+		ExecInitExpr((Expr *) node->scan.plan.qual,
+					 (PlanState *) scanstate);
+	scanstate->percent = ExecInitExpr((Expr *) tablesample->percent,
+									  (PlanState *) scanstate);
+	scanstate->repeatable = ExecInitExpr((Expr *) tablesample->repeatable,
+										 (PlanState *) scanstate);
+	scanstate->method = tablesample->method;
+
+	/*
+	 * tuple table initialization
+	 */
+	ExecInitResultTupleSlot(estate, &scanstate->ss.ps);
+	ExecInitScanTupleSlot(estate, &scanstate->ss);
+
+	/*
+	 * initialize scan relation
+	 */
+	InitScanRelation(scanstate, estate, eflags);
+
+	scanstate->cbuf = InvalidBuffer;
+	scanstate->cblock = InvalidBlockNumber;
+	scanstate->offsets = (OffsetNumber *)
+		palloc(MaxHeapTuplesPerPage * sizeof(OffsetNumber));
+	scanstate->tuple.t_tableOid = RelationGetRelid(scanstate->ss.ss_currentRelation);
+	scanstate->inited = false;
+
+	scanstate->ss.ps.ps_TupFromTlist = false;
+
+	/*
+	 * Initialize result tuple type and projection info.
+	 */
+	ExecAssignResultTypeFromTL(&scanstate->ss.ps);
+	ExecAssignScanProjectionInfo(&scanstate->ss);
+
+	return scanstate;
+}
+
+/* ----------------------------------------------------------------
+ *		ExecEndSampleScan
+ *
+ *		frees any storage allocated through C routines.
+ * ----------------------------------------------------------------
+ */
+void
+ExecEndSampleScan(SampleScanState *node)
+{
+	/*
+	 * Free the exprcontext
+	 */
+	ExecFreeExprContext(&node->ss.ps);
+
+	/*
+	 * clean out the tuple table
+	 */
+	ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+	ExecClearTuple(node->ss.ss_ScanTupleSlot);
+
+	/*
+	 * release the current buffer and the access strategy
+	 */
+	if (BufferIsValid(node->cbuf))
+		ReleaseBuffer(node->cbuf);
+	if (node->strategy != NULL)
+		FreeAccessStrategy(node->strategy);
+
+	/*
+	 * close the heap relation.
+	 */
+	ExecCloseScanRelation(node->ss.ss_currentRelation);
+}
+
+/* ----------------------------------------------------------------
+ *						Join Support
+ * ----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------
+ *		ExecReScanSampleScan
+ *
+ *		Rescans the relation.  Without REPEATABLE the new scan gets a new
+ *		seed, and so a new sample.
+ * ----------------------------------------------------------------
+ */
+void
+ExecReScanSampleScan(SampleScanState *node)
+{
+	/* the slot may point into the buffer we are about to release */
+	ExecClearTuple(node->ss.ss_ScanTupleSlot);
+
+	if (BufferIsValid(node->cbuf))
+	{
+		ReleaseBuffer(node->cbuf);
+		node->cbuf = InvalidBuffer;
+	}
+	node->cblock = InvalidBlockNumber;
+	node->ntuples = 0;
+	node->cindex = 0;
+	node->inited = false;
+
+	ExecScanReScan((ScanState *) node);
+}
@@ -177,7 +177,7 @@ ExecInitSeqScan(SeqScan *node, EState *estate, int eflags)
 	 *
 	 * create expression context for node
 	 */
-	ExecAssignExprContext(estate, &scanstate->ps);
+	ExecAssignScanExprContext(estate, &scanstate->ps);
 
 	/*
 	 * initialize child expressions
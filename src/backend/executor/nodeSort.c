@@ -19,6 +19,59 @@
 #include "executor/nodeSort.h"
 #include "miscadmin.h"
 #include "utils/tuplesort.h"
+#ifdef PGXC
+#include "lib/binaryheap.h"
+#include "pgxc/execRemote.h"
+#include "pgxc/nodemgr.h"
+#include "utils/sortsupport.h"
+#include "utils/tuplestore.h"
+
+/*
+ * Streaming merge of the sorted results of several nodes.
+ *
+ * When ORDER BY is pushed down to the nodes (srt_start_merge) each node
+ * returns its rows sorted, so instead of writing every row to tapes and
+ * merging them after the last one arrived, the look-ahead row of each node is
+ * kept in a binary heap and the smallest one is returned as soon as every
+ * node still running has a row in the heap.  Rows arrive from the RemoteQuery
+ * in whatever order the connections deliver them, so rows of a node which
+ * runs ahead of the others are queued in a small tuplestore of that node.
+ * The first row is returned without waiting for the whole result, and a
+ * LIMIT above stops reading early.
+ *
+ * This lives in Sort rather than in a plan node of its own: the planner
+ * already marks the case with srt_start_merge, and Sort keeps handling what
+ * the merge can't, i.e. backward scans, rescans, and rows which don't carry
+ * the node they came from, for which we switch to tuplesort on the fly.
+ */
+typedef struct RemoteMergeNode
+{
+	Oid			nodeoid;		/* node the rows come from */
+	TupleTableSlot *slot;		/* look-ahead row, valid while in the heap */
+	Tuplestorestate *queue;		/* rows read after the look-ahead row */
+	int64		nqueued;		/* number of rows in queue */
+	bool		in_heap;		/* slot holds a row and is in the heap */
+} RemoteMergeNode;
+
+typedef struct RemoteMergeState
+{
+	RemoteQueryState *combiner;	/* the RemoteQuery below us */
+	TupleDesc	tupDesc;
+	int			nnodes;			/* number of entries used in nodes */
+	int			maxnodes;		/* allocated length of nodes */
+	RemoteMergeNode *nodes;
+	binaryheap *heap;			/* indexes of nodes with a look-ahead row */
+	int			last;			/* node returned by the last call, or -1 */
+	bool		outer_done;		/* RemoteQuery returned all its rows */
+	int			nkeys;
+	SortSupport sortkeys;
+} RemoteMergeState;
+
+static RemoteMergeState *remote_merge_begin(SortState *node);
+static TupleTableSlot *remote_merge_next(SortState *node);
+static void remote_merge_fallback(SortState *node, TupleTableSlot *slot);
+static void remote_merge_end(RemoteMergeState *ms);
+#endif /* PGXC */
 
 
 /* ----------------------------------------------------------------
@@ -53,6 +106,28 @@ ExecSort(SortState *node)
 	dir = estate->es_direction;
 	tuplesortstate = (Tuplesortstate *) node->tuplesortstate;
 
+#ifdef PGXC
+	/*
+	 * Merge streams of rows which are already sorted by the nodes on the fly.
+	 * Only for the first scan: a rescan of RemoteQuery replays its rows from
+	 * a tuplestore which does not remember where they came from.
+	 */
+	if (!node->sort_Done &&
+		((Sort *) node->ss.ps.plan)->srt_start_merge &&
+		!node->randomAccess &&
+		!node->remotemerge_Done &&
+		IsA(outerPlanState(node), RemoteQueryState))
+	{
+		node->remotemergestate = (void *) remote_merge_begin(node);
+		node->remotemerge_Done = true;
+		node->sort_Done = true;
+		node->bounded_Done = node->bounded;
+		node->bound_Done = node->bound;
+	}
+	if (node->remotemergestate)
+		return remote_merge_next(node);
+#endif /* PGXC */
+
 	/*
 	 * If first time through, read all tuples from outer plan and pass them to
 	 * tuplesort.c. Subsequent calls just fetch tuples from tuplesort.
@@ -105,7 +180,7 @@ ExecSort(SortState *node)
 			if (TupIsNull(slot))
 				break;
 #ifdef PGXC
-			if (plannode->srt_start_merge)
+			if (plannode->srt_start_merge && !node->remotemerge_Done)
 				tuplesort_puttupleslotontape(tuplesortstate, slot);
 			else
 #endif /* PGXC */
@@ -179,6 +254,10 @@ ExecInitSort(Sort *node, EState *estate, int eflags)
 	sortstate->bounded = false;
 	sortstate->sort_Done = false;
 	sortstate->tuplesortstate = NULL;
+#ifdef PGXC
+	sortstate->remotemergestate = NULL;
+	sortstate->remotemerge_Done = false;
+#endif
 
 	/*
 	 * Miscellaneous initialization
@@ -242,6 +321,11 @@ ExecEndSort(SortState *node)
 	if (node->tuplesortstate != NULL)
 		tuplesort_end((Tuplesortstate *) node->tuplesortstate);
 	node->tuplesortstate = NULL;
+#ifdef PGXC
+	if (node->remotemergestate != NULL)
+		remote_merge_end((RemoteMergeState *) node->remotemergestate);
+	node->remotemergestate = NULL;
+#endif
 
 	/*
 	 * shut down the subplan
@@ -318,6 +402,14 @@ ExecReScanSort(SortState *node)
 		!node->randomAccess)
 	{
 		node->sort_Done = false;
+#ifdef PGXC
+		if (node->remotemergestate != NULL)
+		{
+			remote_merge_end((RemoteMergeState *) node->remotemergestate);
+			node->remotemergestate = NULL;
+		}
+		else
+#endif
 		tuplesort_end((Tuplesortstate *) node->tuplesortstate);
 		node->tuplesortstate = NULL;
 
@@ -331,3 +423,305 @@ ExecReScanSort(SortState *node)
 	else
 		tuplesort_rescan((Tuplesortstate *) node->tuplesortstate);
 }
+
+#ifdef PGXC
+/*
+ * Compare the look-ahead rows of two nodes, see heap_compare_slots() of
+ * nodeMergeAppend.c.
+ */
+static int32
+remote_merge_compare(Datum a, Datum b, void *arg)
+{
+	RemoteMergeState *ms = (RemoteMergeState *) arg;
+	TupleTableSlot *s1 = ms->nodes[DatumGetInt32(a)].slot;
+	TupleTableSlot *s2 = ms->nodes[DatumGetInt32(b)].slot;
+	int			nkey;
+
+	Assert(!TupIsNull(s1));
+	Assert(!TupIsNull(s2));
+
+	for (nkey = 0; nkey < ms->nkeys; nkey++)
+	{
+		SortSupport sortKey = ms->sortkeys + nkey;
+		AttrNumber	attno = sortKey->ssup_attno;
+		Datum		datum1,
+					datum2;
+		bool		isNull1,
+					isNull2;
+		int			compare;
+
+		datum1 = slot_getattr(s1, attno, &isNull1);
+		datum2 = slot_getattr(s2, attno, &isNull2);
+
+		compare = ApplySortComparator(datum1, isNull1,
+									  datum2, isNull2,
+									  sortKey);
+		if (compare != 0)
+			return -compare;
+	}
+	return 0;
+}
+
+static RemoteMergeState *
+remote_merge_begin(SortState *node)
+{
+	Sort	   *plannode = (Sort *) node->ss.ps.plan;
+	RemoteMergeState *ms;
+	int			i;
+
+	ms = (RemoteMergeState *) palloc0(sizeof(RemoteMergeState));
+	ms->combiner = (RemoteQueryState *) outerPlanState(node);
+	ms->tupDesc = ExecGetResultType(outerPlanState(node));
+	ms->maxnodes = Max(NumDataNodes + NumCoords, 1);
+	ms->nodes = (RemoteMergeNode *) palloc0(ms->maxnodes * sizeof(RemoteMergeNode));
+	ms->heap = binaryheap_allocate(ms->maxnodes, remote_merge_compare, ms);
+	ms->last = -1;
+
+	ms->nkeys = plannode->numCols;
+	ms->sortkeys = palloc0(sizeof(SortSupportData) * plannode->numCols);
+	for (i = 0; i < plannode->numCols; i++)
+	{
+		SortSupport sortKey = ms->sortkeys + i;
+
+		sortKey->ssup_cxt = CurrentMemoryContext;
+		sortKey->ssup_collation = plannode->collations[i];
+		sortKey->ssup_nulls_first = plannode->nullsFirst[i];
+		sortKey->ssup_attno = plannode->sortColIdx[i];
+
+		PrepareSortSupportFromOrderingOp(plannode->sortOperators[i], sortKey);
+	}
+
+	return ms;
+}
+
+/*
+ * Find the entry of the node, adding it if it was not seen yet.
+ */
+static int
+remote_merge_get_node(SortState *node, RemoteMergeState *ms, Oid nodeoid)
+{
+	RemoteMergeNode *mnode;
+	int			i;
+
+	for (i = 0; i < ms->nnodes; i++)
+	{
+		if (ms->nodes[i].nodeoid == nodeoid)
+			return i;
+	}
+
+	if (ms->nnodes == ms->maxnodes)
+	{
+		binaryheap *heap;
+
+		ms->maxnodes *= 2;
+		ms->nodes = (RemoteMergeNode *)
+			repalloc(ms->nodes, ms->maxnodes * sizeof(RemoteMergeNode));
+		heap = binaryheap_allocate(ms->maxnodes, remote_merge_compare, ms);
+		for (i = 0; i < ms->heap->bh_size; i++)
+			binaryheap_add_unordered(heap, ms->heap->bh_nodes[i]);
+		binaryheap_build(heap);
+		binaryheap_free(ms->heap);
+		ms->heap = heap;
+	}
+
+	mnode = &ms->nodes[ms->nnodes];
+	MemSet(mnode, 0, sizeof(*mnode));
+	mnode->nodeoid = nodeoid;
+	mnode->slot = ExecInitExtraTupleSlot(node->ss.ps.state);
+	ExecSetSlotDescriptor(mnode->slot, ms->tupDesc);
+
+	return ms->nnodes++;
+}
+
+/*
+ * Can the row on top of the heap be returned? It can if no more rows are
+ * going to come, or if every connection still delivering rows has got its
+ * look-ahead row in the heap and no row is waiting in the RemoteQuery.
+ */
+static bool
+remote_merge_ready(RemoteMergeState *ms)
+{
+	RemoteQueryState *combiner = ms->combiner;
+	int			i,
+				j;
+
+	if (ms->outer_done)
+		return true;
+
+	if (binaryheap_empty(ms->heap) ||
+		combiner->currentRow.msg != NULL ||
+		!RemoteRowBufferIsEmpty(&combiner->rowBuffer) ||
+		combiner->conn_count > ms->heap->bh_size)
+		return false;
+
+	for (i = 0; i < combiner->conn_count; i++)
+	{
+		Oid			nodeoid = combiner->connections[i]->nodeoid;
+
+		for (j = 0; j < ms->nnodes; j++)
+		{
+			if (ms->nodes[j].nodeoid == nodeoid)
+				break;
+		}
+		if (j == ms->nnodes || !ms->nodes[j].in_heap)
+			return false;
+	}
+
+	return true;
+}
+
+static TupleTableSlot *
+remote_merge_next(SortState *node)
+{
+	RemoteMergeState *ms = (RemoteMergeState *) node->remotemergestate;
+	PlanState  *outerNode = outerPlanState(node);
+	RemoteMergeNode *mnode;
+
+	/*
+	 * Replace the row returned last time by the next one of the same node,
+	 * if it has one queued already.
+	 */
+	if (ms->last >= 0)
+	{
+		mnode = &ms->nodes[ms->last];
+		Assert(mnode->in_heap &&
+			   DatumGetInt32(binaryheap_first(ms->heap)) == ms->last);
+		if (mnode->nqueued > 0)
+		{
+			if (!tuplestore_gettupleslot(mnode->queue, true, true, mnode->slot))
+				elog(ERROR, "lost row queued for node %u", mnode->nodeoid);
+			mnode->nqueued--;
+			tuplestore_trim(mnode->queue);
+			binaryheap_replace_first(ms->heap, Int32GetDatum(ms->last));
+		}
+		else
+		{
+			ExecClearTuple(mnode->slot);
+			mnode->in_heap = false;
+			(void) binaryheap_remove_first(ms->heap);
+		}
+		ms->last = -1;
+	}
+
+	/* Read rows until the smallest row is known */
+	while (!remote_merge_ready(ms))
+	{
+		TupleTableSlot *slot = ExecProcNode(outerNode);
+		int			i;
+
+		if (TupIsNull(slot))
+		{
+			ms->outer_done = true;
+			break;
+		}
+
+		/* can't tell which stream the row belongs to, sort the rest */
+		if (!OidIsValid(slot->tts_xcnodeoid))
+		{
+			remote_merge_fallback(node, slot);
+			slot = node->ss.ps.ps_ResultTupleSlot;
+			(void) tuplesort_gettupleslot((Tuplesortstate *) node->tuplesortstate,
+										  true, slot);
+			return slot;
+		}
+
+		i = remote_merge_get_node(node, ms, slot->tts_xcnodeoid);
+		mnode = &ms->nodes[i];
+		if (mnode->in_heap)
+		{
+			if (mnode->queue == NULL)
+			{
+				mnode->queue = tuplestore_begin_heap(false, false,
+													 Max(work_mem / Max(ms->maxnodes, 1), 64));
+				tuplestore_set_eflags(mnode->queue, 0);
+			}
+			tuplestore_puttupleslot(mnode->queue, slot);
+			mnode->nqueued++;
+		}
+		else
+		{
+			ExecCopySlot(mnode->slot, slot);
+			mnode->in_heap = true;
+			binaryheap_add(ms->heap, Int32GetDatum(i));
+		}
+	}
+
+	if (binaryheap_empty(ms->heap))
+		return ExecClearTuple(node->ss.ps.ps_ResultTupleSlot);
+
+	ms->last = DatumGetInt32(binaryheap_first(ms->heap));
+	return ms->nodes[ms->last].slot;
+}
+
+/*
+ * Switch from merging to tuplesort for the rows not returned yet, starting
+ * with "slot", when a row does not tell which node it came from.  The rows
+ * returned so far are still in order: each was no greater than the next row
+ * of every stream when it was returned, so no later row can sort before it.
+ */
+static void
+remote_merge_fallback(SortState *node, TupleTableSlot *slot)
+{
+	Sort	   *plannode = (Sort *) node->ss.ps.plan;
+	RemoteMergeState *ms = (RemoteMergeState *) node->remotemergestate;
+	Tuplesortstate *tuplesortstate;
+	int			i;
+
+	tuplesortstate = tuplesort_begin_heap(ms->tupDesc,
+										  plannode->numCols,
+										  plannode->sortColIdx,
+										  plannode->sortOperators,
+										  plannode->collations,
+										  plannode->nullsFirst,
+										  work_mem,
+										  node->randomAccess);
+	if (node->bounded)
+		tuplesort_set_bound(tuplesortstate, node->bound);
+
+	/* the look-ahead and queued rows of every stream */
+	for (i = 0; i < ms->nnodes; i++)
+	{
+		RemoteMergeNode *mnode = &ms->nodes[i];
+
+		if (mnode->in_heap)
+			tuplesort_puttupleslot(tuplesortstate, mnode->slot);
+		while (mnode->nqueued > 0)
+		{
+			if (!tuplestore_gettupleslot(mnode->queue, true, false, mnode->slot))
+				elog(ERROR, "lost row queued for node %u", mnode->nodeoid);
+			tuplesort_puttupleslot(tuplesortstate, mnode->slot);
+			mnode->nqueued--;
+		}
+	}
+
+	/* and everything not read yet */
+	while (!TupIsNull(slot))
+	{
+		tuplesort_puttupleslot(tuplesortstate, slot);
+		slot = ExecProcNode(outerPlanState(node));
+	}
+
+	tuplesort_performsort(tuplesortstate);
+
+	remote_merge_end(ms);
+	node->remotemergestate = NULL;
+	node->tuplesortstate = (void *) tuplesortstate;
+}
+
+static void
+remote_merge_end(RemoteMergeState *ms)
+{
+	int			i;
+
+	for (i = 0; i < ms->nnodes; i++)
+	{
+		ExecClearTuple(ms->nodes[i].slot);
+		if (ms->nodes[i].queue)
+			tuplestore_end(ms->nodes[i].queue);
+	}
+	binaryheap_free(ms->heap);
+	pfree(ms->nodes);
+	pfree(ms->sortkeys);
+	pfree(ms);
+}
+#endif /* PGXC */
@@ -32,15 +32,37 @@
 #include "storage/bufmgr.h"
 #include "utils/array.h"
 #include "utils/rel.h"
+#ifdef ADB
+#include "pgxc/pgxc.h"
+#include "utils/lsyscache.h"
+#endif
 
 
+#ifdef ADB
+#define IsRowIdVar(node)  \
+	((node) != NULL && \
+	 IsA((node), Var) && \
+	 ((Var *) (node))->varattno == ADB_RowIdAttributeNumber && \
+	 ((Var *) (node))->varlevelsup == 0)
+
+#define IsCTIDVar(node)  \
+	((node) != NULL && \
+	 IsA((node), Var) && \
+	 (((Var *) (node))->varattno == SelfItemPointerAttributeNumber || \
+	  ((Var *) (node))->varattno == ADB_RowIdAttributeNumber) && \
+	 ((Var *) (node))->varlevelsup == 0)
+#else
 #define IsCTIDVar(node)  \
 	((node) != NULL && \
 	 IsA((node), Var) && \
 	 ((Var *) (node))->varattno == SelfItemPointerAttributeNumber && \
 	 ((Var *) (node))->varlevelsup == 0)
+#endif
 
 static void TidListCreate(TidScanState *tidstate);
+#ifdef ADB
+static bool RowIdGetLocalTid(Datum rowid, ItemPointer tid);
+#endif
 static int	itemptr_comparator(const void *a, const void *b);
 static TupleTableSlot *TidNext(TidScanState *node);
 
@@ -87,12 +109,19 @@ TidListCreate(TidScanState *tidstate)
 		Expr	   *expr = exstate->expr;
 		ItemPointer itemptr;
 		bool		isNull;
+#ifdef ADB
+		ItemPointerData rowid_tid;
+#endif
 
 		if (is_opclause(expr))
 		{
 			FuncExprState *fexstate = (FuncExprState *) exstate;
 			Node	   *arg1;
 			Node	   *arg2;
+#ifdef ADB
+			Datum		value;
+			bool		is_rowid;
+#endif
 
 			arg1 = get_leftop(expr);
 			arg2 = get_rightop(expr);
@@ -103,12 +132,27 @@ TidListCreate(TidScanState *tidstate)
 			else
 				elog(ERROR, "could not identify CTID variable");
 
+#ifdef ADB
+			is_rowid = IsRowIdVar(arg1) || IsRowIdVar(arg2);
+			value = ExecEvalExprSwitchContext(exstate,
+											  econtext,
+											  &isNull,
+											  NULL);
+			if (isNull)
+				itemptr = NULL;
+			else if (is_rowid)
+				itemptr = RowIdGetLocalTid(value, &rowid_tid) ? &rowid_tid : NULL;
+			else
+				itemptr = (ItemPointer) DatumGetPointer(value);
+			if (itemptr != NULL &&
+#else
 			itemptr = (ItemPointer)
 				DatumGetPointer(ExecEvalExprSwitchContext(exstate,
 														  econtext,
 														  &isNull,
 														  NULL));
 			if (!isNull &&
+#endif
 				ItemPointerIsValid(itemptr) &&
 				ItemPointerGetBlockNumber(itemptr) < nblocks)
 			{
@@ -131,6 +175,11 @@ TidListCreate(TidScanState *tidstate)
 			bool	   *ipnulls;
 			int			ndatums;
 			int			i;
+#ifdef ADB
+			bool		is_rowid;
+
+			is_rowid = IsRowIdVar(linitial(((ScalarArrayOpExpr *) expr)->args));
+#endif
 
 			exstate = (ExprState *) lsecond(saexstate->fxprstate.args);
 			arraydatum = ExecEvalExprSwitchContext(exstate,
@@ -140,6 +189,20 @@ TidListCreate(TidScanState *tidstate)
 			if (isNull)
 				continue;
 			itemarray = DatumGetArrayTypeP(arraydatum);
+#ifdef ADB
+			if (is_rowid)
+			{
+				int16		typlen;
+				bool		typbyval;
+				char		typalign;
+
+				get_typlenbyvalalign(RIDOID, &typlen, &typbyval, &typalign);
+				deconstruct_array(itemarray,
+								  RIDOID, typlen, typbyval, typalign,
+								  &ipdatums, &ipnulls, &ndatums);
+			}
+			else
+#endif
 			deconstruct_array(itemarray,
 							  TIDOID, SizeOfIptrData, false, 's',
 							  &ipdatums, &ipnulls, &ndatums);
@@ -154,6 +217,15 @@ TidListCreate(TidScanState *tidstate)
 			{
 				if (!ipnulls[i])
 				{
+#ifdef ADB
+					if (is_rowid)
+					{
+						if (!RowIdGetLocalTid(ipdatums[i], &rowid_tid))
+							continue;
+						itemptr = &rowid_tid;
+					}
+					else
+#endif
 					itemptr = (ItemPointer) DatumGetPointer(ipdatums[i]);
 					if (ItemPointerIsValid(itemptr) &&
 						ItemPointerGetBlockNumber(itemptr) < nblocks)
@@ -217,6 +289,21 @@ TidListCreate(TidScanState *tidstate)
 	tidstate->tss_TidPtr = -1;
 }
 
+#ifdef ADB
+/*
+ * Set "tid" to the tuple "rowid" points to, if the row lives on this node.
+ * Rows of other nodes cannot be found here: return false for them.
+ */
+static bool
+RowIdGetLocalTid(Datum rowid, ItemPointer tid)
+{
+	if (rowid_get_node_id(rowid) != PGXCNodeIdentifier)
+		return false;
+	rowid_get_tid(rowid, tid);
+	return true;
+}
+#endif
+
 /*
  * qsort comparator for ItemPointerData items
  */
@@ -48,6 +48,7 @@
 #include "utils/acl.h"
 #include "utils/builtins.h"
 #include "utils/datum.h"
+#include "utils/fmgroids.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/syscache.h"
@@ -105,6 +106,7 @@ typedef struct WindowStatePerAggData
 {
 	/* Oids of transfer functions */
 	Oid			transfn_oid;
+	Oid			invtransfn_oid; /* may be InvalidOid */
 	Oid			finalfn_oid;	/* may be InvalidOid */
 
 	/*
@@ -113,6 +115,7 @@ typedef struct WindowStatePerAggData
 	 * flags are kept here.
 	 */
 	FmgrInfo	transfn;
+	FmgrInfo	invtransfn;
 	FmgrInfo	finalfn;
 
 	/*
@@ -145,14 +148,41 @@ typedef struct WindowStatePerAggData
 	bool		transValueIsNull;
 
 	bool		noTransValue;	/* true if transValue not set yet */
+	int64		transValueCount;	/* rows with no NULL input aggregated */
 } WindowStatePerAggData;
 
+/*
+ * Inverse transition functions of the built-in aggregates that can be
+ * evaluated over a moving frame.  An inverse function takes the same
+ * arguments as the transition function and removes a row that was added
+ * to the transition value.  Rows with a NULL input are never passed to it;
+ * the transition functions listed here ignore such rows as well.
+ */
+typedef struct WindowInverseTransFn
+{
+	Oid			transfn_oid;
+	Oid			invtransfn_oid;
+} WindowInverseTransFn;
+
+static const WindowInverseTransFn window_inverse_transfns[] = {
+	{F_INT8INC, F_INT8DEC},		/* count(*) */
+	{F_INT8INC_ANY, F_INT8DEC_ANY},		/* count(any) */
+	{F_INT2_SUM, F_INT82MI},	/* sum(int2) */
+	{F_INT4_SUM, F_INT84MI},	/* sum(int4) */
+	{F_INT2_AVG_ACCUM, F_INT2_AVG_ACCUM_INV},	/* avg(int2) */
+	{F_INT4_AVG_ACCUM, F_INT4_AVG_ACCUM_INV}	/* avg(int4) */
+};
+
 static void initialize_windowaggregate(WindowAggState *winstate,
 						   WindowStatePerFunc perfuncstate,
 						   WindowStatePerAgg peraggstate);
 static void advance_windowaggregate(WindowAggState *winstate,
 						WindowStatePerFunc perfuncstate,
 						WindowStatePerAgg peraggstate);
+static void retreat_windowaggregate(WindowAggState *winstate,
+						WindowStatePerFunc perfuncstate,
+						WindowStatePerAgg peraggstate);
+static void advance_aggheadpos(WindowAggState *winstate, int64 pos);
 static void finalize_windowaggregate(WindowAggState *winstate,
 						 WindowStatePerFunc perfuncstate,
 						 WindowStatePerAgg peraggstate,
@@ -207,6 +237,7 @@ initialize_windowaggregate(WindowAggState *winstate,
 	peraggstate->transValueIsNull = peraggstate->initValueIsNull;
 	peraggstate->noTransValue = peraggstate->initValueIsNull;
 	peraggstate->resultValueIsNull = true;
+	peraggstate->transValueCount = 0;
 }
 
 /*
@@ -225,6 +256,7 @@ advance_windowaggregate(WindowAggState *winstate,
 	Datum		newVal;
 	ListCell   *arg;
 	int			i;
+	bool		anynull = false;
 	MemoryContext oldContext;
 	ExprContext *econtext = winstate->tmpcontext;
 
@@ -238,22 +270,24 @@ advance_windowaggregate(WindowAggState *winstate,
 
 		fcinfo->arg[i] = ExecEvalExpr(argstate, econtext,
 									  &fcinfo->argnull[i], NULL);
+		anynull |= fcinfo->argnull[i];
 		i++;
 	}
 
+	/* retreat_windowaggregate needs to know when the frame empties */
+	if (!anynull)
+		peraggstate->transValueCount++;
+
 	if (peraggstate->transfn.fn_strict)
 	{
 		/*
 		 * For a strict transfn, nothing happens when there's a NULL input; we
 		 * just keep the prior transValue.
 		 */
-		for (i = 1; i <= numArguments; i++)
+		if (anynull)
 		{
-			if (fcinfo->argnull[i])
-			{
-				MemoryContextSwitchTo(oldContext);
-				return;
-			}
+			MemoryContextSwitchTo(oldContext);
+			return;
 		}
 		if (peraggstate->noTransValue)
 		{
@@ -323,6 +357,107 @@ advance_windowaggregate(WindowAggState *winstate,
 	peraggstate->transValueIsNull = fcinfo->isnull;
 }
 
+/*
+ * retreat_windowaggregate
+ *
+ * Remove the row in tmpcontext's outer tuple, which has left the frame, from
+ * the transition value with the aggregate's inverse transition function.
+ * Rows with a NULL input were not added, so there is nothing to remove for
+ * them; and once the last row that was added leaves, we simply start over
+ * from the initial value, which also takes care of aggregates whose result
+ * is NULL over an empty frame.
+ */
+static void
+retreat_windowaggregate(WindowAggState *winstate,
+						WindowStatePerFunc perfuncstate,
+						WindowStatePerAgg peraggstate)
+{
+	WindowFuncExprState *wfuncstate = perfuncstate->wfuncstate;
+	int			numArguments = perfuncstate->numArguments;
+	FunctionCallInfoData fcinfodata;
+	FunctionCallInfo fcinfo = &fcinfodata;
+	Datum		newVal;
+	ListCell   *arg;
+	int			i;
+	MemoryContext oldContext;
+	ExprContext *econtext = winstate->tmpcontext;
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	/* We start from 1, since the 0th arg will be the transition value */
+	i = 1;
+	foreach(arg, wfuncstate->args)
+	{
+		ExprState  *argstate = (ExprState *) lfirst(arg);
+
+		fcinfo->arg[i] = ExecEvalExpr(argstate, econtext,
+									  &fcinfo->argnull[i], NULL);
+		if (fcinfo->argnull[i])
+		{
+			MemoryContextSwitchTo(oldContext);
+			return;
+		}
+		i++;
+	}
+
+	Assert(peraggstate->transValueCount > 0);
+	if (peraggstate->transValueCount == 1)
+	{
+		MemoryContextSwitchTo(oldContext);
+		if (!peraggstate->transtypeByVal && !peraggstate->transValueIsNull)
+			pfree(DatumGetPointer(peraggstate->transValue));
+		initialize_windowaggregate(winstate, perfuncstate, peraggstate);
+		return;
+	}
+
+	if (peraggstate->transValueIsNull)
+		elog(ERROR, "aggregate %u has no transition value to remove a row from",
+			 perfuncstate->wfunc->winfnoid);
+
+	InitFunctionCallInfoData(*fcinfo, &(peraggstate->invtransfn),
+							 numArguments + 1,
+							 perfuncstate->winCollation,
+							 (void *) winstate, NULL);
+	fcinfo->arg[0] = peraggstate->transValue;
+	fcinfo->argnull[0] = false;
+	newVal = FunctionCallInvoke(fcinfo);
+	if (fcinfo->isnull)
+		elog(ERROR, "inverse transition function %u returned NULL",
+			 peraggstate->invtransfn_oid);
+
+	/* same handling of pass-by-ref values as in advance_windowaggregate */
+	if (!peraggstate->transtypeByVal &&
+		DatumGetPointer(newVal) != DatumGetPointer(peraggstate->transValue))
+	{
+		MemoryContextSwitchTo(winstate->aggcontext);
+		newVal = datumCopy(newVal,
+						   peraggstate->transtypeByVal,
+						   peraggstate->transtypeLen);
+		pfree(DatumGetPointer(peraggstate->transValue));
+	}
+
+	MemoryContextSwitchTo(oldContext);
+	peraggstate->transValue = newVal;
+	peraggstate->transValueCount--;
+}
+
+/*
+ * advance_aggheadpos
+ * move the read pointer for rows leaving the frame up to row pos
+ */
+static void
+advance_aggheadpos(WindowAggState *winstate, int64 pos)
+{
+	tuplestore_select_read_pointer(winstate->buffer, winstate->aggheadptr);
+	while (winstate->aggheadpos < pos)
+	{
+		/* the frame head may be past the end of the partition */
+		if (!tuplestore_advance(winstate->buffer, true))
+			break;
+		winstate->aggheadpos++;
+	}
+}
+
 /*
  * finalize_windowaggregate
  * parallel to finalize_aggregate in nodeAgg.c
@@ -399,6 +534,7 @@ eval_windowaggregates(WindowAggState *winstate)
 	ExprContext *econtext;
 	WindowObject agg_winobj;
 	TupleTableSlot *agg_row_slot;
+	bool		framemoved;
 
 	numaggs = winstate->numaggs;
 	if (numaggs == 0)
@@ -428,6 +564,11 @@ eval_windowaggregates(WindowAggState *winstate)
 	 * For other frame start rules, we discard the aggregate state and re-run
 	 * the aggregates whenever the frame head row moves.  We can still
 	 * optimize as above whenever successive rows share the same frame head.
+	 * And if every aggregate has an inverse transition function (see
+	 * window_inverse_transfns) and none of their arguments is volatile, we
+	 * instead remove the rows that left the frame from the transition values,
+	 * as long as the new frame head is not beyond the rows aggregated so far.
+	 * That makes a moving frame cost a constant amount of work per row.
 	 *
 	 * In many common cases, multiple rows share the same frame and hence the
 	 * same aggregate value. (In particular, if there's no ORDER BY in a RANGE
@@ -440,11 +581,8 @@ eval_windowaggregates(WindowAggState *winstate)
 	 * accumulated into the aggregate transition values.  Whenever we start a
 	 * new peer group, we accumulate forward to the end of the peer group.
 	 *
-	 * TODO: Rerunning aggregates from the frame start can be pretty slow. For
-	 * some aggregates like SUM and COUNT we could avoid that by implementing
-	 * a "negative transition function" that would be called for each row as
-	 * it exits the frame.  We'd have to think about avoiding recalculation of
-	 * volatile arguments of aggregate functions, too.
+	 * Rerunning aggregates from the frame start can still be pretty slow
+	 * for aggregates without an inverse transition function.
 	 */
 
 	/*
@@ -452,6 +590,48 @@ eval_windowaggregates(WindowAggState *winstate)
 	 */
 	update_frameheadpos(agg_winobj, winstate->temp_slot_1);
 
+	/*
+	 * If the frame head moved forward within the aggregated rows, try to
+	 * remove the rows that left the frame.
+	 */
+	framemoved = false;
+	if (winstate->aggsinvertible &&
+		winstate->currentpos != 0 &&
+		winstate->frameheadpos > winstate->aggregatedbase &&
+		winstate->frameheadpos <= winstate->aggregatedupto)
+	{
+		MemoryContext oldcontext;
+
+		/* agg_row_slot holds the row at aggregatedupto; refetch it later */
+		ExecClearTuple(agg_row_slot);
+		advance_aggheadpos(winstate, winstate->aggregatedbase);
+		while (winstate->aggheadpos < winstate->frameheadpos)
+		{
+			oldcontext = MemoryContextSwitchTo(econtext->ecxt_per_query_memory);
+			if (!tuplestore_gettupleslot(winstate->buffer, true, true,
+										 agg_row_slot))
+				elog(ERROR, "unexpected end of tuplestore");
+			MemoryContextSwitchTo(oldcontext);
+			winstate->aggheadpos++;
+
+			winstate->tmpcontext->ecxt_outertuple = agg_row_slot;
+			for (i = 0; i < numaggs; i++)
+			{
+				peraggstate = &winstate->peragg[i];
+				wfuncno = peraggstate->wfuncno;
+				retreat_windowaggregate(winstate,
+										&winstate->perfunc[wfuncno],
+										peraggstate);
+			}
+			ResetExprContext(winstate->tmpcontext);
+		}
+		ExecClearTuple(agg_row_slot);
+
+		WinSetMarkPosition(agg_winobj, winstate->frameheadpos);
+		winstate->aggregatedbase = winstate->frameheadpos;
+		framemoved = true;
+	}
+
 	/*
 	 * Initialize aggregates on first call for partition, or if the frame head
 	 * position moved since last time.
@@ -486,6 +666,10 @@ eval_windowaggregates(WindowAggState *winstate)
 		ExecClearTuple(agg_row_slot);
 		winstate->aggregatedbase = winstate->frameheadpos;
 		winstate->aggregatedupto = winstate->frameheadpos;
+
+		/* and let the rows before the frame be forgotten */
+		if (winstate->aggsinvertible)
+			advance_aggheadpos(winstate, winstate->frameheadpos);
 	}
 
 	/*
@@ -493,9 +677,11 @@ eval_windowaggregates(WindowAggState *winstate)
 	 * except when the frame head moves.  In END_CURRENT_ROW mode, we only
 	 * have to recalculate when the frame head moves or currentpos has
 	 * advanced past the place we'd aggregated up to.  Check for these cases
-	 * and if so, reuse the saved result values.
+	 * and if so, reuse the saved result values, unless rows have just been
+	 * removed from the frame.
 	 */
-	if ((winstate->frameOptions & (FRAMEOPTION_END_UNBOUNDED_FOLLOWING |
+	if (!framemoved &&
+		(winstate->frameOptions & (FRAMEOPTION_END_UNBOUNDED_FOLLOWING |
 								   FRAMEOPTION_END_CURRENT_ROW)) &&
 		winstate->aggregatedbase <= winstate->currentpos &&
 		winstate->aggregatedupto > winstate->currentpos)
@@ -728,6 +914,14 @@ begin_partition(WindowAggState *winstate)
 		agg_winobj->markpos = -1;
 		agg_winobj->seekpos = -1;
 
+		/* ... and one more to read the rows leaving the frame, if needed */
+		if (winstate->aggsinvertible)
+		{
+			winstate->aggheadptr = tuplestore_alloc_read_pointer(winstate->buffer,
+																 0);
+			winstate->aggheadpos = 0;
+		}
+
 		/* Also reset the row counters for aggregates */
 		winstate->aggregatedbase = 0;
 		winstate->aggregatedupto = 0;
@@ -1623,6 +1817,20 @@ ExecInitWindowAgg(WindowAgg *node, EState *estate, int eflags)
 	/* copy frame options to state node for easy access */
 	winstate->frameOptions = node->frameOptions;
 
+	/*
+	 * Rows can only leave the frame if its head is movable; see whether all
+	 * the aggregates are able to remove them.
+	 */
+	winstate->aggsinvertible =
+		(winstate->numaggs > 0 &&
+		 !(winstate->frameOptions & FRAMEOPTION_START_UNBOUNDED_PRECEDING));
+	for (aggno = 0; aggno < winstate->numaggs; aggno++)
+	{
+		if (!OidIsValid(winstate->peragg[aggno].invtransfn_oid))
+			winstate->aggsinvertible = false;
+	}
+	winstate->aggheadptr = -1;
+
 	/* initialize frame bound offset expressions */
 	winstate->startOffset = ExecInitExpr((Expr *) node->startOffset,
 										 (PlanState *) winstate);
@@ -1751,6 +1959,26 @@ initialize_peragg(WindowAggState *winstate, WindowFunc *wfunc,
 	peraggstate->transfn_oid = transfn_oid = aggform->aggtransfn;
 	peraggstate->finalfn_oid = finalfn_oid = aggform->aggfinalfn;
 
+	/*
+	 * Look for an inverse transition function.  Volatile arguments can't be
+	 * trusted to give the same values again when a row leaves the frame.
+	 */
+	peraggstate->invtransfn_oid = InvalidOid;
+	if (!contain_volatile_functions((Node *) wfunc->args))
+	{
+		for (i = 0; i < lengthof(window_inverse_transfns); i++)
+		{
+			if (window_inverse_transfns[i].transfn_oid == transfn_oid)
+			{
+				peraggstate->invtransfn_oid =
+					window_inverse_transfns[i].invtransfn_oid;
+				fmgr_info(peraggstate->invtransfn_oid,
+						  &peraggstate->invtransfn);
+				break;
+			}
+		}
+	}
+
 	/* Check that aggregate owner has permission to call component fns */
 	{
 		HeapTuple	procTuple;
@@ -7,8 +7,10 @@
 #include "access/xact.h"
 #include "agtm/agtm.h"
 #include "agtm/agtm_msg.h"
+#include "agtm/agtm_stats.h"
 #include "agtm/agtm_utils.h"
 #include "agtm/agtm_client.h"
+#include "agtm/agtm_xidcache.h"
 #include "agtm/agtm_transaction.h"
 #include "catalog/pg_type.h"
 #include "funcapi.h"
@@ -16,14 +18,44 @@
 #include "libpq/libpq-fe.h"
 #include "libpq/libpq-int.h"
 #include "libpq/pqformat.h"
+#include "pg_trace.h"
 #include "pgxc/pgxc.h"
 #include "storage/procarray.h"
 #include "utils/builtins.h"
+#include "utils/memutils.h"
 #include "utils/snapmgr.h"
+#include "utils/waitevent.h"
+
+bool enable_agtm_snapshot_compact = false;
+bool enable_agtm_snapshot_prefetch = false;
+
+/*
+ * Running xids of the last compact snapshot got from AGTM, sorted by
+ * agtm_sort_xids().  AGTM sends only the difference against it when we
+ * tell it we still hold snapshot "compact_base_id".
+ */
+static TransactionId *compact_base_xip = NULL;
+static uint32 compact_base_xcnt = 0;
+static uint32 compact_base_max = 0;
+static uint32 compact_base_id = 0;
+static TransactionId compact_base_xmin = InvalidTransactionId;
+
+/*
+ * Snapshot request sent by agtm_PrefetchGlobalSnapShot whose result was not
+ * used yet, and how it was asked for.
+ */
+static uint32 snapshot_prefetch_ticket = 0;
+static bool snapshot_prefetch_compact = false;
+static uint32 snapshot_prefetch_base = 0;
 
 static AGTM_Sequence agtm_DealSequence(const char *seqname, const char * database,
 								const char * schema, AGTM_MessageType type, AGTM_ResultType rtype);
 static PGresult* agtm_get_result(AGTM_MessageType msg_type);
+static WaitEvent agtm_wait_event(AGTM_MessageType msg_type);
+static uint32 agtm_result_bytes(PGresult *result);
+static void agtm_check_result_status(PGresult *result);
+static void agtm_get_compact_xip(StringInfo buf, Snapshot snapshot,
+								 uint32 request_base);
 static void agtm_send_message(AGTM_MessageType msg, const char *fmt, ...)
 			__attribute__((format(PG_PRINTF_ATTRIBUTE, 2, 3)));
 
@@ -308,12 +340,25 @@ agtm_GetTimestamptz(void)
 
 Snapshot
 agtm_GetGlobalSnapShot(Snapshot snapshot)
+{
+	return agtm_GetGlobalSnapShotTimestamp(snapshot, NULL);
+}
+
+/*
+ * same as agtm_GetGlobalSnapShot, also return the transaction start
+ * timestamp AGTM sent along with the snapshot if "timestamp" is not NULL.
+ */
+Snapshot
+agtm_GetGlobalSnapShotTimestamp(Snapshot snapshot, TimestampTz *timestamp)
 {
 	PGresult 	*res;
 	const char *str;
 	StringInfoData	buf;
 	uint32 xcnt;
 	TimestampTz	globalXactStartTimestamp;
+	bool		compact;
+	uint32		request_base;
+	AGTM_MessageType msg_type;
 
 	AssertArg(snapshot && snapshot->xip && snapshot->subxip);
 
@@ -321,30 +366,72 @@ agtm_GetGlobalSnapShot(Snapshot snapshot)
 		ereport(ERROR,
 			(errmsg("agtm_GetGlobalSnapShot function must under AGTM")));
 
-	agtm_send_message(AGTM_MSG_SNAPSHOT_GET, " ");
-	res = agtm_get_result(AGTM_MSG_SNAPSHOT_GET);
+	if (agtm_HaveSnapShotPrefetch())
+	{
+		uint32	ticket = snapshot_prefetch_ticket;
+		instr_time	start;
+
+		compact = snapshot_prefetch_compact;
+		request_base = snapshot_prefetch_base;
+		snapshot_prefetch_ticket = 0;
+		msg_type = compact ? AGTM_MSG_SNAPSHOT_GET_COMPACT : AGTM_MSG_SNAPSHOT_GET;
+		INSTR_TIME_SET_CURRENT(start);
+		TRACE_POSTGRESQL_AGTM_REQUEST_START(msg_type);
+		pgstat_report_wait_start(WAIT_EVENT_AGTM_SNAPSHOT);
+		res = agtm_TakePending(ticket);
+		pgstat_report_wait_end();
+		TRACE_POSTGRESQL_AGTM_REQUEST_DONE(msg_type, agtm_result_bytes(res));
+		AgtmStatsCountMessage(msg_type, 0, agtm_result_bytes(res), &start);
+		agtm_check_result_status(res);
+	} else
+	{
+		compact = enable_agtm_snapshot_compact;
+		request_base = compact_base_id;
+		if (compact)
+		{
+			msg_type = AGTM_MSG_SNAPSHOT_GET_COMPACT;
+			agtm_send_message(msg_type, "%d%d", (int)request_base, 4);
+		} else
+		{
+			msg_type = AGTM_MSG_SNAPSHOT_GET;
+			agtm_send_message(msg_type, " ");
+		}
+		res = agtm_get_result(msg_type);
+	}
 	Assert(res);
-	agtm_use_result_type(res, &buf, AGTM_SNAPSHOT_GET_RESULT);
+	agtm_use_result_type(res, &buf, compact ? AGTM_SNAPSHOT_GET_COMPACT_RESULT
+											: AGTM_SNAPSHOT_GET_RESULT);
 
 	pq_copymsgbytes(&buf, (char*)&(globalXactStartTimestamp), sizeof(globalXactStartTimestamp));
 	SetCurrentTransactionStartTimestamp(globalXactStartTimestamp);
+	if (timestamp)
+		*timestamp = globalXactStartTimestamp;
 	pq_copymsgbytes(&buf, (char*)&(RecentGlobalXmin), sizeof(RecentGlobalXmin));
 	pq_copymsgbytes(&buf, (char*)&(snapshot->xmin), sizeof(snapshot->xmin));
 	pq_copymsgbytes(&buf, (char*)&(snapshot->xmax), sizeof(snapshot->xmax));
-	xcnt = pq_getmsgint(&buf, sizeof(snapshot->xcnt));
-	EnlargeSnapshotXip(snapshot, xcnt);
-	snapshot->xcnt = xcnt;
-	pq_copymsgbytes(&buf, (char*)(snapshot->xip)
-		, sizeof(snapshot->xip[0]) * (snapshot->xcnt));
-	snapshot->subxcnt = pq_getmsgint(&buf, sizeof(snapshot->subxcnt));
-	str = pq_getmsgbytes(&buf, snapshot->subxcnt * sizeof(snapshot->subxip[0]));
-	snapshot->suboverflowed = pq_getmsgbyte(&buf);
-	if(snapshot->subxcnt > GetMaxSnapshotXidCount())
+	if (compact)
+	{
+		agtm_get_compact_xip(&buf, snapshot, request_base);
+		xcnt = agtm_get_varint(&buf);
+		EnlargeSnapshotSubxip(snapshot, xcnt);
+		snapshot->subxcnt = xcnt;
+		agtm_get_xid_list(&buf, snapshot->xmin, xcnt,
+						  snapshot->subxip, snapshot->subxcnt);
+		snapshot->suboverflowed = pq_getmsgbyte(&buf);
+	} else
 	{
-		snapshot->subxcnt = GetMaxSnapshotXidCount();
-		snapshot->suboverflowed = true;
+		xcnt = pq_getmsgint(&buf, sizeof(snapshot->xcnt));
+		EnlargeSnapshotXip(snapshot, xcnt);
+		snapshot->xcnt = xcnt;
+		pq_copymsgbytes(&buf, (char*)(snapshot->xip)
+			, sizeof(snapshot->xip[0]) * (snapshot->xcnt));
+		xcnt = pq_getmsgint(&buf, sizeof(snapshot->subxcnt));
+		str = pq_getmsgbytes(&buf, xcnt * sizeof(snapshot->subxip[0]));
+		snapshot->suboverflowed = pq_getmsgbyte(&buf);
+		EnlargeSnapshotSubxip(snapshot, xcnt);
+		snapshot->subxcnt = xcnt;
+		memcpy(snapshot->subxip, str, sizeof(snapshot->subxip[0]) * snapshot->subxcnt);
 	}
-	memcpy(snapshot->subxip, str, sizeof(snapshot->subxip[0]) * snapshot->subxcnt);
 	snapshot->takenDuringRecovery = pq_getmsgbyte(&buf);
 	pq_copymsgbytes(&buf, (char*)&(snapshot->curcid), sizeof(snapshot->curcid));
 	pq_copymsgbytes(&buf, (char*)&(snapshot->active_count), sizeof(snapshot->active_count));
@@ -353,11 +440,166 @@ agtm_GetGlobalSnapShot(Snapshot snapshot)
 	agtm_use_result_end(&buf);
 	PQclear(res);
 
+	AgtmStatsCountSnapshot(snapshot->xcnt, snapshot->subxcnt);
+
 	if (GetCurrentCommandId(false) > snapshot->curcid)
 		snapshot->curcid = GetCurrentCommandId(false);
 	return snapshot;
 }
 
+/*
+ * Read the xip part of an AGTM_SNAPSHOT_GET_COMPACT_RESULT into "snapshot"
+ * and make it the base of the next request.  "request_base" is the base id
+ * the request was sent with, a difference against any other base cannot be
+ * applied.
+ */
+static void
+agtm_get_compact_xip(StringInfo buf, Snapshot snapshot, uint32 request_base)
+{
+	TransactionId  *removed;
+	TransactionId  *added;
+	uint32			snap_id;
+	uint32			nremoved;
+	uint32			nadded;
+	uint32			i, j, r, n;
+	char			kind;
+
+	snap_id = (uint32) pq_getmsgint(buf, 4);
+	kind = pq_getmsgbyte(buf);
+
+	if (compact_base_xip == NULL)
+	{
+		compact_base_max = 64;
+		compact_base_xip = MemoryContextAlloc(TopMemoryContext,
+								compact_base_max * sizeof(TransactionId));
+	}
+
+	if (kind == 'F')
+	{
+		n = agtm_get_varint(buf);
+		EnlargeSnapshotXip(snapshot, n);
+		agtm_get_xid_list(buf, snapshot->xmin, n, snapshot->xip, n);
+	} else if (kind == 'D' && compact_base_id != 0 &&
+			   compact_base_id == request_base)
+	{
+		nremoved = agtm_get_varint(buf);
+		removed = palloc(Max(nremoved, 1) * sizeof(TransactionId));
+		agtm_get_xid_list(buf, compact_base_xmin, nremoved, removed, nremoved);
+		nadded = agtm_get_varint(buf);
+		added = palloc(Max(nadded, 1) * sizeof(TransactionId));
+		agtm_get_xid_list(buf, snapshot->xmin, nadded, added, nadded);
+
+		if (nremoved > compact_base_xcnt)
+		{
+			compact_base_id = 0;
+			ereport(ERROR,
+					(errcode(ERRCODE_PROTOCOL_VIOLATION),
+					 errmsg("invalid snapshot difference from AGTM")));
+		}
+		EnlargeSnapshotXip(snapshot, compact_base_xcnt - nremoved + nadded);
+
+		/* (base - removed) + added, keeping the result sorted */
+		i = j = r = n = 0;
+		while (i < compact_base_xcnt || j < nadded)
+		{
+			if (j >= nadded ||
+				(i < compact_base_xcnt &&
+				 agtm_xid_cmp(compact_base_xip[i], added[j]) < 0))
+			{
+				if (r < nremoved && compact_base_xip[i] == removed[r])
+					++r;
+				else
+					snapshot->xip[n++] = compact_base_xip[i];
+				++i;
+			} else
+			{
+				snapshot->xip[n++] = added[j++];
+			}
+		}
+		pfree(removed);
+		pfree(added);
+
+		if (r != nremoved)
+		{
+			compact_base_id = 0;
+			ereport(ERROR,
+					(errcode(ERRCODE_PROTOCOL_VIOLATION),
+					 errmsg("invalid snapshot difference from AGTM")));
+		}
+	} else
+	{
+		compact_base_id = 0;
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg("invalid compact snapshot kind \"%c\" from AGTM", kind)));
+	}
+	snapshot->xcnt = n;
+
+	if (n > compact_base_max)
+	{
+		compact_base_max = n;
+		compact_base_xip = repalloc(compact_base_xip,
+									compact_base_max * sizeof(TransactionId));
+	}
+	memcpy(compact_base_xip, snapshot->xip, n * sizeof(TransactionId));
+	compact_base_xcnt = n;
+	compact_base_xmin = snapshot->xmin;
+	compact_base_id = snap_id;
+}
+
+/*
+ * Send a snapshot request to AGTM without waiting for its result, the next
+ * agtm_GetGlobalSnapShot() takes that result instead of asking again.  The
+ * AGTM round-trip then overlaps with whatever the caller does meanwhile,
+ * typically parsing and planning the statement.
+ *
+ * The snapshot is taken by AGTM after this call, so it is good enough for
+ * any snapshot the current statement needs, but not for later statements:
+ * caller must use agtm_DropSnapShotPrefetch() when the statement ends.
+ */
+void
+agtm_PrefetchGlobalSnapShot(void)
+{
+	AGTM_MessageType msg_type;
+
+	if (!IsUnderAGTM())
+		return;
+
+	agtm_DropSnapShotPrefetch();
+
+	snapshot_prefetch_compact = enable_agtm_snapshot_compact;
+	snapshot_prefetch_base = compact_base_id;
+	if (snapshot_prefetch_compact)
+	{
+		msg_type = AGTM_MSG_SNAPSHOT_GET_COMPACT;
+		agtm_send_message(msg_type, "%d%d", (int)snapshot_prefetch_base, 4);
+	} else
+	{
+		msg_type = AGTM_MSG_SNAPSHOT_GET;
+		agtm_send_message(msg_type, " ");
+	}
+	snapshot_prefetch_ticket = agtm_AddPending(msg_type);
+	agtm_Flush();
+}
+
+bool
+agtm_HaveSnapShotPrefetch(void)
+{
+	return snapshot_prefetch_ticket != 0 &&
+		   agtm_IsPending(snapshot_prefetch_ticket);
+}
+
+/* forget an unused prefetched snapshot, never throws */
+void
+agtm_DropSnapShotPrefetch(void)
+{
+	if (snapshot_prefetch_ticket != 0)
+	{
+		agtm_DropPending(snapshot_prefetch_ticket);
+		snapshot_prefetch_ticket = 0;
+	}
+}
+
 XidStatus
 agtm_TransactionIdGetStatus(TransactionId xid, XLogRecPtr *lsn)
 {
@@ -369,6 +611,9 @@ agtm_TransactionIdGetStatus(TransactionId xid, XLogRecPtr *lsn)
 		ereport(ERROR,
 			(errmsg("agtm_TransactionIdGetStatus function must under AGTM")));
 
+	if (AgtmXidCacheLookup(xid, &xid_status, lsn))
+		return xid_status;
+
 	agtm_send_message(AGTM_MSG_GET_XACT_STATUS, "%d%d", (int)xid, (int)sizeof(xid));
 	res = agtm_get_result(AGTM_MSG_GET_XACT_STATUS);
 	Assert(res);
@@ -381,6 +626,9 @@ agtm_TransactionIdGetStatus(TransactionId xid, XLogRecPtr *lsn)
 
 	agtm_use_result_end(&buf);
 	PQclear(res);
+
+	AgtmXidCacheStore(xid, xid_status, *lsn);
+
 	return xid_status;
 }
 
@@ -507,6 +755,54 @@ agtm_GetSeqNextVal(const char *seqname, const char * database,	const char * sche
 			, AGTM_SEQUENCE_GET_NEXT_RESULT);
 }
 
+/*
+ * get a block of "range" sequence values from AGTM, returns the first one
+ * and the last one in "*last"
+ */
+AGTM_Sequence
+agtm_GetSeqNextRange(const char *seqname, const char * database,
+			const char * schema, int64 range, AGTM_Sequence *last)
+{
+	PGresult		*res;
+	StringInfoData	buf;
+	AGTM_Sequence	seq;
+
+	int				seqNameSize;
+	int 			databaseSize;
+	int				schemaSize;
+
+	Assert(seqname != NULL && database != NULL && schema != NULL);
+	Assert(range > 0 && last != NULL);
+
+	if(!IsUnderAGTM())
+		ereport(ERROR,
+			(errmsg("agtm_GetSeqNextRange function must under AGTM")));
+
+	seqNameSize = strlen(seqname);
+	databaseSize = strlen(database);
+	schemaSize = strlen(schema);
+
+	agtm_send_message(AGTM_MSG_SEQUENCE_GET_RANGE,
+					"%d%d %p%d %d%d %p%d %d%d %p%d" INT64_FORMAT,
+					seqNameSize, 4,
+					seqname, seqNameSize,
+					databaseSize, 4,
+					database, databaseSize,
+					schemaSize, 4,
+					schema, schemaSize,
+					range);
+
+	res = agtm_get_result(AGTM_MSG_SEQUENCE_GET_RANGE);
+	Assert(res);
+	agtm_use_result_type(res, &buf, AGTM_SEQUENCE_GET_RANGE_RESULT);
+	pq_copymsgbytes(&buf, (char*)&seq, sizeof(seq));
+	pq_copymsgbytes(&buf, (char*)last, sizeof(*last));
+
+	agtm_use_result_end(&buf);
+	PQclear(res);
+	return seq;
+}
+
 AGTM_Sequence 
 agtm_GetSeqCurrVal(const char *seqname, const char * database,	const char * schema)
 {
@@ -602,8 +898,12 @@ static void agtm_send_message(AGTM_MessageType msg, const char *fmt, ...)
 	/* get connection */
 	conn = getAgtmConnection();
 
-	/* start message */
-	if(PQsendQueryStart(conn) == false
+	/*
+	 * start message, libpq thinks the connection is busy while results of
+	 * pipelined requests are still on the way
+	 */
+	if((agtm_HavePending() ? PQstatus(conn) != CONNECTION_OK
+						   : PQsendQueryStart(conn) == false)
 		|| pqPutMsgStart('A', true, conn) < 0)
 	{
 		pqHandleSendFailure(conn);
@@ -695,6 +995,10 @@ static void agtm_send_message(AGTM_MessageType msg, const char *fmt, ...)
 	}
 	va_end(args);
 
+	/* the message type byte, then the length word and the contents */
+	AgtmStatsCountMessage(msg, (uint32) (conn->outMsgEnd - conn->outMsgStart + 1),
+						  0, NULL);
+
 	if(pqPutMsgEnd(conn) < 0)
 	{
 		pqHandleSendFailure(conn);
@@ -725,8 +1029,23 @@ static PGresult* agtm_get_result(AGTM_MessageType msg_type)
 {
 	PGconn *conn;
 	PGresult *result;
-	ExecStatusType state;
 	int res;
+	instr_time start;
+
+	INSTR_TIME_SET_CURRENT(start);
+	TRACE_POSTGRESQL_AGTM_REQUEST_START(msg_type);
+	pgstat_report_wait_start(agtm_wait_event(msg_type));
+
+	/* results of requests sent before this one come first */
+	if (agtm_HavePending())
+	{
+		result = agtm_TakePending(agtm_AddPending(msg_type));
+		pgstat_report_wait_end();
+		TRACE_POSTGRESQL_AGTM_REQUEST_DONE(msg_type, agtm_result_bytes(result));
+		AgtmStatsCountMessage(msg_type, 0, agtm_result_bytes(result), &start);
+		agtm_check_result_status(result);
+		return result;
+	}
 
 	conn = getAgtmConnection();
 
@@ -749,6 +1068,57 @@ static PGresult* agtm_get_result(AGTM_MessageType msg_type)
 			(errmsg("read message from AGTM error:%s, message type:%s",
 			PQerrorMessage(conn), gtm_util_message_name(msg_type))));
 	}
+	pgstat_report_wait_end();
+	TRACE_POSTGRESQL_AGTM_REQUEST_DONE(msg_type, agtm_result_bytes(result));
+	AgtmStatsCountMessage(msg_type, 0, agtm_result_bytes(result), &start);
+
+	agtm_check_result_status(result);
+
+	return result;
+}
+
+/* Size of the answer of AGTM in "result", for the statistics */
+static uint32 agtm_result_bytes(PGresult *result)
+{
+	if (result == NULL || PQntuples(result) < 1 || PQnfields(result) < 1)
+		return 0;
+	return (uint32) PQgetlength(result, 0, 0);
+}
+
+/* The wait event of waiting for the answer to "msg_type" */
+static WaitEvent agtm_wait_event(AGTM_MessageType msg_type)
+{
+	switch (msg_type)
+	{
+		case AGTM_MSG_GET_GXID:
+		case AGTM_MSG_GXID_LIST:
+			return WAIT_EVENT_AGTM_GXID;
+		case AGTM_MSG_SNAPSHOT_GET:
+		case AGTM_MSG_SNAPSHOT_GET_COMPACT:
+			return WAIT_EVENT_AGTM_SNAPSHOT;
+		case AGTM_MSG_GET_TIMESTAMP:
+			return WAIT_EVENT_AGTM_TIMESTAMP;
+		case AGTM_MSG_SEQUENCE_INIT:
+		case AGTM_MSG_SEQUENCE_ALTER:
+		case AGTM_MSG_SEQUENCE_DROP:
+		case AGTM_MSG_SEQUENCE_DROP_BYDB:
+		case AGTM_MSG_SEQUENCE_RENAME:
+		case AGTM_MSG_SEQUENCE_RENAME_BYDB:
+		case AGTM_MSG_SEQUENCE_GET_NEXT:
+		case AGTM_MSG_SEQUENCE_GET_CUR:
+		case AGTM_MSG_SEQUENCE_GET_LAST:
+		case AGTM_MSG_SEQUENCE_SET_VAL:
+		case AGTM_MSG_SEQUENCE_GET_RANGE:
+			return WAIT_EVENT_AGTM_SEQUENCE;
+		default:
+			break;
+	}
+	return WAIT_EVENT_AGTM_TRANSACTION;
+}
+
+static void agtm_check_result_status(PGresult *result)
+{
+	ExecStatusType state;
 
 	state = PQresultStatus(result);
 	if(state == PGRES_FATAL_ERROR)
@@ -758,8 +1128,6 @@ static PGresult* agtm_get_result(AGTM_MessageType msg_type)
 	{
 		ereport(ERROR, (errmsg("AGTM result a \"%s\" message", PQresStatus(state))));
 	}
-
-	return result;
 }
 
 
@@ -10,6 +10,7 @@
 #include "pgxc/pgxc.h"
 #include "storage/ipc.h"
 #include "utils/guc.h"
+#include "utils/waitevent.h"
 
 #define FAILED 0
 #define SUCESS 1
@@ -218,10 +219,15 @@ agtm_node_send_query(const char *query)
 			(errmsg("Failt to get agtm connection(return NULL pointer)!"),
 			 errhint("query is: %s", query)));
 
+	/* PQexec can not see results of pipelined requests, read them first */
+	pgstat_report_wait_start(WAIT_EVENT_AGTM_TRANSACTION);
+	agtm_ReadPending();
+
 	if (NULL == (results = PQexec(agtm_conn,query)))
 		ereport(ERROR,
 			(errmsg("Failt to PQexec command(PGresult is NULL)"),
 			 errhint("query is: %s", query)));
+	pgstat_report_wait_end();
 
 	OK = AgtmProcessResult(&results);
 	PQclear(results);
@@ -0,0 +1,245 @@
+/*-------------------------------------------------------------------------
+ *
+ * agtm_broker.c
+ *
+ *	  Coordinator side AGTM snapshot broker.
+ *
+ * Every master-coordinator backend normally asks AGTM for its own global
+ * snapshot.  Under OLTP load most of those requests are issued while
+ * another backend on the same coordinator is already waiting for an
+ * identical answer.  The broker merges them: the first backend to arrive
+ * becomes the leader and performs the AGTM round-trip, every backend that
+ * arrived before the leader sent its request waits on AgtmBrokerLock and
+ * then copies the leader's snapshot out of shared memory.
+ *
+ * A snapshot taken after a backend asked for one is always good enough
+ * for that backend, so the only rule is that a follower must never use a
+ * snapshot whose AGTM request was sent before the follower arrived.  This
+ * is tracked with two generation counters, in the same spirit as the
+ * group flush done by XLogFlush().
+ *
+ * The snapshot only describes transactions known to AGTM, the caller
+ * still merges the local ProcArray in GetSnapshotData(), which covers the
+ * leader's own xid (AGTM never reports the requester's own xid).
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/libagtm/agtm_broker.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/transam.h"
+#include "access/twophase.h"
+#include "access/xact.h"
+#include "agtm/agtm.h"
+#include "agtm/agtm_broker.h"
+#include "miscadmin.h"
+#include "pgxc/nodemgr.h"
+#include "storage/lwlock.h"
+#include "storage/procarray.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "utils/snapmgr.h"
+
+typedef struct AgtmSnapshotBroker
+{
+	slock_t			mutex;			/* protects fetch_gen */
+	uint64			fetch_gen;		/* # of AGTM requests sent by leaders */
+
+	/* following fields are protected by AgtmBrokerLock */
+	uint64			valid_gen;		/* fetch_gen of the snapshot below */
+	TimestampTz		start_timestamp;
+	TransactionId	global_xmin;
+	TransactionId	xmin;
+	TransactionId	xmax;
+	uint32			xcnt;
+	int32			subxcnt;
+	bool			suboverflowed;
+	uint32			max_xcnt;		/* capacity of xip part of xids[] */
+	uint32			max_subxcnt;	/* capacity of subxip part of xids[] */
+	TransactionId	xids[1];		/* VARIABLE LENGTH ARRAY, xip then subxip */
+} AgtmSnapshotBroker;
+
+bool enable_agtm_snapshot_broker = false;
+
+static AgtmSnapshotBroker *SnapBroker = NULL;
+
+static uint32 broker_max_xcnt(void);
+static uint32 broker_max_subxcnt(void);
+static bool broker_copy_snapshot(Snapshot snapshot, uint64 need_gen);
+static void broker_publish_snapshot(Snapshot snapshot, TimestampTz timestamp,
+									uint64 gen);
+
+/*
+ * AGTM reports in-progress xids of every session of the cluster, each
+ * coordinator backend owns one of them.
+ */
+static uint32
+broker_max_xcnt(void)
+{
+	return (uint32) mul_size(add_size(MaxBackends, max_prepared_xacts),
+							 MaxCoords);
+}
+
+/* agtm_GetGlobalSnapShot() never keeps more subxids than this */
+static uint32
+broker_max_subxcnt(void)
+{
+	return (uint32) add_size(MaxBackends, max_prepared_xacts);
+}
+
+/* Report shared memory space needed by AgtmBrokerShmemInit */
+Size
+AgtmBrokerShmemSize(void)
+{
+	Size		size;
+
+	size = offsetof(AgtmSnapshotBroker, xids);
+	size = add_size(size, mul_size(sizeof(TransactionId),
+						add_size(broker_max_xcnt(), broker_max_subxcnt())));
+
+	return size;
+}
+
+/* Allocate and initialize snapshot broker shared memory */
+void
+AgtmBrokerShmemInit(void)
+{
+	bool		found;
+
+	SnapBroker = (AgtmSnapshotBroker *)
+		ShmemInitStruct("AGTM Snapshot Broker", AgtmBrokerShmemSize(), &found);
+
+	if (!found)
+	{
+		/* First time through, so initialize */
+		MemSet(SnapBroker, 0, offsetof(AgtmSnapshotBroker, xids));
+		SpinLockInit(&SnapBroker->mutex);
+		SnapBroker->max_xcnt = broker_max_xcnt();
+		SnapBroker->max_subxcnt = broker_max_subxcnt();
+	}
+}
+
+/*
+ * Copy the shared snapshot if it was requested from AGTM after generation
+ * "need_gen - 1" was, caller must hold AgtmBrokerLock.
+ */
+static bool
+broker_copy_snapshot(Snapshot snapshot, uint64 need_gen)
+{
+	volatile AgtmSnapshotBroker *broker = SnapBroker;
+
+	if (broker->valid_gen < need_gen)
+		return false;
+
+	SetCurrentTransactionStartTimestamp(broker->start_timestamp);
+	RecentGlobalXmin = broker->global_xmin;
+	snapshot->xmin = broker->xmin;
+	snapshot->xmax = broker->xmax;
+	EnlargeSnapshotXip(snapshot, broker->xcnt);
+	snapshot->xcnt = broker->xcnt;
+	memcpy(snapshot->xip, (TransactionId *) broker->xids,
+		   sizeof(TransactionId) * broker->xcnt);
+	snapshot->subxcnt = broker->subxcnt;
+	memcpy(snapshot->subxip,
+		   (TransactionId *) broker->xids + broker->max_xcnt,
+		   sizeof(TransactionId) * broker->subxcnt);
+	snapshot->suboverflowed = broker->suboverflowed;
+	snapshot->takenDuringRecovery = false;
+	snapshot->curcid = GetCurrentCommandId(false);
+	snapshot->active_count = 0;
+	snapshot->regd_count = 0;
+
+	return true;
+}
+
+/*
+ * Save the snapshot got from AGTM for followers, caller must hold
+ * AgtmBrokerLock in exclusive mode.
+ *
+ * A snapshot too large for the shared area is not published, followers
+ * will then request their own one from AGTM.
+ */
+static void
+broker_publish_snapshot(Snapshot snapshot, TimestampTz timestamp, uint64 gen)
+{
+	volatile AgtmSnapshotBroker *broker = SnapBroker;
+
+	if (snapshot->xcnt > broker->max_xcnt ||
+		snapshot->subxcnt > broker->max_subxcnt)
+		return;
+
+	broker->start_timestamp = timestamp;
+	broker->global_xmin = RecentGlobalXmin;
+	broker->xmin = snapshot->xmin;
+	broker->xmax = snapshot->xmax;
+	broker->xcnt = snapshot->xcnt;
+	memcpy((TransactionId *) broker->xids, snapshot->xip,
+		   sizeof(TransactionId) * snapshot->xcnt);
+	broker->subxcnt = snapshot->subxcnt;
+	memcpy((TransactionId *) broker->xids + broker->max_xcnt, snapshot->subxip,
+		   sizeof(TransactionId) * snapshot->subxcnt);
+	broker->suboverflowed = snapshot->suboverflowed;
+	broker->valid_gen = gen;
+}
+
+Snapshot
+agtm_GetBrokeredSnapShot(Snapshot snapshot)
+{
+	volatile AgtmSnapshotBroker *broker = SnapBroker;
+	uint64		need_gen;
+	uint64		my_gen;
+	TimestampTz	timestamp;
+
+	AssertArg(snapshot && snapshot->xip && snapshot->subxip);
+
+	if (broker == NULL)
+		return agtm_GetGlobalSnapShot(snapshot);
+
+	/*
+	 * Any AGTM request sent after this point gives a snapshot we can use.
+	 */
+	SpinLockAcquire(&broker->mutex);
+	need_gen = broker->fetch_gen + 1;
+	SpinLockRelease(&broker->mutex);
+
+	for (;;)
+	{
+		LWLockAcquire(AgtmBrokerLock, LW_SHARED);
+		if (broker_copy_snapshot(snapshot, need_gen))
+		{
+			LWLockRelease(AgtmBrokerLock);
+			return snapshot;
+		}
+		LWLockRelease(AgtmBrokerLock);
+
+		/*
+		 * Become the leader, or sleep until the current leader has got its
+		 * snapshot and check again whether that one is new enough.
+		 */
+		if (LWLockAcquireOrWait(AgtmBrokerLock, LW_EXCLUSIVE))
+			break;
+	}
+
+	/* somebody may have published a usable snapshot meanwhile */
+	if (broker_copy_snapshot(snapshot, need_gen))
+	{
+		LWLockRelease(AgtmBrokerLock);
+		return snapshot;
+	}
+
+	SpinLockAcquire(&broker->mutex);
+	my_gen = ++broker->fetch_gen;
+	SpinLockRelease(&broker->mutex);
+
+	/* an ERROR here releases AgtmBrokerLock through LWLockReleaseAll */
+	snapshot = agtm_GetGlobalSnapShotTimestamp(snapshot, &timestamp);
+	broker_publish_snapshot(snapshot, timestamp, my_gen);
+
+	LWLockRelease(AgtmBrokerLock);
+
+	return snapshot;
+}
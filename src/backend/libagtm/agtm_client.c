@@ -39,7 +39,14 @@ static bool				IsDefaultAGtmPortSave = false;
 		}									\
 	} while(0)
 
+/* tickets are never reused, even across reconnections */
+static uint32			agtm_next_ticket = 0;
+
 static void agtm_Connect(void);
+static int agtm_find_pending(uint32 ticket);
+static int agtm_find_result_end(PGconn *conn);
+static PGresult* agtm_read_next_result(PGconn *conn);
+static bool agtm_read_pending_upto(int index);
 
 static void
 agtm_Connect(void)
@@ -181,12 +188,21 @@ void agtm_Close(void)
 {
 	if (agtm_conn)
 	{
+		int i;
+
 		if(agtm_conn->pg_res)
 		{
 			PQclear(agtm_conn->pg_res);
 			agtm_conn->pg_res = NULL;
 		}
 
+		for (i = 0; i < agtm_conn->npending; i++)
+		{
+			if (agtm_conn->pending[i].res)
+				PQclear(agtm_conn->pending[i].res);
+		}
+		agtm_conn->npending = 0;
+
 		if (agtm_conn->pg_Conn)
 		{
 			PQfinish(agtm_conn->pg_Conn);
@@ -225,9 +241,27 @@ void agtm_Endmessage(StringInfo buf)
 
 }
 
+/*
+ * Push requests sent by agtm_send_message to AGTM without waiting for
+ * their results.
+ */
 void agtm_Flush(void)
 {
+	PGconn	*conn;
+	int		res;
 
+	if (agtm_conn == NULL)
+		return;
+
+	conn = agtm_conn->pg_Conn;
+	while((res=pqFlush(conn)) > 0)
+		; /* nothing todo */
+	if(res < 0)
+	{
+		pqHandleSendFailure(conn);
+		ereport(ERROR,
+			(errmsg("flush message to AGTM error:%s", PQerrorMessage(conn))));
+	}
 }
 
 PGconn*
@@ -382,3 +416,213 @@ check_agtm_port(int *newval, void **extra, GucSource source)
 	return true;
 }
 
+bool
+agtm_HavePending(void)
+{
+	return agtm_conn != NULL && agtm_conn->npending > 0;
+}
+
+bool
+agtm_IsPending(uint32 ticket)
+{
+	return agtm_find_pending(ticket) >= 0;
+}
+
+/*
+ * Register the request just sent by agtm_send_message, its result can be
+ * taken by agtm_TakePending using the returned ticket.  Results come back
+ * in the order the requests were sent, so later requests can be sent
+ * before the result of this one is read.
+ */
+uint32
+agtm_AddPending(AGTM_MessageType msg_type)
+{
+	AGTM_Pending *pending;
+
+	Assert(agtm_conn != NULL);
+
+	if (agtm_conn->npending >= AGTM_MAX_PENDING)
+		ereport(ERROR,
+			(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+			 errmsg("too many requests pending on AGTM connection")));
+
+	if (++agtm_next_ticket == 0)
+		++agtm_next_ticket;
+
+	pending = &agtm_conn->pending[agtm_conn->npending++];
+	pending->ticket = agtm_next_ticket;
+	pending->msg_type = msg_type;
+	pending->res = NULL;
+
+	return pending->ticket;
+}
+
+/*
+ * Return the result of request "ticket", reading the results of the
+ * requests sent before it on the way.  Caller must PQclear the result.
+ */
+PGresult*
+agtm_TakePending(uint32 ticket)
+{
+	PGresult	*res;
+	int			index;
+
+	index = agtm_find_pending(ticket);
+	if (index < 0)
+		ereport(ERROR,
+			(errcode(ERRCODE_INTERNAL_ERROR),
+			 errmsg("AGTM request %u is not pending", ticket)));
+
+	if (!agtm_read_pending_upto(index))
+		ereport(ERROR,
+			(errmsg("read message from AGTM error:%s, message type:%s",
+			PQerrorMessage(agtm_conn->pg_Conn),
+			gtm_util_message_name(agtm_conn->pending[index].msg_type))));
+
+	res = agtm_conn->pending[index].res;
+	--agtm_conn->npending;
+	memmove(&agtm_conn->pending[index], &agtm_conn->pending[index + 1],
+			(agtm_conn->npending - index) * sizeof(AGTM_Pending));
+
+	return res;
+}
+
+/*
+ * Read every result still on the way, the connection can then be used by
+ * plain libpq calls such as PQexec.
+ */
+void
+agtm_ReadPending(void)
+{
+	if (!agtm_HavePending())
+		return;
+
+	if (!agtm_read_pending_upto(agtm_conn->npending - 1))
+		ereport(ERROR,
+			(errmsg("read message from AGTM error:%s",
+			PQerrorMessage(agtm_conn->pg_Conn))));
+}
+
+/*
+ * Forget a request whose result is no longer wanted.  Never throws, the
+ * connection is closed if the result cannot be read.
+ */
+void
+agtm_DropPending(uint32 ticket)
+{
+	int		index;
+
+	index = agtm_find_pending(ticket);
+	if (index < 0)
+		return;
+
+	if (!agtm_read_pending_upto(index))
+	{
+		agtm_Close();
+		return;
+	}
+
+	PQclear(agtm_conn->pending[index].res);
+	--agtm_conn->npending;
+	memmove(&agtm_conn->pending[index], &agtm_conn->pending[index + 1],
+			(agtm_conn->npending - index) * sizeof(AGTM_Pending));
+}
+
+static int
+agtm_find_pending(uint32 ticket)
+{
+	int		i;
+
+	if (agtm_conn == NULL || ticket == 0)
+		return -1;
+
+	for (i = 0; i < agtm_conn->npending; i++)
+	{
+		if (agtm_conn->pending[i].ticket == ticket)
+			return i;
+	}
+
+	return -1;
+}
+
+/* read the results of pending requests 0 .. index, returns false on failure */
+static bool
+agtm_read_pending_upto(int index)
+{
+	int		i;
+
+	Assert(agtm_conn != NULL && index < agtm_conn->npending);
+
+	for (i = 0; i <= index; i++)
+	{
+		if (agtm_conn->pending[i].res != NULL)
+			continue;
+		agtm_conn->pending[i].res = agtm_read_next_result(agtm_conn->pg_Conn);
+		if (agtm_conn->pending[i].res == NULL)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Offset just behind the first ReadyForQuery message in the input buffer,
+ * or -1 if it has not been received completely yet.
+ */
+static int
+agtm_find_result_end(PGconn *conn)
+{
+	int		pos = conn->inStart;
+
+	while (conn->inEnd - pos >= 5)
+	{
+		char	id = conn->inBuffer[pos];
+		uint32	len;
+
+		memcpy(&len, conn->inBuffer + pos + 1, 4);
+		len = ntohl(len);
+		if (len < 4)
+			return conn->inEnd;		/* let libpq complain about it */
+		if ((uint32) (conn->inEnd - pos - 1) < len)
+			break;
+		pos += 1 + len;
+		if (id == 'Z')
+			return pos;
+	}
+
+	return -1;
+}
+
+/*
+ * Read the result of the oldest request whose result was not read yet.
+ *
+ * The results of later requests may already be in the input buffer, but
+ * pqParseInput3 drops any message arriving behind ReadyForQuery while the
+ * connection is idle, so only let it see the first result.
+ */
+static PGresult*
+agtm_read_next_result(PGconn *conn)
+{
+	PGresult	*res;
+	int			end;
+	int			saved_end;
+
+	while((end=pqFlush(conn)) > 0)
+		; /* nothing todo */
+	if(end < 0)
+		return NULL;
+
+	while ((end = agtm_find_result_end(conn)) < 0)
+	{
+		if (pqWait(true, false, conn) != 0 || pqReadData(conn) < 0)
+			return NULL;
+	}
+
+	saved_end = conn->inEnd;
+	conn->inEnd = end;
+	conn->asyncStatus = PGASYNC_BUSY;
+	res = PQexecFinish(conn);
+	conn->inEnd = saved_end;
+
+	return res;
+}
@@ -0,0 +1 @@
+/root/repo/src/agtm/main/agtm_stats.c
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/agtm/main/agtm_utils.c
\ No newline at end of file
@@ -0,0 +1,190 @@
+/*-------------------------------------------------------------------------
+ *
+ * agtm_xidcache.c
+ *
+ *	  Shared cache of final transaction status got from AGTM.
+ *
+ * A transaction which committed or aborted never changes its status
+ * again, so the answers of agtm_TransactionIdGetStatus() for such xids
+ * are kept in a direct mapped table in shared memory and looked up before
+ * asking AGTM.
+ *
+ * Readers take no lock, every slot carries a sequence counter (see
+ * storage/seqlock.h) and a torn read is a miss.  Writers of the same slot
+ * are serialized by a spinlock.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/libagtm/agtm_xidcache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "access/transam.h"
+#include "agtm/agtm_xidcache.h"
+#include "funcapi.h"
+#include "storage/seqlock.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+
+typedef struct AgtmXidCacheSlot
+{
+	slock_t			mutex;		/* serializes writers of this slot */
+	uint32			version;	/* odd while the slot is being written */
+	TransactionId	xid;
+	XidStatus		status;
+	XLogRecPtr		lsn;
+} AgtmXidCacheSlot;
+
+typedef struct AgtmXidCacheData
+{
+	uint32			nslots;
+	/* statistics, updated without any lock so only approximate */
+	uint64			hits;
+	uint64			misses;
+	uint64			stores;
+	AgtmXidCacheSlot slots[1];	/* VARIABLE LENGTH ARRAY */
+} AgtmXidCacheData;
+
+int agtm_xid_status_cache_size = 4096;
+
+static AgtmXidCacheData *XidCache = NULL;
+
+/* Report shared memory space needed by AgtmXidCacheShmemInit */
+Size
+AgtmXidCacheShmemSize(void)
+{
+	Size		size;
+
+	if (agtm_xid_status_cache_size <= 0)
+		return 0;
+
+	size = offsetof(AgtmXidCacheData, slots);
+	size = add_size(size, mul_size(sizeof(AgtmXidCacheSlot),
+								   agtm_xid_status_cache_size));
+
+	return size;
+}
+
+/* Allocate and initialize xid status cache shared memory */
+void
+AgtmXidCacheShmemInit(void)
+{
+	bool		found;
+	uint32		i;
+
+	if (agtm_xid_status_cache_size <= 0)
+		return;
+
+	XidCache = (AgtmXidCacheData *)
+		ShmemInitStruct("AGTM Xid Status Cache", AgtmXidCacheShmemSize(), &found);
+
+	if (!found)
+	{
+		/* First time through, so initialize */
+		MemSet(XidCache, 0, AgtmXidCacheShmemSize());
+		XidCache->nslots = (uint32) agtm_xid_status_cache_size;
+		for (i = 0; i < XidCache->nslots; i++)
+			SpinLockInit(&XidCache->slots[i].mutex);
+	}
+}
+
+/*
+ * Look for the final status of "xid", returns false if it is not cached.
+ */
+bool
+AgtmXidCacheLookup(TransactionId xid, XidStatus *status, XLogRecPtr *lsn)
+{
+	volatile AgtmXidCacheData *cache = XidCache;
+	volatile AgtmXidCacheSlot *slot;
+	uint32			version;
+	TransactionId	found_xid;
+	XidStatus		found_status;
+	XLogRecPtr		found_lsn;
+
+	if (cache == NULL || !TransactionIdIsNormal(xid))
+		return false;
+
+	slot = &cache->slots[xid % cache->nslots];
+
+	version = SeqLockReadBegin(&slot->version);
+	found_xid = slot->xid;
+	found_status = slot->status;
+	found_lsn = slot->lsn;
+
+	if (SeqLockReadRetry(&slot->version, version) || found_xid != xid)
+	{
+		cache->misses++;
+		return false;
+	}
+
+	cache->hits++;
+	*status = found_status;
+	if (lsn)
+		*lsn = found_lsn;
+	return true;
+}
+
+/*
+ * Remember the status of "xid", only a final one is worth it.
+ */
+void
+AgtmXidCacheStore(TransactionId xid, XidStatus status, XLogRecPtr lsn)
+{
+	volatile AgtmXidCacheData *cache = XidCache;
+	volatile AgtmXidCacheSlot *slot;
+
+	if (cache == NULL || !TransactionIdIsNormal(xid))
+		return;
+
+	if (status != TRANSACTION_STATUS_COMMITTED &&
+		status != TRANSACTION_STATUS_ABORTED)
+		return;
+
+	slot = &cache->slots[xid % cache->nslots];
+
+	SpinLockAcquire(&slot->mutex);
+	SeqLockWriteBegin(&slot->version);
+	slot->xid = xid;
+	slot->status = status;
+	slot->lsn = lsn;
+	SeqLockWriteEnd(&slot->version);
+	SpinLockRelease(&slot->mutex);
+
+	cache->stores++;
+}
+
+/*
+ * SQL function backing the pg_agtm_xid_status_cache view.
+ */
+Datum
+pg_agtm_xid_status_cache_stats(PG_FUNCTION_ARGS)
+{
+	volatile AgtmXidCacheData *cache = XidCache;
+	TupleDesc	tupdesc;
+	Datum		values[4];
+	bool		nulls[4];
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	MemSet(nulls, 0, sizeof(nulls));
+	if (cache == NULL)
+	{
+		values[0] = Int32GetDatum(0);
+		values[1] = Int64GetDatum(0);
+		values[2] = Int64GetDatum(0);
+		values[3] = Int64GetDatum(0);
+	} else
+	{
+		values[0] = Int32GetDatum((int32) cache->nslots);
+		values[1] = Int64GetDatum((int64) cache->hits);
+		values[2] = Int64GetDatum((int64) cache->misses);
+		values[3] = Int64GetDatum((int64) cache->stores);
+	}
+
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
@@ -76,6 +76,9 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#ifndef WIN32
+#include <sys/uio.h>
+#endif
 #include <netdb.h>
 #include <netinet/in.h>
 #ifdef HAVE_NETINET_TCP_H
@@ -92,6 +95,10 @@
 #include "libpq/ip.h"
 #include "libpq/libpq.h"
 #include "miscadmin.h"
+#ifdef ADB
+#include "pgxc/pgxc.h"
+#include "utils/pg_lzcompress.h"
+#endif
 #include "storage/ipc.h"
 #include "utils/guc.h"
 #include "utils/memutils.h"
@@ -110,11 +117,13 @@ static List *sock_paths = NIL;
 /*
  * Buffers for low-level I/O.
  *
- * The receive buffer is fixed size. Send buffer is usually 8k, but can be
+ * The receive buffer is fixed size. Send buffer is usually 32k, but can be
  * enlarged by pq_putmessage_noblock() if the message doesn't fit otherwise.
+ * Data which would not fit in the send buffer anyway is written straight
+ * from the caller's memory, see internal_putbytes().
  */
 
-#define PQ_SEND_BUFFER_SIZE 8192
+#define PQ_SEND_BUFFER_SIZE 32768
 #define PQ_RECV_BUFFER_SIZE 8192
 
 static char *PqSendBuffer;
@@ -133,6 +142,23 @@ static bool PqCommBusy;			/* busy sending data to the client */
 static bool PqCommReadingMsg;	/* in the middle of reading a message */
 static bool DoingCopyOut;		/* in old-protocol COPY OUT processing */
 
+#ifdef ADB
+/*
+ * The data rows sent to a Coordinator are gathered in PqCompressBuffer and
+ * sent as 'z' messages, each holding a block of messages compressed with
+ * pglz. The Coordinator puts the messages of a block back in place of it,
+ * see get_message().
+ */
+#define PQ_COMPRESS_BLOCK_SIZE	(64 * 1024)
+#define PQ_COMPRESS_MIN_SIZE	1024
+
+bool		enable_remote_compression = false;
+
+static StringInfoData PqCompressBuffer = {NULL, 0, 0, 0};
+static char *PqCompressOutput = NULL;
+static int	PqCompressOutputSize = 0;
+#endif
+
 
 /* Internal functions */
 static void socket_comm_reset(void);
@@ -145,6 +171,13 @@ static void socket_startcopyout(void);
 static void socket_endcopyout(bool errorAbort);
 static int	internal_putbytes(const char *s, size_t len);
 static int	internal_flush(void);
+static int	internal_send_failed(void);
+#ifndef WIN32
+static int	internal_flush_with(const char **s, size_t *len);
+#endif
+#ifdef ADB
+static int	internal_put_compressed(void);
+#endif
 
 #ifdef HAVE_UNIX_SOCKETS
 static int	Lock_AF_UNIX(char *unixSocketDir, char *unixSocketPath);
@@ -705,7 +738,7 @@ StreamConnection(pgsocket server_fd, Port *port)
 		 * This is a Win32 socket optimization.  The ideal size is 32k.
 		 * http://support.microsoft.com/kb/823764/EN-US/
 		 */
-		on = PQ_SEND_BUFFER_SIZE * 4;
+		on = 32768;
 		if (setsockopt(port->sock, SOL_SOCKET, SO_SNDBUF, (char *) &on,
 					   sizeof(on)) < 0)
 		{
@@ -1306,6 +1339,25 @@ internal_putbytes(const char *s, size_t len)
 {
 	size_t		amount;
 
+#ifndef WIN32
+	/*
+	 * Data at least as large as the buffer, and which does not fit in what
+	 * is left of it, is sent along with the pending output in one writev()
+	 * rather than copied through the buffer piece by piece.
+	 */
+	if (len >= (size_t) PqSendBufferSize &&
+		len > (size_t) (PqSendBufferSize - PqSendPointer)
+#ifdef USE_SSL
+		&& MyProcPort->ssl == NULL
+#endif
+		)
+	{
+		socket_set_nonblocking(false);
+		if (internal_flush_with(&s, &len))
+			return EOF;
+	}
+#endif
+
 	while (len > 0)
 	{
 		/* If buffer is full, then flush it out */
@@ -1342,6 +1394,13 @@ socket_flush(void)
 		return 0;
 	PqCommBusy = true;
 	socket_set_nonblocking(false);
+#ifdef ADB
+	if (internal_put_compressed())
+	{
+		PqCommBusy = false;
+		return EOF;
+	}
+#endif
 	res = internal_flush();
 	PqCommBusy = false;
 	return res;
@@ -1354,11 +1413,11 @@ socket_flush(void)
  * and the socket is in non-blocking mode), or EOF if trouble.
  * --------------------------------
  */
+static int	last_reported_send_errno = 0;
+
 static int
 internal_flush(void)
 {
-	static int	last_reported_send_errno = 0;
-
 	char	   *bufptr = PqSendBuffer + PqSendStart;
 	char	   *bufend = PqSendBuffer + PqSendPointer;
 
@@ -1383,35 +1442,7 @@ internal_flush(void)
 				return 0;
 			}
 
-			/*
-			 * Careful: an ereport() that tries to write to the client would
-			 * cause recursion to here, leading to stack overflow and core
-			 * dump!  This message must go *only* to the postmaster log.
-			 *
-			 * If a client disconnects while we're in the midst of output, we
-			 * might write quite a bit of data before we get to a safe query
-			 * abort point.  So, suppress duplicate log messages.
-			 */
-			if (errno != last_reported_send_errno)
-			{
-				last_reported_send_errno = errno;
-				ereport(COMMERROR,
-						(errcode_for_socket_access(),
-						 errmsg("could not send data to client: %m")));
-			}
-
-			/*
-			 * We drop the buffered data anyway so that processing can
-			 * continue, even though we'll probably quit soon. We also set a
-			 * flag that'll cause the next CHECK_FOR_INTERRUPTS to terminate
-			 * the connection.
-			 */
-			PqSendStart = PqSendPointer = 0;
-#ifndef AGTM
-			ClientConnectionLost = 1;
-#endif /* AGTM */
-			InterruptPending = 1;
-			return EOF;
+			return internal_send_failed();
 		}
 
 		last_reported_send_errno = 0;	/* reset after any successful send */
@@ -1423,6 +1454,107 @@ internal_flush(void)
 	return 0;
 }
 
+/*
+ * internal_send_failed - report a send failure, drop the pending output and
+ *		return EOF
+ */
+static int
+internal_send_failed(void)
+{
+	/*
+	 * Careful: an ereport() that tries to write to the client would
+	 * cause recursion to here, leading to stack overflow and core
+	 * dump!  This message must go *only* to the postmaster log.
+	 *
+	 * If a client disconnects while we're in the midst of output, we
+	 * might write quite a bit of data before we get to a safe query
+	 * abort point.  So, suppress duplicate log messages.
+	 */
+	if (errno != last_reported_send_errno)
+	{
+		last_reported_send_errno = errno;
+		ereport(COMMERROR,
+				(errcode_for_socket_access(),
+				 errmsg("could not send data to client: %m")));
+	}
+
+	/*
+	 * We drop the buffered data anyway so that processing can
+	 * continue, even though we'll probably quit soon. We also set a
+	 * flag that'll cause the next CHECK_FOR_INTERRUPTS to terminate
+	 * the connection.
+	 */
+	PqSendStart = PqSendPointer = 0;
+#ifndef AGTM
+	ClientConnectionLost = 1;
+#endif /* AGTM */
+	InterruptPending = 1;
+	return EOF;
+}
+
+#ifndef WIN32
+/* --------------------------------
+ *		internal_flush_with - flush pending output followed by *s
+ *
+ * The socket must be in blocking mode.  *s and *len are advanced past what
+ * got sent, which is everything unless the write would block.
+ * Returns 0 if OK, or EOF if trouble.
+ * --------------------------------
+ */
+static int
+internal_flush_with(const char **s, size_t *len)
+{
+	while (PqSendStart < PqSendPointer || *len > 0)
+	{
+		struct iovec iov[2];
+		int			iovcnt = 0;
+		ssize_t		r;
+		size_t		pending = PqSendPointer - PqSendStart;
+
+		if (pending > 0)
+		{
+			iov[iovcnt].iov_base = PqSendBuffer + PqSendStart;
+			iov[iovcnt].iov_len = pending;
+			iovcnt++;
+		}
+		if (*len > 0)
+		{
+			iov[iovcnt].iov_base = (char *) *s;
+			iov[iovcnt].iov_len = *len;
+			iovcnt++;
+		}
+
+		r = writev(MyProcPort->sock, iov, iovcnt);
+
+		if (r <= 0)
+		{
+			if (errno == EINTR)
+				continue;		/* Ok if we were interrupted */
+
+			/* leave the rest to the buffer, as internal_flush() would */
+			if (errno == EAGAIN ||
+				errno == EWOULDBLOCK)
+				return 0;
+
+			return internal_send_failed();
+		}
+
+		last_reported_send_errno = 0;	/* reset after any successful send */
+		if ((size_t) r < pending)
+		{
+			PqSendStart += r;
+			continue;
+		}
+		r -= pending;
+		PqSendStart = PqSendPointer = 0;
+		*s += r;
+		*len -= r;
+	}
+
+	return 0;
+}
+#endif
+
 /* --------------------------------
  *		socket_flush_if_writable- flush pending output if writable without blocking
  *
@@ -1435,7 +1567,7 @@ socket_flush_if_writable(void)
 	int			res;
 
 	/* Quick exit if nothing to do */
-	if (PqSendPointer == PqSendStart)
+	if (!socket_is_send_pending())
 		return 0;
 
 	/* No-op if reentrant call */
@@ -1446,6 +1578,13 @@ socket_flush_if_writable(void)
 	socket_set_nonblocking(true);
 
 	PqCommBusy = true;
+#ifdef ADB
+	if (internal_put_compressed())
+	{
+		PqCommBusy = false;
+		return EOF;
+	}
+#endif
 	res = internal_flush();
 	PqCommBusy = false;
 	return res;
@@ -1458,6 +1597,10 @@ socket_flush_if_writable(void)
 bool
 socket_is_send_pending(void)
 {
+#ifdef ADB
+	if (PqCompressBuffer.len > 0)
+		return true;
+#endif
 	return (PqSendStart < PqSendPointer);
 }
 
@@ -1500,6 +1643,36 @@ socket_putmessage(char msgtype, const char *s, size_t len)
 	if (DoingCopyOut || PqCommBusy)
 		return 0;
 	PqCommBusy = true;
+#ifdef ADB
+	if ((msgtype == 'D' || msgtype == 'd') && enable_remote_compression &&
+		IsConnFromCoord() && PG_PROTOCOL_MAJOR(FrontendProtocol) >= 3)
+	{
+		uint32		n32;
+
+		if (PqCompressBuffer.data == NULL)
+		{
+			MemoryContext oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+
+			initStringInfo(&PqCompressBuffer);
+			MemoryContextSwitchTo(oldcontext);
+		}
+
+		n32 = htonl((uint32) (len + 4));
+		appendStringInfoChar(&PqCompressBuffer, msgtype);
+		appendBinaryStringInfo(&PqCompressBuffer, (char *) &n32, 4);
+		appendBinaryStringInfo(&PqCompressBuffer, s, len);
+
+		if (PqCompressBuffer.len >= PQ_COMPRESS_BLOCK_SIZE &&
+			internal_put_compressed())
+			goto fail;
+		PqCommBusy = false;
+		return 0;
+	}
+
+	/* Other messages go after the rows already gathered */
+	if (internal_put_compressed())
+		goto fail;
+#endif
 	if (msgtype)
 		if (internal_putbytes(&msgtype, 1))
 			goto fail;
@@ -1521,6 +1694,65 @@ fail:
 	return EOF;
 }
 
+#ifdef ADB
+/* --------------------------------
+ *		internal_put_compressed - move the gathered data rows to the send
+ *			buffer, compressed when that saves space
+ *
+ *		returns 0 if OK, EOF if trouble
+ * --------------------------------
+ */
+static int
+internal_put_compressed(void)
+{
+	int			needed;
+	int			clen;
+	uint32		n32;
+	PGLZ_Header *dest;
+
+	if (PqCompressBuffer.len == 0)
+		return 0;
+
+	needed = PGLZ_MAX_OUTPUT(PqCompressBuffer.len);
+	if (PqCompressBuffer.len >= PQ_COMPRESS_MIN_SIZE &&
+		PqCompressOutputSize < needed)
+	{
+		if (PqCompressOutput)
+			pfree(PqCompressOutput);
+		PqCompressOutput = MemoryContextAlloc(TopMemoryContext, needed);
+		PqCompressOutputSize = needed;
+	}
+
+	dest = (PGLZ_Header *) PqCompressOutput;
+	if (PqCompressBuffer.len < PQ_COMPRESS_MIN_SIZE ||
+		!pglz_compress(PqCompressBuffer.data, PqCompressBuffer.len,
+					   dest, PGLZ_strategy_default))
+	{
+		/* Not worth it, send the rows as they are */
+		if (internal_putbytes(PqCompressBuffer.data, PqCompressBuffer.len))
+			return EOF;
+		resetStringInfo(&PqCompressBuffer);
+		return 0;
+	}
+
+	/* 'z', length, size of the block once uncompressed, pglz data */
+	clen = VARSIZE(dest) - sizeof(PGLZ_Header);
+	if (internal_putbytes("z", 1))
+		return EOF;
+	n32 = htonl((uint32) (4 + 4 + clen));
+	if (internal_putbytes((char *) &n32, 4))
+		return EOF;
+	n32 = htonl((uint32) PqCompressBuffer.len);
+	if (internal_putbytes((char *) &n32, 4))
+		return EOF;
+	if (internal_putbytes((char *) dest + sizeof(PGLZ_Header), clen))
+		return EOF;
+
+	resetStringInfo(&PqCompressBuffer);
+	return 0;
+}
+#endif
+
 /* --------------------------------
  *		socket_putmessage_noblock	- like pq_putmessage, but never blocks
  *
@@ -32,6 +32,7 @@
  * INTERFACE ROUTINES
  * Message assembly and output:
  *		pq_beginmessage - initialize StringInfo buffer
+ *		pq_beginmessage_reuse - initialize a StringInfo buffer kept across messages
  *		pq_sendbyte		- append a raw byte to a StringInfo buffer
  *		pq_sendint		- append a binary integer to a StringInfo buffer
  *		pq_sendint64	- append a binary 8-byte int to a StringInfo buffer
@@ -43,6 +44,7 @@
  *		pq_sendstring	- append a null-terminated text string (with conversion)
  *		pq_send_ascii_string - append a null-terminated text string (without conversion)
  *		pq_endmessage	- send the completed message to the frontend
+ *		pq_endmessage_reuse - send it, keeping the buffer for the next one
  * Note: it is also possible to append data to the StringInfo buffer using
  * the regular StringInfo routines, but this is discouraged since required
  * character set conversion may not occur.
@@ -96,6 +98,23 @@ pq_beginmessage(StringInfo buf, char msgtype)
 	buf->cursor = msgtype;
 }
 
+/* --------------------------------
+ *		pq_beginmessage_reuse	- initialize for sending a message, reusing
+ *			a buffer initialized once by the caller
+ *
+ * Saves a palloc and pfree per message for callers sending many of them,
+ * such as printtup.  The buffer is finished with pq_endmessage_reuse.
+ * --------------------------------
+ */
+void
+pq_beginmessage_reuse(StringInfo buf, char msgtype)
+{
+	resetStringInfo(buf);
+
+	/* see pq_beginmessage */
+	buf->cursor = msgtype;
+}
+
 /* --------------------------------
  *		pq_sendbyte		- append a raw byte to a StringInfo buffer
  * --------------------------------
@@ -349,6 +368,19 @@ pq_endmessage(StringInfo buf)
 	buf->data = NULL;
 }
 
+/* --------------------------------
+ *		pq_endmessage_reuse	- send the completed message to the frontend
+ *
+ * The data buffer is left alone, for the next pq_beginmessage_reuse.
+ * --------------------------------
+ */
+void
+pq_endmessage_reuse(StringInfo buf)
+{
+	/* msgtype was saved in cursor field */
+	(void) pq_putmessage(buf->cursor, buf->data, buf->len);
+}
+
 
 /* --------------------------------
  *		pq_begintypsend		- initialize for constructing a bytea result
@@ -89,6 +89,9 @@ _copyPlannedStmt(const PlannedStmt *from)
 	COPY_SCALAR_FIELD(hasModifyingCTE);
 	COPY_SCALAR_FIELD(canSetTag);
 	COPY_SCALAR_FIELD(transientPlan);
+#ifdef ADB
+	COPY_SCALAR_FIELD(hasMotion);
+#endif
 	COPY_NODE_FIELD(planTree);
 	COPY_NODE_FIELD(rtable);
 	COPY_NODE_FIELD(resultRelations);
@@ -359,6 +362,29 @@ _copySeqScan(const SeqScan *from)
 	return newnode;
 }
 
+#ifdef ADB
+/*
+ * _copySampleScan
+ */
+static SampleScan *
+_copySampleScan(const SampleScan *from)
+{
+	SampleScan *newnode = makeNode(SampleScan);
+
+	/*
+	 * copy node superclass fields
+	 */
+	CopyScanFields((const Scan *) from, (Scan *) newnode);
+
+	/*
+	 * copy remainder of node
+	 */
+	COPY_NODE_FIELD(tablesample);
+
+	return newnode;
+}
+#endif /* ADB */
+
 /*
  * _copyIndexScan
  */
@@ -1073,6 +1099,11 @@ _copyExecNodes(const ExecNodes *from)
 	COPY_SCALAR_FIELD(en_funcid);
 #endif
 	COPY_NODE_FIELD(en_expr);
+#ifdef ADB
+	COPY_SCALAR_FIELD(en_expr_array);
+	COPY_SCALAR_FIELD(en_expr_rowid);
+	COPY_SCALAR_FIELD(en_colocation);
+#endif
 	COPY_SCALAR_FIELD(en_relid);
 	COPY_SCALAR_FIELD(accesstype);
 	COPY_NODE_FIELD(en_dist_vars);
@@ -2129,6 +2160,9 @@ _copyRangeTblEntry(const RangeTblEntry *from)
 
 	COPY_SCALAR_FIELD(relid);
 	COPY_SCALAR_FIELD(relkind);
+#ifdef ADB
+	COPY_NODE_FIELD(tablesample);
+#endif
 	COPY_NODE_FIELD(subquery);
 	COPY_SCALAR_FIELD(security_barrier);
 	COPY_SCALAR_FIELD(jointype);
@@ -2458,6 +2492,34 @@ _copyRangeFunction(const RangeFunction *from)
 	return newnode;
 }
 
+#ifdef ADB
+static RangeTableSample *
+_copyRangeTableSample(const RangeTableSample *from)
+{
+	RangeTableSample *newnode = makeNode(RangeTableSample);
+
+	COPY_NODE_FIELD(relation);
+	COPY_STRING_FIELD(method);
+	COPY_NODE_FIELD(percent);
+	COPY_NODE_FIELD(repeatable);
+	COPY_LOCATION_FIELD(location);
+
+	return newnode;
+}
+
+static TableSampleClause *
+_copyTableSampleClause(const TableSampleClause *from)
+{
+	TableSampleClause *newnode = makeNode(TableSampleClause);
+
+	COPY_SCALAR_FIELD(method);
+	COPY_NODE_FIELD(percent);
+	COPY_NODE_FIELD(repeatable);
+
+	return newnode;
+}
+#endif /* ADB */
+
 static TypeCast *
 _copyTypeCast(const TypeCast *from)
 {
@@ -4529,6 +4591,11 @@ copyObject(const void *from)
 		case T_SeqScan:
 			retval = _copySeqScan(from);
 			break;
+#ifdef ADB
+		case T_SampleScan:
+			retval = _copySampleScan(from);
+			break;
+#endif
 		case T_IndexScan:
 			retval = _copyIndexScan(from);
 			break;
@@ -5212,6 +5279,11 @@ copyObject(const void *from)
 		case T_RangeFunction:
 			retval = _copyRangeFunction(from);
 			break;
+#ifdef ADB
+		case T_RangeTableSample:
+			retval = _copyRangeTableSample(from);
+			break;
+#endif
 		case T_TypeName:
 			retval = _copyTypeName(from);
 			break;
@@ -5233,6 +5305,11 @@ copyObject(const void *from)
 		case T_RangeTblEntry:
 			retval = _copyRangeTblEntry(from);
 			break;
+#ifdef ADB
+		case T_TableSampleClause:
+			retval = _copyTableSampleClause(from);
+			break;
+#endif
 		case T_SortGroupClause:
 			retval = _copySortGroupClause(from);
 			break;
@@ -583,6 +583,9 @@ BEGIN_ENUM(DistributionType)
 	ENUM_VALUE(DISTTYPE_MODULO)
 #ifdef ADB
 	ENUM_VALUE(DISTTYPE_USER_DEFINED)
+	ENUM_VALUE(DISTTYPE_BUCKET)
+	ENUM_VALUE(DISTTYPE_RANGE)
+	ENUM_VALUE(DISTTYPE_LIST)
 #endif /* ADB */
 END_ENUM(DistributionType)
 #endif /* NO_ENUM_DistributionType */
@@ -606,4 +609,11 @@ BEGIN_ENUM(ParseGrammar)
 END_ENUM(ParseGrammar)
 #endif /* NO_ENUM_ParseGram */
 
+#ifndef NO_ENUM_TableSampleMethod
+BEGIN_ENUM(TableSampleMethod)
+	ENUM_VALUE(TABLESAMPLE_SYSTEM)
+	ENUM_VALUE(TABLESAMPLE_BERNOULLI)
+END_ENUM(TableSampleMethod)
+#endif /* NO_ENUM_TableSampleMethod */
+
 #endif /* ADB */
\ No newline at end of file
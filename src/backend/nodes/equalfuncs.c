@@ -2198,6 +2198,30 @@ _equalRangeFunction(const RangeFunction *a, const RangeFunction *b)
 	return true;
 }
 
+#ifdef ADB
+static bool
+_equalRangeTableSample(const RangeTableSample *a, const RangeTableSample *b)
+{
+	COMPARE_NODE_FIELD(relation);
+	COMPARE_STRING_FIELD(method);
+	COMPARE_NODE_FIELD(percent);
+	COMPARE_NODE_FIELD(repeatable);
+	COMPARE_LOCATION_FIELD(location);
+
+	return true;
+}
+
+static bool
+_equalTableSampleClause(const TableSampleClause *a, const TableSampleClause *b)
+{
+	COMPARE_SCALAR_FIELD(method);
+	COMPARE_NODE_FIELD(percent);
+	COMPARE_NODE_FIELD(repeatable);
+
+	return true;
+}
+#endif /* ADB */
+
 static bool
 _equalIndexElem(const IndexElem *a, const IndexElem *b)
 {
@@ -2291,6 +2315,9 @@ _equalRangeTblEntry(const RangeTblEntry *a, const RangeTblEntry *b)
 	COMPARE_SCALAR_FIELD(rtekind);
 	COMPARE_SCALAR_FIELD(relid);
 	COMPARE_SCALAR_FIELD(relkind);
+#ifdef ADB
+	COMPARE_NODE_FIELD(tablesample);
+#endif
 	COMPARE_NODE_FIELD(subquery);
 	COMPARE_SCALAR_FIELD(security_barrier);
 	COMPARE_SCALAR_FIELD(jointype);
@@ -3173,6 +3200,11 @@ equal(const void *a, const void *b)
 		case T_RangeFunction:
 			retval = _equalRangeFunction(a, b);
 			break;
+#ifdef ADB
+		case T_RangeTableSample:
+			retval = _equalRangeTableSample(a, b);
+			break;
+#endif
 		case T_TypeName:
 			retval = _equalTypeName(a, b);
 			break;
@@ -3194,6 +3226,11 @@ equal(const void *a, const void *b)
 		case T_RangeTblEntry:
 			retval = _equalRangeTblEntry(a, b);
 			break;
+#ifdef ADB
+		case T_TableSampleClause:
+			retval = _equalTableSampleClause(a, b);
+			break;
+#endif
 		case T_SortGroupClause:
 			retval = _equalSortGroupClause(a, b);
 			break;
@@ -1812,6 +1812,18 @@ expression_tree_walker(Node *node,
 					return true;
 			}
 			break;
+#ifdef ADB
+		case T_TableSampleClause:
+			{
+				TableSampleClause *tsc = (TableSampleClause *) node;
+
+				if (walker(tsc->percent, context))
+					return true;
+				if (walker(tsc->repeatable, context))
+					return true;
+			}
+			break;
+#endif /* ADB */
 		case T_CommonTableExpr:
 			{
 				CommonTableExpr *cte = (CommonTableExpr *) node;
@@ -1970,6 +1982,11 @@ range_table_walker(List *rtable,
 		switch (rte->rtekind)
 		{
 			case RTE_RELATION:
+#ifdef ADB
+				if (walker(rte->tablesample, context))
+					return true;
+#endif
+				break;
 			case RTE_CTE:
 				/* nothing to do */
 				break;
@@ -2497,6 +2514,19 @@ expression_tree_mutator(Node *node,
 				return (Node *) newnode;
 			}
 			break;
+#ifdef ADB
+		case T_TableSampleClause:
+			{
+				TableSampleClause *tsc = (TableSampleClause *) node;
+				TableSampleClause *newnode;
+
+				FLATCOPY(newnode, tsc, TableSampleClause);
+				MUTATE(newnode->percent, tsc->percent, Node *);
+				MUTATE(newnode->repeatable, tsc->repeatable, Node *);
+				return (Node *) newnode;
+			}
+			break;
+#endif /* ADB */
 		case T_CommonTableExpr:
 			{
 				CommonTableExpr *cte = (CommonTableExpr *) node;
@@ -2706,6 +2736,11 @@ range_table_mutator(List *rtable,
 		switch (rte->rtekind)
 		{
 			case RTE_RELATION:
+#ifdef ADB
+				MUTATE(newrte->tablesample, rte->tablesample,
+					   TableSampleClause *);
+				break;
+#endif
 			case RTE_CTE:
 #ifdef PGXC
 			case RTE_REMOTE_DUMMY:
@@ -3136,6 +3171,20 @@ raw_expression_tree_walker(Node *node,
 					return true;
 			}
 			break;
+#ifdef ADB
+		case T_RangeTableSample:
+			{
+				RangeTableSample *rts = (RangeTableSample *) node;
+
+				if (walker(rts->relation, context))
+					return true;
+				if (walker(rts->percent, context))
+					return true;
+				if (walker(rts->repeatable, context))
+					return true;
+			}
+			break;
+#endif /* ADB */
 		case T_TypeName:
 			{
 				TypeName   *tn = (TypeName *) node;
@@ -93,6 +93,9 @@ BEGIN_NODE(PlannedStmt)
 	NODE_SCALAR(bool,hasModifyingCTE)
 	NODE_SCALAR(bool,canSetTag)
 	NODE_SCALAR(bool,transientPlan)
+#ifdef ADB
+	NODE_SCALAR(bool,hasMotion)
+#endif
 	NODE_NODE(Plan,planTree)
 	NODE_NODE(List,rtable)
 	NODE_NODE(List,resultRelations)
@@ -202,6 +205,15 @@ END_NODE(Scan)
 
 NODE_SAME(SeqScan,Scan)
 
+#ifdef ADB
+#ifndef NO_NODE_SampleScan
+BEGIN_NODE(SampleScan)
+	NODE_BASE2(Scan,scan)
+	NODE_NODE(TableSampleClause,tablesample)
+END_NODE(SampleScan)
+#endif /* NO_NODE_SampleScan */
+#endif /* ADB */
+
 #ifndef NO_NODE_IndexScan
 BEGIN_NODE(IndexScan)
 	NODE_BASE2(Scan,scan)
@@ -1120,6 +1132,9 @@ BEGIN_NODE(PlannerGlobal)
 	NODE_SCALAR(Index,lastPHId)		/* highest PlaceHolderVar ID assigned */
 	NODE_SCALAR(Index,lastRowMarkId)	/* highest PlanRowMark ID assigned */
 	NODE_SCALAR(bool,transientPlan)	/* redo plan when TransactionXmin changes? */
+#ifdef ADB
+	NODE_SCALAR(bool,hasMotion)		/* moves rows between datanodes? */
+#endif
 END_NODE(PlannerGlobal)
 #endif /* NO_NODE_PlannerGlobal */
 
@@ -1926,6 +1941,21 @@ BEGIN_NODE(RangeFunction)
 								 * of function returning RECORD */
 END_NODE(RangeFunction)
 #endif /* NO_NODE_RangeFunction */
+
+#ifdef ADB
+/*
+ * RangeTableSample - TABLESAMPLE appearing in a raw FROM clause
+ */
+#ifndef NO_NODE_RangeTableSample
+BEGIN_NODE(RangeTableSample)
+	NODE_NODE(RangeVar,relation)	/* relation to be sampled */
+	NODE_STRING(method)				/* sampling method name */
+	NODE_NODE(Node,percent)			/* percentage of the relation to return */
+	NODE_NODE(Node,repeatable)		/* REPEATABLE expression, or NULL if none */
+	NODE_LOCATION(int,location)		/* method name location, or -1 if unknown */
+END_NODE(RangeTableSample)
+#endif /* NO_NODE_RangeTableSample */
+#endif /* ADB */
 /*
  * ColumnDef - column definition (used in various creates)
  *
@@ -2123,6 +2153,9 @@ BEGIN_NODE(RangeTblEntry)
 #endif
 	NODE_SCALAR(Oid,relid)			/* OID of the relation */
 	NODE_SCALAR(char,relkind)		/* relation kind (see pg_class.relkind) */
+#ifdef ADB
+	NODE_NODE(TableSampleClause,tablesample)	/* sampling info, or NULL */
+#endif
 	NODE_NODE(Query,subquery);		/* the sub-query */
 	NODE_SCALAR(bool,security_barrier)		/* is from security_barrier view? */
 
@@ -2189,6 +2222,19 @@ BEGIN_NODE(RangeTblEntry)
 	NODE_BITMAPSET(Bitmapset,modifiedCols)	/* columns needing INSERT/UPDATE permission */
 END_NODE(RangeTblEntry)
 #endif /* NO_NODE_RangeTblEntry */
+
+#ifdef ADB
+/*
+ * TableSampleClause - TABLESAMPLE of a plain relation RTE
+ */
+#ifndef NO_NODE_TableSampleClause
+BEGIN_NODE(TableSampleClause)
+	NODE_ENUM(TableSampleMethod,method)	/* sampling method */
+	NODE_NODE(Node,percent)			/* transformed percentage expression */
+	NODE_NODE(Node,repeatable)		/* transformed seed expression, or NULL */
+END_NODE(TableSampleClause)
+#endif /* NO_NODE_TableSampleClause */
+#endif /* ADB */
 /*
  * SortGroupClause -
  *		representation of ORDER BY, GROUP BY, PARTITION BY,
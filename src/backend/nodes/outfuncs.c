@@ -248,6 +248,9 @@ _outPlannedStmt(StringInfo str, const PlannedStmt *node)
 	WRITE_BOOL_FIELD(hasModifyingCTE);
 	WRITE_BOOL_FIELD(canSetTag);
 	WRITE_BOOL_FIELD(transientPlan);
+#ifdef ADB
+	WRITE_BOOL_FIELD(hasMotion);
+#endif
 	WRITE_NODE_FIELD(planTree);
 	WRITE_NODE_FIELD(rtable);
 	WRITE_NODE_FIELD(resultRelations);
@@ -441,6 +444,18 @@ _outSeqScan(StringInfo str, const SeqScan *node)
 	_outScanInfo(str, (const Scan *) node);
 }
 
+#ifdef ADB
+static void
+_outSampleScan(StringInfo str, const SampleScan *node)
+{
+	WRITE_NODE_TYPE("SAMPLESCAN");
+
+	_outScanInfo(str, (const Scan *) node);
+
+	WRITE_NODE_FIELD(tablesample);
+}
+#endif /* ADB */
+
 static void
 _outIndexScan(StringInfo str, const IndexScan *node)
 {
@@ -506,6 +521,11 @@ _outExecNodes(StringInfo str, const ExecNodes *node)
 	WRITE_OID_FIELD(en_funcid);
 #endif
 	WRITE_NODE_FIELD(en_expr);
+#ifdef ADB
+	WRITE_BOOL_FIELD(en_expr_array);
+	WRITE_BOOL_FIELD(en_expr_rowid);
+	WRITE_INT_FIELD(en_colocation);
+#endif
 	WRITE_OID_FIELD(en_relid);
 	WRITE_ENUM_FIELD(accesstype, RelationAccessType);
 	WRITE_NODE_FIELD(en_dist_vars);
@@ -1750,6 +1770,9 @@ _outPlannerGlobal(StringInfo str, const PlannerGlobal *node)
 	WRITE_UINT_FIELD(lastPHId);
 	WRITE_UINT_FIELD(lastRowMarkId);
 	WRITE_BOOL_FIELD(transientPlan);
+#ifdef ADB
+	WRITE_BOOL_FIELD(hasMotion);
+#endif
 }
 
 static void
@@ -2433,6 +2456,9 @@ _outRangeTblEntry(StringInfo str, const RangeTblEntry *node)
 		case RTE_RELATION:
 			WRITE_OID_FIELD(relid);
 			WRITE_CHAR_FIELD(relkind);
+#ifdef ADB
+			WRITE_NODE_FIELD(tablesample);
+#endif
 			break;
 		case RTE_SUBQUERY:
 			WRITE_NODE_FIELD(subquery);
@@ -2696,6 +2722,30 @@ _outRangeFunction(StringInfo str, const RangeFunction *node)
 	WRITE_NODE_FIELD(coldeflist);
 }
 
+#ifdef ADB
+static void
+_outRangeTableSample(StringInfo str, const RangeTableSample *node)
+{
+	WRITE_NODE_TYPE("RANGETABLESAMPLE");
+
+	WRITE_NODE_FIELD(relation);
+	WRITE_STRING_FIELD(method);
+	WRITE_NODE_FIELD(percent);
+	WRITE_NODE_FIELD(repeatable);
+	WRITE_LOCATION_FIELD(location);
+}
+
+static void
+_outTableSampleClause(StringInfo str, const TableSampleClause *node)
+{
+	WRITE_NODE_TYPE("TABLESAMPLECLAUSE");
+
+	WRITE_ENUM_FIELD(method, TableSampleMethod);
+	WRITE_NODE_FIELD(percent);
+	WRITE_NODE_FIELD(repeatable);
+}
+#endif /* ADB */
+
 static void
 _outConstraint(StringInfo str, const Constraint *node)
 {
@@ -2853,6 +2903,11 @@ _outNode(StringInfo str, const void *obj)
 			case T_SeqScan:
 				_outSeqScan(str, obj);
 				break;
+#ifdef ADB
+			case T_SampleScan:
+				_outSampleScan(str, obj);
+				break;
+#endif
 #ifdef PGXC
 			case T_RemoteQuery:
 				_outRemoteQuery(str, obj);
@@ -3229,6 +3284,11 @@ _outNode(StringInfo str, const void *obj)
 			case T_RangeTblEntry:
 				_outRangeTblEntry(str, obj);
 				break;
+#ifdef ADB
+			case T_TableSampleClause:
+				_outTableSampleClause(str, obj);
+				break;
+#endif
 			case T_A_Expr:
 				_outAExpr(str, obj);
 				break;
@@ -3268,6 +3328,11 @@ _outNode(StringInfo str, const void *obj)
 			case T_RangeFunction:
 				_outRangeFunction(str, obj);
 				break;
+#ifdef ADB
+			case T_RangeTableSample:
+				_outRangeTableSample(str, obj);
+				break;
+#endif
 			case T_Constraint:
 				_outConstraint(str, obj);
 				break;
@@ -274,6 +274,23 @@ _readSortGroupClause(void)
 	READ_DONE();
 }
 
+#ifdef ADB
+/*
+ * _readTableSampleClause
+ */
+static TableSampleClause *
+_readTableSampleClause(void)
+{
+	READ_LOCALS(TableSampleClause);
+
+	READ_ENUM_FIELD(method, TableSampleMethod);
+	READ_NODE_FIELD(percent);
+	READ_NODE_FIELD(repeatable);
+
+	READ_DONE();
+}
+#endif /* ADB */
+
 /*
  * _readWindowClause
  */
@@ -1204,6 +1221,9 @@ _readRangeTblEntry(void)
 		case RTE_RELATION:
 			READ_OID_FIELD(relid);
 			READ_CHAR_FIELD(relkind);
+#ifdef ADB
+			READ_NODE_FIELD(tablesample);
+#endif
 			break;
 		case RTE_SUBQUERY:
 			READ_NODE_FIELD(subquery);
@@ -1374,6 +1394,10 @@ parseNodeString(void)
 		return_value = _readFromExpr();
 	else if (MATCH("RTE", 3))
 		return_value = _readRangeTblEntry();
+#ifdef ADB
+	else if (MATCH("TABLESAMPLECLAUSE", 17))
+		return_value = _readTableSampleClause();
+#endif
 	else if (MATCH("NOTIFY", 6))
 		return_value = _readNotifyStmt();
 	else if (MATCH("DECLARECURSOR", 13))
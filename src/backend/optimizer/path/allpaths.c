@@ -27,6 +27,7 @@
 #include "optimizer/clauses.h"
 #include "optimizer/cost.h"
 #include "optimizer/geqo.h"
+#include "optimizer/partprune.h"
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
 #include "optimizer/plancat.h"
@@ -59,6 +60,12 @@ static void set_plain_rel_size(PlannerInfo *root, RelOptInfo *rel,
 				   RangeTblEntry *rte);
 static void set_plain_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 					   RangeTblEntry *rte);
+#ifdef ADB
+static void set_tablesample_rel_size(PlannerInfo *root, RelOptInfo *rel,
+					  RangeTblEntry *rte);
+static void set_tablesample_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
+						  RangeTblEntry *rte);
+#endif
 static void set_foreign_size(PlannerInfo *root, RelOptInfo *rel,
 				 RangeTblEntry *rte);
 static void set_foreign_pathlist(PlannerInfo *root, RelOptInfo *rel,
@@ -296,6 +303,13 @@ set_rel_size(PlannerInfo *root, RelOptInfo *rel,
 					/* Foreign table */
 					set_foreign_size(root, rel, rte);
 				}
+#ifdef ADB
+				else if (rte->tablesample != NULL)
+				{
+					/* Sampled relation */
+					set_tablesample_rel_size(root, rel, rte);
+				}
+#endif
 				else
 				{
 					/* Plain relation */
@@ -368,6 +382,13 @@ set_rel_pathlist(PlannerInfo *root, RelOptInfo *rel,
 					/* Foreign table */
 					set_foreign_pathlist(root, rel, rte);
 				}
+#ifdef ADB
+				else if (rte->tablesample != NULL)
+				{
+					/* Sampled relation */
+					set_tablesample_rel_pathlist(root, rel, rte);
+				}
+#endif
 				else
 				{
 					/* Plain relation */
@@ -464,6 +485,46 @@ set_plain_rel_pathlist(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
 	set_cheapest(rel);
 }
 
+#ifdef ADB
+/*
+ * set_tablesample_rel_size
+ *	  Set size estimates for a sampled relation
+ */
+static void
+set_tablesample_rel_size(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
+{
+	/* Mark rel with estimated output rows, width, etc, as for the whole rel */
+	set_plain_rel_size(root, rel, rte);
+
+	/* and keep only the sampled part of the rows */
+	rel->rows = clamp_row_est(rel->rows *
+							  tablesample_fraction(root, rte->tablesample));
+}
+
+/*
+ * set_tablesample_rel_pathlist
+ *	  Build access paths for a sampled relation
+ *
+ * A sample scan is the only way to read it, on the Datanodes as well when
+ * the relation is distributed.
+ */
+static void
+set_tablesample_rel_pathlist(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte)
+{
+	Relids		required_outer;
+
+	/* as for a seqscan, only LATERAL refs in the tlist can parameterize it */
+	required_outer = rel->lateral_relids;
+#ifdef PGXC
+	if (!create_plainrel_rqpath(root, rel, rte, required_outer))
+#endif
+	add_path(rel, create_samplescan_path(root, rel, required_outer));
+
+	/* Now find the cheapest of the paths for this rel */
+	set_cheapest(rel);
+}
+#endif /* ADB */
+
 /*
  * set_foreign_size
  *		Set size estimates for a foreign table RTE
@@ -516,6 +577,7 @@ set_append_rel_size(PlannerInfo *root, RelOptInfo *rel,
 	double		parent_size;
 	double	   *parent_attrsizes;
 	int			nattrs;
+	Bitmapset  *pruned;
 	ListCell   *l;
 
 	/*
@@ -538,6 +600,12 @@ set_append_rel_size(PlannerInfo *root, RelOptInfo *rel,
 	nattrs = rel->max_attr - rel->min_attr + 1;
 	parent_attrsizes = (double *) palloc0(nattrs * sizeof(double));
 
+	/*
+	 * Children of an inheritance tree which the cached ranges of their CHECK
+	 * constraints already prove away need no constraint exclusion test.
+	 */
+	pruned = prune_inherited_children(root, rel, rti, rte);
+
 	foreach(l, root->append_rel_list)
 	{
 		AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(l);
@@ -563,6 +631,12 @@ set_append_rel_size(PlannerInfo *root, RelOptInfo *rel,
 		childrel = find_base_rel(root, childRTindex);
 		Assert(childrel->reloptkind == RELOPT_OTHER_MEMBER_REL);
 
+		if (bms_is_member(childRTindex, pruned))
+		{
+			set_dummy_rel_pathlist(childrel);
+			continue;
+		}
+
 		/*
 		 * We have to copy the parent's targetlist and quals to the child,
 		 * with appropriate substitution of variables.  However, only the
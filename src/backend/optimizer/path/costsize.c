@@ -91,6 +91,11 @@
 #include "utils/selfuncs.h"
 #include "utils/spccache.h"
 #include "utils/tuplesort.h"
+#ifdef ADB
+#include "access/sysattr.h"
+#include "optimizer/var.h"
+#include "pgxc/locator.h"
+#endif
 
 
 #define LOG2(x)  (log(x) / 0.693147180559945)
@@ -104,6 +109,12 @@ double		cpu_operator_cost = DEFAULT_CPU_OPERATOR_COST;
 
 int			effective_cache_size = DEFAULT_EFFECTIVE_CACHE_SIZE;
 
+#ifdef ADB
+double		remote_startup_cost = DEFAULT_REMOTE_STARTUP_COST;
+double		remote_tuple_cost = DEFAULT_REMOTE_TUPLE_COST;
+double		remote_byte_cost = DEFAULT_REMOTE_BYTE_COST;
+#endif
+
 Cost		disable_cost = 1.0e10;
 
 bool		enable_seqscan = true;
@@ -123,6 +134,9 @@ bool		enable_remotejoin = true;
 bool		enable_remotegroup = true;
 bool		enable_remotesort = true;
 bool		enable_remotelimit = true;
+#ifdef ADB
+bool		enable_datanode_motion = false;
+#endif
 #endif
 
 typedef struct
@@ -151,6 +165,10 @@ static double calc_joinrel_size_estimate(PlannerInfo *root,
 static void set_rel_width(PlannerInfo *root, RelOptInfo *rel);
 static double relation_byte_size(double tuples, int width);
 static double page_size(double tuples, int width);
+#ifdef ADB
+static double remote_rel_skew(PlannerInfo *root, RelOptInfo *rel, double nnodes);
+static Cost remote_index_cost(PlannerInfo *root, RelOptInfo *rel);
+#endif
 
 
 /*
@@ -225,6 +243,100 @@ cost_seqscan(Path *path, PlannerInfo *root,
 	path->total_cost = startup_cost + run_cost;
 }
 
+#ifdef ADB
+/*
+ * tablesample_fraction
+ *	  Estimate the fraction of a relation that a TABLESAMPLE keeps.
+ *
+ * A percentage not known at plan time is taken as 10%.
+ */
+double
+tablesample_fraction(PlannerInfo *root, TableSampleClause *tablesample)
+{
+	Node	   *percent;
+
+	percent = estimate_expression_value(root, tablesample->percent);
+	if (IsA(percent, Const) && !((Const *) percent)->constisnull)
+	{
+		float4		pct = DatumGetFloat4(((Const *) percent)->constvalue);
+
+		if (pct >= 0 && pct <= 100)
+			return pct / 100.0;
+	}
+
+	return 0.1;
+}
+
+/*
+ * cost_samplescan
+ *	  Determines and returns the cost of scanning a relation using a
+ *	  TABLESAMPLE.
+ *
+ * SYSTEM reads only the sampled blocks, though not sequentially, while
+ * BERNOULLI reads every block and checks every tuple.  baserel->rows is
+ * already the size of the sample.
+ */
+void
+cost_samplescan(Path *path, PlannerInfo *root,
+				RelOptInfo *baserel, ParamPathInfo *param_info)
+{
+	Cost		startup_cost = 0;
+	Cost		run_cost = 0;
+	RangeTblEntry *rte;
+	double		fraction;
+	double		spc_seq_page_cost,
+				spc_random_page_cost;
+	double		pages;
+	double		tuples;
+	QualCost	qpqual_cost;
+
+	/* Should only be applied to base relations */
+	Assert(baserel->relid > 0);
+	Assert(baserel->rtekind == RTE_RELATION);
+	rte = planner_rt_fetch(baserel->relid, root);
+	Assert(rte->tablesample != NULL);
+
+	/* Mark the path with the correct row estimate */
+	if (param_info)
+		path->rows = param_info->ppi_rows;
+	else
+		path->rows = baserel->rows;
+
+	/* fetch estimated page costs for tablespace containing table */
+	get_tablespace_page_costs(baserel->reltablespace,
+							  &spc_random_page_cost,
+							  &spc_seq_page_cost);
+
+	fraction = tablesample_fraction(root, rte->tablesample);
+	if (rte->tablesample->method == TABLESAMPLE_SYSTEM)
+	{
+		pages = ceil(baserel->pages * fraction);
+		tuples = clamp_row_est(baserel->tuples * fraction);
+		run_cost += spc_random_page_cost * pages;
+	}
+	else
+	{
+		pages = baserel->pages;
+		tuples = baserel->tuples;
+		run_cost += spc_seq_page_cost * pages;
+	}
+
+	/*
+	 * CPU costs: every tuple read is checked for visibility, but only the
+	 * sampled ones get to the quals.
+	 */
+	get_restriction_qual_cost(root, baserel, param_info, &qpqual_cost);
+
+	startup_cost += qpqual_cost.startup;
+	run_cost += cpu_tuple_cost * tuples;
+	run_cost += qpqual_cost.per_tuple *
+		clamp_row_est(baserel->tuples * fraction);
+
+	path->startup_cost = startup_cost;
+	path->total_cost = startup_cost + run_cost;
+}
+#endif /* ADB */
+
 /*
  * cost_index
  *	  Determines and returns the cost of scanning a relation using an index.
@@ -2924,18 +3036,225 @@ cost_rescan(PlannerInfo *root, Path *path,
 #ifdef PGXC
 /*
  * cost_remotequery
- * As of now the function just sets the costs to 0 to make this path the
- * cheapest.
- * PGXC_TODO: Ideally, we should estimate the costs of network transfer from
- * datanodes and any datanode costs involved.
+ * Estimate the cost of getting the rows of a relation, or of a JOIN, from
+ * the datanodes: the work done on the datanodes, their fixed overhead and
+ * the rows and bytes shipped to the coordinator.
  */
 void
 cost_remotequery(RemoteQueryPath *rqpath, PlannerInfo *root, RelOptInfo *rel)
 {
+	rqpath->path.rows = rel->rows;
+
+#ifdef ADB
+	{
+		ExecNodes  *exec_nodes = rqpath->rqpath_en;
+		double		nnodes;
+		double		skew;
+		Cost		datanode_cost;
+		Cost		run_cost;
+
+		/* A replicated relation is read from one of its nodes only */
+		if (IsExecNodesReplicated(exec_nodes))
+			nnodes = 1;
+		else
+			nnodes = Max(list_length(exec_nodes->nodeList), 1);
+
+		/*
+		 * The datanodes work in parallel, as long as the largest one needs,
+		 * charge for a scan of their share of the relation or for the JOIN
+		 * of the rows of both sides.
+		 */
+		if (rel->reloptkind == RELOPT_JOINREL)
+		{
+			skew = remote_rel_skew(root, rqpath->leftpath->path.parent, nnodes);
+			datanode_cost = rqpath->leftpath->rqdatanode_cost +
+							rqpath->rightpath->rqdatanode_cost +
+							cpu_tuple_cost * skew * rel->rows / nnodes;
+		}
+		else
+		{
+			Cost	scan_cost;
+			Cost	index_cost;
+
+			scan_cost = seq_page_cost * rel->pages +
+						(cpu_tuple_cost + rel->baserestrictcost.per_tuple) * rel->tuples;
+
+			/*
+			 * The datanodes plan the shipped query with the same indexes,
+			 * so they may read the rows through one of them instead.
+			 */
+			index_cost = remote_index_cost(root, rel);
+			if (index_cost >= 0 && index_cost < scan_cost)
+				scan_cost = index_cost;
+
+			skew = remote_rel_skew(root, rel, nnodes);
+			datanode_cost = skew * scan_cost / nnodes;
+		}
+
+		/*
+		 * A JOIN moving rows between the datanodes charges for the rows of
+		 * the right side sent to the nodes of the left side, each of them
+		 * connecting to every node of the right side.
+		 */
+		if (rqpath->rqmotion != REMOTE_MOTION_NONE)
+		{
+			RemoteQueryPath *innerpath = rqpath->rightpath;
+			double	nreceivers = Max(list_length(exec_nodes->nodeList), 1);
+			double	nsenders = Max(list_length(innerpath->rqpath_en->nodeList), 1);
+			double	inner_rows = innerpath->path.rows;
+
+			if (rqpath->rqmotion == REMOTE_MOTION_BROADCAST)
+				inner_rows *= nreceivers;
+			datanode_cost += remote_startup_cost * nsenders +
+							 inner_rows * (remote_tuple_cost +
+										   remote_byte_cost * innerpath->path.parent->width) /
+							 nreceivers;
+		}
+		rqpath->rqdatanode_cost = datanode_cost;
+
+		/*
+		 * Every node contacted costs a fixed overhead, for sending it the
+		 * query and waiting for its answer, then each row and byte of the
+		 * result goes through the network to the coordinator.
+		 */
+		run_cost = rel->rows * (remote_tuple_cost + remote_byte_cost * rel->width);
+		rqpath->path.startup_cost = remote_startup_cost * nnodes;
+		rqpath->path.total_cost = rqpath->path.startup_cost + datanode_cost + run_cost;
+	}
+#else
 	rqpath->path.startup_cost = 0;
 	rqpath->path.total_cost = 0;
-	rqpath->path.rows = rel->rows;
+#endif
+}
+
+#ifdef ADB
+/*
+ * remote_rel_skew
+ *	  How far the largest datanode of a base relation is above the average,
+ *	  as ANALYZE found it; 1 for any other relation.
+ */
+static double
+remote_rel_skew(PlannerInfo *root, RelOptInfo *rel, double nnodes)
+{
+	RangeTblEntry *rte;
+	RelationLocInfo *locinfo;
+	double		skew = 1.0;
+
+	if (rel->reloptkind != RELOPT_BASEREL &&
+		rel->reloptkind != RELOPT_OTHER_MEMBER_REL)
+		return skew;
+
+	rte = planner_rt_fetch(rel->relid, root);
+	if (rte->rtekind != RTE_RELATION)
+		return skew;
+
+	locinfo = GetRelationLocInfo(rte->relid);
+	if (locinfo)
+	{
+		if (locinfo->nodeSkew > 1.0)
+			skew = Min(locinfo->nodeSkew, nnodes);
+		FreeRelationLocInfo(locinfo);
+	}
+
+	return skew;
+}
+
+/*
+ * remote_index_cost
+ *	  Estimate the cost of the cheapest index scan a datanode could run for
+ *	  the shipped query of a base relation, summed over all its nodes; -1 if
+ *	  no index looks usable.
+ *
+ * The datanodes get only the Vars the coordinator needs and the shippable
+ * quals, so an index holding all those columns lets them answer with an
+ * index-only scan, visiting the heap only for pages not all-visible.  This is
+ * a rough version of what cost_index() does on the datanode, good enough to
+ * tell a covering or selective index from a sequential scan.
+ */
+static Cost
+remote_index_cost(PlannerInfo *root, RelOptInfo *rel)
+{
+	Bitmapset  *attrs_used = NULL;
+	Bitmapset  *qual_attrs = NULL;
+	double		selec;
+	Cost		best_cost = -1;
+	ListCell   *lc;
+
+	if (rel->indexlist == NIL || rel->tuples <= 0)
+		return best_cost;
+
+	pull_varattnos((Node *) rel->reltargetlist, rel->relid, &attrs_used);
+	foreach(lc, rel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		pull_varattnos((Node *) rinfo->clause, rel->relid, &qual_attrs);
+	}
+	attrs_used = bms_add_members(attrs_used, qual_attrs);
+
+	selec = clamp_row_est(rel->rows) / rel->tuples;
+	if (selec > 1.0)
+		selec = 1.0;
+
+	foreach(lc, rel->indexlist)
+	{
+		IndexOptInfo *index = (IndexOptInfo *) lfirst(lc);
+		Bitmapset  *index_attrs = NULL;
+		bool		index_only;
+		double		index_selec;
+		double		tuples_fetched;
+		double		heap_fetches;
+		double		index_pages;
+		Cost		cost;
+		int			i;
+
+		if (!index->amhasgettuple || index->indpred != NIL)
+			continue;
+
+		for (i = 0; i < index->ncolumns; i++)
+		{
+			if (index->indexkeys[i] != 0)
+				index_attrs = bms_add_member(index_attrs,
+											 index->indexkeys[i] - FirstLowInvalidHeapAttributeNumber);
+		}
+		index_only = index->canreturn && bms_is_subset(attrs_used, index_attrs);
+		bms_free(index_attrs);
+
+		/*
+		 * An index whose leading column is not restricted is only worth a
+		 * full scan when it answers the query by itself.
+		 */
+		if (index->indexkeys[0] != 0 &&
+			bms_is_member(index->indexkeys[0] - FirstLowInvalidHeapAttributeNumber,
+						  qual_attrs))
+			index_selec = selec;
+		else if (index_only)
+			index_selec = 1.0;
+		else
+			continue;
+
+		tuples_fetched = clamp_row_est(index_selec * rel->tuples);
+		index_pages = ceil(index_selec * index->pages);
+		cost = random_page_cost * index_pages +
+			   (cpu_index_tuple_cost + cpu_operator_cost) * tuples_fetched;
+
+		if (index_only)
+			heap_fetches = clamp_row_est(tuples_fetched * (1.0 - rel->allvisfrac));
+		else
+			heap_fetches = tuples_fetched;
+		if (!index_only || rel->allvisfrac < 1.0)
+			cost += random_page_cost *
+					index_pages_fetched(heap_fetches, rel->pages,
+										(double) index->pages, root);
+		cost += (cpu_tuple_cost + rel->baserestrictcost.per_tuple) * tuples_fetched;
+
+		if (best_cost < 0 || cost < best_cost)
+			best_cost = cost;
+	}
+
+	return best_cost;
 }
+#endif
 #endif /* PGXC */
 
 /*
@@ -23,6 +23,13 @@
 #include "pgxc/pgxc.h"
 #include "optimizer/pgxcplan.h"
 #include "tcop/tcopprot.h"
+#ifdef ADB
+#include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
+#include "pgxc/execRemote.h"
+#include "pgxc/locator.h"
+#include "utils/lsyscache.h"
+#endif
 
 static RemoteQueryPath *pgxc_find_remotequery_path(RelOptInfo *rel);
 static RemoteQueryPath *create_remotequery_path(PlannerInfo *root, RelOptInfo *rel,
@@ -30,6 +37,14 @@ static RemoteQueryPath *create_remotequery_path(PlannerInfo *root, RelOptInfo *r
 								RemoteQueryPath *leftpath,
 								RemoteQueryPath *rightpath, JoinType jointype,
 								List *join_restrictlist);
+#ifdef ADB
+static RemoteQueryPath *create_motion_rqpath(PlannerInfo *root, RelOptInfo *joinrel,
+								RemoteQueryPath *outerpath,
+								RemoteQueryPath *innerpath, JoinType jointype,
+								List *restrictlist, List *join_quals);
+static Var *pgxc_find_motion_key(List *outer_dist_vars, Relids inner_relids,
+								List *join_quals);
+#endif
 /*
  * create_remotequery_path
  *	  Creates a path for given RelOptInfo (for base rel or a join rel) so that
@@ -99,6 +114,10 @@ create_remotequery_path(PlannerInfo *root, RelOptInfo *rel, ExecNodes *exec_node
 		{
 			rqpath->rqhas_temp_rel = leftpath->rqhas_temp_rel ||
 									rightpath->rqhas_temp_rel;
+#ifdef ADB
+			rqpath->rqhas_motion = leftpath->rqhas_motion ||
+									rightpath->rqhas_motion;
+#endif
 			unshippable_quals = !pgxc_is_expr_shippable((Expr *)extract_actual_clauses(join_restrictlist, false),
 														NULL);
 		}
@@ -112,7 +131,6 @@ create_remotequery_path(PlannerInfo *root, RelOptInfo *rel, ExecNodes *exec_node
 	rqpath->rqhas_unshippable_tlist = !pgxc_is_expr_shippable((Expr *)rel->reltargetlist,
 																NULL);
 
-	/* PGXCTODO - set cost properly */
 	cost_remotequery(rqpath, root, rel);
 
 	return rqpath;
@@ -142,6 +160,19 @@ create_plainrel_rqpath(PlannerInfo *root, RelOptInfo *rel, RangeTblEntry *rte,
 	if (!IS_PGXC_COORDINATOR || IsConnFromCoord() || root->parse->is_local)
 		return false;
 
+#ifdef ADB
+	/*
+	 * Every Datanode samples its own part of the relation, so they have to
+	 * evaluate the TABLESAMPLE arguments themselves.
+	 */
+	if (rte->tablesample &&
+		!pgxc_is_expr_shippable((Expr *) rte->tablesample, NULL))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("TABLESAMPLE arguments of relation \"%s\" cannot be evaluated on the Datanodes",
+						get_rel_name(rte->relid))));
+#endif
+
 	quals = extract_actual_clauses(rel->baserestrictinfo, false);
 	exec_nodes = GetRelationNodesByQuals(rte->relid, rel->relid,
 														(Node *)quals,
@@ -287,5 +318,128 @@ create_joinrel_rqpath(PlannerInfo *root, RelOptInfo *joinrel,
 															param_info,
 													outerpath, innerpath, jointype,
 													restrictlist));
+#ifdef ADB
+	else if (enable_datanode_motion && !param_info && !required_outer)
+	{
+		RemoteQueryPath *motion_path = create_motion_rqpath(root, joinrel, outerpath,
+															innerpath, jointype,
+															restrictlist, join_quals);
+		if (motion_path)
+			add_path(joinrel, (Path *)motion_path);
+	}
+#endif
 	return;
 }
+
+#ifdef ADB
+/*
+ * create_motion_rqpath
+ * Create a RemoteQuery path for a JOIN which is not shippable because the
+ * rows to join are not located on the same datanodes. The JOIN is evaluated
+ * on the datanodes of the outer relation, which fetch the rows of the inner
+ * relation from the datanodes holding them, see pgxc_motion_fetch(). The
+ * inner rows are redistributed there when the JOIN is on the distribution
+ * column of the outer relation, and broadcast otherwise. Returns NULL if
+ * such a JOIN can not be done.
+ *
+ * The rows are read in separate sessions, under the snapshot of the query,
+ * but which can not see the changes made by the current transaction. Hence
+ * this is limited to SELECT queries of a transaction which wrote nothing on
+ * the datanodes yet. That is checked again before a cached plan is reused,
+ * see CheckCachedPlan(). Only INNER and LEFT JOINs are handled, for which
+ * every outer row stays on its node.
+ */
+static RemoteQueryPath *
+create_motion_rqpath(PlannerInfo *root, RelOptInfo *joinrel,
+					 RemoteQueryPath *outerpath, RemoteQueryPath *innerpath,
+					 JoinType jointype, List *restrictlist, List *join_quals)
+{
+	ExecNodes		*inner_en = innerpath->rqpath_en;
+	ExecNodes		*outer_en = outerpath->rqpath_en;
+	RelOptInfo		*outerrel = outerpath->path.parent;
+	RemoteQueryPath	*rqpath;
+	Var				*key = NULL;
+
+	if (jointype != JOIN_INNER && jointype != JOIN_LEFT)
+		return NULL;
+
+	if (XactHasRemoteWrites() || root->parse->commandType != CMD_SELECT ||
+		root->parse->hasModifyingCTE)
+		return NULL;
+
+	/* The inner side is run as a query of its own on its datanodes */
+	if (innerpath->rqhas_motion || innerpath->rqhas_temp_rel ||
+		outerpath->rqhas_temp_rel ||
+		innerpath->rqhas_unshippable_tlist || outerpath->rqhas_unshippable_tlist ||
+		!pgxc_is_expr_shippable((Expr *)join_quals, NULL))
+		return NULL;
+
+	/* Every outer row has to be on a single node, known at planning time */
+	if (IsExecNodesReplicated(outer_en) || IsExecNodesReplicated(inner_en) ||
+		OidIsValid(outer_en->en_relid) || OidIsValid(inner_en->en_relid) ||
+		outer_en->en_expr || inner_en->en_expr ||
+		!outer_en->nodeList || !inner_en->nodeList)
+		return NULL;
+
+	/*
+	 * Redistribution needs the locator of the outer relation, which is only
+	 * known for a plain relation distributed by hash or modulo.
+	 */
+	if (outerrel->reloptkind == RELOPT_BASEREL &&
+		(outer_en->baselocatortype == LOCATOR_TYPE_HASH ||
+		 outer_en->baselocatortype == LOCATOR_TYPE_MODULO))
+		key = pgxc_find_motion_key(outer_en->en_dist_vars,
+								   innerpath->path.parent->relids, join_quals);
+
+	rqpath = create_remotequery_path(root, joinrel, copyObject(outer_en), NULL,
+									 outerpath, innerpath, jointype, restrictlist);
+	rqpath->rqmotion = key ? REMOTE_MOTION_REDISTRIBUTE : REMOTE_MOTION_BROADCAST;
+	rqpath->rqmotion_key = key;
+	rqpath->rqhas_motion = true;
+	cost_remotequery(rqpath, root, joinrel);
+
+	return rqpath;
+}
+
+/*
+ * pgxc_find_motion_key
+ * Find among the JOIN quals an equality between one of the distribution
+ * columns of the outer relation and a column of the inner relation of the
+ * same type, so that rows hash the same way on both sides. Returns the inner
+ * column, or NULL if there is none.
+ */
+static Var *
+pgxc_find_motion_key(List *outer_dist_vars, Relids inner_relids, List *join_quals)
+{
+	ListCell	*lcell;
+
+	foreach (lcell, join_quals)
+	{
+		OpExpr	*op = (OpExpr *) lfirst(lcell);
+		Node	*larg;
+		Node	*rarg;
+
+		if (!IsA(op, OpExpr) || list_length(op->args) != 2)
+			continue;
+
+		larg = strip_implicit_coercions(linitial(op->args));
+		rarg = strip_implicit_coercions(lsecond(op->args));
+		if (!IsA(larg, Var) || !IsA(rarg, Var) ||
+			exprType(larg) != exprType(rarg))
+			continue;
+
+		if (!op_mergejoinable(op->opno, exprType(larg)) &&
+			!op_hashjoinable(op->opno, exprType(larg)))
+			continue;
+
+		if (list_member(outer_dist_vars, larg) &&
+			bms_is_member(((Var *) rarg)->varno, inner_relids))
+			return (Var *) rarg;
+		if (list_member(outer_dist_vars, rarg) &&
+			bms_is_member(((Var *) larg)->varno, inner_relids))
+			return (Var *) larg;
+	}
+
+	return NULL;
+}
+#endif
@@ -44,6 +44,25 @@
 #include "optimizer/pathnode.h"
 #include "optimizer/paths.h"
 
+#ifdef ADB
+/*
+ * The rowid of a row, made of the node identifier and the TID of the row,
+ * is scanned for as its CTID is.
+ */
+#define IsTidVar(var, varno) \
+	((((var)->varattno == SelfItemPointerAttributeNumber && \
+	   (var)->vartype == TIDOID) || \
+	  ((var)->varattno == ADB_RowIdAttributeNumber && \
+	   (var)->vartype == RIDOID)) && \
+	 (var)->varno == (varno) && \
+	 (var)->varlevelsup == 0)
+#else
+#define IsTidVar(var, varno) \
+	((var)->varattno == SelfItemPointerAttributeNumber && \
+	 (var)->vartype == TIDOID && \
+	 (var)->varno == (varno) && \
+	 (var)->varlevelsup == 0)
+#endif
 
 static bool IsTidEqualClause(OpExpr *node, int varno);
 static bool IsTidEqualAnyClause(ScalarArrayOpExpr *node, int varno);
@@ -70,7 +89,11 @@ IsTidEqualClause(OpExpr *node, int varno)
 	Var		   *var;
 
 	/* Operator must be tideq */
+#ifdef ADB
+	if (node->opno != TIDEqualOperator && node->opno != RIDEqualOperator)
+#else
 	if (node->opno != TIDEqualOperator)
+#endif
 		return false;
 	if (list_length(node->args) != 2)
 		return false;
@@ -79,27 +102,22 @@ IsTidEqualClause(OpExpr *node, int varno)
 
 	/* Look for CTID as either argument */
 	other = NULL;
+	var = NULL;
 	if (arg1 && IsA(arg1, Var))
 	{
 		var = (Var *) arg1;
-		if (var->varattno == SelfItemPointerAttributeNumber &&
-			var->vartype == TIDOID &&
-			var->varno == varno &&
-			var->varlevelsup == 0)
+		if (IsTidVar(var, varno))
 			other = arg2;
 	}
 	if (!other && arg2 && IsA(arg2, Var))
 	{
 		var = (Var *) arg2;
-		if (var->varattno == SelfItemPointerAttributeNumber &&
-			var->vartype == TIDOID &&
-			var->varno == varno &&
-			var->varlevelsup == 0)
+		if (IsTidVar(var, varno))
 			other = arg1;
 	}
 	if (!other)
 		return false;
-	if (exprType(other) != TIDOID)
+	if (exprType(other) != var->vartype)
 		return false;			/* probably can't happen */
 
 	/* The other argument must be a pseudoconstant */
@@ -120,7 +138,11 @@ IsTidEqualAnyClause(ScalarArrayOpExpr *node, int varno)
 			   *arg2;
 
 	/* Operator must be tideq */
+#ifdef ADB
+	if (node->opno != TIDEqualOperator && node->opno != RIDEqualOperator)
+#else
 	if (node->opno != TIDEqualOperator)
+#endif
 		return false;
 	if (!node->useOr)
 		return false;
@@ -133,10 +155,7 @@ IsTidEqualAnyClause(ScalarArrayOpExpr *node, int varno)
 	{
 		Var		   *var = (Var *) arg1;
 
-		if (var->varattno == SelfItemPointerAttributeNumber &&
-			var->vartype == TIDOID &&
-			var->varno == varno &&
-			var->varlevelsup == 0)
+		if (IsTidVar(var, varno))
 		{
 			/* The other argument must be a pseudoconstant */
 			if (is_pseudo_constant_clause(arg2))
@@ -13,12 +13,21 @@
  *-------------------------------------------------------------------------
  */
 #include "postgres.h"
+#ifdef ADB
+#include "access/heapam.h"
+#endif
 #include "access/sysattr.h"
+#ifdef ADB
+#include "access/xact.h"
+#endif
 #include "catalog/pg_proc.h"
 #include "catalog/pg_type.h"
 #include "catalog/pg_inherits.h"
 #include "catalog/pg_inherits_fn.h"
 #include "catalog/indexing.h"
+#ifdef ADB
+#include "catalog/pg_collation.h"
+#endif
 #include "catalog/pgxc_node.h"
 #include "commands/prepare.h"
 #include "commands/tablecmds.h"
@@ -73,6 +82,11 @@ static PlannedStmt *pgxc_handle_exec_direct(Query *query, int cursorOptions,
 static RemoteQuery *pgxc_FQS_create_remote_plan(Query *query,
 												ExecNodes *exec_nodes,
 												bool is_exec_direct);
+#ifdef ADB
+static bool pgxc_has_only_distinct_aggs(Plan *agg_plan);
+static Plan *pgxc_remote_distinct_agg_plan(PlannerInfo *root, Plan *agg_plan,
+								RemoteQuery *remote_scan);
+#endif
 static bool pgxc_locate_grouping_columns(PlannerInfo *root, List *tlist,
 											AttrNumber *grpColIdx);
 static List *pgxc_process_grouping_targetlist(List *local_tlist,
@@ -86,6 +100,16 @@ static List *pgxc_set_en_expr(Oid tableoid, Index resultRelationIndex);
 static Expr *pgxc_set_en_expr(Oid tableoid, Index resultRelationIndex);
 #endif
 static List *pgxc_separate_quals(List *quals, List **local_quals, bool has_aggs);
+#ifdef ADB
+static FuncExpr *pgxc_make_motion_funcexpr(const char *sql, int keyno, char locator,
+										   List *recv_nodes, List *src_nodes);
+static RangeTblEntry *pgxc_make_motion_rte(PlannerInfo *root, RemoteQueryPath *rqpath,
+								Query *right_query, List *right_rep_tlist,
+								Alias *right_alias);
+static AttrNumber pgxc_motion_dml_key(Query *query, Index varno,
+									  RelationLocInfo *result_loc_info);
+static List *pgxc_motion_dml_rewrite(Query *query, List *motion_rtes);
+#endif
 static Query *pgxc_build_shippable_query_recurse(PlannerInfo *root,
 													RemoteQueryPath *rqpath,
 													List **unshippable_quals,
@@ -348,6 +372,310 @@ pgxc_generate_colnames(char *prefix, int num_cols)
 	return colnames;
 }
 
+#ifdef ADB
+/*
+ * pgxc_make_motion_funcexpr
+ * Build the call to pgxc_motion_fetch() running "sql" on the datanodes of
+ * "src_nodes". With a positive "keyno", the rows are redistributed among the
+ * datanodes of "recv_nodes" on their column "keyno" as by "locator",
+ * otherwise they are broadcast.
+ */
+static FuncExpr *
+pgxc_make_motion_funcexpr(const char *sql, int keyno, char locator,
+						  List *recv_nodes, List *src_nodes)
+{
+	Datum			*nodes;
+	Datum			*hosts;
+	Datum			*ports;
+	int				i;
+	List			*args;
+	FuncExpr		*funcexpr;
+	ListCell		*lcell;
+
+	/* Receivers are told by their position in the locator node list */
+	nodes = (Datum *) palloc(sizeof(Datum) * (list_length(recv_nodes) + 1));
+	i = 0;
+	foreach (lcell, recv_nodes)
+	{
+		Oid nodeoid = PGXCNodeGetNodeOid(lfirst_int(lcell), PGXC_NODE_DATANODE);
+
+		nodes[i++] = CStringGetTextDatum(get_pgxc_nodename(nodeoid));
+	}
+
+	hosts = (Datum *) palloc(sizeof(Datum) * list_length(src_nodes));
+	ports = (Datum *) palloc(sizeof(Datum) * list_length(src_nodes));
+	i = 0;
+	foreach (lcell, src_nodes)
+	{
+		Oid nodeoid = PGXCNodeGetNodeOid(lfirst_int(lcell), PGXC_NODE_DATANODE);
+
+		hosts[i] = CStringGetTextDatum(get_pgxc_nodehost(nodeoid));
+		ports[i] = Int32GetDatum(get_pgxc_nodeport(nodeoid));
+		i++;
+	}
+
+	args = list_make3(makeConst(TEXTOID, -1, DEFAULT_COLLATION_OID, -1,
+								CStringGetTextDatum(sql), false, false),
+					  makeConst(INT4OID, -1, InvalidOid, sizeof(int32),
+								Int32GetDatum(keyno), false, true),
+					  makeConst(CHAROID, -1, InvalidOid, 1,
+								CharGetDatum(locator), false, true));
+	args = lappend(args, makeConst(TEXTARRAYOID, -1, InvalidOid, -1,
+								   PointerGetDatum(construct_array(nodes, list_length(recv_nodes),
+																   TEXTOID, -1, false, 'i')),
+								   false, false));
+	args = lappend(args, makeConst(TEXTARRAYOID, -1, InvalidOid, -1,
+								   PointerGetDatum(construct_array(hosts, i,
+																   TEXTOID, -1, false, 'i')),
+								   false, false));
+	args = lappend(args, makeConst(INT4ARRAYOID, -1, InvalidOid, -1,
+								   PointerGetDatum(construct_array(ports, i,
+																   INT4OID, sizeof(int32), true, 'i')),
+								   false, false));
+	funcexpr = makeFuncExpr(F_PGXC_MOTION_FETCH, RECORDOID, args,
+							InvalidOid, InvalidOid, COERCE_EXPLICIT_CALL);
+	funcexpr->funcretset = true;
+
+	return funcexpr;
+}
+
+/*
+ * pgxc_make_motion_rte
+ * Build the RTE for the right side of a JOIN whose rows are moved between the
+ * datanodes. The right side query is run by pgxc_motion_fetch() on the
+ * datanodes of the left side, which fetches its rows from the datanodes of
+ * the right side, see create_motion_rqpath().
+ */
+static RangeTblEntry *
+pgxc_make_motion_rte(PlannerInfo *root, RemoteQueryPath *rqpath, Query *right_query,
+					 List *right_rep_tlist, Alias *right_alias)
+{
+	RangeTblEntry	*rte = makeNode(RangeTblEntry);
+	ExecNodes		*inner_en = rqpath->rightpath->rqpath_en;
+	StringInfoData	sql;
+	List			*recv_nodes = NIL;
+	int				keyno = 0;
+	char			locator = LOCATOR_TYPE_NONE;
+	ListCell		*lcell;
+
+	/* The plan is only good while the transaction wrote nothing remotely */
+	root->glob->hasMotion = true;
+
+	initStringInfo(&sql);
+	deparse_query(right_query, &sql, NIL, false, false);
+
+	if (rqpath->rqmotion == REMOTE_MOTION_REDISTRIBUTE)
+	{
+		RelOptInfo		*outerrel = rqpath->leftpath->path.parent;
+		RangeTblEntry	*outer_rte = rt_fetch(outerrel->relid, root->parse->rtable);
+		RelationLocInfo	*locinfo = GetRelationLocInfo(outer_rte->relid);
+		TargetEntry		*tle = tlist_member((Node *)rqpath->rqmotion_key,
+											right_rep_tlist);
+
+		if (!locinfo || !tle)
+			elog(ERROR, "could not find how to redistribute the rows of the join");
+		keyno = tle->resno;
+		locator = locinfo->locatorType;
+		recv_nodes = locinfo->nodeList;
+	}
+
+	rte->rtekind = RTE_FUNCTION;
+	rte->funcexpr = (Node *) pgxc_make_motion_funcexpr(sql.data, keyno, locator,
+													  recv_nodes,
+													  inner_en->nodeList);
+	foreach (lcell, right_rep_tlist)
+	{
+		Node *expr = (Node *) ((TargetEntry *) lfirst(lcell))->expr;
+
+		rte->funccoltypes = lappend_oid(rte->funccoltypes, exprType(expr));
+		rte->funccoltypmods = lappend_int(rte->funccoltypmods, exprTypmod(expr));
+		rte->funccolcollations = lappend_oid(rte->funccolcollations,
+											 exprCollation(expr));
+	}
+	rte->alias = right_alias;
+	rte->eref = copyObject(right_alias);
+	rte->lateral = false;
+	rte->inh = false;
+	rte->inFromCl = true;
+
+	pfree(sql.data);
+
+	return rte;
+}
+
+/*
+ * pgxc_motion_dml_key
+ * Find the column on which to redistribute the rows of the relation at
+ * "varno" read by an UPDATE or DELETE, see pgxc_motion_dml_rewrite(). As for
+ * a JOIN, it has to be equal to the distribution column of the result
+ * relation in the WHERE clause, and of the same type. The relation has to be
+ * an item of the FROM list, so that only the rows of the result relation of
+ * a Datanode can match the rows it receives. Returns 0 if the rows are to be
+ * broadcast.
+ */
+static AttrNumber
+pgxc_motion_dml_key(Query *query, Index varno, RelationLocInfo *result_loc_info)
+{
+	ListCell	*lcell;
+	bool		in_fromlist = false;
+
+	if (result_loc_info->partAttrNum == InvalidAttrNumber ||
+		(result_loc_info->locatorType != LOCATOR_TYPE_HASH &&
+		 result_loc_info->locatorType != LOCATOR_TYPE_MODULO))
+		return 0;
+
+	foreach (lcell, query->jointree->fromlist)
+	{
+		Node	*node = (Node *) lfirst(lcell);
+
+		if (IsA(node, RangeTblRef) && ((RangeTblRef *) node)->rtindex == varno)
+			in_fromlist = true;
+	}
+	if (!in_fromlist)
+		return 0;
+
+	foreach (lcell, make_ands_implicit((Expr *) query->jointree->quals))
+	{
+		OpExpr	*op = (OpExpr *) lfirst(lcell);
+		Var		*larg;
+		Var		*rarg;
+
+		if (!IsA(op, OpExpr) || list_length(op->args) != 2)
+			continue;
+
+		larg = (Var *) strip_implicit_coercions(linitial(op->args));
+		rarg = (Var *) strip_implicit_coercions(lsecond(op->args));
+		if (!IsA(larg, Var) || !IsA(rarg, Var) ||
+			larg->varlevelsup != 0 || rarg->varlevelsup != 0 ||
+			exprType((Node *) larg) != exprType((Node *) rarg))
+			continue;
+
+		if (!op_mergejoinable(op->opno, exprType((Node *) larg)) &&
+			!op_hashjoinable(op->opno, exprType((Node *) larg)))
+			continue;
+
+		if (rarg->varno == query->resultRelation)
+		{
+			Var *tmp = larg;
+
+			larg = rarg;
+			rarg = tmp;
+		}
+		if (larg->varno == query->resultRelation &&
+			larg->varattno == result_loc_info->partAttrNum &&
+			rarg->varno == varno && rarg->varattno > 0)
+			return rarg->varattno;
+	}
+
+	return 0;
+}
+
+/*
+ * pgxc_motion_dml_rewrite
+ * Replace the relations of "motion_rtes" by calls to pgxc_motion_fetch()
+ * reading them from their Datanodes, so that the UPDATE or DELETE runs as
+ * such on the Datanodes of its result relation, see
+ * pgxc_is_motion_dml_shippable(). The RTEs are changed in place, wherever
+ * they are in the query tree. Returns copies of the RTEs replaced, to be
+ * checked for permissions and depended on by the plan.
+ */
+static List *
+pgxc_motion_dml_rewrite(Query *query, List *motion_rtes)
+{
+	RangeTblEntry	*result_rte = rt_fetch(query->resultRelation, query->rtable);
+	RelationLocInfo	*result_loc_info = GetRelationLocInfo(result_rte->relid);
+	List			*moved_rtes = NIL;
+	ListCell		*lcell;
+
+	foreach (lcell, motion_rtes)
+	{
+		RangeTblEntry	*rte = (RangeTblEntry *) lfirst(lcell);
+		RelationLocInfo	*rel_loc_info = GetRelationLocInfo(rte->relid);
+		Relation		rel;
+		TupleDesc		tupdesc;
+		StringInfoData	sql;
+		List			*colnames = NIL;
+		List			*coltypes = NIL;
+		List			*coltypmods = NIL;
+		List			*colcollations = NIL;
+		AttrNumber		keyno = 0;
+		Index			varno;
+		int				i;
+
+		/* Only a relation of the top query can be redistributed */
+		varno = 0;
+		for (i = 1; i <= list_length(query->rtable); i++)
+		{
+			if (rt_fetch(i, query->rtable) == rte)
+				varno = i;
+		}
+		if (varno)
+			keyno = pgxc_motion_dml_key(query, varno, result_loc_info);
+
+		/* Read every column, the Vars of the query keep their numbers */
+		rel = relation_open(rte->relid, NoLock);
+		tupdesc = RelationGetDescr(rel);
+		initStringInfo(&sql);
+		appendStringInfoString(&sql, "SELECT ");
+		for (i = 0; i < tupdesc->natts; i++)
+		{
+			Form_pg_attribute attr = tupdesc->attrs[i];
+
+			if (i > 0)
+				appendStringInfoString(&sql, ", ");
+			if (attr->attisdropped)
+			{
+				char	colname[NAMEDATALEN];
+
+				snprintf(colname, sizeof(colname), "pg_dropped_%d", i + 1);
+				appendStringInfoString(&sql, "NULL::pg_catalog.int4");
+				colnames = lappend(colnames, makeString(pstrdup(colname)));
+				coltypes = lappend_oid(coltypes, INT4OID);
+				coltypmods = lappend_int(coltypmods, -1);
+				colcollations = lappend_oid(colcollations, InvalidOid);
+				continue;
+			}
+			appendStringInfoString(&sql, quote_identifier(NameStr(attr->attname)));
+			colnames = lappend(colnames, copyObject(list_nth(rte->eref->colnames, i)));
+			coltypes = lappend_oid(coltypes, attr->atttypid);
+			coltypmods = lappend_int(coltypmods, attr->atttypmod);
+			colcollations = lappend_oid(colcollations, attr->attcollation);
+		}
+		appendStringInfo(&sql, " FROM ONLY %s",
+						 quote_qualified_identifier(get_namespace_name(RelationGetNamespace(rel)),
+													RelationGetRelationName(rel)));
+		relation_close(rel, NoLock);
+
+		moved_rtes = lappend(moved_rtes, copyObject(rte));
+
+		rte->rtekind = RTE_FUNCTION;
+		rte->relid = InvalidOid;
+		rte->relkind = 0;
+		rte->inh = false;
+		rte->requiredPerms = 0;
+		rte->checkAsUser = InvalidOid;
+		rte->selectedCols = NULL;
+		rte->modifiedCols = NULL;
+		rte->funcexpr = (Node *)
+			pgxc_make_motion_funcexpr(sql.data, keyno,
+									  keyno ? result_loc_info->locatorType : LOCATOR_TYPE_NONE,
+									  keyno ? result_loc_info->nodeList : NIL,
+									  rel_loc_info->nodeList);
+		rte->funccoltypes = coltypes;
+		rte->funccoltypmods = coltypmods;
+		rte->funccolcollations = colcollations;
+		rte->alias = makeAlias(rte->eref->aliasname, colnames);
+		rte->eref = copyObject(rte->alias);
+
+		pfree(sql.data);
+		FreeRelationLocInfo(rel_loc_info);
+	}
+	FreeRelationLocInfo(result_loc_info);
+
+	return moved_rtes;
+}
+#endif
+
 /*
  * pgxc_build_shippable_query_jointree
  * builds a shippable Query structure for a join relation. Since there are only
@@ -432,6 +760,12 @@ pgxc_build_shippable_query_jointree(PlannerInfo *root, RemoteQueryPath *rqpath,
 	 * through this function. See notes in prologue of
 	 * create_remotequery_path().
 	 */
+#ifdef ADB
+	if (rqpath->rqmotion != REMOTE_MOTION_NONE)
+		right_rte = pgxc_make_motion_rte(root, rqpath, right_query,
+										 right_rep_tlist, right_alias);
+	else
+#endif
 	right_rte = addRangeTableEntryForSubquery(NULL, right_query, right_alias,
 											  false, false);
 	rtable = lappend(rtable, right_rte);
@@ -1459,9 +1793,12 @@ create_remotedml_plan(PlannerInfo *root, Plan *topplan, CmdType cmdtyp)
 			fstep->exec_nodes->accesstype = accessType;
 			fstep->exec_nodes->baselocatortype = rel_loc_info->locatorType;
 			fstep->exec_nodes->primarynodelist = NULL;
-			fstep->exec_nodes->nodeList = rel_loc_info->nodeList;
 #ifdef ADB
+			/* The node list belongs to the relcache */
+			fstep->exec_nodes->nodeList = list_copy(rel_loc_info->nodeList);
 			fstep->exec_nodes->en_funcid = rel_loc_info->funcid;
+#else
+			fstep->exec_nodes->nodeList = rel_loc_info->nodeList;
 #endif
 		}
 		else
@@ -1654,6 +1991,16 @@ create_remotegrouping_plan(PlannerInfo *root, Plan *local_plan)
 		single_node_grouping = true;
 	else
 		single_node_grouping = false;
+#ifdef ADB
+	/*
+	 * DISTINCT aggregates need all the distinct values of their group, they
+	 * can not be transitioned on the datanodes. But duplicates can be
+	 * removed there already.
+	 */
+	if (!single_node_grouping && IsA(local_plan, Agg) &&
+		pgxc_has_only_distinct_aggs(local_plan))
+		return pgxc_remote_distinct_agg_plan(root, local_plan, remote_scan);
+#endif
 	/*
 	 * If we are able to completely evaluate the aggregates on datanodes, we
 	 * need to ask datanode/s to finalise the aggregates
@@ -1768,6 +2115,132 @@ create_remotegrouping_plan(PlannerInfo *root, Plan *local_plan)
 	}
 }
 
+#ifdef ADB
+/*
+ * pgxc_has_only_distinct_aggs
+ * Are all the aggregates computed by the Agg plan DISTINCT aggregates, whose
+ * result does not change when duplicate input rows are removed?
+ */
+static bool
+pgxc_has_only_distinct_aggs(Plan *agg_plan)
+{
+	List		*aggs_n_vars;
+	ListCell	*lcell;
+	bool		has_aggs = false;
+
+	aggs_n_vars = list_concat(pull_var_clause((Node *)agg_plan->targetlist,
+											  PVC_INCLUDE_AGGREGATES,
+											  PVC_RECURSE_PLACEHOLDERS),
+							  pull_var_clause((Node *)agg_plan->qual,
+											  PVC_INCLUDE_AGGREGATES,
+											  PVC_RECURSE_PLACEHOLDERS));
+	foreach (lcell, aggs_n_vars)
+	{
+		Aggref	*aggref = (Aggref *)lfirst(lcell);
+
+		if (!IsA(aggref, Aggref))
+			continue;
+		if (!aggref->aggdistinct || aggref->agglevelsup)
+			return false;
+		has_aggs = true;
+	}
+	list_free(aggs_n_vars);
+
+	return has_aggs;
+}
+
+/*
+ * pgxc_remote_distinct_agg_plan
+ * The Agg plan computes DISTINCT aggregates only, see
+ * pgxc_has_only_distinct_aggs(). Let the datanodes group the rows by all the
+ * columns the Agg plan gets from the RemoteQuery underneath, so that each
+ * datanode sends every distinct input row once. The Agg plan then computes
+ * the aggregates from those rows as usual.
+ */
+static Plan *
+pgxc_remote_distinct_agg_plan(PlannerInfo *root, Plan *agg_plan,
+							  RemoteQuery *remote_scan)
+{
+	Query			*remote_query = remote_scan->remote_query;
+	List			*group_clause = NIL;
+	Index			next_ressortgrpref = 1;
+	ListCell		*lcell;
+	ListCell		*lcell2;
+	RangeTblEntry	*dummy_rte;
+
+	if (remote_query->groupClause || remote_query->distinctClause ||
+		remote_query->hasAggs || remote_query->sortClause ||
+		remote_query->limitCount || remote_query->limitOffset)
+		return agg_plan;
+
+	foreach (lcell, remote_query->targetList)
+	{
+		TargetEntry	*tle = (TargetEntry *)lfirst(lcell);
+
+		if (tle->ressortgroupref >= next_ressortgrpref)
+			next_ressortgrpref = tle->ressortgroupref + 1;
+	}
+
+	foreach (lcell, remote_query->targetList)
+	{
+		TargetEntry		*tle = (TargetEntry *)lfirst(lcell);
+		SortGroupClause	*grpcl;
+		Oid				sortop;
+		Oid				eqop;
+		bool			hashable;
+
+		if (tle->resjunk)
+			return agg_plan;
+
+		/* Without an equality operator, duplicates can not be found */
+		get_sort_group_operators(exprType((Node *)tle->expr), false, false,
+								 false, &sortop, &eqop, NULL, &hashable);
+		if (!OidIsValid(eqop))
+			return agg_plan;
+
+		grpcl = makeNode(SortGroupClause);
+		grpcl->tleSortGroupRef = tle->ressortgroupref > 0 ?
+									tle->ressortgroupref : next_ressortgrpref++;
+		grpcl->eqop = eqop;
+		grpcl->sortop = sortop;
+		grpcl->nulls_first = false;
+		grpcl->hashable = hashable;
+		group_clause = lappend(group_clause, grpcl);
+	}
+
+	if (!group_clause)
+		return agg_plan;
+
+	/*
+	 * Every column is grouped. Set the sortgroupref numbers in base_tlist as
+	 * well, in case the targetlist to be sent to the datanodes is rebuilt.
+	 */
+	forboth (lcell, remote_query->targetList, lcell2, group_clause)
+	{
+		TargetEntry		*tle = (TargetEntry *)lfirst(lcell);
+		SortGroupClause	*grpcl = (SortGroupClause *)lfirst(lcell2);
+		TargetEntry		*base_tle = get_tle_by_resno(remote_scan->base_tlist,
+													 tle->resno);
+
+		tle->ressortgroupref = grpcl->tleSortGroupRef;
+		if (base_tle)
+			base_tle->ressortgroupref = grpcl->tleSortGroupRef;
+	}
+	remote_query->groupClause = group_clause;
+
+	/* Use index into targetlist for GROUP BY clause instead of expressions */
+	remote_scan->rq_sortgroup_colno = true;
+	pgxc_rqplan_build_statement(remote_scan);
+
+	/* Change the dummy RTE added to show the new place of reduction */
+	dummy_rte = rt_fetch(remote_scan->scan.scanrelid, root->parse->rtable);
+	dummy_rte->relname = "__REMOTE_GROUP_QUERY__";
+	dummy_rte->eref = makeAlias("__REMOTE_GROUP_QUERY__", NIL);
+
+	return agg_plan;
+}
+#endif
+
 /*
  * pgxc_locate_grouping_columns
  * Locates the grouping clauses in the given target list. This is very similar
@@ -2094,6 +2567,10 @@ pgxc_set_en_expr(Oid tableoid, Index resultRelationIndex)
 	 * XXX Need further testing for replicated and round-robin tables
 	 */
 	if (rel_loc_info->locatorType == LOCATOR_TYPE_HASH ||
+#ifdef ADB
+		rel_loc_info->locatorType == LOCATOR_TYPE_BUCKET ||
+		IsRelationDistributedByRangeOrList(rel_loc_info) ||
+#endif
 		rel_loc_info->locatorType == LOCATOR_TYPE_MODULO)
 	{
 		tp = SearchSysCache(ATTNUM,
@@ -2176,6 +2653,10 @@ pgxc_set_en_expr(Oid tableoid, Index resultRelationIndex)
 	 * XXX Need further testing for replicated and round-robin tables
 	 */
 	if (rel_loc_info->locatorType != LOCATOR_TYPE_HASH &&
+#ifdef ADB
+		rel_loc_info->locatorType != LOCATOR_TYPE_BUCKET &&
+		!IsRelationDistributedByRangeOrList(rel_loc_info) &&
+#endif
 		rel_loc_info->locatorType != LOCATOR_TYPE_MODULO)
 		return NULL;
 
@@ -2555,6 +3036,9 @@ pgxc_handle_exec_direct(Query *query, int cursorOptions,
 			result = makeNode(PlannedStmt);
 			/* Try and set what we can, rest must have been zeroed out by makeNode() */
 			result->commandType = query->commandType;
+#ifdef ADB
+			result->queryId = query->queryId;
+#endif
 			result->canSetTag = query->canSetTag;
 			/* Set result relations */
 			if (query->commandType != CMD_SELECT)
@@ -2717,6 +3201,11 @@ pgxc_FQS_planner(Query *query, int cursorOptions, ParamListInfo boundParams)
 	PlannerInfo		*root;
 	ExecNodes		*exec_nodes;
 	Plan			*top_plan;
+#ifdef ADB
+	List			*motion_rtes = NIL;
+	List			*moved_rtes = NIL;
+	Oid				shipped_funcid = InvalidOid;
+#endif
 
 	/* Try by-passing standard planner, if fast query shipping is enabled */
 	if (!enable_fast_query_shipping)
@@ -2738,6 +3227,26 @@ pgxc_FQS_planner(Query *query, int cursorOptions, ParamListInfo boundParams)
 		 */
 		if (exec_nodes == NULL)
 			exec_nodes = pgxc_is_query_shippable(query, 0);
+
+		/*
+		 * An UPDATE or DELETE reading other distributed relations can still be
+		 * run as such on the Datanodes of its result relation, once the rows
+		 * it reads are moved there. As for the JOINs whose rows are moved, the
+		 * rows are read in other sessions, see create_motion_rqpath().
+		 */
+		if (exec_nodes == NULL && enable_datanode_motion && !XactHasRemoteWrites())
+		{
+			exec_nodes = pgxc_is_motion_dml_shippable(query, &motion_rtes);
+			if (exec_nodes)
+				moved_rtes = pgxc_motion_dml_rewrite(query, motion_rtes);
+		}
+
+		/*
+		 * A call of a function running all its statements on the Datanode of
+		 * one of its arguments is run there as a whole.
+		 */
+		if (exec_nodes == NULL)
+			exec_nodes = pgxc_is_func_call_shippable(query, &shipped_funcid);
 #else
 		exec_nodes = pgxc_is_query_shippable(query, 0);
 #endif
@@ -2759,6 +3268,14 @@ pgxc_FQS_planner(Query *query, int cursorOptions, ParamListInfo boundParams)
 	 * for the same.
 	 */
 	top_plan = (Plan *)pgxc_FQS_create_remote_plan(query, exec_nodes, false);
+#ifdef ADB
+	/* The relations moved are still checked for permissions and locked */
+	query->rtable = list_concat(query->rtable, moved_rtes);
+
+	/* The function may write, it is not read only as the SELECT calling it */
+	if (OidIsValid(shipped_funcid))
+		((RemoteQuery *) top_plan)->read_only = false;
+#endif
 	/*
 	 * If creating a plan for a scrollable cursor, make sure it can run
 	 * backwards on demand.  Add a Material node at the top at need.
@@ -2792,11 +3309,26 @@ pgxc_FQS_planner(Query *query, int cursorOptions, ParamListInfo boundParams)
 	 * through set_plan_references().
 	 */
 	top_plan = set_plan_references(root, top_plan);
+#ifdef ADB
+	/*
+	 * The plan holds as long as the function setting and the distribution
+	 * of the relation it gives do.
+	 */
+	if (OidIsValid(shipped_funcid))
+	{
+		record_plan_function_dependency(root, shipped_funcid);
+		glob->relationOids = lappend_oid(glob->relationOids,
+										 exec_nodes->en_relid);
+	}
+#endif
 
 	/* build the PlannedStmt result */
 	result = makeNode(PlannedStmt);
 	/* Try and set what we can, rest must have been zeroed out by makeNode() */
 	result->commandType = query->commandType;
+#ifdef ADB
+	result->queryId = query->queryId;
+#endif
 	result->canSetTag = query->canSetTag;
 	result->utilityStmt = query->utilityStmt;
 
@@ -2807,6 +3339,9 @@ pgxc_FQS_planner(Query *query, int cursorOptions, ParamListInfo boundParams)
 	result->rtable = query->rtable;
 	result->relationOids = glob->relationOids;
 	result->invalItems = glob->invalItems;
+#ifdef ADB
+	result->hasMotion = (moved_rtes != NIL);
+#endif
 
 	/*
 	 * If query is DECLARE CURSOR fetch CTIDs and node names from the remote node
@@ -3364,7 +3899,8 @@ create_remotesort_plan(PlannerInfo *root, Plan *local_plan)
 /*
  * create_remotelimit_plan
  * Check if we can incorporate the LIMIT clause into the RemoteQuery node if the
- * node under the Limit node is a RemoteQuery node. If yes then do so.
+ * node under the Limit node is a RemoteQuery node, possibly under a Sort
+ * merging the sorted results of the Datanodes. If yes then do so.
  * If there is only one Datanode involved in the execution of RemoteQuery, we
  * don't need the covering Limit node, both limitcount and limitoffset can be
  * pushed to the RemoteQuery node.
@@ -3409,6 +3945,19 @@ create_remotelimit_plan(PlannerInfo *root, Plan *local_plan)
 	 * only after these operations have been performed. Hence can not push LIMIT
 	 * or OFFSET to Datanodes.
 	 */
+#ifdef ADB
+	/*
+	 * A Sort merging the rows the Datanodes already sorted, see
+	 * create_remotesort_plan(), keeps them in the order of each Datanode. The
+	 * first rows of the merged result are among the first rows of each
+	 * Datanode, so LIMIT can be pushed through such a Sort.
+	 */
+	if (temp_plan && IsA(temp_plan, Sort) &&
+		((Sort *)temp_plan)->srt_start_merge &&
+		temp_plan->lefttree && IsA(temp_plan->lefttree, RemoteQuery) &&
+		((RemoteQuery *)temp_plan->lefttree)->remote_query->sortClause)
+		temp_plan = temp_plan->lefttree;
+#endif
 	if (temp_plan && IsA(temp_plan, RemoteQuery))
 	{
 		remote_scan = (RemoteQuery *)temp_plan;
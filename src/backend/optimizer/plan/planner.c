@@ -63,6 +63,9 @@ planner_hook_type planner_hook = NULL;
 #define EXPRKIND_LIMIT			6
 #define EXPRKIND_APPINFO		7
 #define EXPRKIND_PHV			8
+#ifdef ADB
+#define EXPRKIND_TABLESAMPLE	9
+#endif
 
 /* Passthrough data for standard_qp_callback */
 typedef struct
@@ -192,6 +195,9 @@ standard_planner(Query *parse, int cursorOptions, ParamListInfo boundParams)
 	glob->lastPHId = 0;
 	glob->lastRowMarkId = 0;
 	glob->transientPlan = false;
+#ifdef ADB
+	glob->hasMotion = false;
+#endif
 
 	/* Determine what fraction of the plan is likely to be scanned */
 	if (cursorOptions & CURSOR_OPT_FAST_PLAN)
@@ -259,6 +265,9 @@ standard_planner(Query *parse, int cursorOptions, ParamListInfo boundParams)
 	result->hasModifyingCTE = parse->hasModifyingCTE;
 	result->canSetTag = parse->canSetTag;
 	result->transientPlan = glob->transientPlan;
+#ifdef ADB
+	result->hasMotion = glob->hasMotion;
+#endif
 	result->planTree = top_plan;
 	result->rtable = glob->finalrtable;
 	result->resultRelations = glob->resultRelations;
@@ -494,6 +503,17 @@ subquery_planner(PlannerGlobal *glob, Query *parse,
 		RangeTblEntry *rte = (RangeTblEntry *) lfirst(l);
 		int			kind;
 
+#ifdef ADB
+		if (rte->rtekind == RTE_RELATION)
+		{
+			/* Preprocess the TABLESAMPLE arguments, if any */
+			if (rte->tablesample)
+				rte->tablesample = (TableSampleClause *)
+					preprocess_expression(root, (Node *) rte->tablesample,
+										  EXPRKIND_TABLESAMPLE);
+		}
+		else
+#endif /* ADB */
 		if (rte->rtekind == RTE_SUBQUERY)
 		{
 			/*
@@ -673,6 +693,9 @@ preprocess_expression(PlannerInfo *root, Node *expr, int kind)
 	 * since they can't contain any Vars of the current query level.
 	 */
 	if (root->hasJoinRTEs &&
+#ifdef ADB
+		kind != EXPRKIND_TABLESAMPLE &&
+#endif
 		!(kind == EXPRKIND_RTFUNC || kind == EXPRKIND_VALUES))
 		expr = flatten_join_alias_vars(root, expr);
 
@@ -494,7 +494,7 @@ make_subplan(PlannerInfo *root, Query *orig_subquery, SubLinkType subLinkType,
 	/* And convert to SubPlan or InitPlan format. */
 	result = build_subplan(root, plan, subroot, plan_params,
 						   subLinkType, testexpr, true, isTopQual);
-#ifdef PGXC
+#if defined(PGXC) && !defined(ADB)
 	/* This is not necessary for a PGXC Coordinator, we just need one plan */
 	if (IS_PGXC_COORDINATOR && !IsConnFromCoord())
 		return result;
@@ -507,7 +507,10 @@ make_subplan(PlannerInfo *root, Query *orig_subquery, SubLinkType subLinkType,
 	 * likely to be better (it depends on the expected number of executions of
 	 * the EXISTS qual, and we are much too early in planning the outer query
 	 * to be able to guess that).  So we generate both plans, if possible, and
-	 * leave it to the executor to decide which to use.
+	 * leave it to the executor to decide which to use.  On a Coordinator
+	 * the correlated plan goes through all the rows fetched from the
+	 * Datanodes for each outer row, while the hashed one fetches them once
+	 * and then only probes its hash table.
 	 */
 	if (simple_exists && IsA(result, SubPlan))
 	{
@@ -2096,6 +2099,14 @@ finalize_plan(PlannerInfo *root, Plan *plan, Bitmapset *valid_params,
 			context.paramids = bms_add_members(context.paramids, scan_params);
 			break;
 
+#ifdef ADB
+		case T_SampleScan:
+			finalize_primnode((Node *) ((SampleScan *) plan)->tablesample,
+							  &context);
+			context.paramids = bms_add_members(context.paramids, scan_params);
+			break;
+#endif
+
 		case T_IndexScan:
 			finalize_primnode((Node *) ((IndexScan *) plan)->indexqual,
 							  &context);
@@ -0,0 +1,738 @@
+/*-------------------------------------------------------------------------
+ *
+ * partprune.c
+ *	  Pruning of the children of inheritance-partitioned tables
+ *
+ * relation_excluded_by_constraints() disproves each child of an appendrel
+ * in turn with predicate_refuted_by(), reading and simplifying its CHECK
+ * constraints again for every query.  With hundreds of children that is
+ * most of the planning time.  Here the constraints of the children which
+ * only bound one column of the parent by constants are reduced once to a
+ * range of that column, the ranges kept sorted by lower bound in a cache
+ * entry of the parent, and the children whose range misses the one the
+ * query asks for are found by binary search.  Children with constraints
+ * of another form are left to relation_excluded_by_constraints().
+ *
+ * An entry is dropped when the relcache entry of the parent or of one of
+ * its children is invalidated, which covers the changes of constraints and
+ * the dropped children; a child added to the parent is noticed since the
+ * children of the appendrel are then no longer those of the entry.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/optimizer/util/partprune.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/heapam.h"
+#include "access/nbtree.h"
+#include "catalog/pg_am.h"
+#include "commands/defrem.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/clauses.h"
+#include "optimizer/cost.h"
+#include "optimizer/partprune.h"
+#include "optimizer/prep.h"
+#include "utils/array.h"
+#include "utils/datum.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+
+typedef struct PartBoundValue
+{
+	bool		infinite;		/* no bound on this side */
+	bool		inclusive;
+	Datum		value;
+} PartBoundValue;
+
+typedef struct PartBound
+{
+	PartBoundValue lower;
+	PartBoundValue upper;
+	int			child;			/* index in PartBoundCache.children */
+} PartBound;
+
+typedef struct PartBoundCache
+{
+	Oid			parentid;		/* hash key */
+	MemoryContext context;		/* holds what the fields point to */
+	int			nchildren;
+	Oid		   *children;		/* OIDs of all the children, sorted */
+	AttrNumber	keyattno;		/* bounded column of the parent */
+	Oid			keytype;
+	Oid			keycoll;
+	Oid			opfamily;		/* default btree family of keytype */
+	FmgrInfo	cmpproc;
+	int			nbounds;
+	PartBound  *bounds;			/* ranges of the children, by lower bound */
+	bool		disjoint;		/* no two ranges overlap */
+	bool		valid;			/* false if invalidated while in use */
+} PartBoundCache;
+
+static HTAB *PartBoundCacheHash = NULL;
+
+/* entry being used, that an invalidation must not free */
+static PartBoundCache *PartBoundActive = NULL;
+
+static PartBoundCache *partbound_build(PlannerInfo *root, Oid parentid,
+				List *appinfos);
+static bool partbound_set_key(PartBoundCache *entry, List *clauses,
+				  AppendRelInfo *appinfo);
+static bool partbound_narrow(PartBoundCache *entry, Expr *clause,
+				 Index varno, AttrNumber attno, PartBound *range);
+static void partbound_tighten(PartBoundCache *entry, PartBound *range,
+				  int strategy, Datum value);
+static bool partbound_below(PartBoundCache *entry, PartBoundValue *upper,
+				PartBoundValue *lower);
+static int32 partbound_cmp(PartBoundCache *entry, Datum a, Datum b);
+static void partbound_release(PartBoundCache *entry);
+static int	partbound_lower_cmp(const void *a, const void *b, void *arg);
+static int	oid_cmp(const void *a, const void *b);
+static void partbound_relcallback(Datum arg, Oid relid);
+
+/*
+ * prune_inherited_children
+ *
+ * Return the RT indexes of the children of the inheritance appendrel "rel"
+ * which the ranges cached for it prove need not be scanned, NULL if there
+ * is none or the cache does not apply.
+ */
+Bitmapset *
+prune_inherited_children(PlannerInfo *root, RelOptInfo *rel,
+						 Index rti, RangeTblEntry *rte)
+{
+	PartBoundCache *entry;
+	PartBound	range;
+	List	   *appinfos = NIL;
+	Index	   *child_rti;
+	Bitmapset  *result = NULL;
+	bool		narrowed = false;
+	bool		found;
+	ListCell   *lc;
+	int			first;
+	int			last;
+	int			i;
+
+	/* an error may have left an entry in use */
+	if (PartBoundActive)
+		partbound_release(PartBoundActive);
+
+	if (constraint_exclusion == CONSTRAINT_EXCLUSION_OFF ||
+		rte->rtekind != RTE_RELATION || !rte->inh ||
+		rel->baserestrictinfo == NIL)
+		return NULL;
+
+	foreach(lc, root->append_rel_list)
+	{
+		AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(lc);
+
+		if (appinfo->parent_relid == rti)
+			appinfos = lappend(appinfos, appinfo);
+	}
+
+	if (PartBoundCacheHash == NULL)
+	{
+		HASHCTL		ctl;
+
+		MemSet(&ctl, 0, sizeof(ctl));
+		ctl.keysize = sizeof(Oid);
+		ctl.entrysize = sizeof(PartBoundCache);
+		ctl.hash = oid_hash;
+		PartBoundCacheHash = hash_create("Partition bound cache", 64, &ctl,
+										 HASH_ELEM | HASH_FUNCTION);
+		CacheRegisterRelcacheCallback(partbound_relcallback, (Datum) 0);
+	}
+
+	entry = (PartBoundCache *) hash_search(PartBoundCacheHash, &rte->relid,
+										   HASH_FIND, NULL);
+
+	/* map the children of the entry to their RT index, checking them */
+	child_rti = NULL;
+	if (entry && entry->nchildren == list_length(appinfos))
+	{
+		child_rti = (Index *) palloc0(entry->nchildren * sizeof(Index));
+		foreach(lc, appinfos)
+		{
+			AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(lc);
+			Oid			childid = root->simple_rte_array[appinfo->child_relid]->relid;
+			Oid		   *pos;
+
+			pos = (Oid *) bsearch(&childid, entry->children, entry->nchildren,
+								  sizeof(Oid), oid_cmp);
+			if (pos == NULL)
+				break;
+			child_rti[pos - entry->children] = appinfo->child_relid;
+		}
+		if (lc != NULL)
+		{
+			pfree(child_rti);
+			child_rti = NULL;
+		}
+	}
+
+	if (child_rti == NULL)
+	{
+		PartBoundCache *newentry;
+
+		if (entry)
+		{
+			MemoryContextDelete(entry->context);
+			hash_search(PartBoundCacheHash, &rte->relid, HASH_REMOVE, NULL);
+		}
+
+		newentry = partbound_build(root, rte->relid, appinfos);
+		entry = (PartBoundCache *) hash_search(PartBoundCacheHash, &rte->relid,
+											   HASH_ENTER, &found);
+		*entry = *newentry;
+		pfree(newentry);
+
+		child_rti = (Index *) palloc0(entry->nchildren * sizeof(Index));
+		foreach(lc, appinfos)
+		{
+			AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(lc);
+			Oid			childid = root->simple_rte_array[appinfo->child_relid]->relid;
+			Oid		   *pos;
+
+			pos = (Oid *) bsearch(&childid, entry->children, entry->nchildren,
+								  sizeof(Oid), oid_cmp);
+			Assert(pos != NULL);
+			child_rti[pos - entry->children] = appinfo->child_relid;
+		}
+	}
+
+	if (entry->nbounds == 0)
+		return NULL;
+
+	/*
+	 * The lookups of operators below may accept invalidation messages; the
+	 * children being locked, only a reset of the caches can come, and the
+	 * entry is then dropped once done with.
+	 */
+	PartBoundActive = entry;
+	entry->valid = true;
+
+	/* the range of the key the query asks for */
+	MemSet(&range, 0, sizeof(range));
+	range.lower.infinite = true;
+	range.upper.infinite = true;
+	foreach(lc, rel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		if (rinfo->pseudoconstant)
+			continue;
+		if (partbound_narrow(entry, rinfo->clause, rti, entry->keyattno,
+							 &range))
+			narrowed = true;
+	}
+	if (!narrowed)
+	{
+		partbound_release(entry);
+		return NULL;
+	}
+
+	/*
+	 * When the ranges do not overlap, their upper bounds are sorted too, so
+	 * the children which may match are between the first one not ending
+	 * below the query range and the last one not starting above it.
+	 */
+	first = 0;
+	last = entry->nbounds - 1;
+	if (entry->disjoint)
+	{
+		int			lo;
+		int			hi;
+
+		lo = 0;
+		hi = entry->nbounds;
+		while (lo < hi)
+		{
+			int			mid = (lo + hi) / 2;
+
+			if (partbound_below(entry, &entry->bounds[mid].upper, &range.lower))
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		first = lo;
+
+		lo = first;
+		hi = entry->nbounds;
+		while (lo < hi)
+		{
+			int			mid = (lo + hi) / 2;
+
+			if (partbound_below(entry, &range.upper, &entry->bounds[mid].lower))
+				hi = mid;
+			else
+				lo = mid + 1;
+		}
+		last = lo - 1;
+	}
+
+	for (i = 0; i < entry->nbounds; i++)
+	{
+		PartBound  *bound = &entry->bounds[i];
+
+		if (i < first || i > last ||
+			partbound_below(entry, &bound->upper, &range.lower) ||
+			partbound_below(entry, &range.upper, &bound->lower))
+			result = bms_add_member(result, child_rti[bound->child]);
+	}
+	partbound_release(entry);
+
+	return result;
+}
+
+/* Done with the entry, drop it if it was invalidated meanwhile */
+static void
+partbound_release(PartBoundCache *entry)
+{
+	PartBoundActive = NULL;
+	if (!entry->valid)
+	{
+		Oid			parentid = entry->parentid;
+
+		MemoryContextDelete(entry->context);
+		hash_search(PartBoundCacheHash, &parentid, HASH_REMOVE, NULL);
+	}
+}
+
+/*
+ * Build the cache entry of "parentid" from the children of its appendrel,
+ * returned palloc'd for the caller to copy into the hash table.
+ */
+static PartBoundCache *
+partbound_build(PlannerInfo *root, Oid parentid, List *appinfos)
+{
+	PartBoundCache *entry;
+	MemoryContext oldcontext;
+	ListCell   *lc;
+	int			i;
+
+	entry = (PartBoundCache *) palloc0(sizeof(PartBoundCache));
+	entry->parentid = parentid;
+	entry->context = AllocSetContextCreate(CacheMemoryContext,
+										   "partition bounds",
+										   ALLOCSET_SMALL_MINSIZE,
+										   ALLOCSET_SMALL_INITSIZE,
+										   ALLOCSET_DEFAULT_MAXSIZE);
+
+	entry->nchildren = list_length(appinfos);
+	entry->children = (Oid *) MemoryContextAlloc(entry->context,
+												 entry->nchildren * sizeof(Oid));
+	entry->bounds = (PartBound *)
+		MemoryContextAlloc(entry->context,
+						   entry->nchildren * sizeof(PartBound));
+	i = 0;
+	foreach(lc, appinfos)
+	{
+		AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(lc);
+
+		entry->children[i++] = root->simple_rte_array[appinfo->child_relid]->relid;
+	}
+	qsort(entry->children, entry->nchildren, sizeof(Oid), oid_cmp);
+
+	foreach(lc, appinfos)
+	{
+		AppendRelInfo *appinfo = (AppendRelInfo *) lfirst(lc);
+		Oid			childid = root->simple_rte_array[appinfo->child_relid]->relid;
+		PartBound	bound;
+		Relation	relation;
+		TupleConstr *constr;
+		List	   *clauses = NIL;
+		ListCell   *clc;
+		Var		   *keyvar;
+		bool		simple = true;
+
+		/* the children were locked when the appendrel was expanded */
+		relation = heap_open(childid, NoLock);
+		constr = relation->rd_att->constr;
+		for (i = 0; constr != NULL && i < constr->num_check; i++)
+		{
+			Node	   *cexpr;
+
+			if (!constr->check[i].ccvalid)
+				continue;
+
+			/* processed as in get_relation_constraints() */
+			cexpr = stringToNode(constr->check[i].ccbin);
+			cexpr = eval_const_expressions(NULL, cexpr);
+			cexpr = (Node *) canonicalize_qual((Expr *) cexpr);
+			clauses = list_concat(clauses, make_ands_implicit((Expr *) cexpr));
+		}
+		heap_close(relation, NoLock);
+
+		if (clauses == NIL || !partbound_set_key(entry, clauses, appinfo))
+			continue;
+
+		/* the child column of the key, in the child's CHECK constraints */
+		keyvar = (Var *) list_nth(appinfo->translated_vars,
+								  entry->keyattno - 1);
+		if (keyvar == NULL || !IsA(keyvar, Var))
+			continue;
+
+		MemSet(&bound, 0, sizeof(bound));
+		bound.lower.infinite = true;
+		bound.upper.infinite = true;
+		oldcontext = MemoryContextSwitchTo(entry->context);
+		foreach(clc, clauses)
+		{
+			Expr	   *clause = (Expr *) lfirst(clc);
+
+			/* a NOT NULL on the key does not change its range */
+			if (IsA(clause, NullTest) &&
+				((NullTest *) clause)->nulltesttype == IS_NOT_NULL &&
+				IsA(((NullTest *) clause)->arg, Var) &&
+				((Var *) ((NullTest *) clause)->arg)->varattno == keyvar->varattno)
+				continue;
+
+			if (!partbound_narrow(entry, clause, 1, keyvar->varattno, &bound))
+			{
+				simple = false;
+				break;
+			}
+		}
+		MemoryContextSwitchTo(oldcontext);
+
+		/* an empty range is left to predicate_refuted_by() */
+		if (!simple || (bound.lower.infinite && bound.upper.infinite) ||
+			partbound_below(entry, &bound.upper, &bound.lower))
+			continue;
+
+		bound.child = (Oid *) bsearch(&childid, entry->children,
+									  entry->nchildren, sizeof(Oid),
+									  oid_cmp) - entry->children;
+		entry->bounds[entry->nbounds++] = bound;
+	}
+
+	if (entry->nbounds > 0)
+	{
+		qsort_arg(entry->bounds, entry->nbounds, sizeof(PartBound),
+				  partbound_lower_cmp, entry);
+
+		entry->disjoint = true;
+		for (i = 0; i < entry->nbounds - 1; i++)
+		{
+			if (!partbound_below(entry, &entry->bounds[i].upper,
+								 &entry->bounds[i + 1].lower))
+			{
+				entry->disjoint = false;
+				break;
+			}
+		}
+	}
+
+	return entry;
+}
+
+/*
+ * Choose the key of the entry, when it has none yet, from the column of
+ * the parent the first btree comparison of "clauses" bounds.  Returns
+ * whether the entry has a key then.
+ */
+static bool
+partbound_set_key(PartBoundCache *entry, List *clauses,
+				  AppendRelInfo *appinfo)
+{
+	ListCell   *lc;
+
+	if (entry->keyattno != InvalidAttrNumber)
+		return true;
+
+	foreach(lc, clauses)
+	{
+		Expr	   *clause = (Expr *) lfirst(lc);
+		Var		   *var = NULL;
+		Oid			opclass;
+		Oid			opfamily;
+		Oid			cmpproc;
+		ListCell   *vlc;
+		AttrNumber	attno;
+
+		if (!is_opclause(clause) || list_length(((OpExpr *) clause)->args) != 2)
+			continue;
+		if (IsA(get_leftop(clause), Var) && IsA(get_rightop(clause), Const))
+			var = (Var *) get_leftop(clause);
+		else if (IsA(get_rightop(clause), Var) && IsA(get_leftop(clause), Const))
+			var = (Var *) get_rightop(clause);
+		else
+			continue;
+
+		opclass = GetDefaultOpClass(var->vartype, BTREE_AM_OID);
+		if (!OidIsValid(opclass))
+			continue;
+		opfamily = get_opclass_family(opclass);
+		if (get_op_opfamily_strategy(((OpExpr *) clause)->opno, opfamily) == 0)
+			continue;
+		cmpproc = get_opfamily_proc(opfamily, var->vartype, var->vartype,
+									BTORDER_PROC);
+		if (!OidIsValid(cmpproc))
+			continue;
+
+		/* find the column of the parent */
+		attno = 0;
+		foreach(vlc, appinfo->translated_vars)
+		{
+			Var		   *childvar = (Var *) lfirst(vlc);
+
+			attno++;
+			if (childvar && IsA(childvar, Var) &&
+				childvar->varattno == var->varattno)
+				break;
+		}
+		if (vlc == NULL)
+			continue;
+
+		fmgr_info_cxt(cmpproc, &entry->cmpproc, entry->context);
+		entry->opfamily = opfamily;
+		entry->keyattno = attno;
+		entry->keytype = var->vartype;
+		entry->keycoll = var->varcollid;
+		return true;
+	}
+
+	return false;
+}
+
+/*
+ * Narrow "range" by "clause" if it compares the column "attno" of "varno"
+ * with a constant by an operator of the family of the key, or is such a
+ * column = ANY (array) comparison.  Returns false if the clause has another
+ * form.  The values are copied in the current memory context.
+ */
+static bool
+partbound_narrow(PartBoundCache *entry, Expr *clause, Index varno,
+				 AttrNumber attno, PartBound *range)
+{
+	Node	   *leftop;
+	Node	   *rightop;
+	Oid			opno;
+	Oid			inputcollid;
+	Var		   *var;
+	Const	   *cst;
+	int			strategy;
+	bool		commuted = false;
+
+	if (is_opclause(clause) && list_length(((OpExpr *) clause)->args) == 2)
+	{
+		leftop = get_leftop(clause);
+		rightop = get_rightop(clause);
+		opno = ((OpExpr *) clause)->opno;
+		inputcollid = ((OpExpr *) clause)->inputcollid;
+	}
+	else if (IsA(clause, ScalarArrayOpExpr) &&
+			 ((ScalarArrayOpExpr *) clause)->useOr)
+	{
+		ScalarArrayOpExpr *saop = (ScalarArrayOpExpr *) clause;
+
+		leftop = (Node *) linitial(saop->args);
+		rightop = (Node *) lsecond(saop->args);
+		opno = saop->opno;
+		inputcollid = saop->inputcollid;
+	}
+	else
+		return false;
+
+	if (IsA(leftop, Var) && IsA(rightop, Const))
+	{
+		var = (Var *) leftop;
+		cst = (Const *) rightop;
+	}
+	else if (IsA(rightop, Var) && IsA(leftop, Const) && is_opclause(clause))
+	{
+		var = (Var *) rightop;
+		cst = (Const *) leftop;
+		commuted = true;
+	}
+	else
+		return false;
+
+	if (var->varno != varno || var->varattno != attno ||
+		var->varlevelsup != 0 || var->vartype != entry->keytype ||
+		inputcollid != entry->keycoll || cst->constisnull)
+		return false;
+
+	strategy = get_op_opfamily_strategy(opno, entry->opfamily);
+	if (strategy == 0)
+		return false;
+
+	if (IsA(clause, ScalarArrayOpExpr))
+	{
+		ArrayType  *array = DatumGetArrayTypeP(cst->constvalue);
+		int16		elmlen;
+		bool		elmbyval;
+		char		elmalign;
+		Datum	   *elems;
+		bool	   *nulls;
+		int			nelems;
+		Datum		minval = (Datum) 0;
+		Datum		maxval = (Datum) 0;
+		bool		found = false;
+		int			i;
+
+		if (strategy != BTEqualStrategyNumber ||
+			ARR_ELEMTYPE(array) != entry->keytype)
+			return false;
+
+		get_typlenbyvalalign(ARR_ELEMTYPE(array), &elmlen, &elmbyval, &elmalign);
+		deconstruct_array(array, ARR_ELEMTYPE(array), elmlen, elmbyval, elmalign,
+						  &elems, &nulls, &nelems);
+
+		/* the values lie between the smallest and the largest one */
+		for (i = 0; i < nelems; i++)
+		{
+			if (nulls[i])
+				continue;
+			if (!found || partbound_cmp(entry, elems[i], minval) < 0)
+				minval = elems[i];
+			if (!found || partbound_cmp(entry, elems[i], maxval) > 0)
+				maxval = elems[i];
+			found = true;
+		}
+		if (!found)
+			return false;
+
+		partbound_tighten(entry, range, BTGreaterEqualStrategyNumber,
+						  datumCopy(minval, elmbyval, elmlen));
+		partbound_tighten(entry, range, BTLessEqualStrategyNumber,
+						  datumCopy(maxval, elmbyval, elmlen));
+		return true;
+	}
+
+	if (cst->consttype != entry->keytype)
+		return false;
+
+	if (commuted)
+		strategy = BTCommuteStrategyNumber(strategy);
+
+	partbound_tighten(entry, range, strategy,
+					  datumCopy(cst->constvalue, cst->constbyval,
+								cst->constlen));
+	return true;
+}
+
+/* Narrow "range" to the values "key <strategy> value" */
+static void
+partbound_tighten(PartBoundCache *entry, PartBound *range, int strategy,
+				  Datum value)
+{
+	PartBoundValue bound;
+	int32		cmp;
+
+	bound.infinite = false;
+	bound.value = value;
+	bound.inclusive = (strategy == BTLessEqualStrategyNumber ||
+					   strategy == BTEqualStrategyNumber ||
+					   strategy == BTGreaterEqualStrategyNumber);
+
+	if (strategy == BTLessStrategyNumber ||
+		strategy == BTLessEqualStrategyNumber ||
+		strategy == BTEqualStrategyNumber)
+	{
+		if (range->upper.infinite ||
+			(cmp = partbound_cmp(entry, value, range->upper.value)) < 0 ||
+			(cmp == 0 && !bound.inclusive))
+			range->upper = bound;
+	}
+	if (strategy == BTGreaterStrategyNumber ||
+		strategy == BTGreaterEqualStrategyNumber ||
+		strategy == BTEqualStrategyNumber)
+	{
+		if (range->lower.infinite ||
+			(cmp = partbound_cmp(entry, value, range->lower.value)) > 0 ||
+			(cmp == 0 && !bound.inclusive))
+			range->lower = bound;
+	}
+}
+
+/*
+ * Whether no value is both at or below "upper" and at or above "lower",
+ * that is "upper" ends before "lower" starts
+ */
+static bool
+partbound_below(PartBoundCache *entry, PartBoundValue *upper,
+				PartBoundValue *lower)
+{
+	int32		cmp;
+
+	if (upper->infinite || lower->infinite)
+		return false;
+
+	cmp = partbound_cmp(entry, upper->value, lower->value);
+	if (cmp != 0)
+		return cmp < 0;
+	return !(upper->inclusive && lower->inclusive);
+}
+
+static int32
+partbound_cmp(PartBoundCache *entry, Datum a, Datum b)
+{
+	return DatumGetInt32(FunctionCall2Coll(&entry->cmpproc, entry->keycoll,
+										   a, b));
+}
+
+/* qsort_arg comparator of PartBounds by lower bound */
+static int
+partbound_lower_cmp(const void *a, const void *b, void *arg)
+{
+	const PartBoundValue *la = &((const PartBound *) a)->lower;
+	const PartBoundValue *lb = &((const PartBound *) b)->lower;
+	PartBoundCache *entry = (PartBoundCache *) arg;
+	int32		cmp;
+
+	if (la->infinite || lb->infinite)
+		return (int) lb->infinite - (int) la->infinite;
+
+	cmp = partbound_cmp(entry, la->value, lb->value);
+	if (cmp != 0)
+		return cmp;
+	return (int) lb->inclusive - (int) la->inclusive;
+}
+
+static int
+oid_cmp(const void *a, const void *b)
+{
+	Oid			oa = *((const Oid *) a);
+	Oid			ob = *((const Oid *) b);
+
+	if (oa == ob)
+		return 0;
+	return (oa > ob) ? 1 : -1;
+}
+
+/*
+ * partbound_relcallback
+ * Forget the entries of a relation or of its parents, all of them if
+ * "relid" is invalid.
+ */
+static void
+partbound_relcallback(Datum arg, Oid relid)
+{
+	HASH_SEQ_STATUS status;
+	PartBoundCache *entry;
+
+	hash_seq_init(&status, PartBoundCacheHash);
+	while ((entry = (PartBoundCache *) hash_seq_search(&status)) != NULL)
+	{
+		if (OidIsValid(relid) && entry->parentid != relid &&
+			bsearch(&relid, entry->children, entry->nchildren,
+					sizeof(Oid), oid_cmp) == NULL)
+			continue;
+
+		if (entry == PartBoundActive)
+		{
+			entry->valid = false;
+			continue;
+		}
+
+		MemoryContextDelete(entry->context);
+		hash_search(PartBoundCacheHash, &entry->parentid, HASH_REMOVE, NULL);
+	}
+}
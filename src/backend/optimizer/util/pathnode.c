@@ -713,6 +713,28 @@ create_seqscan_path(PlannerInfo *root, RelOptInfo *rel, Relids required_outer)
 	return pathnode;
 }
 
+#ifdef ADB
+/*
+ * create_samplescan_path
+ *	  Creates a path node for a sampled table scan.
+ */
+Path *
+create_samplescan_path(PlannerInfo *root, RelOptInfo *rel, Relids required_outer)
+{
+	Path	   *pathnode = makeNode(Path);
+
+	pathnode->pathtype = T_SampleScan;
+	pathnode->parent = rel;
+	pathnode->param_info = get_baserel_parampathinfo(root, rel,
+													 required_outer);
+	pathnode->pathkeys = NIL;	/* samplescan has unordered result */
+
+	cost_samplescan(pathnode, root, rel, pathnode->param_info);
+
+	return pathnode;
+}
+#endif /* ADB */
+
 /*
  * create_index_path
  *	  Creates a path node for an index scan.
@@ -2054,6 +2076,10 @@ reparameterize_path(PlannerInfo *root, Path *path,
 	{
 		case T_SeqScan:
 			return create_seqscan_path(root, rel, required_outer);
+#ifdef ADB
+		case T_SampleScan:
+			return create_samplescan_path(root, rel, required_outer);
+#endif
 		case T_IndexScan:
 		case T_IndexOnlyScan:
 			{
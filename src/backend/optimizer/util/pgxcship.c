@@ -40,7 +40,47 @@
 #include "utils/rel.h"
 
 #ifdef ADB
+#include "access/hash.h"
+#include "access/htup_details.h"
+#include "catalog/pg_language.h"
+#include "commands/tablecmds.h"
+#include "catalog/namespace.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/guc.h"
+#include "utils/inval.h"
+#include "utils/memutils.h"
+#include "utils/syscache.h"
+
 extern bool enable_stable_func_shipping;
+
+/*
+ * FQSCacheEntry
+ * A query found shippable, once its constants are ignored. The same query
+ * with other constants is shipped finding its nodes again, without walking
+ * it for shippability.
+ */
+typedef struct FQSCacheEntry
+{
+	uint32		hashvalue;			/* hash of the shape, the hash key */
+	char	   *shape;				/* the query text, without constants */
+	Oid			relid;				/* relation the query reads or changes */
+	bool		stable_func_shipping;	/* enable_stable_func_shipping when
+										 * the query was analysed */
+	bool		need_singlenode;	/* shippable on a single node only */
+} FQSCacheEntry;
+
+int fqs_cache_size = 1024;
+
+/*
+ * function_distribute_by is only given as a setting of functions, ALTER
+ * FUNCTION ... SET function_distribute_by = '1, orders', the value a session
+ * runs with is not used, see pgxc_is_func_call_shippable().
+ */
+char *function_distribute_by = NULL;
+
+static HTAB *FQSCache = NULL;
+static MemoryContext FQSCacheContext = NULL;
 #endif
 
 /*
@@ -130,6 +170,30 @@ static ExecNodes *pgxc_FQS_datanodes_for_rtr(Index varno,
 static void pgxc_replace_dist_vars_subquery(Query *query, ExecNodes *exec_nodes,
 												Index varno);
 static bool pgxc_is_trigger_shippable(Trigger *trigger);
+#ifdef ADB
+static bool pgxc_FQS_cache_eligible(Query *query);
+static char *pgxc_FQS_query_shape(Query *query);
+static ExecNodes *pgxc_FQS_cache_lookup(Query *query, char *shape, uint32 hashvalue);
+static void pgxc_FQS_cache_store(Query *query, char *shape, uint32 hashvalue,
+								 bool need_singlenode);
+static void pgxc_FQS_cache_relcallback(Datum arg, Oid relid);
+static void pgxc_FQS_cache_syscallback(Datum arg, int cacheid, uint32 hashvalue);
+static void pgxc_FQS_set_param_nodes(Query *query, ExecNodes *exec_nodes);
+static bool pgxc_is_ora_func_shippable(Oid funcid);
+static ExecNodes *pgxc_FQS_motion_rel_nodes(RangeTblEntry *rte);
+static ExecNodes *pgxc_FQS_motion_join(ExecNodes *result_en, ExecNodes *en);
+static bool pgxc_func_distribute_by_parse(const char *value, int *argno,
+										  List **relname);
+static bool pgxc_func_distribute_by(Oid funcid, int *argno, Oid *relid);
+
+/*
+ * While pgxc_is_motion_dml_shippable() runs, the distributed relations other
+ * than the result relation are taken as available on every Datanode, their
+ * rows being moved there, and their RTEs are collected in fqs_motion_rtes.
+ */
+static bool fqs_motion_dml = false;
+static List *fqs_motion_rtes = NIL;
+#endif
 
 /*
  * Set the given reason in Shippability_context indicating why the query can not be
@@ -214,6 +278,16 @@ pgxc_FQS_datanodes_for_rtr(Index varno, Shippability_context *sc_context)
 			if (rte->inh && has_subclass(rte->relid))
 				return NULL;
 
+#ifdef ADB
+			/* The Datanodes have to evaluate the TABLESAMPLE arguments */
+			if (rte->tablesample &&
+				!pgxc_is_expr_shippable((Expr *) rte->tablesample, NULL))
+				return NULL;
+
+			if (fqs_motion_dml &&
+				(sc_context->sc_query_level != 0 || varno != query->resultRelation))
+				return pgxc_FQS_motion_rel_nodes(rte);
+#endif
 			return pgxc_FQS_get_relation_nodes(rte, varno, query);
 		}
 		break;
@@ -313,6 +387,15 @@ pgxc_FQS_find_datanodes_recurse(Node *node, Shippability_context *sc_context)
 				/* FQS does't ship a DML with more than one relation involved */
 				if (!first && query->commandType != CMD_SELECT)
 				{
+#ifdef ADB
+					if (fqs_motion_dml)
+					{
+						result_en = pgxc_FQS_motion_join(result_en, en);
+						if (!result_en)
+							return NULL;
+						continue;
+					}
+#endif
 					FreeExecNodes(&result_en);
 					return NULL;
 				}
@@ -356,8 +439,16 @@ pgxc_FQS_find_datanodes_recurse(Node *node, Shippability_context *sc_context)
 			ExecNodes *ren;
 			ExecNodes *result_en;
 
-			/* FQS does't ship a DML with more than one relation involved */
+			/*
+			 * FQS does't ship a DML with more than one relation involved. The
+			 * result relation of an UPDATE or DELETE is not part of a JoinExpr,
+			 * so the relations joined here are all moved ones.
+			 */
+#ifdef ADB
+			if (query->commandType != CMD_SELECT && !fqs_motion_dml)
+#else
 			if (query->commandType != CMD_SELECT)
+#endif
 				return NULL;
 
 			len = pgxc_FQS_find_datanodes_recurse(join_expr->larg, sc_context);
@@ -428,6 +519,10 @@ pgxc_FQS_find_datanodes(Shippability_context *sc_context)
 			exec_nodes->nodeList = GetPreferredReplicationNode(exec_nodes->nodeList);
 			list_free(tmp_list);
 		}
+#ifdef ADB
+		if (sc_context->sc_query_level == 0)
+			pgxc_FQS_set_param_nodes(query, exec_nodes);
+#endif
 		return exec_nodes;
 	}
 	/*
@@ -776,6 +871,10 @@ pgxc_shippability_walker(Node *node, Shippability_context *sc_context)
 
 		case T_List:
 		case T_RangeTblRef:
+#ifdef ADB
+		/* Each Datanode samples its own part of the relation */
+		case T_TableSampleClause:
+#endif
 			break;
 
 		case T_ArrayRef:
@@ -988,7 +1087,12 @@ pgxc_shippability_walker(Node *node, Shippability_context *sc_context)
 			 * pgxc_FQS_get_relation_nodes appropriately.
 			 * For now DMLs with single rtable entry are candidates for FQS
 			 */
+#ifdef ADB
+			if (query->commandType != CMD_SELECT && list_length(query->rtable) > 1 &&
+				!fqs_motion_dml)
+#else
 			if (query->commandType != CMD_SELECT && list_length(query->rtable) > 1)
+#endif
 				pgxc_set_shippability_reason(sc_context, SS_UNSUPPORTED_EXPR);
 
 			/*
@@ -1020,8 +1124,15 @@ pgxc_shippability_walker(Node *node, Shippability_context *sc_context)
 			 * There is a subquery in this query, which references Vars in the upper
 			 * query. For now stop shipping such queries. We should get rid of this
 			 * condition.
+			 * When the rows are moved by pgxc_motion_fetch(), every relation
+			 * but the result relation is complete on the Datanodes, so that
+			 * such a subquery can be evaluated there.
 			 */
+#ifdef ADB
+			if (sc_context->sc_max_varlevelsup != 0 && !fqs_motion_dml)
+#else
 			if (sc_context->sc_max_varlevelsup != 0)
+#endif
 				pgxc_set_shippability_reason(sc_context, SS_VARLEVEL);
 
 			/*
@@ -1343,6 +1454,27 @@ pgxc_is_query_shippable(Query *query, int query_level)
 	ExecNodes	*exec_nodes;
 	bool		canShip = true;
 	Bitmapset	*shippability;
+#ifdef ADB
+	char		*shape = NULL;
+	uint32		hashvalue = 0;
+
+	/*
+	 * A query run again with other constants has been walked already, only
+	 * find its nodes again.
+	 */
+	if (query_level == 0 && !fqs_motion_dml && pgxc_FQS_cache_eligible(query))
+	{
+		shape = pgxc_FQS_query_shape(query);
+		hashvalue = DatumGetUInt32(hash_any((unsigned char *) shape,
+											strlen(shape)));
+		exec_nodes = pgxc_FQS_cache_lookup(query, shape, hashvalue);
+		if (exec_nodes)
+		{
+			pfree(shape);
+			return exec_nodes;
+		}
+	}
+#endif
 
 	memset(&sc_context, 0, sizeof(sc_context));
 	/* let's assume that by default query is shippable */
@@ -1376,6 +1508,16 @@ pgxc_is_query_shippable(Query *query, int query_level)
 			IsExecNodesReplicated(sc_context.sc_subquery_en))
 			exec_nodes = pgxc_merge_exec_nodes(exec_nodes,
 											   sc_context.sc_subquery_en);
+#ifdef ADB
+		/*
+		 * The SubLinks of a DML whose rows are moved only read replicated
+		 * relations, they can be evaluated wherever the result relation is.
+		 */
+		else if (fqs_motion_dml && query_level == 0 && exec_nodes &&
+				 sc_context.sc_subquery_en)
+			exec_nodes = pgxc_FQS_motion_join(exec_nodes,
+											  copyObject(sc_context.sc_subquery_en));
+#endif
 		else
 			exec_nodes = NULL;
 	}
@@ -1439,8 +1581,624 @@ pgxc_is_query_shippable(Query *query, int query_level)
 	bms_free(shippability);
 	shippability = NULL;
 
+#ifdef ADB
+	if (shape)
+	{
+		if (exec_nodes)
+			pgxc_FQS_cache_store(query, shape, hashvalue,
+								 bms_is_member(SS_NEED_SINGLENODE,
+											   sc_context.sc_shippability));
+		pfree(shape);
+	}
+#endif
+
+	return exec_nodes;
+}
+
+#ifdef ADB
+/*
+ * pgxc_FQS_cache_eligible
+ * Only a SELECT, UPDATE or DELETE of a single table is cached, its nodes
+ * being found from the quals of the query alone.
+ */
+static bool
+pgxc_FQS_cache_eligible(Query *query)
+{
+	RangeTblEntry *rte;
+	Node	   *fromitem;
+
+	if (fqs_cache_size <= 0)
+		return false;
+
+	if (query->commandType != CMD_SELECT &&
+		query->commandType != CMD_UPDATE &&
+		query->commandType != CMD_DELETE)
+		return false;
+
+	if (query->utilityStmt || query->hasSubLinks || query->cteList ||
+		query->setOperations || list_length(query->rtable) != 1 ||
+		list_length(query->jointree->fromlist) != 1)
+		return false;
+
+	rte = (RangeTblEntry *) linitial(query->rtable);
+	fromitem = (Node *) linitial(query->jointree->fromlist);
+	return rte->rtekind == RTE_RELATION &&
+		IsA(fromitem, RangeTblRef) &&
+		((RangeTblRef *) fromitem)->rtindex == 1;
+}
+
+/*
+ * pgxc_FQS_query_shape
+ * Return the text of the query tree, without the values of its constants
+ * and the locations of its tokens, so that the query run with other values
+ * gets the same text.
+ */
+static char *
+pgxc_FQS_query_shape(Query *query)
+{
+	char	   *shape = nodeToString(query);
+	char	   *src = shape;
+	char	   *dst = shape;
+
+	while (*src)
+	{
+		if (strncmp(src, ":location ", 10) == 0)
+		{
+			memmove(dst, src, 9);
+			dst += 9;
+			src += 10;
+			while (*src == '-' || isdigit((unsigned char) *src))
+				src++;
+		}
+		else if (strncmp(src, ":constvalue ", 12) == 0)
+		{
+			memmove(dst, src, 11);
+			dst += 11;
+			src += 12;
+			/* a null value is "<>", others are a list of bytes in brackets */
+			if (strncmp(src, "<>", 2) == 0)
+				src += 2;
+			else
+			{
+				while (*src && *src != ']')
+					src++;
+				if (*src)
+					src++;
+			}
+		}
+		else
+			*dst++ = *src++;
+	}
+	*dst = '\0';
+
+	return shape;
+}
+
+/*
+ * pgxc_FQS_cache_lookup
+ * If a query of the same shape was found shippable, find the nodes of this
+ * one and return them. Returns NULL if the query has to be analysed.
+ */
+static ExecNodes *
+pgxc_FQS_cache_lookup(Query *query, char *shape, uint32 hashvalue)
+{
+	FQSCacheEntry *entry;
+	ExecNodes  *exec_nodes;
+
+	if (FQSCache == NULL)
+		return NULL;
+
+	entry = (FQSCacheEntry *) hash_search(FQSCache, &hashvalue, HASH_FIND, NULL);
+	if (entry == NULL || strcmp(entry->shape, shape) != 0 ||
+		entry->stable_func_shipping != enable_stable_func_shipping)
+		return NULL;
+
+	exec_nodes = pgxc_FQS_get_relation_nodes((RangeTblEntry *) linitial(query->rtable),
+											 1, query);
+	if (exec_nodes == NULL)
+		return NULL;
+	if (exec_nodes->nodeList == NIL)
+	{
+		FreeExecNodes(&exec_nodes);
+		return NULL;
+	}
+
+	/* Same as pgxc_FQS_find_datanodes() for the highest level query */
+	if (IsExecNodesReplicated(exec_nodes) &&
+		(exec_nodes->accesstype == RELATION_ACCESS_READ_FOR_UPDATE ||
+		 exec_nodes->accesstype == RELATION_ACCESS_READ))
+	{
+		List *tmp_list = exec_nodes->nodeList;
+		exec_nodes->nodeList = GetPreferredReplicationNode(exec_nodes->nodeList);
+		list_free(tmp_list);
+	}
+
+	/* Other values may need more nodes, let the analysis decide */
+	if (entry->need_singlenode &&
+		list_length(exec_nodes->nodeList) != 1 &&
+		!IsExecNodesReplicated(exec_nodes))
+	{
+		FreeExecNodes(&exec_nodes);
+		return NULL;
+	}
+
+	pgxc_FQS_set_param_nodes(query, exec_nodes);
+
+	return exec_nodes;
+}
+
+/*
+ * pgxc_FQS_set_param_nodes
+ * When the nodes of a query of a single table depend on the values of its
+ * parameters, like "distcol = $1", "distcol = ANY($1)" or "rowid = $1", keep
+ * the expression giving the values so that only their nodes get the query,
+ * see get_exec_connections().
+ */
+static void
+pgxc_FQS_set_param_nodes(Query *query, ExecNodes *exec_nodes)
+{
+	RangeTblEntry *rte;
+	Expr	   *expr;
+	bool		is_array;
+
+	if (list_length(query->rtable) != 1 ||
+		query->commandType == CMD_INSERT ||
+		exec_nodes->en_expr ||
+		list_length(exec_nodes->nodeList) <= 1)
+		return;
+
+	rte = (RangeTblEntry *) linitial(query->rtable);
+	if (rte->rtekind != RTE_RELATION)
+		return;
+
+	/* "rowid = $1" gives the node of the row, whatever the distribution */
+	expr = GetRelationRowIdParamExpr(rte->relid, 1, query->jointree->quals);
+	if (expr)
+	{
+		exec_nodes->en_expr = list_make1(expr);
+		exec_nodes->en_expr_rowid = true;
+		exec_nodes->en_relid = rte->relid;
+		return;
+	}
+
+	if (!IsExecNodesDistributedByValue(exec_nodes))
+		return;
+
+	expr = GetRelationDistribParamExpr(rte->relid, 1, query->jointree->quals,
+									   &is_array);
+	if (expr)
+	{
+		exec_nodes->en_expr = list_make1(expr);
+		exec_nodes->en_expr_array = is_array;
+		exec_nodes->en_relid = rte->relid;
+	}
+}
+
+/*
+ * pgxc_FQS_cache_store
+ * Remember that a query of this shape is shippable. The cache is emptied
+ * when full, most applications only running a few shapes of queries.
+ */
+static void
+pgxc_FQS_cache_store(Query *query, char *shape, uint32 hashvalue,
+					 bool need_singlenode)
+{
+	FQSCacheEntry *entry;
+	bool		found;
+
+	if (FQSCache && hash_get_num_entries(FQSCache) >= fqs_cache_size)
+	{
+		hash_destroy(FQSCache);
+		FQSCache = NULL;
+		MemoryContextReset(FQSCacheContext);
+	}
+
+	if (FQSCache == NULL)
+	{
+		HASHCTL		ctl;
+
+		if (FQSCacheContext == NULL)
+		{
+			FQSCacheContext = AllocSetContextCreate(CacheMemoryContext,
+													"FQS cache",
+													ALLOCSET_DEFAULT_MINSIZE,
+													ALLOCSET_DEFAULT_INITSIZE,
+													ALLOCSET_DEFAULT_MAXSIZE);
+			/* The shippability follows the tables and functions */
+			CacheRegisterRelcacheCallback(pgxc_FQS_cache_relcallback, (Datum) 0);
+			CacheRegisterSyscacheCallback(PROCOID, pgxc_FQS_cache_syscallback,
+										  (Datum) 0);
+		}
+
+		MemSet(&ctl, 0, sizeof(ctl));
+		ctl.keysize = sizeof(uint32);
+		ctl.entrysize = sizeof(FQSCacheEntry);
+		ctl.hash = tag_hash;
+		ctl.hcxt = FQSCacheContext;
+		FQSCache = hash_create("FQS cache", 256, &ctl,
+							   HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+	}
+
+	entry = (FQSCacheEntry *) hash_search(FQSCache, &hashvalue, HASH_ENTER, &found);
+	if (found)
+		pfree(entry->shape);
+	entry->shape = MemoryContextStrdup(FQSCacheContext, shape);
+	entry->relid = ((RangeTblEntry *) linitial(query->rtable))->relid;
+	entry->stable_func_shipping = enable_stable_func_shipping;
+	entry->need_singlenode = need_singlenode;
+}
+
+/*
+ * pgxc_FQS_cache_relcallback
+ * Forget the queries of a relation which changed, all of them if "relid"
+ * is invalid.
+ */
+static void
+pgxc_FQS_cache_relcallback(Datum arg, Oid relid)
+{
+	HASH_SEQ_STATUS status;
+	FQSCacheEntry *entry;
+
+	if (FQSCache == NULL)
+		return;
+
+	hash_seq_init(&status, FQSCache);
+	while ((entry = (FQSCacheEntry *) hash_seq_search(&status)) != NULL)
+	{
+		if (OidIsValid(relid) && entry->relid != relid)
+			continue;
+		pfree(entry->shape);
+		hash_search(FQSCache, &entry->hashvalue, HASH_REMOVE, NULL);
+	}
+}
+
+/*
+ * pgxc_FQS_cache_syscallback
+ * A function changed, its shippability may have changed too.
+ */
+static void
+pgxc_FQS_cache_syscallback(Datum arg, int cacheid, uint32 hashvalue)
+{
+	pgxc_FQS_cache_relcallback(arg, InvalidOid);
+}
+
+/*
+ * pgxc_is_motion_dml_shippable
+ * Find whether an UPDATE or DELETE can be shipped as such to the Datanodes of
+ * its result relation once the rows of its other distributed relations are
+ * moved there by pgxc_motion_fetch(). Each Datanode then modifies its own
+ * rows, reading the other relations in full, and only reports how many rows
+ * it modified. Returns the Datanodes to run the query on and, in
+ * "motion_rtes", the RTEs of the relations to move, or NULL if the query
+ * cannot be shipped even so.
+ */
+ExecNodes *
+pgxc_is_motion_dml_shippable(Query *query, List **motion_rtes)
+{
+	ExecNodes	*exec_nodes;
+	RangeTblEntry *rte;
+	RelationLocInfo *rel_loc_info;
+
+	*motion_rtes = NIL;
+	if ((query->commandType != CMD_UPDATE && query->commandType != CMD_DELETE) ||
+		query->utilityStmt || query->returningList || query->hasModifyingCTE)
+		return NULL;
+
+	/* Rows are moved to a distributed relation only */
+	rte = rt_fetch(query->resultRelation, query->rtable);
+	if (rte->rtekind != RTE_RELATION)
+		return NULL;
+	rel_loc_info = GetRelationLocInfo(rte->relid);
+	if (!rel_loc_info)
+		return NULL;
+	if (IsRelationReplicated(rel_loc_info))
+	{
+		FreeRelationLocInfo(rel_loc_info);
+		return NULL;
+	}
+	FreeRelationLocInfo(rel_loc_info);
+
+	Assert(!fqs_motion_dml);
+	fqs_motion_dml = true;
+	fqs_motion_rtes = NIL;
+	PG_TRY();
+	{
+		exec_nodes = pgxc_is_query_shippable(query, 0);
+	}
+	PG_CATCH();
+	{
+		fqs_motion_dml = false;
+		fqs_motion_rtes = NIL;
+		PG_RE_THROW();
+	}
+	PG_END_TRY();
+	fqs_motion_dml = false;
+
+	/* Without rows to move, the query was not shippable in the first place */
+	if (exec_nodes && (!fqs_motion_rtes || IsExecNodesReplicated(exec_nodes)))
+		FreeExecNodes(&exec_nodes);
+	if (exec_nodes)
+		*motion_rtes = fqs_motion_rtes;
+	fqs_motion_rtes = NIL;
+
+	return exec_nodes;
+}
+
+/*
+ * pgxc_FQS_motion_rel_nodes
+ * The Datanodes where a relation read by a DML whose rows are moved is
+ * found. A distributed relation is remembered to be moved, after which it is
+ * complete on every Datanode.
+ */
+static ExecNodes *
+pgxc_FQS_motion_rel_nodes(RangeTblEntry *rte)
+{
+	RelationLocInfo *rel_loc_info;
+	ExecNodes	*exec_nodes;
+
+	/* The rows are read in other sessions, which cannot see temporary tables */
+	rel_loc_info = GetRelationLocInfo(rte->relid);
+	if (!rel_loc_info || IsTempTable(rte->relid))
+		return NULL;
+
+	exec_nodes = makeNode(ExecNodes);
+	exec_nodes->baselocatortype = LOCATOR_TYPE_REPLICATED;
+	exec_nodes->accesstype = RELATION_ACCESS_READ;
+	if (IsRelationReplicated(rel_loc_info))
+		exec_nodes->nodeList = list_copy(rel_loc_info->nodeList);
+	else
+	{
+		exec_nodes->nodeList = GetAllDataNodes();
+		fqs_motion_rtes = list_append_unique_ptr(fqs_motion_rtes, rte);
+	}
+	FreeRelationLocInfo(rel_loc_info);
+
+	return exec_nodes;
+}
+
+/*
+ * pgxc_FQS_motion_join
+ * Join the result relation of a DML whose rows are moved with relations
+ * complete on a set of Datanodes, possible when they are complete wherever
+ * the result relation has rows.
+ */
+static ExecNodes *
+pgxc_FQS_motion_join(ExecNodes *result_en, ExecNodes *en)
+{
+	if (!IsExecNodesReplicated(result_en) && IsExecNodesReplicated(en) &&
+		IsNodeListSubset(result_en->nodeList, en->nodeList))
+	{
+		FreeExecNodes(&en);
+		return result_en;
+	}
+
+	FreeExecNodes(&result_en);
+	FreeExecNodes(&en);
+	return NULL;
+}
+
+/*
+ * pgxc_func_distribute_by_parse
+ * Parse a value of function_distribute_by, the number of an argument of the
+ * function then the name of a relation, like "1, public.orders".
+ */
+static bool
+pgxc_func_distribute_by_parse(const char *value, int *argno, List **relname)
+{
+	char	   *copy;
+	char	   *endptr;
+	long		num;
+	List	   *names;
+
+	errno = 0;
+	num = strtol(value, &endptr, 10);
+	if (endptr == value || errno != 0 || num <= 0 || num > FUNC_MAX_ARGS)
+		return false;
+	while (isspace((unsigned char) *endptr))
+		endptr++;
+	if (*endptr++ != ',')
+		return false;
+
+	copy = pstrdup(endptr);
+	if (!SplitIdentifierString(copy, '.', &names) ||
+		names == NIL || list_length(names) > 3)
+	{
+		pfree(copy);
+		list_free(names);
+		return false;
+	}
+	list_free(names);
+	pfree(copy);
+
+	*argno = (int) num;
+	if (relname)
+		*relname = stringToQualifiedNameList(endptr);
+	return true;
+}
+
+/*
+ * check_function_distribute_by
+ * GUC check hook of function_distribute_by, only its syntax is checked, the
+ * relation is looked up when calls of the function are planned.
+ */
+bool
+check_function_distribute_by(char **newval, void **extra, GucSource source)
+{
+	int			argno;
+
+	if (*newval == NULL || (*newval)[0] == '\0')
+		return true;
+
+	if (!pgxc_func_distribute_by_parse(*newval, &argno, NULL))
+	{
+		GUC_check_errdetail("Expected an argument number and a relation name, like \"1, orders\".");
+		return false;
+	}
+	return true;
+}
+
+/*
+ * pgxc_func_distribute_by
+ * Find the function_distribute_by setting of a function, given with ALTER
+ * FUNCTION ... SET, returning the argument number and the relation, or
+ * false if the function has none or its relation does not exist.
+ */
+static bool
+pgxc_func_distribute_by(Oid funcid, int *argno, Oid *relid)
+{
+	static const char prefix[] = "function_distribute_by=";
+	HeapTuple	tuple;
+	Datum		datum;
+	bool		isnull;
+	char	   *value = NULL;
+	List	   *relname;
+
+	tuple = SearchSysCache1(PROCOID, ObjectIdGetDatum(funcid));
+	if (!HeapTupleIsValid(tuple))
+		return false;
+
+	datum = SysCacheGetAttr(PROCOID, tuple, Anum_pg_proc_proconfig, &isnull);
+	if (!isnull)
+	{
+		ArrayType  *config = DatumGetArrayTypeP(datum);
+		int			i;
+
+		for (i = 1; i <= ARR_DIMS(config)[0]; i++)
+		{
+			Datum		elem;
+			char	   *setting;
+
+			elem = array_ref(config, 1, &i, -1, -1, false, 'i', &isnull);
+			if (isnull)
+				continue;
+			setting = TextDatumGetCString(elem);
+			if (strncmp(setting, prefix, sizeof(prefix) - 1) == 0)
+				value = pstrdup(setting + sizeof(prefix) - 1);
+			pfree(setting);
+		}
+	}
+	ReleaseSysCache(tuple);
+
+	if (value == NULL || !pgxc_func_distribute_by_parse(value, argno, &relname))
+		return false;
+
+	*relid = RangeVarGetRelid(makeRangeVarFromNameList(relname), NoLock, true);
+	return OidIsValid(*relid);
+}
+
+/*
+ * pgxc_is_func_call_shippable
+ * Find whether a query is the bare call of a function whose statements all
+ * target the rows of a single value of the distribution column of a
+ * relation, SELECT f(42, ...), so that the whole function can run on the
+ * Datanode of that value instead of sending each of its statements there.
+ * The function says which of its arguments is that value with its
+ * function_distribute_by setting. Returns the nodes to run the query on,
+ * found from that argument when executed, and the function in "funcid", or
+ * NULL if the query is no such call.
+ *
+ * Nothing checks the function only reads and changes the rows of that
+ * value, setting function_distribute_by says so.
+ */
+ExecNodes *
+pgxc_is_func_call_shippable(Query *query, Oid *funcid)
+{
+	TargetEntry *target = NULL;
+	FuncExpr   *func;
+	RelationLocInfo *rel_loc_info;
+	ExecNodes  *exec_nodes;
+	ListCell   *lc;
+	Node	   *keyarg = NULL;
+	Oid			relid;
+	Oid			keytype;
+	int			argno;
+	bool		has_aggs;
+
+	if (query->commandType != CMD_SELECT ||
+		query->utilityStmt != NULL ||
+		query->rtable != NIL ||
+		query->jointree == NULL ||
+		query->jointree->fromlist != NIL ||
+		query->jointree->quals != NULL ||
+		query->hasAggs ||
+		query->hasWindowFuncs ||
+		query->hasSubLinks ||
+		query->hasRecursive ||
+		query->hasForUpdate ||
+		query->cteList != NIL ||
+		query->setOperations != NULL ||
+		query->groupClause != NIL ||
+		query->havingQual != NULL ||
+		query->distinctClause != NIL ||
+		query->sortClause != NIL ||
+		query->limitOffset != NULL ||
+		query->limitCount != NULL)
+		return NULL;
+
+	foreach (lc, query->targetList)
+	{
+		TargetEntry *tle = (TargetEntry *) lfirst(lc);
+
+		if (tle->resjunk)
+			continue;
+		if (target != NULL)
+			return NULL;
+		target = tle;
+	}
+	if (target == NULL || !IsA(target->expr, FuncExpr))
+		return NULL;
+	func = (FuncExpr *) target->expr;
+
+	if (!pgxc_func_distribute_by(func->funcid, &argno, &relid) ||
+		argno > list_length(func->args))
+		return NULL;
+
+	/* The arguments are evaluated on the Datanode */
+	foreach (lc, func->args)
+	{
+		if (!pgxc_is_expr_shippable((Expr *) lfirst(lc), &has_aggs) || has_aggs)
+			return NULL;
+	}
+
+	/*
+	 * The Datanode is found evaluating the argument on the Coordinator, it
+	 * has to give the value the Datanode gets as well.
+	 */
+	keyarg = (Node *) list_nth(func->args, argno - 1);
+	if (contain_volatile_functions(keyarg))
+		return NULL;
+
+	rel_loc_info = GetRelationLocInfo(relid);
+	if (rel_loc_info == NULL ||
+		!IsRelationDistributedByValue(rel_loc_info) ||
+		list_length(rel_loc_info->nodeList) == 0)
+		return NULL;
+
+	/* The value is hashed as a value of the distribution column */
+	keytype = get_atttype(relid, rel_loc_info->partAttrNum);
+	keyarg = coerce_to_target_type(NULL, keyarg, exprType(keyarg),
+								   keytype, -1,
+								   COERCION_IMPLICIT,
+								   COERCE_IMPLICIT_CAST,
+								   -1);
+	if (keyarg == NULL)
+		return NULL;
+
+	/*
+	 * Access the relation as inserting into it does, a NULL value goes to
+	 * the node where the rows with a NULL value were inserted.
+	 */
+	exec_nodes = makeNode(ExecNodes);
+	exec_nodes->baselocatortype = rel_loc_info->locatorType;
+	exec_nodes->accesstype = RELATION_ACCESS_INSERT;
+	exec_nodes->en_funcid = rel_loc_info->funcid;
+	exec_nodes->en_expr = list_make1(keyarg);
+	exec_nodes->en_relid = relid;
+
+	*funcid = func->funcid;
 	return exec_nodes;
 }
+#endif
 
 
 /*
@@ -1517,9 +2275,93 @@ pgxc_is_func_shippable(Oid funcid)
 	 * For the time being a function is thought as shippable
 	 * only if it is immutable.
 	 */
+#ifdef ADB
+	return func_volatile(funcid) == PROVOLATILE_IMMUTABLE ||
+		pgxc_is_ora_func_shippable(funcid);
+#else
 	return func_volatile(funcid) == PROVOLATILE_IMMUTABLE;
+#endif
 }
 
+#ifdef ADB
+/*
+ * C functions of the oracle schema which are stable only because they read
+ * the session settings (TimeZone, DateStyle, the nls_* formats) or the
+ * database encoding.  The Coordinator passes the SET commands of a session
+ * on to its Datanode connections, so a Datanode computes the same result
+ * as the Coordinator would.  ora_sys_now, which reads the clock, and the
+ * dbms_random functions do not belong here.  Keep sorted for bsearch.
+ */
+static const char *const ora_shippable_funcs[] =
+{
+	"interval_tochar",
+	"ora_add_months_tz",
+	"ora_bin_to_num",
+	"ora_last_day_tz",
+	"ora_months_between_tz",
+	"ora_next_day_tz",
+	"orastr_nls_charset_id",
+	"orastr_nls_charset_name",
+	"orastr_soundex",
+	"text_tochar",
+	"text_todate",
+	"text_totimestamp",
+	"text_totimestamptz",
+	"timestamp_tochar",
+	"timestamptz_mi_interval",
+	"timestamptz_pl_interval",
+	"timestamptz_tochar"
+};
+
+static int
+ora_shippable_func_cmp(const void *a, const void *b)
+{
+	return strcmp(*(const char *const *) a, *(const char *const *) b);
+}
+
+/*
+ * pgxc_is_ora_func_shippable
+ * Is a stable function one of ora_shippable_funcs in the oracle schema?
+ * Functions the oracle schema creates in SQL have no fixed OIDs, so they
+ * are recognized by their C function.
+ */
+static bool
+pgxc_is_ora_func_shippable(Oid funcid)
+{
+	HeapTuple	tuple;
+	Form_pg_proc procform;
+	bool		result = false;
+
+	tuple = SearchSysCache1(PROCOID, ObjectIdGetDatum(funcid));
+	if (!HeapTupleIsValid(tuple))
+		elog(ERROR, "cache lookup failed for function %u", funcid);
+	procform = (Form_pg_proc) GETSTRUCT(tuple);
+
+	if (procform->pronamespace == PG_ORACLE_NAMESPACE &&
+		procform->prolang == INTERNALlanguageId &&
+		procform->provolatile == PROVOLATILE_STABLE)
+	{
+		Datum		prosrc;
+		bool		isnull;
+		char	   *src;
+
+		prosrc = SysCacheGetAttr(PROCOID, tuple, Anum_pg_proc_prosrc, &isnull);
+		if (!isnull)
+		{
+			src = TextDatumGetCString(prosrc);
+			result = bsearch(&src, ora_shippable_funcs,
+							 lengthof(ora_shippable_funcs),
+							 sizeof(ora_shippable_funcs[0]),
+							 ora_shippable_func_cmp) != NULL;
+			pfree(src);
+		}
+	}
+
+	ReleaseSysCache(tuple);
+	return result;
+}
+#endif
+
 #ifdef ADB
 /*
  * pgxc_find_user_defined_equijoin_quals
@@ -1820,8 +2662,13 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 		 * the two relations, other rtables have to be checked on
 		 * this restricted list.
 		 */
+#ifdef ADB
+		merged_en->nodeList = GetNodeListIntersection(en1->nodeList,
+													  en2->nodeList);
+#else
 		merged_en->nodeList = list_intersection_int(en1->nodeList,
 													en2->nodeList);
+#endif
 		merged_en->baselocatortype = LOCATOR_TYPE_REPLICATED;
 		if (!merged_en->nodeList)
 			FreeExecNodes(&merged_en);
@@ -1831,12 +2678,17 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 	if (IsExecNodesReplicated(en1) &&
 		IsExecNodesColumnDistributed(en2))
 	{
-		List	*diff_nodelist = NULL;
 		/*
 		 * Replicated/distributed join case.
 		 * Node list of distributed table has to be included
 		 * in node list of replicated table.
 		 */
+#ifdef ADB
+		if (!IsNodeListSubset(en2->nodeList, en1->nodeList))
+			FreeExecNodes(&merged_en);
+#else
+		List	*diff_nodelist = NULL;
+
 		diff_nodelist = list_difference_int(en2->nodeList, en1->nodeList);
 		/*
 		 * If the difference list is not empty, this means that node list of
@@ -1845,6 +2697,7 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 		 */
 		if (diff_nodelist)
 			FreeExecNodes(&merged_en);
+#endif
 		else
 		{
 			merged_en->nodeList = list_copy(en2->nodeList);
@@ -1852,6 +2705,7 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 			merged_en->en_dist_vars = en2->en_dist_vars;
 #ifdef ADB
 			merged_en->en_funcid = en2->en_funcid;
+			merged_en->en_colocation = en2->en_colocation;
 #endif
 		}
 		return merged_en;
@@ -1860,12 +2714,17 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 	if (IsExecNodesColumnDistributed(en1) &&
 		IsExecNodesReplicated(en2))
 	{
-		List *diff_nodelist = NULL;
 		/*
 		 * Distributed/replicated join case.
 		 * Node list of distributed table has to be included
 		 * in node list of replicated table.
 		 */
+#ifdef ADB
+		if (!IsNodeListSubset(en1->nodeList, en2->nodeList))
+			FreeExecNodes(&merged_en);
+#else
+		List *diff_nodelist = NULL;
+
 		diff_nodelist = list_difference_int(en1->nodeList, en2->nodeList);
 
 		/*
@@ -1875,6 +2734,7 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 		 */
 		if (diff_nodelist)
 			FreeExecNodes(&merged_en);
+#endif
 		else
 		{
 			merged_en->nodeList = list_copy(en1->nodeList);
@@ -1882,6 +2742,7 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 			merged_en->en_dist_vars = en1->en_dist_vars;
 #ifdef ADB
 			merged_en->en_funcid = en1->en_funcid;
+			merged_en->en_colocation = en1->en_colocation;
 #endif
 
 		}
@@ -1898,8 +2759,12 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 		 * node list. The caller is expected to fully decide whether to merge
 		 * the nodes or not.
 		 */
+#ifdef ADB
+		if (IsNodeListEqual(en1->nodeList, en2->nodeList))
+#else
 		if (!list_difference_int(en1->nodeList, en2->nodeList) &&
 			!list_difference_int(en2->nodeList, en1->nodeList))
+#endif
 		{
 			merged_en->nodeList = list_copy(en1->nodeList);
 			if (en1->baselocatortype == en2->baselocatortype)
@@ -1909,6 +2774,8 @@ pgxc_merge_exec_nodes(ExecNodes *en1, ExecNodes *en2)
 				if (OidIsValid(en1->en_funcid) &&
 					en1->en_funcid == en2->en_funcid)
 					merged_en->en_funcid = en1->en_funcid;
+				if (en1->en_colocation == en2->en_colocation)
+					merged_en->en_colocation = en1->en_colocation;
 #endif
 				merged_en->en_dist_vars = list_concat(list_copy(en1->en_dist_vars),
 												list_copy(en2->en_dist_vars));
@@ -2023,6 +2890,11 @@ pgxc_check_index_shippability(RelationLocInfo *relLocInfo,
 
 			case LOCATOR_TYPE_HASH:
 			case LOCATOR_TYPE_MODULO:
+#ifdef ADB
+			case LOCATOR_TYPE_BUCKET:
+			case LOCATOR_TYPE_RANGE:
+			case LOCATOR_TYPE_LIST:
+#endif
 				/*
 				 * Unique indexes on Hash and Modulo tables are shippable if the
 				 * index expression contains all the distribution expressions of
@@ -2115,7 +2987,9 @@ pgxc_check_index_shippability(RelationLocInfo *relLocInfo,
 #endif
 
 			/* Those types are not supported yet */
+#ifndef ADB
 			case LOCATOR_TYPE_RANGE:
+#endif
 			case LOCATOR_TYPE_NONE:
 			case LOCATOR_TYPE_DISTRIBUTED:
 			case LOCATOR_TYPE_CUSTOM:
@@ -2180,6 +3054,9 @@ pgxc_check_fk_shippability(RelationLocInfo *parentLocInfo,
 
 #ifdef ADB
 		case LOCATOR_TYPE_USER_DEFINED:
+		case LOCATOR_TYPE_BUCKET:
+		case LOCATOR_TYPE_RANGE:
+		case LOCATOR_TYPE_LIST:
 #endif
 		case LOCATOR_TYPE_HASH:
 		case LOCATOR_TYPE_MODULO:
@@ -2215,14 +3092,36 @@ pgxc_check_fk_shippability(RelationLocInfo *parentLocInfo,
 			 * Parent and child need to have their data located exactly
 			 * on the same list of nodes.
 			 */
+#ifdef ADB
+			if (!IsNodeListEqual(childLocInfo->nodeList, parentLocInfo->nodeList))
+#else
 			if (list_difference_int(childLocInfo->nodeList, parentLocInfo->nodeList) ||
 				list_difference_int(parentLocInfo->nodeList, childLocInfo->nodeList))
+#endif
 			{
 				result = false;
 				break;
 			}
 
 #ifdef ADB
+			/* Buckets of both need to be on the same nodes as well */
+			if (parentLocInfo->locatorType == LOCATOR_TYPE_BUCKET &&
+				(parentLocInfo->numBuckets != childLocInfo->numBuckets ||
+				 memcmp(parentLocInfo->bucketMap, childLocInfo->bucketMap,
+						sizeof(int16) * parentLocInfo->numBuckets) != 0))
+			{
+				result = false;
+				break;
+			}
+
+			/* And so do their bounds or values */
+			if (IsRelationDistributedByRangeOrList(parentLocInfo) &&
+				!IsLocatorDistValuesEqual(parentLocInfo, childLocInfo))
+			{
+				result = false;
+				break;
+			}
+
 			if (IsRelationDistributedByUserDefined(parentLocInfo))
 			{
 				List *childRefsDiff = NIL;
@@ -2293,7 +3192,9 @@ pgxc_check_fk_shippability(RelationLocInfo *parentLocInfo,
 			/* By being here, parent-child constraint can be shipped correctly */
 			break;
 
+#ifndef ADB
 		case LOCATOR_TYPE_RANGE:
+#endif
 		case LOCATOR_TYPE_NONE:
 		case LOCATOR_TYPE_DISTRIBUTED:
 		case LOCATOR_TYPE_CUSTOM:
@@ -2446,7 +3347,8 @@ pgxc_get_dist_var_list(Index varno, RangeTblEntry *rte)
  * 	relation is shippable if distributed relation is the outer relation.
  * 	All joins between hash/modulo distributed relations are shippable if they
  * 	have equi-join on the distributed column, such that distribution columns
- * 	have same datatype and same distribution strategy.
+ * 	have same datatype and same distribution strategy. Relations distributed
+ * 	by bucket, range or list also have to be of the same colocation group.
  * 3. Are datanodes where the joining relations exist, compatible?
  * 	Joins between replicated relations are shippable if both relations share a
  * 	datanode. Joins between distributed relations are shippable if both
@@ -2515,6 +3417,17 @@ pgxc_is_join_shippable(ExecNodes *inner_en, ExecNodes *outer_en,
 		 * merged.
 		 */
 		if (inner_en->baselocatortype == outer_en->baselocatortype &&
+#ifdef ADB
+			/*
+			 * ExecNodes do not carry the bucket maps, nor the bounds or
+			 * values of range and list: only tables of the same colocation
+			 * group are known to put the same value on the same node.
+			 */
+			((inner_en->baselocatortype != LOCATOR_TYPE_BUCKET &&
+			  !IsLocatorDistributedByRangeOrList(inner_en->baselocatortype)) ||
+			 (inner_en->en_colocation != 0 &&
+			  inner_en->en_colocation == outer_en->en_colocation)) &&
+#endif
 			IsExecNodesDistributedByValue(inner_en))
 		{
 			Expr *equi_join_expr = pgxc_find_dist_equijoin_qual(inner_en->en_dist_vars,
@@ -444,11 +444,24 @@ estimate_rel_size(Relation rel, int32 *attr_widths,
 			 * Override the estimates only for remote tables (currently
 			 * identified by non-NULL rd_locator_info)
 			 */
+#ifdef ADB
+			/*
+			 * Once ANALYZE or VACUUM fetched the size of the relation from
+			 * the datanodes, use it like for a local relation, so that their
+			 * scans, including index-only scans, can be costed.
+			 */
+			if (IS_PGXC_COORDINATOR && !IsConnFromCoord() &&
+				rel->rd_locator_info && rel->rd_rel->relpages == 0)
+#else
 			if (IS_PGXC_COORDINATOR && !IsConnFromCoord() &&
 				rel->rd_locator_info)
+#endif
 			{
 				*pages   = 10;
 				*tuples  = 10;
+#ifdef ADB
+				*allvisfrac = 0;
+#endif
 				break;
 			}
 #endif
@@ -24,8 +24,8 @@ CREATE OR REPLACE FUNCTION oracle.bitand(bigint, bigint)
  */
 CREATE OR REPLACE FUNCTION oracle.nanvl(float8, float8)
     RETURNS float8
-    AS $$SELECT CASE WHEN $1 = 'NaN' THEN $2 ELSE $1 END;$$
-    LANGUAGE SQL
+    AS 'ora_nanvl'
+    LANGUAGE INTERNAL
     IMMUTABLE
     STRICT;
 
@@ -115,8 +115,8 @@ CREATE OR REPLACE FUNCTION oracle.instr(str text, patt text, start int default 1
  */
 CREATE FUNCTION oracle.add_months(TIMESTAMP WITH TIME ZONE, INTEGER)
      RETURNS TIMESTAMP
-     AS $$SELECT oracle.add_months($1::pg_catalog.date, $2) + $1::pg_catalog.time;$$
-     LANGUAGE SQL
+     AS 'ora_add_months_tz'
+     LANGUAGE INTERNAL
     IMMUTABLE
     RETURNS NULL ON NULL INPUT;
 
@@ -125,8 +125,8 @@ CREATE FUNCTION oracle.add_months(TIMESTAMP WITH TIME ZONE, INTEGER)
  */
 CREATE OR REPLACE FUNCTION oracle.last_day(TIMESTAMP WITH TIME ZONE)
     RETURNS oracle.date
-    AS $$SELECT (oracle.last_day($1::pg_catalog.date) + $1::time)::oracle.date;$$
-    LANGUAGE SQL
+    AS 'ora_last_day_tz'
+    LANGUAGE INTERNAL
     IMMUTABLE
     RETURNS NULL ON NULL INPUT;
 
@@ -135,8 +135,8 @@ CREATE OR REPLACE FUNCTION oracle.last_day(TIMESTAMP WITH TIME ZONE)
  */
 CREATE FUNCTION oracle.months_between(TIMESTAMP WITH TIME ZONE, TIMESTAMP WITH TIME ZONE)
     RETURNS NUMERIC
-    AS $$SELECT oracle.months_between($1::pg_catalog.date, $2::pg_catalog.date);$$
-    LANGUAGE SQL
+    AS 'ora_months_between_tz'
+    LANGUAGE INTERNAL
     IMMUTABLE
     RETURNS NULL ON NULL INPUT;
 
@@ -175,14 +175,14 @@ CREATE OR REPLACE FUNCTION oracle.new_time(tt timestamp with time zone, z1 text,
  */
 CREATE OR REPLACE FUNCTION oracle.next_day(oracle.date, text)
     RETURNS oracle.date
-    AS $$SELECT (oracle.ora_next_day($1::pg_catalog.date, $2) + $1::time)::oracle.date;$$
-    LANGUAGE SQL
+    AS 'ora_next_day_tz'
+    LANGUAGE INTERNAL
     IMMUTABLE
     RETURNS NULL ON NULL INPUT;
 CREATE OR REPLACE FUNCTION oracle.next_day(timestamptz, text)
     RETURNS oracle.date
-    AS $$SELECT (oracle.ora_next_day($1::pg_catalog.date, $2) + $1::time)::oracle.date;$$
-    LANGUAGE SQL
+    AS 'ora_next_day_tz'
+    LANGUAGE INTERNAL
     IMMUTABLE
     RETURNS NULL ON NULL INPUT;
 
@@ -198,8 +198,8 @@ CREATE OR REPLACE FUNCTION oracle.round(pg_catalog.date, text default 'DDD')
 
 CREATE OR REPLACE FUNCTION oracle.round(timestamptz, text default 'DDD')
     RETURNS oracle.date
-    AS $$select oracle.ora_timestamptz_round($1, $2)::oracle.date;$$
-    LANGUAGE SQL
+    AS 'ora_timestamptz_round'
+    LANGUAGE INTERNAL
     IMMUTABLE
     RETURNS NULL ON NULL INPUT;
 
@@ -226,8 +226,8 @@ CREATE OR REPLACE FUNCTION oracle.trunc(oracle.date, text default 'DDD')
 
 CREATE OR REPLACE FUNCTION oracle.trunc(timestamptz, text default 'DDD')
     RETURNS oracle.date
-    AS $$select oracle.ora_timestamptz_trunc($1, $2)::oracle.date;$$
-    LANGUAGE SQL
+    AS 'ora_timestamptz_trunc'
+    LANGUAGE INTERNAL
     IMMUTABLE
     RETURNS NULL ON NULL INPUT;
 
@@ -18,6 +18,10 @@ static int days_of_month(int y, int m);
 static DateADT iso_year (int y, int m, int d);
 static DateADT _ora_date_trunc(DateADT day, int f);
 static DateADT _ora_date_round(DateADT day, int f);
+static void add_months_ymd(int *y, int *m, int *d, int n);
+static void timestamptz_to_local_tm(TimestampTz timestamp, struct pg_tm * tm,
+						fsec_t *fsec);
+static TimestampTz local_tm_to_timestamptz(struct pg_tm * tm, fsec_t fsec);
 
 static Datum next_day(DateADT day, text *day_txt);
 static Datum next_day_by_index(DateADT day, int idx);
@@ -363,29 +367,37 @@ add_months(PG_FUNCTION_ARGS)
 	DateADT day = PG_GETARG_DATEADT(0);
 	int n = PG_GETARG_INT32(1);
 	int y, m, d;
-	int days;
 	DateADT result;
-	div_t v;
-	bool last_day;
 
 	j2date(day + POSTGRES_EPOCH_JDATE, &y, &m, &d);
-	last_day = (d == days_of_month(y, m));
-
-	v = div(y * 12 + m - 1 + n, 12);
-	y = v.quot;
-	if (y < 0)
-		y += 1; /* offset because of year 0 */
-	m = v.rem + 1;
-
-	days = days_of_month(y, m);
-	if (last_day || d > days)
-		d = days;
+	add_months_ymd(&y, &m, &d, n);
 
 	result = date2j(y, m, d) - POSTGRES_EPOCH_JDATE;
 
 	PG_RETURN_DATEADT (result);
 }
 
+/* Move y-m-d by n months, keeping the last day of a month the last one */
+static void
+add_months_ymd(int *y, int *m, int *d, int n)
+{
+	int days;
+	div_t v;
+	bool last_day;
+
+	last_day = (*d == days_of_month(*y, *m));
+
+	v = div(*y * 12 + *m - 1 + n, 12);
+	*y = v.quot;
+	if (*y < 0)
+		*y += 1; /* offset because of year 0 */
+	*m = v.rem + 1;
+
+	days = days_of_month(*y, *m);
+	if (last_day || *d > days)
+		*d = days;
+}
+
 /*
  * ISO year
  *
@@ -1088,3 +1100,113 @@ ora_to_dsinterval(PG_FUNCTION_ARGS)
 
 	return result;
 }
+
+/********************************************************************
+ *
+ * ora_add_months_tz|ora_last_day_tz|ora_months_between_tz|ora_next_day_tz
+ *
+ * Purpose:
+ *
+ * add_months, last_day, months_between and next_day of timestamps with
+ * time zone, on their date in the session time zone and keeping their
+ * time of day.  They were SQL functions casting to date and time, which
+ * cannot be inlined as the casts are only stable, so every call went
+ * through the SQL function executor.
+ *
+ ********************************************************************/
+static void
+timestamptz_to_local_tm(TimestampTz timestamp, struct pg_tm * tm,
+						fsec_t *fsec)
+{
+	int tz;
+
+	if (TIMESTAMP_NOT_FINITE(timestamp) ||
+		timestamp2tm(timestamp, &tz, tm, fsec, NULL, NULL) != 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
+				 errmsg("timestamp out of range")));
+}
+
+static TimestampTz
+local_tm_to_timestamptz(struct pg_tm * tm, fsec_t fsec)
+{
+	TimestampTz result;
+	int tz;
+
+	tz = DetermineTimeZoneOffset(tm, session_timezone);
+	if (tm2timestamp(tm, fsec, &tz, &result) != 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
+				 errmsg("timestamp out of range")));
+
+	return result;
+}
+
+Datum
+ora_add_months_tz(PG_FUNCTION_ARGS)
+{
+	TimestampTz timestamp = PG_GETARG_TIMESTAMPTZ(0);
+	int n = PG_GETARG_INT32(1);
+	Timestamp result;
+	fsec_t fsec;
+	struct pg_tm tt, *tm = &tt;
+
+	timestamptz_to_local_tm(timestamp, tm, &fsec);
+	add_months_ymd(&tm->tm_year, &tm->tm_mon, &tm->tm_mday, n);
+
+	/* the result is a timestamp without time zone */
+	if (tm2timestamp(tm, fsec, NULL, &result) != 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
+				 errmsg("timestamp out of range")));
+
+	PG_RETURN_TIMESTAMP(result);
+}
+
+Datum
+ora_last_day_tz(PG_FUNCTION_ARGS)
+{
+	TimestampTz timestamp = PG_GETARG_TIMESTAMPTZ(0);
+	fsec_t fsec;
+	struct pg_tm tt, *tm = &tt;
+
+	timestamptz_to_local_tm(timestamp, tm, &fsec);
+	tm->tm_mday = days_of_month(tm->tm_year, tm->tm_mon);
+
+	PG_RETURN_TIMESTAMPTZ(local_tm_to_timestamptz(tm, fsec));
+}
+
+Datum
+ora_months_between_tz(PG_FUNCTION_ARGS)
+{
+	fsec_t fsec;
+	struct pg_tm tt, *tm = &tt;
+	DateADT date1;
+	DateADT date2;
+
+	timestamptz_to_local_tm(PG_GETARG_TIMESTAMPTZ(0), tm, &fsec);
+	date1 = DATE2J(tm->tm_year, tm->tm_mon, tm->tm_mday);
+	timestamptz_to_local_tm(PG_GETARG_TIMESTAMPTZ(1), tm, &fsec);
+	date2 = DATE2J(tm->tm_year, tm->tm_mon, tm->tm_mday);
+
+	return DirectFunctionCall2(months_between,
+							   DateADTGetDatum(date1),
+							   DateADTGetDatum(date2));
+}
+
+Datum
+ora_next_day_tz(PG_FUNCTION_ARGS)
+{
+	TimestampTz timestamp = PG_GETARG_TIMESTAMPTZ(0);
+	fsec_t fsec;
+	struct pg_tm tt, *tm = &tt;
+	DateADT day;
+
+	timestamptz_to_local_tm(timestamp, tm, &fsec);
+	day = DatumGetDateADT(DirectFunctionCall2(ora_next_day,
+						DateADTGetDatum(DATE2J(tm->tm_year, tm->tm_mon, tm->tm_mday)),
+						PG_GETARG_DATUM(1)));
+	j2date(day + POSTGRES_EPOCH_JDATE, &tm->tm_year, &tm->tm_mon, &tm->tm_mday);
+
+	PG_RETURN_TIMESTAMPTZ(local_tm_to_timestamptz(tm, fsec));
+}
@@ -1,6 +1,7 @@
 #include "postgres.h"
 #include <stdlib.h>
 #include <locale.h>
+#include <math.h>
 #include "catalog/pg_operator.h"
 #include "catalog/pg_type.h"
 #include "fmgr.h"
@@ -37,6 +38,18 @@ ora_lnnvl(PG_FUNCTION_ARGS)
 	PG_RETURN_BOOL(!PG_GETARG_BOOL(0));
 }
 
+/* nanvl(float8, float8): the second argument when the first is NaN */
+Datum
+ora_nanvl(PG_FUNCTION_ARGS)
+{
+	float8		arg1 = PG_GETARG_FLOAT8(0);
+
+	if (isnan(arg1))
+		PG_RETURN_DATUM(PG_GETARG_DATUM(1));
+
+	PG_RETURN_FLOAT8(arg1);
+}
+
 Datum
 ora_concat(PG_FUNCTION_ARGS)
 {
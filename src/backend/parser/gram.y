@@ -400,7 +400,7 @@ static void processCASbits(int cas_bits, int location, const char *constrType,
 %type <list>	func_alias_clause
 %type <sortby>	sortby
 %type <ielem>	index_elem
-%type <node>	table_ref
+%type <node>	table_ref tablesample_clause opt_repeatable_clause
 %type <jexpr>	joined_table
 %type <range>	relation_expr
 %type <range>	relation_expr_opt_alias
@@ -580,7 +580,7 @@ static void processCASbits(int cas_bits, int location, const char *constrType,
 	STATEMENT STATISTICS STDIN STDOUT STORAGE STRICT_P STRIP_P SUBSTRING
 	SYMMETRIC SYSID SYSTEM_P
 
-	TABLE TABLES TABLESPACE TEMP TEMPLATE TEMPORARY TEXT_P THEN TIME TIMESTAMP
+	TABLE TABLES TABLESAMPLE TABLESPACE TEMP TEMPLATE TEMPORARY TEXT_P THEN TIME TIMESTAMP
 	TO TRAILING TRANSACTION TREAT TRIGGER TRIM TRUE_P
 	TRUNCATE TRUSTED TYPE_P TYPES_P
 
@@ -10125,6 +10125,20 @@ table_ref:	relation_expr opt_alias_clause
 					$1->alias = $2;
 					$$ = (Node *) $1;
 				}
+			| relation_expr opt_alias_clause tablesample_clause
+				{
+#ifdef ADB
+					RangeTableSample *n = (RangeTableSample *) $3;
+					$1->alias = $2;
+					n->relation = $1;
+					$$ = (Node *) n;
+#else /* ADB */
+					ereport(ERROR,
+							(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+							 errmsg("TABLESAMPLE is not supported"),
+							 parser_errposition(@3)));
+#endif /* ADB */
+				}
 			| func_table func_alias_clause
 				{
 					RangeFunction *n = makeNode(RangeFunction);
@@ -10333,6 +10347,31 @@ alias_clause:
 				}
 		;
 
+/*
+ * TABLESAMPLE decoration in a FROM item
+ */
+tablesample_clause:
+			TABLESAMPLE ColId '(' a_expr ')' opt_repeatable_clause
+				{
+#ifdef ADB
+					RangeTableSample *n = makeNode(RangeTableSample);
+					/* n->relation will be filled in later */
+					n->method = $2;
+					n->percent = $4;
+					n->repeatable = $6;
+					n->location = @2;
+					$$ = (Node *) n;
+#else /* ADB */
+					$$ = NULL;
+#endif /* ADB */
+				}
+		;
+
+opt_repeatable_clause:
+			REPEATABLE '(' a_expr ')'	{ $$ = (Node *) $3; }
+			| /*EMPTY*/					{ $$ = NULL; }
+		;
+
 opt_alias_clause: alias_clause						{ $$ = $1; }
 			| /*EMPTY*/								{ $$ = NULL; }
 		;
@@ -13615,6 +13654,7 @@ type_func_name_keyword:
 			| OVERLAPS
 			| RIGHT
 			| SIMILAR
+			| TABLESAMPLE
 			| VERBOSE
 		;
 
@@ -0,0 +1,17422 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         ora_yyparse
+#define yylex           ora_yylex
+#define yyerror         ora_yyerror
+#define yydebug         ora_yydebug
+#define yynerrs         ora_yynerrs
+
+/* First part of user prologue.  */
+#line 1 "ora_gram.y"
+
+
+//#define YYDEBUG 1
+
+/*-------------------------------------------------------------------------
+ *
+ * Portions Copyright (c) 2015-2017 AntDB Development Group
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+#include "catalog/index.h"
+#include "catalog/namespace.h"
+#include "catalog/pg_class.h"
+#include "commands/defrem.h"
+#include "lib/stringinfo.h"
+#include "nodes/makefuncs.h"
+#include "nodes/nodeFuncs.h"
+#include "parser/ora_gramparse.h"
+#include "parser/parser.h"
+#include "parser/parse_type.h"
+#include "utils/date.h"
+#include "utils/datetime.h"
+#include "utils/guc.h"
+
+/* Location tracking support --- simpler than bison's default */
+#define YYLLOC_DEFAULT(Current, Rhs, N) \
+	do { \
+		if (N) \
+			(Current) = YYRHSLOC(Rhs, 1); \
+		else \
+			(Current) = YYRHSLOC(Rhs, 0); \
+	} while (0)
+
+/*
+ * The above macro assigns -1 (unknown) as the parse location of any
+ * nonterminal that was reduced from an empty rule.  This is problematic
+ * for nonterminals defined like
+ *		OptFooList: / * EMPTY * / { ... } | OptFooList Foo { ... } ;
+ * because we'll set -1 as the location during the first reduction and then
+ * copy it during each subsequent reduction, leaving us with -1 for the
+ * location even when the list is not empty.  To fix that, do this in the
+ * action for the nonempty rule(s):
+ *		if (@$ < 0) @$ = @2;
+ * (Although we have many nonterminals that follow this pattern, we only
+ * bother with fixing @$ like this when the nonterminal's parse location
+ * is actually referenced in some rule.)
+ */
+ 
+/* ConstraintAttributeSpec yields an integer bitmask of these flags: */
+#define CAS_NOT_DEFERRABLE			0x01
+#define CAS_DEFERRABLE				0x02
+#define CAS_INITIALLY_IMMEDIATE		0x04
+#define CAS_INITIALLY_DEFERRED		0x08
+#define CAS_NOT_VALID				0x10
+#define CAS_NO_INHERIT				0x20
+
+/*
+ * Bison doesn't allocate anything that needs to live across parser calls,
+ * so we can easily have it use palloc instead of malloc.  This prevents
+ * memory leaks if we error out during parsing.  Note this only works with
+ * bison >= 2.0.  However, in bison 1.875 the default is to use alloca()
+ * if possible, so there's not really much problem anyhow, at least if
+ * you're building with gcc.
+ */
+#define YYMALLOC palloc
+#define YYFREE   pfree
+
+#define parser_yyerror(msg)  scanner_yyerror(msg, yyscanner)
+#define parser_errposition(pos)  scanner_errposition(pos, yyscanner)
+#define pg_yyget_extra(yyscanner) (*((base_yy_extra_type **) (yyscanner)))
+
+union YYSTYPE;					/* need forward reference for tok_is_keyword */
+static void ora_yyerror(YYLTYPE *yylloc, core_yyscan_t yyscanner, const char *msg);
+static int ora_yylex(union YYSTYPE *lvalp, YYLTYPE *yylloc, core_yyscan_t yyscanner);
+static Node *makeDeleteStmt(RangeVar *range, Alias *alias, WithClause *with, Node *where, List *returning);
+static Node *reparse_decode_func(List *args, int location);
+static void processCASbits(int cas_bits, int location, const char *constrType,
+			   bool *deferrable, bool *initdeferred, bool *not_valid,
+			   bool *no_inherit, core_yyscan_t yyscanner);
+static void add_alias_if_need(List *parseTree);
+static Node* make_any_sublink(Node *testexpr, const char *operName, Node *subselect, int location);
+#define MAKE_ANY_A_EXPR(name_, l_, r_, loc_) (Node*)makeA_Expr(AEXPR_OP_ANY, list_make1(makeString(pstrdup(name_))), l_, r_, loc_)
+
+#line 162 "ora_gram.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "ora_gram.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IDENT = 3,                      /* IDENT  */
+  YYSYMBOL_FCONST = 4,                     /* FCONST  */
+  YYSYMBOL_SCONST = 5,                     /* SCONST  */
+  YYSYMBOL_BCONST = 6,                     /* BCONST  */
+  YYSYMBOL_XCONST = 7,                     /* XCONST  */
+  YYSYMBOL_Op = 8,                         /* Op  */
+  YYSYMBOL_ICONST = 9,                     /* ICONST  */
+  YYSYMBOL_PARAM = 10,                     /* PARAM  */
+  YYSYMBOL_TYPECAST = 11,                  /* TYPECAST  */
+  YYSYMBOL_DOT_DOT = 12,                   /* DOT_DOT  */
+  YYSYMBOL_COLON_EQUALS = 13,              /* COLON_EQUALS  */
+  YYSYMBOL_NULLS_FIRST = 14,               /* NULLS_FIRST  */
+  YYSYMBOL_NULLS_LAST = 15,                /* NULLS_LAST  */
+  YYSYMBOL_ACCESS = 16,                    /* ACCESS  */
+  YYSYMBOL_ADD_P = 17,                     /* ADD_P  */
+  YYSYMBOL_ALL = 18,                       /* ALL  */
+  YYSYMBOL_ALTER = 19,                     /* ALTER  */
+  YYSYMBOL_ANALYZE = 20,                   /* ANALYZE  */
+  YYSYMBOL_ANALYSE = 21,                   /* ANALYSE  */
+  YYSYMBOL_AND = 22,                       /* AND  */
+  YYSYMBOL_ABORT_P = 23,                   /* ABORT_P  */
+  YYSYMBOL_ANY = 24,                       /* ANY  */
+  YYSYMBOL_AS = 25,                        /* AS  */
+  YYSYMBOL_ASC = 26,                       /* ASC  */
+  YYSYMBOL_AUDIT = 27,                     /* AUDIT  */
+  YYSYMBOL_AUTHORIZATION = 28,             /* AUTHORIZATION  */
+  YYSYMBOL_ACTION = 29,                    /* ACTION  */
+  YYSYMBOL_ALWAYS = 30,                    /* ALWAYS  */
+  YYSYMBOL_ADMIN = 31,                     /* ADMIN  */
+  YYSYMBOL_BEGIN_P = 32,                   /* BEGIN_P  */
+  YYSYMBOL_BETWEEN = 33,                   /* BETWEEN  */
+  YYSYMBOL_BFILE = 34,                     /* BFILE  */
+  YYSYMBOL_BIGINT = 35,                    /* BIGINT  */
+  YYSYMBOL_BINARY_FLOAT = 36,              /* BINARY_FLOAT  */
+  YYSYMBOL_BINARY_DOUBLE = 37,             /* BINARY_DOUBLE  */
+  YYSYMBOL_BLOB = 38,                      /* BLOB  */
+  YYSYMBOL_BOOLEAN_P = 39,                 /* BOOLEAN_P  */
+  YYSYMBOL_BOTH = 40,                      /* BOTH  */
+  YYSYMBOL_BY = 41,                        /* BY  */
+  YYSYMBOL_BYTE_P = 42,                    /* BYTE_P  */
+  YYSYMBOL_CASCADE = 43,                   /* CASCADE  */
+  YYSYMBOL_CASE = 44,                      /* CASE  */
+  YYSYMBOL_CAST = 45,                      /* CAST  */
+  YYSYMBOL_CATALOG_P = 46,                 /* CATALOG_P  */
+  YYSYMBOL_CHAR_P = 47,                    /* CHAR_P  */
+  YYSYMBOL_CHARACTERISTICS = 48,           /* CHARACTERISTICS  */
+  YYSYMBOL_CHECK = 49,                     /* CHECK  */
+  YYSYMBOL_CLUSTER = 50,                   /* CLUSTER  */
+  YYSYMBOL_COLUMN = 51,                    /* COLUMN  */
+  YYSYMBOL_COMMIT = 52,                    /* COMMIT  */
+  YYSYMBOL_COMMENT = 53,                   /* COMMENT  */
+  YYSYMBOL_COLLATION = 54,                 /* COLLATION  */
+  YYSYMBOL_CONVERSION_P = 55,              /* CONVERSION_P  */
+  YYSYMBOL_CONNECTION = 56,                /* CONNECTION  */
+  YYSYMBOL_COMMITTED = 57,                 /* COMMITTED  */
+  YYSYMBOL_COMPRESS = 58,                  /* COMPRESS  */
+  YYSYMBOL_COLLATE = 59,                   /* COLLATE  */
+  YYSYMBOL_CONNECT = 60,                   /* CONNECT  */
+  YYSYMBOL_CONSTRAINT = 61,                /* CONSTRAINT  */
+  YYSYMBOL_CYCLE = 62,                     /* CYCLE  */
+  YYSYMBOL_NOCYCLE = 63,                   /* NOCYCLE  */
+  YYSYMBOL_CONSTRAINTS = 64,               /* CONSTRAINTS  */
+  YYSYMBOL_CLOB = 65,                      /* CLOB  */
+  YYSYMBOL_COALESCE = 66,                  /* COALESCE  */
+  YYSYMBOL_CONTENT_P = 67,                 /* CONTENT_P  */
+  YYSYMBOL_CONTINUE_P = 68,                /* CONTINUE_P  */
+  YYSYMBOL_CREATE = 69,                    /* CREATE  */
+  YYSYMBOL_CROSS = 70,                     /* CROSS  */
+  YYSYMBOL_CURRENT_DATE = 71,              /* CURRENT_DATE  */
+  YYSYMBOL_CURRENT_P = 72,                 /* CURRENT_P  */
+  YYSYMBOL_CURRENT_TIMESTAMP = 73,         /* CURRENT_TIMESTAMP  */
+  YYSYMBOL_CURRVAL = 74,                   /* CURRVAL  */
+  YYSYMBOL_CURSOR = 75,                    /* CURSOR  */
+  YYSYMBOL_CONCURRENTLY = 76,              /* CONCURRENTLY  */
+  YYSYMBOL_CONFIGURATION = 77,             /* CONFIGURATION  */
+  YYSYMBOL_CACHE = 78,                     /* CACHE  */
+  YYSYMBOL_NOCACHE = 79,                   /* NOCACHE  */
+  YYSYMBOL_COMMENTS = 80,                  /* COMMENTS  */
+  YYSYMBOL_DATE_P = 81,                    /* DATE_P  */
+  YYSYMBOL_DAY_P = 82,                     /* DAY_P  */
+  YYSYMBOL_DBTIMEZONE_P = 83,              /* DBTIMEZONE_P  */
+  YYSYMBOL_DEC = 84,                       /* DEC  */
+  YYSYMBOL_DECIMAL_P = 85,                 /* DECIMAL_P  */
+  YYSYMBOL_DEFAULT = 86,                   /* DEFAULT  */
+  YYSYMBOL_DEFERRABLE = 87,                /* DEFERRABLE  */
+  YYSYMBOL_DELETE_P = 88,                  /* DELETE_P  */
+  YYSYMBOL_DESC = 89,                      /* DESC  */
+  YYSYMBOL_DISTINCT = 90,                  /* DISTINCT  */
+  YYSYMBOL_DO = 91,                        /* DO  */
+  YYSYMBOL_DOCUMENT_P = 92,                /* DOCUMENT_P  */
+  YYSYMBOL_DOUBLE_P = 93,                  /* DOUBLE_P  */
+  YYSYMBOL_DROP = 94,                      /* DROP  */
+  YYSYMBOL_DEFERRED = 95,                  /* DEFERRED  */
+  YYSYMBOL_DATA_P = 96,                    /* DATA_P  */
+  YYSYMBOL_DEFAULTS = 97,                  /* DEFAULTS  */
+  YYSYMBOL_DISABLE_P = 98,                 /* DISABLE_P  */
+  YYSYMBOL_DISTRIBUTE = 99,                /* DISTRIBUTE  */
+  YYSYMBOL_PREPARE = 100,                  /* PREPARE  */
+  YYSYMBOL_PREPARED = 101,                 /* PREPARED  */
+  YYSYMBOL_DOMAIN_P = 102,                 /* DOMAIN_P  */
+  YYSYMBOL_DICTIONARY = 103,               /* DICTIONARY  */
+  YYSYMBOL_ELSE = 104,                     /* ELSE  */
+  YYSYMBOL_END_P = 105,                    /* END_P  */
+  YYSYMBOL_ESCAPE = 106,                   /* ESCAPE  */
+  YYSYMBOL_EXCLUSIVE = 107,                /* EXCLUSIVE  */
+  YYSYMBOL_EXISTS = 108,                   /* EXISTS  */
+  YYSYMBOL_EXPLAIN = 109,                  /* EXPLAIN  */
+  YYSYMBOL_EXTRACT = 110,                  /* EXTRACT  */
+  YYSYMBOL_ENABLE_P = 111,                 /* ENABLE_P  */
+  YYSYMBOL_EXCLUDE = 112,                  /* EXCLUDE  */
+  YYSYMBOL_EVENT = 113,                    /* EVENT  */
+  YYSYMBOL_EXTENSION = 114,                /* EXTENSION  */
+  YYSYMBOL_EXCLUDING = 115,                /* EXCLUDING  */
+  YYSYMBOL_ENCRYPTED = 116,                /* ENCRYPTED  */
+  YYSYMBOL_FALSE_P = 117,                  /* FALSE_P  */
+  YYSYMBOL_FILE_P = 118,                   /* FILE_P  */
+  YYSYMBOL_FLOAT_P = 119,                  /* FLOAT_P  */
+  YYSYMBOL_FOR = 120,                      /* FOR  */
+  YYSYMBOL_FROM = 121,                     /* FROM  */
+  YYSYMBOL_FOREIGN = 122,                  /* FOREIGN  */
+  YYSYMBOL_FULL = 123,                     /* FULL  */
+  YYSYMBOL_GLOBAL = 124,                   /* GLOBAL  */
+  YYSYMBOL_GRANT = 125,                    /* GRANT  */
+  YYSYMBOL_GREATEST = 126,                 /* GREATEST  */
+  YYSYMBOL_GROUP_P = 127,                  /* GROUP_P  */
+  YYSYMBOL_HAVING = 128,                   /* HAVING  */
+  YYSYMBOL_HOUR_P = 129,                   /* HOUR_P  */
+  YYSYMBOL_IDENTIFIED = 130,               /* IDENTIFIED  */
+  YYSYMBOL_IF_P = 131,                     /* IF_P  */
+  YYSYMBOL_IMMEDIATE = 132,                /* IMMEDIATE  */
+  YYSYMBOL_IN_P = 133,                     /* IN_P  */
+  YYSYMBOL_INCREMENT = 134,                /* INCREMENT  */
+  YYSYMBOL_INDEX = 135,                    /* INDEX  */
+  YYSYMBOL_INITIAL_P = 136,                /* INITIAL_P  */
+  YYSYMBOL_INSERT = 137,                   /* INSERT  */
+  YYSYMBOL_INHERIT = 138,                  /* INHERIT  */
+  YYSYMBOL_INITIALLY = 139,                /* INITIALLY  */
+  YYSYMBOL_INHERITS = 140,                 /* INHERITS  */
+  YYSYMBOL_INCLUDING = 141,                /* INCLUDING  */
+  YYSYMBOL_INDEXES = 142,                  /* INDEXES  */
+  YYSYMBOL_INNER_P = 143,                  /* INNER_P  */
+  YYSYMBOL_IDENTITY_P = 144,               /* IDENTITY_P  */
+  YYSYMBOL_INTEGER = 145,                  /* INTEGER  */
+  YYSYMBOL_INTERSECT = 146,                /* INTERSECT  */
+  YYSYMBOL_INTO = 147,                     /* INTO  */
+  YYSYMBOL_INTERVAL = 148,                 /* INTERVAL  */
+  YYSYMBOL_INT_P = 149,                    /* INT_P  */
+  YYSYMBOL_IS = 150,                       /* IS  */
+  YYSYMBOL_ISOLATION = 151,                /* ISOLATION  */
+  YYSYMBOL_JOIN = 152,                     /* JOIN  */
+  YYSYMBOL_KEY = 153,                      /* KEY  */
+  YYSYMBOL_LEADING = 154,                  /* LEADING  */
+  YYSYMBOL_LEAST = 155,                    /* LEAST  */
+  YYSYMBOL_LEFT = 156,                     /* LEFT  */
+  YYSYMBOL_LEVEL = 157,                    /* LEVEL  */
+  YYSYMBOL_LIMIT = 158,                    /* LIMIT  */
+  YYSYMBOL_LIKE = 159,                     /* LIKE  */
+  YYSYMBOL_LOCAL = 160,                    /* LOCAL  */
+  YYSYMBOL_LOCALTIMESTAMP = 161,           /* LOCALTIMESTAMP  */
+  YYSYMBOL_LOCK_P = 162,                   /* LOCK_P  */
+  YYSYMBOL_LOG_P = 163,                    /* LOG_P  */
+  YYSYMBOL_LONG_P = 164,                   /* LONG_P  */
+  YYSYMBOL_MATERIALIZED = 165,             /* MATERIALIZED  */
+  YYSYMBOL_MAXEXTENTS = 166,               /* MAXEXTENTS  */
+  YYSYMBOL_MINUS = 167,                    /* MINUS  */
+  YYSYMBOL_MINUTE_P = 168,                 /* MINUTE_P  */
+  YYSYMBOL_MLSLABEL = 169,                 /* MLSLABEL  */
+  YYSYMBOL_MODE = 170,                     /* MODE  */
+  YYSYMBOL_MODIFY = 171,                   /* MODIFY  */
+  YYSYMBOL_MONTH_P = 172,                  /* MONTH_P  */
+  YYSYMBOL_MATCH = 173,                    /* MATCH  */
+  YYSYMBOL_MAXVALUE = 174,                 /* MAXVALUE  */
+  YYSYMBOL_NOMAXVALUE = 175,               /* NOMAXVALUE  */
+  YYSYMBOL_MINVALUE = 176,                 /* MINVALUE  */
+  YYSYMBOL_NOMINVALUE = 177,               /* NOMINVALUE  */
+  YYSYMBOL_NAMES = 178,                    /* NAMES  */
+  YYSYMBOL_NCHAR = 179,                    /* NCHAR  */
+  YYSYMBOL_NCLOB = 180,                    /* NCLOB  */
+  YYSYMBOL_NEXT = 181,                     /* NEXT  */
+  YYSYMBOL_NEXTVAL = 182,                  /* NEXTVAL  */
+  YYSYMBOL_NOAUDIT = 183,                  /* NOAUDIT  */
+  YYSYMBOL_NOCOMPRESS = 184,               /* NOCOMPRESS  */
+  YYSYMBOL_NOT = 185,                      /* NOT  */
+  YYSYMBOL_NOWAIT = 186,                   /* NOWAIT  */
+  YYSYMBOL_NULL_P = 187,                   /* NULL_P  */
+  YYSYMBOL_NULLIF = 188,                   /* NULLIF  */
+  YYSYMBOL_NUMBER_P = 189,                 /* NUMBER_P  */
+  YYSYMBOL_NUMERIC = 190,                  /* NUMERIC  */
+  YYSYMBOL_NVARCHAR2 = 191,                /* NVARCHAR2  */
+  YYSYMBOL_NO = 192,                       /* NO  */
+  YYSYMBOL_NODE = 193,                     /* NODE  */
+  YYSYMBOL_OF = 194,                       /* OF  */
+  YYSYMBOL_OFF = 195,                      /* OFF  */
+  YYSYMBOL_OFFLINE = 196,                  /* OFFLINE  */
+  YYSYMBOL_OFFSET = 197,                   /* OFFSET  */
+  YYSYMBOL_ON = 198,                       /* ON  */
+  YYSYMBOL_ONLINE = 199,                   /* ONLINE  */
+  YYSYMBOL_ONLY = 200,                     /* ONLY  */
+  YYSYMBOL_OPERATOR = 201,                 /* OPERATOR  */
+  YYSYMBOL_OPTION = 202,                   /* OPTION  */
+  YYSYMBOL_OR = 203,                       /* OR  */
+  YYSYMBOL_ORDER = 204,                    /* ORDER  */
+  YYSYMBOL_OUTER_P = 205,                  /* OUTER_P  */
+  YYSYMBOL_OWNER = 206,                    /* OWNER  */
+  YYSYMBOL_OIDS = 207,                     /* OIDS  */
+  YYSYMBOL_OPTIONS = 208,                  /* OPTIONS  */
+  YYSYMBOL_OWNED = 209,                    /* OWNED  */
+  YYSYMBOL_PCTFREE = 210,                  /* PCTFREE  */
+  YYSYMBOL_PRECISION = 211,                /* PRECISION  */
+  YYSYMBOL_PRESERVE = 212,                 /* PRESERVE  */
+  YYSYMBOL_PRIOR = 213,                    /* PRIOR  */
+  YYSYMBOL_PRIVILEGES = 214,               /* PRIVILEGES  */
+  YYSYMBOL_PUBLIC = 215,                   /* PUBLIC  */
+  YYSYMBOL_PURGE = 216,                    /* PURGE  */
+  YYSYMBOL_PARTIAL = 217,                  /* PARTIAL  */
+  YYSYMBOL_PRIMARY = 218,                  /* PRIMARY  */
+  YYSYMBOL_PARSER = 219,                   /* PARSER  */
+  YYSYMBOL_PASSWORD = 220,                 /* PASSWORD  */
+  YYSYMBOL_RAW = 221,                      /* RAW  */
+  YYSYMBOL_READ = 222,                     /* READ  */
+  YYSYMBOL_REAL = 223,                     /* REAL  */
+  YYSYMBOL_RECURSIVE = 224,                /* RECURSIVE  */
+  YYSYMBOL_RENAME = 225,                   /* RENAME  */
+  YYSYMBOL_REPLACE = 226,                  /* REPLACE  */
+  YYSYMBOL_REPEATABLE = 227,               /* REPEATABLE  */
+  YYSYMBOL_RESET = 228,                    /* RESET  */
+  YYSYMBOL_RESOURCE = 229,                 /* RESOURCE  */
+  YYSYMBOL_RESTART = 230,                  /* RESTART  */
+  YYSYMBOL_RESTRICT = 231,                 /* RESTRICT  */
+  YYSYMBOL_RETURNING = 232,                /* RETURNING  */
+  YYSYMBOL_RETURN_P = 233,                 /* RETURN_P  */
+  YYSYMBOL_REVOKE = 234,                   /* REVOKE  */
+  YYSYMBOL_REUSE = 235,                    /* REUSE  */
+  YYSYMBOL_RIGHT = 236,                    /* RIGHT  */
+  YYSYMBOL_ROLE = 237,                     /* ROLE  */
+  YYSYMBOL_ROLLBACK = 238,                 /* ROLLBACK  */
+  YYSYMBOL_ROW = 239,                      /* ROW  */
+  YYSYMBOL_ROWID = 240,                    /* ROWID  */
+  YYSYMBOL_ROWNUM = 241,                   /* ROWNUM  */
+  YYSYMBOL_ROWS = 242,                     /* ROWS  */
+  YYSYMBOL_REFERENCES = 243,               /* REFERENCES  */
+  YYSYMBOL_REPLICA = 244,                  /* REPLICA  */
+  YYSYMBOL_RULE = 245,                     /* RULE  */
+  YYSYMBOL_RELEASE = 246,                  /* RELEASE  */
+  YYSYMBOL_SCHEMA = 247,                   /* SCHEMA  */
+  YYSYMBOL_SECOND_P = 248,                 /* SECOND_P  */
+  YYSYMBOL_SELECT = 249,                   /* SELECT  */
+  YYSYMBOL_SERIALIZABLE = 250,             /* SERIALIZABLE  */
+  YYSYMBOL_SESSION = 251,                  /* SESSION  */
+  YYSYMBOL_SESSIONTIMEZONE = 252,          /* SESSIONTIMEZONE  */
+  YYSYMBOL_SET = 253,                      /* SET  */
+  YYSYMBOL_SHARE = 254,                    /* SHARE  */
+  YYSYMBOL_SHOW = 255,                     /* SHOW  */
+  YYSYMBOL_SIZE = 256,                     /* SIZE  */
+  YYSYMBOL_SEARCH = 257,                   /* SEARCH  */
+  YYSYMBOL_SMALLINT = 258,                 /* SMALLINT  */
+  YYSYMBOL_SIMPLE = 259,                   /* SIMPLE  */
+  YYSYMBOL_SETOF = 260,                    /* SETOF  */
+  YYSYMBOL_STATISTICS = 261,               /* STATISTICS  */
+  YYSYMBOL_SAVEPOINT = 262,                /* SAVEPOINT  */
+  YYSYMBOL_SEQUENCE = 263,                 /* SEQUENCE  */
+  YYSYMBOL_SYSID = 264,                    /* SYSID  */
+  YYSYMBOL_SOME = 265,                     /* SOME  */
+  YYSYMBOL_SNAPSHOT = 266,                 /* SNAPSHOT  */
+  YYSYMBOL_START = 267,                    /* START  */
+  YYSYMBOL_STORAGE = 268,                  /* STORAGE  */
+  YYSYMBOL_SUCCESSFUL = 269,               /* SUCCESSFUL  */
+  YYSYMBOL_SYNONYM = 270,                  /* SYNONYM  */
+  YYSYMBOL_SYSDATE = 271,                  /* SYSDATE  */
+  YYSYMBOL_SYSTIMESTAMP = 272,             /* SYSTIMESTAMP  */
+  YYSYMBOL_TABLE = 273,                    /* TABLE  */
+  YYSYMBOL_TEMP = 274,                     /* TEMP  */
+  YYSYMBOL_TEMPLATE = 275,                 /* TEMPLATE  */
+  YYSYMBOL_TEMPORARY = 276,                /* TEMPORARY  */
+  YYSYMBOL_THEN = 277,                     /* THEN  */
+  YYSYMBOL_TIME = 278,                     /* TIME  */
+  YYSYMBOL_TIMESTAMP = 279,                /* TIMESTAMP  */
+  YYSYMBOL_TO = 280,                       /* TO  */
+  YYSYMBOL_TRAILING = 281,                 /* TRAILING  */
+  YYSYMBOL_TRANSACTION = 282,              /* TRANSACTION  */
+  YYSYMBOL_TREAT = 283,                    /* TREAT  */
+  YYSYMBOL_TRIM = 284,                     /* TRIM  */
+  YYSYMBOL_TRUNCATE = 285,                 /* TRUNCATE  */
+  YYSYMBOL_TRIGGER = 286,                  /* TRIGGER  */
+  YYSYMBOL_TRUE_P = 287,                   /* TRUE_P  */
+  YYSYMBOL_TABLESPACE = 288,               /* TABLESPACE  */
+  YYSYMBOL_TYPE_P = 289,                   /* TYPE_P  */
+  YYSYMBOL_TEXT_P = 290,                   /* TEXT_P  */
+  YYSYMBOL_UID = 291,                      /* UID  */
+  YYSYMBOL_UNCOMMITTED = 292,              /* UNCOMMITTED  */
+  YYSYMBOL_UNION = 293,                    /* UNION  */
+  YYSYMBOL_UNIQUE = 294,                   /* UNIQUE  */
+  YYSYMBOL_UPDATE = 295,                   /* UPDATE  */
+  YYSYMBOL_USER = 296,                     /* USER  */
+  YYSYMBOL_USING = 297,                    /* USING  */
+  YYSYMBOL_UNLOGGED = 298,                 /* UNLOGGED  */
+  YYSYMBOL_UNENCRYPTED = 299,              /* UNENCRYPTED  */
+  YYSYMBOL_UNTIL = 300,                    /* UNTIL  */
+  YYSYMBOL_VALIDATE = 301,                 /* VALIDATE  */
+  YYSYMBOL_VALUES = 302,                   /* VALUES  */
+  YYSYMBOL_VARCHAR = 303,                  /* VARCHAR  */
+  YYSYMBOL_VARCHAR2 = 304,                 /* VARCHAR2  */
+  YYSYMBOL_VERBOSE = 305,                  /* VERBOSE  */
+  YYSYMBOL_VIEW = 306,                     /* VIEW  */
+  YYSYMBOL_VALID = 307,                    /* VALID  */
+  YYSYMBOL_WHEN = 308,                     /* WHEN  */
+  YYSYMBOL_WHENEVER = 309,                 /* WHENEVER  */
+  YYSYMBOL_WHERE = 310,                    /* WHERE  */
+  YYSYMBOL_WITH = 311,                     /* WITH  */
+  YYSYMBOL_WRITE = 312,                    /* WRITE  */
+  YYSYMBOL_WITHOUT = 313,                  /* WITHOUT  */
+  YYSYMBOL_WORK = 314,                     /* WORK  */
+  YYSYMBOL_XML_P = 315,                    /* XML_P  */
+  YYSYMBOL_YEAR_P = 316,                   /* YEAR_P  */
+  YYSYMBOL_ZONE = 317,                     /* ZONE  */
+  YYSYMBOL_ORACLE_JOIN_OP = 318,           /* ORACLE_JOIN_OP  */
+  YYSYMBOL_CONNECT_BY = 319,               /* CONNECT_BY  */
+  YYSYMBOL_CONNECT_BY_NOCYCLE = 320,       /* CONNECT_BY_NOCYCLE  */
+  YYSYMBOL_HI_THEN_RETURN = 321,           /* HI_THEN_RETURN  */
+  YYSYMBOL_LO_THEN_LIMIT = 322,            /* LO_THEN_LIMIT  */
+  YYSYMBOL_HI_THEN_LIMIT = 323,            /* HI_THEN_LIMIT  */
+  YYSYMBOL_324_ = 324,                     /* '='  */
+  YYSYMBOL_325_ = 325,                     /* '<'  */
+  YYSYMBOL_326_ = 326,                     /* '>'  */
+  YYSYMBOL_POSTFIXOP = 327,                /* POSTFIXOP  */
+  YYSYMBOL_328_ = 328,                     /* '+'  */
+  YYSYMBOL_329_ = 329,                     /* '-'  */
+  YYSYMBOL_330_ = 330,                     /* '*'  */
+  YYSYMBOL_331_ = 331,                     /* '/'  */
+  YYSYMBOL_332_ = 332,                     /* '%'  */
+  YYSYMBOL_333_ = 333,                     /* '^'  */
+  YYSYMBOL_AT = 334,                       /* AT  */
+  YYSYMBOL_UMINUS = 335,                   /* UMINUS  */
+  YYSYMBOL_336_ = 336,                     /* '('  */
+  YYSYMBOL_337_ = 337,                     /* ')'  */
+  YYSYMBOL_338_ = 338,                     /* '.'  */
+  YYSYMBOL_339_ = 339,                     /* ';'  */
+  YYSYMBOL_340_ = 340,                     /* ','  */
+  YYSYMBOL_341_ = 341,                     /* '['  */
+  YYSYMBOL_342_ = 342,                     /* ']'  */
+  YYSYMBOL_343_ = 343,                     /* ':'  */
+  YYSYMBOL_YYACCEPT = 344,                 /* $accept  */
+  YYSYMBOL_stmtblock = 345,                /* stmtblock  */
+  YYSYMBOL_stmtmulti = 346,                /* stmtmulti  */
+  YYSYMBOL_stmt = 347,                     /* stmt  */
+  YYSYMBOL_CreateAsStmt = 348,             /* CreateAsStmt  */
+  YYSYMBOL_create_as_target = 349,         /* create_as_target  */
+  YYSYMBOL_opt_with_data = 350,            /* opt_with_data  */
+  YYSYMBOL_CreateRoleStmt = 351,           /* CreateRoleStmt  */
+  YYSYMBOL_OptRoleList = 352,              /* OptRoleList  */
+  YYSYMBOL_CreateOptRoleElem = 353,        /* CreateOptRoleElem  */
+  YYSYMBOL_role_list = 354,                /* role_list  */
+  YYSYMBOL_AlterOptRoleElem = 355,         /* AlterOptRoleElem  */
+  YYSYMBOL_AlterObjectSchemaStmt = 356,    /* AlterObjectSchemaStmt  */
+  YYSYMBOL_RenameStmt = 357,               /* RenameStmt  */
+  YYSYMBOL_AlterTableStmt = 358,           /* AlterTableStmt  */
+  YYSYMBOL_alter_table_cmds = 359,         /* alter_table_cmds  */
+  YYSYMBOL_alter_table_cmd = 360,          /* alter_table_cmd  */
+  YYSYMBOL_opt_set_data = 361,             /* opt_set_data  */
+  YYSYMBOL_alter_using = 362,              /* alter_using  */
+  YYSYMBOL_alter_generic_options = 363,    /* alter_generic_options  */
+  YYSYMBOL_alter_generic_option_list = 364, /* alter_generic_option_list  */
+  YYSYMBOL_alter_generic_option_elem = 365, /* alter_generic_option_elem  */
+  YYSYMBOL_generic_option_elem = 366,      /* generic_option_elem  */
+  YYSYMBOL_generic_option_name = 367,      /* generic_option_name  */
+  YYSYMBOL_generic_option_arg = 368,       /* generic_option_arg  */
+  YYSYMBOL_opt_collate_clause = 369,       /* opt_collate_clause  */
+  YYSYMBOL_OptDistributeType = 370,        /* OptDistributeType  */
+  YYSYMBOL_OptDistributeByInternal = 371,  /* OptDistributeByInternal  */
+  YYSYMBOL_OptSubCluster = 372,            /* OptSubCluster  */
+  YYSYMBOL_OptSubClusterInternal = 373,    /* OptSubClusterInternal  */
+  YYSYMBOL_pgxcnode_name = 374,            /* pgxcnode_name  */
+  YYSYMBOL_pgxcgroup_name = 375,           /* pgxcgroup_name  */
+  YYSYMBOL_pgxcnodes = 376,                /* pgxcnodes  */
+  YYSYMBOL_pgxcnode_list = 377,            /* pgxcnode_list  */
+  YYSYMBOL_TableConstraint = 378,          /* TableConstraint  */
+  YYSYMBOL_ConstraintElem = 379,           /* ConstraintElem  */
+  YYSYMBOL_ExistingIndex = 380,            /* ExistingIndex  */
+  YYSYMBOL_ExclusionWhereClause = 381,     /* ExclusionWhereClause  */
+  YYSYMBOL_ExclusionConstraintList = 382,  /* ExclusionConstraintList  */
+  YYSYMBOL_ExclusionConstraintElem = 383,  /* ExclusionConstraintElem  */
+  YYSYMBOL_ConstraintAttributeSpec = 384,  /* ConstraintAttributeSpec  */
+  YYSYMBOL_ConstraintAttributeElem = 385,  /* ConstraintAttributeElem  */
+  YYSYMBOL_RoleId = 386,                   /* RoleId  */
+  YYSYMBOL_opt_column = 387,               /* opt_column  */
+  YYSYMBOL_alter_column_default = 388,     /* alter_column_default  */
+  YYSYMBOL_CreateSeqStmt = 389,            /* CreateSeqStmt  */
+  YYSYMBOL_OptSeqOptList = 390,            /* OptSeqOptList  */
+  YYSYMBOL_SeqOptList = 391,               /* SeqOptList  */
+  YYSYMBOL_SeqOptElem = 392,               /* SeqOptElem  */
+  YYSYMBOL_opt_with = 393,                 /* opt_with  */
+  YYSYMBOL_opt_by = 394,                   /* opt_by  */
+  YYSYMBOL_IndexStmt = 395,                /* IndexStmt  */
+  YYSYMBOL_opt_unique = 396,               /* opt_unique  */
+  YYSYMBOL_opt_concurrently = 397,         /* opt_concurrently  */
+  YYSYMBOL_opt_index_name = 398,           /* opt_index_name  */
+  YYSYMBOL_index_name = 399,               /* index_name  */
+  YYSYMBOL_access_method_clause = 400,     /* access_method_clause  */
+  YYSYMBOL_access_method = 401,            /* access_method  */
+  YYSYMBOL_index_params = 402,             /* index_params  */
+  YYSYMBOL_index_elem = 403,               /* index_elem  */
+  YYSYMBOL_opt_collate = 404,              /* opt_collate  */
+  YYSYMBOL_opt_class = 405,                /* opt_class  */
+  YYSYMBOL_opt_nulls_order = 406,          /* opt_nulls_order  */
+  YYSYMBOL_reloptions = 407,               /* reloptions  */
+  YYSYMBOL_opt_reloptions = 408,           /* opt_reloptions  */
+  YYSYMBOL_reloption_list = 409,           /* reloption_list  */
+  YYSYMBOL_reloption_elem = 410,           /* reloption_elem  */
+  YYSYMBOL_def_arg = 411,                  /* def_arg  */
+  YYSYMBOL_func_type = 412,                /* func_type  */
+  YYSYMBOL_qual_all_Op = 413,              /* qual_all_Op  */
+  YYSYMBOL_sub_type = 414,                 /* sub_type  */
+  YYSYMBOL_subquery_Op = 415,              /* subquery_Op  */
+  YYSYMBOL_OptTableSpace = 416,            /* OptTableSpace  */
+  YYSYMBOL_alias_clause = 417,             /* alias_clause  */
+  YYSYMBOL_all_Op = 418,                   /* all_Op  */
+  YYSYMBOL_any_operator = 419,             /* any_operator  */
+  YYSYMBOL_analyze_keyword = 420,          /* analyze_keyword  */
+  YYSYMBOL_a_expr = 421,                   /* a_expr  */
+  YYSYMBOL_AexprConst = 422,               /* AexprConst  */
+  YYSYMBOL_attr_name = 423,                /* attr_name  */
+  YYSYMBOL_Bit = 424,                      /* Bit  */
+  YYSYMBOL_b_expr = 425,                   /* b_expr  */
+  YYSYMBOL_case_default = 426,             /* case_default  */
+  YYSYMBOL_case_expr = 427,                /* case_expr  */
+  YYSYMBOL_case_when_list = 428,           /* case_when_list  */
+  YYSYMBOL_case_when_item = 429,           /* case_when_item  */
+  YYSYMBOL_Character = 430,                /* Character  */
+  YYSYMBOL_c_expr = 431,                   /* c_expr  */
+  YYSYMBOL_ColId = 432,                    /* ColId  */
+  YYSYMBOL_ColLabel = 433,                 /* ColLabel  */
+  YYSYMBOL_common_table_expr = 434,        /* common_table_expr  */
+  YYSYMBOL_columnDef = 435,                /* columnDef  */
+  YYSYMBOL_ColQualList = 436,              /* ColQualList  */
+  YYSYMBOL_ColConstraint = 437,            /* ColConstraint  */
+  YYSYMBOL_any_name_list = 438,            /* any_name_list  */
+  YYSYMBOL_any_name = 439,                 /* any_name  */
+  YYSYMBOL_attrs = 440,                    /* attrs  */
+  YYSYMBOL_ColConstraintElem = 441,        /* ColConstraintElem  */
+  YYSYMBOL_opt_definition = 442,           /* opt_definition  */
+  YYSYMBOL_definition = 443,               /* definition  */
+  YYSYMBOL_def_list = 444,                 /* def_list  */
+  YYSYMBOL_def_elem = 445,                 /* def_elem  */
+  YYSYMBOL_OptConsTableSpace = 446,        /* OptConsTableSpace  */
+  YYSYMBOL_opt_no_inherit = 447,           /* opt_no_inherit  */
+  YYSYMBOL_opt_column_list = 448,          /* opt_column_list  */
+  YYSYMBOL_columnList = 449,               /* columnList  */
+  YYSYMBOL_columnElem = 450,               /* columnElem  */
+  YYSYMBOL_key_match = 451,                /* key_match  */
+  YYSYMBOL_key_actions = 452,              /* key_actions  */
+  YYSYMBOL_key_update = 453,               /* key_update  */
+  YYSYMBOL_key_delete = 454,               /* key_delete  */
+  YYSYMBOL_key_action = 455,               /* key_action  */
+  YYSYMBOL_ConstraintAttr = 456,           /* ConstraintAttr  */
+  YYSYMBOL_columnref = 457,                /* columnref  */
+  YYSYMBOL_ConstInterval = 458,            /* ConstInterval  */
+  YYSYMBOL_ConstDatetime = 459,            /* ConstDatetime  */
+  YYSYMBOL_ConstTypename = 460,            /* ConstTypename  */
+  YYSYMBOL_CreateStmt = 461,               /* CreateStmt  */
+  YYSYMBOL_OptTemp = 462,                  /* OptTemp  */
+  YYSYMBOL_OptInherit = 463,               /* OptInherit  */
+  YYSYMBOL_create_generic_options = 464,   /* create_generic_options  */
+  YYSYMBOL_cte_list = 465,                 /* cte_list  */
+  YYSYMBOL_OptWith = 466,                  /* OptWith  */
+  YYSYMBOL_OnCommitOption = 467,           /* OnCommitOption  */
+  YYSYMBOL_OptDistributeBy = 468,          /* OptDistributeBy  */
+  YYSYMBOL_OptTypedTableElementList = 469, /* OptTypedTableElementList  */
+  YYSYMBOL_TypedTableElementList = 470,    /* TypedTableElementList  */
+  YYSYMBOL_TypedTableElement = 471,        /* TypedTableElement  */
+  YYSYMBOL_columnOptions = 472,            /* columnOptions  */
+  YYSYMBOL_ctext_expr = 473,               /* ctext_expr  */
+  YYSYMBOL_ctext_expr_list = 474,          /* ctext_expr_list  */
+  YYSYMBOL_ctext_row = 475,                /* ctext_row  */
+  YYSYMBOL_DeleteStmt = 476,               /* DeleteStmt  */
+  YYSYMBOL_document_or_content = 477,      /* document_or_content  */
+  YYSYMBOL_DropStmt = 478,                 /* DropStmt  */
+  YYSYMBOL_drop_type = 479,                /* drop_type  */
+  YYSYMBOL_DropStmt_opt_purge = 480,       /* DropStmt_opt_purge  */
+  YYSYMBOL_ExplainStmt = 481,              /* ExplainStmt  */
+  YYSYMBOL_ExplainableStmt = 482,          /* ExplainableStmt  */
+  YYSYMBOL_explain_option_list = 483,      /* explain_option_list  */
+  YYSYMBOL_explain_option_elem = 484,      /* explain_option_elem  */
+  YYSYMBOL_explain_option_name = 485,      /* explain_option_name  */
+  YYSYMBOL_explain_option_arg = 486,       /* explain_option_arg  */
+  YYSYMBOL_expr_list = 487,                /* expr_list  */
+  YYSYMBOL_trim_list = 488,                /* trim_list  */
+  YYSYMBOL_from_clause = 489,              /* from_clause  */
+  YYSYMBOL_from_list = 490,                /* from_list  */
+  YYSYMBOL_func_arg_expr = 491,            /* func_arg_expr  */
+  YYSYMBOL_func_arg_list = 492,            /* func_arg_list  */
+  YYSYMBOL_extract_list = 493,             /* extract_list  */
+  YYSYMBOL_extract_arg = 494,              /* extract_arg  */
+  YYSYMBOL_func_expr = 495,                /* func_expr  */
+  YYSYMBOL_func_name = 496,                /* func_name  */
+  YYSYMBOL_group_clause = 497,             /* group_clause  */
+  YYSYMBOL_having_clause = 498,            /* having_clause  */
+  YYSYMBOL_Iconst = 499,                   /* Iconst  */
+  YYSYMBOL_indirection_el = 500,           /* indirection_el  */
+  YYSYMBOL_indirection = 501,              /* indirection  */
+  YYSYMBOL_InsertStmt = 502,               /* InsertStmt  */
+  YYSYMBOL_opt_as = 503,                   /* opt_as  */
+  YYSYMBOL_insert_rest_no_cols = 504,      /* insert_rest_no_cols  */
+  YYSYMBOL_insert_rest = 505,              /* insert_rest  */
+  YYSYMBOL_insert_column_list = 506,       /* insert_column_list  */
+  YYSYMBOL_insert_column_item = 507,       /* insert_column_item  */
+  YYSYMBOL_interval_second = 508,          /* interval_second  */
+  YYSYMBOL_iso_level = 509,                /* iso_level  */
+  YYSYMBOL_joined_table = 510,             /* joined_table  */
+  YYSYMBOL_join_qual = 511,                /* join_qual  */
+  YYSYMBOL_join_outer = 512,               /* join_outer  */
+  YYSYMBOL_join_type = 513,                /* join_type  */
+  YYSYMBOL_row = 514,                      /* row  */
+  YYSYMBOL_MathOp = 515,                   /* MathOp  */
+  YYSYMBOL_multiple_set_clause = 516,      /* multiple_set_clause  */
+  YYSYMBOL_name = 517,                     /* name  */
+  YYSYMBOL_name_list = 518,                /* name_list  */
+  YYSYMBOL_NonReservedWord = 519,          /* NonReservedWord  */
+  YYSYMBOL_NonReservedWord_or_Sconst = 520, /* NonReservedWord_or_Sconst  */
+  YYSYMBOL_Numeric = 521,                  /* Numeric  */
+  YYSYMBOL_NumericOnly = 522,              /* NumericOnly  */
+  YYSYMBOL_OptTableElementList = 523,      /* OptTableElementList  */
+  YYSYMBOL_opt_alias_clause = 524,         /* opt_alias_clause  */
+  YYSYMBOL_opt_all = 525,                  /* opt_all  */
+  YYSYMBOL_opt_asc_desc = 526,             /* opt_asc_desc  */
+  YYSYMBOL_opt_boolean_or_string = 527,    /* opt_boolean_or_string  */
+  YYSYMBOL_opt_byte_char = 528,            /* opt_byte_char  */
+  YYSYMBOL_opt_distinct = 529,             /* opt_distinct  */
+  YYSYMBOL_opt_drop_behavior = 530,        /* opt_drop_behavior  */
+  YYSYMBOL_opt_encoding = 531,             /* opt_encoding  */
+  YYSYMBOL_opt_from = 532,                 /* opt_from  */
+  YYSYMBOL_opt_indirection = 533,          /* opt_indirection  */
+  YYSYMBOL_opt_interval = 534,             /* opt_interval  */
+  YYSYMBOL_opt_name_list = 535,            /* opt_name_list  */
+  YYSYMBOL_opt_restart_seqs = 536,         /* opt_restart_seqs  */
+  YYSYMBOL_opt_type_mod = 537,             /* opt_type_mod  */
+  YYSYMBOL_opt_type_modifiers = 538,       /* opt_type_modifiers  */
+  YYSYMBOL_opt_verbose = 539,              /* opt_verbose  */
+  YYSYMBOL_opt_with_clause = 540,          /* opt_with_clause  */
+  YYSYMBOL_qualified_name_list = 541,      /* qualified_name_list  */
+  YYSYMBOL_qualified_name = 542,           /* qualified_name  */
+  YYSYMBOL_qual_Op = 543,                  /* qual_Op  */
+  YYSYMBOL_relation_expr = 544,            /* relation_expr  */
+  YYSYMBOL_relation_expr_list = 545,       /* relation_expr_list  */
+  YYSYMBOL_relation_expr_opt_alias = 546,  /* relation_expr_opt_alias  */
+  YYSYMBOL_returning_clause = 547,         /* returning_clause  */
+  YYSYMBOL_returning_item = 548,           /* returning_item  */
+  YYSYMBOL_Sconst = 549,                   /* Sconst  */
+  YYSYMBOL_select_clause = 550,            /* select_clause  */
+  YYSYMBOL_SelectStmt = 551,               /* SelectStmt  */
+  YYSYMBOL_select_with_parens = 552,       /* select_with_parens  */
+  YYSYMBOL_select_no_parens = 553,         /* select_no_parens  */
+  YYSYMBOL_set_clause_list = 554,          /* set_clause_list  */
+  YYSYMBOL_set_clause = 555,               /* set_clause  */
+  YYSYMBOL_for_locking_clause = 556,       /* for_locking_clause  */
+  YYSYMBOL_opt_for_locking_clause = 557,   /* opt_for_locking_clause  */
+  YYSYMBOL_for_locking_items = 558,        /* for_locking_items  */
+  YYSYMBOL_for_locking_item = 559,         /* for_locking_item  */
+  YYSYMBOL_for_locking_strength = 560,     /* for_locking_strength  */
+  YYSYMBOL_locked_rels_list = 561,         /* locked_rels_list  */
+  YYSYMBOL_opt_nowait = 562,               /* opt_nowait  */
+  YYSYMBOL_select_limit = 563,             /* select_limit  */
+  YYSYMBOL_opt_select_limit = 564,         /* opt_select_limit  */
+  YYSYMBOL_limit_clause = 565,             /* limit_clause  */
+  YYSYMBOL_offset_clause = 566,            /* offset_clause  */
+  YYSYMBOL_select_limit_value = 567,       /* select_limit_value  */
+  YYSYMBOL_select_offset_value = 568,      /* select_offset_value  */
+  YYSYMBOL_set_expr = 569,                 /* set_expr  */
+  YYSYMBOL_set_expr_list = 570,            /* set_expr_list  */
+  YYSYMBOL_set_expr_row = 571,             /* set_expr_row  */
+  YYSYMBOL_set_rest = 572,                 /* set_rest  */
+  YYSYMBOL_set_rest_more = 573,            /* set_rest_more  */
+  YYSYMBOL_set_target = 574,               /* set_target  */
+  YYSYMBOL_set_target_list = 575,          /* set_target_list  */
+  YYSYMBOL_SignedIconst = 576,             /* SignedIconst  */
+  YYSYMBOL_single_set_clause = 577,        /* single_set_clause  */
+  YYSYMBOL_SimpleTypename = 578,           /* SimpleTypename  */
+  YYSYMBOL_simple_select = 579,            /* simple_select  */
+  YYSYMBOL_sortby = 580,                   /* sortby  */
+  YYSYMBOL_sortby_list = 581,              /* sortby_list  */
+  YYSYMBOL_sort_clause = 582,              /* sort_clause  */
+  YYSYMBOL_opt_sort_clause = 583,          /* opt_sort_clause  */
+  YYSYMBOL_opt_start_with_clause = 584,    /* opt_start_with_clause  */
+  YYSYMBOL_start_with_clause = 585,        /* start_with_clause  */
+  YYSYMBOL_connect_by_clause = 586,        /* connect_by_clause  */
+  YYSYMBOL_TableElement = 587,             /* TableElement  */
+  YYSYMBOL_TableLikeClause = 588,          /* TableLikeClause  */
+  YYSYMBOL_TableLikeOptionList = 589,      /* TableLikeOptionList  */
+  YYSYMBOL_TableLikeOption = 590,          /* TableLikeOption  */
+  YYSYMBOL_TableElementList = 591,         /* TableElementList  */
+  YYSYMBOL_table_ref = 592,                /* table_ref  */
+  YYSYMBOL_target_item = 593,              /* target_item  */
+  YYSYMBOL_target_list = 594,              /* target_list  */
+  YYSYMBOL_transaction_mode_item = 595,    /* transaction_mode_item  */
+  YYSYMBOL_transaction_mode_list = 596,    /* transaction_mode_list  */
+  YYSYMBOL_TruncateStmt = 597,             /* TruncateStmt  */
+  YYSYMBOL_TruncateStmt_log_opt = 598,     /* TruncateStmt_log_opt  */
+  YYSYMBOL_TruncateStmt_storage_opt = 599, /* TruncateStmt_storage_opt  */
+  YYSYMBOL_Typename = 600,                 /* Typename  */
+  YYSYMBOL_type_function_name = 601,       /* type_function_name  */
+  YYSYMBOL_UpdateStmt = 602,               /* UpdateStmt  */
+  YYSYMBOL_values_clause = 603,            /* values_clause  */
+  YYSYMBOL_var_list = 604,                 /* var_list  */
+  YYSYMBOL_var_value = 605,                /* var_value  */
+  YYSYMBOL_var_name = 606,                 /* var_name  */
+  YYSYMBOL_VariableResetStmt = 607,        /* VariableResetStmt  */
+  YYSYMBOL_VariableSetStmt = 608,          /* VariableSetStmt  */
+  YYSYMBOL_VariableShowStmt = 609,         /* VariableShowStmt  */
+  YYSYMBOL_ViewStmt = 610,                 /* ViewStmt  */
+  YYSYMBOL_where_clause = 611,             /* where_clause  */
+  YYSYMBOL_with_clause = 612,              /* with_clause  */
+  YYSYMBOL_TransactionStmt = 613,          /* TransactionStmt  */
+  YYSYMBOL_opt_transaction = 614,          /* opt_transaction  */
+  YYSYMBOL_transaction_mode_list_or_empty = 615, /* transaction_mode_list_or_empty  */
+  YYSYMBOL_zone_value = 616,               /* zone_value  */
+  YYSYMBOL_col_name_keyword = 617,         /* col_name_keyword  */
+  YYSYMBOL_reserved_keyword = 618,         /* reserved_keyword  */
+  YYSYMBOL_type_func_name_keyword = 619,   /* type_func_name_keyword  */
+  YYSYMBOL_unreserved_keyword = 620        /* unreserved_keyword  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  317
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   29413
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  344
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  277
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  1225
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  2092
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   581
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,   332,     2,     2,
+     336,   337,   330,   328,   340,   329,   338,   331,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   343,   339,
+     325,   324,   326,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   341,     2,   342,   333,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   327,
+     334,   335
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   436,   436,   444,   459,   469,   470,   471,   472,   473,
+     474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
+     484,   485,   486,   487,   488,   489,   503,   521,   542,   552,
+     563,   564,   568,   570,   574,   578,   582,   586,   592,   594,
+     599,   604,   608,   613,   618,   622,   626,   631,   635,   695,
+     704,   721,   731,   741,   751,   761,   771,   781,   792,   814,
+     824,   834,   844,   854,   864,   877,   878,   883,   891,   899,
+     908,   916,   924,   933,   942,   951,   960,   970,   983,   996,
+    1010,  1019,  1027,  1035,  1045,  1055,  1062,  1069,  1077,  1085,
+    1093,  1101,  1109,  1116,  1123,  1131,  1138,  1145,  1153,  1161,
+    1169,  1177,  1185,  1193,  1203,  1210,  1218,  1226,  1234,  1241,
+    1250,  1258,  1266,  1274,  1284,  1285,  1289,  1290,  1295,  1299,
+    1303,  1310,  1314,  1319,  1324,  1331,  1338,  1343,  1347,  1355,
+    1363,  1366,  1380,  1391,  1392,  1396,  1403,  1413,  1417,  1421,
+    1425,  1426,  1434,  1442,  1446,  1459,  1474,  1488,  1503,  1517,
+    1535,  1556,  1560,  1561,  1565,  1566,  1570,  1575,  1583,  1584,
+    1611,  1612,  1613,  1614,  1615,  1616,  1619,  1622,  1623,  1627,
+    1628,  1640,  1656,  1657,  1660,  1661,  1664,  1668,  1672,  1676,
+    1680,  1684,  1688,  1692,  1696,  1700,  1704,  1708,  1712,  1716,
+    1720,  1724,  1730,  1731,  1734,  1735,  1750,  1778,  1779,  1782,
+    1783,  1786,  1787,  1789,  1791,  1792,  1795,  1797,  1798,  1805,
+    1816,  1827,  1840,  1841,  1844,  1845,  1846,  1849,  1850,  1851,
+    1855,  1858,  1859,  1863,  1864,  1869,  1873,  1877,  1882,  1889,
+    1890,  1891,  1892,  1893,  1901,  1902,  1908,  1918,  1920,  1924,
+    1928,  1932,  1934,  1936,  1938,  1954,  1955,  1961,  1967,  1972,
+    1978,  1985,  1986,  1989,  1990,  1994,  1995,  1998,  1999,  2001,
+    2014,  2016,  2018,  2020,  2022,  2024,  2026,  2028,  2030,  2032,
+    2034,  2037,  2056,  2058,  2061,  2063,  2065,  2067,  2069,  2082,
+    2084,  2097,  2104,  2111,  2118,  2125,  2135,  2139,  2149,  2153,
+    2163,  2173,  2174,  2175,  2176,  2177,  2178,  2179,  2180,  2181,
+    2182,  2183,  2184,  2191,  2195,  2196,  2197,  2198,  2199,  2200,
+    2201,  2202,  2203,  2204,  2205,  2217,  2221,  2225,  2229,  2233,
+    2240,  2265,  2269,  2275,  2294,  2297,  2298,  2299,  2300,  2307,
+    2308,  2310,  2312,  2314,  2316,  2318,  2320,  2321,  2323,  2325,
+    2327,  2329,  2331,  2350,  2352,  2354,  2364,  2365,  2369,  2379,
+    2391,  2392,  2395,  2406,  2411,  2416,  2421,  2426,  2432,  2437,
+    2443,  2444,  2447,  2448,  2449,  2450,  2451,  2452,  2467,  2477,
+    2487,  2500,  2501,  2502,  2508,  2509,  2510,  2511,  2512,  2515,
+    2527,  2548,  2549,  2553,  2561,  2562,  2563,  2578,  2579,  2582,
+    2583,  2586,  2588,  2592,  2599,  2606,  2617,  2628,  2638,  2647,
+    2664,  2665,  2667,  2670,  2671,  2674,  2681,  2682,  2685,  2686,
+    2689,  2690,  2694,  2695,  2698,  2704,  2708,  2716,  2721,  2733,
+    2735,  2737,  2739,  2742,  2745,  2748,  2752,  2753,  2754,  2755,
+    2756,  2760,  2767,  2774,  2781,  2790,  2794,  2798,  2804,  2808,
+    2818,  2822,  2826,  2831,  2836,  2855,  2858,  2875,  2898,  2927,
+    2956,  2998,  2999,  3000,  3001,  3002,  3009,  3016,  3017,  3020,
+    3021,  3025,  3029,  3030,  3035,  3036,  3037,  3038,  3041,  3042,
+    3043,  3044,  3047,  3048,  3052,  3053,  3057,  3061,  3068,  3069,
+    3072,  3100,  3101,  3110,  3111,  3114,  3118,  3134,  3135,  3139,
+    3150,  3161,  3172,  3186,  3187,  3188,  3189,  3190,  3191,  3192,
+    3193,  3194,  3195,  3196,  3197,  3198,  3199,  3200,  3201,  3202,
+    3206,  3207,  3211,  3218,  3228,  3235,  3245,  3246,  3247,  3248,
+    3252,  3256,  3263,  3270,  3280,  3281,  3282,  3285,  3286,  3290,
+    3291,  3292,  3295,  3296,  3299,  3300,  3303,  3306,  3307,  3311,
+    3315,  3322,  3323,  3324,  3325,  3326,  3327,  3328,  3329,  3339,
+    3352,  3382,  3395,  3412,  3425,  3447,  3468,  3489,  3501,  3518,
+    3531,  3541,  3554,  3561,  3565,  3573,  3581,  3603,  3619,  3632,
+    3645,  3658,  3674,  3690,  3703,  3709,  3717,  3725,  3733,  3741,
+    3749,  3767,  3769,  3774,  3782,  3783,  3787,  3788,  3791,  3794,
+    3798,  3802,  3809,  3819,  3820,  3824,  3831,  3841,  3851,  3887,
+    3888,  3892,  3898,  3907,  3913,  3920,  3922,  3927,  3938,  3942,
+    3949,  3950,  3951,  3952,  3955,  3956,  3979,  3992,  4005,  4006,
+    4010,  4011,  4014,  4015,  4016,  4017,  4020,  4025,  4026,  4027,
+    4028,  4029,  4030,  4031,  4032,  4033,  4037,  4065,  4068,  4069,
+    4074,  4075,  4076,  4077,  4081,  4082,  4086,  4087,  4088,  4089,
+    4090,  4091,  4092,  4093,  4094,  4095,  4116,  4117,  4122,  4127,
+    4132,  4137,  4141,  4142,  4147,  4151,  4152,  4156,  4157,  4161,
+    4162,  4163,  4167,  4168,  4169,  4173,  4174,  4175,  4181,  4185,
+    4186,  4187,  4194,  4195,  4196,  4200,  4201,  4202,  4203,  4207,
+    4208,  4209,  4213,  4214,  4218,  4219,  4223,  4225,  4227,  4229,
+    4231,  4233,  4235,  4240,  4245,  4251,  4259,  4264,  4271,  4278,
+    4282,  4283,  4287,  4288,  4289,  4293,  4294,  4297,  4298,  4302,
+    4303,  4307,  4308,  4312,  4313,  4317,  4318,  4345,  4374,  4375,
+    4379,  4386,  4393,  4400,  4410,  4411,  4423,  4427,  4434,  4444,
+    4445,  4446,  4449,  4452,  4455,  4456,  4459,  4460,  4464,  4465,
+    4469,  4470,  4477,  4485,  4493,  4501,  4509,  4517,  4528,  4529,
+    4533,  4534,  4538,  4539,  4543,  4544,  4548,  4549,  4553,  4564,
+    4565,  4566,  4567,  4571,  4572,  4575,  4576,  4581,  4582,  4583,
+    4584,  4588,  4589,  4593,  4595,  4610,  4615,  4616,  4620,  4621,
+    4629,  4633,  4634,  4642,  4643,  4646,  4650,  4658,  4666,  4670,
+    4678,  4686,  4693,  4700,  4708,  4719,  4727,  4735,  4746,  4754,
+    4762,  4769,  4778,  4789,  4800,  4801,  4804,  4805,  4806,  4810,
+    4818,  4819,  4820,  4821,  4822,  4823,  4831,  4841,  4865,  4877,
+    4891,  4905,  4909,  4913,  4916,  4927,  4928,  4931,  4935,  4936,
+    4940,  4941,  4944,  4949,  4951,  4956,  4957,  4958,  4962,  4972,
+    4973,  4974,  4978,  4979,  4980,  4981,  4982,  4983,  4987,  4988,
+    4992,  4997,  5007,  5011,  5019,  5027,  5035,  5043,  5050,  5051,
+    5055,  5058,  5061,  5064,  5067,  5074,  5076,  5078,  5083,  5096,
+    5097,  5098,  5102,  5103,  5104,  5105,  5108,  5119,  5120,  5121,
+    5125,  5138,  5144,  5152,  5153,  5156,  5158,  5162,  5163,  5171,
+    5178,  5185,  5192,  5199,  5217,  5223,  5229,  5238,  5244,  5250,
+    5256,  5262,  5278,  5291,  5304,  5317,  5349,  5350,  5354,  5361,
+    5380,  5387,  5394,  5401,  5408,  5415,  5422,  5430,  5438,  5446,
+    5454,  5462,  5469,  5476,  5483,  5493,  5505,  5506,  5507,  5511,
+    5513,  5525,  5529,  5533,  5548,  5571,  5572,  5573,  5578,  5579,
+    5580,  5581,  5582,  5583,  5584,  5585,  5586,  5587,  5588,  5589,
+    5590,  5591,  5592,  5593,  5594,  5595,  5596,  5597,  5598,  5599,
+    5600,  5601,  5605,  5606,  5607,  5608,  5609,  5610,  5611,  5612,
+    5613,  5614,  5615,  5616,  5617,  5618,  5619,  5620,  5621,  5622,
+    5623,  5624,  5625,  5626,  5627,  5628,  5629,  5630,  5631,  5632,
+    5633,  5634,  5635,  5636,  5637,  5638,  5639,  5640,  5641,  5642,
+    5643,  5644,  5645,  5646,  5647,  5648,  5649,  5650,  5651,  5652,
+    5653,  5654,  5655,  5656,  5657,  5658,  5659,  5660,  5661,  5662,
+    5663,  5664,  5665,  5666,  5667,  5668,  5669,  5670,  5671,  5672,
+    5673,  5674,  5675,  5676,  5677,  5678,  5679,  5680,  5681,  5682,
+    5683,  5684,  5685,  5686,  5687,  5688,  5689,  5690,  5691,  5692,
+    5693,  5694,  5695,  5696,  5697,  5698,  5699,  5700,  5701,  5702,
+    5703,  5704,  5705,  5706,  5710,  5711,  5712,  5713,  5714,  5715,
+    5716,  5717,  5718,  5719,  5723,  5724,  5725,  5726,  5727,  5728,
+    5729,  5730,  5731,  5732,  5733,  5734,  5735,  5736,  5737,  5738,
+    5739,  5740,  5741,  5742,  5743,  5744,  5745,  5746,  5747,  5748,
+    5750,  5751,  5752,  5753,  5754,  5755,  5756,  5757,  5758,  5759,
+    5760,  5761,  5762,  5763,  5764,  5765,  5766,  5767,  5768,  5769,
+    5770,  5771,  5772,  5773,  5774,  5775,  5776,  5777,  5778,  5779,
+    5780,  5781,  5782,  5783,  5784,  5785,  5786,  5787,  5788,  5789,
+    5790,  5791,  5792,  5793,  5794,  5795,  5796,  5797,  5799,  5800,
+    5801,  5802,  5803,  5804,  5805,  5806,  5807,  5808,  5809,  5810,
+    5811,  5812,  5813,  5814,  5815,  5816,  5817,  5818,  5819,  5820,
+    5821,  5822,  5823,  5824,  5825,  5826,  5827,  5828,  5829,  5830,
+    5831,  5832,  5833,  5834,  5835,  5836,  5837,  5838,  5839,  5840,
+    5841,  5842,  5843,  5844,  5845,  5846,  5847,  5848,  5849,  5850,
+    5851,  5852,  5853,  5854,  5855,  5856,  5857,  5858,  5859,  5860,
+    5861,  5862,  5863,  5864,  5865,  5866
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IDENT", "FCONST",
+  "SCONST", "BCONST", "XCONST", "Op", "ICONST", "PARAM", "TYPECAST",
+  "DOT_DOT", "COLON_EQUALS", "NULLS_FIRST", "NULLS_LAST", "ACCESS",
+  "ADD_P", "ALL", "ALTER", "ANALYZE", "ANALYSE", "AND", "ABORT_P", "ANY",
+  "AS", "ASC", "AUDIT", "AUTHORIZATION", "ACTION", "ALWAYS", "ADMIN",
+  "BEGIN_P", "BETWEEN", "BFILE", "BIGINT", "BINARY_FLOAT", "BINARY_DOUBLE",
+  "BLOB", "BOOLEAN_P", "BOTH", "BY", "BYTE_P", "CASCADE", "CASE", "CAST",
+  "CATALOG_P", "CHAR_P", "CHARACTERISTICS", "CHECK", "CLUSTER", "COLUMN",
+  "COMMIT", "COMMENT", "COLLATION", "CONVERSION_P", "CONNECTION",
+  "COMMITTED", "COMPRESS", "COLLATE", "CONNECT", "CONSTRAINT", "CYCLE",
+  "NOCYCLE", "CONSTRAINTS", "CLOB", "COALESCE", "CONTENT_P", "CONTINUE_P",
+  "CREATE", "CROSS", "CURRENT_DATE", "CURRENT_P", "CURRENT_TIMESTAMP",
+  "CURRVAL", "CURSOR", "CONCURRENTLY", "CONFIGURATION", "CACHE", "NOCACHE",
+  "COMMENTS", "DATE_P", "DAY_P", "DBTIMEZONE_P", "DEC", "DECIMAL_P",
+  "DEFAULT", "DEFERRABLE", "DELETE_P", "DESC", "DISTINCT", "DO",
+  "DOCUMENT_P", "DOUBLE_P", "DROP", "DEFERRED", "DATA_P", "DEFAULTS",
+  "DISABLE_P", "DISTRIBUTE", "PREPARE", "PREPARED", "DOMAIN_P",
+  "DICTIONARY", "ELSE", "END_P", "ESCAPE", "EXCLUSIVE", "EXISTS",
+  "EXPLAIN", "EXTRACT", "ENABLE_P", "EXCLUDE", "EVENT", "EXTENSION",
+  "EXCLUDING", "ENCRYPTED", "FALSE_P", "FILE_P", "FLOAT_P", "FOR", "FROM",
+  "FOREIGN", "FULL", "GLOBAL", "GRANT", "GREATEST", "GROUP_P", "HAVING",
+  "HOUR_P", "IDENTIFIED", "IF_P", "IMMEDIATE", "IN_P", "INCREMENT",
+  "INDEX", "INITIAL_P", "INSERT", "INHERIT", "INITIALLY", "INHERITS",
+  "INCLUDING", "INDEXES", "INNER_P", "IDENTITY_P", "INTEGER", "INTERSECT",
+  "INTO", "INTERVAL", "INT_P", "IS", "ISOLATION", "JOIN", "KEY", "LEADING",
+  "LEAST", "LEFT", "LEVEL", "LIMIT", "LIKE", "LOCAL", "LOCALTIMESTAMP",
+  "LOCK_P", "LOG_P", "LONG_P", "MATERIALIZED", "MAXEXTENTS", "MINUS",
+  "MINUTE_P", "MLSLABEL", "MODE", "MODIFY", "MONTH_P", "MATCH", "MAXVALUE",
+  "NOMAXVALUE", "MINVALUE", "NOMINVALUE", "NAMES", "NCHAR", "NCLOB",
+  "NEXT", "NEXTVAL", "NOAUDIT", "NOCOMPRESS", "NOT", "NOWAIT", "NULL_P",
+  "NULLIF", "NUMBER_P", "NUMERIC", "NVARCHAR2", "NO", "NODE", "OF", "OFF",
+  "OFFLINE", "OFFSET", "ON", "ONLINE", "ONLY", "OPERATOR", "OPTION", "OR",
+  "ORDER", "OUTER_P", "OWNER", "OIDS", "OPTIONS", "OWNED", "PCTFREE",
+  "PRECISION", "PRESERVE", "PRIOR", "PRIVILEGES", "PUBLIC", "PURGE",
+  "PARTIAL", "PRIMARY", "PARSER", "PASSWORD", "RAW", "READ", "REAL",
+  "RECURSIVE", "RENAME", "REPLACE", "REPEATABLE", "RESET", "RESOURCE",
+  "RESTART", "RESTRICT", "RETURNING", "RETURN_P", "REVOKE", "REUSE",
+  "RIGHT", "ROLE", "ROLLBACK", "ROW", "ROWID", "ROWNUM", "ROWS",
+  "REFERENCES", "REPLICA", "RULE", "RELEASE", "SCHEMA", "SECOND_P",
+  "SELECT", "SERIALIZABLE", "SESSION", "SESSIONTIMEZONE", "SET", "SHARE",
+  "SHOW", "SIZE", "SEARCH", "SMALLINT", "SIMPLE", "SETOF", "STATISTICS",
+  "SAVEPOINT", "SEQUENCE", "SYSID", "SOME", "SNAPSHOT", "START", "STORAGE",
+  "SUCCESSFUL", "SYNONYM", "SYSDATE", "SYSTIMESTAMP", "TABLE", "TEMP",
+  "TEMPLATE", "TEMPORARY", "THEN", "TIME", "TIMESTAMP", "TO", "TRAILING",
+  "TRANSACTION", "TREAT", "TRIM", "TRUNCATE", "TRIGGER", "TRUE_P",
+  "TABLESPACE", "TYPE_P", "TEXT_P", "UID", "UNCOMMITTED", "UNION",
+  "UNIQUE", "UPDATE", "USER", "USING", "UNLOGGED", "UNENCRYPTED", "UNTIL",
+  "VALIDATE", "VALUES", "VARCHAR", "VARCHAR2", "VERBOSE", "VIEW", "VALID",
+  "WHEN", "WHENEVER", "WHERE", "WITH", "WRITE", "WITHOUT", "WORK", "XML_P",
+  "YEAR_P", "ZONE", "ORACLE_JOIN_OP", "CONNECT_BY", "CONNECT_BY_NOCYCLE",
+  "HI_THEN_RETURN", "LO_THEN_LIMIT", "HI_THEN_LIMIT", "'='", "'<'", "'>'",
+  "POSTFIXOP", "'+'", "'-'", "'*'", "'/'", "'%'", "'^'", "AT", "UMINUS",
+  "'('", "')'", "'.'", "';'", "','", "'['", "']'", "':'", "$accept",
+  "stmtblock", "stmtmulti", "stmt", "CreateAsStmt", "create_as_target",
+  "opt_with_data", "CreateRoleStmt", "OptRoleList", "CreateOptRoleElem",
+  "role_list", "AlterOptRoleElem", "AlterObjectSchemaStmt", "RenameStmt",
+  "AlterTableStmt", "alter_table_cmds", "alter_table_cmd", "opt_set_data",
+  "alter_using", "alter_generic_options", "alter_generic_option_list",
+  "alter_generic_option_elem", "generic_option_elem",
+  "generic_option_name", "generic_option_arg", "opt_collate_clause",
+  "OptDistributeType", "OptDistributeByInternal", "OptSubCluster",
+  "OptSubClusterInternal", "pgxcnode_name", "pgxcgroup_name", "pgxcnodes",
+  "pgxcnode_list", "TableConstraint", "ConstraintElem", "ExistingIndex",
+  "ExclusionWhereClause", "ExclusionConstraintList",
+  "ExclusionConstraintElem", "ConstraintAttributeSpec",
+  "ConstraintAttributeElem", "RoleId", "opt_column",
+  "alter_column_default", "CreateSeqStmt", "OptSeqOptList", "SeqOptList",
+  "SeqOptElem", "opt_with", "opt_by", "IndexStmt", "opt_unique",
+  "opt_concurrently", "opt_index_name", "index_name",
+  "access_method_clause", "access_method", "index_params", "index_elem",
+  "opt_collate", "opt_class", "opt_nulls_order", "reloptions",
+  "opt_reloptions", "reloption_list", "reloption_elem", "def_arg",
+  "func_type", "qual_all_Op", "sub_type", "subquery_Op", "OptTableSpace",
+  "alias_clause", "all_Op", "any_operator", "analyze_keyword", "a_expr",
+  "AexprConst", "attr_name", "Bit", "b_expr", "case_default", "case_expr",
+  "case_when_list", "case_when_item", "Character", "c_expr", "ColId",
+  "ColLabel", "common_table_expr", "columnDef", "ColQualList",
+  "ColConstraint", "any_name_list", "any_name", "attrs",
+  "ColConstraintElem", "opt_definition", "definition", "def_list",
+  "def_elem", "OptConsTableSpace", "opt_no_inherit", "opt_column_list",
+  "columnList", "columnElem", "key_match", "key_actions", "key_update",
+  "key_delete", "key_action", "ConstraintAttr", "columnref",
+  "ConstInterval", "ConstDatetime", "ConstTypename", "CreateStmt",
+  "OptTemp", "OptInherit", "create_generic_options", "cte_list", "OptWith",
+  "OnCommitOption", "OptDistributeBy", "OptTypedTableElementList",
+  "TypedTableElementList", "TypedTableElement", "columnOptions",
+  "ctext_expr", "ctext_expr_list", "ctext_row", "DeleteStmt",
+  "document_or_content", "DropStmt", "drop_type", "DropStmt_opt_purge",
+  "ExplainStmt", "ExplainableStmt", "explain_option_list",
+  "explain_option_elem", "explain_option_name", "explain_option_arg",
+  "expr_list", "trim_list", "from_clause", "from_list", "func_arg_expr",
+  "func_arg_list", "extract_list", "extract_arg", "func_expr", "func_name",
+  "group_clause", "having_clause", "Iconst", "indirection_el",
+  "indirection", "InsertStmt", "opt_as", "insert_rest_no_cols",
+  "insert_rest", "insert_column_list", "insert_column_item",
+  "interval_second", "iso_level", "joined_table", "join_qual",
+  "join_outer", "join_type", "row", "MathOp", "multiple_set_clause",
+  "name", "name_list", "NonReservedWord", "NonReservedWord_or_Sconst",
+  "Numeric", "NumericOnly", "OptTableElementList", "opt_alias_clause",
+  "opt_all", "opt_asc_desc", "opt_boolean_or_string", "opt_byte_char",
+  "opt_distinct", "opt_drop_behavior", "opt_encoding", "opt_from",
+  "opt_indirection", "opt_interval", "opt_name_list", "opt_restart_seqs",
+  "opt_type_mod", "opt_type_modifiers", "opt_verbose", "opt_with_clause",
+  "qualified_name_list", "qualified_name", "qual_Op", "relation_expr",
+  "relation_expr_list", "relation_expr_opt_alias", "returning_clause",
+  "returning_item", "Sconst", "select_clause", "SelectStmt",
+  "select_with_parens", "select_no_parens", "set_clause_list",
+  "set_clause", "for_locking_clause", "opt_for_locking_clause",
+  "for_locking_items", "for_locking_item", "for_locking_strength",
+  "locked_rels_list", "opt_nowait", "select_limit", "opt_select_limit",
+  "limit_clause", "offset_clause", "select_limit_value",
+  "select_offset_value", "set_expr", "set_expr_list", "set_expr_row",
+  "set_rest", "set_rest_more", "set_target", "set_target_list",
+  "SignedIconst", "single_set_clause", "SimpleTypename", "simple_select",
+  "sortby", "sortby_list", "sort_clause", "opt_sort_clause",
+  "opt_start_with_clause", "start_with_clause", "connect_by_clause",
+  "TableElement", "TableLikeClause", "TableLikeOptionList",
+  "TableLikeOption", "TableElementList", "table_ref", "target_item",
+  "target_list", "transaction_mode_item", "transaction_mode_list",
+  "TruncateStmt", "TruncateStmt_log_opt", "TruncateStmt_storage_opt",
+  "Typename", "type_function_name", "UpdateStmt", "values_clause",
+  "var_list", "var_value", "var_name", "VariableResetStmt",
+  "VariableSetStmt", "VariableShowStmt", "ViewStmt", "where_clause",
+  "with_clause", "TransactionStmt", "opt_transaction",
+  "transaction_mode_list_or_empty", "zone_value", "col_name_keyword",
+  "reserved_keyword", "type_func_name_keyword", "unreserved_keyword", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-1800)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1156)
+
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    1882,   248,   -94,   -94,   -13,  1396,  1573,   -85,   -94,   238,
+   21142,   208, 26231,   140, 23241, 21443, 26530,   -67,   -24, 21742,
+     -64, 23540,   505,   387,    60, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,    96,   280,
+   -1800,    78, -1800,    94, -1800, -1800,   124, -1800, -1800, -1800,
+   -1800,   395, -1800, 23839, 22041, 24138, -1800, -1800, -1800,   438,
+     139, -1800,   483,   829,   266, 20243, -1800, -1800, -1800, -1800,
+     404,   532, -1800, -1800, -1800,   234, -1800,   303,   509,   286,
+   -1800, -1800, -1800, -1800,   350, -1800, 26829,   674, -1800, -1800,
+   -1800,   740, 13162,   323, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,   618,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800,   339, -1800,   568, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,   445,
+   -1800, -1800,   255,   453, 26530, -1800, -1800, -1800, -1800, -1800,
+    5757,   674, 24437,    64, 19645,   674, 22340,   470,   476,   597,
+   -1800, -1800,   388, -1800,   766,   486,   701,   445, -1800,   438,
+   21742, 14424,   227,   227,   494, 24736,   577,  6086, -1800, 26530,
+   -1800, -1800,   499, 26530,   508,   519,   395, -1800,  1882,   793,
+     772,   160,   827,   160,   673,   768,   -64,    80, -1800, -1800,
+     779, 28857,   837, 28875,   844, 28883, -1800,   804,   928,   -37,
+   -1800,     6, -1800, -1800,   921, -1800, -1800, -1800, -1800, -1800,
+     781, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800,   722, -1800, -1800, -1800, -1800,   977,   754, 25035,
+   25334, 25035, -1800, -1800, 27128, -1800,   105,   970,   744,    36,
+   -1800, -1800, -1800,   441, -1800, 17993, -1800, -1800,   740, -1800,
+   -1800,   940, 26530,   999, -1800, 27427, -1800,    57, -1800, -1800,
+   -1800, -1800,  1112,  1134,  1157,  1162, 11882,   852, -1800,   863,
+     865,  1177, -1800,    65,    65,  1001,   871,   895,    69,   902,
+    1221, -1800,  1234,   911, -1800,   913,  1245,   916,  7374, -1800,
+     917,    65,    65,   918,  7374,   227,  1253, -1800, -1800, -1800,
+    1254, -1800, -1800,    54,   924,   925,  7374,  7374, -1800,  5435,
+    2557, -1800, -1800, -1800,   477,   945,    70, -1800,   674, -1800,
+      72, -1800, -1800, -1800,  7374, -1800, -1800, -1800,    -6, -1800,
+   -1800,    77, -1800,   161, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, 19346,  1239, -1800,    93,   674,     6,   131,  1193,
+   17363, 17678, -1800, -1800,  1109, -1800, -1800,    16, 25035, -1800,
+   17048,  7374, -1800,   227,   227, -1800, 26530, -1800, 14732, -1800,
+   18370, -1800,   564,   499, 26530, -1800,   927,  1249, -1800, -1800,
+   -1800, -1800, 21742, 25035, -1800, -1800,   395,  7374,   395,   845,
+    6408,  7374,    29,  1155, -1800,  1082,  1163,  1085,  1128, -1800,
+     673,   768, 25035,   979,  1237,  1091,  1099,   481,   -43,  1252,
+     103, 25035,  1237,  1100,  1164, 26530,  1015,   969,  1026,   971,
+     730,    39,  1248,   972, -1800, -1800, -1800, -1800, 21742,    74,
+     972, 25035,  1030,   411,   972,   442, -1800, -1800, -1800,   438,
+   -1800,   674,   244, -1800, -1800, -1800, 26530, 25035,  2642,  1126,
+    1289,   -56,   983,  1213,    36, -1800, -1800, -1800, -1800, 26530,
+   18716,   988,  1263, -1800, 26530,  1114,   740, 20243, -1800, -1800,
+   -1800, -1800,  1322,   671, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800,   674, 26530, -1800,   227, 11238,  2363,    42,
+   -1800,  7374,  1322,  7374,  7374, -1800, -1800, -1800, -1800,   814,
+    1322,  7374,  7374,  1322,  7374,  1312,  7374, -1800, -1800, 15368,
+    1321,   227,  1322,  1024,  7374,  5113,  1321,  1321,  2114,  1000,
+    1104, -1800,   537,  4149,  7374, 18716, 11560,  1003,   566,  7696,
+     107,  1005,  7374,  8018,  8340,  8662,  8984,  9306,  9628,  9950,
+   10272, 10594,  1058,   590, -1800, -1800, 12204, 16418,    66, -1800,
+    1322,   796, -1800,  4479, -1800,   165, 14116,  5757,  1032,  1239,
+   -1800, -1800,  1061, -1800, -1800, -1800,    82, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,  1004, -1800,
+   -1800,  1004, -1800,  1202,  1203, 21742,   127,  1012, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,  1681, -1800,
+   -1800, 26530, -1800, -1800,  -116, -1800,  1027, -1800, -1800,  6086,
+   -1800, 26530,  1014, 25633,    55, -1800, 18262, -1800,  1013, -1800,
+    1101,  1201,  1158, -1800, -1800, -1800, 18370,  1017, 18370,   670,
+   -1800, -1800, -1800,   574, -1800, 25035,  1175, -1800, -1800, -1800,
+   -1800,    29,  1163, 28941,  1023, 26530, 26530,  1065,  1211,  1033,
+    1219,  -111, 26530, -1800, -1800, -1800, 26530, 26530,  1033, 27726,
+   28025, 26530, 22641, 19944,   -29,   -23, 26530, 22942, -1800, 26530,
+   -1800, 25035, -1800, 20243, 19031, 26530, 18716, -1800, 26530,  1166,
+      89, -1800, 26530,  1033, 26530, 18357, 29007, 26530, 26530, 29112,
+   26530, 26530,    48,  1152, -1800, -1800, -1800, -1800,  1069, 25035,
+     652,  1179, -1800, -1800,  1042, -1800, -1800,    95, -1800,  1338,
+      95, -1800,    95, -1800,   423,  1342,   133,   722, -1800,  2642,
+   -1800,  1278,   505, 26530, 20542,   860, 26530,  1365, 26530, -1800,
+      36, -1800, 18716, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, 18181,  7374,    42,  7374,  1287,
+   -1800, 18370,   599,  1062, 18370, -1800,   609,   623, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800,  1067,  1274, -1800,  1070,   633,
+     638,  1073,   644,  2078, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800,  1075,  1068,  1076,   318, 18316,
+    6730,  7374,  6730,  6730, 18331,  1078,  1079, -1800,  7374, -1800,
+   -1800, -1800, -1800, -1800, -1800,  1083, -1800, -1800,  1084,  1084,
+    1001,  1086, -1800,    27, -1800,  1204,  1094, -1800,  1084,  1084,
+    1095,  1096, -1800, -1800,  1097,  1097,  1102, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800,  1312, -1800, 11560, 11560,   826, -1800,
+   11560,  5435, -1800,  1240, -1800,  1103,   692, 11560,  1107, 10916,
+   15368, 18397,  1108,   141,  1113,   287,  1117,   287,  1119,   170,
+     871,   170,  1121,   101,  1122,   101,  1123,   101,  1127,    61,
+    1118, -1800, -1800,  1131,  1132,   165, -1800, -1800, 16733,  1111,
+    1156,  1170,  1184, -1800,  1133,  1190, -1800, -1800,  7374,  7374,
+    1135, -1800,   102, 13480,  1139, -1800, 25633, 25633,  1181, -1800,
+    7374,  1310,   438,  1322,   796, 17993, -1800, -1800, -1800,   497,
+   -1800, -1800,  7374, -1800,   651,   227, 14732,   643,  7052, -1800,
+   -1800,   505, 26530, -1800,  1138,  1032, -1800,  1182, 13798, 26530,
+   -1800,   643, -1800, -1800, -1800, -1800,  7374, -1800,  1180, -1800,
+    7374, -1800, -1800,  1145, -1800, -1800, -1800, -1800, -1800,  1208,
+     972,  7374,  4149, -1800,    68, 26530,  1153,  1154, 26530, -1800,
+    -105,  1356, 26530, -1800,  1159,    28, -1800, -1800,  1384,   127,
+    1386,   127, -1800, -1800, -1800, -1800,   525, -1800,   227,  1167,
+   26530, 26530, 26530, 26530, -1800, -1800, -1800, -1800,  4149, -1800,
+   -1800, 18716, 18716, 18716,   679, -1800, -1800,   674, -1800, -1800,
+     694, -1800,  -117, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800,    81,   972, -1800,  1215,  1224,   491,   972, -1800,
+   -1800, -1800, -1800, -1800, 25035,   983, -1800, 20243,  1353,  1290,
+     385, -1800,   166, 20243,  1322, 20243,  1294,  1212, -1800, -1800,
+   25035, 26530, -1800, -1800,    95, -1800, -1800, -1800, -1800, -1800,
+   26530,    95,    95, -1800, 25035, -1800,  1183,   222, 25035,  1219,
+   -1800,  4149, -1800,   708, -1800,  1178, -1800, -1800,  1176,    38,
+    1311,  1319, -1800,   505,    36,  1114, -1800,  7374,  1417, 18370,
+   -1800, -1800,  7374, -1800, -1800,  7374, -1800, -1800,  7374, -1800,
+   -1800, -1800, -1800, -1800,  7374, -1800, 15368, -1800,  1247,  1206,
+    4149,  1191,  1078,  1195,  1197,  7374, -1800,  2344,  1322,  1097,
+    1097, -1800,  1322,  1322,  1322, -1800,  1322,   149,   149,  4149,
+   11560,  1440,   918, 11560, 11560, 11560, 11560, 11560, 11560, 11560,
+   11560, 11560, 12526,   432,   709, -1800,  5435, -1800,  7374,  1276,
+    5435, -1800,  1205,  1541,  1207,  5435, -1800,  5435, -1800,  5435,
+   -1800,  5435, -1800, -1800,  5435, -1800,  5435, -1800,  5435, -1800,
+    5435, -1800,  7374,  5435, -1800,  5435, -1800, -1800, -1800,   674,
+     457,   -21,  1295,  1322,  1373,   -51,   -51, -1800,   674,  1209,
+    1214,  4798,  1181, 14116, -1800, -1800,  1398,  1349, -1800, 14116,
+    1349,  1349,  1403, 18370,  1516,  1432,     6,  1225, -1800, -1800,
+    1399,  1400,   135,  1728,  1242, 26530, -1800,  5757,  5757, -1800,
+   -1800, 18370, -1800,  1226,  1231, 26530,   643, -1800, -1800,   710,
+   -1800,   444, -1800, -1800, -1800, -1800, 25035, 26530,  2774, -1800,
+   -1800, -1800, -1800, 12844, 26530, -1800,   721, -1800, 26530, -1800,
+   26530,   728,   547, -1800,   465,   971,   592,  1272, -1800, -1800,
+   26530, -1800, 26530, -1800,   227,  7374, -1800, -1800, -1800, -1800,
+    1510, -1800, -1800, -1800, -1800, 19031, -1800, -1800, -1800, 18716,
+   15053, 18716, 26530, 26530, 26530, 26530, 26530,  1235,  1259,  1238,
+   -1800,    56,   674, 20243, 20243, -1800, -1800,  1238, -1800,  1238,
+     674,   674,  1065,   747, -1800, -1800, -1800, -1800,   -49, -1800,
+   20841,   860, -1800, -1800, 26530,  1435, 20542, -1800, -1800, -1800,
+    1528,  1296, -1800, -1800, -1800, 18370, -1800, 18370, -1800, 18370,
+    3079, -1800,  1265, -1800,  1246, -1800, -1800, -1800,  1078, -1800,
+     688,  1305,  1306,  1250,  1251,  1255,   688, -1800,   625,  1468,
+    1292,  1352,  1352,   149,   149,    79,    79,    79,  1579,   432,
+   -1800,  3233,   741, 11560,   749,  5435, -1800,  7374,   641,  3316,
+    3340,  3501,  3790,  3829,  3869,  4023,  4117,  1321, 15860, 15944,
+     796, -1800, -1800, -1800, -1800, -1800, -1800,  1256, -1800, -1800,
+    1257,  1260, -1800, -1800, 28324,  1181, 14116, -1800, -1800,  1173,
+   -1800, -1800, 14116,  7374,  7374,   251,   674,  1285,  1297,    92,
+    1328, -1800, -1800,  1262, -1800, -1800,  1270, -1800, -1800, 26530,
+     753, -1800,   227,   505, 26530, 13798,   643, -1800, -1800, -1800,
+   -1800,  7374,   778, -1800,  1300,    41,  1553,  1277,   785, -1800,
+   26530,   786,   547, -1800,  1304, -1800,   110,    32,  1491, -1800,
+   -1800,  1443, -1800,  7374, -1800,  1444,    56, 26530, -1800,  4149,
+     127,   127,   787, 26530,  1337, -1800, -1800, -1800,  1301,  1313,
+    1314,   716,  1316,  1095,  1320,  1096, 28623,  1102,  1322,   671,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800,   744, -1800, -1800,
+    1326, -1800,  1379, -1800, -1800, -1800, 26530,   971,  1635, 20243,
+    1322, -1800, -1800,  1238,  1238, -1800, -1800,  1325,  1637, 26530,
+   20542, -1800,  1354,   795, -1800, -1800,  1319,    98, -1800,  1327,
+     860, -1800,   450, 26530,  1565, -1800, -1800, -1800, -1800, -1800,
+    1330,  1421,  1499, -1800, -1800, -1800,  1336, 11560, -1800,   625,
+   -1800, 16010,   741, -1800, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800, -1800,  7374,
+     993,  1078, 18370,  1382,  7374,  7374,   675,  1429,   796,  1534,
+    1535,  1436, -1800, -1800,  7052, -1800,   797, -1800, -1800, -1800,
+     801, -1800,   547,  1698, 16046,  1304, 12844, 15683, 26530, 25932,
+     739, 25932,  4479,  1462, -1800,  1304,  1370,  1412, -1800, -1800,
+   -1800, -1800, -1800, -1800, 18370, -1800, -1800, -1800,  1510, -1800,
+   -1800, -1800, -1800,  7374, -1800, 15368,   744,   334, 15053, 26530,
+     806, -1800,   505, -1800, 12844,   505,  1183,  1374,  1502, -1800,
+   20841,  1296,   113,   113, 25035,  1319,  1470, -1800,  1471, -1800,
+   -1800,  1437, -1800,  1380, -1800, -1800,   480, -1800, 18370,  7374,
+    1383, -1800,  7374, 18370, 18370, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800, -1800,   846, -1800,   681,  1385, 26530, 26530, 11560,
+   -1800,   119,   116, -1800,  1562, 25035,  1304, -1800, -1800, -1800,
+    1553,  1412, -1800,  1388, -1800, -1800, 26530,   129, -1800,   129,
+     171, 25035,  1412, 18716, -1800,  1583, -1800,  1337, 18370,  1390,
+     369,  1431, -1800, -1800,  1697, -1800,   888, -1800, -1800,   860,
+    1435, -1800, -1800,  1565, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1800, -1800,   890,  1296, -1800, -1800, -1800, -1800,  1322, 18370,
+   26530, 18370, -1800,  7052, 13798,   643,  7374, -1800,   604,  1292,
+   -1800, -1800, -1800, -1800,  1304,   983,  1412, 25932,  1415, 15368,
+   -1800,   985,   985, -1800,   983, -1800, -1800,   896, -1800,  1441,
+     547, -1800, -1800,  1439, -1800,   505,  1259, 12844,  1319,   860,
+    1698,  1437, -1800,  1565,  1393,   900, -1800,   908, -1800, 16079,
+    1544, -1800,  1412,  1559, -1800,   129,  1401, -1800,  1397, -1800,
+   -1800, -1800, -1800,  1559,   547, -1800, 18716, 26530, -1800, -1800,
+    1296, -1800,  1296,  1319, -1800,  1437, -1800, -1800,   505,  1548,
+   -1800,    20,  1543,   985,  7374,   547, -1800,  1543, -1800, -1800,
+    1032,  1565,  1296, -1800,   643,  1605, -1800, -1800, -1800, -1800,
+      19, -1800,  1550,  1551, -1800, 16094, -1800, -1800,  1437,  1565,
+   -1800, -1800,   335,   335,  1666, -1800,  1460, -1800, -1800,   547,
+   -1800,  1437, -1800,  1731, -1800,    75, -1800, -1800, -1800, -1800,
+   -1800, -1800
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+      25,     0,   938,   938,   938,   458,     0,     0,   938,   722,
+       0,   938,     0,   684,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     2,     4,     7,    10,     6,    16,
+       5,     9,    15,     8,    11,    12,    13,    14,     0,   839,
+      17,   745,   746,   744,    18,    20,   833,    21,    23,    22,
+      24,   721,    19,     0,     0,     0,   937,   936,   920,   940,
+       0,   923,     0,     0,     0,     0,   452,   451,   197,   457,
+       0,     0,   502,   503,   501,     0,   505,     0,   497,     0,
+     504,   494,   493,   500,     0,   495,     0,     0,   924,   255,
+     256,   722,     0,   720,   519,   512,   517,   516,   518,   371,
+     903,  1090,  1087,  1084,  1085,  1089,  1088,  1086,  1091,  1092,
+     948,   950,   949,  1093,   951,  1094,  1095,   952,  1098,   953,
+    1100,  1102,  1104,  1099,  1105,  1108,  1111,  1112,  1109,  1101,
+    1106,  1110,  1103,  1096,  1097,  1107,   956,  1113,   954,   955,
+    1116,  1117,  1114,  1119,  1120,  1122,  1121,  1169,  1170,  1118,
+    1115,   957,  1123,  1130,   958,  1124,  1125,  1128,  1129,  1127,
+    1126,   959,  1131,  1133,  1134,  1135,  1138,  1137,  1136,  1132,
+     961,   960,  1139,  1140,  1141,  1142,  1143,   962,  1144,  1145,
+    1151,  1146,  1147,  1148,  1149,  1150,  1152,  1153,  1155,  1157,
+     963,   966,  1158,  1156,  1154,  1159,  1160,  1162,  1163,  1161,
+    1165,  1164,  1168,  1171,  1174,  1175,  1173,  1172,  1167,  1166,
+    1176,   967,  1187,  1179,  1178,  1180,  1182,  1183,  1184,  1185,
+    1186,  1189,  1190,  1188,  1181,  1177,  1191,  1192,  1196,     0,
+    1194,  1197,  1200,   965,  1202,   964,  1195,  1201,  1193,  1199,
+    1198,  1203,  1204,  1205,  1206,  1207,   969,   970,  1208,  1209,
+    1212,  1210,  1211,  1213,  1214,  1216,  1215,   968,  1217,  1218,
+    1219,   971,  1220,  1222,  1221,  1223,  1224,  1225,   897,   899,
+     373,   372,     0,   925,  1201,   969,  1208,   928,   683,   682,
+       0,  1098,  1142,  1152,  1189,  1191,     0,   969,  1208,  1223,
+     904,   798,     0,   911,     0,   969,  1208,   907,   926,   940,
+       0,     0,     0,   725,   730,   736,     0,     0,   891,     0,
+     637,   462,   918,   711,   745,     0,     0,     1,    25,   693,
+       0,   671,     0,   671,   751,     0,     0,   754,   745,   744,
+    1133,     0,  1133,     0,  1133,     0,   873,     0,     0,     0,
+     875,   939,   921,   743,     0,   932,   456,   455,   454,   453,
+     458,   640,  1074,  1076,  1075,  1077,  1078,  1079,  1080,  1081,
+    1082,  1083,   193,   166,   642,   643,   641,   200,     0,     0,
+       0,     0,   499,   498,     0,   496,     0,  1133,   389,   688,
+     387,   931,   514,     0,   520,   526,   523,   719,   722,   902,
+     900,     0,     0,     0,   933,     0,   927,   371,   316,   728,
+     588,   694,   948,   950,   949,   951,   952,     0,   557,   558,
+       0,   956,   571,   954,   955,  1117,   958,     0,   959,     0,
+     961,   440,   960,     0,   437,   560,   962,     0,     0,   318,
+       0,   963,   966,  1162,     0,     0,   967,   436,   574,   572,
+     965,   555,   556,   970,     0,     0,     0,     0,   867,     0,
+     866,   363,   365,   257,   435,   362,     0,   446,     0,   364,
+       0,   315,   370,   445,     0,   317,   368,   868,   533,   581,
+     889,   372,   805,     0,   905,   690,   807,   689,   644,   808,
+     645,   806,     0,  1100,   906,     0,     0,   796,     0,     0,
+       0,     0,   910,   908,     0,   922,   734,   714,     0,   732,
+       0,     0,   593,   727,   726,   731,     0,   737,     0,   482,
+     481,   483,     0,   919,     0,   638,   710,     0,   749,   748,
+       3,   692,     0,     0,   669,   670,     0,     0,     0,     0,
+       0,     0,   782,   762,   766,   774,   765,   779,   780,   892,
+     755,     0,     0,     0,   168,     0,     0,   168,     0,     0,
+       0,     0,   168,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    59,    65,   109,   110,   111,     0,   168,
+      63,     0,     0,     0,    61,     0,   874,   871,   872,     0,
+     877,     0,     0,   192,    31,   199,   202,     0,   173,  1133,
+       0,   411,   411,  1133,   688,   509,   507,   506,   508,     0,
+       0,   390,   685,   687,     0,   511,   722,     0,   662,   676,
+     677,   675,     0,     0,   522,   816,   678,   525,   524,   664,
+     513,   901,   898,     0,  1201,   930,   367,   971,     0,   347,
+     350,     0,     0,     0,     0,   658,   657,   656,   369,   540,
+       0,     0,     0,     0,     0,   276,     0,   660,   659,     0,
+     314,   583,     0,   442,     0,     0,   260,   261,   527,     0,
+     368,   865,   728,     0,     0,     0,     0,     0,     0,   243,
+       0,     0,     0,   635,   633,   634,   627,   628,   629,   630,
+     631,   632,     0,     0,   241,   252,   273,     0,   438,   439,
+       0,   709,   321,     0,   319,   272,     0,     0,   917,     0,
+     810,   809,     0,   942,   946,   947,     0,   945,   941,   804,
+     812,   488,   487,   811,   803,   801,   896,   895,   799,   893,
+     802,   800,   909,     0,     0,     0,   688,     0,   374,   972,
+     973,   974,   975,   976,   977,   978,   979,   980,   981,   982,
+     983,   984,   985,   988,   987,   986,   989,   990,   991,   992,
+     993,   994,   995,   996,   997,   998,   999,  1000,  1001,  1002,
+    1003,  1004,  1005,  1006,  1007,  1008,  1010,  1011,  1012,  1013,
+    1009,  1014,  1015,  1016,  1017,  1018,  1019,  1020,  1021,  1022,
+    1023,  1024,  1025,  1026,  1027,  1028,  1029,  1030,  1031,  1032,
+    1033,  1036,  1034,  1035,  1037,  1038,  1039,  1040,  1041,  1043,
+    1044,  1045,  1046,  1047,  1048,  1042,  1049,  1050,  1051,  1052,
+    1053,  1054,  1055,  1056,  1057,  1058,  1059,  1060,  1061,  1062,
+    1063,  1064,  1065,  1066,  1067,  1068,  1069,  1070,  1071,  1072,
+    1073,   590,   589,   324,   376,   378,   377,   375,     0,   594,
+     738,     0,   694,   761,   917,   758,     0,   760,   485,     0,
+     463,     0,     0,   668,   600,   832,   674,   835,   837,   831,
+       0,     0,     0,   771,   769,   789,   788,   783,   790,   257,
+     785,   781,   752,     0,   767,     0,   776,   764,   753,   777,
+     778,   782,   765,     0,     0,     0,     0,   205,     0,     0,
+       0,     0,     0,    81,   143,   167,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   101,     0,
+     104,     0,   103,     0,     0,     0,     0,   108,     0,     0,
+       0,   107,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   613,   870,   876,   934,     0,     0,
+      29,     0,   201,   203,     0,   178,   180,     0,   177,   195,
+       0,   185,     0,   187,     0,     0,   190,   193,   171,   172,
+     174,     0,     0,     0,   666,   467,     0,     0,     0,   491,
+     688,   391,     0,   686,   388,   510,   490,   515,   521,   817,
+     663,   818,   935,   929,   695,     0,     0,   347,     0,     0,
+     351,   527,     0,     0,   536,   537,     0,     0,   541,   544,
+     545,   546,   543,   547,   542,     0,     0,   548,     0,     0,
+       0,     0,     0,     0,   251,   635,   633,   634,   627,   628,
+     629,   630,   631,   632,   253,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   527,   531,     0,   366,     0,   325,
+     649,   651,   653,   326,   661,   357,   360,   441,   718,   718,
+       0,   654,   647,   440,   646,   650,   359,   361,   718,   718,
+       0,     0,   652,   648,   716,   716,     0,   821,   822,   824,
+     823,   820,   886,   258,   274,   864,     0,     0,     0,   329,
+       0,     0,   285,     0,   281,  1198,   277,     0,     0,   244,
+       0,   275,  1198,   270,  1198,   268,  1198,   269,  1198,   262,
+    1198,   263,  1198,   264,  1198,   265,  1198,   266,  1198,   267,
+       0,   240,   239,     0,  1198,   271,   579,   577,     0,     0,
+     698,   699,   700,   697,   608,   696,   701,   322,     0,     0,
+       0,   549,     0,     0,   532,   862,   668,   668,   534,   869,
+       0,   585,     0,     0,   709,     0,   712,   713,   735,   881,
+     733,   591,     0,   814,     0,   813,     0,   741,     0,   484,
+     639,     0,     0,   667,   250,   917,   599,     0,     0,     0,
+     604,   741,   601,   672,   673,   834,     0,   772,     0,   763,
+       0,   786,   787,   773,   723,   775,   768,   756,   757,     0,
+      60,     0,     0,    68,     0,     0,     0,     0,     0,   112,
+       0,     0,     0,   158,     0,   115,    87,   113,  1133,   688,
+    1133,   688,   100,    95,    96,    94,   130,   131,     0,     0,
+       0,     0,     0,     0,    97,    92,    93,    89,     0,   102,
+     105,   973,   997,  1051,     0,   119,   121,     0,   126,    51,
+       0,   223,   226,   106,    85,    88,    86,   136,   138,   135,
+      82,    66,   168,    64,    55,     0,     0,     0,    62,    53,
+      49,   611,   610,   612,     0,   411,    48,     0,     0,     0,
+       0,    44,     0,     0,     0,     0,     0,     0,    30,    32,
+       0,     0,   176,   194,     0,   182,   183,   179,   184,   186,
+       0,     0,     0,   175,     0,    28,   475,  1125,     0,  1172,
+     847,   414,   845,     0,   412,     0,   858,   846,   665,     0,
+       0,   471,   414,     0,   688,   511,   392,     0,     0,   346,
+     348,   562,     0,   559,   576,     0,   717,   573,     0,   655,
+     564,   565,   561,   575,     0,   729,     0,   715,     0,     0,
+       0,     0,   530,     0,     0,     0,   570,   528,     0,   716,
+     716,   327,     0,     0,     0,   353,     0,   331,   332,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   344,   343,     0,   282,     0,   300,     0,     0,
+       0,   287,  1198,   279,     0,     0,   299,     0,   297,     0,
+     298,     0,   291,   292,     0,   293,     0,   294,     0,   295,
+       0,   296,     0,     0,   289,     0,   290,   580,   578,     0,
+       0,     0,     0,     0,     0,   839,   839,   554,   550,     0,
+     862,   668,     0,     0,   860,   861,     0,   621,   625,     0,
+     621,   621,     0,   916,     0,   587,   797,     0,   943,   894,
+       0,     0,   885,     0,     0,     0,   759,     0,     0,   890,
+     792,   791,   819,     0,   248,     0,   741,   602,   694,     0,
+     605,     0,   595,   836,   770,   784,     0,     0,     0,   461,
+     142,   204,   206,     0,     0,   141,     0,   137,     0,   158,
+       0,     0,   146,    67,     0,     0,     0,     0,    80,    69,
+       0,    84,     0,    77,   582,     0,    98,    90,    99,    91,
+     129,   123,   124,   122,   118,     0,   125,   127,   220,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   222,    34,
+      38,     0,     0,     0,     0,    41,    40,    35,    33,    47,
+       0,     0,   205,     0,   181,   188,   191,   189,     0,    26,
+       0,   467,   851,   410,     0,   460,     0,   465,   464,   466,
+       0,   246,   912,   492,   489,   352,   349,   528,   538,   539,
+       0,   254,     0,   443,     0,   567,   568,   569,   529,   626,
+     681,     0,     0,     0,     0,     0,   681,   330,   283,     0,
+     341,   339,   340,   333,   334,   335,   336,   337,   338,   342,
+     286,     0,   278,     0,     0,     0,   301,     0,   729,     0,
+       0,     0,     0,     0,     0,     0,     0,   259,     0,     0,
+     709,   703,   704,   705,   706,   707,   708,     0,   702,   838,
+       0,     0,   320,   551,   614,   535,     0,   620,   622,     0,
+     623,   624,     0,     0,     0,   828,     0,     0,     0,     0,
+       0,   878,   592,     0,   815,   740,   742,   739,   379,     0,
+       0,   486,   607,     0,     0,     0,   741,   724,    52,   158,
+     382,     0,     0,   154,     0,   213,   213,     0,     0,   139,
+       0,     0,   148,   151,   401,   161,     0,     0,     0,   159,
+     170,     0,    74,     0,   114,     0,     0,     0,    73,     0,
+     688,   688,     0,     0,   117,   120,   224,   887,   325,   326,
+     360,   359,   361,  1158,  1162,  1041,     0,  1070,   627,   628,
+     225,   229,   231,   237,   232,   233,   234,     0,   230,   888,
+     228,    56,     0,    57,    54,    50,     0,     0,     0,     0,
+       0,    45,    42,    37,    36,    43,    46,     0,     0,     0,
+     666,   479,     0,     0,   476,   478,   471,   848,   413,     0,
+     467,   859,     0,     0,   473,   563,   444,   566,   679,   680,
+       0,     0,     0,   358,   355,   328,     0,     0,   312,   284,
+     288,     0,   280,   311,   309,   310,   304,   305,   306,   307,
+     308,   302,   303,   323,   609,   552,   553,   863,   615,     0,
+       0,   584,   586,     0,     0,     0,     0,   841,   709,     0,
+       0,     0,   883,   884,     0,   636,     0,   249,   603,   606,
+       0,   596,   144,   380,     0,   401,     0,     0,     0,   216,
+     582,   216,     0,     0,   140,   401,     0,   407,   163,   162,
+     160,   164,   165,    70,   169,    71,    72,    75,   129,    83,
+      76,   132,   128,     0,    79,     0,     0,     0,     0,     0,
+       0,   221,     0,    39,     0,     0,   475,     0,     0,   474,
+       0,   246,     0,     0,     0,   471,     0,   468,     0,   245,
+     472,   134,   356,   826,   825,   354,   345,   313,   617,     0,
+       0,   616,     0,   843,   844,   829,   830,   840,   944,   879,
+     880,   882,   793,     0,   247,     0,     0,     0,     0,     0,
+     431,     0,     0,   394,     0,     0,   401,   381,   384,   385,
+     213,   407,   155,  1162,   156,   212,     0,   674,   214,   674,
+       0,     0,   407,     0,   400,     0,   158,   117,   116,     0,
+       0,     0,   227,    58,     0,   913,     0,   207,   914,   467,
+     460,   382,   477,   473,   857,   853,   856,   852,   854,   855,
+     850,   849,     0,   246,   469,   470,    27,   133,     0,   619,
+       0,   842,   795,     0,     0,   741,     0,   386,     0,   398,
+     433,   434,   432,   393,   401,   411,   407,   216,   153,     0,
+     215,   219,   219,   550,   411,   158,   405,     0,   403,     0,
+     145,    78,   238,     0,   235,     0,   222,     0,   471,   467,
+     480,   134,   459,   473,     0,     0,   794,     0,   597,     0,
+       0,   383,   407,   418,   395,   674,     0,   158,     0,   217,
+     218,   209,   210,   418,   147,   402,     0,     0,   236,   915,
+     246,   208,   246,   471,   449,   134,   827,   618,     0,   409,
+     396,     0,   423,   219,     0,   149,   157,   423,   404,   406,
+     917,   473,   246,   447,   741,     0,   397,   415,   416,   417,
+       0,   399,   419,   420,   211,     0,   158,   196,   134,   473,
+     598,   408,     0,     0,     0,   421,     0,   422,   152,   150,
+     450,   134,   428,     0,   427,     0,   425,   424,   448,   426,
+     430,   429
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+   -1800, -1800, -1800,  1445, -1800, -1800, -1800, -1800, -1800, -1800,
+   -1172, -1800, -1800, -1800, -1800,  -272,   839, -1800,  -162,   561,
+   -1800,   262,   -39,   539, -1800,   -69, -1800, -1606, -1091, -1299,
+     104, -1800,  -375, -1800,  -526,   578,   573, -1800, -1800,   -41,
+   -1440, -1800,   -63,  -512, -1800, -1800, -1800, -1800,   817,   191,
+   -1800, -1800, -1800, -1800, -1800,   297,   246, -1800, -1800, -1724,
+   -1581, -1694, -1799,  -551,  -217, -1800,   271,   -66, -1800, -1800,
+   -1800, -1800, -1348,   157,  -613, -1072, -1800,  1934, -1800,  -553,
+   -1800,  -912,   799, -1800,  1160,  -576, -1800,  -359,   278,  -638,
+    1269,  -686,  -154, -1800,  -331,  -549, -1469,  -179, -1689, -1800,
+   -1800,  -231, -1090, -1800,  -591, -1157,   252,  -226,  -249,  -264,
+    -262,  -271, -1800, -1800,  -478,  -630, -1800, -1800,  1451,  -137,
+   -1800,  1495, -1489, -1670, -1467,   -48, -1800,   -55, -1800,   957,
+   -1800,  1481,   108, -1800, -1800, -1800,   495, -1800,   -47, -1800,
+    1216, -1800, -1800,  -430,  -101, -1800, -1800,   484,  -612, -1800,
+   -1800, -1444,  -869, -1800, -1800,  1036,  -492,  -300,   118, -1800,
+   -1412, -1800, -1534,   158,  -640, -1800,   680, -1800,  -392, -1800,
+   -1800, -1800, -1800,    -7, -1414,   -50,  -133,  -625,  -312,    76,
+    -767,  1496, -1750,  1442,   245, -1800,  -570, -1800, -1800,  -816,
+   -1121, -1800, -1800,  -982,  -364, -1800, -1800,   -38,    58,  2503,
+      12, -1800, -1800, -1151,   377,   996,     3,     5,     0,     4,
+   -1800,   672,  -211,   950, -1800,  1302, -1800, -1800, -1800,  -196,
+     952,  1303,  1307, -1800,   654, -1681, -1800, -1800,   434, -1800,
+    -813, -1800, -1415, -1800, -1800,     9,   662, -1800,   -14,  -306,
+   -1800,    46,    43,   299, -1800, -1800,   -16, -1800, -1085,  1151,
+    1569,  -325,  -258, -1800, -1800, -1800,  -653, -1454,   120, -1800,
+    1359,   706,   733, -1800, -1800, -1800, -1800,  -829,    37, -1800,
+     832,  1554, -1800,    24, -1452,   306,  1670
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    23,    24,    25,    26,   590,  1539,    27,   940,  1278,
+    1519,  1279,    28,    29,    30,   563,   564,  1487,  1844,   565,
+    1234,  1235,  1236,  1237,  1506,  1694,  1217,   566,  1956,   567,
+    1475,  1247,  1199,  1476,  1300,   894,  1203,  2017,  1662,  1663,
+    1482,  1679,  1520,   896,  1489,    31,   958,   959,   960,   584,
+    1284,    32,    70,   586,   941,   942,  1196,  1471,  1936,  1664,
+    1819,  1917,  2021,   921,  1728,  1240,  1241,  1710,  1711,  1712,
+    1113,   683,  1754,  1163,   684,  1025,    93,   991,   451,   832,
+    1067,  1078,   989,   452,   629,   630,  1068,   453,   454,   833,
+     311,  1302,  1813,  1907,   379,   380,   601,  1908,  1827,  1924,
+    1987,  1988,  1926,  2056,   965,  1303,  1304,  2042,  2061,  2062,
+    2063,  2086,  1909,   455,   456,   457,   458,    33,    71,  1750,
+    1660,   312,  1311,  1551,  1871,  1541,  1743,  1744,  1745,   511,
+     512,   308,    94,   713,    35,    86,   976,    36,    95,   383,
+     384,   385,   614,  1035,  1036,   698,  1134,   995,   996,  1005,
+    1006,   459,   460,  1435,  1635,   461,   502,   503,    96,  1169,
+    1170,  1171,  1459,  1460,  1126,   935,  1135,  1881,  1628,  1432,
+     462,   685,   843,   515,   516,   363,   616,   463,   716,  1305,
+    1425,   526,  1175,   717,  1760,   280,   605,   476,   522,   626,
+    1127,   517,   726,   653,   635,   388,    38,  1183,   304,   464,
+    1136,   497,   306,  1449,  1645,   465,    39,    97,   466,   315,
+     844,   845,   877,   878,   533,   534,   535,   876,  1186,   871,
+     872,   537,   538,   867,   870,  1452,  1893,  1805,   290,   291,
+     846,  1154,   619,   847,  1072,    43,   857,   858,  1419,   325,
+    1886,  1796,  1797,  1306,  1307,  1747,  1950,  1308,  1138,   467,
+    1646,   340,   341,    44,  1442,  1641,  1469,   469,    98,    46,
+     718,   719,   292,    47,    48,    49,    50,  1141,   316,    52,
+      58,   342,   709,   270,   835,   470,   271
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      41,   967,   362,   504,    42,    40,   912,   706,   917,    41,
+    1073,   839,   839,    42,   313,  1157,   580,   893,  1384,   659,
+    1462,   541,   314,  1438,   969,   324,  1155,  1075,  1153,  1666,
+     487,   305,  1012,  1070,  1219,   900,  1024,    51,  1071,  1672,
+     909,  1650,   386,   594,   382,  1481,    51,   971,  1422,  1656,
+     636,   328,  1746,   990,   327,   974,  1717,   928,  1718,  -716,
+     329,   570,  -887,   574,  -691,   400,   333,   647,   648,   343,
+    -718,  -582,   663,   617,  -654,   343,  1861,   343,  -747,   602,
+    1166,  1132,  -888,  1355,   723,  1821,  1165,   343,    60,   364,
+    1359,    41,   314,   336,  -750,    42,   703,   608,   343,   608,
+    1818,  1527,   400,  1529,   400,  1261,  1731,  2072,    34,  1349,
+    1801,   331,   663,   335,   532,   696,   364,   884,    37,  1830,
+      45,  1810,  1484,  1892,  1533,   895,  1911,  1919,    51,   536,
+    1937,  1944,   895,   904,   984,   651,  1922,  -193,   963,  1245,
+    1087,  1167,  -193,  2057,   343,  1739,   988,  1614,  1870,   662,
+     475,   479,   663,   322,   688,  1173,  1149,   337,   278,   839,
+    1359,  2090,   580,   577,  1357,  1358,   922,  1981,  1373,  1982,
+     602,   343,   869,   707,   666,  1379,   663,  1945,   524,   704,
+     887,   663,   595,  2022,   319,  1069,  1201,   530,    56,   482,
+     888,   338,  1201,  1946,  1140,  1953,   839,    87,   711,  1193,
+    -839,   992,   901,  1972,   997,  1828,  1204,  1510,   596,   699,
+    1947,  1009,  1010,  1862,  1970,   299,  1220,  1976,  1174,  1812,
+      57,  1511,  1222,   712,  1156,  1202,   531,  1124,   339,  1639,
+     279,  1478,   923,   320,   478,  1806,   557,  2058,  -839,  1863,
+    1088,   421,  1829,   902,  2064,  1547,   724,   321,  1847,   300,
+     525,  1971,  1846,   705,   936,  1948,  1485,  1221,    89,    90,
+     343,  1865,  2091,  1223,  1561,  2043,  1089,   603,   970,    56,
+     344,  1836,   307,  2031,   667,   578,  1238,  -839,  1242,  2059,
+     964,  1486,  2006,  2015,   322,  2012,   890,  1740,   268,  1325,
+     277,   668,   268,   268,   298,   662,  1246,   303,   663,   310,
+     669,    57,   313,  1973,    13,  1651,   322,  1079,   364,   272,
+    -747,  -747,   496,   540,  2073,   668,   328,  1668,    41,   327,
+     666,  1671,    42,    40,   597,   329,  -750,  -750,  2032,  1977,
+     881,   303,   303,   303,   697,   478,  1456,  1870,  1625,  1831,
+    1262,   620,   671,  1350,  1629,   882,   579,   905,   906,   701,
+     986,  1733,  1734,  1525,   927,    51,   725,    20,   603,   499,
+    1802,  1512,   891,  2052,   378,  -716,    21,  1571,  1572,  1424,
+    1640,   365,  1666,   323,   916,   322,   604,  1930,  2082,   687,
+     598,  1949,   501,    53,   612,  1730,   393,   317,    41,   907,
+     652,  1168,    42,  -887,  1717,   682,  1718,  1870,   365,   318,
+    1315,   634,  -582,  -691,  1118,   640,   690,   501,   693,   364,
+    1666,   990,  1371,  -888,  1296,  -747,   638,  -747,  1143,  1316,
+     667,   612,   613,   612,   613,    51,    34,   588,   591,   592,
+    2007,  -750,   478,  -750,   681,   682,    37,   668,    45,  1418,
+     478,   478,  1325,  1359,   583,  1870,   669,   321,  1578,   660,
+    1998,  1580,  1581,  1582,  1583,  1584,  1585,  1586,  1587,  1588,
+    1589,  -193,  -193,  1870,   326,   673,   674,   675,   938,   676,
+     677,   678,   679,   680,   681,   682,  2001,  1024,  1338,  1368,
+    1369,  1370,  1371,  1965,   322,  1287,  1990,    13,   671,  1783,
+      56,  1359,   350,   676,   677,   678,   679,   680,   681,   682,
+     678,   679,   680,   681,   682,  1811,   364,   313,  1983,   489,
+    2033,  1325,  1523,  1943,   364,   364,  1415,  1416,  1793,  1195,
+     372,    54,    57,  1207,   834,   336,   328,  2083,   328,   855,
+    1167,   859,   895,    19,   853,   329,  2035,   329,  1866,   367,
+      20,  1788,   899,    91,  1867,  2024,  2005,  1790,  1249,    21,
+     939,  1680,   396,  1666,    55,  -251,   727,   386,  -205,   977,
+     268,  -251,  1070,   336,   268,   500,  2084,  1071,   501,  1850,
+    1794,  1795,  1957,   323,    92,  1500,   373,  2045,   303,   303,
+     926,   854,  1361,   507,  2068,   374,  1611,   310,  2085,   337,
+     365,   310,   375,  1238,  1238,  1238,  1339,  1288,  1070,  1289,
+     883,  1342,  2081,  1071,  1667,  2003,    41,   376,  1111,   908,
+      42,  1190, -1156, -1156,  1112,   676,   677,   678,   679,   680,
+     681,   682,  1524,   338,   834,  1612,  2079,   337,   387,   929,
+   -1156,   364,  1644,   399,  1675,  1282,  1359,  1314,  1285,  1491,
+    1286,  1493,  1652,    51,    13,   944,   389,   303,   303,   303,
+    1681,  1374,   378,  1896,  1253,  1266,   390,  1258,   931,  -242,
+     339,   338,  1868,   984,   932,  -242,  1931,  1082,   490,   933,
+     622,  1070,   972,   625,  1518,   980,  1071,  1888,  1683,   343,
+     400,  1769,  2050,  1267,  2051,   636,  1676,  1564,  1684,   834,
+    1899,   365,   934,    13,   647,   648,  1137,    20,   339,   918,
+     662,  1993,  1957,   663,  2069,  1124,  1577,   972,  1268,  1440,
+    1070,   834,   491,  1441,  1069,  1071,   474,  1079,  1079,   391,
+     484,  1079,   919,  1024,   920,   666,   392,   860,  1079,  1070,
+    1758,    22,  1677,   395,  1071,  1759,  1957,  1148,  1516,  1678,
+    1513,  1535,   486,   269,  1553,  1914,    20,   916,   297,   662,
+    1069,  1083,   663,  1084,    13,    21,   368,   346,  1548,   347,
+    1366,  1367,  1368,  1369,  1370,  1371,   861,  1167,  1269,  1957,
+    1613,  1615,  1616,  1929,   666,  1361,   303,  1685,   606,   918,
+    1655,   607,  1957,   392,   840,  1270,   842,   485,   365,  2010,
+    1271,  1903,   310,  -838,   492,   369,   365,   365,  1378,   488,
+     303,   303,   919,   493,   920,   370,   836,    20,  1366,  1367,
+    1368,  1369,  1370,  1371,  2008,   687,    21,   998,   501,   343,
+     303,  1978,  1904,  1069,   505,   667,  1362,   916,   863,   303,
+     508,  -838,  1985,   378,   399,    59,    61,  1359,   371,   514,
+      88,    22,   668,   273,  1160,   518,   303,  1905,  1360,   303,
+    1230, -1156,   494,  1686,    41,  1876,   519,  1716,    42,  1172,
+    1687,  -887,  1069,  -371,   943,   303,  -371,  1238,   527,   864,
+    -838,  1242,  1272,  1720,   667,  1447,  1448,   378,  1120,  1194,
+    1070,  1069,   378,  1692,  1436,  1071,  2014,   542,   529,  1273,
+    1206,   668,  1209,   671,  1212,  1215,   999,  1713,  1906,  1224,
+    1227,   848,   983,  2070,   849,    62,   836,  2018,  1239,  1181,
+    2034,  1243,  1182,   365,   521,  1568,  1274,  1250,  1494,   523,
+    1254,  1255,  2040,  1259,  1260,  1121,   530,  1026,   916,  1341,
+      13,  1343,  1344,  1184,  1682,  1688,  1321,   364,   834,  1322,
+     834,    63,   671,  1000,  2053,   568,  1324,  1667,  1275,  1325,
+    1594,  1276,   571,  1366,  1367,  1368,  1369,  1370,  1371,  1277,
+    1326,   575,    41,  1322,  1122,   531,    42,  1295,  1123,  1229,
+    1330,   836,  1534,  1322,   303,  1331,  1361,  2080,  1322,  1536,
+    1537,  1333,  1001,    20,  1325,  1667,  1002,  1969,  1444,    13,
+    2088,  1445,    21,   836,  1794,  1795,   834,  1265,   860,  2019,
+    2020,  1079,   839,   303,  1079,  1079,  1079,  1079,  1079,  1079,
+    1079,  1079,  1079,  1079,  1741,   576,  1504,  1964,   918,  1505,
+     676,   677,   678,   679,   680,   681,   682,  1362,   884,   581,
+     885,  1508,  1069,   583,  1509,    19,  1838,   861,  1630,  1631,
+     886,   919,    20,   920,  1124,  1543,  1590,  1653,  1544,  1322,
+    1654,    21,  1352,   585, -1153,    66,   345,    67,  1669,  1070,
+     587,  1670,  1003,  1426,  1071,  1674,   916,   862,  1544,   676,
+     677,   678,   679,   680,   681,   682,    22,  1118,   599,    69,
+     501,   660,   600,   381,  1738,  1377,  1770,  1544,  1381,  1322,
+    1807,   887,  1386,   851,  1388,   478,  1390,   621,  1392,   863,
+    1393,   888,  1395,   348,  1397,   349,  1399,   623,  1401,  1620,
+    1621,   580,  1125,  1404,  1406,  1815,  1427,  -649,  1816,   842,
+    1839,  1840,  1823,  1825,  1841,  1544,  1544,  1325,  1667,   310,
+    1004,  1164,  1859,  1421,  1894,  1860,  1428,   851,  1895,  -651,
+     864,  1654,   834,  1934,  1842,  1429,  1544,  1291,  1292,  1430,
+    1363,  1364,  1365,   303,  1366,  1367,  1368,  1369,  1370,  1371,
+     984,    41,  -653,  1192,   310,    42,  1453,  -661,   314,   364,
+    1192,  1309,   889,  1310,  1205,   310,  1851,   310,  1211,   310,
+     310,  1218,  -441,  1962,   310,   310,  1963,  1228,   631,   303,
+    1856,  1879,  1501,   310,  1503,  1716,   310,   890,  1714,   632,
+    1248,   633,   310,  1791,  1024,   310,   310,    22,   310,   310,
+    1920,  1069,   637,  1496,  1497,  1498,  1499,   303,  1070,   365,
+     836,  2067,   836,  1071,  -745,  1996,  -647,  2002,  1997,  1431,
+    1466,   639,  1024,  2025,  1079,  1713,  2026,  2037,   641,  -646,
+     851,   378,  1301,  1426,  1312,  2038,   378,   642,  1654,   643,
+    -650,  1426,   644,   646,   649,   834,   834,   834,  -652,  -648,
+     654,   655,  -745,   689,   702,   714,   722,   851,   394,  1915,
+    1918,  -745,  1918,   891,   852,   873,   875,   472,   836,   477,
+     480,   481,   531,   529,   399,  1986,   530,  1359,   895,   897,
+    1880,   364,   898,   903,   910,   913,  1427,   364,  1593,   364,
+     399,  -745,   911,  1359,  1427,   914,   915,   916,  -745,   924,
+     930,   961,   925,    41,   962,   892,  1428,    42,  1552,   966,
+     662,   968,  1517,   663,  1428,  1429,   972,   973,   839,  1430,
+     975,   400,   663,  1429,  1741,  1028,  1110,  1430,  1532,  1081,
+    1038,  1090,  1140,  1142,  1145,   666,  1146,  1147,  1967,  1150,
+    1161,  1158,  1538,  1176,  1178,  1177,  1542,  1180,  1179,  1191,
+     399,  1185,  1195,  1359,  1197,  1820,  1024,  1980,  1026,  1198,
+    1069,  1789,  1200,  1244,  1263,  1264,   660,  1280,  1281,  1283,
+     660,   480,  1596,  1290,  2013,   660,  1294,   660,  1986,   660,
+    1313,   660,  1320,  2023,   660,  1328,   660,  -745,   660,  1323,
+     660,  1619,  1619,   660,  1327,   660,  1336,  1329,  1079,  1431,
+    1332,   303,  1335,  1337,  1164,  1164,  1346,  1431,  1322,  1348,
+     634,   615,   640,  1137,   836,  1351,  1361,  1375,  1918,  1137,
+    1352,  1353,  1354,   652,   842,  1402,  1410,  1434,  1356,  1376,
+    1454,   518,  1361,  1380,  1385,   667,  1458,  1461,  1409,  1387,
+    1411,   365,   691,  1389,   692,  1391,   694,  1394,  1396,  1398,
+    1658,    41,   668,  1400,  1412,    42,  1172,  1403,  1405,  1413,
+    1414,   669,  1417,  1472,  1455,  1464,  1477,  1362,   480,  1423,
+    1312,   708,   710,  1690,  1457,  1466,   480,   480,  1467,  1473,
+    1474,  1480,  1490,  1362,  1492,  1514,  1483,   670,   310,   310,
+     310,   310,  1361,  1495,  1515,  1721,  1722,  1723,  1724,  1725,
+    1522,  1521,  1531,   671,  1530,  1545,  1546,  1550,  1549,  1540,
+      62,   615,  1556,  1563,  1657,  1562,   615,   615,  1565,   834,
+    1579,  -198,  1566,   834,  1567,   834,  1714,   836,   836,   836,
+    1079,  1595,   303,  1124,  1598,  1618,  1623,   364,   364,   662,
+    1626,  1624,   663,  1362,  1627,  1632,    63,  1633,   303,  1312,
+    1634,  1689,  1636,  1648,  1637,  1638,  1643,  1649,   378,  1693,
+    1727,  1726,   303,   365,   666,  1749,   303,   937,  1729,   365,
+    1752,   365,  1756,  1757,  1753,  1761,  1762,  1763,  1764,  1767,
+    1359,  1799,  1765,  1784,  1785,   660,  1803,  1786,  1804,    64,
+    1363,  1364,  1365,  1800,  1366,  1367,  1368,  1369,  1370,  1371,
+     697,  1817,  1818,  1822,  1026,  1826,  1363,  1364,  1365,   982,
+    1366,  1367,  1368,  1369,  1370,  1371,  1137,    72,    73,  1832,
+    1833,  1835,  1137,    65,  1843,  1007,   673,   674,   675, -1092,
+     676,   677,   678,   679,   680,   681,   682,  1597,   979,   981,
+    1848, -1093, -1101,    41, -1155,   314,  1845,    42,  1808,  1849,
+    1852,  1854,  1855,  1864,   549,  1858,  1853,  1872,   993,  1873,
+      66,  1874,    67,  1875,   667,    74,  1008, -1156, -1156,  1011,
+    1366,  1367,  1368,  1369,  1370,  1371,    75,    76,  1027,   662,
+      68,   668,   663,  1882,    69,    77,  1793,  1889,  1890,  1164,
+   -1156,   303,  1144,   664,  1891,  1921,  1923,   303,    78,  1925,
+    1941,  1940,  1954,  1955,   666,  1974,  1958,   561,  1989,  1960,
+    1994,  1966,  1995,   842,  1979,  2016,  1119,  1992,  2028,  2027,
+    2036,  1973,  2041,   310,  2046,   366,   662,  2044,    79,   663,
+    2055,  2060,   671,  2071,   303,   310,  1869,  1896,  2074,  2076,
+     664,  1665,  1312,   364,  2072,  2073,  1312,  1897,   943,  1898,
+    2089,   666,   366,   520,  1251,  1991,  1488,  1695,   310,  1927,
+    1691,  1502,  1470,  1479,  1824,  1912,  1293,  1673,  1737,  2030,
+    1696,  1787,  1932,   850,  1899,  1900,  1318,  2000,   987,  2011,
+     310,   310,   310,   310,   310,  2048,  1748,  2047,  2066,  2077,
+    2075,   582,  2087,  1999,   513,  1942,  1159,   539,  1939,  1558,
+    1554,   836,  1809,  1420,   667,   836,  1857,   836,  1742,   528,
+      80,  1766,  1312,   978,  1192,  1647,  1952,   618,  1446,   365,
+     365,   668,  1188,  1187,  1465,   874,    81,  1901,  1463,  1885,
+     669,   880,  1933,  1887,   879,  1751,    82,  1951,  1139,   468,
+     721,  1439,    41,   495,     0,    41,    42,  1935,     0,    42,
+    1938,   667,    83,    84,     0,     0,   670,     0,     0,   676,
+     677,   678,   679,   680,   681,   682,     0,     0,   668,    85,
+       0,     0,   671,  1902,   672,  1903,     0,   669,     0,     0,
+       0,  1968,     0,     0,     0,    41,     0,     0,     0,    42,
+    1172,     1,  1164,     0,   303,     2,     0,     0,     0,     0,
+     303,     0,     0,   670,     3,     0,  1904,     0,     0,     0,
+       0,     0,  1184,     0,     0,     0,     0,   310,     0,   671,
+       0,   672,  1458,  1458,     4,     0,     0,     0,     0,     0,
+       0,  1905,     0,     0,     0,     0,     0,   834,  1477,     0,
+     471,     5,     0,     0,   366,     0,     0,     0,     0,     0,
+       0,     0,     0,  1975,   314,  1837,     0,     0,     0,     0,
+    -722,   378,     0,     0,     0,     0,     6,   471,     0,  1984,
+       0,     0,     7,   615,     0,     0,   615,     8,   615,     0,
+       0,     9,  1906,     0,     0,    41,     0,     0,     0,    42,
+    2029,     0,     0,     0,  1312,   673,   674,   675,     0,   676,
+     677,   678,   679,   680,   681,   682,     0,   378,  1192,  -722,
+    2049,     0,     0,  1151,  1152,     0,     0,     0,     0,     0,
+       0,   310,     0,     0,     0,   365,     0,     0,    41,     0,
+       0,     0,    42,  2054,     0,     0,     0,     0,     0,     0,
+     834,     0,   673,   674,   675,   366,   676,   677,   678,   679,
+     680,   681,   682,     0,     0,     0,     0,     0,     0,     0,
+    1642,     0,     0,     0,     0,     0,   471,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   662,     0,     0,   663,
+       0,     0,     0,     0,  1665,  1026,   378,   378,   471,   378,
+     664,     0,     0,     0,   471,     0,     0,     0,     0,     0,
+      10,   666,     0,     0,     0,     0,   471,   471,     0,   471,
+      11,     0,   662,  1026,     0,   663,     0,   310,    12,     0,
+       0,    13,  1665,     0,   471,    14,   664,    15,  1742,     0,
+       0,   480,   303,     0,    16,     0,     0,   666,     0,    17,
+       0,     0,   366,     0,     0,     0,     0,     0,     0,     0,
+     366,   366,     0,     0,     0,     0,     0,    18,     0,     0,
+     837,   471,     0,     0,     0,   378,   310,    19,     0,  1437,
+       0,   615,     0,   303,    20,     0,     0,     0,     0,     0,
+       0,     0,     0,    21,   378,     0,     0,   471,     0,   303,
+     471,   471,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   667,     0,     0,   450,     0,     0,     0,    22,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   668,   836,
+       0,     0,     0,  1507,     0,     0,     0,   669,   310,     0,
+       0,   510,  1458,     0,     0,     0,     0,   667,     0,     0,
+       0,     0,     0,     0,     0,   378,     0,  1026,     0,     0,
+       0,     0,     0,   670,   668,     0,     0,     0,  1526,     0,
+     837,     0,     0,   669,     0,  1665,     0,   366,     0,   671,
+       0,   672,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   471,     0,   670,
+       0,   471,     0,   471,   471,   310,     0,     0,     0,     0,
+    1528,   471,   471,     0,   471,   671,   471,   672,     0,     0,
+     615,     0,     0,     0,   471,   471,     0,   615,   615,     0,
+       0,     0,   836,     0,   471,   837,   471,     0,     0,   471,
+     628,     0,   471,   471,   471,   471,   471,   471,   471,   471,
+     471,   471,   662,     0,     0,   663,   471,   837,     0,     0,
+       0,     0,   645,   471,     0,     0,   664,   471,   650,     0,
+       0,   662,     0,     0,   663,     0,     0,   666,     0,     0,
+     656,   657,     0,   658,  1570,   664,     0,     0,  1573,  1574,
+    1575,     0,  1576,     0,     0,     0,   666,     0,   695,     0,
+       0,     0,   673,   674,   675,  1610,   676,   677,   678,   679,
+     680,   681,   682,     0,  1622,     0,     0,     0,  1334,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   838,     0,     0,   673,   674,
+     675,     0,   676,   677,   678,   679,   680,   681,   682,  1617,
+       0,  1037,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   856,     0,     0,   866,   868,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   667,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   668,     0,   667,     0,     0,     0,
+       0,     0,     0,   669,     0,     0,  1715,     0,     0,     0,
+       0,     0,     0,   668,     0,     0,     0,     0,  1732,   471,
+       0,     0,   669,     0,     0,     0,  1735,  1736,     0,   670,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   671,   615,   672,   670,     0,
+       0,     0,     0,     0,     0,     0,     0,   615,     0,     0,
+     661,   985,     0,     0,   671,   662,   672,   994,   663,     0,
+       0,     0,     0,   471,     0,     0,     0,     0,   994,   664,
+    1013,     0,   665,   366,   837,     0,   837,     0,  1029,  1034,
+     666,     0,     0,     0,     0,     0,     0,     0,  1074,     0,
+       0,     0,     0,  1086,     0,     0,  1091,  1093,  1095,  1097,
+    1099,  1101,  1103,  1105,  1107,  1109,     0,     0,     0,     0,
+    1115,     0,     0,     0,     0,     0,     0,   994,     0,     0,
+       0,   450,  1798,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   837,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   471,     0,   471,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   673,   674,
+     675,   986,   676,   677,   678,   679,   680,   681,   682,     0,
+       0,  1569,     0,     0,     0,     0,     0,   673,   674,   675,
+     667,   676,   677,   678,   679,   680,   681,   682,     0,     0,
+     471,   471,   471,   471,   945,   946,     0,   668,   471,     0,
+       0,     0,     0,     0,     0,     0,   669,     0,     0,     0,
+     947,   948,   615,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   670,     0,   979,   981,   471,   471,     0,     0,
+     471,   471,     0,     0,     0,     0,     0,   471,   671,   471,
+     672,     0,     0,     0,     0,     0,   981,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   949,     0,     0,     0,
+       0,     0,   662,   510,     0,   663,     0,     0,   837,     0,
+       0,     0,     0,     0,     0,     0,   664,     0,   471,   471,
+       0,     0,     0,     0,     0,     0,     0,   666,     0,     0,
+     471,     0,     0,     0,     0,   366,   950,   951,   952,   953,
+       0,     0,   471,     0,     0,     0,     0,     0,   471,     0,
+       0,     0,     0,     0,   954,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1715,     0,   471,     0,     0,     0,
+     471,   955,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   471,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   956,     0,     0,     0,     0,     0,     0,     0,
+       0,   673,   674,   675,   615,   676,   677,   678,   679,   680,
+     681,   682,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   837,   837,   837,     0,     0,     0,   667,     0,   957,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     985,     0,  1319,     0,   668,     0,     0,     0,     0,     0,
+       0,     0,     0,   669,     0,     0,     0,   366,     0,     0,
+       0,     0,     0,   366,     0,   366,     0,     0,     0,     0,
+       0,     0,     0,   686,     0,     0,     0,     0,     0,   670,
+       0,     0,     0,     0,  1034,     0,  1034,  1034,     0,     0,
+       0,     0,  1347,     0,     0,   671,     0,   672,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   471,     0,     0,
+       0,     0,   471,     0,  2004,   471,     0,     0,   471,     0,
+       0,     0,     0,     0,   471,     0,     0,     0,     0,     0,
+       0,     0,     0,   686,     0,   471,     0,     0,     0,     0,
+       0,     0,     0,  1383,     0,     0,     0,     0,     0,     0,
+     471,     0,     0,   471,   471,   471,   471,   471,   471,   471,
+     471,   471,   471,     0,     0,     0,   471,     0,   471,     0,
+     471,     0,     0,     0,     0,   471,     0,   471,     0,   471,
+       0,   471,   994,   994,   471,     0,   471,     0,   471,     0,
+     471,     0,   471,   471,  1433,   471,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1443,   662,     0,     0,
+     663,     0,  1451,     0,     0,     0,     0,     0,   673,   674,
+     675,   664,   676,   677,   678,   679,   680,   681,   682,     0,
+     856,  1659,   666,     0,   868,     0,     0,   471,   471,     0,
+       0,     0,     0,     0,     0,  1468,     0,     0,     0,     0,
+       0,   686,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   471,     0,     0,     0,     0,   686,     0,
+       0,     0,     0,   686,     0,     0,     0,     0,     0,   686,
+     686,   686,     0,     0,     0,   471,     0,     0,     0,  1080,
+       0,     0,     0,     0,     0,   837,     0,     0,     0,   837,
+    1719,   837,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   366,   366,     0,     0,     0,   686,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   667,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   668,
+       0,     0,     0,     0,     0,     0,     0,     0,   669,     0,
+       0,   662,     0,     0,   663,     0,     0,     0,     0,     0,
+       0,  1555,     0,     0,     0,   664,  1557,     0,     0,   994,
+       0,     0,  1559,   471,   670,   471,   666,   471,  1560,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     671,     0,   672,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   471,   471,     0,     0,     0,     0,     0,
+    1591,     0,  1592,     0,     0,     0,     0,     0,     0,  1599,
+       0,  1600,     0,  1601,   662,  1602,     0,   663,  1603,     0,
+    1604,   471,  1605,     0,  1606,     0,  1607,  1608,   664,  1609,
+       0,   686,     0,     0,     0,     0,     0,     0,   662,   666,
+       0,   663,     0,   471,     0,     0,     0,     0,     0,   686,
+       0,     0,   664,     0,     0,     0,   667,     0,     0,   686,
+       0,   686,     0,   666,     0,     0,  1719,     0,     0,     0,
+       0,   450,   450,   668,     0,     0,     0,     0,     0,     0,
+       0,     0,   669,     0,     0,     0,     0,     0,     0,   366,
+       0,     0,     0,   673,   674,   675,     0,   676,   677,   678,
+     679,   680,   681,   682,     0,     0,  1755,     0,   670,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   994,
+       0,     0,     0,     0,   671,     0,   672,   471,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   667,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   471,
+       0,     0,     0,     0,   471,   471,   668,     0,     0,     0,
+       0,     0,     0,   667,   471,   669,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   471,     0,   686,     0,
+     668,     0,   471,     0,   686,     0,     0,   686,     0,   669,
+       0,   670,     0,     0,     0,     0,     0,     0,     0,   662,
+       0,     0,   663,   471,     0,     0,   686,   671,  1719,   672,
+       0,     0,     0,   664,   471,   670,     0,     0,     0,  1771,
+       0,  1772,   686,     0,   666,     0,     0,   686,     0,     0,
+       0,   671,     0,   672,     0,     0,     0,     0,     0,   471,
+       0,     0,   471,     0,     0,     0,     0,   673,   674,   675,
+       0,   676,   677,   678,   679,   680,   681,   682,  1792,   471,
+    1768,     0,     0,     0,     0,     0,     0,   686,     0,  1080,
+    1080,  1372,     0,  1080,     0,     0,     0,     0,     0,   686,
+    1080,     0,     0,   837,   686,  1814,   686,     0,   686,     0,
+     686,     0,   686,     0,   686,     0,   686,     0,   686,     0,
+     686,     0,   686,     0,     0,     0,     0,  1834,   686,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   471,   667,     0,   471,     0,     0,     0,
+     673,   674,   675,     0,   676,   677,   678,   679,   680,   681,
+     682,   668,     0,  1773,     0,     0,     0,     0,     0,     0,
+     669,     0,     0,     0,   673,   674,   675,   471,   676,   677,
+     678,   679,   680,   681,   682,     0,     0,  1774,     0,     0,
+       0,     0,     0,     0,     0,     0,   670,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   837,     0,     0,     0,
+       0,     0,   671,     0,   672,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   471,     0,     0,     0,     0,     0,
+       0,     0,     0,  1878,     0,     0,     0,     0,  1883,  1884,
+       0,     0,     0,     0,     0,     0,     0,     0,  1451,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   994,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1928,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   662,     0,
+       0,   663,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   664,  1959,     0,     0,  1961,     0,     0,     0,
+       0,     0,   686,   666,     0,   673,   674,   675,     0,   676,
+     677,   678,   679,   680,   681,   682,     0,   662,  1775,     0,
+     663,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     686,   664,     0,     0,     0,     0,     0,     0,     0,     0,
+    1372,  1372,   666,  1080,     0,     0,  1080,  1080,  1080,  1080,
+    1080,  1080,  1080,  1080,  1080,  1080,  1372,   662,     0,     0,
+     663,     0,  1372,     0,     0,     0,   686,     0,     0,     0,
+       0,   664,     0,     0,     0,     0,     0,  1451,     0,     0,
+    2009,     0,   666,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   667,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   686,     0,     0,     0,
+     668,     0,     0,     0,     0,     0,   686,     0,     0,   669,
+       0,     0,     0,     0,   686,     0,     0,     0,     0,     0,
+       0,     0,   667,     0,     0,     0,     0,     0,     0,     0,
+       0,   686,     0,     0,     0,   670,     0,     0,  2065,   668,
+       0,     0,     0,     0,     0,     0,     0,     0,   669,     0,
+       0,   671,     0,   672,     0,     0,     0,     0,     0,     0,
+       0,     0,   667,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   670,     0,     0,     0,     0,   668,
+       0,     0,     0,     0,     0,     0,     0,     0,   669,     0,
+     671,   662,   672,     0,   663,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   664,     0,     0,     0,     0,
+       0,     0,     0,     0,   670,     0,   666,     0,   686,     0,
+     686,     0,   686,   686,     0,     0,     0,     0,     0,     0,
+     671,     0,   672,     0,     0,     0,     0,     0,     0,     0,
+       0,  1372,     0,  1372,  1372,  1372,  1372,  1372,  1372,  1372,
+    1372,  1372,  1372,     0,   686,   686,  1080,     0,     0,     0,
+       0,     0,   686,   686,   686,   686,   686,   686,   686,   686,
+     686,   686,   686,     0,   673,   674,   675,     0,   676,   677,
+     678,   679,   680,   681,   682,   662,     0,  1776,   663,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   664,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     666,     0,     0,   673,   674,   675,   667,   676,   677,   678,
+     679,   680,   681,   682,     0,     0,  1777,     0,     0,     0,
+       0,     0,     0,   668,     0,     0,     0,     0,     0,     0,
+       0,     0,   669,  1039,  1040,  1041,  1042,  1043,  1044,     0,
+       0,     0,     0,   673,   674,   675,  1045,   676,   677,   678,
+     679,   680,   681,   682,     0,     0,  1778,     0,   670,     0,
+       0,     0,     0,     0,  1046,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   671,     0,   672,     0,     0,     0,
+    1047,     0,     0,  1048,  1049,     0,     0,     0,     0,     0,
+       0,     0,  1050,     0,     0,     0,     0,     0,     0,     0,
+     667,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   668,  1051,     0,
+    1080,     0,  1372,     0,   686,   686,   669,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1052,   686,     0,  1053,  1054,     0,
+       0,     0,   670,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1055,     0,     0,     0,   686,   671,     0,
+     672,     0,     0,     0,     0,     0,     0,     0,  1056,  1057,
+       0,     0,     0,     0,     0,     0,     0,   686,  1058,  1059,
+    1060,     0,     0,     0,     0,     0,     0,   673,   674,   675,
+       0,   676,   677,   678,   679,   680,   681,   682,     0,     0,
+    1779,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1061,     0,  1062,     0,     0,     0,     0,     0,     0,  1372,
+       0,   686,     0,     0,     0,     0,   686,   686,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1080,     0,     0,     0,     0,  1063,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1064,     0,
+       0,   686,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   673,   674,   675,     0,   676,   677,   678,   679,   680,
+     681,   682,  1065,  1066,  1780,     0,     0,     0,     0,     0,
+       0,     0,   686,     0,   686,     0,     0,     0,     0,     0,
+       0,     0,  1372,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   397,   398,   343,     0,     0,   399,   400,   401,
+       0,     0,     0,     0,     0,     0,     0,  1128,   101,   102,
+     103,     0,   104,     0,     0,     0,     0,   352,   105,   106,
+     107,   108,   686,   109,   402,   403,   404,   113,   405,     0,
+       0,   115,   116,   406,     0,   118,   119,   120,     0,     0,
+       0,   121,     0,   353,   122,   123,   124,     0,     0,   125,
+       0,   126,   127,   128,   129,   407,     0,   130,     0,   354,
+     408,     0,   409,   410,   131,   355,   132,   133,   134,   135,
+     411,   137,   412,   413,   414,     0,     0,     0,   686,  1129,
+       0,   140,   415,     0,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,     0,   151,   152,   153,   416,     0,   417,
+     155,   156,   157,   158,   159,   160,     0,     0,   418,     0,
+       0,     0,   356,   162,     0,   419,     0,     0,     0,     0,
+     163,     0,     0,     0,   164,     0,     0,   165,     0,   166,
+     167,   168,   357,   169,   420,     0,     0,   421,   422,     0,
+     172,   358,   173,     0,   423,   359,   424,   174,     0,   175,
+     425,     0,   176,   426,   178,     0,     0,   179,     0,     0,
+       0,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,   427,     0,     0,   428,     0,   429,   430,   431,   432,
+     192,   193,   194,     0,   195,     0,   196,     0,     0,     0,
+     433,     0,     0,     0,   360,   198,   199,   200,   201,     0,
+     202,   203,   434,   204,   435,   205,   206,   207,   208,   209,
+       0,   210,   436,     0,   212,   213,   214,   215,     0,   216,
+     217,   218,   219,     0,   220,   361,   221,   222,     0,   437,
+     438,     0,     0,   223,   224,   225,   226,   227,     0,   228,
+       0,   439,     0,   230,   231,     0,   232,   440,   234,   235,
+     236,   237,   238,   239,   240,   241,     0,   242,     0,     0,
+     441,   442,     0,   243,   244,   245,     0,   275,   443,     0,
+       0,   276,   444,   445,   249,     0,     0,   250,   251,   252,
+       0,   253,     0,     0,     0,     0,     0,   254,   255,   256,
+       0,     0,   257,     0,   258,   259,   260,   261,     0,     0,
+       0,   262,   263,   264,   265,   266,   267,     0,     0,     0,
+       0,    99,     0,     0,     0,     0,     0,   446,   447,  1130,
+       0,     0,     0,     0,     0,   449,  1131,   101,   102,   103,
+       0,   104,     0,  1162,     0,     0,     0,   105,   106,   107,
+     108,     0,   109,   110,   111,   112,   113,   114,     0,     0,
+     115,   116,   117,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,     0,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,     0,     0,   130,     0,     0,     0,
+       0,     0,     0,   131,     0,   132,   133,   134,   135,   136,
+     137,     0,   138,   139,     0,     0,     0,     0,     0,     0,
+     140,   141,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   154,     0,     0,   155,
+     156,   157,   158,   159,   160,     0,     0,   161,  -745,     0,
+       0,     0,   162,     0,     0,     0,     0,     0,     0,   163,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,     0,   169,   170,     0,     0,     0,   171,     0,   172,
+       0,   173,     0,     0,     0,     0,   174,     0,   175,     0,
+       0,   176,   177,   178,     0,  -745,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,     0,     0,     0,     0,     0,     0,   190,   191,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   197,
+       0,     0,  -745,     0,   198,   199,   200,   201,     0,   202,
+     203,     0,   204,     0,   205,   206,   207,   208,   209,     0,
+     210,   211,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,     0,   221,   222,     0,     0,     0,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+       0,     0,   230,   231,     0,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,     0,   242,     0,     0,     0,
+       0,     0,   243,   244,   245,     0,   275,   247,     0,     0,
+     276,     0,     0,   249,     0,     0,   250,   251,   252,     0,
+     253,  -745,     0,     0,     0,     0,   254,   255,   256,     0,
+       0,   257,     0,   258,   259,   260,   261,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,   397,   398,   343,     0,
+       0,   399,   400,   401,     0,     0,     0,     0,     0,     0,
+       0,     0,   101,   102,   103,   518,   104,     0,     0,     0,
+       0,   352,   105,   106,   107,   108,     0,   109,   402,   403,
+     404,   113,   405,  1030,     0,   115,   116,   406,     0,   118,
+     119,   120,     0,     0,     0,   121,     0,   353,   122,   123,
+     124,     0,     0,   125,     0,   126,   127,   128,   129,   407,
+       0,   130,     0,   354,   408,     0,   409,   410,   131,   355,
+     132,   133,   134,   135,   411,   137,   412,   413,   414,     0,
+       0,     0,     0,     0,     0,   140,   415,     0,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,     0,   151,   152,
+     153,   416,     0,   417,   155,   156,   157,   158,   159,   160,
+       0,     0,   418,     0,  1031,     0,   356,   162,     0,   419,
+       0,     0,     0,     0,   163,     0,     0,     0,   164,     0,
+       0,   165,     0,   166,   167,   168,   357,   169,   420,     0,
+       0,   421,   422,     0,   172,   358,   173,  1032,   423,   359,
+     424,   174,     0,   175,   425,     0,   176,   426,   178,     0,
+       0,   179,     0,     0,     0,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   427,     0,     0,   428,     0,
+     429,   430,   431,   432,   192,   193,   194,     0,   195,     0,
+     196,     0,     0,     0,   433,     0,     0,     0,   360,   198,
+     199,   200,   201,     0,   202,   203,   434,   204,   435,   205,
+     206,   207,   208,   209,     0,   210,   436,     0,   212,   213,
+     214,   215,     0,   216,   217,   218,   219,     0,   220,   361,
+     221,   222,     0,   437,   438,     0,     0,   223,   224,   225,
+     226,   227,     0,   228,     0,   439,     0,   230,   231,     0,
+     232,   440,   234,   235,   236,   237,   238,   239,   240,   241,
+       0,   242,     0,     0,   441,   442,     0,   243,   244,   245,
+       0,   275,   443,     0,  1033,   276,   444,   445,   249,     0,
+       0,   250,   251,   252,     0,   253,     0,     0,     0,     0,
+       0,   254,   255,   256,     0,     0,   257,     0,   258,   259,
+     260,   261,     0,     0,     0,   262,   263,   264,   265,   266,
+     267,     0,     0,     0,     0,     0,     0,     0,   397,   398,
+     343,   446,   447,   399,   400,   401,     0,     0,     0,   449,
+       0,     0,     0,     0,   101,   102,   103,     0,   104,     0,
+       0,     0,     0,   352,   105,   106,   107,   108,     0,   109,
+     402,   403,   404,   113,   405,     0,     0,   115,   116,   406,
+       0,   118,   119,   120,     0,     0,     0,   121,     0,   353,
+     122,   123,   124,     0,     0,   125,     0,   126,   127,   128,
+     129,   407,     0,   130,     0,   354,   408,     0,   409,   410,
+     131,   355,   132,   133,   134,   135,   411,   137,   412,   413,
+     414,     0,     0,     0,     0,     0,     0,   140,   415,     0,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,     0,
+     151,   152,   153,   416,     0,   417,   155,   156,   157,   158,
+     159,   160,     0,     0,   418,     0,     0,     0,   356,   162,
+       0,   419,     0,     0,     0,     0,   163,     0,     0,     0,
+     164,     0,     0,   165,     0,   166,   167,   168,   357,   169,
+     420,     0,     0,   421,   422,     0,   172,   358,   173,     0,
+     423,   359,   424,   174,     0,   175,   425,     0,   176,   426,
+     178,     0,     0,   179,     0,     0,     0,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,   427,     0,     0,
+     428,     0,   429,   430,   431,   432,   192,   193,   194,     0,
+     195,     0,   196,     0,     0,     0,   433,     0,     0,     0,
+     360,   198,   199,   200,   201,     0,   202,   203,   434,   204,
+     435,   205,   206,   207,   208,   209,     0,   210,   436,     0,
+     212,   213,   214,   215,     0,   216,   217,   218,   219,     0,
+     220,   361,   221,   222,     0,   437,   438,     0,     0,   223,
+     224,   225,   226,   227,    13,   228,     0,   439,     0,   230,
+     231,     0,   232,   440,   234,   235,   236,   237,   238,   239,
+     240,   241,     0,   242,     0,     0,   441,   442,     0,   243,
+     244,   245,     0,   275,   443,     0,     0,   276,   444,   445,
+     249,     0,     0,   250,   251,   252,     0,   253,     0,     0,
+       0,     0,     0,   254,   255,   256,     0,    20,   257,     0,
+     258,   259,   260,   261,     0,     0,    21,   262,   263,   264,
+     265,   266,   267,     0,     0,     0,     0,     0,     0,     0,
+     397,   398,   343,   446,   447,   399,   400,   401,     0,     0,
+       0,   449,     0,     0,     0,     0,   101,   102,   103,     0,
+     104,     0,     0,     0,     0,   352,   105,   106,   107,   108,
+       0,   109,   402,   403,   404,   113,   405,     0,     0,   115,
+     116,   406,     0,   118,   119,   120,     0,     0,     0,   121,
+       0,   353,   122,   123,   124,     0,     0,   125,     0,   126,
+     127,   128,   129,   407,     0,   130,     0,   354,   408,     0,
+     409,   410,   131,   355,   132,   133,   134,   135,   411,   137,
+     412,   413,   414,     0,     0,     0,     0,     0,     0,   140,
+     415,     0,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,     0,   151,   152,   153,   416,     0,   417,   155,   156,
+     157,   158,   159,   160,     0,     0,   418,     0,     0,     0,
+     356,   162,     0,   419,     0,     0,     0,     0,   163,     0,
+       0,     0,   164,     0,     0,   165,     0,   166,   167,   168,
+     357,   169,   420,     0,     0,   421,   422,     0,   172,   358,
+     173,     0,   423,   359,   424,   174,     0,   175,   425,     0,
+     176,   426,   178,     0,     0,   179,     0,     0,     0,   180,
+     181,   182,   183,   184,   185,   186,   187,   188,   189,   427,
+       0,     0,   428,     0,   429,   430,   431,   432,   192,   193,
+     194,     0,   195,     0,   196,     0,     0,     0,   433,     0,
+       0,     0,   360,   198,   199,   200,   201,     0,   202,   203,
+     434,   204,   435,   205,   206,   207,   208,   209,     0,   210,
+     436,     0,   212,   213,   214,   215,     0,   216,   217,   218,
+     219,     0,   220,   361,   221,   222,     0,   437,   438,     0,
+       0,   223,   224,   225,   226,   227,     0,   228,     0,   439,
+       0,   230,   231,     0,   232,   440,   234,   235,   236,   237,
+     238,   239,   240,   241,     0,   242,     0,     0,   441,   442,
+       0,   243,   244,   245,     0,   275,   443,     0,     0,   276,
+     444,   445,   249,     0,     0,   250,   251,   252,     0,   253,
+       0,     0,     0,     0,     0,   254,   255,   256,     0,     0,
+     257,     0,   258,   259,   260,   261,     0,     0,     0,   262,
+     263,   264,   265,   266,   267,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   446,   447,   448,     0,   397,
+     398,   343,     0,   449,   399,   400,   401,     0,     0,     0,
+       0,     0,     0,     0,     0,   101,   102,   103,     0,   104,
+       0,     0,     0,     0,   352,   105,   106,   107,   108,     0,
+     109,   402,   403,   404,   113,   405,     0,     0,   115,   116,
+     406,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+     353,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,   407,     0,   130,     0,   354,   408,     0,   409,
+     410,   131,   355,   132,   133,   134,   135,   411,   137,   412,
+     413,   414,   509,     0,     0,     0,     0,     0,   140,   415,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,   151,   152,   153,   416,     0,   417,   155,   156,   157,
+     158,   159,   160,     0,     0,   418,     0,     0,     0,   356,
+     162,     0,   419,     0,     0,     0,     0,   163,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,   357,
+     169,   420,     0,     0,   421,   422,     0,   172,   358,   173,
+       0,   423,   359,   424,   174,     0,   175,   425,     0,   176,
+     426,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   427,     0,
+       0,   428,     0,   429,   430,   431,   432,   192,   193,   194,
+       0,   195,     0,   196,     0,     0,     0,   433,     0,     0,
+       0,   360,   198,   199,   200,   201,     0,   202,   203,   434,
+     204,   435,   205,   206,   207,   208,   209,     0,   210,   436,
+       0,   212,   213,   214,   215,     0,   216,   217,   218,   219,
+       0,   220,   361,   221,   222,     0,   437,   438,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,   439,     0,
+     230,   231,     0,   232,   440,   234,   235,   236,   237,   238,
+     239,   240,   241,     0,   242,     0,     0,   441,   442,     0,
+     243,   244,   245,     0,   275,   443,     0,     0,   276,   444,
+     445,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,     0,   257,
+       0,   258,   259,   260,   261,     0,     0,     0,   262,   263,
+     264,   265,   266,   267,     0,     0,     0,     0,     0,     0,
+       0,   397,   398,   343,   446,   447,   399,   400,   401,     0,
+       0,     0,   449,     0,     0,     0,   865,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,   352,   105,   106,   107,
+     108,     0,   109,   402,   403,   404,   113,   405,     0,     0,
+     115,   116,   406,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,   353,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,   407,     0,   130,     0,   354,   408,
+       0,   409,   410,   131,   355,   132,   133,   134,   135,   411,
+     137,   412,   413,   414,     0,     0,     0,     0,     0,     0,
+     140,   415,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   416,     0,   417,   155,
+     156,   157,   158,   159,   160,     0,     0,   418,     0,     0,
+       0,   356,   162,     0,   419,     0,     0,     0,     0,   163,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,   357,   169,   420,     0,     0,   421,   422,     0,   172,
+     358,   173,     0,   423,   359,   424,   174,     0,   175,   425,
+       0,   176,   426,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     427,     0,     0,   428,     0,   429,   430,   431,   432,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   433,
+       0,     0,     0,   360,   198,   199,   200,   201,     0,   202,
+     203,   434,   204,   435,   205,   206,   207,   208,   209,     0,
+     210,   436,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,   361,   221,   222,     0,   437,   438,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+     439,     0,   230,   231,     0,   232,   440,   234,   235,   236,
+     237,   238,   239,   240,   241,     0,   242,     0,     0,   441,
+     442,     0,   243,   244,   245,     0,   275,   443,     0,     0,
+     276,   444,   445,   249,     0,     0,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+       0,   257,     0,   258,   259,   260,   261,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,     0,     0,     0,     0,
+       0,     0,     0,   397,   398,   343,   446,   447,   399,   400,
+     401,     0,     0,     0,   449,     0,     0,     0,     0,   101,
+     102,   103,     0,   104,     0,     0,     0,     0,   352,   105,
+     106,   107,   108,     0,   109,   402,   403,   404,   113,   405,
+       0,     0,   115,   116,   406,     0,   118,   119,   120,     0,
+       0,     0,   121,     0,   353,   122,   123,   124,     0,     0,
+     125,     0,   126,   127,   128,   129,   407,     0,   130,     0,
+     354,   408,     0,   409,   410,   131,   355,   132,   133,   134,
+     135,   411,   137,   412,   413,   414,     0,     0,     0,     0,
+       0,     0,   140,   415,     0,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,     0,   151,   152,   153,   416,     0,
+     417,   155,   156,   157,   158,   159,   160,     0,     0,   418,
+       0,  1031,     0,   356,   162,     0,   419,     0,     0,     0,
+       0,   163,     0,     0,     0,   164,     0,     0,   165,     0,
+     166,   167,   168,   357,   169,   420,     0,     0,   421,   422,
+       0,   172,   358,   173,     0,   423,   359,   424,   174,     0,
+     175,   425,     0,   176,   426,   178,     0,     0,   179,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   427,     0,     0,   428,     0,   429,   430,   431,
+     432,   192,   193,   194,     0,   195,     0,   196,     0,     0,
+       0,   433,     0,     0,     0,   360,   198,   199,   200,   201,
+       0,   202,   203,   434,   204,   435,   205,   206,   207,   208,
+     209,     0,   210,   436,     0,   212,   213,   214,   215,     0,
+     216,   217,   218,   219,     0,   220,   361,   221,   222,     0,
+     437,   438,     0,     0,   223,   224,   225,   226,   227,     0,
+     228,     0,   439,     0,   230,   231,     0,   232,   440,   234,
+     235,   236,   237,   238,   239,   240,   241,     0,   242,     0,
+       0,   441,   442,     0,   243,   244,   245,     0,   275,   443,
+       0,     0,   276,   444,   445,   249,     0,     0,   250,   251,
+     252,     0,   253,     0,     0,     0,     0,     0,   254,   255,
+     256,     0,     0,   257,     0,   258,   259,   260,   261,     0,
+       0,     0,   262,   263,   264,   265,   266,   267,     0,     0,
+       0,     0,     0,     0,     0,   397,   398,   343,   446,   447,
+     399,   400,   401,     0,     0,     0,   449,     0,     0,     0,
+       0,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+     352,   105,   106,   107,   108,     0,   109,   402,   403,   404,
+     113,   405,     0,     0,   115,   116,   406,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,   353,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,   407,     0,
+     130,     0,   354,   408,     0,   409,   410,   131,   355,   132,
+     133,   134,   135,   411,   137,   412,   413,   414,  1450,     0,
+       0,     0,     0,     0,   140,   415,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     416,     0,   417,   155,   156,   157,   158,   159,   160,     0,
+       0,   418,     0,     0,     0,   356,   162,     0,   419,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,   357,   169,   420,     0,     0,
+     421,   422,     0,   172,   358,   173,     0,   423,   359,   424,
+     174,     0,   175,   425,     0,   176,   426,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   427,     0,     0,   428,     0,   429,
+     430,   431,   432,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   433,     0,     0,     0,   360,   198,   199,
+     200,   201,     0,   202,   203,   434,   204,   435,   205,   206,
+     207,   208,   209,     0,   210,   436,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,   361,   221,
+     222,     0,   437,   438,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,   439,     0,   230,   231,     0,   232,
+     440,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,   441,   442,     0,   243,   244,   245,     0,
+     275,   443,     0,     0,   276,   444,   445,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,     0,
+     254,   255,   256,     0,     0,   257,     0,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+       0,     0,     0,     0,     0,     0,     0,   397,   398,   343,
+     446,   447,   399,   400,   401,     0,     0,     0,   449,     0,
+       0,     0,     0,   101,   102,   103,     0,   104,     0,     0,
+       0,     0,   352,   105,   106,   107,   108,     0,   109,   402,
+     403,   404,   113,   405,     0,     0,   115,   116,   406,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,   353,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+     407,     0,   130,     0,   354,   408,     0,   409,   410,   131,
+     355,   132,   133,   134,   135,   411,   137,   412,   413,   414,
+       0,     0,     0,     0,     0,     0,   140,   415,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,   151,
+     152,   153,   416,     0,   417,   155,   156,   157,   158,   159,
+     160,     0,     0,   418,     0,     0,     0,   356,   162,     0,
+     419,     0,     0,     0,     0,   163,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,   357,   169,   420,
+       0,     0,   421,   422,     0,   172,   358,   173,     0,   423,
+     359,   424,   174,     0,   175,   425,     0,   176,   426,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   427,     0,     0,   428,
+       0,   429,   430,   431,   432,   192,   193,   194,     0,   195,
+       0,   196,     0,     0,     0,   433,     0,     0,     0,   360,
+     198,   199,   200,   201,     0,   202,   203,   434,   204,   435,
+     205,   206,   207,   208,   209,     0,   210,   436,     0,   212,
+     213,   214,   215,     0,   216,   217,   218,   219,     0,   220,
+     361,   221,   222,     0,   437,   438,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,   439,     0,   230,   231,
+       0,   232,   440,   234,   235,   236,   237,   238,   239,   240,
+     241,     0,   242,     0,     0,   441,   442,     0,   243,   244,
+     245,     0,   275,   443,     0,     0,   276,   444,   445,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,     0,   257,     0,   258,
+     259,   260,   261,     0,     0,     0,   262,   263,   264,   265,
+     266,   267,     0,     0,     0,     0,     0,     0,     0,   397,
+     398,   343,   446,   447,   399,   400,   401,     0,     0,     0,
+     449,     0,     0,     0,     0,   101,   102,   103,     0,   104,
+       0,     0,     0,     0,   352,   105,   106,   107,   108,     0,
+     109,   402,   403,   404,   113,   405,     0,     0,   115,   116,
+     406,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+     353,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,   407,     0,   130,     0,   354,   408,     0,   409,
+     410,   131,   355,   132,   133,   134,   135,   411,   137,   412,
+     413,   414,     0,     0,     0,     0,     0,     0,   140,   415,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,   151,   152,   153,   416,     0,   417,   155,   156,   157,
+     158,   159,   160,     0,     0,   418,     0,     0,     0,   356,
+     162,     0,   419,     0,     0,     0,     0,   163,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,   357,
+     169,   420,     0,     0,   421,   422,     0,   172,   358,   173,
+       0,   423,   359,   424,   174,     0,   175,   425,     0,   176,
+     426,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   427,     0,
+       0,   428,     0,   429,   430,   431,   432,   192,   193,   194,
+       0,   195,     0,   196,     0,     0,     0,   433,     0,     0,
+       0,   360,   198,   199,   200,   201,     0,   202,   203,   434,
+     204,   435,   205,   206,   207,   208,   209,     0,   210,   436,
+       0,   212,   213,   214,   215,     0,   216,   217,   218,   219,
+       0,   220,   361,   221,   222,     0,   437,   438,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,   439,     0,
+     230,   231,     0,   232,   440,   234,   235,   236,   237,   238,
+     239,  1085,   241,     0,   242,     0,     0,   441,   442,     0,
+     243,   244,   245,     0,   275,   443,     0,     0,   276,   444,
+     445,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,     0,   257,
+       0,   258,   259,   260,   261,     0,     0,     0,   262,   263,
+     264,   265,   266,   267,     0,     0,     0,     0,     0,     0,
+       0,   397,   398,   343,   446,   447,   399,   400,   401,     0,
+       0,     0,   449,     0,     0,     0,     0,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,   352,   105,   106,   107,
+     108,     0,   109,   402,   403,   404,   113,   405,     0,     0,
+     115,   116,   406,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,   353,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,   407,     0,   130,     0,   354,   408,
+       0,   409,   410,   131,   355,   132,   133,   134,   135,   411,
+     137,   412,   413,   414,     0,     0,     0,     0,     0,     0,
+     140,   415,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   416,     0,   417,   155,
+     156,   157,   158,   159,   160,     0,     0,   418,     0,     0,
+       0,   356,   162,     0,   419,     0,     0,     0,     0,   163,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,   357,   169,   420,     0,     0,   421,   422,     0,   172,
+     358,   173,     0,   423,   359,   424,   174,     0,   175,   425,
+       0,   176,   426,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     427,     0,     0,   428,     0,   429,   430,   431,   432,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   433,
+       0,     0,     0,   360,   198,   199,   200,   201,     0,   202,
+     203,   434,   204,   435,   205,   206,   207,   208,   209,     0,
+     210,   436,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,   361,   221,   222,     0,   437,   438,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+     439,     0,   230,   231,     0,   232,   440,   234,   235,   236,
+     237,   238,   239,  1092,   241,     0,   242,     0,     0,   441,
+     442,     0,   243,   244,   245,     0,   275,   443,     0,     0,
+     276,   444,   445,   249,     0,     0,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+       0,   257,     0,   258,   259,   260,   261,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,     0,     0,     0,     0,
+       0,     0,     0,   397,   398,   343,   446,   447,   399,   400,
+     401,     0,     0,     0,   449,     0,     0,     0,     0,   101,
+     102,   103,     0,   104,     0,     0,     0,     0,   352,   105,
+     106,   107,   108,     0,   109,   402,   403,   404,   113,   405,
+       0,     0,   115,   116,   406,     0,   118,   119,   120,     0,
+       0,     0,   121,     0,   353,   122,   123,   124,     0,     0,
+     125,     0,   126,   127,   128,   129,   407,     0,   130,     0,
+     354,   408,     0,   409,   410,   131,   355,   132,   133,   134,
+     135,   411,   137,   412,   413,   414,     0,     0,     0,     0,
+       0,     0,   140,   415,     0,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,     0,   151,   152,   153,   416,     0,
+     417,   155,   156,   157,   158,   159,   160,     0,     0,   418,
+       0,     0,     0,   356,   162,     0,   419,     0,     0,     0,
+       0,   163,     0,     0,     0,   164,     0,     0,   165,     0,
+     166,   167,   168,   357,   169,   420,     0,     0,   421,   422,
+       0,   172,   358,   173,     0,   423,   359,   424,   174,     0,
+     175,   425,     0,   176,   426,   178,     0,     0,   179,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   427,     0,     0,   428,     0,   429,   430,   431,
+     432,   192,   193,   194,     0,   195,     0,   196,     0,     0,
+       0,   433,     0,     0,     0,   360,   198,   199,   200,   201,
+       0,   202,   203,   434,   204,   435,   205,   206,   207,   208,
+     209,     0,   210,   436,     0,   212,   213,   214,   215,     0,
+     216,   217,   218,   219,     0,   220,   361,   221,   222,     0,
+     437,   438,     0,     0,   223,   224,   225,   226,   227,     0,
+     228,     0,   439,     0,   230,   231,     0,   232,   440,   234,
+     235,   236,   237,   238,   239,  1094,   241,     0,   242,     0,
+       0,   441,   442,     0,   243,   244,   245,     0,   275,   443,
+       0,     0,   276,   444,   445,   249,     0,     0,   250,   251,
+     252,     0,   253,     0,     0,     0,     0,     0,   254,   255,
+     256,     0,     0,   257,     0,   258,   259,   260,   261,     0,
+       0,     0,   262,   263,   264,   265,   266,   267,     0,     0,
+       0,     0,     0,     0,     0,   397,   398,   343,   446,   447,
+     399,   400,   401,     0,     0,     0,   449,     0,     0,     0,
+       0,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+     352,   105,   106,   107,   108,     0,   109,   402,   403,   404,
+     113,   405,     0,     0,   115,   116,   406,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,   353,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,   407,     0,
+     130,     0,   354,   408,     0,   409,   410,   131,   355,   132,
+     133,   134,   135,   411,   137,   412,   413,   414,     0,     0,
+       0,     0,     0,     0,   140,   415,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     416,     0,   417,   155,   156,   157,   158,   159,   160,     0,
+       0,   418,     0,     0,     0,   356,   162,     0,   419,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,   357,   169,   420,     0,     0,
+     421,   422,     0,   172,   358,   173,     0,   423,   359,   424,
+     174,     0,   175,   425,     0,   176,   426,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   427,     0,     0,   428,     0,   429,
+     430,   431,   432,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   433,     0,     0,     0,   360,   198,   199,
+     200,   201,     0,   202,   203,   434,   204,   435,   205,   206,
+     207,   208,   209,     0,   210,   436,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,   361,   221,
+     222,     0,   437,   438,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,   439,     0,   230,   231,     0,   232,
+     440,   234,   235,   236,   237,   238,   239,  1096,   241,     0,
+     242,     0,     0,   441,   442,     0,   243,   244,   245,     0,
+     275,   443,     0,     0,   276,   444,   445,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,     0,
+     254,   255,   256,     0,     0,   257,     0,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+       0,     0,     0,     0,     0,     0,     0,   397,   398,   343,
+     446,   447,   399,   400,   401,     0,     0,     0,   449,     0,
+       0,     0,     0,   101,   102,   103,     0,   104,     0,     0,
+       0,     0,   352,   105,   106,   107,   108,     0,   109,   402,
+     403,   404,   113,   405,     0,     0,   115,   116,   406,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,   353,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+     407,     0,   130,     0,   354,   408,     0,   409,   410,   131,
+     355,   132,   133,   134,   135,   411,   137,   412,   413,   414,
+       0,     0,     0,     0,     0,     0,   140,   415,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,   151,
+     152,   153,   416,     0,   417,   155,   156,   157,   158,   159,
+     160,     0,     0,   418,     0,     0,     0,   356,   162,     0,
+     419,     0,     0,     0,     0,   163,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,   357,   169,   420,
+       0,     0,   421,   422,     0,   172,   358,   173,     0,   423,
+     359,   424,   174,     0,   175,   425,     0,   176,   426,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   427,     0,     0,   428,
+       0,   429,   430,   431,   432,   192,   193,   194,     0,   195,
+       0,   196,     0,     0,     0,   433,     0,     0,     0,   360,
+     198,   199,   200,   201,     0,   202,   203,   434,   204,   435,
+     205,   206,   207,   208,   209,     0,   210,   436,     0,   212,
+     213,   214,   215,     0,   216,   217,   218,   219,     0,   220,
+     361,   221,   222,     0,   437,   438,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,   439,     0,   230,   231,
+       0,   232,   440,   234,   235,   236,   237,   238,   239,  1098,
+     241,     0,   242,     0,     0,   441,   442,     0,   243,   244,
+     245,     0,   275,   443,     0,     0,   276,   444,   445,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,     0,   257,     0,   258,
+     259,   260,   261,     0,     0,     0,   262,   263,   264,   265,
+     266,   267,     0,     0,     0,     0,     0,     0,     0,   397,
+     398,   343,   446,   447,   399,   400,   401,     0,     0,     0,
+     449,     0,     0,     0,     0,   101,   102,   103,     0,   104,
+       0,     0,     0,     0,   352,   105,   106,   107,   108,     0,
+     109,   402,   403,   404,   113,   405,     0,     0,   115,   116,
+     406,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+     353,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,   407,     0,   130,     0,   354,   408,     0,   409,
+     410,   131,   355,   132,   133,   134,   135,   411,   137,   412,
+     413,   414,     0,     0,     0,     0,     0,     0,   140,   415,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,   151,   152,   153,   416,     0,   417,   155,   156,   157,
+     158,   159,   160,     0,     0,   418,     0,     0,     0,   356,
+     162,     0,   419,     0,     0,     0,     0,   163,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,   357,
+     169,   420,     0,     0,   421,   422,     0,   172,   358,   173,
+       0,   423,   359,   424,   174,     0,   175,   425,     0,   176,
+     426,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   427,     0,
+       0,   428,     0,   429,   430,   431,   432,   192,   193,   194,
+       0,   195,     0,   196,     0,     0,     0,   433,     0,     0,
+       0,   360,   198,   199,   200,   201,     0,   202,   203,   434,
+     204,   435,   205,   206,   207,   208,   209,     0,   210,   436,
+       0,   212,   213,   214,   215,     0,   216,   217,   218,   219,
+       0,   220,   361,   221,   222,     0,   437,   438,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,   439,     0,
+     230,   231,     0,   232,   440,   234,   235,   236,   237,   238,
+     239,  1100,   241,     0,   242,     0,     0,   441,   442,     0,
+     243,   244,   245,     0,   275,   443,     0,     0,   276,   444,
+     445,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,     0,   257,
+       0,   258,   259,   260,   261,     0,     0,     0,   262,   263,
+     264,   265,   266,   267,     0,     0,     0,     0,     0,     0,
+       0,   397,   398,   343,   446,   447,   399,   400,   401,     0,
+       0,     0,   449,     0,     0,     0,     0,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,   352,   105,   106,   107,
+     108,     0,   109,   402,   403,   404,   113,   405,     0,     0,
+     115,   116,   406,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,   353,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,   407,     0,   130,     0,   354,   408,
+       0,   409,   410,   131,   355,   132,   133,   134,   135,   411,
+     137,   412,   413,   414,     0,     0,     0,     0,     0,     0,
+     140,   415,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   416,     0,   417,   155,
+     156,   157,   158,   159,   160,     0,     0,   418,     0,     0,
+       0,   356,   162,     0,   419,     0,     0,     0,     0,   163,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,   357,   169,   420,     0,     0,   421,   422,     0,   172,
+     358,   173,     0,   423,   359,   424,   174,     0,   175,   425,
+       0,   176,   426,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     427,     0,     0,   428,     0,   429,   430,   431,   432,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   433,
+       0,     0,     0,   360,   198,   199,   200,   201,     0,   202,
+     203,   434,   204,   435,   205,   206,   207,   208,   209,     0,
+     210,   436,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,   361,   221,   222,     0,   437,   438,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+     439,     0,   230,   231,     0,   232,   440,   234,   235,   236,
+     237,   238,   239,  1102,   241,     0,   242,     0,     0,   441,
+     442,     0,   243,   244,   245,     0,   275,   443,     0,     0,
+     276,   444,   445,   249,     0,     0,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+       0,   257,     0,   258,   259,   260,   261,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,     0,     0,     0,     0,
+       0,     0,     0,   397,   398,   343,   446,   447,   399,   400,
+     401,     0,     0,     0,   449,     0,     0,     0,     0,   101,
+     102,   103,     0,   104,     0,     0,     0,     0,   352,   105,
+     106,   107,   108,     0,   109,   402,   403,   404,   113,   405,
+       0,     0,   115,   116,   406,     0,   118,   119,   120,     0,
+       0,     0,   121,     0,   353,   122,   123,   124,     0,     0,
+     125,     0,   126,   127,   128,   129,   407,     0,   130,     0,
+     354,   408,     0,   409,   410,   131,   355,   132,   133,   134,
+     135,   411,   137,   412,   413,   414,     0,     0,     0,     0,
+       0,     0,   140,   415,     0,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,     0,   151,   152,   153,   416,     0,
+     417,   155,   156,   157,   158,   159,   160,     0,     0,   418,
+       0,     0,     0,   356,   162,     0,   419,     0,     0,     0,
+       0,   163,     0,     0,     0,   164,     0,     0,   165,     0,
+     166,   167,   168,   357,   169,   420,     0,     0,   421,   422,
+       0,   172,   358,   173,     0,   423,   359,   424,   174,     0,
+     175,   425,     0,   176,   426,   178,     0,     0,   179,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   427,     0,     0,   428,     0,   429,   430,   431,
+     432,   192,   193,   194,     0,   195,     0,   196,     0,     0,
+       0,   433,     0,     0,     0,   360,   198,   199,   200,   201,
+       0,   202,   203,   434,   204,   435,   205,   206,   207,   208,
+     209,     0,   210,   436,     0,   212,   213,   214,   215,     0,
+     216,   217,   218,   219,     0,   220,   361,   221,   222,     0,
+     437,   438,     0,     0,   223,   224,   225,   226,   227,     0,
+     228,     0,   439,     0,   230,   231,     0,   232,   440,   234,
+     235,   236,   237,   238,   239,  1104,   241,     0,   242,     0,
+       0,   441,   442,     0,   243,   244,   245,     0,   275,   443,
+       0,     0,   276,   444,   445,   249,     0,     0,   250,   251,
+     252,     0,   253,     0,     0,     0,     0,     0,   254,   255,
+     256,     0,     0,   257,     0,   258,   259,   260,   261,     0,
+       0,     0,   262,   263,   264,   265,   266,   267,     0,     0,
+       0,     0,     0,     0,     0,   397,   398,   343,   446,   447,
+     399,   400,   401,     0,     0,     0,   449,     0,     0,     0,
+       0,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+     352,   105,   106,   107,   108,     0,   109,   402,   403,   404,
+     113,   405,     0,     0,   115,   116,   406,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,   353,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,   407,     0,
+     130,     0,   354,   408,     0,   409,   410,   131,   355,   132,
+     133,   134,   135,   411,   137,   412,   413,   414,     0,     0,
+       0,     0,     0,     0,   140,   415,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     416,     0,   417,   155,   156,   157,   158,   159,   160,     0,
+       0,   418,     0,     0,     0,   356,   162,     0,   419,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,   357,   169,   420,     0,     0,
+     421,   422,     0,   172,   358,   173,     0,   423,   359,   424,
+     174,     0,   175,   425,     0,   176,   426,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   427,     0,     0,   428,     0,   429,
+     430,   431,   432,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   433,     0,     0,     0,   360,   198,   199,
+     200,   201,     0,   202,   203,   434,   204,   435,   205,   206,
+     207,   208,   209,     0,   210,   436,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,   361,   221,
+     222,     0,   437,   438,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,   439,     0,   230,   231,     0,   232,
+     440,   234,   235,   236,   237,   238,   239,  1106,   241,     0,
+     242,     0,     0,   441,   442,     0,   243,   244,   245,     0,
+     275,   443,     0,     0,   276,   444,   445,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,     0,
+     254,   255,   256,     0,     0,   257,     0,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+       0,     0,     0,     0,     0,     0,     0,   397,   398,   343,
+     446,   447,   399,   400,   401,     0,     0,     0,   449,     0,
+       0,     0,     0,   101,   102,   103,     0,   104,     0,     0,
+       0,     0,   352,   105,   106,   107,   108,     0,   109,   402,
+     403,   404,   113,   405,     0,     0,   115,   116,   406,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,   353,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+     407,     0,   130,     0,   354,   408,     0,   409,   410,   131,
+     355,   132,   133,   134,   135,   411,   137,   412,   413,   414,
+       0,     0,     0,     0,     0,     0,   140,   415,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,   151,
+     152,   153,   416,     0,   417,   155,   156,   157,   158,   159,
+     160,     0,     0,   418,     0,     0,     0,   356,   162,     0,
+     419,     0,     0,     0,     0,   163,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,   357,   169,   420,
+       0,     0,   421,   422,     0,   172,   358,   173,     0,   423,
+     359,   424,   174,     0,   175,   425,     0,   176,   426,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   427,     0,     0,   428,
+       0,   429,   430,   431,   432,   192,   193,   194,     0,   195,
+       0,   196,     0,     0,     0,   433,     0,     0,     0,   360,
+     198,   199,   200,   201,     0,   202,   203,   434,   204,   435,
+     205,   206,   207,   208,   209,     0,   210,   436,     0,   212,
+     213,   214,   215,     0,   216,   217,   218,   219,     0,   220,
+     361,   221,   222,     0,   437,   438,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,   439,     0,   230,   231,
+       0,   232,   440,   234,   235,   236,   237,   238,   239,  1108,
+     241,     0,   242,     0,     0,   441,   442,     0,   243,   244,
+     245,     0,   275,   443,     0,     0,   276,   444,   445,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,     0,   257,     0,   258,
+     259,   260,   261,     0,     0,     0,   262,   263,   264,   265,
+     266,   267,     0,     0,     0,     0,     0,     0,     0,   397,
+     398,   343,   446,   447,   399,   400,   401,     0,     0,     0,
+     449,     0,     0,     0,     0,   101,   102,   103,     0,   104,
+       0,     0,     0,     0,   352,   105,   106,   107,   108,     0,
+     109,   402,   403,   404,   113,   405,     0,     0,   115,   116,
+     406,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+     353,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,   407,     0,   130,     0,   354,   408,     0,   409,
+     410,   131,   355,   132,   133,   134,   135,   411,   137,   412,
+     413,   414,     0,     0,     0,     0,     0,     0,   140,   415,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,   151,   152,   153,   416,     0,   417,   155,   156,   157,
+     158,   159,   160,     0,     0,   418,     0,     0,     0,   356,
+     162,     0,   419,     0,     0,     0,     0,   163,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,   357,
+     169,   420,     0,     0,   421,   422,     0,   172,   358,   173,
+       0,   423,   359,   424,   174,     0,   175,   425,     0,   176,
+     426,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   427,     0,
+       0,   428,     0,   429,   430,   431,   432,   192,   193,   194,
+       0,   195,     0,   196,     0,     0,     0,   433,     0,     0,
+       0,   360,   198,   199,   200,   201,     0,   202,   203,   434,
+     204,   435,   205,   206,   207,   208,   209,     0,   210,   436,
+       0,   212,   213,   214,   215,     0,   216,   217,   218,   219,
+       0,   220,   361,   221,   222,     0,   437,   438,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,   439,     0,
+     230,   231,     0,   232,   440,   234,   235,   236,   237,   238,
+     239,  1382,   241,     0,   242,     0,     0,   441,   442,     0,
+     243,   244,   245,     0,   275,   443,     0,     0,   276,   444,
+     445,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,     0,   257,
+       0,   258,   259,   260,   261,     0,     0,     0,   262,   263,
+     264,   265,   266,   267,     0,     0,     0,     0,     0,     0,
+       0,   397,   398,   343,   446,   447,   399,   400,   401,     0,
+       0,     0,   449,     0,     0,     0,     0,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,   352,   105,   106,   107,
+     108,     0,   109,   402,   403,   404,   113,   405,     0,     0,
+     115,   116,   406,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,   353,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,   407,     0,   130,     0,   354,   408,
+       0,   409,   410,   131,   355,   132,   133,   134,   135,   411,
+     137,   412,   413,   414,     0,     0,     0,     0,     0,     0,
+     140,   415,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   416,     0,   417,   155,
+     156,   157,   158,   159,   160,     0,     0,   418,     0,     0,
+       0,   356,   162,     0,   419,     0,     0,     0,     0,   163,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,   357,   169,   420,     0,     0,   421,   422,     0,   172,
+     358,   173,     0,   423,   359,   424,   174,     0,   175,   425,
+       0,   176,   426,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     427,     0,     0,   428,     0,   429,   430,   431,   432,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   433,
+       0,     0,     0,   360,   198,   199,   200,   201,     0,   202,
+     203,   434,   204,   435,   205,   206,   207,   208,   209,     0,
+     210,   436,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,   361,   221,   222,     0,   437,   438,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+     439,     0,   230,   231,     0,   232,   440,   234,   235,   236,
+     237,   238,   239,   240,   241,     0,   242,     0,     0,   441,
+     442,     0,   243,   244,   245,     0,   275,   443,     0,     0,
+     276,   444,   445,   249,     0,     0,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+       0,   257,     0,   258,   259,   260,     0,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,     0,     0,     0,     0,
+       0,     0,     0,   397,   398,   343,   446,   447,   399,   400,
+     401,     0,     0,     0,   449,     0,     0,     0,     0,   101,
+     102,   103,     0,   104,     0,     0,     0,     0,   352,   105,
+     106,   107,   108,     0,   109,   402,   403,   404,   113,   405,
+       0,     0,   115,   116,   406,     0,   118,   119,   120,     0,
+       0,     0,   121,     0,   353,   122,   123,   124,     0,     0,
+     125,     0,   126,   127,   128,   129,   407,     0,   130,     0,
+     354,   408,     0,   409,   410,   131,   355,   132,   133,   134,
+     135,   411,   137,   412,   413,   414,     0,     0,     0,     0,
+       0,     0,   140,   415,     0,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,     0,   151,   152,   153,   416,     0,
+     417,   155,   156,   157,   158,   159,   160,     0,     0,   418,
+       0,     0,     0,   356,   162,     0,   419,     0,     0,     0,
+       0,   163,     0,     0,     0,   164,     0,     0,   165,     0,
+     166,   167,   168,   357,   169,   420,     0,     0,   421,   422,
+       0,   172,   358,   173,     0,   423,   359,   424,   174,     0,
+     175,   425,     0,   176,   426,   178,     0,     0,   179,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   427,     0,     0,     0,     0,   429,   430,   431,
+     432,   192,   193,   194,     0,   195,     0,   196,     0,     0,
+       0,   433,     0,     0,     0,   360,   198,   199,   200,   201,
+       0,   202,   203,     0,   204,   435,   205,   206,   207,   208,
+     209,     0,   210,   436,     0,   212,   213,   214,   215,     0,
+     216,   217,   218,   219,     0,   220,   361,   221,   222,     0,
+     437,   438,     0,     0,   223,   224,   225,   226,   227,     0,
+     228,     0,   439,     0,   230,   231,     0,   232,   440,   234,
+     235,   236,   237,   238,   239,   240,   241,     0,   242,     0,
+       0,   441,   442,     0,   243,   244,   245,     0,   275,   443,
+       0,     0,   276,   444,   445,   249,     0,     0,   250,   251,
+     252,     0,   253,     0,     0,     0,     0,     0,   254,   255,
+     256,     0,     0,   257,     0,   258,   259,   260,   261,     0,
+       0,     0,   262,   263,   264,   265,   266,   267,     0,     0,
+       0,     0,     0,     0,     0,   397,   398,   343,  1076,  1077,
+     399,   400,   401,     0,     0,     0,   449,     0,     0,     0,
+       0,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+     352,   105,   106,   107,   108,     0,   109,   402,   403,   404,
+     113,   405,     0,     0,   115,   116,   406,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,   353,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,   407,     0,
+     130,     0,   354,   408,     0,   409,   410,   131,   355,   132,
+     133,   134,   135,   411,   137,   412,   413,   414,     0,     0,
+       0,     0,     0,     0,   140,   415,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     416,     0,   417,   155,   156,   157,   158,   159,   160,     0,
+       0,   418,     0,     0,     0,   356,   162,     0,   419,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,   357,   169,   420,     0,     0,
+     421,   422,     0,   172,   358,   173,     0,   423,   359,   424,
+       0,     0,   175,   425,     0,   176,   426,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   427,     0,     0,   428,     0,   429,
+     430,   431,   432,   192,   193,   194,     0,   195,     0,     0,
+       0,     0,     0,   433,     0,     0,     0,   360,   198,   199,
+     200,   201,     0,   202,   203,   434,   204,   435,   205,   206,
+       0,   208,   209,     0,   210,   436,     0,   212,   213,   214,
+     215,     0,   216,   217,     0,     0,     0,   220,   361,   221,
+     222,     0,   437,   438,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,   439,     0,   230,   231,     0,   232,
+     440,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,   441,   442,     0,   243,   244,   245,     0,
+     275,   443,     0,     0,   276,   444,   445,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,     0,
+     254,   255,   256,     0,     0,   257,     0,   258,   259,   260,
+     627,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+       0,     0,     0,     0,     0,     0,     0,   397,   398,   343,
+     446,   447,   399,   400,   401,     0,     0,     0,   449,     0,
+       0,     0,     0,   101,   102,   103,     0,   104,     0,     0,
+       0,     0,   352,   105,   106,   107,   108,     0,   109,   402,
+     403,   404,   113,   405,     0,     0,   115,   116,   406,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,   353,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+     407,     0,   130,     0,   354,   408,     0,   409,   410,   131,
+     355,   132,   133,   134,   135,   411,   137,   412,   413,   414,
+       0,     0,     0,     0,     0,     0,   140,   415,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,     0,
+       0,   153,   416,     0,   417,   155,   156,   157,   158,   159,
+     160,     0,     0,   418,     0,     0,     0,   356,   162,     0,
+     419,     0,     0,     0,     0,   163,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,   357,   169,   420,
+       0,     0,   421,   422,     0,   172,   358,   173,     0,   423,
+     359,   424,     0,     0,   175,   425,     0,   176,   426,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   427,     0,     0,     0,
+       0,   429,   430,   431,   432,   192,   193,   194,     0,   195,
+       0,     0,     0,     0,     0,   433,     0,     0,     0,   360,
+     198,   199,   200,   201,     0,   202,   203,   434,   204,   435,
+     205,   206,   207,   208,   209,     0,   210,   436,     0,   212,
+     213,   214,   215,     0,   216,   217,     0,     0,     0,   220,
+     361,   221,   222,     0,   437,   438,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,   439,     0,   230,   231,
+       0,   232,   440,   234,   235,   236,   237,   238,   239,  1114,
+     241,     0,   242,     0,     0,   441,   442,     0,   243,   244,
+     245,     0,   275,   443,     0,     0,   276,   444,   445,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,     0,   257,     0,   258,
+     259,   260,     0,     0,     0,     0,   262,   263,   264,   265,
+     266,   267,     0,     0,     0,     0,     0,     0,     0,   397,
+     398,   343,   446,   447,   399,   400,   401,     0,     0,     0,
+     449,     0,     0,     0,     0,   101,   102,   103,     0,   104,
+       0,     0,     0,     0,   352,   105,   106,   107,   108,     0,
+     109,   402,   403,   404,   113,   405,     0,     0,   115,   116,
+     406,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+     353,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,   407,     0,   130,     0,   354,   408,     0,   409,
+     410,   131,   355,   132,   133,   134,   135,   411,   137,   412,
+     413,   414,     0,     0,     0,     0,     0,     0,   140,   415,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,     0,     0,   153,   416,     0,   417,   155,   156,   157,
+     158,   159,   160,     0,     0,   418,     0,     0,     0,   356,
+     162,     0,   419,     0,     0,     0,     0,   163,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,   357,
+     169,   420,     0,     0,   421,   422,     0,   172,   358,   173,
+       0,   423,   359,   424,     0,     0,   175,   425,     0,   176,
+     426,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   427,     0,
+       0,     0,     0,   429,   430,   431,   432,   192,   193,   194,
+       0,   195,     0,     0,     0,     0,     0,   433,     0,     0,
+       0,   360,   198,   199,   200,   201,     0,   202,   203,     0,
+     204,   435,   205,   206,     0,   208,   209,     0,   210,   436,
+       0,   212,   213,   214,   215,     0,   216,   217,     0,     0,
+       0,   220,   361,   221,   222,     0,   437,   438,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,   439,     0,
+     230,   231,     0,   232,   440,   234,   235,   236,   237,   238,
+     239,   240,   241,     0,   242,     0,     0,   441,   442,     0,
+     243,   244,   245,     0,   275,   443,     0,     0,   276,   444,
+     445,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,     0,   257,
+       0,   258,   259,   260,     0,     0,     0,     0,   262,   263,
+     264,   265,   266,   267,     0,     0,     0,   397,     0,     0,
+       0,     0,     0,     0,  1076,  1077,     0,     0,     0,     0,
+       0,     0,   449,   101,   102,   103,     0,   104,     0,     0,
+       0,     0,   352,   105,   106,   107,   108,     0,   109,   110,
+     111,   112,   113,   114,     0,     0,   115,   116,   117,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,   353,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+     407,     0,   130,     0,   354,   408,     0,   409,   410,   131,
+     355,   132,   133,   134,   135,   136,   137,   412,   138,   139,
+       0,     0,     0,     0,     0,     0,   140,   141,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,   151,
+     152,   153,   154,     0,   417,   155,   156,   157,   158,   159,
+     160,     0,     0,   161,     0,     0,     0,   356,   162,     0,
+     419,     0,     0,     0,     0,   163,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,   357,   169,   170,
+       0,     0,     0,   171,     0,   172,   358,   173,     0,   423,
+     359,     0,   174,     0,   175,   425,     0,   176,   177,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   427,     0,     0,     0,
+       0,     0,   430,   190,   191,   192,   193,   194,     0,   195,
+       0,   196,     0,     0,     0,   197,     0,     0,     0,   360,
+     198,   199,   200,   201,     0,   202,   203,     0,   204,   435,
+     205,   206,   207,   208,   209,     0,   210,   211,     0,   212,
+     213,   214,   215,     0,   216,   217,   218,   219,     0,   220,
+     361,   221,   222,     0,     0,   438,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,   439,     0,   230,   231,
+       0,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,     0,   242,     0,     0,   441,   442,     0,   243,   244,
+     245,     0,   275,   247,     0,     0,   276,   444,   445,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,     0,   257,     0,   258,
+     259,   260,   261,     0,     0,     0,   262,   263,   264,   265,
+     266,   267,     0,     0,     0,   351,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1661,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+     352,   105,   106,   107,   108,     0,   109,   110,   111,   112,
+     113,   114,     0,     0,   115,   116,   117,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,   353,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,     0,     0,
+     130,     0,   354,     0,     0,     0,     0,   131,   355,   132,
+     133,   134,   135,   136,   137,     0,   138,   139,     0,     0,
+       0,     0,     0,     0,   140,   141,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     154,     0,     0,   155,   156,   157,   158,   159,   160,     0,
+       0,   161,     0,     0,     0,   356,   162,     0,     0,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,   357,   169,   170,     0,     0,
+       0,   171,     0,   172,   358,   173,     0,     0,   359,     0,
+     174,     0,   175,     0,     0,   176,   177,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,     0,     0,     0,     0,     0,
+       0,   190,   191,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   197,     0,     0,     0,   360,   198,   199,
+     200,   201,     0,   202,   203,     0,   204,     0,   205,   206,
+     207,   208,   209,     0,   210,   211,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,   361,   221,
+     222,     0,     0,     0,     0,     0,   223,   224,   225,   226,
+     227,    13,   228,     0,     0,     0,   230,   231,     0,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,     0,     0,     0,   243,   244,   245,     0,
+     275,   247,     0,     0,   276,     0,     0,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,     0,
+     254,   255,   256,     0,    20,   257,     0,   258,   259,   260,
+     261,     0,     0,    21,   262,   263,   264,   265,   266,   267,
+       0,     0,     0,    99,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    22,   101,
+     102,   103,     0,   104,     0,     0,     0,     0,     0,   105,
+     106,   107,   108,     0,   109,   110,   111,   112,   113,   114,
+       0,     0,   115,   116,   117,     0,   118,   119,   120,     0,
+       0,     0,   121,     0,     0,   122,   123,   124,     0,     0,
+     125,     0,   126,   127,   128,   129,     0,     0,   130,     0,
+       0,     0,     0,     0,     0,   131,     0,   132,   133,   134,
+     135,   136,   137,     0,   138,   139,     0,     0,     0,     0,
+       0,     0,   140,   141,     0,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,     0,   151,   152,   153,   154,     0,
+       0,   155,   156,   157,   158,   159,   160,     0,     0,   161,
+       0,     0,     0,     0,   162,     0,     0,     0,     0,     0,
+       0,   163,     0,     0,     0,   164,     0,     0,   165,     0,
+     166,   167,   168,     0,   169,   170,     0,     0,     0,   171,
+       0,   172,     0,   173,     0,     0,     0,     0,   174,     0,
+     175,     0,     0,   176,   177,   178,     0,     0,   179,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,     0,     0,     0,     0,     0,     0,     0,   190,
+     191,   192,   193,   194,     0,   195,     0,   196,     0,     0,
+     301,   197,     0,     0,     0,     0,   198,   199,   200,   201,
+       0,   202,   203,     0,   204,   302,   205,   206,   207,   208,
+     209,     0,   210,   211,     0,   212,   213,   214,   215,     0,
+     216,   217,   218,   219,     0,   220,     0,   221,   222,     0,
+       0,     0,     0,     0,   223,   224,   225,   226,   227,    13,
+     228,     0,     0,     0,   230,   231,     0,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,     0,   242,     0,
+       0,     0,     0,     0,   243,   244,   245,     0,   275,   247,
+       0,     0,   276,     0,     0,   249,     0,     0,   250,   251,
+     252,     0,   253,     0,     0,     0,     0,     0,   254,   255,
+     256,     0,    20,   257,     0,   258,   259,   260,   261,     0,
+       0,    21,   262,   263,   264,   265,   266,   267,     0,     0,
+       0,    99,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1133,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,     0,   105,   106,   107,
+     108,     0,   109,   110,   111,   112,   113,   114,     0,     0,
+     115,   116,   117,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,     0,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,     0,     0,   130,     0,     0,     0,
+       0,     0,     0,   131,     0,   132,   133,   134,   135,   136,
+     137,     0,   138,   139,     0,     0,     0,     0,     0,     0,
+     140,   141,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   154,     0,     0,   155,
+     156,   157,   158,   159,   160,     0,     0,   161,     0,     0,
+       0,     0,   162,     0,     0,     0,     0,     0,     0,   163,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,     0,   169,   170,     0,     0,     0,   171,     0,   172,
+       0,   173,     0,     0,     0,     0,   174,     0,   175,     0,
+       0,   176,   177,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,     0,     0,     0,     0,     0,     0,   190,   191,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   197,
+       0,     0,     0,     0,   198,   199,   200,   201,     0,   202,
+     203,     0,   204,     0,   205,   206,   207,   208,   209,     0,
+     210,   211,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,     0,   221,   222,     0,     0,     0,
+       0,     0,   223,   224,   225,   226,   227,    13,   228,     0,
+       0,     0,   230,   231,     0,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,     0,   242,     0,     0,     0,
+       0,     0,   243,   244,   245,     0,   275,   247,     0,     0,
+     276,     0,     0,   249,     0,     0,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+      20,   257,     0,   258,   259,   260,   261,     0,     0,    21,
+     262,   263,   264,   265,   266,   267,     0,     0,     0,    99,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    22,   101,   102,   103,     0,   104,
+       0,     0,     0,     0,     0,   105,   106,   107,   108,     0,
+     109,   110,   111,   112,   113,   114,     0,     0,   115,   116,
+     117,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+       0,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,     0,     0,   130,     0,     0,     0,     0,     0,
+       0,   131,     0,   132,   133,   134,   135,   136,   137,     0,
+     138,   139,     0,     0,     0,     0,     0,     0,   140,   141,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,   151,   152,   153,   154,     0,     0,   155,   156,   157,
+     158,   159,   160,     0,     0,   161,     0,     0,     0,     0,
+     162,     0,     0,     0,     0,     0,     0,   163,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,     0,
+     169,   170,     0,     0,     0,   171,     0,   172,     0,   173,
+       0,     0,     0,     0,   174,     0,   175,     0,     0,   176,
+     177,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,     0,
+       0,     0,     0,     0,     0,   190,   191,   192,   193,   194,
+       0,   195,     0,   196,     0,     0,   301,   197,     0,     0,
+       0,     0,   198,   199,   200,   201,     0,   202,   203,     0,
+     204,   302,   205,   206,   207,   208,   209,     0,   210,   211,
+       0,   212,   213,   214,   215,     0,   216,   217,   218,   219,
+       0,   220,     0,   221,   222,     0,     0,     0,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,     0,     0,
+     230,   231,     0,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,     0,   242,     0,     0,     0,     0,     0,
+     243,   244,   245,     0,   275,   247,     0,     0,   276,     0,
+       0,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,     0,   257,
+       0,   258,   259,   260,   261,     0,     0,    99,   262,   263,
+     264,   265,   266,   267,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   101,   102,   103,     0,   104,     0,     0,
+       0,     0,  1133,   105,   106,   107,   108,     0,   109,   110,
+     111,   112,   113,   114,     0,     0,   115,   116,   117,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,     0,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+       0,     0,   130,     0,     0,     0,     0,     0,     0,   131,
+       0,   132,   133,   134,   135,   136,   137,     0,   138,   139,
+       0,     0,     0,     0,     0,     0,   140,   141,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,   151,
+     152,   153,   154,     0,     0,   155,   156,   157,   158,   159,
+     160,     0,     0,   161,     0,     0,     0,     0,   162,     0,
+       0,     0,     0,     0,     0,   163,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,     0,   169,   170,
+       0,     0,     0,   171,     0,   172,     0,   173,     0,     0,
+       0,     0,   174,     0,   175,     0,     0,   176,   177,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,     0,     0,     0,     0,
+       0,     0,     0,   190,   191,   192,   193,   194,     0,   195,
+       0,   196,     0,     0,     0,   197,     0,     0,     0,     0,
+     198,   199,   200,   201,     0,   202,   203,     0,   204,   302,
+     205,   206,   207,   208,   209,     0,   210,   211,     0,   212,
+     213,   214,   215,     0,   216,   217,   218,   219,     0,   220,
+       0,   221,   222,     0,     0,     0,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,     0,     0,   230,   231,
+       0,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,     0,   242,     0,     0,     0,     0,     0,   243,   244,
+     245,     0,   275,   247,     0,     0,   276,     0,     0,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,     0,   257,     0,   258,
+     259,   260,   261,     0,     0,    99,   262,   263,   264,   265,
+     266,   267,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+     498,   105,   106,   107,   108,     0,   109,   110,   111,   112,
+     113,   114,     0,     0,   115,   116,   117,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,     0,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,     0,     0,
+     130,     0,     0,     0,     0,     0,     0,   131,     0,   132,
+     133,   134,   135,   136,   137,     0,   138,   139,     0,     0,
+       0,     0,     0,     0,   140,   141,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     154,     0,     0,   155,   156,   157,   158,   159,   160,     0,
+       0,   161,     0,     0,     0,     0,   162,     0,     0,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,     0,   169,   170,     0,     0,
+       0,   171,     0,   172,     0,   173,     0,     0,     0,     0,
+     174,     0,   175,     0,     0,   176,   177,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,     0,     0,     0,     0,     0,
+       0,   190,   191,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   197,     0,     0,     0,     0,   198,   199,
+     200,   201,     0,   202,   203,     0,   204,     0,   205,   206,
+     207,   208,   209,     0,   210,   211,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,     0,   221,
+     222,     0,     0,     0,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,     0,     0,   230,   231,     0,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,     0,     0,     0,   243,   244,   245,     0,
+     275,   247,     0,     0,   276,     0,     0,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,     0,
+     254,   255,   256,     0,     0,   257,     0,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+       0,     0,     0,     0,     0,     0,  1697,   608,   343,     0,
+       0,  1014,   400,     0,     0,     0,     0,     0,   841,   729,
+     730,   731,   101,   102,   103,   732,   104,   733,   734,   735,
+     736,   352,   105,   106,   107,   108,   737,  1698,  1040,  1041,
+    1042,  1699,  1044,     0,   738,   115,   116,     0,     0,   118,
+    1045,   120,   739,   740,   741,   121,   742,   353,   122,   123,
+     124,   743,   744,   125,   745,   126,   127,   128,  1700,     0,
+     746,   130,   747,   354,     0,   748,     0,     0,   131,   355,
+     132,   133,   134,   135,  1047,   137,     0,  1048,  1049,   749,
+     750,   751,   752,   753,     0,   140,   415,   754,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   755,     0,   152,
+     153,     0,     0,     0,   155,   156,   157,   158,   159,   160,
+     756,   757,  1051,   758,   759,   760,   356,   162,   761,     0,
+     762,   763,     0,   764,   163,   765,   766,   767,   164,   768,
+     769,   165,   770,   166,   167,   168,   357,   169,  1052,   771,
+     772,  1053,  1054,   773,   172,   358,   173,     0,     0,   359,
+     774,   174,   775,   175,     0,   776,   176,  1055,   178,   777,
+     778,   179,   779,   780,   781,   180,   181,   182,   183,   184,
+     185,   186,  1701,  1702,   189,     0,   782,   783,   784,   785,
+     786,     0,  1058,  1059,  1703,   193,   194,   787,   195,   788,
+     196,   789,   790,   791,  1704,   792,   793,   794,   360,   198,
+     199,   200,   201,   795,   202,   203,   796,   204,   797,   205,
+     206,   207,   208,   209,  1705,   210,  1062,     0,   212,   213,
+     214,   215,   799,   216,   217,   218,   219,   800,   220,   361,
+     221,   222,   801,   802,   803,   804,   805,   223,   224,   225,
+     226,   227,   806,   228,   807,     0,   808,   230,   231,   809,
+     232,  1063,   234,  1706,   236,   237,   238,   239,   240,   241,
+     810,   242,   811,   812,   813,     0,   814,   243,   244,   245,
+     815,     0,  1064,   816,     0,   276,     0,     0,   249,   817,
+     818,   250,   251,   252,   819,   253,   820,   821,   822,   823,
+     824,   254,   255,   256,   825,   826,  1065,  1707,   258,   259,
+     260,     0,   828,   829,   830,   262,   263,   264,   265,   266,
+     267,    99,     0,     0,     0,     0,  1014,  1015,  1016,  1017,
+       0,  1708,  1709,  1020,  1021,  1022,  1023,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,     0,   105,   106,   107,
+     108,     0,   109,   110,   111,   112,   113,   114,     0,     0,
+     115,   116,   117,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,     0,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,     0,     0,   130,     0,     0,     0,
+       0,     0,     0,   131,     0,   132,   133,   134,   135,   136,
+     137,     0,   138,   139,     0,     0,     0,     0,     0,     0,
+     140,   141,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   154,     0,     0,   155,
+     156,   157,   158,   159,   160,     0,     0,   161,     0,     0,
+       0,     0,   162,     0,     0,     0,     0,     0,     0,   163,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,     0,   169,   170,     0,     0,     0,   171,     0,   172,
+       0,   173,     0,     0,     0,     0,   174,     0,   175,     0,
+       0,   176,   177,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,     0,     0,     0,     0,     0,     0,   190,   191,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   197,
+       0,     0,     0,     0,   198,   199,   200,   201,     0,   202,
+     203,     0,   204,     0,   205,   206,   207,   208,   209,     0,
+     210,   211,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,     0,   221,   222,     0,     0,     0,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+       0,     0,   230,   231,     0,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,     0,   242,     0,     0,     0,
+       0,     0,   243,   244,   245,     0,   275,   247,     0,     0,
+     276,     0,     0,   249,     0,     0,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+       0,   257,     0,   258,   259,   260,   261,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,    99,     0,     0,     0,
+       0,  1014,  1015,  1016,  1017,     0,  1018,  1019,  1020,  1021,
+    1022,  1023,   101,   102,   103,     0,   104,     0,     0,     0,
+       0,     0,   105,   106,   107,   108,     0,   109,   110,   111,
+     112,   113,   114,     0,     0,   115,   116,   117,     0,   118,
+     119,   120,     0,     0,     0,   121,     0,     0,   122,   123,
+     124,     0,     0,   125,     0,   126,   127,   128,   129,     0,
+       0,   130,     0,     0,     0,     0,     0,     0,   131,     0,
+     132,   133,   134,   135,   136,   137,     0,   138,   139,     0,
+       0,     0,     0,     0,     0,   140,   141,     0,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,     0,   151,   152,
+     153,   154,     0,     0,   155,   156,   157,   158,   159,   160,
+       0,     0,   161,     0,     0,     0,     0,   162,     0,     0,
+       0,     0,     0,     0,   163,     0,     0,     0,   164,     0,
+       0,   165,     0,   166,   167,   168,     0,   169,   170,     0,
+       0,     0,   171,     0,   172,     0,   173,     0,     0,     0,
+       0,   174,     0,   175,     0,     0,   176,   177,   178,     0,
+       0,   179,     0,     0,     0,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,     0,     0,     0,   662,     0,
+       0,   663,   190,   191,   192,   193,   194,     0,   195,     0,
+     196,     0,   664,     0,  1913,     0,     0,     0,     0,   198,
+     199,   200,   201,   666,   202,   203,     0,   204,     0,   205,
+     206,   207,   208,   209,     0,   210,   211,     0,   212,   213,
+     214,   215,     0,   216,   217,   218,   219,     0,   220,     0,
+     221,   222,     0,     0,     0,     0,     0,   223,   224,   225,
+     226,   227,     0,   228,     0,     0,     0,   230,   231,     0,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+       0,   242,   662,     0,     0,   663,     0,   243,   244,   245,
+       0,   275,   247,     0,     0,   276,   664,     0,   249,     0,
+       0,   250,   251,   252,     0,   253,     0,   666,     0,     0,
+       0,   254,   255,   256,     0,     0,   257,     0,   258,   259,
+     260,   261,     0,   667,     0,   262,   263,   264,   265,   266,
+     267,     0,     0,     0,     0,     0,     0,  1015,  1016,  1017,
+     668,  1018,  1019,  1020,  1021,  1022,  1023,     0,   662,   669,
+       0,   663,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   664,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   666,     0,   670,     0,     0,     0,     0,
+       0,     0,     0,     0,   662,     0,     0,   663,     0,     0,
+       0,   671,     0,   672,     0,     0,     0,     0,   664,     0,
+       0,     0,     0,     0,     0,     0,     0,   667,     0,   666,
+       0,     0,     0,     0,     0,     0,     0,   662,     0,     0,
+     663,     0,     0,     0,   668,     0,     0,     0,     0,     0,
+       0,   664,   662,   669,     0,   663,     0,     0,     0,     0,
+       0,     0,   666,     0,     0,     0,   664,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   666,     0,   670,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   667,     0,   671,     0,   672,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     668,     0,     0,     0,     0,     0,     0,     0,     0,   669,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   667,
+       0,     0,     0,     0,   673,   674,   675,     0,   676,   677,
+     678,   679,   680,   681,   682,   670,   668,  1781,     0,     0,
+       0,     0,     0,     0,     0,   669,     0,     0,     0,     0,
+       0,   671,   667,   672,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   667,     0,   668,
+       0,   670,     0,     0,     0,     0,     0,     0,   669,     0,
+       0,     0,     0,     0,   668,     0,     0,   671,     0,   672,
+       0,     0,     0,   669,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   670,     0,     0,     0,   673,   674,
+     675,     0,   676,   677,   678,   679,   680,   681,   682,   670,
+     671,  1782,   672,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   671,     0,   672,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   673,   674,   675,     0,   676,   677,
+     678,   679,   680,   681,   682,     0,     0,  1877,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     673,   674,   675,     0,   676,   677,   678,   679,   680,   681,
+     682,     0,     0,  1910,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   673,   674,   675,     0,   676,   677,   678,
+     679,   680,   681,   682,     0,     0,  2039,     0,   673,   674,
+     675,   728,   676,   677,   678,   679,   680,   681,   682,     0,
+       0,  2078,     0,     0,   729,   730,   731,   101,   102,   103,
+     732,   104,   733,   734,   735,   736,   352,   105,   106,   107,
+     108,   737,   109,   110,   111,   112,   113,   114,     0,   738,
+     115,   116,   117,     0,   118,   119,   120,   739,   740,   741,
+     121,   742,   353,   122,   123,   124,   743,   744,   125,   745,
+     126,   127,   128,   129,     0,   746,   130,   747,   354,     0,
+     748,     0,  1116,   131,   355,   132,   133,   134,   135,   136,
+     137,     0,   138,   139,   749,   750,   751,   752,   753,     0,
+     140,   141,   754,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   755,   151,   152,   153,   154,     0,     0,   155,
+     156,   157,   158,   159,   160,   756,   757,   161,   758,   759,
+     760,   356,   162,   761,     0,   762,   763,     0,   764,   163,
+     765,   766,   767,   164,   768,   769,   165,   770,   166,   167,
+     168,   357,   169,   170,   771,   772,     0,   171,   773,   172,
+     358,   173,     0,     0,   359,   774,   174,   775,   175,     0,
+     776,   176,   177,   178,   777,   778,   179,   779,   780,   781,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+    1117,   782,   783,   784,   785,   786,     0,   190,   191,   192,
+     193,   194,   787,   195,   788,   196,   789,   790,   791,   197,
+     792,   793,   794,   360,   198,   199,   200,   201,   795,   202,
+     203,   796,   204,   797,   205,   206,   207,   208,   209,   798,
+     210,   211,     0,   212,   213,   214,   215,   799,   216,   217,
+     218,   219,   800,   220,   361,   221,   222,   801,   802,   803,
+     804,   805,   223,   224,   225,   226,   227,   806,   228,   807,
+       0,   808,   230,   231,   809,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   810,   242,   811,   812,   813,
+       0,   814,   243,   244,   245,   815,   275,   247,   816,     0,
+     276,     0,     0,   249,   817,   818,   250,   251,   252,   819,
+     253,   820,   821,   822,   823,   824,   254,   255,   256,   825,
+     826,   257,   827,   258,   259,   260,   261,   828,   829,   830,
+     262,   263,   264,   265,   266,   267,   728,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   831,   729,
+     730,   731,   101,   102,   103,   732,   104,   733,   734,   735,
+     736,   352,   105,   106,   107,   108,   737,   109,   110,   111,
+     112,   113,   114,     0,   738,   115,   116,   117,     0,   118,
+     119,   120,   739,   740,   741,   121,   742,   353,   122,   123,
+     124,   743,   744,   125,   745,   126,   127,   128,   129,     0,
+     746,   130,   747,   354,     0,   748,     0,  1407,   131,   355,
+     132,   133,   134,   135,   136,   137,     0,   138,   139,   749,
+     750,   751,   752,   753,     0,   140,   141,   754,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   755,   151,   152,
+     153,   154,     0,     0,   155,   156,   157,   158,   159,   160,
+     756,   757,   161,   758,   759,   760,   356,   162,   761,     0,
+     762,   763,     0,   764,   163,   765,   766,   767,   164,   768,
+     769,   165,   770,   166,   167,   168,   357,   169,   170,   771,
+     772,     0,   171,   773,   172,   358,   173,     0,     0,   359,
+     774,   174,   775,   175,     0,   776,   176,   177,   178,   777,
+     778,   179,   779,   780,   781,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,  1408,   782,   783,   784,   785,
+     786,     0,   190,   191,   192,   193,   194,   787,   195,   788,
+     196,   789,   790,   791,   197,   792,   793,   794,   360,   198,
+     199,   200,   201,   795,   202,   203,   796,   204,   797,   205,
+     206,   207,   208,   209,   798,   210,   211,     0,   212,   213,
+     214,   215,   799,   216,   217,   218,   219,   800,   220,   361,
+     221,   222,   801,   802,   803,   804,   805,   223,   224,   225,
+     226,   227,   806,   228,   807,     0,   808,   230,   231,   809,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     810,   242,   811,   812,   813,     0,   814,   243,   244,   245,
+     815,   275,   247,   816,     0,   276,     0,     0,   249,   817,
+     818,   250,   251,   252,   819,   253,   820,   821,   822,   823,
+     824,   254,   255,   256,   825,   826,   257,   827,   258,   259,
+     260,   261,   828,   829,   830,   262,   263,   264,   265,   266,
+     267,   728,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   831,   729,   730,   731,   101,   102,   103,
+     732,   104,   733,   734,   735,   736,   352,   105,   106,   107,
+     108,   737,   109,   110,   111,   112,   113,   114,     0,   738,
+     115,   116,   117,     0,   118,   119,   120,   739,   740,   741,
+     121,   742,   353,   122,   123,   124,   743,   744,   125,   745,
+     126,   127,   128,   129,     0,   746,   130,   747,   354,     0,
+     748,     0,     0,   131,   355,   132,   133,   134,   135,   136,
+     137,     0,   138,   139,   749,   750,   751,   752,   753,     0,
+     140,   141,   754,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   755,   151,   152,   153,   154,     0,     0,   155,
+     156,   157,   158,   159,   160,   756,   757,   161,   758,   759,
+     760,   356,   162,   761,     0,   762,   763,     0,   764,   163,
+     765,   766,   767,   164,   768,   769,   165,   770,   166,   167,
+     168,   357,   169,   170,   771,   772,     0,   171,   773,   172,
+     358,   173,     0,     0,   359,   774,   174,   775,   175,     0,
+     776,   176,   177,   178,   777,   778,   179,   779,   780,   781,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,   782,   783,   784,   785,   786,     0,   190,   191,   192,
+     193,   194,   787,   195,   788,   196,   789,   790,   791,   197,
+     792,   793,   794,   360,   198,   199,   200,   201,   795,   202,
+     203,   796,   204,   797,   205,   206,   207,   208,   209,   798,
+     210,   211,     0,   212,   213,   214,   215,   799,   216,   217,
+     218,   219,   800,   220,   361,   221,   222,   801,   802,   803,
+     804,   805,   223,   224,   225,   226,   227,   806,   228,   807,
+       0,   808,   230,   231,   809,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   810,   242,   811,   812,   813,
+       0,   814,   243,   244,   245,   815,   275,   247,   816,     0,
+     276,     0,     0,   249,   817,   818,   250,   251,   252,   819,
+     253,   820,   821,   822,   823,   824,   254,   255,   256,   825,
+     826,   257,   827,   258,   259,   260,   261,   828,   829,   830,
+     262,   263,   264,   265,   266,   267,   351,   608,   343,     0,
+       0,     0,   400,     0,     0,     0,     0,     0,   831,     0,
+       0,     0,   101,   102,   103,     0,   104,     0,     0,     0,
+       0,   352,   105,   106,   107,   108,     0,   109,   110,   111,
+     112,   113,   114,     0,     0,   115,   116,   117,     0,   118,
+     119,   120,     0,     0,     0,   121,     0,   353,   122,   123,
+     124,     0,     0,   125,     0,   126,   127,   128,   129,     0,
+       0,   130,     0,   354,     0,     0,     0,     0,   131,   355,
+     132,   133,   134,   135,   136,   137,     0,   138,   139,   715,
+       0,     0,     0,     0,     0,   140,   141,     0,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,     0,   151,   152,
+     153,   154,     0,     0,   155,   156,   157,   158,   159,   160,
+     609,     0,   161,     0,     0,     0,   356,   162,     0,     0,
+       0,     0,     0,     0,   163,     0,     0,     0,   164,     0,
+       0,   165,     0,   166,   167,   168,   357,   169,   170,     0,
+       0,     0,   171,     0,   172,   358,   173,     0,     0,   359,
+       0,   174,     0,   175,     0,     0,   176,   177,   178,     0,
+       0,   179,     0,     0,     0,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,     0,     0,     0,     0,     0,
+       0,     0,   190,   191,   192,   193,   194,     0,   195,     0,
+     196,   610,     0,     0,   197,     0,     0,     0,   360,   198,
+     199,   200,   201,     0,   202,   203,     0,   204,     0,   205,
+     206,   207,   208,   209,     0,   210,   211,     0,   212,   213,
+     214,   215,     0,   216,   217,   218,   219,     0,   220,   361,
+     221,   222,     0,     0,     0,     0,     0,   223,   224,   225,
+     226,   227,     0,   228,     0,     0,     0,   230,   231,     0,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+       0,   242,     0,     0,     0,     0,     0,   243,   244,   245,
+       0,   275,   247,     0,     0,   276,     0,     0,   249,     0,
+     611,   250,   251,   252,     0,   253,     0,     0,     0,     0,
+       0,   254,   255,   256,     0,     0,   257,     0,   258,   259,
+     260,   261,     0,     0,     0,   262,   263,   264,   265,   266,
+     267,   351,   608,   343,     0,     0,     0,   400,     0,     0,
+       0,   612,   613,     0,     0,     0,     0,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,   352,   105,   106,   107,
+     108,     0,   109,   110,   111,   112,   113,   114,     0,     0,
+     115,   116,   117,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,   353,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,     0,     0,   130,     0,   354,     0,
+       0,     0,     0,   131,   355,   132,   133,   134,   135,   136,
+     137,     0,   138,   139,   720,     0,     0,     0,     0,     0,
+     140,   141,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   154,     0,     0,   155,
+     156,   157,   158,   159,   160,   609,     0,   161,     0,     0,
+       0,   356,   162,     0,     0,     0,     0,     0,     0,   163,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,   357,   169,   170,     0,     0,     0,   171,     0,   172,
+     358,   173,     0,     0,   359,     0,   174,     0,   175,     0,
+       0,   176,   177,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,     0,     0,     0,     0,     0,     0,   190,   191,   192,
+     193,   194,     0,   195,     0,   196,   610,     0,     0,   197,
+       0,     0,     0,   360,   198,   199,   200,   201,     0,   202,
+     203,     0,   204,     0,   205,   206,   207,   208,   209,     0,
+     210,   211,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,   361,   221,   222,     0,     0,     0,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+       0,     0,   230,   231,     0,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,     0,   242,     0,     0,     0,
+       0,     0,   243,   244,   245,     0,   275,   247,     0,     0,
+     276,     0,     0,   249,     0,   611,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+       0,   257,     0,   258,   259,   260,   261,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,   351,   608,   343,     0,
+       0,     0,   400,     0,     0,     0,   612,   613,     0,     0,
+       0,     0,   101,   102,   103,     0,   104,     0,     0,     0,
+       0,   352,   105,   106,   107,   108,     0,   109,   110,   111,
+     112,   113,   114,     0,     0,   115,   116,   117,     0,   118,
+     119,   120,     0,     0,     0,   121,     0,   353,   122,   123,
+     124,     0,     0,   125,     0,   126,   127,   128,   129,     0,
+       0,   130,     0,   354,     0,     0,     0,     0,   131,   355,
+     132,   133,   134,   135,   136,   137,     0,   138,   139,     0,
+       0,     0,     0,     0,     0,   140,   141,     0,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,     0,   151,   152,
+     153,   154,     0,     0,   155,   156,   157,   158,   159,   160,
+     609,     0,   161,     0,     0,     0,   356,   162,     0,     0,
+       0,     0,     0,     0,   163,     0,     0,     0,   164,     0,
+       0,   165,     0,   166,   167,   168,   357,   169,   170,     0,
+       0,     0,   171,     0,   172,   358,   173,     0,     0,   359,
+       0,   174,     0,   175,     0,     0,   176,   177,   178,     0,
+       0,   179,     0,     0,     0,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,     0,     0,     0,     0,     0,
+       0,     0,   190,   191,   192,   193,   194,     0,   195,   662,
+     196,   610,   663,     0,   197,     0,     0,     0,   360,   198,
+     199,   200,   201,   664,   202,   203,     0,   204,     0,   205,
+     206,   207,   208,   209,   666,   210,   211,     0,   212,   213,
+     214,   215,     0,   216,   217,   218,   219,     0,   220,   361,
+     221,   222,     0,     0,     0,     0,     0,   223,   224,   225,
+     226,   227,     0,   228,     0,     0,     0,   230,   231,     0,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+       0,   242,     0,     0,     0,     0,     0,   243,   244,   245,
+     662,   275,   247,   663,     0,   276,     0,     0,   249,     0,
+     611,   250,   251,   252,   664,   253,     0,     0,  1173,     0,
+       0,   254,   255,   256,     0,   666,   257,     0,   258,   259,
+     260,   261,     0,     0,     0,   262,   263,   264,   265,   266,
+     267,     0,     0,     0,   667,     0,     0,     0,     0,     0,
+       0,   612,   613,     0,   662,     0,     0,   663,     0,     0,
+       0,   668,     0,     0,     0,     0,     0,     0,   664,   662,
+     669,  1340,   663,     0,     0,     0,     0,     0,     0,   666,
+       0,  1174,     0,   664,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   666,     0,   670,     0,     0,     0,
+       0,     0,     0,     0,   543,     0,   544,     0,   662,     0,
+       0,   663,   671,     0,   672,     0,     0,     0,     0,     0,
+       0,     0,   664,     0,     0,   667,     0,     0,     0,     0,
+       0,     0,     0,   666,     0,   662,     0,   545,   663,     0,
+       0,     0,   668,     0,     0,     0,     0,     0,     0,   664,
+       0,   669,     0,     0,     0,     0,     0,     0,     0,     0,
+     666,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   546,     0,   670,     0,   667,
+       0,   547,  1345,     0,     0,   548,   549,     0,  1317,     0,
+       0,     0,     0,   671,   667,   672,   668,     0,   550,     0,
+       0,     0,     0,     0,     0,   669,     0,     0,     0,     0,
+       0,   668,     0,     0,     0,     0,     0,     0,     0,     0,
+     669,     0,     0,     0,     0,   551,     0,     0,     0,     0,
+       0,   670,     0,   667,     0,   673,   674,   675,     0,   676,
+     677,   678,   679,   680,   681,   682,   670,   671,     0,   672,
+     668,     0,     0,     0,     0,     0,     0,     0,   552,   669,
+     667,     0,   671,     0,   672,     0,     0,     0,     0,     0,
+       0,     0,   553,     0,     0,     0,     0,   668,     0,   554,
+       0,   555,     0,     0,     0,   670,   669,     0,     0,     0,
+       0,     0,     0,   556,     0,   557,     0,     0,     0,     0,
+       0,   671,     0,   672,     0,     0,     0,     0,     0,     0,
+       0,     0,   670,     0,     0,   559,   673,   674,   675,     0,
+     676,   677,   678,   679,   680,   681,   682,     0,   671,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     560,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   561,     0,     0,
+     673,   674,   675,     0,   676,   677,   678,   679,   680,   681,
+     682,     0,     0,     0,     0,   673,   674,   675,   562,   676,
+     677,   678,   679,   680,   681,   682,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   673,   674,   675,     0,   676,   677,
+     678,   679,   680,   681,   682,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   728,
+       0,   673,   674,   675,     0,   676,   677,   678,   679,   680,
+     681,   682,   729,   730,   731,   101,   102,   103,   732,   104,
+     733,   734,   735,   736,   352,   105,   106,   107,   108,   737,
+     109,   110,   111,   112,   113,   114,     0,   738,   115,   116,
+     117,     0,   118,   119,   120,   739,   740,   741,   121,   742,
+     353,   122,   123,   124,   743,   744,   125,   745,   126,   127,
+     128,   129,     0,   746,   130,   747,   354,     0,   748,     0,
+       0,   131,   355,   132,   133,   134,   135,   136,   137,     0,
+     138,   139,   749,   750,   751,   752,   753,     0,   140,   141,
+     754,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     755,   151,   152,   153,   154,     0,     0,   155,   156,   157,
+     158,   159,   160,   756,   757,   161,   758,   759,   760,   356,
+     162,   761,     0,   762,   763,     0,   764,   163,   765,   766,
+     767,   164,   768,   769,   165,   770,   166,   167,   168,   357,
+     169,   170,   771,   772,     0,   171,   773,   172,   358,   173,
+       0,     0,   359,   774,   174,   775,   175,     0,   776,   176,
+     177,   178,   777,   778,   179,   779,   780,   781,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,   782,
+     783,   784,   785,   786,     0,   190,   191,   192,   193,   194,
+     787,   195,   788,   196,   789,   790,   791,   197,   792,   793,
+     794,   360,   198,   199,   200,   201,   795,   202,   203,   796,
+     204,   797,   205,   206,   207,   208,   209,   798,   210,   211,
+       0,   212,   213,   214,   215,   799,   216,   217,   218,   219,
+     800,   220,   361,   221,   222,   801,   802,   803,   804,   805,
+     223,   224,   225,   226,   227,   806,   228,   807,     0,   808,
+     230,   231,   809,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   810,   242,   811,   812,   813,     0,   814,
+     243,   244,   245,   815,   275,   247,   816,     0,   276,     0,
+       0,   249,   817,   818,   250,   251,   252,   819,   253,   820,
+     821,   822,   823,   824,   254,   255,   256,   825,   826,   257,
+     827,   258,   259,   260,   261,   828,   829,   830,   262,   263,
+     264,   265,   266,   267,   728,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   729,  1231,   731,
+     101,   102,   103,   732,   104,   733,   734,   735,   736,   352,
+     105,   106,   107,   108,   737,   109,   110,   111,   112,   113,
+     114,     0,   738,   115,   116,   117,     0,   118,   119,   120,
+     739,   740,   741,   121,   742,   353,   122,   123,   124,   743,
+     744,   125,   745,   126,   127,   128,   129,     0,   746,   130,
+     747,   354,     0,   748,     0,     0,   131,   355,   132,   133,
+     134,   135,   136,   137,     0,   138,   139,   749,   750,   751,
+     752,   753,     0,   140,   141,  1232,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   755,   151,   152,   153,   154,
+       0,     0,   155,   156,   157,   158,   159,   160,   756,   757,
+     161,   758,   759,   760,   356,   162,   761,     0,   762,   763,
+       0,   764,   163,   765,   766,   767,   164,   768,   769,   165,
+     770,   166,   167,   168,   357,   169,   170,   771,   772,     0,
+     171,   773,   172,   358,   173,     0,     0,   359,   774,   174,
+     775,   175,     0,   776,   176,   177,   178,   777,   778,   179,
+     779,   780,   781,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,     0,   782,   783,   784,   785,   786,     0,
+     190,   191,   192,   193,   194,   787,   195,   788,   196,   789,
+     790,   791,   197,   792,   793,   794,   360,   198,   199,   200,
+     201,   795,   202,   203,   796,   204,   797,   205,   206,   207,
+     208,   209,   798,   210,   211,     0,   212,   213,   214,   215,
+     799,   216,   217,   218,   219,   800,   220,   361,   221,   222,
+     801,   802,   803,   804,   805,   223,   224,   225,   226,   227,
+     806,   228,   807,     0,  1233,   230,   231,   809,   232,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,   810,   242,
+     811,   812,   813,     0,   814,   243,   244,   245,   815,   275,
+     247,   816,     0,   276,     0,     0,   249,   817,   818,   250,
+     251,   252,   819,   253,   820,   821,   822,   823,   824,   254,
+     255,   256,   825,   826,   257,   827,   258,   259,   260,   261,
+     828,   829,   830,   262,   263,   264,   265,   266,   267,   351,
+       0,   343,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   101,   102,   103,     0,   104,
+       0,     0,     0,     0,   352,   105,   106,   107,   108,     0,
+     109,   110,   111,   112,   113,   114,     0,     0,   115,   116,
+     117,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+     353,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,     0,     0,   130,     0,   354,     0,     0,     0,
+       0,   131,   355,   132,   133,   134,   135,   136,   137,     0,
+     138,   139,   700,     0,     0,     0,     0,     0,   140,   141,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,   151,   152,   153,   154,     0,     0,   155,   156,   157,
+     158,   159,   160,     0,     0,   161,     0,     0,     0,   356,
+     162,     0,     0,     0,     0,     0,     0,   163,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,   357,
+     169,   170,     0,     0,     0,   171,     0,   172,   358,   173,
+       0,     0,   359,     0,   174,     0,   175,     0,     0,   176,
+     177,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,     0,
+       0,     0,     0,     0,     0,   190,   191,   192,   193,   194,
+       0,   195,     0,   196,     0,     0,     0,   197,     0,     0,
+       0,   360,   198,   199,   200,   201,     0,   202,   203,     0,
+     204,     0,   205,   206,   207,   208,   209,     0,   210,   211,
+       0,   212,   213,   214,   215,     0,   216,   217,   218,   219,
+       0,   220,   361,   221,   222,     0,     0,     0,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,     0,     0,
+     230,   231,     0,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,     0,   242,     0,     0,     0,     0,     0,
+     243,   244,   245,     0,   275,   247,     0,     0,   276,     0,
+       0,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,   351,   257,
+     343,   258,   259,   260,   261,     0,     0,     0,   262,   263,
+     264,   265,   266,   267,   101,   102,   103,     0,   104,     0,
+       0,     0,     0,   352,   105,   106,   107,   108,     0,   109,
+     110,   111,   112,   113,   114,     0,     0,   115,   116,   117,
+       0,   118,   119,   120,     0,     0,     0,   121,     0,   353,
+     122,   123,   124,     0,     0,   125,     0,   126,   127,   128,
+     129,     0,     0,   130,     0,   354,     0,     0,     0,     0,
+     131,   355,   132,   133,   134,   135,   136,   137,     0,   138,
+     139,     0,     0,     0,     0,     0,     0,   140,   141,     0,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,     0,
+     151,   152,   153,   154,     0,     0,   155,   156,   157,   158,
+     159,   160,     0,     0,   161,     0,     0,     0,   356,   162,
+       0,     0,     0,     0,     0,     0,   163,     0,     0,     0,
+     164,     0,     0,   165,     0,   166,   167,   168,   357,   169,
+     170,     0,     0,     0,   171,     0,   172,   358,   173,     0,
+       0,   359,     0,   174,     0,   175,     0,     0,   176,   177,
+     178,     0,     0,   179,     0,     0,     0,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,     0,     0,     0,
+       0,     0,     0,     0,   190,   191,   192,   193,   194,     0,
+     195,     0,   196,     0,     0,     0,   197,     0,     0,     0,
+     360,   198,   199,   200,   201,     0,   202,   203,     0,   204,
+       0,   205,   206,   207,   208,   209,     0,   210,   211,     0,
+     212,   213,   214,   215,     0,   216,   217,   218,   219,     0,
+     220,   361,   221,   222,     0,     0,     0,     0,     0,   223,
+     224,   225,   226,   227,     0,   228,     0,     0,     0,   230,
+     231,     0,   232,   233,   234,   235,   236,   237,   238,   239,
+     240,   241,     0,   242,     0,     0,     0,     0,     0,   243,
+     244,   245,     0,   275,   247,     0,     0,   276,     0,     0,
+     249,     0,     0,   250,   251,   252,     0,   253,     0,     0,
+       0,     0,     0,   254,   255,   256,     0,  1216,   257,     0,
+     258,   259,   260,   261,     0,     0,     0,   262,   263,   264,
+     265,   266,   267,   101,   102,   103,     0,   104,     0,     0,
+       0,     0,   352,   105,   106,   107,   108,     0,   109,   110,
+     111,   112,   113,   114,     0,     0,   115,   116,   117,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,   353,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+       0,     0,   130,     0,   354,     0,     0,     0,     0,   131,
+     355,   132,   133,   134,   135,   136,   137,     0,   138,   139,
+       0,     0,     0,     0,     0,     0,   140,   141,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,   151,
+     152,   153,   154,     0,     0,   155,   156,   157,   158,   159,
+     160,     0,     0,   161,     0,     0,     0,   356,   162,     0,
+       0,     0,     0,     0,     0,   163,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,   357,   169,   170,
+       0,     0,     0,   171,     0,   172,   358,   173,     0,     0,
+     359,     0,   174,     0,   175,     0,     0,   176,   177,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,     0,     0,     0,     0,
+       0,     0,     0,   190,   191,   192,   193,   194,     0,   195,
+       0,   196,     0,     0,     0,   197,     0,     0,     0,   360,
+     198,   199,   200,   201,     0,   202,   203,     0,   204,   435,
+     205,   206,   207,   208,   209,     0,   210,   211,     0,   212,
+     213,   214,   215,     0,   216,   217,   218,   219,     0,   220,
+     361,   221,   222,     0,     0,     0,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,     0,     0,   230,   231,
+       0,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,     0,   242,     0,     0,     0,     0,     0,   243,   244,
+     245,     0,   275,   247,     0,     0,   276,     0,     0,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,   351,   257,     0,   258,
+     259,   260,   261,     0,     0,     0,   262,   263,   264,   265,
+     266,   267,   101,   102,   103,     0,   104,     0,     0,     0,
+       0,   352,   105,   106,   107,   108,     0,   109,   110,   111,
+     112,   113,   114,     0,     0,   115,   116,   117,     0,   118,
+     119,   120,     0,     0,     0,   121,     0,   353,   122,   123,
+     124,     0,     0,   125,     0,   126,   127,   128,   129,     0,
+       0,   130,     0,   354,     0,     0,     0,     0,   131,   355,
+     132,   133,   134,   135,   136,   137,     0,   138,   139,     0,
+       0,     0,     0,     0,     0,   140,   141,     0,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,     0,   151,   152,
+     153,   154,     0,     0,   155,   156,   157,   158,   159,   160,
+       0,     0,   161,     0,     0,     0,   356,   162,     0,     0,
+       0,     0,     0,     0,   163,     0,     0,     0,   164,     0,
+       0,   165,     0,   166,   167,   168,   357,   169,   170,     0,
+       0,     0,   171,     0,   172,   358,   173,     0,     0,   359,
+       0,   174,     0,   175,     0,     0,   176,   177,   178,     0,
+       0,   179,     0,     0,     0,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,     0,     0,     0,     0,     0,
+       0,     0,   190,   191,   192,   193,   194,     0,   195,     0,
+     196,     0,     0,     0,   197,     0,     0,     0,   360,   198,
+     199,   200,   201,     0,   202,   203,     0,   204,     0,   205,
+     206,   207,   208,   209,     0,   210,   211,     0,   212,   213,
+     214,   215,     0,   216,   217,   218,   219,     0,   220,   361,
+     221,   222,     0,     0,     0,     0,     0,   223,   224,   225,
+     226,   227,     0,   228,     0,     0,     0,   230,   231,     0,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+       0,   242,     0,     0,     0,     0,     0,   243,   244,   245,
+       0,   275,   247,     0,     0,   276,     0,     0,   249,     0,
+       0,   250,   251,   252,     0,   253,     0,     0,     0,     0,
+       0,   254,   255,   256,     0,    99,   257,     0,   258,   259,
+     260,   261,     0,     0,     0,   262,   263,   264,   265,   266,
+     267,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+       0,   105,   106,   107,   108,     0,   109,   110,   111,   112,
+     113,   114,     0,     0,   115,   116,   117,     0,   118,   119,
+     120,   884,     0,     0,   121,     0,     0,   122,   123,   124,
+       0,     0,   125,   886,   126,   127,   128,   129,     0,     0,
+     130,     0,     0,     0,     0,     0,     0,   131,     0,   132,
+     133,   134,   135,   136,   137,     0,   138,   139,     0,     0,
+       0,     0,     0,     0,   140,   141,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     154,     0,     0,   155,  1297,   157,   158,   159,   160,     0,
+       0,   161,     0,     0,   888,     0,   162,     0,     0,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,     0,   169,   170,     0,     0,
+       0,   171,     0,   172,     0,   173,     0,     0,     0,     0,
+     174,  1298,   175,     0,     0,   176,   177,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,     0,     0,     0,     0,     0,
+       0,   190,   191,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   197,     0,     0,     0,     0,   198,   199,
+     200,   201,     0,   202,   203,     0,   204,     0,   205,   206,
+    1299,   208,   209,     0,   210,   211,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,     0,   221,
+     222,     0,     0,     0,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,     0,     0,   230,   231,     0,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,     0,     0,     0,   243,   244,   245,     0,
+     275,   247,     0,     0,   276,     0,     0,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,   891,     0,     0,     0,
+     254,   255,   256,     0,    99,   257,     0,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+     101,   102,   103,     0,   104,     0,     0,     0,     0,     0,
+     105,   106,   107,   108,     0,   109,   110,   111,   112,   113,
+     114,     0,     0,   115,   116,   117,     0,   118,   119,   120,
+     884,     0,     0,   121,     0,     0,   122,   123,   124,     0,
+       0,   125,   886,   126,   127,   128,   129,     0,     0,   130,
+       0,     0,     0,     0,     0,     0,   131,     0,   132,   133,
+     134,   135,   136,   137,     0,   138,   139,     0,     0,     0,
+       0,     0,     0,   140,   141,     0,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,     0,   151,   152,   153,   154,
+       0,     0,   155,  1297,   157,   158,   159,   160,     0,     0,
+     161,     0,     0,   888,     0,   162,     0,     0,     0,     0,
+       0,     0,   163,     0,     0,     0,   164,     0,     0,   165,
+       0,   166,   167,   168,     0,   169,   170,     0,     0,     0,
+     171,     0,   172,     0,   173,     0,     0,     0,     0,   174,
+       0,   175,     0,     0,   176,   177,   178,     0,     0,   179,
+       0,     0,     0,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,     0,     0,     0,     0,     0,     0,     0,
+     190,   191,   192,   193,   194,     0,   195,     0,   196,     0,
+       0,     0,   197,     0,     0,     0,     0,   198,   199,   200,
+     201,     0,   202,   203,     0,   204,     0,   205,   206,  1299,
+     208,   209,     0,   210,   211,     0,   212,   213,   214,   215,
+       0,   216,   217,   218,   219,     0,   220,     0,   221,   222,
+       0,     0,     0,     0,     0,   223,   224,   225,   226,   227,
+       0,   228,     0,     0,     0,   230,   231,     0,   232,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,     0,   242,
+       0,     0,     0,     0,     0,   243,   244,   245,     0,   275,
+     247,     0,     0,   276,     0,     0,   249,     0,     0,   250,
+     251,   252,     0,   253,     0,   891,     0,     0,     0,   254,
+     255,   256,     0,     0,   257,    99,   258,   259,   260,   261,
+       0,     0,     0,   262,   263,   264,   265,   266,   267,     0,
+     100,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+       0,   105,   106,   107,   108,     0,   109,   110,   111,   112,
+     113,   114,     0,     0,   115,   116,   117,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,     0,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,     0,     0,
+     130,     0,     0,     0,     0,     0,     0,   131,     0,   132,
+     133,   134,   135,   136,   137,     0,   138,   139,     0,     0,
+       0,     0,     0,     0,   140,   141,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     154,     0,     0,   155,   156,   157,   158,   159,   160,     0,
+       0,   161,     0,     0,     0,     0,   162,     0,     0,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,     0,   169,   170,     0,     0,
+       0,   171,     0,   172,     0,   173,     0,     0,     0,     0,
+     174,     0,   175,     0,     0,   176,   177,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,     0,     0,     0,     0,     0,
+       0,   190,   191,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   197,     0,     0,     0,     0,   198,   199,
+     200,   201,     0,   202,   203,     0,   204,     0,   205,   206,
+     207,   208,   209,     0,   210,   211,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,     0,   221,
+     222,     0,     0,     0,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,   229,     0,     0,   230,   231,     0,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,     0,     0,     0,   243,   244,   245,     0,
+     246,   247,     0,     0,   248,     0,     0,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,     0,
+     254,   255,   256,     0,     0,   257,    99,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+       0,   293,   101,   102,   103,     0,   104,     0,     0,     0,
+       0,     0,   105,   106,   107,   108,     0,   109,   110,   111,
+     112,   113,   114,     0,     0,   115,   116,   117,     0,   118,
+     119,   120,     0,     0,     0,   121,     0,     0,   122,   123,
+     124,     0,     0,   125,     0,   126,   127,   128,   129,     0,
+       0,   130,     0,     0,     0,     0,     0,     0,   131,     0,
+     132,   133,   134,   135,   136,   137,     0,   138,   139,     0,
+       0,     0,     0,     0,     0,   140,   141,     0,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,     0,   151,   152,
+     153,   154,     0,     0,   155,   156,   157,   158,   159,   160,
+       0,     0,   161,     0,     0,     0,     0,   162,     0,     0,
+       0,     0,     0,     0,   163,     0,     0,     0,   164,     0,
+       0,   165,     0,   166,   167,   168,     0,   169,   170,     0,
+       0,     0,   171,     0,   172,     0,   173,     0,     0,     0,
+       0,   174,     0,   175,     0,     0,   176,   177,   178,     0,
+       0,   179,     0,     0,     0,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,     0,     0,     0,     0,     0,
+       0,     0,   190,   191,   192,   193,   194,     0,   195,     0,
+     196,     0,     0,     0,   197,     0,     0,     0,     0,   198,
+     199,   200,   201,     0,   202,   203,     0,   204,     0,   205,
+     206,   207,   208,   209,     0,   210,   211,     0,   212,   213,
+     214,   215,     0,   216,   217,   218,   219,     0,   220,     0,
+     221,   222,     0,     0,     0,     0,     0,   223,   224,   225,
+     226,   227,     0,   228,   294,     0,     0,   230,   231,     0,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+       0,   242,     0,     0,     0,     0,     0,   243,   244,   245,
+       0,   295,   247,     0,     0,   296,     0,     0,   249,     0,
+       0,   250,   251,   252,     0,   253,     0,     0,     0,     0,
+       0,   254,   255,   256,     0,    99,   257,     0,   258,   259,
+     260,   261,     0,     0,     0,   262,   263,   264,   265,   266,
+     267,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+       0,   105,   106,   107,   108,     0,   109,   110,   111,   112,
+     113,   114,     0,     0,   115,   116,   117,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,     0,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,     0,     0,
+     130,     0,     0,     0,     0,     0,     0,   131,     0,   132,
+     133,   134,   135,   136,   137,     0,   138,   139,     0,     0,
+       0,     0,     0,     0,   140,   141,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     154,     0,     0,   155,   156,   157,   158,   159,   160,     0,
+       0,   161,     0,     0,     0,     0,   162,     0,     0,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,     0,   169,   170,     0,     0,
+       0,   171,     0,   172,     0,   173,     0,     0,     0,     0,
+     174,     0,   175,     0,     0,   176,   177,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,     0,     0,     0,     0,     0,
+       0,   190,   191,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,   301,   197,     0,     0,     0,     0,   198,   199,
+     200,   201,     0,   202,   203,     0,   204,   302,   205,   206,
+     207,   208,   209,     0,   210,   211,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,     0,   221,
+     222,     0,     0,     0,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,     0,     0,   230,   231,     0,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,     0,     0,     0,   243,   244,   245,     0,
+     275,   247,     0,     0,   276,     0,     0,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,     0,
+     254,   255,   256,     0,    99,   257,     0,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+     101,   102,   103,     0,   104,     0,     0,     0,     0,     0,
+     105,   106,   107,   108,     0,   109,   110,   111,   112,   113,
+     114,     0,     0,   115,   116,   117,     0,   118,   119,   120,
+       0,     0,     0,   121,     0,     0,   122,   123,   124,     0,
+       0,   125,     0,   126,   127,   128,   129,     0,     0,   130,
+       0,     0,     0,     0,     0,     0,   131,     0,   132,   133,
+     134,   135,   136,   137,     0,   138,   139,     0,     0,     0,
+       0,     0,     0,   140,   141,     0,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,     0,   151,   152,   153,   154,
+       0,     0,   155,   156,   157,   158,   159,   160,     0,     0,
+     161,     0,     0,     0,     0,   162,     0,     0,     0,     0,
+       0,     0,   332,     0,     0,     0,   164,     0,     0,   165,
+       0,   166,   167,   168,     0,   169,   170,     0,     0,     0,
+     171,     0,   172,     0,   173,     0,     0,     0,     0,   174,
+       0,   175,     0,     0,   176,   177,   178,     0,     0,   179,
+       0,     0,     0,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,     0,     0,     0,     0,     0,     0,     0,
+     190,   191,   192,   193,   194,     0,   195,     0,   196,     0,
+       0,   301,   197,     0,     0,     0,     0,   198,   199,   200,
+     201,     0,   202,   203,     0,   204,   302,   205,   206,   207,
+     208,   209,     0,   210,   211,     0,   212,   213,   214,   215,
+       0,   216,   217,   218,   219,     0,   220,     0,   221,   222,
+       0,     0,     0,     0,     0,   223,   224,   225,   226,   227,
+       0,   228,     0,     0,     0,   230,   231,     0,   232,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,     0,   242,
+       0,     0,     0,     0,     0,   243,   244,   245,     0,   275,
+     247,     0,     0,   276,     0,     0,   249,     0,     0,   250,
+     251,   252,     0,   253,     0,     0,     0,     0,     0,   254,
+     255,   256,     0,    99,   257,     0,   258,   259,   260,   261,
+       0,     0,     0,   262,   263,   264,   265,   266,   267,   101,
+     102,   103,     0,   104,     0,     0,     0,     0,   482,   105,
+     106,   107,   108,     0,   109,   110,   111,   112,   113,   114,
+       0,     0,   115,   116,   117,     0,   281,   119,   483,     0,
+       0,     0,   121,     0,     0,   122,   123,   124,     0,     0,
+     125,     0,   126,   127,   128,   129,     0,     0,   130,     0,
+       0,     0,     0,     0,     0,   131,     0,   132,   133,   134,
+     135,   136,   137,     0,   138,   139,     0,     0,     0,     0,
+       0,     0,   140,   141,     0,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,     0,   151,   152,   153,   154,     0,
+       0,   155,   156,   157,   158,   159,   160,     0,     0,   161,
+       0,     0,     0,     0,   162,     0,     0,     0,     0,     0,
+       0,   163,     0,     0,     0,   164,     0,     0,   165,     0,
+     166,   167,   168,     0,   169,   170,     0,     0,     0,   171,
+       0,   172,     0,   173,     0,     0,     0,     0,   174,     0,
+     175,     0,     0,   176,   177,   178,     0,     0,   179,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   283,   187,
+     188,   189,     0,     0,     0,     0,     0,     0,     0,   190,
+     191,   192,   193,   194,     0,   195,     0,   196,     0,     0,
+       0,   197,     0,     0,     0,     0,   198,   199,   200,   201,
+       0,   202,   203,     0,   204,     0,   205,   206,   207,   208,
+     209,     0,   210,   211,     0,   212,   213,   214,   215,     0,
+     216,   217,   218,   219,     0,   220,     0,   284,   222,     0,
+       0,     0,     0,     0,   223,   224,   225,   285,   227,     0,
+     228,   473,     0,     0,   230,   231,     0,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,     0,   242,     0,
+       0,     0,     0,     0,   243,   244,   245,     0,   287,   247,
+       0,     0,   288,     0,     0,   249,     0,     0,   250,   251,
+     252,     0,   253,     0,     0,     0,     0,     0,   254,   255,
+     256,     0,     0,   257,    99,   258,   259,   260,   261,     0,
+       0,     0,   262,   263,   264,   289,   266,   267,     0,  1213,
+     101,   102,   103,     0,   104,     0,     0,     0,     0,     0,
+     105,   106,   107,   108,     0,   109,   110,   111,   112,   113,
+     114,     0,     0,   115,   116,   117,     0,   118,   119,   120,
+       0,     0,     0,   121,     0,     0,   122,   123,   124,     0,
+       0,   125,     0,   126,   127,   128,   129,     0,     0,   130,
+       0,     0,     0,     0,     0,     0,   131,     0,   132,   133,
+     134,   135,   136,   137,     0,   138,   139,     0,     0,     0,
+       0,     0,     0,   140,   141,     0,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,     0,   151,   152,   153,   154,
+       0,     0,   155,   156,   157,   158,   159,   160,     0,     0,
+     161,     0,     0,     0,     0,   162,     0,     0,     0,     0,
+       0,     0,   163,     0,     0,     0,   164,     0,     0,   165,
+       0,   166,   167,   168,     0,   169,   170,     0,     0,     0,
+     171,     0,   172,     0,   173,     0,     0,     0,     0,   174,
+       0,   175,     0,     0,   176,   177,   178,     0,     0,   179,
+       0,     0,     0,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,     0,     0,     0,     0,     0,     0,     0,
+     190,   191,   192,   193,   194,     0,   195,     0,   196,     0,
+       0,     0,   197,     0,     0,     0,     0,   198,   199,   200,
+     201,     0,   202,   203,     0,   204,     0,   205,   206,   207,
+     208,   209,     0,   210,   211,     0,   212,   213,   214,   215,
+       0,   216,   217,   218,   219,     0,   220,     0,   221,   222,
+       0,     0,     0,     0,     0,   223,   224,   225,   226,   227,
+       0,   228,     0,     0,     0,   230,   231,     0,   232,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,     0,   242,
+       0,     0,     0,     0,     0,   243,   244,   245,     0,   275,
+     247,     0,     0,   276,     0,     0,   249,     0,     0,   250,
+     251,   252,     0,   253,     0,     0,     0,  1214,     0,   254,
+     255,   256,     0,     0,   257,    99,   258,   259,   260,   261,
+       0,     0,     0,   262,   263,   264,   265,   266,   267,     0,
+    1225,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+       0,   105,   106,   107,   108,     0,   109,   110,   111,   112,
+     113,   114,     0,     0,   115,   116,   117,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,     0,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,     0,     0,
+     130,     0,     0,     0,     0,     0,     0,   131,     0,   132,
+     133,   134,   135,   136,   137,     0,   138,   139,     0,     0,
+       0,     0,     0,     0,   140,   141,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     154,     0,     0,   155,   156,   157,   158,   159,   160,     0,
+       0,   161,     0,     0,     0,     0,   162,     0,     0,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,     0,   169,   170,     0,     0,
+       0,   171,     0,   172,     0,   173,     0,     0,     0,     0,
+     174,     0,   175,     0,     0,   176,   177,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,     0,     0,     0,     0,     0,
+       0,   190,   191,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   197,     0,     0,     0,     0,   198,   199,
+     200,   201,     0,   202,   203,     0,   204,     0,   205,   206,
+     207,   208,   209,     0,   210,   211,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,     0,   221,
+     222,     0,     0,     0,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,     0,     0,   230,   231,     0,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,     0,     0,     0,   243,   244,   245,     0,
+     275,   247,     0,     0,   276,     0,     0,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,  1226,     0,
+     254,   255,   256,     0,    99,   257,     0,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+     101,   102,   103,     0,   104,     0,     0,     0,     0,     0,
+     105,   106,   107,   108,     0,   109,   110,   111,   112,   113,
+     114,     0,     0,   115,   116,   117,     0,   281,   119,   120,
+       0,     0,     0,   121,     0,     0,   122,   123,   124,     0,
+       0,   125,     0,   126,   127,   128,   129,     0,     0,   130,
+       0,     0,     0,     0,     0,     0,   131,     0,   132,   133,
+     134,   135,   136,   137,     0,   138,   139,     0,     0,     0,
+       0,     0,     0,   140,   141,     0,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,     0,   151,   152,   153,   154,
+       0,     0,   155,   156,   157,   158,   159,   160,     0,     0,
+     161,     0,     0,     0,     0,   162,     0,     0,     0,     0,
+       0,     0,   163,     0,     0,     0,   164,     0,     0,   165,
+       0,   166,   167,   168,     0,   169,   170,     0,     0,     0,
+     171,     0,   172,     0,   173,     0,     0,     0,     0,   174,
+       0,   282,     0,     0,   176,   177,   178,     0,     0,   179,
+       0,     0,     0,   180,   181,   182,   183,   184,   185,   283,
+     187,   188,   189,     0,     0,     0,     0,     0,     0,     0,
+     190,   191,   192,   193,   194,     0,   195,     0,   196,     0,
+       0,     0,   197,     0,     0,     0,     0,   198,   199,   200,
+     201,     0,   202,   203,     0,   204,     0,   205,   206,   207,
+     208,   209,     0,   210,   211,     0,   212,   213,   214,   215,
+       0,   216,   217,   218,   219,     0,   220,     0,   284,   222,
+       0,     0,     0,     0,     0,   223,   224,   225,   285,   227,
+       0,   228,   286,     0,     0,   230,   231,     0,   232,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,     0,   242,
+       0,     0,     0,     0,     0,   243,   244,   245,     0,   287,
+     247,     0,     0,   288,     0,     0,   249,     0,     0,   250,
+     251,   252,     0,   253,     0,     0,     0,     0,     0,   254,
+     255,   256,     0,    99,   257,     0,   258,   259,   260,   261,
+       0,     0,     0,   262,   263,   264,   289,   266,   267,   101,
+     102,   103,     0,   104,     0,     0,     0,     0,     0,   105,
+     106,   107,   108,     0,   109,   110,   111,   112,   113,   114,
+       0,     0,   115,   116,   117,     0,   118,   119,   120,     0,
+       0,     0,   121,     0,     0,   122,   123,   124,     0,     0,
+     125,     0,   126,   127,   128,   129,     0,     0,   130,     0,
+       0,     0,     0,     0,     0,   131,     0,   132,   133,   134,
+     135,   136,   137,     0,   138,   139,     0,     0,     0,     0,
+       0,     0,   140,   141,     0,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,     0,   151,   152,   153,   154,     0,
+       0,   155,   156,   157,   158,   159,   160,     0,     0,   161,
+       0,     0,     0,     0,   162,     0,     0,     0,     0,     0,
+       0,   163,     0,     0,     0,   164,     0,     0,   165,     0,
+     166,   167,   168,     0,   169,   170,     0,     0,     0,   171,
+       0,   172,     0,   173,     0,     0,     0,     0,   174,     0,
+     175,     0,     0,   176,   177,   178,     0,     0,   179,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,     0,     0,     0,     0,     0,     0,     0,   190,
+     191,   192,   193,   194,     0,   195,     0,   196,     0,     0,
+       0,   197,     0,     0,     0,     0,   198,   199,   200,   201,
+       0,   202,   203,     0,   204,     0,   205,   206,   207,   208,
+     209,     0,   210,   211,   309,   212,   213,   214,   215,     0,
+     216,   217,   218,   219,     0,   220,     0,   221,   222,     0,
+       0,     0,     0,     0,   223,   224,   225,   226,   227,     0,
+     228,     0,     0,     0,   230,   231,     0,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,     0,   242,     0,
+       0,     0,     0,     0,   243,   244,   245,     0,   275,   247,
+       0,     0,   276,     0,     0,   249,     0,     0,   250,   251,
+     252,     0,   253,     0,     0,     0,     0,     0,   254,   255,
+     256,     0,    99,   257,     0,   258,   259,   260,   261,     0,
+       0,     0,   262,   263,   264,   265,   266,   267,   101,   102,
+     103,     0,   104,     0,     0,     0,     0,     0,   105,   106,
+     107,   108,     0,   109,   110,   111,   112,   113,   114,     0,
+       0,   115,   116,   117,     0,   118,   119,   120,     0,     0,
+       0,   121,     0,     0,   122,   123,   124,     0,     0,   125,
+       0,   126,   127,   128,   129,     0,     0,   130,     0,     0,
+       0,     0,     0,     0,   131,     0,   132,   133,   134,   135,
+     136,   137,     0,   138,   139,     0,     0,     0,     0,     0,
+       0,   140,   141,     0,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,     0,   151,   152,   153,   154,     0,     0,
+     155,   156,   157,   158,   159,   160,     0,     0,   161,     0,
+       0,     0,     0,   162,     0,     0,     0,     0,     0,     0,
+     330,     0,     0,     0,   164,     0,     0,   165,     0,   166,
+     167,   168,     0,   169,   170,     0,     0,     0,   171,     0,
+     172,     0,   173,     0,     0,     0,     0,   174,     0,   175,
+       0,     0,   176,   177,   178,     0,     0,   179,     0,     0,
+       0,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,     0,     0,     0,     0,     0,     0,     0,   190,   191,
+     192,   193,   194,     0,   195,     0,   196,     0,     0,     0,
+     197,     0,     0,     0,     0,   198,   199,   200,   201,     0,
+     202,   203,     0,   204,   302,   205,   206,   207,   208,   209,
+       0,   210,   211,     0,   212,   213,   214,   215,     0,   216,
+     217,   218,   219,     0,   220,     0,   221,   222,     0,     0,
+       0,     0,     0,   223,   224,   225,   226,   227,     0,   228,
+       0,     0,     0,   230,   231,     0,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,     0,   242,     0,     0,
+       0,     0,     0,   243,   244,   245,     0,   275,   247,     0,
+       0,   276,     0,     0,   249,     0,     0,   250,   251,   252,
+       0,   253,     0,     0,     0,     0,     0,   254,   255,   256,
+       0,    99,   257,     0,   258,   259,   260,   261,     0,     0,
+       0,   262,   263,   264,   265,   266,   267,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,     0,   105,   106,   107,
+     108,     0,   109,   110,   111,   112,   113,   114,     0,     0,
+     115,   116,   117,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,     0,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,     0,     0,   130,     0,     0,     0,
+       0,     0,     0,   131,     0,   132,   133,   134,   135,   136,
+     137,     0,   138,   139,     0,     0,     0,     0,     0,     0,
+     140,   141,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   154,     0,     0,   155,
+     156,   157,   158,   159,   160,     0,     0,   161,     0,     0,
+       0,     0,   162,     0,     0,     0,     0,     0,     0,   334,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,     0,   169,   170,     0,     0,     0,   171,     0,   172,
+       0,   173,     0,     0,     0,     0,   174,     0,   175,     0,
+       0,   176,   177,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,     0,     0,     0,     0,     0,     0,   190,   191,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   197,
+       0,     0,     0,     0,   198,   199,   200,   201,     0,   202,
+     203,     0,   204,   302,   205,   206,   207,   208,   209,     0,
+     210,   211,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,     0,   221,   222,     0,     0,     0,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+       0,     0,   230,   231,     0,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,     0,   242,     0,     0,     0,
+       0,     0,   243,   244,   245,     0,   275,   247,     0,     0,
+     276,     0,     0,   249,     0,     0,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+      99,   257,     0,   258,   259,   260,   261,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,   101,   102,   103,     0,
+     104,     0,     0,     0,     0,     0,   105,   106,   107,   108,
+       0,   109,   110,   111,   112,   113,   114,     0,     0,   115,
+     116,   117,     0,   281,   119,   120,     0,     0,     0,   121,
+       0,     0,   122,   123,   124,     0,     0,   125,     0,   126,
+     127,   128,   129,     0,     0,   130,     0,     0,     0,     0,
+       0,     0,   131,     0,   132,   133,   134,   135,   136,   137,
+       0,   138,   139,     0,     0,     0,     0,     0,     0,   140,
+     141,     0,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,     0,   151,   152,   153,   154,     0,     0,   155,   156,
+     157,   158,   159,   160,     0,     0,   161,     0,     0,     0,
+       0,   162,     0,     0,     0,     0,     0,     0,   163,     0,
+       0,     0,   164,     0,     0,   165,     0,   166,   167,   168,
+       0,   169,   170,     0,     0,     0,   171,     0,   172,     0,
+     173,     0,     0,     0,     0,   174,     0,   175,     0,     0,
+     176,   177,   178,     0,     0,   179,     0,     0,     0,   180,
+     181,   182,   183,   184,   185,   283,   187,   188,   189,     0,
+       0,     0,     0,     0,     0,     0,   190,   191,   192,   193,
+     194,     0,   195,     0,   196,     0,     0,     0,   197,     0,
+       0,     0,     0,   198,   199,   200,   201,     0,   202,   203,
+       0,   204,     0,   205,   206,   207,   208,   209,     0,   210,
+     211,     0,   212,   213,   214,   215,     0,   216,   217,   218,
+     219,     0,   220,     0,   284,   222,     0,     0,     0,     0,
+       0,   223,   224,   225,   285,   227,     0,   228,   473,     0,
+       0,   230,   231,     0,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,     0,   242,     0,     0,     0,     0,
+       0,   243,   244,   245,     0,   287,   247,     0,     0,   288,
+       0,     0,   249,     0,     0,   250,   251,   252,     0,   253,
+       0,     0,     0,     0,     0,   254,   255,   256,     0,    99,
+     257,     0,   258,   259,   260,   261,     0,     0,     0,   262,
+     263,   264,   289,   266,   267,   101,   102,   103,     0,   104,
+       0,   506,     0,     0,     0,   105,   106,   107,   108,     0,
+     109,   110,   111,   112,   113,   114,     0,     0,   115,   116,
+     117,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+       0,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,     0,     0,   130,     0,     0,     0,     0,     0,
+       0,   131,     0,   132,   133,   134,   135,   136,   137,     0,
+     138,   139,     0,     0,     0,     0,     0,     0,   140,   141,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,   151,   152,   153,   154,     0,     0,   155,   156,   157,
+     158,   159,   160,     0,     0,   161,     0,     0,     0,     0,
+     162,     0,     0,     0,     0,     0,     0,   163,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,     0,
+     169,   170,     0,     0,     0,   171,     0,   172,     0,   173,
+       0,     0,     0,     0,   174,     0,   175,     0,     0,   176,
+     177,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,     0,
+       0,     0,     0,     0,     0,   190,   191,   192,   193,   194,
+       0,   195,     0,   196,     0,     0,     0,   197,     0,     0,
+       0,     0,   198,   199,   200,   201,     0,   202,   203,     0,
+     204,     0,   205,   206,   207,   208,   209,     0,   210,   211,
+       0,   212,   213,   214,   215,     0,   216,   217,   218,   219,
+       0,   220,     0,   221,   222,     0,     0,     0,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,     0,     0,
+     230,   231,     0,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,     0,   242,     0,     0,     0,     0,     0,
+     243,   244,   245,     0,   275,   247,     0,     0,   276,     0,
+       0,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,    99,   257,
+       0,   258,   259,   260,   261,     0,     0,     0,   262,   263,
+     264,   265,   266,   267,   101,   102,   103,     0,   104,     0,
+       0,     0,     0,     0,   105,   106,   107,   108,     0,   109,
+     110,   111,   112,   113,   114,     0,     0,   115,   116,   117,
+       0,   118,   119,   120,     0,     0,     0,   121,     0,     0,
+     122,   123,   124,     0,     0,   125,     0,   126,   127,   128,
+     129,     0,     0,   130,     0,     0,     0,     0,     0,     0,
+     131,     0,   132,   133,   134,   135,   136,   137,     0,   138,
+     139,     0,     0,     0,     0,     0,     0,   140,   141,     0,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,     0,
+     151,   152,   153,   154,     0,     0,   155,   156,   157,   158,
+     159,   160,     0,     0,   161,     0,     0,     0,     0,   162,
+       0,     0,     0,     0,     0,     0,   163,     0,     0,     0,
+     164,     0,     0,   165,     0,   166,   167,   168,     0,   169,
+     170,     0,     0,     0,   171,     0,   172,     0,   173,     0,
+       0,     0,     0,   174,     0,   175,     0,     0,   176,   177,
+     178,     0,     0,   179,     0,     0,     0,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,     0,     0,     0,
+       0,     0,     0,     0,   190,   191,   192,   193,   194,     0,
+     195,     0,   196,     0,     0,     0,   197,     0,     0,     0,
+       0,   198,   199,   200,   201,     0,   202,   203,     0,   204,
+     302,   205,   206,   207,   208,   209,     0,   210,   211,     0,
+     212,   213,   214,   215,     0,   216,   217,   218,   219,     0,
+     220,     0,   221,   222,     0,     0,     0,     0,     0,   223,
+     224,   225,   226,   227,     0,   228,     0,     0,     0,   230,
+     231,     0,   232,   233,   234,   235,   236,   237,   238,   239,
+     240,   241,     0,   242,     0,     0,     0,     0,     0,   243,
+     244,   245,     0,   275,   247,     0,     0,   276,     0,     0,
+     249,     0,     0,   250,   251,   252,     0,   253,     0,     0,
+       0,     0,     0,   254,   255,   256,     0,    99,   257,     0,
+     258,   259,   260,   261,     0,     0,     0,   262,   263,   264,
+     265,   266,   267,   101,   102,   103,     0,   104,     0,     0,
+       0,     0,     0,   105,   106,   107,   108,     0,   109,   110,
+     111,   112,   113,   114,     0,     0,   115,   116,   117,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,     0,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+       0,     0,   130,     0,     0,     0,     0,     0,     0,   131,
+       0,   132,   133,   134,   135,   136,   137,     0,   138,   139,
+       0,     0,     0,     0,     0,     0,   140,   141,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,   151,
+     152,   153,   154,     0,     0,   155,   156,   157,   158,   159,
+     160,     0,     0,   161,     0,     0,     0,     0,   162,     0,
+       0,     0,     0,     0,     0,   589,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,     0,   169,   170,
+       0,     0,     0,   171,     0,   172,     0,   173,     0,     0,
+       0,     0,   174,     0,   175,     0,     0,   176,   177,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,     0,     0,     0,     0,
+       0,     0,     0,   190,   191,   192,   193,   194,     0,   195,
+       0,   196,     0,     0,     0,   197,     0,     0,     0,     0,
+     198,   199,   200,   201,     0,   202,   203,     0,   204,   302,
+     205,   206,   207,   208,   209,     0,   210,   211,     0,   212,
+     213,   214,   215,     0,   216,   217,   218,   219,     0,   220,
+       0,   221,   222,     0,     0,     0,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,     0,     0,   230,   231,
+       0,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,     0,   242,     0,     0,     0,     0,     0,   243,   244,
+     245,     0,   275,   247,     0,     0,   276,     0,     0,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,    99,   257,     0,   258,
+     259,   260,   261,     0,     0,     0,   262,   263,   264,   265,
+     266,   267,   101,   102,   103,     0,   104,     0,  1162,     0,
+       0,     0,   105,   106,   107,   108,     0,   109,   110,   111,
+     112,   113,   114,     0,     0,   115,   116,   117,     0,   118,
+     119,   120,     0,     0,     0,   121,     0,     0,   122,   123,
+     124,     0,     0,   125,     0,   126,   127,   128,   129,     0,
+       0,   130,     0,     0,     0,     0,     0,     0,   131,     0,
+     132,   133,   134,   135,   136,   137,     0,   138,   139,     0,
+       0,     0,     0,     0,     0,   140,   141,     0,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,     0,   151,   152,
+     153,   154,     0,     0,   155,   156,   157,   158,   159,   160,
+       0,     0,   161,     0,     0,     0,     0,   162,     0,     0,
+       0,     0,     0,     0,   163,     0,     0,     0,   164,     0,
+       0,   165,     0,   166,   167,   168,     0,   169,   170,     0,
+       0,     0,   171,     0,   172,     0,   173,     0,     0,     0,
+       0,   174,     0,   175,     0,     0,   176,   177,   178,     0,
+       0,   179,     0,     0,     0,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,     0,     0,     0,     0,     0,
+       0,     0,   190,   191,   192,   193,   194,     0,   195,     0,
+     196,     0,     0,     0,   197,     0,     0,     0,     0,   198,
+     199,   200,   201,     0,   202,   203,     0,   204,     0,   205,
+     206,   207,   208,   209,     0,   210,   211,     0,   212,   213,
+     214,   215,     0,   216,   217,   218,   219,     0,   220,     0,
+     221,   222,     0,     0,     0,     0,     0,   223,   224,   225,
+     226,   227,     0,   228,     0,     0,     0,   230,   231,     0,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+       0,   242,     0,     0,     0,     0,     0,   243,   244,   245,
+       0,   275,   247,     0,     0,   276,     0,     0,   249,     0,
+       0,   250,   251,   252,     0,   253,     0,     0,     0,     0,
+       0,   254,   255,   256,     0,    99,   257,     0,   258,   259,
+     260,   261,     0,     0,     0,   262,   263,   264,   265,   266,
+     267,   101,   102,   103,     0,   104,     0,     0,     0,     0,
+       0,   105,   106,   107,   108,     0,   109,   110,   111,   112,
+     113,   114,     0,     0,   115,   116,   117,     0,   118,   119,
+     120,     0,     0,     0,   121,     0,     0,   122,   123,   124,
+       0,     0,   125,     0,   126,   127,   128,   129,     0,     0,
+     130,     0,     0,     0,     0,     0,     0,   131,     0,   132,
+     133,   134,   135,   136,   137,     0,   138,   139,     0,     0,
+       0,     0,     0,     0,   140,   141,     0,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,     0,   151,   152,   153,
+     154,     0,     0,   155,   156,   157,   158,   159,   160,     0,
+       0,   161,     0,     0,     0,     0,   162,     0,     0,     0,
+       0,     0,     0,   163,     0,     0,     0,   164,     0,     0,
+     165,     0,   166,   167,   168,     0,   169,   170,     0,     0,
+       0,   171,     0,   172,     0,   173,     0,     0,     0,     0,
+     174,     0,   175,     0,     0,   176,   177,   178,     0,     0,
+     179,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,     0,     0,     0,     0,     0,
+       0,   190,   191,   192,   193,   194,     0,   195,     0,   196,
+       0,     0,     0,   197,     0,     0,     0,     0,   198,   199,
+     200,   201,     0,   202,   203,     0,   204,     0,   205,   206,
+     207,   208,   209,     0,   210,   211,     0,   212,   213,   214,
+     215,     0,   216,   217,   218,   219,     0,   220,     0,   221,
+     222,     0,     0,     0,     0,     0,   223,   224,   225,   226,
+     227,     0,   228,     0,     0,     0,   230,   231,     0,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,     0,
+     242,     0,     0,     0,     0,     0,   243,   244,   245,     0,
+     275,   247,     0,     0,   276,     0,     0,   249,     0,     0,
+     250,   251,   252,     0,   253,     0,     0,     0,     0,  1916,
+     254,   255,   256,     0,    99,   257,     0,   258,   259,   260,
+     261,     0,     0,     0,   262,   263,   264,   265,   266,   267,
+     101,   102,   103,     0,   104,     0,     0,     0,     0,     0,
+     105,   106,   107,   108,     0,   109,   110,   111,   112,   113,
+     114,     0,     0,   115,   116,   117,     0,   118,   119,   120,
+       0,     0,     0,   121,     0,     0,   122,   123,   124,     0,
+       0,   125,     0,   126,   127,   128,   129,     0,     0,   130,
+       0,     0,     0,     0,     0,     0,   131,     0,   132,   133,
+     134,   135,   136,   137,     0,   138,   139,     0,     0,     0,
+       0,     0,     0,   140,   141,     0,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,     0,   151,   152,   153,   154,
+       0,     0,   155,   156,   157,   158,   159,   160,     0,     0,
+     161,     0,     0,     0,     0,   162,     0,     0,     0,     0,
+       0,     0,   163,     0,     0,     0,   164,     0,     0,   165,
+       0,   166,   167,   168,     0,   169,   170,     0,     0,     0,
+     171,     0,   172,     0,   173,     0,     0,     0,     0,   174,
+       0,   175,     0,     0,   176,   177,   178,     0,     0,   179,
+       0,     0,     0,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,     0,     0,     0,     0,     0,     0,     0,
+     190,   191,   192,   193,   194,     0,   195,     0,   196,     0,
+       0,     0,   197,     0,     0,     0,     0,   198,   199,   200,
+     201,     0,   202,   203,     0,   204,     0,   205,   206,   207,
+     208,   209,     0,   210,   211,     0,   212,   213,   214,   215,
+       0,   216,   217,   218,   219,     0,   220,     0,   221,   222,
+       0,     0,     0,     0,     0,   223,   224,   225,   226,   227,
+       0,   228,     0,     0,     0,   230,   231,     0,   232,   233,
+     234,   235,   236,   274,   238,   239,   240,   241,     0,   242,
+       0,     0,     0,     0,     0,   243,   244,   245,     0,   275,
+     247,     0,     0,   276,     0,     0,   249,     0,     0,   250,
+     251,   252,     0,   253,     0,     0,     0,     0,     0,   254,
+     255,   256,     0,    99,   257,     0,   258,   259,   260,   261,
+       0,     0,     0,   262,   263,   264,   265,   266,   267,   101,
+     102,   103,     0,   104,     0,     0,     0,     0,     0,   105,
+     106,   107,   108,     0,   109,   110,   111,   112,   113,   114,
+       0,     0,   115,   116,   117,     0,   118,   119,   120,     0,
+       0,     0,   121,     0,     0,   122,   123,   124,     0,     0,
+     125,     0,   126,   127,   128,   129,     0,     0,   130,     0,
+       0,     0,     0,     0,     0,   131,     0,   132,   133,   134,
+     135,   136,   137,     0,   138,   139,     0,     0,     0,     0,
+       0,     0,   140,   141,     0,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,     0,   151,   152,   153,   154,     0,
+       0,   155,   156,   157,   158,   159,   160,     0,     0,   161,
+       0,     0,     0,     0,   162,     0,     0,     0,     0,     0,
+       0,   163,     0,     0,     0,   164,     0,     0,   165,     0,
+     166,   167,   168,     0,   169,   170,     0,     0,     0,   171,
+       0,   172,     0,   173,     0,     0,     0,     0,   174,     0,
+     175,     0,     0,   176,   177,   178,     0,     0,   179,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,     0,     0,     0,     0,     0,     0,     0,   190,
+     191,   192,   193,   194,     0,   195,     0,   196,     0,     0,
+       0,   197,     0,     0,     0,     0,   198,   199,   200,   201,
+       0,   202,   203,     0,   204,     0,   205,   206,   207,   208,
+     209,     0,   210,   211,     0,   212,   213,   214,   215,     0,
+     216,   217,   218,   219,     0,   220,     0,   221,   222,     0,
+       0,     0,     0,     0,   223,   224,   225,   226,   227,     0,
+     228,     0,     0,     0,   230,   231,     0,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,     0,   242,     0,
+       0,     0,     0,     0,   243,   244,   245,     0,   275,   247,
+       0,     0,   276,     0,     0,   249,     0,     0,   250,   251,
+     252,     0,   253,     0,     0,     0,     0,     0,   254,   255,
+     256,     0,    99,   257,     0,   258,   259,   260,   261,     0,
+       0,     0,   262,   263,   264,   265,   266,   267,   101,   102,
+     103,     0,   104,     0,     0,     0,     0,     0,   105,   106,
+     107,   108,     0,   109,   110,   111,   112,   113,   114,     0,
+       0,   115,   116,   117,     0,   118,   119,   120,     0,     0,
+       0,   121,     0,     0,   122,   123,   124,     0,     0,   125,
+       0,   126,   127,   128,   129,     0,     0,   130,     0,     0,
+       0,     0,     0,     0,   131,     0,   132,   133,   134,   135,
+     136,   137,     0,   138,   139,     0,     0,     0,     0,     0,
+       0,   140,   141,     0,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,     0,   151,   152,   153,   154,     0,     0,
+     155,   156,   157,   158,   159,   160,     0,     0,   161,     0,
+       0,     0,     0,   162,     0,     0,     0,     0,     0,     0,
+     377,     0,     0,     0,   164,     0,     0,   165,     0,   166,
+     167,   168,     0,   169,   170,     0,     0,     0,   171,     0,
+     172,     0,   173,     0,     0,     0,     0,   174,     0,   175,
+       0,     0,   176,   177,   178,     0,     0,   179,     0,     0,
+       0,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,     0,     0,     0,     0,     0,     0,     0,   190,   191,
+     192,   193,   194,     0,   195,     0,   196,     0,     0,     0,
+     197,     0,     0,     0,     0,   198,   199,   200,   201,     0,
+     202,   203,     0,   204,     0,   205,   206,   207,   208,   209,
+       0,   210,   211,     0,   212,   213,   214,   215,     0,   216,
+     217,   218,   219,     0,   220,     0,   221,   222,     0,     0,
+       0,     0,     0,   223,   224,   225,   226,   227,     0,   228,
+       0,     0,     0,   230,   231,     0,   232,   233,   234,   235,
+     236,   237,   238,   239,   240,   241,     0,   242,     0,     0,
+       0,     0,     0,   243,   244,   245,     0,   275,   247,     0,
+       0,   276,     0,     0,   249,     0,     0,   250,   251,   252,
+       0,   253,     0,     0,     0,     0,     0,   254,   255,   256,
+       0,    99,   257,     0,   258,   259,   260,   261,     0,     0,
+       0,   262,   263,   264,   265,   266,   267,   101,   102,   103,
+       0,   104,     0,     0,     0,     0,     0,   105,   106,   107,
+     108,     0,   109,   110,   111,   112,   113,   114,     0,     0,
+     115,   116,   117,     0,   118,   119,   120,     0,     0,     0,
+     121,     0,     0,   122,   123,   124,     0,     0,   125,     0,
+     126,   127,   128,   129,     0,     0,   130,     0,     0,     0,
+       0,     0,     0,   131,     0,   132,   133,   134,   135,   136,
+     137,     0,   138,   139,     0,     0,     0,     0,     0,     0,
+     140,   141,     0,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,     0,   151,   152,   153,   154,     0,     0,   155,
+     156,   157,   158,   159,   160,     0,     0,   161,     0,     0,
+       0,     0,   162,     0,     0,     0,     0,     0,     0,   593,
+       0,     0,     0,   164,     0,     0,   165,     0,   166,   167,
+     168,     0,   169,   170,     0,     0,     0,   171,     0,   172,
+       0,   173,     0,     0,     0,     0,   174,     0,   175,     0,
+       0,   176,   177,   178,     0,     0,   179,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,     0,     0,     0,     0,     0,     0,   190,   191,   192,
+     193,   194,     0,   195,     0,   196,     0,     0,     0,   197,
+       0,     0,     0,     0,   198,   199,   200,   201,     0,   202,
+     203,     0,   204,     0,   205,   206,   207,   208,   209,     0,
+     210,   211,     0,   212,   213,   214,   215,     0,   216,   217,
+     218,   219,     0,   220,     0,   221,   222,     0,     0,     0,
+       0,     0,   223,   224,   225,   226,   227,     0,   228,     0,
+       0,     0,   230,   231,     0,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,     0,   242,     0,     0,     0,
+       0,     0,   243,   244,   245,     0,   275,   247,     0,     0,
+     276,     0,     0,   249,     0,     0,   250,   251,   252,     0,
+     253,     0,     0,     0,     0,     0,   254,   255,   256,     0,
+      99,   257,     0,   258,   259,   260,   261,     0,     0,     0,
+     262,   263,   264,   265,   266,   267,   101,   102,   103,     0,
+     104,     0,     0,     0,     0,     0,   105,   106,   107,   108,
+       0,   109,   110,   111,   112,   113,   114,     0,     0,   115,
+     116,   117,     0,   118,   119,   120,     0,     0,     0,   121,
+       0,     0,   122,   123,   124,     0,     0,   125,     0,   126,
+     127,   128,   129,     0,     0,   130,     0,     0,     0,     0,
+       0,     0,   131,     0,   132,   133,   134,   135,   136,   137,
+       0,   138,   139,     0,     0,     0,     0,     0,     0,   140,
+     141,     0,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,     0,   151,   152,   153,   154,     0,     0,   155,   156,
+     157,   158,   159,   160,     0,     0,   161,     0,     0,     0,
+       0,   162,     0,     0,     0,     0,     0,     0,   163,     0,
+       0,     0,   164,     0,     0,   165,     0,   166,   167,   168,
+       0,   169,   170,     0,     0,     0,   171,     0,   172,     0,
+     173,     0,     0,     0,     0,   174,     0,   175,     0,     0,
+     176,   177,   178,     0,     0,   179,     0,     0,     0,   180,
+     181,   182,   183,   184,   185,   186,   187,   188,   189,     0,
+       0,     0,     0,     0,     0,     0,   190,   191,   192,   193,
+     194,     0,   195,     0,   196,     0,     0,     0,   197,     0,
+       0,     0,     0,   198,   199,   200,   201,     0,   202,   203,
+       0,   204,     0,   205,   206,   207,   208,   209,     0,   210,
+     211,     0,   212,   213,   214,   215,     0,   216,   217,   218,
+     219,     0,   220,     0,   221,   222,     0,     0,     0,     0,
+       0,   223,   224,   225,   226,   227,     0,   228,     0,     0,
+       0,   230,   231,     0,   232,   233,   234,   235,   236,   624,
+     238,   239,   240,   241,     0,   242,     0,     0,     0,     0,
+       0,   243,   244,   245,     0,   275,   247,     0,     0,   276,
+       0,     0,   249,     0,     0,   250,   251,   252,     0,   253,
+       0,     0,     0,     0,     0,   254,   255,   256,     0,    99,
+     257,     0,   258,   259,   260,   261,     0,     0,     0,   262,
+     263,   264,   265,   266,   267,   101,   102,   103,     0,   104,
+       0,     0,     0,     0,     0,   105,   106,   107,   108,     0,
+     109,   110,   111,   112,   113,   114,     0,     0,   115,   116,
+     117,     0,   118,   119,   120,     0,     0,     0,   121,     0,
+       0,   122,   123,   124,     0,     0,   125,     0,   126,   127,
+     128,   129,     0,     0,   130,     0,     0,     0,     0,     0,
+       0,   131,     0,   132,   133,   134,   135,   136,   137,     0,
+     138,   139,     0,     0,     0,     0,     0,     0,   140,   141,
+       0,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+       0,   151,   152,   153,   154,     0,     0,   155,   156,   157,
+     158,   159,   160,     0,     0,   161,     0,     0,     0,     0,
+     162,     0,     0,     0,     0,     0,     0,  1208,     0,     0,
+       0,   164,     0,     0,   165,     0,   166,   167,   168,     0,
+     169,   170,     0,     0,     0,   171,     0,   172,     0,   173,
+       0,     0,     0,     0,   174,     0,   175,     0,     0,   176,
+     177,   178,     0,     0,   179,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,     0,
+       0,     0,     0,     0,     0,   190,   191,   192,   193,   194,
+       0,   195,     0,   196,     0,     0,     0,   197,     0,     0,
+       0,     0,   198,   199,   200,   201,     0,   202,   203,     0,
+     204,     0,   205,   206,   207,   208,   209,     0,   210,   211,
+       0,   212,   213,   214,   215,     0,   216,   217,   218,   219,
+       0,   220,     0,   221,   222,     0,     0,     0,     0,     0,
+     223,   224,   225,   226,   227,     0,   228,     0,     0,     0,
+     230,   231,     0,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,     0,   242,     0,     0,     0,     0,     0,
+     243,   244,   245,     0,   275,   247,     0,     0,   276,     0,
+       0,   249,     0,     0,   250,   251,   252,     0,   253,     0,
+       0,     0,     0,     0,   254,   255,   256,     0,    99,   257,
+       0,   258,   259,   260,   261,     0,     0,     0,   262,   263,
+     264,   265,   266,   267,   101,   102,   103,     0,   104,     0,
+       0,     0,     0,     0,   105,   106,   107,   108,     0,   109,
+     110,   111,   112,   113,   114,     0,     0,   115,   116,   117,
+       0,   118,   119,   120,     0,     0,     0,   121,     0,     0,
+     122,   123,   124,     0,     0,   125,     0,   126,   127,   128,
+     129,     0,     0,   130,     0,     0,     0,     0,     0,     0,
+     131,     0,   132,   133,   134,   135,   136,   137,     0,   138,
+     139,     0,     0,     0,     0,     0,     0,   140,   141,     0,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,     0,
+     151,   152,   153,   154,     0,     0,   155,   156,   157,   158,
+     159,   160,     0,     0,   161,     0,     0,     0,     0,   162,
+       0,     0,     0,     0,     0,     0,  1210,     0,     0,     0,
+     164,     0,     0,   165,     0,   166,   167,   168,     0,   169,
+     170,     0,     0,     0,   171,     0,   172,     0,   173,     0,
+       0,     0,     0,   174,     0,   175,     0,     0,   176,   177,
+     178,     0,     0,   179,     0,     0,     0,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,     0,     0,     0,
+       0,     0,     0,     0,   190,   191,   192,   193,   194,     0,
+     195,     0,   196,     0,     0,     0,   197,     0,     0,     0,
+       0,   198,   199,   200,   201,     0,   202,   203,     0,   204,
+       0,   205,   206,   207,   208,   209,     0,   210,   211,     0,
+     212,   213,   214,   215,     0,   216,   217,   218,   219,     0,
+     220,     0,   221,   222,     0,     0,     0,     0,     0,   223,
+     224,   225,   226,   227,     0,   228,     0,     0,     0,   230,
+     231,     0,   232,   233,   234,   235,   236,   237,   238,   239,
+     240,   241,     0,   242,     0,     0,     0,     0,     0,   243,
+     244,   245,     0,   275,   247,     0,     0,   276,     0,     0,
+     249,     0,     0,   250,   251,   252,     0,   253,     0,     0,
+       0,     0,     0,   254,   255,   256,     0,    99,   257,     0,
+     258,   259,   260,   261,     0,     0,     0,   262,   263,   264,
+     265,   266,   267,   101,   102,   103,     0,   104,     0,  1162,
+       0,     0,     0,   105,   106,   107,   108,     0,   109,   110,
+     111,   112,   113,   114,     0,     0,   115,   116,   117,     0,
+     118,   119,   120,     0,     0,     0,   121,     0,     0,   122,
+     123,   124,     0,     0,   125,     0,   126,   127,   128,   129,
+       0,     0,   130,     0,     0,     0,     0,     0,     0,   131,
+       0,   132,   133,   134,   135,   136,   137,     0,   138,   139,
+       0,     0,     0,     0,     0,     0,   140,   141,     0,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,     0,   151,
+     152,   153,   154,     0,     0,   155,   156,   157,   158,   159,
+     160,     0,     0,   161,     0,     0,     0,     0,   162,     0,
+       0,     0,     0,     0,     0,   163,     0,     0,     0,   164,
+       0,     0,   165,     0,   166,   167,   168,     0,   169,   170,
+       0,     0,     0,   171,     0,   172,     0,   173,     0,     0,
+       0,     0,     0,     0,   175,     0,     0,   176,   177,   178,
+       0,     0,   179,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,     0,     0,     0,     0,
+       0,     0,     0,   190,   191,   192,   193,   194,     0,   195,
+       0,     0,     0,     0,     0,   197,     0,     0,     0,     0,
+     198,   199,   200,   201,     0,   202,   203,     0,   204,     0,
+     205,   206,   207,   208,   209,     0,   210,   211,     0,   212,
+     213,   214,   215,     0,   216,   217,     0,     0,     0,   220,
+       0,   221,   222,     0,     0,     0,     0,     0,   223,   224,
+     225,   226,   227,     0,   228,     0,     0,     0,   230,   231,
+       0,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,     0,   242,     0,     0,     0,     0,     0,   243,   244,
+     245,     0,   275,   247,     0,     0,   276,     0,     0,   249,
+       0,     0,   250,   251,   252,     0,   253,     0,     0,     0,
+       0,     0,   254,   255,   256,     0,  1697,   257,     0,   258,
+     259,   260,   261,     0,     0,     0,   262,   263,   264,   265,
+     266,   267,   101,   102,   103,     0,   104,     0,     0,     0,
+       0,   352,   105,   106,   107,   108,     0,   109,     0,     0,
+       0,   113,     0,     0,     0,   115,   116,     0,     0,   118,
+       0,   120,     0,     0,     0,   121,     0,   353,   122,   123,
+     124,     0,     0,   125,     0,   126,   127,   128,   129,     0,
+       0,   130,     0,   354,     0,     0,     0,     0,   131,   355,
+     132,   133,   134,   135,     0,   137,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   140,   141,     0,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,     0,     0,   152,
+     153,     0,     0,     0,   155,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,     0,   356,   162,     0,     0,
+       0,     0,     0,     0,   163,     0,     0,     0,   164,     0,
+       0,   165,     0,   166,   167,   168,   357,   169,     0,     0,
+       0,     0,     0,     0,   172,   358,   173,     0,     0,   359,
+       0,   174,     0,   175,     0,     0,   176,     0,   178,     0,
+       0,   179,     0,     0,     0,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   192,   193,   194,     0,   195,     0,
+     196,     0,     0,     0,   197,     0,     0,     0,   360,   198,
+     199,   200,   201,     0,   202,   203,     0,   204,     0,   205,
+     206,   207,   208,   209,     0,   210,     0,     0,   212,   213,
+     214,   215,     0,   216,   217,   218,   219,     0,   220,   361,
+     221,   222,     0,     0,     0,     0,     0,   223,   224,   225,
+     226,   227,     0,   228,   543,     0,   544,   230,   231,     0,
+     232,     0,   234,     0,   236,   237,   238,   239,   240,   241,
+       0,   242,   543,     0,   544,     0,     0,   243,   244,   245,
+     543,     0,   544,     0,     0,   276,     0,   545,   249,     0,
+       0,   250,   251,   252,     0,   253,     0,     0,     0,     0,
+       0,   254,   255,   256,     0,   545,     0,     0,   258,   259,
+     260,     0,     0,   545,     0,   262,   263,   264,   265,   266,
+     267,     0,     0,     0,     0,   546,     0,     0,     0,     0,
+       0,   547,     0,     0,     0,   548,   549,     0,   543,     0,
+     544,     0,     0,   546,     0,     0,     0,     0,   550,   547,
+       0,   546,     0,   548,   549,     0,     0,   547,     0,     0,
+       0,   548,   549,     0,     0,     0,   550,     0,     0,     0,
+       0,   545,     0,     0,   550,   551,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   551,     0,     0,     0,     0,     0,     0,
+       0,   551,     0,     0,   543,     0,   544,     0,   552,   546,
+       0,     0,     0,     0,     0,   547,     0,     0,     0,   548,
+     549,     0,   553,     0,     0,     0,   552,     0,     0,   554,
+       0,   555,   550,     0,   552,     0,     0,   545,     0,     0,
+     553,     0,     0,   556,     0,   557,     0,   554,   553,   555,
+       0,     0,     0,     0,     0,   554,     0,   555,     0,   551,
+       0,   556,   558,   557,     0,   559,     0,     0,     0,   556,
+       0,   557,     0,     0,     0,   546,     0,     0,     0,     0,
+     569,   547,     0,   559,     0,   548,   549,     0,   572,     0,
+     560,   559,   552,     0,     0,     0,     0,     0,   550,     0,
+       0,     0,     0,     0,     0,     0,   553,     0,   560,   543,
+       0,   544,     0,   554,     0,   555,   573,   561,     0,     0,
+       0,     0,     0,     0,     0,   551,     0,   556,     0,   557,
+       0,     0,     0,     0,     0,   561,     0,     0,   562,     0,
+       0,     0,   545,   561,     0,     0,  1189,     0,     0,   559,
+       0,     0,     0,     0,     0,     0,   562,     0,   552,     0,
+       0,     0,     0,     0,   562,     0,     0,     0,     0,     0,
+       0,     0,   553,     0,   560,     0,     0,     0,     0,   554,
+     546,   555,     0,     0,     0,     0,   547,     0,     0,     0,
+     548,   549,     0,   556,     0,   557,     0,     0,     0,     0,
+       0,   561,     0,   550,     0,     0,     0,     0,     0,     0,
+       0,     0,  1252,     0,     0,   559,     0,     0,     0,     0,
+       0,     0,   562,     0,     0,     0,     0,     0,     0,     0,
+     551,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     560,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   552,     0,     0,     0,   561,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   553,     0,     0,
+       0,     0,     0,     0,   554,     0,   555,     0,   562,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   556,     0,
+     557,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1256,     0,     0,
+     559,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1257,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   561,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   562
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,   592,    65,   303,     0,     0,   555,   485,   559,     9,
+     663,   503,   504,     9,    21,   844,   341,   543,  1090,   449,
+    1171,   327,    22,  1144,   594,    39,   842,   665,   841,  1473,
+     288,    19,   644,   663,   903,   547,   649,     0,   663,  1479,
+     552,  1455,    92,   374,    91,  1202,     9,   600,  1133,  1461,
+     414,    51,  1541,   629,    51,   604,  1510,   569,  1510,     5,
+      51,   333,     5,   335,     0,     9,    54,   431,   432,     5,
+       5,     5,    11,   385,     5,     5,  1746,     5,     0,    43,
+      25,   693,     5,  1065,    68,  1666,   853,     5,   101,    65,
+      11,    91,    92,    87,     0,    91,     3,     4,     5,     4,
+      59,  1273,     9,  1275,     9,    57,  1521,    88,     0,    82,
+      18,    53,    11,    55,   325,   121,    92,    49,     0,    87,
+       0,  1655,    94,  1804,  1281,    51,  1815,  1821,    91,   325,
+    1854,    18,    51,    30,   626,   435,  1825,     4,   194,    50,
+      33,    86,     9,   123,     5,   194,   104,   168,  1754,     8,
+      86,   284,    11,   204,   454,    26,   726,   151,    18,   651,
+      11,    86,   487,   200,  1076,  1077,   127,  1917,  1080,  1919,
+      43,     5,   531,   485,    33,  1087,    11,    64,    18,    86,
+     112,    11,    77,  1982,    88,   663,   297,   158,   282,    28,
+     122,   185,   297,    80,   310,  1865,   688,   282,    67,   885,
+     120,   631,   245,    87,   634,    95,   892,   324,   103,    48,
+      97,   641,   642,   115,    95,   282,   245,  1906,    89,  1659,
+     314,   338,   245,    92,   340,   336,   197,   248,   222,    94,
+      90,   336,   193,   137,   284,  1649,   208,   217,   158,   141,
+     133,   148,   132,   286,  2043,   207,   230,   167,  1717,   273,
+      90,   132,  1706,   160,   579,   142,   228,   286,    20,    21,
+       5,  1750,   187,   286,  1336,  2015,   159,   231,   599,   282,
+     131,  1686,   336,  1997,   133,   312,   914,   197,   916,   259,
+     336,   253,  1963,  1977,   204,  1974,   218,   336,    10,   340,
+      12,   150,    14,    15,    16,     8,   207,    19,    11,    21,
+     159,   314,   309,   187,   249,  1456,   204,   666,   284,   101,
+     232,   233,   300,   327,   295,   150,   316,  1474,   318,   316,
+      33,  1478,   318,   318,   219,   316,   232,   233,  1998,  1910,
+     541,    53,    54,    55,   340,   385,  1165,  1943,  1423,   307,
+     292,   388,   201,   316,  1429,   541,   340,   244,   245,   482,
+     308,  1523,  1524,   187,   280,   318,   340,   302,   231,   301,
+     268,   280,   294,  2033,    86,   311,   311,  1349,  1350,  1136,
+     235,    65,  1816,   293,   336,   204,   340,  1846,    43,   338,
+     275,   268,   341,   135,   328,   329,   131,     0,   388,   286,
+     336,   336,   388,   336,  1848,   334,  1848,  2003,    92,   339,
+     970,   336,   336,   339,   338,   336,   336,   341,   336,   385,
+    1854,   987,   333,   336,   963,   337,   416,   339,   336,   972,
+     133,   328,   329,   328,   329,   388,   318,   369,   370,   371,
+    1964,   337,   482,   339,   333,   334,   318,   150,   318,   337,
+     490,   491,   340,    11,   311,  2051,   159,   167,  1360,   449,
+    1939,  1363,  1364,  1365,  1366,  1367,  1368,  1369,  1370,  1371,
+    1372,   328,   329,  2069,   340,   324,   325,   326,   224,   328,
+     329,   330,   331,   332,   333,   334,  1943,  1090,   160,   330,
+     331,   332,   333,  1895,   204,    62,  1926,   249,   201,  1610,
+     282,    11,   226,   328,   329,   330,   331,   332,   333,   334,
+     330,   331,   332,   333,   334,  1656,   482,   514,   337,   121,
+    1999,   340,   127,  1861,   490,   491,  1128,  1129,   267,   297,
+     286,   273,   314,   898,   500,    87,   526,   192,   528,   526,
+      86,   528,    51,   295,   522,   526,  2003,   528,    88,   135,
+     302,  1626,    61,   305,    94,  1985,  1960,  1632,   923,   311,
+     306,    86,   274,  1997,   306,    18,   498,   607,   336,   606,
+     282,    24,  1192,    87,   286,   338,   231,  1192,   341,  1726,
+     319,   320,  1871,   293,   336,  1228,   273,  2017,   300,   301,
+     568,   523,   150,   305,  2051,    76,   129,   309,   253,   151,
+     284,   313,   306,  1231,  1232,  1233,   278,   174,  1228,   176,
+     542,  1031,  2069,  1228,  1473,  1953,   606,   257,    18,   551,
+     606,   883,   325,   326,    24,   328,   329,   330,   331,   332,
+     333,   334,   237,   185,   600,   168,  2066,   151,   305,   571,
+     150,   607,  1445,     8,    87,   947,    11,   968,   950,  1209,
+     952,  1211,  1458,   606,   249,   587,    28,   369,   370,   371,
+     185,  1081,   374,    49,   926,     3,   317,   929,   247,    18,
+     222,   185,   212,  1155,   222,    24,   332,   667,   280,   227,
+     392,  1301,   338,   395,  1265,     4,  1301,  1798,    86,     5,
+       9,  1593,  2030,    31,  2032,  1049,   139,  1340,    96,   665,
+      86,   385,   250,   249,  1058,  1059,   696,   302,   222,   288,
+       8,   332,  2001,    11,  2052,   248,  1359,   338,    56,   212,
+    1340,   687,   324,   216,  1192,  1340,   282,  1076,  1077,   151,
+     286,  1080,   311,  1336,   313,    33,   338,   153,  1087,  1359,
+      42,   336,   185,   280,  1359,    47,  2035,   725,   247,   192,
+    1252,  1290,   266,    10,  1314,  1817,   302,   336,    15,     8,
+    1228,   185,    11,   187,   249,   311,   224,   274,  1309,   276,
+     328,   329,   330,   331,   332,   333,   192,    86,   116,  2068,
+    1410,  1411,  1412,  1845,    33,   150,   498,   185,   337,   288,
+     336,   340,  2081,   338,   506,   133,   508,   317,   482,   185,
+     138,   187,   514,   120,    28,   263,   490,   491,   106,   202,
+     522,   523,   311,   317,   313,   273,   500,   302,   328,   329,
+     330,   331,   332,   333,  1965,   338,   311,     3,   341,     5,
+     542,  1911,   218,  1301,   330,   133,   201,   336,   254,   551,
+     253,   158,  1922,   555,     8,     3,     4,    11,   306,   340,
+       8,   336,   150,    11,   851,   337,   568,   243,    22,   571,
+     913,   159,   151,   261,   854,  1767,   337,  1510,   854,   854,
+     268,   336,  1340,   338,   586,   587,   341,  1505,    41,   295,
+     197,  1509,   220,  1511,   133,   232,   233,   599,    82,   886,
+    1510,  1359,   604,  1495,  1142,  1510,  1976,   108,   120,   237,
+     897,   150,   899,   201,   901,   902,    82,  1510,   294,   906,
+     907,   337,   624,  2054,   340,   124,   600,  1979,   915,   239,
+    2001,   918,   242,   607,   121,  1345,   264,   924,  1218,   147,
+     927,   928,  2012,   930,   931,   129,   158,   649,   336,  1030,
+     249,  1032,  1033,   875,  1485,  1486,   337,   913,   914,   340,
+     916,   160,   201,   129,  2035,   108,   337,  1816,   296,   340,
+    1380,   299,   108,   328,   329,   330,   331,   332,   333,   307,
+     337,   157,   962,   340,   168,   197,   962,   962,   172,   911,
+     337,   665,  1284,   340,   696,   337,   150,  2068,   340,  1291,
+    1292,   337,   168,   302,   340,  1854,   172,  1899,   337,   249,
+    2081,   340,   311,   687,   319,   320,   972,   939,   153,    14,
+      15,  1360,  1494,   725,  1363,  1364,  1365,  1366,  1367,  1368,
+    1369,  1370,  1371,  1372,  1540,    87,   337,   336,   288,   340,
+     328,   329,   330,   331,   332,   333,   334,   201,    49,   108,
+      51,   337,  1510,   311,   340,   295,  1689,   192,  1430,  1431,
+      61,   311,   302,   313,   248,   337,   337,   337,   340,   340,
+     340,   311,   336,    76,   338,   274,    60,   276,   337,  1689,
+     306,   340,   248,    70,  1689,   337,   336,   222,   340,   328,
+     329,   330,   331,   332,   333,   334,   336,   338,   108,   298,
+     341,  1081,   338,    87,   337,  1085,   337,   340,  1088,   340,
+     337,   112,  1092,   340,  1094,  1145,  1096,   157,  1098,   254,
+    1100,   122,  1102,   274,  1104,   276,  1106,   108,  1108,  1415,
+    1416,  1436,   316,  1113,  1114,   337,   123,     5,   340,   841,
+    1690,  1691,   337,   337,   337,   340,   340,   340,  1997,   851,
+     316,   853,   337,  1133,   337,   340,   143,   340,   337,     5,
+     295,   340,  1118,   337,  1693,   152,   340,   956,   957,   156,
+     324,   325,   326,   875,   328,   329,   330,   331,   332,   333,
+    1652,  1161,     5,   885,   886,  1161,  1161,     5,  1168,  1145,
+     892,   311,   193,   313,   896,   897,  1727,   899,   900,   901,
+     902,   903,     5,   337,   906,   907,   340,   909,   336,   911,
+    1739,   198,  1231,   915,  1233,  1848,   918,   218,  1510,   336,
+     922,   336,   924,  1633,  1817,   927,   928,   336,   930,   931,
+    1822,  1689,   211,  1220,  1221,  1222,  1223,   939,  1848,   913,
+     914,  2050,   916,  1848,   120,   337,     5,   337,   340,   236,
+     340,   336,  1845,   337,  1593,  1848,   340,   337,   336,     5,
+     340,   963,   964,    70,   966,   337,   968,   336,   340,   336,
+       5,    70,   336,   336,   336,  1231,  1232,  1233,     5,     5,
+     336,   336,   158,   318,    25,    72,   157,   340,   272,  1818,
+    1819,   167,  1821,   294,    25,   120,   194,   281,   972,   283,
+     284,   285,   197,   120,     8,  1923,   158,    11,    51,   198,
+     297,  1267,   193,    41,   194,   280,   123,  1273,    22,  1275,
+       8,   197,   138,    11,   123,   336,   280,   336,   204,    61,
+     280,   185,   340,  1313,    25,   336,   143,  1313,  1313,   336,
+       8,   108,  1264,    11,   143,   152,   338,    64,  1820,   156,
+     216,     9,    11,   152,  1860,   311,   278,   156,  1280,   336,
+     340,   336,   310,   282,   340,    33,   144,   144,  1897,   337,
+     336,   324,  1294,   340,   153,   254,  1298,   340,   200,   336,
+       8,   186,   297,    11,   153,  1665,  1979,  1916,  1090,   336,
+    1848,   198,   153,   207,   222,   306,  1376,   198,   336,    41,
+    1380,   385,  1382,    41,  1975,  1385,   108,  1387,  2026,  1389,
+      25,  1391,   105,  1984,  1394,   121,  1396,   293,  1398,   337,
+    1400,  1415,  1416,  1403,   337,  1405,   338,   337,  1767,   236,
+     337,  1133,   337,   337,  1136,  1137,   337,   236,   340,   336,
+     336,   385,   336,  1423,  1118,   221,   150,   187,  1977,  1429,
+     336,   336,   336,   336,  1156,   317,   280,   127,   336,   336,
+    1162,   337,   150,   336,   336,   133,  1168,  1169,   337,   336,
+     280,  1145,   456,   336,   458,   336,   460,   336,   336,   336,
+    1467,  1461,   150,   336,   280,  1461,  1461,   336,   336,   336,
+     280,   159,   337,  1195,   336,   295,  1198,   201,   482,   340,
+    1202,   485,   486,  1490,   302,   340,   490,   491,   280,   336,
+     336,   135,   108,   201,   108,   280,   337,   185,  1220,  1221,
+    1222,  1223,   150,   336,   280,  1512,  1513,  1514,  1515,  1516,
+     220,   158,   300,   201,   220,   337,   340,   198,   207,   336,
+     124,   485,   105,   317,  1466,   278,   490,   491,   337,  1505,
+      90,   135,   337,  1509,   337,  1511,  1848,  1231,  1232,  1233,
+    1899,   336,  1264,   248,   337,   172,   337,  1523,  1524,     8,
+     152,   337,    11,   201,   205,   152,   160,    41,  1280,  1281,
+     128,   289,   337,   337,   165,   165,   324,   336,  1290,    59,
+     311,   336,  1294,  1267,    33,   140,  1298,   581,   340,  1273,
+      52,  1275,   317,   337,   288,   280,   280,   337,   337,   121,
+      11,   306,   337,   337,   337,  1595,   268,   337,   336,   203,
+     324,   325,   326,   306,   328,   329,   330,   331,   332,   333,
+     340,   311,    59,   336,  1336,   311,   324,   325,   326,   623,
+     328,   329,   330,   331,   332,   333,  1626,    54,    55,   138,
+     187,   187,  1632,   237,   297,   639,   324,   325,   326,   338,
+     328,   329,   330,   331,   332,   333,   334,   106,   612,   613,
+     324,   338,   338,  1653,   338,  1655,   336,  1653,  1653,   280,
+      25,   336,    25,   336,    99,   311,  1729,   337,   632,   248,
+     274,   172,   276,   337,   133,   102,   640,   325,   326,   643,
+     328,   329,   330,   331,   332,   333,   113,   114,   652,     8,
+     294,   150,    11,   311,   298,   122,   267,   163,   163,  1421,
+     159,  1423,   706,    22,   268,   243,   336,  1429,   135,   297,
+     208,   337,   242,   242,    33,   153,   336,   280,   135,   336,
+     289,   336,    25,  1445,   336,   310,   690,   337,   289,   288,
+     337,   187,   173,  1455,   337,    65,     8,   336,   165,    11,
+     192,   198,   201,   138,  1466,  1467,  1753,    49,   198,   198,
+      22,  1473,  1474,  1729,    88,   295,  1478,    59,  1480,    61,
+      29,    33,    92,   318,   925,  1927,  1205,  1505,  1490,  1838,
+    1492,  1232,  1194,  1200,  1670,  1816,   959,  1480,  1532,  1996,
+    1509,  1624,  1848,   514,    86,    87,   987,  1941,   628,  1968,
+    1512,  1513,  1514,  1515,  1516,  2026,  1544,  2023,  2047,  2063,
+    2062,   350,  2073,  1940,   309,  1860,   849,   326,  1856,  1325,
+    1315,  1505,  1654,  1133,   133,  1509,  1740,  1511,  1540,   323,
+     247,  1576,  1544,   607,  1546,  1448,  1864,   385,  1156,  1523,
+    1524,   150,   882,   881,  1180,   533,   263,   139,  1176,  1796,
+     159,   538,  1849,  1797,   537,  1546,   273,  1863,   697,   280,
+     491,  1145,  1852,   299,    -1,  1855,  1852,  1852,    -1,  1855,
+    1855,   133,   289,   290,    -1,    -1,   185,    -1,    -1,   328,
+     329,   330,   331,   332,   333,   334,    -1,    -1,   150,   306,
+      -1,    -1,   201,   185,   203,   187,    -1,   159,    -1,    -1,
+      -1,  1898,    -1,    -1,    -1,  1895,    -1,    -1,    -1,  1895,
+    1895,    19,  1624,    -1,  1626,    23,    -1,    -1,    -1,    -1,
+    1632,    -1,    -1,   185,    32,    -1,   218,    -1,    -1,    -1,
+      -1,    -1,  1864,    -1,    -1,    -1,    -1,  1649,    -1,   201,
+      -1,   203,  1654,  1655,    52,    -1,    -1,    -1,    -1,    -1,
+      -1,   243,    -1,    -1,    -1,    -1,    -1,  1923,  1670,    -1,
+     280,    69,    -1,    -1,   284,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1905,  1964,  1687,    -1,    -1,    -1,    -1,
+      88,  1693,    -1,    -1,    -1,    -1,    94,   307,    -1,  1921,
+      -1,    -1,   100,   947,    -1,    -1,   950,   105,   952,    -1,
+      -1,   109,   294,    -1,    -1,  1995,    -1,    -1,    -1,  1995,
+    1995,    -1,    -1,    -1,  1726,   324,   325,   326,    -1,   328,
+     329,   330,   331,   332,   333,   334,    -1,  1739,  1740,   137,
+    2027,    -1,    -1,   342,   343,    -1,    -1,    -1,    -1,    -1,
+      -1,  1753,    -1,    -1,    -1,  1729,    -1,    -1,  2038,    -1,
+      -1,    -1,  2038,  2038,    -1,    -1,    -1,    -1,    -1,    -1,
+    2026,    -1,   324,   325,   326,   385,   328,   329,   330,   331,
+     332,   333,   334,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     342,    -1,    -1,    -1,    -1,    -1,   406,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     8,    -1,    -1,    11,
+      -1,    -1,    -1,    -1,  1816,  1817,  1818,  1819,   428,  1821,
+      22,    -1,    -1,    -1,   434,    -1,    -1,    -1,    -1,    -1,
+     228,    33,    -1,    -1,    -1,    -1,   446,   447,    -1,   449,
+     238,    -1,     8,  1845,    -1,    11,    -1,  1849,   246,    -1,
+      -1,   249,  1854,    -1,   464,   253,    22,   255,  1860,    -1,
+      -1,  1145,  1864,    -1,   262,    -1,    -1,    33,    -1,   267,
+      -1,    -1,   482,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     490,   491,    -1,    -1,    -1,    -1,    -1,   285,    -1,    -1,
+     500,   501,    -1,    -1,    -1,  1897,  1898,   295,    -1,  1143,
+      -1,  1145,    -1,  1905,   302,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   311,  1916,    -1,    -1,   527,    -1,  1921,
+     530,   531,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   133,    -1,    -1,   280,    -1,    -1,    -1,   336,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   150,  1923,
+      -1,    -1,    -1,  1237,    -1,    -1,    -1,   159,  1960,    -1,
+      -1,   307,  1964,    -1,    -1,    -1,    -1,   133,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,  1977,    -1,  1979,    -1,    -1,
+      -1,    -1,    -1,   185,   150,    -1,    -1,    -1,  1272,    -1,
+     600,    -1,    -1,   159,    -1,  1997,    -1,   607,    -1,   201,
+      -1,   203,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   627,    -1,   185,
+      -1,   631,    -1,   633,   634,  2027,    -1,    -1,    -1,    -1,
+    1274,   641,   642,    -1,   644,   201,   646,   203,    -1,    -1,
+    1284,    -1,    -1,    -1,   654,   655,    -1,  1291,  1292,    -1,
+      -1,    -1,  2026,    -1,   664,   665,   666,    -1,    -1,   669,
+     406,    -1,   672,   673,   674,   675,   676,   677,   678,   679,
+     680,   681,     8,    -1,    -1,    11,   686,   687,    -1,    -1,
+      -1,    -1,   428,   693,    -1,    -1,    22,   697,   434,    -1,
+      -1,     8,    -1,    -1,    11,    -1,    -1,    33,    -1,    -1,
+     446,   447,    -1,   449,  1348,    22,    -1,    -1,  1352,  1353,
+    1354,    -1,  1356,    -1,    -1,    -1,    33,    -1,   464,    -1,
+      -1,    -1,   324,   325,   326,  1409,   328,   329,   330,   331,
+     332,   333,   334,    -1,  1418,    -1,    -1,    -1,   340,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   501,    -1,    -1,   324,   325,
+     326,    -1,   328,   329,   330,   331,   332,   333,   334,  1413,
+      -1,   337,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   527,    -1,    -1,   530,   531,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   133,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   150,    -1,   133,    -1,    -1,    -1,
+      -1,    -1,    -1,   159,    -1,    -1,  1510,    -1,    -1,    -1,
+      -1,    -1,    -1,   150,    -1,    -1,    -1,    -1,  1522,   849,
+      -1,    -1,   159,    -1,    -1,    -1,  1530,  1531,    -1,   185,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   201,  1510,   203,   185,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1521,    -1,    -1,
+       3,   627,    -1,    -1,   201,     8,   203,   633,    11,    -1,
+      -1,    -1,    -1,   903,    -1,    -1,    -1,    -1,   644,    22,
+     646,    -1,    25,   913,   914,    -1,   916,    -1,   654,   655,
+      33,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   664,    -1,
+      -1,    -1,    -1,   669,    -1,    -1,   672,   673,   674,   675,
+     676,   677,   678,   679,   680,   681,    -1,    -1,    -1,    -1,
+     686,    -1,    -1,    -1,    -1,    -1,    -1,   693,    -1,    -1,
+      -1,   697,  1636,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   972,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   986,    -1,   988,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   324,   325,
+     326,   308,   328,   329,   330,   331,   332,   333,   334,    -1,
+      -1,   337,    -1,    -1,    -1,    -1,    -1,   324,   325,   326,
+     133,   328,   329,   330,   331,   332,   333,   334,    -1,    -1,
+    1030,  1031,  1032,  1033,    62,    63,    -1,   150,  1038,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   159,    -1,    -1,    -1,
+      78,    79,  1686,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   185,    -1,  1708,  1709,  1076,  1077,    -1,    -1,
+    1080,  1081,    -1,    -1,    -1,    -1,    -1,  1087,   201,  1089,
+     203,    -1,    -1,    -1,    -1,    -1,  1730,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   134,    -1,    -1,    -1,
+      -1,    -1,     8,   849,    -1,    11,    -1,    -1,  1118,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    -1,  1128,  1129,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+    1140,    -1,    -1,    -1,    -1,  1145,   174,   175,   176,   177,
+      -1,    -1,  1152,    -1,    -1,    -1,    -1,    -1,  1158,    -1,
+      -1,    -1,    -1,    -1,   192,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,  1848,    -1,  1176,    -1,    -1,    -1,
+    1180,   209,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,  1191,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   230,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   324,   325,   326,  1848,   328,   329,   330,   331,   332,
+     333,   334,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,  1231,  1232,  1233,    -1,    -1,    -1,   133,    -1,   267,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     986,    -1,   988,    -1,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   159,    -1,    -1,    -1,  1267,    -1,    -1,
+      -1,    -1,    -1,  1273,    -1,  1275,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   450,    -1,    -1,    -1,    -1,    -1,   185,
+      -1,    -1,    -1,    -1,  1030,    -1,  1032,  1033,    -1,    -1,
+      -1,    -1,  1038,    -1,    -1,   201,    -1,   203,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1317,    -1,    -1,
+      -1,    -1,  1322,    -1,  1958,  1325,    -1,    -1,  1328,    -1,
+      -1,    -1,    -1,    -1,  1334,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   510,    -1,  1345,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1089,    -1,    -1,    -1,    -1,    -1,    -1,
+    1360,    -1,    -1,  1363,  1364,  1365,  1366,  1367,  1368,  1369,
+    1370,  1371,  1372,    -1,    -1,    -1,  1376,    -1,  1378,    -1,
+    1380,    -1,    -1,    -1,    -1,  1385,    -1,  1387,    -1,  1389,
+      -1,  1391,  1128,  1129,  1394,    -1,  1396,    -1,  1398,    -1,
+    1400,    -1,  1402,  1403,  1140,  1405,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,  1152,     8,    -1,    -1,
+      11,    -1,  1158,    -1,    -1,    -1,    -1,    -1,   324,   325,
+     326,    22,   328,   329,   330,   331,   332,   333,   334,    -1,
+    1176,   337,    33,    -1,  1180,    -1,    -1,  1447,  1448,    -1,
+      -1,    -1,    -1,    -1,    -1,  1191,    -1,    -1,    -1,    -1,
+      -1,   628,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1473,    -1,    -1,    -1,    -1,   645,    -1,
+      -1,    -1,    -1,   650,    -1,    -1,    -1,    -1,    -1,   656,
+     657,   658,    -1,    -1,    -1,  1495,    -1,    -1,    -1,   666,
+      -1,    -1,    -1,    -1,    -1,  1505,    -1,    -1,    -1,  1509,
+    1510,  1511,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1523,  1524,    -1,    -1,    -1,   695,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   133,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   159,    -1,
+      -1,     8,    -1,    -1,    11,    -1,    -1,    -1,    -1,    -1,
+      -1,  1317,    -1,    -1,    -1,    22,  1322,    -1,    -1,  1325,
+      -1,    -1,  1328,  1593,   185,  1595,    33,  1597,  1334,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     201,    -1,   203,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1633,  1634,    -1,    -1,    -1,    -1,    -1,
+    1376,    -1,  1378,    -1,    -1,    -1,    -1,    -1,    -1,  1385,
+      -1,  1387,    -1,  1389,     8,  1391,    -1,    11,  1394,    -1,
+    1396,  1661,  1398,    -1,  1400,    -1,  1402,  1403,    22,  1405,
+      -1,   838,    -1,    -1,    -1,    -1,    -1,    -1,     8,    33,
+      -1,    11,    -1,  1683,    -1,    -1,    -1,    -1,    -1,   856,
+      -1,    -1,    22,    -1,    -1,    -1,   133,    -1,    -1,   866,
+      -1,   868,    -1,    33,    -1,    -1,  1706,    -1,    -1,    -1,
+      -1,  1447,  1448,   150,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   159,    -1,    -1,    -1,    -1,    -1,    -1,  1729,
+      -1,    -1,    -1,   324,   325,   326,    -1,   328,   329,   330,
+     331,   332,   333,   334,    -1,    -1,   337,    -1,   185,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1495,
+      -1,    -1,    -1,    -1,   201,    -1,   203,  1767,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   133,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1789,
+      -1,    -1,    -1,    -1,  1794,  1795,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,   133,  1804,   159,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,  1816,    -1,   985,    -1,
+     150,    -1,  1822,    -1,   991,    -1,    -1,   994,    -1,   159,
+      -1,   185,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     8,
+      -1,    -1,    11,  1843,    -1,    -1,  1013,   201,  1848,   203,
+      -1,    -1,    -1,    22,  1854,   185,    -1,    -1,    -1,  1595,
+      -1,  1597,  1029,    -1,    33,    -1,    -1,  1034,    -1,    -1,
+      -1,   201,    -1,   203,    -1,    -1,    -1,    -1,    -1,  1879,
+      -1,    -1,  1882,    -1,    -1,    -1,    -1,   324,   325,   326,
+      -1,   328,   329,   330,   331,   332,   333,   334,  1634,  1899,
+     337,    -1,    -1,    -1,    -1,    -1,    -1,  1074,    -1,  1076,
+    1077,  1078,    -1,  1080,    -1,    -1,    -1,    -1,    -1,  1086,
+    1087,    -1,    -1,  1923,  1091,  1661,  1093,    -1,  1095,    -1,
+    1097,    -1,  1099,    -1,  1101,    -1,  1103,    -1,  1105,    -1,
+    1107,    -1,  1109,    -1,    -1,    -1,    -1,  1683,  1115,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1963,   133,    -1,  1966,    -1,    -1,    -1,
+     324,   325,   326,    -1,   328,   329,   330,   331,   332,   333,
+     334,   150,    -1,   337,    -1,    -1,    -1,    -1,    -1,    -1,
+     159,    -1,    -1,    -1,   324,   325,   326,  1997,   328,   329,
+     330,   331,   332,   333,   334,    -1,    -1,   337,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,  2026,    -1,    -1,    -1,
+      -1,    -1,   201,    -1,   203,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,  2044,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1789,    -1,    -1,    -1,    -1,  1794,  1795,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1804,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,  1822,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1843,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     8,    -1,
+      -1,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,  1879,    -1,    -1,  1882,    -1,    -1,    -1,
+      -1,    -1,  1319,    33,    -1,   324,   325,   326,    -1,   328,
+     329,   330,   331,   332,   333,   334,    -1,     8,   337,    -1,
+      11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    1347,    22,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    1357,  1358,    33,  1360,    -1,    -1,  1363,  1364,  1365,  1366,
+    1367,  1368,  1369,  1370,  1371,  1372,  1373,     8,    -1,    -1,
+      11,    -1,  1379,    -1,    -1,    -1,  1383,    -1,    -1,    -1,
+      -1,    22,    -1,    -1,    -1,    -1,    -1,  1963,    -1,    -1,
+    1966,    -1,    33,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   133,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,  1433,    -1,    -1,    -1,
+     150,    -1,    -1,    -1,    -1,    -1,  1443,    -1,    -1,   159,
+      -1,    -1,    -1,    -1,  1451,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   133,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,  1468,    -1,    -1,    -1,   185,    -1,    -1,  2044,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   159,    -1,
+      -1,   201,    -1,   203,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   133,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,    -1,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   159,    -1,
+     201,     8,   203,    -1,    11,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   185,    -1,    33,    -1,  1555,    -1,
+    1557,    -1,  1559,  1560,    -1,    -1,    -1,    -1,    -1,    -1,
+     201,    -1,   203,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,  1578,    -1,  1580,  1581,  1582,  1583,  1584,  1585,  1586,
+    1587,  1588,  1589,    -1,  1591,  1592,  1593,    -1,    -1,    -1,
+      -1,    -1,  1599,  1600,  1601,  1602,  1603,  1604,  1605,  1606,
+    1607,  1608,  1609,    -1,   324,   325,   326,    -1,   328,   329,
+     330,   331,   332,   333,   334,     8,    -1,   337,    11,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,   324,   325,   326,   133,   328,   329,   330,
+     331,   332,   333,   334,    -1,    -1,   337,    -1,    -1,    -1,
+      -1,    -1,    -1,   150,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   159,    34,    35,    36,    37,    38,    39,    -1,
+      -1,    -1,    -1,   324,   325,   326,    47,   328,   329,   330,
+     331,   332,   333,   334,    -1,    -1,   337,    -1,   185,    -1,
+      -1,    -1,    -1,    -1,    65,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   201,    -1,   203,    -1,    -1,    -1,
+      81,    -1,    -1,    84,    85,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    93,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     133,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   150,   119,    -1,
+    1767,    -1,  1769,    -1,  1771,  1772,   159,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   145,  1792,    -1,   148,   149,    -1,
+      -1,    -1,   185,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   164,    -1,    -1,    -1,  1814,   201,    -1,
+     203,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   179,   180,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1834,   189,   190,
+     191,    -1,    -1,    -1,    -1,    -1,    -1,   324,   325,   326,
+      -1,   328,   329,   330,   331,   332,   333,   334,    -1,    -1,
+     337,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     221,    -1,   223,    -1,    -1,    -1,    -1,    -1,    -1,  1876,
+      -1,  1878,    -1,    -1,    -1,    -1,  1883,  1884,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1899,    -1,    -1,    -1,    -1,   258,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   279,    -1,
+      -1,  1928,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   324,   325,   326,    -1,   328,   329,   330,   331,   332,
+     333,   334,   303,   304,   337,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1959,    -1,  1961,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1969,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,    -1,    -1,     8,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    18,    19,    20,
+      21,    -1,    23,    -1,    -1,    -1,    -1,    28,    29,    30,
+      31,    32,  2009,    34,    35,    36,    37,    38,    39,    -1,
+      -1,    42,    43,    44,    -1,    46,    47,    48,    -1,    -1,
+      -1,    52,    -1,    54,    55,    56,    57,    -1,    -1,    60,
+      -1,    62,    63,    64,    65,    66,    -1,    68,    -1,    70,
+      71,    -1,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    -1,    -1,    -1,  2065,    90,
+      -1,    92,    93,    -1,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,    -1,   105,   106,   107,   108,    -1,   110,
+     111,   112,   113,   114,   115,   116,    -1,    -1,   119,    -1,
+      -1,    -1,   123,   124,    -1,   126,    -1,    -1,    -1,    -1,
+     131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,
+     141,   142,   143,   144,   145,    -1,    -1,   148,   149,    -1,
+     151,   152,   153,    -1,   155,   156,   157,   158,    -1,   160,
+     161,    -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,
+      -1,   172,   173,   174,   175,   176,   177,   178,   179,   180,
+     181,   182,    -1,    -1,   185,    -1,   187,   188,   189,   190,
+     191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,
+     201,    -1,    -1,    -1,   205,   206,   207,   208,   209,    -1,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
+      -1,   222,   223,    -1,   225,   226,   227,   228,    -1,   230,
+     231,   232,   233,    -1,   235,   236,   237,   238,    -1,   240,
+     241,    -1,    -1,   244,   245,   246,   247,   248,    -1,   250,
+      -1,   252,    -1,   254,   255,    -1,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,    -1,   268,    -1,    -1,
+     271,   272,    -1,   274,   275,   276,    -1,   278,   279,    -1,
+      -1,   282,   283,   284,   285,    -1,    -1,   288,   289,   290,
+      -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,
+      -1,    -1,   303,    -1,   305,   306,   307,   308,    -1,    -1,
+      -1,   312,   313,   314,   315,   316,   317,    -1,    -1,    -1,
+      -1,     3,    -1,    -1,    -1,    -1,    -1,   328,   329,   330,
+      -1,    -1,    -1,    -1,    -1,   336,   337,    19,    20,    21,
+      -1,    23,    -1,    25,    -1,    -1,    -1,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    -1,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    -1,    -1,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    75,    -1,    77,    78,    79,    80,    81,
+      82,    -1,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,    -1,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,   120,    -1,
+      -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,    -1,   144,   145,    -1,    -1,    -1,   149,    -1,   151,
+      -1,   153,    -1,    -1,    -1,    -1,   158,    -1,   160,    -1,
+      -1,   163,   164,   165,    -1,   167,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,   204,    -1,   206,   207,   208,   209,    -1,   211,
+     212,    -1,   214,    -1,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,    -1,   237,   238,    -1,    -1,    -1,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+      -1,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,    -1,
+      -1,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,    -1,    -1,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,   293,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+      -1,   303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,     3,     4,     5,    -1,
+      -1,     8,     9,    10,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    19,    20,    21,   337,    23,    -1,    -1,    -1,
+      -1,    28,    29,    30,    31,    32,    -1,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    43,    44,    -1,    46,
+      47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,
+      57,    -1,    -1,    60,    -1,    62,    63,    64,    65,    66,
+      -1,    68,    -1,    70,    71,    -1,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,    -1,   105,   106,
+     107,   108,    -1,   110,   111,   112,   113,   114,   115,   116,
+      -1,    -1,   119,    -1,   121,    -1,   123,   124,    -1,   126,
+      -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,
+      -1,   138,    -1,   140,   141,   142,   143,   144,   145,    -1,
+      -1,   148,   149,    -1,   151,   152,   153,   154,   155,   156,
+     157,   158,    -1,   160,   161,    -1,   163,   164,   165,    -1,
+      -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,    -1,    -1,   185,    -1,
+     187,   188,   189,   190,   191,   192,   193,    -1,   195,    -1,
+     197,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,
+     207,   208,   209,    -1,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,    -1,   222,   223,    -1,   225,   226,
+     227,   228,    -1,   230,   231,   232,   233,    -1,   235,   236,
+     237,   238,    -1,   240,   241,    -1,    -1,   244,   245,   246,
+     247,   248,    -1,   250,    -1,   252,    -1,   254,   255,    -1,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+      -1,   268,    -1,    -1,   271,   272,    -1,   274,   275,   276,
+      -1,   278,   279,    -1,   281,   282,   283,   284,   285,    -1,
+      -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,
+      -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,   306,
+     307,   308,    -1,    -1,    -1,   312,   313,   314,   315,   316,
+     317,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,   328,   329,     8,     9,    10,    -1,    -1,    -1,   336,
+      -1,    -1,    -1,    -1,    19,    20,    21,    -1,    23,    -1,
+      -1,    -1,    -1,    28,    29,    30,    31,    32,    -1,    34,
+      35,    36,    37,    38,    39,    -1,    -1,    42,    43,    44,
+      -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,    54,
+      55,    56,    57,    -1,    -1,    60,    -1,    62,    63,    64,
+      65,    66,    -1,    68,    -1,    70,    71,    -1,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,    -1,
+     105,   106,   107,   108,    -1,   110,   111,   112,   113,   114,
+     115,   116,    -1,    -1,   119,    -1,    -1,    -1,   123,   124,
+      -1,   126,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,
+     135,    -1,    -1,   138,    -1,   140,   141,   142,   143,   144,
+     145,    -1,    -1,   148,   149,    -1,   151,   152,   153,    -1,
+     155,   156,   157,   158,    -1,   160,   161,    -1,   163,   164,
+     165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,    -1,    -1,
+     185,    -1,   187,   188,   189,   190,   191,   192,   193,    -1,
+     195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,
+     205,   206,   207,   208,   209,    -1,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,    -1,   222,   223,    -1,
+     225,   226,   227,   228,    -1,   230,   231,   232,   233,    -1,
+     235,   236,   237,   238,    -1,   240,   241,    -1,    -1,   244,
+     245,   246,   247,   248,   249,   250,    -1,   252,    -1,   254,
+     255,    -1,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,    -1,   268,    -1,    -1,   271,   272,    -1,   274,
+     275,   276,    -1,   278,   279,    -1,    -1,   282,   283,   284,
+     285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,
+      -1,    -1,    -1,   298,   299,   300,    -1,   302,   303,    -1,
+     305,   306,   307,   308,    -1,    -1,   311,   312,   313,   314,
+     315,   316,   317,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,   328,   329,     8,     9,    10,    -1,    -1,
+      -1,   336,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,
+      23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,    32,
+      -1,    34,    35,    36,    37,    38,    39,    -1,    -1,    42,
+      43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,
+      -1,    54,    55,    56,    57,    -1,    -1,    60,    -1,    62,
+      63,    64,    65,    66,    -1,    68,    -1,    70,    71,    -1,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,
+      93,    -1,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,    -1,   105,   106,   107,   108,    -1,   110,   111,   112,
+     113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,
+     123,   124,    -1,   126,    -1,    -1,    -1,    -1,   131,    -1,
+      -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,
+     143,   144,   145,    -1,    -1,   148,   149,    -1,   151,   152,
+     153,    -1,   155,   156,   157,   158,    -1,   160,   161,    -1,
+     163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
+      -1,    -1,   185,    -1,   187,   188,   189,   190,   191,   192,
+     193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,
+      -1,    -1,   205,   206,   207,   208,   209,    -1,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   220,    -1,   222,
+     223,    -1,   225,   226,   227,   228,    -1,   230,   231,   232,
+     233,    -1,   235,   236,   237,   238,    -1,   240,   241,    -1,
+      -1,   244,   245,   246,   247,   248,    -1,   250,    -1,   252,
+      -1,   254,   255,    -1,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,    -1,   268,    -1,    -1,   271,   272,
+      -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,   282,
+     283,   284,   285,    -1,    -1,   288,   289,   290,    -1,   292,
+      -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,    -1,
+     303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,
+     313,   314,   315,   316,   317,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   328,   329,   330,    -1,     3,
+       4,     5,    -1,   336,     8,     9,    10,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,    23,
+      -1,    -1,    -1,    -1,    28,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      54,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    66,    -1,    68,    -1,    70,    71,    -1,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,   105,   106,   107,   108,    -1,   110,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,   123,
+     124,    -1,   126,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,   143,
+     144,   145,    -1,    -1,   148,   149,    -1,   151,   152,   153,
+      -1,   155,   156,   157,   158,    -1,   160,   161,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,    -1,
+      -1,   185,    -1,   187,   188,   189,   190,   191,   192,   193,
+      -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,
+      -1,   205,   206,   207,   208,   209,    -1,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,   232,   233,
+      -1,   235,   236,   237,   238,    -1,   240,   241,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,   252,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,   271,   272,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,   283,
+     284,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,    -1,   303,
+      -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,   313,
+     314,   315,   316,   317,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,   328,   329,     8,     9,    10,    -1,
+      -1,    -1,   336,    -1,    -1,    -1,    18,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    54,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    66,    -1,    68,    -1,    70,    71,
+      -1,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,   110,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,
+      -1,   123,   124,    -1,   126,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,   143,   144,   145,    -1,    -1,   148,   149,    -1,   151,
+     152,   153,    -1,   155,   156,   157,   158,    -1,   160,   161,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,    -1,    -1,   185,    -1,   187,   188,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,    -1,   205,   206,   207,   208,   209,    -1,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,   236,   237,   238,    -1,   240,   241,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+     252,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,   271,
+     272,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,   283,   284,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+      -1,   303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,   328,   329,     8,     9,
+      10,    -1,    -1,    -1,   336,    -1,    -1,    -1,    -1,    19,
+      20,    21,    -1,    23,    -1,    -1,    -1,    -1,    28,    29,
+      30,    31,    32,    -1,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    48,    -1,
+      -1,    -1,    52,    -1,    54,    55,    56,    57,    -1,    -1,
+      60,    -1,    62,    63,    64,    65,    66,    -1,    68,    -1,
+      70,    71,    -1,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,    -1,   105,   106,   107,   108,    -1,
+     110,   111,   112,   113,   114,   115,   116,    -1,    -1,   119,
+      -1,   121,    -1,   123,   124,    -1,   126,    -1,    -1,    -1,
+      -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,
+     140,   141,   142,   143,   144,   145,    -1,    -1,   148,   149,
+      -1,   151,   152,   153,    -1,   155,   156,   157,   158,    -1,
+     160,   161,    -1,   163,   164,   165,    -1,    -1,   168,    -1,
+      -1,    -1,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,    -1,    -1,   185,    -1,   187,   188,   189,
+     190,   191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,
+      -1,   201,    -1,    -1,    -1,   205,   206,   207,   208,   209,
+      -1,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     220,    -1,   222,   223,    -1,   225,   226,   227,   228,    -1,
+     230,   231,   232,   233,    -1,   235,   236,   237,   238,    -1,
+     240,   241,    -1,    -1,   244,   245,   246,   247,   248,    -1,
+     250,    -1,   252,    -1,   254,   255,    -1,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,    -1,   268,    -1,
+      -1,   271,   272,    -1,   274,   275,   276,    -1,   278,   279,
+      -1,    -1,   282,   283,   284,   285,    -1,    -1,   288,   289,
+     290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,
+     300,    -1,    -1,   303,    -1,   305,   306,   307,   308,    -1,
+      -1,    -1,   312,   313,   314,   315,   316,   317,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,   328,   329,
+       8,     9,    10,    -1,    -1,    -1,   336,    -1,    -1,    -1,
+      -1,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      28,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    66,    -1,
+      68,    -1,    70,    71,    -1,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,   110,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,   123,   124,    -1,   126,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,   143,   144,   145,    -1,    -1,
+     148,   149,    -1,   151,   152,   153,    -1,   155,   156,   157,
+     158,    -1,   160,   161,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,    -1,    -1,   185,    -1,   187,
+     188,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,   207,
+     208,   209,    -1,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,   236,   237,
+     238,    -1,   240,   241,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,   252,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,   271,   272,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,   283,   284,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,
+     298,   299,   300,    -1,    -1,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+     328,   329,     8,     9,    10,    -1,    -1,    -1,   336,    -1,
+      -1,    -1,    -1,    19,    20,    21,    -1,    23,    -1,    -1,
+      -1,    -1,    28,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      66,    -1,    68,    -1,    70,    71,    -1,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,   105,
+     106,   107,   108,    -1,   110,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,
+     126,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,   143,   144,   145,
+      -1,    -1,   148,   149,    -1,   151,   152,   153,    -1,   155,
+     156,   157,   158,    -1,   160,   161,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,    -1,    -1,   185,
+      -1,   187,   188,   189,   190,   191,   192,   193,    -1,   195,
+      -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,
+     206,   207,   208,   209,    -1,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,   232,   233,    -1,   235,
+     236,   237,   238,    -1,   240,   241,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,   252,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,   271,   272,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,   283,   284,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,
+     306,   307,   308,    -1,    -1,    -1,   312,   313,   314,   315,
+     316,   317,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,   328,   329,     8,     9,    10,    -1,    -1,    -1,
+     336,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,    23,
+      -1,    -1,    -1,    -1,    28,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      54,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    66,    -1,    68,    -1,    70,    71,    -1,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,   105,   106,   107,   108,    -1,   110,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,   123,
+     124,    -1,   126,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,   143,
+     144,   145,    -1,    -1,   148,   149,    -1,   151,   152,   153,
+      -1,   155,   156,   157,   158,    -1,   160,   161,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,    -1,
+      -1,   185,    -1,   187,   188,   189,   190,   191,   192,   193,
+      -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,
+      -1,   205,   206,   207,   208,   209,    -1,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,   232,   233,
+      -1,   235,   236,   237,   238,    -1,   240,   241,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,   252,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,   271,   272,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,   283,
+     284,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,    -1,   303,
+      -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,   313,
+     314,   315,   316,   317,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,   328,   329,     8,     9,    10,    -1,
+      -1,    -1,   336,    -1,    -1,    -1,    -1,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    54,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    66,    -1,    68,    -1,    70,    71,
+      -1,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,   110,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,
+      -1,   123,   124,    -1,   126,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,   143,   144,   145,    -1,    -1,   148,   149,    -1,   151,
+     152,   153,    -1,   155,   156,   157,   158,    -1,   160,   161,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,    -1,    -1,   185,    -1,   187,   188,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,    -1,   205,   206,   207,   208,   209,    -1,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,   236,   237,   238,    -1,   240,   241,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+     252,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,   271,
+     272,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,   283,   284,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+      -1,   303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,   328,   329,     8,     9,
+      10,    -1,    -1,    -1,   336,    -1,    -1,    -1,    -1,    19,
+      20,    21,    -1,    23,    -1,    -1,    -1,    -1,    28,    29,
+      30,    31,    32,    -1,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    48,    -1,
+      -1,    -1,    52,    -1,    54,    55,    56,    57,    -1,    -1,
+      60,    -1,    62,    63,    64,    65,    66,    -1,    68,    -1,
+      70,    71,    -1,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,    -1,   105,   106,   107,   108,    -1,
+     110,   111,   112,   113,   114,   115,   116,    -1,    -1,   119,
+      -1,    -1,    -1,   123,   124,    -1,   126,    -1,    -1,    -1,
+      -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,
+     140,   141,   142,   143,   144,   145,    -1,    -1,   148,   149,
+      -1,   151,   152,   153,    -1,   155,   156,   157,   158,    -1,
+     160,   161,    -1,   163,   164,   165,    -1,    -1,   168,    -1,
+      -1,    -1,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,    -1,    -1,   185,    -1,   187,   188,   189,
+     190,   191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,
+      -1,   201,    -1,    -1,    -1,   205,   206,   207,   208,   209,
+      -1,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     220,    -1,   222,   223,    -1,   225,   226,   227,   228,    -1,
+     230,   231,   232,   233,    -1,   235,   236,   237,   238,    -1,
+     240,   241,    -1,    -1,   244,   245,   246,   247,   248,    -1,
+     250,    -1,   252,    -1,   254,   255,    -1,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,    -1,   268,    -1,
+      -1,   271,   272,    -1,   274,   275,   276,    -1,   278,   279,
+      -1,    -1,   282,   283,   284,   285,    -1,    -1,   288,   289,
+     290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,
+     300,    -1,    -1,   303,    -1,   305,   306,   307,   308,    -1,
+      -1,    -1,   312,   313,   314,   315,   316,   317,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,   328,   329,
+       8,     9,    10,    -1,    -1,    -1,   336,    -1,    -1,    -1,
+      -1,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      28,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    66,    -1,
+      68,    -1,    70,    71,    -1,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,   110,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,   123,   124,    -1,   126,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,   143,   144,   145,    -1,    -1,
+     148,   149,    -1,   151,   152,   153,    -1,   155,   156,   157,
+     158,    -1,   160,   161,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,    -1,    -1,   185,    -1,   187,
+     188,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,   207,
+     208,   209,    -1,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,   236,   237,
+     238,    -1,   240,   241,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,   252,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,   271,   272,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,   283,   284,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,
+     298,   299,   300,    -1,    -1,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+     328,   329,     8,     9,    10,    -1,    -1,    -1,   336,    -1,
+      -1,    -1,    -1,    19,    20,    21,    -1,    23,    -1,    -1,
+      -1,    -1,    28,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      66,    -1,    68,    -1,    70,    71,    -1,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,   105,
+     106,   107,   108,    -1,   110,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,
+     126,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,   143,   144,   145,
+      -1,    -1,   148,   149,    -1,   151,   152,   153,    -1,   155,
+     156,   157,   158,    -1,   160,   161,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,    -1,    -1,   185,
+      -1,   187,   188,   189,   190,   191,   192,   193,    -1,   195,
+      -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,
+     206,   207,   208,   209,    -1,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,   232,   233,    -1,   235,
+     236,   237,   238,    -1,   240,   241,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,   252,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,   271,   272,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,   283,   284,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,
+     306,   307,   308,    -1,    -1,    -1,   312,   313,   314,   315,
+     316,   317,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,   328,   329,     8,     9,    10,    -1,    -1,    -1,
+     336,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,    23,
+      -1,    -1,    -1,    -1,    28,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      54,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    66,    -1,    68,    -1,    70,    71,    -1,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,   105,   106,   107,   108,    -1,   110,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,   123,
+     124,    -1,   126,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,   143,
+     144,   145,    -1,    -1,   148,   149,    -1,   151,   152,   153,
+      -1,   155,   156,   157,   158,    -1,   160,   161,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,    -1,
+      -1,   185,    -1,   187,   188,   189,   190,   191,   192,   193,
+      -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,
+      -1,   205,   206,   207,   208,   209,    -1,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,   232,   233,
+      -1,   235,   236,   237,   238,    -1,   240,   241,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,   252,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,   271,   272,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,   283,
+     284,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,    -1,   303,
+      -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,   313,
+     314,   315,   316,   317,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,   328,   329,     8,     9,    10,    -1,
+      -1,    -1,   336,    -1,    -1,    -1,    -1,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    54,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    66,    -1,    68,    -1,    70,    71,
+      -1,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,   110,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,
+      -1,   123,   124,    -1,   126,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,   143,   144,   145,    -1,    -1,   148,   149,    -1,   151,
+     152,   153,    -1,   155,   156,   157,   158,    -1,   160,   161,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,    -1,    -1,   185,    -1,   187,   188,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,    -1,   205,   206,   207,   208,   209,    -1,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,   236,   237,   238,    -1,   240,   241,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+     252,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,   271,
+     272,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,   283,   284,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+      -1,   303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,   328,   329,     8,     9,
+      10,    -1,    -1,    -1,   336,    -1,    -1,    -1,    -1,    19,
+      20,    21,    -1,    23,    -1,    -1,    -1,    -1,    28,    29,
+      30,    31,    32,    -1,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    48,    -1,
+      -1,    -1,    52,    -1,    54,    55,    56,    57,    -1,    -1,
+      60,    -1,    62,    63,    64,    65,    66,    -1,    68,    -1,
+      70,    71,    -1,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,    -1,   105,   106,   107,   108,    -1,
+     110,   111,   112,   113,   114,   115,   116,    -1,    -1,   119,
+      -1,    -1,    -1,   123,   124,    -1,   126,    -1,    -1,    -1,
+      -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,
+     140,   141,   142,   143,   144,   145,    -1,    -1,   148,   149,
+      -1,   151,   152,   153,    -1,   155,   156,   157,   158,    -1,
+     160,   161,    -1,   163,   164,   165,    -1,    -1,   168,    -1,
+      -1,    -1,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,    -1,    -1,   185,    -1,   187,   188,   189,
+     190,   191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,
+      -1,   201,    -1,    -1,    -1,   205,   206,   207,   208,   209,
+      -1,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     220,    -1,   222,   223,    -1,   225,   226,   227,   228,    -1,
+     230,   231,   232,   233,    -1,   235,   236,   237,   238,    -1,
+     240,   241,    -1,    -1,   244,   245,   246,   247,   248,    -1,
+     250,    -1,   252,    -1,   254,   255,    -1,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,    -1,   268,    -1,
+      -1,   271,   272,    -1,   274,   275,   276,    -1,   278,   279,
+      -1,    -1,   282,   283,   284,   285,    -1,    -1,   288,   289,
+     290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,
+     300,    -1,    -1,   303,    -1,   305,   306,   307,   308,    -1,
+      -1,    -1,   312,   313,   314,   315,   316,   317,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,   328,   329,
+       8,     9,    10,    -1,    -1,    -1,   336,    -1,    -1,    -1,
+      -1,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      28,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    66,    -1,
+      68,    -1,    70,    71,    -1,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,   110,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,   123,   124,    -1,   126,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,   143,   144,   145,    -1,    -1,
+     148,   149,    -1,   151,   152,   153,    -1,   155,   156,   157,
+     158,    -1,   160,   161,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,    -1,    -1,   185,    -1,   187,
+     188,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,   207,
+     208,   209,    -1,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,   236,   237,
+     238,    -1,   240,   241,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,   252,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,   271,   272,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,   283,   284,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,
+     298,   299,   300,    -1,    -1,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+     328,   329,     8,     9,    10,    -1,    -1,    -1,   336,    -1,
+      -1,    -1,    -1,    19,    20,    21,    -1,    23,    -1,    -1,
+      -1,    -1,    28,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      66,    -1,    68,    -1,    70,    71,    -1,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,   105,
+     106,   107,   108,    -1,   110,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,
+     126,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,   143,   144,   145,
+      -1,    -1,   148,   149,    -1,   151,   152,   153,    -1,   155,
+     156,   157,   158,    -1,   160,   161,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,    -1,    -1,   185,
+      -1,   187,   188,   189,   190,   191,   192,   193,    -1,   195,
+      -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,
+     206,   207,   208,   209,    -1,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,   232,   233,    -1,   235,
+     236,   237,   238,    -1,   240,   241,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,   252,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,   271,   272,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,   283,   284,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,
+     306,   307,   308,    -1,    -1,    -1,   312,   313,   314,   315,
+     316,   317,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,   328,   329,     8,     9,    10,    -1,    -1,    -1,
+     336,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,    23,
+      -1,    -1,    -1,    -1,    28,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      54,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    66,    -1,    68,    -1,    70,    71,    -1,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,   105,   106,   107,   108,    -1,   110,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,   123,
+     124,    -1,   126,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,   143,
+     144,   145,    -1,    -1,   148,   149,    -1,   151,   152,   153,
+      -1,   155,   156,   157,   158,    -1,   160,   161,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,    -1,
+      -1,   185,    -1,   187,   188,   189,   190,   191,   192,   193,
+      -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,
+      -1,   205,   206,   207,   208,   209,    -1,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,   232,   233,
+      -1,   235,   236,   237,   238,    -1,   240,   241,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,   252,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,   271,   272,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,   283,
+     284,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,    -1,   303,
+      -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,   313,
+     314,   315,   316,   317,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,   328,   329,     8,     9,    10,    -1,
+      -1,    -1,   336,    -1,    -1,    -1,    -1,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    54,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    66,    -1,    68,    -1,    70,    71,
+      -1,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,   110,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,
+      -1,   123,   124,    -1,   126,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,   143,   144,   145,    -1,    -1,   148,   149,    -1,   151,
+     152,   153,    -1,   155,   156,   157,   158,    -1,   160,   161,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,    -1,    -1,   185,    -1,   187,   188,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,    -1,   205,   206,   207,   208,   209,    -1,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,   236,   237,   238,    -1,   240,   241,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+     252,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,   271,
+     272,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,   283,   284,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+      -1,   303,    -1,   305,   306,   307,    -1,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,   328,   329,     8,     9,
+      10,    -1,    -1,    -1,   336,    -1,    -1,    -1,    -1,    19,
+      20,    21,    -1,    23,    -1,    -1,    -1,    -1,    28,    29,
+      30,    31,    32,    -1,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    48,    -1,
+      -1,    -1,    52,    -1,    54,    55,    56,    57,    -1,    -1,
+      60,    -1,    62,    63,    64,    65,    66,    -1,    68,    -1,
+      70,    71,    -1,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,    -1,   105,   106,   107,   108,    -1,
+     110,   111,   112,   113,   114,   115,   116,    -1,    -1,   119,
+      -1,    -1,    -1,   123,   124,    -1,   126,    -1,    -1,    -1,
+      -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,
+     140,   141,   142,   143,   144,   145,    -1,    -1,   148,   149,
+      -1,   151,   152,   153,    -1,   155,   156,   157,   158,    -1,
+     160,   161,    -1,   163,   164,   165,    -1,    -1,   168,    -1,
+      -1,    -1,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,
+      -1,   201,    -1,    -1,    -1,   205,   206,   207,   208,   209,
+      -1,   211,   212,    -1,   214,   215,   216,   217,   218,   219,
+     220,    -1,   222,   223,    -1,   225,   226,   227,   228,    -1,
+     230,   231,   232,   233,    -1,   235,   236,   237,   238,    -1,
+     240,   241,    -1,    -1,   244,   245,   246,   247,   248,    -1,
+     250,    -1,   252,    -1,   254,   255,    -1,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,    -1,   268,    -1,
+      -1,   271,   272,    -1,   274,   275,   276,    -1,   278,   279,
+      -1,    -1,   282,   283,   284,   285,    -1,    -1,   288,   289,
+     290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,
+     300,    -1,    -1,   303,    -1,   305,   306,   307,   308,    -1,
+      -1,    -1,   312,   313,   314,   315,   316,   317,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,   328,   329,
+       8,     9,    10,    -1,    -1,    -1,   336,    -1,    -1,    -1,
+      -1,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      28,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    66,    -1,
+      68,    -1,    70,    71,    -1,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,   110,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,   123,   124,    -1,   126,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,   143,   144,   145,    -1,    -1,
+     148,   149,    -1,   151,   152,   153,    -1,   155,   156,   157,
+      -1,    -1,   160,   161,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,    -1,    -1,   185,    -1,   187,
+     188,   189,   190,   191,   192,   193,    -1,   195,    -1,    -1,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,   207,
+     208,   209,    -1,   211,   212,   213,   214,   215,   216,   217,
+      -1,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,    -1,    -1,    -1,   235,   236,   237,
+     238,    -1,   240,   241,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,   252,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,   271,   272,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,   283,   284,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,
+     298,   299,   300,    -1,    -1,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+     328,   329,     8,     9,    10,    -1,    -1,    -1,   336,    -1,
+      -1,    -1,    -1,    19,    20,    21,    -1,    23,    -1,    -1,
+      -1,    -1,    28,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      66,    -1,    68,    -1,    70,    71,    -1,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,    -1,
+      -1,   107,   108,    -1,   110,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,
+     126,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,   143,   144,   145,
+      -1,    -1,   148,   149,    -1,   151,   152,   153,    -1,   155,
+     156,   157,    -1,    -1,   160,   161,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,   193,    -1,   195,
+      -1,    -1,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,
+     206,   207,   208,   209,    -1,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,    -1,    -1,    -1,   235,
+     236,   237,   238,    -1,   240,   241,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,   252,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,   271,   272,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,   283,   284,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,
+     306,   307,    -1,    -1,    -1,    -1,   312,   313,   314,   315,
+     316,   317,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,   328,   329,     8,     9,    10,    -1,    -1,    -1,
+     336,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,    23,
+      -1,    -1,    -1,    -1,    28,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      54,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    66,    -1,    68,    -1,    70,    71,    -1,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,    -1,    -1,   107,   108,    -1,   110,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,   123,
+     124,    -1,   126,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,   143,
+     144,   145,    -1,    -1,   148,   149,    -1,   151,   152,   153,
+      -1,   155,   156,   157,    -1,    -1,   160,   161,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,   193,
+      -1,   195,    -1,    -1,    -1,    -1,    -1,   201,    -1,    -1,
+      -1,   205,   206,   207,   208,   209,    -1,   211,   212,    -1,
+     214,   215,   216,   217,    -1,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,    -1,    -1,
+      -1,   235,   236,   237,   238,    -1,   240,   241,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,   252,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,   271,   272,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,   283,
+     284,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,    -1,   303,
+      -1,   305,   306,   307,    -1,    -1,    -1,    -1,   312,   313,
+     314,   315,   316,   317,    -1,    -1,    -1,     3,    -1,    -1,
+      -1,    -1,    -1,    -1,   328,   329,    -1,    -1,    -1,    -1,
+      -1,    -1,   336,    19,    20,    21,    -1,    23,    -1,    -1,
+      -1,    -1,    28,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      66,    -1,    68,    -1,    70,    71,    -1,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,   105,
+     106,   107,   108,    -1,   110,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,
+     126,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,   143,   144,   145,
+      -1,    -1,    -1,   149,    -1,   151,   152,   153,    -1,   155,
+     156,    -1,   158,    -1,   160,   161,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,    -1,    -1,    -1,
+      -1,    -1,   188,   189,   190,   191,   192,   193,    -1,   195,
+      -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,
+     206,   207,   208,   209,    -1,   211,   212,    -1,   214,   215,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,   232,   233,    -1,   235,
+     236,   237,   238,    -1,    -1,   241,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,   252,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,   271,   272,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,   283,   284,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,
+     306,   307,   308,    -1,    -1,    -1,   312,   313,   314,   315,
+     316,   317,    -1,    -1,    -1,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     336,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      28,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,
+      68,    -1,    70,    -1,    -1,    -1,    -1,    75,    76,    77,
+      78,    79,    80,    81,    82,    -1,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,    -1,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,   123,   124,    -1,    -1,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,   143,   144,   145,    -1,    -1,
+      -1,   149,    -1,   151,   152,   153,    -1,    -1,   156,    -1,
+     158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,   207,
+     208,   209,    -1,   211,   212,    -1,   214,    -1,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,   236,   237,
+     238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,
+     248,   249,   250,    -1,    -1,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,
+     298,   299,   300,    -1,   302,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,   311,   312,   313,   314,   315,   316,   317,
+      -1,    -1,    -1,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   336,    19,
+      20,    21,    -1,    23,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    31,    32,    -1,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    48,    -1,
+      -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,
+      60,    -1,    62,    63,    64,    65,    -1,    -1,    68,    -1,
+      -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,    79,
+      80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,    -1,   105,   106,   107,   108,    -1,
+      -1,   111,   112,   113,   114,   115,   116,    -1,    -1,   119,
+      -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,
+      -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,
+     140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,   149,
+      -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,    -1,
+     160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,    -1,
+      -1,    -1,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,
+     190,   191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,
+     200,   201,    -1,    -1,    -1,    -1,   206,   207,   208,   209,
+      -1,   211,   212,    -1,   214,   215,   216,   217,   218,   219,
+     220,    -1,   222,   223,    -1,   225,   226,   227,   228,    -1,
+     230,   231,   232,   233,    -1,   235,    -1,   237,   238,    -1,
+      -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,   249,
+     250,    -1,    -1,    -1,   254,   255,    -1,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,    -1,   268,    -1,
+      -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,   279,
+      -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,   289,
+     290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,
+     300,    -1,   302,   303,    -1,   305,   306,   307,   308,    -1,
+      -1,   311,   312,   313,   314,   315,   316,   317,    -1,    -1,
+      -1,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   336,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    -1,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    -1,    -1,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    75,    -1,    77,    78,    79,    80,    81,
+      82,    -1,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,    -1,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,
+      -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,    -1,   144,   145,    -1,    -1,    -1,   149,    -1,   151,
+      -1,   153,    -1,    -1,    -1,    -1,   158,    -1,   160,    -1,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,    -1,    -1,   206,   207,   208,   209,    -1,   211,
+     212,    -1,   214,    -1,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,    -1,   237,   238,    -1,    -1,    -1,
+      -1,    -1,   244,   245,   246,   247,   248,   249,   250,    -1,
+      -1,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,    -1,
+      -1,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,    -1,    -1,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+     302,   303,    -1,   305,   306,   307,   308,    -1,    -1,   311,
+     312,   313,   314,   315,   316,   317,    -1,    -1,    -1,     3,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   336,    19,    20,    21,    -1,    23,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      -1,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    -1,    -1,    68,    -1,    -1,    -1,    -1,    -1,
+      -1,    75,    -1,    77,    78,    79,    80,    81,    82,    -1,
+      84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,   105,   106,   107,   108,    -1,    -1,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,    -1,
+     124,    -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,    -1,
+     144,   145,    -1,    -1,    -1,   149,    -1,   151,    -1,   153,
+      -1,    -1,    -1,    -1,   158,    -1,   160,    -1,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,
+      -1,   195,    -1,   197,    -1,    -1,   200,   201,    -1,    -1,
+      -1,    -1,   206,   207,   208,   209,    -1,   211,   212,    -1,
+     214,   215,   216,   217,   218,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,   232,   233,
+      -1,   235,    -1,   237,   238,    -1,    -1,    -1,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,    -1,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,    -1,    -1,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,    -1,
+      -1,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,    -1,   303,
+      -1,   305,   306,   307,   308,    -1,    -1,     3,   312,   313,
+     314,   315,   316,   317,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    19,    20,    21,    -1,    23,    -1,    -1,
+      -1,    -1,   336,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    -1,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      -1,    -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,    75,
+      -1,    77,    78,    79,    80,    81,    82,    -1,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,   105,
+     106,   107,   108,    -1,    -1,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,    -1,   124,    -1,
+      -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,    -1,   144,   145,
+      -1,    -1,    -1,   149,    -1,   151,    -1,   153,    -1,    -1,
+      -1,    -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,   195,
+      -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,
+     206,   207,   208,   209,    -1,   211,   212,    -1,   214,   215,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,   232,   233,    -1,   235,
+      -1,   237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,    -1,    -1,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,
+     306,   307,   308,    -1,    -1,     3,   312,   313,   314,   315,
+     316,   317,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+     336,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,
+      68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,
+      78,    79,    80,    81,    82,    -1,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,    -1,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,
+      -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,
+     158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,
+     208,   209,    -1,   211,   212,    -1,   214,    -1,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,    -1,   237,
+     238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,
+     298,   299,   300,    -1,    -1,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,
+      -1,     8,     9,    -1,    -1,    -1,    -1,    -1,   336,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    -1,    41,    42,    43,    -1,    -1,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    -1,
+      67,    68,    69,    70,    -1,    72,    -1,    -1,    75,    76,
+      77,    78,    79,    80,    81,    82,    -1,    84,    85,    86,
+      87,    88,    89,    90,    -1,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,    -1,   106,
+     107,    -1,    -1,    -1,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    -1,
+     127,   128,    -1,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,    -1,    -1,   156,
+     157,   158,   159,   160,    -1,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,   183,   184,   185,   186,
+     187,    -1,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,    -1,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,   250,   251,    -1,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,   269,   270,   271,    -1,   273,   274,   275,   276,
+     277,    -1,   279,   280,    -1,   282,    -1,    -1,   285,   286,
+     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
+     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
+     307,    -1,   309,   310,   311,   312,   313,   314,   315,   316,
+     317,     3,    -1,    -1,    -1,    -1,     8,   324,   325,   326,
+      -1,   328,   329,   330,   331,   332,   333,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    -1,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    -1,    -1,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    75,    -1,    77,    78,    79,    80,    81,
+      82,    -1,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,    -1,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,
+      -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,    -1,   144,   145,    -1,    -1,    -1,   149,    -1,   151,
+      -1,   153,    -1,    -1,    -1,    -1,   158,    -1,   160,    -1,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,    -1,    -1,   206,   207,   208,   209,    -1,   211,
+     212,    -1,   214,    -1,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,    -1,   237,   238,    -1,    -1,    -1,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+      -1,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,    -1,
+      -1,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,    -1,    -1,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+      -1,   303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,     3,    -1,    -1,    -1,
+      -1,     8,   324,   325,   326,    -1,   328,   329,   330,   331,
+     332,   333,    19,    20,    21,    -1,    23,    -1,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    -1,    34,    35,    36,
+      37,    38,    39,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    48,    -1,    -1,    -1,    52,    -1,    -1,    55,    56,
+      57,    -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,
+      -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,
+      77,    78,    79,    80,    81,    82,    -1,    84,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,    -1,   105,   106,
+     107,   108,    -1,    -1,   111,   112,   113,   114,   115,   116,
+      -1,    -1,   119,    -1,    -1,    -1,    -1,   124,    -1,    -1,
+      -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,
+      -1,   138,    -1,   140,   141,   142,    -1,   144,   145,    -1,
+      -1,    -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,
+      -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,
+      -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,     8,    -1,
+      -1,    11,   189,   190,   191,   192,   193,    -1,   195,    -1,
+     197,    -1,    22,    -1,   201,    -1,    -1,    -1,    -1,   206,
+     207,   208,   209,    33,   211,   212,    -1,   214,    -1,   216,
+     217,   218,   219,   220,    -1,   222,   223,    -1,   225,   226,
+     227,   228,    -1,   230,   231,   232,   233,    -1,   235,    -1,
+     237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,
+     247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+      -1,   268,     8,    -1,    -1,    11,    -1,   274,   275,   276,
+      -1,   278,   279,    -1,    -1,   282,    22,    -1,   285,    -1,
+      -1,   288,   289,   290,    -1,   292,    -1,    33,    -1,    -1,
+      -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,   306,
+     307,   308,    -1,   133,    -1,   312,   313,   314,   315,   316,
+     317,    -1,    -1,    -1,    -1,    -1,    -1,   324,   325,   326,
+     150,   328,   329,   330,   331,   332,   333,    -1,     8,   159,
+      -1,    11,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    33,    -1,   185,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     8,    -1,    -1,    11,    -1,    -1,
+      -1,   201,    -1,   203,    -1,    -1,    -1,    -1,    22,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   133,    -1,    33,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     8,    -1,    -1,
+      11,    -1,    -1,    -1,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,     8,   159,    -1,    11,    -1,    -1,    -1,    -1,
+      -1,    -1,    33,    -1,    -1,    -1,    22,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    -1,   185,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   133,    -1,   201,    -1,   203,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   159,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   133,
+      -1,    -1,    -1,    -1,   324,   325,   326,    -1,   328,   329,
+     330,   331,   332,   333,   334,   185,   150,   337,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   159,    -1,    -1,    -1,    -1,
+      -1,   201,   133,   203,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   133,    -1,   150,
+      -1,   185,    -1,    -1,    -1,    -1,    -1,    -1,   159,    -1,
+      -1,    -1,    -1,    -1,   150,    -1,    -1,   201,    -1,   203,
+      -1,    -1,    -1,   159,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   185,    -1,    -1,    -1,   324,   325,
+     326,    -1,   328,   329,   330,   331,   332,   333,   334,   185,
+     201,   337,   203,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   201,    -1,   203,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   324,   325,   326,    -1,   328,   329,
+     330,   331,   332,   333,   334,    -1,    -1,   337,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     324,   325,   326,    -1,   328,   329,   330,   331,   332,   333,
+     334,    -1,    -1,   337,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   324,   325,   326,    -1,   328,   329,   330,
+     331,   332,   333,   334,    -1,    -1,   337,    -1,   324,   325,
+     326,     3,   328,   329,   330,   331,   332,   333,   334,    -1,
+      -1,   337,    -1,    -1,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    -1,    41,
+      42,    43,    44,    -1,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    -1,    67,    68,    69,    70,    -1,
+      72,    -1,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    -1,    84,    85,    86,    87,    88,    89,    90,    -1,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,    -1,    -1,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,   127,   128,    -1,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,    -1,   149,   150,   151,
+     152,   153,    -1,    -1,   156,   157,   158,   159,   160,    -1,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,    -1,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,    -1,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+      -1,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+      -1,   273,   274,   275,   276,   277,   278,   279,   280,    -1,
+     282,    -1,    -1,   285,   286,   287,   288,   289,   290,   291,
+     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
+     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
+     312,   313,   314,   315,   316,   317,     3,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   330,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    -1,    41,    42,    43,    44,    -1,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    -1,
+      67,    68,    69,    70,    -1,    72,    -1,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    -1,    84,    85,    86,
+      87,    88,    89,    90,    -1,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   108,    -1,    -1,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    -1,
+     127,   128,    -1,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,    -1,   149,   150,   151,   152,   153,    -1,    -1,   156,
+     157,   158,   159,   160,    -1,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
+     187,    -1,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   223,    -1,   225,   226,
+     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
+     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,   250,   251,    -1,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,   269,   270,   271,    -1,   273,   274,   275,   276,
+     277,   278,   279,   280,    -1,   282,    -1,    -1,   285,   286,
+     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
+     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
+     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
+     317,     3,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   330,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    -1,    41,
+      42,    43,    44,    -1,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    -1,    67,    68,    69,    70,    -1,
+      72,    -1,    -1,    75,    76,    77,    78,    79,    80,    81,
+      82,    -1,    84,    85,    86,    87,    88,    89,    90,    -1,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,    -1,    -1,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,   127,   128,    -1,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,    -1,   149,   150,   151,
+     152,   153,    -1,    -1,   156,   157,   158,   159,   160,    -1,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+      -1,   183,   184,   185,   186,   187,    -1,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,    -1,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+      -1,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+      -1,   273,   274,   275,   276,   277,   278,   279,   280,    -1,
+     282,    -1,    -1,   285,   286,   287,   288,   289,   290,   291,
+     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
+     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
+     312,   313,   314,   315,   316,   317,     3,     4,     5,    -1,
+      -1,    -1,     9,    -1,    -1,    -1,    -1,    -1,   330,    -1,
+      -1,    -1,    19,    20,    21,    -1,    23,    -1,    -1,    -1,
+      -1,    28,    29,    30,    31,    32,    -1,    34,    35,    36,
+      37,    38,    39,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,
+      57,    -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,
+      -1,    68,    -1,    70,    -1,    -1,    -1,    -1,    75,    76,
+      77,    78,    79,    80,    81,    82,    -1,    84,    85,    86,
+      -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,    -1,   105,   106,
+     107,   108,    -1,    -1,   111,   112,   113,   114,   115,   116,
+     117,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,    -1,
+      -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,
+      -1,   138,    -1,   140,   141,   142,   143,   144,   145,    -1,
+      -1,    -1,   149,    -1,   151,   152,   153,    -1,    -1,   156,
+      -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,
+      -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   189,   190,   191,   192,   193,    -1,   195,    -1,
+     197,   198,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,
+     207,   208,   209,    -1,   211,   212,    -1,   214,    -1,   216,
+     217,   218,   219,   220,    -1,   222,   223,    -1,   225,   226,
+     227,   228,    -1,   230,   231,   232,   233,    -1,   235,   236,
+     237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,
+     247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+      -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,
+      -1,   278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,
+     287,   288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,
+      -1,   298,   299,   300,    -1,    -1,   303,    -1,   305,   306,
+     307,   308,    -1,    -1,    -1,   312,   313,   314,   315,   316,
+     317,     3,     4,     5,    -1,    -1,    -1,     9,    -1,    -1,
+      -1,   328,   329,    -1,    -1,    -1,    -1,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    28,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    54,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    -1,    -1,    68,    -1,    70,    -1,
+      -1,    -1,    -1,    75,    76,    77,    78,    79,    80,    81,
+      82,    -1,    84,    85,    86,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,    -1,   111,
+     112,   113,   114,   115,   116,   117,    -1,   119,    -1,    -1,
+      -1,   123,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,   143,   144,   145,    -1,    -1,    -1,   149,    -1,   151,
+     152,   153,    -1,    -1,   156,    -1,   158,    -1,   160,    -1,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,   198,    -1,    -1,   201,
+      -1,    -1,    -1,   205,   206,   207,   208,   209,    -1,   211,
+     212,    -1,   214,    -1,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,   236,   237,   238,    -1,    -1,    -1,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+      -1,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,    -1,
+      -1,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,    -1,    -1,   285,    -1,   287,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+      -1,   303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,     3,     4,     5,    -1,
+      -1,    -1,     9,    -1,    -1,    -1,   328,   329,    -1,    -1,
+      -1,    -1,    19,    20,    21,    -1,    23,    -1,    -1,    -1,
+      -1,    28,    29,    30,    31,    32,    -1,    34,    35,    36,
+      37,    38,    39,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,
+      57,    -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,
+      -1,    68,    -1,    70,    -1,    -1,    -1,    -1,    75,    76,
+      77,    78,    79,    80,    81,    82,    -1,    84,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,    -1,   105,   106,
+     107,   108,    -1,    -1,   111,   112,   113,   114,   115,   116,
+     117,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,    -1,
+      -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,
+      -1,   138,    -1,   140,   141,   142,   143,   144,   145,    -1,
+      -1,    -1,   149,    -1,   151,   152,   153,    -1,    -1,   156,
+      -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,
+      -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   189,   190,   191,   192,   193,    -1,   195,     8,
+     197,   198,    11,    -1,   201,    -1,    -1,    -1,   205,   206,
+     207,   208,   209,    22,   211,   212,    -1,   214,    -1,   216,
+     217,   218,   219,   220,    33,   222,   223,    -1,   225,   226,
+     227,   228,    -1,   230,   231,   232,   233,    -1,   235,   236,
+     237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,
+     247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+      -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,
+       8,   278,   279,    11,    -1,   282,    -1,    -1,   285,    -1,
+     287,   288,   289,   290,    22,   292,    -1,    -1,    26,    -1,
+      -1,   298,   299,   300,    -1,    33,   303,    -1,   305,   306,
+     307,   308,    -1,    -1,    -1,   312,   313,   314,   315,   316,
+     317,    -1,    -1,    -1,   133,    -1,    -1,    -1,    -1,    -1,
+      -1,   328,   329,    -1,     8,    -1,    -1,    11,    -1,    -1,
+      -1,   150,    -1,    -1,    -1,    -1,    -1,    -1,    22,     8,
+     159,    25,    11,    -1,    -1,    -1,    -1,    -1,    -1,    33,
+      -1,    89,    -1,    22,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    33,    -1,   185,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    17,    -1,    19,    -1,     8,    -1,
+      -1,    11,   201,    -1,   203,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    -1,    -1,   133,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    33,    -1,     8,    -1,    50,    11,    -1,
+      -1,    -1,   150,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      -1,   159,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    88,    -1,   185,    -1,   133,
+      -1,    94,   121,    -1,    -1,    98,    99,    -1,   277,    -1,
+      -1,    -1,    -1,   201,   133,   203,   150,    -1,   111,    -1,
+      -1,    -1,    -1,    -1,    -1,   159,    -1,    -1,    -1,    -1,
+      -1,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     159,    -1,    -1,    -1,    -1,   138,    -1,    -1,    -1,    -1,
+      -1,   185,    -1,   133,    -1,   324,   325,   326,    -1,   328,
+     329,   330,   331,   332,   333,   334,   185,   201,    -1,   203,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   171,   159,
+     133,    -1,   201,    -1,   203,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   185,    -1,    -1,    -1,    -1,   150,    -1,   192,
+      -1,   194,    -1,    -1,    -1,   185,   159,    -1,    -1,    -1,
+      -1,    -1,    -1,   206,    -1,   208,    -1,    -1,    -1,    -1,
+      -1,   201,    -1,   203,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   185,    -1,    -1,   228,   324,   325,   326,    -1,
+     328,   329,   330,   331,   332,   333,   334,    -1,   201,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     253,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   280,    -1,    -1,
+     324,   325,   326,    -1,   328,   329,   330,   331,   332,   333,
+     334,    -1,    -1,    -1,    -1,   324,   325,   326,   301,   328,
+     329,   330,   331,   332,   333,   334,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   324,   325,   326,    -1,   328,   329,
+     330,   331,   332,   333,   334,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+      -1,   324,   325,   326,    -1,   328,   329,   330,   331,   332,
+     333,   334,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    -1,    41,    42,    43,
+      44,    -1,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    -1,    67,    68,    69,    70,    -1,    72,    -1,
+      -1,    75,    76,    77,    78,    79,    80,    81,    82,    -1,
+      84,    85,    86,    87,    88,    89,    90,    -1,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,    -1,    -1,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    -1,   127,   128,    -1,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,    -1,   149,   150,   151,   152,   153,
+      -1,    -1,   156,   157,   158,   159,   160,    -1,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,    -1,   183,
+     184,   185,   186,   187,    -1,   189,   190,   191,   192,   193,
+     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+      -1,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,   248,   249,   250,   251,    -1,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   269,   270,   271,    -1,   273,
+     274,   275,   276,   277,   278,   279,   280,    -1,   282,    -1,
+      -1,   285,   286,   287,   288,   289,   290,   291,   292,   293,
+     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
+     304,   305,   306,   307,   308,   309,   310,   311,   312,   313,
+     314,   315,   316,   317,     3,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    42,    43,    44,    -1,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    -1,    67,    68,
+      69,    70,    -1,    72,    -1,    -1,    75,    76,    77,    78,
+      79,    80,    81,    82,    -1,    84,    85,    86,    87,    88,
+      89,    90,    -1,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+      -1,    -1,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,    -1,   127,   128,
+      -1,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,    -1,
+     149,   150,   151,   152,   153,    -1,    -1,   156,   157,   158,
+     159,   160,    -1,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,    -1,   183,   184,   185,   186,   187,    -1,
+     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,   223,    -1,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,   250,   251,    -1,   253,   254,   255,   256,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
+     269,   270,   271,    -1,   273,   274,   275,   276,   277,   278,
+     279,   280,    -1,   282,    -1,    -1,   285,   286,   287,   288,
+     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
+     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
+     309,   310,   311,   312,   313,   314,   315,   316,   317,     3,
+      -1,     5,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,    23,
+      -1,    -1,    -1,    -1,    28,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      54,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    -1,    -1,    68,    -1,    70,    -1,    -1,    -1,
+      -1,    75,    76,    77,    78,    79,    80,    81,    82,    -1,
+      84,    85,    86,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,   105,   106,   107,   108,    -1,    -1,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,   123,
+     124,    -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,   143,
+     144,   145,    -1,    -1,    -1,   149,    -1,   151,   152,   153,
+      -1,    -1,   156,    -1,   158,    -1,   160,    -1,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,
+      -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,
+      -1,   205,   206,   207,   208,   209,    -1,   211,   212,    -1,
+     214,    -1,   216,   217,   218,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,   232,   233,
+      -1,   235,   236,   237,   238,    -1,    -1,    -1,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,    -1,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,    -1,    -1,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,    -1,
+      -1,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,     3,   303,
+       5,   305,   306,   307,   308,    -1,    -1,    -1,   312,   313,
+     314,   315,   316,   317,    19,    20,    21,    -1,    23,    -1,
+      -1,    -1,    -1,    28,    29,    30,    31,    32,    -1,    34,
+      35,    36,    37,    38,    39,    -1,    -1,    42,    43,    44,
+      -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,    54,
+      55,    56,    57,    -1,    -1,    60,    -1,    62,    63,    64,
+      65,    -1,    -1,    68,    -1,    70,    -1,    -1,    -1,    -1,
+      75,    76,    77,    78,    79,    80,    81,    82,    -1,    84,
+      85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,    -1,
+     105,   106,   107,   108,    -1,    -1,   111,   112,   113,   114,
+     115,   116,    -1,    -1,   119,    -1,    -1,    -1,   123,   124,
+      -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,
+     135,    -1,    -1,   138,    -1,   140,   141,   142,   143,   144,
+     145,    -1,    -1,    -1,   149,    -1,   151,   152,   153,    -1,
+      -1,   156,    -1,   158,    -1,   160,    -1,    -1,   163,   164,
+     165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,
+     195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,
+     205,   206,   207,   208,   209,    -1,   211,   212,    -1,   214,
+      -1,   216,   217,   218,   219,   220,    -1,   222,   223,    -1,
+     225,   226,   227,   228,    -1,   230,   231,   232,   233,    -1,
+     235,   236,   237,   238,    -1,    -1,    -1,    -1,    -1,   244,
+     245,   246,   247,   248,    -1,   250,    -1,    -1,    -1,   254,
+     255,    -1,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,    -1,   268,    -1,    -1,    -1,    -1,    -1,   274,
+     275,   276,    -1,   278,   279,    -1,    -1,   282,    -1,    -1,
+     285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,
+      -1,    -1,    -1,   298,   299,   300,    -1,     3,   303,    -1,
+     305,   306,   307,   308,    -1,    -1,    -1,   312,   313,   314,
+     315,   316,   317,    19,    20,    21,    -1,    23,    -1,    -1,
+      -1,    -1,    28,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      -1,    -1,    68,    -1,    70,    -1,    -1,    -1,    -1,    75,
+      76,    77,    78,    79,    80,    81,    82,    -1,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,   105,
+     106,   107,   108,    -1,    -1,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,
+      -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,   143,   144,   145,
+      -1,    -1,    -1,   149,    -1,   151,   152,   153,    -1,    -1,
+     156,    -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,   195,
+      -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,
+     206,   207,   208,   209,    -1,   211,   212,    -1,   214,   215,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,   232,   233,    -1,   235,
+     236,   237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,    -1,    -1,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,     3,   303,    -1,   305,
+     306,   307,   308,    -1,    -1,    -1,   312,   313,   314,   315,
+     316,   317,    19,    20,    21,    -1,    23,    -1,    -1,    -1,
+      -1,    28,    29,    30,    31,    32,    -1,    34,    35,    36,
+      37,    38,    39,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,
+      57,    -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,
+      -1,    68,    -1,    70,    -1,    -1,    -1,    -1,    75,    76,
+      77,    78,    79,    80,    81,    82,    -1,    84,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,    -1,   105,   106,
+     107,   108,    -1,    -1,   111,   112,   113,   114,   115,   116,
+      -1,    -1,   119,    -1,    -1,    -1,   123,   124,    -1,    -1,
+      -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,
+      -1,   138,    -1,   140,   141,   142,   143,   144,   145,    -1,
+      -1,    -1,   149,    -1,   151,   152,   153,    -1,    -1,   156,
+      -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,
+      -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   189,   190,   191,   192,   193,    -1,   195,    -1,
+     197,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,
+     207,   208,   209,    -1,   211,   212,    -1,   214,    -1,   216,
+     217,   218,   219,   220,    -1,   222,   223,    -1,   225,   226,
+     227,   228,    -1,   230,   231,   232,   233,    -1,   235,   236,
+     237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,
+     247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+      -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,
+      -1,   278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,
+      -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,
+      -1,   298,   299,   300,    -1,     3,   303,    -1,   305,   306,
+     307,   308,    -1,    -1,    -1,   312,   313,   314,   315,   316,
+     317,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    49,    -1,    -1,    52,    -1,    -1,    55,    56,    57,
+      -1,    -1,    60,    61,    62,    63,    64,    65,    -1,    -1,
+      68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,
+      78,    79,    80,    81,    82,    -1,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,    -1,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,   122,    -1,   124,    -1,    -1,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,
+      -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,
+     158,   159,   160,    -1,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,
+     208,   209,    -1,   211,   212,    -1,   214,    -1,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,    -1,   237,
+     238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,   294,    -1,    -1,    -1,
+     298,   299,   300,    -1,     3,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    31,    32,    -1,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    42,    43,    44,    -1,    46,    47,    48,
+      49,    -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,
+      -1,    60,    61,    62,    63,    64,    65,    -1,    -1,    68,
+      -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,
+      79,    80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,
+      -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,    -1,   105,   106,   107,   108,
+      -1,    -1,   111,   112,   113,   114,   115,   116,    -1,    -1,
+     119,    -1,    -1,   122,    -1,   124,    -1,    -1,    -1,    -1,
+      -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,
+      -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,
+     149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,
+      -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,
+      -1,    -1,    -1,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     189,   190,   191,   192,   193,    -1,   195,    -1,   197,    -1,
+      -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,   208,
+     209,    -1,   211,   212,    -1,   214,    -1,   216,   217,   218,
+     219,   220,    -1,   222,   223,    -1,   225,   226,   227,   228,
+      -1,   230,   231,   232,   233,    -1,   235,    -1,   237,   238,
+      -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,
+      -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,    -1,   268,
+      -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,
+     279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,
+     289,   290,    -1,   292,    -1,   294,    -1,    -1,    -1,   298,
+     299,   300,    -1,    -1,   303,     3,   305,   306,   307,   308,
+      -1,    -1,    -1,   312,   313,   314,   315,   316,   317,    -1,
+      18,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,
+      68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,
+      78,    79,    80,    81,    82,    -1,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,    -1,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,
+      -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,
+     158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,
+     208,   209,    -1,   211,   212,    -1,   214,    -1,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,    -1,   237,
+     238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,   251,    -1,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,
+     298,   299,   300,    -1,    -1,   303,     3,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      -1,    18,    19,    20,    21,    -1,    23,    -1,    -1,    -1,
+      -1,    -1,    29,    30,    31,    32,    -1,    34,    35,    36,
+      37,    38,    39,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    48,    -1,    -1,    -1,    52,    -1,    -1,    55,    56,
+      57,    -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,
+      -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,
+      77,    78,    79,    80,    81,    82,    -1,    84,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,    -1,   105,   106,
+     107,   108,    -1,    -1,   111,   112,   113,   114,   115,   116,
+      -1,    -1,   119,    -1,    -1,    -1,    -1,   124,    -1,    -1,
+      -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,
+      -1,   138,    -1,   140,   141,   142,    -1,   144,   145,    -1,
+      -1,    -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,
+      -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,
+      -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   189,   190,   191,   192,   193,    -1,   195,    -1,
+     197,    -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,   206,
+     207,   208,   209,    -1,   211,   212,    -1,   214,    -1,   216,
+     217,   218,   219,   220,    -1,   222,   223,    -1,   225,   226,
+     227,   228,    -1,   230,   231,   232,   233,    -1,   235,    -1,
+     237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,
+     247,   248,    -1,   250,   251,    -1,    -1,   254,   255,    -1,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+      -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,
+      -1,   278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,
+      -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,
+      -1,   298,   299,   300,    -1,     3,   303,    -1,   305,   306,
+     307,   308,    -1,    -1,    -1,   312,   313,   314,   315,   316,
+     317,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,
+      68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,
+      78,    79,    80,    81,    82,    -1,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,    -1,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,
+      -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,
+     158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,   200,   201,    -1,    -1,    -1,    -1,   206,   207,
+     208,   209,    -1,   211,   212,    -1,   214,   215,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,    -1,   237,
+     238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,
+     298,   299,   300,    -1,     3,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    31,    32,    -1,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    42,    43,    44,    -1,    46,    47,    48,
+      -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,
+      -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,    68,
+      -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,
+      79,    80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,
+      -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,    -1,   105,   106,   107,   108,
+      -1,    -1,   111,   112,   113,   114,   115,   116,    -1,    -1,
+     119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,
+      -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,
+      -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,
+     149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,
+      -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,
+      -1,    -1,    -1,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     189,   190,   191,   192,   193,    -1,   195,    -1,   197,    -1,
+      -1,   200,   201,    -1,    -1,    -1,    -1,   206,   207,   208,
+     209,    -1,   211,   212,    -1,   214,   215,   216,   217,   218,
+     219,   220,    -1,   222,   223,    -1,   225,   226,   227,   228,
+      -1,   230,   231,   232,   233,    -1,   235,    -1,   237,   238,
+      -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,
+      -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,    -1,   268,
+      -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,
+     279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,
+     289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,
+     299,   300,    -1,     3,   303,    -1,   305,   306,   307,   308,
+      -1,    -1,    -1,   312,   313,   314,   315,   316,   317,    19,
+      20,    21,    -1,    23,    -1,    -1,    -1,    -1,    28,    29,
+      30,    31,    32,    -1,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    48,    -1,
+      -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,
+      60,    -1,    62,    63,    64,    65,    -1,    -1,    68,    -1,
+      -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,    79,
+      80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,    -1,   105,   106,   107,   108,    -1,
+      -1,   111,   112,   113,   114,   115,   116,    -1,    -1,   119,
+      -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,
+      -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,
+     140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,   149,
+      -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,    -1,
+     160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,    -1,
+      -1,    -1,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,
+     190,   191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,
+      -1,   201,    -1,    -1,    -1,    -1,   206,   207,   208,   209,
+      -1,   211,   212,    -1,   214,    -1,   216,   217,   218,   219,
+     220,    -1,   222,   223,    -1,   225,   226,   227,   228,    -1,
+     230,   231,   232,   233,    -1,   235,    -1,   237,   238,    -1,
+      -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,    -1,
+     250,   251,    -1,    -1,   254,   255,    -1,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,    -1,   268,    -1,
+      -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,   279,
+      -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,   289,
+     290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,
+     300,    -1,    -1,   303,     3,   305,   306,   307,   308,    -1,
+      -1,    -1,   312,   313,   314,   315,   316,   317,    -1,    18,
+      19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    31,    32,    -1,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    42,    43,    44,    -1,    46,    47,    48,
+      -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,
+      -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,    68,
+      -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,
+      79,    80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,
+      -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,    -1,   105,   106,   107,   108,
+      -1,    -1,   111,   112,   113,   114,   115,   116,    -1,    -1,
+     119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,
+      -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,
+      -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,
+     149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,
+      -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,
+      -1,    -1,    -1,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     189,   190,   191,   192,   193,    -1,   195,    -1,   197,    -1,
+      -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,   208,
+     209,    -1,   211,   212,    -1,   214,    -1,   216,   217,   218,
+     219,   220,    -1,   222,   223,    -1,   225,   226,   227,   228,
+      -1,   230,   231,   232,   233,    -1,   235,    -1,   237,   238,
+      -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,
+      -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,    -1,   268,
+      -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,
+     279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,
+     289,   290,    -1,   292,    -1,    -1,    -1,   296,    -1,   298,
+     299,   300,    -1,    -1,   303,     3,   305,   306,   307,   308,
+      -1,    -1,    -1,   312,   313,   314,   315,   316,   317,    -1,
+      18,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,
+      68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,
+      78,    79,    80,    81,    82,    -1,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,    -1,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,
+      -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,
+     158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,
+     208,   209,    -1,   211,   212,    -1,   214,    -1,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,    -1,   237,
+     238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,   296,    -1,
+     298,   299,   300,    -1,     3,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    31,    32,    -1,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    42,    43,    44,    -1,    46,    47,    48,
+      -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,
+      -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,    68,
+      -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,
+      79,    80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,
+      -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,    -1,   105,   106,   107,   108,
+      -1,    -1,   111,   112,   113,   114,   115,   116,    -1,    -1,
+     119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,
+      -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,
+      -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,
+     149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,
+      -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,
+      -1,    -1,    -1,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     189,   190,   191,   192,   193,    -1,   195,    -1,   197,    -1,
+      -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,   208,
+     209,    -1,   211,   212,    -1,   214,    -1,   216,   217,   218,
+     219,   220,    -1,   222,   223,    -1,   225,   226,   227,   228,
+      -1,   230,   231,   232,   233,    -1,   235,    -1,   237,   238,
+      -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,
+      -1,   250,   251,    -1,    -1,   254,   255,    -1,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,    -1,   268,
+      -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,
+     279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,
+     289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,
+     299,   300,    -1,     3,   303,    -1,   305,   306,   307,   308,
+      -1,    -1,    -1,   312,   313,   314,   315,   316,   317,    19,
+      20,    21,    -1,    23,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    31,    32,    -1,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    48,    -1,
+      -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,
+      60,    -1,    62,    63,    64,    65,    -1,    -1,    68,    -1,
+      -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,    79,
+      80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,    -1,   105,   106,   107,   108,    -1,
+      -1,   111,   112,   113,   114,   115,   116,    -1,    -1,   119,
+      -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,
+      -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,
+     140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,   149,
+      -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,    -1,
+     160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,    -1,
+      -1,    -1,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,
+     190,   191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,
+      -1,   201,    -1,    -1,    -1,    -1,   206,   207,   208,   209,
+      -1,   211,   212,    -1,   214,    -1,   216,   217,   218,   219,
+     220,    -1,   222,   223,   224,   225,   226,   227,   228,    -1,
+     230,   231,   232,   233,    -1,   235,    -1,   237,   238,    -1,
+      -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,    -1,
+     250,    -1,    -1,    -1,   254,   255,    -1,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,    -1,   268,    -1,
+      -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,   279,
+      -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,   289,
+     290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,
+     300,    -1,     3,   303,    -1,   305,   306,   307,   308,    -1,
+      -1,    -1,   312,   313,   314,   315,   316,   317,    19,    20,
+      21,    -1,    23,    -1,    -1,    -1,    -1,    -1,    29,    30,
+      31,    32,    -1,    34,    35,    36,    37,    38,    39,    -1,
+      -1,    42,    43,    44,    -1,    46,    47,    48,    -1,    -1,
+      -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,    60,
+      -1,    62,    63,    64,    65,    -1,    -1,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    75,    -1,    77,    78,    79,    80,
+      81,    82,    -1,    84,    85,    -1,    -1,    -1,    -1,    -1,
+      -1,    92,    93,    -1,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,    -1,   105,   106,   107,   108,    -1,    -1,
+     111,   112,   113,   114,   115,   116,    -1,    -1,   119,    -1,
+      -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,
+     131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,
+     141,   142,    -1,   144,   145,    -1,    -1,    -1,   149,    -1,
+     151,    -1,   153,    -1,    -1,    -1,    -1,   158,    -1,   160,
+      -1,    -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,
+      -1,   172,   173,   174,   175,   176,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,
+     191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,
+     201,    -1,    -1,    -1,    -1,   206,   207,   208,   209,    -1,
+     211,   212,    -1,   214,   215,   216,   217,   218,   219,   220,
+      -1,   222,   223,    -1,   225,   226,   227,   228,    -1,   230,
+     231,   232,   233,    -1,   235,    -1,   237,   238,    -1,    -1,
+      -1,    -1,    -1,   244,   245,   246,   247,   248,    -1,   250,
+      -1,    -1,    -1,   254,   255,    -1,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,    -1,   268,    -1,    -1,
+      -1,    -1,    -1,   274,   275,   276,    -1,   278,   279,    -1,
+      -1,   282,    -1,    -1,   285,    -1,    -1,   288,   289,   290,
+      -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,
+      -1,     3,   303,    -1,   305,   306,   307,   308,    -1,    -1,
+      -1,   312,   313,   314,   315,   316,   317,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    -1,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    -1,    -1,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    75,    -1,    77,    78,    79,    80,    81,
+      82,    -1,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,    -1,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,
+      -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,    -1,   144,   145,    -1,    -1,    -1,   149,    -1,   151,
+      -1,   153,    -1,    -1,    -1,    -1,   158,    -1,   160,    -1,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,    -1,    -1,   206,   207,   208,   209,    -1,   211,
+     212,    -1,   214,   215,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,    -1,   237,   238,    -1,    -1,    -1,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+      -1,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,    -1,
+      -1,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,    -1,    -1,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+       3,   303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,    19,    20,    21,    -1,
+      23,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
+      -1,    34,    35,    36,    37,    38,    39,    -1,    -1,    42,
+      43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,
+      -1,    -1,    55,    56,    57,    -1,    -1,    60,    -1,    62,
+      63,    64,    65,    -1,    -1,    68,    -1,    -1,    -1,    -1,
+      -1,    -1,    75,    -1,    77,    78,    79,    80,    81,    82,
+      -1,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,
+      93,    -1,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,    -1,   105,   106,   107,   108,    -1,    -1,   111,   112,
+     113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,
+      -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,
+      -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,
+      -1,   144,   145,    -1,    -1,    -1,   149,    -1,   151,    -1,
+     153,    -1,    -1,    -1,    -1,   158,    -1,   160,    -1,    -1,
+     163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   189,   190,   191,   192,
+     193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,
+      -1,    -1,    -1,   206,   207,   208,   209,    -1,   211,   212,
+      -1,   214,    -1,   216,   217,   218,   219,   220,    -1,   222,
+     223,    -1,   225,   226,   227,   228,    -1,   230,   231,   232,
+     233,    -1,   235,    -1,   237,   238,    -1,    -1,    -1,    -1,
+      -1,   244,   245,   246,   247,   248,    -1,   250,   251,    -1,
+      -1,   254,   255,    -1,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,    -1,   268,    -1,    -1,    -1,    -1,
+      -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,   282,
+      -1,    -1,   285,    -1,    -1,   288,   289,   290,    -1,   292,
+      -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,     3,
+     303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,
+     313,   314,   315,   316,   317,    19,    20,    21,    -1,    23,
+      -1,    25,    -1,    -1,    -1,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      -1,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    -1,    -1,    68,    -1,    -1,    -1,    -1,    -1,
+      -1,    75,    -1,    77,    78,    79,    80,    81,    82,    -1,
+      84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,   105,   106,   107,   108,    -1,    -1,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,    -1,
+     124,    -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,    -1,
+     144,   145,    -1,    -1,    -1,   149,    -1,   151,    -1,   153,
+      -1,    -1,    -1,    -1,   158,    -1,   160,    -1,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,
+      -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,
+      -1,    -1,   206,   207,   208,   209,    -1,   211,   212,    -1,
+     214,    -1,   216,   217,   218,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,   232,   233,
+      -1,   235,    -1,   237,   238,    -1,    -1,    -1,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,    -1,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,    -1,    -1,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,    -1,
+      -1,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,     3,   303,
+      -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,   313,
+     314,   315,   316,   317,    19,    20,    21,    -1,    23,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    31,    32,    -1,    34,
+      35,    36,    37,    38,    39,    -1,    -1,    42,    43,    44,
+      -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,    -1,
+      55,    56,    57,    -1,    -1,    60,    -1,    62,    63,    64,
+      65,    -1,    -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,
+      75,    -1,    77,    78,    79,    80,    81,    82,    -1,    84,
+      85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,    -1,
+     105,   106,   107,   108,    -1,    -1,   111,   112,   113,   114,
+     115,   116,    -1,    -1,   119,    -1,    -1,    -1,    -1,   124,
+      -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,
+     135,    -1,    -1,   138,    -1,   140,   141,   142,    -1,   144,
+     145,    -1,    -1,    -1,   149,    -1,   151,    -1,   153,    -1,
+      -1,    -1,    -1,   158,    -1,   160,    -1,    -1,   163,   164,
+     165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,
+     195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,
+      -1,   206,   207,   208,   209,    -1,   211,   212,    -1,   214,
+     215,   216,   217,   218,   219,   220,    -1,   222,   223,    -1,
+     225,   226,   227,   228,    -1,   230,   231,   232,   233,    -1,
+     235,    -1,   237,   238,    -1,    -1,    -1,    -1,    -1,   244,
+     245,   246,   247,   248,    -1,   250,    -1,    -1,    -1,   254,
+     255,    -1,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,    -1,   268,    -1,    -1,    -1,    -1,    -1,   274,
+     275,   276,    -1,   278,   279,    -1,    -1,   282,    -1,    -1,
+     285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,
+      -1,    -1,    -1,   298,   299,   300,    -1,     3,   303,    -1,
+     305,   306,   307,   308,    -1,    -1,    -1,   312,   313,   314,
+     315,   316,   317,    19,    20,    21,    -1,    23,    -1,    -1,
+      -1,    -1,    -1,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    -1,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      -1,    -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,    75,
+      -1,    77,    78,    79,    80,    81,    82,    -1,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,   105,
+     106,   107,   108,    -1,    -1,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,    -1,   124,    -1,
+      -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,    -1,   144,   145,
+      -1,    -1,    -1,   149,    -1,   151,    -1,   153,    -1,    -1,
+      -1,    -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,   195,
+      -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,
+     206,   207,   208,   209,    -1,   211,   212,    -1,   214,   215,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,   232,   233,    -1,   235,
+      -1,   237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,    -1,    -1,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,     3,   303,    -1,   305,
+     306,   307,   308,    -1,    -1,    -1,   312,   313,   314,   315,
+     316,   317,    19,    20,    21,    -1,    23,    -1,    25,    -1,
+      -1,    -1,    29,    30,    31,    32,    -1,    34,    35,    36,
+      37,    38,    39,    -1,    -1,    42,    43,    44,    -1,    46,
+      47,    48,    -1,    -1,    -1,    52,    -1,    -1,    55,    56,
+      57,    -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,
+      -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,
+      77,    78,    79,    80,    81,    82,    -1,    84,    85,    -1,
+      -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,    -1,   105,   106,
+     107,   108,    -1,    -1,   111,   112,   113,   114,   115,   116,
+      -1,    -1,   119,    -1,    -1,    -1,    -1,   124,    -1,    -1,
+      -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,
+      -1,   138,    -1,   140,   141,   142,    -1,   144,   145,    -1,
+      -1,    -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,
+      -1,   158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,
+      -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   189,   190,   191,   192,   193,    -1,   195,    -1,
+     197,    -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,   206,
+     207,   208,   209,    -1,   211,   212,    -1,   214,    -1,   216,
+     217,   218,   219,   220,    -1,   222,   223,    -1,   225,   226,
+     227,   228,    -1,   230,   231,   232,   233,    -1,   235,    -1,
+     237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,
+     247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+      -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,
+      -1,   278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,
+      -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,
+      -1,   298,   299,   300,    -1,     3,   303,    -1,   305,   306,
+     307,   308,    -1,    -1,    -1,   312,   313,   314,   315,   316,
+     317,    19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    31,    32,    -1,    34,    35,    36,    37,
+      38,    39,    -1,    -1,    42,    43,    44,    -1,    46,    47,
+      48,    -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,
+      -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,
+      68,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,
+      78,    79,    80,    81,    82,    -1,    84,    85,    -1,    -1,
+      -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,    -1,   105,   106,   107,
+     108,    -1,    -1,   111,   112,   113,   114,   115,   116,    -1,
+      -1,   119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,
+      -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,
+     138,    -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,
+      -1,   149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,
+     158,    -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,
+     168,    -1,    -1,    -1,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   189,   190,   191,   192,   193,    -1,   195,    -1,   197,
+      -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,
+     208,   209,    -1,   211,   212,    -1,   214,    -1,   216,   217,
+     218,   219,   220,    -1,   222,   223,    -1,   225,   226,   227,
+     228,    -1,   230,   231,   232,   233,    -1,   235,    -1,   237,
+     238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,
+     248,    -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,    -1,
+     268,    -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,
+     278,   279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,
+     288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,   297,
+     298,   299,   300,    -1,     3,   303,    -1,   305,   306,   307,
+     308,    -1,    -1,    -1,   312,   313,   314,   315,   316,   317,
+      19,    20,    21,    -1,    23,    -1,    -1,    -1,    -1,    -1,
+      29,    30,    31,    32,    -1,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    42,    43,    44,    -1,    46,    47,    48,
+      -1,    -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,
+      -1,    60,    -1,    62,    63,    64,    65,    -1,    -1,    68,
+      -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,
+      79,    80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,
+      -1,    -1,    -1,    92,    93,    -1,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,    -1,   105,   106,   107,   108,
+      -1,    -1,   111,   112,   113,   114,   115,   116,    -1,    -1,
+     119,    -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,
+      -1,    -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,
+      -1,   140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,
+     149,    -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,
+      -1,   160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,
+      -1,    -1,    -1,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     189,   190,   191,   192,   193,    -1,   195,    -1,   197,    -1,
+      -1,    -1,   201,    -1,    -1,    -1,    -1,   206,   207,   208,
+     209,    -1,   211,   212,    -1,   214,    -1,   216,   217,   218,
+     219,   220,    -1,   222,   223,    -1,   225,   226,   227,   228,
+      -1,   230,   231,   232,   233,    -1,   235,    -1,   237,   238,
+      -1,    -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,
+      -1,   250,    -1,    -1,    -1,   254,   255,    -1,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,    -1,   268,
+      -1,    -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,
+     279,    -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,
+     289,   290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,
+     299,   300,    -1,     3,   303,    -1,   305,   306,   307,   308,
+      -1,    -1,    -1,   312,   313,   314,   315,   316,   317,    19,
+      20,    21,    -1,    23,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    31,    32,    -1,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    42,    43,    44,    -1,    46,    47,    48,    -1,
+      -1,    -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,
+      60,    -1,    62,    63,    64,    65,    -1,    -1,    68,    -1,
+      -1,    -1,    -1,    -1,    -1,    75,    -1,    77,    78,    79,
+      80,    81,    82,    -1,    84,    85,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,    -1,   105,   106,   107,   108,    -1,
+      -1,   111,   112,   113,   114,   115,   116,    -1,    -1,   119,
+      -1,    -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,
+      -1,   131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,
+     140,   141,   142,    -1,   144,   145,    -1,    -1,    -1,   149,
+      -1,   151,    -1,   153,    -1,    -1,    -1,    -1,   158,    -1,
+     160,    -1,    -1,   163,   164,   165,    -1,    -1,   168,    -1,
+      -1,    -1,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,
+     190,   191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,
+      -1,   201,    -1,    -1,    -1,    -1,   206,   207,   208,   209,
+      -1,   211,   212,    -1,   214,    -1,   216,   217,   218,   219,
+     220,    -1,   222,   223,    -1,   225,   226,   227,   228,    -1,
+     230,   231,   232,   233,    -1,   235,    -1,   237,   238,    -1,
+      -1,    -1,    -1,    -1,   244,   245,   246,   247,   248,    -1,
+     250,    -1,    -1,    -1,   254,   255,    -1,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,    -1,   268,    -1,
+      -1,    -1,    -1,    -1,   274,   275,   276,    -1,   278,   279,
+      -1,    -1,   282,    -1,    -1,   285,    -1,    -1,   288,   289,
+     290,    -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,
+     300,    -1,     3,   303,    -1,   305,   306,   307,   308,    -1,
+      -1,    -1,   312,   313,   314,   315,   316,   317,    19,    20,
+      21,    -1,    23,    -1,    -1,    -1,    -1,    -1,    29,    30,
+      31,    32,    -1,    34,    35,    36,    37,    38,    39,    -1,
+      -1,    42,    43,    44,    -1,    46,    47,    48,    -1,    -1,
+      -1,    52,    -1,    -1,    55,    56,    57,    -1,    -1,    60,
+      -1,    62,    63,    64,    65,    -1,    -1,    68,    -1,    -1,
+      -1,    -1,    -1,    -1,    75,    -1,    77,    78,    79,    80,
+      81,    82,    -1,    84,    85,    -1,    -1,    -1,    -1,    -1,
+      -1,    92,    93,    -1,    95,    96,    97,    98,    99,   100,
+     101,   102,   103,    -1,   105,   106,   107,   108,    -1,    -1,
+     111,   112,   113,   114,   115,   116,    -1,    -1,   119,    -1,
+      -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,
+     131,    -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,
+     141,   142,    -1,   144,   145,    -1,    -1,    -1,   149,    -1,
+     151,    -1,   153,    -1,    -1,    -1,    -1,   158,    -1,   160,
+      -1,    -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,
+      -1,   172,   173,   174,   175,   176,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,
+     191,   192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,
+     201,    -1,    -1,    -1,    -1,   206,   207,   208,   209,    -1,
+     211,   212,    -1,   214,    -1,   216,   217,   218,   219,   220,
+      -1,   222,   223,    -1,   225,   226,   227,   228,    -1,   230,
+     231,   232,   233,    -1,   235,    -1,   237,   238,    -1,    -1,
+      -1,    -1,    -1,   244,   245,   246,   247,   248,    -1,   250,
+      -1,    -1,    -1,   254,   255,    -1,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,    -1,   268,    -1,    -1,
+      -1,    -1,    -1,   274,   275,   276,    -1,   278,   279,    -1,
+      -1,   282,    -1,    -1,   285,    -1,    -1,   288,   289,   290,
+      -1,   292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,
+      -1,     3,   303,    -1,   305,   306,   307,   308,    -1,    -1,
+      -1,   312,   313,   314,   315,   316,   317,    19,    20,    21,
+      -1,    23,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    -1,    34,    35,    36,    37,    38,    39,    -1,    -1,
+      42,    43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,
+      52,    -1,    -1,    55,    56,    57,    -1,    -1,    60,    -1,
+      62,    63,    64,    65,    -1,    -1,    68,    -1,    -1,    -1,
+      -1,    -1,    -1,    75,    -1,    77,    78,    79,    80,    81,
+      82,    -1,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,    -1,   105,   106,   107,   108,    -1,    -1,   111,
+     112,   113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,
+      -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,
+      -1,    -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,
+     142,    -1,   144,   145,    -1,    -1,    -1,   149,    -1,   151,
+      -1,   153,    -1,    -1,    -1,    -1,   158,    -1,   160,    -1,
+      -1,   163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   189,   190,   191,
+     192,   193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,
+      -1,    -1,    -1,    -1,   206,   207,   208,   209,    -1,   211,
+     212,    -1,   214,    -1,   216,   217,   218,   219,   220,    -1,
+     222,   223,    -1,   225,   226,   227,   228,    -1,   230,   231,
+     232,   233,    -1,   235,    -1,   237,   238,    -1,    -1,    -1,
+      -1,    -1,   244,   245,   246,   247,   248,    -1,   250,    -1,
+      -1,    -1,   254,   255,    -1,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,    -1,   268,    -1,    -1,    -1,
+      -1,    -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,
+     282,    -1,    -1,   285,    -1,    -1,   288,   289,   290,    -1,
+     292,    -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,
+       3,   303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,
+     312,   313,   314,   315,   316,   317,    19,    20,    21,    -1,
+      23,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
+      -1,    34,    35,    36,    37,    38,    39,    -1,    -1,    42,
+      43,    44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,
+      -1,    -1,    55,    56,    57,    -1,    -1,    60,    -1,    62,
+      63,    64,    65,    -1,    -1,    68,    -1,    -1,    -1,    -1,
+      -1,    -1,    75,    -1,    77,    78,    79,    80,    81,    82,
+      -1,    84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,
+      93,    -1,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,    -1,   105,   106,   107,   108,    -1,    -1,   111,   112,
+     113,   114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,
+      -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,
+      -1,    -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,
+      -1,   144,   145,    -1,    -1,    -1,   149,    -1,   151,    -1,
+     153,    -1,    -1,    -1,    -1,   158,    -1,   160,    -1,    -1,
+     163,   164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   189,   190,   191,   192,
+     193,    -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,
+      -1,    -1,    -1,   206,   207,   208,   209,    -1,   211,   212,
+      -1,   214,    -1,   216,   217,   218,   219,   220,    -1,   222,
+     223,    -1,   225,   226,   227,   228,    -1,   230,   231,   232,
+     233,    -1,   235,    -1,   237,   238,    -1,    -1,    -1,    -1,
+      -1,   244,   245,   246,   247,   248,    -1,   250,    -1,    -1,
+      -1,   254,   255,    -1,   257,   258,   259,   260,   261,   262,
+     263,   264,   265,   266,    -1,   268,    -1,    -1,    -1,    -1,
+      -1,   274,   275,   276,    -1,   278,   279,    -1,    -1,   282,
+      -1,    -1,   285,    -1,    -1,   288,   289,   290,    -1,   292,
+      -1,    -1,    -1,    -1,    -1,   298,   299,   300,    -1,     3,
+     303,    -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,
+     313,   314,   315,   316,   317,    19,    20,    21,    -1,    23,
+      -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,    -1,
+      34,    35,    36,    37,    38,    39,    -1,    -1,    42,    43,
+      44,    -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,
+      -1,    55,    56,    57,    -1,    -1,    60,    -1,    62,    63,
+      64,    65,    -1,    -1,    68,    -1,    -1,    -1,    -1,    -1,
+      -1,    75,    -1,    77,    78,    79,    80,    81,    82,    -1,
+      84,    85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,
+      -1,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+      -1,   105,   106,   107,   108,    -1,    -1,   111,   112,   113,
+     114,   115,   116,    -1,    -1,   119,    -1,    -1,    -1,    -1,
+     124,    -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,
+      -1,   135,    -1,    -1,   138,    -1,   140,   141,   142,    -1,
+     144,   145,    -1,    -1,    -1,   149,    -1,   151,    -1,   153,
+      -1,    -1,    -1,    -1,   158,    -1,   160,    -1,    -1,   163,
+     164,   165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,
+      -1,   195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,
+      -1,    -1,   206,   207,   208,   209,    -1,   211,   212,    -1,
+     214,    -1,   216,   217,   218,   219,   220,    -1,   222,   223,
+      -1,   225,   226,   227,   228,    -1,   230,   231,   232,   233,
+      -1,   235,    -1,   237,   238,    -1,    -1,    -1,    -1,    -1,
+     244,   245,   246,   247,   248,    -1,   250,    -1,    -1,    -1,
+     254,   255,    -1,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,    -1,   268,    -1,    -1,    -1,    -1,    -1,
+     274,   275,   276,    -1,   278,   279,    -1,    -1,   282,    -1,
+      -1,   285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,
+      -1,    -1,    -1,    -1,   298,   299,   300,    -1,     3,   303,
+      -1,   305,   306,   307,   308,    -1,    -1,    -1,   312,   313,
+     314,   315,   316,   317,    19,    20,    21,    -1,    23,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    31,    32,    -1,    34,
+      35,    36,    37,    38,    39,    -1,    -1,    42,    43,    44,
+      -1,    46,    47,    48,    -1,    -1,    -1,    52,    -1,    -1,
+      55,    56,    57,    -1,    -1,    60,    -1,    62,    63,    64,
+      65,    -1,    -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,
+      75,    -1,    77,    78,    79,    80,    81,    82,    -1,    84,
+      85,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,    -1,
+     105,   106,   107,   108,    -1,    -1,   111,   112,   113,   114,
+     115,   116,    -1,    -1,   119,    -1,    -1,    -1,    -1,   124,
+      -1,    -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,
+     135,    -1,    -1,   138,    -1,   140,   141,   142,    -1,   144,
+     145,    -1,    -1,    -1,   149,    -1,   151,    -1,   153,    -1,
+      -1,    -1,    -1,   158,    -1,   160,    -1,    -1,   163,   164,
+     165,    -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,
+     195,    -1,   197,    -1,    -1,    -1,   201,    -1,    -1,    -1,
+      -1,   206,   207,   208,   209,    -1,   211,   212,    -1,   214,
+      -1,   216,   217,   218,   219,   220,    -1,   222,   223,    -1,
+     225,   226,   227,   228,    -1,   230,   231,   232,   233,    -1,
+     235,    -1,   237,   238,    -1,    -1,    -1,    -1,    -1,   244,
+     245,   246,   247,   248,    -1,   250,    -1,    -1,    -1,   254,
+     255,    -1,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,    -1,   268,    -1,    -1,    -1,    -1,    -1,   274,
+     275,   276,    -1,   278,   279,    -1,    -1,   282,    -1,    -1,
+     285,    -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,
+      -1,    -1,    -1,   298,   299,   300,    -1,     3,   303,    -1,
+     305,   306,   307,   308,    -1,    -1,    -1,   312,   313,   314,
+     315,   316,   317,    19,    20,    21,    -1,    23,    -1,    25,
+      -1,    -1,    -1,    29,    30,    31,    32,    -1,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    42,    43,    44,    -1,
+      46,    47,    48,    -1,    -1,    -1,    52,    -1,    -1,    55,
+      56,    57,    -1,    -1,    60,    -1,    62,    63,    64,    65,
+      -1,    -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,    75,
+      -1,    77,    78,    79,    80,    81,    82,    -1,    84,    85,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,    -1,   105,
+     106,   107,   108,    -1,    -1,   111,   112,   113,   114,   115,
+     116,    -1,    -1,   119,    -1,    -1,    -1,    -1,   124,    -1,
+      -1,    -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,
+      -1,    -1,   138,    -1,   140,   141,   142,    -1,   144,   145,
+      -1,    -1,    -1,   149,    -1,   151,    -1,   153,    -1,    -1,
+      -1,    -1,    -1,    -1,   160,    -1,    -1,   163,   164,   165,
+      -1,    -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   189,   190,   191,   192,   193,    -1,   195,
+      -1,    -1,    -1,    -1,    -1,   201,    -1,    -1,    -1,    -1,
+     206,   207,   208,   209,    -1,   211,   212,    -1,   214,    -1,
+     216,   217,   218,   219,   220,    -1,   222,   223,    -1,   225,
+     226,   227,   228,    -1,   230,   231,    -1,    -1,    -1,   235,
+      -1,   237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,
+     246,   247,   248,    -1,   250,    -1,    -1,    -1,   254,   255,
+      -1,   257,   258,   259,   260,   261,   262,   263,   264,   265,
+     266,    -1,   268,    -1,    -1,    -1,    -1,    -1,   274,   275,
+     276,    -1,   278,   279,    -1,    -1,   282,    -1,    -1,   285,
+      -1,    -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,
+      -1,    -1,   298,   299,   300,    -1,     3,   303,    -1,   305,
+     306,   307,   308,    -1,    -1,    -1,   312,   313,   314,   315,
+     316,   317,    19,    20,    21,    -1,    23,    -1,    -1,    -1,
+      -1,    28,    29,    30,    31,    32,    -1,    34,    -1,    -1,
+      -1,    38,    -1,    -1,    -1,    42,    43,    -1,    -1,    46,
+      -1,    48,    -1,    -1,    -1,    52,    -1,    54,    55,    56,
+      57,    -1,    -1,    60,    -1,    62,    63,    64,    65,    -1,
+      -1,    68,    -1,    70,    -1,    -1,    -1,    -1,    75,    76,
+      77,    78,    79,    80,    -1,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,    -1,    -1,   106,
+     107,    -1,    -1,    -1,   111,   112,   113,   114,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,   123,   124,    -1,    -1,
+      -1,    -1,    -1,    -1,   131,    -1,    -1,    -1,   135,    -1,
+      -1,   138,    -1,   140,   141,   142,   143,   144,    -1,    -1,
+      -1,    -1,    -1,    -1,   151,   152,   153,    -1,    -1,   156,
+      -1,   158,    -1,   160,    -1,    -1,   163,    -1,   165,    -1,
+      -1,   168,    -1,    -1,    -1,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   191,   192,   193,    -1,   195,    -1,
+     197,    -1,    -1,    -1,   201,    -1,    -1,    -1,   205,   206,
+     207,   208,   209,    -1,   211,   212,    -1,   214,    -1,   216,
+     217,   218,   219,   220,    -1,   222,    -1,    -1,   225,   226,
+     227,   228,    -1,   230,   231,   232,   233,    -1,   235,   236,
+     237,   238,    -1,    -1,    -1,    -1,    -1,   244,   245,   246,
+     247,   248,    -1,   250,    17,    -1,    19,   254,   255,    -1,
+     257,    -1,   259,    -1,   261,   262,   263,   264,   265,   266,
+      -1,   268,    17,    -1,    19,    -1,    -1,   274,   275,   276,
+      17,    -1,    19,    -1,    -1,   282,    -1,    50,   285,    -1,
+      -1,   288,   289,   290,    -1,   292,    -1,    -1,    -1,    -1,
+      -1,   298,   299,   300,    -1,    50,    -1,    -1,   305,   306,
+     307,    -1,    -1,    50,    -1,   312,   313,   314,   315,   316,
+     317,    -1,    -1,    -1,    -1,    88,    -1,    -1,    -1,    -1,
+      -1,    94,    -1,    -1,    -1,    98,    99,    -1,    17,    -1,
+      19,    -1,    -1,    88,    -1,    -1,    -1,    -1,   111,    94,
+      -1,    88,    -1,    98,    99,    -1,    -1,    94,    -1,    -1,
+      -1,    98,    99,    -1,    -1,    -1,   111,    -1,    -1,    -1,
+      -1,    50,    -1,    -1,   111,   138,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   138,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   138,    -1,    -1,    17,    -1,    19,    -1,   171,    88,
+      -1,    -1,    -1,    -1,    -1,    94,    -1,    -1,    -1,    98,
+      99,    -1,   185,    -1,    -1,    -1,   171,    -1,    -1,   192,
+      -1,   194,   111,    -1,   171,    -1,    -1,    50,    -1,    -1,
+     185,    -1,    -1,   206,    -1,   208,    -1,   192,   185,   194,
+      -1,    -1,    -1,    -1,    -1,   192,    -1,   194,    -1,   138,
+      -1,   206,   225,   208,    -1,   228,    -1,    -1,    -1,   206,
+      -1,   208,    -1,    -1,    -1,    88,    -1,    -1,    -1,    -1,
+     225,    94,    -1,   228,    -1,    98,    99,    -1,   225,    -1,
+     253,   228,   171,    -1,    -1,    -1,    -1,    -1,   111,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   185,    -1,   253,    17,
+      -1,    19,    -1,   192,    -1,   194,   253,   280,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   138,    -1,   206,    -1,   208,
+      -1,    -1,    -1,    -1,    -1,   280,    -1,    -1,   301,    -1,
+      -1,    -1,    50,   280,    -1,    -1,   225,    -1,    -1,   228,
+      -1,    -1,    -1,    -1,    -1,    -1,   301,    -1,   171,    -1,
+      -1,    -1,    -1,    -1,   301,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   185,    -1,   253,    -1,    -1,    -1,    -1,   192,
+      88,   194,    -1,    -1,    -1,    -1,    94,    -1,    -1,    -1,
+      98,    99,    -1,   206,    -1,   208,    -1,    -1,    -1,    -1,
+      -1,   280,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   225,    -1,    -1,   228,    -1,    -1,    -1,    -1,
+      -1,    -1,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     138,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     253,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   171,    -1,    -1,    -1,   280,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   185,    -1,    -1,
+      -1,    -1,    -1,    -1,   192,    -1,   194,    -1,   301,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   206,    -1,
+     208,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   225,    -1,    -1,
+     228,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   280,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   301
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,    19,    23,    32,    52,    69,    94,   100,   105,   109,
+     228,   238,   246,   249,   253,   255,   262,   267,   285,   295,
+     302,   311,   336,   345,   346,   347,   348,   351,   356,   357,
+     358,   389,   395,   461,   476,   478,   481,   502,   540,   550,
+     551,   552,   553,   579,   597,   602,   603,   607,   608,   609,
+     610,   612,   613,   135,   273,   306,   282,   314,   614,   614,
+     101,   614,   124,   160,   203,   237,   274,   276,   294,   298,
+     396,   462,    54,    55,   102,   113,   114,   122,   135,   165,
+     247,   263,   273,   289,   290,   306,   479,   282,   614,    20,
+      21,   305,   336,   420,   476,   482,   502,   551,   602,     3,
+      18,    19,    20,    21,    23,    29,    30,    31,    32,    34,
+      35,    36,    37,    38,    39,    42,    43,    44,    46,    47,
+      48,    52,    55,    56,    57,    60,    62,    63,    64,    65,
+      68,    75,    77,    78,    79,    80,    81,    82,    84,    85,
+      92,    93,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   105,   106,   107,   108,   111,   112,   113,   114,   115,
+     116,   119,   124,   131,   135,   138,   140,   141,   142,   144,
+     145,   149,   151,   153,   158,   160,   163,   164,   165,   168,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     189,   190,   191,   192,   193,   195,   197,   201,   206,   207,
+     208,   209,   211,   212,   214,   216,   217,   218,   219,   220,
+     222,   223,   225,   226,   227,   228,   230,   231,   232,   233,
+     235,   237,   238,   244,   245,   246,   247,   248,   250,   251,
+     254,   255,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   268,   274,   275,   276,   278,   279,   282,   285,
+     288,   289,   290,   292,   298,   299,   300,   303,   305,   306,
+     307,   308,   312,   313,   314,   315,   316,   317,   432,   606,
+     617,   620,   101,   614,   262,   278,   282,   432,    18,    90,
+     529,    46,   160,   178,   237,   247,   251,   278,   282,   315,
+     572,   573,   606,    18,   251,   278,   282,   606,   432,   282,
+     273,   200,   215,   432,   542,   544,   546,   336,   475,   224,
+     432,   434,   465,   517,   552,   553,   612,     0,   339,    88,
+     137,   167,   204,   293,   582,   583,   340,   550,   552,   579,
+     131,   542,   131,   544,   131,   542,    87,   151,   185,   222,
+     595,   596,   615,     5,   131,   549,   274,   276,   274,   276,
+     226,     3,    28,    54,    70,    76,   123,   143,   152,   156,
+     205,   236,   386,   519,   617,   619,   620,   135,   224,   263,
+     273,   306,   286,   273,    76,   306,   257,   131,   432,   438,
+     439,   549,   482,   483,   484,   485,   519,   305,   539,    28,
+     317,   151,   338,   131,   549,   280,   432,     3,     4,     8,
+       9,    10,    35,    36,    37,    39,    44,    66,    71,    73,
+      74,    81,    83,    84,    85,    93,   108,   110,   119,   126,
+     145,   148,   149,   155,   157,   161,   164,   182,   185,   187,
+     188,   189,   190,   201,   213,   215,   223,   240,   241,   252,
+     258,   271,   272,   279,   283,   284,   328,   329,   330,   336,
+     421,   422,   427,   431,   432,   457,   458,   459,   460,   495,
+     496,   499,   514,   521,   543,   549,   552,   593,   594,   601,
+     619,   620,   549,   251,   572,    86,   531,   549,   519,   520,
+     549,   549,    28,    48,   572,   317,   266,   596,   202,   121,
+     280,   324,    28,   317,   151,   615,   544,   545,   336,   542,
+     338,   341,   500,   501,   501,   330,    25,   432,   253,    86,
+     421,   473,   474,   465,   340,   517,   518,   535,   337,   337,
+     347,   121,   532,   147,    18,    90,   525,    41,   525,   120,
+     158,   197,   556,   558,   559,   560,   563,   565,   566,   475,
+     582,   583,   108,    17,    19,    50,    88,    94,    98,    99,
+     111,   138,   171,   185,   192,   194,   206,   208,   225,   228,
+     253,   280,   301,   359,   360,   363,   371,   373,   108,   225,
+     359,   108,   225,   253,   359,   157,    87,   200,   312,   340,
+     595,   108,   462,   311,   393,    76,   397,   306,   542,   131,
+     349,   542,   542,   131,   438,    77,   103,   219,   275,   108,
+     338,   440,    43,   231,   340,   530,   337,   340,     4,   117,
+     198,   287,   328,   329,   486,   499,   520,   522,   527,   576,
+     482,   157,   432,   108,   262,   432,   533,   308,   421,   428,
+     429,   336,   336,   336,   336,   538,   538,   211,   552,   336,
+     336,   336,   336,   336,   336,   421,   336,   538,   538,   336,
+     421,   501,   336,   537,   336,   336,   421,   421,   421,   487,
+     552,     3,     8,    11,    22,    25,    33,   133,   150,   159,
+     185,   201,   203,   324,   325,   326,   328,   329,   330,   331,
+     332,   333,   334,   415,   418,   515,   543,   338,   501,   318,
+     336,   549,   549,   336,   549,   421,   121,   340,   489,    48,
+      86,   520,    25,     3,    86,   160,   458,   522,   549,   616,
+     549,    67,    92,   477,    72,    86,   522,   527,   604,   605,
+      86,   604,   157,    68,   230,   340,   536,   542,     3,    16,
+      17,    18,    22,    24,    25,    26,    27,    33,    41,    49,
+      50,    51,    53,    58,    59,    61,    67,    69,    72,    86,
+      87,    88,    89,    90,    94,   104,   117,   118,   120,   121,
+     122,   125,   127,   128,   130,   132,   133,   134,   136,   137,
+     139,   146,   147,   150,   157,   159,   162,   166,   167,   169,
+     170,   171,   183,   184,   185,   186,   187,   194,   196,   198,
+     199,   200,   202,   203,   204,   210,   213,   215,   221,   229,
+     234,   239,   240,   241,   242,   243,   249,   251,   253,   256,
+     267,   269,   270,   271,   273,   277,   280,   286,   287,   291,
+     293,   294,   295,   296,   297,   301,   302,   304,   309,   310,
+     311,   330,   423,   433,   617,   618,   619,   620,   421,   500,
+     432,   336,   432,   516,   554,   555,   574,   577,   337,   340,
+     434,   340,    25,   544,   542,   550,   421,   580,   581,   550,
+     153,   192,   222,   254,   295,    18,   421,   567,   421,   431,
+     568,   563,   564,   120,   559,   194,   561,   556,   557,   566,
+     565,   556,   563,   542,    49,    51,    61,   112,   122,   193,
+     218,   294,   336,   378,   379,    51,   387,   198,   193,    61,
+     387,   245,   286,    41,    30,   244,   245,   286,   542,   387,
+     194,   138,   439,   280,   336,   280,   336,   407,   288,   311,
+     313,   407,   127,   193,    61,   340,   544,   280,   387,   542,
+     280,   247,   222,   227,   250,   509,   595,   549,   224,   306,
+     352,   398,   399,   432,   542,    62,    63,    78,    79,   134,
+     174,   175,   176,   177,   192,   209,   230,   267,   390,   391,
+     392,   185,    25,   194,   336,   448,   336,   448,   108,   530,
+     438,   423,   338,    64,   439,   216,   480,   482,   484,   499,
+       4,   499,   549,   432,   500,   421,   308,   428,   104,   426,
+     429,   421,   487,   499,   421,   491,   492,   487,     3,    82,
+     129,   168,   172,   248,   316,   493,   494,   549,   499,   487,
+     487,   499,   492,   421,     8,   324,   325,   326,   328,   329,
+     330,   331,   332,   333,   418,   419,   432,   499,   311,   421,
+      40,   121,   154,   281,   421,   487,   488,   337,   340,    34,
+      35,    36,    37,    38,    39,    47,    65,    81,    84,    85,
+      93,   119,   145,   148,   149,   164,   179,   180,   189,   190,
+     191,   221,   223,   258,   279,   303,   304,   424,   430,   458,
+     459,   521,   578,   600,   421,   433,   328,   329,   425,   431,
+     543,   336,   552,   185,   187,   265,   421,    33,   133,   159,
+     336,   421,   265,   421,   265,   421,   265,   421,   265,   421,
+     265,   421,   265,   421,   265,   421,   265,   421,   265,   421,
+     278,    18,    24,   414,   265,   421,    74,   182,   338,   499,
+      82,   129,   168,   172,   248,   316,   508,   534,    18,    90,
+     330,   337,   492,   336,   490,   510,   544,   552,   592,   593,
+     310,   611,   282,   336,   549,   340,   144,   144,   544,   530,
+     337,   342,   343,   574,   575,   533,   340,   611,   324,   473,
+     517,   336,    25,   417,   432,   524,    25,    86,   336,   503,
+     504,   505,   551,    26,    89,   526,   340,   254,   153,   200,
+     340,   239,   242,   541,   542,   186,   562,   564,   557,   225,
+     359,   336,   432,   435,   517,   297,   400,   153,   336,   376,
+     153,   297,   336,   380,   435,   432,   517,   376,   131,   517,
+     131,   432,   517,    18,   296,   517,     3,   370,   432,   496,
+     245,   286,   245,   286,   517,    18,   296,   517,   432,   542,
+     386,    17,    94,   253,   364,   365,   366,   367,   433,   517,
+     409,   410,   433,   517,   207,    50,   207,   375,   432,   376,
+     517,   360,   225,   359,   517,   517,   225,   253,   359,   517,
+     517,    57,   292,   222,   306,   542,     3,    31,    56,   116,
+     133,   138,   220,   237,   264,   296,   299,   307,   353,   355,
+     198,   336,   522,    41,   394,   522,   522,    62,   174,   176,
+      41,   393,   393,   392,   108,   551,   439,   112,   159,   218,
+     378,   432,   435,   449,   450,   523,   587,   588,   591,   311,
+     313,   466,   432,    25,   438,   530,   423,   277,   426,   421,
+     105,   337,   340,   337,   337,   340,   337,   337,   121,   337,
+     337,   337,   337,   337,   340,   337,   338,   337,   160,   278,
+      25,   488,   487,   488,   488,   121,   337,   421,   336,    82,
+     316,   221,   336,   336,   336,   537,   336,   425,   425,    11,
+      22,   150,   201,   324,   325,   326,   328,   329,   330,   331,
+     332,   333,   543,   425,   487,   187,   336,   552,   106,   425,
+     336,   552,   265,   421,   419,   336,   552,   336,   552,   336,
+     552,   336,   552,   552,   336,   552,   336,   552,   336,   552,
+     336,   552,   317,   336,   552,   336,   552,    74,   182,   337,
+     280,   280,   280,   336,   280,   492,   492,   337,   337,   582,
+     510,   552,   592,   340,   524,   524,    70,   123,   143,   152,
+     156,   236,   513,   421,   127,   497,   596,   499,   534,   605,
+     212,   216,   598,   421,   337,   340,   555,   232,   233,   547,
+      86,   421,   569,   551,   432,   336,   611,   302,   432,   506,
+     507,   432,   547,   580,   295,   568,   340,   280,   421,   600,
+     379,   401,   432,   336,   336,   374,   377,   432,   336,   380,
+     135,   449,   384,   337,    94,   228,   253,   361,   363,   388,
+     108,   530,   108,   530,   501,   336,   517,   517,   517,   517,
+     600,   366,   367,   366,   337,   340,   368,   549,   337,   340,
+     324,   338,   280,   387,   280,   280,   247,   542,   448,   354,
+     386,   158,   220,   127,   237,   187,   549,   354,   499,   354,
+     220,   300,   542,   449,   522,   439,   522,   522,   542,   350,
+     336,   469,   542,   337,   340,   337,   340,   207,   407,   207,
+     198,   467,   551,   530,   480,   421,   105,   421,   491,   421,
+     421,   419,   278,   317,   600,   337,   337,   337,   487,   337,
+     499,   537,   537,   499,   499,   499,   499,   600,   425,    90,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     337,   421,   421,    22,   487,   336,   552,   106,   337,   421,
+     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
+     549,   129,   168,   508,   168,   508,   508,   499,   172,   582,
+     583,   583,   549,   337,   337,   592,   152,   205,   512,   592,
+     512,   512,   152,    41,   128,   498,   337,   165,   165,    94,
+     235,   599,   342,   324,   574,   548,   594,   548,   337,   336,
+     518,   547,   533,   337,   340,   336,   504,   542,   517,   337,
+     464,   336,   382,   383,   403,   432,   495,   496,   449,   337,
+     340,   449,   384,   399,   337,    87,   139,   185,   192,   385,
+      86,   185,   407,    86,    96,   185,   261,   268,   407,   289,
+     517,   432,   492,    59,   369,   365,   410,     3,    34,    38,
+      65,   179,   180,   191,   201,   221,   260,   304,   328,   329,
+     411,   412,   413,   418,   522,   549,   600,   601,   618,   620,
+     433,   517,   517,   517,   517,   517,   336,   311,   408,   340,
+     329,   576,   549,   354,   354,   549,   549,   400,   337,   194,
+     336,   378,   432,   470,   471,   472,   466,   589,   450,   140,
+     463,   587,    52,   288,   416,   337,   317,   337,    42,    47,
+     528,   280,   280,   337,   337,   337,   528,   121,   337,   425,
+     337,   421,   421,   337,   337,   337,   337,   337,   337,   337,
+     337,   337,   337,   534,   337,   337,   337,   417,   592,   198,
+     592,   487,   421,   267,   319,   320,   585,   586,   549,   306,
+     306,    18,   268,   268,   336,   571,   518,   337,   551,   507,
+     506,   547,   384,   436,   421,   337,   340,   311,    59,   404,
+     501,   404,   336,   337,   374,   337,   311,   442,    95,   132,
+      87,   307,   138,   187,   421,   187,   576,   432,   600,   530,
+     530,   337,   439,   297,   362,   336,   601,   440,   324,   280,
+     449,   407,    25,   386,   336,    25,   439,   523,   311,   337,
+     340,   467,   115,   141,   336,   466,    88,    94,   212,   517,
+     371,   468,   337,   248,   172,   337,   425,   337,   421,   198,
+     297,   511,   311,   421,   421,   586,   584,   585,   534,   163,
+     163,   268,   569,   570,   337,   337,    49,    59,    61,    86,
+      87,   139,   185,   187,   218,   243,   294,   437,   441,   456,
+     337,   442,   383,   201,   419,   439,   297,   405,   439,   405,
+     492,   243,   442,   336,   443,   297,   446,   369,   421,   419,
+     440,   332,   411,   517,   337,   551,   402,   403,   551,   469,
+     337,   208,   471,   416,    18,    64,    80,    97,   142,   268,
+     590,   590,   541,   467,   242,   242,   372,   373,   336,   421,
+     336,   421,   337,   340,   336,   504,   336,   439,   517,   425,
+      95,   132,    87,   187,   153,   542,   442,   404,   446,   336,
+     439,   526,   526,   337,   542,   446,   433,   444,   445,   135,
+     384,   362,   337,   332,   289,    25,   337,   340,   466,   463,
+     436,   468,   337,   416,   499,   518,   569,   506,   547,   421,
+     185,   441,   442,   448,   446,   405,   310,   381,   419,    14,
+      15,   406,   406,   448,   384,   337,   340,   288,   289,   551,
+     408,   403,   467,   466,   372,   468,   337,   337,   337,   337,
+     446,   173,   451,   526,   336,   384,   337,   451,   445,   517,
+     416,   416,   467,   372,   551,   192,   447,   123,   217,   259,
+     198,   452,   453,   454,   406,   421,   452,   611,   468,   416,
+     547,   138,    88,   295,   198,   454,   198,   453,   337,   384,
+     372,   468,    43,   192,   231,   253,   455,   455,   372,    29,
+      86,   187
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   344,   345,   346,   346,   347,   347,   347,   347,   347,
+     347,   347,   347,   347,   347,   347,   347,   347,   347,   347,
+     347,   347,   347,   347,   347,   347,   348,   349,   350,   351,
+     352,   352,   353,   353,   353,   353,   353,   353,   354,   354,
+     355,   355,   355,   355,   355,   355,   355,   355,   355,   356,
+     356,   357,   357,   357,   357,   357,   357,   357,   357,   358,
+     358,   358,   358,   358,   358,   359,   359,   360,   360,   360,
+     360,   360,   360,   360,   360,   360,   360,   360,   360,   360,
+     360,   360,   360,   360,   360,   360,   360,   360,   360,   360,
+     360,   360,   360,   360,   360,   360,   360,   360,   360,   360,
+     360,   360,   360,   360,   360,   360,   360,   360,   360,   360,
+     360,   360,   360,   360,   361,   361,   362,   362,   363,   364,
+     364,   365,   365,   365,   365,   366,   367,   368,   369,   369,
+     370,   371,   371,   372,   372,   373,   373,   374,   375,   376,
+     377,   377,   378,   378,   379,   379,   379,   379,   379,   379,
+     379,   380,   381,   381,   382,   382,   383,   383,   384,   384,
+     385,   385,   385,   385,   385,   385,   386,   387,   387,   388,
+     388,   389,   390,   390,   391,   391,   392,   392,   392,   392,
+     392,   392,   392,   392,   392,   392,   392,   392,   392,   392,
+     392,   392,   393,   393,   394,   394,   395,   396,   396,   397,
+     397,   398,   398,   399,   400,   400,   401,   402,   402,   403,
+     403,   403,   404,   404,   405,   405,   405,   406,   406,   406,
+     407,   408,   408,   409,   409,   410,   410,   410,   410,   411,
+     411,   411,   411,   411,   412,   412,   412,   413,   413,   414,
+     414,   415,   415,   415,   415,   416,   416,   417,   417,   417,
+     417,   418,   418,   419,   419,   420,   420,   421,   421,   421,
+     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
+     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
+     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
+     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
+     421,   421,   421,   421,   421,   421,   421,   421,   421,   421,
+     421,   421,   421,   421,   421,   422,   422,   422,   422,   422,
+     422,   422,   422,   422,   423,   424,   424,   424,   424,   425,
+     425,   425,   425,   425,   425,   425,   425,   425,   425,   425,
+     425,   425,   425,   425,   425,   425,   426,   426,   427,   427,
+     428,   428,   429,   430,   430,   430,   430,   430,   430,   430,
+     430,   430,   431,   431,   431,   431,   431,   431,   431,   431,
+     431,   432,   432,   432,   433,   433,   433,   433,   433,   434,
+     435,   436,   436,   437,   437,   437,   437,   438,   438,   439,
+     439,   440,   440,   441,   441,   441,   441,   441,   441,   441,
+     442,   442,   443,   444,   444,   445,   446,   446,   447,   447,
+     448,   448,   449,   449,   450,   451,   451,   451,   451,   452,
+     452,   452,   452,   452,   453,   454,   455,   455,   455,   455,
+     455,   456,   456,   456,   456,   457,   457,   457,   457,   457,
+     458,   459,   459,   459,   459,   460,   460,   461,   461,   461,
+     461,   462,   462,   462,   462,   462,   462,   462,   462,   463,
+     463,   464,   465,   465,   466,   466,   466,   466,   467,   467,
+     467,   467,   468,   468,   469,   469,   470,   470,   471,   471,
+     472,   473,   473,   474,   474,   475,   476,   477,   477,   478,
+     478,   478,   478,   479,   479,   479,   479,   479,   479,   479,
+     479,   479,   479,   479,   479,   479,   479,   479,   479,   479,
+     480,   480,   481,   481,   481,   481,   482,   482,   482,   482,
+     483,   483,   484,   485,   486,   486,   486,   487,   487,   488,
+     488,   488,   489,   489,   490,   490,   491,   492,   492,   493,
+     493,   494,   494,   494,   494,   494,   494,   494,   494,   495,
+     495,   495,   495,   495,   495,   495,   495,   495,   495,   495,
+     495,   495,   495,   495,   495,   495,   495,   495,   495,   495,
+     495,   495,   495,   495,   495,   495,   495,   495,   495,   495,
+     495,   496,   496,   496,   497,   497,   498,   498,   499,   500,
+     500,   500,   500,   501,   501,   502,   502,   502,   502,   503,
+     503,   504,   504,   505,   505,   506,   506,   507,   508,   508,
+     509,   509,   509,   509,   510,   510,   510,   510,   511,   511,
+     512,   512,   513,   513,   513,   513,   514,   515,   515,   515,
+     515,   515,   515,   515,   515,   515,   516,   517,   518,   518,
+     519,   519,   519,   519,   520,   520,   521,   521,   521,   521,
+     521,   521,   521,   521,   521,   521,   521,   521,   521,   521,
+     521,   521,   522,   522,   522,   523,   523,   524,   524,   525,
+     525,   525,   526,   526,   526,   527,   527,   527,   527,   528,
+     528,   528,   529,   529,   529,   530,   530,   530,   530,   531,
+     531,   531,   532,   532,   533,   533,   534,   534,   534,   534,
+     534,   534,   534,   534,   534,   534,   534,   534,   534,   534,
+     535,   535,   536,   536,   536,   537,   537,   538,   538,   539,
+     539,   540,   540,   541,   541,   542,   542,   542,   543,   543,
+     544,   544,   544,   544,   545,   545,   546,   546,   546,   547,
+     547,   547,   548,   549,   550,   550,   551,   551,   552,   552,
+     553,   553,   553,   553,   553,   553,   553,   553,   554,   554,
+     555,   555,   556,   556,   557,   557,   558,   558,   559,   560,
+     560,   560,   560,   561,   561,   562,   562,   563,   563,   563,
+     563,   564,   564,   565,   565,   566,   566,   566,   567,   567,
+     568,   569,   569,   570,   570,   571,   572,   572,   572,   573,
+     573,   573,   573,   573,   573,   573,   573,   573,   573,   573,
+     573,   573,   573,   574,   575,   575,   576,   576,   576,   577,
+     578,   578,   578,   578,   578,   578,   578,   578,   579,   579,
+     579,   579,   579,   579,   580,   581,   581,   582,   583,   583,
+     584,   584,   585,   586,   586,   587,   587,   587,   588,   589,
+     589,   589,   590,   590,   590,   590,   590,   590,   591,   591,
+     592,   592,   592,   592,   593,   593,   593,   593,   594,   594,
+     595,   595,   595,   595,   595,   596,   596,   596,   597,   598,
+     598,   598,   599,   599,   599,   599,   600,   601,   601,   601,
+     602,   603,   603,   604,   604,   605,   605,   606,   606,   607,
+     607,   607,   607,   607,   608,   608,   608,   609,   609,   609,
+     609,   609,   610,   610,   610,   610,   611,   611,   612,   612,
+     613,   613,   613,   613,   613,   613,   613,   613,   613,   613,
+     613,   613,   613,   613,   613,   613,   614,   614,   614,   615,
+     615,   616,   616,   616,   616,   616,   616,   616,   617,   617,
+     617,   617,   617,   617,   617,   617,   617,   617,   617,   617,
+     617,   617,   617,   617,   617,   617,   617,   617,   617,   617,
+     617,   617,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   618,   618,   618,   618,   618,   618,
+     618,   618,   618,   618,   619,   619,   619,   619,   619,   619,
+     619,   619,   619,   619,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620,   620,   620,   620,   620,
+     620,   620,   620,   620,   620,   620
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     7,     7,     0,     5,
+       2,     0,     1,     2,     2,     2,     3,     3,     1,     3,
+       2,     2,     3,     3,     1,     3,     3,     2,     1,     6,
+       8,     6,     8,     6,     8,     6,     8,     8,    10,     4,
+       6,     4,     6,     4,     6,     1,     3,     4,     3,     4,
+       6,     6,     6,     5,     5,     6,     6,     4,     8,     6,
+       4,     2,     3,     6,     4,     3,     3,     3,     3,     3,
+       4,     4,     3,     3,     3,     3,     3,     3,     4,     4,
+       3,     2,     3,     2,     2,     3,     3,     2,     2,     1,
+       1,     1,     3,     3,     2,     0,     2,     0,     4,     1,
+       3,     1,     2,     2,     2,     2,     1,     1,     2,     0,
+       1,     3,     6,     1,     0,     3,     3,     1,     1,     3,
+       3,     1,     3,     1,     5,     7,     3,     8,     4,     9,
+      11,     3,     4,     0,     1,     3,     3,     6,     0,     2,
+       2,     1,     2,     2,     2,     2,     1,     1,     0,     3,
+       2,     5,     1,     0,     1,     2,     2,     1,     1,     2,
+       1,     3,     2,     2,     2,     1,     2,     1,     3,     3,
+       1,     3,     1,     0,     1,     0,    14,     1,     0,     1,
+       0,     1,     0,     1,     2,     0,     1,     1,     3,     5,
+       5,     7,     2,     0,     1,     2,     0,     1,     1,     0,
+       3,     2,     0,     1,     3,     3,     1,     5,     3,     1,
+       1,     1,     1,     1,     1,     4,     5,     1,     4,     1,
+       1,     1,     4,     1,     2,     2,     0,     5,     2,     4,
+       1,     1,     1,     1,     3,     1,     1,     1,     3,     5,
+       2,     2,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     2,     2,     3,     3,     2,     3,     5,     4,
+       6,     3,     4,     5,     6,     3,     5,     4,     6,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     5,     6,     6,     6,     6,     6,     6,     6,     6,
+       6,     6,     6,     7,     2,     1,     1,     1,     1,     2,
+       5,     2,     3,     6,     1,     1,     1,     2,     4,     1,
+       3,     2,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     2,     2,     5,     2,     0,     4,     5,
+       1,     2,     4,     2,     5,     4,     5,     1,     4,     1,
+       1,     1,     1,     1,     1,     1,     3,     2,     1,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     6,
+       4,     2,     0,     3,     1,     1,     2,     1,     3,     1,
+       2,     2,     3,     2,     1,     3,     4,     5,     2,     5,
+       2,     0,     3,     1,     3,     1,     4,     0,     2,     0,
+       3,     0,     1,     3,     1,     2,     2,     2,     0,     1,
+       1,     2,     2,     0,     3,     3,     2,     1,     1,     2,
+       2,     1,     2,     2,     2,     1,     1,     1,     2,     2,
+       1,     1,     2,     5,     6,     1,     1,    13,    16,    12,
+      15,     1,     1,     2,     2,     2,     2,     1,     0,     4,
+       0,     0,     1,     3,     2,     2,     2,     0,     3,     4,
+       4,     0,     1,     0,     3,     0,     1,     3,     1,     1,
+       4,     1,     1,     1,     3,     3,     7,     1,     1,     7,
+       5,     5,     7,     1,     1,     1,     2,     1,     2,     2,
+       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
+       1,     0,     2,     4,     3,     5,     1,     1,     1,     1,
+       1,     3,     2,     1,     1,     1,     0,     1,     3,     3,
+       2,     1,     2,     0,     1,     3,     1,     1,     3,     3,
+       0,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       4,     5,     6,     6,     4,     1,     1,     1,     1,     4,
+       1,     4,     4,     6,     4,     4,     6,     5,     5,     5,
+       4,     1,     1,     4,     1,     4,     4,     3,     4,     3,
+       4,     1,     2,     2,     3,     0,     2,     0,     1,     2,
+       2,     3,     5,     1,     2,     6,     8,    11,    14,     1,
+       0,     1,     2,     4,     1,     1,     3,     2,     1,     4,
+       2,     2,     2,     1,     3,     4,     5,     5,     4,     2,
+       1,     0,     2,     2,     2,     1,     5,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     5,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     4,     2,     2,     2,     2,
+       2,     1,     1,     2,     1,     1,     0,     1,     0,     1,
+       1,     0,     1,     1,     0,     1,     1,     1,     1,     1,
+       1,     0,     1,     1,     0,     1,     2,     1,     0,     1,
+       1,     0,     1,     0,     0,     2,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     3,     3,     3,     3,     0,
+       1,     0,     2,     2,     0,     3,     0,     3,     0,     1,
+       0,     1,     0,     1,     3,     1,     2,     2,     1,     4,
+       1,     2,     2,     4,     1,     3,     1,     2,     3,     2,
+       2,     0,     1,     1,     1,     1,     1,     1,     3,     3,
+       1,     2,     4,     4,     2,     3,     5,     5,     1,     3,
+       1,     1,     1,     3,     1,     0,     1,     2,     3,     2,
+       4,     2,     3,     2,     0,     1,     0,     2,     2,     1,
+       1,     1,     0,     2,     4,     2,     3,     3,     1,     1,
+       1,     1,     1,     1,     3,     3,     2,     5,     1,     3,
+       3,     3,     3,     3,     3,     2,     2,     2,     2,     3,
+       3,     3,     3,     2,     1,     3,     1,     2,     2,     3,
+       1,     1,     1,     1,     1,     5,     5,     8,     7,     9,
+       9,     4,     4,     1,     2,     1,     3,     3,     1,     0,
+       1,     0,     3,     2,     2,     1,     1,     1,     3,     3,
+       3,     0,     1,     1,     1,     1,     1,     1,     1,     3,
+       2,     2,     1,     4,     3,     2,     1,     1,     1,     3,
+       3,     2,     2,     1,     2,     1,     3,     2,     7,     4,
+       4,     0,     3,     2,     2,     0,     1,     1,     1,     1,
+       6,     2,     3,     1,     3,     1,     1,     1,     3,     2,
+       3,     4,     3,     2,     2,     3,     3,     2,     3,     4,
+       3,     2,     7,    10,    10,    12,     2,     0,     2,     3,
+       2,     3,     3,     2,     2,     2,     2,     3,     2,     5,
+       4,     3,     3,     3,     5,     5,     1,     1,     0,     1,
+       0,     1,     1,     3,     6,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, yyscanner, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, yyscanner); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, core_yyscan_t yyscanner)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (yyscanner);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, core_yyscan_t yyscanner)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, yyscanner);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, core_yyscan_t yyscanner)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), yyscanner);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, yyscanner); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, core_yyscan_t yyscanner)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (yyscanner);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (core_yyscan_t yyscanner)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, yyscanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* stmtblock: stmtmulti  */
+#line 437 "ora_gram.y"
+                {
+			ora_yyget_extra(yyscanner)->parsetree = (yyvsp[0].list);
+			if(ora_yyget_extra(yyscanner)->has_no_alias_subquery)
+				add_alias_if_need((yyvsp[0].list));
+		}
+#line 8971 "ora_gram.c"
+    break;
+
+  case 3: /* stmtmulti: stmtmulti ';' stmt  */
+#line 445 "ora_gram.y"
+                {
+#ifdef ADB
+			BaseStmt *base;
+			if ((yyvsp[-2].list) != NIL)
+			{
+				base = (BaseStmt *)llast((yyvsp[-2].list));
+				base->endpos = (yylsp[-1]);
+			}
+#endif
+			if((yyvsp[0].node))
+				(yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node));
+			else
+				(yyval.list) = (yyvsp[-2].list);
+		}
+#line 8990 "ora_gram.c"
+    break;
+
+  case 4: /* stmtmulti: stmt  */
+#line 460 "ora_gram.y"
+                {
+			if((yyvsp[0].node))
+				(yyval.list) = list_make1((yyvsp[0].node));
+			else
+				(yyval.list) = NIL;
+		}
+#line 9001 "ora_gram.c"
+    break;
+
+  case 25: /* stmt: %empty  */
+#line 489 "ora_gram.y"
+                        { (yyval.node) = NULL; }
+#line 9007 "ora_gram.c"
+    break;
+
+  case 26: /* CreateAsStmt: CREATE OptTemp TABLE create_as_target AS SelectStmt opt_with_data  */
+#line 504 "ora_gram.y"
+                                {
+					CreateTableAsStmt *ctas = makeNode(CreateTableAsStmt);
+#ifdef ADB
+					ctas->grammar = PARSE_GRAM_POSTGRES;
+#endif /* ADB */
+					ctas->query = (yyvsp[-1].node);
+					ctas->into = (yyvsp[-3].into);
+					ctas->relkind = OBJECT_TABLE;
+					ctas->is_select_into = false;
+					/* cram additional flags into the IntoClause */
+					(yyvsp[-3].into)->rel->relpersistence = (yyvsp[-5].ival);
+					(yyvsp[-3].into)->skipData = !((yyvsp[0].boolean));
+					(yyval.node) = (Node *) ctas;
+				}
+#line 9026 "ora_gram.c"
+    break;
+
+  case 27: /* create_as_target: qualified_name opt_column_list OptWith OnCommitOption OptTableSpace OptDistributeBy OptSubCluster  */
+#line 525 "ora_gram.y"
+                                {
+					(yyval.into) = makeNode(IntoClause);
+					(yyval.into)->rel = (yyvsp[-6].range);
+					(yyval.into)->colNames = (yyvsp[-5].list);
+					(yyval.into)->options = (yyvsp[-4].list);
+					(yyval.into)->onCommit = (yyvsp[-3].oncommit);
+					(yyval.into)->tableSpaceName = (yyvsp[-2].str);
+					(yyval.into)->viewQuery = NULL;
+					(yyval.into)->skipData = false;		/* might get changed later */
+/* PGXC_BEGIN */
+					(yyval.into)->distributeby = (yyvsp[-1].distby);
+					(yyval.into)->subcluster = (yyvsp[0].subclus);
+/* PGXC_END */
+				}
+#line 9045 "ora_gram.c"
+    break;
+
+  case 28: /* opt_with_data: %empty  */
+#line 542 "ora_gram.y"
+                                                                                                { (yyval.boolean) = TRUE; }
+#line 9051 "ora_gram.c"
+    break;
+
+  case 29: /* CreateRoleStmt: CREATE ROLE RoleId opt_with OptRoleList  */
+#line 553 "ora_gram.y"
+                                {
+					CreateRoleStmt *n = makeNode(CreateRoleStmt);
+					n->stmt_type = ROLESTMT_ROLE;
+					n->role = (yyvsp[-2].str);
+					n->options = (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 9063 "ora_gram.c"
+    break;
+
+  case 30: /* OptRoleList: OptRoleList CreateOptRoleElem  */
+#line 563 "ora_gram.y"
+                                                                        { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].defelt)); }
+#line 9069 "ora_gram.c"
+    break;
+
+  case 31: /* OptRoleList: %empty  */
+#line 564 "ora_gram.y"
+                                                                                        { (yyval.list) = NIL; }
+#line 9075 "ora_gram.c"
+    break;
+
+  case 32: /* CreateOptRoleElem: AlterOptRoleElem  */
+#line 568 "ora_gram.y"
+                                                                { (yyval.defelt) = (yyvsp[0].defelt); }
+#line 9081 "ora_gram.c"
+    break;
+
+  case 33: /* CreateOptRoleElem: SYSID Iconst  */
+#line 571 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("sysid", (Node *)makeInteger((yyvsp[0].ival)));
+				}
+#line 9089 "ora_gram.c"
+    break;
+
+  case 34: /* CreateOptRoleElem: ADMIN role_list  */
+#line 575 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("adminmembers", (Node *)(yyvsp[0].list));
+				}
+#line 9097 "ora_gram.c"
+    break;
+
+  case 35: /* CreateOptRoleElem: ROLE role_list  */
+#line 579 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("rolemembers", (Node *)(yyvsp[0].list));
+				}
+#line 9105 "ora_gram.c"
+    break;
+
+  case 36: /* CreateOptRoleElem: IN_P ROLE role_list  */
+#line 583 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("addroleto", (Node *)(yyvsp[0].list));
+				}
+#line 9113 "ora_gram.c"
+    break;
+
+  case 37: /* CreateOptRoleElem: IN_P GROUP_P role_list  */
+#line 587 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("addroleto", (Node *)(yyvsp[0].list));
+				}
+#line 9121 "ora_gram.c"
+    break;
+
+  case 38: /* role_list: RoleId  */
+#line 593 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 9127 "ora_gram.c"
+    break;
+
+  case 39: /* role_list: role_list ',' RoleId  */
+#line 595 "ora_gram.y"
+                                        { (yyval.list) = lappend((yyvsp[-2].list), makeString((yyvsp[0].str))); }
+#line 9133 "ora_gram.c"
+    break;
+
+  case 40: /* AlterOptRoleElem: PASSWORD Sconst  */
+#line 600 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("password",
+									 (Node *)makeString((yyvsp[0].str)));
+				}
+#line 9142 "ora_gram.c"
+    break;
+
+  case 41: /* AlterOptRoleElem: PASSWORD NULL_P  */
+#line 605 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("password", NULL);
+				}
+#line 9150 "ora_gram.c"
+    break;
+
+  case 42: /* AlterOptRoleElem: ENCRYPTED PASSWORD Sconst  */
+#line 609 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("encryptedPassword",
+									 (Node *)makeString((yyvsp[0].str)));
+				}
+#line 9159 "ora_gram.c"
+    break;
+
+  case 43: /* AlterOptRoleElem: UNENCRYPTED PASSWORD Sconst  */
+#line 614 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("unencryptedPassword",
+									 (Node *)makeString((yyvsp[0].str)));
+				}
+#line 9168 "ora_gram.c"
+    break;
+
+  case 44: /* AlterOptRoleElem: INHERIT  */
+#line 619 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("inherit", (Node *)makeInteger(TRUE));
+				}
+#line 9176 "ora_gram.c"
+    break;
+
+  case 45: /* AlterOptRoleElem: CONNECTION LIMIT SignedIconst  */
+#line 623 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("connectionlimit", (Node *)makeInteger((yyvsp[0].ival)));
+				}
+#line 9184 "ora_gram.c"
+    break;
+
+  case 46: /* AlterOptRoleElem: VALID UNTIL Sconst  */
+#line 627 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("validUntil", (Node *)makeString((yyvsp[0].str)));
+				}
+#line 9192 "ora_gram.c"
+    break;
+
+  case 47: /* AlterOptRoleElem: USER role_list  */
+#line 632 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("rolemembers", (Node *)(yyvsp[0].list));
+				}
+#line 9200 "ora_gram.c"
+    break;
+
+  case 48: /* AlterOptRoleElem: IDENT  */
+#line 636 "ora_gram.y"
+                                {
+					/*
+					 * We handle identifiers that aren't parser keywords with
+					 * the following special-case codes, to avoid bloating the
+					 * size of the main parser.
+					 */
+					if (strcmp((yyvsp[0].str), "superuser") == 0)
+						(yyval.defelt) = makeDefElem("superuser", (Node *)makeInteger(TRUE));
+					else if (strcmp((yyvsp[0].str), "nosuperuser") == 0)
+						(yyval.defelt) = makeDefElem("superuser", (Node *)makeInteger(FALSE));
+					else if (strcmp((yyvsp[0].str), "createuser") == 0)
+					{
+						/* For backwards compatibility, synonym for SUPERUSER */
+						(yyval.defelt) = makeDefElem("superuser", (Node *)makeInteger(TRUE));
+					}
+					else if (strcmp((yyvsp[0].str), "nocreateuser") == 0)
+					{
+						/* For backwards compatibility, synonym for SUPERUSER */
+						(yyval.defelt) = makeDefElem("superuser", (Node *)makeInteger(FALSE));
+					}
+					else if (strcmp((yyvsp[0].str), "createrole") == 0)
+						(yyval.defelt) = makeDefElem("createrole", (Node *)makeInteger(TRUE));
+					else if (strcmp((yyvsp[0].str), "nocreaterole") == 0)
+						(yyval.defelt) = makeDefElem("createrole", (Node *)makeInteger(FALSE));
+					else if (strcmp((yyvsp[0].str), "replication") == 0)
+						(yyval.defelt) = makeDefElem("isreplication", (Node *)makeInteger(TRUE));
+					else if (strcmp((yyvsp[0].str), "noreplication") == 0)
+						(yyval.defelt) = makeDefElem("isreplication", (Node *)makeInteger(FALSE));
+					else if (strcmp((yyvsp[0].str), "createdb") == 0)
+						(yyval.defelt) = makeDefElem("createdb", (Node *)makeInteger(TRUE));
+					else if (strcmp((yyvsp[0].str), "nocreatedb") == 0)
+						(yyval.defelt) = makeDefElem("createdb", (Node *)makeInteger(FALSE));
+					else if (strcmp((yyvsp[0].str), "login") == 0)
+						(yyval.defelt) = makeDefElem("canlogin", (Node *)makeInteger(TRUE));
+					else if (strcmp((yyvsp[0].str), "nologin") == 0)
+						(yyval.defelt) = makeDefElem("canlogin", (Node *)makeInteger(FALSE));
+					else if (strcmp((yyvsp[0].str), "noinherit") == 0)
+					{
+						/*
+						 * Note that INHERIT is a keyword, so it's handled by main parser, but
+						 * NOINHERIT is handled here.
+						 */
+						(yyval.defelt) = makeDefElem("inherit", (Node *)makeInteger(FALSE));
+					}
+					else
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("unrecognized role option \"%s\"", (yyvsp[0].str)),
+									 parser_errposition((yylsp[0]))));
+				}
+#line 9255 "ora_gram.c"
+    break;
+
+  case 49: /* AlterObjectSchemaStmt: ALTER VIEW qualified_name SET SCHEMA name  */
+#line 696 "ora_gram.y"
+                                {
+					AlterObjectSchemaStmt *n = makeNode(AlterObjectSchemaStmt);
+					n->objectType = OBJECT_VIEW;
+					n->relation = (yyvsp[-3].range);
+					n->newschema = (yyvsp[0].str);
+					n->missing_ok = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 9268 "ora_gram.c"
+    break;
+
+  case 50: /* AlterObjectSchemaStmt: ALTER VIEW IF_P EXISTS qualified_name SET SCHEMA name  */
+#line 705 "ora_gram.y"
+                                {
+					AlterObjectSchemaStmt *n = makeNode(AlterObjectSchemaStmt);
+					n->objectType = OBJECT_VIEW;
+					n->relation = (yyvsp[-3].range);
+					n->newschema = (yyvsp[0].str);
+					n->missing_ok = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 9281 "ora_gram.c"
+    break;
+
+  case 51: /* RenameStmt: ALTER INDEX qualified_name RENAME TO name  */
+#line 722 "ora_gram.y"
+                                {
+					RenameStmt *n = makeNode(RenameStmt);
+					n->renameType = OBJECT_INDEX;
+					n->relation = (yyvsp[-3].range);
+					n->subname = NULL;
+					n->newname = (yyvsp[0].str);
+					n->missing_ok = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 9295 "ora_gram.c"
+    break;
+
+  case 52: /* RenameStmt: ALTER INDEX IF_P EXISTS qualified_name RENAME TO name  */
+#line 732 "ora_gram.y"
+                                {
+					RenameStmt *n = makeNode(RenameStmt);
+					n->renameType = OBJECT_INDEX;
+					n->relation = (yyvsp[-3].range);
+					n->subname = NULL;
+					n->newname = (yyvsp[0].str);
+					n->missing_ok = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 9309 "ora_gram.c"
+    break;
+
+  case 53: /* RenameStmt: ALTER VIEW qualified_name RENAME TO name  */
+#line 742 "ora_gram.y"
+                                {
+					RenameStmt *n = makeNode(RenameStmt);
+					n->renameType = OBJECT_VIEW;
+					n->relation = (yyvsp[-3].range);
+					n->subname = NULL;
+					n->newname = (yyvsp[0].str);
+					n->missing_ok = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 9323 "ora_gram.c"
+    break;
+
+  case 54: /* RenameStmt: ALTER VIEW IF_P EXISTS qualified_name RENAME TO name  */
+#line 752 "ora_gram.y"
+                                {
+					RenameStmt *n = makeNode(RenameStmt);
+					n->renameType = OBJECT_VIEW;
+					n->relation = (yyvsp[-3].range);
+					n->subname = NULL;
+					n->newname = (yyvsp[0].str);
+					n->missing_ok = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 9337 "ora_gram.c"
+    break;
+
+  case 55: /* RenameStmt: ALTER TABLE relation_expr RENAME TO name  */
+#line 762 "ora_gram.y"
+                                {
+					RenameStmt *n = makeNode(RenameStmt);
+					n->renameType = OBJECT_TABLE;
+					n->relation = (yyvsp[-3].range);
+					n->subname = NULL;
+					n->newname = (yyvsp[0].str);
+					n->missing_ok = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 9351 "ora_gram.c"
+    break;
+
+  case 56: /* RenameStmt: ALTER TABLE IF_P EXISTS relation_expr RENAME TO name  */
+#line 772 "ora_gram.y"
+                                {
+					RenameStmt *n = makeNode(RenameStmt);
+					n->renameType = OBJECT_TABLE;
+					n->relation = (yyvsp[-3].range);
+					n->subname = NULL;
+					n->newname = (yyvsp[0].str);
+					n->missing_ok = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 9365 "ora_gram.c"
+    break;
+
+  case 57: /* RenameStmt: ALTER TABLE relation_expr RENAME opt_column name TO name  */
+#line 782 "ora_gram.y"
+                                {
+					RenameStmt *n = makeNode(RenameStmt);
+					n->renameType = OBJECT_COLUMN;
+					n->relationType = OBJECT_TABLE;
+					n->relation = (yyvsp[-5].range);
+					n->subname = (yyvsp[-2].str);
+					n->newname = (yyvsp[0].str);
+					n->missing_ok = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 9380 "ora_gram.c"
+    break;
+
+  case 58: /* RenameStmt: ALTER TABLE IF_P EXISTS relation_expr RENAME opt_column name TO name  */
+#line 793 "ora_gram.y"
+                                {
+					RenameStmt *n = makeNode(RenameStmt);
+					n->renameType = OBJECT_COLUMN;
+					n->relationType = OBJECT_TABLE;
+					n->relation = (yyvsp[-5].range);
+					n->subname = (yyvsp[-2].str);
+					n->newname = (yyvsp[0].str);
+					n->missing_ok = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 9395 "ora_gram.c"
+    break;
+
+  case 59: /* AlterTableStmt: ALTER INDEX qualified_name alter_table_cmds  */
+#line 815 "ora_gram.y"
+                                {
+					AlterTableStmt *n = makeNode(AlterTableStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->relation = (yyvsp[-1].range);
+					n->cmds = (yyvsp[0].list);
+					n->relkind = OBJECT_INDEX;
+					n->missing_ok = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 9409 "ora_gram.c"
+    break;
+
+  case 60: /* AlterTableStmt: ALTER INDEX IF_P EXISTS qualified_name alter_table_cmds  */
+#line 825 "ora_gram.y"
+                                {
+					AlterTableStmt *n = makeNode(AlterTableStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->relation = (yyvsp[-1].range);
+					n->cmds = (yyvsp[0].list);
+					n->relkind = OBJECT_INDEX;
+					n->missing_ok = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 9423 "ora_gram.c"
+    break;
+
+  case 61: /* AlterTableStmt: ALTER VIEW qualified_name alter_table_cmds  */
+#line 835 "ora_gram.y"
+                                {
+					AlterTableStmt *n = makeNode(AlterTableStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->relation = (yyvsp[-1].range);
+					n->cmds = (yyvsp[0].list);
+					n->relkind = OBJECT_VIEW;
+					n->missing_ok = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 9437 "ora_gram.c"
+    break;
+
+  case 62: /* AlterTableStmt: ALTER VIEW IF_P EXISTS qualified_name alter_table_cmds  */
+#line 845 "ora_gram.y"
+                                {
+					AlterTableStmt *n = makeNode(AlterTableStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->relation = (yyvsp[-1].range);
+					n->cmds = (yyvsp[0].list);
+					n->relkind = OBJECT_VIEW;
+					n->missing_ok = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 9451 "ora_gram.c"
+    break;
+
+  case 63: /* AlterTableStmt: ALTER TABLE relation_expr alter_table_cmds  */
+#line 855 "ora_gram.y"
+                                {
+					AlterTableStmt *n = makeNode(AlterTableStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->relation = (yyvsp[-1].range);
+					n->cmds = (yyvsp[0].list);
+					n->relkind = OBJECT_TABLE;
+					n->missing_ok = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 9465 "ora_gram.c"
+    break;
+
+  case 64: /* AlterTableStmt: ALTER TABLE IF_P EXISTS relation_expr alter_table_cmds  */
+#line 865 "ora_gram.y"
+                                {
+					AlterTableStmt *n = makeNode(AlterTableStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->relation = (yyvsp[-1].range);
+					n->cmds = (yyvsp[0].list);
+					n->relkind = OBJECT_TABLE;
+					n->missing_ok = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 9479 "ora_gram.c"
+    break;
+
+  case 65: /* alter_table_cmds: alter_table_cmd  */
+#line 877 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 9485 "ora_gram.c"
+    break;
+
+  case 66: /* alter_table_cmds: alter_table_cmds ',' alter_table_cmd  */
+#line 878 "ora_gram.y"
+                                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 9491 "ora_gram.c"
+    break;
+
+  case 67: /* alter_table_cmd: ADD_P '(' columnDef ')'  */
+#line 884 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_AddColumn;
+					n->def = (yyvsp[-1].node);
+					(yyval.node) = (Node *)n;
+				}
+#line 9502 "ora_gram.c"
+    break;
+
+  case 68: /* alter_table_cmd: ADD_P COLUMN columnDef  */
+#line 892 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_AddColumn;
+					n->def = (yyvsp[0].node);
+					(yyval.node) = (Node *)n;
+				}
+#line 9513 "ora_gram.c"
+    break;
+
+  case 69: /* alter_table_cmd: ALTER opt_column ColId alter_column_default  */
+#line 900 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_ColumnDefault;
+					n->name = (yyvsp[-1].str);
+					n->def = (yyvsp[0].node);
+					(yyval.node) = (Node *)n;
+				}
+#line 9525 "ora_gram.c"
+    break;
+
+  case 70: /* alter_table_cmd: ALTER opt_column ColId DROP NOT NULL_P  */
+#line 909 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropNotNull;
+					n->name = (yyvsp[-3].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9536 "ora_gram.c"
+    break;
+
+  case 71: /* alter_table_cmd: ALTER opt_column ColId SET NOT NULL_P  */
+#line 917 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_SetNotNull;
+					n->name = (yyvsp[-3].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9547 "ora_gram.c"
+    break;
+
+  case 72: /* alter_table_cmd: ALTER opt_column ColId SET STATISTICS SignedIconst  */
+#line 925 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_SetStatistics;
+					n->name = (yyvsp[-3].str);
+					n->def = (Node *) makeInteger((yyvsp[0].ival));
+					(yyval.node) = (Node *)n;
+				}
+#line 9559 "ora_gram.c"
+    break;
+
+  case 73: /* alter_table_cmd: ALTER opt_column ColId SET reloptions  */
+#line 934 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_SetOptions;
+					n->name = (yyvsp[-2].str);
+					n->def = (Node *) (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 9571 "ora_gram.c"
+    break;
+
+  case 74: /* alter_table_cmd: ALTER opt_column ColId RESET reloptions  */
+#line 943 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_ResetOptions;
+					n->name = (yyvsp[-2].str);
+					n->def = (Node *) (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 9583 "ora_gram.c"
+    break;
+
+  case 75: /* alter_table_cmd: ALTER opt_column ColId SET STORAGE ColId  */
+#line 952 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_SetStorage;
+					n->name = (yyvsp[-3].str);
+					n->def = (Node *) makeString((yyvsp[0].str));
+					(yyval.node) = (Node *)n;
+				}
+#line 9595 "ora_gram.c"
+    break;
+
+  case 76: /* alter_table_cmd: DROP opt_column IF_P EXISTS ColId opt_drop_behavior  */
+#line 961 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropColumn;
+					n->name = (yyvsp[-1].str);
+					n->behavior = (yyvsp[0].dbehavior);
+					n->missing_ok = TRUE;
+					(yyval.node) = (Node *)n;
+				}
+#line 9608 "ora_gram.c"
+    break;
+
+  case 77: /* alter_table_cmd: DROP opt_column ColId opt_drop_behavior  */
+#line 971 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropColumn;
+					n->name = (yyvsp[-1].str);
+					n->behavior = (yyvsp[0].dbehavior);
+					n->missing_ok = FALSE;
+					(yyval.node) = (Node *)n;
+				}
+#line 9621 "ora_gram.c"
+    break;
+
+  case 78: /* alter_table_cmd: ALTER opt_column ColId opt_set_data TYPE_P Typename opt_collate_clause alter_using  */
+#line 984 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					ColumnDef *def = makeNode(ColumnDef);
+					n->subtype = AT_AlterColumnType;
+					n->name = (yyvsp[-5].str);
+					n->def = (Node *) def;
+					/* We only use these three fields of the ColumnDef node */
+					def->typeName = (yyvsp[-2].typnam);
+					def->collClause = (CollateClause *) (yyvsp[-1].node);
+					def->raw_default = (yyvsp[0].node);
+					(yyval.node) = (Node *)n;
+				}
+#line 9638 "ora_gram.c"
+    break;
+
+  case 79: /* alter_table_cmd: MODIFY opt_column ColId Typename opt_collate_clause alter_using  */
+#line 997 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					ColumnDef *def = makeNode(ColumnDef);
+					n->subtype = AT_AlterColumnType;
+					n->name = (yyvsp[-3].str);
+					n->def = (Node *) def;
+					/* We only use these three fields of the ColumnDef node */
+					def->typeName = (yyvsp[-2].typnam);
+					def->collClause = (CollateClause *) (yyvsp[-1].node);
+					def->raw_default = (yyvsp[0].node);
+					(yyval.node) = (Node *)n;
+				}
+#line 9655 "ora_gram.c"
+    break;
+
+  case 80: /* alter_table_cmd: ALTER opt_column ColId alter_generic_options  */
+#line 1011 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_AlterColumnGenericOptions;
+					n->name = (yyvsp[-1].str);
+					n->def = (Node *) (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 9667 "ora_gram.c"
+    break;
+
+  case 81: /* alter_table_cmd: ADD_P TableConstraint  */
+#line 1020 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_AddConstraint;
+					n->def = (yyvsp[0].node);
+					(yyval.node) = (Node *)n;
+				}
+#line 9678 "ora_gram.c"
+    break;
+
+  case 82: /* alter_table_cmd: VALIDATE CONSTRAINT name  */
+#line 1028 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_ValidateConstraint;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9689 "ora_gram.c"
+    break;
+
+  case 83: /* alter_table_cmd: DROP CONSTRAINT IF_P EXISTS name opt_drop_behavior  */
+#line 1036 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropConstraint;
+					n->name = (yyvsp[-1].str);
+					n->behavior = (yyvsp[0].dbehavior);
+					n->missing_ok = TRUE;
+					(yyval.node) = (Node *)n;
+				}
+#line 9702 "ora_gram.c"
+    break;
+
+  case 84: /* alter_table_cmd: DROP CONSTRAINT name opt_drop_behavior  */
+#line 1046 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropConstraint;
+					n->name = (yyvsp[-1].str);
+					n->behavior = (yyvsp[0].dbehavior);
+					n->missing_ok = FALSE;
+					(yyval.node) = (Node *)n;
+				}
+#line 9715 "ora_gram.c"
+    break;
+
+  case 85: /* alter_table_cmd: SET WITH OIDS  */
+#line 1056 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_AddOids;
+					(yyval.node) = (Node *)n;
+				}
+#line 9725 "ora_gram.c"
+    break;
+
+  case 86: /* alter_table_cmd: SET WITHOUT OIDS  */
+#line 1063 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropOids;
+					(yyval.node) = (Node *)n;
+				}
+#line 9735 "ora_gram.c"
+    break;
+
+  case 87: /* alter_table_cmd: CLUSTER ON name  */
+#line 1070 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_ClusterOn;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9746 "ora_gram.c"
+    break;
+
+  case 88: /* alter_table_cmd: SET WITHOUT CLUSTER  */
+#line 1078 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropCluster;
+					n->name = NULL;
+					(yyval.node) = (Node *)n;
+				}
+#line 9757 "ora_gram.c"
+    break;
+
+  case 89: /* alter_table_cmd: ENABLE_P TRIGGER name  */
+#line 1086 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_EnableTrig;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9768 "ora_gram.c"
+    break;
+
+  case 90: /* alter_table_cmd: ENABLE_P ALWAYS TRIGGER name  */
+#line 1094 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_EnableAlwaysTrig;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9779 "ora_gram.c"
+    break;
+
+  case 91: /* alter_table_cmd: ENABLE_P REPLICA TRIGGER name  */
+#line 1102 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_EnableReplicaTrig;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9790 "ora_gram.c"
+    break;
+
+  case 92: /* alter_table_cmd: ENABLE_P TRIGGER ALL  */
+#line 1110 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_EnableTrigAll;
+					(yyval.node) = (Node *)n;
+				}
+#line 9800 "ora_gram.c"
+    break;
+
+  case 93: /* alter_table_cmd: ENABLE_P TRIGGER USER  */
+#line 1117 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_EnableTrigUser;
+					(yyval.node) = (Node *)n;
+				}
+#line 9810 "ora_gram.c"
+    break;
+
+  case 94: /* alter_table_cmd: DISABLE_P TRIGGER name  */
+#line 1124 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DisableTrig;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9821 "ora_gram.c"
+    break;
+
+  case 95: /* alter_table_cmd: DISABLE_P TRIGGER ALL  */
+#line 1132 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DisableTrigAll;
+					(yyval.node) = (Node *)n;
+				}
+#line 9831 "ora_gram.c"
+    break;
+
+  case 96: /* alter_table_cmd: DISABLE_P TRIGGER USER  */
+#line 1139 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DisableTrigUser;
+					(yyval.node) = (Node *)n;
+				}
+#line 9841 "ora_gram.c"
+    break;
+
+  case 97: /* alter_table_cmd: ENABLE_P RULE name  */
+#line 1146 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_EnableRule;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9852 "ora_gram.c"
+    break;
+
+  case 98: /* alter_table_cmd: ENABLE_P ALWAYS RULE name  */
+#line 1154 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_EnableAlwaysRule;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9863 "ora_gram.c"
+    break;
+
+  case 99: /* alter_table_cmd: ENABLE_P REPLICA RULE name  */
+#line 1162 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_EnableReplicaRule;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9874 "ora_gram.c"
+    break;
+
+  case 100: /* alter_table_cmd: DISABLE_P RULE name  */
+#line 1170 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DisableRule;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9885 "ora_gram.c"
+    break;
+
+  case 101: /* alter_table_cmd: INHERIT qualified_name  */
+#line 1178 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_AddInherit;
+					n->def = (Node *) (yyvsp[0].range);
+					(yyval.node) = (Node *)n;
+				}
+#line 9896 "ora_gram.c"
+    break;
+
+  case 102: /* alter_table_cmd: NO INHERIT qualified_name  */
+#line 1186 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropInherit;
+					n->def = (Node *) (yyvsp[0].range);
+					(yyval.node) = (Node *)n;
+				}
+#line 9907 "ora_gram.c"
+    break;
+
+  case 103: /* alter_table_cmd: OF any_name  */
+#line 1194 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					TypeName *def = makeTypeNameFromNameList((yyvsp[0].list));
+					def->location = (yylsp[0]);
+					n->subtype = AT_AddOf;
+					n->def = (Node *) def;
+					(yyval.node) = (Node *)n;
+				}
+#line 9920 "ora_gram.c"
+    break;
+
+  case 104: /* alter_table_cmd: NOT OF  */
+#line 1204 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DropOf;
+					(yyval.node) = (Node *)n;
+				}
+#line 9930 "ora_gram.c"
+    break;
+
+  case 105: /* alter_table_cmd: OWNER TO RoleId  */
+#line 1211 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_ChangeOwner;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9941 "ora_gram.c"
+    break;
+
+  case 106: /* alter_table_cmd: SET TABLESPACE name  */
+#line 1219 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_SetTableSpace;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 9952 "ora_gram.c"
+    break;
+
+  case 107: /* alter_table_cmd: SET reloptions  */
+#line 1227 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_SetRelOptions;
+					n->def = (Node *)(yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 9963 "ora_gram.c"
+    break;
+
+  case 108: /* alter_table_cmd: RESET reloptions  */
+#line 1235 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_ResetRelOptions;
+					n->def = (Node *)(yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 9974 "ora_gram.c"
+    break;
+
+  case 109: /* alter_table_cmd: alter_generic_options  */
+#line 1242 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_GenericOptions;
+					n->def = (Node *)(yyvsp[0].list);
+					(yyval.node) = (Node *) n;
+				}
+#line 9985 "ora_gram.c"
+    break;
+
+  case 110: /* alter_table_cmd: OptDistributeByInternal  */
+#line 1251 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DistributeBy;
+					n->def = (Node *)(yyvsp[0].distby);
+					(yyval.node) = (Node *)n;
+				}
+#line 9996 "ora_gram.c"
+    break;
+
+  case 111: /* alter_table_cmd: OptSubClusterInternal  */
+#line 1259 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_SubCluster;
+					n->def = (Node *)(yyvsp[0].subclus);
+					(yyval.node) = (Node *)n;
+				}
+#line 10007 "ora_gram.c"
+    break;
+
+  case 112: /* alter_table_cmd: ADD_P NODE pgxcnodes  */
+#line 1267 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_AddNodeList;
+					n->def = (Node *)(yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 10018 "ora_gram.c"
+    break;
+
+  case 113: /* alter_table_cmd: DELETE_P NODE pgxcnodes  */
+#line 1275 "ora_gram.y"
+                                {
+					AlterTableCmd *n = makeNode(AlterTableCmd);
+					n->subtype = AT_DeleteNodeList;
+					n->def = (Node *)(yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 10029 "ora_gram.c"
+    break;
+
+  case 114: /* opt_set_data: SET DATA_P  */
+#line 1284 "ora_gram.y"
+                                                                                { (yyval.ival) = 1; }
+#line 10035 "ora_gram.c"
+    break;
+
+  case 115: /* opt_set_data: %empty  */
+#line 1285 "ora_gram.y"
+                                                                                                { (yyval.ival) = 0; }
+#line 10041 "ora_gram.c"
+    break;
+
+  case 116: /* alter_using: USING a_expr  */
+#line 1289 "ora_gram.y"
+                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 10047 "ora_gram.c"
+    break;
+
+  case 117: /* alter_using: %empty  */
+#line 1290 "ora_gram.y"
+                                                                { (yyval.node) = NULL; }
+#line 10053 "ora_gram.c"
+    break;
+
+  case 118: /* alter_generic_options: OPTIONS '(' alter_generic_option_list ')'  */
+#line 1295 "ora_gram.y"
+                                                                                { (yyval.list) = (yyvsp[-1].list); }
+#line 10059 "ora_gram.c"
+    break;
+
+  case 119: /* alter_generic_option_list: alter_generic_option_elem  */
+#line 1300 "ora_gram.y"
+                                {
+					(yyval.list) = list_make1((yyvsp[0].defelt));
+				}
+#line 10067 "ora_gram.c"
+    break;
+
+  case 120: /* alter_generic_option_list: alter_generic_option_list ',' alter_generic_option_elem  */
+#line 1304 "ora_gram.y"
+                                {
+					(yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].defelt));
+				}
+#line 10075 "ora_gram.c"
+    break;
+
+  case 121: /* alter_generic_option_elem: generic_option_elem  */
+#line 1311 "ora_gram.y"
+                                {
+					(yyval.defelt) = (yyvsp[0].defelt);
+				}
+#line 10083 "ora_gram.c"
+    break;
+
+  case 122: /* alter_generic_option_elem: SET generic_option_elem  */
+#line 1315 "ora_gram.y"
+                                {
+					(yyval.defelt) = (yyvsp[0].defelt);
+					(yyval.defelt)->defaction = DEFELEM_SET;
+				}
+#line 10092 "ora_gram.c"
+    break;
+
+  case 123: /* alter_generic_option_elem: ADD_P generic_option_elem  */
+#line 1320 "ora_gram.y"
+                                {
+					(yyval.defelt) = (yyvsp[0].defelt);
+					(yyval.defelt)->defaction = DEFELEM_ADD;
+				}
+#line 10101 "ora_gram.c"
+    break;
+
+  case 124: /* alter_generic_option_elem: DROP generic_option_name  */
+#line 1325 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElemExtended(NULL, (yyvsp[0].str), NULL, DEFELEM_DROP);
+				}
+#line 10109 "ora_gram.c"
+    break;
+
+  case 125: /* generic_option_elem: generic_option_name generic_option_arg  */
+#line 1332 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem((yyvsp[-1].str), (yyvsp[0].node));
+				}
+#line 10117 "ora_gram.c"
+    break;
+
+  case 126: /* generic_option_name: ColLabel  */
+#line 1338 "ora_gram.y"
+                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 10123 "ora_gram.c"
+    break;
+
+  case 127: /* generic_option_arg: Sconst  */
+#line 1343 "ora_gram.y"
+                                                                { (yyval.node) = (Node *) makeString((yyvsp[0].str)); }
+#line 10129 "ora_gram.c"
+    break;
+
+  case 128: /* opt_collate_clause: COLLATE any_name  */
+#line 1348 "ora_gram.y"
+                                {
+					CollateClause *n = makeNode(CollateClause);
+					n->arg = NULL;
+					n->collname = (yyvsp[0].list);
+					n->location = (yylsp[-1]);
+					(yyval.node) = (Node *) n;
+				}
+#line 10141 "ora_gram.c"
+    break;
+
+  case 129: /* opt_collate_clause: %empty  */
+#line 1355 "ora_gram.y"
+                                                                { (yyval.node) = NULL; }
+#line 10147 "ora_gram.c"
+    break;
+
+  case 130: /* OptDistributeType: IDENT  */
+#line 1363 "ora_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 10153 "ora_gram.c"
+    break;
+
+  case 131: /* OptDistributeByInternal: DISTRIBUTE BY OptDistributeType  */
+#line 1367 "ora_gram.y"
+                                {
+					DistributeBy *n = makeNode(DistributeBy);
+					if (strcmp((yyvsp[0].str), "replication") == 0)
+						n->disttype = DISTTYPE_REPLICATION;
+					else if (strcmp((yyvsp[0].str), "roundrobin") == 0)
+						n->disttype = DISTTYPE_ROUNDROBIN;
+                    else
+                        ereport(ERROR,
+                                (errcode(ERRCODE_SYNTAX_ERROR),
+                                 errmsg("unrecognized distribution option \"%s\"", (yyvsp[0].str))));
+					n->colname = NULL;
+					(yyval.distby) = n;
+				}
+#line 10171 "ora_gram.c"
+    break;
+
+  case 132: /* OptDistributeByInternal: DISTRIBUTE BY func_name '(' func_arg_list ')'  */
+#line 1381 "ora_gram.y"
+                                {
+					DistributeBy *n = makeNode(DistributeBy);
+					n->disttype = DISTTYPE_USER_DEFINED;
+					n->funcname = (yyvsp[-3].list);
+					n->funcargs = (yyvsp[-1].list);
+					transformDistributeBy(n);
+					(yyval.distby) = n;
+				}
+#line 10184 "ora_gram.c"
+    break;
+
+  case 133: /* OptSubCluster: OptSubClusterInternal  */
+#line 1391 "ora_gram.y"
+                                                                { (yyval.subclus) = (yyvsp[0].subclus); }
+#line 10190 "ora_gram.c"
+    break;
+
+  case 134: /* OptSubCluster: %empty  */
+#line 1392 "ora_gram.y"
+                                                                                        { (yyval.subclus) = NULL; }
+#line 10196 "ora_gram.c"
+    break;
+
+  case 135: /* OptSubClusterInternal: TO NODE pgxcnodes  */
+#line 1397 "ora_gram.y"
+                                {
+					PGXCSubCluster *n = makeNode(PGXCSubCluster);
+					n->clustertype = SUBCLUSTER_NODE;
+					n->members = (yyvsp[0].list);
+					(yyval.subclus) = n;
+				}
+#line 10207 "ora_gram.c"
+    break;
+
+  case 136: /* OptSubClusterInternal: TO GROUP_P pgxcgroup_name  */
+#line 1404 "ora_gram.y"
+                                {
+					PGXCSubCluster *n = makeNode(PGXCSubCluster);
+					n->clustertype = SUBCLUSTER_GROUP;
+					n->members = list_make1(makeString((yyvsp[0].str)));
+					(yyval.subclus) = n;
+				}
+#line 10218 "ora_gram.c"
+    break;
+
+  case 137: /* pgxcnode_name: ColId  */
+#line 1413 "ora_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 10224 "ora_gram.c"
+    break;
+
+  case 138: /* pgxcgroup_name: ColId  */
+#line 1417 "ora_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 10230 "ora_gram.c"
+    break;
+
+  case 139: /* pgxcnodes: '(' pgxcnode_list ')'  */
+#line 1421 "ora_gram.y"
+                                                                { (yyval.list) = (yyvsp[-1].list); }
+#line 10236 "ora_gram.c"
+    break;
+
+  case 140: /* pgxcnode_list: pgxcnode_list ',' pgxcnode_name  */
+#line 1425 "ora_gram.y"
+                                                                { (yyval.list) = lappend((yyvsp[-2].list), makeString((yyvsp[0].str))); }
+#line 10242 "ora_gram.c"
+    break;
+
+  case 141: /* pgxcnode_list: pgxcnode_name  */
+#line 1426 "ora_gram.y"
+                                                                                { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 10248 "ora_gram.c"
+    break;
+
+  case 142: /* TableConstraint: CONSTRAINT name ConstraintElem  */
+#line 1435 "ora_gram.y"
+                                {
+					Constraint *n = (Constraint *) (yyvsp[0].node);
+					Assert(IsA(n, Constraint));
+					n->conname = (yyvsp[-1].str);
+					n->location = (yylsp[-2]);
+					(yyval.node) = (Node *) n;
+				}
+#line 10260 "ora_gram.c"
+    break;
+
+  case 143: /* TableConstraint: ConstraintElem  */
+#line 1442 "ora_gram.y"
+                                                                                        { (yyval.node) = (yyvsp[0].node); }
+#line 10266 "ora_gram.c"
+    break;
+
+  case 144: /* ConstraintElem: CHECK '(' a_expr ')' ConstraintAttributeSpec  */
+#line 1447 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_CHECK;
+					n->location = (yylsp[-4]);
+					n->raw_expr = (yyvsp[-2].node);
+					n->cooked_expr = NULL;
+					processCASbits((yyvsp[0].ival), (yylsp[0]), "CHECK",
+								   NULL, NULL, &n->skip_validation,
+								   &n->is_no_inherit, yyscanner);
+					n->initially_valid = !n->skip_validation;
+					(yyval.node) = (Node *)n;
+				}
+#line 10283 "ora_gram.c"
+    break;
+
+  case 145: /* ConstraintElem: UNIQUE '(' columnList ')' opt_definition OptConsTableSpace ConstraintAttributeSpec  */
+#line 1461 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_UNIQUE;
+					n->location = (yylsp[-6]);
+					n->keys = (yyvsp[-4].list);
+					n->options = (yyvsp[-2].list);
+					n->indexname = NULL;
+					n->indexspace = (yyvsp[-1].str);
+					processCASbits((yyvsp[0].ival), (yylsp[0]), "UNIQUE",
+								   &n->deferrable, &n->initdeferred, NULL,
+								   NULL, yyscanner);
+					(yyval.node) = (Node *)n;
+				}
+#line 10301 "ora_gram.c"
+    break;
+
+  case 146: /* ConstraintElem: UNIQUE ExistingIndex ConstraintAttributeSpec  */
+#line 1475 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_UNIQUE;
+					n->location = (yylsp[-2]);
+					n->keys = NIL;
+					n->options = NIL;
+					n->indexname = (yyvsp[-1].str);
+					n->indexspace = NULL;
+					processCASbits((yyvsp[0].ival), (yylsp[0]), "UNIQUE",
+								   &n->deferrable, &n->initdeferred, NULL,
+								   NULL, yyscanner);
+					(yyval.node) = (Node *)n;
+				}
+#line 10319 "ora_gram.c"
+    break;
+
+  case 147: /* ConstraintElem: PRIMARY KEY '(' columnList ')' opt_definition OptConsTableSpace ConstraintAttributeSpec  */
+#line 1490 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_PRIMARY;
+					n->location = (yylsp[-7]);
+					n->keys = (yyvsp[-4].list);
+					n->options = (yyvsp[-2].list);
+					n->indexname = NULL;
+					n->indexspace = (yyvsp[-1].str);
+					processCASbits((yyvsp[0].ival), (yylsp[0]), "PRIMARY KEY",
+								   &n->deferrable, &n->initdeferred, NULL,
+								   NULL, yyscanner);
+					(yyval.node) = (Node *)n;
+				}
+#line 10337 "ora_gram.c"
+    break;
+
+  case 148: /* ConstraintElem: PRIMARY KEY ExistingIndex ConstraintAttributeSpec  */
+#line 1504 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_PRIMARY;
+					n->location = (yylsp[-3]);
+					n->keys = NIL;
+					n->options = NIL;
+					n->indexname = (yyvsp[-1].str);
+					n->indexspace = NULL;
+					processCASbits((yyvsp[0].ival), (yylsp[0]), "PRIMARY KEY",
+								   &n->deferrable, &n->initdeferred, NULL,
+								   NULL, yyscanner);
+					(yyval.node) = (Node *)n;
+				}
+#line 10355 "ora_gram.c"
+    break;
+
+  case 149: /* ConstraintElem: EXCLUDE access_method_clause '(' ExclusionConstraintList ')' opt_definition OptConsTableSpace ExclusionWhereClause ConstraintAttributeSpec  */
+#line 1520 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_EXCLUSION;
+					n->location = (yylsp[-8]);
+					n->access_method	= (yyvsp[-7].str);
+					n->exclusions		= (yyvsp[-5].list);
+					n->options			= (yyvsp[-3].list);
+					n->indexname		= NULL;
+					n->indexspace		= (yyvsp[-2].str);
+					n->where_clause		= (yyvsp[-1].node);
+					processCASbits((yyvsp[0].ival), (yylsp[0]), "EXCLUDE",
+								   &n->deferrable, &n->initdeferred, NULL,
+								   NULL, yyscanner);
+					(yyval.node) = (Node *)n;
+				}
+#line 10375 "ora_gram.c"
+    break;
+
+  case 150: /* ConstraintElem: FOREIGN KEY '(' columnList ')' REFERENCES qualified_name opt_column_list key_match key_actions ConstraintAttributeSpec  */
+#line 1537 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_FOREIGN;
+					n->location = (yylsp[-10]);
+					n->pktable			= (yyvsp[-4].range);
+					n->fk_attrs			= (yyvsp[-7].list);
+					n->pk_attrs			= (yyvsp[-3].list);
+					n->fk_matchtype		= (yyvsp[-2].ival);
+					n->fk_upd_action	= (char) ((yyvsp[-1].ival) >> 8);
+					n->fk_del_action	= (char) ((yyvsp[-1].ival) & 0xFF);
+					processCASbits((yyvsp[0].ival), (yylsp[0]), "FOREIGN KEY",
+								   &n->deferrable, &n->initdeferred,
+								   &n->skip_validation, NULL,
+								   yyscanner);
+					n->initially_valid = !n->skip_validation;
+					(yyval.node) = (Node *)n;
+				}
+#line 10397 "ora_gram.c"
+    break;
+
+  case 151: /* ExistingIndex: USING INDEX index_name  */
+#line 1556 "ora_gram.y"
+                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 10403 "ora_gram.c"
+    break;
+
+  case 152: /* ExclusionWhereClause: WHERE '(' a_expr ')'  */
+#line 1560 "ora_gram.y"
+                                                                                { (yyval.node) = (yyvsp[-1].node); }
+#line 10409 "ora_gram.c"
+    break;
+
+  case 153: /* ExclusionWhereClause: %empty  */
+#line 1561 "ora_gram.y"
+                                                                                                { (yyval.node) = NULL; }
+#line 10415 "ora_gram.c"
+    break;
+
+  case 154: /* ExclusionConstraintList: ExclusionConstraintElem  */
+#line 1565 "ora_gram.y"
+                                                                                { (yyval.list) = list_make1((yyvsp[0].list)); }
+#line 10421 "ora_gram.c"
+    break;
+
+  case 155: /* ExclusionConstraintList: ExclusionConstraintList ',' ExclusionConstraintElem  */
+#line 1567 "ora_gram.y"
+                                                                                                        { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].list)); }
+#line 10427 "ora_gram.c"
+    break;
+
+  case 156: /* ExclusionConstraintElem: index_elem WITH any_operator  */
+#line 1571 "ora_gram.y"
+                        {
+				(yyval.list) = list_make2((yyvsp[-2].ielem), (yyvsp[0].list));
+			}
+#line 10435 "ora_gram.c"
+    break;
+
+  case 157: /* ExclusionConstraintElem: index_elem WITH OPERATOR '(' any_operator ')'  */
+#line 1576 "ora_gram.y"
+                        {
+				(yyval.list) = list_make2((yyvsp[-5].ielem), (yyvsp[-1].list));
+			}
+#line 10443 "ora_gram.c"
+    break;
+
+  case 158: /* ConstraintAttributeSpec: %empty  */
+#line 1583 "ora_gram.y"
+                                { (yyval.ival) = 0; }
+#line 10449 "ora_gram.c"
+    break;
+
+  case 159: /* ConstraintAttributeSpec: ConstraintAttributeSpec ConstraintAttributeElem  */
+#line 1585 "ora_gram.y"
+                                {
+					/*
+					 * We must complain about conflicting options.
+					 * We could, but choose not to, complain about redundant
+					 * options (ie, where $2's bit is already set in $1).
+					 */
+					int		newspec = (yyvsp[-1].ival) | (yyvsp[0].ival);
+
+					/* special message for this case */
+					if ((newspec & (CAS_NOT_DEFERRABLE | CAS_INITIALLY_DEFERRED)) == (CAS_NOT_DEFERRABLE | CAS_INITIALLY_DEFERRED))
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("constraint declared INITIALLY DEFERRED must be DEFERRABLE"),
+								 parser_errposition((yylsp[0]))));
+					/* generic message for other conflicts */
+					if ((newspec & (CAS_NOT_DEFERRABLE | CAS_DEFERRABLE)) == (CAS_NOT_DEFERRABLE | CAS_DEFERRABLE) ||
+						(newspec & (CAS_INITIALLY_IMMEDIATE | CAS_INITIALLY_DEFERRED)) == (CAS_INITIALLY_IMMEDIATE | CAS_INITIALLY_DEFERRED))
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("conflicting constraint properties"),
+								 parser_errposition((yylsp[0]))));
+					(yyval.ival) = newspec;
+				}
+#line 10477 "ora_gram.c"
+    break;
+
+  case 160: /* ConstraintAttributeElem: NOT DEFERRABLE  */
+#line 1611 "ora_gram.y"
+                                                                        { (yyval.ival) = CAS_NOT_DEFERRABLE; }
+#line 10483 "ora_gram.c"
+    break;
+
+  case 161: /* ConstraintAttributeElem: DEFERRABLE  */
+#line 1612 "ora_gram.y"
+                                                                        { (yyval.ival) = CAS_DEFERRABLE; }
+#line 10489 "ora_gram.c"
+    break;
+
+  case 162: /* ConstraintAttributeElem: INITIALLY IMMEDIATE  */
+#line 1613 "ora_gram.y"
+                                                                { (yyval.ival) = CAS_INITIALLY_IMMEDIATE; }
+#line 10495 "ora_gram.c"
+    break;
+
+  case 163: /* ConstraintAttributeElem: INITIALLY DEFERRED  */
+#line 1614 "ora_gram.y"
+                                                                { (yyval.ival) = CAS_INITIALLY_DEFERRED; }
+#line 10501 "ora_gram.c"
+    break;
+
+  case 164: /* ConstraintAttributeElem: NOT VALID  */
+#line 1615 "ora_gram.y"
+                                                                                { (yyval.ival) = CAS_NOT_VALID; }
+#line 10507 "ora_gram.c"
+    break;
+
+  case 165: /* ConstraintAttributeElem: NO INHERIT  */
+#line 1616 "ora_gram.y"
+                                                                        { (yyval.ival) = CAS_NO_INHERIT; }
+#line 10513 "ora_gram.c"
+    break;
+
+  case 166: /* RoleId: NonReservedWord  */
+#line 1619 "ora_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 10519 "ora_gram.c"
+    break;
+
+  case 167: /* opt_column: COLUMN  */
+#line 1622 "ora_gram.y"
+                                                                                        { (yyval.ival) = COLUMN; }
+#line 10525 "ora_gram.c"
+    break;
+
+  case 168: /* opt_column: %empty  */
+#line 1623 "ora_gram.y"
+                                                                                                { (yyval.ival) = 0; }
+#line 10531 "ora_gram.c"
+    break;
+
+  case 169: /* alter_column_default: SET DEFAULT a_expr  */
+#line 1627 "ora_gram.y"
+                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 10537 "ora_gram.c"
+    break;
+
+  case 170: /* alter_column_default: DROP DEFAULT  */
+#line 1628 "ora_gram.y"
+                                                                { (yyval.node) = NULL; }
+#line 10543 "ora_gram.c"
+    break;
+
+  case 171: /* CreateSeqStmt: CREATE OptTemp SEQUENCE qualified_name OptSeqOptList  */
+#line 1641 "ora_gram.y"
+                                {
+					CreateSeqStmt *n = makeNode(CreateSeqStmt);
+					(yyvsp[-1].range)->relpersistence = (yyvsp[-3].ival);
+					n->sequence = (yyvsp[-1].range);
+					n->options = (yyvsp[0].list);
+					n->ownerId = InvalidOid;
+/* PGXC_BEGIN */
+					n->is_serial = false;
+/* PGXC_END */
+					(yyval.node) = (Node *)n;
+				}
+#line 10559 "ora_gram.c"
+    break;
+
+  case 172: /* OptSeqOptList: SeqOptList  */
+#line 1656 "ora_gram.y"
+                                                                                { (yyval.list) = (yyvsp[0].list); }
+#line 10565 "ora_gram.c"
+    break;
+
+  case 173: /* OptSeqOptList: %empty  */
+#line 1657 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 10571 "ora_gram.c"
+    break;
+
+  case 174: /* SeqOptList: SeqOptElem  */
+#line 1660 "ora_gram.y"
+                                                                                { (yyval.list) = list_make1((yyvsp[0].defelt)); }
+#line 10577 "ora_gram.c"
+    break;
+
+  case 175: /* SeqOptList: SeqOptList SeqOptElem  */
+#line 1661 "ora_gram.y"
+                                                                                { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].defelt)); }
+#line 10583 "ora_gram.c"
+    break;
+
+  case 176: /* SeqOptElem: CACHE NumericOnly  */
+#line 1665 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("cache", (Node *)(yyvsp[0].value));
+				}
+#line 10591 "ora_gram.c"
+    break;
+
+  case 177: /* SeqOptElem: NOCACHE  */
+#line 1669 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("cache", (Node *)makeInteger(20));
+				}
+#line 10599 "ora_gram.c"
+    break;
+
+  case 178: /* SeqOptElem: CYCLE  */
+#line 1673 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("cycle", (Node *)makeInteger(TRUE));
+				}
+#line 10607 "ora_gram.c"
+    break;
+
+  case 179: /* SeqOptElem: NO CYCLE  */
+#line 1677 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("cycle", (Node *)makeInteger(FALSE));
+				}
+#line 10615 "ora_gram.c"
+    break;
+
+  case 180: /* SeqOptElem: NOCYCLE  */
+#line 1681 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("cycle", (Node *)makeInteger(FALSE));
+				}
+#line 10623 "ora_gram.c"
+    break;
+
+  case 181: /* SeqOptElem: INCREMENT opt_by NumericOnly  */
+#line 1685 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("increment", (Node *)(yyvsp[0].value));
+				}
+#line 10631 "ora_gram.c"
+    break;
+
+  case 182: /* SeqOptElem: MAXVALUE NumericOnly  */
+#line 1689 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("maxvalue", (Node *)(yyvsp[0].value));
+				}
+#line 10639 "ora_gram.c"
+    break;
+
+  case 183: /* SeqOptElem: MINVALUE NumericOnly  */
+#line 1693 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("minvalue", (Node *)(yyvsp[0].value));
+				}
+#line 10647 "ora_gram.c"
+    break;
+
+  case 184: /* SeqOptElem: NO MAXVALUE  */
+#line 1697 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("maxvalue", NULL);
+				}
+#line 10655 "ora_gram.c"
+    break;
+
+  case 185: /* SeqOptElem: NOMAXVALUE  */
+#line 1701 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("maxvalue", NULL);
+				}
+#line 10663 "ora_gram.c"
+    break;
+
+  case 186: /* SeqOptElem: NO MINVALUE  */
+#line 1705 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("minvalue", NULL);
+				}
+#line 10671 "ora_gram.c"
+    break;
+
+  case 187: /* SeqOptElem: NOMINVALUE  */
+#line 1709 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("minvalue", NULL);
+				}
+#line 10679 "ora_gram.c"
+    break;
+
+  case 188: /* SeqOptElem: OWNED BY any_name  */
+#line 1713 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("owned_by", (Node *)(yyvsp[0].list));
+				}
+#line 10687 "ora_gram.c"
+    break;
+
+  case 189: /* SeqOptElem: START opt_with NumericOnly  */
+#line 1717 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("start", (Node *)(yyvsp[0].value));
+				}
+#line 10695 "ora_gram.c"
+    break;
+
+  case 190: /* SeqOptElem: RESTART  */
+#line 1721 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("restart", NULL);
+				}
+#line 10703 "ora_gram.c"
+    break;
+
+  case 191: /* SeqOptElem: RESTART opt_with NumericOnly  */
+#line 1725 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem("restart", (Node *)(yyvsp[0].value));
+				}
+#line 10711 "ora_gram.c"
+    break;
+
+  case 192: /* opt_with: WITH  */
+#line 1730 "ora_gram.y"
+                                                                                        {}
+#line 10717 "ora_gram.c"
+    break;
+
+  case 193: /* opt_with: %empty  */
+#line 1731 "ora_gram.y"
+                                                                                                {}
+#line 10723 "ora_gram.c"
+    break;
+
+  case 194: /* opt_by: BY  */
+#line 1734 "ora_gram.y"
+                                                {}
+#line 10729 "ora_gram.c"
+    break;
+
+  case 195: /* opt_by: %empty  */
+#line 1735 "ora_gram.y"
+                                        {}
+#line 10735 "ora_gram.c"
+    break;
+
+  case 196: /* IndexStmt: CREATE opt_unique INDEX opt_concurrently opt_index_name ON qualified_name access_method_clause '(' index_params ')' opt_reloptions OptTableSpace where_clause  */
+#line 1753 "ora_gram.y"
+                                {
+					IndexStmt *n = makeNode(IndexStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->unique = (yyvsp[-12].boolean);
+					n->concurrent = (yyvsp[-10].boolean);
+					n->idxname = (yyvsp[-9].str);
+					n->relation = (yyvsp[-7].range);
+					n->accessMethod = (yyvsp[-6].str);
+					n->indexParams = (yyvsp[-4].list);
+					n->options = (yyvsp[-2].list);
+					n->tableSpace = (yyvsp[-1].str);
+					n->whereClause = (yyvsp[0].node);
+					n->excludeOpNames = NIL;
+					n->idxcomment = NULL;
+					n->indexOid = InvalidOid;
+					n->oldNode = InvalidOid;
+					n->primary = false;
+					n->isconstraint = false;
+					n->deferrable = false;
+					n->initdeferred = false;
+					(yyval.node) = (Node *)n;
+				}
+#line 10762 "ora_gram.c"
+    break;
+
+  case 197: /* opt_unique: UNIQUE  */
+#line 1778 "ora_gram.y"
+                                                                                                { (yyval.boolean) = TRUE; }
+#line 10768 "ora_gram.c"
+    break;
+
+  case 198: /* opt_unique: %empty  */
+#line 1779 "ora_gram.y"
+                                                                                                { (yyval.boolean) = FALSE; }
+#line 10774 "ora_gram.c"
+    break;
+
+  case 199: /* opt_concurrently: CONCURRENTLY  */
+#line 1782 "ora_gram.y"
+                                                                                        { (yyval.boolean) = TRUE; }
+#line 10780 "ora_gram.c"
+    break;
+
+  case 200: /* opt_concurrently: %empty  */
+#line 1783 "ora_gram.y"
+                                                                                                { (yyval.boolean) = FALSE; }
+#line 10786 "ora_gram.c"
+    break;
+
+  case 201: /* opt_index_name: index_name  */
+#line 1786 "ora_gram.y"
+                                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 10792 "ora_gram.c"
+    break;
+
+  case 202: /* opt_index_name: %empty  */
+#line 1787 "ora_gram.y"
+                                                                                                { (yyval.str) = NULL; }
+#line 10798 "ora_gram.c"
+    break;
+
+  case 203: /* index_name: ColId  */
+#line 1789 "ora_gram.y"
+                                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 10804 "ora_gram.c"
+    break;
+
+  case 204: /* access_method_clause: USING access_method  */
+#line 1791 "ora_gram.y"
+                                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 10810 "ora_gram.c"
+    break;
+
+  case 205: /* access_method_clause: %empty  */
+#line 1792 "ora_gram.y"
+                                                                                                { (yyval.str) = DEFAULT_INDEX_TYPE; }
+#line 10816 "ora_gram.c"
+    break;
+
+  case 206: /* access_method: ColId  */
+#line 1795 "ora_gram.y"
+                                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 10822 "ora_gram.c"
+    break;
+
+  case 207: /* index_params: index_elem  */
+#line 1797 "ora_gram.y"
+                                                                                { (yyval.list) = list_make1((yyvsp[0].ielem)); }
+#line 10828 "ora_gram.c"
+    break;
+
+  case 208: /* index_params: index_params ',' index_elem  */
+#line 1798 "ora_gram.y"
+                                                                        { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].ielem)); }
+#line 10834 "ora_gram.c"
+    break;
+
+  case 209: /* index_elem: ColId opt_collate opt_class opt_asc_desc opt_nulls_order  */
+#line 1806 "ora_gram.y"
+                                {
+					(yyval.ielem) = makeNode(IndexElem);
+					(yyval.ielem)->name = (yyvsp[-4].str);
+					(yyval.ielem)->expr = NULL;
+					(yyval.ielem)->indexcolname = NULL;
+					(yyval.ielem)->collation = (yyvsp[-3].list);
+					(yyval.ielem)->opclass = (yyvsp[-2].list);
+					(yyval.ielem)->ordering = (yyvsp[-1].ival);
+					(yyval.ielem)->nulls_ordering = (yyvsp[0].ival);
+				}
+#line 10849 "ora_gram.c"
+    break;
+
+  case 210: /* index_elem: func_expr opt_collate opt_class opt_asc_desc opt_nulls_order  */
+#line 1817 "ora_gram.y"
+                                {
+					(yyval.ielem) = makeNode(IndexElem);
+					(yyval.ielem)->name = NULL;
+					(yyval.ielem)->expr = (yyvsp[-4].node);
+					(yyval.ielem)->indexcolname = NULL;
+					(yyval.ielem)->collation = (yyvsp[-3].list);
+					(yyval.ielem)->opclass = (yyvsp[-2].list);
+					(yyval.ielem)->ordering = (yyvsp[-1].ival);
+					(yyval.ielem)->nulls_ordering = (yyvsp[0].ival);
+				}
+#line 10864 "ora_gram.c"
+    break;
+
+  case 211: /* index_elem: '(' a_expr ')' opt_collate opt_class opt_asc_desc opt_nulls_order  */
+#line 1828 "ora_gram.y"
+                                {
+					(yyval.ielem) = makeNode(IndexElem);
+					(yyval.ielem)->name = NULL;
+					(yyval.ielem)->expr = (yyvsp[-5].node);
+					(yyval.ielem)->indexcolname = NULL;
+					(yyval.ielem)->collation = (yyvsp[-3].list);
+					(yyval.ielem)->opclass = (yyvsp[-2].list);
+					(yyval.ielem)->ordering = (yyvsp[-1].ival);
+					(yyval.ielem)->nulls_ordering = (yyvsp[0].ival);
+				}
+#line 10879 "ora_gram.c"
+    break;
+
+  case 212: /* opt_collate: COLLATE any_name  */
+#line 1840 "ora_gram.y"
+                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 10885 "ora_gram.c"
+    break;
+
+  case 213: /* opt_collate: %empty  */
+#line 1841 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 10891 "ora_gram.c"
+    break;
+
+  case 214: /* opt_class: any_name  */
+#line 1844 "ora_gram.y"
+                                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 10897 "ora_gram.c"
+    break;
+
+  case 215: /* opt_class: USING any_name  */
+#line 1845 "ora_gram.y"
+                                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 10903 "ora_gram.c"
+    break;
+
+  case 216: /* opt_class: %empty  */
+#line 1846 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 10909 "ora_gram.c"
+    break;
+
+  case 217: /* opt_nulls_order: NULLS_FIRST  */
+#line 1849 "ora_gram.y"
+                                                        { (yyval.ival) = SORTBY_NULLS_FIRST; }
+#line 10915 "ora_gram.c"
+    break;
+
+  case 218: /* opt_nulls_order: NULLS_LAST  */
+#line 1850 "ora_gram.y"
+                                                                        { (yyval.ival) = SORTBY_NULLS_LAST; }
+#line 10921 "ora_gram.c"
+    break;
+
+  case 219: /* opt_nulls_order: %empty  */
+#line 1851 "ora_gram.y"
+                                                                                { (yyval.ival) = SORTBY_NULLS_DEFAULT; }
+#line 10927 "ora_gram.c"
+    break;
+
+  case 220: /* reloptions: '(' reloption_list ')'  */
+#line 1855 "ora_gram.y"
+                                                                                { (yyval.list) = (yyvsp[-1].list); }
+#line 10933 "ora_gram.c"
+    break;
+
+  case 221: /* opt_reloptions: WITH reloptions  */
+#line 1858 "ora_gram.y"
+                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 10939 "ora_gram.c"
+    break;
+
+  case 222: /* opt_reloptions: %empty  */
+#line 1859 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 10945 "ora_gram.c"
+    break;
+
+  case 223: /* reloption_list: reloption_elem  */
+#line 1863 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].defelt)); }
+#line 10951 "ora_gram.c"
+    break;
+
+  case 224: /* reloption_list: reloption_list ',' reloption_elem  */
+#line 1864 "ora_gram.y"
+                                                                        { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].defelt)); }
+#line 10957 "ora_gram.c"
+    break;
+
+  case 225: /* reloption_elem: ColLabel '=' def_arg  */
+#line 1870 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem((yyvsp[-2].str), (Node *) (yyvsp[0].node));
+				}
+#line 10965 "ora_gram.c"
+    break;
+
+  case 226: /* reloption_elem: ColLabel  */
+#line 1874 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem((yyvsp[0].str), NULL);
+				}
+#line 10973 "ora_gram.c"
+    break;
+
+  case 227: /* reloption_elem: ColLabel '.' ColLabel '=' def_arg  */
+#line 1878 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElemExtended((yyvsp[-4].str), (yyvsp[-2].str), (Node *) (yyvsp[0].node),
+											 DEFELEM_UNSPEC);
+				}
+#line 10982 "ora_gram.c"
+    break;
+
+  case 228: /* reloption_elem: ColLabel '.' ColLabel  */
+#line 1883 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElemExtended((yyvsp[-2].str), (yyvsp[0].str), NULL, DEFELEM_UNSPEC);
+				}
+#line 10990 "ora_gram.c"
+    break;
+
+  case 229: /* def_arg: func_type  */
+#line 1889 "ora_gram.y"
+                                                                        { (yyval.node) = (Node *)(yyvsp[0].typnam); }
+#line 10996 "ora_gram.c"
+    break;
+
+  case 230: /* def_arg: reserved_keyword  */
+#line 1890 "ora_gram.y"
+                                                                        { (yyval.node) = (Node *)makeString(pstrdup((yyvsp[0].keyword))); }
+#line 11002 "ora_gram.c"
+    break;
+
+  case 231: /* def_arg: qual_all_Op  */
+#line 1891 "ora_gram.y"
+                                                                        { (yyval.node) = (Node *)(yyvsp[0].list); }
+#line 11008 "ora_gram.c"
+    break;
+
+  case 232: /* def_arg: NumericOnly  */
+#line 1892 "ora_gram.y"
+                                                                        { (yyval.node) = (Node *)(yyvsp[0].value); }
+#line 11014 "ora_gram.c"
+    break;
+
+  case 233: /* def_arg: Sconst  */
+#line 1893 "ora_gram.y"
+                                                                                { (yyval.node) = (Node *)makeString((yyvsp[0].str)); }
+#line 11020 "ora_gram.c"
+    break;
+
+  case 234: /* func_type: Typename  */
+#line 1901 "ora_gram.y"
+                                                                                        { (yyval.typnam) = (yyvsp[0].typnam); }
+#line 11026 "ora_gram.c"
+    break;
+
+  case 235: /* func_type: type_function_name attrs '%' TYPE_P  */
+#line 1903 "ora_gram.y"
+                                {
+					(yyval.typnam) = makeTypeNameFromNameList(lcons(makeString((yyvsp[-3].str)), (yyvsp[-2].list)));
+					(yyval.typnam)->pct_type = true;
+					(yyval.typnam)->location = (yylsp[-3]);
+				}
+#line 11036 "ora_gram.c"
+    break;
+
+  case 236: /* func_type: SETOF type_function_name attrs '%' TYPE_P  */
+#line 1909 "ora_gram.y"
+                                {
+					(yyval.typnam) = makeTypeNameFromNameList(lcons(makeString((yyvsp[-3].str)), (yyvsp[-2].list)));
+					(yyval.typnam)->pct_type = true;
+					(yyval.typnam)->setof = TRUE;
+					(yyval.typnam)->location = (yylsp[-3]);
+				}
+#line 11047 "ora_gram.c"
+    break;
+
+  case 237: /* qual_all_Op: all_Op  */
+#line 1919 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 11053 "ora_gram.c"
+    break;
+
+  case 238: /* qual_all_Op: OPERATOR '(' any_operator ')'  */
+#line 1921 "ora_gram.y"
+                                        { (yyval.list) = (yyvsp[-1].list); }
+#line 11059 "ora_gram.c"
+    break;
+
+  case 239: /* sub_type: ANY  */
+#line 1924 "ora_gram.y"
+                                                                                                { (yyval.ival) = ANY_SUBLINK; }
+#line 11065 "ora_gram.c"
+    break;
+
+  case 240: /* sub_type: ALL  */
+#line 1928 "ora_gram.y"
+                                                                                                { (yyval.ival) = ALL_SUBLINK; }
+#line 11071 "ora_gram.c"
+    break;
+
+  case 241: /* subquery_Op: all_Op  */
+#line 1933 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 11077 "ora_gram.c"
+    break;
+
+  case 242: /* subquery_Op: OPERATOR '(' any_operator ')'  */
+#line 1935 "ora_gram.y"
+                                        { (yyval.list) = (yyvsp[-1].list); }
+#line 11083 "ora_gram.c"
+    break;
+
+  case 243: /* subquery_Op: LIKE  */
+#line 1937 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeString("~~")); }
+#line 11089 "ora_gram.c"
+    break;
+
+  case 244: /* subquery_Op: NOT LIKE  */
+#line 1939 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeString("!~~")); }
+#line 11095 "ora_gram.c"
+    break;
+
+  case 245: /* OptTableSpace: TABLESPACE name  */
+#line 1954 "ora_gram.y"
+                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 11101 "ora_gram.c"
+    break;
+
+  case 246: /* OptTableSpace: %empty  */
+#line 1955 "ora_gram.y"
+                                                                                                { (yyval.str) = NULL; }
+#line 11107 "ora_gram.c"
+    break;
+
+  case 247: /* alias_clause: AS ColId '(' name_list ')'  */
+#line 1962 "ora_gram.y"
+                                {
+					(yyval.alias) = makeNode(Alias);
+					(yyval.alias)->aliasname = (yyvsp[-3].str);
+					(yyval.alias)->colnames = (yyvsp[-1].list);
+				}
+#line 11117 "ora_gram.c"
+    break;
+
+  case 248: /* alias_clause: AS ColId  */
+#line 1968 "ora_gram.y"
+                                {
+					(yyval.alias) = makeNode(Alias);
+					(yyval.alias)->aliasname = (yyvsp[0].str);
+				}
+#line 11126 "ora_gram.c"
+    break;
+
+  case 249: /* alias_clause: ColId '(' name_list ')'  */
+#line 1973 "ora_gram.y"
+                                {
+					(yyval.alias) = makeNode(Alias);
+					(yyval.alias)->aliasname = (yyvsp[-3].str);
+					(yyval.alias)->colnames = (yyvsp[-1].list);
+				}
+#line 11136 "ora_gram.c"
+    break;
+
+  case 250: /* alias_clause: ColId  */
+#line 1979 "ora_gram.y"
+                                {
+					(yyval.alias) = makeNode(Alias);
+					(yyval.alias)->aliasname = (yyvsp[0].str);
+				}
+#line 11145 "ora_gram.c"
+    break;
+
+  case 253: /* any_operator: all_Op  */
+#line 1989 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 11151 "ora_gram.c"
+    break;
+
+  case 254: /* any_operator: ColId '.' any_operator  */
+#line 1990 "ora_gram.y"
+                                        { (yyval.list) = lcons(makeString((yyvsp[-2].str)), (yyvsp[0].list)); }
+#line 11157 "ora_gram.c"
+    break;
+
+  case 255: /* analyze_keyword: ANALYZE  */
+#line 1994 "ora_gram.y"
+                                                                                        {}
+#line 11163 "ora_gram.c"
+    break;
+
+  case 256: /* analyze_keyword: ANALYSE  */
+#line 1995 "ora_gram.y"
+                                                                        {}
+#line 11169 "ora_gram.c"
+    break;
+
+  case 258: /* a_expr: a_expr TYPECAST Typename  */
+#line 2000 "ora_gram.y"
+                { (yyval.node) = makeTypeCast((yyvsp[-2].node), (yyvsp[0].typnam), (yylsp[-1])); }
+#line 11175 "ora_gram.c"
+    break;
+
+  case 259: /* a_expr: a_expr AT TIME ZONE a_expr  */
+#line 2002 "ora_gram.y"
+                {
+			FuncCall *n = makeNode(FuncCall);
+			n->funcname = SystemFuncName("timezone");
+			n->args = list_make2((yyvsp[0].node), (yyvsp[-4].node));
+			n->agg_order = NIL;
+			n->agg_star = FALSE;
+			n->agg_distinct = FALSE;
+			n->func_variadic = FALSE;
+			n->over = NULL;
+			n->location = (yylsp[-3]);
+			(yyval.node) = (Node *) n;
+		}
+#line 11192 "ora_gram.c"
+    break;
+
+  case 260: /* a_expr: '+' a_expr  */
+#line 2015 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "+", NULL, (yyvsp[0].node), (yylsp[-1])); }
+#line 11198 "ora_gram.c"
+    break;
+
+  case 261: /* a_expr: '-' a_expr  */
+#line 2017 "ora_gram.y"
+                { (yyval.node) = doNegate((yyvsp[0].node), (yylsp[-1])); }
+#line 11204 "ora_gram.c"
+    break;
+
+  case 262: /* a_expr: a_expr '+' a_expr  */
+#line 2019 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "+", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11210 "ora_gram.c"
+    break;
+
+  case 263: /* a_expr: a_expr '-' a_expr  */
+#line 2021 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "-", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11216 "ora_gram.c"
+    break;
+
+  case 264: /* a_expr: a_expr '*' a_expr  */
+#line 2023 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "*", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11222 "ora_gram.c"
+    break;
+
+  case 265: /* a_expr: a_expr '/' a_expr  */
+#line 2025 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "/", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11228 "ora_gram.c"
+    break;
+
+  case 266: /* a_expr: a_expr '%' a_expr  */
+#line 2027 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "%", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11234 "ora_gram.c"
+    break;
+
+  case 267: /* a_expr: a_expr '^' a_expr  */
+#line 2029 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "^", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11240 "ora_gram.c"
+    break;
+
+  case 268: /* a_expr: a_expr '<' a_expr  */
+#line 2031 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "<", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11246 "ora_gram.c"
+    break;
+
+  case 269: /* a_expr: a_expr '>' a_expr  */
+#line 2033 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, ">", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11252 "ora_gram.c"
+    break;
+
+  case 270: /* a_expr: a_expr '=' a_expr  */
+#line 2035 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "=", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11258 "ora_gram.c"
+    break;
+
+  case 271: /* a_expr: a_expr qual_Op a_expr  */
+#line 2038 "ora_gram.y"
+                {
+			char *nspname = NULL;
+			char *objname = NULL;
+
+			DeconstructQualifiedName((yyvsp[-1].list), &nspname, &objname);
+			if (objname &&
+				strncmp(objname, "||", strlen(objname)) == 0)
+			{	
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("concat");
+				n->args = list_make2((yyvsp[-2].node), (yyvsp[0].node));
+				n->location = (yylsp[-2]);
+				(yyval.node) = (Node *)n;
+			} else
+			{
+				(yyval.node) = (Node *) makeA_Expr(AEXPR_OP, (yyvsp[-1].list), (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1]));
+			}
+		}
+#line 11281 "ora_gram.c"
+    break;
+
+  case 272: /* a_expr: qual_Op a_expr  */
+#line 2057 "ora_gram.y"
+                { (yyval.node) = (Node *) makeA_Expr(AEXPR_OP, (yyvsp[-1].list), NULL, (yyvsp[0].node), (yylsp[-1])); }
+#line 11287 "ora_gram.c"
+    break;
+
+  case 273: /* a_expr: a_expr qual_Op  */
+#line 2059 "ora_gram.y"
+                { (yyval.node) = (Node *) makeA_Expr(AEXPR_OP, (yyvsp[0].list), (yyvsp[-1].node), NULL, (yylsp[0])); }
+#line 11293 "ora_gram.c"
+    break;
+
+  case 274: /* a_expr: a_expr AND a_expr  */
+#line 2062 "ora_gram.y"
+                { (yyval.node) = (Node *) makeA_Expr(AEXPR_AND, NIL, (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11299 "ora_gram.c"
+    break;
+
+  case 275: /* a_expr: a_expr OR a_expr  */
+#line 2064 "ora_gram.y"
+                { (yyval.node) = (Node *) makeA_Expr(AEXPR_OR, NIL, (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11305 "ora_gram.c"
+    break;
+
+  case 276: /* a_expr: NOT a_expr  */
+#line 2066 "ora_gram.y"
+                { (yyval.node) = (Node *) makeA_Expr(AEXPR_NOT, NIL, NULL, (yyvsp[0].node), (yylsp[-1])); }
+#line 11311 "ora_gram.c"
+    break;
+
+  case 277: /* a_expr: a_expr LIKE a_expr  */
+#line 2068 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "~~", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11317 "ora_gram.c"
+    break;
+
+  case 278: /* a_expr: a_expr LIKE a_expr ESCAPE a_expr  */
+#line 2070 "ora_gram.y"
+                {
+			FuncCall *n = makeNode(FuncCall);
+			n->funcname = SystemFuncName("like_escape");
+			n->args = list_make2((yyvsp[-2].node), (yyvsp[0].node));
+			n->agg_order = NIL;
+			n->agg_star = FALSE;
+			n->agg_distinct = FALSE;
+			n->func_variadic = FALSE;
+			n->over = NULL;
+			n->location = (yylsp[-3]);
+			(yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "~~", (yyvsp[-4].node), (Node *) n, (yylsp[-3]));
+		}
+#line 11334 "ora_gram.c"
+    break;
+
+  case 279: /* a_expr: a_expr NOT LIKE a_expr  */
+#line 2083 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "!~~", (yyvsp[-3].node), (yyvsp[0].node), (yylsp[-2])); }
+#line 11340 "ora_gram.c"
+    break;
+
+  case 280: /* a_expr: a_expr NOT LIKE a_expr ESCAPE a_expr  */
+#line 2085 "ora_gram.y"
+                {
+			FuncCall *n = makeNode(FuncCall);
+			n->funcname = SystemFuncName("like_escape");
+			n->args = list_make2((yyvsp[-2].node), (yyvsp[0].node));
+			n->agg_order = NIL;
+			n->agg_star = FALSE;
+			n->agg_distinct = FALSE;
+			n->func_variadic = FALSE;
+			n->over = NULL;
+			n->location = (yylsp[-4]);
+			(yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "!~~", (yyvsp[-5].node), (Node *) n, (yylsp[-4]));
+		}
+#line 11357 "ora_gram.c"
+    break;
+
+  case 281: /* a_expr: a_expr IS NULL_P  */
+#line 2098 "ora_gram.y"
+                {
+			NullTest *n = makeNode(NullTest);
+			n->arg = (Expr *) (yyvsp[-2].node);
+			n->nulltesttype = IS_NULL;
+			(yyval.node) = (Node *) n;
+		}
+#line 11368 "ora_gram.c"
+    break;
+
+  case 282: /* a_expr: a_expr IS NOT NULL_P  */
+#line 2105 "ora_gram.y"
+                {
+			NullTest *n = makeNode(NullTest);
+			n->arg = (Expr *) (yyvsp[-3].node);
+			n->nulltesttype = IS_NOT_NULL;
+			(yyval.node) = (Node *) n;
+		}
+#line 11379 "ora_gram.c"
+    break;
+
+  case 283: /* a_expr: a_expr BETWEEN b_expr AND b_expr  */
+#line 2112 "ora_gram.y"
+                {
+			(yyval.node) = (Node *) makeA_Expr(AEXPR_AND, NIL,
+				(Node *) makeSimpleA_Expr(AEXPR_OP, ">=", (yyvsp[-4].node), (yyvsp[-2].node), (yylsp[-3])),
+				(Node *) makeSimpleA_Expr(AEXPR_OP, "<=", (yyvsp[-4].node), (yyvsp[0].node), (yylsp[-3])),
+									 (yylsp[-3]));
+		}
+#line 11390 "ora_gram.c"
+    break;
+
+  case 284: /* a_expr: a_expr NOT BETWEEN b_expr AND b_expr  */
+#line 2119 "ora_gram.y"
+                {
+			(yyval.node) = (Node *) makeA_Expr(AEXPR_OR, NIL,
+				(Node *) makeSimpleA_Expr(AEXPR_OP, "<", (yyvsp[-5].node), (yyvsp[-2].node), (yylsp[-4])),
+				(Node *) makeSimpleA_Expr(AEXPR_OP, ">", (yyvsp[-5].node), (yyvsp[0].node), (yylsp[-4])),
+									 (yylsp[-4]));
+		}
+#line 11401 "ora_gram.c"
+    break;
+
+  case 285: /* a_expr: a_expr IN_P select_with_parens  */
+#line 2126 "ora_gram.y"
+                {
+			SubLink *n = makeNode(SubLink);
+			n->subselect = (yyvsp[0].node);
+			n->subLinkType = ANY_SUBLINK;
+			n->testexpr = (yyvsp[-2].node);
+			n->operName = list_make1(makeString("="));
+			n->location = (yylsp[-1]);
+			(yyval.node) = (Node*)n;
+		}
+#line 11415 "ora_gram.c"
+    break;
+
+  case 286: /* a_expr: a_expr IN_P '(' expr_list ')'  */
+#line 2136 "ora_gram.y"
+                {
+			(yyval.node) = (Node*)makeSimpleA_Expr(AEXPR_IN, "=", (yyvsp[-4].node), (Node*)(yyvsp[-1].list), (yylsp[-3]));
+		}
+#line 11423 "ora_gram.c"
+    break;
+
+  case 287: /* a_expr: a_expr NOT IN_P select_with_parens  */
+#line 2140 "ora_gram.y"
+                {
+			SubLink *n = makeNode(SubLink);
+			n->subselect = (yyvsp[0].node);
+			n->subLinkType = ANY_SUBLINK;
+			n->testexpr = (yyvsp[-3].node);
+			n->operName = list_make1(makeString("="));
+			n->location = (yylsp[-1]);
+			(yyval.node) = (Node*)makeA_Expr(AEXPR_NOT, NIL, NULL, (Node*)n, (yylsp[-2]));
+		}
+#line 11437 "ora_gram.c"
+    break;
+
+  case 288: /* a_expr: a_expr NOT IN_P '(' expr_list ')'  */
+#line 2150 "ora_gram.y"
+                {
+			(yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_IN, "<>", (yyvsp[-5].node), (Node*)(yyvsp[-1].list), (yylsp[-4]));
+		}
+#line 11445 "ora_gram.c"
+    break;
+
+  case 289: /* a_expr: a_expr subquery_Op sub_type select_with_parens  */
+#line 2154 "ora_gram.y"
+                {
+			SubLink *n = makeNode(SubLink);
+			n->subLinkType = (yyvsp[-1].ival);
+			n->testexpr = (yyvsp[-3].node);
+			n->operName = (yyvsp[-2].list);
+			n->subselect = (yyvsp[0].node);
+			n->location = (yylsp[-2]);
+			(yyval.node) = (Node *)n;
+		}
+#line 11459 "ora_gram.c"
+    break;
+
+  case 290: /* a_expr: a_expr qual_Op SOME select_with_parens  */
+#line 2164 "ora_gram.y"
+                {
+			SubLink *n = makeNode(SubLink);
+			n->subLinkType = ANY_SUBLINK;
+			n->testexpr = (yyvsp[-3].node);
+			n->operName = (yyvsp[-2].list);
+			n->subselect = (yyvsp[0].node);
+			n->location = (yylsp[-2]);
+			(yyval.node) = (Node *)n;
+		}
+#line 11473 "ora_gram.c"
+    break;
+
+  case 291: /* a_expr: a_expr '+' SOME select_with_parens  */
+#line 2173 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "+", (yyvsp[0].node), (yylsp[-2])); }
+#line 11479 "ora_gram.c"
+    break;
+
+  case 292: /* a_expr: a_expr '-' SOME select_with_parens  */
+#line 2174 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "-", (yyvsp[0].node), (yylsp[-2])); }
+#line 11485 "ora_gram.c"
+    break;
+
+  case 293: /* a_expr: a_expr '*' SOME select_with_parens  */
+#line 2175 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "*", (yyvsp[0].node), (yylsp[-2])); }
+#line 11491 "ora_gram.c"
+    break;
+
+  case 294: /* a_expr: a_expr '/' SOME select_with_parens  */
+#line 2176 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "/", (yyvsp[0].node), (yylsp[-2])); }
+#line 11497 "ora_gram.c"
+    break;
+
+  case 295: /* a_expr: a_expr '%' SOME select_with_parens  */
+#line 2177 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "%", (yyvsp[0].node), (yylsp[-2])); }
+#line 11503 "ora_gram.c"
+    break;
+
+  case 296: /* a_expr: a_expr '^' SOME select_with_parens  */
+#line 2178 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "^", (yyvsp[0].node), (yylsp[-2])); }
+#line 11509 "ora_gram.c"
+    break;
+
+  case 297: /* a_expr: a_expr '<' SOME select_with_parens  */
+#line 2179 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "<", (yyvsp[0].node), (yylsp[-2])); }
+#line 11515 "ora_gram.c"
+    break;
+
+  case 298: /* a_expr: a_expr '>' SOME select_with_parens  */
+#line 2180 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), ">", (yyvsp[0].node), (yylsp[-2])); }
+#line 11521 "ora_gram.c"
+    break;
+
+  case 299: /* a_expr: a_expr '=' SOME select_with_parens  */
+#line 2181 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "=", (yyvsp[0].node), (yylsp[-2])); }
+#line 11527 "ora_gram.c"
+    break;
+
+  case 300: /* a_expr: a_expr LIKE SOME select_with_parens  */
+#line 2182 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-3].node), "~~", (yyvsp[0].node), (yylsp[-2])); }
+#line 11533 "ora_gram.c"
+    break;
+
+  case 301: /* a_expr: a_expr NOT LIKE SOME select_with_parens  */
+#line 2183 "ora_gram.y"
+                                                        { (yyval.node) = make_any_sublink((yyvsp[-4].node), "!~~", (yyvsp[0].node), (yylsp[-3])); }
+#line 11539 "ora_gram.c"
+    break;
+
+  case 302: /* a_expr: a_expr subquery_Op sub_type '(' a_expr ')'  */
+#line 2185 "ora_gram.y"
+                {
+			if ((yyvsp[-3].ival) == ANY_SUBLINK)
+				(yyval.node) = (Node *) makeA_Expr(AEXPR_OP_ANY, (yyvsp[-4].list), (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4]));
+			else
+				(yyval.node) = (Node *) makeA_Expr(AEXPR_OP_ALL, (yyvsp[-4].list), (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4]));
+		}
+#line 11550 "ora_gram.c"
+    break;
+
+  case 303: /* a_expr: a_expr qual_Op SOME '(' a_expr ')'  */
+#line 2192 "ora_gram.y"
+                {
+			(yyval.node) = (Node*) makeA_Expr(AEXPR_OP_ANY, (yyvsp[-4].list), (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4]));
+		}
+#line 11558 "ora_gram.c"
+    break;
+
+  case 304: /* a_expr: a_expr '+' SOME '(' a_expr ')'  */
+#line 2195 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR("+", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11564 "ora_gram.c"
+    break;
+
+  case 305: /* a_expr: a_expr '*' SOME '(' a_expr ')'  */
+#line 2196 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR("*", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11570 "ora_gram.c"
+    break;
+
+  case 306: /* a_expr: a_expr '/' SOME '(' a_expr ')'  */
+#line 2197 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR("/", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11576 "ora_gram.c"
+    break;
+
+  case 307: /* a_expr: a_expr '%' SOME '(' a_expr ')'  */
+#line 2198 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR("%", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11582 "ora_gram.c"
+    break;
+
+  case 308: /* a_expr: a_expr '^' SOME '(' a_expr ')'  */
+#line 2199 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR("^", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11588 "ora_gram.c"
+    break;
+
+  case 309: /* a_expr: a_expr '<' SOME '(' a_expr ')'  */
+#line 2200 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR("<", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11594 "ora_gram.c"
+    break;
+
+  case 310: /* a_expr: a_expr '>' SOME '(' a_expr ')'  */
+#line 2201 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR(">", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11600 "ora_gram.c"
+    break;
+
+  case 311: /* a_expr: a_expr '=' SOME '(' a_expr ')'  */
+#line 2202 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR("=", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11606 "ora_gram.c"
+    break;
+
+  case 312: /* a_expr: a_expr LIKE SOME '(' a_expr ')'  */
+#line 2203 "ora_gram.y"
+                                                                { (yyval.node) = MAKE_ANY_A_EXPR("~~", (yyvsp[-5].node), (yyvsp[-1].node), (yylsp[-4])); }
+#line 11612 "ora_gram.c"
+    break;
+
+  case 313: /* a_expr: a_expr NOT LIKE SOME '(' a_expr ')'  */
+#line 2204 "ora_gram.y"
+                                                        { (yyval.node) = MAKE_ANY_A_EXPR("!~~", (yyvsp[-6].node), (yyvsp[-1].node), (yylsp[-5])); }
+#line 11618 "ora_gram.c"
+    break;
+
+  case 314: /* a_expr: PRIOR a_expr  */
+#line 2206 "ora_gram.y"
+                {
+			PriorExpr *prior = makeNode(PriorExpr);
+			prior->location = (yylsp[-1]);
+			prior->expr = (yyvsp[0].node);
+			(yyval.node) = (Node*)prior;
+		}
+#line 11629 "ora_gram.c"
+    break;
+
+  case 315: /* AexprConst: Iconst  */
+#line 2218 "ora_gram.y"
+                                {
+					(yyval.node) = makeIntConst((yyvsp[0].ival), (yylsp[0]));
+				}
+#line 11637 "ora_gram.c"
+    break;
+
+  case 316: /* AexprConst: FCONST  */
+#line 2222 "ora_gram.y"
+                                {
+					(yyval.node) = makeFloatConst((yyvsp[0].str), (yylsp[0]));
+				}
+#line 11645 "ora_gram.c"
+    break;
+
+  case 317: /* AexprConst: Sconst  */
+#line 2226 "ora_gram.y"
+                                {
+					(yyval.node) = makeStringConst((yyvsp[0].str), (yylsp[0]));
+				}
+#line 11653 "ora_gram.c"
+    break;
+
+  case 318: /* AexprConst: NULL_P  */
+#line 2230 "ora_gram.y"
+                                {
+					(yyval.node) = makeNullAConst((yylsp[0]));
+				}
+#line 11661 "ora_gram.c"
+    break;
+
+  case 319: /* AexprConst: func_name Sconst  */
+#line 2234 "ora_gram.y"
+                                {
+					/* generic type 'literal' syntax */
+					TypeName *t = makeTypeNameFromNameList((yyvsp[-1].list));
+					t->location = (yylsp[-1]);
+					(yyval.node) = makeStringConstCast((yyvsp[0].str), (yylsp[0]), t);
+				}
+#line 11672 "ora_gram.c"
+    break;
+
+  case 320: /* AexprConst: func_name '(' func_arg_list ')' Sconst  */
+#line 2241 "ora_gram.y"
+                                {
+					/* generic syntax with a type modifier */
+					TypeName *t = makeTypeNameFromNameList((yyvsp[-4].list));
+					ListCell *lc;
+
+					/*
+					 * We must use func_arg_list in the production to avoid
+					 * reduce/reduce conflicts, but we don't actually wish
+					 * to allow NamedArgExpr in this context.
+					 */
+					foreach(lc, (yyvsp[-2].list))
+					{
+						NamedArgExpr *arg = (NamedArgExpr *) lfirst(lc);
+
+						if (IsA(arg, NamedArgExpr))
+							ereport(ERROR,
+									(errcode(ERRCODE_SYNTAX_ERROR),
+									 errmsg("type modifier cannot have parameter name"),
+									 parser_errposition(arg->location)));
+					}
+					t->typmods = (yyvsp[-2].list);
+					t->location = (yylsp[-4]);
+					(yyval.node) = makeStringConstCast((yyvsp[0].str), (yylsp[0]), t);
+				}
+#line 11701 "ora_gram.c"
+    break;
+
+  case 321: /* AexprConst: ConstTypename Sconst  */
+#line 2266 "ora_gram.y"
+                                {
+					(yyval.node) = makeStringConstCast((yyvsp[0].str), (yylsp[0]), (yyvsp[-1].typnam));
+				}
+#line 11709 "ora_gram.c"
+    break;
+
+  case 322: /* AexprConst: ConstInterval Sconst opt_interval  */
+#line 2270 "ora_gram.y"
+                                {
+					TypeName *t = (yyvsp[-2].typnam);
+					t->typmods = (yyvsp[0].list);
+					(yyval.node) = makeStringConstCast((yyvsp[-1].str), (yylsp[-1]), t);
+				}
+#line 11719 "ora_gram.c"
+    break;
+
+  case 323: /* AexprConst: ConstInterval '(' Iconst ')' Sconst opt_interval  */
+#line 2276 "ora_gram.y"
+                                {
+					TypeName *t = (yyvsp[-5].typnam);
+					if ((yyvsp[0].list) != NIL)
+					{
+						if (list_length((yyvsp[0].list)) != 1)
+							ereport(ERROR,
+									(errcode(ERRCODE_SYNTAX_ERROR),
+									 errmsg("interval precision specified twice"),
+									 parser_errposition((yylsp[-5]))));
+						t->typmods = lappend((yyvsp[0].list), makeIntConst((yyvsp[-3].ival), (yylsp[-3])));
+					}
+					else
+						t->typmods = list_make2(makeIntConst(INTERVAL_FULL_RANGE, -1),
+												makeIntConst((yyvsp[-3].ival), (yylsp[-3])));
+					(yyval.node) = makeStringConstCast((yyvsp[-1].str), (yylsp[-1]), t);
+				}
+#line 11740 "ora_gram.c"
+    break;
+
+  case 325: /* Bit: BFILE  */
+#line 2297 "ora_gram.y"
+                                                { (yyval.typnam) = SystemTypeNameLocation("bytea", (yylsp[0])); }
+#line 11746 "ora_gram.c"
+    break;
+
+  case 326: /* Bit: BLOB  */
+#line 2298 "ora_gram.y"
+                                                { (yyval.typnam) = SystemTypeNameLocation("bytea", (yylsp[0])); }
+#line 11752 "ora_gram.c"
+    break;
+
+  case 327: /* Bit: LONG_P RAW  */
+#line 2299 "ora_gram.y"
+                                        { (yyval.typnam) = SystemTypeNameLocation("bytea", (yylsp[-1])); }
+#line 11758 "ora_gram.c"
+    break;
+
+  case 328: /* Bit: RAW '(' Iconst ')'  */
+#line 2301 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("bytea", (yylsp[-3]));
+			(yyval.typnam)->typmods = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+		}
+#line 11767 "ora_gram.c"
+    break;
+
+  case 330: /* b_expr: b_expr TYPECAST Typename  */
+#line 2309 "ora_gram.y"
+                { (yyval.node) = makeTypeCast((yyvsp[-2].node), (yyvsp[0].typnam), (yylsp[-1])); }
+#line 11773 "ora_gram.c"
+    break;
+
+  case 331: /* b_expr: '+' b_expr  */
+#line 2311 "ora_gram.y"
+                { (yyval.node) = (Node*)makeSimpleA_Expr(AEXPR_OP, "+", NULL, (yyvsp[0].node), (yylsp[-1])); }
+#line 11779 "ora_gram.c"
+    break;
+
+  case 332: /* b_expr: '-' b_expr  */
+#line 2313 "ora_gram.y"
+                { (yyval.node) = doNegate((yyvsp[0].node), (yylsp[-1])); }
+#line 11785 "ora_gram.c"
+    break;
+
+  case 333: /* b_expr: b_expr '+' b_expr  */
+#line 2315 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "+", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11791 "ora_gram.c"
+    break;
+
+  case 334: /* b_expr: b_expr '-' b_expr  */
+#line 2317 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "-", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11797 "ora_gram.c"
+    break;
+
+  case 335: /* b_expr: b_expr '*' b_expr  */
+#line 2319 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "*", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11803 "ora_gram.c"
+    break;
+
+  case 337: /* b_expr: b_expr '%' b_expr  */
+#line 2322 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "%", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11809 "ora_gram.c"
+    break;
+
+  case 338: /* b_expr: b_expr '^' b_expr  */
+#line 2324 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "^", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11815 "ora_gram.c"
+    break;
+
+  case 339: /* b_expr: b_expr '<' b_expr  */
+#line 2326 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "<", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11821 "ora_gram.c"
+    break;
+
+  case 340: /* b_expr: b_expr '>' b_expr  */
+#line 2328 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, ">", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11827 "ora_gram.c"
+    break;
+
+  case 341: /* b_expr: b_expr '=' b_expr  */
+#line 2330 "ora_gram.y"
+                { (yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_OP, "=", (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1])); }
+#line 11833 "ora_gram.c"
+    break;
+
+  case 342: /* b_expr: b_expr qual_Op b_expr  */
+#line 2332 "ora_gram.y"
+                {
+			char *nspname = NULL;
+			char *objname = NULL;
+
+			DeconstructQualifiedName((yyvsp[-1].list), &nspname, &objname);
+			if (objname &&
+				strncmp(objname, "||", strlen(objname)) == 0)
+			{	
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("concat");
+				n->args = list_make2((yyvsp[-2].node), (yyvsp[0].node));
+				n->location = (yylsp[-2]);
+				(yyval.node) = (Node *)n;
+			} else
+			{
+				(yyval.node) = (Node *) makeA_Expr(AEXPR_OP, (yyvsp[-1].list), (yyvsp[-2].node), (yyvsp[0].node), (yylsp[-1]));
+			}
+		}
+#line 11856 "ora_gram.c"
+    break;
+
+  case 343: /* b_expr: qual_Op b_expr  */
+#line 2351 "ora_gram.y"
+                { (yyval.node) = (Node *) makeA_Expr(AEXPR_OP, (yyvsp[-1].list), NULL, (yyvsp[0].node), (yylsp[-1])); }
+#line 11862 "ora_gram.c"
+    break;
+
+  case 344: /* b_expr: b_expr qual_Op  */
+#line 2353 "ora_gram.y"
+                { (yyval.node) = (Node *) makeA_Expr(AEXPR_OP, (yyvsp[0].list), (yyvsp[-1].node), NULL, (yylsp[0])); }
+#line 11868 "ora_gram.c"
+    break;
+
+  case 345: /* b_expr: b_expr IS DISTINCT FROM b_expr  */
+#line 2355 "ora_gram.y"
+                {
+			(yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_DISTINCT, "=", (yyvsp[-4].node), (yyvsp[0].node), (yylsp[-3]));
+		}
+#line 11876 "ora_gram.c"
+    break;
+
+  case 346: /* case_default: ELSE a_expr  */
+#line 2364 "ora_gram.y"
+                                        { (yyval.node) = (yyvsp[0].node); }
+#line 11882 "ora_gram.c"
+    break;
+
+  case 347: /* case_default: %empty  */
+#line 2365 "ora_gram.y"
+                                                { (yyval.node) = NULL; }
+#line 11888 "ora_gram.c"
+    break;
+
+  case 348: /* case_expr: CASE case_when_list case_default END_P  */
+#line 2370 "ora_gram.y"
+                {
+			CaseExpr *c = makeNode(CaseExpr);
+			c->casetype = InvalidOid;
+			c->arg = NULL;
+			c->args = (yyvsp[-2].list);
+			c->defresult = (Expr*)(yyvsp[-1].node);
+			c->location = (yylsp[-3]);
+			(yyval.node) = (Node*)c;
+		}
+#line 11902 "ora_gram.c"
+    break;
+
+  case 349: /* case_expr: CASE a_expr case_when_list case_default END_P  */
+#line 2380 "ora_gram.y"
+                {
+			CaseExpr *c = makeNode(CaseExpr);
+			c->casetype = InvalidOid;
+			c->arg = (Expr*)(yyvsp[-3].node);
+			c->args = (yyvsp[-2].list);
+			c->defresult = (Expr*)(yyvsp[-1].node);
+			c->location = (yylsp[-4]);
+			(yyval.node) = (Node*)c;
+		}
+#line 11916 "ora_gram.c"
+    break;
+
+  case 350: /* case_when_list: case_when_item  */
+#line 2391 "ora_gram.y"
+                                                { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 11922 "ora_gram.c"
+    break;
+
+  case 351: /* case_when_list: case_when_list case_when_item  */
+#line 2392 "ora_gram.y"
+                                                { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].node)); }
+#line 11928 "ora_gram.c"
+    break;
+
+  case 352: /* case_when_item: WHEN a_expr THEN a_expr  */
+#line 2396 "ora_gram.y"
+                {
+			CaseWhen *w = makeNode(CaseWhen);
+			w->expr = (Expr *) (yyvsp[-2].node);
+			w->result = (Expr *) (yyvsp[0].node);
+			w->location = (yylsp[-3]);
+			(yyval.node) = (Node *)w;
+		}
+#line 11940 "ora_gram.c"
+    break;
+
+  case 353: /* Character: VARCHAR opt_type_mod  */
+#line 2407 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("varchar", (yylsp[-1]));
+			(yyval.typnam)->typmods = (yyvsp[0].list);
+		}
+#line 11949 "ora_gram.c"
+    break;
+
+  case 354: /* Character: VARCHAR2 '(' Iconst opt_byte_char ')'  */
+#line 2412 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("varchar2", (yylsp[-4]));
+			(yyval.typnam)->typmods = list_make1(makeIntConst((yyvsp[-2].ival), (yylsp[-2])));
+		}
+#line 11958 "ora_gram.c"
+    break;
+
+  case 355: /* Character: NVARCHAR2 '(' Iconst ')'  */
+#line 2417 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("nvarchar2", (yylsp[-3]));
+			(yyval.typnam)->typmods = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+		}
+#line 11967 "ora_gram.c"
+    break;
+
+  case 356: /* Character: CHAR_P '(' Iconst opt_byte_char ')'  */
+#line 2422 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("bpchar", (yylsp[-4]));
+			(yyval.typnam)->typmods = list_make1(makeIntConst((yyvsp[-2].ival), (yylsp[-2])));
+		}
+#line 11976 "ora_gram.c"
+    break;
+
+  case 357: /* Character: CHAR_P  */
+#line 2427 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("bpchar", (yylsp[0]));
+			/* char defaults to char(1) */
+			(yyval.typnam)->typmods = list_make1(makeIntConst(1, -1));
+		}
+#line 11986 "ora_gram.c"
+    break;
+
+  case 358: /* Character: NCHAR '(' Iconst ')'  */
+#line 2433 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("bpchar", (yylsp[-3]));
+			(yyval.typnam)->typmods = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+		}
+#line 11995 "ora_gram.c"
+    break;
+
+  case 359: /* Character: NCHAR  */
+#line 2438 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("bpchar", (yylsp[0]));
+			/* nchar defaults to char(1) */
+			(yyval.typnam)->typmods = list_make1(makeIntConst(1, -1));
+		}
+#line 12005 "ora_gram.c"
+    break;
+
+  case 360: /* Character: CLOB  */
+#line 2443 "ora_gram.y"
+                        { (yyval.typnam) = SystemTypeNameLocation("text", (yylsp[0])); }
+#line 12011 "ora_gram.c"
+    break;
+
+  case 361: /* Character: NCLOB  */
+#line 2444 "ora_gram.y"
+                        { (yyval.typnam) = SystemTypeNameLocation("text", (yylsp[0])); }
+#line 12017 "ora_gram.c"
+    break;
+
+  case 366: /* c_expr: '(' a_expr ')'  */
+#line 2451 "ora_gram.y"
+                         { (yyval.node) = (yyvsp[-1].node); }
+#line 12023 "ora_gram.c"
+    break;
+
+  case 367: /* c_expr: PARAM opt_indirection  */
+#line 2453 "ora_gram.y"
+                {
+			ParamRef *p = makeNode(ParamRef);
+			p->number = (yyvsp[-1].ival);
+			p->location = (yylsp[-1]);
+			if ((yyvsp[0].list))
+			{
+				A_Indirection *n = makeNode(A_Indirection);
+				n->arg = (Node *) p;
+				n->indirection = check_indirection((yyvsp[0].list), yyscanner);
+				(yyval.node) = (Node *) n;
+			}
+			else
+				(yyval.node) = (Node *) p;
+		}
+#line 12042 "ora_gram.c"
+    break;
+
+  case 368: /* c_expr: select_with_parens  */
+#line 2468 "ora_gram.y"
+                {
+			SubLink *n = makeNode(SubLink);
+			n->subLinkType = EXPR_SUBLINK;
+			n->testexpr = NULL;
+			n->operName = NIL;
+			n->subselect = (yyvsp[0].node);
+			n->location = (yylsp[0]);
+			(yyval.node) = (Node *)n;
+		}
+#line 12056 "ora_gram.c"
+    break;
+
+  case 369: /* c_expr: EXISTS select_with_parens  */
+#line 2478 "ora_gram.y"
+                {
+			SubLink *n = makeNode(SubLink);
+			n->subLinkType = EXISTS_SUBLINK;
+			/*n->testexpr = NULL;
+			n->operName = NIL;*/
+			n->subselect = (yyvsp[0].node);
+			n->location = (yylsp[-1]);
+			(yyval.node) = (Node *)n;
+		}
+#line 12070 "ora_gram.c"
+    break;
+
+  case 370: /* c_expr: row  */
+#line 2488 "ora_gram.y"
+                {
+			RowExpr *r = makeNode(RowExpr);
+			r->args = (yyvsp[0].list);
+			r->row_typeid = InvalidOid;	/* not analyzed yet */
+			r->colnames = NIL;	/* to be filled in during analysis */
+			r->location = (yylsp[0]);
+			(yyval.node) = (Node *)r;
+		}
+#line 12083 "ora_gram.c"
+    break;
+
+  case 371: /* ColId: IDENT  */
+#line 2500 "ora_gram.y"
+                                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 12089 "ora_gram.c"
+    break;
+
+  case 372: /* ColId: unreserved_keyword  */
+#line 2501 "ora_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 12095 "ora_gram.c"
+    break;
+
+  case 373: /* ColId: col_name_keyword  */
+#line 2502 "ora_gram.y"
+                                                                                        { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 12101 "ora_gram.c"
+    break;
+
+  case 374: /* ColLabel: IDENT  */
+#line 2508 "ora_gram.y"
+                                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 12107 "ora_gram.c"
+    break;
+
+  case 375: /* ColLabel: unreserved_keyword  */
+#line 2509 "ora_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 12113 "ora_gram.c"
+    break;
+
+  case 376: /* ColLabel: col_name_keyword  */
+#line 2510 "ora_gram.y"
+                                                                                        { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 12119 "ora_gram.c"
+    break;
+
+  case 377: /* ColLabel: type_func_name_keyword  */
+#line 2511 "ora_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 12125 "ora_gram.c"
+    break;
+
+  case 378: /* ColLabel: reserved_keyword  */
+#line 2512 "ora_gram.y"
+                                                                                        { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 12131 "ora_gram.c"
+    break;
+
+  case 379: /* common_table_expr: name opt_name_list AS '(' SelectStmt ')'  */
+#line 2516 "ora_gram.y"
+                {
+			CommonTableExpr *n = makeNode(CommonTableExpr);
+			n->ctename = (yyvsp[-5].str);
+			n->aliascolnames = (yyvsp[-4].list);
+			n->ctequery = (yyvsp[-1].node);
+			n->location = (yylsp[-5]);
+			(yyval.node) = (Node *) n;
+		}
+#line 12144 "ora_gram.c"
+    break;
+
+  case 380: /* columnDef: ColId Typename create_generic_options ColQualList  */
+#line 2528 "ora_gram.y"
+                {
+					ColumnDef *n = makeNode(ColumnDef);
+					n->colname = (yyvsp[-3].str);
+					n->typeName = (yyvsp[-2].typnam);
+					n->inhcount = 0;
+					n->is_local = true;
+					n->is_not_null = false;
+					n->is_from_type = false;
+					n->storage = 0;
+					n->raw_default = NULL;
+					n->cooked_default = NULL;
+					n->collOid = InvalidOid;
+					n->fdwoptions = (yyvsp[-1].list);
+					SplitColQualList((yyvsp[0].list), &n->constraints, &n->collClause,
+									 yyscanner);
+					(yyval.node) = (Node *)n;
+		}
+#line 12166 "ora_gram.c"
+    break;
+
+  case 381: /* ColQualList: ColQualList ColConstraint  */
+#line 2548 "ora_gram.y"
+                                                                                { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].node)); }
+#line 12172 "ora_gram.c"
+    break;
+
+  case 382: /* ColQualList: %empty  */
+#line 2549 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 12178 "ora_gram.c"
+    break;
+
+  case 383: /* ColConstraint: CONSTRAINT name ColConstraintElem  */
+#line 2554 "ora_gram.y"
+                                {
+					Constraint *n = (Constraint *) (yyvsp[0].node);
+					Assert(IsA(n, Constraint));
+					n->conname = (yyvsp[-1].str);
+					n->location = (yylsp[-2]);
+					(yyval.node) = (Node *) n;
+				}
+#line 12190 "ora_gram.c"
+    break;
+
+  case 384: /* ColConstraint: ColConstraintElem  */
+#line 2561 "ora_gram.y"
+                                                                                        { (yyval.node) = (yyvsp[0].node); }
+#line 12196 "ora_gram.c"
+    break;
+
+  case 385: /* ColConstraint: ConstraintAttr  */
+#line 2562 "ora_gram.y"
+                                                                                        { (yyval.node) = (yyvsp[0].node); }
+#line 12202 "ora_gram.c"
+    break;
+
+  case 386: /* ColConstraint: COLLATE any_name  */
+#line 2564 "ora_gram.y"
+                                {
+					/*
+					 * Note: the CollateClause is momentarily included in
+					 * the list built by ColQualList, but we split it out
+					 * again in SplitColQualList.
+					 */
+					CollateClause *n = makeNode(CollateClause);
+					n->arg = NULL;
+					n->collname = (yyvsp[0].list);
+					n->location = (yylsp[-1]);
+					(yyval.node) = (Node *) n;
+				}
+#line 12219 "ora_gram.c"
+    break;
+
+  case 387: /* any_name_list: any_name  */
+#line 2578 "ora_gram.y"
+                                                                { (yyval.list) = list_make1((yyvsp[0].list)); }
+#line 12225 "ora_gram.c"
+    break;
+
+  case 388: /* any_name_list: any_name_list ',' any_name  */
+#line 2579 "ora_gram.y"
+                                                        { (yyval.list) = lappend((yyvsp[-2].list),(yyvsp[0].list)); }
+#line 12231 "ora_gram.c"
+    break;
+
+  case 389: /* any_name: ColId  */
+#line 2582 "ora_gram.y"
+                                                                { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 12237 "ora_gram.c"
+    break;
+
+  case 390: /* any_name: ColId attrs  */
+#line 2583 "ora_gram.y"
+                                                                { (yyval.list) = lcons(makeString((yyvsp[-1].str)), (yyvsp[0].list)); }
+#line 12243 "ora_gram.c"
+    break;
+
+  case 391: /* attrs: '.' attr_name  */
+#line 2587 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 12249 "ora_gram.c"
+    break;
+
+  case 392: /* attrs: attrs '.' attr_name  */
+#line 2589 "ora_gram.y"
+                                        { (yyval.list) = lappend((yyvsp[-2].list), makeString((yyvsp[0].str))); }
+#line 12255 "ora_gram.c"
+    break;
+
+  case 393: /* ColConstraintElem: NOT NULL_P  */
+#line 2593 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_NOTNULL;
+					n->location = (yylsp[-1]);
+					(yyval.node) = (Node *)n;
+				}
+#line 12266 "ora_gram.c"
+    break;
+
+  case 394: /* ColConstraintElem: NULL_P  */
+#line 2600 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_NULL;
+					n->location = (yylsp[0]);
+					(yyval.node) = (Node *)n;
+				}
+#line 12277 "ora_gram.c"
+    break;
+
+  case 395: /* ColConstraintElem: UNIQUE opt_definition OptConsTableSpace  */
+#line 2607 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_UNIQUE;
+					n->location = (yylsp[-2]);
+					n->keys = NULL;
+					n->options = (yyvsp[-1].list);
+					n->indexname = NULL;
+					n->indexspace = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 12292 "ora_gram.c"
+    break;
+
+  case 396: /* ColConstraintElem: PRIMARY KEY opt_definition OptConsTableSpace  */
+#line 2618 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_PRIMARY;
+					n->location = (yylsp[-3]);
+					n->keys = NULL;
+					n->options = (yyvsp[-1].list);
+					n->indexname = NULL;
+					n->indexspace = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 12307 "ora_gram.c"
+    break;
+
+  case 397: /* ColConstraintElem: CHECK '(' a_expr ')' opt_no_inherit  */
+#line 2629 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_CHECK;
+					n->location = (yylsp[-4]);
+					n->is_no_inherit = (yyvsp[0].boolean);
+					n->raw_expr = (yyvsp[-2].node);
+					n->cooked_expr = NULL;
+					(yyval.node) = (Node *)n;
+				}
+#line 12321 "ora_gram.c"
+    break;
+
+  case 398: /* ColConstraintElem: DEFAULT b_expr  */
+#line 2639 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_DEFAULT;
+					n->location = (yylsp[-1]);
+					n->raw_expr = (yyvsp[0].node);
+					n->cooked_expr = NULL;
+					(yyval.node) = (Node *)n;
+				}
+#line 12334 "ora_gram.c"
+    break;
+
+  case 399: /* ColConstraintElem: REFERENCES qualified_name opt_column_list key_match key_actions  */
+#line 2648 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_FOREIGN;
+					n->location = (yylsp[-4]);
+					n->pktable			= (yyvsp[-3].range);
+					n->fk_attrs			= NIL;
+					n->pk_attrs			= (yyvsp[-2].list);
+					n->fk_matchtype		= (yyvsp[-1].ival);
+					n->fk_upd_action	= (char) ((yyvsp[0].ival) >> 8);
+					n->fk_del_action	= (char) ((yyvsp[0].ival) & 0xFF);
+					n->skip_validation  = false;
+					n->initially_valid  = true;
+					(yyval.node) = (Node *)n;
+				}
+#line 12353 "ora_gram.c"
+    break;
+
+  case 400: /* opt_definition: WITH definition  */
+#line 2664 "ora_gram.y"
+                                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 12359 "ora_gram.c"
+    break;
+
+  case 401: /* opt_definition: %empty  */
+#line 2665 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 12365 "ora_gram.c"
+    break;
+
+  case 402: /* definition: '(' def_list ')'  */
+#line 2667 "ora_gram.y"
+                                                                        { (yyval.list) = (yyvsp[-1].list); }
+#line 12371 "ora_gram.c"
+    break;
+
+  case 403: /* def_list: def_elem  */
+#line 2670 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].defelt)); }
+#line 12377 "ora_gram.c"
+    break;
+
+  case 404: /* def_list: def_list ',' def_elem  */
+#line 2671 "ora_gram.y"
+                                                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].defelt)); }
+#line 12383 "ora_gram.c"
+    break;
+
+  case 405: /* def_elem: ColLabel  */
+#line 2675 "ora_gram.y"
+                                {
+					(yyval.defelt) = makeDefElem((yyvsp[0].str), NULL);
+				}
+#line 12391 "ora_gram.c"
+    break;
+
+  case 406: /* OptConsTableSpace: USING INDEX TABLESPACE name  */
+#line 2681 "ora_gram.y"
+                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 12397 "ora_gram.c"
+    break;
+
+  case 407: /* OptConsTableSpace: %empty  */
+#line 2682 "ora_gram.y"
+                                                                                                { (yyval.str) = NULL; }
+#line 12403 "ora_gram.c"
+    break;
+
+  case 408: /* opt_no_inherit: NO INHERIT  */
+#line 2685 "ora_gram.y"
+                                                                                {  (yyval.boolean) = TRUE; }
+#line 12409 "ora_gram.c"
+    break;
+
+  case 409: /* opt_no_inherit: %empty  */
+#line 2686 "ora_gram.y"
+                                                                                        {  (yyval.boolean) = FALSE; }
+#line 12415 "ora_gram.c"
+    break;
+
+  case 410: /* opt_column_list: '(' columnList ')'  */
+#line 2689 "ora_gram.y"
+                                                                                        { (yyval.list) = (yyvsp[-1].list); }
+#line 12421 "ora_gram.c"
+    break;
+
+  case 411: /* opt_column_list: %empty  */
+#line 2690 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 12427 "ora_gram.c"
+    break;
+
+  case 412: /* columnList: columnElem  */
+#line 2694 "ora_gram.y"
+                                                                                                { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 12433 "ora_gram.c"
+    break;
+
+  case 413: /* columnList: columnList ',' columnElem  */
+#line 2695 "ora_gram.y"
+                                                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 12439 "ora_gram.c"
+    break;
+
+  case 414: /* columnElem: ColId  */
+#line 2699 "ora_gram.y"
+                                {
+					(yyval.node) = (Node *) makeString((yyvsp[0].str));
+				}
+#line 12447 "ora_gram.c"
+    break;
+
+  case 415: /* key_match: MATCH FULL  */
+#line 2705 "ora_gram.y"
+                        {
+				(yyval.ival) = FKCONSTR_MATCH_FULL;
+			}
+#line 12455 "ora_gram.c"
+    break;
+
+  case 416: /* key_match: MATCH PARTIAL  */
+#line 2709 "ora_gram.y"
+                        {
+				ereport(ERROR,
+						(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+						 errmsg("MATCH PARTIAL not yet implemented"),
+						 parser_errposition((yylsp[-1]))));
+				(yyval.ival) = FKCONSTR_MATCH_PARTIAL;
+			}
+#line 12467 "ora_gram.c"
+    break;
+
+  case 417: /* key_match: MATCH SIMPLE  */
+#line 2717 "ora_gram.y"
+                        {
+				(yyval.ival) = FKCONSTR_MATCH_SIMPLE;
+			}
+#line 12475 "ora_gram.c"
+    break;
+
+  case 418: /* key_match: %empty  */
+#line 2721 "ora_gram.y"
+                        {
+				(yyval.ival) = FKCONSTR_MATCH_SIMPLE;
+			}
+#line 12483 "ora_gram.c"
+    break;
+
+  case 419: /* key_actions: key_update  */
+#line 2734 "ora_gram.y"
+                                { (yyval.ival) = ((yyvsp[0].ival) << 8) | (FKCONSTR_ACTION_NOACTION & 0xFF); }
+#line 12489 "ora_gram.c"
+    break;
+
+  case 420: /* key_actions: key_delete  */
+#line 2736 "ora_gram.y"
+                                { (yyval.ival) = (FKCONSTR_ACTION_NOACTION << 8) | ((yyvsp[0].ival) & 0xFF); }
+#line 12495 "ora_gram.c"
+    break;
+
+  case 421: /* key_actions: key_update key_delete  */
+#line 2738 "ora_gram.y"
+                                { (yyval.ival) = ((yyvsp[-1].ival) << 8) | ((yyvsp[0].ival) & 0xFF); }
+#line 12501 "ora_gram.c"
+    break;
+
+  case 422: /* key_actions: key_delete key_update  */
+#line 2740 "ora_gram.y"
+                                { (yyval.ival) = ((yyvsp[0].ival) << 8) | ((yyvsp[-1].ival) & 0xFF); }
+#line 12507 "ora_gram.c"
+    break;
+
+  case 423: /* key_actions: %empty  */
+#line 2742 "ora_gram.y"
+                                { (yyval.ival) = (FKCONSTR_ACTION_NOACTION << 8) | (FKCONSTR_ACTION_NOACTION & 0xFF); }
+#line 12513 "ora_gram.c"
+    break;
+
+  case 424: /* key_update: ON UPDATE key_action  */
+#line 2745 "ora_gram.y"
+                                                { (yyval.ival) = (yyvsp[0].ival); }
+#line 12519 "ora_gram.c"
+    break;
+
+  case 425: /* key_delete: ON DELETE_P key_action  */
+#line 2748 "ora_gram.y"
+                                                { (yyval.ival) = (yyvsp[0].ival); }
+#line 12525 "ora_gram.c"
+    break;
+
+  case 426: /* key_action: NO ACTION  */
+#line 2752 "ora_gram.y"
+                                                                        { (yyval.ival) = FKCONSTR_ACTION_NOACTION; }
+#line 12531 "ora_gram.c"
+    break;
+
+  case 427: /* key_action: RESTRICT  */
+#line 2753 "ora_gram.y"
+                                                                        { (yyval.ival) = FKCONSTR_ACTION_RESTRICT; }
+#line 12537 "ora_gram.c"
+    break;
+
+  case 428: /* key_action: CASCADE  */
+#line 2754 "ora_gram.y"
+                                                                        { (yyval.ival) = FKCONSTR_ACTION_CASCADE; }
+#line 12543 "ora_gram.c"
+    break;
+
+  case 429: /* key_action: SET NULL_P  */
+#line 2755 "ora_gram.y"
+                                                                { (yyval.ival) = FKCONSTR_ACTION_SETNULL; }
+#line 12549 "ora_gram.c"
+    break;
+
+  case 430: /* key_action: SET DEFAULT  */
+#line 2756 "ora_gram.y"
+                                                                { (yyval.ival) = FKCONSTR_ACTION_SETDEFAULT; }
+#line 12555 "ora_gram.c"
+    break;
+
+  case 431: /* ConstraintAttr: DEFERRABLE  */
+#line 2761 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_ATTR_DEFERRABLE;
+					n->location = (yylsp[0]);
+					(yyval.node) = (Node *)n;
+				}
+#line 12566 "ora_gram.c"
+    break;
+
+  case 432: /* ConstraintAttr: NOT DEFERRABLE  */
+#line 2768 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_ATTR_NOT_DEFERRABLE;
+					n->location = (yylsp[-1]);
+					(yyval.node) = (Node *)n;
+				}
+#line 12577 "ora_gram.c"
+    break;
+
+  case 433: /* ConstraintAttr: INITIALLY DEFERRED  */
+#line 2775 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_ATTR_DEFERRED;
+					n->location = (yylsp[-1]);
+					(yyval.node) = (Node *)n;
+				}
+#line 12588 "ora_gram.c"
+    break;
+
+  case 434: /* ConstraintAttr: INITIALLY IMMEDIATE  */
+#line 2782 "ora_gram.y"
+                                {
+					Constraint *n = makeNode(Constraint);
+					n->contype = CONSTR_ATTR_IMMEDIATE;
+					n->location = (yylsp[-1]);
+					(yyval.node) = (Node *)n;
+				}
+#line 12599 "ora_gram.c"
+    break;
+
+  case 435: /* columnref: ColId  */
+#line 2791 "ora_gram.y"
+                                {
+					(yyval.node) = makeColumnRef((yyvsp[0].str), NIL, (yylsp[0]), yyscanner);
+				}
+#line 12607 "ora_gram.c"
+    break;
+
+  case 436: /* columnref: ROWID  */
+#line 2795 "ora_gram.y"
+                                {
+					(yyval.node) = makeColumnRef(pstrdup((yyvsp[0].keyword)), NIL, (yylsp[0]), yyscanner);
+				}
+#line 12615 "ora_gram.c"
+    break;
+
+  case 437: /* columnref: LEVEL  */
+#line 2799 "ora_gram.y"
+                                {
+					LevelExpr *n = makeNode(LevelExpr);
+					n->location = (yylsp[0]);
+					(yyval.node) = (Node*)n;
+				}
+#line 12625 "ora_gram.c"
+    break;
+
+  case 438: /* columnref: ColId indirection  */
+#line 2805 "ora_gram.y"
+                                {
+					(yyval.node) = makeColumnRef((yyvsp[-1].str), (yyvsp[0].list), (yylsp[-1]), yyscanner);
+				}
+#line 12633 "ora_gram.c"
+    break;
+
+  case 439: /* columnref: columnref ORACLE_JOIN_OP  */
+#line 2809 "ora_gram.y"
+                                {
+					ColumnRefJoin *n = makeNode(ColumnRefJoin);
+					n->column = (ColumnRef*)(yyvsp[-1].node);
+					n->location = (yylsp[0]);
+					(yyval.node) = (Node*)n;
+				}
+#line 12644 "ora_gram.c"
+    break;
+
+  case 440: /* ConstInterval: INTERVAL  */
+#line 2818 "ora_gram.y"
+                                { (yyval.typnam) = SystemTypeNameLocation("interval", (yylsp[0])); }
+#line 12650 "ora_gram.c"
+    break;
+
+  case 441: /* ConstDatetime: DATE_P  */
+#line 2823 "ora_gram.y"
+                { 
+	  		(yyval.typnam) = OracleTypeNameLocation("date", (yylsp[0]));
+	  	}
+#line 12658 "ora_gram.c"
+    break;
+
+  case 442: /* ConstDatetime: TIMESTAMP opt_type_mod  */
+#line 2827 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("timestamp", (yylsp[-1]));
+			(yyval.typnam)->typmods = (yyvsp[0].list);
+		}
+#line 12667 "ora_gram.c"
+    break;
+
+  case 443: /* ConstDatetime: TIMESTAMP opt_type_mod WITH TIME ZONE  */
+#line 2832 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("timestamptz", (yylsp[-4]));
+			(yyval.typnam)->typmods = (yyvsp[-3].list);
+		}
+#line 12676 "ora_gram.c"
+    break;
+
+  case 444: /* ConstDatetime: TIMESTAMP opt_type_mod WITH LOCAL TIME ZONE  */
+#line 2837 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("timestamptz", (yylsp[-5]));
+			(yyval.typnam)->typmods = (yyvsp[-4].list);
+		}
+#line 12685 "ora_gram.c"
+    break;
+
+  case 445: /* ConstTypename: Numeric  */
+#line 2855 "ora_gram.y"
+                                                                                                { (yyval.typnam) = (yyvsp[0].typnam); }
+#line 12691 "ora_gram.c"
+    break;
+
+  case 446: /* ConstTypename: ConstDatetime  */
+#line 2858 "ora_gram.y"
+                                                                                        { (yyval.typnam) = (yyvsp[0].typnam); }
+#line 12697 "ora_gram.c"
+    break;
+
+  case 447: /* CreateStmt: CREATE OptTemp TABLE qualified_name '(' OptTableElementList ')' OptInherit OptWith OnCommitOption OptTableSpace OptDistributeBy OptSubCluster  */
+#line 2880 "ora_gram.y"
+                                {
+					CreateStmt *n = makeNode(CreateStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					(yyvsp[-9].range)->relpersistence = (yyvsp[-11].ival);
+					n->relation = (yyvsp[-9].range);
+					n->tableElts = (yyvsp[-7].list);
+					n->inhRelations = (yyvsp[-5].list);
+					n->constraints = NIL;
+					n->options = (yyvsp[-4].list);
+					n->oncommit = (yyvsp[-3].oncommit);
+					n->tablespacename = (yyvsp[-2].str);
+					n->if_not_exists = false;
+/* PGXC_BEGIN */
+					n->distributeby = (yyvsp[-1].distby);
+					n->subcluster = (yyvsp[0].subclus);
+/* PGXC_END */
+					(yyval.node) = (Node *)n;
+				}
+#line 12720 "ora_gram.c"
+    break;
+
+  case 448: /* CreateStmt: CREATE OptTemp TABLE IF_P NOT EXISTS qualified_name '(' OptTableElementList ')' OptInherit OptWith OnCommitOption OptTableSpace OptDistributeBy OptSubCluster  */
+#line 2904 "ora_gram.y"
+                                {
+					CreateStmt *n = makeNode(CreateStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					(yyvsp[-9].range)->relpersistence = (yyvsp[-14].ival);
+					n->relation = (yyvsp[-9].range);
+					n->tableElts = (yyvsp[-7].list);
+					n->inhRelations = (yyvsp[-5].list);
+					n->constraints = NIL;
+					n->options = (yyvsp[-4].list);
+					n->oncommit = (yyvsp[-3].oncommit);
+					n->tablespacename = (yyvsp[-2].str);
+					n->if_not_exists = true;
+/* PGXC_BEGIN */
+					n->distributeby = (yyvsp[-1].distby);
+					n->subcluster = (yyvsp[0].subclus);
+					if (n->inhRelations != NULL && n->distributeby != NULL)
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("CREATE TABLE cannot contains both an INHERITS and a DISTRIBUTE BY clause"),
+								 parser_errposition(exprLocation((Node *) n->distributeby))));
+/* PGXC_END */
+					(yyval.node) = (Node *)n;
+				}
+#line 12748 "ora_gram.c"
+    break;
+
+  case 449: /* CreateStmt: CREATE OptTemp TABLE qualified_name OF any_name OptTypedTableElementList OptWith OnCommitOption OptTableSpace OptDistributeBy OptSubCluster  */
+#line 2932 "ora_gram.y"
+                                {
+					CreateStmt *n = makeNode(CreateStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					(yyvsp[-8].range)->relpersistence = (yyvsp[-10].ival);
+					n->relation = (yyvsp[-8].range);
+					n->tableElts = (yyvsp[-5].list);
+					n->ofTypename = makeTypeNameFromNameList((yyvsp[-6].list));
+					n->ofTypename->location = (yylsp[-6]);
+					n->constraints = NIL;
+					n->options = (yyvsp[-4].list);
+					n->oncommit = (yyvsp[-3].oncommit);
+					n->tablespacename = (yyvsp[-2].str);
+					n->if_not_exists = false;
+/* PGXC_BEGIN */
+					n->distributeby = (yyvsp[-1].distby);
+					n->subcluster = (yyvsp[0].subclus);
+					if (n->inhRelations != NULL && n->distributeby != NULL)
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("CREATE TABLE cannot contains both an INHERITS and a DISTRIBUTE BY clause"),
+								 parser_errposition(exprLocation((Node *) n->distributeby))));
+/* PGXC_END */
+					(yyval.node) = (Node *)n;
+				}
+#line 12777 "ora_gram.c"
+    break;
+
+  case 450: /* CreateStmt: CREATE OptTemp TABLE IF_P NOT EXISTS qualified_name OF any_name OptTypedTableElementList OptWith OnCommitOption OptTableSpace OptDistributeBy OptSubCluster  */
+#line 2961 "ora_gram.y"
+                                {
+					CreateStmt *n = makeNode(CreateStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					(yyvsp[-8].range)->relpersistence = (yyvsp[-13].ival);
+					n->relation = (yyvsp[-8].range);
+					n->tableElts = (yyvsp[-5].list);
+					n->ofTypename = makeTypeNameFromNameList((yyvsp[-6].list));
+					n->ofTypename->location = (yylsp[-6]);
+					n->constraints = NIL;
+					n->options = (yyvsp[-4].list);
+					n->oncommit = (yyvsp[-3].oncommit);
+					n->tablespacename = (yyvsp[-2].str);
+					n->if_not_exists = true;
+/* PGXC_BEGIN */
+					n->distributeby = (yyvsp[-1].distby);
+					n->subcluster = (yyvsp[0].subclus);
+					if (n->inhRelations != NULL && n->distributeby != NULL)
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("CREATE TABLE cannot contains both an INHERITS and a DISTRIBUTE BY clause"),
+								 parser_errposition(exprLocation((Node *) n->distributeby))));
+/* PGXC_END */
+					(yyval.node) = (Node *)n;
+				}
+#line 12806 "ora_gram.c"
+    break;
+
+  case 451: /* OptTemp: TEMPORARY  */
+#line 2998 "ora_gram.y"
+                                                                { (yyval.ival) = RELPERSISTENCE_TEMP; }
+#line 12812 "ora_gram.c"
+    break;
+
+  case 452: /* OptTemp: TEMP  */
+#line 2999 "ora_gram.y"
+                                                                        { (yyval.ival) = RELPERSISTENCE_TEMP; }
+#line 12818 "ora_gram.c"
+    break;
+
+  case 453: /* OptTemp: LOCAL TEMPORARY  */
+#line 3000 "ora_gram.y"
+                                                                { (yyval.ival) = RELPERSISTENCE_TEMP; }
+#line 12824 "ora_gram.c"
+    break;
+
+  case 454: /* OptTemp: LOCAL TEMP  */
+#line 3001 "ora_gram.y"
+                                                                { (yyval.ival) = RELPERSISTENCE_TEMP; }
+#line 12830 "ora_gram.c"
+    break;
+
+  case 455: /* OptTemp: GLOBAL TEMPORARY  */
+#line 3003 "ora_gram.y"
+                                {
+					/*ereport(WARNING,
+							(errmsg("GLOBAL is deprecated in temporary table creation"),
+							 parser_errposition(@1))); */
+					(yyval.ival) = RELPERSISTENCE_TEMP;
+				}
+#line 12841 "ora_gram.c"
+    break;
+
+  case 456: /* OptTemp: GLOBAL TEMP  */
+#line 3010 "ora_gram.y"
+                                {
+					/* ereport(WARNING,
+							(errmsg("GLOBAL is deprecated in temporary table creation"),
+							 parser_errposition(@1))); */
+					(yyval.ival) = RELPERSISTENCE_TEMP;
+				}
+#line 12852 "ora_gram.c"
+    break;
+
+  case 457: /* OptTemp: UNLOGGED  */
+#line 3016 "ora_gram.y"
+                                                                        { (yyval.ival) = RELPERSISTENCE_UNLOGGED; }
+#line 12858 "ora_gram.c"
+    break;
+
+  case 458: /* OptTemp: %empty  */
+#line 3017 "ora_gram.y"
+                                                                        { (yyval.ival) = RELPERSISTENCE_PERMANENT; }
+#line 12864 "ora_gram.c"
+    break;
+
+  case 459: /* OptInherit: INHERITS '(' qualified_name_list ')'  */
+#line 3020 "ora_gram.y"
+                                                        { (yyval.list) = (yyvsp[-1].list); }
+#line 12870 "ora_gram.c"
+    break;
+
+  case 460: /* OptInherit: %empty  */
+#line 3021 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 12876 "ora_gram.c"
+    break;
+
+  case 461: /* create_generic_options: %empty  */
+#line 3025 "ora_gram.y"
+                                                                { (yyval.list) = NIL; }
+#line 12882 "ora_gram.c"
+    break;
+
+  case 462: /* cte_list: common_table_expr  */
+#line 3029 "ora_gram.y"
+                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 12888 "ora_gram.c"
+    break;
+
+  case 463: /* cte_list: cte_list ',' common_table_expr  */
+#line 3030 "ora_gram.y"
+                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 12894 "ora_gram.c"
+    break;
+
+  case 464: /* OptWith: WITH reloptions  */
+#line 3035 "ora_gram.y"
+                                                                { (yyval.list) = (yyvsp[0].list); }
+#line 12900 "ora_gram.c"
+    break;
+
+  case 465: /* OptWith: WITH OIDS  */
+#line 3036 "ora_gram.y"
+                                                                        { (yyval.list) = list_make1(defWithOids(true)); }
+#line 12906 "ora_gram.c"
+    break;
+
+  case 466: /* OptWith: WITHOUT OIDS  */
+#line 3037 "ora_gram.y"
+                                                                { (yyval.list) = list_make1(defWithOids(false)); }
+#line 12912 "ora_gram.c"
+    break;
+
+  case 467: /* OptWith: %empty  */
+#line 3038 "ora_gram.y"
+                                                                        { (yyval.list) = NIL; }
+#line 12918 "ora_gram.c"
+    break;
+
+  case 468: /* OnCommitOption: ON COMMIT DROP  */
+#line 3041 "ora_gram.y"
+                                                        { (yyval.oncommit) = ONCOMMIT_DROP; }
+#line 12924 "ora_gram.c"
+    break;
+
+  case 469: /* OnCommitOption: ON COMMIT DELETE_P ROWS  */
+#line 3042 "ora_gram.y"
+                                                                { (yyval.oncommit) = ONCOMMIT_DELETE_ROWS; }
+#line 12930 "ora_gram.c"
+    break;
+
+  case 470: /* OnCommitOption: ON COMMIT PRESERVE ROWS  */
+#line 3043 "ora_gram.y"
+                                                                { (yyval.oncommit) = ONCOMMIT_PRESERVE_ROWS; }
+#line 12936 "ora_gram.c"
+    break;
+
+  case 471: /* OnCommitOption: %empty  */
+#line 3044 "ora_gram.y"
+                                                                                { (yyval.oncommit) = ONCOMMIT_NOOP; }
+#line 12942 "ora_gram.c"
+    break;
+
+  case 472: /* OptDistributeBy: OptDistributeByInternal  */
+#line 3047 "ora_gram.y"
+                                                                { (yyval.distby) = (yyvsp[0].distby); }
+#line 12948 "ora_gram.c"
+    break;
+
+  case 473: /* OptDistributeBy: %empty  */
+#line 3048 "ora_gram.y"
+                                                                                        { (yyval.distby) = NULL; }
+#line 12954 "ora_gram.c"
+    break;
+
+  case 474: /* OptTypedTableElementList: '(' TypedTableElementList ')'  */
+#line 3052 "ora_gram.y"
+                                                                { (yyval.list) = (yyvsp[-1].list); }
+#line 12960 "ora_gram.c"
+    break;
+
+  case 475: /* OptTypedTableElementList: %empty  */
+#line 3053 "ora_gram.y"
+                                                                                        { (yyval.list) = NIL; }
+#line 12966 "ora_gram.c"
+    break;
+
+  case 476: /* TypedTableElementList: TypedTableElement  */
+#line 3058 "ora_gram.y"
+                                {
+					(yyval.list) = list_make1((yyvsp[0].node));
+				}
+#line 12974 "ora_gram.c"
+    break;
+
+  case 477: /* TypedTableElementList: TypedTableElementList ',' TypedTableElement  */
+#line 3062 "ora_gram.y"
+                                {
+					(yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node));
+				}
+#line 12982 "ora_gram.c"
+    break;
+
+  case 478: /* TypedTableElement: columnOptions  */
+#line 3068 "ora_gram.y"
+                                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 12988 "ora_gram.c"
+    break;
+
+  case 479: /* TypedTableElement: TableConstraint  */
+#line 3069 "ora_gram.y"
+                                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 12994 "ora_gram.c"
+    break;
+
+  case 480: /* columnOptions: ColId WITH OPTIONS ColQualList  */
+#line 3073 "ora_gram.y"
+                                {
+					ColumnDef *n = makeNode(ColumnDef);
+					n->colname = (yyvsp[-3].str);
+					n->typeName = NULL;
+					n->inhcount = 0;
+					n->is_local = true;
+					n->is_not_null = false;
+					n->is_from_type = false;
+					n->storage = 0;
+					n->raw_default = NULL;
+					n->cooked_default = NULL;
+					n->collOid = InvalidOid;
+					SplitColQualList((yyvsp[0].list), &n->constraints, &n->collClause,
+									 yyscanner);
+					(yyval.node) = (Node *)n;
+				}
+#line 13015 "ora_gram.c"
+    break;
+
+  case 481: /* ctext_expr: a_expr  */
+#line 3100 "ora_gram.y"
+                                                        { (yyval.node) = (Node *) (yyvsp[0].node); }
+#line 13021 "ora_gram.c"
+    break;
+
+  case 482: /* ctext_expr: DEFAULT  */
+#line 3102 "ora_gram.y"
+                        {
+				SetToDefault *n = makeNode(SetToDefault);
+				n->location = (yylsp[0]);
+				(yyval.node) = (Node *) n;
+			}
+#line 13031 "ora_gram.c"
+    break;
+
+  case 483: /* ctext_expr_list: ctext_expr  */
+#line 3110 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 13037 "ora_gram.c"
+    break;
+
+  case 484: /* ctext_expr_list: ctext_expr_list ',' ctext_expr  */
+#line 3111 "ora_gram.y"
+                                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 13043 "ora_gram.c"
+    break;
+
+  case 485: /* ctext_row: '(' ctext_expr_list ')'  */
+#line 3114 "ora_gram.y"
+                                                                        { (yyval.list) = (yyvsp[-1].list); }
+#line 13049 "ora_gram.c"
+    break;
+
+  case 486: /* DeleteStmt: opt_with_clause DELETE_P opt_from relation_expr opt_alias_clause where_clause returning_clause  */
+#line 3120 "ora_gram.y"
+                {
+			(yyval.node) = makeDeleteStmt((yyvsp[-3].range), (yyvsp[-2].alias), (yyvsp[-6].with), (yyvsp[-1].node), (yyvsp[0].list));
+		}
+#line 13057 "ora_gram.c"
+    break;
+
+  case 487: /* document_or_content: DOCUMENT_P  */
+#line 3134 "ora_gram.y"
+                                                                        { (yyval.ival) = XMLOPTION_DOCUMENT; }
+#line 13063 "ora_gram.c"
+    break;
+
+  case 488: /* document_or_content: CONTENT_P  */
+#line 3135 "ora_gram.y"
+                                                                                                { (yyval.ival) = XMLOPTION_CONTENT; }
+#line 13069 "ora_gram.c"
+    break;
+
+  case 489: /* DropStmt: DROP drop_type IF_P EXISTS any_name_list opt_drop_behavior DropStmt_opt_purge  */
+#line 3140 "ora_gram.y"
+            {
+	    	DropStmt *n = makeNode(DropStmt);
+	    	n->removeType = (yyvsp[-5].objtype);
+	    	n->missing_ok = TRUE;
+	    	n->objects = (yyvsp[-2].list);
+	    	n->arguments = NIL;
+	    	n->behavior = (yyvsp[-1].dbehavior);
+	    	n->concurrent = false;
+	    	(yyval.node) = (Node *)n;
+		}
+#line 13084 "ora_gram.c"
+    break;
+
+  case 490: /* DropStmt: DROP drop_type any_name_list opt_drop_behavior DropStmt_opt_purge  */
+#line 3151 "ora_gram.y"
+        {
+    		DropStmt *n = makeNode(DropStmt);
+    		n->removeType = (yyvsp[-3].objtype);
+    		n->missing_ok = FALSE;
+    		n->objects = (yyvsp[-2].list);
+    		n->arguments = NIL;
+    		n->behavior = (yyvsp[-1].dbehavior);
+    		n->concurrent = false;
+    		(yyval.node) = (Node *)n;
+    	}
+#line 13099 "ora_gram.c"
+    break;
+
+  case 491: /* DropStmt: DROP INDEX CONCURRENTLY any_name_list opt_drop_behavior  */
+#line 3162 "ora_gram.y"
+        {
+    		DropStmt *n = makeNode(DropStmt);
+    		n->removeType = OBJECT_INDEX;
+    		n->missing_ok = FALSE;
+    		n->objects = (yyvsp[-1].list);
+    		n->arguments = NIL;
+    		n->behavior = (yyvsp[0].dbehavior);
+    		n->concurrent = true;
+    		(yyval.node) = (Node *)n;
+    	}
+#line 13114 "ora_gram.c"
+    break;
+
+  case 492: /* DropStmt: DROP INDEX CONCURRENTLY IF_P EXISTS any_name_list opt_drop_behavior  */
+#line 3173 "ora_gram.y"
+        {
+    		DropStmt *n = makeNode(DropStmt);
+    		n->removeType = OBJECT_INDEX;
+    		n->missing_ok = TRUE;
+    		n->objects = (yyvsp[-1].list);
+    		n->arguments = NIL;
+    		n->behavior = (yyvsp[0].dbehavior);
+    		n->concurrent = true;
+    		(yyval.node) = (Node *)n;
+    	}
+#line 13129 "ora_gram.c"
+    break;
+
+  case 493: /* drop_type: TABLE  */
+#line 3186 "ora_gram.y"
+                                                                                        { (yyval.objtype) = OBJECT_TABLE; }
+#line 13135 "ora_gram.c"
+    break;
+
+  case 494: /* drop_type: SEQUENCE  */
+#line 3187 "ora_gram.y"
+                                                                                                { (yyval.objtype) = OBJECT_SEQUENCE; }
+#line 13141 "ora_gram.c"
+    break;
+
+  case 495: /* drop_type: VIEW  */
+#line 3188 "ora_gram.y"
+                                                                                                { (yyval.objtype) = OBJECT_VIEW; }
+#line 13147 "ora_gram.c"
+    break;
+
+  case 496: /* drop_type: MATERIALIZED VIEW  */
+#line 3189 "ora_gram.y"
+                                                                                        { (yyval.objtype) = OBJECT_MATVIEW; }
+#line 13153 "ora_gram.c"
+    break;
+
+  case 497: /* drop_type: INDEX  */
+#line 3190 "ora_gram.y"
+                                                                                                { (yyval.objtype) = OBJECT_INDEX; }
+#line 13159 "ora_gram.c"
+    break;
+
+  case 498: /* drop_type: FOREIGN TABLE  */
+#line 3191 "ora_gram.y"
+                                                                                        { (yyval.objtype) = OBJECT_FOREIGN_TABLE; }
+#line 13165 "ora_gram.c"
+    break;
+
+  case 499: /* drop_type: EVENT TRIGGER  */
+#line 3192 "ora_gram.y"
+                                                                                        { (yyval.objtype) = OBJECT_EVENT_TRIGGER; }
+#line 13171 "ora_gram.c"
+    break;
+
+  case 500: /* drop_type: TYPE_P  */
+#line 3193 "ora_gram.y"
+                                                                                                { (yyval.objtype) = OBJECT_TYPE; }
+#line 13177 "ora_gram.c"
+    break;
+
+  case 501: /* drop_type: DOMAIN_P  */
+#line 3194 "ora_gram.y"
+                                                                                                { (yyval.objtype) = OBJECT_DOMAIN; }
+#line 13183 "ora_gram.c"
+    break;
+
+  case 502: /* drop_type: COLLATION  */
+#line 3195 "ora_gram.y"
+                                                                                                { (yyval.objtype) = OBJECT_COLLATION; }
+#line 13189 "ora_gram.c"
+    break;
+
+  case 503: /* drop_type: CONVERSION_P  */
+#line 3196 "ora_gram.y"
+                                                                                        { (yyval.objtype) = OBJECT_CONVERSION; }
+#line 13195 "ora_gram.c"
+    break;
+
+  case 504: /* drop_type: SCHEMA  */
+#line 3197 "ora_gram.y"
+                                                                                                { (yyval.objtype) = OBJECT_SCHEMA; }
+#line 13201 "ora_gram.c"
+    break;
+
+  case 505: /* drop_type: EXTENSION  */
+#line 3198 "ora_gram.y"
+                                                                                                { (yyval.objtype) = OBJECT_EXTENSION; }
+#line 13207 "ora_gram.c"
+    break;
+
+  case 506: /* drop_type: TEXT_P SEARCH PARSER  */
+#line 3199 "ora_gram.y"
+                                                                                { (yyval.objtype) = OBJECT_TSPARSER; }
+#line 13213 "ora_gram.c"
+    break;
+
+  case 507: /* drop_type: TEXT_P SEARCH DICTIONARY  */
+#line 3200 "ora_gram.y"
+                                                                                { (yyval.objtype) = OBJECT_TSDICTIONARY; }
+#line 13219 "ora_gram.c"
+    break;
+
+  case 508: /* drop_type: TEXT_P SEARCH TEMPLATE  */
+#line 3201 "ora_gram.y"
+                                                                                { (yyval.objtype) = OBJECT_TSTEMPLATE; }
+#line 13225 "ora_gram.c"
+    break;
+
+  case 509: /* drop_type: TEXT_P SEARCH CONFIGURATION  */
+#line 3202 "ora_gram.y"
+                                                                        { (yyval.objtype) = OBJECT_TSCONFIGURATION; }
+#line 13231 "ora_gram.c"
+    break;
+
+  case 512: /* ExplainStmt: EXPLAIN ExplainableStmt  */
+#line 3212 "ora_gram.y"
+                {
+			ExplainStmt *n = makeNode(ExplainStmt);
+			n->query = (yyvsp[0].node);
+			n->options = NIL;
+			(yyval.node) = (Node *) n;
+		}
+#line 13242 "ora_gram.c"
+    break;
+
+  case 513: /* ExplainStmt: EXPLAIN analyze_keyword opt_verbose ExplainableStmt  */
+#line 3219 "ora_gram.y"
+                {
+			ExplainStmt *n = makeNode(ExplainStmt);
+			n->query = (yyvsp[0].node);
+			n->options = list_make1(makeDefElem("analyze", NULL));
+			if ((yyvsp[-1].boolean))
+				n->options = lappend(n->options,
+									 makeDefElem("verbose", NULL));
+			(yyval.node) = (Node *) n;
+		}
+#line 13256 "ora_gram.c"
+    break;
+
+  case 514: /* ExplainStmt: EXPLAIN VERBOSE ExplainableStmt  */
+#line 3229 "ora_gram.y"
+                {
+			ExplainStmt *n = makeNode(ExplainStmt);
+			n->query = (yyvsp[0].node);
+			n->options = list_make1(makeDefElem("verbose", NULL));
+			(yyval.node) = (Node *) n;
+		}
+#line 13267 "ora_gram.c"
+    break;
+
+  case 515: /* ExplainStmt: EXPLAIN '(' explain_option_list ')' ExplainableStmt  */
+#line 3236 "ora_gram.y"
+                {
+			ExplainStmt *n = makeNode(ExplainStmt);
+			n->query = (yyvsp[0].node);
+			n->options = (yyvsp[-2].list);
+			(yyval.node) = (Node *) n;
+		}
+#line 13278 "ora_gram.c"
+    break;
+
+  case 520: /* explain_option_list: explain_option_elem  */
+#line 3253 "ora_gram.y"
+                {
+			(yyval.list) = list_make1((yyvsp[0].defelt));
+		}
+#line 13286 "ora_gram.c"
+    break;
+
+  case 521: /* explain_option_list: explain_option_list ',' explain_option_elem  */
+#line 3257 "ora_gram.y"
+                {
+			(yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].defelt));
+		}
+#line 13294 "ora_gram.c"
+    break;
+
+  case 522: /* explain_option_elem: explain_option_name explain_option_arg  */
+#line 3264 "ora_gram.y"
+                {
+			(yyval.defelt) = makeDefElem((yyvsp[-1].str), (yyvsp[0].node));
+		}
+#line 13302 "ora_gram.c"
+    break;
+
+  case 523: /* explain_option_name: NonReservedWord  */
+#line 3271 "ora_gram.y"
+        {
+		if(strcmp((yyvsp[0].str), "analyse") == 0)
+			(yyval.str) = "analyze";
+		else
+			(yyval.str) = (yyvsp[0].str);
+	}
+#line 13313 "ora_gram.c"
+    break;
+
+  case 524: /* explain_option_arg: opt_boolean_or_string  */
+#line 3280 "ora_gram.y"
+                                        { (yyval.node) = (Node *) makeString((yyvsp[0].str)); }
+#line 13319 "ora_gram.c"
+    break;
+
+  case 525: /* explain_option_arg: NumericOnly  */
+#line 3281 "ora_gram.y"
+                                                { (yyval.node) = (Node *) (yyvsp[0].value); }
+#line 13325 "ora_gram.c"
+    break;
+
+  case 526: /* explain_option_arg: %empty  */
+#line 3282 "ora_gram.y"
+                                                { (yyval.node) = NULL; }
+#line 13331 "ora_gram.c"
+    break;
+
+  case 527: /* expr_list: a_expr  */
+#line 3285 "ora_gram.y"
+                  { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 13337 "ora_gram.c"
+    break;
+
+  case 528: /* expr_list: expr_list ',' a_expr  */
+#line 3287 "ora_gram.y"
+                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 13343 "ora_gram.c"
+    break;
+
+  case 529: /* trim_list: a_expr FROM expr_list  */
+#line 3290 "ora_gram.y"
+                                                                        { (yyval.list) = lappend((yyvsp[0].list), (yyvsp[-2].node)); }
+#line 13349 "ora_gram.c"
+    break;
+
+  case 530: /* trim_list: FROM expr_list  */
+#line 3291 "ora_gram.y"
+                                                                                { (yyval.list) = (yyvsp[0].list); }
+#line 13355 "ora_gram.c"
+    break;
+
+  case 531: /* trim_list: expr_list  */
+#line 3292 "ora_gram.y"
+                                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 13361 "ora_gram.c"
+    break;
+
+  case 532: /* from_clause: FROM from_list  */
+#line 3295 "ora_gram.y"
+                                                { (yyval.list) = (yyvsp[0].list); }
+#line 13367 "ora_gram.c"
+    break;
+
+  case 533: /* from_clause: %empty  */
+#line 3296 "ora_gram.y"
+                                      { (yyval.list) = NIL; }
+#line 13373 "ora_gram.c"
+    break;
+
+  case 534: /* from_list: table_ref  */
+#line 3299 "ora_gram.y"
+                                                { (yyval.list) = (yyvsp[0].node) ? list_make1((yyvsp[0].node)):NIL; }
+#line 13379 "ora_gram.c"
+    break;
+
+  case 535: /* from_list: from_list ',' table_ref  */
+#line 3300 "ora_gram.y"
+                                                { (yyval.list) = (yyvsp[0].node) ? lappend((yyvsp[-2].list), (yyvsp[0].node)):(yyvsp[-2].list); }
+#line 13385 "ora_gram.c"
+    break;
+
+  case 536: /* func_arg_expr: a_expr  */
+#line 3303 "ora_gram.y"
+                                                { (yyval.node) = (yyvsp[0].node); }
+#line 13391 "ora_gram.c"
+    break;
+
+  case 537: /* func_arg_list: func_arg_expr  */
+#line 3306 "ora_gram.y"
+                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 13397 "ora_gram.c"
+    break;
+
+  case 538: /* func_arg_list: func_arg_list ',' func_arg_expr  */
+#line 3307 "ora_gram.y"
+                                                        { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 13403 "ora_gram.c"
+    break;
+
+  case 539: /* extract_list: extract_arg FROM a_expr  */
+#line 3312 "ora_gram.y"
+                                {
+					(yyval.list) = list_make2(makeStringConst((yyvsp[-2].str), (yylsp[-2])), (yyvsp[0].node));
+				}
+#line 13411 "ora_gram.c"
+    break;
+
+  case 540: /* extract_list: %empty  */
+#line 3315 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 13417 "ora_gram.c"
+    break;
+
+  case 541: /* extract_arg: IDENT  */
+#line 3322 "ora_gram.y"
+                                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 13423 "ora_gram.c"
+    break;
+
+  case 542: /* extract_arg: YEAR_P  */
+#line 3323 "ora_gram.y"
+                                                                                                { (yyval.str) = "year"; }
+#line 13429 "ora_gram.c"
+    break;
+
+  case 543: /* extract_arg: MONTH_P  */
+#line 3324 "ora_gram.y"
+                                                                                                { (yyval.str) = "month"; }
+#line 13435 "ora_gram.c"
+    break;
+
+  case 544: /* extract_arg: DAY_P  */
+#line 3325 "ora_gram.y"
+                                                                                                { (yyval.str) = "day"; }
+#line 13441 "ora_gram.c"
+    break;
+
+  case 545: /* extract_arg: HOUR_P  */
+#line 3326 "ora_gram.y"
+                                                                                                { (yyval.str) = "hour"; }
+#line 13447 "ora_gram.c"
+    break;
+
+  case 546: /* extract_arg: MINUTE_P  */
+#line 3327 "ora_gram.y"
+                                                                                                { (yyval.str) = "minute"; }
+#line 13453 "ora_gram.c"
+    break;
+
+  case 547: /* extract_arg: SECOND_P  */
+#line 3328 "ora_gram.y"
+                                                                                                { (yyval.str) = "second"; }
+#line 13459 "ora_gram.c"
+    break;
+
+  case 548: /* extract_arg: Sconst  */
+#line 3329 "ora_gram.y"
+                                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 13465 "ora_gram.c"
+    break;
+
+  case 549: /* func_expr: func_name '(' ')'  */
+#line 3340 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = (yyvsp[-2].list);
+				n->args = NIL;
+				n->agg_order = NIL;
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->over = NULL;
+				n->location = (yylsp[-2]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13482 "ora_gram.c"
+    break;
+
+  case 550: /* func_expr: func_name '(' func_arg_list ')'  */
+#line 3353 "ora_gram.y"
+                        {
+				char *nspname = NULL;
+				char *objname = NULL;
+
+				DeconstructQualifiedName((yyvsp[-3].list), &nspname, &objname);
+				if (strcasecmp(objname, "decode") == 0 && 
+					(nspname == NULL ||
+					strcasecmp(nspname, "oracle") == 0))
+				{
+					if (list_length((yyvsp[-1].list)) < 3)
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("Not engouh parameters for \"decode\" function"),
+								 parser_errposition((yylsp[-3]))));
+
+					(yyval.node) = reparse_decode_func((yyvsp[-1].list), (yylsp[-3]));
+				} else
+				{
+					FuncCall *n = makeNode(FuncCall);
+					n->funcname = (yyvsp[-3].list);
+					n->args = (yyvsp[-1].list);
+					n->agg_order = NIL;
+					n->agg_star = FALSE;
+					n->agg_distinct = FALSE;
+					n->func_variadic = FALSE;
+					n->location = (yylsp[-3]);
+					(yyval.node) = (Node *)n;
+				}
+			}
+#line 13516 "ora_gram.c"
+    break;
+
+  case 551: /* func_expr: func_name '(' func_arg_list sort_clause ')'  */
+#line 3383 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = (yyvsp[-4].list);
+				n->args = (yyvsp[-2].list);
+				n->agg_order = (yyvsp[-1].list);
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				/* n->over = $6; */
+				n->location = (yylsp[-4]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13533 "ora_gram.c"
+    break;
+
+  case 552: /* func_expr: func_name '(' ALL func_arg_list opt_sort_clause ')'  */
+#line 3396 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = (yyvsp[-5].list);
+				n->args = (yyvsp[-2].list);
+				n->agg_order = (yyvsp[-1].list);
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				/* Ideally we'd mark the FuncCall node to indicate
+				 * "must be an aggregate", but there's no provision
+				 * for that in FuncCall at the moment.
+				 */
+				n->func_variadic = FALSE;
+				/* n->over = $7; */
+				n->location = (yylsp[-5]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13554 "ora_gram.c"
+    break;
+
+  case 553: /* func_expr: func_name '(' DISTINCT func_arg_list opt_sort_clause ')'  */
+#line 3413 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = (yyvsp[-5].list);
+				n->args = (yyvsp[-2].list);
+				n->agg_order = (yyvsp[-1].list);
+				n->agg_star = FALSE;
+				n->agg_distinct = TRUE;
+				n->func_variadic = FALSE;
+				/* n->over = $7; */
+				n->location = (yylsp[-5]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13571 "ora_gram.c"
+    break;
+
+  case 554: /* func_expr: func_name '(' '*' ')'  */
+#line 3426 "ora_gram.y"
+                        {
+				/*
+				 * We consider AGGREGATE(*) to invoke a parameterless
+				 * aggregate.  This does the right thing for COUNT(*),
+				 * and there are no other aggregates in SQL that accept
+				 * '*' as parameter.
+				 *
+				 * The FuncCall node is also marked agg_star = true,
+				 * so that later processing can detect what the argument
+				 * really was.
+				 */
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = (yyvsp[-3].list);
+				n->args = NIL;
+				n->agg_order = NIL;
+				n->agg_star = TRUE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->location = (yylsp[-3]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13597 "ora_gram.c"
+    break;
+
+  case 555: /* func_expr: SYSDATE  */
+#line 3448 "ora_gram.y"
+                        {
+				/*
+				 * Translate as "ora_sys_now()::timestamp(0)".
+				 */
+				TypeName *tn;
+				FuncCall *fc;
+
+				fc = makeNode(FuncCall);
+				fc->funcname = OracleFuncName("ora_sys_now");
+				fc->args = NIL;
+				fc->agg_order = NIL;
+				fc->agg_star = FALSE;
+				fc->agg_distinct = FALSE;
+				fc->func_variadic = FALSE;
+				fc->over = NULL;
+				fc->location = -1;
+
+				tn = OracleTypeName("date");
+				(yyval.node) = makeTypeCast((Node *)fc, tn, (yylsp[0]));
+			}
+#line 13622 "ora_gram.c"
+    break;
+
+  case 556: /* func_expr: SYSTIMESTAMP  */
+#line 3469 "ora_gram.y"
+                        {
+				/*
+				 * Translate as "ora_sys_now()::timestamp".
+				 */
+				TypeName *tn;
+				FuncCall *fc;
+
+				fc = makeNode(FuncCall);
+				fc->funcname = OracleFuncName("ora_sys_now");
+				fc->args = NIL;
+				fc->agg_order = NIL;
+				fc->agg_star = FALSE;
+				fc->agg_distinct = FALSE;
+				fc->func_variadic = FALSE;
+				fc->over = NULL;
+				fc->location = -1;
+
+				tn = SystemTypeName("timestamp");
+				(yyval.node) = makeTypeCast((Node *)fc, tn, (yylsp[0]));
+			}
+#line 13647 "ora_gram.c"
+    break;
+
+  case 557: /* func_expr: CURRENT_DATE  */
+#line 3490 "ora_gram.y"
+                        {
+				/*
+				 * Translate as "'now'::text::timestamp(0)".
+				 */
+				Node *n;
+				TypeName *tn;
+
+				n = makeStringConstCast("now", -1, SystemTypeName("text"));
+				tn = OracleTypeName("date");
+				(yyval.node) = makeTypeCast(n, tn, (yylsp[0]));
+			}
+#line 13663 "ora_gram.c"
+    break;
+
+  case 558: /* func_expr: CURRENT_TIMESTAMP  */
+#line 3502 "ora_gram.y"
+                        {
+				/*
+				 * Translate as "now()", since we have a function that
+				 * does exactly what is needed.
+				 */
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("now");
+				n->args = NIL;
+				n->agg_order = NIL;
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->over = NULL;
+				n->location = (yylsp[0]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13684 "ora_gram.c"
+    break;
+
+  case 559: /* func_expr: CURRENT_TIMESTAMP '(' Iconst ')'  */
+#line 3519 "ora_gram.y"
+                        {
+				/*
+				 * Translate as "'now'::text::timestamptz(n)".
+				 * See comments for CURRENT_DATE.
+				 */
+				Node *n;
+				TypeName *d;
+				n = makeStringConstCast("now", -1, SystemTypeName("text"));
+				d = SystemTypeName("timestamptz");
+				d->typmods = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+				(yyval.node) = makeTypeCast(n, d, (yylsp[-3]));
+			}
+#line 13701 "ora_gram.c"
+    break;
+
+  case 560: /* func_expr: LOCALTIMESTAMP  */
+#line 3532 "ora_gram.y"
+                        {
+				/*
+				 * Translate as "'now'::text::timestamp".
+				 * See comments for CURRENT_DATE.
+				 */
+				Node *n;
+				n = makeStringConstCast("now", -1, SystemTypeName("text"));
+				(yyval.node) = makeTypeCast(n, SystemTypeName("timestamp"), (yylsp[0]));
+			}
+#line 13715 "ora_gram.c"
+    break;
+
+  case 561: /* func_expr: LOCALTIMESTAMP '(' Iconst ')'  */
+#line 3542 "ora_gram.y"
+                        {
+				/*
+				 * Translate as "'now'::text::timestamp(n)".
+				 * See comments for CURRENT_DATE.
+				 */
+				Node *n;
+				TypeName *d;
+				n = makeStringConstCast("now", -1, SystemTypeName("text"));
+				d = SystemTypeName("timestamp");
+				d->typmods = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+				(yyval.node) = makeTypeCast(n, d, (yylsp[-3]));
+			}
+#line 13732 "ora_gram.c"
+    break;
+
+  case 562: /* func_expr: COALESCE '(' expr_list ')'  */
+#line 3555 "ora_gram.y"
+                        {
+				CoalesceExpr *c = makeNode(CoalesceExpr);
+				c->args = (yyvsp[-1].list);
+				c->location = (yylsp[-3]);
+				(yyval.node) = (Node *)c;
+			}
+#line 13743 "ora_gram.c"
+    break;
+
+  case 563: /* func_expr: NULLIF '(' a_expr ',' a_expr ')'  */
+#line 3562 "ora_gram.y"
+                        {
+				(yyval.node) = (Node *) makeSimpleA_Expr(AEXPR_NULLIF, "=", (yyvsp[-3].node), (yyvsp[-1].node), (yylsp[-5]));
+			}
+#line 13751 "ora_gram.c"
+    break;
+
+  case 564: /* func_expr: GREATEST '(' expr_list ')'  */
+#line 3566 "ora_gram.y"
+                        {
+				MinMaxExpr *v = makeNode(MinMaxExpr);
+				v->args = (yyvsp[-1].list);
+				v->op = IS_GREATEST;
+				v->location = (yylsp[-3]);
+				(yyval.node) = (Node *)v;
+			}
+#line 13763 "ora_gram.c"
+    break;
+
+  case 565: /* func_expr: LEAST '(' expr_list ')'  */
+#line 3574 "ora_gram.y"
+                        {
+				MinMaxExpr *v = makeNode(MinMaxExpr);
+				v->args = (yyvsp[-1].list);
+				v->op = IS_LEAST;
+				v->location = (yylsp[-3]);
+				(yyval.node) = (Node *)v;
+			}
+#line 13775 "ora_gram.c"
+    break;
+
+  case 566: /* func_expr: TREAT '(' a_expr AS Typename ')'  */
+#line 3582 "ora_gram.y"
+                        {
+				/* TREAT(expr AS target) converts expr of a particular type to target,
+				 * which is defined to be a subtype of the original expression.
+				 * In SQL99, this is intended for use with structured UDTs,
+				 * but let's make this a generally useful form allowing stronger
+				 * coercions than are handled by implicit casting.
+				 */
+				FuncCall *n = makeNode(FuncCall);
+				/* Convert SystemTypeName() to SystemFuncName() even though
+				 * at the moment they result in the same thing.
+				 */
+				n->funcname = SystemFuncName(((Value *)llast((yyvsp[-1].typnam)->names))->val.str);
+				n->args = list_make1((yyvsp[-3].node));
+				n->agg_order = NIL;
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->over = NULL;
+				n->location = (yylsp[-5]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13801 "ora_gram.c"
+    break;
+
+  case 567: /* func_expr: TRIM '(' BOTH trim_list ')'  */
+#line 3604 "ora_gram.y"
+                        {
+				/* various trim expressions are defined in SQL
+				 * - thomas 1997-07-19
+				 */
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("btrim");
+				n->args = (yyvsp[-1].list);
+				n->agg_order = NIL;
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->over = NULL;
+				n->location = (yylsp[-4]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13821 "ora_gram.c"
+    break;
+
+  case 568: /* func_expr: TRIM '(' LEADING trim_list ')'  */
+#line 3620 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("ltrim");
+				n->args = (yyvsp[-1].list);
+				n->agg_order = NIL;
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->over = NULL;
+				n->location = (yylsp[-4]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13838 "ora_gram.c"
+    break;
+
+  case 569: /* func_expr: TRIM '(' TRAILING trim_list ')'  */
+#line 3633 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("rtrim");
+				n->args = (yyvsp[-1].list);
+				n->agg_order = NIL;
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->over = NULL;
+				n->location = (yylsp[-4]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13855 "ora_gram.c"
+    break;
+
+  case 570: /* func_expr: TRIM '(' trim_list ')'  */
+#line 3646 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("btrim");
+				n->args = (yyvsp[-1].list);
+				n->agg_order = NIL;
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->over = NULL;
+				n->location = (yylsp[-3]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13872 "ora_gram.c"
+    break;
+
+  case 571: /* func_expr: DBTIMEZONE_P  */
+#line 3659 "ora_gram.y"
+                        {
+				FuncCall *fc;
+
+				fc = makeNode(FuncCall);
+				fc->funcname = OracleFuncName("ora_dbtimezone");
+				fc->args = NIL;
+				fc->agg_order = NIL;
+				fc->agg_star = FALSE;
+				fc->agg_distinct = FALSE;
+				fc->func_variadic = FALSE;
+				fc->over = NULL;
+				fc->location = -1;
+
+				(yyval.node) = (Node *)fc;
+			}
+#line 13892 "ora_gram.c"
+    break;
+
+  case 572: /* func_expr: SESSIONTIMEZONE  */
+#line 3675 "ora_gram.y"
+                        {
+				FuncCall *fc;
+
+				fc = makeNode(FuncCall);
+				fc->funcname = OracleFuncName("ora_session_timezone");
+				fc->args = NIL;
+				fc->agg_order = NIL;
+				fc->agg_star = FALSE;
+				fc->agg_distinct = FALSE;
+				fc->func_variadic = FALSE;
+				fc->over = NULL;
+				fc->location = -1;
+
+				(yyval.node) = (Node *)fc;
+			}
+#line 13912 "ora_gram.c"
+    break;
+
+  case 573: /* func_expr: EXTRACT '(' extract_list ')'  */
+#line 3691 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("date_part");
+				n->args = (yyvsp[-1].list);
+				n->agg_order = NIL;
+				n->agg_star = FALSE;
+				n->agg_distinct = FALSE;
+				n->func_variadic = FALSE;
+				n->over = NULL;
+				n->location = (yylsp[-3]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13929 "ora_gram.c"
+    break;
+
+  case 574: /* func_expr: ROWNUM  */
+#line 3704 "ora_gram.y"
+                        {
+				RownumExpr *n = makeNode(RownumExpr);
+				n->location = (yylsp[0]);
+				(yyval.node) = (Node*)n;
+			}
+#line 13939 "ora_gram.c"
+    break;
+
+  case 575: /* func_expr: NEXTVAL '(' func_arg_list ')'  */
+#line 3710 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("nextval");
+				n->args = (yyvsp[-1].list);
+				n->location = (yylsp[-3]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13951 "ora_gram.c"
+    break;
+
+  case 576: /* func_expr: CURRVAL '(' func_arg_list ')'  */
+#line 3718 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("currval");
+				n->args = (yyvsp[-1].list);
+				n->location = (yylsp[-3]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13963 "ora_gram.c"
+    break;
+
+  case 577: /* func_expr: ColId '.' NEXTVAL  */
+#line 3726 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("nextval");
+				n->args = list_make1(makeStringConst((yyvsp[-2].str), (yylsp[-2])));
+				n->location = (yylsp[-2]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13975 "ora_gram.c"
+    break;
+
+  case 578: /* func_expr: ColId indirection '.' NEXTVAL  */
+#line 3734 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("nextval");
+				n->args = check_sequence_name(lcons(makeString((yyvsp[-3].str)), (yyvsp[-2].list)), yyscanner, (yylsp[-3]));
+				n->location = (yylsp[-3]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13987 "ora_gram.c"
+    break;
+
+  case 579: /* func_expr: ColId '.' CURRVAL  */
+#line 3742 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("currval");
+				n->args = list_make1(makeStringConst((yyvsp[-2].str), (yylsp[-2])));
+				n->location = (yylsp[-2]);
+				(yyval.node) = (Node *)n;
+			}
+#line 13999 "ora_gram.c"
+    break;
+
+  case 580: /* func_expr: ColId indirection '.' CURRVAL  */
+#line 3750 "ora_gram.y"
+                        {
+				FuncCall *n = makeNode(FuncCall);
+				n->funcname = SystemFuncName("currval");
+				n->args = check_sequence_name(lcons(makeString((yyvsp[-3].str)), (yyvsp[-2].list)), yyscanner, (yylsp[-3]));
+				n->location = (yylsp[-3]);
+				(yyval.node) = (Node *)n;
+			}
+#line 14011 "ora_gram.c"
+    break;
+
+  case 581: /* func_name: type_function_name  */
+#line 3768 "ora_gram.y"
+                                { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 14017 "ora_gram.c"
+    break;
+
+  case 582: /* func_name: ColId indirection  */
+#line 3770 "ora_gram.y"
+                                {
+					(yyval.list) = check_func_name(lcons(makeString((yyvsp[-1].str)), (yyvsp[0].list)),
+										 yyscanner);
+				}
+#line 14026 "ora_gram.c"
+    break;
+
+  case 583: /* func_name: PUBLIC indirection  */
+#line 3775 "ora_gram.y"
+                                {
+					(yyval.list) = check_func_name(lcons(makeString(pstrdup((yyvsp[-1].keyword))), (yyvsp[0].list)),
+										 yyscanner);
+				}
+#line 14035 "ora_gram.c"
+    break;
+
+  case 584: /* group_clause: GROUP_P BY expr_list  */
+#line 3782 "ora_gram.y"
+                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 14041 "ora_gram.c"
+    break;
+
+  case 585: /* group_clause: %empty  */
+#line 3783 "ora_gram.y"
+                                                                                        { (yyval.list) = NIL; }
+#line 14047 "ora_gram.c"
+    break;
+
+  case 586: /* having_clause: HAVING a_expr  */
+#line 3787 "ora_gram.y"
+                                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 14053 "ora_gram.c"
+    break;
+
+  case 587: /* having_clause: %empty  */
+#line 3788 "ora_gram.y"
+                                                                                        { (yyval.node) = NULL; }
+#line 14059 "ora_gram.c"
+    break;
+
+  case 588: /* Iconst: ICONST  */
+#line 3791 "ora_gram.y"
+                        { (yyval.ival) = (yyvsp[0].ival); }
+#line 14065 "ora_gram.c"
+    break;
+
+  case 589: /* indirection_el: '.' attr_name  */
+#line 3795 "ora_gram.y"
+                                {
+					(yyval.node) = (Node *) makeString((yyvsp[0].str));
+				}
+#line 14073 "ora_gram.c"
+    break;
+
+  case 590: /* indirection_el: '.' '*'  */
+#line 3799 "ora_gram.y"
+                                {
+					(yyval.node) = (Node *) makeNode(A_Star);
+				}
+#line 14081 "ora_gram.c"
+    break;
+
+  case 591: /* indirection_el: '[' a_expr ']'  */
+#line 3803 "ora_gram.y"
+                                {
+					A_Indices *ai = makeNode(A_Indices);
+					ai->lidx = NULL;
+					ai->uidx = (yyvsp[-1].node);
+					(yyval.node) = (Node *) ai;
+				}
+#line 14092 "ora_gram.c"
+    break;
+
+  case 592: /* indirection_el: '[' a_expr ':' a_expr ']'  */
+#line 3810 "ora_gram.y"
+                                {
+					A_Indices *ai = makeNode(A_Indices);
+					ai->lidx = (yyvsp[-3].node);
+					ai->uidx = (yyvsp[-1].node);
+					(yyval.node) = (Node *) ai;
+				}
+#line 14103 "ora_gram.c"
+    break;
+
+  case 593: /* indirection: indirection_el  */
+#line 3819 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 14109 "ora_gram.c"
+    break;
+
+  case 594: /* indirection: indirection indirection_el  */
+#line 3820 "ora_gram.y"
+                                                                        { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].node)); }
+#line 14115 "ora_gram.c"
+    break;
+
+  case 595: /* InsertStmt: opt_with_clause INSERT INTO qualified_name insert_rest returning_clause  */
+#line 3825 "ora_gram.y"
+                {
+			(yyvsp[-1].istmt)->relation = (yyvsp[-2].range);
+			(yyvsp[-1].istmt)->returningList = (yyvsp[0].list);
+			(yyvsp[-1].istmt)->withClause = (yyvsp[-5].with);
+			(yyval.node) = (Node *) (yyvsp[-1].istmt);
+		}
+#line 14126 "ora_gram.c"
+    break;
+
+  case 596: /* InsertStmt: opt_with_clause INSERT INTO qualified_name opt_as ColId insert_rest_no_cols returning_clause  */
+#line 3832 "ora_gram.y"
+                {
+			(yyvsp[-4].range)->alias = makeNode(Alias);
+			(yyvsp[-4].range)->alias->aliasname = (yyvsp[-2].str);
+			(yyvsp[-4].range)->alias->colnames = NIL;
+			(yyvsp[-1].istmt)->relation = (yyvsp[-4].range);
+			(yyvsp[-1].istmt)->returningList = (yyvsp[0].list);
+			(yyvsp[-1].istmt)->withClause = (yyvsp[-7].with);
+			(yyval.node) = (Node *) (yyvsp[-1].istmt);
+		}
+#line 14140 "ora_gram.c"
+    break;
+
+  case 597: /* InsertStmt: opt_with_clause INSERT INTO qualified_name opt_as ColId '(' insert_column_list ')' insert_rest_no_cols returning_clause  */
+#line 3842 "ora_gram.y"
+                {
+			(yyvsp[-7].range)->alias = makeNode(Alias);
+			(yyvsp[-7].range)->alias->aliasname = (yyvsp[-5].str);
+			(yyvsp[-1].istmt)->relation = (yyvsp[-7].range);
+			(yyvsp[-1].istmt)->cols = (yyvsp[-3].list);
+			(yyvsp[-1].istmt)->returningList = (yyvsp[0].list);
+			(yyvsp[-1].istmt)->withClause = (yyvsp[-10].with);
+			(yyval.node) = (Node *) (yyvsp[-1].istmt);
+		}
+#line 14154 "ora_gram.c"
+    break;
+
+  case 598: /* InsertStmt: opt_with_clause INSERT INTO qualified_name opt_as ColId '(' insert_column_list ')' '(' insert_column_list ')' SelectStmt returning_clause  */
+#line 3852 "ora_gram.y"
+                {
+			/*
+			 * $8 can not use "name_list", it have conflict.
+			 * we need let insert_column_list to name_list
+			 */
+			InsertStmt *insert;
+			ListCell *lc;
+			ResTarget *res;
+			List *alias_col = NIL;
+			foreach(lc, (yyvsp[-6].list))
+			{
+				res = lfirst(lc);
+				if(res->indirection)
+				{
+					ereport(ERROR,
+						(ERRCODE_SYNTAX_ERROR,
+						errmsg("%s at or near \"%s\"", _("syntax error"), res->name),
+						parser_errposition(res->location)));
+				}
+				alias_col = lappend(alias_col, makeString(res->name));
+			}
+			list_free_deep((yyvsp[-6].list));
+			insert = makeNode(InsertStmt);
+			insert->cols = (yyvsp[-3].list);
+			insert->selectStmt = (yyvsp[-1].node);
+			(yyvsp[-10].range)->alias = makeNode(Alias);
+			(yyvsp[-10].range)->alias->aliasname = (yyvsp[-8].str);
+			(yyvsp[-10].range)->alias->colnames = alias_col;
+			insert->relation = (yyvsp[-10].range);
+			insert->returningList = (yyvsp[0].list);
+			insert->withClause = (yyvsp[-13].with);
+			(yyval.node) = (Node *)insert;
+		}
+#line 14192 "ora_gram.c"
+    break;
+
+  case 599: /* opt_as: AS  */
+#line 3887 "ora_gram.y"
+                                                                                {}
+#line 14198 "ora_gram.c"
+    break;
+
+  case 600: /* opt_as: %empty  */
+#line 3888 "ora_gram.y"
+                                                                                {}
+#line 14204 "ora_gram.c"
+    break;
+
+  case 601: /* insert_rest_no_cols: SelectStmt  */
+#line 3893 "ora_gram.y"
+                        {
+				(yyval.istmt) = makeNode(InsertStmt);
+				(yyval.istmt)->cols = NIL;
+				(yyval.istmt)->selectStmt = (yyvsp[0].node);
+			}
+#line 14214 "ora_gram.c"
+    break;
+
+  case 602: /* insert_rest_no_cols: DEFAULT VALUES  */
+#line 3899 "ora_gram.y"
+                        {
+				(yyval.istmt) = makeNode(InsertStmt);
+				(yyval.istmt)->cols = NIL;
+				(yyval.istmt)->selectStmt = NULL;
+			}
+#line 14224 "ora_gram.c"
+    break;
+
+  case 603: /* insert_rest: '(' insert_column_list ')' SelectStmt  */
+#line 3908 "ora_gram.y"
+                        {
+				(yyval.istmt) = makeNode(InsertStmt);
+				(yyval.istmt)->cols = (yyvsp[-2].list);
+				(yyval.istmt)->selectStmt = (yyvsp[0].node);
+			}
+#line 14234 "ora_gram.c"
+    break;
+
+  case 604: /* insert_rest: insert_rest_no_cols  */
+#line 3914 "ora_gram.y"
+                        {
+				(yyval.istmt) = (yyvsp[0].istmt);
+			}
+#line 14242 "ora_gram.c"
+    break;
+
+  case 605: /* insert_column_list: insert_column_item  */
+#line 3921 "ora_gram.y"
+                                { (yyval.list) = list_make1((yyvsp[0].target)); }
+#line 14248 "ora_gram.c"
+    break;
+
+  case 606: /* insert_column_list: insert_column_list ',' insert_column_item  */
+#line 3923 "ora_gram.y"
+                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].target)); }
+#line 14254 "ora_gram.c"
+    break;
+
+  case 607: /* insert_column_item: ColId opt_indirection  */
+#line 3928 "ora_gram.y"
+                        {
+				(yyval.target) = makeNode(ResTarget);
+				(yyval.target)->name = (yyvsp[-1].str);
+				(yyval.target)->indirection = check_indirection((yyvsp[0].list), yyscanner);
+				(yyval.target)->val = NULL;
+				(yyval.target)->location = (yylsp[-1]);
+			}
+#line 14266 "ora_gram.c"
+    break;
+
+  case 608: /* interval_second: SECOND_P  */
+#line 3939 "ora_gram.y"
+                                {
+					(yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(SECOND), (yylsp[0])));
+				}
+#line 14274 "ora_gram.c"
+    break;
+
+  case 609: /* interval_second: SECOND_P '(' Iconst ')'  */
+#line 3943 "ora_gram.y"
+                                {
+					(yyval.list) = list_make2(makeIntConst(INTERVAL_MASK(SECOND), (yylsp[-3])),
+									makeIntConst((yyvsp[-1].ival), (yylsp[-1])));
+				}
+#line 14283 "ora_gram.c"
+    break;
+
+  case 610: /* iso_level: READ UNCOMMITTED  */
+#line 3949 "ora_gram.y"
+                                                                                { (yyval.str) = "read uncommitted"; }
+#line 14289 "ora_gram.c"
+    break;
+
+  case 611: /* iso_level: READ COMMITTED  */
+#line 3950 "ora_gram.y"
+                                                                                        { (yyval.str) = "read committed"; }
+#line 14295 "ora_gram.c"
+    break;
+
+  case 612: /* iso_level: REPEATABLE READ  */
+#line 3951 "ora_gram.y"
+                                                                                        { (yyval.str) = "repeatable read"; }
+#line 14301 "ora_gram.c"
+    break;
+
+  case 613: /* iso_level: SERIALIZABLE  */
+#line 3952 "ora_gram.y"
+                                                                                        { (yyval.str) = "serializable"; }
+#line 14307 "ora_gram.c"
+    break;
+
+  case 614: /* joined_table: '(' joined_table ')'  */
+#line 3955 "ora_gram.y"
+                                                        { (yyval.jexpr) = (yyvsp[-1].jexpr); }
+#line 14313 "ora_gram.c"
+    break;
+
+  case 615: /* joined_table: table_ref CROSS JOIN table_ref  */
+#line 3957 "ora_gram.y"
+                                {
+					/* CROSS JOIN is same as unqualified 
+					join */
+					JoinExpr *n = makeNode(JoinExpr);
+					n->jointype = JOIN_INNER;
+					n->isNatural = FALSE;
+					n->larg = (yyvsp[-3].node);
+					n->rarg = (yyvsp[0].node);
+					n->usingClause = NIL;
+					n->quals = NULL;
+					(yyval.jexpr) = n;
+				}
+#line 14330 "ora_gram.c"
+    break;
+
+  case 616: /* joined_table: table_ref join_type JOIN table_ref join_qual  */
+#line 3980 "ora_gram.y"
+                                {
+					JoinExpr *n = makeNode(JoinExpr);
+					n->jointype = (yyvsp[-3].jtype);
+					n->isNatural = FALSE;
+					n->larg = (yyvsp[-4].node);
+					n->rarg = (yyvsp[-1].node);
+					if ((yyvsp[0].node) != NULL && IsA((yyvsp[0].node), List))
+						n->usingClause = (List *) (yyvsp[0].node); /* USING clause */
+					else
+						n->quals = (yyvsp[0].node); /* ON clause */
+					(yyval.jexpr) = n;
+				}
+#line 14347 "ora_gram.c"
+    break;
+
+  case 617: /* joined_table: table_ref JOIN table_ref ON a_expr  */
+#line 3993 "ora_gram.y"
+                                {
+					/* letting join_type reduce to empty doesn't work */
+					JoinExpr *n = makeNode(JoinExpr);
+					n->jointype = JOIN_INNER;
+					n->isNatural = FALSE;
+					n->larg = (yyvsp[-4].node);
+					n->rarg = (yyvsp[-2].node);
+					n->quals = (yyvsp[0].node); /* ON clause */
+					(yyval.jexpr) = n;
+				}
+#line 14362 "ora_gram.c"
+    break;
+
+  case 618: /* join_qual: USING '(' name_list ')'  */
+#line 4005 "ora_gram.y"
+                                                                        { (yyval.node) = (Node *) (yyvsp[-1].list); }
+#line 14368 "ora_gram.c"
+    break;
+
+  case 619: /* join_qual: ON a_expr  */
+#line 4006 "ora_gram.y"
+                                                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 14374 "ora_gram.c"
+    break;
+
+  case 620: /* join_outer: OUTER_P  */
+#line 4010 "ora_gram.y"
+                                                                                        { (yyval.node) = NULL; }
+#line 14380 "ora_gram.c"
+    break;
+
+  case 621: /* join_outer: %empty  */
+#line 4011 "ora_gram.y"
+                                                                                                { (yyval.node) = NULL; }
+#line 14386 "ora_gram.c"
+    break;
+
+  case 622: /* join_type: FULL join_outer  */
+#line 4014 "ora_gram.y"
+                                                                                { (yyval.jtype) = JOIN_FULL; }
+#line 14392 "ora_gram.c"
+    break;
+
+  case 623: /* join_type: LEFT join_outer  */
+#line 4015 "ora_gram.y"
+                                                                                        { (yyval.jtype) = JOIN_LEFT; }
+#line 14398 "ora_gram.c"
+    break;
+
+  case 624: /* join_type: RIGHT join_outer  */
+#line 4016 "ora_gram.y"
+                                                                                        { (yyval.jtype) = JOIN_RIGHT; }
+#line 14404 "ora_gram.c"
+    break;
+
+  case 625: /* join_type: INNER_P  */
+#line 4017 "ora_gram.y"
+                                                                                                { (yyval.jtype) = JOIN_INNER; }
+#line 14410 "ora_gram.c"
+    break;
+
+  case 626: /* row: '(' expr_list ',' a_expr ')'  */
+#line 4020 "ora_gram.y"
+                                                                { (yyval.list) = lappend((yyvsp[-3].list), (yyvsp[-1].node)); }
+#line 14416 "ora_gram.c"
+    break;
+
+  case 627: /* MathOp: '+'  */
+#line 4025 "ora_gram.y"
+                                                                                { (yyval.str) = "+"; }
+#line 14422 "ora_gram.c"
+    break;
+
+  case 628: /* MathOp: '-'  */
+#line 4026 "ora_gram.y"
+                                                                                { (yyval.str) = "-"; }
+#line 14428 "ora_gram.c"
+    break;
+
+  case 629: /* MathOp: '*'  */
+#line 4027 "ora_gram.y"
+                                                                                { (yyval.str) = "*"; }
+#line 14434 "ora_gram.c"
+    break;
+
+  case 630: /* MathOp: '/'  */
+#line 4028 "ora_gram.y"
+                                                                                { (yyval.str) = "/"; }
+#line 14440 "ora_gram.c"
+    break;
+
+  case 631: /* MathOp: '%'  */
+#line 4029 "ora_gram.y"
+                                                                                { (yyval.str) = "%"; }
+#line 14446 "ora_gram.c"
+    break;
+
+  case 632: /* MathOp: '^'  */
+#line 4030 "ora_gram.y"
+                                                                                { (yyval.str) = "^"; }
+#line 14452 "ora_gram.c"
+    break;
+
+  case 633: /* MathOp: '<'  */
+#line 4031 "ora_gram.y"
+                                                                                { (yyval.str) = "<"; }
+#line 14458 "ora_gram.c"
+    break;
+
+  case 634: /* MathOp: '>'  */
+#line 4032 "ora_gram.y"
+                                                                                { (yyval.str) = ">"; }
+#line 14464 "ora_gram.c"
+    break;
+
+  case 635: /* MathOp: '='  */
+#line 4033 "ora_gram.y"
+                                                                                { (yyval.str) = "="; }
+#line 14470 "ora_gram.c"
+    break;
+
+  case 636: /* multiple_set_clause: '(' set_target_list ')' '=' set_expr_row  */
+#line 4038 "ora_gram.y"
+                                {
+					ListCell *col_cell;
+					ListCell *val_cell;
+
+					/*
+					 * Break the set_expr_row apart, merge individual expressions
+					 * into the destination ResTargets.  XXX this approach
+					 * cannot work for general row expressions as sources.
+					 */
+					if (list_length((yyvsp[-3].list)) != list_length((yyvsp[0].list)))
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("number of columns does not match number of values"),
+								 parser_errposition((yylsp[-4]))));
+					forboth(col_cell, (yyvsp[-3].list), val_cell, (yyvsp[0].list))
+					{
+						ResTarget *res_col = (ResTarget *) lfirst(col_cell);
+						Node *res_val = (Node *) lfirst(val_cell);
+
+						res_col->val = res_val;
+					}
+
+					(yyval.list) = (yyvsp[-3].list);
+				}
+#line 14499 "ora_gram.c"
+    break;
+
+  case 638: /* name_list: name  */
+#line 4068 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 14505 "ora_gram.c"
+    break;
+
+  case 639: /* name_list: name_list ',' name  */
+#line 4069 "ora_gram.y"
+                                { (yyval.list) = lappend((yyvsp[-2].list), makeString((yyvsp[0].str))); }
+#line 14511 "ora_gram.c"
+    break;
+
+  case 640: /* NonReservedWord: IDENT  */
+#line 4074 "ora_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 14517 "ora_gram.c"
+    break;
+
+  case 641: /* NonReservedWord: unreserved_keyword  */
+#line 4075 "ora_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 14523 "ora_gram.c"
+    break;
+
+  case 642: /* NonReservedWord: col_name_keyword  */
+#line 4076 "ora_gram.y"
+                                                                                        { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 14529 "ora_gram.c"
+    break;
+
+  case 643: /* NonReservedWord: type_func_name_keyword  */
+#line 4077 "ora_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 14535 "ora_gram.c"
+    break;
+
+  case 644: /* NonReservedWord_or_Sconst: NonReservedWord  */
+#line 4081 "ora_gram.y"
+                                                                                        { (yyval.str) = (yyvsp[0].str); }
+#line 14541 "ora_gram.c"
+    break;
+
+  case 645: /* NonReservedWord_or_Sconst: Sconst  */
+#line 4082 "ora_gram.y"
+                                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 14547 "ora_gram.c"
+    break;
+
+  case 646: /* Numeric: INT_P  */
+#line 4086 "ora_gram.y"
+                                                        { (yyval.typnam) = SystemTypeNameLocation("int4", (yylsp[0])); }
+#line 14553 "ora_gram.c"
+    break;
+
+  case 647: /* Numeric: INTEGER  */
+#line 4087 "ora_gram.y"
+                                                        { (yyval.typnam) = SystemTypeNameLocation("int4", (yylsp[0])); }
+#line 14559 "ora_gram.c"
+    break;
+
+  case 648: /* Numeric: SMALLINT  */
+#line 4088 "ora_gram.y"
+                                                        { (yyval.typnam) = SystemTypeNameLocation("int2", (yylsp[0])); }
+#line 14565 "ora_gram.c"
+    break;
+
+  case 649: /* Numeric: BIGINT  */
+#line 4089 "ora_gram.y"
+                                                        { (yyval.typnam) = SystemTypeNameLocation("int8", (yylsp[0])); }
+#line 14571 "ora_gram.c"
+    break;
+
+  case 650: /* Numeric: LONG_P  */
+#line 4090 "ora_gram.y"
+                                                        { (yyval.typnam) = SystemTypeNameLocation("text", (yylsp[0])); }
+#line 14577 "ora_gram.c"
+    break;
+
+  case 651: /* Numeric: BINARY_FLOAT  */
+#line 4091 "ora_gram.y"
+                                                { (yyval.typnam) = SystemTypeNameLocation("float4", (yylsp[0])); }
+#line 14583 "ora_gram.c"
+    break;
+
+  case 652: /* Numeric: REAL  */
+#line 4092 "ora_gram.y"
+                                                        { (yyval.typnam) = SystemTypeNameLocation("float4", (yylsp[0])); }
+#line 14589 "ora_gram.c"
+    break;
+
+  case 653: /* Numeric: BINARY_DOUBLE  */
+#line 4093 "ora_gram.y"
+                                                { (yyval.typnam) = SystemTypeNameLocation("float8", (yylsp[0])); }
+#line 14595 "ora_gram.c"
+    break;
+
+  case 654: /* Numeric: FLOAT_P  */
+#line 4094 "ora_gram.y"
+                                                        { (yyval.typnam) = SystemTypeNameLocation("float8", (yylsp[0])); }
+#line 14601 "ora_gram.c"
+    break;
+
+  case 655: /* Numeric: FLOAT_P '(' Iconst ')'  */
+#line 4096 "ora_gram.y"
+                {
+			/*
+			 * Check FLOAT() precision limits assuming IEEE floating
+			 * types - thomas 1997-09-18
+			 */
+			if ((yyvsp[-1].ival) < 1)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+						 errmsg("precision for type float must be at least 1 bit"),
+						 parser_errposition((yylsp[-1]))));
+			else if ((yyvsp[-1].ival) <= 24)
+				(yyval.typnam) = SystemTypeNameLocation("float4", (yylsp[-3]));
+			else if ((yyvsp[-1].ival) <= 53)
+				(yyval.typnam) = SystemTypeNameLocation("float8", (yylsp[-2]));
+			else
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+						 errmsg("precision for type float must be less than 54 bits"),
+						 parser_errposition((yylsp[-1]))));
+		}
+#line 14626 "ora_gram.c"
+    break;
+
+  case 656: /* Numeric: DOUBLE_P PRECISION  */
+#line 4116 "ora_gram.y"
+                                        { (yyval.typnam) = SystemTypeNameLocation("float8", (yylsp[-1])); }
+#line 14632 "ora_gram.c"
+    break;
+
+  case 657: /* Numeric: DECIMAL_P opt_type_modifiers  */
+#line 4118 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("numeric", (yylsp[-1]));
+			(yyval.typnam)->typmods = (yyvsp[0].list);
+		}
+#line 14641 "ora_gram.c"
+    break;
+
+  case 658: /* Numeric: DEC opt_type_modifiers  */
+#line 4123 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("numeric", (yylsp[-1]));
+			(yyval.typnam)->typmods = (yyvsp[0].list);
+		}
+#line 14650 "ora_gram.c"
+    break;
+
+  case 659: /* Numeric: NUMERIC opt_type_modifiers  */
+#line 4128 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("numeric", (yylsp[-1]));
+			(yyval.typnam)->typmods = (yyvsp[0].list);
+		}
+#line 14659 "ora_gram.c"
+    break;
+
+  case 660: /* Numeric: NUMBER_P opt_type_modifiers  */
+#line 4133 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("numeric", (yylsp[-1]));
+			(yyval.typnam)->typmods = (yyvsp[0].list);
+		}
+#line 14668 "ora_gram.c"
+    break;
+
+  case 661: /* Numeric: BOOLEAN_P  */
+#line 4137 "ora_gram.y"
+                                                        { (yyval.typnam) = SystemTypeNameLocation("bool", (yylsp[0])); }
+#line 14674 "ora_gram.c"
+    break;
+
+  case 662: /* NumericOnly: FCONST  */
+#line 4141 "ora_gram.y"
+                                                                                        { (yyval.value) = makeFloat((yyvsp[0].str)); }
+#line 14680 "ora_gram.c"
+    break;
+
+  case 663: /* NumericOnly: '-' FCONST  */
+#line 4143 "ora_gram.y"
+                                {
+					(yyval.value) = makeFloat((yyvsp[0].str));
+					doNegateFloat((yyval.value));
+				}
+#line 14689 "ora_gram.c"
+    break;
+
+  case 664: /* NumericOnly: SignedIconst  */
+#line 4147 "ora_gram.y"
+                                                                                { (yyval.value) = makeInteger((yyvsp[0].ival)); }
+#line 14695 "ora_gram.c"
+    break;
+
+  case 665: /* OptTableElementList: TableElementList  */
+#line 4151 "ora_gram.y"
+                                { (yyval.list) = (yyvsp[0].list); }
+#line 14701 "ora_gram.c"
+    break;
+
+  case 666: /* OptTableElementList: %empty  */
+#line 4152 "ora_gram.y"
+                                { (yyval.list) = NIL; }
+#line 14707 "ora_gram.c"
+    break;
+
+  case 668: /* opt_alias_clause: %empty  */
+#line 4157 "ora_gram.y"
+                                                        { (yyval.alias) = NULL; }
+#line 14713 "ora_gram.c"
+    break;
+
+  case 669: /* opt_all: ALL  */
+#line 4161 "ora_gram.y"
+                                                                                                { (yyval.boolean) = TRUE; }
+#line 14719 "ora_gram.c"
+    break;
+
+  case 670: /* opt_all: DISTINCT  */
+#line 4162 "ora_gram.y"
+                                                                                                { (yyval.boolean) = FALSE; }
+#line 14725 "ora_gram.c"
+    break;
+
+  case 671: /* opt_all: %empty  */
+#line 4163 "ora_gram.y"
+                                                                                                { (yyval.boolean) = FALSE; }
+#line 14731 "ora_gram.c"
+    break;
+
+  case 672: /* opt_asc_desc: ASC  */
+#line 4167 "ora_gram.y"
+                                        { (yyval.ival) = SORTBY_ASC; }
+#line 14737 "ora_gram.c"
+    break;
+
+  case 673: /* opt_asc_desc: DESC  */
+#line 4168 "ora_gram.y"
+                                        { (yyval.ival) = SORTBY_DESC; }
+#line 14743 "ora_gram.c"
+    break;
+
+  case 674: /* opt_asc_desc: %empty  */
+#line 4169 "ora_gram.y"
+                                { (yyval.ival) = SORTBY_DEFAULT; }
+#line 14749 "ora_gram.c"
+    break;
+
+  case 675: /* opt_boolean_or_string: TRUE_P  */
+#line 4173 "ora_gram.y"
+                                                                                                { (yyval.str) = "true"; }
+#line 14755 "ora_gram.c"
+    break;
+
+  case 676: /* opt_boolean_or_string: FALSE_P  */
+#line 4174 "ora_gram.y"
+                                                                                                { (yyval.str) = "false"; }
+#line 14761 "ora_gram.c"
+    break;
+
+  case 677: /* opt_boolean_or_string: ON  */
+#line 4175 "ora_gram.y"
+                                                                                                { (yyval.str) = "on"; }
+#line 14767 "ora_gram.c"
+    break;
+
+  case 678: /* opt_boolean_or_string: NonReservedWord_or_Sconst  */
+#line 4181 "ora_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 14773 "ora_gram.c"
+    break;
+
+  case 679: /* opt_byte_char: BYTE_P  */
+#line 4185 "ora_gram.y"
+                                                { (yyval.boolean) = true; }
+#line 14779 "ora_gram.c"
+    break;
+
+  case 680: /* opt_byte_char: CHAR_P  */
+#line 4186 "ora_gram.y"
+                                                { (yyval.boolean) = true; }
+#line 14785 "ora_gram.c"
+    break;
+
+  case 681: /* opt_byte_char: %empty  */
+#line 4187 "ora_gram.y"
+                                        { (yyval.boolean) = false; }
+#line 14791 "ora_gram.c"
+    break;
+
+  case 682: /* opt_distinct: DISTINCT  */
+#line 4194 "ora_gram.y"
+                                                                                                { (yyval.list) = list_make1(NIL); }
+#line 14797 "ora_gram.c"
+    break;
+
+  case 683: /* opt_distinct: ALL  */
+#line 4195 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 14803 "ora_gram.c"
+    break;
+
+  case 684: /* opt_distinct: %empty  */
+#line 4196 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 14809 "ora_gram.c"
+    break;
+
+  case 685: /* opt_drop_behavior: CASCADE  */
+#line 4200 "ora_gram.y"
+                                                                        { (yyval.dbehavior) = DROP_CASCADE; }
+#line 14815 "ora_gram.c"
+    break;
+
+  case 686: /* opt_drop_behavior: CASCADE CONSTRAINTS  */
+#line 4201 "ora_gram.y"
+                                                        { (yyval.dbehavior) = DROP_CASCADE; }
+#line 14821 "ora_gram.c"
+    break;
+
+  case 687: /* opt_drop_behavior: RESTRICT  */
+#line 4202 "ora_gram.y"
+                                                                        { (yyval.dbehavior) = DROP_RESTRICT; }
+#line 14827 "ora_gram.c"
+    break;
+
+  case 688: /* opt_drop_behavior: %empty  */
+#line 4203 "ora_gram.y"
+                                                                { (yyval.dbehavior) = DROP_RESTRICT; /* default */ }
+#line 14833 "ora_gram.c"
+    break;
+
+  case 689: /* opt_encoding: Sconst  */
+#line 4207 "ora_gram.y"
+                                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 14839 "ora_gram.c"
+    break;
+
+  case 690: /* opt_encoding: DEFAULT  */
+#line 4208 "ora_gram.y"
+                                                                                                { (yyval.str) = NULL; }
+#line 14845 "ora_gram.c"
+    break;
+
+  case 691: /* opt_encoding: %empty  */
+#line 4209 "ora_gram.y"
+                                                                                                { (yyval.str) = NULL; }
+#line 14851 "ora_gram.c"
+    break;
+
+  case 694: /* opt_indirection: %empty  */
+#line 4218 "ora_gram.y"
+                                                                                                { (yyval.list) = NIL; }
+#line 14857 "ora_gram.c"
+    break;
+
+  case 695: /* opt_indirection: opt_indirection indirection_el  */
+#line 4219 "ora_gram.y"
+                                                                        { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].node)); }
+#line 14863 "ora_gram.c"
+    break;
+
+  case 696: /* opt_interval: YEAR_P  */
+#line 4224 "ora_gram.y"
+                                { (yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(YEAR), (yylsp[0]))); }
+#line 14869 "ora_gram.c"
+    break;
+
+  case 697: /* opt_interval: MONTH_P  */
+#line 4226 "ora_gram.y"
+                                { (yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(MONTH), (yylsp[0]))); }
+#line 14875 "ora_gram.c"
+    break;
+
+  case 698: /* opt_interval: DAY_P  */
+#line 4228 "ora_gram.y"
+                                { (yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(DAY), (yylsp[0]))); }
+#line 14881 "ora_gram.c"
+    break;
+
+  case 699: /* opt_interval: HOUR_P  */
+#line 4230 "ora_gram.y"
+                                { (yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(HOUR), (yylsp[0]))); }
+#line 14887 "ora_gram.c"
+    break;
+
+  case 700: /* opt_interval: MINUTE_P  */
+#line 4232 "ora_gram.y"
+                                { (yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(MINUTE), (yylsp[0]))); }
+#line 14893 "ora_gram.c"
+    break;
+
+  case 701: /* opt_interval: interval_second  */
+#line 4234 "ora_gram.y"
+                                { (yyval.list) = (yyvsp[0].list); }
+#line 14899 "ora_gram.c"
+    break;
+
+  case 702: /* opt_interval: YEAR_P TO MONTH_P  */
+#line 4236 "ora_gram.y"
+                                {
+					(yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(YEAR) |
+												 INTERVAL_MASK(MONTH), (yylsp[-2])));
+				}
+#line 14908 "ora_gram.c"
+    break;
+
+  case 703: /* opt_interval: DAY_P TO HOUR_P  */
+#line 4241 "ora_gram.y"
+                                {
+					(yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(DAY) |
+												 INTERVAL_MASK(HOUR), (yylsp[-2])));
+				}
+#line 14917 "ora_gram.c"
+    break;
+
+  case 704: /* opt_interval: DAY_P TO MINUTE_P  */
+#line 4246 "ora_gram.y"
+                                {
+					(yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(DAY) |
+												 INTERVAL_MASK(HOUR) |
+												 INTERVAL_MASK(MINUTE), (yylsp[-2])));
+				}
+#line 14927 "ora_gram.c"
+    break;
+
+  case 705: /* opt_interval: DAY_P TO interval_second  */
+#line 4252 "ora_gram.y"
+                                {
+					(yyval.list) = (yyvsp[0].list);
+					linitial((yyval.list)) = makeIntConst(INTERVAL_MASK(DAY) |
+												INTERVAL_MASK(HOUR) |
+												INTERVAL_MASK(MINUTE) |
+												INTERVAL_MASK(SECOND), (yylsp[-2]));
+				}
+#line 14939 "ora_gram.c"
+    break;
+
+  case 706: /* opt_interval: HOUR_P TO MINUTE_P  */
+#line 4260 "ora_gram.y"
+                                {
+					(yyval.list) = list_make1(makeIntConst(INTERVAL_MASK(HOUR) |
+												 INTERVAL_MASK(MINUTE), (yylsp[-2])));
+				}
+#line 14948 "ora_gram.c"
+    break;
+
+  case 707: /* opt_interval: HOUR_P TO interval_second  */
+#line 4265 "ora_gram.y"
+                                {
+					(yyval.list) = (yyvsp[0].list);
+					linitial((yyval.list)) = makeIntConst(INTERVAL_MASK(HOUR) |
+												INTERVAL_MASK(MINUTE) |
+												INTERVAL_MASK(SECOND), (yylsp[-2]));
+				}
+#line 14959 "ora_gram.c"
+    break;
+
+  case 708: /* opt_interval: MINUTE_P TO interval_second  */
+#line 4272 "ora_gram.y"
+                                {
+					(yyval.list) = (yyvsp[0].list);
+					linitial((yyval.list)) = makeIntConst(INTERVAL_MASK(MINUTE) |
+												INTERVAL_MASK(SECOND), (yylsp[-2]));
+				}
+#line 14969 "ora_gram.c"
+    break;
+
+  case 709: /* opt_interval: %empty  */
+#line 4278 "ora_gram.y"
+                                { (yyval.list) = NIL; }
+#line 14975 "ora_gram.c"
+    break;
+
+  case 711: /* opt_name_list: %empty  */
+#line 4283 "ora_gram.y"
+                      { (yyval.list) = NULL; }
+#line 14981 "ora_gram.c"
+    break;
+
+  case 712: /* opt_restart_seqs: CONTINUE_P IDENTITY_P  */
+#line 4287 "ora_gram.y"
+                                                        { (yyval.boolean) = false; }
+#line 14987 "ora_gram.c"
+    break;
+
+  case 713: /* opt_restart_seqs: RESTART IDENTITY_P  */
+#line 4288 "ora_gram.y"
+                                                        { (yyval.boolean) = true; }
+#line 14993 "ora_gram.c"
+    break;
+
+  case 714: /* opt_restart_seqs: %empty  */
+#line 4289 "ora_gram.y"
+                                                                { (yyval.boolean) = false; }
+#line 14999 "ora_gram.c"
+    break;
+
+  case 715: /* opt_type_mod: '(' Iconst ')'  */
+#line 4293 "ora_gram.y"
+                                        { (yyval.list) = list_make1(makeIntConst((yyvsp[-1].ival), (yylsp[-1]))); }
+#line 15005 "ora_gram.c"
+    break;
+
+  case 716: /* opt_type_mod: %empty  */
+#line 4294 "ora_gram.y"
+                                        { (yyval.list) = NIL; }
+#line 15011 "ora_gram.c"
+    break;
+
+  case 717: /* opt_type_modifiers: '(' expr_list ')'  */
+#line 4297 "ora_gram.y"
+                                                                { (yyval.list) = (yyvsp[-1].list); }
+#line 15017 "ora_gram.c"
+    break;
+
+  case 718: /* opt_type_modifiers: %empty  */
+#line 4298 "ora_gram.y"
+                                                                                        { (yyval.list) = NIL; }
+#line 15023 "ora_gram.c"
+    break;
+
+  case 719: /* opt_verbose: VERBOSE  */
+#line 4302 "ora_gram.y"
+                                                                                                { (yyval.boolean) = TRUE; }
+#line 15029 "ora_gram.c"
+    break;
+
+  case 720: /* opt_verbose: %empty  */
+#line 4303 "ora_gram.y"
+                                                                                                { (yyval.boolean) = FALSE; }
+#line 15035 "ora_gram.c"
+    break;
+
+  case 722: /* opt_with_clause: %empty  */
+#line 4308 "ora_gram.y"
+                      { (yyval.with) = NULL; }
+#line 15041 "ora_gram.c"
+    break;
+
+  case 723: /* qualified_name_list: qualified_name  */
+#line 4312 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].range)); }
+#line 15047 "ora_gram.c"
+    break;
+
+  case 724: /* qualified_name_list: qualified_name_list ',' qualified_name  */
+#line 4313 "ora_gram.y"
+                                                                 { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].range)); }
+#line 15053 "ora_gram.c"
+    break;
+
+  case 725: /* qualified_name: ColId  */
+#line 4317 "ora_gram.y"
+                        { (yyval.range) = makeRangeVar(NULL, (yyvsp[0].str), (yylsp[0])); }
+#line 15059 "ora_gram.c"
+    break;
+
+  case 726: /* qualified_name: ColId indirection  */
+#line 4319 "ora_gram.y"
+                        {
+				RangeVar *n;
+				check_qualified_name((yyvsp[0].list), yyscanner);
+				n = makeRangeVar(NULL, NULL, (yylsp[-1]));
+				switch (list_length((yyvsp[0].list)))
+				{
+					case 1:
+						n->catalogname = NULL;
+						n->schemaname = (yyvsp[-1].str);
+						n->relname = strVal(linitial((yyvsp[0].list)));
+						break;
+					case 2:
+						n->catalogname = (yyvsp[-1].str);
+						n->schemaname = strVal(linitial((yyvsp[0].list)));
+						n->relname = strVal(lsecond((yyvsp[0].list)));
+						break;
+					default:
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("improper qualified name (too many dotted names): %s",
+										NameListToString(lcons(makeString((yyvsp[-1].str)), (yyvsp[0].list)))),
+								 parser_errposition((yylsp[-1]))));
+						break;
+				}
+				(yyval.range) = n;
+			}
+#line 15090 "ora_gram.c"
+    break;
+
+  case 727: /* qualified_name: PUBLIC indirection  */
+#line 4346 "ora_gram.y"
+                        {
+				RangeVar *n;
+				check_qualified_name((yyvsp[0].list), yyscanner);
+				n = makeRangeVar(NULL, NULL, (yylsp[-1]));
+				switch (list_length((yyvsp[0].list)))
+				{
+					case 1:
+						n->catalogname = NULL;
+						n->schemaname = pstrdup((yyvsp[-1].keyword));
+						n->relname = strVal(linitial((yyvsp[0].list)));
+						break;
+					case 2:
+						n->catalogname = pstrdup((yyvsp[-1].keyword));
+						n->schemaname = strVal(linitial((yyvsp[0].list)));
+						n->relname = strVal(lsecond((yyvsp[0].list)));
+						break;
+					default:
+						ereport(ERROR,
+								(errcode(ERRCODE_SYNTAX_ERROR),
+								 errmsg("improper qualified name (too many dotted names): %s",
+										NameListToString(lcons(makeString(pstrdup((yyvsp[-1].keyword))), (yyvsp[0].list)))),
+								 parser_errposition((yylsp[-1]))));
+						break;
+				}
+				(yyval.range) = n;
+			}
+#line 15121 "ora_gram.c"
+    break;
+
+  case 728: /* qual_Op: Op  */
+#line 4374 "ora_gram.y"
+            { (yyval.list) = list_make1(makeString((yyvsp[0].str))); }
+#line 15127 "ora_gram.c"
+    break;
+
+  case 729: /* qual_Op: OPERATOR '(' any_operator ')'  */
+#line 4375 "ora_gram.y"
+                                        { (yyval.list) = (yyvsp[-1].list); }
+#line 15133 "ora_gram.c"
+    break;
+
+  case 730: /* relation_expr: qualified_name  */
+#line 4380 "ora_gram.y"
+                {
+				/* default inheritance */
+				(yyval.range) = (yyvsp[0].range);
+				(yyval.range)->inhOpt = INH_DEFAULT;
+				(yyval.range)->alias = NULL;
+		}
+#line 15144 "ora_gram.c"
+    break;
+
+  case 731: /* relation_expr: qualified_name '*'  */
+#line 4387 "ora_gram.y"
+                {
+			/* inheritance query */
+			(yyval.range) = (yyvsp[-1].range);
+			(yyval.range)->inhOpt = INH_YES;
+			(yyval.range)->alias = NULL;
+		}
+#line 15155 "ora_gram.c"
+    break;
+
+  case 732: /* relation_expr: ONLY qualified_name  */
+#line 4394 "ora_gram.y"
+                {
+			/* no inheritance */
+			(yyval.range) = (yyvsp[0].range);
+			(yyval.range)->inhOpt = INH_NO;
+			(yyval.range)->alias = NULL;
+			}
+#line 15166 "ora_gram.c"
+    break;
+
+  case 733: /* relation_expr: ONLY '(' qualified_name ')'  */
+#line 4401 "ora_gram.y"
+                {
+			/* no inheritance, SQL99-style syntax */
+			(yyval.range) = (yyvsp[-1].range);
+			(yyval.range)->inhOpt = INH_NO;
+			(yyval.range)->alias = NULL;
+		}
+#line 15177 "ora_gram.c"
+    break;
+
+  case 734: /* relation_expr_list: relation_expr  */
+#line 4410 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].range)); }
+#line 15183 "ora_gram.c"
+    break;
+
+  case 735: /* relation_expr_list: relation_expr_list ',' relation_expr  */
+#line 4411 "ora_gram.y"
+                                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].range)); }
+#line 15189 "ora_gram.c"
+    break;
+
+  case 736: /* relation_expr_opt_alias: relation_expr  */
+#line 4424 "ora_gram.y"
+                {
+			(yyval.range) = (yyvsp[0].range);
+		}
+#line 15197 "ora_gram.c"
+    break;
+
+  case 737: /* relation_expr_opt_alias: relation_expr ColId  */
+#line 4428 "ora_gram.y"
+                {
+			Alias *alias = makeNode(Alias);
+			alias->aliasname = (yyvsp[0].str);
+			(yyvsp[-1].range)->alias = alias;
+			(yyval.range) = (yyvsp[-1].range);
+		}
+#line 15208 "ora_gram.c"
+    break;
+
+  case 738: /* relation_expr_opt_alias: relation_expr AS ColId  */
+#line 4435 "ora_gram.y"
+                {
+			Alias *alias = makeNode(Alias);
+			alias->aliasname = (yyvsp[0].str);
+			(yyvsp[-2].range)->alias = alias;
+			(yyval.range) = (yyvsp[-2].range);
+		}
+#line 15219 "ora_gram.c"
+    break;
+
+  case 739: /* returning_clause: RETURN_P returning_item  */
+#line 4444 "ora_gram.y"
+                                        { (yyval.list) = (yyvsp[0].list); }
+#line 15225 "ora_gram.c"
+    break;
+
+  case 740: /* returning_clause: RETURNING returning_item  */
+#line 4445 "ora_gram.y"
+                                        { (yyval.list) = (yyvsp[0].list); }
+#line 15231 "ora_gram.c"
+    break;
+
+  case 741: /* returning_clause: %empty  */
+#line 4446 "ora_gram.y"
+                                                { (yyval.list) = NIL; }
+#line 15237 "ora_gram.c"
+    break;
+
+  case 743: /* Sconst: SCONST  */
+#line 4452 "ora_gram.y"
+                        { (yyval.str) = (yyvsp[0].str); }
+#line 15243 "ora_gram.c"
+    break;
+
+  case 748: /* select_with_parens: '(' select_no_parens ')'  */
+#line 4464 "ora_gram.y"
+                                                        { (yyval.node) = (yyvsp[-1].node); }
+#line 15249 "ora_gram.c"
+    break;
+
+  case 749: /* select_with_parens: '(' select_with_parens ')'  */
+#line 4465 "ora_gram.y"
+                                                { (yyval.node) = (yyvsp[-1].node); }
+#line 15255 "ora_gram.c"
+    break;
+
+  case 750: /* select_no_parens: simple_select  */
+#line 4469 "ora_gram.y"
+                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 15261 "ora_gram.c"
+    break;
+
+  case 751: /* select_no_parens: select_clause sort_clause  */
+#line 4471 "ora_gram.y"
+                        {
+				insertSelectOptions((SelectStmt *) (yyvsp[-1].node), (yyvsp[0].list), NIL,
+									NULL, NULL, NULL,
+									yyscanner);
+				(yyval.node) = (yyvsp[-1].node);
+			}
+#line 15272 "ora_gram.c"
+    break;
+
+  case 752: /* select_no_parens: select_clause opt_sort_clause for_locking_clause opt_select_limit  */
+#line 4478 "ora_gram.y"
+                        {
+				insertSelectOptions((SelectStmt *) (yyvsp[-3].node), (yyvsp[-2].list), (yyvsp[-1].list),
+									list_nth((yyvsp[0].list), 0), list_nth((yyvsp[0].list), 1),
+									NULL,
+									yyscanner);
+				(yyval.node) = (yyvsp[-3].node);
+			}
+#line 15284 "ora_gram.c"
+    break;
+
+  case 753: /* select_no_parens: select_clause opt_sort_clause select_limit opt_for_locking_clause  */
+#line 4486 "ora_gram.y"
+                        {
+				insertSelectOptions((SelectStmt *) (yyvsp[-3].node), (yyvsp[-2].list), (yyvsp[0].list),
+									list_nth((yyvsp[-1].list), 0), list_nth((yyvsp[-1].list), 1),
+									NULL,
+									yyscanner);
+				(yyval.node) = (yyvsp[-3].node);
+			}
+#line 15296 "ora_gram.c"
+    break;
+
+  case 754: /* select_no_parens: with_clause select_clause  */
+#line 4494 "ora_gram.y"
+                        {
+				insertSelectOptions((SelectStmt *) (yyvsp[0].node), NULL, NIL,
+									NULL, NULL,
+									(yyvsp[-1].with),
+									yyscanner);
+				(yyval.node) = (yyvsp[0].node);
+			}
+#line 15308 "ora_gram.c"
+    break;
+
+  case 755: /* select_no_parens: with_clause select_clause sort_clause  */
+#line 4502 "ora_gram.y"
+                        {
+				insertSelectOptions((SelectStmt *) (yyvsp[-1].node), (yyvsp[0].list), NIL,
+									NULL, NULL,
+									(yyvsp[-2].with),
+									yyscanner);
+				(yyval.node) = (yyvsp[-1].node);
+			}
+#line 15320 "ora_gram.c"
+    break;
+
+  case 756: /* select_no_parens: with_clause select_clause opt_sort_clause for_locking_clause opt_select_limit  */
+#line 4510 "ora_gram.y"
+                        {
+				insertSelectOptions((SelectStmt *) (yyvsp[-3].node), (yyvsp[-2].list), (yyvsp[-1].list),
+									list_nth((yyvsp[0].list), 0), list_nth((yyvsp[0].list), 1),
+									(yyvsp[-4].with),
+									yyscanner);
+				(yyval.node) = (yyvsp[-3].node);
+			}
+#line 15332 "ora_gram.c"
+    break;
+
+  case 757: /* select_no_parens: with_clause select_clause opt_sort_clause select_limit opt_for_locking_clause  */
+#line 4518 "ora_gram.y"
+                        {
+				insertSelectOptions((SelectStmt *) (yyvsp[-3].node), (yyvsp[-2].list), (yyvsp[0].list),
+									list_nth((yyvsp[-1].list), 0), list_nth((yyvsp[-1].list), 1),
+									(yyvsp[-4].with),
+									yyscanner);
+				(yyval.node) = (yyvsp[-3].node);
+			}
+#line 15344 "ora_gram.c"
+    break;
+
+  case 758: /* set_clause_list: set_clause  */
+#line 4528 "ora_gram.y"
+                                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 15350 "ora_gram.c"
+    break;
+
+  case 759: /* set_clause_list: set_clause_list ',' set_clause  */
+#line 4529 "ora_gram.y"
+                                                                { (yyval.list) = list_concat((yyvsp[-2].list),(yyvsp[0].list)); }
+#line 15356 "ora_gram.c"
+    break;
+
+  case 760: /* set_clause: single_set_clause  */
+#line 4533 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].target)); }
+#line 15362 "ora_gram.c"
+    break;
+
+  case 761: /* set_clause: multiple_set_clause  */
+#line 4534 "ora_gram.y"
+                                                                                { (yyval.list) = (yyvsp[0].list); }
+#line 15368 "ora_gram.c"
+    break;
+
+  case 762: /* for_locking_clause: for_locking_items  */
+#line 4538 "ora_gram.y"
+                                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 15374 "ora_gram.c"
+    break;
+
+  case 763: /* for_locking_clause: FOR READ ONLY  */
+#line 4539 "ora_gram.y"
+                                                                                        { (yyval.list) = NIL; }
+#line 15380 "ora_gram.c"
+    break;
+
+  case 764: /* opt_for_locking_clause: for_locking_clause  */
+#line 4543 "ora_gram.y"
+                                                                                        { (yyval.list) = (yyvsp[0].list); }
+#line 15386 "ora_gram.c"
+    break;
+
+  case 765: /* opt_for_locking_clause: %empty  */
+#line 4544 "ora_gram.y"
+                                                                                        { (yyval.list) = NIL; }
+#line 15392 "ora_gram.c"
+    break;
+
+  case 766: /* for_locking_items: for_locking_item  */
+#line 4548 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 15398 "ora_gram.c"
+    break;
+
+  case 767: /* for_locking_items: for_locking_items for_locking_item  */
+#line 4549 "ora_gram.y"
+                                                                { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].node)); }
+#line 15404 "ora_gram.c"
+    break;
+
+  case 768: /* for_locking_item: for_locking_strength locked_rels_list opt_nowait  */
+#line 4554 "ora_gram.y"
+                                {
+					LockingClause *n = makeNode(LockingClause);
+					n->lockedRels = (yyvsp[-1].list);
+					n->strength = (yyvsp[-2].ival);
+					n->noWait = (yyvsp[0].boolean);
+					(yyval.node) = (Node *) n;
+				}
+#line 15416 "ora_gram.c"
+    break;
+
+  case 769: /* for_locking_strength: FOR UPDATE  */
+#line 4564 "ora_gram.y"
+                                                                                        { (yyval.ival) = LCS_FORUPDATE; }
+#line 15422 "ora_gram.c"
+    break;
+
+  case 770: /* for_locking_strength: FOR NO KEY UPDATE  */
+#line 4565 "ora_gram.y"
+                                                                        { (yyval.ival) = LCS_FORNOKEYUPDATE; }
+#line 15428 "ora_gram.c"
+    break;
+
+  case 771: /* for_locking_strength: FOR SHARE  */
+#line 4566 "ora_gram.y"
+                                                                                { (yyval.ival) = LCS_FORSHARE; }
+#line 15434 "ora_gram.c"
+    break;
+
+  case 772: /* for_locking_strength: FOR KEY SHARE  */
+#line 4567 "ora_gram.y"
+                                                                                { (yyval.ival) = LCS_FORKEYSHARE; }
+#line 15440 "ora_gram.c"
+    break;
+
+  case 773: /* locked_rels_list: OF qualified_name_list  */
+#line 4571 "ora_gram.y"
+                                                                                { (yyval.list) = (yyvsp[0].list); }
+#line 15446 "ora_gram.c"
+    break;
+
+  case 774: /* locked_rels_list: %empty  */
+#line 4572 "ora_gram.y"
+                                                                                        { (yyval.list) = NIL; }
+#line 15452 "ora_gram.c"
+    break;
+
+  case 775: /* opt_nowait: NOWAIT  */
+#line 4575 "ora_gram.y"
+                                                                        { (yyval.boolean) = TRUE; }
+#line 15458 "ora_gram.c"
+    break;
+
+  case 776: /* opt_nowait: %empty  */
+#line 4576 "ora_gram.y"
+                                                                                { (yyval.boolean) = FALSE; }
+#line 15464 "ora_gram.c"
+    break;
+
+  case 777: /* select_limit: limit_clause offset_clause  */
+#line 4581 "ora_gram.y"
+                                                                        { (yyval.list) = list_make2((yyvsp[0].node), (yyvsp[-1].node)); }
+#line 15470 "ora_gram.c"
+    break;
+
+  case 778: /* select_limit: offset_clause limit_clause  */
+#line 4582 "ora_gram.y"
+                                                                { (yyval.list) = list_make2((yyvsp[-1].node), (yyvsp[0].node)); }
+#line 15476 "ora_gram.c"
+    break;
+
+  case 779: /* select_limit: limit_clause  */
+#line 4583 "ora_gram.y"
+                                                                                { (yyval.list) = list_make2(NULL, (yyvsp[0].node)); }
+#line 15482 "ora_gram.c"
+    break;
+
+  case 780: /* select_limit: offset_clause  */
+#line 4584 "ora_gram.y"
+                                                                                { (yyval.list) = list_make2((yyvsp[0].node), NULL); }
+#line 15488 "ora_gram.c"
+    break;
+
+  case 781: /* opt_select_limit: select_limit  */
+#line 4588 "ora_gram.y"
+                                                                                { (yyval.list) = (yyvsp[0].list); }
+#line 15494 "ora_gram.c"
+    break;
+
+  case 782: /* opt_select_limit: %empty  */
+#line 4589 "ora_gram.y"
+                                                                                { (yyval.list) = list_make2(NULL,NULL); }
+#line 15500 "ora_gram.c"
+    break;
+
+  case 783: /* limit_clause: LIMIT select_limit_value  */
+#line 4594 "ora_gram.y"
+                                { (yyval.node) = (yyvsp[0].node); }
+#line 15506 "ora_gram.c"
+    break;
+
+  case 784: /* limit_clause: LIMIT select_limit_value ',' select_offset_value  */
+#line 4596 "ora_gram.y"
+                                {
+					/* Disabled because it was too confusing, bjm 2002-02-18 */
+					ereport(ERROR,
+							(errcode(ERRCODE_SYNTAX_ERROR),
+							 errmsg("LIMIT #,# syntax is not supported"),
+							 errhint("Use separate LIMIT and OFFSET clauses."),
+							 parser_errposition((yylsp[-3]))));
+				}
+#line 15519 "ora_gram.c"
+    break;
+
+  case 785: /* offset_clause: OFFSET select_offset_value  */
+#line 4611 "ora_gram.y"
+                                { (yyval.node) = (yyvsp[0].node); }
+#line 15525 "ora_gram.c"
+    break;
+
+  case 786: /* offset_clause: OFFSET c_expr ROW  */
+#line 4615 "ora_gram.y"
+                                                        { (yyval.node) = (yyvsp[-1].node); }
+#line 15531 "ora_gram.c"
+    break;
+
+  case 787: /* offset_clause: OFFSET c_expr ROWS  */
+#line 4616 "ora_gram.y"
+                                                { (yyval.node) = (yyvsp[-1].node); }
+#line 15537 "ora_gram.c"
+    break;
+
+  case 788: /* select_limit_value: a_expr  */
+#line 4620 "ora_gram.y"
+                                                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 15543 "ora_gram.c"
+    break;
+
+  case 789: /* select_limit_value: ALL  */
+#line 4622 "ora_gram.y"
+                                {
+					/* LIMIT ALL is represented as a NULL constant */
+					(yyval.node) = makeNullAConst((yylsp[0]));
+				}
+#line 15552 "ora_gram.c"
+    break;
+
+  case 790: /* select_offset_value: a_expr  */
+#line 4629 "ora_gram.y"
+                                                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 15558 "ora_gram.c"
+    break;
+
+  case 792: /* set_expr: DEFAULT  */
+#line 4635 "ora_gram.y"
+                {
+			SetToDefault *n = makeNode(SetToDefault);
+			n->location = (yylsp[0]);
+			(yyval.node) = (Node *) n;
+		}
+#line 15568 "ora_gram.c"
+    break;
+
+  case 793: /* set_expr_list: set_expr  */
+#line 4642 "ora_gram.y"
+                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 15574 "ora_gram.c"
+    break;
+
+  case 794: /* set_expr_list: set_expr_list ',' set_expr  */
+#line 4643 "ora_gram.y"
+                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 15580 "ora_gram.c"
+    break;
+
+  case 795: /* set_expr_row: '(' set_expr_list ')'  */
+#line 4646 "ora_gram.y"
+                                                { (yyval.list) = (yyvsp[-1].list); }
+#line 15586 "ora_gram.c"
+    break;
+
+  case 796: /* set_rest: TRANSACTION transaction_mode_list  */
+#line 4651 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_MULTI;
+					n->name = "TRANSACTION";
+					n->args = (yyvsp[0].list);
+					(yyval.vsetstmt) = n;
+				}
+#line 15598 "ora_gram.c"
+    break;
+
+  case 797: /* set_rest: SESSION CHARACTERISTICS AS TRANSACTION transaction_mode_list  */
+#line 4659 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_MULTI;
+					n->name = "SESSION CHARACTERISTICS";
+					n->args = (yyvsp[0].list);
+					(yyval.vsetstmt) = n;
+				}
+#line 15610 "ora_gram.c"
+    break;
+
+  case 799: /* set_rest_more: var_name TO var_list  */
+#line 4671 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = (yyvsp[-2].str);
+					n->args = (yyvsp[0].list);
+					(yyval.vsetstmt) = n;
+				}
+#line 15622 "ora_gram.c"
+    break;
+
+  case 800: /* set_rest_more: var_name '=' var_list  */
+#line 4679 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = (yyvsp[-2].str);
+					n->args = (yyvsp[0].list);
+					(yyval.vsetstmt) = n;
+				}
+#line 15634 "ora_gram.c"
+    break;
+
+  case 801: /* set_rest_more: var_name TO DEFAULT  */
+#line 4687 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_DEFAULT;
+					n->name = (yyvsp[-2].str);
+					(yyval.vsetstmt) = n;
+				}
+#line 15645 "ora_gram.c"
+    break;
+
+  case 802: /* set_rest_more: var_name '=' DEFAULT  */
+#line 4694 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_DEFAULT;
+					n->name = (yyvsp[-2].str);
+					(yyval.vsetstmt) = n;
+				}
+#line 15656 "ora_gram.c"
+    break;
+
+  case 803: /* set_rest_more: var_name FROM CURRENT_P  */
+#line 4701 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_CURRENT;
+					n->name = (yyvsp[-2].str);
+					(yyval.vsetstmt) = n;
+				}
+#line 15667 "ora_gram.c"
+    break;
+
+  case 804: /* set_rest_more: TIME ZONE zone_value  */
+#line 4709 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = "timezone";
+					if ((yyvsp[0].node) != NULL)
+						n->args = list_make1((yyvsp[0].node));
+					else
+						n->kind = VAR_SET_DEFAULT;
+					(yyval.vsetstmt) = n;
+				}
+#line 15682 "ora_gram.c"
+    break;
+
+  case 805: /* set_rest_more: CATALOG_P Sconst  */
+#line 4720 "ora_gram.y"
+                                {
+					ereport(ERROR,
+							(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+							 errmsg("current database cannot be changed"),
+							 parser_errposition((yylsp[0]))));
+					(yyval.vsetstmt) = NULL; /*not reached*/
+				}
+#line 15694 "ora_gram.c"
+    break;
+
+  case 806: /* set_rest_more: SCHEMA Sconst  */
+#line 4728 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = "search_path";
+					n->args = list_make1(makeStringConst((yyvsp[0].str), (yylsp[0])));
+					(yyval.vsetstmt) = n;
+				}
+#line 15706 "ora_gram.c"
+    break;
+
+  case 807: /* set_rest_more: NAMES opt_encoding  */
+#line 4736 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = "client_encoding";
+					if ((yyvsp[0].str) != NULL)
+						n->args = list_make1(makeStringConst((yyvsp[0].str), (yylsp[0])));
+					else
+						n->kind = VAR_SET_DEFAULT;
+					(yyval.vsetstmt) = n;
+				}
+#line 15721 "ora_gram.c"
+    break;
+
+  case 808: /* set_rest_more: ROLE NonReservedWord_or_Sconst  */
+#line 4747 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = "role";
+					n->args = list_make1(makeStringConst((yyvsp[0].str), (yylsp[0])));
+					(yyval.vsetstmt) = n;
+				}
+#line 15733 "ora_gram.c"
+    break;
+
+  case 809: /* set_rest_more: SESSION AUTHORIZATION NonReservedWord_or_Sconst  */
+#line 4755 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = "session_authorization";
+					n->args = list_make1(makeStringConst((yyvsp[0].str), (yylsp[0])));
+					(yyval.vsetstmt) = n;
+				}
+#line 15745 "ora_gram.c"
+    break;
+
+  case 810: /* set_rest_more: SESSION AUTHORIZATION DEFAULT  */
+#line 4763 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_DEFAULT;
+					n->name = "session_authorization";
+					(yyval.vsetstmt) = n;
+				}
+#line 15756 "ora_gram.c"
+    break;
+
+  case 811: /* set_rest_more: XML_P OPTION document_or_content  */
+#line 4770 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_VALUE;
+					n->name = "xmloption";
+					n->args = list_make1(makeStringConst((yyvsp[0].ival) == XMLOPTION_DOCUMENT ? "DOCUMENT" : "CONTENT", (yylsp[0])));
+					(yyval.vsetstmt) = n;
+				}
+#line 15768 "ora_gram.c"
+    break;
+
+  case 812: /* set_rest_more: TRANSACTION SNAPSHOT Sconst  */
+#line 4779 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_SET_MULTI;
+					n->name = "TRANSACTION SNAPSHOT";
+					n->args = list_make1(makeStringConst((yyvsp[0].str), (yylsp[0])));
+					(yyval.vsetstmt) = n;
+				}
+#line 15780 "ora_gram.c"
+    break;
+
+  case 813: /* set_target: ColId opt_indirection  */
+#line 4790 "ora_gram.y"
+                {
+			(yyval.target) = makeNode(ResTarget);
+			(yyval.target)->name = (yyvsp[-1].str);
+			(yyval.target)->indirection = check_indirection((yyvsp[0].list), yyscanner);
+			(yyval.target)->val = NULL;	/* upper production sets this */
+			(yyval.target)->location = (yylsp[-1]);
+		}
+#line 15792 "ora_gram.c"
+    break;
+
+  case 814: /* set_target_list: set_target  */
+#line 4800 "ora_gram.y"
+                                                                                                { (yyval.list) = list_make1((yyvsp[0].target)); }
+#line 15798 "ora_gram.c"
+    break;
+
+  case 815: /* set_target_list: set_target_list ',' set_target  */
+#line 4801 "ora_gram.y"
+                                                                        { (yyval.list) = lappend((yyvsp[-2].list),(yyvsp[0].target)); }
+#line 15804 "ora_gram.c"
+    break;
+
+  case 816: /* SignedIconst: Iconst  */
+#line 4804 "ora_gram.y"
+                                                                                { (yyval.ival) = (yyvsp[0].ival); }
+#line 15810 "ora_gram.c"
+    break;
+
+  case 817: /* SignedIconst: '+' Iconst  */
+#line 4805 "ora_gram.y"
+                                                                                        { (yyval.ival) = + (yyvsp[0].ival); }
+#line 15816 "ora_gram.c"
+    break;
+
+  case 818: /* SignedIconst: '-' Iconst  */
+#line 4806 "ora_gram.y"
+                                                                                        { (yyval.ival) = - (yyvsp[0].ival); }
+#line 15822 "ora_gram.c"
+    break;
+
+  case 819: /* single_set_clause: set_target '=' set_expr  */
+#line 4811 "ora_gram.y"
+                                {
+					(yyval.target) = (yyvsp[-2].target);
+					(yyval.target)->val = (Node *) (yyvsp[0].node);
+				}
+#line 15831 "ora_gram.c"
+    break;
+
+  case 825: /* SimpleTypename: INTERVAL YEAR_P opt_type_mod TO MONTH_P  */
+#line 4824 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("interval", (yylsp[-4]));
+			(yyval.typnam)->typmods = list_make1(makeIntConst(INTERVAL_MASK(YEAR) |
+											 INTERVAL_MASK(MONTH), (yylsp[-4])));
+			if((yyvsp[-2].list))
+				(yyval.typnam)->typmods = lappend((yyval.typnam)->typmods, (yyvsp[-2].list));
+		}
+#line 15843 "ora_gram.c"
+    break;
+
+  case 826: /* SimpleTypename: INTERVAL DAY_P opt_type_mod TO SECOND_P  */
+#line 4832 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("interval", (yylsp[-4]));
+			(yyval.typnam)->typmods = list_make1(makeIntConst(INTERVAL_MASK(DAY) |
+												INTERVAL_MASK(HOUR) |
+												INTERVAL_MASK(MINUTE) |
+												INTERVAL_MASK(SECOND), (yylsp[-4])));
+			if((yyvsp[-2].list))
+				(yyval.typnam)->typmods = lappend((yyval.typnam)->typmods, (yyvsp[-2].list));
+		}
+#line 15857 "ora_gram.c"
+    break;
+
+  case 827: /* SimpleTypename: INTERVAL DAY_P opt_type_mod TO SECOND_P '(' Iconst ')'  */
+#line 4842 "ora_gram.y"
+                {
+			(yyval.typnam) = SystemTypeNameLocation("interval", (yylsp[-7]));
+			(yyval.typnam)->typmods = list_make1(makeIntConst(INTERVAL_MASK(DAY) |
+												INTERVAL_MASK(HOUR) |
+												INTERVAL_MASK(MINUTE) |
+												INTERVAL_MASK(SECOND), (yylsp[-7])));
+			if((yyvsp[-5].list))
+				(yyval.typnam)->typmods = lappend((yyval.typnam)->typmods, (yyvsp[-5].list));
+		}
+#line 15871 "ora_gram.c"
+    break;
+
+  case 828: /* simple_select: SELECT opt_distinct target_list from_clause where_clause group_clause having_clause  */
+#line 4867 "ora_gram.y"
+                        {
+				SelectStmt *n = makeNode(SelectStmt);
+				n->distinctClause = (yyvsp[-5].list);
+				n->targetList = (yyvsp[-4].list);
+				n->fromClause = (yyvsp[-3].list);
+				n->whereClause = (yyvsp[-2].node);
+				n->groupClause = (yyvsp[-1].list);
+				n->havingClause = (yyvsp[0].node);
+				(yyval.node) = (Node*)n;
+			}
+#line 15886 "ora_gram.c"
+    break;
+
+  case 829: /* simple_select: SELECT opt_distinct target_list from_clause where_clause group_clause having_clause start_with_clause connect_by_clause  */
+#line 4880 "ora_gram.y"
+                        {
+				SelectStmt *n = makeNode(SelectStmt);
+				n->distinctClause = (yyvsp[-7].list);
+				n->targetList = (yyvsp[-6].list);
+				n->fromClause = (yyvsp[-5].list);
+				n->whereClause = (yyvsp[-4].node);
+				n->groupClause = (yyvsp[-3].list);
+				n->havingClause = (yyvsp[-2].node);
+				(yyval.node) = makeConnectByStmt(n, (yyvsp[-1].node), linitial((yyvsp[0].list)),
+									   intVal(lsecond((yyvsp[0].list))), yyscanner);
+			}
+#line 15902 "ora_gram.c"
+    break;
+
+  case 830: /* simple_select: SELECT opt_distinct target_list from_clause where_clause group_clause having_clause connect_by_clause opt_start_with_clause  */
+#line 4894 "ora_gram.y"
+                        {
+				SelectStmt *n = makeNode(SelectStmt);
+				n->distinctClause = (yyvsp[-7].list);
+				n->targetList = (yyvsp[-6].list);
+				n->fromClause = (yyvsp[-5].list);
+				n->whereClause = (yyvsp[-4].node);
+				n->groupClause = (yyvsp[-3].list);
+				n->havingClause = (yyvsp[-2].node);
+				(yyval.node) = makeConnectByStmt(n, (yyvsp[0].node), linitial((yyvsp[-1].list)),
+									   intVal(lsecond((yyvsp[-1].list))), yyscanner);
+			}
+#line 15918 "ora_gram.c"
+    break;
+
+  case 831: /* simple_select: select_clause UNION opt_all select_clause  */
+#line 4906 "ora_gram.y"
+                        {
+				(yyval.node) = makeSetOp(SETOP_UNION, (yyvsp[-1].boolean), (yyvsp[-3].node), (yyvsp[0].node));
+			}
+#line 15926 "ora_gram.c"
+    break;
+
+  case 832: /* simple_select: select_clause MINUS opt_all select_clause  */
+#line 4910 "ora_gram.y"
+                        {
+				(yyval.node) = makeSetOp(SETOP_EXCEPT, (yyvsp[-1].boolean), (yyvsp[-3].node), (yyvsp[0].node));
+			}
+#line 15934 "ora_gram.c"
+    break;
+
+  case 833: /* simple_select: values_clause  */
+#line 4913 "ora_gram.y"
+                                { (yyval.node) = (yyvsp[0].node); }
+#line 15940 "ora_gram.c"
+    break;
+
+  case 834: /* sortby: a_expr opt_asc_desc  */
+#line 4917 "ora_gram.y"
+                {
+			(yyval.sortby) = makeNode(SortBy);
+			(yyval.sortby)->node = (yyvsp[-1].node);
+			(yyval.sortby)->sortby_dir = (yyvsp[0].ival);
+			(yyval.sortby)->sortby_nulls = SORTBY_NULLS_DEFAULT;
+			(yyval.sortby)->useOp = NIL;
+			(yyval.sortby)->location = -1;		/* no operator */
+		}
+#line 15953 "ora_gram.c"
+    break;
+
+  case 835: /* sortby_list: sortby  */
+#line 4927 "ora_gram.y"
+                                                                { (yyval.list) = list_make1((yyvsp[0].sortby)); }
+#line 15959 "ora_gram.c"
+    break;
+
+  case 836: /* sortby_list: sortby_list ',' sortby  */
+#line 4928 "ora_gram.y"
+                                                        { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].sortby)); }
+#line 15965 "ora_gram.c"
+    break;
+
+  case 837: /* sort_clause: ORDER BY sortby_list  */
+#line 4931 "ora_gram.y"
+                                                { (yyval.list) = (yyvsp[0].list); }
+#line 15971 "ora_gram.c"
+    break;
+
+  case 838: /* opt_sort_clause: sort_clause  */
+#line 4935 "ora_gram.y"
+                                                                { (yyval.list) = (yyvsp[0].list); }
+#line 15977 "ora_gram.c"
+    break;
+
+  case 839: /* opt_sort_clause: %empty  */
+#line 4936 "ora_gram.y"
+                                                                { (yyval.list) = NIL; }
+#line 15983 "ora_gram.c"
+    break;
+
+  case 840: /* opt_start_with_clause: start_with_clause  */
+#line 4940 "ora_gram.y"
+                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 15989 "ora_gram.c"
+    break;
+
+  case 841: /* opt_start_with_clause: %empty  */
+#line 4941 "ora_gram.y"
+                                                                { (yyval.node) = NULL; }
+#line 15995 "ora_gram.c"
+    break;
+
+  case 842: /* start_with_clause: START WITH a_expr  */
+#line 4944 "ora_gram.y"
+                                                { (yyval.node) = (yyvsp[0].node); }
+#line 16001 "ora_gram.c"
+    break;
+
+  case 843: /* connect_by_clause: CONNECT_BY a_expr  */
+#line 4950 "ora_gram.y"
+                { (yyval.list) = list_make2((yyvsp[0].node), makeInteger(FALSE)); }
+#line 16007 "ora_gram.c"
+    break;
+
+  case 844: /* connect_by_clause: CONNECT_BY_NOCYCLE a_expr  */
+#line 4952 "ora_gram.y"
+                { (yyval.list) = list_make2((yyvsp[0].node), makeInteger(TRUE)); }
+#line 16013 "ora_gram.c"
+    break;
+
+  case 845: /* TableElement: columnDef  */
+#line 4956 "ora_gram.y"
+                                                                        { (yyval.node) = (yyvsp[0].node); }
+#line 16019 "ora_gram.c"
+    break;
+
+  case 846: /* TableElement: TableLikeClause  */
+#line 4957 "ora_gram.y"
+                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 16025 "ora_gram.c"
+    break;
+
+  case 847: /* TableElement: TableConstraint  */
+#line 4958 "ora_gram.y"
+                                                                { (yyval.node) = (yyvsp[0].node); }
+#line 16031 "ora_gram.c"
+    break;
+
+  case 848: /* TableLikeClause: LIKE qualified_name TableLikeOptionList  */
+#line 4963 "ora_gram.y"
+                                {
+					TableLikeClause *n = makeNode(TableLikeClause);
+					n->relation = (yyvsp[-1].range);
+					n->options = (yyvsp[0].ival);
+					(yyval.node) = (Node *)n;
+				}
+#line 16042 "ora_gram.c"
+    break;
+
+  case 849: /* TableLikeOptionList: TableLikeOptionList INCLUDING TableLikeOption  */
+#line 4972 "ora_gram.y"
+                                                                                { (yyval.ival) = (yyvsp[-2].ival) | (yyvsp[0].ival); }
+#line 16048 "ora_gram.c"
+    break;
+
+  case 850: /* TableLikeOptionList: TableLikeOptionList EXCLUDING TableLikeOption  */
+#line 4973 "ora_gram.y"
+                                                                                { (yyval.ival) = (yyvsp[-2].ival) & ~(yyvsp[0].ival); }
+#line 16054 "ora_gram.c"
+    break;
+
+  case 851: /* TableLikeOptionList: %empty  */
+#line 4974 "ora_gram.y"
+                                                                                        { (yyval.ival) = 0; }
+#line 16060 "ora_gram.c"
+    break;
+
+  case 852: /* TableLikeOption: DEFAULTS  */
+#line 4978 "ora_gram.y"
+                                                                { (yyval.ival) = CREATE_TABLE_LIKE_DEFAULTS; }
+#line 16066 "ora_gram.c"
+    break;
+
+  case 853: /* TableLikeOption: CONSTRAINTS  */
+#line 4979 "ora_gram.y"
+                                                        { (yyval.ival) = CREATE_TABLE_LIKE_CONSTRAINTS; }
+#line 16072 "ora_gram.c"
+    break;
+
+  case 854: /* TableLikeOption: INDEXES  */
+#line 4980 "ora_gram.y"
+                                                                { (yyval.ival) = CREATE_TABLE_LIKE_INDEXES; }
+#line 16078 "ora_gram.c"
+    break;
+
+  case 855: /* TableLikeOption: STORAGE  */
+#line 4981 "ora_gram.y"
+                                                                { (yyval.ival) = CREATE_TABLE_LIKE_STORAGE; }
+#line 16084 "ora_gram.c"
+    break;
+
+  case 856: /* TableLikeOption: COMMENTS  */
+#line 4982 "ora_gram.y"
+                                                                { (yyval.ival) = CREATE_TABLE_LIKE_COMMENTS; }
+#line 16090 "ora_gram.c"
+    break;
+
+  case 857: /* TableLikeOption: ALL  */
+#line 4983 "ora_gram.y"
+                                                                { (yyval.ival) = CREATE_TABLE_LIKE_ALL; }
+#line 16096 "ora_gram.c"
+    break;
+
+  case 858: /* TableElementList: TableElement  */
+#line 4987 "ora_gram.y"
+                                                                { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 16102 "ora_gram.c"
+    break;
+
+  case 859: /* TableElementList: TableElementList ',' TableElement  */
+#line 4988 "ora_gram.y"
+                                            { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 16108 "ora_gram.c"
+    break;
+
+  case 860: /* table_ref: relation_expr opt_alias_clause  */
+#line 4993 "ora_gram.y"
+                        {
+				(yyvsp[-1].range)->alias = (yyvsp[0].alias);
+				(yyval.node) = (Node*) (yyvsp[-1].range);
+			}
+#line 16117 "ora_gram.c"
+    break;
+
+  case 861: /* table_ref: select_with_parens opt_alias_clause  */
+#line 4998 "ora_gram.y"
+                        {
+				RangeSubselect *n = makeNode(RangeSubselect);
+				n->lateral = false;
+				n->subquery = (yyvsp[-1].node);
+				n->alias = (yyvsp[0].alias);
+				if(n->alias == NULL)
+					ora_yyget_extra(yyscanner)->has_no_alias_subquery = true;
+				(yyval.node) = (Node *) n;
+			}
+#line 16131 "ora_gram.c"
+    break;
+
+  case 862: /* table_ref: joined_table  */
+#line 5008 "ora_gram.y"
+                        {
+				(yyval.node) = (Node *) (yyvsp[0].jexpr);
+			}
+#line 16139 "ora_gram.c"
+    break;
+
+  case 863: /* table_ref: '(' joined_table ')' alias_clause  */
+#line 5012 "ora_gram.y"
+                        {
+				(yyvsp[-2].jexpr)->alias = (yyvsp[0].alias);
+				(yyval.node) = (Node *) (yyvsp[-2].jexpr);
+			}
+#line 16148 "ora_gram.c"
+    break;
+
+  case 864: /* target_item: a_expr AS ColLabel  */
+#line 5020 "ora_gram.y"
+                        {
+				(yyval.target) = makeNode(ResTarget);
+				(yyval.target)->name = (yyvsp[0].str);
+				(yyval.target)->indirection = NIL;
+				(yyval.target)->val = (Node *)(yyvsp[-2].node);
+				(yyval.target)->location = (yylsp[-2]);
+			}
+#line 16160 "ora_gram.c"
+    break;
+
+  case 865: /* target_item: a_expr IDENT  */
+#line 5028 "ora_gram.y"
+                        {
+				(yyval.target) = makeNode(ResTarget);
+				(yyval.target)->name = (yyvsp[0].str);
+				(yyval.target)->indirection = NIL;
+				(yyval.target)->val = (Node *)(yyvsp[-1].node);
+				(yyval.target)->location = (yylsp[-1]);
+			}
+#line 16172 "ora_gram.c"
+    break;
+
+  case 866: /* target_item: a_expr  */
+#line 5036 "ora_gram.y"
+                        {
+				(yyval.target) = makeNode(ResTarget);
+				(yyval.target)->name = NULL;
+				(yyval.target)->indirection = NIL;
+				(yyval.target)->val = (Node *)(yyvsp[0].node);
+				(yyval.target)->location = (yylsp[0]);
+			}
+#line 16184 "ora_gram.c"
+    break;
+
+  case 867: /* target_item: '*'  */
+#line 5044 "ora_gram.y"
+                        {
+				(yyval.target) = make_star_target((yylsp[0]));
+			}
+#line 16192 "ora_gram.c"
+    break;
+
+  case 868: /* target_list: target_item  */
+#line 5050 "ora_gram.y"
+                                                                { (yyval.list) = list_make1((yyvsp[0].target)); }
+#line 16198 "ora_gram.c"
+    break;
+
+  case 869: /* target_list: target_list ',' target_item  */
+#line 5051 "ora_gram.y"
+                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].target)); }
+#line 16204 "ora_gram.c"
+    break;
+
+  case 870: /* transaction_mode_item: ISOLATION LEVEL iso_level  */
+#line 5056 "ora_gram.y"
+                                        { (yyval.defelt) = makeDefElem("transaction_isolation",
+									   makeStringConst((yyvsp[0].str), (yylsp[0]))); }
+#line 16211 "ora_gram.c"
+    break;
+
+  case 871: /* transaction_mode_item: READ ONLY  */
+#line 5059 "ora_gram.y"
+                                        { (yyval.defelt) = makeDefElem("transaction_read_only",
+									   makeIntConst(TRUE, (yylsp[-1]))); }
+#line 16218 "ora_gram.c"
+    break;
+
+  case 872: /* transaction_mode_item: READ WRITE  */
+#line 5062 "ora_gram.y"
+                                        { (yyval.defelt) = makeDefElem("transaction_read_only",
+									   makeIntConst(FALSE, (yylsp[-1]))); }
+#line 16225 "ora_gram.c"
+    break;
+
+  case 873: /* transaction_mode_item: DEFERRABLE  */
+#line 5065 "ora_gram.y"
+                                        { (yyval.defelt) = makeDefElem("transaction_deferrable",
+									   makeIntConst(TRUE, (yylsp[0]))); }
+#line 16232 "ora_gram.c"
+    break;
+
+  case 874: /* transaction_mode_item: NOT DEFERRABLE  */
+#line 5068 "ora_gram.y"
+                                        { (yyval.defelt) = makeDefElem("transaction_deferrable",
+									   makeIntConst(FALSE, (yylsp[-1]))); }
+#line 16239 "ora_gram.c"
+    break;
+
+  case 875: /* transaction_mode_list: transaction_mode_item  */
+#line 5075 "ora_gram.y"
+                                        { (yyval.list) = list_make1((yyvsp[0].defelt)); }
+#line 16245 "ora_gram.c"
+    break;
+
+  case 876: /* transaction_mode_list: transaction_mode_list ',' transaction_mode_item  */
+#line 5077 "ora_gram.y"
+                                        { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].defelt)); }
+#line 16251 "ora_gram.c"
+    break;
+
+  case 877: /* transaction_mode_list: transaction_mode_list transaction_mode_item  */
+#line 5079 "ora_gram.y"
+                                        { (yyval.list) = lappend((yyvsp[-1].list), (yyvsp[0].defelt)); }
+#line 16257 "ora_gram.c"
+    break;
+
+  case 878: /* TruncateStmt: TRUNCATE TABLE relation_expr_list opt_restart_seqs opt_drop_behavior TruncateStmt_log_opt TruncateStmt_storage_opt  */
+#line 5085 "ora_gram.y"
+                {
+			TruncateStmt *n = makeNode(TruncateStmt);
+			n->relations = (yyvsp[-4].list);
+			n->restart_seqs = (yyvsp[-3].boolean);
+			n->behavior = (yyvsp[-2].dbehavior);
+			/* ignore TruncateStmt_log_opt and TruncateStmt_storage_opt */
+			(yyval.node) = (Node*)n;
+		}
+#line 16270 "ora_gram.c"
+    break;
+
+  case 887: /* type_function_name: IDENT  */
+#line 5119 "ora_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 16276 "ora_gram.c"
+    break;
+
+  case 888: /* type_function_name: unreserved_keyword  */
+#line 5120 "ora_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 16282 "ora_gram.c"
+    break;
+
+  case 889: /* type_function_name: type_func_name_keyword  */
+#line 5121 "ora_gram.y"
+                                                                                { (yyval.str) = pstrdup((yyvsp[0].keyword)); }
+#line 16288 "ora_gram.c"
+    break;
+
+  case 890: /* UpdateStmt: UPDATE relation_expr_opt_alias SET set_clause_list where_clause returning_clause  */
+#line 5127 "ora_gram.y"
+                {
+			UpdateStmt *n = makeNode(UpdateStmt);
+			n->relation = (yyvsp[-4].range);
+			n->targetList = (yyvsp[-2].list);
+			n->whereClause = (yyvsp[-1].node);
+			n->returningList = (yyvsp[0].list);
+			(yyval.node) = (Node*)n;
+		}
+#line 16301 "ora_gram.c"
+    break;
+
+  case 891: /* values_clause: VALUES ctext_row  */
+#line 5139 "ora_gram.y"
+                        {
+				SelectStmt *n = makeNode(SelectStmt);
+				n->valuesLists = list_make1((yyvsp[0].list));
+				(yyval.node) = (Node *) n;
+			}
+#line 16311 "ora_gram.c"
+    break;
+
+  case 892: /* values_clause: values_clause ',' ctext_row  */
+#line 5145 "ora_gram.y"
+                        {
+				SelectStmt *n = (SelectStmt *) (yyvsp[-2].node);
+				n->valuesLists = lappend(n->valuesLists, (yyvsp[0].list));
+				(yyval.node) = (Node *) n;
+			}
+#line 16321 "ora_gram.c"
+    break;
+
+  case 893: /* var_list: var_value  */
+#line 5152 "ora_gram.y"
+                                                                                        { (yyval.list) = list_make1((yyvsp[0].node)); }
+#line 16327 "ora_gram.c"
+    break;
+
+  case 894: /* var_list: var_list ',' var_value  */
+#line 5153 "ora_gram.y"
+                                                                                { (yyval.list) = lappend((yyvsp[-2].list), (yyvsp[0].node)); }
+#line 16333 "ora_gram.c"
+    break;
+
+  case 895: /* var_value: opt_boolean_or_string  */
+#line 5157 "ora_gram.y"
+                                { (yyval.node) = makeStringConst((yyvsp[0].str), (yylsp[0])); }
+#line 16339 "ora_gram.c"
+    break;
+
+  case 896: /* var_value: NumericOnly  */
+#line 5159 "ora_gram.y"
+                                { (yyval.node) = makeAConst((yyvsp[0].value), (yylsp[0])); }
+#line 16345 "ora_gram.c"
+    break;
+
+  case 897: /* var_name: ColId  */
+#line 5162 "ora_gram.y"
+                                                                                { (yyval.str) = (yyvsp[0].str); }
+#line 16351 "ora_gram.c"
+    break;
+
+  case 898: /* var_name: var_name '.' ColId  */
+#line 5164 "ora_gram.y"
+                                {
+					(yyval.str) = palloc(strlen((yyvsp[-2].str)) + strlen((yyvsp[0].str)) + 2);
+					sprintf((yyval.str), "%s.%s", (yyvsp[-2].str), (yyvsp[0].str));
+				}
+#line 16360 "ora_gram.c"
+    break;
+
+  case 899: /* VariableResetStmt: RESET var_name  */
+#line 5172 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_RESET;
+					n->name = (yyvsp[0].str);
+					(yyval.node) = (Node *) n;
+				}
+#line 16371 "ora_gram.c"
+    break;
+
+  case 900: /* VariableResetStmt: RESET TIME ZONE  */
+#line 5179 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_RESET;
+					n->name = "timezone";
+					(yyval.node) = (Node *) n;
+				}
+#line 16382 "ora_gram.c"
+    break;
+
+  case 901: /* VariableResetStmt: RESET TRANSACTION ISOLATION LEVEL  */
+#line 5186 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_RESET;
+					n->name = "transaction_isolation";
+					(yyval.node) = (Node *) n;
+				}
+#line 16393 "ora_gram.c"
+    break;
+
+  case 902: /* VariableResetStmt: RESET SESSION AUTHORIZATION  */
+#line 5193 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_RESET;
+					n->name = "session_authorization";
+					(yyval.node) = (Node *) n;
+				}
+#line 16404 "ora_gram.c"
+    break;
+
+  case 903: /* VariableResetStmt: RESET ALL  */
+#line 5200 "ora_gram.y"
+                                {
+					VariableSetStmt *n = makeNode(VariableSetStmt);
+					n->kind = VAR_RESET_ALL;
+					(yyval.node) = (Node *) n;
+				}
+#line 16414 "ora_gram.c"
+    break;
+
+  case 904: /* VariableSetStmt: SET set_rest  */
+#line 5218 "ora_gram.y"
+                                {
+					VariableSetStmt *n = (yyvsp[0].vsetstmt);
+					n->is_local = false;
+					(yyval.node) = (Node *) n;
+				}
+#line 16424 "ora_gram.c"
+    break;
+
+  case 905: /* VariableSetStmt: SET LOCAL set_rest  */
+#line 5224 "ora_gram.y"
+                                {
+					VariableSetStmt *n = (yyvsp[0].vsetstmt);
+					n->is_local = true;
+					(yyval.node) = (Node *) n;
+				}
+#line 16434 "ora_gram.c"
+    break;
+
+  case 906: /* VariableSetStmt: SET SESSION set_rest  */
+#line 5230 "ora_gram.y"
+                                {
+					VariableSetStmt *n = (yyvsp[0].vsetstmt);
+					n->is_local = false;
+					(yyval.node) = (Node *) n;
+				}
+#line 16444 "ora_gram.c"
+    break;
+
+  case 907: /* VariableShowStmt: SHOW var_name  */
+#line 5239 "ora_gram.y"
+                {
+			VariableShowStmt *n = makeNode(VariableShowStmt);
+			n->name = (yyvsp[0].str);
+			(yyval.node) = (Node *) n; 
+		}
+#line 16454 "ora_gram.c"
+    break;
+
+  case 908: /* VariableShowStmt: SHOW TIME ZONE  */
+#line 5245 "ora_gram.y"
+                 {
+                         VariableShowStmt *n = makeNode(VariableShowStmt);
+                         n->name = "timezone";
+                         (yyval.node) = (Node *) n;
+                 }
+#line 16464 "ora_gram.c"
+    break;
+
+  case 909: /* VariableShowStmt: SHOW TRANSACTION ISOLATION LEVEL  */
+#line 5251 "ora_gram.y"
+                 {
+                         VariableShowStmt *n = makeNode(VariableShowStmt);
+                         n->name = "transaction_isolation";
+                         (yyval.node) = (Node *) n;
+                 }
+#line 16474 "ora_gram.c"
+    break;
+
+  case 910: /* VariableShowStmt: SHOW SESSION AUTHORIZATION  */
+#line 5257 "ora_gram.y"
+                 {
+                         VariableShowStmt *n = makeNode(VariableShowStmt);
+                         n->name = "session_authorization";
+                         (yyval.node) = (Node *) n;
+                 }
+#line 16484 "ora_gram.c"
+    break;
+
+  case 911: /* VariableShowStmt: SHOW ALL  */
+#line 5263 "ora_gram.y"
+                 {
+                         VariableShowStmt *n = makeNode(VariableShowStmt);
+                         n->name = "all";
+                         (yyval.node) = (Node *) n;
+                 }
+#line 16494 "ora_gram.c"
+    break;
+
+  case 912: /* ViewStmt: CREATE OptTemp VIEW qualified_name opt_column_list AS SelectStmt  */
+#line 5280 "ora_gram.y"
+                                {
+					ViewStmt *n = makeNode(ViewStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->view = (yyvsp[-3].range);
+					n->view->relpersistence = (yyvsp[-5].ival);
+					n->aliases = (yyvsp[-2].list);
+					n->query = (yyvsp[0].node);
+					n->replace = false;
+					/* n->options = $6; */
+					(yyval.node) = (Node *) n;
+				}
+#line 16510 "ora_gram.c"
+    break;
+
+  case 913: /* ViewStmt: CREATE OR REPLACE OptTemp VIEW qualified_name opt_column_list opt_reloptions AS SelectStmt  */
+#line 5293 "ora_gram.y"
+                                {
+					ViewStmt *n = makeNode(ViewStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->view = (yyvsp[-4].range);
+					n->view->relpersistence = (yyvsp[-6].ival);
+					n->aliases = (yyvsp[-3].list);
+					n->query = (yyvsp[0].node);
+					n->replace = true;
+					n->options = (yyvsp[-2].list);
+					(yyval.node) = (Node *) n;
+				}
+#line 16526 "ora_gram.c"
+    break;
+
+  case 914: /* ViewStmt: CREATE OptTemp RECURSIVE VIEW qualified_name '(' columnList ')' AS SelectStmt  */
+#line 5306 "ora_gram.y"
+                                {
+					ViewStmt *n = makeNode(ViewStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->view = (yyvsp[-5].range);
+					n->view->relpersistence = (yyvsp[-8].ival);
+					n->aliases = (yyvsp[-3].list);
+					n->query = makeRecursiveViewSelect(n->view->relname, n->aliases, (yyvsp[0].node));
+					n->replace = false;
+					/* n->options = $9;*/
+					(yyval.node) = (Node *) n;
+				}
+#line 16542 "ora_gram.c"
+    break;
+
+  case 915: /* ViewStmt: CREATE OR REPLACE OptTemp RECURSIVE VIEW qualified_name '(' columnList ')' AS SelectStmt  */
+#line 5319 "ora_gram.y"
+                                {
+					ViewStmt *n = makeNode(ViewStmt);
+					n->grammar = PARSE_GRAM_ORACLE;
+					n->view = (yyvsp[-5].range);
+					n->view->relpersistence = (yyvsp[-8].ival);
+					n->aliases = (yyvsp[-3].list);
+					n->query = makeRecursiveViewSelect(n->view->relname, n->aliases, (yyvsp[0].node));
+					n->replace = true;
+					/* n->options = $11;*/
+					(yyval.node) = (Node *) n;
+				}
+#line 16558 "ora_gram.c"
+    break;
+
+  case 916: /* where_clause: WHERE a_expr  */
+#line 5349 "ora_gram.y"
+                                { (yyval.node) = (yyvsp[0].node); }
+#line 16564 "ora_gram.c"
+    break;
+
+  case 917: /* where_clause: %empty  */
+#line 5350 "ora_gram.y"
+                      { (yyval.node) = NULL; }
+#line 16570 "ora_gram.c"
+    break;
+
+  case 918: /* with_clause: WITH cte_list  */
+#line 5355 "ora_gram.y"
+                {
+			(yyval.with) = makeNode(WithClause);
+			(yyval.with)->ctes = (yyvsp[0].list);
+			(yyval.with)->recursive = false;
+			(yyval.with)->location = (yylsp[-1]);
+		}
+#line 16581 "ora_gram.c"
+    break;
+
+  case 919: /* with_clause: WITH RECURSIVE cte_list  */
+#line 5362 "ora_gram.y"
+                {
+			(yyval.with) = makeNode(WithClause);
+			(yyval.with)->ctes = (yyvsp[0].list);
+			(yyval.with)->recursive = true;
+			(yyval.with)->location = (yylsp[-2]);
+		}
+#line 16592 "ora_gram.c"
+    break;
+
+  case 920: /* TransactionStmt: ABORT_P opt_transaction  */
+#line 5381 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_ROLLBACK;
+					n->options = NIL;
+					(yyval.node) = (Node *)n;
+				}
+#line 16603 "ora_gram.c"
+    break;
+
+  case 921: /* TransactionStmt: BEGIN_P opt_transaction transaction_mode_list_or_empty  */
+#line 5388 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_BEGIN;
+					n->options = (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 16614 "ora_gram.c"
+    break;
+
+  case 922: /* TransactionStmt: START TRANSACTION transaction_mode_list_or_empty  */
+#line 5395 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_START;
+					n->options = (yyvsp[0].list);
+					(yyval.node) = (Node *)n;
+				}
+#line 16625 "ora_gram.c"
+    break;
+
+  case 923: /* TransactionStmt: COMMIT opt_transaction  */
+#line 5402 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_COMMIT;
+					n->options = NIL;
+					(yyval.node) = (Node *)n;
+				}
+#line 16636 "ora_gram.c"
+    break;
+
+  case 924: /* TransactionStmt: END_P opt_transaction  */
+#line 5409 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_COMMIT;
+					n->options = NIL;
+					(yyval.node) = (Node *)n;
+				}
+#line 16647 "ora_gram.c"
+    break;
+
+  case 925: /* TransactionStmt: ROLLBACK opt_transaction  */
+#line 5416 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_ROLLBACK;
+					n->options = NIL;
+					(yyval.node) = (Node *)n;
+				}
+#line 16658 "ora_gram.c"
+    break;
+
+  case 926: /* TransactionStmt: SAVEPOINT ColId  */
+#line 5423 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_SAVEPOINT;
+					n->options = list_make1(makeDefElem("savepoint_name",
+														(Node *)makeString((yyvsp[0].str))));
+					(yyval.node) = (Node *)n;
+				}
+#line 16670 "ora_gram.c"
+    break;
+
+  case 927: /* TransactionStmt: RELEASE SAVEPOINT ColId  */
+#line 5431 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_RELEASE;
+					n->options = list_make1(makeDefElem("savepoint_name",
+														(Node *)makeString((yyvsp[0].str))));
+					(yyval.node) = (Node *)n;
+				}
+#line 16682 "ora_gram.c"
+    break;
+
+  case 928: /* TransactionStmt: RELEASE ColId  */
+#line 5439 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_RELEASE;
+					n->options = list_make1(makeDefElem("savepoint_name",
+														(Node *)makeString((yyvsp[0].str))));
+					(yyval.node) = (Node *)n;
+				}
+#line 16694 "ora_gram.c"
+    break;
+
+  case 929: /* TransactionStmt: ROLLBACK opt_transaction TO SAVEPOINT ColId  */
+#line 5447 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_ROLLBACK_TO;
+					n->options = list_make1(makeDefElem("savepoint_name",
+														(Node *)makeString((yyvsp[0].str))));
+					(yyval.node) = (Node *)n;
+				}
+#line 16706 "ora_gram.c"
+    break;
+
+  case 930: /* TransactionStmt: ROLLBACK opt_transaction TO ColId  */
+#line 5455 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_ROLLBACK_TO;
+					n->options = list_make1(makeDefElem("savepoint_name",
+														(Node *)makeString((yyvsp[0].str))));
+					(yyval.node) = (Node *)n;
+				}
+#line 16718 "ora_gram.c"
+    break;
+
+  case 931: /* TransactionStmt: PREPARE TRANSACTION Sconst  */
+#line 5463 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_PREPARE;
+					n->gid = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 16729 "ora_gram.c"
+    break;
+
+  case 932: /* TransactionStmt: COMMIT PREPARED Sconst  */
+#line 5470 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_COMMIT_PREPARED;
+					n->gid = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 16740 "ora_gram.c"
+    break;
+
+  case 933: /* TransactionStmt: ROLLBACK PREPARED Sconst  */
+#line 5477 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+					n->kind = TRANS_STMT_ROLLBACK_PREPARED;
+					n->gid = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 16751 "ora_gram.c"
+    break;
+
+  case 934: /* TransactionStmt: COMMIT PREPARED IF_P EXISTS Sconst  */
+#line 5484 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+#if defined(ADB)
+					n->missing_ok = true;
+#endif
+					n->kind = TRANS_STMT_COMMIT_PREPARED;
+					n->gid = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 16765 "ora_gram.c"
+    break;
+
+  case 935: /* TransactionStmt: ROLLBACK PREPARED IF_P EXISTS Sconst  */
+#line 5494 "ora_gram.y"
+                                {
+					TransactionStmt *n = makeNode(TransactionStmt);
+#if defined(ADB)
+					n->missing_ok = true;
+#endif
+					n->kind = TRANS_STMT_ROLLBACK_PREPARED;
+					n->gid = (yyvsp[0].str);
+					(yyval.node) = (Node *)n;
+				}
+#line 16779 "ora_gram.c"
+    break;
+
+  case 936: /* opt_transaction: WORK  */
+#line 5505 "ora_gram.y"
+                                                                                {}
+#line 16785 "ora_gram.c"
+    break;
+
+  case 937: /* opt_transaction: TRANSACTION  */
+#line 5506 "ora_gram.y"
+                                                                                        {}
+#line 16791 "ora_gram.c"
+    break;
+
+  case 938: /* opt_transaction: %empty  */
+#line 5507 "ora_gram.y"
+                                                                                                {}
+#line 16797 "ora_gram.c"
+    break;
+
+  case 940: /* transaction_mode_list_or_empty: %empty  */
+#line 5513 "ora_gram.y"
+                                        { (yyval.list) = NIL; }
+#line 16803 "ora_gram.c"
+    break;
+
+  case 941: /* zone_value: Sconst  */
+#line 5526 "ora_gram.y"
+                                {
+					(yyval.node) = makeStringConst((yyvsp[0].str), (yylsp[0]));
+				}
+#line 16811 "ora_gram.c"
+    break;
+
+  case 942: /* zone_value: IDENT  */
+#line 5530 "ora_gram.y"
+                                {
+					(yyval.node) = makeStringConst((yyvsp[0].str), (yylsp[0]));
+				}
+#line 16819 "ora_gram.c"
+    break;
+
+  case 943: /* zone_value: ConstInterval Sconst opt_interval  */
+#line 5534 "ora_gram.y"
+                                {
+					TypeName *t = (yyvsp[-2].typnam);
+					if ((yyvsp[0].list) != NIL)
+					{
+						A_Const *n = (A_Const *) linitial((yyvsp[0].list));
+						if ((n->val.val.ival & ~(INTERVAL_MASK(HOUR) | INTERVAL_MASK(MINUTE))) != 0)
+							ereport(ERROR,
+									(errcode(ERRCODE_SYNTAX_ERROR),
+									 errmsg("time zone interval must be HOUR or HOUR TO MINUTE"),
+									 parser_errposition((yylsp[0]))));
+					}
+					t->typmods = (yyvsp[0].list);
+					(yyval.node) = makeStringConstCast((yyvsp[-1].str), (yylsp[-1]), t);
+				}
+#line 16838 "ora_gram.c"
+    break;
+
+  case 944: /* zone_value: ConstInterval '(' Iconst ')' Sconst opt_interval  */
+#line 5549 "ora_gram.y"
+                                {
+					TypeName *t = (yyvsp[-5].typnam);
+					if ((yyvsp[0].list) != NIL)
+					{
+						A_Const *n = (A_Const *) linitial((yyvsp[0].list));
+						if ((n->val.val.ival & ~(INTERVAL_MASK(HOUR) | INTERVAL_MASK(MINUTE))) != 0)
+							ereport(ERROR,
+									(errcode(ERRCODE_SYNTAX_ERROR),
+									 errmsg("time zone interval must be HOUR or HOUR TO MINUTE"),
+									 parser_errposition((yylsp[0]))));
+						if (list_length((yyvsp[0].list)) != 1)
+							ereport(ERROR,
+									(errcode(ERRCODE_SYNTAX_ERROR),
+									 errmsg("interval precision specified twice"),
+									 parser_errposition((yylsp[-5]))));
+						t->typmods = lappend((yyvsp[0].list), makeIntConst((yyvsp[-3].ival), (yylsp[-3])));
+					}
+					else
+						t->typmods = list_make2(makeIntConst(INTERVAL_FULL_RANGE, -1),
+												makeIntConst((yyvsp[-3].ival), (yylsp[-3])));
+					(yyval.node) = makeStringConstCast((yyvsp[-1].str), (yylsp[-1]), t);
+				}
+#line 16865 "ora_gram.c"
+    break;
+
+  case 945: /* zone_value: NumericOnly  */
+#line 5571 "ora_gram.y"
+                                                                                        { (yyval.node) = makeAConst((yyvsp[0].value), (yylsp[0])); }
+#line 16871 "ora_gram.c"
+    break;
+
+  case 946: /* zone_value: DEFAULT  */
+#line 5572 "ora_gram.y"
+                                                                                                { (yyval.node) = NULL; }
+#line 16877 "ora_gram.c"
+    break;
+
+  case 947: /* zone_value: LOCAL  */
+#line 5573 "ora_gram.y"
+                                                                                                { (yyval.node) = NULL; }
+#line 16883 "ora_gram.c"
+    break;
+
+
+#line 16887 "ora_gram.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (&yylloc, yyscanner, YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, yyscanner);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, yyscanner);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (&yylloc, yyscanner, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, yyscanner);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, yyscanner);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 5869 "ora_gram.y"
+
+
+#define INVALID_TOKEN -1
+
+/*
+ * Process result of ConstraintAttributeSpec, and set appropriate bool flags
+ * in the output command node.  Pass NULL for any flags the particular
+ * command doesn't support.
+ */
+static void
+processCASbits(int cas_bits, int location, const char *constrType,
+			   bool *deferrable, bool *initdeferred, bool *not_valid,
+			   bool *no_inherit, core_yyscan_t yyscanner)
+{
+	/* defaults */
+	if (deferrable)
+		*deferrable = false;
+	if (initdeferred)
+		*initdeferred = false;
+	if (not_valid)
+		*not_valid = false;
+
+	if (cas_bits & (CAS_DEFERRABLE | CAS_INITIALLY_DEFERRED))
+	{
+		if (deferrable)
+			*deferrable = true;
+		else
+			ereport(ERROR,
+					(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					 /* translator: %s is CHECK, UNIQUE, or similar */
+					 errmsg("%s constraints cannot be marked DEFERRABLE",
+							constrType),
+					 parser_errposition(location)));
+	}
+
+	if (cas_bits & CAS_INITIALLY_DEFERRED)
+	{
+		if (initdeferred)
+			*initdeferred = true;
+		else
+			ereport(ERROR,
+					(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					 /* translator: %s is CHECK, UNIQUE, or similar */
+					 errmsg("%s constraints cannot be marked DEFERRABLE",
+							constrType),
+					 parser_errposition(location)));
+	}
+
+	if (cas_bits & CAS_NOT_VALID)
+	{
+		if (not_valid)
+			*not_valid = true;
+		else
+			ereport(ERROR,
+					(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					 /* translator: %s is CHECK, UNIQUE, or similar */
+					 errmsg("%s constraints cannot be marked NOT VALID",
+							constrType),
+					 parser_errposition(location)));
+	}
+
+	if (cas_bits & CAS_NO_INHERIT)
+	{
+		if (no_inherit)
+			*no_inherit = true;
+		else
+			ereport(ERROR,
+					(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					 /* translator: %s is CHECK, UNIQUE, or similar */
+					 errmsg("%s constraints cannot be marked NO INHERIT",
+							constrType),
+					 parser_errposition(location)));
+	}
+}
+
+void ora_parser_init(ora_yy_extra_type *yyext)
+{
+	yyext->parsetree = NIL;
+	StaticAssertExpr(lengthof(yyext->lookahead)==2, "change init code");
+	yyext->lookahead[0].token = yyext->lookahead[1].token = INVALID_TOKEN;
+	yyext->has_no_alias_subquery = false;
+}
+
+static void ora_yyerror(YYLTYPE *yyloc, core_yyscan_t yyscanner, const char *msg)
+{
+	parser_yyerror(msg);
+}
+
+static Node *makeDeleteStmt(RangeVar *range, Alias *alias, WithClause *with
+	, Node *where, List *returning)
+{
+	DeleteStmt *stmt = makeNode(DeleteStmt);
+	if(alias)
+	{
+		Assert(range->alias == NULL);
+		range->alias = alias;
+	}
+	stmt->relation = range;
+	stmt->withClause = with;
+	stmt->whereClause = where;
+	stmt->returningList = returning;
+	return (Node*)stmt;
+}
+
+static int ora_yylex(YYSTYPE *lvalp, YYLTYPE *lloc, core_yyscan_t yyscanner)
+{
+	ora_yy_extra_type *yyextra = ora_yyget_extra(yyscanner);
+	int			cur_token;
+
+	if(yyextra->lookahead[0].token != INVALID_TOKEN)
+	{
+		cur_token = yyextra->lookahead[0].token;
+		lvalp->core_yystype = yyextra->lookahead[0].lval;
+		*lloc = yyextra->lookahead[0].loc;
+		memcpy(yyextra->lookahead, &(yyextra->lookahead[1])
+			, sizeof(yyextra->lookahead) - sizeof(yyextra->lookahead[0]));
+		yyextra->lookahead[lengthof(yyextra->lookahead)-1].token = INVALID_TOKEN;
+	}else
+	{
+		cur_token = core_yylex(&(lvalp->core_yystype), lloc, yyscanner);
+	}
+
+	switch(cur_token)
+	{
+	/* find "(+)" token */
+	case '(':
+		if(yyextra->lookahead[0].token == INVALID_TOKEN)
+		{
+			yyextra->lookahead[0].token = core_yylex(&(yyextra->lookahead[0].lval)
+				, &(yyextra->lookahead[0].loc), yyscanner);
+		}
+		if(yyextra->lookahead[0].token != '+')
+			break;
+
+		if(yyextra->lookahead[1].token == INVALID_TOKEN)
+		{
+			yyextra->lookahead[1].token = core_yylex(&(yyextra->lookahead[1].lval)
+				, &(yyextra->lookahead[1].loc), yyscanner);
+		}
+		if(yyextra->lookahead[1].token != ')')
+			break;
+
+		/* now we have "(+)" token */
+		cur_token = ORACLE_JOIN_OP;
+		StaticAssertExpr(lengthof(yyextra->lookahead)==2, "change invalid code");
+		yyextra->lookahead[0].token = yyextra->lookahead[1].token = INVALID_TOKEN;
+		break;
+	case CONNECT:
+		if(yyextra->lookahead[0].token == INVALID_TOKEN)
+		{
+			yyextra->lookahead[0].token = core_yylex(&(yyextra->lookahead[0].lval)
+				, &(yyextra->lookahead[0].loc), yyscanner);
+		}
+		if(yyextra->lookahead[0].token != BY)
+			break;
+
+		/* now we have "connect by" token, look for "nocycle" after it */
+		if(yyextra->lookahead[1].token == INVALID_TOKEN)
+		{
+			yyextra->lookahead[1].token = core_yylex(&(yyextra->lookahead[1].lval)
+				, &(yyextra->lookahead[1].loc), yyscanner);
+		}
+		if(yyextra->lookahead[1].token == NOCYCLE)
+		{
+			cur_token = CONNECT_BY_NOCYCLE;
+			yyextra->lookahead[0].token = yyextra->lookahead[1].token = INVALID_TOKEN;
+		}else
+		{
+			cur_token = CONNECT_BY;
+			yyextra->lookahead[0] = yyextra->lookahead[1];
+			yyextra->lookahead[1].token = INVALID_TOKEN;
+		}
+		break;
+	default:
+		break;
+	}
+	return cur_token;
+}
+
+static Node *reparse_decode_func(List *args, int location)
+{
+	List		*cargs = NIL;
+	ListCell 	*lc = NULL;
+	Expr		*expr = NULL;
+	Node		*search = NULL;
+
+	CaseExpr *c = makeNode(CaseExpr);
+	c->casetype = InvalidOid; /* not analyzed yet */
+	c->isdecode = true;
+	expr = (Expr *)linitial(args);
+
+	for_each_cell(lc, lnext(list_head(args)))
+	{
+		if (lnext(lc) == NULL)
+		{
+			break;
+		} else
+		{
+			CaseWhen *w = makeNode(CaseWhen);
+			search = (Node *)lfirst(lc);
+			if (IsA(search, A_Const) &&
+				((A_Const*)search)->val.type == T_Null)
+			{
+				NullTest *n = (NullTest *)makeNode(NullTest);
+				n->arg = expr;
+				n->nulltesttype = IS_NULL;
+				w->expr = (Expr *)n;
+			} else
+			{
+				w->expr = (Expr *) makeSimpleA_Expr(AEXPR_OP,
+													"=",
+													(Node *)expr,
+													search,
+													-1);
+			}
+			w->result = (Expr *) lfirst(lnext(lc));
+			w->location = -1;
+			cargs = lappend(cargs, w);
+			lc = lnext(lc);
+		}
+	}
+	c->args = cargs;
+	c->defresult = lc ? (Expr *)lfirst(lc) : NULL;
+	c->location = location;
+
+	return (Node *)c;
+}
+
+static bool get_all_names(Node *n, List **pplist)
+{
+	AssertArg(pplist);
+	if(n == NULL)
+		return false;
+
+	if(IsA(n, Alias))
+	{
+		//APPEND_ALIAS((Alias*)n);
+		Assert(((Alias*)n)->aliasname);
+		*pplist = lappend(*pplist, ((Alias*)n)->aliasname);
+		return false;
+	}/*if(IsA(n, JoinExpr))
+	{
+		APPEND_ALIAS(((JoinExpr*)n)->alias);
+	}else if(IsA(n, RangeSubselect))
+	{
+		APPEND_ALIAS(((RangeSubselect*)n)->alias)
+	}*/else if(IsA(n, RangeVar))
+	{
+		RangeVar *range = (RangeVar*)n;
+		*pplist = lappend(*pplist, range->alias ? range->alias->aliasname : range->relname);
+		return false;
+	}else if(IsA(n, RangeFunction))
+	{
+		RangeFunction *range = (RangeFunction*)n;
+		if(range->alias)
+		{
+			*pplist = lappend(*pplist, range->alias->aliasname);
+			return false;
+		}
+	}else if(IsA(n, FuncCall))
+	{
+		FuncCall *func = (FuncCall*)n;
+		Value *value;
+		Assert(func->funcname);
+		value = linitial(func->funcname);
+		Assert(value && IsA(value,String));
+		*pplist = lappend(*pplist, strVal(value));
+		/* don't need function's argument(s) */
+		return false;
+	}else if(IsA(n, CommonTableExpr))
+	{
+		CommonTableExpr *cte = (CommonTableExpr*)n;
+		*pplist = lappend(*pplist, cte->ctename);
+	}else if(IsA(n, ColumnRef))
+	{
+		ColumnRef *column = (ColumnRef*)n;
+		Value *value;
+		int length = list_length(column->fields);
+		if(length > 1)
+		{
+			value = list_nth(column->fields, length - 2);
+			Assert(value && IsA(value, String));
+			*pplist = lappend(*pplist, strVal(value));
+		}
+	}
+	return node_tree_walker(n, get_all_names, pplist);
+}
+
+static unsigned int add_alias_name_idx;
+static char add_alias_name[NAMEDATALEN];
+static bool add_alias_internal(Node *n, List *names)
+{
+	if(n && IsA(n, RangeSubselect) && ((RangeSubselect*)n)->alias == NULL)
+	{
+		RangeSubselect *sub = (RangeSubselect*)n;
+		Alias *alias = makeNode(Alias);
+		ListCell *lc;
+		bool used;
+		do
+		{
+			used = false;
+			++add_alias_name_idx;
+			snprintf(add_alias_name, lengthof(add_alias_name)
+				, "__AUTO_ADD_ALIAS_%d__", add_alias_name_idx);
+			foreach(lc, names)
+			{
+				if(strcmp(add_alias_name, lfirst(lc)) == 0)
+				{
+					used = true;
+					break;
+				}
+			}
+		}while(used);
+		alias->aliasname = pstrdup(add_alias_name);
+		sub->alias = alias;
+	}
+	return node_tree_walker(n, add_alias_internal, names);
+}
+
+static void add_alias_if_need(List *parseTree)
+{
+	List *names = NIL;
+	get_all_names((Node*)parseTree, &names);
+	add_alias_name_idx = 0;
+	add_alias_internal((Node*)parseTree, names);
+	list_free(names);
+}
+
+static Node* make_any_sublink(Node *testexpr, const char *operName, Node *subselect, int location)
+{
+	SubLink *n = makeNode(SubLink);
+	n->subLinkType = ANY_SUBLINK;
+	n->testexpr = testexpr;
+	n->operName = list_make1(makeString(pstrdup(operName)));
+	n->subselect = subselect;
+	n->location = location;
+	return (Node*)n;
+}
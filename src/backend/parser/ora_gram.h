@@ -0,0 +1,457 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_ORA_YY_ORA_GRAM_H_INCLUDED
+# define YY_ORA_YY_ORA_GRAM_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int ora_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    FCONST = 259,                  /* FCONST  */
+    SCONST = 260,                  /* SCONST  */
+    BCONST = 261,                  /* BCONST  */
+    XCONST = 262,                  /* XCONST  */
+    Op = 263,                      /* Op  */
+    ICONST = 264,                  /* ICONST  */
+    PARAM = 265,                   /* PARAM  */
+    TYPECAST = 266,                /* TYPECAST  */
+    DOT_DOT = 267,                 /* DOT_DOT  */
+    COLON_EQUALS = 268,            /* COLON_EQUALS  */
+    NULLS_FIRST = 269,             /* NULLS_FIRST  */
+    NULLS_LAST = 270,              /* NULLS_LAST  */
+    ACCESS = 271,                  /* ACCESS  */
+    ADD_P = 272,                   /* ADD_P  */
+    ALL = 273,                     /* ALL  */
+    ALTER = 274,                   /* ALTER  */
+    ANALYZE = 275,                 /* ANALYZE  */
+    ANALYSE = 276,                 /* ANALYSE  */
+    AND = 277,                     /* AND  */
+    ABORT_P = 278,                 /* ABORT_P  */
+    ANY = 279,                     /* ANY  */
+    AS = 280,                      /* AS  */
+    ASC = 281,                     /* ASC  */
+    AUDIT = 282,                   /* AUDIT  */
+    AUTHORIZATION = 283,           /* AUTHORIZATION  */
+    ACTION = 284,                  /* ACTION  */
+    ALWAYS = 285,                  /* ALWAYS  */
+    ADMIN = 286,                   /* ADMIN  */
+    BEGIN_P = 287,                 /* BEGIN_P  */
+    BETWEEN = 288,                 /* BETWEEN  */
+    BFILE = 289,                   /* BFILE  */
+    BIGINT = 290,                  /* BIGINT  */
+    BINARY_FLOAT = 291,            /* BINARY_FLOAT  */
+    BINARY_DOUBLE = 292,           /* BINARY_DOUBLE  */
+    BLOB = 293,                    /* BLOB  */
+    BOOLEAN_P = 294,               /* BOOLEAN_P  */
+    BOTH = 295,                    /* BOTH  */
+    BY = 296,                      /* BY  */
+    BYTE_P = 297,                  /* BYTE_P  */
+    CASCADE = 298,                 /* CASCADE  */
+    CASE = 299,                    /* CASE  */
+    CAST = 300,                    /* CAST  */
+    CATALOG_P = 301,               /* CATALOG_P  */
+    CHAR_P = 302,                  /* CHAR_P  */
+    CHARACTERISTICS = 303,         /* CHARACTERISTICS  */
+    CHECK = 304,                   /* CHECK  */
+    CLUSTER = 305,                 /* CLUSTER  */
+    COLUMN = 306,                  /* COLUMN  */
+    COMMIT = 307,                  /* COMMIT  */
+    COMMENT = 308,                 /* COMMENT  */
+    COLLATION = 309,               /* COLLATION  */
+    CONVERSION_P = 310,            /* CONVERSION_P  */
+    CONNECTION = 311,              /* CONNECTION  */
+    COMMITTED = 312,               /* COMMITTED  */
+    COMPRESS = 313,                /* COMPRESS  */
+    COLLATE = 314,                 /* COLLATE  */
+    CONNECT = 315,                 /* CONNECT  */
+    CONSTRAINT = 316,              /* CONSTRAINT  */
+    CYCLE = 317,                   /* CYCLE  */
+    NOCYCLE = 318,                 /* NOCYCLE  */
+    CONSTRAINTS = 319,             /* CONSTRAINTS  */
+    CLOB = 320,                    /* CLOB  */
+    COALESCE = 321,                /* COALESCE  */
+    CONTENT_P = 322,               /* CONTENT_P  */
+    CONTINUE_P = 323,              /* CONTINUE_P  */
+    CREATE = 324,                  /* CREATE  */
+    CROSS = 325,                   /* CROSS  */
+    CURRENT_DATE = 326,            /* CURRENT_DATE  */
+    CURRENT_P = 327,               /* CURRENT_P  */
+    CURRENT_TIMESTAMP = 328,       /* CURRENT_TIMESTAMP  */
+    CURRVAL = 329,                 /* CURRVAL  */
+    CURSOR = 330,                  /* CURSOR  */
+    CONCURRENTLY = 331,            /* CONCURRENTLY  */
+    CONFIGURATION = 332,           /* CONFIGURATION  */
+    CACHE = 333,                   /* CACHE  */
+    NOCACHE = 334,                 /* NOCACHE  */
+    COMMENTS = 335,                /* COMMENTS  */
+    DATE_P = 336,                  /* DATE_P  */
+    DAY_P = 337,                   /* DAY_P  */
+    DBTIMEZONE_P = 338,            /* DBTIMEZONE_P  */
+    DEC = 339,                     /* DEC  */
+    DECIMAL_P = 340,               /* DECIMAL_P  */
+    DEFAULT = 341,                 /* DEFAULT  */
+    DEFERRABLE = 342,              /* DEFERRABLE  */
+    DELETE_P = 343,                /* DELETE_P  */
+    DESC = 344,                    /* DESC  */
+    DISTINCT = 345,                /* DISTINCT  */
+    DO = 346,                      /* DO  */
+    DOCUMENT_P = 347,              /* DOCUMENT_P  */
+    DOUBLE_P = 348,                /* DOUBLE_P  */
+    DROP = 349,                    /* DROP  */
+    DEFERRED = 350,                /* DEFERRED  */
+    DATA_P = 351,                  /* DATA_P  */
+    DEFAULTS = 352,                /* DEFAULTS  */
+    DISABLE_P = 353,               /* DISABLE_P  */
+    DISTRIBUTE = 354,              /* DISTRIBUTE  */
+    PREPARE = 355,                 /* PREPARE  */
+    PREPARED = 356,                /* PREPARED  */
+    DOMAIN_P = 357,                /* DOMAIN_P  */
+    DICTIONARY = 358,              /* DICTIONARY  */
+    ELSE = 359,                    /* ELSE  */
+    END_P = 360,                   /* END_P  */
+    ESCAPE = 361,                  /* ESCAPE  */
+    EXCLUSIVE = 362,               /* EXCLUSIVE  */
+    EXISTS = 363,                  /* EXISTS  */
+    EXPLAIN = 364,                 /* EXPLAIN  */
+    EXTRACT = 365,                 /* EXTRACT  */
+    ENABLE_P = 366,                /* ENABLE_P  */
+    EXCLUDE = 367,                 /* EXCLUDE  */
+    EVENT = 368,                   /* EVENT  */
+    EXTENSION = 369,               /* EXTENSION  */
+    EXCLUDING = 370,               /* EXCLUDING  */
+    ENCRYPTED = 371,               /* ENCRYPTED  */
+    FALSE_P = 372,                 /* FALSE_P  */
+    FILE_P = 373,                  /* FILE_P  */
+    FLOAT_P = 374,                 /* FLOAT_P  */
+    FOR = 375,                     /* FOR  */
+    FROM = 376,                    /* FROM  */
+    FOREIGN = 377,                 /* FOREIGN  */
+    FULL = 378,                    /* FULL  */
+    GLOBAL = 379,                  /* GLOBAL  */
+    GRANT = 380,                   /* GRANT  */
+    GREATEST = 381,                /* GREATEST  */
+    GROUP_P = 382,                 /* GROUP_P  */
+    HAVING = 383,                  /* HAVING  */
+    HOUR_P = 384,                  /* HOUR_P  */
+    IDENTIFIED = 385,              /* IDENTIFIED  */
+    IF_P = 386,                    /* IF_P  */
+    IMMEDIATE = 387,               /* IMMEDIATE  */
+    IN_P = 388,                    /* IN_P  */
+    INCREMENT = 389,               /* INCREMENT  */
+    INDEX = 390,                   /* INDEX  */
+    INITIAL_P = 391,               /* INITIAL_P  */
+    INSERT = 392,                  /* INSERT  */
+    INHERIT = 393,                 /* INHERIT  */
+    INITIALLY = 394,               /* INITIALLY  */
+    INHERITS = 395,                /* INHERITS  */
+    INCLUDING = 396,               /* INCLUDING  */
+    INDEXES = 397,                 /* INDEXES  */
+    INNER_P = 398,                 /* INNER_P  */
+    IDENTITY_P = 399,              /* IDENTITY_P  */
+    INTEGER = 400,                 /* INTEGER  */
+    INTERSECT = 401,               /* INTERSECT  */
+    INTO = 402,                    /* INTO  */
+    INTERVAL = 403,                /* INTERVAL  */
+    INT_P = 404,                   /* INT_P  */
+    IS = 405,                      /* IS  */
+    ISOLATION = 406,               /* ISOLATION  */
+    JOIN = 407,                    /* JOIN  */
+    KEY = 408,                     /* KEY  */
+    LEADING = 409,                 /* LEADING  */
+    LEAST = 410,                   /* LEAST  */
+    LEFT = 411,                    /* LEFT  */
+    LEVEL = 412,                   /* LEVEL  */
+    LIMIT = 413,                   /* LIMIT  */
+    LIKE = 414,                    /* LIKE  */
+    LOCAL = 415,                   /* LOCAL  */
+    LOCALTIMESTAMP = 416,          /* LOCALTIMESTAMP  */
+    LOCK_P = 417,                  /* LOCK_P  */
+    LOG_P = 418,                   /* LOG_P  */
+    LONG_P = 419,                  /* LONG_P  */
+    MATERIALIZED = 420,            /* MATERIALIZED  */
+    MAXEXTENTS = 421,              /* MAXEXTENTS  */
+    MINUS = 422,                   /* MINUS  */
+    MINUTE_P = 423,                /* MINUTE_P  */
+    MLSLABEL = 424,                /* MLSLABEL  */
+    MODE = 425,                    /* MODE  */
+    MODIFY = 426,                  /* MODIFY  */
+    MONTH_P = 427,                 /* MONTH_P  */
+    MATCH = 428,                   /* MATCH  */
+    MAXVALUE = 429,                /* MAXVALUE  */
+    NOMAXVALUE = 430,              /* NOMAXVALUE  */
+    MINVALUE = 431,                /* MINVALUE  */
+    NOMINVALUE = 432,              /* NOMINVALUE  */
+    NAMES = 433,                   /* NAMES  */
+    NCHAR = 434,                   /* NCHAR  */
+    NCLOB = 435,                   /* NCLOB  */
+    NEXT = 436,                    /* NEXT  */
+    NEXTVAL = 437,                 /* NEXTVAL  */
+    NOAUDIT = 438,                 /* NOAUDIT  */
+    NOCOMPRESS = 439,              /* NOCOMPRESS  */
+    NOT = 440,                     /* NOT  */
+    NOWAIT = 441,                  /* NOWAIT  */
+    NULL_P = 442,                  /* NULL_P  */
+    NULLIF = 443,                  /* NULLIF  */
+    NUMBER_P = 444,                /* NUMBER_P  */
+    NUMERIC = 445,                 /* NUMERIC  */
+    NVARCHAR2 = 446,               /* NVARCHAR2  */
+    NO = 447,                      /* NO  */
+    NODE = 448,                    /* NODE  */
+    OF = 449,                      /* OF  */
+    OFF = 450,                     /* OFF  */
+    OFFLINE = 451,                 /* OFFLINE  */
+    OFFSET = 452,                  /* OFFSET  */
+    ON = 453,                      /* ON  */
+    ONLINE = 454,                  /* ONLINE  */
+    ONLY = 455,                    /* ONLY  */
+    OPERATOR = 456,                /* OPERATOR  */
+    OPTION = 457,                  /* OPTION  */
+    OR = 458,                      /* OR  */
+    ORDER = 459,                   /* ORDER  */
+    OUTER_P = 460,                 /* OUTER_P  */
+    OWNER = 461,                   /* OWNER  */
+    OIDS = 462,                    /* OIDS  */
+    OPTIONS = 463,                 /* OPTIONS  */
+    OWNED = 464,                   /* OWNED  */
+    PCTFREE = 465,                 /* PCTFREE  */
+    PRECISION = 466,               /* PRECISION  */
+    PRESERVE = 467,                /* PRESERVE  */
+    PRIOR = 468,                   /* PRIOR  */
+    PRIVILEGES = 469,              /* PRIVILEGES  */
+    PUBLIC = 470,                  /* PUBLIC  */
+    PURGE = 471,                   /* PURGE  */
+    PARTIAL = 472,                 /* PARTIAL  */
+    PRIMARY = 473,                 /* PRIMARY  */
+    PARSER = 474,                  /* PARSER  */
+    PASSWORD = 475,                /* PASSWORD  */
+    RAW = 476,                     /* RAW  */
+    READ = 477,                    /* READ  */
+    REAL = 478,                    /* REAL  */
+    RECURSIVE = 479,               /* RECURSIVE  */
+    RENAME = 480,                  /* RENAME  */
+    REPLACE = 481,                 /* REPLACE  */
+    REPEATABLE = 482,              /* REPEATABLE  */
+    RESET = 483,                   /* RESET  */
+    RESOURCE = 484,                /* RESOURCE  */
+    RESTART = 485,                 /* RESTART  */
+    RESTRICT = 486,                /* RESTRICT  */
+    RETURNING = 487,               /* RETURNING  */
+    RETURN_P = 488,                /* RETURN_P  */
+    REVOKE = 489,                  /* REVOKE  */
+    REUSE = 490,                   /* REUSE  */
+    RIGHT = 491,                   /* RIGHT  */
+    ROLE = 492,                    /* ROLE  */
+    ROLLBACK = 493,                /* ROLLBACK  */
+    ROW = 494,                     /* ROW  */
+    ROWID = 495,                   /* ROWID  */
+    ROWNUM = 496,                  /* ROWNUM  */
+    ROWS = 497,                    /* ROWS  */
+    REFERENCES = 498,              /* REFERENCES  */
+    REPLICA = 499,                 /* REPLICA  */
+    RULE = 500,                    /* RULE  */
+    RELEASE = 501,                 /* RELEASE  */
+    SCHEMA = 502,                  /* SCHEMA  */
+    SECOND_P = 503,                /* SECOND_P  */
+    SELECT = 504,                  /* SELECT  */
+    SERIALIZABLE = 505,            /* SERIALIZABLE  */
+    SESSION = 506,                 /* SESSION  */
+    SESSIONTIMEZONE = 507,         /* SESSIONTIMEZONE  */
+    SET = 508,                     /* SET  */
+    SHARE = 509,                   /* SHARE  */
+    SHOW = 510,                    /* SHOW  */
+    SIZE = 511,                    /* SIZE  */
+    SEARCH = 512,                  /* SEARCH  */
+    SMALLINT = 513,                /* SMALLINT  */
+    SIMPLE = 514,                  /* SIMPLE  */
+    SETOF = 515,                   /* SETOF  */
+    STATISTICS = 516,              /* STATISTICS  */
+    SAVEPOINT = 517,               /* SAVEPOINT  */
+    SEQUENCE = 518,                /* SEQUENCE  */
+    SYSID = 519,                   /* SYSID  */
+    SOME = 520,                    /* SOME  */
+    SNAPSHOT = 521,                /* SNAPSHOT  */
+    START = 522,                   /* START  */
+    STORAGE = 523,                 /* STORAGE  */
+    SUCCESSFUL = 524,              /* SUCCESSFUL  */
+    SYNONYM = 525,                 /* SYNONYM  */
+    SYSDATE = 526,                 /* SYSDATE  */
+    SYSTIMESTAMP = 527,            /* SYSTIMESTAMP  */
+    TABLE = 528,                   /* TABLE  */
+    TEMP = 529,                    /* TEMP  */
+    TEMPLATE = 530,                /* TEMPLATE  */
+    TEMPORARY = 531,               /* TEMPORARY  */
+    THEN = 532,                    /* THEN  */
+    TIME = 533,                    /* TIME  */
+    TIMESTAMP = 534,               /* TIMESTAMP  */
+    TO = 535,                      /* TO  */
+    TRAILING = 536,                /* TRAILING  */
+    TRANSACTION = 537,             /* TRANSACTION  */
+    TREAT = 538,                   /* TREAT  */
+    TRIM = 539,                    /* TRIM  */
+    TRUNCATE = 540,                /* TRUNCATE  */
+    TRIGGER = 541,                 /* TRIGGER  */
+    TRUE_P = 542,                  /* TRUE_P  */
+    TABLESPACE = 543,              /* TABLESPACE  */
+    TYPE_P = 544,                  /* TYPE_P  */
+    TEXT_P = 545,                  /* TEXT_P  */
+    UID = 546,                     /* UID  */
+    UNCOMMITTED = 547,             /* UNCOMMITTED  */
+    UNION = 548,                   /* UNION  */
+    UNIQUE = 549,                  /* UNIQUE  */
+    UPDATE = 550,                  /* UPDATE  */
+    USER = 551,                    /* USER  */
+    USING = 552,                   /* USING  */
+    UNLOGGED = 553,                /* UNLOGGED  */
+    UNENCRYPTED = 554,             /* UNENCRYPTED  */
+    UNTIL = 555,                   /* UNTIL  */
+    VALIDATE = 556,                /* VALIDATE  */
+    VALUES = 557,                  /* VALUES  */
+    VARCHAR = 558,                 /* VARCHAR  */
+    VARCHAR2 = 559,                /* VARCHAR2  */
+    VERBOSE = 560,                 /* VERBOSE  */
+    VIEW = 561,                    /* VIEW  */
+    VALID = 562,                   /* VALID  */
+    WHEN = 563,                    /* WHEN  */
+    WHENEVER = 564,                /* WHENEVER  */
+    WHERE = 565,                   /* WHERE  */
+    WITH = 566,                    /* WITH  */
+    WRITE = 567,                   /* WRITE  */
+    WITHOUT = 568,                 /* WITHOUT  */
+    WORK = 569,                    /* WORK  */
+    XML_P = 570,                   /* XML_P  */
+    YEAR_P = 571,                  /* YEAR_P  */
+    ZONE = 572,                    /* ZONE  */
+    ORACLE_JOIN_OP = 573,          /* ORACLE_JOIN_OP  */
+    CONNECT_BY = 574,              /* CONNECT_BY  */
+    CONNECT_BY_NOCYCLE = 575,      /* CONNECT_BY_NOCYCLE  */
+    HI_THEN_RETURN = 576,          /* HI_THEN_RETURN  */
+    LO_THEN_LIMIT = 577,           /* LO_THEN_LIMIT  */
+    HI_THEN_LIMIT = 578,           /* HI_THEN_LIMIT  */
+    POSTFIXOP = 579,               /* POSTFIXOP  */
+    AT = 580,                      /* AT  */
+    UMINUS = 581                   /* UMINUS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 96 "ora_gram.y"
+
+	core_YYSTYPE		core_yystype;
+	/* these fields must match core_YYSTYPE: */
+	int					ival;
+	char				*str;
+	const char			*keyword;
+	OnCommitAction		oncommit;
+	char				chr;
+	bool				boolean;
+	JoinType			jtype;
+	DropBehavior		dbehavior;
+	List				*list;
+	Node				*node;
+	Value				*value;
+	ObjectType			objtype;
+	TypeName			*typnam;
+	FunctionParameter   *fun_param;
+	FunctionParameterMode fun_param_mode;
+	FuncWithArgs		*funwithargs;
+	DefElem				*defelt;
+	SortBy				*sortby;
+	WindowDef			*windef;
+	JoinExpr			*jexpr;
+	IndexElem			*ielem;
+	Alias				*alias;
+	RangeVar			*range;
+	IntoClause			*into;
+	WithClause			*with;
+	A_Indices			*aind;
+	ResTarget			*target;
+	struct PrivTarget	*privtarget;
+	AccessPriv			*accesspriv;
+	InsertStmt			*istmt;
+	VariableSetStmt		*vsetstmt;
+/* PGXC_BEGIN */
+	DistributeBy		*distby;
+	PGXCSubCluster		*subclus;
+/* PGXC_END */
+
+#line 430 "ora_gram.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int ora_yyparse (core_yyscan_t yyscanner);
+
+
+#endif /* !YY_ORA_YY_ORA_GRAM_H_INCLUDED  */
@@ -219,7 +219,8 @@ static Node* make_any_sublink(Node *testexpr, const char *operName, Node *subsel
 
 %type <list>
 	any_operator any_name any_name_list attrs alter_generic_options
-	case_when_list create_generic_options cte_list ctext_expr_list ctext_row
+	case_when_list connect_by_clause create_generic_options cte_list
+	ctext_expr_list ctext_row
 	ColQualList
 	definition def_list
 	explain_option_list expr_list extract_list
@@ -250,7 +251,7 @@ static Node* make_any_sublink(Node *testexpr, const char *operName, Node *subsel
 	common_table_expr columnDef columnref CreateStmt ctext_expr columnElem
 	ColConstraint ColConstraintElem ConstraintAttr CreateRoleStmt
 	case_default case_expr /*case_when*/ case_when_item c_expr
-	ConstraintElem CreateSeqStmt CreateAsStmt connect_by_clause
+	ConstraintElem CreateSeqStmt CreateAsStmt
 	DeleteStmt DropStmt def_arg
 	ExplainStmt ExplainableStmt explain_option_arg ExclusionWhereClause
 	func_arg_expr func_expr for_locking_item
@@ -360,7 +361,7 @@ static Node* make_any_sublink(Node *testexpr, const char *operName, Node *subsel
 /*
  * same specific token
  */
-%token	ORACLE_JOIN_OP CONNECT_BY
+%token	ORACLE_JOIN_OP CONNECT_BY CONNECT_BY_NOCYCLE
 
 /* Precedence: lowest to highest */
 %right	RETURN_P RETURNING PRIMARY
@@ -4884,7 +4885,8 @@ simple_select:
 				n->whereClause = $5;
 				n->groupClause = $6;
 				n->havingClause = $7;
-				$$ = makeConnectByStmt(n, $8, $9, yyscanner);
+				$$ = makeConnectByStmt(n, $8, linitial($9),
+									   intVal(lsecond($9)), yyscanner);
 			}
 		| SELECT opt_distinct target_list from_clause where_clause
 			group_clause having_clause
@@ -4897,7 +4899,8 @@ simple_select:
 				n->whereClause = $5;
 				n->groupClause = $6;
 				n->havingClause = $7;
-				$$ = makeConnectByStmt(n, $9, $8, yyscanner);
+				$$ = makeConnectByStmt(n, $9, linitial($8),
+									   intVal(lsecond($8)), yyscanner);
 			}
 		| select_clause UNION opt_all select_clause
 			{
@@ -4941,8 +4944,12 @@ opt_start_with_clause:
 start_with_clause: START WITH a_expr		{ $$ = $3; }
 	;
 
+/* list of the condition and whether NOCYCLE was given */
 connect_by_clause:
-	CONNECT_BY a_expr	%prec END_P		{ $$ = $2; }
+	CONNECT_BY a_expr	%prec END_P
+		{ $$ = list_make2($2, makeInteger(FALSE)); }
+	| CONNECT_BY_NOCYCLE a_expr	%prec END_P
+		{ $$ = list_make2($2, makeInteger(TRUE)); }
 	;
 
 TableElement:
@@ -6015,9 +6022,22 @@ static int ora_yylex(YYSTYPE *lvalp, YYLTYPE *lloc, core_yyscan_t yyscanner)
 		if(yyextra->lookahead[0].token != BY)
 			break;
 
-		/* now we have "connect by" token */
-		cur_token = CONNECT_BY;
-		yyextra->lookahead[0].token = INVALID_TOKEN;
+		/* now we have "connect by" token, look for "nocycle" after it */
+		if(yyextra->lookahead[1].token == INVALID_TOKEN)
+		{
+			yyextra->lookahead[1].token = core_yylex(&(yyextra->lookahead[1].lval)
+				, &(yyextra->lookahead[1].loc), yyscanner);
+		}
+		if(yyextra->lookahead[1].token == NOCYCLE)
+		{
+			cur_token = CONNECT_BY_NOCYCLE;
+			yyextra->lookahead[0].token = yyextra->lookahead[1].token = INVALID_TOKEN;
+		}else
+		{
+			cur_token = CONNECT_BY;
+			yyextra->lookahead[0] = yyextra->lookahead[1];
+			yyextra->lookahead[1].token = INVALID_TOKEN;
+		}
 		break;
 	default:
 		break;
@@ -311,6 +311,11 @@ transformAggregateCall(ParseState *pstate, Aggref *agg,
 		case EXPR_KIND_TRIGGER_WHEN:
 			err = _("aggregate functions are not allowed in trigger WHEN conditions");
 			break;
+#ifdef ADB
+		case EXPR_KIND_TABLESAMPLE:
+			err = _("aggregate functions are not allowed in TABLESAMPLE clause");
+			break;
+#endif /* ADB */
 
 			/*
 			 * There is intentionally no default: case here, so that the
@@ -579,6 +584,11 @@ transformWindowFuncCall(ParseState *pstate, WindowFunc *wfunc,
 		case EXPR_KIND_TRIGGER_WHEN:
 			err = _("window functions are not allowed in trigger WHEN conditions");
 			break;
+#ifdef ADB
+		case EXPR_KIND_TABLESAMPLE:
+			err = _("window functions are not allowed in TABLESAMPLE clause");
+			break;
+#endif /* ADB */
 
 			/*
 			 * There is intentionally no default: case here, so that the
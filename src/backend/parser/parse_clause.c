@@ -56,6 +56,10 @@ static RangeTblEntry *transformRangeSubselect(ParseState *pstate,
 						RangeSubselect *r);
 static RangeTblEntry *transformRangeFunction(ParseState *pstate,
 					   RangeFunction *r);
+#ifdef ADB
+static TableSampleClause *transformRangeTableSample(ParseState *pstate,
+						  RangeTableSample *rts);
+#endif
 static Node *transformFromClauseItem(ParseState *pstate, Node *n,
 						RangeTblEntry **top_rte, int *top_rti,
 						List **namespace);
@@ -589,6 +593,49 @@ transformRangeFunction(ParseState *pstate, RangeFunction *r)
 	return rte;
 }
 
+#ifdef ADB
+/*
+ * transformRangeTableSample --- transform a TABLESAMPLE clause
+ *
+ * The percentage is coerced to float4 and the REPEATABLE seed to float8.
+ * Neither can see the columns of the relation being sampled, since that is
+ * not in the namespace yet.
+ */
+static TableSampleClause *
+transformRangeTableSample(ParseState *pstate, RangeTableSample *rts)
+{
+	TableSampleClause *tsc = makeNode(TableSampleClause);
+	Node	   *arg;
+
+	if (pg_strcasecmp(rts->method, "system") == 0)
+		tsc->method = TABLESAMPLE_SYSTEM;
+	else if (pg_strcasecmp(rts->method, "bernoulli") == 0)
+		tsc->method = TABLESAMPLE_BERNOULLI;
+	else
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_OBJECT),
+				 errmsg("tablesample method \"%s\" does not exist",
+						rts->method),
+				 errhint("Valid methods are SYSTEM and BERNOULLI."),
+				 parser_errposition(pstate, rts->location)));
+
+	arg = transformExpr(pstate, rts->percent, EXPR_KIND_TABLESAMPLE);
+	arg = coerce_to_specific_type(pstate, arg, FLOAT4OID, "TABLESAMPLE");
+	assign_expr_collations(pstate, arg);
+	tsc->percent = arg;
+
+	if (rts->repeatable)
+	{
+		arg = transformExpr(pstate, rts->repeatable, EXPR_KIND_TABLESAMPLE);
+		arg = coerce_to_specific_type(pstate, arg, FLOAT8OID, "REPEATABLE");
+		assign_expr_collations(pstate, arg);
+		tsc->repeatable = arg;
+	}
+
+	return tsc;
+}
+#endif /* ADB */
+
 
 /*
  * transformFromClauseItem -
@@ -685,6 +732,29 @@ transformFromClauseItem(ParseState *pstate, Node *n,
 		rtr->rtindex = rtindex;
 		return (Node *) rtr;
 	}
+#ifdef ADB
+	else if (IsA(n, RangeTableSample))
+	{
+		/* TABLESAMPLE decorates the RTE of the plain relation beneath it */
+		RangeTableSample *rts = (RangeTableSample *) n;
+		Node	   *rel;
+		RangeTblEntry *rte;
+
+		rel = transformFromClauseItem(pstate, (Node *) rts->relation,
+									  top_rte, top_rti, namespace);
+		rte = *top_rte;
+		if (rte->rtekind != RTE_RELATION ||
+			(rte->relkind != RELKIND_RELATION &&
+			 rte->relkind != RELKIND_MATVIEW))
+			ereport(ERROR,
+					(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+					 errmsg("TABLESAMPLE clause can only be applied to tables and materialized views"),
+					 parser_errposition(pstate,
+										exprLocation((Node *) rts->relation))));
+		rte->tablesample = transformRangeTableSample(pstate, rts);
+		return rel;
+	}
+#endif /* ADB */
 	else if (IsA(n, JoinExpr))
 	{
 		/* A newfangled join expression */
@@ -1889,6 +1889,11 @@ transformSubLink(ParseState *pstate, SubLink *sublink)
 		case EXPR_KIND_TRIGGER_WHEN:
 			err = _("cannot use subquery in trigger WHEN condition");
 			break;
+#ifdef ADB
+		case EXPR_KIND_TABLESAMPLE:
+			err = _("cannot use subquery in TABLESAMPLE clause");
+			break;
+#endif /* ADB */
 
 			/*
 			 * There is intentionally no default: case here, so that the
@@ -3168,6 +3173,10 @@ ParseExprKindName(ParseExprKind exprKind)
 			return "EXECUTE";
 		case EXPR_KIND_TRIGGER_WHEN:
 			return "WHEN";
+#ifdef ADB
+		case EXPR_KIND_TABLESAMPLE:
+			return "TABLESAMPLE";
+#endif /* ADB */
 
 			/*
 			 * There is intentionally no default: case here, so that the
@@ -63,6 +63,7 @@ typedef struct ConnectByParseState
 	const char *database_name;
 	const char *cte_name;
 	char *column_level;
+	char *column_path;		/* rowids from the root, for NOCYCLE */
 	MutatorConnectByExprKind mutator_kind;
 	bool have_star;
 	bool have_level;
@@ -82,6 +83,7 @@ static char* get_unique_as_name(const char *prefix, uint32 *start, List *list);
 static char* get_expr_name(Node *expr, List *expr_list, List *name_list);
 static bool have_prior_expr(Node *node, void *context);
 static Node* make_concat_expr(Node *larg, Node *rarg, int location);
+static Node* make_column_ref(const char *rel_name, const char *col_name);
 
 #endif /* ADB */
 /*
@@ -439,7 +441,7 @@ check_sequence_name(List *names, core_yyscan_t yyscanner, int location)
 }
 
 Node *makeConnectByStmt(SelectStmt *stmt, Node *start, Node *connect_by,
-								core_yyscan_t yyscanner)
+								bool nocycle, core_yyscan_t yyscanner)
 {
 	SelectStmt *new_select,
 			   *union_all_left,
@@ -495,6 +497,8 @@ Node *makeConnectByStmt(SelectStmt *stmt, Node *start, Node *connect_by,
 	search_columnref(connect_by, &pstate);
 	if(pstate.have_level)
 		pstate.column_level = get_unique_as_name("_level_", NULL, pstate.column_list);
+	if(nocycle)
+		pstate.column_path = get_unique_as_name("_path_", NULL, pstate.column_list);
 	make_scbp_as_list(&pstate);
 
 	/* when with a group select we let it as a CTE */
@@ -542,6 +546,19 @@ Node *makeConnectByStmt(SelectStmt *stmt, Node *start, Node *connect_by,
 	pstate.mutator_kind = MCBEK_CLAUSE;
 	join->quals = mutator_connect_by_expr(connect_by, &pstate);
 
+	/*
+	 * for NOCYCLE, do not go back to a row already on the path:
+	 *   and base_rel.rowid <> all("_CTEn"._path_)
+	 */
+	if(nocycle)
+	{
+		Node *not_on_path = (Node*)makeA_Expr(AEXPR_OP_ALL,
+			list_make1(makeString(pstrdup("<>"))),
+			make_column_ref(pstate.base_rel_name, "rowid"),
+			make_column_ref(pstate.cte_name, pstate.column_path), -1);
+		join->quals = (Node*)makeA_Expr(AEXPR_AND, NIL, join->quals, not_on_path, -1);
+	}
+
 	union_all_right->fromClause = list_make1(join);
 
 	/* make union all select */
@@ -578,6 +595,14 @@ static Node* make_concat_expr(Node *larg, Node *rarg, int location)
 	return (Node*)func;
 }
 
+static Node* make_column_ref(const char *rel_name, const char *col_name)
+{
+	ColumnRef *cr = makeNode(ColumnRef);
+	cr->location = -1;
+	cr->fields = list_make2(makeString(pstrdup(rel_name)), makeString(pstrdup(col_name)));
+	return (Node*)cr;
+}
+
 static bool search_columnref(Node *node, ConnectByParseState *context)
 {
 	if(node == NULL)
@@ -746,6 +771,16 @@ static List* make_target_list_left(ConnectByParseState *context)
 		new_list = lappend(new_list, rt);
 	}
 
+	/* path of a root is its own rowid */
+	if(context->column_path)
+	{
+		rt = makeNode(ResTarget);
+		rt->name = context->column_path;
+		rt->location = -1;
+		rt->val = makeAArrayExpr(list_make1(make_column_ref(context->base_rel_name, "rowid")), -1);
+		new_list = lappend(new_list, rt);
+	}
+
 	if(new_list == NIL)
 		new_list = list_make1(makeNullAConst(-1));
 
@@ -778,6 +813,14 @@ static List* make_target_list_right(ConnectByParseState *context)
 	foreach(lc, context->scbp_list)
 		tl = lappend(tl, mutator_connect_by_expr(lfirst(lc), context));
 
+	/* cte._path_ || base_rel.rowid */
+	if(context->column_path)
+	{
+		tl = lappend(tl, makeSimpleA_Expr(AEXPR_OP, "||",
+			make_column_ref(context->cte_name, context->column_path),
+			make_column_ref(context->base_rel_name, "rowid"), -1));
+	}
+
 	if(tl == NIL)
 		tl = list_make1(makeNullAConst(-1));
 
@@ -1221,7 +1264,7 @@ void transformDistributeBy(DistributeBy *dbstmt)
 
 	/*
 	 * try to judge distribution type
-	 * HASH or MODULE or USER-DEFINED.
+	 * HASH, MODULE, BUCKET, RANGE, LIST or USER-DEFINED.
 	 */
 	if (list_length(funcname) == 1)
 	{
@@ -1255,6 +1298,51 @@ void transformDistributeBy(DistributeBy *dbstmt)
 			dbstmt->colname = strVal(linitial(((ColumnRef *)argnode)->fields));
 		}
 		else
+		if (strcasecmp(fname, "BUCKET") == 0)
+		{
+			if (list_length(funcargs) != 1 ||
+				IsA(argnode, ColumnRef) == false ||
+				list_length(((ColumnRef *)argnode)->fields) != 1)
+				ereport(ERROR,
+					(errcode(ERRCODE_SYNTAX_ERROR),
+					errmsg("Invalid distribution column specified for \"BUCKET\""),
+					errhint("Valid syntax input: BUCKET(column)")));
+
+			dbstmt->disttype = DISTTYPE_BUCKET;
+			dbstmt->colname = strVal(linitial(((ColumnRef *)argnode)->fields));
+		}
+		else
+		if (strcasecmp(fname, "RANGE") == 0)
+		{
+			if (IsA(argnode, ColumnRef) == false ||
+				list_length(((ColumnRef *)argnode)->fields) != 1)
+				ereport(ERROR,
+					(errcode(ERRCODE_SYNTAX_ERROR),
+					errmsg("Invalid distribution column specified for \"RANGE\""),
+					errhint("Valid syntax input: RANGE(column, bound [, ...])")));
+
+			/* The bounds are what is left after the column */
+			dbstmt->disttype = DISTTYPE_RANGE;
+			dbstmt->colname = strVal(linitial(((ColumnRef *)argnode)->fields));
+			dbstmt->funcargs = list_copy_tail(funcargs, 1);
+		}
+		else
+		if (strcasecmp(fname, "LIST") == 0)
+		{
+			if (list_length(funcargs) < 2 ||
+				IsA(argnode, ColumnRef) == false ||
+				list_length(((ColumnRef *)argnode)->fields) != 1)
+				ereport(ERROR,
+					(errcode(ERRCODE_SYNTAX_ERROR),
+					errmsg("Invalid distribution column specified for \"LIST\""),
+					errhint("Valid syntax input: LIST(column, value | (value [, ...]) [, ...])")));
+
+			/* One value or row of values per node after the column */
+			dbstmt->disttype = DISTTYPE_LIST;
+			dbstmt->colname = strVal(linitial(((ColumnRef *)argnode)->fields));
+			dbstmt->funcargs = list_copy_tail(funcargs, 1);
+		}
+		else
 		{
 			/*
 			 * Nothing changed.
@@ -26,10 +26,17 @@
 #include "storage/lwlock.h"
 #include "tcop/dest.h"
 
+/* BARRIER record written by this backend and not flushed yet */
+static XLogRecPtr BarrierRecPtr = InvalidXLogRecPtr;
+
 static const char *generate_barrier_id(const char *id);
+static XLogRecPtr InsertBarrierRecord(const char *id);
+static void SendBarrierRequest(PGXCNodeAllHandles *conn_handles,
+							   const char *id, char command);
 static PGXCNodeAllHandles *PrepareBarrier(const char *id);
-static void ExecuteBarrier(const char *id);
+static PGXCNodeAllHandles *ExecuteBarrier(const char *id);
 static void EndBarrier(PGXCNodeAllHandles *handles, const char *id);
+static void SyncBarrier(PGXCNodeAllHandles *handles, const char *id);
 
 /*
  * Prepare ourselves for an incoming BARRIER. We must disable all new 2PC
@@ -100,9 +107,11 @@ ProcessCreateBarrierEnd(const char *id)
 }
 
 /*
- * Execute the CREATE BARRIER command. Write a BARRIER WAL record and flush the
- * WAL buffers to disk before returning to the caller. Writing the WAL record
- * does not guarantee successful completion of the barrier command.
+ * Execute the CREATE BARRIER command. Write a BARRIER WAL record, which is
+ * only flushed by the CREATE BARRIER SYNC message following it. The 2PC
+ * commits are paused until all the nodes got their record, the flushes can
+ * be done after they resumed: the record precedes in the WAL any commit
+ * done after it, and cannot be lost without them.
  */
 void
 ProcessCreateBarrierExecute(const char *id)
@@ -114,17 +123,35 @@ ProcessCreateBarrierExecute(const char *id)
 				(errcode(ERRCODE_INTERNAL_ERROR),
 				 errmsg("The CREATE BARRIER EXECUTE message is expected to "
 						"arrive from a Coordinator")));
-	{
-		XLogRecData rdata[1];
-		XLogRecPtr recptr;
 
-		rdata[0].data = (char *) id;
-		rdata[0].len = strlen(id) + 1;
-		rdata[0].buffer = InvalidBuffer;
-		rdata[0].next = NULL;
+	BarrierRecPtr = InsertBarrierRecord(id);
+
+	pq_beginmessage(&buf, 'b');
+	pq_sendstring(&buf, id);
+	pq_endmessage(&buf);
+	pq_flush();
+}
+
+/*
+ * Flush the WAL up to the BARRIER record written by the CREATE BARRIER
+ * EXECUTE message, before telling the driving Coordinator the barrier is
+ * durable.
+ */
+void
+ProcessCreateBarrierSync(const char *id)
+{
+	StringInfoData buf;
+
+	if (!IsConnFromCoord())
+		ereport(ERROR,
+				(errcode(ERRCODE_INTERNAL_ERROR),
+				 errmsg("The CREATE BARRIER SYNC message is expected to "
+						"arrive from a Coordinator")));
 
-		recptr = XLogInsert(RM_BARRIER_ID, XLOG_BARRIER_CREATE, rdata);
-		XLogFlush(recptr);
+	if (!XLogRecPtrIsInvalid(BarrierRecPtr))
+	{
+		XLogFlush(BarrierRecPtr);
+		BarrierRecPtr = InvalidXLogRecPtr;
 	}
 
 	pq_beginmessage(&buf, 'b');
@@ -133,6 +160,22 @@ ProcessCreateBarrierExecute(const char *id)
 	pq_flush();
 }
 
+/*
+ * WAL log a BARRIER record, without flushing it
+ */
+static XLogRecPtr
+InsertBarrierRecord(const char *id)
+{
+	XLogRecData rdata[1];
+
+	rdata[0].data = (char *) id;
+	rdata[0].len = strlen(id) + 1;
+	rdata[0].buffer = InvalidBuffer;
+	rdata[0].next = NULL;
+
+	return XLogInsert(RM_BARRIER_ID, XLOG_BARRIER_CREATE, rdata);
+}
+
 static const char *
 generate_barrier_id(const char *id)
 {
@@ -192,6 +235,7 @@ SendBarrierPrepareRequest(List *coords, const char *id)
 					 errmsg("Out of memory")));
 		}
 
+		PGXCNodeCountMessageSent(handle);
 		handle->outBuffer[handle->outEnd++] = 'b';
 		msglen = htonl(msglen);
 		memcpy(handle->outBuffer + handle->outEnd, &msglen, 4);
@@ -281,6 +325,7 @@ SendBarrierEndRequest(PGXCNodeAllHandles *coord_handles, const char *id)
 					 errmsg("Out of memory")));
 		}
 
+		PGXCNodeCountMessageSent(handle);
 		handle->outBuffer[handle->outEnd++] = 'b';
 		msglen = htonl(msglen);
 		memcpy(handle->outBuffer + handle->outEnd, &msglen, 4);
@@ -343,26 +388,17 @@ PrepareBarrier(const char *id)
 }
 
 /*
- * Execute the barrier command on all the components, including Datanodes and
- * Coordinators.
+ * Send a CREATE BARRIER message to all the Datanodes and the Coordinators
+ * of conn_handles
  */
 static void
-ExecuteBarrier(const char *id)
+SendBarrierRequest(PGXCNodeAllHandles *conn_handles, const char *id,
+				   char command)
 {
-	List *barrierDataNodeList = GetAllDataNodes();
-	List *barrierCoordList = GetAllCoordNodes();
-	PGXCNodeAllHandles *conn_handles;
 	int conn;
 	int msglen;
 	int barrier_idlen;
 
-	conn_handles = get_handles(barrierDataNodeList, barrierCoordList, false);
-
-	elog(DEBUG1, "Sending CREATE BARRIER <%s> EXECUTE message to "
-				 "Datanodes and Coordinator", id);
-	/*
-	 * Send a CREATE BARRIER request to all the Datanodes and the Coordinators
-	 */
 	for (conn = 0; conn < conn_handles->co_conn_count + conn_handles->dn_conn_count; conn++)
 	{
 		PGXCNodeHandle *handle;
@@ -376,8 +412,9 @@ ExecuteBarrier(const char *id)
 		if (handle->state != DN_CONNECTION_STATE_IDLE)
 			ereport(ERROR,
 					(errcode(ERRCODE_INTERNAL_ERROR),
-					 errmsg("Failed to send CREATE BARRIER EXECUTE request "
-						 	"to the node")));
+					 errmsg("Failed to send CREATE BARRIER %s request "
+						 	"to the node",
+							command == CREATE_BARRIER_SYNC ? "SYNC" : "EXECUTE")));
 
 		barrier_idlen = strlen(id) + 1;
 
@@ -393,12 +430,13 @@ ExecuteBarrier(const char *id)
 					 errmsg("Out of memory")));
 		}
 
+		PGXCNodeCountMessageSent(handle);
 		handle->outBuffer[handle->outEnd++] = 'b';
 		msglen = htonl(msglen);
 		memcpy(handle->outBuffer + handle->outEnd, &msglen, 4);
 		handle->outEnd += 4;
 
-		handle->outBuffer[handle->outEnd++] = CREATE_BARRIER_EXECUTE;
+		handle->outBuffer[handle->outEnd++] = command;
 
 		memcpy(handle->outBuffer + handle->outEnd, id, barrier_idlen);
 		handle->outEnd += barrier_idlen;
@@ -406,26 +444,59 @@ ExecuteBarrier(const char *id)
 		handle->state = DN_CONNECTION_STATE_QUERY;
 		pgxc_node_flush(handle);
 	}
+}
 
-	CheckBarrierCommandStatus(conn_handles, id, "EXECUTE");
+/*
+ * Execute the barrier command on all the components, including Datanodes and
+ * Coordinators. The handles are returned to SyncBarrier, which must use the
+ * same sessions to flush the records written here.
+ */
+static PGXCNodeAllHandles *
+ExecuteBarrier(const char *id)
+{
+	List *barrierDataNodeList = GetAllDataNodes();
+	List *barrierCoordList = GetAllCoordNodes();
+	PGXCNodeAllHandles *conn_handles;
 
-	pfree_pgxc_all_handles(conn_handles);
+	conn_handles = get_handles(barrierDataNodeList, barrierCoordList, false);
 
+	elog(DEBUG1, "Sending CREATE BARRIER <%s> EXECUTE message to "
+				 "Datanodes and Coordinator", id);
 	/*
-	 * Also WAL log the BARRIER locally and flush the WAL buffers to disk
+	 * Send a CREATE BARRIER request to all the Datanodes and the Coordinators
 	 */
-	{
-		XLogRecData rdata[1];
-		XLogRecPtr recptr;
+	SendBarrierRequest(conn_handles, id, CREATE_BARRIER_EXECUTE);
 
-		rdata[0].data = (char *) id;
-		rdata[0].len = strlen(id) + 1;
-		rdata[0].buffer = InvalidBuffer;
-		rdata[0].next = NULL;
+	CheckBarrierCommandStatus(conn_handles, id, "EXECUTE");
+
+	/*
+	 * Also WAL log the BARRIER locally, it is flushed by SyncBarrier
+	 */
+	BarrierRecPtr = InsertBarrierRecord(id);
+
+	return conn_handles;
+}
+
+/*
+ * Flush the BARRIER records on all the components, once the 2PC commits
+ * resumed.
+ */
+static void
+SyncBarrier(PGXCNodeAllHandles *conn_handles, const char *id)
+{
+	elog(DEBUG1, "Sending CREATE BARRIER <%s> SYNC message to "
+				 "Datanodes and Coordinator", id);
 
-		recptr = XLogInsert(RM_BARRIER_ID, XLOG_BARRIER_CREATE, rdata);
-		XLogFlush(recptr);
+	SendBarrierRequest(conn_handles, id, CREATE_BARRIER_SYNC);
+
+	/* Flush the local record while the remote nodes do the same */
+	if (!XLogRecPtrIsInvalid(BarrierRecPtr))
+	{
+		XLogFlush(BarrierRecPtr);
+		BarrierRecPtr = InvalidXLogRecPtr;
 	}
+
+	CheckBarrierCommandStatus(conn_handles, id, "SYNC");
 }
 
 /*
@@ -446,6 +517,7 @@ void
 RequestBarrier(const char *id, char *completionTag)
 {
 	PGXCNodeAllHandles *prepared_handles;
+	PGXCNodeAllHandles *executed_handles;
 	const char *barrier_id;
 
 	elog(DEBUG1, "CREATE BARRIER request received");
@@ -479,12 +551,19 @@ RequestBarrier(const char *id, char *completionTag)
 	 * Step two. Issue BARRIER command to all involved components, including
 	 * Coordinators and Datanodes
 	 */
-	ExecuteBarrier(barrier_id);
+	executed_handles = ExecuteBarrier(barrier_id);
 
 	/*
 	 * Step three. Inform Coordinators about a successfully completed barrier
 	 */
 	EndBarrier(prepared_handles, barrier_id);
+
+	/*
+	 * Step four. Make the barrier durable on all the components, the 2PC
+	 * commits do not wait for that
+	 */
+	SyncBarrier(executed_handles, barrier_id);
+	pfree_pgxc_all_handles(executed_handles);
 	/* Finally report the barrier to GTM to backup its restart point */
 	//ReportBarrierGTM((char *)barrier_id);
 
@@ -61,7 +61,12 @@ RemoteCopy_GetRelationLoc(RemoteCopyData *state,
 		else
 		{
 			/* All nodes necessary */
+#ifdef ADB
+			/* The node list belongs to the relcache */
+			exec_nodes->nodeList = list_copy(state->rel_loc->nodeList);
+#else
 			exec_nodes->nodeList = list_concat(exec_nodes->nodeList, state->rel_loc->nodeList);
+#endif
 		}
 	}
 
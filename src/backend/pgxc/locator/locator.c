@@ -50,18 +50,45 @@
 #include "access/hash.h"
 
 #ifdef ADB
+#include "access/sysattr.h"
 #include "access/transam.h"
+#include "catalog/pg_operator.h"
 #include "fmgr.h"
+#include "miscadmin.h"
 #include "postmaster/autovacuum.h"
+#include "storage/itemptr.h"
+#include "utils/array.h"
 #include "utils/datum.h"
+#include "utils/memutils.h"
+#include "utils/typcache.h"
 #endif
 
 static Expr *pgxc_find_distcol_expr(Index varno, AttrNumber attrNum,
 												Node *quals);
+#ifdef ADB
+static Expr *pgxc_find_distcol_array_expr(Index varno, AttrNumber attrNum,
+										  Node *quals);
+static Expr *pgxc_coerce_distcol_expr(Expr *expr, Oid type, int32 typmod);
+static bool pgxc_expr_not_from_params(Node *node, bool *has_param);
+static int pgxc_balance_replicated_read(List *relNodes);
+#ifdef ADB
+static void DestroyRelationLocInfo(RelationLocInfo *relationLocInfo);
+#endif
+static int GetValueNodePosition(RelationLocInfo *rel_loc_info, Oid type,
+								Datum value, bool *found);
+static ExecNodes *pgxc_prune_range_nodes(RelationLocInfo *rel_loc_info,
+										 Index varno, Node *quals,
+										 RelationAccessType relaccess);
+static Expr *pgxc_find_rowid_expr(Index varno, Node *quals);
+#endif
 
 Oid		primary_data_node = InvalidOid;
 int		num_preferred_data_nodes = 0;
 Oid		preferred_data_node[MAX_PREFERRED_NODES];
+#ifdef ADB
+bool	online_bucket_redistribution = false;
+int		replicated_read_routing = REPLICATED_READ_PREFERRED;
+#endif
 
 static const unsigned int xc_mod_m[] =
 {
@@ -139,6 +166,12 @@ GetPreferredReplicationNode(List *relNodes)
 	if (list_length(relNodes) <= 0)
 		elog(ERROR, "a list of nodes should have at least one node");
 
+#ifdef ADB
+	if (replicated_read_routing != REPLICATED_READ_PREFERRED &&
+		list_length(relNodes) > 1)
+		return list_make1_int(pgxc_balance_replicated_read(relNodes));
+#endif
+
 	foreach(item, relNodes)
 	{
 		int cnt_nodes;
@@ -159,6 +192,48 @@ GetPreferredReplicationNode(List *relNodes)
 	return list_make1_int(nodeid);
 }
 
+#ifdef ADB
+/*
+ * pgxc_balance_replicated_read
+ * Pick the Datanode of relNodes reading a replicated table, following
+ * replicated_read_routing.  Nodes are tried in turn from a position moving
+ * at each call, so with least_loaded the ties are spread as well.
+ */
+static int
+pgxc_balance_replicated_read(List *relNodes)
+{
+	static unsigned int next_read = 0;
+	int			numNodes = list_length(relNodes);
+	int			start;
+	int			best = -1;
+	int			best_load = 0;
+	int			i;
+
+	/* Sessions start at different nodes */
+	if (next_read == 0)
+		next_read = (unsigned int) MyProcPid;
+	start = (int) (next_read++ % (unsigned int) numNodes);
+
+	if (replicated_read_routing == REPLICATED_READ_ROUND_ROBIN)
+		return list_nth_int(relNodes, start);
+
+	for (i = 0; i < numNodes; i++)
+	{
+		int		nodeid = list_nth_int(relNodes, (start + i) % numNodes);
+		int		load;
+
+		load = PgxcNodeGetLoad(PGXCNodeGetNodeOid(nodeid, PGXC_NODE_DATANODE));
+		if (best < 0 || load < best_load)
+		{
+			best = nodeid;
+			best_load = load;
+		}
+	}
+
+	return best;
+}
+#endif
+
 /*
  * compute_modulo
  * This function performs modulo in an optimized way
@@ -227,6 +302,574 @@ get_node_from_modulo(int modulo, List *nodeList)
 }
 
 
+#ifdef ADB
+/*
+ * Same results as compute_hash() for LOCATOR_TYPE_HASH, for the types
+ * distributed by most, without going through the fmgr interface.
+ */
+static long
+locator_hash_int4(Datum value)
+{
+	return (long) hash_uint32((uint32) DatumGetInt32(value));
+}
+
+static long
+locator_hash_int2(Datum value)
+{
+	return (long) hash_uint32((uint32) (int32) DatumGetInt16(value));
+}
+
+static long
+locator_hash_int8(Datum value)
+{
+	int64	val = DatumGetInt64(value);
+	uint32	lohalf = (uint32) val;
+	uint32	hihalf = (uint32) (val >> 32);
+
+	/* same folding as hashint8 */
+	lohalf ^= (val >= 0) ? hihalf : ~hihalf;
+	return (long) hash_uint32(lohalf);
+}
+
+static long
+locator_hash_text(Datum value)
+{
+	text   *key = DatumGetTextPP(value);
+	Datum	result;
+
+	result = hash_any((unsigned char *) VARDATA_ANY(key),
+					  VARSIZE_ANY_EXHDR(key));
+	if ((Pointer) key != DatumGetPointer(value))
+		pfree(key);
+	return (long) result;
+}
+
+/*
+ * locator_hash_function
+ *
+ * Function hashing the values of "type" for LOCATOR_TYPE_HASH, NULL if
+ * compute_hash() has to be used.
+ */
+static LocatorHashFunc
+locator_hash_function(Oid type)
+{
+	switch (type)
+	{
+		case INT4OID:
+			return locator_hash_int4;
+		case INT2OID:
+			return locator_hash_int2;
+		case INT8OID:
+			return locator_hash_int8;
+		case VARCHAR2OID:
+		case NVARCHAR2OID:
+		case VARCHAROID:
+		case TEXTOID:
+			return locator_hash_text;
+		default:
+			return NULL;
+	}
+}
+
+/*
+ * locator_hash_value
+ *
+ * Same result as compute_hash(), with a shortcut for the distribution
+ * types used most.
+ */
+static inline long
+locator_hash_value(Oid type, Datum value, char locator)
+{
+	if (locator == LOCATOR_TYPE_HASH)
+	{
+		LocatorHashFunc hashfunc = locator_hash_function(type);
+
+		if (hashfunc)
+			return hashfunc(value);
+	}
+
+	return (long) compute_hash(type, value, locator);
+}
+
+/*
+ * get_bucket_of_value
+ * Virtual bucket of a distribution column value among "numBuckets" ones.
+ */
+static inline int
+get_bucket_of_value(Oid type, Datum value, int numBuckets)
+{
+	return compute_modulo(labs(locator_hash_value(type, value, LOCATOR_TYPE_HASH)),
+						  numBuckets);
+}
+
+/*
+ * BuildBucketMap
+ *
+ * Build the map of "numBuckets" virtual buckets on the nodes "newNodes",
+ * each entry of the map being a position in "newNodes".
+ *
+ * "oldMap", when given, is the current map of the buckets on "oldNodes".
+ * A bucket stays on its node as long as this node is kept and does not
+ * hold more than its share, so adding or removing nodes only moves the
+ * buckets needed to balance the nodes again, about 1/N of the data when
+ * going from N-1 to N nodes. Without "rebalance", a bucket stays on any
+ * node kept and only the buckets of removed nodes move, the balance being
+ * restored later by pgxc_redistribute_buckets(). The result only depends
+ * on the arguments, so every Coordinator builds the same map.
+ */
+int16 *
+BuildBucketMap(int numBuckets,
+			   const int16 *oldMap,
+			   const Oid *oldNodes,
+			   int oldNum,
+			   const Oid *newNodes,
+			   int newNum,
+			   bool rebalance)
+{
+	int16	   *map;
+	int		   *count;
+	int		   *quota;
+	int		   *oldToNew = NULL;
+	int			base;
+	int			extra;
+	int			bucket;
+	int			pos;
+	int			i, j;
+
+	if (numBuckets <= 0 || newNum <= 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("cannot distribute %d buckets on %d nodes",
+						numBuckets, newNum)));
+
+	map = (int16 *) palloc(sizeof(int16) * numBuckets);
+	count = (int *) palloc0(sizeof(int) * newNum);
+	quota = (int *) palloc(sizeof(int) * newNum);
+
+	/* New position of the old nodes, -1 for a node removed */
+	if (oldMap)
+	{
+		oldToNew = (int *) palloc(sizeof(int) * oldNum);
+		for (i = 0; i < oldNum; i++)
+		{
+			oldToNew[i] = -1;
+			for (j = 0; j < newNum; j++)
+			{
+				if (oldNodes[i] == newNodes[j])
+				{
+					oldToNew[i] = j;
+					break;
+				}
+			}
+		}
+	}
+
+#define OLD_BUCKET_POS(b) \
+	((oldMap && oldMap[b] >= 0 && oldMap[b] < oldNum) ? oldToNew[oldMap[b]] : -1)
+
+	/* Buckets each node could keep */
+	for (bucket = 0; bucket < numBuckets; bucket++)
+	{
+		pos = OLD_BUCKET_POS(bucket);
+		if (pos >= 0)
+			count[pos]++;
+	}
+
+	/*
+	 * Every node gets the same share, the remaining buckets go to the nodes
+	 * already holding the most of them.
+	 */
+	base = numBuckets / newNum;
+	extra = numBuckets % newNum;
+	for (j = 0; j < newNum; j++)
+		quota[j] = base;
+	for (i = 0; i < extra; i++)
+	{
+		pos = -1;
+		for (j = 0; j < newNum; j++)
+		{
+			if (quota[j] == base && (pos < 0 || count[j] > count[pos]))
+				pos = j;
+		}
+		quota[pos]++;
+	}
+
+	/* No share to respect but the whole number of buckets */
+	if (!rebalance)
+	{
+		for (j = 0; j < newNum; j++)
+			quota[j] = numBuckets;
+	}
+
+	/* Keep buckets in place within the share of their node */
+	MemSet(count, 0, sizeof(int) * newNum);
+	for (bucket = 0; bucket < numBuckets; bucket++)
+	{
+		pos = OLD_BUCKET_POS(bucket);
+		if (pos >= 0 && count[pos] < quota[pos])
+		{
+			map[bucket] = (int16) pos;
+			count[pos]++;
+		} else
+		{
+			map[bucket] = -1;
+		}
+	}
+#undef OLD_BUCKET_POS
+
+	/* Then give the other buckets to the nodes below their share */
+	pos = 0;
+	for (bucket = 0; bucket < numBuckets; bucket++)
+	{
+		if (map[bucket] >= 0)
+			continue;
+		if (!rebalance)
+		{
+			/* the node holding the fewest buckets */
+			pos = 0;
+			for (j = 1; j < newNum; j++)
+			{
+				if (count[j] < count[pos])
+					pos = j;
+			}
+		}
+		while (count[pos] >= quota[pos])
+			pos = (pos + 1) % newNum;
+		map[bucket] = (int16) pos;
+		count[pos]++;
+	}
+
+	pfree(count);
+	pfree(quota);
+	if (oldToNew)
+		pfree(oldToNew);
+
+	return map;
+}
+
+/*
+ * pgxc_bucket_of
+ * SQL callable version of the bucket computation, used by redistribution
+ * to find on Datanodes the rows of the buckets changing of node.
+ */
+Datum
+pgxc_bucket_of(PG_FUNCTION_ARGS)
+{
+	Oid		type = get_fn_expr_argtype(fcinfo->flinfo, 0);
+	int32	numBuckets = PG_GETARG_INT32(1);
+
+	if (!OidIsValid(type))
+		elog(ERROR, "could not determine data type of input");
+	if (numBuckets <= 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("number of buckets must be positive")));
+
+	PG_RETURN_INT32(get_bucket_of_value(type, PG_GETARG_DATUM(0), numBuckets));
+}
+
+/*
+ * pgxc_node_index_of
+ * Index among "numNodes" nodes of the node a distribution column value
+ * goes to with "locator", used by Datanodes redistributing rows between
+ * themselves for a join.
+ */
+Datum
+pgxc_node_index_of(PG_FUNCTION_ARGS)
+{
+	Oid		type = get_fn_expr_argtype(fcinfo->flinfo, 0);
+	char	locator = PG_GETARG_CHAR(1);
+	int32	numNodes = PG_GETARG_INT32(2);
+
+	if (!OidIsValid(type))
+		elog(ERROR, "could not determine data type of input");
+	if (numNodes <= 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("number of nodes must be positive")));
+	if (locator != LOCATOR_TYPE_HASH && locator != LOCATOR_TYPE_MODULO)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("locator type \"%c\" does not distribute by value", locator)));
+
+	PG_RETURN_INT32(compute_modulo(labs(locator_hash_value(type, PG_GETARG_DATUM(0), locator)),
+								   numNodes));
+}
+
+/* A value of a list distribution and the position of its node */
+typedef struct DistValueEntry
+{
+	Datum		value;
+	int16		position;
+} DistValueEntry;
+
+typedef struct DistValueCompareArg
+{
+	FmgrInfo   *cmp;
+	Oid			collation;
+} DistValueCompareArg;
+
+static int
+dist_value_entry_cmp(const void *a, const void *b, void *arg)
+{
+	DistValueCompareArg *cmparg = (DistValueCompareArg *) arg;
+
+	return DatumGetInt32(FunctionCall2Coll(cmparg->cmp, cmparg->collation,
+										   ((const DistValueEntry *) a)->value,
+										   ((const DistValueEntry *) b)->value));
+}
+
+/*
+ * SetLocatorDistValues
+ * Set the bounds of a range distribution or the values of a list
+ * distribution of "locInfo", as given by GetRelationDistributionValues():
+ * a List of Const bounds for a range, a List per node of its Const values
+ * for a list. They are copied in the current memory context.
+ */
+void
+SetLocatorDistValues(RelationLocInfo *locInfo, Oid type, Oid collation,
+					 List *values)
+{
+	TypeCacheEntry *typentry;
+	DistValueEntry *entries;
+	DistValueCompareArg cmparg;
+	ListCell   *lc;
+	int			num = 0;
+	int			i;
+
+	Assert(IsRelationDistributedByRangeOrList(locInfo));
+
+	typentry = lookup_type_cache(type, TYPECACHE_CMP_PROC_FINFO);
+	if (!OidIsValid(typentry->cmp_proc_finfo.fn_oid))
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_FUNCTION),
+				 errmsg("could not identify a comparison function for type %s",
+						format_type_be(type))));
+
+	locInfo->distValueType = type;
+	locInfo->distValueCollation = collation;
+	get_typlenbyval(type, &locInfo->distValueLen, &locInfo->distValueByVal);
+
+	if (locInfo->locatorType == LOCATOR_TYPE_RANGE)
+		num = list_length(values);
+	else
+	{
+		foreach(lc, values)
+			num += list_length((List *) lfirst(lc));
+	}
+
+	entries = (DistValueEntry *) palloc(sizeof(DistValueEntry) * (num > 0 ? num : 1));
+	i = 0;
+	if (locInfo->locatorType == LOCATOR_TYPE_RANGE)
+	{
+		/* Bounds are in ascending order already */
+		foreach(lc, values)
+		{
+			entries[i].value = ((Const *) lfirst(lc))->constvalue;
+			entries[i].position = (int16) (i + 1);
+			i++;
+		}
+	} else
+	{
+		int16		position = 0;
+
+		foreach(lc, values)
+		{
+			ListCell   *item;
+
+			foreach(item, (List *) lfirst(lc))
+			{
+				entries[i].value = ((Const *) lfirst(item))->constvalue;
+				entries[i].position = position;
+				i++;
+			}
+			position++;
+		}
+
+		cmparg.cmp = &typentry->cmp_proc_finfo;
+		cmparg.collation = collation;
+		qsort_arg(entries, num, sizeof(DistValueEntry),
+				  dist_value_entry_cmp, &cmparg);
+	}
+
+	locInfo->numDistValues = num;
+	locInfo->distValues = (Datum *) palloc(sizeof(Datum) * (num > 0 ? num : 1));
+	locInfo->distValuePositions = NULL;
+	if (locInfo->locatorType == LOCATOR_TYPE_LIST)
+		locInfo->distValuePositions = (int16 *) palloc(sizeof(int16) * (num > 0 ? num : 1));
+	for (i = 0; i < num; i++)
+	{
+		locInfo->distValues[i] = datumCopy(entries[i].value,
+										   locInfo->distValueByVal,
+										   locInfo->distValueLen);
+		if (locInfo->distValuePositions)
+			locInfo->distValuePositions[i] = entries[i].position;
+	}
+
+	pfree(entries);
+}
+
+/*
+ * GetLocatorDistValuesNodes
+ * Number of nodes the bounds or values of a range or list distribution are
+ * given for.
+ */
+int
+GetLocatorDistValuesNodes(RelationLocInfo *locInfo)
+{
+	int			num = 0;
+	int			i;
+
+	Assert(IsRelationDistributedByRangeOrList(locInfo));
+
+	if (locInfo->locatorType == LOCATOR_TYPE_RANGE)
+		return locInfo->numDistValues + 1;
+
+	/* Every node of a list has at least one value */
+	for (i = 0; i < locInfo->numDistValues; i++)
+		num = Max(num, locInfo->distValuePositions[i] + 1);
+	return num;
+}
+
+/*
+ * GetValueNodePosition
+ * Position in the node list of the node holding "value" in a relation
+ * distributed by range or list, found by a binary search of the bounds or
+ * values. "*found" is set to false for a value given to no node of a list,
+ * 0 being returned then.
+ */
+static int
+GetValueNodePosition(RelationLocInfo *rel_loc_info, Oid type, Datum value,
+					 bool *found)
+{
+	TypeCacheEntry *typentry;
+	int			low = 0;
+	int			high = rel_loc_info->numDistValues;
+
+	Assert(IsRelationDistributedByRangeOrList(rel_loc_info));
+
+	/* Like what an insert does, convert a value of another type */
+	if (OidIsValid(type) && type != rel_loc_info->distValueType &&
+		!IsBinaryCoercible(type, rel_loc_info->distValueType))
+	{
+		Oid			typOutput;
+		bool		typIsVarlena;
+		Oid			typInput;
+		Oid			typIOParam;
+
+		getTypeOutputInfo(type, &typOutput, &typIsVarlena);
+		getTypeInputInfo(rel_loc_info->distValueType, &typInput, &typIOParam);
+		value = OidInputFunctionCall(typInput,
+									 OidOutputFunctionCall(typOutput, value),
+									 typIOParam, -1);
+	}
+
+	typentry = lookup_type_cache(rel_loc_info->distValueType,
+								 TYPECACHE_CMP_PROC_FINFO);
+
+	*found = true;
+	if (rel_loc_info->locatorType == LOCATOR_TYPE_RANGE)
+	{
+		/* Number of bounds not above the value */
+		while (low < high)
+		{
+			int		mid = (low + high) / 2;
+
+			if (DatumGetInt32(FunctionCall2Coll(&typentry->cmp_proc_finfo,
+												rel_loc_info->distValueCollation,
+												rel_loc_info->distValues[mid],
+												value)) <= 0)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		return low;
+	}
+
+	while (low < high)
+	{
+		int		mid = (low + high) / 2;
+		int		cmp;
+
+		cmp = DatumGetInt32(FunctionCall2Coll(&typentry->cmp_proc_finfo,
+											  rel_loc_info->distValueCollation,
+											  rel_loc_info->distValues[mid],
+											  value));
+		if (cmp == 0)
+			return rel_loc_info->distValuePositions[mid];
+		if (cmp < 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	*found = false;
+	return 0;
+}
+
+/*
+ * pgxc_distribution_values
+ * Bounds of a range distribution or values of a list distribution of a
+ * relation, as given to DISTRIBUTE BY after the column. NULL for the other
+ * distributions.
+ */
+Datum
+pgxc_distribution_values(PG_FUNCTION_ARGS)
+{
+	RelationLocInfo *locInfo = GetRelationLocInfo(PG_GETARG_OID(0));
+	StringInfoData buf;
+	Oid			typOutput;
+	bool		typIsVarlena;
+	int			numNodes;
+	int			i, j;
+
+	if (locInfo == NULL || !IsRelationDistributedByRangeOrList(locInfo))
+		PG_RETURN_NULL();
+
+	getTypeOutputInfo(locInfo->distValueType, &typOutput, &typIsVarlena);
+	initStringInfo(&buf);
+
+	if (locInfo->locatorType == LOCATOR_TYPE_RANGE)
+	{
+		for (i = 0; i < locInfo->numDistValues; i++)
+			appendStringInfo(&buf, i == 0 ? "%s" : ", %s",
+							 quote_literal_cstr(OidOutputFunctionCall(typOutput,
+																	  locInfo->distValues[i])));
+		PG_RETURN_TEXT_P(cstring_to_text(buf.data));
+	}
+
+	/* Values of each node in turn, a row of them if there are several */
+	numNodes = GetLocatorDistValuesNodes(locInfo);
+	for (j = 0; j < numNodes; j++)
+	{
+		int			count = 0;
+
+		for (i = 0; i < locInfo->numDistValues; i++)
+			if (locInfo->distValuePositions[i] == j)
+				count++;
+
+		if (j > 0)
+			appendStringInfoString(&buf, ", ");
+		if (count > 1)
+			appendStringInfoChar(&buf, '(');
+		count = 0;
+		for (i = 0; i < locInfo->numDistValues; i++)
+		{
+			if (locInfo->distValuePositions[i] != j)
+				continue;
+			appendStringInfo(&buf, count++ == 0 ? "%s" : ", %s",
+							 quote_literal_cstr(OidOutputFunctionCall(typOutput,
+																	  locInfo->distValues[i])));
+		}
+		if (count > 1)
+			appendStringInfoChar(&buf, ')');
+	}
+
+	PG_RETURN_TEXT_P(cstring_to_text(buf.data));
+}
+#endif
+
+
 /*
  * GetRelationDistribColumn
  * Return hash column name for relation or NULL if relation is not distributed.
@@ -445,9 +1088,14 @@ IsLocatorInfoEqual(RelationLocInfo *locInfo1,
 		return false;
 
 	/* Same node list? */
+#ifdef ADB
+	if (!IsNodeListEqual(nodeList1, nodeList2))
+		return false;
+#else
 	if (list_difference_int(nodeList1, nodeList2) != NIL ||
 		list_difference_int(nodeList2, nodeList1) != NIL)
 		return false;
+#endif
 
 #ifdef ADB
 	if (locInfo1->funcid != locInfo2->funcid)
@@ -455,11 +1103,55 @@ IsLocatorInfoEqual(RelationLocInfo *locInfo1,
 
 	if (!equal(locInfo1->funcAttrNums, locInfo2->funcAttrNums))
 		return false;
+
+	if (locInfo1->numBuckets != locInfo2->numBuckets)
+		return false;
+
+	if (locInfo1->numBuckets > 0 &&
+		memcmp(locInfo1->bucketMap, locInfo2->bucketMap,
+			   sizeof(int16) * locInfo1->numBuckets) != 0)
+		return false;
+
+	if (IsRelationDistributedByRangeOrList(locInfo1) &&
+		!IsLocatorDistValuesEqual(locInfo1, locInfo2))
+		return false;
 #endif
 	/* Everything is equal */
 	return true;
 }
 
+#ifdef ADB
+/*
+ * IsLocatorDistValuesEqual
+ * Check that two range or list distributions put the same values on the
+ * same node positions.
+ */
+bool
+IsLocatorDistValuesEqual(RelationLocInfo *locInfo1,
+						 RelationLocInfo *locInfo2)
+{
+	int			i;
+
+	if (locInfo1->locatorType != locInfo2->locatorType ||
+		locInfo1->distValueType != locInfo2->distValueType ||
+		locInfo1->distValueCollation != locInfo2->distValueCollation ||
+		locInfo1->numDistValues != locInfo2->numDistValues)
+		return false;
+
+	for (i = 0; i < locInfo1->numDistValues; i++)
+	{
+		if (!datumIsEqual(locInfo1->distValues[i], locInfo2->distValues[i],
+						  locInfo1->distValueByVal, locInfo1->distValueLen))
+			return false;
+		if (locInfo1->distValuePositions &&
+			locInfo1->distValuePositions[i] != locInfo2->distValuePositions[i])
+			return false;
+	}
+
+	return true;
+}
+#endif
+
 /*
  * GetRelationNodes
  *
@@ -479,16 +1171,136 @@ IsLocatorInfoEqual(RelationLocInfo *locInfo1,
  * The returned List is a copy, so it should be freed when finished.
  */
 #ifdef ADB
-ExecNodes *
-GetRelationNodes(RelationLocInfo *rel_loc_info, 
-				 int nelems,
-				 Datum* dist_col_values,
-				 bool* dist_col_nulls,
-				 Oid* dist_col_types,
-				 RelationAccessType accessType)
+/*
+ * GetRelationNodeIndexes
+ *
+ * Route "nrows" values of the distribution column of a relation distributed
+ * by value, the node index of values[i] is stored in nodeIndexes[i]. A NULL
+ * value goes to the first node, as an insert does in GetRelationNodes(). A
+ * value given to no node of a list distribution cannot be inserted, so it
+ * raises an error.
+ *
+ * The node list is scanned once, or not at all when the relcache entry
+ * has it as an array, and the hash function of the distribution column is
+ * the one the relcache entry has looked up, so callers having many rows at
+ * hand should prefer this to calling GetRelationNodes() for each of them.
+ */
+void
+GetRelationNodeIndexes(RelationLocInfo *rel_loc_info,
+					   int nrows,
+					   const Datum *values,
+					   const bool *nulls,
+					   Oid type,
+					   int *nodeIndexes)
 {
-	ExecNodes	*exec_nodes;
-	long		hashValue;
+	char		locatorType;
+	int			nnodes;
+	int		   *nodes;
+	LocatorHashFunc hashfunc = NULL;
+	int			i;
+	ListCell   *lc;
+
+	Assert(rel_loc_info);
+	locatorType = rel_loc_info->locatorType;
+	if (!IsLocatorDistributedByValue(locatorType))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("cannot route values of a relation not distributed by value")));
+
+	nnodes = list_length(rel_loc_info->nodeList);
+	if (nnodes == 0)
+		ereport(ERROR, (errmsg("Modulo value out of range\n")));
+
+	if (IsLocatorDistributedByRangeOrList(locatorType))
+	{
+		for (i = 0; i < nrows; i++)
+		{
+			bool	found = true;
+			int		position = 0;
+
+			if (!nulls || !nulls[i])
+				position = GetValueNodePosition(rel_loc_info, type, values[i],
+												&found);
+			if (!found)
+				ereport(ERROR,
+						(errcode(ERRCODE_CHECK_VIOLATION),
+						 errmsg("no node of relation \"%s\" holds this value of its distribution column",
+								get_rel_name(rel_loc_info->relid))));
+			nodeIndexes[i] = get_node_from_modulo(position,
+												  rel_loc_info->nodeList);
+		}
+		return;
+	}
+
+	if (type == rel_loc_info->hashType)
+		hashfunc = rel_loc_info->hashFunc;
+
+	if (rel_loc_info->nodeIndexes)
+		nodes = rel_loc_info->nodeIndexes;
+	else
+	{
+		/* flatten the node list, list_nth_int is linear */
+		nodes = (int *) palloc(sizeof(int) * nnodes);
+		i = 0;
+		foreach(lc, rel_loc_info->nodeList)
+			nodes[i++] = lfirst_int(lc);
+	}
+
+	if (locatorType == LOCATOR_TYPE_BUCKET)
+	{
+		if (rel_loc_info->numBuckets <= 0 || rel_loc_info->bucketMap == NULL)
+			elog(ERROR, "no bucket map for relation %u", rel_loc_info->relid);
+
+		for (i = 0; i < nrows; i++)
+		{
+			long	hash;
+			int		position;
+
+			if (nulls && nulls[i])
+			{
+				nodeIndexes[i] = nodes[0];
+				continue;
+			}
+
+			hash = hashfunc ? hashfunc(values[i]) :
+				locator_hash_value(type, values[i], LOCATOR_TYPE_HASH);
+			position = rel_loc_info->bucketMap[compute_modulo(labs(hash),
+															  rel_loc_info->numBuckets)];
+			if (position < 0 || position >= nnodes)
+				ereport(ERROR, (errmsg("Modulo value out of range\n")));
+			nodeIndexes[i] = nodes[position];
+		}
+	} else
+	{
+		for (i = 0; i < nrows; i++)
+		{
+			long	hash;
+
+			if (nulls && nulls[i])
+			{
+				nodeIndexes[i] = nodes[0];
+				continue;
+			}
+
+			hash = hashfunc ? hashfunc(values[i]) :
+				locator_hash_value(type, values[i], locatorType);
+			nodeIndexes[i] = nodes[compute_modulo(labs(hash), nnodes)];
+		}
+	}
+
+	if (nodes != rel_loc_info->nodeIndexes)
+		pfree(nodes);
+}
+
+ExecNodes *
+GetRelationNodes(RelationLocInfo *rel_loc_info, 
+				 int nelems,
+				 Datum* dist_col_values,
+				 bool* dist_col_nulls,
+				 Oid* dist_col_types,
+				 RelationAccessType accessType)
+{
+	ExecNodes	*exec_nodes;
 	int		modulo;
 	int		nodeIndex;
 
@@ -497,6 +1309,9 @@ GetRelationNodes(RelationLocInfo *rel_loc_info,
 
 	exec_nodes = makeNode(ExecNodes);
 	exec_nodes->baselocatortype = rel_loc_info->locatorType;
+#ifdef ADB
+	exec_nodes->en_colocation = rel_loc_info->colocation;
+#endif
 	exec_nodes->accesstype = accessType;
 
 	switch (rel_loc_info->locatorType)
@@ -545,6 +1360,7 @@ GetRelationNodes(RelationLocInfo *rel_loc_info,
 
 		case LOCATOR_TYPE_HASH:
 		case LOCATOR_TYPE_MODULO:
+		case LOCATOR_TYPE_BUCKET:
 			{
 				bool isValueNull = dist_col_nulls[0];
 
@@ -552,10 +1368,9 @@ GetRelationNodes(RelationLocInfo *rel_loc_info,
 				
 				if (!isValueNull)
 				{
-					hashValue = compute_hash(dist_col_types[0], dist_col_values[0],
-											 rel_loc_info->locatorType);
-					modulo = compute_modulo(labs(hashValue), list_length(rel_loc_info->nodeList));
-					nodeIndex = get_node_from_modulo(modulo, rel_loc_info->nodeList);
+					GetRelationNodeIndexes(rel_loc_info, 1, dist_col_values,
+										   dist_col_nulls, dist_col_types[0],
+										   &nodeIndex);
 					exec_nodes->nodeList = list_make1_int(nodeIndex);
 				}
 				else
@@ -569,6 +1384,40 @@ GetRelationNodes(RelationLocInfo *rel_loc_info,
 			}
 			break;
 
+		case LOCATOR_TYPE_RANGE:
+		case LOCATOR_TYPE_LIST:
+			{
+				bool	found;
+				int		position;
+
+				Assert(nelems == 1);
+
+				if (dist_col_nulls[0])
+				{
+					if (accessType == RELATION_ACCESS_INSERT)
+						/* Insert NULL to first node*/
+						exec_nodes->nodeList = list_make1_int(linitial_int(rel_loc_info->nodeList));
+					else
+						exec_nodes->nodeList = list_copy(rel_loc_info->nodeList);
+					break;
+				}
+
+				position = GetValueNodePosition(rel_loc_info,
+												dist_col_types[0],
+												dist_col_values[0],
+												&found);
+				if (!found && accessType == RELATION_ACCESS_INSERT)
+					ereport(ERROR,
+							(errcode(ERRCODE_CHECK_VIOLATION),
+							 errmsg("no node of relation \"%s\" holds this value of its distribution column",
+									get_rel_name(rel_loc_info->relid))));
+
+				/* No row has a value of no node, any single node answers */
+				exec_nodes->nodeList = list_make1_int(get_node_from_modulo(position,
+																		   rel_loc_info->nodeList));
+			}
+			break;
+
 		case LOCATOR_TYPE_RROBIN:
 			/*
 			 * round robin, get next one in case of insert. If not insert, all
@@ -634,7 +1483,6 @@ GetRelationNodes(RelationLocInfo *rel_loc_info,
 			}
 			break;
 
-			/* PGXCTODO case LOCATOR_TYPE_RANGE: */
 			/* PGXCTODO case LOCATOR_TYPE_CUSTOM: */
 		default:
 			ereport(ERROR, (errmsg("Error: no such supported locator type: %c\n",
@@ -661,6 +1509,9 @@ GetRelationNodes(RelationLocInfo *rel_loc_info, Datum valueForDistCol,
 
 	exec_nodes = makeNode(ExecNodes);
 	exec_nodes->baselocatortype = rel_loc_info->locatorType;
+#ifdef ADB
+	exec_nodes->en_colocation = rel_loc_info->colocation;
+#endif
 	exec_nodes->accesstype = accessType;
 
 	switch (rel_loc_info->locatorType)
@@ -771,6 +1622,29 @@ GetRelationNodesByQuals(Oid reloid, Index varno, Node *quals,
 		return NULL;
 
 #ifdef ADB
+	/*
+	 * "rowid = const" names the node of the row, whatever the distribution
+	 * of a table which is not replicated.
+	 */
+	if (!IsRelationReplicated(rel_loc_info) &&
+		relaccess != RELATION_ACCESS_INSERT)
+	{
+		Expr	   *rowid_expr = pgxc_find_rowid_expr(varno, quals);
+
+		if (rowid_expr)
+			rowid_expr = (Expr *) eval_const_expressions(NULL,
+														 (Node *) rowid_expr);
+		if (rowid_expr && IsA(rowid_expr, Const) &&
+			!((Const *) rowid_expr)->constisnull)
+		{
+			exec_nodes = GetRelationNodesByRowId(rel_loc_info,
+												 ((Const *) rowid_expr)->constvalue,
+												 relaccess);
+			if (exec_nodes)
+				return exec_nodes;
+		}
+	}
+
 	/*
 	 * If the table distributed by user-defined partition function,
 	 * we should get all qualifiers of the distributed column from the quals,
@@ -835,6 +1709,37 @@ GetRelationNodesByQuals(Oid reloid, Index varno, Node *quals,
 	}
 
 #ifdef ADB
+	/* Look for a list of values, "distcol IN (...)" or "distcol = ANY(...)" */
+	if (!distcol_expr && IsRelationDistributedByValue(rel_loc_info))
+	{
+		Oid		disttype = get_atttype(reloid, rel_loc_info->partAttrNum);
+		Expr   *array_expr;
+
+		array_expr = pgxc_find_distcol_array_expr(varno, rel_loc_info->partAttrNum,
+												  quals);
+		if (array_expr)
+			array_expr = pgxc_coerce_distcol_expr(array_expr,
+												  get_array_type(disttype), -1);
+		if (array_expr && IsA(array_expr, Const) &&
+			!((Const *) array_expr)->constisnull)
+		{
+			exec_nodes = GetRelationNodesByArray(rel_loc_info,
+												 ((Const *) array_expr)->constvalue,
+												 relaccess);
+			if (exec_nodes)
+				return exec_nodes;
+		}
+	}
+
+	/* Keep the nodes whose ranges overlap the bounds given by the quals */
+	if (!distcol_expr && rel_loc_info->locatorType == LOCATOR_TYPE_RANGE)
+	{
+		exec_nodes = pgxc_prune_range_nodes(rel_loc_info, varno, quals,
+											relaccess);
+		if (exec_nodes)
+			return exec_nodes;
+	}
+
 	exec_nodes = GetRelationNodes(rel_loc_info,
 								  1,
 								  &distcol_value,
@@ -850,6 +1755,151 @@ GetRelationNodesByQuals(Oid reloid, Index varno, Node *quals,
 }
 
 #ifdef ADB
+/*
+ * pgxc_prune_range_nodes
+ * Find in the ANDed quals the comparisons of the distribution column of a
+ * relation distributed by range with constants, like "distcol >= const" or
+ * "const > distcol", and return the nodes whose ranges overlap the interval
+ * they define. Returns NULL if no such qual is found.
+ */
+static ExecNodes *
+pgxc_prune_range_nodes(RelationLocInfo *rel_loc_info, Index varno,
+					   Node *quals, RelationAccessType relaccess)
+{
+	TypeCacheEntry *typentry;
+	List	   *lquals;
+	ListCell   *lc;
+	int			first = 0;
+	int			last = rel_loc_info->numDistValues;
+	bool		pruned = false;
+	ExecNodes  *exec_nodes;
+	int			i;
+
+	Assert(rel_loc_info->locatorType == LOCATOR_TYPE_RANGE);
+	if (!quals)
+		return NULL;
+
+	typentry = lookup_type_cache(rel_loc_info->distValueType,
+								 TYPECACHE_BTREE_OPFAMILY | TYPECACHE_CMP_PROC_FINFO);
+	if (!OidIsValid(typentry->btree_opf))
+		return NULL;
+
+	if (!IsA(quals, List))
+		lquals = make_ands_implicit((Expr *) quals);
+	else
+		lquals = (List *) quals;
+
+	foreach(lc, lquals)
+	{
+		OpExpr	   *op = (OpExpr *) lfirst(lc);
+		Expr	   *lexpr;
+		Expr	   *rexpr;
+		Var		   *var;
+		Const	   *cst;
+		int			strategy;
+		bool		found;
+		int			position;
+
+		if (!IsA(op, OpExpr) || list_length(op->args) != 2)
+			continue;
+
+		lexpr = (Expr *) linitial(op->args);
+		rexpr = (Expr *) lsecond(op->args);
+		if (IsA(lexpr, RelabelType))
+			lexpr = ((RelabelType *) lexpr)->arg;
+		if (IsA(rexpr, RelabelType))
+			rexpr = ((RelabelType *) rexpr)->arg;
+
+		strategy = get_op_opfamily_strategy(op->opno, typentry->btree_opf);
+		if (strategy == 0)
+			continue;
+
+		/* Make it "distcol <op> const" */
+		if (IsA(lexpr, Var) && IsA(rexpr, Const))
+		{
+			var = (Var *) lexpr;
+			cst = (Const *) rexpr;
+		} else
+		if (IsA(rexpr, Var) && IsA(lexpr, Const))
+		{
+			var = (Var *) rexpr;
+			cst = (Const *) lexpr;
+			if (strategy == BTLessStrategyNumber)
+				strategy = BTGreaterStrategyNumber;
+			else if (strategy == BTLessEqualStrategyNumber)
+				strategy = BTGreaterEqualStrategyNumber;
+			else if (strategy == BTGreaterStrategyNumber)
+				strategy = BTLessStrategyNumber;
+			else if (strategy == BTGreaterEqualStrategyNumber)
+				strategy = BTLessEqualStrategyNumber;
+		} else
+			continue;
+
+		if (var->varno != varno || var->varlevelsup != 0 ||
+			var->varattno != rel_loc_info->partAttrNum ||
+			cst->constisnull)
+			continue;
+
+		/* The bounds are sorted with the collation of the column */
+		if (op->inputcollid != rel_loc_info->distValueCollation)
+			continue;
+
+		/* Cross-type comparisons are left to the Datanodes */
+		if (cst->consttype != rel_loc_info->distValueType &&
+			!IsBinaryCoercible(cst->consttype, rel_loc_info->distValueType))
+			continue;
+
+		position = GetValueNodePosition(rel_loc_info, InvalidOid,
+										cst->constvalue, &found);
+		switch (strategy)
+		{
+			case BTLessStrategyNumber:
+				/* The node starting at the constant has nothing below it */
+				if (position > 0 &&
+					DatumGetInt32(FunctionCall2Coll(&typentry->cmp_proc_finfo,
+													rel_loc_info->distValueCollation,
+													rel_loc_info->distValues[position - 1],
+													cst->constvalue)) == 0)
+					position--;
+				last = Min(last, position);
+				break;
+			case BTLessEqualStrategyNumber:
+				last = Min(last, position);
+				break;
+			case BTEqualStrategyNumber:
+				first = Max(first, position);
+				last = Min(last, position);
+				break;
+			case BTGreaterEqualStrategyNumber:
+			case BTGreaterStrategyNumber:
+				first = Max(first, position);
+				break;
+			default:
+				continue;
+		}
+		pruned = true;
+	}
+
+	if (!pruned)
+		return NULL;
+
+	exec_nodes = makeNode(ExecNodes);
+	exec_nodes->baselocatortype = rel_loc_info->locatorType;
+#ifdef ADB
+	exec_nodes->en_colocation = rel_loc_info->colocation;
+#endif
+	exec_nodes->accesstype = relaccess;
+
+	/* Contradictory quals match no row, any single node answers */
+	if (first > last)
+		first = last;
+	for (i = first; i <= last; i++)
+		exec_nodes->nodeList = lappend_int(exec_nodes->nodeList,
+										   list_nth_int(rel_loc_info->nodeList, i));
+
+	return exec_nodes;
+}
+
 ExecNodes *
 GetRelationNodesByMultQuals(RelationLocInfo *rel_loc_info,
 							Oid reloid, Index varno, Node *quals,
@@ -1057,15 +2107,32 @@ GetAllCoordNodes(void)
 void
 RelationBuildLocator(Relation rel)
 {
+#ifndef ADB
 	Relation	pcrel;
 	ScanKeyData	skey;
 	SysScanDesc	pcscan;
+#endif
 	HeapTuple	htup;
 	MemoryContext	oldContext;
 	RelationLocInfo	*relationLocInfo;
 	int		j;
 	Form_pgxc_class	pgxc_class;
 
+#ifdef ADB
+	/*
+	 * Go through the syscache, so that a new session finds the row in the
+	 * shared catalog cache if another one read it already.
+	 */
+	htup = SearchSysCache1(PGXCCLASSRELID,
+						   ObjectIdGetDatum(RelationGetRelid(rel)));
+
+	if (!HeapTupleIsValid(htup))
+	{
+		/* Assume local relation only */
+		rel->rd_locator_info = NULL;
+		return;
+	}
+#else
 	ScanKeyInit(&skey,
 				Anum_pgxc_class_pcrelid,
 				BTEqualStrategyNumber, F_OIDEQ,
@@ -1084,13 +2151,27 @@ RelationBuildLocator(Relation rel)
 		heap_close(pcrel, AccessShareLock);
 		return;
 	}
+#endif
 
 	pgxc_class = (Form_pgxc_class) GETSTRUCT(htup);
 
 	oldContext = MemoryContextSwitchTo(CacheMemoryContext);
 
+#ifdef ADB
+	/* zeroed, so that an error while building it leaves nothing to free */
+	relationLocInfo = (RelationLocInfo *) palloc0(sizeof(RelationLocInfo));
+#else
 	relationLocInfo = (RelationLocInfo *) palloc(sizeof(RelationLocInfo));
+#endif
 	rel->rd_locator_info = relationLocInfo;
+#ifdef ADB
+	relationLocInfo->cached = true;
+	relationLocInfo->inXactList = false;
+	relationLocInfo->refcount = 0;
+	relationLocInfo->nodeIndexes = NULL;
+	relationLocInfo->hashFunc = NULL;
+	relationLocInfo->hashType = InvalidOid;
+#endif
 
 	relationLocInfo->relid = RelationGetRelid(rel);
 	relationLocInfo->locatorType = pgxc_class->pclocatortype;
@@ -1133,6 +2214,66 @@ RelationBuildLocator(Relation rel)
 #ifdef ADB
 	relationLocInfo->funcid = InvalidOid;
 	relationLocInfo->funcAttrNums = NIL;
+	relationLocInfo->numBuckets = 0;
+	relationLocInfo->bucketMap = NULL;
+	relationLocInfo->numDistValues = 0;
+	relationLocInfo->distValues = NULL;
+	relationLocInfo->distValuePositions = NULL;
+	relationLocInfo->distValueType = InvalidOid;
+	relationLocInfo->distValueCollation = InvalidOid;
+	relationLocInfo->distValueLen = 0;
+	relationLocInfo->distValueByVal = false;
+	{
+		Datum		skewDatum;
+		bool		isnull;
+
+		skewDatum = SysCacheGetAttr(PGXCCLASSRELID, htup,
+									Anum_pgxc_class_pcnodeskew, &isnull);
+		relationLocInfo->nodeSkew = isnull ? 1.0 : DatumGetFloat4(skewDatum);
+	}
+	{
+		Datum		colocationDatum;
+		bool		isnull;
+
+		colocationDatum = SysCacheGetAttr(PGXCCLASSRELID, htup,
+										  Anum_pgxc_class_pccolocation, &isnull);
+		relationLocInfo->colocation = isnull ? 0 : DatumGetInt32(colocationDatum);
+	}
+	if (relationLocInfo->locatorType == LOCATOR_TYPE_BUCKET)
+	{
+		Datum		mapDatum;
+		bool		isnull;
+		int2vector *map;
+
+		mapDatum = SysCacheGetAttr(PGXCCLASSRELID, htup,
+								   Anum_pgxc_class_pcbucketmap, &isnull);
+		if (isnull)
+			elog(ERROR, "null bucket map for relation %u", RelationGetRelid(rel));
+		map = (int2vector *) DatumGetPointer(mapDatum);
+		relationLocInfo->numBuckets = map->dim1;
+		relationLocInfo->bucketMap = (int16 *) palloc(sizeof(int16) * map->dim1);
+		memcpy(relationLocInfo->bucketMap, map->values, sizeof(int16) * map->dim1);
+	} else
+	if (IsRelationDistributedByRangeOrList(relationLocInfo))
+	{
+		Datum		valuesDatum;
+		bool		isnull;
+		List	   *values;
+		Form_pg_attribute attr;
+
+		valuesDatum = SysCacheGetAttr(PGXCCLASSRELID, htup,
+									  Anum_pgxc_class_pcdistvalues, &isnull);
+		if (isnull)
+			elog(ERROR, "null distribution values for relation %u", RelationGetRelid(rel));
+		attr = rel->rd_att->attrs[relationLocInfo->partAttrNum - 1];
+
+		/* Only the values themselves go to the cache */
+		MemoryContextSwitchTo(oldContext);
+		values = (List *) stringToNode(TextDatumGetCString(valuesDatum));
+		MemoryContextSwitchTo(CacheMemoryContext);
+		SetLocatorDistValues(relationLocInfo, attr->atttypid,
+							 attr->attcollation, values);
+	} else
 	if (relationLocInfo->locatorType == LOCATOR_TYPE_USER_DEFINED)
 	{
 		Datum funcidDatum;
@@ -1153,14 +2294,81 @@ RelationBuildLocator(Relation rel)
 			relationLocInfo->funcAttrNums = lappend_int(relationLocInfo->funcAttrNums,
 														attrnums->values[j]);
 	}
+
+	/* What routing a row needs, looked up once */
+	if (relationLocInfo->nodeList != NIL)
+	{
+		ListCell   *lc;
+
+		relationLocInfo->nodeIndexes = (int *)
+			palloc(sizeof(int) * list_length(relationLocInfo->nodeList));
+		j = 0;
+		foreach(lc, relationLocInfo->nodeList)
+			relationLocInfo->nodeIndexes[j++] = lfirst_int(lc);
+	}
+	if ((relationLocInfo->locatorType == LOCATOR_TYPE_HASH ||
+		 relationLocInfo->locatorType == LOCATOR_TYPE_BUCKET) &&
+		relationLocInfo->partAttrNum > 0)
+	{
+		relationLocInfo->hashType =
+			rel->rd_att->attrs[relationLocInfo->partAttrNum - 1]->atttypid;
+		relationLocInfo->hashFunc =
+			locator_hash_function(relationLocInfo->hashType);
+	}
 #endif
 
+#ifdef ADB
+	ReleaseSysCache(htup);
+#else
 	systable_endscan(pcscan);
 	heap_close(pcrel, AccessShareLock);
+#endif
 
 	MemoryContextSwitchTo(oldContext);
 }
 
+#ifdef ADB
+/* Locator information handed out in the current transaction */
+static List *locInfoInXact = NIL;
+
+/*
+ * GetLocatorRelationInfo
+ * Returns the locator information for relation. It is the one of the
+ * relcache entry, not a copy: the caller must not change it and should
+ * release it with FreeRelationLocInfo(), it stays valid until then or until
+ * the end of the transaction at the latest. Callers wanting to modify it
+ * use CopyRelationLocInfo().
+ */
+RelationLocInfo *
+GetRelationLocInfo(Oid relid)
+{
+	RelationLocInfo *ret_loc_info = NULL;
+	Relation	rel = relation_open(relid, AccessShareLock);
+
+	/* Relation needs to be valid */
+	Assert(rel->rd_isvalid);
+
+	if (rel->rd_locator_info)
+	{
+		ret_loc_info = rel->rd_locator_info;
+		Assert(ret_loc_info->cached);
+
+		if (!ret_loc_info->inXactList)
+		{
+			MemoryContext oldContext = MemoryContextSwitchTo(TopMemoryContext);
+
+			locInfoInXact = lappend(locInfoInXact, ret_loc_info);
+			MemoryContextSwitchTo(oldContext);
+			ret_loc_info->inXactList = true;
+		}
+		ret_loc_info->refcount++;
+	}
+
+	relation_close(rel, AccessShareLock);
+
+	return ret_loc_info;
+}
+#else
 /*
  * GetLocatorRelationInfo
  * Returns the locator information for relation,
@@ -1182,6 +2390,7 @@ GetRelationLocInfo(Oid relid)
 
 	return ret_loc_info;
 }
+#endif
 
 /*
  * CopyRelationLocInfo
@@ -1204,6 +2413,37 @@ CopyRelationLocInfo(RelationLocInfo *srcInfo)
 	destInfo->funcid = srcInfo->funcid;
 	if (srcInfo->funcAttrNums)
 		destInfo->funcAttrNums = list_copy(srcInfo->funcAttrNums);
+	destInfo->numBuckets = srcInfo->numBuckets;
+	if (srcInfo->numBuckets > 0)
+	{
+		destInfo->bucketMap = (int16 *) palloc(sizeof(int16) * srcInfo->numBuckets);
+		memcpy(destInfo->bucketMap, srcInfo->bucketMap,
+			   sizeof(int16) * srcInfo->numBuckets);
+	}
+	destInfo->nodeSkew = srcInfo->nodeSkew;
+	destInfo->colocation = srcInfo->colocation;
+	destInfo->numDistValues = srcInfo->numDistValues;
+	destInfo->distValueType = srcInfo->distValueType;
+	destInfo->distValueCollation = srcInfo->distValueCollation;
+	destInfo->distValueLen = srcInfo->distValueLen;
+	destInfo->distValueByVal = srcInfo->distValueByVal;
+	if (srcInfo->distValues)
+	{
+		int		i;
+		int		num = srcInfo->numDistValues;
+
+		destInfo->distValues = (Datum *) palloc(sizeof(Datum) * (num > 0 ? num : 1));
+		for (i = 0; i < num; i++)
+			destInfo->distValues[i] = datumCopy(srcInfo->distValues[i],
+												srcInfo->distValueByVal,
+												srcInfo->distValueLen);
+		if (srcInfo->distValuePositions)
+		{
+			destInfo->distValuePositions = (int16 *) palloc(sizeof(int16) * (num > 0 ? num : 1));
+			memcpy(destInfo->distValuePositions, srcInfo->distValuePositions,
+				   sizeof(int16) * num);
+		}
+	}
 #endif
 
 	/* Note: for roundrobin, we use the relcache entry */
@@ -1211,6 +2451,221 @@ CopyRelationLocInfo(RelationLocInfo *srcInfo)
 }
 
 
+#ifdef ADB
+/*
+ * GetRelationNodesByArray
+ * Get the nodes holding the rows of a relation distributed by value whose
+ * distribution column is equal to any element of "array". Null elements
+ * are equal to no row and are skipped, as are the elements given to no node
+ * of a list distribution. Returns NULL if the array has no element to look
+ * for, the nodes can not be reduced then.
+ */
+ExecNodes *
+GetRelationNodesByArray(RelationLocInfo *rel_loc_info, Datum array,
+						RelationAccessType relaccess)
+{
+	ArrayType  *arr = DatumGetArrayTypeP(array);
+	Oid			elemtype = ARR_ELEMTYPE(arr);
+	int16		elmlen;
+	bool		elmbyval;
+	char		elmalign;
+	Datum	   *values;
+	bool	   *nulls;
+	int			nvalues;
+	int		   *nodeIndexes;
+	int			nkeys = 0;
+	int			i;
+	ExecNodes  *exec_nodes;
+
+	get_typlenbyvalalign(elemtype, &elmlen, &elmbyval, &elmalign);
+	deconstruct_array(arr, elemtype, elmlen, elmbyval, elmalign,
+					  &values, &nulls, &nvalues);
+
+	/* Keep the values only, null ones would be routed to the first node */
+	for (i = 0; i < nvalues; i++)
+	{
+		if (!nulls[i])
+			values[nkeys++] = values[i];
+	}
+	if (nkeys == 0)
+	{
+		pfree(values);
+		pfree(nulls);
+		return NULL;
+	}
+
+	exec_nodes = makeNode(ExecNodes);
+	exec_nodes->baselocatortype = rel_loc_info->locatorType;
+#ifdef ADB
+	exec_nodes->en_colocation = rel_loc_info->colocation;
+#endif
+	exec_nodes->accesstype = relaccess;
+
+	nodeIndexes = (int *) palloc(sizeof(int) * nkeys);
+	if (rel_loc_info->locatorType == LOCATOR_TYPE_LIST)
+	{
+		bool		found;
+		int			position;
+
+		for (i = 0; i < nkeys; i++)
+		{
+			position = GetValueNodePosition(rel_loc_info, elemtype, values[i],
+											&found);
+			if (found)
+				exec_nodes->nodeList = list_append_unique_int(exec_nodes->nodeList,
+															  list_nth_int(rel_loc_info->nodeList, position));
+		}
+
+		/* No row has any of these values, any single node answers */
+		if (exec_nodes->nodeList == NIL)
+			exec_nodes->nodeList = list_make1_int(linitial_int(rel_loc_info->nodeList));
+	} else
+	{
+		GetRelationNodeIndexes(rel_loc_info, nkeys, values, NULL, elemtype,
+							   nodeIndexes);
+		for (i = 0; i < nkeys; i++)
+			exec_nodes->nodeList = list_append_unique_int(exec_nodes->nodeList,
+														  nodeIndexes[i]);
+	}
+
+	pfree(nodeIndexes);
+	pfree(values);
+	pfree(nulls);
+
+	return exec_nodes;
+}
+
+/*
+ * GetRelationDistribParamExpr
+ * Find in the quals an expression giving the values of the distribution
+ * column of a relation distributed by value, which can not
+ * be computed while planning but only once the parameters of the query are
+ * known, like "distcol = $1" or "distcol = ANY($1)". The expression is
+ * returned coerced to the type of the column, or to an array of it with
+ * "*is_array" set. Returns NULL if there is no such expression.
+ */
+Expr *
+GetRelationDistribParamExpr(Oid reloid, Index varno, Node *quals,
+							bool *is_array)
+{
+	RelationLocInfo *rel_loc_info = GetRelationLocInfo(reloid);
+	Oid			disttype;
+	int32		disttypmod;
+	Expr	   *expr;
+	bool		has_param = false;
+
+	if (!rel_loc_info)
+		return NULL;
+	if (!IsRelationDistributedByValue(rel_loc_info))
+	{
+		FreeRelationLocInfo(rel_loc_info);
+		return NULL;
+	}
+
+	disttype = get_atttype(reloid, rel_loc_info->partAttrNum);
+	disttypmod = get_atttypmod(reloid, rel_loc_info->partAttrNum);
+
+	*is_array = false;
+	expr = pgxc_find_distcol_expr(varno, rel_loc_info->partAttrNum, quals);
+	if (expr)
+		expr = pgxc_coerce_distcol_expr(expr, disttype, disttypmod);
+	else
+	{
+		expr = pgxc_find_distcol_array_expr(varno, rel_loc_info->partAttrNum,
+											quals);
+		if (expr)
+			expr = pgxc_coerce_distcol_expr(expr, get_array_type(disttype), -1);
+		*is_array = true;
+	}
+	FreeRelationLocInfo(rel_loc_info);
+
+	/* The Coordinator computes it before sending the query */
+	if (!expr || IsA(expr, Const) ||
+		pgxc_expr_not_from_params((Node *) expr, &has_param) || !has_param ||
+		contain_mutable_functions((Node *) expr))
+		return NULL;
+
+	return expr;
+}
+
+/*
+ * GetRelationNodesByRowId
+ * Get the node holding the row of a relation which is not replicated that
+ * "rowid" points to. The node identifier in a rowid is the one of the
+ * Datanode which made it, a rowid of no node of the relation gives any
+ * single node, which has no such row either. Returns NULL for a replicated
+ * relation, the rowids of its copies are different.
+ */
+ExecNodes *
+GetRelationNodesByRowId(RelationLocInfo *rel_loc_info, Datum rowid,
+						RelationAccessType relaccess)
+{
+	uint32		node_id = rowid_get_node_id(rowid);
+	ExecNodes  *exec_nodes;
+	ListCell   *lc;
+
+	if (IsRelationReplicated(rel_loc_info) || rel_loc_info->nodeList == NIL)
+		return NULL;
+
+	exec_nodes = makeNode(ExecNodes);
+	exec_nodes->baselocatortype = rel_loc_info->locatorType;
+#ifdef ADB
+	exec_nodes->en_colocation = rel_loc_info->colocation;
+#endif
+	exec_nodes->accesstype = relaccess;
+
+	foreach(lc, rel_loc_info->nodeList)
+	{
+		Oid			nodeoid = PGXCNodeGetNodeOid(lfirst_int(lc),
+												 PGXC_NODE_DATANODE);
+
+		if (get_pgxc_node_id(nodeoid) == node_id)
+		{
+			exec_nodes->nodeList = list_make1_int(lfirst_int(lc));
+			return exec_nodes;
+		}
+	}
+
+	exec_nodes->nodeList = list_make1_int(linitial_int(rel_loc_info->nodeList));
+	return exec_nodes;
+}
+
+/*
+ * GetRelationRowIdParamExpr
+ * Same as GetRelationDistribParamExpr() for "rowid = $1": find in the quals
+ * an expression giving the rowid of the row of a relation which is not
+ * replicated, computed from the parameters of the query only. Returns NULL
+ * if there is no such expression.
+ */
+Expr *
+GetRelationRowIdParamExpr(Oid reloid, Index varno, Node *quals)
+{
+	RelationLocInfo *rel_loc_info = GetRelationLocInfo(reloid);
+	Expr	   *expr;
+	bool		has_param = false;
+
+	if (!rel_loc_info)
+		return NULL;
+	if (IsRelationReplicated(rel_loc_info))
+	{
+		FreeRelationLocInfo(rel_loc_info);
+		return NULL;
+	}
+	FreeRelationLocInfo(rel_loc_info);
+
+	expr = pgxc_find_rowid_expr(varno, quals);
+	if (expr)
+		expr = (Expr *) eval_const_expressions(NULL, (Node *) expr);
+
+	if (!expr || IsA(expr, Const) ||
+		pgxc_expr_not_from_params((Node *) expr, &has_param) || !has_param ||
+		contain_mutable_functions((Node *) expr))
+		return NULL;
+
+	return expr;
+}
+#endif
+
 /*
  * FreeRelationLocInfo
  * Free RelationLocInfo struct
@@ -1218,10 +2673,101 @@ CopyRelationLocInfo(RelationLocInfo *srcInfo)
 void
 FreeRelationLocInfo(RelationLocInfo *relationLocInfo)
 {
+#ifdef ADB
+	if (relationLocInfo == NULL)
+		return;
+
+	/* Shared one, see GetRelationLocInfo */
+	if (relationLocInfo->cached || relationLocInfo->inXactList)
+	{
+		Assert(relationLocInfo->refcount > 0);
+		relationLocInfo->refcount--;
+		if (relationLocInfo->refcount == 0 && !relationLocInfo->cached)
+		{
+			locInfoInXact = list_delete_ptr(locInfoInXact, relationLocInfo);
+			DestroyRelationLocInfo(relationLocInfo);
+		}
+		return;
+	}
+#endif
 	if (relationLocInfo)
 		pfree(relationLocInfo);
 }
 
+#ifdef ADB
+/*
+ * DestroyRelationLocInfo
+ * Free the locator information of a relcache entry and all it points to
+ */
+static void
+DestroyRelationLocInfo(RelationLocInfo *relationLocInfo)
+{
+	int			i;
+
+	list_free(relationLocInfo->nodeList);
+	list_free(relationLocInfo->funcAttrNums);
+	if (relationLocInfo->bucketMap)
+		pfree(relationLocInfo->bucketMap);
+	if (relationLocInfo->distValues)
+	{
+		if (!relationLocInfo->distValueByVal)
+		{
+			for (i = 0; i < relationLocInfo->numDistValues; i++)
+				pfree(DatumGetPointer(relationLocInfo->distValues[i]));
+		}
+		pfree(relationLocInfo->distValues);
+	}
+	if (relationLocInfo->distValuePositions)
+		pfree(relationLocInfo->distValuePositions);
+	if (relationLocInfo->nodeIndexes)
+		pfree(relationLocInfo->nodeIndexes);
+	pfree(relationLocInfo);
+}
+
+/*
+ * ReleaseCachedRelationLocInfo
+ * The relcache entry holding this locator information is going away. It is
+ * freed now if nobody else uses it, else when the last reference to it is
+ * released or at the end of the transaction.
+ */
+void
+ReleaseCachedRelationLocInfo(RelationLocInfo *relationLocInfo)
+{
+	Assert(relationLocInfo->cached);
+	relationLocInfo->cached = false;
+
+	if (relationLocInfo->inXactList && relationLocInfo->refcount > 0)
+		return;
+
+	if (relationLocInfo->inXactList)
+		locInfoInXact = list_delete_ptr(locInfoInXact, relationLocInfo);
+	DestroyRelationLocInfo(relationLocInfo);
+}
+
+/*
+ * AtEOXact_RelationLocInfo
+ * References to locator information do not outlive the transaction, free
+ * what the relcache entries have dropped meanwhile.
+ */
+void
+AtEOXact_RelationLocInfo(void)
+{
+	ListCell   *lc;
+
+	foreach(lc, locInfoInXact)
+	{
+		RelationLocInfo *relationLocInfo = (RelationLocInfo *) lfirst(lc);
+
+		relationLocInfo->inXactList = false;
+		relationLocInfo->refcount = 0;
+		if (!relationLocInfo->cached)
+			DestroyRelationLocInfo(relationLocInfo);
+	}
+	list_free(locInfoInXact);
+	locInfoInXact = NIL;
+}
+#endif
+
 /*
  * FreeExecNodes
  * Free the contents of the ExecNodes expression
@@ -1240,6 +2786,99 @@ FreeExecNodes(ExecNodes **exec_nodes)
 	*exec_nodes = NULL;
 }
 
+#ifdef ADB
+/*
+ * GetNodeListBitmap
+ * Return the set of node indexes of a node list as a Bitmapset, so that
+ * node lists can be compared in linear time.
+ */
+Bitmapset *
+GetNodeListBitmap(List *nodeList)
+{
+	Bitmapset  *nodes = NULL;
+	ListCell   *lc;
+
+	foreach(lc, nodeList)
+		nodes = bms_add_member(nodes, lfirst_int(lc));
+
+	return nodes;
+}
+
+/*
+ * IsNodeListSubset
+ * Is every node of nodeList1 in nodeList2 too?
+ */
+bool
+IsNodeListSubset(List *nodeList1, List *nodeList2)
+{
+	Bitmapset  *nodes2;
+	ListCell   *lc;
+	bool		result = true;
+
+	if (nodeList1 == NIL)
+		return true;
+
+	nodes2 = GetNodeListBitmap(nodeList2);
+	foreach(lc, nodeList1)
+	{
+		if (!bms_is_member(lfirst_int(lc), nodes2))
+		{
+			result = false;
+			break;
+		}
+	}
+	bms_free(nodes2);
+
+	return result;
+}
+
+/*
+ * IsNodeListEqual
+ * Do both node lists hold the same nodes, in whatever order?
+ */
+bool
+IsNodeListEqual(List *nodeList1, List *nodeList2)
+{
+	Bitmapset  *nodes1 = GetNodeListBitmap(nodeList1);
+	Bitmapset  *nodes2 = GetNodeListBitmap(nodeList2);
+	bool		result;
+
+	result = bms_equal(nodes1, nodes2);
+	bms_free(nodes1);
+	bms_free(nodes2);
+
+	return result;
+}
+
+/*
+ * GetNodeListIntersection
+ * Return the nodes of nodeList1 also in nodeList2, in the order of
+ * nodeList1 like list_intersection_int().
+ */
+List *
+GetNodeListIntersection(List *nodeList1, List *nodeList2)
+{
+	Bitmapset  *nodes2;
+	List	   *result = NIL;
+	ListCell   *lc;
+
+	if (nodeList1 == NIL || nodeList2 == NIL)
+		return NIL;
+
+	nodes2 = GetNodeListBitmap(nodeList2);
+	foreach(lc, nodeList1)
+	{
+		int			node = lfirst_int(lc);
+
+		if (bms_is_member(node, nodes2))
+			result = lappend_int(result, node);
+	}
+	bms_free(nodes2);
+
+	return result;
+}
+#endif
+
 /*
  * pgxc_find_distcol_expr
  * Search through the quals provided and find out an expression which will give
@@ -1346,3 +2985,157 @@ pgxc_find_distcol_expr(Index varno,
 	/* Exhausted all quals, but no distribution column expression */
 	return NULL;
 }
+
+#ifdef ADB
+/*
+ * pgxc_find_distcol_array_expr
+ * Same as pgxc_find_distcol_expr() for a list of values: find among the
+ * ANDed quals one of the form "<distribution_col> = ANY (<array expr>)",
+ * which is also how "<distribution_col> IN (...)" looks, and return the
+ * array expression.
+ */
+static Expr *
+pgxc_find_distcol_array_expr(Index varno,
+							 AttrNumber attrNum,
+							 Node *quals)
+{
+	List	   *lquals;
+	ListCell   *qual_cell;
+
+	if (!quals)
+		return NULL;
+
+	if (!IsA(quals, List))
+		lquals = make_ands_implicit((Expr *)quals);
+	else
+		lquals = (List *)quals;
+
+	foreach(qual_cell, lquals)
+	{
+		ScalarArrayOpExpr *saop = (ScalarArrayOpExpr *) lfirst(qual_cell);
+		Expr	   *lexpr;
+
+		if (!IsA(saop, ScalarArrayOpExpr) || !saop->useOr ||
+			list_length(saop->args) != 2)
+			continue;
+
+		lexpr = linitial(saop->args);
+		if (IsA(lexpr, RelabelType))
+			lexpr = ((RelabelType *) lexpr)->arg;
+		if (!IsA(lexpr, Var) ||
+			((Var *) lexpr)->varno != varno ||
+			((Var *) lexpr)->varattno != attrNum)
+			continue;
+
+		/* Same test of an equality operator as pgxc_find_distcol_expr() */
+		if (!op_mergejoinable(saop->opno, exprType((Node *) lexpr)) &&
+			!op_hashjoinable(saop->opno, exprType((Node *) lexpr)))
+			continue;
+
+		return (Expr *) lsecond(saop->args);
+	}
+
+	return NULL;
+}
+
+/*
+ * pgxc_find_rowid_expr
+ * Find among the ANDed quals one of the form "rowid = <expr>" on the rowid
+ * of relation "varno" and return the expression.
+ */
+static Expr *
+pgxc_find_rowid_expr(Index varno, Node *quals)
+{
+	List	   *lquals;
+	ListCell   *qual_cell;
+
+	if (!quals)
+		return NULL;
+
+	if (!IsA(quals, List))
+		lquals = make_ands_implicit((Expr *)quals);
+	else
+		lquals = (List *)quals;
+
+	foreach(qual_cell, lquals)
+	{
+		OpExpr	   *op = (OpExpr *) lfirst(qual_cell);
+		Node	   *lexpr;
+		Node	   *rexpr;
+		Var		   *var;
+
+		if (!IsA(op, OpExpr) || op->opno != RIDEqualOperator ||
+			list_length(op->args) != 2)
+			continue;
+
+		lexpr = linitial(op->args);
+		rexpr = lsecond(op->args);
+		if (IsA(lexpr, Var) &&
+			((Var *) lexpr)->varattno == ADB_RowIdAttributeNumber)
+			var = (Var *) lexpr;
+		else if (IsA(rexpr, Var) &&
+				 ((Var *) rexpr)->varattno == ADB_RowIdAttributeNumber)
+		{
+			var = (Var *) rexpr;
+			rexpr = lexpr;
+		} else
+			continue;
+
+		if (var->varno != varno || var->varlevelsup != 0)
+			continue;
+
+		return (Expr *) rexpr;
+	}
+
+	return NULL;
+}
+
+/*
+ * pgxc_coerce_distcol_expr
+ * Cast an expression giving values of the distribution column to the type
+ * of the column, as an insert of the value would do, and simplify it.
+ * Returns NULL if there is no such cast.
+ */
+static Expr *
+pgxc_coerce_distcol_expr(Expr *expr, Oid type, int32 typmod)
+{
+	if (!OidIsValid(type))
+		return NULL;
+
+	expr = (Expr *) coerce_to_target_type(NULL, (Node *) expr,
+										  exprType((Node *) expr),
+										  type, typmod,
+										  COERCION_ASSIGNMENT,
+										  COERCE_IMPLICIT_CAST, -1);
+	if (expr)
+		expr = (Expr *) eval_const_expressions(NULL, (Node *) expr);
+	return expr;
+}
+
+/*
+ * pgxc_expr_not_from_params
+ * Check whether an expression needs anything else than the parameters of
+ * the query to be computed, noting in "*has_param" whether it uses any.
+ */
+static bool
+pgxc_expr_not_from_params(Node *node, bool *has_param)
+{
+	if (node == NULL)
+		return false;
+
+	if (IsA(node, Param))
+	{
+		if (((Param *) node)->paramkind != PARAM_EXTERN)
+			return true;
+		*has_param = true;
+		return false;
+	}
+
+	if (IsA(node, Var) || IsA(node, SubLink) || IsA(node, Aggref) ||
+		IsA(node, WindowFunc) || IsA(node, CurrentOfExpr))
+		return true;
+
+	return expression_tree_walker(node, pgxc_expr_not_from_params,
+								  (void *) has_param);
+}
+#endif
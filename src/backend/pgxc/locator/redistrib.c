@@ -19,6 +19,7 @@
 #include "access/htup.h"
 #include "access/xact.h"
 #include "catalog/pg_type.h"
+#include "catalog/pgxc_class.h"
 #include "catalog/pgxc_node.h"
 #include "commands/tablecmds.h"
 #include "pgxc/copyops.h"
@@ -30,12 +31,25 @@
 #include "utils/rel.h"
 #include "utils/snapmgr.h"
 #include "utils/builtins.h"
+#ifdef ADB
+#include "executor/spi.h"
+#include "pgxc/peerconn.h"
+#include "pgxc/pgxcnode.h"
+#include "utils/acl.h"
+#include "utils/array.h"
+#include "utils/inval.h"
+#include "utils/relcache.h"
+#endif
 
 #define IsCommandTypePreUpdate(x) (x == CATALOG_UPDATE_BEFORE || \
 								   x == CATALOG_UPDATE_BOTH)
 #define IsCommandTypePostUpdate(x) (x == CATALOG_UPDATE_AFTER || \
 									x == CATALOG_UPDATE_BOTH)
 
+#ifdef ADB
+bool		enable_direct_redistribution = false;
+#endif
+
 /* Functions used for the execution of redistribution commands */
 static void distrib_execute_query(char *sql, bool is_temp, ExecNodes *exec_nodes);
 static void distrib_execute_command(RedistribState *distribState, RedistribCommand *command);
@@ -44,6 +58,28 @@ static void distrib_copy_from(RedistribState *distribState, ExecNodes *exec_node
 static void distrib_truncate(RedistribState *distribState, ExecNodes *exec_nodes);
 static void distrib_reindex(RedistribState *distribState, ExecNodes *exec_nodes);
 static void distrib_delete_hash(RedistribState *distribState, ExecNodes *exec_nodes);
+#ifdef ADB
+static void distrib_copy_to_bucket(RedistribState *distribState, ExecNodes *exec_nodes);
+static void distrib_delete_bucket(RedistribState *distribState, ExecNodes *exec_nodes,
+								  bool moved_only);
+static void distrib_pull_bucket(RedistribState *distribState, ExecNodes *exec_nodes);
+
+/* Rows inserted by pgxc_redist_pull_buckets */
+typedef struct PullBucketState
+{
+	SPIPlanPtr	plan;			/* INSERT of one row */
+	int			natts;
+	FmgrInfo   *inputs;			/* input functions of the columns */
+	Oid		   *ioparams;
+	int32	   *typmods;
+	Datum	   *values;
+	char	   *nulls;
+	int64		rows;			/* rows inserted */
+} PullBucketState;
+
+static void pull_bucket_row(char **values, int natts, void *arg);
+static void distrib_append_bucket_cond(StringInfo buf, Relation rel, List *buckets);
+#endif
 
 /* Functions used to build the command list */
 static void pgxc_redist_build_entry(RedistribState *distribState,
@@ -57,6 +93,16 @@ static void pgxc_redist_build_replicate_to_distrib(RedistribState *distribState,
 								RelationLocInfo *newLocInfo);
 
 static void pgxc_redist_build_default(RedistribState *distribState);
+#ifdef ADB
+static void pgxc_redist_build_bucket(RedistribState *distribState,
+								RelationLocInfo *oldLocInfo,
+								RelationLocInfo *newLocInfo);
+static void pgxc_redist_build_bucket_pull(RedistribState *distribState,
+								RelationLocInfo *oldLocInfo,
+								RelationLocInfo *newLocInfo,
+								List *sourceNodes,
+								List *removedNodes);
+#endif
 static void pgxc_redist_add_reindex(RedistribState *distribState);
 
 
@@ -135,6 +181,11 @@ pgxc_redist_build_entry(RedistribState *distribState,
 	/* Evaluate cases for replicated to distributed tables */
 	pgxc_redist_build_replicate_to_distrib(distribState, oldLocInfo, newLocInfo);
 
+#ifdef ADB
+	/* Evaluate cases for buckets changing of node */
+	pgxc_redist_build_bucket(distribState, oldLocInfo, newLocInfo);
+#endif
+
 	/* PGXCTODO: perform more complex builds of command list */
 
 	/* Fallback to default */
@@ -164,6 +215,12 @@ pgxc_redist_build_replicate_to_distrib(RedistribState *distribState,
 		!IsRelationDistributedByValue(newLocInfo))
 		return;
 
+#ifdef ADB
+	/* No DELETE command filters rows by bounds or values, use the default */
+	if (IsRelationDistributedByRangeOrList(newLocInfo))
+		return;
+#endif
+
 	/* Get the list of nodes that are added to the relation */
 	removedNodes = list_difference_int(oldLocInfo->nodeList, newLocInfo->nodeList);
 
@@ -217,6 +274,15 @@ pgxc_redist_build_replicate_to_distrib(RedistribState *distribState,
 		distribState->commands = lappend(distribState->commands,
 					 makeRedistribCommand(DISTRIB_DELETE_MODULO, CATALOG_UPDATE_AFTER, execNodes));
 	}
+#ifdef ADB
+	else if (newLocInfo->locatorType == LOCATOR_TYPE_BUCKET)
+	{
+		ExecNodes *execNodes = makeNode(ExecNodes);
+		execNodes->nodeList = newLocInfo->nodeList;
+		distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_DELETE_BUCKET, CATALOG_UPDATE_AFTER, execNodes));
+	}
+#endif
 	else
 		ereport(ERROR,
 				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
@@ -227,6 +293,177 @@ pgxc_redist_build_replicate_to_distrib(RedistribState *distribState,
 }
 
 
+#ifdef ADB
+/*
+ * pgxc_redist_build_bucket
+ * Build redistribution command list for a table distributed by bucket
+ * whose set of nodes is changed. Only the rows of the buckets changing of
+ * node are moved:
+ * COPY TO of moved buckets -> DELETE of moved buckets -> COPY FROM
+ * or, with enable_direct_redistribution, the nodes receiving buckets
+ * fetch them by themselves from the nodes they leave:
+ * PULL of moved buckets -> DELETE of buckets not owned any more
+ */
+static void
+pgxc_redist_build_bucket(RedistribState *distribState,
+						 RelationLocInfo *oldLocInfo,
+						 RelationLocInfo *newLocInfo)
+{
+	List	   *removedNodes;
+	List	   *sourceNodes = NIL;
+	int			bucket;
+
+	/* If a command list has already been built, nothing to do */
+	if (list_length(distribState->commands) != 0)
+		return;
+
+	/* Only the node list may have changed */
+	if (oldLocInfo->locatorType != LOCATOR_TYPE_BUCKET ||
+		newLocInfo->locatorType != LOCATOR_TYPE_BUCKET ||
+		oldLocInfo->partAttrNum != newLocInfo->partAttrNum ||
+		oldLocInfo->numBuckets != newLocInfo->numBuckets ||
+		oldLocInfo->numBuckets <= 0)
+		return;
+
+	/* Look for the buckets changing of node and the nodes they leave */
+	for (bucket = 0; bucket < oldLocInfo->numBuckets; bucket++)
+	{
+		int oldNode = list_nth_int(oldLocInfo->nodeList, oldLocInfo->bucketMap[bucket]);
+		int newNode = list_nth_int(newLocInfo->nodeList, newLocInfo->bucketMap[bucket]);
+
+		if (oldNode == newNode)
+			continue;
+
+		distribState->buckets = lappend_int(distribState->buckets, bucket);
+		if (!list_member_int(sourceNodes, oldNode))
+			sourceNodes = lappend_int(sourceNodes, oldNode);
+	}
+
+	/* Nothing moves, and so no node has been removed */
+	if (distribState->buckets == NIL)
+	{
+		/* Add a no-op so as the default list is not used */
+		distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_NONE, CATALOG_UPDATE_NONE, NULL));
+		return;
+	}
+
+	/* Nodes removed are fully moved, so a TRUNCATE is enough on them */
+	removedNodes = list_difference_int(oldLocInfo->nodeList, newLocInfo->nodeList);
+
+	/*
+	 * Datanodes read each other in separate sessions, which cannot see rows
+	 * written before in the same transaction nor temporary tables.
+	 */
+	if (enable_direct_redistribution &&
+		!IsTransactionBlock() &&
+		!IsTempTable(distribState->relid))
+	{
+		pgxc_redist_build_bucket_pull(distribState, oldLocInfo, newLocInfo,
+									  sourceNodes, removedNodes);
+		return;
+	}
+
+	sourceNodes = list_difference_int(sourceNodes, removedNodes);
+
+	/* Fetch the rows of moved buckets */
+	{
+		ExecNodes *execNodes = makeNode(ExecNodes);
+		execNodes->nodeList = list_union_int(sourceNodes, removedNodes);
+		distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_COPY_TO_BUCKET, CATALOG_UPDATE_BEFORE, execNodes));
+	}
+
+	/* Then remove them from the nodes they leave */
+	if (sourceNodes != NIL)
+	{
+		ExecNodes *execNodes = makeNode(ExecNodes);
+		execNodes->nodeList = sourceNodes;
+		distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_DELETE_BUCKET, CATALOG_UPDATE_BEFORE, execNodes));
+	}
+	if (removedNodes != NIL)
+	{
+		ExecNodes *execNodes = makeNode(ExecNodes);
+		execNodes->nodeList = removedNodes;
+		distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_TRUNCATE, CATALOG_UPDATE_BEFORE, execNodes));
+	}
+
+	/* And send them to their new nodes using updated catalogs */
+	distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_COPY_FROM, CATALOG_UPDATE_AFTER, NULL));
+}
+
+/*
+ * pgxc_redist_build_bucket_pull
+ * Build the commands moving buckets directly between Datanodes. Rows do
+ * not go through the Coordinator: every node receiving buckets connects
+ * to the nodes these buckets leave and inserts them locally, then the
+ * old nodes delete the rows which are not theirs any more. All of this is
+ * done once catalogs are updated, the rows being only deleted once they
+ * have been copied.
+ */
+static void
+pgxc_redist_build_bucket_pull(RedistribState *distribState,
+							  RelationLocInfo *oldLocInfo,
+							  RelationLocInfo *newLocInfo,
+							  List *sourceNodes,
+							  List *removedNodes)
+{
+	List	   *targetNodes = NIL;
+	int			oldNullNode = linitial_int(oldLocInfo->nodeList);
+	int			newNullNode = linitial_int(newLocInfo->nodeList);
+	ListCell   *item;
+
+	foreach(item, distribState->buckets)
+	{
+		int bucket = lfirst_int(item);
+		int newNode = list_nth_int(newLocInfo->nodeList, newLocInfo->bucketMap[bucket]);
+
+		if (!list_member_int(targetNodes, newNode))
+			targetNodes = lappend_int(targetNodes, newNode);
+	}
+
+	/* NULL values follow the first node of the list */
+	if (oldNullNode != newNullNode)
+	{
+		if (!list_member_int(sourceNodes, oldNullNode))
+			sourceNodes = lappend_int(sourceNodes, oldNullNode);
+		if (!list_member_int(targetNodes, newNullNode))
+			targetNodes = lappend_int(targetNodes, newNullNode);
+	}
+
+	distribState->sources = sourceNodes;
+
+	/* Fetch the moved rows on the nodes they go to */
+	{
+		ExecNodes *execNodes = makeNode(ExecNodes);
+		execNodes->nodeList = targetNodes;
+		distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_PULL_BUCKET, CATALOG_UPDATE_AFTER, execNodes));
+	}
+
+	/* Then remove them from the nodes they left */
+	sourceNodes = list_difference_int(sourceNodes, removedNodes);
+	if (sourceNodes != NIL)
+	{
+		ExecNodes *execNodes = makeNode(ExecNodes);
+		execNodes->nodeList = sourceNodes;
+		distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_DELETE_BUCKET, CATALOG_UPDATE_AFTER, execNodes));
+	}
+	if (removedNodes != NIL)
+	{
+		ExecNodes *execNodes = makeNode(ExecNodes);
+		execNodes->nodeList = removedNodes;
+		distribState->commands = lappend(distribState->commands,
+					 makeRedistribCommand(DISTRIB_TRUNCATE, CATALOG_UPDATE_AFTER, execNodes));
+	}
+}
+#endif
+
+
 /*
  * pgxc_redist_build_replicate
  * Build redistribution command list for replicated tables
@@ -365,7 +602,23 @@ distrib_execute_command(RedistribState *distribState, RedistribCommand *command)
 		case DISTRIB_DELETE_MODULO:
 			distrib_delete_hash(distribState, command->execNodes);
 			break;
+#ifdef ADB
+		case DISTRIB_COPY_TO_BUCKET:
+			distrib_copy_to_bucket(distribState, command->execNodes);
+			break;
+		case DISTRIB_DELETE_BUCKET:
+			/* Once catalogs are updated, moved rows may be on their new node */
+			distrib_delete_bucket(distribState, command->execNodes,
+								  IsCommandTypePreUpdate(command->updateState));
+			break;
+		case DISTRIB_PULL_BUCKET:
+			distrib_pull_bucket(distribState, command->execNodes);
+			break;
 		case DISTRIB_NONE:
+			break;
+#else
+		case DISTRIB_NONE:
+#endif
 		default:
 			Assert(0); /* Should not happen */
 	}
@@ -481,8 +734,13 @@ distrib_copy_from(RedistribState *distribState, ExecNodes *exec_nodes)
 	 */
 	if (exec_nodes && exec_nodes->nodeList != NIL)
 	{
+		/* The locator information of the relcache cannot be changed */
+		RelationLocInfo *rel_loc = CopyRelationLocInfo(copyState->rel_loc);
+
+		FreeRelationLocInfo(copyState->rel_loc);
+		rel_loc->nodeList = exec_nodes->nodeList;
+		copyState->rel_loc = rel_loc;
 		copyState->exec_nodes->nodeList = exec_nodes->nodeList;
-		copyState->rel_loc->nodeList = exec_nodes->nodeList;
 	}
 
 	tupdesc = RelationGetDescr(rel);
@@ -837,6 +1095,591 @@ distrib_delete_hash(RedistribState *distribState, ExecNodes *exec_nodes)
 }
 
 
+#ifdef ADB
+/*
+ * distrib_append_bucket_cond
+ * Append to buf the condition matching the rows of the given buckets.
+ */
+static void
+distrib_append_bucket_cond(StringInfo buf, Relation rel, List *buckets)
+{
+	RelationLocInfo *locinfo = RelationGetLocInfo(rel);
+	ListCell   *lc;
+	char		sep = '{';
+
+	Assert(locinfo && locinfo->locatorType == LOCATOR_TYPE_BUCKET);
+
+	appendStringInfo(buf, "pg_catalog.pgxc_bucket_of(%s, %d) = ANY ('",
+					 quote_identifier(get_attname(RelationGetRelid(rel),
+												  locinfo->partAttrNum)),
+					 locinfo->numBuckets);
+	foreach(lc, buckets)
+	{
+		appendStringInfo(buf, "%c%d", sep, lfirst_int(lc));
+		sep = ',';
+	}
+	appendStringInfoString(buf, "}'::pg_catalog.int4[])");
+}
+
+/*
+ * distrib_copy_to_bucket
+ * Copy the rows of the buckets moved by redistribution, their list is saved
+ * in distribution state when building the command list. As for
+ * distrib_copy_to, the data is saved in a tuplestore.
+ */
+static void
+distrib_copy_to_bucket(RedistribState *distribState, ExecNodes *exec_nodes)
+{
+	Oid			relOid = distribState->relid;
+	Relation	rel;
+	StringInfoData buf;
+	PGXCNodeHandle **connections;
+	ExecNodes  *local_exec_nodes;
+	Tuplestorestate *store;
+
+	/* Nothing to do if on remote node */
+	if (IS_PGXC_DATANODE || IsConnFromCoord())
+		return;
+
+	/* A sufficient lock level needs to be taken at a higher level */
+	rel = relation_open(relOid, NoLock);
+
+	/* Inform client of operation being done */
+	ereport(DEBUG1,
+			(errmsg("Copying moved buckets for relation \"%s.%s\"",
+					quote_identifier(get_namespace_name(RelationGetNamespace(rel))),
+					RelationGetRelationName(rel))));
+
+	/* Same output as COPY TO done by distrib_copy_to */
+	initStringInfo(&buf);
+	appendStringInfoString(&buf, "COPY (SELECT * FROM ONLY ");
+	if (rel->rd_backend == MyBackendId)
+		appendStringInfoString(&buf, quote_identifier(RelationGetRelationName(rel)));
+	else
+		appendStringInfoString(&buf, quote_qualified_identifier(
+								get_namespace_name(RelationGetNamespace(rel)),
+								RelationGetRelationName(rel)));
+	appendStringInfoString(&buf, " WHERE ");
+	distrib_append_bucket_cond(&buf, rel, distribState->buckets);
+	appendStringInfoString(&buf, ") TO STDOUT");
+
+	local_exec_nodes = makeNode(ExecNodes);
+	local_exec_nodes->nodeList = exec_nodes->nodeList;
+
+	connections = pgxcNodeCopyBegin(buf.data,
+									local_exec_nodes->nodeList,
+									GetActiveSnapshot(),
+									PGXC_NODE_DATANODE);
+
+	store = tuplestore_begin_heap(true, false, work_mem);
+	DataNodeCopyOut(local_exec_nodes,
+					connections,
+					RelationGetDescr(rel),
+					NULL,
+					store,
+					REMOTE_COPY_TUPLESTORE);
+
+	pfree(local_exec_nodes);
+	pfree(buf.data);
+
+	/* Lock is maintained until transaction commits */
+	relation_close(rel, NoLock);
+
+	distribState->store = store;
+}
+
+/*
+ * distrib_delete_bucket
+ * Delete remote tuples of buckets not located on their node any more.
+ * With "moved_only", the tuples of the moved buckets listed in distribution
+ * state are deleted, otherwise each node only keeps the tuples of the
+ * buckets the current catalogs give to it.
+ */
+static void
+distrib_delete_bucket(RedistribState *distribState, ExecNodes *exec_nodes,
+					  bool moved_only)
+{
+	Relation	rel;
+	RelationLocInfo *locinfo;
+	StringInfoData buf;
+	Oid			relOid = distribState->relid;
+	const char *relname;
+	const char *colname;
+	ListCell   *item;
+	int			nodepos;
+
+	/* Nothing to do if on remote node */
+	if (IS_PGXC_DATANODE || IsConnFromCoord())
+		return;
+
+	/* A sufficient lock level needs to be taken at a higher level */
+	rel = relation_open(relOid, NoLock);
+	locinfo = RelationGetLocInfo(rel);
+
+	/* Inform client of operation being done */
+	ereport(DEBUG1,
+			(errmsg("Deleting necessary tuples \"%s.%s\"",
+					quote_identifier(get_namespace_name(RelationGetNamespace(rel))),
+					RelationGetRelationName(rel))));
+
+	if (rel->rd_backend == MyBackendId)
+		relname = quote_identifier(RelationGetRelationName(rel));
+	else
+		relname = quote_qualified_identifier(get_namespace_name(RelationGetNamespace(rel)),
+											 RelationGetRelationName(rel));
+	colname = quote_identifier(GetRelationDistribColumn(locinfo));
+	initStringInfo(&buf);
+
+	if (moved_only)
+	{
+		Assert(distribState->buckets != NIL);
+		appendStringInfo(&buf, "DELETE FROM ONLY %s WHERE ", relname);
+		distrib_append_bucket_cond(&buf, rel, distribState->buckets);
+		distrib_execute_query(buf.data, IsTempTable(relOid), exec_nodes);
+	} else
+	{
+		/* Launch one DELETE to each node as it depends on its buckets */
+		foreach(item, exec_nodes->nodeList)
+		{
+			int			nodenum = lfirst_int(item);
+			List	   *buckets = NIL;
+			ExecNodes  *local_exec_nodes = makeNode(ExecNodes);
+			int			bucket;
+
+			local_exec_nodes->nodeList = list_make1_int(nodenum);
+
+			/* Find the position of node in node list of locator information */
+			nodepos = 0;
+			while (nodepos < list_length(locinfo->nodeList) &&
+				   list_nth_int(locinfo->nodeList, nodepos) != nodenum)
+				nodepos++;
+
+			for (bucket = 0; bucket < locinfo->numBuckets; bucket++)
+			{
+				if (locinfo->bucketMap[bucket] == nodepos)
+					buckets = lappend_int(buckets, bucket);
+			}
+
+			/* Lets leave NULLs on the first node and delete from the rest */
+			resetStringInfo(&buf);
+			appendStringInfo(&buf, "DELETE FROM ONLY %s WHERE ", relname);
+			if (nodepos != 0)
+				appendStringInfo(&buf, "%s IS NULL OR ", colname);
+			if (buckets == NIL)
+				appendStringInfoString(&buf, "true");
+			else
+			{
+				appendStringInfoString(&buf, "NOT ");
+				distrib_append_bucket_cond(&buf, rel, buckets);
+			}
+
+			distrib_execute_query(buf.data, IsTempTable(relOid), local_exec_nodes);
+
+			FreeExecNodes(&local_exec_nodes);
+			list_free(buckets);
+		}
+	}
+
+	relation_close(rel, NoLock);
+
+	pfree(buf.data);
+}
+
+/*
+ * distrib_pull_bucket
+ * Ask the nodes receiving buckets to fetch them from the nodes in the
+ * source list of distribution state. Catalogs are already updated, every
+ * node gets the same command with the new owner of each moved bucket and
+ * only takes its own buckets, so all of them work at the same time.
+ */
+static void
+distrib_pull_bucket(RedistribState *distribState, ExecNodes *exec_nodes)
+{
+	Relation	rel;
+	RelationLocInfo *locinfo;
+	StringInfoData buf;
+	Oid			relOid = distribState->relid;
+	ListCell   *item;
+	bool		first;
+
+	/* Nothing to do if on remote node */
+	if (IS_PGXC_DATANODE || IsConnFromCoord())
+		return;
+
+	/* A sufficient lock level needs to be taken at a higher level */
+	rel = relation_open(relOid, NoLock);
+	locinfo = RelationGetLocInfo(rel);
+
+	/* Inform client of operation being done */
+	ereport(DEBUG1,
+			(errmsg("Fetching moved buckets between Datanodes for relation \"%s.%s\"",
+					quote_identifier(get_namespace_name(RelationGetNamespace(rel))),
+					RelationGetRelationName(rel))));
+
+	initStringInfo(&buf);
+	appendStringInfo(&buf,
+					 "DO $redist$BEGIN PERFORM pg_catalog.pgxc_redist_pull_buckets(%s::pg_catalog.regclass, %s, %d, ",
+					 quote_literal_cstr(quote_qualified_identifier(
+							get_namespace_name(RelationGetNamespace(rel)),
+							RelationGetRelationName(rel))),
+					 quote_literal_cstr(GetRelationDistribColumn(locinfo)),
+					 locinfo->numBuckets);
+
+	/* Moved buckets and their new node */
+	appendStringInfoString(&buf, "'{");
+	first = true;
+	foreach(item, distribState->buckets)
+	{
+		appendStringInfo(&buf, first ? "%d" : ",%d", lfirst_int(item));
+		first = false;
+	}
+	appendStringInfoString(&buf, "}'::pg_catalog.int4[], ARRAY[");
+	first = true;
+	foreach(item, distribState->buckets)
+	{
+		int nodenum = list_nth_int(locinfo->nodeList,
+								   locinfo->bucketMap[lfirst_int(item)]);
+
+		if (!first)
+			appendStringInfoChar(&buf, ',');
+		appendStringInfoString(&buf, quote_literal_cstr(
+			get_pgxc_nodename(PGXCNodeGetNodeOid(nodenum, PGXC_NODE_DATANODE))));
+		first = false;
+	}
+
+	/* Node keeping NULL values */
+	appendStringInfo(&buf, "]::pg_catalog.text[], %s, ARRAY[",
+					 quote_literal_cstr(get_pgxc_nodename(PGXCNodeGetNodeOid(
+						linitial_int(locinfo->nodeList), PGXC_NODE_DATANODE))));
+
+	/* And where to find all these rows */
+	first = true;
+	foreach(item, distribState->sources)
+	{
+		if (!first)
+			appendStringInfoChar(&buf, ',');
+		appendStringInfoString(&buf, quote_literal_cstr(
+			get_pgxc_nodehost(PGXCNodeGetNodeOid(lfirst_int(item), PGXC_NODE_DATANODE))));
+		first = false;
+	}
+	appendStringInfoString(&buf, "]::pg_catalog.text[], '{");
+	first = true;
+	foreach(item, distribState->sources)
+	{
+		appendStringInfo(&buf, first ? "%d" : ",%d",
+			get_pgxc_nodeport(PGXCNodeGetNodeOid(lfirst_int(item), PGXC_NODE_DATANODE)));
+		first = false;
+	}
+	appendStringInfoString(&buf, "}'::pg_catalog.int4[]); END$redist$");
+
+	distrib_execute_query(buf.data, false, exec_nodes);
+
+	relation_close(rel, NoLock);
+
+	pfree(buf.data);
+}
+
+/*
+ * pull_bucket_row
+ * Insert a row fetched by pgxc_redist_pull_buckets
+ */
+static void
+pull_bucket_row(char **values, int natts, void *arg)
+{
+	PullBucketState *state = (PullBucketState *) arg;
+	int			col;
+
+	if (natts != state->natts)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATATYPE_MISMATCH),
+				 errmsg("rows fetched do not match the relation")));
+
+	for (col = 0; col < natts; col++)
+	{
+		state->values[col] = InputFunctionCall(&state->inputs[col], values[col],
+											   state->ioparams[col],
+											   state->typmods[col]);
+		state->nulls[col] = values[col] == NULL ? 'n' : ' ';
+	}
+
+	if (SPI_execute_plan(state->plan, state->values, state->nulls, false, 0) != SPI_OK_INSERT)
+		elog(ERROR, "SPI_execute_plan failed");
+	state->rows++;
+}
+
+/*
+ * pgxc_redist_pull_buckets
+ * Datanode side of DISTRIB_PULL_BUCKET: fetch from each source node the
+ * rows of the moved buckets given to this node, and of NULL values if
+ * this node keeps them, and insert them locally. Returns the number of
+ * rows inserted.
+ *
+ * Source nodes are read in separate sessions, see peerconn.c. The
+ * rows read are only deleted from them later in the transaction running
+ * this function, so a failure anywhere leaves all the data in place.
+ */
+Datum
+pgxc_redist_pull_buckets(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	char	   *colname = text_to_cstring(PG_GETARG_TEXT_PP(1));
+	int32		numBuckets = PG_GETARG_INT32(2);
+	ArrayType  *bucketArray = PG_GETARG_ARRAYTYPE_P(3);
+	ArrayType  *ownerArray = PG_GETARG_ARRAYTYPE_P(4);
+	char	   *nullOwner = text_to_cstring(PG_GETARG_TEXT_PP(5));
+	ArrayType  *hostArray = PG_GETARG_ARRAYTYPE_P(6);
+	ArrayType  *portArray = PG_GETARG_ARRAYTYPE_P(7);
+	Datum	   *buckets, *owners, *hosts, *ports;
+	int			numMoved, numOwners, numHosts, numPorts;
+	Relation	rel;
+	TupleDesc	tupdesc;
+	StringInfoData query;
+	StringInfoData insert;
+	const char *relname;
+	Oid		   *argtypes;
+	PullBucketState state;
+	int			i;
+	bool		pullNulls;
+	bool		any = false;
+
+	if (!IS_PGXC_DATANODE)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("pgxc_redist_pull_buckets can only run on a Datanode")));
+
+	deconstruct_array(bucketArray, INT4OID, sizeof(int32), true, 'i',
+					  &buckets, NULL, &numMoved);
+	deconstruct_array(ownerArray, TEXTOID, -1, false, 'i',
+					  &owners, NULL, &numOwners);
+	deconstruct_array(hostArray, TEXTOID, -1, false, 'i',
+					  &hosts, NULL, &numHosts);
+	deconstruct_array(portArray, INT4OID, sizeof(int32), true, 'i',
+					  &ports, NULL, &numPorts);
+	if (numMoved != numOwners || numHosts != numPorts)
+		ereport(ERROR,
+				(errcode(ERRCODE_ARRAY_SUBSCRIPT_ERROR),
+				 errmsg("mismatched array dimensions")));
+
+	/* A sufficient lock level is taken by the Coordinator */
+	rel = relation_open(relid, RowExclusiveLock);
+	tupdesc = RelationGetDescr(rel);
+	relname = quote_qualified_identifier(get_namespace_name(RelationGetNamespace(rel)),
+										 RelationGetRelationName(rel));
+
+	/* Rows to get from other nodes */
+	initStringInfo(&query);
+	appendStringInfo(&query, "SELECT * FROM ONLY %s WHERE pg_catalog.pgxc_bucket_of(%s, %d) = ANY ('{",
+					 relname, quote_identifier(colname), numBuckets);
+	for (i = 0; i < numMoved; i++)
+	{
+		char *owner = TextDatumGetCString(owners[i]);
+
+		if (strcmp(owner, PGXCNodeName) == 0)
+		{
+			appendStringInfo(&query, any ? ",%d" : "%d", DatumGetInt32(buckets[i]));
+			any = true;
+		}
+		pfree(owner);
+	}
+	appendStringInfoString(&query, "}'::pg_catalog.int4[])");
+	pullNulls = (strcmp(nullOwner, PGXCNodeName) == 0);
+	if (pullNulls)
+		appendStringInfo(&query, " OR %s IS NULL", quote_identifier(colname));
+
+	if (!any && !pullNulls)
+	{
+		relation_close(rel, RowExclusiveLock);
+		PG_RETURN_INT64(0);
+	}
+
+	/* Rows are inserted with their text output, as COPY would do */
+	argtypes = (Oid *) palloc(sizeof(Oid) * tupdesc->natts);
+	state.inputs = (FmgrInfo *) palloc(sizeof(FmgrInfo) * tupdesc->natts);
+	state.ioparams = (Oid *) palloc(sizeof(Oid) * tupdesc->natts);
+	state.typmods = (int32 *) palloc(sizeof(int32) * tupdesc->natts);
+	state.values = (Datum *) palloc(sizeof(Datum) * tupdesc->natts);
+	state.nulls = (char *) palloc(sizeof(char) * tupdesc->natts);
+	state.natts = 0;
+	state.rows = 0;
+
+	initStringInfo(&insert);
+	appendStringInfo(&insert, "INSERT INTO ONLY %s VALUES (", relname);
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute attr = tupdesc->attrs[i];
+		Oid			infunc;
+		int			n = state.natts;
+
+		if (attr->attisdropped)
+			continue;
+
+		getTypeInputInfo(attr->atttypid, &infunc, &state.ioparams[n]);
+		fmgr_info(infunc, &state.inputs[n]);
+		argtypes[n] = attr->atttypid;
+		state.typmods[n] = attr->atttypmod;
+		appendStringInfo(&insert, n == 0 ? "$%d" : ", $%d", n + 1);
+		state.natts++;
+	}
+	appendStringInfoChar(&insert, ')');
+
+	if (SPI_connect() != SPI_OK_CONNECT)
+		elog(ERROR, "SPI_connect failed");
+	state.plan = SPI_prepare(insert.data, state.natts, argtypes);
+	if (state.plan == NULL)
+		elog(ERROR, "SPI_prepare failed for \"%s\"", insert.data);
+
+	for (i = 0; i < numHosts; i++)
+	{
+		char *host = TextDatumGetCString(hosts[i]);
+
+		PeerConnFetch(host, DatumGetInt32(ports[i]), query.data,
+					  pull_bucket_row, &state);
+		pfree(host);
+	}
+
+	SPI_finish();
+
+	relation_close(rel, RowExclusiveLock);
+
+	pfree(query.data);
+	pfree(insert.data);
+
+	PG_RETURN_INT64(state.rows);
+}
+
+/*
+ * pgxc_redistribute_buckets
+ * Move at most "max_buckets" buckets of a bucket table towards a balanced
+ * map and return the number of buckets moved, 0 once the table is balanced.
+ *
+ * Each call only moves the rows of the buckets chosen and only blocks the
+ * writes to the table meanwhile, reads being still allowed. Calling it in
+ * a loop with small transactions lets a table be rebalanced online, after
+ * nodes have been added with online_bucket_redistribution. Every
+ * Coordinator computes the same map from the same catalogs, so the remote
+ * ones are just asked to do the same call, which only updates their
+ * catalogs.
+ */
+Datum
+pgxc_redistribute_buckets(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	int32		max_buckets = PG_GETARG_INT32(1);
+	Relation	rel;
+	RelationLocInfo *locinfo;
+	RelationLocInfo *newLocInfo;
+	RedistribState *distribState;
+	Oid		   *nodeoids;
+	int			numnodes;
+	int16	   *target;
+	int16	   *newmap;
+	int			bucket;
+	int			moved = 0;
+
+	if (max_buckets <= 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("number of buckets to move must be positive")));
+
+	/* Catalogs and data only live on Coordinators */
+	if (IS_PGXC_DATANODE)
+		PG_RETURN_INT32(0);
+
+	/* Block the writes, which could use the old map, but not the reads */
+	rel = relation_open(relid, ExclusiveLock);
+
+	if (!pg_class_ownercheck(relid, GetUserId()))
+		aclcheck_error(ACLCHECK_NOT_OWNER, ACL_KIND_CLASS,
+					   RelationGetRelationName(rel));
+
+	locinfo = RelationGetLocInfo(rel);
+	if (locinfo == NULL || locinfo->locatorType != LOCATOR_TYPE_BUCKET)
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("\"%s\" is not distributed by bucket",
+						RelationGetRelationName(rel))));
+
+	numnodes = get_pgxc_classnodes(relid, &nodeoids);
+	target = BuildBucketMap(locinfo->numBuckets, locinfo->bucketMap,
+							nodeoids, numnodes, nodeoids, numnodes, true);
+
+	/* Take the first buckets not yet on the node they should be on */
+	newmap = (int16 *) palloc(sizeof(int16) * locinfo->numBuckets);
+	memcpy(newmap, locinfo->bucketMap, sizeof(int16) * locinfo->numBuckets);
+	for (bucket = 0; bucket < locinfo->numBuckets && moved < max_buckets; bucket++)
+	{
+		if (newmap[bucket] != target[bucket])
+		{
+			newmap[bucket] = target[bucket];
+			moved++;
+		}
+	}
+
+	if (moved == 0)
+	{
+		relation_close(rel, NoLock);
+		PG_RETURN_INT32(0);
+	}
+
+	/* Remote Coordinators only need their catalogs updated */
+	if (IsConnFromCoord())
+	{
+		PgxcClassAlterBucketMap(relid, locinfo->numBuckets, newmap);
+		CacheInvalidateRelcache(rel);
+		relation_close(rel, NoLock);
+		CommandCounterIncrement();
+		PG_RETURN_INT32(moved);
+	}
+
+	/* Lock the table and do the same change on the other Coordinators */
+	if (!IsTempTable(relid))
+	{
+		RemoteQuery *step = makeNode(RemoteQuery);
+		StringInfoData buf;
+
+		initStringInfo(&buf);
+		appendStringInfo(&buf,
+						 "DO $redist$BEGIN PERFORM pg_catalog.pgxc_redistribute_buckets(%s::pg_catalog.regclass, %d); END$redist$",
+						 quote_literal_cstr(quote_qualified_identifier(
+								get_namespace_name(RelationGetNamespace(rel)),
+								RelationGetRelationName(rel))),
+						 max_buckets);
+
+		step->combine_type = COMBINE_TYPE_SAME;
+		step->exec_nodes = NULL;
+		step->sql_statement = buf.data;
+		step->force_autocommit = false;
+		step->exec_type = EXEC_ON_COORDS;
+		step->is_temp = false;
+		ExecRemoteUtility(step);
+		pfree(buf.data);
+		pfree(step);
+	}
+
+	/* Then move the data as ALTER TABLE does */
+	newLocInfo = CopyRelationLocInfo(locinfo);
+	memcpy(newLocInfo->bucketMap, newmap, sizeof(int16) * locinfo->numBuckets);
+
+	distribState = makeRedistribState(relid);
+	PGXCRedistribCreateCommandList(distribState, newLocInfo);
+	PGXCRedistribTable(distribState, CATALOG_UPDATE_BEFORE);
+
+	PgxcClassAlterBucketMap(relid, locinfo->numBuckets, newmap);
+	CacheInvalidateRelcache(rel);
+	CommandCounterIncrement();
+	RelationCacheInvalidateEntry(relid);
+
+	PGXCRedistribTable(distribState, CATALOG_UPDATE_AFTER);
+	FreeRedistribState(distribState);
+	FreeRelationLocInfo(newLocInfo);
+
+	relation_close(rel, NoLock);
+
+	PG_RETURN_INT32(moved);
+}
+#endif
+
+
 /*
  * makeRedistribState
  * Build a distribution state operator
@@ -848,6 +1691,10 @@ makeRedistribState(Oid relOid)
 	res->relid = relOid;
 	res->commands = NIL;
 	res->store = NULL;
+#ifdef ADB
+	res->buckets = NIL;
+	res->sources = NIL;
+#endif
 	return res;
 }
 
@@ -871,6 +1718,10 @@ FreeRedistribState(RedistribState *state)
 		list_free(state->commands);
 	if (state->store)
 		tuplestore_clear(state->store);
+#ifdef ADB
+	list_free(state->buckets);
+	list_free(state->sources);
+#endif
 }
 
 /*
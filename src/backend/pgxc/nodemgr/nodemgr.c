@@ -29,6 +29,10 @@
 #include "pgxc/pgxc.h"
 #include "access/htup_details.h"
 #include "pg_config.h"
+#ifdef ADB
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#endif
 
 /*
  * How many times should we try to find a unique indetifier
@@ -58,6 +62,29 @@ static int	   *shmemNumDataNodes;
 NodeDefinition *coDefs;
 NodeDefinition *dnDefs;
 
+#ifdef ADB
+/*
+ * Number of Coordinator sessions holding a connection to each Datanode,
+ * used to route the reads of replicated tables.  Slots are found by node
+ * Oid, so they survive the reload of the node tables.
+ */
+typedef struct DatanodeLoadSlot
+{
+	Oid			nodeoid;
+	int			nsessions;
+} DatanodeLoadSlot;
+
+typedef struct DatanodeLoadData
+{
+	slock_t		mutex;
+	DatanodeLoadSlot slots[1];	/* VARIABLE LENGTH ARRAY, MaxDataNodes */
+} DatanodeLoadData;
+
+static DatanodeLoadData *dnLoad = NULL;
+
+static Size DatanodeLoadShmemSize(void);
+#endif
+
 /*
  * NodeTablesInit
  *	Initializes shared memory tables of Coordinators and Datanodes.
@@ -98,6 +125,15 @@ NodeTablesShmemInit(void)
 	/* Mark it empty upon creation */
 	if (!found)
 		*shmemNumDataNodes = 0;
+
+#ifdef ADB
+	dnLoad = ShmemInitStruct("Datanode Load", DatanodeLoadShmemSize(), &found);
+	if (!found)
+	{
+		MemSet(dnLoad, 0, DatanodeLoadShmemSize());
+		SpinLockInit(&dnLoad->mutex);
+	}
+#endif
 }
 
 
@@ -116,9 +152,88 @@ NodeTablesShmemSize(void)
 	dn_size = mul_size(sizeof(NodeDefinition), MaxDataNodes);
 	dn_size = add_size(dn_size, sizeof(int));
 
+#ifdef ADB
+	dn_size = add_size(dn_size, DatanodeLoadShmemSize());
+#endif
+
 	return add_size(co_size, dn_size);
 }
 
+#ifdef ADB
+static Size
+DatanodeLoadShmemSize(void)
+{
+	return add_size(offsetof(DatanodeLoadData, slots),
+					mul_size(sizeof(DatanodeLoadSlot), MaxDataNodes));
+}
+
+/*
+ * PgxcNodeAddLoad
+ *	Count "delta" more sessions connected to the Datanode "nodeoid".
+ *	Slots of nodes nobody is connected to are given to new nodes.
+ */
+void
+PgxcNodeAddLoad(Oid nodeoid, int delta)
+{
+	volatile DatanodeLoadData *load = dnLoad;
+	int			free_slot = -1;
+	int			i;
+
+	if (load == NULL || !OidIsValid(nodeoid))
+		return;
+
+	SpinLockAcquire(&load->mutex);
+	for (i = 0; i < MaxDataNodes; i++)
+	{
+		if (load->slots[i].nodeoid == nodeoid)
+			break;
+		if (free_slot < 0 && load->slots[i].nsessions == 0)
+			free_slot = i;
+	}
+	if (i == MaxDataNodes && delta > 0)
+	{
+		i = free_slot;
+		if (i >= 0)
+			load->slots[i].nodeoid = nodeoid;
+	}
+	if (i >= 0 && i < MaxDataNodes)
+	{
+		load->slots[i].nsessions += delta;
+		if (load->slots[i].nsessions < 0)
+			load->slots[i].nsessions = 0;
+	}
+	SpinLockRelease(&load->mutex);
+}
+
+/*
+ * PgxcNodeGetLoad
+ *	Number of sessions connected to the Datanode "nodeoid".
+ */
+int
+PgxcNodeGetLoad(Oid nodeoid)
+{
+	volatile DatanodeLoadData *load = dnLoad;
+	int			nsessions = 0;
+	int			i;
+
+	if (load == NULL || !OidIsValid(nodeoid))
+		return 0;
+
+	SpinLockAcquire(&load->mutex);
+	for (i = 0; i < MaxDataNodes; i++)
+	{
+		if (load->slots[i].nodeoid == nodeoid)
+		{
+			nsessions = load->slots[i].nsessions;
+			break;
+		}
+	}
+	SpinLockRelease(&load->mutex);
+
+	return nsessions;
+}
+#endif
+
 /*
  * Check list of options and return things filled.
  * This includes check on option values.
@@ -126,7 +241,8 @@ NodeTablesShmemSize(void)
 static void
 check_node_options(const char *node_name, List *options, char **node_host,
 			int *node_port, char *node_type,
-			bool *is_primary, bool *is_preferred)
+			bool *is_primary, bool *is_preferred,
+			char **slave_host, int *slave_port)
 {
 	ListCell   *option;
 
@@ -178,6 +294,19 @@ check_node_options(const char *node_name, List *options, char **node_host,
 		{
 			*is_preferred = defGetBoolean(defel);
 		}
+		else if (strcmp(defel->defname, "slave_host") == 0)
+		{
+			*slave_host = defGetString(defel);
+		}
+		else if (strcmp(defel->defname, "slave_port") == 0)
+		{
+			*slave_port = defGetTypeLength(defel);
+
+			if (*slave_port < 1 || *slave_port > 65535)
+				ereport(ERROR,
+						(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+						 errmsg("slave port value is out of range")));
+		}
 		else
 		{
 			ereport(ERROR,
@@ -206,6 +335,23 @@ check_node_options(const char *node_name, List *options, char **node_host,
 				(errcode(ERRCODE_SYNTAX_ERROR),
 				 errmsg("PGXC node %s: Node type not specified",
 						node_name)));
+
+	/* Only a Datanode can have a slave, an empty host removes it */
+	if (*slave_host != NULL && (*slave_host)[0] != '\0')
+	{
+		if (*node_type != PGXC_NODE_DATANODE)
+			ereport(ERROR,
+					(errcode(ERRCODE_SYNTAX_ERROR),
+					 errmsg("PGXC node %s: cannot have a slave, it has to be a Datanode",
+							node_name)));
+		if (*slave_port == 0)
+			*slave_port = *node_port;
+	}
+	else
+	{
+		*slave_host = "";
+		*slave_port = 0;
+	}
 }
 
 /*
@@ -345,6 +491,8 @@ PgxcNodeListAndCount(void)
 		node->nodeport = nodeForm->node_port;
 		node->nodeisprimary = nodeForm->nodeis_primary;
 		node->nodeispreferred = nodeForm->nodeis_preferred;
+		memcpy(&node->nodeslavehost, &nodeForm->node_slave_host, NAMEDATALEN);
+		node->nodeslaveport = nodeForm->node_slave_port;
 	}
 	heap_endscan(scan);
 	heap_close(rel, AccessShareLock);
@@ -491,6 +639,8 @@ PgxcNodeCreate(CreateNodeStmt *stmt)
 	int			node_port = 0;
 	bool		is_primary = false;
 	bool		is_preferred = false;
+	char	   *slave_host = NULL;
+	int			slave_port = 0;
 	Datum		node_id;
 	Oid			nodeOid;
 
@@ -517,7 +667,8 @@ PgxcNodeCreate(CreateNodeStmt *stmt)
 	/* Filter options */
 	check_node_options(node_name, stmt->options, &node_host,
 				&node_port, &node_type,
-				&is_primary, &is_preferred);
+				&is_primary, &is_preferred,
+				&slave_host, &slave_port);
 
 	/* Compute node identifier */
 	node_id = generate_node_id(node_name);
@@ -551,6 +702,10 @@ PgxcNodeCreate(CreateNodeStmt *stmt)
 			 node_name, node_host);
 	}
 
+	/* A slave listens on the port of the node by default */
+	if (slave_host[0] != '\0' && slave_port == 0)
+		slave_port = node_port;
+
 	/* Iterate through all attributes initializing nulls and values */
 	for (i = 0; i < Natts_pgxc_node; i++)
 	{
@@ -574,6 +729,8 @@ PgxcNodeCreate(CreateNodeStmt *stmt)
 	values[Anum_pgxc_node_is_primary - 1] = BoolGetDatum(is_primary);
 	values[Anum_pgxc_node_is_preferred - 1] = BoolGetDatum(is_preferred);
 	values[Anum_pgxc_node_id - 1] = node_id;
+	values[Anum_pgxc_node_slave_host - 1] = DirectFunctionCall1(namein, CStringGetDatum(slave_host));
+	values[Anum_pgxc_node_slave_port - 1] = Int32GetDatum(slave_port);
 
 	htup = heap_form_tuple(pgxcnodesrel->rd_att, values, nulls);
 
@@ -603,6 +760,8 @@ PgxcNodeAlter(AlterNodeStmt *stmt)
 	bool		is_preferred;
 	bool		is_primary;
 	bool		was_primary;
+	char	   *slave_host;
+	int			slave_port;
 	bool		primary_off = false;
 	Oid			new_primary = InvalidOid;
 	HeapTuple	oldtup, newtup;
@@ -645,11 +804,14 @@ PgxcNodeAlter(AlterNodeStmt *stmt)
 	node_type = get_pgxc_nodetype(nodeOid);
 	node_type_old = node_type;
 	node_id = get_pgxc_node_id(nodeOid);
+	slave_host = pstrdup(NameStr(((Form_pgxc_node) GETSTRUCT(oldtup))->node_slave_host));
+	slave_port = ((Form_pgxc_node) GETSTRUCT(oldtup))->node_slave_port;
 
 	/* Filter options */
 	check_node_options(node_name, stmt->options, &node_host,
 				&node_port, &node_type,
-				&is_primary, &is_preferred);
+				&is_primary, &is_preferred,
+				&slave_host, &slave_port);
 
 	/*
 	 * Two nodes cannot be primary at the same time. If the primary
@@ -706,6 +868,11 @@ PgxcNodeAlter(AlterNodeStmt *stmt)
 	new_record_repl[Anum_pgxc_node_is_preferred - 1] = true;
 	new_record[Anum_pgxc_node_id - 1] = UInt32GetDatum(node_id);
 	new_record_repl[Anum_pgxc_node_id - 1] = true;
+	new_record[Anum_pgxc_node_slave_host - 1] =
+		DirectFunctionCall1(namein, CStringGetDatum(slave_host));
+	new_record_repl[Anum_pgxc_node_slave_host - 1] = true;
+	new_record[Anum_pgxc_node_slave_port - 1] = Int32GetDatum(slave_port);
+	new_record_repl[Anum_pgxc_node_slave_port - 1] = true;
 
 	/* Update relation */
 	newtup = heap_modify_tuple(oldtup, RelationGetDescr(rel),
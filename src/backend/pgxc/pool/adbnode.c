@@ -206,7 +206,7 @@ ADBNodeAllConn *adb_get_connections(List *datanodelist, List *coordlist, int pri
 		List *list_new;
 		AdbNodeConnInfo *node;
 
-		fds = PoolManagerGetConnections(dn_allocate, co_allocate);
+		fds = PoolManagerGetConnections(dn_allocate, co_allocate, NIL);
 		Assert(fds);
 
 		list_new = NIL;
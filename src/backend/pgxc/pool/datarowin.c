@@ -0,0 +1,544 @@
+/*-------------------------------------------------------------------------
+ *
+ * datarowin.c
+ *
+ *	  Input of the values of DataRow messages received from remote nodes.
+ *
+ * Every value of a row sent by a Datanode is text, turned into a Datum by
+ * the input function of its type.  Looking up the input functions of a
+ * tuple descriptor costs a few catalog cache lookups per column, which
+ * short queries returning many columns used to pay for every result slot.
+ * So the lookups are kept in a small backend cache, keyed by the types and
+ * typmods of the columns, and the common types are parsed here directly,
+ * without going through fmgr.  The input function is still called for
+ * anything these parsers do not recognize, errors included, so the result
+ * is always the same.
+ *
+ * A slot keeps the entry it got in tts_attinmeta.  Entries dropped from
+ * the cache while the transaction may still use them are only freed at its
+ * end, which advances a generation number telling slots to look their entry
+ * up again.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/pgxc/pool/datarowin.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+
+#include "access/hash.h"
+#include "catalog/pg_type.h"
+#include "pgxc/datarowin.h"
+#include "utils/builtins.h"
+#include "utils/datetime.h"
+#include "utils/inval.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/syscache.h"
+#include "utils/timestamp.h"
+
+/* Parsers of DataRowInMetadata.fastpath */
+#define DATAROW_INPUT_FMGR		0
+#define DATAROW_INPUT_INT2		1
+#define DATAROW_INPUT_INT4		2
+#define DATAROW_INPUT_INT8		3
+#define DATAROW_INPUT_FLOAT8	4
+#define DATAROW_INPUT_BOOL		5
+#define DATAROW_INPUT_TEXT		6
+#define DATAROW_INPUT_TIMESTAMP 7
+
+/* Number of entries of the cache, direct mapped */
+#define DATAROW_CACHE_SIZE		256
+
+static DataRowInMetadata *DataRowCache[DATAROW_CACHE_SIZE];
+static List *DataRowGarbage = NIL;	/* dropped entries, in CacheMemoryContext */
+static uint32 DataRowGeneration = 0;
+static bool DataRowCallbackRegistered = false;
+
+static uint32 datarow_hash(TupleDesc tupdesc);
+static bool datarow_matches(DataRowInMetadata *meta, TupleDesc tupdesc);
+static bool datarow_cacheable(TupleDesc tupdesc);
+static DataRowInMetadata *datarow_build(TupleDesc tupdesc, bool cached);
+static void datarow_drop(int index);
+static void datarow_invalidate(Datum arg, int cacheid, uint32 hashvalue);
+static bool datarow_parse_int(const char *s, int len, int64 min, int64 max,
+				  int64 *result);
+static bool datarow_parse_float8(const char *s, int len, float8 *result);
+static bool datarow_parse_timestamp(const char *s, int len,
+						Timestamp *result);
+
+/*
+ * GetDataRowInMetadata
+ *
+ * Input information for the values of DataRows for "tupdesc".  *generation
+ * is set for DataRowInMetadataIsValid().  A tuple descriptor with columns
+ * which cannot be cached gets a new one in the current memory context.
+ */
+DataRowInMetadata *
+GetDataRowInMetadata(TupleDesc tupdesc, uint32 *generation)
+{
+	int			index;
+	DataRowInMetadata *meta;
+
+	if (!DataRowCallbackRegistered)
+	{
+		CacheRegisterSyscacheCallback(TYPEOID, datarow_invalidate, (Datum) 0);
+		CacheRegisterSyscacheCallback(PROCOID, datarow_invalidate, (Datum) 0);
+		DataRowCallbackRegistered = true;
+	}
+
+	*generation = DataRowGeneration;
+
+	index = datarow_hash(tupdesc) % DATAROW_CACHE_SIZE;
+	meta = DataRowCache[index];
+	if (meta && datarow_matches(meta, tupdesc))
+		return meta;
+
+	if (!datarow_cacheable(tupdesc))
+		return datarow_build(tupdesc, false);
+
+	meta = datarow_build(tupdesc, true);
+	datarow_drop(index);
+	DataRowCache[index] = meta;
+
+	return meta;
+}
+
+/*
+ * DataRowInMetadataIsValid
+ *
+ * May a slot still use what GetDataRowInMetadata() gave it along with
+ * "generation"?  The entry itself is not looked at, it may be gone.
+ */
+bool
+DataRowInMetadataIsValid(DataRowInMetadata *meta, uint32 generation)
+{
+	return meta != NULL && generation == DataRowGeneration;
+}
+
+/*
+ * DataRowInputFast
+ *
+ * Parse the value of attribute "attnum" (from 0), of "len" bytes and not
+ * necessarily terminated, without the input function when its type has a
+ * parser here.  Returns false if the input function has to be called.
+ */
+bool
+DataRowInputFast(DataRowInMetadata *meta, int attnum, const char *value,
+				 int len, Datum *result)
+{
+	int64		ival;
+
+	switch (meta->fastpath[attnum])
+	{
+		case DATAROW_INPUT_INT2:
+			if (!datarow_parse_int(value, len, SHRT_MIN, SHRT_MAX, &ival))
+				return false;
+			*result = Int16GetDatum((int16) ival);
+			return true;
+
+		case DATAROW_INPUT_INT4:
+			if (!datarow_parse_int(value, len, INT_MIN, INT_MAX, &ival))
+				return false;
+			*result = Int32GetDatum((int32) ival);
+			return true;
+
+		case DATAROW_INPUT_INT8:
+			if (!datarow_parse_int(value, len,
+								   -INT64CONST(0x7FFFFFFFFFFFFFFF) - 1,
+								   INT64CONST(0x7FFFFFFFFFFFFFFF), &ival))
+				return false;
+			*result = Int64GetDatum(ival);
+			return true;
+
+		case DATAROW_INPUT_FLOAT8:
+			{
+				float8		fval;
+
+				if (!datarow_parse_float8(value, len, &fval))
+					return false;
+				*result = Float8GetDatum(fval);
+				return true;
+			}
+
+		case DATAROW_INPUT_BOOL:
+			/* what boolout() sends */
+			if (len != 1 || (value[0] != 't' && value[0] != 'f'))
+				return false;
+			*result = BoolGetDatum(value[0] == 't');
+			return true;
+
+		case DATAROW_INPUT_TEXT:
+			*result = PointerGetDatum(cstring_to_text_with_len(value, len));
+			return true;
+
+		case DATAROW_INPUT_TIMESTAMP:
+			{
+				Timestamp	tval;
+
+				if (!datarow_parse_timestamp(value, len, &tval))
+					return false;
+				*result = TimestampGetDatum(tval);
+				return true;
+			}
+
+		default:
+			return false;
+	}
+}
+
+/*
+ * AtEOXact_DataRowIn
+ *
+ * Free the entries dropped from the cache during the transaction, the slots
+ * that may have used them are gone.
+ */
+void
+AtEOXact_DataRowIn(void)
+{
+	ListCell   *lc;
+
+	if (DataRowGarbage == NIL)
+		return;
+
+	foreach(lc, DataRowGarbage)
+		MemoryContextDelete(((DataRowInMetadata *) lfirst(lc))->context);
+	list_free(DataRowGarbage);
+	DataRowGarbage = NIL;
+	DataRowGeneration++;
+}
+
+static uint32
+datarow_hash(TupleDesc tupdesc)
+{
+	uint32		h = (uint32) tupdesc->natts;
+	int			i;
+
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		h = (h << 5) - h + (uint32) tupdesc->attrs[i]->atttypid;
+		h = (h << 5) - h + (uint32) tupdesc->attrs[i]->atttypmod;
+	}
+
+	return hash_uint32(h);
+}
+
+static bool
+datarow_matches(DataRowInMetadata *meta, TupleDesc tupdesc)
+{
+	int			i;
+
+	if (meta->natts != tupdesc->natts)
+		return false;
+
+	for (i = 0; i < meta->natts; i++)
+	{
+		if (meta->atttypids[i] != tupdesc->attrs[i]->atttypid ||
+			meta->attinmeta.atttypmods[i] != tupdesc->attrs[i]->atttypmod)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Input functions can keep state in fn_extra for as long as their FmgrInfo
+ * lives, domain_in keeps the constraints of the domain for instance, so
+ * only base and enum types go to the cache.
+ */
+static bool
+datarow_cacheable(TupleDesc tupdesc)
+{
+	int			i;
+
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute attr = tupdesc->attrs[i];
+		char		typtype;
+
+		if (attr->attisdropped)
+			return false;
+
+		typtype = get_typtype(attr->atttypid);
+		if (typtype != TYPTYPE_BASE && typtype != TYPTYPE_ENUM)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Build the input information for "tupdesc", in a context of its own if it
+ * goes to the cache, else in the current memory context.
+ */
+static DataRowInMetadata *
+datarow_build(TupleDesc tupdesc, bool cached)
+{
+	MemoryContext context = CurrentMemoryContext;
+	MemoryContext oldcontext;
+	DataRowInMetadata *meta;
+	int			natts = tupdesc->natts;
+	int			i;
+
+	if (cached)
+		context = AllocSetContextCreate(CacheMemoryContext,
+										"DataRow input",
+										ALLOCSET_SMALL_MINSIZE,
+										ALLOCSET_SMALL_INITSIZE,
+										ALLOCSET_SMALL_MAXSIZE);
+	oldcontext = MemoryContextSwitchTo(context);
+
+	meta = (DataRowInMetadata *) palloc0(sizeof(DataRowInMetadata));
+	meta->attinmeta.tupdesc = tupdesc;
+	meta->attinmeta.attinfuncs = (FmgrInfo *) palloc0(natts * sizeof(FmgrInfo));
+	meta->attinmeta.attioparams = (Oid *) palloc0(natts * sizeof(Oid));
+	meta->attinmeta.atttypmods = (int32 *) palloc0(natts * sizeof(int32));
+	meta->cached = cached;
+	meta->natts = natts;
+	meta->atttypids = (Oid *) palloc0(natts * sizeof(Oid));
+	meta->fastpath = (char *) palloc0(natts * sizeof(char));
+	meta->context = cached ? context : NULL;
+
+	for (i = 0; i < natts; i++)
+	{
+		Form_pg_attribute attr = tupdesc->attrs[i];
+		Oid			typinput;
+
+		meta->atttypids[i] = attr->atttypid;
+		meta->attinmeta.atttypmods[i] = attr->atttypmod;
+		if (attr->attisdropped)
+			continue;
+
+		getTypeInputInfo(attr->atttypid, &typinput,
+						 &meta->attinmeta.attioparams[i]);
+		fmgr_info_cxt(typinput, &meta->attinmeta.attinfuncs[i], context);
+
+		switch (attr->atttypid)
+		{
+			case INT2OID:
+				meta->fastpath[i] = DATAROW_INPUT_INT2;
+				break;
+			case INT4OID:
+				meta->fastpath[i] = DATAROW_INPUT_INT4;
+				break;
+			case INT8OID:
+				meta->fastpath[i] = DATAROW_INPUT_INT8;
+				break;
+			case FLOAT8OID:
+				meta->fastpath[i] = DATAROW_INPUT_FLOAT8;
+				break;
+			case BOOLOID:
+				meta->fastpath[i] = DATAROW_INPUT_BOOL;
+				break;
+			case TEXTOID:
+				meta->fastpath[i] = DATAROW_INPUT_TEXT;
+				break;
+			case VARCHAROID:
+				/* the length does not need to be checked */
+				if (attr->atttypmod < 0)
+					meta->fastpath[i] = DATAROW_INPUT_TEXT;
+				break;
+			case TIMESTAMPOID:
+				/* no rounding to the precision */
+				if (attr->atttypmod < 0)
+					meta->fastpath[i] = DATAROW_INPUT_TIMESTAMP;
+				break;
+			default:
+				break;
+		}
+	}
+
+	/* the tuple descriptor may go away before a cached entry */
+	if (cached)
+		meta->attinmeta.tupdesc = NULL;
+
+	MemoryContextSwitchTo(oldcontext);
+
+	return meta;
+}
+
+/* Take entry "index" out of the cache, it is freed at end of transaction */
+static void
+datarow_drop(int index)
+{
+	MemoryContext oldcontext;
+
+	if (DataRowCache[index] == NULL)
+		return;
+
+	oldcontext = MemoryContextSwitchTo(CacheMemoryContext);
+	DataRowGarbage = lappend(DataRowGarbage, DataRowCache[index]);
+	MemoryContextSwitchTo(oldcontext);
+	DataRowCache[index] = NULL;
+}
+
+/* A type or function changed, drop everything */
+static void
+datarow_invalidate(Datum arg, int cacheid, uint32 hashvalue)
+{
+	int			i;
+
+	for (i = 0; i < DATAROW_CACHE_SIZE; i++)
+		datarow_drop(i);
+}
+
+/*
+ * Parse an integer as sent by int2out, int4out or int8out: an optional
+ * minus sign and digits.  Digits are accumulated as a negative number so
+ * that the minimum value fits.
+ */
+static bool
+datarow_parse_int(const char *s, int len, int64 min, int64 max, int64 *result)
+{
+	const char *end = s + len;
+	bool		neg = false;
+	int64		val = 0;
+
+	if (s < end && *s == '-')
+	{
+		neg = true;
+		s++;
+	}
+	if (s == end || end - s > 19)
+		return false;
+
+	for (; s < end; s++)
+	{
+		int			digit;
+
+		if (*s < '0' || *s > '9')
+			return false;
+		digit = *s - '0';
+		if (val < (-INT64CONST(0x7FFFFFFFFFFFFFFF) - 1 + digit) / 10)
+			return false;
+		val = val * 10 - digit;
+	}
+
+	if (!neg)
+	{
+		if (val < -max)
+			return false;
+		val = -val;
+	}
+	else if (val < min)
+		return false;
+
+	*result = val;
+	return true;
+}
+
+/*
+ * Parse a finite float8 in plain notation.  NaN, infinities and values out
+ * of range are left to float8in.
+ */
+static bool
+datarow_parse_float8(const char *s, int len, float8 *result)
+{
+	char		buf[64];
+	char	   *endptr;
+	int			i;
+
+	if (len == 0 || len >= (int) sizeof(buf))
+		return false;
+
+	for (i = 0; i < len; i++)
+	{
+		char		c = s[i];
+
+		if (!((c >= '0' && c <= '9') || c == '.' || c == '-' || c == '+' ||
+			  c == 'e' || c == 'E'))
+			return false;
+	}
+
+	/* the value is not terminated, and strtod could read past it */
+	memcpy(buf, s, len);
+	buf[len] = '\0';
+
+	errno = 0;
+	*result = strtod(buf, &endptr);
+	if (endptr != buf + len || errno != 0 || isinf(*result))
+		return false;
+
+	return true;
+}
+
+/* Parse "n" digits at "s" */
+static inline bool
+datarow_parse_digits(const char *s, int n, int *result)
+{
+	int			val = 0;
+	int			i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (s[i] < '0' || s[i] > '9')
+			return false;
+		val = val * 10 + (s[i] - '0');
+	}
+
+	*result = val;
+	return true;
+}
+
+/*
+ * Parse a timestamp in the ISO style of timestamp_out,
+ * "YYYY-MM-DD HH:MM:SS[.FFFFFF]", which DateStyle always reads the same.
+ * Other styles, BC dates, infinities and the like are left to timestamp_in.
+ */
+static bool
+datarow_parse_timestamp(const char *s, int len, Timestamp *result)
+{
+	struct pg_tm tm;
+	fsec_t		fsec = 0;
+
+	if (len < 19 || len > 26 ||
+		s[4] != '-' || s[7] != '-' || s[10] != ' ' ||
+		s[13] != ':' || s[16] != ':')
+		return false;
+
+	memset(&tm, 0, sizeof(tm));
+	if (!datarow_parse_digits(s, 4, &tm.tm_year) ||
+		!datarow_parse_digits(s + 5, 2, &tm.tm_mon) ||
+		!datarow_parse_digits(s + 8, 2, &tm.tm_mday) ||
+		!datarow_parse_digits(s + 11, 2, &tm.tm_hour) ||
+		!datarow_parse_digits(s + 14, 2, &tm.tm_min) ||
+		!datarow_parse_digits(s + 17, 2, &tm.tm_sec))
+		return false;
+
+	if (len > 19)
+	{
+		int			ndigits = len - 20;
+		int			frac;
+
+		if (s[19] != '.' || ndigits == 0 ||
+			!datarow_parse_digits(s + 20, ndigits, &frac))
+			return false;
+#ifdef HAVE_INT64_TIMESTAMP
+		for (; ndigits < 6; ndigits++)
+			frac *= 10;
+		fsec = frac;
+#else
+		fsec = frac / pow(10.0, ndigits);
+#endif
+	}
+
+	if (tm.tm_year < 1 ||
+		tm.tm_mon < 1 || tm.tm_mon > MONTHS_PER_YEAR ||
+		tm.tm_mday < 1 ||
+		tm.tm_mday > day_tab[isleap(tm.tm_year)][tm.tm_mon - 1] ||
+		tm.tm_hour >= HOURS_PER_DAY ||
+		tm.tm_min >= MINS_PER_HOUR ||
+		tm.tm_sec >= SECS_PER_MINUTE)
+		return false;
+
+	if (tm2timestamp(&tm, fsec, NULL, result) != 0)
+		return false;
+
+	return true;
+}
@@ -31,6 +31,7 @@
 #include "executor/executor.h"
 #include "libpq/libpq.h"
 #include "miscadmin.h"
+#include "pg_trace.h"
 #include "pgxc/execRemote.h"
 #include "nodes/nodes.h"
 #include "nodes/nodeFuncs.h"
@@ -38,6 +39,7 @@
 #include "pgxc/copyops.h"
 #include "pgxc/nodemgr.h"
 #include "pgxc/poolmgr.h"
+#include "storage/buffile.h"
 #include "storage/ipc.h"
 #include "utils/datum.h"
 #include "utils/lsyscache.h"
@@ -56,6 +58,8 @@
 #include "agtm/agtm.h"
 #include "agtm/agtm_client.h"
 #include "parser/parse_coerce.h"
+#include "catalog/namespace.h"
+#include "optimizer/clauses.h"
 #endif
 
 /* Enforce the use of two-phase commit when temporary objects are used */
@@ -67,11 +71,80 @@ bool EnforceTwoPhaseCommit = true;
  */
 bool RequirePKeyForRepTab = true;
 
+#ifdef ADB
+/*
+ * Rows of a non-FQS INSERT sent to Datanodes before waiting for the answers,
+ * 1 sends every row alone.
+ */
+int RemoteInsertBatchSize = 100;
+
+/*
+ * Rows asked to each Datanode at a time by a cursor of the Coordinator, so
+ * its memory does not grow with the size of the result. 0 asks for all of
+ * them at once.
+ */
+int RemoteFetchSize = 0;
+
+/*
+ * kB of rows of replicated tables kept by the Coordinator for the same query
+ * run again under the same snapshot, see ReplCacheLookup. 0 keeps none.
+ */
+int ReplicatedTableCacheSize = 0;
+
+/*
+ * Rows of a query reading replicated tables only, as seen by a snapshot.
+ * The xids of the snapshot are sorted. Each entry is in a context of its
+ * own, a child of ReplCacheContext once complete.
+ */
+typedef struct ReplCacheEntry
+{
+	MemoryContext context;
+	char	   *query;				/* statement sent to the Datanode */
+	Oid			userid;
+	char	   *search_path;
+	TransactionId xmin;
+	TransactionId xmax;
+	CommandId	curcid;
+	uint32		xcnt;
+	TransactionId *xip;
+	int32		subxcnt;
+	TransactionId *subxip;
+	TupleDesc	tupdesc;
+	List	   *tuples;				/* HeapTuple of each row */
+	Size		size;				/* bytes used by the rows */
+} ReplCacheEntry;
+
+static MemoryContext ReplCacheContext = NULL;
+static List *ReplCacheEntries = NIL;	/* most recently used first */
+static Size ReplCacheUsed = 0;
+
+/*
+ * Commit in one phase, without any PREPARE nor remote xact log, the
+ * transactions which wrote on a single remote node and not locally.
+ */
+bool EnableOnePhaseCommit = true;
+
+/* flush pipelined rows to the Datanode when its output buffer gets this big */
+#define BATCH_SIZE_TO_FLUSH		(64 * 1024)
+
+/*
+ * Statement run by the current Execute message whose pipelined rows may be
+ * left to the Datanodes until the client's Sync, set by exec_execute_message.
+ */
+PlannedStmt *RemoteDMLBatchStmt = NULL;
+
+/*
+ * Combiner of the rows left pipelined by the Execute messages already run.
+ * It stays in TopMemoryContext, as the connections point to it.
+ */
+static RemoteQueryState *DeferredDMLBatch = NULL;
+#endif
+
 /*
  * Max to begin flushing data to datanodes, max to stop flushing data to datanodes.
  */
-#define MAX_SIZE_TO_FORCE_FLUSH (2^10 * 64 * 2)
-#define MAX_SIZE_TO_STOP_FLUSH (2^10 * 64)
+#define MAX_SIZE_TO_FORCE_FLUSH (1024 * 64 * 2)
+#define MAX_SIZE_TO_STOP_FLUSH (1024 * 64)
 
 #define END_QUERY_TIMEOUT	20
 #define ROLLBACK_RESP_LEN	9
@@ -135,11 +208,12 @@ typedef struct
 #endif
 
 /*
- * Buffer size does not affect performance significantly, just do not allow
- * connection buffer grows infinitely
+ * Rows are sent to a node once that much is buffered for it, so that each
+ * send() carries many rows. A node which does not drain its data only blocks
+ * COPY once its own buffer reached MAX_SIZE_TO_FORCE_FLUSH.
  */
-#define COPY_BUFFER_SIZE 8192
-#define PRIMARY_NODE_WRITEAHEAD 1024 * 1024
+#define COPY_BUFFER_SIZE (64 * 1024)
+#define PRIMARY_NODE_WRITEAHEAD (1024 * 1024)
 #define PGXC_NODE_DATA_ERROR() do\
 	{									\
 		set_ps_display(PG_FUNCNAME_MACRO, true);	\
@@ -208,8 +282,36 @@ static int pgxc_get_connections(PGXCNodeHandle *connections[], int size, List *c
 
 static bool pgxc_start_command_on_connection(PGXCNodeHandle *connection,
 					RemoteQueryState *remotestate);
+#ifdef ADB
+static bool ExecRemoteDMLBatchCheck(ResultRelInfo *resultRelInfo, RemoteQueryState *node);
+static void ExecRemoteDMLBatchRow(RemoteQueryState *node);
+static void ExecRemoteDMLBatchSync(RemoteQueryState *node);
+static RemoteQueryState *GetDeferredDMLBatch(void);
+static void AtEOXact_RemoteDMLBatch(void);
+#endif
 static TupleTableSlot * RemoteQueryNext(ScanState *node);
 static bool RemoteQueryRecheck(RemoteQueryState *node, TupleTableSlot *slot);
+static void FetchTupleReceive(RemoteQueryState *combiner);
+static void do_query_send(RemoteQueryState *node);
+static void do_query_receive(RemoteQueryState *node);
+#ifdef ADB
+static RemoteNodeInstr *GetRemoteNodeInstr(RemoteQueryState *combiner, Oid nodeoid);
+static bool RemoteQueryReceive(RemoteQueryState *combiner, int conn_count,
+				   PGXCNodeHandle **connections);
+static bool ReplCacheUsable(RemoteQueryState *node);
+static bool ReplCacheXidsMatch(TransactionId *sorted, TransactionId *xids, int count);
+static bool ReplCacheMatches(ReplCacheEntry *entry, RemoteQuery *step, Snapshot snapshot);
+static void ReplCacheEvict(ReplCacheEntry *entry);
+static bool ReplCacheLookup(RemoteQueryState *node);
+static void ReplCacheCollect(RemoteQueryState *node, TupleTableSlot *slot);
+static void ReplCacheStore(RemoteQueryState *node);
+static void ReplCacheAbandon(RemoteQueryState *node);
+#endif
+
+static void RowBufferInit(RemoteRowBuffer *buf);
+static void RowBufferAppend(RemoteRowBuffer *buf, RemoteDataRow row);
+static bool RowBufferPop(RemoteRowBuffer *buf, RemoteDataRow row);
+static void RowBufferFree(RemoteRowBuffer *buf);
 
 static char *generate_begin_command(void);
 static void pgxc_node_remote_prepare(const char *gid);
@@ -269,7 +371,7 @@ CreateResponseCombiner(int node_count, CombineType combine_type)
 	combiner->currentRow.msg = NULL;
 	combiner->currentRow.msglen = 0;
 	combiner->currentRow.msgnode = 0;
-	combiner->rowBuffer = NIL;
+	RowBufferInit(&combiner->rowBuffer);
 	combiner->tapenodes = NULL;
 	combiner->remoteCopyType = REMOTE_COPY_NONE;
 	combiner->copy_file = NULL;
@@ -413,6 +515,19 @@ HandleCommandComplete(RemoteQueryState *combiner, char *msg_body, size_t len, PG
 			NameStr(conn->name), msg_body)));
 #endif
 
+#ifdef ADB
+	if (combiner->node_instr)
+	{
+		RemoteNodeInstr *instr = GetRemoteNodeInstr(combiner, conn->nodeoid);
+
+		if (instr)
+		{
+			INSTR_TIME_SET_CURRENT(instr->total);
+			INSTR_TIME_SUBTRACT(instr->total, combiner->node_instr_start);
+		}
+	}
+#endif
+
 	/* Is this a DML query that is not FQSed ? */
 	non_fqs_dml = (combiner->ss.ps.plan &&
 					((RemoteQuery*)combiner->ss.ps.plan)->rq_params_internal);
@@ -732,14 +847,35 @@ HandleDataRow(RemoteQueryState *combiner, char *msg_body, size_t len, Oid nodeoi
 	if (combiner->errorMessage.len > 0)
 		return;
 
+	TRACE_POSTGRESQL_COMBINER_DATA_ROW(nodeoid, (int) len);
+
 	/*
 	 * We are copying message because it points into connection buffer, and
-	 * will be overwritten on next socket read
+	 * will be overwritten on next socket read. Allocate it where the scan
+	 * slot lives, so CopyDataRowTupleToSlot can hand it over without
+	 * copying it again.
 	 */
-	combiner->currentRow.msg = (char *) palloc(len);
+	if (combiner->ss.ss_ScanTupleSlot)
+		combiner->currentRow.msg = (char *)
+			MemoryContextAlloc(combiner->ss.ss_ScanTupleSlot->tts_mcxt, len);
+	else
+		combiner->currentRow.msg = (char *) palloc(len);
 	memcpy(combiner->currentRow.msg, msg_body, len);
 	combiner->currentRow.msglen = len;
 	combiner->currentRow.msgnode = nodeoid;
+
+#ifdef ADB
+	if (combiner->node_instr)
+	{
+		RemoteNodeInstr *instr = GetRemoteNodeInstr(combiner, nodeoid);
+
+		if (instr && instr->rows++ == 0)
+		{
+			INSTR_TIME_SET_CURRENT(instr->startup);
+			INSTR_TIME_SUBTRACT(instr->startup, combiner->node_instr_start);
+		}
+	}
+#endif
 }
 
 /*
@@ -1026,6 +1162,142 @@ ValidateAndCloseCombiner(RemoteQueryState *combiner)
 	return valid;
 }
 
+/*
+ * Prepare an empty row buffer, rows are kept in memory up to work_mem.
+ *
+ * Rows are buffered while another portal is running, so remember the current
+ * resource owner and create the temporary file under it, the same way as
+ * tuplestore does.
+ */
+static void
+RowBufferInit(RemoteRowBuffer *buf)
+{
+	MemSet(buf, 0, sizeof(*buf));
+	buf->availMem = work_mem * 1024L;
+	buf->resowner = CurrentResourceOwner;
+}
+
+/*
+ * Append a data row to the tail of the buffer. The buffer takes ownership of
+ * row->msg; it is freed right away if the row is written to the file.
+ */
+static void
+RowBufferAppend(RemoteRowBuffer *buf, RemoteDataRow row)
+{
+	long		need = row->msglen + sizeof(RemoteDataRowData);
+
+	/* once spilled keep appending to the file until it is drained */
+	if (buf->file_count == 0 && (buf->availMem >= need || buf->count == 0))
+	{
+		if (buf->count == buf->size)
+		{
+			int			newsize = buf->size > 0 ? buf->size * 2 : 64;
+			RemoteDataRowData *rows;
+			int			i;
+
+			rows = (RemoteDataRowData *) palloc(newsize * sizeof(RemoteDataRowData));
+			for (i = 0; i < buf->count; i++)
+				rows[i] = buf->rows[(buf->head + i) % buf->size];
+			if (buf->rows)
+				pfree(buf->rows);
+			buf->rows = rows;
+			buf->size = newsize;
+			buf->head = 0;
+		}
+		buf->rows[(buf->head + buf->count) % buf->size] = *row;
+		buf->count++;
+		buf->availMem -= need;
+		return;
+	}
+
+	if (buf->file == NULL)
+	{
+		ResourceOwner oldowner = CurrentResourceOwner;
+
+		CurrentResourceOwner = buf->resowner;
+		buf->file = BufFileCreateTemp(false);
+		CurrentResourceOwner = oldowner;
+	}
+
+	if (BufFileSeek(buf->file, buf->write_fileno, buf->write_offset, SEEK_SET) != 0)
+		elog(ERROR, "could not seek in row buffer temporary file");
+	if (BufFileWrite(buf->file, &row->msglen, sizeof(row->msglen)) != sizeof(row->msglen) ||
+		BufFileWrite(buf->file, &row->msgnode, sizeof(row->msgnode)) != sizeof(row->msgnode) ||
+		BufFileWrite(buf->file, row->msg, row->msglen) != row->msglen)
+		elog(ERROR, "could not write to row buffer temporary file");
+	BufFileTell(buf->file, &buf->write_fileno, &buf->write_offset);
+	buf->file_count++;
+
+	pfree(row->msg);
+}
+
+/*
+ * Remove the row at the head of the buffer and return it in "row". Message of
+ * a row read back from the file is palloc'd in CurrentMemoryContext.
+ * Returns false if the buffer is empty.
+ */
+static bool
+RowBufferPop(RemoteRowBuffer *buf, RemoteDataRow row)
+{
+	if (buf->count > 0)
+	{
+		*row = buf->rows[buf->head];
+		buf->head = (buf->head + 1) % buf->size;
+		buf->count--;
+		buf->availMem += row->msglen + sizeof(RemoteDataRowData);
+		return true;
+	}
+
+	if (buf->file_count == 0)
+		return false;
+
+	if (BufFileSeek(buf->file, buf->read_fileno, buf->read_offset, SEEK_SET) != 0)
+		elog(ERROR, "could not seek in row buffer temporary file");
+	if (BufFileRead(buf->file, &row->msglen, sizeof(row->msglen)) != sizeof(row->msglen) ||
+		BufFileRead(buf->file, &row->msgnode, sizeof(row->msgnode)) != sizeof(row->msgnode))
+		elog(ERROR, "could not read from row buffer temporary file");
+	row->msg = (char *) palloc(row->msglen);
+	if (BufFileRead(buf->file, row->msg, row->msglen) != row->msglen)
+		elog(ERROR, "could not read from row buffer temporary file");
+
+	if (--buf->file_count == 0)
+	{
+		/* drained, reuse the file from its start */
+		buf->read_fileno = buf->write_fileno = 0;
+		buf->read_offset = buf->write_offset = 0;
+	} else
+	{
+		BufFileTell(buf->file, &buf->read_fileno, &buf->read_offset);
+	}
+
+	return true;
+}
+
+/*
+ * Release all rows still in the buffer and its temporary file.
+ */
+static void
+RowBufferFree(RemoteRowBuffer *buf)
+{
+	while (buf->count > 0)
+	{
+		pfree(buf->rows[buf->head].msg);
+		buf->head = (buf->head + 1) % buf->size;
+		buf->count--;
+	}
+	if (buf->rows)
+		pfree(buf->rows);
+	if (buf->file)
+		BufFileClose(buf->file);
+	buf->rows = NULL;
+	buf->size = buf->head = 0;
+	buf->file = NULL;
+	buf->file_count = 0;
+	buf->read_fileno = buf->write_fileno = 0;
+	buf->read_offset = buf->write_offset = 0;
+	buf->availMem = work_mem * 1024L;
+}
+
 /*
  * It is possible if multiple steps share the same Datanode connection, when
  * executor is running multi-step query or client is running multiple queries
@@ -1051,6 +1323,28 @@ BufferConnection(PGXCNodeHandle *conn)
 	if (combiner == NULL || conn->state != DN_CONNECTION_STATE_QUERY)
 		return;
 
+#ifdef ADB
+	/* pipelined INSERT rows, the node answers only after Sync */
+	if (conn->sync_pending && pgxc_node_send_sync(conn) != 0)
+	{
+		conn->state = DN_CONNECTION_STATE_ERROR_FATAL;
+		add_error_message(conn, "Failed to send command to Datanode %s", NameStr(conn->name));
+	}
+#endif
+
+	/*
+	 * The query was started by an Append which did not wait for its first
+	 * answers, see ExecRemoteQueryAsyncRequest. Let the combiner read them
+	 * as do_query would have, so its tuple slot and store are set up before
+	 * the rows are buffered.
+	 */
+	if (combiner->query_pending)
+	{
+		oldcontext = MemoryContextSwitchTo(combiner->ss.ps.state->es_query_cxt);
+		do_query_receive(combiner);
+		MemoryContextSwitchTo(oldcontext);
+	}
+
 	/*
 	 * When BufferConnection is invoked CurrentContext is related to other
 	 * portal, which is trying to control the connection.
@@ -1080,12 +1374,10 @@ BufferConnection(PGXCNodeHandle *conn)
 		/* Move to buffer currentRow (received from the Datanode) */
 		if (combiner->currentRow.msg)
 		{
-			RemoteDataRow dataRow = (RemoteDataRow) palloc(sizeof(RemoteDataRowData));
-			*dataRow = combiner->currentRow;
+			RowBufferAppend(&combiner->rowBuffer, &combiner->currentRow);
 			combiner->currentRow.msg = NULL;
 			combiner->currentRow.msglen = 0;
 			combiner->currentRow.msgnode = 0;
-			combiner->rowBuffer = lappend(combiner->rowBuffer, dataRow);
 		}
 
 		res = handle_response(conn, combiner);
@@ -1136,17 +1428,89 @@ CopyDataRowTupleToSlot(RemoteQueryState *combiner, TupleTableSlot *slot)
 	MemoryContext	oldcontext;
 
 	oldcontext = MemoryContextSwitchTo(slot->tts_mcxt);
-	msg = (char *)palloc(combiner->currentRow.msglen);
-	memcpy(msg, combiner->currentRow.msg, combiner->currentRow.msglen);
+	if (MemoryContextContains(slot->tts_mcxt, combiner->currentRow.msg))
+	{
+		/* already in the right place, usually the case, see HandleDataRow */
+		msg = combiner->currentRow.msg;
+	} else
+	{
+		msg = (char *)palloc(combiner->currentRow.msglen);
+		memcpy(msg, combiner->currentRow.msg, combiner->currentRow.msglen);
+		pfree(combiner->currentRow.msg);
+	}
 	ExecStoreDataRowTuple(msg, combiner->currentRow.msglen,
 							combiner->currentRow.msgnode, slot, true);
-	pfree(combiner->currentRow.msg);
 	combiner->currentRow.msg = NULL;
 	combiner->currentRow.msglen = 0;
 	combiner->currentRow.msgnode = 0;
 	MemoryContextSwitchTo(oldcontext);
 }
 
+/*
+ * The current connection of the combiner has no complete message. Wait for
+ * input on all the connections the combiner is reading from and make current
+ * the first one with a complete message, so a slow Datanode does not hold up
+ * rows already sent by the others.
+ */
+static void
+FetchTupleReceive(RemoteQueryState *combiner)
+{
+	PGXCNodeHandle *conn = combiner->connections[combiner->current_conn];
+	PGXCNodeHandle **waitconns;
+	int			nwait = 0;
+	int			i;
+
+	if (combiner->conn_count > 1)
+	{
+		waitconns = (PGXCNodeHandle **)
+			palloc(combiner->conn_count * sizeof(PGXCNodeHandle *));
+		for (i = 0; i < combiner->conn_count; i++)
+		{
+			PGXCNodeHandle *other = combiner->connections[i];
+
+			/* connections used by other combiners are buffered on demand */
+			if (other == conn ||
+				(other->state == DN_CONNECTION_STATE_QUERY &&
+				 other->combiner == combiner))
+				waitconns[nwait++] = other;
+		}
+	}
+	else
+		waitconns = &conn;
+
+	if (nwait <= 1)
+	{
+		if (RemoteQueryReceive(combiner, 1, &conn))
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("Failed to fetch from Datanode")));
+	}
+	else
+	{
+		if (RemoteQueryReceive(combiner, nwait, waitconns))
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("Failed to fetch from Datanode")));
+
+		if (!HAS_MESSAGE_BUFFERED(conn))
+		{
+			for (i = 0; i < combiner->conn_count; i++)
+			{
+				PGXCNodeHandle *other = combiner->connections[i];
+
+				if (other->combiner == combiner && HAS_MESSAGE_BUFFERED(other))
+				{
+					combiner->current_conn = i;
+					break;
+				}
+			}
+		}
+	}
+
+	if (waitconns != &conn)
+		pfree(waitconns);
+}
+
 /*
  * Get next data row from the combiner's buffer into provided slot
  * Just clear slot and return false if buffer is empty, that means end of result
@@ -1176,13 +1540,16 @@ FetchTuple(RemoteQueryState *combiner, TupleTableSlot *slot)
 	 * ExecStoreDataRowTuple below? If one fixes this memory issue, please
 	 * consider using CopyDataRowTupleToSlot() for the same.
 	 */
-	if (list_length(combiner->rowBuffer) > 0)
+	if (!RemoteRowBufferIsEmpty(&combiner->rowBuffer))
 	{
-		RemoteDataRow dataRow = (RemoteDataRow) linitial(combiner->rowBuffer);
-		combiner->rowBuffer = list_delete_first(combiner->rowBuffer);
-		ExecStoreDataRowTuple(dataRow->msg, dataRow->msglen, dataRow->msgnode,
+		RemoteDataRowData dataRow;
+		MemoryContext	oldcontext;
+
+		oldcontext = MemoryContextSwitchTo(slot->tts_mcxt);
+		RowBufferPop(&combiner->rowBuffer, &dataRow);
+		MemoryContextSwitchTo(oldcontext);
+		ExecStoreDataRowTuple(dataRow.msg, dataRow.msglen, dataRow.msgnode,
 								slot, true);
-		pfree(dataRow);
 		return true;
 	}
 
@@ -1212,7 +1579,12 @@ FetchTuple(RemoteQueryState *combiner, TupleTableSlot *slot)
 				return true;
 			else
 			{
+#ifdef ADB
+				if (pgxc_node_send_execute(conn, combiner->cursor,
+										   combiner->fetch_size > 0 ? combiner->fetch_size : 1) != 0)
+#else
 				if (pgxc_node_send_execute(conn, combiner->cursor, 1) != 0)
+#endif
 					ereport(ERROR,
 							(errcode(ERRCODE_INTERNAL_ERROR),
 							 errmsg("Failed to fetch from Datanode")));
@@ -1220,7 +1592,11 @@ FetchTuple(RemoteQueryState *combiner, TupleTableSlot *slot)
 					ereport(ERROR,
 							(errcode(ERRCODE_INTERNAL_ERROR),
 							 errmsg("Failed to fetch from Datanode")));
+#ifdef ADB
+				if (RemoteQueryReceive(combiner, 1, &conn))
+#else
 				if (pgxc_node_receive(1, &conn, NULL))
+#endif
 					ereport(ERROR,
 							(errcode(ERRCODE_INTERNAL_ERROR),
 							 errmsg("Failed to fetch from Datanode")));
@@ -1233,10 +1609,7 @@ FetchTuple(RemoteQueryState *combiner, TupleTableSlot *slot)
 		if (res == RESPONSE_EOF)
 		{
 			/* incomplete message, read more */
-			if (pgxc_node_receive(1, &conn, NULL))
-				ereport(ERROR,
-						(errcode(ERRCODE_INTERNAL_ERROR),
-						 errmsg("Failed to fetch from Datanode")));
+			FetchTupleReceive(combiner);
 			continue;
 		}
 		else if (res == RESPONSE_SUSPENDED)
@@ -1278,6 +1651,64 @@ FetchTuple(RemoteQueryState *combiner, TupleTableSlot *slot)
 }
 
 #ifdef ADB
+/*
+ * Return the EXPLAIN ANALYZE statistics of node "nodeoid" for the combiner,
+ * adding them on its first message, or NULL if there is no room left.
+ */
+static RemoteNodeInstr *
+GetRemoteNodeInstr(RemoteQueryState *combiner, Oid nodeoid)
+{
+	RemoteNodeInstr *instr;
+	int			i;
+
+	Assert(combiner->node_instr);
+	for (i = 0; i < combiner->node_instr_count; i++)
+	{
+		if (combiner->node_instr[i].nodeoid == nodeoid)
+			return &combiner->node_instr[i];
+	}
+
+	if (combiner->node_instr_count >= combiner->node_instr_size)
+		return NULL;
+
+	instr = &combiner->node_instr[combiner->node_instr_count++];
+	instr->nodeoid = nodeoid;
+	return instr;
+}
+
+/*
+ * pgxc_node_receive for a combiner, adding the time it waited to the nodes
+ * of the connections if the combiner is instrumented.
+ */
+static bool
+RemoteQueryReceive(RemoteQueryState *combiner, int conn_count,
+				   PGXCNodeHandle **connections)
+{
+	instr_time	start;
+	instr_time	waited;
+	bool		res;
+	int			i;
+
+	if (combiner->node_instr == NULL)
+		return pgxc_node_receive(conn_count, connections, NULL);
+
+	INSTR_TIME_SET_CURRENT(start);
+	res = pgxc_node_receive(conn_count, connections, NULL);
+	INSTR_TIME_SET_CURRENT(waited);
+	INSTR_TIME_SUBTRACT(waited, start);
+
+	for (i = 0; i < conn_count; i++)
+	{
+		RemoteNodeInstr *instr;
+
+		instr = GetRemoteNodeInstr(combiner, connections[i]->nodeoid);
+		if (instr)
+			INSTR_TIME_ADD(instr->wait, waited);
+	}
+
+	return res;
+}
+
 static const char *
 RequestTypeAsString(RequestType type)
 {
@@ -1458,7 +1889,9 @@ handle_response(PGXCNodeHandle * conn, RemoteQueryState *combiner)
 	char	   *msg;
 	int			msg_len;
 	char		msg_type;
+#ifndef ADB
 	bool		suspended = false;
+#endif
 
 	for (;;)
 	{
@@ -1485,6 +1918,16 @@ handle_response(PGXCNodeHandle * conn, RemoteQueryState *combiner)
 
 		/* TODO handle other possible responses */
 		msg_type = get_message(conn, &msg_len, &msg);
+#ifdef ADB
+		if (combiner && combiner->node_instr && msg_type != '\0')
+		{
+			RemoteNodeInstr *instr = GetRemoteNodeInstr(combiner, conn->nodeoid);
+
+			/* with the type and length words */
+			if (instr)
+				instr->bytes += msg_len + 5;
+		}
+#endif
 #ifdef DEBUG_ADB
 		adb_ereport(LOG,
 			(errmsg("[process] %d [handle] %s [sock] %d [state] %s "
@@ -1520,7 +1963,12 @@ handle_response(PGXCNodeHandle * conn, RemoteQueryState *combiner)
 				HandleDataRow(combiner, msg, msg_len, conn->nodeoid);
 				return RESPONSE_DATAROW;
 			case 's':			/* PortalSuspended */
+#ifdef ADB
+				/* ReadyForQuery may come with a later read */
+				conn->portal_suspended = true;
+#else
 				suspended = true;
+#endif
 				break;
 			case '1': /* ParseComplete */
 			case '2': /* BindComplete */
@@ -1571,7 +2019,12 @@ handle_response(PGXCNodeHandle * conn, RemoteQueryState *combiner)
 				 * another EXECUTE to fetch more rows, otherwise it is done
 				 * with the connection
 				 */
+#ifdef ADB
+				int result = conn->portal_suspended ? RESPONSE_SUSPENDED : RESPONSE_COMPLETE;
+				conn->portal_suspended = false;
+#else
 				int result = suspended ? RESPONSE_SUSPENDED : RESPONSE_COMPLETE;
+#endif
 				conn->transaction_status = msg[0];
 				conn->state = DN_CONNECTION_STATE_IDLE;
 				conn->combiner = NULL;
@@ -1749,8 +2202,16 @@ pgxc_node_begin(int conn_count,
 		if (connections[i]->state == DN_CONNECTION_STATE_QUERY)
 			BufferConnection(connections[i]);
 
-		/* Send GXID and check for errors */
+		/*
+		 * Send GXID and check for errors, a hot standby slave could not
+		 * take it
+		 */
+#ifdef ADB
+		if (GlobalTransactionIdIsValid(gxid) && !connections[i]->slave_read &&
+			pgxc_node_send_gxid(connections[i], gxid))
+#else
 		if (GlobalTransactionIdIsValid(gxid) && pgxc_node_send_gxid(connections[i], gxid))
+#endif
 			return EOF;
 
 		/* Send timestamp and check for errors */
@@ -2634,6 +3095,7 @@ DataNodeCopyIn(char *data_row, int len, ExecNodes *exec_nodes, PGXCNodeHandle**
 						 errmsg("out of memory")));
 			}
 
+			PGXCNodeCountMessageSent(primary_handle);
 			primary_handle->outBuffer[primary_handle->outEnd++] = 'd';
 			memcpy(primary_handle->outBuffer + primary_handle->outEnd, &nLen, 4);
 			primary_handle->outEnd += 4;
@@ -2723,6 +3185,7 @@ DataNodeCopyIn(char *data_row, int len, ExecNodes *exec_nodes, PGXCNodeHandle**
 						 errmsg("out of memory")));
 			}
 
+			PGXCNodeCountMessageSent(handle);
 			handle->outBuffer[handle->outEnd++] = 'd';
 			memcpy(handle->outBuffer + handle->outEnd, &nLen, 4);
 			handle->outEnd += 4;
@@ -2752,6 +3215,8 @@ DataNodeCopyOut(ExecNodes *exec_nodes,
 	int 		conn_count = list_length(exec_nodes->nodeList) == 0 ? NumDataNodes : list_length(exec_nodes->nodeList);
 	ListCell	*nodeitem;
 	uint64		processed;
+	PGXCNodeHandle **handles;
+	int			active_count;
 
 	combiner = CreateResponseCombiner(conn_count, COMBINE_TYPE_SUM);
 	combiner->processed = 0;
@@ -2769,37 +3234,49 @@ DataNodeCopyOut(ExecNodes *exec_nodes,
 		combiner->tuple_desc = tupleDesc;
 	}
 
+	handles = (PGXCNodeHandle **) palloc(conn_count * sizeof(PGXCNodeHandle *));
+	active_count = 0;
 	foreach(nodeitem, exec_nodes->nodeList)
 	{
 		PGXCNodeHandle *handle = copy_connections[lfirst_int(nodeitem)];
-		int read_status = 0;
 
 		Assert(handle && handle->state == DN_CONNECTION_STATE_COPY_OUT);
+		handles[active_count++] = handle;
+	}
 
-		/*
-		 * H message has been consumed, continue to manage data row messages.
-		 * Continue to read as long as there is data.
-		 */
-		while (read_status >= 0 && handle->state == DN_CONNECTION_STATE_COPY_OUT)
+	/*
+	 * H messages have been consumed, continue to manage data row messages.
+	 * Take the rows of whichever node sent some instead of reading the nodes
+	 * one after the other, so that they all scan and send at the same time.
+	 * The rows of a node keep their order.
+	 */
+	while (active_count > 0)
+	{
+		int			i;
+
+		if (pgxc_node_receive(active_count, handles, NULL))
+			ereport(ERROR,
+					(errcode(ERRCODE_CONNECTION_FAILURE),
+					 errmsg("unexpected EOF on datanode connection")));
+
+		for (i = 0; i < active_count;)
 		{
-			if (handle_response(handle,combiner) == RESPONSE_EOF)
+			PGXCNodeHandle *handle = handles[i];
+
+			if (handle->state == DN_CONNECTION_STATE_COPY_OUT &&
+				handle_response(handle, combiner) == RESPONSE_EOF &&
+				handle->state == DN_CONNECTION_STATE_COPY_OUT)
 			{
-				/* read some extra-data */
-				read_status = pgxc_node_read_data(handle, true);
-				if (read_status < 0)
-					ereport(ERROR,
-							(errcode(ERRCODE_CONNECTION_FAILURE),
-							 errmsg("unexpected EOF on datanode connection")));
-				else
-					/*
-					 * Set proper connection status - handle_response
-					 * has changed it to DN_CONNECTION_STATE_QUERY
-					 */
-					handle->state = DN_CONNECTION_STATE_COPY_OUT;
+				/* Wait for more data */
+				i++;
+				continue;
 			}
-			/* There is no more data that can be read from connection */
+
+			/* Node done, or failed */
+			handles[i] = handles[--active_count];
 		}
 	}
+	pfree(handles);
 
 	processed = combiner->processed;
 
@@ -2910,6 +3387,7 @@ DataNodeCopyEnd(PGXCNodeHandle *handle, bool is_error)
 	if (ensure_out_buffer_capacity(handle->outEnd + 1 + 4, handle) != 0)
 		return true;
 
+	PGXCNodeCountMessageSent(handle);
 	if (is_error)
 		handle->outBuffer[handle->outEnd++] = 'f';
 	else
@@ -2960,6 +3438,21 @@ ExecInitRemoteQuery(RemoteQuery *node, EState *estate, int eflags)
 	/* Extract the eflags bits that are relevant for tuplestorestate */
 	remotestate->eflags = (eflags & (EXEC_FLAG_REWIND | EXEC_FLAG_BACKWARD));
 
+#ifdef ADB
+	/* do_query decides if the rows are fetched by remote_fetch_size */
+	remotestate->forward_only = (remotestate->eflags == 0);
+	remotestate->keep_rows = true;
+	remotestate->fetch_size = 0;
+
+	/* one entry per node at most, see GetRemoteNodeInstr */
+	if (estate->es_instrument)
+	{
+		remotestate->node_instr_size = NumDataNodes + NumCoords;
+		remotestate->node_instr = (RemoteNodeInstr *)
+			palloc0(remotestate->node_instr_size * sizeof(RemoteNodeInstr));
+	}
+#endif
+
 	/* We anyways have to support REWIND for ReScan */
 	remotestate->eflags |= EXEC_FLAG_REWIND;
 
@@ -3026,7 +3519,59 @@ reget_exec_nodes_by_en_expr(RemoteQueryState *planstate,
 	 */
 	Assert(!(exec_nodes->accesstype == RELATION_ACCESS_READ_FOR_UPDATE &&
 			IsRelationReplicated(rel_loc_info)));
-	
+
+	/* A rowid, the query goes to the node of its row */
+	if (exec_nodes->en_expr_rowid)
+	{
+		Assert(list_length(exec_nodes->en_expr) == 1);
+		estate = ExecInitExpr((Expr *) linitial(exec_nodes->en_expr),
+							  (PlanState *) planstate);
+		partvalue = ExecEvalExpr(estate,
+								 planstate->ss.ps.ps_ExprContext,
+								 &isnull,
+								 NULL);
+		if (!isnull)
+			result = GetRelationNodesByRowId(rel_loc_info, partvalue,
+											 exec_nodes->accesstype);
+		if (result == NULL)
+		{
+			result = makeNode(ExecNodes);
+			result->baselocatortype = rel_loc_info->locatorType;
+			result->accesstype = exec_nodes->accesstype;
+			result->nodeList = list_copy(exec_nodes->nodeList);
+		}
+		FreeRelationLocInfo(rel_loc_info);
+		return result;
+	}
+
+	/*
+	 * An array of values of the distribution column, the query goes to the
+	 * nodes of all of them. Without any value, it goes to every node as if
+	 * the planner could not reduce them.
+	 */
+	if (exec_nodes->en_expr_array)
+	{
+		Assert(list_length(exec_nodes->en_expr) == 1);
+		estate = ExecInitExpr((Expr *) linitial(exec_nodes->en_expr),
+							  (PlanState *) planstate);
+		partvalue = ExecEvalExpr(estate,
+								 planstate->ss.ps.ps_ExprContext,
+								 &isnull,
+								 NULL);
+		if (!isnull)
+			result = GetRelationNodesByArray(rel_loc_info, partvalue,
+											 exec_nodes->accesstype);
+		if (result == NULL)
+		{
+			result = makeNode(ExecNodes);
+			result->baselocatortype = rel_loc_info->locatorType;
+			result->accesstype = exec_nodes->accesstype;
+			result->nodeList = list_copy(exec_nodes->nodeList);
+		}
+		FreeRelationLocInfo(rel_loc_info);
+		return result;
+	}
+
 	nelems = list_length(exec_nodes->en_expr);
 	en_expr_values = (Datum *)palloc0(sizeof(Datum) * nelems);
 	en_expr_nulls = (bool *)palloc0(sizeof(bool) * nelems);
@@ -3332,12 +3877,28 @@ pgxc_start_command_on_connection(PGXCNodeHandle *connection,
 	if (snapshot && pgxc_node_send_snapshot(connection, snapshot))
 		return false;
 
+#ifdef ADB
+	/* tag the statistics of the query on the node with the statement's */
+	if (remotestate->ss.ps.state && remotestate->ss.ps.state->es_plannedstmt &&
+		pgxc_node_send_query_id(connection,
+								remotestate->ss.ps.state->es_plannedstmt->queryId))
+		return false;
+
+	if (step->statement || remotestate->fetch_size > 0 || remotestate->rqs_num_params)
+#else
 	if (step->statement || step->cursor || remotestate->rqs_num_params)
+#endif
 	{
 		/* need to use Extended Query Protocol */
 		int	fetch = 0;
 		bool	prepared = false;
 		bool	send_desc = false;
+#ifdef ADB
+		char   *portal = step->cursor;
+
+		if (portal == NULL && remotestate->fetch_size > 0)
+			portal = remotestate->cursor;
+#endif
 
 		if (step->base_tlist != NULL ||
 		    step->exec_nodes->accesstype == RELATION_ACCESS_READ ||
@@ -3353,13 +3914,21 @@ pgxc_start_command_on_connection(PGXCNodeHandle *connection,
 		 * execute and fetch rows only if they will be consumed
 		 * immediately by the sorter
 		 */
+#ifdef ADB
+		fetch = remotestate->fetch_size;
+#else
 		if (step->cursor)
 			fetch = 1;
+#endif
 
 		if (pgxc_node_send_query_extended(connection,
 							prepared ? NULL : step->sql_statement,
 							step->statement,
+#ifdef ADB
+							portal,
+#else
 							step->cursor,
+#endif
 							remotestate->rqs_num_params,
 							remotestate->rqs_param_types,
 							remotestate->paramval_len,
@@ -3405,10 +3974,15 @@ IsReturningDMLOnReplicatedTable(RemoteQuery *rq)
 	return false;
 }
 
-void
-do_query(RemoteQueryState *node)
-{
-	RemoteQuery			*step = (RemoteQuery *) node->ss.ps.plan;
+/*
+ * do_query_send
+ * Send the command of the step to its nodes.  The primary node is answered
+ * here, the answers of the others are read by do_query_receive.
+ */
+static void
+do_query_send(RemoteQueryState *node)
+{
+	RemoteQuery			*step = (RemoteQuery *) node->ss.ps.plan;
 	TupleTableSlot		*scanslot = node->ss.ss_ScanTupleSlot;
 	bool				 force_autocommit = step->force_autocommit;
 	bool				 is_read_only = step->read_only;
@@ -3520,6 +4094,31 @@ do_query(RemoteQueryState *node)
 		need_tran_block = true;
 
 #ifdef ADB
+	/*
+	 * The rows of a forward only cursor are asked to the Datanodes by
+	 * remote_fetch_size at a time, from a portal of the same name, and are
+	 * not kept here. Each Datanode only sends more rows when this node needs
+	 * them, so the memory used does not grow with the size of the result.
+	 * The portal must survive the Syncs, hence the transaction block.
+	 */
+	if (step->cursor)
+		node->fetch_size = 1;
+	else if (RemoteFetchSize > 0 &&
+			 node->forward_only &&
+			 node->cursor != NULL && node->cursor[0] != '\0' &&
+			 IsTransactionBlock() &&
+			 step->exec_type == EXEC_ON_DATANODES &&
+			 step->exec_nodes != NULL &&
+			 step->exec_nodes->accesstype == RELATION_ACCESS_READ &&
+			 !step->has_row_marks &&
+			 primaryconnection == NULL &&
+			 regular_conn_count > 0)
+	{
+		node->fetch_size = RemoteFetchSize;
+		node->keep_rows = false;
+		need_tran_block = true;
+	}
+
 	/*
 	 * start transaction on AGTM by coordinator,
 	 * neither datanode nor other coordinator.
@@ -3619,14 +4218,18 @@ do_query(RemoteQueryState *node)
 		pgxc_node_report_error(node);
 	}
 
+	/*
+	 * Begin on all nodes at once, so BEGIN goes out to every node before
+	 * waiting for any of the answers.
+	 */
+	if (pgxc_node_begin(regular_conn_count, connections, need_tran_block,
+				is_read_only, PGXC_NODE_DATANODE))
+		ereport(ERROR,
+				(errcode(ERRCODE_INTERNAL_ERROR),
+				 errmsg("Could not begin transaction on Datanodes.")));
+
 	for (i = 0; i < regular_conn_count; i++)
 	{
-		if (pgxc_node_begin(1, &connections[i], need_tran_block,
-					is_read_only, PGXC_NODE_DATANODE))
-			ereport(ERROR,
-					(errcode(ERRCODE_INTERNAL_ERROR),
-					 errmsg("Could not begin transaction on Datanodes.")));
-
 		if (!pgxc_start_command_on_connection(connections[i], node))
 		{
 #ifndef ADB
@@ -3641,13 +4244,71 @@ do_query(RemoteQueryState *node)
 		connections[i]->combiner = node;
 	}
 
+#ifdef ADB
+	if (node->fetch_size > 0)
+#else
 	if (step->cursor)
+#endif
 	{
 		node->cursor_count = regular_conn_count;
 		node->cursor_connections = (PGXCNodeHandle **) palloc(regular_conn_count * sizeof(PGXCNodeHandle *));
 		memcpy(node->cursor_connections, connections, regular_conn_count * sizeof(PGXCNodeHandle *));
 	}
 
+	node->query_pending = true;
+	node->pending_connections = connections;
+	node->pending_count = regular_conn_count;
+#ifdef ADB
+	} PG_CATCH();
+	{
+		clear_some_handles(num_dnhandles, dnhandles, num_cohandles, cohandles);
+		if (dnhandles)
+			pfree(dnhandles);
+		if (cohandles)
+			pfree(cohandles);
+		PG_RE_THROW();
+	} PG_END_TRY();
+	if (dnhandles)
+		pfree(dnhandles);
+	if (cohandles)
+		pfree(cohandles);
+#endif
+}
+
+/*
+ * do_query_receive
+ * Wait the commands sent by do_query_send until they are all completed or
+ * one of the nodes sent a data row, and set up the state for FetchTuple.
+ */
+static void
+do_query_receive(RemoteQueryState *node)
+{
+	TupleTableSlot		*scanslot = node->ss.ss_ScanTupleSlot;
+	PGXCNodeHandle		**connections = node->pending_connections;
+	int					 regular_conn_count = node->pending_count;
+#ifdef ADB
+	PGXCNodeHandle		**dnhandles = NULL;
+	int					 num_dnhandles = regular_conn_count;
+#endif
+
+	if (!node->query_pending)
+		return;
+	node->query_pending = false;
+	node->pending_connections = NULL;
+	node->pending_count = 0;
+
+#ifdef ADB
+	/* the loop below reorders connections while they complete */
+	if (num_dnhandles > 0)
+	{
+		dnhandles = (PGXCNodeHandle **)
+			palloc(num_dnhandles * sizeof(PGXCNodeHandle *));
+		memcpy(dnhandles, connections, num_dnhandles * sizeof(PGXCNodeHandle *));
+	}
+
+	PG_TRY();
+	{
+#endif
 	/*
 	 * Stop if all commands are completed or we got a data row and
 	 * initialized state node for subsequent invocations
@@ -3661,7 +4322,7 @@ do_query(RemoteQueryState *node)
 		 * No matter any connection has crash down, we still need to deal with
 		 * other connections.
 		 */
-		pgxc_node_receive(regular_conn_count, connections, NULL);
+		RemoteQueryReceive(node, regular_conn_count, connections);
 #else
 		if (pgxc_node_receive(regular_conn_count, connections, NULL))
 		{
@@ -3765,20 +4426,23 @@ do_query(RemoteQueryState *node)
 #ifdef ADB
 	} PG_CATCH();
 	{
-		clear_some_handles(num_dnhandles, dnhandles, num_cohandles, cohandles);
+		clear_some_handles(num_dnhandles, dnhandles, 0, NULL);
 		if (dnhandles)
 			pfree(dnhandles);
-		if (cohandles)
-			pfree(cohandles);
 		PG_RE_THROW();
 	} PG_END_TRY();
 	if (dnhandles)
 		pfree(dnhandles);
-	if (cohandles)
-		pfree(cohandles);
 #endif
 }
 
+void
+do_query(RemoteQueryState *node)
+{
+	do_query_send(node);
+	do_query_receive(node);
+}
+
 /*
  * ExecRemoteQuery
  * Wrapper around the main RemoteQueryNext() function. This
@@ -3837,9 +4501,19 @@ RemoteQueryNext(ScanState *scan_node)
 	{
 		/* Fire BEFORE STATEMENT triggers just before the query execution */
 		pgxc_rq_fire_bstriggers(node);
+#ifdef ADB
+		/* the times of the nodes add up over the rescans */
+		if (node->node_instr && INSTR_TIME_IS_ZERO(node->node_instr_start))
+			INSTR_TIME_SET_CURRENT(node->node_instr_start);
+
+		/* rows of replicated tables already read under this snapshot */
+		if (!ReplCacheLookup(node))
+#endif
 		do_query(node);
 		node->query_Done = true;
 	}
+	else if (node->query_pending)
+		do_query_receive(node);
 
 	if (node->update_cursor)
 	{
@@ -3928,8 +4602,16 @@ RemoteQueryNext(ScanState *scan_node)
 				 * the tuplestore is certainly in EOF state, its read position will
 				 * move forward over the added tuple.  This is what we want.
 				 */
+#ifdef ADB
+				if (tuplestorestate && !TupIsNull(scanslot) && node->keep_rows)
+#else
 				if (tuplestorestate && !TupIsNull(scanslot))
+#endif
 					tuplestore_puttupleslot(tuplestorestate, scanslot);
+#ifdef ADB
+				if (node->rcache_fill && !TupIsNull(scanslot))
+					ReplCacheCollect(node, scanslot);
+#endif
 			}
 			else
 				node->eof_underlying = true;
@@ -3944,6 +4626,12 @@ RemoteQueryNext(ScanState *scan_node)
 	/* report error if any */
 	pgxc_node_report_error(node);
 
+#ifdef ADB
+	/* all the rows were read without error */
+	if (node->rcache_fill && node->eof_underlying && TupIsNull(scanslot))
+		ReplCacheStore(node);
+#endif
+
 	/*
 	 * Now we know the query is successful. Fire AFTER STATEMENT triggers. Make
 	 * sure this is the last iteration of the query. If an FQS query has
@@ -3980,15 +4668,22 @@ RemoteQueryNext(ScanState *scan_node)
 void
 ExecEndRemoteQuery(RemoteQueryState *node)
 {
-	ListCell *lc;
-
 	/* clean up the buffer */
-	foreach(lc, node->rowBuffer)
-	{
-		RemoteDataRow dataRow = (RemoteDataRow) lfirst(lc);
-		pfree(dataRow->msg);
-	}
-	list_free_deep(node->rowBuffer);
+	RowBufferFree(&node->rowBuffer);
+
+#ifdef ADB
+	/* should be finished by ModifyTable, do not leave the connections dirty */
+	if (node->batch_conn_count > 0)
+		ExecRemoteDMLBatchSync(node);
+#endif
+
+	/* started by Append but never read from */
+	if (node->query_pending)
+		do_query_receive(node);
+
+	/* rows not all read, nothing to keep */
+	if (node->rcache_fill)
+		ReplCacheAbandon(node);
 
 	node->current_conn = 0;
 	while (node->conn_count > 0)
@@ -4360,6 +5055,317 @@ ExecRemoteQueryReScan(RemoteQueryState *node, ExprContext *exprCtxt)
 	tuplestore_rescan(node->tuplestorestate);
 }
 
+#ifdef ADB
+/*
+ * ReplCacheUsable
+ * Can the rows of the step be kept for, or taken from, the cache of
+ * replicated tables? They have to be a plain read of replicated tables,
+ * which any Datanode answers the same way, with nothing depending on when
+ * the query runs but the snapshot. A transaction which wrote anything
+ * might see its own changes, it neither reads nor fills the cache.
+ */
+static bool
+ReplCacheUsable(RemoteQueryState *node)
+{
+	RemoteQuery *step = (RemoteQuery *) node->ss.ps.plan;
+
+	return ReplicatedTableCacheSize > 0 &&
+		   IS_PGXC_COORDINATOR &&
+		   ActiveSnapshotSet() &&
+		   !GetActiveSnapshot()->suboverflowed &&
+		   remoteXactState.numWriteRemoteNodes == 0 &&
+		   node->node_instr == NULL &&
+		   node->paramval_len == 0 &&
+		   (node->cursor == NULL || node->cursor[0] == '\0') &&
+		   step->sql_statement != NULL &&
+		   step->cursor == NULL &&
+		   step->exec_type == EXEC_ON_DATANODES &&
+		   step->exec_nodes != NULL &&
+		   IsExecNodesReplicated(step->exec_nodes) &&
+		   step->exec_nodes->en_expr == NIL &&
+		   step->remote_query != NULL &&
+		   step->remote_query->commandType == CMD_SELECT &&
+		   !step->has_row_marks &&
+		   !contain_mutable_functions((Node *) step->remote_query);
+}
+
+/* Are the xids, in any order, those of sorted? */
+static bool
+ReplCacheXidsMatch(TransactionId *sorted, TransactionId *xids, int count)
+{
+	TransactionId *copy;
+	bool		result;
+
+	if (count == 0)
+		return true;
+
+	copy = (TransactionId *) palloc(count * sizeof(TransactionId));
+	memcpy(copy, xids, count * sizeof(TransactionId));
+	qsort(copy, count, sizeof(TransactionId), xidComparator);
+	result = (memcmp(copy, sorted, count * sizeof(TransactionId)) == 0);
+	pfree(copy);
+
+	return result;
+}
+
+/*
+ * Does the entry hold the rows of the step under the snapshot? Two
+ * snapshots with the same xids see the same committed rows, and the own
+ * changes of a transaction are never seen by the cache, see ReplCacheUsable.
+ */
+static bool
+ReplCacheMatches(ReplCacheEntry *entry, RemoteQuery *step, Snapshot snapshot)
+{
+	return entry->xmin == snapshot->xmin &&
+		   entry->xmax == snapshot->xmax &&
+		   entry->curcid == snapshot->curcid &&
+		   entry->xcnt == snapshot->xcnt &&
+		   entry->subxcnt == snapshot->subxcnt &&
+		   entry->userid == GetUserId() &&
+		   strcmp(entry->query, step->sql_statement) == 0 &&
+		   strcmp(entry->search_path, namespace_search_path) == 0 &&
+		   ReplCacheXidsMatch(entry->xip, snapshot->xip, snapshot->xcnt) &&
+		   ReplCacheXidsMatch(entry->subxip, snapshot->subxip, snapshot->subxcnt);
+}
+
+static void
+ReplCacheEvict(ReplCacheEntry *entry)
+{
+	ReplCacheEntries = list_delete_ptr(ReplCacheEntries, entry);
+	ReplCacheUsed -= entry->size;
+	MemoryContextDelete(entry->context);
+}
+
+/*
+ * ReplCacheLookup
+ * On the first execution of a step reading replicated tables, give it the
+ * rows kept by the cache for the same query and snapshot, and return true.
+ * Otherwise get ready to keep the rows it is going to read, and return
+ * false.
+ */
+static bool
+ReplCacheLookup(RemoteQueryState *node)
+{
+	RemoteQuery *step = (RemoteQuery *) node->ss.ps.plan;
+	Snapshot	snapshot;
+	ReplCacheEntry *entry;
+	MemoryContext oldcontext;
+	ListCell   *lc;
+
+	if (ReplicatedTableCacheSize == 0)
+	{
+		while (ReplCacheEntries != NIL)
+			ReplCacheEvict((ReplCacheEntry *) linitial(ReplCacheEntries));
+		return false;
+	}
+	if (!ReplCacheUsable(node))
+		return false;
+
+	snapshot = GetActiveSnapshot();
+	foreach(lc, ReplCacheEntries)
+	{
+		TupleTableSlot *scanslot = node->ss.ss_ScanTupleSlot;
+		ListCell   *lc2;
+
+		entry = (ReplCacheEntry *) lfirst(lc);
+		if (!ReplCacheMatches(entry, step, snapshot))
+			continue;
+
+		ExecSetSlotDescriptor(scanslot, CreateTupleDescCopy(entry->tupdesc));
+		node->tuplestorestate = tuplestore_begin_heap(false, false, work_mem);
+		tuplestore_set_eflags(node->tuplestorestate, node->eflags);
+		foreach(lc2, entry->tuples)
+			tuplestore_puttuple(node->tuplestorestate, (HeapTuple) lfirst(lc2));
+		tuplestore_rescan(node->tuplestorestate);
+		node->eof_underlying = true;
+
+		oldcontext = MemoryContextSwitchTo(ReplCacheContext);
+		ReplCacheEntries = lcons(entry, list_delete_ptr(ReplCacheEntries, entry));
+		MemoryContextSwitchTo(oldcontext);
+		return true;
+	}
+
+	if (ReplCacheContext == NULL)
+		ReplCacheContext = AllocSetContextCreate(TopMemoryContext,
+												 "Replicated table cache",
+												 ALLOCSET_DEFAULT_MINSIZE,
+												 ALLOCSET_DEFAULT_INITSIZE,
+												 ALLOCSET_DEFAULT_MAXSIZE);
+
+	/* in the query context until complete, so an error frees the rows */
+	oldcontext = MemoryContextSwitchTo(
+		AllocSetContextCreate(node->ss.ps.state->es_query_cxt,
+							  "Replicated table cache entry",
+							  ALLOCSET_SMALL_MINSIZE,
+							  ALLOCSET_SMALL_INITSIZE,
+							  ALLOCSET_DEFAULT_MAXSIZE));
+	entry = (ReplCacheEntry *) palloc0(sizeof(ReplCacheEntry));
+	entry->context = CurrentMemoryContext;
+	entry->query = pstrdup(step->sql_statement);
+	entry->userid = GetUserId();
+	entry->search_path = pstrdup(namespace_search_path);
+	entry->xmin = snapshot->xmin;
+	entry->xmax = snapshot->xmax;
+	entry->curcid = snapshot->curcid;
+	entry->xcnt = snapshot->xcnt;
+	entry->xip = (TransactionId *)
+		palloc((snapshot->xcnt + 1) * sizeof(TransactionId));
+	memcpy(entry->xip, snapshot->xip, snapshot->xcnt * sizeof(TransactionId));
+	qsort(entry->xip, snapshot->xcnt, sizeof(TransactionId), xidComparator);
+	entry->subxcnt = snapshot->subxcnt;
+	entry->subxip = (TransactionId *)
+		palloc((snapshot->subxcnt + 1) * sizeof(TransactionId));
+	memcpy(entry->subxip, snapshot->subxip, snapshot->subxcnt * sizeof(TransactionId));
+	qsort(entry->subxip, snapshot->subxcnt, sizeof(TransactionId), xidComparator);
+	MemoryContextSwitchTo(oldcontext);
+
+	node->rcache_fill = entry;
+	return false;
+}
+
+/* Keep a copy of a row read by the step, unless that makes too many */
+static void
+ReplCacheCollect(RemoteQueryState *node, TupleTableSlot *slot)
+{
+	ReplCacheEntry *entry = node->rcache_fill;
+	MemoryContext oldcontext;
+	HeapTuple	tuple;
+
+	oldcontext = MemoryContextSwitchTo(entry->context);
+	tuple = ExecCopySlotTuple(slot);
+	entry->tuples = lappend(entry->tuples, tuple);
+	MemoryContextSwitchTo(oldcontext);
+
+	entry->size += HEAPTUPLESIZE + tuple->t_len;
+	if (entry->size > ReplicatedTableCacheSize * 1024L)
+		ReplCacheAbandon(node);
+}
+
+/* All the rows of the step were read, keep them for the next time */
+static void
+ReplCacheStore(RemoteQueryState *node)
+{
+	ReplCacheEntry *entry = node->rcache_fill;
+	MemoryContext oldcontext;
+
+	node->rcache_fill = NULL;
+
+	oldcontext = MemoryContextSwitchTo(entry->context);
+	entry->tupdesc = CreateTupleDescCopy(node->ss.ss_ScanTupleSlot->tts_tupleDescriptor);
+	MemoryContextSwitchTo(oldcontext);
+
+	/* make room, the least recently used first */
+	while (ReplCacheEntries != NIL &&
+		   ReplCacheUsed + entry->size > ReplicatedTableCacheSize * 1024L)
+		ReplCacheEvict((ReplCacheEntry *) llast(ReplCacheEntries));
+
+	MemoryContextSetParent(entry->context, ReplCacheContext);
+	oldcontext = MemoryContextSwitchTo(ReplCacheContext);
+	ReplCacheEntries = lcons(entry, ReplCacheEntries);
+	MemoryContextSwitchTo(oldcontext);
+	ReplCacheUsed += entry->size;
+}
+
+static void
+ReplCacheAbandon(RemoteQueryState *node)
+{
+	MemoryContextDelete(node->rcache_fill->context);
+	node->rcache_fill = NULL;
+}
+
+/*
+ * ExecRemoteQueryIsAsyncCapable
+ * Whether an Append may start the step along with its other children and
+ * come back for the rows later, see ExecRemoteQueryAsyncRequest. Only plain
+ * reads from Datanodes qualify, nothing else waits on their answers.
+ */
+bool
+ExecRemoteQueryIsAsyncCapable(RemoteQueryState *node)
+{
+	RemoteQuery *step = (RemoteQuery *) node->ss.ps.plan;
+
+	return step->remote_query != NULL &&
+		   step->remote_query->commandType == CMD_SELECT &&
+		   step->exec_type == EXEC_ON_DATANODES &&
+		   !step->has_row_marks &&
+		   step->cursor == NULL;
+}
+
+/*
+ * ExecRemoteQueryAsyncRequest
+ * Send the query on the first call without waiting for the answers. Return
+ * true if ExecProcNode can now be called without blocking on the Datanodes,
+ * otherwise add the sockets to wait on to socks and return false.
+ *
+ * An Append sends the queries of all its children this way before reading
+ * any of them. A connection wanted by another RemoteQuery meanwhile is
+ * buffered as usual, BufferConnection reads the first answers then.
+ */
+bool
+ExecRemoteQueryAsyncRequest(RemoteQueryState *node, pgsocket *socks,
+							int *nsocks)
+{
+	PGXCNodeHandle **connections;
+	int			conn_count;
+	int			i;
+
+	if (!node->query_Done)
+	{
+		pgxc_rq_fire_bstriggers(node);
+		if (node->node_instr && INSTR_TIME_IS_ZERO(node->node_instr_start))
+			INSTR_TIME_SET_CURRENT(node->node_instr_start);
+		node->query_Done = true;
+		if (ReplCacheLookup(node))
+			return true;
+		do_query_send(node);
+	}
+
+	if (node->query_pending)
+	{
+		connections = node->pending_connections;
+		conn_count = node->pending_count;
+	}
+	else
+	{
+		/* rows already received, or nothing more to come */
+		if (node->currentRow.msg != NULL ||
+			!RemoteRowBufferIsEmpty(&node->rowBuffer) ||
+			(node->tuplestorestate && !tuplestore_ateof(node->tuplestorestate)))
+			return true;
+		connections = node->connections;
+		conn_count = node->conn_count;
+	}
+
+	if (conn_count == 0)
+		return true;
+
+	for (i = 0; i < conn_count; i++)
+	{
+		PGXCNodeHandle *conn = connections[i];
+
+		if (conn->combiner != node ||
+			conn->state != DN_CONNECTION_STATE_QUERY ||
+			HAS_MESSAGE_BUFFERED(conn))
+			return true;
+	}
+
+	/* pick up what has arrived, the sockets do not block */
+	for (i = 0; i < conn_count; i++)
+	{
+		PGXCNodeHandle *conn = connections[i];
+
+		if (pgxc_node_read_data(conn, true) < 0 ||
+			conn->state != DN_CONNECTION_STATE_QUERY ||
+			HAS_MESSAGE_BUFFERED(conn))
+			return true;
+	}
+
+	for (i = 0; i < conn_count; i++)
+		socks[(*nsocks)++] = connections[i]->sock;
+	return false;
+}
+#endif /* ADB */
+
 
 /*
  * Execute utility statement on multiple Datanodes
@@ -4838,6 +5844,7 @@ int DataNodeCopyInBinaryForAll(char *msg_buf, int len, PGXCNodeHandle** copy_con
 					errmsg("out of memory")));
 			}
 
+			PGXCNodeCountMessageSent(handle);
 			handle->outBuffer[handle->outEnd++] = 'd';
 			memcpy(handle->outBuffer + handle->outEnd, &nLen, 4);
 			handle->outEnd += 4;
@@ -4970,6 +5977,32 @@ ExecProcNodeDMLInXC(EState *estate,
 	if (econtext)
 		econtext->ecxt_scantuple = newDataSlot;
 
+#ifdef ADB
+	if (!resultRemoteRel->batch_checked)
+	{
+		resultRemoteRel->batch_insert = ExecRemoteDMLBatchCheck(resultRelInfo, resultRemoteRel);
+		resultRemoteRel->batch_checked = true;
+	}
+	if (resultRemoteRel->batch_insert && resultRemoteRel->batch_deferred)
+	{
+		/* answered at the client's Sync, a row INSERT adds one row */
+		ExecRemoteDMLBatchRow(resultRemoteRel);
+		resultRemoteRel->rqs_processed = 1;
+		return NULL;
+	}
+	if (resultRemoteRel->batch_insert)
+	{
+		/*
+		 * Caller adds rqs_processed to es_processed after every row, keep
+		 * only the rows completed since then.
+		 */
+		resultRemoteRel->rqs_processed -= resultRemoteRel->batch_reported;
+		ExecRemoteDMLBatchRow(resultRemoteRel);
+		resultRemoteRel->batch_reported = resultRemoteRel->rqs_processed;
+		return NULL;
+	}
+#endif
+
 
 	/*
 	 * This loop would be required to reject tuples received from datanodes
@@ -5033,6 +6066,329 @@ ExecProcNodeDMLInXC(EState *estate,
 	return returningResultSlot;
 }
 
+#ifdef ADB
+/*
+ * ExecRemoteDMLBatchCheck
+ *
+ * Can rows of this INSERT be pipelined? The answers are only checked at
+ * the end of a batch, so nothing may need the result of a row before that:
+ * no RETURNING and no row triggers. Rows to replicated tables are not
+ * batched, their row count is not summed over the nodes.
+ */
+static bool
+ExecRemoteDMLBatchCheck(ResultRelInfo *resultRelInfo, RemoteQueryState *node)
+{
+	RemoteQuery	   *step = (RemoteQuery *) node->ss.ps.plan;
+	TriggerDesc	   *trigdesc = resultRelInfo->ri_TrigDesc;
+
+	if (RemoteInsertBatchSize <= 1)
+		return false;
+
+	if (!step->rq_params_internal ||
+		step->exec_type != EXEC_ON_DATANODES ||
+		step->exec_nodes == NULL ||
+		step->exec_nodes->accesstype != RELATION_ACCESS_INSERT ||
+		step->base_tlist != NULL ||
+		step->force_autocommit ||
+		step->read_only ||
+		step->cursor != NULL ||
+		IsExecNodesReplicated(step->exec_nodes) ||
+		node->combine_type != COMBINE_TYPE_SUM)
+		return false;
+
+	if (trigdesc &&
+		(trigdesc->trig_insert_before_row ||
+		 trigdesc->trig_insert_after_row ||
+		 trigdesc->trig_insert_instead_row))
+		return false;
+
+	/*
+	 * The rows of the statement of an Execute message may stay pipelined
+	 * after it, nothing but the client sees its result before the Sync.
+	 * Other statements wait for the rows left by earlier ones.
+	 */
+	if (RemoteDMLBatchStmt != NULL &&
+		node->ss.ps.state->es_plannedstmt == RemoteDMLBatchStmt)
+		node->batch_deferred = true;
+	else
+		ExecFlushRemoteDMLBatch();
+
+	return true;
+}
+
+/*
+ * ExecRemoteDMLBatchRow
+ *
+ * Send the INSERT of current row to its Datanode(s) and do not wait for the
+ * answer. Bind/Execute of the rows are queued on each connection and all of
+ * them are completed with one Sync per node every remote_insert_batch_size
+ * rows, or at the end of ModifyTable by ExecFinishRemoteDMLBatch.
+ */
+static void
+ExecRemoteDMLBatchRow(RemoteQueryState *node)
+{
+	RemoteQuery			*step = (RemoteQuery *) node->ss.ps.plan;
+	RemoteQueryState	*batch;
+	PGXCNodeAllHandles	*pgxc_connections;
+	PGXCNodeHandle		**connections;
+	Snapshot			snapshot = GetActiveSnapshot();
+	CommandId			cid = GetCurrentCommandId(false);
+	int					conn_count;
+	int					i,j;
+
+	if (RecoveryInProgress())
+		elog(ERROR, "cannot run transaction to remote nodes during recovery");
+
+	if (step->is_temp)
+		ExecSetTempObjectIncluded();
+
+	pgxc_connections = get_exec_connections(node, step->exec_nodes, step->exec_type);
+	Assert(pgxc_connections->primary_handle == NULL);
+	connections = pgxc_connections->datanode_handles;
+	conn_count = pgxc_connections->dn_conn_count;
+	pfree(pgxc_connections);
+
+	/* the rows of a deferred batch are answered to the long-lived combiner */
+	batch = node->batch_deferred ? GetDeferredDMLBatch() : node;
+
+	if (batch->batch_connections == NULL)
+		batch->batch_connections = (PGXCNodeHandle **)
+			MemoryContextAllocZero(batch == node ?
+								   node->ss.ps.state->es_query_cxt :
+								   TopMemoryContext,
+								   NumDataNodes * sizeof(PGXCNodeHandle *));
+
+	agtm_BeginTransaction();
+
+	for (i = 0; i < conn_count; i++)
+	{
+		PGXCNodeHandle *conn = connections[i];
+		bool			prepared = false;
+
+		/* already waiting for Sync in this batch? */
+		for (j = 0; j < batch->batch_conn_count; j++)
+		{
+			if (batch->batch_connections[j] == conn)
+				break;
+		}
+		if (j >= batch->batch_conn_count || !conn->sync_pending || conn->combiner != batch)
+		{
+			/* first row of this batch on the node */
+			if (conn->state == DN_CONNECTION_STATE_QUERY)
+				BufferConnection(conn);
+
+			if (pgxc_node_begin(1, &conn, true, false, PGXC_NODE_DATANODE))
+				ereport(ERROR,
+						(errcode(ERRCODE_INTERNAL_ERROR),
+						 errmsg("Could not begin transaction on Datanodes.")));
+
+			if (j >= batch->batch_conn_count)
+			{
+				Assert(batch->batch_conn_count < NumDataNodes);
+				batch->batch_connections[batch->batch_conn_count++] = conn;
+			}
+		}
+
+		if (pgxc_node_send_cmd_id(conn, cid) < 0 ||
+			(snapshot && pgxc_node_send_snapshot(conn, snapshot)))
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("Failed to send command to Datanodes")));
+
+		if (step->statement)
+			prepared = ActivateDatanodeStatementOnNode(step->statement,
+													   PGXCNodeGetNodeId(conn->nodeoid,
+																		 PGXC_NODE_DATANODE));
+
+		if (pgxc_node_send_query_extended_nosync(conn,
+							prepared ? NULL : step->sql_statement,
+							step->statement,
+							NULL,
+							node->rqs_num_params,
+							node->rqs_param_types,
+							node->paramval_len,
+							node->paramval_data,
+							false,
+							0) != 0)
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("Failed to send command to Datanodes")));
+		conn->combiner = batch;
+
+		/* let the node work on what we have */
+		if (conn->outEnd >= BATCH_SIZE_TO_FLUSH && pgxc_node_flush(conn) != 0)
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("Failed to send command to Datanodes")));
+	}
+
+	if (++batch->batch_rows >= RemoteInsertBatchSize)
+		ExecRemoteDMLBatchSync(batch);
+}
+
+/*
+ * ExecRemoteDMLBatchSync
+ *
+ * Send Sync to every connection of current batch and read all the answers,
+ * row counts are added to rqs_processed.
+ */
+static void
+ExecRemoteDMLBatchSync(RemoteQueryState *node)
+{
+	PGXCNodeHandle **connections = node->batch_connections;
+	int			count = 0;
+	int			i;
+
+	for (i = 0; i < node->batch_conn_count; i++)
+	{
+		PGXCNodeHandle *conn = node->batch_connections[i];
+
+		/* BufferConnection may have completed it already */
+		if (!conn->sync_pending || conn->combiner != node)
+			continue;
+
+		if (pgxc_node_send_sync(conn) != 0)
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("Failed to send command to Datanodes")));
+		connections[count++] = conn;
+	}
+	node->batch_conn_count = 0;
+	node->batch_rows = 0;
+
+	while (count > 0)
+	{
+		/* connections broken are reported by handle_response */
+		pgxc_node_receive(count, connections, NULL);
+
+		i = 0;
+		while (i < count)
+		{
+			int res = handle_response(connections[i], node);
+			if (res == RESPONSE_EOF)
+			{
+				i++;
+			}
+			else if (res == RESPONSE_COMPLETE)
+			{
+				if (i < --count)
+					connections[i] = connections[count];
+			}
+			else
+			{
+				if (connections[i]->error == NULL)
+				{
+					add_error_message(connections[i],
+						"Unexpected response from node %s", NameStr(connections[i]->name));
+				}
+				if (node->errorMessage.len == 0)
+				{
+					appendStringInfo(&(node->errorMessage),
+						"Unexpected response from node %s", NameStr(connections[i]->name));
+				}
+				if (i < --count)
+					connections[i] = connections[count];
+			}
+		}
+	}
+
+	/* report error if any */
+	pgxc_node_report_error(node);
+}
+
+/*
+ * ExecFinishRemoteDMLBatch
+ *
+ * Called by ModifyTable when all rows are sent, completes the pipelined rows
+ * and counts them.
+ */
+void
+ExecFinishRemoteDMLBatch(EState *estate, RemoteQueryState *node, bool canSetTag)
+{
+	if (node == NULL || !node->batch_insert)
+		return;
+
+	/* rows are counted as sent, the Sync of the client completes them */
+	if (node->batch_deferred)
+	{
+		node->rqs_processed = 0;
+		return;
+	}
+
+	node->rqs_processed -= node->batch_reported;
+	if (node->batch_conn_count > 0)
+		ExecRemoteDMLBatchSync(node);
+	if (canSetTag)
+		estate->es_processed += node->rqs_processed;
+	node->rqs_processed = 0;
+	node->batch_reported = 0;
+}
+
+/*
+ * ExecFlushRemoteDMLBatch
+ *
+ * Complete the rows left pipelined to the Datanodes by earlier Execute
+ * messages, and report their errors. Called at the client's Sync, before
+ * any other command and before the transaction ends.
+ */
+void
+ExecFlushRemoteDMLBatch(void)
+{
+	RemoteQueryState *batch = DeferredDMLBatch;
+
+	/* an error may have been read already by BufferConnection */
+	if (batch == NULL ||
+		(batch->batch_conn_count == 0 && batch->errorMessage.len == 0))
+		return;
+
+	ExecRemoteDMLBatchSync(batch);
+}
+
+static RemoteQueryState *
+GetDeferredDMLBatch(void)
+{
+	if (DeferredDMLBatch == NULL)
+	{
+		MemoryContext oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+
+		DeferredDMLBatch = CreateResponseCombiner(0, COMBINE_TYPE_SUM);
+		/* BufferConnection works in the memory context of the scan slot */
+		DeferredDMLBatch->ss.ss_ScanTupleSlot = MakeTupleTableSlot();
+		MemoryContextSwitchTo(oldcontext);
+	}
+	return DeferredDMLBatch;
+}
+
+/*
+ * Forget the deferred rows at the end of the transaction. They are already
+ * completed at commit, at abort the connections are cleaned up anyway.
+ */
+static void
+AtEOXact_RemoteDMLBatch(void)
+{
+	RemoteQueryState *batch = DeferredDMLBatch;
+
+	RemoteDMLBatchStmt = NULL;
+	if (batch == NULL)
+		return;
+
+	if (batch->batch_connections)
+	{
+		pfree(batch->batch_connections);
+		batch->batch_connections = NULL;
+	}
+	batch->batch_conn_count = 0;
+	batch->batch_rows = 0;
+	batch->rqs_processed = 0;
+	batch->command_complete_count = 0;
+	batch->combine_type = COMBINE_TYPE_SUM;
+	batch->request_type = REQUEST_TYPE_NOT_DEFINED;
+	resetStringInfo(&batch->errorMessage);
+	batch->errorDetail = NULL;
+	batch->errorNodeName = NULL;
+}
+#endif /* ADB */
+
 void
 RegisterTransactionNodes(int count, void **connections, bool write)
 {
@@ -5085,6 +6441,9 @@ ForgetTransactionNodes(void)
 void
 AtEOXact_Remote(void)
 {
+#ifdef ADB
+	AtEOXact_RemoteDMLBatch();
+#endif
 	ExecClearTempObjectIncluded();
 	ForgetTransactionNodes();
 	clear_RemoteXactState();
@@ -5452,7 +6811,14 @@ bool
 IsTwoPhaseCommitRequired(bool localWrite)
 {
 #ifdef ADB
-	if (list_length(XactWriteNodes) >= 1 || localWrite)
+	/*
+	 * A single writer commits or not by itself, the readers have nothing
+	 * to prepare, and AGTM is told of the commit after the writer so the
+	 * transaction stays running in the snapshots until then.
+	 */
+	if (list_length(XactWriteNodes) > 1 ||
+		(list_length(XactWriteNodes) == 1 && !EnableOnePhaseCommit) ||
+		localWrite)
 #else
 	if ((list_length(XactWriteNodes) > 1) ||
 		((list_length(XactWriteNodes) == 1) && localWrite))
@@ -5471,6 +6837,20 @@ IsTwoPhaseCommitRequired(bool localWrite)
 		return false;
 }
 
+#ifdef ADB
+/*
+ * XactHasRemoteWrites
+ * Has the current transaction written on any Datanode yet? Other sessions
+ * on those nodes, such as the ones moving rows for a plan, do not see what
+ * it wrote.
+ */
+bool
+XactHasRemoteWrites(void)
+{
+	return XactWriteNodes != NIL;
+}
+#endif
+
 static void
 clear_RemoteXactState(void)
 {
@@ -5550,9 +6930,7 @@ pgxc_node_report_error(RemoteQueryState *combiner)
 	{
 		char *code = combiner->errorCode;
 #ifdef ADB
-		int i;
-		for (i = 0; i < combiner->conn_count; i++)
-			pgxc_node_flush_read(combiner->connections[i]);
+		pgxc_node_flush_read_all(combiner->conn_count, combiner->connections);
 #endif
 
 #ifdef ADB
@@ -6006,7 +7384,7 @@ static int flushPGXCNodeHandleData(PGXCNodeHandle *handle)
 		{
 			/* No data sent */
 			retry_no++;
-			wait_microsec = retry_no < 5 ? 0 : (retry_no < 35 ? 2^(retry_no / 5) : 128) * 1000;
+			wait_microsec = retry_no < 5 ? 0 : (retry_no < 35 ? 1 << (retry_no / 5) : 128) * 1000;
 			if (wait_microsec)
 				pg_usleep(wait_microsec);
 			continue;
@@ -0,0 +1,692 @@
+/*-------------------------------------------------------------------------
+ *
+ * globaldeadlock.c
+ *
+ *	  Detection of deadlocks between transactions waiting on several nodes
+ *
+ * The deadlock detector of a node only sees the waits of that node, so a
+ * transaction waiting on a Datanode for another one, itself waiting for
+ * the first on another Datanode, waits until a timeout ends the statement.
+ * The transactions of a cluster have the same global xid on every node,
+ * which lets a Coordinator put together the waits of all the Datanodes.
+ *
+ * A Coordinator backend whose transaction waits for Datanodes more than
+ * deadlock_timeout collects the lock waits of every Datanode, as edges
+ * from a waiting xid to an xid it waits for, and looks for cycles in the
+ * graph they make.  The newest transaction of each cycle is the victim:
+ * the Datanode where it waits is asked to signal its backend there, which
+ * fails its statement with a deadlock error if it still waits as seen.
+ * The victim being chosen the same way by everyone, Coordinators finding
+ * the same cycle cancel the same transaction.  One backend per Coordinator
+ * checks in each deadlock_timeout interval.
+ *
+ * Only waits on Datanode locks between transactions with an xid are seen;
+ * a cycle going through a lock of a Coordinator is still broken by the
+ * timeouts.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/pgxc/pool/globaldeadlock.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "../interfaces/libpq/libpq-fe.h"
+#include "access/htup_details.h"
+#include "access/transam.h"
+#include "access/xact.h"
+#include "catalog/pg_authid.h"
+#include "commands/dbcommands.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "pgxc/globaldeadlock.h"
+#include "pgxc/nodemgr.h"
+#include "pgxc/pgxc.h"
+#include "pgxc/pgxcnode.h"
+#include "storage/ipc.h"
+#include "storage/lock.h"
+#include "storage/proc.h"
+#include "storage/procarray.h"
+#include "storage/procsignal.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "utils/builtins.h"
+#include "utils/memutils.h"
+#include "utils/timestamp.h"
+#include "utils/tuplestore.h"
+
+/* seconds to wait for a Datanode connection when checking */
+#define GLOBAL_DEADLOCK_CONNECT_TIMEOUT 2
+
+/* GUC */
+bool		enable_global_deadlock_check = true;
+
+/* set by the signal of a Coordinator which chose this backend as victim */
+volatile bool GlobalDeadlockPending = false;
+
+typedef struct GlobalDeadlockShared
+{
+	slock_t		mutex;
+	TimestampTz last_check;		/* of a backend of this Coordinator */
+} GlobalDeadlockShared;
+
+static GlobalDeadlockShared *GlobalDeadlock = NULL;
+
+/* A transaction waiting on a node for a lock another one holds */
+typedef struct WaitEdge
+{
+	TransactionId waiter;
+	TransactionId holder;
+	int			pid;			/* of the waiter on the node */
+	int			node;			/* index of the node in the check */
+} WaitEdge;
+
+#define WAIT_VERTEX_NEW		0
+#define WAIT_VERTEX_ON_PATH	1
+#define WAIT_VERTEX_DONE	2
+#define WAIT_VERTEX_VICTIM	3
+
+typedef struct WaitGraph
+{
+	WaitEdge   *edges;			/* sorted by waiter */
+	int			nedges;
+	int			maxedges;
+	TransactionId *xids;		/* distinct waiters, sorted */
+	int			nxids;
+	int		   *first;			/* first edge of each waiter, and the end */
+	int		   *state;			/* WAIT_VERTEX_xxx of each waiter */
+	int		   *path;			/* edges followed by the search */
+	int			depth;
+	int			cycle;			/* where the cycle found begins in path */
+} WaitGraph;
+
+/* connection parameters, cached as they may not be looked up when aborting */
+static char *deadlock_dbname = NULL;
+static char *deadlock_username = NULL;
+
+static TransactionId pid_get_xid(int pid);
+static int	collect_wait_edges(WaitEdge **result);
+static void wait_graph_add(WaitGraph *graph, TransactionId waiter,
+			   TransactionId holder, int pid, int node);
+static int	wait_edge_cmp(const void *a, const void *b);
+static void wait_graph_build(WaitGraph *graph);
+static int	wait_graph_vertex(WaitGraph *graph, TransactionId xid);
+static bool wait_graph_search(WaitGraph *graph, int vertex);
+static void wait_graph_break_cycle(WaitGraph *graph, PGconn **conns,
+					   NodeDefinition **defs);
+static PGconn *fetch_wait_edges(NodeDefinition *def, WaitGraph *graph,
+				 int node);
+
+Size
+GlobalDeadlockShmemSize(void)
+{
+	return MAXALIGN(sizeof(GlobalDeadlockShared));
+}
+
+void
+GlobalDeadlockShmemInit(void)
+{
+	bool		found;
+
+	GlobalDeadlock = (GlobalDeadlockShared *)
+		ShmemInitStruct("Global Deadlock Check", GlobalDeadlockShmemSize(),
+						&found);
+
+	if (!found)
+	{
+		SpinLockInit(&GlobalDeadlock->mutex);
+		GlobalDeadlock->last_check = 0;
+	}
+}
+
+/* Top-level xid of the backend "pid" of this node, if any */
+static TransactionId
+pid_get_xid(int pid)
+{
+	PGPROC	   *proc = BackendPidGetProc(pid);
+
+	if (proc == NULL)
+		return InvalidTransactionId;
+
+	return ProcGlobal->allPgXact[proc->pgprocno].xid;
+}
+
+/*
+ * Waits of this node between transactions with an xid: one edge for each
+ * holder of a lock mode conflicting with the mode a backend waits for.
+ */
+static int
+collect_wait_edges(WaitEdge **result)
+{
+	LockData   *data = GetLockStatusData();
+	WaitEdge   *edges = NULL;
+	int			nedges = 0;
+	int			maxedges = 0;
+	int			i;
+	int			j;
+
+	for (i = 0; i < data->nelements; i++)
+	{
+		LockInstanceData *waiter = &data->locks[i];
+		TransactionId waiter_xid = InvalidTransactionId;
+
+		if (waiter->waitLockMode == NoLock)
+			continue;
+
+		for (j = 0; j < data->nelements; j++)
+		{
+			LockInstanceData *holder = &data->locks[j];
+			TransactionId holder_xid;
+			LOCKMODE	mode;
+
+			if (holder->pid == waiter->pid || holder->holdMask == 0 ||
+				memcmp(&holder->locktag, &waiter->locktag, sizeof(LOCKTAG)) != 0)
+				continue;
+
+			for (mode = 1; mode < MAX_LOCKMODES; mode++)
+			{
+				if ((holder->holdMask & LOCKBIT_ON(mode)) &&
+					DoLockModesConflict(mode, waiter->waitLockMode))
+					break;
+			}
+			if (mode >= MAX_LOCKMODES)
+				continue;
+
+			if (!TransactionIdIsValid(waiter_xid))
+			{
+				waiter_xid = pid_get_xid(waiter->pid);
+				if (!TransactionIdIsValid(waiter_xid))
+					break;
+			}
+			holder_xid = pid_get_xid(holder->pid);
+			if (!TransactionIdIsValid(holder_xid) ||
+				TransactionIdEquals(holder_xid, waiter_xid))
+				continue;
+
+			if (nedges >= maxedges)
+			{
+				maxedges = Max(maxedges * 2, 16);
+				edges = edges ? repalloc(edges, maxedges * sizeof(WaitEdge)) :
+					palloc(maxedges * sizeof(WaitEdge));
+			}
+			edges[nedges].waiter = waiter_xid;
+			edges[nedges].holder = holder_xid;
+			edges[nedges].pid = waiter->pid;
+			edges[nedges].node = 0;
+			nedges++;
+		}
+	}
+
+	*result = edges;
+	return nedges;
+}
+
+/*
+ * pg_lock_wait_edges
+ *
+ * Transactions of this node waiting for a lock, and the transactions they
+ * wait for.
+ */
+Datum
+pg_lock_wait_edges(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	TupleDesc	tupdesc;
+	Tuplestorestate *tupstore;
+	MemoryContext oldcontext;
+	WaitEdge   *edges;
+	int			nedges;
+	int			i;
+
+	/* check to see if caller supports us returning a tuplestore */
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not " \
+						"allowed in this context")));
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+	tupdesc = CreateTupleDescCopy(tupdesc);
+	tupstore = tuplestore_begin_heap(true, false, work_mem);
+	MemoryContextSwitchTo(oldcontext);
+
+	nedges = collect_wait_edges(&edges);
+	for (i = 0; i < nedges; i++)
+	{
+		Datum		values[3];
+		bool		nulls[3] = {false, false, false};
+
+		values[0] = Int32GetDatum(edges[i].pid);
+		values[1] = TransactionIdGetDatum(edges[i].waiter);
+		values[2] = TransactionIdGetDatum(edges[i].holder);
+		tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+	}
+
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = tupdesc;
+
+	return (Datum) 0;
+}
+
+/*
+ * pgxc_cancel_deadlock_victim
+ *
+ * Fail the statement of the backend "pid" with a deadlock error, if its
+ * transaction "xid" still waits for "blocker".  Returns whether it was
+ * signaled.
+ */
+Datum
+pgxc_cancel_deadlock_victim(PG_FUNCTION_ARGS)
+{
+	int			pid = PG_GETARG_INT32(0);
+	TransactionId xid = DatumGetTransactionId(PG_GETARG_DATUM(1));
+	TransactionId blocker = DatumGetTransactionId(PG_GETARG_DATUM(2));
+	WaitEdge   *edges;
+	int			nedges;
+	int			i;
+	PGPROC	   *proc;
+
+	if (!superuser())
+		ereport(ERROR,
+				(errcode(ERRCODE_INSUFFICIENT_PRIVILEGE),
+				 errmsg("must be superuser to cancel a deadlock victim")));
+
+	nedges = collect_wait_edges(&edges);
+	for (i = 0; i < nedges; i++)
+	{
+		if (edges[i].pid == pid &&
+			TransactionIdEquals(edges[i].waiter, xid) &&
+			TransactionIdEquals(edges[i].holder, blocker))
+			break;
+	}
+	if (i >= nedges)
+		PG_RETURN_BOOL(false);
+
+	proc = BackendPidGetProc(pid);
+	if (proc == NULL ||
+		SendProcSignal(pid, PROCSIG_GLOBAL_DEADLOCK, proc->backendId) < 0)
+		PG_RETURN_BOOL(false);
+
+	PG_RETURN_BOOL(true);
+}
+
+/*
+ * HandleGlobalDeadlockInterrupt
+ *
+ * Called by procsignal_sigusr1_handler when a Coordinator chose the
+ * transaction of this backend as the victim of a deadlock.
+ */
+void
+HandleGlobalDeadlockInterrupt(void)
+{
+	int			save_errno = errno;
+
+	/*
+	 * Note: this is called by a SIGNAL HANDLER. You must be very wary what
+	 * you do here.
+	 */
+
+	/* Don't joggle the elbow of proc_exit, or cancel a wait that ended */
+	if (!proc_exit_inprogress && IsWaitingForLock())
+	{
+		GlobalDeadlockPending = true;
+		QueryCancelPending = true;
+		InterruptPending = true;
+
+		/* We are waiting for the lock, service the interrupt immediately */
+		if (ImmediateInterruptOK)
+			ProcessInterrupts();
+	}
+
+	if (MyProc)
+		SetLatch(&MyProc->procLatch);
+
+	errno = save_errno;
+}
+
+/*
+ * GlobalDeadlockCheckWanted
+ *
+ * Should a Coordinator backend waiting for Datanodes check for deadlocks
+ * every deadlock_timeout?
+ */
+bool
+GlobalDeadlockCheckWanted(void)
+{
+	return IS_PGXC_COORDINATOR && !IsConnFromCoord() &&
+		enable_global_deadlock_check && GlobalDeadlock != NULL &&
+		TransactionIdIsValid(GetTopTransactionIdIfAny());
+}
+
+static void
+wait_graph_add(WaitGraph *graph, TransactionId waiter, TransactionId holder,
+			   int pid, int node)
+{
+	if (graph->nedges >= graph->maxedges)
+	{
+		graph->maxedges = Max(graph->maxedges * 2, 64);
+		graph->edges = graph->edges ?
+			repalloc(graph->edges, graph->maxedges * sizeof(WaitEdge)) :
+			palloc(graph->maxedges * sizeof(WaitEdge));
+	}
+
+	graph->edges[graph->nedges].waiter = waiter;
+	graph->edges[graph->nedges].holder = holder;
+	graph->edges[graph->nedges].pid = pid;
+	graph->edges[graph->nedges].node = node;
+	graph->nedges++;
+}
+
+static int
+wait_edge_cmp(const void *a, const void *b)
+{
+	TransactionId xa = ((const WaitEdge *) a)->waiter;
+	TransactionId xb = ((const WaitEdge *) b)->waiter;
+
+	if (xa < xb)
+		return -1;
+	return xa > xb ? 1 : 0;
+}
+
+/* Index the edges by waiter */
+static void
+wait_graph_build(WaitGraph *graph)
+{
+	int			i;
+
+	if (graph->nedges > 1)
+		qsort(graph->edges, graph->nedges, sizeof(WaitEdge), wait_edge_cmp);
+
+	graph->xids = palloc(sizeof(TransactionId) * Max(graph->nedges, 1));
+	graph->first = palloc(sizeof(int) * (graph->nedges + 1));
+	graph->state = palloc0(sizeof(int) * Max(graph->nedges, 1));
+	graph->path = palloc(sizeof(int) * Max(graph->nedges, 1));
+	graph->nxids = 0;
+
+	for (i = 0; i < graph->nedges; i++)
+	{
+		if (i == 0 || graph->edges[i].waiter != graph->edges[i - 1].waiter)
+		{
+			graph->xids[graph->nxids] = graph->edges[i].waiter;
+			graph->first[graph->nxids] = i;
+			graph->nxids++;
+		}
+	}
+	graph->first[graph->nxids] = graph->nedges;
+}
+
+/* Index of the waiter "xid", -1 if it waits for nobody */
+static int
+wait_graph_vertex(WaitGraph *graph, TransactionId xid)
+{
+	int			lo = 0;
+	int			hi = graph->nxids - 1;
+
+	while (lo <= hi)
+	{
+		int			mid = (lo + hi) / 2;
+
+		if (graph->xids[mid] == xid)
+			return mid;
+		if (graph->xids[mid] < xid)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+
+	return -1;
+}
+
+/*
+ * Depth-first search of a cycle from "vertex".  When one is found, its
+ * edges are path[cycle .. depth - 1].
+ */
+static bool
+wait_graph_search(WaitGraph *graph, int vertex)
+{
+	int			e;
+
+	check_stack_depth();
+
+	graph->state[vertex] = WAIT_VERTEX_ON_PATH;
+	for (e = graph->first[vertex]; e < graph->first[vertex + 1]; e++)
+	{
+		int			next = wait_graph_vertex(graph, graph->edges[e].holder);
+
+		if (next < 0 || graph->state[next] == WAIT_VERTEX_DONE ||
+			graph->state[next] == WAIT_VERTEX_VICTIM)
+			continue;
+
+		graph->path[graph->depth++] = e;
+		if (graph->state[next] == WAIT_VERTEX_ON_PATH)
+		{
+			for (graph->cycle = 0;
+				 graph->edges[graph->path[graph->cycle]].waiter != graph->xids[next];
+				 graph->cycle++)
+				;
+			return true;
+		}
+		if (wait_graph_search(graph, next))
+			return true;
+		graph->depth--;
+	}
+	graph->state[vertex] = WAIT_VERTEX_DONE;
+
+	return false;
+}
+
+/* Cancel the newest transaction of the cycle found */
+static void
+wait_graph_break_cycle(WaitGraph *graph, PGconn **conns, NodeDefinition **defs)
+{
+	WaitEdge   *victim = NULL;
+	StringInfoData detail;
+	PGresult   *res;
+	char	   *query;
+	int			i;
+
+	initStringInfo(&detail);
+	for (i = graph->cycle; i < graph->depth; i++)
+	{
+		WaitEdge   *edge = &graph->edges[graph->path[i]];
+
+		if (victim == NULL || TransactionIdFollows(edge->waiter, victim->waiter))
+			victim = edge;
+		if (detail.len > 0)
+			appendStringInfoChar(&detail, '\n');
+		appendStringInfo(&detail,
+						 _("Transaction %u waits for transaction %u on node %s."),
+						 edge->waiter, edge->holder,
+						 NameStr(defs[edge->node]->nodename));
+	}
+
+	ereport(LOG,
+			(errmsg("deadlock detected across nodes, canceling transaction %u on node %s",
+					victim->waiter, NameStr(defs[victim->node]->nodename)),
+			 errdetail_log("%s", detail.data)));
+
+	query = psprintf("SELECT pg_catalog.pgxc_cancel_deadlock_victim(%d, '%u', '%u')",
+					 victim->pid, victim->waiter, victim->holder);
+	res = PQexec(conns[victim->node], query);
+	if (PQresultStatus(res) != PGRES_TUPLES_OK)
+		ereport(LOG,
+				(errmsg("could not cancel transaction %u on node %s",
+						victim->waiter, NameStr(defs[victim->node]->nodename)),
+				 errdetail_internal("%s", PQerrorMessage(conns[victim->node]))));
+	PQclear(res);
+
+	graph->state[wait_graph_vertex(graph, victim->waiter)] = WAIT_VERTEX_VICTIM;
+	pfree(query);
+	pfree(detail.data);
+}
+
+/*
+ * Add the waits of a Datanode to the graph.  Returns the connection to
+ * the node, or NULL if its waits could not be fetched.
+ */
+static PGconn *
+fetch_wait_edges(NodeDefinition *def, WaitGraph *graph, int node)
+{
+	char	   *connstr;
+	PGconn	   *conn;
+	PGresult   *res;
+	int			i;
+
+	connstr = PGXCNodeConnStr(NameStr(def->nodehost), def->nodeport,
+							  deadlock_dbname, deadlock_username,
+							  "", "datanode");
+	connstr = psprintf("%s connect_timeout=%d", connstr,
+					   GLOBAL_DEADLOCK_CONNECT_TIMEOUT);
+	conn = PQconnectdb(connstr);
+	if (PQstatus(conn) != CONNECTION_OK)
+	{
+		ereport(LOG,
+				(errmsg("could not connect to Datanode %s to check for deadlocks",
+						NameStr(def->nodename)),
+				 errdetail_internal("%s", PQerrorMessage(conn))));
+		PQfinish(conn);
+		return NULL;
+	}
+
+	res = PQexec(conn, "SELECT waiting_pid, waiting_xid, blocking_xid"
+				 " FROM pg_catalog.pg_lock_wait_edges()");
+	if (PQresultStatus(res) != PGRES_TUPLES_OK)
+	{
+		ereport(LOG,
+				(errmsg("could not fetch the lock waits of Datanode %s",
+						NameStr(def->nodename)),
+				 errdetail_internal("%s", PQerrorMessage(conn))));
+		PQclear(res);
+		PQfinish(conn);
+		return NULL;
+	}
+
+	for (i = 0; i < PQntuples(res); i++)
+		wait_graph_add(graph,
+					   (TransactionId) strtoul(PQgetvalue(res, i, 1), NULL, 10),
+					   (TransactionId) strtoul(PQgetvalue(res, i, 2), NULL, 10),
+					   atoi(PQgetvalue(res, i, 0)), node);
+	PQclear(res);
+
+	return conn;
+}
+
+/*
+ * GlobalDeadlockCheck
+ *
+ * Called by a Coordinator backend which waited for Datanodes during
+ * deadlock_timeout: unless another backend of this Coordinator checked in
+ * the last deadlock_timeout, look for deadlocks between the transactions
+ * waiting on the Datanodes, and cancel a victim in each.
+ */
+void
+GlobalDeadlockCheck(void)
+{
+	volatile GlobalDeadlockShared *shared = GlobalDeadlock;
+	TimestampTz now = GetCurrentTimestamp();
+	MemoryContext checkcontext;
+	MemoryContext oldcontext;
+	WaitGraph	graph;
+	Oid		   *dnOids;
+	int			numDns;
+	NodeDefinition **defs;
+	PGconn	  **volatile conns = NULL;
+	int			i;
+
+	if (!GlobalDeadlockCheckWanted())
+		return;
+
+	if (deadlock_username == NULL)
+	{
+		/* we may be aborting, with no way to look them up */
+		if (!IsTransactionState())
+			return;
+		deadlock_dbname = MemoryContextStrdup(TopMemoryContext,
+											  get_database_name(MyDatabaseId));
+		deadlock_username = MemoryContextStrdup(TopMemoryContext,
+								GetUserNameFromId(BOOTSTRAP_SUPERUSERID));
+	}
+
+	SpinLockAcquire(&shared->mutex);
+	if (!TimestampDifferenceExceeds(shared->last_check, now, DeadlockTimeout))
+	{
+		SpinLockRelease(&shared->mutex);
+		return;
+	}
+	shared->last_check = now;
+	SpinLockRelease(&shared->mutex);
+
+	checkcontext = AllocSetContextCreate(CurrentMemoryContext,
+										 "global deadlock check",
+										 ALLOCSET_DEFAULT_MINSIZE,
+										 ALLOCSET_DEFAULT_INITSIZE,
+										 ALLOCSET_DEFAULT_MAXSIZE);
+	oldcontext = MemoryContextSwitchTo(checkcontext);
+
+	memset(&graph, 0, sizeof(graph));
+	PgxcNodeGetOids(NULL, &dnOids, NULL, &numDns, false);
+	defs = (NodeDefinition **) palloc0(sizeof(NodeDefinition *) * Max(numDns, 1));
+	conns = (PGconn **) palloc0(sizeof(PGconn *) * Max(numDns, 1));
+
+	PG_TRY();
+	{
+		for (i = 0; i < numDns; i++)
+		{
+			defs[i] = PgxcNodeGetDefinition(dnOids[i]);
+			if (defs[i] != NULL)
+				conns[i] = fetch_wait_edges(defs[i], &graph, i);
+		}
+
+		wait_graph_build(&graph);
+		for (;;)
+		{
+			bool		found = false;
+
+			for (i = 0; i < graph.nxids; i++)
+			{
+				if (graph.state[i] != WAIT_VERTEX_VICTIM)
+					graph.state[i] = WAIT_VERTEX_NEW;
+			}
+			for (i = 0; i < graph.nxids && !found; i++)
+			{
+				graph.depth = 0;
+				if (graph.state[i] == WAIT_VERTEX_NEW)
+					found = wait_graph_search(&graph, i);
+			}
+			if (!found)
+				break;
+
+			wait_graph_break_cycle(&graph, conns, defs);
+		}
+	}
+	PG_CATCH();
+	{
+		for (i = 0; i < numDns; i++)
+		{
+			if (conns[i] != NULL)
+				PQfinish(conns[i]);
+		}
+		MemoryContextSwitchTo(oldcontext);
+		PG_RE_THROW();
+	}
+	PG_END_TRY();
+
+	for (i = 0; i < numDns; i++)
+	{
+		if (conns[i] != NULL)
+			PQfinish(conns[i]);
+	}
+
+	MemoryContextSwitchTo(oldcontext);
+	MemoryContextDelete(checkcontext);
+}
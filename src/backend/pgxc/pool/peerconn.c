@@ -0,0 +1,396 @@
+/*-------------------------------------------------------------------------
+ *
+ * peerconn.c
+ *
+ *	  Direct connections between Datanodes.
+ *
+ * Datanodes have no pooler, so a Datanode which needs rows of another one
+ * opens its own libpq session to it, as the current user and in read only
+ * mode. Such a session imports the global snapshot of the transaction using
+ * it, so it sees the rows that transaction sees, but for the changes the
+ * transaction made itself, which no other session can see. Callers take
+ * care of that.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/pgxc/pool/peerconn.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "../interfaces/libpq/libpq-fe.h"
+#include "catalog/pg_type.h"
+#include "commands/dbcommands.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "pgxc/peerconn.h"
+#include "pgxc/pgxc.h"
+#include "pgxc/pgxcnode.h"
+#include "storage/latch.h"
+#include "storage/proc.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/memutils.h"
+#include "utils/snapmgr.h"
+#include "utils/tuplestore.h"
+
+typedef struct MotionFetchState
+{
+	AttInMetadata  *attinmeta;
+	Tuplestorestate *tupstore;
+	MemoryContext	rowcontext;		/* reset after each row */
+} MotionFetchState;
+
+static int peer_conn_wait(PGconn *conn, int events);
+static void peer_conn_cancel(PGconn *conn);
+static void motion_fetch_row(char **values, int natts, void *arg);
+
+/*
+ * peer_conn_wait
+ * Wait for "events" on the socket of "conn", serving interrupts meanwhile,
+ * and return the events which fired.
+ */
+static int
+peer_conn_wait(PGconn *conn, int events)
+{
+	int			rc;
+
+	rc = WaitLatchOrSocket(&MyProc->procLatch,
+						   WL_LATCH_SET | WL_POSTMASTER_DEATH | events,
+						   PQsocket(conn), -1L);
+	if (rc & WL_POSTMASTER_DEATH)
+		ereport(FATAL,
+				(errcode(ERRCODE_ADMIN_SHUTDOWN),
+				 errmsg("terminating connection due to unexpected postmaster exit")));
+
+	ResetLatch(&MyProc->procLatch);
+	CHECK_FOR_INTERRUPTS();
+
+	return rc;
+}
+
+/*
+ * peer_conn_cancel
+ * Cancel the query running on "conn", so that the peer does not go on
+ * with it once the connection is gone
+ */
+static void
+peer_conn_cancel(PGconn *conn)
+{
+	PGcancel   *cancel = PQgetCancel(conn);
+	char		errbuf[256];
+
+	if (cancel)
+	{
+		if (!PQcancel(cancel, errbuf, sizeof(errbuf)))
+			ereport(WARNING,
+					(errmsg("could not cancel query on Datanode: %s", errbuf)));
+		PQfreeCancel(cancel);
+	}
+}
+
+/*
+ * PeerConnFetch
+ * Run "query" on the node at "host" and "port" under the active snapshot
+ * and give each row of its result to "callback". Rows come one at a time,
+ * so memory does not grow with their number.
+ *
+ * libpq is only used in non blocking mode, waiting on the process latch,
+ * so a peer which does not answer does not make the backend deaf to a
+ * cancel request.
+ */
+void
+PeerConnFetch(const char *host, int port, const char *query,
+			  PeerConnRowCallback callback, void *arg)
+{
+	char	   *connstr;
+	PGconn	   *conn;
+	StringInfoData command;
+	char	   *token;
+	bool		running = false;
+
+	/* The snapshot goes first, the query runs in the same transaction */
+	token = GlobalSnapshotToken(GetActiveSnapshot());
+	initStringInfo(&command);
+	appendStringInfo(&command,
+					 "BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY;"
+					 "SET TRANSACTION SNAPSHOT '%s';%s",
+					 token, query);
+	pfree(token);
+
+	/* Connect as a Datanode of the cluster, like the pooler does */
+	connstr = PGXCNodeConnStr((char *) host, port,
+							  get_database_name(MyDatabaseId),
+							  GetUserNameFromId(GetUserId()),
+							  "-c default_transaction_read_only=on",
+							  "datanode");
+	conn = PQconnectStart(connstr);
+	pfree(connstr);
+	if (conn == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("out of memory")));
+
+	PG_TRY();
+	{
+		PostgresPollingStatusType poll = PGRES_POLLING_WRITING;
+		PGresult   *res;
+		char	  **values = NULL;
+		int			natts = 0;
+		int			flush;
+
+		while (PQstatus(conn) != CONNECTION_BAD &&
+			   poll != PGRES_POLLING_OK && poll != PGRES_POLLING_FAILED)
+		{
+			(void) peer_conn_wait(conn, poll == PGRES_POLLING_READING ?
+									WL_SOCKET_READABLE : WL_SOCKET_WRITEABLE);
+			poll = PQconnectPoll(conn);
+		}
+		if (PQstatus(conn) != CONNECTION_OK)
+			ereport(ERROR,
+					(errcode(ERRCODE_CONNECTION_FAILURE),
+					 errmsg("could not connect to Datanode at %s:%d", host, port),
+					 errdetail_internal("%s", PQerrorMessage(conn))));
+
+		if (PQsetnonblocking(conn, 1) != 0 ||
+			!PQsendQuery(conn, command.data) || !PQsetSingleRowMode(conn))
+			ereport(ERROR,
+					(errcode(ERRCODE_CONNECTION_FAILURE),
+					 errmsg("could not send query to Datanode at %s:%d", host, port),
+					 errdetail_internal("%s", PQerrorMessage(conn))));
+		running = true;
+
+		/* The snapshot can make the command too long to go out at once */
+		while ((flush = PQflush(conn)) > 0)
+		{
+			if ((peer_conn_wait(conn, WL_SOCKET_READABLE | WL_SOCKET_WRITEABLE) &
+				 WL_SOCKET_READABLE) && !PQconsumeInput(conn))
+				break;
+		}
+		if (flush != 0)
+			ereport(ERROR,
+					(errcode(ERRCODE_CONNECTION_FAILURE),
+					 errmsg("could not send query to Datanode at %s:%d", host, port),
+					 errdetail_internal("%s", PQerrorMessage(conn))));
+
+		for (;;)
+		{
+			int			col;
+
+			while (PQisBusy(conn))
+			{
+				if ((peer_conn_wait(conn, WL_SOCKET_READABLE) & WL_SOCKET_READABLE) &&
+					!PQconsumeInput(conn))
+					ereport(ERROR,
+							(errcode(ERRCODE_CONNECTION_FAILURE),
+							 errmsg("could not fetch rows from Datanode at %s:%d", host, port),
+							 errdetail_internal("%s", PQerrorMessage(conn))));
+			}
+
+			if ((res = PQgetResult(conn)) == NULL)
+				break;
+
+			if (PQresultStatus(res) == PGRES_COMMAND_OK ||
+				PQresultStatus(res) == PGRES_TUPLES_OK)
+			{
+				PQclear(res);
+				continue;
+			}
+			if (PQresultStatus(res) != PGRES_SINGLE_TUPLE)
+			{
+				char *msg = pstrdup(PQresultErrorMessage(res));
+
+				PQclear(res);
+				ereport(ERROR,
+						(errcode(ERRCODE_CONNECTION_FAILURE),
+						 errmsg("could not fetch rows from Datanode at %s:%d", host, port),
+						 errdetail_internal("%s", msg)));
+			}
+
+			if (values == NULL)
+			{
+				natts = PQnfields(res);
+				values = (char **) palloc(sizeof(char *) * (natts > 0 ? natts : 1));
+			}
+			for (col = 0; col < natts; col++)
+				values[col] = PQgetisnull(res, 0, col) ? NULL : PQgetvalue(res, 0, col);
+
+			PG_TRY();
+			{
+				(*callback) (values, natts, arg);
+			}
+			PG_CATCH();
+			{
+				PQclear(res);
+				PG_RE_THROW();
+			}
+			PG_END_TRY();
+
+			PQclear(res);
+		}
+		running = false;
+
+		if (values)
+			pfree(values);
+	}
+	PG_CATCH();
+	{
+		if (running)
+			peer_conn_cancel(conn);
+		PQfinish(conn);
+		PG_RE_THROW();
+	}
+	PG_END_TRY();
+
+	PQfinish(conn);
+	pfree(command.data);
+}
+
+/*
+ * motion_fetch_row
+ * Store a row fetched by pgxc_motion_fetch
+ */
+static void
+motion_fetch_row(char **values, int natts, void *arg)
+{
+	MotionFetchState *state = (MotionFetchState *) arg;
+	MemoryContext oldcontext;
+
+	if (natts != state->attinmeta->tupdesc->natts)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATATYPE_MISMATCH),
+				 errmsg("remote query result rowtype does not match the specified FROM clause rowtype")));
+
+	/* The tuplestore copies the tuple in its own context */
+	oldcontext = MemoryContextSwitchTo(state->rowcontext);
+	tuplestore_puttuple(state->tupstore,
+						BuildTupleFromCStrings(state->attinmeta, values));
+	MemoryContextSwitchTo(oldcontext);
+	MemoryContextReset(state->rowcontext);
+}
+
+/*
+ * pgxc_motion_fetch
+ * Return the rows of "query" run on the nodes at "hosts" and "ports", which
+ * are sent directly to this Datanode instead of going through the
+ * Coordinator.
+ *
+ * With a positive "keyno", the rows are redistributed: only the rows whose
+ * column "keyno" goes to this node, among "nodes" distributed with
+ * "locator", are returned. Otherwise all the rows are returned, the result
+ * being broadcast to every Datanode running this function.
+ */
+Datum
+pgxc_motion_fetch(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	char	   *query = text_to_cstring(PG_GETARG_TEXT_PP(0));
+	int32		keyno = PG_GETARG_INT32(1);
+	char		locator = PG_GETARG_CHAR(2);
+	ArrayType  *nodeArray = PG_GETARG_ARRAYTYPE_P(3);
+	ArrayType  *hostArray = PG_GETARG_ARRAYTYPE_P(4);
+	ArrayType  *portArray = PG_GETARG_ARRAYTYPE_P(5);
+	Datum	   *nodes, *hosts, *ports;
+	int			numNodes, numHosts, numPorts;
+	MotionFetchState state;
+	TupleDesc	tupdesc;
+	MemoryContext per_query_ctx;
+	MemoryContext oldcontext;
+	StringInfoData buf;
+	int			i;
+
+	/* check to see if caller supports us returning a tuplestore */
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize) || rsinfo->expectedDesc == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not " \
+						"allowed in this context")));
+
+	if (!IS_PGXC_DATANODE)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("pgxc_motion_fetch can only run on a Datanode")));
+
+	deconstruct_array(nodeArray, TEXTOID, -1, false, 'i',
+					  &nodes, NULL, &numNodes);
+	deconstruct_array(hostArray, TEXTOID, -1, false, 'i',
+					  &hosts, NULL, &numHosts);
+	deconstruct_array(portArray, INT4OID, sizeof(int32), true, 'i',
+					  &ports, NULL, &numPorts);
+	if (numHosts != numPorts)
+		ereport(ERROR,
+				(errcode(ERRCODE_ARRAY_SUBSCRIPT_ERROR),
+				 errmsg("mismatched array dimensions")));
+
+	initStringInfo(&buf);
+	tupdesc = rsinfo->expectedDesc;
+	appendStringInfo(&buf, "SELECT * FROM (%s) m(", query);
+	for (i = 0; i < tupdesc->natts; i++)
+		appendStringInfo(&buf, i == 0 ? "c%d" : ", c%d", i + 1);
+	appendStringInfoChar(&buf, ')');
+
+	if (keyno > 0)
+	{
+		int			position = -1;
+
+		if (keyno > tupdesc->natts)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("invalid column number %d", keyno)));
+
+		for (i = 0; i < numNodes && position < 0; i++)
+		{
+			char *name = TextDatumGetCString(nodes[i]);
+
+			if (strcmp(name, PGXCNodeName) == 0)
+				position = i;
+			pfree(name);
+		}
+		if (position < 0)
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("node \"%s\" does not receive redistributed rows", PGXCNodeName)));
+
+		/* Rows with a NULL key are left out, they cannot be joined */
+		appendStringInfo(&buf,
+						 " WHERE pg_catalog.pgxc_node_index_of(m.c%d, '%c', %d) = %d",
+						 keyno, locator, numNodes, position);
+	}
+
+	per_query_ctx = rsinfo->econtext->ecxt_per_query_memory;
+	oldcontext = MemoryContextSwitchTo(per_query_ctx);
+	tupdesc = CreateTupleDescCopy(rsinfo->expectedDesc);
+	state.attinmeta = TupleDescGetAttInMetadata(tupdesc);
+	state.tupstore = tuplestore_begin_heap(true, false, work_mem);
+	MemoryContextSwitchTo(oldcontext);
+	state.rowcontext = AllocSetContextCreate(CurrentMemoryContext,
+											 "motion fetch row",
+											 ALLOCSET_SMALL_MINSIZE,
+											 ALLOCSET_SMALL_INITSIZE,
+											 ALLOCSET_SMALL_MAXSIZE);
+
+	for (i = 0; i < numHosts; i++)
+	{
+		char *host = TextDatumGetCString(hosts[i]);
+
+		PeerConnFetch(host, DatumGetInt32(ports[i]), buf.data,
+					  motion_fetch_row, &state);
+		pfree(host);
+	}
+
+	MemoryContextDelete(state.rowcontext);
+
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = state.tupstore;
+	rsinfo->setDesc = tupdesc;
+
+	pfree(buf.data);
+
+	return (Datum) 0;
+}
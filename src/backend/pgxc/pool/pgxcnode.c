@@ -17,6 +17,7 @@
  */
 
 #include "postgres.h"
+#include <poll.h>
 #include <sys/select.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -30,6 +31,7 @@
 #include "access/xact.h"
 #include "catalog/pg_type.h"
 #include "commands/prepare.h"
+#include "funcapi.h"
 #ifdef ADB
 #include "miscadmin.h" /* fro CHECK_FOR_INTERRUPTS */
 #include "agtm/agtm.h"
@@ -38,6 +40,7 @@
 #include "nodes/nodes.h"
 #include "pgxc/pgxcnode.h"
 #include "pgxc/execRemote.h"
+#include "pgxc/globaldeadlock.h"
 #include "catalog/pgxc_node.h"
 #include "catalog/pg_collation.h"
 #include "pgxc/locator.h"
@@ -45,6 +48,9 @@
 #include "pgxc/pgxc.h"
 #include "pgxc/poolmgr.h"
 #include "storage/fd.h"
+#include "storage/ipc.h"
+#include "storage/latch.h"
+#include "storage/proc.h"
 #include "tcop/dest.h"
 #include "utils/builtins.h"
 #include "utils/elog.h"
@@ -54,9 +60,13 @@
 #include "utils/syscache.h"
 #include "utils/lsyscache.h"
 #include "utils/formatting.h"
+#include "utils/pg_lzcompress.h"
 #include "../interfaces/libpq/libpq-fe.h"
 #ifdef ADB
+#include "pg_trace.h"
+#include "pgstat.h"
 #include "pgxc/pause.h"
+#include "utils/waitevent.h"
 #endif
 
 #define CMD_ID_MSG_LEN 8
@@ -80,6 +90,21 @@ static PGXCNodeHandle *dn_handles = NULL;
  */
 static PGXCNodeHandle *co_handles = NULL;
 
+#ifdef ADB
+/*
+ * Position of each node in dn_handles or co_handles by node OID, so that
+ * PGXCNodeGetNodeId() does not need to scan them.
+ */
+typedef struct PGXCNodeIdEntry
+{
+	Oid			nodeoid;		/* hash key, must be first */
+	char		node_type;
+	int			nodeid;
+} PGXCNodeIdEntry;
+
+static HTAB *node_id_hash = NULL;
+#endif
+
 /* Current size of dn_handles and co_handles */
 volatile int NumDataNodes;
 volatile int NumCoords;
@@ -93,6 +118,45 @@ extern int	MyProcPid;
 static void pgxc_node_init(PGXCNodeHandle *handle, int sock);
 static void pgxc_node_free(PGXCNodeHandle *handle);
 static void pgxc_node_all_free(void);
+#ifdef ADB
+static void pgxc_node_release_load(int code, Datum arg);
+static bool pgxc_slave_read_xact(void);
+static void release_slave_read_handles(void);
+static void pgxc_node_build_id_hash(void);
+static void uncompress_message_block(PGXCNodeHandle *conn, char *block, int len);
+#endif
+
+#ifdef HAVE_SYS_EPOLL_H
+/*
+ * Datanode connections are waited on through a WaitEventSet kept for the
+ * life of the backend instead of building a descriptor set on every call.
+ * A socket stays in the set once added; it is waited on for reading when
+ * pgxc_node_receive wants its input, and disarmed the first time it is
+ * reported to a call not waiting on it, so that sockets of connections which
+ * are not being waited on cost nothing in the wait.  Rearming a socket which
+ * has unread data reports it again right away.
+ */
+#define PGXC_WAIT_UNREGISTERED	0	/* not in the set */
+#define PGXC_WAIT_ARMED			1	/* waiting for input */
+#define PGXC_WAIT_DISARMED		2	/* in the set, not waited on */
+#define PGXC_WAIT_FIRED			3	/* reported by the last wait */
+
+#define PGXC_WAIT_MAX_EVENTS	64
+
+typedef struct PGXCWaitSock
+{
+	int			pos;			/* position in pgxc_wait_set */
+	uint8		state;			/* PGXC_WAIT_XXX */
+} PGXCWaitSock;
+
+static WaitEventSet *pgxc_wait_set = NULL;
+static PGXCWaitSock *pgxc_wait_socks = NULL;	/* indexed by socket descriptor */
+static int	pgxc_wait_socks_size = 0;
+
+static PGXCWaitSock *pgxc_wait_sock(int sock);
+static void pgxc_wait_arm(int sock);
+static void pgxc_wait_forget(int sock);
+#endif /* HAVE_SYS_EPOLL_H */
 
 static int	get_int(PGXCNodeHandle * conn, size_t len, int *out);
 static int	get_char(PGXCNodeHandle * conn, char *out);
@@ -156,6 +220,19 @@ InitMultinodeExecutor(bool is_force)
 		co_handles != NULL)
 		return;
 
+#ifdef ADB
+	/* Connections still held when the backend exits are no load any more */
+	{
+		static bool load_callback_registered = false;
+
+		if (!load_callback_registered)
+		{
+			on_shmem_exit(pgxc_node_release_load, 0);
+			load_callback_registered = true;
+		}
+	}
+#endif
+
 	/* Update node table in the shared memory */
 	PgxcNodeListAndCount();
 
@@ -209,6 +286,8 @@ InitMultinodeExecutor(bool is_force)
 		pfree(coOids);
 	if (dnOids)
 		pfree(dnOids);
+
+	pgxc_node_build_id_hash();
 #endif
 
 	datanode_count = 0;
@@ -357,10 +436,21 @@ PGXCNodeConnected(NODE_CONNECTION *conn)
 static void
 pgxc_node_free(PGXCNodeHandle *handle)
 {
+#ifdef ADB
+	if (handle->sock != NO_SOCKET && handle->type == PGXC_NODE_DATANODE)
+		PgxcNodeAddLoad(handle->nodeoid, -1);
+#endif
+#ifdef HAVE_SYS_EPOLL_H
+	pgxc_wait_forget(handle->sock);
+#endif
 	close(handle->sock);
 	handle->sock = NO_SOCKET;
 	handle->state = DN_CONNECTION_STATE_IDLE;
 	handle->combiner = NULL;
+#ifdef ADB
+	handle->sync_pending = false;
+	handle->portal_suspended = false;
+#endif
 	FreeHandleError(handle);
 	if(handle->file_data)
 	{
@@ -400,7 +490,133 @@ pgxc_node_all_free(void)
 		pfree(co_handles);
 		co_handles = NULL;
 	}
+#ifdef ADB
+	if (node_id_hash)
+	{
+		hash_destroy(node_id_hash);
+		node_id_hash = NULL;
+	}
+#endif
+}
+
+#ifdef ADB
+/*
+ * Build node_id_hash from the handles just set up.
+ */
+static void
+pgxc_node_build_id_hash(void)
+{
+	HASHCTL		ctl;
+	PGXCNodeIdEntry *entry;
+	bool		found;
+	int			i;
+
+	if (node_id_hash)
+		hash_destroy(node_id_hash);
+
+	MemSet(&ctl, 0, sizeof(ctl));
+	ctl.keysize = sizeof(Oid);
+	ctl.entrysize = sizeof(PGXCNodeIdEntry);
+	ctl.hash = oid_hash;
+	ctl.hcxt = TopMemoryContext;
+	node_id_hash = hash_create("PGXC node ids",
+							   Max(NumDataNodes + NumCoords, 16),
+							   &ctl,
+							   HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+
+	for (i = 0; i < NumDataNodes; i++)
+	{
+		entry = (PGXCNodeIdEntry *) hash_search(node_id_hash,
+												&dn_handles[i].nodeoid,
+												HASH_ENTER, &found);
+		entry->node_type = PGXC_NODE_DATANODE;
+		entry->nodeid = i;
+	}
+	for (i = 0; i < NumCoords; i++)
+	{
+		entry = (PGXCNodeIdEntry *) hash_search(node_id_hash,
+												&co_handles[i].nodeoid,
+												HASH_ENTER, &found);
+		entry->node_type = PGXC_NODE_COORDINATOR;
+		entry->nodeid = i;
+	}
+}
+
+/*
+ * Stop counting the Datanode connections of an exiting backend.
+ */
+static void
+pgxc_node_release_load(int code, Datum arg)
+{
+	int			i;
+
+	if (dn_handles == NULL)
+		return;
+
+	for (i = 0; i < NumDataNodes; i++)
+	{
+		if (dn_handles[i].sock != NO_SOCKET)
+			PgxcNodeAddLoad(dn_handles[i].nodeoid, -1);
+	}
+}
+
+/*
+ * May the current transaction read from the hot standby slaves of the
+ * Datanodes?  Decided when it first gets connections: a transaction which
+ * wrote before turning read-only must keep reading its own writes.
+ */
+static bool
+pgxc_slave_read_xact(void)
+{
+	static LocalTransactionId decided_lxid = InvalidLocalTransactionId;
+	static bool slave_read = false;
+
+	if (MyProc == NULL || MyProc->lxid != decided_lxid)
+	{
+		decided_lxid = MyProc ? MyProc->lxid : InvalidLocalTransactionId;
+		slave_read = EnableDatanodeSlaveRead &&
+					 IS_PGXC_COORDINATOR && !IsConnFromCoord() &&
+					 IsTransactionState() && XactReadOnly &&
+					 !PersistentConnections;
+	}
+	return slave_read;
+}
+
+/*
+ * Connections may be kept from a transaction which read from slaves when
+ * Datanode statements are active.  Drop them before a transaction which
+ * may write, the statements are prepared again on the new connections.
+ */
+static void
+release_slave_read_handles(void)
+{
+	int			i;
+
+	for (i = 0; i < NumDataNodes; i++)
+	{
+		if (dn_handles[i].sock != NO_SOCKET && dn_handles[i].slave_read)
+			break;
+	}
+	if (i >= NumDataNodes)
+		return;
+
+	DeactivateDatanodeStatements();
+	for (i = 0; i < NumDataNodes; i++)
+	{
+		if (dn_handles[i].sock != NO_SOCKET)
+			pgxc_node_free(&dn_handles[i]);
+	}
+	for (i = 0; i < NumCoords; i++)
+	{
+		if (co_handles[i].sock != NO_SOCKET)
+			pgxc_node_free(&co_handles[i]);
+	}
+	PoolManagerReleaseConnections(true);
+
+	datanode_count = 0;
+	coord_count = 0;
 }
+#endif
 
 /*
  * Create and initialise internal structure to communicate to
@@ -411,11 +627,22 @@ static void
 pgxc_node_init(PGXCNodeHandle *handle, int sock)
 {
 	handle->sock = sock;
+#ifdef ADB
+	if (handle->type == PGXC_NODE_DATANODE)
+		PgxcNodeAddLoad(handle->nodeoid, 1);
+#endif
 	handle->transaction_status = 'I';
 	handle->state = DN_CONNECTION_STATE_IDLE;
 	handle->combiner = NULL;
 #ifdef DN_CONNECTION_DEBUG
 	handle->have_row_desc = false;
+#endif
+#ifdef ADB
+	handle->sync_pending = false;
+	handle->portal_suspended = false;
+	MemSet(&handle->traffic, 0, sizeof(handle->traffic));
+	handle->awaiting_answer = false;
+	handle->slave_read = false;
 #endif
 	handle->error = NULL;
 	handle->outEnd = 0;
@@ -428,8 +655,89 @@ pgxc_node_init(PGXCNodeHandle *handle, int sock)
 		sprintf(file_name, "%06d-%06d.bin", MyProcPid, sock);
 		handle->file_data = AllocateFile(file_name, "wb");
 	}
+#ifdef HAVE_SYS_EPOLL_H
+	/* a descriptor closed behind our back may have had its number reused */
+	pgxc_wait_forget(sock);
+#endif
 }
 
+#ifdef HAVE_SYS_EPOLL_H
+/*
+ * Return the wait state of the socket, enlarging the array if needed.
+ */
+static PGXCWaitSock *
+pgxc_wait_sock(int sock)
+{
+	Assert(sock >= 0);
+
+	if (sock >= pgxc_wait_socks_size)
+	{
+		int		newsize = Max(pgxc_wait_socks_size * 2, 256);
+		int		i;
+
+		while (newsize <= sock)
+			newsize *= 2;
+
+		if (pgxc_wait_socks == NULL)
+			pgxc_wait_socks = (PGXCWaitSock *)
+				MemoryContextAlloc(TopMemoryContext,
+								   sizeof(PGXCWaitSock) * newsize);
+		else
+			pgxc_wait_socks = (PGXCWaitSock *)
+				repalloc(pgxc_wait_socks, sizeof(PGXCWaitSock) * newsize);
+		for (i = pgxc_wait_socks_size; i < newsize; i++)
+		{
+			pgxc_wait_socks[i].pos = -1;
+			pgxc_wait_socks[i].state = PGXC_WAIT_UNREGISTERED;
+		}
+		pgxc_wait_socks_size = newsize;
+	}
+
+	return &pgxc_wait_socks[sock];
+}
+
+/*
+ * Make sure the socket is in the wait set and armed.
+ */
+static void
+pgxc_wait_arm(int sock)
+{
+	PGXCWaitSock *ws = pgxc_wait_sock(sock);
+
+	if (pgxc_wait_set == NULL)
+		pgxc_wait_set = CreateWaitEventSet(TopMemoryContext,
+										   PGXC_WAIT_MAX_EVENTS);
+
+	if (ws->state == PGXC_WAIT_UNREGISTERED)
+		ws->pos = AddWaitEventToSet(pgxc_wait_set, WL_SOCKET_READABLE,
+									sock, NULL, NULL);
+	else if (ws->state == PGXC_WAIT_DISARMED)
+		ModifyWaitEvent(pgxc_wait_set, ws->pos, WL_SOCKET_READABLE);
+	ws->state = PGXC_WAIT_ARMED;
+}
+
+/*
+ * Take the socket out of the wait set, before it is closed or if its number
+ * got reused.
+ */
+static void
+pgxc_wait_forget(int sock)
+{
+	PGXCWaitSock *ws;
+
+	if (sock < 0 || sock >= pgxc_wait_socks_size)
+		return;
+
+	ws = &pgxc_wait_socks[sock];
+	if (ws->state != PGXC_WAIT_UNREGISTERED)
+	{
+		RemoveWaitEventFromSet(pgxc_wait_set, ws->pos);
+		ws->pos = -1;
+		ws->state = PGXC_WAIT_UNREGISTERED;
+	}
+}
+#endif /* HAVE_SYS_EPOLL_H */
+
 
 /*
  * Wait while at least one of specified connections has data available and read
@@ -441,11 +749,151 @@ pgxc_node_receive(const int conn_count,
 {
 #define ERROR_OCCURED		true
 #define NO_ERROR_OCCURED	false
+#ifdef HAVE_SYS_EPOLL_H
+	WaitSetEvent events[PGXC_WAIT_MAX_EVENTS];
+	int			i,
+				nevents,
+				nwait = 0;
+	bool		is_msg_buffered;
+	bool		read_failed = false;
+	bool		check_deadlock;
+
+	is_msg_buffered = false;
+	for (i = 0; i < conn_count; i++)
+	{
+		PGXCNodeHandle *conn = connections[i];
+
+		/* If connection has a buffered message */
+		if (HAS_MESSAGE_BUFFERED(conn))
+		{
+			is_msg_buffered = true;
+			continue;
+		}
+
+		/* If connection finished sending do not wait input from it */
+		if (conn->state == DN_CONNECTION_STATE_IDLE)
+			continue;
+
+		if (conn->sock > 0)
+		{
+			pgxc_wait_arm(conn->sock);
+			nwait++;
+		}
+		else
+		{
+			/* flag as bad, it will be removed from the list */
+			conn->state = DN_CONNECTION_STATE_ERROR_FATAL;
+		}
+	}
+
+	/*
+	 * Return if we do not have connections to receive input
+	 */
+	if (nwait == 0)
+	{
+		if (is_msg_buffered)
+			return NO_ERROR_OCCURED;
+		return ERROR_OCCURED;
+	}
+
+	/*
+	 * A buffered message is going to be processed anyway, only pick up what
+	 * has already arrived on the others.
+	 */
+	TRACE_POSTGRESQL_REMOTE_RECEIVE_START(nwait);
+	if (!is_msg_buffered)
+		pgstat_report_wait_start(WAIT_EVENT_REMOTE_RECEIVE);
+	for (;;)
+	{
+		/*
+		 * A transaction waiting for the nodes with no end may be deadlocked
+		 * across them, look for that every deadlock_timeout.
+		 */
+		check_deadlock = (!is_msg_buffered && timeout == NULL &&
+						  GlobalDeadlockCheckWanted());
+		nevents = WaitEventSetWait(pgxc_wait_set,
+								   is_msg_buffered ? 0L :
+								   check_deadlock ? (long) DeadlockTimeout :
+								   timeout ? timeout->tv_sec * 1000L + timeout->tv_usec / 1000 : -1L,
+								   events, PGXC_WAIT_MAX_EVENTS);
+		if (nevents != 0 || !check_deadlock)
+			break;
+		GlobalDeadlockCheck();
+	}
+	if (!is_msg_buffered)
+		pgstat_report_wait_end();
+	TRACE_POSTGRESQL_REMOTE_RECEIVE_DONE(nwait, nevents);
+
+	if (nevents == 0)
+	{
+		if (is_msg_buffered)
+			return NO_ERROR_OCCURED;
+		/* Handle timeout */
+		elog(WARNING, "timeout while waiting for response");
+		return ERROR_OCCURED;
+	}
+
+	for (i = 0; i < nevents; i++)
+		pgxc_wait_sock(events[i].fd)->state = PGXC_WAIT_FIRED;
+
+	/* read data */
+	for (i = 0; i < conn_count; i++)
+	{
+		PGXCNodeHandle *conn = connections[i];
+
+		if (conn->sock > 0 && conn->sock < pgxc_wait_socks_size &&
+			pgxc_wait_socks[conn->sock].state == PGXC_WAIT_FIRED)
+		{
+			int	read_status;
+
+			pgxc_wait_socks[conn->sock].state = PGXC_WAIT_ARMED;
+			read_status = pgxc_node_read_data(conn, true);
+			if (read_status == EOF || read_status < 0)
+			{
+				/* Can not read - no more actions, just discard connection */
+				conn->state = DN_CONNECTION_STATE_ERROR_FATAL;
+				add_error_message(conn,
+					"unexpected EOF on datanode %s's connection", NameStr(conn->name));
+				elog(WARNING,
+					"unexpected EOF on datanode %s's connection", NameStr(conn->name));
+				read_failed = true;
+				break;
+			}
+		}
+	}
+
+	/*
+	 * Sockets reported but not waited on by this call are disarmed, somebody
+	 * waiting on them later rearms them and is told again of unread data.
+	 */
+	for (i = 0; i < nevents; i++)
+	{
+		PGXCWaitSock *ws = pgxc_wait_sock(events[i].fd);
+
+		if (ws->state == PGXC_WAIT_FIRED)
+		{
+			ModifyWaitEvent(pgxc_wait_set, ws->pos, 0);
+			ws->state = PGXC_WAIT_DISARMED;
+		}
+	}
+
+	/* let pg_stat_activity follow a query dragging data from the nodes */
+	pgstat_report_remote_traffic();
+
+	if (read_failed)
+		return ERROR_OCCURED;
+	return NO_ERROR_OCCURED;
+#else
 	int			i,
 				res_select,
 				nfds = 0;
 	fd_set			readfds;
 	bool			is_msg_buffered;
+#ifdef ADB
+	fd_set			waitfds;
+	struct timeval	deadlock_tv;
+	bool			check_deadlock;
+#endif
 
 	FD_ZERO(&readfds);
 
@@ -489,8 +937,31 @@ pgxc_node_receive(const int conn_count,
 		return ERROR_OCCURED;
 	}
 
+#ifdef ADB
+	waitfds = readfds;
+#endif
 retry:
+#ifdef ADB
+	/* as above, look for deadlocks across nodes every deadlock_timeout */
+	readfds = waitfds;
+	check_deadlock = (!is_msg_buffered && timeout == NULL &&
+					  GlobalDeadlockCheckWanted());
+	deadlock_tv.tv_sec = DeadlockTimeout / 1000;
+	deadlock_tv.tv_usec = (DeadlockTimeout % 1000) * 1000;
+	TRACE_POSTGRESQL_REMOTE_RECEIVE_START(conn_count);
+	pgstat_report_wait_start(WAIT_EVENT_REMOTE_RECEIVE);
+	res_select = select(nfds + 1, &readfds, NULL, NULL,
+						check_deadlock ? &deadlock_tv : timeout);
+	pgstat_report_wait_end();
+	TRACE_POSTGRESQL_REMOTE_RECEIVE_DONE(conn_count, res_select);
+	if (res_select == 0 && check_deadlock)
+	{
+		GlobalDeadlockCheck();
+		goto retry;
+	}
+#else
 	res_select = select(nfds + 1, &readfds, NULL, NULL, timeout);
+#endif
 	if (res_select < 0)
 	{
 		/* error - retry if EINTR or EAGAIN */
@@ -536,7 +1007,11 @@ retry:
 			}
 		}
 	}
+#ifdef ADB
+	pgstat_report_remote_traffic();
+#endif
 	return NO_ERROR_OCCURED;
+#endif /* HAVE_SYS_EPOLL_H */
 }
 
 /*
@@ -652,6 +1127,9 @@ retry:
 					NameStr(conn->name));
 				conn->state = DN_CONNECTION_STATE_ERROR_FATAL;	/* No more connection to
 															* backend */
+#ifdef HAVE_SYS_EPOLL_H
+				pgxc_wait_forget(conn->sock);
+#endif
 				closesocket(conn->sock);
 				conn->sock = NO_SOCKET;
 			}
@@ -665,6 +1143,9 @@ retry:
 
 			conn->state = DN_CONNECTION_STATE_ERROR_FATAL;	/* No more connection to
 															* backend */
+#ifdef HAVE_SYS_EPOLL_H
+			pgxc_wait_forget(conn->sock);
+#endif
 			closesocket(conn->sock);
 			conn->sock = NO_SOCKET;
 		}
@@ -682,6 +1163,16 @@ retry:
 			fwrite(conn->inBuffer+conn->inEnd, 1, nread, conn->file_data);
 		}
 		conn->inEnd += nread;
+#ifdef ADB
+		conn->traffic.bytes_received += nread;
+		pgBufferUsage.remote_bytes_received += nread;
+		if (conn->awaiting_answer)
+		{
+			conn->traffic.round_trips++;
+			pgBufferUsage.remote_round_trips++;
+			conn->awaiting_answer = false;
+		}
+#endif
 
 		/*
 		 * Hack to deal with the fact that some kernels will only give us back
@@ -711,6 +1202,9 @@ retry:
 			elog(DEBUG1, "nread returned 0");
 			conn->state = DN_CONNECTION_STATE_ERROR_FATAL;	/* No more connection to
 															* backend */
+#ifdef HAVE_SYS_EPOLL_H
+			pgxc_wait_forget(conn->sock);
+#endif
 			closesocket(conn->sock);
 			conn->sock = NO_SOCKET;
 		}
@@ -818,10 +1312,70 @@ get_message(PGXCNodeHandle *conn, int *len, char **msg)
 
 	*msg = conn->inBuffer + conn->inCursor;
 	conn->inCursor += *len;
+#ifdef ADB
+	if (msgtype == 'z')
+	{
+		uncompress_message_block(conn, *msg, *len);
+		return get_message(conn, len, msg);
+	}
+	conn->traffic.msgs_received++;
+	pgBufferUsage.remote_msgs_received++;
+#endif
 	conn->inStart = conn->inCursor;
 	return msgtype;
 }
 
+#ifdef ADB
+/*
+ * uncompress_message_block
+ * Put the messages of a 'z' message back in the buffer in place of it. The
+ * 'z' message starts at conn->inStart and its data, "block" of "len" bytes,
+ * are the uncompressed size of the messages and their pglz compressed form.
+ * See internal_put_compressed() for the sending side.
+ */
+static void
+uncompress_message_block(PGXCNodeHandle *conn, char *block, int len)
+{
+	uint32		rawsize;
+	uint32		n32;
+	size_t		start = conn->inStart;
+	size_t		rest = conn->inEnd - conn->inCursor;
+	PGLZ_Header *source;
+	char	   *raw;
+
+	if (len < 4)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg("invalid compressed message from node %s",
+						NameStr(conn->name))));
+
+	memcpy(&n32, block, 4);
+	rawsize = ntohl(n32);
+
+	source = (PGLZ_Header *) palloc(sizeof(PGLZ_Header) + len - 4);
+	SET_VARSIZE_COMPRESSED(source, sizeof(PGLZ_Header) + len - 4);
+	source->rawsize = rawsize;
+	memcpy((char *) source + sizeof(PGLZ_Header), block + 4, len - 4);
+	raw = palloc(rawsize);
+	pglz_decompress(source, raw);
+	pfree(source);
+
+	/* The buffer may move, only offsets are used from now on */
+	if (ensure_in_buffer_capacity(start + rawsize + rest, conn) != 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("out of memory")));
+
+	memmove(conn->inBuffer + start + rawsize,
+			conn->inBuffer + conn->inCursor, rest);
+	memcpy(conn->inBuffer + start, raw, rawsize);
+	pfree(raw);
+
+	conn->inEnd = start + rawsize + rest;
+	conn->inCursor = start;
+}
+#endif
+
 /*
  * Release all Datanode and Coordinator connections
  * back to pool and release occupied memory
@@ -837,7 +1391,10 @@ void release_handles2(bool force_close)
 #endif /* ADB */
 	int			i;
 #ifdef ADB
-	bool has_error = false;
+	int			dn_discard[NumDataNodes];
+	int			co_discard[NumCoords];
+	int			dn_discard_count = 0;
+	int			co_discard_count = 0;
 #endif /* ADB */
 #ifdef ADB
         /* don't free connection if holding a cluster lock */
@@ -863,7 +1420,8 @@ void release_handles2(bool force_close)
 			if (handle->state != DN_CONNECTION_STATE_IDLE)
 #ifdef ADB
 			{
-				has_error = true;
+				dn_discard[dn_discard_count++] =
+					PGXCNodeGetNodeId(handle->nodeoid, PGXC_NODE_DATANODE);
 #endif /* ADB */
 				elog(DEBUG1,
 					"Connection to Datanode %s has unexpected state %d and will be dropped",
@@ -885,7 +1443,8 @@ void release_handles2(bool force_close)
 			if (handle->state != DN_CONNECTION_STATE_IDLE)
 #ifdef ADB
 			{
-				has_error = true;
+				co_discard[co_discard_count++] =
+					PGXCNodeGetNodeId(handle->nodeoid, PGXC_NODE_COORDINATOR);
 #endif /* ADB */
 				elog(DEBUG1,
 					"Connection to Coordinator %s has unexpected state %d and will be dropped",
@@ -897,9 +1456,16 @@ void release_handles2(bool force_close)
 		}
 	}
 
-	/* And finally release all the connections on pooler */
+	/*
+	 * And finally release all the connections on pooler, which cancels and
+	 * closes the ones in an unexpected state without making us wait.
+	 */
 #ifdef ADB
-	PoolManagerReleaseConnections(force_close || has_error);
+	if (force_close)
+		PoolManagerReleaseConnections(true);
+	else
+		PoolManagerDiscardConnections(dn_discard_count, dn_discard,
+									  co_discard_count, co_discard);
 #else
 	PoolManagerReleaseConnections();
 #endif
@@ -919,6 +1485,10 @@ cancel_query(void)
 	int			co_cancel[NumCoords];
 	int			dn_count = 0;
 	int			co_count = 0;
+#ifdef ADB
+	PGXCNodeHandle *drain[NumDataNodes + NumCoords];
+	int			drain_count = 0;
+#endif
 
 	if (datanode_count == 0 && coord_count == 0)
 		return;
@@ -975,6 +1545,22 @@ cancel_query(void)
 	 * Read responses from the nodes to whom we sent the cancel command. This
 	 * ensures that there are no pending messages left on the connection
 	 */
+#ifdef ADB
+	for (i = 0; i < NumDataNodes; i++)
+	{
+		if (dn_handles[i].sock != NO_SOCKET &&
+			dn_handles[i].state != DN_CONNECTION_STATE_IDLE)
+			drain[drain_count++] = &dn_handles[i];
+	}
+	for (i = 0; i < NumCoords; i++)
+	{
+		if (co_handles[i].sock != NO_SOCKET &&
+			co_handles[i].state != DN_CONNECTION_STATE_IDLE)
+			drain[drain_count++] = &co_handles[i];
+	}
+	/* the ones left fatal are dropped by release_handles */
+	pgxc_node_flush_read_all(drain_count, drain);
+#else
 	for (i = 0; i < NumDataNodes; i++)
 	{
 		PGXCNodeHandle *handle = &dn_handles[i];
@@ -996,6 +1582,7 @@ cancel_query(void)
 			handle->state = DN_CONNECTION_STATE_IDLE;
 		}
 	}
+#endif /* ADB */
 		/*
 		 * Hack to wait a moment to cancel requests are processed in other nodes.
 		 * If we send a new query to nodes before cancel requests get to be
@@ -1016,10 +1603,35 @@ clear_all_data(void)
 {
 	PGXCNodeHandle *handle;
 	int				i;
+#ifdef ADB
+	PGXCNodeHandle *drain[NumDataNodes + NumCoords];
+	int				drain_count = 0;
+#endif
 
 	if (datanode_count == 0 && coord_count == 0)
 		return;
 
+#ifdef ADB
+	for (i = 0; i < NumDataNodes; i++)
+	{
+		handle = &dn_handles[i];
+
+		if (handle->sock != NO_SOCKET && handle->state != DN_CONNECTION_STATE_IDLE)
+			drain[drain_count++] = handle;
+		/* Clear any previous error messages */
+		FreeHandleError(handle);
+	}
+	for (i = 0; i < NumCoords; i++)
+	{
+		handle = &co_handles[i];
+
+		if (handle->sock != NO_SOCKET && handle->state != DN_CONNECTION_STATE_IDLE)
+			drain[drain_count++] = handle;
+		/* Clear any previous error messages */
+		FreeHandleError(handle);
+	}
+	pgxc_node_flush_read_all(drain_count, drain);
+#else
 	/* Collect Datanodes handles */
 	for (i = 0; i < NumDataNodes; i++)
 	{
@@ -1047,6 +1659,7 @@ clear_all_data(void)
 		/* Clear any previous error messages */
 		FreeHandleError(handle);
 	}
+#endif /* ADB */
 }
 
 #ifdef ADB
@@ -1136,19 +1749,16 @@ cancel_some_handles(int num_dnhandles, PGXCNodeHandle **dnhandles,
 		 * Read responses from the nodes to whom we sent the cancel command. This
 		 * ensures that there are no pending messages left on the connection
 		 */
-		for (i = 0; i < dn_count; i++)
-		{
-			handle = new_dnhandles[i];
-
-			pgxc_node_flush_read(handle);
-		}
-
-		for (i = 0; i < co_count; i++)
+		if (co_count > 0)
 		{
-			handle = new_cohandles[i];
-
-			pgxc_node_flush_read(handle);
+			/* drain them all together */
+			new_dnhandles = (PGXCNodeHandle **) (new_dnhandles ?
+				repalloc(new_dnhandles, (dn_count + co_count) * sizeof(PGXCNodeHandle *)) :
+				palloc((dn_count + co_count) * sizeof(PGXCNodeHandle *)));
+			memcpy(new_dnhandles + dn_count, new_cohandles,
+				   co_count * sizeof(PGXCNodeHandle *));
 		}
+		pgxc_node_flush_read_all(dn_count + co_count, new_dnhandles);
 	} PG_CATCH();
 	{
 		if (dn_cancel)
@@ -1188,6 +1798,8 @@ clear_some_handles(int num_dnhandles, PGXCNodeHandle **dnhandles,
 				   int num_cohandles, PGXCNodeHandle **cohandles)
 {
 	PGXCNodeHandle *handle;
+	PGXCNodeHandle *drain[Max(num_dnhandles, 0) + Max(num_cohandles, 0)];
+	int				drain_count = 0;
 	int				i;
 
 	if (num_dnhandles <= 0 && num_cohandles <= 0)
@@ -1217,9 +1829,9 @@ clear_some_handles(int num_dnhandles, PGXCNodeHandle **dnhandles,
 			DataNodeCopyEnd(handle, true);
 		}
 
-		/* try to flush read any data */
+		/* flush read any data below */
 		if (handle->state != DN_CONNECTION_STATE_IDLE)
-			pgxc_node_flush_read(handle);
+			drain[drain_count++] = handle;
 
 		/* release any combiner */
 		handle->combiner = NULL;
@@ -1249,14 +1861,16 @@ clear_some_handles(int num_dnhandles, PGXCNodeHandle **dnhandles,
 			DataNodeCopyEnd(handle, true);
 		}
 
-		/* try to flush read any data */
+		/* flush read any data below */
 		if (handle->state != DN_CONNECTION_STATE_IDLE)
-			pgxc_node_flush_read(handle);
+			drain[drain_count++] = handle;
 
 		/* release any combiner */
 		handle->combiner = NULL;
 	}
 
+	pgxc_node_flush_read_all(drain_count, drain);
+
 	/*
 	 * We cannot release handle here, it is decided with the caller. 
 	 */
@@ -1266,6 +1880,8 @@ void
 clear_all_handles(bool error)
 {
 	PGXCNodeHandle *handle;
+	PGXCNodeHandle *drain[NumDataNodes + NumCoords];
+	int				drain_count = 0;
 	int 			i;
 
 	if (datanode_count <= 0 && coord_count <= 0)
@@ -1295,9 +1911,9 @@ clear_all_handles(bool error)
 			DataNodeCopyEnd(handle, error);
 		}
 
-		/* try to flush read any data */
+		/* flush read any data below */
 		if (handle->state != DN_CONNECTION_STATE_IDLE)
-			pgxc_node_flush_read(handle);
+			drain[drain_count++] = handle;
 
 		/* release any combiner */
 		handle->combiner = NULL;
@@ -1327,14 +1943,16 @@ clear_all_handles(bool error)
 			DataNodeCopyEnd(handle, error);
 		}
 
-		/* try to flush read any data */
+		/* flush read any data below */
 		if (handle->state != DN_CONNECTION_STATE_IDLE)
-			pgxc_node_flush_read(handle);
+			drain[drain_count++] = handle;
 
 		/* release any combiner */
 		handle->combiner = NULL;
 	}
 
+	pgxc_node_flush_read_all(drain_count, drain);
+
 	/*
 	 * We cannot release handle here, it is decided with the caller. 
 	 */
@@ -1529,6 +2147,11 @@ send_some(PGXCNodeHandle *handle, int len)
 				fwrite(&sent, sizeof(sent), 1, handle->file_data);
 				fwrite(ptr, 1, sent, handle->file_data);
 			}
+#ifdef ADB
+			handle->traffic.bytes_sent += sent;
+			pgBufferUsage.remote_bytes_sent += sent;
+			handle->awaiting_answer = true;
+#endif
 			ptr += sent;
 			len -= sent;
 			remaining -= sent;
@@ -1603,6 +2226,7 @@ pgxc_node_send_parse(PGXCNodeHandle * handle, const char* statement,
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'P';
 	/* size */
 	msgLen = htonl(msgLen);
@@ -1680,6 +2304,7 @@ pgxc_node_send_bind(PGXCNodeHandle * handle, const char *portal,
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'B';
 	/* size */
 	msgLen = htonl(msgLen);
@@ -1750,6 +2375,7 @@ pgxc_node_send_describe(PGXCNodeHandle * handle, bool is_statement,
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'D';
 	/* size */
 	msgLen = htonl(msgLen);
@@ -1790,6 +2416,7 @@ pgxc_node_send_close(PGXCNodeHandle * handle, bool is_statement,
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'C';
 	/* size */
 	msgLen = htonl(msgLen);
@@ -1830,6 +2457,7 @@ pgxc_node_send_execute(PGXCNodeHandle * handle, const char *portal, int fetch)
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'E';
 	/* size */
 	msgLen = htonl(msgLen);
@@ -1871,6 +2499,7 @@ pgxc_node_send_flush(PGXCNodeHandle * handle)
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'H';
 	/* size */
 	msgLen = htonl(msgLen);
@@ -1897,12 +2526,17 @@ pgxc_node_send_sync(PGXCNodeHandle * handle)
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'S';
 	/* size */
 	msgLen = htonl(msgLen);
 	memcpy(handle->outBuffer + handle->outEnd, &msgLen, 4);
 	handle->outEnd += 4;
 
+#ifdef ADB
+	handle->sync_pending = false;
+#endif
+
 	return pgxc_node_flush(handle);
 }
 
@@ -1916,6 +2550,29 @@ pgxc_node_send_query_extended(PGXCNodeHandle *handle, const char *query,
 							  int num_params, Oid *param_types,
 							  int paramlen, char *params,
 							  bool send_describe, int fetch_size)
+{
+	if (pgxc_node_send_query_extended_nosync(handle, query, statement, portal,
+											 num_params, param_types,
+											 paramlen, params,
+											 send_describe, fetch_size))
+		return EOF;
+	if (pgxc_node_send_sync(handle))
+		return EOF;
+
+	return 0;
+}
+
+/*
+ * Same as pgxc_node_send_query_extended but the messages are left in the
+ * output buffer without Sync, so more commands can be queued after them.
+ * Caller must send the Sync later.
+ */
+int
+pgxc_node_send_query_extended_nosync(PGXCNodeHandle *handle, const char *query,
+							  const char *statement, const char *portal,
+							  int num_params, Oid *param_types,
+							  int paramlen, char *params,
+							  bool send_describe, int fetch_size)
 {
 	/* NULL query indicates already prepared statement */
 	if (query)
@@ -1958,8 +2615,9 @@ pgxc_node_send_query_extended(PGXCNodeHandle *handle, const char *query,
 	if (fetch_size >= 0)
 		if (pgxc_node_send_execute(handle, portal, fetch_size))
 			return EOF;
-	if (pgxc_node_send_sync(handle))
-		return EOF;
+#ifdef ADB
+	handle->sync_pending = true;
+#endif
 
 	return 0;
 }
@@ -1971,15 +2629,30 @@ pgxc_node_send_query_extended(PGXCNodeHandle *handle, const char *query,
 int
 pgxc_node_flush(PGXCNodeHandle *handle)
 {
+#ifdef ADB
+	if (handle->outEnd == 0)
+		return 0;
+
+	TRACE_POSTGRESQL_REMOTE_SEND_START(handle->nodeoid, (int) handle->outEnd);
+	pgstat_report_wait_start(WAIT_EVENT_REMOTE_SEND);
+#endif
 	while (handle->outEnd)
 	{
 		if (send_some(handle, handle->outEnd) < 0)
 		{
+#ifdef ADB
+			pgstat_report_wait_end();
+			TRACE_POSTGRESQL_REMOTE_SEND_DONE(handle->nodeoid, false);
+#endif
 			add_error_message(handle,
 				"Fail to send data to datanode %s", NameStr(handle->name));
 			return EOF;
 		}
 	}
+#ifdef ADB
+	pgstat_report_wait_end();
+	TRACE_POSTGRESQL_REMOTE_SEND_DONE(handle->nodeoid, true);
+#endif
 	return 0;
 }
 
@@ -1999,6 +2672,13 @@ void pgxc_node_flush_read(PGXCNodeHandle *handle)
 	if(handle == NULL || handle->sock == NO_SOCKET)
 		return;
 
+	/* without Sync the node never answers ReadyForQuery */
+	if(handle->sync_pending && pgxc_node_send_sync(handle) != 0)
+	{
+		handle->state = DN_CONNECTION_STATE_ERROR_FATAL;
+		return;
+	}
+
 	last_time = time(NULL);
 	for(;;)
 	{
@@ -2032,6 +2712,104 @@ void pgxc_node_flush_read(PGXCNodeHandle *handle)
 	}
 }
 #undef FLUSH_READ_TIMEOUT
+
+/*
+ * Like pgxc_node_flush_read for several handles: all of them are read
+ * through one poll(), and the ones not ready for query after
+ * FLUSH_READ_ALL_TIMEOUT are marked as fatal.  release_handles then lets
+ * the pool manager cancel and close them, the session does not wait for
+ * a node slow to stop.
+ */
+#define FLUSH_READ_ALL_TIMEOUT	1000	/* milliseconds */
+void
+pgxc_node_flush_read_all(int count, PGXCNodeHandle **handles)
+{
+	PGXCNodeHandle **pending;
+	struct pollfd  *fds;
+	int				npending = 0;
+	int				i;
+	int				result;
+	long			secs;
+	int				usecs;
+	TimestampTz		deadline;
+
+	if (count <= 0)
+		return;
+
+	pending = (PGXCNodeHandle **) palloc(count * sizeof(PGXCNodeHandle *));
+	fds = (struct pollfd *) palloc(count * sizeof(struct pollfd));
+	for (i = 0; i < count; i++)
+	{
+		PGXCNodeHandle *handle = handles[i];
+
+		if (handle == NULL || handle->sock == NO_SOCKET)
+			continue;
+
+		/* without Sync the node never answers ReadyForQuery */
+		if (handle->sync_pending && pgxc_node_send_sync(handle) != 0)
+		{
+			handle->state = DN_CONNECTION_STATE_ERROR_FATAL;
+			continue;
+		}
+
+		if (!is_data_node_ready(handle))
+			pending[npending++] = handle;
+	}
+
+	deadline = TimestampTzPlusMilliseconds(GetCurrentTimestamp(),
+										   FLUSH_READ_ALL_TIMEOUT);
+	while (npending > 0)
+	{
+		TimestampDifference(GetCurrentTimestamp(), deadline, &secs, &usecs);
+		if (secs == 0 && usecs == 0)
+			break;
+
+		for (i = 0; i < npending; i++)
+		{
+			fds[i].fd = pending[i]->sock;
+			fds[i].events = POLLIN;
+			fds[i].revents = 0;
+		}
+		result = poll(fds, npending, (int) (secs * 1000 + usecs / 1000 + 1));
+		if (result < 0)
+		{
+			CHECK_FOR_INTERRUPTS();
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		else if (result == 0)
+		{
+			/* timeout */
+			break;
+		}
+
+		/* keep the order of pending in step with fds while removing */
+		for (i = npending; i-- > 0;)
+		{
+			PGXCNodeHandle *handle = pending[i];
+
+			if (fds[i].revents == 0)
+				continue;
+
+			if (pgxc_node_read_data(handle, true) < 0)
+				handle->state = DN_CONNECTION_STATE_ERROR_FATAL;
+			if (is_data_node_ready(handle))
+				pending[i] = pending[--npending];
+		}
+	}
+
+	for (i = 0; i < npending; i++)
+	{
+		elog(DEBUG1, "Connection to node %s is still busy and will be dropped",
+			 NameStr(pending[i]->name));
+		pending[i]->state = DN_CONNECTION_STATE_ERROR_FATAL;
+	}
+
+	pfree(pending);
+	pfree(fds);
+}
+#undef FLUSH_READ_ALL_TIMEOUT
 #else /* ADB */
 void
 pgxc_node_flush_read(PGXCNodeHandle *handle)
@@ -2121,6 +2899,7 @@ int	pgxc_node_send_query_tree(PGXCNodeHandle * handle, const char *query, String
 	}
 
 #ifdef ADB
+	PGXCNodeCountMessageSent(handle);
 	if(tree_len)
 		handle->outBuffer[handle->outEnd++] = 'q';
 	else
@@ -2169,6 +2948,7 @@ pgxc_node_send_gxid(PGXCNodeHandle *handle, GlobalTransactionId gxid)
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'g';
 	msglen = htonl(msglen);
 	memcpy(handle->outBuffer + handle->outEnd, &msglen, sizeof(msglen));
@@ -2204,6 +2984,7 @@ pgxc_node_send_cmd_id(PGXCNodeHandle *handle, CommandId cid)
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 'M';
 	msglen = htonl(msglen);
 	memcpy(handle->outBuffer + handle->outEnd, &msglen, 4);
@@ -2215,6 +2996,45 @@ pgxc_node_send_cmd_id(PGXCNodeHandle *handle, CommandId cid)
 	return 0;
 }
 
+#ifdef ADB
+/*
+ * Send the queryId of the statement down to the PGXC node, so the statistics
+ * of the query it runs there can be told apart by the statement they are for
+ */
+int
+pgxc_node_send_query_id(PGXCNodeHandle *handle, uint32 queryid)
+{
+	int			msglen = 8;
+	uint32		n32;
+
+	/* Not computed, pg_stat_statements is not loaded */
+	if (queryid == 0)
+		return 0;
+
+	/* Invalid connection state, return error */
+	if (handle->state != DN_CONNECTION_STATE_IDLE)
+		return EOF;
+
+	/* msgType + msgLen */
+	if (ensure_out_buffer_capacity(handle->outEnd + 1 + msglen, handle) != 0)
+	{
+		add_error_message(handle, "out of memory");
+		return EOF;
+	}
+
+	PGXCNodeCountMessageSent(handle);
+	handle->outBuffer[handle->outEnd++] = 'i';
+	msglen = htonl(msglen);
+	memcpy(handle->outBuffer + handle->outEnd, &msglen, 4);
+	handle->outEnd += 4;
+	n32 = htonl(queryid);
+	memcpy(handle->outBuffer + handle->outEnd, &n32, 4);
+	handle->outEnd += 4;
+
+	return 0;
+}
+#endif
+
 int
 pgxc_node_send_snapshot(PGXCNodeHandle *handle, Snapshot snapshot)
 {
@@ -2257,6 +3077,8 @@ pgxc_node_send_snapshot(PGXCNodeHandle *handle, Snapshot snapshot)
 		nval = htonl(snapshot->subxip[i]);
 		appendBinaryStringInfo(&buf, (const char *) &nval, sizeof(TransactionId));
 	}
+	/* suboverflowed */
+	appendStringInfoChar(&buf, snapshot->suboverflowed ? 1 : 0);
 
 	/* message length */
 	if (ensure_out_buffer_capacity(handle->outEnd + 1 + 4 + buf.len, handle) != 0)
@@ -2265,6 +3087,7 @@ pgxc_node_send_snapshot(PGXCNodeHandle *handle, Snapshot snapshot)
 		return EOF;
 	}
 
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 's';
 	nval = htonl(4 + buf.len);
 	memcpy(handle->outBuffer + handle->outEnd, &nval, sizeof(nval));
@@ -2293,6 +3116,7 @@ pgxc_node_send_timestamp(PGXCNodeHandle *handle, TimestampTz timestamp)
 		add_error_message(handle, "out of memory");
 		return EOF;
 	}
+	PGXCNodeCountMessageSent(handle);
 	handle->outBuffer[handle->outEnd++] = 't';
 	msglen = htonl(msglen);
 	memcpy(handle->outBuffer + handle->outEnd, &msglen, 4);
@@ -2364,6 +3188,12 @@ get_handles(List *datanodelist, List *coordlist, bool is_coord_only_query)
 	PGXCNodeHandle		*node_handle;
 	/* index of the result array */
 	int					 i = 0;
+#ifdef ADB
+	bool				 slave_read = pgxc_slave_read_xact();
+
+	if (!slave_read)
+		release_slave_read_handles();
+#endif
 
 	result = (PGXCNodeAllHandles *) palloc(sizeof(PGXCNodeAllHandles));
 	if (!result)
@@ -2530,7 +3360,8 @@ get_handles(List *datanodelist, List *coordlist, bool is_coord_only_query)
 	if (dn_allocate || co_allocate)
 	{
 		int	j = 0;
-		int	*fds = PoolManagerGetConnections(dn_allocate, co_allocate);
+		int	*fds = PoolManagerGetConnections(dn_allocate, co_allocate,
+											 slave_read ? dn_allocate : NIL);
 
 		if (!fds)
 		{
@@ -2567,6 +3398,9 @@ get_handles(List *datanodelist, List *coordlist, bool is_coord_only_query)
 
 				node_handle = &dn_handles[node];
 				pgxc_node_init(node_handle, fdsock);
+#ifdef ADB
+				node_handle->slave_read = slave_read;
+#endif
 				dn_handles[node] = *node_handle;
 				datanode_count++;
 			}
@@ -2648,6 +3482,19 @@ PGXCNodeGetNodeId(Oid nodeoid, char node_type)
 			return res;
 	}
 
+#ifdef ADB
+	if (node_id_hash)
+	{
+		PGXCNodeIdEntry *entry;
+
+		entry = (PGXCNodeIdEntry *) hash_search(node_id_hash, &nodeoid,
+												HASH_FIND, NULL);
+		if (entry && entry->node_type == node_type)
+			res = entry->nodeid;
+		return res;
+	}
+#endif
+
 	/* Look into the handles and return correct position in array */
 	for (i = 0; i < num_nodes; i++)
 	{
@@ -2697,6 +3544,79 @@ pgxc_node_str(PG_FUNCTION_ARGS)
 	PG_RETURN_NAME(PGXCNodeName);
 }
 
+#ifdef ADB
+#define REMOTE_CONNECTIONS_COLS	7
+
+static void
+put_remote_connection(Tuplestorestate *tupstore, TupleDesc tupdesc,
+					  PGXCNodeHandle *handle)
+{
+	Datum		values[REMOTE_CONNECTIONS_COLS];
+	bool		nulls[REMOTE_CONNECTIONS_COLS];
+
+	MemSet(nulls, 0, sizeof(nulls));
+	values[0] = NameGetDatum(&handle->name);
+	values[1] = CharGetDatum(handle->type);
+	values[2] = Int64GetDatum((int64) handle->traffic.bytes_sent);
+	values[3] = Int64GetDatum((int64) handle->traffic.bytes_received);
+	values[4] = Int64GetDatum((int64) handle->traffic.msgs_sent);
+	values[5] = Int64GetDatum((int64) handle->traffic.msgs_received);
+	values[6] = Int64GetDatum((int64) handle->traffic.round_trips);
+	tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+}
+
+/*
+ * pg_stat_get_remote_connections
+ *
+ * Traffic of each connection the session holds to another node, since the
+ * pooler handed it over.
+ */
+Datum
+pg_stat_get_remote_connections(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	MemoryContext oldcontext;
+	int			i;
+
+	/* check to see if caller supports us returning a tuplestore */
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not " \
+						"allowed in this context")));
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+	tupdesc = CreateTupleDescCopy(tupdesc);
+	tupstore = tuplestore_begin_heap(true, false, work_mem);
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = tupdesc;
+	MemoryContextSwitchTo(oldcontext);
+
+	for (i = 0; dn_handles && i < NumDataNodes; i++)
+	{
+		if (dn_handles[i].sock != NO_SOCKET)
+			put_remote_connection(tupstore, tupdesc, &dn_handles[i]);
+	}
+	for (i = 0; co_handles && i < NumCoords; i++)
+	{
+		if (co_handles[i].sock != NO_SOCKET)
+			put_remote_connection(tupstore, tupdesc, &co_handles[i]);
+	}
+
+	tuplestore_donestoring(tupstore);
+	return (Datum) 0;
+}
+#endif
+
 /*
  * PGXCNodeGetNodeIdFromName
  *		Return node position in handles array
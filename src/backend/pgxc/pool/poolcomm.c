@@ -33,7 +33,7 @@
 
 static int	pool_recvbuf(PoolPort *port);
 static int	pool_discardbytes(PoolPort *port, size_t len);
-static void pool_report_error(pgsocket sock, uint32 msg_len);
+static void pool_report_error(pgsocket sock, uint32 msg_len, const char *head, uint32 head_len);
 static int pool_block_recv(pgsocket sock, void *ptr, uint32 size);
 
 #ifdef HAVE_UNIX_SOCKETS
@@ -491,8 +491,9 @@ pool_sendfds(PoolPort *port, int *fds, int count)
 	struct msghdr msg;
 	char		buf[SEND_MSG_BUFFER_SIZE];
 	uint		n32;
-	int			controllen = CMSG_LEN(count * sizeof(int));
-	struct cmsghdr *cmptr = NULL;
+	Size		controllen = CMSG_LEN(count * sizeof(int));
+	static Size	cmsg_size = 0;
+	static struct cmsghdr *cmptr = NULL;
 
 	buf[0] = 'f';
 	n32 = 8;//htonl((uint32) 8);
@@ -513,8 +514,15 @@ pool_sendfds(PoolPort *port, int *fds, int count)
 	}
 	else
 	{
-		if ((cmptr = malloc(controllen)) == NULL)
-			return EOF;
+		/* control buffer is kept for next call */
+		if (cmsg_size < controllen)
+		{
+			struct cmsghdr *new_cmptr = realloc(cmptr, controllen);
+			if (new_cmptr == NULL)
+				return EOF;
+			cmptr = new_cmptr;
+			cmsg_size = controllen;
+		}
 		cmptr->cmsg_level = SOL_SOCKET;
 		cmptr->cmsg_type = SCM_RIGHTS;
 		cmptr->cmsg_len = controllen;
@@ -525,14 +533,7 @@ pool_sendfds(PoolPort *port, int *fds, int count)
 	}
 
 	if (sendmsg(Socket(*port), &msg, 0) != SEND_MSG_BUFFER_SIZE)
-	{
-		if (cmptr)
-			free(cmptr);
 		return EOF;
-	}
-
-	if (cmptr)
-		free(cmptr);
 
 	return 0;
 }
@@ -551,6 +552,7 @@ pool_recvfds(PoolPort *port, pgsocket *fds, int count)
 	static struct cmsghdr *cmptr = NULL;
 	Size need_size;
 	uint32 msg_size;
+	uint32 recv_len;
 	int rval;
 
 	AssertArg(port && fds && count>0);
@@ -564,11 +566,14 @@ pool_recvfds(PoolPort *port, pgsocket *fds, int count)
 		controllen = need_size;
 	}
 
-	/* first read message head */
+	/*
+	 * Read message head and connection count by one recvmsg(),
+	 * fds come with the first byte of message
+	 */
 	HOLD_CANCEL_INTERRUPTS();
 retry_recvmsg_:
 	iov[0].iov_base = buf;
-	iov[0].iov_len = 5;
+	iov[0].iov_len = sizeof(buf);
 	memset(&msg, 0, sizeof(msg));
 	msg.msg_iov = iov;
 	msg.msg_iovlen = lengthof(iov);
@@ -591,10 +596,18 @@ retry_recvmsg_:
 	{
 		RESUME_CANCEL_INTERRUPTS();
 		return EOF;
-	}else if (rval != 5)
+	}else if (rval < 5)
 	{
-		ereport(FATAL, (errcode(ERRCODE_PROTOCOL_VIOLATION),
-			errmsg("incomplete message pooler process")));
+		/* short read, get rest of message head */
+		if(pool_block_recv(Socket(*port), &buf[rval], 5-rval) != 5-rval)
+		{
+			RESUME_CANCEL_INTERRUPTS();
+			return EOF;
+		}
+		recv_len = 5;
+	}else
+	{
+		recv_len = (uint32)rval;
 	}
 
 	memmove(&msg_size, &buf[1], 4);
@@ -603,7 +616,12 @@ retry_recvmsg_:
 	{
 		/* poolmgr send us an error message */
 		msg_size = htonl(msg_size);
-		pool_report_error(Socket(*port), msg_size-4);
+		if(msg_size < 4 || recv_len - 5 > msg_size - 4)
+		{
+			ereport(FATAL, (errcode(ERRCODE_PROTOCOL_VIOLATION),
+				errmsg("invalid message size from pooler process")));
+		}
+		pool_report_error(Socket(*port), msg_size-4, &buf[5], recv_len-5);
 		/* if run to here, socket is closed */
 		RESUME_CANCEL_INTERRUPTS();
 		return EOF;
@@ -620,8 +638,9 @@ retry_recvmsg_:
 			errmsg("invalid message type from pooler process")));
 	}
 
-	/* read other message */
-	if(pool_block_recv(Socket(*port), &buf[5], sizeof(buf)-5) != sizeof(buf)-5)
+	/* read other message if not got yet */
+	if(recv_len < sizeof(buf)
+		&& pool_block_recv(Socket(*port), &buf[recv_len], sizeof(buf)-recv_len) != sizeof(buf)-recv_len)
 	{
 		RESUME_CANCEL_INTERRUPTS();
 		return EOF;
@@ -710,7 +729,7 @@ pool_recvres(PoolPort *port)
 #ifdef ADB
 	if (buf[0] == 'E')
 	{
-		pool_report_error(Socket(*port), n32-4);
+		pool_report_error(Socket(*port), n32-4, NULL, 0);
 		/* run to here socket is closed */
 		goto failure;
 	}else
@@ -752,7 +771,7 @@ pool_recvpids(PoolPort *port, int **pids)
 
 	if(buf[0] == 'E')
 	{
-		pool_report_error(Socket(*port), n32-4);
+		pool_report_error(Socket(*port), n32-4, NULL, 0);
 		goto failure;
 	}else if(buf[0] != 'p')
 	{
@@ -811,17 +830,22 @@ const char* pool_get_sock_path(void)
 	return sock_path;
 }
 
-static void pool_report_error(pgsocket sock, uint32 msg_len)
+/*
+ * "head" is the part of message already received, "head_len" <= "msg_len"
+ */
+static void pool_report_error(pgsocket sock, uint32 msg_len, const char *head, uint32 head_len)
 {
 	char *err_msg;
 	uint32 recv_len;
+	Assert(head_len <= msg_len);
 	if(msg_len > 0)
 	{
 		START_CRIT_SECTION();
 		err_msg = palloc(msg_len+1);
 		END_CRIT_SECTION();
 
-		recv_len = pool_block_recv(sock, err_msg, msg_len);
+		memcpy(err_msg, head, head_len);
+		recv_len = head_len + pool_block_recv(sock, err_msg + head_len, msg_len - head_len);
 		if(recv_len != msg_len)
 		{
 			pfree(err_msg);
@@ -5,29 +5,38 @@
 #include <signal.h>
 #include <time.h>
 #include "access/hash.h"
+#include "access/htup_details.h"
 #include "access/xact.h"
 #include "agtm/agtm_client.h"
+#include "catalog/pg_type.h"
 #include "catalog/pgxc_node.h"
 #include "commands/dbcommands.h"
+#include "funcapi.h"
+#include "libpq/libpq.h"
 #include "libpq/pqformat.h"
 #include "libpq/pqsignal.h"
 #include "lib/ilist.h"
 #include "lib/stringinfo.h"
 #include "miscadmin.h"
 #include "nodes/nodes.h"
+#include "pg_trace.h"
 #include "pgxc/locator.h"
 #include "pgxc/nodemgr.h"
 #include "pgxc/pgxc.h"
 #include "pgxc/poolmgr.h"
 #include "pgxc/poolutils.h"
+#include "portability/instr_time.h"
 #include "postmaster/postmaster.h"		/* For Unix_socket_directories */
 #include "storage/ipc.h"
 #include "tcop/tcopprot.h"
+#include "utils/array.h"
 #include "utils/builtins.h"
 #include "utils/guc.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/resowner.h"
+#include "utils/syscache.h"
+#include "utils/waitevent.h"
 #include "libpq/libpq-fe.h"
 #include "libpq/libpq-int.h"
 #ifdef ADB
@@ -37,7 +46,6 @@
 #include "storage/procarray.h"
 
 #define START_POOL_ALLOC	512
-#define STEP_POLL_ALLOC		8
 
 /* debug macros */
 #define ADB_DEBUG_POOL 1
@@ -55,9 +63,36 @@
 #define PM_MSG_RELEASE_CONNECT		'r'
 #define PM_MSG_SET_COMMAND			's'
 #define PM_MSG_CLOSE_CONNECT		'C'
+#define PM_MSG_DISCARD_CONNECT		'D'
 #define PM_MSG_ERROR				'E'
 #define PM_MSG_CLOSE_IDLE_CONNECT	'S'
 #define PM_MSG_CLOSE_ALL_CONNECT	'K'
+#define PM_MSG_GET_STATS			'T'
+
+/*
+ * Buckets of the latency histograms of ADBNodePoolStats: bucket i counts
+ * the waits which took between 2^i and 2^(i+1) microseconds, the first
+ * one also those below, the last one also those above.
+ */
+#define POOL_STAT_HIST_BUCKETS		20
+#define POOL_STAT_COLS				17
+
+/*
+ * Replay lag of a hot standby slave in milliseconds, 0 when it replayed
+ * everything it received, NULL if it is not in recovery.  It is sent after
+ * "reset all" on the slots of slave pools given back to the pool, and at
+ * least every SLAVE_LAG_CHECK_INTERVAL seconds on an idle one; a lag
+ * measured more than SLAVE_LAG_MAX_AGE seconds ago is unknown.
+ */
+#define SLAVE_LAG_QUERY \
+	"SELECT CASE WHEN NOT pg_catalog.pg_is_in_recovery() THEN NULL" \
+	" WHEN pg_catalog.pg_last_xlog_receive_location() = pg_catalog.pg_last_xlog_replay_location() THEN 0" \
+	" ELSE (pg_catalog.date_part('epoch', pg_catalog.now() - pg_catalog.pg_last_xact_replay_timestamp()) * 1000)::pg_catalog.int8 END"
+#define SLAVE_LAG_CHECK_INTERVAL	1
+#define SLAVE_LAG_MAX_AGE			3
+
+/* milliseconds to wait for the postmasters getting cancel requests */
+#define POOL_CANCEL_TIMEOUT			5000
 
 typedef enum SlotStateType
 {
@@ -115,19 +150,46 @@ typedef struct ADBNodePoolSlot
 						poll_state;			/* when state equal SLOT_BUSY_CONNECTING
 											 * this value is valid */
 	SlotStateType		slot_state;			/* SLOT_BUSY_*, valid when in ADBNodePool::busy_slot */
+	instr_time			connect_start;		/* when PQconnectStart was called */
 	int					last_user_pid;
 	int					last_agtm_port;		/* last send agtm port */
 	bool				has_temp;			/* have temp object? */
+	bool				has_params;			/* last owner left SET params on it? */
 	int					retry;				/* try to reconnect times, at most three times */
 	uint32				session_magic;		/* sended session params magic number */
 	uint32				local_magic;		/* sended local params magic number */
 	SlotCurrentList		current_list;
 } ADBNodePoolSlot;
 
+/*
+ * Counters of a node pool, sent as is to the backends asking for them,
+ * times in microseconds
+ */
+typedef struct ADBNodePoolStats
+{
+	uint64		connects;			/* PQconnectStart calls */
+	uint64		connect_failures;	/* connects which did not succeed */
+	uint64		connect_time;		/* total time of the succeeded connects */
+	uint64		connect_hist[POOL_STAT_HIST_BUCKETS];
+	uint64		acquires;			/* connections handed out to agents */
+	uint64		acquire_time;		/* total time agents waited for them */
+	uint64		acquire_max_time;
+	uint64		acquire_hist[POOL_STAT_HIST_BUCKETS];
+	uint64		idle_closes;		/* idle slots closed after pool_time_out */
+} ADBNodePoolStats;
+
+/* Key of ADBNodePool, its first members */
+typedef struct ADBNodePoolKey
+{
+	Oid			nodeoid;
+	bool		slave;
+} ADBNodePoolKey;
+
 /* Pool of connections to specified pgxc node */
 typedef struct ADBNodePool
 {
 	Oid			nodeoid;	/* Node Oid related to this pool */
+	bool		slave;		/* connections to the hot standby slave of the node? */
 	dlist_head	uninit_slot;
 	dlist_head	released_slot;
 	dlist_head	idle_slot;
@@ -135,6 +197,10 @@ typedef struct ADBNodePool
 	char	   *connstr;
 	Size		last_idle;
 	struct DatabasePool *parent;
+	ADBNodePoolStats stats;
+	int64		replay_lag;		/* of a slave pool, -1 if unknown */
+	time_t		lag_time;		/* when replay_lag was received */
+	time_t		lag_sent_time;	/* when SLAVE_LAG_QUERY was last sent on an idle slot */
 } ADBNodePool;
 
 typedef struct DatabaseInfo
@@ -173,6 +239,7 @@ typedef struct PoolAgent
 	uint32			session_magic;	/* magic number for session_params */
 	uint32			local_magic;	/* magic number for local_params */
 	List		   *list_wait;		/* List of ADBNodePoolSlot in connecting */
+	instr_time		acquire_start;	/* when list_wait was asked for */
 	MemoryContext	mctx;
 	/* Process ID of postmaster child process associated to pool agent */
 	int				pid;
@@ -189,9 +256,14 @@ struct PoolHandle
 /* Configuration options */
 int			MinPoolSize = 1;
 int			MaxPoolSize = 100;
+int			PoolMinIdle = 0;
 int			PoolRemoteCmdTimeout = 0;
 
 bool		PersistentConnections = false;
+bool		PoolTransactionMode = false;
+bool		PoolLazyConnect = false;
+bool		EnableDatanodeSlaveRead = false;
+int			DatanodeSlaveMaxLag = 1000;
 
 /* pool time out */
 extern int  pool_time_out;
@@ -214,6 +286,10 @@ static PoolAgent **poolAgents;
 
 static PoolHandle *poolHandle = NULL;
 
+/* Database and user of a session not attached to the pooler yet */
+static char *deferred_database = NULL;
+static char *deferred_user_name = NULL;
+
 static int	is_pool_locked = false;
 static pgsocket server_fd = PGINVALID_SOCKET;
 
@@ -228,10 +304,11 @@ static void agent_error_hook(void *arg);
 static void agent_check_waiting_slot(PoolAgent *agent);
 static bool agent_recv_data(PoolAgent *agent);
 static bool agent_has_completion_msg(PoolAgent *agent, StringInfo msg, int *msg_type);
-static char * build_node_conn_str(Oid node, DatabasePool *dbPool);
+static char * build_node_conn_str(Oid node, DatabasePool *dbPool, bool slave);
 static int *abort_pids(int *count, int pid, const char *database, const char *user_name);
 static int clean_connection(List *node_discard, const char *database, const char *user_name);
 static bool check_slot_status(ADBNodePoolSlot *slot);
+static void check_agent_slots_status(PoolAgent *agent);
 
 static void agent_create(volatile pgsocket new_fd);
 static void agent_release_connections(PoolAgent *agent, bool force_destroy);
@@ -239,9 +316,16 @@ static void agent_idle_connections(PoolAgent *agent, bool force_destroy);
 static void process_slot_event(ADBNodePoolSlot *slot);
 static void save_slot_error(ADBNodePoolSlot *slot);
 static bool get_slot_result(ADBNodePoolSlot *slot);
-static void agent_acquire_connections(PoolAgent *agent, const List *datanodelist, const List *coordlist);
-static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, const List *node_list, PoolAgent *agent);
-static void cancel_query_on_connections(PoolAgent *agent, Size count, ADBNodePoolSlot **slots, const List *nodelist);
+static void agent_acquire_connections(PoolAgent *agent, const List *datanodelist, const List *coordlist,
+									  const List *slavelist, int slave_max_lag);
+static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, const List *node_list, PoolAgent *agent,
+									const List *slavelist, int slave_max_lag);
+static int agent_locked_slots(PoolAgent *agent, const List *datanodelist, const List *coordlist,
+							  ADBNodePoolSlot **slots, bool detach);
+static void cancel_query_on_connections(PoolAgent *agent, const List *datanodelist, const List *coordlist);
+static void agent_discard_connections(PoolAgent *agent, const List *datanodelist, const List *coordlist);
+static bool send_cancel_request(pgsocket sock, PGconn *conn);
+static void cancel_slots(ADBNodePoolSlot **slots, int count);
 static void reload_database_pools(PoolAgent *agent);
 static int node_info_check(PoolAgent *agent);
 static int agent_session_command(PoolAgent *agent, const char *set_command, PoolCommandType command_type, StringInfo errMsg);
@@ -249,10 +333,18 @@ static int send_local_commands(PoolAgent *agent, List *datanodelist, List *coord
 
 static void destroy_slot(ADBNodePoolSlot *slot, bool send_cancel);
 static void release_slot(ADBNodePoolSlot *slot, bool force_close);
+static void push_released_slot(ADBNodePoolSlot *slot);
 static void idle_slot(ADBNodePoolSlot *slot, bool reset);
+static void share_slot(ADBNodePoolSlot *slot, PoolAgent *agent);
 static void destroy_node_pool(ADBNodePool *node_pool, bool bfree);
 static bool node_pool_in_using(ADBNodePool *node_pool);
-static time_t close_timeout_idle_slots(time_t timeout);
+static time_t close_timeout_idle_slots(time_t timeout, int keep);
+static void fill_idle_slots(ADBNodePool *node_pool, int target);
+static void fill_all_idle_slots(void);
+static void check_slave_pools(time_t cur_time);
+static bool slave_slot_fallback(ADBNodePoolSlot *slot);
+static ADBNodePool *get_node_pool(DatabasePool *db_pool, Oid nodeoid, bool slave);
+static ADBNodePool *get_slave_pool(DatabasePool *db_pool, Oid nodeoid, int max_lag);
 static bool pool_exec_set_query(PGconn *conn, const char *query, StringInfo errMsg);
 static int pool_wait_pq(PGconn *conn);
 static int pq_custom_msg(PGconn *conn, char id, int msgLength);
@@ -260,6 +352,14 @@ static void close_idle_connection(void);
 static void check_idle_slot(void);
 static bool backend_is_alive(int pid);
 static void close_all_connection(PoolAgent *poolAgent);
+static int pool_stat_bucket(uint64 usec);
+static void pool_stat_connect_start(ADBNodePoolSlot *slot);
+static void pool_stat_connect_end(ADBNodePoolSlot *slot, bool succeeded);
+static void pool_stat_acquired(ADBNodePool *node_pool, uint64 usec);
+static int count_slot_list(dlist_head *head);
+static int count_active_slots(ADBNodePool *node_pool);
+static void send_pool_stats(PoolAgent *agent);
+static Datum pool_stat_histogram(const uint64 *hist);
 
 /* for hash DatabasePool */
 static HTAB *htab_database;
@@ -274,6 +374,7 @@ static DatabasePool *get_database_pool(const char *database, const char *user_na
 static void destroy_database_pool(DatabasePool *db_pool, bool bfree);
 
 static void pool_end_flush_msg(PoolPort *port, StringInfo buf);
+static void pool_attach_deferred(void);
 static void pool_sendstring(StringInfo buf, const char *str);
 static const char *pool_getstring(StringInfo buf);
 static void pool_sendint(StringInfo buf, int ival);
@@ -283,6 +384,8 @@ static void pool_send_nodeid_list(StringInfo buf, const List *list);
 static List* pool_get_nodeid_list(StringInfo buf);
 static void on_exit_pooler(int code, Datum arg);
 
+static PGcustumFuns pool_custom_funs = {NULL, NULL, pq_custom_msg};
+
 /* check slot state */
 #if 0
 static void check_all_slot_list(void)
@@ -406,17 +509,16 @@ static void PoolerLoop(void)
 	volatile Size poll_max;
 	Size i,count,poll_count;
 	struct pollfd * volatile poll_fd;
+	ADBNodePoolSlot ** volatile poll_slot;	/* slot of each poll_fd, NULL for agents */
 	struct pollfd *pollfd_tmp;
 	PoolAgent *agent;
-	List *polling_slot;		/* polling slot */
-	ListCell *lc;
 	DatabasePool *db_pool;
 	ADBNodePool *nodes_pool;
 	ADBNodePoolSlot *slot;
 	dlist_iter iter;
 	HASH_SEQ_STATUS hseq1,hseq2;
 	sigjmp_buf	local_sigjmp_buf;
-	time_t next_close_idle_time, cur_time;
+	time_t next_close_idle_time, cur_time, last_fill_time;
 	StringInfoData input_msg;
 	int rval;
 	pgsocket new_socket;
@@ -431,6 +533,7 @@ static void PoolerLoop(void)
 
 	poll_max = START_POOL_ALLOC;
 	poll_fd = palloc(START_POOL_ALLOC * sizeof(struct pollfd));
+	poll_slot = palloc0(START_POOL_ALLOC * sizeof(ADBNodePoolSlot*));
 	initStringInfo(&input_msg);
 	context = AllocSetContextCreate(CurrentMemoryContext,
 										"PoolerMemoryContext",
@@ -447,6 +550,7 @@ static void PoolerLoop(void)
 	on_proc_exit(on_exit_pooler, (Datum)0);
 	cur_time = time(NULL);
 	next_close_idle_time = cur_time + pool_time_out;
+	last_fill_time = cur_time;
 
 	if(sigsetjmp(local_sigjmp_buf, 1) != 0)
 	{
@@ -493,17 +597,19 @@ static void PoolerLoop(void)
 			}
 			if(poll_count == poll_max)
 			{
-				poll_fd = repalloc(poll_fd, (poll_max+STEP_POLL_ALLOC)*sizeof(*poll_fd));
-				poll_max += STEP_POLL_ALLOC;
+				/* grow geometrically, a connection storm adds agents by hundreds */
+				poll_fd = repalloc(poll_fd, poll_max*2*sizeof(*poll_fd));
+				poll_slot = repalloc(poll_slot, poll_max*2*sizeof(*poll_slot));
+				poll_max *= 2;
 			}
 			Assert(poll_count < poll_max);
 			poll_fd[poll_count].fd = Socket(agent->port);
 			poll_fd[poll_count].events = POLLERR|POLLHUP|rval;
+			poll_slot[poll_count] = NULL;
 			++poll_count;
 		}
 
 		/* poll busy slots */
-		polling_slot = NIL;
 		hash_seq_init(&hseq1, htab_database);
 		while((db_pool = hash_seq_search(&hseq1)) != NULL)
 		{
@@ -539,14 +645,15 @@ static void PoolerLoop(void)
 					{
 						if(poll_count == poll_max)
 						{
-							poll_fd = repalloc(poll_fd, (poll_max+STEP_POLL_ALLOC)*sizeof(*poll_fd));
-							poll_max += STEP_POLL_ALLOC;
+							poll_fd = repalloc(poll_fd, poll_max*2*sizeof(*poll_fd));
+							poll_slot = repalloc(poll_slot, poll_max*2*sizeof(*poll_slot));
+							poll_max *= 2;
 						}
 						Assert(poll_count < poll_max);
 						poll_fd[poll_count].fd = PQsocket(slot->conn);
 						poll_fd[poll_count].events = POLLERR|POLLHUP|rval;
+						poll_slot[poll_count] = slot;
 						++poll_count;
-						polling_slot = lappend(polling_slot, slot);
 					}
 				}
 			}
@@ -574,26 +681,17 @@ static void PoolerLoop(void)
 		/* processed socket is 0 */
 		count = 0;
 
-		/* process busy slot first */
-		pollfd_tmp = &(poll_fd[1]);	/* skip liten socket */
-		for(lc=list_head(polling_slot);lc && count < (Size)rval;lc=lnext(lc))
+		/* process busy slot first, they follow the listen and agent sockets */
+		for(i=agentCount+1;i<poll_count && count < (Size)rval;++i)
 		{
-			pgsocket sock;
-			slot = lfirst(lc);
-			sock = PQsocket(slot->conn);
-			/* find pollfd */
-			for(;;)
-			{
-				Assert(pollfd_tmp < &(poll_fd[poll_max]));
-				if(pollfd_tmp->fd == sock)
-					break;
-				pollfd_tmp = &(pollfd_tmp[1]);
-			}
-			Assert(sock == pollfd_tmp->fd);
-			if(pollfd_tmp->revents != 0)
-				process_slot_event(slot);
+			pollfd_tmp = &(poll_fd[i]);
+			if(pollfd_tmp->revents == 0)
+				continue;
+			slot = poll_slot[i];
+			Assert(slot != NULL && PQsocket(slot->conn) == pollfd_tmp->fd);
+			process_slot_event(slot);
+			++count;
 		}
-		/* don't need pfree polling_slot */
 
 		for(i=agentCount; i > 0 && count < (Size)rval;)
 		{
@@ -642,9 +740,17 @@ static void PoolerLoop(void)
 		/* close timeout idle slot(s) */
 		if(cur_time >= next_close_idle_time)
 		{
-			next_close_idle_time = close_timeout_idle_slots(cur_time - pool_time_out)
+			next_close_idle_time = close_timeout_idle_slots(cur_time - pool_time_out, PoolMinIdle)
 				+ pool_time_out;
 		}
+		if(cur_time != last_fill_time)
+		{
+			last_fill_time = cur_time;
+			/* keep pool_min_idle connections ready in every node pool */
+			if(PoolMinIdle > 0)
+				fill_all_idle_slots();
+			check_slave_pools(cur_time);
+		}
 	}
 }
 
@@ -828,6 +934,49 @@ PoolManagerConnect(PoolHandle *handle,
 	pool_sendstring(&buf, pgoptions);
 
 	pool_end_flush_msg(&(handle->port), &buf);
+
+	/* attached now, whether or not it was deferred */
+	if (deferred_database)
+	{
+		pfree(deferred_database);
+		pfree(deferred_user_name);
+		deferred_database = deferred_user_name = NULL;
+	}
+}
+
+/*
+ * Remember what PoolManagerConnect needs, to attach the session when it
+ * first talks to the pool manager.  Sessions of short lived clients which
+ * only run local queries then never make the pooler set up an agent and a
+ * database pool for them.
+ */
+void
+PoolManagerDeferConnect(const char *database, const char *user_name)
+{
+	AssertArg(database && user_name);
+	Assert(poolHandle == NULL);
+
+	deferred_database = MemoryContextStrdup(TopMemoryContext, database);
+	deferred_user_name = MemoryContextStrdup(TopMemoryContext, user_name);
+}
+
+/*
+ * Attach the session to the pool manager if PoolManagerDeferConnect put it
+ * off.  Every request to the pooler goes through here first.
+ */
+static void
+pool_attach_deferred(void)
+{
+	PoolHandle *handle;
+	char	   *options;
+
+	if (poolHandle != NULL || deferred_database == NULL)
+		return;
+
+	handle = GetPoolManagerHandle();
+	options = session_options();
+	PoolManagerConnect(handle, deferred_database, deferred_user_name, options);
+	pfree(options);
 }
 
 /*
@@ -838,8 +987,16 @@ void
 PoolManagerReconnect(void)
 {
 	PoolHandle *handle;
-	char *options = session_options();
+	char *options;
+
+	/* a session which put off attaching attaches as it would have at start */
+	if (poolHandle == NULL && deferred_database != NULL)
+	{
+		pool_attach_deferred();
+		return;
+	}
 
+	options = session_options();
 	if (poolHandle)
 	{
 		PoolManagerDisconnect();
@@ -859,6 +1016,7 @@ PoolManagerSetCommand(PoolCommandType command_type, const char *set_command)
 	StringInfoData buf;
 	int res = 0;
 
+	pool_attach_deferred();
 	if (poolHandle)
 	{
 		pq_beginmessage(&buf, PM_MSG_SET_COMMAND);
@@ -891,6 +1049,7 @@ PoolManagerSendLocalCommand(int dn_count, int* dn_list, int co_count, int* co_li
 {
 	StringInfoData buf;
 
+	pool_attach_deferred();
 	if (poolHandle == NULL)
 		return EOF;
 
@@ -924,6 +1083,8 @@ PoolManagerSendLocalCommand(int dn_count, int* dn_list, int co_count, int* co_li
 void
 PoolManagerLock(bool is_lock)
 {
+	pool_attach_deferred();
+
 	/* add by jiangmj for execute direct on (coord2) select pgxc_pool_reload()*/
 	if(IS_PGXC_COORDINATOR && IsConnFromCoord())
 	{
@@ -1041,7 +1202,8 @@ agent_destroy(PoolAgent *agent)
 		{
 			slot = dlist_container(ADBNodePoolSlot, dnode, miter.cur);
 			Assert(slot->slot_state == SLOT_STATE_RELEASED);
-			if(slot->owner == agent)
+			if(slot->owner == agent
+				|| (slot->owner == NULL && slot->last_user_pid == agent->pid))
 			{
 				Assert(slot->last_user_pid == agent->pid);
 				Assert(slot->current_list != NULL_SLOT);
@@ -1099,14 +1261,18 @@ PoolManagerDisconnect(void)
 
 /*
  * Get pooled connections
+ *
+ * The pool manager may connect the Datanodes of datanodelist which are also
+ * in slavelist to their hot standby slave instead, see get_slave_pool().
  */
 int *
-PoolManagerGetConnections(List *datanodelist, List *coordlist)
+PoolManagerGetConnections(List *datanodelist, List *coordlist, List *slavelist)
 {
 	StringInfoData buf;
 	pgsocket *fds;
 	int val;
 
+	pool_attach_deferred();
 	Assert(poolHandle != NULL);
 	if(datanodelist == NIL && coordlist == NIL)
 		return NULL;
@@ -1125,7 +1291,14 @@ PoolManagerGetConnections(List *datanodelist, List *coordlist)
 	/* coord count and oid(s) */
 	pool_send_nodeid_list(&buf, coordlist);
 
+	/* datanodes a slave may serve, with the lag allowed */
+	pool_send_nodeid_list(&buf, slavelist);
+	pool_sendint(&buf, DatanodeSlaveMaxLag);
+
 	/* send message */
+	TRACE_POSTGRESQL_POOL_ACQUIRE_START(list_length(datanodelist),
+										list_length(coordlist));
+	pgstat_report_wait_start(WAIT_EVENT_POOLER_GET_CONNECTIONS);
 	pool_putmessage(&poolHandle->port, (char)(buf.cursor), buf.data, buf.len);
 	pool_flush(&poolHandle->port);
 
@@ -1136,9 +1309,15 @@ PoolManagerGetConnections(List *datanodelist, List *coordlist)
 	fds = (int*)(buf.data);
 	if(pool_recvfds(&(poolHandle->port), fds, val) != 0)
 	{
+		pgstat_report_wait_end();
+		TRACE_POSTGRESQL_POOL_ACQUIRE_DONE(list_length(datanodelist),
+										   list_length(coordlist), false);
 		pfree(fds);
 		return NULL;
 	}
+	pgstat_report_wait_end();
+	TRACE_POSTGRESQL_POOL_ACQUIRE_DONE(list_length(datanodelist),
+									   list_length(coordlist), true);
 
 	return fds;
 }
@@ -1152,6 +1331,7 @@ PoolManagerAbortTransactions(char *dbname, char *username, int **proc_pids)
 {
 	StringInfoData buf;
 	AssertArg(proc_pids);
+	pool_attach_deferred();
 	Assert(poolHandle);
 
 	pq_beginmessage(&buf, PM_MSG_ABORT_TRANSACTIONS);
@@ -1178,6 +1358,8 @@ PoolManagerCleanConnection(List *datanodelist, List *coordlist, char *dbname, ch
 	ListCell *lc;
 	int ival;
 
+	pool_attach_deferred();
+
 	pq_beginmessage(&buf, PM_MSG_CLEAN_CONNECT);
 
 	/* list datanode(s) */
@@ -1216,6 +1398,7 @@ PoolManagerCheckConnectionInfo(void)
 {
 	int res;
 
+	pool_attach_deferred();
 	Assert(poolHandle);
 	PgxcNodeListAndCount();
 	pool_putmessage(&poolHandle->port, PM_MSG_CHECK_CONNECT, NULL, 0);
@@ -1236,6 +1419,7 @@ PoolManagerCheckConnectionInfo(void)
 void
 PoolManagerReloadConnectionInfo(void)
 {
+	pool_attach_deferred();
 	Assert(poolHandle);
 	PgxcNodeListAndCount();
 	pool_putmessage(&poolHandle->port, PM_MSG_RELOAD_CONNECT, NULL, 0);
@@ -1244,6 +1428,10 @@ PoolManagerReloadConnectionInfo(void)
 
 void PoolManagerReleaseConnections(bool force_close)
 {
+	/* a session not attached yet holds no connection */
+	if (poolHandle == NULL && deferred_database != NULL)
+		return;
+
 	Assert(poolHandle);
 	pool_putmessage(&(poolHandle->port)
 		, force_close ? PM_MSG_CLOSE_CONNECT:PM_MSG_RELEASE_CONNECT
@@ -1251,6 +1439,32 @@ void PoolManagerReleaseConnections(bool force_close)
 	pool_flush(&(poolHandle->port));
 }
 
+/*
+ * Return connections back to the pool, closing the ones of the listed
+ * nodes: their query is canceled and they are closed by the pooler, the
+ * session does not wait for them to answer.
+ */
+void PoolManagerDiscardConnections(int dn_count, int* dn_list, int co_count, int* co_list)
+{
+	StringInfoData buf;
+
+	if (dn_count == 0 && co_count == 0)
+	{
+		PoolManagerReleaseConnections(false);
+		return;
+	}
+
+	/* a session not attached yet holds no connection */
+	if (poolHandle == NULL && deferred_database != NULL)
+		return;
+
+	Assert(poolHandle);
+	pq_beginmessage(&buf, PM_MSG_DISCARD_CONNECT);
+	pool_sendint_array(&buf, dn_count, dn_list);
+	pool_sendint_array(&buf, co_count, co_list);
+	pool_end_flush_msg(&(poolHandle->port), &buf);
+}
+
 void PoolManagerCancelQuery(int dn_count, int* dn_list, int co_count, int* co_list)
 {
 	StringInfoData buf;
@@ -1292,9 +1506,11 @@ bool IsPoolHandle(void)
 
 /*
  * Given node identifier, dbname and user name build connection string.
- * Get node connection details from the shared memory node table
+ * Get node connection details from the shared memory node table.
+ * With slave it is the one of the hot standby slave of the node, NULL
+ * if the node has none.
  */
-static char * build_node_conn_str(Oid node, DatabasePool *dbPool)
+static char * build_node_conn_str(Oid node, DatabasePool *dbPool, bool slave)
 {
 	NodeDefinition *nodeDef;
 	char 		   *connstr;
@@ -1306,12 +1522,40 @@ static char * build_node_conn_str(Oid node, DatabasePool *dbPool)
 		return NULL;
 	}
 
-	connstr = PGXCNodeConnStr(NameStr(nodeDef->nodehost),
-							  nodeDef->nodeport,
-							  dbPool->db_info.database,
-							  dbPool->db_info.user_name,
-							  dbPool->db_info.pgoptions,
-							  IS_PGXC_COORDINATOR ? "coordinator" : "datanode");
+	if (slave)
+	{
+		/* connect the slave of the node instead, if it has one */
+		if (NameStr(nodeDef->nodeslavehost)[0] == '\0')
+		{
+			pfree(nodeDef);
+			return NULL;
+		}
+		nodeDef->nodehost = nodeDef->nodeslavehost;
+		nodeDef->nodeport = nodeDef->nodeslaveport;
+	}
+
+	if (enable_remote_compression)
+	{
+		/* Ask the node to compress the rows it sends on the connection */
+		char	   *pgoptions = psprintf("-c enable_remote_compression=on %s",
+										 dbPool->db_info.pgoptions);
+
+		connstr = PGXCNodeConnStr(NameStr(nodeDef->nodehost),
+								  nodeDef->nodeport,
+								  dbPool->db_info.database,
+								  dbPool->db_info.user_name,
+								  pgoptions,
+								  IS_PGXC_COORDINATOR ? "coordinator" : "datanode");
+		pfree(pgoptions);
+	} else
+	{
+		connstr = PGXCNodeConnStr(NameStr(nodeDef->nodehost),
+								  nodeDef->nodeport,
+								  dbPool->db_info.database,
+								  dbPool->db_info.user_name,
+								  dbPool->db_info.pgoptions,
+								  IS_PGXC_COORDINATOR ? "coordinator" : "datanode");
+	}
 	pfree(nodeDef);
 
 	return connstr;
@@ -1486,11 +1730,18 @@ static void agent_handle_input(PoolAgent * agent, StringInfo s)
 			break;
 		case PM_MSG_GET_CONNECT:
 			{
+				List *slavelist;
+				int slave_max_lag;
 				agent->agtm_port = pool_getint(s);
 				datanodelist = pool_get_nodeid_list(s);
 				coordlist = pool_get_nodeid_list(s);
-				agent_acquire_connections(agent, datanodelist, coordlist);
+				slavelist = pool_get_nodeid_list(s);
+				slave_max_lag = pool_getint(s);
+				INSTR_TIME_SET_CURRENT(agent->acquire_start);
+				agent_acquire_connections(agent, datanodelist, coordlist,
+										  slavelist, slave_max_lag);
 				AssertState(agent->list_wait != NIL);
+				list_free(slavelist);
 				list_free(coordlist);
 				list_free(datanodelist);
 			}
@@ -1500,8 +1751,16 @@ static void agent_handle_input(PoolAgent * agent, StringInfo s)
 			datanodelist = pool_get_nodeid_list(s);
 			coordlist = pool_get_nodeid_list(s);
 
-			cancel_query_on_connections(agent, agent->num_dn_connections, agent->dn_connections, datanodelist);
-			cancel_query_on_connections(agent, agent->num_coord_connections, agent->coord_connections, coordlist);
+			cancel_query_on_connections(agent, datanodelist, coordlist);
+			list_free(datanodelist);
+			list_free(coordlist);
+			break;
+		case PM_MSG_DISCARD_CONNECT:
+			err_calback.arg = NULL; /* do not send error if have */
+			datanodelist = pool_get_nodeid_list(s);
+			coordlist = pool_get_nodeid_list(s);
+			agent_discard_connections(agent, datanodelist, coordlist);
+			agent_release_connections(agent, false);
 			list_free(datanodelist);
 			list_free(coordlist);
 			break;
@@ -1549,6 +1808,9 @@ static void agent_handle_input(PoolAgent * agent, StringInfo s)
 				close_all_connection(agent);
 			}
 			break;
+		case PM_MSG_GET_STATS:
+			send_pool_stats(agent);
+			break;
 		default:
 			agent_destroy(agent);
 			ereport(WARNING, (errcode(ERRCODE_INTERNAL_ERROR),
@@ -1663,7 +1925,17 @@ send_session_params_:
 			case SLOT_STATE_LOCKED:
 				continue;
 			case SLOT_STATE_RELEASED:
-				if(slot->last_user_pid != agent->pid)
+				if(slot->last_user_pid != agent->pid && !slot->has_params)
+				{
+					/*
+					 * shared by pool_transaction_mode and nothing was SET on
+					 * it, no need "reset all"
+					 */
+					slot->last_agtm_port = 0;
+					INIT_SLOT_PARAMS_MAGIC(slot, session_magic);
+					INIT_SLOT_PARAMS_MAGIC(slot, local_magic);
+					goto send_session_params_;
+				}else if(slot->last_user_pid != agent->pid)
 				{
 					slot->last_agtm_port = 0;
 					if(!PQsendQuery(slot->conn, "reset all"))
@@ -1701,7 +1973,7 @@ send_local_params_:
 						break;
 					}
 					slot->slot_state = SLOT_STATE_QUERY_PARAMS_LOCAL;
-					COPY_PARAMS_MAGIC(slot->local_magic, agent->session_magic);
+					COPY_PARAMS_MAGIC(slot->local_magic, agent->local_magic);
 					Assert(slot->current_list != NULL_SLOT);
 					dlist_delete(&slot->dnode);
 					dlist_push_head(&slot->parent->busy_slot, &slot->dnode);
@@ -1749,7 +2021,9 @@ send_agtm_port_:
 							ereport(ERROR,
 								(errcode(ERRCODE_OUT_OF_MEMORY)
 								,errmsg("out of memory")));
-						}else if(PQstatus(slot->conn) != CONNECTION_BAD)
+						}
+						pool_stat_connect_start(slot);
+						if(PQstatus(slot->conn) != CONNECTION_BAD)
 						{
 							slot->slot_state = SLOT_STATE_CONNECTING;
 							slot->poll_state = PGRES_POLLING_WRITING;
@@ -1759,6 +2033,9 @@ send_agtm_port_:
 								dlist_push_head(&slot->parent->busy_slot, &slot->dnode);
 								slot->current_list = BUSY_SLOT;
 							}
+						}else
+						{
+							pool_stat_connect_end(slot, false);
 						}
 						slot->retry++;
 						ereport(DEBUG1, (errmsg("[pool] reconnect three thimes : %d, backend pid : %d",
@@ -1912,10 +2189,19 @@ re_find_:
 			PG_RE_THROW();
 		}PG_END_TRY();
 
-		foreach(lc,agent->list_wait)
 		{
-			slot = lfirst(lc);
-			slot->has_temp = agent->is_temp;
+			instr_time	duration;
+			uint64		usec;
+
+			INSTR_TIME_SET_CURRENT(duration);
+			INSTR_TIME_SUBTRACT(duration, agent->acquire_start);
+			usec = INSTR_TIME_GET_MICROSEC(duration);
+			foreach(lc,agent->list_wait)
+			{
+				slot = lfirst(lc);
+				slot->has_temp = agent->is_temp;
+				pool_stat_acquired(slot->parent, usec);
+			}
 		}
 		list_free(agent->list_wait);
 		agent->list_wait = NIL;
@@ -2055,18 +2341,27 @@ retry_clean_connection_:
 
 		foreach(lc, node_discard)
 		{
-			nodes_pool = hash_search(db_pool->htab_nodes, &(lfirst_oid(lc)), HASH_FIND, NULL);
-			if(nodes_pool == NULL)
-				continue;
+			ADBNodePoolKey key;
 
-			/* check slots is using in agents */
-			if(node_pool_in_using(nodes_pool) == false)
+			/* the pool of the node, then the one of its slave */
+			MemSet(&key, 0, sizeof(key));
+			key.nodeoid = lfirst_oid(lc);
+			do
 			{
-				destroy_node_pool(nodes_pool, true);
-			}else
-			{
-				res = CLEAN_CONNECTION_NOT_COMPLETED;
-			}
+				nodes_pool = hash_search(db_pool->htab_nodes, &key, HASH_FIND, NULL);
+				if(nodes_pool != NULL)
+				{
+					/* check slots is using in agents */
+					if(node_pool_in_using(nodes_pool) == false)
+					{
+						destroy_node_pool(nodes_pool, true);
+					}else
+					{
+						res = CLEAN_CONNECTION_NOT_COMPLETED;
+					}
+				}
+				key.slave = !key.slave;
+			}while(key.slave);
 		}
 
 		/* clean db pool if it's empty */
@@ -2082,6 +2377,97 @@ retry_clean_connection_:
 	return res;
 }
 
+/*
+ * like check_slot_status, but check all slots of agent by one poll()
+ */
+static void check_agent_slots_status(PoolAgent *agent)
+{
+	static struct pollfd *poll_fds = NULL;
+	static Size max_fds = 0;
+	ADBNodePoolSlot *slot;
+	Size count,i,n;
+	int rval;
+
+	AssertArg(agent);
+	count = agent->num_dn_connections + agent->num_coord_connections;
+	if(count == 0)
+		return;
+	if(max_fds < count)
+	{
+		Size new_max = Max(max_fds, 64);
+		while(new_max < count)
+			new_max *= 2;
+		if(poll_fds == NULL)
+			poll_fds = MemoryContextAlloc(PoolerMemoryContext, new_max * sizeof(*poll_fds));
+		else
+			poll_fds = repalloc(poll_fds, new_max * sizeof(*poll_fds));
+		max_fds = new_max;
+	}
+
+	for(i=n=0;i<count;++i)
+	{
+		ADBNodePoolSlot **pslot;
+		pslot = (i < agent->num_dn_connections ? &(agent->dn_connections[i])
+					: &(agent->coord_connections[i - agent->num_dn_connections]));
+		slot = *pslot;
+		if(slot && PQsocket(slot->conn) == PGINVALID_SOCKET)
+		{
+			destroy_slot(slot, false);
+			*pslot = slot = NULL;
+		}
+		/* invalid socket be ignored by poll() */
+		poll_fds[i].fd = slot ? PQsocket(slot->conn) : PGINVALID_SOCKET;
+		poll_fds[i].events = POLLIN|POLLPRI;
+		poll_fds[i].revents = 0;
+		if(slot)
+			++n;
+	}
+	if(n == 0)
+		return;
+
+re_poll_:
+	rval = poll(poll_fds, count, 0);
+	CHECK_FOR_INTERRUPTS();
+	if(rval == 0)
+		return;	/* all slots OK */
+	if(rval < 0)
+	{
+		if(errno == EINTR
+#if defined(EAGAIN) && (EAGAIN!=EINTR)
+			|| errno == EAGAIN
+#endif
+			)
+		{
+			goto re_poll_;
+		}
+		/* check them one by one */
+		ereport(WARNING, (errcode_for_socket_access(),
+			errmsg("check_agent_slots_status poll error:%m")));
+	}
+
+	for(i=0;i<count;++i)
+	{
+		ADBNodePoolSlot **pslot;
+		pslot = (i < agent->num_dn_connections ? &(agent->dn_connections[i])
+					: &(agent->coord_connections[i - agent->num_dn_connections]));
+		slot = *pslot;
+		if(slot == NULL)
+			continue;
+		if(rval > 0 && poll_fds[i].revents == 0)
+			continue;
+		if(rval < 0 && check_slot_status(slot) != false)
+			continue;
+		if(rval > 0)
+		{
+			ereport(WARNING, (errcode(ERRCODE_INTERNAL_ERROR),
+				errmsg("check_slot_status connect has unread data or EOF. last backend is %d", slot->last_user_pid)));
+			destroy_slot(slot, false);
+		}
+		/* destroyed */
+		*pslot = NULL;
+	}
+}
+
 static bool check_slot_status(ADBNodePoolSlot *slot)
 {
 	struct pollfd poll_fd;
@@ -2233,13 +2619,14 @@ static void destroy_slot(ADBNodePoolSlot *slot, bool send_cancel)
 	if(slot->conn)
 	{
 		if(send_cancel)
-			PQrequestCancel(slot->conn);
+			cancel_slots(&slot, 1);
 		PQfinish(slot->conn);
 		slot->conn = NULL;
 	}
 	slot->owner = NULL;
 	slot->last_user_pid = 0;
 	slot->last_agtm_port = 0;
+	slot->has_params = false;
 	slot->slot_state = SLOT_STATE_UNINIT;
 	if(slot->last_error)
 	{
@@ -2262,15 +2649,22 @@ static void release_slot(ADBNodePoolSlot *slot, bool force_close)
 		destroy_slot(slot, false);
 	}else if(check_slot_status(slot) != false)
 	{
-		slot->slot_state = SLOT_STATE_RELEASED;
-		Assert(slot->current_list == NULL_SLOT);
-		dlist_push_head(&slot->parent->released_slot, &slot->dnode);
-		slot->current_list = RELEASED_SLOT;
+		push_released_slot(slot);
 	}
 
 	check_all_slot_list();
 }
 
+/* put a checked slot to released list */
+static void push_released_slot(ADBNodePoolSlot *slot)
+{
+	AssertArg(slot);
+	slot->slot_state = SLOT_STATE_RELEASED;
+	Assert(slot->current_list == NULL_SLOT);
+	dlist_push_head(&slot->parent->released_slot, &slot->dnode);
+	slot->current_list = RELEASED_SLOT;
+}
+
 static void idle_slot(ADBNodePoolSlot *slot, bool reset)
 {
 	AssertArg(slot);
@@ -2298,8 +2692,11 @@ static void idle_slot(ADBNodePoolSlot *slot, bool reset)
 			default:
 				break;
 		}
-		/*  SLOT_STATE_ERROR  state will be destory */
-		if(!PQsendQuery(slot->conn, "reset all"))
+		/*
+		 * SLOT_STATE_ERROR  state will be destory, slots of a slave pool
+		 * measure its lag at the same time
+		 */
+		if(!PQsendQuery(slot->conn, slot->parent->slave ? "reset all;" SLAVE_LAG_QUERY : "reset all"))
 		{
 			destroy_slot(slot, false);
 			return;
@@ -2320,6 +2717,23 @@ static void idle_slot(ADBNodePoolSlot *slot, bool reset)
 	check_all_slot_list();
 }
 
+/*
+ * let a released slot can be taken by other agents,
+ * the slot stay in released list and keep last_user_pid,
+ * so agent can get it back cheap if nobody took it
+ */
+static void share_slot(ADBNodePoolSlot *slot, PoolAgent *agent)
+{
+	AssertArg(slot && agent);
+	if(slot->slot_state != SLOT_STATE_RELEASED)
+		return;	/* destroyed by release_slot */
+	Assert(slot->owner == agent && slot->current_list == RELEASED_SLOT);
+
+	slot->owner = NULL;
+	slot->released_time = time(NULL);
+	slot->has_params = (agent->session_params != NULL || agent->local_params != NULL);
+}
+
 static void destroy_node_pool(ADBNodePool *node_pool, bool bfree)
 {
 	ADBNodePoolSlot *slot;
@@ -2397,10 +2811,11 @@ static bool node_pool_in_using(ADBNodePool *node_pool)
 }
 
 /*
- * close idle slots when slot->released_time <= timeout
- * return earliest idle slot
+ * close unused idle slots with slot->released_time <= timeout, but leave at
+ * least "keep" of them in each node pool (pool_min_idle)
+ * return release time of the earliest idle slot left open
  */
-static time_t close_timeout_idle_slots(time_t timeout)
+static time_t close_timeout_idle_slots(time_t timeout, int keep)
 {
 	HASH_SEQ_STATUS hash_database_stats;
 	HASH_SEQ_STATUS hash_nodepool_status;
@@ -2408,7 +2823,9 @@ static time_t close_timeout_idle_slots(time_t timeout)
 	ADBNodePool *node_pool;
 	ADBNodePoolSlot *slot;
 	dlist_mutable_iter miter;
+	dlist_iter iter;
 	time_t earliest_time = time(NULL);
+	int unused;
 
 	hash_seq_init(&hash_database_stats, htab_database);
 	while((db_pool = hash_seq_search(&hash_database_stats)) != NULL)
@@ -2416,6 +2833,16 @@ static time_t close_timeout_idle_slots(time_t timeout)
 		hash_seq_init(&hash_nodepool_status, db_pool->htab_nodes);
 		while((node_pool = hash_seq_search(&hash_nodepool_status)) != NULL)
 		{
+			unused = 0;
+			if(keep > 0)
+			{
+				dlist_foreach(iter, &node_pool->idle_slot)
+				{
+					slot = dlist_container(ADBNodePoolSlot, dnode, iter.cur);
+					if(slot->owner == NULL)
+						++unused;
+				}
+			}
 			dlist_foreach_modify(miter, &node_pool->idle_slot)
 			{
 				slot = dlist_container(ADBNodePoolSlot, dnode, miter.cur);
@@ -2423,12 +2850,18 @@ static time_t close_timeout_idle_slots(time_t timeout)
 				if(slot->owner != NULL)
 				{
 					continue;
+				}else if(unused <= keep && keep > 0)
+				{
+					/* keep the rest for pool_min_idle */
+					break;
 				}else if(slot->released_time <= timeout)
 				{
 					Assert(slot->current_list != NULL_SLOT);
 					dlist_delete(miter.cur);
 					slot->current_list = NULL_SLOT;
 					destroy_slot(slot, false);
+					node_pool->stats.idle_closes++;
+					--unused;
 				}else if(earliest_time > slot->released_time)
 				{
 					earliest_time = slot->released_time;
@@ -2469,9 +2902,9 @@ static DatabasePool *get_database_pool(const char *database, const char *user_na
 			tmp_pool.db_info.pgoptions = pstrdup(pgoptions);
 
 			memset(&hctl, 0, sizeof(hctl));
-			hctl.keysize = sizeof(Oid);
+			hctl.keysize = sizeof(ADBNodePoolKey);
 			hctl.entrysize = sizeof(ADBNodePool);
-			hctl.hash = oid_hash;
+			hctl.hash = tag_hash;
 			hctl.hcxt = TopMemoryContext;
 			tmp_pool.htab_nodes = hash_create("hash ADBNodePool", 97, &hctl
 				, HASH_ELEM | HASH_CONTEXT | HASH_FUNCTION);
@@ -2522,6 +2955,7 @@ static void agent_release_connections(PoolAgent *agent, bool force_destroy)
 {
 	ADBNodePoolSlot *slot;
 	Size i;
+	bool share;
 	AssertArg(agent);
 #ifdef ADB
         if (!force_destroy && cluster_ex_lock_held)
@@ -2531,6 +2965,17 @@ static void agent_release_connections(PoolAgent *agent, bool force_destroy)
         }
 #endif
 
+	/*
+	 * In transaction mode released slots have no owner, other agents can
+	 * take them when no idle slot left. A session with temporary objects
+	 * must keep its backends.
+	 */
+	share = (PoolTransactionMode && !agent->is_temp);
+
+	/* check all slots by one poll(), bad slots are destroyed */
+	if(!force_destroy)
+		check_agent_slots_status(agent);
+
 	for(i=0;i<agent->num_dn_connections;++i)
 	{
 		Assert(agent->dn_connections);
@@ -2540,7 +2985,12 @@ static void agent_release_connections(PoolAgent *agent, bool force_destroy)
 			Assert(slot->slot_state == SLOT_STATE_LOCKED
 				&& slot->owner == agent
 				&& slot->last_user_pid == agent->pid);
-			release_slot(slot, force_destroy);
+			if(force_destroy)
+				destroy_slot(slot, false);
+			else
+				push_released_slot(slot);
+			if(share && !slot->has_temp)
+				share_slot(slot, agent);
 			agent->dn_connections[i] = NULL;
 		}
 	}
@@ -2553,7 +3003,12 @@ static void agent_release_connections(PoolAgent *agent, bool force_destroy)
 			Assert(slot->slot_state == SLOT_STATE_LOCKED
 				&& slot->owner == agent
 				&& slot->last_user_pid == agent->pid);
-			release_slot(slot, force_destroy);
+			if(force_destroy)
+				destroy_slot(slot, false);
+			else
+				push_released_slot(slot);
+			if(share && !slot->has_temp)
+				share_slot(slot, agent);
 			agent->coord_connections[i] = NULL;
 		}
 	}
@@ -2622,13 +3077,40 @@ static void process_slot_event(ADBNodePoolSlot *slot)
 		switch(slot->poll_state)
 		{
 		case PGRES_POLLING_FAILED:
+			pool_stat_connect_end(slot, false);
+			if(slot->parent->slave)
+			{
+				/* don't use the slave until its lag is measured again */
+				slot->parent->replay_lag = -1;
+				if(slot->owner != NULL && slave_slot_fallback(slot))
+					break;
+			}
+			if(slot->owner == NULL)
+			{
+				/* warming slot, nobody waits for it */
+				Assert(slot->current_list == BUSY_SLOT);
+				dlist_delete(&slot->dnode);
+				slot->current_list = NULL_SLOT;
+				destroy_slot(slot, false);
+				break;
+			}
 			save_slot_error(slot);
 			break;
 		case PGRES_POLLING_READING:
 		case PGRES_POLLING_WRITING:
 			break;
 		case PGRES_POLLING_OK:
+			pool_stat_connect_end(slot, true);
 			slot->slot_state = SLOT_STATE_IDLE;
+			if(slot->owner == NULL)
+			{
+				/* warming slot, let it to idle queue */
+				Assert(slot->current_list == BUSY_SLOT);
+				slot->released_time = time(NULL);
+				dlist_delete(&slot->dnode);
+				dlist_push_head(&slot->parent->idle_slot, &slot->dnode);
+				slot->current_list = IDLE_SLOT;
+			}
 			break;
 		default:
 			break;
@@ -2668,6 +3150,7 @@ static void process_slot_event(ADBNodePoolSlot *slot)
 			{
 				INIT_SLOT_PARAMS_MAGIC(slot, session_magic);
 				INIT_SLOT_PARAMS_MAGIC(slot, local_magic);
+				slot->has_params = false;
 			}
 
 			if(slot->owner == NULL)
@@ -2743,6 +3226,15 @@ reget_slot_result_:
 			}PG_END_TRY();
 		}
 		slot->slot_state = SLOT_STATE_ERROR;
+	}else if(PGRES_TUPLES_OK == PQresultStatus(result) && slot->parent->slave)
+	{
+		/* answer of SLAVE_LAG_QUERY */
+		ADBNodePool *node_pool = slot->parent;
+		if(PQntuples(result) == 1 && !PQgetisnull(result, 0, 0))
+			node_pool->replay_lag = strtol(PQgetvalue(result, 0, 0), NULL, 10);
+		else
+			node_pool->replay_lag = -1;
+		node_pool->lag_time = time(NULL);
 	}
 	PQclear(result);
 	if(PQisBusy(slot->conn))
@@ -2750,7 +3242,8 @@ reget_slot_result_:
 	goto reget_slot_result_;
 }
 
-static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, const List *node_list, PoolAgent *agent)
+static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, const List *node_list, PoolAgent *agent,
+									const List *slavelist, int slave_max_lag)
 {
 	ListCell *lc;
 	ADBNodePoolSlot *slot,*tmp_slot;
@@ -2758,7 +3251,6 @@ static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, co
 	MemoryContext oldcontex;
 	dlist_iter iter;
 	int index;
-	bool found;
 
 	AssertArg(slots && oids && agent && agent->db_pool);
 
@@ -2771,28 +3263,12 @@ static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, co
 			ereport(ERROR, (errmsg("double get node connect for oid %u", oids[index])));
 		}
 
-		node_pool = hash_search(agent->db_pool->htab_nodes, oids+index, HASH_ENTER, &found);
-		if(!found)
-		{
-			HTAB * volatile htab = agent->db_pool->htab_nodes;
-			const Oid * volatile poid = oids+index;
-			node_pool->parent = agent->db_pool;
-			PG_TRY();
-			{
-				char *str = build_node_conn_str(node_pool->nodeoid, node_pool->parent);
-				node_pool->connstr =MemoryContextStrdup(TopMemoryContext, str);
-				pfree(str);
-			}PG_CATCH();
-			{
-				hash_search(htab, poid, HASH_REMOVE, &found);
-				PG_RE_THROW();
-			}PG_END_TRY();
-			node_pool->last_idle = 0;
-			dlist_init(&node_pool->uninit_slot);
-			dlist_init(&node_pool->released_slot);
-			dlist_init(&node_pool->idle_slot);
-			dlist_init(&node_pool->busy_slot);
-		}
+		/* slaves know nothing of the temporary objects of the session */
+		node_pool = NULL;
+		if(!agent->is_temp && list_member_int(slavelist, index))
+			node_pool = get_slave_pool(agent->db_pool, oids[index], slave_max_lag);
+		if(node_pool == NULL)
+			node_pool = get_node_pool(agent->db_pool, oids[index], false);
 		Assert(node_pool->nodeoid == oids[index]);
 
 		/*
@@ -2810,7 +3286,7 @@ static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, co
 			AssertState(tmp_slot->slot_state == SLOT_STATE_RELEASED);
 			if(tmp_slot->last_user_pid == agent->pid)
 			{
-				AssertState(tmp_slot->owner == agent);
+				AssertState(tmp_slot->owner == agent || tmp_slot->owner == NULL);
 				slot = tmp_slot;
 				ereport(DEBUG1,
 					(errmsg("[pool] get slot from released_slot, backend pid : %d,",
@@ -2837,6 +3313,24 @@ static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, co
 			}
 		}
 
+		/* third find released slot shared by other agent */
+		if(slot == NULL && PoolTransactionMode)
+		{
+			dlist_foreach(iter, &node_pool->released_slot)
+			{
+				tmp_slot = dlist_container(ADBNodePoolSlot, dnode, iter.cur);
+				AssertState(tmp_slot->slot_state == SLOT_STATE_RELEASED);
+				if(tmp_slot->owner == NULL)
+				{
+					slot = tmp_slot;
+					ereport(DEBUG1,
+					(errmsg("[pool] get slot shared by backend %d, backend pid : %d,",
+					slot->last_user_pid, agent->pid)));
+					break;
+				}
+			}
+		}
+
 		/* not found, we use a uninit slot */
 		if(slot == NULL)
 		{
@@ -2875,11 +3369,10 @@ static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, co
 
 		if(slot->slot_state == SLOT_STATE_UNINIT)
 		{
-			static PGcustumFuns funs = {NULL, NULL, pq_custom_msg};
 			Assert(slot->parent == node_pool);
 			if(node_pool->connstr == NULL)
 			{
-				char *str = build_node_conn_str(node_pool->nodeoid, node_pool->parent);
+				char *str = build_node_conn_str(node_pool->nodeoid, node_pool->parent, node_pool->slave);
 				node_pool->connstr =MemoryContextStrdup(TopMemoryContext, str);
 			}
 			slot->conn = PQconnectStart(node_pool->connstr);
@@ -2888,14 +3381,17 @@ static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, co
 				ereport(ERROR,
 					(errcode(ERRCODE_OUT_OF_MEMORY)
 					,errmsg("out of memory")));
-			}else if(PQstatus(slot->conn) == CONNECTION_BAD)
+			}
+			pool_stat_connect_start(slot);
+			if(PQstatus(slot->conn) == CONNECTION_BAD)
 			{
+				pool_stat_connect_end(slot, false);
 				ereport(ERROR,
 					(errmsg("%s", PQerrorMessage(slot->conn))));
 			}
 			slot->slot_state = SLOT_STATE_CONNECTING;
 			slot->poll_state = PGRES_POLLING_WRITING;
-			slot->conn->funs = &funs;
+			slot->conn->funs = &pool_custom_funs;
 			slot->retry = 0;
 			ereport(DEBUG1,
 					(errmsg("[pool] begin connect, connstr : %s,backend pid :%d slot state SLOT_STATE_CONNECTING",
@@ -2911,21 +3407,283 @@ static void agent_acquire_conn_list(ADBNodePoolSlot **slots, const Oid *oids, co
 	}
 }
 
-static void agent_acquire_connections(PoolAgent *agent, const List *datanodelist, const List *coordlist)
+/* find node pool, if not exist create a new */
+static ADBNodePool *get_node_pool(DatabasePool *db_pool, Oid nodeoid, bool slave)
 {
-	AssertArg(agent);
+	ADBNodePool *node_pool;
+	ADBNodePoolKey key;
+	bool found;
 
-	/* Check if pooler can accept those requests */
-	if (list_length(datanodelist) > agent->num_dn_connections ||
-			list_length(coordlist) > agent->num_coord_connections)
+	/* keys are compared as is, clear the padding */
+	MemSet(&key, 0, sizeof(key));
+	key.nodeoid = nodeoid;
+	key.slave = slave;
+	node_pool = hash_search(db_pool->htab_nodes, &key, HASH_ENTER, &found);
+	if(!found)
 	{
-		ereport(ERROR, (errmsg("invalid connection id form backend %d", agent->pid)));
+		HTAB * volatile htab = db_pool->htab_nodes;
+		ADBNodePoolKey * volatile pkey = &key;
+		node_pool->parent = db_pool;
+		PG_TRY();
+		{
+			char *str = build_node_conn_str(node_pool->nodeoid, node_pool->parent, slave);
+			node_pool->connstr =MemoryContextStrdup(TopMemoryContext, str);
+			pfree(str);
+		}PG_CATCH();
+		{
+			hash_search(htab, (const void*)pkey, HASH_REMOVE, &found);
+			PG_RE_THROW();
+		}PG_END_TRY();
+		node_pool->last_idle = 0;
+		MemSet(&node_pool->stats, 0, sizeof(node_pool->stats));
+		node_pool->replay_lag = -1;
+		node_pool->lag_time = 0;
+		node_pool->lag_sent_time = 0;
+		dlist_init(&node_pool->uninit_slot);
+		dlist_init(&node_pool->released_slot);
+		dlist_init(&node_pool->idle_slot);
+		dlist_init(&node_pool->busy_slot);
 	}
+	return node_pool;
+}
 
-	PG_TRY();
+/*
+ * start connecting new slots in background until node pool has
+ * pool_min_idle unused idle slots, counting slots already connecting
+ */
+static void fill_idle_slots(ADBNodePool *node_pool, int target)
+{
+	ADBNodePoolSlot *slot;
+	dlist_iter iter;
+	int count;
+
+	if(node_pool->connstr == NULL)
+		return;
+
+	count = 0;
+	dlist_foreach(iter, &node_pool->idle_slot)
 	{
-		agent_acquire_conn_list(agent->dn_connections, agent->datanode_oids, datanodelist, agent);
-		agent_acquire_conn_list(agent->coord_connections, agent->coord_oids, coordlist, agent);
+		slot = dlist_container(ADBNodePoolSlot, dnode, iter.cur);
+		if(slot->owner == NULL)
+			++count;
+	}
+	dlist_foreach(iter, &node_pool->busy_slot)
+	{
+		slot = dlist_container(ADBNodePoolSlot, dnode, iter.cur);
+		if(slot->owner == NULL && slot->slot_state == SLOT_STATE_CONNECTING)
+			++count;
+	}
+
+	for(;count<target;++count)
+	{
+		if(dlist_is_empty(&node_pool->uninit_slot))
+		{
+			slot = MemoryContextAllocZero(PoolerMemoryContext, sizeof(*slot));
+			slot->parent = node_pool;
+			slot->slot_state = SLOT_STATE_UNINIT;
+			INIT_SLOT_PARAMS_MAGIC(slot, session_magic);
+			INIT_SLOT_PARAMS_MAGIC(slot, local_magic);
+		}else
+		{
+			slot = dlist_container(ADBNodePoolSlot, dnode,
+				dlist_pop_head_node(&node_pool->uninit_slot));
+			Assert(slot->slot_state == SLOT_STATE_UNINIT && slot->owner == NULL);
+		}
+
+		slot->conn = PQconnectStart(node_pool->connstr);
+		if(slot->conn == NULL || PQstatus(slot->conn) == CONNECTION_BAD)
+		{
+			/* try again next time */
+			if(slot->conn)
+			{
+				pool_stat_connect_start(slot);
+				pool_stat_connect_end(slot, false);
+				PQfinish(slot->conn);
+				slot->conn = NULL;
+			}
+			dlist_push_head(&node_pool->uninit_slot, &slot->dnode);
+			slot->current_list = UNINIT_SLOT;
+			break;
+		}
+		pool_stat_connect_start(slot);
+		slot->slot_state = SLOT_STATE_CONNECTING;
+		slot->poll_state = PGRES_POLLING_WRITING;
+		slot->conn->funs = &pool_custom_funs;
+		slot->retry = 0;
+		dlist_push_head(&node_pool->busy_slot, &slot->dnode);
+		slot->current_list = BUSY_SLOT;
+	}
+}
+
+static void fill_all_idle_slots(void)
+{
+	HASH_SEQ_STATUS hash_database_stats;
+	HASH_SEQ_STATUS hash_nodepool_status;
+	DatabasePool *db_pool;
+	ADBNodePool *node_pool;
+
+	hash_seq_init(&hash_database_stats, htab_database);
+	while((db_pool = hash_seq_search(&hash_database_stats)) != NULL)
+	{
+		hash_seq_init(&hash_nodepool_status, db_pool->htab_nodes);
+		while((node_pool = hash_seq_search(&hash_nodepool_status)) != NULL)
+			fill_idle_slots(node_pool, Min(PoolMinIdle, MaxPoolSize));
+	}
+}
+
+/*
+ * Measure the lag of the slave pools whose last lag is older than
+ * SLAVE_LAG_CHECK_INTERVAL, on one of their idle slots.  A slave pool
+ * with no slot at all gets one connected first.
+ */
+static void check_slave_pools(time_t cur_time)
+{
+	HASH_SEQ_STATUS hash_database_stats;
+	HASH_SEQ_STATUS hash_nodepool_status;
+	DatabasePool *db_pool;
+	ADBNodePool *node_pool;
+	ADBNodePoolSlot *slot;
+	dlist_iter iter;
+
+	hash_seq_init(&hash_database_stats, htab_database);
+	while((db_pool = hash_seq_search(&hash_database_stats)) != NULL)
+	{
+		hash_seq_init(&hash_nodepool_status, db_pool->htab_nodes);
+		while((node_pool = hash_seq_search(&hash_nodepool_status)) != NULL)
+		{
+			if(!node_pool->slave
+				|| cur_time - node_pool->lag_time < SLAVE_LAG_CHECK_INTERVAL
+				|| cur_time - node_pool->lag_sent_time < SLAVE_LAG_CHECK_INTERVAL)
+				continue;
+
+			slot = NULL;
+			dlist_foreach(iter, &node_pool->idle_slot)
+			{
+				slot = dlist_container(ADBNodePoolSlot, dnode, iter.cur);
+				if(slot->owner == NULL)
+					break;
+				slot = NULL;
+			}
+			node_pool->lag_sent_time = cur_time;
+			if(slot == NULL)
+			{
+				fill_idle_slots(node_pool, 1);
+				continue;
+			}
+
+			/* it goes back to idle once the answer is received */
+			Assert(slot->current_list == IDLE_SLOT);
+			dlist_delete(&slot->dnode);
+			slot->current_list = NULL_SLOT;
+			if(!PQsendQuery(slot->conn, SLAVE_LAG_QUERY))
+			{
+				destroy_slot(slot, false);
+				continue;
+			}
+			slot->slot_state = SLOT_STATE_QUERY_RESET_ALL;
+			dlist_push_head(&node_pool->busy_slot, &slot->dnode);
+			slot->current_list = BUSY_SLOT;
+		}
+	}
+}
+
+/*
+ * The slave pool of datanode nodeoid if its last lag was measured less
+ * than SLAVE_LAG_MAX_AGE seconds ago and is at most max_lag milliseconds,
+ * otherwise NULL, also if the node has no slave.  The pool is created at
+ * once though so that check_slave_pools() starts measuring its lag.
+ */
+static ADBNodePool *get_slave_pool(DatabasePool *db_pool, Oid nodeoid, int max_lag)
+{
+	ADBNodePool *node_pool;
+	ADBNodePoolKey key;
+	NodeDefinition *nodeDef;
+
+	MemSet(&key, 0, sizeof(key));
+	key.nodeoid = nodeoid;
+	key.slave = true;
+	node_pool = hash_search(db_pool->htab_nodes, &key, HASH_FIND, NULL);
+	if(node_pool == NULL)
+	{
+		nodeDef = PgxcNodeGetDefinition(nodeoid);
+		if(nodeDef == NULL || NameStr(nodeDef->nodeslavehost)[0] == '\0')
+		{
+			PFREE_SAFE(nodeDef);
+			return NULL;
+		}
+		pfree(nodeDef);
+		(void)get_node_pool(db_pool, nodeoid, true);
+		return NULL;
+	}
+
+	if(node_pool->connstr == NULL
+		|| node_pool->replay_lag < 0
+		|| node_pool->replay_lag > max_lag
+		|| time(NULL) - node_pool->lag_time > SLAVE_LAG_MAX_AGE)
+		return NULL;
+	return node_pool;
+}
+
+/*
+ * A slot of a slave pool acquired by an agent failed to connect, connect it
+ * to the node itself instead.  Returns false if that could not be started,
+ * the slot is left as it was then.
+ */
+static bool slave_slot_fallback(ADBNodePoolSlot *slot)
+{
+	ADBNodePool *node_pool;
+	PGconn *conn;
+
+	AssertArg(slot->parent->slave && slot->owner != NULL);
+	node_pool = get_node_pool(slot->parent->parent, slot->parent->nodeoid, false);
+	if(node_pool->connstr == NULL)
+		return false;
+
+	conn = PQconnectStart(node_pool->connstr);
+	if(conn == NULL)
+		return false;
+	if(PQstatus(conn) == CONNECTION_BAD)
+	{
+		PQfinish(conn);
+		return false;
+	}
+
+	ereport(LOG,
+			(errmsg("[pool] can not connect slave of node %u, using the node: %s",
+					node_pool->nodeoid, PQerrorMessage(slot->conn))));
+	PQfinish(slot->conn);
+	slot->conn = conn;
+	Assert(slot->current_list == BUSY_SLOT);
+	dlist_delete(&slot->dnode);
+	slot->parent = node_pool;
+	pool_stat_connect_start(slot);
+	slot->slot_state = SLOT_STATE_CONNECTING;
+	slot->poll_state = PGRES_POLLING_WRITING;
+	slot->conn->funs = &pool_custom_funs;
+	slot->retry = 0;
+	dlist_push_head(&node_pool->busy_slot, &slot->dnode);
+	slot->current_list = BUSY_SLOT;
+	return true;
+}
+
+static void agent_acquire_connections(PoolAgent *agent, const List *datanodelist, const List *coordlist,
+									  const List *slavelist, int slave_max_lag)
+{
+	AssertArg(agent);
+
+	/* Check if pooler can accept those requests */
+	if (list_length(datanodelist) > agent->num_dn_connections ||
+			list_length(coordlist) > agent->num_coord_connections)
+	{
+		ereport(ERROR, (errmsg("invalid connection id form backend %d", agent->pid)));
+	}
+
+	PG_TRY();
+	{
+		agent_acquire_conn_list(agent->dn_connections, agent->datanode_oids, datanodelist, agent,
+								slavelist, slave_max_lag);
+		agent_acquire_conn_list(agent->coord_connections, agent->coord_oids, coordlist, agent,
+								NIL, 0);
 	}PG_CATCH();
 	{
 		ListCell *lc;
@@ -2947,33 +3705,209 @@ static void agent_acquire_connections(PoolAgent *agent, const List *datanodelist
 	}PG_END_TRY();
 }
 
-static void cancel_query_on_connections(PoolAgent *agent, Size count, ADBNodePoolSlot **slots, const List *nodelist)
+/*
+ * Collect the slots of the listed nodes locked by the agent, taking them
+ * away from the agent if "detach".  Returns their count.
+ */
+static int agent_locked_slots(PoolAgent *agent, const List *datanodelist, const List *coordlist,
+							  ADBNodePoolSlot **slots, bool detach)
 {
 	const ListCell *lc;
 	ADBNodePoolSlot *slot;
 	Size node_idx;
+	int count = 0;
 
-	if(agent == NULL || slots == NULL || nodelist == NIL)
-		return;
+	foreach(lc, datanodelist)
+	{
+		node_idx = (Size)lfirst_int(lc);
+		if(node_idx >= agent->num_dn_connections)
+			continue;
+		slot = agent->dn_connections[node_idx];
+		/* need an error ? */
+		if(slot == NULL || slot->last_user_pid != agent->pid || slot->slot_state != SLOT_STATE_LOCKED)
+			continue;
+		slots[count++] = slot;
+		if(detach)
+			agent->dn_connections[node_idx] = NULL;
+	}
 
-	foreach(lc, nodelist)
+	foreach(lc, coordlist)
 	{
 		node_idx = (Size)lfirst_int(lc);
+		if(node_idx >= agent->num_coord_connections)
+			continue;
+		slot = agent->coord_connections[node_idx];
+		if(slot == NULL || slot->last_user_pid != agent->pid || slot->slot_state != SLOT_STATE_LOCKED)
+			continue;
+		slots[count++] = slot;
+		if(detach)
+			agent->coord_connections[node_idx] = NULL;
+	}
+
+	return count;
+}
+
+static void cancel_query_on_connections(PoolAgent *agent, const List *datanodelist, const List *coordlist)
+{
+	ADBNodePoolSlot **slots;
+	int count;
+
+	if(agent == NULL || (datanodelist == NIL && coordlist == NIL))
+		return;
+
+	slots = palloc(sizeof(ADBNodePoolSlot*) * (list_length(datanodelist) + list_length(coordlist)));
+	count = agent_locked_slots(agent, datanodelist, coordlist, slots, false);
+	cancel_slots(slots, count);
+	pfree(slots);
+}
+
+/*
+ * Close the slots of the listed nodes, which the backend gave up reading
+ * after an error: their query is canceled first, so that the remote
+ * backends do not run it to the end.
+ */
+static void agent_discard_connections(PoolAgent *agent, const List *datanodelist, const List *coordlist)
+{
+	ADBNodePoolSlot **slots;
+	int count;
+	int i;
+
+	if(datanodelist == NIL && coordlist == NIL)
+		return;
+
+	slots = palloc(sizeof(ADBNodePoolSlot*) * (list_length(datanodelist) + list_length(coordlist)));
+	count = agent_locked_slots(agent, datanodelist, coordlist, slots, true);
+	cancel_slots(slots, count);
+	for(i=0;i<count;++i)
+	{
+		Assert(slots[i]->owner == agent);
+		destroy_slot(slots[i], false);
+	}
+	pfree(slots);
+}
+
+/* send the cancel request packet of "conn" on a socket to its postmaster */
+static bool send_cancel_request(pgsocket sock, PGconn *conn)
+{
+	struct
+	{
+		uint32		packetlen;
+		CancelRequestPacket cp;
+	}			crp;
+
+	crp.packetlen = htonl((uint32) sizeof(crp));
+	crp.cp.cancelRequestCode = (MsgType) htonl(CANCEL_REQUEST_CODE);
+	crp.cp.backendPID = htonl(conn->be_pid);
+	crp.cp.cancelAuthCode = htonl(conn->be_key);
 
-		if(node_idx > count)
+	return send(sock, (char *) &crp, sizeof(crp), 0) == sizeof(crp);
+}
+
+/*
+ * Cancel the queries running on the connections of the slots.
+ *
+ * PQrequestCancel connects to the postmaster of the node and waits for it
+ * to take the request, done for one node after the other it makes the
+ * rollback of a query running on many nodes last long.  All the requests
+ * are sent at once instead, and answered through one poll().
+ */
+static void cancel_slots(ADBNodePoolSlot **slots, int count)
+{
+	struct pollfd *fds;
+	bool *sent;
+	PGconn *conn;
+	pgsocket sock;
+	instr_time start,now;
+	long remain;
+	int npending = 0;
+	int rval;
+	int i;
+
+	if(count <= 0)
+		return;
+
+	fds = palloc(sizeof(struct pollfd) * count);
+	sent = palloc0(sizeof(bool) * count);
+	for(i=0;i<count;++i)
+	{
+		fds[i].fd = PGINVALID_SOCKET;
+		fds[i].events = POLLOUT;
+		fds[i].revents = 0;
+		conn = slots[i]->conn;
+		if(conn == NULL)
 			continue;
-		slot = agent->dn_connections[node_idx];
-		if(slot == NULL)
+
+		sock = socket(conn->raddr.addr.ss_family, SOCK_STREAM, 0);
+		if(sock == PGINVALID_SOCKET)
+		{
+			ereport(WARNING, (errcode_for_socket_access(),
+				errmsg("cancel query remote query failed:could not create socket: %m")));
 			continue;
-		/* need an error ? */
-		if(slot->last_user_pid != agent->pid || slot->slot_state != SLOT_STATE_LOCKED)
+		}
+		if(!pg_set_noblock(sock) ||
+			(connect(sock, (struct sockaddr *) &conn->raddr.addr, conn->raddr.salen) < 0
+				&& errno != EINPROGRESS && errno != EINTR))
+		{
+			ereport(WARNING, (errcode_for_socket_access(),
+				errmsg("cancel query remote query failed:could not connect to server: %m")));
+			closesocket(sock);
 			continue;
+		}
+		fds[i].fd = sock;
+		++npending;
+	}
+
+	/* send each request once connected, the postmaster closes the socket when it got it */
+	INSTR_TIME_SET_CURRENT(start);
+	while(npending > 0)
+	{
+		INSTR_TIME_SET_CURRENT(now);
+		INSTR_TIME_SUBTRACT(now, start);
+		remain = POOL_CANCEL_TIMEOUT - (long) INSTR_TIME_GET_MILLISEC(now);
+		if(remain <= 0)
+			break;
 
-		if(!PQrequestCancel(slot->conn))
+		rval = poll(fds, count, (int) remain);
+		if(rval < 0)
+		{
+			if(errno == EINTR)
+				continue;
+			break;
+		}else if(rval == 0)
 		{
-			ereport(WARNING, (errmsg("cancel query remote query failed:%s", PQerrorMessage(slot->conn))));
+			break;
 		}
+
+		for(i=0;i<count;++i)
+		{
+			if(fds[i].fd == PGINVALID_SOCKET || fds[i].revents == 0)
+				continue;
+			if(!sent[i])
+			{
+				if((fds[i].revents & (POLLERR|POLLHUP)) == 0
+					&& send_cancel_request(fds[i].fd, slots[i]->conn))
+				{
+					sent[i] = true;
+					fds[i].events = POLLIN;
+					continue;
+				}
+				ereport(WARNING,
+					(errmsg("cancel query remote query failed:could not send cancel request to backend %d",
+							slots[i]->conn->be_pid)));
+			}
+			closesocket(fds[i].fd);
+			fds[i].fd = PGINVALID_SOCKET;
+			--npending;
+		}
+	}
+
+	for(i=0;i<count;++i)
+	{
+		if(fds[i].fd != PGINVALID_SOCKET)
+			closesocket(fds[i].fd);
 	}
+	pfree(fds);
+	pfree(sent);
 }
 
 /*
@@ -3023,7 +3957,7 @@ recheck_node_pool_:
 		hash_seq_init(&hash_nodepool_status, db_pool->htab_nodes);
 		while((node_pool = hash_seq_search(&hash_nodepool_status)) != NULL)
 		{
-			connstr = build_node_conn_str(node_pool->nodeoid, db_pool);
+			connstr = build_node_conn_str(node_pool->nodeoid, db_pool, node_pool->slave);
 			/* Node has been removed or altered */
 			if((connstr == NULL ||
 						/* connstr not null but node_pool->connstr is null,
@@ -3041,6 +3975,24 @@ recheck_node_pool_:
 			PFREE_SAFE(connstr);
 		}
 	}
+
+	/*
+	 * Start warming every node of the new configuration at once, instead
+	 * of letting the first queries connect one by one.
+	 */
+	if(PoolMinIdle > 0)
+	{
+		Size i;
+		hash_seq_init(&hash_database_status, htab_database);
+		while((db_pool = hash_seq_search(&hash_database_status)) != NULL)
+		{
+			for(i=0;i<agent->num_dn_connections;++i)
+				(void)get_node_pool(db_pool, agent->datanode_oids[i], false);
+			for(i=0;i<agent->num_coord_connections;++i)
+				(void)get_node_pool(db_pool, agent->coord_oids[i], false);
+		}
+		fill_all_idle_slots();
+	}
 }
 
 /*
@@ -3086,10 +4038,10 @@ static int node_info_check(PoolAgent *agent)
 		hash_seq_init(&hash_nodepool_status, db_pool->htab_nodes);
 		while((node_pool = hash_seq_search(&hash_nodepool_status)) != NULL)
 		{
-			if(list_member_oid(checked_oids, node_pool->nodeoid))
+			if(!node_pool->slave && list_member_oid(checked_oids, node_pool->nodeoid))
 				continue;
 
-			connstr = build_node_conn_str(node_pool->nodeoid, db_pool);
+			connstr = build_node_conn_str(node_pool->nodeoid, db_pool, node_pool->slave);
 			if (connstr == NULL)
 			{
 				res = POOL_CHECK_FAILED;
@@ -3105,7 +4057,8 @@ static int node_info_check(PoolAgent *agent)
 				}
 			}
 			PFREE_SAFE(connstr);
-			checked_oids = lappend_oid(checked_oids, node_pool->nodeoid);
+			if(!node_pool->slave)
+				checked_oids = lappend_oid(checked_oids, node_pool->nodeoid);
 		}
 		list_free(checked_oids);
 	}
@@ -3436,7 +4389,7 @@ static void close_idle_connection(void)
 {
 	time_t cur_time;
 	cur_time = time(NULL);
-	close_timeout_idle_slots(cur_time + pool_time_out);	
+	close_timeout_idle_slots(cur_time + pool_time_out, 0);
 
 	/* to test idle slot, never run in common*/
 	if(false)
@@ -3643,3 +4596,265 @@ pool_close_all_conn(PG_FUNCTION_ARGS)
 		PG_RETURN_BOOL(false);
 }
 
+
+/*---------------------------------------------------------------------------*/
+
+/* histogram bucket of a wait of "usec" microseconds */
+static int pool_stat_bucket(uint64 usec)
+{
+	int bucket = 0;
+
+	for(; usec >= 2 && bucket < POOL_STAT_HIST_BUCKETS - 1; usec >>= 1)
+		++bucket;
+	return bucket;
+}
+
+/* slot just called PQconnectStart */
+static void pool_stat_connect_start(ADBNodePoolSlot *slot)
+{
+	AssertArg(slot && slot->parent);
+	INSTR_TIME_SET_CURRENT(slot->connect_start);
+	slot->parent->stats.connects++;
+}
+
+/* connect started by pool_stat_connect_start is over */
+static void pool_stat_connect_end(ADBNodePoolSlot *slot, bool succeeded)
+{
+	ADBNodePoolStats *stats;
+	instr_time duration;
+	uint64 usec;
+	AssertArg(slot && slot->parent);
+
+	stats = &slot->parent->stats;
+	if(succeeded == false)
+	{
+		stats->connect_failures++;
+		return;
+	}
+
+	INSTR_TIME_SET_CURRENT(duration);
+	INSTR_TIME_SUBTRACT(duration, slot->connect_start);
+	usec = INSTR_TIME_GET_MICROSEC(duration);
+	stats->connect_time += usec;
+	stats->connect_hist[pool_stat_bucket(usec)]++;
+}
+
+/* a connection of node_pool was sent to an agent which waited "usec" for it */
+static void pool_stat_acquired(ADBNodePool *node_pool, uint64 usec)
+{
+	ADBNodePoolStats *stats;
+	AssertArg(node_pool);
+
+	stats = &node_pool->stats;
+	stats->acquires++;
+	stats->acquire_time += usec;
+	if(usec > stats->acquire_max_time)
+		stats->acquire_max_time = usec;
+	stats->acquire_hist[pool_stat_bucket(usec)]++;
+}
+
+static int count_slot_list(dlist_head *head)
+{
+	dlist_iter iter;
+	int count = 0;
+
+	dlist_foreach(iter, head)
+		++count;
+	return count;
+}
+
+/* number of slots of node_pool handed out to agents */
+static int count_active_slots(ADBNodePool *node_pool)
+{
+	PoolAgent *agent;
+	Size i,j;
+	int count = 0;
+
+	for(i=0;i<agentCount;++i)
+	{
+		agent = poolAgents[i];
+		for(j=0;j<agent->num_dn_connections;++j)
+		{
+			if(agent->dn_connections[j]
+				&& agent->dn_connections[j]->parent == node_pool)
+				++count;
+		}
+		for(j=0;j<agent->num_coord_connections;++j)
+		{
+			if(agent->coord_connections[j]
+				&& agent->coord_connections[j]->parent == node_pool)
+				++count;
+		}
+	}
+	return count;
+}
+
+/*
+ * answer PM_MSG_GET_STATS, one entry for each node pool:
+ * database, user name, node oid, idle, released, busy and active slot
+ * counts, then ADBNodePoolStats as is
+ */
+static void send_pool_stats(PoolAgent *agent)
+{
+	HASH_SEQ_STATUS hash_database_stats;
+	HASH_SEQ_STATUS hash_nodepool_status;
+	DatabasePool *db_pool;
+	ADBNodePool *node_pool;
+	StringInfoData buf;
+	int count;
+
+	count = 0;
+	if(htab_database)
+	{
+		hash_seq_init(&hash_database_stats, htab_database);
+		while((db_pool = hash_seq_search(&hash_database_stats)) != NULL)
+			count += (int)hash_get_num_entries(db_pool->htab_nodes);
+	}
+
+	pq_beginmessage(&buf, PM_MSG_GET_STATS);
+	pool_sendint(&buf, count);
+	if(htab_database)
+	{
+		hash_seq_init(&hash_database_stats, htab_database);
+		while((db_pool = hash_seq_search(&hash_database_stats)) != NULL)
+		{
+			hash_seq_init(&hash_nodepool_status, db_pool->htab_nodes);
+			while((node_pool = hash_seq_search(&hash_nodepool_status)) != NULL)
+			{
+				pool_sendstring(&buf, db_pool->db_info.database);
+				pool_sendstring(&buf, db_pool->db_info.user_name);
+				pool_sendint(&buf, (int)node_pool->nodeoid);
+				pool_sendint(&buf, count_slot_list(&node_pool->idle_slot));
+				pool_sendint(&buf, count_slot_list(&node_pool->released_slot));
+				pool_sendint(&buf, count_slot_list(&node_pool->busy_slot));
+				pool_sendint(&buf, count_active_slots(node_pool));
+				pq_sendbytes(&buf, (char*)&node_pool->stats, sizeof(node_pool->stats));
+			}
+		}
+	}
+	pool_end_flush_msg(&agent->port, &buf);
+}
+
+static Datum pool_stat_histogram(const uint64 *hist)
+{
+	Datum values[POOL_STAT_HIST_BUCKETS];
+	int i;
+
+	for(i=0;i<POOL_STAT_HIST_BUCKETS;++i)
+		values[i] = Int64GetDatum((int64) hist[i]);
+	return PointerGetDatum(construct_array(values, POOL_STAT_HIST_BUCKETS,
+										   INT8OID, sizeof(int64),
+										   FLOAT8PASSBYVAL, 'd'));
+}
+
+/*
+ * SQL function backing the pg_pool_stats view, one row for each node
+ * pool of the pooler of this Coordinator.  Times are in milliseconds.
+ */
+Datum
+pg_pool_stats(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	MemoryContext oldcontext;
+	StringInfoData buf;
+	ADBNodePoolStats stats;
+	int			type;
+	int			count;
+
+	/* check to see if caller supports us returning a tuplestore */
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not " \
+						"allowed in this context")));
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	if (!IS_PGXC_COORDINATOR)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("pool statistics are only available on a Coordinator")));
+
+	if (!IsPoolHandle())
+		PoolManagerReconnect();
+
+	/* ask the pooler */
+	pool_putmessage(&poolHandle->port, PM_MSG_GET_STATS, NULL, 0);
+	pool_flush(&poolHandle->port);
+
+	initStringInfo(&buf);
+	type = pool_getbyte(&poolHandle->port);
+	if (type == EOF || pool_getmessage(&poolHandle->port, &buf, 0) != 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_CONNECTION_FAILURE),
+				 errmsg("can not receive statistics from pool manager")));
+	if (type == PM_MSG_ERROR)
+		ereport(ERROR,
+				(errmsg("pool manager: %s", buf.data)));
+	if (type != PM_MSG_GET_STATS)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg("unexpected message type %d from pool manager", type)));
+
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+	tupdesc = CreateTupleDescCopy(tupdesc);
+	tupstore = tuplestore_begin_heap(true, false, work_mem);
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = tupdesc;
+	MemoryContextSwitchTo(oldcontext);
+
+	for (count = pool_getint(&buf); count > 0; --count)
+	{
+		Datum		values[POOL_STAT_COLS];
+		bool		nulls[POOL_STAT_COLS];
+		Oid			nodeoid;
+		NameData	nodename;
+		HeapTuple	tuple;
+		int			i;
+
+		MemSet(nulls, 0, sizeof(nulls));
+		values[0] = CStringGetTextDatum(pool_getstring(&buf));
+		values[1] = CStringGetTextDatum(pool_getstring(&buf));
+		nodeoid = (Oid) pool_getint(&buf);
+		values[2] = ObjectIdGetDatum(nodeoid);
+
+		/* the pool of a dropped node stays until pgxc_pool_reload() */
+		tuple = SearchSysCache1(PGXCNODEOID, ObjectIdGetDatum(nodeoid));
+		if (HeapTupleIsValid(tuple))
+		{
+			namecpy(&nodename, &((Form_pgxc_node) GETSTRUCT(tuple))->node_name);
+			values[3] = NameGetDatum(&nodename);
+			ReleaseSysCache(tuple);
+		}
+		else
+			nulls[3] = true;
+
+		for (i = 4; i < 8; i++)
+			values[i] = Int32GetDatum(pool_getint(&buf));
+
+		pq_copymsgbytes(&buf, (char *) &stats, sizeof(stats));
+		values[8] = Int64GetDatum((int64) stats.connects);
+		values[9] = Int64GetDatum((int64) stats.connect_failures);
+		values[10] = Float8GetDatum((double) stats.connect_time / 1000.0);
+		values[11] = pool_stat_histogram(stats.connect_hist);
+		values[12] = Int64GetDatum((int64) stats.acquires);
+		values[13] = Float8GetDatum((double) stats.acquire_time / 1000.0);
+		values[14] = Float8GetDatum((double) stats.acquire_max_time / 1000.0);
+		values[15] = pool_stat_histogram(stats.acquire_hist);
+		values[16] = Int64GetDatum((int64) stats.idle_closes);
+
+		tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+	}
+	pq_getmsgend(&buf);
+	pfree(buf.data);
+
+	tuplestore_donestoring(tupstore);
+	return (Datum) 0;
+}
@@ -22,6 +22,10 @@
  * process, SIGUSR1 is sent and the signal handler in the waiting process
  * writes the byte to the pipe on behalf of the signaling process.
  *
+ * A WaitEventSet registers the read end of the self-pipe once, along with
+ * the postmaster pipe and any number of sockets, in an epoll set where
+ * available and in a poll() array otherwise.
+ *
  * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -47,6 +51,9 @@
 #ifdef HAVE_SYS_SELECT_H
 #include <sys/select.h>
 #endif
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif
 
 #include "miscadmin.h"
 #include "portability/instr_time.h"
@@ -54,6 +61,41 @@
 #include "storage/latch.h"
 #include "storage/pmsignal.h"
 #include "storage/shmem.h"
+#include "utils/memutils.h"
+
+/* How WaitEventSetWait waits */
+#if defined(HAVE_SYS_EPOLL_H)
+#define WAIT_USE_EPOLL
+#elif defined(HAVE_POLL)
+#define WAIT_USE_POLL
+#endif
+
+#if defined(WAIT_USE_EPOLL) || defined(WAIT_USE_POLL)
+struct WaitEventSet
+{
+	MemoryContext context;		/* holds the arrays below */
+	int			nevents;		/* slots used in events[], free ones included */
+	int			nevents_space;	/* slots allocated */
+
+	/*
+	 * events[pos] is the event at that position, fd is PGINVALID_SOCKET if
+	 * the slot is free.  The latch has its self-pipe as fd.
+	 */
+	WaitSetEvent  *events;
+	volatile Latch *latch;
+	int			latch_pos;
+
+#if defined(WAIT_USE_EPOLL)
+	int			epoll_fd;
+	struct epoll_event *epoll_ret_events;
+#else
+	struct pollfd *pollfds;		/* pollfds[pos], fd -1 if not waited on */
+#endif
+};
+
+static void WaitEventAdjust(WaitEventSet *set, WaitSetEvent *event,
+				uint32 old_events);
+#endif   /* WAIT_USE_EPOLL || WAIT_USE_POLL */
 
 /* Are we currently in WaitLatch? The signal handler would like to know. */
 static volatile sig_atomic_t waiting = false;
@@ -486,6 +528,392 @@ WaitLatchOrSocket(volatile Latch *latch, int wakeEvents, pgsocket sock,
 	return result;
 }
 
+#if defined(WAIT_USE_EPOLL) || defined(WAIT_USE_POLL)
+/*
+ * Create a WaitEventSet with room for "nevents" events, it grows if more
+ * are added.  The set is allocated in "context" and lives until
+ * FreeWaitEventSet, which also releases the kernel resources it holds.
+ */
+WaitEventSet *
+CreateWaitEventSet(MemoryContext context, int nevents)
+{
+	WaitEventSet *set;
+
+	Assert(nevents > 0);
+
+	set = (WaitEventSet *) MemoryContextAllocZero(context,
+												  sizeof(WaitEventSet));
+	set->context = context;
+	set->nevents_space = nevents;
+	set->latch_pos = -1;
+	set->events = (WaitSetEvent *) MemoryContextAlloc(context,
+											   sizeof(WaitSetEvent) * nevents);
+#if defined(WAIT_USE_EPOLL)
+	set->epoll_ret_events = (struct epoll_event *)
+		MemoryContextAlloc(context, sizeof(struct epoll_event) * nevents);
+	set->epoll_fd = epoll_create(nevents);
+	if (set->epoll_fd < 0)
+		elog(ERROR, "epoll_create failed: %m");
+#else
+	set->pollfds = (struct pollfd *)
+		MemoryContextAlloc(context, sizeof(struct pollfd) * nevents);
+#endif
+
+	return set;
+}
+
+void
+FreeWaitEventSet(WaitEventSet *set)
+{
+#if defined(WAIT_USE_EPOLL)
+	close(set->epoll_fd);
+	pfree(set->epoll_ret_events);
+#else
+	pfree(set->pollfds);
+#endif
+	pfree(set->events);
+	pfree(set);
+}
+
+/*
+ * Add an event to the set and return its position, which stays valid until
+ * RemoveWaitEventFromSet.  "events" is one of:
+ *
+ * WL_LATCH_SET: wait for "latch" to be set, it must be owned by the
+ * current process.  A set has at most one latch.
+ * WL_POSTMASTER_DEATH: wait for the postmaster to die.
+ * WL_SOCKET_READABLE and/or WL_SOCKET_WRITEABLE: wait for socket "fd",
+ * EOF and errors being reported as whichever was asked for.  No flag at all
+ * adds the socket without waiting on it yet, see ModifyWaitEvent.
+ *
+ * "user_data" is handed back with the events reported for this one.
+ */
+int
+AddWaitEventToSet(WaitEventSet *set, uint32 events, pgsocket fd,
+				  volatile Latch *latch, void *user_data)
+{
+	WaitSetEvent  *event;
+	int			pos;
+
+	/* Assert InitializeLatchSupport has been called in this process */
+	Assert(selfpipe_readfd >= 0);
+
+	if (events == WL_LATCH_SET)
+	{
+		if (set->latch != NULL)
+			elog(ERROR, "cannot wait on more than one latch");
+		if (latch->owner_pid != MyProcPid)
+			elog(ERROR, "cannot wait on a latch owned by another process");
+		fd = selfpipe_readfd;
+	}
+	else if (events == WL_POSTMASTER_DEATH)
+		fd = postmaster_alive_fds[POSTMASTER_FD_WATCH];
+	else
+	{
+		Assert((events & ~(WL_SOCKET_READABLE | WL_SOCKET_WRITEABLE)) == 0);
+		Assert(fd != PGINVALID_SOCKET);
+	}
+
+	/* reuse a free slot if any, else take a new one */
+	for (pos = 0; pos < set->nevents; pos++)
+	{
+		if (set->events[pos].fd == PGINVALID_SOCKET)
+			break;
+	}
+	if (pos == set->nevents)
+	{
+		if (set->nevents == set->nevents_space)
+		{
+			int			newspace = set->nevents_space * 2;
+
+#if defined(WAIT_USE_EPOLL)
+			set->epoll_ret_events = (struct epoll_event *)
+				repalloc(set->epoll_ret_events,
+						 sizeof(struct epoll_event) * newspace);
+#else
+			set->pollfds = (struct pollfd *)
+				repalloc(set->pollfds, sizeof(struct pollfd) * newspace);
+#endif
+			set->events = (WaitSetEvent *)
+				repalloc(set->events, sizeof(WaitSetEvent) * newspace);
+			set->nevents_space = newspace;
+		}
+		set->nevents++;
+	}
+
+	event = &set->events[pos];
+	event->pos = pos;
+	event->events = events;
+	event->fd = fd;
+	event->user_data = user_data;
+	if (events == WL_LATCH_SET)
+	{
+		set->latch = latch;
+		set->latch_pos = pos;
+	}
+
+	WaitEventAdjust(set, event, 0);
+
+	return pos;
+}
+
+/*
+ * Change the WL_SOCKET_* flags a socket event waits for.  Zero keeps the
+ * socket in the set, but it is not reported until waited on again, not even
+ * for EOF.
+ */
+void
+ModifyWaitEvent(WaitEventSet *set, int pos, uint32 events)
+{
+	WaitSetEvent  *event;
+	uint32		old_events;
+
+	Assert(pos >= 0 && pos < set->nevents);
+	event = &set->events[pos];
+	Assert(event->fd != PGINVALID_SOCKET);
+	Assert((event->events & (WL_LATCH_SET | WL_POSTMASTER_DEATH)) == 0);
+	Assert((events & ~(WL_SOCKET_READABLE | WL_SOCKET_WRITEABLE)) == 0);
+
+	if (events == event->events)
+		return;
+
+	old_events = event->events;
+	event->events = events;
+	WaitEventAdjust(set, event, old_events);
+}
+
+/*
+ * Remove a socket event from the set.  This should be done before closing
+ * the socket, though the socket having been closed is tolerated.
+ */
+void
+RemoveWaitEventFromSet(WaitEventSet *set, int pos)
+{
+	WaitSetEvent  *event;
+	uint32		old_events;
+
+	Assert(pos >= 0 && pos < set->nevents);
+	event = &set->events[pos];
+	Assert(event->fd != PGINVALID_SOCKET);
+	Assert((event->events & (WL_LATCH_SET | WL_POSTMASTER_DEATH)) == 0);
+
+	old_events = event->events;
+	event->events = 0;
+	WaitEventAdjust(set, event, old_events);
+	event->fd = PGINVALID_SOCKET;
+	event->user_data = NULL;
+
+	/* trim free slots at the end */
+	while (set->nevents > 0 &&
+		   set->events[set->nevents - 1].fd == PGINVALID_SOCKET)
+		set->nevents--;
+}
+
+/*
+ * Make the kernel side of "event" match its events, they were "old_events".
+ * Events waited on by nothing are not in the epoll set at all, so that even
+ * a hangup on their socket does not wake us up.
+ */
+static void
+WaitEventAdjust(WaitEventSet *set, WaitSetEvent *event, uint32 old_events)
+{
+#if defined(WAIT_USE_EPOLL)
+	struct epoll_event epoll_ev;
+	int			op;
+
+	if (old_events == 0 && event->events == 0)
+		return;
+	if (old_events == 0)
+		op = EPOLL_CTL_ADD;
+	else if (event->events == 0)
+		op = EPOLL_CTL_DEL;
+	else
+		op = EPOLL_CTL_MOD;
+
+	MemSet(&epoll_ev, 0, sizeof(epoll_ev));
+	epoll_ev.data.u32 = (uint32) event->pos;
+	if (event->events & (WL_LATCH_SET | WL_POSTMASTER_DEATH |
+						 WL_SOCKET_READABLE))
+		epoll_ev.events |= EPOLLIN;
+	if (event->events & WL_SOCKET_WRITEABLE)
+		epoll_ev.events |= EPOLLOUT;
+
+	if (epoll_ctl(set->epoll_fd, op, event->fd, &epoll_ev) < 0)
+	{
+		/* a socket closed under us has already left the set */
+		if (op == EPOLL_CTL_DEL && (errno == EBADF || errno == ENOENT))
+			return;
+		elog(ERROR, "epoll_ctl failed: %m");
+	}
+#else
+	struct pollfd *pollfd = &set->pollfds[event->pos];
+
+	pollfd->revents = 0;
+	pollfd->events = 0;
+	if (event->events & (WL_LATCH_SET | WL_POSTMASTER_DEATH |
+						 WL_SOCKET_READABLE))
+		pollfd->events |= POLLIN;
+	if (event->events & WL_SOCKET_WRITEABLE)
+		pollfd->events |= POLLOUT;
+	/* poll() skips negative descriptors */
+	pollfd->fd = (event->events != 0) ? event->fd : -1;
+#endif
+}
+
+/*
+ * Wait for events of the set to fire, or for "timeout" milliseconds if
+ * it is not -1.  Up to "nevents" of the fired events are returned into
+ * "occurred_events", their number is the result, 0 meaning timeout.
+ *
+ * When the latch is set, it is the only event reported, as in WaitLatch.
+ */
+int
+WaitEventSetWait(WaitEventSet *set, long timeout,
+				 WaitSetEvent *occurred_events, int nevents)
+{
+	int			returned = 0;
+	int			rc;
+	int			i;
+	instr_time	start_time,
+				cur_time;
+	long		cur_timeout = -1;
+
+	Assert(nevents > 0);
+
+	if (timeout >= 0)
+	{
+		INSTR_TIME_SET_CURRENT(start_time);
+		Assert(timeout <= INT_MAX);
+		cur_timeout = timeout;
+	}
+
+	if (set->latch)
+		waiting = true;
+	for (;;)
+	{
+		/* see WaitLatchOrSocket about the order of these steps */
+		if (set->latch)
+		{
+			drainSelfPipe();
+			if (set->latch->is_set)
+			{
+				occurred_events[0] = set->events[set->latch_pos];
+				occurred_events[0].events = WL_LATCH_SET;
+				returned = 1;
+				break;
+			}
+		}
+
+#if defined(WAIT_USE_EPOLL)
+		rc = epoll_wait(set->epoll_fd, set->epoll_ret_events,
+						Min(nevents, set->nevents_space), (int) cur_timeout);
+#else
+		rc = poll(set->pollfds, set->nevents, (int) cur_timeout);
+#endif
+		if (rc < 0)
+		{
+			/* EINTR is okay, otherwise complain */
+			if (errno != EINTR)
+			{
+				waiting = false;
+				ereport(ERROR,
+						(errcode_for_socket_access(),
+#if defined(WAIT_USE_EPOLL)
+						 errmsg("epoll_wait() failed: %m")));
+#else
+						 errmsg("poll() failed: %m")));
+#endif
+			}
+		}
+		else if (rc == 0)
+			break;					/* timeout exceeded */
+
+#if defined(WAIT_USE_EPOLL)
+		for (i = 0; i < rc; i++)
+		{
+			struct epoll_event *epoll_ev = &set->epoll_ret_events[i];
+			WaitSetEvent  *event = &set->events[epoll_ev->data.u32];
+			uint32		fired = 0;
+
+			if (event->events & WL_POSTMASTER_DEATH)
+			{
+				/* see WaitLatchOrSocket */
+				if (!PostmasterIsAlive())
+					fired = WL_POSTMASTER_DEATH;
+			}
+			else if (event->events & (WL_SOCKET_READABLE | WL_SOCKET_WRITEABLE))
+			{
+				if ((event->events & WL_SOCKET_READABLE) &&
+					(epoll_ev->events & (EPOLLIN | EPOLLERR | EPOLLHUP)))
+					fired |= WL_SOCKET_READABLE;
+				if ((event->events & WL_SOCKET_WRITEABLE) &&
+					(epoll_ev->events & (EPOLLOUT | EPOLLERR | EPOLLHUP)))
+					fired |= WL_SOCKET_WRITEABLE;
+			}
+			/* the latch is checked at the top of the loop */
+
+			if (fired != 0)
+			{
+				occurred_events[returned] = *event;
+				occurred_events[returned].events = fired;
+				returned++;
+			}
+		}
+#else
+		for (i = 0; i < set->nevents && returned < nevents && rc > 0; i++)
+		{
+			struct pollfd *pollfd = &set->pollfds[i];
+			WaitSetEvent  *event = &set->events[i];
+			uint32		fired = 0;
+
+			if (pollfd->fd < 0 || pollfd->revents == 0)
+				continue;
+			rc--;
+
+			if (event->events & WL_POSTMASTER_DEATH)
+			{
+				/* see WaitLatchOrSocket */
+				if (!PostmasterIsAlive())
+					fired = WL_POSTMASTER_DEATH;
+			}
+			else if (event->events & (WL_SOCKET_READABLE | WL_SOCKET_WRITEABLE))
+			{
+				if ((event->events & WL_SOCKET_READABLE) &&
+					(pollfd->revents & (POLLIN | POLLHUP | POLLERR | POLLNVAL)))
+					fired |= WL_SOCKET_READABLE;
+				if ((event->events & WL_SOCKET_WRITEABLE) &&
+					(pollfd->revents & (POLLOUT | POLLHUP | POLLERR | POLLNVAL)))
+					fired |= WL_SOCKET_WRITEABLE;
+			}
+			pollfd->revents = 0;
+
+			if (fired != 0)
+			{
+				occurred_events[returned] = *event;
+				occurred_events[returned].events = fired;
+				returned++;
+			}
+		}
+#endif
+		if (returned > 0)
+			break;
+
+		/* nothing but the self-pipe or a signal, go on waiting */
+		if (timeout >= 0)
+		{
+			INSTR_TIME_SET_CURRENT(cur_time);
+			INSTR_TIME_SUBTRACT(cur_time, start_time);
+			cur_timeout = timeout - (long) INSTR_TIME_GET_MILLISEC(cur_time);
+			if (cur_timeout <= 0)
+				break;
+		}
+	}
+	waiting = false;
+
+	return returned;
+}
+#endif   /* WAIT_USE_EPOLL || WAIT_USE_POLL */
+
 /*
  * Sets a latch and wakes up anyone waiting on it.
  *
@@ -30,6 +30,22 @@
 #include "storage/latch.h"
 #include "storage/pmsignal.h"
 #include "storage/shmem.h"
+#include "utils/memutils.h"
+
+/*
+ * WaitEventSet on top of WaitLatchOrSocket, which waits on one socket at
+ * most: a set may hold many sockets, but only one of them waited on at a
+ * time.
+ */
+struct WaitEventSet
+{
+	int			nevents;
+	int			nevents_space;
+	WaitSetEvent  *events;			/* fd is PGINVALID_SOCKET in free slots */
+	volatile Latch *latch;
+	int			latch_pos;
+	int			postmaster_pos;
+};
 
 
 void
@@ -282,6 +298,147 @@ WaitLatchOrSocket(volatile Latch *latch, int wakeEvents, pgsocket sock,
 	return result;
 }
 
+WaitEventSet *
+CreateWaitEventSet(MemoryContext context, int nevents)
+{
+	WaitEventSet *set;
+
+	Assert(nevents > 0);
+
+	set = (WaitEventSet *) MemoryContextAllocZero(context,
+												  sizeof(WaitEventSet));
+	set->nevents_space = nevents;
+	set->latch_pos = -1;
+	set->postmaster_pos = -1;
+	set->events = (WaitSetEvent *) MemoryContextAlloc(context,
+											   sizeof(WaitSetEvent) * nevents);
+	return set;
+}
+
+void
+FreeWaitEventSet(WaitEventSet *set)
+{
+	pfree(set->events);
+	pfree(set);
+}
+
+int
+AddWaitEventToSet(WaitEventSet *set, uint32 events, pgsocket fd,
+				  volatile Latch *latch, void *user_data)
+{
+	WaitSetEvent  *event;
+	int			pos;
+
+	for (pos = 0; pos < set->nevents; pos++)
+	{
+		if (set->events[pos].fd == PGINVALID_SOCKET &&
+			pos != set->latch_pos && pos != set->postmaster_pos)
+			break;
+	}
+	if (pos == set->nevents)
+	{
+		if (set->nevents == set->nevents_space)
+		{
+			set->nevents_space *= 2;
+			set->events = (WaitSetEvent *)
+				repalloc(set->events, sizeof(WaitSetEvent) * set->nevents_space);
+		}
+		set->nevents++;
+	}
+
+	event = &set->events[pos];
+	event->pos = pos;
+	event->events = events;
+	event->fd = PGINVALID_SOCKET;
+	event->user_data = user_data;
+	if (events == WL_LATCH_SET)
+	{
+		if (set->latch != NULL)
+			elog(ERROR, "cannot wait on more than one latch");
+		set->latch = latch;
+		set->latch_pos = pos;
+	}
+	else if (events == WL_POSTMASTER_DEATH)
+		set->postmaster_pos = pos;
+	else
+		event->fd = fd;
+
+	return pos;
+}
+
+void
+ModifyWaitEvent(WaitEventSet *set, int pos, uint32 events)
+{
+	Assert(pos >= 0 && pos < set->nevents);
+	Assert(set->events[pos].fd != PGINVALID_SOCKET);
+	set->events[pos].events = events;
+}
+
+void
+RemoveWaitEventFromSet(WaitEventSet *set, int pos)
+{
+	Assert(pos >= 0 && pos < set->nevents);
+	Assert(set->events[pos].fd != PGINVALID_SOCKET);
+	set->events[pos].events = 0;
+	set->events[pos].fd = PGINVALID_SOCKET;
+	set->events[pos].user_data = NULL;
+}
+
+int
+WaitEventSetWait(WaitEventSet *set, long timeout,
+				 WaitSetEvent *occurred_events, int nevents)
+{
+	WaitSetEvent  *sockevent = NULL;
+	int			wakeEvents = 0;
+	int			rc;
+	int			pos;
+
+	Assert(nevents > 0);
+
+	for (pos = 0; pos < set->nevents; pos++)
+	{
+		WaitSetEvent  *event = &set->events[pos];
+
+		if (event->fd == PGINVALID_SOCKET || event->events == 0)
+			continue;
+		if (sockevent != NULL)
+			elog(ERROR, "cannot wait on more than one socket");
+		sockevent = event;
+		wakeEvents |= event->events;
+	}
+	if (set->latch)
+		wakeEvents |= WL_LATCH_SET;
+	if (set->postmaster_pos >= 0)
+		wakeEvents |= WL_POSTMASTER_DEATH;
+	if (timeout >= 0)
+		wakeEvents |= WL_TIMEOUT;
+
+	rc = WaitLatchOrSocket(set->latch, wakeEvents,
+						   sockevent ? sockevent->fd : PGINVALID_SOCKET,
+						   timeout);
+
+	if (rc & WL_LATCH_SET)
+	{
+		occurred_events[0] = set->events[set->latch_pos];
+		occurred_events[0].events = WL_LATCH_SET;
+	}
+	else if (rc & WL_POSTMASTER_DEATH)
+	{
+		occurred_events[0] = set->events[set->postmaster_pos];
+		occurred_events[0].events = WL_POSTMASTER_DEATH;
+	}
+	else if (rc & (WL_SOCKET_READABLE | WL_SOCKET_WRITEABLE))
+	{
+		occurred_events[0] = *sockevent;
+		occurred_events[0].events =
+			rc & (WL_SOCKET_READABLE | WL_SOCKET_WRITEABLE);
+	}
+	else
+		return 0;
+
+	return 1;
+}
+
 /*
  * The comments above the unix implementation (unix_latch.c) of this function
  * apply here as well.
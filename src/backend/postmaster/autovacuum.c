@@ -67,6 +67,7 @@
 #include <time.h>
 #include <unistd.h>
 
+#include "access/hash.h"
 #include "access/heapam.h"
 #include "access/htup_details.h"
 #include "access/multixact.h"
@@ -76,6 +77,9 @@
 #include "catalog/dependency.h"
 #include "catalog/namespace.h"
 #include "catalog/pg_database.h"
+#ifdef ADB
+#include "catalog/pgxc_node.h"
+#endif
 #include "commands/dbcommands.h"
 #include "commands/vacuum.h"
 #include "lib/ilist.h"
@@ -85,6 +89,9 @@
 #include "postmaster/autovacuum.h"
 #include "postmaster/fork_process.h"
 #include "postmaster/postmaster.h"
+#ifdef ADB
+#include "pgxc/pgxc.h"
+#endif
 #include "storage/bufmgr.h"
 #include "storage/ipc.h"
 #include "storage/latch.h"
@@ -120,6 +127,10 @@ int			autovacuum_multixact_freeze_max_age;
 
 int			autovacuum_vac_cost_delay;
 int			autovacuum_vac_cost_limit;
+#ifdef ADB
+int			autovacuum_stagger_interval = 0;
+int			autovacuum_cluster_cost_limit = -1;
+#endif
 
 int			Log_autovacuum_min_duration = -1;
 
@@ -283,6 +294,23 @@ static WorkerInfo MyWorkerInfo = NULL;
 /* PID of launcher, valid only in worker while shutting down */
 int			AutovacuumLauncherPid = 0;
 
+#ifdef ADB
+/*
+ * Position of this Datanode among the Datanodes of pgxc_node sorted by
+ * name, and their number, looked up by each worker.  The position is -1 if
+ * this node is not a Datanode found there.
+ */
+static int	av_datanode_slot = -1;
+static int	av_num_datanodes = 0;
+
+/* a table to vacuum for wraparound, with the age of its relfrozenxid */
+typedef struct av_wraparound_table
+{
+	Oid			relid;
+	int32		age;
+} av_wraparound_table;
+#endif
+
 #ifdef EXEC_BACKEND
 static pid_t avlauncher_forkexec(void);
 static pid_t avworker_forkexec(void);
@@ -325,6 +353,14 @@ static void avl_sighup_handler(SIGNAL_ARGS);
 static void avl_sigusr2_handler(SIGNAL_ARGS);
 static void avl_sigterm_handler(SIGNAL_ARGS);
 static void autovac_refresh_stats(void);
+static int	autovac_default_cost_limit(void);
+#ifdef ADB
+static void autovac_get_datanode_slot(void);
+static bool autovac_is_our_turn(Oid relnamespace, const char *relname);
+static void autovac_add_wraparound(List **tables, Oid relid,
+					   Form_pg_class classForm);
+static int	av_wraparound_cmp(const void *a, const void *b);
+#endif
 
 
 
@@ -1773,6 +1809,25 @@ AutoVacuumUpdateDelay(void)
 	}
 }
 
+/*
+ * autovac_default_cost_limit
+ *		The cost limit of a worker when the table does not set its own.
+ *
+ * In Postgres-XC, autovacuum_cluster_cost_limit is shared out evenly among
+ * the Datanodes, so that all of them together do not go beyond it.
+ */
+static int
+autovac_default_cost_limit(void)
+{
+#ifdef ADB
+	if (autovacuum_cluster_cost_limit > 0 && av_num_datanodes > 0)
+		return Max(autovacuum_cluster_cost_limit / av_num_datanodes, 1);
+#endif
+
+	return (autovacuum_vac_cost_limit > 0 ?
+			autovacuum_vac_cost_limit : VacuumCostLimit);
+}
+
 /*
  * autovac_balance_cost
  *		Recalculate the cost limit setting for each active worker.
@@ -1790,8 +1845,7 @@ autovac_balance_cost(void)
 	 * note: in cost_limit, zero also means use value from elsewhere, because
 	 * zero is not a valid value.
 	 */
-	int			vac_cost_limit = (autovacuum_vac_cost_limit > 0 ?
-								autovacuum_vac_cost_limit : VacuumCostLimit);
+	int			vac_cost_limit = autovac_default_cost_limit();
 	int			vac_cost_delay = (autovacuum_vac_cost_delay >= 0 ?
 								autovacuum_vac_cost_delay : VacuumCostDelay);
 	double		cost_total;
@@ -1950,6 +2004,9 @@ do_autovacuum(void)
 	ScanKeyData key;
 	TupleDesc	pg_class_desc;
 	int			effective_multixact_freeze_max_age;
+#ifdef ADB
+	List	   *wraparound_tables = NIL;
+#endif
 
 	/*
 	 * StartTransactionCommand and CommitTransactionCommand will automatically
@@ -1979,6 +2036,11 @@ do_autovacuum(void)
 	 */
 	pgstat_vacuum_stat();
 
+#ifdef ADB
+	/* Find our turn among the Datanodes for the staggering */
+	autovac_get_datanode_slot();
+#endif
+
 	/*
 	 * Compute the multixact age for which freezing is urgent.  This is
 	 * normally autovacuum_multixact_freeze_max_age, but may be less if we
@@ -2128,8 +2190,17 @@ do_autovacuum(void)
 		else
 		{
 			/* relations that need work are added to table_oids */
+#ifdef ADB
+			if (wraparound)
+				autovac_add_wraparound(&wraparound_tables, relid, classForm);
+			else if ((dovacuum || doanalyze) &&
+					 autovac_is_our_turn(classForm->relnamespace,
+										 NameStr(classForm->relname)))
+				table_oids = lappend_oid(table_oids, relid);
+#else
 			if (dovacuum || doanalyze)
 				table_oids = lappend_oid(table_oids, relid);
+#endif
 
 			/*
 			 * Remember the association for the second pass.  Note: we must do
@@ -2213,13 +2284,54 @@ do_autovacuum(void)
 								  &dovacuum, &doanalyze, &wraparound);
 
 		/* ignore analyze for toast tables */
+#ifdef ADB
+		if (wraparound)
+			autovac_add_wraparound(&wraparound_tables, relid, classForm);
+		else if (dovacuum)
+		{
+			av_relation *hentry;
+			char	   *relname;
+
+			/* a TOAST table takes its turn with its main table */
+			hentry = hash_search(table_toast_map, &relid, HASH_FIND, NULL);
+			relname = hentry ? get_rel_name(hentry->ar_relid) : NULL;
+			if (relname == NULL ||
+				autovac_is_our_turn(get_rel_namespace(hentry->ar_relid),
+									relname))
+				table_oids = lappend_oid(table_oids, relid);
+		}
+#else
 		if (dovacuum)
 			table_oids = lappend_oid(table_oids, relid);
+#endif
 	}
 
 	heap_endscan(relScan);
 	heap_close(classRel, AccessShareLock);
 
+#ifdef ADB
+	/*
+	 * Tables to vacuum for wraparound come first, those closest to it first,
+	 * and do not wait for their turn among the Datanodes.
+	 */
+	if (wraparound_tables != NIL)
+	{
+		av_wraparound_table **sorted;
+		int			ntables = list_length(wraparound_tables);
+		int			i = 0;
+
+		sorted = (av_wraparound_table **)
+			palloc(ntables * sizeof(av_wraparound_table *));
+		foreach(cell, wraparound_tables)
+			sorted[i++] = (av_wraparound_table *) lfirst(cell);
+		qsort(sorted, ntables, sizeof(av_wraparound_table *),
+			  av_wraparound_cmp);
+
+		for (i = ntables; --i >= 0;)
+			table_oids = lcons_oid(sorted[i]->relid, table_oids);
+	}
+#endif
+
 	/*
 	 * Create a buffer access strategy object for VACUUM to use.  We want to
 	 * use the same one across all the vacuum operations we perform, since the
@@ -2484,6 +2596,123 @@ extract_autovac_opts(HeapTuple tup, TupleDesc pg_class_desc, AutoVacOpts2 **opts
 	return av;
 }
 
+#ifdef ADB
+/*
+ * autovac_get_datanode_slot
+ *
+ * Find the position of this Datanode among the Datanodes of pgxc_node,
+ * sorted by name the way the Coordinators sort them, and their number.
+ */
+static void
+autovac_get_datanode_slot(void)
+{
+	Relation	rel;
+	HeapScanDesc scan;
+	HeapTuple	tuple;
+	bool		found = false;
+	int			before = 0;
+
+	av_datanode_slot = -1;
+	av_num_datanodes = 0;
+
+	if (!IS_PGXC_DATANODE || PGXCNodeName == NULL || PGXCNodeName[0] == '\0')
+		return;
+
+	rel = heap_open(PgxcNodeRelationId, AccessShareLock);
+	scan = heap_beginscan(rel, SnapshotNow, 0, NULL);
+	while ((tuple = heap_getnext(scan, ForwardScanDirection)) != NULL)
+	{
+		Form_pgxc_node nodeForm = (Form_pgxc_node) GETSTRUCT(tuple);
+		int			cmp;
+
+		if (nodeForm->node_type != PGXC_NODE_DATANODE)
+			continue;
+
+		av_num_datanodes++;
+		cmp = strcmp(NameStr(nodeForm->node_name), PGXCNodeName);
+		if (cmp < 0)
+			before++;
+		else if (cmp == 0)
+			found = true;
+	}
+	heap_endscan(scan);
+	heap_close(rel, AccessShareLock);
+
+	if (found)
+		av_datanode_slot = before;
+}
+
+/*
+ * autovac_is_our_turn
+ *
+ * With autovacuum_stagger_interval, time is cut in windows of that many
+ * seconds, and in each window a given table is processed by one Datanode
+ * only, the next one in the following window.  So the Datanodes do not all
+ * vacuum the parts of a distributed table at once, and in a window each of
+ * them takes a different share of the tables.  The table is identified by
+ * its name since its OID differs from node to node.
+ */
+static bool
+autovac_is_our_turn(Oid relnamespace, const char *relname)
+{
+	char	   *nspname;
+	uint32		hash;
+	uint32		window;
+
+	if (autovacuum_stagger_interval <= 0 || av_datanode_slot < 0 ||
+		av_num_datanodes <= 1)
+		return true;
+
+	hash = DatumGetUInt32(hash_any((const unsigned char *) relname,
+								   strlen(relname)));
+	nspname = get_namespace_name(relnamespace);
+	if (nspname != NULL)
+		hash ^= DatumGetUInt32(hash_any((const unsigned char *) nspname,
+										strlen(nspname)));
+
+	window = (uint32) (timestamptz_to_time_t(GetCurrentTimestamp()) /
+					   autovacuum_stagger_interval);
+
+	return (hash + window) % av_num_datanodes == (uint32) av_datanode_slot;
+}
+
+/*
+ * autovac_add_wraparound
+ *
+ * Remember a table to vacuum for wraparound with the age of its
+ * relfrozenxid, from the same horizon relation_needs_vacanalyze() uses,
+ * which follows the transaction IDs AGTM gives out.
+ */
+static void
+autovac_add_wraparound(List **tables, Oid relid, Form_pg_class classForm)
+{
+	av_wraparound_table *table;
+
+	table = (av_wraparound_table *) palloc(sizeof(av_wraparound_table));
+	table->relid = relid;
+	if (TransactionIdIsNormal(classForm->relfrozenxid))
+		table->age = (int32) (recentXid - classForm->relfrozenxid);
+	else
+		table->age = 0;
+
+	*tables = lappend(*tables, table);
+}
+
+/* qsort comparator putting the oldest tables first */
+static int
+av_wraparound_cmp(const void *a, const void *b)
+{
+	const av_wraparound_table *ta = *(av_wraparound_table *const *) a;
+	const av_wraparound_table *tb = *(av_wraparound_table *const *) b;
+
+	if (ta->age > tb->age)
+		return -1;
+	if (ta->age < tb->age)
+		return 1;
+	return 0;
+}
+#endif   /* ADB */
+
 /*
  * get_pgstat_tabentry_relid
  *
@@ -2495,6 +2724,12 @@ get_pgstat_tabentry_relid(Oid relid, bool isshared, PgStat_StatDBEntry *shared,
 {
 	PgStat_StatTabEntry *tabentry = NULL;
 
+#ifdef ADB
+	/* the table entries are in shared memory, not in the database entries */
+	if (PointerIsValid(isshared ? shared : dbentry))
+		tabentry = pgstat_fetch_stat_tabentry_ext(isshared ? InvalidOid : MyDatabaseId,
+												  relid);
+#else
 	if (isshared)
 	{
 		if (PointerIsValid(shared))
@@ -2504,6 +2739,7 @@ get_pgstat_tabentry_relid(Oid relid, bool isshared, PgStat_StatDBEntry *shared,
 	else if (PointerIsValid(dbentry))
 		tabentry = hash_search(dbentry->tables, &relid,
 							   HASH_FIND, NULL);
+#endif
 
 	return tabentry;
 }
@@ -2600,9 +2836,7 @@ table_recheck_autovac(Oid relid, HTAB *table_toast_map,
 		/* 0 or -1 in autovac setting means use plain vacuum_cost_limit */
 		vac_cost_limit = (avopts && avopts->vacuum_cost_limit > 0)
 			? avopts->vacuum_cost_limit
-			: (autovacuum_vac_cost_limit > 0)
-			? autovacuum_vac_cost_limit
-			: VacuumCostLimit;
+			: autovac_default_cost_limit();
 
 		/* these do not have autovacuum-specific settings */
 		freeze_min_age = (avopts && avopts->freeze_min_age >= 0)
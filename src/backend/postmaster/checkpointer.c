@@ -416,6 +416,11 @@ CheckpointerMain(void)
 			ExitOnAnyError = true;
 			/* Close down the database */
 			ShutdownXLOG(0, 0);
+#ifdef ADB
+			/* no collector to save the statistics, keep them for restart */
+			pgstat_send_bgwriter();
+			pgstat_write_shared_statsfile();
+#endif
 			/* Normal exit from the checkpointer is here */
 			proc_exit(0);		/* done */
 		}
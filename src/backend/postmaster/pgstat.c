@@ -61,6 +61,12 @@
 #include "utils/rel.h"
 #include "utils/timestamp.h"
 #include "utils/tqual.h"
+#ifdef ADB
+#include "executor/instrument.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/waitevent.h"
+#endif
 
 
 /* ----------
@@ -103,6 +109,11 @@
 #define PGSTAT_TAB_HASH_SIZE	512
 #define PGSTAT_FUNCTION_HASH_SIZE	512
 
+#ifdef ADB
+/* Maximum number of databases of the shared database hash table */
+#define PGSTAT_SHARED_DB_HASH_SIZE	512
+#endif
+
 
 /* ----------
  * GUC parameters
@@ -112,6 +123,10 @@ bool		pgstat_track_activities = false;
 bool		pgstat_track_counts = false;
 int			pgstat_track_functions = TRACK_FUNC_OFF;
 int			pgstat_track_activity_query_size = 1024;
+#ifdef ADB
+int			pgstat_max_tables = 50000;
+int			pgstat_max_functions = 5000;
+#endif
 
 /* ----------
  * Built from GUC parameter
@@ -142,6 +157,66 @@ static time_t last_pgstat_start_time;
 
 static bool pgStatRunningInCollector = false;
 
+#ifdef ADB
+/*
+ * Statistics in shared memory
+ *
+ * There is no collector: the backends apply their messages to hash tables
+ * in shared memory themselves, and read the entries they want from there
+ * instead of from the stats files.
+ *
+ * The database entries and the cluster wide counters are protected by
+ * PgStatDBLock.  The table and function entries of all the databases are
+ * kept in two hash tables keyed by database and object OID, partitioned
+ * like the lock manager's: the partition lock of an entry is chosen by its
+ * hash code, the same in both tables.  PgStatDBLock is never taken while
+ * holding a partition lock, and the partition locks are taken in order
+ * when all of them are needed, to scan the tables.
+ *
+ * The tables have the fixed sizes set by stats_max_tables and
+ * stats_max_functions, objects not fitting are not counted.  The
+ * checkpointer writes all the entries to the permanent stats file at
+ * shutdown, and the postmaster loads them back when it creates the shared
+ * memory.
+ */
+typedef struct PgStat_SharedKey
+{
+	Oid			databaseid;		/* InvalidOid for shared relations */
+	Oid			objectid;		/* OID of the table or function */
+} PgStat_SharedKey;
+
+typedef struct PgStat_SharedTabEntry
+{
+	PgStat_SharedKey key;		/* hash key --- must be first */
+	PgStat_StatTabEntry tabentry;
+} PgStat_SharedTabEntry;
+
+typedef struct PgStat_SharedFuncEntry
+{
+	PgStat_SharedKey key;		/* hash key --- must be first */
+	PgStat_StatFuncEntry funcentry;
+} PgStat_SharedFuncEntry;
+
+#define PgStatHashPartition(hashcode) \
+	((hashcode) % NUM_PGSTAT_PARTITIONS)
+#define PgStatHashPartitionLock(hashcode) \
+	((LWLockId) (FirstPgStatLock + PgStatHashPartition(hashcode)))
+
+static PgStat_GlobalStats *sharedGlobalStats = NULL;
+static HTAB *sharedDBHash = NULL;
+static HTAB *sharedTabHash = NULL;
+static HTAB *sharedFuncHash = NULL;
+
+/* Whether we already complained about a full shared hash table */
+static bool sharedDBHashFull = false;
+static bool sharedTabHashFull = false;
+static bool sharedFuncHashFull = false;
+
+#define pgstat_disabled()	(sharedGlobalStats == NULL)
+#else
+#define pgstat_disabled()	(pgStatSock == PGINVALID_SOCKET)
+#endif
+
 /*
  * Structures in which backends store per-table info that's waiting to be
  * sent to the collector.
@@ -176,6 +251,16 @@ static HTAB *pgStatFunctions = NULL;
  */
 static bool have_function_stats = false;
 
+#ifdef ADB
+/*
+ * Latency histogram of the statements the backend ran since its last
+ * report to the collector, and whether the last reported state was running.
+ */
+static PgStat_Counter pgStatLatencyHist[LATENCY_HIST_BUCKETS];
+static bool have_latency_stats = false;
+static bool statement_running = false;
+#endif
+
 /*
  * Tuple insertion/deletion counts for an open transaction can't be propagated
  * into PgStat_TableStatus counters until we know if it is going to commit
@@ -214,6 +299,16 @@ static MemoryContext pgStatLocalContext = NULL;
 static HTAB *pgStatDBHash = NULL;
 static PgBackendStatus *localBackendStatusTable = NULL;
 static int	localNumBackends = 0;
+#ifdef ADB
+/*
+ * Copies of the shared entries read in the current transaction, the
+ * databases being in pgStatDBHash and the cluster wide counters in
+ * globalStats
+ */
+static HTAB *pgStatTabHash = NULL;
+static HTAB *pgStatFuncHash = NULL;
+static bool globalStatsValid = false;
+#endif
 
 /*
  * Cluster wide statistics, kept in the stats collector.
@@ -264,7 +359,9 @@ static void pgstat_write_statsfiles(bool permanent, bool allDbs);
 static void pgstat_write_db_statsfile(PgStat_StatDBEntry *dbentry, bool permanent);
 static HTAB *pgstat_read_statsfiles(Oid onlydb, bool permanent, bool deep);
 static void pgstat_read_db_statsfile(Oid databaseid, HTAB *tabhash, HTAB *funchash, bool permanent);
+#ifndef ADB
 static void backend_read_statsfile(void);
+#endif
 static void pgstat_read_current_status(void);
 
 static bool pgstat_write_statsfile_needed(void);
@@ -272,6 +369,11 @@ static bool pgstat_db_requested(Oid databaseid);
 
 static void pgstat_send_tabstat(PgStat_MsgTabstat *tsmsg);
 static void pgstat_send_funcstats(void);
+#ifdef ADB
+static void pgstat_send_latency(void);
+static void pgstat_count_statement_latency(BackendState state);
+#endif
+static void pgstat_vacuum_stat_hash(HTAB *dbhash);
 static HTAB *pgstat_collect_oids(Oid catalogid);
 
 static PgStat_TableStatus *get_tabstat_entry(Oid rel_id, bool isshared);
@@ -297,6 +399,52 @@ static void pgstat_recv_funcpurge(PgStat_MsgFuncpurge *msg, int len);
 static void pgstat_recv_recoveryconflict(PgStat_MsgRecoveryConflict *msg, int len);
 static void pgstat_recv_deadlock(PgStat_MsgDeadlock *msg, int len);
 static void pgstat_recv_tempfile(PgStat_MsgTempFile *msg, int len);
+#ifdef ADB
+static void pgstat_recv_latency(PgStat_MsgLatency *msg, int len);
+#endif
+
+static void pgstat_reset_db_counters(PgStat_StatDBEntry *dbentry);
+static void pgstat_add_tab_counts(PgStat_StatTabEntry *tabentry,
+					  PgStat_TableCounts *counts);
+static void pgstat_add_db_tab_counts(PgStat_StatDBEntry *dbentry,
+						 PgStat_TableCounts *counts);
+static void pgstat_update_vacuum(PgStat_StatTabEntry *tabentry,
+					 PgStat_MsgVacuum *msg);
+static void pgstat_update_analyze(PgStat_StatTabEntry *tabentry,
+					  PgStat_MsgAnalyze *msg);
+static void pgstat_update_bgwriter(PgStat_GlobalStats *stats,
+					   PgStat_MsgBgWriter *msg);
+static void pgstat_count_recovery_conflict(PgStat_StatDBEntry *dbentry,
+							   int reason);
+
+#ifdef ADB
+static void pgstat_apply_message(PgStat_Msg *msg);
+static PgStat_StatDBEntry *pgstat_get_shared_db_entry(Oid databaseid,
+						   bool create);
+static void pgstat_ensure_shared_db_entry(Oid databaseid);
+static void *pgstat_get_shared_entry(HTAB *hash, Oid databaseid, Oid objectid,
+						HASHACTION action, LWLockMode mode, LWLockId *lock,
+						bool *found);
+static PgStat_StatTabEntry *pgstat_get_shared_tab_entry(Oid databaseid,
+							Oid tableoid, bool create, LWLockId *lock);
+static PgStat_StatFuncEntry *pgstat_get_shared_func_entry(Oid databaseid,
+							 Oid funcoid, bool create, LWLockId *lock);
+static void pgstat_shared_tabstat(PgStat_MsgTabstat *msg);
+static void pgstat_shared_purge(HTAB *hash, Oid databaseid, Oid *objectids,
+					int nentries);
+static void pgstat_shared_dropdb(Oid databaseid, bool reset);
+static void pgstat_shared_resetsinglecounter(PgStat_MsgResetsinglecounter *msg);
+static void pgstat_shared_vacuum(PgStat_MsgVacuum *msg);
+static void pgstat_shared_analyze(PgStat_MsgAnalyze *msg);
+static void pgstat_shared_funcstat(PgStat_MsgFuncstat *msg);
+static void pgstat_remove_shared_entries(bool alldbs, Oid databaseid);
+static HTAB *pgstat_copy_shared_stats(Oid databaseid);
+static void pgstat_read_shared_statsfile(void);
+static void pgstat_setup_local_hashes(void);
+static PgStat_StatDBEntry *pgstat_fetch_shared_dbentry(Oid dbid);
+static PgStat_StatFuncEntry *pgstat_fetch_shared_funcentry(Oid dbid,
+							  Oid funcid);
+#endif
 
 /* ------------------------------------------------------------
  * Public functions called from postmaster follow
@@ -328,6 +476,14 @@ pgstat_init(void)
 
 #define TESTBYTEVAL ((char) 199)
 
+#ifdef ADB
+	/*
+	 * The backends keep the statistics in shared memory themselves, there is
+	 * no collector to create a socket for.
+	 */
+	return;
+#endif
+
 	/*
 	 * Create the UDP socket for sending and receiving statistic messages
 	 */
@@ -608,6 +764,11 @@ pgstat_reset_all(void)
 {
 	pgstat_reset_remove_files(pgstat_stat_directory);
 	pgstat_reset_remove_files(PGSTAT_STAT_PERMANENT_DIRECTORY);
+#ifdef ADB
+	/* forget what the postmaster loaded from the permanent file, too */
+	if (sharedGlobalStats != NULL)
+		pgstat_remove_shared_entries(true, InvalidOid);
+#endif
 }
 
 #ifdef EXEC_BACKEND
@@ -742,9 +903,18 @@ pgstat_report_stat(bool force)
 	TabStatusArray *tsa;
 	int			i;
 
+#ifdef ADB
+	/* wait event counters live in shared memory, not in the collector */
+	WaitEventFlushCounts(force);
+#endif
+
 	/* Don't expend a clock check if nothing to do */
 	if ((pgStatTabList == NULL || pgStatTabList->tsa_used == 0) &&
-		!have_function_stats && !force)
+		!have_function_stats &&
+#ifdef ADB
+		!have_latency_stats &&
+#endif
+		!force)
 		return;
 
 	/*
@@ -819,6 +989,11 @@ pgstat_report_stat(bool force)
 
 	/* Now, send function statistics */
 	pgstat_send_funcstats();
+
+#ifdef ADB
+	/* And the latencies of the statements */
+	pgstat_send_latency();
+#endif
 }
 
 /*
@@ -831,7 +1006,7 @@ pgstat_send_tabstat(PgStat_MsgTabstat *tsmsg)
 	int			len;
 
 	/* It's unlikely we'd get here with no socket, but maybe not impossible */
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	/*
@@ -920,6 +1095,57 @@ pgstat_send_funcstats(void)
 	have_function_stats = false;
 }
 
+#ifdef ADB
+/*
+ * Subroutine for pgstat_report_stat: send the latency histogram of the
+ * statements run since the last report
+ */
+static void
+pgstat_send_latency(void)
+{
+	PgStat_MsgLatency msg;
+
+	if (!have_latency_stats)
+		return;
+
+	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_LATENCY);
+	msg.m_databaseid = MyDatabaseId;
+	memcpy(msg.m_counts, pgStatLatencyHist, sizeof(msg.m_counts));
+	pgstat_send(&msg, sizeof(msg));
+
+	MemSet(pgStatLatencyHist, 0, sizeof(pgStatLatencyHist));
+	have_latency_stats = false;
+}
+
+/*
+ * Count the statement which started at the statement start timestamp and
+ * just finished, "state" being the new state of the backend.
+ */
+static void
+pgstat_count_statement_latency(BackendState state)
+{
+	if (state == STATE_RUNNING)
+	{
+		statement_running = true;
+		return;
+	}
+	if (!statement_running)
+		return;
+	statement_running = false;
+
+	if (pgstat_track_counts)
+	{
+		long		secs;
+		int			usecs;
+
+		TimestampDifference(GetCurrentStatementStartTimestamp(),
+							GetCurrentTimestamp(), &secs, &usecs);
+		pgStatLatencyHist[LatencyHistBucket((uint64) secs * USECS_PER_SEC + usecs)]++;
+		have_latency_stats = true;
+	}
+}
+#endif
+
 
 /* ----------
  * pgstat_vacuum_stat() -
@@ -930,24 +1156,58 @@ pgstat_send_funcstats(void)
 void
 pgstat_vacuum_stat(void)
 {
-	HTAB	   *htab;
-	PgStat_MsgTabpurge msg;
-	PgStat_MsgFuncpurge f_msg;
-	HASH_SEQ_STATUS hstat;
-	PgStat_StatDBEntry *dbentry;
-	PgStat_StatTabEntry *tabentry;
-	PgStat_StatFuncEntry *funcentry;
-	int			len;
+#ifdef ADB
+	MemoryContext vacuum_context;
+	MemoryContext oldcontext;
+#endif
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
+#ifdef ADB
+	/*
+	 * Work on a copy of the shared hash tables, since removing entries locks
+	 * them.  The copy can be big, get rid of it as soon as we are done.
+	 */
+	vacuum_context = AllocSetContextCreate(CurrentMemoryContext,
+										   "Statistics vacuum",
+										   ALLOCSET_DEFAULT_MINSIZE,
+										   ALLOCSET_DEFAULT_INITSIZE,
+										   ALLOCSET_DEFAULT_MAXSIZE);
+	oldcontext = MemoryContextSwitchTo(vacuum_context);
+
+	pgstat_vacuum_stat_hash(pgstat_copy_shared_stats(MyDatabaseId));
+
+	MemoryContextSwitchTo(oldcontext);
+	MemoryContextDelete(vacuum_context);
+#else
 	/*
 	 * If not done for this transaction, read the statistics collector stats
 	 * file into some hash tables.
 	 */
 	backend_read_statsfile();
 
+	pgstat_vacuum_stat_hash(pgStatDBHash);
+#endif
+}
+
+/*
+ * Subroutine for pgstat_vacuum_stat: tell the collector about the objects
+ * of the databases in "dbhash" which do not exist anymore, the table and
+ * function hashes being there for our database only.
+ */
+static void
+pgstat_vacuum_stat_hash(HTAB *dbhash)
+{
+	HTAB	   *htab;
+	PgStat_MsgTabpurge msg;
+	PgStat_MsgFuncpurge f_msg;
+	HASH_SEQ_STATUS hstat;
+	PgStat_StatDBEntry *dbentry;
+	PgStat_StatTabEntry *tabentry;
+	PgStat_StatFuncEntry *funcentry;
+	int			len;
+
 	/*
 	 * Read pg_database and make a list of OIDs of all existing databases
 	 */
@@ -957,7 +1217,7 @@ pgstat_vacuum_stat(void)
 	 * Search the database hash table for dead databases and tell the
 	 * collector to drop them.
 	 */
-	hash_seq_init(&hstat, pgStatDBHash);
+	hash_seq_init(&hstat, dbhash);
 	while ((dbentry = (PgStat_StatDBEntry *) hash_seq_search(&hstat)) != NULL)
 	{
 		Oid			dbid = dbentry->databaseid;
@@ -976,7 +1236,7 @@ pgstat_vacuum_stat(void)
 	/*
 	 * Lookup our own database entry; if not found, nothing more to do.
 	 */
-	dbentry = (PgStat_StatDBEntry *) hash_search(pgStatDBHash,
+	dbentry = (PgStat_StatDBEntry *) hash_search(dbhash,
 												 (void *) &MyDatabaseId,
 												 HASH_FIND, NULL);
 	if (dbentry == NULL || dbentry->tables == NULL)
@@ -1158,7 +1418,7 @@ pgstat_drop_database(Oid databaseid)
 {
 	PgStat_MsgDropdb msg;
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_DROPDB);
@@ -1185,7 +1445,7 @@ pgstat_drop_relation(Oid relid)
 	PgStat_MsgTabpurge msg;
 	int			len;
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	msg.m_tableid[0] = relid;
@@ -1211,7 +1471,7 @@ pgstat_reset_counters(void)
 {
 	PgStat_MsgResetcounter msg;
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	if (!superuser())
@@ -1235,7 +1495,7 @@ pgstat_reset_shared_counters(const char *target)
 {
 	PgStat_MsgResetsharedcounter msg;
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	if (!superuser())
@@ -1245,11 +1505,25 @@ pgstat_reset_shared_counters(const char *target)
 
 	if (strcmp(target, "bgwriter") == 0)
 		msg.m_resettarget = RESET_BGWRITER;
+#ifdef ADB
+	else if (strcmp(target, "wait_events") == 0)
+	{
+		/* kept in shared memory, not by the collector */
+		WaitEventResetCounts();
+		return;
+	}
+	else
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("unrecognized reset target: \"%s\"", target),
+				 errhint("Target must be \"bgwriter\" or \"wait_events\".")));
+#else
 	else
 		ereport(ERROR,
 				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
 				 errmsg("unrecognized reset target: \"%s\"", target),
 				 errhint("Target must be \"bgwriter\".")));
+#endif
 
 	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_RESETSHAREDCOUNTER);
 	pgstat_send(&msg, sizeof(msg));
@@ -1266,7 +1540,7 @@ pgstat_reset_single_counter(Oid objoid, PgStat_Single_Reset_Type type)
 {
 	PgStat_MsgResetsinglecounter msg;
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	if (!superuser())
@@ -1295,7 +1569,7 @@ pgstat_report_autovac(Oid dboid)
 {
 	PgStat_MsgAutovacStart msg;
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_AUTOVAC_START);
@@ -1317,7 +1591,7 @@ pgstat_report_vacuum(Oid tableoid, bool shared, PgStat_Counter tuples)
 {
 	PgStat_MsgVacuum msg;
 
-	if (pgStatSock == PGINVALID_SOCKET || !pgstat_track_counts)
+	if (pgstat_disabled() || !pgstat_track_counts)
 		return;
 
 	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_VACUUM);
@@ -1341,7 +1615,7 @@ pgstat_report_analyze(Relation rel,
 {
 	PgStat_MsgAnalyze msg;
 
-	if (pgStatSock == PGINVALID_SOCKET || !pgstat_track_counts)
+	if (pgstat_disabled() || !pgstat_track_counts)
 		return;
 
 	/*
@@ -1391,7 +1665,7 @@ pgstat_report_recovery_conflict(int reason)
 {
 	PgStat_MsgRecoveryConflict msg;
 
-	if (pgStatSock == PGINVALID_SOCKET || !pgstat_track_counts)
+	if (pgstat_disabled() || !pgstat_track_counts)
 		return;
 
 	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_RECOVERYCONFLICT);
@@ -1411,7 +1685,7 @@ pgstat_report_deadlock(void)
 {
 	PgStat_MsgDeadlock msg;
 
-	if (pgStatSock == PGINVALID_SOCKET || !pgstat_track_counts)
+	if (pgstat_disabled() || !pgstat_track_counts)
 		return;
 
 	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_DEADLOCK);
@@ -1430,7 +1704,7 @@ pgstat_report_tempfile(size_t filesize)
 {
 	PgStat_MsgTempFile msg;
 
-	if (pgStatSock == PGINVALID_SOCKET || !pgstat_track_counts)
+	if (pgstat_disabled() || !pgstat_track_counts)
 		return;
 
 	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_TEMPFILE);
@@ -1451,13 +1725,14 @@ pgstat_ping(void)
 {
 	PgStat_MsgDummy msg;
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	pgstat_setheader(&msg.m_hdr, PGSTAT_MTYPE_DUMMY);
 	pgstat_send(&msg, sizeof(msg));
 }
 
+#ifndef ADB
 /* ----------
  * pgstat_send_inquiry() -
  *
@@ -1475,6 +1750,7 @@ pgstat_send_inquiry(TimestampTz clock_time, TimestampTz cutoff_time, Oid databas
 	msg.databaseid = databaseid;
 	pgstat_send(&msg, sizeof(msg));
 }
+#endif
 
 
 /*
@@ -1628,7 +1904,7 @@ pgstat_initstats(Relation rel)
 		return;
 	}
 
-	if (pgStatSock == PGINVALID_SOCKET || !pgstat_track_counts)
+	if (pgstat_disabled() || !pgstat_track_counts)
 	{
 		/* We're not counting at all */
 		rel->pgstat_info = NULL;
@@ -1802,9 +2078,12 @@ pgstat_count_heap_insert(Relation rel, int n)
 
 /*
  * pgstat_count_heap_update - count a tuple update
+ *
+ * newpage says whether the new tuple version went onto another page than
+ * the old one, which is what most often keeps an update from being HOT.
  */
 void
-pgstat_count_heap_update(Relation rel, bool hot)
+pgstat_count_heap_update(Relation rel, bool hot, bool newpage)
 {
 	PgStat_TableStatus *pgstat_info = rel->pgstat_info;
 
@@ -1822,6 +2101,9 @@ pgstat_count_heap_update(Relation rel, bool hot)
 		/* t_tuples_hot_updated is nontransactional, so just advance it */
 		if (hot)
 			pgstat_info->t_counts.t_tuples_hot_updated++;
+		/* likewise t_tuples_newpage_updated */
+		if (newpage)
+			pgstat_info->t_counts.t_tuples_newpage_updated++;
 	}
 }
 
@@ -1846,6 +2128,20 @@ pgstat_count_heap_delete(Relation rel)
 	}
 }
 
+/*
+ * pgstat_count_heap_prune - count an opportunistic prune of a heap page
+ *
+ * This is nontransactional, like the dead-tuples count it comes with.
+ */
+void
+pgstat_count_heap_prune(Relation rel)
+{
+	PgStat_TableStatus *pgstat_info = rel->pgstat_info;
+
+	if (pgstat_info != NULL)
+		pgstat_info->t_counts.t_pages_pruned++;
+}
+
 /*
  * pgstat_update_heap_dead_tuples - update dead-tuples count
  *
@@ -2166,6 +2462,9 @@ pgstat_twophase_postabort(TransactionId xid, uint16 info,
 PgStat_StatDBEntry *
 pgstat_fetch_stat_dbentry(Oid dbid)
 {
+#ifdef ADB
+	return pgstat_fetch_shared_dbentry(dbid);
+#else
 	/*
 	 * If not done for this transaction, read the statistics collector stats
 	 * file into some hash tables.
@@ -2178,6 +2477,7 @@ pgstat_fetch_stat_dbentry(Oid dbid)
 	return (PgStat_StatDBEntry *) hash_search(pgStatDBHash,
 											  (void *) &dbid,
 											  HASH_FIND, NULL);
+#endif
 }
 
 
@@ -2193,6 +2493,16 @@ pgstat_fetch_stat_dbentry(Oid dbid)
 PgStat_StatTabEntry *
 pgstat_fetch_stat_tabentry(Oid relid)
 {
+#ifdef ADB
+	PgStat_StatTabEntry *tabentry;
+
+	/* look in our database, then maybe it's a shared table */
+	tabentry = pgstat_fetch_stat_tabentry_ext(MyDatabaseId, relid);
+	if (tabentry == NULL)
+		tabentry = pgstat_fetch_stat_tabentry_ext(InvalidOid, relid);
+
+	return tabentry;
+#else
 	Oid			dbid;
 	PgStat_StatDBEntry *dbentry;
 	PgStat_StatTabEntry *tabentry;
@@ -2236,7 +2546,55 @@ pgstat_fetch_stat_tabentry(Oid relid)
 	}
 
 	return NULL;
+#endif
+}
+
+#ifdef ADB
+/* ----------
+ * pgstat_fetch_stat_tabentry_ext() -
+ *
+ *	Like pgstat_fetch_stat_tabentry(), for the table "relid" of database
+ *	"dbid", InvalidOid meaning a shared table.  The entry is copied from
+ *	shared memory the first time it is asked for in a transaction, then
+ *	returned as it was until pgstat_clear_snapshot().
+ * ----------
+ */
+PgStat_StatTabEntry *
+pgstat_fetch_stat_tabentry_ext(Oid dbid, Oid relid)
+{
+	PgStat_SharedKey key;
+	PgStat_SharedTabEntry *entry;
+	PgStat_StatTabEntry *shared;
+	PgStat_StatTabEntry copy;
+	LWLockId	lock;
+
+	if (pgstat_disabled())
+		return NULL;
+
+	pgstat_setup_local_hashes();
+
+	key.databaseid = dbid;
+	key.objectid = relid;
+	entry = (PgStat_SharedTabEntry *) hash_search(pgStatTabHash, &key,
+												  HASH_FIND, NULL);
+	if (entry != NULL)
+		return &entry->tabentry;
+
+	shared = pgstat_get_shared_tab_entry(dbid, relid, false, &lock);
+	if (shared != NULL)
+		memcpy(&copy, shared, sizeof(PgStat_StatTabEntry));
+	LWLockRelease(lock);
+
+	if (shared == NULL)
+		return NULL;
+
+	entry = (PgStat_SharedTabEntry *) hash_search(pgStatTabHash, &key,
+												  HASH_ENTER, NULL);
+	memcpy(&entry->tabentry, &copy, sizeof(PgStat_StatTabEntry));
+
+	return &entry->tabentry;
 }
+#endif
 
 
 /* ----------
@@ -2249,6 +2607,9 @@ pgstat_fetch_stat_tabentry(Oid relid)
 PgStat_StatFuncEntry *
 pgstat_fetch_stat_funcentry(Oid func_id)
 {
+#ifdef ADB
+	return pgstat_fetch_shared_funcentry(MyDatabaseId, func_id);
+#else
 	PgStat_StatDBEntry *dbentry;
 	PgStat_StatFuncEntry *funcentry = NULL;
 
@@ -2265,6 +2626,7 @@ pgstat_fetch_stat_funcentry(Oid func_id)
 	}
 
 	return funcentry;
+#endif
 }
 
 
@@ -2316,7 +2678,17 @@ pgstat_fetch_stat_numbackends(void)
 PgStat_GlobalStats *
 pgstat_fetch_global(void)
 {
+#ifdef ADB
+	if (!globalStatsValid && !pgstat_disabled())
+	{
+		LWLockAcquire(PgStatDBLock, LW_SHARED);
+		memcpy(&globalStats, sharedGlobalStats, sizeof(PgStat_GlobalStats));
+		LWLockRelease(PgStatDBLock);
+		globalStatsValid = true;
+	}
+#else
 	backend_read_statsfile();
+#endif
 
 	return &globalStats;
 }
@@ -2333,6 +2705,12 @@ static char *BackendClientHostnameBuffer = NULL;
 static char *BackendAppnameBuffer = NULL;
 static char *BackendActivityBuffer = NULL;
 static Size BackendActivityBufferSize = 0;
+#ifdef ADB
+/* pgBufferUsage when the current command started */
+static BufferUsage remoteUsageStart;
+
+static void pgstat_set_remote_traffic(volatile PgBackendStatus *beentry);
+#endif
 
 
 /*
@@ -2527,6 +2905,10 @@ pgstat_bestart(void)
 	beentry->st_state = STATE_UNDEFINED;
 	beentry->st_appname[0] = '\0';
 	beentry->st_activity[0] = '\0';
+#ifdef ADB
+	remoteUsageStart = pgBufferUsage;
+	pgstat_set_remote_traffic(beentry);
+#endif
 	/* Also make sure the last byte in each string area is always 0 */
 	beentry->st_clienthostname[NAMEDATALEN - 1] = '\0';
 	beentry->st_appname[NAMEDATALEN - 1] = '\0';
@@ -2601,6 +2983,10 @@ pgstat_report_activity(BackendState state, const char *cmd_str)
 	if (!beentry)
 		return;
 
+#ifdef ADB
+	pgstat_count_statement_latency(state);
+#endif
+
 	if (!pgstat_track_activities)
 	{
 		if (beentry->st_state != STATE_DISABLED)
@@ -2618,6 +3004,10 @@ pgstat_report_activity(BackendState state, const char *cmd_str)
 			/* st_xact_start_timestamp and st_waiting are also disabled */
 			beentry->st_xact_start_timestamp = 0;
 			beentry->st_waiting = false;
+#ifdef ADB
+			remoteUsageStart = pgBufferUsage;
+			pgstat_set_remote_traffic(beentry);
+#endif
 			beentry->st_changecount++;
 			Assert((beentry->st_changecount & 1) == 0);
 		}
@@ -2649,11 +3039,60 @@ pgstat_report_activity(BackendState state, const char *cmd_str)
 		memcpy((char *) beentry->st_activity, cmd_str, len);
 		beentry->st_activity[len] = '\0';
 		beentry->st_activity_start_timestamp = start_timestamp;
+#ifdef ADB
+		remoteUsageStart = pgBufferUsage;
+#endif
 	}
+#ifdef ADB
+	pgstat_set_remote_traffic(beentry);
+#endif
+
+	beentry->st_changecount++;
+	Assert((beentry->st_changecount & 1) == 0);
+}
+
+#ifdef ADB
+/*
+ * Store in the entry the traffic with the other nodes of the current
+ * command, which is the growth of pgBufferUsage since it started.  The
+ * caller bumps st_changecount.
+ */
+static void
+pgstat_set_remote_traffic(volatile PgBackendStatus *beentry)
+{
+	beentry->st_remote_bytes_sent =
+		pgBufferUsage.remote_bytes_sent - remoteUsageStart.remote_bytes_sent;
+	beentry->st_remote_bytes_received =
+		pgBufferUsage.remote_bytes_received - remoteUsageStart.remote_bytes_received;
+	beentry->st_remote_msgs_sent =
+		pgBufferUsage.remote_msgs_sent - remoteUsageStart.remote_msgs_sent;
+	beentry->st_remote_msgs_received =
+		pgBufferUsage.remote_msgs_received - remoteUsageStart.remote_msgs_received;
+	beentry->st_remote_round_trips =
+		pgBufferUsage.remote_round_trips - remoteUsageStart.remote_round_trips;
+}
+
+/* ----------
+ * pgstat_report_remote_traffic() -
+ *
+ *	Called to update the traffic with the other nodes of the current
+ *	command while it runs; it is also updated at each change of state.
+ * ----------
+ */
+void
+pgstat_report_remote_traffic(void)
+{
+	volatile PgBackendStatus *beentry = MyBEEntry;
+
+	if (!pgstat_track_activities || !beentry)
+		return;
 
+	beentry->st_changecount++;
+	pgstat_set_remote_traffic(beentry);
 	beentry->st_changecount++;
 	Assert((beentry->st_changecount & 1) == 0);
 }
+#endif
 
 /* ----------
  * pgstat_report_appname() -
@@ -3000,13 +3439,19 @@ pgstat_setheader(PgStat_MsgHdr *hdr, StatMsgType mtype)
 static void
 pgstat_send(void *msg, int len)
 {
+#ifndef ADB
 	int			rc;
+#endif
 
-	if (pgStatSock == PGINVALID_SOCKET)
+	if (pgstat_disabled())
 		return;
 
 	((PgStat_MsgHdr *) msg)->m_size = len;
 
+#ifdef ADB
+	/* there is no collector, apply the message to shared memory ourselves */
+	pgstat_apply_message((PgStat_Msg *) msg);
+#else
 	/* We'll retry after EINTR, but ignore all other failures */
 	do
 	{
@@ -3018,6 +3463,7 @@ pgstat_send(void *msg, int len)
 	if (rc < 0)
 		elog(LOG, "could not send to statistics collector: %m");
 #endif
+#endif   /* ADB */
 }
 
 /* ----------
@@ -3287,6 +3733,12 @@ PgstatCollectorMain(int argc, char *argv[])
 					pgstat_recv_tempfile((PgStat_MsgTempFile *) &msg, len);
 					break;
 
+#ifdef ADB
+				case PGSTAT_MTYPE_LATENCY:
+					pgstat_recv_latency((PgStat_MsgLatency *) &msg, len);
+					break;
+#endif
+
 				default:
 					break;
 			}
@@ -3367,6 +3819,32 @@ reset_dbentry_counters(PgStat_StatDBEntry *dbentry)
 {
 	HASHCTL		hash_ctl;
 
+	pgstat_reset_db_counters(dbentry);
+
+	memset(&hash_ctl, 0, sizeof(hash_ctl));
+	hash_ctl.keysize = sizeof(Oid);
+	hash_ctl.entrysize = sizeof(PgStat_StatTabEntry);
+	hash_ctl.hash = oid_hash;
+	dbentry->tables = hash_create("Per-database table",
+								  PGSTAT_TAB_HASH_SIZE,
+								  &hash_ctl,
+								  HASH_ELEM | HASH_FUNCTION);
+
+	hash_ctl.keysize = sizeof(Oid);
+	hash_ctl.entrysize = sizeof(PgStat_StatFuncEntry);
+	hash_ctl.hash = oid_hash;
+	dbentry->functions = hash_create("Per-database function",
+									 PGSTAT_FUNCTION_HASH_SIZE,
+									 &hash_ctl,
+									 HASH_ELEM | HASH_FUNCTION);
+}
+
+/*
+ * Subroutine for reset_dbentry_counters: the counters alone
+ */
+static void
+pgstat_reset_db_counters(PgStat_StatDBEntry *dbentry)
+{
 	dbentry->n_xact_commit = 0;
 	dbentry->n_xact_rollback = 0;
 	dbentry->n_blocks_fetched = 0;
@@ -3387,26 +3865,12 @@ reset_dbentry_counters(PgStat_StatDBEntry *dbentry)
 	dbentry->n_deadlocks = 0;
 	dbentry->n_block_read_time = 0;
 	dbentry->n_block_write_time = 0;
+#ifdef ADB
+	MemSet(dbentry->n_latency_hist, 0, sizeof(dbentry->n_latency_hist));
+#endif
 
 	dbentry->stat_reset_timestamp = GetCurrentTimestamp();
 	dbentry->stats_timestamp = 0;
-
-	memset(&hash_ctl, 0, sizeof(hash_ctl));
-	hash_ctl.keysize = sizeof(Oid);
-	hash_ctl.entrysize = sizeof(PgStat_StatTabEntry);
-	hash_ctl.hash = oid_hash;
-	dbentry->tables = hash_create("Per-database table",
-								  PGSTAT_TAB_HASH_SIZE,
-								  &hash_ctl,
-								  HASH_ELEM | HASH_FUNCTION);
-
-	hash_ctl.keysize = sizeof(Oid);
-	hash_ctl.entrysize = sizeof(PgStat_StatFuncEntry);
-	hash_ctl.hash = oid_hash;
-	dbentry->functions = hash_create("Per-database function",
-									 PGSTAT_FUNCTION_HASH_SIZE,
-									 &hash_ctl,
-									 HASH_ELEM | HASH_FUNCTION);
 }
 
 /*
@@ -3470,6 +3934,8 @@ pgstat_get_tab_entry(PgStat_StatDBEntry *dbentry, Oid tableoid, bool create)
 		result->tuples_updated = 0;
 		result->tuples_deleted = 0;
 		result->tuples_hot_updated = 0;
+		result->tuples_newpage_updated = 0;
+		result->pages_pruned = 0;
 		result->n_live_tuples = 0;
 		result->n_dead_tuples = 0;
 		result->changes_since_analyze = 0;
@@ -4131,6 +4597,7 @@ done:
 	return;
 }
 
+#ifndef ADB
 /* ----------
  * pgstat_read_db_statsfile_timestamp() -
  *
@@ -4367,6 +4834,7 @@ backend_read_statsfile(void)
 	else
 		pgStatDBHash = pgstat_read_statsfiles(MyDatabaseId, false, true);
 }
+#endif   /* ADB */
 
 
 /* ----------
@@ -4409,6 +4877,11 @@ pgstat_clear_snapshot(void)
 	pgStatDBHash = NULL;
 	localBackendStatusTable = NULL;
 	localNumBackends = 0;
+#ifdef ADB
+	pgStatTabHash = NULL;
+	pgStatFuncHash = NULL;
+	globalStatsValid = false;
+#endif
 }
 
 
@@ -4507,7 +4980,6 @@ pgstat_recv_tabstat(PgStat_MsgTabstat *msg, int len)
 	PgStat_StatDBEntry *dbentry;
 	PgStat_StatTabEntry *tabentry;
 	int			i;
-	bool		found;
 
 	dbentry = pgstat_get_db_entry(msg->m_databaseid, true);
 
@@ -4526,75 +4998,62 @@ pgstat_recv_tabstat(PgStat_MsgTabstat *msg, int len)
 	{
 		PgStat_TableEntry *tabmsg = &(msg->m_entry[i]);
 
-		tabentry = (PgStat_StatTabEntry *) hash_search(dbentry->tables,
-													(void *) &(tabmsg->t_id),
-													   HASH_ENTER, &found);
-
-		if (!found)
-		{
-			/*
-			 * If it's a new table entry, initialize counters to the values we
-			 * just got.
-			 */
-			tabentry->numscans = tabmsg->t_counts.t_numscans;
-			tabentry->tuples_returned = tabmsg->t_counts.t_tuples_returned;
-			tabentry->tuples_fetched = tabmsg->t_counts.t_tuples_fetched;
-			tabentry->tuples_inserted = tabmsg->t_counts.t_tuples_inserted;
-			tabentry->tuples_updated = tabmsg->t_counts.t_tuples_updated;
-			tabentry->tuples_deleted = tabmsg->t_counts.t_tuples_deleted;
-			tabentry->tuples_hot_updated = tabmsg->t_counts.t_tuples_hot_updated;
-			tabentry->n_live_tuples = tabmsg->t_counts.t_delta_live_tuples;
-			tabentry->n_dead_tuples = tabmsg->t_counts.t_delta_dead_tuples;
-			tabentry->changes_since_analyze = tabmsg->t_counts.t_changed_tuples;
-			tabentry->blocks_fetched = tabmsg->t_counts.t_blocks_fetched;
-			tabentry->blocks_hit = tabmsg->t_counts.t_blocks_hit;
-
-			tabentry->vacuum_timestamp = 0;
-			tabentry->vacuum_count = 0;
-			tabentry->autovac_vacuum_timestamp = 0;
-			tabentry->autovac_vacuum_count = 0;
-			tabentry->analyze_timestamp = 0;
-			tabentry->analyze_count = 0;
-			tabentry->autovac_analyze_timestamp = 0;
-			tabentry->autovac_analyze_count = 0;
-		}
-		else
-		{
-			/*
-			 * Otherwise add the values to the existing entry.
-			 */
-			tabentry->numscans += tabmsg->t_counts.t_numscans;
-			tabentry->tuples_returned += tabmsg->t_counts.t_tuples_returned;
-			tabentry->tuples_fetched += tabmsg->t_counts.t_tuples_fetched;
-			tabentry->tuples_inserted += tabmsg->t_counts.t_tuples_inserted;
-			tabentry->tuples_updated += tabmsg->t_counts.t_tuples_updated;
-			tabentry->tuples_deleted += tabmsg->t_counts.t_tuples_deleted;
-			tabentry->tuples_hot_updated += tabmsg->t_counts.t_tuples_hot_updated;
-			tabentry->n_live_tuples += tabmsg->t_counts.t_delta_live_tuples;
-			tabentry->n_dead_tuples += tabmsg->t_counts.t_delta_dead_tuples;
-			tabentry->changes_since_analyze += tabmsg->t_counts.t_changed_tuples;
-			tabentry->blocks_fetched += tabmsg->t_counts.t_blocks_fetched;
-			tabentry->blocks_hit += tabmsg->t_counts.t_blocks_hit;
-		}
-
-		/* Clamp n_live_tuples in case of negative delta_live_tuples */
-		tabentry->n_live_tuples = Max(tabentry->n_live_tuples, 0);
-		/* Likewise for n_dead_tuples */
-		tabentry->n_dead_tuples = Max(tabentry->n_dead_tuples, 0);
+		/*
+		 * A new table entry starts from zero, so it gets the values we just
+		 * got.
+		 */
+		tabentry = pgstat_get_tab_entry(dbentry, tabmsg->t_id, true);
+		pgstat_add_tab_counts(tabentry, &tabmsg->t_counts);
 
 		/*
 		 * Add per-table stats to the per-database entry, too.
 		 */
-		dbentry->n_tuples_returned += tabmsg->t_counts.t_tuples_returned;
-		dbentry->n_tuples_fetched += tabmsg->t_counts.t_tuples_fetched;
-		dbentry->n_tuples_inserted += tabmsg->t_counts.t_tuples_inserted;
-		dbentry->n_tuples_updated += tabmsg->t_counts.t_tuples_updated;
-		dbentry->n_tuples_deleted += tabmsg->t_counts.t_tuples_deleted;
-		dbentry->n_blocks_fetched += tabmsg->t_counts.t_blocks_fetched;
-		dbentry->n_blocks_hit += tabmsg->t_counts.t_blocks_hit;
+		pgstat_add_db_tab_counts(dbentry, &tabmsg->t_counts);
 	}
 }
 
+/*
+ * Add the counts of a tabstat message to a table entry
+ */
+static void
+pgstat_add_tab_counts(PgStat_StatTabEntry *tabentry, PgStat_TableCounts *counts)
+{
+	tabentry->numscans += counts->t_numscans;
+	tabentry->tuples_returned += counts->t_tuples_returned;
+	tabentry->tuples_fetched += counts->t_tuples_fetched;
+	tabentry->tuples_inserted += counts->t_tuples_inserted;
+	tabentry->tuples_updated += counts->t_tuples_updated;
+	tabentry->tuples_deleted += counts->t_tuples_deleted;
+	tabentry->tuples_hot_updated += counts->t_tuples_hot_updated;
+	tabentry->tuples_newpage_updated += counts->t_tuples_newpage_updated;
+	tabentry->pages_pruned += counts->t_pages_pruned;
+	tabentry->n_live_tuples += counts->t_delta_live_tuples;
+	tabentry->n_dead_tuples += counts->t_delta_dead_tuples;
+	tabentry->changes_since_analyze += counts->t_changed_tuples;
+	tabentry->blocks_fetched += counts->t_blocks_fetched;
+	tabentry->blocks_hit += counts->t_blocks_hit;
+
+	/* Clamp n_live_tuples in case of negative delta_live_tuples */
+	tabentry->n_live_tuples = Max(tabentry->n_live_tuples, 0);
+	/* Likewise for n_dead_tuples */
+	tabentry->n_dead_tuples = Max(tabentry->n_dead_tuples, 0);
+}
+
+/*
+ * Add the counts of a table to its database entry
+ */
+static void
+pgstat_add_db_tab_counts(PgStat_StatDBEntry *dbentry, PgStat_TableCounts *counts)
+{
+	dbentry->n_tuples_returned += counts->t_tuples_returned;
+	dbentry->n_tuples_fetched += counts->t_tuples_fetched;
+	dbentry->n_tuples_inserted += counts->t_tuples_inserted;
+	dbentry->n_tuples_updated += counts->t_tuples_updated;
+	dbentry->n_tuples_deleted += counts->t_tuples_deleted;
+	dbentry->n_blocks_fetched += counts->t_blocks_fetched;
+	dbentry->n_blocks_hit += counts->t_blocks_hit;
+}
+
 
 /* ----------
  * pgstat_recv_tabpurge() -
@@ -4798,6 +5257,12 @@ pgstat_recv_vacuum(PgStat_MsgVacuum *msg, int len)
 
 	tabentry = pgstat_get_tab_entry(dbentry, msg->m_tableoid, true);
 
+	pgstat_update_vacuum(tabentry, msg);
+}
+
+static void
+pgstat_update_vacuum(PgStat_StatTabEntry *tabentry, PgStat_MsgVacuum *msg)
+{
 	tabentry->n_live_tuples = msg->m_tuples;
 	/* Resetting dead_tuples to 0 is an approximation ... */
 	tabentry->n_dead_tuples = 0;
@@ -4833,6 +5298,12 @@ pgstat_recv_analyze(PgStat_MsgAnalyze *msg, int len)
 
 	tabentry = pgstat_get_tab_entry(dbentry, msg->m_tableoid, true);
 
+	pgstat_update_analyze(tabentry, msg);
+}
+
+static void
+pgstat_update_analyze(PgStat_StatTabEntry *tabentry, PgStat_MsgAnalyze *msg)
+{
 	tabentry->n_live_tuples = msg->m_live_tuples;
 	tabentry->n_dead_tuples = msg->m_dead_tuples;
 
@@ -4864,16 +5335,22 @@ pgstat_recv_analyze(PgStat_MsgAnalyze *msg, int len)
 static void
 pgstat_recv_bgwriter(PgStat_MsgBgWriter *msg, int len)
 {
-	globalStats.timed_checkpoints += msg->m_timed_checkpoints;
-	globalStats.requested_checkpoints += msg->m_requested_checkpoints;
-	globalStats.checkpoint_write_time += msg->m_checkpoint_write_time;
-	globalStats.checkpoint_sync_time += msg->m_checkpoint_sync_time;
-	globalStats.buf_written_checkpoints += msg->m_buf_written_checkpoints;
-	globalStats.buf_written_clean += msg->m_buf_written_clean;
-	globalStats.maxwritten_clean += msg->m_maxwritten_clean;
-	globalStats.buf_written_backend += msg->m_buf_written_backend;
-	globalStats.buf_fsync_backend += msg->m_buf_fsync_backend;
-	globalStats.buf_alloc += msg->m_buf_alloc;
+	pgstat_update_bgwriter(&globalStats, msg);
+}
+
+static void
+pgstat_update_bgwriter(PgStat_GlobalStats *stats, PgStat_MsgBgWriter *msg)
+{
+	stats->timed_checkpoints += msg->m_timed_checkpoints;
+	stats->requested_checkpoints += msg->m_requested_checkpoints;
+	stats->checkpoint_write_time += msg->m_checkpoint_write_time;
+	stats->checkpoint_sync_time += msg->m_checkpoint_sync_time;
+	stats->buf_written_checkpoints += msg->m_buf_written_checkpoints;
+	stats->buf_written_clean += msg->m_buf_written_clean;
+	stats->maxwritten_clean += msg->m_maxwritten_clean;
+	stats->buf_written_backend += msg->m_buf_written_backend;
+	stats->buf_fsync_backend += msg->m_buf_fsync_backend;
+	stats->buf_alloc += msg->m_buf_alloc;
 }
 
 /* ----------
@@ -4889,7 +5366,13 @@ pgstat_recv_recoveryconflict(PgStat_MsgRecoveryConflict *msg, int len)
 
 	dbentry = pgstat_get_db_entry(msg->m_databaseid, true);
 
-	switch (msg->m_reason)
+	pgstat_count_recovery_conflict(dbentry, msg->m_reason);
+}
+
+static void
+pgstat_count_recovery_conflict(PgStat_StatDBEntry *dbentry, int reason)
+{
+	switch (reason)
 	{
 		case PROCSIG_RECOVERY_CONFLICT_DATABASE:
 
@@ -4932,6 +5415,26 @@ pgstat_recv_deadlock(PgStat_MsgDeadlock *msg, int len)
 	dbentry->n_deadlocks++;
 }
 
+#ifdef ADB
+/* ----------
+ * pgstat_recv_latency() -
+ *
+ *	Process a LATENCY message.
+ * ----------
+ */
+static void
+pgstat_recv_latency(PgStat_MsgLatency *msg, int len)
+{
+	PgStat_StatDBEntry *dbentry;
+	int			i;
+
+	dbentry = pgstat_get_db_entry(msg->m_databaseid, true);
+
+	for (i = 0; i < LATENCY_HIST_BUCKETS; i++)
+		dbentry->n_latency_hist[i] += msg->m_counts[i];
+}
+#endif
+
 /* ----------
  * pgstat_recv_tempfile() -
  *
@@ -5067,3 +5570,1073 @@ pgstat_db_requested(Oid databaseid)
 
 	return false;
 }
+
+#ifdef ADB
+/* ------------------------------------------------------------
+ * Statistics in shared memory follow
+ * ------------------------------------------------------------
+ */
+
+/*
+ * PgStatShmemSize
+ *		Size of the shared memory the statistics need
+ */
+Size
+PgStatShmemSize(void)
+{
+	Size		size;
+
+	size = MAXALIGN(sizeof(PgStat_GlobalStats));
+	size = add_size(size, hash_estimate_size(PGSTAT_SHARED_DB_HASH_SIZE,
+											 sizeof(PgStat_StatDBEntry)));
+	size = add_size(size, hash_estimate_size(pgstat_max_tables,
+											 sizeof(PgStat_SharedTabEntry)));
+	size = add_size(size, hash_estimate_size(pgstat_max_functions,
+											 sizeof(PgStat_SharedFuncEntry)));
+
+	return size;
+}
+
+/*
+ * PgStatShmemInit
+ *		Create or attach to the shared memory of the statistics
+ *
+ * When the postmaster creates it, the statistics saved at the last shutdown
+ * are loaded back.
+ */
+void
+PgStatShmemInit(void)
+{
+	HASHCTL		info;
+	bool		found;
+
+	sharedGlobalStats = (PgStat_GlobalStats *)
+		ShmemInitStruct("Statistics Global Counters",
+						sizeof(PgStat_GlobalStats),
+						&found);
+
+	MemSet(&info, 0, sizeof(info));
+	info.keysize = sizeof(Oid);
+	info.entrysize = sizeof(PgStat_StatDBEntry);
+	info.hash = oid_hash;
+	sharedDBHash = ShmemInitHash("Statistics Database Hash",
+								 PGSTAT_SHARED_DB_HASH_SIZE,
+								 PGSTAT_SHARED_DB_HASH_SIZE,
+								 &info,
+								 HASH_ELEM | HASH_FUNCTION);
+
+	MemSet(&info, 0, sizeof(info));
+	info.keysize = sizeof(PgStat_SharedKey);
+	info.entrysize = sizeof(PgStat_SharedTabEntry);
+	info.hash = tag_hash;
+	info.num_partitions = NUM_PGSTAT_PARTITIONS;
+	sharedTabHash = ShmemInitHash("Statistics Table Hash",
+								  pgstat_max_tables,
+								  pgstat_max_tables,
+								  &info,
+								  HASH_ELEM | HASH_FUNCTION | HASH_PARTITION);
+
+	info.entrysize = sizeof(PgStat_SharedFuncEntry);
+	sharedFuncHash = ShmemInitHash("Statistics Function Hash",
+								   pgstat_max_functions,
+								   pgstat_max_functions,
+								   &info,
+								   HASH_ELEM | HASH_FUNCTION | HASH_PARTITION);
+
+	if (!found)
+	{
+		MemSet(sharedGlobalStats, 0, sizeof(PgStat_GlobalStats));
+		sharedGlobalStats->stat_reset_timestamp = GetCurrentTimestamp();
+
+		/* a standalone backend leaves the file to the next postmaster */
+		if (IsPostmasterEnvironment)
+			pgstat_read_shared_statsfile();
+	}
+}
+
+/* ----------
+ * pgstat_apply_message() -
+ *
+ *	Apply a statistics message to the shared hash tables, the way the
+ *	collector would to its own.
+ * ----------
+ */
+static void
+pgstat_apply_message(PgStat_Msg *msg)
+{
+	PgStat_StatDBEntry *dbentry;
+	int			i;
+
+	switch (msg->msg_hdr.m_type)
+	{
+		case PGSTAT_MTYPE_TABSTAT:
+			pgstat_shared_tabstat(&msg->msg_tabstat);
+			break;
+
+		case PGSTAT_MTYPE_TABPURGE:
+			pgstat_shared_purge(sharedTabHash,
+								msg->msg_tabpurge.m_databaseid,
+								msg->msg_tabpurge.m_tableid,
+								msg->msg_tabpurge.m_nentries);
+			break;
+
+		case PGSTAT_MTYPE_DROPDB:
+			pgstat_shared_dropdb(msg->msg_dropdb.m_databaseid, false);
+			break;
+
+		case PGSTAT_MTYPE_RESETCOUNTER:
+			pgstat_shared_dropdb(msg->msg_resetcounter.m_databaseid, true);
+			break;
+
+		case PGSTAT_MTYPE_RESETSHAREDCOUNTER:
+			if (msg->msg_resetsharedcounter.m_resettarget == RESET_BGWRITER)
+			{
+				TimestampTz now = GetCurrentTimestamp();
+
+				LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+				MemSet(sharedGlobalStats, 0, sizeof(PgStat_GlobalStats));
+				sharedGlobalStats->stat_reset_timestamp = now;
+				LWLockRelease(PgStatDBLock);
+			}
+			break;
+
+		case PGSTAT_MTYPE_RESETSINGLECOUNTER:
+			pgstat_shared_resetsinglecounter(&msg->msg_resetsinglecounter);
+			break;
+
+		case PGSTAT_MTYPE_AUTOVAC_START:
+			LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+			dbentry = pgstat_get_shared_db_entry(msg->msg_autovacuum.m_databaseid,
+												 true);
+			if (dbentry != NULL)
+				dbentry->last_autovac_time = msg->msg_autovacuum.m_start_time;
+			LWLockRelease(PgStatDBLock);
+			break;
+
+		case PGSTAT_MTYPE_VACUUM:
+			pgstat_shared_vacuum(&msg->msg_vacuum);
+			break;
+
+		case PGSTAT_MTYPE_ANALYZE:
+			pgstat_shared_analyze(&msg->msg_analyze);
+			break;
+
+		case PGSTAT_MTYPE_BGWRITER:
+			LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+			pgstat_update_bgwriter(sharedGlobalStats, &msg->msg_bgwriter);
+			LWLockRelease(PgStatDBLock);
+			break;
+
+		case PGSTAT_MTYPE_FUNCSTAT:
+			pgstat_shared_funcstat(&msg->msg_funcstat);
+			break;
+
+		case PGSTAT_MTYPE_FUNCPURGE:
+			pgstat_shared_purge(sharedFuncHash,
+								msg->msg_funcpurge.m_databaseid,
+								msg->msg_funcpurge.m_functionid,
+								msg->msg_funcpurge.m_nentries);
+			break;
+
+		case PGSTAT_MTYPE_RECOVERYCONFLICT:
+			LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+			dbentry = pgstat_get_shared_db_entry(msg->msg_recoveryconflict.m_databaseid,
+												 true);
+			if (dbentry != NULL)
+				pgstat_count_recovery_conflict(dbentry,
+											   msg->msg_recoveryconflict.m_reason);
+			LWLockRelease(PgStatDBLock);
+			break;
+
+		case PGSTAT_MTYPE_DEADLOCK:
+			LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+			dbentry = pgstat_get_shared_db_entry(msg->msg_deadlock.m_databaseid,
+												 true);
+			if (dbentry != NULL)
+				dbentry->n_deadlocks++;
+			LWLockRelease(PgStatDBLock);
+			break;
+
+		case PGSTAT_MTYPE_TEMPFILE:
+			{
+				PgStat_MsgTempFile *tmsg = (PgStat_MsgTempFile *) msg;
+
+				LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+				dbentry = pgstat_get_shared_db_entry(tmsg->m_databaseid, true);
+				if (dbentry != NULL)
+				{
+					dbentry->n_temp_bytes += tmsg->m_filesize;
+					dbentry->n_temp_files += 1;
+				}
+				LWLockRelease(PgStatDBLock);
+			}
+			break;
+
+		case PGSTAT_MTYPE_LATENCY:
+			LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+			dbentry = pgstat_get_shared_db_entry(msg->msg_latency.m_databaseid,
+												 true);
+			if (dbentry != NULL)
+			{
+				for (i = 0; i < LATENCY_HIST_BUCKETS; i++)
+					dbentry->n_latency_hist[i] += msg->msg_latency.m_counts[i];
+			}
+			LWLockRelease(PgStatDBLock);
+			break;
+
+		default:
+			/* nothing to do for the collector's pings and inquiries */
+			break;
+	}
+}
+
+/*
+ * Lookup the shared entry of a database, creating it if "create".  Caller
+ * must hold PgStatDBLock, exclusively to create.  Returns NULL if there is
+ * no entry, or no room left to create it.
+ */
+static PgStat_StatDBEntry *
+pgstat_get_shared_db_entry(Oid databaseid, bool create)
+{
+	PgStat_StatDBEntry *result;
+	HASHACTION	action = HASH_FIND;
+	bool		found;
+
+	if (create &&
+		hash_get_num_entries(sharedDBHash) < PGSTAT_SHARED_DB_HASH_SIZE)
+		action = HASH_ENTER_NULL;
+
+	result = (PgStat_StatDBEntry *) hash_search(sharedDBHash,
+												&databaseid,
+												action, &found);
+	if (result == NULL)
+	{
+		if (create && !sharedDBHashFull)
+		{
+			ereport(LOG,
+					(errmsg("no room left for the statistics of more databases")));
+			sharedDBHashFull = true;
+		}
+		return NULL;
+	}
+
+	if (!found)
+	{
+		pgstat_reset_db_counters(result);
+		result->tables = NULL;
+		result->functions = NULL;
+	}
+
+	return result;
+}
+
+/*
+ * Make sure the shared entry of a database exists, the way the collector
+ * creates it for any message about the database.
+ */
+static void
+pgstat_ensure_shared_db_entry(Oid databaseid)
+{
+	PgStat_StatDBEntry *dbentry;
+
+	LWLockAcquire(PgStatDBLock, LW_SHARED);
+	dbentry = pgstat_get_shared_db_entry(databaseid, false);
+	LWLockRelease(PgStatDBLock);
+
+	if (dbentry == NULL)
+	{
+		LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+		(void) pgstat_get_shared_db_entry(databaseid, true);
+		LWLockRelease(PgStatDBLock);
+	}
+}
+
+/*
+ * Lock the partition of the entry of object "objectid" of database
+ * "databaseid" in "hash" in "mode", and look the entry up with "action".
+ * The partition lock is returned in *lock, and the caller has to release
+ * it once done with the entry, found or not.
+ */
+static void *
+pgstat_get_shared_entry(HTAB *hash, Oid databaseid, Oid objectid,
+						HASHACTION action, LWLockMode mode, LWLockId *lock,
+						bool *found)
+{
+	PgStat_SharedKey key;
+	uint32		hashcode;
+
+	key.databaseid = databaseid;
+	key.objectid = objectid;
+	hashcode = get_hash_value(hash, &key);
+	*lock = PgStatHashPartitionLock(hashcode);
+
+	LWLockAcquire(*lock, mode);
+
+	return hash_search_with_hash_value(hash, &key, hashcode, action, found);
+}
+
+/*
+ * Lookup the shared entry of a table, creating it if "create".  The entry
+ * is locked as pgstat_get_shared_entry() does, exclusively to create.
+ *
+ * The number of entries is read without a lock to stop creating entries
+ * once the table is full, so a few more than stats_max_tables may get in
+ * the free space of the shared memory.
+ */
+static PgStat_StatTabEntry *
+pgstat_get_shared_tab_entry(Oid databaseid, Oid tableoid, bool create,
+							LWLockId *lock)
+{
+	PgStat_SharedTabEntry *entry;
+	HASHACTION	action = HASH_FIND;
+	bool		found;
+
+	if (create && hash_get_num_entries(sharedTabHash) < pgstat_max_tables)
+		action = HASH_ENTER_NULL;
+
+	entry = (PgStat_SharedTabEntry *)
+		pgstat_get_shared_entry(sharedTabHash, databaseid, tableoid, action,
+								create ? LW_EXCLUSIVE : LW_SHARED,
+								lock, &found);
+	if (entry == NULL)
+	{
+		if (create && !sharedTabHashFull)
+		{
+			ereport(LOG,
+					(errmsg("no room left for the statistics of more tables"),
+					 errhint("You might need to increase stats_max_tables.")));
+			sharedTabHashFull = true;
+		}
+		return NULL;
+	}
+
+	if (!found)
+	{
+		MemSet(&entry->tabentry, 0, sizeof(PgStat_StatTabEntry));
+		entry->tabentry.tableid = tableoid;
+	}
+
+	return &entry->tabentry;
+}
+
+/*
+ * Lookup the shared entry of a function, like pgstat_get_shared_tab_entry()
+ */
+static PgStat_StatFuncEntry *
+pgstat_get_shared_func_entry(Oid databaseid, Oid funcoid, bool create,
+							 LWLockId *lock)
+{
+	PgStat_SharedFuncEntry *entry;
+	HASHACTION	action = HASH_FIND;
+	bool		found;
+
+	if (create && hash_get_num_entries(sharedFuncHash) < pgstat_max_functions)
+		action = HASH_ENTER_NULL;
+
+	entry = (PgStat_SharedFuncEntry *)
+		pgstat_get_shared_entry(sharedFuncHash, databaseid, funcoid, action,
+								create ? LW_EXCLUSIVE : LW_SHARED,
+								lock, &found);
+	if (entry == NULL)
+	{
+		if (create && !sharedFuncHashFull)
+		{
+			ereport(LOG,
+					(errmsg("no room left for the statistics of more functions"),
+					 errhint("You might need to increase stats_max_functions.")));
+			sharedFuncHashFull = true;
+		}
+		return NULL;
+	}
+
+	if (!found)
+	{
+		MemSet(&entry->funcentry, 0, sizeof(PgStat_StatFuncEntry));
+		entry->funcentry.functionid = funcoid;
+	}
+
+	return &entry->funcentry;
+}
+
+/*
+ * Count what the backend has done, see pgstat_recv_tabstat()
+ */
+static void
+pgstat_shared_tabstat(PgStat_MsgTabstat *msg)
+{
+	PgStat_StatDBEntry *dbentry;
+	PgStat_StatTabEntry *tabentry;
+	LWLockId	lock;
+	int			i;
+
+	/*
+	 * Update database-wide stats, including the per-table ones, first: the
+	 * partition locks cannot be taken under PgStatDBLock.
+	 */
+	LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+	dbentry = pgstat_get_shared_db_entry(msg->m_databaseid, true);
+	if (dbentry != NULL)
+	{
+		dbentry->n_xact_commit += (PgStat_Counter) (msg->m_xact_commit);
+		dbentry->n_xact_rollback += (PgStat_Counter) (msg->m_xact_rollback);
+		dbentry->n_block_read_time += msg->m_block_read_time;
+		dbentry->n_block_write_time += msg->m_block_write_time;
+
+		for (i = 0; i < msg->m_nentries; i++)
+			pgstat_add_db_tab_counts(dbentry, &(msg->m_entry[i].t_counts));
+	}
+	LWLockRelease(PgStatDBLock);
+
+	/*
+	 * Process all table entries in the message.
+	 */
+	for (i = 0; i < msg->m_nentries; i++)
+	{
+		PgStat_TableEntry *tabmsg = &(msg->m_entry[i]);
+
+		tabentry = pgstat_get_shared_tab_entry(msg->m_databaseid,
+											   tabmsg->t_id, true, &lock);
+		if (tabentry != NULL)
+			pgstat_add_tab_counts(tabentry, &tabmsg->t_counts);
+		LWLockRelease(lock);
+	}
+}
+
+/*
+ * Remove the shared entries of the given objects of a database in "hash"
+ */
+static void
+pgstat_shared_purge(HTAB *hash, Oid databaseid, Oid *objectids, int nentries)
+{
+	LWLockId	lock;
+	int			i;
+
+	for (i = 0; i < nentries; i++)
+	{
+		/* Remove from hashtable if present; we don't care if it's not. */
+		(void) pgstat_get_shared_entry(hash, databaseid, objectids[i],
+									   HASH_REMOVE, LW_EXCLUSIVE, &lock, NULL);
+		LWLockRelease(lock);
+	}
+}
+
+/*
+ * Remove the shared entry of a database, or only reset its counters if
+ * "reset", and remove the entries of its tables and functions.
+ */
+static void
+pgstat_shared_dropdb(Oid databaseid, bool reset)
+{
+	PgStat_StatDBEntry *dbentry;
+
+	LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+	dbentry = pgstat_get_shared_db_entry(databaseid, false);
+	if (dbentry != NULL)
+	{
+		if (reset)
+			pgstat_reset_db_counters(dbentry);
+		else
+			(void) hash_search(sharedDBHash, &databaseid, HASH_REMOVE, NULL);
+	}
+	LWLockRelease(PgStatDBLock);
+
+	/* Nothing more to do if the database is not known */
+	if (dbentry != NULL)
+		pgstat_remove_shared_entries(false, databaseid);
+}
+
+/*
+ * Reset the statistics of a single object, see
+ * pgstat_recv_resetsinglecounter()
+ */
+static void
+pgstat_shared_resetsinglecounter(PgStat_MsgResetsinglecounter *msg)
+{
+	PgStat_StatDBEntry *dbentry;
+	TimestampTz now = GetCurrentTimestamp();
+	LWLockId	lock;
+
+	LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+	dbentry = pgstat_get_shared_db_entry(msg->m_databaseid, false);
+	/* Set the reset timestamp for the whole database */
+	if (dbentry != NULL)
+		dbentry->stat_reset_timestamp = now;
+	LWLockRelease(PgStatDBLock);
+
+	if (dbentry == NULL)
+		return;
+
+	/* Remove object if it exists, ignore it if not */
+	if (msg->m_resettype == RESET_TABLE)
+	{
+		(void) pgstat_get_shared_entry(sharedTabHash, msg->m_databaseid,
+									   msg->m_objectid, HASH_REMOVE,
+									   LW_EXCLUSIVE, &lock, NULL);
+		LWLockRelease(lock);
+	}
+	else if (msg->m_resettype == RESET_FUNCTION)
+	{
+		(void) pgstat_get_shared_entry(sharedFuncHash, msg->m_databaseid,
+									   msg->m_objectid, HASH_REMOVE,
+									   LW_EXCLUSIVE, &lock, NULL);
+		LWLockRelease(lock);
+	}
+}
+
+static void
+pgstat_shared_vacuum(PgStat_MsgVacuum *msg)
+{
+	PgStat_StatTabEntry *tabentry;
+	LWLockId	lock;
+
+	pgstat_ensure_shared_db_entry(msg->m_databaseid);
+
+	tabentry = pgstat_get_shared_tab_entry(msg->m_databaseid, msg->m_tableoid,
+										   true, &lock);
+	if (tabentry != NULL)
+		pgstat_update_vacuum(tabentry, msg);
+	LWLockRelease(lock);
+}
+
+static void
+pgstat_shared_analyze(PgStat_MsgAnalyze *msg)
+{
+	PgStat_StatTabEntry *tabentry;
+	LWLockId	lock;
+
+	pgstat_ensure_shared_db_entry(msg->m_databaseid);
+
+	tabentry = pgstat_get_shared_tab_entry(msg->m_databaseid, msg->m_tableoid,
+										   true, &lock);
+	if (tabentry != NULL)
+		pgstat_update_analyze(tabentry, msg);
+	LWLockRelease(lock);
+}
+
+static void
+pgstat_shared_funcstat(PgStat_MsgFuncstat *msg)
+{
+	PgStat_FunctionEntry *funcmsg = &(msg->m_entry[0]);
+	PgStat_StatFuncEntry *funcentry;
+	LWLockId	lock;
+	int			i;
+
+	pgstat_ensure_shared_db_entry(msg->m_databaseid);
+
+	for (i = 0; i < msg->m_nentries; i++, funcmsg++)
+	{
+		funcentry = pgstat_get_shared_func_entry(msg->m_databaseid,
+												 funcmsg->f_id, true, &lock);
+		if (funcentry != NULL)
+		{
+			funcentry->f_numcalls += funcmsg->f_numcalls;
+			funcentry->f_total_time += funcmsg->f_total_time;
+			funcentry->f_self_time += funcmsg->f_self_time;
+		}
+		LWLockRelease(lock);
+	}
+}
+
+/*
+ * Remove the shared entries of the tables and functions of a database, or
+ * of all the databases along with the database entries and the cluster
+ * wide counters if "alldbs".
+ */
+static void
+pgstat_remove_shared_entries(bool alldbs, Oid databaseid)
+{
+	HASH_SEQ_STATUS hstat;
+	PgStat_SharedKey *key;
+	int			i;
+
+	if (alldbs)
+	{
+		TimestampTz now = GetCurrentTimestamp();
+		Oid		   *dbid;
+
+		LWLockAcquire(PgStatDBLock, LW_EXCLUSIVE);
+		hash_seq_init(&hstat, sharedDBHash);
+		while ((dbid = (Oid *) hash_seq_search(&hstat)) != NULL)
+			(void) hash_search(sharedDBHash, dbid, HASH_REMOVE, NULL);
+		MemSet(sharedGlobalStats, 0, sizeof(PgStat_GlobalStats));
+		sharedGlobalStats->stat_reset_timestamp = now;
+		LWLockRelease(PgStatDBLock);
+	}
+
+	for (i = 0; i < NUM_PGSTAT_PARTITIONS; i++)
+		LWLockAcquire(FirstPgStatLock + i, LW_EXCLUSIVE);
+
+	hash_seq_init(&hstat, sharedTabHash);
+	while ((key = (PgStat_SharedKey *) hash_seq_search(&hstat)) != NULL)
+	{
+		if (alldbs || key->databaseid == databaseid)
+			(void) hash_search(sharedTabHash, key, HASH_REMOVE, NULL);
+	}
+
+	hash_seq_init(&hstat, sharedFuncHash);
+	while ((key = (PgStat_SharedKey *) hash_seq_search(&hstat)) != NULL)
+	{
+		if (alldbs || key->databaseid == databaseid)
+			(void) hash_search(sharedFuncHash, key, HASH_REMOVE, NULL);
+	}
+
+	for (i = NUM_PGSTAT_PARTITIONS; --i >= 0;)
+		LWLockRelease(FirstPgStatLock + i);
+}
+
+/*
+ * Copy the shared entries of all the databases, and those of the tables and
+ * functions of "databaseid", in hash tables laid out the way
+ * pgstat_read_statsfiles() builds them, in CurrentMemoryContext.
+ */
+static HTAB *
+pgstat_copy_shared_stats(Oid databaseid)
+{
+	HASHCTL		hash_ctl;
+	HTAB	   *dbhash;
+	HASH_SEQ_STATUS hstat;
+	PgStat_StatDBEntry *shared;
+	PgStat_StatDBEntry *dbentry;
+	PgStat_SharedTabEntry *tabentry;
+	PgStat_SharedFuncEntry *funcentry;
+	int			i;
+
+	memset(&hash_ctl, 0, sizeof(hash_ctl));
+	hash_ctl.keysize = sizeof(Oid);
+	hash_ctl.entrysize = sizeof(PgStat_StatDBEntry);
+	hash_ctl.hash = oid_hash;
+	hash_ctl.hcxt = CurrentMemoryContext;
+	dbhash = hash_create("Databases hash", PGSTAT_DB_HASH_SIZE, &hash_ctl,
+						 HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+
+	LWLockAcquire(PgStatDBLock, LW_SHARED);
+	hash_seq_init(&hstat, sharedDBHash);
+	while ((shared = (PgStat_StatDBEntry *) hash_seq_search(&hstat)) != NULL)
+	{
+		dbentry = (PgStat_StatDBEntry *) hash_search(dbhash,
+													 &shared->databaseid,
+													 HASH_ENTER, NULL);
+		memcpy(dbentry, shared, sizeof(PgStat_StatDBEntry));
+	}
+	LWLockRelease(PgStatDBLock);
+
+	dbentry = (PgStat_StatDBEntry *) hash_search(dbhash, &databaseid,
+												 HASH_FIND, NULL);
+	if (dbentry == NULL)
+		return dbhash;
+
+	hash_ctl.keysize = sizeof(Oid);
+	hash_ctl.entrysize = sizeof(PgStat_StatTabEntry);
+	dbentry->tables = hash_create("Per-database table",
+								  PGSTAT_TAB_HASH_SIZE,
+								  &hash_ctl,
+								  HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+
+	hash_ctl.entrysize = sizeof(PgStat_StatFuncEntry);
+	dbentry->functions = hash_create("Per-database function",
+									 PGSTAT_FUNCTION_HASH_SIZE,
+									 &hash_ctl,
+									 HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+
+	for (i = 0; i < NUM_PGSTAT_PARTITIONS; i++)
+		LWLockAcquire(FirstPgStatLock + i, LW_SHARED);
+
+	hash_seq_init(&hstat, sharedTabHash);
+	while ((tabentry = (PgStat_SharedTabEntry *) hash_seq_search(&hstat)) != NULL)
+	{
+		if (tabentry->key.databaseid != databaseid)
+			continue;
+		memcpy(hash_search(dbentry->tables, &tabentry->key.objectid,
+						   HASH_ENTER, NULL),
+			   &tabentry->tabentry, sizeof(PgStat_StatTabEntry));
+	}
+
+	hash_seq_init(&hstat, sharedFuncHash);
+	while ((funcentry = (PgStat_SharedFuncEntry *) hash_seq_search(&hstat)) != NULL)
+	{
+		if (funcentry->key.databaseid != databaseid)
+			continue;
+		memcpy(hash_search(dbentry->functions, &funcentry->key.objectid,
+						   HASH_ENTER, NULL),
+			   &funcentry->funcentry, sizeof(PgStat_StatFuncEntry));
+	}
+
+	for (i = NUM_PGSTAT_PARTITIONS; --i >= 0;)
+		LWLockRelease(FirstPgStatLock + i);
+
+	return dbhash;
+}
+
+/*
+ * Create the hash tables of the copies of the shared entries read in the
+ * current transaction, if not already done.
+ */
+static void
+pgstat_setup_local_hashes(void)
+{
+	HASHCTL		hash_ctl;
+
+	if (pgStatDBHash != NULL)
+		return;
+
+	pgstat_setup_memcxt();
+
+	memset(&hash_ctl, 0, sizeof(hash_ctl));
+	hash_ctl.keysize = sizeof(Oid);
+	hash_ctl.entrysize = sizeof(PgStat_StatDBEntry);
+	hash_ctl.hash = oid_hash;
+	hash_ctl.hcxt = pgStatLocalContext;
+	pgStatDBHash = hash_create("Databases hash", PGSTAT_DB_HASH_SIZE,
+							   &hash_ctl,
+							   HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+
+	hash_ctl.keysize = sizeof(PgStat_SharedKey);
+	hash_ctl.entrysize = sizeof(PgStat_SharedTabEntry);
+	hash_ctl.hash = tag_hash;
+	pgStatTabHash = hash_create("Tables hash", PGSTAT_TAB_HASH_SIZE,
+								&hash_ctl,
+								HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+
+	hash_ctl.entrysize = sizeof(PgStat_SharedFuncEntry);
+	pgStatFuncHash = hash_create("Functions hash", PGSTAT_FUNCTION_HASH_SIZE,
+								 &hash_ctl,
+								 HASH_ELEM | HASH_FUNCTION | HASH_CONTEXT);
+}
+
+/*
+ * Copy of the shared entry of a database in the current transaction, see
+ * pgstat_fetch_stat_dbentry().  The table and function hashes of the copy
+ * are not set, use pgstat_fetch_stat_tabentry_ext() to find its tables.
+ */
+static PgStat_StatDBEntry *
+pgstat_fetch_shared_dbentry(Oid dbid)
+{
+	PgStat_StatDBEntry *dbentry;
+	PgStat_StatDBEntry *shared;
+	PgStat_StatDBEntry copy;
+
+	if (pgstat_disabled())
+		return NULL;
+
+	pgstat_setup_local_hashes();
+
+	dbentry = (PgStat_StatDBEntry *) hash_search(pgStatDBHash, &dbid,
+												 HASH_FIND, NULL);
+	if (dbentry != NULL)
+		return dbentry;
+
+	LWLockAcquire(PgStatDBLock, LW_SHARED);
+	shared = pgstat_get_shared_db_entry(dbid, false);
+	if (shared != NULL)
+		memcpy(&copy, shared, sizeof(PgStat_StatDBEntry));
+	LWLockRelease(PgStatDBLock);
+
+	if (shared == NULL)
+		return NULL;
+
+	dbentry = (PgStat_StatDBEntry *) hash_search(pgStatDBHash, &dbid,
+												 HASH_ENTER, NULL);
+	memcpy(dbentry, &copy, sizeof(PgStat_StatDBEntry));
+
+	return dbentry;
+}
+
+/*
+ * Copy of the shared entry of a function in the current transaction, see
+ * pgstat_fetch_stat_funcentry()
+ */
+static PgStat_StatFuncEntry *
+pgstat_fetch_shared_funcentry(Oid dbid, Oid funcid)
+{
+	PgStat_SharedKey key;
+	PgStat_SharedFuncEntry *entry;
+	PgStat_StatFuncEntry *shared;
+	PgStat_StatFuncEntry copy;
+	LWLockId	lock;
+
+	if (pgstat_disabled())
+		return NULL;
+
+	pgstat_setup_local_hashes();
+
+	key.databaseid = dbid;
+	key.objectid = funcid;
+	entry = (PgStat_SharedFuncEntry *) hash_search(pgStatFuncHash, &key,
+												   HASH_FIND, NULL);
+	if (entry != NULL)
+		return &entry->funcentry;
+
+	shared = pgstat_get_shared_func_entry(dbid, funcid, false, &lock);
+	if (shared != NULL)
+		memcpy(&copy, shared, sizeof(PgStat_StatFuncEntry));
+	LWLockRelease(lock);
+
+	if (shared == NULL)
+		return NULL;
+
+	entry = (PgStat_SharedFuncEntry *) hash_search(pgStatFuncHash, &key,
+												   HASH_ENTER, NULL);
+	memcpy(&entry->funcentry, &copy, sizeof(PgStat_StatFuncEntry));
+
+	return &entry->funcentry;
+}
+
+/* ----------
+ * pgstat_write_shared_statsfile() -
+ *
+ *	Write the shared statistics to the permanent stats file for the next
+ *	postmaster to load, in one file: the global stats, then a 'D' record
+ *	per database, a 'T' record per table and an 'F' record per function,
+ *	the two last ones starting with the OID of their database.  Called by
+ *	the checkpointer at shutdown.
+ * ----------
+ */
+void
+pgstat_write_shared_statsfile(void)
+{
+	HASH_SEQ_STATUS hstat;
+	PgStat_StatDBEntry *dbentry;
+	PgStat_SharedTabEntry *tabentry;
+	PgStat_SharedFuncEntry *funcentry;
+	PgStat_GlobalStats stats;
+	FILE	   *fpout;
+	int32		format_id;
+	const char *tmpfile = PGSTAT_STAT_PERMANENT_TMPFILE;
+	const char *statfile = PGSTAT_STAT_PERMANENT_FILENAME;
+	int			rc;
+	int			i;
+
+	if (pgstat_disabled())
+		return;
+
+	elog(DEBUG2, "writing stats file \"%s\"", statfile);
+
+	/*
+	 * Open the statistics temp file to write out the current values.
+	 */
+	fpout = AllocateFile(tmpfile, PG_BINARY_W);
+	if (fpout == NULL)
+	{
+		ereport(LOG,
+				(errcode_for_file_access(),
+				 errmsg("could not open temporary statistics file \"%s\": %m",
+						tmpfile)));
+		return;
+	}
+
+	/*
+	 * Write the file header --- currently just a format ID.
+	 */
+	format_id = PGSTAT_FILE_FORMAT_ID;
+	rc = fwrite(&format_id, sizeof(format_id), 1, fpout);
+	(void) rc;					/* we'll check for error with ferror */
+
+	/*
+	 * Write global stats struct, then the database entries.  We don't write
+	 * the tables or functions pointers, which are not used in shared memory.
+	 */
+	LWLockAcquire(PgStatDBLock, LW_SHARED);
+
+	memcpy(&stats, sharedGlobalStats, sizeof(PgStat_GlobalStats));
+	stats.stats_timestamp = GetCurrentTimestamp();
+	rc = fwrite(&stats, sizeof(stats), 1, fpout);
+	(void) rc;					/* we'll check for error with ferror */
+
+	hash_seq_init(&hstat, sharedDBHash);
+	while ((dbentry = (PgStat_StatDBEntry *) hash_seq_search(&hstat)) != NULL)
+	{
+		fputc('D', fpout);
+		rc = fwrite(dbentry, offsetof(PgStat_StatDBEntry, tables), 1, fpout);
+		(void) rc;				/* we'll check for error with ferror */
+	}
+
+	LWLockRelease(PgStatDBLock);
+
+	for (i = 0; i < NUM_PGSTAT_PARTITIONS; i++)
+		LWLockAcquire(FirstPgStatLock + i, LW_SHARED);
+
+	hash_seq_init(&hstat, sharedTabHash);
+	while ((tabentry = (PgStat_SharedTabEntry *) hash_seq_search(&hstat)) != NULL)
+	{
+		fputc('T', fpout);
+		rc = fwrite(&tabentry->key.databaseid, sizeof(Oid), 1, fpout);
+		rc = fwrite(&tabentry->tabentry, sizeof(PgStat_StatTabEntry), 1, fpout);
+		(void) rc;				/* we'll check for error with ferror */
+	}
+
+	hash_seq_init(&hstat, sharedFuncHash);
+	while ((funcentry = (PgStat_SharedFuncEntry *) hash_seq_search(&hstat)) != NULL)
+	{
+		fputc('F', fpout);
+		rc = fwrite(&funcentry->key.databaseid, sizeof(Oid), 1, fpout);
+		rc = fwrite(&funcentry->funcentry, sizeof(PgStat_StatFuncEntry), 1, fpout);
+		(void) rc;				/* we'll check for error with ferror */
+	}
+
+	for (i = NUM_PGSTAT_PARTITIONS; --i >= 0;)
+		LWLockRelease(FirstPgStatLock + i);
+
+	/*
+	 * No more output to be done. Close the temp file and replace the old
+	 * file with it.  The ferror() check replaces testing for error after
+	 * each individual fputc or fwrite above.
+	 */
+	fputc('E', fpout);
+
+	if (ferror(fpout))
+	{
+		ereport(LOG,
+				(errcode_for_file_access(),
+			   errmsg("could not write temporary statistics file \"%s\": %m",
+					  tmpfile)));
+		FreeFile(fpout);
+		unlink(tmpfile);
+	}
+	else if (FreeFile(fpout) < 0)
+	{
+		ereport(LOG,
+				(errcode_for_file_access(),
+			   errmsg("could not close temporary statistics file \"%s\": %m",
+					  tmpfile)));
+		unlink(tmpfile);
+	}
+	else if (rename(tmpfile, statfile) < 0)
+	{
+		ereport(LOG,
+				(errcode_for_file_access(),
+				 errmsg("could not rename temporary statistics file \"%s\" to \"%s\": %m",
+						tmpfile, statfile)));
+		unlink(tmpfile);
+	}
+}
+
+/* ----------
+ * pgstat_read_shared_statsfile() -
+ *
+ *	Load the permanent stats file written by pgstat_write_shared_statsfile()
+ *	into the shared hash tables, which nobody uses yet, then remove it so
+ *	that the statistics are not used again after a crash.  Entries beyond
+ *	the sizes of the tables, if they were made smaller, are left out.
+ * ----------
+ */
+static void
+pgstat_read_shared_statsfile(void)
+{
+	PgStat_GlobalStats stats;
+	PgStat_StatDBEntry dbbuf;
+	PgStat_StatTabEntry tabbuf;
+	PgStat_StatFuncEntry funcbuf;
+	PgStat_StatDBEntry *dbentry;
+	PgStat_SharedTabEntry *tabentry;
+	PgStat_SharedFuncEntry *funcentry;
+	PgStat_SharedKey key;
+	FILE	   *fpin;
+	int32		format_id;
+	bool		found;
+	const char *statfile = PGSTAT_STAT_PERMANENT_FILENAME;
+
+	/*
+	 * Try to open the stats file.  ENOENT just means there was nothing to
+	 * save, or the server did not shut down cleanly.
+	 */
+	if ((fpin = AllocateFile(statfile, PG_BINARY_R)) == NULL)
+	{
+		if (errno != ENOENT)
+			ereport(LOG,
+					(errcode_for_file_access(),
+					 errmsg("could not open statistics file \"%s\": %m",
+							statfile)));
+		return;
+	}
+
+	/*
+	 * Verify it's of the expected format, and read the global stats struct.
+	 */
+	if (fread(&format_id, 1, sizeof(format_id), fpin) != sizeof(format_id) ||
+		format_id != PGSTAT_FILE_FORMAT_ID ||
+		fread(&stats, 1, sizeof(stats), fpin) != sizeof(stats))
+		goto corrupted;
+
+	memcpy(sharedGlobalStats, &stats, sizeof(PgStat_GlobalStats));
+
+	for (;;)
+	{
+		switch (fgetc(fpin))
+		{
+			case 'D':
+				if (fread(&dbbuf, 1, offsetof(PgStat_StatDBEntry, tables),
+						  fpin) != offsetof(PgStat_StatDBEntry, tables))
+					goto corrupted;
+
+				dbentry = NULL;
+				if (hash_get_num_entries(sharedDBHash) < PGSTAT_SHARED_DB_HASH_SIZE)
+					dbentry = (PgStat_StatDBEntry *)
+						hash_search(sharedDBHash, &dbbuf.databaseid,
+									HASH_ENTER_NULL, &found);
+				if (dbentry == NULL)
+					break;
+				if (found)
+					goto corrupted;
+
+				memcpy(dbentry, &dbbuf, offsetof(PgStat_StatDBEntry, tables));
+				dbentry->tables = NULL;
+				dbentry->functions = NULL;
+				break;
+
+			case 'T':
+				if (fread(&key.databaseid, 1, sizeof(Oid), fpin) != sizeof(Oid) ||
+					fread(&tabbuf, 1, sizeof(tabbuf), fpin) != sizeof(tabbuf))
+					goto corrupted;
+
+				key.objectid = tabbuf.tableid;
+				tabentry = NULL;
+				if (hash_get_num_entries(sharedTabHash) < pgstat_max_tables)
+					tabentry = (PgStat_SharedTabEntry *)
+						hash_search(sharedTabHash, &key,
+									HASH_ENTER_NULL, &found);
+				if (tabentry == NULL)
+					break;
+				if (found)
+					goto corrupted;
+
+				memcpy(&tabentry->tabentry, &tabbuf, sizeof(tabbuf));
+				break;
+
+			case 'F':
+				if (fread(&key.databaseid, 1, sizeof(Oid), fpin) != sizeof(Oid) ||
+					fread(&funcbuf, 1, sizeof(funcbuf), fpin) != sizeof(funcbuf))
+					goto corrupted;
+
+				key.objectid = funcbuf.functionid;
+				funcentry = NULL;
+				if (hash_get_num_entries(sharedFuncHash) < pgstat_max_functions)
+					funcentry = (PgStat_SharedFuncEntry *)
+						hash_search(sharedFuncHash, &key,
+									HASH_ENTER_NULL, &found);
+				if (funcentry == NULL)
+					break;
+				if (found)
+					goto corrupted;
+
+				memcpy(&funcentry->funcentry, &funcbuf, sizeof(funcbuf));
+				break;
+
+			case 'E':
+				goto done;
+
+			default:
+				goto corrupted;
+		}
+	}
+
+corrupted:
+	ereport(LOG,
+			(errmsg("corrupted statistics file \"%s\"", statfile)));
+
+done:
+	FreeFile(fpin);
+
+	elog(DEBUG2, "removing permanent stats file \"%s\"", statfile);
+	unlink(statfile);
+}
+#endif   /* ADB */
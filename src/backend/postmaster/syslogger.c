@@ -11,6 +11,11 @@
  * The logfiles are stored in a subdirectory (configurable in
  * postgresql.conf), using a user-selectable naming scheme.
  *
+ * With log_ring_size set, processes having a PGPROC put their messages in
+ * a ring buffer of their own instead of the pipe, and the syslogger drains
+ * the rings.  A process never waits for the syslogger then: a message not
+ * fitting in its ring is dropped and counted.
+ *
  * Author: Andreas Pflug <pgadmin@pse-consulting.de>
  *
  * Copyright (c) 2004-2013, PostgreSQL Global Development Group
@@ -30,6 +35,9 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#ifndef EXEC_BACKEND
+#include <sys/mman.h>
+#endif
 
 #include "lib/stringinfo.h"
 #include "libpq/pqsignal.h"
@@ -41,8 +49,11 @@
 #include "postmaster/syslogger.h"
 #include "storage/ipc.h"
 #include "storage/latch.h"
+#include "storage/barrier.h"
 #include "storage/pg_shmem.h"
+#include "storage/proc.h"
 #include "utils/guc.h"
+#include "utils/memutils.h"
 #include "utils/ps_status.h"
 #include "utils/timestamp.h"
 
@@ -53,6 +64,9 @@
  */
 #define READ_BUF_SIZE (2 * PIPE_CHUNK_SIZE)
 
+/* How often the syslogger looks at the log rings, in msec */
+#define LOG_RING_POLL_MS	100
+
 
 /*
  * GUC parameters.  Logging_collector cannot be changed after postmaster
@@ -65,6 +79,7 @@ char	   *Log_directory = NULL;
 char	   *Log_filename = NULL;
 bool		Log_truncate_on_rotation = false;
 int			Log_file_mode = S_IRUSR | S_IWUSR;
+int			Log_ring_size = 0;
 
 /*
  * Globally visible state (used by elog.c)
@@ -86,6 +101,43 @@ static char *last_file_name = NULL;
 static char *last_csv_file_name = NULL;
 static Latch sysLoggerLatch;
 
+/*
+ * Log rings, one per PGPROC, indexed by pgprocno.  They are mapped by the
+ * postmaster before the first syslogger start and inherited by every child,
+ * so that they survive both syslogger restarts and shared memory
+ * reinitialization.  Only fork() can give them to children, so there are
+ * none in EXEC_BACKEND builds.
+ *
+ * head and tail count the bytes ever put in and taken out of the ring, the
+ * process alone advances head and the syslogger alone advances tail.  An
+ * entry is a LogRingEntry header followed by the message, possibly wrapping
+ * around the end of data.
+ */
+typedef struct LogRing
+{
+	volatile uint32 head;
+	volatile uint32 tail;
+	volatile uint32 dropped;	/* messages dropped for lack of room */
+	volatile int32 pid;			/* last process putting messages */
+	uint32		dropped_seen;	/* dropped, as last reported by syslogger */
+	char		data[FLEXIBLE_ARRAY_MEMBER];
+} LogRing;
+
+typedef struct LogRingEntry
+{
+	uint32		len;			/* message length */
+	int32		dest;			/* LOG_DESTINATION_STDERR or _CSVLOG */
+} LogRingEntry;
+
+static char *LogRings = NULL;
+static int	LogRingCount = 0;
+static uint32 LogRingDataSize = 0;	/* a power of 2 */
+static Size LogRingStride = 0;
+static bool in_log_ring_write = false;
+static char *log_ring_buffer = NULL;	/* syslogger's copy of one message */
+
+#define GetLogRing(i) ((LogRing *) (LogRings + (Size) (i) * LogRingStride))
+
 /*
  * Buffers for saving partial messages from different backends.
  *
@@ -145,6 +197,11 @@ static char *logfile_getname(pg_time_t timestamp, const char *suffix);
 static void set_next_rotation_time(void);
 static void sigHupHandler(SIGNAL_ARGS);
 static void sigUsr1Handler(SIGNAL_ARGS);
+#ifndef EXEC_BACKEND
+static void create_log_rings(void);
+static void log_ring_copy(LogRing *ring, uint32 pos, char *dest, uint32 len);
+#endif
+static void drain_log_rings(void);
 
 
 /*
@@ -313,6 +370,9 @@ SysLoggerMain(int argc, char *argv[])
 		/* Clear any already-pending wakeups */
 		ResetLatch(&sysLoggerLatch);
 
+		/* Write out what the processes put in their log rings */
+		drain_log_rings();
+
 		/*
 		 * Process any requests or signals received recently.
 		 */
@@ -433,6 +493,14 @@ SysLoggerMain(int argc, char *argv[])
 			cur_flags = 0;
 		}
 
+		/* Nobody wakes us up for the log rings, check them now and then */
+		if (LogRings != NULL &&
+			(cur_timeout < 0 || cur_timeout > LOG_RING_POLL_MS))
+		{
+			cur_timeout = LOG_RING_POLL_MS;
+			cur_flags = WL_TIMEOUT;
+		}
+
 		/*
 		 * Sleep until there's something to do
 		 */
@@ -498,6 +566,9 @@ SysLoggerMain(int argc, char *argv[])
 
 		if (pipe_eof_seen)
 		{
+			/* every other process is gone, take their last messages */
+			drain_log_rings();
+
 			/*
 			 * seeing this message on the real stderr is annoying - so we make
 			 * it DEBUG1 to suppress in normal use.
@@ -565,6 +636,12 @@ SysLogger_Start(void)
 	}
 #endif
 
+#ifndef EXEC_BACKEND
+	/* Likewise the log rings, extant processes keep writing into them */
+	if (LogRings == NULL && Log_ring_size > 0)
+		create_log_rings();
+#endif
+
 	/*
 	 * Create log directory if not present; ignore errors
 	 */
@@ -987,6 +1064,192 @@ flush_pipe_input(char *logbuffer, int *bytes_in_logbuffer)
  * --------------------------------
  */
 
+#ifndef EXEC_BACKEND
+/*
+ * Postmaster subroutine mapping the log rings, see LogRing.
+ */
+static void
+create_log_rings(void)
+{
+	uint32		datasize = 1;
+	Size		size;
+	int			i;
+
+	/* the ring size is rounded down to a power of 2 */
+	while (datasize <= (uint32) Log_ring_size * 1024 / 2)
+		datasize <<= 1;
+
+	LogRingCount = MaxBackends + NUM_AUXILIARY_PROCS;
+	LogRingStride = MAXALIGN(offsetof(LogRing, data) + datasize);
+	size = LogRingStride * LogRingCount;
+
+	LogRings = mmap(NULL, size, PROT_READ | PROT_WRITE,
+					MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (LogRings == MAP_FAILED)
+	{
+		/* not worth failing for, the pipe still works */
+		LogRings = NULL;
+		ereport(LOG,
+				(errmsg("could not map log rings of %lu bytes: %m",
+						(unsigned long) size)));
+		return;
+	}
+
+	LogRingDataSize = datasize;
+	for (i = 0; i < LogRingCount; i++)
+	{
+		LogRing    *ring = GetLogRing(i);
+
+		ring->head = ring->tail = 0;
+		ring->dropped = ring->dropped_seen = 0;
+		ring->pid = 0;
+	}
+}
+
+/*
+ * Copy len bytes of the ring data starting at pos, wrapping around its end.
+ */
+static void
+log_ring_copy(LogRing *ring, uint32 pos, char *dest, uint32 len)
+{
+	uint32		off = pos & (LogRingDataSize - 1);
+	uint32		first = Min(len, LogRingDataSize - off);
+
+	memcpy(dest, ring->data + off, first);
+	if (first < len)
+		memcpy(dest + first, ring->data, len - first);
+}
+#endif
+
+/*
+ * Put a log message in the log ring of this process, for write_pipe_chunks.
+ *
+ * Returns false if the message has to go through the pipe: there are no
+ * log rings, the process has none, or the message is too big for one.
+ * Otherwise the message is in the ring, or dropped if the ring is full;
+ * either way the caller is done with it.
+ */
+bool
+SysLoggerRingWrite(const char *data, int len, int dest)
+{
+#ifndef EXEC_BACKEND
+	LogRing    *ring;
+	LogRingEntry entry;
+	uint32		head;
+	uint32		need;
+	uint32		off;
+	uint32		first;
+
+	if (LogRings == NULL || MyProc == NULL ||
+		MyProc->pgprocno >= LogRingCount || in_log_ring_write)
+		return false;
+
+	need = sizeof(LogRingEntry) + len;
+	if (need > LogRingDataSize / 2)
+		return false;
+
+	/* a signal handler logging while we are at it goes through the pipe */
+	in_log_ring_write = true;
+
+	ring = GetLogRing(MyProc->pgprocno);
+	head = ring->head;
+	ring->pid = MyProcPid;
+	if (need > LogRingDataSize - (head - ring->tail))
+	{
+		ring->dropped++;
+		in_log_ring_write = false;
+		return true;
+	}
+
+	/* the syslogger is done reading what it released by moving tail */
+	pg_memory_barrier();
+
+	entry.len = len;
+	entry.dest = dest;
+	off = head & (LogRingDataSize - 1);
+	first = Min(sizeof(entry), LogRingDataSize - off);
+	memcpy(ring->data + off, &entry, first);
+	if (first < sizeof(entry))
+		memcpy(ring->data, (char *) &entry + first, sizeof(entry) - first);
+
+	off = (head + sizeof(entry)) & (LogRingDataSize - 1);
+	first = Min((uint32) len, LogRingDataSize - off);
+	memcpy(ring->data + off, data, first);
+	if (first < (uint32) len)
+		memcpy(ring->data, data + first, len - first);
+
+	/* the entry must be complete before the syslogger can see it */
+	pg_write_barrier();
+	ring->head = head + need;
+
+	in_log_ring_write = false;
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*
+ * Syslogger subroutine writing out the messages in the log rings, and
+ * telling how many got dropped.
+ */
+static void
+drain_log_rings(void)
+{
+#ifndef EXEC_BACKEND
+	int			i;
+
+	if (LogRings == NULL)
+		return;
+
+	if (log_ring_buffer == NULL)
+		log_ring_buffer = MemoryContextAlloc(TopMemoryContext,
+											 LogRingDataSize);
+
+	for (i = 0; i < LogRingCount; i++)
+	{
+		LogRing    *ring = GetLogRing(i);
+		uint32		tail = ring->tail;
+		uint32		head = ring->head;
+		uint32		dropped;
+
+		/* read the entries only once we have seen head */
+		pg_read_barrier();
+
+		while (tail != head)
+		{
+			LogRingEntry entry;
+
+			log_ring_copy(ring, tail, (char *) &entry, sizeof(entry));
+			if (entry.len > LogRingDataSize / 2 ||
+				sizeof(entry) + entry.len > head - tail)
+			{
+				/* can't happen, unless the ring got scribbled on */
+				tail = head;
+				break;
+			}
+			log_ring_copy(ring, tail + sizeof(entry), log_ring_buffer,
+						  entry.len);
+			write_syslogger_file(log_ring_buffer, entry.len, entry.dest);
+			tail += sizeof(entry) + entry.len;
+		}
+
+		/* done reading, the process may reuse the room */
+		pg_memory_barrier();
+		ring->tail = tail;
+
+		dropped = ring->dropped;
+		if (dropped != ring->dropped_seen)
+		{
+			ereport(LOG,
+					(errmsg("%u log messages of process %d were dropped because its log ring was full",
+							dropped - ring->dropped_seen, (int) ring->pid)));
+			ring->dropped_seen = dropped;
+		}
+	}
+#endif
+}
+
 /*
  * Write text to the currently open logfile
  *
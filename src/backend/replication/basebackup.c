@@ -16,6 +16,9 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <time.h>
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
 
 #include "access/xlog_internal.h"		/* for pg_start/stop_backup */
 #include "catalog/pg_type.h"
@@ -26,8 +29,10 @@
 #include "miscadmin.h"
 #include "nodes/pg_list.h"
 #include "replication/basebackup.h"
+#include "replication/incrbackup.h"
 #include "replication/walsender.h"
 #include "replication/walsender_private.h"
+#include "storage/bufpage.h"
 #include "storage/fd.h"
 #include "storage/ipc.h"
 #include "utils/builtins.h"
@@ -43,6 +48,8 @@ typedef struct
 	bool		fastcheckpoint;
 	bool		nowait;
 	bool		includewal;
+	int			compresslevel;	/* 0 to send the tar streams as they are */
+	XLogRecPtr	incremental;	/* send the blocks changed since, if valid */
 } basebackup_options;
 
 
@@ -51,6 +58,9 @@ static int64 sendTablespace(char *path, bool sizeonly);
 static bool sendFile(char *readfilename, char *tarfilename,
 		 struct stat * statbuf, bool missing_ok);
 static void sendFileWithContent(const char *filename, const char *content);
+static bool sendIncrementalFile(char *readfilename, char *tarfilename,
+					struct stat * statbuf, bool missing_ok);
+static bool is_relation_segment(const char *path, const char *name);
 static void _tarWriteHeader(const char *filename, const char *linktarget,
 				struct stat * statbuf);
 static void send_int8_string(StringInfoData *buf, int64 intval);
@@ -60,15 +70,33 @@ static void perform_base_backup(basebackup_options *opt, DIR *tblspcdir);
 static void parse_basebackup_options(List *options, basebackup_options *opt);
 static void SendXlogRecPtrResult(XLogRecPtr ptr, TimeLineID tli);
 static int	compareWalFileNames(const void *a, const void *b);
+static void start_copy_data_compression(int level);
+static void end_copy_data_compression(void);
+static int	send_copy_data(const char *data, size_t len);
 
 /* Was the backup currently in-progress initiated in recovery mode? */
 static bool backup_started_in_recovery = false;
 
+/* Relation segments only have the blocks changed since this LSN, if valid */
+static XLogRecPtr incremental_lsn = InvalidXLogRecPtr;
+
 /*
  * Size of each block sent into the tar stream for larger files.
  */
 #define TAR_SEND_SIZE 32768
 
+#ifdef HAVE_LIBZ
+/*
+ * With the COMPRESS option, the CopyData messages of all the tar streams go
+ * through one deflate stream, flushed after each message so that the client
+ * inflates every message back into exactly the data it would have got.
+ */
+static bool copy_data_compressed = false;
+static z_stream copy_data_zstream;
+static char *copy_data_zbuf = NULL;
+static size_t copy_data_zbuf_size = 0;
+#endif
+
 typedef struct
 {
 	char	   *oid;
@@ -85,6 +113,7 @@ typedef struct
 static void
 base_backup_cleanup(int code, Datum arg)
 {
+	end_copy_data_compression();
 	do_pg_abort_backup();
 }
 
@@ -102,6 +131,7 @@ perform_base_backup(basebackup_options *opt, DIR *tblspcdir)
 	XLogRecPtr	endptr;
 	TimeLineID	endtli;
 	char	   *labelfile;
+	char	   *sentlabelfile;
 	int			datadirpathlen;
 
 	datadirpathlen = strlen(DataDir);
@@ -110,6 +140,7 @@ perform_base_backup(basebackup_options *opt, DIR *tblspcdir)
 
 	startptr = do_pg_start_backup(opt->label, opt->fastcheckpoint, &starttli,
 								  &labelfile);
+	incremental_lsn = opt->incremental;
 
 	PG_ENSURE_ERROR_CLEANUP(base_backup_cleanup, (Datum) 0);
 	{
@@ -118,6 +149,28 @@ perform_base_backup(basebackup_options *opt, DIR *tblspcdir)
 		struct dirent *de;
 		tablespaceinfo *ti;
 
+		if (!XLogRecPtrIsInvalid(incremental_lsn))
+		{
+			StringInfoData label;
+
+			if (incremental_lsn > startptr)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+						 errmsg("incremental backup location %X/%X is after the start of this backup",
+								(uint32) (incremental_lsn >> 32),
+								(uint32) incremental_lsn)));
+
+			/* tell pg_combinebackup what the backup is based on */
+			initStringInfo(&label);
+			appendStringInfo(&label, "%s%s%X/%X\n", labelfile,
+							 INCREMENTAL_LABEL_LINE,
+							 (uint32) (incremental_lsn >> 32),
+							 (uint32) incremental_lsn);
+			sentlabelfile = label.data;
+		}
+		else
+			sentlabelfile = labelfile;
+
 		SendXlogRecPtrResult(startptr, starttli);
 
 		/* Collect information about all tablespaces */
@@ -189,6 +242,8 @@ perform_base_backup(basebackup_options *opt, DIR *tblspcdir)
 		/* Send tablespace header */
 		SendBackupHeader(tablespaces);
 
+		start_copy_data_compression(opt->compresslevel);
+
 		/* Send off our tablespaces one by one */
 		foreach(lc, tablespaces)
 		{
@@ -206,7 +261,7 @@ perform_base_backup(basebackup_options *opt, DIR *tblspcdir)
 				struct stat statbuf;
 
 				/* In the main tar, include the backup_label first... */
-				sendFileWithContent(BACKUP_LABEL_FILE, labelfile);
+				sendFileWithContent(BACKUP_LABEL_FILE, sentlabelfile);
 
 				/* ... then the bulk of the files ... */
 				sendDir(".", 1, false, tablespaces);
@@ -412,7 +467,7 @@ perform_base_backup(basebackup_options *opt, DIR *tblspcdir)
 			{
 				CheckXLogRemoved(segno, tli);
 				/* Send the chunk as a CopyData message */
-				if (pq_putmessage('d', buf, cnt))
+				if (send_copy_data(buf, cnt))
 					ereport(ERROR,
 							(errmsg("base backup could not send data, aborting backup")));
 
@@ -473,6 +528,7 @@ perform_base_backup(basebackup_options *opt, DIR *tblspcdir)
 		/* Send CopyDone message for the last tar file */
 		pq_putemptymessage('c');
 	}
+	end_copy_data_compression();
 	SendXlogRecPtrResult(endptr, endtli);
 }
 
@@ -501,6 +557,8 @@ parse_basebackup_options(List *options, basebackup_options *opt)
 	bool		o_fast = false;
 	bool		o_nowait = false;
 	bool		o_wal = false;
+	bool		o_compress = false;
+	bool		o_incremental = false;
 
 	MemSet(opt, 0, sizeof(*opt));
 	foreach(lopt, options)
@@ -552,6 +610,43 @@ parse_basebackup_options(List *options, basebackup_options *opt)
 			opt->includewal = true;
 			o_wal = true;
 		}
+		else if (strcmp(defel->defname, "compress") == 0)
+		{
+			if (o_compress)
+				ereport(ERROR,
+						(errcode(ERRCODE_SYNTAX_ERROR),
+						 errmsg("duplicate option \"%s\"", defel->defname)));
+			opt->compresslevel = intVal(defel->arg);
+			if (opt->compresslevel < 0 || opt->compresslevel > 9)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+						 errmsg("compression level %d is out of range",
+								opt->compresslevel)));
+#ifndef HAVE_LIBZ
+			if (opt->compresslevel != 0)
+				ereport(ERROR,
+						(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+						 errmsg("compression is not supported by this build")));
+#endif
+			o_compress = true;
+		}
+		else if (strcmp(defel->defname, "incremental") == 0)
+		{
+			uint32		hi,
+						lo;
+
+			if (o_incremental)
+				ereport(ERROR,
+						(errcode(ERRCODE_SYNTAX_ERROR),
+						 errmsg("duplicate option \"%s\"", defel->defname)));
+			if (sscanf(strVal(defel->arg), "%X/%X", &hi, &lo) != 2)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+						 errmsg("invalid incremental backup location \"%s\"",
+								strVal(defel->arg))));
+			opt->incremental = ((uint64) hi) << 32 | lo;
+			o_incremental = true;
+		}
 		else
 			elog(ERROR, "option \"%s\" not recognized",
 				 defel->defname);
@@ -760,7 +855,7 @@ sendFileWithContent(const char *filename, const char *content)
 
 	_tarWriteHeader(filename, NULL, &statbuf);
 	/* Send the contents as a CopyData message */
-	pq_putmessage('d', content, len);
+	send_copy_data(content, len);
 
 	/* Pad to 512 byte boundary, per tar format requirements */
 	pad = ((len + 511) & ~511) - len;
@@ -769,7 +864,7 @@ sendFileWithContent(const char *filename, const char *content)
 		char		buf[512];
 
 		MemSet(buf, 0, pad);
-		pq_putmessage('d', buf, pad);
+		send_copy_data(buf, pad);
 	}
 }
 
@@ -1020,8 +1115,16 @@ sendDir(char *path, int basepathlen, bool sizeonly, List *tablespaces)
 			bool		sent = false;
 
 			if (!sizeonly)
-				sent = sendFile(pathbuf, pathbuf + basepathlen + 1, &statbuf,
-								true);
+			{
+				if (!XLogRecPtrIsInvalid(incremental_lsn) &&
+					is_relation_segment(path, de->d_name))
+					sent = sendIncrementalFile(pathbuf,
+											   pathbuf + basepathlen + 1,
+											   &statbuf, true);
+				else
+					sent = sendFile(pathbuf, pathbuf + basepathlen + 1,
+									&statbuf, true);
+			}
 
 			if (sent || sizeonly)
 			{
@@ -1078,7 +1181,7 @@ sendFile(char *readfilename, char *tarfilename, struct stat * statbuf,
 	while ((cnt = fread(buf, 1, Min(sizeof(buf), statbuf->st_size - len), fp)) > 0)
 	{
 		/* Send the chunk as a CopyData message */
-		if (pq_putmessage('d', buf, cnt))
+		if (send_copy_data(buf, cnt))
 			ereport(ERROR,
 			   (errmsg("base backup could not send data, aborting backup")));
 
@@ -1102,7 +1205,7 @@ sendFile(char *readfilename, char *tarfilename, struct stat * statbuf,
 		while (len < statbuf->st_size)
 		{
 			cnt = Min(sizeof(buf), statbuf->st_size - len);
-			pq_putmessage('d', buf, cnt);
+			send_copy_data(buf, cnt);
 			len += cnt;
 		}
 	}
@@ -1112,14 +1215,170 @@ sendFile(char *readfilename, char *tarfilename, struct stat * statbuf,
 	if (pad > 0)
 	{
 		MemSet(buf, 0, pad);
-		pq_putmessage('d', buf, pad);
+		send_copy_data(buf, pad);
+	}
+
+	FreeFile(fp);
+
+	return true;
+}
+
+/*
+ * Like sendFile(), for a relation segment of an incremental backup: send
+ * it as "<tarfilename>.incr", with only the blocks changed since
+ * incremental_lsn.  The format is described in replication/incrbackup.h.
+ *
+ * New pages and the pages written without WAL have no LSN, they are always
+ * sent.  A page changed after we looked at it is fixed by the WAL replayed
+ * from the start of the backup, like any page of a base backup.
+ */
+static bool
+sendIncrementalFile(char *readfilename, char *tarfilename,
+					struct stat * statbuf, bool missing_ok)
+{
+	FILE	   *fp;
+	union
+	{
+		char		data[BLCKSZ];
+		double		force_align_d;
+	}			page;
+	IncrementalFileHeader hdr;
+	uint32	   *changed;
+	BlockNumber blkno;
+	struct stat incrstat;
+	char		incrfilename[MAXPGPATH];
+	pgoff_t		len;
+	size_t		pad;
+	uint32		i;
+
+	/* only whole blocks can be sent by blocks */
+	if (statbuf->st_size % BLCKSZ != 0)
+		return sendFile(readfilename, tarfilename, statbuf, missing_ok);
+
+	fp = AllocateFile(readfilename, "rb");
+	if (fp == NULL)
+	{
+		if (errno == ENOENT && missing_ok)
+			return false;
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not open file \"%s\": %m", readfilename)));
+	}
+
+	hdr.magic = INCREMENTAL_FILE_MAGIC;
+	hdr.nblocks = statbuf->st_size / BLCKSZ;
+	hdr.nchanged = 0;
+	changed = palloc(sizeof(uint32) * Max(hdr.nblocks, 1));
+
+	/* find the changed blocks */
+	for (blkno = 0; blkno < hdr.nblocks; blkno++)
+	{
+		XLogRecPtr	lsn;
+
+		if (fread(page.data, 1, BLCKSZ, fp) != BLCKSZ)
+		{
+			if (ferror(fp))
+				ereport(ERROR,
+						(errcode_for_file_access(),
+						 errmsg("could not read file \"%s\": %m",
+								readfilename)));
+
+			/* truncated meanwhile, WAL replay truncates it again */
+			hdr.nblocks = blkno;
+			break;
+		}
+
+		lsn = PageGetLSN((Page) page.data);
+		if (XLogRecPtrIsInvalid(lsn) || lsn >= incremental_lsn)
+			changed[hdr.nchanged++] = blkno;
+	}
+
+	len = sizeof(IncrementalFileHeader) +
+		(pgoff_t) hdr.nchanged * (sizeof(uint32) + BLCKSZ);
+
+	snprintf(incrfilename, sizeof(incrfilename), "%s%s",
+			 tarfilename, INCREMENTAL_FILE_SUFFIX);
+	incrstat = *statbuf;
+	incrstat.st_size = len;
+	_tarWriteHeader(incrfilename, NULL, &incrstat);
+
+	if (send_copy_data((char *) &hdr, sizeof(IncrementalFileHeader)) ||
+		(hdr.nchanged > 0 &&
+		 send_copy_data((char *) changed, sizeof(uint32) * hdr.nchanged)))
+		ereport(ERROR,
+				(errmsg("base backup could not send data, aborting backup")));
+
+	for (i = 0; i < hdr.nchanged; i++)
+	{
+		CHECK_FOR_INTERRUPTS();
+
+		if (fseeko(fp, (off_t) changed[i] * BLCKSZ, SEEK_SET) != 0 ||
+			fread(page.data, 1, BLCKSZ, fp) != BLCKSZ)
+		{
+			if (ferror(fp))
+				ereport(ERROR,
+						(errcode_for_file_access(),
+						 errmsg("could not read file \"%s\": %m",
+								readfilename)));
+			/* truncated meanwhile, like in sendFile() */
+			MemSet(page.data, 0, BLCKSZ);
+		}
+
+		if (send_copy_data(page.data, BLCKSZ))
+			ereport(ERROR,
+			   (errmsg("base backup could not send data, aborting backup")));
 	}
 
+	/* Pad to 512 byte boundary, per tar format requirements */
+	pad = ((len + 511) & ~511) - len;
+	if (pad > 0)
+	{
+		MemSet(page.data, 0, pad);
+		send_copy_data(page.data, pad);
+	}
+
+	pfree(changed);
 	FreeFile(fp);
 
 	return true;
 }
 
+/*
+ * Is the file "name" of directory "path" a segment of the main fork of a
+ * relation?  Those are named <relfilenode>[.<segment>], in global or in
+ * the directory of a database.  The other forks are not always WAL-logged
+ * with their LSN, so they are sent whole.
+ */
+static bool
+is_relation_segment(const char *path, const char *name)
+{
+	const char *p;
+	const char *dirname;
+
+	for (p = name; isdigit((unsigned char) *p); p++)
+		;
+	if (p == name)
+		return false;
+	if (*p == '.')
+	{
+		const char *segno = ++p;
+
+		for (; isdigit((unsigned char) *p); p++)
+			;
+		if (p == segno)
+			return false;
+	}
+	if (*p != '\0')
+		return false;
+
+	dirname = last_dir_separator(path);
+	dirname = dirname ? dirname + 1 : path;
+	if (strcmp(dirname, "global") == 0)
+		return true;
+	for (p = dirname; isdigit((unsigned char) *p); p++)
+		;
+	return p != dirname && *p == '\0';
+}
 
 static void
 _tarWriteHeader(const char *filename, const char *linktarget,
@@ -1131,5 +1390,95 @@ _tarWriteHeader(const char *filename, const char *linktarget,
 					statbuf->st_mode, statbuf->st_uid, statbuf->st_gid,
 					statbuf->st_mtime);
 
-	pq_putmessage('d', h, 512);
+	send_copy_data(h, 512);
+}
+
+/*
+ * Compress the CopyData messages sent from now on with zlib at "level", or
+ * send them as they are if it is 0.
+ */
+static void
+start_copy_data_compression(int level)
+{
+#ifdef HAVE_LIBZ
+	/*
+	 * An error while sending the WAL files, after base_backup_cleanup is no
+	 * longer armed, leaves the stream of the previous backup behind. Its
+	 * buffer went away with the memory of that command.
+	 */
+	if (copy_data_compressed)
+		deflateEnd(&copy_data_zstream);
+	copy_data_compressed = false;
+
+	if (level == 0)
+		return;
+
+	MemSet(&copy_data_zstream, 0, sizeof(copy_data_zstream));
+	if (deflateInit(&copy_data_zstream, level) != Z_OK)
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("could not initialize compression library: %s",
+						copy_data_zstream.msg ? copy_data_zstream.msg : "unknown error")));
+
+	/* room for a block of a file and the sync flush marker, see send_copy_data */
+	copy_data_zbuf_size = deflateBound(&copy_data_zstream, TAR_SEND_SIZE) + 16;
+	copy_data_zbuf = palloc(copy_data_zbuf_size);
+	copy_data_compressed = true;
+#else
+	Assert(level == 0);
+#endif
+}
+
+static void
+end_copy_data_compression(void)
+{
+#ifdef HAVE_LIBZ
+	if (!copy_data_compressed)
+		return;
+
+	deflateEnd(&copy_data_zstream);
+	pfree(copy_data_zbuf);
+	copy_data_zbuf = NULL;
+	copy_data_compressed = false;
+#endif
+}
+
+/*
+ * Send "data" as one CopyData message of the current tar stream, compressed
+ * if the client asked for it. Returns the result of pq_putmessage.
+ */
+static int
+send_copy_data(const char *data, size_t len)
+{
+#ifdef HAVE_LIBZ
+	/* clients never see empty messages, no need for a flush marker */
+	if (copy_data_compressed && len > 0)
+	{
+		size_t		bound;
+
+		/* the whole message must come out of one call to keep its boundary */
+		bound = deflateBound(&copy_data_zstream, len) + 16;
+		if (bound > copy_data_zbuf_size)
+		{
+			copy_data_zbuf = repalloc(copy_data_zbuf, bound);
+			copy_data_zbuf_size = bound;
+		}
+
+		copy_data_zstream.next_in = (Bytef *) data;
+		copy_data_zstream.avail_in = len;
+		copy_data_zstream.next_out = (Bytef *) copy_data_zbuf;
+		copy_data_zstream.avail_out = copy_data_zbuf_size;
+		if (deflate(&copy_data_zstream, Z_SYNC_FLUSH) != Z_OK ||
+			copy_data_zstream.avail_in != 0 ||
+			copy_data_zstream.avail_out == 0)
+			ereport(ERROR,
+					(errmsg("could not compress data: %s",
+							copy_data_zstream.msg ? copy_data_zstream.msg : "unknown error")));
+
+		return pq_putmessage('d', copy_data_zbuf,
+							 copy_data_zbuf_size - copy_data_zstream.avail_out);
+	}
+#endif
+
+	return pq_putmessage('d', data, len);
 }
@@ -174,13 +174,17 @@ libpqrcv_identify_system(TimeLineID *primary_tli)
 static bool
 libpqrcv_startstreaming(TimeLineID tli, XLogRecPtr startpoint)
 {
-	char		cmd[64];
+	char		cmd[80];
 	PGresult   *res;
 
 	/* Start streaming from the point requested by startup process */
 	snprintf(cmd, sizeof(cmd), "START_REPLICATION %X/%X TIMELINE %u",
 			 (uint32) (startpoint >> 32), (uint32) startpoint,
 			 tli);
+#ifdef ADB
+	if (wal_receiver_compression)
+		strlcat(cmd, " COMPRESS", sizeof(cmd));
+#endif
 	res = libpqrcv_PQexec(cmd);
 
 	if (PQresultStatus(res) == PGRES_COMMAND_OK)
@@ -78,6 +78,8 @@ Node *replication_parse_result;
 %token K_PROGRESS
 %token K_FAST
 %token K_NOWAIT
+%token K_COMPRESS
+%token K_INCREMENTAL
 %token K_WAL
 %token K_TIMELINE
 
@@ -86,6 +88,7 @@ Node *replication_parse_result;
 %type <list>	base_backup_opt_list
 %type <defelt>	base_backup_opt
 %type <uintval>	opt_timeline
+%type <boolval>	opt_compress
 %%
 
 firstcmd: command opt_semicolon
@@ -116,7 +119,8 @@ identify_system:
 			;
 
 /*
- * BASE_BACKUP [LABEL '<label>'] [PROGRESS] [FAST] [WAL] [NOWAIT]
+ * BASE_BACKUP [LABEL '<label>'] [PROGRESS] [FAST] [WAL] [NOWAIT] [COMPRESS %d]
+ *             [INCREMENTAL '<lsn>']
  */
 base_backup:
 			K_BASE_BACKUP base_backup_opt_list
@@ -156,19 +160,30 @@ base_backup_opt:
 				  $$ = makeDefElem("nowait",
 						   (Node *)makeInteger(TRUE));
 				}
+			| K_COMPRESS UCONST
+				{
+				  $$ = makeDefElem("compress",
+						   (Node *)makeInteger($2));
+				}
+			| K_INCREMENTAL SCONST
+				{
+				  $$ = makeDefElem("incremental",
+						   (Node *)makeString($2));
+				}
 			;
 
 /*
- * START_REPLICATION %X/%X [TIMELINE %d]
+ * START_REPLICATION %X/%X [TIMELINE %d] [COMPRESS]
  */
 start_replication:
-			K_START_REPLICATION RECPTR opt_timeline
+			K_START_REPLICATION RECPTR opt_timeline opt_compress
 				{
 					StartReplicationCmd *cmd;
 
 					cmd = makeNode(StartReplicationCmd);
 					cmd->startpoint = $2;
 					cmd->timeline = $3;
+					cmd->compress = $4;
 
 					$$ = (Node *) cmd;
 				}
@@ -186,6 +201,11 @@ opt_timeline:
 				| /* nothing */			{ $$ = 0; }
 			;
 
+opt_compress:
+			K_COMPRESS						{ $$ = true; }
+				| /* nothing */			{ $$ = false; }
+			;
+
 /*
  * TIMELINE_HISTORY %d
  */
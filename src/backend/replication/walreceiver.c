@@ -58,6 +58,9 @@
 #include "storage/pmsignal.h"
 #include "storage/procarray.h"
 #include "utils/guc.h"
+#ifdef ADB
+#include "utils/pg_lz4.h"
+#endif
 #include "utils/ps_status.h"
 #include "utils/resowner.h"
 #include "utils/timestamp.h"
@@ -67,6 +70,9 @@
 int			wal_receiver_status_interval;
 int			wal_receiver_timeout;
 bool		hot_standby_feedback;
+#ifdef ADB
+bool		wal_receiver_compression;
+#endif
 
 /* libpqreceiver hooks to these when loaded */
 walrcv_connect_type walrcv_connect = NULL;
@@ -109,6 +115,9 @@ static struct
 
 static StringInfoData reply_message;
 static StringInfoData incoming_message;
+#ifdef ADB
+static StringInfoData decompressed_message;
+#endif
 
 /*
  * About SIGTERM handling:
@@ -375,6 +384,9 @@ WalReceiverMain(void)
 			LogstreamResult.Write = LogstreamResult.Flush = GetXLogReplayRecPtr(NULL);
 			initStringInfo(&reply_message);
 			initStringInfo(&incoming_message);
+#ifdef ADB
+			initStringInfo(&decompressed_message);
+#endif
 
 			/* Initialize the last recv timestamp */
 			last_recv_timestamp = GetCurrentTimestamp();
@@ -831,6 +843,46 @@ XLogWalRcvProcessMsg(unsigned char type, char *buf, Size len)
 				XLogWalRcvWrite(buf, len, dataStart);
 				break;
 			}
+#ifdef ADB
+		case 'z':				/* WAL records compressed by LZ4 */
+			{
+				int32		rawlen;
+
+				/* the header of 'w', then the uncompressed length */
+				hdrlen = sizeof(int64) + sizeof(int64) + sizeof(int64) +
+					sizeof(int32);
+				if (len <= hdrlen)
+					ereport(ERROR,
+							(errcode(ERRCODE_PROTOCOL_VIOLATION),
+							 errmsg_internal("invalid compressed WAL message received from primary")));
+				appendBinaryStringInfo(&incoming_message, buf, hdrlen);
+
+				/* read the fields */
+				dataStart = pq_getmsgint64(&incoming_message);
+				walEnd = pq_getmsgint64(&incoming_message);
+				sendTime = IntegerTimestampToTimestampTz(
+										  pq_getmsgint64(&incoming_message));
+				rawlen = pq_getmsgint(&incoming_message, 4);
+
+				buf += hdrlen;
+				len -= hdrlen;
+				resetStringInfo(&decompressed_message);
+				if (rawlen <= 0 || rawlen > XLogSegSize)
+					ereport(ERROR,
+							(errcode(ERRCODE_PROTOCOL_VIOLATION),
+							 errmsg_internal("invalid compressed WAL message received from primary")));
+				enlargeStringInfo(&decompressed_message, rawlen);
+				if (pg_lz4_decompress(buf, (int32) len, decompressed_message.data,
+									  rawlen) != rawlen)
+					ereport(ERROR,
+							(errcode(ERRCODE_PROTOCOL_VIOLATION),
+							 errmsg_internal("invalid compressed WAL message received from primary")));
+
+				ProcessWalSndrMessage(walEnd, sendTime);
+				XLogWalRcvWrite(decompressed_message.data, rawlen, dataStart);
+				break;
+			}
+#endif
 		case 'k':				/* Keepalive */
 			{
 				/* copy message to StringInfo */
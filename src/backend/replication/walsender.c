@@ -66,6 +66,9 @@
 #include "utils/builtins.h"
 #include "utils/guc.h"
 #include "utils/memutils.h"
+#ifdef ADB
+#include "utils/pg_lz4.h"
+#endif
 #include "utils/ps_status.h"
 #include "utils/resowner.h"
 #include "utils/timeout.h"
@@ -136,6 +139,15 @@ static StringInfoData output_message;
 static StringInfoData reply_message;
 static StringInfoData tmpbuf;
 
+#ifdef ADB
+/*
+ * Whether the standby asked for WAL data compressed by LZ4, and where the
+ * compressed data of a slice is built.
+ */
+static bool sendCompressed = false;
+static char *compressedSendBuf = NULL;
+#endif
+
 /*
  * Timestamp of the last receipt of the reply from the standby.
  */
@@ -502,6 +514,18 @@ StartReplication(StartReplicationCmd *cmd)
 
 	streamingDoneSending = streamingDoneReceiving = false;
 
+#ifdef ADB
+	sendCompressed = cmd->compress;
+	if (sendCompressed && compressedSendBuf == NULL)
+		compressedSendBuf = MemoryContextAlloc(TopMemoryContext,
+											   MAX_SEND_SIZE);
+#else
+	if (cmd->compress)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("compressed WAL streaming is not supported")));
+#endif
+
 	/* If there is nothing to stream, don't even enter COPY mode */
 	if (!sendTimeLineIsHistoric || cmd->startpoint < sendTimeLineValidUpto)
 	{
@@ -944,12 +968,30 @@ ProcessStandbyHSFeedbackMessage(void)
 	MyPgXact->xmin = feedbackXmin;
 }
 
+/*
+ * Events WalSndLoop waits for: our latch, postmaster death and the client
+ * socket, registered once for the life of the walsender.
+ */
+static WaitEventSet *WalSndWaitSet = NULL;
+static int	WalSndSocketPos = -1;
+
 /* Main loop of walsender process that streams the WAL over Copy messages. */
 static void
 WalSndLoop(void)
 {
 	bool		caughtup = false;
 
+	if (WalSndWaitSet == NULL)
+	{
+		WalSndWaitSet = CreateWaitEventSet(TopMemoryContext, 3);
+		AddWaitEventToSet(WalSndWaitSet, WL_LATCH_SET, PGINVALID_SOCKET,
+						  &MyWalSnd->latch, NULL);
+		AddWaitEventToSet(WalSndWaitSet, WL_POSTMASTER_DEATH,
+						  PGINVALID_SOCKET, NULL, NULL);
+		WalSndSocketPos = AddWaitEventToSet(WalSndWaitSet, WL_SOCKET_READABLE,
+											MyProcPort->sock, NULL, NULL);
+	}
+
 	/*
 	 * Allocate buffers that will be used for each outgoing and incoming
 	 * message.  We do this just once to reduce palloc overhead.
@@ -1099,13 +1141,14 @@ WalSndLoop(void)
 		{
 			TimestampTz timeout;
 			long		sleeptime = 10000;		/* 10 s */
-			int			wakeEvents;
+			uint32		sockEvents;
+			WaitSetEvent	event;
 
-			wakeEvents = WL_LATCH_SET | WL_POSTMASTER_DEATH | WL_TIMEOUT |
-				WL_SOCKET_READABLE;
+			sockEvents = WL_SOCKET_READABLE;
 
 			if (pq_is_send_pending())
-				wakeEvents |= WL_SOCKET_WRITEABLE;
+				sockEvents |= WL_SOCKET_WRITEABLE;
+			ModifyWaitEvent(WalSndWaitSet, WalSndSocketPos, sockEvents);
 
 			/*
 			 * If wal_sender_timeout is active, sleep in smaller increments
@@ -1118,8 +1161,7 @@ WalSndLoop(void)
 			/* Sleep until something happens or we time out */
 			ImmediateInterruptOK = true;
 			CHECK_FOR_INTERRUPTS();
-			WaitLatchOrSocket(&MyWalSnd->latch, wakeEvents,
-							  MyProcPort->sock, sleeptime);
+			(void) WaitEventSetWait(WalSndWaitSet, sleeptime, &event, 1);
 			ImmediateInterruptOK = false;
 
 			/*
@@ -1633,6 +1675,30 @@ XLogSend(bool *caughtup)
 	output_message.len += nbytes;
 	output_message.data[output_message.len] = '\0';
 
+#ifdef ADB
+	/*
+	 * Send the slice compressed if the standby asked for it and that makes
+	 * it smaller.  A 'z' message has the header of 'w', then the length of
+	 * the uncompressed data.
+	 */
+	if (sendCompressed)
+	{
+		int			hdrlen = 1 + sizeof(int64) + sizeof(int64) + sizeof(int64);
+		int32		clen;
+
+		clen = pg_lz4_compress(&output_message.data[hdrlen], (int32) nbytes,
+							   compressedSendBuf,
+							   (int32) nbytes - (int32) sizeof(int32) - 1);
+		if (clen > 0)
+		{
+			output_message.data[0] = 'z';
+			output_message.len = hdrlen;
+			pq_sendint(&output_message, (int) nbytes, 4);
+			pq_sendbytes(&output_message, compressedSendBuf, clen);
+		}
+	}
+#endif
+
 	/*
 	 * Fill the send timestamp last, so that it is taken as late as possible.
 	 */
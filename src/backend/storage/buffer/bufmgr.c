@@ -37,6 +37,7 @@
 #include "catalog/storage.h"
 #include "common/relpath.h"
 #include "executor/instrument.h"
+#include "lib/binaryheap.h"
 #include "miscadmin.h"
 #include "pg_trace.h"
 #include "pgstat.h"
@@ -79,6 +80,43 @@ bool		track_io_timing = false;
  */
 int			target_prefetch_pages = 0;
 
+/*
+ * Number of pages a checkpoint writes before it asks the kernel to start
+ * writing them back, so they don't pile up for the final fsync.  Zero
+ * disables that.
+ */
+int			checkpoint_flush_after = DEFAULT_CHECKPOINT_FLUSH_AFTER;
+
+/*
+ * Progress of the checkpoint in one tablespace, see BufferSync.
+ */
+typedef struct CkptTsStatus
+{
+	Oid			tsId;			/* tablespace oid */
+
+	/*
+	 * Checkpoint progress of this tablespace.  To make progress comparable
+	 * between tablespaces, it is measured in units of all the buffers being
+	 * written: each buffer written here advances it by progress_slice.
+	 */
+	float8		progress;
+	float8		progress_slice;
+
+	int			num_to_scan;	/* number of buffers to write */
+	int			num_scanned;	/* number of buffers written so far */
+
+	int			index;			/* current offset in CkptBufferIds */
+} CkptTsStatus;
+
+/*
+ * Buffer tags written out and not yet handed to the kernel for writeback.
+ */
+typedef struct WritebackContext
+{
+	int			nr_pending;
+	BufferTag	pending_tags[WRITEBACK_MAX_PENDING_FLUSHES];
+} WritebackContext;
+
 /* local state for StartBufferIO and related functions */
 static volatile BufferDesc *InProgressBuf = NULL;
 static bool IsForInput;
@@ -95,7 +133,11 @@ static bool PinBuffer(volatile BufferDesc *buf, BufferAccessStrategy strategy);
 static void PinBuffer_Locked(volatile BufferDesc *buf);
 static void UnpinBuffer(volatile BufferDesc *buf, bool fixOwner);
 static void BufferSync(int flags);
-static int	SyncOneBuffer(int buf_id, bool skip_recently_used);
+static int	SyncOneBuffer(int buf_id, bool skip_recently_used,
+			  WritebackContext *wb_context);
+static void ScheduleBufferTagForWriteback(WritebackContext *context,
+							  BufferTag *tag);
+static void IssuePendingWritebacks(WritebackContext *context);
 static void WaitIO(volatile BufferDesc *buf);
 static bool StartBufferIO(volatile BufferDesc *buf, bool forInput);
 static void TerminateBufferIO(volatile BufferDesc *buf, bool clear_dirty,
@@ -111,6 +153,9 @@ static volatile BufferDesc *BufferAlloc(SMgrRelation smgr,
 static void FlushBuffer(volatile BufferDesc *buf, SMgrRelation reln);
 static void AtProcExit_Buffers(int code, Datum arg);
 static int	rnode_comparator(const void *p1, const void *p2);
+static int	ckpt_buforder_comparator(const void *pa, const void *pb);
+static int	ts_ckpt_progress_comparator(Datum a, Datum b, void *arg);
+static int	buffertag_comparator(const void *a, const void *b);
 
 
 /*
@@ -639,15 +684,11 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	/* Loop here in case we have to try another victim buffer */
 	for (;;)
 	{
-		bool		lock_held;
-
 		/*
 		 * Select a victim buffer.  The buffer is returned with its header
-		 * spinlock still held!  Also (in most cases) the BufFreelistLock is
-		 * still held, since it would be bad to hold the spinlock while
-		 * possibly waking up other processes.
+		 * spinlock still held!
 		 */
-		buf = StrategyGetBuffer(strategy, &lock_held);
+		buf = StrategyGetBuffer(strategy);
 
 		Assert(buf->refcount == 0);
 
@@ -657,10 +698,6 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 		/* Pin the buffer and then release the buffer spinlock */
 		PinBuffer_Locked(buf);
 
-		/* Now it's safe to release the freelist lock */
-		if (lock_held)
-			LWLockRelease(BufFreelistLock);
-
 		/*
 		 * If the buffer was dirty, try to write it out.  There is a race
 		 * condition here, in that someone might dirty it after we released it
@@ -1249,9 +1286,15 @@ BufferSync(int flags)
 {
 	int			buf_id;
 	int			num_to_scan;
-	int			num_to_write;
+	int			num_spaces;
+	int			num_processed;
 	int			num_written;
+	CkptTsStatus *per_ts_stat = NULL;
+	Oid			last_tsid;
+	binaryheap *ts_heap;
+	int			i;
 	int			mask = BM_DIRTY;
+	WritebackContext wb_context;
 
 	/* Make sure we can handle the pin inside SyncOneBuffer */
 	ResourceOwnerEnlargeBuffers(CurrentResourceOwner);
@@ -1267,8 +1310,9 @@ BufferSync(int flags)
 
 	/*
 	 * Loop over all buffers, and mark the ones that need to be written with
-	 * BM_CHECKPOINT_NEEDED.  Count them as we go (num_to_write), so that we
-	 * can estimate how much work needs to be done.
+	 * BM_CHECKPOINT_NEEDED.  Count them as we go (num_to_scan), so that we
+	 * can estimate how much work needs to be done, and remember them in
+	 * CkptBufferIds to be sorted below.
 	 *
 	 * This allows us to write only those pages that were dirty when the
 	 * checkpoint began, and not those that get dirtied while it proceeds.
@@ -1281,7 +1325,7 @@ BufferSync(int flags)
 	 * BM_CHECKPOINT_NEEDED still set.  This is OK since any such buffer would
 	 * certainly need to be written for the next checkpoint attempt, too.
 	 */
-	num_to_write = 0;
+	num_to_scan = 0;
 	for (buf_id = 0; buf_id < NBuffers; buf_id++)
 	{
 		volatile BufferDesc *bufHdr = &BufferDescriptors[buf_id];
@@ -1294,32 +1338,108 @@ BufferSync(int flags)
 
 		if ((bufHdr->flags & mask) == mask)
 		{
+			CkptSortItem *item;
+
 			bufHdr->flags |= BM_CHECKPOINT_NEEDED;
-			num_to_write++;
+
+			item = &CkptBufferIds[num_to_scan++];
+			item->buf_id = buf_id;
+			item->tsId = bufHdr->tag.rnode.spcNode;
+			item->relNode = bufHdr->tag.rnode.relNode;
+			item->forkNum = bufHdr->tag.forkNum;
+			item->blockNum = bufHdr->tag.blockNum;
 		}
 
 		UnlockBufHdr(bufHdr);
 	}
 
-	if (num_to_write == 0)
+	if (num_to_scan == 0)
 		return;					/* nothing to do */
 
-	TRACE_POSTGRESQL_BUFFER_SYNC_START(NBuffers, num_to_write);
+	TRACE_POSTGRESQL_BUFFER_SYNC_START(NBuffers, num_to_scan);
 
 	/*
-	 * Loop over all buffers again, and write the ones (still) marked with
-	 * BM_CHECKPOINT_NEEDED.  In this loop, we start at the clock sweep point
-	 * since we might as well dump soon-to-be-recycled buffers first.
-	 *
-	 * Note that we don't read the buffer alloc count here --- that should be
-	 * left untouched till the next BgBufferSync() call.
+	 * Sort the buffers to write so that each file is written in block order,
+	 * which the kernel and the device can merge into large sequential
+	 * writes, instead of in the random order of buffer ids.  The sort puts
+	 * the tablespace first, which the balancing below relies on.
+	 */
+	qsort(CkptBufferIds, num_to_scan, sizeof(CkptSortItem),
+		  ckpt_buforder_comparator);
+
+	/*
+	 * Count the buffers of each tablespace; they are runs of adjacent
+	 * entries in the sorted array.  There are few tablespaces, so growing
+	 * the array one entry at a time is fine.
+	 */
+	num_spaces = 0;
+	last_tsid = InvalidOid;
+	for (i = 0; i < num_to_scan; i++)
+	{
+		CkptTsStatus *s;
+		Oid			cur_tsid = CkptBufferIds[i].tsId;
+
+		if (num_spaces == 0 || last_tsid != cur_tsid)
+		{
+			Size		sz = sizeof(CkptTsStatus) * (num_spaces + 1);
+
+			if (per_ts_stat == NULL)
+				per_ts_stat = (CkptTsStatus *) palloc(sz);
+			else
+				per_ts_stat = (CkptTsStatus *) repalloc(per_ts_stat, sz);
+
+			s = &per_ts_stat[num_spaces++];
+			memset(s, 0, sizeof(*s));
+			s->tsId = cur_tsid;
+			s->index = i;		/* its first buffer in CkptBufferIds */
+
+			last_tsid = cur_tsid;
+		}
+		else
+			s = &per_ts_stat[num_spaces - 1];
+
+		s->num_to_scan++;
+	}
+
+	Assert(num_spaces > 0);
+
+	/*
+	 * Build a min-heap over the write progress of the tablespaces, so that
+	 * the one lagging most behind is always written to next.  Otherwise the
+	 * sort would have us write to one tablespace after the other, leaving
+	 * the devices of all the others idle.
 	 */
-	buf_id = StrategySyncStart(NULL, NULL);
-	num_to_scan = NBuffers;
+	ts_heap = binaryheap_allocate(num_spaces,
+								  ts_ckpt_progress_comparator,
+								  NULL);
+
+	for (i = 0; i < num_spaces; i++)
+	{
+		CkptTsStatus *ts_stat = &per_ts_stat[i];
+
+		ts_stat->progress_slice = (float8) num_to_scan / ts_stat->num_to_scan;
+
+		binaryheap_add_unordered(ts_heap, PointerGetDatum(ts_stat));
+	}
+
+	binaryheap_build(ts_heap);
+
+	/*
+	 * Write the buffers that are (still) marked with BM_CHECKPOINT_NEEDED.
+	 */
+	wb_context.nr_pending = 0;
+	num_processed = 0;
 	num_written = 0;
-	while (num_to_scan-- > 0)
+	while (!binaryheap_empty(ts_heap))
 	{
-		volatile BufferDesc *bufHdr = &BufferDescriptors[buf_id];
+		CkptTsStatus *ts_stat = (CkptTsStatus *)
+		DatumGetPointer(binaryheap_first(ts_heap));
+		volatile BufferDesc *bufHdr;
+
+		buf_id = CkptBufferIds[ts_stat->index].buf_id;
+		bufHdr = &BufferDescriptors[buf_id];
+
+		num_processed++;
 
 		/*
 		 * We don't need to acquire the lock here, because we're only looking
@@ -1335,44 +1455,46 @@ BufferSync(int flags)
 		 */
 		if (bufHdr->flags & BM_CHECKPOINT_NEEDED)
 		{
-			if (SyncOneBuffer(buf_id, false) & BUF_WRITTEN)
+			if (SyncOneBuffer(buf_id, false, &wb_context) & BUF_WRITTEN)
 			{
 				TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(buf_id);
 				BgWriterStats.m_buf_written_checkpoints++;
 				num_written++;
-
-				/*
-				 * We know there are at most num_to_write buffers with
-				 * BM_CHECKPOINT_NEEDED set; so we can stop scanning if
-				 * num_written reaches num_to_write.
-				 *
-				 * Note that num_written doesn't include buffers written by
-				 * other backends, or by the bgwriter cleaning scan. That
-				 * means that the estimate of how much progress we've made is
-				 * conservative, and also that this test will often fail to
-				 * trigger.  But it seems worth making anyway.
-				 */
-				if (num_written >= num_to_write)
-					break;
-
-				/*
-				 * Sleep to throttle our I/O rate.
-				 */
-				CheckpointWriteDelay(flags, (double) num_written / num_to_write);
 			}
 		}
 
-		if (++buf_id >= NBuffers)
-			buf_id = 0;
+		/*
+		 * Count progress whether or not we had to write the buffer, else the
+		 * writes would become unbalanced.
+		 */
+		ts_stat->progress += ts_stat->progress_slice;
+		ts_stat->num_scanned++;
+		ts_stat->index++;
+
+		if (ts_stat->num_scanned == ts_stat->num_to_scan)
+			binaryheap_remove_first(ts_heap);
+		else
+			binaryheap_replace_first(ts_heap, PointerGetDatum(ts_stat));
+
+		/*
+		 * Sleep to throttle our I/O rate.
+		 */
+		CheckpointWriteDelay(flags, (double) num_processed / num_to_scan);
 	}
 
+	/* issue all pending flushes */
+	IssuePendingWritebacks(&wb_context);
+
+	pfree(per_ts_stat);
+	binaryheap_free(ts_heap);
+
 	/*
-	 * Update checkpoint statistics. As noted above, this doesn't include
-	 * buffers written by other backends or bgwriter scan.
+	 * Update checkpoint statistics.  This doesn't include buffers written by
+	 * other backends or bgwriter scan.
 	 */
 	CheckpointStats.ckpt_bufs_written += num_written;
 
-	TRACE_POSTGRESQL_BUFFER_SYNC_DONE(NBuffers, num_written, num_to_write);
+	TRACE_POSTGRESQL_BUFFER_SYNC_DONE(NBuffers, num_written, num_to_scan);
 }
 
 /*
@@ -1393,6 +1515,7 @@ BgBufferSync(void)
 	int			strategy_buf_id;
 	uint32		strategy_passes;
 	uint32		recent_alloc;
+	uint32		recent_free_alloc;
 
 	/*
 	 * Information saved between calls so we can determine the strategy
@@ -1404,6 +1527,9 @@ BgBufferSync(void)
 	static int	next_to_clean;
 	static uint32 next_passes;
 
+	/* Queued clean victims taken by backends since we last caught up */
+	static int	ready_taken;
+
 	/* Moving averages of allocation rate and clean-buffer density */
 	static float smoothed_alloc = 0;
 	static float smoothed_density = 10.0;
@@ -1434,7 +1560,8 @@ BgBufferSync(void)
 	 * Find out where the freelist clock sweep currently is, and how many
 	 * buffer allocations have happened since our last call.
 	 */
-	strategy_buf_id = StrategySyncStart(&strategy_passes, &recent_alloc);
+	strategy_buf_id = StrategySyncStart(&strategy_passes, &recent_alloc,
+										&recent_free_alloc);
 
 	/* Report buffer alloc counts to pgstat */
 	BgWriterStats.m_buf_alloc += recent_alloc;
@@ -1505,6 +1632,7 @@ BgBufferSync(void)
 			next_to_clean = strategy_buf_id;
 			next_passes = strategy_passes;
 			bufs_to_lap = NBuffers;
+			ready_taken = 0;
 		}
 	}
 	else
@@ -1521,6 +1649,7 @@ BgBufferSync(void)
 		next_to_clean = strategy_buf_id;
 		next_passes = strategy_passes;
 		bufs_to_lap = NBuffers;
+		ready_taken = 0;
 	}
 
 	/* Update saved info for next time */
@@ -1532,11 +1661,14 @@ BgBufferSync(void)
 	 * Compute how many buffers had to be scanned for each new allocation, ie,
 	 * 1/density of reusable buffers, and track a moving average of that.
 	 *
-	 * If the strategy point didn't move, we don't update the density estimate
+	 * If the strategy point didn't move, we don't update the density estimate.
+	 * Allocations served from the freelist did not move it, so they are left
+	 * out.
 	 */
-	if (strategy_delta > 0 && recent_alloc > 0)
+	if (strategy_delta > 0 && recent_alloc > recent_free_alloc)
 	{
-		scans_per_alloc = (float) strategy_delta / (float) recent_alloc;
+		scans_per_alloc = (float) strategy_delta /
+			(float) (recent_alloc - recent_free_alloc);
 		smoothed_density += (scans_per_alloc - smoothed_density) /
 			smoothing_samples;
 	}
@@ -1549,6 +1681,17 @@ BgBufferSync(void)
 	bufs_ahead = NBuffers - bufs_to_lap;
 	reusable_buffers_est = (float) bufs_ahead / smoothed_density;
 
+	/*
+	 * The buffers backends took from the freelist are mostly ones we queued
+	 * from that stretch, so they are not waiting there anymore.  The count
+	 * only shrinks when the strategy point catches up, which errs on the side
+	 * of queueing too many.
+	 */
+	ready_taken += (int) recent_free_alloc;
+	if (ready_taken > reusable_buffers_est)
+		ready_taken = reusable_buffers_est;
+	reusable_buffers_est -= ready_taken;
+
 	/*
 	 * Track a moving average of recent buffer allocations.  Here, rather than
 	 * a true average we want a fast-attack, slow-decline behavior: we
@@ -1599,7 +1742,9 @@ BgBufferSync(void)
 	 * Now write out dirty reusable buffers, working forward from the
 	 * next_to_clean point, until we have lapped the strategy scan, or cleaned
 	 * enough buffers to match our estimate of the next cycle's allocation
-	 * requirements, or hit the bgwriter_lru_maxpages limit.
+	 * requirements, or hit the bgwriter_lru_maxpages limit.  Every reusable
+	 * buffer is also queued on the freelist, so that backends find a clean
+	 * victim there instead of running the clock sweep themselves.
 	 */
 
 	/* Make sure we can handle the pin inside SyncOneBuffer */
@@ -1612,7 +1757,10 @@ BgBufferSync(void)
 	/* Execute the LRU scan */
 	while (num_to_scan > 0 && reusable_buffers < upcoming_alloc_est)
 	{
-		int			buffer_state = SyncOneBuffer(next_to_clean, true);
+		int			buffer_state = SyncOneBuffer(next_to_clean, true, NULL);
+
+		if (buffer_state & BUF_REUSABLE)
+			StrategyReadyBuffer(&BufferDescriptors[next_to_clean]);
 
 		if (++next_to_clean >= NBuffers)
 		{
@@ -1686,13 +1834,18 @@ BgBufferSync(void)
  * (BUF_WRITTEN could be set in error if FlushBuffers finds the buffer clean
  * after locking it, but we don't care all that much.)
  *
+ * If wb_context is not NULL, a written buffer is queued there for kernel
+ * writeback.
+ *
  * Note: caller must have done ResourceOwnerEnlargeBuffers.
  */
 static int
-SyncOneBuffer(int buf_id, bool skip_recently_used)
+SyncOneBuffer(int buf_id, bool skip_recently_used,
+			  WritebackContext *wb_context)
 {
 	volatile BufferDesc *bufHdr = &BufferDescriptors[buf_id];
 	int			result = 0;
+	BufferTag	tag;
 
 	/*
 	 * Check whether buffer needs writing.
@@ -1731,8 +1884,15 @@ SyncOneBuffer(int buf_id, bool skip_recently_used)
 	FlushBuffer(bufHdr, NULL);
 
 	LWLockRelease(bufHdr->content_lock);
+
+	/* the tag can't change while we hold the pin */
+	tag = bufHdr->tag;
+
 	UnpinBuffer(bufHdr, true);
 
+	if (wb_context != NULL)
+		ScheduleBufferTagForWriteback(wb_context, &tag);
+
 	return result | BUF_WRITTEN;
 }
 
@@ -3287,3 +3447,161 @@ rnode_comparator(const void *p1, const void *p2)
 	else
 		return 0;
 }
+
+/*
+ * Comparator determining the writeout order in a checkpoint.
+ *
+ * Tablespaces must be compared first, BufferSync relies on that to balance
+ * the writes between them.
+ */
+static int
+ckpt_buforder_comparator(const void *pa, const void *pb)
+{
+	const CkptSortItem *a = (const CkptSortItem *) pa;
+	const CkptSortItem *b = (const CkptSortItem *) pb;
+
+	if (a->tsId < b->tsId)
+		return -1;
+	else if (a->tsId > b->tsId)
+		return 1;
+
+	if (a->relNode < b->relNode)
+		return -1;
+	else if (a->relNode > b->relNode)
+		return 1;
+
+	if (a->forkNum < b->forkNum)
+		return -1;
+	else if (a->forkNum > b->forkNum)
+		return 1;
+
+	if (a->blockNum < b->blockNum)
+		return -1;
+	else if (a->blockNum > b->blockNum)
+		return 1;
+
+	/* equal page IDs are unlikely, but not impossible */
+	return 0;
+}
+
+/*
+ * Comparator for the min-heap over the tablespaces' checkpoint progress.
+ */
+static int
+ts_ckpt_progress_comparator(Datum a, Datum b, void *arg)
+{
+	CkptTsStatus *sa = (CkptTsStatus *) DatumGetPointer(a);
+	CkptTsStatus *sb = (CkptTsStatus *) DatumGetPointer(b);
+
+	/* binaryheap is a max-heap, so the least progress must compare highest */
+	if (sa->progress < sb->progress)
+		return 1;
+	else if (sa->progress == sb->progress)
+		return 0;
+	else
+		return -1;
+}
+
+/*
+ * BufferTag qsort comparator, orders by file and block number.
+ */
+static int
+buffertag_comparator(const void *a, const void *b)
+{
+	const BufferTag *ba = (const BufferTag *) a;
+	const BufferTag *bb = (const BufferTag *) b;
+	int			ret;
+
+	ret = rnode_comparator(&ba->rnode, &bb->rnode);
+	if (ret != 0)
+		return ret;
+
+	if (ba->forkNum < bb->forkNum)
+		return -1;
+	if (ba->forkNum > bb->forkNum)
+		return 1;
+
+	if (ba->blockNum < bb->blockNum)
+		return -1;
+	if (ba->blockNum > bb->blockNum)
+		return 1;
+
+	return 0;
+}
+
+/*
+ * ScheduleBufferTagForWriteback -- remember a written buffer for writeback
+ *
+ * Once checkpoint_flush_after of them have piled up, the kernel is asked
+ * to start writing them to storage.
+ */
+static void
+ScheduleBufferTagForWriteback(WritebackContext *context, BufferTag *tag)
+{
+	if (checkpoint_flush_after > 0)
+	{
+		Assert(context->nr_pending < WRITEBACK_MAX_PENDING_FLUSHES);
+		context->pending_tags[context->nr_pending++] = *tag;
+	}
+
+	/*
+	 * This also flushes what was added before, if the setting was turned
+	 * off since.
+	 */
+	if (context->nr_pending >= checkpoint_flush_after)
+		IssuePendingWritebacks(context);
+}
+
+/*
+ * IssuePendingWritebacks -- hand the pending writeback requests to the kernel
+ *
+ * The requests are sorted, and runs of consecutive blocks of one file are
+ * merged into a single request.  This is only a hint, so it never errors
+ * out.
+ */
+static void
+IssuePendingWritebacks(WritebackContext *context)
+{
+	int			i;
+
+	if (context->nr_pending == 0)
+		return;
+
+	qsort(context->pending_tags, context->nr_pending,
+		  sizeof(BufferTag), buffertag_comparator);
+
+	for (i = 0; i < context->nr_pending; i++)
+	{
+		BufferTag  *cur = &context->pending_tags[i];
+		BufferTag  *next;
+		SMgrRelation reln;
+		BlockNumber nblocks = 1;
+
+		/* extend the run while the following requests continue it */
+		while (i + 1 < context->nr_pending)
+		{
+			next = &context->pending_tags[i + 1];
+
+			if (!RelFileNodeEquals(cur->rnode, next->rnode) ||
+				cur->forkNum != next->forkNum)
+				break;
+
+			/* a block written twice only needs to be flushed once */
+			if (cur->blockNum != next->blockNum)
+			{
+				if (cur->blockNum + 1 != next->blockNum)
+					break;
+				nblocks++;
+			}
+
+			cur = next;
+			i++;
+		}
+
+		reln = smgropen(cur->rnode, InvalidBackendId);
+		smgrwriteback(reln, cur->forkNum, cur->blockNum - nblocks + 1,
+					  nblocks);
+	}
+
+	context->nr_pending = 0;
+}
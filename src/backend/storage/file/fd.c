@@ -64,7 +64,7 @@
 #include <unistd.h>
 #include <fcntl.h>
 #ifdef HAVE_SYS_RESOURCE_H
-#include <sys/resource.h>		/* for getrlimit */
+#include <sys/resource.h>		/* for getrlimit, setrlimit */
 #endif
 
 #include "miscadmin.h"
@@ -635,6 +635,25 @@ count_usable_fds(int max_to_probe, int *usable_fds, int *already_open)
 #endif   /* RLIMIT_NOFILE */
 	if (getrlimit_status != 0)
 		ereport(WARNING, (errmsg("getrlimit failed: %m")));
+#ifdef RLIMIT_NOFILE
+	else if (rlim.rlim_cur < (rlim_t) max_to_probe &&
+			 rlim.rlim_cur < rlim.rlim_max)
+	{
+		/*
+		 * The soft limit would keep us below max_files_per_process, which
+		 * makes the VFD cache close and reopen files all the time when there
+		 * are many relation segments.  Raise it as far as the hard limit
+		 * permits, but no higher than we use; child processes inherit it.
+		 */
+		struct rlimit newlim = rlim;
+
+		newlim.rlim_cur = Min(rlim.rlim_max, (rlim_t) max_to_probe);
+		if (setrlimit(RLIMIT_NOFILE, &newlim) == 0)
+			rlim = newlim;
+		else
+			ereport(WARNING, (errmsg("setrlimit failed: %m")));
+	}
+#endif   /* RLIMIT_NOFILE */
 #endif   /* HAVE_GETRLIMIT */
 
 	/* dup until failure or probe limit reached */
@@ -1404,6 +1423,33 @@ FilePrefetch(File file, off_t offset, int amount)
 #endif
 }
 
+/*
+ * FileWriteback - ask the kernel to start writing out a range of the file
+ *
+ * This is only a hint to spread the write-out of dirty data, nothing waits
+ * for it and errors are ignored.
+ */
+void
+FileWriteback(File file, off_t offset, off_t nbytes)
+{
+	int			returnCode;
+
+	Assert(FileIsValid(file));
+
+	DO_DB(elog(LOG, "FileWriteback: %d (%s) " INT64_FORMAT " " INT64_FORMAT,
+			   file, VfdCache[file].fileName,
+			   (int64) offset, (int64) nbytes));
+
+	if (nbytes <= 0)
+		return;
+
+	returnCode = FileAccess(file);
+	if (returnCode < 0)
+		return;
+
+	(void) pg_flush_data(VfdCache[file].fd, offset, nbytes);
+}
+
 int
 FileRead(File file, char *buffer, int amount)
 {
@@ -94,6 +94,7 @@ static FSMAddress fsm_get_child(FSMAddress parent, uint16 slot);
 static FSMAddress fsm_get_parent(FSMAddress child, uint16 *slot);
 static FSMAddress fsm_get_location(BlockNumber heapblk, uint16 *slot);
 static BlockNumber fsm_get_heap_blk(FSMAddress addr, uint16 slot);
+static BlockNumber fsm_get_lastblckno(FSMAddress addr);
 static BlockNumber fsm_logical_to_physical(FSMAddress addr);
 
 static Buffer fsm_readbuf(Relation rel, FSMAddress addr, bool extend);
@@ -109,6 +110,7 @@ static int fsm_set_and_search(Relation rel, FSMAddress addr, uint16 slot,
 				   uint8 newValue, uint8 minValue);
 static BlockNumber fsm_search(Relation rel, uint8 min_cat);
 static uint8 fsm_vacuum_page(Relation rel, FSMAddress addr, bool *eof);
+static void fsm_update_recursive(Relation rel, FSMAddress addr, uint8 new_cat);
 
 
 /******** Public API ********/
@@ -188,6 +190,41 @@ RecordPageWithFreeSpace(Relation rel, BlockNumber heapBlk, Size spaceAvail)
 	fsm_set_and_search(rel, addr, slot, new_cat, 0);
 }
 
+/*
+ * UpdateFreeSpaceMap - make a range of pages visible to searchers
+ *
+ * The bottom level entries of heap blocks startBlkNum to endBlkNum must have
+ * been set already, with RecordPageWithFreeSpace; this sets the upper level
+ * pages above them to freespace, all the way up to the root.  That is much
+ * cheaper than FreeSpaceMapVacuum when a relation was extended by many
+ * pages, which all have the same free space.
+ */
+void
+UpdateFreeSpaceMap(Relation rel, BlockNumber startBlkNum,
+				   BlockNumber endBlkNum, Size freespace)
+{
+	int			new_cat = fsm_space_avail_to_cat(freespace);
+	FSMAddress	addr;
+	uint16		slot;
+	BlockNumber blockNum;
+	BlockNumber lastBlkOnPage;
+
+	blockNum = startBlkNum;
+
+	while (blockNum <= endBlkNum)
+	{
+		/* update the tree above this bottom level page */
+		addr = fsm_get_location(blockNum, &slot);
+		fsm_update_recursive(rel, addr, new_cat);
+
+		/* continue with the next bottom level page, if the range goes on */
+		lastBlkOnPage = fsm_get_lastblckno(addr);
+		if (lastBlkOnPage >= endBlkNum)
+			break;
+		blockNum = lastBlkOnPage + 1;
+	}
+}
+
 /*
  * XLogRecordPageWithFreeSpace - like RecordPageWithFreeSpace, for use in
  *		WAL replay
@@ -454,6 +491,16 @@ fsm_get_heap_blk(FSMAddress addr, uint16 slot)
 	return ((unsigned int) addr.logpageno) * SlotsPerFSMPage + slot;
 }
 
+/*
+ * Return the last heap block number covered by a bottom level FSM page.
+ */
+static BlockNumber
+fsm_get_lastblckno(FSMAddress addr)
+{
+	Assert(addr.level == FSM_BOTTOM_LEVEL);
+	return fsm_get_heap_blk(addr, SlotsPerFSMPage - 1);
+}
+
 /*
  * Given a logical address of a child page, get the logical page number of
  * the parent, and the slot within the parent corresponding to the child.
@@ -789,3 +836,21 @@ fsm_vacuum_page(Relation rel, FSMAddress addr, bool *eof_p)
 
 	return max_avail;
 }
+
+/*
+ * Set the entries for the page at addr in all its ancestors, up to the root,
+ * to new_cat.
+ */
+static void
+fsm_update_recursive(Relation rel, FSMAddress addr, uint8 new_cat)
+{
+	uint16		parentslot;
+	FSMAddress	parent;
+
+	if (addr.level == FSM_ROOT_LEVEL)
+		return;
+
+	parent = fsm_get_parent(addr, &parentslot);
+	fsm_set_and_search(rel, parent, parentslot, new_cat, 0);
+	fsm_update_recursive(rel, parent, new_cat);
+}
@@ -46,6 +46,21 @@
 #include "storage/spin.h"
 #include "pgxc/pgxc.h"
 #include "pgxc/pause.h"
+#if defined(ADB) || defined(AGTM)
+#include "agtm/agtm_stats.h"
+#endif
+#ifdef AGTM
+#include "agtm/agtm_sequence.h"
+#endif
+#ifdef ADB
+#include "agtm/agtm_broker.h"
+#include "agtm/agtm_xidcache.h"
+#include "pgxc/globaldeadlock.h"
+#include "utils/mcxtreport.h"
+#include "utils/sharedcatcache.h"
+#include "utils/sharedplancache.h"
+#include "utils/waitevent.h"
+#endif
 shmem_startup_hook_type shmem_startup_hook = NULL;
 
 static Size total_addin_request = 0;
@@ -136,7 +151,23 @@ CreateSharedMemoryAndSemaphores(bool makePrivate, int port)
 		size = add_size(size, AsyncShmemSize());
 #ifdef ADB
 		if (IS_PGXC_COORDINATOR)
+		{
 			size = add_size(size, ClusterLockShmemSize());
+			size = add_size(size, AgtmBrokerShmemSize());
+			size = add_size(size, GlobalDeadlockShmemSize());
+		}
+		size = add_size(size, AgtmXidCacheShmemSize());
+		size = add_size(size, SharedCatCacheShmemSize());
+		size = add_size(size, SharedPlanCacheShmemSize());
+		size = add_size(size, MemoryContextReportShmemSize());
+		size = add_size(size, WaitEventShmemSize());
+		size = add_size(size, PgStatShmemSize());
+#endif
+#if defined(ADB) || defined(AGTM)
+		size = add_size(size, AgtmStatsShmemSize());
+#endif
+#ifdef AGTM
+		size = add_size(size, AgtmSeqCacheShmemSize());
 #endif
 #ifdef PGXC
 		size = add_size(size, NodeTablesShmemSize());
@@ -251,7 +282,23 @@ CreateSharedMemoryAndSemaphores(bool makePrivate, int port)
 
 #ifdef ADB
 if (IS_PGXC_COORDINATOR)
+{
 	ClusterLockShmemInit();
+	AgtmBrokerShmemInit();
+	GlobalDeadlockShmemInit();
+}
+	AgtmXidCacheShmemInit();
+	SharedCatCacheShmemInit();
+	SharedPlanCacheShmemInit();
+	MemoryContextReportShmemInit();
+	WaitEventShmemInit();
+	PgStatShmemInit();
+#endif
+#if defined(ADB) || defined(AGTM)
+	AgtmStatsShmemInit();
+#endif
+#ifdef AGTM
+	AgtmSeqCacheShmemInit();
 #endif
 	/*
 	 * Set up other modules that need some shared memory space
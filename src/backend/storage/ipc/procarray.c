@@ -119,6 +119,15 @@ typedef struct ProcArrayStruct
 	 */
 	TransactionId lastOverflowedXid;
 
+	/*
+	 * Bumped whenever a running xid may have left the array, so a cached
+	 * snapshot is still exact while this is unchanged.  Newly assigned xids
+	 * are not counted, they are never below the xmax of an older snapshot.
+	 * Must hold exclusive ProcArrayLock to change this, and shared lock to
+	 * read it.  Starts at 1, so zero never matches a snapshot.
+	 */
+	uint64		xactCompletionCount;
+
 	/*
 	 * We declare pgprocnos[] as 1 entry because C wants a fixed-size array,
 	 * but actually it is maxProcs entries long.
@@ -139,6 +148,51 @@ typedef struct ProcArrayStruct
 
 static ProcArrayStruct *procArray;
 
+#ifdef AGTM
+/*
+ * AGTM hands out a global snapshot for every statement of every
+ * coordinator and datanode backend in the cluster.  Most of those requests
+ * arrive while no transaction has finished since the previous one was
+ * built, so the last snapshot is kept here and handed out again instead of
+ * scanning the whole ProcArray.  The xids of the building backend itself
+ * are stored too, so the cached copy is correct for every other backend.
+ */
+typedef struct AgtmSnapshotCache
+{
+	bool		valid;
+	uint64		completion_count;	/* xactCompletionCount when built */
+	TransactionId xmin;
+	TransactionId xmax;
+	TransactionId globalxmin;
+	int			xcnt;
+	int			subxcnt;
+	bool		suboverflowed;
+
+	/*
+	 * maxProcs entries of xip followed by TOTAL_MAX_CACHED_SUBXIDS entries
+	 * of subxip.
+	 */
+	TransactionId xids[1];		/* VARIABLE LENGTH ARRAY */
+} AgtmSnapshotCache;
+
+static AgtmSnapshotCache *agtmSnapCache;
+
+/* GUC parameter */
+bool		enable_agtm_snapshot_cache = true;
+
+/* set by GetAgtmSnapshotData for the next GetSnapshotData call only */
+static bool agtm_snapshot_cache_request = false;
+
+static bool AgtmSnapshotCacheGet(Snapshot snapshot, TransactionId xmax,
+					 TransactionId *xmin, TransactionId *globalxmin,
+					 int *count, int *subcount, bool *suboverflowed);
+static void AgtmSnapshotCachePut(Snapshot snapshot, TransactionId xmin,
+					 TransactionId xmax, TransactionId globalxmin,
+					 int count, int subcount, bool suboverflowed);
+#endif /* AGTM */
+
+#define ProcArrayXactCompleted(arrayP)	((arrayP)->xactCompletionCount++)
+
 static PGPROC *allProcs;
 static PGXACT *allPgXact;
 
@@ -210,6 +264,7 @@ static int KnownAssignedXidsGetAndSetXmin(TransactionId *xarray,
 static TransactionId KnownAssignedXidsGetOldestXmin(void);
 static void KnownAssignedXidsDisplay(int trace_level);
 static void KnownAssignedXidsReset(void);
+static bool GetSnapshotDataReuse(Snapshot snapshot);
 
 /*
  * Report shared-memory space needed by CreateSharedProcArray.
@@ -255,6 +310,14 @@ ProcArrayShmemSize(void)
 						mul_size(sizeof(bool), TOTAL_MAX_CACHED_SUBXIDS));
 	}
 
+#ifdef AGTM
+	size = add_size(size, offsetof(AgtmSnapshotCache, xids));
+	size = add_size(size,
+					mul_size(sizeof(TransactionId),
+							 add_size(PROCARRAY_MAXPROCS,
+									  TOTAL_MAX_CACHED_SUBXIDS)));
+#endif
+
 	return size;
 }
 
@@ -287,8 +350,21 @@ CreateSharedProcArray(void)
 		procArray->headKnownAssignedXids = 0;
 		SpinLockInit(&procArray->known_assigned_xids_lck);
 		procArray->lastOverflowedXid = InvalidTransactionId;
+		procArray->xactCompletionCount = 1;
 	}
 
+#ifdef AGTM
+	agtmSnapCache = (AgtmSnapshotCache *)
+		ShmemInitStruct("AGTM Snapshot Cache",
+						add_size(offsetof(AgtmSnapshotCache, xids),
+								 mul_size(sizeof(TransactionId),
+										  add_size(PROCARRAY_MAXPROCS,
+												   TOTAL_MAX_CACHED_SUBXIDS))),
+						&found);
+	if (!found)
+		agtmSnapCache->valid = false;
+#endif
+
 	allProcs = ProcGlobal->allProcs;
 	allPgXact = ProcGlobal->allPgXact;
 
@@ -355,6 +431,9 @@ ProcArrayAdd(PGPROC *proc)
 	arrayP->pgprocnos[index] = proc->pgprocno;
 	arrayP->numProcs++;
 
+	/* a prepared transaction may bring its xid back */
+	ProcArrayXactCompleted(arrayP);
+
 	LWLockRelease(ProcArrayLock);
 }
 
@@ -400,6 +479,8 @@ ProcArrayRemove(PGPROC *proc, TransactionId latestXid)
 		Assert(!TransactionIdIsValid(allPgXact[proc->pgprocno].xid));
 	}
 
+	ProcArrayXactCompleted(arrayP);
+
 	for (index = 0; index < arrayP->numProcs; index++)
 	{
 		if (arrayP->pgprocnos[index] == proc->pgprocno)
@@ -478,6 +559,8 @@ ProcArrayEndTransaction(PGPROC *proc, TransactionId latestXid)
 								  latestXid))
 			ShmemVariableCache->latestCompletedXid = latestXid;
 
+		ProcArrayXactCompleted(procArray);
+
 		LWLockRelease(ProcArrayLock);
 	}
 	else
@@ -516,11 +599,14 @@ ProcArrayClearTransaction(PGPROC *proc)
 	PGXACT	   *pgxact = &allPgXact[proc->pgprocno];
 
 	/*
-	 * We can skip locking ProcArrayLock here, because this action does not
-	 * actually change anyone's view of the set of running XIDs: our entry is
-	 * duplicate with the gxact that has already been inserted into the
-	 * ProcArray.
+	 * This action does not actually change anyone's view of the set of
+	 * running XIDs: our entry is duplicate with the gxact that has already
+	 * been inserted into the ProcArray.  But a snapshot this backend built
+	 * left its own xid out, and must not be reused once that xid is only
+	 * running in the gxact, so take the lock to bump the completion count.
 	 */
+	LWLockAcquire(ProcArrayLock, LW_EXCLUSIVE);
+
 	pgxact->xid = InvalidTransactionId;
 	proc->lxid = InvalidLocalTransactionId;
 	pgxact->xmin = InvalidTransactionId;
@@ -533,6 +619,10 @@ ProcArrayClearTransaction(PGPROC *proc)
 	/* Clear the subtransaction-XID cache too */
 	pgxact->nxids = 0;
 	pgxact->overflowed = false;
+
+	ProcArrayXactCompleted(procArray);
+
+	LWLockRelease(ProcArrayLock);
 }
 
 /*
@@ -1340,6 +1430,42 @@ GetMaxSnapshotSubxidCount(void)
 	return TOTAL_MAX_CACHED_SUBXIDS;
 }
 
+/*
+ * GetSnapshotDataReuse -- try to reuse the last snapshot built in *snapshot
+ *
+ * If no transaction has left the ProcArray since the snapshot was built, its
+ * xid lists, xmin and xmax are still exact: every xid assigned since is at
+ * least its xmax.  Caller must hold ProcArrayLock in shared mode.
+ *
+ * Nothing that finished since can make another backend's global xmin pass
+ * the snapshot's xmin either, so it is also still safe to advertise that as
+ * MyPgXact->xmin.  RecentGlobalXmin stays as it is, it can only be older.
+ */
+static bool
+GetSnapshotDataReuse(Snapshot snapshot)
+{
+	if (snapshot->snapXactCompletionCount == 0 ||
+		snapshot->snapXactCompletionCount != procArray->xactCompletionCount)
+		return false;
+
+	Assert(!snapshot->takenDuringRecovery);
+
+	if (!TransactionIdIsValid(MyPgXact->xmin))
+		MyPgXact->xmin = TransactionXmin = snapshot->xmin;
+
+	RecentXmin = snapshot->xmin;
+	Assert(TransactionIdPrecedesOrEquals(TransactionXmin, RecentXmin));
+
+	snapshot->curcid = GetCurrentCommandId(false);
+
+	/* set both refcounts to zero, as for a new snapshot */
+	snapshot->active_count = 0;
+	snapshot->regd_count = 0;
+	snapshot->copied = false;
+
+	return true;
+}
+
 /*
  * GetSnapshotData -- returns information about running transactions.
  *
@@ -1388,6 +1514,11 @@ GetSnapshotData(Snapshot snapshot)
 	bool		is_under_agtm;
 	bool		hint;
 #endif /* ADB */
+#ifdef AGTM
+	bool		use_cache = agtm_snapshot_cache_request;
+
+	agtm_snapshot_cache_request = false;
+#endif /* AGTM */
 
 	Assert(snapshot != NULL);
 
@@ -1432,6 +1563,7 @@ GetSnapshotData(Snapshot snapshot)
 					(errcode(ERRCODE_OUT_OF_MEMORY),
 					 errmsg("out of memory")));
 		}
+		snapshot->max_subxcnt = GetMaxSnapshotSubxidCount();
 #else
 			ereport(ERROR,
 					(errcode(ERRCODE_OUT_OF_MEMORY),
@@ -1474,6 +1606,16 @@ GetSnapshotData(Snapshot snapshot)
 	 */
 	LWLockAcquire(ProcArrayLock, LW_SHARED);
 
+#ifdef ADB
+	if (!is_under_agtm && GetSnapshotDataReuse(snapshot))
+#else
+	if (GetSnapshotDataReuse(snapshot))
+#endif
+	{
+		LWLockRelease(ProcArrayLock);
+		return snapshot;
+	}
+
 	/* xmax is always latestCompletedXid + 1 */
 	xmax = ShmemVariableCache->latestCompletedXid;
 	Assert(TransactionIdIsNormal(xmax));
@@ -1492,6 +1634,13 @@ GetSnapshotData(Snapshot snapshot)
 
 	snapshot->takenDuringRecovery = RecoveryInProgress();
 
+#ifdef AGTM
+	if (use_cache && !snapshot->takenDuringRecovery &&
+		AgtmSnapshotCacheGet(snapshot, xmax, &xmin, &globalxmin,
+							 &count, &subcount, &suboverflowed))
+		goto got_snapshot;
+#endif /* AGTM */
+
 	if (!snapshot->takenDuringRecovery)
 	{
 		int		   *pgprocnos = arrayP->pgprocnos;
@@ -1607,11 +1756,7 @@ GetSnapshotData(Snapshot snapshot)
 								}
 								if(hint == false)
 								{
-									if(subcount == GetMaxSnapshotSubxidCount())
-									{
-										suboverflowed = true;
-										break;
-									}
+									EnlargeSnapshotSubxip(snapshot, subcount+1);
 									snapshot->subxip[subcount++] = proc->subxids.xids[i];
 								}
 							}
@@ -1674,8 +1819,31 @@ GetSnapshotData(Snapshot snapshot)
 			suboverflowed = true;
 	}
 
+#ifdef AGTM
+	if (use_cache && !snapshot->takenDuringRecovery)
+		AgtmSnapshotCachePut(snapshot, xmin, xmax, globalxmin,
+							 count, subcount, suboverflowed);
+
+got_snapshot:
+#endif /* AGTM */
 	if (!TransactionIdIsValid(MyPgXact->xmin))
 		MyPgXact->xmin = TransactionXmin = xmin;
+
+	/*
+	 * Remember the completion count for GetSnapshotDataReuse, unless the
+	 * snapshot holds xids that are not from this ProcArray scan.
+	 */
+	snapshot->snapXactCompletionCount = arrayP->xactCompletionCount;
+	if (snapshot->takenDuringRecovery)
+		snapshot->snapXactCompletionCount = 0;
+#ifdef ADB
+	if (is_under_agtm)
+		snapshot->snapXactCompletionCount = 0;
+#endif /* ADB */
+#ifdef AGTM
+	if (use_cache)
+		snapshot->snapXactCompletionCount = 0;
+#endif /* AGTM */
 	LWLockRelease(ProcArrayLock);
 
 	/*
@@ -1712,6 +1880,132 @@ GetSnapshotData(Snapshot snapshot)
 	return snapshot;
 }
 
+#ifdef AGTM
+/*
+ * GetAgtmSnapshotData -- GetSnapshotData for a snapshot sent to a client
+ *
+ * Same as GetSnapshotData, but may return the snapshot built for another
+ * AGTM backend if no running transaction has finished since.  The result
+ * can list the caller's own xid, that is fine for a snapshot used by the
+ * coordinator or datanode, which check their own xid first.
+ */
+Snapshot
+GetAgtmSnapshotData(Snapshot snapshot)
+{
+	agtm_snapshot_cache_request = enable_agtm_snapshot_cache;
+
+	return GetSnapshotData(snapshot);
+}
+
+/*
+ * Copy the cached snapshot, caller must hold ProcArrayLock.
+ *
+ * Returns false if there is no cached snapshot valid at this moment, or
+ * somebody is just building a new one.
+ */
+static bool
+AgtmSnapshotCacheGet(Snapshot snapshot, TransactionId xmax,
+					 TransactionId *xmin, TransactionId *globalxmin,
+					 int *count, int *subcount, bool *suboverflowed)
+{
+	AgtmSnapshotCache *cache = agtmSnapCache;
+	TransactionId *xids;
+	TransactionId myxid;
+	int			i;
+	int			n;
+
+	if (!LWLockConditionalAcquire(AgtmSnapshotCacheLock, LW_SHARED))
+		return false;
+
+	if (!cache->valid ||
+		cache->completion_count != procArray->xactCompletionCount ||
+		!TransactionIdEquals(cache->xmax, xmax))
+	{
+		LWLockRelease(AgtmSnapshotCacheLock);
+		return false;
+	}
+
+	/* skip our own xid, just like a snapshot we would build ourselves */
+	myxid = MyPgXact->xid;
+	xids = cache->xids;
+	for (i = n = 0; i < cache->xcnt; i++)
+	{
+		if (!TransactionIdEquals(xids[i], myxid))
+			snapshot->xip[n++] = xids[i];
+	}
+	memcpy(snapshot->subxip, xids + procArray->maxProcs,
+		   cache->subxcnt * sizeof(TransactionId));
+
+	*xmin = cache->xmin;
+	*globalxmin = cache->globalxmin;
+	*count = n;
+	*subcount = cache->subxcnt;
+	*suboverflowed = cache->suboverflowed;
+
+	LWLockRelease(AgtmSnapshotCacheLock);
+
+	return true;
+}
+
+/*
+ * Save a snapshot just built for later AGTM requests, caller must hold
+ * ProcArrayLock.  The xids of our own transaction are added back, because
+ * the cached snapshot is used by other backends.
+ */
+static void
+AgtmSnapshotCachePut(Snapshot snapshot, TransactionId xmin,
+					 TransactionId xmax, TransactionId globalxmin,
+					 int count, int subcount, bool suboverflowed)
+{
+	AgtmSnapshotCache *cache = agtmSnapCache;
+	TransactionId *xids;
+	TransactionId myxid;
+
+	/* somebody else is storing a snapshot as new as ours */
+	if (!LWLockConditionalAcquire(AgtmSnapshotCacheLock, LW_EXCLUSIVE))
+		return;
+
+	xids = cache->xids;
+	memcpy(xids, snapshot->xip, count * sizeof(TransactionId));
+	if (!suboverflowed)
+		memcpy(xids + procArray->maxProcs, snapshot->subxip,
+			   subcount * sizeof(TransactionId));
+
+	myxid = MyPgXact->xid;
+	if (TransactionIdIsNormal(myxid) &&
+		NormalTransactionIdPrecedes(myxid, xmax))
+	{
+		xids[count++] = myxid;
+		if (!suboverflowed)
+		{
+			int			nxids = MyPgXact->nxids;
+
+			if (MyPgXact->overflowed ||
+				nxids + subcount > TOTAL_MAX_CACHED_SUBXIDS)
+				suboverflowed = true;
+			else
+			{
+				memcpy(xids + procArray->maxProcs + subcount,
+					   MyProc->subxids.xids,
+					   nxids * sizeof(TransactionId));
+				subcount += nxids;
+			}
+		}
+	}
+
+	cache->xmin = xmin;
+	cache->xmax = xmax;
+	cache->globalxmin = globalxmin;
+	cache->xcnt = count;
+	cache->subxcnt = suboverflowed ? 0 : subcount;
+	cache->suboverflowed = suboverflowed;
+	cache->completion_count = procArray->xactCompletionCount;
+	cache->valid = true;
+
+	LWLockRelease(AgtmSnapshotCacheLock);
+}
+#endif /* AGTM */
+
 /*
  * ProcArrayInstallImportedXmin -- install imported xmin into MyPgXact->xmin
  *
@@ -2806,6 +3100,8 @@ XidCacheRemoveRunningXids(TransactionId xid,
 							  latestXid))
 		ShmemVariableCache->latestCompletedXid = latestXid;
 
+	ProcArrayXactCompleted(procArray);
+
 	LWLockRelease(ProcArrayLock);
 }
 
@@ -3859,6 +4155,9 @@ void EnlargeSnapshotXip(Snapshot snapshot, uint32 need_size)
 		return;
 
 	new_size = need_size - (need_size % SNAPSHOT_ENLARGE_STEP) + SNAPSHOT_ENLARGE_STEP;
+	/* grow twofold at least, global snapshots then rarely need to realloc */
+	if (new_size < snapshot->max_xcnt * 2)
+		new_size = snapshot->max_xcnt * 2;
 	Assert(new_size >= need_size);
 
 	p = realloc(snapshot->xip, new_size * sizeof(snapshot->xip[0]));
@@ -3871,4 +4170,35 @@ void EnlargeSnapshotXip(Snapshot snapshot, uint32 need_size)
 	snapshot->xip = p;
 	snapshot->max_xcnt = new_size;
 }
+
+/*
+ * Same as EnlargeSnapshotXip for subxip.  Global snapshots list the subxids
+ * of the whole cluster, which may be many more than could be cached by the
+ * local procs, so they are not truncated and marked overflowed but make the
+ * array grow instead.
+ */
+void EnlargeSnapshotSubxip(Snapshot snapshot, uint32 need_size)
+{
+	void *p;
+	uint32 new_size;
+	AssertArg(snapshot);
+	if(need_size < snapshot->max_subxcnt)
+		return;
+
+	new_size = need_size - (need_size % SNAPSHOT_ENLARGE_STEP) + SNAPSHOT_ENLARGE_STEP;
+	/* grow twofold at least, global snapshots then rarely need to realloc */
+	if (new_size < snapshot->max_subxcnt * 2)
+		new_size = snapshot->max_subxcnt * 2;
+	Assert(new_size >= need_size);
+
+	p = realloc(snapshot->subxip, new_size * sizeof(snapshot->subxip[0]));
+	if(p == NULL)
+	{
+		ereport(ERROR,
+			(errcode(ERRCODE_OUT_OF_MEMORY),
+			 errmsg("out of memory")));
+	}
+	snapshot->subxip = p;
+	snapshot->max_subxcnt = new_size;
+}
 #endif /* ADB */
@@ -27,6 +27,10 @@
 #ifdef PGXC
 #include "pgxc/poolutils.h"
 #endif
+#ifdef ADB
+#include "pgxc/globaldeadlock.h"
+#include "utils/mcxtreport.h"
+#endif
 
 /*
  * The SIGUSR1 signal is multiplexed to support signalling multiple event
@@ -272,6 +276,14 @@ procsignal_sigusr1_handler(SIGNAL_ARGS)
 		need_reload_pooler = true;
 #endif
 
+#ifdef ADB
+	if (CheckProcSignal(PROCSIG_MEMORY_CONTEXTS))
+		HandleMemoryContextReportInterrupt();
+
+	if (CheckProcSignal(PROCSIG_GLOBAL_DEADLOCK))
+		HandleGlobalDeadlockInterrupt();
+#endif
+
 	if (CheckProcSignal(PROCSIG_RECOVERY_CONFLICT_DATABASE))
 		RecoveryConflictInterrupt(PROCSIG_RECOVERY_CONFLICT_DATABASE);
 
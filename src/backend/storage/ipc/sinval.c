@@ -78,7 +78,15 @@ ReceiveSharedInvalidMessages(
 					  void (*invalFunction) (SharedInvalidationMessage *msg),
 							 void (*resetFunction) (void))
 {
+#ifdef ADB
+	/*
+	 * A backend catching up on a long queue takes SInvalReadLock once per
+	 * batch, so read bigger batches.
+	 */
+#define MAXINVALMSGS 256
+#else
 #define MAXINVALMSGS 32
+#endif
 	static SharedInvalidationMessage messages[MAXINVALMSGS];
 
 	/*
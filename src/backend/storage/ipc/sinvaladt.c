@@ -51,7 +51,10 @@
  * "reset" flag for each backend that has fallen too far behind.  A backend
  * that is in "reset" state is ignored while determining minMsgNum.  When
  * it does finally attempt to receive inval messages, it must discard all
- * its invalidatable state, since it won't know what it missed.
+ * its invalidatable state, since it won't know what it missed.  (In ADB the
+ * queue also remembers, per slot of a small hash table, the newest message
+ * that went there, so a reset backend can usually flush just the entries
+ * it missed messages about; see SIFillResetSummary.)
  *
  * To reduce the probability of needing resets, we send a "catchup" interrupt
  * to any backend that seems to be falling unreasonably far behind.  The
@@ -127,8 +130,21 @@
  * per iteration.
  */
 
+#ifdef ADB
+/*
+ * The number of buffered messages is chosen at postmaster start (see
+ * sinval_queue_size), so that a busy server doing lots of DDL doesn't
+ * reset its backends all the time.  It's still a power of 2, and
+ * MSGNUMWRAPAROUND is a multiple of every allowed size.
+ */
+#define MAXNUMMESSAGES (shmInvalBuffer->numMessages)
+#define MSGNUMWRAPAROUND 0x40000000
+#define MIN_SINVAL_QUEUE_SIZE 4096
+#define MAX_SINVAL_QUEUE_SIZE (1 << 24)
+#else
 #define MAXNUMMESSAGES 4096
 #define MSGNUMWRAPAROUND (MAXNUMMESSAGES * 262144)
+#endif
 #define CLEANUP_MIN (MAXNUMMESSAGES / 2)
 #define CLEANUP_QUANTUM (MAXNUMMESSAGES / 16)
 #define SIG_THRESHOLD (MAXNUMMESSAGES / 2)
@@ -140,7 +156,10 @@ typedef struct ProcState
 	/* procPid is zero in an inactive ProcState array entry. */
 	pid_t		procPid;		/* PID of backend, for signaling */
 	PGPROC	   *proc;			/* PGPROC of backend */
-	/* nextMsgNum is meaningless if procPid == 0 or resetState is true. */
+	/*
+	 * nextMsgNum is meaningless if procPid == 0.  In ADB, it is kept while
+	 * resetState is true, to tell which messages the backend has missed.
+	 */
 	int			nextMsgNum;		/* next message number to read */
 	bool		resetState;		/* backend needs to reset its state */
 	bool		signaled;		/* backend has been sent catchup signal */
@@ -177,10 +196,31 @@ typedef struct SISeg
 
 	slock_t		msgnumLock;		/* spinlock protecting maxMsgNum */
 
+#ifdef ADB
+	int			numMessages;	/* size of buffer, a power of 2 */
+
+	/*
+	 * Circular buffer holding shared-inval messages, placed after the
+	 * procState array
+	 */
+	SharedInvalidationMessage *buffer;
+
+	/*
+	 * Number, plus one, of the newest message of each kind, see
+	 * SharedInvalSummary.  Protected like the buffer.
+	 */
+	int			fullMsgNum;
+	int			relcacheMsgNum;
+	int			smgrMsgNum;
+	int			relmapMsgNum;
+	int			cacheMsgNum[SINVAL_SUMMARY_CACHES];
+	int			bucketMsgNum[SINVAL_SUMMARY_BUCKETS];
+#else
 	/*
 	 * Circular buffer holding shared-inval messages
 	 */
 	SharedInvalidationMessage buffer[MAXNUMMESSAGES];
+#endif
 
 	/*
 	 * Per-backend state info.
@@ -193,12 +233,51 @@ typedef struct SISeg
 
 static SISeg *shmInvalBuffer;	/* pointer to the shared inval buffer */
 
+#ifdef ADB
+int			sinval_queue_size = 0;
+
+/* What the last reset of this backend missed, see SIGetResetSummary */
+static SharedInvalSummary resetSummary;
+static bool resetSummaryValid = false;
+#endif
 
 static LocalTransactionId nextLocalTransactionId;
 
 static void CleanupInvalidationState(int status, Datum arg);
+#ifdef ADB
+static int	SInvalQueueSize(void);
+static void SIRecordMessage(SISeg *segP, const SharedInvalidationMessage *msg,
+				int msgnum);
+static void SIFillResetSummary(SISeg *segP, int fromMsgNum);
+#endif
 
 
+#ifdef ADB
+/*
+ * SInvalQueueSize --- number of messages the circular buffer holds
+ *
+ * sinval_queue_size = 0 sizes the buffer by the number of backends which
+ * may have to be kept up to date.
+ */
+static int
+SInvalQueueSize(void)
+{
+	int64		want;
+	int			size;
+
+	if (sinval_queue_size > 0)
+		want = sinval_queue_size;
+	else
+		want = (int64) MaxBackends * 64;
+
+	size = MIN_SINVAL_QUEUE_SIZE;
+	while (size < want && size < MAX_SINVAL_QUEUE_SIZE)
+		size <<= 1;
+
+	return size;
+}
+#endif
+
 /*
  * SInvalShmemSize --- return shared-memory space needed
  */
@@ -209,6 +288,11 @@ SInvalShmemSize(void)
 
 	size = offsetof(SISeg, procState);
 	size = add_size(size, mul_size(sizeof(ProcState), MaxBackends));
+#ifdef ADB
+	size = MAXALIGN(size);
+	size = add_size(size, mul_size(sizeof(SharedInvalidationMessage),
+								   SInvalQueueSize()));
+#endif
 
 	return size;
 }
@@ -225,14 +309,18 @@ CreateSharedInvalidationState(void)
 	bool		found;
 
 	/* Allocate space in shared memory */
-	size = offsetof(SISeg, procState);
-	size = add_size(size, mul_size(sizeof(ProcState), MaxBackends));
+	size = SInvalShmemSize();
 
 	shmInvalBuffer = (SISeg *)
 		ShmemInitStruct("shmInvalBuffer", size, &found);
 	if (found)
 		return;
 
+#ifdef ADB
+	/* CLEANUP_MIN depends on the size of the buffer */
+	shmInvalBuffer->numMessages = SInvalQueueSize();
+#endif
+
 	/* Clear message counters, save size of procState array, init spinlock */
 	shmInvalBuffer->minMsgNum = 0;
 	shmInvalBuffer->maxMsgNum = 0;
@@ -241,6 +329,19 @@ CreateSharedInvalidationState(void)
 	shmInvalBuffer->maxBackends = MaxBackends;
 	SpinLockInit(&shmInvalBuffer->msgnumLock);
 
+#ifdef ADB
+	shmInvalBuffer->buffer = (SharedInvalidationMessage *)
+		((char *) shmInvalBuffer +
+		 MAXALIGN(offsetof(SISeg, procState) +
+				  sizeof(ProcState) * MaxBackends));
+	shmInvalBuffer->fullMsgNum = 0;
+	shmInvalBuffer->relcacheMsgNum = 0;
+	shmInvalBuffer->smgrMsgNum = 0;
+	shmInvalBuffer->relmapMsgNum = 0;
+	MemSet(shmInvalBuffer->cacheMsgNum, 0, sizeof(shmInvalBuffer->cacheMsgNum));
+	MemSet(shmInvalBuffer->bucketMsgNum, 0, sizeof(shmInvalBuffer->bucketMsgNum));
+#endif
+
 	/* The buffer[] array is initially all unused, so we need not fill it */
 
 	/* Mark all backends inactive, and initialize nextLXID */
@@ -452,7 +553,12 @@ SIInsertDataEntries(const SharedInvalidationMessage *data, int n)
 		max = segP->maxMsgNum;
 		while (nthistime-- > 0)
 		{
+#ifdef ADB
+			SIRecordMessage(segP, data, max + 1);
+			segP->buffer[max & (MAXNUMMESSAGES - 1)] = *data++;
+#else
 			segP->buffer[max % MAXNUMMESSAGES] = *data++;
+#endif
 			max++;
 		}
 
@@ -567,6 +673,9 @@ SIGetDataEntries(SharedInvalidationMessage *data, int datasize)
 		 * since the reset, as well; and that means we should clear the
 		 * signaled flag, too.
 		 */
+#ifdef ADB
+		SIFillResetSummary(segP, stateP->nextMsgNum);
+#endif
 		stateP->nextMsgNum = max;
 		stateP->resetState = false;
 		stateP->signaled = false;
@@ -585,7 +694,11 @@ SIGetDataEntries(SharedInvalidationMessage *data, int datasize)
 	n = 0;
 	while (n < datasize && stateP->nextMsgNum < max)
 	{
+#ifdef ADB
+		data[n++] = segP->buffer[stateP->nextMsgNum & (MAXNUMMESSAGES - 1)];
+#else
 		data[n++] = segP->buffer[stateP->nextMsgNum % MAXNUMMESSAGES];
+#endif
 		stateP->nextMsgNum++;
 	}
 
@@ -693,8 +806,31 @@ SICleanupQueue(bool callerHasWriteLock, int minFree)
 		for (i = 0; i < segP->lastBackend; i++)
 		{
 			/* we don't bother skipping inactive entries here */
+#ifdef ADB
+			/*
+			 * A backend in reset state may be further back than minMsgNum;
+			 * -1 makes it look as if it missed every message.
+			 */
+			if (segP->procState[i].nextMsgNum < MSGNUMWRAPAROUND)
+				segP->procState[i].nextMsgNum = -1;
+			else
+#endif
 			segP->procState[i].nextMsgNum -= MSGNUMWRAPAROUND;
 		}
+#ifdef ADB
+		/* Messages numbered before the wraparound look old enough now */
+#define SI_WRAP_MSGNUM(v) \
+		((v) = ((v) > MSGNUMWRAPAROUND ? (v) - MSGNUMWRAPAROUND : 0))
+		SI_WRAP_MSGNUM(segP->fullMsgNum);
+		SI_WRAP_MSGNUM(segP->relcacheMsgNum);
+		SI_WRAP_MSGNUM(segP->smgrMsgNum);
+		SI_WRAP_MSGNUM(segP->relmapMsgNum);
+		for (i = 0; i < SINVAL_SUMMARY_CACHES; i++)
+			SI_WRAP_MSGNUM(segP->cacheMsgNum[i]);
+		for (i = 0; i < SINVAL_SUMMARY_BUCKETS; i++)
+			SI_WRAP_MSGNUM(segP->bucketMsgNum[i]);
+#undef SI_WRAP_MSGNUM
+#endif
 	}
 
 	/*
@@ -733,6 +869,99 @@ SICleanupQueue(bool callerHasWriteLock, int minFree)
 	}
 }
 
+#ifdef ADB
+/*
+ * SIRecordMessage
+ *		Remember that message number msgnum - 1 is about "msg"
+ *
+ * Caller must hold SInvalWriteLock, and the message must not be visible to
+ * readers yet (maxMsgNum not advanced past it).
+ */
+static void
+SIRecordMessage(SISeg *segP, const SharedInvalidationMessage *msg, int msgnum)
+{
+	if (msg->id >= 0)
+	{
+		segP->cacheMsgNum[msg->id] = msgnum;
+		segP->bucketMsgNum[SharedInvalCatcacheBucket(msg->cc.id,
+													 msg->cc.hashValue)] = msgnum;
+	}
+	else if (msg->id == SHAREDINVALRELCACHE_ID && OidIsValid(msg->rc.relId))
+	{
+		segP->relcacheMsgNum = msgnum;
+		segP->bucketMsgNum[SharedInvalRelcacheBucket(msg->rc.relId)] = msgnum;
+	}
+	else if (msg->id == SHAREDINVALSMGR_ID)
+		segP->smgrMsgNum = msgnum;
+	else if (msg->id == SHAREDINVALRELMAP_ID)
+		segP->relmapMsgNum = msgnum;
+	else
+		segP->fullMsgNum = msgnum;
+}
+
+/*
+ * SIFillResetSummary
+ *		Work out what a backend reset at fromMsgNum has missed
+ *
+ * Caller holds SInvalReadLock and has fetched maxMsgNum under the spinlock,
+ * so every message the backend is going to skip has left its number.  Slots
+ * written by messages after that only cause some extra invalidations.
+ */
+static void
+SIFillResetSummary(SISeg *segP, int fromMsgNum)
+{
+	SharedInvalSummary *summary = &resetSummary;
+	int			nbuckets = 0;
+	int			i;
+
+	MemSet(summary, 0, sizeof(SharedInvalSummary));
+	resetSummaryValid = true;
+
+	summary->all = (segP->fullMsgNum > fromMsgNum);
+	summary->relcache = (segP->relcacheMsgNum > fromMsgNum);
+	summary->smgr = (segP->smgrMsgNum > fromMsgNum);
+	summary->relmap = (segP->relmapMsgNum > fromMsgNum);
+	for (i = 0; i < SINVAL_SUMMARY_CACHES; i++)
+		summary->caches[i] = (segP->cacheMsgNum[i] > fromMsgNum);
+
+	for (i = 0; i < SINVAL_SUMMARY_BUCKETS; i++)
+	{
+		if (segP->bucketMsgNum[i] > fromMsgNum)
+		{
+			summary->buckets[i / 8] |= (1 << (i % 8));
+			nbuckets++;
+		}
+	}
+
+	/*
+	 * With this many slots hit, flushing entry by entry is hardly cheaper
+	 * than flushing everything.
+	 */
+	if (nbuckets > SINVAL_SUMMARY_BUCKETS / 4)
+		summary->all = true;
+}
+
+/*
+ * SIGetResetSummary
+ *		What did the last reset of this backend miss?
+ *
+ * Returns NULL if it's not known, and the caller must discard all of its
+ * invalidatable state.  Meant to be called by the resetFunction of
+ * ReceiveSharedInvalidMessages, right after SIGetDataEntries said -1.
+ */
+const SharedInvalSummary *
+SIGetResetSummary(void)
+{
+	if (!resetSummaryValid)
+		return NULL;
+	resetSummaryValid = false;
+
+	if (resetSummary.all)
+		return NULL;
+
+	return &resetSummary;
+}
+#endif
 
 /*
  * GetNextLocalTransactionId --- allocate a new LocalTransactionId
@@ -10,6 +10,20 @@
  * locking should be done with the full lock manager --- which depends on
  * LWLocks to protect its shared state.
  *
+ * The state of a lock, that is the number of shared holders, whether it is
+ * held exclusively, and two flags used for the wait queue, lives in a single
+ * 32-bit word that is only changed with compare-and-swap and friends.  An
+ * uncontended acquire or release is therefore a single atomic operation.
+ * The spinlock of the lock only protects its queue of waiting PGPROCs, and
+ * is only taken by backends that have to sleep and by the releaser that
+ * wakes them up.
+ *
+ * A backend that cannot get the lock queues itself, and then tries to get
+ * the lock once more before sleeping: a release that happened between the
+ * first attempt and the queueing could not have seen it in the queue.  If
+ * the second attempt succeeds, the backend takes itself back off the queue,
+ * absorbing the wakeup if a releaser was already about to send it.
+ *
  *
  * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -23,27 +37,47 @@
 
 #include "access/clog.h"
 #include "access/multixact.h"
+#include "access/slru.h"
 #include "access/subtrans.h"
+#include "access/xlog.h"
 #include "commands/async.h"
 #include "miscadmin.h"
 #include "pg_trace.h"
+#include "portability/instr_time.h"
 #include "storage/barrier.h"
 #include "storage/ipc.h"
 #include "storage/predicate.h"
 #include "storage/proc.h"
 #include "storage/spin.h"
+#ifdef ADB
+#include "utils/waitevent.h"
+#endif
 
 
 /* We use the ShmemLock spinlock to protect LWLockAssign */
 extern slock_t *ShmemLock;
 
+/*
+ * Layout of the state word of a lock.  The low bits count the shared
+ * holders, LW_VAL_EXCLUSIVE is set while the lock is held exclusively; it is
+ * large enough that adding it also makes the shared count test fail.
+ */
+#define LW_FLAG_HAS_WAITERS		((uint32) 1 << 30)
+#define LW_FLAG_RELEASE_OK		((uint32) 1 << 29)
+
+#define LW_VAL_EXCLUSIVE		((uint32) 1 << 24)
+#define LW_VAL_SHARED			1
+
+#define LW_LOCK_MASK			((uint32) ((1 << 25) - 1))
+
 
 typedef struct LWLock
 {
-	slock_t		mutex;			/* Protects LWLock and queue of PGPROCs */
-	bool		releaseOK;		/* T if ok to release waiters */
-	char		exclusive;		/* # of exclusive holders (0 or 1) */
-	int			shared;			/* # of shared holders (0..MaxBackends) */
+	volatile uint32 state;		/* holders and flags, see LW_* above */
+#ifndef HAVE_GCC_INT_ATOMICS
+	slock_t		statelock;		/* emulates atomic operations on state */
+#endif
+	slock_t		mutex;			/* Protects queue of PGPROCs */
 	PGPROC	   *head;			/* head of list of waiting PGPROCs */
 	PGPROC	   *tail;			/* tail of list of waiting PGPROCs */
 	/* tail is undefined when head is NULL */
@@ -97,6 +131,8 @@ static int *sh_acquire_counts;
 static int *ex_acquire_counts;
 static int *block_counts;
 static int *spin_delay_counts;
+static int *dequeue_self_counts;
+static uint64 *block_time_us;
 #endif
 
 #ifdef LOCK_DEBUG
@@ -106,10 +142,17 @@ inline static void
 PRINT_LWDEBUG(const char *where, LWLockId lockid, const volatile LWLock *lock)
 {
 	if (Trace_lwlocks)
-		elog(LOG, "%s(%d): excl %d shared %d head %p rOK %d",
+	{
+		uint32		state = lock->state;
+
+		elog(LOG, "%s(%d): excl %u shared %u haswaiters %u head %p rOK %u",
 			 where, (int) lockid,
-			 (int) lock->exclusive, lock->shared, lock->head,
-			 (int) lock->releaseOK);
+			 (state & LW_VAL_EXCLUSIVE) != 0,
+			 state & (LW_VAL_EXCLUSIVE - 1),
+			 (state & LW_FLAG_HAS_WAITERS) != 0,
+			 lock->head,
+			 (state & LW_FLAG_RELEASE_OK) != 0);
+	}
 }
 
 inline static void
@@ -138,6 +181,8 @@ init_lwlock_stats(void)
 	ex_acquire_counts = calloc(numLocks, sizeof(int));
 	spin_delay_counts = calloc(numLocks, sizeof(int));
 	block_counts = calloc(numLocks, sizeof(int));
+	dequeue_self_counts = calloc(numLocks, sizeof(int));
+	block_time_us = calloc(numLocks, sizeof(uint64));
 	counts_for_pid = MyProcPid;
 	on_shmem_exit(print_lwlock_stats, 0);
 }
@@ -155,9 +200,11 @@ print_lwlock_stats(int code, Datum arg)
 	for (i = 0; i < numLocks; i++)
 	{
 		if (sh_acquire_counts[i] || ex_acquire_counts[i] || block_counts[i] || spin_delay_counts[i])
-			fprintf(stderr, "PID %d lwlock %d: shacq %u exacq %u blk %u spindelay %u\n",
+			fprintf(stderr, "PID %d lwlock %d: shacq %u exacq %u blk %u spindelay %u dequeue self %u blktime %.3f ms\n",
 					MyProcPid, i, sh_acquire_counts[i], ex_acquire_counts[i],
-					block_counts[i], spin_delay_counts[i]);
+					block_counts[i], spin_delay_counts[i],
+					dequeue_self_counts[i],
+					(double) block_time_us[i] / 1000.0);
 	}
 
 	LWLockRelease(0);
@@ -165,6 +212,80 @@ print_lwlock_stats(int code, Datum arg)
 #endif   /* LWLOCK_STATS */
 
 
+/*
+ * Atomic operations on the state word of a lock.  Without compiler support
+ * they are emulated with a spinlock of their own, distinct from the mutex,
+ * so that the wait queue code can use them while holding the mutex.
+ */
+#ifdef HAVE_GCC_INT_ATOMICS
+
+static inline bool
+LWLockStateCompareExchange(volatile LWLock *lock, uint32 *expected,
+						   uint32 newval)
+{
+	uint32		current;
+
+	current = __sync_val_compare_and_swap(&lock->state, *expected, newval);
+	if (current == *expected)
+		return true;
+	*expected = current;
+	return false;
+}
+
+static inline uint32
+LWLockStateSubFetch(volatile LWLock *lock, uint32 sub)
+{
+	return __sync_sub_and_fetch(&lock->state, sub);
+}
+
+static inline void
+LWLockStateSetFlags(volatile LWLock *lock, uint32 flags)
+{
+	(void) __sync_fetch_and_or(&lock->state, flags);
+}
+
+#else							/* !HAVE_GCC_INT_ATOMICS */
+
+static inline bool
+LWLockStateCompareExchange(volatile LWLock *lock, uint32 *expected,
+						   uint32 newval)
+{
+	bool		ret;
+
+	SpinLockAcquire(&lock->statelock);
+	ret = (lock->state == *expected);
+	if (ret)
+		lock->state = newval;
+	else
+		*expected = lock->state;
+	SpinLockRelease(&lock->statelock);
+	return ret;
+}
+
+static inline uint32
+LWLockStateSubFetch(volatile LWLock *lock, uint32 sub)
+{
+	uint32		result;
+
+	SpinLockAcquire(&lock->statelock);
+	lock->state -= sub;
+	result = lock->state;
+	SpinLockRelease(&lock->statelock);
+	return result;
+}
+
+static inline void
+LWLockStateSetFlags(volatile LWLock *lock, uint32 flags)
+{
+	SpinLockAcquire(&lock->statelock);
+	lock->state |= flags;
+	SpinLockRelease(&lock->statelock);
+}
+
+#endif   /* HAVE_GCC_INT_ATOMICS */
+
+
+
 /*
  * Compute number of LWLocks to allocate.
  */
@@ -189,20 +310,24 @@ NumLWLocks(void)
 	/* proc.c needs one for each backend or auxiliary process */
 	numLocks += MaxBackends + NUM_AUXILIARY_PROCS;
 
-	/* clog.c needs one per CLOG buffer */
-	numLocks += CLOGShmemBuffers();
+	/* clog.c needs one per CLOG buffer, and slru.c one per bank of them */
+	numLocks += CLOGShmemBuffers() + SLRU_NUM_BANKS(CLOGShmemBuffers());
 
 	/* subtrans.c needs one per SubTrans buffer */
-	numLocks += NUM_SUBTRANS_BUFFERS;
+	numLocks += NUM_SUBTRANS_BUFFERS + SLRU_NUM_BANKS(NUM_SUBTRANS_BUFFERS);
 
 	/* multixact.c needs two SLRU areas */
-	numLocks += NUM_MXACTOFFSET_BUFFERS + NUM_MXACTMEMBER_BUFFERS;
+	numLocks += NUM_MXACTOFFSET_BUFFERS + SLRU_NUM_BANKS(NUM_MXACTOFFSET_BUFFERS);
+	numLocks += NUM_MXACTMEMBER_BUFFERS + SLRU_NUM_BANKS(NUM_MXACTMEMBER_BUFFERS);
 
 	/* async.c needs one per Async buffer */
-	numLocks += NUM_ASYNC_BUFFERS;
+	numLocks += NUM_ASYNC_BUFFERS + SLRU_NUM_BANKS(NUM_ASYNC_BUFFERS);
 
 	/* predicate.c needs one per old serializable xid buffer */
-	numLocks += NUM_OLDSERXID_BUFFERS;
+	numLocks += NUM_OLDSERXID_BUFFERS + SLRU_NUM_BANKS(NUM_OLDSERXID_BUFFERS);
+
+	/* xlog.c needs one per WAL insertion lock */
+	numLocks += NUM_XLOGINSERT_LOCKS;
 
 	/*
 	 * Add any requested by loadable modules; for backwards-compatibility
@@ -284,10 +409,11 @@ CreateLWLocks(void)
 	 */
 	for (id = 0, lock = LWLockArray; id < numLocks; id++, lock++)
 	{
+		lock->lock.state = LW_FLAG_RELEASE_OK;
+#ifndef HAVE_GCC_INT_ATOMICS
+		SpinLockInit(&lock->lock.statelock);
+#endif
 		SpinLockInit(&lock->lock.mutex);
-		lock->lock.releaseOK = true;
-		lock->lock.exclusive = 0;
-		lock->lock.shared = 0;
 		lock->lock.head = NULL;
 		lock->lock.tail = NULL;
 	}
@@ -331,6 +457,346 @@ LWLockAssign(void)
 }
 
 
+/*
+ * LWLockAttemptLock - try to grab the lock in the given mode
+ *
+ * Returns true if the lock is already held by someone else so that the
+ * caller must wait, false if we got it.  Only the state word is touched.
+ */
+static bool
+LWLockAttemptLock(volatile LWLock *lock, LWLockMode mode)
+{
+	uint32		old_state;
+
+	Assert(mode == LW_EXCLUSIVE || mode == LW_SHARED);
+
+	old_state = lock->state;
+
+	for (;;)
+	{
+		uint32		desired_state = old_state;
+		bool		lock_free;
+
+		if (mode == LW_EXCLUSIVE)
+		{
+			lock_free = (old_state & LW_LOCK_MASK) == 0;
+			if (lock_free)
+				desired_state += LW_VAL_EXCLUSIVE;
+		}
+		else
+		{
+			lock_free = (old_state & LW_VAL_EXCLUSIVE) == 0;
+			if (lock_free)
+				desired_state += LW_VAL_SHARED;
+		}
+
+		/*
+		 * Even when the lock is not free the exchange is attempted with the
+		 * unchanged value, which tells us that our view of the state was
+		 * current when we decided to wait.
+		 */
+		if (LWLockStateCompareExchange(lock, &old_state, desired_state))
+			return !lock_free;
+	}
+}
+
+/*
+ * LWLockWaitListLock - take the spinlock protecting the wait queue
+ */
+static inline void
+LWLockWaitListLock(LWLockId lockid, volatile LWLock *lock)
+{
+#ifdef LWLOCK_STATS
+	spin_delay_counts[lockid] += SpinLockAcquire(&lock->mutex);
+#else
+	SpinLockAcquire(&lock->mutex);
+#endif
+}
+
+/*
+ * LWLockQueueSelf - add ourselves to the wait queue of a lock
+ *
+ * Backends waiting with LW_WAIT_UNTIL_FREE go to the head of the queue, as
+ * they don't compete for the lock and can be woken up along with anybody.
+ */
+static void
+LWLockQueueSelf(LWLockId lockid, volatile LWLock *lock, LWLockMode mode)
+{
+	PGPROC	   *proc = MyProc;
+
+	/*
+	 * If we don't have a PGPROC structure, there's no way to wait. This
+	 * should never occur, since MyProc should only be null during shared
+	 * memory initialization.
+	 */
+	if (proc == NULL)
+		elog(PANIC, "cannot wait without a PGPROC structure");
+
+	if (proc->lwWaiting)
+		elog(PANIC, "queueing for lock while waiting on another one");
+
+	LWLockWaitListLock(lockid, lock);
+
+	/* setting the flag is protected by the mutex */
+	LWLockStateSetFlags(lock, LW_FLAG_HAS_WAITERS);
+
+	proc->lwWaiting = true;
+	proc->lwWaitMode = mode;
+	if (mode == LW_WAIT_UNTIL_FREE)
+	{
+		proc->lwWaitLink = lock->head;
+		if (lock->head == NULL)
+			lock->tail = proc;
+		lock->head = proc;
+	}
+	else
+	{
+		proc->lwWaitLink = NULL;
+		if (lock->head == NULL)
+			lock->head = proc;
+		else
+			lock->tail->lwWaitLink = proc;
+		lock->tail = proc;
+	}
+
+	/* Can release the mutex now */
+	SpinLockRelease(&lock->mutex);
+}
+
+/*
+ * LWLockDequeueSelf - remove ourselves from the wait queue again
+ *
+ * Used when the second attempt to get the lock, done after queueing,
+ * succeeded.  If a releaser has already taken us off the queue, its wakeup
+ * is on the way and has to be absorbed here, so that it is not mistaken for
+ * a later one.
+ */
+static void
+LWLockDequeueSelf(LWLockId lockid, volatile LWLock *lock)
+{
+	PGPROC	   *proc = MyProc;
+	PGPROC	   *prev = NULL;
+	PGPROC	   *cur;
+
+#ifdef LWLOCK_STATS
+	dequeue_self_counts[lockid]++;
+#endif
+
+	LWLockWaitListLock(lockid, lock);
+
+	for (cur = lock->head; cur != NULL; prev = cur, cur = cur->lwWaitLink)
+	{
+		if (cur == proc)
+			break;
+	}
+
+	if (cur != NULL)
+	{
+		if (prev == NULL)
+			lock->head = proc->lwWaitLink;
+		else
+			prev->lwWaitLink = proc->lwWaitLink;
+		if (lock->tail == proc)
+			lock->tail = prev;
+		proc->lwWaitLink = NULL;
+
+		if (lock->head == NULL)
+		{
+			uint32		old_state = lock->state;
+
+			while (!LWLockStateCompareExchange(lock, &old_state,
+										old_state & ~LW_FLAG_HAS_WAITERS))
+				;
+		}
+	}
+
+	SpinLockRelease(&lock->mutex);
+
+	if (cur != NULL)
+		proc->lwWaiting = false;
+	else
+	{
+		int			extraWaits = 0;
+
+		/*
+		 * Somebody else dequeued us and has or will wake us up.  It also
+		 * cleared RELEASE_OK on our behalf, so set it again for the others.
+		 */
+		LWLockStateSetFlags(lock, LW_FLAG_RELEASE_OK);
+
+		for (;;)
+		{
+			/* "false" means cannot accept cancel/die interrupt here. */
+			PGSemaphoreLock(&proc->sem, false);
+			if (!proc->lwWaiting)
+				break;
+			extraWaits++;
+		}
+
+		/*
+		 * Fix the process wait semaphore's count for any absorbed wakeups.
+		 */
+		while (extraWaits-- > 0)
+			PGSemaphoreUnlock(&proc->sem);
+	}
+}
+
+/*
+ * LWLockWakeup - wake up the waiters that can go ahead now
+ *
+ * Called by the releaser once the lock is free, the queue has waiters and
+ * nobody woken up before is still on the way to retry.
+ */
+static void
+LWLockWakeup(LWLockId lockid, volatile LWLock *lock)
+{
+	PGPROC	   *wakeup = NULL;
+	PGPROC	   *wakeup_tail = NULL;
+	PGPROC	   *prev = NULL;
+	PGPROC	   *proc;
+	PGPROC	   *next;
+	bool		new_release_ok = true;
+	bool		wokeup_somebody = false;
+	uint32		old_state;
+	uint32		desired_state;
+
+	LWLockWaitListLock(lockid, lock);
+
+	/*
+	 * Wake up every backend waiting for the lock to become free, plus either
+	 * the first backend wanting it exclusively, or all those wanting it
+	 * shared up to that one.
+	 */
+	for (proc = lock->head; proc != NULL; proc = next)
+	{
+		next = proc->lwWaitLink;
+
+		if (wokeup_somebody && proc->lwWaitMode == LW_EXCLUSIVE)
+		{
+			prev = proc;
+			continue;
+		}
+
+		/* take proc off the queue, keeping prev */
+		if (prev == NULL)
+			lock->head = next;
+		else
+			prev->lwWaitLink = next;
+		if (lock->tail == proc)
+			lock->tail = prev;
+
+		proc->lwWaitLink = NULL;
+		if (wakeup == NULL)
+			wakeup = proc;
+		else
+			wakeup_tail->lwWaitLink = proc;
+		wakeup_tail = proc;
+
+		/*
+		 * Prevent additional wakeups until retryer gets to run. Backends
+		 * that are just waiting for the lock to become free don't retry
+		 * automatically.
+		 */
+		if (proc->lwWaitMode != LW_WAIT_UNTIL_FREE)
+		{
+			new_release_ok = false;
+			wokeup_somebody = true;
+		}
+
+		/* an exclusive waiter goes alone */
+		if (proc->lwWaitMode == LW_EXCLUSIVE)
+			break;
+	}
+
+	/* update the flags while the queue cannot change */
+	old_state = lock->state;
+	do
+	{
+		desired_state = old_state;
+		if (new_release_ok)
+			desired_state |= LW_FLAG_RELEASE_OK;
+		else
+			desired_state &= ~LW_FLAG_RELEASE_OK;
+		if (lock->head == NULL)
+			desired_state &= ~LW_FLAG_HAS_WAITERS;
+	} while (!LWLockStateCompareExchange(lock, &old_state, desired_state));
+
+	/* We are done updating shared state of the lock itself. */
+	SpinLockRelease(&lock->mutex);
+
+	/*
+	 * Awaken any waiters I removed from the queue.
+	 */
+	while (wakeup != NULL)
+	{
+		LOG_LWDEBUG("LWLockRelease", lockid, "release waiter");
+		proc = wakeup;
+		wakeup = proc->lwWaitLink;
+		proc->lwWaitLink = NULL;
+		/*
+		 * Guarantee that lwWaiting being unset only becomes visible once the
+		 * unlink from the link has completed. Otherwise the target backend
+		 * could be woken up for other reason and enqueue for a new lock - if
+		 * that happens before the list unlink happens, the list would end up
+		 * being corrupted.
+		 *
+		 * The barrier pairs with the SpinLockAcquire() when enqueing for
+		 * another lock.
+		 */
+		pg_write_barrier();
+		proc->lwWaiting = false;
+		PGSemaphoreUnlock(&proc->sem);
+	}
+}
+
+/*
+ * LWLockSleep - sleep until a releaser took us off the wait queue
+ *
+ * Since we share the process wait semaphore with the regular lock manager
+ * and ProcWaitForSignal, and we may need to acquire an LWLock while one of
+ * those is pending, it is possible that we get awakened for a reason other
+ * than being signaled by LWLockRelease.  If so, we wait again; the number of
+ * such signals is added to *extraWaits so that the caller can give them back
+ * once it is done.
+ */
+static void
+LWLockSleep(LWLockId lockid, LWLockMode mode, int *extraWaits)
+{
+	PGPROC	   *proc = MyProc;
+#ifdef LWLOCK_STATS
+	instr_time	start_time;
+	instr_time	end_time;
+
+	block_counts[lockid]++;
+	INSTR_TIME_SET_CURRENT(start_time);
+#endif
+
+	TRACE_POSTGRESQL_LWLOCK_WAIT_START(lockid, mode);
+#ifdef ADB
+	pgstat_report_wait_start(WAIT_EVENT_LWLOCK);
+#endif
+
+	for (;;)
+	{
+		/* "false" means cannot accept cancel/die interrupt here. */
+		PGSemaphoreLock(&proc->sem, false);
+		if (!proc->lwWaiting)
+			break;
+		(*extraWaits)++;
+	}
+
+#ifdef ADB
+	pgstat_report_wait_end();
+#endif
+	TRACE_POSTGRESQL_LWLOCK_WAIT_DONE(lockid, mode);
+
+#ifdef LWLOCK_STATS
+	INSTR_TIME_SET_CURRENT(end_time);
+	INSTR_TIME_SUBTRACT(end_time, start_time);
+	block_time_us[lockid] += INSTR_TIME_GET_MICROSEC(end_time);
+#endif
+}
+
 /*
  * LWLockAcquire - acquire a lightweight lock in the specified mode
  *
@@ -343,7 +809,6 @@ LWLockAcquire(LWLockId lockid, LWLockMode mode)
 {
 	volatile LWLock *lock = &(LWLockArray[lockid].lock);
 	PGPROC	   *proc = MyProc;
-	bool		retry = false;
 	int			extraWaits = 0;
 
 	PRINT_LWDEBUG("LWLockAcquire", lockid, lock);
@@ -397,104 +862,48 @@ LWLockAcquire(LWLockId lockid, LWLockMode mode)
 	{
 		bool		mustwait;
 
-		/* Acquire mutex.  Time spent holding mutex should be short! */
-#ifdef LWLOCK_STATS
-		spin_delay_counts[lockid] += SpinLockAcquire(&lock->mutex);
-#else
-		SpinLockAcquire(&lock->mutex);
-#endif
-
-		/* If retrying, allow LWLockRelease to release waiters again */
-		if (retry)
-			lock->releaseOK = true;
-
 		/* If I can get the lock, do so quickly. */
-		if (mode == LW_EXCLUSIVE)
-		{
-			if (lock->exclusive == 0 && lock->shared == 0)
-			{
-				lock->exclusive++;
-				mustwait = false;
-			}
-			else
-				mustwait = true;
-		}
-		else
-		{
-			if (lock->exclusive == 0)
-			{
-				lock->shared++;
-				mustwait = false;
-			}
-			else
-				mustwait = true;
-		}
+		mustwait = LWLockAttemptLock(lock, mode);
 
 		if (!mustwait)
+		{
+			LOG_LWDEBUG("LWLockAcquire", lockid, "immediately acquired lock");
 			break;				/* got the lock */
+		}
 
 		/*
-		 * Add myself to wait queue.
-		 *
-		 * If we don't have a PGPROC structure, there's no way to wait. This
-		 * should never occur, since MyProc should only be null during shared
-		 * memory initialization.
+		 * Add myself to wait queue, then try once more: the holder may have
+		 * released the lock before it could see us in the queue.
 		 */
-		if (proc == NULL)
-			elog(PANIC, "cannot wait without a PGPROC structure");
+		LWLockQueueSelf(lockid, lock, mode);
 
-		proc->lwWaiting = true;
-		proc->lwWaitMode = mode;
-		proc->lwWaitLink = NULL;
-		if (lock->head == NULL)
-			lock->head = proc;
-		else
-			lock->tail->lwWaitLink = proc;
-		lock->tail = proc;
+		mustwait = LWLockAttemptLock(lock, mode);
 
-		/* Can release the mutex now */
-		SpinLockRelease(&lock->mutex);
-
-		/*
-		 * Wait until awakened.
-		 *
-		 * Since we share the process wait semaphore with the regular lock
-		 * manager and ProcWaitForSignal, and we may need to acquire an LWLock
-		 * while one of those is pending, it is possible that we get awakened
-		 * for a reason other than being signaled by LWLockRelease. If so,
-		 * loop back and wait again.  Once we've gotten the LWLock,
-		 * re-increment the sema by the number of additional signals received,
-		 * so that the lock manager or signal manager will see the received
-		 * signal when it next waits.
-		 */
-		LOG_LWDEBUG("LWLockAcquire", lockid, "waiting");
-
-#ifdef LWLOCK_STATS
-		block_counts[lockid]++;
-#endif
-
-		TRACE_POSTGRESQL_LWLOCK_WAIT_START(lockid, mode);
-
-		for (;;)
+		if (!mustwait)
 		{
-			/* "false" means cannot accept cancel/die interrupt here. */
-			PGSemaphoreLock(&proc->sem, false);
-			if (!proc->lwWaiting)
-				break;
-			extraWaits++;
+			LOG_LWDEBUG("LWLockAcquire", lockid, "acquired, undoing queue");
+			LWLockDequeueSelf(lockid, lock);
+			break;
 		}
 
-		TRACE_POSTGRESQL_LWLOCK_WAIT_DONE(lockid, mode);
+		/*
+		 * Wait until awakened.  Once we've gotten the LWLock, re-increment
+		 * the sema by the number of additional signals received, so that the
+		 * lock manager or signal manager will see the received signal when
+		 * it next waits.
+		 */
+		LOG_LWDEBUG("LWLockAcquire", lockid, "waiting");
+
+		LWLockSleep(lockid, mode, &extraWaits);
 
 		LOG_LWDEBUG("LWLockAcquire", lockid, "awakened");
 
+		/* Retrying, allow LWLockRelease to release waiters again. */
+		LWLockStateSetFlags(lock, LW_FLAG_RELEASE_OK);
+
 		/* Now loop back and try to acquire lock again. */
-		retry = true;
 	}
 
-	/* We are done updating shared state of the lock itself. */
-	SpinLockRelease(&lock->mutex);
-
 	TRACE_POSTGRESQL_LWLOCK_ACQUIRE(lockid, mode);
 
 	/* Add lock to list of locks held by this backend */
@@ -533,33 +942,8 @@ LWLockConditionalAcquire(LWLockId lockid, LWLockMode mode)
 	 */
 	HOLD_INTERRUPTS();
 
-	/* Acquire mutex.  Time spent holding mutex should be short! */
-	SpinLockAcquire(&lock->mutex);
-
-	/* If I can get the lock, do so quickly. */
-	if (mode == LW_EXCLUSIVE)
-	{
-		if (lock->exclusive == 0 && lock->shared == 0)
-		{
-			lock->exclusive++;
-			mustwait = false;
-		}
-		else
-			mustwait = true;
-	}
-	else
-	{
-		if (lock->exclusive == 0)
-		{
-			lock->shared++;
-			mustwait = false;
-		}
-		else
-			mustwait = true;
-	}
-
-	/* We are done updating shared state of the lock itself. */
-	SpinLockRelease(&lock->mutex);
+	/* Check for the lock */
+	mustwait = LWLockAttemptLock(lock, mode);
 
 	if (mustwait)
 	{
@@ -619,84 +1003,196 @@ LWLockAcquireOrWait(LWLockId lockid, LWLockMode mode)
 	 */
 	HOLD_INTERRUPTS();
 
-	/* Acquire mutex.  Time spent holding mutex should be short! */
-	SpinLockAcquire(&lock->mutex);
+	/*
+	 * NB: We're using nearly the same twice-in-a-row lock acquisition
+	 * protocol as LWLockAcquire(). Check its comments for details.
+	 */
+	mustwait = LWLockAttemptLock(lock, mode);
 
-	/* If I can get the lock, do so quickly. */
-	if (mode == LW_EXCLUSIVE)
+	if (mustwait)
 	{
-		if (lock->exclusive == 0 && lock->shared == 0)
+		LWLockQueueSelf(lockid, lock, LW_WAIT_UNTIL_FREE);
+
+		mustwait = LWLockAttemptLock(lock, mode);
+
+		if (mustwait)
 		{
-			lock->exclusive++;
-			mustwait = false;
+			/*
+			 * Wait until awakened.  Like in LWLockAcquire, be prepared for
+			 * bogus wakups, because we share the semaphore with
+			 * ProcWaitForSignal.
+			 */
+			LOG_LWDEBUG("LWLockAcquireOrWait", lockid, "waiting");
+
+			LWLockSleep(lockid, mode, &extraWaits);
+
+			LOG_LWDEBUG("LWLockAcquireOrWait", lockid, "awakened");
 		}
 		else
-			mustwait = true;
-	}
-	else
-	{
-		if (lock->exclusive == 0)
 		{
-			lock->shared++;
-			mustwait = false;
+			LOG_LWDEBUG("LWLockAcquireOrWait", lockid, "acquired, undoing queue");
+			LWLockDequeueSelf(lockid, lock);
 		}
-		else
-			mustwait = true;
 	}
 
+	/*
+	 * Fix the process wait semaphore's count for any absorbed wakeups.
+	 */
+	while (extraWaits-- > 0)
+		PGSemaphoreUnlock(&proc->sem);
+
 	if (mustwait)
 	{
-		/*
-		 * Add myself to wait queue.
-		 *
-		 * If we don't have a PGPROC structure, there's no way to wait.  This
-		 * should never occur, since MyProc should only be null during shared
-		 * memory initialization.
-		 */
-		if (proc == NULL)
-			elog(PANIC, "cannot wait without a PGPROC structure");
+		/* Failed to get lock, so release interrupt holdoff */
+		RESUME_INTERRUPTS();
+		LOG_LWDEBUG("LWLockAcquireOrWait", lockid, "failed");
+		TRACE_POSTGRESQL_LWLOCK_WAIT_UNTIL_FREE_FAIL(lockid, mode);
+	}
+	else
+	{
+		/* Add lock to list of locks held by this backend */
+		held_lwlocks[num_held_lwlocks++] = lockid;
+		TRACE_POSTGRESQL_LWLOCK_WAIT_UNTIL_FREE(lockid, mode);
+	}
 
-		proc->lwWaiting = true;
-		proc->lwWaitMode = LW_WAIT_UNTIL_FREE;
-		proc->lwWaitLink = NULL;
-		if (lock->head == NULL)
-			lock->head = proc;
-		else
-			lock->tail->lwWaitLink = proc;
-		lock->tail = proc;
+	return !mustwait;
+}
 
-		/* Can release the mutex now */
-		SpinLockRelease(&lock->mutex);
+/*
+ * Does the lwlock in its current state need to wait for the variable value to
+ * change?
+ *
+ * If we don't need to wait, and it's because the value of the variable has
+ * changed, store the current value in newval.
+ *
+ * *result is set to true if the lock was free, and false otherwise.
+ */
+static bool
+LWLockConflictsWithVar(LWLockId lockid, volatile LWLock *lock,
+					   volatile uint64 *valptr, uint64 oldval, uint64 *newval,
+					   bool *result)
+{
+	uint64		value;
 
-		/*
-		 * Wait until awakened.  Like in LWLockAcquire, be prepared for bogus
-		 * wakups, because we share the semaphore with ProcWaitForSignal.
-		 */
-		LOG_LWDEBUG("LWLockAcquireOrWait", lockid, "waiting");
+	/*
+	 * Test first to see if the lock is free right now.  Only an exclusive
+	 * holder can set the variable, so a shared holder does not count.
+	 */
+	if ((lock->state & LW_VAL_EXCLUSIVE) == 0)
+	{
+		*result = true;
+		return false;
+	}
+
+	*result = false;
+
+	/*
+	 * Read value using the lwlock's wait list lock, as we can't generally
+	 * rely on atomic 64 bit reads/stores.
+	 */
+	LWLockWaitListLock(lockid, lock);
+	value = *valptr;
+	SpinLockRelease(&lock->mutex);
+
+	if (value != oldval)
+	{
+		*newval = value;
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * LWLockWaitForVar - Wait until lock is free, or a variable is updated.
+ *
+ * If the lock is held and *valptr equals oldval, waits until the lock is
+ * either freed, or the lock holder updates *valptr by calling
+ * LWLockUpdateVar.  If the lock is free on exit (immediately or after
+ * waiting), returns true.  If the lock is still held, but *valptr no longer
+ * matches oldval, returns false and sets *newval to the current value in
+ * *valptr.
+ *
+ * Note: this function ignores shared lock holders; if the lock is held
+ * in shared mode, returns 'true'.
+ */
+bool
+LWLockWaitForVar(LWLockId lockid, volatile uint64 *valptr, uint64 oldval,
+				 uint64 *newval)
+{
+	volatile LWLock *lock = &(LWLockArray[lockid].lock);
+	PGPROC	   *proc = MyProc;
+	int			extraWaits = 0;
+	bool		result = false;
+
+	PRINT_LWDEBUG("LWLockWaitForVar", lockid, lock);
 
 #ifdef LWLOCK_STATS
-		block_counts[lockid]++;
+	/* Set up local count state first time through in a given process */
+	if (counts_for_pid != MyProcPid)
+		init_lwlock_stats();
 #endif
 
-		TRACE_POSTGRESQL_LWLOCK_WAIT_START(lockid, mode);
+	/*
+	 * Lock out cancel/die interrupts while we sleep on the lock.  There is no
+	 * cleanup mechanism to remove us from the wait queue if we got
+	 * interrupted.
+	 */
+	HOLD_INTERRUPTS();
 
-		for (;;)
+	/*
+	 * Loop here to check the lock's status after each time we are signaled.
+	 */
+	for (;;)
+	{
+		bool		mustwait;
+
+		mustwait = LWLockConflictsWithVar(lockid, lock, valptr, oldval,
+										  newval, &result);
+
+		if (!mustwait)
+			break;				/* the lock was free or value didn't match */
+
+		/*
+		 * Add myself to wait queue.  Note that this is racy, somebody else
+		 * could wakeup before we're finished queuing.  We're using nearly the
+		 * same twice-in-a-row lock acquisition protocol as LWLockAcquire();
+		 * the only difference is that we also have to check the variable's
+		 * value when checking the state of the lock.
+		 */
+		LWLockQueueSelf(lockid, lock, LW_WAIT_UNTIL_FREE);
+
+		/*
+		 * Set RELEASE_OK flag, to make sure we get woken up as soon as the
+		 * lock is released.
+		 */
+		LWLockStateSetFlags(lock, LW_FLAG_RELEASE_OK);
+
+		/*
+		 * We're now guaranteed to be woken up if necessary.  Recheck the lock
+		 * and variable's state.
+		 */
+		mustwait = LWLockConflictsWithVar(lockid, lock, valptr, oldval,
+										  newval, &result);
+
+		/* Ok, no conflict after we queued ourselves.  Undo queueing. */
+		if (!mustwait)
 		{
-			/* "false" means cannot accept cancel/die interrupt here. */
-			PGSemaphoreLock(&proc->sem, false);
-			if (!proc->lwWaiting)
-				break;
-			extraWaits++;
+			LOG_LWDEBUG("LWLockWaitForVar", lockid, "free, undoing queue");
+			LWLockDequeueSelf(lockid, lock);
+			break;
 		}
 
-		TRACE_POSTGRESQL_LWLOCK_WAIT_DONE(lockid, mode);
+		/*
+		 * Wait until awakened, by a release or by an update of the variable.
+		 */
+		LOG_LWDEBUG("LWLockWaitForVar", lockid, "waiting");
+
+		LWLockSleep(lockid, LW_EXCLUSIVE, &extraWaits);
 
-		LOG_LWDEBUG("LWLockAcquireOrWait", lockid, "awakened");
-	}
-	else
-	{
-		/* We are done updating shared state of the lock itself. */
-		SpinLockRelease(&lock->mutex);
+		LOG_LWDEBUG("LWLockWaitForVar", lockid, "awakened");
+
+		/* Now loop back and check the status of the lock again. */
 	}
 
 	/*
@@ -705,21 +1201,76 @@ LWLockAcquireOrWait(LWLockId lockid, LWLockMode mode)
 	while (extraWaits-- > 0)
 		PGSemaphoreUnlock(&proc->sem);
 
-	if (mustwait)
+	/*
+	 * Now okay to allow cancel/die interrupts.
+	 */
+	RESUME_INTERRUPTS();
+
+	return result;
+}
+
+/*
+ * LWLockUpdateVar - Update a variable and wake up waiters atomically
+ *
+ * Sets *valptr to 'val', and wakes up all processes waiting for us with
+ * LWLockWaitForVar().  Setting the value and waking up the processes happen
+ * atomically so that any process calling LWLockWaitForVar() on the same lock
+ * is guaranteed to see the new value, and act accordingly.
+ *
+ * The caller must be holding the lock in exclusive mode.
+ */
+void
+LWLockUpdateVar(LWLockId lockid, volatile uint64 *valptr, uint64 val)
+{
+	volatile LWLock *lock = &(LWLockArray[lockid].lock);
+	PGPROC	   *wakeup = NULL;
+	PGPROC	   *wakeup_tail = NULL;
+	PGPROC	   *proc;
+
+	PRINT_LWDEBUG("LWLockUpdateVar", lockid, lock);
+
+	LWLockWaitListLock(lockid, lock);
+
+	Assert(lock->state & LW_VAL_EXCLUSIVE);
+
+	/* Update the lock's value */
+	*valptr = val;
+
+	/*
+	 * See if there are any LW_WAIT_UNTIL_FREE waiters that need to be woken
+	 * up.  They are always in the front of the queue.
+	 */
+	while (lock->head != NULL && lock->head->lwWaitMode == LW_WAIT_UNTIL_FREE)
 	{
-		/* Failed to get lock, so release interrupt holdoff */
-		RESUME_INTERRUPTS();
-		LOG_LWDEBUG("LWLockAcquireOrWait", lockid, "failed");
-		TRACE_POSTGRESQL_LWLOCK_WAIT_UNTIL_FREE_FAIL(lockid, mode);
+		proc = lock->head;
+		lock->head = proc->lwWaitLink;
+		if (lock->tail == proc)
+			lock->tail = NULL;
+
+		proc->lwWaitLink = NULL;
+		if (wakeup == NULL)
+			wakeup = proc;
+		else
+			wakeup_tail->lwWaitLink = proc;
+		wakeup_tail = proc;
 	}
-	else
+
+	/* We are done updating shared state of the lock itself. */
+	SpinLockRelease(&lock->mutex);
+
+	/*
+	 * Awaken any waiters I removed from the queue.
+	 */
+	while (wakeup != NULL)
 	{
-		/* Add lock to list of locks held by this backend */
-		held_lwlocks[num_held_lwlocks++] = lockid;
-		TRACE_POSTGRESQL_LWLOCK_WAIT_UNTIL_FREE(lockid, mode);
+		proc = wakeup;
+		wakeup = proc->lwWaitLink;
+		proc->lwWaitLink = NULL;
+		/* check comment in LWLockWakeup() about this barrier */
+		pg_write_barrier();
+		proc->lwWaiting = false;
+		PGSemaphoreUnlock(&proc->sem);
 	}
-
-	return !mustwait;
 }
 
 /*
@@ -729,8 +1280,7 @@ void
 LWLockRelease(LWLockId lockid)
 {
 	volatile LWLock *lock = &(LWLockArray[lockid].lock);
-	PGPROC	   *head;
-	PGPROC	   *proc;
+	uint32		new_state;
 	int			i;
 
 	PRINT_LWDEBUG("LWLockRelease", lockid, lock);
@@ -750,111 +1300,59 @@ LWLockRelease(LWLockId lockid)
 	for (; i < num_held_lwlocks; i++)
 		held_lwlocks[i] = held_lwlocks[i + 1];
 
-	/* Acquire mutex.  Time spent holding mutex should be short! */
-	SpinLockAcquire(&lock->mutex);
-
-	/* Release my hold on lock */
-	if (lock->exclusive > 0)
-		lock->exclusive--;
+	/*
+	 * Release my hold on lock.  We don't remember the mode we hold it in, but
+	 * the exclusive bit can only be set if the holder is us.
+	 */
+	if (lock->state & LW_VAL_EXCLUSIVE)
+		new_state = LWLockStateSubFetch(lock, LW_VAL_EXCLUSIVE);
 	else
 	{
-		Assert(lock->shared > 0);
-		lock->shared--;
+		Assert(lock->state & (LW_VAL_EXCLUSIVE - 1));
+		new_state = LWLockStateSubFetch(lock, LW_VAL_SHARED);
 	}
 
+	TRACE_POSTGRESQL_LWLOCK_RELEASE(lockid);
+
 	/*
 	 * See if I need to awaken any waiters.  If I released a non-last shared
 	 * hold, there cannot be anything to do.  Also, do not awaken any waiters
 	 * if someone has already awakened waiters that haven't yet acquired the
 	 * lock.
 	 */
-	head = lock->head;
-	if (head != NULL)
+	if ((new_state & (LW_FLAG_HAS_WAITERS | LW_FLAG_RELEASE_OK)) ==
+		(LW_FLAG_HAS_WAITERS | LW_FLAG_RELEASE_OK) &&
+		(new_state & LW_LOCK_MASK) == 0)
 	{
-		if (lock->exclusive == 0 && lock->shared == 0 && lock->releaseOK)
-		{
-			/*
-			 * Remove the to-be-awakened PGPROCs from the queue.
-			 */
-			bool		releaseOK = true;
-
-			proc = head;
-
-			/*
-			 * First wake up any backends that want to be woken up without
-			 * acquiring the lock.
-			 */
-			while (proc->lwWaitMode == LW_WAIT_UNTIL_FREE && proc->lwWaitLink)
-				proc = proc->lwWaitLink;
-
-			/*
-			 * If the front waiter wants exclusive lock, awaken him only.
-			 * Otherwise awaken as many waiters as want shared access.
-			 */
-			if (proc->lwWaitMode != LW_EXCLUSIVE)
-			{
-				while (proc->lwWaitLink != NULL &&
-					   proc->lwWaitLink->lwWaitMode != LW_EXCLUSIVE)
-				{
-					if (proc->lwWaitMode != LW_WAIT_UNTIL_FREE)
-						releaseOK = false;
-					proc = proc->lwWaitLink;
-				}
-			}
-			/* proc is now the last PGPROC to be released */
-			lock->head = proc->lwWaitLink;
-			proc->lwWaitLink = NULL;
-
-			/*
-			 * Prevent additional wakeups until retryer gets to run. Backends
-			 * that are just waiting for the lock to become free don't retry
-			 * automatically.
-			 */
-			if (proc->lwWaitMode != LW_WAIT_UNTIL_FREE)
-				releaseOK = false;
-
-			lock->releaseOK = releaseOK;
-		}
-		else
-		{
-			/* lock is still held, can't awaken anything */
-			head = NULL;
-		}
+		LOG_LWDEBUG("LWLockRelease", lockid, "releasing waiters");
+		LWLockWakeup(lockid, lock);
 	}
 
-	/* We are done updating shared state of the lock itself. */
-	SpinLockRelease(&lock->mutex);
-
-	TRACE_POSTGRESQL_LWLOCK_RELEASE(lockid);
-
 	/*
-	 * Awaken any waiters I removed from the queue.
+	 * Now okay to allow cancel/die interrupts.
 	 */
-	while (head != NULL)
-	{
-		LOG_LWDEBUG("LWLockRelease", lockid, "release waiter");
-		proc = head;
-		head = proc->lwWaitLink;
-		proc->lwWaitLink = NULL;
-		/*
-		 * Guarantee that lwWaiting being unset only becomes visible once the
-		 * unlink from the link has completed. Otherwise the target backend
-		 * could be woken up for other reason and enqueue for a new lock - if
-		 * that happens before the list unlink happens, the list would end up
-		 * being corrupted.
-		 *
-		 * The barrier pairs with the SpinLockAcquire() when enqueing for
-		 * another lock.
-		 */
-		pg_write_barrier();
-		proc->lwWaiting = false;
-		PGSemaphoreUnlock(&proc->sem);
-	}
+	RESUME_INTERRUPTS();
+}
+
+
+/*
+ * LWLockReleaseClearVar - release a previously acquired lock, reset variable
+ */
+void
+LWLockReleaseClearVar(LWLockId lockid, volatile uint64 *valptr, uint64 val)
+{
+	volatile LWLock *lock = &(LWLockArray[lockid].lock);
 
 	/*
-	 * Now okay to allow cancel/die interrupts.
+	 * Set the variable's value before releasing the lock, that prevents
+	 * a race condition wherein a new locker acquires the lock, but hasn't yet
+	 * set the variables value.
 	 */
-	RESUME_INTERRUPTS();
+	LWLockWaitListLock(lockid, lock);
+	*valptr = val;
+	SpinLockRelease(&lock->mutex);
+
+	LWLockRelease(lockid);
 }
 
 
@@ -93,6 +93,8 @@ static volatile DeadLockState deadlock_state = DS_NOT_YET_CHECKED;
 static void RemoveProcFromArray(int code, Datum arg);
 static void ProcKill(int code, Datum arg);
 static void AuxiliaryProcKill(int code, Datum arg);
+static Size FastPathLockPerProcSize(void);
+static Size FastPathLockShmemSize(void);
 
 
 /*
@@ -118,9 +120,33 @@ ProcGlobalShmemSize(void)
 	size = add_size(size, mul_size(NUM_AUXILIARY_PROCS, sizeof(PGXACT)));
 	size = add_size(size, mul_size(max_prepared_xacts, sizeof(PGXACT)));
 
+	/* fast-path lock arrays */
+	size = add_size(size, FastPathLockShmemSize());
+
 	return size;
 }
 
+/*
+ * Size of the fast-path lock arrays of one PGPROC; the number of groups is
+ * only known at run time, so they can't be part of the struct itself.
+ */
+static Size
+FastPathLockPerProcSize(void)
+{
+	return add_size(mul_size(FastPathLockGroupsPerBackend, sizeof(uint64)),
+					mul_size(FastPathLockSlotsPerBackend(), sizeof(Oid)));
+}
+
+/*
+ * Report shared-memory space needed by the fast-path lock arrays.
+ */
+static Size
+FastPathLockShmemSize(void)
+{
+	return mul_size(MaxBackends + NUM_AUXILIARY_PROCS + max_prepared_xacts,
+					FastPathLockPerProcSize());
+}
+
 /*
  * Report number of semaphores needed by InitProcGlobal.
  */
@@ -165,6 +191,7 @@ InitProcGlobal(void)
 {
 	PGPROC	   *procs;
 	PGXACT	   *pgxacts;
+	char	   *fpPtr;
 	int			i,
 				j;
 	bool		found;
@@ -220,10 +247,27 @@ InitProcGlobal(void)
 	MemSet(pgxacts, 0, TotalProcs * sizeof(PGXACT));
 	ProcGlobal->allPgXact = pgxacts;
 
+	/*
+	 * Allocate the fast-path lock arrays of all the PGPROCs in one chunk.
+	 * The uint64 lock bits of each PGPROC come first, so they stay aligned.
+	 */
+	fpPtr = (char *) ShmemAlloc(FastPathLockShmemSize());
+	if (!fpPtr)
+		ereport(FATAL,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("out of shared memory")));
+	MemSet(fpPtr, 0, FastPathLockShmemSize());
+
 	for (i = 0; i < TotalProcs; i++)
 	{
 		/* Common initialization for all PGPROCs, regardless of type. */
 
+		/* Point the PGPROC at its part of the fast-path lock arrays. */
+		procs[i].fpLockBits = (uint64 *) fpPtr;
+		procs[i].fpRelId = (Oid *) (fpPtr + FastPathLockGroupsPerBackend *
+									sizeof(uint64));
+		fpPtr += FastPathLockPerProcSize();
+
 		/*
 		 * Set up per-PGPROC semaphore, latch, and backendLock. Prepared xact
 		 * dummy PGPROCs don't need these though - they're never associated
@@ -407,6 +451,9 @@ InitProcess(void)
 	if (IsAutoVacuumWorkerProcess())
 		MyPgXact->vacuumFlags |= PROC_IS_AUTOVACUUM;
 	MyProc->lwWaiting = false;
+#ifdef ADB
+	MyProc->waitEvent = 0;
+#endif
 	MyProc->lwWaitMode = 0;
 	MyProc->lwWaitLink = NULL;
 	MyProc->waitLock = NULL;
@@ -581,6 +628,9 @@ InitAuxiliaryProcess(void)
 	MyPgXact->delayChkpt = false;
 	MyPgXact->vacuumFlags = 0;
 	MyProc->lwWaiting = false;
+#ifdef ADB
+	MyProc->waitEvent = 0;
+#endif
 	MyProc->lwWaitMode = 0;
 	MyProc->lwWaitLink = NULL;
 	MyProc->waitLock = NULL;
@@ -0,0 +1,18 @@
+/*-------------------------------------------------------------------------
+ *
+ * seqlock.c
+ *	  Out of line copies of the sequence counter routines.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/storage/lmgr/seqlock.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+/* See seqlock.h */
+#define SEQLOCK_INCLUDE_DEFINITIONS
+
+#include "storage/seqlock.h"
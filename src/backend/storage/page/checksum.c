@@ -15,9 +15,77 @@
 
 #include "storage/checksum.h"
 
+#ifdef ADB
+/*
+ * The checksum only vectorizes well with a 32-bit by 32-bit multiplication,
+ * which x86-64 CPUs have from SSE4.1 on (pmulld) but the x86-64 baseline the
+ * backend is compiled for has not.  Copies of pg_checksum_block() are also
+ * compiled for SSE4.1 and AVX2, which works on 8 of the partial checksums
+ * at a time, and the first call chooses the one the CPU supports.  Other
+ * architectures, like ARM with NEON, vectorize with CFLAGS_VECTOR alone.
+ */
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__) && \
+	(__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define USE_CHECKSUM_CHOOSE
+#endif
+
+#ifdef USE_CHECKSUM_CHOOSE
+static uint32 pg_checksum_block_choose(char *data, uint32 size);
+
+static uint32 (*pg_checksum_block_ptr) (char *data, uint32 size) =
+	pg_checksum_block_choose;
+
+#define PG_CHECKSUM_BLOCK(data, size) pg_checksum_block_ptr(data, size)
+
+/* have every copy be compiled for its own instructions */
+static inline uint32 pg_checksum_block(char *data, uint32 size)
+	__attribute__((always_inline));
+#endif
+#endif   /* ADB */
+
 /*
  * The actual code is in storage/checksum_impl.h.  This is done so that
  * external programs can incorporate the checksum code by #include'ing
  * that file from the exported Postgres headers.  (Compare our CRC code.)
  */
 #include "storage/checksum_impl.h"
+
+#ifdef USE_CHECKSUM_CHOOSE
+static uint32
+pg_checksum_block_generic(char *data, uint32 size)
+{
+	return pg_checksum_block(data, size);
+}
+
+__attribute__((target("sse4.1")))
+static uint32
+pg_checksum_block_sse41(char *data, uint32 size)
+{
+	return pg_checksum_block(data, size);
+}
+
+__attribute__((target("avx2")))
+static uint32
+pg_checksum_block_avx2(char *data, uint32 size)
+{
+	return pg_checksum_block(data, size);
+}
+
+/*
+ * Choose the block checksum for the CPU on the first call, all of them give
+ * the same result.
+ */
+static uint32
+pg_checksum_block_choose(char *data, uint32 size)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		pg_checksum_block_ptr = pg_checksum_block_avx2;
+	else if (__builtin_cpu_supports("sse4.1"))
+		pg_checksum_block_ptr = pg_checksum_block_sse41;
+	else
+		pg_checksum_block_ptr = pg_checksum_block_generic;
+
+	return pg_checksum_block_ptr(data, size);
+}
+#endif   /* USE_CHECKSUM_CHOOSE */
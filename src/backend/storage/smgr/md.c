@@ -613,6 +613,7 @@ mdclose(SMgrRelation reln, ForkNumber forknum)
 		return;
 
 	reln->md_fd[forknum] = NULL;	/* prevent dangling pointer after error */
+	reln->md_seg_hint[forknum] = NULL;
 
 	while (v != NULL)
 	{
@@ -647,6 +648,49 @@ mdprefetch(SMgrRelation reln, ForkNumber forknum, BlockNumber blocknum)
 #endif   /* USE_PREFETCH */
 }
 
+/*
+ *	mdwriteback() -- Tell the kernel to write pages back to storage.
+ *
+ * This accepts a range of blocks because flushing several pages at once is
+ * considerably more efficient than doing so individually.  Segments that
+ * have been removed meanwhile are silently skipped.
+ */
+void
+mdwriteback(SMgrRelation reln, ForkNumber forknum,
+			BlockNumber blocknum, BlockNumber nblocks)
+{
+	while (nblocks > 0)
+	{
+		BlockNumber nflush = nblocks;
+		off_t		seekpos;
+		MdfdVec    *v;
+		int			segnum_start,
+					segnum_end;
+
+		v = _mdfd_getseg(reln, forknum, blocknum, true /* not used */ ,
+						 EXTENSION_RETURN_NULL);
+		if (!v)
+			return;
+
+		/* compute offset inside the current segment */
+		segnum_start = blocknum / RELSEG_SIZE;
+
+		/* compute number of desired writes within the current segment */
+		segnum_end = (blocknum + nblocks - 1) / RELSEG_SIZE;
+		if (segnum_start != segnum_end)
+			nflush = RELSEG_SIZE - (blocknum % ((BlockNumber) RELSEG_SIZE));
+
+		Assert(nflush >= 1);
+		Assert(nflush <= nblocks);
+
+		seekpos = (off_t) BLCKSZ *(blocknum % ((BlockNumber) RELSEG_SIZE));
+
+		FileWriteback(v->mdfd_vfd, seekpos, (off_t) BLCKSZ * nflush);
+
+		nblocks -= nflush;
+		blocknum += nflush;
+	}
+}
 
 /*
  *	mdread() -- Read the specified block from a relation.
@@ -878,6 +922,9 @@ mdtruncate(SMgrRelation reln, ForkNumber forknum, BlockNumber nblocks)
 	if (nblocks == curnblk)
 		return;					/* no work */
 
+	/* the segments we drop might be the hint */
+	reln->md_seg_hint[forknum] = NULL;
+
 	v = mdopen(reln, forknum, EXTENSION_FAIL);
 
 	priorblocks = 0;
@@ -1707,15 +1754,26 @@ static MdfdVec *
 _mdfd_getseg(SMgrRelation reln, ForkNumber forknum, BlockNumber blkno,
 			 bool skipFsync, ExtensionBehavior behavior)
 {
-	MdfdVec    *v = mdopen(reln, forknum, behavior);
+	MdfdVec    *v = reln->md_seg_hint[forknum];
 	BlockNumber targetseg;
 	BlockNumber nextsegno;
 
-	if (!v)
-		return NULL;			/* only possible if EXTENSION_RETURN_NULL */
-
 	targetseg = blkno / ((BlockNumber) RELSEG_SIZE);
-	for (nextsegno = 1; nextsegno <= targetseg; nextsegno++)
+
+	/*
+	 * Walking the chain from the first segment costs one step per gigabyte
+	 * of the relation, so start from the segment we found last time if that
+	 * is not past the target.  Consecutive accesses mostly stay in one
+	 * segment or move to the next one.
+	 */
+	if (v == NULL || v->mdfd_segno > targetseg)
+	{
+		v = mdopen(reln, forknum, behavior);
+		if (!v)
+			return NULL;		/* only possible if EXTENSION_RETURN_NULL */
+	}
+
+	for (nextsegno = v->mdfd_segno + 1; nextsegno <= targetseg; nextsegno++)
 	{
 		Assert(nextsegno == v->mdfd_segno + 1);
 
@@ -1767,6 +1825,8 @@ _mdfd_getseg(SMgrRelation reln, ForkNumber forknum, BlockNumber blkno,
 		}
 		v = v->mdfd_chain;
 	}
+
+	reln->md_seg_hint[forknum] = v;
 	return v;
 }
 
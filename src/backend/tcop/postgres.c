@@ -108,6 +108,9 @@
 #include "pgxc/poolutils.h"
 #include "catalog/adb_ha_sync_log.h"
 #include "nodes/nodeFuncs.h"
+#include "pgxc/globaldeadlock.h"
+#include "utils/mcxtreport.h"
+#include "utils/sharedplancache.h"
 #endif /* ADB */
 #ifdef ADBMGRD
 #	include "mgr/mgr_agent.h"
@@ -150,6 +153,11 @@ int			max_stack_depth = 100;
 /* wait N seconds to allow attach from a debugger */
 int			PostAuthDelay = 0;
 
+#ifdef ADB
+/* queryId of the Coordinator statement the current query runs for, or 0 */
+uint32		CoordinatorQueryId = 0;
+#endif
+
 /* ----------------
  *		private variables
  * ----------------
@@ -569,6 +577,7 @@ SocketBackend(StringInfo inBuf)
 #ifdef ADB
 		case 'L':				/* agtm backend listen port */
 		case 'I':				/* query server info */
+		case 'i':				/* Coordinator query id */
 			break;
 #endif /* ADB */
 #ifdef AGTM
@@ -1187,6 +1196,9 @@ exec_simple_query(const char *query_string)
 	 * Report query to various monitoring facilities.
 	 */
 	debug_query_string = query_string;
+#ifdef ADB
+	MemoryContextQueryStart();
+#endif
 
 	pgstat_report_activity(STATE_RUNNING, query_string);
 
@@ -1216,6 +1228,17 @@ exec_simple_query(const char *query_string)
 	 */
 	drop_unnamed_stmt();
 
+#ifdef ADB
+	/*
+	 * Let AGTM work on the snapshot of the first statement while we parse
+	 * and plan it.
+	 */
+	if (enable_agtm_snapshot_prefetch &&
+		IS_PGXC_COORDINATOR && !IsConnFromCoord() &&
+		!IsAbortedTransactionBlockState())
+		agtm_PrefetchGlobalSnapShot();
+#endif
+
 	/*
 	 * Switch to appropriate context for constructing parsetrees.
 	 */
@@ -1483,6 +1506,11 @@ exec_simple_query(const char *query_string)
 
 		PortalDrop(portal, false);
 
+#ifdef ADB
+		/* a prefetched snapshot is too old for the next statement */
+		agtm_DropSnapShotPrefetch();
+#endif
+
 		if (IsA(parsetree, TransactionStmt))
 		{
 			/*
@@ -1571,6 +1599,9 @@ exec_simple_query(const char *query_string)
 	TRACE_POSTGRESQL_QUERY_DONE(query_string);
 
 	debug_query_string = NULL;
+#ifdef ADB
+	MemoryContextQueryEnd();
+#endif
 }
 
 /*
@@ -1597,6 +1628,10 @@ exec_parse_message(const char *query_string,	/* string to execute */
 #ifdef ADB
 	ParseGrammar grammar;
 	int			loglv = DEBUG2;
+	bool		use_shared = false;
+	Oid		   *origParamTypes = NULL;
+	int			origNumParams = 0;
+	uint32		generation = 0;
 #endif
 	bool		is_named;
 	bool		save_log_statement_stats = log_statement_stats;
@@ -1606,6 +1641,9 @@ exec_parse_message(const char *query_string,	/* string to execute */
 	 * Report query to various monitoring facilities.
 	 */
 	debug_query_string = query_string;
+#ifdef ADB
+	MemoryContextQueryStart();
+#endif
 
 	pgstat_report_activity(STATE_RUNNING, query_string);
 
@@ -1753,54 +1791,96 @@ exec_parse_message(const char *query_string,	/* string to execute */
 		psrc = CreateCachedPlan(raw_parse_tree, query_string, commandTag);
 #endif
 
+#ifdef ADB
 		/*
-		 * Set up a snapshot if parse analysis will need one.
+		 * Another session may have prepared the same statement already, try
+		 * the shared plan cache before analyzing it.
 		 */
-		if (analyze_requires_snapshot(raw_parse_tree))
+		querytree_list = NIL;
+		use_shared = (IsA(raw_parse_tree, SelectStmt) ||
+					  IsA(raw_parse_tree, InsertStmt) ||
+					  IsA(raw_parse_tree, UpdateStmt) ||
+					  IsA(raw_parse_tree, DeleteStmt)) &&
+			SharedPlanCacheActive();
+		if (use_shared)
 		{
-			PushActiveSnapshot(GetTransactionSnapshot());
-			snapshot_set = true;
+			/* the parameter types given by the client are part of the key */
+			origNumParams = numParams;
+			origParamTypes = NULL;
+			if (numParams > 0)
+			{
+				origParamTypes = (Oid *) palloc(numParams * sizeof(Oid));
+				memcpy(origParamTypes, paramTypes, numParams * sizeof(Oid));
+			}
+			generation = SharedPlanCacheGeneration();
+			querytree_list = SharedPlanCacheLookup(query_string, grammar,
+												   &paramTypes, &numParams);
 		}
 
-		/*
-		 * Analyze and rewrite the query.  Note that the originally specified
-		 * parameter set is not required to be complete, so we have to use
-		 * parse_analyze_varparams().
-		 */
-		if (log_parser_stats)
-			ResetUsage();
+		if (querytree_list == NIL)
+#endif
+		{
+			/*
+			 * Set up a snapshot if parse analysis will need one.
+			 */
+			if (analyze_requires_snapshot(raw_parse_tree))
+			{
+				PushActiveSnapshot(GetTransactionSnapshot());
+				snapshot_set = true;
+			}
+
+			/*
+			 * Analyze and rewrite the query.  Note that the originally
+			 * specified parameter set is not required to be complete, so we
+			 * have to use parse_analyze_varparams().
+			 */
+			if (log_parser_stats)
+				ResetUsage();
 
 #ifdef ADB
-		query = parse_analyze_varparams_for_gram(raw_parse_tree,
-												 query_string,
-												 &paramTypes,
-												 &numParams,
-												 grammar);
+			query = parse_analyze_varparams_for_gram(raw_parse_tree,
+													 query_string,
+													 &paramTypes,
+													 &numParams,
+													 grammar);
 #else
-		query = parse_analyze_varparams(raw_parse_tree,
-										query_string,
-										&paramTypes,
-										&numParams);
+			query = parse_analyze_varparams(raw_parse_tree,
+											query_string,
+											&paramTypes,
+											&numParams);
 #endif
 
-		/*
-		 * Check all parameter types got determined.
-		 */
-		for (i = 0; i < numParams; i++)
-		{
-			Oid			ptype = paramTypes[i];
+			/*
+			 * Check all parameter types got determined.
+			 */
+			for (i = 0; i < numParams; i++)
+			{
+				Oid			ptype = paramTypes[i];
 
-			if (ptype == InvalidOid || ptype == UNKNOWNOID)
-				ereport(ERROR,
-						(errcode(ERRCODE_INDETERMINATE_DATATYPE),
-					 errmsg("could not determine data type of parameter $%d",
-							i + 1)));
-		}
+				if (ptype == InvalidOid || ptype == UNKNOWNOID)
+					ereport(ERROR,
+							(errcode(ERRCODE_INDETERMINATE_DATATYPE),
+						 errmsg("could not determine data type of parameter $%d",
+								i + 1)));
+			}
+
+			if (log_parser_stats)
+				ShowUsage("PARSE ANALYSIS STATISTICS");
 
-		if (log_parser_stats)
-			ShowUsage("PARSE ANALYSIS STATISTICS");
+			querytree_list = pg_rewrite_query(query);
 
-		querytree_list = pg_rewrite_query(query);
+#ifdef ADB
+			if (use_shared)
+				SharedPlanCacheStore(query_string, grammar,
+									 origParamTypes, origNumParams,
+									 paramTypes, numParams,
+									 querytree_list, generation);
+#endif
+
+			/* Done with the snapshot used for parsing */
+			if (snapshot_set)
+				PopActiveSnapshot();
+		}
 #ifdef PGXC
 		if (IS_PGXC_COORDINATOR && !IsConnFromCoord())
 		{
@@ -1815,10 +1895,6 @@ exec_parse_message(const char *query_string,	/* string to execute */
 			}
 		}
 #endif
-
-		/* Done with the snapshot used for parsing */
-		if (snapshot_set)
-			PopActiveSnapshot();
 	}
 	else
 	{
@@ -1915,6 +1991,9 @@ exec_parse_message(const char *query_string,	/* string to execute */
 		ShowUsage("PARSE MESSAGE STATISTICS");
 
 	debug_query_string = NULL;
+#ifdef ADB
+	MemoryContextQueryEnd();
+#endif
 }
 
 /*
@@ -1974,6 +2053,9 @@ exec_bind_message(StringInfo input_message)
 	 * Report query to various monitoring facilities.
 	 */
 	debug_query_string = psrc->query_string;
+#ifdef ADB
+	MemoryContextQueryStart();
+#endif
 
 	pgstat_report_activity(STATE_RUNNING, psrc->query_string);
 
@@ -2326,6 +2408,9 @@ exec_bind_message(StringInfo input_message)
 		ShowUsage("BIND MESSAGE STATISTICS");
 
 	debug_query_string = NULL;
+#ifdef ADB
+	MemoryContextQueryEnd();
+#endif
 }
 
 /*
@@ -2408,6 +2493,9 @@ exec_execute_message(const char *portal_name, long max_rows)
 	 * Report query to various monitoring facilities.
 	 */
 	debug_query_string = sourceText;
+#ifdef ADB
+	MemoryContextQueryStart();
+#endif
 
 	pgstat_report_activity(STATE_RUNNING, sourceText);
 
@@ -2478,6 +2566,22 @@ exec_execute_message(const char *portal_name, long max_rows)
 	if (max_rows <= 0)
 		max_rows = FETCH_ALL;
 
+#ifdef ADB
+	/*
+	 * The rows of a remote INSERT can wait for the client's Sync on their
+	 * Datanode, so a client binding one row at a time gets them sent in
+	 * batches. Anything else waits for them first.
+	 */
+	if (IS_PGXC_COORDINATOR && !IsConnFromCoord() &&
+		strcmp(portal->commandTag, "INSERT") == 0 &&
+		!execute_is_fetch &&
+		list_length(portal->stmts) == 1 &&
+		IsA(linitial(portal->stmts), PlannedStmt))
+		RemoteDMLBatchStmt = (PlannedStmt *) linitial(portal->stmts);
+	else
+		ExecFlushRemoteDMLBatch();
+#endif
+
 	completed = PortalRun(portal,
 						  max_rows,
 						  true, /* always top level */
@@ -2485,6 +2589,10 @@ exec_execute_message(const char *portal_name, long max_rows)
 						  receiver,
 						  completionTag);
 
+#ifdef ADB
+	RemoteDMLBatchStmt = NULL;
+#endif
+
 	(*receiver->rDestroy) (receiver);
 
 #ifdef ADB
@@ -2569,6 +2677,9 @@ exec_execute_message(const char *portal_name, long max_rows)
 		ShowUsage("EXECUTE MESSAGE STATISTICS");
 
 	debug_query_string = NULL;
+#ifdef ADB
+	MemoryContextQueryEnd();
+#endif
 }
 
 /*
@@ -3408,6 +3519,11 @@ ProcessInterrupts(void)
 		return;
 	InterruptPending = false;
 
+#ifdef ADB
+	if (MemoryContextReportPending)
+		ProcessMemoryContextReport();
+#endif
+
 	if (ProcDiePending)
 	{
 		ProcDiePending = false;
@@ -3572,6 +3688,20 @@ ProcessInterrupts(void)
 					 errmsg("canceling autovacuum task")));
 #endif
 		}
+#ifdef ADB
+		if (GlobalDeadlockPending)
+		{
+			ImmediateInterruptOK = false;		/* not idle anymore */
+			GlobalDeadlockPending = false;
+			LockErrorCleanup();
+			DisableNotifyInterrupt();
+			DisableCatchupInterrupt();
+			ereport(ERROR,
+					(errcode(ERRCODE_T_R_DEADLOCK_DETECTED),
+					 errmsg("deadlock detected"),
+					 errdetail("The transaction was chosen as the victim of a deadlock across nodes.")));
+		}
+#endif
 		if (RecoveryConflictPending)
 		{
 			ImmediateInterruptOK = false;		/* not idle anymore */
@@ -4509,6 +4639,11 @@ PostgresMain(int argc, char *argv[],
 #endif /* ADB */
 
 		InitMultinodeExecutor(false);
+#ifdef ADB
+		if (!IsConnFromCoord() && PoolLazyConnect)
+			PoolManagerDeferConnect(dbname, username);
+		else
+#endif /* ADB */
 		if (!IsConnFromCoord())
 		{
 			pool_handle = GetPoolManagerHandle();
@@ -4597,6 +4732,9 @@ PostgresMain(int argc, char *argv[],
 		 */
 		disable_all_timeouts(false);
 		QueryCancelPending = false;		/* second to avoid race condition */
+#ifdef ADB
+		GlobalDeadlockPending = false;
+#endif
 
 		/*
 		 * Turn off these interrupts too.  This is only needed here and not in
@@ -4618,6 +4756,9 @@ PostgresMain(int argc, char *argv[],
 		 * the storage it points at.
 		 */
 		debug_query_string = NULL;
+#ifdef ADB
+		MemoryContextQueryEnd();
+#endif
 
 #ifdef ADB
 		/*
@@ -4662,6 +4803,7 @@ PostgresMain(int argc, char *argv[],
 		xact_started = false;
 #ifdef ADB
 		SetXactErrorAborted(false);
+		RemoteDMLBatchStmt = NULL;
 #endif
 
 		/*
@@ -4767,6 +4909,9 @@ PostgresMain(int argc, char *argv[],
 			 */
 			if ((IS_PGXC_DATANODE || IsConnFromCoord()) && !IsAnyAfterTriggerDeferred())
 				UnsetGlobalSnapshot();
+
+			/* sent again before each query it is known for */
+			CoordinatorQueryId = 0;
 #endif
 			send_ready_for_query = false;
 		}
@@ -4854,6 +4999,9 @@ PostgresMain(int argc, char *argv[],
 #endif /* ADB */
 					pq_getmsgend(&input_message);
 
+#ifdef ADB
+					ExecFlushRemoteDMLBatch();
+#endif
 					if (am_walsender)
 						exec_replication_command(query_string);
 					else
@@ -5104,6 +5252,10 @@ PostgresMain(int argc, char *argv[],
 
 			case 'S':			/* sync */
 				pq_getmsgend(&input_message);
+#ifdef ADB
+				/* rows left pipelined by Execute messages */
+				ExecFlushRemoteDMLBatch();
+#endif
 				finish_xact_command();
 				send_ready_for_query = true;
 				break;
@@ -5163,6 +5315,15 @@ PostgresMain(int argc, char *argv[],
 				}
 				break;
 
+#ifdef ADB
+			case 'i':			/* Coordinator query id */
+				{
+					CoordinatorQueryId = (uint32) pq_getmsgint(&input_message, 4);
+					pq_getmsgend(&input_message);
+				}
+				break;
+#endif
+
 			case 'g':			/* gxid */
 				{
 					/* Set the GXID got from Master-Coordinator */
@@ -5220,6 +5381,10 @@ PostgresMain(int argc, char *argv[],
 							ProcessCreateBarrierExecute(id);
 							break;
 
+						case CREATE_BARRIER_SYNC:
+							ProcessCreateBarrierSync(id);
+							break;
+
 						default:
 							ereport(ERROR,
 									(errcode(ERRCODE_INTERNAL_ERROR),
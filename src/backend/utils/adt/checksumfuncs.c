@@ -0,0 +1,202 @@
+/*-------------------------------------------------------------------------
+ *
+ * checksumfuncs.c
+ *	  Online verification of the checksums of data pages.
+ *
+ * The pages of a relation are read from disk one after the other and their
+ * checksums computed again, without going through shared buffers, so that
+ * the verification neither evicts the pages queries use nor stores the pages
+ * it reads.  It is throttled by vacuum_cost_delay and vacuum_cost_limit as
+ * a manual VACUUM is, each page read costing vacuum_cost_page_miss.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/checksumfuncs.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/heapam.h"
+#include "access/xlog.h"
+#include "catalog/catalog.h"
+#include "commands/vacuum.h"
+#include "common/relpath.h"
+#include "miscadmin.h"
+#include "storage/buf_internals.h"
+#include "storage/bufmgr.h"
+#include "storage/checksum.h"
+#include "storage/smgr.h"
+#include "utils/builtins.h"
+#include "utils/lsyscache.h"
+#include "utils/rel.h"
+#ifdef PGXC
+#include "pgxc/pgxc.h"
+#include "pgxc/pgxcnode.h"
+#endif
+
+static int64 verify_relation_checksums(Relation rel, ForkNumber forknum);
+
+/*
+ * pg_relation_verify_checksums
+ * Verify the checksums of the pages of a fork of a relation, reporting each
+ * page whose checksum does not match with a WARNING, and return how many of
+ * them there are.  On a Coordinator, the pages of a distributed relation are
+ * verified on each of its Datanodes.
+ */
+Datum
+pg_relation_verify_checksums(PG_FUNCTION_ARGS)
+{
+	Oid			relOid = PG_GETARG_OID(0);
+	text	   *forkName = PG_GETARG_TEXT_P(1);
+	ForkNumber	forknum;
+	Relation	rel;
+	int64		result;
+
+	if (!superuser())
+		ereport(ERROR,
+				(errcode(ERRCODE_INSUFFICIENT_PRIVILEGE),
+				 errmsg("must be superuser to verify checksums")));
+
+	if (!DataChecksumsEnabled())
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("data checksums are not enabled")));
+
+	forknum = forkname_to_number(text_to_cstring(forkName));
+
+#ifdef PGXC
+	if (IS_PGXC_COORDINATOR && !IsConnFromCoord() &&
+		GetRelationLocInfo(relOid) != NULL)
+	{
+		StringInfoData buf;
+		Oid		   *nodelist;
+		int			numnodes;
+
+		rel = relation_open(relOid, AccessShareLock);
+		initStringInfo(&buf);
+		appendStringInfo(&buf,
+						 "SELECT pg_catalog.pg_relation_verify_checksums('%s', '%s')",
+						 quote_qualified_identifier(get_namespace_name(rel->rd_rel->relnamespace),
+													RelationGetRelationName(rel)),
+						 forkNames[forknum]);
+		numnodes = get_pgxc_classnodes(relOid, &nodelist);
+		relation_close(rel, AccessShareLock);
+
+		PG_RETURN_DATUM(pgxc_execute_on_nodes(numnodes, nodelist, buf.data));
+	}
+#endif
+
+	rel = relation_open(relOid, AccessShareLock);
+
+	if (rel->rd_rel->relkind != RELKIND_RELATION &&
+		rel->rd_rel->relkind != RELKIND_INDEX &&
+		rel->rd_rel->relkind != RELKIND_MATVIEW &&
+		rel->rd_rel->relkind != RELKIND_SEQUENCE &&
+		rel->rd_rel->relkind != RELKIND_TOASTVALUE)
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("\"%s\" is not a table, index, materialized view, sequence, or TOAST table",
+						RelationGetRelationName(rel))));
+
+	/* The pages of temporary relations are in local buffers */
+	if (RelationUsesLocalBuffers(rel))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("cannot verify checksums of temporary relations")));
+
+	result = verify_relation_checksums(rel, forknum);
+
+	relation_close(rel, AccessShareLock);
+
+	PG_RETURN_INT64(result);
+}
+
+/*
+ * verify_relation_checksums
+ * Verify the pages of a fork of a relation on disk, with the cost based
+ * delay of VACUUM.
+ */
+static int64
+verify_relation_checksums(Relation rel, ForkNumber forknum)
+{
+	char	   *page;
+	BlockNumber nblocks;
+	BlockNumber blkno;
+	int64		nfailures = 0;
+
+	RelationOpenSmgr(rel);
+	if (!smgrexists(rel->rd_smgr, forknum))
+		return 0;
+
+	nblocks = smgrnblocks(rel->rd_smgr, forknum);
+	page = palloc(BLCKSZ);
+
+	VacuumCostActive = (VacuumCostDelay > 0);
+	VacuumCostBalance = 0;
+
+	PG_TRY();
+	{
+		for (blkno = 0; blkno < nblocks; blkno++)
+		{
+			BufferTag	tag;
+			uint32		hash;
+			LWLockId	partitionLock;
+			bool		cached;
+			uint16		checksum;
+
+			vacuum_delay_point();
+
+			INIT_BUFFERTAG(tag, rel->rd_smgr->smgr_rnode.node, forknum, blkno);
+			hash = BufTableHashCode(&tag);
+			partitionLock = BufMappingPartitionLock(hash);
+
+			/*
+			 * A page in shared buffers may be newer than the one on disk, it
+			 * is verified when it is read and its checksum set when written.
+			 * A page is only written from shared buffers, holding the mapping
+			 * lock while reading keeps the page from being read in, changed
+			 * and written out underneath.
+			 */
+			LWLockAcquire(partitionLock, LW_SHARED);
+			cached = (BufTableLookup(&tag, hash) >= 0);
+			if (!cached)
+				smgrread(rel->rd_smgr, forknum, blkno, page);
+			LWLockRelease(partitionLock);
+
+			if (cached)
+				continue;
+
+			VacuumCostBalance += VacuumCostPageMiss;
+
+			/* New pages have no checksum */
+			if (PageIsNew((Page) page))
+				continue;
+
+			checksum = pg_checksum_page(page, blkno);
+			if (checksum != ((PageHeader) page)->pd_checksum)
+			{
+				ereport(WARNING,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg("page verification failed, calculated checksum %u but expected %u",
+								checksum, ((PageHeader) page)->pd_checksum),
+						 errdetail("Block %u of relation %s.",
+								   blkno,
+								   relpath(rel->rd_smgr->smgr_rnode, forknum))));
+				nfailures++;
+			}
+		}
+	}
+	PG_CATCH();
+	{
+		VacuumCostActive = false;
+		PG_RE_THROW();
+	}
+	PG_END_TRY();
+
+	VacuumCostActive = false;
+	pfree(page);
+
+	return nfailures;
+}
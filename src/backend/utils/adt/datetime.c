@@ -58,6 +58,10 @@ static void AdjustFractDays(double frac, struct pg_tm * tm, fsec_t *fsec,
 #ifdef ADB
 static void AdjustFracMonths(double frac, struct pg_tm *tm, fsec_t *fsec,
 				int scale);
+static char *AppendDigits(char *cp, int value, int width);
+static char *EncodeISODateFast(char *cp, struct pg_tm * tm);
+static void EncodeISOTimestampFast(char *cp, struct pg_tm * tm, fsec_t fsec,
+					   char sep);
 #endif
 static int DetermineTimeZoneOffsetInternal(struct pg_tm * tm, pg_tz *tzp,
 								pg_time_t *tp);
@@ -484,6 +488,66 @@ AppendTimestampSeconds(char *cp, struct pg_tm * tm, fsec_t fsec)
 	AppendSeconds(cp, tm->tm_sec, fsec, MAX_TIMESTAMP_PRECISION, true);
 }
 
+#ifdef ADB
+/*
+ * Write value, known to be in [0, 10^width), as width digits at *cp and
+ * return the end.  The ISO styles written by the functions below are what
+ * COPY and the Datanodes send most, and sprintf is a large part of their
+ * cost.
+ */
+static char *
+AppendDigits(char *cp, int value, int width)
+{
+	char	   *end = cp + width;
+
+	for (cp = end; width > 0; width--, value /= 10)
+		*--cp = '0' + value % 10;
+	return end;
+}
+
+/* "YYYY-MM-DD" for a year of 1 to 9999 */
+static char *
+EncodeISODateFast(char *cp, struct pg_tm * tm)
+{
+	cp = AppendDigits(cp, tm->tm_year, 4);
+	*cp++ = '-';
+	cp = AppendDigits(cp, tm->tm_mon, 2);
+	*cp++ = '-';
+	cp = AppendDigits(cp, tm->tm_mday, 2);
+	*cp = '\0';
+	return cp;
+}
+
+/*
+ * "YYYY-MM-DD HH:MM:SS[.FFFFFF]" for a year of 1 to 9999, "sep" between date
+ * and time; the same as the sprintf() calls of EncodeDateTime().
+ */
+static void
+EncodeISOTimestampFast(char *cp, struct pg_tm * tm, fsec_t fsec, char sep)
+{
+	cp = EncodeISODateFast(cp, tm);
+	*cp++ = sep;
+	cp = AppendDigits(cp, tm->tm_hour, 2);
+	*cp++ = ':';
+	cp = AppendDigits(cp, tm->tm_min, 2);
+	*cp++ = ':';
+#ifdef HAVE_INT64_TIMESTAMP
+	cp = AppendDigits(cp, tm->tm_sec, 2);
+	if (fsec != 0)
+	{
+		*cp++ = '.';
+		cp = AppendDigits(cp, (int) Abs(fsec), MAX_TIMESTAMP_PRECISION);
+		/* fsec is not zero, so a non-zero digit stops this */
+		while (cp[-1] == '0')
+			cp--;
+	}
+	*cp = '\0';
+#else
+	AppendTimestampSeconds(cp, tm, fsec);
+#endif
+}
+#endif
+
 /*
  * Multiply frac by scale (to produce seconds) and add to *tm & *fsec.
  * We assume the input frac is less than 1 so overflow is not an issue.
@@ -3916,6 +3980,8 @@ EncodeDateOnly(struct pg_tm * tm, int style, char *str)
 #ifdef ADB
 			if (enable_zero_year && IsZeroPgDate(*tm))
 				sprintf(str, "0000-00-00");
+			else if (tm->tm_year > 0 && tm->tm_year <= 9999)
+				EncodeISODateFast(str, tm);
 			else
 #endif
 			if (tm->tm_year > 0)
@@ -4063,6 +4129,11 @@ EncodeDateTime(struct pg_tm * tm, fsec_t fsec, bool print_tz, int tz, const char
 					sprintf(str + strlen(str), " +00");
  			} else
 			{
+			if (tm->tm_year > 0 && tm->tm_year <= 9999)
+				EncodeISOTimestampFast(str, tm, fsec,
+									   style == USE_ISO_DATES ? ' ' : 'T');
+			else
+			{
 #endif
 			if (style == USE_ISO_DATES)
 				sprintf(str, "%04d-%02d-%02d %02d:%02d:",
@@ -4074,6 +4145,9 @@ EncodeDateTime(struct pg_tm * tm, fsec_t fsec, bool print_tz, int tz, const char
 						tm->tm_mon, tm->tm_mday, tm->tm_hour, tm->tm_min);
 
 			AppendTimestampSeconds(str + strlen(str), tm, fsec);
+#ifdef ADB
+			}
+#endif
 
 			if (print_tz)
 				EncodeTimezone(str, tz, style);
@@ -398,6 +398,10 @@ static DCHCacheEntry DCHCache[DCH_CACHE_FIELDS + 1];
 
 static int	n_DCHCache = 0;		/* number of entries */
 static int	DCHCounter = 0;
+#ifdef ADB
+/* entry of the last lookup, bulk conversions use the same picture */
+static DCHCacheEntry *DCHLastEntry = NULL;
+#endif
 
 /* global cache for --- number part */
 static NUMCacheEntry NUMCache[NUM_CACHE_FIELDS + 1];
@@ -3598,6 +3602,9 @@ DCH_cache_getnew(char *str)
 		StrNCpy(old->str, str, DCH_CACHE_SIZE + 1);
 		/* old->format fill parser */
 		old->age = (++DCHCounter);
+#ifdef ADB
+		DCHLastEntry = old;
+#endif
 		return old;
 	}
 	else
@@ -3610,6 +3617,9 @@ DCH_cache_getnew(char *str)
 		/* ent->format fill parser */
 		ent->age = (++DCHCounter);
 		++n_DCHCache;
+#ifdef ADB
+		DCHLastEntry = ent;
+#endif
 		return ent;
 	}
 }
@@ -3629,11 +3639,26 @@ DCH_cache_search(char *str)
 			ent->age = (++DCHCounter);
 	}
 
+#ifdef ADB
+	/*
+	 * COPY and the like convert many values with a single format picture,
+	 * so try the entry of the last lookup before searching the whole cache.
+	 */
+	if (DCHLastEntry != NULL && strcmp(DCHLastEntry->str, str) == 0)
+	{
+		DCHLastEntry->age = (++DCHCounter);
+		return DCHLastEntry;
+	}
+#endif
+
 	for (i = 0, ent = DCHCache; i < n_DCHCache; i++, ent++)
 	{
 		if (strcmp(ent->str, str) == 0)
 		{
 			ent->age = (++DCHCounter);
+#ifdef ADB
+			DCHLastEntry = ent;
+#endif
 			return ent;
 		}
 	}
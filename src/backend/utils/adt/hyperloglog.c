@@ -0,0 +1,767 @@
+/*-------------------------------------------------------------------------
+ *
+ * hyperloglog.c
+ *
+ *	  HyperLogLog sketches for approximate distinct counting
+ *
+ * See hyperloglog.h for the layout of a sketch.  approx_count_distinct()
+ * and hll_add_agg() add values to a sketch with hll_add_trans(), and have
+ * hll_union() as collection function: each datanode builds the sketch of
+ * its rows and sends it as the transition value, and the coordinator
+ * merges these sketches before estimating.  Unlike count(DISTINCT), this
+ * needs neither the values nor the distribution key on the coordinator.
+ *
+ * Values are hashed by their binary representation, so two values equal
+ * for their type but stored differently, such as numerics of different
+ * display scales, count as distinct.  Integers are hashed by their value
+ * and byte strings read in little-endian order, so a sketch does not
+ * depend on the architecture of the node that built it.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/hyperloglog.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "libpq/pqformat.h"
+#include "utils/builtins.h"
+#include "utils/hyperloglog.h"
+#include "utils/lsyscache.h"
+
+#define HLL_HASH_SEED	UINT64CONST(0x4adb5eed0f1e2d3c)
+
+/* Type of the values hll_add_trans() hashes, cached in fn_extra */
+typedef struct HllArgType
+{
+	Oid			typid;
+	int16		typlen;
+	bool		typbyval;
+} HllArgType;
+
+static uint64 hll_hash_bytes(const uint8 *data, int len);
+static uint64 hll_hash_int64(int64 value);
+static uint64 hll_hash_datum(Datum value, HllArgType *argtype);
+static HyperLogLog *hll_copy(HyperLogLog *hll);
+static HyperLogLog *hll_make_dense(HyperLogLog *hll);
+static HyperLogLog *hll_sparse_insert(HyperLogLog *hll, uint32 index,
+				  uint8 rank);
+static HyperLogLog *hll_sparse_merge(HyperLogLog *a, HyperLogLog *b);
+static void hll_to_wire(HyperLogLog *hll, StringInfo buf);
+static HyperLogLog *hll_from_wire(const uint8 *data, int len,
+			  const char **detail);
+
+/*
+ * MurmurHash64A of Austin Appleby, reading the blocks as little-endian
+ */
+static uint64
+hll_hash_bytes(const uint8 *data, int len)
+{
+	const uint64 m = UINT64CONST(0xc6a4a7935bd1e995);
+	const int	r = 47;
+	uint64		h = HLL_HASH_SEED ^ ((uint64) len * m);
+	int			nblocks = len / 8;
+	int			i;
+
+	for (i = 0; i < nblocks; i++)
+	{
+		const uint8 *p = data + i * 8;
+		uint64		k;
+
+		k = (uint64) p[0] | ((uint64) p[1] << 8) |
+			((uint64) p[2] << 16) | ((uint64) p[3] << 24) |
+			((uint64) p[4] << 32) | ((uint64) p[5] << 40) |
+			((uint64) p[6] << 48) | ((uint64) p[7] << 56);
+
+		k *= m;
+		k ^= k >> r;
+		k *= m;
+
+		h ^= k;
+		h *= m;
+	}
+
+	data += nblocks * 8;
+	switch (len & 7)
+	{
+		case 7:
+			h ^= (uint64) data[6] << 48;
+			/* fall through */
+		case 6:
+			h ^= (uint64) data[5] << 40;
+			/* fall through */
+		case 5:
+			h ^= (uint64) data[4] << 32;
+			/* fall through */
+		case 4:
+			h ^= (uint64) data[3] << 24;
+			/* fall through */
+		case 3:
+			h ^= (uint64) data[2] << 16;
+			/* fall through */
+		case 2:
+			h ^= (uint64) data[1] << 8;
+			/* fall through */
+		case 1:
+			h ^= (uint64) data[0];
+			h *= m;
+	}
+
+	h ^= h >> r;
+	h *= m;
+	h ^= h >> r;
+
+	return h;
+}
+
+/* Integers of any width hash alike, as their 8 little-endian bytes */
+static uint64
+hll_hash_int64(int64 value)
+{
+	uint64		v = (uint64) value;
+	uint8		bytes[8];
+	int			i;
+
+	for (i = 0; i < 8; i++)
+	{
+		bytes[i] = (uint8) (v & 0xFF);
+		v >>= 8;
+	}
+
+	return hll_hash_bytes(bytes, 8);
+}
+
+static uint64
+hll_hash_datum(Datum value, HllArgType *argtype)
+{
+	if (argtype->typbyval)
+	{
+		int64		v;
+
+		switch (argtype->typlen)
+		{
+			case 1:
+				v = (int64) DatumGetChar(value);
+				break;
+			case 2:
+				v = (int64) DatumGetInt16(value);
+				break;
+			case 4:
+				v = (int64) DatumGetInt32(value);
+				break;
+			case 8:
+				v = DatumGetInt64(value);
+				break;
+			default:
+				elog(ERROR, "unsupported byval length: %d",
+					 (int) argtype->typlen);
+				v = 0;			/* keep compiler quiet */
+		}
+		return hll_hash_int64(v);
+	}
+	else if (argtype->typlen == 8)
+	{
+		/* whether 8-byte types are passed by value or not */
+		int64		v;
+
+		memcpy(&v, DatumGetPointer(value), sizeof(int64));
+		return hll_hash_int64(v);
+	}
+	else if (argtype->typlen > 0)
+		return hll_hash_bytes((uint8 *) DatumGetPointer(value),
+							  argtype->typlen);
+	else if (argtype->typlen == -1)
+	{
+		struct varlena *v = PG_DETOAST_DATUM_PACKED(value);
+		uint64		hash;
+
+		hash = hll_hash_bytes((uint8 *) VARDATA_ANY(v), VARSIZE_ANY_EXHDR(v));
+		if ((Pointer) v != DatumGetPointer(value))
+			pfree(v);
+		return hash;
+	}
+	else
+	{
+		char	   *str = DatumGetCString(value);
+
+		return hll_hash_bytes((uint8 *) str, strlen(str));
+	}
+}
+
+/* Empty sparse sketch, with no room for entries */
+HyperLogLog *
+HyperLogLogCreate(int precision)
+{
+	HyperLogLog *hll;
+
+	Assert(precision >= HLL_MIN_PRECISION && precision <= HLL_MAX_PRECISION);
+
+	hll = (HyperLogLog *) palloc0(HLL_HDRSZ);
+	SET_VARSIZE(hll, HLL_HDRSZ);
+	hll->version = HLL_VERSION;
+	hll->precision = (uint8) precision;
+	hll->format = HLL_FORMAT_SPARSE;
+
+	return hll;
+}
+
+static HyperLogLog *
+hll_copy(HyperLogLog *hll)
+{
+	HyperLogLog *copy = (HyperLogLog *) palloc(VARSIZE(hll));
+
+	memcpy(copy, hll, VARSIZE(hll));
+	return copy;
+}
+
+/* Dense copy of a sketch */
+static HyperLogLog *
+hll_make_dense(HyperLogLog *hll)
+{
+	int			m = HLL_REGISTERS(hll);
+	HyperLogLog *dense;
+	uint8	   *registers;
+
+	if (hll->format == HLL_FORMAT_DENSE)
+		return hll_copy(hll);
+
+	dense = (HyperLogLog *) palloc0(HLL_HDRSZ + m);
+	SET_VARSIZE(dense, HLL_HDRSZ + m);
+	dense->version = HLL_VERSION;
+	dense->precision = hll->precision;
+	dense->format = HLL_FORMAT_DENSE;
+
+	registers = HLL_DENSE_DATA(dense);
+	{
+		uint32	   *entries = HLL_ENTRIES(hll);
+		uint32		i;
+
+		for (i = 0; i < hll->nentries; i++)
+			registers[entries[i] >> HLL_RANK_BITS] = entries[i] & HLL_RANK_MASK;
+	}
+
+	return dense;
+}
+
+/*
+ * Record the rank of a register in a sparse sketch.  The entry is updated
+ * or inserted in place when there is room for it, otherwise a larger or
+ * a dense copy of the sketch is returned.
+ */
+static HyperLogLog *
+hll_sparse_insert(HyperLogLog *hll, uint32 index, uint8 rank)
+{
+	uint32	   *entries = HLL_ENTRIES(hll);
+	uint32		n = hll->nentries;
+	uint32		lo = 0;
+	uint32		hi = n;
+
+	while (lo < hi)
+	{
+		uint32		mid = lo + (hi - lo) / 2;
+
+		if ((entries[mid] >> HLL_RANK_BITS) < index)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo < n && (entries[lo] >> HLL_RANK_BITS) == index)
+	{
+		if ((entries[lo] & HLL_RANK_MASK) < rank)
+			entries[lo] = (index << HLL_RANK_BITS) | rank;
+		return hll;
+	}
+
+	if (n >= HLL_SPARSE_LIMIT(hll))
+	{
+		HyperLogLog *dense = hll_make_dense(hll);
+
+		HLL_DENSE_DATA(dense)[index] = rank;
+		return dense;
+	}
+
+	if (n >= HLL_CAPACITY(hll))
+	{
+		uint32		capacity = Min(Max(n * 2, 8), HLL_SPARSE_LIMIT(hll));
+		HyperLogLog *larger;
+
+		larger = (HyperLogLog *) palloc(HLL_HDRSZ + capacity * sizeof(uint32));
+		memcpy(larger, hll, HLL_HDRSZ + n * sizeof(uint32));
+		SET_VARSIZE(larger, HLL_HDRSZ + capacity * sizeof(uint32));
+		hll = larger;
+		entries = HLL_ENTRIES(hll);
+	}
+
+	memmove(&entries[lo + 1], &entries[lo], (n - lo) * sizeof(uint32));
+	entries[lo] = (index << HLL_RANK_BITS) | rank;
+	hll->nentries = n + 1;
+
+	return hll;
+}
+
+/*
+ * HyperLogLogAddHash
+ *
+ * Add a hashed value to a sketch, which is modified in place when it can
+ * be; the result must replace it.
+ */
+HyperLogLog *
+HyperLogLogAddHash(HyperLogLog *hll, uint64 hash)
+{
+	int			precision = hll->precision;
+	uint32		index = (uint32) (hash >> (64 - precision));
+	uint64		rest = hash << precision;
+	uint8		maxrank = 64 - precision + 1;
+	uint8		rank = 1;
+
+	while (rank < maxrank && (rest & UINT64CONST(0x8000000000000000)) == 0)
+	{
+		rest <<= 1;
+		rank++;
+	}
+
+	if (hll->format == HLL_FORMAT_DENSE)
+	{
+		uint8	   *registers = HLL_DENSE_DATA(hll);
+
+		if (registers[index] < rank)
+			registers[index] = rank;
+		return hll;
+	}
+
+	return hll_sparse_insert(hll, index, rank);
+}
+
+/* Merge two sparse sketches into a new sparse one, which may be too big */
+static HyperLogLog *
+hll_sparse_merge(HyperLogLog *a, HyperLogLog *b)
+{
+	uint32	   *ae = HLL_ENTRIES(a);
+	uint32	   *be = HLL_ENTRIES(b);
+	uint32		i = 0;
+	uint32		j = 0;
+	uint32		n = 0;
+	uint32	   *entries;
+	HyperLogLog *result;
+
+	result = (HyperLogLog *) palloc(HLL_HDRSZ +
+						  (a->nentries + b->nentries) * sizeof(uint32));
+	memcpy(result, a, HLL_HDRSZ);
+	entries = HLL_ENTRIES(result);
+
+	while (i < a->nentries || j < b->nentries)
+	{
+		uint32		aindex = i < a->nentries ? ae[i] >> HLL_RANK_BITS : 0xFFFFFFFF;
+		uint32		bindex = j < b->nentries ? be[j] >> HLL_RANK_BITS : 0xFFFFFFFF;
+
+		if (aindex < bindex)
+			entries[n++] = ae[i++];
+		else if (bindex < aindex)
+			entries[n++] = be[j++];
+		else
+		{
+			entries[n++] = Max(ae[i], be[j]);
+			i++;
+			j++;
+		}
+	}
+
+	result->nentries = n;
+	SET_VARSIZE(result, HLL_HDRSZ + n * sizeof(uint32));
+
+	return result;
+}
+
+/*
+ * HyperLogLogUnion
+ *
+ * Sketch of the union of the sets two sketches of the same precision
+ * count.  If "inplace", a dense "hll" is updated and returned.
+ */
+HyperLogLog *
+HyperLogLogUnion(HyperLogLog *hll, HyperLogLog *other, bool inplace)
+{
+	HyperLogLog *result;
+	uint8	   *registers;
+
+	if (hll->precision != other->precision)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("cannot merge hll sketches of different precisions"),
+				 errdetail("Precisions are %d and %d.",
+						   hll->precision, other->precision)));
+
+	if (hll->format == HLL_FORMAT_SPARSE && other->format == HLL_FORMAT_SPARSE)
+	{
+		result = hll_sparse_merge(hll, other);
+		if (result->nentries <= HLL_SPARSE_LIMIT(result))
+			return result;
+		hll = hll_make_dense(result);
+		pfree(result);
+		result = hll;
+	}
+	else if (hll->format == HLL_FORMAT_DENSE && inplace)
+		result = hll;
+	else
+		result = hll_make_dense(hll);
+
+	registers = HLL_DENSE_DATA(result);
+	if (other->format == HLL_FORMAT_DENSE)
+	{
+		uint8	   *oregisters = HLL_DENSE_DATA(other);
+		int			m = HLL_REGISTERS(other);
+		int			i;
+
+		for (i = 0; i < m; i++)
+		{
+			if (registers[i] < oregisters[i])
+				registers[i] = oregisters[i];
+		}
+	}
+	else
+	{
+		uint32	   *entries = HLL_ENTRIES(other);
+		uint32		i;
+
+		for (i = 0; i < other->nentries; i++)
+		{
+			uint32		index = entries[i] >> HLL_RANK_BITS;
+			uint8		rank = entries[i] & HLL_RANK_MASK;
+
+			if (registers[index] < rank)
+				registers[index] = rank;
+		}
+	}
+
+	return result;
+}
+
+/*
+ * HyperLogLogEstimate
+ *
+ * Estimated count of distinct values, falling back on linear counting of
+ * the empty registers for small counts, where the raw estimate is biased.
+ */
+double
+HyperLogLogEstimate(HyperLogLog *hll)
+{
+	int			m = HLL_REGISTERS(hll);
+	double		alpha;
+	double		sum = 0;
+	int			zeros;
+	double		estimate;
+
+	if (hll->format == HLL_FORMAT_DENSE)
+	{
+		uint8	   *registers = HLL_DENSE_DATA(hll);
+		int			i;
+
+		zeros = 0;
+		for (i = 0; i < m; i++)
+		{
+			if (registers[i] == 0)
+				zeros++;
+			sum += ldexp(1.0, -registers[i]);
+		}
+	}
+	else
+	{
+		uint32	   *entries = HLL_ENTRIES(hll);
+		uint32		i;
+
+		zeros = m - hll->nentries;
+		sum = zeros;
+		for (i = 0; i < hll->nentries; i++)
+			sum += ldexp(1.0, -(int) (entries[i] & HLL_RANK_MASK));
+	}
+
+	switch (m)
+	{
+		case 16:
+			alpha = 0.673;
+			break;
+		case 32:
+			alpha = 0.697;
+			break;
+		case 64:
+			alpha = 0.709;
+			break;
+		default:
+			alpha = 0.7213 / (1.0 + 1.079 / m);
+			break;
+	}
+
+	estimate = alpha * m * m / sum;
+	if (estimate <= 2.5 * m && zeros > 0)
+		estimate = m * log((double) m / zeros);
+
+	return estimate;
+}
+
+/* Append the external form of a sketch, see hyperloglog.h */
+static void
+hll_to_wire(HyperLogLog *hll, StringInfo buf)
+{
+	appendStringInfoCharMacro(buf, (char) hll->version);
+	appendStringInfoCharMacro(buf, (char) hll->precision);
+	appendStringInfoCharMacro(buf, (char) hll->format);
+
+	if (hll->format == HLL_FORMAT_DENSE)
+		appendBinaryStringInfo(buf, (char *) HLL_DENSE_DATA(hll),
+							   HLL_REGISTERS(hll));
+	else
+	{
+		uint32	   *entries = HLL_ENTRIES(hll);
+		uint32		i;
+
+		for (i = 0; i < hll->nentries; i++)
+		{
+			uint32		ne = htonl(entries[i]);
+
+			appendBinaryStringInfo(buf, (char *) &ne, sizeof(uint32));
+		}
+	}
+}
+
+/*
+ * Build a sketch from its external form.  Returns NULL and sets *detail
+ * if the data is not a valid sketch.
+ */
+static HyperLogLog *
+hll_from_wire(const uint8 *data, int len, const char **detail)
+{
+	HyperLogLog *hll;
+	int			precision;
+	int			maxrank;
+	int			m;
+
+	if (len < 3)
+	{
+		*detail = "The sketch is truncated.";
+		return NULL;
+	}
+	if (data[0] != HLL_VERSION)
+	{
+		*detail = "The sketch version is not supported.";
+		return NULL;
+	}
+	precision = data[1];
+	if (precision < HLL_MIN_PRECISION || precision > HLL_MAX_PRECISION)
+	{
+		*detail = "The sketch precision is out of range.";
+		return NULL;
+	}
+	m = 1 << precision;
+	maxrank = 64 - precision + 1;
+	data += 3;
+	len -= 3;
+
+	if (data[-1] == HLL_FORMAT_DENSE)
+	{
+		int			i;
+
+		if (len != m)
+		{
+			*detail = "The count of registers does not match the precision.";
+			return NULL;
+		}
+		for (i = 0; i < m; i++)
+		{
+			if (data[i] > maxrank)
+			{
+				*detail = "A register is out of range.";
+				return NULL;
+			}
+		}
+
+		hll = (HyperLogLog *) palloc0(HLL_HDRSZ + m);
+		SET_VARSIZE(hll, HLL_HDRSZ + m);
+		hll->format = HLL_FORMAT_DENSE;
+		memcpy(HLL_DENSE_DATA(hll), data, m);
+	}
+	else if (data[-1] == HLL_FORMAT_SPARSE)
+	{
+		uint32		n = len / sizeof(uint32);
+		uint32	   *entries;
+		uint32		i;
+
+		if (len % sizeof(uint32) != 0 || n > m)
+		{
+			*detail = "The sketch entries are truncated.";
+			return NULL;
+		}
+
+		hll = (HyperLogLog *) palloc0(HLL_HDRSZ + n * sizeof(uint32));
+		SET_VARSIZE(hll, HLL_HDRSZ + n * sizeof(uint32));
+		hll->format = HLL_FORMAT_SPARSE;
+		hll->nentries = n;
+		entries = HLL_ENTRIES(hll);
+		for (i = 0; i < n; i++)
+		{
+			uint32		ne;
+			uint32		rank;
+
+			memcpy(&ne, data + i * sizeof(uint32), sizeof(uint32));
+			entries[i] = ntohl(ne);
+			rank = entries[i] & HLL_RANK_MASK;
+
+			if ((entries[i] >> HLL_RANK_BITS) >= m ||
+				rank == 0 || rank > maxrank ||
+				(i > 0 && (entries[i] >> HLL_RANK_BITS) <=
+				 (entries[i - 1] >> HLL_RANK_BITS)))
+			{
+				*detail = "The sketch entries are invalid or not sorted.";
+				pfree(hll);
+				return NULL;
+			}
+		}
+	}
+	else
+	{
+		*detail = "The sketch format is unknown.";
+		return NULL;
+	}
+
+	hll->version = HLL_VERSION;
+	hll->precision = (uint8) precision;
+
+	return hll;
+}
+
+Datum
+hll_in(PG_FUNCTION_ARGS)
+{
+	char	   *str = PG_GETARG_CSTRING(0);
+	int			len = strlen(str);
+	char	   *data = palloc(len / 2 + 1);
+	int			datalen;
+	HyperLogLog *hll;
+	const char *detail = NULL;
+
+	datalen = hex_decode(str, len, data);
+	hll = hll_from_wire((uint8 *) data, datalen, &detail);
+	if (hll == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+				 errmsg("invalid input syntax for type hll"),
+				 errdetail("%s", detail)));
+
+	pfree(data);
+	PG_RETURN_HLL(hll);
+}
+
+Datum
+hll_out(PG_FUNCTION_ARGS)
+{
+	HyperLogLog *hll = PG_GETARG_HLL(0);
+	StringInfoData buf;
+	char	   *result;
+	int			len;
+
+	initStringInfo(&buf);
+	hll_to_wire(hll, &buf);
+
+	result = palloc(buf.len * 2 + 1);
+	len = hex_encode(buf.data, buf.len, result);
+	result[len] = '\0';
+
+	pfree(buf.data);
+	PG_RETURN_CSTRING(result);
+}
+
+Datum
+hll_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	HyperLogLog *hll;
+	const char *detail = NULL;
+
+	hll = hll_from_wire((uint8 *) &buf->data[buf->cursor],
+						buf->len - buf->cursor, &detail);
+	if (hll == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("invalid external hll sketch"),
+				 errdetail("%s", detail)));
+	buf->cursor = buf->len;
+
+	PG_RETURN_HLL(hll);
+}
+
+Datum
+hll_send(PG_FUNCTION_ARGS)
+{
+	HyperLogLog *hll = PG_GETARG_HLL(0);
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	hll_to_wire(hll, &buf);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+/*
+ * hll_add_trans
+ *
+ * Transition function of approx_count_distinct() and hll_add_agg().  The
+ * sketch is the aggregate's own, and only then, modified in place.
+ */
+Datum
+hll_add_trans(PG_FUNCTION_ARGS)
+{
+	HyperLogLog *hll = PG_GETARG_HLL(0);
+	HllArgType *argtype = (HllArgType *) fcinfo->flinfo->fn_extra;
+
+	if (argtype == NULL)
+	{
+		Oid			typid = get_fn_expr_argtype(fcinfo->flinfo, 1);
+
+		if (!OidIsValid(typid))
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("could not determine the type of the values to count")));
+
+		argtype = (HllArgType *) MemoryContextAlloc(fcinfo->flinfo->fn_mcxt,
+													sizeof(HllArgType));
+		argtype->typid = typid;
+		get_typlenbyval(typid, &argtype->typlen, &argtype->typbyval);
+		fcinfo->flinfo->fn_extra = argtype;
+	}
+
+	if (!AggCheckCallContext(fcinfo, NULL) &&
+		hll == (HyperLogLog *) PG_GETARG_POINTER(0))
+		hll = hll_copy(hll);
+
+	hll = HyperLogLogAddHash(hll, hll_hash_datum(PG_GETARG_DATUM(1), argtype));
+
+	PG_RETURN_HLL(hll);
+}
+
+/*
+ * hll_union
+ *
+ * Union of two sketches, also the transition and collection function
+ * merging the sketches of aggregates.
+ */
+Datum
+hll_union(PG_FUNCTION_ARGS)
+{
+	HyperLogLog *hll = PG_GETARG_HLL(0);
+	HyperLogLog *other = PG_GETARG_HLL(1);
+
+	PG_RETURN_HLL(HyperLogLogUnion(hll, other,
+								   AggCheckCallContext(fcinfo, NULL) &&
+								   hll == (HyperLogLog *) PG_GETARG_POINTER(0)));
+}
+
+Datum
+hll_cardinality(PG_FUNCTION_ARGS)
+{
+	HyperLogLog *hll = PG_GETARG_HLL(0);
+
+	PG_RETURN_INT64((int64) rint(HyperLogLogEstimate(hll)));
+}
@@ -0,0 +1,431 @@
+/*-------------------------------------------------------------------------
+ *
+ * jsonb.c
+ *		I/O and accessor functions of the jsonb data type
+ *
+ * Input is parsed once by the json parser into a tree of JsonbValues,
+ * then serialized; the accessors read the serialized form in place,
+ * an object key being found by binary search.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/jsonb.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "libpq/pqformat.h"
+#include "utils/builtins.h"
+#include "utils/jsonapi.h"
+#include "utils/jsonb.h"
+
+/* Version byte of the binary send/recv format, followed by the text */
+#define JSONB_SEND_VERSION	1
+
+/* One container being parsed */
+typedef struct JsonbParseFrame
+{
+	JsonbValue	contVal;		/* jbvArray or jbvObject */
+	int			size;			/* allocated elements or pairs */
+	char	   *key;			/* key of the pair waiting for its value */
+	struct JsonbParseFrame *next;
+} JsonbParseFrame;
+
+typedef struct JsonbInState
+{
+	JsonbParseFrame *stack;
+	JsonbValue	result;
+	bool		done;
+} JsonbInState;
+
+static Jsonb *jsonb_from_text(text *json);
+static void jsonb_push_frame(JsonbInState *state, JsonbValueType type);
+static void jsonb_add_value(JsonbInState *state, JsonbValue *val);
+static void jsonb_in_object_start(void *pstate);
+static void jsonb_in_array_start(void *pstate);
+static void jsonb_in_container_end(void *pstate);
+static void jsonb_in_object_field_start(void *pstate, char *fname, bool isnull);
+static void jsonb_in_scalar(void *pstate, char *token, JsonTokenType tokentype);
+static text *jsonb_value_as_text(JsonbValue *val);
+
+/*
+ * jsonb type input function
+ */
+Datum
+jsonb_in(PG_FUNCTION_ARGS)
+{
+	char	   *json = PG_GETARG_CSTRING(0);
+
+	PG_RETURN_JSONB(jsonb_from_text(cstring_to_text(json)));
+}
+
+/*
+ * jsonb type output function
+ */
+Datum
+jsonb_out(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	StringInfoData out;
+
+	initStringInfo(&out);
+	JsonbToCString(&out, &jb->root);
+
+	PG_RETURN_CSTRING(out.data);
+}
+
+/*
+ * jsonb type recv function
+ *
+ * The binary form is a version byte and the text of the document, so that
+ * clients do not depend on the storage layout.
+ */
+Datum
+jsonb_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	int			version = pq_getmsgint(buf, 1);
+	char	   *str;
+	int			nbytes;
+
+	if (version != JSONB_SEND_VERSION)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("unsupported jsonb version number %d", version)));
+
+	str = pq_getmsgtext(buf, buf->len - buf->cursor, &nbytes);
+
+	PG_RETURN_JSONB(jsonb_from_text(cstring_to_text_with_len(str, nbytes)));
+}
+
+/*
+ * jsonb type send function
+ */
+Datum
+jsonb_send(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	StringInfoData out;
+	StringInfoData buf;
+
+	initStringInfo(&out);
+	JsonbToCString(&out, &jb->root);
+
+	pq_begintypsend(&buf);
+	pq_sendint(&buf, JSONB_SEND_VERSION, 1);
+	pq_sendtext(&buf, out.data, out.len);
+	pfree(out.data);
+
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+/* Parse a json text into a new jsonb datum */
+static Jsonb *
+jsonb_from_text(text *json)
+{
+	JsonLexContext *lex = makeJsonLexContext(json, true);
+	JsonbInState state;
+	JsonSemAction sem;
+
+	memset(&state, 0, sizeof(state));
+	memset(&sem, 0, sizeof(sem));
+
+	sem.semstate = (void *) &state;
+	sem.object_start = jsonb_in_object_start;
+	sem.object_end = jsonb_in_container_end;
+	sem.array_start = jsonb_in_array_start;
+	sem.array_end = jsonb_in_container_end;
+	sem.object_field_start = jsonb_in_object_field_start;
+	sem.scalar = jsonb_in_scalar;
+
+	pg_parse_json(lex, &sem);
+
+	Assert(state.done && state.stack == NULL);
+
+	return JsonbValueToJsonb(&state.result);
+}
+
+static void
+jsonb_push_frame(JsonbInState *state, JsonbValueType type)
+{
+	JsonbParseFrame *frame = palloc(sizeof(JsonbParseFrame));
+
+	frame->contVal.type = type;
+	frame->size = 4;
+	frame->key = NULL;
+	if (type == jbvObject)
+	{
+		frame->contVal.val.object.nPairs = 0;
+		frame->contVal.val.object.pairs = palloc(sizeof(JsonbPair) * frame->size);
+	}
+	else
+	{
+		frame->contVal.val.array.nElems = 0;
+		frame->contVal.val.array.elems = palloc(sizeof(JsonbValue) * frame->size);
+		frame->contVal.val.array.rawScalar = false;
+	}
+
+	frame->next = state->stack;
+	state->stack = frame;
+}
+
+/* Add a complete value to the container being parsed, or make it the result */
+static void
+jsonb_add_value(JsonbInState *state, JsonbValue *val)
+{
+	JsonbParseFrame *frame = state->stack;
+
+	if (frame == NULL)
+	{
+		state->result = *val;
+		state->done = true;
+		return;
+	}
+
+	if (frame->contVal.type == jbvObject)
+	{
+		JsonbValue *object = &frame->contVal;
+		JsonbPair  *pair;
+
+		if (object->val.object.nPairs >= frame->size)
+		{
+			frame->size *= 2;
+			object->val.object.pairs = repalloc(object->val.object.pairs,
+										   sizeof(JsonbPair) * frame->size);
+		}
+
+		Assert(frame->key != NULL);
+		pair = &object->val.object.pairs[object->val.object.nPairs];
+		pair->key.type = jbvString;
+		pair->key.val.string.val = frame->key;
+		pair->key.val.string.len = strlen(frame->key);
+		pair->value = *val;
+		pair->order = object->val.object.nPairs++;
+		frame->key = NULL;
+	}
+	else
+	{
+		JsonbValue *array = &frame->contVal;
+
+		if (array->val.array.nElems >= frame->size)
+		{
+			frame->size *= 2;
+			array->val.array.elems = repalloc(array->val.array.elems,
+										  sizeof(JsonbValue) * frame->size);
+		}
+		array->val.array.elems[array->val.array.nElems++] = *val;
+	}
+}
+
+static void
+jsonb_in_object_start(void *pstate)
+{
+	jsonb_push_frame((JsonbInState *) pstate, jbvObject);
+}
+
+static void
+jsonb_in_array_start(void *pstate)
+{
+	jsonb_push_frame((JsonbInState *) pstate, jbvArray);
+}
+
+static void
+jsonb_in_container_end(void *pstate)
+{
+	JsonbInState *state = (JsonbInState *) pstate;
+	JsonbParseFrame *frame = state->stack;
+
+	state->stack = frame->next;
+	if (frame->contVal.type == jbvObject)
+		JsonbUniquifyObject(&frame->contVal);
+	jsonb_add_value(state, &frame->contVal);
+	pfree(frame);
+}
+
+static void
+jsonb_in_object_field_start(void *pstate, char *fname, bool isnull)
+{
+	JsonbInState *state = (JsonbInState *) pstate;
+
+	state->stack->key = fname;
+}
+
+static void
+jsonb_in_scalar(void *pstate, char *token, JsonTokenType tokentype)
+{
+	JsonbInState *state = (JsonbInState *) pstate;
+	JsonbValue	val;
+
+	switch (tokentype)
+	{
+		case JSON_TOKEN_STRING:
+			val.type = jbvString;
+			val.val.string.val = token;
+			val.val.string.len = strlen(token);
+			break;
+		case JSON_TOKEN_NUMBER:
+			val.type = jbvNumeric;
+			val.val.numeric = DatumGetNumeric(DirectFunctionCall3(numeric_in,
+												   CStringGetDatum(token),
+												ObjectIdGetDatum(InvalidOid),
+														Int32GetDatum(-1)));
+			break;
+		case JSON_TOKEN_TRUE:
+			val.type = jbvBool;
+			val.val.boolean = true;
+			break;
+		case JSON_TOKEN_FALSE:
+			val.type = jbvBool;
+			val.val.boolean = false;
+			break;
+		case JSON_TOKEN_NULL:
+			val.type = jbvNull;
+			break;
+		default:
+			elog(ERROR, "invalid json token type: %d", (int) tokentype);
+	}
+
+	jsonb_add_value(state, &val);
+}
+
+/*
+ * The text a ->> operator returns: a string without its quotes, the text
+ * form of other values, NULL for a json null.
+ */
+static text *
+jsonb_value_as_text(JsonbValue *val)
+{
+	StringInfoData out;
+
+	if (val->type == jbvNull)
+		return NULL;
+	if (val->type == jbvString)
+		return cstring_to_text_with_len(val->val.string.val,
+										val->val.string.len);
+
+	initStringInfo(&out);
+	JsonbValueToCString(&out, val);
+
+	return cstring_to_text_with_len(out.data, out.len);
+}
+
+/*
+ * jsonb_typeof
+ *
+ * The JSON type of the top-level value of a document.
+ */
+Datum
+jsonb_typeof(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	const char *result;
+
+	if (JB_ROOT_IS_OBJECT(jb))
+		result = "object";
+	else if (!JB_ROOT_IS_SCALAR(jb))
+		result = "array";
+	else
+	{
+		JsonbValue	val;
+
+		JsonbContainerGetChild(&jb->root, 0, &val);
+		switch (val.type)
+		{
+			case jbvString:
+				result = "string";
+				break;
+			case jbvNumeric:
+				result = "number";
+				break;
+			case jbvBool:
+				result = "boolean";
+				break;
+			case jbvNull:
+				result = "null";
+				break;
+			default:
+				elog(ERROR, "unknown jsonb scalar type");
+				result = NULL;	/* keep compiler quiet */
+		}
+	}
+
+	PG_RETURN_TEXT_P(cstring_to_text(result));
+}
+
+/*
+ * The accessors return NULL rather than failing when the document is not
+ * of the kind they look into, so that a filter over heterogeneous
+ * documents just skips the rows not matching.
+ */
+Datum
+jsonb_object_field(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	text	   *key = PG_GETARG_TEXT_PP(1);
+	JsonbValue	val;
+
+	if (!JB_ROOT_IS_OBJECT(jb) ||
+		!JsonbFindObjectKey(&jb->root, VARDATA_ANY(key),
+							VARSIZE_ANY_EXHDR(key), &val))
+		PG_RETURN_NULL();
+
+	PG_RETURN_JSONB(JsonbValueToJsonb(&val));
+}
+
+Datum
+jsonb_object_field_text(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	text	   *key = PG_GETARG_TEXT_PP(1);
+	JsonbValue	val;
+	text	   *result;
+
+	if (!JB_ROOT_IS_OBJECT(jb) ||
+		!JsonbFindObjectKey(&jb->root, VARDATA_ANY(key),
+							VARSIZE_ANY_EXHDR(key), &val))
+		PG_RETURN_NULL();
+
+	result = jsonb_value_as_text(&val);
+	if (result == NULL)
+		PG_RETURN_NULL();
+
+	PG_RETURN_TEXT_P(result);
+}
+
+Datum
+jsonb_array_element(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	int			element = PG_GETARG_INT32(1);
+	JsonbValue	val;
+
+	if (!JB_ROOT_IS_ARRAY(jb) || JB_ROOT_IS_SCALAR(jb) ||
+		element < 0 || element >= JB_ROOT_COUNT(jb))
+		PG_RETURN_NULL();
+
+	JsonbContainerGetChild(&jb->root, element, &val);
+
+	PG_RETURN_JSONB(JsonbValueToJsonb(&val));
+}
+
+Datum
+jsonb_array_element_text(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	int			element = PG_GETARG_INT32(1);
+	JsonbValue	val;
+	text	   *result;
+
+	if (!JB_ROOT_IS_ARRAY(jb) || JB_ROOT_IS_SCALAR(jb) ||
+		element < 0 || element >= JB_ROOT_COUNT(jb))
+		PG_RETURN_NULL();
+
+	JsonbContainerGetChild(&jb->root, element, &val);
+	result = jsonb_value_as_text(&val);
+	if (result == NULL)
+		PG_RETURN_NULL();
+
+	PG_RETURN_TEXT_P(result);
+}
@@ -0,0 +1,308 @@
+/*-------------------------------------------------------------------------
+ *
+ * jsonb_gin.c
+ *	 GIN support functions for jsonb_ops
+ *
+ * A document is indexed by all its keys and scalar values, at any depth,
+ * each one as a text made of a flag byte telling what it is and of its
+ * data.  Strings that are array elements are flagged as keys, as the
+ * existence operators find them; numbers are indexed by their hash,
+ * equal for equal numbers whatever their display scale, and long strings
+ * by a hash of their bytes.  Since an entry does not tell where in the
+ * document it was found, every match is rechecked.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/jsonb_gin.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/gin.h"
+#include "access/hash.h"
+#include "access/skey.h"
+#include "catalog/pg_type.h"
+#include "miscadmin.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/jsonb.h"
+
+#define JGINFLAG_KEY	0x01	/* object key, or string array element */
+#define JGINFLAG_NULL	0x02
+#define JGINFLAG_BOOL	0x03
+#define JGINFLAG_NUM	0x04	/* hash of a number */
+#define JGINFLAG_STR	0x05	/* string value of an object */
+#define JGINFLAG_HASHED 0x10	/* hash of a too long string */
+
+/* Strings longer than this are indexed by their hash */
+#define JGIN_MAXLENGTH	125
+
+typedef struct GinEntries
+{
+	Datum	   *entries;
+	int			count;
+	int			allocated;
+} GinEntries;
+
+static void add_gin_entry(GinEntries *entries, Datum entry);
+static Datum make_text_key(char flag, const char *str, int len);
+static Datum make_hash_key(char flag, uint32 hash);
+static Datum make_scalar_key(JsonbValue *val, bool is_key);
+static void extract_container_entries(JsonbContainer *container,
+						  GinEntries *entries);
+static Datum *extract_jsonb_entries(Jsonb *jb, int32 *nentries);
+
+static void
+add_gin_entry(GinEntries *entries, Datum entry)
+{
+	if (entries->count >= entries->allocated)
+	{
+		if (entries->allocated == 0)
+		{
+			entries->allocated = 16;
+			entries->entries = palloc(sizeof(Datum) * entries->allocated);
+		}
+		else
+		{
+			entries->allocated *= 2;
+			entries->entries = repalloc(entries->entries,
+									sizeof(Datum) * entries->allocated);
+		}
+	}
+	entries->entries[entries->count++] = entry;
+}
+
+static Datum
+make_text_key(char flag, const char *str, int len)
+{
+	text	   *item;
+
+	if (len > JGIN_MAXLENGTH)
+		return make_hash_key(flag | JGINFLAG_HASHED,
+						 DatumGetUInt32(hash_any((unsigned char *) str, len)));
+
+	item = (text *) palloc(VARHDRSZ + len + 1);
+	SET_VARSIZE(item, VARHDRSZ + len + 1);
+	*VARDATA(item) = flag;
+	memcpy(VARDATA(item) + 1, str, len);
+
+	return PointerGetDatum(item);
+}
+
+static Datum
+make_hash_key(char flag, uint32 hash)
+{
+	char		hashbuf[9];
+
+	snprintf(hashbuf, sizeof(hashbuf), "%08x", hash);
+
+	return make_text_key(flag, hashbuf, 8);
+}
+
+static Datum
+make_scalar_key(JsonbValue *val, bool is_key)
+{
+	switch (val->type)
+	{
+		case jbvNull:
+			return make_text_key(JGINFLAG_NULL, "", 0);
+		case jbvBool:
+			return make_text_key(JGINFLAG_BOOL,
+								 val->val.boolean ? "t" : "f", 1);
+		case jbvNumeric:
+			return make_hash_key(JGINFLAG_NUM,
+							 DatumGetUInt32(DirectFunctionCall1(hash_numeric,
+									  NumericGetDatum(val->val.numeric))));
+		case jbvString:
+			return make_text_key(is_key ? JGINFLAG_KEY : JGINFLAG_STR,
+								 val->val.string.val, val->val.string.len);
+		default:
+			elog(ERROR, "unexpected type of jsonb value: %d", (int) val->type);
+	}
+
+	return (Datum) 0;			/* keep compiler quiet */
+}
+
+static void
+extract_container_entries(JsonbContainer *container, GinEntries *entries)
+{
+	uint32		count = JsonContainerSize(container);
+	uint32		i;
+
+	check_stack_depth();
+
+	for (i = 0; i < count; i++)
+	{
+		JsonbValue	val;
+		bool		is_key;
+
+		if (JsonContainerIsObject(container))
+		{
+			JsonbValue	key;
+
+			JsonbContainerGetChild(container, i, &key);
+			add_gin_entry(entries, make_scalar_key(&key, true));
+			JsonbContainerGetChild(container, count + i, &val);
+			is_key = false;
+		}
+		else
+		{
+			JsonbContainerGetChild(container, i, &val);
+			is_key = (val.type == jbvString);
+		}
+
+		if (val.type == jbvBinary)
+			extract_container_entries(val.val.binary.data, entries);
+		else
+			add_gin_entry(entries, make_scalar_key(&val, is_key));
+	}
+}
+
+static Datum *
+extract_jsonb_entries(Jsonb *jb, int32 *nentries)
+{
+	GinEntries	entries;
+
+	memset(&entries, 0, sizeof(entries));
+	extract_container_entries(&jb->root, &entries);
+
+	*nentries = entries.count;
+	return entries.entries;
+}
+
+Datum
+gin_compare_jsonb(PG_FUNCTION_ARGS)
+{
+	text	   *a = PG_GETARG_TEXT_PP(0);
+	text	   *b = PG_GETARG_TEXT_PP(1);
+	int			alen = VARSIZE_ANY_EXHDR(a);
+	int			blen = VARSIZE_ANY_EXHDR(b);
+	int			res;
+
+	res = memcmp(VARDATA_ANY(a), VARDATA_ANY(b), Min(alen, blen));
+	if (res == 0 && alen != blen)
+		res = alen < blen ? -1 : 1;
+
+	PG_FREE_IF_COPY(a, 0);
+	PG_FREE_IF_COPY(b, 1);
+	PG_RETURN_INT32(res);
+}
+
+Datum
+gin_extract_jsonb(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	int32	   *nentries = (int32 *) PG_GETARG_POINTER(1);
+
+	PG_RETURN_POINTER(extract_jsonb_entries(jb, nentries));
+}
+
+Datum
+gin_extract_jsonb_query(PG_FUNCTION_ARGS)
+{
+	int32	   *nentries = (int32 *) PG_GETARG_POINTER(1);
+	StrategyNumber strategy = PG_GETARG_UINT16(2);
+	int32	   *searchMode = (int32 *) PG_GETARG_POINTER(6);
+	Datum	   *entries = NULL;
+
+	switch (strategy)
+	{
+		case JsonbContainsStrategyNumber:
+			entries = extract_jsonb_entries(PG_GETARG_JSONB(0), nentries);
+			/* an empty template is contained in every document of its kind */
+			if (*nentries == 0)
+				*searchMode = GIN_SEARCH_MODE_ALL;
+			break;
+		case JsonbExistsStrategyNumber:
+			{
+				text	   *key = PG_GETARG_TEXT_PP(0);
+
+				entries = (Datum *) palloc(sizeof(Datum));
+				entries[0] = make_text_key(JGINFLAG_KEY, VARDATA_ANY(key),
+										   VARSIZE_ANY_EXHDR(key));
+				*nentries = 1;
+			}
+			break;
+		case JsonbExistsAnyStrategyNumber:
+		case JsonbExistsAllStrategyNumber:
+			{
+				ArrayType  *keys = PG_GETARG_ARRAYTYPE_P(0);
+				Datum	   *elems;
+				bool	   *nulls;
+				int			nelems;
+				int			i;
+				int			j = 0;
+
+				deconstruct_array(keys, TEXTOID, -1, false, 'i',
+								  &elems, &nulls, &nelems);
+				entries = (Datum *) palloc(sizeof(Datum) * Max(nelems, 1));
+				for (i = 0; i < nelems; i++)
+				{
+					text	   *key;
+
+					if (nulls[i])
+						continue;
+					key = DatumGetTextPP(elems[i]);
+					entries[j++] = make_text_key(JGINFLAG_KEY,
+												 VARDATA_ANY(key),
+												 VARSIZE_ANY_EXHDR(key));
+				}
+				*nentries = j;
+				/* ?& of no keys is true for every document */
+				if (j == 0 && strategy == JsonbExistsAllStrategyNumber)
+					*searchMode = GIN_SEARCH_MODE_ALL;
+			}
+			break;
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+	}
+
+	PG_RETURN_POINTER(entries);
+}
+
+Datum
+gin_consistent_jsonb(PG_FUNCTION_ARGS)
+{
+	bool	   *check = (bool *) PG_GETARG_POINTER(0);
+	StrategyNumber strategy = PG_GETARG_UINT16(1);
+	int32		nkeys = PG_GETARG_INT32(3);
+	bool	   *recheck = (bool *) PG_GETARG_POINTER(5);
+	bool		res = true;
+	int32		i;
+
+	/* entries do not tell at which level they were found */
+	*recheck = true;
+
+	switch (strategy)
+	{
+		case JsonbContainsStrategyNumber:
+		case JsonbExistsStrategyNumber:
+		case JsonbExistsAllStrategyNumber:
+			for (i = 0; i < nkeys; i++)
+			{
+				if (!check[i])
+				{
+					res = false;
+					break;
+				}
+			}
+			break;
+		case JsonbExistsAnyStrategyNumber:
+			res = false;
+			for (i = 0; i < nkeys; i++)
+			{
+				if (check[i])
+				{
+					res = true;
+					break;
+				}
+			}
+			break;
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+	}
+
+	PG_RETURN_BOOL(res);
+}
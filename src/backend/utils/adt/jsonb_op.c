@@ -0,0 +1,213 @@
+/*-------------------------------------------------------------------------
+ *
+ * jsonb_op.c
+ *	  Existence, containment and comparison operators of jsonb
+ *
+ * All of them are immutable and read the serialized documents in place,
+ * so they are evaluated on the datanodes when a filter is shipped.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/jsonb_op.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "catalog/pg_type.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/jsonb.h"
+
+static bool jsonb_has_key(Jsonb *jb, const char *key, int keylen);
+static bool jsonb_exists_array(Jsonb *jb, ArrayType *keys, bool all);
+
+/*
+ * A key exists in a document if it is a key of the top-level object, or
+ * a string element of the top-level array.
+ */
+static bool
+jsonb_has_key(Jsonb *jb, const char *key, int keylen)
+{
+	if (JB_ROOT_IS_OBJECT(jb))
+		return JsonbFindObjectKey(&jb->root, key, keylen, NULL);
+
+	return JsonbFindArrayString(&jb->root, key, keylen);
+}
+
+/* ?| and ?& behind, null keys being ignored */
+static bool
+jsonb_exists_array(Jsonb *jb, ArrayType *keys, bool all)
+{
+	Datum	   *elems;
+	bool	   *nulls;
+	int			nelems;
+	int			i;
+
+	deconstruct_array(keys, TEXTOID, -1, false, 'i',
+					  &elems, &nulls, &nelems);
+
+	for (i = 0; i < nelems; i++)
+	{
+		text	   *key;
+		bool		found;
+
+		if (nulls[i])
+			continue;
+
+		key = DatumGetTextPP(elems[i]);
+		found = jsonb_has_key(jb, VARDATA_ANY(key), VARSIZE_ANY_EXHDR(key));
+		if (found != all)
+			return found;
+	}
+
+	return all;
+}
+
+Datum
+jsonb_exists(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	text	   *key = PG_GETARG_TEXT_PP(1);
+
+	PG_RETURN_BOOL(jsonb_has_key(jb, VARDATA_ANY(key),
+								 VARSIZE_ANY_EXHDR(key)));
+}
+
+Datum
+jsonb_exists_any(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	ArrayType  *keys = PG_GETARG_ARRAYTYPE_P(1);
+
+	PG_RETURN_BOOL(jsonb_exists_array(jb, keys, false));
+}
+
+Datum
+jsonb_exists_all(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	ArrayType  *keys = PG_GETARG_ARRAYTYPE_P(1);
+
+	PG_RETURN_BOOL(jsonb_exists_array(jb, keys, true));
+}
+
+Datum
+jsonb_contains(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *val = PG_GETARG_JSONB(0);
+	Jsonb	   *tmpl = PG_GETARG_JSONB(1);
+
+	PG_RETURN_BOOL(JsonbDeepContains(&val->root, &tmpl->root));
+}
+
+Datum
+jsonb_contained(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *tmpl = PG_GETARG_JSONB(0);
+	Jsonb	   *val = PG_GETARG_JSONB(1);
+
+	PG_RETURN_BOOL(JsonbDeepContains(&val->root, &tmpl->root));
+}
+
+/*
+ * btree comparison, see JsonbCompareContainers for the ordering
+ */
+Datum
+jsonb_cmp(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *a = PG_GETARG_JSONB(0);
+	Jsonb	   *b = PG_GETARG_JSONB(1);
+	int			res = JsonbCompareContainers(&a->root, &b->root);
+
+	PG_FREE_IF_COPY(a, 0);
+	PG_FREE_IF_COPY(b, 1);
+	PG_RETURN_INT32(res);
+}
+
+Datum
+jsonb_eq(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *a = PG_GETARG_JSONB(0);
+	Jsonb	   *b = PG_GETARG_JSONB(1);
+	bool		res = (JsonbCompareContainers(&a->root, &b->root) == 0);
+
+	PG_FREE_IF_COPY(a, 0);
+	PG_FREE_IF_COPY(b, 1);
+	PG_RETURN_BOOL(res);
+}
+
+Datum
+jsonb_ne(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *a = PG_GETARG_JSONB(0);
+	Jsonb	   *b = PG_GETARG_JSONB(1);
+	bool		res = (JsonbCompareContainers(&a->root, &b->root) != 0);
+
+	PG_FREE_IF_COPY(a, 0);
+	PG_FREE_IF_COPY(b, 1);
+	PG_RETURN_BOOL(res);
+}
+
+Datum
+jsonb_lt(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *a = PG_GETARG_JSONB(0);
+	Jsonb	   *b = PG_GETARG_JSONB(1);
+	bool		res = (JsonbCompareContainers(&a->root, &b->root) < 0);
+
+	PG_FREE_IF_COPY(a, 0);
+	PG_FREE_IF_COPY(b, 1);
+	PG_RETURN_BOOL(res);
+}
+
+Datum
+jsonb_gt(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *a = PG_GETARG_JSONB(0);
+	Jsonb	   *b = PG_GETARG_JSONB(1);
+	bool		res = (JsonbCompareContainers(&a->root, &b->root) > 0);
+
+	PG_FREE_IF_COPY(a, 0);
+	PG_FREE_IF_COPY(b, 1);
+	PG_RETURN_BOOL(res);
+}
+
+Datum
+jsonb_le(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *a = PG_GETARG_JSONB(0);
+	Jsonb	   *b = PG_GETARG_JSONB(1);
+	bool		res = (JsonbCompareContainers(&a->root, &b->root) <= 0);
+
+	PG_FREE_IF_COPY(a, 0);
+	PG_FREE_IF_COPY(b, 1);
+	PG_RETURN_BOOL(res);
+}
+
+Datum
+jsonb_ge(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *a = PG_GETARG_JSONB(0);
+	Jsonb	   *b = PG_GETARG_JSONB(1);
+	bool		res = (JsonbCompareContainers(&a->root, &b->root) >= 0);
+
+	PG_FREE_IF_COPY(a, 0);
+	PG_FREE_IF_COPY(b, 1);
+	PG_RETURN_BOOL(res);
+}
+
+/*
+ * Hash, consistent with jsonb_eq: equal numbers of different display
+ * scales hash alike.
+ */
+Datum
+jsonb_hash(PG_FUNCTION_ARGS)
+{
+	Jsonb	   *jb = PG_GETARG_JSONB(0);
+	uint32		hash = JsonbHashContainer(&jb->root);
+
+	PG_FREE_IF_COPY(jb, 0);
+	PG_RETURN_INT32(hash);
+}
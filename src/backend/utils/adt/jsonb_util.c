@@ -0,0 +1,732 @@
+/*-------------------------------------------------------------------------
+ *
+ * jsonb_util.c
+ *	  Building, reading and comparing the binary form of jsonb
+ *
+ * See jsonb.h for the layout.  Nothing here expands a serialized
+ * container: lookups, comparisons and containment tests read the
+ * children in place, a child being reached from its JEntry and the one
+ * before it in constant time.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/jsonb_util.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/hash.h"
+#include "catalog/pg_collation.h"
+#include "miscadmin.h"
+#include "utils/builtins.h"
+#include "utils/json.h"
+#include "utils/jsonb.h"
+
+static int	reserveFromBuffer(StringInfo buffer, int len);
+static void padBufferToInt(StringInfo buffer);
+static void convertJsonbContainer(StringInfo buffer, JsonbValue *val);
+static JEntry convertJsonbChild(StringInfo buffer, JsonbValue *val);
+static char *containerData(JsonbContainer *container);
+static int	lengthCompareJsonbString(const char *a, int alen,
+						 const char *b, int blen);
+static int	lengthCompareJsonbPair(const void *a, const void *b);
+static int	jsonbTypeRank(JsonbValue *val);
+static int	compareJsonbScalars(JsonbValue *a, JsonbValue *b);
+static int	compareJsonbValues(JsonbValue *a, JsonbValue *b);
+static bool containsJsonbValue(JsonbValue *val, JsonbValue *tmpl);
+static uint32 hashJsonbValue(JsonbValue *val);
+static void rootValue(JsonbContainer *container, JsonbValue *result);
+
+/*
+ * JsonbValueToJsonb
+ *
+ * Serialize a JSON value into a new jsonb datum.  A scalar becomes the
+ * single element of a raw scalar array, a jbvBinary container is copied.
+ */
+Jsonb *
+JsonbValueToJsonb(JsonbValue *val)
+{
+	StringInfoData buffer;
+	JsonbValue	scalarArray;
+
+	if (val->type == jbvBinary)
+	{
+		Jsonb	   *result = palloc(VARHDRSZ + val->val.binary.len);
+
+		SET_VARSIZE(result, VARHDRSZ + val->val.binary.len);
+		memcpy(&result->root, val->val.binary.data, val->val.binary.len);
+		return result;
+	}
+
+	if (IsAJsonbScalar(val))
+	{
+		scalarArray.type = jbvArray;
+		scalarArray.val.array.nElems = 1;
+		scalarArray.val.array.elems = val;
+		scalarArray.val.array.rawScalar = true;
+		val = &scalarArray;
+	}
+
+	initStringInfo(&buffer);
+	reserveFromBuffer(&buffer, VARHDRSZ);
+	convertJsonbContainer(&buffer, val);
+	SET_VARSIZE(buffer.data, buffer.len);
+
+	return (Jsonb *) buffer.data;
+}
+
+/* Reserve "len" bytes at the end of the buffer, returning their offset */
+static int
+reserveFromBuffer(StringInfo buffer, int len)
+{
+	int			offset;
+
+	enlargeStringInfo(buffer, len);
+	offset = buffer->len;
+	buffer->len += len;
+	buffer->data[buffer->len] = '\0';
+
+	return offset;
+}
+
+/*
+ * The datum starting INTALIGN'd, aligning the offset in the buffer aligns
+ * the address the child will be read at.
+ */
+static void
+padBufferToInt(StringInfo buffer)
+{
+	int			padlen = INTALIGN(buffer->len) - buffer->len;
+
+	if (padlen > 0)
+		memset(buffer->data + reserveFromBuffer(buffer, padlen), 0, padlen);
+}
+
+static void
+convertJsonbContainer(StringInfo buffer, JsonbValue *val)
+{
+	uint32		header;
+	int			nchildren;
+	int			base;
+	int			dataStart;
+	int			i;
+
+	check_stack_depth();
+
+	if (val->type == jbvObject)
+	{
+		header = val->val.object.nPairs | JB_FOBJECT;
+		nchildren = val->val.object.nPairs * 2;
+	}
+	else
+	{
+		Assert(val->type == jbvArray);
+		header = val->val.array.nElems | JB_FARRAY;
+		if (val->val.array.rawScalar)
+			header |= JB_FSCALAR;
+		nchildren = val->val.array.nElems;
+	}
+
+	base = reserveFromBuffer(buffer,
+							 offsetof(JsonbContainer, children) +
+							 nchildren * sizeof(JEntry));
+	memcpy(buffer->data + base, &header, sizeof(uint32));
+	dataStart = buffer->len;
+
+	for (i = 0; i < nchildren; i++)
+	{
+		JsonbValue *child;
+		JEntry		entry;
+		uint32		endpos;
+
+		if (val->type == jbvArray)
+			child = &val->val.array.elems[i];
+		else if (i < val->val.object.nPairs)
+			child = &val->val.object.pairs[i].key;
+		else
+			child = &val->val.object.pairs[i - val->val.object.nPairs].value;
+
+		entry = convertJsonbChild(buffer, child);
+
+		endpos = buffer->len - dataStart;
+		if (endpos > JENTRY_OFFMASK)
+			ereport(ERROR,
+					(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+					 errmsg("total size of jsonb container elements exceeds the maximum of %u bytes",
+							JENTRY_OFFMASK)));
+		entry |= endpos;
+
+		memcpy(buffer->data + base + offsetof(JsonbContainer, children) +
+			   i * sizeof(JEntry), &entry, sizeof(JEntry));
+	}
+}
+
+/* Append the data of one child, returning the type bits of its JEntry */
+static JEntry
+convertJsonbChild(StringInfo buffer, JsonbValue *val)
+{
+	switch (val->type)
+	{
+		case jbvNull:
+			return JENTRY_ISNULL;
+		case jbvBool:
+			return val->val.boolean ? JENTRY_ISBOOL_TRUE : JENTRY_ISBOOL_FALSE;
+		case jbvString:
+			appendBinaryStringInfo(buffer, val->val.string.val,
+								   val->val.string.len);
+			return JENTRY_ISSTRING;
+		case jbvNumeric:
+			padBufferToInt(buffer);
+			appendBinaryStringInfo(buffer, (char *) val->val.numeric,
+								   VARSIZE_ANY(val->val.numeric));
+			return JENTRY_ISNUMERIC;
+		case jbvArray:
+		case jbvObject:
+			padBufferToInt(buffer);
+			convertJsonbContainer(buffer, val);
+			return JENTRY_ISCONTAINER;
+		case jbvBinary:
+			padBufferToInt(buffer);
+			appendBinaryStringInfo(buffer, (char *) val->val.binary.data,
+								   val->val.binary.len);
+			return JENTRY_ISCONTAINER;
+	}
+
+	elog(ERROR, "unknown type of jsonb value: %d", (int) val->type);
+	return 0;					/* keep compiler quiet */
+}
+
+/* Start of the data area of a container, right after its JEntries */
+static char *
+containerData(JsonbContainer *container)
+{
+	uint32		nchildren = JsonContainerSize(container);
+
+	if (JsonContainerIsObject(container))
+		nchildren *= 2;
+
+	return (char *) &container->children[nchildren];
+}
+
+/*
+ * JsonbContainerGetChild
+ *
+ * Read child "index" of a container: an array element, an object key if
+ * index is below the count of pairs, or else the value of the pair
+ * index - count.  Containers are returned as jbvBinary.
+ */
+void
+JsonbContainerGetChild(JsonbContainer *container, int index,
+					   JsonbValue *result)
+{
+	char	   *data = containerData(container);
+	JEntry		entry = container->children[index];
+	uint32		start;
+	uint32		end = JBE_ENDPOS(entry);
+
+	start = index == 0 ? 0 : JBE_ENDPOS(container->children[index - 1]);
+
+	switch (JBE_TYPE(entry))
+	{
+		case JENTRY_ISSTRING:
+			result->type = jbvString;
+			result->val.string.val = data + start;
+			result->val.string.len = end - start;
+			break;
+		case JENTRY_ISNUMERIC:
+			result->type = jbvNumeric;
+			result->val.numeric = (Numeric) (data + INTALIGN(start));
+			break;
+		case JENTRY_ISBOOL_FALSE:
+		case JENTRY_ISBOOL_TRUE:
+			result->type = jbvBool;
+			result->val.boolean = (JBE_TYPE(entry) == JENTRY_ISBOOL_TRUE);
+			break;
+		case JENTRY_ISNULL:
+			result->type = jbvNull;
+			break;
+		case JENTRY_ISCONTAINER:
+			result->type = jbvBinary;
+			result->val.binary.data = (JsonbContainer *) (data + INTALIGN(start));
+			result->val.binary.len = end - INTALIGN(start);
+			break;
+		default:
+			elog(ERROR, "unknown type of jsonb entry: %u", JBE_TYPE(entry));
+	}
+}
+
+/* Key order of objects: shorter keys first, then bytewise */
+static int
+lengthCompareJsonbString(const char *a, int alen, const char *b, int blen)
+{
+	if (alen != blen)
+		return alen > blen ? 1 : -1;
+	return memcmp(a, b, alen);
+}
+
+static int
+lengthCompareJsonbPair(const void *a, const void *b)
+{
+	const JsonbPair *pa = (const JsonbPair *) a;
+	const JsonbPair *pb = (const JsonbPair *) b;
+	int			res;
+
+	res = lengthCompareJsonbString(pa->key.val.string.val,
+								   pa->key.val.string.len,
+								   pb->key.val.string.val,
+								   pb->key.val.string.len);
+	if (res == 0)
+		res = pa->order > pb->order ? 1 : -1;
+
+	return res;
+}
+
+/*
+ * JsonbUniquifyObject
+ *
+ * Sort the pairs of an object being built into key order, keeping only
+ * the last value given for a key.
+ */
+void
+JsonbUniquifyObject(JsonbValue *object)
+{
+	JsonbPair  *pairs = object->val.object.pairs;
+	int			npairs = object->val.object.nPairs;
+	int			i;
+	int			last = 0;
+
+	Assert(object->type == jbvObject);
+
+	if (npairs < 2)
+		return;
+
+	qsort(pairs, npairs, sizeof(JsonbPair), lengthCompareJsonbPair);
+
+	for (i = 1; i < npairs; i++)
+	{
+		if (lengthCompareJsonbString(pairs[i].key.val.string.val,
+									 pairs[i].key.val.string.len,
+									 pairs[last].key.val.string.val,
+									 pairs[last].key.val.string.len) != 0)
+			last++;
+		if (last != i)
+			pairs[last] = pairs[i];
+	}
+	object->val.object.nPairs = last + 1;
+}
+
+/*
+ * JsonbFindObjectKey
+ *
+ * Binary search for a key of an object container, returning its value in
+ * *result if result is not NULL.
+ */
+bool
+JsonbFindObjectKey(JsonbContainer *container, const char *key, int keylen,
+				   JsonbValue *result)
+{
+	uint32		npairs = JsonContainerSize(container);
+	uint32		lo = 0;
+	uint32		hi = npairs;
+
+	Assert(JsonContainerIsObject(container));
+
+	while (lo < hi)
+	{
+		uint32		mid = lo + (hi - lo) / 2;
+		JsonbValue	candidate;
+		int			res;
+
+		JsonbContainerGetChild(container, mid, &candidate);
+		res = lengthCompareJsonbString(candidate.val.string.val,
+									   candidate.val.string.len,
+									   key, keylen);
+		if (res == 0)
+		{
+			if (result)
+				JsonbContainerGetChild(container, npairs + mid, result);
+			return true;
+		}
+		if (res < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return false;
+}
+
+/* Whether one element of an array container is the given string */
+bool
+JsonbFindArrayString(JsonbContainer *container, const char *str, int len)
+{
+	uint32		nelems = JsonContainerSize(container);
+	uint32		i;
+
+	Assert(JsonContainerIsArray(container));
+
+	for (i = 0; i < nelems; i++)
+	{
+		JsonbValue	elem;
+
+		if (JBE_TYPE(container->children[i]) != JENTRY_ISSTRING)
+			continue;
+		JsonbContainerGetChild(container, i, &elem);
+		if (elem.val.string.len == len &&
+			memcmp(elem.val.string.val, str, len) == 0)
+			return true;
+	}
+
+	return false;
+}
+
+/*
+ * Rank of the types in the ordering of jsonb values:
+ * null < string < number < boolean < array < object.
+ */
+static int
+jsonbTypeRank(JsonbValue *val)
+{
+	switch (val->type)
+	{
+		case jbvNull:
+			return 0;
+		case jbvString:
+			return 1;
+		case jbvNumeric:
+			return 2;
+		case jbvBool:
+			return 3;
+		case jbvArray:
+			return 4;
+		case jbvObject:
+			return 5;
+		case jbvBinary:
+			return JsonContainerIsObject(val->val.binary.data) ? 5 : 4;
+	}
+
+	elog(ERROR, "unknown type of jsonb value: %d", (int) val->type);
+	return 0;					/* keep compiler quiet */
+}
+
+/* Compare two scalars of the same type */
+static int
+compareJsonbScalars(JsonbValue *a, JsonbValue *b)
+{
+	switch (a->type)
+	{
+		case jbvNull:
+			return 0;
+		case jbvString:
+			return varstr_cmp(a->val.string.val, a->val.string.len,
+							  b->val.string.val, b->val.string.len,
+							  DEFAULT_COLLATION_OID);
+		case jbvNumeric:
+			return DatumGetInt32(DirectFunctionCall2(numeric_cmp,
+										   NumericGetDatum(a->val.numeric),
+										  NumericGetDatum(b->val.numeric)));
+		case jbvBool:
+			if (a->val.boolean == b->val.boolean)
+				return 0;
+			return a->val.boolean ? 1 : -1;
+		default:
+			elog(ERROR, "invalid jsonb scalar type: %d", (int) a->type);
+	}
+
+	return 0;					/* keep compiler quiet */
+}
+
+/*
+ * Compare two values, containers being jbvBinary.  Containers of more
+ * children sort after, containers of as many children compare child by
+ * child, that is keys first and then values for objects.
+ */
+static int
+compareJsonbValues(JsonbValue *a, JsonbValue *b)
+{
+	JsonbContainer *ca;
+	JsonbContainer *cb;
+	uint32		nchildren;
+	uint32		i;
+	int			ra = jsonbTypeRank(a);
+	int			rb = jsonbTypeRank(b);
+
+	if (ra != rb)
+		return ra > rb ? 1 : -1;
+
+	if (IsAJsonbScalar(a))
+		return compareJsonbScalars(a, b);
+
+	check_stack_depth();
+
+	ca = a->val.binary.data;
+	cb = b->val.binary.data;
+	if (JsonContainerSize(ca) != JsonContainerSize(cb))
+		return JsonContainerSize(ca) > JsonContainerSize(cb) ? 1 : -1;
+
+	nchildren = JsonContainerSize(ca);
+	if (JsonContainerIsObject(ca))
+		nchildren *= 2;
+
+	for (i = 0; i < nchildren; i++)
+	{
+		JsonbValue	va;
+		JsonbValue	vb;
+		int			res;
+
+		JsonbContainerGetChild(ca, i, &va);
+		JsonbContainerGetChild(cb, i, &vb);
+		res = compareJsonbValues(&va, &vb);
+		if (res != 0)
+			return res;
+	}
+
+	return 0;
+}
+
+/* The value a root container stands for, unwrapping raw scalars */
+static void
+rootValue(JsonbContainer *container, JsonbValue *result)
+{
+	if (JsonContainerIsScalar(container))
+		JsonbContainerGetChild(container, 0, result);
+	else
+	{
+		result->type = jbvBinary;
+		result->val.binary.data = container;
+		result->val.binary.len = 0;		/* unused */
+	}
+}
+
+/* Total order of jsonb documents, for the btree operator class */
+int
+JsonbCompareContainers(JsonbContainer *a, JsonbContainer *b)
+{
+	JsonbValue	va;
+	JsonbValue	vb;
+
+	rootValue(a, &va);
+	rootValue(b, &vb);
+
+	return compareJsonbValues(&va, &vb);
+}
+
+/*
+ * JsonbDeepContains
+ *
+ * Whether container "val" contains container "tmpl": every pair of an
+ * object template must be found under the same key with a contained
+ * value, every element of an array template must be contained in some
+ * element.  A raw scalar is contained in an array having it as element,
+ * whereas a raw scalar only contains the same raw scalar.
+ */
+bool
+JsonbDeepContains(JsonbContainer *val, JsonbContainer *tmpl)
+{
+	uint32		ntmpl = JsonContainerSize(tmpl);
+	uint32		nval = JsonContainerSize(val);
+	uint32		i;
+
+	check_stack_depth();
+
+	if (JsonContainerIsObject(val) != JsonContainerIsObject(tmpl))
+		return false;
+
+	if (JsonContainerIsObject(tmpl))
+	{
+		/* keys are unique, so a bigger template cannot be contained */
+		if (ntmpl > nval)
+			return false;
+
+		for (i = 0; i < ntmpl; i++)
+		{
+			JsonbValue	key;
+			JsonbValue	tmplValue;
+			JsonbValue	valValue;
+
+			JsonbContainerGetChild(tmpl, i, &key);
+			if (!JsonbFindObjectKey(val, key.val.string.val,
+									key.val.string.len, &valValue))
+				return false;
+
+			JsonbContainerGetChild(tmpl, ntmpl + i, &tmplValue);
+			if (!containsJsonbValue(&valValue, &tmplValue))
+				return false;
+		}
+		return true;
+	}
+
+	if (JsonContainerIsScalar(val) && !JsonContainerIsScalar(tmpl))
+		return false;
+
+	for (i = 0; i < ntmpl; i++)
+	{
+		JsonbValue	tmplElem;
+		bool		found = false;
+		uint32		j;
+
+		JsonbContainerGetChild(tmpl, i, &tmplElem);
+		for (j = 0; j < nval && !found; j++)
+		{
+			JsonbValue	valElem;
+
+			JsonbContainerGetChild(val, j, &valElem);
+			found = containsJsonbValue(&valElem, &tmplElem);
+		}
+		if (!found)
+			return false;
+	}
+
+	return true;
+}
+
+/* A scalar contains an equal scalar, a container a contained container */
+static bool
+containsJsonbValue(JsonbValue *val, JsonbValue *tmpl)
+{
+	if (IsAJsonbScalar(tmpl))
+		return val->type == tmpl->type && compareJsonbScalars(val, tmpl) == 0;
+
+	return val->type == jbvBinary &&
+		JsonbDeepContains(val->val.binary.data, tmpl->val.binary.data);
+}
+
+static uint32
+hashJsonbValue(JsonbValue *val)
+{
+	JsonbContainer *container;
+	uint32		hash;
+	uint32		nchildren;
+	uint32		i;
+
+	switch (val->type)
+	{
+		case jbvNull:
+			return 0x01;
+		case jbvBool:
+			return val->val.boolean ? 0x02 : 0x04;
+		case jbvString:
+			return DatumGetUInt32(hash_any((unsigned char *) val->val.string.val,
+										   val->val.string.len));
+		case jbvNumeric:
+			/* hash_numeric ignores the display scale, as numeric_cmp */
+			return DatumGetUInt32(DirectFunctionCall1(hash_numeric,
+									   NumericGetDatum(val->val.numeric)));
+		case jbvBinary:
+			break;
+		default:
+			elog(ERROR, "unexpected type of jsonb value: %d", (int) val->type);
+	}
+
+	check_stack_depth();
+
+	container = val->val.binary.data;
+	hash = container->header;
+	nchildren = JsonContainerSize(container);
+	if (JsonContainerIsObject(container))
+		nchildren *= 2;
+
+	for (i = 0; i < nchildren; i++)
+	{
+		JsonbValue	child;
+
+		JsonbContainerGetChild(container, i, &child);
+		hash = (hash << 1) | (hash >> 31);
+		hash ^= hashJsonbValue(&child);
+	}
+
+	return hash;
+}
+
+/* Hash of a document, equal for documents equal per the btree order */
+uint32
+JsonbHashContainer(JsonbContainer *container)
+{
+	JsonbValue	val;
+
+	rootValue(container, &val);
+
+	return hashJsonbValue(&val);
+}
+
+/* Append the text form of a value, containers being jbvBinary */
+void
+JsonbValueToCString(StringInfo out, JsonbValue *val)
+{
+	JsonbContainer *container;
+	uint32		count;
+	uint32		i;
+
+	switch (val->type)
+	{
+		case jbvNull:
+			appendStringInfoString(out, "null");
+			return;
+		case jbvBool:
+			appendStringInfoString(out, val->val.boolean ? "true" : "false");
+			return;
+		case jbvString:
+			escape_json(out, pnstrdup(val->val.string.val,
+									  val->val.string.len));
+			return;
+		case jbvNumeric:
+			appendStringInfoString(out,
+					DatumGetCString(DirectFunctionCall1(numeric_out,
+									  NumericGetDatum(val->val.numeric))));
+			return;
+		case jbvBinary:
+			break;
+		default:
+			elog(ERROR, "unexpected type of jsonb value: %d", (int) val->type);
+	}
+
+	check_stack_depth();
+
+	container = val->val.binary.data;
+	count = JsonContainerSize(container);
+
+	if (JsonContainerIsObject(container))
+	{
+		appendStringInfoChar(out, '{');
+		for (i = 0; i < count; i++)
+		{
+			JsonbValue	key;
+			JsonbValue	value;
+
+			if (i > 0)
+				appendStringInfoString(out, ", ");
+			JsonbContainerGetChild(container, i, &key);
+			JsonbContainerGetChild(container, count + i, &value);
+			JsonbValueToCString(out, &key);
+			appendStringInfoString(out, ": ");
+			JsonbValueToCString(out, &value);
+		}
+		appendStringInfoChar(out, '}');
+	}
+	else
+	{
+		appendStringInfoChar(out, '[');
+		for (i = 0; i < count; i++)
+		{
+			JsonbValue	elem;
+
+			if (i > 0)
+				appendStringInfoString(out, ", ");
+			JsonbContainerGetChild(container, i, &elem);
+			JsonbValueToCString(out, &elem);
+		}
+		appendStringInfoChar(out, ']');
+	}
+}
+
+/* Append the text form of a document */
+void
+JsonbToCString(StringInfo out, JsonbContainer *container)
+{
+	JsonbValue	val;
+
+	rootValue(container, &val);
+	JsonbValueToCString(out, &val);
+}
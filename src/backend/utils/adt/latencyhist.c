@@ -0,0 +1,219 @@
+/*-------------------------------------------------------------------------
+ *
+ * latencyhist.c
+ *
+ *	  Fixed size, log-linear histograms of latencies
+ *
+ * See latencyhist.h for the layout of the buckets.  The statistics
+ * collector keeps one histogram per database and pg_stat_statements one
+ * per statement; the SQL functions here read and merge them in their
+ * int8[] form.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/latencyhist.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "catalog/pg_type.h"
+#include "nodes/execnodes.h"
+#include "utils/latencyhist.h"
+
+static void check_histogram_array(ArrayType *array);
+
+/* Bucket counting a duration of "usec" microseconds */
+int
+LatencyHistBucket(uint64 usec)
+{
+	uint64		val;
+	int			msb = 0;
+	int			bucket;
+
+	if (usec < LATENCY_HIST_SUB)
+		return (int) usec;
+
+	for (val = usec; val > 1; val >>= 1)
+		msb++;
+
+	bucket = (msb - LATENCY_HIST_SUB_BITS + 1) * LATENCY_HIST_SUB +
+		(int) ((usec >> (msb - LATENCY_HIST_SUB_BITS)) & (LATENCY_HIST_SUB - 1));
+
+	return Min(bucket, LATENCY_HIST_BUCKETS - 1);
+}
+
+/* Lower bound and width of bucket "bucket", in microseconds */
+static void
+bucket_bounds(int bucket, double *lower, double *width)
+{
+	int			shift;
+
+	if (bucket < LATENCY_HIST_SUB)
+	{
+		*lower = bucket;
+		*width = 1;
+		return;
+	}
+
+	shift = bucket / LATENCY_HIST_SUB - 1;
+	*lower = (double) ((uint64) (LATENCY_HIST_SUB + bucket % LATENCY_HIST_SUB) << shift);
+	*width = (double) ((uint64) 1 << shift);
+}
+
+/*
+ * LatencyHistPercentile
+ *
+ * Estimate the duration, in microseconds, below which "fraction" of the
+ * counted durations fall, interpolating linearly inside the bucket.  The
+ * last bucket being open, a percentile falling in it is its lower bound.
+ * Returns -1 if the histogram is empty.
+ */
+double
+LatencyHistPercentile(const int64 *counts, int nbuckets, double fraction)
+{
+	double		total = 0;
+	double		target;
+	double		cumulated = 0;
+	int			i;
+
+	for (i = 0; i < nbuckets; i++)
+		total += counts[i];
+	if (total <= 0)
+		return -1;
+
+	target = fraction * total;
+	for (i = 0; i < nbuckets; i++)
+	{
+		double		lower;
+		double		width;
+
+		if (counts[i] <= 0)
+			continue;
+
+		if (cumulated + counts[i] >= target || i == nbuckets - 1)
+		{
+			bucket_bounds(i, &lower, &width);
+			if (i == LATENCY_HIST_BUCKETS - 1)
+				return lower;
+			return lower + width * (target - cumulated) / counts[i];
+		}
+		cumulated += counts[i];
+	}
+
+	return -1;					/* keep compiler quiet */
+}
+
+/* Build the int8[] form of a histogram of LATENCY_HIST_BUCKETS counters */
+ArrayType *
+LatencyHistGetArray(const int64 *counts)
+{
+	Datum		elems[LATENCY_HIST_BUCKETS];
+	int			i;
+
+	for (i = 0; i < LATENCY_HIST_BUCKETS; i++)
+		elems[i] = Int64GetDatum(counts[i]);
+
+	return construct_array(elems, LATENCY_HIST_BUCKETS, INT8OID,
+						   sizeof(int64), FLOAT8PASSBYVAL, 'd');
+}
+
+static void
+check_histogram_array(ArrayType *array)
+{
+	if (ARR_NDIM(array) > 1 || ARR_HASNULL(array) ||
+		ARR_ELEMTYPE(array) != INT8OID ||
+		ArrayGetNItems(ARR_NDIM(array), ARR_DIMS(array)) > LATENCY_HIST_BUCKETS)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("latency histogram must be a one-dimensional array of at most %d non-null bigints",
+						LATENCY_HIST_BUCKETS)));
+}
+
+/*
+ * latency_percentile(histogram, fraction)
+ *
+ * The duration in milliseconds below which "fraction" of the durations of
+ * the histogram fall, NULL if the histogram is empty.
+ */
+Datum
+latency_percentile(PG_FUNCTION_ARGS)
+{
+	ArrayType  *array = PG_GETARG_ARRAYTYPE_P(0);
+	float8		fraction = PG_GETARG_FLOAT8(1);
+	double		usec;
+
+	check_histogram_array(array);
+	if (fraction < 0 || fraction > 1)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("percentile fraction %g is not between 0 and 1",
+						fraction)));
+
+	usec = LatencyHistPercentile((int64 *) ARR_DATA_PTR(array),
+								 ArrayGetNItems(ARR_NDIM(array), ARR_DIMS(array)),
+								 fraction);
+	if (usec < 0)
+		PG_RETURN_NULL();
+
+	PG_RETURN_FLOAT8(usec / 1000.0);
+}
+
+/*
+ * latency_histogram_add(histogram, histogram)
+ *
+ * The sum of two histograms, also the transition and collection function
+ * of the latency_histogram_merge() aggregate.  A NULL histogram is empty.
+ */
+Datum
+latency_histogram_add(PG_FUNCTION_ARGS)
+{
+	ArrayType  *result;
+	ArrayType  *other;
+	int64	   *sum;
+	int64	   *add;
+	int			nsum;
+	int			nadd;
+	int			i;
+
+	if (PG_ARGISNULL(0) && PG_ARGISNULL(1))
+		PG_RETURN_NULL();
+	if (PG_ARGISNULL(1))
+	{
+		check_histogram_array(PG_GETARG_ARRAYTYPE_P(0));
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+	}
+	if (PG_ARGISNULL(0))
+	{
+		check_histogram_array(PG_GETARG_ARRAYTYPE_P(1));
+		PG_RETURN_ARRAYTYPE_P(PG_GETARG_ARRAYTYPE_P_COPY(1));
+	}
+
+	/*
+	 * If we're invoked by nodeAgg, we can cheat and add to our first
+	 * parameter in-place.  Otherwise we need to make a copy of it.
+	 */
+	if (fcinfo->context && IsA(fcinfo->context, AggState))
+		result = PG_GETARG_ARRAYTYPE_P(0);
+	else
+		result = PG_GETARG_ARRAYTYPE_P_COPY(0);
+	other = PG_GETARG_ARRAYTYPE_P(1);
+
+	check_histogram_array(result);
+	check_histogram_array(other);
+	nsum = ArrayGetNItems(ARR_NDIM(result), ARR_DIMS(result));
+	nadd = ArrayGetNItems(ARR_NDIM(other), ARR_DIMS(other));
+	if (nsum != nadd)
+		ereport(ERROR,
+				(errcode(ERRCODE_ARRAY_SUBSCRIPT_ERROR),
+				 errmsg("cannot add latency histograms of %d and %d buckets",
+						nsum, nadd)));
+
+	sum = (int64 *) ARR_DATA_PTR(result);
+	add = (int64 *) ARR_DATA_PTR(other);
+	for (i = 0; i < nsum; i++)
+		sum[i] += add[i];
+
+	PG_RETURN_ARRAYTYPE_P(result);
+}
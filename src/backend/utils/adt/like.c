@@ -125,6 +125,9 @@ SB_lower_char(unsigned char c, pg_locale_t locale, bool locale_is_c)
 #define CHAREQ(p1, p2) (*(p1) == *(p2))
 #define NextChar(p, plen) NextByte((p), (plen))
 #define CopyAdvChar(dst, src, srclen) (*(dst)++ = *(src)++, (srclen)--)
+#ifdef ADB
+#define MATCH_BYTE_SCAN
+#endif
 
 #define MatchText	SB_MatchText
 #define do_like_escape	SB_do_like_escape
@@ -142,6 +145,10 @@ SB_lower_char(unsigned char c, pg_locale_t locale, bool locale_is_c)
 
 #define NextChar(p, plen) \
 	do { (p)++; (plen)--; } while ((plen) > 0 && (*(p) & 0xC0) == 0x80 )
+#ifdef ADB
+/* a lead byte never matches a continuation byte */
+#define MATCH_BYTE_SCAN
+#endif
 #define MatchText	UTF8_MatchText
 
 #include "like_match.c"
@@ -15,6 +15,8 @@
  * MatchText - to name of function wanted
  * do_like_escape - name of function if wanted - needs CHAREQ and CopyAdvChar
  * MATCH_LOWER - define for case (4) to specify case folding for 1-byte chars
+ * MATCH_BYTE_SCAN - define if a byte of the pattern matching a byte of the
+ *		text is always at a character boundary, so % can be scanned by memchr()
  *
  * Copyright (c) 1996-2013, PostgreSQL Global Development Group
  *
@@ -170,6 +172,24 @@ MatchText(char *t, int tlen, char *p, int plen,
 			else
 				firstpat = GETCHAR(*p);
 
+#ifdef MATCH_BYTE_SCAN
+			while (tlen > 0)
+			{
+				char	   *next = memchr(t, firstpat, tlen);
+				int			matched;
+
+				if (next == NULL)
+					break;
+				tlen -= next - t;
+				t = next;
+
+				matched = MatchText(t, tlen, p, plen, locale, locale_is_c);
+				if (matched != LIKE_FALSE)
+					return matched; /* TRUE or ABORT */
+
+				NextChar(t, tlen);
+			}
+#else
 			while (tlen > 0)
 			{
 				if (GETCHAR(*t) == firstpat)
@@ -183,6 +203,7 @@ MatchText(char *t, int tlen, char *p, int plen,
 
 				NextChar(t, tlen);
 			}
+#endif
 
 			/*
 			 * End of text with no match, so no point in trying later places
@@ -353,6 +374,10 @@ do_like_escape(text *pat, text *esc)
 
 #undef GETCHAR
 
+#ifdef MATCH_BYTE_SCAN
+#undef MATCH_BYTE_SCAN
+#endif
+
 #ifdef MATCH_LOWER
 #undef MATCH_LOWER
 
@@ -20,6 +20,7 @@
 #include <math.h>
 #include <unistd.h>
 
+#include "access/htup_details.h"
 #include "catalog/catalog.h"
 #include "catalog/pg_tablespace.h"
 #include "catalog/pg_type.h"
@@ -38,6 +39,11 @@
 #include "tcop/tcopprot.h"
 #include "utils/builtins.h"
 #include "utils/timestamp.h"
+#ifdef ADB
+#include "utils/catcache.h"
+#include "utils/mcxtreport.h"
+#include "utils/relcache.h"
+#endif
 #ifdef PGXC
 #include "pgxc/pgxc.h"
 #endif
@@ -597,3 +603,135 @@ pg_column_is_updatable(PG_FUNCTION_ARGS)
 
 	PG_RETURN_BOOL((events & REQ_EVENTS) == REQ_EVENTS);
 }
+
+#ifdef ADB
+/*
+ * Report the size and activity of the catalog and relation caches of the
+ * current backend, backing the pg_backend_cache_usage view.
+ */
+Datum
+pg_backend_cache_usage(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		TupleDesc	tupdesc;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+			elog(ERROR, "return type must be a row type");
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+
+	if (funcctx->call_cntr < 2)
+	{
+		Datum		values[7];
+		bool		nulls[7];
+		int64		entries;
+		int64		size;
+		int64		hits;
+		int64		misses;
+		int64		evictions;
+		int			limit;
+		HeapTuple	tuple;
+
+		if (funcctx->call_cntr == 0)
+		{
+			values[0] = CStringGetTextDatum("catalog");
+			CatalogCacheGetUsage(&entries, &size, &hits, &misses, &evictions);
+			limit = catalog_cache_memory_limit;
+		}
+		else
+		{
+			values[0] = CStringGetTextDatum("relation");
+			RelationCacheGetUsage(&entries, &size, &hits, &misses, &evictions);
+			limit = relation_cache_memory_limit;
+		}
+
+		MemSet(nulls, 0, sizeof(nulls));
+		values[1] = Int64GetDatum(entries);
+		values[2] = Int64GetDatum(size);
+		if (limit > 0)
+			values[3] = Int64GetDatum((int64) limit * 1024);
+		else
+			nulls[3] = true;
+		values[4] = Int64GetDatum(hits);
+		values[5] = Int64GetDatum(misses);
+		values[6] = Int64GetDatum(evictions);
+
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
+
+/*
+ * List the memory contexts of backend "pid" holding the most memory,
+ * counting their descendants.
+ */
+Datum
+pg_backend_memory_contexts(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	MemoryContextReportEntry *entries;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		TupleDesc	tupdesc;
+		int			nentries;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+			elog(ERROR, "return type must be a row type");
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+
+		entries = (MemoryContextReportEntry *)
+			palloc(MEMORY_CONTEXT_REPORT_SIZE * sizeof(MemoryContextReportEntry));
+		nentries = GetBackendMemoryContexts(PG_GETARG_INT32(0), entries);
+		funcctx->max_calls = nentries > 0 ? nentries : 0;
+		funcctx->user_fctx = entries;
+
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	entries = (MemoryContextReportEntry *) funcctx->user_fctx;
+
+	if (funcctx->call_cntr < funcctx->max_calls)
+	{
+		MemoryContextReportEntry *entry = &entries[funcctx->call_cntr];
+		Datum		values[5];
+		bool		nulls[5];
+		HeapTuple	tuple;
+
+		MemSet(nulls, 0, sizeof(nulls));
+		values[0] = CStringGetTextDatum(entry->name);
+		if (entry->parent[0] != '\0')
+			values[1] = CStringGetTextDatum(entry->parent);
+		else
+			nulls[1] = true;
+		values[2] = Int32GetDatum(entry->level);
+		values[3] = Int64GetDatum((int64) entry->bytes);
+		values[4] = Int64GetDatum((int64) entry->total_bytes);
+
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
+#endif
@@ -385,6 +385,14 @@ static char *get_str_from_var_sci(NumericVar *var, int rscale);
 
 static Numeric make_result(NumericVar *var);
 
+#if defined(ADB) && NBASE == 10000
+#define NUMERIC_INT64_FASTPATH
+static bool numeric_int64_pair(Numeric num1, Numeric num2,
+				   int64 *val1, int64 *val2, int *frac);
+static int64 numeric_digits_int64(Numeric num, int frac);
+static Numeric int64_frac_to_numeric(int64 val, int frac, int dscale);
+#endif
+
 static void apply_typmod(NumericVar *var, int32 typmod);
 
 static int32 numericvar_to_int4(NumericVar *var);
@@ -1485,6 +1493,14 @@ cmp_numerics(Numeric num1, Numeric num2)
 	}
 	else
 	{
+#ifdef NUMERIC_INT64_FASTPATH
+		int64		val1;
+		int64		val2;
+		int			frac;
+
+		if (numeric_int64_pair(num1, num2, &val1, &val2, &frac))
+			return (val1 > val2) - (val1 < val2);
+#endif
 		result = cmp_var_common(NUMERIC_DIGITS(num1), NUMERIC_NDIGITS(num1),
 								NUMERIC_WEIGHT(num1), NUMERIC_SIGN(num1),
 								NUMERIC_DIGITS(num2), NUMERIC_NDIGITS(num2),
@@ -1593,6 +1609,11 @@ numeric_add(PG_FUNCTION_ARGS)
 	NumericVar	arg2;
 	NumericVar	result;
 	Numeric		res;
+#ifdef NUMERIC_INT64_FASTPATH
+	int64		val1;
+	int64		val2;
+	int			frac;
+#endif
 
 	/*
 	 * Handle NaN
@@ -1600,6 +1621,14 @@ numeric_add(PG_FUNCTION_ARGS)
 	if (NUMERIC_IS_NAN(num1) || NUMERIC_IS_NAN(num2))
 		PG_RETURN_NUMERIC(make_result(&const_nan));
 
+#ifdef NUMERIC_INT64_FASTPATH
+	/* Small values, as most money amounts, are done in an int64 */
+	if (numeric_int64_pair(num1, num2, &val1, &val2, &frac))
+		PG_RETURN_NUMERIC(int64_frac_to_numeric(val1 + val2, frac,
+											   Max(NUMERIC_DSCALE(num1),
+												   NUMERIC_DSCALE(num2))));
+#endif
+
 	/*
 	 * Unpack the values, let add_var() compute the result and return it.
 	 */
@@ -1631,6 +1660,11 @@ numeric_sub(PG_FUNCTION_ARGS)
 	NumericVar	arg2;
 	NumericVar	result;
 	Numeric		res;
+#ifdef NUMERIC_INT64_FASTPATH
+	int64		val1;
+	int64		val2;
+	int			frac;
+#endif
 
 	/*
 	 * Handle NaN
@@ -1638,6 +1672,14 @@ numeric_sub(PG_FUNCTION_ARGS)
 	if (NUMERIC_IS_NAN(num1) || NUMERIC_IS_NAN(num2))
 		PG_RETURN_NUMERIC(make_result(&const_nan));
 
+#ifdef NUMERIC_INT64_FASTPATH
+	/* Small values, as most money amounts, are done in an int64 */
+	if (numeric_int64_pair(num1, num2, &val1, &val2, &frac))
+		PG_RETURN_NUMERIC(int64_frac_to_numeric(val1 - val2, frac,
+											   Max(NUMERIC_DSCALE(num1),
+												   NUMERIC_DSCALE(num2))));
+#endif
+
 	/*
 	 * Unpack the values, let sub_var() compute the result and return it.
 	 */
@@ -3104,6 +3146,57 @@ int4_avg_accum(PG_FUNCTION_ARGS)
 	PG_RETURN_ARRAYTYPE_P(transarray);
 }
 
+/*
+ * Inverse transition functions of int2_avg_accum and int4_avg_accum, for
+ * AVG() over a moving window frame: they remove a value that has left the
+ * frame from the running count and sum.
+ */
+Datum
+int2_avg_accum_inv(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray;
+	int16		newval = PG_GETARG_INT16(1);
+	Int8TransTypeData *transdata;
+
+	if (AggCheckCallContext(fcinfo, NULL))
+		transarray = PG_GETARG_ARRAYTYPE_P(0);
+	else
+		transarray = PG_GETARG_ARRAYTYPE_P_COPY(0);
+
+	if (ARR_HASNULL(transarray) ||
+		ARR_SIZE(transarray) != ARR_OVERHEAD_NONULLS(1) + sizeof(Int8TransTypeData))
+		elog(ERROR, "expected 2-element int8 array");
+
+	transdata = (Int8TransTypeData *) ARR_DATA_PTR(transarray);
+	transdata->count--;
+	transdata->sum -= newval;
+
+	PG_RETURN_ARRAYTYPE_P(transarray);
+}
+
+Datum
+int4_avg_accum_inv(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray;
+	int32		newval = PG_GETARG_INT32(1);
+	Int8TransTypeData *transdata;
+
+	if (AggCheckCallContext(fcinfo, NULL))
+		transarray = PG_GETARG_ARRAYTYPE_P(0);
+	else
+		transarray = PG_GETARG_ARRAYTYPE_P_COPY(0);
+
+	if (ARR_HASNULL(transarray) ||
+		ARR_SIZE(transarray) != ARR_OVERHEAD_NONULLS(1) + sizeof(Int8TransTypeData))
+		elog(ERROR, "expected 2-element int8 array");
+
+	transdata = (Int8TransTypeData *) ARR_DATA_PTR(transarray);
+	transdata->count--;
+	transdata->sum -= newval;
+
+	PG_RETURN_ARRAYTYPE_P(transarray);
+}
+
 Datum
 int8_avg(PG_FUNCTION_ARGS)
 {
@@ -3825,6 +3918,95 @@ make_result(NumericVar *var)
 }
 
 
+#ifdef NUMERIC_INT64_FASTPATH
+/*
+ * Values whose digits span at most this many NBASE digits once aligned on
+ * the same scale are below 10^16, so that two of them and their sum or
+ * difference fit into an int64.
+ */
+#define NUMERIC_INT64_MAX_DIGITS	4
+
+/*
+ * numeric_int64_pair() -
+ *
+ *	Get two non-NaN numerics as counts of NBASE^-frac, if they fit into an
+ *	int64 with room for their sum.
+ */
+static bool
+numeric_int64_pair(Numeric num1, Numeric num2, int64 *val1, int64 *val2,
+				   int *frac)
+{
+	int			weight1 = NUMERIC_WEIGHT(num1);
+	int			weight2 = NUMERIC_WEIGHT(num2);
+	int			frac1 = NUMERIC_NDIGITS(num1) - weight1 - 1;
+	int			frac2 = NUMERIC_NDIGITS(num2) - weight2 - 1;
+
+	/* zero has no digits and weight 0 */
+	*frac = Max(Max(frac1, frac2), 0);
+	if (Max(weight1, weight2) + 1 + *frac > NUMERIC_INT64_MAX_DIGITS)
+		return false;
+
+	*val1 = numeric_digits_int64(num1, *frac);
+	*val2 = numeric_digits_int64(num2, *frac);
+	return true;
+}
+
+/*
+ * numeric_digits_int64() -
+ *
+ *	The value of a numeric in units of NBASE^-frac, for numeric_int64_pair.
+ */
+static int64
+numeric_digits_int64(Numeric num, int frac)
+{
+	NumericDigit *digits = NUMERIC_DIGITS(num);
+	int			ndigits = NUMERIC_NDIGITS(num);
+	int64		val = 0;
+	int			i;
+
+	for (i = 0; i < ndigits; i++)
+		val = val * NBASE + digits[i];
+	for (i = ndigits - NUMERIC_WEIGHT(num) - 1; i < frac; i++)
+		val *= NBASE;
+
+	return NUMERIC_SIGN(num) == NUMERIC_NEG ? -val : val;
+}
+
+/*
+ * int64_frac_to_numeric() -
+ *
+ *	Make a numeric of display scale dscale from a count of NBASE^-frac
+ *	below NBASE^(NUMERIC_INT64_MAX_DIGITS + 1).
+ */
+static Numeric
+int64_frac_to_numeric(int64 val, int frac, int dscale)
+{
+	NumericDigit digits[NUMERIC_INT64_MAX_DIGITS + 1];
+	NumericVar	var;
+	uint64		uval;
+	int			i;
+
+	var.sign = val < 0 ? NUMERIC_NEG : NUMERIC_POS;
+	uval = val < 0 ? -(uint64) val : (uint64) val;
+	for (i = NUMERIC_INT64_MAX_DIGITS; i >= 0; i--)
+	{
+		digits[i] = (NumericDigit) (uval % NBASE);
+		uval /= NBASE;
+	}
+	Assert(uval == 0);
+
+	var.ndigits = NUMERIC_INT64_MAX_DIGITS + 1;
+	var.weight = NUMERIC_INT64_MAX_DIGITS - frac;
+	var.dscale = dscale;
+	var.buf = NULL;
+	var.digits = digits;
+
+	/* make_result strips the leading and trailing zero digits */
+	return make_result(&var);
+}
+#endif
+
+
 /*
  * apply_typmod() -
  *
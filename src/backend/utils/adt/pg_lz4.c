@@ -0,0 +1,345 @@
+/* ----------
+ * pg_lz4.c -
+ *
+ *		This is an implementation of the LZ4 block format for PostgreSQL.
+ *		It trades some compression ratio against pglz for much faster
+ *		compression and decompression, which matters for TOAST values
+ *		that are compressed on every write and decompressed on every read.
+ *
+ *		Entry routines:
+ *
+ *			int32
+ *			pg_lz4_compress(const char *source, int32 slen,
+ *							char *dest, int32 capacity);
+ *
+ *				source is the input data to be compressed.
+ *
+ *				slen is the length of the input data.
+ *
+ *				dest is the output area for the compressed result.
+ *
+ *				capacity is the maximum number of bytes to write to dest.
+ *
+ *				The return value is the length of the compressed data,
+ *				or -1 if it would not fit into capacity bytes; in the
+ *				latter case the contents of dest are undefined.
+ *
+ *			int32
+ *			pg_lz4_decompress(const char *source, int32 slen,
+ *							  char *dest, int32 rawsize);
+ *
+ *				source is the compressed input.
+ *
+ *				slen is the length of the compressed input.
+ *
+ *				dest is the area where the uncompressed data will be
+ *					written to. It is the callers responsibility to
+ *					provide enough space.
+ *
+ *				rawsize is the length of the uncompressed data.
+ *
+ *				The return value is the number of bytes written to dest,
+ *				or -1 if the input is corrupt.  The decompressor never
+ *				reads or writes outside the given buffers, whatever the
+ *				input looks like.
+ *
+ *		The compressed format:
+ *
+ *			The data is a sequence of items.  Each item starts with a
+ *			token byte, whose high nibble is the number of literal bytes
+ *			that follow and whose low nibble is the length of the match
+ *			that follows them, minus 4.  A nibble value of 15 means that
+ *			more length bytes follow the token (for the literal length) or
+ *			the offset (for the match length); each of them is added to
+ *			the length, and a byte value below 255 ends the sequence.
+ *			After the literals comes the 2 byte little endian offset of
+ *			the match, counted backwards from the current output position,
+ *			so matches may reach back up to 65535 bytes.  The last item
+ *			consists of literals only and ends the data.
+ *
+ *			As in the reference implementation, the last 5 bytes of the
+ *			input are always emitted as literals, and no match starts
+ *			within the last 12 bytes, so that data written by either
+ *			implementation can be read by the other.
+ *
+ *		The compression algorithm:
+ *
+ *			A hash table indexed by the next 4 input bytes remembers the
+ *			last position each hash value was seen at.  If the 4 bytes
+ *			found there match, the match is extended in both directions
+ *			as far as possible and emitted; otherwise the input position
+ *			advances.  The step size grows while no match is found, so
+ *			that incompressible data is skipped over quickly.
+ *
+ * Copyright (c) 1999-2013, PostgreSQL Global Development Group
+ *
+ * src/backend/utils/adt/pg_lz4.c
+ * ----------
+ */
+#include "postgres.h"
+
+#include "utils/pg_lz4.h"
+
+
+#define LZ4_MINMATCH			4
+#define LZ4_LASTLITERALS		5
+#define LZ4_MFLIMIT				12
+#define LZ4_MAX_DISTANCE		65535
+#define LZ4_HASH_BITS			12
+#define LZ4_HASH_SIZE			(1 << LZ4_HASH_BITS)
+#define LZ4_SKIP_TRIGGER		6
+
+#define LZ4_RUN_BITS			4
+#define LZ4_RUN_MASK			((1 << LZ4_RUN_BITS) - 1)
+
+
+/* ----------
+ * Local definitions
+ * ----------
+ */
+static int32 hist_start[LZ4_HASH_SIZE];
+
+
+static inline uint32
+lz4_read32(const unsigned char *p)
+{
+	uint32		val;
+
+	memcpy(&val, p, sizeof(val));
+	return val;
+}
+
+static inline int
+lz4_hash(uint32 seq)
+{
+	return (int) ((seq * 2654435761U) >> (32 - LZ4_HASH_BITS));
+}
+
+/*
+ * Emit the extension bytes of a literal or match length of len, whose first
+ * LZ4_RUN_MASK are already accounted for in the token.
+ */
+static inline unsigned char *
+lz4_put_length(unsigned char *op, int32 len)
+{
+	while (len >= 255)
+	{
+		*op++ = 255;
+		len -= 255;
+	}
+	*op++ = (unsigned char) len;
+	return op;
+}
+
+
+/* ----------
+ * pg_lz4_compress -
+ *
+ *		Compresses source into dest, writing at most capacity bytes.
+ * ----------
+ */
+int32
+pg_lz4_compress(const char *source, int32 slen, char *dest, int32 capacity)
+{
+	const unsigned char *src = (const unsigned char *) source;
+	const unsigned char *ip = src;
+	const unsigned char *anchor = src;
+	const unsigned char *iend = src + slen;
+	const unsigned char *mflimit = iend - LZ4_MFLIMIT;
+	const unsigned char *matchlimit = iend - LZ4_LASTLITERALS;
+	unsigned char *op = (unsigned char *) dest;
+	unsigned char *oend = op + capacity;
+	int32		litlen;
+
+	if (slen < 0 || capacity < 0)
+		return -1;
+
+	if (slen > LZ4_MFLIMIT)
+	{
+		uint32		searchMatchNb = 1 << LZ4_SKIP_TRIGGER;
+
+		memset(hist_start, 0xff, sizeof(hist_start));
+
+		while (ip < mflimit)
+		{
+			const unsigned char *match;
+			uint32		seq = lz4_read32(ip);
+			int			h = lz4_hash(seq);
+			int32		ref = hist_start[h];
+			int32		matchlen;
+			unsigned char *token;
+
+			hist_start[h] = (int32) (ip - src);
+
+			if (ref < 0 ||
+				(ip - src) - ref > LZ4_MAX_DISTANCE ||
+				lz4_read32(src + ref) != seq)
+			{
+				/* No match here, move on faster the longer we find none */
+				ip += searchMatchNb++ >> LZ4_SKIP_TRIGGER;
+				continue;
+			}
+			searchMatchNb = 1 << LZ4_SKIP_TRIGGER;
+			match = src + ref;
+
+			/* Extend the match backwards into the pending literals */
+			while (ip > anchor && match > src && ip[-1] == match[-1])
+			{
+				ip--;
+				match--;
+			}
+
+			/* and forwards, but never into the trailing literals */
+			matchlen = LZ4_MINMATCH;
+			while (ip + matchlen < matchlimit && ip[matchlen] == match[matchlen])
+				matchlen++;
+
+			/*
+			 * Make sure the token, the literals with their length bytes, the
+			 * offset and the match length bytes fit.
+			 */
+			litlen = (int32) (ip - anchor);
+			if ((oend - op) < 1 + litlen / 255 + 1 + litlen + 2 +
+				(matchlen - LZ4_MINMATCH) / 255 + 1)
+				return -1;
+
+			token = op++;
+			if (litlen >= LZ4_RUN_MASK)
+			{
+				*token = LZ4_RUN_MASK << LZ4_RUN_BITS;
+				op = lz4_put_length(op, litlen - LZ4_RUN_MASK);
+			}
+			else
+				*token = (unsigned char) (litlen << LZ4_RUN_BITS);
+			memcpy(op, anchor, litlen);
+			op += litlen;
+
+			*op++ = (unsigned char) ((ip - match) & 0xff);
+			*op++ = (unsigned char) ((ip - match) >> 8);
+
+			if (matchlen - LZ4_MINMATCH >= LZ4_RUN_MASK)
+			{
+				*token |= LZ4_RUN_MASK;
+				op = lz4_put_length(op, matchlen - LZ4_MINMATCH - LZ4_RUN_MASK);
+			}
+			else
+				*token |= (unsigned char) (matchlen - LZ4_MINMATCH);
+
+			ip += matchlen;
+			anchor = ip;
+
+			/* Remember a position inside the match, too */
+			if (ip < mflimit)
+				hist_start[lz4_hash(lz4_read32(ip - 2))] = (int32) (ip - 2 - src);
+		}
+	}
+
+	/* Emit the remaining input as the final run of literals */
+	litlen = (int32) (iend - anchor);
+	if ((oend - op) < 1 + litlen / 255 + 1 + litlen)
+		return -1;
+	if (litlen >= LZ4_RUN_MASK)
+	{
+		*op++ = LZ4_RUN_MASK << LZ4_RUN_BITS;
+		op = lz4_put_length(op, litlen - LZ4_RUN_MASK);
+	}
+	else
+		*op++ = (unsigned char) (litlen << LZ4_RUN_BITS);
+	memcpy(op, anchor, litlen);
+	op += litlen;
+
+	return (int32) (op - (unsigned char *) dest);
+}
+
+
+/* ----------
+ * pg_lz4_decompress -
+ *
+ *		Decompresses source into dest, which holds exactly rawsize bytes.
+ * ----------
+ */
+int32
+pg_lz4_decompress(const char *source, int32 slen, char *dest, int32 rawsize)
+{
+	const unsigned char *ip = (const unsigned char *) source;
+	const unsigned char *iend = ip + slen;
+	unsigned char *op = (unsigned char *) dest;
+	unsigned char *oend = op + rawsize;
+
+	if (slen <= 0 || rawsize < 0)
+		return -1;
+
+	while (ip < iend)
+	{
+		unsigned char token = *ip++;
+		Size		len;
+		Size		offset;
+		const unsigned char *match;
+		unsigned char s;
+
+		/* Copy the literals */
+		len = token >> LZ4_RUN_BITS;
+		if (len == LZ4_RUN_MASK)
+		{
+			do
+			{
+				if (ip >= iend)
+					return -1;
+				s = *ip++;
+				len += s;
+			} while (s == 255);
+		}
+		if (len > (Size) (iend - ip) || len > (Size) (oend - op))
+			return -1;
+		memcpy(op, ip, len);
+		op += len;
+		ip += len;
+
+		/* The last item has no match part */
+		if (ip >= iend)
+			break;
+
+		if (iend - ip < 2)
+			return -1;
+		offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if (offset == 0 || offset > (Size) (op - (unsigned char *) dest))
+			return -1;
+
+		len = token & LZ4_RUN_MASK;
+		if (len == LZ4_RUN_MASK)
+		{
+			do
+			{
+				if (ip >= iend)
+					return -1;
+				s = *ip++;
+				len += s;
+			} while (s == 255);
+		}
+		len += LZ4_MINMATCH;
+		if (len > (Size) (oend - op))
+			return -1;
+
+		/*
+		 * The match may overlap the output it produces, which is how runs
+		 * are encoded, so copy byte by byte unless it is far enough back.
+		 */
+		match = op - offset;
+		if (offset >= len)
+		{
+			memcpy(op, match, len);
+			op += len;
+		}
+		else
+		{
+			while (len-- > 0)
+				*op++ = *match++;
+		}
+	}
+
+	if (op != oend)
+		return -1;
+
+	return rawsize;
+}
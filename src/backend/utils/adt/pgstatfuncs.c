@@ -20,9 +20,16 @@
 #include "libpq/ip.h"
 #include "miscadmin.h"
 #include "pgstat.h"
+#ifdef ADB
+#include "storage/proc.h"
+#include "storage/procarray.h"
+#endif
 #include "utils/builtins.h"
 #include "utils/inet.h"
 #include "utils/timestamp.h"
+#ifdef ADB
+#include "utils/waitevent.h"
+#endif
 
 /* bogus ... these externs should be in a header file */
 extern Datum pg_stat_get_numscans(PG_FUNCTION_ARGS);
@@ -32,6 +39,8 @@ extern Datum pg_stat_get_tuples_inserted(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_tuples_updated(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_tuples_deleted(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_tuples_hot_updated(PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_tuples_newpage_updated(PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_pages_pruned(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_live_tuples(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_dead_tuples(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_blocks_fetched(PG_FUNCTION_ARGS);
@@ -57,6 +66,11 @@ extern Datum pg_stat_get_backend_dbid(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_backend_userid(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_backend_activity(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_backend_waiting(PG_FUNCTION_ARGS);
+#ifdef ADB
+extern Datum pg_stat_get_wait_event_type(PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_wait_event(PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_wait_events(PG_FUNCTION_ARGS);
+#endif
 extern Datum pg_stat_get_backend_activity_start(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_backend_xact_start(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_backend_start(PG_FUNCTION_ARGS);
@@ -85,6 +99,9 @@ extern Datum pg_stat_get_db_temp_files(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_db_temp_bytes(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_db_blk_read_time(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_db_blk_write_time(PG_FUNCTION_ARGS);
+#ifdef ADB
+extern Datum pg_stat_get_db_latency_histogram(PG_FUNCTION_ARGS);
+#endif
 
 extern Datum pg_stat_get_bgwriter_timed_checkpoints(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_bgwriter_requested_checkpoints(PG_FUNCTION_ARGS);
@@ -105,6 +122,7 @@ extern Datum pg_stat_get_xact_tuples_inserted(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_xact_tuples_updated(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_xact_tuples_deleted(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_xact_tuples_hot_updated(PG_FUNCTION_ARGS);
+extern Datum pg_stat_get_xact_tuples_newpage_updated(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_xact_blocks_fetched(PG_FUNCTION_ARGS);
 extern Datum pg_stat_get_xact_blocks_hit(PG_FUNCTION_ARGS);
 
@@ -233,6 +251,38 @@ pg_stat_get_tuples_hot_updated(PG_FUNCTION_ARGS)
 }
 
 
+Datum
+pg_stat_get_tuples_newpage_updated(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	int64		result;
+	PgStat_StatTabEntry *tabentry;
+
+	if ((tabentry = pgstat_fetch_stat_tabentry(relid)) == NULL)
+		result = 0;
+	else
+		result = (int64) (tabentry->tuples_newpage_updated);
+
+	PG_RETURN_INT64(result);
+}
+
+
+Datum
+pg_stat_get_pages_pruned(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	int64		result;
+	PgStat_StatTabEntry *tabentry;
+
+	if ((tabentry = pgstat_fetch_stat_tabentry(relid)) == NULL)
+		result = 0;
+	else
+		result = (int64) (tabentry->pages_pruned);
+
+	PG_RETURN_INT64(result);
+}
+
+
 Datum
 pg_stat_get_live_tuples(PG_FUNCTION_ARGS)
 {
@@ -503,6 +553,12 @@ pg_stat_get_backend_idset(PG_FUNCTION_ARGS)
 	}
 }
 
+#ifdef ADB
+#define PG_STAT_GET_ACTIVITY_COLS	19
+#else
+#define PG_STAT_GET_ACTIVITY_COLS	14
+#endif
+
 Datum
 pg_stat_get_activity(PG_FUNCTION_ARGS)
 {
@@ -517,7 +573,7 @@ pg_stat_get_activity(PG_FUNCTION_ARGS)
 
 		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
 
-		tupdesc = CreateTemplateTupleDesc(14, false);
+		tupdesc = CreateTemplateTupleDesc(PG_STAT_GET_ACTIVITY_COLS, false);
 		TupleDescInitEntry(tupdesc, (AttrNumber) 1, "datid",
 						   OIDOID, -1, 0);
 		TupleDescInitEntry(tupdesc, (AttrNumber) 2, "pid",
@@ -546,6 +602,18 @@ pg_stat_get_activity(PG_FUNCTION_ARGS)
 						   TEXTOID, -1, 0);
 		TupleDescInitEntry(tupdesc, (AttrNumber) 14, "client_port",
 						   INT4OID, -1, 0);
+#ifdef ADB
+		TupleDescInitEntry(tupdesc, (AttrNumber) 15, "remote_bytes_sent",
+						   INT8OID, -1, 0);
+		TupleDescInitEntry(tupdesc, (AttrNumber) 16, "remote_bytes_received",
+						   INT8OID, -1, 0);
+		TupleDescInitEntry(tupdesc, (AttrNumber) 17, "remote_messages_sent",
+						   INT8OID, -1, 0);
+		TupleDescInitEntry(tupdesc, (AttrNumber) 18, "remote_messages_received",
+						   INT8OID, -1, 0);
+		TupleDescInitEntry(tupdesc, (AttrNumber) 19, "remote_round_trips",
+						   INT8OID, -1, 0);
+#endif
 
 		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
 
@@ -597,8 +665,8 @@ pg_stat_get_activity(PG_FUNCTION_ARGS)
 	if (funcctx->call_cntr < funcctx->max_calls)
 	{
 		/* for each row */
-		Datum		values[14];
-		bool		nulls[14];
+		Datum		values[PG_STAT_GET_ACTIVITY_COLS];
+		bool		nulls[PG_STAT_GET_ACTIVITY_COLS];
 		HeapTuple	tuple;
 		PgBackendStatus *beentry;
 
@@ -758,6 +826,13 @@ pg_stat_get_activity(PG_FUNCTION_ARGS)
 					nulls[13] = true;
 				}
 			}
+#ifdef ADB
+			values[14] = Int64GetDatum(beentry->st_remote_bytes_sent);
+			values[15] = Int64GetDatum(beentry->st_remote_bytes_received);
+			values[16] = Int64GetDatum(beentry->st_remote_msgs_sent);
+			values[17] = Int64GetDatum(beentry->st_remote_msgs_received);
+			values[18] = Int64GetDatum(beentry->st_remote_round_trips);
+#endif
 		}
 		else
 		{
@@ -772,6 +847,13 @@ pg_stat_get_activity(PG_FUNCTION_ARGS)
 			nulls[11] = true;
 			nulls[12] = true;
 			nulls[13] = true;
+#ifdef ADB
+			nulls[14] = true;
+			nulls[15] = true;
+			nulls[16] = true;
+			nulls[17] = true;
+			nulls[18] = true;
+#endif
 		}
 
 		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
@@ -870,6 +952,111 @@ pg_stat_get_backend_waiting(PG_FUNCTION_ARGS)
 	PG_RETURN_BOOL(result);
 }
 
+#ifdef ADB
+/*
+ * The wait event the backend "pid" is in, NULL if none or if it runs as
+ * another role.  MyProc->waitEvent is read without a lock, so the answer
+ * may already be stale.
+ */
+static WaitEvent
+get_backend_wait_event(int pid)
+{
+	PGPROC	   *proc = BackendPidGetProc(pid);
+
+	if (proc == NULL)
+		return WAIT_EVENT_NONE;
+
+	if (!superuser() && proc->roleId != GetUserId())
+		return WAIT_EVENT_NONE;
+
+	return (WaitEvent) proc->waitEvent;
+}
+
+Datum
+pg_stat_get_wait_event_type(PG_FUNCTION_ARGS)
+{
+	const char *type;
+
+	type = GetWaitEventType(get_backend_wait_event(PG_GETARG_INT32(0)));
+	if (type == NULL)
+		PG_RETURN_NULL();
+
+	PG_RETURN_TEXT_P(cstring_to_text(type));
+}
+
+Datum
+pg_stat_get_wait_event(PG_FUNCTION_ARGS)
+{
+	const char *name;
+
+	name = GetWaitEventName(get_backend_wait_event(PG_GETARG_INT32(0)));
+	if (name == NULL)
+		PG_RETURN_NULL();
+
+	PG_RETURN_TEXT_P(cstring_to_text(name));
+}
+
+/*
+ * Cumulative calls and time, in milliseconds, of every wait event since
+ * the cluster started or pg_stat_reset_shared('wait_events').
+ */
+Datum
+pg_stat_get_wait_events(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		TupleDesc	tupdesc;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		tupdesc = CreateTemplateTupleDesc(4, false);
+		TupleDescInitEntry(tupdesc, (AttrNumber) 1, "wait_event_type",
+						   TEXTOID, -1, 0);
+		TupleDescInitEntry(tupdesc, (AttrNumber) 2, "wait_event",
+						   TEXTOID, -1, 0);
+		TupleDescInitEntry(tupdesc, (AttrNumber) 3, "calls",
+						   INT8OID, -1, 0);
+		TupleDescInitEntry(tupdesc, (AttrNumber) 4, "total_time",
+						   FLOAT8OID, -1, 0);
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+
+		/* the first call returns WAIT_EVENT_NONE + 1 */
+		funcctx->max_calls = NUM_WAIT_EVENTS - 1;
+
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+
+	if (funcctx->call_cntr < funcctx->max_calls)
+	{
+		WaitEvent	event = (WaitEvent) (funcctx->call_cntr + 1);
+		Datum		values[4];
+		bool		nulls[4];
+		uint64		calls;
+		uint64		time;
+		HeapTuple	tuple;
+
+		WaitEventGetCounts(event, &calls, &time);
+
+		MemSet(nulls, 0, sizeof(nulls));
+		values[0] = CStringGetTextDatum(GetWaitEventType(event));
+		values[1] = CStringGetTextDatum(GetWaitEventName(event));
+		values[2] = Int64GetDatum((int64) calls);
+		values[3] = Float8GetDatum((double) time / 1000.0);
+
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
+#endif   /* ADB */
+
 
 Datum
 pg_stat_get_backend_activity_start(PG_FUNCTION_ARGS)
@@ -1391,6 +1578,20 @@ pg_stat_get_db_blk_write_time(PG_FUNCTION_ARGS)
 	PG_RETURN_FLOAT8(result);
 }
 
+#ifdef ADB
+Datum
+pg_stat_get_db_latency_histogram(PG_FUNCTION_ARGS)
+{
+	Oid			dbid = PG_GETARG_OID(0);
+	PgStat_StatDBEntry *dbentry;
+
+	if ((dbentry = pgstat_fetch_stat_dbentry(dbid)) == NULL)
+		PG_RETURN_NULL();
+
+	PG_RETURN_ARRAYTYPE_P(LatencyHistGetArray(dbentry->n_latency_hist));
+}
+#endif
+
 Datum
 pg_stat_get_bgwriter_timed_checkpoints(PG_FUNCTION_ARGS)
 {
@@ -1582,6 +1783,21 @@ pg_stat_get_xact_tuples_hot_updated(PG_FUNCTION_ARGS)
 	PG_RETURN_INT64(result);
 }
 
+Datum
+pg_stat_get_xact_tuples_newpage_updated(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	int64		result;
+	PgStat_TableStatus *tabentry;
+
+	if ((tabentry = find_tabstat_entry(relid)) == NULL)
+		result = 0;
+	else
+		result = (int64) (tabentry->t_counts.t_tuples_newpage_updated);
+
+	PG_RETURN_INT64(result);
+}
+
 Datum
 pg_stat_get_xact_blocks_fetched(PG_FUNCTION_ARGS)
 {
@@ -149,6 +149,20 @@ Datum rowid_make(uint32 node_id, ItemPointer const tid)
 	return PointerGetDatum(rowid);
 }
 
+/* Node of a rowid, the PGXCNodeIdentifier of the node holding the row */
+uint32 rowid_get_node_id(Datum rowid)
+{
+	return (uint32) ((OraRowID*)DatumGetPointer(rowid))->node_id;
+}
+
+/* Tuple a rowid points to on its node */
+void rowid_get_tid(Datum rowid, ItemPointer tid)
+{
+	OraRowID *r = (OraRowID*)DatumGetPointer(rowid);
+	AssertArg(tid);
+	ItemPointerSet(tid, r->block, r->offset);
+}
+
 static int rowid_compare(const OraRowID *l, const OraRowID *r)
 {
 	AssertArg(l && r);
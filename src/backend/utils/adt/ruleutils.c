@@ -446,6 +446,10 @@ static void get_column_alias_list(deparse_columns *colinfo,
 static void get_from_clause_coldeflist(deparse_columns *colinfo,
 						   List *types, List *typmods, List *collations,
 						   deparse_context *context);
+#ifdef ADB
+static void get_tablesample_def(TableSampleClause *tablesample,
+					deparse_context *context);
+#endif
 static void get_opclass_name(Oid opclass, Oid actual_datatype,
 				 StringInfo buf);
 static Node *processIndirection(Node *node, deparse_context *context,
@@ -5972,6 +5976,12 @@ get_utility_query_def(Query *query, deparse_context *context)
 					appendStringInfo(buf, " DISTRIBUTE BY MODULO(%s)", stmt->distributeby->colname);
 					break;
 
+#ifdef ADB
+				case DISTTYPE_BUCKET:
+					appendStringInfo(buf, " DISTRIBUTE BY BUCKET(%s)", stmt->distributeby->colname);
+					break;
+#endif
+
 				default:
 					ereport(ERROR, (errcode(ERRCODE_SYNTAX_ERROR),
 								errmsg("Invalid distribution type")));
@@ -9132,6 +9142,12 @@ get_from_clause_item(Node *jtnode, Query *query, deparse_context *context)
 			/* Else print column aliases as needed */
 			get_column_alias_list(colinfo, context);
 		}
+
+#ifdef ADB
+		/* The TABLESAMPLE clause goes after the alias */
+		if (rte->rtekind == RTE_RELATION && rte->tablesample)
+			get_tablesample_def(rte->tablesample, context);
+#endif
 	}
 	else if (IsA(jtnode, JoinExpr))
 	{
@@ -9313,6 +9329,30 @@ get_from_clause_coldeflist(deparse_columns *colinfo,
 	appendStringInfoChar(buf, ')');
 }
 
+#ifdef ADB
+/*
+ * get_tablesample_def			- print a TableSampleClause
+ */
+static void
+get_tablesample_def(TableSampleClause *tablesample, deparse_context *context)
+{
+	StringInfo	buf = context->buf;
+
+	appendStringInfo(buf, " TABLESAMPLE %s (",
+					 tablesample->method == TABLESAMPLE_SYSTEM ?
+					 "system" : "bernoulli");
+	get_rule_expr(tablesample->percent, context, false);
+	appendStringInfoChar(buf, ')');
+
+	if (tablesample->repeatable != NULL)
+	{
+		appendStringInfoString(buf, " REPEATABLE (");
+		get_rule_expr(tablesample->repeatable, context, false);
+		appendStringInfoChar(buf, ')');
+	}
+}
+#endif /* ADB */
+
 /*
  * get_opclass_name			- fetch name of an index operator class
  *
@@ -84,7 +84,6 @@ static void AdjustIntervalForTypmod(Interval *interval, int32 typmod);
 #endif
 
 static TimestampTz timestamp2timestamptz(Timestamp timestamp);
-static int try_decode_time_internal(char *str, struct pg_tm *tm, fsec_t *fsec, int *tzp);
 
 /* common code for timestamptypmodin and timestamptztypmodin */
 static int32
@@ -169,7 +168,8 @@ timestamp_in(PG_FUNCTION_ARGS)
 	int			ftype[MAXDATEFIELDS];
 	char		workbuf[MAXDATELEN + MAXDATEFIELDS];
 
-	if((nf=try_decode_date_time(str, tm, &fsec, &tz)) == 0
+	/* no time zone to look up for a timestamp without time zone */
+	if((nf=try_decode_date_time(str, tm, &fsec, NULL)) == 0
 		|| str[nf] != '\0')
 	{
 		dterr = ParseDateTime(str, workbuf, sizeof(workbuf),
@@ -5200,15 +5200,8 @@ int try_decode_date(const char *str, struct pg_tm *tm)
 /* HH:mm:ss[.nn][+n] */
 int try_decode_time(const char *str, struct pg_tm *tm, fsec_t *fsec, int *tzp)
 {
-	char *new_str = pstrdup(str);
-	int rval = try_decode_time_internal(new_str, tm, fsec, tzp);
-	pfree(new_str);
-	return rval;
-}
+	const char *start = str;
 
-static int try_decode_time_internal(char *str, struct pg_tm *tm, fsec_t *fsec, int *tzp)
-{
-	int rval;
 	/* HH:mm:ss */
 	if(isdigit2(str[0], str[1])
 		&& str[2]==':' && isdigit2(str[3], str[4])
@@ -5217,30 +5210,56 @@ static int try_decode_time_internal(char *str, struct pg_tm *tm, fsec_t *fsec, i
 		tm->tm_hour = digit_val2(str[0], str[1]);
 		tm->tm_min = digit_val2(str[3], str[4]);
 		tm->tm_sec = digit_val2(str[6], str[7]);
-		rval = 8;
 		str += 8;
 	}else
 	{
 		return 0;
 	}
 
+	/* let DecodeDateTime() accept or report anything out of range */
+	if (tm->tm_hour >= HOURS_PER_DAY || tm->tm_min >= MINS_PER_HOUR ||
+		tm->tm_sec > SECS_PER_MINUTE)
+		return 0;
+
 	*fsec = 0;
 	/* .n */
 	if(str[0] == '.')
 	{
-		double frac;
-		char *end;
-		errno = 0;
-		frac = strtod(str, &end);
-		if(errno != 0)
+		int ndigits;
+		int frac = 0;
+
+		for (ndigits = 0; ndigits < 6 && isdigit((unsigned char) str[ndigits + 1]); ndigits++)
+			frac = frac * 10 + (str[ndigits + 1] - '0');
+
+		if (ndigits == 0)
 			return 0;
+		if (!isdigit((unsigned char) str[ndigits + 1]))
+		{
+			/* up to microseconds, no rounding needed */
+			str += ndigits + 1;
 #ifdef HAVE_INT64_TIMESTAMP
-		*fsec = rint(frac * 1000000);
+			for (; ndigits < 6; ndigits++)
+				frac *= 10;
+			*fsec = frac;
 #else
-		*fsec = frac;
+			*fsec = frac / pow(10.0, ndigits);
 #endif
-		rval += (end-str);
-		str = end;
+		}else
+		{
+			double fracval;
+			char *end;
+
+			errno = 0;
+			fracval = strtod(str, &end);
+			if(errno != 0)
+				return 0;
+#ifdef HAVE_INT64_TIMESTAMP
+			*fsec = rint(fracval * 1000000);
+#else
+			*fsec = fracval;
+#endif
+			str = end;
+		}
 	}
 
 	/* at end parse timezone */
@@ -5248,19 +5267,25 @@ static int try_decode_time_internal(char *str, struct pg_tm *tm, fsec_t *fsec, i
 	{
 		if(tzp)
 			*tzp = DetermineTimeZoneOffset(tm, session_timezone);
-	}else if(str[0] == '+' || str[1] == '-')
+	}else if(str[0] == '+' || str[0] == '-')
 	{
-		if(tzp == NULL || DecodeTimezone(str, tzp) != 0)
+		/* DecodeTimezone() does not write to the string */
+		if(tzp == NULL || DecodeTimezone((char *) str, tzp) != 0)
 			return 0;
-		rval += strlen(str);
+		str += strlen(str);
 	}else
 	{
 		return 0;
 	}
-	return rval;
+	return str - start;
 }
 
-/* YYYY-MM-DD HH:mm:ss[.n][+n] */
+/*
+ * YYYY-MM-DD[( |T)HH:mm:ss[.n][+n]]
+ *
+ * tzp may be NULL for timestamp without time zone, which needs no time zone
+ * lookup; a value with a time zone is then left to DecodeDateTime().
+ */
 int try_decode_date_time(const char *str, struct pg_tm *tm, fsec_t *fsec, int *tzp)
 {
 	int rval,tmp;
@@ -5273,9 +5298,10 @@ int try_decode_date_time(const char *str, struct pg_tm *tm, fsec_t *fsec, int *t
 		/* date only */
 		tm->tm_hour = tm->tm_min = tm->tm_sec = 0;
 		*fsec = 0;
-		*tzp = DetermineTimeZoneOffset(tm, session_timezone);
+		if(tzp)
+			*tzp = DetermineTimeZoneOffset(tm, session_timezone);
 		return rval;
-	}else if(str[rval] != ' ')
+	}else if(str[rval] != ' ' && str[rval] != 'T')
 	{
 		return 0;
 	}
@@ -27,8 +27,10 @@
 #include "regex/regex.h"
 #include "utils/builtins.h"
 #include "utils/bytea.h"
+#include "utils/fmgroids.h"
 #include "utils/lsyscache.h"
 #include "utils/pg_locale.h"
+#include "utils/sortsupport.h"
 #ifdef ADB
 #include "utils/varbit.h"
 #endif
@@ -48,6 +50,13 @@ typedef struct
 	pg_wchar   *wstr2;			/* note: these are palloc'd */
 	int			len1;			/* string lengths in logical characters */
 	int			len2;
+#ifdef ADB
+	bool		use_bytes;		/* T if UTF8, searched bytewise in str1/str2 */
+	int			blen1;			/* string lengths in bytes if use_bytes */
+	int			blen2;
+	int			refpos;			/* a character position in str1 ... */
+	char	   *refptr;			/* ... and where it begins, if use_bytes */
+#endif
 	/* Skip table for Boyer-Moore-Horspool search algorithm: */
 	int			skiptablemask;	/* mask for ANDing with skiptable subscripts */
 	int			skiptable[256]; /* skip distance for given mismatched char */
@@ -69,6 +78,8 @@ static text *text_overlay(text *t1, text *t2, int sp, int sl);
 static int	text_position(text *t1, text *t2);
 static void text_position_setup(text *t1, text *t2, TextPositionState *state);
 static int	text_position_next(int start_pos, TextPositionState *state);
+static int text_position_search(int start, int haystack_len, int needle_len,
+					 TextPositionState *state);
 static void text_position_cleanup(TextPositionState *state);
 static int	text_cmp(text *arg1, text *arg2, Oid collid);
 static bytea *bytea_catenate(bytea *t1, bytea *t2);
@@ -1097,7 +1108,31 @@ text_position_setup(text *t1, text *t2, TextPositionState *state)
 		state->str2 = VARDATA_ANY(t2);
 		state->len1 = len1;
 		state->len2 = len2;
+#ifdef ADB
+		state->use_bytes = false;
+#endif
+	}
+#ifdef ADB
+	else if (GetDatabaseEncoding() == PG_UTF8)
+	{
+		/*
+		 * A valid UTF8 needle can only match a valid UTF8 haystack at a
+		 * character boundary, so the bytes are searched as they are, sparing
+		 * the conversion to wide characters.  Only the positions found are
+		 * converted to characters, see text_position_next.
+		 */
+		state->use_wchar = false;
+		state->use_bytes = true;
+		state->str1 = VARDATA_ANY(t1);
+		state->str2 = VARDATA_ANY(t2);
+		state->blen1 = len1;
+		state->blen2 = len2;
+		state->len1 = pg_mbstrlen_with_len(state->str1, len1);
+		state->len2 = pg_mbstrlen_with_len(state->str2, len2);
+		state->refpos = 1;
+		state->refptr = state->str1;
 	}
+#endif
 	else
 	{
 		/* not as simple - multibyte encoding */
@@ -1114,6 +1149,9 @@ text_position_setup(text *t1, text *t2, TextPositionState *state)
 		state->wstr2 = p2;
 		state->len1 = len1;
 		state->len2 = len2;
+#ifdef ADB
+		state->use_bytes = false;
+#endif
 	}
 
 	/*
@@ -1213,61 +1251,46 @@ text_position_next(int start_pos, TextPositionState *state)
 	if (haystack_len < start_pos + needle_len)
 		return 0;
 
-	if (!state->use_wchar)
+#ifdef ADB
+	if (state->use_bytes)
 	{
-		/* simple case - single byte encoding */
-		const char *haystack = state->str1;
-		const char *needle = state->str2;
-		const char *haystack_end = &haystack[haystack_len];
-		const char *hptr;
+		int			pos;
 
-		if (needle_len == 1)
+		/*
+		 * Find where character start_pos begins, moving on from the last
+		 * position known, as callers search forward.
+		 */
+		if (start_pos + 1 < state->refpos)
 		{
-			/* No point in using B-M-H for a one-character needle */
-			char		nchar = *needle;
-
-			hptr = &haystack[start_pos];
-			while (hptr < haystack_end)
-			{
-				if (*hptr == nchar)
-					return hptr - haystack + 1;
-				hptr++;
-			}
+			state->refpos = 1;
+			state->refptr = state->str1;
 		}
-		else
+		while (state->refpos < start_pos + 1)
 		{
-			const char *needle_last = &needle[needle_len - 1];
+			state->refptr += pg_utf_mblen((const unsigned char *) state->refptr);
+			state->refpos++;
+		}
 
-			/* Start at startpos plus the length of the needle */
-			hptr = &haystack[start_pos + needle_len - 1];
-			while (hptr < haystack_end)
-			{
-				/* Match the needle scanning *backward* */
-				const char *nptr;
-				const char *p;
+		pos = text_position_search(state->refptr - state->str1,
+								   state->blen1, state->blen2, state);
+		if (pos < 0)
+			return 0;
 
-				nptr = needle_last;
-				p = hptr;
-				while (*nptr == *p)
-				{
-					/* Matched it all?	If so, return 1-based position */
-					if (nptr == needle)
-						return p - haystack + 1;
-					nptr--, p--;
-				}
+		/* count the characters up to the match */
+		state->refpos += pg_mbstrlen_with_len(state->refptr,
+											  state->str1 + pos - state->refptr);
+		state->refptr = state->str1 + pos;
+		return state->refpos;
+	}
+#endif
 
-				/*
-				 * No match, so use the haystack char at hptr to decide how
-				 * far to advance.  If the needle had any occurrence of that
-				 * character (or more precisely, one sharing the same
-				 * skiptable entry) before its last character, then we advance
-				 * far enough to align the last such needle character with
-				 * that haystack position.  Otherwise we can advance by the
-				 * whole needle length.
-				 */
-				hptr += state->skiptable[(unsigned char) *hptr & skiptablemask];
-			}
-		}
+	if (!state->use_wchar)
+	{
+		/* simple case - single byte encoding */
+		int			pos = text_position_search(start_pos, haystack_len,
+											   needle_len, state);
+
+		return pos < 0 ? 0 : pos + 1;
 	}
 	else
 	{
@@ -1329,6 +1352,65 @@ text_position_next(int start_pos, TextPositionState *state)
 	return 0;					/* not found */
 }
 
+/*
+ * Search the bytes of str1 from byte "start" for those of str2, the lengths
+ * being in bytes.  Returns the 0-based byte position of the match, or -1.
+ */
+static int
+text_position_search(int start, int haystack_len, int needle_len,
+					 TextPositionState *state)
+{
+	const char *haystack = state->str1;
+	const char *needle = state->str2;
+	const char *haystack_end = &haystack[haystack_len];
+	const char *hptr;
+	int			skiptablemask = state->skiptablemask;
+
+	if (needle_len == 1)
+	{
+		/* No point in using B-M-H for a one-character needle */
+		hptr = memchr(&haystack[start], *needle, haystack_len - start);
+		if (hptr != NULL)
+			return hptr - haystack;
+	}
+	else
+	{
+		const char *needle_last = &needle[needle_len - 1];
+
+		/* Start at start plus the length of the needle */
+		hptr = &haystack[start + needle_len - 1];
+		while (hptr < haystack_end)
+		{
+			/* Match the needle scanning *backward* */
+			const char *nptr;
+			const char *p;
+
+			nptr = needle_last;
+			p = hptr;
+			while (*nptr == *p)
+			{
+				/* Matched it all?	If so, return its position */
+				if (nptr == needle)
+					return p - haystack;
+				nptr--, p--;
+			}
+
+			/*
+			 * No match, so use the haystack char at hptr to decide how far
+			 * to advance.  If the needle had any occurrence of that
+			 * character (or more precisely, one sharing the same skiptable
+			 * entry) before its last character, then we advance far enough
+			 * to align the last such needle character with that haystack
+			 * position.  Otherwise we can advance by the whole needle
+			 * length.
+			 */
+			hptr += state->skiptable[(unsigned char) *hptr & skiptablemask];
+		}
+	}
+
+	return -1;					/* not found */
+}
+
 static void
 text_position_cleanup(TextPositionState *state)
 {
@@ -1693,6 +1775,96 @@ bttextcmp(PG_FUNCTION_ARGS)
 }
 
 
+/*
+ * Sort support for text.  In the C collation the comparator is a memcmp()
+ * without the function manager, and the first bytes of a string, packed
+ * into a Datum, make an abbreviated key: most comparisons of a sort are
+ * then decided without touching the strings.  Other collations need
+ * strcoll() and keep going through bttextcmp.
+ */
+static int	bttextfastcmp_c(Datum x, Datum y, SortSupport ssup);
+static int	bttextcmp_abbrev(Datum x, Datum y, SortSupport ssup);
+static Datum bttext_abbrev_convert(Datum original, SortSupport ssup);
+
+Datum
+bttextsortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	if (!lc_collate_is_c(ssup->ssup_collation))
+	{
+		PrepareSortSupportComparisonShim(F_BTTEXTCMP, ssup);
+		PG_RETURN_VOID();
+	}
+
+	ssup->comparator = bttextfastcmp_c;
+	if (ssup->abbreviate)
+	{
+		ssup->abbrev_full_comparator = bttextfastcmp_c;
+		ssup->comparator = bttextcmp_abbrev;
+		ssup->abbrev_converter = bttext_abbrev_convert;
+	}
+
+	PG_RETURN_VOID();
+}
+
+static int
+bttextfastcmp_c(Datum x, Datum y, SortSupport ssup)
+{
+	text	   *arg1 = DatumGetTextPP(x);
+	text	   *arg2 = DatumGetTextPP(y);
+	int			len1 = VARSIZE_ANY_EXHDR(arg1);
+	int			len2 = VARSIZE_ANY_EXHDR(arg2);
+	int			result;
+
+	result = memcmp(VARDATA_ANY(arg1), VARDATA_ANY(arg2), Min(len1, len2));
+	if (result == 0 && len1 != len2)
+		result = (len1 < len2) ? -1 : 1;
+
+	/* We can't afford to leak memory here. */
+	if (PointerGetDatum(arg1) != x)
+		pfree(arg1);
+	if (PointerGetDatum(arg2) != y)
+		pfree(arg2);
+
+	return result;
+}
+
+/* abbreviated keys compare as unsigned integers, like memcmp() the bytes */
+static int
+bttextcmp_abbrev(Datum x, Datum y, SortSupport ssup)
+{
+	if (x > y)
+		return 1;
+	else if (x == y)
+		return 0;
+	else
+		return -1;
+}
+
+/*
+ * The first sizeof(Datum) bytes of the string, the first one in the most
+ * significant byte, padded with zeroes.  text holds no zero byte, so a
+ * shorter string gets a smaller key than the strings it is a prefix of.
+ */
+static Datum
+bttext_abbrev_convert(Datum original, SortSupport ssup)
+{
+	text	   *arg = DatumGetTextPP(original);
+	unsigned char *data = (unsigned char *) VARDATA_ANY(arg);
+	int			len = VARSIZE_ANY_EXHDR(arg);
+	Datum		res = 0;
+	int			i;
+
+	for (i = 0; i < sizeof(Datum); i++)
+		res = (res << 8) | (i < len ? data[i] : 0);
+
+	if (PointerGetDatum(arg) != original)
+		pfree(arg);
+
+	return res;
+}
+
 Datum
 text_larger(PG_FUNCTION_ARGS)
 {
@@ -3822,6 +3994,45 @@ pg_column_size(PG_FUNCTION_ARGS)
 	PG_RETURN_INT32(result);
 }
 
+/*
+ * Return the compression method of a datum, or NULL if it is not compressed
+ *
+ * Works on any data type
+ */
+Datum
+pg_column_compression(PG_FUNCTION_ARGS)
+{
+	int			typlen;
+	int			method;
+
+	/* On first call, get the input type's typlen, and save at *fn_extra */
+	if (fcinfo->flinfo->fn_extra == NULL)
+	{
+		/* Lookup the datatype of the supplied argument */
+		Oid			argtypeid = get_fn_expr_argtype(fcinfo->flinfo, 0);
+
+		typlen = get_typlen(argtypeid);
+		if (typlen == 0)		/* should not happen */
+			elog(ERROR, "cache lookup failed for type %u", argtypeid);
+
+		fcinfo->flinfo->fn_extra = MemoryContextAlloc(fcinfo->flinfo->fn_mcxt,
+													  sizeof(int));
+		*((int *) fcinfo->flinfo->fn_extra) = typlen;
+	}
+	else
+		typlen = *((int *) fcinfo->flinfo->fn_extra);
+
+	/* only varlena values can be compressed */
+	if (typlen != -1)
+		PG_RETURN_NULL();
+
+	method = toast_datum_compression(PG_GETARG_DATUM(0));
+	if (method < 0)
+		PG_RETURN_NULL();
+
+	PG_RETURN_TEXT_P(cstring_to_text(toast_compression_name(method)));
+}
+
 /*
  * string_agg - Concatenates values and returns string.
  *
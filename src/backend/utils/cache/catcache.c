@@ -36,6 +36,9 @@
 #include "utils/resowner_private.h"
 #include "utils/syscache.h"
 #include "utils/tqual.h"
+#ifdef ADB
+#include "utils/sharedcatcache.h"
+#endif
 
 
  /* #define CACHEDEBUG */	/* turns DEBUG elogs on */
@@ -71,6 +74,13 @@
 /* Cache management header --- pointer is NULL until created */
 static CatCacheHeader *CacheHdr = NULL;
 
+#ifdef ADB
+int			catalog_cache_memory_limit = 0;
+
+/* approximate memory used by a cache entry */
+#define CatCTupSize(ct) (sizeof(CatCTup) + (ct)->tuple.t_len)
+#endif
+
 
 static uint32 CatalogCacheComputeHashValue(CatCache *cache, int nkeys,
 							 ScanKey cur_skey);
@@ -82,6 +92,9 @@ static void CatCachePrintStats(int code, Datum arg);
 #endif
 static void CatCacheRemoveCTup(CatCache *cache, CatCTup *ct);
 static void CatCacheRemoveCList(CatCache *cache, CatCList *cl);
+#ifdef ADB
+static void CatCacheEvict(Size needed);
+#endif
 static void CatalogCacheInitializeCache(CatCache *cache);
 static CatCTup *CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp,
 						uint32 hashValue, Index hashIndex,
@@ -372,6 +385,10 @@ CatCacheRemoveCTup(CatCache *cache, CatCTup *ct)
 
 	/* delink from linked list */
 	dlist_delete(&ct->cache_elem);
+#ifdef ADB
+	dlist_delete(&ct->lru_elem);
+	CacheHdr->ch_size -= CatCTupSize(ct);
+#endif
 
 	/* free associated tuple data */
 	if (ct->tuple.t_data != NULL)
@@ -422,6 +439,79 @@ CatCacheRemoveCList(CatCache *cache, CatCList *cl)
 	pfree(cl);
 }
 
+#ifdef ADB
+/*
+ *		CatCacheEvict
+ *
+ * Remove the least recently used entries nobody references until another
+ * "needed" bytes fit into catalog_cache_memory_limit, or no such entry is
+ * left.  An entry that is a member of an unreferenced CatCList takes the
+ * list with it.
+ */
+static void
+CatCacheEvict(Size needed)
+{
+	Size		limit = (Size) catalog_cache_memory_limit * 1024;
+	dlist_head *lru = &CacheHdr->ch_lrulist;
+	dlist_node *cur;
+
+	if (dlist_is_empty(lru))
+		return;
+
+	cur = dlist_tail_node(lru);
+	while (CacheHdr->ch_size + needed > limit)
+	{
+		CatCTup    *ct = dlist_container(CatCTup, lru_elem, cur);
+		dlist_node *prev = NULL;
+		bool		had_list = (ct->c_list != NULL);
+
+		if (dlist_has_prev(lru, cur))
+			prev = dlist_prev_node(lru, cur);
+
+		if (ct->refcount == 0 && !ct->dead &&
+			(ct->c_list == NULL || ct->c_list->refcount == 0))
+		{
+			CatCacheRemoveCTup(ct->my_cache, ct);
+			CacheHdr->ch_evictions++;
+
+			/* removing the list may have removed other members, too */
+			if (had_list)
+			{
+				if (dlist_is_empty(lru))
+					break;
+				prev = dlist_tail_node(lru);
+			}
+		}
+
+		if (prev == NULL)
+			break;
+		cur = prev;
+	}
+}
+
+/*
+ *		CatalogCacheGetUsage
+ *
+ * Report the size and activity of this backend's catalog caches.
+ */
+void
+CatalogCacheGetUsage(int64 *entries, int64 *size, int64 *hits,
+					 int64 *misses, int64 *evictions)
+{
+	if (CacheHdr == NULL)
+	{
+		*entries = *size = *hits = *misses = *evictions = 0;
+		return;
+	}
+
+	*entries = CacheHdr->ch_ntup;
+	*size = CacheHdr->ch_size;
+	*hits = CacheHdr->ch_hits;
+	*misses = CacheHdr->ch_misses;
+	*evictions = CacheHdr->ch_evictions;
+}
+#endif
+
 
 /*
  *	CatalogCacheIdInvalidate
@@ -510,6 +600,66 @@ CatalogCacheIdInvalidate(int cacheId, uint32 hashValue)
 	}
 }
 
+#ifdef ADB
+/*
+ *	CatalogCacheIdInvalidateSummary
+ *
+ *	Invalidate the entries of a cache that a reset backend may have missed
+ *	messages about, that is whose hash value falls into one of the slots of
+ *	"summary".  Like CatalogCacheIdInvalidate, all the lists go.
+ */
+void
+CatalogCacheIdInvalidateSummary(int cacheId, const SharedInvalSummary *summary)
+{
+	slist_iter	cache_iter;
+
+	slist_foreach(cache_iter, &CacheHdr->ch_caches)
+	{
+		CatCache   *ccp = slist_container(CatCache, cc_next, cache_iter.cur);
+		dlist_mutable_iter iter;
+		int			i;
+
+		if (cacheId != ccp->id)
+			continue;
+
+		dlist_foreach_modify(iter, &ccp->cc_lists)
+		{
+			CatCList   *cl = dlist_container(CatCList, cache_elem, iter.cur);
+
+			if (cl->refcount > 0)
+				cl->dead = true;
+			else
+				CatCacheRemoveCList(ccp, cl);
+		}
+
+		for (i = 0; i < ccp->cc_nbuckets; i++)
+		{
+			dlist_foreach_modify(iter, &ccp->cc_bucket[i])
+			{
+				CatCTup    *ct = dlist_container(CatCTup, cache_elem, iter.cur);
+
+				if (!SharedInvalSummaryHasBucket(summary,
+							SharedInvalCatcacheBucket(cacheId, ct->hash_value)))
+					continue;
+
+				if (ct->refcount > 0 ||
+					(ct->c_list && ct->c_list->refcount > 0))
+				{
+					ct->dead = true;
+					Assert(ct->c_list == NULL || ct->c_list->dead);
+				}
+				else
+					CatCacheRemoveCTup(ccp, ct);
+#ifdef CATCACHE_STATS
+				ccp->cc_invals++;
+#endif
+			}
+		}
+		break;					/* need only search this one cache */
+	}
+}
+#endif
+
 /* ----------------------------------------------------------------
  *					   public functions
  * ----------------------------------------------------------------
@@ -762,6 +912,13 @@ InitCatCache(int id,
 		CacheHdr = (CatCacheHeader *) palloc(sizeof(CatCacheHeader));
 		slist_init(&CacheHdr->ch_caches);
 		CacheHdr->ch_ntup = 0;
+#ifdef ADB
+		dlist_init(&CacheHdr->ch_lrulist);
+		CacheHdr->ch_size = 0;
+		CacheHdr->ch_hits = 0;
+		CacheHdr->ch_misses = 0;
+		CacheHdr->ch_evictions = 0;
+#endif
 #ifdef CATCACHE_STATS
 		/* set up to dump stats at backend exit */
 		on_proc_exit(CatCachePrintStats, 0);
@@ -1065,6 +1222,11 @@ SearchCatCache(CatCache *cache,
 	Relation	relation;
 	SysScanDesc scandesc;
 	HeapTuple	ntp;
+#ifdef ADB
+	bool		use_shared;
+	Oid			shared_dbid = InvalidOid;
+	uint32		shared_generation = 0;
+#endif
 
 	/*
 	 * one-time startup overhead for each cache
@@ -1128,6 +1290,10 @@ SearchCatCache(CatCache *cache,
 		 * near the front of the hashbucket's list.)
 		 */
 		dlist_move_head(bucket, &ct->cache_elem);
+#ifdef ADB
+		dlist_move_head(&CacheHdr->ch_lrulist, &ct->lru_elem);
+		CacheHdr->ch_hits++;
+#endif
 
 		/*
 		 * If it's a positive entry, bump its refcount and return it. If it's
@@ -1176,6 +1342,49 @@ SearchCatCache(CatCache *cache,
 	 * This case is rare enough that it's not worth expending extra cycles to
 	 * detect.
 	 */
+#ifdef ADB
+	CacheHdr->ch_misses++;
+
+	/*
+	 * Another backend may have read the tuple already, try the shared cache
+	 * first.  Only positive entries are shared.
+	 */
+	use_shared = SharedCatCacheActive();
+	if (use_shared)
+	{
+		shared_dbid = cache->cc_relisshared ? InvalidOid : MyDatabaseId;
+		ntp = SharedCatCacheLookup(shared_dbid, cache->id, hashValue);
+		if (ntp != NULL)
+		{
+			bool		res;
+
+			HeapKeyTest(ntp,
+						cache->cc_tupdesc,
+						cache->cc_nkeys,
+						cur_skey,
+						res);
+			if (res)
+			{
+				ct = CatalogCacheCreateEntry(cache, ntp,
+											 hashValue, hashIndex,
+											 false);
+				heap_freetuple(ntp);
+				/* immediately set the refcount to 1 */
+				ResourceOwnerEnlargeCatCacheRefs(CurrentResourceOwner);
+				ct->refcount++;
+				ResourceOwnerRememberCatCacheRef(CurrentResourceOwner, &ct->tuple);
+
+				CACHE3_elog(DEBUG2, "SearchCatCache(%s): found in shared cache, put in bucket %d",
+							cache->cc_relname, hashIndex);
+
+				return &ct->tuple;
+			}
+			heap_freetuple(ntp);
+		}
+		shared_generation = SharedCatCacheGeneration();
+	}
+#endif
+
 	relation = heap_open(cache->cc_reloid, AccessShareLock);
 
 	scandesc = systable_beginscan(relation,
@@ -1196,6 +1405,11 @@ SearchCatCache(CatCache *cache,
 		ResourceOwnerEnlargeCatCacheRefs(CurrentResourceOwner);
 		ct->refcount++;
 		ResourceOwnerRememberCatCacheRef(CurrentResourceOwner, &ct->tuple);
+#ifdef ADB
+		if (use_shared)
+			SharedCatCacheStore(shared_dbid, cache->id, hashValue,
+								&ct->tuple, shared_generation);
+#endif
 		break;					/* assume only one match */
 	}
 
@@ -1420,6 +1634,12 @@ SearchCatCacheList(CatCache *cache,
 		 * individually.)
 		 */
 		dlist_move_head(&cache->cc_lists, &cl->cache_elem);
+#ifdef ADB
+		/* but the members are used, so they must not age out of the cache */
+		for (i = 0; i < cl->n_members; i++)
+			dlist_move_head(&CacheHdr->ch_lrulist,
+							&cl->members[i]->lru_elem);
+#endif
 
 		/* Bump the list's refcount and return it */
 		ResourceOwnerEnlargeCatCacheListRefs(CurrentResourceOwner);
@@ -1674,6 +1894,15 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp,
 	ct->negative = negative;
 	ct->hash_value = hashValue;
 
+#ifdef ADB
+	/* make room for the new entry first, so it cannot be evicted itself */
+	if (catalog_cache_memory_limit > 0 &&
+		CacheHdr->ch_size + CatCTupSize(ct) >
+		(Size) catalog_cache_memory_limit * 1024)
+		CatCacheEvict(CatCTupSize(ct));
+	dlist_push_head(&CacheHdr->ch_lrulist, &ct->lru_elem);
+	CacheHdr->ch_size += CatCTupSize(ct);
+#endif
 	dlist_push_head(&cache->cc_bucket[hashIndex], &ct->cache_elem);
 
 	cache->cc_ntup++;
@@ -107,6 +107,10 @@
 #include "utils/rel.h"
 #include "utils/relmapper.h"
 #include "utils/syscache.h"
+#ifdef ADB
+#include "utils/sharedcatcache.h"
+#include "utils/sharedplancache.h"
+#endif
 
 
 /*
@@ -573,6 +577,61 @@ InvalidateSystemCaches(void)
 	}
 }
 
+#ifdef ADB
+/*
+ *		InvalidateSystemCachesAfterReset
+ *
+ *		Like InvalidateSystemCaches, for a shared-inval-queue overflow.  But
+ *		when the queue could tell what we missed, only the catcache and
+ *		relcache entries the lost messages may have been about are flushed,
+ *		and only the callbacks of the caches concerned are called, so that
+ *		not everything has to be loaded again after a burst of DDL.
+ */
+static void
+InvalidateSystemCachesAfterReset(void)
+{
+	const SharedInvalSummary *shared = SIGetResetSummary();
+	SharedInvalSummary summary;
+	int			i;
+
+	if (shared == NULL)
+	{
+		InvalidateSystemCaches();
+		return;
+	}
+
+	/* Processing may recurse into another reset, so work on a copy */
+	memcpy(&summary, shared, sizeof(SharedInvalSummary));
+
+	for (i = 0; i < SINVAL_SUMMARY_CACHES; i++)
+	{
+		if (summary.caches[i])
+			CatalogCacheIdInvalidateSummary(i, &summary);
+	}
+
+	/* handles smgr and relmap too */
+	RelationCacheInvalidateSummary(&summary);
+
+	for (i = 0; i < syscache_callback_count; i++)
+	{
+		struct SYSCACHECALLBACK *ccitem = syscache_callback_list + i;
+
+		if (summary.caches[ccitem->id])
+			(*ccitem->function) (ccitem->arg, ccitem->id, 0);
+	}
+
+	if (summary.relcache)
+	{
+		for (i = 0; i < relcache_callback_count; i++)
+		{
+			struct RELCACHECALLBACK *ccitem = relcache_callback_list + i;
+
+			(*ccitem->function) (ccitem->arg, InvalidOid);
+		}
+	}
+}
+#endif
+
 
 /* ----------------------------------------------------------------
  *					  public functions
@@ -590,8 +649,13 @@ InvalidateSystemCaches(void)
 void
 AcceptInvalidationMessages(void)
 {
+#ifdef ADB
+	ReceiveSharedInvalidMessages(LocalExecuteInvalidationMessage,
+								 InvalidateSystemCachesAfterReset);
+#else
 	ReceiveSharedInvalidMessages(LocalExecuteInvalidationMessage,
 								 InvalidateSystemCaches);
+#endif
 
 	/*
 	 * Test code to force cache flushes anytime a flush could happen.
@@ -809,6 +873,20 @@ ProcessCommittedInvalidationMessages(SharedInvalidationMessage *msgs,
 		RelationCacheInitFilePostInvalidate();
 }
 
+#ifdef ADB
+/*
+ * InvalidationsPending
+ *		Has the current transaction queued up any invalidation messages?
+ *
+ * If so, it changed catalog rows that other backends do not see yet.
+ */
+bool
+InvalidationsPending(void)
+{
+	return transInvalInfo != NULL;
+}
+#endif
+
 /*
  * AtEOXact_Inval
  *		Process queued-up invalidation messages at end of main transaction.
@@ -852,9 +930,23 @@ AtEOXact_Inval(bool isCommit)
 		AppendInvalidationMessages(&transInvalInfo->PriorCmdInvalidMsgs,
 								   &transInvalInfo->CurrentCmdInvalidMsgs);
 
+#ifdef ADB
+		/* Shared statements are dropped both before and after sending */
+		ProcessInvalidationMessagesMulti(&transInvalInfo->PriorCmdInvalidMsgs,
+										 SharedPlanCacheInvalidateMessages);
+#endif
+
 		ProcessInvalidationMessagesMulti(&transInvalInfo->PriorCmdInvalidMsgs,
 										 SendSharedInvalidMessages);
 
+#ifdef ADB
+		/* Our commit is visible by now, drop what it changed */
+		ProcessInvalidationMessagesMulti(&transInvalInfo->PriorCmdInvalidMsgs,
+										 SharedCatCacheInvalidateMessages);
+		ProcessInvalidationMessagesMulti(&transInvalInfo->PriorCmdInvalidMsgs,
+										 SharedPlanCacheInvalidateMessages);
+#endif
+
 		if (transInvalInfo->RelcacheInitFileInval)
 			RelationCacheInitFilePostInvalidate();
 	}
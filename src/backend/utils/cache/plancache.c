@@ -106,6 +106,9 @@ static void AcquirePlannerLocks(List *stmt_list, bool acquire);
 static void ScanQueryForLocks(Query *parsetree, bool acquire);
 static bool ScanQueryWalker(Node *node, bool *acquire);
 static bool plan_list_is_transient(List *stmt_list);
+#ifdef ADB
+static bool plan_list_has_motion(List *stmt_list);
+#endif
 static TupleDesc PlanCacheComputeResultDesc(List *stmt_list);
 static void PlanCacheRelCallback(Datum arg, Oid relid);
 static void PlanCacheFuncCallback(Datum arg, int cacheid, uint32 hashvalue);
@@ -840,6 +843,16 @@ CheckCachedPlan(CachedPlanSource *plansource)
 			!TransactionIdEquals(plan->saved_xmin, TransactionXmin))
 			plan->is_valid = false;
 
+#ifdef ADB
+		/*
+		 * Rows moved between datanodes are read by other sessions, which do
+		 * not see what this transaction wrote on the datanodes.  Once it did,
+		 * plan again, the planner then does not move rows.
+		 */
+		if (plan->is_valid && plan->has_motion && XactHasRemoteWrites())
+			plan->is_valid = false;
+#endif
+
 		/*
 		 * By now, if any invalidation has happened, the inval callback
 		 * functions will have marked the plan invalid.
@@ -1024,6 +1037,9 @@ BuildCachedPlan(CachedPlanSource *plansource, List *qlist,
 	}
 	else
 		plan->saved_xmin = InvalidTransactionId;
+#ifdef ADB
+	plan->has_motion = plan_list_has_motion(plist);
+#endif
 	plan->refcount = 0;
 	plan->context = plan_context;
 	plan->is_oneshot = plansource->is_oneshot;
@@ -1710,6 +1726,31 @@ plan_list_is_transient(List *stmt_list)
 	return false;
 }
 
+#ifdef ADB
+/*
+ * plan_list_has_motion: check if any of the plans in the list move rows
+ * between datanodes.
+ */
+static bool
+plan_list_has_motion(List *stmt_list)
+{
+	ListCell   *lc;
+
+	foreach(lc, stmt_list)
+	{
+		PlannedStmt *plannedstmt = (PlannedStmt *) lfirst(lc);
+
+		if (!IsA(plannedstmt, PlannedStmt))
+			continue;			/* Ignore utility statements */
+
+		if (plannedstmt->hasMotion)
+			return true;
+	}
+
+	return false;
+}
+#endif
+
 /*
  * PlanCacheComputeResultDesc: given a list of analyzed-and-rewritten Queries,
  * determine the result tupledesc it will produce.  Returns NULL if the
@@ -69,6 +69,9 @@
 #endif
 #include "rewrite/rewriteDefine.h"
 #include "storage/lmgr.h"
+#ifdef ADB
+#include "storage/sinval.h"
+#endif
 #include "storage/smgr.h"
 #include "utils/array.h"
 #include "utils/builtins.h"
@@ -150,6 +153,23 @@ static Oid	eoxact_list[MAX_EOXACT_LIST];
 static int	eoxact_list_len = 0;
 static bool eoxact_list_overflowed = false;
 
+#ifdef ADB
+/*
+ * Memory accounting of the relation cache.  Every entry carries an estimate
+ * of its size, which is added to relcacheSize while it is in the hashtable.
+ * Each open stamps the entry from a clock, so that the least recently used
+ * unreferenced entries can be thrown away at the end of a transaction
+ * which left the cache bigger than relation_cache_memory_limit.
+ */
+int			relation_cache_memory_limit = 0;
+
+static Size relcacheSize = 0;
+static uint64 relcacheClock = 0;
+static long relcacheHits = 0L;
+static long relcacheMisses = 0L;
+static long relcacheEvictions = 0L;
+#endif
+
 #define EOXactListAdd(rel) \
 	do { \
 		if (eoxact_list_len < MAX_EOXACT_LIST) \
@@ -162,6 +182,22 @@ static bool eoxact_list_overflowed = false;
 /*
  *		macros to manipulate the lookup hashtables
  */
+#ifdef ADB
+#define RelationCacheInsert(RELATION)	\
+do { \
+	RelIdCacheEnt *idhentry; bool found; \
+	idhentry = (RelIdCacheEnt*)hash_search(RelationIdCache, \
+										   (void *) &(RELATION->rd_id), \
+										   HASH_ENTER, &found); \
+	/* used to give notice if found -- now just keep quiet */ \
+	if (found) \
+		relcacheSize -= idhentry->reldesc->rd_cachesize; \
+	RELATION->rd_cachesize = RelationCacheEntrySize(RELATION); \
+	RELATION->rd_lastused = ++relcacheClock; \
+	relcacheSize += RELATION->rd_cachesize; \
+	idhentry->reldesc = RELATION; \
+} while(0)
+#else
 #define RelationCacheInsert(RELATION)	\
 do { \
 	RelIdCacheEnt *idhentry; bool found; \
@@ -171,6 +207,7 @@ do { \
 	/* used to give notice if found -- now just keep quiet */ \
 	idhentry->reldesc = RELATION; \
 } while(0)
+#endif
 
 #define RelationIdCacheLookup(ID, RELATION) \
 do { \
@@ -184,6 +221,19 @@ do { \
 		RELATION = NULL; \
 } while(0)
 
+#ifdef ADB
+#define RelationCacheDelete(RELATION) \
+do { \
+	RelIdCacheEnt *idhentry; \
+	idhentry = (RelIdCacheEnt*)hash_search(RelationIdCache, \
+										   (void *) &(RELATION->rd_id), \
+										   HASH_REMOVE, NULL); \
+	if (idhentry == NULL) \
+		elog(WARNING, "trying to delete a rd_id reldesc that does not exist"); \
+	else \
+		relcacheSize -= RELATION->rd_cachesize; \
+} while(0)
+#else
 #define RelationCacheDelete(RELATION) \
 do { \
 	RelIdCacheEnt *idhentry; \
@@ -193,6 +243,7 @@ do { \
 	if (idhentry == NULL) \
 		elog(WARNING, "trying to delete a rd_id reldesc that does not exist"); \
 } while(0)
+#endif
 
 
 /*
@@ -217,6 +268,10 @@ static HTAB *OpClassCache = NULL;
 /* non-export function prototypes */
 
 static void RelationDestroyRelation(Relation relation);
+#ifdef ADB
+static Size RelationCacheEntrySize(Relation relation);
+static void RelationCacheTrim(void);
+#endif
 static void RelationClearRelation(Relation relation, bool rebuild);
 
 static void RelationReloadIndexInfo(Relation relation);
@@ -1592,6 +1647,10 @@ RelationIdGetRelation(Oid relationId)
 
 	if (RelationIsValid(rd))
 	{
+#ifdef ADB
+		rd->rd_lastused = ++relcacheClock;
+		relcacheHits++;
+#endif
 		RelationIncrementReferenceCount(rd);
 		/* revalidate cache entry if necessary */
 		if (!rd->rd_isvalid)
@@ -1613,6 +1672,9 @@ RelationIdGetRelation(Oid relationId)
 	 * no reldesc in the cache, so have RelationBuildDesc() build one and add
 	 * it.
 	 */
+#ifdef ADB
+	relcacheMisses++;
+#endif
 	rd = RelationBuildDesc(relationId, true);
 	if (RelationIsValid(rd))
 		RelationIncrementReferenceCount(rd);
@@ -1852,7 +1914,7 @@ RelationDestroyRelation(Relation relation)
 		pfree(relation->rd_fdwroutine);
 #ifdef ADB
 	if (relation->rd_locator_info)
-		FreeRelationLocInfo(relation->rd_locator_info);
+		ReleaseCachedRelationLocInfo(relation->rd_locator_info);
 #endif
 
 	pfree(relation);
@@ -2061,6 +2123,13 @@ RelationClearRelation(Relation relation, bool rebuild)
 		SWAPFIELD(Oid, rd_toastoid);
 		/* pgstat_info must be preserved */
 		SWAPFIELD(struct PgStat_TableStatus *, pgstat_info);
+		/* so must what we learned about HOT updates */
+		SWAPFIELD(RelationHotTuning, rd_hottuning);
+#ifdef ADB
+		/* the hashtable still accounts for the size of the old entry */
+		SWAPFIELD(Size, rd_cachesize);
+		SWAPFIELD(uint64, rd_lastused);
+#endif
 
 #undef SWAPFIELD
 
@@ -2283,6 +2352,63 @@ RelationCacheInvalidate(void)
 	list_free(rebuildList);
 }
 
+#ifdef ADB
+/*
+ * RelationCacheInvalidateSummary
+ *	 Recover from SI message buffer overflow when it's known which kinds of
+ *	 messages, and which relations, the lost messages were about.
+ *
+ *	 Only the entries whose OID falls into one of the slots of "summary" are
+ *	 flushed, by OID, nailed relations first.  As in RelationCacheInvalidate
+ *	 new-in-transaction relations are left alone.
+ */
+void
+RelationCacheInvalidateSummary(const SharedInvalSummary *summary)
+{
+	HASH_SEQ_STATUS status;
+	RelIdCacheEnt *idhentry;
+	Relation	relation;
+	List	   *flushList = NIL;
+	ListCell   *l;
+
+	if (summary->relmap)
+		RelationMapInvalidateAll();
+
+	hash_seq_init(&status, RelationIdCache);
+
+	while ((idhentry = (RelIdCacheEnt *) hash_seq_search(&status)) != NULL)
+	{
+		relation = idhentry->reldesc;
+
+		/* See RelationCacheInvalidate */
+		if (summary->relmap && RelationIsMapped(relation))
+			RelationInitPhysicalAddr(relation);
+
+		if (!summary->relcache ||
+			relation->rd_createSubid != InvalidSubTransactionId ||
+			relation->rd_newRelfilenodeSubid != InvalidSubTransactionId)
+			continue;
+
+		if (!SharedInvalSummaryHasBucket(summary,
+					SharedInvalRelcacheBucket(RelationGetRelid(relation))))
+			continue;
+
+		if (relation->rd_isnailed)
+			flushList = lcons_oid(RelationGetRelid(relation), flushList);
+		else
+			flushList = lappend_oid(flushList, RelationGetRelid(relation));
+	}
+
+	if (summary->smgr)
+		smgrcloseall();
+
+	/* Flushing may rebuild entries, so look each one up again */
+	foreach(l, flushList)
+		RelationCacheInvalidateEntry(lfirst_oid(l));
+	list_free(flushList);
+}
+#endif
+
 /*
  * RelationCloseSmgrByOid - close a relcache entry's smgr link
  *
@@ -2360,8 +2486,125 @@ AtEOXact_RelationCache(bool isCommit)
 	/* Now we're out of the transaction and can clear the list */
 	eoxact_list_len = 0;
 	eoxact_list_overflowed = false;
+
+#ifdef ADB
+	/* References to locator information end with the transaction */
+	AtEOXact_RelationLocInfo();
+
+	/*
+	 * Trim the cache only on commit, an aborting transaction may not have
+	 * released its references yet.
+	 */
+	if (isCommit && relation_cache_memory_limit > 0 &&
+		relcacheSize > (Size) relation_cache_memory_limit * 1024)
+		RelationCacheTrim();
+#endif
+}
+
+#ifdef ADB
+/*
+ * RelationCacheEntrySize
+ *
+ *		Estimate the memory used by a relcache entry: the RelationData, its
+ *		pg_class row and tuple descriptor, and the contexts holding index
+ *		and rule information.
+ */
+static Size
+RelationCacheEntrySize(Relation relation)
+{
+	Size		size;
+
+	size = sizeof(RelationData) + CLASS_TUPLE_SIZE;
+	if (relation->rd_att != NULL)
+		size += sizeof(struct tupleDesc) +
+			relation->rd_att->natts *
+			(sizeof(Form_pg_attribute) + ATTRIBUTE_FIXED_PART_SIZE);
+	if (relation->rd_options != NULL)
+		size += VARSIZE(relation->rd_options);
+	if (relation->rd_indexcxt != NULL)
+		size += ALLOCSET_SMALL_INITSIZE;
+	if (relation->rd_rulescxt != NULL)
+		size += ALLOCSET_SMALL_INITSIZE;
+
+	return size;
+}
+
+static int
+relcache_lastused_cmp(const void *a, const void *b)
+{
+	uint64		ua = (*(const Relation *) a)->rd_lastused;
+	uint64		ub = (*(const Relation *) b)->rd_lastused;
+
+	if (ua < ub)
+		return -1;
+	if (ua > ub)
+		return 1;
+	return 0;
+}
+
+/*
+ * RelationCacheTrim
+ *
+ *		Throw away the least recently used relcache entries which nobody
+ *		references, until the cache is a tenth below its limit; the slack
+ *		keeps a session that opens one more relation per transaction from
+ *		scanning the cache every time.  Nailed entries and those created
+ *		or given a new relfilenode in the current transaction stay.
+ */
+static void
+RelationCacheTrim(void)
+{
+	Size		target = (Size) relation_cache_memory_limit * 1024 / 10 * 9;
+	HASH_SEQ_STATUS status;
+	RelIdCacheEnt *idhentry;
+	Relation   *victims;
+	long		nvictims = 0;
+	long		i;
+
+	victims = (Relation *)
+		palloc(hash_get_num_entries(RelationIdCache) * sizeof(Relation));
+
+	hash_seq_init(&status, RelationIdCache);
+	while ((idhentry = (RelIdCacheEnt *) hash_seq_search(&status)) != NULL)
+	{
+		Relation	relation = idhentry->reldesc;
+
+		if (relation->rd_isnailed ||
+			!RelationHasReferenceCountZero(relation) ||
+			relation->rd_createSubid != InvalidSubTransactionId ||
+			relation->rd_newRelfilenodeSubid != InvalidSubTransactionId)
+			continue;
+		victims[nvictims++] = relation;
+	}
+
+	qsort(victims, nvictims, sizeof(Relation), relcache_lastused_cmp);
+
+	for (i = 0; i < nvictims && relcacheSize > target; i++)
+	{
+		RelationClearRelation(victims[i], false);
+		relcacheEvictions++;
+	}
+
+	pfree(victims);
 }
 
+/*
+ * RelationCacheGetUsage
+ *
+ *		Report the size and activity of this backend's relation cache.
+ */
+void
+RelationCacheGetUsage(int64 *entries, int64 *size, int64 *hits,
+					  int64 *misses, int64 *evictions)
+{
+	*entries = RelationIdCache ? hash_get_num_entries(RelationIdCache) : 0;
+	*size = relcacheSize;
+	*hits = relcacheHits;
+	*misses = relcacheMisses;
+	*evictions = relcacheEvictions;
+}
+#endif
+
 /*
  * AtEOXact_cleanup
  *
@@ -0,0 +1,293 @@
+/*-------------------------------------------------------------------------
+ *
+ * sharedcatcache.c
+ *
+ *	  Catalog tuples shared by the catalog caches of all backends.
+ *
+ * Every backend fills its own catalog caches by reading the catalogs,
+ * which a new session has to do again for every object it touches.  With
+ * many objects and short sessions that is a good part of the work done.
+ * So tuples read by SearchCatCache() are also kept in a direct mapped
+ * table in shared memory, where other backends look for them before
+ * reading the catalog.
+ *
+ * Readers take no lock, every slot carries a sequence counter (see
+ * storage/seqlock.h) and a torn read is a miss.  Writers of the same slot
+ * are serialized by a spinlock.
+ *
+ * A slot is invalidated by the backend committing the change of its tuple,
+ * once the commit is visible to everyone and before its locks are released.
+ * A backend may have read the old tuple just before that and store it
+ * just after, so each invalidation also advances a generation counter
+ * first, and a tuple is only stored if the counter did not move since
+ * before it was read.  A backend whose transaction has changes not
+ * committed yet has to see them, so it does not use the shared table at
+ * all until the end of the transaction.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/cache/sharedcatcache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "access/xlog.h"
+#include "miscadmin.h"
+#include "storage/seqlock.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "utils/inval.h"
+#include "utils/sharedcatcache.h"
+
+typedef struct SharedCatCacheSlot
+{
+	slock_t		mutex;			/* serializes writers of this slot */
+	uint32		version;		/* odd while the slot is being written */
+	bool		valid;
+	Oid			dbid;			/* InvalidOid for shared catalogs */
+	int			cacheId;
+	uint32		hashValue;
+	uint32		t_len;
+	ItemPointerData t_self;
+	Oid			t_tableOid;
+	char		data[SHARED_CATCACHE_TUPLE_SIZE];
+} SharedCatCacheSlot;
+
+typedef struct SharedCatCacheData
+{
+	slock_t		mutex;			/* protects generation */
+	uint32		generation;		/* advanced by every invalidation */
+	uint32		nslots;
+	SharedCatCacheSlot slots[1];	/* VARIABLE LENGTH ARRAY */
+} SharedCatCacheData;
+
+int			shared_catcache_size = 0;
+
+static SharedCatCacheData *CatCacheShared = NULL;
+
+#define SharedCatCacheSlotFor(cache, dbid, cacheId, hashValue) \
+	(&(cache)->slots[((hashValue) ^ ((uint32) (cacheId) * 0x9E3779B1) ^ \
+					  (uint32) (dbid)) % (cache)->nslots])
+
+/* Report shared memory space needed by SharedCatCacheShmemInit */
+Size
+SharedCatCacheShmemSize(void)
+{
+	Size		size;
+
+	if (shared_catcache_size <= 0)
+		return 0;
+
+	size = offsetof(SharedCatCacheData, slots);
+	size = add_size(size, mul_size(sizeof(SharedCatCacheSlot),
+								   shared_catcache_size));
+
+	return size;
+}
+
+/* Allocate and initialize shared catalog cache shared memory */
+void
+SharedCatCacheShmemInit(void)
+{
+	bool		found;
+	uint32		i;
+
+	if (shared_catcache_size <= 0)
+		return;
+
+	CatCacheShared = (SharedCatCacheData *)
+		ShmemInitStruct("Shared Catalog Cache", SharedCatCacheShmemSize(), &found);
+
+	if (!found)
+	{
+		/* First time through, so initialize */
+		MemSet(CatCacheShared, 0, SharedCatCacheShmemSize());
+		SpinLockInit(&CatCacheShared->mutex);
+		CatCacheShared->nslots = (uint32) shared_catcache_size;
+		for (i = 0; i < CatCacheShared->nslots; i++)
+			SpinLockInit(&CatCacheShared->slots[i].mutex);
+	}
+}
+
+/*
+ * May the current backend use the shared catalog cache right now?
+ *
+ * Not while its transaction has catalog changes others cannot see yet,
+ * and not during recovery, where no backend commits the changes replayed.
+ */
+bool
+SharedCatCacheActive(void)
+{
+	if (CatCacheShared == NULL || !IsUnderPostmaster)
+		return false;
+
+	if (IsBootstrapProcessingMode() || RecoveryInProgress())
+		return false;
+
+	return !InvalidationsPending();
+}
+
+/*
+ * Return the current generation, to be passed to SharedCatCacheStore() for
+ * a tuple read from the catalog after this call.
+ */
+uint32
+SharedCatCacheGeneration(void)
+{
+	volatile SharedCatCacheData *cache = CatCacheShared;
+	uint32		generation;
+
+	SpinLockAcquire(&cache->mutex);
+	generation = cache->generation;
+	SpinLockRelease(&cache->mutex);
+
+	return generation;
+}
+
+/*
+ * Look for a tuple of catalog cache "cacheId", returns a palloc'd copy or
+ * NULL if there is none.  The caller still has to check the tuple matches
+ * its keys, only the hash value is compared here.
+ */
+HeapTuple
+SharedCatCacheLookup(Oid dbid, int cacheId, uint32 hashValue)
+{
+	volatile SharedCatCacheData *cache = CatCacheShared;
+	volatile SharedCatCacheSlot *slot;
+	uint32		version;
+	uint32		len;
+	HeapTuple	tuple;
+
+	if (cache == NULL)
+		return NULL;
+
+	slot = SharedCatCacheSlotFor(cache, dbid, cacheId, hashValue);
+
+	version = SeqLockReadBegin(&slot->version);
+	if (SeqLockWriting(version) || !slot->valid ||
+		slot->dbid != dbid || slot->cacheId != cacheId ||
+		slot->hashValue != hashValue)
+		return NULL;
+
+	len = slot->t_len;
+	if (len > SHARED_CATCACHE_TUPLE_SIZE)
+		return NULL;
+
+	tuple = (HeapTuple) palloc(HEAPTUPLESIZE + len);
+	tuple->t_len = len;
+	tuple->t_self = slot->t_self;
+	tuple->t_tableOid = slot->t_tableOid;
+	tuple->t_data = (HeapTupleHeader) ((char *) tuple + HEAPTUPLESIZE);
+	memcpy((char *) tuple->t_data, (char *) slot->data, len);
+
+	if (SeqLockReadRetry(&slot->version, version))
+	{
+		pfree(tuple);
+		return NULL;
+	}
+
+	return tuple;
+}
+
+/*
+ * Remember a tuple of catalog cache "cacheId" read from the catalog, unless
+ * an invalidation happened since "generation" was got.
+ */
+void
+SharedCatCacheStore(Oid dbid, int cacheId, uint32 hashValue,
+					HeapTuple tuple, uint32 generation)
+{
+	volatile SharedCatCacheData *cache = CatCacheShared;
+	volatile SharedCatCacheSlot *slot;
+
+	if (cache == NULL || tuple->t_len > SHARED_CATCACHE_TUPLE_SIZE)
+		return;
+
+	slot = SharedCatCacheSlotFor(cache, dbid, cacheId, hashValue);
+
+	SpinLockAcquire(&slot->mutex);
+	if (cache->generation == generation)
+	{
+		SeqLockWriteBegin(&slot->version);
+		slot->valid = true;
+		slot->dbid = dbid;
+		slot->cacheId = cacheId;
+		slot->hashValue = hashValue;
+		slot->t_len = tuple->t_len;
+		slot->t_self = tuple->t_self;
+		slot->t_tableOid = tuple->t_tableOid;
+		memcpy((char *) slot->data, (char *) tuple->t_data, tuple->t_len);
+		SeqLockWriteEnd(&slot->version);
+	}
+	SpinLockRelease(&slot->mutex);
+}
+
+/*
+ * Clear the slot of one tuple, or every slot if cacheId is negative.
+ */
+static void
+SharedCatCacheInvalidate(Oid dbid, int cacheId, uint32 hashValue)
+{
+	volatile SharedCatCacheData *cache = CatCacheShared;
+	volatile SharedCatCacheSlot *slot;
+	uint32		i;
+
+	/* Advance the generation first, see SharedCatCacheStore */
+	SpinLockAcquire(&cache->mutex);
+	cache->generation++;
+	SpinLockRelease(&cache->mutex);
+
+	for (i = 0; i < cache->nslots; i++)
+	{
+		if (cacheId >= 0)
+			slot = SharedCatCacheSlotFor(cache, dbid, cacheId, hashValue);
+		else
+			slot = &cache->slots[i];
+
+		SpinLockAcquire(&slot->mutex);
+		if (slot->valid &&
+			(cacheId < 0 ||
+			 (slot->dbid == dbid && slot->cacheId == cacheId &&
+			  slot->hashValue == hashValue)))
+		{
+			SeqLockWriteBegin(&slot->version);
+			slot->valid = false;
+			SeqLockWriteEnd(&slot->version);
+		}
+		SpinLockRelease(&slot->mutex);
+
+		if (cacheId >= 0)
+			break;
+	}
+}
+
+/*
+ * Apply the invalidation messages of a committed transaction to the
+ * shared catalog cache.
+ *
+ * This must be called after the commit became visible to other backends.
+ */
+void
+SharedCatCacheInvalidateMessages(const SharedInvalidationMessage *msgs, int n)
+{
+	int			i;
+
+	if (CatCacheShared == NULL)
+		return;
+
+	for (i = 0; i < n; i++)
+	{
+		const SharedInvalidationMessage *msg = &msgs[i];
+
+		if (msg->id >= 0)
+			SharedCatCacheInvalidate(msg->cc.dbId, msg->id, msg->cc.hashValue);
+		else if (msg->id == SHAREDINVALCATALOG_ID)
+		{
+			/* The tuples of a rewritten catalog moved, forget all of them */
+			SharedCatCacheInvalidate(InvalidOid, -1, 0);
+		}
+	}
+}
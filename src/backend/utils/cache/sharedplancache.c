@@ -0,0 +1,562 @@
+/*-------------------------------------------------------------------------
+ *
+ * sharedplancache.c
+ *
+ *	  Analyzed and rewritten prepared statements shared by all backends.
+ *
+ * Every pooled session prepares the same statements of the applications
+ * again, and parse analysis, with the catalog lookups it does in a new
+ * session, is a good part of that work.  So the query trees produced for a
+ * Parse message on a Coordinator are also kept in a direct mapped table in
+ * shared memory, as strings written by nodeToString().  Another session
+ * preparing the same text with the same parameter types, search path and
+ * parser settings reads them back instead of analyzing the statement.
+ *
+ * Plan trees cannot be read back by readfuncs.c, so each session still
+ * plans the statements itself; what it gets from here is what its own
+ * CachedPlanSource would have held.  From then on the local plan cache
+ * works as usual, including its invalidation.
+ *
+ * Readers take no lock, every slot carries a sequence counter (see
+ * storage/seqlock.h) and a torn read is a miss.  Writers of the same slot
+ * are serialized by a spinlock.
+ *
+ * Each slot remembers the relations and the functions its statement
+ * depends on.  The backend committing a change of them clears the slot,
+ * both before it sends its invalidation messages, so that a backend which
+ * processed them cannot find the out of date statement any more, and once
+ * again after it, to throw away a statement analyzed meanwhile with stale
+ * catalog caches.  Every invalidation also advances a generation counter,
+ * and a statement is only stored if the counter did not move since before
+ * it was analyzed.  A backend whose transaction has catalog changes not
+ * committed yet neither looks here nor stores anything.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/cache/sharedplancache.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/hash.h"
+#include "access/xlog.h"
+#include "catalog/namespace.h"
+#include "catalog/pg_type.h"
+#include "lib/stringinfo.h"
+#include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "nodes/plannodes.h"
+#include "optimizer/planmain.h"
+#include "parser/parse_expr.h"
+#include "parser/parser.h"
+#include "pgxc/pgxc.h"
+#include "storage/seqlock.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "utils/array.h"
+#include "utils/guc.h"
+#include "utils/inval.h"
+#include "utils/sharedplancache.h"
+#include "utils/syscache.h"
+
+/* Most dependencies a statement kept in a slot may have */
+#define SHARED_PLAN_MAX_RELS	32
+#define SHARED_PLAN_MAX_ITEMS	32
+
+typedef struct SharedPlanCacheSlot
+{
+	slock_t		mutex;			/* serializes writers of this slot */
+	uint32		version;		/* odd while the slot is being written */
+	bool		valid;
+	Oid			dbid;
+	uint32		hashValue;		/* hash of the key */
+	uint32		keylen;
+	int			numParams;		/* # of parameter types after the key */
+	uint32		treelen;		/* length of the query trees, with the NUL */
+	int			nrels;
+	Oid			rels[SHARED_PLAN_MAX_RELS];
+	int			nitems;
+	int			itemCacheId[SHARED_PLAN_MAX_ITEMS];
+	uint32		itemHashValue[SHARED_PLAN_MAX_ITEMS];
+	char		data[SHARED_PLAN_CACHE_ENTRY_SIZE];
+} SharedPlanCacheSlot;
+
+typedef struct SharedPlanCacheData
+{
+	slock_t		mutex;			/* protects generation */
+	uint32		generation;		/* advanced by every invalidation */
+	uint32		nslots;
+	SharedPlanCacheSlot slots[1];	/* VARIABLE LENGTH ARRAY */
+} SharedPlanCacheData;
+
+/*
+ * Fixed part of the key, followed by the search path, the parameter types
+ * given by the client and the text of the statement.
+ */
+typedef struct SharedPlanKey
+{
+	Oid			dbid;
+	int			grammar;
+	int			flags;			/* parser settings, see build_key */
+	int			npath;
+	int			nparams;
+} SharedPlanKey;
+
+int			shared_plan_cache_size = 0;
+
+static SharedPlanCacheData *PlanCacheShared = NULL;
+
+static void build_key(StringInfo key, const char *query_string,
+		  ParseGrammar grammar, Oid *paramTypes, int numParams);
+static bool shared_plan_unsafe_walker(Node *node, void *context);
+static bool slot_depends_on(volatile SharedPlanCacheSlot *slot,
+				const SharedInvalidationMessage *msgs, int n);
+
+/* Report shared memory space needed by SharedPlanCacheShmemInit */
+Size
+SharedPlanCacheShmemSize(void)
+{
+	Size		size;
+
+	if (shared_plan_cache_size <= 0)
+		return 0;
+
+	size = offsetof(SharedPlanCacheData, slots);
+	size = add_size(size, mul_size(sizeof(SharedPlanCacheSlot),
+								   shared_plan_cache_size));
+
+	return size;
+}
+
+/* Allocate and initialize shared plan cache shared memory */
+void
+SharedPlanCacheShmemInit(void)
+{
+	bool		found;
+	uint32		i;
+
+	if (shared_plan_cache_size <= 0)
+		return;
+
+	PlanCacheShared = (SharedPlanCacheData *)
+		ShmemInitStruct("Shared Plan Cache", SharedPlanCacheShmemSize(), &found);
+
+	if (!found)
+	{
+		/* First time through, so initialize */
+		MemSet(PlanCacheShared, 0, SharedPlanCacheShmemSize());
+		SpinLockInit(&PlanCacheShared->mutex);
+		PlanCacheShared->nslots = (uint32) shared_plan_cache_size;
+		for (i = 0; i < PlanCacheShared->nslots; i++)
+			SpinLockInit(&PlanCacheShared->slots[i].mutex);
+	}
+}
+
+/*
+ * May the current backend use the shared plan cache right now?
+ *
+ * Only sessions of clients on a Coordinator do, the statements a
+ * Coordinator sends to other nodes are analyzed differently.
+ */
+bool
+SharedPlanCacheActive(void)
+{
+	if (PlanCacheShared == NULL || !IsUnderPostmaster)
+		return false;
+
+	if (!IS_PGXC_COORDINATOR || IsConnFromCoord())
+		return false;
+
+	if (RecoveryInProgress())
+		return false;
+
+	return !InvalidationsPending();
+}
+
+/*
+ * Return the current generation, to be passed to SharedPlanCacheStore() for
+ * a statement analyzed after this call.
+ */
+uint32
+SharedPlanCacheGeneration(void)
+{
+	volatile SharedPlanCacheData *cache = PlanCacheShared;
+	uint32		generation;
+
+	SpinLockAcquire(&cache->mutex);
+	generation = cache->generation;
+	SpinLockRelease(&cache->mutex);
+
+	return generation;
+}
+
+/*
+ * Everything parse analysis of a statement depends on, apart from the
+ * catalogs.  Settings changing how literals are read are part of it, the
+ * ones changing how dates and times are read are not, because statements
+ * with such literals are never stored.
+ */
+static void
+build_key(StringInfo key, const char *query_string, ParseGrammar grammar,
+		  Oid *paramTypes, int numParams)
+{
+	SharedPlanKey hdr;
+	List	   *path;
+	ListCell   *lc;
+
+	path = fetch_search_path(true);
+
+	MemSet(&hdr, 0, sizeof(hdr));
+	hdr.dbid = MyDatabaseId;
+	hdr.grammar = (int) grammar;
+	hdr.flags = (standard_conforming_strings ? 0x01 : 0) |
+		(Transform_null_equals ? 0x02 : 0) |
+		(SQL_inheritance ? 0x04 : 0) |
+		(Array_nulls ? 0x08 : 0) |
+		(backslash_quote << 4);
+	hdr.npath = list_length(path);
+	hdr.nparams = numParams;
+
+	appendBinaryStringInfo(key, (char *) &hdr, sizeof(hdr));
+	foreach(lc, path)
+	{
+		Oid			nspid = lfirst_oid(lc);
+
+		appendBinaryStringInfo(key, (char *) &nspid, sizeof(Oid));
+	}
+	if (numParams > 0)
+		appendBinaryStringInfo(key, (char *) paramTypes,
+							   numParams * sizeof(Oid));
+	appendBinaryStringInfo(key, query_string, strlen(query_string));
+
+	list_free(path);
+}
+
+/*
+ * Look for the query trees of a statement, returns them read back into the
+ * current memory context, along with the types of all its parameters, or NIL
+ * if there are none.
+ */
+List *
+SharedPlanCacheLookup(const char *query_string, ParseGrammar grammar,
+					  Oid **paramTypes, int *numParams)
+{
+	volatile SharedPlanCacheData *cache = PlanCacheShared;
+	volatile SharedPlanCacheSlot *slot;
+	StringInfoData key;
+	uint32		hashValue;
+	uint32		version;
+	uint32		keylen;
+	uint32		treelen;
+	int			nparams;
+	Size		used;
+	char	   *buf;
+	Oid		   *types;
+	List	   *querytree_list;
+
+	if (cache == NULL)
+		return NIL;
+
+	initStringInfo(&key);
+	build_key(&key, query_string, grammar, *paramTypes, *numParams);
+	hashValue = DatumGetUInt32(hash_any((unsigned char *) key.data, key.len));
+	slot = &cache->slots[hashValue % cache->nslots];
+
+	version = SeqLockReadBegin(&slot->version);
+	keylen = slot->keylen;
+	treelen = slot->treelen;
+	nparams = slot->numParams;
+	if (SeqLockWriting(version) || !slot->valid ||
+		slot->dbid != MyDatabaseId || slot->hashValue != hashValue ||
+		keylen != (uint32) key.len || nparams < 0 || treelen == 0)
+	{
+		pfree(key.data);
+		return NIL;
+	}
+
+	used = (Size) keylen + (Size) nparams * sizeof(Oid) + treelen;
+	if (used > SHARED_PLAN_CACHE_ENTRY_SIZE)
+	{
+		pfree(key.data);
+		return NIL;
+	}
+
+	buf = palloc(used);
+	memcpy(buf, (char *) slot->data, used);
+
+	if (SeqLockReadRetry(&slot->version, version) ||
+		memcmp(buf, key.data, key.len) != 0 ||
+		buf[used - 1] != '\0')
+	{
+		pfree(buf);
+		pfree(key.data);
+		return NIL;
+	}
+
+	types = (Oid *) palloc(Max(nparams, 1) * sizeof(Oid));
+	if (nparams > 0)
+		memcpy(types, buf + keylen, nparams * sizeof(Oid));
+	querytree_list = (List *) stringToNode(buf + keylen + nparams * sizeof(Oid));
+
+	pfree(buf);
+	pfree(key.data);
+
+	*paramTypes = types;
+	*numParams = nparams;
+	return querytree_list;
+}
+
+/*
+ * Can a query tree be used by other sessions?  Not if analyzing it had side
+ * effects, and not if it holds a date or time value which could be read
+ * differently by them, or which may have been taken from the clock.
+ */
+static bool
+shared_plan_unsafe_walker(Node *node, void *context)
+{
+	if (node == NULL)
+		return false;
+
+	if (IsA(node, Const))
+	{
+		switch (((Const *) node)->consttype)
+		{
+			case DATEOID:
+			case TIMEOID:
+			case TIMETZOID:
+			case TIMESTAMPOID:
+			case TIMESTAMPTZOID:
+			case INTERVALOID:
+			case ABSTIMEOID:
+			case RELTIMEOID:
+			case TINTERVALOID:
+			case ORADATEOID:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	if (IsA(node, Query))
+	{
+		Query	   *query = (Query *) node;
+
+		if (query->utilityStmt != NULL || query->has_to_save_cmd_id)
+			return true;
+
+		return query_tree_walker(query, shared_plan_unsafe_walker,
+								 context, 0);
+	}
+
+	return expression_tree_walker(node, shared_plan_unsafe_walker, context);
+}
+
+/*
+ * Remember the query trees of a statement, unless an invalidation happened
+ * since "generation" was got.  The key is made of the parameter types the
+ * client gave, "paramTypes" are all of them as analysis determined them.
+ */
+void
+SharedPlanCacheStore(const char *query_string, ParseGrammar grammar,
+					 Oid *origParamTypes, int origNumParams,
+					 Oid *paramTypes, int numParams,
+					 List *querytree_list, uint32 generation)
+{
+	volatile SharedPlanCacheData *cache = PlanCacheShared;
+	volatile SharedPlanCacheSlot *slot;
+	StringInfoData key;
+	List	   *relationOids;
+	List	   *invalItems;
+	ListCell   *lc;
+	uint32		hashValue;
+	char	   *tree;
+	Size		treelen;
+	Size		used;
+
+	if (cache == NULL || querytree_list == NIL)
+		return;
+
+	foreach(lc, querytree_list)
+	{
+		Query	   *query = (Query *) lfirst(lc);
+
+		if (!IsA(query, Query) ||
+			shared_plan_unsafe_walker((Node *) query, NULL))
+			return;
+	}
+
+	extract_query_dependencies((Node *) querytree_list,
+							   &relationOids, &invalItems);
+	if (list_length(relationOids) > SHARED_PLAN_MAX_RELS ||
+		list_length(invalItems) > SHARED_PLAN_MAX_ITEMS)
+		return;
+
+	tree = nodeToString(querytree_list);
+	treelen = strlen(tree) + 1;
+
+	initStringInfo(&key);
+	build_key(&key, query_string, grammar, origParamTypes, origNumParams);
+
+	used = (Size) key.len + (Size) numParams * sizeof(Oid) + treelen;
+	if (used > SHARED_PLAN_CACHE_ENTRY_SIZE)
+	{
+		pfree(key.data);
+		pfree(tree);
+		return;
+	}
+
+	hashValue = DatumGetUInt32(hash_any((unsigned char *) key.data, key.len));
+	slot = &cache->slots[hashValue % cache->nslots];
+
+	SpinLockAcquire(&slot->mutex);
+	if (cache->generation == generation)
+	{
+		SeqLockWriteBegin(&slot->version);
+		slot->valid = true;
+		slot->dbid = MyDatabaseId;
+		slot->hashValue = hashValue;
+		slot->keylen = key.len;
+		slot->numParams = numParams;
+		slot->treelen = treelen;
+		slot->nrels = 0;
+		foreach(lc, relationOids)
+			slot->rels[slot->nrels++] = lfirst_oid(lc);
+		slot->nitems = 0;
+		foreach(lc, invalItems)
+		{
+			PlanInvalItem *item = (PlanInvalItem *) lfirst(lc);
+
+			slot->itemCacheId[slot->nitems] = item->cacheId;
+			slot->itemHashValue[slot->nitems] = item->hashValue;
+			slot->nitems++;
+		}
+		memcpy((char *) slot->data, key.data, key.len);
+		if (numParams > 0)
+			memcpy((char *) slot->data + key.len, paramTypes,
+				   numParams * sizeof(Oid));
+		memcpy((char *) slot->data + key.len + numParams * sizeof(Oid),
+			   tree, treelen);
+		SeqLockWriteEnd(&slot->version);
+	}
+	SpinLockRelease(&slot->mutex);
+
+	pfree(key.data);
+	pfree(tree);
+}
+
+/*
+ * Does the statement of a slot depend on anything the messages invalidate?
+ */
+static bool
+slot_depends_on(volatile SharedPlanCacheSlot *slot,
+				const SharedInvalidationMessage *msgs, int n)
+{
+	int			i;
+	int			j;
+
+	for (i = 0; i < n; i++)
+	{
+		const SharedInvalidationMessage *msg = &msgs[i];
+
+		if (msg->id >= 0)
+		{
+			if (msg->cc.dbId != InvalidOid && msg->cc.dbId != slot->dbid)
+				continue;
+			for (j = 0; j < slot->nitems && j < SHARED_PLAN_MAX_ITEMS; j++)
+			{
+				if (slot->itemCacheId[j] == msg->id &&
+					slot->itemHashValue[j] == msg->cc.hashValue)
+					return true;
+			}
+		}
+		else if (msg->id == SHAREDINVALRELCACHE_ID)
+		{
+			if (msg->rc.dbId != InvalidOid && msg->rc.dbId != slot->dbid)
+				continue;
+			for (j = 0; j < slot->nrels && j < SHARED_PLAN_MAX_RELS; j++)
+			{
+				if (slot->rels[j] == msg->rc.relId)
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Apply the invalidation messages of a committed transaction to the
+ * shared plan cache.
+ *
+ * This must be called both before and after the messages are sent to the
+ * other backends, see the comments at the top of the file.
+ */
+void
+SharedPlanCacheInvalidateMessages(const SharedInvalidationMessage *msgs, int n)
+{
+	volatile SharedPlanCacheData *cache = PlanCacheShared;
+	bool		relevant = false;
+	bool		reset = false;
+	uint32		i;
+
+	if (cache == NULL)
+		return;
+
+	for (i = 0; i < (uint32) n; i++)
+	{
+		const SharedInvalidationMessage *msg = &msgs[i];
+
+		if (msg->id >= 0)
+		{
+			relevant = true;
+
+			/* the same changes make the local plan cache drop everything */
+			if (msg->id == NAMESPACEOID || msg->id == OPEROID ||
+				msg->id == AMOPOPID)
+				reset = true;
+		}
+		else if (msg->id == SHAREDINVALRELCACHE_ID)
+		{
+			relevant = true;
+			if (msg->rc.relId == InvalidOid)
+				reset = true;
+		}
+	}
+
+	if (!relevant)
+		return;
+
+	/* Advance the generation first, see SharedPlanCacheStore */
+	SpinLockAcquire(&cache->mutex);
+	cache->generation++;
+	SpinLockRelease(&cache->mutex);
+
+	for (i = 0; i < cache->nslots; i++)
+	{
+		volatile SharedPlanCacheSlot *slot = &cache->slots[i];
+		uint32		version;
+		bool		match;
+
+		version = SeqLockReadBegin(&slot->version);
+
+		/* a slot being written is cleared in any case */
+		if (!SeqLockWriting(version) && !slot->valid)
+			continue;
+		match = reset || slot_depends_on(slot, msgs, n);
+		if (SeqLockReadRetry(&slot->version, version))
+			match = true;
+		if (!match)
+			continue;
+
+		SpinLockAcquire(&slot->mutex);
+		if (slot->valid)
+		{
+			SeqLockWriteBegin(&slot->version);
+			slot->valid = false;
+			SeqLockWriteEnd(&slot->version);
+		}
+		SpinLockRelease(&slot->mutex);
+	}
+}
@@ -2835,6 +2835,10 @@ write_pipe_chunks(char *data, int len, int dest)
 
 	Assert(len > 0);
 
+	/* Our log ring takes it without blocking, if we have one */
+	if (SysLoggerRingWrite(data, len, dest))
+		return;
+
 	p.proto.nuls[0] = p.proto.nuls[1] = '\0';
 	p.proto.pid = MyProcPid;
 
@@ -431,7 +431,8 @@ pg_split_opts(char **argv, int *argcp, char *optstr)
 }
 
 /*
- * Initialize MaxBackends value from config options.
+ * Initialize MaxBackends value, and the number of fast-path lock groups,
+ * from config options.
  *
  * This must be called after modules have had the chance to register background
  * workers in shared_preload_libraries, and before shared memory size is
@@ -461,6 +462,18 @@ InitializeMaxBackends(void)
 	/* internal error because the values were all checked previously */
 	if (MaxBackends > MAX_BACKENDS)
 		elog(ERROR, "too many backends configured");
+
+	/*
+	 * Give each backend enough fast-path lock slots to hold as many relation
+	 * locks as max_locks_per_transaction says a transaction typically needs,
+	 * rounded up to a power of two groups.
+	 */
+	Assert(FastPathLockGroupsPerBackend == 0);
+	FastPathLockGroupsPerBackend = 1;
+	while (FastPathLockGroupsPerBackend < FP_LOCK_GROUPS_PER_BACKEND_MAX &&
+		   FastPathLockGroupsPerBackend * FP_LOCK_SLOTS_PER_GROUP <
+		   max_locks_per_xact)
+		FastPathLockGroupsPerBackend *= 2;
 }
 
 /*
@@ -778,8 +778,20 @@ pg_mbstrlen_with_len(const char *mbstr, int limit)
 
 	while (limit > 0 && *mbstr)
 	{
-		int			l = pg_mblen(mbstr);
+		int			l;
 
+#ifdef ADB
+		if (!IS_HIGHBIT_SET(*mbstr))
+		{
+			/* a run of ASCII, one character per byte */
+			l = pg_ascii_prefix_len((const unsigned char *) mbstr, limit);
+			limit -= l;
+			mbstr += l;
+			len += l;
+			continue;
+		}
+#endif
+		l = pg_mblen(mbstr);
 		limit -= l;
 		mbstr += l;
 		len++;
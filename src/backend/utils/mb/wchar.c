@@ -1882,6 +1882,40 @@ pg_verify_mbstr(int encoding, const char *mbstr, int len, bool noError)
 	return pg_verify_mbstr_len(encoding, mbstr, len, noError) >= 0;
 }
 
+#ifdef ADB
+/*
+ * Return the number of leading bytes of "s" which are ASCII characters other
+ * than NUL, looking at "len" bytes at most.  Those are one character each in
+ * every server encoding.  The bytes are tested eight at a time while they
+ * all qualify, which is most of the text of most databases.
+ */
+int
+pg_ascii_prefix_len(const unsigned char *s, int len)
+{
+	const unsigned char *p = s;
+	const unsigned char *end = s + len;
+
+	while (end - p >= (int) sizeof(uint64))
+	{
+		uint64		chunk;
+
+		memcpy(&chunk, p, sizeof(chunk));
+
+		/* a high bit set, or a zero byte among bytes without high bits */
+		if ((chunk & UINT64CONST(0x8080808080808080)) != 0 ||
+			((chunk - UINT64CONST(0x0101010101010101)) &
+			 UINT64CONST(0x8080808080808080)) != 0)
+			break;
+		p += sizeof(uint64);
+	}
+
+	while (p < end && *p != '\0' && !IS_HIGHBIT_SET(*p))
+		p++;
+
+	return p - s;
+}
+#endif
+
 /*
  * Verify mbstr to make sure that it is validly encoded in the specified
  * encoding.
@@ -1929,9 +1963,16 @@ pg_verify_mbstr_len(int encoding, const char *mbstr, int len, bool noError)
 		{
 			if (*mbstr != '\0')
 			{
+#ifdef ADB
+				l = pg_ascii_prefix_len((const unsigned char *) mbstr, len);
+				mb_len += l;
+				mbstr += l;
+				len -= l;
+#else
 				mb_len++;
 				mbstr++;
 				len--;
+#endif
 				continue;
 			}
 			if (noError)
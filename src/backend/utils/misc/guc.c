@@ -27,11 +27,13 @@
 #include <syslog.h>
 #endif
 
+#include "access/clog.h"
 #include "access/gin.h"
 #ifdef PGXC
 #include "pgxc/pgxc.h"
 #endif
 #include "access/transam.h"
+#include "access/tuptoaster.h"
 #include "access/twophase.h"
 #include "access/xact.h"
 #include "catalog/namespace.h"
@@ -66,11 +68,26 @@
 #include "pgxc/poolmgr.h"
 #include "pgxc/nodemgr.h"
 #include "pgxc/pgxcnode.h"
+#include "pgxc/redistrib.h"
 #include "pgxc/xc_maintenance_mode.h"
 #endif
 #if defined(ADBMGRD)
 #include "postmaster/adbmonitor.h"
 #endif /* ADBMGRD */
+#ifdef ADB
+#include "access/remote_xact.h"
+#include "access/xlogprefetch.h"
+#include "agtm/agtm.h"
+#include "agtm/agtm_broker.h"
+#include "agtm/agtm_xidcache.h"
+#include "pgxc/globaldeadlock.h"
+#include "storage/sinvaladt.h"
+#include "utils/catcache.h"
+#include "utils/relcache.h"
+#include "utils/sharedcatcache.h"
+#include "utils/sharedplancache.h"
+#include "utils/waitevent.h"
+#endif /* ADB */
 #include "postmaster/autovacuum.h"
 #include "postmaster/bgworker.h"
 #include "postmaster/bgwriter.h"
@@ -83,6 +100,7 @@
 #include "storage/bufmgr.h"
 #include "storage/standby.h"
 #include "storage/fd.h"
+#include "storage/pg_shmem.h"
 #include "storage/proc.h"
 #include "storage/predicate.h"
 #include "tcop/tcopprot.h"
@@ -240,6 +258,12 @@ static bool check_string_valid(char **newval, void **extra, GucSource source);
  * NOTE! Option values may not contain double quotes!
  */
 
+static const struct config_enum_entry toast_compression_options[] = {
+	{"pglz", TOAST_PGLZ_COMPRESSION_ID, false},
+	{"lz4", TOAST_LZ4_COMPRESSION_ID, false},
+	{NULL, 0, false}
+};
+
 static const struct config_enum_entry bytea_output_options[] = {
 	{"escape", BYTEA_OUTPUT_ESCAPE, false},
 	{"hex", BYTEA_OUTPUT_HEX, false},
@@ -424,12 +448,36 @@ static const struct config_enum_entry synchronous_commit_options[] = {
 	{NULL, 0, false}
 };
 
+/*
+ * Although only "on", "off", and "try" are documented, we accept all the
+ * likely variants of "on" and "off".
+ */
+static const struct config_enum_entry huge_pages_options[] = {
+	{"off", HUGE_PAGES_OFF, false},
+	{"on", HUGE_PAGES_ON, false},
+	{"try", HUGE_PAGES_TRY, false},
+	{"true", HUGE_PAGES_ON, true},
+	{"false", HUGE_PAGES_OFF, true},
+	{"yes", HUGE_PAGES_ON, true},
+	{"no", HUGE_PAGES_OFF, true},
+	{"1", HUGE_PAGES_ON, true},
+	{"0", HUGE_PAGES_OFF, true},
+	{NULL, 0, false}
+};
+
 #ifdef ADB
 static const struct config_enum_entry parse_grammer_options[] = {
 	{"postgres", PARSE_GRAM_POSTGRES, false},
 	{"oracle", PARSE_GRAM_ORACLE, false},
 	{NULL, 0, false}
 };
+
+static const struct config_enum_entry replicated_read_routing_options[] = {
+	{"preferred", REPLICATED_READ_PREFERRED, false},
+	{"round_robin", REPLICATED_READ_ROUND_ROBIN, false},
+	{"least_loaded", REPLICATED_READ_LEAST_LOADED, false},
+	{NULL, 0, false}
+};
 #endif /* ADB */
 
 #ifdef ADBMGRD
@@ -452,6 +500,8 @@ extern const struct config_enum_entry sync_method_options[];
 /*
  * GUC option variables that are exported from this module
  */
+int			huge_pages;
+
 #ifdef USE_ASSERT_CHECKING
 bool		assert_enabled = true;
 #else
@@ -528,6 +578,9 @@ bool		ADB_DEBUG;
 
 #ifdef AGTM
 extern int agtm_listen_port;
+extern bool enable_agtm_snapshot_cache;
+extern int agtm_sequence_cache_size;
+extern int agtm_sequence_prealloc;
 #endif /* AGTM */
 
 /*
@@ -908,6 +961,17 @@ static struct config_bool ConfigureNamesBool[] =
 		true,
 		NULL, NULL, NULL
 	},
+#ifdef ADB
+	{
+		{"enable_datanode_motion", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables the planner's use of remote join plans moving rows between datanodes."),
+			NULL
+		},
+		&enable_datanode_motion,
+		false,
+		NULL, NULL, NULL
+	},
+#endif
 #if 0
 	{
 		{"gtm_backup_barrier", PGC_SUSET, QUERY_TUNING_METHOD,
@@ -1031,6 +1095,17 @@ static struct config_bool ConfigureNamesBool[] =
 		true,
 		NULL, NULL, NULL
 	},
+#ifdef ADB
+	{
+		{"wal_compression", PGC_SUSET, WAL_SETTINGS,
+			gettext_noop("Compresses full-page writes written in WAL file."),
+			NULL
+		},
+		&wal_compression,
+		false,
+		NULL, NULL, NULL
+	},
+#endif
 	{
 		{"log_checkpoints", PGC_SIGHUP, LOGGING_WHAT,
 			gettext_noop("Logs each checkpoint."),
@@ -1224,6 +1299,17 @@ static struct config_bool ConfigureNamesBool[] =
 		false,
 		NULL, NULL, NULL
 	},
+#ifdef ADB
+	{
+		{"track_wait_timing", PGC_SUSET, STATS_COLLECTOR,
+			gettext_noop("Collects timing statistics for wait events."),
+			NULL
+		},
+		&track_wait_timing,
+		false,
+		NULL, NULL, NULL
+	},
+#endif
 
 	{
 		{"update_process_title", PGC_SUSET, STATS_COLLECTOR,
@@ -1612,6 +1698,17 @@ static struct config_bool ConfigureNamesBool[] =
 		false,
 		NULL, NULL, NULL
 	},
+#ifdef ADB
+	{
+		{"wal_receiver_compression", PGC_SIGHUP, REPLICATION_STANDBY,
+			gettext_noop("Asks the primary to send the WAL stream compressed."),
+			NULL
+		},
+		&wal_receiver_compression,
+		false,
+		NULL, NULL, NULL
+	},
+#endif
 
 	{
 		{"allow_system_table_mods", PGC_POSTMASTER, DEVELOPER_OPTIONS,
@@ -1646,6 +1743,38 @@ static struct config_bool ConfigureNamesBool[] =
 		false,
 		NULL, NULL, NULL
 	},
+	{
+		{"pool_transaction_mode", PGC_POSTMASTER, DATA_NODES,
+			gettext_noop("Lets other sessions use the connections a session released."),
+			gettext_noop("Connections released at the end of a transaction can be "
+						 "taken by other sessions, unless temporary objects are used.")
+		},
+		&PoolTransactionMode,
+		false,
+		NULL, NULL, NULL
+	},
+#ifdef ADB
+	{
+		{"pool_lazy_connect", PGC_BACKEND, DATA_NODES,
+			gettext_noop("Attaches a session to the pool manager only when it first needs it."),
+			gettext_noop("Sessions which only run local queries then cost the pool "
+						 "manager nothing.")
+		},
+		&PoolLazyConnect,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_datanode_slave_read", PGC_USERSET, DATA_NODES,
+			gettext_noop("Lets read-only transactions read from hot standby slaves of the Datanodes."),
+			gettext_noop("A slave is used only if it is defined in pgxc_node and its "
+						 "replay lag is known and at most datanode_slave_max_lag.")
+		},
+		&EnableDatanodeSlaveRead,
+		false,
+		NULL, NULL, NULL
+	},
+#endif
 	{
 		{"enforce_two_phase_commit", PGC_SUSET, XC_HOUSEKEEPING_OPTIONS,
 			gettext_noop("Enforce the use of two-phase commit on transactions that"
@@ -1656,6 +1785,47 @@ static struct config_bool ConfigureNamesBool[] =
 		true,
 		NULL, NULL, NULL
 	},
+#ifdef ADB
+	{
+		{"enable_one_phase_commit", PGC_USERSET, XC_HOUSEKEEPING_OPTIONS,
+			gettext_noop("Commits in one phase the transactions writing on a single remote node."),
+			NULL
+		},
+		&EnableOnePhaseCommit,
+		true,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_remote_compression", PGC_BACKEND, XC_HOUSEKEEPING_OPTIONS,
+			gettext_noop("Compresses the rows sent between Datanodes and Coordinators."),
+			gettext_noop("Set on a Coordinator, its pooler asks the nodes it connects to "
+						 "to compress the rows they send back.")
+		},
+		&enable_remote_compression,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_async_commit_prepared", PGC_USERSET, XC_HOUSEKEEPING_OPTIONS,
+			gettext_noop("Lets the remote xact manager commit the prepared transactions on the remote nodes."),
+			gettext_noop("The commit returns once the commit decision is logged, the changes "
+						 "become visible when all the nodes committed.")
+		},
+		&EnableAsyncCommitPrepared,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_global_deadlock_check", PGC_SUSET, LOCK_MANAGEMENT,
+			gettext_noop("Looks for deadlocks across the datanodes while waiting for them."),
+			gettext_noop("A coordinator waiting deadlock_timeout for the datanodes "
+						 "collects their lock waits and cancels a transaction of each cycle.")
+		},
+		&enable_global_deadlock_check,
+		true,
+		NULL, NULL, NULL
+	},
+#endif
 	{
 		{"xc_maintenance_mode", PGC_SUSET, XC_HOUSEKEEPING_OPTIONS,
 		    gettext_noop("Turn on XC maintenance mode."),
@@ -1730,6 +1900,36 @@ static struct config_bool ConfigureNamesBool[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"enable_agtm_snapshot_broker", PGC_SIGHUP, GTM,
+			gettext_noop("Share one AGTM snapshot request among concurrent backends."),
+			gettext_noop("Only used by the coordinator which receives the query.")
+		},
+		&enable_agtm_snapshot_broker,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"enable_agtm_snapshot_compact", PGC_SIGHUP, GTM,
+			gettext_noop("Get AGTM snapshots in the compact, differential encoding."),
+			gettext_noop("AGTM must support the AGTM_MSG_SNAPSHOT_GET_COMPACT message.")
+		},
+		&enable_agtm_snapshot_compact,
+		false,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"enable_agtm_snapshot_prefetch", PGC_USERSET, GTM,
+			gettext_noop("Ask AGTM for the snapshot of a query before parsing it."),
+			gettext_noop("Only used by the coordinator which receives the query.")
+		},
+		&enable_agtm_snapshot_prefetch,
+		false,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"enable_stable_func_shipping", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enables stable function shipping to ship query directly to datanode."),
@@ -1789,6 +1989,24 @@ static struct config_bool ConfigureNamesBool[] =
 		false,
 		NULL, NULL, NULL
 	},
+	{
+		{"online_bucket_redistribution", PGC_USERSET, CUSTOM_OPTIONS,
+			gettext_noop("Only move the buckets of removed nodes when changing the nodes of a bucket table."),
+			gettext_noop("The other buckets are moved later by pgxc_redistribute_buckets().")
+		},
+		&online_bucket_redistribution,
+		false,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_direct_redistribution", PGC_USERSET, CUSTOM_OPTIONS,
+			gettext_noop("Moves the buckets of redistributed tables directly between Datanodes."),
+			gettext_noop("Datanodes must accept connections from each other.")
+		},
+		&enable_direct_redistribution,
+		false,
+		NULL, NULL, NULL
+	},
 	{
 		{"rep_max_avail_flag", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enable replication max avail available level"),
@@ -1819,6 +2037,17 @@ static struct config_bool ConfigureNamesBool[] =
 		false,
 		NULL, NULL, NULL
 	},
+
+	{
+		{"copy_check_all_columns", PGC_USERSET, CUSTOM_OPTIONS,
+			gettext_noop("Converts on the Coordinator all the columns given to COPY FROM."),
+			gettext_noop("When off, the Coordinator only converts the distribution columns "
+						 "and the Datanodes check the others.")
+		},
+		&copy_check_all_columns,
+		true,
+		NULL, NULL, NULL
+	},
 #endif
 
 #ifdef DEBUG_ADB
@@ -1834,6 +2063,18 @@ static struct config_bool ConfigureNamesBool[] =
 	},
 #endif
 
+#ifdef AGTM
+	{
+		{"enable_agtm_snapshot_cache", PGC_SIGHUP, RESOURCES,
+			gettext_noop("Reuse the last global snapshot until a transaction finishes."),
+			NULL
+		},
+		&enable_agtm_snapshot_cache,
+		true,
+		NULL, NULL, NULL
+	},
+#endif /* AGTM */
+
 	/* End-of-list marker */
 	{
 		{NULL, 0, 0, NULL, NULL}, NULL, false, NULL, NULL, NULL
@@ -1898,6 +2139,17 @@ static struct config_int ConfigureNamesInt[] =
 		8, 1, INT_MAX,
 		NULL, NULL, NULL
 	},
+#ifdef ADB
+	{
+		{"fqs_cache_size", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets the number of shapes of queries remembered as shippable to the Datanodes."),
+			gettext_noop("Zero disables the cache.")
+		},
+		&fqs_cache_size,
+		1024, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+#endif
 	{
 		{"geqo_threshold", PGC_USERSET, QUERY_TUNING_GEQO,
 			gettext_noop("Sets the threshold of FROM items beyond which GEQO is used."),
@@ -1991,6 +2243,19 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+#ifdef ADB
+	{
+		{"recovery_prefetch_distance", PGC_SIGHUP, REPLICATION_STANDBY,
+			gettext_noop("Sets how far ahead of replay the data blocks of WAL records are prefetched."),
+			gettext_noop("Zero disables prefetching."),
+			GUC_UNIT_KB
+		},
+		&recovery_prefetch_distance,
+		128, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+#endif
+
 	{
 		{"max_connections", PGC_POSTMASTER, CONN_AUTH_SETTINGS,
 			gettext_noop("Sets the maximum number of concurrent connections."),
@@ -2037,6 +2302,16 @@ static struct config_int ConfigureNamesInt[] =
 		check_temp_buffers, NULL, NULL
 	},
 
+	{
+		{"clog_buffers", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the number of shared memory buffers used for the commit log."),
+			gettext_noop("Zero sizes them by shared_buffers.")
+		},
+		&clog_buffers,
+		0, 0, 16384,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"port", PGC_POSTMASTER, CONN_AUTH_SETTINGS,
 			gettext_noop("Sets the TCP port the server listens on."),
@@ -2205,6 +2480,29 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+#ifdef ADB
+	{
+		{"autovacuum_cluster_cost_limit", PGC_SIGHUP, AUTOVACUUM,
+			gettext_noop("Vacuum cost amount available before napping, for autovacuum on all the Datanodes together."),
+			gettext_noop("-1 means use autovacuum_vacuum_cost_limit on each node.")
+		},
+		&autovacuum_cluster_cost_limit,
+		-1, -1, 1000000,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"autovacuum_stagger_interval", PGC_SIGHUP, AUTOVACUUM,
+			gettext_noop("Time during which a table is left to a single Datanode by autovacuum."),
+			gettext_noop("0 lets every Datanode process any table at any time."),
+			GUC_UNIT_S
+		},
+		&autovacuum_stagger_interval,
+		0, 0, INT_MAX / 1000,
+		NULL, NULL, NULL
+	},
+#endif
+
 	{
 		{"max_files_per_process", PGC_POSTMASTER, RESOURCES_KERNEL,
 			gettext_noop("Sets the maximum number of simultaneously open files for each server process."),
@@ -2423,6 +2721,17 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"checkpoint_flush_after", PGC_SIGHUP, WAL_CHECKPOINTS,
+			gettext_noop("Number of pages after which previously performed writes are flushed to disk."),
+			NULL,
+			GUC_UNIT_BLOCKS
+		},
+		&checkpoint_flush_after,
+		DEFAULT_CHECKPOINT_FLUSH_AFTER, 0, WRITEBACK_MAX_PENDING_FLUSHES,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"wal_buffers", PGC_POSTMASTER, WAL_SETTINGS,
 			gettext_noop("Sets the number of disk-page buffers in shared memory for WAL."),
@@ -2589,6 +2898,17 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"log_ring_size", PGC_POSTMASTER, LOGGING_WHERE,
+			gettext_noop("Sets the size of the buffer each process puts its log messages in for the logging collector."),
+			gettext_noop("Zero sends the messages through the pipe, waiting for the logging collector if needed."),
+			GUC_UNIT_KB
+		},
+		&Log_ring_size,
+		0, 0, 65536,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"max_function_args", PGC_INTERNAL, PRESET_OPTIONS,
 			gettext_noop("Shows the maximum number of function arguments."),
@@ -2876,6 +3196,28 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+#ifdef ADB
+	{
+		{"stats_max_tables", PGC_POSTMASTER, STATS_COLLECTOR,
+			gettext_noop("Sets the maximum number of tables whose statistics are kept in shared memory."),
+			NULL
+		},
+		&pgstat_max_tables,
+		50000, 100, INT_MAX / 2,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"stats_max_functions", PGC_POSTMASTER, STATS_COLLECTOR,
+			gettext_noop("Sets the maximum number of functions whose statistics are kept in shared memory."),
+			NULL
+		},
+		&pgstat_max_functions,
+		5000, 100, INT_MAX / 2,
+		NULL, NULL, NULL
+	},
+#endif
+
 	{
         {"copy_batch_rows", PGC_USERSET, RESOURCES_MEM,
             gettext_noop("Set copy to table batch of max row"),
@@ -2919,6 +3261,66 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"remote_insert_batch_size", PGC_USERSET, DATA_NODES,
+			gettext_noop("Number of rows of an INSERT sent to Datanodes before waiting for the result."),
+			gettext_noop("Rows of an INSERT which can not be shipped as a whole are "
+						 "pipelined to the Datanodes, those of the Execute messages "
+						 "of a client until its Sync too. 1 waits for every row.")
+		},
+		&RemoteInsertBatchSize,
+		100, 1, 1000,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"remote_fetch_size", PGC_USERSET, DATA_NODES,
+			gettext_noop("Number of rows of a cursor asked to each Datanode at a time."),
+			gettext_noop("Rows of a forward only cursor are fetched by this many "
+						 "from each Datanode and not kept, zero fetches all of them.")
+		},
+		&RemoteFetchSize,
+		0, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"replicated_table_cache_size", PGC_USERSET, DATA_NODES,
+			gettext_noop("Sets the memory a session uses to keep rows of replicated tables."),
+			gettext_noop("Rows of a query reading only replicated tables are kept by "
+						 "the Coordinator and used again by the same query under the "
+						 "same snapshot, zero keeps none."),
+			GUC_UNIT_KB
+		},
+		&ReplicatedTableCacheSize,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"pool_min_idle", PGC_POSTMASTER, DATA_NODES,
+			gettext_noop("Minimum number of idle connections kept in each node pool."),
+			gettext_noop("The pool manager opens connections in background until every "
+						 "pool used once has this many idle ones, zero disables it.")
+		},
+		&PoolMinIdle,
+		0, 0, 65535,
+		NULL, NULL, NULL
+	},
+
+#ifdef ADB
+	{
+		{"datanode_slave_max_lag", PGC_USERSET, DATA_NODES,
+			gettext_noop("Maximum replay lag of a Datanode slave read-only transactions may read from."),
+			NULL,
+			GUC_UNIT_MS
+		},
+		&DatanodeSlaveMaxLag,
+		1000, 0, INT_MAX,
+		NULL, NULL, NULL
+	},
+#endif
+
 	{
 		{"agtm_port", PGC_SIGHUP, GTM,
 			gettext_noop("Port of GTM."),
@@ -2929,6 +3331,83 @@ static struct config_int ConfigureNamesInt[] =
 		check_agtm_port, NULL, NULL
 	},
 
+	{
+		{"agtm_xid_status_cache_size", PGC_POSTMASTER, GTM,
+			gettext_noop("Sets the number of transaction status slots cached from AGTM."),
+			gettext_noop("Zero disables the cache.")
+		},
+		&agtm_xid_status_cache_size,
+		4096, 0, INT_MAX / 64,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"shared_catcache_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the number of catalog tuples kept in shared memory for all backends."),
+			gettext_noop("Zero disables the shared catalog cache.")
+		},
+		&shared_catcache_size,
+		0, 0, INT_MAX / 2048,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"shared_plan_cache_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the number of prepared statements kept in shared memory for all sessions."),
+			gettext_noop("Zero disables the shared plan cache.")
+		},
+		&shared_plan_cache_size,
+		0, 0, INT_MAX / 32768,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"sinval_queue_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the number of cache invalidation messages kept in shared memory."),
+			gettext_noop("Rounded up to a power of 2 of at least 4096. "
+						 "Zero sizes it by max_connections.")
+		},
+		&sinval_queue_size,
+		0, 0, 1 << 24,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"catalog_cache_memory_limit", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the maximum memory used by the catalog caches of a session."),
+			gettext_noop("Least recently used entries are evicted beyond it. "
+						 "Zero disables the limit."),
+			GUC_UNIT_KB
+		},
+		&catalog_cache_memory_limit,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"relation_cache_memory_limit", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the maximum memory used by the relation cache of a session."),
+			gettext_noop("Least recently used entries are evicted beyond it "
+						 "at the end of each transaction. Zero disables the limit."),
+			GUC_UNIT_KB
+		},
+		&relation_cache_memory_limit,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"query_mem_limit", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the maximum memory a query may add to its backend."),
+			gettext_noop("The query is canceled with an error beyond it. "
+						 "Zero disables the limit."),
+			GUC_UNIT_KB
+		},
+		&query_mem_limit,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"max_datanodes", PGC_POSTMASTER, DATA_NODES,
 			gettext_noop("Maximum number of Datanodes in the cluster."),
@@ -2995,6 +3474,26 @@ static struct config_int ConfigureNamesInt[] =
 		0, 0, 65535,
 		NULL, NULL, NULL
 	},
+
+	{
+		{"agtm_sequence_cache_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the number of sequences whose reserved values are kept in shared memory."),
+			NULL
+		},
+		&agtm_sequence_cache_size,
+		1024, 16, INT_MAX / 2,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"agtm_sequence_prealloc", PGC_SIGHUP, RESOURCES_MEM,
+			gettext_noop("Sets the number of sequence values reserved at once and shared by all requests."),
+			gettext_noop("A crash loses the values not handed out yet. Zero disables the shared sequence cache.")
+		},
+		&agtm_sequence_prealloc,
+		1000, 0, 1000000,
+		NULL, NULL, NULL
+	},
 #endif /* AGTM */
 
 	/* End-of-list marker */
@@ -3056,6 +3555,38 @@ static struct config_real ConfigureNamesReal[] =
 		DEFAULT_CPU_OPERATOR_COST, 0, DBL_MAX,
 		NULL, NULL, NULL
 	},
+#ifdef ADB
+	{
+		{"remote_startup_cost", PGC_USERSET, QUERY_TUNING_COST,
+			gettext_noop("Sets the planner's estimate of the fixed cost of "
+						 "running a query on each Datanode it is sent to."),
+			NULL
+		},
+		&remote_startup_cost,
+		DEFAULT_REMOTE_STARTUP_COST, 0, DBL_MAX,
+		NULL, NULL, NULL
+	},
+	{
+		{"remote_tuple_cost", PGC_USERSET, QUERY_TUNING_COST,
+			gettext_noop("Sets the planner's estimate of the cost of "
+						 "sending each tuple (row) between nodes."),
+			NULL
+		},
+		&remote_tuple_cost,
+		DEFAULT_REMOTE_TUPLE_COST, 0, DBL_MAX,
+		NULL, NULL, NULL
+	},
+	{
+		{"remote_byte_cost", PGC_USERSET, QUERY_TUNING_COST,
+			gettext_noop("Sets the planner's estimate of the cost of "
+						 "sending each byte of a tuple between nodes."),
+			NULL
+		},
+		&remote_byte_cost,
+		DEFAULT_REMOTE_BYTE_COST, 0, DBL_MAX,
+		NULL, NULL, NULL
+	},
+#endif
 
 	{
 		{"cursor_tuple_fraction", PGC_USERSET, QUERY_TUNING_OTHER,
@@ -3744,6 +4275,18 @@ static struct config_string ConfigureNamesString[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"function_distribute_by", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Ships calls of the function to the Datanode of one of its arguments."),
+			gettext_noop("Set on a function, as an argument number and the relation "
+						 "whose distribution column that argument is a value of."),
+			GUC_LIST_INPUT | GUC_NOT_IN_SAMPLE
+		},
+		&function_distribute_by,
+		"",
+		check_function_distribute_by, NULL, NULL
+	},
+
 	{
 		{"adb_ha_param_delimiter", PGC_USERSET, CUSTOM_OPTIONS,
 			gettext_noop("Parameter delimiter for record ADB execute sql."),
@@ -3807,6 +4350,17 @@ static struct config_enum ConfigureNamesEnum[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"default_toast_compression", PGC_USERSET, CLIENT_CONN_STATEMENT,
+			gettext_noop("Sets the default compression method for compressible values."),
+			gettext_noop("Columns with a compression option of their own use "
+						 "that method instead.")
+		},
+		&default_toast_compression,
+		TOAST_PGLZ_COMPRESSION_ID, toast_compression_options,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"client_min_messages", PGC_USERSET, LOGGING_WHEN,
 			gettext_noop("Sets the message levels that are sent to the client."),
@@ -3917,6 +4471,16 @@ static struct config_enum ConfigureNamesEnum[] =
 		NULL, assign_session_replication_role, NULL
 	},
 
+	{
+		{"huge_pages", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Use of huge pages on Linux."),
+			NULL
+		},
+		&huge_pages,
+		HUGE_PAGES_TRY, huge_pages_options,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"synchronous_commit", PGC_USERSET, WAL_SETTINGS,
 			gettext_noop("Sets the current transaction's synchronization level."),
@@ -4015,6 +4579,16 @@ static struct config_enum ConfigureNamesEnum[] =
 		PARSE_GRAM_POSTGRES, parse_grammer_options,
 		NULL, NULL, NULL
 	},
+	{
+		{"replicated_read_routing", PGC_USERSET, QUERY_TUNING_OTHER,
+			gettext_noop("Sets how reads of replicated tables choose their Datanode."),
+			gettext_noop("preferred reads a preferred Datanode, round_robin each one "
+						 "in turn, least_loaded the one with the fewest sessions.")
+		},
+		&replicated_read_routing,
+		REPLICATED_READ_PREFERRED, replicated_read_routing_options,
+		NULL, NULL, NULL
+	},
 #endif /* ADB */
 #ifdef ADBMGRD
 	{
@@ -0,0 +1,261 @@
+/*-------------------------------------------------------------------------
+ *
+ * waitevent.c
+ *
+ *	  Reporting of what a backend is waiting for.
+ *
+ * A backend about to block calls pgstat_report_wait_start() and, once done,
+ * pgstat_report_wait_end().  The current event is kept in MyProc, where
+ * pg_stat_activity reads it without any lock, and each finished wait is
+ * counted in backend-local counters, timed too when track_wait_timing is
+ * set.  The local counters are added to a shared array when the backend
+ * reports its statistics, at most every WAIT_EVENT_FLUSH_INTERVAL, so a
+ * wait costs no shared memory access beyond the store into MyProc.
+ *
+ * A wait may start while another one is in progress, as when a backend
+ * sleeping on a heavyweight lock needs an LWLock after being woken; one
+ * such level is remembered and reported again when the inner wait ends.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/misc/waitevent.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/xact.h"
+#include "portability/instr_time.h"
+#include "storage/proc.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "utils/timestamp.h"
+#include "utils/waitevent.h"
+
+/* Minimum time between two flushes of the local counters, in msec */
+#define WAIT_EVENT_FLUSH_INTERVAL	500
+
+typedef struct WaitEventCounter
+{
+	uint64		calls;
+	uint64		time;			/* in microseconds */
+} WaitEventCounter;
+
+typedef struct WaitEventShared
+{
+	slock_t		mutex;			/* protects counters */
+	WaitEventCounter counters[NUM_WAIT_EVENTS];
+} WaitEventShared;
+
+static const struct
+{
+	const char *type;
+	const char *name;
+}	WaitEventNames[NUM_WAIT_EVENTS] =
+{
+	{NULL, NULL},				/* WAIT_EVENT_NONE */
+	{"LWLock", "lwlock"},
+	{"Lock", "lock"},
+	{"AGTM", "gxid"},
+	{"AGTM", "snapshot"},
+	{"AGTM", "timestamp"},
+	{"AGTM", "sequence"},
+	{"AGTM", "transaction"},
+	{"Pooler", "get_connections"},
+	{"RemoteXact", "rxact"},
+	{"RemoteIO", "receive"},
+	{"RemoteIO", "send"}
+};
+
+bool		track_wait_timing = false;
+
+static WaitEventShared *WaitEventCounts = NULL;
+
+static WaitEventCounter LocalCounters[NUM_WAIT_EVENTS];
+static bool have_local_counts = false;
+static TimestampTz last_flush = 0;
+
+static WaitEvent curWaitEvent = WAIT_EVENT_NONE;
+static instr_time curWaitStart;
+static WaitEvent outerWaitEvent = WAIT_EVENT_NONE;
+static instr_time outerWaitStart;
+
+/* Report shared memory space needed by WaitEventShmemInit */
+Size
+WaitEventShmemSize(void)
+{
+	return sizeof(WaitEventShared);
+}
+
+/* Allocate and initialize wait event shared memory */
+void
+WaitEventShmemInit(void)
+{
+	bool		found;
+
+	WaitEventCounts = (WaitEventShared *)
+		ShmemInitStruct("Wait Event Counts", WaitEventShmemSize(), &found);
+
+	if (!found)
+	{
+		/* First time through, so initialize */
+		MemSet(WaitEventCounts, 0, WaitEventShmemSize());
+		SpinLockInit(&WaitEventCounts->mutex);
+	}
+}
+
+/*
+ * pgstat_report_wait_start
+ *
+ * Called right before the backend blocks waiting for "event".
+ */
+void
+pgstat_report_wait_start(WaitEvent event)
+{
+	volatile PGPROC *proc = MyProc;
+
+	if (curWaitEvent != WAIT_EVENT_NONE && outerWaitEvent == WAIT_EVENT_NONE)
+	{
+		outerWaitEvent = curWaitEvent;
+		outerWaitStart = curWaitStart;
+	}
+
+	curWaitEvent = event;
+	if (track_wait_timing)
+		INSTR_TIME_SET_CURRENT(curWaitStart);
+	else
+		INSTR_TIME_SET_ZERO(curWaitStart);
+
+	if (proc != NULL)
+		proc->waitEvent = (uint8) event;
+}
+
+/*
+ * pgstat_report_wait_end
+ *
+ * Called once the wait started by pgstat_report_wait_start is over.
+ */
+void
+pgstat_report_wait_end(void)
+{
+	volatile PGPROC *proc = MyProc;
+	WaitEventCounter *counter;
+
+	if (curWaitEvent == WAIT_EVENT_NONE)
+		return;
+
+	counter = &LocalCounters[curWaitEvent];
+	counter->calls++;
+	if (!INSTR_TIME_IS_ZERO(curWaitStart))
+	{
+		instr_time	duration;
+
+		INSTR_TIME_SET_CURRENT(duration);
+		INSTR_TIME_SUBTRACT(duration, curWaitStart);
+		counter->time += INSTR_TIME_GET_MICROSEC(duration);
+	}
+	have_local_counts = true;
+
+	curWaitEvent = outerWaitEvent;
+	curWaitStart = outerWaitStart;
+	outerWaitEvent = WAIT_EVENT_NONE;
+
+	if (proc != NULL)
+		proc->waitEvent = (uint8) curWaitEvent;
+}
+
+/*
+ * pgstat_clear_wait_event
+ *
+ * End whatever wait an error interrupted.  Called at transaction abort.
+ */
+void
+pgstat_clear_wait_event(void)
+{
+	while (curWaitEvent != WAIT_EVENT_NONE)
+		pgstat_report_wait_end();
+}
+
+/* Type of a wait event as shown to users, NULL for WAIT_EVENT_NONE */
+const char *
+GetWaitEventType(WaitEvent event)
+{
+	if (event <= WAIT_EVENT_NONE || event >= NUM_WAIT_EVENTS)
+		return NULL;
+	return WaitEventNames[event].type;
+}
+
+/* Name of a wait event as shown to users, NULL for WAIT_EVENT_NONE */
+const char *
+GetWaitEventName(WaitEvent event)
+{
+	if (event <= WAIT_EVENT_NONE || event >= NUM_WAIT_EVENTS)
+		return NULL;
+	return WaitEventNames[event].name;
+}
+
+/*
+ * WaitEventFlushCounts
+ *
+ * Add the local counters to the shared ones, unless that was done less
+ * than WAIT_EVENT_FLUSH_INTERVAL ago and "force" is false.  Called from
+ * pgstat_report_stat.
+ */
+void
+WaitEventFlushCounts(bool force)
+{
+	volatile WaitEventShared *shared = WaitEventCounts;
+	TimestampTz now;
+	int			i;
+
+	if (!have_local_counts || shared == NULL)
+		return;
+
+	now = GetCurrentTransactionStopTimestamp();
+	if (!force &&
+		!TimestampDifferenceExceeds(last_flush, now, WAIT_EVENT_FLUSH_INTERVAL))
+		return;
+	last_flush = now;
+
+	SpinLockAcquire(&shared->mutex);
+	for (i = 0; i < NUM_WAIT_EVENTS; i++)
+	{
+		shared->counters[i].calls += LocalCounters[i].calls;
+		shared->counters[i].time += LocalCounters[i].time;
+	}
+	SpinLockRelease(&shared->mutex);
+
+	MemSet(LocalCounters, 0, sizeof(LocalCounters));
+	have_local_counts = false;
+}
+
+/* Zero the shared counters, for pg_stat_reset_shared('wait_events') */
+void
+WaitEventResetCounts(void)
+{
+	volatile WaitEventShared *shared = WaitEventCounts;
+	int			i;
+
+	SpinLockAcquire(&shared->mutex);
+	for (i = 0; i < NUM_WAIT_EVENTS; i++)
+	{
+		shared->counters[i].calls = 0;
+		shared->counters[i].time = 0;
+	}
+	SpinLockRelease(&shared->mutex);
+}
+
+/* Fetch the shared counters of "event"; "time" is in microseconds */
+void
+WaitEventGetCounts(WaitEvent event, uint64 *calls, uint64 *time)
+{
+	volatile WaitEventShared *shared = WaitEventCounts;
+
+	Assert(event > WAIT_EVENT_NONE && event < NUM_WAIT_EVENTS);
+
+	SpinLockAcquire(&shared->mutex);
+	*calls = shared->counters[event].calls;
+	*time = shared->counters[event].time;
+	SpinLockRelease(&shared->mutex);
+}
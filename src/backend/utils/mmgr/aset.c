@@ -429,9 +429,11 @@ AllocSetContextCreate(MemoryContext parent,
 		Size		blksize = MAXALIGN(minContextSize);
 		AllocBlock	block;
 
+		MemoryContextAccountAlloc((MemoryContext) context, blksize);
 		block = (AllocBlock) malloc(blksize);
 		if (block == NULL)
 		{
+			MemoryContextAccountFree((MemoryContext) context, blksize);
 			MemoryContextStats(TopMemoryContext);
 			ereport(ERROR,
 					(errcode(ERRCODE_OUT_OF_MEMORY),
@@ -523,6 +525,7 @@ AllocSetReset(MemoryContext context)
 		else
 		{
 			/* Normal case, release the block */
+			MemoryContextAccountFree(context, block->endptr - ((char *) block));
 #ifdef CLOBBER_FREED_MEMORY
 			/* Wipe freed memory for debugging purposes */
 			memset(block, 0x7F, block->freeptr - ((char *) block));
@@ -566,6 +569,7 @@ AllocSetDelete(MemoryContext context)
 	{
 		AllocBlock	next = block->next;
 
+		MemoryContextAccountFree(context, block->endptr - ((char *) block));
 #ifdef CLOBBER_FREED_MEMORY
 		/* Wipe freed memory for debugging purposes */
 		memset(block, 0x7F, block->freeptr - ((char *) block));
@@ -600,9 +604,11 @@ AllocSetAlloc(MemoryContext context, Size size)
 	{
 		chunk_size = MAXALIGN(size);
 		blksize = chunk_size + ALLOC_BLOCKHDRSZ + ALLOC_CHUNKHDRSZ;
+		MemoryContextAccountAlloc(context, blksize);
 		block = (AllocBlock) malloc(blksize);
 		if (block == NULL)
 		{
+			MemoryContextAccountFree(context, blksize);
 			MemoryContextStats(TopMemoryContext);
 			ereport(ERROR,
 					(errcode(ERRCODE_OUT_OF_MEMORY),
@@ -765,6 +771,7 @@ AllocSetAlloc(MemoryContext context, Size size)
 			blksize <<= 1;
 
 		/* Try to allocate it */
+		MemoryContextAccountAlloc(context, blksize);
 		block = (AllocBlock) malloc(blksize);
 
 		/*
@@ -773,6 +780,7 @@ AllocSetAlloc(MemoryContext context, Size size)
 		 */
 		while (block == NULL && blksize > 1024 * 1024)
 		{
+			MemoryContextAccountFree(context, blksize - (blksize >> 1));
 			blksize >>= 1;
 			if (blksize < required_size)
 				break;
@@ -781,6 +789,7 @@ AllocSetAlloc(MemoryContext context, Size size)
 
 		if (block == NULL)
 		{
+			MemoryContextAccountFree(context, blksize);
 			MemoryContextStats(TopMemoryContext);
 			ereport(ERROR,
 					(errcode(ERRCODE_OUT_OF_MEMORY),
@@ -881,6 +890,7 @@ AllocSetFree(MemoryContext context, void *pointer)
 			set->blocks = block->next;
 		else
 			prevblock->next = block->next;
+		MemoryContextAccountFree(context, block->endptr - ((char *) block));
 #ifdef CLOBBER_FREED_MEMORY
 		/* Wipe freed memory for debugging purposes */
 		memset(block, 0x7F, block->freeptr - ((char *) block));
@@ -962,6 +972,7 @@ AllocSetRealloc(MemoryContext context, void *pointer, Size size)
 		AllocBlock	prevblock = NULL;
 		Size		chksize;
 		Size		blksize;
+		Size		oldblksize;
 
 		while (block != NULL)
 		{
@@ -979,9 +990,12 @@ AllocSetRealloc(MemoryContext context, void *pointer, Size size)
 		/* Do the realloc */
 		chksize = MAXALIGN(size);
 		blksize = chksize + ALLOC_BLOCKHDRSZ + ALLOC_CHUNKHDRSZ;
+		oldblksize = block->endptr - ((char *) block);
+		MemoryContextAccountAlloc(context, blksize - oldblksize);
 		block = (AllocBlock) realloc(block, blksize);
 		if (block == NULL)
 		{
+			MemoryContextAccountFree(context, blksize - oldblksize);
 			MemoryContextStats(TopMemoryContext);
 			ereport(ERROR,
 					(errcode(ERRCODE_OUT_OF_MEMORY),
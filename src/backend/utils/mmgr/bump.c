@@ -0,0 +1,530 @@
+/*-------------------------------------------------------------------------
+ *
+ * bump.c
+ *	  Allocator for short-lived memory that is released all at once.
+ *
+ * A BumpContext hands out memory by advancing a pointer through its current
+ * block.  pfree() gives nothing back; the space of freed chunks is only
+ * reclaimed when the whole context is reset.  That makes palloc() a few
+ * instructions, and resetting a context costs nothing more than rewinding
+ * its first block, which is kept across resets like aset.c's keeper block,
+ * plus giving back any further blocks.  This fits the executor's per-tuple
+ * contexts: they are reset for every row and whatever is allocated in them
+ * during a tuple cycle is rarely freed piecemeal.
+ *
+ * Every chunk still carries a StandardChunkHeader, since pfree(), repalloc()
+ * and GetMemoryChunkSpace() need to find the owning context; but there is no
+ * rounding of requests to a power of 2 and no freelist.  A repalloc() of the
+ * chunk allocated last grows it in place when its block has room, which is
+ * the usual pattern of a StringInfo being built up.
+ *
+ * Contexts that see many pfree()s of chunks allocated long before the next
+ * reset should keep using aset.c.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/mmgr/bump.c
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "postgres.h"
+
+#include "utils/memutils.h"
+
+/*
+ * Requests bigger than a quarter of the maximum block size get a block of
+ * their own, so that a large chunk doesn't leave most of a block unused.
+ */
+#define BUMP_CHUNK_FRACTION	4
+
+#define BUMP_BLOCKHDRSZ		MAXALIGN(sizeof(BumpBlockData))
+#define BUMP_CHUNKHDRSZ		STANDARDCHUNKHEADERSIZE
+
+typedef struct BumpBlockData *BumpBlock;	/* forward reference */
+typedef StandardChunkHeader *BumpChunk;
+
+/*
+ * BumpContext: the blocks list starts with the block we allocate from.
+ * Blocks holding a single large chunk are linked after it.
+ */
+typedef struct BumpContext
+{
+	MemoryContextData header;	/* Standard memory-context fields */
+	/* Info about storage allocated in this context: */
+	BumpBlock	blocks;			/* head of list of blocks in this context */
+	/* Allocation parameters for this context: */
+	Size		initBlockSize;	/* initial block size */
+	Size		maxBlockSize;	/* maximum block size */
+	Size		nextBlockSize;	/* next block size to allocate */
+	Size		allocChunkLimit;	/* larger chunks get their own block */
+	BumpBlock	keeper;			/* if not NULL, keep this block over resets */
+} BumpContext;
+
+typedef BumpContext *Bump;
+
+/*
+ * BumpBlock
+ *		The unit of memory obtained from malloc().  Chunks are carved out of
+ *		it one after the other, starting at the next alignment boundary.
+ */
+typedef struct BumpBlockData
+{
+	BumpBlock	next;			/* next block in context's blocks list */
+	char	   *freeptr;		/* start of free space in this block */
+	char	   *endptr;			/* end of space in this block */
+}	BumpBlockData;
+
+#define BumpPointerGetChunk(ptr)	\
+					((BumpChunk)(((char *)(ptr)) - BUMP_CHUNKHDRSZ))
+#define BumpChunkGetPointer(chk)	\
+					((void *)(((char *)(chk)) + BUMP_CHUNKHDRSZ))
+
+/*
+ * These functions implement the MemoryContext API for Bump contexts.
+ */
+static void *BumpAlloc(MemoryContext context, Size size);
+static void BumpFree(MemoryContext context, void *pointer);
+static void *BumpRealloc(MemoryContext context, void *pointer, Size size);
+static void BumpInit(MemoryContext context);
+static void BumpReset(MemoryContext context);
+static void BumpDelete(MemoryContext context);
+static Size BumpGetChunkSpace(MemoryContext context, void *pointer);
+static bool BumpIsEmpty(MemoryContext context);
+static void BumpStats(MemoryContext context, int level);
+
+#ifdef MEMORY_CONTEXT_CHECKING
+static void BumpCheck(MemoryContext context);
+#endif
+
+/*
+ * This is the virtual function table for Bump contexts.
+ */
+static MemoryContextMethods BumpMethods = {
+	BumpAlloc,
+	BumpFree,
+	BumpRealloc,
+	BumpInit,
+	BumpReset,
+	BumpDelete,
+	BumpGetChunkSpace,
+	BumpIsEmpty,
+	BumpStats
+#ifdef MEMORY_CONTEXT_CHECKING
+	,BumpCheck
+#endif
+};
+
+
+/*
+ * Public routines
+ */
+
+
+/*
+ * BumpContextCreate
+ *		Create a new Bump context.
+ *
+ * parent: parent context, or NULL if top-level context
+ * name: name of context (for debugging --- string will be copied)
+ * initBlockSize: initial allocation block size
+ * maxBlockSize: maximum allocation block size
+ *
+ * The ALLOCSET_*_INITSIZE and ALLOCSET_*_MAXSIZE values are suitable here.
+ */
+MemoryContext
+BumpContextCreate(MemoryContext parent,
+				  const char *name,
+				  Size initBlockSize,
+				  Size maxBlockSize)
+{
+	Bump		context;
+
+	/* Do the type-independent part of context creation */
+	context = (Bump) MemoryContextCreate(T_BumpContext,
+										 sizeof(BumpContext),
+										 &BumpMethods,
+										 parent,
+										 name);
+
+	/* Same minimum block size as aset.c */
+	initBlockSize = MAXALIGN(initBlockSize);
+	if (initBlockSize < 1024)
+		initBlockSize = 1024;
+	maxBlockSize = MAXALIGN(maxBlockSize);
+	if (maxBlockSize < initBlockSize)
+		maxBlockSize = initBlockSize;
+	context->initBlockSize = initBlockSize;
+	context->maxBlockSize = maxBlockSize;
+	context->nextBlockSize = initBlockSize;
+	context->allocChunkLimit =
+		(maxBlockSize - BUMP_BLOCKHDRSZ) / BUMP_CHUNK_FRACTION - BUMP_CHUNKHDRSZ;
+
+	return (MemoryContext) context;
+}
+
+/*
+ * BumpInit
+ *		Context-type-specific initialization routine.
+ */
+static void
+BumpInit(MemoryContext context)
+{
+	/*
+	 * Since MemoryContextCreate already zeroed the context node, we don't
+	 * have to do anything here: it's already OK.
+	 */
+}
+
+/*
+ * BumpReset
+ *		Frees all memory which is allocated in the given context.
+ *
+ * The keeper block, the first one allocated since the context was created,
+ * is only rewound, so a context that fits its rows into one block never
+ * calls malloc() or free() again.
+ */
+static void
+BumpReset(MemoryContext context)
+{
+	Bump		set = (Bump) context;
+	BumpBlock	block;
+
+#ifdef MEMORY_CONTEXT_CHECKING
+	/* Check for corruption before freeing */
+	BumpCheck(context);
+#endif
+
+	block = set->blocks;
+	set->blocks = set->keeper;
+
+	while (block != NULL)
+	{
+		BumpBlock	next = block->next;
+
+		if (block == set->keeper)
+		{
+			char	   *datastart = ((char *) block) + BUMP_BLOCKHDRSZ;
+
+#ifdef CLOBBER_FREED_MEMORY
+			/* Wipe freed memory for debugging purposes */
+			memset(datastart, 0x7F, block->freeptr - datastart);
+#endif
+			block->freeptr = datastart;
+			block->next = NULL;
+		}
+		else
+		{
+			MemoryContextAccountFree(context, block->endptr - ((char *) block));
+#ifdef CLOBBER_FREED_MEMORY
+			/* Wipe freed memory for debugging purposes */
+			memset(block, 0x7F, block->freeptr - ((char *) block));
+#endif
+			free(block);
+		}
+		block = next;
+	}
+
+	/* Reset block size allocation sequence, too */
+	set->nextBlockSize = set->initBlockSize;
+}
+
+/*
+ * BumpDelete
+ *		Frees all memory which is allocated in the given context,
+ *		in preparation for deletion of the context.
+ */
+static void
+BumpDelete(MemoryContext context)
+{
+	Bump		set = (Bump) context;
+	BumpBlock	block = set->blocks;
+
+#ifdef MEMORY_CONTEXT_CHECKING
+	/* Check for corruption before freeing */
+	BumpCheck(context);
+#endif
+
+	/* Make it look empty, just in case... */
+	set->blocks = NULL;
+	set->keeper = NULL;
+
+	while (block != NULL)
+	{
+		BumpBlock	next = block->next;
+
+		MemoryContextAccountFree(context, block->endptr - ((char *) block));
+#ifdef CLOBBER_FREED_MEMORY
+		/* Wipe freed memory for debugging purposes */
+		memset(block, 0x7F, block->freeptr - ((char *) block));
+#endif
+		free(block);
+		block = next;
+	}
+}
+
+/*
+ * BumpAlloc
+ *		Returns pointer to allocated memory of given size; memory is added
+ *		to the context.
+ */
+static void *
+BumpAlloc(MemoryContext context, Size size)
+{
+	Bump		set = (Bump) context;
+	BumpBlock	block = set->blocks;
+	BumpChunk	chunk;
+	Size		chunk_size = MAXALIGN(size);
+	Size		blksize;
+
+	/* The common case: there is room in the current block */
+	if (block == NULL ||
+		(Size) (block->endptr - block->freeptr) < chunk_size + BUMP_CHUNKHDRSZ)
+	{
+		Size		required_size = chunk_size + BUMP_BLOCKHDRSZ + BUMP_CHUNKHDRSZ;
+
+		if (chunk_size > set->allocChunkLimit)
+			blksize = required_size;
+		else
+		{
+			blksize = set->nextBlockSize;
+			set->nextBlockSize <<= 1;
+			if (set->nextBlockSize > set->maxBlockSize)
+				set->nextBlockSize = set->maxBlockSize;
+
+			/* If the chunk is still too big, keep doubling the block */
+			while (blksize < required_size)
+				blksize <<= 1;
+		}
+
+		MemoryContextAccountAlloc(context, blksize);
+		block = (BumpBlock) malloc(blksize);
+		if (block == NULL)
+		{
+			MemoryContextAccountFree(context, blksize);
+			MemoryContextStats(TopMemoryContext);
+			ereport(ERROR,
+					(errcode(ERRCODE_OUT_OF_MEMORY),
+					 errmsg("out of memory"),
+					 errdetail("Failed on request of size %lu.",
+							   (unsigned long) size)));
+		}
+		block->freeptr = ((char *) block) + BUMP_BLOCKHDRSZ;
+		block->endptr = ((char *) block) + blksize;
+
+		if (chunk_size > set->allocChunkLimit && set->blocks != NULL)
+		{
+			/*
+			 * Stick the new block underneath the active allocation block, so
+			 * that we don't lose the use of the space remaining therein.
+			 */
+			block->next = set->blocks->next;
+			set->blocks->next = block;
+		}
+		else
+		{
+			block->next = set->blocks;
+			set->blocks = block;
+		}
+
+		/* the first regular block is kept over resets */
+		if (set->keeper == NULL && chunk_size <= set->allocChunkLimit)
+			set->keeper = block;
+	}
+
+	chunk = (BumpChunk) block->freeptr;
+	block->freeptr += chunk_size + BUMP_CHUNKHDRSZ;
+	Assert(block->freeptr <= block->endptr);
+
+	chunk->context = context;
+	chunk->size = chunk_size;
+#ifdef MEMORY_CONTEXT_CHECKING
+	chunk->requested_size = size;
+	/* set mark to catch clobber of "unused" space */
+	if (size < chunk_size)
+		((char *) BumpChunkGetPointer(chunk))[size] = 0x7E;
+#endif
+
+	return BumpChunkGetPointer(chunk);
+}
+
+/*
+ * BumpFree
+ *		Nothing to do; the space comes back when the context is reset.
+ */
+static void
+BumpFree(MemoryContext context, void *pointer)
+{
+#if defined(MEMORY_CONTEXT_CHECKING) || defined(CLOBBER_FREED_MEMORY)
+	BumpChunk	chunk = BumpPointerGetChunk(pointer);
+#endif
+
+#ifdef MEMORY_CONTEXT_CHECKING
+	/* Test for someone scribbling on unused space in chunk */
+	if (chunk->requested_size < chunk->size)
+		if (((char *) pointer)[chunk->requested_size] != 0x7E)
+			elog(WARNING, "detected write past chunk end in %s %p",
+				 context->name, chunk);
+	/* the chunk stays in its block; don't check its end mark anymore */
+	chunk->requested_size = chunk->size;
+#endif
+
+#ifdef CLOBBER_FREED_MEMORY
+	/* Wipe freed memory for debugging purposes */
+	memset(pointer, 0x7F, chunk->size);
+#endif
+}
+
+/*
+ * BumpRealloc
+ *		Returns new pointer to allocated memory of given size; this memory
+ *		is added to the context.  The chunk is extended in place if it ends
+ *		where the free space of the current block starts.
+ */
+static void *
+BumpRealloc(MemoryContext context, void *pointer, Size size)
+{
+	Bump		set = (Bump) context;
+	BumpChunk	chunk = BumpPointerGetChunk(pointer);
+	Size		oldsize = chunk->size;
+	BumpBlock	block = set->blocks;
+	void	   *newPointer;
+
+#ifdef MEMORY_CONTEXT_CHECKING
+	/* Test for someone scribbling on unused space in chunk */
+	if (chunk->requested_size < oldsize)
+		if (((char *) pointer)[chunk->requested_size] != 0x7E)
+			elog(WARNING, "detected write past chunk end in %s %p",
+				 set->header.name, chunk);
+#endif
+
+	if (oldsize < size && block != NULL &&
+		(char *) pointer + oldsize == block->freeptr &&
+		(Size) (block->endptr - (char *) pointer) >= MAXALIGN(size))
+	{
+		block->freeptr = (char *) pointer + MAXALIGN(size);
+		chunk->size = oldsize = MAXALIGN(size);
+	}
+
+	if (oldsize >= size)
+	{
+#ifdef MEMORY_CONTEXT_CHECKING
+		chunk->requested_size = size;
+		/* set mark to catch clobber of "unused" space */
+		if (size < oldsize)
+			((char *) pointer)[size] = 0x7E;
+#endif
+		return pointer;
+	}
+
+	newPointer = BumpAlloc(context, size);
+	memcpy(newPointer, pointer, oldsize);
+	BumpFree(context, pointer);
+
+	return newPointer;
+}
+
+/*
+ * BumpGetChunkSpace
+ *		Given a currently-allocated chunk, determine the total space
+ *		it occupies (including all memory-allocation overhead).
+ */
+static Size
+BumpGetChunkSpace(MemoryContext context, void *pointer)
+{
+	BumpChunk	chunk = BumpPointerGetChunk(pointer);
+
+	return chunk->size + BUMP_CHUNKHDRSZ;
+}
+
+/*
+ * BumpIsEmpty
+ *		Is a Bump context empty of any allocated space?
+ */
+static bool
+BumpIsEmpty(MemoryContext context)
+{
+	/* freed chunks are not tracked, so only a reset context is empty */
+	return context->isReset;
+}
+
+/*
+ * BumpStats
+ *		Displays stats about memory consumption of a Bump context.
+ */
+static void
+BumpStats(MemoryContext context, int level)
+{
+	Bump		set = (Bump) context;
+	long		nblocks = 0;
+	long		totalspace = 0;
+	long		freespace = 0;
+	BumpBlock	block;
+	int			i;
+
+	for (block = set->blocks; block != NULL; block = block->next)
+	{
+		nblocks++;
+		totalspace += block->endptr - ((char *) block);
+		freespace += block->endptr - block->freeptr;
+	}
+
+	for (i = 0; i < level; i++)
+		fprintf(stderr, "  ");
+
+	fprintf(stderr,
+			"%s: %lu total in %ld blocks; %lu free; %lu used\n",
+			set->header.name, totalspace, nblocks, freespace,
+			totalspace - freespace);
+}
+
+
+#ifdef MEMORY_CONTEXT_CHECKING
+
+/*
+ * BumpCheck
+ *		Walk through chunks and check consistency of memory.
+ *
+ * NOTE: report errors as WARNING, *not* ERROR or FATAL, as AllocSetCheck
+ * does.
+ */
+static void
+BumpCheck(MemoryContext context)
+{
+	Bump		set = (Bump) context;
+	char	   *name = set->header.name;
+	BumpBlock	block;
+
+	for (block = set->blocks; block != NULL; block = block->next)
+	{
+		char	   *bpoz = ((char *) block) + BUMP_BLOCKHDRSZ;
+
+		while (bpoz < block->freeptr)
+		{
+			BumpChunk	chunk = (BumpChunk) bpoz;
+			Size		chsize = chunk->size;
+			Size		dsize = chunk->requested_size;
+
+			if (chunk->context != context)
+				elog(WARNING, "problem in bump context %s: bogus context link in block %p, chunk %p",
+					 name, block, chunk);
+			if (dsize > chsize)
+				elog(WARNING, "problem in bump context %s: req size > alloc size for chunk %p in block %p",
+					 name, chunk, block);
+			if (dsize < chsize &&
+				((char *) BumpChunkGetPointer(chunk))[dsize] != 0x7E)
+				elog(WARNING, "problem in bump context %s: detected write past chunk end in block %p, chunk %p",
+					 name, block, chunk);
+
+			bpoz += BUMP_CHUNKHDRSZ + chsize;
+		}
+
+		if (bpoz != block->freeptr)
+			elog(WARNING, "problem in bump context %s: found inconsistent memory block %p",
+				 name, block);
+	}
+}
+
+#endif   /* MEMORY_CONTEXT_CHECKING */
@@ -25,6 +25,9 @@
 #include "postgres.h"
 
 #include "utils/memutils.h"
+#ifdef ADB
+#include "miscadmin.h"
+#endif
 
 
 /*****************************************************************************
@@ -52,6 +55,17 @@ MemoryContext CurTransactionContext = NULL;
 /* This is a transient link to the active portal's memory context: */
 MemoryContext PortalContext = NULL;
 
+#ifdef ADB
+/* Most kilobytes a query may add to the backend, 0 means no limit */
+int			query_mem_limit = 0;
+
+/* TopMemoryContext->mem_total when the current query began */
+static Size QueryMemBase = 0;
+static bool QueryMemLimitArmed = false;
+
+static void MemoryContextAddTotal(MemoryContext context, Size size, bool add);
+#endif
+
 static void MemoryContextStatsInternal(MemoryContext context, int level);
 #ifdef PGXC
 void *allocTopCxt(size_t s);
@@ -258,6 +272,11 @@ MemoryContextSetParent(MemoryContext context, MemoryContext new_parent)
 	{
 		MemoryContext parent = context->parent;
 
+#ifdef ADB
+		/* the old ancestors no longer hold the memory of this context */
+		MemoryContextAddTotal(parent, context->mem_total, false);
+#endif
+
 		if (context == parent->firstchild)
 			parent->firstchild = context->nextchild;
 		else
@@ -282,6 +301,9 @@ MemoryContextSetParent(MemoryContext context, MemoryContext new_parent)
 		context->parent = new_parent;
 		context->nextchild = new_parent->firstchild;
 		new_parent->firstchild = context;
+#ifdef ADB
+		MemoryContextAddTotal(new_parent, context->mem_total, true);
+#endif
 	}
 	else
 	{
@@ -468,6 +490,89 @@ MemoryContextContains(MemoryContext context, void *pointer)
 	return false;
 }
 
+#ifdef ADB
+/* Add or subtract "size" to the total of "context" and all its ancestors */
+static void
+MemoryContextAddTotal(MemoryContext context, Size size, bool add)
+{
+	for (; context != NULL; context = context->parent)
+	{
+		if (add)
+			context->mem_total += size;
+		else
+		{
+			Assert(context->mem_total >= size);
+			context->mem_total -= size;
+		}
+	}
+}
+
+/*
+ * MemoryContextAccountAlloc
+ *		Count a block of "size" bytes the context is about to malloc().
+ *
+ * The limit is not applied to ErrorContext, which must be able to report
+ * the error, nor inside critical sections, where an ERROR would PANIC.
+ * Once it is hit, it is not applied again until the next query, so that
+ * the error can be reported and the transaction aborted.
+ */
+void
+MemoryContextAccountAlloc(MemoryContext context, Size size)
+{
+	if (QueryMemLimitArmed && query_mem_limit > 0 &&
+		context != ErrorContext && CritSectionCount == 0 &&
+		TopMemoryContext->mem_total + size >
+		QueryMemBase + (Size) query_mem_limit * 1024)
+	{
+		QueryMemLimitArmed = false;
+		ereport(ERROR,
+				(errcode(ERRCODE_OUT_OF_MEMORY),
+				 errmsg("query memory limit exceeded"),
+				 errdetail("Failed on request of size %lu in memory context \"%s\".",
+						   (unsigned long) size, context->name),
+				 errhint("Consider increasing the configuration parameter \"query_mem_limit\".")));
+	}
+
+	context->mem_allocated += size;
+	MemoryContextAddTotal(context, size, true);
+}
+
+/*
+ * MemoryContextAccountFree
+ *		Count a block of "size" bytes the context gave back, or could not
+ *		get after all.
+ */
+void
+MemoryContextAccountFree(MemoryContext context, Size size)
+{
+	Assert(context->mem_allocated >= size);
+	context->mem_allocated -= size;
+	MemoryContextAddTotal(context, size, false);
+}
+
+/*
+ * MemoryContextQueryStart
+ *		Begin applying query_mem_limit to what the backend allocates from
+ *		now on.
+ */
+void
+MemoryContextQueryStart(void)
+{
+	QueryMemBase = TopMemoryContext->mem_total;
+	QueryMemLimitArmed = true;
+}
+
+/*
+ * MemoryContextQueryEnd
+ *		Stop applying query_mem_limit, at the end of a query or on error.
+ */
+void
+MemoryContextQueryEnd(void)
+{
+	QueryMemLimitArmed = false;
+}
+#endif
+
 /*--------------------
  * MemoryContextCreate
  *		Context-type-independent part of context creation.
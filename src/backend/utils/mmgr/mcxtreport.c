@@ -0,0 +1,266 @@
+/*-------------------------------------------------------------------------
+ *
+ * mcxtreport.c
+ *
+ *	  Reports of the heaviest memory contexts of a backend.
+ *
+ * The memory contexts of a backend live in its private memory, so another
+ * backend asking for them signals it with PROCSIG_MEMORY_CONTEXTS and waits
+ * for it to copy the heaviest ones in its slot of a shared array.  The
+ * report is made at the next CHECK_FOR_INTERRUPTS(), or right in the signal
+ * handler when the backend is waiting for its client or for a lock, as the
+ * contexts cannot be changing then.  Making a report allocates no memory.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/mmgr/mcxtreport.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "miscadmin.h"
+#include "storage/ipc.h"
+#include "storage/proc.h"
+#include "storage/procarray.h"
+#include "storage/procsignal.h"
+#include "storage/shmem.h"
+#include "storage/spin.h"
+#include "utils/mcxtreport.h"
+#include "utils/memutils.h"
+
+/* How long to wait for the report of another backend, in milliseconds */
+#define MEMORY_CONTEXT_REPORT_TIMEOUT	5000
+
+typedef struct MemoryContextReportSlot
+{
+	slock_t		mutex;			/* protects everything below */
+	uint32		requested;		/* advanced by every request */
+	uint32		reported;		/* value of requested the report answers */
+	int			nentries;
+	MemoryContextReportEntry entries[MEMORY_CONTEXT_REPORT_SIZE];
+} MemoryContextReportSlot;
+
+/* One slot per backend, indexed by BackendId - 1 */
+static MemoryContextReportSlot *MemoryContextReports = NULL;
+
+volatile bool MemoryContextReportPending = false;
+
+static void CollectMemoryContexts(MemoryContext context, int level,
+					  MemoryContextReportEntry *entries, int *nentries);
+
+/* Report shared memory space needed by MemoryContextReportShmemInit */
+Size
+MemoryContextReportShmemSize(void)
+{
+	return mul_size(sizeof(MemoryContextReportSlot), MaxBackends);
+}
+
+/* Allocate and initialize memory context report shared memory */
+void
+MemoryContextReportShmemInit(void)
+{
+	bool		found;
+	int			i;
+
+	MemoryContextReports = (MemoryContextReportSlot *)
+		ShmemInitStruct("Memory Context Reports",
+						MemoryContextReportShmemSize(), &found);
+
+	if (!found)
+	{
+		/* First time through, so initialize */
+		MemSet(MemoryContextReports, 0, MemoryContextReportShmemSize());
+		for (i = 0; i < MaxBackends; i++)
+			SpinLockInit(&MemoryContextReports[i].mutex);
+	}
+}
+
+/*
+ * HandleMemoryContextReportInterrupt
+ *
+ * Called by procsignal_sigusr1_handler when another backend asks for our
+ * memory contexts.
+ */
+void
+HandleMemoryContextReportInterrupt(void)
+{
+	/*
+	 * Note: this is called by a SIGNAL HANDLER. You must be very wary what
+	 * you do here.
+	 */
+
+	/* Don't joggle the elbow of proc_exit */
+	if (proc_exit_inprogress)
+		return;
+
+	if (ImmediateInterruptOK && InterruptHoldoffCount == 0 &&
+		CritSectionCount == 0)
+	{
+		bool		save_ImmediateInterruptOK = ImmediateInterruptOK;
+
+		/* We are waiting, nothing touches the memory contexts */
+		ImmediateInterruptOK = false;
+		HOLD_INTERRUPTS();
+		ProcessMemoryContextReport();
+		RESUME_INTERRUPTS();
+		ImmediateInterruptOK = save_ImmediateInterruptOK;
+	}
+	else
+	{
+		MemoryContextReportPending = true;
+		InterruptPending = true;
+	}
+}
+
+/*
+ * ProcessMemoryContextReport
+ *
+ * Copy the heaviest memory contexts of this backend to its report slot.
+ */
+void
+ProcessMemoryContextReport(void)
+{
+	MemoryContextReportEntry entries[MEMORY_CONTEXT_REPORT_SIZE];
+	volatile MemoryContextReportSlot *slot;
+	int			nentries = 0;
+
+	MemoryContextReportPending = false;
+
+	if (MemoryContextReports == NULL || MyBackendId == InvalidBackendId)
+		return;
+
+	CollectMemoryContexts(TopMemoryContext, 0, entries, &nentries);
+
+	slot = &MemoryContextReports[MyBackendId - 1];
+	SpinLockAcquire(&slot->mutex);
+	memcpy((char *) slot->entries, entries,
+		   nentries * sizeof(MemoryContextReportEntry));
+	slot->nentries = nentries;
+	slot->reported = slot->requested;
+	SpinLockRelease(&slot->mutex);
+}
+
+/*
+ * GetBackendMemoryContexts
+ *
+ * Fill "entries" with the heaviest memory contexts of the backend "pid",
+ * heaviest first counting their descendants, and return their number.
+ * Returns -1 with a WARNING if the backend cannot be asked or did not
+ * answer in time.
+ */
+int
+GetBackendMemoryContexts(int pid, MemoryContextReportEntry *entries)
+{
+	volatile MemoryContextReportSlot *slot;
+	PGPROC	   *proc;
+	BackendId	backendId;
+	uint32		request;
+	int			waited;
+
+	if (pid == MyProcPid)
+	{
+		int			nentries = 0;
+
+		CollectMemoryContexts(TopMemoryContext, 0, entries, &nentries);
+		return nentries;
+	}
+
+	proc = BackendPidGetProc(pid);
+	if (proc == NULL || proc->backendId == InvalidBackendId)
+	{
+		ereport(WARNING,
+				(errmsg("PID %d is not a PostgreSQL server process", pid)));
+		return -1;
+	}
+
+	if (!(superuser() || proc->roleId == GetUserId()))
+		ereport(ERROR,
+				(errcode(ERRCODE_INSUFFICIENT_PRIVILEGE),
+				 errmsg("must be superuser or have the same role to see the memory contexts of another backend")));
+
+	backendId = proc->backendId;
+	slot = &MemoryContextReports[backendId - 1];
+
+	SpinLockAcquire(&slot->mutex);
+	request = ++slot->requested;
+	SpinLockRelease(&slot->mutex);
+
+	if (SendProcSignal(pid, PROCSIG_MEMORY_CONTEXTS, backendId) < 0)
+	{
+		ereport(WARNING,
+				(errmsg("could not send signal to process %d: %m", pid)));
+		return -1;
+	}
+
+	for (waited = 0;; waited += 10)
+	{
+		int			nentries = -1;
+
+		CHECK_FOR_INTERRUPTS();
+
+		SpinLockAcquire(&slot->mutex);
+		/* a later request may have been answered already */
+		if ((int32) (slot->reported - request) >= 0)
+		{
+			nentries = slot->nentries;
+			memcpy(entries, (char *) slot->entries,
+				   nentries * sizeof(MemoryContextReportEntry));
+		}
+		SpinLockRelease(&slot->mutex);
+
+		if (nentries >= 0)
+			return nentries;
+
+		if (waited >= MEMORY_CONTEXT_REPORT_TIMEOUT)
+			break;
+		pg_usleep(10000L);
+	}
+
+	ereport(WARNING,
+			(errmsg("process %d did not report its memory contexts", pid)));
+	return -1;
+}
+
+/*
+ * Keep the MEMORY_CONTEXT_REPORT_SIZE contexts with the largest totals of
+ * the tree at "context" in "entries", sorted by descending total.
+ */
+static void
+CollectMemoryContexts(MemoryContext context, int level,
+					  MemoryContextReportEntry *entries, int *nentries)
+{
+	MemoryContext child;
+	int			i;
+
+	i = *nentries;
+	if (i < MEMORY_CONTEXT_REPORT_SIZE ||
+		context->mem_total > entries[i - 1].total_bytes)
+	{
+		if (i == MEMORY_CONTEXT_REPORT_SIZE)
+			i--;
+		else
+			(*nentries)++;
+
+		for (; i > 0 && entries[i - 1].total_bytes < context->mem_total; i--)
+			entries[i] = entries[i - 1];
+
+		strlcpy(entries[i].name, context->name, NAMEDATALEN);
+		if (context->parent)
+			strlcpy(entries[i].parent, context->parent->name, NAMEDATALEN);
+		else
+			entries[i].parent[0] = '\0';
+		entries[i].level = level;
+		entries[i].bytes = context->mem_allocated;
+		entries[i].total_bytes = context->mem_total;
+	}
+
+	/* no descendant has a larger total, none would make it to a full list */
+	if (*nentries == MEMORY_CONTEXT_REPORT_SIZE &&
+		context->mem_total <= entries[MEMORY_CONTEXT_REPORT_SIZE - 1].total_bytes)
+		return;
+
+	for (child = context->firstchild; child != NULL; child = child->nextchild)
+		CollectMemoryContexts(child, level + 1, entries, nentries);
+}
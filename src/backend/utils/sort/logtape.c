@@ -79,6 +79,7 @@
 
 #include "storage/buffile.h"
 #include "utils/logtape.h"
+#include "utils/memutils.h"
 
 /*
  * Block indexes are "long"s, so we can fit this many per indirect block.
@@ -129,8 +130,15 @@ typedef struct LogicalTape
 	 * hasn't been assigned yet, and during read we don't care anymore). But
 	 * we do need the relative block number so we can detect end-of-tape while
 	 * reading.
+	 *
+	 * While an unfrozen tape is read, the buffer may hold several consecutive
+	 * data blocks, up to readBufferSize bytes, so that runs of physically
+	 * adjacent blocks are fetched with a single read; curBlockNumber is then
+	 * the logical blk# of the last block in the buffer.
 	 */
 	char	   *buffer;			/* physical buffer (separately palloc'd) */
+	int			bufferSize;		/* allocated size of buffer */
+	int			readBufferSize; /* bytes to read ahead while not frozen */
 	long		curBlockNumber; /* this block's logical blk# within tape */
 	int			pos;			/* next read/write position in buffer */
 	int			nbytes;			/* total # of valid bytes in buffer */
@@ -176,6 +184,10 @@ struct LogicalTapeSet
 
 static void ltsWriteBlock(LogicalTapeSet *lts, long blocknum, void *buffer);
 static void ltsReadBlock(LogicalTapeSet *lts, long blocknum, void *buffer);
+static void ltsReadBlocks(LogicalTapeSet *lts, long blocknum, int nblocks,
+			  void *buffer);
+static void ltsReadFillBuffer(LogicalTapeSet *lts, LogicalTape *lt,
+				  long datablocknum);
 static long ltsGetFreeBlock(LogicalTapeSet *lts);
 static void ltsReleaseBlock(LogicalTapeSet *lts, long blocknum);
 static void ltsRecordBlockNum(LogicalTapeSet *lts, IndirectBlock *indirect,
@@ -233,6 +245,24 @@ ltsReadBlock(LogicalTapeSet *lts, long blocknum, void *buffer)
 						blocknum)));
 }
 
+/*
+ * Read nblocks physically consecutive blocks, starting at the specified
+ * block of the underlying file, with a single request.
+ */
+static void
+ltsReadBlocks(LogicalTapeSet *lts, long blocknum, int nblocks, void *buffer)
+{
+	size_t		nbytes = (size_t) nblocks * BLCKSZ;
+
+	if (BufFileSeekBlock(lts->pfile, blocknum) != 0 ||
+		BufFileRead(lts->pfile, buffer, nbytes) != nbytes)
+		ereport(ERROR,
+		/* XXX is it okay to assume errno is correct? */
+				(errcode_for_file_access(),
+				 errmsg("could not read block %ld of temporary file: %m",
+						blocknum)));
+}
+
 /*
  * qsort comparator for sorting freeBlocks[] into decreasing order.
  */
@@ -553,6 +583,8 @@ LogicalTapeSetCreate(int ntapes)
 		lt->numFullBlocks = 0L;
 		lt->lastBlockBytes = 0;
 		lt->buffer = NULL;
+		lt->bufferSize = 0;
+		lt->readBufferSize = BLCKSZ;
 		lt->curBlockNumber = 0L;
 		lt->pos = 0;
 		lt->nbytes = 0;
@@ -602,6 +634,23 @@ LogicalTapeSetForgetFreeSpace(LogicalTapeSet *lts)
 	lts->forgetFreeSpace = true;
 }
 
+/*
+ * Set how much data may be read ahead from a logical tape while it is read
+ * without being frozen.  The size is rounded down to whole blocks, and takes
+ * effect the next time the tape's buffer runs dry, so it can be changed at
+ * any time.  The caller is responsible for accounting for the memory.
+ */
+void
+LogicalTapeSetReadBuffer(LogicalTapeSet *lts, int tapenum, size_t size)
+{
+	LogicalTape *lt;
+
+	Assert(tapenum >= 0 && tapenum < lts->nTapes);
+	lt = &lts->tapes[tapenum];
+	size = Min(size, (size_t) MaxAllocSize / 2);
+	lt->readBufferSize = (int) Max(size - size % BLCKSZ, (size_t) BLCKSZ);
+}
+
 /*
  * Dump the dirty buffer of a logical tape.
  */
@@ -617,6 +666,72 @@ ltsDumpBuffer(LogicalTapeSet *lts, LogicalTape *lt)
 	/* Caller must do other state update as needed */
 }
 
+/*
+ * Load the read buffer of a logical tape, starting with data block
+ * datablocknum, whose logical blk# the caller has already stored in
+ * curBlockNumber.
+ *
+ * A frozen tape gets one block at a time, since backspacing and seeking
+ * work on single blocks.  Otherwise we keep recalling the following blocks
+ * of the tape until readBufferSize is filled or the tape ends, and read each
+ * run of blocks that happen to be adjacent in the underlying file at once.
+ * The blocks are released as they are recalled; that is safe because
+ * nothing can be written before we have read them below.
+ */
+static void
+ltsReadFillBuffer(LogicalTapeSet *lts, LogicalTape *lt, long datablocknum)
+{
+	int			maxblocks;
+	int			nblocks = 0;
+	long		runStart = -1L;
+	int			runLength = 0;
+	int			runOffset = 0;
+
+	maxblocks = lt->frozen ? 1 : Max(lt->readBufferSize / BLCKSZ, 1);
+	if (lt->bufferSize < maxblocks * BLCKSZ)
+	{
+		if (lt->buffer)
+			pfree(lt->buffer);
+		lt->buffer = (char *) palloc(maxblocks * BLCKSZ);
+		lt->bufferSize = maxblocks * BLCKSZ;
+	}
+
+	lt->pos = 0;
+	lt->nbytes = 0;
+	for (;;)
+	{
+		if (runLength > 0 && datablocknum != runStart + runLength)
+		{
+			ltsReadBlocks(lts, runStart, runLength, lt->buffer + runOffset);
+			runLength = 0;
+		}
+		if (runLength == 0)
+		{
+			runStart = datablocknum;
+			runOffset = nblocks * BLCKSZ;
+		}
+		runLength++;
+		nblocks++;
+		if (!lt->frozen)
+			ltsReleaseBlock(lts, datablocknum);
+		if (lt->curBlockNumber < lt->numFullBlocks)
+			lt->nbytes += BLCKSZ;
+		else
+		{
+			/* the last, possibly partial, block of the tape */
+			lt->nbytes += lt->lastBlockBytes;
+			break;
+		}
+		if (nblocks >= maxblocks)
+			break;
+		datablocknum = ltsRecallNextBlockNum(lts, lt->indirect, lt->frozen);
+		if (datablocknum == -1L)
+			break;
+		lt->curBlockNumber++;
+	}
+	ltsReadBlocks(lts, runStart, runLength, lt->buffer + runOffset);
+}
+
 /*
  * Write to a logical tape.
  *
@@ -635,7 +750,10 @@ LogicalTapeWrite(LogicalTapeSet *lts, int tapenum,
 
 	/* Allocate data buffer and first indirect block on first write */
 	if (lt->buffer == NULL)
+	{
 		lt->buffer = (char *) palloc(BLCKSZ);
+		lt->bufferSize = BLCKSZ;
+	}
 	if (lt->indirect == NULL)
 	{
 		lt->indirect = (IndirectBlock *) palloc(sizeof(IndirectBlock));
@@ -721,13 +839,7 @@ LogicalTapeRewind(LogicalTapeSet *lts, int tapenum, bool forWrite)
 		lt->pos = 0;
 		lt->nbytes = 0;
 		if (datablocknum != -1L)
-		{
-			ltsReadBlock(lts, datablocknum, (void *) lt->buffer);
-			if (!lt->frozen)
-				ltsReleaseBlock(lts, datablocknum);
-			lt->nbytes = (lt->curBlockNumber < lt->numFullBlocks) ?
-				BLCKSZ : lt->lastBlockBytes;
-		}
+			ltsReadFillBuffer(lts, lt, datablocknum);
 	}
 	else
 	{
@@ -792,12 +904,7 @@ LogicalTapeRead(LogicalTapeSet *lts, int tapenum,
 			if (datablocknum == -1L)
 				break;			/* EOF */
 			lt->curBlockNumber++;
-			lt->pos = 0;
-			ltsReadBlock(lts, datablocknum, (void *) lt->buffer);
-			if (!lt->frozen)
-				ltsReleaseBlock(lts, datablocknum);
-			lt->nbytes = (lt->curBlockNumber < lt->numFullBlocks) ?
-				BLCKSZ : lt->lastBlockBytes;
+			ltsReadFillBuffer(lts, lt, datablocknum);
 			if (lt->nbytes <= 0)
 				break;			/* EOF (possible here?) */
 		}
@@ -103,6 +103,8 @@
 #include "access/htup_details.h"
 #include "access/nbtree.h"
 #include "catalog/index.h"
+#include "catalog/pg_opfamily.h"
+#include "catalog/pg_type.h"
 #include "commands/tablespace.h"
 #include "executor/executor.h"
 #include "miscadmin.h"
@@ -198,10 +200,14 @@ typedef enum
  *
  * MERGE_BUFFER_SIZE is how much data we'd like to read from each input
  * tape during a preread cycle (see discussion at top of file).
+ *
+ * MERGE_READ_BUFFER_SIZE caps the read-ahead buffer logtape.c keeps for
+ * each tape while merging, see mergereadbuffers().
  */
 #define MINORDER		6		/* minimum merge order */
 #define TAPE_BUFFER_OVERHEAD		(BLCKSZ * 3)
 #define MERGE_BUFFER_SIZE			(BLCKSZ * 32)
+#define MERGE_READ_BUFFER_SIZE		(BLCKSZ * 32)
 
 typedef int (*SortTupleComparator) (const SortTuple *a, const SortTuple *b,
 												Tuplesortstate *state);
@@ -358,10 +364,17 @@ struct Tuplesortstate
 
 	/*
 	 * This variable is shared by the single-key MinimalTuple case and the
-	 * Datum case (which both use qsort_ssup()).  Otherwise it's NULL.
+	 * Datum case (which both use qsort_ssup()).  Otherwise it's NULL.  It is
+	 * NULL too when the key is abbreviated, the ties need the full datums.
 	 */
 	SortSupport onlyKey;
 
+	/*
+	 * Bytes of the integer key of onlyKey (2, 4 or 8) when an in-memory sort
+	 * can be a radix sort, else 0.  See radix_sort_tuples.
+	 */
+	int			radixKeyBytes;
+
 	/*
 	 * These variables are specific to the CLUSTER case; they are set by
 	 * tuplesort_begin_cluster.  Note CLUSTER also uses tupDesc and
@@ -467,6 +480,7 @@ static void puttuple_common(Tuplesortstate *state, SortTuple *tuple);
 static void inittapes(Tuplesortstate *state);
 static void selectnewtape(Tuplesortstate *state);
 static void mergeruns(Tuplesortstate *state);
+static void mergereadbuffers(Tuplesortstate *state);
 static void mergeonerun(Tuplesortstate *state);
 static void beginmerge(Tuplesortstate *state);
 static void mergepreread(Tuplesortstate *state);
@@ -514,6 +528,11 @@ static void readtup_datum(Tuplesortstate *state, SortTuple *stup,
 			  int tapenum, unsigned int len);
 static void reversedirection_datum(Tuplesortstate *state);
 static void free_sort_tuple(Tuplesortstate *state, SortTuple *stup);
+static int	radix_key_bytes(Oid sortOperator);
+static void radix_sort_tuples(Tuplesortstate *state);
+
+/* fewer tuples are sorted by qsort_ssup() */
+#define RADIX_SORT_MIN_TUPLES	1024
 
 /*
  * Special versions of qsort just for SortTuple objects.  qsort_tuple() sorts
@@ -667,12 +686,17 @@ tuplesort_begin_heap(TupleDesc tupDesc,
 		sortKey->ssup_collation = sortCollations[i];
 		sortKey->ssup_nulls_first = nullsFirstFlags[i];
 		sortKey->ssup_attno = attNums[i];
+		/* datum1 can hold an abbreviated key of the leading column */
+		sortKey->abbreviate = (i == 0);
 
 		PrepareSortSupportFromOrderingOp(sortOperators[i], sortKey);
 	}
 
-	if (nkeys == 1)
+	if (nkeys == 1 && state->sortKeys->abbrev_converter == NULL)
+	{
 		state->onlyKey = state->sortKeys;
+		state->radixKeyBytes = radix_key_bytes(sortOperators[0]);
+	}
 
 	MemoryContextSwitchTo(oldcontext);
 
@@ -863,6 +887,7 @@ tuplesort_begin_datum(Oid datumType, Oid sortOperator, Oid sortCollation,
 	state->onlyKey->ssup_nulls_first = nullsFirstFlag;
 
 	PrepareSortSupportFromOrderingOp(sortOperator, state->onlyKey);
+	state->radixKeyBytes = radix_key_bytes(sortOperator);
 
 	/* lookup necessary attributes of the datum type */
 	get_typlenbyval(datumType, &typlen, &typbyval);
@@ -1384,7 +1409,11 @@ tuplesort_performsort(Tuplesortstate *state)
 			if (state->memtupcount > 1)
 			{
 				/* Can we use the single-key sort function? */
-				if (state->onlyKey != NULL)
+				if (state->onlyKey != NULL && state->radixKeyBytes > 0 &&
+					state->memtupcount >= RADIX_SORT_MIN_TUPLES &&
+					state->availMem >= (long) (state->memtupcount * sizeof(SortTuple)))
+					radix_sort_tuples(state);
+				else if (state->onlyKey != NULL)
 					qsort_ssup(state->memtuples, state->memtupcount,
 							   state->onlyKey);
 				else
@@ -1964,6 +1993,9 @@ mergeruns(Tuplesortstate *state)
 		return;
 	}
 
+	/* Let every tape read ahead as far as memory allows */
+	mergereadbuffers(state);
+
 	/* End of step D2: rewind all output tapes to prepare for merging */
 	for (tapenum = 0; tapenum < state->tapeRange; tapenum++)
 		LogicalTapeRewind(state->tapeset, tapenum, false);
@@ -2066,6 +2098,42 @@ mergeruns(Tuplesortstate *state)
 	state->status = TSS_SORTEDONTAPE;
 }
 
+/*
+ * mergereadbuffers - size the read-ahead buffers of the tapes for merging
+ *
+ * During a merge the tapes are read in turn, a preread cycle at a time, and
+ * fetching their blocks one by one costs a seek whenever the next block of
+ * a tape is not where the previous read left the file.  So we hand a quarter
+ * of the memory still available to logtape.c, split evenly among all tapes
+ * since each of them may become a merge input in a later pass, and let it
+ * read several blocks per request.  The first block of each buffer is
+ * already covered by TAPE_BUFFER_OVERHEAD.
+ */
+static void
+mergereadbuffers(Tuplesortstate *state)
+{
+	long		perTape;
+	int			tapenum;
+
+	if (LACKMEM(state))
+		return;
+	perTape = state->availMem / 4 / state->maxTapes;
+	perTape = Min(perTape, MERGE_READ_BUFFER_SIZE);
+	perTape -= perTape % BLCKSZ;
+	if (perTape <= BLCKSZ)
+		return;
+
+	USEMEM(state, (perTape - BLCKSZ) * state->maxTapes);
+	for (tapenum = 0; tapenum < state->maxTapes; tapenum++)
+		LogicalTapeSetReadBuffer(state->tapeset, tapenum, perTape);
+
+#ifdef TRACE_SORT
+	if (trace_sort)
+		elog(LOG, "using %ld kB read-ahead buffers for %d tapes",
+			 perTape / 1024, state->maxTapes);
+#endif
+}
+
 /*
  * Merge one run from each input tape, except ones with dummy runs.
  *
@@ -2832,6 +2900,167 @@ inlineApplySortFunction(FmgrInfo *sortFunction, int sk_flags, Oid collation,
 }
 
 
+/*
+ * Radix sort of single integer keys
+ *
+ * A sort on one int2, int4, int8, date or (integer) timestamp key orders the
+ * Datums as signed integers, which an LSD radix sort does in a few passes
+ * over the tuples instead of n log n comparator calls.  It needs a second
+ * array of SortTuples, so it is only used when that fits in the memory left.
+ */
+
+/*
+ * Bytes of the key of sortOperator for radix_sort_tuples, or 0 when its
+ * order is not the one of the integers.
+ */
+static int
+radix_key_bytes(Oid sortOperator)
+{
+	Oid			opfamily;
+	Oid			opcintype;
+	int16		strategy;
+
+	if (!get_ordering_op_properties(sortOperator,
+									&opfamily, &opcintype, &strategy))
+		return 0;
+
+	if (opfamily == INTEGER_BTREE_FAM_OID)
+	{
+		switch (opcintype)
+		{
+			case INT2OID:
+				return 2;
+			case INT4OID:
+				return 4;
+			case INT8OID:
+				return 8;
+		}
+	}
+	else if (opfamily == DATETIME_BTREE_FAM_OID)
+	{
+		switch (opcintype)
+		{
+			case DATEOID:
+				return 4;
+#ifdef HAVE_INT64_TIMESTAMP
+			case TIMESTAMPOID:
+			case TIMESTAMPTZOID:
+				return 8;
+#endif
+		}
+	}
+
+	return 0;
+}
+
+/* the key as an unsigned integer of the same order, reversed if needed */
+static inline uint64
+radix_key(Datum datum, int keybytes, bool reverse)
+{
+	uint64		key;
+	uint64		mask;
+
+	switch (keybytes)
+	{
+		case 2:
+			key = (uint64) (uint16) DatumGetInt16(datum) ^ 0x8000;
+			mask = 0xFFFF;
+			break;
+		case 4:
+			key = (uint64) (uint32) DatumGetInt32(datum) ^ 0x80000000;
+			mask = 0xFFFFFFFF;
+			break;
+		default:
+			key = (uint64) DatumGetInt64(datum) ^ (UINT64CONST(1) << 63);
+			mask = ~UINT64CONST(0);
+			break;
+	}
+
+	return reverse ? (~key & mask) : key;
+}
+
+static void
+radix_sort_tuples(Tuplesortstate *state)
+{
+	SortSupport ssup = state->onlyKey;
+	int			keybytes = state->radixKeyBytes;
+	SortTuple  *values = state->memtuples;
+	int			nvalues = state->memtupcount;
+	int			nnulls = 0;
+	Size		counts[8][256];
+	SortTuple  *from;
+	SortTuple  *to;
+	SortTuple  *buffer;
+	int			pass;
+	int			i;
+
+	/* the NULLs go in front or at the end, in no particular order */
+	for (i = 0; i < nvalues; i++)
+	{
+		int			j = ssup->ssup_nulls_first ? i : nvalues - 1 - i;
+		int			k = ssup->ssup_nulls_first ? nnulls : nvalues - 1 - nnulls;
+
+		if (values[j].isnull1)
+		{
+			SortTuple	tmp = values[j];
+
+			values[j] = values[k];
+			values[k] = tmp;
+			nnulls++;
+		}
+	}
+	nvalues -= nnulls;
+	if (ssup->ssup_nulls_first)
+		values += nnulls;
+	if (nvalues < 2)
+		return;
+
+	/* the counts of the digits of all the passes at once */
+	memset(counts, 0, sizeof(counts));
+	for (i = 0; i < nvalues; i++)
+	{
+		uint64		key = radix_key(values[i].datum1, keybytes, ssup->ssup_reverse);
+
+		for (pass = 0; pass < keybytes; pass++)
+			counts[pass][(key >> (pass * 8)) & 0xFF]++;
+	}
+
+	buffer = (SortTuple *) palloc(nvalues * sizeof(SortTuple));
+	from = values;
+	to = buffer;
+	for (pass = 0; pass < keybytes; pass++)
+	{
+		Size		offsets[256];
+		Size		total = 0;
+		int			digit;
+
+		/* all the keys share this digit: nothing to move */
+		if (counts[pass][(radix_key(values[0].datum1, keybytes,
+									ssup->ssup_reverse) >> (pass * 8)) & 0xFF] == nvalues)
+			continue;
+
+		for (digit = 0; digit < 256; digit++)
+		{
+			offsets[digit] = total;
+			total += counts[pass][digit];
+		}
+		for (i = 0; i < nvalues; i++)
+		{
+			uint64		key = radix_key(from[i].datum1, keybytes, ssup->ssup_reverse);
+
+			to[offsets[(key >> (pass * 8)) & 0xFF]++] = from[i];
+		}
+
+		/* the next pass reads what this one wrote */
+		from = to;
+		to = (to == buffer) ? values : buffer;
+	}
+
+	if (from != values)
+		memcpy(values, from, nvalues * sizeof(SortTuple));
+	pfree(buffer);
+}
+
 /*
  * Routines specialized for HeapTuple (actually MinimalTuple) case
  */
@@ -2859,6 +3088,25 @@ comparetup_heap(const SortTuple *a, const SortTuple *b, Tuplesortstate *state)
 	rtup.t_len = ((MinimalTuple) b->tuple)->t_len + MINIMAL_TUPLE_OFFSET;
 	rtup.t_data = (HeapTupleHeader) ((char *) b->tuple - MINIMAL_TUPLE_OFFSET);
 	tupDesc = state->tupDesc;
+
+	/* Equal abbreviated keys: the leading column itself decides */
+	if (sortKey->abbrev_converter != NULL && !a->isnull1)
+	{
+		Datum		datum1,
+					datum2;
+		bool		isnull1,
+					isnull2;
+
+		datum1 = heap_getattr(&ltup, sortKey->ssup_attno, tupDesc, &isnull1);
+		datum2 = heap_getattr(&rtup, sortKey->ssup_attno, tupDesc, &isnull2);
+
+		compare = ApplySortAbbrevFullComparator(datum1, isnull1,
+												datum2, isnull2,
+												sortKey);
+		if (compare != 0)
+			return compare;
+	}
+
 	sortKey++;
 	for (nkey = 1; nkey < state->nKeys; nkey++, sortKey++)
 	{
@@ -2903,6 +3151,9 @@ copytup_heap(Tuplesortstate *state, SortTuple *stup, void *tup)
 								state->sortKeys[0].ssup_attno,
 								state->tupDesc,
 								&stup->isnull1);
+	if (state->sortKeys[0].abbrev_converter != NULL && !stup->isnull1)
+		stup->datum1 = state->sortKeys[0].abbrev_converter(stup->datum1,
+														   &state->sortKeys[0]);
 }
 
 static void
@@ -2955,6 +3206,9 @@ readtup_heap(Tuplesortstate *state, SortTuple *stup,
 								state->sortKeys[0].ssup_attno,
 								state->tupDesc,
 								&stup->isnull1);
+	if (state->sortKeys[0].abbrev_converter != NULL && !stup->isnull1)
+		stup->datum1 = state->sortKeys[0].abbrev_converter(stup->datum1,
+														   &state->sortKeys[0]);
 }
 
 static void
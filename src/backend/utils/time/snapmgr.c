@@ -57,9 +57,25 @@
 
 #ifdef ADB
 #include "agtm/agtm.h"
+#include "agtm/agtm_broker.h"
 #include "libpq/pqformat.h"
 #include "postmaster/autovacuum.h"
 #endif
+#ifdef ADB
+/*
+ * The xip and subxip arrays of a copied snapshot never change, so a copy of
+ * a copied snapshot shares them instead of copying them again.  Only copying
+ * a static snapshot, once per snapshot taken, costs as much as the number of
+ * xids in progress, which global snapshots make large.  The array is freed
+ * with the last snapshot using it.
+ */
+typedef struct SnapshotXidArray
+{
+	uint32		refcount;		/* # of copied snapshots using the array */
+	TransactionId xids[1];		/* VARIABLE LENGTH ARRAY, xip then subxip */
+} SnapshotXidArray;
+#endif
+
 /*
  * CurrentSnapshot points to the only snapshot taken in transaction-snapshot
  * mode, and to the latest one taken in a read-committed transaction.
@@ -137,6 +153,11 @@ static Snapshot FirstXactSnapshot = NULL;
 	snprintf(path, sizeof(path), SNAPSHOT_EXPORT_DIR "/%08X-%d%s", \
 			 xid, num, suffix)
 
+#ifdef ADB
+/* Prefix of the tokens of pg_export_global_snapshot() */
+#define GLOBAL_SNAPSHOT_PREFIX "G-"
+#endif
+
 /* Current xact's exported snapshots (a list of Snapshot structs) */
 static List *exportedSnapshots = NIL;
 
@@ -144,6 +165,9 @@ static List *exportedSnapshots = NIL;
 static Snapshot CopySnapshot(Snapshot snapshot);
 static void FreeSnapshot(Snapshot snapshot);
 static void SnapshotResetXmin(void);
+static void SerializeSnapshot(StringInfo buf, Snapshot snapshot,
+				  TransactionId topXid, TransactionId *children,
+				  int nchildren);
 #ifdef ADB
 static Snapshot CopyGlobalSnapshot(Snapshot snapshot);
 #endif
@@ -298,17 +322,28 @@ SetTransactionSnapshot(Snapshot sourcesnap, TransactionId sourcexid)
 	CurrentSnapshot->xmin = sourcesnap->xmin;
 	CurrentSnapshot->xmax = sourcesnap->xmax;
 	CurrentSnapshot->xcnt = sourcesnap->xcnt;
+#ifdef ADB
+	EnlargeSnapshotXip(CurrentSnapshot, sourcesnap->xcnt);
+#else
 	Assert(sourcesnap->xcnt <= GetMaxSnapshotXidCount());
+#endif
 	memcpy(CurrentSnapshot->xip, sourcesnap->xip,
 		   sourcesnap->xcnt * sizeof(TransactionId));
 	CurrentSnapshot->subxcnt = sourcesnap->subxcnt;
+#ifdef ADB
+	EnlargeSnapshotSubxip(CurrentSnapshot, sourcesnap->subxcnt);
+#else
 	Assert(sourcesnap->subxcnt <= GetMaxSnapshotSubxidCount());
+#endif
 	memcpy(CurrentSnapshot->subxip, sourcesnap->subxip,
 		   sourcesnap->subxcnt * sizeof(TransactionId));
 	CurrentSnapshot->suboverflowed = sourcesnap->suboverflowed;
 	CurrentSnapshot->takenDuringRecovery = sourcesnap->takenDuringRecovery;
 	/* NB: curcid should NOT be copied, it's a local matter */
 
+	/* the contents are no longer what GetSnapshotData built */
+	CurrentSnapshot->snapXactCompletionCount = 0;
+
 	/*
 	 * Now we have to fix what GetSnapshotData did with MyPgXact->xmin and
 	 * TransactionXmin.  There is a race condition: to make sure we are not
@@ -320,6 +355,31 @@ SetTransactionSnapshot(Snapshot sourcesnap, TransactionId sourcexid)
 	 * doesn't seem worth contorting the logic here to avoid two calls,
 	 * especially since it's not clear that predicate.c *must* do this.
 	 */
+#ifdef ADB
+	/*
+	 * A global snapshot has no local source transaction to check.  Its xmin
+	 * is good as long as it does not precede the global xmin horizon, which
+	 * GetSnapshotData just got from AGTM.
+	 */
+	if (!TransactionIdIsValid(sourcexid))
+	{
+		bool		too_old;
+
+		LWLockAcquire(ProcArrayLock, LW_EXCLUSIVE);
+		too_old = TransactionIdIsNormal(RecentGlobalXmin) &&
+			TransactionIdPrecedes(CurrentSnapshot->xmin, RecentGlobalXmin);
+		if (!too_old)
+			MyPgXact->xmin = TransactionXmin = CurrentSnapshot->xmin;
+		LWLockRelease(ProcArrayLock);
+
+		if (too_old)
+			ereport(ERROR,
+					(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+					 errmsg("could not import the requested snapshot"),
+					 errdetail("The snapshot is older than the global xmin horizon.")));
+	}
+	else
+#endif
 	if (!ProcArrayInstallImportedXmin(CurrentSnapshot->xmin, sourcexid))
 		ereport(ERROR,
 				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
@@ -363,6 +423,43 @@ CopySnapshot(Snapshot snapshot)
 
 	Assert(snapshot != InvalidSnapshot);
 
+#ifdef ADB
+	newsnap = (Snapshot) MemoryContextAlloc(TopTransactionContext,
+											sizeof(SnapshotData));
+	memcpy(newsnap, snapshot, sizeof(SnapshotData));
+
+	newsnap->regd_count = 0;
+	newsnap->active_count = 0;
+	newsnap->copied = true;
+
+	/* Share the XID arrays of a copied snapshot */
+	if (snapshot->copied && snapshot->shared_xids != NULL)
+	{
+		snapshot->shared_xids->refcount++;
+		return newsnap;
+	}
+
+	size = subxipoff = offsetof(SnapshotXidArray, xids) +
+		snapshot->xcnt * sizeof(TransactionId);
+	if (snapshot->subxcnt > 0)
+		size += snapshot->subxcnt * sizeof(TransactionId);
+
+	newsnap->shared_xids = (SnapshotXidArray *)
+		MemoryContextAlloc(TopTransactionContext, size);
+	newsnap->shared_xids->refcount = 1;
+	newsnap->max_xcnt = snapshot->xcnt;
+	newsnap->max_subxcnt = snapshot->subxcnt;
+
+	/* setup XID array */
+	if (snapshot->xcnt > 0)
+	{
+		newsnap->xip = newsnap->shared_xids->xids;
+		memcpy(newsnap->xip, snapshot->xip,
+			   snapshot->xcnt * sizeof(TransactionId));
+	}
+	else
+		newsnap->xip = NULL;
+#else
 	/* We allocate any XID arrays needed in the same palloc block. */
 	size = subxipoff = sizeof(SnapshotData) +
 		snapshot->xcnt * sizeof(TransactionId);
@@ -385,6 +482,7 @@ CopySnapshot(Snapshot snapshot)
 	}
 	else
 		newsnap->xip = NULL;
+#endif
 
 	/*
 	 * Setup subXID array. Don't bother to copy it if it had overflowed,
@@ -395,7 +493,12 @@ CopySnapshot(Snapshot snapshot)
 	if (snapshot->subxcnt > 0 &&
 		(!snapshot->suboverflowed || snapshot->takenDuringRecovery))
 	{
+#ifdef ADB
+		newsnap->subxip = (TransactionId *)
+			((char *) newsnap->shared_xids + subxipoff);
+#else
 		newsnap->subxip = (TransactionId *) ((char *) newsnap + subxipoff);
+#endif
 		memcpy(newsnap->subxip, snapshot->subxip,
 			   snapshot->subxcnt * sizeof(TransactionId));
 	}
@@ -416,6 +519,11 @@ FreeSnapshot(Snapshot snapshot)
 	Assert(snapshot->active_count == 0);
 	Assert(snapshot->copied);
 
+#ifdef ADB
+	if (snapshot->shared_xids != NULL &&
+		--snapshot->shared_xids->refcount == 0)
+		pfree(snapshot->shared_xids);
+#endif
 	pfree(snapshot);
 }
 
@@ -780,6 +888,71 @@ AtEOXact_Snapshot(bool isCommit)
 }
 
 
+/*
+ * SerializeSnapshot
+ *		Append the text serialization of an exported snapshot to buf.
+ *
+ * The format expected by ImportSnapshot is pretty rigid: each line must be
+ * fieldname:value.
+ */
+static void
+SerializeSnapshot(StringInfo buf, Snapshot snapshot, TransactionId topXid,
+				  TransactionId *children, int nchildren)
+{
+	int			addTopXid;
+	int			i;
+
+	appendStringInfo(buf, "xid:%u\n", topXid);
+	appendStringInfo(buf, "dbid:%u\n", MyDatabaseId);
+	appendStringInfo(buf, "iso:%d\n", XactIsoLevel);
+	appendStringInfo(buf, "ro:%d\n", XactReadOnly);
+
+	appendStringInfo(buf, "xmin:%u\n", snapshot->xmin);
+	appendStringInfo(buf, "xmax:%u\n", snapshot->xmax);
+
+	/*
+	 * We must include our own top transaction ID in the top-xid data, since
+	 * by definition we will still be running when the importing transaction
+	 * adopts the snapshot, but GetSnapshotData never includes our own XID in
+	 * the snapshot.  (There must, therefore, be enough room to add it.)
+	 *
+	 * However, it could be that our topXid is after the xmax, in which case
+	 * we shouldn't include it because xip[] members are expected to be before
+	 * xmax.  (We need not make the same check for subxip[] members, see
+	 * snapshot.h.)
+	 */
+#ifdef ADB
+	/* A global snapshot can be serialized by a session having no XID */
+	addTopXid = (TransactionIdIsValid(topXid) &&
+				 TransactionIdPrecedes(topXid, snapshot->xmax)) ? 1 : 0;
+#else
+	addTopXid = TransactionIdPrecedes(topXid, snapshot->xmax) ? 1 : 0;
+#endif
+	appendStringInfo(buf, "xcnt:%d\n", snapshot->xcnt + addTopXid);
+	for (i = 0; i < snapshot->xcnt; i++)
+		appendStringInfo(buf, "xip:%u\n", snapshot->xip[i]);
+	if (addTopXid)
+		appendStringInfo(buf, "xip:%u\n", topXid);
+
+	/*
+	 * Similarly, we add our subcommitted child XIDs to the subxid data. Here,
+	 * we have to cope with possible overflow.
+	 */
+	if (snapshot->suboverflowed ||
+		snapshot->subxcnt + nchildren > GetMaxSnapshotSubxidCount())
+		appendStringInfoString(buf, "sof:1\n");
+	else
+	{
+		appendStringInfoString(buf, "sof:0\n");
+		appendStringInfo(buf, "sxcnt:%d\n", snapshot->subxcnt + nchildren);
+		for (i = 0; i < snapshot->subxcnt; i++)
+			appendStringInfo(buf, "sxp:%u\n", snapshot->subxip[i]);
+		for (i = 0; i < nchildren; i++)
+			appendStringInfo(buf, "sxp:%u\n", children[i]);
+	}
+	appendStringInfo(buf, "rec:%u\n", snapshot->takenDuringRecovery);
+}
+
 /*
  * ExportSnapshot
  *		Export the snapshot to a file so that other backends can import it.
@@ -792,10 +965,8 @@ ExportSnapshot(Snapshot snapshot)
 	TransactionId topXid;
 	TransactionId *children;
 	int			nchildren;
-	int			addTopXid;
 	StringInfoData buf;
 	FILE	   *f;
-	int			i;
 	MemoryContext oldcxt;
 	char		path[MAXPGPATH];
 	char		pathtmp[MAXPGPATH];
@@ -854,54 +1025,10 @@ ExportSnapshot(Snapshot snapshot)
 
 	/*
 	 * Fill buf with a text serialization of the snapshot, plus identification
-	 * data about this transaction.  The format expected by ImportSnapshot is
-	 * pretty rigid: each line must be fieldname:value.
+	 * data about this transaction.
 	 */
 	initStringInfo(&buf);
-
-	appendStringInfo(&buf, "xid:%u\n", topXid);
-	appendStringInfo(&buf, "dbid:%u\n", MyDatabaseId);
-	appendStringInfo(&buf, "iso:%d\n", XactIsoLevel);
-	appendStringInfo(&buf, "ro:%d\n", XactReadOnly);
-
-	appendStringInfo(&buf, "xmin:%u\n", snapshot->xmin);
-	appendStringInfo(&buf, "xmax:%u\n", snapshot->xmax);
-
-	/*
-	 * We must include our own top transaction ID in the top-xid data, since
-	 * by definition we will still be running when the importing transaction
-	 * adopts the snapshot, but GetSnapshotData never includes our own XID in
-	 * the snapshot.  (There must, therefore, be enough room to add it.)
-	 *
-	 * However, it could be that our topXid is after the xmax, in which case
-	 * we shouldn't include it because xip[] members are expected to be before
-	 * xmax.  (We need not make the same check for subxip[] members, see
-	 * snapshot.h.)
-	 */
-	addTopXid = TransactionIdPrecedes(topXid, snapshot->xmax) ? 1 : 0;
-	appendStringInfo(&buf, "xcnt:%d\n", snapshot->xcnt + addTopXid);
-	for (i = 0; i < snapshot->xcnt; i++)
-		appendStringInfo(&buf, "xip:%u\n", snapshot->xip[i]);
-	if (addTopXid)
-		appendStringInfo(&buf, "xip:%u\n", topXid);
-
-	/*
-	 * Similarly, we add our subcommitted child XIDs to the subxid data. Here,
-	 * we have to cope with possible overflow.
-	 */
-	if (snapshot->suboverflowed ||
-		snapshot->subxcnt + nchildren > GetMaxSnapshotSubxidCount())
-		appendStringInfoString(&buf, "sof:1\n");
-	else
-	{
-		appendStringInfoString(&buf, "sof:0\n");
-		appendStringInfo(&buf, "sxcnt:%d\n", snapshot->subxcnt + nchildren);
-		for (i = 0; i < snapshot->subxcnt; i++)
-			appendStringInfo(&buf, "sxp:%u\n", snapshot->subxip[i]);
-		for (i = 0; i < nchildren; i++)
-			appendStringInfo(&buf, "sxp:%u\n", children[i]);
-	}
-	appendStringInfo(&buf, "rec:%u\n", snapshot->takenDuringRecovery);
+	SerializeSnapshot(&buf, snapshot, topXid, children, nchildren);
 
 	/*
 	 * Now write the text representation into a file.  We first write to a
@@ -961,6 +1088,125 @@ pg_export_snapshot(PG_FUNCTION_ARGS)
 	PG_RETURN_TEXT_P(cstring_to_text(snapshotName));
 }
 
+#ifdef ADB
+/*
+ * pg_export_global_snapshot
+ *		Export the global snapshot of the transaction so that sessions on
+ *		other nodes of the cluster can import it.
+ *
+ * Files in SNAPSHOT_EXPORT_DIR are only visible to the node which wrote
+ * them, so the token carries the whole serialization instead, hex-encoded
+ * after a "G-" prefix.  The XIDs of a global snapshot being assigned by
+ * AGTM, the snapshot means the same on every node.  The transaction has to
+ * stay open for as long as the importers need its xmin honored.
+ */
+Datum
+pg_export_global_snapshot(PG_FUNCTION_ARGS)
+{
+	Snapshot	snapshot;
+	MemoryContext oldcxt;
+
+	if (!IsUnderAGTM())
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("global snapshots are only available under AGTM")));
+
+	(void) GetTopTransactionId();
+
+	if (IsSubTransaction())
+		ereport(ERROR,
+				(errcode(ERRCODE_ACTIVE_SQL_TRANSACTION),
+				 errmsg("cannot export a snapshot from a subtransaction")));
+
+	/* keep the xmin of the snapshot honored, as ExportSnapshot does */
+	snapshot = CopySnapshot(GetActiveSnapshot());
+
+	oldcxt = MemoryContextSwitchTo(TopTransactionContext);
+	exportedSnapshots = lappend(exportedSnapshots, snapshot);
+	MemoryContextSwitchTo(oldcxt);
+
+	snapshot->regd_count++;
+	RegisteredSnapshots++;
+
+	PG_RETURN_TEXT_P(cstring_to_text(GlobalSnapshotToken(snapshot)));
+}
+
+/*
+ * GlobalSnapshotToken
+ *		Build the token which imports "snapshot", a global snapshot of the
+ *		current transaction, into a session of any node of the cluster.
+ *
+ * The transaction may have no XID, the token carries none then.  Nothing
+ * keeps the xmin of the snapshot honored but the caller, which has to hold
+ * on to the snapshot for as long as the importers need it.
+ */
+char *
+GlobalSnapshotToken(Snapshot snapshot)
+{
+	static const char hextbl[] = "0123456789ABCDEF";
+	TransactionId topXid = GetTopTransactionIdIfAny();
+	TransactionId *children = NULL;
+	int			nchildren = 0;
+	StringInfoData buf;
+	StringInfoData token;
+	int			i;
+
+	if (TransactionIdIsValid(topXid))
+		nchildren = xactGetCommittedChildren(&children);
+
+	initStringInfo(&buf);
+	SerializeSnapshot(&buf, snapshot, topXid, children, nchildren);
+
+	initStringInfo(&token);
+	enlargeStringInfo(&token, buf.len * 2 + 2);
+	appendStringInfoString(&token, GLOBAL_SNAPSHOT_PREFIX);
+	for (i = 0; i < buf.len; i++)
+	{
+		unsigned char c = (unsigned char) buf.data[i];
+
+		appendStringInfoChar(&token, hextbl[c >> 4]);
+		appendStringInfoChar(&token, hextbl[c & 0xF]);
+	}
+	pfree(buf.data);
+
+	return token.data;
+}
+
+/*
+ * Decode the serialization carried by a global snapshot token, NULL
+ * if it is not valid hex.
+ */
+static char *
+DecodeGlobalSnapshot(const char *hex)
+{
+	size_t		len = strlen(hex);
+	char	   *result;
+	size_t		i;
+
+	if (len % 2 != 0)
+		return NULL;
+
+	result = palloc(len / 2 + 1);
+	for (i = 0; i < len; i += 2)
+	{
+		int			hi;
+		int			lo;
+
+		hi = (hex[i] >= 'A' ? hex[i] - 'A' + 10 : hex[i] - '0');
+		lo = (hex[i + 1] >= 'A' ? hex[i + 1] - 'A' + 10 : hex[i + 1] - '0');
+		result[i / 2] = (char) ((hi << 4) | lo);
+		if (result[i / 2] == '\0')
+		{
+			pfree(result);
+			return NULL;
+		}
+	}
+	result[len / 2] = '\0';
+
+	return result;
+}
+#endif
+
 
 /*
  * Parsing subroutines for ImportSnapshot: parse a line with the given
@@ -1037,6 +1283,10 @@ ImportSnapshot(const char *idstr)
 	int			src_isolevel;
 	bool		src_readonly;
 	SnapshotData snapshot;
+	int			maxxcnt = GetMaxSnapshotXidCount();
+#ifdef ADB
+	bool		global = false;
+#endif
 
 	/*
 	 * Must be at top level of a fresh transaction.  Note in particular that
@@ -1060,6 +1310,30 @@ ImportSnapshot(const char *idstr)
 				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
 				 errmsg("a snapshot-importing transaction must have isolation level SERIALIZABLE or REPEATABLE READ")));
 
+#ifdef ADB
+	/*
+	 * A global snapshot carries its serialization instead of naming a file.
+	 */
+	if (strncmp(idstr, GLOBAL_SNAPSHOT_PREFIX,
+				strlen(GLOBAL_SNAPSHOT_PREFIX)) == 0)
+	{
+		const char *hex = idstr + strlen(GLOBAL_SNAPSHOT_PREFIX);
+
+		if (!IsUnderAGTM())
+			ereport(ERROR,
+					(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					 errmsg("global snapshots are only available under AGTM")));
+		if (strspn(hex, "0123456789ABCDEF") != strlen(hex) ||
+			(filebuf = DecodeGlobalSnapshot(hex)) == NULL)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("invalid snapshot identifier: \"%s\"", idstr)));
+		global = true;
+		strlcpy(path, "global snapshot", MAXPGPATH);
+		goto parse;
+	}
+#endif
+
 	/*
 	 * Verify the identifier: only 0-9, A-F and hyphens are allowed.  We do
 	 * this mainly to prevent reading arbitrary files.
@@ -1091,6 +1365,9 @@ ImportSnapshot(const char *idstr)
 
 	FreeFile(f);
 
+#ifdef ADB
+parse:
+#endif
 	/*
 	 * Construct a snapshot struct by parsing the file content.
 	 */
@@ -1107,8 +1384,16 @@ ImportSnapshot(const char *idstr)
 
 	snapshot.xcnt = xcnt = parseIntFromText("xcnt:", &filebuf, path);
 
-	/* sanity-check the xid count before palloc */
-	if (xcnt < 0 || xcnt > GetMaxSnapshotXidCount())
+	/*
+	 * sanity-check the xid count before palloc.  A global snapshot lists the
+	 * transactions of the whole cluster, which can be more than the local
+	 * procarray holds.
+	 */
+#ifdef ADB
+	if (global)
+		maxxcnt = MaxAllocSize / sizeof(TransactionId);
+#endif
+	if (xcnt < 0 || xcnt > maxxcnt)
 		ereport(ERROR,
 				(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
 				 errmsg("invalid snapshot data in file \"%s\"", path)));
@@ -1146,7 +1431,11 @@ ImportSnapshot(const char *idstr)
 	 * don't trouble to check the array elements, just the most critical
 	 * fields.
 	 */
-	if (!TransactionIdIsNormal(src_xid) ||
+	if ((!TransactionIdIsNormal(src_xid)
+#ifdef ADB
+		 && !(global && src_xid == InvalidTransactionId)
+#endif
+		) ||
 		!OidIsValid(src_dbid) ||
 		!TransactionIdIsNormal(snapshot.xmin) ||
 		!TransactionIdIsNormal(snapshot.xmax))
@@ -1160,6 +1449,12 @@ ImportSnapshot(const char *idstr)
 	 * non-read-only transaction can't adopt a snapshot from a read-only
 	 * transaction, as predicate.c handles the cases very differently.
 	 */
+#ifdef ADB
+	if (global && IsolationIsSerializable())
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("a serializable transaction cannot import a global snapshot")));
+#endif
 	if (IsolationIsSerializable())
 	{
 		if (src_isolevel != XACT_SERIALIZABLE)
@@ -1181,6 +1476,17 @@ ImportSnapshot(const char *idstr)
 	 * additional syntax, since that has to be known when the snapshot is
 	 * initially taken.  (See pgsql-hackers discussion of 2011-10-21.)
 	 */
+#ifdef ADB
+	/*
+	 * The OIDs of the databases differ between nodes, and the xmin of a
+	 * global snapshot is checked against the horizon AGTM gives instead.
+	 */
+	if (global)
+	{
+		SetTransactionSnapshot(&snapshot, InvalidTransactionId);
+		return;
+	}
+#endif
 	if (src_dbid != MyDatabaseId)
 		ereport(ERROR,
 				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
@@ -1290,10 +1596,7 @@ SetGlobalSnapshot(StringInfo input_message)
 {
 	uint32			xcnt;
 	int32			subxcnt;
-	int32			maxsubxcnt;
-	bool			suboverflowed = false;
 	int				i;
-	TransactionId	*subxip = NULL;
 
 	Assert(IS_PGXC_DATANODE || IsConnFromCoord());
 	RecentGlobalXmin = pq_getmsgint(input_message, sizeof(TransactionId));
@@ -1321,29 +1624,14 @@ SetGlobalSnapshot(StringInfo input_message)
 	GlobalSnapshot->xcnt = xcnt;
 	/* subxcnt */
 	subxcnt = pq_getmsgint(input_message, sizeof(int32));
-	/* subxip */
-	if (subxcnt > 0)
-	{
-		maxsubxcnt = GetMaxSnapshotSubxidCount();
-		if (subxcnt > maxsubxcnt)
-		{
-			subxcnt = maxsubxcnt;
-			suboverflowed = true;
-		}
-		if (GlobalSnapshot->subxip == NULL)
-		{
-			subxip = (TransactionId *) malloc(maxsubxcnt * sizeof(TransactionId));
-			if (subxip == NULL)
-				ereport(ERROR,
-						(errcode(ERRCODE_OUT_OF_MEMORY),
-					  errmsg("Fail to malloc %d subxip of \"GlobalSnapshot\"", maxsubxcnt)));
-			GlobalSnapshot->subxip = subxip;
-		}
-		GlobalSnapshot->subxcnt = subxcnt;
-		GlobalSnapshot->suboverflowed = suboverflowed;
-		for (i = 0; i < subxcnt; i++)
-				GlobalSnapshot->subxip[i] = pq_getmsgint(input_message, sizeof(TransactionId));
-	}
+	/* subxip, all of them whatever their number */
+	EnlargeSnapshotSubxip(GlobalSnapshot, subxcnt);
+	for (i = 0; i < subxcnt; i++)
+		GlobalSnapshot->subxip[i] = pq_getmsgint(input_message, sizeof(TransactionId));
+	GlobalSnapshot->subxcnt = subxcnt;
+	/* suboverflowed */
+	GlobalSnapshot->suboverflowed = pq_getmsgbyte(input_message);
+	pq_getmsgend(input_message);
 
 	GlobalSnapshotSet = true;
 #ifdef SHOW_GLOBAL_SNAPSHOT
@@ -1371,7 +1659,7 @@ CopyGlobalSnapshot(Snapshot snapshot)
 	memcpy(snapshot->xip, GlobalSnapshot->xip,
 		GlobalSnapshot->xcnt * sizeof(TransactionId));
 	snapshot->xcnt = GlobalSnapshot->xcnt;
-	Assert(GlobalSnapshot->subxcnt <= GetMaxSnapshotSubxidCount());
+	EnlargeSnapshotSubxip(snapshot, GlobalSnapshot->subxcnt);
 	snapshot->subxcnt = GlobalSnapshot->subxcnt;
 	snapshot->suboverflowed = GlobalSnapshot->suboverflowed;
 	memcpy(snapshot->subxip, GlobalSnapshot->subxip,
@@ -1391,9 +1679,14 @@ GetGlobalSnapshot(Snapshot snapshot)
 	if (IS_PGXC_COORDINATOR && !IsConnFromCoord())
 	{
 		/*
-	 	 * Master-Coordinator get snapshot from AGTM.
+	 	 * Master-Coordinator get snapshot from AGTM, possibly sharing
+	 	 * the request with other backends through the snapshot broker.
+	 	 * A snapshot prefetched for this statement is already on the way.
 	 	 */
-		snap = agtm_GetGlobalSnapShot(snapshot);
+		if (enable_agtm_snapshot_broker && !agtm_HaveSnapShotPrefetch())
+			snap = agtm_GetBrokeredSnapShot(snapshot);
+		else
+			snap = agtm_GetGlobalSnapShot(snapshot);
 	} else if (GlobalSnapshot == NULL ||
 		GlobalSnapshotSet == false ||
 		IsAnyAutoVacuumProcess())
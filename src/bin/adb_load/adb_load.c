@@ -9,6 +9,7 @@
 #include <sys/stat.h>
 #include <dirent.h>
 #include <time.h>
+#include <sys/wait.h>
 
 #include "postgres_fe.h"
 #include "catalog/pg_type.h"
@@ -26,6 +27,7 @@
 #include "utility.h"
 #include "properties.h"
 #include "log_summary.h"
+#include "load_stats.h"
 
 typedef struct tables
 {
@@ -52,6 +54,13 @@ struct TableName
 
 struct special_table *special_table_list = NULL;
 
+/* a file to load by one of the worker processes of option -P */
+typedef struct ParallelFile
+{
+	TableInfo    *table_info;
+	FileLocation *file_location;
+} ParallelFile;
+
 static char get_distribute_by(const char *conninfo, const char *tablename);
 static void get_all_datanode_info(ADBLoadSetting *setting);
 static void get_conninfo_for_alldatanode(ADBLoadSetting *setting);
@@ -84,7 +93,10 @@ static void rename_file_suffix(char *old_file_path, char *suffix);
 static char *get_full_path(char *file_name, char *input_dir);
 static char *get_table_name(char *file_name);
 static bool is_suffix(char *str, char *suffix);
+static bool is_data_file(char *file_name);
 
+static void load_files_parallel(Tables *tables_ptr);
+static void load_files_worker(ParallelFile *files, int fd);
 static void send_data_to_datanode(DISTRIBUTE distribute_by,
                                 ADBLoadSetting *setting,
                                 TableInfo *table_info_ptr);
@@ -200,6 +212,9 @@ clean_hash_field (HashField *hash_field)
 	pg_free(hash_field->hash_delim);
 	hash_field->hash_delim = NULL;
 
+	pg_free(hash_field->copy_null);
+	hash_field->copy_null = NULL;
+
 	pg_free(hash_field);
 	hash_field = NULL;
 
@@ -279,10 +294,10 @@ main(int argc, char **argv)
 	get_node_conn_info(setting);
 
 	/* make sure threads_num_per_datanode < max_connect for agtm */
-	check_max_connections(setting->threads_num_per_datanode, setting->agtm_info);
+	check_max_connections(setting->threads_num_per_datanode * setting->parallel_num, setting->agtm_info);
 
 	/* make sure threads_num_per_datanode < max_connect for coordinator */
-	check_max_connections(setting->threads_num_per_datanode, setting->coordinator_info);
+	check_max_connections(setting->threads_num_per_datanode * setting->parallel_num, setting->coordinator_info);
 
 	/* open log file if not exist create. */
 	if (setting->output_directory != NULL)
@@ -365,6 +380,13 @@ main(int argc, char **argv)
 	/* init linebuf */
 	init_linebuf(setting->datanodes_num);
 
+	if (setting->static_mode && setting->parallel_num > 1)
+	{
+		load_files_parallel(tables_ptr);
+		table_count = tables_ptr->table_nums;
+		table_info_ptr = NULL;
+	}
+
 	while(table_info_ptr)
 	{
 		++table_count;
@@ -440,6 +462,144 @@ main(int argc, char **argv)
 	return 0;
 }
 /*------------------------end main-------------------------------------------------------*/
+
+/*
+ * Load the files of all the tables with setting->parallel_num worker
+ * processes. The read, hash and dispatch modules keep their state in
+ * globals, so each worker is a process running them for one file at a time.
+ * Workers take the index of their next file from a pipe as soon as they are
+ * done with the previous one, so a worker stuck on a large file does not
+ * hold back the others.
+ */
+static void
+load_files_parallel(Tables *tables_ptr)
+{
+	ParallelFile *files = NULL;
+	TableInfo    *table_info_ptr = NULL;
+	pid_t        *workers = NULL;
+	int           file_total = 0;
+	int           worker_num = 0;
+	int           fd[2];
+	int           i = 0;
+
+	for (table_info_ptr = tables_ptr->info; table_info_ptr; table_info_ptr = table_info_ptr->next)
+		file_total += table_info_ptr->file_nums;
+
+	files = (ParallelFile *)palloc0(sizeof(ParallelFile) * (file_total > 0 ? file_total : 1));
+
+	/*
+	 * Prepare the tables before starting the workers, the functions of user
+	 * defined distributions are created once on the adb_load server.
+	 */
+	for (table_info_ptr = tables_ptr->info; table_info_ptr; table_info_ptr = table_info_ptr->next)
+	{
+		slist_mutable_iter siter;
+
+		get_table_attribute(setting, table_info_ptr);
+
+		if (setting->config_datanodes_valid)
+			get_use_datanodes_from_conf(setting, table_info_ptr);
+		else
+			get_use_datanodes(setting, table_info_ptr);
+
+		check_queue_num_valid(setting, table_info_ptr);
+
+		slist_foreach_modify (siter, &table_info_ptr->file_head)
+		{
+			files[i].table_info = table_info_ptr;
+			files[i].file_location = slist_container(FileLocation, next, siter.cur);
+			slist_delete_current(&siter);
+			i++;
+		}
+		table_info_ptr->file_nums = 0;
+	}
+	Assert(i == file_total);
+
+	if (pipe(fd) < 0)
+	{
+		fprintf(stderr, "Error: could not create pipe: %s\n", strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+
+	/* the workers must not write again what is still buffered here */
+	fflush(NULL);
+
+	worker_num = Min(setting->parallel_num, file_total);
+	workers = (pid_t *)palloc0(sizeof(pid_t) * (worker_num > 0 ? worker_num : 1));
+	for (i = 0; i < worker_num; i++)
+	{
+		workers[i] = fork();
+		if (workers[i] < 0)
+		{
+			fprintf(stderr, "Error: could not fork worker process: %s\n", strerror(errno));
+			exit(EXIT_FAILURE);
+		}
+		if (workers[i] == 0)
+		{
+			close(fd[1]);
+			load_files_worker(files, fd[0]);
+			exit(EXIT_SUCCESS);
+		}
+	}
+	close(fd[0]);
+
+	/* an int is written atomically, each index goes to a single worker */
+	for (i = 0; i < file_total; i++)
+	{
+		if (write(fd[1], &i, sizeof(i)) != sizeof(i))
+		{
+			fprintf(stderr, "Error: could not send file to worker processes: %s\n", strerror(errno));
+			break;
+		}
+	}
+	close(fd[1]);
+
+	for (i = 0; i < worker_num; i++)
+	{
+		int status = 0;
+
+		if (waitpid(workers[i], &status, 0) < 0 ||
+			!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+		{
+			fprintf(stderr, "Error: worker process %d exited abnormally.\n", (int) workers[i]);
+			ADBLOADER_LOG(LOG_ERROR, "[main] worker process %d exited abnormally", (int) workers[i]);
+		}
+	}
+
+	/* workers share the detail log of a table, only check it when all are done */
+	for (table_info_ptr = tables_ptr->info; table_info_ptr; table_info_ptr = table_info_ptr->next)
+		check_log_detail_fd(setting->log_field->log_path, table_info_ptr->table_name);
+
+	pg_free(workers);
+	pg_free(files);
+
+	return;
+}
+
+static void
+load_files_worker(ParallelFile *files, int fd)
+{
+	int index = 0;
+
+	while (read(fd, &index, sizeof(index)) == sizeof(index))
+	{
+		TableInfo *table_info_ptr = files[index].table_info;
+
+		/* send_data_to_datanode loads and frees all the files of the list */
+		slist_init(&table_info_ptr->file_head);
+		slist_push_head(&table_info_ptr->file_head, &files[index].file_location->next);
+		table_info_ptr->file_nums = 1;
+
+		open_log_detail_fd(setting->log_field->log_path, table_info_ptr->table_name);
+		send_data_to_datanode(table_info_ptr->distribute_type, setting, table_info_ptr);
+		close_log_detail_fd();
+	}
+
+	close(fd);
+	fflush(NULL);
+
+	return;
+}
 static void
 send_data_to_datanode(DISTRIBUTE distribute_by,
                                 ADBLoadSetting *setting,
@@ -503,6 +663,11 @@ send_data_to_datanode(DISTRIBUTE distribute_by,
 				break;
 		}
 
+		/* record the result, failed files can be loaded again from it */
+		linebuff = format_file_result(file_location->location, sent_ok);
+		write_log_summary_fd(linebuff);
+		release_linebuf(linebuff);
+
 		/* end record error file */
 		linebuff = format_error_end(file_location->location);
 		write_log_detail_fd(linebuff->data);
@@ -716,7 +881,7 @@ update_file_info(char *input_dir, Tables *tables)
 			continue;
 		}
 
-		if (!is_suffix(dirent_ptr->d_name, SUFFIX_SQL))
+		if (!is_data_file(dirent_ptr->d_name))
 		{
 			fprintf(stderr, "invalid file name :\"%s/%s\"\n", input_dir, dirent_ptr->d_name);
 			ADBLOADER_LOG(LOG_ERROR, "[main][thread main ] invalid file name :\"%s/%s\"\n", input_dir, dirent_ptr->d_name);
@@ -833,7 +998,7 @@ get_file_info(char *input_dir)
 
 		if (setting->static_mode || setting->dynamic_mode)
 		{
-			if (!is_suffix(dirent_ptr->d_name, SUFFIX_SQL))
+			if (!is_data_file(dirent_ptr->d_name))
 			{
 				fprintf(stderr, "invalid file name :\"%s/%s\"\n", input_dir, dirent_ptr->d_name);
 				ADBLOADER_LOG(LOG_ERROR, "[main][thread main ] invalid file name :\"%s/%s\"\n", input_dir, dirent_ptr->d_name);
@@ -1044,6 +1209,34 @@ is_suffix(char *str, char *suffix)
 		return false;
 }
 
+/*
+ * Data files end with SUFFIX_SQL, or with SUFFIX_SQL and the suffix of a
+ * compression program, the read module decompresses them itself.
+ */
+static bool
+is_data_file(char *file_name)
+{
+	static char *compress_suffixes[] = {".gz", ".zst", ".lz4", NULL};
+	int          name_len;
+	int          i;
+
+	if (is_suffix(file_name, SUFFIX_SQL))
+		return true;
+
+	name_len = strlen(file_name);
+	for (i = 0; compress_suffixes[i] != NULL; i++)
+	{
+		int suffix_len = strlen(SUFFIX_SQL) + strlen(compress_suffixes[i]);
+
+		if (name_len > suffix_len &&
+			is_suffix(file_name, compress_suffixes[i]) &&
+			strncmp(file_name + name_len - suffix_len, SUFFIX_SQL, strlen(SUFFIX_SQL)) == 0)
+			return true;
+	}
+
+	return false;
+}
+
 char *
 get_outqueue_name (int datanode_num)
 {
@@ -1140,6 +1333,9 @@ do_replaciate_roundrobin(DISTRIBUTE distribute_by, char *filepath, TableInfo *ta
 		queue_name = NULL;
 	}
 
+	load_stats_start(filepath, table_info->use_datanodes_num,
+					 NULL, output_queue, output_queue_total);
+
 	dispatch->output_queue = output_queue;
 	dispatch->conninfo_agtm = pg_strdup(setting->agtm_info->connection);
 	dispatch->datanode_info = datanode_info;
@@ -1225,6 +1421,7 @@ do_replaciate_roundrobin(DISTRIBUTE distribute_by, char *filepath, TableInfo *ta
 			show_process(file_total_line, table_info->use_datanodes_num,
 								thread_send_total, DISTRIBUTE_BY_REPLICATION);
 		}
+		load_stats_report();
 
 		/* all modules complete */
 		if (read_finish && dispatch_finish)
@@ -1305,6 +1502,8 @@ do_replaciate_roundrobin(DISTRIBUTE distribute_by, char *filepath, TableInfo *ta
 		sleep(1);
 	}
 
+	load_stats_finish();
+
 	if (!stop_log_summary_thread())
 	{
 		ADBLOADER_LOG(LOG_ERROR, "stop log summary thread failed");
@@ -1433,6 +1632,9 @@ do_hash_module(char *filepath, const TableInfo *table_info)
 		queue_name = NULL;
 	}
 
+	load_stats_start(filepath, table_info->use_datanodes_num,
+					 input_queue, output_queue, output_queue_total);
+
 	/* get table base attribute */
 	field = (HashField *)palloc0(sizeof(HashField));
 	deep_copy(field, table_info->table_attribute);
@@ -1443,6 +1645,10 @@ do_hash_module(char *filepath, const TableInfo *table_info)
 	{
 		Assert(field->field_nums == 1);
 		func_name = conver_type_to_fun(field->field_type[0], DISTRIBUTE_BY_DEFAULT_HASH);
+		if (table_info->distribute_type == DISTRIBUTE_BY_DEFAULT_MODULO)
+			field->locator_type = HASH_LOCATOR_MODULO;
+		else
+			field->locator_type = HASH_LOCATOR_HASH;
 	}
 	else if (table_info->distribute_type == DISTRIBUTE_BY_USERDEFINED)
 	{
@@ -1557,6 +1763,7 @@ do_hash_module(char *filepath, const TableInfo *table_info)
 			show_process(file_total_line, table_info->use_datanodes_num,
 								thread_send_total, DISTRIBUTE_BY_DEFAULT_HASH);
 		}
+		load_stats_report();
 
 		/* all modules complete*/
 		if (read_finish && hash_finish && dispatch_finish)
@@ -1679,6 +1886,8 @@ do_hash_module(char *filepath, const TableInfo *table_info)
 		sleep(2);
 	}
 
+	load_stats_finish();
+
 	if (!stop_log_summary_thread())
 	{
 		ADBLOADER_LOG(LOG_ERROR, "stop log summary thread failed");
@@ -1958,6 +2167,7 @@ reset_hash_field(TableInfo *table_info)
 	hashfield->hash_threads_num = setting->hash_config->hash_thread_num;
 	hashfield->text_delim   = pg_strdup(setting->hash_config->text_delim);
 	hashfield->copy_options = pg_strdup(setting->hash_config->copy_option);
+	hashfield->copy_null    = pg_strdup(setting->hash_config->copy_null);
 	hashfield->quotec       = setting->hash_config->copy_quotec[0];
 	hashfield->has_qoute    = false;
 	hashfield->hash_delim   = pg_strdup(setting->hash_config->hash_delim);
@@ -2152,6 +2362,7 @@ get_hash_field(const char *conninfo, TableInfo *table_info)
 	hashfield->hash_threads_num = setting->hash_config->hash_thread_num;
 	hashfield->text_delim        = pg_strdup(setting->hash_config->text_delim);
 	hashfield->copy_options = pg_strdup(setting->hash_config->copy_option);
+	hashfield->copy_null    = pg_strdup(setting->hash_config->copy_null);
 	hashfield->quotec       = setting->hash_config->copy_quotec[0];
 	hashfield->has_qoute    = false;
 	hashfield->hash_delim   = pg_strdup(setting->hash_config->hash_delim);
@@ -3166,6 +3377,10 @@ deep_copy(HashField *dest, HashField *src)
 	/* for copy_options */
 	dest->copy_options = pg_strdup(src->copy_options);
 
+	/* for copy_null */
+	if (src->copy_null != NULL)
+		dest->copy_null = pg_strdup(src->copy_null);
+
 	return;
 }
 
@@ -0,0 +1,386 @@
+/*
+ * bench_data - synthetic data files for adb_load benchmarks
+ *
+ * Writes rows of delimited text, the format adb_load reads, whose columns
+ * are described by a list of types. The first column is the distribution
+ * key, its values follow a Zipf distribution over a number of distinct keys
+ * to reproduce skewed loads. The same options and seed always give the same
+ * file, so loads of different releases or clusters can be compared.
+ *
+ * src/bin/adb_load/bench_data.c
+ */
+#include "postgres_fe.h"
+
+#include <limits.h>
+#include <math.h>
+
+#include "getopt_long.h"
+
+typedef enum BenchColumnType
+{
+	BENCH_INT,
+	BENCH_BIGINT,
+	BENCH_NUMERIC,
+	BENCH_TEXT,
+	BENCH_DATE,
+	BENCH_TIMESTAMP
+} BenchColumnType;
+
+typedef struct BenchColumn
+{
+	BenchColumnType type;
+	int			width;			/* characters of a text column */
+} BenchColumn;
+
+static const char *progname;
+static uint64 rand_state;
+
+static void usage(void);
+static int parse_columns(char *spec, BenchColumn **columns);
+static uint64 next_random(void);
+static double next_random_double(void);
+static double *build_key_cdf(int keys, double skew);
+static int next_key(double *cdf, int keys);
+static void print_ddl(FILE *out, char *table, BenchColumn *columns, int ncolumns);
+static void print_value(FILE *out, BenchColumn *column, int64 value);
+
+int
+main(int argc, char **argv)
+{
+	static struct option long_options[] = {
+		{"rows", required_argument, NULL, 'n'},
+		{"columns", required_argument, NULL, 'c'},
+		{"delimiter", required_argument, NULL, 'd'},
+		{"keys", required_argument, NULL, 'k'},
+		{"skew", required_argument, NULL, 's'},
+		{"seed", required_argument, NULL, 'S'},
+		{"output", required_argument, NULL, 'o'},
+		{"ddl", required_argument, NULL, 'D'},
+		{"help", no_argument, NULL, '?'},
+		{NULL, 0, NULL, 0}
+	};
+	int64		rows = 1000000;
+	char	   *spec = "int,int,numeric,text:32,date,timestamp";
+	char		delimiter = ',';
+	int			keys = 100000;
+	double		skew = 0;
+	uint64		seed = 1;
+	char	   *output = NULL;
+	char	   *ddl_table = NULL;
+	BenchColumn *columns;
+	int			ncolumns;
+	double	   *cdf;
+	FILE	   *out = stdout;
+	int64		row;
+	int			c;
+
+	progname = get_progname(argv[0]);
+
+	if (argc > 1 && (strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-?") == 0))
+	{
+		usage();
+		exit(0);
+	}
+
+	while ((c = getopt_long(argc, argv, "n:c:d:k:s:S:o:D:", long_options, NULL)) != -1)
+	{
+		switch (c)
+		{
+			case 'n':
+				rows = atol(optarg);
+				break;
+			case 'c':
+				spec = optarg;
+				break;
+			case 'd':
+				if (strcmp(optarg, "\\t") == 0)
+					delimiter = '\t';
+				else if (strlen(optarg) == 1)
+					delimiter = optarg[0];
+				else
+				{
+					fprintf(stderr, "%s: the delimiter must be a single character\n", progname);
+					exit(1);
+				}
+				break;
+			case 'k':
+				keys = atoi(optarg);
+				break;
+			case 's':
+				skew = atof(optarg);
+				break;
+			case 'S':
+				seed = strtoul(optarg, NULL, 10);
+				break;
+			case 'o':
+				output = optarg;
+				break;
+			case 'D':
+				ddl_table = optarg;
+				break;
+			default:
+				fprintf(stderr, "Try \"%s --help\" for more information.\n", progname);
+				exit(1);
+		}
+	}
+
+	if (rows < 0 || keys <= 0 || skew < 0)
+	{
+		fprintf(stderr, "%s: rows, keys and skew must not be negative\n", progname);
+		exit(1);
+	}
+
+	ncolumns = parse_columns(spec, &columns);
+
+	if (output != NULL && (out = fopen(output, "w")) == NULL)
+	{
+		fprintf(stderr, "%s: could not open file \"%s\": %s\n",
+				progname, output, strerror(errno));
+		exit(1);
+	}
+
+	if (ddl_table != NULL)
+	{
+		print_ddl(out, ddl_table, columns, ncolumns);
+		exit(0);
+	}
+
+	/* the state of xorshift must not be zero */
+	rand_state = seed * UINT64CONST(0x9E3779B97F4A7C15) + 1;
+	cdf = build_key_cdf(keys, skew);
+
+	for (row = 0; row < rows; row++)
+	{
+		int			i;
+
+		print_value(out, &columns[0], next_key(cdf, keys));
+		for (i = 1; i < ncolumns; i++)
+		{
+			fputc(delimiter, out);
+			print_value(out, &columns[i], (int64) (next_random() >> 1));
+		}
+		fputc('\n', out);
+	}
+
+	if (fflush(out) != 0 || (out != stdout && fclose(out) != 0))
+	{
+		fprintf(stderr, "%s: could not write data: %s\n", progname, strerror(errno));
+		exit(1);
+	}
+
+	return 0;
+}
+
+static void
+usage(void)
+{
+	printf(_("%s writes synthetic data files for adb_load benchmarks.\n\n"), progname);
+	printf(_("Usage:\n"));
+	printf(_("  %s [OPTION]...\n"), progname);
+	printf(_("\nOptions:\n"));
+	printf(_("  -n, --rows=NUM          rows to write (default: 1000000)\n"));
+	printf(_("  -c, --columns=LIST      column types separated by commas, among int, bigint,\n"
+			 "                          numeric, text[:WIDTH], date and timestamp, the first\n"
+			 "                          one is the distribution key\n"
+			 "                          (default: int,int,numeric,text:32,date,timestamp)\n"));
+	printf(_("  -d, --delimiter=CHAR    column delimiter, \\t for a tab (default: ,)\n"));
+	printf(_("  -k, --keys=NUM          distinct values of the key (default: 100000)\n"));
+	printf(_("  -s, --skew=NUM          Zipf exponent of the keys, 0 for uniform keys (default: 0)\n"));
+	printf(_("  -S, --seed=NUM          seed of the random values (default: 1)\n"));
+	printf(_("  -o, --output=FILE       write into FILE instead of the standard output\n"));
+	printf(_("  -D, --ddl=TABLE         write the CREATE TABLE statement of TABLE, then exit\n"));
+	printf(_("  -?, --help              show this help, then exit\n"));
+}
+
+static int
+parse_columns(char *spec, BenchColumn **columns)
+{
+	char	   *list = pg_strdup(spec);
+	char	   *type;
+	int			ncolumns = 0;
+
+	*columns = (BenchColumn *) pg_malloc0(sizeof(BenchColumn) * (strlen(spec) / 2 + 1));
+	for (type = strtok(list, ","); type != NULL; type = strtok(NULL, ","))
+	{
+		BenchColumn *column = &(*columns)[ncolumns++];
+
+		if (strcmp(type, "int") == 0)
+			column->type = BENCH_INT;
+		else if (strcmp(type, "bigint") == 0)
+			column->type = BENCH_BIGINT;
+		else if (strcmp(type, "numeric") == 0)
+			column->type = BENCH_NUMERIC;
+		else if (strcmp(type, "date") == 0)
+			column->type = BENCH_DATE;
+		else if (strcmp(type, "timestamp") == 0)
+			column->type = BENCH_TIMESTAMP;
+		else if (strncmp(type, "text", 4) == 0 &&
+				 (type[4] == '\0' || type[4] == ':'))
+		{
+			column->type = BENCH_TEXT;
+			column->width = type[4] == ':' ? atoi(type + 5) : 16;
+			if (column->width <= 0)
+			{
+				fprintf(stderr, "%s: invalid width of column \"%s\"\n", progname, type);
+				exit(1);
+			}
+		}
+		else
+		{
+			fprintf(stderr, "%s: unknown column type \"%s\"\n", progname, type);
+			exit(1);
+		}
+	}
+
+	if (ncolumns == 0)
+	{
+		fprintf(stderr, "%s: no column given\n", progname);
+		exit(1);
+	}
+
+	pg_free(list);
+	return ncolumns;
+}
+
+/* xorshift64*, the same on every platform unlike random() */
+static uint64
+next_random(void)
+{
+	rand_state ^= rand_state >> 12;
+	rand_state ^= rand_state << 25;
+	rand_state ^= rand_state >> 27;
+	return rand_state * UINT64CONST(2685821657736338717);
+}
+
+static double
+next_random_double(void)
+{
+	return (next_random() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*
+ * Cumulative distribution of the keys, key i having a weight of
+ * 1 / (i + 1) ^ skew. No table is needed for uniform keys.
+ */
+static double *
+build_key_cdf(int keys, double skew)
+{
+	double	   *cdf;
+	double		total = 0;
+	int			i;
+
+	if (skew == 0)
+		return NULL;
+
+	cdf = (double *) pg_malloc(sizeof(double) * keys);
+	for (i = 0; i < keys; i++)
+	{
+		total += 1.0 / pow(i + 1, skew);
+		cdf[i] = total;
+	}
+	for (i = 0; i < keys; i++)
+		cdf[i] /= total;
+
+	return cdf;
+}
+
+static int
+next_key(double *cdf, int keys)
+{
+	double		u = next_random_double();
+	int			low = 0;
+	int			high = keys - 1;
+
+	if (cdf == NULL)
+		return (int) (u * keys);
+
+	while (low < high)
+	{
+		int			mid = low + (high - low) / 2;
+
+		if (cdf[mid] < u)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
+static void
+print_ddl(FILE *out, char *table, BenchColumn *columns, int ncolumns)
+{
+	int			i;
+
+	fprintf(out, "CREATE TABLE %s (", table);
+	for (i = 0; i < ncolumns; i++)
+	{
+		const char *type = NULL;
+
+		switch (columns[i].type)
+		{
+			case BENCH_INT:
+				type = "int";
+				break;
+			case BENCH_BIGINT:
+				type = "bigint";
+				break;
+			case BENCH_NUMERIC:
+				type = "numeric(12,2)";
+				break;
+			case BENCH_TEXT:
+				type = "text";
+				break;
+			case BENCH_DATE:
+				type = "date";
+				break;
+			case BENCH_TIMESTAMP:
+				type = "timestamp";
+				break;
+		}
+		fprintf(out, "%sc%d %s", i == 0 ? "" : ", ", i + 1, type);
+	}
+	fprintf(out, ") DISTRIBUTE BY HASH (c1);\n");
+}
+
+static void
+print_value(FILE *out, BenchColumn *column, int64 value)
+{
+	static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+	int			i;
+
+	switch (column->type)
+	{
+		case BENCH_INT:
+			fprintf(out, "%d", (int) (value % INT_MAX));
+			break;
+		case BENCH_BIGINT:
+			fprintf(out, INT64_FORMAT, value);
+			break;
+		case BENCH_NUMERIC:
+			fprintf(out, "%d.%02d", (int) (value % 1000000000), (int) (value % 100));
+			break;
+		case BENCH_TEXT:
+			for (i = 0; i < column->width; i++)
+				fputc(alphabet[next_random() % (sizeof(alphabet) - 1)], out);
+			break;
+		case BENCH_DATE:
+			/* days of 2000 to 2029 */
+			{
+				int			day = (int) (value % (30 * 365));
+
+				fprintf(out, "%04d-%02d-%02d", 2000 + day / 365, day % 365 / 31 % 12 + 1, day % 28 + 1);
+			}
+			break;
+		case BENCH_TIMESTAMP:
+			{
+				int			day = (int) (value % (30 * 365));
+				int			second = (int) (value / 7 % 86400);
+
+				fprintf(out, "%04d-%02d-%02d %02d:%02d:%02d",
+						2000 + day / 365, day % 365 / 31 % 12 + 1, day % 28 + 1,
+						second / 3600, second / 60 % 60, second % 60);
+			}
+			break;
+	}
+}
@@ -0,0 +1,102 @@
+#!/bin/sh
+#
+# bench_load.sh - load a synthetic data file with adb_load and report the
+# rows per second of each stage
+#
+# The file is written by bench_data into the work directory, the table is
+# created again through the coordinator of the configuration file, then the
+# file is loaded in single file mode. The throughput comes from the JSON
+# report adb_load writes into log_summary.log.
+#
+# src/bin/adb_load/bench_load.sh
+#
+
+usage()
+{
+	cat <<EOF
+Usage: $0 -c CONFIG -d DBNAME -U USERNAME [OPTION]...
+
+  -c CONFIG    adb_load configuration file
+  -d DBNAME    database to load into
+  -U USERNAME  user loading the data
+  -t TABLE     table to create and load (default: adb_load_bench)
+  -n ROWS      rows of the data file (default: 1000000)
+  -C COLUMNS   column types given to bench_data (default: its own)
+  -k KEYS      distinct values of the key (default: 100000)
+  -s SKEW      Zipf exponent of the keys, 0 for uniform keys (default: 0)
+  -S SEED      seed of the data (default: 1)
+  -h THREADS   hash threads of adb_load (default: the configuration file)
+  -r THREADS   threads per datanode of adb_load (default: the configuration file)
+  -w DIR       work directory for the data and the logs (default: ./bench_load)
+EOF
+}
+
+bindir=`dirname "$0"`
+table=adb_load_bench
+rows=1000000
+columns=
+keys=100000
+skew=0
+seed=1
+workdir=./bench_load
+config=
+dbname=
+username=
+threads=
+
+while getopts "c:d:U:t:n:C:k:s:S:h:r:w:" opt; do
+	case $opt in
+		c) config=$OPTARG ;;
+		d) dbname=$OPTARG ;;
+		U) username=$OPTARG ;;
+		t) table=$OPTARG ;;
+		n) rows=$OPTARG ;;
+		C) columns=$OPTARG ;;
+		k) keys=$OPTARG ;;
+		s) skew=$OPTARG ;;
+		S) seed=$OPTARG ;;
+		h) threads="$threads -h $OPTARG" ;;
+		r) threads="$threads -r $OPTARG" ;;
+		w) workdir=$OPTARG ;;
+		*) usage; exit 1 ;;
+	esac
+done
+
+if [ -z "$config" ] || [ -z "$dbname" ] || [ -z "$username" ]; then
+	usage
+	exit 1
+fi
+
+# value of a KEY = value line of the configuration file, without quotes
+conf_value()
+{
+	sed -n "s/^[ 	]*$1[ 	]*=[ 	]*\"\{0,1\}\([^\"]*\)\"\{0,1\}[ 	]*$/\1/p" "$config" | tail -1
+}
+
+host=`conf_value COORDINATOR_IP`
+port=`conf_value COORDINATOR_PORT`
+delimiter=`conf_value COPY_DELIMITER`
+[ -n "$delimiter" ] || delimiter=,
+
+mkdir -p "$workdir" || exit 1
+data="$workdir/$table.data"
+rm -f "$workdir/log_summary.log"
+
+set -- -n "$rows" -k "$keys" -s "$skew" -S "$seed" -d "$delimiter"
+[ -n "$columns" ] && set -- "$@" -c "$columns"
+
+echo "writing $rows rows into $data"
+"$bindir/bench_data" "$@" -o "$data" || exit 1
+
+echo "creating table $table"
+{
+	echo "DROP TABLE IF EXISTS $table;"
+	"$bindir/bench_data" "$@" -D "$table"
+} | psql -X -q -v ON_ERROR_STOP=1 -h "$host" -p "$port" -d "$dbname" -U "$username" || exit 1
+
+echo "loading $data"
+"$bindir/adb_load" -c "$config" -d "$dbname" -U "$username" -g -f "$data" \
+	-t "$table" -o "$workdir" $threads || exit 1
+
+# the JSON report of the file, the error summary may follow it
+grep '^{"file": ' "$workdir/log_summary.log" | tail -1
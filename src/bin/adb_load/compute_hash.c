@@ -1,7 +1,9 @@
 #include <pthread.h>
+#include <limits.h>
 #include <unistd.h>
 
 #include "postgres_fe.h"
+#include "catalog/pg_type.h"
 #include "log_process_fd.h"
 #include "log_detail_fd.h"
 #include "read_producer.h"
@@ -81,7 +83,7 @@ static const unsigned int xc_mod_r[][6] =
  * hash_uint32() -- hash a 32-bit value
  */
 static uint32 hash_uint32(uint32 k);
-//static uint32 hash_any(register const unsigned char *k, register int keylen);
+static uint32 hash_any(register const unsigned char *k, register int keylen);
 static uint32 get_multi_field_hash_value(char *field_data);
 
 /* Get a bit mask of the bits set in non-uint32 aligned addresses */
@@ -127,6 +129,13 @@ static char * create_copy_string (char *func, int parameter_nums, char *copy_opt
 static LineBuffer * get_field_quote (char **fields, char *line, int * loc, char *text_delim, char quotec,
                                      char escapec, int size, ComputeThreadInfo * thrinfo);
 static void * hash_threadMain (void *argp);
+static void * local_hash_threadMain (void *argp);
+static bool can_hash_locally (HashComputeInfo *hash_info);
+static bool same_client_server_encoding (const char *conninfo);
+static bool compute_local_hash (char *value, HashField *hash_field, uint32 *hash_result);
+static bool parse_int_field (const char *str, int64 min, int64 max, int64 *result);
+static int unescape_text_field (char *str);
+static void put_line_to_output (ComputeThreadInfo *thrinfo, LineBuffer *lineBuffer, uint32 hash_result);
 static LineBuffer * package_field (LineBuffer *lineBuffer, ComputeThreadInfo *thrinfo);
 static PGconn * reconnect (ComputeThreadInfo *thrinfo);
 static void hash_write_error_message(ComputeThreadInfo *thrinfo,
@@ -144,7 +153,7 @@ static void create_filter_queue_file_fd(int redo_queue_total,
 
 
 static void put_copy_end_to_server(ComputeThreadInfo *thrinfo, MessageQueue *inner_queue);
-static bool input_queue_can_read(int fd, fd_set *set);
+static bool input_queue_can_read(MessageQueuePipe *queue, fd_set *set);
 static bool server_can_read(int fd, fd_set *set);
 static bool server_can_write(int fd, fd_set *set);
 static void get_data_from_server(PGconn *conn, char *read_buff, ComputeThreadInfo *thrinfo);
@@ -201,10 +210,73 @@ init_hash_compute(HashComputeInfo * hash_info)
 									hash_info->filter_queue_file_path);
 	}
 
+	hash_info->local_hash = can_hash_locally(hash_info);
+	if (hash_info->local_hash)
+		ADBLOADER_LOG(LOG_INFO, "[HASH][thread main ] distribution computed without the server");
+
 	res = adbLoader_hashThreadCreate(hash_info);
 	return res;
 }
 
+/*
+ * can_hash_locally
+ *
+ * Rows of a table distributed by the built-in hash or modulo of a single
+ * column of the types below are routed here, only the user-defined
+ * distribution functions and the other types need the server.
+ */
+static bool
+can_hash_locally(HashComputeInfo *hash_info)
+{
+	HashField *hash_field = hash_info->hash_field;
+
+	if (hash_field->field_nums != 1 ||
+		(hash_field->locator_type != HASH_LOCATOR_HASH &&
+		 hash_field->locator_type != HASH_LOCATOR_MODULO))
+		return false;
+
+	switch (hash_field->field_type[0])
+	{
+		case INT2OID:
+		case INT4OID:
+		case INT8OID:
+		case OIDOID:
+			return true;
+		case VARCHAR2OID:
+		case NVARCHAR2OID:
+		case VARCHAROID:
+		case TEXTOID:
+		case BPCHAROID:
+			/* the hash is computed on the bytes the server would get */
+			if (hash_field->locator_type != HASH_LOCATOR_HASH)
+				return false;
+			return same_client_server_encoding(hash_info->conninfo);
+		default:
+			return false;
+	}
+}
+
+static bool
+same_client_server_encoding(const char *conninfo)
+{
+	PGconn     *conn;
+	const char *client_encoding;
+	const char *server_encoding;
+	bool        same = false;
+
+	conn = PQconnectdb(conninfo);
+	if (PQstatus(conn) == CONNECTION_OK)
+	{
+		client_encoding = PQparameterStatus(conn, "client_encoding");
+		server_encoding = PQparameterStatus(conn, "server_encoding");
+		same = (client_encoding != NULL && server_encoding != NULL &&
+				strcmp(client_encoding, server_encoding) == 0);
+	}
+	PQfinish(conn);
+
+	return same;
+}
+
 static void
 create_filter_queue_file_fd(int redo_queue_total,
                             int *redo_queue_index,
@@ -437,6 +509,7 @@ adbLoader_hashThreadCreate(HashComputeInfo *hash_info)
 	for (i = 0; i < hash_info->hash_field->hash_threads_num; i++)
 	{
 		thread_info = (ComputeThreadInfo *)palloc0(sizeof(ComputeThreadInfo));
+		load_stats_init_counter(&thread_info->stats, LOAD_STAGE_HASH, -1);
 
 		/* copy func name */
 		thread_info->func_name = pg_strdup(hash_info->func_name);
@@ -502,7 +575,14 @@ adbLoader_hashThreadCreate(HashComputeInfo *hash_info)
 
 		thread_info->hash_field->quotec = hash_info->hash_field->quotec;
 		thread_info->hash_field->has_qoute = hash_info->hash_field->has_qoute;
-		thread_info->thr_startroutine = hash_threadMain;
+		thread_info->hash_field->locator_type = hash_info->hash_field->locator_type;
+		if (hash_info->hash_field->copy_null != NULL)
+			thread_info->hash_field->copy_null = pg_strdup(hash_info->hash_field->copy_null);
+		thread_info->local_hash = hash_info->local_hash;
+		if (thread_info->local_hash)
+			thread_info->thr_startroutine = local_hash_threadMain;
+		else
+			thread_info->thr_startroutine = hash_threadMain;
 		thread_info->state = THREAD_DEFAULT;
 		RunThreads->hs_threads[i] = thread_info;
 
@@ -538,6 +618,8 @@ adbLoader_ThreadCleanup(void * argp)
 	int flag = 0;
     int loc = 0;
 
+	load_stats_flush(&thrinfo->stats);
+
 	while (!mq_empty(inner_queue))
 	{
 		QueueElement * element;
@@ -678,11 +760,15 @@ server_can_read(int fd, fd_set *set)
 }
 
 static bool
-input_queue_can_read(int fd, fd_set *set)
+input_queue_can_read(MessageQueuePipe *queue, fd_set *set)
 {
     int res = 0;
 
-    res = FD_ISSET(fd, set);
+    /* the queue may have pointers already read from its pipe */
+    if (mq_pipe_has_cached(queue))
+        return true;
+
+    res = FD_ISSET(queue->fd[0], set);
     return (res > 0 ? true : false);
 }
 
@@ -902,7 +988,7 @@ hash_threadMain(void *argp)
 
         if (server_can_write(thrinfo->conn->sock, &write_fds))
         {
-            if (input_queue_can_read(input_queue->fd[0], &read_fds))
+            if (input_queue_can_read(input_queue, &read_fds))
             {
                 if (mq_full(inner_queue))
                 {
@@ -912,6 +998,7 @@ hash_threadMain(void *argp)
                 lineBuffer = mq_pipe_poll(input_queue);
                 if (lineBuffer != NULL)
                 {
+                    load_stats_count(&thrinfo->stats, lineBuffer->len);
                     prepare_hash_field(&lineBuffer, 1, thrinfo, inner_queue);
                 }
                 else // threads end flag
@@ -939,7 +1026,7 @@ hash_threadMain(void *argp)
 
         if (server_can_write(thrinfo->conn->sock, &write_fds) &&
             !server_can_read(thrinfo->conn->sock, &read_fds) &&
-            !input_queue_can_read(input_queue->fd[0], &read_fds))
+            !input_queue_can_read(input_queue, &read_fds))
         {
             FD_ZERO(&read_fds);
             FD_SET(thrinfo->conn->sock, &read_fds);
@@ -1006,6 +1093,86 @@ hash_threadMain(void *argp)
     return NULL;
 }
 
+/*
+ * local_hash_threadMain
+ *
+ * Same as hash_threadMain when the distribution is computed here: every
+ * line is routed as soon as it is read, without any server round-trip.
+ */
+static void *
+local_hash_threadMain(void *argp)
+{
+	ComputeThreadInfo  *thrinfo = (ComputeThreadInfo*) argp;
+	MessageQueue       *inner_queue = NULL;
+	LineBuffer         *lineBuffer = NULL;
+	LineBuffer         *hash_field = NULL;
+	uint32              hash_result;
+
+	/* stays empty, adbLoader_ThreadCleanup expects it */
+	inner_queue = (MessageQueue*)palloc0(sizeof(MessageQueue));
+	mq_init(inner_queue, THREAD_QUEUE_SIZE, "inner_queue");
+	thrinfo->inner_queue = inner_queue;
+
+	for (;;)
+	{
+		if (thrinfo->exit)
+		{
+			ADBLOADER_LOG(LOG_INFO, "[HASH]hash thread : %lu exit", (unsigned long)thrinfo->thread_id);
+			thrinfo->state = THREAD_EXIT_BY_OTHERS;
+			pthread_exit(thrinfo);
+		}
+
+		lineBuffer = mq_pipe_poll(thrinfo->input_queue);
+		if (lineBuffer == NULL) /* threads end flag */
+		{
+			load_stats_flush(&thrinfo->stats);
+			ADBLOADER_LOG(LOG_INFO,
+						"[HASH][thread id : %lu ] file is complete", (unsigned long)thrinfo->thread_id);
+			if (thrinfo->happen_error)
+				thrinfo->state = THREAD_HAPPEN_ERROR_CONTINUE_AND_DEAL_COMPLETE;
+			else
+				thrinfo->state = THREAD_DEAL_COMPLETE;
+			pthread_exit(thrinfo);
+		}
+
+		load_stats_count(&thrinfo->stats, lineBuffer->len);
+
+		if (thrinfo->copy_cmd_comment &&
+			is_comment_line(lineBuffer->data, thrinfo->copy_cmd_comment_str))
+		{
+			release_linebuf(lineBuffer);
+			continue;
+		}
+
+		hash_field = package_field(lineBuffer, thrinfo);
+		if (hash_field == NULL)
+		{
+			hash_write_error_message(thrinfo,
+									"extract hash field error",
+									"extract hash field error", lineBuffer->fileline,
+									lineBuffer->data, FALSE);
+			release_linebuf(lineBuffer);
+			continue;
+		}
+
+		if (compute_local_hash(hash_field->data, thrinfo->hash_field, &hash_result))
+			put_line_to_output(thrinfo, lineBuffer, hash_result);
+		else
+		{
+			thrinfo->happen_error = true;
+			hash_write_error_message(thrinfo,
+									"get hash restult error, can't get hash",
+									"invalid input syntax for the distribution column",
+									lineBuffer->fileline, lineBuffer->data, false);
+			save_to_log_summary(ERRCODE_COMPUTE_HASH, lineBuffer->data);
+			release_linebuf(lineBuffer);
+		}
+		release_linebuf(hash_field);
+	}
+
+	return NULL;
+}
+
 static void
 prepare_hash_field (LineBuffer **element_batch, int size,
 					ComputeThreadInfo * thrinfo,  MessageQueue *inner_queue)
@@ -1106,9 +1273,6 @@ package_field (LineBuffer *lineBuffer, ComputeThreadInfo * thrinfo)
 						thrinfo->hash_field->field_nums,
 						thrinfo);
 
-	ADBLOADER_LOG(LOG_DEBUG,
-		"[HASH][thread id : %lu ] get field : %s", (unsigned long)thrinfo->thread_id, buf->data);
-
 	if(buf == NULL)
 	{
 		ADBLOADER_LOG(LOG_DEBUG, "[HASH][thread id: %lu ] get hash field failed : %s ",
@@ -1118,6 +1282,9 @@ package_field (LineBuffer *lineBuffer, ComputeThreadInfo * thrinfo)
 		return NULL;
 	}
 
+	ADBLOADER_LOG(LOG_DEBUG,
+		"[HASH][thread id : %lu ] get field : %s", (unsigned long)thrinfo->thread_id, buf->data);
+
 	pfree(line);
 	line = NULL;
 	free_buff(fields, thrinfo->hash_field->field_nums);
@@ -1449,30 +1616,9 @@ get_data_from_server(PGconn *conn, char *read_buff, ComputeThreadInfo *thrinfo)
 			/*default hash or user define hash(field num = 1)*/
 			if (thrinfo->hash_field->field_nums == 1)
 			{
-				int modulo_datanode;
-				int module_queue;
-				uint32 hash_value;
-				int output_queue_flag;
-
 				Assert(inner_element->lineBuffer->lineno == send_flag);
 
-				/* calc which datanode to send */
-				modulo_datanode = calc_send_datanode(hash_result, thrinfo->hash_field);
-				hash_value = hash_uint32(labs(hash_result));
-				module_queue = compute_hash_modulo(labs(hash_value), thrinfo->threads_num_per_datanode);
-				output_queue_flag = modulo_datanode *thrinfo->threads_num_per_datanode + module_queue;
-
-				/* put linebuf to outqueue */
-				mq_pipe_put(thrinfo->output_queue[output_queue_flag], inner_element->lineBuffer);
-				ADBLOADER_LOG(LOG_DEBUG,
-								"[HASH][thread id : %lu ]TO output_queue num:%s ,hash_result: %u, modulo_datanode:%d, hash_value:%u, module_queue:%d, line data : %s\n",
-								(unsigned long)thrinfo->thread_id,
-								thrinfo->output_queue[output_queue_flag]->name,
-								hash_result,
-								modulo_datanode,
-								hash_value,
-								module_queue,
-								inner_element->lineBuffer->data);
+				put_line_to_output(thrinfo, inner_element->lineBuffer, hash_result);
 				inner_element->lineBuffer = NULL;
 				pfree(inner_element);
 			}
@@ -1516,48 +1662,9 @@ get_data_from_server(PGconn *conn, char *read_buff, ComputeThreadInfo *thrinfo)
 		{
 			if (thrinfo->hash_field->field_nums == 1)
 			{
-				int modulo_datanode;
-				int module_queue;
-				uint32 hash_value;
-				int output_queue_flag;
-
 				Assert(inner_element->lineBuffer->lineno == send_flag);
 
-				/* calc which datanode to send */
-				modulo_datanode = calc_send_datanode(hash_result, thrinfo->hash_field);
-				hash_value = hash_uint32(labs(hash_result));
-				module_queue = compute_hash_modulo(labs(hash_value), thrinfo->threads_num_per_datanode);
-				output_queue_flag = modulo_datanode *thrinfo->threads_num_per_datanode + module_queue;
-
-				need_redo_queue = check_need_redo_queue(thrinfo->redo_queue_total,
-														thrinfo->redo_queue_index,
-														output_queue_flag);
-				/* just redo queue*/
-				if (need_redo_queue && !thrinfo->filter_queue_file)
-				{
-					mq_pipe_put(thrinfo->output_queue[output_queue_flag], inner_element->lineBuffer);
-					ADBLOADER_LOG(LOG_DEBUG,
-								"[HASH][thread id : %lu ] line data : %s, TO output_queue num:%s \n",
-								(unsigned long)thrinfo->thread_id, inner_element->lineBuffer->data, thrinfo->output_queue[output_queue_flag]->name);
-				}
-
-                /* just get filter queue file */
-                if (need_redo_queue && thrinfo->filter_queue_file)
-                {
-                    int index = 0;
-                    index = get_filter_queue_file_fd_index(thrinfo->redo_queue_total,
-                                                            thrinfo->redo_queue_index,
-                                                            output_queue_flag);
-                    if (index == -1)
-                    {
-
-                    }
-
-                    fwrite(inner_element->lineBuffer->data, strlen(inner_element->lineBuffer->data),
-                          1, filter_queue_file_fd[index]);
-
-                }
-
+				put_line_to_output(thrinfo, inner_element->lineBuffer, hash_result);
 				inner_element->lineBuffer = NULL;
 				pfree(inner_element);
 			}
@@ -1828,6 +1935,255 @@ restart_hash_stream(ComputeThreadInfo *thrinfo)
 	return;
 }
 
+/*
+ * put_line_to_output
+ *
+ * Send a line whose single distribution column gave "hash_result" to the
+ * output queue of its datanode, or to the filter queue file.
+ */
+static void
+put_line_to_output(ComputeThreadInfo *thrinfo, LineBuffer *lineBuffer, uint32 hash_result)
+{
+	int    modulo_datanode;
+	int    module_queue;
+	uint32 hash_value;
+	int    output_queue_flag;
+	bool   need_redo_queue;
+
+	/* calc which datanode to send */
+	modulo_datanode = calc_send_datanode(hash_result, thrinfo->hash_field);
+	hash_value = hash_uint32(labs(hash_result));
+	module_queue = compute_hash_modulo(labs(hash_value), thrinfo->threads_num_per_datanode);
+	output_queue_flag = modulo_datanode *thrinfo->threads_num_per_datanode + module_queue;
+
+	if (!thrinfo->redo_queue)
+	{
+		/* put linebuf to outqueue */
+		mq_pipe_put(thrinfo->output_queue[output_queue_flag], lineBuffer);
+		ADBLOADER_LOG(LOG_DEBUG,
+						"[HASH][thread id : %lu ]TO output_queue num:%s ,hash_result: %u, modulo_datanode:%d, hash_value:%u, module_queue:%d, line data : %s\n",
+						(unsigned long)thrinfo->thread_id,
+						thrinfo->output_queue[output_queue_flag]->name,
+						hash_result,
+						modulo_datanode,
+						hash_value,
+						module_queue,
+						lineBuffer->data);
+		return;
+	}
+
+	need_redo_queue = check_need_redo_queue(thrinfo->redo_queue_total,
+											thrinfo->redo_queue_index,
+											output_queue_flag);
+	/* just redo queue*/
+	if (need_redo_queue && !thrinfo->filter_queue_file)
+	{
+		mq_pipe_put(thrinfo->output_queue[output_queue_flag], lineBuffer);
+		ADBLOADER_LOG(LOG_DEBUG,
+					"[HASH][thread id : %lu ] line data : %s, TO output_queue num:%s \n",
+					(unsigned long)thrinfo->thread_id, lineBuffer->data, thrinfo->output_queue[output_queue_flag]->name);
+		return;
+	}
+
+	/* just get filter queue file */
+	if (need_redo_queue && thrinfo->filter_queue_file)
+	{
+		int index = 0;
+		index = get_filter_queue_file_fd_index(thrinfo->redo_queue_total,
+												thrinfo->redo_queue_index,
+												output_queue_flag);
+		if (index != -1)
+			fwrite(lineBuffer->data, strlen(lineBuffer->data),
+				  1, filter_queue_file_fd[index]);
+	}
+
+	release_linebuf(lineBuffer);
+}
+
+/*
+ * compute_local_hash
+ *
+ * Give in "hash_result" what the server functions used by the built-in
+ * distributions return for the text form of "value", as it is read by
+ * COPY. Returns false if "value" is not a valid input of the column type.
+ */
+static bool
+compute_local_hash(char *value, HashField *hash_field, uint32 *hash_result)
+{
+	Oid    type = hash_field->field_type[0];
+	bool   modulo = (hash_field->locator_type == HASH_LOCATOR_MODULO);
+	int64  val;
+	int    len;
+
+	/* a NULL key goes to the first node */
+	if (hash_field->copy_null != NULL && strcmp(value, hash_field->copy_null) == 0)
+	{
+		*hash_result = 0;
+		return true;
+	}
+
+	switch (type)
+	{
+		case INT2OID:
+			if (!parse_int_field(value, SHRT_MIN, SHRT_MAX, &val))
+				return false;
+			*hash_result = modulo ? (uint32) labs((long) val) : hash_uint32((uint32) (int32) val);
+			return true;
+		case INT4OID:
+			if (!parse_int_field(value, INT_MIN, INT_MAX, &val))
+				return false;
+			*hash_result = modulo ? (uint32) labs((long) val) : hash_uint32((uint32) (int32) val);
+			return true;
+		case OIDOID:
+			/* oidin also takes the negative values */
+			if (!parse_int_field(value, INT_MIN, UINT_MAX, &val))
+				return false;
+			*hash_result = modulo ? (uint32) val : hash_uint32((uint32) val);
+			return true;
+		case INT8OID:
+			if (!parse_int_field(value, -INT64CONST(0x7FFFFFFFFFFFFFFF) - 1, INT64CONST(0x7FFFFFFFFFFFFFFF), &val))
+				return false;
+			if (modulo)
+				*hash_result = (uint32) labs((long) val);
+			else
+			{
+				uint32 lohalf = (uint32) val;
+				uint32 hihalf = (uint32) (val >> 32);
+
+				/* same folding as hashint8 */
+				lohalf ^= (val >= 0) ? hihalf : ~hihalf;
+				*hash_result = hash_uint32(lohalf);
+			}
+			return true;
+		case BPCHAROID:
+			len = unescape_text_field(value);
+			/* hashbpchar ignores the trailing spaces */
+			while (len > 0 && value[len - 1] == ' ')
+				len--;
+			*hash_result = hash_any((unsigned char *) value, len);
+			return true;
+		default:
+			len = unescape_text_field(value);
+			*hash_result = hash_any((unsigned char *) value, len);
+			return true;
+	}
+}
+
+/*
+ * parse_int_field
+ *
+ * Read an integer like the input functions of the integer types do:
+ * surrounding spaces are allowed, nothing else.
+ */
+static bool
+parse_int_field(const char *str, int64 min, int64 max, int64 *result)
+{
+	char      *end;
+	long long  val;
+
+	while (*str != '\0' && isspace((unsigned char) *str))
+		str++;
+	if (*str == '\0')
+		return false;
+
+	errno = 0;
+	val = strtoll(str, &end, 10);
+	if (end == str || errno == ERANGE)
+		return false;
+
+	while (*end != '\0' && isspace((unsigned char) *end))
+		end++;
+	if (*end != '\0')
+		return false;
+
+	if (val < min || val > max)
+		return false;
+
+	*result = (int64) val;
+	return true;
+}
+
+/*
+ * unescape_text_field
+ *
+ * Replace in place the backslash sequences of the COPY text format by the
+ * bytes they stand for, and return the length of the result.
+ */
+static int
+unescape_text_field(char *str)
+{
+	char *src = str;
+	char *dst = str;
+
+	while (*src != '\0')
+	{
+		char c = *src++;
+
+		if (c == '\\' && *src != '\0')
+		{
+			c = *src++;
+			switch (c)
+			{
+				case '0': case '1': case '2': case '3':
+				case '4': case '5': case '6': case '7':
+					{
+						int val = c - '0';
+
+						if (*src >= '0' && *src <= '7')
+						{
+							val = (val << 3) + (*src++ - '0');
+							if (*src >= '0' && *src <= '7')
+								val = (val << 3) + (*src++ - '0');
+						}
+						c = val & 0377;
+					}
+					break;
+				case 'x':
+					if (isxdigit((unsigned char) *src))
+					{
+						int val = 0;
+						int digits;
+
+						for (digits = 0; digits < 2 && isxdigit((unsigned char) *src); digits++)
+						{
+							char h = *src++;
+
+							val = (val << 4) + (isdigit((unsigned char) h) ? h - '0' :
+												tolower((unsigned char) h) - 'a' + 10);
+						}
+						c = val & 0xff;
+					}
+					break;
+				case 'b':
+					c = '\b';
+					break;
+				case 'f':
+					c = '\f';
+					break;
+				case 'n':
+					c = '\n';
+					break;
+				case 'r':
+					c = '\r';
+					break;
+				case 't':
+					c = '\t';
+					break;
+				case 'v':
+					c = '\v';
+					break;
+				default:
+					/* any other character stands for itself */
+					break;
+			}
+		}
+		*dst++ = c;
+	}
+	*dst = '\0';
+
+	return dst - str;
+}
+
 static int
 calc_send_datanode (uint32 hash, HashField *hash_field)
 {
@@ -2025,6 +2381,106 @@ static uint32 hash_uint32(uint32 k)
 	return (c);
 }
 
+/*
+ * hash_any() -- hash a variable-length key into a 32-bit value
+ *
+ * Same result as the server function, which reads whole words when the key
+ * is aligned but gives the same value as this byte-wise code.
+ */
+static uint32
+hash_any(register const unsigned char *k, register int keylen)
+{
+	register uint32 a,
+				b,
+				c,
+				len;
+
+	/* Set up the internal state */
+	len = keylen;
+	a = b = c = 0x9e3779b9 + len + 3923095;
+
+	/* handle most of the key */
+	while (len >= 12)
+	{
+#ifdef WORDS_BIGENDIAN
+		a += (k[3] + ((uint32) k[2] << 8) + ((uint32) k[1] << 16) + ((uint32) k[0] << 24));
+		b += (k[7] + ((uint32) k[6] << 8) + ((uint32) k[5] << 16) + ((uint32) k[4] << 24));
+		c += (k[11] + ((uint32) k[10] << 8) + ((uint32) k[9] << 16) + ((uint32) k[8] << 24));
+#else							/* !WORDS_BIGENDIAN */
+		a += (k[0] + ((uint32) k[1] << 8) + ((uint32) k[2] << 16) + ((uint32) k[3] << 24));
+		b += (k[4] + ((uint32) k[5] << 8) + ((uint32) k[6] << 16) + ((uint32) k[7] << 24));
+		c += (k[8] + ((uint32) k[9] << 8) + ((uint32) k[10] << 16) + ((uint32) k[11] << 24));
+#endif   /* WORDS_BIGENDIAN */
+		mix(a, b, c);
+		k += 12;
+		len -= 12;
+	}
+
+	/* handle the last 11 bytes */
+#ifdef WORDS_BIGENDIAN
+	switch (len)			/* all the case statements fall through */
+	{
+		case 11:
+			c += ((uint32) k[10] << 8);
+		case 10:
+			c += ((uint32) k[9] << 16);
+		case 9:
+			c += ((uint32) k[8] << 24);
+			/* the lowest byte of c is reserved for the length */
+		case 8:
+			b += k[7];
+		case 7:
+			b += ((uint32) k[6] << 8);
+		case 6:
+			b += ((uint32) k[5] << 16);
+		case 5:
+			b += ((uint32) k[4] << 24);
+		case 4:
+			a += k[3];
+		case 3:
+			a += ((uint32) k[2] << 8);
+		case 2:
+			a += ((uint32) k[1] << 16);
+		case 1:
+			a += ((uint32) k[0] << 24);
+			/* case 0: nothing left to add */
+	}
+#else							/* !WORDS_BIGENDIAN */
+	switch (len)			/* all the case statements fall through */
+	{
+		case 11:
+			c += ((uint32) k[10] << 24);
+		case 10:
+			c += ((uint32) k[9] << 16);
+		case 9:
+			c += ((uint32) k[8] << 8);
+			/* the lowest byte of c is reserved for the length */
+		case 8:
+			b += ((uint32) k[7] << 24);
+		case 7:
+			b += ((uint32) k[6] << 16);
+		case 6:
+			b += ((uint32) k[5] << 8);
+		case 5:
+			b += k[4];
+		case 4:
+			a += ((uint32) k[3] << 24);
+		case 3:
+			a += ((uint32) k[2] << 16);
+		case 2:
+			a += ((uint32) k[1] << 8);
+		case 1:
+			a += k[0];
+			/* case 0: nothing left to add */
+	}
+#endif   /* WORDS_BIGENDIAN */
+
+	adb_load_final(a, b, c);
+
+	/* report the result */
+	return c;
+}
+
 static bool
 is_comment_line(char *line_data, char *comment_str)
 {
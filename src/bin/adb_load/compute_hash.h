@@ -5,6 +5,7 @@
 
 #include "msg_queue.h"
 #include "msg_queue_pipe.h"
+#include "load_stats.h"
 
 typedef pthread_t HashThreadID;
 
@@ -24,6 +25,8 @@ typedef struct HashField
 	bool  has_qoute;
 	char  escapec;
 	bool  has_escape;
+	char  locator_type;  /* pclocatortype of a built-in distribution, '\0' for a user-defined function */
+	char *copy_null;     /* null string of the input */
 } HashField;
 
 typedef struct HashComputeInfo
@@ -50,6 +53,7 @@ typedef struct HashComputeInfo
 	char                *copy_cmd_comment_str;
 
 	HashField           *hash_field;
+	bool                 local_hash;   /* hash computed here, see can_hash_locally */
 } HashComputeInfo;
 
 typedef enum ThreadWorkState
@@ -103,6 +107,8 @@ typedef struct ComputeThreadInfo
 	bool               exit;
 
 	bool               happen_error;
+	bool               local_hash;
+	LoadStatsCounter   stats;
 	void              *(* thr_startroutine)(void *); /* thread start function */
 } ComputeThreadInfo;
 
@@ -117,6 +123,10 @@ typedef struct HashThreads
 #define HASH_COMPUTE_ERROR     0
 #define HASH_COMPUTE_OK        1
 
+/* HashField.locator_type, as in pgxc_class */
+#define HASH_LOCATOR_HASH      'H'
+#define HASH_LOCATOR_MODULO    'M'
+
 extern int init_hash_compute(HashComputeInfo * hash_info);
 
 /**
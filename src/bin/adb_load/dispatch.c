@@ -2,6 +2,7 @@
 
 #include <pthread.h>
 #include <unistd.h>
+#include <time.h>
 
 #include "log_process_fd.h"
 #include "log_detail_fd.h"
@@ -44,6 +45,7 @@ static char *g_start_cmd = NULL;
 static int error_message_max;
 static char *get_linevalue_from_PQerrormsg(char *pqerrormsg);
 static bool rollback_in_PQerrormsg(char *PQerrormsg);
+static void dispatch_notice_receiver(void *arg, const PGresult *res);
 static int dispatch_threadsCreate(DispatchInfo *dispatch);
 static void *dispatch_threadMain (void *argp);
 static void *dispatch_ThreadMainWrapper (void *argp);
@@ -61,8 +63,10 @@ static void dispatch_write_error_message(DispatchThreadInfo	*thrinfo, char * mes
 
 static bool datanode_can_write(int fd, fd_set *set);
 static bool datanode_can_read(int fd, fd_set *set);
-static bool output_queue_can_read(int fd, fd_set *set);
+static bool output_queue_can_read(MessageQueuePipe *queue, fd_set *set);
 static void put_data_to_datanode(DispatchThreadInfo *thrinfo, LineBuffer *lineBuffer, MessageQueuePipe *output_queue);
+static void send_copy_data(DispatchThreadInfo *thrinfo, char *data, int len, int fileline);
+static void flush_copy_buffer(DispatchThreadInfo *thrinfo);
 static void put_copy_end_to_datanode(DispatchThreadInfo *thrinfo);
 static int  get_data_from_datanode(DispatchThreadInfo *thrinfo);
 static void reconnect_agtm_and_datanode(DispatchThreadInfo *thrinfo);
@@ -74,6 +78,10 @@ static void put_end_to_datanode(DispatchThreadInfo *thrinfo);
 static void put_rollback_to_datanode(DispatchThreadInfo *thrinfo);
 static void save_error_message(PGresult *res);
 
+/* size of the blocks of lines sent by COPY, and most seconds they wait */
+#define DISPATCH_COPY_BUFFER_SIZE    (256 * 1024)
+#define DISPATCH_FLUSH_INTERVAL      1
+
 #define FOR_GET_DATA_FROM_OUTPUT_QUEUE()     \
 for (;;)                                     \
 {                                            \
@@ -292,6 +300,7 @@ dispatch_threadsCreate(DispatchInfo  *dispatch)
 			}
 
 			thrinfo->thr_startroutine = dispatch_threadMain;
+			load_stats_init_counter(&thrinfo->stats, LOAD_STAGE_DISPATCH, i);
 
 			thrinfo->output_queue = dispatch->output_queue[i * dispatch->threads_num_per_datanode + j];
 			if ((pthread_create(&thrinfo->thread_id, NULL, dispatch_ThreadMainWrapper, thrinfo)) < 0)
@@ -344,33 +353,86 @@ datanode_can_read(int fd, fd_set *set)
 }
 
 static bool
-output_queue_can_read(int fd, fd_set *set)
+output_queue_can_read(MessageQueuePipe *queue, fd_set *set)
 {
 	int res = 0;
-	res = FD_ISSET(fd, set);
+
+	/* the queue may have pointers already read from its pipe */
+	if (mq_pipe_has_cached(queue))
+		return true;
+
+	res = FD_ISSET(queue->fd[0], set);
 	return (res > 0 ? true : false);
 }
 
+/*
+ * Lines are gathered in copy_buffer and sent by DISPATCH_COPY_BUFFER_SIZE
+ * blocks. The buffer is also sent when the output queue runs dry and at
+ * least every DISPATCH_FLUSH_INTERVAL seconds, so errors of the datanode
+ * still come back quickly.
+ */
 static void
 put_data_to_datanode(DispatchThreadInfo *thrinfo, LineBuffer *lineBuffer, MessageQueuePipe *output_queue)
 {
-	int send = 0;
-
-	/* send data to ADB*/
-	send = PQputCopyData(thrinfo->conn, lineBuffer->data, lineBuffer->len);
-
 	ADBLOADER_LOG(LOG_DEBUG,
 		"[DISPATCH][thread id : %ld ] send data: %s from queue num:%s \n",
 		thrinfo->thread_id, lineBuffer->data, output_queue->name);
 
+	if (thrinfo->copy_buffer_len > 0 &&
+		thrinfo->copy_buffer_len + lineBuffer->len > DISPATCH_COPY_BUFFER_SIZE)
+		flush_copy_buffer(thrinfo);
+
+	if (lineBuffer->len >= DISPATCH_COPY_BUFFER_SIZE)
+	{
+		send_copy_data(thrinfo, lineBuffer->data, lineBuffer->len, lineBuffer->fileline);
+		thrinfo->last_flush = time(NULL);
+	}
+	else
+	{
+		if (thrinfo->copy_buffer_len == 0)
+			thrinfo->copy_buffer_line = lineBuffer->fileline;
+		memcpy(thrinfo->copy_buffer + thrinfo->copy_buffer_len, lineBuffer->data, lineBuffer->len);
+		thrinfo->copy_buffer_len += lineBuffer->len;
+	}
+
 	if (process_bar)
 		thrinfo->send_total++;
+	load_stats_count(&thrinfo->stats, lineBuffer->len);
+
+	release_linebuf(lineBuffer);
+
+	if (time(NULL) - thrinfo->last_flush >= DISPATCH_FLUSH_INTERVAL)
+		flush_copy_buffer(thrinfo);
+
+	return;
+}
+
+static void
+flush_copy_buffer(DispatchThreadInfo *thrinfo)
+{
+	if (thrinfo->copy_buffer_len > 0)
+	{
+		send_copy_data(thrinfo, thrinfo->copy_buffer, thrinfo->copy_buffer_len,
+						thrinfo->copy_buffer_line);
+		thrinfo->copy_buffer_len = 0;
+	}
+
+	thrinfo->last_flush = time(NULL);
+}
+
+static void
+send_copy_data(DispatchThreadInfo *thrinfo, char *data, int len, int fileline)
+{
+	int send = 0;
+
+	/* send data to ADB*/
+	send = PQputCopyData(thrinfo->conn, data, len);
 
 	if (send < 0)
 	{
 		ADBLOADER_LOG(LOG_ERROR,
-		"[DISPATCH][thread id : %ld ] send copy data error : %s ",
-			thrinfo->thread_id, lineBuffer->data);
+		"[DISPATCH][thread id : %ld ] send copy data error from line %d",
+			thrinfo->thread_id, fileline);
 
 		ADBLOADER_LOG(LOG_ERROR,
 					"[DISPATCH][thread id : %ld ] send copy data error message: %s ",
@@ -381,27 +443,26 @@ put_data_to_datanode(DispatchThreadInfo *thrinfo, LineBuffer *lineBuffer, Messag
 		{
 			/* reconnect */
 			reconnect_agtm_and_datanode(thrinfo);
-			send = PQputCopyData(thrinfo->conn, lineBuffer->data, lineBuffer->len);
+			send = PQputCopyData(thrinfo->conn, data, len);
 			if (send < 0)
 			{
 				ADBLOADER_LOG(LOG_ERROR,
-							"[DISPATCH][thread id : %ld ] send copy data error again : %s ",
-							thrinfo->thread_id, lineBuffer->data);
+							"[DISPATCH][thread id : %ld ] send copy data error again from line %d",
+							thrinfo->thread_id, fileline);
 				PQfinish(thrinfo->conn);
 				thrinfo->conn = NULL;
 				thrinfo->state = DISPATCH_THREAD_SEND_ERROR;
 
 				dispatch_write_error_message(thrinfo,
 											"PQputCopyData error",
-											PQerrorMessage(thrinfo->conn), lineBuffer->fileline,
-											lineBuffer->data, true);
+											PQerrorMessage(thrinfo->conn), fileline,
+											NULL, true);
+				return;
 			}
 		}
 	}
 
-	/* flush data every time to get error data quickly */
 	PQflush(thrinfo->conn);
-	release_linebuf(lineBuffer);
 
 	return;
 }
@@ -676,6 +737,9 @@ dispatch_threadMain (void *argp)
 	Assert(thrinfo->conninfo_datanode != NULL);
 
 	output_queue = thrinfo->output_queue;
+	thrinfo->copy_buffer = (char *)palloc(DISPATCH_COPY_BUFFER_SIZE);
+	thrinfo->copy_buffer_len = 0;
+	thrinfo->last_flush = time(NULL);
 
 	//build_communicate_agtm_and_datanode(thrinfo);
     connect_agtm_and_datanode(thrinfo);
@@ -746,7 +810,7 @@ dispatch_threadMain (void *argp)
 
 		if (datanode_can_write(thrinfo->conn->sock, &write_fds))
 		{
-			if (output_queue_can_read(output_queue->fd[0], &read_fds))
+			if (output_queue_can_read(output_queue, &read_fds))
 			{
 				lineBuffer = mq_pipe_poll(output_queue);
 				if (lineBuffer != NULL)
@@ -755,6 +819,7 @@ dispatch_threadMain (void *argp)
 				}
 				else // threads end flag
 				{
+					flush_copy_buffer(thrinfo);
 					put_copy_end_to_datanode(thrinfo);
 				}
 			}
@@ -772,8 +837,11 @@ dispatch_threadMain (void *argp)
 
 		if (datanode_can_write(thrinfo->conn->sock, &write_fds) &&
 			!datanode_can_read(thrinfo->conn->sock, &read_fds) &&
-			!output_queue_can_read(output_queue->fd[0], &read_fds))
+			!output_queue_can_read(output_queue, &read_fds))
 		{
+			/* nothing more to send for now, do not keep lines waiting */
+			flush_copy_buffer(thrinfo);
+
 			FD_ZERO(&read_fds);
 			FD_SET(thrinfo->conn->sock, &read_fds);
 			FD_SET(output_queue->fd[0], &read_fds);
@@ -851,6 +919,8 @@ dispatch_ThreadCleanup (void * argp)
 
 	DispatchThreadInfo  *thrinfo = (DispatchThreadInfo*) argp;
 
+	load_stats_flush(&thrinfo->stats);
+
 	pthread_mutex_lock(&DispatchThreadsRun->mutex);
 	for (flag = 0; flag < DispatchThreadsRun->send_thread_count; flag++)
 	{
@@ -893,6 +963,9 @@ dispatch_ThreadCleanup (void * argp)
 	pg_free(thrinfo->copy_options);
 	thrinfo->copy_options = NULL;
 
+	pg_free(thrinfo->copy_buffer);
+	thrinfo->copy_buffer = NULL;
+
 	ADBLOADER_LOG(LOG_INFO,
 	"[DISPATCH][thread id : %ld ] thread exit, total threads is : %d, current thread number: %d, current exit thread number: %d, state :%s",
 	thrinfo->thread_id, DispatchThreadsRun->send_thread_count, current_run_thread,
@@ -1050,9 +1123,44 @@ connect_datanode(DispatchThreadInfo *thrinfo)
 		return false;
 	}
 
+	PQsetNoticeReceiver(thrinfo->conn, dispatch_notice_receiver, thrinfo);
+
 	return true;
 }
 
+/*
+ * With COPY_ERROR_LIMIT, the datanode skips the bad rows and reports each by
+ * a warning, whose SQLSTATE is a data exception and whose context gives the
+ * line. Such rows go to the error summary like the ones which make a COPY
+ * fail, without restarting the COPY.
+ */
+static void
+dispatch_notice_receiver(void *arg, const PGresult *res)
+{
+	DispatchThreadInfo *thrinfo = (DispatchThreadInfo *) arg;
+	char *error_code = PQresultErrorField(res, PG_DIAG_SQLSTATE);
+	char *error_context = PQresultErrorField(res, PG_DIAG_CONTEXT);
+	char *line_data = NULL;
+
+	if (error_code == NULL || strncmp(error_code, "22", 2) != 0 ||
+		error_context == NULL || strstr(error_context, "COPY ") == NULL)
+	{
+		ADBLOADER_LOG(LOG_INFO,
+					"[DISPATCH][thread id : %ld ] message from datanode: %s",
+					thrinfo->thread_id, PQresultErrorMessage(res));
+		return;
+	}
+
+	ADBLOADER_LOG(LOG_WARN,
+				"[DISPATCH][thread id : %ld ] datanode skipped a row: %s",
+				thrinfo->thread_id, PQresultErrorMessage(res));
+
+	line_data = get_linevalue_from_PQerrormsg(error_context);
+	save_to_log_summary(error_code, line_data != NULL ? line_data : " ");
+	if (line_data != NULL)
+		pfree(line_data);
+}
+
 static bool
 connect_agtm(DispatchThreadInfo *thrinfo)
 {
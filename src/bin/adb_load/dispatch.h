@@ -3,6 +3,7 @@
 
 #include "libpq-fe.h"
 #include "msg_queue_pipe.h"
+#include "load_stats.h"
 
 #define DISPATCH_OK    1
 #define DISPATCH_ERROR 0
@@ -77,6 +78,12 @@ typedef struct DispatchThreadInfo
 	bool                copy_cmd_comment;
 	char               *copy_cmd_comment_str;
 
+	char               *copy_buffer;        /* lines not sent to the datanode yet */
+	int                 copy_buffer_len;
+	int                 copy_buffer_line;   /* file line of the first one */
+	time_t              last_flush;
+	LoadStatsCounter    stats;
+
 	void               *(* thr_startroutine)(void *); /* thread start function */
 	DispatchThreadWorkState state;
 } DispatchThreadInfo;
@@ -72,15 +72,19 @@ get_linebuf(void)
 		node = dlist_pop_head_node(&buf_head);
 		pthread_mutex_unlock(&buf_mutex);
 		buf = dlist_container(LineBuffer, dnode, node);
-		memset(buf->data, 0, DEFAULT_BUF_LEN);
+		/* appending keeps the data null terminated, no need to clear it all */
+		buf->data[0] = '\0';
 		buf->len = 0;
+		buf->refcount = 1;
 	}else
 	{
 		pthread_mutex_unlock(&buf_mutex);
 		buf = palloc(offsetof(LineBuffer, marks) + max_nodes);
 		buf->maxlen = DEFAULT_BUF_LEN;
 		buf->data = palloc(DEFAULT_BUF_LEN);
+		buf->data[0] = '\0';
 		buf->len = 0;
+		buf->refcount = 1;
 	}
 	unmarkall_linebuf(buf);
 	return buf;
@@ -92,7 +96,23 @@ release_linebuf(LineBuffer *buf)
 	AssertArg(buf);
 	Assert(IsInitedLineBuf());
 	pthread_mutex_lock(&buf_mutex);
-	dlist_push_tail(&buf_head, &(buf->dnode));
+	Assert(buf->refcount > 0);
+	if (--buf->refcount == 0)
+		dlist_push_tail(&buf_head, &(buf->dnode));
+	pthread_mutex_unlock(&buf_mutex);
+}
+
+/*
+ * Give "buf" to "holders" threads at once, each of them releases it and
+ * the last one recycles it. Must be called before handing it out.
+ */
+void
+share_linebuf(LineBuffer *buf, int holders)
+{
+	AssertArg(buf);
+	Assert(holders > 0);
+	pthread_mutex_lock(&buf_mutex);
+	buf->refcount = holders;
 	pthread_mutex_unlock(&buf_mutex);
 }
 
@@ -11,12 +11,14 @@ typedef struct LineBuffer
 	int             fileline;
 	int             len;
 	int             maxlen;
+	int             refcount; /* holders left, it is recycled when none */
 	dlist_node      dnode;
 	bool            marks[1]; /* (VARIABLE LENGTH) */
 }LineBuffer;
 
 LineBuffer* get_linebuf(void);
 void release_linebuf(LineBuffer *buf);
+void share_linebuf(LineBuffer *buf, int holders);
 
 void init_linebuf(int max_node);
 void end_linebuf(void);
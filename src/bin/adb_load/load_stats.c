@@ -0,0 +1,299 @@
+/*
+ * Throughput of the stages of a load.
+ *
+ * The read, hash and dispatch threads count the lines and bytes they handle
+ * in their own LoadStatsCounter and add them to the totals kept here from
+ * time to time. The main thread reports the rates of every stage, of every
+ * datanode and the state of the queues between the stages into the process
+ * log every LOAD_STATS_REPORT_INTERVAL seconds, and writes a JSON report of
+ * the whole file into the summary log once the file is loaded.
+ */
+#include "postgres_fe.h"
+
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <sys/time.h>
+
+#include "linebuf.h"
+#include "load_stats.h"
+#include "log_process_fd.h"
+#include "log_summary_fd.h"
+
+typedef struct QueueStats
+{
+	int64		lines;			/* lines waiting in the queues now */
+	int64		max_lines;		/* of the fullest queue */
+	int64		put_wait_usec;
+	int64		poll_wait_usec;
+} QueueStats;
+
+static const char *stage_names[LOAD_STAGE_NUM] = {"read", "hash", "dispatch"};
+
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int64 stage_lines[LOAD_STAGE_NUM];
+static int64 stage_bytes[LOAD_STAGE_NUM];
+static int64 *node_lines = NULL;
+static int64 *node_bytes = NULL;
+static int stats_datanodes_num = 0;
+
+static char *stats_file_path = NULL;
+static MessageQueuePipe *stats_input_queue = NULL;
+static MessageQueuePipe **stats_output_queue = NULL;
+static int stats_output_queue_num = 0;
+
+static struct timeval stats_start_time;
+static struct timeval last_report_time;
+static int64 last_stage_lines[LOAD_STAGE_NUM];
+static int64 last_stage_bytes[LOAD_STAGE_NUM];
+
+static double elapsed_seconds(struct timeval *since, struct timeval *now);
+static double per_second(int64 value, double seconds);
+static void get_queue_stats(MessageQueuePipe **queues, int num, QueueStats *stats);
+static void append_queue_json(LineBuffer *buf, char *name, QueueStats *stats);
+
+/*
+ * Reset the statistics before loading "file_path". "input_queue" feeds the
+ * hash threads and is NULL for replicated and roundrobin tables,
+ * "output_queue" feeds the dispatch threads.
+ */
+void
+load_stats_start(char *file_path, int datanodes_num,
+				 MessageQueuePipe *input_queue,
+				 MessageQueuePipe **output_queue, int output_queue_num)
+{
+	pthread_mutex_lock(&stats_mutex);
+	MemSet(stage_lines, 0, sizeof(stage_lines));
+	MemSet(stage_bytes, 0, sizeof(stage_bytes));
+	MemSet(last_stage_lines, 0, sizeof(last_stage_lines));
+	MemSet(last_stage_bytes, 0, sizeof(last_stage_bytes));
+
+	pg_free(node_lines);
+	pg_free(node_bytes);
+	stats_datanodes_num = datanodes_num;
+	node_lines = (int64 *) palloc0(sizeof(int64) * Max(datanodes_num, 1));
+	node_bytes = (int64 *) palloc0(sizeof(int64) * Max(datanodes_num, 1));
+
+	pg_free(stats_file_path);
+	stats_file_path = pg_strdup(file_path);
+	stats_input_queue = input_queue;
+	stats_output_queue = output_queue;
+	stats_output_queue_num = output_queue_num;
+
+	gettimeofday(&stats_start_time, NULL);
+	last_report_time = stats_start_time;
+	pthread_mutex_unlock(&stats_mutex);
+}
+
+void
+load_stats_init_counter(LoadStatsCounter *counter, LoadStage stage, int node)
+{
+	Assert(stage < LOAD_STAGE_NUM);
+
+	counter->stage = stage;
+	counter->node = node;
+	counter->lines = 0;
+	counter->bytes = 0;
+}
+
+/* add the lines counted by a thread to the totals, threads call it at exit too */
+void
+load_stats_flush(LoadStatsCounter *counter)
+{
+	if (counter->lines == 0)
+		return;
+
+	pthread_mutex_lock(&stats_mutex);
+	stage_lines[counter->stage] += counter->lines;
+	stage_bytes[counter->stage] += counter->bytes;
+	if (counter->node >= 0 && counter->node < stats_datanodes_num)
+	{
+		node_lines[counter->node] += counter->lines;
+		node_bytes[counter->node] += counter->bytes;
+	}
+	pthread_mutex_unlock(&stats_mutex);
+
+	counter->lines = 0;
+	counter->bytes = 0;
+}
+
+/*
+ * Write the rates of the last interval into the process log, called by the
+ * main thread each time it checks the modules, does nothing until
+ * LOAD_STATS_REPORT_INTERVAL seconds have passed since the last report.
+ */
+void
+load_stats_report(void)
+{
+	struct timeval now;
+	double		interval;
+	QueueStats	input;
+	QueueStats	output;
+	LineBuffer *buf;
+	int			stage;
+	int			i;
+
+	gettimeofday(&now, NULL);
+	interval = elapsed_seconds(&last_report_time, &now);
+	if (interval < LOAD_STATS_REPORT_INTERVAL)
+		return;
+
+	get_queue_stats(&stats_input_queue, stats_input_queue ? 1 : 0, &input);
+	get_queue_stats(stats_output_queue, stats_output_queue_num, &output);
+
+	buf = get_linebuf();
+	pthread_mutex_lock(&stats_mutex);
+	for (stage = 0; stage < LOAD_STAGE_NUM; stage++)
+	{
+		if (stage == LOAD_STAGE_HASH && stats_input_queue == NULL)
+			continue;
+		appendLineBufInfo(buf, "%s %.0f lines/s %.0f bytes/s, ",
+						  stage_names[stage],
+						  per_second(stage_lines[stage] - last_stage_lines[stage], interval),
+						  per_second(stage_bytes[stage] - last_stage_bytes[stage], interval));
+		last_stage_lines[stage] = stage_lines[stage];
+		last_stage_bytes[stage] = stage_bytes[stage];
+	}
+	appendLineBufInfo(buf, "datanodes");
+	for (i = 0; i < stats_datanodes_num; i++)
+		appendLineBufInfo(buf, " %d:" INT64_FORMAT, i, node_lines[i]);
+	pthread_mutex_unlock(&stats_mutex);
+
+	if (stats_input_queue != NULL)
+		appendLineBufInfo(buf, ", input queue " INT64_FORMAT " lines", input.lines);
+	appendLineBufInfo(buf, ", output queues " INT64_FORMAT " lines (fullest " INT64_FORMAT ")",
+					  output.lines, output.max_lines);
+
+	ADBLOADER_LOG(LOG_INFO, "[STATS] %s", buf->data);
+	release_linebuf(buf);
+
+	last_report_time = now;
+}
+
+/*
+ * Write the JSON report of the loaded file into the summary log, once all
+ * the threads of the file exited and before its queues are destroyed.
+ */
+void
+load_stats_finish(void)
+{
+	struct timeval now;
+	double		elapsed;
+	QueueStats	input;
+	QueueStats	output;
+	LineBuffer *buf;
+	char	   *p;
+	int			stage;
+	int			i;
+
+	if (stats_file_path == NULL)
+		return;
+
+	gettimeofday(&now, NULL);
+	elapsed = elapsed_seconds(&stats_start_time, &now);
+
+	get_queue_stats(&stats_input_queue, stats_input_queue ? 1 : 0, &input);
+	get_queue_stats(stats_output_queue, stats_output_queue_num, &output);
+
+	buf = get_linebuf();
+	appendLineBufInfo(buf, "{\"file\": \"");
+	for (p = stats_file_path; *p != '\0'; p++)
+	{
+		if (*p == '"' || *p == '\\')
+			appendLineBufInfo(buf, "\\%c", *p);
+		else if ((unsigned char) *p < 0x20)
+			appendLineBufInfo(buf, "\\u%04x", (unsigned char) *p);
+		else
+			appendLineBufInfo(buf, "%c", *p);
+	}
+	appendLineBufInfo(buf, "\", \"elapsed_sec\": %.3f, \"stages\": {", elapsed);
+
+	pthread_mutex_lock(&stats_mutex);
+	for (stage = 0; stage < LOAD_STAGE_NUM; stage++)
+	{
+		appendLineBufInfo(buf,
+						  "%s\"%s\": {\"lines\": " INT64_FORMAT ", \"bytes\": " INT64_FORMAT
+						  ", \"lines_per_sec\": %.0f, \"bytes_per_sec\": %.0f}",
+						  stage == 0 ? "" : ", ", stage_names[stage],
+						  stage_lines[stage], stage_bytes[stage],
+						  per_second(stage_lines[stage], elapsed),
+						  per_second(stage_bytes[stage], elapsed));
+	}
+	appendLineBufInfo(buf, "}, \"datanodes\": [");
+	for (i = 0; i < stats_datanodes_num; i++)
+	{
+		appendLineBufInfo(buf,
+						  "%s{\"index\": %d, \"lines\": " INT64_FORMAT ", \"bytes\": " INT64_FORMAT
+						  ", \"lines_per_sec\": %.0f, \"bytes_per_sec\": %.0f}",
+						  i == 0 ? "" : ", ", i, node_lines[i], node_bytes[i],
+						  per_second(node_lines[i], elapsed),
+						  per_second(node_bytes[i], elapsed));
+	}
+	pthread_mutex_unlock(&stats_mutex);
+
+	appendLineBufInfo(buf, "], \"queues\": {");
+	if (stats_input_queue != NULL)
+	{
+		append_queue_json(buf, "input", &input);
+		appendLineBufInfo(buf, ", ");
+	}
+	append_queue_json(buf, "output", &output);
+	appendLineBufInfo(buf, "}}\n");
+
+	write_log_summary_fd(buf);
+	release_linebuf(buf);
+
+	pg_free(stats_file_path);
+	stats_file_path = NULL;
+	stats_input_queue = NULL;
+	stats_output_queue = NULL;
+	stats_output_queue_num = 0;
+}
+
+static double
+elapsed_seconds(struct timeval *since, struct timeval *now)
+{
+	return (now->tv_sec - since->tv_sec) + (now->tv_usec - since->tv_usec) / 1000000.0;
+}
+
+static double
+per_second(int64 value, double seconds)
+{
+	return seconds > 0 ? value / seconds : 0;
+}
+
+/*
+ * Lines waiting in "queues", both in the pipes and in their read caches,
+ * and the time spent by the threads blocked on them. Reading without the
+ * queue locks only gives an approximation, enough for a report.
+ */
+static void
+get_queue_stats(MessageQueuePipe **queues, int num, QueueStats *stats)
+{
+	int			i;
+
+	MemSet(stats, 0, sizeof(QueueStats));
+	for (i = 0; i < num; i++)
+	{
+		MessageQueuePipe *queue = queues[i];
+		int			nbytes = 0;
+		int64		lines;
+
+		if (ioctl(queue->fd[0], FIONREAD, &nbytes) < 0)
+			nbytes = 0;
+		lines = nbytes / sizeof(LineBuffer *) + (queue->read_cache_len - queue->read_cache_pos);
+
+		stats->lines += lines;
+		stats->max_lines = Max(stats->max_lines, lines);
+		stats->put_wait_usec += queue->put_wait_usec;
+		stats->poll_wait_usec += queue->poll_wait_usec;
+	}
+}
+
+static void
+append_queue_json(LineBuffer *buf, char *name, QueueStats *stats)
+{
+	appendLineBufInfo(buf,
+					  "\"%s\": {\"put_wait_sec\": %.3f, \"poll_wait_sec\": %.3f}",
+					  name, stats->put_wait_usec / 1000000.0,
+					  stats->poll_wait_usec / 1000000.0);
+}
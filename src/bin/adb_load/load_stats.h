@@ -0,0 +1,47 @@
+#ifndef ADB_LOAD_LOAD_STATS_H
+#define ADB_LOAD_LOAD_STATS_H
+
+#include "msg_queue_pipe.h"
+
+typedef enum LoadStage
+{
+	LOAD_STAGE_READ,
+	LOAD_STAGE_HASH,
+	LOAD_STAGE_DISPATCH,
+	LOAD_STAGE_NUM
+} LoadStage;
+
+/*
+ * Lines and bytes counted by one thread, added to the totals of its stage
+ * every LOAD_STATS_FLUSH_LINES lines so that threads seldom take the lock.
+ */
+typedef struct LoadStatsCounter
+{
+	LoadStage	stage;
+	int			node;		/* datanode index of a dispatch thread, else -1 */
+	int64		lines;
+	int64		bytes;
+} LoadStatsCounter;
+
+#define LOAD_STATS_FLUSH_LINES		256
+
+/* seconds between two reports written to the process log */
+#define LOAD_STATS_REPORT_INTERVAL	10
+
+#define load_stats_count(counter, nbytes) \
+	do { \
+		(counter)->lines++; \
+		(counter)->bytes += (nbytes); \
+		if ((counter)->lines >= LOAD_STATS_FLUSH_LINES) \
+			load_stats_flush(counter); \
+	} while (0)
+
+extern void load_stats_start(char *file_path, int datanodes_num,
+							 MessageQueuePipe *input_queue,
+							 MessageQueuePipe **output_queue, int output_queue_num);
+extern void load_stats_init_counter(LoadStatsCounter *counter, LoadStage stage, int node);
+extern void load_stats_flush(LoadStatsCounter *counter);
+extern void load_stats_report(void);
+extern void load_stats_finish(void);
+
+#endif /* ADB_LOAD_LOAD_STATS_H */
@@ -48,6 +48,7 @@ static const char *COPY_CMD_COMMENT_STR = "COPY_CMD_COMMENT_STR";
 static const char *FILTER_FIRST_LINE = "FILTER_FIRST_LINE";
 static const char *READ_FILE_BUFFER  = "READ_FILE_BUFFER";
 static const char *ERROR_THRESHOLD   = "ERROR_THRESHOLD";
+static const char *COPY_ERROR_LIMIT  = "COPY_ERROR_LIMIT";
 
 static void print_help(FILE *fd);
 static char *replace_string(const char *string, const char *replace, const char *replacement);
@@ -57,7 +58,7 @@ static void pg_free_hash_config(HashConfig *hash_config);
 static void pg_free_log_field(LogField *logfield);
 static int get_redo_queue_total(char *optarg);
 static int *get_redo_queue(char *optarg, int redo_queue_num);
-static char * get_copy_options(char *text_delim, char *copy_null);
+static char * get_copy_options(char *text_delim, char *copy_null, int error_limit);
 static char * get_text_delim(char *text_delim);
 
 #define DEFAULT_CONFIGFILENAME "./adb_load.conf"
@@ -79,6 +80,7 @@ cmdline_adb_load_setting(int argc, char **argv)
 		{"inputfile",           required_argument, NULL, 'f'},
 		{"just_check",                no_argument, NULL, 'j'},
 		{"outputdir",           required_argument, NULL, 'o'},
+		{"parallel",            required_argument, NULL, 'P'},
 		{"password",            required_argument, NULL, 'W'},
 		{"queue",               required_argument, NULL, 'Q'},
 		{"static",                    no_argument, NULL, 's'},
@@ -111,7 +113,8 @@ cmdline_adb_load_setting(int argc, char **argv)
 	}
 
 	setting = (ADBLoadSetting *)palloc0(sizeof(ADBLoadSetting));
-	while((c = getopt_long(argc, argv, "c:d:yi:f:o:W:sgt:U:Q:r:h:ejpm:nx", long_options, &option_index)) != -1)
+	setting->parallel_num = 1;
+	while((c = getopt_long(argc, argv, "c:d:yi:f:o:P:W:sgt:U:Q:r:h:ejpm:nx", long_options, &option_index)) != -1)
 	{
 		switch(c)
 		{
@@ -171,6 +174,14 @@ cmdline_adb_load_setting(int argc, char **argv)
 		case 'p':
 			setting->copy_cmd_comment = true;
 			break;
+		case 'P':
+			setting->parallel_num = atoi(optarg);
+			if (setting->parallel_num <= 0)
+			{
+				fprintf(stderr, "Error: option -P/--parallel can not be less than or equal to 0.\n");
+				exit(EXIT_FAILURE);
+			}
+			break;
 		case 'Q': //queue
 			{
 				setting->redo_queue = true;
@@ -275,6 +286,12 @@ cmdline_adb_load_setting(int argc, char **argv)
 		}
 	}
 
+	if (setting->parallel_num > 1 && !setting->static_mode)
+	{
+		fprintf(stderr, "Error: option -P/--parallel can only be used with -s/--static.\n");
+		exit(EXIT_FAILURE);
+	}
+
 	if (setting->static_mode)
 	{
 		if (setting->input_file != NULL || setting->table_name != NULL)
@@ -695,8 +712,24 @@ get_settings_by_config_file(ADBLoadSetting *setting)
 
 	setting->hash_config->copy_quotec = pstrdup("\"");
 	setting->hash_config->copy_escapec = pstrdup("NO");
+	setting->hash_config->copy_null = get_config_file_value(COPY_NULL);
+
+	/* optional, the datanodes skip up to this number of bad rows of each COPY */
+	setting->copy_error_limit = -1;
+	if ((str_ptr = GetConfValue(COPY_ERROR_LIMIT)) != NULL)
+	{
+		setting->copy_error_limit = atoi(str_ptr);
+		if (setting->copy_error_limit < 0)
+		{
+			fprintf(stderr, "Error: the value for \"COPY_ERROR_LIMIT\" must be a non-negative integer.\n");
+			exit(EXIT_FAILURE);
+		}
+		str_ptr = NULL;
+	}
+
 	setting->hash_config->copy_option = get_copy_options(setting->hash_config->text_delim,
-                                                        get_config_file_value(COPY_NULL));
+                                                        setting->hash_config->copy_null,
+                                                        setting->copy_error_limit);
 
 	setting->log_field = (LogField *)palloc0(sizeof(LogField));
 	setting->log_field->log_level = get_config_file_value(LOG_LEVEL);
@@ -810,7 +843,7 @@ get_text_delim(char *text_delim)
 }
 
 static char *
-get_copy_options(char *text_delim, char *copy_null)
+get_copy_options(char *text_delim, char *copy_null, int error_limit)
 {
 	LineBuffer *buf = NULL;
 	char *copy_options = NULL;
@@ -828,6 +861,10 @@ get_copy_options(char *text_delim, char *copy_null)
 
 	/*for COPY_NULL */
 	appendLineBufInfo(buf, "NULL \'%s\' ", copy_null);
+
+	/*for COPY_ERROR_LIMIT */
+	if (error_limit >= 0)
+		appendLineBufInfo(buf, ", ERROR_LIMIT %d ", error_limit);
 	appendLineBufInfo(buf, ")");
 
 	copy_options = pstrdup(buf->data);
@@ -885,7 +922,8 @@ print_help(FILE *fd)
 	fprintf(fd, _("  -g, --singlefile            import data using single file mode\n"));
 	fprintf(fd, _("  -s, --static                import data using static mode\n"));
 	fprintf(fd, _("  -y, --dynamic               import data using dynamic mode\n"));
-	fprintf(fd, _("  -x, --stream                import data using stream mode\n\n"));
+	fprintf(fd, _("  -x, --stream                import data using stream mode\n"));
+	fprintf(fd, _("  -P, --parallel              worker processes importing files at once in static mode (default:1)\n\n"));
 
 	fprintf(fd, _("  -c, --configfile            config file path (default:adb_load.conf in the current directory)\n"));
 	fprintf(fd, _("  -o, --outputdir             output directory for log file and error file\n"));
@@ -1015,6 +1053,9 @@ pg_free_hash_config(HashConfig *hash_config)
 	pg_free(hash_config->copy_option);
 	hash_config->copy_option = NULL;
 
+	pg_free(hash_config->copy_null);
+	hash_config->copy_null = NULL;
+
 	return;
 }
 
@@ -25,6 +25,7 @@ typedef struct HashConfig
 	char *copy_quotec;
 	char *copy_escapec;
 	char *copy_option;
+	char *copy_null;
 }HashConfig;
 
 typedef struct LogField
@@ -76,6 +77,7 @@ typedef struct ADBLoadSetting
 	int   threads_num_per_datanode;
 	int   hash_thread_num;
 	int   read_file_buffer;
+	int   parallel_num;      /* worker processes loading files in static mode */
 
 	NodeInfoData    *server_info;
 	NodeInfoData    *agtm_info;
@@ -100,6 +102,7 @@ typedef struct ADBLoadSetting
 	char            *copy_cmd_comment_str;
 
 	int              error_threshold;
+	int              copy_error_limit;  /* bad rows skipped by each COPY, -1 for none */
 	bool             filter_first_line;
 } ADBLoadSetting;
 
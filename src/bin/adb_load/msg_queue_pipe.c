@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/time.h>
 
 #include "msg_queue_pipe.h"
 #include "log_process_fd.h"
@@ -11,6 +12,7 @@
 
 static ssize_t readn (int fd, void *ptr, size_t n);
 static ssize_t writen (int fd, const void *ptr, size_t n);
+static int64 usec_since (struct timeval *start);
 
 ssize_t
 readn (int fd, void *buf, size_t n)
@@ -82,6 +84,16 @@ writen (int fd, const void *buf, size_t n)
 	return (n - nleft);
 }
 
+/* a full pipe blocks its writers and an empty one its readers */
+static int64
+usec_since (struct timeval *start)
+{
+	struct timeval now;
+
+	gettimeofday(&now, NULL);
+	return (int64) (now.tv_sec - start->tv_sec) * 1000000 + (now.tv_usec - start->tv_usec);
+}
+
 void
 mq_pipe_init (MessageQueuePipe *queue, char *name)
 {
@@ -105,6 +117,10 @@ mq_pipe_init (MessageQueuePipe *queue, char *name)
 	queue->name = (char *)palloc0(strlen(name) + 1);
 	sprintf(queue->name, "%s", name);
 	queue->name[strlen(name)] = '\0';
+	queue->read_cache_pos = 0;
+	queue->read_cache_len = 0;
+	queue->put_wait_usec = 0;
+	queue->poll_wait_usec = 0;
 	if(pipe(queue->fd) < 0)
 	{
 		fprintf(stderr, "create pipe error \n");
@@ -120,12 +136,15 @@ int
 mq_pipe_put (MessageQueuePipe *queue, LineBuffer* lineBuffer)
 {
 	int num = 0;
+	struct timeval start;
 
 	Assert(queue != NULL);
 
 	if (queue->write_lock)
 		pthread_mutex_lock(&queue->write_queue_mutex);
+	gettimeofday(&start, NULL);
 	num = writen(queue->fd[1], (void*)&lineBuffer, sizeof(LineBuffer*));
+	queue->put_wait_usec += usec_since(&start);
 	if (queue->write_lock)
 		pthread_mutex_unlock(&queue->write_queue_mutex);
 	if (num > 0 && num != sizeof(LineBuffer*))
@@ -157,52 +176,91 @@ mq_pipe_put_element (MessageQueuePipe *queue, QueueElementPipe *element)
 	return num;
 }
 
+/*
+ * Put "size" LineBuffer pointers at once, in writes of at most
+ * MQ_PIPE_BATCH_SIZE pointers so that writers do not mix their batches.
+ */
 int
 mq_pipe_put_batch (MessageQueuePipe *queue, LineBuffer ** lineBuffer, int size)
 {
-	QueueElementPipe *element;
 	int flag;
-	int num;
+	int num = 0;
+	struct timeval start;
 	Assert(queue != NULL && lineBuffer != NULL && size > 0);
 	if (queue->write_lock)
 		pthread_mutex_lock(&queue->write_queue_mutex);
-	for(flag = 0; flag < size; flag++)
+	gettimeofday(&start, NULL);
+	for(flag = 0; flag < size; flag += MQ_PIPE_BATCH_SIZE)
 	{
-		element = (QueueElementPipe *)palloc0(sizeof(QueueElementPipe));
-		element->lineBuffer = lineBuffer[flag];
-		num = writen(queue->fd[1], (void*)element, sizeof(element));
-		if (num > 0 && num != sizeof(element))
+		int count = Min(size - flag, MQ_PIPE_BATCH_SIZE);
+
+		num = writen(queue->fd[1], (void*)&lineBuffer[flag], sizeof(LineBuffer*) * count);
+		if (num != sizeof(LineBuffer*) * count)
 		{
-			/* wtrite failed element->lineBuffer->data */
+			ADBLOADER_LOG(LOG_ERROR,
+							"[mq_pipe] put linebuff batch to pipe error, buffer data :%s",
+							lineBuffer[flag]->data);
+			num = -1;
+			break;
 		}
 	}
+	queue->put_wait_usec += usec_since(&start);
 	if (queue->write_lock)
 		pthread_mutex_unlock(&queue->write_queue_mutex);
-	return 1;
+	return num;
 }
 
+/*
+ * Return the next LineBuffer pointer of the queue. The pipe is read by up
+ * to MQ_PIPE_BATCH_SIZE pointers, the ones not returned yet are kept for
+ * the next calls.
+ */
 LineBuffer*
 mq_pipe_poll (MessageQueuePipe *queue)
 {
-	int	num;
+	ssize_t	num;
 	LineBuffer* lineBuffer;
+	struct timeval start;
 	pthread_mutex_lock(&queue->read_queue_mutex);
-	num = readn(queue->fd[0], (void*)&lineBuffer, sizeof(LineBuffer*));
-	pthread_mutex_unlock(&queue->read_queue_mutex);
-	if( num > 0 && num != sizeof(LineBuffer*))
-	{
-		/* read failed ,some can't read */
-		return NULL;
-	}
-	if (num < 0)
+	if (queue->read_cache_pos == queue->read_cache_len)
 	{
-		/*error*/
-		return NULL;
+		queue->read_cache_pos = queue->read_cache_len = 0;
+		gettimeofday(&start, NULL);
+		do
+		{
+			num = read(queue->fd[0], (void*)queue->read_cache, sizeof(queue->read_cache));
+		} while (num < 0 && errno == EINTR);
+
+		/* writes are atomic, but be safe with a partial pointer */
+		if (num > 0 && num % sizeof(LineBuffer*) != 0)
+		{
+			size_t	rest = sizeof(LineBuffer*) - num % sizeof(LineBuffer*);
+
+			if (readn(queue->fd[0], (char*)queue->read_cache + num, rest) != (ssize_t) rest)
+				num = -1;
+			else
+				num += rest;
+		}
+		queue->poll_wait_usec += usec_since(&start);
+		if (num <= 0)
+		{
+			/*error*/
+			pthread_mutex_unlock(&queue->read_queue_mutex);
+			return NULL;
+		}
+		queue->read_cache_len = num / sizeof(LineBuffer*);
 	}
-	Assert(num == sizeof(LineBuffer*));
+	lineBuffer = queue->read_cache[queue->read_cache_pos++];
+	pthread_mutex_unlock(&queue->read_queue_mutex);
 	return lineBuffer;
 }
 
+bool
+mq_pipe_has_cached (MessageQueuePipe *queue)
+{
+	return queue->read_cache_pos < queue->read_cache_len;
+}
+
 void
 mq_pipe_destory(MessageQueuePipe *queue)
 {
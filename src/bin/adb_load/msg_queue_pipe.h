@@ -1,35 +1,51 @@
-#ifndef ADB_LOAD_MSG_QUEUE_PIPE_H
-#define ADB_LOAD_MSG_QUEUE_PIPE_H
-
-#include "linebuf.h"
-
-typedef struct QueueElementPipe
-{
-  LineBuffer *lineBuffer;
-  LineBuffer *hash;
-  bool		 finish;
-} QueueElementPipe;
-
-typedef struct MessageQueuePipe
-{
-	char 			*name;
-	int				fd[2];
-	bool			write_lock;
-	pthread_mutex_t write_queue_mutex;
-	pthread_mutex_t read_queue_mutex;
-} MessageQueuePipe;
-
-/* main thread need to init queue */
-extern  void mq_pipe_init (MessageQueuePipe *queue, char *name);
-
-extern int mq_pipe_put (MessageQueuePipe *queue, LineBuffer* lineBuffer);
-
-extern int mq_pipe_put_element (MessageQueuePipe *queue, QueueElementPipe *element);
-
-extern int mq_pipe_put_batch (MessageQueuePipe *queue, LineBuffer ** lineBuffer, int size);
-
-extern LineBuffer * mq_pipe_poll (MessageQueuePipe *queue);
-
-extern void mq_pipe_destory (MessageQueuePipe *queue);
-
-#endif /* ADB_LOAD_MSG_QUEUE_PIPE_H */
+#ifndef ADB_LOAD_MSG_QUEUE_PIPE_H
+#define ADB_LOAD_MSG_QUEUE_PIPE_H
+
+#include "linebuf.h"
+
+typedef struct QueueElementPipe
+{
+  LineBuffer *lineBuffer;
+  LineBuffer *hash;
+  bool		 finish;
+} QueueElementPipe;
+
+/*
+ * Number of pointers moved by a single read or write on the pipe, small
+ * enough for the write to stay below PIPE_BUF and so to be atomic.
+ */
+#define MQ_PIPE_BATCH_SIZE	64
+
+typedef struct MessageQueuePipe
+{
+	char 			*name;
+	int				fd[2];
+	bool			write_lock;
+	pthread_mutex_t write_queue_mutex;
+	pthread_mutex_t read_queue_mutex;
+	/* pointers read from the pipe and not yet polled, under read_queue_mutex */
+	LineBuffer		*read_cache[MQ_PIPE_BATCH_SIZE];
+	int				read_cache_pos;
+	int				read_cache_len;
+	/* time spent in write() and read() on the pipe, for load_stats.c */
+	int64			put_wait_usec;
+	int64			poll_wait_usec;
+} MessageQueuePipe;
+
+/* main thread need to init queue */
+extern  void mq_pipe_init (MessageQueuePipe *queue, char *name);
+
+extern int mq_pipe_put (MessageQueuePipe *queue, LineBuffer* lineBuffer);
+
+extern int mq_pipe_put_element (MessageQueuePipe *queue, QueueElementPipe *element);
+
+extern int mq_pipe_put_batch (MessageQueuePipe *queue, LineBuffer ** lineBuffer, int size);
+
+extern LineBuffer * mq_pipe_poll (MessageQueuePipe *queue);
+
+/* true if mq_pipe_poll can return without reading the pipe, select() cannot tell */
+extern bool mq_pipe_has_cached (MessageQueuePipe *queue);
+
+extern void mq_pipe_destory (MessageQueuePipe *queue);
+
+#endif /* ADB_LOAD_MSG_QUEUE_PIPE_H */
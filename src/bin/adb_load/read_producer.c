@@ -3,6 +3,8 @@
 #include <pthread.h>
 #include <unistd.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <fcntl.h>
 #include <stdio.h>
 
 #include "log_process_fd.h"
@@ -10,12 +12,59 @@
 #include "read_producer.h"
 #include "utility.h"
 #include "log_summary_fd.h"
+#include "load_stats.h"
 
 typedef pthread_t Read_ThreadID;
 
 pthread_t g_read_thread_id;
 
-#define READFILEBUFSIZE    (8 * BLCKSZ)
+/* default size of the blocks read from the data file */
+#define READ_BLOCK_SIZE    (4 * 1024 * 1024)
+
+/*
+ * Reads the data file by large blocks and cuts them into lines in place,
+ * instead of asking stdio for each line.
+ */
+/*
+ * Compressed data files are recognized by their magic number and read
+ * through the output of their decompression program, which works in
+ * parallel with the read thread.
+ */
+typedef struct DecompressMethod
+{
+	const char          *name;
+	unsigned char        magic[4];
+	int                  magic_len;
+	const char          *command;
+} DecompressMethod;
+
+static const DecompressMethod decompress_methods[] =
+{
+	{"gzip", {0x1f, 0x8b}, 2, "gzip -dc"},
+	{"zstd", {0x28, 0xb5, 0x2f, 0xfd}, 4, "zstd -dc"},
+	{"lz4", {0x04, 0x22, 0x4d, 0x18}, 4, "lz4 -dc"},
+	{NULL, {0}, 0, NULL}
+};
+
+typedef struct BlockReader
+{
+	int                  fd;
+	char                *buf;
+	size_t               size;       /* allocated size of buf */
+	size_t               start;      /* first byte of the next line */
+	size_t               scan;       /* first byte not yet scanned */
+	size_t               end;        /* end of the valid data */
+	bool                 eof;
+	bool                 error;      /* read() failed */
+	char                 escapec;    /* escape of the text format */
+} BlockReader;
+
+/* lines waiting to be put to one queue at once */
+typedef struct LineBufferBatch
+{
+	LineBuffer          *lines[MQ_PIPE_BATCH_SIZE];
+	int                  count;
+} LineBufferBatch;
 
 typedef struct Read_ThreadInfo
 {
@@ -40,6 +89,10 @@ typedef struct Read_ThreadInfo
 	int                  read_file_buffer; //unit is KB
 	bool                 stream_node;
 	FILE                *fp;
+	bool                 fp_is_pipe; /* fp reads a decompression program */
+	BlockReader          reader;
+	LineBufferBatch     *batches;    /* one for each queue, NULL in stream mode */
+	LoadStatsCounter     stats;
 	void                *(* thr_startroutine)(void *);
 } Read_ThreadInfo;
 
@@ -61,6 +114,14 @@ static void  read_write_error_message(Read_ThreadInfo *thrinfo,
 								char *line_data,
 								bool redo);
 static int *get_array_output_queue(int output_queue_total);
+static const DecompressMethod *get_decompress_method(const char *file_path);
+static FILE *open_decompress_file(const char *file_path, const DecompressMethod *method);
+static int close_data_file(Read_ThreadInfo *thrinfo);
+static void init_block_reader(BlockReader *reader, int fd, int read_file_buffer);
+static char *read_block_line(BlockReader *reader, int *len);
+static char *read_next_line(Read_ThreadInfo *thrinfo, int *len);
+static int put_linebuf(Read_ThreadInfo *thrinfo, int queue_index, LineBuffer *linebuf);
+static int flush_linebuf_batches(Read_ThreadInfo *thrinfo);
 
 static ReadProducerState    STATE = READ_PRODUCER_PROCESS_OK;
 static bool                 NEED_EXIT = false;
@@ -107,12 +168,22 @@ read_ThreadCleanup (void * argp)
 {
 	Read_ThreadInfo  *thrinfo = (Read_ThreadInfo*) argp;
 
+	load_stats_flush(&thrinfo->stats);
+
 	pg_free(thrinfo->file_path);
 	thrinfo->file_path = NULL;
 
 	pg_free(thrinfo->start_cmd);
 	thrinfo->start_cmd = NULL;
 
+	if (thrinfo->reader.buf)
+		pg_free(thrinfo->reader.buf);
+	thrinfo->reader.buf = NULL;
+
+	if (thrinfo->batches)
+		pg_free(thrinfo->batches);
+	thrinfo->batches = NULL;
+
 	pg_free(thrinfo);
 	thrinfo = NULL;
 
@@ -152,8 +223,7 @@ static void
 read_data_file_and_no_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 {
 	char       *line = NULL;
-	size_t      len = 0;
-	ssize_t     read_count = 0;
+	int         len = 0;
 	int         lineno = 0;
 	int         datanodes_num = 0;
 	int         threads_num_per_datanode= 0;
@@ -166,7 +236,7 @@ read_data_file_and_no_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 	datanodes_num = thrinfo->datanodes_num;
 	threads_num_per_datanode = thrinfo->threads_num_per_datanode;
 
-	while((read_count = getline(&line, &len, thrinfo->fp)) != -1)
+	while((line = read_next_line(thrinfo, &len)) != NULL)
 	{
 		int res = 0;
 		int j = 0;
@@ -183,23 +253,25 @@ read_data_file_and_no_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 		if (NEED_EXIT)
 		{
 			STATE = READ_PRODUCER_PROCESS_EXIT_BY_CALLER;
-			fclose(thrinfo->fp);
+			close_data_file(thrinfo);
 			pthread_exit(thrinfo);
 		}
 
+		/* the same line goes to every datanode, share a single copy of it */
+		linebuf = get_linebuf();
+		appendLineBufInfoBinary(linebuf, line, len);
+		linebuf->fileline = lineno;
+		share_linebuf(linebuf, datanodes_num);
+
 		for (j = 0; j < datanodes_num; j++)
 		{
 			int output_queue_index = 0;
 
-			linebuf = get_linebuf();
-			appendLineBufInfoString(linebuf, line);
-			linebuf->fileline = lineno;
-
 			output_queue_index = i + j * threads_num_per_datanode;
-			res = mq_pipe_put(thrinfo->output_queue[output_queue_index], linebuf);
 			ADBLOADER_LOG(LOG_DEBUG,
-				"[READ_PRODUCER][thread id : %ld ] send data: %s TO queue num:%s \n",
-				thrinfo->thread_id, linebuf->data, thrinfo->output_queue[output_queue_index]->name);
+				"[READ_PRODUCER][thread id : %ld ] send data: %.*s TO queue num:%s \n",
+				thrinfo->thread_id, len, line, thrinfo->output_queue[output_queue_index]->name);
+			res = put_linebuf(thrinfo, output_queue_index, linebuf);
 			if (res < 0)
 			{
 				ADBLOADER_LOG(LOG_ERROR, "[thread id : %ld ] put linebuf to messagequeue failed, data :%s, lineno :%d, filepath :%s",
@@ -207,7 +279,7 @@ read_data_file_and_no_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 				STATE = READ_PRODUCER_PROCESS_ERROR;
 				read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno,
 								linebuf->data, TRUE);
-				fclose(thrinfo->fp);
+				close_data_file(thrinfo);
 				pthread_exit(thrinfo);
 			}
 		}
@@ -217,14 +289,21 @@ read_data_file_and_no_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 			i = 0;
 	}
 
+	if (flush_linebuf_batches(thrinfo) < 0)
+	{
+		STATE = READ_PRODUCER_PROCESS_ERROR;
+		read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno,
+						NULL, TRUE);
+		close_data_file(thrinfo);
+		pthread_exit(thrinfo);
+	}
+
 	/* insert NULL flag, it means read data file over. */
 	for (flag = 0; flag < thrinfo->output_queue_num; flag++)
 	{
 		mq_pipe_put(thrinfo->output_queue[flag], NULL);
 	}
 
-	pg_free(line);
-
 	return;
 }
 
@@ -232,8 +311,7 @@ static void
 read_data_file_and_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 {
 	char        *line = NULL;
-	size_t       len = 0;
-	ssize_t      read_count = 0;
+	int          len = 0;
 	bool         need_redo_queue = false;
 	int          datanodes_num = 0;
 	int          threads_num_per_datanode= 0;
@@ -243,6 +321,7 @@ read_data_file_and_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 	int          output_queue_index = 0;
 	int          flag = 0;
 	int          i = 0;
+	int          holders = 0;
 	bool         filter_first_line = false;
 
 	filter_first_line = thrinfo->filter_first_line;
@@ -261,7 +340,7 @@ read_data_file_and_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 		}
 	}
 
-	while((read_count = getline(&line, &len, thrinfo->fp)) != -1)
+	while((line = read_next_line(thrinfo, &len)) != NULL)
 	{
 		int res = 0;
 		int j = 0;
@@ -278,16 +357,30 @@ read_data_file_and_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 		if (NEED_EXIT)
 		{
 			STATE = READ_PRODUCER_PROCESS_EXIT_BY_CALLER;
-			fclose(thrinfo->fp);
+			close_data_file(thrinfo);
 			pthread_exit(thrinfo);
 		}
 
+		/* the same line goes to every queue to redo, share a single copy of it */
+		holders = 0;
 		for (j = 0; j < datanodes_num; j++)
+		{
+			if (check_need_redo_queue(thrinfo->redo_queue_total,
+									  thrinfo->redo_queue_index,
+									  i + j * threads_num_per_datanode))
+				holders++;
+		}
+
+		if (holders > 0)
 		{
 			linebuf = get_linebuf();
-			appendLineBufInfoString(linebuf, line);
+			appendLineBufInfoBinary(linebuf, line, len);
 			linebuf->fileline = lineno;
+			share_linebuf(linebuf, holders);
+		}
 
+		for (j = 0; j < datanodes_num && holders > 0; j++)
+		{
 			output_queue_index = i + j * threads_num_per_datanode;
 
 			need_redo_queue = check_need_redo_queue(thrinfo->redo_queue_total,
@@ -295,10 +388,10 @@ read_data_file_and_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 													output_queue_index);
 			if (need_redo_queue)
 			{
-				res = mq_pipe_put(thrinfo->output_queue[output_queue_index], linebuf);
 				ADBLOADER_LOG(LOG_DEBUG,
-					"[READ_PRODUCER][thread id : %ld ] send data: %s TO queue num:%s \n",
-					thrinfo->thread_id, linebuf->data, thrinfo->output_queue[output_queue_index]->name);
+					"[READ_PRODUCER][thread id : %ld ] send data: %.*s TO queue num:%s \n",
+					thrinfo->thread_id, len, line, thrinfo->output_queue[output_queue_index]->name);
+				res = put_linebuf(thrinfo, output_queue_index, linebuf);
 				if (res < 0)
 				{
 					ADBLOADER_LOG(LOG_ERROR, "[thread id : %ld ] put linebuf to messagequeue failed, data :%s, lineno :%d, filepath :%s",
@@ -306,7 +399,7 @@ read_data_file_and_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 					STATE = READ_PRODUCER_PROCESS_ERROR;
 					read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno,
 									linebuf->data, TRUE);
-					fclose(thrinfo->fp);
+					close_data_file(thrinfo);
 					pthread_exit(thrinfo);
 				}
 			}
@@ -317,14 +410,21 @@ read_data_file_and_need_redo_for_replication(Read_ThreadInfo *thrinfo)
 			i = 0;
 	}
 
+	if (flush_linebuf_batches(thrinfo) < 0)
+	{
+		STATE = READ_PRODUCER_PROCESS_ERROR;
+		read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno,
+						NULL, TRUE);
+		close_data_file(thrinfo);
+		pthread_exit(thrinfo);
+	}
+
 	/* insert NULL flag, it means read data file over. */
 	for (flag = 0; flag < thrinfo->redo_queue_total; flag++)
 	{
 		mq_pipe_put(thrinfo->output_queue[thrinfo->redo_queue_index[flag]], NULL);
 	}
 
-	pg_free(line);
-
 	return;
 }
 
@@ -332,8 +432,7 @@ static void
 read_data_file_and_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 {
 	char       *line = NULL;
-	size_t      len = 0;
-	ssize_t     read_count = 0;
+	int         len = 0;
 	int         lineno = 0;
 	int         datanodes_num = 0;
 	int         threads_num_per_datanode= 0;
@@ -363,7 +462,7 @@ read_data_file_and_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 		}
 	}
 
-	while((read_count = getline(&line, &len, thrinfo->fp)) != -1)
+	while((line = read_next_line(thrinfo, &len)) != NULL)
 	{
 		int res = 0;
 		int output_queue_num = 0;
@@ -380,12 +479,12 @@ read_data_file_and_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 		if (NEED_EXIT)
 		{
 			STATE = READ_PRODUCER_PROCESS_EXIT_BY_CALLER;
-			fclose(thrinfo->fp);
+			close_data_file(thrinfo);
 			pthread_exit(thrinfo);
 		}
 
 		linebuf = get_linebuf();
-		appendLineBufInfoString(linebuf, line);
+		appendLineBufInfoBinary(linebuf, line, len);
 		linebuf->fileline = lineno;
 
 		output_queue_num = array_output_queue[output_queue_index];
@@ -395,7 +494,7 @@ read_data_file_and_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 
 		if (need_redo_queue)
 		{
-			res = mq_pipe_put(thrinfo->output_queue[output_queue_num], linebuf);
+			res = put_linebuf(thrinfo, output_queue_num, linebuf);
 			ADBLOADER_LOG(LOG_DEBUG,
 					"[READ_PRODUCER][thread id : %ld ] send data: %s TO queue num:%s \n",
 					thrinfo->thread_id, linebuf->data, thrinfo->output_queue[output_queue_num]->name);
@@ -406,7 +505,7 @@ read_data_file_and_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 				STATE = READ_PRODUCER_PROCESS_ERROR;
 				read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno, linebuf->data, TRUE);
 
-				fclose(thrinfo->fp);
+				close_data_file(thrinfo);
 				pthread_exit(thrinfo);
 			}
 		}
@@ -416,14 +515,21 @@ read_data_file_and_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 			output_queue_index = 0;
 	}
 
+	if (flush_linebuf_batches(thrinfo) < 0)
+	{
+		STATE = READ_PRODUCER_PROCESS_ERROR;
+		read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno,
+						NULL, TRUE);
+		close_data_file(thrinfo);
+		pthread_exit(thrinfo);
+	}
+
 	/* insert NULL flag, it means read data file over. */
 	for (flag = 0; flag < thrinfo->redo_queue_total; flag++)
 	{
 		mq_pipe_put(thrinfo->output_queue[thrinfo->redo_queue_index[flag]], NULL);
 	}
 
-	pg_free(line);
-
 	return;
 }
 
@@ -431,8 +537,7 @@ static void
 read_data_file_and_no_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 {
 	char       *line = NULL;
-	size_t      len = 0;
-	ssize_t     read_count = 0;
+	int         len = 0;
 	int         lineno = 0;
 	int         datanodes_num = 0;
 	int         threads_num_per_datanode= 0;
@@ -450,7 +555,7 @@ read_data_file_and_no_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 	output_queue_total = datanodes_num * threads_num_per_datanode;
 	array_output_queue = get_array_output_queue(output_queue_total);
 
-	while((read_count = getline(&line, &len, thrinfo->fp)) != -1)
+	while((line = read_next_line(thrinfo, &len)) != NULL)
 	{
 		int res = 0;
 		int output_queue_num = 0;
@@ -467,16 +572,16 @@ read_data_file_and_no_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 		if (NEED_EXIT)
 		{
 			STATE = READ_PRODUCER_PROCESS_EXIT_BY_CALLER;
-			fclose(thrinfo->fp);
+			close_data_file(thrinfo);
 			pthread_exit(thrinfo);
 		}
 
 		linebuf = get_linebuf();
-		appendLineBufInfoString(linebuf, line);
+		appendLineBufInfoBinary(linebuf, line, len);
 		linebuf->fileline = lineno;
 
 		output_queue_num = array_output_queue[output_queue_index];
-		res = mq_pipe_put(thrinfo->output_queue[output_queue_num], linebuf);
+		res = put_linebuf(thrinfo, output_queue_num, linebuf);
 		ADBLOADER_LOG(LOG_DEBUG,
 				"[READ_PRODUCER][thread id : %ld ] send data: %s TO queue num:%s \n",
 				thrinfo->thread_id, linebuf->data, thrinfo->output_queue[output_queue_num]->name);
@@ -487,7 +592,7 @@ read_data_file_and_no_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 			STATE = READ_PRODUCER_PROCESS_ERROR;
 			read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno, linebuf->data, TRUE);
 
-			fclose(thrinfo->fp);
+			close_data_file(thrinfo);
 			pthread_exit(thrinfo);
 		}
 
@@ -496,14 +601,21 @@ read_data_file_and_no_need_redo_for_roundrobin(Read_ThreadInfo *thrinfo)
 			output_queue_index = 0;
 	}
 
+	if (flush_linebuf_batches(thrinfo) < 0)
+	{
+		STATE = READ_PRODUCER_PROCESS_ERROR;
+		read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno,
+						NULL, TRUE);
+		close_data_file(thrinfo);
+		pthread_exit(thrinfo);
+	}
+
 	/* insert NULL flag, it means read data file over. */
 	for (flag = 0; flag < thrinfo->output_queue_num; flag++)
 	{
 		mq_pipe_put(thrinfo->output_queue[flag], NULL);
 	}
 
-	pg_free(line);
-
 	return;
 }
 
@@ -511,15 +623,14 @@ static void
 read_data_file_for_hash_table(Read_ThreadInfo *thrinfo)
 {
 	char       *line = NULL;
-	size_t      len = 0;
-	ssize_t     read_count = 0;
+	int         len = 0;
 	int         lineno = 0;
 	LineBuffer *linebuf = NULL;
 	int         flag = 0;
 	bool        filter_first_line = false;
 
 	filter_first_line = thrinfo->filter_first_line;
-	while((read_count = getline(&line, &len, thrinfo->fp)) != -1)
+	while((line = read_next_line(thrinfo, &len)) != NULL)
 	{
 		int res;
 		lineno++;
@@ -535,14 +646,14 @@ read_data_file_for_hash_table(Read_ThreadInfo *thrinfo)
 		if (NEED_EXIT)
 		{
 			STATE = READ_PRODUCER_PROCESS_EXIT_BY_CALLER;
-			fclose(thrinfo->fp);
+			close_data_file(thrinfo);
 			pthread_exit(thrinfo);
 		}
 
 		linebuf = get_linebuf();
-		appendLineBufInfoString(linebuf, line);
+		appendLineBufInfoBinary(linebuf, line, len);
 		linebuf->fileline = lineno;
-		res = mq_pipe_put(thrinfo->input_queue, linebuf);
+		res = put_linebuf(thrinfo, 0, linebuf);
 
 		if (res < 0)
 		{
@@ -551,18 +662,25 @@ read_data_file_for_hash_table(Read_ThreadInfo *thrinfo)
 			STATE = READ_PRODUCER_PROCESS_ERROR;
 			read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno,
 								linebuf->data, TRUE);
-			fclose(thrinfo->fp);
+			close_data_file(thrinfo);
 			pthread_exit(thrinfo);
 		}
 	}
 
+	if (flush_linebuf_batches(thrinfo) < 0)
+	{
+		STATE = READ_PRODUCER_PROCESS_ERROR;
+		read_write_error_message(thrinfo, "put linebuf to messagequeue failed", NULL, lineno,
+						NULL, TRUE);
+		close_data_file(thrinfo);
+		pthread_exit(thrinfo);
+	}
+
 	for (flag = 0; flag < thrinfo->end_flag_num; flag++)
 	{
 		mq_pipe_put(thrinfo->input_queue, NULL);
 	}
 
-	pg_free(line);
-
 	return;
 }
 
@@ -590,12 +708,266 @@ get_array_output_queue(int output_queue_total)
 	return array_output_queue;
 }
 
+static MessageQueuePipe *
+get_put_queue(Read_ThreadInfo *thrinfo, int queue_index)
+{
+	if (is_replication_table(thrinfo) || is_roundrobin_table(thrinfo))
+		return thrinfo->output_queue[queue_index];
+
+	Assert(queue_index == 0);
+	return thrinfo->input_queue;
+}
+
+/*
+ * Put "linebuf" to the queue "queue_index", the lines of a data file are
+ * gathered by MQ_PIPE_BATCH_SIZE so that each one does not cost a write on
+ * the pipe. In stream mode the input may pause, so lines are put at once.
+ */
+static int
+put_linebuf(Read_ThreadInfo *thrinfo, int queue_index, LineBuffer *linebuf)
+{
+	LineBufferBatch *batch;
+	int              res = 1;
+
+	if (thrinfo->batches == NULL)
+		return mq_pipe_put(get_put_queue(thrinfo, queue_index), linebuf);
+
+	batch = &thrinfo->batches[queue_index];
+	batch->lines[batch->count++] = linebuf;
+	if (batch->count == MQ_PIPE_BATCH_SIZE)
+	{
+		res = mq_pipe_put_batch(get_put_queue(thrinfo, queue_index), batch->lines, batch->count);
+		batch->count = 0;
+	}
+
+	return res;
+}
+
+static int
+flush_linebuf_batches(Read_ThreadInfo *thrinfo)
+{
+	int queue_num;
+	int i;
+
+	if (thrinfo->batches == NULL)
+		return 1;
+
+	if (is_replication_table(thrinfo) || is_roundrobin_table(thrinfo))
+		queue_num = thrinfo->output_queue_num;
+	else
+		queue_num = 1;
+	for (i = 0; i < queue_num; i++)
+	{
+		LineBufferBatch *batch = &thrinfo->batches[i];
+
+		if (batch->count > 0)
+		{
+			int res = mq_pipe_put_batch(get_put_queue(thrinfo, i), batch->lines, batch->count);
+
+			batch->count = 0;
+			if (res < 0)
+				return res;
+		}
+	}
+
+	return 1;
+}
+
+static const DecompressMethod *
+get_decompress_method(const char *file_path)
+{
+	unsigned char magic[4];
+	int           fd;
+	int           len;
+	int           i;
+
+	if ((fd = open(file_path, O_RDONLY)) < 0)
+		return NULL;
+	len = read(fd, magic, sizeof(magic));
+	close(fd);
+
+	for (i = 0; decompress_methods[i].name != NULL; i++)
+	{
+		if (len >= decompress_methods[i].magic_len &&
+			memcmp(magic, decompress_methods[i].magic, decompress_methods[i].magic_len) == 0)
+			return &decompress_methods[i];
+	}
+
+	return NULL;
+}
+
+static FILE *
+open_decompress_file(const char *file_path, const DecompressMethod *method)
+{
+	LineBuffer *cmd = get_linebuf();
+	const char *p;
+	FILE       *fp;
+
+	/* quote the path for the shell */
+	appendLineBufInfo(cmd, "%s -- '", method->command);
+	for (p = file_path; *p; p++)
+	{
+		if (*p == '\'')
+			appendLineBufInfoString(cmd, "'\\''");
+		else
+			appendLineBufInfoBinary(cmd, p, 1);
+	}
+	appendLineBufInfoString(cmd, "'");
+
+	fp = popen(cmd->data, "r");
+	release_linebuf(cmd);
+
+	return fp;
+}
+
+/*
+ * Close the data file, returns a non zero value if the decompression
+ * program did not succeed.
+ */
+static int
+close_data_file(Read_ThreadInfo *thrinfo)
+{
+	int res;
+
+	if (!thrinfo->fp_is_pipe)
+		return fclose(thrinfo->fp);
+
+	res = pclose(thrinfo->fp);
+	if (res != 0)
+		ADBLOADER_LOG(LOG_ERROR, "[thread id : %ld ] decompression of file %s failed, exit status : %d",
+					thrinfo->thread_id, thrinfo->file_path,
+					WIFEXITED(res) ? WEXITSTATUS(res) : res);
+
+	return res;
+}
+
+static void
+init_block_reader(BlockReader *reader, int fd, int read_file_buffer)
+{
+	MemSet(reader, 0, sizeof(BlockReader));
+
+	reader->fd = fd;
+	reader->escapec = '\\';
+
+	/* READ_FILE_BUFFER is in KB, never read by blocks smaller than the default */
+	if (read_file_buffer > 0 && (size_t) read_file_buffer * 1024 > READ_BLOCK_SIZE)
+		reader->size = (size_t) read_file_buffer * 1024;
+	else
+		reader->size = READ_BLOCK_SIZE;
+
+	reader->buf = (char *) palloc(reader->size);
+}
+
+/*
+ * read_block_line for the read_data_file_* functions, counting the lines
+ * read. The counts are flushed at the end of the file, before the end flags
+ * let the other stages finish.
+ */
+static char *
+read_next_line(Read_ThreadInfo *thrinfo, int *len)
+{
+	char   *line = read_block_line(&thrinfo->reader, len);
+
+	if (line != NULL)
+		load_stats_count(&thrinfo->stats, *len);
+	else
+		load_stats_flush(&thrinfo->stats);
+
+	return line;
+}
+
+/*
+ * Return the next line of the data file, with its trailing newline, and set
+ * "len" to its length. The line points into the block being read, so it is
+ * only valid until the next call. Returns NULL at the end of the file.
+ *
+ * A newline preceded by an odd number of escape characters belongs to the
+ * data, as COPY FROM in text format reads it, so such a line goes on.
+ */
+static char *
+read_block_line(BlockReader *reader, int *len)
+{
+	for (;;)
+	{
+		char   *newline = NULL;
+
+		while (reader->scan < reader->end &&
+			   (newline = memchr(reader->buf + reader->scan, '\n',
+								 reader->end - reader->scan)) != NULL)
+		{
+			char   *p = newline;
+			char   *line = reader->buf + reader->start;
+
+			while (p > line && *(p - 1) == reader->escapec)
+				p--;
+
+			reader->scan = newline - reader->buf + 1;
+			if (((newline - p) & 1) == 0)
+			{
+				*len = (int) (reader->scan - reader->start);
+				reader->start = reader->scan;
+				return line;
+			}
+		}
+		reader->scan = reader->end;
+
+		if (reader->eof)
+		{
+			/* the last line may have no newline */
+			if (reader->start < reader->end)
+			{
+				char   *line = reader->buf + reader->start;
+
+				*len = (int) (reader->end - reader->start);
+				reader->start = reader->end;
+				return line;
+			}
+			return NULL;
+		}
+
+		/* move the pending line at the beginning of the block */
+		if (reader->start > 0)
+		{
+			memmove(reader->buf, reader->buf + reader->start, reader->end - reader->start);
+			reader->end -= reader->start;
+			reader->scan -= reader->start;
+			reader->start = 0;
+		}
+
+		/* a single line fills the whole block, make room for it */
+		if (reader->end == reader->size)
+		{
+			reader->size *= 2;
+			reader->buf = (char *) repalloc(reader->buf, reader->size);
+		}
+
+		for (;;)
+		{
+			ssize_t nread = read(reader->fd, reader->buf + reader->end,
+								 reader->size - reader->end);
+
+			if (nread < 0 && errno == EINTR)
+				continue;
+			if (nread < 0)
+			{
+				ADBLOADER_LOG(LOG_ERROR, "[READ_PRODUCER] could not read data file: %s",
+							strerror(errno));
+				reader->error = true;
+				reader->eof = true;
+			}
+			else if (nread == 0)
+				reader->eof = true;
+			else
+				reader->end += nread;
+			break;
+		}
+	}
+}
+
 void *
 read_threadMain (void *argp)
 {
 	Read_ThreadInfo  *thrinfo = (Read_ThreadInfo*) argp;
-	char             *vbuf = NULL;
-	unsigned long int vbuf_size = 0;
 
 	/* enble cancel this thread. */
 	pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
@@ -615,7 +987,19 @@ read_threadMain (void *argp)
 	}
 	else
 	{
-		if ((thrinfo->fp = fopen(thrinfo->file_path, "r")) == NULL)
+		const DecompressMethod *method = get_decompress_method(thrinfo->file_path);
+
+		if (method != NULL)
+		{
+			ADBLOADER_LOG(LOG_INFO, "[thread id : %ld ] read %s file : %s",
+					thrinfo->thread_id, method->name, thrinfo->file_path);
+			thrinfo->fp = open_decompress_file(thrinfo->file_path, method);
+			thrinfo->fp_is_pipe = true;
+		}
+		else
+			thrinfo->fp = fopen(thrinfo->file_path, "r");
+
+		if (thrinfo->fp == NULL)
 		{
 			ADBLOADER_LOG(LOG_ERROR, "[thread id : %ld ] could not open file: %s",
 					thrinfo->thread_id, thrinfo->file_path);
@@ -623,15 +1007,16 @@ read_threadMain (void *argp)
 									NULL, 0, NULL, TRUE);
 			pthread_exit(thrinfo);
 		}
+	}
 
-		/*set vbuf*/
-		/*use default value 512 byte, if thrinfo->read_file_buffer <= 0*/
-		if (thrinfo->read_file_buffer > 0)
-		{
-			vbuf_size = thrinfo->read_file_buffer * 1024 * sizeof(char);
-			vbuf = (char *)palloc0(vbuf_size);
-			setvbuf(thrinfo->fp, vbuf, _IOFBF, vbuf_size);
-		}
+	init_block_reader(&thrinfo->reader, fileno(thrinfo->fp), thrinfo->read_file_buffer);
+	if (!thrinfo->stream_node)
+	{
+		int queue_num = 1;
+
+		if (is_replication_table(thrinfo) || is_roundrobin_table(thrinfo))
+			queue_num = thrinfo->output_queue_num;
+		thrinfo->batches = (LineBufferBatch *) palloc0(sizeof(LineBufferBatch) * queue_num);
 	}
 
 	if (is_replication_table(thrinfo))
@@ -661,12 +1046,27 @@ read_threadMain (void *argp)
 		read_data_file_for_hash_table(thrinfo);
 	}
 
+	if (thrinfo->reader.error)
+	{
+		STATE = READ_PRODUCER_PROCESS_ERROR;
+		read_write_error_message(thrinfo, "could not read file, check file",
+								NULL, 0, NULL, TRUE);
+		close_data_file(thrinfo);
+		pthread_exit(thrinfo);
+	}
+
+	if (close_data_file(thrinfo) != 0 && thrinfo->fp_is_pipe)
+	{
+		STATE = READ_PRODUCER_PROCESS_ERROR;
+		read_write_error_message(thrinfo, "could not decompress file, check file",
+								NULL, 0, NULL, TRUE);
+		pthread_exit(thrinfo);
+	}
+
 	STATE = READ_PRODUCER_PROCESS_COMPLETE;
 	ADBLOADER_LOG(LOG_INFO, "[thread id : %ld ] read file complete, filepath :%s",
 				thrinfo->thread_id, thrinfo->file_path);
 
-	fclose(thrinfo->fp);
-
 	return NULL;
 }
 
@@ -685,6 +1085,7 @@ init_read_thread(ReadInfo *read_info)
 	read_threadInfo->start_cmd = pg_strdup(read_info->start_cmd);
 	read_threadInfo->filter_first_line = read_info->filter_first_line;
 	read_threadInfo->stream_node = read_info->stream_mode;
+	load_stats_init_counter(&read_threadInfo->stats, LOAD_STAGE_READ, -1);
 	if (read_info->replication || read_info->roundrobin)
 	{
 
@@ -82,6 +82,19 @@ format_error_info(char *message, Module type, char *error_message,
 	return linebuf;
 }
 
+LineBuffer *
+format_file_result (char *file_name, bool success)
+{
+	LineBuffer * linebuf = get_linebuf();
+
+	Assert(file_name != NULL);
+
+	appendLineBufInfo(linebuf, "[%s]%s file: %s\n", get_current_time(),
+					success ? "loaded" : "failed to load", file_name);
+
+	return linebuf;
+}
+
 LineBuffer *
 format_error_end (char *file_name)
 {
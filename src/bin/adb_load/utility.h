@@ -66,6 +66,8 @@ extern LineBuffer *format_error_begin (char *file_name, char *table_type);
 extern LineBuffer *format_error_info (char *message, Module type, char *error_message,
 								      int line_no, char *line_data);
 
+extern LineBuffer *format_file_result (char *file_name, bool success);
+
 extern LineBuffer *format_error_end (char *file_name);
 
 extern ConnectionNode *create_connectionNode(char *database, char *user, char *passw);
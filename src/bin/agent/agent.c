@@ -11,6 +11,7 @@
 #include <sys/wait.h>
 
 #include "getopt_long.h"
+#include "host_stats.h"
 #include "utils/memutils.h"
 
 const char *agent_argv0;
@@ -203,6 +204,7 @@ static void service_run(void)
 	poll_fd.events = POLLIN;
 #else
 	fd_set rfd_set;
+	struct timeval timeout;
 #endif
 
 	PG_exception_stack = &local_sigjmp_buf;
@@ -213,12 +215,16 @@ static void service_run(void)
 
 	for(;;)
 	{
+		/* wake up at least once per interval to read the host counters */
+		host_stats_tick();
 #if defined(HAVE_POLL) && defined(HAVE_POLL_H)
-		rval = poll(&poll_fd, 1, -1);
+		rval = poll(&poll_fd, 1, HOST_STATS_INTERVAL_MS);
 #else
 		FD_ZERO(&rfd_set);
 		FD_SET(listen_sock, &rfd_set);
-		rval = select(listen_sock + 1, &rfd_set, NULL, NULL, NULL);
+		timeout.tv_sec = HOST_STATS_INTERVAL_MS / 1000;
+		timeout.tv_usec = (HOST_STATS_INTERVAL_MS % 1000) * 1000;
+		rval = select(listen_sock + 1, &rfd_set, NULL, NULL, &timeout);
 #endif
 		CHECK_FOR_INTERRUPTS();
 		if(rval < 0)
@@ -228,6 +234,8 @@ static void service_run(void)
 			ereport(FATAL, (errcode_for_socket_access()
 				,errmsg("can not select liste socket:%m")));
 		}
+		if(rval == 0)
+			continue;
 		new_client = accept(listen_sock, NULL, 0);
 		if(new_client == PGINVALID_SOCKET)
 			continue;
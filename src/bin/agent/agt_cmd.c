@@ -20,6 +20,7 @@
 #include "mgr/mgr_msg_type.h"
 #include "conf_scan.h"
 #include "hba_scan.h"
+#include "host_stats.h"
 #include "utils/memutils.h"
 #include "c.h"
 #include "postgres_fe.h"
@@ -1278,14 +1279,18 @@ static void cmd_monitor_gets_hostinfo(void)
 	StringInfoData hostinfostring;
 	initStringInfo(&hostinfostring);
 
-	get_cpu_info(&hostinfostring);
-	get_mem_info(&hostinfostring);
-	get_disk_info(&hostinfostring);
-	get_net_info(&hostinfostring);
-	get_system_info(&hostinfostring);
-	get_platform_type_info(&hostinfostring);
-	get_host_info(&hostinfostring);
-	get_disk_iops_info(&hostinfostring);
+	/* read /proc where there is one, else ask host_info.py */
+	if (!host_stats_collect(&hostinfostring))
+	{
+		get_cpu_info(&hostinfostring);
+		get_mem_info(&hostinfostring);
+		get_disk_info(&hostinfostring);
+		get_net_info(&hostinfostring);
+		get_system_info(&hostinfostring);
+		get_platform_type_info(&hostinfostring);
+		get_host_info(&hostinfostring);
+		get_disk_iops_info(&hostinfostring);
+	}
 	appendStringInfoCharMacro(&hostinfostring, '\0');
 
 	agt_put_msg(AGT_MSG_RESULT, hostinfostring.data, hostinfostring.len);
@@ -0,0 +1 @@
+../../../src/bin/agent/uptime_linux.c
\ No newline at end of file
@@ -0,0 +1,376 @@
+/*
+ * host metrics read from /proc
+ *
+ * The listening agent process reads the cumulative counters of the cpu, the
+ * disks and the network every HOST_STATS_INTERVAL_MS and keeps the last two
+ * readings. The process forked for a manager connection inherits them, so
+ * answering a request only takes one more reading: the rates are the deltas
+ * since an inherited reading, no sampling interval is waited for.
+ *
+ * Where /proc is not available host_stats_collect returns false and the
+ * caller falls back on host_info.py.
+ */
+#include "agent.h"
+
+#include <sys/statvfs.h>
+#include <sys/time.h>
+#include <sys/utsname.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "host_stats.h"
+
+extern bool get_host_info(StringInfo hostinfostring);
+extern bool get_system_info(StringInfo hostinfostring);
+
+typedef struct HostStatsSnapshot
+{
+	bool		valid;
+	struct timeval time;
+	uint64		cpu_total;		/* jiffies of all the cpu states */
+	uint64		cpu_idle;		/* jiffies of idle and iowait */
+	uint64		disk_read_bytes;
+	uint64		disk_read_ms;
+	uint64		disk_write_bytes;
+	uint64		disk_write_ms;
+	uint64		disk_ios;		/* reads and writes completed */
+	uint64		net_sent_bytes;
+	uint64		net_recv_bytes;
+} HostStatsSnapshot;
+
+/* the readings of the listening process, copied into the forked ones */
+static HostStatsSnapshot last_snapshot;
+static HostStatsSnapshot prev_snapshot;
+
+static bool read_snapshot(HostStatsSnapshot *snap);
+static bool read_cpu_counters(HostStatsSnapshot *snap);
+static void read_disk_counters(HostStatsSnapshot *snap);
+static void read_net_counters(HostStatsSnapshot *snap);
+static bool read_meminfo(uint64 *total, uint64 *available);
+static void read_cpu_freq(char *freq, size_t len);
+static double elapsed_seconds(struct timeval *since, struct timeval *now);
+static void stats_append_str(StringInfo hostinfostring, const char *str);
+static void stats_append_int64(StringInfo hostinfostring, int64 i);
+static void stats_append_float(StringInfo hostinfostring, float f);
+
+/*
+ * Read the counters again if HOST_STATS_INTERVAL_MS passed since the last
+ * reading, called by the listening process each time it wakes up.
+ */
+void
+host_stats_tick(void)
+{
+	HostStatsSnapshot snap;
+	struct timeval now;
+
+	gettimeofday(&now, NULL);
+	if (last_snapshot.valid &&
+		elapsed_seconds(&last_snapshot.time, &now) * 1000 < HOST_STATS_INTERVAL_MS)
+		return;
+
+	if (read_snapshot(&snap))
+	{
+		prev_snapshot = last_snapshot;
+		last_snapshot = snap;
+	}
+}
+
+/*
+ * Append the fields of the host info answer, in the order monitor_get_hostinfo
+ * reads them: cpu, memory, disk, network, system, platform, cores and uptime,
+ * then disk iops. Returns false without appending anything if the counters
+ * can not be read.
+ */
+bool
+host_stats_collect(StringInfo hostinfostring)
+{
+	HostStatsSnapshot now;
+	HostStatsSnapshot *base;
+	struct statvfs fs;
+	struct utsname name;
+	uint64		mem_total;
+	uint64		mem_available;
+	uint64		disk_total = 0;
+	uint64		disk_used = 0;
+	double		seconds;
+	float		cpu_usage = 0;
+	float		mem_usage = 0;
+	float		disk_iops = 0;
+	int64		net_sent = 0;
+	int64		net_recv = 0;
+	char		timestamp[64];
+	char		freq[64];
+	time_t		t;
+
+	if (!read_snapshot(&now) || !read_meminfo(&mem_total, &mem_available))
+		return false;
+
+	/* the newest inherited reading old enough to give a meaningful rate */
+	if (last_snapshot.valid &&
+		elapsed_seconds(&last_snapshot.time, &now.time) * 2000 >= HOST_STATS_INTERVAL_MS)
+		base = &last_snapshot;
+	else if (prev_snapshot.valid)
+		base = &prev_snapshot;
+	else
+	{
+		/* the agent just started, sample once */
+		prev_snapshot = now;
+		pg_usleep(HOST_STATS_INTERVAL_MS * 1000L);
+		if (!read_snapshot(&now))
+			return false;
+		base = &prev_snapshot;
+	}
+
+	seconds = elapsed_seconds(&base->time, &now.time);
+	if (now.cpu_total > base->cpu_total)
+		cpu_usage = 100.0 * (1.0 - (double) (now.cpu_idle - base->cpu_idle) /
+							 (now.cpu_total - base->cpu_total));
+	if (seconds > 0)
+	{
+		net_sent = (int64) ((now.net_sent_bytes - base->net_sent_bytes) / seconds);
+		net_recv = (int64) ((now.net_recv_bytes - base->net_recv_bytes) / seconds);
+		disk_iops = (float) ((now.disk_ios - base->disk_ios) / seconds);
+	}
+	if (mem_total > 0)
+		mem_usage = 100.0 * (mem_total - mem_available) / mem_total;
+
+	if (statvfs("/", &fs) == 0)
+	{
+		disk_total = (uint64) fs.f_blocks * fs.f_frsize;
+		disk_used = (uint64) (fs.f_blocks - fs.f_bfree) * fs.f_frsize;
+	}
+
+	t = time(NULL);
+	strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S GMT", gmtime(&t));
+	read_cpu_freq(freq, sizeof(freq));
+
+	/* cpu */
+	stats_append_str(hostinfostring, timestamp);
+	stats_append_float(hostinfostring, cpu_usage);
+	stats_append_str(hostinfostring, freq);
+
+	/* memory */
+	stats_append_str(hostinfostring, timestamp);
+	stats_append_int64(hostinfostring, mem_total);
+	stats_append_int64(hostinfostring, mem_total - mem_available);
+	stats_append_float(hostinfostring, mem_usage);
+
+	/* disk */
+	stats_append_str(hostinfostring, timestamp);
+	stats_append_int64(hostinfostring, now.disk_read_bytes);
+	stats_append_int64(hostinfostring, now.disk_read_ms);
+	stats_append_int64(hostinfostring, now.disk_write_bytes);
+	stats_append_int64(hostinfostring, now.disk_write_ms);
+	stats_append_int64(hostinfostring, disk_total);
+	stats_append_int64(hostinfostring, disk_used);
+
+	/* network */
+	stats_append_str(hostinfostring, timestamp);
+	stats_append_int64(hostinfostring, net_sent);
+	stats_append_int64(hostinfostring, net_recv);
+
+	/* system, kept from lsb_release as it is not a counter */
+	if (!get_system_info(hostinfostring))
+		stats_append_str(hostinfostring, "");
+	if (uname(&name) == 0)
+		stats_append_str(hostinfostring, name.machine);
+	else
+		stats_append_str(hostinfostring, "");
+
+	/* cores and uptime */
+	get_host_info(hostinfostring);
+
+	stats_append_float(hostinfostring, disk_iops);
+
+	return true;
+}
+
+static bool
+read_snapshot(HostStatsSnapshot *snap)
+{
+	MemSet(snap, 0, sizeof(*snap));
+	gettimeofday(&snap->time, NULL);
+	if (!read_cpu_counters(snap))
+		return false;
+	read_disk_counters(snap);
+	read_net_counters(snap);
+	snap->valid = true;
+	return true;
+}
+
+/* first line of /proc/stat, the states after steal count in user already */
+static bool
+read_cpu_counters(HostStatsSnapshot *snap)
+{
+	FILE	   *f;
+	unsigned long long v[8];
+	int			n;
+	int			i;
+
+	if ((f = fopen("/proc/stat", "r")) == NULL)
+		return false;
+	MemSet(v, 0, sizeof(v));
+	n = fscanf(f, "cpu %llu %llu %llu %llu %llu %llu %llu %llu",
+			   &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7]);
+	fclose(f);
+	if (n < 4)
+		return false;
+
+	for (i = 0; i < lengthof(v); i++)
+		snap->cpu_total += v[i];
+	snap->cpu_idle = v[3] + v[4];
+	return true;
+}
+
+/*
+ * /proc/diskstats, only the physical disks are counted, the partitions and
+ * the device mapper or md volumes would count the same requests again
+ */
+static void
+read_disk_counters(HostStatsSnapshot *snap)
+{
+	FILE	   *f;
+	char		line[512];
+	char		devname[128];
+	char		path[MAXPGPATH];
+	unsigned long long reads, rd_sectors, rd_ms, writes, wr_sectors, wr_ms;
+
+	if ((f = fopen("/proc/diskstats", "r")) == NULL)
+		return;
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		if (sscanf(line, "%*u %*u %127s %llu %*u %llu %llu %llu %*u %llu %llu",
+				   devname, &reads, &rd_sectors, &rd_ms,
+				   &writes, &wr_sectors, &wr_ms) != 7)
+			continue;
+		snprintf(path, sizeof(path), "/sys/block/%s/device", devname);
+		if (access(path, F_OK) != 0)
+			continue;
+
+		snap->disk_read_bytes += rd_sectors * 512;
+		snap->disk_read_ms += rd_ms;
+		snap->disk_write_bytes += wr_sectors * 512;
+		snap->disk_write_ms += wr_ms;
+		snap->disk_ios += reads + writes;
+	}
+	fclose(f);
+}
+
+/* /proc/net/dev, all the interfaces like psutil.net_io_counters() */
+static void
+read_net_counters(HostStatsSnapshot *snap)
+{
+	FILE	   *f;
+	char		line[512];
+	char	   *p;
+	unsigned long long recv, sent;
+
+	if ((f = fopen("/proc/net/dev", "r")) == NULL)
+		return;
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		/* the two header lines have no colon */
+		if ((p = strchr(line, ':')) == NULL)
+			continue;
+		if (sscanf(p + 1, "%llu %*u %*u %*u %*u %*u %*u %*u %llu",
+				   &recv, &sent) != 2)
+			continue;
+		snap->net_recv_bytes += recv;
+		snap->net_sent_bytes += sent;
+	}
+	fclose(f);
+}
+
+/*
+ * total and available memory in bytes, available is estimated from the free
+ * and cache memory by kernels older than MemAvailable
+ */
+static bool
+read_meminfo(uint64 *total, uint64 *available)
+{
+	FILE	   *f;
+	char		line[256];
+	unsigned long long value;
+	uint64		memfree = 0,
+				buffers = 0,
+				cached = 0;
+	bool		has_available = false;
+
+	*total = 0;
+	*available = 0;
+	if ((f = fopen("/proc/meminfo", "r")) == NULL)
+		return false;
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		if (sscanf(line, "MemTotal: %llu kB", &value) == 1)
+			*total = value * 1024;
+		else if (sscanf(line, "MemAvailable: %llu kB", &value) == 1)
+		{
+			*available = value * 1024;
+			has_available = true;
+		}
+		else if (sscanf(line, "MemFree: %llu kB", &value) == 1)
+			memfree = value * 1024;
+		else if (sscanf(line, "Buffers: %llu kB", &value) == 1)
+			buffers = value * 1024;
+		else if (sscanf(line, "Cached: %llu kB", &value) == 1)
+			cached = value * 1024;
+	}
+	fclose(f);
+
+	if (!has_available)
+		*available = Min(memfree + buffers + cached, *total);
+	return *total > 0;
+}
+
+/* the frequency in the cpu model name, as "2.40GHz", empty if there is none */
+static void
+read_cpu_freq(char *freq, size_t len)
+{
+	FILE	   *f;
+	char		line[512];
+	char	   *p;
+
+	freq[0] = '\0';
+	if ((f = fopen("/proc/cpuinfo", "r")) == NULL)
+		return;
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		if (strstr(line, "GHz") == NULL || (p = strchr(line, '@')) == NULL)
+			continue;
+		for (p++; *p == ' ' || *p == '\t'; p++)
+			;
+		strlcpy(freq, p, len);
+		if ((p = strchr(freq, '\n')) != NULL)
+			*p = '\0';
+		break;
+	}
+	fclose(f);
+}
+
+static double
+elapsed_seconds(struct timeval *since, struct timeval *now)
+{
+	return (now->tv_sec - since->tv_sec) + (now->tv_usec - since->tv_usec) / 1000000.0;
+}
+
+static void
+stats_append_str(StringInfo hostinfostring, const char *str)
+{
+	appendStringInfoString(hostinfostring, str);
+	appendStringInfoCharMacro(hostinfostring, '\0');
+}
+
+static void
+stats_append_int64(StringInfo hostinfostring, int64 i)
+{
+	appendStringInfo(hostinfostring, INT64_FORMAT, i);
+	appendStringInfoCharMacro(hostinfostring, '\0');
+}
+
+static void
+stats_append_float(StringInfo hostinfostring, float f)
+{
+	appendStringInfo(hostinfostring, "%0.2f", f);
+	appendStringInfoCharMacro(hostinfostring, '\0');
+}
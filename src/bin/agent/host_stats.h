@@ -0,0 +1,12 @@
+#ifndef HOST_STATS_H
+#define HOST_STATS_H
+
+#include "lib/stringinfo.h"
+
+/* milliseconds between two samples of the counters taken by the agent */
+#define HOST_STATS_INTERVAL_MS	1000
+
+extern void host_stats_tick(void);
+extern bool host_stats_collect(StringInfo hostinfostring);
+
+#endif /* HOST_STATS_H */
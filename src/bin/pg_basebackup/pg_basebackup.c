@@ -42,6 +42,8 @@ char	   *label = "pg_basebackup base backup";
 bool		showprogress = false;
 int			verbose = 0;
 int			compresslevel = 0;
+int			streamcompresslevel = 0;
+char	   *incremental = NULL;	/* send the blocks changed since this LSN */
 bool		includewal = false;
 bool		streamwal = false;
 bool		fastcheckpoint = false;
@@ -73,6 +75,17 @@ static volatile LONG has_xlogendptr = 0;
 /* Contents of recovery.conf to be generated */
 static PQExpBuffer recoveryconfcontents = NULL;
 
+#ifdef HAVE_LIBZ
+/*
+ * Inflates the CopyData messages of a backup asked with COMPRESS, the server
+ * flushes its deflate stream after each message so every message inflates
+ * back into the data it would have held uncompressed.
+ */
+static z_stream copy_data_zstream;
+static char *copy_data_zbuf = NULL;
+static size_t copy_data_zbuf_size = 0;
+#endif
+
 /* Function headers */
 static void usage(void);
 static void disconnect_and_exit(int code);
@@ -81,6 +94,8 @@ static void progress_report(int tablespacenum, const char *filename);
 
 static void ReceiveTarFile(PGconn *conn, PGresult *res, int rownum);
 static void ReceiveAndUnpackTarFile(PGconn *conn, PGresult *res, int rownum);
+static int	GetCopyData(PGconn *conn, char **buffer);
+static void FreeCopyData(char *buffer);
 static void GenerateRecoveryConf(PGconn *conn);
 static void WriteRecoveryConf(void);
 static void BaseBackup(void);
@@ -140,6 +155,11 @@ usage(void)
 			 "                         include required WAL files with specified method\n"));
 	printf(_("  -z, --gzip             compress tar output\n"));
 	printf(_("  -Z, --compress=0-9     compress tar output with given compression level\n"));
+	printf(_("      --stream-compress=0-9\n"
+			 "                         compress the data sent by the server with given level\n"));
+	printf(_("      --incremental=LOCATION\n"
+			 "                         only copy the blocks changed since the start location\n"
+			 "                         of an earlier backup\n"));
 	printf(_("\nGeneral options:\n"));
 	printf(_("  -c, --checkpoint=fast|spread\n"
 			 "                         set fast or spread checkpointing\n"));
@@ -693,11 +713,11 @@ ReceiveTarFile(PGconn *conn, PGresult *res, int rownum)
 
 		if (copybuf != NULL)
 		{
-			PQfreemem(copybuf);
+			FreeCopyData(copybuf);
 			copybuf = NULL;
 		}
 
-		r = PQgetCopyData(conn, &copybuf, 0);
+		r = GetCopyData(conn, &copybuf);
 		if (r == -1)
 		{
 			/*
@@ -890,7 +910,7 @@ ReceiveTarFile(PGconn *conn, PGresult *res, int rownum)
 	}							/* while (1) */
 
 	if (copybuf != NULL)
-		PQfreemem(copybuf);
+		FreeCopyData(copybuf);
 }
 
 /*
@@ -936,11 +956,11 @@ ReceiveAndUnpackTarFile(PGconn *conn, PGresult *res, int rownum)
 
 		if (copybuf != NULL)
 		{
-			PQfreemem(copybuf);
+			FreeCopyData(copybuf);
 			copybuf = NULL;
 		}
 
-		r = PQgetCopyData(conn, &copybuf, 0);
+		r = GetCopyData(conn, &copybuf);
 
 		if (r == -1)
 		{
@@ -1127,12 +1147,78 @@ ReceiveAndUnpackTarFile(PGconn *conn, PGresult *res, int rownum)
 	}
 
 	if (copybuf != NULL)
-		PQfreemem(copybuf);
+		FreeCopyData(copybuf);
 
 	if (basetablespace && writerecoveryconf)
 		WriteRecoveryConf();
 }
 
+/*
+ * PQgetCopyData in blocking mode, inflating the message if the server
+ * compresses the stream. An inflated message stays valid until the next
+ * call and must be released by FreeCopyData.
+ */
+static int
+GetCopyData(PGconn *conn, char **buffer)
+{
+#ifdef HAVE_LIBZ
+	char	   *zbuf;
+	int			r;
+
+	if (streamcompresslevel == 0)
+		return PQgetCopyData(conn, buffer, 0);
+
+	do
+	{
+		r = PQgetCopyData(conn, &zbuf, 0);
+		if (r < 0)
+			return r;
+
+		copy_data_zstream.next_in = (Bytef *) zbuf;
+		copy_data_zstream.avail_in = r;
+		copy_data_zstream.next_out = (Bytef *) copy_data_zbuf;
+		copy_data_zstream.avail_out = copy_data_zbuf_size;
+		for (;;)
+		{
+			int			zr = inflate(&copy_data_zstream, Z_SYNC_FLUSH);
+
+			if (zr != Z_OK && zr != Z_BUF_ERROR)
+			{
+				fprintf(stderr, _("%s: could not uncompress COPY data: %s\n"),
+						progname, copy_data_zstream.msg ? copy_data_zstream.msg : "unknown error");
+				disconnect_and_exit(1);
+			}
+			if (copy_data_zstream.avail_in == 0 && copy_data_zstream.avail_out > 0)
+				break;
+			if (copy_data_zstream.avail_out == 0)
+			{
+				/* more output than the buffer holds, make it larger */
+				size_t		done = copy_data_zbuf_size;
+
+				copy_data_zbuf_size *= 2;
+				copy_data_zbuf = pg_realloc(copy_data_zbuf, copy_data_zbuf_size);
+				copy_data_zstream.next_out = (Bytef *) copy_data_zbuf + done;
+				copy_data_zstream.avail_out = copy_data_zbuf_size - done;
+			}
+		}
+		PQfreemem(zbuf);
+		r = copy_data_zbuf_size - copy_data_zstream.avail_out;
+	} while (r == 0);
+
+	*buffer = copy_data_zbuf;
+	return r;
+#else
+	return PQgetCopyData(conn, buffer, 0);
+#endif
+}
+
+static void
+FreeCopyData(char *buffer)
+{
+	if (streamcompresslevel == 0)
+		PQfreemem(buffer);
+}
+
 /*
  * Escape a parameter value so that it can be used as part of a libpq
  * connection string, e.g. in:
@@ -1410,6 +1496,28 @@ BaseBackup(void)
 			 includewal && !streamwal ? "WAL" : "",
 			 fastcheckpoint ? "FAST" : "",
 			 includewal ? "NOWAIT" : "");
+	if (streamcompresslevel != 0)
+	{
+#ifdef HAVE_LIBZ
+		snprintf(current_path + strlen(current_path),
+				 sizeof(current_path) - strlen(current_path),
+				 " COMPRESS %d", streamcompresslevel);
+
+		MemSet(&copy_data_zstream, 0, sizeof(copy_data_zstream));
+		if (inflateInit(&copy_data_zstream) != Z_OK)
+		{
+			fprintf(stderr, _("%s: could not initialize compression library: %s\n"),
+					progname, copy_data_zstream.msg ? copy_data_zstream.msg : "unknown error");
+			disconnect_and_exit(1);
+		}
+		copy_data_zbuf_size = 65536;
+		copy_data_zbuf = pg_malloc(copy_data_zbuf_size);
+#endif
+	}
+	if (incremental != NULL)
+		snprintf(current_path + strlen(current_path),
+				 sizeof(current_path) - strlen(current_path),
+				 " INCREMENTAL '%s'", incremental);
 
 	if (PQsendQuery(conn, current_path) == 0)
 	{
@@ -1683,6 +1791,8 @@ main(int argc, char **argv)
 		{"xlog-method", required_argument, NULL, 'X'},
 		{"gzip", no_argument, NULL, 'z'},
 		{"compress", required_argument, NULL, 'Z'},
+		{"stream-compress", required_argument, NULL, 1},
+		{"incremental", required_argument, NULL, 2},
 		{"label", required_argument, NULL, 'l'},
 		{"dbname", required_argument, NULL, 'd'},
 		{"host", required_argument, NULL, 'h'},
@@ -1796,6 +1906,29 @@ main(int argc, char **argv)
 					exit(1);
 				}
 				break;
+			case 1:
+				streamcompresslevel = atoi(optarg);
+				if (streamcompresslevel < 0 || streamcompresslevel > 9)
+				{
+					fprintf(stderr, _("%s: invalid compression level \"%s\"\n"),
+							progname, optarg);
+					exit(1);
+				}
+				break;
+			case 2:
+				{
+					uint32		hi,
+								lo;
+
+					if (sscanf(optarg, "%X/%X", &hi, &lo) != 2)
+					{
+						fprintf(stderr, _("%s: invalid incremental backup location \"%s\"\n"),
+								progname, optarg);
+						exit(1);
+					}
+					incremental = pg_strdup(optarg);
+				}
+				break;
 			case 'c':
 				if (pg_strcasecmp(optarg, "fast") == 0)
 					fastcheckpoint = true;
@@ -1900,7 +2033,7 @@ main(int argc, char **argv)
 	}
 
 #ifndef HAVE_LIBZ
-	if (compresslevel != 0)
+	if (compresslevel != 0 || streamcompresslevel != 0)
 	{
 		fprintf(stderr,
 				_("%s: this build does not support compression\n"),
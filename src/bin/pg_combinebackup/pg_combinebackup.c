@@ -0,0 +1,533 @@
+/*-------------------------------------------------------------------------
+ *
+ * pg_combinebackup.c
+ *
+ *	  Rebuild a full base backup from an older one and an incremental
+ *	  backup taken with pg_basebackup --incremental.
+ *
+ * Every file of the incremental backup is copied to the output directory,
+ * except the "<segment>.incr" files of the relations, which are rebuilt
+ * from the blocks they have and the other blocks of the same segment in
+ * the older backup.  Files the incremental backup does not have were
+ * dropped since, so they are left out.  Both backups are plain format.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/bin/pg_combinebackup/pg_combinebackup.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres_fe.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "access/xlogdefs.h"
+#include "getopt_long.h"
+#include "replication/incrbackup.h"
+
+#define BACKUP_LABEL_FILE		"backup_label"
+#define START_LABEL_LINE		"START WAL LOCATION: "
+
+#define COPY_BUF_SIZE			(64 * 1024)
+
+static const char *progname;
+static bool verbose = false;
+
+static void usage(void);
+static void read_backup_label(const char *dir, XLogRecPtr *startptr,
+				  XLogRecPtr *incrptr);
+static void combine_dir(const char *fulldir, const char *incrdir,
+			const char *outdir);
+static void combine_file(const char *fullpath, const char *incrpath,
+			 const char *outpath);
+static void copy_file(const char *frompath, const char *topath, bool label);
+static void read_fully(int fd, char *buf, size_t len, const char *path);
+static void write_fully(int fd, const char *buf, size_t len, const char *path);
+
+
+int
+main(int argc, char *argv[])
+{
+	static struct option long_options[] = {
+		{"output", required_argument, NULL, 'o'},
+		{"verbose", no_argument, NULL, 'v'},
+		{NULL, 0, NULL, 0}
+	};
+	char	   *outdir = NULL;
+	char	   *fulldir;
+	char	   *incrdir;
+	XLogRecPtr	fullstart;
+	XLogRecPtr	fullincr;
+	XLogRecPtr	incrstart;
+	XLogRecPtr	incrfrom;
+	char		labelpath[MAXPGPATH];
+	struct stat st;
+	int			c;
+	int			option_index;
+
+	set_pglocale_pgservice(argv[0], PG_TEXTDOMAIN("pg_combinebackup"));
+
+	progname = get_progname(argv[0]);
+
+	if (argc > 1)
+	{
+		if (strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-?") == 0)
+		{
+			usage();
+			exit(0);
+		}
+		if (strcmp(argv[1], "--version") == 0 || strcmp(argv[1], "-V") == 0)
+		{
+			puts("pg_combinebackup (PostgreSQL) " PG_VERSION);
+			exit(0);
+		}
+	}
+
+	while ((c = getopt_long(argc, argv, "o:v", long_options,
+							&option_index)) != -1)
+	{
+		switch (c)
+		{
+			case 'o':
+				outdir = pg_strdup(optarg);
+				canonicalize_path(outdir);
+				break;
+			case 'v':
+				verbose = true;
+				break;
+			default:
+				fprintf(stderr, _("Try \"%s --help\" for more information.\n"),
+						progname);
+				exit(1);
+		}
+	}
+
+	if (optind + 2 != argc || outdir == NULL)
+	{
+		if (outdir == NULL)
+			fprintf(stderr, _("%s: no output directory specified\n"),
+					progname);
+		else
+			fprintf(stderr, _("%s: a full and an incremental backup directory must be specified\n"),
+					progname);
+		fprintf(stderr, _("Try \"%s --help\" for more information.\n"),
+				progname);
+		exit(1);
+	}
+	fulldir = pg_strdup(argv[optind]);
+	incrdir = pg_strdup(argv[optind + 1]);
+	canonicalize_path(fulldir);
+	canonicalize_path(incrdir);
+
+	/*
+	 * Only the data directory has a backup_label; the directories of the
+	 * tablespaces are combined one by one, without it.
+	 */
+	snprintf(labelpath, sizeof(labelpath), "%s/%s", incrdir, BACKUP_LABEL_FILE);
+	if (stat(labelpath, &st) == 0)
+	{
+		read_backup_label(fulldir, &fullstart, &fullincr);
+		read_backup_label(incrdir, &incrstart, &incrfrom);
+
+		if (!XLogRecPtrIsInvalid(fullincr))
+		{
+			fprintf(stderr, _("%s: \"%s\" is an incremental backup, combine it first\n"),
+					progname, fulldir);
+			exit(1);
+		}
+		if (XLogRecPtrIsInvalid(incrfrom))
+		{
+			fprintf(stderr, _("%s: \"%s\" is not an incremental backup\n"),
+					progname, incrdir);
+			exit(1);
+		}
+
+		/*
+		 * The blocks missing from the incremental backup did not change
+		 * after incrfrom, so the full backup must not be older.
+		 */
+		if (incrfrom > fullstart)
+		{
+			fprintf(stderr, _("%s: incremental backup is based on %X/%X, but the full backup starts at %X/%X\n"),
+					progname,
+					(uint32) (incrfrom >> 32), (uint32) incrfrom,
+					(uint32) (fullstart >> 32), (uint32) fullstart);
+			exit(1);
+		}
+	}
+
+	if (mkdir(outdir, S_IRWXU) != 0 && errno != EEXIST)
+	{
+		fprintf(stderr, _("%s: could not create directory \"%s\": %s\n"),
+				progname, outdir, strerror(errno));
+		exit(1);
+	}
+
+	combine_dir(fulldir, incrdir, outdir);
+
+	if (verbose)
+		fprintf(stderr, _("%s: combined backup written to \"%s\"\n"),
+				progname, outdir);
+
+	return 0;
+}
+
+static void
+usage(void)
+{
+	printf(_("%s rebuilds a full base backup from an older one and an incremental backup.\n\n"),
+		   progname);
+	printf(_("Usage:\n"));
+	printf(_("  %s [OPTION]... -o OUTDIR FULLDIR INCRDIR\n"), progname);
+	printf(_("\nOptions:\n"));
+	printf(_("  -o, --output=OUTDIR    write the combined backup into directory\n"));
+	printf(_("  -v, --verbose          output verbose messages\n"));
+	printf(_("  -V, --version          output version information, then exit\n"));
+	printf(_("  -?, --help             show this help, then exit\n"));
+	printf(_("\nFULLDIR is a full plain format backup, or one combined before, and INCRDIR\n"
+			 "a plain format backup taken with pg_basebackup --incremental.\n"));
+	printf(_("\nReport bugs to <pgsql-bugs@postgresql.org>.\n"));
+}
+
+/*
+ * Read the start location of the backup in "dir", and the location it is
+ * incremental from, or InvalidXLogRecPtr for a full backup.
+ */
+static void
+read_backup_label(const char *dir, XLogRecPtr *startptr, XLogRecPtr *incrptr)
+{
+	char		path[MAXPGPATH];
+	char		line[MAXPGPATH];
+	FILE	   *fp;
+	uint32		hi,
+				lo;
+	bool		found = false;
+
+	*startptr = InvalidXLogRecPtr;
+	*incrptr = InvalidXLogRecPtr;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, BACKUP_LABEL_FILE);
+	if ((fp = fopen(path, "r")) == NULL)
+	{
+		fprintf(stderr, _("%s: could not open file \"%s\": %s\n"),
+				progname, path, strerror(errno));
+		exit(1);
+	}
+
+	while (fgets(line, sizeof(line), fp) != NULL)
+	{
+		if (strncmp(line, START_LABEL_LINE, strlen(START_LABEL_LINE)) == 0 &&
+			sscanf(line + strlen(START_LABEL_LINE), "%X/%X", &hi, &lo) == 2)
+		{
+			*startptr = ((uint64) hi) << 32 | lo;
+			found = true;
+		}
+		else if (strncmp(line, INCREMENTAL_LABEL_LINE,
+						 strlen(INCREMENTAL_LABEL_LINE)) == 0 &&
+				 sscanf(line + strlen(INCREMENTAL_LABEL_LINE), "%X/%X",
+						&hi, &lo) == 2)
+			*incrptr = ((uint64) hi) << 32 | lo;
+	}
+	fclose(fp);
+
+	if (!found)
+	{
+		fprintf(stderr, _("%s: invalid data in file \"%s\"\n"),
+				progname, path);
+		exit(1);
+	}
+}
+
+/*
+ * Combine the directory "incrdir" of the incremental backup with "fulldir"
+ * of the full one into "outdir", which exists already.
+ */
+static void
+combine_dir(const char *fulldir, const char *incrdir, const char *outdir)
+{
+	DIR		   *dir;
+	struct dirent *de;
+
+	if ((dir = opendir(incrdir)) == NULL)
+	{
+		fprintf(stderr, _("%s: could not open directory \"%s\": %s\n"),
+				progname, incrdir, strerror(errno));
+		exit(1);
+	}
+
+	while (errno = 0, (de = readdir(dir)) != NULL)
+	{
+		char		fullpath[MAXPGPATH];
+		char		incrpath[MAXPGPATH];
+		char		outpath[MAXPGPATH];
+		struct stat st;
+		size_t		namelen = strlen(de->d_name);
+		size_t		suffixlen = strlen(INCREMENTAL_FILE_SUFFIX);
+
+		if (strcmp(de->d_name, ".") == 0 || strcmp(de->d_name, "..") == 0)
+			continue;
+
+		snprintf(incrpath, sizeof(incrpath), "%s/%s", incrdir, de->d_name);
+		snprintf(fullpath, sizeof(fullpath), "%s/%s", fulldir, de->d_name);
+		snprintf(outpath, sizeof(outpath), "%s/%s", outdir, de->d_name);
+
+		if (lstat(incrpath, &st) != 0)
+		{
+			fprintf(stderr, _("%s: could not stat file \"%s\": %s\n"),
+					progname, incrpath, strerror(errno));
+			exit(1);
+		}
+
+		if (S_ISDIR(st.st_mode))
+		{
+			if (mkdir(outpath, S_IRWXU) != 0 && errno != EEXIST)
+			{
+				fprintf(stderr, _("%s: could not create directory \"%s\": %s\n"),
+						progname, outpath, strerror(errno));
+				exit(1);
+			}
+			combine_dir(fullpath, incrpath, outpath);
+		}
+#ifndef WIN32
+		else if (S_ISLNK(st.st_mode))
+		{
+			char		target[MAXPGPATH];
+			int			len;
+
+			/* the links of pg_tblspc point where the backup put them */
+			len = readlink(incrpath, target, sizeof(target) - 1);
+			if (len < 0)
+			{
+				fprintf(stderr, _("%s: could not read symbolic link \"%s\": %s\n"),
+						progname, incrpath, strerror(errno));
+				exit(1);
+			}
+			target[len] = '\0';
+			if (symlink(target, outpath) != 0 && errno != EEXIST)
+			{
+				fprintf(stderr, _("%s: could not create symbolic link \"%s\": %s\n"),
+						progname, outpath, strerror(errno));
+				exit(1);
+			}
+		}
+#endif
+		else if (S_ISREG(st.st_mode))
+		{
+			if (namelen > suffixlen &&
+				strcmp(de->d_name + namelen - suffixlen,
+					   INCREMENTAL_FILE_SUFFIX) == 0)
+			{
+				/* rebuild the segment under its own name */
+				fullpath[strlen(fullpath) - suffixlen] = '\0';
+				outpath[strlen(outpath) - suffixlen] = '\0';
+				combine_file(fullpath, incrpath, outpath);
+			}
+			else
+				copy_file(incrpath, outpath,
+						  strcmp(de->d_name, BACKUP_LABEL_FILE) == 0);
+		}
+	}
+
+	if (errno)
+	{
+		fprintf(stderr, _("%s: could not read directory \"%s\": %s\n"),
+				progname, incrdir, strerror(errno));
+		exit(1);
+	}
+	closedir(dir);
+}
+
+/*
+ * Rebuild the relation segment "outpath" from the incremental file
+ * "incrpath" and the same segment "fullpath" of the full backup.
+ */
+static void
+combine_file(const char *fullpath, const char *incrpath, const char *outpath)
+{
+	IncrementalFileHeader hdr;
+	uint32	   *blocks;
+	char		page[BLCKSZ];
+	int			incrfd;
+	int			fullfd = -1;
+	int			outfd;
+	uint32		blkno;
+	uint32		i = 0;
+
+	if ((incrfd = open(incrpath, O_RDONLY | PG_BINARY, 0)) < 0)
+	{
+		fprintf(stderr, _("%s: could not open file \"%s\": %s\n"),
+				progname, incrpath, strerror(errno));
+		exit(1);
+	}
+
+	read_fully(incrfd, (char *) &hdr, sizeof(hdr), incrpath);
+	if (hdr.magic != INCREMENTAL_FILE_MAGIC || hdr.nchanged > hdr.nblocks)
+	{
+		fprintf(stderr, _("%s: file \"%s\" is not an incremental relation file\n"),
+				progname, incrpath);
+		exit(1);
+	}
+
+	blocks = pg_malloc(Max(hdr.nchanged, 1) * sizeof(uint32));
+	read_fully(incrfd, (char *) blocks, hdr.nchanged * sizeof(uint32), incrpath);
+
+	/* every block is in the incremental file for a new relation */
+	if (hdr.nchanged < hdr.nblocks &&
+		(fullfd = open(fullpath, O_RDONLY | PG_BINARY, 0)) < 0)
+	{
+		fprintf(stderr, _("%s: could not open file \"%s\": %s\n"),
+				progname, fullpath, strerror(errno));
+		exit(1);
+	}
+
+	if ((outfd = open(outpath, O_WRONLY | O_CREAT | O_TRUNC | PG_BINARY,
+					  S_IRUSR | S_IWUSR)) < 0)
+	{
+		fprintf(stderr, _("%s: could not create file \"%s\": %s\n"),
+				progname, outpath, strerror(errno));
+		exit(1);
+	}
+
+	for (blkno = 0; blkno < hdr.nblocks; blkno++)
+	{
+		if (i < hdr.nchanged && blocks[i] == blkno)
+		{
+			read_fully(incrfd, page, BLCKSZ, incrpath);
+			i++;
+		}
+		else
+		{
+			if (lseek(fullfd, (off_t) blkno * BLCKSZ, SEEK_SET) < 0)
+			{
+				fprintf(stderr, _("%s: could not seek in file \"%s\": %s\n"),
+						progname, fullpath, strerror(errno));
+				exit(1);
+			}
+			read_fully(fullfd, page, BLCKSZ, fullpath);
+		}
+		write_fully(outfd, page, BLCKSZ, outpath);
+	}
+
+	if (i != hdr.nchanged)
+	{
+		fprintf(stderr, _("%s: file \"%s\" has blocks out of order\n"),
+				progname, incrpath);
+		exit(1);
+	}
+
+	if (verbose)
+		fprintf(stderr, _("%s: rebuilt \"%s\" with %u of %u blocks changed\n"),
+				progname, outpath, hdr.nchanged, hdr.nblocks);
+
+	close(outfd);
+	if (fullfd >= 0)
+		close(fullfd);
+	close(incrfd);
+	pg_free(blocks);
+}
+
+/*
+ * Copy a file as it is, but the INCREMENTAL line of the backup_label, as
+ * the combined backup is a full one.
+ */
+static void
+copy_file(const char *frompath, const char *topath, bool label)
+{
+	FILE	   *fp;
+	int			fromfd;
+	int			tofd;
+	char	   *buf;
+	int			len;
+
+	if ((tofd = open(topath, O_WRONLY | O_CREAT | O_TRUNC | PG_BINARY,
+					 S_IRUSR | S_IWUSR)) < 0)
+	{
+		fprintf(stderr, _("%s: could not create file \"%s\": %s\n"),
+				progname, topath, strerror(errno));
+		exit(1);
+	}
+
+	if (label)
+	{
+		char		line[MAXPGPATH];
+
+		if ((fp = fopen(frompath, "r")) == NULL)
+		{
+			fprintf(stderr, _("%s: could not open file \"%s\": %s\n"),
+					progname, frompath, strerror(errno));
+			exit(1);
+		}
+		while (fgets(line, sizeof(line), fp) != NULL)
+		{
+			if (strncmp(line, INCREMENTAL_LABEL_LINE,
+						strlen(INCREMENTAL_LABEL_LINE)) != 0)
+				write_fully(tofd, line, strlen(line), topath);
+		}
+		fclose(fp);
+		close(tofd);
+		return;
+	}
+
+	if ((fromfd = open(frompath, O_RDONLY | PG_BINARY, 0)) < 0)
+	{
+		fprintf(stderr, _("%s: could not open file \"%s\": %s\n"),
+				progname, frompath, strerror(errno));
+		exit(1);
+	}
+
+	buf = pg_malloc(COPY_BUF_SIZE);
+	while ((len = read(fromfd, buf, COPY_BUF_SIZE)) > 0)
+		write_fully(tofd, buf, len, topath);
+	if (len < 0)
+	{
+		fprintf(stderr, _("%s: could not read file \"%s\": %s\n"),
+				progname, frompath, strerror(errno));
+		exit(1);
+	}
+
+	pg_free(buf);
+	close(fromfd);
+	close(tofd);
+}
+
+static void
+read_fully(int fd, char *buf, size_t len, const char *path)
+{
+	while (len > 0)
+	{
+		int			r = read(fd, buf, len);
+
+		if (r < 0)
+		{
+			fprintf(stderr, _("%s: could not read file \"%s\": %s\n"),
+					progname, path, strerror(errno));
+			exit(1);
+		}
+		if (r == 0)
+		{
+			fprintf(stderr, _("%s: unexpected end of file \"%s\"\n"),
+					progname, path);
+			exit(1);
+		}
+		buf += r;
+		len -= r;
+	}
+}
+
+static void
+write_fully(int fd, const char *buf, size_t len, const char *path)
+{
+	errno = 0;
+	if (write(fd, buf, len) != len)
+	{
+		/* if write didn't set errno, assume problem is no disk space */
+		if (errno == 0)
+			errno = ENOSPC;
+		fprintf(stderr, _("%s: could not write file \"%s\": %s\n"),
+				progname, path, strerror(errno));
+		exit(1);
+	}
+}
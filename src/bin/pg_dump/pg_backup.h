@@ -91,6 +91,15 @@ struct Archive
 	bool		std_strings;	/* standard_conforming_strings */
 	char	   *use_role;		/* Issue SET ROLE to this */
 
+#ifdef ADB
+	/* Datanodes dumped directly, see GetDatanodeConnection */
+	char	   *global_snapshot_id;		/* AGTM snapshot for their sessions */
+	int			numDatanodes;
+	char	  **datanodeNames;
+	char	  **datanodeHosts;
+	char	  **datanodePorts;
+#endif
+
 	/* error handling */
 	bool		exit_on_error;	/* whether to exit on SQL errors... */
 	int			n_errors;		/* number of errors (if no die) */
@@ -165,6 +174,9 @@ extern void ConnectDatabase(Archive *AH,
 				enum trivalue prompt_password);
 extern void DisconnectDatabase(Archive *AHX);
 extern PGconn *GetConnection(Archive *AHX);
+#ifdef ADB
+extern PGconn *GetDatanodeConnection(Archive *AHX, const char *nodename);
+#endif
 
 /* Called to add a TOC entry */
 extern void ArchiveEntry(Archive *AHX,
@@ -100,6 +100,10 @@ static void mark_work_done(ArchiveHandle *AH, TocEntry *ready_list,
 static void fix_dependencies(ArchiveHandle *AH);
 static bool has_lock_conflicts(TocEntry *te1, TocEntry *te2);
 static void repoint_table_dependencies(ArchiveHandle *AH);
+#ifdef ADB
+static void add_shard_dependencies(ArchiveHandle *AH, TocEntry *te,
+					   TocEntry *ted);
+#endif
 static void identify_locking_dependencies(ArchiveHandle *AH, TocEntry *te);
 static void reduce_dependencies(ArchiveHandle *AH, TocEntry *te,
 					TocEntry *ready_list);
@@ -1601,6 +1605,18 @@ buildTocEntryArrays(ArchiveHandle *AH)
 			if (tableId <= 0 || tableId > maxDumpId)
 				exit_horribly(modulename, "bad table dumpId for TABLE DATA item\n");
 
+#ifdef ADB
+			/*
+			 * A table dumped directly from the datanodes has one TABLE DATA
+			 * item per node, chained from the one tableDataId gives.
+			 */
+			if (AH->tableDataId[tableId] != 0)
+			{
+				te->nextShard = AH->tableDataId[tableId];
+				te->sharded = true;
+				AH->tocsByDumpId[te->nextShard]->sharded = true;
+			}
+#endif
 			AH->tableDataId[tableId] = te->dumpId;
 		}
 	}
@@ -4040,11 +4056,39 @@ repoint_table_dependencies(ArchiveHandle *AH)
 				te->dependencies[i] = AH->tableDataId[olddep];
 				ahlog(AH, 2, "transferring dependency %d -> %d to %d\n",
 					  te->dumpId, olddep, AH->tableDataId[olddep]);
+#ifdef ADB
+				/* and wait for the data of every node */
+				add_shard_dependencies(AH, te,
+								AH->tocsByDumpId[AH->tableDataId[olddep]]);
+#endif
 			}
 		}
 	}
 }
 
+#ifdef ADB
+/*
+ * Add to the dependencies of te the TABLE DATA items chained after ted.
+ * Being TABLE DATA items, repoint_table_dependencies leaves them alone when
+ * it gets to them at the end of the array.
+ */
+static void
+add_shard_dependencies(ArchiveHandle *AH, TocEntry *te, TocEntry *ted)
+{
+	DumpId		shard;
+
+	for (shard = ted->nextShard; shard != 0;
+		 shard = AH->tocsByDumpId[shard]->nextShard)
+	{
+		te->dependencies = (DumpId *)
+			pg_realloc(te->dependencies, (te->nDeps + 1) * sizeof(DumpId));
+		te->dependencies[te->nDeps++] = shard;
+		te->depCount++;
+		ahlog(AH, 2, "adding dependency %d -> %d\n", te->dumpId, shard);
+	}
+}
+#endif
+
 /*
  * Identify which objects we'll need exclusive lock on in order to restore
  * the given TOC entry (*other* than the one identified by the TOC entry
@@ -4139,6 +4183,14 @@ mark_create_done(ArchiveHandle *AH, TocEntry *te)
 	{
 		TocEntry   *ted = AH->tocsByDumpId[AH->tableDataId[te->dumpId]];
 
+#ifdef ADB
+		/*
+		 * The TRUNCATE preceding the COPY of a created table would wipe
+		 * what the items of the other nodes loaded.
+		 */
+		if (ted->sharded)
+			return;
+#endif
 		ted->created = true;
 	}
 }
@@ -4158,6 +4210,13 @@ inhibit_data_for_failed_table(ArchiveHandle *AH, TocEntry *te)
 		TocEntry   *ted = AH->tocsByDumpId[AH->tableDataId[te->dumpId]];
 
 		ted->reqs = 0;
+#ifdef ADB
+		while (ted->nextShard != 0)
+		{
+			ted = AH->tocsByDumpId[ted->nextShard];
+			ted->reqs = 0;
+		}
+#endif
 	}
 }
 
@@ -4181,6 +4240,9 @@ CloneArchive(ArchiveHandle *AH)
 
 	/* The clone will have its own connection, so disregard connection state */
 	clone->connection = NULL;
+#ifdef ADB
+	clone->datanodeConns = NULL;
+#endif
 	clone->currUser = NULL;
 	clone->currSchema = NULL;
 	clone->currTablespace = NULL;
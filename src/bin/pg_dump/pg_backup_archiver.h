@@ -270,6 +270,9 @@ typedef struct _archiveHandle
 	char	   *savedPassword;	/* password for ropt->username, if known */
 	char	   *use_role;
 	PGconn	   *connection;
+#ifdef ADB
+	PGconn	  **datanodeConns;	/* indexed like public.datanodeNames */
+#endif
 	int			connectToDB;	/* Flag to indicate if direct DB connection is
 								 * required */
 	ArchiverOutput outputKind;	/* Flag for what we're currently writing */
@@ -349,6 +352,10 @@ typedef struct _tocEntry
 	/* working state while dumping/restoring */
 	teReqs		reqs;			/* do we need schema and/or data of object */
 	bool		created;		/* set for DATA member if TABLE was created */
+#ifdef ADB
+	bool		sharded;		/* TABLE DATA item of one of several nodes */
+	DumpId		nextShard;		/* next TABLE DATA item of the same table */
+#endif
 
 	/* working state (needed only for parallel restore) */
 	struct _tocEntry *par_prev; /* list links for pending/ready items; */
@@ -329,6 +329,21 @@ DisconnectDatabase(Archive *AHX)
 	PGcancel   *cancel;
 	char		errbuf[1];
 
+#ifdef ADB
+	if (AH->datanodeConns)
+	{
+		int			i;
+
+		for (i = 0; i < AH->public.numDatanodes; i++)
+		{
+			if (AH->datanodeConns[i])
+				PQfinish(AH->datanodeConns[i]);
+		}
+		free(AH->datanodeConns);
+		AH->datanodeConns = NULL;
+	}
+#endif
+
 	if (!AH->connection)
 		return;
 
@@ -353,6 +368,119 @@ GetConnection(Archive *AHX)
 	return AH->connection;
 }
 
+#ifdef ADB
+static void
+_datanodeStatement(PGconn *conn, const char *nodename, const char *query)
+{
+	PGresult   *res;
+
+	res = PQexec(conn, query);
+	if (PQresultStatus(res) != PGRES_COMMAND_OK)
+	{
+		write_msg(modulename, "query failed on datanode \"%s\": %s",
+				  nodename, PQerrorMessage(conn));
+		exit_horribly(modulename, "query was: %s\n", query);
+	}
+	PQclear(res);
+}
+
+/*
+ * Get the connection to datanode "nodename", opening it on first use.
+ *
+ * The session is set up the way pg_dump sets up its own, except that the
+ * snapshot it imports is the global one exported on the coordinator, so
+ * that the data of every node is dumped as of the same instant.  The
+ * connection uses the database, user and password of the coordinator one.
+ */
+PGconn *
+GetDatanodeConnection(Archive *AHX, const char *nodename)
+{
+	ArchiveHandle *AH = (ArchiveHandle *) AHX;
+	const char *keywords[7];
+	const char *values[7];
+	PQExpBuffer query;
+	PGconn	   *conn;
+	int			i;
+
+	for (i = 0; i < AHX->numDatanodes; i++)
+	{
+		if (strcmp(AHX->datanodeNames[i], nodename) == 0)
+			break;
+	}
+	if (i >= AHX->numDatanodes)
+		exit_horribly(modulename, "datanode \"%s\" not found in pgxc_node\n",
+					  nodename);
+
+	if (AH->datanodeConns == NULL)
+		AH->datanodeConns = (PGconn **)
+			pg_malloc0(AHX->numDatanodes * sizeof(PGconn *));
+	if (AH->datanodeConns[i] != NULL)
+		return AH->datanodeConns[i];
+
+	if (AHX->global_snapshot_id == NULL)
+		exit_horribly(modulename, "no global snapshot to dump datanode \"%s\" with\n",
+					  nodename);
+
+	keywords[0] = "host";
+	values[0] = AHX->datanodeHosts[i];
+	keywords[1] = "port";
+	values[1] = AHX->datanodePorts[i];
+	keywords[2] = "user";
+	values[2] = PQuser(AH->connection);
+	keywords[3] = "password";
+	values[3] = AH->savedPassword;
+	keywords[4] = "dbname";
+	values[4] = PQdb(AH->connection);
+	keywords[5] = "fallback_application_name";
+	values[5] = progname;
+	keywords[6] = NULL;
+	values[6] = NULL;
+
+	conn = PQconnectdbParams(keywords, values, true);
+	if (!conn)
+		exit_horribly(modulename, "failed to connect to datanode \"%s\"\n",
+					  nodename);
+	if (PQstatus(conn) == CONNECTION_BAD)
+		exit_horribly(modulename, "connection to datanode \"%s\" failed: %s",
+					  nodename, PQerrorMessage(conn));
+	AH->datanodeConns[i] = conn;
+
+	if (PQsetClientEncoding(conn, pg_encoding_to_char(AHX->encoding)) < 0)
+		exit_horribly(modulename, "could not set the client encoding of datanode \"%s\": %s",
+					  nodename, PQerrorMessage(conn));
+	PQsetNoticeProcessor(conn, notice_processor, NULL);
+
+	/* the same as ConnectDatabase and pg_dump's setup_connection */
+	PQclear(PQexec(conn, "set grammar=postgres"));
+	query = createPQExpBuffer();
+	if (AHX->use_role)
+	{
+		appendPQExpBuffer(query, "SET ROLE %s", fmtId(AHX->use_role));
+		_datanodeStatement(conn, nodename, query->data);
+	}
+	_datanodeStatement(conn, nodename, "SET DATESTYLE = ISO");
+	_datanodeStatement(conn, nodename, "SET INTERVALSTYLE = POSTGRES");
+	_datanodeStatement(conn, nodename, "SET extra_float_digits TO 3");
+	_datanodeStatement(conn, nodename, "SET synchronize_seqscans TO off");
+	_datanodeStatement(conn, nodename, "SET statement_timeout = 0");
+	_datanodeStatement(conn, nodename, "SET lock_timeout = 0");
+	if (quote_all_identifiers)
+		_datanodeStatement(conn, nodename, "SET quote_all_identifiers = true");
+
+	_datanodeStatement(conn, nodename, "BEGIN");
+	_datanodeStatement(conn, nodename,
+					   "SET TRANSACTION ISOLATION LEVEL "
+					   "REPEATABLE READ, READ ONLY");
+	resetPQExpBuffer(query);
+	appendPQExpBuffer(query, "SET TRANSACTION SNAPSHOT ");
+	appendStringLiteralConn(query, AHX->global_snapshot_id, conn);
+	_datanodeStatement(conn, nodename, query->data);
+	destroyPQExpBuffer(query);
+
+	return conn;
+}
+#endif   /* ADB */
+
 static void
 notice_processor(void *arg, const char *message)
 {
@@ -147,6 +147,9 @@ static int	serializable_deferrable = 0;
 #ifdef PGXC
 static int	include_nodes = 0;
 #endif
+#ifdef ADB
+static int	datanode_dump = 0;
+#endif
 
 #ifdef MGR_DUMP
 static int	adbmgr_table = 0;
@@ -279,6 +282,13 @@ static bool nonemptyReloptions(const char *reloptions);
 static void fmtReloptionsArray(Archive *fout, PQExpBuffer buffer,
 				   const char *reloptions, const char *prefix);
 static char *get_synchronized_snapshot(Archive *fout);
+#ifdef ADB
+static char *get_global_snapshot(Archive *fout);
+static void getDatanodes(Archive *fout);
+static void dumpTableDataShards(Archive *fout, TableDataInfo *tdinfo,
+					const char *copyStmt);
+static PGconn *getShardConnection(Archive *fout, TableDataInfo *tdinfo);
+#endif
 static PGresult *ExecuteSqlQueryForSingleRow(Archive *fout, char *query);
 static void setupDumpWorker(Archive *AHX, RestoreOptions *ropt);
 
@@ -376,6 +386,9 @@ main(int argc, char **argv)
 #ifdef PGXC
 		{"include-nodes", no_argument, &include_nodes, 1},
 #endif
+#ifdef ADB
+		{"datanodes", no_argument, &datanode_dump, 1},
+#endif
 #ifdef MGR_DUMP
 		{"mgr_table", no_argument, &adbmgr_table, 1},
 #endif
@@ -632,6 +645,18 @@ main(int argc, char **argv)
 	if (archiveFormat != archDirectory && numWorkers > 1)
 		exit_horribly(NULL, "parallel backup only supported by the directory format\n");
 
+#ifdef ADB
+	if (datanode_dump)
+	{
+		if (archiveFormat != archDirectory)
+			exit_horribly(NULL, "option --datanodes is only supported by the directory format\n");
+		if (no_synchronized_snapshots)
+			exit_horribly(NULL, "options --datanodes and --no-synchronized-snapshots cannot be used together\n");
+		if (dump_inserts)
+			exit_horribly(NULL, "options --datanodes and --inserts/--column-inserts cannot be used together\n");
+	}
+#endif
+
 	/* Open the output file */
 	fout = CreateArchive(filename, archiveFormat, compressLevel, archiveMode,
 						 setupDumpWorker);
@@ -766,6 +791,11 @@ main(int argc, char **argv)
 	 */
 	tblinfo = getSchemaData(fout, &numTables);
 
+#ifdef ADB
+	if (datanode_dump && !schemaOnly)
+		getDatanodes(fout);
+#endif
+
 	if (fout->remoteVersion < 80400)
 		guessConstraintInheritance(tblinfo, numTables);
 
@@ -938,6 +968,9 @@ help(const char *progname)
 #ifdef PGXC
 	printf(_("  --include-nodes              include TO NODE clause in the dumped CREATE TABLE commands\n"));
 #endif
+#ifdef ADB
+	printf(_("  --datanodes                  dump the data of distributed tables from the datanodes\n"));
+#endif
 #ifdef MGR_DUMP
 	printf(_("  --mgr_table                  dump only ADBMGR host, node, param, hba table data\n"));
 #endif
@@ -1087,6 +1120,15 @@ setup_connection(Archive *AH, const char *dumpencoding, char *use_role)
 		else
 			AH->sync_snapshot_id = get_synchronized_snapshot(AH);
 	}
+
+#ifdef ADB
+	/*
+	 * The sessions on the datanodes import the global snapshot of this
+	 * transaction; workers find it already there.
+	 */
+	if (datanode_dump && AH->global_snapshot_id == NULL)
+		AH->global_snapshot_id = get_global_snapshot(AH);
+#endif
 }
 
 static void
@@ -1109,6 +1151,60 @@ get_synchronized_snapshot(Archive *fout)
 	return result;
 }
 
+#ifdef ADB
+static char *
+get_global_snapshot(Archive *fout)
+{
+	char	   *query = "SELECT pg_catalog.pg_export_global_snapshot()";
+	char	   *result;
+	PGresult   *res;
+
+	res = ExecuteSqlQueryForSingleRow(fout, query);
+	result = pg_strdup(PQgetvalue(res, 0, 0));
+	PQclear(res);
+
+	return result;
+}
+
+/*
+ * getDatanodes
+ *	  read the datanodes of the cluster, for GetDatanodeConnection
+ *
+ * Their host and port are those the coordinator knows them by, which have
+ * to be reachable from where pg_dump runs too.
+ */
+static void
+getDatanodes(Archive *fout)
+{
+	PGresult   *res;
+	int			ntups;
+	int			i;
+
+	res = ExecuteSqlQuery(fout,
+						  "SELECT node_name, node_host, node_port "
+						  "FROM pg_catalog.pgxc_node "
+						  "WHERE node_type = 'D' "
+						  "ORDER BY node_name",
+						  PGRES_TUPLES_OK);
+	ntups = PQntuples(res);
+	if (ntups == 0)
+		exit_horribly(NULL, "no datanodes found in pgxc_node\n");
+
+	fout->numDatanodes = ntups;
+	fout->datanodeNames = (char **) pg_malloc(ntups * sizeof(char *));
+	fout->datanodeHosts = (char **) pg_malloc(ntups * sizeof(char *));
+	fout->datanodePorts = (char **) pg_malloc(ntups * sizeof(char *));
+	for (i = 0; i < ntups; i++)
+	{
+		fout->datanodeNames[i] = pg_strdup(PQgetvalue(res, i, 0));
+		fout->datanodeHosts[i] = pg_strdup(PQgetvalue(res, i, 1));
+		fout->datanodePorts[i] = pg_strdup(PQgetvalue(res, i, 2));
+	}
+
+	PQclear(res);
+}
+#endif   /* ADB */
+
 static ArchiveFormat
 parseArchiveFormat(const char *format, ArchiveMode *mode)
 {
@@ -1497,6 +1593,39 @@ selectDumpableObject(DumpableObject *dobj)
 		dobj->dump = include_everything;
 }
 
+#ifdef ADB
+/*
+ * Get the datanode session to dump the shard of tdinfo from, in the schema
+ * of its table like selectSourceSchema would have it.
+ */
+static PGconn *
+getShardConnection(Archive *fout, TableDataInfo *tdinfo)
+{
+	const char *schemaName = tdinfo->tdtable->dobj.namespace->dobj.name;
+	PGconn	   *conn = GetDatanodeConnection(fout, tdinfo->shardnode);
+	PQExpBuffer query = createPQExpBuffer();
+	PGresult   *res;
+
+	if (g_verbose)
+		write_msg(NULL, "dumping the rows on datanode %s\n", tdinfo->shardnode);
+
+	appendPQExpBuffer(query, "SET search_path = %s", fmtId(schemaName));
+	if (strcmp(schemaName, "pg_catalog") != 0)
+		appendPQExpBuffer(query, ", pg_catalog");
+	res = PQexec(conn, query->data);
+	if (PQresultStatus(res) != PGRES_COMMAND_OK)
+	{
+		write_msg(NULL, "query failed on datanode \"%s\": %s",
+				  tdinfo->shardnode, PQerrorMessage(conn));
+		exit_horribly(NULL, "query was: %s\n", query->data);
+	}
+	PQclear(res);
+	destroyPQExpBuffer(query);
+
+	return conn;
+}
+#endif
+
 /*
  *	Dump a table's contents for loading using the COPY command
  *	- this routine is called by the Archiver when it wants the table
@@ -1535,6 +1664,12 @@ dumpTableData_copy(Archive *fout, void *dcontext)
 	 */
 	selectSourceSchema(fout, tbinfo->dobj.namespace->dobj.name);
 
+#ifdef ADB
+	/* the rows of a shard are dumped from the session on its datanode */
+	if (tdinfo->shardnode)
+		conn = getShardConnection(fout, tdinfo);
+#endif
+
 	/*
 	 * If possible, specify the column list explicitly so that we have no
 	 * possibility of retrieving data in the wrong column order.  (The default
@@ -1580,6 +1715,21 @@ dumpTableData_copy(Archive *fout, void *dcontext)
 										 classname),
 						  column_list);
 	}
+#ifdef ADB
+	if (tdinfo->shardnode)
+	{
+		res = PQexec(conn, q->data);
+		if (PQresultStatus(res) != PGRES_COPY_OUT)
+		{
+			write_msg(NULL, "Dumping the contents of table \"%s\" failed on datanode \"%s\".\n",
+					  classname, tdinfo->shardnode);
+			write_msg(NULL, "Error message from server: %s", PQerrorMessage(conn));
+			write_msg(NULL, "The command was: %s\n", q->data);
+			exit_nicely(1);
+		}
+	}
+	else
+#endif
 	res = ExecuteSqlQuery(fout, q->data, PGRES_COPY_OUT);
 	PQclear(res);
 	destroyPQExpBuffer(clistBuf);
@@ -1864,6 +2014,22 @@ dumpTableData(Archive *fout, TableDataInfo *tdinfo)
 		copyStmt = NULL;
 	}
 
+#ifdef ADB
+	/*
+	 * Tables spread over datanodes get one TABLE DATA item per node, dumped
+	 * from the node rather than through the coordinator.
+	 */
+	if (datanode_dump && !dump_inserts &&
+		tbinfo->pgxclocatortype != 'E' && tbinfo->pgxclocatortype != 'R' &&
+		tbinfo->pgxc_node_names != NULL && tbinfo->pgxc_node_names[0] != '\0')
+	{
+		dumpTableDataShards(fout, tdinfo, copyStmt);
+		destroyPQExpBuffer(copyBuf);
+		destroyPQExpBuffer(clistBuf);
+		return;
+	}
+#endif
+
 	/*
 	 * Note: although the TableDataInfo is a full DumpableObject, we treat its
 	 * dependency on its table as "special" and pass it to ArchiveEntry now.
@@ -1881,6 +2047,62 @@ dumpTableData(Archive *fout, TableDataInfo *tdinfo)
 	destroyPQExpBuffer(clistBuf);
 }
 
+#ifdef ADB
+/*
+ * dumpTableDataShards -
+ *	  make the TABLE DATA items of a table distributed over datanodes
+ *
+ * Each item is a copy of tdinfo naming one of the nodes of the table, the
+ * first one keeping the dump ID of tdinfo.  They all depend on the table
+ * only, so that the workers dump them in parallel; pg_restore recognizes
+ * the items of the same table and loads them in parallel too.
+ */
+static void
+dumpTableDataShards(Archive *fout, TableDataInfo *tdinfo, const char *copyStmt)
+{
+	TableInfo  *tbinfo = tdinfo->tdtable;
+	char	   *names = pg_strdup(tbinfo->pgxc_node_names);
+	char	   *name = names;
+	bool		first = true;
+
+	/* pgxc_node_names is a list of the form "dn1","dn2" */
+	while (name != NULL && *name == '"')
+	{
+		TableDataInfo *shard;
+		char	   *next;
+
+		name++;
+		next = strstr(name, "\",\"");
+		if (next != NULL)
+		{
+			*next = '\0';
+			next += 2;
+		}
+		else if (name[0] != '\0' && name[strlen(name) - 1] == '"')
+			name[strlen(name) - 1] = '\0';
+
+		shard = (TableDataInfo *) pg_malloc(sizeof(TableDataInfo));
+		memcpy(shard, tdinfo, sizeof(TableDataInfo));
+		if (!first)
+			shard->dobj.dumpId = createDumpId();
+		shard->shardnode = pg_strdup(name);
+		first = false;
+
+		ArchiveEntry(fout, shard->dobj.catId, shard->dobj.dumpId,
+					 tbinfo->dobj.name, tbinfo->dobj.namespace->dobj.name,
+					 NULL, tbinfo->rolname,
+					 false, "TABLE DATA", SECTION_DATA,
+					 "", "", copyStmt,
+					 &(tbinfo->dobj.dumpId), 1,
+					 dumpTableData_copy, shard);
+
+		name = next;
+	}
+
+	free(names);
+}
+#endif
+
 /*
  * refreshMatViewData -
  *	  load or refresh the contents of a single materialized view
@@ -1995,6 +2217,9 @@ makeTableDataInfo(TableInfo *tbinfo, bool oids)
 	tdinfo->tdtable = tbinfo;
 	tdinfo->oids = oids;
 	tdinfo->filtercond = NULL;	/* might get set later */
+#ifdef ADB
+	tdinfo->shardnode = NULL;	/* set for the copies of dumpTableDataShards */
+#endif
 	addObjectDependency(&tdinfo->dobj, tbinfo->dobj.dumpId);
 
 	tbinfo->dataObj = tdinfo;
@@ -4360,6 +4585,9 @@ getTables(Archive *fout, int *numTables)
 	int			i_pgxclocatortype;
 	int			i_pgxcattnum;
 	int			i_pgxc_node_names;
+#ifdef ADB
+	int			i_pgxcdistvalues;
+#endif
 #endif
 	int			i_reltablespace;
 	int			i_reloptions;
@@ -4415,6 +4643,9 @@ getTables(Archive *fout, int *numTables)
 						  "(SELECT pclocatortype from pgxc_class v where v.pcrelid = c.oid) AS pgxclocatortype,"
 						  "(SELECT pcattnum from pgxc_class v where v.pcrelid = c.oid) AS pgxcattnum,"
 						  "(SELECT '\"' || string_agg(node_name,'\",\"') || '\"' AS pgxc_node_names from pgxc_node n where n.oid in (select unnest(nodeoids) from pgxc_class v where v.pcrelid=c.oid) ) , "
+#ifdef ADB
+						  "(SELECT CASE WHEN pclocatortype IN ('G', 'L') THEN pg_catalog.pgxc_distribution_values(c.oid) END from pgxc_class v where v.pcrelid = c.oid) AS pgxcdistvalues, "
+#endif
 #endif
 						  "c.reloptions AS reloptions, "
 						  "tc.reloptions AS toast_reloptions "
@@ -4790,6 +5021,9 @@ getTables(Archive *fout, int *numTables)
 	i_pgxclocatortype = PQfnumber(res, "pgxclocatortype");
 	i_pgxcattnum = PQfnumber(res, "pgxcattnum");
 	i_pgxc_node_names = PQfnumber(res, "pgxc_node_names");
+#ifdef ADB
+	i_pgxcdistvalues = PQfnumber(res, "pgxcdistvalues");
+#endif
 #endif
 	i_reltablespace = PQfnumber(res, "reltablespace");
 	i_reloptions = PQfnumber(res, "reloptions");
@@ -4865,6 +5099,12 @@ getTables(Archive *fout, int *numTables)
 			tblinfo[i].pgxcattnum = atoi(PQgetvalue(res, i, i_pgxcattnum));
 		}
 		tblinfo[i].pgxc_node_names = pg_strdup(PQgetvalue(res, i, i_pgxc_node_names));
+#ifdef ADB
+		if (PQgetisnull(res, i, i_pgxcdistvalues))
+			tblinfo[i].pgxcdistvalues = NULL;
+		else
+			tblinfo[i].pgxcdistvalues = pg_strdup(PQgetvalue(res, i, i_pgxcdistvalues));
+#endif
 #endif
 		tblinfo[i].reltablespace = pg_strdup(PQgetvalue(res, i, i_reltablespace));
 		tblinfo[i].reloptions = pg_strdup(PQgetvalue(res, i, i_reloptions));
@@ -13251,6 +13491,26 @@ dumpTableSchema(Archive *fout, TableInfo *tbinfo)
 				appendPQExpBuffer(q, "\nDISTRIBUTE BY MODULO (%s)",
 								  fmtId(tbinfo->attnames[hashkey - 1]));
 			}
+#ifdef ADB
+			/* B: DISTRIBUTE BY BUCKET */
+			else if (tbinfo->pgxclocatortype == 'B')
+			{
+				int hashkey = tbinfo->pgxcattnum;
+				appendPQExpBuffer(q, "\nDISTRIBUTE BY BUCKET (%s)",
+								  fmtId(tbinfo->attnames[hashkey - 1]));
+			}
+			/* G: DISTRIBUTE BY RANGE, L: DISTRIBUTE BY LIST */
+			else if ((tbinfo->pgxclocatortype == 'G' ||
+					  tbinfo->pgxclocatortype == 'L') &&
+					 tbinfo->pgxcdistvalues != NULL)
+			{
+				int hashkey = tbinfo->pgxcattnum;
+				appendPQExpBuffer(q, "\nDISTRIBUTE BY %s (%s, %s)",
+								  tbinfo->pgxclocatortype == 'G' ? "RANGE" : "LIST",
+								  fmtId(tbinfo->attnames[hashkey - 1]),
+								  tbinfo->pgxcdistvalues);
+			}
+#endif
 		}
 		if (include_nodes &&
 			tbinfo->pgxc_node_names != NULL &&
@@ -263,6 +263,9 @@ typedef struct _tableInfo
 	char		pgxclocatortype;	/* Type of PGXC table locator */
 	int			pgxcattnum;		/* Number of the attribute the table is partitioned with */
 	char		*pgxc_node_names;	/* List of node names where this table is distributed */
+#ifdef ADB
+	char		*pgxcdistvalues;	/* Bounds or values of a range or list distribution */
+#endif
 #endif
 	/*
 	 * These fields are computed only if we decide the table is interesting
@@ -312,6 +315,9 @@ typedef struct _tableDataInfo
 	TableInfo  *tdtable;		/* link to table to dump */
 	bool		oids;			/* include OIDs in data? */
 	char	   *filtercond;		/* WHERE condition to limit rows dumped */
+#ifdef ADB
+	char	   *shardnode;		/* datanode to dump the rows of, if any */
+#endif
 } TableDataInfo;
 
 typedef struct _indxInfo
@@ -30,7 +30,10 @@
 #define LOCATOR_TYPE_RROBIN 'N'
 #define LOCATOR_TYPE_MODULO 'M'
 #ifdef ADB
+#define LOCATOR_TYPE_BUCKET 'B'
 #define LOCATOR_TYPE_USER_DEFINED 'U'
+#define LOCATOR_TYPE_RANGE 'G'
+#define LOCATOR_TYPE_LIST 'L'
 #endif
 #endif /* PGXC */
 
@@ -2304,6 +2307,12 @@ describeOneTableDetails(const char *schemaname,
 						"		  WHEN '%c' THEN \n"
 						"		   'MODULO' || '(' || a.attname || ')' \n"
 						"		  WHEN '%c' THEN \n"
+						"		   'BUCKET' || '(' || a.attname || ')' \n"
+						"		  WHEN '%c' THEN \n"
+						"		   'RANGE' || '(' || a.attname || ', ' || pg_catalog.pgxc_distribution_values(pcrelid) || ')' \n"
+						"		  WHEN '%c' THEN \n"
+						"		   'LIST' || '(' || a.attname || ', ' || pg_catalog.pgxc_distribution_values(pcrelid) || ')' \n"
+						"		  WHEN '%c' THEN \n"
 						"		   (SELECT proname FROM pg_catalog.pg_proc WHERE oid = pcfuncid) || '(' || \n"
 						"		   array_to_string(ARRAY \n"
 						"						   (SELECT attname \n"
@@ -2338,6 +2347,9 @@ describeOneTableDetails(const char *schemaname,
 					, LOCATOR_TYPE_REPLICATED
 					, LOCATOR_TYPE_HASH
 					, LOCATOR_TYPE_MODULO
+					, LOCATOR_TYPE_BUCKET
+					, LOCATOR_TYPE_RANGE
+					, LOCATOR_TYPE_LIST
 					, LOCATOR_TYPE_USER_DEFINED
 					, oid
 					, oid
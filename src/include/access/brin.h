@@ -0,0 +1,64 @@
+/*--------------------------------------------------------------------------
+ * brin.h
+ *	  Public header file for the block range index access method.
+ *
+ *	Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ *	Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *	src/include/access/brin.h
+ *--------------------------------------------------------------------------
+ */
+#ifndef BRIN_H
+#define BRIN_H
+
+#include "access/xlog.h"
+#include "fmgr.h"
+#include "lib/stringinfo.h"
+#include "storage/block.h"
+#include "utils/relcache.h"
+
+
+/*
+ * amproc indexes for block range indexes.  The only support procedure is
+ * the btree-style three-way comparison function of the indexed type, which
+ * is all we need to maintain and test the minimum and maximum of each range.
+ */
+#define BRIN_COMPARE_PROC			   1
+#define BRINNProcs					   1
+
+/*
+ * Storage type for BRIN's reloptions
+ */
+typedef struct BrinOptions
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	BlockNumber pagesPerRange;
+} BrinOptions;
+
+#define BRIN_DEFAULT_PAGES_PER_RANGE	128
+#define BRIN_MAX_PAGES_PER_RANGE		131072
+#define BrinGetPagesPerRange(relation) \
+	((relation)->rd_options ? \
+	 ((BrinOptions *) (relation)->rd_options)->pagesPerRange : \
+	  BRIN_DEFAULT_PAGES_PER_RANGE)
+
+/* brin.c */
+extern Datum brinbuild(PG_FUNCTION_ARGS);
+extern Datum brinbuildempty(PG_FUNCTION_ARGS);
+extern Datum brininsert(PG_FUNCTION_ARGS);
+extern Datum brinbeginscan(PG_FUNCTION_ARGS);
+extern Datum bringetbitmap(PG_FUNCTION_ARGS);
+extern Datum brinrescan(PG_FUNCTION_ARGS);
+extern Datum brinendscan(PG_FUNCTION_ARGS);
+extern Datum brinmarkpos(PG_FUNCTION_ARGS);
+extern Datum brinrestrpos(PG_FUNCTION_ARGS);
+extern Datum brinbulkdelete(PG_FUNCTION_ARGS);
+extern Datum brinvacuumcleanup(PG_FUNCTION_ARGS);
+extern Datum brinoptions(PG_FUNCTION_ARGS);
+extern Datum brin_summarize_new_values(PG_FUNCTION_ARGS);
+
+/* brinxlog.c */
+extern void brin_redo(XLogRecPtr lsn, XLogRecord *record);
+extern void brin_desc(StringInfo buf, uint8 xl_info, char *rec);
+
+#endif   /* BRIN_H */
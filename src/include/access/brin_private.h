@@ -0,0 +1,286 @@
+/*--------------------------------------------------------------------------
+ * brin_private.h
+ *	  Header file for the block range index access method's internals.
+ *
+ *	Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ *	Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *	src/include/access/brin_private.h
+ *--------------------------------------------------------------------------
+ */
+#ifndef BRIN_PRIVATE_H
+#define BRIN_PRIVATE_H
+
+#include "access/brin.h"
+#include "access/tupdesc.h"
+#include "storage/buf.h"
+#include "storage/bufpage.h"
+#include "storage/itemptr.h"
+#include "storage/relfilenode.h"
+#include "utils/memutils.h"
+
+
+/*
+ * A BRIN index summarizes each range of pagesPerRange consecutive heap
+ * pages ("block range") with one index tuple, which records the minimum and
+ * maximum values of each indexed column found in the range.  The index
+ * consists of
+ *
+ *	- the metapage, block 0, which records pagesPerRange and where the revmap
+ *	  pages are;
+ *	- the "range map" ("revmap") pages, an array of TIDs indexed by range
+ *	  number, pointing to the summary tuple of each range;
+ *	- regular pages, holding the summary tuples.
+ *
+ * A range whose revmap entry is invalid has no summary yet, and a scan must
+ * return all of its pages.  Summaries only ever widen, so deleting heap
+ * tuples never requires touching the index.
+ */
+
+/* Page types, kept in the special space of every page */
+#define BRIN_PAGETYPE_META			0xF091
+#define BRIN_PAGETYPE_REVMAP		0xF092
+#define BRIN_PAGETYPE_REGULAR		0xF093
+
+typedef struct BrinSpecialSpace
+{
+	uint16		flags;			/* currently unused */
+	uint16		type;			/* one of BRIN_PAGETYPE_* */
+} BrinSpecialSpace;
+
+#define BrinPageType(page) \
+	(((BrinSpecialSpace *) PageGetSpecialPointer(page))->type)
+#define BRIN_IS_META_PAGE(page)		(BrinPageType(page) == BRIN_PAGETYPE_META)
+#define BRIN_IS_REVMAP_PAGE(page)	(BrinPageType(page) == BRIN_PAGETYPE_REVMAP)
+#define BRIN_IS_REGULAR_PAGE(page)	(BrinPageType(page) == BRIN_PAGETYPE_REGULAR)
+
+/* Metapage definitions */
+#define BRIN_METAPAGE_BLKNO		0
+#define BRIN_META_MAGIC			0xA8109CFA
+#define BRIN_CURRENT_VERSION	1
+
+typedef struct BrinMetaPageData
+{
+	uint32		brinMagic;
+	uint32		brinVersion;
+	BlockNumber pagesPerRange;
+	uint32		nRevmapPages;	/* number of valid entries below */
+	BlockNumber revmapPages[1]; /* VARIABLE LENGTH ARRAY */
+} BrinMetaPageData;
+
+#define BrinPageGetMeta(page) \
+	((BrinMetaPageData *) PageGetContents(page))
+
+/* Number of revmap pages the metapage can keep track of */
+#define BRIN_MAX_REVMAP_PAGES \
+	((BLCKSZ - MAXALIGN(SizeOfPageHeaderData) - \
+	  MAXALIGN(sizeof(BrinSpecialSpace)) - \
+	  offsetof(BrinMetaPageData, revmapPages)) / sizeof(BlockNumber))
+
+/* Revmap page definitions */
+typedef struct RevmapContents
+{
+	ItemPointerData rm_tids[1]; /* VARIABLE LENGTH ARRAY */
+} RevmapContents;
+
+#define REVMAP_PAGE_MAXITEMS \
+	((BLCKSZ - MAXALIGN(SizeOfPageHeaderData) - \
+	  MAXALIGN(sizeof(BrinSpecialSpace))) / sizeof(ItemPointerData))
+
+/* Largest summary tuple that fits on a regular page */
+#define BrinMaxItemSize \
+	MAXALIGN_DOWN(BLCKSZ - \
+				  (MAXALIGN(SizeOfPageHeaderData + sizeof(ItemIdData)) + \
+				   MAXALIGN(sizeof(BrinSpecialSpace))))
+
+/*
+ * On-disk summary tuple.  The header is followed by two bits per indexed
+ * column, "allnulls" (no non-null value in the range, so there's no minimum
+ * and maximum stored) and "hasnulls" (the range contains nulls), and then,
+ * at bt_hoff, by the minimum and maximum of each column that has them, laid
+ * out as heap_fill_tuple does.
+ */
+typedef struct BrinTuple
+{
+	BlockNumber bt_blkno;		/* first heap block of the range */
+	uint16		bt_info;		/* flags, see below */
+	uint16		bt_hoff;		/* offset to the values */
+	bits8		bt_bits[1];		/* null bits: VARIABLE LENGTH */
+} BrinTuple;
+
+#define SizeOfBrinTuple		offsetof(BrinTuple, bt_bits)
+
+/*
+ * A placeholder tuple is inserted for a range while it is being summarized;
+ * concurrent insertions update it as if it was a candidate summary, and
+ * scans treat the range as unsummarized.
+ */
+#define BRIN_PLACEHOLDER_MASK	0x0001
+
+#define BrinTupleIsPlaceholder(tup) \
+	(((tup)->bt_info & BRIN_PLACEHOLDER_MASK) != 0)
+#define BrinTupleAllNulls(tup, attno) \
+	(((tup)->bt_bits[(2 * (attno)) >> 3] & (1 << ((2 * (attno)) & 7))) != 0)
+#define BrinTupleHasNulls(tup, attno) \
+	(((tup)->bt_bits[(2 * (attno) + 1) >> 3] & \
+	  (1 << ((2 * (attno) + 1) & 7))) != 0)
+
+/* In-memory summary of one column of a range */
+typedef struct BrinValues
+{
+	bool		bv_allnulls;	/* no non-null value seen */
+	bool		bv_hasnulls;	/* some null seen */
+	Datum		bv_min;
+	Datum		bv_max;
+} BrinValues;
+
+/* In-memory summary of a range */
+typedef struct BrinMemTuple
+{
+	bool		bt_placeholder;
+	BlockNumber bt_blkno;
+	MemoryContext bt_context;	/* holds the copied values */
+	BrinValues	bt_columns[1];	/* VARIABLE LENGTH ARRAY */
+} BrinMemTuple;
+
+/* Per-index information needed to deal with summary tuples */
+typedef struct BrinDesc
+{
+	MemoryContext bd_context;
+	Relation	bd_index;
+	TupleDesc	bd_tupdesc;		/* the index's tuple descriptor */
+	TupleDesc	bd_disktdesc;	/* minimum and maximum of each column */
+} BrinDesc;
+
+typedef struct BrinRevmap BrinRevmap;
+
+/* brintuple.c */
+extern BrinDesc *brin_build_desc(Relation rel);
+extern void brin_free_desc(BrinDesc *bdesc);
+extern BrinTuple *brin_form_tuple(BrinDesc *bdesc, BlockNumber blkno,
+				BrinMemTuple *dtup, Size *size);
+extern BrinTuple *brin_form_placeholder_tuple(BrinDesc *bdesc,
+							BlockNumber blkno, Size *size);
+extern BrinTuple *brin_copy_tuple(BrinTuple *tuple, Size len);
+extern bool brin_tuples_equal(const BrinTuple *a, Size alen,
+				  const BrinTuple *b, Size blen);
+extern BrinMemTuple *brin_new_memtuple(BrinDesc *bdesc);
+extern void brin_memtuple_initialize(BrinMemTuple *dtup, BrinDesc *bdesc);
+extern BrinMemTuple *brin_deform_tuple(BrinDesc *bdesc, BrinTuple *tuple);
+extern bool brin_add_value(BrinDesc *bdesc, BrinMemTuple *dtup, int attno,
+			   Datum value, bool isnull);
+extern void brin_union_tuples(BrinDesc *bdesc, BrinMemTuple *dst,
+				  BrinMemTuple *src);
+
+/* brinrevmap.c */
+extern BrinRevmap *brinRevmapInitialize(Relation idxrel,
+					 BlockNumber *pagesPerRange);
+extern void brinRevmapTerminate(BrinRevmap *revmap);
+extern Buffer brinLockRevmapPageForUpdate(BrinRevmap *revmap,
+							BlockNumber heapBlk);
+extern void brinSetHeapBlockItemptr(Buffer rmbuf, BlockNumber pagesPerRange,
+						BlockNumber heapBlk, ItemPointerData tid);
+extern BrinTuple *brinGetTupleForHeapBlock(BrinRevmap *revmap,
+						 BlockNumber heapBlk, Buffer *buf, OffsetNumber *off,
+						 Size *size, int mode);
+
+/* brinpageops.c */
+extern void brin_page_init(Page page, uint16 type);
+extern void brin_metapage_init(Page page, BlockNumber pagesPerRange,
+				   uint16 version);
+extern void brin_revmap_page_init(Page page);
+extern void brin_metapage_add_revmap_page(Page metapage, BlockNumber blkno);
+extern void brin_page_delete_item(Page page, OffsetNumber offnum);
+extern void brin_page_replace_item(Page page, OffsetNumber offnum,
+					   const BrinTuple *tup, Size sz);
+extern OffsetNumber brin_doinsert(Relation idxrel, BlockNumber pagesPerRange,
+			  BrinRevmap *revmap, Buffer *buffer, BlockNumber heapBlk,
+			  BrinTuple *tup, Size itemsz);
+extern bool brin_doupdate(Relation idxrel, BlockNumber pagesPerRange,
+			  BrinRevmap *revmap, BlockNumber heapBlk,
+			  Buffer oldbuf, OffsetNumber oldoff,
+			  const BrinTuple *origtup, Size origsz,
+			  const BrinTuple *newtup, Size newsz);
+
+/*
+ * WAL record definitions for BRIN's WAL operations
+ *
+ * XLOG allows to store some information in high 4 bits of log
+ * record xl_info field.
+ */
+#define XLOG_BRIN_CREATE_INDEX		0x00
+#define XLOG_BRIN_INSERT			0x10
+#define XLOG_BRIN_UPDATE			0x20
+#define XLOG_BRIN_SAMEPAGE_UPDATE	0x30
+#define XLOG_BRIN_REVMAP_EXTEND		0x40
+
+#define XLOG_BRIN_OPMASK			0x70
+/*
+ * When we insert the first item on a new page, we restore the entire page in
+ * redo.
+ */
+#define XLOG_BRIN_INIT_PAGE			0x80
+
+/* This is what we need to know about a BRIN index create */
+typedef struct xl_brin_createidx
+{
+	RelFileNode node;
+	BlockNumber pagesPerRange;
+	uint16		version;
+} xl_brin_createidx;
+
+#define SizeOfBrinCreateIdx (offsetof(xl_brin_createidx, version) + sizeof(uint16))
+
+/*
+ * This is what we need to know about a BRIN tuple insert.  The new tuple
+ * follows.  Backup block 0 is the revmap page, 1 the page the tuple went to.
+ */
+typedef struct xl_brin_insert
+{
+	RelFileNode node;
+	BlockNumber heapBlk;
+	BlockNumber pagesPerRange;
+	BlockNumber revmapBlk;
+	ItemPointerData tid;		/* where the new tuple went */
+} xl_brin_insert;
+
+#define SizeOfBrinInsert	(offsetof(xl_brin_insert, tid) + sizeof(ItemPointerData))
+
+/*
+ * A cross-page update is the same as an insert, plus the removal of the old
+ * tuple; the new tuple follows.  Backup block 0 is the revmap page, 1 the
+ * old tuple's page and 2 the new tuple's page.
+ */
+typedef struct xl_brin_update
+{
+	xl_brin_insert new;
+	ItemPointerData oldtid;
+} xl_brin_update;
+
+#define SizeOfBrinUpdate	(offsetof(xl_brin_update, oldtid) + sizeof(ItemPointerData))
+
+/*
+ * This is what we need to know about a BRIN tuple replaced on its own page;
+ * the new tuple follows.  Backup block 0 is the page.
+ */
+typedef struct xl_brin_samepage_update
+{
+	RelFileNode node;
+	ItemPointerData tid;
+} xl_brin_samepage_update;
+
+#define SizeOfBrinSamepageUpdate	(offsetof(xl_brin_samepage_update, tid) + sizeof(ItemPointerData))
+
+/*
+ * This is what we need to know about a revmap extension.  Backup block 0 is
+ * the metapage; the new revmap page is always initialized from scratch.
+ */
+typedef struct xl_brin_revmap_extend
+{
+	RelFileNode node;
+	BlockNumber targetBlk;
+} xl_brin_revmap_extend;
+
+#define SizeOfBrinRevmapExtend	(offsetof(xl_brin_revmap_extend, targetBlk) + sizeof(BlockNumber))
+
+#endif   /* BRIN_PRIVATE_H */
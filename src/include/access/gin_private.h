@@ -554,6 +554,14 @@ extern Buffer ginScanBeginPostingTree(GinPostingTreeScan *gdi);
 extern void ginDataFillRoot(GinBtree btree, Buffer root, Buffer lbuf, Buffer rbuf);
 extern void ginPrepareDataScan(GinBtree btree, Relation index);
 
+typedef struct GinPostingTreeBuild GinPostingTreeBuild;
+
+extern GinPostingTreeBuild *ginBeginPostingTree(Relation index,
+					GinStatsData *buildStats);
+extern void ginPostingTreeAdd(GinPostingTreeBuild *ptb,
+				  ItemPointerData *items, uint32 nitem);
+extern BlockNumber ginEndPostingTree(GinPostingTreeBuild *ptb);
+
 /* ginscan.c */
 
 /*
@@ -32,6 +32,8 @@ typedef struct BulkInsertStateData
 {
 	BufferAccessStrategy strategy;		/* our BULKWRITE strategy object */
 	Buffer		current_buf;	/* current insertion target page */
+	BlockNumber unlogged_block;	/* page filled by HEAP_INSERT_LOG_PAGES
+								 * inserts but not WAL-logged yet */
 }	BulkInsertStateData;
 
 
@@ -41,5 +43,6 @@ extern Buffer RelationGetBufferForTuple(Relation relation, Size len,
 						  Buffer otherBuffer, int options,
 						  BulkInsertState bistate,
 						  Buffer *vmbuffer, Buffer *vmbuffer_other);
+extern void RelationRecordHotUpdate(Relation relation, bool samepage);
 
 #endif   /* HIO_H */
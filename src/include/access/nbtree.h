@@ -130,6 +130,68 @@ typedef struct BTMetaPageData
 #define BTREE_DEFAULT_FILLFACTOR	90
 #define BTREE_NONLEAF_FILLFACTOR	70
 
+/*
+ * Storage type for btree's reloptions.  fillfactor must stay at the same
+ * position as in StdRdOptions, see RelationGetFillFactor().
+ */
+typedef struct BTOptions
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	int			fillfactor;		/* page fill factor in percent (0..100) */
+	bool		deduplicate_items;		/* merge duplicates into posting lists? */
+} BTOptions;
+
+/*
+ * Posting list tuples
+ *
+ * On the leaf pages of a non-unique index, a run of index tuples that are
+ * byte-for-byte identical apart from their heap TIDs can be merged into a
+ * single posting list tuple, which stores the common key just once and is
+ * followed by an array of all the heap TIDs.  A posting list tuple has
+ * BT_IS_POSTING set in t_info.  Its t_tid does not point to the heap: the
+ * block number field gives the offset of the TID array from the start of the
+ * tuple, which is the MAXALIGN'ed size of the key part, and the offset number
+ * field gives the number of TIDs, at least two.
+ *
+ * Requiring byte-for-byte equality rather than equality according to the
+ * operator class keeps index-only scans exact: the key of a posting list
+ * tuple is the key of every row it stands for.  Posting list tuples never
+ * serve as high keys or downlinks; _bt_keytuple() strips the TID array from
+ * a tuple whose key is copied to one.
+ *
+ * A posting list tuple is never made larger than BTMaxPostingSize, which
+ * leaves room for splitting the page it is on in all the usual ways.
+ */
+#define BT_IS_POSTING		INDEX_AM_RESERVED_BIT
+
+#define BTreeTupleIsPosting(itup) \
+	(((itup)->t_info & BT_IS_POSTING) != 0)
+#define BTreeTupleGetNPosting(itup) \
+	ItemPointerGetOffsetNumber(&(itup)->t_tid)
+#define BTreeTupleGetPostingOffset(itup) \
+	ItemPointerGetBlockNumber(&(itup)->t_tid)
+#define BTreeTupleGetPosting(itup) \
+	((ItemPointer) ((char *) (itup) + BTreeTupleGetPostingOffset(itup)))
+
+/* size of the key part of a tuple, including its header */
+#define BTreeTupleGetKeySize(itup) \
+	(BTreeTupleIsPosting(itup) ? \
+	 (Size) BTreeTupleGetPostingOffset(itup) : IndexTupleSize(itup))
+
+/* number of heap TIDs a leaf tuple stands for */
+#define BTreeTupleGetNHeapTids(itup) \
+	(BTreeTupleIsPosting(itup) ? BTreeTupleGetNPosting(itup) : 1)
+
+#define BTMaxPostingSize(page)		(BTMaxItemSize(page) / 2)
+
+/*
+ * Upper bound on the number of heap TIDs a leaf page can hold, when all its
+ * space goes to the TID arrays of posting list tuples.
+ */
+#define MaxTIDsPerBTreePage \
+	((int) ((BLCKSZ - SizeOfPageHeaderData - sizeof(BTPageOpaqueData)) / \
+			sizeof(ItemPointerData)))
+
 /*
  *	Test whether two btree entries are "the same".
  *
@@ -224,6 +286,8 @@ typedef struct BTMetaPageData
 										 * vacuum */
 #define XLOG_BTREE_REUSE_PAGE	0xD0	/* old page is about to be reused from
 										 * FSM */
+#define XLOG_BTREE_DEDUP		0xE0	/* merge duplicates on a leaf page into
+										 * posting list tuples */
 
 /*
  * All that we need to find changed index tuple
@@ -357,17 +421,49 @@ typedef struct xl_btree_reuse_page
  *
  * Note that the *last* WAL record in any vacuum of an index is allowed to
  * have a zero length array of offsets. Earlier records must have at least one.
+ *
+ * Posting list tuples that lose only some of their heap TIDs are not deleted
+ * but replaced by a smaller tuple, in the same position.  Replacements are
+ * applied before deletions, so all target offsets refer to the page as it
+ * was before the record.
  */
 typedef struct xl_btree_vacuum
 {
 	RelFileNode node;
 	BlockNumber block;
 	BlockNumber lastBlockVacuumed;
+	uint16		ndeleted;
+	uint16		nupdated;
 
-	/* TARGET OFFSET NUMBERS FOLLOW */
+	/* DELETED TARGET OFFSET NUMBERS FOLLOW */
+	/* UPDATED TARGET OFFSET NUMBERS FOLLOW */
+	/* REPLACEMENT INDEX TUPLES FOLLOW, ONE PER UPDATED TARGET */
 } xl_btree_vacuum;
 
-#define SizeOfBtreeVacuum	(offsetof(xl_btree_vacuum, lastBlockVacuumed) + sizeof(BlockNumber))
+#define SizeOfBtreeVacuum	(offsetof(xl_btree_vacuum, nupdated) + sizeof(uint16))
+
+/*
+ * This is what we need to know about a deduplication pass over a leaf page.
+ * Each interval names a run of consecutive items that were merged into one
+ * posting list tuple, in page order.  Items outside the intervals are kept
+ * as they are.
+ */
+typedef struct xl_btree_dedup_interval
+{
+	OffsetNumber baseoff;		/* first item of the run */
+	uint16		nitems;			/* number of items merged */
+} xl_btree_dedup_interval;
+
+typedef struct xl_btree_dedup
+{
+	RelFileNode node;
+	BlockNumber block;
+	uint16		nintervals;
+
+	/* xl_btree_dedup_interval ARRAY FOLLOWS */
+} xl_btree_dedup;
+
+#define SizeOfBtreeDedup	(offsetof(xl_btree_dedup, nintervals) + sizeof(uint16))
 
 /*
  * This is what we need to know about deletion of a btree page.  The target
@@ -482,6 +578,10 @@ typedef BTStackData *BTStack;
  * matched item, otherwise only its heap TID and offset.  The IndexTuples go
  * into a separate workspace array; each BTScanPosItem stores its tuple's
  * offset within that array.
+ *
+ * A posting list tuple yields one item per heap TID.  Its items are stored
+ * next to each other in the order of its TID array, whichever the scan
+ * direction, and share one copy of the key in the workspace.
  */
 
 typedef struct BTScanPosItem	/* what we remember about each match */
@@ -523,7 +623,7 @@ typedef struct BTScanPosData
 	int			lastItem;		/* last valid index in items[] */
 	int			itemIndex;		/* current index in items[] */
 
-	BTScanPosItem items[MaxIndexTuplesPerPage]; /* MUST BE LAST */
+	BTScanPosItem items[MaxTIDsPerBTreePage];	/* MUST BE LAST */
 } BTScanPosData;
 
 typedef BTScanPosData *BTScanPos;
@@ -620,6 +720,18 @@ extern Buffer _bt_getstackbuf(Relation rel, BTStack stack, int access);
 extern void _bt_insert_parent(Relation rel, Buffer buf, Buffer rbuf,
 				  BTStack stack, bool is_root, bool is_only);
 
+/*
+ * prototypes for functions in nbtdedup.c
+ */
+extern bool _bt_dedup_enabled(Relation rel);
+extern bool _bt_dedup_mergeable(IndexTuple base, IndexTuple itup);
+extern IndexTuple _bt_form_posting(IndexTuple base, ItemPointer htids,
+				 int nhtids);
+extern IndexTuple _bt_keytuple(IndexTuple itup);
+extern bool _bt_dedup_one_page(Relation rel, Buffer buf);
+extern Page _bt_dedup_apply(Page page, xl_btree_dedup_interval *intervals,
+				int nintervals);
+
 /*
  * prototypes for functions in nbtpage.c
  */
@@ -638,7 +750,8 @@ extern void _bt_delitems_delete(Relation rel, Buffer buf,
 					OffsetNumber *itemnos, int nitems, Relation heapRel);
 extern void _bt_delitems_vacuum(Relation rel, Buffer buf,
 					OffsetNumber *itemnos, int nitems,
-					BlockNumber lastBlockVacuumed);
+					OffsetNumber *updateitemnos, IndexTuple *updated,
+					int nupdated, BlockNumber lastBlockVacuumed);
 extern int	_bt_pagedel(Relation rel, Buffer buf, BTStack stack);
 
 /*
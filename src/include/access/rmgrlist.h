@@ -48,3 +48,4 @@ PG_RMGR(RM_BARRIER_ID, "Barrier", barrier_redo, barrier_desc, NULL, NULL, NULL)
 #ifdef ADB
 PG_RMGR(RM_RXACT_MGR_ID, "Rxact", rxact_redo, rxact_desc, rxact_xlog_startup, rxact_xlog_cleanup, NULL)
 #endif /* ADB */
+PG_RMGR(RM_BRIN_ID, "BRIN", brin_redo, brin_desc, NULL, NULL, NULL)
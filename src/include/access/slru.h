@@ -50,6 +50,15 @@ typedef enum
 	SLRU_PAGE_WRITE_IN_PROGRESS /* page is being written out */
 } SlruPageStatus;
 
+/*
+ * The buffer slots are divided into banks of about SLRU_BANK_SIZE slots, and
+ * a page can only be cached in bank (pageno % num_banks).  Looking a page up
+ * or choosing a victim slot then only scans one bank, whatever the number of
+ * buffers, and each bank has its own lock for read-only lookups.
+ */
+#define SLRU_BANK_SIZE			16
+#define SLRU_NUM_BANKS(nslots)	Max(1, (nslots) / SLRU_BANK_SIZE)
+
 /*
  * Shared-memory state
  */
@@ -71,6 +80,17 @@ typedef struct SlruSharedData
 	int		   *page_lru_count;
 	LWLockId   *buffer_locks;
 
+	/*
+	 * page_generation[] is odd while a slot is changing the page it holds,
+	 * and is incremented again once the change is done, so that a reader
+	 * holding no lock can check the slot still holds the page it looked at.
+	 */
+	uint32	   *page_generation;
+
+	/* Banks of slots, see SLRU_BANK_SIZE */
+	int			num_banks;
+	LWLockId   *bank_locks;
+
 	/*
 	 * Optional array of WAL flush LSNs associated with entries in the SLRU
 	 * pages.  If not zero/NULL, we must flush WAL before writing pages (true
@@ -142,6 +162,10 @@ extern int SimpleLruReadPage(SlruCtl ctl, int pageno, bool write_ok,
 				  TransactionId xid);
 extern int SimpleLruReadPage_ReadOnly(SlruCtl ctl, int pageno,
 						   TransactionId xid);
+extern int SimpleLruReadPage_Bank(SlruCtl ctl, int pageno,
+					   TransactionId xid, LWLockId *lockheld);
+extern int	SimpleLruPeekPage(SlruCtl ctl, int pageno, uint32 *generation);
+extern bool SimpleLruPeekValid(SlruCtl ctl, int slotno, uint32 generation);
 extern void SimpleLruWritePage(SlruCtl ctl, int slotno);
 extern void SimpleLruFlush(SlruCtl ctl, bool checkpoint);
 extern void SimpleLruTruncate(SlruCtl ctl, int cutoffPage);
@@ -123,6 +123,14 @@ typedef struct VariableCacheData
 	 */
 	TransactionId latestCompletedXid;	/* newest XID that has committed or
 										 * aborted */
+#ifdef ADB
+
+	/*
+	 * nextXid at the end of startup, set once before backends run.  Any XID
+	 * which ran here and was lost in a crash precedes it.
+	 */
+	TransactionId startupNextXid;
+#endif
 } VariableCacheData;
 
 typedef VariableCacheData *VariableCache;
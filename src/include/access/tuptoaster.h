@@ -94,6 +94,16 @@
 	 sizeof(int32) -									\
 	 VARHDRSZ)
 
+/*
+ * Compression methods for in-line compressed values, as recorded in the top
+ * bits of their va_rawsize (see VARCOMPRESS_4B_C).
+ */
+#define TOAST_PGLZ_COMPRESSION_ID	0
+#define TOAST_LZ4_COMPRESSION_ID	1
+
+/* GUC variable: compression method of columns without their own setting */
+extern int	default_toast_compression;
+
 
 /* ----------
  * toast_insert_or_update -
@@ -168,7 +178,31 @@ extern Datum toast_flatten_tuple_to_datum(HeapTupleHeader tup,
  *	Create a compressed version of a varlena datum, if possible
  * ----------
  */
-extern Datum toast_compress_datum(Datum value);
+extern Datum toast_compress_datum(Datum value, int method);
+
+/* ----------
+ * toast_compression_method -
+ *
+ *	Return the compression method to use for a column of a relation
+ * ----------
+ */
+extern int	toast_compression_method(Relation rel, AttrNumber attnum);
+
+/* ----------
+ * toast_compression_name -
+ *
+ *	Return the name of a compression method
+ * ----------
+ */
+extern const char *toast_compression_name(int method);
+
+/* ----------
+ * toast_validate_compression_option -
+ *
+ *	Check the value of a column's "compression" option
+ * ----------
+ */
+extern void toast_validate_compression_option(char *value);
 
 /* ----------
  * toast_raw_datum_size -
@@ -186,4 +220,12 @@ extern Size toast_raw_datum_size(Datum value);
  */
 extern Size toast_datum_size(Datum value);
 
+/* ----------
+ * toast_datum_compression -
+ *
+ *	Return the compression method of a varlena datum, or -1
+ * ----------
+ */
+extern int	toast_datum_compression(Datum value);
+
 #endif   /* TUPTOASTER_H */
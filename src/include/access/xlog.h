@@ -180,10 +180,14 @@ typedef enum
 #endif
 } RecoveryTargetType;
 
+extern XLogRecPtr ProcLastRecPtr;
 extern XLogRecPtr XactLastRecEnd;
 
 extern bool reachedConsistency;
 
+/* number of WAL insertion locks; see "Inserting to WAL" in xlog.c */
+#define NUM_XLOGINSERT_LOCKS		8
+
 /* these variables are GUC parameters related to XLOG */
 extern int	CheckPointSegments;
 extern int	wal_keep_segments;
@@ -194,6 +198,9 @@ extern char *XLogArchiveCommand;
 extern bool EnableHotStandby;
 extern bool fullPageWrites;
 extern bool log_checkpoints;
+#ifdef ADB
+extern bool wal_compression;
+#endif
 
 /* WAL levels */
 typedef enum WalLevel
@@ -303,6 +310,10 @@ extern char *XLogFileNameP(TimeLineID tli, XLogSegNo segno);
 
 extern void UpdateControlFile(void);
 extern uint64 GetSystemIdentifier(void);
+#ifdef ADB
+extern void GetFullPageImageStats(uint64 *images, uint64 *compressed,
+					  uint64 *imageBytes, uint64 *storedBytes);
+#endif
 extern bool DataChecksumsEnabled(void);
 extern XLogRecPtr GetFakeLSNForUnloggedRel(void);
 extern Size XLOGShmemSize(void);
@@ -40,6 +40,13 @@
  * Note that we don't attempt to align either the BkpBlock struct or the
  * block's data.  So, the struct must be copied to aligned local storage
  * before use.
+ *
+ * With wal_compression, the data with its hole removed may be stored
+ * compressed by LZ4 instead.  BKPBLOCK_COMPRESSED is then set in
+ * hole_offset, and hole_length is such that the amount of data following
+ * the struct still is BLCKSZ - hole_length bytes: the LZ4 output, then
+ * the actual length of the hole as an unaligned uint16.  A hole always
+ * starts within the page, so the flag cannot be mistaken for an offset.
  */
 typedef struct BkpBlock
 {
@@ -52,10 +59,14 @@ typedef struct BkpBlock
 	/* ACTUAL BLOCK DATA FOLLOWS AT END OF STRUCT */
 } BkpBlock;
 
+#ifdef ADB
+#define BKPBLOCK_COMPRESSED		0x8000	/* in hole_offset */
+#endif
+
 /*
  * Each page of XLOG file has a header like this:
  */
-#define XLOG_PAGE_MAGIC 0xD075	/* can be used as WAL version indicator */
+#define XLOG_PAGE_MAGIC 0xD07B	/* can be used as WAL version indicator */
 
 typedef struct XLogPageHeaderData
 {
@@ -0,0 +1,29 @@
+/*-------------------------------------------------------------------------
+ *
+ * xlogprefetch.h
+ *
+ *	  Prefetching of the data blocks WAL replay is about to read
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/access/xlogprefetch.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef XLOGPREFETCH_H
+#define XLOGPREFETCH_H
+
+#include "access/xlogdefs.h"
+
+/* GUC parameter, in kB of WAL read ahead of replay */
+extern int	recovery_prefetch_distance;
+
+typedef struct XLogPrefetcher XLogPrefetcher;
+
+extern XLogPrefetcher *XLogPrefetcherAllocate(void);
+extern void XLogPrefetcherFree(XLogPrefetcher *prefetcher);
+extern void XLogPrefetcherReadAhead(XLogPrefetcher *prefetcher,
+						XLogRecPtr replayPtr, TimeLineID tli,
+						XLogRecPtr limitPtr);
+
+#endif   /* XLOGPREFETCH_H */
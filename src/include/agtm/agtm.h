@@ -41,10 +41,22 @@ typedef enum AGTM_SequenceKeyType
  */
 extern TransactionId agtm_GetGlobalTransactionId(bool isSubXact);
 
+extern bool enable_agtm_snapshot_compact;
+extern bool enable_agtm_snapshot_prefetch;
+
 /*
  * get Snapshot info from AGTM
  */
 extern Snapshot agtm_GetGlobalSnapShot(Snapshot snapshot);
+extern Snapshot agtm_GetGlobalSnapShotTimestamp(Snapshot snapshot, TimestampTz *timestamp);
+
+/*
+ * send a Snapshot request to AGTM now, its result is used by the next
+ * agtm_GetGlobalSnapShot of the current statement
+ */
+extern void agtm_PrefetchGlobalSnapShot(void);
+extern bool agtm_HaveSnapShotPrefetch(void);
+extern void agtm_DropSnapShotPrefetch(void);
 
 /*
  * get transaction status from AGTM by transaction ID.
@@ -95,6 +107,12 @@ extern void agtm_RenameSeuqneceByDataBase(const char * oldDatabase,
  */
 extern AGTM_Sequence agtm_GetSeqNextVal(const char *seqname, const char * database,	const char * schema);
 
+/*
+ * get a block of Sequence values from AGTM
+ */
+extern AGTM_Sequence agtm_GetSeqNextRange(const char *seqname, const char * database,
+			const char * schema, int64 range, AGTM_Sequence *last);
+
 /*
  * get current Sequence from AGTM
  */
@@ -0,0 +1,30 @@
+/*-------------------------------------------------------------------------
+ *
+ * agtm_broker.h
+ *
+ *	  Definitions for the coordinator side AGTM snapshot broker
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/agtm/agtm_broker.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef AGTM_BROKER_H
+#define AGTM_BROKER_H
+
+#include "utils/snapshot.h"
+
+/* GUC parameter */
+extern bool enable_agtm_snapshot_broker;
+
+extern Size AgtmBrokerShmemSize(void);
+extern void AgtmBrokerShmemInit(void);
+
+/*
+ * get Snapshot info from AGTM, sharing one AGTM round-trip
+ * with every backend waiting at the same time.
+ */
+extern Snapshot agtm_GetBrokeredSnapShot(Snapshot snapshot);
+
+#endif /* AGTM_BROKER_H */
@@ -6,10 +6,22 @@
 #include "lib/stringinfo.h"
 #include "libpq/libpq-fe.h"
 
+/* max number of requests sent to AGTM whose result is not taken yet */
+#define AGTM_MAX_PENDING	8
+
+typedef struct AGTM_Pending
+{
+	uint32				ticket;		/* given by agtm_AddPending */
+	AGTM_MessageType	msg_type;
+	PGresult		   *res;		/* NULL until read from AGTM */
+} AGTM_Pending;
+
 typedef struct AGTM_Conn
 {
 	PGconn 		*pg_Conn;
 	PGresult	*pg_res;
+	int			npending;
+	AGTM_Pending pending[AGTM_MAX_PENDING];	/* in the order they were sent */
 } AGTM_Conn;
 
 #define AGTM_RESULT_COMM_ERROR (-2) /* Communication error */
@@ -46,4 +58,15 @@ extern StringInfo agtm_use_result_type(const PGresult *res, StringInfo buf, AGTM
 extern void agtm_check_result(StringInfo buf, AGTM_ResultType type);
 extern void agtm_use_result_end(StringInfo buf);
 
+/*
+ * pipelined requests: the message is sent first, then registered by
+ * agtm_AddPending and its result taken later by agtm_TakePending
+ */
+extern bool agtm_HavePending(void);
+extern bool agtm_IsPending(uint32 ticket);
+extern uint32 agtm_AddPending(AGTM_MessageType msg_type);
+extern PGresult* agtm_TakePending(uint32 ticket);
+extern void agtm_ReadPending(void);
+extern void agtm_DropPending(uint32 ticket);
+
 #endif
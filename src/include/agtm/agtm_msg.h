@@ -37,9 +37,11 @@ typedef enum AGTM_MessageType
 	AGTM_MSG_SEQUENCE_GET_CUR,
 	AGTM_MSG_SEQUENCE_GET_LAST,	/* Get the last sequence value of sequence */
 	AGTM_MSG_SEQUENCE_SET_VAL,	/* Set values for sequence */
-	AGTM_MSG_GET_STATUS			/* Get status of a given transaction */
+	AGTM_MSG_GET_STATUS,		/* Get status of a given transaction */
+	AGTM_MSG_SNAPSHOT_GET_COMPACT,	/* Get a global snapshot, compact encoding */
+	AGTM_MSG_SEQUENCE_GET_RANGE		/* Get a block of sequence values */
 } AGTM_MessageType;
-#define AGTM_MSG_TYPE_COUNT (AGTM_MSG_GET_STATUS+1)
+#define AGTM_MSG_TYPE_COUNT (AGTM_MSG_SEQUENCE_GET_RANGE+1)
 
 /*
  * Symbols in the following enum are usd in result_name_tab defined in agtm_utils.c.
@@ -64,9 +66,11 @@ typedef enum AGTM_ResultType
 	AGTM_MSG_SEQUENCE_GET_CUR_RESULT,
 	AGTM_SEQUENCE_GET_LAST_RESULT,
 	AGTM_SEQUENCE_SET_VAL_RESULT,
-	AGTM_COMPLETE_RESULT			/* for no message result */
+	AGTM_COMPLETE_RESULT,			/* for no message result */
+	AGTM_SNAPSHOT_GET_COMPACT_RESULT,
+	AGTM_SEQUENCE_GET_RANGE_RESULT
 } AGTM_ResultType;
-#define AGTM_RESULT_TYPE_COUNT (AGTM_COMPLETE_RESULT+1)
+#define AGTM_RESULT_TYPE_COUNT (AGTM_SEQUENCE_GET_RANGE_RESULT+1)
 
 typedef enum AgtmNodeTag
 {
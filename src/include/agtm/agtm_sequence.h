@@ -18,8 +18,24 @@
 
 #include "lib/stringinfo.h"
 
+extern int agtm_sequence_cache_size;
+extern int agtm_sequence_prealloc;
+
+/*
+ *  values reserved in advance and shared by all AGTM backends
+ */
+extern Size AgtmSeqCacheShmemSize(void);
+extern void AgtmSeqCacheShmemInit(void);
+extern void AgtmSeqCacheInvalidate(const char *dbName, const char *schemaName,
+					   const char *sequenceName);
+
 StringInfo ProcessNextSeqCommand(StringInfo message, StringInfo output);
 
+/*
+ *  reserve a block of consecutive values for the coordinator's local cache
+ */
+StringInfo ProcessRangeSeqCommand(StringInfo message, StringInfo output);
+
 /*
  *  select currval('seq1') will call this fucntion.function currval('sequence') called
  *  must after nextval('sequence') called and in the same session .otherwise function
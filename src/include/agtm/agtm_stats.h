@@ -0,0 +1,42 @@
+/*-------------------------------------------------------------------------
+ *
+ * agtm_stats.h
+ *
+ *	  Statistics of the messages exchanged with AGTM
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/agtm/agtm_stats.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef AGTM_STATS_H
+#define AGTM_STATS_H
+
+#include "agtm/agtm_msg.h"
+#include "fmgr.h"
+#include "portability/instr_time.h"
+
+/*
+ * Buckets of the latency histograms: bucket i counts the requests which
+ * took between 2^i and 2^(i+1) microseconds, the first one also those
+ * below, the last one also those above.
+ */
+#define AGTM_STAT_HIST_BUCKETS	20
+
+extern Size AgtmStatsShmemSize(void);
+extern void AgtmStatsShmemInit(void);
+
+extern void AgtmStatsCountMessage(AGTM_MessageType mtype, uint32 request_bytes,
+					  uint32 response_bytes, instr_time *start);
+extern void AgtmStatsCountSnapshot(uint32 xcnt, uint32 subxcnt);
+
+extern Datum pg_agtm_stat_messages(PG_FUNCTION_ARGS);
+extern Datum pg_agtm_stat_snapshots(PG_FUNCTION_ARGS);
+extern Datum pg_agtm_stat_reset(PG_FUNCTION_ARGS);
+#ifdef ADB
+extern Datum pg_agtm_server_stat_messages(PG_FUNCTION_ARGS);
+extern Datum pg_agtm_server_stat_snapshots(PG_FUNCTION_ARGS);
+#endif
+
+#endif /* AGTM_STATS_H */
@@ -24,6 +24,8 @@ StringInfo ProcessGetTimestamp(StringInfo message, StringInfo output);
 
 StringInfo ProcessGetSnapshot(StringInfo message, StringInfo output);
 
+StringInfo ProcessGetSnapshotCompact(StringInfo message, StringInfo output);
+
 StringInfo ProcessGetXactStatus(StringInfo message, StringInfo output);
 
 StringInfo ProcessSyncXID(StringInfo message, StringInfo output);
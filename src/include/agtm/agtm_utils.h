@@ -2,8 +2,18 @@
 #define AGTM_UTILS_H
 
 #include "agtm/agtm_msg.h"
+#include "lib/stringinfo.h"
 
 extern const char *gtm_util_message_name(AGTM_MessageType type);
 extern const char *gtm_util_result_name(AGTM_ResultType type);
 
+extern void agtm_put_varint(StringInfo buf, uint32 val);
+extern uint32 agtm_get_varint(StringInfo msg);
+extern void agtm_put_xid_list(StringInfo buf, TransactionId base,
+							  const TransactionId *xids, uint32 count);
+extern void agtm_get_xid_list(StringInfo msg, TransactionId base, uint32 count,
+							  TransactionId *xids, uint32 max);
+extern void agtm_sort_xids(TransactionId *xids, uint32 count);
+extern int agtm_xid_cmp(TransactionId a, TransactionId b);
+
 #endif
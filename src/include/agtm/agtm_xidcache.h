@@ -0,0 +1,29 @@
+/*-------------------------------------------------------------------------
+ *
+ * agtm_xidcache.h
+ *
+ *	  Shared cache of final transaction status got from AGTM
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/agtm/agtm_xidcache.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef AGTM_XIDCACHE_H
+#define AGTM_XIDCACHE_H
+
+#include "access/clog.h"
+#include "fmgr.h"
+
+extern int agtm_xid_status_cache_size;
+
+extern Size AgtmXidCacheShmemSize(void);
+extern void AgtmXidCacheShmemInit(void);
+
+extern bool AgtmXidCacheLookup(TransactionId xid, XidStatus *status, XLogRecPtr *lsn);
+extern void AgtmXidCacheStore(TransactionId xid, XidStatus status, XLogRecPtr lsn);
+
+extern Datum pg_agtm_xid_status_cache_stats(PG_FUNCTION_ARGS);
+
+#endif /* AGTM_XIDCACHE_H */
@@ -153,6 +153,10 @@ extern void GetRelationDistributionItems(Oid relid,
 #endif
 										 );
 #ifdef ADB
+extern List *GetRelationDistributionValues(DistributeBy *distributeby,
+										   TupleDesc descriptor,
+										   AttrNumber attnum,
+										   int numnodes);
 extern void AddPgxcRelationDependFunction(Oid relid,
 										  DistributeBy *distributeby,
 										  PGXCSubCluster *subcluster,
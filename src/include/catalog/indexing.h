@@ -396,6 +396,33 @@ DECLARE_UNIQUE_INDEX(monitor_job_oid_index, 4919, on monitor_job using btree(oid
 DECLARE_UNIQUE_INDEX(monitor_jobitem_name_index, 4930, on monitor_jobitem using btree(jobitem_itemname name_ops));
 #define MonitorJobitemItemnameIndexId 4930
 
+DECLARE_INDEX(monitor_cpu_timestamptz_index, 5236, on monitor_cpu using btree(mc_timestamptz timestamptz_ops));
+#define MonitorCpuTimestamptzIndexId 5236
+
+DECLARE_INDEX(monitor_mem_timestamptz_index, 5237, on monitor_mem using btree(mm_timestamptz timestamptz_ops));
+#define MonitorMemTimestamptzIndexId 5237
+
+DECLARE_INDEX(monitor_disk_timestamptz_index, 5238, on monitor_disk using btree(md_timestamptz timestamptz_ops));
+#define MonitorDiskTimestamptzIndexId 5238
+
+DECLARE_INDEX(monitor_net_timestamptz_index, 5239, on monitor_net using btree(mn_timestamptz timestamptz_ops));
+#define MonitorNetTimestamptzIndexId 5239
+
+DECLARE_INDEX(monitor_host_current_time_index, 5240, on monitor_host using btree(mh_current_time timestamptz_ops));
+#define MonitorHostCurrentTimeIndexId 5240
+
+DECLARE_INDEX(monitor_databaseitem_time_index, 5241, on monitor_databaseitem using btree(monitor_databaseitem_time timestamptz_ops));
+#define MonitorDatabaseitemTimeIndexId 5241
+
+DECLARE_INDEX(monitor_databasetps_time_index, 5242, on monitor_databasetps using btree(monitor_databasetps_time timestamptz_ops));
+#define MonitorDatabasetpsTimeIndexId 5242
+
+DECLARE_INDEX(monitor_slowlog_time_index, 5243, on monitor_slowlog using btree(slowlogtime timestamptz_ops));
+#define MonitorSlowlogTimeIndexId 5243
+
+DECLARE_UNIQUE_INDEX(monitor_host_rollup_level_timestamptz_hostname_index, 5244, on monitor_host_rollup using btree(mhr_level char_ops, mhr_timestamptz timestamptz_ops, hostname name_ops));
+#define MonitorHostRollupLevelTimestamptzHostnameIndexId 5244
+
 #endif /* ADBMGRD */
 
 #ifdef AGTM
@@ -0,0 +1,65 @@
+#ifndef MONITOR_HOST_ROLLUP_H
+#define MONITOR_HOST_ROLLUP_H
+
+#ifdef BUILD_BKI
+#include "catalog/buildbki.h"
+#else /* BUILD_BKI */
+#include "catalog/genbki.h"
+#include "utils/timestamp.h"
+#define timestamptz int
+#endif /* BUILD_BKI */
+
+#define MonitorHostRollupRelationId 5235
+
+/*
+ * hourly and daily aggregates of monitor_cpu, monitor_mem, monitor_disk and
+ * monitor_net, made by monitor_rollup_host_data() for every complete hour and
+ * day, so the history of a host outlives "clean monitor"
+ */
+CATALOG(monitor_host_rollup,5235) BKI_WITHOUT_OIDS
+{
+    NameData    hostname;           /* host name */
+    char        mhr_level;          /* MONITOR_ROLLUP_HOUR or MONITOR_ROLLUP_DAY */
+    timestamptz mhr_timestamptz;    /* start of the hour or of the day */
+    int32       mhr_samples;        /* monitor_cpu samples of the period */
+    float4      mhr_cpu_avg;        /* average cpu usage */
+    float4      mhr_cpu_max;        /* highest cpu usage */
+    float4      mhr_mem_avg;        /* average memory usage */
+    float4      mhr_mem_max;        /* highest memory usage */
+    int64       mhr_disk_used;      /* highest disk used size */
+    int64       mhr_net_sent;       /* average network sent speed */
+    int64       mhr_net_recv;       /* average network recv speed */
+} FormData_monitor_host_rollup;
+
+#ifndef BUILD_BKI
+#undef timestamptz
+#endif
+
+/* ----------------
+ *      Form_monitor_host_rollup corresponds to a pointer to a tuple with
+ *      the format of monitor_host_rollup relation.
+ * ----------------
+ */
+typedef FormData_monitor_host_rollup *Form_monitor_host_rollup;
+
+/* ----------------
+ *      compiler constants for monitor_host_rollup
+ * ----------------
+ */
+#define Natts_monitor_host_rollup                   11
+#define Anum_monitor_host_rollup_hostname           1
+#define Anum_monitor_host_rollup_level              2
+#define Anum_monitor_host_rollup_timestamptz        3
+#define Anum_monitor_host_rollup_samples            4
+#define Anum_monitor_host_rollup_cpu_avg            5
+#define Anum_monitor_host_rollup_cpu_max            6
+#define Anum_monitor_host_rollup_mem_avg            7
+#define Anum_monitor_host_rollup_mem_max            8
+#define Anum_monitor_host_rollup_disk_used          9
+#define Anum_monitor_host_rollup_net_sent           10
+#define Anum_monitor_host_rollup_net_recv           11
+
+#define MONITOR_ROLLUP_HOUR     'h'
+#define MONITOR_ROLLUP_DAY      'd'
+
+#endif /* MONITOR_HOST_ROLLUP_H */
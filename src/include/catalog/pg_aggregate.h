@@ -455,6 +455,16 @@ DATA(insert ( 3175	json_agg_transfn	-	json_agg_finalfn		0	2281	_null_ _null_ ));
 DATA(insert ( 3175	json_agg_transfn	json_agg_finalfn		0	2281	_null_ ));
 #endif
 
+#ifdef ADB
+/* latency histograms */
+DATA(insert ( 5369	latency_histogram_add	latency_histogram_add	-	0	1016	_null_ _null_ ));
+
+/* approximate distinct counting */
+DATA(insert ( 5423	hll_add_trans	hll_union	hll_cardinality	0	5426	"010e00" _null_ ));
+DATA(insert ( 5424	hll_add_trans	hll_union	-				0	5426	"010e00" _null_ ));
+DATA(insert ( 5425	hll_union		hll_union	-				0	5426	_null_ _null_ ));
+#endif /* ADB */
+
 /*
  * prototypes for functions in pg_aggregate.c
  */
@@ -127,6 +127,7 @@ DATA(insert (	1989   26 26 2 3134 ));
 DATA(insert (	1991   30 30 1 404 ));
 DATA(insert (	2994   2249 2249 1 2987 ));
 DATA(insert (	1994   25 25 1 360 ));
+DATA(insert (	1994   25 25 2 5246 ));
 DATA(insert (	1996   1083 1083 1 1107 ));
 DATA(insert (	2000   1266 1266 1 1358 ));
 DATA(insert (	2002   1562 1562 1 1672 ));
@@ -383,4 +384,45 @@ DATA(insert (	3474   3831 3831 3 3471 ));
 DATA(insert (	3474   3831 3831 4 3472 ));
 DATA(insert (	3474   3831 3831 5 3473 ));
 
+/* BRIN minmax opclasses */
+DATA(insert (	5321   21 21 1 350 ));
+DATA(insert (	5321   21 23 1 2190 ));
+DATA(insert (	5321   21 20 1 2192 ));
+DATA(insert (	5321   23 23 1 351 ));
+DATA(insert (	5321   23 20 1 2188 ));
+DATA(insert (	5321   23 21 1 2191 ));
+DATA(insert (	5321   20 20 1 842 ));
+DATA(insert (	5321   20 23 1 2189 ));
+DATA(insert (	5321   20 21 1 2193 ));
+DATA(insert (	5322   700 700 1 354 ));
+DATA(insert (	5322   700 701 1 2194 ));
+DATA(insert (	5322   701 701 1 355 ));
+DATA(insert (	5322   701 700 1 2195 ));
+DATA(insert (	5323   1700 1700 1 1769 ));
+DATA(insert (	5324   1082 1082 1 1092 ));
+DATA(insert (	5324   1082 1114 1 2344 ));
+DATA(insert (	5324   1082 1184 1 2357 ));
+DATA(insert (	5324   1114 1114 1 2045 ));
+DATA(insert (	5324   1114 1082 1 2370 ));
+DATA(insert (	5324   1114 1184 1 2526 ));
+DATA(insert (	5324   1184 1184 1 1314 ));
+DATA(insert (	5324   1184 1082 1 2383 ));
+DATA(insert (	5324   1184 1114 1 2533 ));
+DATA(insert (	5325   25 25 1 360 ));
+DATA(insert (	5326   26 26 1 356 ));
+DATA(insert (	5327   1042 1042 1 1078 ));
+DATA(insert (	5328   17 17 1 1954 ));
+DATA(insert (	5329   1083 1083 1 1107 ));
+DATA(insert (	5330   1186 1186 1 1315 ));
+
+#ifdef ADB
+/* jsonb_ops */
+DATA(insert (	5413   3802 3802 1 5391 ));
+DATA(insert (	5414   3802 3802 1 5392 ));
+DATA(insert (	5415   3802 3802 1 5393 ));
+DATA(insert (	5415   3802 3802 2 5394 ));
+DATA(insert (	5415   3802 3802 3 5395 ));
+DATA(insert (	5415   3802 3802 4 5396 ));
+#endif /* ADB */
+
 #endif   /* PG_AMPROC_H */
@@ -363,4 +363,10 @@ DATA(insert ( 1560 1560 1685 i f ));
 DATA(insert ( 1562 1562 1687 i f ));
 DATA(insert ( 1700 1700 1703 i f ));
 
+#ifdef ADB
+/* json and jsonb convert through their text forms */
+DATA(insert (  114 3802    0 a i ));
+DATA(insert ( 3802	114    0 a i ));
+#endif /* ADB */
+
 #endif   /* PG_CAST_H */
@@ -232,4 +232,27 @@ DATA(insert (	4000	quad_point_ops		PGNSP PGUID 4015  600 t 0 ));
 DATA(insert (	4000	kd_point_ops		PGNSP PGUID 4016  600 f 0 ));
 DATA(insert (	4000	text_ops			PGNSP PGUID 4017  25 t 0 ));
 
+/* BRIN minmax opclasses */
+DATA(insert (	3580	int2_minmax_ops	PGNSP PGUID 5321   21 t 0 ));
+DATA(insert (	3580	int4_minmax_ops	PGNSP PGUID 5321   23 t 0 ));
+DATA(insert (	3580	int8_minmax_ops	PGNSP PGUID 5321   20 t 0 ));
+DATA(insert (	3580	float4_minmax_ops	PGNSP PGUID 5322  700 t 0 ));
+DATA(insert (	3580	float8_minmax_ops	PGNSP PGUID 5322  701 t 0 ));
+DATA(insert (	3580	numeric_minmax_ops	PGNSP PGUID 5323 1700 t 0 ));
+DATA(insert (	3580	date_minmax_ops	PGNSP PGUID 5324 1082 t 0 ));
+DATA(insert (	3580	timestamp_minmax_ops	PGNSP PGUID 5324 1114 t 0 ));
+DATA(insert (	3580	timestamptz_minmax_ops	PGNSP PGUID 5324 1184 t 0 ));
+DATA(insert (	3580	text_minmax_ops	PGNSP PGUID 5325   25 t 0 ));
+DATA(insert (	3580	oid_minmax_ops	PGNSP PGUID 5326   26 t 0 ));
+DATA(insert (	3580	bpchar_minmax_ops	PGNSP PGUID 5327 1042 t 0 ));
+DATA(insert (	3580	bytea_minmax_ops	PGNSP PGUID 5328   17 t 0 ));
+DATA(insert (	3580	time_minmax_ops	PGNSP PGUID 5329 1083 t 0 ));
+DATA(insert (	3580	interval_minmax_ops	PGNSP PGUID 5330 1186 t 0 ));
+
+#ifdef ADB
+DATA(insert (	403		jsonb_ops			PGNSP PGUID 5413  3802 t 0 ));
+DATA(insert (	405		jsonb_ops			PGNSP PGUID 5414  3802 t 0 ));
+DATA(insert (	2742	jsonb_ops			PGNSP PGUID 5415  3802 t 25 ));
+#endif /* ADB */
+
 #endif   /* PG_OPCLASS_H */
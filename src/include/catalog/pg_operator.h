@@ -1765,6 +1765,38 @@ DESCR("add");
 DATA(insert OID = 4058 (  "-"	   ORANSP PGUID b f f 3970 1186 3970  0	0 ora_date_mi_interval - - ));
 DESCR("subtract");
 
+/* jsonb */
+DATA(insert OID = 5398 (  "->"	   PGNSP PGUID b f f 3802 25 3802 0 0 jsonb_object_field - - ));
+DESCR("get jsonb object field");
+DATA(insert OID = 5399 (  "->>"    PGNSP PGUID b f f 3802 25 25 0 0 jsonb_object_field_text - - ));
+DESCR("get jsonb object field as text");
+DATA(insert OID = 5400 (  "->"	   PGNSP PGUID b f f 3802 23 3802 0 0 jsonb_array_element - - ));
+DESCR("get jsonb array element");
+DATA(insert OID = 5401 (  "->>"    PGNSP PGUID b f f 3802 23 25 0 0 jsonb_array_element_text - - ));
+DESCR("get jsonb array element as text");
+DATA(insert OID = 5402 (  "?"	   PGNSP PGUID b f f 3802 25 16 0 0 jsonb_exists contsel contjoinsel ));
+DESCR("exists");
+DATA(insert OID = 5403 (  "?|"	   PGNSP PGUID b f f 3802 1009 16 0 0 jsonb_exists_any contsel contjoinsel ));
+DESCR("exists any");
+DATA(insert OID = 5404 (  "?&"	   PGNSP PGUID b f f 3802 1009 16 0 0 jsonb_exists_all contsel contjoinsel ));
+DESCR("exists all");
+DATA(insert OID = 5405 (  "@>"	   PGNSP PGUID b f f 3802 3802 16 5406 0 jsonb_contains contsel contjoinsel ));
+DESCR("contains");
+DATA(insert OID = 5406 (  "<@"	   PGNSP PGUID b f f 3802 3802 16 5405 0 jsonb_contained contsel contjoinsel ));
+DESCR("is contained by");
+DATA(insert OID = 5407 (  "="	   PGNSP PGUID b t t 3802 3802 16 5407 5408 jsonb_eq eqsel eqjoinsel ));
+DESCR("equal");
+DATA(insert OID = 5408 (  "<>"	   PGNSP PGUID b f f 3802 3802 16 5408 5407 jsonb_ne neqsel neqjoinsel ));
+DESCR("not equal");
+DATA(insert OID = 5409 (  "<"	   PGNSP PGUID b f f 3802 3802 16 5410 5412 jsonb_lt scalarltsel scalarltjoinsel ));
+DESCR("less than");
+DATA(insert OID = 5410 (  ">"	   PGNSP PGUID b f f 3802 3802 16 5409 5411 jsonb_gt scalargtsel scalargtjoinsel ));
+DESCR("greater than");
+DATA(insert OID = 5411 (  "<="	   PGNSP PGUID b f f 3802 3802 16 5412 5410 jsonb_le scalarltsel scalarltjoinsel ));
+DESCR("less than or equal");
+DATA(insert OID = 5412 (  ">="	   PGNSP PGUID b f f 3802 3802 16 5411 5409 jsonb_ge scalargtsel scalargtjoinsel ));
+DESCR("greater than or equal");
+
 #endif
 
 /*
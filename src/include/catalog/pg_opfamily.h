@@ -76,6 +76,7 @@ DATA(insert OID =  428 (	403		bytea_ops		PGNSP PGUID ));
 DATA(insert OID =  429 (	403		char_ops		PGNSP PGUID ));
 DATA(insert OID =  431 (	405		char_ops		PGNSP PGUID ));
 DATA(insert OID =  434 (	403		datetime_ops	PGNSP PGUID ));
+#define DATETIME_BTREE_FAM_OID 434
 DATA(insert OID =  435 (	405		date_ops		PGNSP PGUID ));
 DATA(insert OID = 1970 (	403		float_ops		PGNSP PGUID ));
 DATA(insert OID = 1971 (	405		float_ops		PGNSP PGUID ));
@@ -152,4 +153,22 @@ DATA(insert OID = 4016 (	4000	kd_point_ops	PGNSP PGUID ));
 DATA(insert OID = 4017 (	4000	text_ops		PGNSP PGUID ));
 #define TEXT_SPGIST_FAM_OID 4017
 
+/* BRIN minmax opfamilies */
+DATA(insert OID = 5321 (	3580	integer_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5322 (	3580	float_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5323 (	3580	numeric_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5324 (	3580	datetime_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5325 (	3580	text_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5326 (	3580	oid_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5327 (	3580	bpchar_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5328 (	3580	bytea_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5329 (	3580	time_minmax_ops	PGNSP PGUID ));
+DATA(insert OID = 5330 (	3580	interval_minmax_ops	PGNSP PGUID ));
+
+#ifdef ADB
+DATA(insert OID = 5413 (	403		jsonb_ops		PGNSP PGUID ));
+DATA(insert OID = 5414 (	405		jsonb_ops		PGNSP PGUID ));
+DATA(insert OID = 5415 (	2742	jsonb_ops		PGNSP PGUID ));
+#endif /* ADB */
+
 #endif   /* PG_OPFAMILY_H */
@@ -622,6 +622,8 @@ DATA(insert OID = 3135 ( btnamesortsupport PGNSP PGUID 12 1 0 0 0 f f f f t f i
 DESCR("sort support");
 DATA(insert OID = 360 (  bttextcmp		   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 23 "25 25" _null_ _null_ _null_ _null_ bttextcmp _null_ _null_ _null_ ));
 DESCR("less-equal-greater");
+DATA(insert OID = 5246 ( bttextsortsupport PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 2278 "2281" _null_ _null_ _null_ _null_ bttextsortsupport _null_ _null_ _null_ ));
+DESCR("sort support");
 DATA(insert OID = 377 (  cash_cmp		   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 23 "790 790" _null_ _null_ _null_ _null_ cash_cmp _null_ _null_ _null_ ));
 DESCR("less-equal-greater");
 DATA(insert OID = 380 (  btreltimecmp	   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 23 "703 703" _null_ _null_ _null_ _null_ btreltimecmp _null_ _null_ _null_ ));
@@ -1314,6 +1316,10 @@ DATA(insert OID = 1219 (  int8inc		   PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 2
 DESCR("increment");
 DATA(insert OID = 2804 (  int8inc_any	   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 20 "20 2276" _null_ _null_ _null_ _null_ int8inc_any _null_ _null_ _null_ ));
 DESCR("increment, ignores second argument");
+DATA(insert OID = 5247 (  int8dec		   PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 20 "20" _null_ _null_ _null_ _null_ int8dec _null_ _null_ _null_ ));
+DESCR("decrement");
+DATA(insert OID = 5248 (  int8dec_any	   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 20 "20 2276" _null_ _null_ _null_ _null_ int8dec_any _null_ _null_ _null_ ));
+DESCR("decrement, ignores second argument");
 DATA(insert OID = 1230 (  int8abs		   PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 20 "20" _null_ _null_ _null_ _null_ int8abs _null_ _null_ _null_ ));
 
 DATA(insert OID = 1236 (  int8larger	   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 20 "20 20" _null_ _null_ _null_ _null_ int8larger _null_ _null_ _null_ ));
@@ -2444,6 +2450,10 @@ DATA(insert OID = 1962 (  int2_avg_accum   PGNSP PGUID 12 1 0 0 0 f f f f t f i
 DESCR("aggregate transition function");
 DATA(insert OID = 1963 (  int4_avg_accum   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 1016 "1016 23" _null_ _null_ _null_ _null_ int4_avg_accum _null_ _null_ _null_ ));
 DESCR("aggregate transition function");
+DATA(insert OID = 5249 (  int2_avg_accum_inv   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 1016 "1016 21" _null_ _null_ _null_ _null_ int2_avg_accum_inv _null_ _null_ _null_ ));
+DESCR("aggregate inverse transition function");
+DATA(insert OID = 5250 (  int4_avg_accum_inv   PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 1016 "1016 23" _null_ _null_ _null_ _null_ int4_avg_accum_inv _null_ _null_ _null_ ));
+DESCR("aggregate inverse transition function");
 DATA(insert OID = 1964 (  int8_avg		   PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 1700 "1016" _null_ _null_ _null_ _null_ int8_avg _null_ _null_ _null_ ));
 DESCR("aggregate final function");
 DATA(insert OID = 2805 (  int8inc_float8_float8		PGNSP PGUID 12 1 0 0 0 f f f f t f i 3 0 20 "20 701 701" _null_ _null_ _null_ _null_ int8inc_float8_float8 _null_ _null_ _null_ ));
@@ -2632,6 +2642,10 @@ DATA(insert OID = 1933 (  pg_stat_get_tuples_deleted	PGNSP PGUID 12 1 0 0 0 f f
 DESCR("statistics: number of tuples deleted");
 DATA(insert OID = 1972 (  pg_stat_get_tuples_hot_updated PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_tuples_hot_updated _null_ _null_ _null_ ));
 DESCR("statistics: number of tuples hot updated");
+DATA(insert OID = 5346 (  pg_stat_get_tuples_newpage_updated PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_tuples_newpage_updated _null_ _null_ _null_ ));
+DESCR("statistics: number of tuples updated onto a new page");
+DATA(insert OID = 5347 (  pg_stat_get_pages_pruned PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_pages_pruned _null_ _null_ _null_ ));
+DESCR("statistics: number of heap pages pruned opportunistically");
 DATA(insert OID = 2878 (  pg_stat_get_live_tuples	PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_live_tuples _null_ _null_ _null_ ));
 DESCR("statistics: number of live tuples");
 DATA(insert OID = 2879 (  pg_stat_get_dead_tuples	PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_dead_tuples _null_ _null_ _null_ ));
@@ -2658,7 +2672,11 @@ DATA(insert OID = 3057 ( pg_stat_get_autoanalyze_count PGNSP PGUID 12 1 0 0 0 f
 DESCR("statistics: number of auto analyzes for a table");
 DATA(insert OID = 1936 (  pg_stat_get_backend_idset		PGNSP PGUID 12 1 100 0 0 f f f f t t s 0 0 23 "" _null_ _null_ _null_ _null_ pg_stat_get_backend_idset _null_ _null_ _null_ ));
 DESCR("statistics: currently active backend IDs");
+#ifdef ADB
+DATA(insert OID = 2022 (  pg_stat_get_activity			PGNSP PGUID 12 1 100 0 0 f f f f f t s 1 0 2249 "23" "{23,26,23,26,25,25,25,16,1184,1184,1184,1184,869,25,23,20,20,20,20,20}" "{i,o,o,o,o,o,o,o,o,o,o,o,o,o,o,o,o,o,o,o}" "{pid,datid,pid,usesysid,application_name,state,query,waiting,xact_start,query_start,backend_start,state_change,client_addr,client_hostname,client_port,remote_bytes_sent,remote_bytes_received,remote_messages_sent,remote_messages_received,remote_round_trips}" _null_ pg_stat_get_activity _null_ _null_ _null_ ));
+#else
 DATA(insert OID = 2022 (  pg_stat_get_activity			PGNSP PGUID 12 1 100 0 0 f f f f f t s 1 0 2249 "23" "{23,26,23,26,25,25,25,16,1184,1184,1184,1184,869,25,23}" "{i,o,o,o,o,o,o,o,o,o,o,o,o,o,o}" "{pid,datid,pid,usesysid,application_name,state,query,waiting,xact_start,query_start,backend_start,state_change,client_addr,client_hostname,client_port}" _null_ pg_stat_get_activity _null_ _null_ _null_ ));
+#endif
 DESCR("statistics: information about currently active backends");
 DATA(insert OID = 3099 (  pg_stat_get_wal_senders	PGNSP PGUID 12 1 10 0 0 f f f f f t s 0 0 2249 "" "{23,25,25,25,25,25,23,25}" "{o,o,o,o,o,o,o,o}" "{pid,state,sent_location,write_location,flush_location,replay_location,sync_priority,sync_state}" _null_ pg_stat_get_wal_senders _null_ _null_ _null_ ));
 DESCR("statistics: information about currently active replication");
@@ -2772,6 +2790,8 @@ DATA(insert OID = 3042 (  pg_stat_get_xact_tuples_deleted		PGNSP PGUID 12 1 0 0
 DESCR("statistics: number of tuples deleted in current transaction");
 DATA(insert OID = 3043 (  pg_stat_get_xact_tuples_hot_updated	PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_xact_tuples_hot_updated _null_ _null_ _null_ ));
 DESCR("statistics: number of tuples hot updated in current transaction");
+DATA(insert OID = 5348 (  pg_stat_get_xact_tuples_newpage_updated	PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_xact_tuples_newpage_updated _null_ _null_ _null_ ));
+DESCR("statistics: number of tuples updated onto a new page in current transaction");
 DATA(insert OID = 3044 (  pg_stat_get_xact_blocks_fetched		PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_xact_blocks_fetched _null_ _null_ _null_ ));
 DESCR("statistics: number of blocks fetched in current transaction");
 DATA(insert OID = 3045 (  pg_stat_get_xact_blocks_hit			PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 20 "26" _null_ _null_ _null_ _null_ pg_stat_get_xact_blocks_hit _null_ _null_ _null_ ));
@@ -3479,6 +3499,8 @@ DESCR("current user privilege on role by role oid");
 
 DATA(insert OID = 1269 (  pg_column_size		PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 23 "2276" _null_ _null_ _null_ _null_	pg_column_size _null_ _null_ _null_ ));
 DESCR("bytes required to store the value, perhaps with compression");
+DATA(insert OID = 5345 (  pg_column_compression	PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 25 "2276" _null_ _null_ _null_ _null_	pg_column_compression _null_ _null_ _null_ ));
+DESCR("compression method of the value, if it is compressed");
 DATA(insert OID = 2322 ( pg_tablespace_size		PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 20 "26" _null_ _null_ _null_ _null_ pg_tablespace_size_oid _null_ _null_ _null_ ));
 DESCR("total disk space usage for the specified tablespace");
 DATA(insert OID = 2323 ( pg_tablespace_size		PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 20 "19" _null_ _null_ _null_ _null_ pg_tablespace_size_name _null_ _null_ _null_ ));
@@ -4016,6 +4038,36 @@ DESCR("gin(internal)");
 DATA(insert OID = 2788 (  ginoptions	   PGNSP PGUID 12 1 0 0 0 f f f f t f s 2 0 17 "1009 16" _null_ _null_ _null_ _null_  ginoptions _null_ _null_ _null_ ));
 DESCR("gin(internal)");
 
+/* BRIN */
+DATA(insert OID = 5331 (  brininsert	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 6 0 16 "2281 2281 2281 2281 2281 2281" _null_ _null_ _null_ _null_ brininsert _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5332 (  brinbeginscan	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 3 0 2281 "2281 2281 2281" _null_ _null_ _null_ _null_ brinbeginscan _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5333 (  bringetbitmap	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 2 0 20 "2281 2281" _null_ _null_ _null_ _null_ bringetbitmap _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5334 (  brinrescan	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 5 0 2278 "2281 2281 2281 2281 2281" _null_ _null_ _null_ _null_ brinrescan _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5335 (  brinendscan	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 2278 "2281" _null_ _null_ _null_ _null_ brinendscan _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5336 (  brinmarkpos	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 2278 "2281" _null_ _null_ _null_ _null_ brinmarkpos _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5337 (  brinrestrpos	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 2278 "2281" _null_ _null_ _null_ _null_ brinrestrpos _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5338 (  brinbuild	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 3 0 2281 "2281 2281 2281" _null_ _null_ _null_ _null_ brinbuild _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5339 (  brinbuildempty	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 2278 "2281" _null_ _null_ _null_ _null_ brinbuildempty _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5340 (  brinbulkdelete	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 4 0 2281 "2281 2281 2281 2281" _null_ _null_ _null_ _null_ brinbulkdelete _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5341 (  brinvacuumcleanup	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 2 0 2281 "2281 2281" _null_ _null_ _null_ _null_ brinvacuumcleanup _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5342 (  brincostestimate	   PGNSP PGUID 12 1 0 0 0 f f f f t f v 7 0 2278 "2281 2281 2281 2281 2281 2281 2281" _null_ _null_ _null_ _null_ brincostestimate _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5343 (  brinoptions	   PGNSP PGUID 12 1 0 0 0 f f f f t f s 2 0 17 "1009 16" _null_ _null_ _null_ _null_ brinoptions _null_ _null_ _null_ ));
+DESCR("brin(internal)");
+DATA(insert OID = 5344 (  brin_summarize_new_values PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 23 "2205" _null_ _null_ _null_ _null_ brin_summarize_new_values _null_ _null_ _null_ ));
+DESCR("brin: standalone scan new table pages");
+
 /* GIN array support */
 DATA(insert OID = 2743 (  ginarrayextract	 PGNSP PGUID 12 1 0 0 0 f f f f t f i 3 0 2281 "2277 2281 2281" _null_ _null_ _null_ _null_ ginarrayextract _null_ _null_ _null_ ));
 DESCR("GIN array support");
@@ -4783,6 +4835,12 @@ DESCR("lock the cluster for taking backup");
 #if defined(ADB) || defined(AGTM)
 DATA(insert OID = 3184 (  pg_xact_status	PGNSP PGUID 12 1 1 0 0 f f f f t t s 1 0 2275 "20" _null_ _null_ _null_ _null_ pg_xact_status _null_ _null_ _null_ ));
 DESCR("transaction status of specifical xid");
+DATA(insert OID = 5360 (  pg_agtm_stat_messages	PGNSP PGUID 12 1 20 0 0 f f f f t t v 0 0 2249 "" "{25,20,20,20,701,701,1016}" "{o,o,o,o,o,o,o}" "{message_type,calls,request_bytes,response_bytes,total_time,max_time,histogram}" _null_ pg_agtm_stat_messages _null_ _null_ _null_ ));
+DESCR("statistics: AGTM requests by message type");
+DATA(insert OID = 5361 (  pg_agtm_stat_snapshots	PGNSP PGUID 12 1 0 0 0 f f f f t f v 0 0 2249 "" "{20,701,20,701,20}" "{o,o,o,o,o}" "{snapshots,avg_xcnt,max_xcnt,avg_subxcnt,max_subxcnt}" _null_ pg_agtm_stat_snapshots _null_ _null_ _null_ ));
+DESCR("statistics: sizes of AGTM snapshots");
+DATA(insert OID = 5362 (  pg_agtm_stat_reset		PGNSP PGUID 12 1 0 0 0 f f f f f f v 0 0 2278 "" _null_ _null_ _null_ _null_ pg_agtm_stat_reset _null_ _null_ _null_ ));
+DESCR("statistics: reset AGTM request statistics");
 #endif
 #ifdef ADB
 DATA(insert OID = 3181 (  rxact_get_running	PGNSP PGUID 12 5 20 0 0 f f f f t t v 0 0 2249 "" "{25,26,18,16,1028,1000}" "{o,o,o,o,o,o}" "{gid,dbid,type,backend,nodes,status}" _null_ rxact_get_running _null_ _null_ _null_ ));
@@ -5106,6 +5164,141 @@ DESCR("synchronize the next XID with AGTM");
 DATA(insert OID = 5305 ( pg_explain_infomask	PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 25 "23" _null_ _null_ _null_ _null_ pg_explain_infomask _null_ _null_ _null_ ));
 DESCR("explain infomask of each heap tuple");
 
+DATA(insert OID = 5306 ( pg_agtm_xid_status_cache_stats	PGNSP PGUID 12 1 0 0 0 f f f f t f v 0 0 2249 "" "{23,20,20,20}" "{o,o,o,o}" "{slots,hits,misses,stores}" _null_ pg_agtm_xid_status_cache_stats _null_ _null_ _null_ ));
+DESCR("statistics: AGTM transaction status cache");
+
+DATA(insert OID = 5307 ( pgxc_bucket_of	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 23 "2283 23" _null_ _null_ _null_ _null_ pgxc_bucket_of _null_ _null_ _null_ ));
+DESCR("virtual bucket of a distribution column value");
+DATA(insert OID = 5308 ( pgxc_redistribute_buckets	PGNSP PGUID 12 1 0 0 0 f f f f t f v 2 0 23 "2205 23" _null_ _null_ _null_ _null_ pgxc_redistribute_buckets _null_ _null_ _null_ ));
+DESCR("move some buckets of a bucket table towards a balanced map");
+DATA(insert OID = 5309 ( pgxc_redist_pull_buckets	PGNSP PGUID 12 1 0 0 0 f f f f t f v 8 0 20 "2205 25 23 1007 1009 25 1009 1007" _null_ _null_ _null_ _null_ pgxc_redist_pull_buckets _null_ _null_ _null_ ));
+DESCR("fetch moved buckets from other Datanodes");
+DATA(insert OID = 5310 ( pgxc_node_index_of	PGNSP PGUID 12 1 0 0 0 f f f f t f i 3 0 23 "2283 18 23" _null_ _null_ _null_ _null_ pgxc_node_index_of _null_ _null_ _null_ ));
+DESCR("node index of a distribution column value");
+DATA(insert OID = 5311 ( pgxc_motion_fetch	PGNSP PGUID 12 1 1000 0 0 f f f f t t v 6 0 2249 "25 23 18 1009 1009 1007" _null_ _null_ _null_ _null_ pgxc_motion_fetch _null_ _null_ _null_ ));
+DESCR("fetch rows sent by other Datanodes for a join");
+DATA(insert OID = 5312 ( pgxc_distribution_values	PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 25 "26" _null_ _null_ _null_ _null_ pgxc_distribution_values _null_ _null_ _null_ ));
+DESCR("bounds or values of a range or list distribution");
+DATA(insert OID = 5349 ( pg_backend_cache_usage	PGNSP PGUID 12 1 2 0 0 f f f f t t v 0 0 2249 "" "{25,20,20,20,20,20,20}" "{o,o,o,o,o,o,o}" "{cache,entries,size,size_limit,hits,misses,evictions}" _null_ pg_backend_cache_usage _null_ _null_ _null_ ));
+DESCR("statistics: catalog and relation caches of the current backend");
+DATA(insert OID = 5350 ( pg_backend_memory_contexts	PGNSP PGUID 12 1 16 0 0 f f f f t t v 1 0 2249 "23" "{23,25,25,23,20,20}" "{i,o,o,o,o,o}" "{pid,name,parent,level,bytes,total_bytes}" _null_ pg_backend_memory_contexts _null_ _null_ _null_ ));
+DESCR("statistics: heaviest memory contexts of a backend");
+DATA(insert OID = 5351 (  ora_add_months_tz     ORANSP PGUID 12 1 0 0 0 f f f f t f s 2 0 1114 "1184 23" _null_ _null_ _null_ _null_	ora_add_months_tz _null_ _null_ _null_ ));
+DATA(insert OID = 5352 (  ora_last_day_tz       ORANSP PGUID 12 1 0 0 0 f f f f t f s 1 0 1184 "1184" _null_ _null_ _null_ _null_	ora_last_day_tz _null_ _null_ _null_ ));
+DATA(insert OID = 5353 (  ora_months_between_tz ORANSP PGUID 12 1 0 0 0 f f f f t f s 2 0 1700 "1184 1184" _null_ _null_ _null_ _null_	ora_months_between_tz _null_ _null_ _null_ ));
+DATA(insert OID = 5354 (  ora_next_day_tz       ORANSP PGUID 12 1 0 0 0 f f f f t f s 2 0 1184 "1184 25" _null_ _null_ _null_ _null_	ora_next_day_tz _null_ _null_ _null_ ));
+DATA(insert OID = 5355 (  ora_nanvl             ORANSP PGUID 12 1 0 0 0 f f f f t f i 2 0 701 "701 701" _null_ _null_ _null_ _null_	ora_nanvl _null_ _null_ _null_ ));
+DATA(insert OID = 5356 ( pg_xlog_compression_stats	PGNSP PGUID 12 1 0 0 0 f f f f t f v 0 0 2249 "" "{20,20,20,20}" "{o,o,o,o}" "{full_page_images,compressed_images,image_bytes,stored_bytes}" _null_ pg_xlog_compression_stats _null_ _null_ _null_ ));
+DESCR("statistics: full-page images inserted in WAL and their compression");
+DATA(insert OID = 5357 (  pg_stat_get_wait_event_type	PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 25 "23" _null_ _null_ _null_ _null_ pg_stat_get_wait_event_type _null_ _null_ _null_ ));
+DESCR("statistics: wait event type of a backend");
+DATA(insert OID = 5358 (  pg_stat_get_wait_event		PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 25 "23" _null_ _null_ _null_ _null_ pg_stat_get_wait_event _null_ _null_ _null_ ));
+DESCR("statistics: wait event of a backend");
+DATA(insert OID = 5359 (  pg_stat_get_wait_events	PGNSP PGUID 12 1 100 0 0 f f f f t t v 0 0 2249 "" "{25,25,20,701}" "{o,o,o,o}" "{wait_event_type,wait_event,calls,total_time}" _null_ pg_stat_get_wait_events _null_ _null_ _null_ ));
+DESCR("statistics: cumulative calls and time of wait events");
+DATA(insert OID = 5363 ( pg_agtm_server_stat_messages	PGNSP PGUID 12 1 20 0 0 f f f f t t v 0 0 2249 "" "{25,20,20,20,701,701,1016}" "{o,o,o,o,o,o,o}" "{message_type,calls,request_bytes,response_bytes,total_time,max_time,histogram}" _null_ pg_agtm_server_stat_messages _null_ _null_ _null_ ));
+DESCR("statistics: requests served by AGTM by message type");
+DATA(insert OID = 5364 ( pg_agtm_server_stat_snapshots	PGNSP PGUID 12 1 1 0 0 f f f f t t v 0 0 2249 "" "{20,701,20,701,20}" "{o,o,o,o,o}" "{snapshots,avg_xcnt,max_xcnt,avg_subxcnt,max_subxcnt}" _null_ pg_agtm_server_stat_snapshots _null_ _null_ _null_ ));
+DESCR("statistics: sizes of the snapshots served by AGTM");
+DATA(insert OID = 5365 ( pg_pool_stats	PGNSP PGUID 12 1 100 0 0 f f f f t t v 0 0 2249 "" "{25,25,26,19,23,23,23,23,20,20,701,1016,20,701,701,1016,20}" "{o,o,o,o,o,o,o,o,o,o,o,o,o,o,o,o,o}" "{database,user_name,node_oid,node_name,idle,released,busy,active,connects,connect_failures,connect_time,connect_histogram,acquires,acquire_time,acquire_max_time,acquire_histogram,idle_closes}" _null_ pg_pool_stats _null_ _null_ _null_ ));
+DESCR("statistics: connection pools of the pool manager");
+DATA(insert OID = 5366 ( pg_stat_get_remote_connections	PGNSP PGUID 12 1 10 0 0 f f f f t t v 0 0 2249 "" "{19,18,20,20,20,20,20}" "{o,o,o,o,o,o,o}" "{node_name,node_type,bytes_sent,bytes_received,messages_sent,messages_received,round_trips}" _null_ pg_stat_get_remote_connections _null_ _null_ _null_ ));
+DESCR("statistics: traffic of the connections of the session to other nodes");
+DATA(insert OID = 5367 ( latency_percentile	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 701 "1016 701" _null_ _null_ _null_ _null_ latency_percentile _null_ _null_ _null_ ));
+DESCR("duration in milliseconds below which a fraction of the durations of a latency histogram fall");
+DATA(insert OID = 5368 ( latency_histogram_add	PGNSP PGUID 12 1 0 0 0 f f f f f f i 2 0 1016 "1016 1016" _null_ _null_ _null_ _null_ latency_histogram_add _null_ _null_ _null_ ));
+DESCR("sum of two latency histograms");
+DATA(insert OID = 5369 ( latency_histogram_merge	PGNSP PGUID 12 1 0 0 0 t f f f f f i 1 0 1016 "1016" _null_ _null_ _null_ _null_ aggregate_dummy _null_ _null_ _null_ ));
+DESCR("sum of latency histograms");
+DATA(insert OID = 5370 ( pg_stat_get_db_latency_histogram	PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 1016 "26" _null_ _null_ _null_ _null_ pg_stat_get_db_latency_histogram _null_ _null_ _null_ ));
+DESCR("statistics: latency histogram of the statements of a database");
+DATA(insert OID = 5371 ( pg_export_global_snapshot	PGNSP PGUID 12 1 0 0 0 f f f f t f v 0 0 25 "" _null_ _null_ _null_ _null_ pg_export_global_snapshot _null_ _null_ _null_ ));
+DESCR("export the global snapshot for import on the other nodes");
+
+/* jsonb */
+DATA(insert OID = 5372 (  jsonb_in			PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 3802 "2275" _null_ _null_ _null_ _null_ jsonb_in _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 5373 (  jsonb_out			PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 2275 "3802" _null_ _null_ _null_ _null_ jsonb_out _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 5374 (  jsonb_recv		PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 3802 "2281" _null_ _null_ _null_ _null_ jsonb_recv _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 5375 (  jsonb_send		PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 17 "3802" _null_ _null_ _null_ _null_ jsonb_send _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 5376 (  jsonb_object_field			PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 3802 "3802 25" _null_ _null_ "{from_json, field_name}" _null_ jsonb_object_field _null_ _null_ _null_ ));
+DESCR("get jsonb object field");
+DATA(insert OID = 5377 (  jsonb_object_field_text	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 25 "3802 25" _null_ _null_ "{from_json, field_name}" _null_ jsonb_object_field_text _null_ _null_ _null_ ));
+DESCR("get jsonb object field as text");
+DATA(insert OID = 5378 (  jsonb_array_element		PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 3802 "3802 23" _null_ _null_ "{from_json, element_index}" _null_ jsonb_array_element _null_ _null_ _null_ ));
+DESCR("get jsonb array element");
+DATA(insert OID = 5379 (  jsonb_array_element_text	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 25 "3802 23" _null_ _null_ "{from_json, element_index}" _null_ jsonb_array_element_text _null_ _null_ _null_ ));
+DESCR("get jsonb array element as text");
+DATA(insert OID = 5380 (  jsonb_exists		PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 16 "3802 25" _null_ _null_ _null_ _null_ jsonb_exists _null_ _null_ _null_ ));
+DATA(insert OID = 5381 (  jsonb_exists_any	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 16 "3802 1009" _null_ _null_ _null_ _null_ jsonb_exists_any _null_ _null_ _null_ ));
+DATA(insert OID = 5382 (  jsonb_exists_all	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 16 "3802 1009" _null_ _null_ _null_ _null_ jsonb_exists_all _null_ _null_ _null_ ));
+DATA(insert OID = 5383 (  jsonb_contains	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 16 "3802 3802" _null_ _null_ _null_ _null_ jsonb_contains _null_ _null_ _null_ ));
+DATA(insert OID = 5384 (  jsonb_contained	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 16 "3802 3802" _null_ _null_ _null_ _null_ jsonb_contained _null_ _null_ _null_ ));
+DATA(insert OID = 5385 (  jsonb_eq			PGNSP PGUID 12 1 0 0 0 f f f t t f i 2 0 16 "3802 3802" _null_ _null_ _null_ _null_ jsonb_eq _null_ _null_ _null_ ));
+DATA(insert OID = 5386 (  jsonb_ne			PGNSP PGUID 12 1 0 0 0 f f f t t f i 2 0 16 "3802 3802" _null_ _null_ _null_ _null_ jsonb_ne _null_ _null_ _null_ ));
+DATA(insert OID = 5387 (  jsonb_lt			PGNSP PGUID 12 1 0 0 0 f f f t t f i 2 0 16 "3802 3802" _null_ _null_ _null_ _null_ jsonb_lt _null_ _null_ _null_ ));
+DATA(insert OID = 5388 (  jsonb_gt			PGNSP PGUID 12 1 0 0 0 f f f t t f i 2 0 16 "3802 3802" _null_ _null_ _null_ _null_ jsonb_gt _null_ _null_ _null_ ));
+DATA(insert OID = 5389 (  jsonb_le			PGNSP PGUID 12 1 0 0 0 f f f t t f i 2 0 16 "3802 3802" _null_ _null_ _null_ _null_ jsonb_le _null_ _null_ _null_ ));
+DATA(insert OID = 5390 (  jsonb_ge			PGNSP PGUID 12 1 0 0 0 f f f t t f i 2 0 16 "3802 3802" _null_ _null_ _null_ _null_ jsonb_ge _null_ _null_ _null_ ));
+DATA(insert OID = 5391 (  jsonb_cmp			PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 23 "3802 3802" _null_ _null_ _null_ _null_ jsonb_cmp _null_ _null_ _null_ ));
+DESCR("less-equal-greater");
+DATA(insert OID = 5392 (  jsonb_hash		PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 23 "3802" _null_ _null_ _null_ _null_ jsonb_hash _null_ _null_ _null_ ));
+DESCR("hash");
+DATA(insert OID = 5393 (  gin_compare_jsonb	PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 23 "25 25" _null_ _null_ _null_ _null_ gin_compare_jsonb _null_ _null_ _null_ ));
+DESCR("GIN support");
+DATA(insert OID = 5394 (  gin_extract_jsonb	PGNSP PGUID 12 1 0 0 0 f f f f t f i 3 0 2281 "3802 2281 2281" _null_ _null_ _null_ _null_ gin_extract_jsonb _null_ _null_ _null_ ));
+DESCR("GIN support");
+DATA(insert OID = 5395 (  gin_extract_jsonb_query	PGNSP PGUID 12 1 0 0 0 f f f f t f i 7 0 2281 "2277 2281 21 2281 2281 2281 2281" _null_ _null_ _null_ _null_ gin_extract_jsonb_query _null_ _null_ _null_ ));
+DESCR("GIN support");
+DATA(insert OID = 5396 (  gin_consistent_jsonb	PGNSP PGUID 12 1 0 0 0 f f f f t f i 8 0 16 "2281 21 2277 23 2281 2281 2281 2281" _null_ _null_ _null_ _null_ gin_consistent_jsonb _null_ _null_ _null_ ));
+DESCR("GIN support");
+DATA(insert OID = 5397 (  jsonb_typeof		PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 25 "3802" _null_ _null_ _null_ _null_ jsonb_typeof _null_ _null_ _null_ ));
+DESCR("get the type of a jsonb value");
+
+/* approximate distinct counting */
+DATA(insert OID = 5416 (  hll_in			PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 5426 "2275" _null_ _null_ _null_ _null_ hll_in _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 5417 (  hll_out			PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 2275 "5426" _null_ _null_ _null_ _null_ hll_out _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 5418 (  hll_recv			PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 5426 "2281" _null_ _null_ _null_ _null_ hll_recv _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 5419 (  hll_send			PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 17 "5426" _null_ _null_ _null_ _null_ hll_send _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 5420 (  hll_add_trans		PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 5426 "5426 2283" _null_ _null_ _null_ _null_ hll_add_trans _null_ _null_ _null_ ));
+DESCR("add a value to an hll sketch");
+DATA(insert OID = 5421 (  hll_union			PGNSP PGUID 12 1 0 0 0 f f f f t f i 2 0 5426 "5426 5426" _null_ _null_ _null_ _null_ hll_union _null_ _null_ _null_ ));
+DESCR("union of two hll sketches");
+DATA(insert OID = 5422 (  hll_cardinality	PGNSP PGUID 12 1 0 0 0 f f f f t f i 1 0 20 "5426" _null_ _null_ _null_ _null_ hll_cardinality _null_ _null_ _null_ ));
+DESCR("estimated count of distinct values of an hll sketch");
+DATA(insert OID = 5423 (  approx_count_distinct	PGNSP PGUID 12 1 0 0 0 t f f f f f i 1 0 20 "2283" _null_ _null_ _null_ _null_ aggregate_dummy _null_ _null_ _null_ ));
+DESCR("approximate count of distinct input values");
+DATA(insert OID = 5424 (  hll_add_agg		PGNSP PGUID 12 1 0 0 0 t f f f f f i 1 0 5426 "2283" _null_ _null_ _null_ _null_ aggregate_dummy _null_ _null_ _null_ ));
+DESCR("hll sketch of the input values");
+DATA(insert OID = 5425 (  hll_union_agg		PGNSP PGUID 12 1 0 0 0 t f f f f f i 1 0 5426 "5426" _null_ _null_ _null_ _null_ aggregate_dummy _null_ _null_ _null_ ));
+DESCR("union of hll sketches");
+DATA(insert OID = 5428 (  pg_lock_wait_edges	PGNSP PGUID 12 1 100 0 0 f f f f t t v 0 0 2249 "" "{23,28,28}" "{o,o,o}" "{waiting_pid,waiting_xid,blocking_xid}" _null_ pg_lock_wait_edges _null_ _null_ _null_ ));
+DESCR("transactions waiting for a lock and the transactions they wait for");
+DATA(insert OID = 5429 (  pgxc_cancel_deadlock_victim	PGNSP PGUID 12 1 0 0 0 f f f f t f v 3 0 16 "23 28 28" _null_ _null_ _null_ _null_ pgxc_cancel_deadlock_victim _null_ _null_ _null_ ));
+DESCR("cancel the statement of a backend chosen as victim of a deadlock across nodes");
+
+/* incremental refresh of materialized views */
+DATA(insert OID = 5430 (  pgxc_matview_enable_incremental	PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 2278 "2205" _null_ _null_ _null_ _null_ pgxc_matview_enable_incremental _null_ _null_ _null_ ));
+DESCR("capture the changes of the table of a materialized view for incremental refresh");
+DATA(insert OID = 5431 (  pgxc_matview_disable_incremental	PGNSP PGUID 12 1 0 0 0 f f f f t f v 1 0 2278 "2205" _null_ _null_ _null_ _null_ pgxc_matview_disable_incremental _null_ _null_ _null_ ));
+DESCR("stop capturing the changes of the table of a materialized view");
+/* immutable so that its triggers fire on the Datanodes */
+DATA(insert OID = 5432 (  pgxc_matview_delta_capture	PGNSP PGUID 12 1 0 0 0 f f f f f f i 0 0 2279 "" _null_ _null_ _null_ _null_ pgxc_matview_delta_capture _null_ _null_ _null_ ));
+DESCR("trigger capturing the changes of a table into the delta table of a materialized view");
+
+/* online verification of data page checksums */
+DATA(insert OID = 5433 (  pg_relation_verify_checksums	PGNSP PGUID 12 1 0 0 0 f f f f t f v 2 0 20 "2205 25" _null_ _null_ _null_ _null_ pg_relation_verify_checksums _null_ _null_ _null_ ));
+DESCR("verify the checksums of the pages of the specified fork of a relation on disk");
+DATA(insert OID = 5434 (  pg_relation_verify_checksums	PGNSP PGUID 14 1 0 0 0 f f f f t f v 1 0 20 "2205" _null_ _null_ _null_ _null_ "select pg_catalog.pg_relation_verify_checksums($1, ''main'')" _null_ _null_ _null_ ));
+DESCR("verify the checksums of the pages of the main fork of a relation on disk");
+
 #endif
 
 #ifdef ADBMGRD
@@ -5358,6 +5551,9 @@ DESCR("monitor hba");
 DATA(insert OID = 4971 ( monitor_delete_data_interval_days  PGNSP PGUID 12 1 0 0 0 f f f f t f s 1 0 16 "23" _null_ _null_ _null_ _null_ monitor_delete_data_interval_days _null_ _null_ _null_ ));
 DESCR("clean monitor data");
 
+DATA(insert OID = 5245 ( monitor_rollup_host_data  PGNSP PGUID 12 1 0 0 0 f f f f t f v 0 0 16 "" _null_ _null_ _null_ _null_ monitor_rollup_host_data _null_ _null_ _null_ ));
+DESCR("roll up monitor host data");
+
 DATA(insert OID = 4972 ( mgr_set_init_cluster  PGNSP PGUID 12 1 0 0 0 f f f f t f v 0 0 16 "" _null_ _null_ _null_ _null_ mgr_set_init_cluster _null_ _null_ _null_ ));
 DESCR("set init cluster");
 
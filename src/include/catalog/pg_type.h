@@ -370,6 +370,20 @@ DESCR("XML content");
 #define XMLOID 142
 DATA(insert OID = 143 ( _xml	   PGNSP PGUID -1 f b A f t \054 0 142 0 array_in array_out array_recv array_send - - array_typanalyze i x f 0 -1 0 0 _null_ _null_ _null_ ));
 DATA(insert OID = 199 ( _json	   PGNSP PGUID -1 f b A f t \054 0 114 0 array_in array_out array_recv array_send - - array_typanalyze i x f 0 -1 0 0 _null_ _null_ _null_ ));
+#ifdef ADB
+DATA(insert OID = 3802 ( jsonb		   PGNSP PGUID -1 f b U f t \054 0 0 3807 jsonb_in jsonb_out jsonb_recv jsonb_send - - - i x f 0 -1 0 0 _null_ _null_ _null_ ));
+DESCR("binary JSON");
+#define JSONBOID 3802
+DATA(insert OID = 3807 ( _jsonb	   PGNSP PGUID -1 f b A f t \054 0 3802 0 array_in array_out array_recv array_send - - array_typanalyze i x f 0 -1 0 0 _null_ _null_ _null_ ));
+#endif /* ADB */
+
+#ifdef ADB
+/* approximate distinct counting */
+DATA(insert OID = 5426 ( hll		   PGNSP PGUID -1 f b U f t \054 0 0 5427 hll_in hll_out hll_recv hll_send - - - i x f 0 -1 0 0 _null_ _null_ _null_ ));
+DESCR("HyperLogLog sketch of a set of values");
+#define HLLOID 5426
+DATA(insert OID = 5427 ( _hll	   PGNSP PGUID -1 f b A f t \054 0 5426 0 array_in array_out array_recv array_send - - array_typanalyze i x f 0 -1 0 0 _null_ _null_ _null_ ));
+#endif /* ADB */
 
 DATA(insert OID = 194 ( pg_node_tree	PGNSP PGUID -1 f b S f t \054 0 0 0 pg_node_tree_in pg_node_tree_out pg_node_tree_recv pg_node_tree_send - - - i x f 0 -1 0 100 _null_ _null_ _null_ ));
 DESCR("string representing an internal node tree");
@@ -30,6 +30,14 @@ CATALOG(pgxc_class,9001) BKI_WITHOUT_OIDS
 #ifdef ADB
 	Oid 		pcfuncid;		/* User-defined distribution function oid */
 	int2vector	pcfuncattnums;		/* List of column number of distribution */
+	int2vector	pcbucketmap;		/* Position in nodeoids of each bucket */
+	float4		pcnodeskew;			/* Rows of the largest node over the
+									 * average, NULL if not analyzed */
+	pg_node_tree pcdistvalues;		/* Bounds of range or values of list
+									 * distribution, one entry per node */
+	int32		pccolocation;		/* Tables of the same colocation group
+									 * put a value on the same node, 0 if
+									 * none, see PgxcClassColocation */
 #endif
 
 } FormData_pgxc_class;
@@ -37,7 +45,7 @@ CATALOG(pgxc_class,9001) BKI_WITHOUT_OIDS
 typedef FormData_pgxc_class *Form_pgxc_class;
 
 #ifdef ADB
-#define Natts_pgxc_class					8
+#define Natts_pgxc_class					12
 #else
 #define Natts_pgxc_class					6
 #endif
@@ -51,6 +59,10 @@ typedef FormData_pgxc_class *Form_pgxc_class;
 #ifdef ADB
 #define Anum_pgxc_class_pcfuncid			7
 #define Anum_pgxc_class_pcfuncattnums		8
+#define Anum_pgxc_class_pcbucketmap			9
+#define Anum_pgxc_class_pcnodeskew			10
+#define Anum_pgxc_class_pcdistvalues		11
+#define Anum_pgxc_class_pccolocation		12
 #endif
 
 typedef enum PgxcClassAlterType
@@ -71,6 +83,7 @@ extern void PgxcClassCreate(Oid pcrelid,
 							, Oid pcfuncid
 							, int numatts
 							, int16 *pcfuncattnums
+							, List *pcdistvalues
 #endif
 							);
 extern void PgxcClassAlter(Oid pcrelid,
@@ -85,6 +98,7 @@ extern void PgxcClassAlter(Oid pcrelid,
 						   , Oid pcfuncid
 						   , int numatts
 						   , int16 *pcfuncattnums
+						   , List *pcdistvalues
 #endif
 
 						   );
@@ -92,6 +106,8 @@ extern void RemovePgxcClass(Oid pcrelid);
 
 #ifdef ADB
 extern void CreatePgxcClassFuncDepend(char locatortype, Oid relid, Oid funcid);
+extern void PgxcClassAlterBucketMap(Oid pcrelid, int numbuckets, int16 *map);
+extern void PgxcClassAlterNodeSkew(Oid pcrelid, float4 skew);
 #endif
 
 #endif   /* PGXC_CLASS_H */
@@ -61,11 +61,18 @@ CATALOG(pgxc_node,9015) BKI_SHARED_RELATION
 	 * Node identifier to be used at places where a fixed length node identification is required
 	 */
 	int32		node_id;
+
+	/*
+	 * Host name or IP address and port of a hot standby slave of the
+	 * node which read-only transactions may use, empty host if none
+	 */
+	NameData	node_slave_host;
+	int32		node_slave_port;
 } FormData_pgxc_node;
 
 typedef FormData_pgxc_node *Form_pgxc_node;
 
-#define Natts_pgxc_node				7
+#define Natts_pgxc_node				9
 
 #define Anum_pgxc_node_name			1
 #define Anum_pgxc_node_type			2
@@ -74,6 +81,8 @@ typedef FormData_pgxc_node *Form_pgxc_node;
 #define Anum_pgxc_node_is_primary	5
 #define Anum_pgxc_node_is_preferred	6
 #define Anum_pgxc_node_id		7
+#define Anum_pgxc_node_slave_host	8
+#define Anum_pgxc_node_slave_port	9
 
 /* Possible types of nodes */
 #define PGXC_NODE_COORDINATOR		'C'
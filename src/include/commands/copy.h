@@ -43,6 +43,7 @@ extern int64 pgxcDoCopyTo(CopyState cstate);
 #ifdef ADB
 extern char *copy_cmd_comment_str;
 extern bool  copy_cmd_comment;
+extern bool  copy_check_all_columns;
 #endif
 
 #endif   /* COPY_H */
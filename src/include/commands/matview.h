@@ -14,6 +14,7 @@
 #ifndef MATVIEW_H
 #define MATVIEW_H
 
+#include "fmgr.h"
 #include "nodes/params.h"
 #include "nodes/parsenodes.h"
 #include "tcop/dest.h"
@@ -31,5 +32,10 @@ extern void pgxc_send_matview_data(RangeVar *matview_rv, const char *query_strin
 extern void pgxc_fill_matview_by_copy(DestReceiver *mv_dest, bool skipdata,
 										int operation, TupleDesc tupdesc);
 #endif /* PGXC */
+#ifdef ADB
+extern Datum pgxc_matview_enable_incremental(PG_FUNCTION_ARGS);
+extern Datum pgxc_matview_disable_incremental(PG_FUNCTION_ARGS);
+extern Datum pgxc_matview_delta_capture(PG_FUNCTION_ARGS);
+#endif
 
 #endif   /* MATVIEW_H */
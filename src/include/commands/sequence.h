@@ -74,6 +74,11 @@ extern Datum lastval(PG_FUNCTION_ARGS);
 
 extern Datum pg_sequence_parameters(PG_FUNCTION_ARGS);
 
+#ifdef AGTM
+extern int64 nextval_range_oid(Oid relid, int64 range, int64 *last,
+				  int64 *increment);
+#endif
+
 #ifdef ADB
 
 typedef enum
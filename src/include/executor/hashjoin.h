@@ -102,6 +102,14 @@ typedef struct HashSkewBucket
 #define SKEW_WORK_MEM_PERCENT  2
 #define SKEW_MIN_OUTER_FRACTION  0.01
 
+/*
+ * The bloom filter of the buckets is kept only once the bucket array is too
+ * large to stay in cache, at HJ_BLOOM_BITS_PER_BUCKET bits per bucket (one
+ * byte for eight of the bucket array).
+ */
+#define HJ_BLOOM_MIN_BUCKETS  65536
+#define HJ_BLOOM_BITS_PER_BUCKET  8
+
 
 typedef struct HashJoinTableData
 {
@@ -112,6 +120,14 @@ typedef struct HashJoinTableData
 	struct HashJoinTupleData **buckets;
 	/* buckets array is per-batch storage, as are all the tuples */
 
+	/*
+	 * Bloom filter of the hash values in the buckets of the current batch,
+	 * or NULL when the bucket array is small enough to stay in cache.  It is
+	 * per-batch storage too; bloomMask is its number of bits minus 1.
+	 */
+	uint64	   *bloom;
+	uint32		bloomMask;
+
 	bool		keepNulls;		/* true to store unmatchable NULL tuples */
 
 	bool		skewEnabled;	/* are we using skew optimization? */
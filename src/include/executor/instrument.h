@@ -30,6 +30,14 @@ typedef struct BufferUsage
 	long		temp_blks_written;		/* # of temp blocks written */
 	instr_time	blk_read_time;	/* time spent reading */
 	instr_time	blk_write_time; /* time spent writing */
+#ifdef ADB
+	/* traffic with the other nodes, see PGXCNodeTraffic */
+	long		remote_bytes_sent;
+	long		remote_bytes_received;
+	long		remote_msgs_sent;	/* protocol messages */
+	long		remote_msgs_received;
+	long		remote_round_trips;
+#endif
 } BufferUsage;
 
 /* Flag bits included in InstrAlloc's instrument_options bitmask */
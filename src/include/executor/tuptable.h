@@ -126,6 +126,10 @@ typedef struct TupleTableSlot
 	int		tts_dataLen;		/* Actual length of the data row */
 	bool		tts_shouldFreeRow;	/* should pfree tts_dataRow? */
 	struct AttInMetadata *tts_attinmeta;	/* store here info to extract values from the DataRow */
+#ifdef ADB
+	uint32		tts_attinmeta_gen;	/* generation tts_attinmeta was got at,
+									 * see datarowin.c */
+#endif
 	Oid		tts_xcnodeoid;		/* Oid of node from where the datarow is fetched */
 #endif
 	TupleDesc	tts_tupleDescriptor;	/* slot's tuple descriptor */
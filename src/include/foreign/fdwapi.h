@@ -100,6 +100,11 @@ typedef bool (*AnalyzeForeignTable_function) (Relation relation,
 												 AcquireSampleRowsFunc *func,
 													BlockNumber *totalpages);
 
+typedef bool (*IsForeignScanAsyncCapable_function) (ForeignScanState *node);
+
+typedef bool (*ForeignAsyncRequest_function) (ForeignScanState *node,
+														  pgsocket *sock);
+
 /*
  * FdwRoutine is the struct returned by a foreign-data wrapper's handler
  * function.  It provides pointers to the callback functions needed by the
@@ -144,6 +149,10 @@ typedef struct FdwRoutine
 
 	/* Support functions for ANALYZE */
 	AnalyzeForeignTable_function AnalyzeForeignTable;
+
+	/* Support functions for asynchronous execution under an Append */
+	IsForeignScanAsyncCapable_function IsForeignScanAsyncCapable;
+	ForeignAsyncRequest_function ForeignAsyncRequest;
 } FdwRoutine;
 
 
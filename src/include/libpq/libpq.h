@@ -76,6 +76,9 @@ extern int	socket_flush(void);
 extern int	pq_recvbuf(void);
 extern int	pq_getmessage_noblock(StringInfo s, int maxlen);
 extern void pq_switch_to_socket(void);
+#ifdef ADB
+extern bool enable_remote_compression;
+#endif
 
 /*
  * prototypes for functions in be-secure.c
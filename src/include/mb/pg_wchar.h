@@ -515,6 +515,9 @@ extern bool pg_verify_mbstr(int encoding, const char *mbstr, int len,
 				bool noError);
 extern int pg_verify_mbstr_len(int encoding, const char *mbstr, int len,
 					bool noError);
+#ifdef ADB
+extern int	pg_ascii_prefix_len(const unsigned char *s, int len);
+#endif
 
 extern void check_encoding_conversion_args(int src_encoding,
 							   int dest_encoding,
@@ -20,6 +20,16 @@
 #define PRIV_GRANT        'G'
 #define PRIV_REVOKE       'R'
 
+/*
+* options of the pg_basebackup making a slave, the data of the backup is compressed
+* on the wire since the network is the bottleneck of copying a large node
+*/
+#ifdef HAVE_LIBZ
+#define MGR_BASEBACKUP_STREAM_COMPRESS " --stream-compress=1"
+#else
+#define MGR_BASEBACKUP_STREAM_COMPRESS ""
+#endif
+
 
 typedef struct GetAgentCmdRst
 {
@@ -28,6 +38,29 @@ typedef struct GetAgentCmdRst
 	StringInfoData description;
 }GetAgentCmdRst;
 
+/* one command of mgr_ma_send_cmd_parallel, the result of the node is in result */
+typedef struct AgentCmdParallel
+{
+	char cmdtype;
+	Oid hostoid;
+	StringInfoData cmdstr;
+	GetAgentCmdRst result;
+	ManagerAgent *ma;	/* connection to the agent while the command runs */
+}AgentCmdParallel;
+
+/* one node of pingNode_user_parallel, ret gets the return value of pingNode_user */
+typedef struct NodePingParallel
+{
+	char *host_addr;
+	int32 agent_port;
+	char *node_port;
+	char *node_user;
+	char *pid_file_path;
+	bool host_valid;	/* false when the host did not answer the ping */
+	int ret;
+	ManagerAgent *ma;	/* connection to the agent while the ping runs */
+}NodePingParallel;
+
 typedef struct AppendNodeInfo
 {
 	char *nodename;
@@ -210,6 +243,7 @@ extern List *get_fcinfo_namelist(const char *sepstr, int argidx, FunctionCallInf
 void check_dn_slave(char nodetype, List *nodenamelist, Relation rel_node, StringInfo infosendmsg);
 extern bool mgr_refresh_pgxc_node_tbl(char *cndnname, int32 cndnport, char *cndnaddress, bool isprimary, Oid cndnmasternameoid, GetAgentCmdRst *getAgentCmdRst);
 extern void mgr_send_conf_parameters(char filetype, char *datapath, StringInfo infosendmsg, Oid hostoid, GetAgentCmdRst *getAgentCmdRst);
+extern void mgr_send_conf_parameters_parallel(AgentCmdParallel *cmds, int num, StringInfo infosendmsg);
 extern void mgr_append_pgconf_paras_str_str(char *key, char *value, StringInfo infosendmsg);
 extern void mgr_append_pgconf_paras_str_int(char *key, int value, StringInfo infosendmsg);
 extern void mgr_get_gtm_host_port(StringInfo infosendmsg);
@@ -243,6 +277,7 @@ extern TupleDesc get_common_command_tuple_desc(void);
 extern HeapTuple build_common_command_tuple(const Name name, bool success, const char *message);
 extern int pingNode_user(char *host, char *port, char *user);
 extern bool is_valid_ip(char *ip);
+extern void pingNode_user_parallel(NodePingParallel *nodes, int num);
 extern bool	mgr_check_host_in_use(Oid hostoid, bool check_inited);
 extern void mgr_mark_node_in_cluster(Relation rel);
 extern TupleDesc get_showparam_command_tuple_desc(void);
@@ -277,6 +312,8 @@ extern bool mgr_check_node_recovery_finish(char nodetype, Oid hostoid, int nodep
 extern char mgr_get_master_type(char nodetype);
 Datum mgr_typenode_cmd_run_backend_result(const char nodetype, const char cmdtype, const List* nodenamelist, const char *shutdown_mode, PG_FUNCTION_ARGS);
 extern char mgr_change_cmdtype_unbackend(char cmdtype);
+extern char mgr_append_backend_cmd_str(char cmdtype, const char *nodepath, const char *shutdown_mode, StringInfo infosendmsg);
+extern void mgr_ma_send_cmd_parallel(AgentCmdParallel *cmds, int num);
 extern HeapTuple build_common_command_tuple_four_col(const Name name, char type, bool status, const char *description);
 extern bool mgr_check_param_reload_postgresqlconf(char nodetype, Oid hostoid, int nodeport, char *address, char *check_param, char *expect_result);
 
@@ -299,12 +336,13 @@ extern HeapTuple monitor_build_databasetps_qps_tuple(Relation rel, const Timesta
 extern void monitor_get_stringvalues(char cmdtype, int agentport, char *sqlstr, char *user, char *address, int nodeport, char * dbname, StringInfo resultstrdata);
 extern void monitor_delete_data(MonitorDeleteData *node, ParamListInfo params, DestReceiver *dest);
 extern Datum monitor_delete_data_interval_days(PG_FUNCTION_ARGS);
+extern Datum monitor_rollup_host_data(PG_FUNCTION_ARGS);
 extern void mgr_set_init(MGRSetClusterInit *node, ParamListInfo params, DestReceiver *dest);
 extern Datum mgr_set_init_cluster(PG_FUNCTION_ARGS);
 
 /*monitor_slowlog.c*/
 extern char *monitor_get_onestrvalue_one_node(int agentport, char *sqlstr, char *user, char *address, int port, char * dbname);
-extern void monitor_get_onedb_slowdata_insert(Relation rel, int agentport, char *user, char *address, int port, char *dbname);
+extern void monitor_get_slowdata_insert(Relation rel, Oid nodeoid, int agentport, char *user, char *address, int port);
 extern HeapTuple monitor_build_slowlog_tuple(Relation rel, TimestampTz time, char *dbname, char *username, float singletime, int totalnum, char *query, char *queryplan);
 extern Datum monitor_slowlog_insert_data(PG_FUNCTION_ARGS);
 extern HeapTuple check_record_yestoday_today(Relation rel, int *callstoday, int *callsyestd, bool *gettoday, bool *getyesdt, char *query, char *user, char *dbname, pg_time_t ptimenow);
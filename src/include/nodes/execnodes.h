@@ -635,6 +635,32 @@ typedef struct ArrayRefExprState
 	char		refelemalign;	/* typalign of the element type */
 } ArrayRefExprState;
 
+/* ----------------
+ *		FuncArgStep
+ *
+ * One argument of a FuncExprState, flattened by execQual.c: Consts and
+ * scalar Vars are read in place, anything else is evaluated through its
+ * ExprState.
+ * ----------------
+ */
+typedef enum FuncArgKind
+{
+	FUNCARG_CONST,				/* value and isnull hold the constant */
+	FUNCARG_SCAN_VAR,			/* attnum of ecxt_scantuple */
+	FUNCARG_INNER_VAR,			/* attnum of ecxt_innertuple */
+	FUNCARG_OUTER_VAR,			/* attnum of ecxt_outertuple */
+	FUNCARG_EXPR				/* evaluate argstate */
+} FuncArgKind;
+
+typedef struct FuncArgStep
+{
+	FuncArgKind kind;
+	AttrNumber	attnum;
+	bool		isnull;
+	Datum		value;
+	ExprState  *argstate;
+} FuncArgStep;
+
 /* ----------------
  *		FuncExprState node
  *
@@ -701,6 +727,13 @@ typedef struct FuncExprState
 	 * argument values between calls, when setArgsValid is true.
 	 */
 	FunctionCallInfoData fcinfo_data;
+
+	/*
+	 * The arguments as a flat array of steps, set up at the first call of a
+	 * function which returns no set and has no set argument.
+	 */
+	FuncArgStep *argsteps;
+	int			nargsteps;
 } FuncExprState;
 
 /* ----------------
@@ -1115,6 +1148,10 @@ typedef struct ModifyTableState
  *
  *		nplans			how many plans are in the array
  *		whichplan		which plan is being executed (0 .. n-1)
+ *
+ *		When some of the plans are foreign scans able to run asynchronously,
+ *		the Append returns the rows of whichever is ready first, and runs the
+ *		other plans in order while the remote servers work.
  * ----------------
  */
 typedef struct AppendState
@@ -1123,6 +1160,11 @@ typedef struct AppendState
 	PlanState **appendplans;	/* array of PlanStates for my inputs */
 	int			as_nplans;
 	int			as_whichplan;
+	int			as_nasync;		/* # of asynchronous plans, 0 if none */
+	bool	   *as_async;		/* is plan i asynchronous? */
+	bool	   *as_finished;	/* has asynchronous plan i ended? */
+	int			as_whichasync;	/* asynchronous plan served last */
+	pgsocket   *as_socks;		/* sockets waited on, room for all of them */
 } AppendState;
 
 /* ----------------
@@ -1229,6 +1271,45 @@ typedef struct ScanState
  */
 typedef ScanState SeqScanState;
 
+#ifdef ADB
+/* ----------------
+ *	 SampleScanState information
+ *
+ *		percent			expression state for the percentage
+ *		repeatable		expression state for the seed, or NULL
+ *		fraction		probability a block or a row is kept
+ *		seed			seed of the current scan
+ *		strategy		bulk read strategy for the heap blocks
+ *		nblocks			number of blocks of the relation
+ *		cblock			current block, or InvalidBlockNumber
+ *		cbuf			buffer of the current block, if any
+ *		ntuples			number of sampled tuples of the current block
+ *		cindex			index of the next tuple of the current block
+ *		offsets			offsets of the sampled tuples of the current block
+ *		tuple			current tuple
+ *		inited			are the above set up for this scan?
+ * ----------------
+ */
+typedef struct SampleScanState
+{
+	ScanState	ss;				/* its first field is NodeTag */
+	ExprState  *percent;
+	ExprState  *repeatable;
+	int			method;			/* a TableSampleMethod */
+	double		fraction;
+	uint32		seed;
+	BufferAccessStrategy strategy;
+	BlockNumber nblocks;
+	BlockNumber cblock;
+	Buffer		cbuf;
+	int			ntuples;
+	int			cindex;
+	OffsetNumber *offsets;
+	HeapTupleData tuple;
+	bool		inited;
+} SampleScanState;
+#endif /* ADB */
+
 /*
  * These structs store information about index quals that don't have simple
  * constant right-hand sides.  See comments for ExecIndexBuildScanKeys()
@@ -1680,6 +1761,10 @@ typedef struct SortState
 	bool		bounded_Done;	/* value of bounded we did the sort with */
 	int64		bound_Done;		/* value of bound we did the sort with */
 	void	   *tuplesortstate; /* private state of tuplesort.c */
+#ifdef PGXC
+	void	   *remotemergestate;	/* private state of streaming merge */
+	bool		remotemerge_Done;	/* streaming merge used already? */
+#endif /* PGXC */
 } SortState;
 
 /* ---------------------
@@ -1729,6 +1814,14 @@ typedef struct AggState
 	List	   *hash_needed;	/* list of columns needed in hash table */
 	bool		table_filled;	/* hash table filled yet? */
 	TupleHashIterator hashiter; /* for iterating through hash table */
+	long		hash_max_groups;	/* groups fitting in work_mem, 0 is no limit */
+	long		hash_ngroups;	/* groups in the hash table */
+	int			hash_spill_level;	/* times the current input was spilled */
+	struct BufFile **hash_spill_files;	/* partitions being written, or NULL */
+	struct BufFile *hash_spill_input;	/* partition being read, or NULL */
+	List	   *hash_spill_pending;		/* partitions still to aggregate */
+	TupleTableSlot *hash_spill_slot;	/* slot for the tuples read back */
+	bool		hash_spilled;	/* did any group miss the hash table? */
 #ifdef PGXC
 	bool		skip_trans;		/* skip the transition step for aggregates */
 #endif /* PGXC */
@@ -1766,6 +1859,9 @@ typedef struct WindowAggState
 												 * fetches */
 	int64		aggregatedbase; /* start row for current aggregates */
 	int64		aggregatedupto; /* rows before this one are aggregated */
+	bool		aggsinvertible; /* can rows leaving the frame be removed? */
+	int			aggheadptr;		/* read pointer for rows leaving the frame */
+	int64		aggheadpos;		/* row that aggheadptr will return next */
 
 	int			frameOptions;	/* frame_clause options, see WindowDef */
 	ExprState  *startOffset;	/* expression for starting bound offset */
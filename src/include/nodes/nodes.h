@@ -52,6 +52,9 @@ typedef enum NodeTag
 	T_BitmapOr,
 	T_Scan,
 	T_SeqScan,
+#ifdef ADB
+	T_SampleScan,
+#endif
 	T_IndexScan,
 	T_IndexOnlyScan,
 	T_BitmapIndexScan,
@@ -112,6 +115,9 @@ typedef enum NodeTag
 	T_BitmapOrState,
 	T_ScanState,
 	T_SeqScanState,
+#ifdef ADB
+	T_SampleScanState,
+#endif
 	T_IndexScanState,
 	T_IndexOnlyScanState,
 	T_BitmapIndexScanState,
@@ -277,6 +283,7 @@ typedef enum NodeTag
 	 */
 	T_MemoryContext = 600,
 	T_AllocSetContext,
+	T_BumpContext,
 
 	/*
 	 * TAGS FOR VALUE NODES (value.h)
@@ -423,12 +430,18 @@ typedef enum NodeTag
 	T_WindowDef,
 	T_RangeSubselect,
 	T_RangeFunction,
+#ifdef ADB
+	T_RangeTableSample,
+#endif
 	T_TypeName,
 	T_ColumnDef,
 	T_IndexElem,
 	T_Constraint,
 	T_DefElem,
 	T_RangeTblEntry,
+#ifdef ADB
+	T_TableSampleClause,
+#endif
 	T_SortGroupClause,
 	T_WindowClause,
 	T_PrivGrantee,
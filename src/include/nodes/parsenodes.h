@@ -529,6 +529,45 @@ typedef struct RangeFunction
 								 * of function returning RECORD */
 } RangeFunction;
 
+#ifdef ADB
+/*
+ * RangeTableSample - TABLESAMPLE appearing in a raw FROM clause
+ *
+ * This node, appearing only in raw parse trees, represents
+ *		<relation> TABLESAMPLE <method> (<percent>) REPEATABLE (<seed>)
+ */
+typedef struct RangeTableSample
+{
+	NodeTag		type;
+	RangeVar   *relation;		/* relation to be sampled */
+	char	   *method;			/* sampling method name */
+	Node	   *percent;		/* percentage of the relation to return */
+	Node	   *repeatable;		/* REPEATABLE expression, or NULL if none */
+	int			location;		/* method name location, or -1 if unknown */
+} RangeTableSample;
+
+/*
+ * TableSampleClause - TABLESAMPLE of a plain relation RTE
+ *
+ * SYSTEM keeps whole heap blocks and BERNOULLI single rows, each with the
+ * given probability.  percent is a float4 and repeatable a float8 expression,
+ * neither of which may reference the query's own variables.
+ */
+typedef enum TableSampleMethod
+{
+	TABLESAMPLE_SYSTEM,			/* sample whole blocks */
+	TABLESAMPLE_BERNOULLI		/* sample single rows */
+} TableSampleMethod;
+
+typedef struct TableSampleClause
+{
+	NodeTag		type;
+	TableSampleMethod method;	/* sampling method */
+	Node	   *percent;		/* transformed percentage expression */
+	Node	   *repeatable;		/* transformed seed expression, or NULL */
+} TableSampleClause;
+#endif /* ADB */
+
 /*
  * ColumnDef - column definition (used in various creates)
  *
@@ -780,6 +819,9 @@ typedef struct RangeTblEntry
 	 */
 	Oid			relid;			/* OID of the relation */
 	char		relkind;		/* relation kind (see pg_class.relkind) */
+#ifdef ADB
+	TableSampleClause *tablesample;	/* sampling info, or NULL */
+#endif
 
 	/*
 	 * Fields valid for a subquery RTE (else NULL):
@@ -47,6 +47,10 @@ typedef struct PlannedStmt
 
 	bool		transientPlan;	/* redo plan when TransactionXmin changes? */
 
+#ifdef ADB
+	bool		hasMotion;		/* moves rows between datanodes? */
+#endif
+
 	struct Plan *planTree;		/* tree of Plan nodes */
 
 	List	   *rtable;			/* list of RangeTblEntry nodes */
@@ -274,6 +278,18 @@ typedef struct Scan
  */
 typedef Scan SeqScan;
 
+#ifdef ADB
+/* ----------------
+ *		table sample scan node
+ * ----------------
+ */
+typedef struct SampleScan
+{
+	Scan		scan;
+	struct TableSampleClause *tablesample;	/* sampling method and arguments */
+} SampleScan;
+#endif /* ADB */
+
 /* ----------------
  *		index scan node
  *
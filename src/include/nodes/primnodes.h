@@ -1313,6 +1313,9 @@ typedef enum DistributionType
 	DISTTYPE_MODULO				/* Modulo partitioned */
 #ifdef ADB
 	,DISTTYPE_USER_DEFINED		/* User-defined function partitioned */
+	,DISTTYPE_BUCKET			/* Hash partitioned through virtual buckets */
+	,DISTTYPE_RANGE				/* Range partitioned */
+	,DISTTYPE_LIST				/* List partitioned */
 #endif
 } DistributionType;
 
@@ -1328,7 +1331,8 @@ typedef struct DistributeBy
 	char	   	*colname;		/* Distribution column name */
 #ifdef ADB
 	List		*funcname;		/* User-defined distribute function name */
-	List		*funcargs;		/* User-defined distribute function arguments */
+	List		*funcargs;		/* User-defined distribute function arguments,
+								 * or bounds or values of RANGE and LIST */
 #endif
 } DistributeBy;
 
@@ -98,6 +98,10 @@ typedef struct PlannerGlobal
 	Index		lastRowMarkId;	/* highest PlanRowMark ID assigned */
 
 	bool		transientPlan;	/* redo plan when TransactionXmin changes? */
+
+#ifdef ADB
+	bool		hasMotion;		/* moves rows between datanodes? */
+#endif
 } PlannerGlobal;
 
 /* macro for fetching the Plan associated with a SubPlan node */
@@ -1098,7 +1102,26 @@ typedef struct RemoteQueryPath
 													 * targetlist entry which is
 													 * not completely shippable.
 													 */
+#ifdef ADB
+	char					rqmotion;	/* how the rows of the right side of
+										 * the JOIN are sent to the nodes of
+										 * the left side, see below */
+	Var						*rqmotion_key;	/* right side column by which
+											 * REMOTE_MOTION_REDISTRIBUTE
+											 * sends rows */
+	bool					rqhas_motion;	/* TRUE if this path or one below
+											 * it moves rows between nodes */
+	Cost					rqdatanode_cost;	/* cost of the work done on
+												 * the datanodes, in parallel */
+#endif
 } RemoteQueryPath;
+
+#ifdef ADB
+/* Values of RemoteQueryPath.rqmotion */
+#define REMOTE_MOTION_NONE			'\0'	/* JOIN of collocated rows */
+#define REMOTE_MOTION_REDISTRIBUTE	'R'		/* each row to the node of its key */
+#define REMOTE_MOTION_BROADCAST		'B'		/* every row to every node */
+#endif
 #endif /* PGXC */
 
 /*
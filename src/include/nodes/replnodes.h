@@ -48,6 +48,7 @@ typedef struct StartReplicationCmd
 	NodeTag		type;
 	TimeLineID	timeline;
 	XLogRecPtr	startpoint;
+	bool		compress;		/* send WAL data compressed by LZ4 */
 } StartReplicationCmd;
 
 
@@ -29,6 +29,12 @@
 
 #define DEFAULT_EFFECTIVE_CACHE_SIZE  16384		/* measured in pages */
 
+#ifdef ADB
+#define DEFAULT_REMOTE_STARTUP_COST  10.0
+#define DEFAULT_REMOTE_TUPLE_COST  0.005
+#define DEFAULT_REMOTE_BYTE_COST  0.00005
+#endif
+
 typedef enum
 {
 	CONSTRAINT_EXCLUSION_OFF,	/* do not use c_e */
@@ -49,6 +55,11 @@ extern PGDLLIMPORT double cpu_tuple_cost;
 extern PGDLLIMPORT double cpu_index_tuple_cost;
 extern PGDLLIMPORT double cpu_operator_cost;
 extern PGDLLIMPORT int effective_cache_size;
+#ifdef ADB
+extern PGDLLIMPORT double remote_startup_cost;
+extern PGDLLIMPORT double remote_tuple_cost;
+extern PGDLLIMPORT double remote_byte_cost;
+#endif
 extern Cost disable_cost;
 extern bool enable_seqscan;
 extern bool enable_indexscan;
@@ -67,6 +78,9 @@ extern bool enable_remotejoin;
 extern bool enable_remotegroup;
 extern bool enable_remotesort;
 extern bool enable_remotelimit;
+#ifdef ADB
+extern bool enable_datanode_motion;
+#endif
 #endif
 extern int	constraint_exclusion;
 
@@ -75,6 +89,12 @@ extern double index_pages_fetched(double tuples_fetched, BlockNumber pages,
 					double index_pages, PlannerInfo *root);
 extern void cost_seqscan(Path *path, PlannerInfo *root, RelOptInfo *baserel,
 			 ParamPathInfo *param_info);
+#ifdef ADB
+extern double tablesample_fraction(PlannerInfo *root,
+					 TableSampleClause *tablesample);
+extern void cost_samplescan(Path *path, PlannerInfo *root,
+				RelOptInfo *baserel, ParamPathInfo *param_info);
+#endif
 extern void cost_index(IndexPath *path, PlannerInfo *root,
 		   double loop_count);
 extern void cost_bitmap_heap_scan(Path *path, PlannerInfo *root, RelOptInfo *baserel,
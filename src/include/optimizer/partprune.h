@@ -0,0 +1,21 @@
+/*-------------------------------------------------------------------------
+ *
+ * partprune.h
+ *	  Pruning of the children of inheritance-partitioned tables
+ *
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/optimizer/partprune.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef PARTPRUNE_H
+#define PARTPRUNE_H
+
+#include "nodes/relation.h"
+
+extern Bitmapset *prune_inherited_children(PlannerInfo *root,
+						 RelOptInfo *rel, Index rti, RangeTblEntry *rte);
+
+#endif   /* PARTPRUNE_H */
@@ -21,8 +21,24 @@
 #include "pgxc/locator.h"
 
 
+#ifdef ADB
+#include "utils/guc.h"
+
+extern int fqs_cache_size;
+extern char *function_distribute_by;
+
+extern bool check_function_distribute_by(char **newval, void **extra,
+										 GucSource source);
+#endif
+
 /* Determine if query is shippable */
 extern ExecNodes *pgxc_is_query_shippable(Query *query, int query_level);
+#ifdef ADB
+/* Determine if a DML is shippable once the rows it reads are moved */
+extern ExecNodes *pgxc_is_motion_dml_shippable(Query *query, List **motion_rtes);
+/* Determine if a query is the call of a function shippable to one Datanode */
+extern ExecNodes *pgxc_is_func_call_shippable(Query *query, Oid *funcid);
+#endif
 /* Determine if an expression is shippable */
 extern bool pgxc_is_expr_shippable(Expr *node, bool *has_aggs);
 /* Determine if given function is shippable */
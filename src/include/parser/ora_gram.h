@@ -0,0 +1 @@
+/root/repo/src/backend/parser/ora_gram.h
\ No newline at end of file
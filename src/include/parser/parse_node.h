@@ -63,6 +63,9 @@ typedef enum ParseExprKind
 	EXPR_KIND_ALTER_COL_TRANSFORM,		/* transform expr in ALTER COLUMN TYPE */
 	EXPR_KIND_EXECUTE_PARAMETER,	/* parameter value in EXECUTE */
 	EXPR_KIND_TRIGGER_WHEN		/* WHEN condition in CREATE TRIGGER */
+#ifdef ADB
+	,EXPR_KIND_TABLESAMPLE		/* TABLESAMPLE percentage or seed */
+#endif /* ADB */
 } ParseExprKind;
 
 
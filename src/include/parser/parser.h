@@ -62,7 +62,7 @@ extern Node *makeBoolAConst(bool state, int location);
 #ifdef ADB
 extern List *check_sequence_name(List *names, core_yyscan_t yyscanner, int location);
 extern Node *makeConnectByStmt(SelectStmt *stmt, Node *start, Node *connect_by,
-								core_yyscan_t yyscanner);
+								bool nocycle, core_yyscan_t yyscanner);
 #endif
 extern void check_qualified_name(List *names, core_yyscan_t yyscanner);
 extern List *check_func_name(List *names, core_yyscan_t yyscanner);
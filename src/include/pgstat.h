@@ -17,6 +17,9 @@
 #include "portability/instr_time.h"
 #include "utils/hsearch.h"
 #include "utils/relcache.h"
+#ifdef ADB
+#include "utils/latencyhist.h"
+#endif
 
 
 /* Values for track_functions GUC variable --- order is significant! */
@@ -50,6 +53,9 @@ typedef enum StatMsgType
 	PGSTAT_MTYPE_RECOVERYCONFLICT,
 	PGSTAT_MTYPE_TEMPFILE,
 	PGSTAT_MTYPE_DEADLOCK
+#ifdef ADB
+	,PGSTAT_MTYPE_LATENCY
+#endif
 } StatMsgType;
 
 /* ----------
@@ -74,7 +80,9 @@ typedef int64 PgStat_Counter;
  * fetched by heap_fetch under the control of simple indexscans for this index.
  *
  * tuples_inserted/updated/deleted/hot_updated count attempted actions,
- * regardless of whether the transaction committed.  delta_live_tuples,
+ * regardless of whether the transaction committed.  tuples_newpage_updated
+ * counts the updates whose new tuple version went onto a different page,
+ * and pages_pruned the opportunistic prunes that reclaimed something.  delta_live_tuples,
  * delta_dead_tuples, and changed_tuples are set depending on commit or abort.
  * Note that delta_live_tuples and delta_dead_tuples can be negative!
  * ----------
@@ -90,6 +98,8 @@ typedef struct PgStat_TableCounts
 	PgStat_Counter t_tuples_updated;
 	PgStat_Counter t_tuples_deleted;
 	PgStat_Counter t_tuples_hot_updated;
+	PgStat_Counter t_tuples_newpage_updated;
+	PgStat_Counter t_pages_pruned;
 
 	PgStat_Counter t_delta_live_tuples;
 	PgStat_Counter t_delta_dead_tuples;
@@ -480,6 +490,21 @@ typedef struct PgStat_MsgDeadlock
 	Oid			m_databaseid;
 } PgStat_MsgDeadlock;
 
+#ifdef ADB
+/* ----------
+ * PgStat_MsgLatency			Sent by the backend to report the latency
+ *								histogram of its statements since the last
+ *								report.
+ * ----------
+ */
+typedef struct PgStat_MsgLatency
+{
+	PgStat_MsgHdr m_hdr;
+	Oid			m_databaseid;
+	PgStat_Counter m_counts[LATENCY_HIST_BUCKETS];
+} PgStat_MsgLatency;
+#endif
+
 
 /* ----------
  * PgStat_Msg					Union over all possible messages.
@@ -504,6 +529,9 @@ typedef union PgStat_Msg
 	PgStat_MsgFuncpurge msg_funcpurge;
 	PgStat_MsgRecoveryConflict msg_recoveryconflict;
 	PgStat_MsgDeadlock msg_deadlock;
+#ifdef ADB
+	PgStat_MsgLatency msg_latency;
+#endif
 } PgStat_Msg;
 
 
@@ -515,7 +543,11 @@ typedef union PgStat_Msg
  * ------------------------------------------------------------
  */
 
-#define PGSTAT_FILE_FORMAT_ID	0x01A5BC9B
+#ifdef ADB
+#define PGSTAT_FILE_FORMAT_ID	0x01A5BC9E
+#else
+#define PGSTAT_FILE_FORMAT_ID	0x01A5BC9C
+#endif
 
 /* ----------
  * PgStat_StatDBEntry			The collector's data per database
@@ -544,6 +576,9 @@ typedef struct PgStat_StatDBEntry
 	PgStat_Counter n_deadlocks;
 	PgStat_Counter n_block_read_time;	/* times in microseconds */
 	PgStat_Counter n_block_write_time;
+#ifdef ADB
+	PgStat_Counter n_latency_hist[LATENCY_HIST_BUCKETS];	/* statements */
+#endif
 
 	TimestampTz stat_reset_timestamp;
 	TimestampTz stats_timestamp;	/* time of db stats file update */
@@ -574,6 +609,8 @@ typedef struct PgStat_StatTabEntry
 	PgStat_Counter tuples_updated;
 	PgStat_Counter tuples_deleted;
 	PgStat_Counter tuples_hot_updated;
+	PgStat_Counter tuples_newpage_updated;
+	PgStat_Counter pages_pruned;
 
 	PgStat_Counter n_live_tuples;
 	PgStat_Counter n_dead_tuples;
@@ -697,6 +734,15 @@ typedef struct PgBackendStatus
 
 	/* current command string; MUST be null-terminated */
 	char	   *st_activity;
+
+#ifdef ADB
+	/* traffic with the other nodes since the current command started */
+	int64		st_remote_bytes_sent;
+	int64		st_remote_bytes_received;
+	int64		st_remote_msgs_sent;
+	int64		st_remote_msgs_received;
+	int64		st_remote_round_trips;
+#endif
 } PgBackendStatus;
 
 /*
@@ -727,6 +773,10 @@ extern PGDLLIMPORT int pgstat_track_activity_query_size;
 extern char *pgstat_stat_directory;
 extern char *pgstat_stat_tmpname;
 extern char *pgstat_stat_filename;
+#ifdef ADB
+extern int	pgstat_max_tables;
+extern int	pgstat_max_functions;
+#endif
 
 /*
  * BgWriter statistics counters are updated directly by bgwriter and bufmgr
@@ -750,6 +800,11 @@ extern void pgstat_init(void);
 extern int	pgstat_start(void);
 extern void pgstat_reset_all(void);
 extern void allow_immediate_pgstat_restart(void);
+#ifdef ADB
+extern Size PgStatShmemSize(void);
+extern void PgStatShmemInit(void);
+extern void pgstat_write_shared_statsfile(void);
+#endif
 
 #ifdef EXEC_BACKEND
 extern void PgstatCollectorMain(int argc, char *argv[]) __attribute__((noreturn));
@@ -788,6 +843,9 @@ extern void pgstat_report_tempfile(size_t filesize);
 extern void pgstat_report_appname(const char *appname);
 extern void pgstat_report_xact_timestamp(TimestampTz tstamp);
 extern void pgstat_report_waiting(bool waiting);
+#ifdef ADB
+extern void pgstat_report_remote_traffic(void);
+#endif
 extern const char *pgstat_get_backend_current_activity(int pid, bool checkUser);
 extern const char *pgstat_get_crashed_backend_activity(int pid, char *buffer,
 									int buflen);
@@ -840,8 +898,9 @@ extern void pgstat_initstats(Relation rel);
 	(pgStatBlockWriteTime += (n))
 
 extern void pgstat_count_heap_insert(Relation rel, int n);
-extern void pgstat_count_heap_update(Relation rel, bool hot);
+extern void pgstat_count_heap_update(Relation rel, bool hot, bool newpage);
 extern void pgstat_count_heap_delete(Relation rel);
+extern void pgstat_count_heap_prune(Relation rel);
 extern void pgstat_update_heap_dead_tuples(Relation rel, int delta);
 
 extern void pgstat_init_function_usage(FunctionCallInfoData *fcinfo,
@@ -869,6 +928,9 @@ extern void pgstat_send_bgwriter(void);
  */
 extern PgStat_StatDBEntry *pgstat_fetch_stat_dbentry(Oid dbid);
 extern PgStat_StatTabEntry *pgstat_fetch_stat_tabentry(Oid relid);
+#ifdef ADB
+extern PgStat_StatTabEntry *pgstat_fetch_stat_tabentry_ext(Oid dbid, Oid relid);
+#endif
 extern PgBackendStatus *pgstat_fetch_stat_beentry(int beid);
 extern PgStat_StatFuncEntry *pgstat_fetch_stat_funcentry(Oid funcid);
 extern int	pgstat_fetch_stat_numbackends(void);
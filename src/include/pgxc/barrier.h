@@ -13,8 +13,8 @@
  *-------------------------------------------------------------------------
  */
 
-#ifndef BARRIER_H
-#define BARRIER_H
+#ifndef PGXC_BARRIER_H
+#define PGXC_BARRIER_H
 
 #include "access/xlog.h"
 #include "access/xlogdefs.h"
@@ -22,6 +22,7 @@
 #define CREATE_BARRIER_PREPARE	'P'
 #define CREATE_BARRIER_EXECUTE	'X'
 #define CREATE_BARRIER_END		'E'
+#define CREATE_BARRIER_SYNC		'S'
 
 #define CREATE_BARRIER_PREPARE_DONE	'p'
 #define CREATE_BARRIER_EXECUTE_DONE	'x'
@@ -36,6 +37,7 @@ typedef struct xl_barrier
 extern void ProcessCreateBarrierPrepare(const char *id);
 extern void ProcessCreateBarrierEnd(const char *id);
 extern void ProcessCreateBarrierExecute(const char *id);
+extern void ProcessCreateBarrierSync(const char *id);
 
 extern void RequestBarrier(const char *id, char *completionTag);
 extern void barrier_redo(XLogRecPtr lsn, XLogRecord *record);
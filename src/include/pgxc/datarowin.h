@@ -0,0 +1,43 @@
+/*-------------------------------------------------------------------------
+ *
+ * datarowin.h
+ *
+ *	  Input of the values of DataRow messages received from remote nodes
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/pgxc/datarowin.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef DATAROWIN_H
+#define DATAROWIN_H
+
+#include "access/tupdesc.h"
+#include "funcapi.h"
+
+/*
+ * What it takes to read the text values of a DataRow for a tuple
+ * descriptor.  It begins with an AttInMetadata so that it can be kept in
+ * TupleTableSlot->tts_attinmeta.
+ */
+typedef struct DataRowInMetadata
+{
+	AttInMetadata attinmeta;	/* must be first */
+	bool		cached;			/* kept by the backend cache of datarowin.c,
+								 * else it belongs to the caller */
+	int			natts;
+	Oid		   *atttypids;
+	char	   *fastpath;		/* parser of each attribute, see datarowin.c */
+	MemoryContext context;		/* holds everything of a cached one */
+} DataRowInMetadata;
+
+extern DataRowInMetadata *GetDataRowInMetadata(TupleDesc tupdesc,
+					 uint32 *generation);
+extern bool DataRowInMetadataIsValid(DataRowInMetadata *meta,
+						 uint32 generation);
+extern bool DataRowInputFast(DataRowInMetadata *meta, int attnum,
+				 const char *value, int len, Datum *result);
+extern void AtEOXact_DataRowIn(void);
+
+#endif   /* DATAROWIN_H */
@@ -25,15 +25,26 @@
 #include "optimizer/pgxcplan.h"
 #include "tcop/dest.h"
 #include "tcop/pquery.h"
+#include "storage/buffile.h"
+#include "utils/resowner.h"
 #include "utils/snapshot.h"
 
 #ifdef ADB
 #include "access/xlog.h"
+#include "portability/instr_time.h"
 #endif
 
 /* GUC parameters */
 extern bool EnforceTwoPhaseCommit;
 extern bool RequirePKeyForRepTab;
+#ifdef ADB
+extern int	RemoteInsertBatchSize;
+extern int	RemoteFetchSize;
+extern int	ReplicatedTableCacheSize;
+extern bool EnableOnePhaseCommit;
+
+extern PlannedStmt *RemoteDMLBatchStmt;
+#endif
 
 /* Outputs of handle_response() */
 #define RESPONSE_EOF EOF
@@ -84,6 +95,48 @@ typedef struct RemoteDataRowData
 } 	RemoteDataRowData;
 typedef RemoteDataRowData *RemoteDataRow;
 
+/*
+ * FIFO of DataRow messages buffered from a connection taken over by another
+ * RemoteQuery.  Rows are kept in a ring of RemoteDataRowData until work_mem
+ * is used up, later rows go to a temporary file and are read back in order
+ * once the rows in memory are consumed.
+ */
+typedef struct RemoteRowBuffer
+{
+	RemoteDataRowData *rows;			/* ring of rows kept in memory */
+	int			size;					/* allocated length of rows */
+	int			head;					/* index of the oldest row in rows */
+	int			count;					/* number of rows in rows */
+	long		availMem;				/* remaining memory allowed, in bytes */
+	BufFile    *file;					/* spilled rows, NULL if never spilled */
+	ResourceOwner resowner;				/* owner of the file, see RowBufferInit */
+	int64		file_count;				/* number of rows in file */
+	int			read_fileno;			/* position of the oldest spilled row */
+	off_t		read_offset;
+	int			write_fileno;			/* end of the spilled rows */
+	off_t		write_offset;
+} RemoteRowBuffer;
+
+#define RemoteRowBufferIsEmpty(buf) \
+	((buf)->count == 0 && (buf)->file_count == 0)
+
+#ifdef ADB
+/*
+ * What EXPLAIN ANALYZE shows of each node a RemoteQuery reads from.  The
+ * times are counted from the start of the query, the wait time is spent in
+ * pgxc_node_receive with the connection of the node among those waited on.
+ */
+typedef struct RemoteNodeInstr
+{
+	Oid			nodeoid;
+	double		rows;			/* DataRow messages received */
+	uint64		bytes;			/* size of all messages received */
+	instr_time	startup;		/* until the first DataRow */
+	instr_time	total;			/* until the last CommandComplete */
+	instr_time	wait;			/* blocked in pgxc_node_receive */
+} RemoteNodeInstr;
+#endif
+
 typedef struct RemoteQueryState
 {
 	ScanState	ss;						/* its first field is NodeTag */
@@ -108,9 +161,11 @@ typedef struct RemoteQueryState
 	char	   *errorNodeName;			/* error node name to send back to client */
 #endif /* ADB */
 	bool		query_Done;				/* query has been sent down to Datanodes */
+	bool		query_pending;			/* first answers not read yet, see do_query */
+	PGXCNodeHandle **pending_connections;
+	int			pending_count;
 	RemoteDataRowData currentRow;		/* next data ro to be wrapped into a tuple */
-	/* TODO use a tuplestore as a rowbuffer */
-	List 	   *rowBuffer;				/* buffer where rows are stored when connection
+	RemoteRowBuffer rowBuffer;			/* buffer where rows are stored when connection
 										 * should be cleaned for reuse by other RemoteQuery */
 	/*
 	 * To handle special case - if this RemoteQuery is feeding sorted data to
@@ -140,6 +195,26 @@ typedef struct RemoteQueryState
 	Tuplestorestate *tuplestorestate;
 	CommandId	rqs_cmd_id;			/* Cmd id to use in some special cases */
 	uint32		rqs_processed;			/* Number of rows processed (only for DMLs) */
+#ifdef ADB
+	/* pipelined INSERT, see ExecRemoteDMLBatchRow */
+	bool		batch_checked;			/* batch_insert is decided */
+	bool		batch_insert;			/* rows are sent without waiting */
+	bool		batch_deferred;			/* and answered at the client's Sync */
+	int			batch_rows;				/* rows sent since last Sync */
+	PGXCNodeHandle **batch_connections;	/* connections waiting for Sync */
+	int			batch_conn_count;
+	uint32		batch_reported;			/* rqs_processed already counted by caller */
+	/* cursor fetched by remote_fetch_size rows, see do_query */
+	bool		forward_only;			/* executor asked for no rescan */
+	bool		keep_rows;				/* rows are kept in tuplestorestate for a rescan */
+	int			fetch_size;				/* rows asked by each Execute, 0 for all */
+	/* EXPLAIN ANALYZE statistics of the nodes, NULL if not instrumented */
+	RemoteNodeInstr *node_instr;
+	int			node_instr_count;
+	int			node_instr_size;
+	instr_time	node_instr_start;		/* the query was sent */
+	struct ReplCacheEntry *rcache_fill;	/* rows being kept, see ReplCacheLookup */
+#endif
 }	RemoteQueryState;
 
 typedef void (*xact_callback) (bool isCommit, void *args);
@@ -177,6 +252,11 @@ extern bool FetchTuple(RemoteQueryState *combiner, TupleTableSlot *slot);
 extern void BufferConnection(PGXCNodeHandle *conn);
 
 extern void ExecRemoteQueryReScan(RemoteQueryState *node, ExprContext *exprCtxt);
+#ifdef ADB
+extern bool ExecRemoteQueryIsAsyncCapable(RemoteQueryState *node);
+extern bool ExecRemoteQueryAsyncRequest(RemoteQueryState *node,
+							pgsocket *socks, int *nsocks);
+#endif
 
 extern void SetDataRowForExtParams(ParamListInfo params, RemoteQueryState *rq_state);
 
@@ -186,12 +266,19 @@ extern void PrePrepare_Remote(const char *gid);
 extern bool	PreAbort_Remote(const char *gid, bool missing_ok);
 extern void AtEOXact_Remote(void);
 extern bool IsTwoPhaseCommitRequired(bool localWrite);
+#ifdef ADB
+extern bool XactHasRemoteWrites(void);
+#endif
 
 /* Flags related to temporary objects included in query */
 extern void ExecSetTempObjectIncluded(void);
 extern bool ExecIsTempObjectIncluded(void);
 extern TupleTableSlot * ExecProcNodeDMLInXC(EState *estate,
                         TupleTableSlot *sourceDataSlot, TupleTableSlot *newDataSlot);
+#ifdef ADB
+extern void ExecFinishRemoteDMLBatch(EState *estate, RemoteQueryState *node, bool canSetTag);
+extern void ExecFlushRemoteDMLBatch(void);
+#endif
 
 extern void pgxc_all_success_nodes(ExecNodes **d_nodes, ExecNodes **c_nodes, char **failednodes_msg);
 extern void AtEOXact_DBCleanup(bool isCommit);
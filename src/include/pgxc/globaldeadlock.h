@@ -0,0 +1,31 @@
+/*-------------------------------------------------------------------------
+ *
+ * globaldeadlock.h
+ *
+ *	  Detection of deadlocks between transactions waiting on several nodes
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/pgxc/globaldeadlock.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef GLOBALDEADLOCK_H
+#define GLOBALDEADLOCK_H
+
+#include "fmgr.h"
+
+extern bool enable_global_deadlock_check;
+extern volatile bool GlobalDeadlockPending;
+
+extern Size GlobalDeadlockShmemSize(void);
+extern void GlobalDeadlockShmemInit(void);
+
+extern bool GlobalDeadlockCheckWanted(void);
+extern void GlobalDeadlockCheck(void);
+extern void HandleGlobalDeadlockInterrupt(void);
+
+extern Datum pg_lock_wait_edges(PG_FUNCTION_ARGS);
+extern Datum pgxc_cancel_deadlock_victim(PG_FUNCTION_ARGS);
+
+#endif /* GLOBALDEADLOCK_H */
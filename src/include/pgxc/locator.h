@@ -25,6 +25,9 @@
 										 * replicated and distributed table */
 #ifdef ADB
 #define LOCATOR_TYPE_USER_DEFINED 'U'
+#define LOCATOR_TYPE_BUCKET 'B'		/* hash into virtual buckets, each bucket
+									 * being mapped to a node in pgxc_class */
+#define LOCATOR_TYPE_LIST 'L'		/* each node holds a list of values */
 #endif
 
 /* Maximum number of preferred Datanodes that can be defined in cluster */
@@ -33,6 +36,14 @@
 #define HASH_SIZE 4096
 #define HASH_MASK 0x00000FFF;
 
+#ifdef ADB
+/*
+ * Number of virtual buckets of a table distributed by bucket. The whole
+ * bucket map is kept in one pgxc_class tuple, so it has to stay small.
+ */
+#define LOCATOR_BUCKET_COUNT 1024
+#endif
+
 #define IsLocatorNone(x) (x == LOCATOR_TYPE_NONE)
 #define IsLocatorReplicated(x) (x == LOCATOR_TYPE_REPLICATED)
 #ifdef ADB
@@ -40,23 +51,49 @@
 									   (x) == LOCATOR_TYPE_RROBIN || \
 									   (x) == LOCATOR_TYPE_MODULO || \
 									   (x) == LOCATOR_TYPE_DISTRIBUTED || \
-									   (x) == LOCATOR_TYPE_USER_DEFINED)
+									   (x) == LOCATOR_TYPE_USER_DEFINED || \
+									   (x) == LOCATOR_TYPE_BUCKET || \
+									   (x) == LOCATOR_TYPE_RANGE || \
+									   (x) == LOCATOR_TYPE_LIST)
 #else
 #define IsLocatorColumnDistributed(x) (x == LOCATOR_TYPE_HASH || \
 									   x == LOCATOR_TYPE_RROBIN || \
 									   x == LOCATOR_TYPE_MODULO || \
 									   x == LOCATOR_TYPE_DISTRIBUTED)
 #endif
+#ifdef ADB
+#define IsLocatorDistributedByValue(x) ((x) == LOCATOR_TYPE_HASH || \
+										(x) == LOCATOR_TYPE_MODULO || \
+										(x) == LOCATOR_TYPE_RANGE || \
+										(x) == LOCATOR_TYPE_BUCKET || \
+										(x) == LOCATOR_TYPE_LIST)
+#else
 #define IsLocatorDistributedByValue(x) (x == LOCATOR_TYPE_HASH || \
 										x == LOCATOR_TYPE_MODULO || \
 										x == LOCATOR_TYPE_RANGE)
+#endif
 #ifdef ADB
 #define IsLocatorDistributedByUserDefined(x) (x == LOCATOR_TYPE_USER_DEFINED)
+#define IsLocatorDistributedByRangeOrList(x) ((x) == LOCATOR_TYPE_RANGE || \
+											  (x) == LOCATOR_TYPE_LIST)
 #endif
 
+#include "nodes/bitmapset.h"
 #include "nodes/primnodes.h"
 #include "utils/relcache.h"
 
+#ifdef ADB
+/*
+ * How a read of a replicated table chooses its Datanode
+ */
+typedef enum
+{
+	REPLICATED_READ_PREFERRED,		/* a preferred node, else the first one */
+	REPLICATED_READ_ROUND_ROBIN,	/* each node in turn */
+	REPLICATED_READ_LEAST_LOADED	/* the node with the fewest sessions */
+} ReplicatedReadRouting;
+#endif
+
 /*
  * How relation is accessed in the query
  */
@@ -68,6 +105,11 @@ typedef enum
 	RELATION_ACCESS_INSERT				/* INSERT */
 } RelationAccessType;
 
+#ifdef ADB
+/* Hash of a value of the distribution column, see RelationLocInfo */
+typedef long (*LocatorHashFunc) (Datum value);
+#endif
+
 typedef struct
 {
 	Oid			relid;			/* OID of relation */
@@ -78,6 +120,39 @@ typedef struct
 #ifdef ADB
 	Oid			funcid;
 	List	   *funcAttrNums;
+	int			numBuckets;		/* number of virtual buckets */
+	int16	   *bucketMap;		/* position in nodeList of each bucket */
+	float4		nodeSkew;		/* rows of the largest node over the average,
+								 * 1 if unknown */
+	int32		colocation;		/* colocation group in pgxc_class, 0 if none */
+	/*
+	 * Range and list distributions, the values are sorted. A range has the
+	 * lower bounds of all nodes but the first one, a value goes to the node
+	 * of the largest bound not above it. A list has the values of all the
+	 * nodes, distValuePositions giving the position in nodeList of each.
+	 */
+	int			numDistValues;
+	Datum	   *distValues;
+	int16	   *distValuePositions;	/* NULL for a range */
+	Oid			distValueType;	/* type of the distribution column */
+	Oid			distValueCollation;
+	int16		distValueLen;
+	bool		distValueByVal;
+
+	/*
+	 * The locator information of a relcache entry is shared with the callers
+	 * of GetRelationLocInfo(), who must not change it, and stays valid until
+	 * the end of the transaction even if the entry is rebuilt meanwhile.
+	 * Copies made by CopyRelationLocInfo() have none of this and belong to
+	 * whoever made them.
+	 */
+	bool		cached;			/* still referenced by its relcache entry */
+	bool		inXactList;		/* handed out in the current transaction */
+	int			refcount;		/* references handed out, not released */
+	int		   *nodeIndexes;	/* nodeList as an array, NULL in copies */
+	LocatorHashFunc hashFunc;	/* hash of a value of type hashType without
+								 * going through fmgr, or NULL */
+	Oid			hashType;
 #endif
 } RelationLocInfo;
 
@@ -86,6 +161,7 @@ typedef struct
 #define IsRelationDistributedByValue(rel_loc)	IsLocatorDistributedByValue((rel_loc)->locatorType)
 #ifdef ADB
 #define IsRelationDistributedByUserDefined(rel_loc) IsLocatorDistributedByUserDefined((rel_loc)->locatorType)
+#define IsRelationDistributedByRangeOrList(rel_loc) IsLocatorDistributedByRangeOrList((rel_loc)->locatorType)
 #endif
 
 /*
@@ -109,6 +185,13 @@ typedef struct
 #ifdef ADB
 	Oid			en_funcid;
 	List		*en_expr;
+	bool		en_expr_array;		/* en_expr gives an array of values of
+									 * the distribution column, the nodes of
+									 * all of them are used */
+	bool		en_expr_rowid;		/* en_expr gives a rowid, the query
+									 * goes to the node of the row */
+	int32		en_colocation;		/* colocation group of the relations,
+									 * 0 if none */
 #else
 	Expr		*en_expr;			/* Expression to evaluate at execution time
 									 * if planner can not determine execution
@@ -131,12 +214,20 @@ typedef struct
 extern Oid primary_data_node;
 extern Oid preferred_data_node[MAX_PREFERRED_NODES];
 extern int num_preferred_data_nodes;
+#ifdef ADB
+extern bool online_bucket_redistribution;
+extern int replicated_read_routing;
+#endif
 
 /* Function for RelationLocInfo building and management */
 extern void RelationBuildLocator(Relation rel);
 extern RelationLocInfo *GetRelationLocInfo(Oid relid);
 extern RelationLocInfo *CopyRelationLocInfo(RelationLocInfo *srcInfo);
 extern void FreeRelationLocInfo(RelationLocInfo *relationLocInfo);
+#ifdef ADB
+extern void ReleaseCachedRelationLocInfo(RelationLocInfo *relationLocInfo);
+extern void AtEOXact_RelationLocInfo(void);
+#endif
 extern char *GetRelationDistribColumn(RelationLocInfo *locInfo);
 #ifdef ADB
 extern List *GetRelationDistribColumnList(RelationLocInfo *locInfo);
@@ -147,6 +238,10 @@ extern List *GetPreferredReplicationNode(List *relNodes);
 extern bool IsTableDistOnPrimary(RelationLocInfo *locInfo);
 extern bool IsLocatorInfoEqual(RelationLocInfo *locInfo1,
 							   RelationLocInfo *locInfo2);
+#ifdef ADB
+extern bool IsLocatorDistValuesEqual(RelationLocInfo *locInfo1,
+									 RelationLocInfo *locInfo2);
+#endif
 extern int GetRoundRobinNode(Oid relid);
 extern bool IsTypeDistributable(Oid colType);
 extern bool IsDistribColumn(Oid relid, AttrNumber attNum);
@@ -158,6 +253,24 @@ extern ExecNodes *GetRelationNodes(RelationLocInfo *rel_loc_info,
 								   bool* isValueNull,
 								   Oid* typeOfValueForDistCol,
 								   RelationAccessType accessType);
+extern int16 *BuildBucketMap(int numBuckets,
+							 const int16 *oldMap,
+							 const Oid *oldNodes,
+							 int oldNum,
+							 const Oid *newNodes,
+							 int newNum,
+							 bool rebalance);
+extern void SetLocatorDistValues(RelationLocInfo *locInfo,
+								 Oid type,
+								 Oid collation,
+								 List *values);
+extern int GetLocatorDistValuesNodes(RelationLocInfo *locInfo);
+extern void GetRelationNodeIndexes(RelationLocInfo *rel_loc_info,
+								   int nrows,
+								   const Datum *values,
+								   const bool *nulls,
+								   Oid type,
+								   int *nodeIndexes);
 #else
 extern ExecNodes *GetRelationNodes(RelationLocInfo *rel_loc_info,
 								   Datum valueForDistCol,
@@ -181,11 +294,30 @@ extern void CoerceUserDefinedFuncArgs(Oid funcid,
 									  Datum *values,
 									  bool *nulls,
 									  Oid *types);
+extern ExecNodes *GetRelationNodesByArray(RelationLocInfo *rel_loc_info,
+										  Datum array,
+										  RelationAccessType relaccess);
+extern Expr *GetRelationDistribParamExpr(Oid reloid,
+										 Index varno,
+										 Node *quals,
+										 bool *is_array);
+extern ExecNodes *GetRelationNodesByRowId(RelationLocInfo *rel_loc_info,
+										  Datum rowid,
+										  RelationAccessType relaccess);
+extern Expr *GetRelationRowIdParamExpr(Oid reloid,
+									   Index varno,
+									   Node *quals);
 #endif
 
 /* Global locator data */
 extern void FreeExecNodes(ExecNodes **exec_nodes);
 extern List *GetAllDataNodes(void);
 extern List *GetAllCoordNodes(void);
+#ifdef ADB
+extern Bitmapset *GetNodeListBitmap(List *nodeList);
+extern bool IsNodeListSubset(List *nodeList1, List *nodeList2);
+extern bool IsNodeListEqual(List *nodeList1, List *nodeList2);
+extern List *GetNodeListIntersection(List *nodeList1, List *nodeList2);
+#endif
 
 #endif   /* LOCATOR_H */
@@ -34,10 +34,16 @@ typedef struct
 	int			nodeport;
 	bool		nodeisprimary;
 	bool 		nodeispreferred;
+	NameData	nodeslavehost;	/* hot standby slave, empty if none */
+	int			nodeslaveport;
 } NodeDefinition;
 
 extern void NodeTablesShmemInit(void);
 extern Size NodeTablesShmemSize(void);
+#ifdef ADB
+extern void PgxcNodeAddLoad(Oid nodeoid, int delta);
+extern int PgxcNodeGetLoad(Oid nodeoid);
+#endif
 
 extern void PgxcNodeListAndCount(void);
 extern void PgxcNodeGetOids(Oid **coOids, Oid **dnOids,
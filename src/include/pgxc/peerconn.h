@@ -0,0 +1,29 @@
+/*-------------------------------------------------------------------------
+ *
+ * peerconn.h
+ *
+ *	  Direct connections between Datanodes
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/pgxc/peerconn.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef PEERCONN_H
+#define PEERCONN_H
+
+#include "fmgr.h"
+
+/*
+ * Called for each row fetched from a peer node, "values" has the text
+ * output of the "natts" columns of the row, NULL for a null value.
+ */
+typedef void (*PeerConnRowCallback) (char **values, int natts, void *arg);
+
+extern void PeerConnFetch(const char *host, int port, const char *query,
+						  PeerConnRowCallback callback, void *arg);
+
+extern Datum pgxc_motion_fetch(PG_FUNCTION_ARGS);
+
+#endif /* PEERCONN_H */
@@ -19,6 +19,9 @@
 #include "utils/timestamp.h"
 #include "nodes/pg_list.h"
 #include "utils/snapshot.h"
+#ifdef ADB
+#include "executor/instrument.h"
+#endif
 #include <unistd.h>
 
 #define NO_SOCKET -1
@@ -77,6 +80,23 @@ typedef enum
 #define DEBUG_BUF_SIZE 1024
 #endif
 
+#ifdef ADB
+/*
+ * Traffic of a connection since it was handed to the session.  The same
+ * counts of all connections are added to pgBufferUsage, which is where the
+ * traffic of queries and plan nodes is taken from.  A round trip is the
+ * first data received after something was sent.
+ */
+typedef struct PGXCNodeTraffic
+{
+	uint64		bytes_sent;
+	uint64		bytes_received;
+	uint64		msgs_sent;
+	uint64		msgs_received;
+	uint64		round_trips;
+} PGXCNodeTraffic;
+#endif
+
 struct pgxc_node_handle
 {
 	Oid			nodeoid;
@@ -117,9 +137,31 @@ struct pgxc_node_handle
 	 * For details see comments of RESP_ROLLBACK
 	 */
 	RESP_ROLLBACK	ck_resp_rollback;
+#ifdef ADB
+	/* extended query messages were sent without Sync, see pgxc_node_send_sync */
+	bool		sync_pending;
+	/* PortalSuspended was received, ReadyForQuery is expected next */
+	bool		portal_suspended;
+	PGXCNodeTraffic traffic;
+	/* sent something since data was last received */
+	bool		awaiting_answer;
+	/* acquired by a transaction which may read from slaves, see get_handles */
+	bool		slave_read;
+#endif
 };
 typedef struct pgxc_node_handle PGXCNodeHandle;
 
+#ifdef ADB
+/* Count a message put in the output buffer of "handle" */
+#define PGXCNodeCountMessageSent(handle)					\
+	do {													\
+		((PGXCNodeHandle *) (handle))->traffic.msgs_sent++;	\
+		pgBufferUsage.remote_msgs_sent++;					\
+	} while (0)
+#else
+#define PGXCNodeCountMessageSent(handle)	((void) 0)
+#endif
+
 #ifdef ADB
 #define FreeHandleError(handle)								\
 	do {													\
@@ -204,10 +246,18 @@ extern int	pgxc_node_send_query_extended(PGXCNodeHandle *handle, const char *que
 							  int num_params, Oid *param_types,
 							  int paramlen, char *params,
 							  bool send_describe, int fetch_size);
+extern int	pgxc_node_send_query_extended_nosync(PGXCNodeHandle *handle, const char *query,
+							  const char *statement, const char *portal,
+							  int num_params, Oid *param_types,
+							  int paramlen, char *params,
+							  bool send_describe, int fetch_size);
 extern int	pgxc_node_send_gxid(PGXCNodeHandle *handle, GlobalTransactionId gxid);
 extern int	pgxc_node_send_cmd_id(PGXCNodeHandle *handle, CommandId cid);
 extern int	pgxc_node_send_snapshot(PGXCNodeHandle *handle, Snapshot snapshot);
 extern int  pgxc_node_send_timestamp(PGXCNodeHandle *handle, TimestampTz timestamp);
+#ifdef ADB
+extern int	pgxc_node_send_query_id(PGXCNodeHandle *handle, uint32 queryid);
+#endif
 extern bool	pgxc_node_receive(const int conn_count,
 				  PGXCNodeHandle ** connections, struct timeval * timeout);
 extern int	pgxc_node_read_data(PGXCNodeHandle * conn, bool close_if_error);
@@ -216,6 +266,9 @@ extern int	pgxc_node_is_data_enqueued(PGXCNodeHandle *conn);
 extern int	send_some(PGXCNodeHandle * handle, int len);
 extern int	pgxc_node_flush(PGXCNodeHandle *handle);
 extern void	pgxc_node_flush_read(PGXCNodeHandle *handle);
+#ifdef ADB
+extern void pgxc_node_flush_read_all(int count, PGXCNodeHandle **handles);
+#endif
 
 extern char get_message(PGXCNodeHandle *conn, int *len, char **msg);
 
@@ -61,9 +61,14 @@ typedef struct PoolHandle PoolHandle;
 
 extern int	MinPoolSize;
 extern int	MaxPoolSize;
+extern int	PoolMinIdle;
 extern int	PoolRemoteCmdTimeout;
 
 extern bool PersistentConnections;
+extern bool PoolTransactionMode;
+extern bool PoolLazyConnect;
+extern bool EnableDatanodeSlaveRead;
+extern int	DatanodeSlaveMaxLag;
 
 /* Status inquiry functions */
 extern void PGXCPoolerProcessIam(void);
@@ -107,6 +112,13 @@ extern void PoolManagerConnect(PoolHandle *handle,
 	                           const char *database, const char *user_name,
 	                           const char *pgoptions);
 
+/*
+ * Called from Session process instead of PoolManagerConnect when
+ * pool_lazy_connect is on.  The session attaches to the pool manager the
+ * first time it needs it.
+ */
+extern void PoolManagerDeferConnect(const char *database, const char *user_name);
+
 /*
  * Reconnect to pool manager
  * This simply does a disconnection followed by a reconnection.
@@ -122,7 +134,7 @@ extern void PoolManagerReconnect(void);
 extern int PoolManagerSetCommand(PoolCommandType command_type, const char *set_command);
 
 /* Get pooled connections */
-extern int *PoolManagerGetConnections(List *datanodelist, List *coordlist);
+extern int *PoolManagerGetConnections(List *datanodelist, List *coordlist, List *slavelist);
 
 /* Clean pool connections */
 extern void PoolManagerCleanConnection(List *datanodelist, List *coordlist, char *dbname, char *username);
@@ -142,6 +154,10 @@ extern void PoolManagerReleaseConnections(bool force_close);
 #else
 extern void PoolManagerReleaseConnections(void);
 #endif
+#ifdef ADB
+/* Return connections back to the pool, closing those of the listed nodes */
+extern void PoolManagerDiscardConnections(int dn_count, int* dn_list, int co_count, int* co_list);
+#endif
 
 /* Cancel a running query on Datanodes as well as on other Coordinators */
 extern void PoolManagerCancelQuery(int dn_count, int* dn_list, int co_count, int* co_list);
@@ -159,4 +175,6 @@ extern Datum pool_close_idle_conn(PG_FUNCTION_ARGS);
 
 extern Datum pool_close_all_conn(PG_FUNCTION_ARGS);
 
+extern Datum pg_pool_stats(PG_FUNCTION_ARGS);
+
 #endif
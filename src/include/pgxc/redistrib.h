@@ -30,6 +30,11 @@ typedef enum RedistribOperation {
 	DISTRIB_COPY_FROM,	/* Perform a COPY FROM */
 	DISTRIB_TRUNCATE,	/* Truncate relation */
 	DISTRIB_REINDEX		/* Reindex relation */
+#ifdef ADB
+	,DISTRIB_COPY_TO_BUCKET	/* Perform a COPY TO of the buckets moved */
+	,DISTRIB_DELETE_BUCKET	/* Perform a DELETE with bucket check */
+	,DISTRIB_PULL_BUCKET	/* Datanodes fetch moved buckets from each other */
+#endif
 } RedistribOperation;
 
 /*
@@ -65,6 +70,10 @@ typedef struct RedistribState {
 	Oid			relid;			/* Oid of relation redistributed */
 	List	   *commands;		/* List of commands */
 	Tuplestorestate *store;		/* Tuple store used for temporary data storage */
+#ifdef ADB
+	List	   *buckets;		/* Buckets changing of node */
+	List	   *sources;		/* Nodes buckets are fetched from by PULL */
+#endif
 } RedistribState;
 
 extern void PGXCRedistribTable(RedistribState *distribState, RedistribCatalog type);
@@ -77,4 +86,8 @@ extern RedistribState *makeRedistribState(Oid relOid);
 extern void FreeRedistribState(RedistribState *state);
 extern void FreeRedistribCommand(RedistribCommand *command);
 
+#ifdef ADB
+extern bool enable_direct_redistribution;
+#endif
+
 #endif  /* REDISTRIB_H */
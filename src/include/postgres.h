@@ -92,7 +92,8 @@ typedef union
 	struct						/* Compressed-in-line format */
 	{
 		uint32		va_header;
-		uint32		va_rawsize; /* Original data size (excludes header) */
+		uint32		va_rawsize; /* Original data size (excludes header) and
+								 * compression method */
 		char		va_data[1]; /* Compressed data */
 	}			va_compressed;
 } varattrib_4b;
@@ -223,8 +224,22 @@ typedef struct
 #define VARDATA_1B(PTR)		(((varattrib_1b *) (PTR))->va_data)
 #define VARDATA_1B_E(PTR)	(((varattrib_1b_e *) (PTR))->va_data)
 
+/*
+ * The top two bits of va_rawsize identify the compression method, so that
+ * values compressed before there was a choice read as pglz-compressed.
+ */
+#define VARLENA_RAWSIZE_BITS	30
+#define VARLENA_RAWSIZE_MASK	((1U << VARLENA_RAWSIZE_BITS) - 1)
+
+#define VARHDRSZ_COMPRESSED		offsetof(varattrib_4b, va_compressed.va_data)
+
 #define VARRAWSIZE_4B_C(PTR) \
-	(((varattrib_4b *) (PTR))->va_compressed.va_rawsize)
+	(((varattrib_4b *) (PTR))->va_compressed.va_rawsize & VARLENA_RAWSIZE_MASK)
+#define VARCOMPRESS_4B_C(PTR) \
+	(((varattrib_4b *) (PTR))->va_compressed.va_rawsize >> VARLENA_RAWSIZE_BITS)
+#define SET_VARRAWSIZE_4B_C(PTR, len, method) \
+	(((varattrib_4b *) (PTR))->va_compressed.va_rawsize = \
+	 ((uint32) (len)) | ((uint32) (method) << VARLENA_RAWSIZE_BITS))
 
 /* Externally visible macros */
 
@@ -33,6 +33,10 @@ extern int	autovacuum_freeze_max_age;
 extern int	autovacuum_multixact_freeze_max_age;
 extern int	autovacuum_vac_cost_delay;
 extern int	autovacuum_vac_cost_limit;
+#ifdef ADB
+extern int	autovacuum_stagger_interval;
+extern int	autovacuum_cluster_cost_limit;
+#endif
 
 /* autovacuum launcher PID, only valid when worker is shutting down */
 extern int	AutovacuumLauncherPid;
@@ -69,6 +69,7 @@ extern PGDLLIMPORT char *Log_directory;
 extern PGDLLIMPORT char *Log_filename;
 extern bool Log_truncate_on_rotation;
 extern int	Log_file_mode;
+extern int	Log_ring_size;
 
 extern bool am_syslogger;
 
@@ -82,6 +83,7 @@ extern HANDLE syslogPipe[2];
 extern int	SysLogger_Start(void);
 
 extern void write_syslogger_file(const char *buffer, int count, int dest);
+extern bool SysLoggerRingWrite(const char *data, int len, int dest);
 
 #ifdef EXEC_BACKEND
 extern void SysLoggerMain(int argc, char *argv[]) __attribute__((noreturn));
@@ -0,0 +1,41 @@
+/*-------------------------------------------------------------------------
+ *
+ * incrbackup.h
+ *
+ *	  Format of the relation files of an incremental base backup
+ *
+ * BASE_BACKUP INCREMENTAL '<lsn>' sends each segment of the main fork of a
+ * relation as "<segment>.incr", holding only the blocks whose LSN is not
+ * before <lsn>, or zero:
+ *
+ *	IncrementalFileHeader
+ *	uint32		blocks[nchanged];		block numbers, ascending
+ *	char		data[nchanged][BLCKSZ];
+ *
+ * The other blocks are the same as in a backup started at or after <lsn>;
+ * pg_combinebackup takes them from there.  This file is used by frontend
+ * programs too, so keep it free of backend-only definitions.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/replication/incrbackup.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef INCRBACKUP_H
+#define INCRBACKUP_H
+
+#define INCREMENTAL_FILE_MAGIC		0x52434E49	/* "INCR" */
+#define INCREMENTAL_FILE_SUFFIX		".incr"
+
+/* The line of backup_label telling a backup is incremental */
+#define INCREMENTAL_LABEL_LINE		"INCREMENTAL FROM LOCATION: "
+
+typedef struct IncrementalFileHeader
+{
+	uint32		magic;			/* INCREMENTAL_FILE_MAGIC */
+	uint32		nblocks;		/* length of the segment, in blocks */
+	uint32		nchanged;		/* blocks included in the file */
+} IncrementalFileHeader;
+
+#endif   /* INCRBACKUP_H */
@@ -22,6 +22,9 @@
 extern int	wal_receiver_status_interval;
 extern int	wal_receiver_timeout;
 extern bool hot_standby_feedback;
+#ifdef ADB
+extern PGDLLIMPORT bool wal_receiver_compression;
+#endif
 
 /*
  * MAXCONNINFO: maximum size of a connection string.
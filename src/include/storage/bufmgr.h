@@ -57,6 +57,17 @@ extern int	bgwriter_lru_maxpages;
 extern double bgwriter_lru_multiplier;
 extern bool track_io_timing;
 extern int	target_prefetch_pages;
+extern int	checkpoint_flush_after;
+
+/* upper limit for checkpoint_flush_after */
+#define WRITEBACK_MAX_PENDING_FLUSHES 256
+
+/* default for checkpoint_flush_after, in blocks; 256kB if it works */
+#ifdef HAVE_SYNC_FILE_RANGE
+#define DEFAULT_CHECKPOINT_FLUSH_AFTER 32
+#else
+#define DEFAULT_CHECKPOINT_FLUSH_AFTER 0
+#endif
 
 /* in buf_init.c */
 extern PGDLLIMPORT char *BufferBlocks;
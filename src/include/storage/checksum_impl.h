@@ -167,6 +167,15 @@ pg_checksum_block(char *data, uint32 size)
 	return result;
 }
 
+/*
+ * The block checksum pg_checksum_page() uses.  The backend replaces it with
+ * a copy of pg_checksum_block() compiled for the SIMD instructions of the
+ * CPU it runs on, see storage/page/checksum.c.
+ */
+#ifndef PG_CHECKSUM_BLOCK
+#define PG_CHECKSUM_BLOCK(data, size) pg_checksum_block(data, size)
+#endif
+
 /*
  * Compute the checksum for a Postgres page.  The page must be aligned on a
  * 4-byte boundary.
@@ -193,7 +202,7 @@ pg_checksum_page(char *page, BlockNumber blkno)
 	 */
 	save_checksum = phdr->pd_checksum;
 	phdr->pd_checksum = 0;
-	checksum = pg_checksum_block(page, BLCKSZ);
+	checksum = PG_CHECKSUM_BLOCK(page, BLCKSZ);
 	phdr->pd_checksum = save_checksum;
 
 	/* Mix in the block number to detect transposed pages */
@@ -25,6 +25,8 @@ extern BlockNumber RecordAndGetPageWithFreeSpace(Relation rel,
 							  BlockNumber oldPage,
 							  Size oldSpaceAvail,
 							  Size spaceNeeded);
+extern void UpdateFreeSpaceMap(Relation rel, BlockNumber startBlkNum,
+				   BlockNumber endBlkNum, Size freespace);
 extern void RecordPageWithFreeSpace(Relation rel, BlockNumber heapBlk,
 						Size spaceAvail);
 extern void XLogRecordPageWithFreeSpace(RelFileNode rnode, BlockNumber heapBlk,
@@ -146,5 +146,7 @@ extern int32 ItemPointerCompare(ItemPointer arg1, ItemPointer arg2);
 #ifdef ADB
 /* in rowid.c */
 extern Datum rowid_make(uint32 node_id, ItemPointer const tid);
+extern uint32 rowid_get_node_id(Datum rowid);
+extern void rowid_get_tid(Datum rowid, ItemPointer tid);
 #endif /* ADB */
 #endif   /* ITEMPTR_H */
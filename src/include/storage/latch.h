@@ -74,6 +74,14 @@
  * only, so using any latch other than the process latch effectively precludes
  * use of any generic handler.
  *
+ * A process waiting over and over on the same sockets, such as a walsender
+ * or a manager process serving many clients, should rather build a
+ * WaitEventSet once: the latch, postmaster death and sockets are registered
+ * in it, and WaitEventSetWait() reports which of them fired, without setting
+ * up the whole descriptor set again on every call.  Sockets can be added,
+ * modified and removed as the process goes; a socket event with no
+ * WL_SOCKET_* flag is kept in the set but not waited on.
+ *
  *
  * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -109,6 +117,18 @@ typedef struct
 #define WL_TIMEOUT			 (1 << 3)
 #define WL_POSTMASTER_DEATH  (1 << 4)
 
+/* An event of a WaitEventSet, or one reported by WaitEventSetWait() */
+typedef struct WaitSetEvent
+{
+	int			pos;			/* position in the set */
+	uint32		events;			/* WL_* flags waited for, or that fired */
+	pgsocket	fd;				/* socket, if a socket event */
+	void	   *user_data;		/* as given to AddWaitEventToSet */
+} WaitSetEvent;
+
+/* Opaque, see unix_latch.c */
+typedef struct WaitEventSet WaitEventSet;
+
 /*
  * prototypes for functions in latch.c
  */
@@ -123,6 +143,15 @@ extern int WaitLatchOrSocket(volatile Latch *latch, int wakeEvents,
 extern void SetLatch(volatile Latch *latch);
 extern void ResetLatch(volatile Latch *latch);
 
+extern WaitEventSet *CreateWaitEventSet(MemoryContext context, int nevents);
+extern void FreeWaitEventSet(WaitEventSet *set);
+extern int AddWaitEventToSet(WaitEventSet *set, uint32 events, pgsocket fd,
+				  volatile Latch *latch, void *user_data);
+extern void ModifyWaitEvent(WaitEventSet *set, int pos, uint32 events);
+extern void RemoveWaitEventFromSet(WaitEventSet *set, int pos);
+extern int WaitEventSetWait(WaitEventSet *set, long timeout,
+				 WaitSetEvent *occurred_events, int nevents);
+
 /* beware of memory ordering issues if you use this macro! */
 #define TestLatch(latch) (((volatile Latch *) (latch))->is_set)
 
@@ -20,8 +20,15 @@
  * this file include lock.h or bufmgr.h would be backwards.
  */
 
-/* Number of partitions of the shared buffer mapping hashtable */
-#define NUM_BUFFER_PARTITIONS  128
+/*
+ * Number of partitions of the shared buffer mapping hashtable.  Large
+ * machines with a big shared_buffers may build with a higher value, e.g.
+ * -DLOG2_NUM_BUFFER_PARTITIONS=8.
+ */
+#ifndef LOG2_NUM_BUFFER_PARTITIONS
+#define LOG2_NUM_BUFFER_PARTITIONS  7
+#endif
+#define NUM_BUFFER_PARTITIONS  (1 << LOG2_NUM_BUFFER_PARTITIONS)
 
 /* Number of partitions the shared lock tables are divided into */
 #define LOG2_NUM_LOCK_PARTITIONS  6
@@ -31,6 +38,12 @@
 #define LOG2_NUM_PREDICATELOCK_PARTITIONS  6
 #define NUM_PREDICATELOCK_PARTITIONS  (1 << LOG2_NUM_PREDICATELOCK_PARTITIONS)
 
+#ifdef ADB
+/* Number of partitions the shared statistics tables are divided into */
+#define LOG2_NUM_PGSTAT_PARTITIONS  4
+#define NUM_PGSTAT_PARTITIONS  (1 << LOG2_NUM_PGSTAT_PARTITIONS)
+#endif
+
 /*
  * We have a number of predefined LWLocks, plus a bunch of LWLocks that are
  * dynamically assigned (e.g., for shared buffers).  The LWLock structures
@@ -46,14 +59,14 @@
  */
 typedef enum LWLockId
 {
-	BufFreelistLock,
+	BufFreelistLockUnused,		/* was BufFreelistLock, now a spinlock */
 	ShmemIndexLock,
 	OidGenLock,
 	XidGenLock,
 	ProcArrayLock,
 	SInvalReadLock,
 	SInvalWriteLock,
-	WALInsertLock,
+	WALBufMappingLock,
 	WALWriteLock,
 	ControlFileLock,
 	CheckpointLock,
@@ -77,6 +90,14 @@ typedef enum LWLockId
 #ifdef PGXC
 	BarrierLock,
 	NodeTableLock,
+#endif
+#ifdef ADB
+	AgtmBrokerLock,
+	PgStatDBLock,
+#endif
+#ifdef AGTM
+	AgtmSnapshotCacheLock,
+	AgtmSequenceCacheLock,
 #endif
 	RelationMappingLock,
 	AsyncCtlLock,
@@ -91,8 +112,15 @@ typedef enum LWLockId
 	FirstLockMgrLock = FirstBufMappingLock + NUM_BUFFER_PARTITIONS,
 	FirstPredicateLockMgrLock = FirstLockMgrLock + NUM_LOCK_PARTITIONS,
 
+#ifdef ADB
+	FirstPgStatLock = FirstPredicateLockMgrLock + NUM_PREDICATELOCK_PARTITIONS,
+
+	/* must be last except for MaxDynamicLWLock: */
+	NumFixedLWLocks = FirstPgStatLock + NUM_PGSTAT_PARTITIONS,
+#else
 	/* must be last except for MaxDynamicLWLock: */
 	NumFixedLWLocks = FirstPredicateLockMgrLock + NUM_PREDICATELOCK_PARTITIONS,
+#endif
 
 	MaxDynamicLWLock = 1000000000
 } LWLockId;
@@ -120,6 +148,13 @@ extern void LWLockRelease(LWLockId lockid);
 extern void LWLockReleaseAll(void);
 extern bool LWLockHeldByMe(LWLockId lockid);
 
+extern bool LWLockWaitForVar(LWLockId lockid, volatile uint64 *valptr,
+				 uint64 oldval, uint64 *newval);
+extern void LWLockUpdateVar(LWLockId lockid, volatile uint64 *valptr,
+				uint64 val);
+extern void LWLockReleaseClearVar(LWLockId lockid, volatile uint64 *valptr,
+					  uint64 val);
+
 extern int	NumLWLocks(void);
 extern Size LWLockShmemSize(void);
 extern void CreateLWLocks(void);
@@ -30,7 +30,16 @@
  * listed anywhere in the PGPROC array is not a running transaction.  Else we
  * have to look at pg_subtrans.
  */
+#if defined(AGTM)
+/*
+ * AGTM assigns the subtransaction xids of the sessions of the whole cluster,
+ * and a snapshot it hands out overflowed makes every node use pg_subtrans for
+ * its lifetime, so let its few backends cache more of them.
+ */
+#define PGPROC_MAX_CACHED_SUBXIDS 256
+#else
 #define PGPROC_MAX_CACHED_SUBXIDS 64	/* XXX guessed-at value */
+#endif
 
 struct XidCache
 {
@@ -47,12 +56,25 @@ struct XidCache
 #define		PROC_VACUUM_STATE_MASK (0x0E)
 
 /*
- * We allow a small number of "weak" relation locks (AccesShareLock,
+ * We allow a number of "weak" relation locks (AccesShareLock,
  * RowShareLock, RowExclusiveLock) to be recorded in the PGPROC structure
  * rather than the main lock table.  This eases contention on the lock
  * manager LWLocks.  See storage/lmgr/README for additional details.
+ *
+ * The slots are divided into groups of FP_LOCK_SLOTS_PER_GROUP, whose lock
+ * bits fit into one uint64, and a relation can only use the slots of the
+ * group its OID hashes to, so that looking it up stays cheap however many
+ * groups there are.  The number of groups is derived from
+ * max_locks_per_transaction at startup, so that queries touching many
+ * partitions or inheritance children need not spill into the shared lock
+ * table.
  */
-#define		FP_LOCK_SLOTS_PER_BACKEND 16
+#define		FP_LOCK_GROUPS_PER_BACKEND_MAX	1024
+#define		FP_LOCK_SLOTS_PER_GROUP			16	/* don't change */
+#define		FastPathLockSlotsPerBackend() \
+	(FP_LOCK_SLOTS_PER_GROUP * FastPathLockGroupsPerBackend)
+
+extern int	FastPathLockGroupsPerBackend;
 
 /*
  * Each backend has a PGPROC struct in shared memory.  There is also a list of
@@ -108,6 +130,10 @@ struct PGPROC
 	uint8		lwWaitMode;		/* lwlock mode being waited for */
 	struct PGPROC *lwWaitLink;	/* next waiter for same LW lock */
 
+#ifdef ADB
+	uint8		waitEvent;		/* WaitEvent being waited for, if any */
+#endif
+
 	/* Info about lock the process is currently waiting for, if any. */
 	/* waitLock and waitProcLock are NULL if not currently waiting. */
 	LOCK	   *waitLock;		/* Lock object we're sleeping on ... */
@@ -139,8 +165,9 @@ struct PGPROC
 	LWLockId	backendLock;	/* protects the fields below */
 
 	/* Lock manager data, recording fast-path locks taken by this backend. */
-	uint64		fpLockBits;		/* lock modes held for each fast-path slot */
-	Oid			fpRelId[FP_LOCK_SLOTS_PER_BACKEND];		/* slots for rel oids */
+	uint64	   *fpLockBits;		/* lock modes held for each fast-path slot,
+								 * one element per group */
+	Oid		   *fpRelId;		/* slots for rel oids */
 	bool		fpVXIDLock;		/* are we holding a fast-path VXID lock? */
 	LocalTransactionId fpLocalTransactionId;	/* lxid for fast-path VXID
 												 * lock */
@@ -46,8 +46,12 @@ extern int	GetMaxSnapshotXidCount(void);
 extern int	GetMaxSnapshotSubxidCount(void);
 
 extern Snapshot GetSnapshotData(Snapshot snapshot);
+#ifdef AGTM
+extern Snapshot GetAgtmSnapshotData(Snapshot snapshot);
+#endif /* AGTM */
 #ifdef ADB
 extern void EnlargeSnapshotXip(Snapshot snapshot, uint32 need_size);
+extern void EnlargeSnapshotSubxip(Snapshot snapshot, uint32 need_size);
 #endif /* ADB */
 
 extern bool ProcArrayInstallImportedXmin(TransactionId xmin,
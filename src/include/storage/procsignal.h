@@ -43,6 +43,10 @@ typedef enum
 #ifdef PGXC
 	PROCSIG_PGXCPOOL_RELOAD,	/* abort current transaction and reconnect to pooler */
 #endif
+#ifdef ADB
+	PROCSIG_MEMORY_CONTEXTS,	/* report the heaviest memory contexts */
+	PROCSIG_GLOBAL_DEADLOCK,	/* victim of a deadlock across nodes */
+#endif
 
 	/* Recovery conflict reasons */
 	PROCSIG_RECOVERY_CONFLICT_DATABASE,
@@ -0,0 +1,91 @@
+/*-------------------------------------------------------------------------
+ *
+ * seqlock.h
+ *	  Sequence counters for data in shared memory read without a lock.
+ *
+ *	A writer makes the counter odd before it changes the data and even
+ *	again once it is done.  A reader remembers the counter before it reads
+ *	the data and checks afterwards that the counter was even and did not
+ *	move; if it did, what was read may be torn and must be thrown away,
+ *	typically treating the lookup as a miss.  Readers thus never wait and
+ *	never make writers wait.
+ *
+ *	Writers of the same data are not serialized here; the caller holds a
+ *	spinlock or another lock around SeqLockWriteBegin() .. SeqLockWriteEnd().
+ *	Data read under the counter must be accessed through volatile pointers,
+ *	as for spinlocks, and a reader must be prepared for any value in it
+ *	until SeqLockReadRetry() said it is consistent.
+ *
+ *	void SeqLockWriteBegin(volatile uint32 *seq)
+ *	void SeqLockWriteEnd(volatile uint32 *seq)
+ *		Bracket a change of the data.
+ *
+ *	uint32 SeqLockReadBegin(volatile uint32 *seq)
+ *		Start reading the data, returns the counter to check it against.
+ *
+ *	bool SeqLockReadRetry(volatile uint32 *seq, uint32 start)
+ *		Finish reading the data, returns true if what was read since
+ *		SeqLockReadBegin() returned "start" cannot be used.
+ *
+ *	bool SeqLockWriting(uint32 start)
+ *		Tests whether a write was in progress at SeqLockReadBegin(), to give
+ *		up early.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/storage/seqlock.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include "storage/barrier.h"
+
+#define SeqLockWriting(start)	(((start) & 1) != 0)
+
+/*
+ * These should be inlined if possible.  See STATIC_IF_INLINE in c.h.
+ */
+#ifndef PG_USE_INLINE
+extern void SeqLockWriteBegin(volatile uint32 *seq);
+extern void SeqLockWriteEnd(volatile uint32 *seq);
+extern uint32 SeqLockReadBegin(volatile uint32 *seq);
+extern bool SeqLockReadRetry(volatile uint32 *seq, uint32 start);
+#endif   /* !PG_USE_INLINE */
+
+#if defined(PG_USE_INLINE) || defined(SEQLOCK_INCLUDE_DEFINITIONS)
+
+STATIC_IF_INLINE void
+SeqLockWriteBegin(volatile uint32 *seq)
+{
+	(*seq)++;
+	pg_write_barrier();
+}
+
+STATIC_IF_INLINE void
+SeqLockWriteEnd(volatile uint32 *seq)
+{
+	pg_write_barrier();
+	(*seq)++;
+}
+
+STATIC_IF_INLINE uint32
+SeqLockReadBegin(volatile uint32 *seq)
+{
+	uint32		start = *seq;
+
+	pg_read_barrier();
+	return start;
+}
+
+STATIC_IF_INLINE bool
+SeqLockReadRetry(volatile uint32 *seq, uint32 start)
+{
+	pg_read_barrier();
+	return SeqLockWriting(start) || *seq != start;
+}
+
+#endif   /* PG_USE_INLINE || SEQLOCK_INCLUDE_DEFINITIONS */
+
+#endif   /* SEQLOCK_H */
@@ -112,6 +112,43 @@ typedef union
 /* Counter of messages processed; don't worry about overflow. */
 extern uint64 SharedInvalidMessageCounter;
 
+#ifdef ADB
+/*
+ * What a backend that was reset has missed, as far as the queue can tell.
+ *
+ * Every message put into the queue leaves its number in a slot picked by
+ * the catcache ID and hash value, or by the relation OID, of the message.
+ * A backend which fell so far behind that its messages were dropped then
+ * only has to flush the entries whose slots were written since it last
+ * read the queue, instead of all of its caches.  Messages which cannot be
+ * attributed to a slot (catalog flushes, relcache messages without a
+ * relation) set "all" and the backend falls back to a full reset.
+ */
+#define SINVAL_SUMMARY_CACHES	128		/* catcache IDs are int8 */
+#define SINVAL_SUMMARY_BUCKETS	4096	/* must be a power of 2 */
+
+#define SharedInvalCatcacheBucket(cacheId, hashValue) \
+	(((uint32) (hashValue) ^ ((uint32) (cacheId) * 0x9E3779B1)) & \
+	 (SINVAL_SUMMARY_BUCKETS - 1))
+#define SharedInvalRelcacheBucket(relId) \
+	(((uint32) (relId) * 0x85EBCA6B) & (SINVAL_SUMMARY_BUCKETS - 1))
+
+typedef struct SharedInvalSummary
+{
+	bool		all;			/* must discard everything after all */
+	bool		relcache;		/* some relcache messages were missed */
+	bool		smgr;			/* some smgr messages were missed */
+	bool		relmap;			/* some relmap messages were missed */
+	bool		caches[SINVAL_SUMMARY_CACHES];	/* catcaches with missed messages */
+	uint8		buckets[SINVAL_SUMMARY_BUCKETS / 8];	/* bitmap of missed slots */
+} SharedInvalSummary;
+
+#define SharedInvalSummaryHasBucket(summary, bucket) \
+	(((summary)->buckets[(bucket) / 8] & (1 << ((bucket) % 8))) != 0)
+
+extern const SharedInvalSummary *SIGetResetSummary(void);
+#endif
+
 
 extern void SendSharedInvalidMessages(const SharedInvalidationMessage *msgs,
 						  int n);
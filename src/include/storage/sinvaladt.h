@@ -25,6 +25,10 @@
 #include "storage/lock.h"
 #include "storage/sinval.h"
 
+#ifdef ADB
+extern int sinval_queue_size;
+#endif
+
 /*
  * prototypes for functions in sinvaladt.c
  */
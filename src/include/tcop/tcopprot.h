@@ -48,6 +48,7 @@ extern int	log_statement;
 #ifdef ADB
 extern int parse_grammar;
 extern int current_grammar;
+extern uint32 CoordinatorQueryId;
 
 #define IsCurrentOracleGram() (current_grammar == PARSE_GRAM_ORACLE)
 #endif
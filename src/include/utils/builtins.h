@@ -319,6 +319,7 @@ extern Datum bttintervalcmp(PG_FUNCTION_ARGS);
 extern Datum btcharcmp(PG_FUNCTION_ARGS);
 extern Datum btnamecmp(PG_FUNCTION_ARGS);
 extern Datum bttextcmp(PG_FUNCTION_ARGS);
+extern Datum bttextsortsupport(PG_FUNCTION_ARGS);
 
 /*
  *		Per-opclass sort support functions for new btrees.  Like the
@@ -475,6 +476,11 @@ extern Datum pg_indexes_size(PG_FUNCTION_ARGS);
 extern Datum pg_relation_filenode(PG_FUNCTION_ARGS);
 extern Datum pg_relation_filepath(PG_FUNCTION_ARGS);
 
+#ifdef ADB
+/* checksumfuncs.c */
+extern Datum pg_relation_verify_checksums(PG_FUNCTION_ARGS);
+#endif
+
 /* genfile.c */
 extern bytea *read_binary_file(const char *filename,
 				 int64 seek_offset, int64 bytes_to_read);
@@ -500,6 +506,10 @@ extern Datum pg_typeof(PG_FUNCTION_ARGS);
 extern Datum pg_collation_for(PG_FUNCTION_ARGS);
 extern Datum pg_relation_is_updatable(PG_FUNCTION_ARGS);
 extern Datum pg_column_is_updatable(PG_FUNCTION_ARGS);
+#ifdef ADB
+extern Datum pg_backend_cache_usage(PG_FUNCTION_ARGS);
+extern Datum pg_backend_memory_contexts(PG_FUNCTION_ARGS);
+#endif
 
 /* oid.c */
 extern Datum oidin(PG_FUNCTION_ARGS);
@@ -551,6 +561,14 @@ extern Datum void_send(PG_FUNCTION_ARGS);
 #ifdef PGXC
 extern Datum pgxc_node_str (PG_FUNCTION_ARGS);
 extern Datum pgxc_lock_for_backup (PG_FUNCTION_ARGS);
+#ifdef ADB
+extern Datum pg_stat_get_remote_connections(PG_FUNCTION_ARGS);
+extern Datum pgxc_bucket_of(PG_FUNCTION_ARGS);
+extern Datum pgxc_redistribute_buckets(PG_FUNCTION_ARGS);
+extern Datum pgxc_redist_pull_buckets(PG_FUNCTION_ARGS);
+extern Datum pgxc_node_index_of(PG_FUNCTION_ARGS);
+extern Datum pgxc_distribution_values(PG_FUNCTION_ARGS);
+#endif
 #endif
 extern Datum trigger_in(PG_FUNCTION_ARGS);
 extern Datum trigger_out(PG_FUNCTION_ARGS);
@@ -841,6 +859,7 @@ extern Datum unknownrecv(PG_FUNCTION_ARGS);
 extern Datum unknownsend(PG_FUNCTION_ARGS);
 
 extern Datum pg_column_size(PG_FUNCTION_ARGS);
+extern Datum pg_column_compression(PG_FUNCTION_ARGS);
 
 extern Datum bytea_string_agg_transfn(PG_FUNCTION_ARGS);
 extern Datum bytea_string_agg_finalfn(PG_FUNCTION_ARGS);
@@ -957,6 +976,10 @@ extern Datum ora_numtoyminterval(PG_FUNCTION_ARGS);
 extern Datum ora_numtodsinterval(PG_FUNCTION_ARGS);
 extern Datum ora_to_yminterval(PG_FUNCTION_ARGS);
 extern Datum ora_to_dsinterval(PG_FUNCTION_ARGS);
+extern Datum ora_add_months_tz(PG_FUNCTION_ARGS);
+extern Datum ora_last_day_tz(PG_FUNCTION_ARGS);
+extern Datum ora_months_between_tz(PG_FUNCTION_ARGS);
+extern Datum ora_next_day_tz(PG_FUNCTION_ARGS);
 
 /* others.c */
 extern Datum ora_lnnvl(PG_FUNCTION_ARGS);
@@ -966,6 +989,7 @@ extern Datum ora_nvl2(PG_FUNCTION_ARGS);
 extern Datum ora_set_nls_sort(PG_FUNCTION_ARGS);
 extern Datum ora_nlssort(PG_FUNCTION_ARGS);
 extern Datum ora_dump(PG_FUNCTION_ARGS);
+extern Datum ora_nanvl(PG_FUNCTION_ARGS);
 
 /* convert.c */
 extern Datum int4_tochar(PG_FUNCTION_ARGS);
@@ -1185,6 +1209,8 @@ extern Datum int8_sum_to_int8(PG_FUNCTION_ARGS);
 #endif
 extern Datum int2_avg_accum(PG_FUNCTION_ARGS);
 extern Datum int4_avg_accum(PG_FUNCTION_ARGS);
+extern Datum int2_avg_accum_inv(PG_FUNCTION_ARGS);
+extern Datum int4_avg_accum_inv(PG_FUNCTION_ARGS);
 #ifdef PGXC
 extern Datum int8_avg_collect(PG_FUNCTION_ARGS);
 #endif
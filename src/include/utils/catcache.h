@@ -83,6 +83,15 @@ typedef struct catctup
 	 */
 	dlist_node	cache_elem;		/* list member of per-bucket list */
 
+#ifdef ADB
+	/*
+	 * All tuples of all caches are also kept in one dlist in LRU order, from
+	 * whose tail unreferenced entries are evicted once the caches grow
+	 * beyond catalog_cache_memory_limit.
+	 */
+	dlist_node	lru_elem;		/* list member of global LRU list */
+#endif
+
 	/*
 	 * The tuple may also be a member of at most one CatCList.  (If a single
 	 * catcache is list-searched with varying numbers of keys, we may have to
@@ -155,8 +164,20 @@ typedef struct catcacheheader
 {
 	slist_head	ch_caches;		/* head of list of CatCache structs */
 	int			ch_ntup;		/* # of tuples in all caches */
+#ifdef ADB
+	dlist_head	ch_lrulist;		/* all tuples, most recently used first */
+	Size		ch_size;		/* approximate memory used by all tuples */
+	long		ch_hits;		/* # of searches satisfied from the caches */
+	long		ch_misses;		/* # of searches that read a catalog */
+	long		ch_evictions;	/* # of tuples evicted to stay in the limit */
+#endif
 } CatCacheHeader;
 
+#ifdef ADB
+/* GUC variable: memory limit of all catalog caches, in kB, 0 for none */
+extern int	catalog_cache_memory_limit;
+#endif
+
 
 /* this extern duplicates utils/memutils.h... */
 extern PGDLLIMPORT MemoryContext CacheMemoryContext;
@@ -191,6 +212,14 @@ extern void PrepareToInvalidateCacheTuple(Relation relation,
 							  HeapTuple newtuple,
 							  void (*function) (int, uint32, Oid));
 
+#ifdef ADB
+extern void CatalogCacheGetUsage(int64 *entries, int64 *size, int64 *hits,
+					 int64 *misses, int64 *evictions);
+struct SharedInvalSummary;
+extern void CatalogCacheIdInvalidateSummary(int cacheId,
+								const struct SharedInvalSummary *summary);
+#endif
+
 extern void PrintCatCacheLeakWarning(HeapTuple tuple);
 extern void PrintCatCacheListLeakWarning(CatCList *list);
 
@@ -0,0 +1,84 @@
+/*-------------------------------------------------------------------------
+ *
+ * hyperloglog.h
+ *
+ *	  HyperLogLog sketches for approximate distinct counting
+ *
+ * A sketch of precision p has m = 2^p registers.  A value is hashed to 64
+ * bits; the first p bits choose a register, which keeps the highest rank
+ * (position of the first 1 bit) seen among the remaining bits.  The
+ * relative standard error of the estimate is about 1.04 / sqrt(m), 0.8%
+ * at the default precision of 14.
+ *
+ * A sketch starts sparse, as a sorted array of (register << 6 | rank)
+ * entries of its non-zero registers, and is made dense, one byte per
+ * register, once the entries would take more than a sixteenth of the
+ * registers.  Sketches of the same precision are merged by keeping the
+ * highest rank of each register, which makes them partial states that
+ * datanodes compute and the coordinator combines.
+ *
+ * The text and binary forms are the same bytes, shown in hex in the text
+ * form: the version, the precision and the format, then either the
+ * entries in network byte order or the registers.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/utils/hyperloglog.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef HYPERLOGLOG_H
+#define HYPERLOGLOG_H
+
+#include "fmgr.h"
+
+#define HLL_VERSION				1
+#define HLL_MIN_PRECISION		4
+#define HLL_MAX_PRECISION		18
+#define HLL_DEFAULT_PRECISION	14
+
+#define HLL_FORMAT_SPARSE		0
+#define HLL_FORMAT_DENSE		1
+
+#define HLL_RANK_BITS			6
+#define HLL_RANK_MASK			((1 << HLL_RANK_BITS) - 1)
+
+typedef struct HyperLogLog
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	uint8		version;
+	uint8		precision;
+	uint8		format;			/* HLL_FORMAT_SPARSE or HLL_FORMAT_DENSE */
+	uint8		padding;
+	uint32		nentries;		/* entries in use, if sparse */
+	uint32		data[1];		/* VARIABLE LENGTH: entries or registers */
+} HyperLogLog;
+
+#define HLL_HDRSZ				offsetof(HyperLogLog, data)
+#define HLL_REGISTERS(hll)		(1 << (hll)->precision)
+#define HLL_ENTRIES(hll)		((hll)->data)
+#define HLL_DENSE_DATA(hll)		((uint8 *) (hll)->data)
+/* room for entries of a sparse sketch, which may exceed nentries */
+#define HLL_CAPACITY(hll)		((VARSIZE(hll) - HLL_HDRSZ) / sizeof(uint32))
+/* most entries of a sparse sketch before it is made dense */
+#define HLL_SPARSE_LIMIT(hll)	(HLL_REGISTERS(hll) / 16)
+
+#define DatumGetHyperLogLog(d)	((HyperLogLog *) PG_DETOAST_DATUM(d))
+#define PG_GETARG_HLL(x)		DatumGetHyperLogLog(PG_GETARG_DATUM(x))
+#define PG_RETURN_HLL(x)		PG_RETURN_POINTER(x)
+
+extern HyperLogLog *HyperLogLogCreate(int precision);
+extern HyperLogLog *HyperLogLogAddHash(HyperLogLog *hll, uint64 hash);
+extern HyperLogLog *HyperLogLogUnion(HyperLogLog *hll, HyperLogLog *other,
+				 bool inplace);
+extern double HyperLogLogEstimate(HyperLogLog *hll);
+
+extern Datum hll_in(PG_FUNCTION_ARGS);
+extern Datum hll_out(PG_FUNCTION_ARGS);
+extern Datum hll_recv(PG_FUNCTION_ARGS);
+extern Datum hll_send(PG_FUNCTION_ARGS);
+extern Datum hll_add_trans(PG_FUNCTION_ARGS);
+extern Datum hll_union(PG_FUNCTION_ARGS);
+extern Datum hll_cardinality(PG_FUNCTION_ARGS);
+
+#endif   /* HYPERLOGLOG_H */
@@ -63,6 +63,9 @@ extern void CacheRegisterRelcacheCallback(RelcacheCallbackFunction func,
 							  Datum arg);
 
 extern void CallSyscacheCallbacks(int cacheid, uint32 hashvalue);
+#ifdef ADB
+extern bool InvalidationsPending(void);
+#endif
 
 extern void inval_twophase_postcommit(TransactionId xid, uint16 info,
 						  void *recdata, uint32 len);
@@ -0,0 +1,194 @@
+/*-------------------------------------------------------------------------
+ *
+ * jsonb.h
+ *	  Declarations for the jsonb data type, JSON stored pre-parsed.
+ *
+ * A jsonb datum is a varlena holding one container, an object or an
+ * array.  A scalar document is stored as an array of one element flagged
+ * JB_FSCALAR.  A container is a uint32 header, the count of its elements
+ * and its kind, followed by one JEntry per child and by the data of the
+ * children.  An object has 2 * count children, all its keys first and
+ * then its values in the same order, the keys being sorted by length and
+ * then bytewise so that a key is found by binary search.
+ *
+ * A JEntry holds the type of the child and the offset just past its data,
+ * relative to the start of the data area; a child begins where the
+ * previous one ends, INTALIGN'd for numerics and nested containers.
+ * Strings are stored without terminator, numerics as complete varlenas,
+ * and booleans and nulls only in their JEntry.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/utils/jsonb.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef JSONB_H
+#define JSONB_H
+
+#include "fmgr.h"
+#include "lib/stringinfo.h"
+#include "utils/numeric.h"
+
+/* Strategy numbers of the GIN operator class jsonb_ops */
+#define JsonbContainsStrategyNumber		7
+#define JsonbExistsStrategyNumber		9
+#define JsonbExistsAnyStrategyNumber	10
+#define JsonbExistsAllStrategyNumber	11
+
+typedef uint32 JEntry;
+
+#define JENTRY_OFFMASK			0x0FFFFFFF
+#define JENTRY_TYPEMASK			0x70000000
+
+#define JENTRY_ISSTRING			0x00000000
+#define JENTRY_ISNUMERIC		0x10000000
+#define JENTRY_ISBOOL_FALSE		0x20000000
+#define JENTRY_ISBOOL_TRUE		0x30000000
+#define JENTRY_ISNULL			0x40000000
+#define JENTRY_ISCONTAINER		0x50000000
+
+#define JBE_ENDPOS(je_)			((je_) & JENTRY_OFFMASK)
+#define JBE_TYPE(je_)			((je_) & JENTRY_TYPEMASK)
+
+typedef struct JsonbContainer
+{
+	uint32		header;			/* count of elements or pairs, and flags */
+	JEntry		children[1];	/* VARIABLE LENGTH */
+} JsonbContainer;
+
+#define JB_CMASK				0x0FFFFFFF
+#define JB_FSCALAR				0x10000000
+#define JB_FOBJECT				0x20000000
+#define JB_FARRAY				0x40000000
+
+#define JsonContainerSize(jc)		((jc)->header & JB_CMASK)
+#define JsonContainerIsScalar(jc)	(((jc)->header & JB_FSCALAR) != 0)
+#define JsonContainerIsObject(jc)	(((jc)->header & JB_FOBJECT) != 0)
+#define JsonContainerIsArray(jc)	(((jc)->header & JB_FARRAY) != 0)
+
+/* The varlena form of a jsonb datum */
+typedef struct
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	JsonbContainer root;
+} Jsonb;
+
+#define DatumGetJsonb(d)	((Jsonb *) PG_DETOAST_DATUM(d))
+#define JsonbGetDatum(p)	PointerGetDatum(p)
+#define PG_GETARG_JSONB(x)	DatumGetJsonb(PG_GETARG_DATUM(x))
+#define PG_RETURN_JSONB(x)	PG_RETURN_POINTER(x)
+
+#define JB_ROOT_COUNT(jbp_)		JsonContainerSize(&(jbp_)->root)
+#define JB_ROOT_IS_SCALAR(jbp_)	JsonContainerIsScalar(&(jbp_)->root)
+#define JB_ROOT_IS_OBJECT(jbp_)	JsonContainerIsObject(&(jbp_)->root)
+#define JB_ROOT_IS_ARRAY(jbp_)	JsonContainerIsArray(&(jbp_)->root)
+
+/*
+ * In-memory, deserialized form of a JSON value.  jbvBinary points into a
+ * serialized container instead of having been expanded.
+ */
+typedef enum
+{
+	jbvNull,
+	jbvString,
+	jbvNumeric,
+	jbvBool,
+	jbvArray,
+	jbvObject,
+	jbvBinary
+} JsonbValueType;
+
+typedef struct JsonbValue JsonbValue;
+typedef struct JsonbPair JsonbPair;
+
+struct JsonbValue
+{
+	JsonbValueType type;
+
+	union
+	{
+		Numeric		numeric;
+		bool		boolean;
+		struct
+		{
+			int			len;
+			char	   *val;	/* not necessarily null-terminated */
+		}			string;
+		struct
+		{
+			int			nElems;
+			JsonbValue *elems;
+			bool		rawScalar;	/* top-level scalar document */
+		}			array;
+		struct
+		{
+			int			nPairs;
+			JsonbPair  *pairs;
+		}			object;
+		struct
+		{
+			int			len;
+			JsonbContainer *data;
+		}			binary;
+	}			val;
+};
+
+struct JsonbPair
+{
+	JsonbValue	key;			/* always a jbvString */
+	JsonbValue	value;
+	uint32		order;			/* position in the input, last one wins */
+};
+
+#define IsAJsonbScalar(jsonbval)	((jsonbval)->type >= jbvNull && \
+									 (jsonbval)->type <= jbvBool)
+
+/* functions in jsonb_util.c */
+extern Jsonb *JsonbValueToJsonb(JsonbValue *val);
+extern void JsonbUniquifyObject(JsonbValue *object);
+extern void JsonbContainerGetChild(JsonbContainer *container, int index,
+					   JsonbValue *result);
+extern bool JsonbFindObjectKey(JsonbContainer *container,
+				   const char *key, int keylen, JsonbValue *result);
+extern bool JsonbFindArrayString(JsonbContainer *container,
+					 const char *str, int len);
+extern int	JsonbCompareContainers(JsonbContainer *a, JsonbContainer *b);
+extern bool JsonbDeepContains(JsonbContainer *val, JsonbContainer *tmpl);
+extern uint32 JsonbHashContainer(JsonbContainer *container);
+extern void JsonbValueToCString(StringInfo out, JsonbValue *val);
+extern void JsonbToCString(StringInfo out, JsonbContainer *container);
+
+/* functions in jsonb.c */
+extern Datum jsonb_in(PG_FUNCTION_ARGS);
+extern Datum jsonb_out(PG_FUNCTION_ARGS);
+extern Datum jsonb_recv(PG_FUNCTION_ARGS);
+extern Datum jsonb_send(PG_FUNCTION_ARGS);
+extern Datum jsonb_typeof(PG_FUNCTION_ARGS);
+extern Datum jsonb_object_field(PG_FUNCTION_ARGS);
+extern Datum jsonb_object_field_text(PG_FUNCTION_ARGS);
+extern Datum jsonb_array_element(PG_FUNCTION_ARGS);
+extern Datum jsonb_array_element_text(PG_FUNCTION_ARGS);
+
+/* functions in jsonb_op.c */
+extern Datum jsonb_exists(PG_FUNCTION_ARGS);
+extern Datum jsonb_exists_any(PG_FUNCTION_ARGS);
+extern Datum jsonb_exists_all(PG_FUNCTION_ARGS);
+extern Datum jsonb_contains(PG_FUNCTION_ARGS);
+extern Datum jsonb_contained(PG_FUNCTION_ARGS);
+extern Datum jsonb_eq(PG_FUNCTION_ARGS);
+extern Datum jsonb_ne(PG_FUNCTION_ARGS);
+extern Datum jsonb_lt(PG_FUNCTION_ARGS);
+extern Datum jsonb_gt(PG_FUNCTION_ARGS);
+extern Datum jsonb_le(PG_FUNCTION_ARGS);
+extern Datum jsonb_ge(PG_FUNCTION_ARGS);
+extern Datum jsonb_cmp(PG_FUNCTION_ARGS);
+extern Datum jsonb_hash(PG_FUNCTION_ARGS);
+
+/* functions in jsonb_gin.c */
+extern Datum gin_compare_jsonb(PG_FUNCTION_ARGS);
+extern Datum gin_extract_jsonb(PG_FUNCTION_ARGS);
+extern Datum gin_extract_jsonb_query(PG_FUNCTION_ARGS);
+extern Datum gin_consistent_jsonb(PG_FUNCTION_ARGS);
+
+#endif   /* JSONB_H */
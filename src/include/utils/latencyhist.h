@@ -0,0 +1,41 @@
+/*-------------------------------------------------------------------------
+ *
+ * latencyhist.h
+ *
+ *	  Fixed size, log-linear histograms of latencies
+ *
+ * A histogram is an array of LATENCY_HIST_BUCKETS counters of durations in
+ * microseconds.  Below LATENCY_HIST_SUB microseconds there is one bucket
+ * per microsecond; above, each power of two is split into LATENCY_HIST_SUB
+ * buckets of equal width, so that a bucket is never wider than a quarter
+ * of its lower bound.  The last bucket also counts everything above it,
+ * that is beyond about 268 seconds.
+ *
+ * Histograms of the same layout are merged by adding their counters, so
+ * the int8[] form the SQL functions use can be summed across nodes.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/utils/latencyhist.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef LATENCYHIST_H
+#define LATENCYHIST_H
+
+#include "fmgr.h"
+#include "utils/array.h"
+
+#define LATENCY_HIST_SUB_BITS	2
+#define LATENCY_HIST_SUB		(1 << LATENCY_HIST_SUB_BITS)
+#define LATENCY_HIST_BUCKETS	108
+
+extern int	LatencyHistBucket(uint64 usec);
+extern double LatencyHistPercentile(const int64 *counts, int nbuckets,
+					  double fraction);
+extern ArrayType *LatencyHistGetArray(const int64 *counts);
+
+extern Datum latency_percentile(PG_FUNCTION_ARGS);
+extern Datum latency_histogram_add(PG_FUNCTION_ARGS);
+
+#endif   /* LATENCYHIST_H */
@@ -0,0 +1,37 @@
+/*-------------------------------------------------------------------------
+ *
+ * mcxtreport.h
+ *
+ *	  Reports of the heaviest memory contexts of a backend
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/utils/mcxtreport.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef MCXTREPORT_H
+#define MCXTREPORT_H
+
+/* Contexts reported per backend */
+#define MEMORY_CONTEXT_REPORT_SIZE	16
+
+typedef struct MemoryContextReportEntry
+{
+	char		name[NAMEDATALEN];
+	char		parent[NAMEDATALEN];	/* empty for a top-level context */
+	int			level;			/* depth below TopMemoryContext */
+	Size		bytes;			/* malloc'd for the context itself */
+	Size		total_bytes;	/* the same, plus all its descendants */
+} MemoryContextReportEntry;
+
+extern volatile bool MemoryContextReportPending;
+
+extern Size MemoryContextReportShmemSize(void);
+extern void MemoryContextReportShmemInit(void);
+
+extern void HandleMemoryContextReportInterrupt(void);
+extern void ProcessMemoryContextReport(void);
+extern int	GetBackendMemoryContexts(int pid, MemoryContextReportEntry *entries);
+
+#endif   /* MCXTREPORT_H */
@@ -116,6 +116,24 @@ extern MemoryContext MemoryContextCreate(NodeTag tag, Size size,
 					MemoryContext parent,
 					const char *name);
 
+/*
+ * Context types call these for every block they get from malloc() or give
+ * back, the bytes are added to the context and to all its ancestors.
+ * MemoryContextAccountAlloc() is called before the malloc() and throws an
+ * error when the current query would go beyond query_mem_limit.
+ */
+#ifdef ADB
+extern int	query_mem_limit;
+
+extern void MemoryContextAccountAlloc(MemoryContext context, Size size);
+extern void MemoryContextAccountFree(MemoryContext context, Size size);
+extern void MemoryContextQueryStart(void);
+extern void MemoryContextQueryEnd(void);
+#else
+#define MemoryContextAccountAlloc(context, size)	((void) (size))
+#define MemoryContextAccountFree(context, size)	((void) (size))
+#endif
+
 
 /*
  * Memory-context-type-specific functions
@@ -128,6 +146,12 @@ extern MemoryContext AllocSetContextCreate(MemoryContext parent,
 					  Size initBlockSize,
 					  Size maxBlockSize);
 
+/* bump.c */
+extern MemoryContext BumpContextCreate(MemoryContext parent,
+				  const char *name,
+				  Size initBlockSize,
+				  Size maxBlockSize);
+
 /*
  * Recommended default alloc parameters, suitable for "ordinary" contexts
  * that might hold quite a lot of data.
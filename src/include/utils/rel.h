@@ -72,6 +72,16 @@ typedef struct RelationAmInfo
  * Here are the contents of a relation cache entry.
  */
 
+/*
+ * State of the adaptive free-space reservation of a heap, see hio.c
+ */
+typedef struct RelationHotTuning
+{
+	int			reserve;		/* extra bytes to keep free on each page */
+	int			attempts;		/* HOT-eligible updates in current window */
+	int			misses;			/* ... of which went onto another page */
+} RelationHotTuning;
+
 typedef struct RelationData
 {
 	RelFileNode rd_node;		/* relation physical identifier */
@@ -179,11 +189,22 @@ typedef struct RelationData
 	 */
 	Oid			rd_toastoid;	/* Real TOAST table's OID, or InvalidOid */
 
+	/*
+	 * Outcome of recent HOT-eligible updates, and the extra free space we
+	 * leave on heap pages because of them, for the autotune_fillfactor
+	 * option.  This is local to the backend; see RelationRecordHotUpdate.
+	 */
+	RelationHotTuning rd_hottuning;
+
 	/* use "struct" here to avoid needing to include pgstat.h: */
 	struct PgStat_TableStatus *pgstat_info;		/* statistics collection area */
 #ifdef PGXC
 	RelationLocInfo *rd_locator_info;
 #endif
+#ifdef ADB
+	Size		rd_cachesize;	/* memory accounted for this entry */
+	uint64		rd_lastused;	/* relcache clock when last opened */
+#endif
 } RelationData;
 
 /*
@@ -233,6 +254,7 @@ typedef struct StdRdOptions
 	AutoVacOpts autovacuum;		/* autovacuum-related options */
 	bool		security_barrier;		/* for views */
 	AutoVacOpts2 autovacuum2;	/* rest of autovacuum options */
+	bool		autotune_fillfactor;	/* adapt free space to HOT misses */
 } StdRdOptions;
 
 #define HEAP_MIN_FILLFACTOR			10
@@ -260,6 +282,15 @@ typedef struct StdRdOptions
 #define RelationGetTargetPageFreeSpace(relation, defaultff) \
 	(BLCKSZ * (100 - RelationGetFillFactor(relation, defaultff)) / 100)
 
+/*
+ * RelationAutotuneFillfactor
+ *		Returns whether the free space kept on the relation's pages adapts
+ *		to how often its updates fail to stay on the same page.
+ */
+#define RelationAutotuneFillfactor(relation) \
+	((relation)->rd_options ? \
+	 ((StdRdOptions *) (relation)->rd_options)->autotune_fillfactor : false)
+
 /*
  * RelationIsSecurityView
  *		Returns whether the relation is security view, or not
@@ -102,6 +102,13 @@ extern void AtEOXact_RelationCache(bool isCommit);
 extern void AtEOSubXact_RelationCache(bool isCommit, SubTransactionId mySubid,
 						  SubTransactionId parentSubid);
 
+#ifdef ADB
+extern void RelationCacheGetUsage(int64 *entries, int64 *size, int64 *hits,
+					  int64 *misses, int64 *evictions);
+struct SharedInvalSummary;
+extern void RelationCacheInvalidateSummary(const struct SharedInvalSummary *summary);
+#endif
+
 /*
  * Routines to help manage rebuilding of relcache init files
  */
@@ -116,4 +123,9 @@ extern bool criticalRelcachesBuilt;
 /* should be used only by relcache.c and postinit.c */
 extern bool criticalSharedRelcachesBuilt;
 
+#ifdef ADB
+/* GUC variable: memory limit of the relation cache, in kB, 0 for none */
+extern int	relation_cache_memory_limit;
+#endif
+
 #endif   /* RELCACHE_H */
@@ -0,0 +1,35 @@
+/*-------------------------------------------------------------------------
+ *
+ * sharedcatcache.h
+ *
+ *	  Catalog tuples shared by the catalog caches of all backends
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/utils/sharedcatcache.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef SHAREDCATCACHE_H
+#define SHAREDCATCACHE_H
+
+#include "access/htup.h"
+#include "storage/sinval.h"
+
+/* Largest catalog tuple kept in a slot */
+#define SHARED_CATCACHE_TUPLE_SIZE	1024
+
+extern int shared_catcache_size;
+
+extern Size SharedCatCacheShmemSize(void);
+extern void SharedCatCacheShmemInit(void);
+
+extern bool SharedCatCacheActive(void);
+extern uint32 SharedCatCacheGeneration(void);
+extern HeapTuple SharedCatCacheLookup(Oid dbid, int cacheId, uint32 hashValue);
+extern void SharedCatCacheStore(Oid dbid, int cacheId, uint32 hashValue,
+					HeapTuple tuple, uint32 generation);
+extern void SharedCatCacheInvalidateMessages(const SharedInvalidationMessage *msgs,
+								 int n);
+
+#endif   /* SHAREDCATCACHE_H */
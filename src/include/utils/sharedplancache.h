@@ -0,0 +1,40 @@
+/*-------------------------------------------------------------------------
+ *
+ * sharedplancache.h
+ *
+ *	  Analyzed and rewritten prepared statements shared by all backends
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/utils/sharedplancache.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef SHAREDPLANCACHE_H
+#define SHAREDPLANCACHE_H
+
+#include "nodes/parsenodes.h"
+#include "storage/sinval.h"
+
+/* Largest key plus statement kept in a slot */
+#define SHARED_PLAN_CACHE_ENTRY_SIZE	16384
+
+extern int shared_plan_cache_size;
+
+extern Size SharedPlanCacheShmemSize(void);
+extern void SharedPlanCacheShmemInit(void);
+
+extern bool SharedPlanCacheActive(void);
+extern uint32 SharedPlanCacheGeneration(void);
+extern List *SharedPlanCacheLookup(const char *query_string,
+					  ParseGrammar grammar,
+					  Oid **paramTypes, int *numParams);
+extern void SharedPlanCacheStore(const char *query_string,
+					 ParseGrammar grammar,
+					 Oid *origParamTypes, int origNumParams,
+					 Oid *paramTypes, int numParams,
+					 List *querytree_list, uint32 generation);
+extern void SharedPlanCacheInvalidateMessages(const SharedInvalidationMessage *msgs,
+								  int n);
+
+#endif   /* SHAREDPLANCACHE_H */
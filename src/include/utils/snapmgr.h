@@ -56,6 +56,8 @@ extern bool ThereAreNoPriorRegisteredSnapshots(void);
 extern void SetGlobalSnapshot(StringInfo input_message);
 extern void UnsetGlobalSnapshot(void);
 extern Snapshot GetGlobalSnapshot(Snapshot snapshot);
+extern Datum pg_export_global_snapshot(PG_FUNCTION_ARGS);
+extern char *GlobalSnapshotToken(Snapshot snapshot);
 #endif
 
 #endif   /* SNAPMGR_H */
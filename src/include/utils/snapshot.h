@@ -65,7 +65,17 @@ typedef struct SnapshotData
 	uint32		regd_count;		/* refcount on RegisteredSnapshotList */
 #ifdef ADB
 	uint32		max_xcnt;		/* alloced xip size */
+	uint32		max_subxcnt;	/* alloced subxip size */
+	struct SnapshotXidArray *shared_xids;	/* xip and subxip of a copied
+											 * snapshot, shared with its
+											 * copies */
 #endif /* ADB */
+
+	/*
+	 * ProcArray xactCompletionCount this snapshot was built at, so that
+	 * GetSnapshotData can hand it out again unchanged; zero if not reusable.
+	 */
+	uint64		snapXactCompletionCount;
 } SnapshotData;
 
 /*
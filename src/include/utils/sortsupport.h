@@ -68,6 +68,13 @@ typedef struct SortSupportData
 	bool		ssup_reverse;	/* descending-order sort? */
 	bool		ssup_nulls_first;		/* sort nulls first? */
 
+	/*
+	 * Set by the caller before BTSORTSUPPORT when it can keep the result of
+	 * abbrev_converter in place of the original datum and resolve ties with
+	 * abbrev_full_comparator.  The opclass is free to ignore it.
+	 */
+	bool		abbreviate;
+
 	/*
 	 * These fields are workspace for callers, and should not be touched by
 	 * opclass-specific functions.
@@ -95,6 +102,16 @@ typedef struct SortSupportData
 	 */
 	int			(*comparator) (Datum x, Datum y, SortSupport ssup);
 
+	/*
+	 * Abbreviated keys, set together only when the caller asked for them.
+	 * abbrev_converter turns an original datum into a pass-by-value key
+	 * whose order, compared by the comparator above, never contradicts the
+	 * order of the originals; equal keys say nothing, and the caller then
+	 * compares the originals with abbrev_full_comparator.
+	 */
+	Datum		(*abbrev_converter) (Datum original, SortSupport ssup);
+	int			(*abbrev_full_comparator) (Datum x, Datum y, SortSupport ssup);
+
 	/*
 	 * Additional sort-acceleration functions might be added here later.
 	 */
@@ -109,6 +126,9 @@ typedef struct SortSupportData
 extern int ApplySortComparator(Datum datum1, bool isNull1,
 					Datum datum2, bool isNull2,
 					SortSupport ssup);
+extern int ApplySortAbbrevFullComparator(Datum datum1, bool isNull1,
+							  Datum datum2, bool isNull2,
+							  SortSupport ssup);
 #endif   /* !PG_USE_INLINE */
 #if defined(PG_USE_INLINE) || defined(SORTSUPPORT_INCLUDE_DEFINITIONS)
 /*
@@ -147,6 +167,43 @@ ApplySortComparator(Datum datum1, bool isNull1,
 
 	return compare;
 }
+
+/*
+ * ApplySortComparator for the original datums of an abbreviated key, with
+ * abbrev_full_comparator.
+ */
+STATIC_IF_INLINE int
+ApplySortAbbrevFullComparator(Datum datum1, bool isNull1,
+							  Datum datum2, bool isNull2,
+							  SortSupport ssup)
+{
+	int			compare;
+
+	if (isNull1)
+	{
+		if (isNull2)
+			compare = 0;		/* NULL "=" NULL */
+		else if (ssup->ssup_nulls_first)
+			compare = -1;		/* NULL "<" NOT_NULL */
+		else
+			compare = 1;		/* NULL ">" NOT_NULL */
+	}
+	else if (isNull2)
+	{
+		if (ssup->ssup_nulls_first)
+			compare = 1;		/* NOT_NULL ">" NULL */
+		else
+			compare = -1;		/* NOT_NULL "<" NULL */
+	}
+	else
+	{
+		compare = (*ssup->abbrev_full_comparator) (datum1, datum2, ssup);
+		if (ssup->ssup_reverse)
+			compare = -compare;
+	}
+
+	return compare;
+}
 #endif   /*-- PG_USE_INLINE || SORTSUPPORT_INCLUDE_DEFINITIONS */
 
 /* Other functions in utils/sort/sortsupport.c */
@@ -0,0 +1,54 @@
+/*-------------------------------------------------------------------------
+ *
+ * waitevent.h
+ *
+ *	  Reporting of what a backend is waiting for
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/include/utils/waitevent.h
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef WAITEVENT_H
+#define WAITEVENT_H
+
+/*
+ * Things a backend can be waiting for.  Keep WaitEventNames in waitevent.c
+ * in sync; the value is kept in a uint8 of PGPROC.
+ */
+typedef enum WaitEvent
+{
+	WAIT_EVENT_NONE = 0,
+	WAIT_EVENT_LWLOCK,			/* sleeping on an LWLock */
+	WAIT_EVENT_LOCK,			/* sleeping on a heavyweight lock */
+	WAIT_EVENT_AGTM_GXID,		/* AGTM, getting a global transaction id */
+	WAIT_EVENT_AGTM_SNAPSHOT,	/* AGTM, getting a global snapshot */
+	WAIT_EVENT_AGTM_TIMESTAMP,	/* AGTM, getting the global timestamp */
+	WAIT_EVENT_AGTM_SEQUENCE,	/* AGTM, any sequence operation */
+	WAIT_EVENT_AGTM_TRANSACTION,	/* AGTM, begin/prepare/commit/status */
+	WAIT_EVENT_POOLER_GET_CONNECTIONS,	/* pooler, handing out connections */
+	WAIT_EVENT_RXACT,			/* remote transaction manager */
+	WAIT_EVENT_REMOTE_RECEIVE,	/* waiting for data from remote nodes */
+	WAIT_EVENT_REMOTE_SEND,		/* flushing data to a remote node */
+	NUM_WAIT_EVENTS
+} WaitEvent;
+
+/* GUC parameter */
+extern bool track_wait_timing;
+
+extern Size WaitEventShmemSize(void);
+extern void WaitEventShmemInit(void);
+
+extern void pgstat_report_wait_start(WaitEvent event);
+extern void pgstat_report_wait_end(void);
+extern void pgstat_clear_wait_event(void);
+
+extern const char *GetWaitEventType(WaitEvent event);
+extern const char *GetWaitEventName(WaitEvent event);
+
+extern void WaitEventFlushCounts(bool force);
+extern void WaitEventResetCounts(void);
+extern void WaitEventGetCounts(WaitEvent event, uint64 *calls, uint64 *time);
+
+#endif   /* WAITEVENT_H */
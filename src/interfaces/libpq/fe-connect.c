@@ -3010,6 +3010,7 @@ closePGconn(PGconn *conn)
 										 * absent */
 	conn->asyncStatus = PGASYNC_IDLE;
 	pqClearAsyncResult(conn);	/* deallocate result */
+	pqFreeCommandQueue(conn);	/* and forget pipelined commands */
 	resetPQExpBuffer(&conn->errorMessage);
 #ifdef ADB
 	if(conn->addrlist)
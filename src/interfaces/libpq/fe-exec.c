@@ -39,7 +39,9 @@ char	   *const pgresStatus[] = {
 	"PGRES_NONFATAL_ERROR",
 	"PGRES_FATAL_ERROR",
 	"PGRES_COPY_BOTH",
-	"PGRES_SINGLE_TUPLE"
+	"PGRES_SINGLE_TUPLE",
+	"PGRES_PIPELINE_SYNC",
+	"PGRES_PIPELINE_ABORTED"
 };
 
 /*
@@ -67,6 +69,20 @@ static bool PQexecStart(PGconn *conn);
 static int PQsendDescribe(PGconn *conn, char desc_type,
 			   const char *desc_target);
 static int	check_field_number(const PGresult *res, int field_num);
+static PGcmdQueueEntry *pqAllocCmdQueueEntry(PGconn *conn);
+static void pqRecycleCmdQueueEntry(PGconn *conn, PGcmdQueueEntry *entry);
+static void pqAppendCmdQueueEntry(PGconn *conn, PGcmdQueueEntry *entry);
+static void pqCommandQueueAdvance(PGconn *conn);
+static void pqPipelineProcessQueue(PGconn *conn);
+static void pqRememberCommand(PGconn *conn, PGcmdQueueEntry *entry,
+				  PGQueryClass queryclass, const char *query);
+static int	pqPipelineFlush(PGconn *conn);
+
+/*
+ * In pipeline mode, the commands are only pushed to the server once this
+ * much is waiting in the output buffer, or when the application flushes.
+ */
+#define PIPELINE_FLUSH_THRESHOLD	65536
 
 
 /* ----------------
@@ -178,6 +194,7 @@ PQmakeEmptyPGresult(PGconn *conn, ExecStatusType status)
 			case PGRES_COPY_IN:
 			case PGRES_COPY_BOTH:
 			case PGRES_SINGLE_TUPLE:
+			case PGRES_PIPELINE_SYNC:
 				/* non-error cases */
 				break;
 			default:
@@ -1112,6 +1129,14 @@ PQsendQuery(PGconn *conn, const char *query)
 	if (!PQsendQueryStart(conn))
 		return 0;
 
+	/* a simple query has its own Sync, it cannot be pipelined */
+	if (conn->pipelineStatus != PQ_PIPELINE_OFF)
+	{
+		printfPQExpBuffer(&conn->errorMessage,
+				 libpq_gettext("PQsendQuery not allowed in pipeline mode\n"));
+		return 0;
+	}
+
 	/* check the argument */
 	if (!query)
 	{
@@ -1207,6 +1232,8 @@ PQsendPrepare(PGconn *conn,
 			  const char *stmtName, const char *query,
 			  int nParams, const Oid *paramTypes)
 {
+	PGcmdQueueEntry *entry = NULL;
+
 	if (!PQsendQueryStart(conn))
 		return 0;
 
@@ -1238,6 +1265,13 @@ PQsendPrepare(PGconn *conn,
 		return 0;
 	}
 
+	if (conn->pipelineStatus != PQ_PIPELINE_OFF)
+	{
+		entry = pqAllocCmdQueueEntry(conn);
+		if (entry == NULL)
+			return 0;			/* error msg already set */
+	}
+
 	/* construct the Parse message */
 	if (pqPutMsgStart('P', false, conn) < 0 ||
 		pqPuts(stmtName, conn) < 0 ||
@@ -1264,32 +1298,32 @@ PQsendPrepare(PGconn *conn,
 	if (pqPutMsgEnd(conn) < 0)
 		goto sendFailed;
 
-	/* construct the Sync message */
-	if (pqPutMsgStart('S', false, conn) < 0 ||
-		pqPutMsgEnd(conn) < 0)
+	/* construct the Sync message, unless pipelining */
+	if (conn->pipelineStatus == PQ_PIPELINE_OFF &&
+		(pqPutMsgStart('S', false, conn) < 0 ||
+		 pqPutMsgEnd(conn) < 0))
 		goto sendFailed;
 
-	/* remember we are doing just a Parse */
-	conn->queryclass = PGQUERY_PREPARE;
-
-	/* and remember the query text too, if possible */
-	/* if insufficient memory, last_query just winds up NULL */
-	if (conn->last_query)
-		free(conn->last_query);
-	conn->last_query = strdup(query);
+	/* remember we are doing just a Parse, and the query text too */
+	pqRememberCommand(conn, entry, PGQUERY_PREPARE, query);
 
 	/*
 	 * Give the data a push.  In nonblock mode, don't complain if we're unable
 	 * to send it all; PQgetResult() will do any additional flushing needed.
 	 */
-	if (pqFlush(conn) < 0)
+	if (pqPipelineFlush(conn) < 0)
 		goto sendFailed;
 
 	/* OK, it's launched! */
-	conn->asyncStatus = PGASYNC_BUSY;
+	if (entry)
+		pqAppendCmdQueueEntry(conn, entry);
+	else
+		conn->asyncStatus = PGASYNC_BUSY;
 	return 1;
 
 sendFailed:
+	if (entry)
+		pqRecycleCmdQueueEntry(conn, entry);
 	pqHandleSendFailure(conn);
 	return 0;
 }
@@ -1355,6 +1389,26 @@ PQsendQueryStart(PGconn *conn)
 						  libpq_gettext("no connection to the server\n"));
 		return false;
 	}
+
+	/*
+	 * In pipeline mode the command is queued behind those whose results are
+	 * still to come, and the result-accumulation state is theirs: it is
+	 * initialized when the queue gets to the command.  Only COPY cannot be
+	 * queued behind.
+	 */
+	if (conn->pipelineStatus != PQ_PIPELINE_OFF)
+	{
+		if (conn->asyncStatus == PGASYNC_COPY_IN ||
+			conn->asyncStatus == PGASYNC_COPY_OUT ||
+			conn->asyncStatus == PGASYNC_COPY_BOTH)
+		{
+			printfPQExpBuffer(&conn->errorMessage,
+					 libpq_gettext("cannot queue commands during COPY\n"));
+			return false;
+		}
+		return true;
+	}
+
 	/* Can't send while already busy, either. */
 	if (conn->asyncStatus != PGASYNC_IDLE)
 	{
@@ -1392,6 +1446,7 @@ PQsendQueryGuts(PGconn *conn,
 				const int *paramFormats,
 				int resultFormat)
 {
+	PGcmdQueueEntry *entry = NULL;
 	int			i;
 
 	/* This isn't gonna work on a 2.0 server */
@@ -1402,9 +1457,17 @@ PQsendQueryGuts(PGconn *conn,
 		return 0;
 	}
 
+	if (conn->pipelineStatus != PQ_PIPELINE_OFF)
+	{
+		entry = pqAllocCmdQueueEntry(conn);
+		if (entry == NULL)
+			return 0;			/* error msg already set */
+	}
+
 	/*
 	 * We will send Parse (if needed), Bind, Describe Portal, Execute, Sync,
-	 * using specified statement name and the unnamed portal.
+	 * using specified statement name and the unnamed portal.  In pipeline
+	 * mode the Sync is left to PQpipelineSync.
 	 */
 
 	if (command)
@@ -1514,35 +1577,32 @@ PQsendQueryGuts(PGconn *conn,
 		pqPutMsgEnd(conn) < 0)
 		goto sendFailed;
 
-	/* construct the Sync message */
-	if (pqPutMsgStart('S', false, conn) < 0 ||
-		pqPutMsgEnd(conn) < 0)
+	/* construct the Sync message, unless pipelining */
+	if (conn->pipelineStatus == PQ_PIPELINE_OFF &&
+		(pqPutMsgStart('S', false, conn) < 0 ||
+		 pqPutMsgEnd(conn) < 0))
 		goto sendFailed;
 
-	/* remember we are using extended query protocol */
-	conn->queryclass = PGQUERY_EXTENDED;
-
-	/* and remember the query text too, if possible */
-	/* if insufficient memory, last_query just winds up NULL */
-	if (conn->last_query)
-		free(conn->last_query);
-	if (command)
-		conn->last_query = strdup(command);
-	else
-		conn->last_query = NULL;
+	/* remember we are using extended query protocol, and the query text */
+	pqRememberCommand(conn, entry, PGQUERY_EXTENDED, command);
 
 	/*
 	 * Give the data a push.  In nonblock mode, don't complain if we're unable
 	 * to send it all; PQgetResult() will do any additional flushing needed.
 	 */
-	if (pqFlush(conn) < 0)
+	if (pqPipelineFlush(conn) < 0)
 		goto sendFailed;
 
 	/* OK, it's launched! */
-	conn->asyncStatus = PGASYNC_BUSY;
+	if (entry)
+		pqAppendCmdQueueEntry(conn, entry);
+	else
+		conn->asyncStatus = PGASYNC_BUSY;
 	return 1;
 
 sendFailed:
+	if (entry)
+		pqRecycleCmdQueueEntry(conn, entry);
 	pqHandleSendFailure(conn);
 	return 0;
 }
@@ -1573,6 +1633,210 @@ pqHandleSendFailure(PGconn *conn)
 	parseInput(conn);
 }
 
+/*
+ * pqRememberCommand
+ *		Remember the protocol and text of a command being sent, for parsing
+ *		its results and reporting its errors.  Out of pipeline mode that is
+ *		the current command of the connection; in pipeline mode it goes into
+ *		"entry", queued once the command is sent.
+ *
+ * If insufficient memory, the query text just winds up NULL.
+ */
+static void
+pqRememberCommand(PGconn *conn, PGcmdQueueEntry *entry,
+				  PGQueryClass queryclass, const char *query)
+{
+	if (entry)
+	{
+		entry->queryclass = queryclass;
+		entry->query = query ? strdup(query) : NULL;
+		return;
+	}
+
+	conn->queryclass = queryclass;
+	if (conn->last_query)
+		free(conn->last_query);
+	conn->last_query = query ? strdup(query) : NULL;
+}
+
+/*
+ * pqPipelineFlush
+ *		Push the output buffer to the server out of pipeline mode, and in
+ *		pipeline mode only once it is big enough to be worth a send.
+ */
+static int
+pqPipelineFlush(PGconn *conn)
+{
+	if (conn->pipelineStatus == PQ_PIPELINE_OFF ||
+		conn->outCount >= PIPELINE_FLUSH_THRESHOLD)
+		return pqFlush(conn);
+	return 0;
+}
+
+/*
+ * pqAllocCmdQueueEntry
+ *		Get an entry of the command queue, from the recycled ones if any.
+ *		Returns NULL, with conn->errorMessage set, if out of memory.
+ */
+static PGcmdQueueEntry *
+pqAllocCmdQueueEntry(PGconn *conn)
+{
+	PGcmdQueueEntry *entry;
+
+	if (conn->cmd_queue_recycle == NULL)
+	{
+		entry = (PGcmdQueueEntry *) malloc(sizeof(PGcmdQueueEntry));
+		if (entry == NULL)
+		{
+			printfPQExpBuffer(&conn->errorMessage,
+							  libpq_gettext("out of memory\n"));
+			return NULL;
+		}
+	}
+	else
+	{
+		entry = conn->cmd_queue_recycle;
+		conn->cmd_queue_recycle = entry->next;
+	}
+	entry->next = NULL;
+	entry->query = NULL;
+
+	return entry;
+}
+
+/*
+ * pqRecycleCmdQueueEntry
+ *		Give back an entry no longer in the command queue
+ */
+static void
+pqRecycleCmdQueueEntry(PGconn *conn, PGcmdQueueEntry *entry)
+{
+	if (entry->query)
+	{
+		free(entry->query);
+		entry->query = NULL;
+	}
+	entry->next = conn->cmd_queue_recycle;
+	conn->cmd_queue_recycle = entry;
+}
+
+/*
+ * pqAppendCmdQueueEntry
+ *		Queue a command just sent in pipeline mode.  If no results were to
+ *		come, the connection starts on those of this command.
+ */
+static void
+pqAppendCmdQueueEntry(PGconn *conn, PGcmdQueueEntry *entry)
+{
+	if (conn->cmd_queue_head == NULL)
+		conn->cmd_queue_head = entry;
+	else
+		conn->cmd_queue_tail->next = entry;
+	conn->cmd_queue_tail = entry;
+
+	if (conn->asyncStatus == PGASYNC_IDLE)
+	{
+		conn->asyncStatus = PGASYNC_PIPELINE_IDLE;
+		pqPipelineProcessQueue(conn);
+	}
+}
+
+/*
+ * pqCommandQueueAdvance
+ *		Drop the head of the command queue, whose results are over
+ */
+static void
+pqCommandQueueAdvance(PGconn *conn)
+{
+	PGcmdQueueEntry *entry = conn->cmd_queue_head;
+
+	if (entry == NULL)
+		return;
+
+	conn->cmd_queue_head = entry->next;
+	if (conn->cmd_queue_head == NULL)
+		conn->cmd_queue_tail = NULL;
+	pqRecycleCmdQueueEntry(conn, entry);
+}
+
+/*
+ * pqPipelineProcessQueue
+ *		Once the NULL ending the results of a command has been returned,
+ *		start on the results of the command at the head of the queue, or go
+ *		idle if there is none.
+ *
+ * The server skips the commands following a failed one up to the next
+ * Sync, so while the pipeline is aborted their PGRES_PIPELINE_ABORTED
+ * results are made up here rather than waited for.
+ */
+static void
+pqPipelineProcessQueue(PGconn *conn)
+{
+	PGcmdQueueEntry *entry = conn->cmd_queue_head;
+
+	if (conn->asyncStatus != PGASYNC_PIPELINE_IDLE)
+		return;
+
+	if (entry == NULL)
+	{
+		conn->asyncStatus = PGASYNC_IDLE;
+		return;
+	}
+
+	/* initialize async result-accumulation and error state for the command */
+	resetPQExpBuffer(&conn->errorMessage);
+	pqClearAsyncResult(conn);
+	conn->singleRowMode = false;
+	conn->queryclass = entry->queryclass;
+	if (conn->last_query)
+		free(conn->last_query);
+	conn->last_query = entry->query;
+	entry->query = NULL;
+
+	if (conn->pipelineStatus == PQ_PIPELINE_ABORTED &&
+		entry->queryclass != PGQUERY_SYNC)
+	{
+		conn->result = PQmakeEmptyPGresult(conn, PGRES_PIPELINE_ABORTED);
+		if (!conn->result)
+		{
+			printfPQExpBuffer(&conn->errorMessage,
+							  libpq_gettext("out of memory\n"));
+			pqSaveErrorResult(conn);
+		}
+		conn->asyncStatus = PGASYNC_READY;
+	}
+	else
+		conn->asyncStatus = PGASYNC_BUSY;
+}
+
+/*
+ * pqFreeCommandQueue
+ *		Forget the commands whose results are still to come, when the
+ *		connection is closed.
+ */
+void
+pqFreeCommandQueue(PGconn *conn)
+{
+	PGcmdQueueEntry *entry;
+
+	while ((entry = conn->cmd_queue_head) != NULL)
+	{
+		conn->cmd_queue_head = entry->next;
+		if (entry->query)
+			free(entry->query);
+		free(entry);
+	}
+	conn->cmd_queue_tail = NULL;
+
+	while ((entry = conn->cmd_queue_recycle) != NULL)
+	{
+		conn->cmd_queue_recycle = entry->next;
+		free(entry);
+	}
+
+	conn->pipelineStatus = PQ_PIPELINE_OFF;
+}
+
 /*
  * Select row-by-row processing mode
  */
@@ -1727,10 +1991,39 @@ PQgetResult(PGconn *conn)
 		case PGASYNC_IDLE:
 			res = NULL;			/* query is complete */
 			break;
+		case PGASYNC_PIPELINE_IDLE:
+			res = NULL;			/* command is complete */
+			/* next time, return the results of the next command */
+			pqPipelineProcessQueue(conn);
+			break;
 		case PGASYNC_READY:
 			res = pqPrepareAsyncResult(conn);
-			/* Set the state back to BUSY, allowing parsing to proceed. */
-			conn->asyncStatus = PGASYNC_BUSY;
+			if (conn->pipelineStatus == PQ_PIPELINE_OFF ||
+				(res && res->resultStatus == PGRES_SINGLE_TUPLE) ||
+				(conn->queryclass == PGQUERY_SYNC &&
+				 (res == NULL || res->resultStatus != PGRES_PIPELINE_SYNC)))
+			{
+				/*
+				 * Set the state back to BUSY, allowing parsing to proceed.  In
+				 * pipeline mode, that is while more rows are to come in
+				 * single-row mode, or after an error the server reports at a
+				 * Sync, such as a failed commit, before its ReadyForQuery.
+				 */
+				conn->asyncStatus = PGASYNC_BUSY;
+			}
+			else
+			{
+				/*
+				 * That was the last result of the command at the head of the
+				 * queue, there being no ReadyForQuery between pipelined
+				 * commands.  A NULL ends it next time, unless it was a sync
+				 * point which is alone: then go on with the next command now.
+				 */
+				pqCommandQueueAdvance(conn);
+				conn->asyncStatus = PGASYNC_PIPELINE_IDLE;
+				if (res && res->resultStatus == PGRES_PIPELINE_SYNC)
+					pqPipelineProcessQueue(conn);
+			}
 			break;
 		case PGASYNC_COPY_IN:
 			res = getCopyResult(conn, PGRES_COPY_IN);
@@ -1908,6 +2201,13 @@ PQexecStart(PGconn *conn)
 	if (!conn)
 		return false;
 
+	if (conn->pipelineStatus != PQ_PIPELINE_OFF)
+	{
+		printfPQExpBuffer(&conn->errorMessage,
+						  libpq_gettext("synchronous command execution functions are not allowed in pipeline mode\n"));
+		return false;
+	}
+
 	/*
 	 * Silently discard any prior query result that application didn't eat.
 	 * This is probably poor design, but it's here for backward compatibility.
@@ -2102,6 +2402,8 @@ PQsendDescribePortal(PGconn *conn, const char *portal)
 static int
 PQsendDescribe(PGconn *conn, char desc_type, const char *desc_target)
 {
+	PGcmdQueueEntry *entry = NULL;
+
 	/* Treat null desc_target as empty string */
 	if (!desc_target)
 		desc_target = "";
@@ -2117,6 +2419,13 @@ PQsendDescribe(PGconn *conn, char desc_type, const char *desc_target)
 		return 0;
 	}
 
+	if (conn->pipelineStatus != PQ_PIPELINE_OFF)
+	{
+		entry = pqAllocCmdQueueEntry(conn);
+		if (entry == NULL)
+			return 0;			/* error msg already set */
+	}
+
 	/* construct the Describe message */
 	if (pqPutMsgStart('D', false, conn) < 0 ||
 		pqPutc(desc_type, conn) < 0 ||
@@ -2124,21 +2433,186 @@ PQsendDescribe(PGconn *conn, char desc_type, const char *desc_target)
 		pqPutMsgEnd(conn) < 0)
 		goto sendFailed;
 
-	/* construct the Sync message */
-	if (pqPutMsgStart('S', false, conn) < 0 ||
-		pqPutMsgEnd(conn) < 0)
+	/* construct the Sync message, unless pipelining */
+	if (conn->pipelineStatus == PQ_PIPELINE_OFF &&
+		(pqPutMsgStart('S', false, conn) < 0 ||
+		 pqPutMsgEnd(conn) < 0))
 		goto sendFailed;
 
-	/* remember we are doing a Describe */
-	conn->queryclass = PGQUERY_DESCRIBE;
+	/* remember we are doing a Describe (last-query string not relevant) */
+	pqRememberCommand(conn, entry, PGQUERY_DESCRIBE, NULL);
 
-	/* reset last-query string (not relevant now) */
-	if (conn->last_query)
+	/*
+	 * Give the data a push.  In nonblock mode, don't complain if we're unable
+	 * to send it all; PQgetResult() will do any additional flushing needed.
+	 */
+	if (pqPipelineFlush(conn) < 0)
+		goto sendFailed;
+
+	/* OK, it's launched! */
+	if (entry)
+		pqAppendCmdQueueEntry(conn, entry);
+	else
+		conn->asyncStatus = PGASYNC_BUSY;
+	return 1;
+
+sendFailed:
+	if (entry)
+		pqRecycleCmdQueueEntry(conn, entry);
+	pqHandleSendFailure(conn);
+	return 0;
+}
+
+/*
+ * PQpipelineStatus
+ *	  Returns the status of pipeline mode of the connection
+ */
+PGpipelineStatus
+PQpipelineStatus(const PGconn *conn)
+{
+	if (!conn)
+		return PQ_PIPELINE_OFF;
+
+	return conn->pipelineStatus;
+}
+
+/*
+ * PQenterPipelineMode
+ *	  Put an idle connection in pipeline mode.
+ *
+ * In pipeline mode, PQsendQueryParams, PQsendPrepare, PQsendQueryPrepared,
+ * PQsendDescribePrepared and PQsendDescribePortal only queue their command,
+ * without the Sync ending it and without waiting for the results of the
+ * commands queued before: PQpipelineSync ends the commands queued so far.
+ * PQgetResult returns the results of each command in turn, ended by a NULL,
+ * then a PGRES_PIPELINE_SYNC result at each sync point.
+ *
+ * Returns 1 on success and 0 on failure.
+ */
+int
+PQenterPipelineMode(PGconn *conn)
+{
+	if (!conn)
+		return 0;
+
+	/* succeed with no action if already in pipeline mode */
+	if (conn->pipelineStatus != PQ_PIPELINE_OFF)
+		return 1;
+
+	if (conn->asyncStatus != PGASYNC_IDLE)
 	{
-		free(conn->last_query);
-		conn->last_query = NULL;
+		printfPQExpBuffer(&conn->errorMessage,
+			libpq_gettext("cannot enter pipeline mode, connection not idle\n"));
+		return 0;
 	}
 
+	/* pipelining needs the extended query protocol */
+	if (PG_PROTOCOL_MAJOR(conn->pversion) < 3)
+	{
+		printfPQExpBuffer(&conn->errorMessage,
+		 libpq_gettext("function requires at least protocol version 3.0\n"));
+		return 0;
+	}
+
+	conn->pipelineStatus = PQ_PIPELINE_ON;
+
+	return 1;
+}
+
+/*
+ * PQexitPipelineMode
+ *	  Leave pipeline mode, once all the results have been collected.
+ *
+ * Returns 1 on success and 0 on failure.
+ */
+int
+PQexitPipelineMode(PGconn *conn)
+{
+	if (!conn)
+		return 0;
+
+	if (conn->pipelineStatus == PQ_PIPELINE_OFF)
+		return 1;
+
+	switch (conn->asyncStatus)
+	{
+		case PGASYNC_IDLE:
+		case PGASYNC_PIPELINE_IDLE:
+			break;
+		case PGASYNC_BUSY:
+		case PGASYNC_READY:
+			printfPQExpBuffer(&conn->errorMessage,
+			libpq_gettext("cannot exit pipeline mode with uncollected results\n"));
+			return 0;
+		default:
+			printfPQExpBuffer(&conn->errorMessage,
+				  libpq_gettext("cannot exit pipeline mode while busy\n"));
+			return 0;
+	}
+
+	/* commands still to be ended by a sync, or results still to come */
+	if (conn->cmd_queue_head != NULL)
+	{
+		printfPQExpBuffer(&conn->errorMessage,
+			libpq_gettext("cannot exit pipeline mode with uncollected results\n"));
+		return 0;
+	}
+
+	conn->pipelineStatus = PQ_PIPELINE_OFF;
+	conn->asyncStatus = PGASYNC_IDLE;
+
+	/* flush any pending data in the output buffer */
+	if (pqFlush(conn) < 0)
+		return 0;
+
+	return 1;
+}
+
+/*
+ * PQpipelineSync
+ *	  Send a Sync, ending the commands queued so far in pipeline mode, and
+ *	  push them to the server.
+ *
+ * The server runs the commands up to a Sync in a transaction of their own,
+ * unless a transaction block is open, and skips those following an error.
+ * The Sync's PGRES_PIPELINE_SYNC result ends this.
+ *
+ * Returns 1 on success and 0 on failure.
+ */
+int
+PQpipelineSync(PGconn *conn)
+{
+	PGcmdQueueEntry *entry;
+
+	if (!conn)
+		return 0;
+
+	if (conn->pipelineStatus == PQ_PIPELINE_OFF)
+	{
+		printfPQExpBuffer(&conn->errorMessage,
+			libpq_gettext("cannot send pipeline when not in pipeline mode\n"));
+		return 0;
+	}
+
+	if (conn->asyncStatus == PGASYNC_COPY_IN ||
+		conn->asyncStatus == PGASYNC_COPY_OUT ||
+		conn->asyncStatus == PGASYNC_COPY_BOTH)
+	{
+		printfPQExpBuffer(&conn->errorMessage,
+			libpq_gettext("cannot send pipeline while in COPY\n"));
+		return 0;
+	}
+
+	entry = pqAllocCmdQueueEntry(conn);
+	if (entry == NULL)
+		return 0;				/* error msg already set */
+	entry->queryclass = PGQUERY_SYNC;
+
+	/* construct the Sync message */
+	if (pqPutMsgStart('S', false, conn) < 0 ||
+		pqPutMsgEnd(conn) < 0)
+		goto sendFailed;
+
 	/*
 	 * Give the data a push.  In nonblock mode, don't complain if we're unable
 	 * to send it all; PQgetResult() will do any additional flushing needed.
@@ -2147,14 +2621,53 @@ PQsendDescribe(PGconn *conn, char desc_type, const char *desc_target)
 		goto sendFailed;
 
 	/* OK, it's launched! */
-	conn->asyncStatus = PGASYNC_BUSY;
+	pqAppendCmdQueueEntry(conn, entry);
 	return 1;
 
 sendFailed:
+	pqRecycleCmdQueueEntry(conn, entry);
 	pqHandleSendFailure(conn);
 	return 0;
 }
 
+/*
+ * PQsendFlushRequest
+ *	  Ask the server to send the results it has so far, without ending the
+ *	  queued commands by a sync.  The request itself is only sent with the
+ *	  next flush of the output buffer.
+ *
+ * Returns 1 on success and 0 on failure.
+ */
+int
+PQsendFlushRequest(PGconn *conn)
+{
+	if (!conn)
+		return 0;
+
+	/* Don't try to send if we know there's no live connection. */
+	if (conn->status != CONNECTION_OK)
+	{
+		printfPQExpBuffer(&conn->errorMessage,
+						  libpq_gettext("no connection to the server\n"));
+		return 0;
+	}
+
+	/* Can't send while already busy, either, unless pipelining */
+	if (conn->asyncStatus != PGASYNC_IDLE &&
+		conn->pipelineStatus == PQ_PIPELINE_OFF)
+	{
+		printfPQExpBuffer(&conn->errorMessage,
+				  libpq_gettext("another command is already in progress\n"));
+		return 0;
+	}
+
+	if (pqPutMsgStart('H', false, conn) < 0 ||
+		pqPutMsgEnd(conn) < 0)
+		return 0;
+
+	return 1;
+}
+
 /*
  * PQnotifies
  *	  returns a PGnotify* structure of the latest async notification
@@ -2546,6 +3059,7 @@ PQfn(PGconn *conn,
 	resetPQExpBuffer(&conn->errorMessage);
 
 	if (conn->sock < 0 || conn->asyncStatus != PGASYNC_IDLE ||
+		conn->pipelineStatus != PQ_PIPELINE_OFF ||
 		conn->result != NULL)
 	{
 		printfPQExpBuffer(&conn->errorMessage,
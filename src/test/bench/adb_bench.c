@@ -0,0 +1,302 @@
+/*-------------------------------------------------------------------------
+ *
+ * adb_bench.c
+ *
+ *	  Microbenchmarks of the distributed hot paths
+ *
+ * Each function runs one path "loops" times and returns the number of
+ * operations, the time per operation in nanoseconds and the memory per
+ * operation in bytes.  Memory is the growth of TopMemoryContext->mem_total,
+ * that is what stays allocated from malloc after the loop; a path which
+ * frees what it gets shows zero, one which leaks into a context living
+ * until the end of the query shows what it leaks.
+ *
+ * Portions Copyright (c) 2016, ASIAINFO BDX ADB Group
+ *
+ * src/test/bench/adb_bench.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "access/xact.h"
+#include "agtm/agtm.h"
+#include "catalog/pg_type.h"
+#include "executor/spi.h"
+#include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "pgxc/locator.h"
+#include "pgxc/pgxc.h"
+#include "pgxc/pgxcnode.h"
+#include "portability/instr_time.h"
+#include "storage/procarray.h"
+#include "utils/builtins.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/snapshot.h"
+
+PG_MODULE_MAGIC;
+
+typedef struct BenchState
+{
+	instr_time	start;
+	Size		mem_start;
+} BenchState;
+
+extern Datum adb_bench_snapshot(PG_FUNCTION_ARGS);
+extern Datum adb_bench_relation_nodes(PG_FUNCTION_ARGS);
+extern Datum adb_bench_remote_rows(PG_FUNCTION_ARGS);
+extern Datum adb_bench_pool_handles(PG_FUNCTION_ARGS);
+
+PG_FUNCTION_INFO_V1(adb_bench_snapshot);
+PG_FUNCTION_INFO_V1(adb_bench_relation_nodes);
+PG_FUNCTION_INFO_V1(adb_bench_remote_rows);
+PG_FUNCTION_INFO_V1(adb_bench_pool_handles);
+
+static int	bench_get_loops(FunctionCallInfo fcinfo, int argno);
+static void bench_start(BenchState *state);
+static Datum bench_result(FunctionCallInfo fcinfo, BenchState *state,
+			 int64 ops);
+
+/* Check the number of loops given as argument "argno" */
+static int
+bench_get_loops(FunctionCallInfo fcinfo, int argno)
+{
+	int			loops = PG_GETARG_INT32(argno);
+
+	if (loops <= 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("number of loops must be positive")));
+	return loops;
+}
+
+static void
+bench_start(BenchState *state)
+{
+	state->mem_start = TopMemoryContext->mem_total;
+	INSTR_TIME_SET_CURRENT(state->start);
+}
+
+/* Stop the clock and build the (ops, ns_per_op, bytes_per_op) result */
+static Datum
+bench_result(FunctionCallInfo fcinfo, BenchState *state, int64 ops)
+{
+	instr_time	duration;
+	Size		mem_end;
+	TupleDesc	tupdesc;
+	Datum		values[3];
+	bool		nulls[3];
+	double		bytes;
+
+	INSTR_TIME_SET_CURRENT(duration);
+	INSTR_TIME_SUBTRACT(duration, state->start);
+	mem_end = TopMemoryContext->mem_total;
+
+	if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	if (mem_end > state->mem_start)
+		bytes = (double) (mem_end - state->mem_start);
+	else
+		bytes = 0;
+
+	MemSet(nulls, 0, sizeof(nulls));
+	values[0] = Int64GetDatum(ops);
+	if (ops > 0)
+	{
+		values[1] = Float8GetDatum(INSTR_TIME_GET_DOUBLE(duration) * 1e9 / ops);
+		values[2] = Float8GetDatum(bytes / ops);
+	}
+	else
+	{
+		nulls[1] = true;
+		nulls[2] = true;
+	}
+
+	return HeapTupleGetDatum(heap_form_tuple(BlessTupleDesc(tupdesc),
+											 values, nulls));
+}
+
+/*
+ * adb_bench_snapshot(loops)
+ *
+ * Ask AGTM for a global snapshot "loops" times.
+ */
+Datum
+adb_bench_snapshot(PG_FUNCTION_ARGS)
+{
+	int			loops = bench_get_loops(fcinfo, 0);
+	SnapshotData snapshot;
+	BenchState	state;
+	int			i;
+
+	if (!IsUnderAGTM())
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("global snapshots are only available under AGTM")));
+
+	MemSet(&snapshot, 0, sizeof(snapshot));
+	snapshot.xip = (TransactionId *)
+		palloc(GetMaxSnapshotXidCount() * sizeof(TransactionId));
+	snapshot.subxip = (TransactionId *)
+		palloc(GetMaxSnapshotSubxidCount() * sizeof(TransactionId));
+
+	bench_start(&state);
+	for (i = 0; i < loops; i++)
+	{
+		CHECK_FOR_INTERRUPTS();
+		agtm_GetGlobalSnapShot(&snapshot);
+	}
+
+	return bench_result(fcinfo, &state, loops);
+}
+
+/*
+ * adb_bench_relation_nodes(rel, loops)
+ *
+ * Route "loops" values of the distribution column of "rel" to their nodes
+ * with GetRelationNodes(), the values being the numbers from 1 to "loops".
+ * The distribution column has to be an integer, tables without one are
+ * routed the way their locator type says.
+ */
+Datum
+adb_bench_relation_nodes(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	int			loops = bench_get_loops(fcinfo, 1);
+	RelationLocInfo *locInfo;
+	Oid			type = INT4OID;
+	BenchState	state;
+	int			i;
+
+	locInfo = GetRelationLocInfo(relid);
+	if (locInfo == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("relation \"%s\" is not distributed",
+						get_rel_name(relid))));
+	if (IsRelationDistributedByUserDefined(locInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("relations distributed by a user defined function are not supported")));
+	if (locInfo->partAttrNum != InvalidAttrNumber)
+	{
+		type = get_atttype(relid, locInfo->partAttrNum);
+		if (type != INT2OID && type != INT4OID && type != INT8OID)
+			ereport(ERROR,
+					(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					 errmsg("distribution column of \"%s\" is not an integer",
+							get_rel_name(relid))));
+	}
+
+	bench_start(&state);
+	for (i = 1; i <= loops; i++)
+	{
+		ExecNodes  *nodes;
+		Datum		value;
+		bool		isnull = false;
+
+		CHECK_FOR_INTERRUPTS();
+		if (type == INT2OID)
+			value = Int16GetDatum((int16) i);
+		else if (type == INT8OID)
+			value = Int64GetDatum((int64) i);
+		else
+			value = Int32GetDatum(i);
+
+		nodes = GetRelationNodes(locInfo, 1, &value, &isnull, &type,
+								 RELATION_ACCESS_INSERT);
+		FreeExecNodes(&nodes);
+	}
+	FreeRelationLocInfo(locInfo);
+
+	return bench_result(fcinfo, &state, loops);
+}
+
+/*
+ * adb_bench_remote_rows(query, loops)
+ *
+ * Run "query" "loops" times, an operation being a row it returns.  On a
+ * Coordinator, a query reading a distributed table has every row go
+ * through HandleDataRow() and FetchTuple() on its way from the Datanodes.
+ */
+Datum
+adb_bench_remote_rows(PG_FUNCTION_ARGS)
+{
+	char	   *query = text_to_cstring(PG_GETARG_TEXT_PP(0));
+	int			loops = bench_get_loops(fcinfo, 1);
+	SPIPlanPtr	plan;
+	BenchState	state;
+	int64		rows = 0;
+	int			i;
+	int			ret;
+
+	if ((ret = SPI_connect()) != SPI_OK_CONNECT)
+		elog(ERROR, "SPI_connect failed: %s", SPI_result_code_string(ret));
+
+	plan = SPI_prepare(query, 0, NULL);
+	if (plan == NULL)
+		elog(ERROR, "SPI_prepare(\"%s\") failed: %s",
+			 query, SPI_result_code_string(SPI_result));
+
+	bench_start(&state);
+	for (i = 0; i < loops; i++)
+	{
+		CHECK_FOR_INTERRUPTS();
+		ret = SPI_execute_plan(plan, NULL, NULL, true, 0);
+		if (ret != SPI_OK_SELECT)
+			elog(ERROR, "SPI_execute_plan(\"%s\") failed: %s",
+				 query, SPI_result_code_string(ret));
+		rows += SPI_processed;
+		SPI_freetuptable(SPI_tuptable);
+	}
+
+	/* finish first, so that the result is not built in SPI memory */
+	SPI_finish();
+
+	return bench_result(fcinfo, &state, rows);
+}
+
+/*
+ * adb_bench_pool_handles(loops)
+ *
+ * Get a handle on every Datanode and release them "loops" times, that is
+ * one trip to the pooler for the connections and one to give them back.
+ * Must be called alone in its statement and outside of a transaction
+ * block, since the handles of the session are released.
+ */
+Datum
+adb_bench_pool_handles(PG_FUNCTION_ARGS)
+{
+	int			loops = bench_get_loops(fcinfo, 0);
+	List	   *datanodes;
+	BenchState	state;
+	int			i;
+
+	if (!IS_PGXC_COORDINATOR || IsConnFromCoord())
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("pool handles can only be benchmarked on a Coordinator")));
+	if (IsTransactionBlock())
+		ereport(ERROR,
+				(errcode(ERRCODE_ACTIVE_SQL_TRANSACTION),
+				 errmsg("adb_bench_pool_handles cannot run inside a transaction block")));
+
+	datanodes = GetAllDataNodes();
+
+	bench_start(&state);
+	for (i = 0; i < loops; i++)
+	{
+		PGXCNodeAllHandles *handles;
+
+		CHECK_FOR_INTERRUPTS();
+		handles = get_handles(datanodes, NIL, false);
+		pfree_pgxc_all_handles(handles);
+		release_handles();
+	}
+
+	return bench_result(fcinfo, &state, loops);
+}
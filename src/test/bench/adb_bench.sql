@@ -0,0 +1,49 @@
+--
+-- Microbenchmarks of the distributed hot paths, see README.
+--
+-- psql variables: libpath, the path of the loadable module, and loops.
+--
+
+CREATE FUNCTION adb_bench_snapshot(loops int4,
+	OUT ops int8, OUT ns_per_op float8, OUT bytes_per_op float8)
+	AS :'libpath' LANGUAGE C STRICT;
+CREATE FUNCTION adb_bench_relation_nodes(rel regclass, loops int4,
+	OUT ops int8, OUT ns_per_op float8, OUT bytes_per_op float8)
+	AS :'libpath' LANGUAGE C STRICT;
+CREATE FUNCTION adb_bench_remote_rows(query text, loops int4,
+	OUT ops int8, OUT ns_per_op float8, OUT bytes_per_op float8)
+	AS :'libpath' LANGUAGE C STRICT;
+CREATE FUNCTION adb_bench_pool_handles(loops int4,
+	OUT ops int8, OUT ns_per_op float8, OUT bytes_per_op float8)
+	AS :'libpath' LANGUAGE C STRICT;
+
+CREATE TABLE adb_bench_hash (id int4, v int4) DISTRIBUTE BY HASH (id);
+CREATE TABLE adb_bench_repl (id int4, v int4) DISTRIBUTE BY REPLICATION;
+INSERT INTO adb_bench_hash SELECT i, 0 FROM generate_series(1, 10000) i;
+INSERT INTO adb_bench_repl SELECT i, 0 FROM generate_series(1, 10000) i;
+
+\echo global snapshot from AGTM
+SELECT * FROM adb_bench_snapshot(:loops);
+
+\echo routing of a hash distributed table
+SELECT * FROM adb_bench_relation_nodes('adb_bench_hash', :loops);
+
+\echo routing of a replicated table
+SELECT * FROM adb_bench_relation_nodes('adb_bench_repl', :loops);
+
+\echo rows combined from all Datanodes, per row
+SELECT * FROM adb_bench_remote_rows('SELECT * FROM adb_bench_hash', 10);
+
+\echo single row from one Datanode, per row
+SELECT * FROM adb_bench_remote_rows(
+	'SELECT * FROM adb_bench_hash WHERE id = 1', :loops);
+
+\echo handles on all Datanodes from the pooler and back
+SELECT * FROM adb_bench_pool_handles(:loops);
+
+DROP FUNCTION adb_bench_snapshot(int4);
+DROP FUNCTION adb_bench_relation_nodes(regclass, int4);
+DROP FUNCTION adb_bench_remote_rows(text, int4);
+DROP FUNCTION adb_bench_pool_handles(int4);
+
+\echo two-phase commit of a transaction updating two Datanodes
@@ -0,0 +1,6 @@
+\setrandom a 1 10000
+\setrandom b 1 10000
+BEGIN;
+UPDATE adb_bench_hash SET v = v + 1 WHERE id = :a;
+UPDATE adb_bench_hash SET v = v - 1 WHERE id = :b;
+END;
@@ -446,3 +446,8 @@ select string_agg(v, NULL order by v) from bytea_test_table;
 select string_agg(v, decode('ee', 'hex') order by v) from bytea_test_table;
 
 drop table bytea_test_table;
+
+-- hashed aggregation with more groups than work_mem holds
+set work_mem = '64kB';
+select count(*), sum(c) from (select i % 5000 as g, count(*) as c from generate_series(1, 20000) i group by 1) s;
+reset work_mem;
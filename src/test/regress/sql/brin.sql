@@ -0,0 +1,52 @@
+--
+-- BRIN
+--
+CREATE TABLE brintest (int4col int4, int8col int8, float8col float8,
+	textcol text, datecol date, timestampcol timestamp, numericcol numeric);
+
+INSERT INTO brintest SELECT i, i * 10, i / 4.0, lpad(i::text, 4, '0'),
+	date '2000-01-01' + i, timestamp '2000-01-01 00:00' + i * interval '1 hour',
+	i / 100.0
+FROM generate_series(1, 1000) i;
+INSERT INTO brintest SELECT NULL, NULL, NULL, NULL, NULL, NULL, NULL
+FROM generate_series(1, 10);
+
+CREATE INDEX brinidx ON brintest USING brin (int4col, int8col, float8col,
+	textcol, datecol, timestampcol, numericcol) WITH (pages_per_range = 2);
+
+SET enable_seqscan = off;
+SET enable_bitmapscan = on;
+
+SELECT count(*) FROM brintest WHERE int4col < 100;
+SELECT count(*) FROM brintest WHERE int8col >= 9000;
+SELECT count(*) FROM brintest WHERE float8col = 125.5;
+SELECT count(*) FROM brintest WHERE textcol > '0990';
+SELECT count(*) FROM brintest WHERE datecol <= '2000-01-31';
+SELECT count(*) FROM brintest
+	WHERE timestampcol BETWEEN '2000-01-02 00:00' AND '2000-01-03 00:00';
+SELECT count(*) FROM brintest WHERE numericcol = 5.00;
+SELECT count(*) FROM brintest WHERE int4col IS NULL;
+SELECT count(*) FROM brintest WHERE int4col IS NOT NULL AND int4col > 995;
+
+-- updated tuples must still be found
+UPDATE brintest SET float8col = -1 WHERE int4col = 10;
+SELECT count(*) FROM brintest WHERE float8col < 0;
+
+-- ranges added after the index build are scanned until summarized
+INSERT INTO brintest SELECT i, i * 10, i / 4.0, lpad(i::text, 4, '0'),
+	date '2000-01-01' + i, timestamp '2000-01-01 00:00' + i * interval '1 hour',
+	i / 100.0
+FROM generate_series(1001, 1100) i;
+SELECT count(*) FROM brintest WHERE int4col > 1000;
+VACUUM brintest;
+SELECT count(*) FROM brintest WHERE int4col > 1000;
+
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+
+-- error cases
+CREATE UNIQUE INDEX brinidx_unique ON brintest USING brin (int4col);
+CREATE INDEX brinidx_bad ON brintest USING brin (int4col) WITH (pages_per_range = 0);
+SELECT brin_summarize_new_values('brintest');
+
+DROP TABLE brintest;
@@ -0,0 +1,54 @@
+--
+-- B-tree deduplication into posting lists
+--
+CREATE TABLE dedup_tab (id int, val int, txt text);
+INSERT INTO dedup_tab SELECT i, i % 10, 'value ' || (i % 10)
+  FROM generate_series(1, 10000) i;
+
+CREATE INDEX dedup_tab_val ON dedup_tab (val);
+CREATE INDEX dedup_tab_val_off ON dedup_tab (val) WITH (deduplicate_items = off);
+CREATE INDEX dedup_tab_txt ON dedup_tab (txt);
+SELECT relname, reloptions FROM pg_class
+  WHERE relname LIKE 'dedup_tab_%' ORDER BY relname;
+
+-- the deduplicated index is much smaller
+SELECT pg_relation_size('dedup_tab_val') * 4 < pg_relation_size('dedup_tab_val_off')
+  AS smaller;
+
+SET enable_seqscan = off;
+SET enable_bitmapscan = off;
+
+SELECT count(*) FROM dedup_tab WHERE val = 3;
+SELECT count(*) FROM dedup_tab WHERE val BETWEEN 2 AND 4;
+SELECT count(*) FROM dedup_tab WHERE txt = 'value 7';
+SELECT val, count(*) FROM dedup_tab WHERE val > 6 GROUP BY val ORDER BY val;
+SELECT val FROM dedup_tab WHERE val < 1 ORDER BY val DESC LIMIT 3;
+SELECT id FROM dedup_tab WHERE val = 9 ORDER BY id LIMIT 5;
+
+-- VACUUM removes some of the heap TIDs of a posting list tuple, or all
+DELETE FROM dedup_tab WHERE id % 3 = 0;
+DELETE FROM dedup_tab WHERE val = 5;
+VACUUM dedup_tab;
+SELECT count(*) FROM dedup_tab WHERE val = 3;
+SELECT count(*) FROM dedup_tab WHERE val = 5;
+SELECT count(*) FROM dedup_tab WHERE txt = 'value 7';
+
+-- insertions into full pages merge the duplicates first
+INSERT INTO dedup_tab SELECT i, i % 10, 'value ' || (i % 10)
+  FROM generate_series(10001, 20000) i;
+SELECT count(*) FROM dedup_tab WHERE val = 3;
+SELECT count(*) FROM dedup_tab WHERE val = 5;
+SELECT val, count(*) FROM dedup_tab WHERE val BETWEEN 4 AND 6
+  GROUP BY val ORDER BY val;
+
+-- unique indexes never merge, and the option can be changed
+CREATE UNIQUE INDEX dedup_tab_id ON dedup_tab (id);
+SELECT count(*) FROM dedup_tab WHERE id BETWEEN 100 AND 199;
+ALTER INDEX dedup_tab_val SET (deduplicate_items = off);
+INSERT INTO dedup_tab SELECT i, 3, 'value 3' FROM generate_series(20001, 21000) i;
+SELECT count(*) FROM dedup_tab WHERE val = 3;
+ALTER INDEX dedup_tab_val SET (deduplicate_items = maybe);
+
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+DROP TABLE dedup_tab;
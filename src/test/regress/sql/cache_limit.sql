@@ -0,0 +1,22 @@
+--
+-- Memory limits of the catalog and relation caches of a session
+--
+SELECT cache, size_limit FROM pg_backend_cache_usage ORDER BY cache;
+
+-- look up every type, which does not fit into 32kB of catalog cache
+SET catalog_cache_memory_limit = 32;
+SELECT count(format_type(oid, NULL)) > 0 AS ok FROM pg_type;
+SELECT size <= size_limit AS within_limit, evictions > 0 AS evicted
+  FROM pg_backend_cache_usage WHERE cache = 'catalog';
+SELECT count(format_type(oid, NULL)) > 0 AS ok FROM pg_type;
+RESET catalog_cache_memory_limit;
+
+-- open every table, the relation cache is trimmed at commit
+SET relation_cache_memory_limit = 256;
+SELECT count(pg_relation_is_updatable(oid, false)) > 0 AS ok
+  FROM pg_class WHERE relkind = 'r';
+SELECT size <= size_limit AS within_limit, evictions > 0 AS evicted
+  FROM pg_backend_cache_usage WHERE cache = 'relation';
+RESET relation_cache_memory_limit;
+
+SELECT cache, size_limit FROM pg_backend_cache_usage ORDER BY cache;
@@ -0,0 +1,43 @@
+--
+-- Per-column compression methods
+--
+-- pg_column_compression() has to look at the values where they are stored
+SET enable_stable_func_shipping = on;
+
+CREATE TABLE cmdata (f1 int, f2 text);
+ALTER TABLE cmdata ALTER COLUMN f2 SET (compression = lz4);
+INSERT INTO cmdata VALUES (1, repeat('1234567890', 1000));
+CREATE TABLE cmdata_pglz (f1 int, f2 text);
+INSERT INTO cmdata_pglz VALUES (1, repeat('1234567890', 1000));
+SELECT pg_column_compression(f2), pg_column_size(f2) < 1000 AS small FROM cmdata;
+SELECT pg_column_compression(f2) FROM cmdata_pglz;
+SELECT length(f2), substr(f2, 9995, 10) FROM cmdata;
+
+-- compressed and stored out of line
+INSERT INTO cmdata SELECT 2, string_agg(repeat(md5(i::text), 4), '')
+  FROM generate_series(1, 1000) i;
+SELECT f1, pg_column_compression(f2), length(f2) FROM cmdata ORDER BY f1;
+SELECT substr(f2, 1, 32) = md5('1') AS first,
+       substr(f2, 127969, 32) = md5('1000') AS last
+  FROM cmdata WHERE f1 = 2;
+
+-- values that are not compressed
+SELECT pg_column_compression('short'::text), pg_column_compression(1);
+
+-- the default method applies to columns without their own setting
+SET default_toast_compression = lz4;
+CREATE TABLE cmdata2 (f1 int, f2 text);
+INSERT INTO cmdata2 VALUES (1, repeat('1234567890', 1000));
+ALTER TABLE cmdata2 ALTER COLUMN f2 SET (compression = pglz);
+INSERT INTO cmdata2 VALUES (2, repeat('1234567890', 1000));
+ALTER TABLE cmdata2 ALTER COLUMN f2 RESET (compression);
+INSERT INTO cmdata2 VALUES (3, repeat('1234567890', 1000));
+RESET default_toast_compression;
+SELECT f1, pg_column_compression(f2), substr(f2, 9995, 10) FROM cmdata2 ORDER BY f1;
+
+-- errors
+ALTER TABLE cmdata ALTER COLUMN f2 SET (compression = zstd);
+SET default_toast_compression = zstd;
+
+DROP TABLE cmdata, cmdata_pglz, cmdata2;
+RESET enable_stable_func_shipping;
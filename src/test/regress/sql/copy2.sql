@@ -292,6 +292,36 @@ copy check_con_tbl from stdin;
 \.
 select * from check_con_tbl;
 
+-- the Coordinator can leave the non-distribution columns to the Datanodes
+SET copy_check_all_columns = off;
+CREATE TABLE copy_dist (a int, b int, c text) DISTRIBUTE BY HASH (a);
+COPY copy_dist FROM stdin;
+1	10	one
+2	20	two
+\.
+COPY copy_dist (a, c) FROM stdin;
+3	three
+\.
+SELECT * FROM copy_dist ORDER BY a;
+RESET copy_check_all_columns;
+DROP TABLE copy_dist;
+
+-- rows with data errors can be skipped, up to ERROR_LIMIT of them
+CREATE TABLE copy_errors (a int, b text);
+COPY copy_errors FROM stdin WITH (error_limit 2);
+1	one
+x	two
+3	three
+4
+\.
+SELECT * FROM copy_errors ORDER BY a;
+COPY copy_errors FROM stdin WITH (error_limit 1);
+x	five
+y	six
+\.
+COPY copy_errors TO stdout WITH (error_limit 1);
+DROP TABLE copy_errors;
+
 DROP TABLE vistest;
 DROP FUNCTION truncate_in_subxact();
 --
@@ -0,0 +1,36 @@
+--
+-- GIN index build with sorted runs, and pending list cleanup
+--
+CREATE TABLE gin_build_tab (id int, a int[]);
+INSERT INTO gin_build_tab SELECT i, ARRAY[i % 5, 100 + i % 1000, 10000 + i]
+  FROM generate_series(1, 200000) i;
+
+-- too little memory to hold all the keys, so sorted runs get merged
+SET maintenance_work_mem = '1MB';
+CREATE INDEX gin_build_idx ON gin_build_tab USING gin (a) WITH (fastupdate = off);
+RESET maintenance_work_mem;
+
+SET enable_seqscan = off;
+
+SELECT count(*) FROM gin_build_tab WHERE a @> '{3}';
+SELECT count(*) FROM gin_build_tab WHERE a @> '{3, 103}';
+SELECT count(*) FROM gin_build_tab WHERE a @> '{100}';
+SELECT count(*) FROM gin_build_tab WHERE a && '{10007, 210000, 5000000}';
+SELECT id FROM gin_build_tab WHERE a @> '{4, 10099}' ORDER BY id;
+
+-- inserters clean up the pending list when it grows too long
+ALTER INDEX gin_build_idx SET (fastupdate = on);
+SET work_mem = '64kB';
+INSERT INTO gin_build_tab SELECT i, ARRAY[i % 5, 100 + i % 1000, 10000 + i]
+  FROM generate_series(200001, 210000) i;
+RESET work_mem;
+SELECT count(*) FROM gin_build_tab WHERE a @> '{3}';
+SELECT count(*) FROM gin_build_tab WHERE a @> '{100}';
+
+-- and VACUUM empties it
+VACUUM gin_build_tab;
+SELECT count(*) FROM gin_build_tab WHERE a @> '{3}';
+SELECT count(*) FROM gin_build_tab WHERE a && '{10007, 210000, 5000000}';
+
+RESET enable_seqscan;
+DROP TABLE gin_build_tab;
@@ -0,0 +1,41 @@
+--
+-- HYPERLOGLOG
+--
+-- small counts are estimated by linear counting, larger ones within 2%
+SELECT approx_count_distinct(x) FROM generate_series(1, 1000) x;
+SELECT approx_count_distinct(x % 10000) FROM generate_series(1, 100000) x;
+SELECT abs(approx_count_distinct(x) - 100000) < 2000 AS close
+  FROM generate_series(1, 100000) x;
+SELECT approx_count_distinct('v' || x) FROM generate_series(1, 1000) x;
+-- nulls are ignored, and an empty set counts 0
+SELECT approx_count_distinct(x) FROM (VALUES (1), (NULL), (2), (1)) v(x);
+SELECT approx_count_distinct(x) FROM generate_series(1, 0) x;
+-- sketches
+SELECT hll_add_agg(x) FROM (VALUES (2), (1), (1)) v(x);
+SELECT hll_cardinality('010e0000055f0100073f42');
+SELECT hll_cardinality(hll_add_trans(hll_add_trans('010e00', 1), 2));
+SELECT hll_cardinality(hll_add_agg(x)) = approx_count_distinct(x) AS same
+  FROM generate_series(1, 50000) x;
+SELECT hll_add_agg(x)::text::hll::text = hll_add_agg(x)::text AS roundtrip
+  FROM generate_series(1, 5000) x;
+-- the union of the sketches of parts is the sketch of the whole
+CREATE TABLE hll_test (grp int, val int) DISTRIBUTE BY HASH (grp);
+INSERT INTO hll_test SELECT x % 7, x FROM generate_series(1, 30000) x;
+CREATE TABLE hll_rollup AS
+  SELECT grp, hll_add_agg(val) AS sketch FROM hll_test GROUP BY grp;
+SELECT grp, hll_cardinality(sketch) = n AS same
+  FROM hll_rollup
+  JOIN (SELECT grp, approx_count_distinct(val) AS n FROM hll_test GROUP BY grp) t
+ USING (grp) ORDER BY grp;
+SELECT hll_union_agg(sketch)::text = (SELECT hll_add_agg(val)::text FROM hll_test) AS same
+  FROM hll_rollup;
+SELECT hll_cardinality(hll_union_agg(sketch)) FROM hll_rollup;
+SELECT approx_count_distinct(val) FROM hll_test;
+DROP TABLE hll_rollup;
+DROP TABLE hll_test;
+-- errors
+SELECT hll_union('010e00', '010400');
+SELECT '020e00'::hll;
+SELECT '011600'::hll;
+SELECT '010e00000a00'::hll;
+SELECT '010e000000004200000041'::hll;
@@ -559,3 +559,21 @@ FROM generate_series(1, 3) g(i);
 reset enable_seqscan;
 reset enable_indexscan;
 reset enable_bitmapscan;
+
+-- children pruned by the cached ranges of their CHECK constraints
+create table part_parent (a int, b text);
+create table part_1 (check (a >= 0 and a < 100)) inherits (part_parent);
+create table part_2 (check (a >= 100 and a < 200)) inherits (part_parent);
+create table part_3 (check (a >= 200 and a < 300)) inherits (part_parent);
+create table part_4 (check (a in (1000, 2000))) inherits (part_parent);
+create table part_other (check (b <> 'x')) inherits (part_parent);
+explain (costs off, nodes off) select * from part_parent where a = 150;
+explain (costs off, nodes off) select * from part_parent where a >= 100 and a < 250;
+explain (costs off, nodes off) select * from part_parent where 1500 > a and a > 1200;
+explain (costs off, nodes off) select * from part_parent where a in (1000, 1500);
+-- a new child and a changed constraint are seen, overlapping ranges work
+create table part_5 (check (a >= 300 and a < 400)) inherits (part_parent);
+explain (costs off, nodes off) select * from part_parent where a > 350;
+alter table part_3 drop constraint part_3_a_check, add check (a >= 150 and a < 300);
+explain (costs off, nodes off) select * from part_parent where a = 150;
+drop table part_parent cascade;
@@ -0,0 +1,61 @@
+-- Input and output.
+SELECT '{"b":2, "a":1, "a":3}'::jsonb;		-- last duplicate key wins
+SELECT '{"abc":1, "de":[true, null, "x"], "f":{}}'::jsonb;	-- shorter keys first
+SELECT '  [1.50, -2e3, "\u0041\n"]  '::jsonb;
+SELECT '"scalar"'::jsonb, 'null'::jsonb, '12'::jsonb;
+SELECT '[1,2'::jsonb;			-- ERROR, no closing bracket
+SELECT '{"a":[1,{"b":2}]}'::json::jsonb::json;
+SELECT jsonb_typeof('{}') AS o, jsonb_typeof('[]') AS a, jsonb_typeof('"x"') AS s,
+       jsonb_typeof('1.5') AS n, jsonb_typeof('false') AS b, jsonb_typeof('null') AS z;
+
+-- Accessors.
+SELECT '{"a":{"b":[10,20]}}'::jsonb -> 'a' -> 'b' ->> 1;
+SELECT '{"a":"x","n":null}'::jsonb ->> 'a' AS a,
+       ('{"a":"x","n":null}'::jsonb ->> 'n') IS NULL AS json_null,
+       ('[1]'::jsonb -> 'a') IS NULL AS not_object,
+       ('[1]'::jsonb -> 5) IS NULL AS out_of_range;
+SELECT '["a",{"b":1}]'::jsonb -> 1 AS elem, '["a",{"b":1}]'::jsonb ->> 0 AS text;
+
+-- Existence: top-level keys, or strings of a top-level array.
+SELECT '{"a":1,"b":{"c":2}}'::jsonb ? 'b' AS top,
+       '{"a":1,"b":{"c":2}}'::jsonb ? 'c' AS nested,
+       '["x","y"]'::jsonb ? 'y' AS elem,
+       '"x"'::jsonb ? 'x' AS scalar;
+SELECT '{"a":1,"b":2}'::jsonb ?| ARRAY['c','b'] AS has_any,
+       '{"a":1,"b":2}'::jsonb ?& ARRAY['a','c'] AS has_all,
+       '{"a":1}'::jsonb ?& '{}'::text[] AS has_none;
+
+-- Containment.
+SELECT '{"a":1,"b":[1,2,{"c":3}]}'::jsonb @> '{"b":[{"c":3}]}' AS nested,
+       '{"a":1,"b":[1,2]}'::jsonb @> '{"b":2}' AS scalar_in_array,
+       '[1,2,[3]]'::jsonb @> '[3]' AS not_flattened,
+       '["a",1]'::jsonb @> '"a"' AS raw_scalar,
+       '{"a":1.0}'::jsonb @> '{"a":1}' AS numeric_scale,
+       '{"a":1}'::jsonb <@ '{"a":1,"b":2}' AS contained;
+
+-- Comparison.
+SELECT '{"a":1, "b":2}'::jsonb = '{"b":2, "a":1.00}' AS eq,
+       '[1,2]'::jsonb < '[1,3]' AS lt,
+       '{}'::jsonb > '[1,2,3]' AS object_after_array,
+       'null'::jsonb < '""' AS null_first;
+SELECT count(DISTINCT j) FROM (VALUES ('[1]'::jsonb), ('[1.0]'), ('[2]')) v(j);
+
+-- GIN index.
+CREATE TABLE testjsonb (id int, j jsonb);
+INSERT INTO testjsonb
+SELECT i, ('{"id":' || i || ', "kind":"' ||
+           CASE WHEN i % 3 = 0 THEN 'login' ELSE 'view' END ||
+           '", "tags":["t' || i % 5 || '"]}')::jsonb
+FROM generate_series(1, 100) i;
+CREATE INDEX testjsonb_j ON testjsonb USING gin (j);
+SET enable_seqscan = off;
+SELECT count(*) FROM testjsonb WHERE j @> '{"kind":"login"}';
+SELECT count(*) FROM testjsonb WHERE j @> '{"tags":["t1"]}';
+SELECT count(*) FROM testjsonb WHERE j @> '{"id":42.0}';
+SELECT count(*) FROM testjsonb WHERE j @> '{}';
+SELECT count(*) FROM testjsonb WHERE j ? 'tags';
+SELECT count(*) FROM testjsonb WHERE j ? 't1';
+SELECT count(*) FROM testjsonb WHERE j ?| ARRAY['nope','kind'];
+SELECT count(*) FROM testjsonb WHERE j ?& ARRAY['id','nope'];
+RESET enable_seqscan;
+DROP TABLE testjsonb;
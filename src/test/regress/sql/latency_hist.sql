@@ -0,0 +1,15 @@
+--
+-- LATENCY_HIST
+--
+-- 10 durations in [4us, 5us) and 4 in [8us, 10us)
+SELECT latency_percentile('{0,0,0,0,10}', 0.5);
+SELECT latency_percentile('{0,0,0,0,0,0,0,0,4}', 1);
+SELECT latency_percentile('{0,0,0}', 0.5) IS NULL AS empty;
+SELECT latency_percentile('{1}', 1.5);
+SELECT latency_histogram_add('{1,2,3}', '{10,20,30}');
+SELECT latency_histogram_add(NULL, '{1,2}');
+SELECT latency_histogram_add('{1}', '{1,2}');
+SELECT latency_histogram_merge(h)
+  FROM (VALUES ('{1,0,2}'::int8[]), ('{0,3,1}'), (NULL)) AS v(h);
+SELECT count(*) FROM pg_stat_database_latency
+ WHERE datname = current_database();
@@ -0,0 +1,18 @@
+--
+-- Per-query memory limit and memory context reports
+--
+SELECT name, parent, level FROM pg_backend_memory_contexts(pg_backend_pid())
+  WHERE level = 0;
+SELECT count(*) > 0 AS ok FROM pg_backend_memory_contexts(pg_backend_pid())
+  WHERE total_bytes >= bytes;
+
+-- building a 10MB string does not fit into 1MB
+SET query_mem_limit = '1MB';
+\set VERBOSITY terse
+SELECT length(string_agg(repeat('x', 1000), '')) FROM generate_series(1, 10000);
+\set VERBOSITY default
+SELECT length(string_agg(repeat('x', 1000), '')) FROM generate_series(1, 100);
+RESET query_mem_limit;
+SELECT length(string_agg(repeat('x', 1000), '')) FROM generate_series(1, 10000);
+
+SELECT * FROM pg_backend_memory_contexts(0);
@@ -213,3 +213,9 @@ drop function sillysrf(int);
 -- (see bug #5084)
 select * from (values (2),(null),(1)) v(k) where k = k order by k;
 select * from (values (2),(null),(1)) v(k) where k = k order by k desc;
+
+-- in-memory sorts of many integer keys, nulls included
+select count(*) from (select v, lag(v) over (order by v) as p from (select case when i % 10 = 0 then null else (i * 7919) % 1000 - 500 end as v from generate_series(1, 5000) i) s) x where p > v;
+select count(*) from (select v, lag(v) over (order by v desc nulls last) as p from (select case when i % 10 = 0 then null else (i::int8 * 7919) % 100000 - 50000 end as v from generate_series(1, 5000) i) s) x where p < v;
+-- text sorts in the C collation, with and without a common prefix
+select count(*) from (select t, lag(t) over (order by t collate "C") as p from (select case when i % 2 = 0 then md5(i::text) else 'abcdefgh' || md5(i::text) end as t from generate_series(1, 3000) i) s) x where p > t collate "C";
@@ -0,0 +1,13 @@
+--
+-- WAL_COMPRESSION
+--
+SET wal_compression = on;
+SELECT compressed_images FROM pg_xlog_compression_stats() \gset
+CHECKPOINT;
+-- the first changes of the catalog pages after a checkpoint log their images
+CREATE TABLE wal_compression_tbl (a int, b text);
+SELECT compressed_images > :compressed_images AS compressed,
+       image_bytes >= stored_bytes AS smaller
+  FROM pg_xlog_compression_stats();
+DROP TABLE wal_compression_tbl;
+RESET wal_compression;
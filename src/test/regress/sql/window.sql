@@ -278,3 +278,12 @@ SELECT nth_value_def(n := 2, val := ten) OVER (PARTITION BY four), ten, four
 
 SELECT nth_value_def(ten) OVER (PARTITION BY four), ten, four
   FROM (SELECT * FROM tenk1 WHERE unique2 < 10 ORDER BY four, ten) s;
+
+-- moving frames remove the rows leaving the frame from count, sum and avg
+SELECT i, sum(v) OVER w, avg(v) OVER w, count(v) OVER w, count(*) OVER w
+  FROM (VALUES (1, 1), (2, NULL), (3, 3), (4, NULL), (5, NULL), (6, 6), (7, 7)) t(i, v)
+  WINDOW w AS (ORDER BY i ROWS BETWEEN 1 PRECEDING AND CURRENT ROW);
+
+SELECT i, sum(v) OVER w, count(v) OVER w
+  FROM (VALUES (1, 1), (2, NULL), (3, 3), (4, NULL), (5, NULL), (6, 6), (7, 7)) t(i, v)
+  WINDOW w AS (ORDER BY i ROWS BETWEEN 1 FOLLOWING AND 2 FOLLOWING);
@@ -14,6 +14,14 @@ SELECT count(*) FROM (
     SELECT * FROM q1
 ) ss;
 
+-- CTEs over distributed tables are also fetched once for all their consumers
+CREATE TEMP TABLE cte_shared (a int, b int) DISTRIBUTE BY HASH(a);
+INSERT INTO cte_shared SELECT i, i % 4 FROM generate_series(1, 20) i;
+WITH q1 AS (SELECT a, b, random() AS r FROM cte_shared)
+SELECT count(*) FROM q1 x JOIN q1 y ON x.a = y.a AND x.r = y.r
+  WHERE y.b IN (SELECT b FROM q1 z WHERE z.r = x.r);
+DROP TABLE cte_shared;
+
 -- WITH RECURSIVE
 
 -- sum of 1..100
@@ -128,10 +128,15 @@ select * from tab1_hash where val = 3 + 4 and val2 = 8;
 explain (costs off, verbose on, nodes off, num_nodes on) select * from tab1_hash where val = 3 + 4;
 select * from tab1_hash where val = char_length('len')+4;
 explain (costs off, verbose on, nodes off, num_nodes on) select * from tab1_hash where val = char_length('len')+4;
+select * from tab1_hash where val in (7, 3 + 4);
+explain (costs off, verbose on, nodes off, num_nodes on) select * from tab1_hash where val in (7, 3 + 4);
 -- insert some more values 
 insert into tab1_hash values (7, 2); 
 select avg(val) from tab1_hash where val = 7;
 explain (costs off, verbose on, nodes off, num_nodes on) select avg(val) from tab1_hash where val = 7;
+-- the same query with other values finds its node again from the FQS cache
+select avg(val) from tab1_hash where val = 2;
+explain (costs off, verbose on, nodes off, num_nodes on) select avg(val) from tab1_hash where val = 9;
 select val, val2 from tab1_hash where val = 7 order by val2;
 explain (costs off, verbose on, nodes off, num_nodes on) select val, val2 from tab1_hash where val = 7 order by val2;
 select distinct val2 from tab1_hash where val = 7;
@@ -204,6 +204,19 @@ select * from single_node_rep_tab natural full outer join single_node_mod_tab or
 explain (costs off, verbose on, nodes off)
 select * from single_node_rep_tab natural full outer join single_node_mod_tab order by val, val2;
 
+-- correlated EXISTS which cannot become a semi-join, the rows of tab2_mod
+-- can be fetched once and hashed instead of scanned for each outer row
+select count(*) from tab1_mod t1 where exists (select 1 from tab2_mod t2
+		where t2.val = t1.val and t2.val2 = t1.val2 + 3) or t1.val > 4;
+
+-- reads of replicated tables spread over their Datanodes
+set replicated_read_routing to round_robin;
+select count(*) from tab1_rep;
+select count(*) from tab1_rep;
+set replicated_read_routing to least_loaded;
+select count(*) from tab1_rep;
+reset replicated_read_routing;
+
 -- DMLs involving JOINs are not FQSed
 -- We need to just make sure that FQS is not kicking in. But the JOINs can still
 -- be reduced by JOIN reduction optimization. Turn this optimization off so as
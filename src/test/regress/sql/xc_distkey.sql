@@ -250,3 +250,44 @@ insert into my_rr_tab values(2, 'Two');
 
 select * from my_rr_tab order by a;
 
+-- Distribution through virtual buckets
+create table bk_tab(a integer, b text) distribute by bucket(a);
+insert into bk_tab select i, 'row ' || i from generate_series(1, 10) i;
+insert into bk_tab values(null, 'null');
+select pchashbuckets, array_length(pcbucketmap::int2[], 1) from pgxc_class where pcrelid = 'bk_tab'::regclass;
+select count(*) from bk_tab;
+select * from bk_tab where a = 7;
+select * from bk_tab where a is null;
+select pgxc_bucket_of(7, 1024) between 0 and 1023;
+select pgxc_redistribute_buckets('bk_tab'::regclass, 16);
+drop table bk_tab;
+-- Tables put on the same nodes in the same way are in one colocation group
+create table bk_tab1(a integer, b text) distribute by bucket(a);
+create table bk_tab2(a integer, c text) distribute by bucket(a);
+create table bk_tab3(a bigint, d text) distribute by bucket(a);
+select count(distinct pccolocation) from pgxc_class where pcrelid in ('bk_tab1'::regclass, 'bk_tab2'::regclass);
+select count(distinct pccolocation) from pgxc_class where pcrelid in ('bk_tab1'::regclass, 'bk_tab3'::regclass);
+insert into bk_tab1 select i, 'b ' || i from generate_series(1, 20) i;
+insert into bk_tab2 select i, 'c ' || i from generate_series(11, 30) i;
+select count(*), min(a), max(a) from bk_tab1 join bk_tab2 using (a);
+select count(*) from bk_tab1 left join bk_tab2 using (a) where c is null;
+drop table bk_tab1, bk_tab2, bk_tab3;
+
+-- Distribution by ranges and lists of values, nodes are taken in name order
+create table rg_tab(a integer, b text) distribute by range(a, 100);
+insert into rg_tab values(1, 'One'), (50, 'Fifty'), (100, 'Hundred'), (150, 'Hundred fifty'), (null, 'null');
+select pgxc_distribution_values('rg_tab'::regclass);
+select count(distinct xc_node_id) from rg_tab where a < 100;
+select count(distinct xc_node_id) from rg_tab where a >= 100;
+select count(distinct xc_node_id) from rg_tab;
+explain (costs off, verbose on, nodes off, num_nodes on) select * from rg_tab where a >= 100;
+select * from rg_tab where a >= 100 order by a;
+drop table rg_tab;
+create table rg_tab(a integer, b text) distribute by range(a, 100, 200);
+create table ls_tab(a text, b integer) distribute by list(a, ('red', 'blue'), 'green');
+insert into ls_tab values('red', 1), ('blue', 2), ('green', 3);
+insert into ls_tab values('black', 4);
+select pgxc_distribution_values('ls_tab'::regclass);
+select count(distinct xc_node_id) from ls_tab where a in ('red', 'blue');
+select * from ls_tab where a = 'green';
+drop table ls_tab;
@@ -0,0 +1,24 @@
+--
+-- XC_FUNDIST
+--
+-- calls of functions shipped to the Datanode of their argument
+create table xc_fd_orders(c int, amount int) distribute by hash(c);
+create function xc_fd_new_order(int, int) returns bigint as $$
+begin
+	insert into xc_fd_orders values($1, $2);
+	update xc_fd_orders set amount = amount + 1 where c = $1;
+	return (select count(*) from xc_fd_orders where c = $1);
+end;
+$$ language plpgsql;
+alter function xc_fd_new_order(int, int) set function_distribute_by = 'orders'; -- error
+alter function xc_fd_new_order(int, int) set function_distribute_by = '1, xc_fd_orders';
+select xc_fd_new_order(1, 10);
+select xc_fd_new_order(1, 20);
+select xc_fd_new_order(2, 30);
+prepare xc_fd_call(int) as select xc_fd_new_order($1, 40);
+execute xc_fd_call(2);
+select xc_fd_new_order(null, 50);
+select * from xc_fd_orders order by c, amount;
+deallocate xc_fd_call;
+drop function xc_fd_new_order(int, int);
+drop table xc_fd_orders;
@@ -40,6 +40,8 @@ explain (verbose true, costs false, nodes false) select count(*) + sum(val) + av
 -- group by with expressions in group by clause
 select sum(val), avg(val), 2 * val2 expr from xc_groupby_tab1 group by 2 * val2 order by expr; 
 explain (verbose true, costs false, nodes false) select sum(val), avg(val), 2 * val2 expr from xc_groupby_tab1 group by 2 * val2 order by expr;
+-- DISTINCT aggregates
+select count(distinct val), val2 from xc_groupby_tab1 group by val2 order by val2;
 drop table xc_groupby_tab1;
 drop table xc_groupby_tab2;
 
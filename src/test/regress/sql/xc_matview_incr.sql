@@ -0,0 +1,42 @@
+--
+-- XC_MATVIEW_INCR
+--
+-- Incremental refresh of aggregate materialized views from a delta table
+create table xc_mv_fact(k int, g int, v numeric) distribute by hash(k);
+insert into xc_mv_fact select i, i % 3, i from generate_series(1, 30) i;
+create materialized view xc_mv_agg as
+	select g, count(*) as n, count(v) as nv, sum(v) as s from xc_mv_fact group by g;
+create materialized view xc_mv_max as
+	select g, count(*) as n, max(v) as m from xc_mv_fact group by g;
+select pgxc_matview_enable_incremental('xc_mv_agg');
+select pgxc_matview_enable_incremental('xc_mv_max');
+select pgxc_matview_enable_incremental('xc_mv_agg'); -- error
+-- the first refresh is a full one
+refresh materialized view xc_mv_agg;
+refresh materialized view xc_mv_max;
+insert into xc_mv_fact values(31, 3, 100), (32, 0, null);
+refresh materialized view xc_mv_max;
+select * from xc_mv_max order by g;
+delete from xc_mv_fact where g = 2;
+update xc_mv_fact set v = v + 1 where k = 1;
+select count(*) from xc_mv_agg_delta;
+refresh materialized view xc_mv_agg;
+select count(*) from xc_mv_agg_delta;
+select * from xc_mv_agg order by g;
+select g, count(*), count(v), sum(v) from xc_mv_fact group by g order by g;
+-- removed rows make a max refresh in full
+refresh materialized view xc_mv_max;
+select * from xc_mv_max order by g;
+truncate xc_mv_fact;
+select count(*) from xc_mv_agg_delta where mvdelta_inserted is null;
+refresh materialized view xc_mv_agg;
+select * from xc_mv_agg order by g;
+create materialized view xc_mv_plain as select * from xc_mv_fact;
+select pgxc_matview_enable_incremental('xc_mv_plain'); -- error
+select pgxc_matview_disable_incremental('xc_mv_agg');
+select pgxc_matview_disable_incremental('xc_mv_max');
+select pgxc_matview_disable_incremental('xc_mv_max'); -- error
+drop materialized view xc_mv_plain;
+drop materialized view xc_mv_agg;
+drop materialized view xc_mv_max;
+drop table xc_mv_fact;
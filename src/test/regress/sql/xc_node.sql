@@ -39,3 +39,17 @@ ALTER NODE dummy_node WITH (PREFERRED);
 ALTER NODE dummy_node WITH (PRIMARY);
 ALTER NODE dummy_node WITH (TYPE = 'datanode');
 DROP NODE dummy_node;
+
+-- Hot standby slaves read-only transactions may use
+CREATE NODE dummy_node WITH (TYPE = 'datanode', PORT = 5433, SLAVE_HOST = 'slave_host_1');
+SELECT node_name, node_port, node_slave_host, node_slave_port FROM pgxc_node
+WHERE node_name = 'dummy_node';
+ALTER NODE dummy_node WITH (SLAVE_PORT = 5434);
+ALTER NODE dummy_node WITH (SLAVE_PORT = 70000); -- port value error
+SELECT node_name, node_port, node_slave_host, node_slave_port FROM pgxc_node
+WHERE node_name = 'dummy_node';
+ALTER NODE dummy_node WITH (SLAVE_HOST = ''); -- no slave anymore
+SELECT node_name, node_port, node_slave_host, node_slave_port FROM pgxc_node
+WHERE node_name = 'dummy_node';
+DROP NODE dummy_node;
+CREATE NODE dummy_node WITH (TYPE = 'coordinator', SLAVE_HOST = 'slave_host_1'); -- fail
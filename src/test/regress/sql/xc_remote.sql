@@ -255,3 +255,26 @@ DROP FUNCTION func_immutable (int);
 drop table xcrem_employee, xcrem_temptable;
 drop function volatile_func(int);
 
+-- Cursors fetching their rows by remote_fetch_size
+CREATE TABLE xcrem_fetch_rep (a int, b text) DISTRIBUTE BY REPLICATION;
+CREATE TABLE xcrem_fetch_hash (a int, b text) DISTRIBUTE BY HASH (a);
+INSERT INTO xcrem_fetch_rep SELECT i, 'row ' || i FROM generate_series(1, 30) i;
+INSERT INTO xcrem_fetch_hash SELECT i, 'same' FROM generate_series(1, 30) i;
+BEGIN;
+SET LOCAL remote_fetch_size = 4;
+DECLARE xcrem_c1 CURSOR FOR SELECT a, b FROM xcrem_fetch_rep ORDER BY a;
+DECLARE xcrem_c2 CURSOR FOR SELECT b FROM xcrem_fetch_hash;
+FETCH 3 FROM xcrem_c1;
+FETCH 3 FROM xcrem_c2;
+-- other queries can use the connections in between
+SELECT count(*) FROM xcrem_fetch_rep;
+SELECT count(*) FROM xcrem_fetch_hash;
+FETCH 6 FROM xcrem_c1;
+MOVE 20 FROM xcrem_c2;
+FETCH ALL FROM xcrem_c2;
+FETCH ALL FROM xcrem_c1;
+CLOSE xcrem_c1;
+CLOSE xcrem_c2;
+COMMIT;
+DROP TABLE xcrem_fetch_rep, xcrem_fetch_hash;
+
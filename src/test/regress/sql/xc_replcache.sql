@@ -0,0 +1,17 @@
+--
+-- XC_REPLCACHE
+--
+-- Rows of replicated tables kept by the Coordinator are used only under the
+-- same snapshot, never once the transaction wrote
+create table xc_r3(a int, b int) distribute by replication;
+insert into xc_r3 values(1,2),(3,4);
+set replicated_table_cache_size = '1MB';
+begin transaction isolation level repeatable read;
+select * from xc_r3 order by a;
+select * from xc_r3 order by a;
+insert into xc_r3 values(5,6);
+select * from xc_r3 order by a;
+commit;
+select * from xc_r3 order by a;
+reset replicated_table_cache_size;
+drop table xc_r3;
@@ -0,0 +1,13 @@
+--
+-- XC_TABLESAMPLE
+--
+-- sampling of tables with TABLESAMPLE
+create table xc_ts_tab(a int, b int) distribute by hash(a);
+insert into xc_ts_tab select i, i % 10 from generate_series(1, 1000) i;
+select count(*) from xc_ts_tab tablesample system (100);
+select count(*) from xc_ts_tab tablesample bernoulli (100) repeatable (1);
+select count(*) from xc_ts_tab tablesample system (0);
+select count(*) from xc_ts_tab tablesample bernoulli (0) where b = 1;
+select count(*) from xc_ts_tab tablesample system (101); -- error
+select count(*) from xc_ts_tab tablesample foo (10); -- error
+drop table xc_ts_tab;
@@ -0,0 +1,26 @@
+--
+-- XC_XIDCACHE
+--
+-- status of transactions which never ran on a Datanode comes from AGTM
+create function xc_xs_on_node(query text) returns text as $$
+declare
+	r record;
+begin
+	for r in execute 'execute direct on (' || get_xc_node_name(1) || ') '
+			|| quote_literal(query) loop
+		return r.v;
+	end loop;
+	return null;
+end;
+$$ language plpgsql;
+select txid_current() as xc_xs_a \gset
+select txid_current() as xc_xs_b \gset
+create table xc_xs_tab(a int) distribute by replication;
+insert into xc_xs_tab values(1);
+select xc_xs_on_node('select hits::text as v from pg_agtm_xid_status_cache') as xc_xs_hits \gset
+select xc_xs_on_node('select pg_xact_status(' || :xc_xs_a || ')::text as v');
+select xc_xs_on_node('select pg_xact_status(' || :xc_xs_b || ')::text as v');
+select xc_xs_on_node('select pg_xact_status(' || :xc_xs_a || ')::text as v');
+select xc_xs_on_node('select hits::text as v from pg_agtm_xid_status_cache')::bigint > :xc_xs_hits as hit;
+drop table xc_xs_tab;
+drop function xc_xs_on_node(text);